@@ -254,7 +254,7 @@ private:
         if (currentBatchSize > 0)
         {
             // Update vertex buffer by batch container
-            commands->UpdateBuffer(*vertexBuffer, 0, vertexBatch.data(), static_cast<std::uint16_t>(sizeof(Vertex) * currentBatchSize));
+            commands->UpdateBuffer(*vertexBuffer, 0, vertexBatch.data(), sizeof(Vertex) * currentBatchSize);
             commands->Draw(currentBatchSize, 0);
 
             // Reset batch size
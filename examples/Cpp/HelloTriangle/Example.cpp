@@ -196,7 +196,7 @@ int main(int argc, char* argv[])
         const std::string cacheFilename = "GraphicsPSO." + rendererModule + ".cache";
         bool hasInitialCache = false;
 
-        LLGL::Blob pipelineCacheBlob = LLGL::Blob::CreateFromFile(cacheFilename);
+        LLGL::Blob pipelineCacheBlob = LLGL::Blob::CreateFromFileMapped(cacheFilename);
         if (pipelineCacheBlob)
         {
             LLGL::Log::Printf("Pipeline cache restored: %zu bytes\n", pipelineCacheBlob.GetSize());
@@ -560,7 +560,7 @@ private:
             // Update constant buffer with all settings at once
             UpdateSettingsForTexture(GetCbufferData(0));
             UpdateSettingsForScreen(GetCbufferData(1));
-            commands->UpdateBuffer(*constantBuffer, 0, cbufferData.data(), static_cast<std::uint16_t>(cbufferData.size()));
+            commands->UpdateBuffer(*constantBuffer, 0, cbufferData.data(), cbufferData.size());
 
             #endif // /ENABLE_CBUFFER_RANGE
 
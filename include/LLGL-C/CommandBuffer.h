@@ -15,16 +15,141 @@
 #include <stdbool.h>
 
 
+/*
+Command packets for llglExecuteCommandPackets.
+Language bindings with expensive foreign function calls can record the per-draw commands into a flat array of these POD structures
+and submit them with a single call, which decodes them into the command buffer that is currently being recorded.
+*/
+typedef enum LLGLCommandPacketType
+{
+    LLGLCommandPacketTypeSetViewport,
+    LLGLCommandPacketTypeSetScissor,
+    LLGLCommandPacketTypeSetVertexBuffer,
+    LLGLCommandPacketTypeSetIndexBuffer,
+    LLGLCommandPacketTypeSetResourceHeap,
+    LLGLCommandPacketTypeSetResource,
+    LLGLCommandPacketTypeSetPipelineState,
+    LLGLCommandPacketTypeSetStencilReference,
+    LLGLCommandPacketTypeSetUniforms,
+    LLGLCommandPacketTypeClear,
+    LLGLCommandPacketTypeDraw,
+    LLGLCommandPacketTypeDrawIndexed,
+    LLGLCommandPacketTypeDrawInstanced,
+    LLGLCommandPacketTypeDrawIndexedInstanced,
+    LLGLCommandPacketTypeDrawMesh,
+    LLGLCommandPacketTypeDispatch,
+    LLGLCommandPacketTypePushDebugGroup,
+    LLGLCommandPacketTypePopDebugGroup,
+}
+LLGLCommandPacketType;
+
+typedef struct LLGLCommandPacketSetIndexBuffer
+{
+    LLGLBuffer  buffer;
+    LLGLFormat  format; /* LLGLFormatUndefined binds the buffer with its own index format, which requires a zero offset. */
+    uint64_t    offset;
+}
+LLGLCommandPacketSetIndexBuffer;
+
+typedef struct LLGLCommandPacketSetResourceHeap
+{
+    LLGLResourceHeap    resourceHeap;
+    uint32_t            descriptorSet;
+}
+LLGLCommandPacketSetResourceHeap;
+
+typedef struct LLGLCommandPacketSetResource
+{
+    LLGLResource    resource;
+    uint32_t        descriptor;
+}
+LLGLCommandPacketSetResource;
+
+typedef struct LLGLCommandPacketSetStencilReference
+{
+    uint32_t        reference;
+    LLGLStencilFace stencilFace;
+}
+LLGLCommandPacketSetStencilReference;
+
+typedef struct LLGLCommandPacketSetUniforms
+{
+    const void* data;       /* Must remain valid until llglExecuteCommandPackets returns. */
+    uint32_t    first;
+    uint16_t    dataSize;
+}
+LLGLCommandPacketSetUniforms;
+
+typedef struct LLGLCommandPacketClear
+{
+    LLGLClearValue  clearValue;
+    uint32_t        flags;  /* Bitwise OR combination of LLGLClearFlags. */
+}
+LLGLCommandPacketClear;
+
+typedef struct LLGLCommandPacketDraw
+{
+    uint32_t numVertices;
+    uint32_t firstVertex;
+    uint32_t numInstances;  /* Only used by LLGLCommandPacketTypeDrawInstanced. */
+    uint32_t firstInstance; /* Only used by LLGLCommandPacketTypeDrawInstanced. */
+}
+LLGLCommandPacketDraw;
+
+typedef struct LLGLCommandPacketDrawIndexed
+{
+    uint32_t numIndices;
+    uint32_t firstIndex;
+    int32_t  vertexOffset;
+    uint32_t numInstances;  /* Only used by LLGLCommandPacketTypeDrawIndexedInstanced. */
+    uint32_t firstInstance; /* Only used by LLGLCommandPacketTypeDrawIndexedInstanced. */
+}
+LLGLCommandPacketDrawIndexed;
+
+typedef struct LLGLCommandPacketWorkGroups
+{
+    uint32_t numWorkGroupsX;
+    uint32_t numWorkGroupsY;
+    uint32_t numWorkGroupsZ;
+}
+LLGLCommandPacketWorkGroups;
+
+typedef struct LLGLCommandPacket
+{
+    LLGLCommandPacketType type;
+    union
+    {
+        LLGLViewport                            viewport;           /* LLGLCommandPacketTypeSetViewport */
+        LLGLScissor                             scissor;            /* LLGLCommandPacketTypeSetScissor */
+        LLGLBuffer                              vertexBuffer;       /* LLGLCommandPacketTypeSetVertexBuffer */
+        LLGLCommandPacketSetIndexBuffer         indexBuffer;        /* LLGLCommandPacketTypeSetIndexBuffer */
+        LLGLCommandPacketSetResourceHeap        resourceHeap;       /* LLGLCommandPacketTypeSetResourceHeap */
+        LLGLCommandPacketSetResource            resource;           /* LLGLCommandPacketTypeSetResource */
+        LLGLPipelineState                       pipelineState;      /* LLGLCommandPacketTypeSetPipelineState */
+        LLGLCommandPacketSetStencilReference    stencilReference;   /* LLGLCommandPacketTypeSetStencilReference */
+        LLGLCommandPacketSetUniforms            uniforms;           /* LLGLCommandPacketTypeSetUniforms */
+        LLGLCommandPacketClear                  clear;              /* LLGLCommandPacketTypeClear */
+        LLGLCommandPacketDraw                   draw;               /* LLGLCommandPacketTypeDraw, LLGLCommandPacketTypeDrawInstanced */
+        LLGLCommandPacketDrawIndexed            drawIndexed;        /* LLGLCommandPacketTypeDrawIndexed, LLGLCommandPacketTypeDrawIndexedInstanced */
+        LLGLCommandPacketWorkGroups             workGroups;         /* LLGLCommandPacketTypeDrawMesh, LLGLCommandPacketTypeDispatch */
+        const char*                             debugGroupName;     /* LLGLCommandPacketTypePushDebugGroup */
+    }
+    data;
+}
+LLGLCommandPacket;
+
+
 LLGL_C_EXPORT void llglBegin(LLGLCommandBuffer commandBuffer);
 LLGL_C_EXPORT void llglEnd();
 LLGL_C_EXPORT void llglExecute(LLGLCommandBuffer deferredCommandBuffer);
-LLGL_C_EXPORT void llglUpdateBuffer(LLGLBuffer dstBuffer, uint64_t dstOffset, const void* data, uint16_t dataSize);
+LLGL_C_EXPORT void llglUpdateBuffer(LLGLBuffer dstBuffer, uint64_t dstOffset, const void* data, uint64_t dataSize);
 LLGL_C_EXPORT void llglCopyBuffer(LLGLBuffer dstBuffer, uint64_t dstOffset, LLGLBuffer srcBuffer, uint64_t srcOffset, uint64_t size);
 LLGL_C_EXPORT void llglCopyBufferFromTexture(LLGLBuffer dstBuffer, uint64_t dstOffset, LLGLTexture srcTexture, const LLGLTextureRegion* srcRegion, uint32_t rowStride, uint32_t layerStride);
 LLGL_C_EXPORT void llglFillBuffer(LLGLBuffer dstBuffer, uint64_t dstOffset, uint32_t value, uint64_t fillSize);
 LLGL_C_EXPORT void llglCopyTexture(LLGLTexture dstTexture, const LLGLTextureLocation* dstLocation, LLGLTexture srcTexture, const LLGLTextureLocation* srcLocation, const LLGLExtent3D* extent);
 LLGL_C_EXPORT void llglCopyTextureFromBuffer(LLGLTexture dstTexture, const LLGLTextureRegion* dstRegion, LLGLBuffer srcBuffer, uint64_t srcOffset, uint32_t rowStride, uint32_t layerStride);
 LLGL_C_EXPORT void llglCopyTextureFromFramebuffer(LLGLTexture dstTexture, const LLGLTextureRegion* dstRegion, const LLGLOffset2D* srcOffset);
+LLGL_C_EXPORT void llglBlitTexture(LLGLTexture dstTexture, const LLGLTextureRegion* dstRegion, LLGLTexture srcTexture, const LLGLTextureRegion* srcRegion, LLGLSamplerFilter filter);
 LLGL_C_EXPORT void llglGenerateMips(LLGLTexture texture);
 LLGL_C_EXPORT void llglGenerateMipsRange(LLGLTexture texture, const LLGLTextureSubresource* subresource);
 LLGL_C_EXPORT void llglSetViewport(const LLGLViewport* viewport);
@@ -32,25 +157,36 @@ LLGL_C_EXPORT void llglSetViewports(uint32_t numViewports, const LLGLViewport* v
 LLGL_C_EXPORT void llglSetScissor(const LLGLScissor* scissor);
 LLGL_C_EXPORT void llglSetScissors(uint32_t numScissors, const LLGLScissor* scissors LLGL_ANNOTATE([numScissors]));
 LLGL_C_EXPORT void llglSetVertexBuffer(LLGLBuffer buffer);
+LLGL_C_EXPORT void llglSetVertexBufferExt(LLGLBuffer buffer, uint64_t offset);
 LLGL_C_EXPORT void llglSetVertexBufferArray(LLGLBufferArray bufferArray);
 LLGL_C_EXPORT void llglSetIndexBuffer(LLGLBuffer buffer);
 LLGL_C_EXPORT void llglSetIndexBufferExt(LLGLBuffer buffer, LLGLFormat format, uint64_t offset);
 LLGL_C_EXPORT void llglSetResourceHeap(LLGLResourceHeap resourceHeap, uint32_t descriptorSet);
 LLGL_C_EXPORT void llglSetResource(uint32_t descriptor, LLGLResource resource);
+LLGL_C_EXPORT void llglSetResources(uint32_t firstDescriptor, uint32_t numResources, const LLGLResource* resources LLGL_ANNOTATE([numResources]));
 LLGL_C_EXPORT void llglResetResourceSlots(LLGLResourceType resourceType, uint32_t firstSlot, uint32_t numSlots, long bindFlags, long stageFlags);
+LLGL_C_EXPORT void llglResourceBarrier(uint32_t numBarriers, const LLGLResourceBarrierDescriptor* barriers LLGL_ANNOTATE([numBarriers]));
 LLGL_C_EXPORT void llglBeginRenderPass(LLGLRenderTarget renderTarget);
 LLGL_C_EXPORT void llglBeginRenderPassWithClear(LLGLRenderTarget renderTarget, LLGLRenderPass renderPass, uint32_t numClearValues, const LLGLClearValue* clearValues LLGL_ANNOTATE([numClearValues]), uint32_t swapBufferIndex);
 LLGL_C_EXPORT void llglEndRenderPass();
+LLGL_C_EXPORT void llglNextSubpass();
 LLGL_C_EXPORT void llglClear(long flags, const LLGLClearValue* clearValue);
 LLGL_C_EXPORT void llglClearAttachments(uint32_t numAttachments, const LLGLAttachmentClear* attachments LLGL_ANNOTATE([numAttachments]));
 LLGL_C_EXPORT void llglSetPipelineState(LLGLPipelineState pipelineState);
 LLGL_C_EXPORT void llglSetBlendFactor(const float color[4]);
 LLGL_C_EXPORT void llglSetStencilReference(uint32_t reference, LLGLStencilFace stencilFace);
+LLGL_C_EXPORT void llglSetShadingRate(LLGLShadingRate rate);
+LLGL_C_EXPORT void llglSetCullMode(LLGLCullMode cullMode);
+LLGL_C_EXPORT void llglSetDepthState(const LLGLDepthDescriptor* depthDesc);
+LLGL_C_EXPORT void llglSetStencilState(const LLGLStencilDescriptor* stencilDesc);
+LLGL_C_EXPORT void llglSetPrimitiveTopology(LLGLPrimitiveTopology topology);
 LLGL_C_EXPORT void llglSetUniforms(uint32_t first, const void* data, uint16_t dataSize);
 LLGL_C_EXPORT void llglBeginQuery(LLGLQueryHeap queryHeap, uint32_t query);
 LLGL_C_EXPORT void llglEndQuery(LLGLQueryHeap queryHeap, uint32_t query);
 LLGL_C_EXPORT void llglBeginRenderCondition(LLGLQueryHeap queryHeap, uint32_t query, LLGLRenderConditionMode mode);
+LLGL_C_EXPORT void llglBeginRenderConditionBuffer(LLGLBuffer buffer, uint64_t offset, LLGLRenderConditionMode mode);
 LLGL_C_EXPORT void llglEndRenderCondition();
+LLGL_C_EXPORT void llglResolveQueries(LLGLQueryHeap queryHeap, uint32_t firstQuery, uint32_t numQueries, LLGLBuffer dstBuffer, uint64_t dstOffset);
 LLGL_C_EXPORT void llglBeginStreamOutput(uint32_t numBuffers, LLGLBuffer const * buffers LLGL_ANNOTATE([numBuffers]));
 LLGL_C_EXPORT void llglEndStreamOutput();
 LLGL_C_EXPORT void llglDraw(uint32_t numVertices, uint32_t firstVertex);
@@ -62,14 +198,20 @@ LLGL_C_EXPORT void llglDrawIndexedInstanced(uint32_t numIndices, uint32_t numIns
 LLGL_C_EXPORT void llglDrawIndexedInstancedExt(uint32_t numIndices, uint32_t numInstances, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance);
 LLGL_C_EXPORT void llglDrawIndirect(LLGLBuffer buffer, uint64_t offset);
 LLGL_C_EXPORT void llglDrawIndirectExt(LLGLBuffer buffer, uint64_t offset, uint32_t numCommands, uint32_t stride);
+LLGL_C_EXPORT void llglDrawIndirectCount(LLGLBuffer buffer, uint64_t offset, LLGLBuffer countBuffer, uint64_t countBufferOffset, uint32_t maxNumCommands, uint32_t stride);
 LLGL_C_EXPORT void llglDrawIndexedIndirect(LLGLBuffer buffer, uint64_t offset);
 LLGL_C_EXPORT void llglDrawIndexedIndirectExt(LLGLBuffer buffer, uint64_t offset, uint32_t numCommands, uint32_t stride);
+LLGL_C_EXPORT void llglDrawIndexedIndirectCount(LLGLBuffer buffer, uint64_t offset, LLGLBuffer countBuffer, uint64_t countBufferOffset, uint32_t maxNumCommands, uint32_t stride);
+LLGL_C_EXPORT void llglDrawStreamOutput();
+LLGL_C_EXPORT void llglDrawMesh(uint32_t numWorkGroupsX, uint32_t numWorkGroupsY, uint32_t numWorkGroupsZ);
+LLGL_C_EXPORT void llglDrawMeshIndirect(LLGLBuffer buffer, uint64_t offset, uint32_t numCommands, uint32_t stride);
 LLGL_C_EXPORT void llglDispatch(uint32_t numWorkGroupsX, uint32_t numWorkGroupsY, uint32_t numWorkGroupsZ);
 LLGL_C_EXPORT void llglDispatchIndirect(LLGLBuffer buffer, uint64_t offset);
 LLGL_C_EXPORT void llglPushDebugGroup(const char* name);
 LLGL_C_EXPORT void llglPopDebugGroup();
 LLGL_C_EXPORT void llglDoNativeCommand(const void* nativeCommand, size_t nativeCommandSize);
 LLGL_C_EXPORT bool llglGetNativeHandle(void* nativeHandle, size_t nativeHandleSize);
+LLGL_C_EXPORT void llglExecuteCommandPackets(uint32_t numPackets, const LLGLCommandPacket* packets LLGL_ANNOTATE([numPackets]));
 
 
 #endif
@@ -11,15 +11,22 @@
 
 #include <LLGL-C/Export.h>
 #include <LLGL-C/Types.h>
+#include <LLGL-C/LLGLWrapper.h>
 #include <stdint.h>
 #include <stddef.h>
 #include <stdbool.h>
 
 
 LLGL_C_EXPORT void llglSubmitCommandBuffer(LLGLCommandBuffer commandBuffer);
+LLGL_C_EXPORT void llglSubmitCommandBuffers(uint32_t numCommandBuffers, const LLGLCommandBuffer* commandBuffers LLGL_ANNOTATE([numCommandBuffers]));
+LLGL_C_EXPORT void llglPresentSwapChains(uint32_t numSwapChains, const LLGLSwapChain* swapChains LLGL_ANNOTATE([numSwapChains]));
 LLGL_C_EXPORT bool llglQueryResult(LLGLQueryHeap queryHeap, uint32_t firstQuery, uint32_t numQueries, void* data, size_t dataSize);
+LLGL_C_EXPORT bool llglQueryTimestampCalibration(LLGLTimestampCalibration* outCalibration);
 LLGL_C_EXPORT void llglSubmitFence(LLGLFence fence);
 LLGL_C_EXPORT bool llglWaitFence(LLGLFence fence, uint64_t timeout);
+LLGL_C_EXPORT void llglSubmitFenceValue(LLGLFence fence, uint64_t value);
+LLGL_C_EXPORT void llglSubmitWaitFenceValue(LLGLFence fence, uint64_t value);
+LLGL_C_EXPORT bool llglWaitFenceValue(LLGLFence fence, uint64_t value, uint64_t timeout);
 LLGL_C_EXPORT void llglWaitIdle();
 
 
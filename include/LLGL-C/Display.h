@@ -31,6 +31,8 @@ LLGL_C_EXPORT bool llglResetDisplayMode(LLGLDisplay display);
 LLGL_C_EXPORT bool llglSetDisplayMode(LLGLDisplay display, const LLGLDisplayMode* displayMode);
 LLGL_C_EXPORT void llglGetDisplayMode(LLGLDisplay display, LLGLDisplayMode* outDisplayMode);
 LLGL_C_EXPORT size_t llglGetSupportedDisplayModes(LLGLDisplay display, size_t maxNumDisplayModes, LLGLDisplayMode* outDisplayModes LLGL_ANNOTATE(NULL, [maxNumDisplayModes]));
+LLGL_C_EXPORT bool llglWaitForVBlank(LLGLDisplay display);
+LLGL_C_EXPORT bool llglGetDisplayVBlankTiming(LLGLDisplay display, LLGLDisplayVBlankTiming* outTiming);
 
 
 #endif
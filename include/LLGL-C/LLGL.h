@@ -25,6 +25,7 @@
 #include <LLGL-C/Shader.h>
 #include <LLGL-C/PipelineLayout.h>
 #include <LLGL-C/PipelineCache.h>
+#include <LLGL-C/Fence.h>
 #include <LLGL-C/PipelineState.h>
 #include <LLGL-C/RenderTarget.h>
 #include <LLGL-C/QueryHeap.h>
@@ -61,6 +61,18 @@ typedef enum LLGLStencilFace
 }
 LLGLStencilFace;
 
+typedef enum LLGLShadingRate
+{
+    LLGLShadingRateRate1x1,
+    LLGLShadingRateRate1x2,
+    LLGLShadingRateRate2x1,
+    LLGLShadingRateRate2x2,
+    LLGLShadingRateRate2x4,
+    LLGLShadingRateRate4x2,
+    LLGLShadingRateRate4x4,
+}
+LLGLShadingRate;
+
 typedef enum LLGLFormat
 {
     LLGLFormatUndefined,
@@ -555,6 +567,7 @@ typedef enum LLGLQueryType
     LLGLQueryTypeStreamOutPrimitivesWritten,
     LLGLQueryTypeStreamOutOverflow,
     LLGLQueryTypePipelineStatistics,
+    LLGLQueryTypeTimestamp,
 }
 LLGLQueryType;
 
@@ -670,6 +683,16 @@ typedef enum LLGLResourceType
 }
 LLGLResourceType;
 
+typedef enum LLGLResidencyPriority
+{
+    LLGLResidencyPriorityMinimum,
+    LLGLResidencyPriorityLow,
+    LLGLResidencyPriorityNormal,
+    LLGLResidencyPriorityHigh,
+    LLGLResidencyPriorityMaximum,
+}
+LLGLResidencyPriority;
+
 typedef enum LLGLSamplerAddressMode
 {
     LLGLSamplerAddressModeRepeat,
@@ -696,6 +719,8 @@ typedef enum LLGLShaderType
     LLGLShaderTypeGeometry,
     LLGLShaderTypeFragment,
     LLGLShaderTypeCompute,
+    LLGLShaderTypeTask,
+    LLGLShaderTypeMesh,
 }
 LLGLShaderType;
 
@@ -744,6 +769,24 @@ typedef enum LLGLSystemValue
 }
 LLGLSystemValue;
 
+typedef enum LLGLPresentMode
+{
+    LLGLPresentModeDefault,
+    LLGLPresentModeFifo,
+    LLGLPresentModeFifoRelaxed,
+    LLGLPresentModeMailbox,
+    LLGLPresentModeImmediate,
+}
+LLGLPresentMode;
+
+typedef enum LLGLColorSpace
+{
+    LLGLColorSpaceSRGB,
+    LLGLColorSpaceExtendedSRGB,
+    LLGLColorSpaceHDR10,
+}
+LLGLColorSpace;
+
 typedef enum LLGLTextureType
 {
     LLGLTextureTypeTexture1D,
@@ -769,6 +812,23 @@ typedef enum LLGLTextureSwizzle
 }
 LLGLTextureSwizzle;
 
+typedef enum LLGLWindowEventType
+{
+    LLGLWindowEventTypeQuit,
+    LLGLWindowEventTypeKeyDown,
+    LLGLWindowEventTypeKeyUp,
+    LLGLWindowEventTypeDoubleClick,
+    LLGLWindowEventTypeChar,
+    LLGLWindowEventTypeWheelMotion,
+    LLGLWindowEventTypeLocalMotion,
+    LLGLWindowEventTypeGlobalMotion,
+    LLGLWindowEventTypeResize,
+    LLGLWindowEventTypeUpdate,
+    LLGLWindowEventTypeGetFocus,
+    LLGLWindowEventTypeLostFocus,
+}
+LLGLWindowEventType;
+
 
 /* ----- Flags ----- */
 
@@ -780,12 +840,21 @@ LLGLCanvasFlags;
 
 typedef enum LLGLCommandBufferFlags
 {
-    LLGLCommandBufferSecondary       = (1 << 0),
-    LLGLCommandBufferMultiSubmit     = (1 << 1),
-    LLGLCommandBufferImmediateSubmit = (1 << 2),
+    LLGLCommandBufferSecondary        = (1 << 0),
+    LLGLCommandBufferMultiSubmit      = (1 << 1),
+    LLGLCommandBufferImmediateSubmit  = (1 << 2),
+    LLGLCommandBufferExplicitBarriers = (1 << 3),
 }
 LLGLCommandBufferFlags;
 
+typedef enum LLGLCommandQueueFlags
+{
+    LLGLCommandQueueGraphics = (1 << 0),
+    LLGLCommandQueueCompute  = (1 << 1),
+    LLGLCommandQueueCopy     = (1 << 2),
+}
+LLGLCommandQueueFlags;
+
 typedef enum LLGLClearFlags
 {
     LLGLClearColor        = (1 << 0),
@@ -831,12 +900,24 @@ typedef enum LLGLColorMaskFlags
 }
 LLGLColorMaskFlags;
 
+typedef enum LLGLDynamicStateFlags
+{
+    LLGLDynamicStateCullMode          = (1 << 0),
+    LLGLDynamicStateDepthState        = (1 << 1),
+    LLGLDynamicStateStencilState      = (1 << 2),
+    LLGLDynamicStatePrimitiveTopology = (1 << 3),
+}
+LLGLDynamicStateFlags;
+
 typedef enum LLGLRenderSystemFlags
 {
     LLGLRenderSystemDebugDevice  = (1 << 0),
     LLGLRenderSystemPreferNVIDIA = (1 << 1),
     LLGLRenderSystemPreferAMD    = (1 << 2),
     LLGLRenderSystemPreferIntel  = (1 << 3),
+    LLGLRenderSystemProfileOnly  = (1 << 4),
+    LLGLRenderSystemHeadless     = (1 << 5),
+    LLGLRenderSystemFrameCapture = (1 << 6),
 }
 LLGLRenderSystemFlags;
 
@@ -854,6 +935,7 @@ typedef enum LLGLBindFlags
     LLGLBindCombinedSampler        = (1 << 9),
     LLGLBindCopySrc                = (1 << 10),
     LLGLBindCopyDst                = (1 << 11),
+    LLGLBindInputAttachment        = (1 << 12),
 }
 LLGLBindFlags;
 
@@ -866,12 +948,17 @@ LLGLCPUAccessFlags;
 
 typedef enum LLGLMiscFlags
 {
-    LLGLMiscDynamicUsage  = (1 << 0),
-    LLGLMiscFixedSamples  = (1 << 1),
-    LLGLMiscGenerateMips  = (1 << 2),
-    LLGLMiscNoInitialData = (1 << 3),
-    LLGLMiscAppend        = (1 << 4),
-    LLGLMiscCounter       = (1 << 5),
+    LLGLMiscDynamicUsage      = (1 << 0),
+    LLGLMiscFixedSamples      = (1 << 1),
+    LLGLMiscGenerateMips      = (1 << 2),
+    LLGLMiscNoInitialData     = (1 << 3),
+    LLGLMiscAppend            = (1 << 4),
+    LLGLMiscCounter           = (1 << 5),
+    LLGLMiscTransient         = (1 << 6),
+    LLGLMiscSparse            = (1 << 7),
+    LLGLMiscReadback          = (1 << 8),
+    LLGLMiscMemoryless        = (1 << 9),
+    LLGLMiscPersistentMapping = (1 << 10),
 }
 LLGLMiscFlags;
 
@@ -905,9 +992,12 @@ typedef enum LLGLStageFlags
     LLGLStageGeometryStage       = (1 << 3),
     LLGLStageFragmentStage       = (1 << 4),
     LLGLStageComputeStage        = (1 << 5),
+    LLGLStageTaskStage           = (1 << 6),
+    LLGLStageMeshStage           = (1 << 7),
     LLGLStageAllTessStages       = (LLGLStageTessControlStage | LLGLStageTessEvaluationStage),
+    LLGLStageAllMeshStages       = (LLGLStageTaskStage | LLGLStageMeshStage),
     LLGLStageAllGraphicsStages   = (LLGLStageVertexStage | LLGLStageAllTessStages | LLGLStageGeometryStage | LLGLStageFragmentStage),
-    LLGLStageAllStages           = (LLGLStageAllGraphicsStages | LLGLStageComputeStage),
+    LLGLStageAllStages           = (LLGLStageAllGraphicsStages | LLGLStageComputeStage | LLGLStageAllMeshStages),
 }
 LLGLStageFlags;
 
@@ -951,11 +1041,12 @@ LLGLClearValue;
 
 typedef struct LLGLCommandBufferDescriptor
 {
-    const char*    debugName;          /* = NULL */
-    long           flags;              /* = 0 */
-    uint32_t       numNativeBuffers;   /* = 2 */
-    uint64_t       minStagingPoolSize; /* = (0xFFFF+1) */
-    LLGLRenderPass renderPass;         /* = LLGL_NULL_OBJECT */
+    const char*      debugName;          /* = NULL */
+    long             flags;              /* = 0 */
+    uint32_t         numNativeBuffers;   /* = 2 */
+    uint64_t         minStagingPoolSize; /* = (0xFFFF+1) */
+    LLGLRenderPass   renderPass;         /* = LLGL_NULL_OBJECT */
+    LLGLCommandQueue commandQueue;       /* = LLGL_NULL_OBJECT */
 }
 LLGLCommandBufferDescriptor;
 
@@ -987,6 +1078,12 @@ typedef struct LLGLDrawPatchIndirectArguments
 }
 LLGLDrawPatchIndirectArguments;
 
+typedef struct LLGLDrawMeshIndirectArguments
+{
+    uint32_t numWorkGroups[3];
+}
+LLGLDrawMeshIndirectArguments;
+
 typedef struct LLGLDispatchIndirectArguments
 {
     uint32_t numThreadGroups[3];
@@ -1020,6 +1117,13 @@ typedef struct LLGLScissor
 }
 LLGLScissor;
 
+typedef struct LLGLSpecializationConstant
+{
+    uint32_t id;    /* = 0 */
+    uint32_t value; /* = 0 */
+}
+LLGLSpecializationConstant;
+
 typedef struct LLGLDepthBiasDescriptor
 {
     float constantFactor; /* = 0.0f */
@@ -1030,9 +1134,13 @@ LLGLDepthBiasDescriptor;
 
 typedef struct LLGLComputePipelineDescriptor
 {
-    const char*        debugName;      /* = NULL */
-    LLGLPipelineLayout pipelineLayout; /* = LLGL_NULL_OBJECT */
-    LLGLShader         computeShader;  /* = LLGL_NULL_OBJECT */
+    const char*                       debugName;                  /* = NULL */
+    LLGLPipelineLayout                pipelineLayout;             /* = LLGL_NULL_OBJECT */
+    LLGLShader                        computeShader;              /* = LLGL_NULL_OBJECT */
+    size_t                            numSpecializationConstants; /* = 0 */
+    const LLGLSpecializationConstant* specializationConstants;    /* = NULL */
+    bool                              asyncCompilation;           /* = false */
+    LLGLPipelineState                 placeholder;                /* = LLGL_NULL_OBJECT */
 }
 LLGLComputePipelineDescriptor;
 
@@ -1052,13 +1160,36 @@ typedef struct LLGLQueryPipelineStatistics
 }
 LLGLQueryPipelineStatistics;
 
+typedef struct LLGLTimestampCalibration
+{
+    uint64_t cpuTick;      /* = 0 */
+    uint64_t gpuTimestamp; /* = 0 */
+    uint64_t maxDeviation; /* = 0 */
+}
+LLGLTimestampCalibration;
+
 typedef struct LLGLProfileTimeRecord
 {
-    const char* annotation;  /* = "" */
-    uint64_t    elapsedTime; /* = 0 */
+    const char* annotation;     /* = "" */
+    uint64_t    elapsedTime;    /* = 0 */
+    uint64_t    cpuTimestamp;   /* = 0 */
+    uint64_t    cpuElapsedTime; /* = 0 */
+    uint32_t    depth;          /* = 0 */
+    uint32_t    commandBuffer;  /* = 0 */
 }
 LLGLProfileTimeRecord;
 
+typedef struct LLGLProfilePassRecord
+{
+    const char*                 annotation;         /* = "" */
+    uint64_t                    elapsedTime;        /* = 0 */
+    LLGLQueryPipelineStatistics pipelineStatistics;
+    uint32_t                    depth;              /* = 0 */
+    uint32_t                    commandBuffer;      /* = 0 */
+    uint32_t                    frameLatency;       /* = 0 */
+}
+LLGLProfilePassRecord;
+
 typedef struct LLGLProfileCommandQueueRecord
 {
     uint32_t bufferWrites;             /* = 0 */
@@ -1097,9 +1228,23 @@ typedef struct LLGLProfileCommandBufferRecord
     uint32_t renderConditionSections;  /* = 0 */
     uint32_t drawCommands;             /* = 0 */
     uint32_t dispatchCommands;         /* = 0 */
+    uint32_t stateChanges;             /* = 0 */
+    uint32_t redundantStateChanges;    /* = 0 */
 }
 LLGLProfileCommandBufferRecord;
 
+typedef struct LLGLProfileMemoryRecord
+{
+    uint64_t uploadedBytes;      /* = 0 */
+    uint64_t readbackBytes;      /* = 0 */
+    uint64_t stagingMemoryUsage; /* = 0 */
+    uint64_t deviceMemoryUsage;  /* = 0 */
+    uint64_t hostMemoryUsage;    /* = 0 */
+    uint64_t heapAllocations;    /* = 0 */
+    uint64_t heapAllocatedBytes; /* = 0 */
+}
+LLGLProfileMemoryRecord;
+
 typedef struct LLGLRendererInfo
 {
     const char*        rendererName;
@@ -1113,6 +1258,16 @@ typedef struct LLGLRendererInfo
 }
 LLGLRendererInfo;
 
+typedef struct LLGLMemoryHeapInfo
+{
+    uint64_t size;         /* = 0 */
+    uint64_t budget;       /* = 0 */
+    uint64_t usage;        /* = 0 */
+    uint64_t stagingUsage; /* = 0 */
+    bool     deviceLocal;  /* = false */
+}
+LLGLMemoryHeapInfo;
+
 typedef struct LLGLRenderingFeatures
 {
     bool hasRenderTargets;             /* = false */
@@ -1134,9 +1289,12 @@ typedef struct LLGLRenderingFeatures
     bool hasTessellationShaders;       /* = false */
     bool hasTessellatorStage;          /* = false */
     bool hasComputeShaders;            /* = false */
+    bool hasMeshShaders;               /* = false */
+    bool hasRayTracing;                /* = false */
     bool hasInstancing;                /* = false */
     bool hasOffsetInstancing;          /* = false */
     bool hasIndirectDrawing;           /* = false */
+    bool hasIndirectDrawCount;         /* = false */
     bool hasViewportArrays;            /* = false */
     bool hasConservativeRasterization; /* = false */
     bool hasStreamOutputs;             /* = false */
@@ -1144,6 +1302,13 @@ typedef struct LLGLRenderingFeatures
     bool hasPipelineCaching;           /* = false */
     bool hasPipelineStatistics;        /* = false */
     bool hasRenderCondition;           /* = false */
+    bool hasBufferRenderCondition;     /* = false */
+    bool hasBindlessDescriptors;       /* = false */
+    bool hasSparseTextures;            /* = false */
+    bool hasVariableRateShading;       /* = false */
+    bool hasExtendedDynamicState;      /* = false */
+    bool hasTimestampCalibration;      /* = false */
+    bool hasSubpasses;                 /* = false */
 }
 LLGLRenderingFeatures;
 
@@ -1258,6 +1423,16 @@ typedef struct LLGLAttachmentClear
 }
 LLGLAttachmentClear;
 
+typedef struct LLGLResourceBarrierDescriptor
+{
+    LLGLResource resource;  /* = LLGL_NULL_OBJECT */
+    long         srcUsage;  /* = 0 */
+    long         dstUsage;  /* = 0 */
+    long         srcStages; /* = LLGLStageAllStages */
+    long         dstStages; /* = LLGLStageAllStages */
+}
+LLGLResourceBarrierDescriptor;
+
 typedef struct LLGLDisplayMode
 {
     LLGLExtent2D resolution;
@@ -1265,6 +1440,14 @@ typedef struct LLGLDisplayMode
 }
 LLGLDisplayMode;
 
+typedef struct LLGLDisplayVBlankTiming
+{
+    uint64_t lastVBlank;    /* = 0 */
+    uint64_t nextVBlank;    /* = 0 */
+    uint64_t refreshPeriod; /* = 0 */
+}
+LLGLDisplayVBlankTiming;
+
 typedef struct LLGLFormatAttributes
 {
     uint16_t        bitSize;
@@ -1393,8 +1576,11 @@ typedef struct LLGLFrameProfile
 {
     LLGLProfileCommandQueueRecord  commandQueueRecord;
     LLGLProfileCommandBufferRecord commandBufferRecord;
+    LLGLProfileMemoryRecord        memoryRecord;
     size_t                         numTimeRecords;      /* = 0 */
     const LLGLProfileTimeRecord*   timeRecords;         /* = NULL */
+    size_t                         numPassRecords;      /* = 0 */
+    const LLGLProfilePassRecord*   passRecords;         /* = NULL */
 }
 LLGLFrameProfile;
 
@@ -1406,6 +1592,14 @@ typedef struct LLGLAttachmentFormatDescriptor
 }
 LLGLAttachmentFormatDescriptor;
 
+typedef struct LLGLSubpassDescriptor
+{
+    uint32_t colorAttachmentMask;    /* = ~0u */
+    uint32_t inputAttachmentMask;    /* = 0 */
+    bool     depthStencilAttachment; /* = true */
+}
+LLGLSubpassDescriptor;
+
 typedef struct LLGLRenderSystemDescriptor
 {
     const char*           moduleName;
@@ -1472,14 +1666,17 @@ LLGLComputeShaderAttributes;
 
 typedef struct LLGLSwapChainDescriptor
 {
-    const char*  debugName;   /* = NULL */
-    LLGLExtent2D resolution;
-    int          colorBits;   /* = 32 */
-    int          depthBits;   /* = 24 */
-    int          stencilBits; /* = 8 */
-    uint32_t     samples;     /* = 1 */
-    uint32_t     swapBuffers; /* = 2 */
-    bool         fullscreen;  /* = false */
+    const char*     debugName;         /* = NULL */
+    LLGLExtent2D    resolution;
+    int             colorBits;         /* = 32 */
+    int             depthBits;         /* = 24 */
+    int             stencilBits;       /* = 8 */
+    uint32_t        samples;           /* = 1 */
+    uint32_t        swapBuffers;       /* = 2 */
+    uint32_t        maxFramesInFlight; /* = 0 */
+    LLGLPresentMode presentMode;       /* = LLGLPresentModeDefault */
+    LLGLColorSpace  colorSpace;        /* = LLGLColorSpaceSRGB */
+    bool            fullscreen;        /* = false */
 }
 LLGLSwapChainDescriptor;
 
@@ -1508,6 +1705,14 @@ typedef struct LLGLTextureRegion
 }
 LLGLTextureRegion;
 
+typedef struct LLGLSparseTextureProperties
+{
+    LLGLExtent3D tileExtent;
+    uint32_t     tileSize;     /* = 0 */
+    uint32_t     firstMipTail; /* = 0 */
+}
+LLGLSparseTextureProperties;
+
 typedef struct LLGLTextureDescriptor
 {
     const char*     debugName;      /* = NULL */
@@ -1520,6 +1725,7 @@ typedef struct LLGLTextureDescriptor
     uint32_t        arrayLayers;    /* = 1 */
     uint32_t        mipLevels;      /* = 0 */
     uint32_t        samples;        /* = 1 */
+    uint32_t        transientSlot;  /* = 0 */
     LLGLClearValue  clearValue;
 }
 LLGLTextureDescriptor;
@@ -1549,6 +1755,17 @@ typedef struct LLGLWindowDescriptor
 }
 LLGLWindowDescriptor;
 
+typedef struct LLGLWindowEvent
+{
+    LLGLWindowEventType type;        /* = LLGLWindowEventTypeQuit */
+    LLGLKey             keyCode;     /* = LLGLKeyAny */
+    wchar_t             chr;         /* = L'\0' */
+    int                 wheelMotion; /* = 0 */
+    LLGLOffset2D        offset;
+    LLGLExtent2D        size;
+}
+LLGLWindowEvent;
+
 typedef struct LLGLBufferDescriptor
 {
     const char*                debugName;        /* = NULL */
@@ -1600,6 +1817,8 @@ typedef struct LLGLRenderPassDescriptor
     LLGLAttachmentFormatDescriptor depthAttachment;
     LLGLAttachmentFormatDescriptor stencilAttachment;
     uint32_t                       samples;             /* = 1 */
+    size_t                         numSubpasses;        /* = 0 */
+    const LLGLSubpassDescriptor*   subpasses;           /* = NULL */
 }
 LLGLRenderPassDescriptor;
 
@@ -1664,25 +1883,33 @@ LLGLPipelineLayoutDescriptor;
 
 typedef struct LLGLGraphicsPipelineDescriptor
 {
-    const char*                debugName;            /* = NULL */
-    LLGLPipelineLayout         pipelineLayout;       /* = LLGL_NULL_OBJECT */
-    LLGLRenderPass             renderPass;           /* = LLGL_NULL_OBJECT */
-    LLGLShader                 vertexShader;         /* = LLGL_NULL_OBJECT */
-    LLGLShader                 tessControlShader;    /* = LLGL_NULL_OBJECT */
-    LLGLShader                 tessEvaluationShader; /* = LLGL_NULL_OBJECT */
-    LLGLShader                 geometryShader;       /* = LLGL_NULL_OBJECT */
-    LLGLShader                 fragmentShader;       /* = LLGL_NULL_OBJECT */
-    LLGLFormat                 indexFormat;          /* = LLGLFormatUndefined */
-    LLGLPrimitiveTopology      primitiveTopology;    /* = LLGLPrimitiveTopologyTriangleList */
-    size_t                     numViewports;         /* = 0 */
-    const LLGLViewport*        viewports;            /* = NULL */
-    size_t                     numScissors;          /* = 0 */
-    const LLGLScissor*         scissors;             /* = NULL */
-    LLGLDepthDescriptor        depth;
-    LLGLStencilDescriptor      stencil;
-    LLGLRasterizerDescriptor   rasterizer;
-    LLGLBlendDescriptor        blend;
-    LLGLTessellationDescriptor tessellation;
+    const char*                       debugName;                  /* = NULL */
+    LLGLPipelineLayout                pipelineLayout;             /* = LLGL_NULL_OBJECT */
+    LLGLRenderPass                    renderPass;                 /* = LLGL_NULL_OBJECT */
+    uint32_t                          subpass;                    /* = 0 */
+    LLGLShader                        vertexShader;               /* = LLGL_NULL_OBJECT */
+    LLGLShader                        tessControlShader;          /* = LLGL_NULL_OBJECT */
+    LLGLShader                        tessEvaluationShader;       /* = LLGL_NULL_OBJECT */
+    LLGLShader                        geometryShader;             /* = LLGL_NULL_OBJECT */
+    LLGLShader                        fragmentShader;             /* = LLGL_NULL_OBJECT */
+    LLGLShader                        taskShader;                 /* = LLGL_NULL_OBJECT */
+    LLGLShader                        meshShader;                 /* = LLGL_NULL_OBJECT */
+    LLGLFormat                        indexFormat;                /* = LLGLFormatUndefined */
+    LLGLPrimitiveTopology             primitiveTopology;          /* = LLGLPrimitiveTopologyTriangleList */
+    size_t                            numViewports;               /* = 0 */
+    const LLGLViewport*               viewports;                  /* = NULL */
+    size_t                            numScissors;                /* = 0 */
+    const LLGLScissor*                scissors;                   /* = NULL */
+    LLGLDepthDescriptor               depth;
+    LLGLStencilDescriptor             stencil;
+    LLGLRasterizerDescriptor          rasterizer;
+    LLGLBlendDescriptor               blend;
+    LLGLTessellationDescriptor        tessellation;
+    long                              dynamicStates;              /* = 0 */
+    size_t                            numSpecializationConstants; /* = 0 */
+    const LLGLSpecializationConstant* specializationConstants;    /* = NULL */
+    bool                              asyncCompilation;           /* = false */
+    LLGLPipelineState                 placeholder;                /* = LLGL_NULL_OBJECT */
 }
 LLGLGraphicsPipelineDescriptor;
 
@@ -62,6 +62,7 @@ LLGL_C_EXPORT LLGLRenderTarget llglCreateRenderTarget(const LLGLRenderTargetDesc
 LLGL_C_EXPORT void llglReleaseRenderTarget(LLGLRenderTarget renderTarget);
 
 LLGL_C_EXPORT LLGLShader llglCreateShader(const LLGLShaderDescriptor* shaderDesc);
+LLGL_C_EXPORT uint32_t llglCreateShaders(size_t numShaderDescs, const LLGLShaderDescriptor* shaderDescs LLGL_ANNOTATE([numShaderDescs]), LLGLShader* outShaders LLGL_ANNOTATE([numShaderDescs]));
 LLGL_C_EXPORT void llglReleaseShader(LLGLShader shader);
 
 LLGL_C_EXPORT LLGLPipelineLayout llglCreatePipelineLayout(const LLGLPipelineLayoutDescriptor* pipelineLayoutDesc);
@@ -83,6 +84,10 @@ LLGL_C_EXPORT LLGLFence llglCreateFence();
 LLGL_C_EXPORT void llglReleaseFence(LLGLFence fence);
 
 LLGL_C_EXPORT bool llglGetRenderSystemNativeHandle(void* nativeHandle, size_t nativeHandleSize);
+LLGL_C_EXPORT bool llglGetSparseTextureProperties(LLGLTexture texture, LLGLSparseTextureProperties* outProperties);
+LLGL_C_EXPORT bool llglCommitTextureTiles(LLGLTexture texture, const LLGLTextureRegion* textureRegion, bool commit);
+LLGL_C_EXPORT bool llglMakeResident(size_t numResources, const LLGLResource* resources LLGL_ANNOTATE([numResources]));
+LLGL_C_EXPORT void llglEvict(size_t numResources, const LLGLResource* resources LLGL_ANNOTATE([numResources]));
 
 
 #endif
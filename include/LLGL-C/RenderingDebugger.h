@@ -19,6 +19,13 @@ LLGL_C_EXPORT LLGLRenderingDebugger llglAllocRenderingDebugger();
 LLGL_C_EXPORT void llglFreeRenderingDebugger(LLGLRenderingDebugger debugger);
 LLGL_C_EXPORT void llglSetDebuggerTimeRecording(LLGLRenderingDebugger debugger, bool enabled);
 LLGL_C_EXPORT bool llglGetDebuggerTimeRecording(LLGLRenderingDebugger debugger);
+LLGL_C_EXPORT void llglSetDebuggerPassRecording(LLGLRenderingDebugger debugger, bool enabled);
+LLGL_C_EXPORT bool llglGetDebuggerPassRecording(LLGLRenderingDebugger debugger);
+LLGL_C_EXPORT void llglSetDebuggerValidationSampling(LLGLRenderingDebugger debugger, uint32_t interval, bool perCommandBuffer);
+LLGL_C_EXPORT uint32_t llglGetDebuggerValidationSamplingInterval(LLGLRenderingDebugger debugger);
+LLGL_C_EXPORT bool llglIsDebuggerValidationSampledPerCommandBuffer(LLGLRenderingDebugger debugger);
+LLGL_C_EXPORT void llglCaptureDebuggerFrame(LLGLRenderingDebugger debugger, const char* filename);
+LLGL_C_EXPORT void llglSaveDebuggerPipelineManifest(LLGLRenderingDebugger debugger, const char* filename);
 LLGL_C_EXPORT void llglFlushDebuggerProfile(LLGLRenderingDebugger debugger, LLGLFrameProfile* outFrameProfile);
 
 
@@ -14,6 +14,7 @@
 
 
 LLGL_C_EXPORT LLGLResourceType llglGetResourceType(LLGLResource resource);
+LLGL_C_EXPORT void llglSetResidencyPriority(LLGLResource resource, LLGLResidencyPriority priority);
 
 
 #endif
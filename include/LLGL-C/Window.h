@@ -62,6 +62,9 @@ LLGL_C_EXPORT void llglSetWindowUserData(LLGLWindow window, void* userData);
 LLGL_C_EXPORT void* llglGetWindowUserData(LLGLWindow window);
 LLGL_C_EXPORT int llglAddWindowEventListener(LLGLWindow window, const LLGLWindowEventListener* eventListener);
 LLGL_C_EXPORT void llglRemoveWindowEventListener(LLGLWindow window, int eventListenerID);
+LLGL_C_EXPORT void llglSetWindowEventQueueEnabled(LLGLWindow window, bool enable);
+LLGL_C_EXPORT size_t llglGetWindowEventQueue(LLGLWindow window, size_t maxEvents, LLGLWindowEvent* outEvents LLGL_ANNOTATE(NULL));
+LLGL_C_EXPORT void llglClearWindowEventQueue(LLGLWindow window);
 LLGL_C_EXPORT void llglPostWindowQuit(LLGLWindow window);
 LLGL_C_EXPORT void llglPostWindowKeyDown(LLGLWindow window, LLGLKey keyCode);
 LLGL_C_EXPORT void llglPostWindowKeyUp(LLGLWindow window, LLGLKey keyCode);
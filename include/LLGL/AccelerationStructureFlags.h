@@ -0,0 +1,248 @@
+/*
+ * AccelerationStructureFlags.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_ACCELERATION_STRUCTURE_FLAGS_H
+#define LLGL_ACCELERATION_STRUCTURE_FLAGS_H
+
+
+#include <LLGL/Format.h>
+#include <LLGL/Container/ArrayView.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class Buffer;
+
+
+/* ----- Enumerations ----- */
+
+/**
+\brief Ray tracing acceleration structure type enumeration.
+\see AccelerationStructureBuildDescriptor::type
+*/
+enum class AccelerationStructureType
+{
+    //! Bottom-level acceleration structure (BLAS) that holds triangle geometry.
+    BottomLevel,
+
+    //! Top-level acceleration structure (TLAS) that holds instances of bottom-level acceleration structures.
+    TopLevel,
+};
+
+/**
+\brief Acceleration structure copy mode enumeration.
+\see CommandBuffer::CopyAccelerationStructure
+*/
+enum class AccelerationStructureCopyMode
+{
+    //! Copies the acceleration structure as is. The destination buffer must be at least as large as the source buffer.
+    Clone,
+
+    /**
+    \brief Copies the acceleration structure into its compacted form.
+    \remarks The source must have been built with AccelerationStructureFlags::AllowCompaction
+    and the destination buffer must be at least as large as the size written by CommandBuffer::WriteAccelerationStructureCompactedSize.
+    */
+    Compact,
+};
+
+
+/* ----- Flags ----- */
+
+/**
+\brief Acceleration structure build flags.
+\see AccelerationStructureBuildDescriptor::flags
+*/
+struct AccelerationStructureFlags
+{
+    enum
+    {
+        //! Acceleration structure can be updated after it has been built, e.g. to refit animated geometry.
+        AllowUpdate     = (1 << 0),
+
+        //! Acceleration structure can be compacted with CommandBuffer::CopyAccelerationStructure.
+        AllowCompaction = (1 << 1),
+
+        //! Prioritizes trace performance over build time. This must not be combined with PreferFastBuild.
+        PreferFastTrace = (1 << 2),
+
+        //! Prioritizes build time over trace performance. This must not be combined with PreferFastTrace.
+        PreferFastBuild = (1 << 3),
+    };
+};
+
+/**
+\brief Acceleration structure instance flags.
+\remarks These values are identical to \c D3D12_RAYTRACING_INSTANCE_FLAGS and \c VkGeometryInstanceFlagBitsKHR.
+\see AccelerationStructureInstance::flags
+*/
+struct AccelerationStructureInstanceFlags
+{
+    enum
+    {
+        //! Disables face culling for the triangles of this instance.
+        TriangleCullDisable             = (1 << 0),
+
+        //! Triangles with counter-clockwise winding are front facing.
+        TriangleFrontCounterClockwise   = (1 << 1),
+
+        //! All geometry of this instance is treated as opaque.
+        ForceOpaque                     = (1 << 2),
+
+        //! All geometry of this instance is treated as non-opaque.
+        ForceNonOpaque                  = (1 << 3),
+    };
+};
+
+
+/* ----- Structures ----- */
+
+/**
+\brief Triangle geometry for bottom-level acceleration structures.
+\see AccelerationStructureBuildDescriptor::triangles
+*/
+struct AccelerationStructureTriangles
+{
+    //! Buffer with the vertex positions. This buffer must have been created with the BindFlags::VertexBuffer or BindFlags::Storage flag.
+    Buffer*         vertexBuffer    = nullptr;
+
+    //! Offset (in bytes) of the first vertex position within the vertex buffer. By default 0.
+    std::uint64_t   vertexOffset    = 0;
+
+    //! Stride (in bytes) between two consecutive vertex positions. By default 12.
+    std::uint32_t   vertexStride    = 12;
+
+    //! Number of vertices. By default 0.
+    std::uint32_t   numVertices     = 0;
+
+    //! Format of the vertex positions. This must be Format::RGB32Float, Format::RG32Float, Format::RGBA16Float, or Format::RG16Float. By default Format::RGB32Float.
+    Format          vertexFormat    = Format::RGB32Float;
+
+    //! Optional buffer with the triangle indices. If this is null, the vertices are not indexed. By default null.
+    Buffer*         indexBuffer     = nullptr;
+
+    //! Offset (in bytes) of the first index within the index buffer. By default 0.
+    std::uint64_t   indexOffset     = 0;
+
+    //! Format of the indices. This must be Format::R16UInt or Format::R32UInt. By default Format::R32UInt.
+    Format          indexFormat     = Format::R32UInt;
+
+    //! Number of indices. This is ignored if \c indexBuffer is null. By default 0.
+    std::uint32_t   numIndices      = 0;
+
+    //! Specifies whether the geometry is opaque, i.e. no any-hit processing is required. By default true.
+    bool            opaque          = true;
+};
+
+/**
+\brief Instance of a bottom-level acceleration structure within a top-level acceleration structure.
+\remarks This structure has the same memory layout as \c D3D12_RAYTRACING_INSTANCE_DESC and \c VkAccelerationStructureInstanceKHR,
+so an array of instances can be written into the instance buffer directly, e.g. with RenderSystem::WriteBuffer.
+\see AccelerationStructureBuildDescriptor::instanceBuffer
+*/
+struct AccelerationStructureInstance
+{
+    //! Row-major 3x4 affine transformation matrix of this instance.
+    float           transform[3][4];
+
+    //! Custom 24-bit instance ID, i.e. \c CommittedInstanceID() in HLSL and \c rayQueryGetIntersectionInstanceCustomIndexEXT in GLSL.
+    std::uint32_t   instanceID      : 24;
+
+    //! 8-bit visibility mask that is AND-combined with the ray mask.
+    std::uint32_t   mask            : 8;
+
+    //! 24-bit offset into the hit group table. This is reserved for ray tracing pipelines and should be 0.
+    std::uint32_t   hitGroupOffset  : 24;
+
+    //! 8-bit bitwise OR combination of AccelerationStructureInstanceFlags entries.
+    std::uint32_t   flags           : 8;
+
+    //! Address of the bottom-level acceleration structure. This must be obtained by RenderSystem::GetAccelerationStructureAddress.
+    std::uint64_t   blasAddress;
+};
+
+/**
+\brief Descriptor structure to build or update a ray tracing acceleration structure.
+\see CommandBuffer::BuildAccelerationStructure
+\see RenderSystem::GetAccelerationStructureSizes
+*/
+struct AccelerationStructureBuildDescriptor
+{
+    //! Specifies the type of acceleration structure. By default AccelerationStructureType::BottomLevel.
+    AccelerationStructureType                   type            = AccelerationStructureType::BottomLevel;
+
+    /**
+    \brief Specifies the build flags. This can be a bitwise OR combination of AccelerationStructureFlags entries. By default 0.
+    \remarks The flags must be the same for the initial build and all subsequent updates.
+    */
+    long                                        flags           = 0;
+
+    /**
+    \brief Destination buffer for the acceleration structure. This must have been created with the BindFlags::AccelerationStructure flag.
+    \remarks This is ignored by RenderSystem::GetAccelerationStructureSizes.
+    */
+    Buffer*                                     dst             = nullptr;
+
+    /**
+    \brief Optional source acceleration structure to update. If this is non-null, \c dst is updated from \c src instead of being built from scratch. By default null.
+    \remarks The source must have been built with AccelerationStructureFlags::AllowUpdate and with the same number of primitives and instances. It may be the same as \c dst.
+    */
+    Buffer*                                     src             = nullptr;
+
+    /**
+    \brief Scratch buffer for the build. This must have been created with the BindFlags::Storage flag.
+    \remarks Its size must be at least AccelerationStructureSizes::buildScratchSize or AccelerationStructureSizes::updateScratchSize respectively.
+    */
+    Buffer*                                     scratchBuffer   = nullptr;
+
+    //! Offset (in bytes) into the scratch buffer. This must be a multiple of 256. By default 0.
+    std::uint64_t                               scratchOffset   = 0;
+
+    //! Triangle geometry for bottom-level acceleration structures. This is ignored for top-level acceleration structures.
+    ArrayView<AccelerationStructureTriangles>   triangles;
+
+    /**
+    \brief Buffer of AccelerationStructureInstance entries for top-level acceleration structures. This is ignored for bottom-level acceleration structures.
+    \remarks This buffer must have been created with the BindFlags::Storage flag.
+    */
+    Buffer*                                     instanceBuffer  = nullptr;
+
+    //! Offset (in bytes) of the first instance within the instance buffer. This must be a multiple of 16. By default 0.
+    std::uint64_t                               instanceOffset  = 0;
+
+    //! Number of instances for top-level acceleration structures. By default 0.
+    std::uint32_t                               numInstances    = 0;
+};
+
+/**
+\brief Memory requirements to build an acceleration structure.
+\see RenderSystem::GetAccelerationStructureSizes
+*/
+struct AccelerationStructureSizes
+{
+    //! Minimal size (in bytes) of the buffer that holds the acceleration structure.
+    std::uint64_t accelerationStructureSize = 0;
+
+    //! Minimal size (in bytes) of the scratch buffer to build the acceleration structure.
+    std::uint64_t buildScratchSize          = 0;
+
+    //! Minimal size (in bytes) of the scratch buffer to update the acceleration structure.
+    std::uint64_t updateScratchSize         = 0;
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -11,7 +11,7 @@ virtual void UpdateBuffer(
     LLGL::Buffer&                   dstBuffer,
     std::uint64_t                   dstOffset,
     const void*                     data,
-    std::uint16_t                   dataSize
+    std::uint64_t                   dataSize
 ) override final;
 
 virtual void CopyBuffer(
@@ -22,6 +22,12 @@ virtual void CopyBuffer(
     std::uint64_t                   size
 ) override final;
 
+virtual void CopyBuffer(
+    LLGL::Buffer&                                           dstBuffer,
+    LLGL::Buffer&                                           srcBuffer,
+    const LLGL::ArrayView<LLGL::BufferCopyRegion>&          regions
+) override final;
+
 virtual void CopyBufferFromTexture(
     LLGL::Buffer&                   dstBuffer,
     std::uint64_t                   dstOffset,
@@ -46,6 +52,12 @@ virtual void CopyTexture(
     const LLGL::Extent3D&           extent
 ) override final;
 
+virtual void CopyTexture(
+    LLGL::Texture&                                          dstTexture,
+    LLGL::Texture&                                          srcTexture,
+    const LLGL::ArrayView<LLGL::TextureCopyRegion>&         regions
+) override final;
+
 virtual void CopyTextureFromBuffer(
     LLGL::Texture&                  dstTexture,
     const LLGL::TextureRegion&      dstRegion,
@@ -55,12 +67,26 @@ virtual void CopyTextureFromBuffer(
     std::uint32_t                   layerStride = 0
 ) override final;
 
+virtual void CopyTextureFromBuffer(
+    LLGL::Texture&                                          dstTexture,
+    LLGL::Buffer&                                           srcBuffer,
+    const LLGL::ArrayView<LLGL::BufferTextureCopyRegion>&   regions
+) override final;
+
 virtual void CopyTextureFromFramebuffer(
     LLGL::Texture&                  dstTexture,
     const LLGL::TextureRegion&      dstRegion,
     const LLGL::Offset2D&           srcOffset
 ) override final;
 
+virtual void BlitTexture(
+    LLGL::Texture&                  dstTexture,
+    const LLGL::TextureRegion&      dstRegion,
+    LLGL::Texture&                  srcTexture,
+    const LLGL::TextureRegion&      srcRegion,
+    const LLGL::SamplerFilter       filter      = LLGL::SamplerFilter::Linear
+) override final;
+
 virtual void GenerateMips(
     LLGL::Texture&                  texture
 ) override final;
@@ -69,6 +69,15 @@ virtual void DrawIndirect(
     std::uint32_t   stride
 ) override final;
 
+virtual void DrawIndirect(
+    LLGL::Buffer&   buffer,
+    std::uint64_t   offset,
+    LLGL::Buffer&   countBuffer,
+    std::uint64_t   countBufferOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride
+) override final;
+
 virtual void DrawIndexedIndirect(
     LLGL::Buffer&   buffer,
     std::uint64_t   offset
@@ -81,6 +90,32 @@ virtual void DrawIndexedIndirect(
     std::uint32_t   stride
 ) override final;
 
+virtual void DrawIndexedIndirect(
+    LLGL::Buffer&   buffer,
+    std::uint64_t   offset,
+    LLGL::Buffer&   countBuffer,
+    std::uint64_t   countBufferOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride
+) override final;
+
+virtual void DrawStreamOutput(
+    void
+) override final;
+
+virtual void DrawMesh(
+    std::uint32_t   numWorkGroupsX,
+    std::uint32_t   numWorkGroupsY,
+    std::uint32_t   numWorkGroupsZ
+) override final;
+
+virtual void DrawMeshIndirect(
+    LLGL::Buffer&   buffer,
+    std::uint64_t   offset,
+    std::uint32_t   numCommands,
+    std::uint32_t   stride
+) override final;
+
 
 
 // ================================================================================
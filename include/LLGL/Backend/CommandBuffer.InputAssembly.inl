@@ -8,13 +8,21 @@
 /* ----- Input Assembly ------ */
 
 virtual void SetVertexBuffer(
-    LLGL::Buffer&       buffer
+    LLGL::Buffer&       buffer,
+    std::uint64_t       offset = 0
 ) override final;
 
 virtual void SetVertexBufferArray(
     LLGL::BufferArray&  bufferArray
 ) override final;
 
+virtual void SetVertexBuffers(
+    std::uint32_t               firstSlot,
+    std::uint32_t               numBuffers,
+    LLGL::Buffer* const *       buffers,
+    const std::uint64_t*        offsets     = nullptr
+) override final;
+
 virtual void SetIndexBuffer(
     LLGL::Buffer&       buffer
 ) override final;
@@ -20,6 +20,26 @@ virtual void SetStencilReference(
     const LLGL::StencilFace stencilFace = LLGL::StencilFace::FrontAndBack
 ) override final;
 
+virtual void SetShadingRate(
+    const LLGL::ShadingRate rate
+) override final;
+
+virtual void SetCullMode(
+    const LLGL::CullMode cullMode
+) override final;
+
+virtual void SetDepthState(
+    const LLGL::DepthDescriptor& depthDesc
+) override final;
+
+virtual void SetStencilState(
+    const LLGL::StencilDescriptor& stencilDesc
+) override final;
+
+virtual void SetPrimitiveTopology(
+    const LLGL::PrimitiveTopology topology
+) override final;
+
 virtual void SetUniforms(
     std::uint32_t           first,
     const void*             data,
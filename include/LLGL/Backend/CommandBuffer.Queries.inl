@@ -23,10 +23,24 @@ virtual void BeginRenderCondition(
     const LLGL::RenderConditionMode mode
 ) override final;
 
+virtual void BeginRenderCondition(
+    LLGL::Buffer&                   buffer,
+    std::uint64_t                   offset,
+    const LLGL::RenderConditionMode mode
+) override final;
+
 virtual void EndRenderCondition(
     void
 ) override final;
 
+virtual void ResolveQueries(
+    LLGL::QueryHeap&                queryHeap,
+    std::uint32_t                   firstQuery,
+    std::uint32_t                   numQueries,
+    LLGL::Buffer&                   dstBuffer,
+    std::uint64_t                   dstOffset
+) override final;
+
 
 
 // ================================================================================
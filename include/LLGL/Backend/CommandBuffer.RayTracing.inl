@@ -0,0 +1,28 @@
+/*
+ * CommandBuffer.RayTracing.inl
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+/* ----- Ray Tracing ----- */
+
+virtual void BuildAccelerationStructure(
+    const LLGL::AccelerationStructureBuildDescriptor&   buildDesc
+) override final;
+
+virtual void CopyAccelerationStructure(
+    LLGL::Buffer&                                       dst,
+    LLGL::Buffer&                                       src,
+    const LLGL::AccelerationStructureCopyMode           mode        = LLGL::AccelerationStructureCopyMode::Clone
+) override final;
+
+virtual void WriteAccelerationStructureCompactedSize(
+    LLGL::Buffer&                                       src,
+    LLGL::Buffer&                                       dstBuffer,
+    std::uint64_t                                       dstOffset
+) override final;
+
+
+
+// ================================================================================
@@ -19,6 +19,10 @@ virtual void EndRenderPass(
     void
 ) override final;
 
+virtual void NextSubpass(
+    void
+) override final;
+
 virtual void Clear(
     long                            flags,
     const LLGL::ClearValue&         clearValue      = {}
@@ -17,6 +17,11 @@ virtual void SetResource(
     LLGL::Resource&             resource
 ) override final;
 
+virtual void SetResources(
+    std::uint32_t                               firstDescriptor,
+    const LLGL::ArrayView<LLGL::Resource*>&     resources
+) override final;
+
 virtual void ResetResourceSlots(
     const LLGL::ResourceType    resourceType,
     std::uint32_t               firstSlot,
@@ -25,6 +30,11 @@ virtual void ResetResourceSlots(
     long                        stageFlags      = LLGL::StageFlags::AllStages
 ) override final;
 
+virtual void ResourceBarrier(
+    std::uint32_t                           numBarriers,
+    const LLGL::ResourceBarrierDescriptor*  barriers
+) override final;
+
 
 
 // ================================================================================
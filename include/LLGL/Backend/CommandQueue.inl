@@ -21,14 +21,38 @@ virtual bool QueryResult(
     std::size_t             dataSize
 ) override final;
 
+virtual bool QueryTimestampCalibration(
+    LLGL::TimestampCalibration& outCalibration
+) override final;
+
 /* ----- Fences ----- */
 
 virtual void Submit(
     LLGL::Fence&            fence
 ) override final;
 
+virtual void SubmitWait(
+    LLGL::Fence&            fence
+) override final;
+
+virtual bool WaitFence(
+    LLGL::Fence&            fence,
+    std::uint64_t           timeout
+) override final;
+
+virtual void Submit(
+    LLGL::Fence&            fence,
+    std::uint64_t           value
+) override final;
+
+virtual void SubmitWait(
+    LLGL::Fence&            fence,
+    std::uint64_t           value
+) override final;
+
 virtual bool WaitFence(
     LLGL::Fence&            fence,
+    std::uint64_t           value,
     std::uint64_t           timeout
 ) override final;
 
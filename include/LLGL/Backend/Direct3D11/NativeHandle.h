@@ -43,6 +43,19 @@ struct CommandBufferNativeHandle
     ID3D11DeviceContext* deviceContext;
 };
 
+/**
+\brief Native handle structure for a Direct3D 11 buffer or texture.
+\see Resource::GetNativeHandle
+*/
+struct ResourceNativeHandle
+{
+    /**
+    \brief COM pointer to the native Direct3D resource, i.e. \c ID3D11Buffer, \c ID3D11Texture1D, \c ID3D11Texture2D, or \c ID3D11Texture3D.
+    \remarks Use \c IDXGIResource1::CreateSharedHandle to share this resource with another device if it was created with a shared misc flag.
+    */
+    ID3D11Resource* resource;
+};
+
 
 } // /namespace Direct3D11
 
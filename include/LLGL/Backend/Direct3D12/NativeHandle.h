@@ -45,6 +45,19 @@ struct CommandBufferNativeHandle
     ID3D12GraphicsCommandList* commandList;
 };
 
+/**
+\brief Native handle structure for a Direct3D 12 buffer or texture.
+\see Resource::GetNativeHandle
+*/
+struct ResourceNativeHandle
+{
+    /**
+    \brief COM pointer to the native Direct3D resource.
+    \remarks Use \c ID3D12Device::CreateSharedHandle to share this resource with another device or API, e.g. with \c cudaImportExternalMemory.
+    */
+    ID3D12Resource* resource;
+};
+
 
 } // /namespace Direct3D12
 
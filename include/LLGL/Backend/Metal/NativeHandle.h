@@ -29,6 +29,16 @@ struct CommandBufferNativeHandle
     id<MTLCommandBuffer> commandBuffer;
 };
 
+/**
+\brief Native handle structure for a Metal buffer or texture.
+\remarks The resource is either an \c id<MTLBuffer> or \c id<MTLTexture>. For textures that are backed by an \c IOSurface, it can be shared via <code>[MTLTexture iosurface]</code>.
+\see Resource::GetNativeHandle
+*/
+struct ResourceNativeHandle
+{
+    id<MTLResource> resource;
+};
+
 
 } // /namespace Metal
 
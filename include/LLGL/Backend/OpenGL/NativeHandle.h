@@ -23,6 +23,35 @@
 #   include <LLGL/Backend/OpenGL/Android/AndroidNativeHandle.h>
 #endif
 
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+namespace OpenGL
+{
+
+
+/**
+\brief Native handle structure for an OpenGL buffer or texture.
+\remarks The object name can be shared with other APIs that interoperate with GL, e.g. with \c cudaGraphicsGLRegisterBuffer or \c cudaGraphicsGLRegisterImage.
+\see Resource::GetNativeHandle
+*/
+struct ResourceNativeHandle
+{
+    //! GL object name (of type \c GLuint) of the buffer, texture, or renderbuffer.
+    std::uint32_t id;
+
+    //! GL target (of type \c GLenum) the object is bound to, e.g. \c GL_ARRAY_BUFFER, \c GL_TEXTURE_2D, or \c GL_RENDERBUFFER.
+    std::uint32_t target;
+};
+
+
+} // /namespace OpenGL
+
+} // /namespace LLGL
+
 
 #endif
 
@@ -11,6 +11,10 @@ virtual LLGL::CommandQueue* GetCommandQueue(
     void
 ) override final;
 
+virtual LLGL::CommandQueue* GetCommandQueue(
+    long                    queueFlags
+) override final;
+
 
 
 // ================================================================================
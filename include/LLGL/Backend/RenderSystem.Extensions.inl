@@ -12,6 +12,44 @@ virtual bool GetNativeHandle(
     std::size_t nativeHandleSize
 ) override final;
 
+virtual std::uint32_t QueryMemoryHeaps(
+    LLGL::MemoryHeapInfo*   outHeapInfos,
+    std::uint32_t           maxNumHeaps
+) override final;
+
+virtual std::uint32_t GetBindlessDescriptorIndex(
+    const LLGL::Resource&   resource,
+    long                    bindFlags
+) override final;
+
+virtual bool GetSparseTextureProperties(
+    const LLGL::Texture&            texture,
+    LLGL::SparseTextureProperties&  outProperties
+) override final;
+
+virtual bool CommitTextureTiles(
+    LLGL::Texture&              texture,
+    const LLGL::TextureRegion&  textureRegion,
+    bool                        commit
+) override final;
+
+virtual bool MakeResident(
+    const LLGL::ArrayView<LLGL::Resource*>& resources
+) override final;
+
+virtual void Evict(
+    const LLGL::ArrayView<LLGL::Resource*>& resources
+) override final;
+
+virtual bool GetAccelerationStructureSizes(
+    const LLGL::AccelerationStructureBuildDescriptor&   buildDesc,
+    LLGL::AccelerationStructureSizes&                   outSizes
+) override final;
+
+virtual std::uint64_t GetAccelerationStructureAddress(
+    const LLGL::Buffer& buffer
+) override final;
+
 
 
 // ================================================================================
@@ -8,11 +8,16 @@
 /* ----- Shaders ----- */
 
 virtual LLGL::Shader* CreateShader(
-    const LLGL::ShaderDescriptor&   shaderDesc
+    const LLGL::ShaderDescriptor&                   shaderDesc
+) override final;
+
+virtual std::uint32_t CreateShaders(
+    const LLGL::ArrayView<LLGL::ShaderDescriptor>&  shaderDescs,
+    LLGL::Shader**                                  outShaders
 ) override final;
 
 virtual void Release(
-    LLGL::Shader&                   shader
+    LLGL::Shader&                                   shader
 ) override final;
 
 
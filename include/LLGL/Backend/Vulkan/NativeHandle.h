@@ -52,6 +52,32 @@ struct CommandBufferNativeHandle
     VkCommandBuffer commandBuffer;
 };
 
+/**
+\brief Native handle structure for a Vulkan buffer or texture.
+\see Resource::GetNativeHandle
+*/
+struct ResourceNativeHandle
+{
+    //! Native handle to the Vulkan image. This is \c VK_NULL_HANDLE for buffers.
+    VkImage         image;
+
+    //! Native handle to the Vulkan buffer. This is \c VK_NULL_HANDLE for textures.
+    VkBuffer        buffer;
+
+    /**
+    \brief Native handle to the device memory chunk the resource is bound to.
+    \remarks The chunk can be shared with other resources, so only the range specified by \c memoryOffset and \c memorySize belongs to this resource.
+    This is \c VK_NULL_HANDLE for sparse and transient textures.
+    */
+    VkDeviceMemory  deviceMemory;
+
+    //! Offset (in bytes) of the resource within the device memory chunk.
+    VkDeviceSize    memoryOffset;
+
+    //! Size (in bytes) of the device memory range that is occupied by the resource.
+    VkDeviceSize    memorySize;
+};
+
 
 } // /namespace Vulkan
 
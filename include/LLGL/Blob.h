@@ -14,6 +14,7 @@
 #include <vector>
 #include <string>
 #include <memory>
+#include <cstdint>
 
 
 namespace LLGL
@@ -108,6 +109,36 @@ class LLGL_EXPORT Blob : public NonCopyable
         */
         static Blob CreateFromFile(const std::string& filename);
 
+        /**
+        \brief Creates a new Blob instance that maps the specified binary file into read-only memory.
+        \param[in] filename Specifies the file that is to be mapped.
+        \return New instance of Blob that refers to the memory mapped file content or null if the file could not be mapped, e.g. if the file is empty.
+        \remarks The file content is not copied. The memory mapping is released when the returned Blob is destroyed.
+        This is the preferred way to load large binary files such as pipeline caches or shader binaries.
+        \see CreateFromFile
+        */
+        static Blob CreateFromFileMapped(const char* filename);
+
+        /**
+        \brief Creates a new Blob instance that maps the specified binary file into read-only memory.
+        \param[in] filename Specifies the file that is to be mapped.
+        \return New instance of Blob that refers to the memory mapped file content or null if the file could not be mapped, e.g. if the file is empty.
+        \see CreateFromFileMapped(const char*)
+        */
+        static Blob CreateFromFileMapped(const std::string& filename);
+
+        /**
+        \brief Creates a new Blob instance that maps a range of the specified binary file into read-only memory.
+        \param[in] filename Specifies the file that is to be mapped.
+        \param[in] offset Specifies the offset (in bytes) of the range within the file. This does not need to be aligned to the page size.
+        \param[in] size Specifies the size (in bytes) of the range. If this is zero, the range ends at the end of the file.
+        \return New instance of Blob that refers to the memory mapped file range or null if the range could not be mapped, e.g. if it exceeds the file size.
+        \remarks This is the preferred way to read the MIP-map levels of texture containers whose data is already in their hardware format, such as BC compressed textures,
+        since the mapped memory can be passed to RenderSystem::WriteTexture directly.
+        \see CreateFromFileMapped(const char*)
+        */
+        static Blob CreateFromFileMapped(const char* filename, std::uint64_t offset, std::size_t size);
+
     public:
 
         //! Returns a constant pointer to the internal buffer or null if this is a default initialized blob.
@@ -116,6 +147,29 @@ class LLGL_EXPORT Blob : public NonCopyable
         //! Returns the size (in bytes) of the internal buffer or zero if this is a default initialized blob.
         std::size_t GetSize() const;
 
+        /**
+        \brief Writes the content of this blob into the specified binary file.
+        \param[in] filename Specifies the file that is to be written. If the file already exists, it will be overwritten.
+        \return True if the entire content has been written to the file, false otherwise.
+        \remarks This is the counterpart to CreateFromFile and CreateFromFileMapped, for instance, to store a pipeline cache on disk:
+        \code
+        // Load pipeline cache from previous run
+        LLGL::PipelineCache* myCache = myRenderer->CreatePipelineCache(LLGL::Blob::CreateFromFileMapped("MyPipelineCache.bin"));
+        // ...
+        // Store pipeline cache for next run
+        myCache->GetBlob().WriteToFile("MyPipelineCache.bin");
+        \endcode
+        \see CreateFromFileMapped
+        \see PipelineCache::GetBlob
+        */
+        bool WriteToFile(const char* filename) const;
+
+        /**
+        \brief Writes the content of this blob into the specified binary file.
+        \see WriteToFile(const char*)
+        */
+        bool WriteToFile(const std::string& filename) const;
+
     public:
 
         //! Returns true if this blob is non-empty.
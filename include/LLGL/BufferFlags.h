@@ -153,6 +153,32 @@ struct BufferViewDescriptor
     std::uint64_t   size    = LLGL_WHOLE_SIZE;
 };
 
+/**
+\brief Buffer copy region structure.
+\see CommandBuffer::CopyBuffer(Buffer&, Buffer&, const ArrayView<BufferCopyRegion>&)
+*/
+struct BufferCopyRegion
+{
+    BufferCopyRegion() = default;
+
+    //! Initializes the copy region with all attributes.
+    inline BufferCopyRegion(std::uint64_t dstOffset, std::uint64_t srcOffset, std::uint64_t size) :
+        dstOffset { dstOffset },
+        srcOffset { srcOffset },
+        size      { size      }
+    {
+    }
+
+    //! Specifies the destination offset (in bytes) at which the destination buffer is to be updated.
+    std::uint64_t   dstOffset   = 0;
+
+    //! Specifies the source offset (in bytes) at which the source buffer is to be read from.
+    std::uint64_t   srcOffset   = 0;
+
+    //! Specifies the size (in bytes) of the buffer region to copy.
+    std::uint64_t   size        = 0;
+};
+
 
 /* ----- Functions ----- */
 
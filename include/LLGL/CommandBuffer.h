@@ -18,12 +18,14 @@
 #include <LLGL/ResourceHeap.h>
 #include <LLGL/PipelineLayoutFlags.h>
 #include <LLGL/Constants.h>
+#include <LLGL/Container/ArrayView.h>
 
 #include <LLGL/RenderPass.h>
 #include <LLGL/RenderTarget.h>
 #include <LLGL/Shader.h>
 #include <LLGL/PipelineState.h>
 #include <LLGL/QueryHeap.h>
+#include <LLGL/AccelerationStructureFlags.h>
 
 #include <cstdint>
 
@@ -81,8 +83,12 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         \param[in] deferredCommandBuffer Specifies the deferred command buffer which is meant to be executed.
         This command buffer must have been created with the CommandBufferFlags::Secondary flag.
         \remarks This function can only be used by primary command buffers, i.e. command buffers that have not been created with the flag CommandBufferFlags::Secondary.
-        \see CommandBufferFlags
-        \todo Incomplete for: D3D12, Vulkan, Metal.
+        \remarks All bindings of this command buffer, such as the pipeline state, viewports, vertex and index buffers, and resources, are undefined after this call
+        and must be set again before the next draw or compute command.
+        \remarks Consecutive calls to this function within a render pass are the most efficient way to render the contents of secondary command buffers.
+        For the Vulkan backend, interleaving other commands with \c Execute within the same render pass splits the native render pass instance,
+        which requires the attachments to be stored and loaded again.
+        \see CommandBufferFlags::Secondary
         */
         virtual void Execute(CommandBuffer& deferredCommandBuffer) = 0;
 
@@ -99,17 +105,18 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         \param[in] data Raw pointer to the data with which the buffer is to be updated. This <b>must not</b> be null!
 
         \param[in] dataSize Specifies the size (in bytes) of the data block which is to be updated.
-        This is limited to 2^16 = 65536 bytes, because it may be written to the command buffer itself before it is copied to the destination buffer (depending on the backend).
 
-        \remarks To update buffers larger than 65536 bytes, use RenderSystem::WriteBuffer or RenderSystem::MapBuffer.
-        For performance reasons, it is recommended to encode this command outside of a render pass.
+        \remarks The data is copied once into the command buffer or its staging memory at the time this command is encoded,
+        so the client memory can be modified or released right after this function returns.
+        Large updates are encoded as a copy from staging memory that is owned by the command buffer (depending on the backend).
+        \remarks For performance reasons, it is recommended to encode this command outside of a render pass.
         Otherwise, render pass interruptions might be inserted by LLGL.
         */
         virtual void UpdateBuffer(
             Buffer&         dstBuffer,
             std::uint64_t   dstOffset,
             const void*     data,
-            std::uint16_t   dataSize
+            std::uint64_t   dataSize
         ) = 0;
 
         /**
@@ -138,6 +145,21 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
             std::uint64_t   size
         ) = 0;
 
+        /**
+        \brief Encodes a buffer copy command for multiple regions between the same pair of buffers.
+        \param[in,out] dstBuffer Specifies the destination buffer whose data is to be updated.
+        \param[in] srcBuffer Specifies the source buffer whose data is to be read from.
+        \param[in] regions Specifies the array of regions to copy. The same rules apply to each region as for the single-region version of this function.
+        \remarks This is equivalent to calling the single-region version of this function for each region,
+        but backends that support multiple regions natively (Vulkan and Direct3D 12) encode a single copy command and only synchronize the buffers once.
+        The destination regions \b must not overlap.
+        */
+        virtual void CopyBuffer(
+            Buffer&                                 dstBuffer,
+            Buffer&                                 srcBuffer,
+            const ArrayView<BufferCopyRegion>&      regions
+        ) = 0;
+
         /**
         \brief Encodes a buffer copy command that blits data from a source texture.
 
@@ -172,6 +194,12 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         \remarks If \c rowStride is not 0, it \b must be greater than or equal to the size (in bytes) of each row in the texture region with respect to the texture's format.
         \remarks The same rules of \c rowStride also apply to \c layerStride.
 
+        \remarks This is the preferred way to read back texture data without stalling the CPU (as opposed to RenderSystem::ReadTexture):
+        copy the texture into a buffer that was created with MiscFlags::Readback, submit a Fence after the command buffer,
+        and map the buffer with RenderSystem::MapBuffer once the fence has been signaled (see Fence::GetCompletedValue).
+        Mapping such a buffer neither copies data nor waits for the GPU. See ReadbackBufferPool for a pool of such buffers.
+        With OpenGL, the texture is read into the buffer as \c GL_PIXEL_PACK_BUFFER, which is executed on the GPU timeline.
+
         \see CopyTextureFromBuffer
         \see GetMemoryFootprint
         \see Texture::GetSubresourceFootprint
@@ -238,6 +266,21 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
             const Extent3D&         extent
         ) = 0;
 
+        /**
+        \brief Encodes a texture copy command for multiple regions between the same pair of textures, e.g. for all MIP-map levels of a texture.
+        \param[in,out] dstTexture Specifies the destination texture whose data is to be updated.
+        \param[in] srcTexture Specifies the source texture whose data is to be read from.
+        \param[in] regions Specifies the array of regions to copy. The same rules apply to each region as for the single-region version of this function.
+        \remarks This is equivalent to calling the single-region version of this function for each region,
+        but backends that support multiple regions natively (Vulkan and Direct3D 12) only transition and synchronize the textures once for all regions.
+        The destination regions \b must not overlap.
+        */
+        virtual void CopyTexture(
+            Texture&                                dstTexture,
+            Texture&                                srcTexture,
+            const ArrayView<TextureCopyRegion>&     regions
+        ) = 0;
+
         /**
         \brief Encodes a texture copy command that blits data from a source buffer.
 
@@ -285,6 +328,22 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
             std::uint32_t           layerStride = 0
         ) = 0;
 
+        /**
+        \brief Encodes a texture copy command for multiple regions from the same source buffer, e.g. for the sprites of a texture atlas or a MIP-map chain.
+        \param[in,out] dstTexture Specifies the destination texture whose data is to be updated. The same requirements apply as for the single-region version of this function.
+        \param[in] srcBuffer Specifies the source buffer whose data is to be read from. This buffer must have been created with the binding flag BindFlags::CopySrc.
+        \param[in] regions Specifies the array of regions to copy, where BufferTextureCopyRegion::textureRegion denotes the destination region.
+        The same rules apply to each region as for the single-region version of this function.
+        \remarks This is equivalent to calling the single-region version of this function for each region,
+        but backends that support multiple regions natively (Vulkan) only transition and synchronize the resources once for all regions.
+        The destination regions \b must not overlap.
+        */
+        virtual void CopyTextureFromBuffer(
+            Texture&                                    dstTexture,
+            Buffer&                                     srcBuffer,
+            const ArrayView<BufferTextureCopyRegion>&   regions
+        ) = 0;
+
         /**
         \brief Encodes a texture copy command that blits data from the current framebuffer.
 
@@ -306,6 +365,8 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
 
         \remarks This function is only supported for SwapChain framebuffers, not for common render targets. This functionality might be added in the future.
 
+        \remarks To capture the framebuffer into CPU memory without stalling, follow this command with CopyBufferFromTexture and read the buffer once a subsequent Fence has been signaled.
+
         \todo Add support for common render targets.
 
         \see RenderTarget::GetResolution
@@ -316,6 +377,60 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
             const Offset2D&         srcOffset
         ) = 0;
 
+        /**
+        \brief Encodes a texture blit command that copies a source region into a destination region of a different size with filtering.
+
+        \param[in,out] dstTexture Specifies the destination texture whose data is to be updated.
+        This texture must have been created with the binding flags BindFlags::CopyDst and BindFlags::Storage
+        and its format <b>must not</b> be compressed (see FormatFlags::IsCompressed), have a depth or stencil component,
+        be an unnormalized integer format, or be in sRGB color space (see FormatFlags::IsColorSpace_sRGB).
+
+        \param[in] dstRegion Specifies the destination region. Its \c subresource.numMipLevels, \c subresource.numArrayLayers, and \c extent.depth attributes \b must be 1.
+
+        \param[in] srcTexture Specifies the source texture whose data is to be read from.
+        This texture must have been created with the binding flags BindFlags::CopySrc and BindFlags::Sampled
+        and its format <b>must not</b> be compressed (see FormatFlags::IsCompressed), have a depth or stencil component, or be an unnormalized integer format.
+
+        \param[in] srcRegion Specifies the source region. Its \c subresource.numMipLevels, \c subresource.numArrayLayers, and \c extent.depth attributes \b must be 1.
+
+        \param[in] filter Specifies the filter that is used to minify or magnify the source region. By default SamplerFilter::Linear.
+
+        \remarks Both textures must be of type TextureType::Texture2D, TextureType::Texture2DArray, TextureType::TextureCube, or TextureType::TextureCubeArray,
+        and \c srcTexture and \c dstTexture must not refer to the same texture.
+        Texels outside of the source region are never read, i.e. the source region is clamped at its edges.
+
+        \remarks This is the explicit upscale step for dynamic resolution rendering:
+        a render target is created once at the maximum resolution, the scene is rendered into a sub-rectangle of it (see SetViewport and SetScissor)
+        whose size may change every frame, and the sub-rectangle is then blitted into the final output texture without recreating any render target.
+        \code
+        // Render scene at a variable resolution into the top-left corner of a full-size render target
+        myCmdBuffer->BeginRenderPass(*mySceneTarget);
+        myCmdBuffer->SetViewport(LLGL::Extent2D{ myRenderWidth, myRenderHeight });
+        // Draw scene ...
+        myCmdBuffer->EndRenderPass();
+
+        // Upscale rendered region into the output texture
+        const LLGL::TextureRegion srcRegion{ LLGL::Offset3D{}, LLGL::Extent3D{ myRenderWidth, myRenderHeight, 1 } };
+        const LLGL::TextureRegion dstRegion{ LLGL::Offset3D{}, LLGL::Extent3D{ myOutputWidth, myOutputHeight, 1 } };
+        myCmdBuffer->BlitTexture(*myOutputTexture, dstRegion, *mySceneColorTexture, srcRegion);
+        \endcode
+
+        \remarks Vulkan and OpenGL use their native blit commands.
+        Direct3D and Metal dispatch a builtin compute shader, so the bound pipeline state and resources must be set again after this command.
+
+        \remarks This command \b must be encoded outside of a render pass.
+
+        \see SetViewport
+        \see CopyTexture
+        */
+        virtual void BlitTexture(
+            Texture&                dstTexture,
+            const TextureRegion&    dstRegion,
+            Texture&                srcTexture,
+            const TextureRegion&    srcRegion,
+            const SamplerFilter     filter      = SamplerFilter::Linear
+        ) = 0;
+
         /**
         \brief Generates all MIP-maps for the specified texture.
 
@@ -395,20 +510,42 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         /**
         \brief Sets the specified vertex buffer for subsequent drawing operations.
         \param[in] buffer Specifies the vertex buffer to set. This buffer must have been created with the binding flag BindFlags::VertexBuffer and its content <b>must not</b> be uninitialized.
+        \param[in] offset Specifies an optional offset (in bytes) where to start reading the vertex buffer. By default 0.
+        This allows to bind a sub-range of a large buffer that holds the vertices of multiple meshes without the need of a \c baseVertex argument for each draw call.
+        \remarks For the OpenGL backend, the offset is only supported if the vertex layout was built with separate vertex buffer bindings, i.e. with \c GL_ARB_vertex_attrib_binding (OpenGL 4.3).
+        Otherwise, the offset is ignored.
         \see RenderSystem::CreateBuffer
         \see RenderSystem::WriteBuffer
         \see SetVertexBufferArray
         */
-        virtual void SetVertexBuffer(Buffer& buffer) = 0;
+        virtual void SetVertexBuffer(Buffer& buffer, std::uint64_t offset = 0) = 0;
 
         /**
         \brief Sets the specified array of vertex buffers for subsequent drawing operations.
         \param[in] bufferArray Specifies the vertex buffer array to set.
         \see RenderSystem::CreateBufferArray
         \see SetVertexBuffer
+        \see SetVertexBuffers
         */
         virtual void SetVertexBufferArray(BufferArray& bufferArray) = 0;
 
+        /**
+        \brief Sets the specified range of vertex buffers with optional offsets for subsequent drawing operations without the need of a BufferArray object.
+        \param[in] firstSlot Specifies the first vertex buffer slot that is to be set.
+        \param[in] numBuffers Specifies the number of vertex buffers that are to be set.
+        \param[in] buffers Pointer to the array of vertex buffers. Each buffer must have been created with the binding flag BindFlags::VertexBuffer.
+        This <b>must not</b> be null if \c numBuffers is greater than zero.
+        \param[in] offsets Optional pointer to the array of offsets (in bytes) where to start reading each vertex buffer.
+        If this is null, all offsets are zero. By default null.
+        \remarks This is meant for transient sets of vertex buffers that change per draw call,
+        since neither the buffers nor the offsets have to be stored in a BufferArray object beforehand.
+        \remarks For the OpenGL backend, vertex buffers are bound through vertex-array-objects (VAOs) that are built when a buffer or buffer array is created.
+        Hence, OpenGL only supports a single vertex buffer at slot 0 for this function, whose offset is handled the same way as for SetVertexBuffer.
+        \see SetVertexBuffer
+        \see SetVertexBufferArray
+        */
+        virtual void SetVertexBuffers(std::uint32_t firstSlot, std::uint32_t numBuffers, Buffer* const * buffers, const std::uint64_t* offsets = nullptr) = 0;
+
         /**
         \brief Sets the active index buffer for subsequent drawing operations.
         \param[in] buffer Specifies the index buffer to set. This buffer must have been created with the binding flag BindFlags::IndexBuffer and its content <b>must not</b> be uninitialized.
@@ -456,6 +593,18 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         */
         virtual void SetResource(std::uint32_t descriptor, Resource& resource) = 0;
 
+        /**
+        \brief Binds a contiguous range of resources as root parameters to the respective pipeline.
+        \param[in] firstDescriptor Specifies the zero-based index of the first descriptor in the currently bound pipeline layout.
+        \param[in] resources Specifies the list of resources that are to be bound to the descriptors starting at \c firstDescriptor.
+        Null pointers are allowed and leave the respective descriptor unchanged.
+        The range <code>[firstDescriptor, firstDescriptor + resources.size())</code> \b must be within <code>[0, PipelineLayout::GetNumBindings)</code>.
+        \remarks This is equivalent to calling SetResource for each resource, but the bound pipeline layout is only validated once
+        and the backends update their descriptor caches in a single pass.
+        \see SetResource
+        */
+        virtual void SetResources(std::uint32_t firstDescriptor, const ArrayView<Resource*>& resources) = 0;
+
         /**
         \brief Resets the binding slots for the specified resources.
 
@@ -488,6 +637,38 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
             long                stageFlags      = StageFlags::AllStages
         ) = 0;
 
+        /**
+        \brief Inserts explicit barriers between previous and subsequent accesses of the specified resources.
+
+        \param[in] numBarriers Specifies the number of barriers. If this is zero, the function has no effect.
+
+        \param[in] barriers Pointer to an array of \c numBarriers barrier descriptors.
+        All barriers of a single call are merged into a single native barrier command where the backend supports it.
+
+        \remarks This must only be called outside a render pass section.
+        \remarks Barriers are required for command buffers that were created with CommandBufferFlags::ExplicitBarriers,
+        but they can also be used in addition to the automatic barriers of other command buffers.
+        The barriers map to the respective native commands as follows:
+        - Vulkan: \c vkCmdPipelineBarrier with buffer, image, and global memory barriers that do not change the current image layout.
+        - Direct3D 12: Resource state transitions and UAV barriers.
+        - OpenGL: \c glMemoryBarrier for all barriers whose source usage contains BindFlags::Storage.
+        - Direct3D 11 and Metal: No effect, since these APIs synchronize resource accesses implicitly.
+
+        \code
+        // Make the output of one compute dispatch visible to the next dispatch and to a subsequent indirect draw
+        LLGL::ResourceBarrierDescriptor barriers[2] =
+        {
+            LLGL::ResourceBarrierDescriptor{ myParticleBuffer, LLGL::BindFlags::Storage, LLGL::BindFlags::Storage        },
+            LLGL::ResourceBarrierDescriptor{ myArgsBuffer,     LLGL::BindFlags::Storage, LLGL::BindFlags::IndirectBuffer },
+        };
+        myCmdBuffer->ResourceBarrier(2, barriers);
+        \endcode
+
+        \see CommandBufferFlags::ExplicitBarriers
+        \see ResourceBarrierDescriptor
+        */
+        virtual void ResourceBarrier(std::uint32_t numBarriers, const ResourceBarrierDescriptor* barriers) = 0;
+
         /* ----- Render Passes ----- */
 
         /**
@@ -542,7 +723,7 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
 
         \remarks
         The following commands \b must only be used \b inside a render pass section:
-        - Drawing commands (i.e. \c Draw, \c DrawInstanced, \c DrawIndexed, \c DrawIndexedInstanced, \c DrawIndirect and \c DrawIndexedIndirect).
+        - Drawing commands (i.e. \c Draw, \c DrawInstanced, \c DrawIndexed, \c DrawIndexedInstanced, \c DrawIndirect, \c DrawIndexedIndirect, \c DrawMesh, and \c DrawMeshIndirect).
         - Clear attachment commands (i.e. \c Clear and \c ClearAttachments).
         - Query block (i.e. \c BeginQuery and \c EndQuery).
         - Conditional render block (i.e. \c BeginRenderCondition and \c EndRenderCondition).
@@ -575,10 +756,26 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
 
         /**
         \brief Ends the current render pass.
+        \remarks If the next render pass begins with the same render target and render pass and the render pass does not clear any attachments,
+        backends for tile-based GPUs may merge both render passes into a single one, provided that only state and binding commands are encoded in between.
+        Any other command, such as a copy, compute dispatch, or resource barrier, ends the render pass before it is encoded.
+        This includes binding a resource heap with storage resources unless the command buffer was created with CommandBufferFlags::ExplicitBarriers, since this implicitly encodes a barrier.
+        This is currently implemented by the Vulkan and Metal backends.
         \see BeginRenderPass
         */
         virtual void EndRenderPass() = 0;
 
+        /**
+        \brief Advances to the next subpass of the current render pass.
+        \remarks This must only be called inside a render pass section that was started with a render pass which has more than one subpass,
+        and all subpasses must have been advanced through before the render pass ends.
+        Graphics pipelines must be bound again after this call, since each of them is only compatible with a single subpass.
+        \see RenderPassDescriptor::subpasses
+        \see GraphicsPipelineDescriptor::subpass
+        \see RenderingFeatures::hasSubpasses
+        */
+        virtual void NextSubpass() = 0;
+
         /**
         \brief Clears the specified group of attachments of the active render target.
 
@@ -673,6 +870,55 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         */
         virtual void SetStencilReference(std::uint32_t reference, const StencilFace stencilFace = StencilFace::FrontAndBack) = 0;
 
+        /**
+        \brief Sets the fragment shading rate for subsequent draw commands.
+        \param[in] rate Specifies the size of the coarse pixels the fragment shader is invoked for. The default value is ShadingRate::Rate1x1.
+        \remarks The shading rate is a command buffer state, i.e. it is retained when another graphics pipeline state is set
+        and it is reset to ShadingRate::Rate1x1 whenever the command buffer begins encoding.
+        \remarks This is implemented with \c VK_KHR_fragment_shading_rate for Vulkan and with variable rate shading tier 1 for Direct3D 12.
+        \note Only supported with: Direct3D 12, Vulkan.
+        \see RenderingFeatures::hasVariableRateShading
+        */
+        virtual void SetShadingRate(const ShadingRate rate) = 0;
+
+        /**
+        \brief Sets the dynamic pipeline state for the cull mode.
+        \param[in] cullMode Specifies the polygons that are culled.
+        \remarks This must only be used if the currently bound graphics pipeline state was created with DynamicStateFlags::CullMode. Otherwise, the behavior is undefined.
+        \note Only supported with: Vulkan.
+        \see DynamicStateFlags::CullMode
+        */
+        virtual void SetCullMode(const CullMode cullMode) = 0;
+
+        /**
+        \brief Sets the dynamic pipeline state for the depth test.
+        \param[in] depthDesc Specifies the depth test, depth write, and depth compare operation.
+        \remarks This must only be used if the currently bound graphics pipeline state was created with DynamicStateFlags::DepthState. Otherwise, the behavior is undefined.
+        \note Only supported with: Vulkan.
+        \see DynamicStateFlags::DepthState
+        */
+        virtual void SetDepthState(const DepthDescriptor& depthDesc) = 0;
+
+        /**
+        \brief Sets the dynamic pipeline state for the stencil test.
+        \param[in] stencilDesc Specifies the stencil test, the stencil operations, and the stencil masks for the front and back faces.
+        The stencil reference values and \c referenceDynamic are ignored; use SetStencilReference to set the reference values dynamically.
+        \remarks This must only be used if the currently bound graphics pipeline state was created with DynamicStateFlags::StencilState. Otherwise, the behavior is undefined.
+        \note Only supported with: Vulkan.
+        \see DynamicStateFlags::StencilState
+        */
+        virtual void SetStencilState(const StencilDescriptor& stencilDesc) = 0;
+
+        /**
+        \brief Sets the dynamic pipeline state for the primitive topology.
+        \param[in] topology Specifies the primitive topology for subsequent draw commands.
+        This must be of the same primitive class as GraphicsPipelineDescriptor::primitiveTopology of the bound PSO, i.e. points, lines, triangles, or patches with the same number of control points.
+        \remarks This must only be used if the currently bound graphics pipeline state was created with DynamicStateFlags::PrimitiveTopology. Otherwise, the behavior is undefined.
+        \note Only supported with: Vulkan.
+        \see DynamicStateFlags::PrimitiveTopology
+        */
+        virtual void SetPrimitiveTopology(const PrimitiveTopology topology) = 0;
+
         /**
         \brief Sets the value of a certain number of shader uniforms (aka. push constant/ shader constants) in the currently bound PSO.
 
@@ -745,12 +991,96 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         */
         virtual void BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t query = 0, const RenderConditionMode mode = RenderConditionMode::Wait) = 0;
 
+        /**
+        \brief Begins conditional rendering with a predicate value from the specified buffer.
+
+        \param[in] buffer Specifies the buffer that contains the predicate value.
+        This buffer must have been created with the binding flag BindFlags::IndirectBuffer.
+
+        \param[in] offset Specifies the offset (in bytes) of the predicate value within the buffer. This must be a multiple of 8.
+        The predicate is a 64-bit unsigned integer. Subsequent rendering commands are discarded if this value is zero,
+        or if it is non-zero and one of the inverted modes is specified.
+        For portability, the predicate value should be in the range <code>[0, 2^32)</code>, because Vulkan only evaluates the lower 32 bits.
+
+        \param[in] mode Specifies the mode of the render condition. Only the inverted modes are distinguished,
+        since the predicate value is always expected to be available when the GPU reaches this command.
+
+        \remarks This allows a compute pass to skip entire command sequences without reading back any visibility information, e.g. the results of CommandBuffer::ResolveQueries:
+        \code
+        myCmdBuffer->ResolveQueries(*myOcclusionQueries, 0, myNumObjects, *myPredicateBuffer, 0);
+        myCmdBuffer->BeginRenderPass(*myRenderTarget);
+        {
+            for (std::uint32_t i = 0; i < myNumObjects; ++i)
+            {
+                myCmdBuffer->BeginRenderCondition(*myPredicateBuffer, i * sizeof(std::uint64_t));
+                // draw actual object i ...
+                myCmdBuffer->EndRenderCondition();
+            }
+        }
+        myCmdBuffer->EndRenderPass();
+        \endcode
+
+        \note Only supported with: Vulkan, Direct3D 12.
+        \see RenderingFeatures::hasBufferRenderCondition
+        */
+        virtual void BeginRenderCondition(Buffer& buffer, std::uint64_t offset, const RenderConditionMode mode = RenderConditionMode::Wait) = 0;
+
         /**
         \brief Ends the current render condition.
         \see BeginRenderCondition
         */
         virtual void EndRenderCondition() = 0;
 
+        /**
+        \brief Resolves the results of the specified range of queries into a GPU buffer.
+
+        \param[in] queryHeap Specifies the query heap whose results are to be resolved.
+        This query heap must \e not have been created with the \c renderCondition member set to \c true and its type must be one of the following values:
+        - QueryType::SamplesPassed
+        - QueryType::AnySamplesPassed
+        - QueryType::AnySamplesPassedConservative
+        - QueryType::PipelineStatistics
+
+        \param[in] firstQuery Specifies the zero-based index of the first query within the heap.
+        \param[in] numQueries Specifies the number of queries to resolve.
+        The range <code>[firstQuery, firstQuery + numQueries)</code> must be inside the half-open range <code>[0, QueryHeapDescriptor::numQueries)</code>.
+
+        \param[in] dstBuffer Specifies the destination buffer. This buffer must have been created with the binding flag BindFlags::CopyDst.
+        \param[in] dstOffset Specifies the destination offset (in bytes) within the buffer. This must be a multiple of 8.
+
+        \remarks Each query result is written as a 64-bit unsigned integer, or as QueryPipelineStatistics structure if the query heap has type QueryType::PipelineStatistics.
+        The results can be used by subsequent commands without a CPU round-trip, e.g. for GPU-driven occlusion culling:
+        \code
+        myCmdBuffer->BeginRenderPass(*myRenderTarget);
+        {
+            for (std::uint32_t i = 0; i < myNumObjects; ++i)
+            {
+                myCmdBuffer->BeginQuery(*myOcclusionQueries, i);
+                // draw bounding box i ...
+                myCmdBuffer->EndQuery(*myOcclusionQueries, i);
+            }
+        }
+        myCmdBuffer->EndRenderPass();
+        myCmdBuffer->ResolveQueries(*myOcclusionQueries, 0, myNumObjects, *myVisibilityBuffer, 0);
+        // dispatch compute shader that generates indirect draw arguments from myVisibilityBuffer ...
+        \endcode
+
+        \note Only supported with: OpenGL, Vulkan, Direct3D 11, Direct3D 12.
+        With OpenGL, the results are only written without a CPU round-trip if \c GL_ARB_direct_state_access is supported.
+        With Direct3D 11, the results are always read back on the CPU and are therefore only resolved by immediate command buffers.
+
+        \see BeginQuery
+        \see CommandQueue::QueryResult
+        \see BindFlags::CopyDst
+        */
+        virtual void ResolveQueries(
+            QueryHeap&      queryHeap,
+            std::uint32_t   firstQuery,
+            std::uint32_t   numQueries,
+            Buffer&         dstBuffer,
+            std::uint64_t   dstOffset
+        ) = 0;
+
         /* ----- Stream Output ------ */
 
         /**
@@ -889,6 +1219,32 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         */
         virtual void DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride) = 0;
 
+        /**
+        \brief Draws a GPU-determined number of instances of primitives whose draw command arguments are taken from a buffer object.
+
+        \param[in] buffer Specifies the buffer from which the draw command arguments are taken. This buffer must have been created with the BindFlags::IndirectBuffer binding flag.
+        \param[in] offset Specifies an offset within the argument buffer from which the arguments are to be taken. This offset must be a multiple of 4.
+        \param[in] countBuffer Specifies the buffer from which the number of draw commands is taken as 32-bit unsigned integer.
+        This buffer must have been created with the BindFlags::IndirectBuffer binding flag.
+        \param[in] countBufferOffset Specifies an offset within the count buffer. This offset must be a multiple of 4.
+        \param[in] maxNumCommands Specifies the maximum number of draw commands. The actual number of commands is the minimum of this value and the value from the count buffer.
+        \param[in] stride Specifies the stride (in bytes) betweeen consecutive sets of arguments,
+        which is commonly greater than or euqal to <code>sizeof(DrawIndirectArguments)</code>. This stride must be a multiple of 4.
+
+        \remarks This allows a compute shader to emit the list of draw commands, e.g. after culling objects on the GPU, without reading back the number of commands.
+
+        \see DrawIndirectArguments
+        \see RenderingFeatures::hasIndirectDrawCount
+        */
+        virtual void DrawIndirect(
+            Buffer&         buffer,
+            std::uint64_t   offset,
+            Buffer&         countBuffer,
+            std::uint64_t   countBufferOffset,
+            std::uint32_t   maxNumCommands,
+            std::uint32_t   stride
+        ) = 0;
+
         /**
         \brief Draws an unknown amount of instances of primitives whose indexed draw command arguments are taken from a buffer object.
         \param[in] buffer Specifies the buffer from which the draw command arguments are taken. This buffer must have been created with the BindFlags::IndirectBuffer binding flag.
@@ -920,6 +1276,85 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         */
         virtual void DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride) = 0;
 
+        /**
+        \brief Draws a GPU-determined number of instances of primitives whose indexed draw command arguments are taken from a buffer object.
+
+        \param[in] buffer Specifies the buffer from which the draw command arguments are taken. This buffer must have been created with the BindFlags::IndirectBuffer binding flag.
+        \param[in] offset Specifies an offset within the argument buffer from which the arguments are to be taken. This offset must be a multiple of 4.
+        \param[in] countBuffer Specifies the buffer from which the number of draw commands is taken as 32-bit unsigned integer.
+        This buffer must have been created with the BindFlags::IndirectBuffer binding flag.
+        \param[in] countBufferOffset Specifies an offset within the count buffer. This offset must be a multiple of 4.
+        \param[in] maxNumCommands Specifies the maximum number of draw commands. The actual number of commands is the minimum of this value and the value from the count buffer.
+        \param[in] stride Specifies the stride (in bytes) betweeen consecutive sets of arguments,
+        which is commonly greater than or euqal to <code>sizeof(DrawIndexedIndirectArguments)</code>. This stride must be a multiple of 4.
+
+        \remarks This allows a compute shader to emit the list of draw commands, e.g. after culling objects on the GPU, without reading back the number of commands.
+
+        \see DrawIndexedIndirectArguments
+        \see RenderingFeatures::hasIndirectDrawCount
+        */
+        virtual void DrawIndexedIndirect(
+            Buffer&         buffer,
+            std::uint64_t   offset,
+            Buffer&         countBuffer,
+            std::uint64_t   countBufferOffset,
+            std::uint32_t   maxNumCommands,
+            std::uint32_t   stride
+        ) = 0;
+
+        /**
+        \brief Draws the primitives that were previously written into the current vertex buffer by a stream-output section.
+
+        \remarks The number of vertices is determined by the GPU from the amount of data the last stream-output section has written into the vertex buffer.
+        Hence, no CPU readback with QueryType::StreamOutPrimitivesWritten is required. This allows GPU-driven feedback loops such as particle simulations,
+        where two buffers are swapped each frame: one is drawn with this function while the other one is filled by a stream-output section.
+
+        \remarks The vertex buffer must have been set with SetVertexBuffer and it must have been created with both BindFlags::VertexBuffer and BindFlags::StreamOutputBuffer.
+        The vertex buffer must be used as the first stream-output buffer in BeginStreamOutput to be filled, and it must not be bound for stream-output while it is drawn.
+
+        \remarks This is only supported by Direct3D 11 (\c DrawAuto) and OpenGL 4.0 (\c glDrawTransformFeedback with \c GL_ARB_transform_feedback2).
+        Otherwise, this function has no effect.
+
+        \see BeginStreamOutput
+        \see SetVertexBuffer
+        \see RenderingFeatures::hasStreamOutputs
+        */
+        virtual void DrawStreamOutput() = 0;
+
+        /**
+        \brief Draws mesh shader work groups with the currently bound mesh pipeline.
+
+        \param[in] numWorkGroupsX Specifies the number of task shader work groups in the X-dimension, or mesh shader work groups if the pipeline has no task shader.
+        \param[in] numWorkGroupsY Specifies the number of task shader work groups in the Y-dimension, or mesh shader work groups if the pipeline has no task shader.
+        \param[in] numWorkGroupsZ Specifies the number of task shader work groups in the Z-dimension, or mesh shader work groups if the pipeline has no task shader.
+
+        \remarks The currently bound graphics pipeline must have been created with a mesh shader.
+        No vertex or index buffers are used by this command; the mesh shader generates the primitives itself.
+        The number of threads per work group is determined by the shaders, except for Metal where it is taken from ComputeShaderAttributes::workGroupSize of the respective shader.
+
+        \see GraphicsPipelineDescriptor::taskShader
+        \see GraphicsPipelineDescriptor::meshShader
+        \see RenderingFeatures::hasMeshShaders
+        */
+        virtual void DrawMesh(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ) = 0;
+
+        /**
+        \brief Draws mesh shader work groups whose draw command arguments are taken from a buffer object.
+
+        \param[in] buffer Specifies the buffer from which the draw command arguments are taken. This buffer must have been created with the BindFlags::IndirectBuffer binding flag.
+        \param[in] offset Specifies an offset within the argument buffer from which the arguments are to be taken. This offset must be a multiple of 4.
+        \param[in] numCommands Specifies the number of draw commands that are to be taken from the argument buffer.
+        \param[in] stride Specifies the stride (in bytes) betweeen consecutive sets of arguments,
+        which is commonly greater than or euqal to <code>sizeof(DrawMeshIndirectArguments)</code>. This stride must be a multiple of 4.
+
+        \remarks This allows a compute shader to determine the number of mesh shader work groups, e.g. after culling objects on the GPU.
+        Multiple draw commands are only natively supported by Direct3D 12 and Vulkan. For Metal, the recording of multiple draw commands is emulated with a simple loop.
+
+        \see DrawMeshIndirectArguments
+        \see RenderingFeatures::hasMeshShaders
+        */
+        virtual void DrawMeshIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride) = 0;
+
         /* ----- Compute ----- */
 
         /**
@@ -940,6 +1375,44 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         */
         virtual void DispatchIndirect(Buffer& buffer, std::uint64_t offset) = 0;
 
+        /* ----- Ray Tracing ----- */
+
+        /**
+        \brief Builds or updates a ray tracing acceleration structure.
+        \param[in] buildDesc Specifies the descriptor with the destination acceleration structure, the scratch buffer, and the geometry or instances.
+        \remarks The destination and scratch buffers must be at least as large as reported by RenderSystem::GetAccelerationStructureSizes for the same descriptor.
+        All bottom-level acceleration structures referenced by the instance buffer of a top-level acceleration structure must have been built before.
+        This command synchronizes with previous acceleration structure builds of the same command buffer, so a scratch buffer can be reused for consecutive builds.
+        \remarks This must not be called inside a render pass.
+        \see RenderSystem::GetAccelerationStructureSizes
+        \see RenderingFeatures::hasRayTracing
+        */
+        virtual void BuildAccelerationStructure(const AccelerationStructureBuildDescriptor& buildDesc) = 0;
+
+        /**
+        \brief Copies a ray tracing acceleration structure from one buffer into another.
+        \param[in] dst Specifies the destination buffer. This must have been created with the BindFlags::AccelerationStructure flag.
+        \param[in] src Specifies the source buffer. This must have been created with the BindFlags::AccelerationStructure flag.
+        \param[in] mode Specifies whether to clone or to compact the acceleration structure.
+        \remarks This must not be called inside a render pass.
+        \see WriteAccelerationStructureCompactedSize
+        \see RenderingFeatures::hasRayTracing
+        */
+        virtual void CopyAccelerationStructure(Buffer& dst, Buffer& src, const AccelerationStructureCopyMode mode = AccelerationStructureCopyMode::Clone) = 0;
+
+        /**
+        \brief Writes the size (in bytes) of the compacted form of an acceleration structure into the specified buffer.
+        \param[in] src Specifies the acceleration structure. This must have been built with the AccelerationStructureFlags::AllowCompaction flag.
+        \param[in] dstBuffer Specifies the destination buffer that receives the size as 64-bit unsigned integer. This must have been created with the BindFlags::Storage flag.
+        \param[in] dstOffset Specifies the offset (in bytes) into the destination buffer. This must be a multiple of 8.
+        \remarks Read the size back with a buffer created with MiscFlags::Readback once the command buffer has completed,
+        then allocate a buffer of that size and compact the acceleration structure into it with CopyAccelerationStructure.
+        \remarks This must not be called inside a render pass.
+        \see CopyAccelerationStructure
+        \see RenderingFeatures::hasRayTracing
+        */
+        virtual void WriteAccelerationStructureCompactedSize(Buffer& src, Buffer& dstBuffer, std::uint64_t dstOffset) = 0;
+
         /* ----- Debugging ----- */
 
         /**
@@ -9,6 +9,7 @@
 #define LLGL_COMMAND_BUFFER_FLAGS_H
 
 
+#include <LLGL/ShaderFlags.h>
 #include <cstdint>
 
 
@@ -17,6 +18,8 @@ namespace LLGL
 
 
 class RenderPass;
+class CommandQueue;
+class Resource;
 
 /* ----- Enumerations ----- */
 
@@ -60,6 +63,39 @@ enum class StencilFace
     Back,
 };
 
+/**
+\brief Fragment shading rate enumeration for variable rate shading.
+\remarks The enumeration entries specify the size of a coarse pixel in width by height.
+A coarse pixel invokes the fragment shader only once for all covered pixels, which reduces the fragment workload for high-resolution rendering.
+\see CommandBuffer::SetShadingRate
+\see RenderingFeatures::hasVariableRateShading
+*/
+enum class ShadingRate
+{
+    Rate1x1,    //!< Fragment shader is invoked once per pixel. This is the default shading rate.
+    Rate1x2,    //!< Fragment shader is invoked once per 1x2 pixel block.
+    Rate2x1,    //!< Fragment shader is invoked once per 2x1 pixel block.
+    Rate2x2,    //!< Fragment shader is invoked once per 2x2 pixel block.
+
+    /**
+    \brief Fragment shader is invoked once per 2x4 pixel block.
+    \remarks If the device does not support this shading rate, it is clamped to a supported shading rate, e.g. ShadingRate::Rate2x2.
+    */
+    Rate2x4,
+
+    /**
+    \brief Fragment shader is invoked once per 4x2 pixel block.
+    \remarks If the device does not support this shading rate, it is clamped to a supported shading rate, e.g. ShadingRate::Rate2x2.
+    */
+    Rate4x2,
+
+    /**
+    \brief Fragment shader is invoked once per 4x4 pixel block.
+    \remarks If the device does not support this shading rate, it is clamped to a supported shading rate, e.g. ShadingRate::Rate2x2.
+    */
+    Rate4x4,
+};
+
 
 /* ----- Flags ----- */
 
@@ -77,6 +113,19 @@ struct CommandBufferFlags
         \brief Specifies that the encoded command buffer will be submitted as a secondary command buffer.
         \remarks If this is specified, the command buffer must be submitted using the \c Execute function of a primary command buffer.
         \remarks This cannot be used in combination with the \c ImmediateSubmit flag.
+        \remarks Secondary command buffers can be encoded on different threads, which allows to split a single render pass across multiple threads.
+        A secondary command buffer does not inherit any bindings from the primary command buffer that executes it, i.e. it must set its own pipeline state,
+        vertex and index buffers, resources, and viewports. The primary command buffer must set the viewports as well,
+        since bundles in the Direct3D 12 backend inherit them from the calling command list and ignore their own viewports and scissors.
+        \remarks Secondary command buffers are implemented as follows:
+        - Vulkan: \c VK_COMMAND_BUFFER_LEVEL_SECONDARY with \c VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT if CommandBufferDescriptor::renderPass is specified.
+        - Direct3D 12: \c D3D12_COMMAND_LIST_TYPE_BUNDLE.
+        - Direct3D 11: Command lists of deferred device contexts. These do not inherit the framebuffer of the calling context,
+        so secondary command buffers must start and end their own render pass section.
+        - OpenGL: Deferred command buffers that are replayed by the primary command buffer.
+        \remarks For the Metal backend, secondary command buffers that only contain render states and draw commands
+        and are executed within a render pass are encoded into sub-encoders of an \c MTLParallelRenderCommandEncoder on worker threads.
+        They inherit the render states of the primary command buffer and are executed by the GPU in the order of the \c Execute calls.
         \see CommandBuffer::Execute
         \see CommandBufferDescriptor::renderPass
         */
@@ -98,6 +147,49 @@ struct CommandBufferFlags
         \see CommandBuffer::End
         */
         ImmediateSubmit = (1 << 2),
+
+        /**
+        \brief Specifies that the command buffer does not insert memory barriers for storage resources automatically.
+        \remarks If this is specified, the barriers of resource heaps (see ResourceHeapDescriptor::barrierFlags) are ignored
+        and the client is responsible to synchronize all accesses to storage resources with CommandBuffer::ResourceBarrier.
+        This allows engines that already track their resource states to merge barriers and avoid over-synchronization, e.g. between consecutive compute dispatches.
+        \remarks Layout and state transitions that are required to bind a resource at all, such as image layout transitions in Vulkan,
+        are still inserted automatically by the backend.
+        \see CommandBuffer::ResourceBarrier
+        */
+        ExplicitBarriers = (1 << 3),
+    };
+};
+
+/**
+\brief Command queue type flags.
+\remarks These flags describe which kind of work a command queue can execute.
+Graphics queues can also execute compute and copy commands, and compute queues can also execute copy commands.
+\see RenderSystem::GetCommandQueue(long)
+*/
+struct CommandQueueFlags
+{
+    enum
+    {
+        /**
+        \brief Specifies a command queue for graphics, compute, and copy commands.
+        \remarks This is the primary command queue that is also returned by RenderSystem::GetCommandQueue().
+        */
+        Graphics        = (1 << 0),
+
+        /**
+        \brief Specifies a command queue for compute and copy commands.
+        \remarks This maps to an asynchronous compute queue if the hardware supports it.
+        Command buffers for this queue must not record any graphics commands, such as render passes or draw commands.
+        */
+        Compute         = (1 << 1),
+
+        /**
+        \brief Specifies a command queue for copy commands only.
+        \remarks This maps to an asynchronous copy queue if the hardware supports it.
+        Command buffers for this queue must only record copy, fill, and update commands.
+        */
+        Copy            = (1 << 2),
     };
 };
 
@@ -237,6 +329,57 @@ struct AttachmentClear
     ClearValue      clearValue;
 };
 
+/**
+\brief Resource barrier command structure.
+\remarks Describes a dependency between all previous accesses to a resource with the usage \c srcUsage
+and all subsequent accesses to the same resource with the usage \c dstUsage.
+\see CommandBuffer::ResourceBarrier
+*/
+struct ResourceBarrierDescriptor
+{
+    ResourceBarrierDescriptor() = default;
+    ResourceBarrierDescriptor(const ResourceBarrierDescriptor&) = default;
+    ResourceBarrierDescriptor& operator = (const ResourceBarrierDescriptor&) = default;
+
+    //! Constructor to initialize the barrier with resource, source usage, and destination usage.
+    inline ResourceBarrierDescriptor(Resource* resource, long srcUsage, long dstUsage) :
+        resource { resource },
+        srcUsage { srcUsage },
+        dstUsage { dstUsage }
+    {
+    }
+
+    /**
+    \brief Specifies the Buffer or Texture this barrier applies to. By default null.
+    \remarks If this is null, the barrier applies to all resources, i.e. it is a global memory barrier.
+    */
+    Resource*   resource    = nullptr;
+
+    /**
+    \brief Specifies how the resource was used before the barrier. By default 0.
+    \remarks This can be a bitwise OR combination of the BindFlags entries, e.g. BindFlags::Storage for a shader write or BindFlags::CopyDst for a copy command.
+    \see BindFlags
+    */
+    long        srcUsage    = 0;
+
+    /**
+    \brief Specifies how the resource will be used after the barrier. By default 0.
+    \remarks This can be a bitwise OR combination of the BindFlags entries, e.g. BindFlags::Sampled for a shader read or BindFlags::IndirectBuffer for indirect arguments.
+    \see BindFlags
+    */
+    long        dstUsage    = 0;
+
+    /**
+    \brief Specifies the shader stages that accessed the resource before the barrier. By default StageFlags::AllStages.
+    \remarks This is only considered for shader accesses, i.e. BindFlags::ConstantBuffer, BindFlags::Sampled, and BindFlags::Storage.
+    \see StageFlags
+    */
+    long        srcStages   = StageFlags::AllStages;
+
+    //! Specifies the shader stages that access the resource after the barrier. By default StageFlags::AllStages. \see srcStages
+    long        dstStages   = StageFlags::AllStages;
+};
+
 /**
 \brief Command buffer descriptor structure.
 \see RenderSystem::CreateCommandBuffer
@@ -289,7 +432,8 @@ struct CommandBufferDescriptor
     /**
     \brief Specifies the minimum size (in bytes) for the staging pool (if supported). By default 65536 (or <tt>0xFFFF + 1</tt>).
     \remarks This is only a hint to the framework, since not all rendering APIs support command buffers natively.
-    For the D3D12 backend for instance, this will specify the initial buffer size for the staging pool, i.e. for buffer updates during command encoding.
+    For the D3D12 backend for instance, this will specify the size of the upload ring buffer per native command buffer, i.e. for buffer updates during command encoding.
+    Updates that do not fit into the ring buffer fall back to temporary upload heaps that are released once the GPU has finished with them.
     For command buffers that will make many and large buffer updates, increase this size to fine-tune performance.
     \see CommandBuffer::UpdateBuffer
     */
@@ -305,6 +449,16 @@ struct CommandBufferDescriptor
     \see CommandBufferFlags::Secondary
     */
     const RenderPass*   renderPass          = nullptr;
+
+    /**
+    \brief Optional command queue the command buffer will be submitted to. By default null.
+    \remarks If this is null, the command buffer is submitted to the primary command queue, i.e. the one returned by RenderSystem::GetCommandQueue().
+    Command buffers for a compute or copy queue must be created with the respective queue,
+    since some rendering APIs (such as Direct3D 12) must know the type of queue when the native command buffer is allocated.
+    Immediate command buffers (see CommandBufferFlags::ImmediateSubmit) are submitted to this queue as well.
+    \see RenderSystem::GetCommandQueue(long)
+    */
+    CommandQueue*       commandQueue        = nullptr;
 };
 
 
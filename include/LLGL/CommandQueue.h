@@ -51,13 +51,30 @@ class LLGL_EXPORT CommandQueue : public RenderSystemChild
         */
         virtual void Submit(CommandBuffer& commandBuffer) = 0;
 
-        #if 0
         /**
         \brief Submits all command buffers in the specified array to the command queue at once.
+        \param[in] numCommandBuffers Specifies the number of command buffers in the array \c commandBuffers.
+        \param[in] commandBuffers Specifies the array of command buffers. They are executed in the order of this array.
+        Command buffers that were created with the CommandBufferFlags::ImmediateSubmit flag are ignored.
+        \remarks This is equivalent to calling Submit(CommandBuffer&) for each command buffer,
+        but backends with an explicit submission API (i.e. Vulkan and Direct3D 12) submit all command buffers with a single native call.
         \see Submit(CommandBuffer&)
         */
         virtual void Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers);
-        #endif
+
+        /* ----- Presentation ----- */
+
+        /**
+        \brief Presents all swap-chains in the specified array at once.
+        \param[in] numSwapChains Specifies the number of swap-chains in the array \c swapChains.
+        \param[in] swapChains Specifies the array of swap-chains. Null pointers are ignored. Each swap-chain must appear at most once in this array.
+        \remarks This is equivalent to calling SwapChain::Present for each swap-chain,
+        but the Vulkan backend presents all swap-chains that share the same present queue with a single native call,
+        so the outputs of multi-display setups are presented in the same operation and stay in sync.
+        The other backends present each swap-chain individually, since their native APIs have no batched presentation.
+        \see SwapChain::Present
+        */
+        virtual void Present(std::uint32_t numSwapChains, SwapChain* const * swapChains);
 
         /* ----- Queries ----- */
 
@@ -96,11 +113,38 @@ class LLGL_EXPORT CommandQueue : public RenderSystemChild
             std::size_t     dataSize
         ) = 0;
 
+        /**
+        \brief Samples a pair of correlated CPU and GPU timestamps.
+        \param[out] outCalibration Specifies the output calibration. This is only modified on success.
+        \return True on success. Otherwise, the backend does not support timestamp calibration.
+        \remarks The calibrated GPU timestamp is in the same time domain as the results of queries of type QueryType::Timestamp that are submitted to this command queue.
+        \see RenderingFeatures::hasTimestampCalibration
+        */
+        virtual bool QueryTimestampCalibration(TimestampCalibration& outCalibration) = 0;
+
         /* ----- Fences ----- */
 
         //! Submits the specified fence to the command queue for CPU/GPU synchronization.
         virtual void Submit(Fence& fence) = 0;
 
+        /**
+        \brief Submits a GPU-side wait for the specified fence to the command queue.
+        \param[in] fence Specifies the fence the command queue has to wait for before it executes subsequently submitted command buffers.
+        This fence must have been submitted to another command queue before, using CommandQueue::Submit(Fence&).
+        \remarks In contrast to WaitFence, this function does not block the CPU.
+        It is used to synchronize command queues with each other, e.g. to wait on the primary queue for the results of an asynchronous compute pass:
+        \code
+        myComputeQueue->Submit(*myComputeCmdBuffer);
+        myComputeQueue->Submit(*myFence);
+        myCmdQueue->SubmitWait(*myFence);
+        myCmdQueue->Submit(*myGraphicsCmdBuffer);
+        \endcode
+        \remarks The waiting command queue must submit a command buffer or fence before the same fence is submitted again.
+        \remarks If the backend only provides a single command queue, this function has no effect.
+        \see RenderSystem::GetCommandQueue(long)
+        */
+        virtual void SubmitWait(Fence& fence) = 0;
+
         /**
         \brief Blocks the CPU execution until the specified fence has been signaled.
         \param[in] fence Specifies the fence for which the CPU needs to wait to be signaled.
@@ -111,6 +155,46 @@ class LLGL_EXPORT CommandQueue : public RenderSystemChild
         */
         virtual bool WaitFence(Fence& fence, std::uint64_t timeout) = 0;
 
+        /**
+        \brief Submits a signal operation to the command queue that sets the specified fence to a new timeline value.
+        \param[in] fence Specifies the fence that is to be signaled.
+        \param[in] value Specifies the value the fence is set to once all previously submitted work of this queue has been completed.
+        This must be greater than any value that has previously been submitted for this fence.
+        \remarks This allows the CPU to run several frames ahead of the GPU with a single fence object, e.g. to recycle per-frame resources:
+        \code
+        // Wait until the GPU has finished the frame that last used the current per-frame resources
+        ++myFrameIndex;
+        if (myFrameIndex > numFramesInFlight)
+            myCmdQueue->WaitFence(*myFence, myFrameIndex - numFramesInFlight, ~0ull);
+        // Encode and submit command buffer ...
+        myCmdQueue->Submit(*myFence, myFrameIndex);
+        \endcode
+        \see Fence::GetCompletedValue
+        \see WaitFence(Fence&, std::uint64_t, std::uint64_t)
+        */
+        virtual void Submit(Fence& fence, std::uint64_t value) = 0;
+
+        /**
+        \brief Submits a GPU-side wait until the specified fence has reached the specified timeline value.
+        \param[in] fence Specifies the fence the command queue has to wait for before it executes subsequently submitted command buffers.
+        \param[in] value Specifies the minimum timeline value the fence must have reached.
+        \remarks In contrast to SubmitWait(Fence&), the same value can be waited on by any number of queues.
+        If the backend only provides a single command queue, this function has no effect.
+        \see Submit(Fence&, std::uint64_t)
+        */
+        virtual void SubmitWait(Fence& fence, std::uint64_t value) = 0;
+
+        /**
+        \brief Blocks the CPU execution until the specified fence has reached the specified timeline value.
+        \param[in] fence Specifies the fence for which the CPU needs to wait.
+        \param[in] value Specifies the minimum timeline value the fence must have reached.
+        \param[in] timeout Specifies the waiting timeout (in nanoseconds).
+        \return True if the fence has reached the specified value, or false if the fence has a timeout or the device is lost.
+        \see Submit(Fence&, std::uint64_t)
+        \see Fence::GetCompletedValue
+        */
+        virtual bool WaitFence(Fence& fence, std::uint64_t value, std::uint64_t timeout) = 0;
+
         /**
         \brief Blocks the CPU execution until the entire GPU command queue has been completed.
         \remarks To wait for a specific point in the command queue, use fences.
@@ -0,0 +1,151 @@
+/*
+ * Allocator.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_ALLOCATOR_H
+#define LLGL_ALLOCATOR_H
+
+
+#include <LLGL/Export.h>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Callback interface for a custom memory allocator.
+\remarks Both callbacks must be specified. The \c size and \c alignment parameters of the deallocation callback always match the respective allocation.
+\see SetAllocator
+*/
+struct AllocatorCallbacks
+{
+    /**
+    \brief Allocates the specified number of bytes with the specified alignment.
+    \remarks The alignment is always a power of two. Returning null is treated as fatal out-of-memory error.
+    */
+    void* (*allocate)(std::size_t size, std::size_t alignment, void* userData)                  = nullptr;
+
+    //! Releases the specified memory block that was previously returned by the allocation callback.
+    void  (*deallocate)(void* ptr, std::size_t size, std::size_t alignment, void* userData)     = nullptr;
+
+    //! Optional user data that is passed to both callbacks.
+    void*   userData                                                                            = nullptr;
+};
+
+/**
+\brief Counters of all allocations that went through the LLGL allocator since program start.
+\see GetAllocatorStatistics
+*/
+struct AllocatorStatistics
+{
+    //! Total number of allocations.
+    std::uint64_t numAllocations    = 0;
+
+    //! Total number of deallocations.
+    std::uint64_t numDeallocations  = 0;
+
+    //! Total number of bytes that were allocated. This is not reduced by deallocations.
+    std::uint64_t allocatedBytes    = 0;
+};
+
+/**
+\brief Sets the global memory allocator for all LLGL-internal heap allocations or restores the default allocator if \c callbacks is null.
+\remarks This affects all containers that use HeapAllocator (which is the default for SmallVector, DynamicVector, and DynamicArray),
+the command memory of virtual command buffers, and memory arenas.
+\note This must be called before any LLGL object is created and must not be changed while any memory of the previous allocator is still in use,
+because memory is always released with the allocator that is set at the time of the deallocation.
+\see AllocatorCallbacks
+*/
+LLGL_EXPORT void SetAllocator(const AllocatorCallbacks* callbacks);
+
+/**
+\brief Allocates memory with the global LLGL allocator.
+\param[in] size Specifies the size (in bytes) of the allocation.
+\param[in] alignment Specifies the alignment (in bytes) of the allocation. This must be a power of two.
+\return Pointer to the new uninitialized memory block. This is never null.
+\see SetAllocator
+*/
+LLGL_EXPORT void* AllocateMemory(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+
+/**
+\brief Releases memory that was allocated with AllocateMemory.
+\remarks The \c size and \c alignment parameters must match the respective allocation.
+*/
+LLGL_EXPORT void FreeMemory(void* ptr, std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+
+/**
+\brief Returns the counters of all allocations that went through the LLGL allocator.
+\remarks These counters are process wide and updated atomically, so the difference between two snapshots
+can be used to determine the number of allocations within a frame. This is also reported by the debug layer.
+\see ProfileMemoryRecord::heapAllocations
+*/
+LLGL_EXPORT AllocatorStatistics GetAllocatorStatistics();
+
+/**
+\brief Stateless allocator compatible with std::allocator that allocates from the global LLGL allocator.
+\remarks This is the default allocator for SmallVector, DynamicVector, and DynamicArray.
+\tparam T Specifies the element type.
+\see SetAllocator
+*/
+template <typename T>
+class HeapAllocator
+{
+
+    public:
+
+        using value_type = T;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = HeapAllocator<U>;
+        };
+
+    public:
+
+        HeapAllocator() = default;
+
+        template <typename U>
+        HeapAllocator(const HeapAllocator<U>&)
+        {
+        }
+
+        T* allocate(std::size_t n)
+        {
+            return static_cast<T*>(AllocateMemory(n * sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T* p, std::size_t n)
+        {
+            FreeMemory(p, n * sizeof(T), alignof(T));
+        }
+
+};
+
+template <typename T, typename U>
+inline bool operator == (const HeapAllocator<T>&, const HeapAllocator<U>&)
+{
+    return true;
+}
+
+template <typename T, typename U>
+inline bool operator != (const HeapAllocator<T>&, const HeapAllocator<U>&)
+{
+    return false;
+}
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
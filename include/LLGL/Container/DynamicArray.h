@@ -13,6 +13,7 @@
 #include <LLGL/Tags.h>
 #include <LLGL/Container/ArrayView.h>
 #include <LLGL/Container/Memory.h>
+#include <LLGL/Container/Allocator.h>
 #include <memory>
 #include <cstddef>
 #include <iterator>
@@ -29,12 +30,12 @@ namespace LLGL
 \remarks Because this container does not support \c push_back, \c pop_back, or \c insert functionallity,
 it only supports trivially constructible and trivially copyable types.
 \tparam T Specifies the array element type.
-\tparam Allocator Specifies the memory allocator. This has to be compatible with std::allocator. By default std::allocator<T>.
+\tparam Allocator Specifies the memory allocator. This has to be compatible with std::allocator. By default HeapAllocator<T>.
 */
 template
 <
     typename T,
-    typename Allocator = std::allocator<T>
+    typename Allocator = HeapAllocator<T>
 >
 class LLGL_EXPORT DynamicArray
 {
@@ -25,7 +25,7 @@ namespace LLGL
 template
 <
     typename T,
-    typename Allocator       = std::allocator<T>,
+    typename Allocator       = HeapAllocator<T>,
     typename GrowStrategy    = GrowStrategyAddHalf
 >
 using DynamicVector = SmallVector<T, 0, Allocator, GrowStrategy>;
@@ -0,0 +1,187 @@
+/*
+ * MemoryArena.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_MEMORY_ARENA_H
+#define LLGL_MEMORY_ARENA_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/NonCopyable.h>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Linear memory arena for short-lived allocations such as temporary strings and vectors during level loading or within a single frame.
+\remarks Allocations are taken from large chunks by bumping a pointer and are only released all at once, either with Reset or when the arena is destroyed.
+An arena only takes effect for containers that use ArenaAllocator and only while it is bound to the calling thread via ScopedMemoryArena.
+A memory arena must not be used by multiple threads at the same time.
+\see ArenaAllocator
+\see ScopedMemoryArena
+*/
+class LLGL_EXPORT MemoryArena final : public NonCopyable
+{
+
+    public:
+
+        struct Pimpl;
+
+        /**
+        \brief Initializes the memory arena with the specified chunk size.
+        \param[in] chunkSize Specifies the size (in bytes) of each memory chunk. Allocations larger than this are served by a dedicated chunk. By default 64 KB.
+        */
+        explicit MemoryArena(std::size_t chunkSize = 64 * 1024);
+
+        //! Releases all memory chunks of this arena.
+        ~MemoryArena();
+
+    public:
+
+        /**
+        \brief Allocates the specified number of bytes from this arena.
+        \param[in] size Specifies the size (in bytes) of the allocation.
+        \param[in] alignment Specifies the alignment (in bytes) of the allocation. This must be a power of two.
+        \return Pointer to the new uninitialized memory block. This is never null.
+        */
+        void* Allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+
+        /**
+        \brief Releases all allocations of this arena at once but keeps the first memory chunk for reuse.
+        \remarks All pointers previously allocated from this arena become invalid.
+        This is meant to be called at the end of a frame or after a loading phase.
+        */
+        void Reset();
+
+        //! Returns the number of bytes that have been allocated from this arena since construction or the last call to Reset.
+        std::size_t GetAllocatedSize() const;
+
+    public:
+
+        /**
+        \brief Returns the memory arena that is currently bound to the calling thread or null if there is none.
+        \see ScopedMemoryArena
+        */
+        static MemoryArena* GetCurrent();
+
+        /**
+        \brief Allocates memory for ArenaAllocator from the arena that is bound to the calling thread or from the heap if there is none.
+        \remarks The returned memory must be released with DeallocateFromCurrent.
+        */
+        static void* AllocateFromCurrent(std::size_t size, std::size_t alignment);
+
+        /**
+        \brief Releases memory that was allocated with AllocateFromCurrent.
+        \remarks Memory that was taken from an arena is only reclaimed when the arena is reset, except for the most recent allocation.
+        Heap memory is released immediately. This function can be called from any scope, even after the arena was unbound.
+        */
+        static void DeallocateFromCurrent(void* ptr);
+
+    private:
+
+        Pimpl* pimpl_;
+
+};
+
+/**
+\brief Binds a memory arena to the calling thread for the lifetime of this object.
+\remarks Scopes can be nested. The previously bound arena is restored when this object is destroyed.
+\code
+LLGL::MemoryArena arena;
+{
+    LLGL::ScopedMemoryArena scope{ arena };
+    LLGL::DynamicVector<int, LLGL::ArenaAllocator<int>> temporaryValues;
+    // ...
+}
+arena.Reset();
+\endcode
+*/
+class LLGL_EXPORT ScopedMemoryArena final : public NonCopyable
+{
+
+    public:
+
+        //! Binds the specified arena to the calling thread.
+        explicit ScopedMemoryArena(MemoryArena& arena);
+
+        //! Restores the previously bound arena of the calling thread.
+        ~ScopedMemoryArena();
+
+    private:
+
+        MemoryArena* prevArena_ = nullptr;
+
+};
+
+/**
+\brief Stateless allocator compatible with std::allocator that allocates from the memory arena bound to the calling thread.
+\remarks If no arena is bound, this allocator falls back to the heap. This allocator can be used with SmallVector, DynamicVector,
+LinearStringContainer, and standard containers such as \c std::vector and \c std::basic_string.
+\note Containers that use this allocator must not outlive the arena they allocated from!
+\tparam T Specifies the element type.
+\see MemoryArena
+\see ScopedMemoryArena
+*/
+template <typename T>
+class ArenaAllocator
+{
+
+    public:
+
+        using value_type = T;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = ArenaAllocator<U>;
+        };
+
+    public:
+
+        ArenaAllocator() = default;
+
+        template <typename U>
+        ArenaAllocator(const ArenaAllocator<U>&)
+        {
+        }
+
+        T* allocate(std::size_t n)
+        {
+            static_assert(alignof(T) <= alignof(std::max_align_t), "ArenaAllocator<T>: T must not be over-aligned");
+            return static_cast<T*>(MemoryArena::AllocateFromCurrent(n * sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T* p, std::size_t /*n*/)
+        {
+            MemoryArena::DeallocateFromCurrent(p);
+        }
+
+};
+
+template <typename T, typename U>
+inline bool operator == (const ArenaAllocator<T>&, const ArenaAllocator<U>&)
+{
+    return true;
+}
+
+template <typename T, typename U>
+inline bool operator != (const ArenaAllocator<T>&, const ArenaAllocator<U>&)
+{
+    return false;
+}
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
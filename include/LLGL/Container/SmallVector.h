@@ -12,6 +12,7 @@
 #include <LLGL/Export.h>
 #include <LLGL/Container/ArrayView.h>
 #include <LLGL/Container/AlignedArray.h>
+#include <LLGL/Container/Allocator.h>
 #include <memory>
 #include <cstddef>
 #include <iterator>
@@ -106,14 +107,14 @@ struct GrowStrategyRoundUpPow2
 \brief Generic container class for consecutive arrays optimized for small sizes.
 \tparam T Specifies the array element type.
 \tparam LocalCapacity Specifies the capacity of the local buffer. Up to this number of elemnts no dynamic memory allocation is necessary. By default 16.
-\tparam Allocator Specifies the memory allocator. This has to be compatible with std::allocator. By default std::allocator<T>.
+\tparam Allocator Specifies the memory allocator. This has to be compatible with std::allocator. By default HeapAllocator<T>.
 \tparam GrowStrategy Specifies the strategy to grow the internal storage when the container switched to heap allocations. By default GrowStrategyAddHalf.
 */
 template
 <
     typename    T,
     std::size_t LocalCapacity   = 16,
-    typename    Allocator       = std::allocator<T>,
+    typename    Allocator       = HeapAllocator<T>,
     typename    GrowStrategy    = GrowStrategyAddHalf
 >
 class LLGL_EXPORT SmallVector
@@ -150,6 +150,36 @@ class LLGL_EXPORT Display : public Interface
         */
         virtual std::vector<DisplayMode> GetSupportedDisplayModes() const = 0;
 
+        /**
+        \brief Blocks the calling thread until the next vertical blank of this display.
+        \return True on success, otherwise waiting for vertical blanks is not supported on this platform and the function returns immediately.
+        \remarks This can be used by a frame scheduler to start the work for the next frame just in time to reduce input latency.
+        The following backends are used:
+        - Win32: \c IDXGIOutput::WaitForVBlank.
+        - macOS: \c CVDisplayLink (only if LLGL was built with \c LLGL_MACOS_ENABLE_COREVIDEO).
+        - GNU/Linux: \c DRM_IOCTL_WAIT_VBLANK (only if LLGL was built with \c LLGL_LINUX_ENABLE_DRM).
+        \see GetVBlankTiming
+        */
+        virtual bool WaitForVBlank();
+
+        /**
+        \brief Queries the timing of the most recent and the predicted next vertical blank of this display.
+        \param[out] outTiming Specifies the output parameter for the vertical blank timing.
+        \return True on success, otherwise vertical blank timing is not supported on this platform and \c outTiming is not modified.
+        \remarks This is a non-blocking alternative to WaitForVBlank, e.g. to sleep until shortly before the next vertical blank:
+        \code
+        LLGL::DisplayVBlankTiming timing;
+        if (myDisplay->GetVBlankTiming(timing)) {
+            const std::uint64_t frameStartTime = timing.nextVBlank - myEstimatedFrameTime;
+            // Sleep until frameStartTime ...
+        }
+        \endcode
+        \remarks On some platforms, the timing is only available after WaitForVBlank has been called at least once.
+        \see WaitForVBlank
+        \see DisplayVBlankTiming
+        */
+        virtual bool GetVBlankTiming(DisplayVBlankTiming& outTiming) const;
+
     protected:
 
         /**
@@ -158,6 +188,13 @@ class LLGL_EXPORT Display : public Interface
         */
         static void FinalizeDisplayModes(std::vector<DisplayMode>& displayMode);
 
+        /**
+        \brief Extrapolates the next vertical blank from DisplayVBlankTiming::lastVBlank and DisplayVBlankTiming::refreshPeriod.
+        \remarks Also moves DisplayVBlankTiming::lastVBlank forward to the most recent vertical blank before the current time.
+        \see GetVBlankTiming
+        */
+        static void PredictNextVBlank(DisplayVBlankTiming& timing);
+
 };
 
 
@@ -34,6 +34,25 @@ struct DisplayMode
     std::uint32_t   refreshRate = 0;
 };
 
+/**
+\brief Vertical blank timing structure.
+\remarks All timestamps are in ticks of the high resolution timer, i.e. they can be compared to the values returned by Timer::Tick.
+Use Timer::Frequency to convert them into seconds.
+\see Display::GetVBlankTiming
+\see Timer::Tick
+*/
+struct DisplayVBlankTiming
+{
+    //! Timestamp of the most recent vertical blank that has been observed.
+    std::uint64_t   lastVBlank      = 0;
+
+    //! Predicted timestamp of the next vertical blank. This is always greater than the timestamp at the time of the query.
+    std::uint64_t   nextVBlank      = 0;
+
+    //! Number of ticks between two consecutive vertical blanks, i.e. the refresh period of the display.
+    std::uint64_t   refreshPeriod   = 0;
+};
+
 //! \deprecated Since 0.04b; Use LLGL::DisplayMode instead!
 LLGL_DEPRECATED("LLGL::DisplayModeDescriptor is deprecated since 0.04b; Use LLGL::DisplayMode instead!", "DisplayMode") 
 typedef DisplayMode DisplayModeDescriptor;
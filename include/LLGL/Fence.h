@@ -10,6 +10,7 @@
 
 
 #include <LLGL/RenderSystemChild.h>
+#include <cstdint>
 
 
 namespace LLGL
@@ -18,13 +19,31 @@ namespace LLGL
 
 /**
 \brief Fence interface for CPU/GPU synchronization.
+\remarks A fence can be used either as binary fence or as timeline fence:
+- Binary fences are signaled with CommandQueue::Submit(Fence&) and waited for with CommandQueue::WaitFence(Fence&, std::uint64_t).
+- Timeline fences hold a monotonically increasing value that is signaled with CommandQueue::Submit(Fence&, std::uint64_t)
+and waited for with CommandQueue::WaitFence(Fence&, std::uint64_t, std::uint64_t) or CommandQueue::SubmitWait(Fence&, std::uint64_t).
+\remarks The same fence object should not be used for both binary and timeline operations.
 \see RenderSystem::CreateFence
 \see CommandQueue::Submit(Fence&)
 \see CommandQueue::WaitFence
 */
 class LLGL_EXPORT Fence : public RenderSystemChild
 {
-    LLGL_DECLARE_INTERFACE( InterfaceID::Fence );
+
+        LLGL_DECLARE_INTERFACE( InterfaceID::Fence );
+
+    public:
+
+        /**
+        \brief Returns the highest timeline value the GPU has completed for this fence.
+        \remarks This value is initially zero and does not block the CPU.
+        Backends without native timeline fences (OpenGL, Direct3D 11, and Vulkan without \c VK_KHR_timeline_semaphore) emulate timelines with binary fences.
+        In that case, this function only advances to the last submitted value once the GPU has completed it.
+        \see CommandQueue::Submit(Fence&, std::uint64_t)
+        */
+        virtual std::uint64_t GetCompletedValue() = 0;
+
 };
 
 
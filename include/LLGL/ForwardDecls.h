@@ -20,6 +20,7 @@ class CommandBuffer;
 class CommandQueue;
 class Fence;
 class Image;
+class PipelineCache;
 class PipelineLayout;
 class PipelineState;
 class QueryHeap;
@@ -64,6 +65,10 @@ struct PipelineLayoutDescriptor;
 struct QueryHeapDescriptor;
 struct QueryPipelineStatistics;
 struct RasterizerDescriptor;
+struct RendererConfigurationDirect3D11;
+struct RendererConfigurationDirect3D12;
+struct RendererConfigurationMetal;
+struct RendererConfigurationNull;
 struct RendererConfigurationOpenGL;
 struct RendererConfigurationVulkan;
 struct RendererInfo;
@@ -87,6 +92,7 @@ struct SwapChainDescriptor;
 struct TextureDescriptor;
 struct TextureRegion;
 struct TextureViewDescriptor;
+struct TimestampCalibration;
 struct UniformDescriptor;
 struct VertexAttribute;
 struct VertexFormat;
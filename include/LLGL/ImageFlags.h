@@ -17,6 +17,7 @@
 #include <LLGL/Container/DynamicArray.h>
 #include <LLGL/Deprecated.h>
 #include <memory>
+#include <functional>
 #include <cstdint>
 #include <cstddef>
 
@@ -25,6 +26,25 @@ namespace LLGL
 {
 
 
+/* ----- Enumerations ----- */
+
+/**
+\brief Image compression quality enumeration.
+\see CompressImageBuffer
+*/
+enum class ImageCompressionQuality
+{
+    //! Color endpoints are the corners of the bounding box of each block. This is the fastest mode.
+    Fast,
+
+    //! Color endpoints are the extreme projections onto the principal axis of the colors of each block.
+    Normal,
+
+    //! Like Normal, but color endpoints are refined by least squares and single channel blocks try both interpolation modes. This is the slowest mode.
+    High,
+};
+
+
 /* ----- Structures ----- */
 
 /**
@@ -233,6 +253,42 @@ LLGL_EXPORT DynamicByteArray ConvertImageBuffer(
     unsigned            threadCount = 0
 );
 
+/**
+\brief Callback for a band of rows that has been converted by ConvertImageBufferBands.
+\param[in] bandImageView Specifies the image view of the converted band within the staging buffer.
+Its data remains valid until the callback returns because the next band is converted into the same staging buffer.
+\param[in] firstRow Specifies the zero-based index of the first row within this band.
+\param[in] numRows Specifies the number of rows within this band.
+\see ConvertImageBufferBands
+*/
+using ImageBandCallback = std::function<void(const MutableImageView& bandImageView, std::uint32_t firstRow, std::uint32_t numRows)>;
+
+/**
+\brief Converts the source image in bands of rows into a caller-provided staging buffer without allocating a destination image of the full size.
+\param[in] srcImageView Specifies the source image view. Its data must contain at least \c numRows rows of \c rowLength pixels each.
+\param[in] stagingImageView Specifies the destination image view for a single band of rows.
+The number of rows per band is determined by the size of this staging buffer, which must be large enough for at least one row.
+This can also point directly into mapped GPU upload memory, in which case the source image is converted into that memory in a single band.
+\param[in] rowLength Specifies the number of pixels per row.
+\param[in] numRows Specifies the total number of rows to convert. For 3D images and array layers, this is the height times the depth or number of layers.
+\param[in] bandCallback Specifies the callback that is invoked after each band has been converted. This can be null.
+\param[in] threadCount Specifies the number of threads to use for the conversion of each band (see ConvertImageBuffer for more details). By default 0.
+\return Number of bands that have been converted.
+\remarks If the source and staging image views have the same format and data type, each band is copied without conversion.
+\throw std::invalid_argument If the source buffer or the staging buffer is a null pointer.
+\throw std::invalid_argument If the source buffer is too small for the specified number of rows.
+\throw std::invalid_argument If the staging buffer is too small for a single row.
+\see ConvertImageBuffer(const ImageView&, const MutableImageView&, unsigned)
+*/
+LLGL_EXPORT std::uint32_t ConvertImageBufferBands(
+    const ImageView&            srcImageView,
+    const MutableImageView&     stagingImageView,
+    std::uint32_t               rowLength,
+    std::uint32_t               numRows,
+    const ImageBandCallback&    bandCallback    = nullptr,
+    unsigned                    threadCount     = 0
+);
+
 /**
 \brief Decompresses the specified image buffer to RGBA format with 8-bit unsigned normalized integers.
 \param[in] srcImageView Specifies the source image image.
@@ -241,6 +297,8 @@ LLGL_EXPORT DynamicByteArray ConvertImageBuffer(
 If this is less than 2, no multi-threading is used. If this is equal to \c LLGL_MAX_THREAD_COUNT,
 the maximal count of threads the system supports will be used (e.g. 4 on a quad-core processor). By default 0.
 \return Byte buffer with the decompressed image data or null if the compression format is not supported for decompression.
+\remarks Supported compression formats are ImageFormat::BC1 to ImageFormat::BC5. BC4 and BC5 are decompressed into the red and green channels.
+If the data type of \c srcImageView is DataType::Int8, BC4 and BC5 are interpreted as signed normalized and remapped to the unsigned output range.
 */
 LLGL_EXPORT DynamicByteArray DecompressImageBufferToRGBA8UNorm(
     const ImageView&    srcImageView,
@@ -248,6 +306,28 @@ LLGL_EXPORT DynamicByteArray DecompressImageBufferToRGBA8UNorm(
     unsigned            threadCount = 0
 );
 
+/**
+\brief Compresses the specified image buffer into a block compression format.
+\param[in] srcImageView Specifies the source image view. This must be an uncompressed color format; it is converted to RGBA with 8-bit unsigned normalized integers first if necessary.
+\param[in] dstFormat Specifies the destination compression format. This must be ImageFormat::BC1 to ImageFormat::BC5.
+\param[in] extent Specifies the image extent. The depth denotes the number of consecutive 2D slices, e.g. array layers, that are compressed separately.
+\param[in] quality Specifies the trade-off between compression speed and quality. By default ImageCompressionQuality::Normal.
+\param[in] threadCount Specifies the number of threads to use for compression (see DecompressImageBufferToRGBA8UNorm for more details). By default 0.
+\return Byte buffer with the compressed image data or null if the formats are not supported for compression or the source buffer is too small.
+\remarks This is used by the render systems to compress uncompressed image data that is passed to RenderSystem::CreateTexture or RenderSystem::WriteTexture
+for textures with a BC1 to BC5 format with unsigned normalized components, such as baked lightmaps. Those uploads use ImageCompressionQuality::Normal.
+Call this function explicitly to select a different quality and pass the compressed image to the render system instead.
+\remarks BC4 and BC5 are compressed from the red and red-green channels respectively. Texel alpha values below 128 are encoded as punch-through alpha for BC1.
+\see DecompressImageBufferToRGBA8UNorm
+*/
+LLGL_EXPORT DynamicByteArray CompressImageBuffer(
+    const ImageView&        srcImageView,
+    ImageFormat             dstFormat,
+    const Extent3D&         extent,
+    ImageCompressionQuality quality     = ImageCompressionQuality::Normal,
+    unsigned                threadCount = 0
+);
+
 /**
 \brief Copies an image buffer region from the source buffer to the destination buffer.
 \param[out] dstImageView Specifies the destination image view.
@@ -259,7 +339,11 @@ LLGL_EXPORT DynamicByteArray DecompressImageBufferToRGBA8UNorm(
 \param[in] srcRowStride Specifies the number of pixels for each row in the source image.
 \param[in] srcLayerStride Specifies the number of pixels for each slice in the source image.
 \param[in] extent Specifies the region extent to be copied.
+\param[in] threadCount Specifies the number of threads to use for large regions.
+If this is less than 2, no multi-threading is used. If this is equal to \c LLGL_MAX_THREAD_COUNT,
+the maximal count of threads the system supports will be used (e.g. 4 on a quad-core processor). By default 0.
 \remarks Only performs a bitwise copy. No blending or other operation is performed.
+Consecutive rows and slices are copied as a single block if the strides match the region extent.
 \throw std::invalid_argument If the destination buffer is a null pointer.
 \throw std::invalid_argument If the destination buffer size does not match the required output buffer size.
 \throw std::invalid_argument If the source buffer is a null pointer.
@@ -282,7 +366,10 @@ LLGL_EXPORT void CopyImageBufferRegion(
     std::uint32_t           srcLayerStride,
 
     // Region
-    const Extent3D&         extent
+    const Extent3D&         extent,
+
+    // Threading
+    unsigned                threadCount = 0
 );
 
 /**
@@ -124,6 +124,21 @@ struct DrawPatchIndirectArguments
     std::uint32_t firstInstance;
 };
 
+/**
+\brief Format structure for the arguments of an indirect mesh draw command.
+\remarks This structure is byte aligned, i.e. it can be reinterpret casted to a buffer in CPU memory space.
+\note This is a plain-old-data (POD) structure, so it has no default constructor to make it easily compatible with the GPU memory space.
+\see CommandBuffer::DrawMeshIndirect
+\see Vulkan counterpart \c VkDrawMeshTasksIndirectCommandEXT: https://registry.khronos.org/vulkan/specs/1.3-extensions/man/html/VkDrawMeshTasksIndirectCommandEXT.html
+\see Direct3D12 counterpart \c D3D12_DISPATCH_MESH_ARGUMENTS: https://learn.microsoft.com/en-us/windows/win32/api/d3d12/ns-d3d12-d3d12_dispatch_mesh_arguments
+\see Metal counterpart \c MTLDispatchThreadgroupsIndirectArguments: https://developer.apple.com/documentation/metal/mtldispatchthreadgroupsindirectarguments?language=objc
+*/
+struct DrawMeshIndirectArguments
+{
+    //! Number of task shader work groups in X, Y, and Z dimension, or mesh shader work groups if the pipeline has no task shader.
+    std::uint32_t numWorkGroups[3];
+};
+
 /**
 \brief Format structure for the arguments of an indirect compute command.
 \remarks This structure is byte aligned, i.e. it can be reinterpret casted to a buffer in CPU memory space.
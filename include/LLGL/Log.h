@@ -12,6 +12,7 @@
 #include <LLGL/Export.h>
 #include <LLGL/Report.h>
 #include <functional>
+#include <cstdint>
 
 
 namespace LLGL
@@ -42,6 +43,25 @@ enum class ReportType
     Error,
 };
 
+/**
+\brief Log dispatch mode enumeration.
+\see SetMode
+*/
+enum class LogMode
+{
+    /**
+    \brief Log messages are dispatched to all callbacks on the thread that generates them. This is the default mode.
+    */
+    Synchronous = 0,
+
+    /**
+    \brief Log messages are formatted on the calling thread and pushed into a lock-free queue that is drained by a background thread.
+    \remarks Log callbacks are invoked on that background thread. If the queue is full, messages are dropped and a summary of the dropped messages is posted later.
+    \see Flush
+    */
+    Asynchronous,
+};
+
 
 /* ----- Types ----- */
 
@@ -123,6 +143,36 @@ LLGL_EXPORT LogHandle RegisterCallbackStd();
 */
 LLGL_EXPORT void UnregisterCallback(LogHandle handle);
 
+/**
+\brief Sets the dispatch mode for all log messages.
+\param[in] mode Specifies the new dispatch mode. By default LogMode::Synchronous.
+\remarks Switching from LogMode::Asynchronous back to LogMode::Synchronous flushes all pending messages and stops the background thread.
+\see LogMode
+*/
+LLGL_EXPORT void SetMode(LogMode mode);
+
+/**
+\brief Returns the current dispatch mode for log messages.
+\see SetMode
+*/
+LLGL_EXPORT LogMode GetMode();
+
+/**
+\brief Blocks until all messages that have been queued before this call have been dispatched to the log callbacks.
+\remarks This has no effect in LogMode::Synchronous. Call this before reading a Report that was registered via RegisterCallbackReport while in LogMode::Asynchronous.
+*/
+LLGL_EXPORT void Flush();
+
+/**
+\brief Limits the number of log messages of the specified type that are dispatched per second.
+\param[in] type Specifies the report type whose messages are to be limited.
+\param[in] maxMessagesPerSecond Specifies the maximum number of messages per second. If this is zero, the rate limit is disabled. By default zero.
+\remarks Messages that exceed the limit are discarded before they are formatted.
+The number of discarded messages is posted as a single summary message once the next one-second interval begins.
+This is meant to keep verbose logging enabled during soak tests without distorting frame times.
+*/
+LLGL_EXPORT void SetRateLimit(ReportType type, std::uint32_t maxMessagesPerSecond);
+
 
 } // /namespace Log
 
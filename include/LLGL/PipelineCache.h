@@ -33,6 +33,11 @@ class LLGL_EXPORT PipelineCache : public RenderSystemChild
         \brief Returns the cached blob representing a pipeline state.
         \remarks This blob can be safed to file and reused to speedup PSO creation on next application launch or reused during the same application run.
         If the backend does not support pipeline caching, the return value is an empty blob.
+        With Direct3D 12, the pipeline cache is backed by a native pipeline library if the driver supports it,
+        in which case this blob contains all PSOs that have been created with this cache.
+        Otherwise, this blob contains only the PSO this cache has first been used with.
+        \see Blob::WriteToFile
+        \see Blob::CreateFromFileMapped
         */
         virtual Blob GetBlob() const = 0;
 
@@ -36,6 +36,15 @@ class LLGL_EXPORT PipelineState : public RenderSystemChild
         */
         virtual const Report* GetReport() const = 0;
 
+        /**
+        \brief Returns true if the native PSO has been compiled and can be used for rendering.
+        \remarks This only returns false while a PSO that was created with asynchronous compilation is still being compiled.
+        The default implementation always returns true.
+        \see GraphicsPipelineDescriptor::asyncCompilation
+        \see ComputePipelineDescriptor::asyncCompilation
+        */
+        virtual bool IsReady() const;
+
 };
 
 
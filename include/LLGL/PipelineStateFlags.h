@@ -288,6 +288,44 @@ struct ColorMaskFlags
     };
 };
 
+/**
+\brief Graphics pipeline dynamic state flags.
+\remarks Each flag specifies a group of pipeline states that is not baked into the PSO but must be set with the command buffer after the PSO has been bound.
+This allows a single PSO to be used for multiple render-state variants, e.g. materials that only differ in their cull mode or depth test.
+The respective members of the GraphicsPipelineDescriptor are ignored for dynamic states.
+\see GraphicsPipelineDescriptor::dynamicStates
+\see RenderingFeatures::hasExtendedDynamicState
+*/
+struct DynamicStateFlags
+{
+    enum
+    {
+        /**
+        \brief The cull mode is set dynamically. RasterizerDescriptor::cullMode is ignored.
+        \see CommandBuffer::SetCullMode
+        */
+        CullMode            = (1 << 0),
+
+        /**
+        \brief The depth test, depth write, and depth compare operation are set dynamically. DepthDescriptor is ignored.
+        \see CommandBuffer::SetDepthState
+        */
+        DepthState          = (1 << 1),
+
+        /**
+        \brief The stencil test, stencil operations, and stencil masks are set dynamically. StencilDescriptor is ignored except for the stencil reference values.
+        \see CommandBuffer::SetStencilState
+        */
+        StencilState        = (1 << 2),
+
+        /**
+        \brief The primitive topology is set dynamically. GraphicsPipelineDescriptor::primitiveTopology only determines the primitive class.
+        \see CommandBuffer::SetPrimitiveTopology
+        */
+        PrimitiveTopology   = (1 << 3),
+    };
+};
+
 
 /* ----- Structures ----- */
 
@@ -426,6 +464,37 @@ struct Scissor
     std::int32_t height  = 0; //!< Right-bottom height.
 };
 
+/**
+\brief Shader specialization constant structure.
+\remarks Specialization constants allow a single shader to be compiled into cheap variants at PSO creation time,
+e.g. to toggle features or select loop counts without creating a separate Shader object for each combination.
+In GLSL, specialization constants are declared with <code>layout(constant_id = ID) const</code>.
+\note Only supported with: Vulkan.
+\see GraphicsPipelineDescriptor::specializationConstants
+\see ComputePipelineDescriptor::specializationConstants
+*/
+struct SpecializationConstant
+{
+    SpecializationConstant() = default;
+    SpecializationConstant(const SpecializationConstant&) = default;
+
+    //! Specialization constant constructor with parameters for all attributes.
+    inline SpecializationConstant(std::uint32_t id, std::uint32_t value) :
+        id    { id    },
+        value { value }
+    {
+    }
+
+    //! Specifies the specialization constant ID, i.e. the \c constant_id layout qualifier in GLSL.
+    std::uint32_t id    = 0;
+
+    /**
+    \brief Specifies the 32-bit value of the specialization constant.
+    \remarks Signed integers and floating-point values must be passed with their bit pattern, e.g. via \c memcpy. Booleans must be either 0 or 1.
+    */
+    std::uint32_t value = 0;
+};
+
 /**
 \brief Depth state descriptor structure.
 \see GraphicsPipelineDescriptor::depth
@@ -778,10 +847,21 @@ struct GraphicsPipelineDescriptor
     */
     const RenderPass*       renderPass              = nullptr;
 
+    /**
+    \brief Specifies the zero-based index of the subpass within the render pass this graphics pipeline is used in. By default 0.
+    \remarks This must be less than the number of subpasses of \c renderPass and the graphics pipeline can only be used within that subpass.
+    If the render pass has no explicit subpasses, this must be 0.
+    \see RenderPassDescriptor::subpasses
+    \see CommandBuffer::NextSubpass
+    */
+    std::uint32_t           subpass                 = 0;
+
     /**
     \brief Specifies the vertex shader.
-    \remarks Each graphics pipeline must have at least a vertex shader. Therefore, this must never be null when a graphics PSO is created.
+    \remarks Each graphics pipeline must have at least a vertex shader or a mesh shader.
+    Therefore, this must never be null when a graphics PSO is created, unless \c meshShader is specified.
     With OpenGL, this shader may also have a stream output.
+    \see meshShader
     */
     Shader*                 vertexShader            = nullptr;
 
@@ -813,6 +893,26 @@ struct GraphicsPipelineDescriptor
     */
     Shader*                 fragmentShader          = nullptr;
 
+    /**
+    \brief Specifies an optional task shader (also referred to as "Amplification Shader" or "Object Shader").
+    \remarks If this is used, the counter part must also be specified, i.e. \c meshShader.
+    The task shader determines how many mesh shader work groups are launched for each of its work groups,
+    which allows culling and level-of-detail selection to be performed on the GPU.
+    \see meshShader
+    \see RenderingFeatures::hasMeshShaders
+    */
+    Shader*                 taskShader              = nullptr;
+
+    /**
+    \brief Specifies an optional mesh shader.
+    \remarks If this is used, the graphics pipeline does not fetch any vertices and must not specify a vertex, tessellation, or geometry shader.
+    Graphics pipelines with a mesh shader can only be used with the CommandBuffer::DrawMesh and CommandBuffer::DrawMeshIndirect commands.
+    The vertex input layout and \c primitiveTopology are ignored; the primitive type is determined by the mesh shader.
+    \see taskShader
+    \see RenderingFeatures::hasMeshShaders
+    */
+    Shader*                 meshShader              = nullptr;
+
     /**
     \brief Specifies the index buffer format. This can either be Format::Undefined, Format::R16UInt, or Format::R32UInt. By default Format::Undefined.
     \remarks For patches (PrimitiveTopology::Patches1 - PrimitiveTopology::Patches32),
@@ -868,6 +968,49 @@ struct GraphicsPipelineDescriptor
     \note Only supported with: Metal.
     */
     TessellationDescriptor  tessellation;
+
+    /**
+    \brief Specifies which pipeline states are set dynamically with the command buffer. This can be a bitwise OR combination of the DynamicStateFlags entries. By default 0.
+    \remarks Dynamic states must be set every time this PSO has been bound and before the first draw command.
+    Using dynamic states instead of PSO permutations reduces the number of PSOs and the time it takes to compile them.
+    \remarks This can only be non-zero if the rendering feature \c hasExtendedDynamicState is supported.
+    It is implemented with \c VK_EXT_extended_dynamic_state for Vulkan.
+    \note Only supported with: Vulkan.
+    \see DynamicStateFlags
+    \see RenderingFeatures::hasExtendedDynamicState
+    */
+    long                    dynamicStates           = 0;
+
+    /**
+    \brief Specifies an optional list of specialization constants that are applied to all shader stages of this PSO.
+    \remarks Constants whose IDs are not declared in a shader stage are ignored for that stage.
+    \note Only supported with: Vulkan.
+    \see SpecializationConstant
+    */
+    std::vector<SpecializationConstant> specializationConstants;
+
+    /**
+    \brief Specifies whether the native PSO is compiled asynchronously on the global thread pool. By default false.
+    \remarks If enabled, RenderSystem::CreatePipelineState returns immediately and PipelineState::IsReady can be used to query whether the compilation has finished.
+    All objects this descriptor refers to, such as shaders, pipeline layout, render pass, and pipeline cache, must be kept alive until the PSO is ready.
+    The report of the PSO is only valid once the PSO is ready.
+    Backends that do not support asynchronous compilation create the PSO synchronously.
+    OpenGL links the shader programs in the background if \c GL_KHR_parallel_shader_compile or \c GL_ARB_parallel_shader_compile is supported.
+    \note Only supported with: Direct3D 12, Vulkan, OpenGL.
+    \see PipelineState::IsReady
+    \see ThreadPool::GetGlobal
+    */
+    bool                    asyncCompilation        = false;
+
+    /**
+    \brief Specifies an optional placeholder PSO that is bound instead of this PSO until its asynchronous compilation has finished. By default null.
+    \remarks The placeholder must be compatible with this PSO, i.e. it must have been created with the same pipeline layout.
+    If this is null and the PSO is bound before its compilation has finished, CommandBuffer::SetPipelineState waits for the compilation to finish.
+    This is ignored if \c asyncCompilation is false.
+    \note Only supported with: Direct3D 12, Vulkan.
+    \see CommandBuffer::SetPipelineState
+    */
+    PipelineState*          placeholder             = nullptr;
 };
 
 /**
@@ -881,20 +1024,51 @@ struct ComputePipelineDescriptor
     \remarks The final name of the native hardware resource is implementation defined.
     \see RenderSystemChild::SetName
     */
-    const char*             debugName       = nullptr;
+    const char*             debugName           = nullptr;
 
     /**
     \brief Pointer to an optional pipeline layout for the graphics pipeline.
     \remarks This layout determines at which slots buffer resources can be bound.
     This is ignored by render systems which do not support pipeline layouts.
     */
-    const PipelineLayout*   pipelineLayout  = nullptr;
+    const PipelineLayout*   pipelineLayout      = nullptr;
 
     /**
     \brief Specifies the compute shader.
     \remarks This must never be null when a compute PSO is created.
     */
-    Shader*                 computeShader   = nullptr;
+    Shader*                 computeShader       = nullptr;
+
+    /**
+    \brief Specifies an optional list of specialization constants for the compute shader.
+    \remarks Constants whose IDs are not declared in the compute shader are ignored.
+    \note Only supported with: Vulkan.
+    \see SpecializationConstant
+    */
+    std::vector<SpecializationConstant> specializationConstants;
+
+    /**
+    \brief Specifies whether the native PSO is compiled asynchronously on the global thread pool. By default false.
+    \remarks If enabled, RenderSystem::CreatePipelineState returns immediately and PipelineState::IsReady can be used to query whether the compilation has finished.
+    All objects this descriptor refers to, such as shaders, pipeline layout, and pipeline cache, must be kept alive until the PSO is ready.
+    The report of the PSO is only valid once the PSO is ready.
+    Backends that do not support asynchronous compilation create the PSO synchronously.
+    OpenGL links the shader programs in the background if \c GL_KHR_parallel_shader_compile or \c GL_ARB_parallel_shader_compile is supported.
+    \note Only supported with: Direct3D 12, Vulkan, OpenGL.
+    \see PipelineState::IsReady
+    \see ThreadPool::GetGlobal
+    */
+    bool                    asyncCompilation    = false;
+
+    /**
+    \brief Specifies an optional placeholder PSO that is bound instead of this PSO until its asynchronous compilation has finished. By default null.
+    \remarks The placeholder must be compatible with this PSO, i.e. it must have been created with the same pipeline layout.
+    If this is null and the PSO is bound before its compilation has finished, CommandBuffer::SetPipelineState waits for the compilation to finish.
+    This is ignored if \c asyncCompilation is false.
+    \note Only supported with: Direct3D 12, Vulkan.
+    \see CommandBuffer::SetPipelineState
+    */
+    PipelineState*          placeholder         = nullptr;
 };
 
 
@@ -0,0 +1,85 @@
+/*
+ * ProfileZone.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_PROFILE_ZONE_H
+#define LLGL_PROFILE_ZONE_H
+
+
+#include <LLGL/Export.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Static source location of a CPU profile zone inside LLGL.
+\remarks Each zone has a unique location object with static storage duration, so its address can be used as identifier.
+The memory layout is equivalent to the source location structure of the Tracy profiler's C API (\c ___tracy_source_location_data),
+so a pointer to this structure can be passed on to Tracy directly.
+\see ProfileZoneCallbacks
+*/
+struct ProfileZoneLocation
+{
+    //! Name of the zone, e.g. "Submit". This is never null.
+    const char*     name;
+
+    //! Name of the function that contains this zone.
+    const char*     function;
+
+    //! Source file that contains this zone.
+    const char*     file;
+
+    //! Line number in the source file.
+    std::uint32_t   line;
+
+    //! Color hint for the zone in RGB format. Zero by default, i.e. the profiler picks a color.
+    std::uint32_t   color;
+};
+
+/**
+\brief Callback interface for CPU profile zones that LLGL emits in backend hot paths, e.g. command queue submission, swap-chain presentation,
+render pass begin, descriptor flushes, pipeline state creation, and resource uploads.
+\remarks This allows to forward LLGL's CPU cost to an external profiler such as Tracy or Perfetto.
+Both callbacks are called on the thread that enters and leaves the zone. Zones of the same thread are always properly nested.
+\note Profile zones are only emitted if LLGL was built with the \c LLGL_ENABLE_PROFILE_ZONES option.
+\see SetProfileZoneCallbacks
+*/
+struct ProfileZoneCallbacks
+{
+    /**
+    \brief Callback when a profile zone is entered.
+    \return Custom token that is passed to the \c endZone callback, e.g. the context of a Tracy zone.
+    */
+    std::uint64_t   (*beginZone)(const ProfileZoneLocation& location, void* userData)                   = nullptr;
+
+    //! Callback when a profile zone is left.
+    void            (*endZone)(const ProfileZoneLocation& location, std::uint64_t token, void* userData) = nullptr;
+
+    //! Optional user data that is passed to both callbacks.
+    void*           userData                                                                            = nullptr;
+};
+
+/**
+\brief Sets the callbacks for CPU profile zones or disables them if \c callbacks is null.
+\remarks This should be called before any render system is loaded. Zones that are already entered when the callbacks change
+are left with the callbacks that were set when they were entered.
+\note Profile zones are only emitted if LLGL was built with the \c LLGL_ENABLE_PROFILE_ZONES option; otherwise this function has no effect.
+\see ProfileZoneCallbacks
+*/
+LLGL_EXPORT void SetProfileZoneCallbacks(const ProfileZoneCallbacks* callbacks);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -49,6 +49,15 @@ enum class QueryType
     \see RenderingFeatures::hasPipelineStatistics
     */
     PipelineStatistics,
+
+    /**
+    \brief GPU timestamp (in nanoseconds) when all previously submitted commands have been completed.
+    \remarks The timestamp is written by CommandBuffer::EndQuery only, i.e. CommandBuffer::BeginQuery must not be called for this query type.
+    The timestamps are in the time domain of the GPU. Use CommandQueue::QueryTimestampCalibration to convert them into the time domain of Timer::Tick.
+    \see TimestampCalibration
+    \see RenderingFeatures::hasTimestampCalibration
+    */
+    Timestamp,
 };
 
 
@@ -100,6 +109,33 @@ struct QueryPipelineStatistics
     std::uint64_t computeShaderInvocations          = 0;
 };
 
+/**
+\brief Pair of correlated CPU and GPU timestamps that were sampled at the same time.
+\remarks This is used to map GPU timestamps of QueryType::Timestamp into the timeline of the CPU, e.g. to measure the latency between submitting a command buffer and its execution on the GPU:
+\code
+LLGL::TimestampCalibration calibration;
+if (myCmdQueue->QueryTimestampCalibration(calibration))
+{
+    const std::int64_t  gpuDeltaNanosecs    = static_cast<std::int64_t>(myGPUTimestamp - calibration.gpuTimestamp);
+    const double        cpuTimeOfGPUEvent   = static_cast<double>(calibration.cpuTick) + static_cast<double>(gpuDeltaNanosecs) * LLGL::Timer::Frequency() / 1.0e9;
+}
+\endcode
+\remarks Since the CPU and GPU clocks can drift apart, the calibration should be queried again periodically, e.g. once per second.
+\see CommandQueue::QueryTimestampCalibration
+\see QueryType::Timestamp
+*/
+struct TimestampCalibration
+{
+    //! CPU timestamp in the time domain of Timer::Tick.
+    std::uint64_t cpuTick       = 0;
+
+    //! GPU timestamp (in nanoseconds) in the same time domain as the results of QueryType::Timestamp.
+    std::uint64_t gpuTimestamp  = 0;
+
+    //! Maximum deviation (in nanoseconds) between the sampling points of the CPU and GPU timestamps. Zero if unknown.
+    std::uint64_t maxDeviation  = 0;
+};
+
 /**
 \brief Query heap descriptor structure.
 \see RenderSystem::CreateQueryHeap
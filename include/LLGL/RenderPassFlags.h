@@ -11,6 +11,8 @@
 
 #include <LLGL/Format.h>
 #include <LLGL/Constants.h>
+#include <LLGL/Container/ArrayView.h>
+#include <cstdint>
 
 
 namespace LLGL
@@ -48,6 +50,7 @@ enum class AttachmentStoreOp
     /**
     \brief We don't care about the outcome of the respective render target attachment.
     \remarks Can be used, for example, if we only need the depth buffer for the depth test, but nothing is written to it.
+    On tile-based GPUs, this avoids writing the attachment back from tile memory. With OpenGL, such attachments are invalidated via \c glInvalidateFramebuffer when the render pass ends.
     */
     Undefined,
 
@@ -105,6 +108,44 @@ struct AttachmentFormatDescriptor
     AttachmentStoreOp       storeOp = AttachmentStoreOp::Undefined;
 };
 
+/**
+\brief Render subpass descriptor structure.
+\remarks A subpass selects which attachments of its render pass are rendered into and which color attachments are read back as input attachments.
+Input attachments allow a subpass to read the outcome of a previous subpass at the same pixel location,
+which keeps the content in tile memory on tile-based GPUs instead of storing it to memory and sampling it in the next render pass (e.g. the G-buffer for deferred shading).
+In a Vulkan fragment shader, the input attachment index refers to the color attachment index (e.g. <code>layout(input_attachment_index = 0) uniform subpassInput gbuffer0</code>).
+With Metal and OpenGL ES, input attachments are read via framebuffer fetch
+(<code>[[color(N)]]</code> in Metal and \c GL_EXT_shader_framebuffer_fetch in GLSL) and the entire render pass is a single native render pass.
+Hence, all color attachments remain bound through all subpasses on these backends.
+\see RenderPassDescriptor::subpasses
+\see RenderingFeatures::hasSubpasses
+*/
+struct SubpassDescriptor
+{
+    /**
+    \brief Specifies the bitmask of color attachments this subpass renders into. By default ~0u, i.e. all color attachments.
+    \remarks The least significant bit refers to the first color attachment, i.e. <code>RenderPassDescriptor::colorAttachments[0]</code>.
+    Fragment shader outputs keep referring to the color attachment indices, so a subpass that only renders into the third color attachment must write its result to fragment output location 2.
+    */
+    std::uint32_t   colorAttachmentMask     = ~0u;
+
+    /**
+    \brief Specifies the bitmask of color attachments this subpass reads as input attachments. By default 0.
+    \remarks The least significant bit refers to the first color attachment, i.e. <code>RenderPassDescriptor::colorAttachments[0]</code>.
+    A color attachment must not be rendered into and read as input attachment in the same subpass,
+    i.e. <code>(colorAttachmentMask & inputAttachmentMask)</code> must be zero for the enabled color attachments.
+    The respective textures must have been created with the BindFlags::InputAttachment binding flag.
+    \see BindFlags::InputAttachment
+    */
+    std::uint32_t   inputAttachmentMask     = 0;
+
+    /**
+    \brief Specifies whether this subpass uses the depth-stencil attachment of its render pass. By default true.
+    \remarks This is ignored if the render pass has no depth or stencil attachment.
+    */
+    bool            depthStencilAttachment  = true;
+};
+
 /**
 \brief Render pass descriptor structure.
 \remarks A render pass object can be used across multiple render targets.
@@ -159,6 +200,19 @@ struct RenderPassDescriptor
     \see RenderingLimits::maxNoAttachmentSamples
     */
     std::uint32_t               samples             = 1;
+
+    /**
+    \brief Specifies the subpasses of this render pass. By default empty.
+    \remarks If this is empty, the render pass has a single subpass that renders into all of its attachments.
+    Subpasses are processed in order and CommandBuffer::NextSubpass must be called to advance to the next one before the render pass ends.
+    Each graphics pipeline must be created for the subpass it is used in (see GraphicsPipelineDescriptor::subpass).
+    Render targets that are used with a render pass that has more than one subpass must be created with that render pass (see RenderTargetDescriptor::renderPass).
+    \note Multiple subpasses are only supported if RenderingFeatures::hasSubpasses is true.
+    \see SubpassDescriptor
+    \see CommandBuffer::NextSubpass
+    \see RenderingFeatures::hasSubpasses
+    */
+    ArrayView<SubpassDescriptor> subpasses;
 };
 
 
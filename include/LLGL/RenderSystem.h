@@ -121,6 +121,10 @@ renderSystem->WriteBuffer(*buffer, modificationData, ...);
 // Release object
 renderSystem->Release(*buffer);
 \endcode
+\remarks Unless stated otherwise, the functions of this interface must not be called concurrently.
+The Vulkan and Null backends allow CreateShader, CreatePipelineState, and the respective Release functions to be called concurrently from multiple threads,
+e.g. to compile PSOs on loader threads. This does not apply if the render system was loaded with a RenderingDebugger,
+since the debug layer does not synchronize its validation. All other objects a PSO is created with must not be released while the PSO is being created.
 */
 class LLGL_EXPORT RenderSystem : public Interface
 {
@@ -201,6 +205,8 @@ class LLGL_EXPORT RenderSystem : public Interface
         \brief Returns the rendering capabilities.
         \remarks The validity of these information is only guaranteed if this function is called
         after a valid swap-chain has been created. Otherwise the behavior is undefined!
+        \remarks Some backends only query their capabilities the first time this function is called to reduce the startup time of the render system.
+        For the OpenGL backend, this requires the GL context to be current on the calling thread.
         */
         const RenderingCapabilities& GetRenderingCaps() const;
 
@@ -221,6 +227,7 @@ class LLGL_EXPORT RenderSystem : public Interface
         \param[in] surface Optional shared pointer to a surface for the swap-chain.
         If this is null, the swap-chain will create its own platform specific surface, which can be accessed by SwapChain::GetSurface.
         The default surface on desktop platforms (i.e. Window interface) is not shown automatically, i.e. the Window::Show function has to be invoked to show the surface.
+        \return Pointer to the new swap-chain or null if the render system was created in headless mode (see RenderSystemFlags::Headless).
         \see SwapChain::GetSurface
         \see Window::Show
         */
@@ -234,9 +241,24 @@ class LLGL_EXPORT RenderSystem : public Interface
 
         /* ----- Command queues ----- */
 
-        //! Returns the single instance of the command queue.
+        //! Returns the primary command queue. This queue supports graphics, compute, and copy commands.
         virtual CommandQueue* GetCommandQueue() = 0;
 
+        /**
+        \brief Returns a command queue for the specified type of work.
+        \param[in] queueFlags Specifies the type of command queue. This can be a bitwise OR combination of the CommandQueueFlags entries.
+        If this contains CommandQueueFlags::Graphics, the primary command queue is returned.
+        \return Pointer to the command queue or the primary command queue if the backend does not support a dedicated queue for the specified type.
+        This is never null, but consecutive calls with different flags may return the same object.
+        \remarks Command queues other than the primary one allow compute and copy passes to overlap with graphics work on the GPU.
+        Use CommandQueue::SubmitWait to synchronize between queues.
+        Command buffers must be created for the command queue they are submitted to (see CommandBufferDescriptor::commandQueue).
+        The returned object is owned by the render system and must not be released.
+        \see CommandQueueFlags
+        \see CommandQueue::SubmitWait
+        */
+        virtual CommandQueue* GetCommandQueue(long queueFlags) = 0;
+
         /* ----- Command buffers ----- */
 
         /**
@@ -244,6 +266,8 @@ class LLGL_EXPORT RenderSystem : public Interface
         \param[in] commandBufferDesc Specifies an optional command buffer descriptor.
         \remarks Each render system can create multiple command buffers,
         but especially the legacy graphics APIs such as OpenGL and Direct3D 11 don't provide a performance benefit with that feature.
+        \remarks Applications that encode transient command buffers for each job should allocate them from a CommandBufferPool instead of creating and releasing them every frame.
+        \see CommandBufferPool
         */
         virtual CommandBuffer* CreateCommandBuffer(const CommandBufferDescriptor& commandBufferDesc = {}) = 0;
 
@@ -294,7 +318,9 @@ class LLGL_EXPORT RenderSystem : public Interface
         \param[in] data Raw pointer to the data with which the buffer is to be updated. This must not be null!
         \param[in] dataSize Specifies the size (in bytes) of the data block which is to be updated.
         This must be less then or equal to the size of the buffer.
-        \remarks To update a small buffer (maximum of 65536 bytes) during encoding a command buffer, use CommandBuffer::UpdateBuffer.
+        \remarks To update a buffer during encoding a command buffer, use CommandBuffer::UpdateBuffer.
+        \remarks For the Direct3D 11 backend, this function can also be called from worker threads.
+        Such updates are recorded into deferred contexts and become visible on the GPU once the thread that created the render system submits its next command buffer or reads back a resource.
         \see ReadBuffer
         */
         virtual void WriteBuffer(Buffer& buffer, std::uint64_t offset, const void* data, std::uint64_t dataSize) = 0;
@@ -329,6 +355,8 @@ class LLGL_EXPORT RenderSystem : public Interface
         \param[in] length Specifies the length of the memory block (in bytes) that is to be mapped.
         \return Raw pointer to the mapped memory block in CPU memory space or null if the operation failed.
         \remarks Memory that is written back from CPU to GPU becomes visible in the GPU after a corresponding UnmapBuffer operation.
+        \remarks If the buffer was created with MiscFlags::PersistentMapping, the returned pointer is always the persistent memory address of the buffer plus \c offset,
+        and only the range <code>[offset, offset + length)</code> is made visible to the GPU by UnmapBuffer.
         \see UnmapBuffer
         */
         virtual void* MapBuffer(Buffer& buffer, const CPUAccess access, std::uint64_t offset, std::uint64_t length) = 0;
@@ -370,6 +398,7 @@ class LLGL_EXPORT RenderSystem : public Interface
         \param[in] textureRegion Specifies the region where the texture is to be updated. The field TextureRegion::numMipLevels \b must be 1.
         \param[in] srcImageView Specifies the source image view. Its \c data member must not be null!
         \remarks This function can only be used for non-multi-sample textures, i.e. from types other than TextureType::Texture2DMS and TextureType::Texture2DMSArray.
+        \remarks For the Direct3D 11 backend, this function can also be called from worker threads (see WriteBuffer).
         */
         virtual void WriteTexture(Texture& texture, const TextureRegion& textureRegion, const ImageView& srcImageView) = 0;
 
@@ -411,6 +440,9 @@ class LLGL_EXPORT RenderSystem : public Interface
 
         /**
         \brief Creates a new Sampler object.
+        \remarks Samplers with identical descriptors, except for their debug names, share the same reference counted instance.
+        This function can therefore return the same object multiple times, but each returned object must still be released with its own call to Release.
+        The debug name of a shared instance is determined by the descriptor it was first created with.
         \throws std::runtime_error If the renderer does not support Sampler objects (e.g. if OpenGL 3.1 or lower is used).
         \see GetRenderingCaps
         */
@@ -491,9 +523,24 @@ class LLGL_EXPORT RenderSystem : public Interface
         \see Shader::GetReport
         \see ShaderDescriptor
         \see ShaderDescFromFile
+        \remarks The Vulkan and Null backends allow this function to be called concurrently from multiple threads (see RenderSystem).
         */
         virtual Shader* CreateShader(const ShaderDescriptor& shaderDesc) = 0;
 
+        /**
+        \brief Creates a batch of new Shader objects and compiles their sources concurrently where the backend allows it.
+        \param[in] shaderDescs Specifies the array of shader descriptors.
+        \param[out] outShaders Pointer to an array of at least <code>shaderDescs.size()</code> entries that receives the new shaders, one for each descriptor in the same order.
+        An entry is null if the respective shader could not be created because an exception was thrown.
+        \return Number of shaders that were compiled without errors. To query the diagnostics of each shader, use its \c GetReport function.
+        \remarks The Direct3D 11, Direct3D 12, Metal, and Vulkan backends distribute the shaders over the global thread pool (see ThreadPool::GetGlobal),
+        so the calling thread blocks until all shaders have been processed. All other backends create the shaders sequentially like CreateShader.
+        \remarks If the creation of any shader throws an exception, the first such exception is re-thrown after all other shaders have been processed.
+        \see CreateShader
+        \see Shader::GetReport
+        */
+        virtual std::uint32_t CreateShaders(const ArrayView<ShaderDescriptor>& shaderDescs, Shader** outShaders) = 0;
+
         //! Releases the specified Shader object. After this call, the specified object must no longer be used.
         virtual void Release(Shader& shader) = 0;
 
@@ -505,6 +552,9 @@ class LLGL_EXPORT RenderSystem : public Interface
         \remarks A pipeline layout is required in combination with a ResourceHeap to bind multiple resources at once.
         For modern graphics APIs (i.e. Direct3D 12 and Vulkan), this is only way to bind shader resources.
         For legacy graphics APIs (i.e. Direct3D 11 and OpenGL), shader resources can also be bound individually with the extended command buffer.
+        \remarks Pipeline layouts with identical descriptors, except for their debug names, share the same reference counted instance.
+        This function can therefore return the same object multiple times, but each returned object must still be released with its own call to Release.
+        The debug name of a shared instance is determined by the descriptor it was first created with.
         \return Pointer to the new PipelineLayout object or null if the renderer does not support pipeline layouts.
         \see CreateResourceHeap
         \see Parse
@@ -545,6 +595,8 @@ class LLGL_EXPORT RenderSystem : public Interface
 
         \param[out] pipelineCache Optional pointer to pipeline cache.
 
+        \remarks The Vulkan and Null backends allow this function to be called concurrently from multiple threads (see RenderSystem).
+
         \see GraphicsPipelineDescriptor
         \see CreatePipelineState(const Blob&)
         */
@@ -558,6 +610,8 @@ class LLGL_EXPORT RenderSystem : public Interface
 
         \param[out] pipelineCache Optional pointer to pipeline cache.
 
+        \remarks The Vulkan and Null backends allow this function to be called concurrently from multiple threads (see RenderSystem).
+
         \see ComputePipelineDescriptor
         \see CreatePipelineState(const Blob&)
         */
@@ -626,6 +680,157 @@ class LLGL_EXPORT RenderSystem : public Interface
         */
         virtual bool GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize) = 0;
 
+        /**
+        \brief Queries the budget and usage of the device memory heaps.
+
+        \param[out] outHeapInfos Optional pointer to an array of at least \c maxNumHeaps entries that receive the heap information.
+        \param[in] maxNumHeaps Specifies the maximum number of entries to be written to \c outHeapInfos.
+
+        \return Number of memory heaps of the device. If this is greater than \c maxNumHeaps, only the first \c maxNumHeaps entries have been written.
+
+        \remarks Call this function with \c outHeapInfos being null to query the number of memory heaps first.
+        \remarks For the Vulkan backend, the heap budget is queried via \c VK_EXT_memory_budget if the extension is available.
+        To be notified when an allocation exceeds a heap's budget, see RendererConfigurationVulkan::memoryBudgetCallback.
+
+        \note Only supported with: Vulkan. All other backends return 0.
+
+        \see MemoryHeapInfo
+        */
+        virtual std::uint32_t QueryMemoryHeaps(MemoryHeapInfo* outHeapInfos, std::uint32_t maxNumHeaps) = 0;
+
+        /**
+        \brief Returns the stable index of the specified resource in the global descriptor table for bindless access.
+
+        \param[in] resource Specifies the buffer, texture, or sampler whose descriptor index is to be returned.
+        \param[in] bindFlags Specifies which view of the resource the index refers to.
+        This must be BindFlags::ConstantBuffer, BindFlags::Sampled, or BindFlags::Storage for buffers and BindFlags::Sampled or BindFlags::Storage for textures.
+        This is ignored for samplers.
+
+        \return Index of the resource view in the global descriptor table of the backend, or LLGL_INVALID_SLOT if the resource has no such view or bindless mode is disabled:
+        - Direct3D 12: Index into \c ResourceDescriptorHeap (or \c SamplerDescriptorHeap for samplers) in HLSL Shader Model 6.6.
+        - Vulkan: Index into the runtime descriptor array of the bindless descriptor set binding that corresponds to the view (see RendererConfigurationVulkan::enableBindlessDescriptors).
+        - Metal: Index into the bindless resource table (or sampler table for samplers). Both views of a texture or buffer share the same index.
+
+        \remarks The resource must have been created with the respective binding flag, e.g. BindFlags::Sampled for a shader resource view.
+        The view always covers the entire resource.
+        \remarks The index is valid until the resource is released.
+        Pass it to the shader via uniforms, i.e. root constants, or a constant buffer.
+        Whether bindless mode is enabled can be determined with RenderingFeatures::hasBindlessDescriptors.
+
+        \note Only supported with: Direct3D 12, Vulkan, Metal. Bindless mode must be enabled with the renderer configuration of the backend.
+        All other backends return LLGL_INVALID_SLOT.
+
+        \see RendererConfigurationDirect3D12::enableBindlessDescriptors
+        \see RendererConfigurationVulkan::enableBindlessDescriptors
+        \see RendererConfigurationMetal::enableBindlessDescriptors
+        */
+        virtual std::uint32_t GetBindlessDescriptorIndex(const Resource& resource, long bindFlags = 0) = 0;
+
+        /**
+        \brief Queries the tile layout of the specified sparse texture.
+
+        \param[in] texture Specifies the texture whose tile layout is to be queried. This must have been created with the MiscFlags::Sparse flag.
+        \param[out] outProperties Specifies the output parameter for the tile layout.
+
+        \return True on success, or false if the texture is not a sparse texture or sparse textures are not supported.
+
+        \note Only supported with: Direct3D 12, Vulkan.
+
+        \see MiscFlags::Sparse
+        \see CommitTextureTiles
+        */
+        virtual bool GetSparseTextureProperties(const Texture& texture, SparseTextureProperties& outProperties) = 0;
+
+        /**
+        \brief Commits or releases the device memory for all tiles of a sparse texture that are covered by the specified region.
+
+        \param[in] texture Specifies the texture whose tiles are to be committed or released. This must have been created with the MiscFlags::Sparse flag.
+        \param[in] textureRegion Specifies the region (in texels) of a single MIP-map level and a range of array layers.
+        Its offset must be aligned to SparseTextureProperties::tileExtent and its extent must be aligned to it as well, unless it ends at the border of the MIP-map level.
+        MIP-map levels of the packed MIP-map tail cannot be committed or released since they are always resident.
+        \param[in] commit Specifies whether to commit the tiles (true) or to release them (false).
+        Committing tiles that are already committed and releasing tiles that are not committed has no effect.
+
+        \return True on success, or false if the texture is not a sparse texture or the device memory for the tiles could not be allocated.
+
+        \remarks The tile mapping is updated on the graphics command queue, i.e. command buffers submitted after this call observe the new mapping.
+        The content of newly committed tiles is undefined until it is written, e.g. with RenderSystem::WriteTexture.
+        Released tiles must not be accessed by command buffers that are still pending execution.
+
+        \note Only supported with: Direct3D 12, Vulkan.
+
+        \see MiscFlags::Sparse
+        \see GetSparseTextureProperties
+        */
+        virtual bool CommitTextureTiles(Texture& texture, const TextureRegion& textureRegion, bool commit) = 0;
+
+        /**
+        \brief Makes the specified resources resident in device memory again after they have been evicted.
+
+        \param[in] resources Specifies the buffers and textures that are to be made resident. Samplers and null pointers are ignored.
+
+        \return True on success, or false if at least one resource could not be made resident, e.g. because the device is out of memory,
+        or if the content of at least one resource has been discarded while it was evicted. In this case, the content of the resources must be written again.
+
+        \remarks Resources must be resident before they are accessed by command buffers that are submitted after this call.
+        Making resources resident that are already resident has no effect.
+        \remarks For the Direct3D 12 backend, this blocks until the resources are resident (see \c ID3D12Device::MakeResident).
+        For the Vulkan backend, this restores the priority of the resources that was set with Resource::SetResidencyPriority.
+        For the Metal backend, this makes the resources non-volatile and reports whether their content has been discarded.
+
+        \note Only supported with: Direct3D 12, Vulkan, Metal. All other backends let the driver manage residency and return true.
+
+        \see Evict
+        \see Resource::SetResidencyPriority
+        */
+        virtual bool MakeResident(const ArrayView<Resource*>& resources) = 0;
+
+        /**
+        \brief Allows the specified resources to be evicted from device memory, e.g. when they are not used for a while.
+
+        \param[in] resources Specifies the buffers and textures that are to be evicted. Samplers and null pointers are ignored.
+
+        \remarks Evicted resources must not be accessed by command buffers until they have been made resident again with MakeResident.
+        Resources must not be evicted while command buffers that access them are still pending execution.
+        \remarks For the Direct3D 12 backend, the content of the resources is preserved (see \c ID3D12Device::Evict).
+        For the Vulkan backend, the priority of the device memory of the resources is lowered to the minimum via \c VK_EXT_pageable_device_local_memory.
+        For the Metal backend, the resources are made volatile, i.e. the system may discard their content (see \c MTLPurgeableStateVolatile).
+
+        \note Only supported with: Direct3D 12, Vulkan, Metal. All other backends let the driver manage residency and have no effect.
+
+        \see MakeResident
+        */
+        virtual void Evict(const ArrayView<Resource*>& resources) = 0;
+
+        /**
+        \brief Queries the memory requirements to build a ray tracing acceleration structure.
+
+        \param[in] buildDesc Specifies the descriptor of the build. Only the type, flags, number of instances, and the formats and counts of the triangle geometry are considered.
+        \param[out] outSizes Specifies the output parameter for the sizes of the acceleration structure and the scratch buffers.
+
+        \return True on success, or false if ray tracing is not supported.
+
+        \note Only supported with: Direct3D 12, Vulkan.
+
+        \see CommandBuffer::BuildAccelerationStructure
+        \see RenderingFeatures::hasRayTracing
+        */
+        virtual bool GetAccelerationStructureSizes(const AccelerationStructureBuildDescriptor& buildDesc, AccelerationStructureSizes& outSizes) = 0;
+
+        /**
+        \brief Returns the device address of the specified acceleration structure for AccelerationStructureInstance::blasAddress.
+
+        \param[in] buffer Specifies the buffer that holds a bottom-level acceleration structure. This must have been created with the BindFlags::AccelerationStructure flag.
+
+        \return Device address of the acceleration structure, or 0 if ray tracing is not supported.
+
+        \note Only supported with: Direct3D 12, Vulkan.
+
+        \see AccelerationStructureInstance
+        \see RenderingFeatures::hasRayTracing
+        */
+        virtual std::uint64_t GetAccelerationStructureAddress(const Buffer& buffer) = 0;
+
     protected:
 
         //! Allocates the internal data.
@@ -647,6 +852,21 @@ class LLGL_EXPORT RenderSystem : public Interface
         //! Sets the rendering capabilities.
         void SetRenderingCaps(const RenderingCapabilities& caps);
 
+        /**
+        \brief Defers the query of the rendering capabilities until they are requested for the first time.
+        \remarks This invalidates the current rendering capabilities, so QueryDeferredRenderingCaps is invoked on the next call to GetRenderingCaps.
+        A subsequent call to SetRenderingCaps cancels the deferred query.
+        \see QueryDeferredRenderingCaps
+        */
+        void DeferRenderingCaps();
+
+        /**
+        \brief Queries the rendering capabilities that have been deferred by DeferRenderingCaps.
+        \remarks This is invoked by GetRenderingCaps at most once after each call to DeferRenderingCaps. The default implementation does nothing.
+        \see DeferRenderingCaps
+        */
+        virtual void QueryDeferredRenderingCaps(RenderingCapabilities& outCaps);
+
     protected:
 
         //! Validates the specified buffer descriptor to be used for buffer creation.
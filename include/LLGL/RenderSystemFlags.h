@@ -33,6 +33,7 @@ namespace LLGL
 
 
 class RenderingDebugger;
+class ShaderCache;
 
 /* ----- Enumerations ----- */
 
@@ -212,6 +213,39 @@ struct RenderSystemFlags
 
         //! \see PreferNVIDIA
         PreferIntel     = (1 << 3),
+
+        /**
+        \brief Specifies that the debug layer only records the frame profile without validating any arguments.
+        \remarks This is only effective if a rendering debugger is specified (see RenderSystemDescriptor::debugger).
+        In this mode, only swap-chains, command queues, and command buffers are wrapped by the debug layer,
+        so the counters of ProfileCommandBufferRecord and ProfileCommandQueueRecord and the time records are available with low overhead.
+        Command buffers accumulate their counters locally and only merge them into the frame profile when they are submitted.
+        \see RenderingDebugger::FlushProfile
+        */
+        ProfileOnly     = (1 << 4),
+
+        /**
+        \brief Specifies that the render system is created without any display connection for offscreen rendering.
+        \remarks In this mode, the render system is fully initialized without a swap-chain and RenderSystem::CreateSwapChain always fails.
+        Rendering is done into render targets and the results can be read back with ReadbackBufferPool.
+        \remarks For Vulkan, no surface instance extensions are enabled and \c VK_KHR_swapchain is no longer required for the physical device.
+        For OpenGL, the GL context is created with EGL either surfaceless or with a placeholder pbuffer on GNU/Linux, if the backend was built with \c LLGL_GL_ENABLE_EGL_HEADLESS.
+        Otherwise, OpenGL still creates its context on a hidden placeholder window. RendererConfigurationOpenGL::asyncUploads is ignored in this mode.
+        The other backends do not require a surface to create their devices, so they ignore this flag.
+        \note Only supported with: OpenGL, Vulkan.
+        */
+        Headless        = (1 << 5),
+
+        /**
+        \brief Specifies that the profile-only debug layer also tracks all objects, so single frames can be captured into a file.
+        \remarks This is only effective if a rendering debugger is specified (see RenderSystemDescriptor::debugger) and implies RenderSystemFlags::ProfileOnly.
+        The descriptors of all objects are serialized when they are created, and shaders that are loaded from files are embedded into their records.
+        A capture is requested with RenderingDebugger::CaptureFrame and replayed with FrameCapturePlayer.
+        \note Query heaps, fences, buffer arrays, and pipeline caches are not captured.
+        \see RenderingDebugger::CaptureFrame
+        \see FrameCapturePlayer
+        */
+        FrameCapture    = (1 << 6),
     };
 };
 
@@ -276,6 +310,34 @@ struct RendererInfo
     std::vector<char>           pipelineCacheID;
 };
 
+/**
+\brief Memory heap information structure.
+\see RenderSystem::QueryMemoryHeaps
+*/
+struct MemoryHeapInfo
+{
+    //! Total size (in bytes) of the memory heap.
+    std::uint64_t   size         = 0;
+
+    /**
+    \brief Estimated number of bytes the application can allocate from this heap without a performance penalty.
+    \remarks If the backend cannot query the budget from the driver, this is an approximation derived from the heap size.
+    */
+    std::uint64_t   budget       = 0;
+
+    //! Number of bytes currently allocated by the application from this heap.
+    std::uint64_t   usage        = 0;
+
+    /**
+    \brief Number of bytes of \c usage that are currently held by transient staging memory of the backend, e.g. for buffer and texture uploads.
+    \remarks This is only reported by the Vulkan backend at the moment.
+    */
+    std::uint64_t   stagingUsage = 0;
+
+    //! Specifies whether this heap resides in device local memory, i.e. in VRAM on a discrete GPU.
+    bool            deviceLocal  = false;
+};
+
 /**
 \brief Render system descriptor structure.
 \remarks This can be used for some refinements of a specific renderer, e.g. to configure the Vulkan device memory manager.
@@ -317,6 +379,18 @@ struct RenderSystemDescriptor
     */
     long                flags               = 0;
 
+    /**
+    \brief Specifies the zero-based index of the video adapter the render system is to be created on. By default \c 0xFFFFFFFF.
+    \remarks If this is \c 0xFFFFFFFF, the adapter is selected by the RenderSystemFlags::PreferNVIDIA, RenderSystemFlags::PreferAMD, and RenderSystemFlags::PreferIntel hints.
+    Otherwise, these hints are ignored and RenderSystem::Load fails if there is no suitable adapter with this index.
+    This can be used on multi-GPU systems to load one render system per adapter, e.g. for split-frame or alternate-frame rendering.
+    Adapters can be enumerated by loading render systems with increasing indices until RenderSystem::Load fails.
+    \remarks Resources cannot be shared between render systems, but buffers can be copied from one render system to another with CopyBufferAcrossRenderSystems.
+    \note Only supported with: Direct3D 11, Direct3D 12, Vulkan.
+    \see CopyBufferAcrossRenderSystems
+    */
+    std::uint32_t       adapterIndex        = ~0u;
+
     //! \deprecated Since 0.04b; Use LLGL::RenderSystemDescriptor::debugger instead!
     void*               profiler            = nullptr;
 
@@ -327,6 +401,15 @@ struct RenderSystemDescriptor
     */
     RenderingDebugger*  debugger            = nullptr;
 
+    /**
+    \brief Optional pointer to a content-addressed cache for the binaries of shaders that are compiled from source code. By default null.
+    \remarks If this is specified, RenderSystem::CreateShader loads the shader binary from this cache instead of invoking the shader compiler whenever possible,
+    and stores each newly compiled shader binary in this cache. The cache must remain valid for the lifetime of the render system.
+    \see ShaderCache
+    \see FileShaderCache
+    */
+    ShaderCache*        shaderCache         = nullptr;
+
     /**
     \brief Optional raw pointer to a renderer specific configuration structure.
     \remarks This can be used to pass some refinement configurations to the render system when the module is loaded.
@@ -347,8 +430,12 @@ struct RenderSystemDescriptor
     \endcode
     \see rendererConfigSize
     \see RendererConfigurationVulkan
+    \see RendererConfigurationDirect3D11
+    \see RendererConfigurationDirect3D12
+    \see RendererConfigurationMetal
     \see RendererConfigurationOpenGL
     \see RendererConfigurationOpenGLES3
+    \see RendererConfigurationNull
     */
     const void*         rendererConfig      = nullptr;
 
@@ -583,6 +670,27 @@ struct RenderingFeatures
     */
     bool hasComputeShaders              = false;
 
+    /**
+    \brief Specifies whether mesh shaders and task shaders are supported.
+    \remarks This is supported by Direct3D 12 with mesh shader tier 1, by Vulkan with VK_EXT_mesh_shader, and by Metal with the Metal 3 GPU family.
+    \note Only supported with: Direct3D 12, Vulkan, Metal.
+    \see ShaderType::Task
+    \see ShaderType::Mesh
+    \see CommandBuffer::DrawMesh
+    \see CommandBuffer::DrawMeshIndirect
+    */
+    bool hasMeshShaders                 = false;
+
+    /**
+    \brief Specifies whether hardware ray tracing with acceleration structures and inline ray queries is supported.
+    \remarks This is supported by Direct3D 12 with raytracing tier 1.1 and by Vulkan with VK_KHR_acceleration_structure and VK_KHR_ray_query.
+    Shaders can trace rays with \c RayQuery in HLSL and \c rayQueryEXT in GLSL.
+    \note Only supported with: Direct3D 12, Vulkan.
+    \see BindFlags::AccelerationStructure
+    \see CommandBuffer::BuildAccelerationStructure
+    */
+    bool hasRayTracing                  = false;
+
     /**
     \brief Specifies whether hardware instancing is supported.
     \see CommandBuffer::DrawInstanced(std::uint32_t, std::uint32_t, std::uint32_t)
@@ -605,6 +713,14 @@ struct RenderingFeatures
     */
     bool hasIndirectDrawing             = false;
 
+    /**
+    \brief Specifies whether indirect draw commands can take the number of draw commands from a GPU buffer.
+    \remarks This is supported by Direct3D 12, by Vulkan with VK_KHR_draw_indirect_count or version 1.2, and by OpenGL with GL_ARB_indirect_parameters.
+    \see CommandBuffer::DrawIndirect(Buffer&, std::uint64_t, Buffer&, std::uint64_t, std::uint32_t, std::uint32_t)
+    \see CommandBuffer::DrawIndexedIndirect(Buffer&, std::uint64_t, Buffer&, std::uint64_t, std::uint32_t, std::uint32_t)
+    */
+    bool hasIndirectDrawCount           = false;
+
     /**
     \brief Specifies whether multiple viewports, depth-ranges, and scissors at once are supported.
     \see RenderingLimits::maxViewports
@@ -652,6 +768,62 @@ struct RenderingFeatures
     \see CommandBuffer:BeginRenderCondition
     */
     bool hasRenderCondition             = false;
+
+    /**
+    \brief Specifies whether conditional rendering with predicate values from buffers is supported.
+    \see CommandBuffer:BeginRenderCondition(Buffer&, std::uint64_t, const RenderConditionMode)
+    */
+    bool hasBufferRenderCondition       = false;
+
+    /**
+    \brief Specifies whether resources have stable indices into a global descriptor table for bindless access.
+    \remarks This is only true if bindless mode was enabled with the renderer configuration and is supported by the device.
+    \see RenderSystem::GetBindlessDescriptorIndex
+    */
+    bool hasBindlessDescriptors         = false;
+
+    /**
+    \brief Specifies whether sparse textures are supported, i.e. textures whose memory is committed tile by tile.
+    \remarks This includes shader queries of tile residency, i.e. \c CheckAccessFullyMapped in HLSL and \c sparseTexelsResidentARB in GLSL.
+    \see MiscFlags::Sparse
+    \see RenderSystem::CommitTextureTiles
+    */
+    bool hasSparseTextures              = false;
+
+    /**
+    \brief Specifies whether variable rate shading with a per-draw shading rate is supported.
+    \remarks This is supported by Direct3D 12 with variable rate shading tier 1 and by Vulkan with VK_KHR_fragment_shading_rate.
+    \note Only supported with: Direct3D 12, Vulkan.
+    \see CommandBuffer::SetShadingRate
+    */
+    bool hasVariableRateShading         = false;
+
+    /**
+    \brief Specifies whether graphics pipelines can be created with dynamic cull mode, depth, stencil, and primitive topology states.
+    \remarks This is supported by Vulkan with VK_EXT_extended_dynamic_state.
+    \note Only supported with: Vulkan.
+    \see GraphicsPipelineDescriptor::dynamicStates
+    */
+    bool hasExtendedDynamicState        = false;
+
+    /**
+    \brief Specifies whether timestamp queries and the calibration of CPU and GPU timestamps are supported.
+    \remarks This is supported by Vulkan with VK_EXT_calibrated_timestamps if the device and host clocks of Timer::Tick can be calibrated.
+    \note Only supported with: OpenGL, Vulkan, Direct3D 12, Null.
+    \see QueryType::Timestamp
+    \see CommandQueue::QueryTimestampCalibration
+    */
+    bool hasTimestampCalibration        = false;
+
+    /**
+    \brief Specifies whether render passes with multiple subpasses and input attachments are supported.
+    \remarks On tile-based GPUs, this allows subpasses to read the outcome of previous subpasses from tile memory.
+    With Vulkan, this is not supported if dynamic rendering is enabled.
+    With Metal and OpenGL ES, this requires framebuffer fetch support.
+    \see RenderPassDescriptor::subpasses
+    \see CommandBuffer::NextSubpass
+    */
+    bool hasSubpasses                   = false;
 };
 
 /**
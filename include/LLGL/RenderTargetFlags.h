@@ -154,6 +154,9 @@ struct RenderTargetDescriptor
     \remarks Each attachment descriptor describes a multi-sampled resolve target for the corresponding color attachment.
     \remarks For each attachment, for which a texture is specified, this texture must have 1 sample,
     must have the same size as specified by RenderTargetDescriptor::resolution, and must have been created with the binding flag BindFlags::ColorAttachment.
+    \remarks On OpenGLES with \c GL_EXT_multisampled_render_to_texture, the render target is resolved implicitly at the end of each render pass
+    if all color attachments have no texture and are resolved into 2D textures, and the depth-stencil attachment has no texture either.
+    In this case, the multi-sampled data never leaves the tile memory of the GPU.
     */
     AttachmentDescriptor    resolveAttachments[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
 
@@ -10,6 +10,7 @@
 
 
 #include <LLGL/Container/ArrayView.h>
+#include <LLGL/RenderingDebuggerFlags.h>
 #include <cstdint>
 
 
@@ -17,6 +18,9 @@ namespace LLGL
 {
 
 
+struct MemoryHeapInfo;
+
+
 /* ----- Enumerations ----- */
 
 /**
@@ -41,6 +45,15 @@ enum class OpenGLContextProfile
 
 /* ----- Structures ----- */
 
+/**
+\brief Callback interface for Vulkan device memory budget alerts.
+\param[in] heapIndex Specifies the index of the Vulkan memory heap whose usage has exceeded the alert threshold.
+\param[in] heapInfo Specifies the current budget and usage of that memory heap.
+\param[in] userData Specifies the user data pointer from RendererConfigurationVulkan::memoryBudgetUserData.
+\see RendererConfigurationVulkan::memoryBudgetCallback
+*/
+using VulkanMemoryBudgetCallback = void (*)(std::uint32_t heapIndex, const MemoryHeapInfo& heapInfo, void* userData);
+
 /**
 \brief Application descriptor structure.
 \note Only supported with: Vulkan.
@@ -97,6 +110,208 @@ struct RendererConfigurationVulkan
     \todo Remove this as soon as Vulkan memory manage has been improved.
     */
     bool                        reduceDeviceMemoryFragmentation = false;
+
+    /**
+    \brief Minimal size (in bytes) of buffers and images to get their own device memory allocation. By default 32*1024*1024, i.e. 32 MB.
+    \remarks Dedicated allocations keep large resources such as render targets out of the shared device memory chunks.
+    Resources for which the driver prefers or requires a dedicated allocation always get one, regardless of their size.
+    \remarks This requires the Vulkan extensions \c VK_KHR_get_memory_requirements2 and \c VK_KHR_dedicated_allocation. Otherwise, this member is ignored.
+    */
+    std::uint64_t               dedicatedAllocationThreshold    = 32*1024*1024;
+
+    /**
+    \brief Callback that is invoked when the usage of a device memory heap exceeds the fraction \c memoryBudgetAlertThreshold of its budget. By default null.
+    \remarks This can be used to reduce memory consumption, e.g. by lowering the resolution of streamed textures, before the driver starts paging device memory.
+    The callback is invoked only once per heap until its usage has dropped below the threshold again.
+    It is invoked when a new device memory chunk is allocated or released, i.e. while a resource is being created or released.
+    Therefore, no resources must be created or released from within the callback.
+    \remarks The heap budget is queried via \c VK_EXT_memory_budget if the extension is available. Otherwise, it is approximated by 80% of the heap size.
+    \see RenderSystem::QueryMemoryHeaps
+    */
+    VulkanMemoryBudgetCallback  memoryBudgetCallback            = nullptr;
+
+    //! User data pointer that is passed to \c memoryBudgetCallback. By default null.
+    void*                       memoryBudgetUserData            = nullptr;
+
+    //! Fraction of a device memory heap's budget at which \c memoryBudgetCallback is invoked. By default 0.9.
+    float                       memoryBudgetAlertThreshold      = 0.9f;
+
+    /**
+    \brief Maximum number of bytes that are moved by incremental device memory defragmentation per frame. By default 0, i.e. defragmentation is disabled.
+    \remarks If enabled, buffers are moved out of sparsely used device memory chunks into other chunks each time a swap-chain is presented, so the emptied chunks can be released.
+    The GPU copies are recorded into the internal upload batch and executed before the next submitted command buffer. At least one buffer is moved per frame, even if it is larger than this budget.
+    \remarks Only buffers that are bound exclusively as vertex, index, or indirect argument buffers and without CPU access or MiscFlags::DynamicUsage are moved. Textures are never moved.
+    \remarks Command buffers that were recorded before a buffer has been moved still refer to its previous native handle.
+    Therefore, only enable this if command buffers are re-recorded every frame, i.e. not with CommandBufferFlags::MultiSubmit or secondary command buffers that are reused across frames.
+    */
+    std::uint64_t               defragmentationBytesPerFrame    = 0;
+
+    /**
+    \brief Specifies whether dynamic resource bindings (i.e. PipelineLayoutDescriptor::bindings) are written with push descriptors. By default false.
+    \remarks If enabled, the descriptors set with CommandBuffer::SetResource are recorded directly into the command buffer,
+    instead of being written into a descriptor set that is allocated from a descriptor pool for each draw or dispatch command.
+    \remarks This requires the Vulkan extension \c VK_KHR_push_descriptor and is only used for pipeline layouts with at most 32 dynamic descriptors,
+    which is the minimum limit of push descriptors guaranteed by the Vulkan specification. Otherwise, this member is ignored.
+    */
+    bool                        enablePushDescriptors           = false;
+
+    /**
+    \brief Specifies whether render passes are recorded with dynamic rendering instead of native render pass and framebuffer objects. By default false.
+    \remarks If enabled, no \c VkRenderPass and \c VkFramebuffer objects are created for render targets, swap-chains, and render passes.
+    Instead, CommandBuffer::BeginRenderPass records the attachments of the render target directly into the command buffer
+    and graphics pipelines are created with the attachment formats of their render pass.
+    This reduces the cost of creating render targets when they change frequently, e.g. for dynamic resolution or per-light shadow maps.
+    \remarks This requires a Vulkan 1.2 device with the extension \c VK_KHR_dynamic_rendering. Otherwise, this member is ignored.
+    */
+    bool                        enableDynamicRendering          = false;
+
+    /**
+    \brief Specifies whether resources get stable indices into a global descriptor set for bindless access. By default false.
+    \remarks If enabled, a descriptor is written into a global descriptor set with runtime-sized arrays when a buffer, texture, or sampler is created.
+    Its index is stable for the lifetime of the resource and can be queried with RenderSystem::GetBindlessDescriptorIndex.
+    This descriptor set is appended to every pipeline layout, i.e. shaders must declare it with the set index that follows all descriptor sets of the pipeline layout
+    (heap bindings, dynamic bindings, and static samplers; each only if present), e.g. <code>layout(set = 0)</code> for a pipeline layout that only has uniforms.
+    The uniform block for uniforms that are not part of a push-constant block then follows the bindless descriptor set.
+    \remarks The bindless descriptor set has the following bindings:
+    - Binding 0: Sampled images, e.g. <code>uniform texture2D textures[]</code>.
+    - Binding 1: Storage images, e.g. <code>uniform image2D images[]</code>.
+    - Binding 2: Storage buffers for buffers with the BindFlags::Sampled or BindFlags::Storage flag.
+    - Binding 3: Uniform buffers (only if the device supports updating uniform buffer descriptors after they have been bound).
+    - Binding 4: Samplers, e.g. <code>uniform sampler samplers[]</code>.
+    \remarks Accesses through the bindless descriptor set are not tracked by the backend.
+    Sampled images are written with layout \c VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL and storage images with \c VK_IMAGE_LAYOUT_GENERAL,
+    so textures must be bound in the respective way at least once (or transitioned otherwise) before they are accessed through this descriptor set.
+    \remarks This requires a Vulkan 1.2 device or the extension \c VK_EXT_descriptor_indexing with support for partially bound runtime descriptor arrays. Otherwise, this member is ignored.
+    */
+    bool                        enableBindlessDescriptors       = false;
+
+    /**
+    \brief Maximum number of descriptors with stable indices per descriptor type in bindless mode. By default 65536.
+    \remarks This is clamped to the limits of the device.
+    \see enableBindlessDescriptors
+    */
+    std::uint32_t               numBindlessDescriptors          = 65536;
+
+    /**
+    \brief Maximum number of sampler descriptors with stable indices in bindless mode. By default 512.
+    \remarks This is clamped to the limits of the device.
+    \see enableBindlessDescriptors
+    */
+    std::uint32_t               numBindlessSamplers             = 512;
+};
+
+/**
+\brief Structure for a Direct3D 11 renderer specific configuration.
+\see RendererConfigurationVulkan
+*/
+struct RendererConfigurationDirect3D11
+{
+    /**
+    \brief Specifies whether swap-chains use the flip presentation model (\c DXGI_SWAP_EFFECT_FLIP_DISCARD) with tearing support. By default true.
+    \remarks The flip model avoids an extra copy by the desktop window manager (DWM) and allows presenting with tearing on variable refresh rate displays when V-sync is disabled.
+    This is only used if the DXGI factory supports tearing (i.e. \c DXGI_FEATURE_PRESENT_ALLOW_TEARING on Windows 10 and later). Otherwise, swap-chains fall back to the legacy blit model.
+    \remarks Since flip-model swap-chains cannot be multi-sampled, a separate multi-sampled color buffer is rendered into and resolved into the back buffer on SwapChain::Present.
+    */
+    bool enableFlipModel = true;
+
+    /**
+    \brief Specifies whether the immediate device context is protected against concurrent access from multiple threads. By default false.
+    \remarks If this is true, the D3D11 backend enables the multi-thread protection of the immediate context (\c ID3D10Multithread::SetMultithreadProtected),
+    so different swap-chains can be presented from different threads. This adds a lock to every call into the immediate context.
+    \see SwapChain::Present
+    */
+    bool enableMultiThreadProtection = false;
+};
+
+/**
+\brief Structure for a Direct3D 12 renderer specific configuration.
+\see RendererConfigurationVulkan
+*/
+struct RendererConfigurationDirect3D12
+{
+    /**
+    \brief Specifies whether resources get stable indices into a single shader-visible descriptor heap. By default false.
+    \remarks If enabled, a descriptor is created in the shader-visible CBV/SRV/UAV or sampler heap when a buffer, texture, or sampler is created.
+    Its index is stable for the lifetime of the resource and can be queried with RenderSystem::GetBindlessDescriptorIndex,
+    so shaders can access the resource via \c ResourceDescriptorHeap and \c SamplerDescriptorHeap (HLSL Shader Model 6.6) without any per-draw descriptor copies.
+    \remarks The descriptor tables for CommandBuffer::SetResource and CommandBuffer::SetResourceHeap are then sub-allocated from the same heaps,
+    so bindless and regular bindings can be mixed within the same draw or dispatch command.
+    \remarks This requires a device with resource binding tier 3 and Shader Model 6.6. Otherwise, this member is ignored.
+    */
+    bool            enableBindlessDescriptors   = false;
+
+    /**
+    \brief Maximum number of resource descriptors with stable indices in bindless mode. By default 262144.
+    \remarks The remainder of the shader-visible CBV/SRV/UAV heap (1000000 descriptors) is used for the descriptor tables of command buffers.
+    \see enableBindlessDescriptors
+    */
+    std::uint32_t   numBindlessDescriptors      = 262144;
+
+    /**
+    \brief Maximum number of sampler descriptors with stable indices in bindless mode. By default 512.
+    \remarks The remainder of the shader-visible sampler heap (2048 descriptors) is used for the descriptor tables of command buffers.
+    \see enableBindlessDescriptors
+    */
+    std::uint32_t   numBindlessSamplers         = 512;
+};
+
+/**
+\brief Structure for a Metal renderer specific configuration.
+\see RendererConfigurationVulkan
+*/
+struct RendererConfigurationMetal
+{
+    /**
+    \brief Specifies whether resource heaps are encoded into Metal argument buffers. By default false.
+    \remarks If enabled, the resource views of each descriptor set of a ResourceHeap are encoded into an argument buffer once when the heap is written,
+    and CommandBuffer::SetResourceHeap only binds this argument buffer to the buffer slot \c argumentBufferSlot of each affected shader stage.
+    Shaders must then declare the heap bindings as a single argument buffer structure with one member per entry in PipelineLayoutDescriptor::heapBindings,
+    where the \c [[id(N)]] attribute of each member is the index of that entry.
+    \remarks This requires a device with argument buffers tier 2 (macOS 10.13 or iOS 11). Otherwise, this member is ignored.
+    */
+    bool            enableArgumentBuffers           = false;
+
+    /**
+    \brief Specifies the buffer slot the argument buffers of resource heaps are bound to. By default 30.
+    \remarks This slot must not overlap with any vertex buffer or individual buffer binding.
+    \see enableArgumentBuffers
+    */
+    std::uint32_t   argumentBufferSlot              = 30;
+
+    /**
+    \brief Specifies whether runs of draw commands in multi-submit command buffers are compiled into Metal indirect command buffers. By default false.
+    \remarks If enabled, consecutive draw commands between two state changes in a command buffer with the CommandBufferFlags::MultiSubmit flag
+    are encoded into an \c MTLIndirectCommandBuffer once when the command buffer is encoded. Each submission then executes these draws
+    with a single \c executeCommandsInBuffer command instead of replaying them one by one.
+    The draws inherit the pipeline state and all bound buffers and textures from the render command encoder.
+    \remarks This requires a device with support for indirect command buffers (macOS 10.14 or iOS 13). Otherwise, this member is ignored.
+    \see CommandBufferFlags::MultiSubmit
+    */
+    bool            enableIndirectCommandBuffers    = false;
+
+    /**
+    \brief Specifies whether resources get stable indices into a global resource table for bindless access. By default false.
+    \remarks If enabled, the GPU handle of each buffer, texture, and sampler is written into a global table when the resource is created.
+    Its index is stable for the lifetime of the resource and can be queried with RenderSystem::GetBindlessDescriptorIndex.
+    Each entry is 8 bytes wide, i.e. the \c gpuAddress of a buffer or the \c gpuResourceID of a texture or sampler.
+    The table of buffers and textures is bound to the buffer slot \c bindlessBufferSlot and the table of samplers to the next slot of every command encoder,
+    so shaders can declare them as arrays of resources in argument buffers. All resources in these tables are made resident for each command encoder.
+    \remarks This requires a device of the Metal 3 GPU family (macOS 13 or iOS 16). Otherwise, this member is ignored.
+    */
+    bool            enableBindlessDescriptors       = false;
+
+    /**
+    \brief Specifies the buffer slot of the bindless resource table. The sampler table is bound to the next slot. By default 28.
+    \remarks These slots must not overlap with any vertex buffer, individual buffer binding, or \c argumentBufferSlot.
+    \see enableBindlessDescriptors
+    */
+    std::uint32_t   bindlessBufferSlot              = 28;
+
+    //! Maximum number of buffers and textures with stable indices in bindless mode. By default 65536. \see enableBindlessDescriptors
+    std::uint32_t   numBindlessDescriptors          = 65536;
+
+    //! Maximum number of samplers with stable indices in bindless mode. By default 512. \see enableBindlessDescriptors
+    std::uint32_t   numBindlessSamplers             = 512;
 };
 
 /**
@@ -128,6 +343,28 @@ struct RendererConfigurationOpenGL
     the repesctive extension and procedure name is printed to standard error output.
     */
     bool                    suppressFailedExtensions    = false;
+
+    /**
+    \brief Specifies whether large texture and buffer uploads are transferred on a worker thread. By default false.
+    \remarks If this is true, the OpenGL backend creates an additional GL context that shares its objects with the primary context.
+    RenderSystem::WriteTexture, RenderSystem::WriteBuffer, and RenderSystem::CreateTexture with initial image data then hand their data over to the worker thread,
+    which uploads it through a pixel buffer object and signals the main context with a sync object once the transfer has been submitted.
+    The uploads are visible to all command buffers that are submitted (or begin recording, for immediate command buffers) after the respective write function returned.
+    \remarks This is only supported on Windows and GNU/Linux and requires the \c GL_ARB_sync and \c GL_ARB_copy_buffer extensions. Otherwise, this member is ignored.
+    */
+    bool                    asyncUploads                = false;
+
+    /**
+    \brief Specifies whether each swap-chain gets its own GL context. By default false.
+    \remarks If this is false, swap-chains with the same pixel format share a single GL context, which can only be current on one thread at a time.
+    If this is true, each swap-chain after the first one creates its own GL context that shares its objects with the primary context (i.e. the context of the first swap-chain).
+    Such a context is only current on the creating thread during construction, so the swap-chain can then be rendered into and presented on a separate thread, e.g. one thread per window for multi-monitor setups.
+    \remarks The current GL context is tracked per thread. Each thread must use its own command buffer and only begin render passes on swap-chains that are not used by any other thread.
+    Creating resources while other threads render is only safe as long as the resources are not used before the creating thread has submitted its commands.
+    \remarks If this is true, \c asyncUploads is ignored.
+    \see SwapChain::Present
+    */
+    bool                    contextPerSwapChain         = false;
 };
 
 /**
@@ -143,6 +380,73 @@ struct RendererConfigurationOpenGLES3
     int minorVersion = 0;
 };
 
+/**
+\brief Per-frame statistics of the Null renderer in benchmark mode.
+\see RendererConfigurationNull::frameCallback
+*/
+struct NullFrameStatistics
+{
+    /**
+    \brief Counters of all commands that were encoded and submitted since the previous frame.
+    \remarks ProfileCommandBufferRecord::stateChanges counts all viewport, scissor, vertex and index buffer, resource, pipeline state, blend factor, stencil reference, and uniform changes.
+    FrameProfile::timeRecords is always empty.
+    */
+    FrameProfile    profile;
+
+    //! Number of bytes that were passed to CommandBuffer::UpdateBuffer, CommandBuffer::SetUniforms, RenderSystem::WriteBuffer, and RenderSystem::WriteTexture.
+    std::uint64_t   uploadedBytes   = 0;
+
+    //! Number of bytes of encoded commands that were submitted to the command queue.
+    std::uint64_t   submittedBytes  = 0;
+
+    //! CPU time (in nanoseconds) that has elapsed since the previous frame, including the fake latencies.
+    std::uint64_t   frameTime       = 0;
+};
+
+/**
+\brief Callback interface for the per-frame statistics of the Null renderer.
+\param[in] statistics Specifies the statistics of the frame that has just been presented.
+\param[in] userData Specifies the user data pointer from RendererConfigurationNull::frameUserData.
+\see RendererConfigurationNull::frameCallback
+*/
+using NullFrameCallback = void (*)(const NullFrameStatistics& statistics, void* userData);
+
+/**
+\brief Structure for a Null renderer specific configuration.
+\remarks The Null renderer does not validate any input. It can be used in benchmark mode to profile the CPU overhead of an application's command submission without a GPU.
+*/
+struct RendererConfigurationNull
+{
+    /**
+    \brief Specifies whether the Null renderer counts commands, state changes, and uploaded bytes per frame. By default false.
+    \remarks If enabled, the statistics are passed to \c frameCallback every time SwapChain::Present is called.
+    Command buffers contribute their counters when they are submitted to the command queue.
+    \see NullFrameStatistics
+    */
+    bool                enableBenchmark = false;
+
+    /**
+    \brief Specifies a fake latency (in microseconds) that every command buffer submission blocks the calling thread. By default 0.
+    \remarks This can be used to simulate the driver overhead of CommandQueue::Submit.
+    */
+    std::uint32_t       submitLatency   = 0;
+
+    /**
+    \brief Specifies a fake latency (in microseconds) that every call to SwapChain::Present blocks the calling thread. By default 0.
+    \remarks This can be used to simulate a fixed GPU frame time.
+    */
+    std::uint32_t       presentLatency  = 0;
+
+    /**
+    \brief Specifies an optional callback that receives the statistics of each frame. By default null.
+    \remarks This is only used if \c enableBenchmark is true.
+    */
+    NullFrameCallback   frameCallback   = nullptr;
+
+    //! Specifies the user data pointer that is passed to \c frameCallback. By default null.
+    void*               frameUserData   = nullptr;
+};
+
 
 } // /namespace LLGL
 
@@ -59,6 +59,64 @@ class LLGL_EXPORT RenderingDebugger
         //! \retrun Returns whether time recording is enabled.
         bool GetTimeRecording() const;
 
+        /**
+        \brief Enables or disables pass recording.
+        \remarks If enabled, each render pass and debug group is wrapped into elapsed time and pipeline statistics queries.
+        The queries are resolved without stalls once they are available, so the pass records are delivered in a later frame profile.
+        \note While pass recording is enabled, the client must not encode its own queries of type QueryType::TimeElapsed or QueryType::PipelineStatistics
+        inside render passes or debug groups, since some backends do not allow nested queries of the same type.
+        \see FrameProfile::passRecords
+        */
+        void SetPassRecording(bool enabled);
+
+        //! Returns whether pass recording is enabled.
+        bool GetPassRecording() const;
+
+        /**
+        \brief Specifies how often command buffers are validated.
+        \param[in] interval Specifies that only every N-th frame or command buffer encoding is validated. Values of 0 and 1 validate all command buffers, which is the default.
+        \param[in] perCommandBuffer Specifies whether the interval counts command buffer encodings instead of frames. By default false.
+        If the interval counts frames, all command buffers that are encoded within a sampled frame are validated, where each call to SwapChain::Present begins a new frame.
+        \remarks This reduces the CPU overhead of the debug layer, so applications can run with validation at close to native frame rates.
+        Command buffers that are not sampled are forwarded to the renderer without validation, but their profile counters are still recorded.
+        Validation outside of command buffer encoding, such as resource creation and command queue operations, is not affected by sampling.
+        The decision is made in CommandBuffer::Begin, so a change only takes effect with the next encoding.
+        */
+        void SetValidationSampling(std::uint32_t interval, bool perCommandBuffer = false);
+
+        //! Returns the validation sampling interval. This is 1 if all command buffers are validated.
+        std::uint32_t GetValidationSamplingInterval() const;
+
+        //! Returns whether the validation sampling interval counts command buffer encodings instead of frames.
+        bool IsValidationSampledPerCommandBuffer() const;
+
+        /**
+        \brief Requests a capture of the next frame into the specified file, or cancels a pending request if \c filename is null.
+        \remarks The capture starts with the next call to SwapChain::Present and ends with the one after that.
+        At the beginning of the capture, all live buffers and textures are read back, so this causes a one-time stall.
+        The request is cleared once the capture has started.
+        \note This is only effective if the render system was loaded with RenderSystemFlags::FrameCapture.
+        \see FrameCapturePlayer
+        */
+        void CaptureFrame(const char* filename);
+
+        //! Returns the filename of the pending frame capture request or null if there is none.
+        const char* GetFrameCaptureRequest() const;
+
+        /**
+        \brief Requests the pipeline manifest to be written into the specified file, or cancels a pending request if \c filename is null.
+        \remarks The manifest is written with the next call to SwapChain::Present. It contains the descriptors of all PSOs that have been created so far,
+        including the ones that have already been released, along with their shaders, pipeline layouts, and render passes.
+        Shaders with identical descriptors and source code are only stored once. The request is cleared once the manifest has been written.
+        \note This is only effective if the render system was loaded with RenderSystemFlags::FrameCapture.
+        PSOs that refer to the implicit render pass of a render target cannot be restored from the manifest.
+        \see WarmUpPipelines
+        */
+        void SavePipelineManifest(const char* filename);
+
+        //! Returns the filename of the pending pipeline manifest request or null if there is none.
+        const char* GetPipelineManifestRequest() const;
+
         /**
         \brief Posts an error message.
         \param[in] type Specifies the type of error.
@@ -102,6 +160,18 @@ class LLGL_EXPORT RenderingDebugger
         */
         static void MergeProfiles(FrameProfile& dst, const FrameProfile& src);
 
+        /**
+        \brief Writes the time records of the specified frame profile in the Chrome Trace Event Format.
+        \param[in] profile Specifies the frame profile whose time records are to be written.
+        \return JSON string that can be loaded in \c chrome://tracing or Perfetto.
+        \remarks Each command buffer submission is written as one thread of the CPU process with the encoding timestamps.
+        The GPU process has a single queue thread whose timeline is reconstructed from the elapsed GPU times in submission order,
+        since only elapsed time queries are available across all backends.
+        \see FrameProfile::timeRecords
+        \see https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU
+        */
+        static UTF8String WriteChromeTrace(const FrameProfile& profile);
+
     protected:
 
         /**
@@ -11,6 +11,7 @@
 
 #include <LLGL/Export.h>
 #include <LLGL/Deprecated.h>
+#include <LLGL/QueryHeapFlags.h>
 #include <LLGL/Container/DynamicVector.h>
 #include <cstdint>
 
@@ -44,15 +45,72 @@ enum class WarningType
 
 /**
 \brief Structure with annotation and elapsed time for a timer profile.
+\remarks Time records form a hierarchy in the order they were encoded: each debug group (see CommandBuffer::PushDebugGroup) has its own record,
+followed by the records of all commands and nested debug groups within that group, which have a greater \c depth value.
 \see FrameProfile::timeRecords
 */
 struct ProfileTimeRecord
 {
-    //! Time record annotation, e.g. function name that was recorded from the CommandBuffer.
-    const char*     annotation  = "";
+    //! Time record annotation, e.g. function name that was recorded from the CommandBuffer or the name of a debug group.
+    const char*     annotation      = "";
 
-    //! Elapsed time (in nanoseconds) to execute the respective command.
-    std::uint64_t   elapsedTime = 0;
+    /**
+    \brief Elapsed GPU time (in nanoseconds) to execute the respective command.
+    \remarks For debug groups, this is the sum of the elapsed GPU time of all commands within that group.
+    */
+    std::uint64_t   elapsedTime     = 0;
+
+    /**
+    \brief CPU timestamp (in nanoseconds) when the respective command or debug group was encoded.
+    \remarks This is derived from Timer::Tick and is only meaningful relative to other CPU timestamps.
+    */
+    std::uint64_t   cpuTimestamp    = 0;
+
+    //! Elapsed CPU time (in nanoseconds) to encode the respective command or all commands within a debug group.
+    std::uint64_t   cpuElapsedTime  = 0;
+
+    //! Nesting level of debug groups this record is enclosed by. Zero for records outside of any debug group.
+    std::uint32_t   depth           = 0;
+
+    //! Zero-based index of the command buffer submission of the current frame this record belongs to.
+    std::uint32_t   commandBuffer   = 0;
+};
+
+/**
+\brief Structure with elapsed GPU time and pipeline statistics of a render pass or debug group.
+\remarks Pass records are gathered from queries that the debug layer inserts around each render pass (see CommandBuffer::BeginRenderPass)
+and each debug group (see CommandBuffer::PushDebugGroup) if pass recording is enabled.
+These queries are resolved without stalling the CPU, so pass records are delivered in the frame profile of a later frame (see \c frameLatency).
+\see FrameProfile::passRecords
+\see RenderingDebugger::SetPassRecording
+*/
+struct ProfilePassRecord
+{
+    //! Name of the debug group or \c "RenderPass" for render passes.
+    const char*             annotation          = "";
+
+    /**
+    \brief Elapsed GPU time (in nanoseconds) to execute this pass, including all nested passes.
+    \remarks If time recording is enabled as well, this is the sum of the elapsed GPU time of all commands within this pass.
+    \see RenderingDebugger::SetTimeRecording
+    */
+    std::uint64_t           elapsedTime         = 0;
+
+    /**
+    \brief Pipeline statistics of this pass, including all nested passes.
+    \remarks This is zero-initialized if pipeline statistics are not supported.
+    \see RenderingFeatures::hasPipelineStatistics
+    */
+    QueryPipelineStatistics pipelineStatistics;
+
+    //! Nesting level of passes this record is enclosed by. Zero for passes outside of any other pass.
+    std::uint32_t           depth               = 0;
+
+    //! Zero-based index of the command buffer submission of the frame this pass was submitted in.
+    std::uint32_t           commandBuffer       = 0;
+
+    //! Number of frames between the submission of this pass and the frame profile this record is delivered in.
+    std::uint32_t           frameLatency        = 0;
 };
 
 struct ProfileCommandQueueRecord
@@ -257,6 +315,75 @@ struct ProfileCommandBufferRecord
     \see CommandBuffer::Dispatch
     */
     std::uint32_t dispatchCommands          = 0;
+
+    /**
+    \brief Counter for all state changes that were issued to the rendering API.
+    \remarks This is only supported by the OpenGL backend at the moment, where it counts state changes, bindings, and multi-bind calls that passed the state cache.
+    \see redundantStateChanges
+    */
+    std::uint32_t stateChanges              = 0;
+
+    /**
+    \brief Counter for all state changes that were omitted because the state was already set.
+    \remarks This is only supported by the OpenGL backend at the moment.
+    The ratio between this counter and \c stateChanges can be used to verify the effectiveness of the internal state cache.
+    \see stateChanges
+    */
+    std::uint32_t redundantStateChanges     = 0;
+};
+
+/**
+\brief Structure with memory transfer and memory usage statistics of a frame profile.
+\remarks The transfer counters are accumulated over all frames that are merged into a profile,
+whereas the usage values are snapshots that are taken when a frame is presented and merged by their maximum, i.e. peak value.
+\see FrameProfile::memoryRecord
+*/
+struct ProfileMemoryRecord
+{
+    /**
+    \brief Number of bytes that were uploaded from CPU to GPU memory.
+    \remarks This includes initial data of new buffers and textures, buffer and texture writes,
+    buffer mappings with write access, and command buffer updates.
+    \see RenderSystem::WriteBuffer
+    \see RenderSystem::WriteTexture
+    \see CommandBuffer::UpdateBuffer
+    */
+    std::uint64_t uploadedBytes             = 0;
+
+    /**
+    \brief Number of bytes that were read back from GPU to CPU memory.
+    \remarks This includes buffer and texture reads and buffer mappings with read access.
+    \see RenderSystem::ReadBuffer
+    \see RenderSystem::ReadTexture
+    */
+    std::uint64_t readbackBytes             = 0;
+
+    /**
+    \brief Peak number of bytes that were held by transient staging memory of the backend.
+    \remarks This is the sum of MemoryHeapInfo::stagingUsage of all memory heaps and is zero if the backend does not report memory heaps.
+    \see RenderSystem::QueryMemoryHeaps
+    */
+    std::uint64_t stagingMemoryUsage        = 0;
+
+    /**
+    \brief Peak number of bytes that were allocated from device local memory heaps.
+    \see MemoryHeapInfo::deviceLocal
+    */
+    std::uint64_t deviceMemoryUsage         = 0;
+
+    //! Peak number of bytes that were allocated from memory heaps that are not device local.
+    std::uint64_t hostMemoryUsage           = 0;
+
+    /**
+    \brief Number of LLGL-internal heap allocations, e.g. growing containers and command buffer memory.
+    \remarks This is process wide and includes allocations from all threads. A frame that reaches a steady state should report zero allocations.
+    \see GetAllocatorStatistics
+    \see SetAllocator
+    */
+    std::uint64_t heapAllocations           = 0;
+
+    //! Number of bytes of LLGL-internal heap allocations.
+    std::uint64_t heapAllocatedBytes        = 0;
 };
 
 /**
@@ -269,7 +396,9 @@ struct FrameProfile
     inline FrameProfile() :
         commandQueueRecord  {},
         commandBufferRecord {},
-        timeRecords         {}
+        memoryRecord        {},
+        timeRecords         {},
+        passRecords         {}
     {
     }
 
@@ -277,7 +406,9 @@ struct FrameProfile
     inline FrameProfile(const FrameProfile& rhs) :
         commandQueueRecord  { rhs.commandQueueRecord  },
         commandBufferRecord { rhs.commandBufferRecord },
-        timeRecords         { rhs.timeRecords         }
+        memoryRecord        { rhs.memoryRecord        },
+        timeRecords         { rhs.timeRecords         },
+        passRecords         { rhs.passRecords         }
     {
     }
 
@@ -285,7 +416,9 @@ struct FrameProfile
     inline FrameProfile(FrameProfile&& rhs) noexcept :
         commandQueueRecord  { rhs.commandQueueRecord     },
         commandBufferRecord { rhs.commandBufferRecord    },
-        timeRecords         { std::move(rhs.timeRecords) }
+        memoryRecord        { rhs.memoryRecord           },
+        timeRecords         { std::move(rhs.timeRecords) },
+        passRecords         { std::move(rhs.passRecords) }
     {
     }
 
@@ -294,7 +427,9 @@ struct FrameProfile
     {
         this->commandQueueRecord    = rhs.commandQueueRecord;
         this->commandBufferRecord   = rhs.commandBufferRecord;
+        this->memoryRecord          = rhs.memoryRecord;
         this->timeRecords           = rhs.timeRecords;
+        this->passRecords           = rhs.passRecords;
         return *this;
     }
 
@@ -303,7 +438,9 @@ struct FrameProfile
     {
         this->commandQueueRecord    = rhs.commandQueueRecord;
         this->commandBufferRecord   = rhs.commandBufferRecord;
+        this->memoryRecord          = rhs.memoryRecord;
         this->timeRecords           = std::move(rhs.timeRecords);
+        this->passRecords           = std::move(rhs.passRecords);
         return *this;
     }
 
@@ -465,11 +602,25 @@ struct FrameProfile
     */
     ProfileCommandBufferRecord          commandBufferRecord;
 
+    /**
+    \brief Structure for memory transfers and memory usage of this frame profile.
+    \see ProfileMemoryRecord
+    */
+    ProfileMemoryRecord                 memoryRecord;
+
     /**
     \brief List of all time records for this frame profile.
     \see RenderingDebugger::SetTimeRecording
     */
     DynamicVector<ProfileTimeRecord>    timeRecords;
+
+    /**
+    \brief List of all pass records that have been resolved in this frame.
+    \remarks These records belong to previous frames, since the queries are resolved asynchronously.
+    \see RenderingDebugger::SetPassRecording
+    \see ProfilePassRecord::frameLatency
+    */
+    DynamicVector<ProfilePassRecord>    passRecords;
 };
 
 
@@ -11,6 +11,7 @@
 
 #include <LLGL/RenderSystemChild.h>
 #include <LLGL/ResourceFlags.h>
+#include <cstddef>
 
 
 namespace LLGL
@@ -38,6 +39,42 @@ class LLGL_EXPORT Resource : public RenderSystemChild
         */
         virtual ResourceType GetResourceType() const = 0;
 
+        /**
+        \brief Sets the priority of this resource to remain resident in device memory when the device is under memory pressure.
+        \param[in] priority Specifies the new residency priority. By default, all resources have ResidencyPriority::Normal.
+        \remarks This is only a hint for the driver and the implementation is undefined,
+        i.e. if the respective render system does not support residency priorities this function call will be ignored silently.
+        \remarks For the Vulkan backend, the priority is applied via \c VK_EXT_pageable_device_local_memory to the device memory chunk the resource is allocated in.
+        Resources that share the same chunk are kept resident with the highest priority among them.
+        \remarks The default implementation has no effect.
+        \note Only supported with: Direct3D 11, Direct3D 12, Vulkan.
+        Transient and sparse textures are ignored with Direct3D 12.
+        \see RenderSystem::MakeResident
+        \see RenderSystem::Evict
+        */
+        virtual void SetResidencyPriority(ResidencyPriority priority);
+
+        /**
+        \brief Returns the native handle of this resource, e.g. to share its memory with another API such as CUDA or a hardware video decoder without a copy.
+        \param[out] nativeHandle Raw pointer to the backend specific structure to store the native handle.
+        Optain the respective structure from <code>#include <LLGL/Backend/BACKEND/NativeHandle.h></code>
+        where \c BACKEND must be either \c Direct3D12, \c Direct3D11, \c Vulkan, \c OpenGL, or \c Metal.
+        \param[in] nativeHandleSize Specifies the size (in bytes) of the native handle structure for robustness.
+        This must be <code>sizeof(STRUCT)</code> where \c STRUCT is the respective backend specific structure such as \c LLGL::Direct3D12::ResourceNativeHandle.
+        \return True if the native handle was successfully retrieved. Otherwise, \c nativeHandleSize specifies an incompatible structure size.
+        \remarks For COM and Objective-C objects, the reference counter is incremented, so the caller must release the returned object.
+        \remarks The native object remains owned by this resource. The caller is responsible for synchronizing its access with the command queue,
+        e.g. with CommandQueue::WaitIdle or a Fence before the object is used by another API.
+        \remarks The default implementation returns false unless \c nativeHandle is null or \c nativeHandleSize is 0. Samplers do not provide a native handle.
+        \note Only supported for buffers and textures with: Direct3D 11, Direct3D 12, Vulkan, OpenGL, Metal.
+        \see Direct3D12::ResourceNativeHandle
+        \see Direct3D11::ResourceNativeHandle
+        \see Vulkan::ResourceNativeHandle
+        \see OpenGL::ResourceNativeHandle
+        \see Metal::ResourceNativeHandle
+        */
+        virtual bool GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize);
+
 };
 
 
@@ -49,6 +49,29 @@ enum class ResourceType
     Sampler,
 };
 
+/**
+\brief Residency priority enumeration for resources in device memory.
+\remarks When the device is under memory pressure, resources with a lower priority are evicted from device memory before resources with a higher priority.
+\see Resource::SetResidencyPriority
+*/
+enum class ResidencyPriority
+{
+    //! Lowest priority. The resource is not used anymore or only very rarely and can be evicted first.
+    Minimum,
+
+    //! Low priority, e.g. for resources that are streamed out or only used for distant objects.
+    Low,
+
+    //! Normal priority. This is the default priority of all resources.
+    Normal,
+
+    //! High priority, e.g. for resources that are used every frame.
+    High,
+
+    //! Highest priority, e.g. for render targets and resources whose eviction would cause severe stalls.
+    Maximum,
+};
+
 
 /* ----- Flags ----- */
 
@@ -57,7 +80,7 @@ enum class ResourceType
 \remarks Resources can be created with both input and output binding flags, but they cannot be used together when the resource is bound. See the following table for compatibility:
 | Binding type | Binding flags |
 |--------------|---------------|
-| Input | BindFlags::Sampled, BindFlags::CopySrc, BindFlags::VertexBuffer, BindFlags::IndexBuffer, BindFlags::ConstantBuffer, BindFlags::IndirectBuffer |
+| Input | BindFlags::Sampled, BindFlags::InputAttachment, BindFlags::CopySrc, BindFlags::VertexBuffer, BindFlags::IndexBuffer, BindFlags::ConstantBuffer, BindFlags::IndirectBuffer, BindFlags::AccelerationStructure |
 | Output | BindFlags::Storage, BindFlags::CopyDst, BindFlags::ColorAttachment, BindFlags::DepthStencilAttachment, BindFlags::StreamOutputBuffer |
 \see BufferDescriptor::bindFlags
 \see TextureDescriptor::bindFlags
@@ -161,6 +184,26 @@ struct BindFlags
         \see CommandBuffer::FillBuffer
         */
         CopyDst                 = (1 << 11),
+
+        /**
+        \brief Texture can be read as input attachment by a subsequent subpass of the render pass it is rendered into.
+        \remarks This can only be used for Texture resources together with BindFlags::ColorAttachment.
+        For binding descriptors, this must be combined with ResourceType::Texture and specifies a \c subpassInput in GLSL for Vulkan.
+        Backends that read input attachments via framebuffer fetch (Metal and OpenGL ES) ignore binding descriptors with this flag.
+        \see SubpassDescriptor::inputAttachmentMask
+        \see RenderingFeatures::hasSubpasses
+        */
+        InputAttachment         = (1 << 12),
+
+        /**
+        \brief Buffer can hold a ray tracing acceleration structure.
+        \remarks This can only be used for Buffer resources and must not be combined with any other binding flags.
+        For binding descriptors, this must be combined with ResourceType::Buffer and specifies a \c RaytracingAccelerationStructure in HLSL
+        and an \c accelerationStructureEXT in GLSL for Vulkan.
+        \see CommandBuffer::BuildAccelerationStructure
+        \see RenderingFeatures::hasRayTracing
+        */
+        AccelerationStructure   = (1 << 13),
     };
 };
 
@@ -214,13 +257,13 @@ struct MiscFlags
         \see RenderSystem::WriteTexture
         \todo Restriction required to support deferred context in D3D11. This must no longer be just a "hint", it must be a strictly defined attribute for a buffer.
         */
-        DynamicUsage    = (1 << 0),
+        DynamicUsage      = (1 << 0),
 
         /**
         \brief Multi-sampled Texture resource has fixed sample locations.
         \remarks This can only be used with multi-sampled Texture resources (i.e. TextureType::Texture2DMS, TextureType::Texture2DMSArray).
         */
-        FixedSamples    = (1 << 1),
+        FixedSamples      = (1 << 1),
 
         /**
         \brief Generates MIP-maps at texture creation time with the initial image data (if specified).
@@ -230,13 +273,13 @@ struct MiscFlags
         \see TextureDescriptor::mipLevels
         \see CommandBuffer::GenerateMips
         */
-        GenerateMips    = (1 << 2),
+        GenerateMips      = (1 << 2),
 
         /**
         \brief Specifies to ignore resource data initialization.
         \remarks If this is specified, a texture or buffer resource will stay uninitialized during creation and the content is undefined.
         */
-        NoInitialData   = (1 << 3),
+        NoInitialData     = (1 << 3),
 
         /**
         \brief Enables a storage buffer to be used for \c AppendStructuredBuffer and \c ConsumeStructuredBuffer in HLSL only.
@@ -247,7 +290,7 @@ struct MiscFlags
         \see ResourceViewDescriptor::initialCount
         \see https://docs.microsoft.com/en-us/windows/win32/api/d3d11/ne-d3d11-d3d11_buffer_uav_flag
         */
-        Append          = (1 << 4),
+        Append            = (1 << 4),
 
         /**
         \brief Enables the hidden counter in a storage buffer to be used for \c RWStructuredBuffer in HLSL only.
@@ -258,7 +301,88 @@ struct MiscFlags
         \see ResourceViewDescriptor::initialCount
         \see https://docs.microsoft.com/en-us/windows/win32/api/d3d11/ne-d3d11-d3d11_buffer_uav_flag
         */
-        Counter         = (1 << 5),
+        Counter           = (1 << 5),
+
+        /**
+        \brief Specifies a transient texture whose memory can be aliased with other transient textures.
+        \remarks Transient textures that share the same TextureDescriptor::transientSlot share the same device memory,
+        i.e. the application declares that their lifetimes within a frame never overlap.
+        Whenever one transient texture is used after another one of the same slot, the content of the previous texture is lost.
+        \remarks Initial image data is ignored for transient textures, i.e. MiscFlags::NoInitialData is implied.
+        Their content is undefined whenever they are used for the first time after a different texture of the same slot was used.
+        \remarks Backends that do not support memory aliasing ignore this flag and create regular textures.
+        \note Only supported with: Direct3D 12, Metal (macOS 10.15 or iOS 13).
+        \see TextureDescriptor::transientSlot
+        */
+        Transient         = (1 << 6),
+
+        /**
+        \brief Specifies a sparse texture whose memory is committed tile by tile.
+        \remarks Sparse textures are created without device memory except for the packed MIP-map tail, which is always resident.
+        Tiles of the other MIP-map levels must be committed with RenderSystem::CommitTextureTiles before they can be accessed.
+        Shaders can query the residency of sampled texels, e.g. via \c CheckAccessFullyMapped in HLSL, to fall back to a coarser MIP-map level.
+        \remarks Initial image data is ignored for sparse textures, i.e. MiscFlags::NoInitialData is implied.
+        \remarks This can only be used with textures of type TextureType::Texture2D or TextureType::Texture2DArray, without multi-sampling,
+        and it cannot be used together with the MiscFlags::Transient bit.
+        \note Only supported with: Direct3D 12, Vulkan.
+        \see RenderingFeatures::hasSparseTextures
+        \see RenderSystem::GetSparseTextureProperties
+        */
+        Sparse            = (1 << 7),
+
+        /**
+        \brief Specifies a buffer that resides in CPU-readable memory and only serves as destination for GPU readback.
+        \remarks Readback buffers are filled on the GPU with CommandBuffer::CopyBuffer or CommandBuffer::CopyBufferFromTexture.
+        Mapping a readback buffer with RenderSystem::MapBuffer neither submits any commands nor waits for the GPU,
+        so the application must ensure the copy command has completed, e.g. by waiting for or polling a fence that was submitted after the command buffer:
+        \code
+        myCmdBuffer->CopyBuffer(*myReadbackBuffer, 0, *myGpuBuffer, 0, mySize);
+        // ...
+        myCmdQueue->Submit(*myCmdBuffer);
+        myCmdQueue->Submit(*myFence, ++myFenceValue);
+        // Some frames later
+        if (myFence->GetCompletedValue() >= myFenceValue)
+        {
+            const void* data = myRenderer->MapBuffer(*myReadbackBuffer, LLGL::CPUAccess::ReadOnly);
+            // ...
+            myRenderer->UnmapBuffer(*myReadbackBuffer);
+        }
+        \endcode
+        \remarks This can only be used with buffers that have the CPU access flag CPUAccessFlags::Read only, and no binding flags other than BindFlags::CopyDst.
+        \see ReadbackBufferPool
+        */
+        Readback          = (1 << 8),
+
+        /**
+        \brief Specifies a texture that is only used as render target attachment and whose content never leaves the on-chip tile memory of tile-based GPUs.
+        \remarks This is intended for attachments that are only needed within a single render pass, such as depth buffers that are only used for depth testing,
+        or multi-sampled color attachments that are resolved at the end of the render pass.
+        Backends can then avoid allocating device memory for such textures, which saves both memory and bandwidth.
+        \remarks This can only be used with textures that have either the binding flag BindFlags::ColorAttachment or BindFlags::DepthStencilAttachment and no other binding flags,
+        no CPU access flags, and a single MIP-map level.
+        It cannot be used together with MiscFlags::Transient, MiscFlags::Sparse, or MiscFlags::GenerateMips. Initial image data is ignored, i.e. MiscFlags::NoInitialData is implied.
+        \remarks Render passes must neither load nor store the content of such an attachment,
+        i.e. AttachmentFormatDescriptor::loadOp must not be AttachmentLoadOp::Load and AttachmentFormatDescriptor::storeOp must be AttachmentStoreOp::Undefined.
+        \remarks Backends without tile memory ignore this flag and create regular textures.
+        \note Only supported with: Vulkan (via lazily allocated memory if available), Metal (via \c MTLStorageModeMemoryless on Apple GPUs).
+        */
+        Memoryless        = (1 << 9),
+
+        /**
+        \brief Specifies a buffer that stays mapped into CPU memory space for its entire lifetime.
+        \remarks RenderSystem::MapBuffer returns the same stable memory address each time (offset by the requested range) without mapping the buffer again,
+        and RenderSystem::UnmapBuffer only makes the written range of the previous MapBuffer call visible to the GPU, but keeps the buffer mapped.
+        Neither of them waits for the GPU, so the application must ensure that the GPU no longer reads the memory it writes to,
+        e.g. by partitioning the buffer into one region per frame in flight and waiting for a fence before a region is reused.
+        \remarks This can only be used with buffers that have at least one CPU access flag.
+        Such buffers should only be written through the mapped memory or RenderSystem::WriteBuffer, i.e. they should not be the destination of copy or update commands.
+        \remarks Backends that cannot map a buffer persistently fall back to mapping it on demand, e.g. Direct3D 11 or OpenGL without \c GL_ARB_buffer_storage.
+        \remarks Buffers that are only written by the CPU and read by the GPU are placed in video memory that is also CPU visible if the device supports it (e.g. with resizable BAR)
+        and the memory budget permits, so GPU reads are not limited by the bus bandwidth. Otherwise, they reside in system memory.
+        \note Only supported with: Vulkan (via host coherent memory), Direct3D 12 (via the upload heap for vertex, index, and constant buffers), OpenGL 4.4 (via \c GL_MAP_PERSISTENT_BIT), Metal.
+        \see RenderSystem::MapBuffer
+        */
+        PersistentMapping = (1 << 10),
     };
 };
 
@@ -0,0 +1,101 @@
+/*
+ * ShaderCache.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_SHADER_CACHE_H
+#define LLGL_SHADER_CACHE_H
+
+
+#include <LLGL/NonCopyable.h>
+#include <LLGL/Blob.h>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Content-addressed shader cache interface.
+\remarks A shader cache stores the compiled binaries of shaders that were created from source code,
+so repeated application launches can skip shader compilation entirely.
+Each entry is addressed by a 64-bit key that the backend computes from the shader source, shader type, entry point, profile, macro definitions, compilation flags, and the compiler that is used (e.g. FXC or DXC).
+Only successfully compiled shaders are stored in the cache.
+\remarks Sub classes of this interface must be thread-safe if shaders are created from multiple threads.
+\note Files that are included by the shader source (e.g. via \c #include directives) are not part of the key.
+The same applies to the version of the shader compiler, e.g. when \c dxcompiler.dll is updated.
+When an included file or the compiler changes, the cache must be cleared or a different cache must be used.
+\note Only supported with: Direct3D 11, Direct3D 12.
+GLSL shader objects have no binary representation of their own (program binaries are cached via PipelineCache instead),
+Metal cannot serialize libraries that are compiled from source, and Vulkan consumes SPIR-V without a runtime compilation step.
+\see RenderSystemDescriptor::shaderCache
+\see FileShaderCache
+*/
+class LLGL_EXPORT ShaderCache : public NonCopyable
+{
+
+    public:
+
+        /**
+        \brief Returns the cached binary for the specified key.
+        \param[in] key Specifies the content-addressed key of the cache entry.
+        \return Blob with the cached shader binary or an empty Blob if the cache has no entry for this key.
+        */
+        virtual Blob Load(std::uint64_t key) = 0;
+
+        /**
+        \brief Stores the specified shader binary in the cache entry with the specified key.
+        \param[in] key Specifies the content-addressed key of the cache entry. An existing entry with this key is replaced.
+        \param[in] data Pointer to the compiled shader binary.
+        \param[in] size Specifies the size (in bytes) of the shader binary.
+        */
+        virtual void Store(std::uint64_t key, const void* data, std::size_t size) = 0;
+
+};
+
+/**
+\brief Disk-backed shader cache that stores each entry as a separate file in a single directory.
+\remarks The filename of each entry is the hexadecimal representation of its key.
+Entries that are truncated or were written with a different key are ignored on load.
+\remarks This class is thread-safe for concurrent loads and stores of different keys.
+*/
+class LLGL_EXPORT FileShaderCache final : public ShaderCache
+{
+
+    public:
+
+        /**
+        \brief Initializes the shader cache with the specified directory.
+        \param[in] directory Specifies the directory where the cache entries are stored. This directory must already exist.
+        If this is null or empty, the current working directory is used.
+        */
+        FileShaderCache(const char* directory);
+
+        ~FileShaderCache();
+
+    public:
+
+        Blob Load(std::uint64_t key) override;
+
+        void Store(std::uint64_t key, const void* data, std::size_t size) override;
+
+    private:
+
+        struct Pimpl;
+        Pimpl* pimpl_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
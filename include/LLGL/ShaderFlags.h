@@ -37,6 +37,8 @@ enum class ShaderType
     Geometry,       //!< Geometry shader type.
     Fragment,       //!< Fragment shader type (also "Pixel Shader").
     Compute,        //!< Compute shader type.
+    Task,           //!< Task shader type (also "Amplification Shader" or "Object Shader").
+    Mesh,           //!< Mesh shader type.
 };
 
 /**
@@ -187,14 +189,23 @@ struct StageFlags
         //! Specifies the compute shader stage.
         ComputeStage        = (1 << 5),
 
+        //! Specifies the task shader stage (also referred to as "Amplification Shader" or "Object Shader").
+        TaskStage           = (1 << 6),
+
+        //! Specifies the mesh shader stage.
+        MeshStage           = (1 << 7),
+
         //! Specifies all tessellation stages, i.e. tessellation-control-, tessellation-evaluation shader stages.
         AllTessStages       = (TessControlStage | TessEvaluationStage),
 
+        //! Specifies all mesh pipeline shader stages, i.e. task- and mesh shader stages.
+        AllMeshStages       = (TaskStage | MeshStage),
+
         //! Specifies all graphics pipeline shader stages, i.e. vertex-, tessellation-, geometry-, and fragment shader stages.
         AllGraphicsStages   = (VertexStage | AllTessStages | GeometryStage | FragmentStage),
 
         //! Specifies all shader stages.
-        AllStages           = (AllGraphicsStages | ComputeStage),
+        AllStages           = (AllGraphicsStages | ComputeStage | AllMeshStages),
     };
 };
 
@@ -236,6 +247,9 @@ struct VertexShaderAttributes
     \brief Vertex shader input attributes.
     \remarks All of these attributes must be contained in the \c vertexAttribs list of the vertex buffer that will be used in conjunction with the respective shader.
     In other words, a shader must not declare any vertex attributes that are not contained in the currently bound vertex buffer.
+    \remarks This can be empty for vertex pulling, i.e. when the vertex shader fetches its vertex data from storage buffers via \c SV_VertexID (HLSL), \c gl_VertexID (GLSL), or \c gl_VertexIndex (Vulkan).
+    In this case, no vertex buffers need to be bound for drawing and all graphics pipelines with such a vertex shader are independent of the vertex layout.
+    Only an index buffer may optionally be bound for indexed draw commands.
     \see BufferDescriptor::vertexAttribs
     */
     std::vector<VertexAttribute> inputAttribs;
@@ -276,6 +290,8 @@ struct ComputeShaderAttributes
     If not used for shader reflection, all other renderers need to specified the workgroup size within the shader code:
     - For GLSL: <code>layout(local_size_x = X, local_size_y = Y, local_size_z = Z)</code>
     - For HLSL: <code>[numthreads(X, Y, Z)]</code>
+    \remarks For the Metal backend, this is also used for the number of threads per threadgroup of task shaders (object functions) and mesh shaders (mesh functions).
+    \see CommandBuffer::DrawMesh
     */
     Extent3D workGroupSize = { 1, 1, 1 };
 };
@@ -78,7 +78,13 @@ class LLGL_EXPORT SwapChain : public RenderTarget
 
         /**
         \brief Swaps the current back buffer with the front buffer to present it on the screen.
+        \remarks Different swap-chains can be presented from different threads concurrently, e.g. with one present thread per window,
+        so a present that blocks on the refresh rate of one display does not delay the other swap-chains. Calls for the same swap-chain must be synchronized by the client programmer.
+        Direct3D 12 and Vulkan support this by default; Vulkan serializes all queue submissions internally.
+        Direct3D 11 requires RendererConfigurationDirect3D11::enableMultiThreadProtection and OpenGL requires RendererConfigurationOpenGL::contextPerSwapChain.
+        To present multiple swap-chains in a single operation, e.g. for multi-display setups, use CommandQueue::Present.
         \see GetCurrentSwapIndex
+        \see CommandQueue::Present
         */
         virtual void Present() = 0;
 
@@ -88,6 +94,9 @@ class LLGL_EXPORT SwapChain : public RenderTarget
         \remarks If the renderer supports control over swap-chain sizes, this function returns the current swap-buffer index. Otherwise, this function always returns 0.
         \remarks This function is guaranteed to never return a value greater than or equal to the swap-chain size that was specified when this swap-chain was created.
         \remarks Can be used to encode a command buffer for a specific swap-buffer.
+        \remarks Vulkan and Metal acquire the next swap-buffer only when it is first needed after Present, i.e. for the first render pass that targets this swap-chain.
+        On Vulkan, calling this function before that forces the next swap-buffer to be acquired, which can block the CPU until the presentation engine releases an image.
+        Recording commands that do not depend on the swap-buffer index beforehand avoids such a stall.
 
         \return \f$i \in \left[ 0, \texttt{GetNumSwapBuffers()} \right)\f$
 
@@ -147,6 +156,18 @@ class LLGL_EXPORT SwapChain : public RenderTarget
         */
         virtual bool SetVsyncInterval(std::uint32_t vsyncInterval) = 0;
 
+        /**
+        \brief Sets the frame pacing for this swap-chain, so mobile applications can sustain a stable frame rate without thermal throttling.
+        \param[in] desc Specifies the new frame pacing configuration. A preferred frame rate of 0 disables frame pacing.
+        \return True on success, otherwise frame pacing is not supported by this platform or backend.
+        \remarks On Android, Present paces frames to the preferred frame interval and reports the CPU work duration of each frame
+        through the Performance Hint API (ADPF, API level 33 or later), so the system can adjust CPU clocks before the device overheats.
+        This is supported with OpenGLES and Vulkan.
+        \remarks On iOS, Metal sets the preferred frame rate of the display link that drives its view.
+        \see FramePacingDescriptor
+        */
+        virtual bool SetFramePacing(const FramePacingDescriptor& desc);
+
     public:
 
         /* ----- Surface & Display ----- */
@@ -179,6 +200,21 @@ class LLGL_EXPORT SwapChain : public RenderTarget
         */
         virtual bool ResizeBuffersPrimary(const Extent2D& resolution) = 0;
 
+        /**
+        \brief Waits until the next frame is due and reports the work duration of the current frame, if frame pacing is enabled.
+        \remarks This must be called by the Present function of each backend that uses the default implementation of SetFramePacing, right before the back buffer is swapped.
+        \see NotifyFramePresented
+        \see SetFramePacing
+        */
+        void PaceFrame();
+
+        /**
+        \brief Starts measuring the work duration of the next frame, if frame pacing is enabled.
+        \remarks This must be called by the Present function right after the back buffer has been swapped, so the time blocked in the swap is not reported as work.
+        \see PaceFrame
+        */
+        void NotifyFramePresented();
+
     protected:
 
         //! Allocates the internal data.
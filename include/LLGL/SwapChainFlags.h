@@ -52,6 +52,80 @@ struct ResizeBuffersFlags
 };
 
 
+/* ----- Enumerations ----- */
+
+/**
+\brief Swap-chain presentation mode enumeration.
+\remarks If the selected mode is not supported by the swap-chain, it falls back to PresentMode::Fifo, which is always supported.
+\see SwapChainDescriptor::presentMode
+*/
+enum class PresentMode
+{
+    /**
+    \brief Derives the presentation mode from the V-sync interval. This is the default.
+    \remarks If V-sync is disabled, frames are presented without waiting for the vertical blank. Otherwise, this is equivalent to PresentMode::Fifo.
+    \see SwapChain::SetVsyncInterval
+    */
+    Default,
+
+    /**
+    \brief Frames are queued and presented on the vertical blank. This never tears and limits the frame rate to the display refresh rate.
+    \remarks The V-sync interval specifies how many vertical blanks each frame is presented for, where 0 is treated as 1.
+    */
+    Fifo,
+
+    /**
+    \brief Like Fifo, but a frame that misses its vertical blank is presented immediately, which may tear.
+    \note Only supported with: Vulkan. The other backends fall back to Fifo.
+    */
+    FifoRelaxed,
+
+    /**
+    \brief The newest frame replaces the queued one and is presented on the vertical blank. This never tears and never blocks the CPU.
+    \remarks This is the lowest latency mode without tearing.
+    \note Only supported with: Vulkan, Direct3D 12. Direct3D 11, OpenGL, and Metal present without waiting for the vertical blank instead.
+    */
+    Mailbox,
+
+    /**
+    \brief Frames are presented immediately without waiting for the vertical blank, which may tear.
+    */
+    Immediate,
+};
+
+/**
+\brief Swap-chain color space enumeration.
+\remarks A color space other than ColorSpace::SRGB also determines the color format of the swap-chain, i.e. SwapChainDescriptor::colorBits is ignored.
+If the selected color space is not supported by the display or the swap-chain, it falls back to ColorSpace::SRGB.
+Use SwapChain::GetColorFormat to determine whether a wide color format has been selected.
+\see SwapChainDescriptor::colorSpace
+*/
+enum class ColorSpace
+{
+    /**
+    \brief Standard dynamic range in the non-linear sRGB color space (BT.709 primaries with sRGB transfer function). This is the default.
+    */
+    SRGB,
+
+    /**
+    \brief Extended dynamic range in the linear sRGB color space, also known as scRGB.
+    \remarks The swap-chain uses the Format::RGBA16Float color format. A value of 1.0 maps to the SDR reference white and values greater than 1.0 are brighter.
+    Values outside the range [0, 1] describe colors outside of the sRGB gamut.
+    \remarks Direct3D uses \c DXGI_COLOR_SPACE_RGB_FULL_G10_NONE_P709, Vulkan uses \c VK_COLOR_SPACE_EXTENDED_SRGB_LINEAR_EXT,
+    and Metal uses \c kCGColorSpaceExtendedLinearSRGB with \c CAMetalLayer.wantsExtendedDynamicRangeContent.
+    */
+    ExtendedSRGB,
+
+    /**
+    \brief High dynamic range in the HDR10 color space (BT.2020 primaries with SMPTE ST 2084 "PQ" transfer function).
+    \remarks The swap-chain uses the Format::RGB10A2UNorm color format and the shader output must be encoded with the PQ transfer function.
+    \remarks Direct3D uses \c DXGI_COLOR_SPACE_RGB_FULL_G2084_NONE_P2020, Vulkan uses \c VK_COLOR_SPACE_HDR10_ST2084_EXT,
+    and Metal uses \c kCGColorSpaceITUR_2100_PQ (macOS 11 and iOS 14 or later).
+    */
+    HDR10,
+};
+
+
 /* ----- Structures ----- */
 
 /**
@@ -65,7 +139,7 @@ struct SwapChainDescriptor
     \remarks The final name of the native hardware resource is implementation defined.
     \see RenderSystemChild::SetName
     */
-    const char*     debugName       = nullptr;
+    const char*     debugName         = nullptr;
 
     /**
     \brief Screen resolution (in pixels).
@@ -80,7 +154,7 @@ struct SwapChainDescriptor
     To determine the actual color format of a swap-chain, use the SwapChain::GetColorFormat function.
     \see SwapChain::GetColorFormat
     */
-    int             colorBits       = 32;
+    int             colorBits         = 32;
 
     /**
     \brief Number of bits for each pixel in the depth buffer. Should be 24, 32, or zero to disable depth buffer. By default 24.
@@ -88,7 +162,7 @@ struct SwapChainDescriptor
     To determine the actual depth-stencil format of a swap-chain, use the SwapChain::GetDepthStencilFormat function.
     \see SwapChain::GetDepthStencilFormat
     */
-    int             depthBits       = 24;
+    int             depthBits         = 24;
 
     /**
     \brief Number of bits for each pixel in the stencil buffer. Should be 8, or zero to disable stencil buffer. By default 8.
@@ -96,7 +170,7 @@ struct SwapChainDescriptor
     To determine the actual depth-stencil format of a swap-chain, use the SwapChain::GetDepthStencilFormat function.
     \see SwapChain::GetDepthStencilFormat
     */
-    int             stencilBits     = 8;
+    int             stencilBits       = 8;
 
     /**
     \brief Number of samples for the swap-chain buffers. By default 1.
@@ -104,7 +178,7 @@ struct SwapChainDescriptor
     The actual number of samples can be queried by the \c GetSamples function of the RenderTarget interface.
     \see RenderTarget::GetSamples
     */
-    std::uint32_t   samples         = 1;
+    std::uint32_t   samples           = 1;
 
     /**
     \brief Number of swap buffers. By default 2 (for double-buffering).
@@ -113,10 +187,63 @@ struct SwapChainDescriptor
     \see SwapChain::GetCurrentSwapIndex
     \see SwapChain::GetNumSwapBuffers
     */
-    std::uint32_t   swapBuffers     = 2;
+    std::uint32_t   swapBuffers       = 2;
+
+    /**
+    \brief Maximum number of frames the CPU can record ahead of the GPU. By default 0, which selects the default of the renderer.
+    \remarks Use 1 frame in flight for latency critical applications, e.g. VR or streaming, and 3 or 4 frames for higher throughput.
+    This is only a hint to the renderer. The Vulkan backend clamps this value to the range [1, 4] and uses 3 by default.
+    If the Vulkan device supports the extensions \c VK_KHR_present_id and \c VK_KHR_present_wait,
+    the swap-chain also waits until the frame that was presented this number of frames ago is on screen, before the next image is acquired.
+    \remarks Direct3D 12 creates the swap-chain with a frame-latency waitable object and SwapChain::Present waits on it,
+    so the next frame starts as late as possible and reads the most recent input.
+    Direct3D 11 does the same with flip-model swap-chains (see RendererConfigurationDirect3D11::enableFlipModel) and otherwise sets the maximum frame latency of the DXGI device. Metal limits the number of drawables to the range [2, 3].
+    OpenGL does not support this setting.
+    */
+    std::uint32_t   maxFramesInFlight = 0;
+
+    /**
+    \brief Specifies how frames are presented on the screen. By default PresentMode::Default.
+    \see PresentMode
+    */
+    PresentMode     presentMode       = PresentMode::Default;
+
+    /**
+    \brief Specifies the color space the swap-chain is presented in. By default ColorSpace::SRGB.
+    \remarks This allows to present HDR and wide-gamut content directly, i.e. without a final tonemapping pass into an 8-bit sRGB buffer.
+    \note Only supported with: Direct3D 11 (with flip-model swap-chains), Direct3D 12, Vulkan, and Metal. OpenGL always uses ColorSpace::SRGB.
+    \see ColorSpace
+    */
+    ColorSpace      colorSpace        = ColorSpace::SRGB;
 
     //! Specifies whether to enable fullscreen mode or windowed mode. By default windowed mode.
-    bool            fullscreen      = false;
+    bool            fullscreen        = false;
+};
+
+/**
+\brief Frame pacing descriptor structure to sustain a stable frame rate on mobile platforms.
+\remarks All frame rates are specified in Hz. If \c preferredFrameRate is 0, frame pacing is disabled and the swap-chain presents as fast as its V-sync interval allows.
+\see SwapChain::SetFramePacing
+*/
+struct FramePacingDescriptor
+{
+    /**
+    \brief Minimum frame rate the platform may throttle down to, e.g. to save power while the content is static. By default 0.
+    \remarks If this is 0, it defaults to \c preferredFrameRate.
+    */
+    std::uint32_t   minFrameRate        = 0;
+
+    /**
+    \brief Maximum frame rate the platform may boost up to. By default 0.
+    \remarks If this is 0, it defaults to \c preferredFrameRate.
+    */
+    std::uint32_t   maxFrameRate        = 0;
+
+    /**
+    \brief Preferred frame rate the swap-chain is paced to. By default 0.
+    \remarks This is rounded to an integer fraction of the display refresh rate, e.g. a preferred frame rate of 40 Hz on a 60 Hz display results in 30 Hz.
+    */
+    std::uint32_t   preferredFrameRate  = 0;
 };
 
 
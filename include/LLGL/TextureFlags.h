@@ -355,6 +355,15 @@ struct TextureDescriptor
     */
     std::uint32_t   samples         = 1;
 
+    /**
+    \brief Specifies the memory slot of a transient texture. By default 0.
+    \remarks This is only used for textures with the MiscFlags::Transient bit.
+    All transient textures with the same slot share the same device memory and \b must not be used within overlapping lifetimes,
+    e.g. the intermediate targets of a post-processing chain that are never read after the subsequent pass.
+    \see MiscFlags::Transient
+    */
+    std::uint32_t   transientSlot   = 0;
+
     /**
     \brief Specifies a clear value to initialize the texture with, if no initial image data is provided.
     \remarks The initial texture data is only determined by this attribute if the \c imageDesc parameter of RenderSystem::CreateTexture is null
@@ -439,6 +448,62 @@ struct TextureViewDescriptor
     TextureSwizzleRGBA  swizzle;
 };
 
+/**
+\brief Texture copy region structure: destination and source location with the extent of the region to copy.
+\see CommandBuffer::CopyTexture(Texture&, Texture&, const ArrayView<TextureCopyRegion>&)
+*/
+struct TextureCopyRegion
+{
+    TextureCopyRegion() = default;
+
+    //! Initializes the copy region with all attributes.
+    inline TextureCopyRegion(const TextureLocation& dstLocation, const TextureLocation& srcLocation, const Extent3D& extent) :
+        dstLocation { dstLocation },
+        srcLocation { srcLocation },
+        extent      { extent      }
+    {
+    }
+
+    //! Specifies the destination location, including MIP-map level and offset.
+    TextureLocation dstLocation;
+
+    //! Specifies the source location, including MIP-map level and offset.
+    TextureLocation srcLocation;
+
+    //! Specifies the extent of the texture region to copy. This includes the array layers, same as the \c extent parameter of CommandBuffer::CopyTexture.
+    Extent3D        extent;
+};
+
+/**
+\brief Copy region structure between a buffer and a texture.
+\see CommandBuffer::CopyTextureFromBuffer(Texture&, Buffer&, const ArrayView<BufferTextureCopyRegion>&)
+*/
+struct BufferTextureCopyRegion
+{
+    BufferTextureCopyRegion() = default;
+
+    //! Initializes the copy region with all attributes.
+    inline BufferTextureCopyRegion(const TextureRegion& textureRegion, std::uint64_t bufferOffset, std::uint32_t rowStride = 0, std::uint32_t layerStride = 0) :
+        textureRegion { textureRegion },
+        bufferOffset  { bufferOffset  },
+        rowStride     { rowStride     },
+        layerStride   { layerStride   }
+    {
+    }
+
+    //! Specifies the texture region. Note that the \c numMipLevels attribute of this region \b must be 1.
+    TextureRegion   textureRegion;
+
+    //! Specifies the offset (in bytes) into the buffer. This \b must be a multiple of 4.
+    std::uint64_t   bufferOffset    = 0;
+
+    //! Specifies an optional stride (in bytes) per row in the buffer. Same rules apply as for CommandBuffer::CopyTextureFromBuffer.
+    std::uint32_t   rowStride       = 0;
+
+    //! Specifies an optional stride (in bytes) per layer in the buffer. Same rules apply as for CommandBuffer::CopyTextureFromBuffer.
+    std::uint32_t   layerStride     = 0;
+};
+
 /**
 \brief Memory footprint structure for texture subresources.
 \see Texture::GetSubresourceFootprint
@@ -473,6 +538,27 @@ struct SubresourceFootprint
     std::uint32_t layerStride   = 0;
 };
 
+/**
+\brief Tile layout of a sparse texture.
+\see RenderSystem::GetSparseTextureProperties
+\see MiscFlags::Sparse
+*/
+struct SparseTextureProperties
+{
+    //! Extent (in texels) of a single tile. Regions passed to RenderSystem::CommitTextureTiles must be aligned to this extent.
+    Extent3D        tileExtent;
+
+    //! Size (in bytes) of a single tile. This is usually 64 KiB.
+    std::uint32_t   tileSize        = 0;
+
+    /**
+    \brief First MIP-map level of the packed MIP-map tail.
+    \remarks All MIP-map levels from this level onwards are too small for individual tiles and are always resident.
+    This is equal to the number of MIP-map levels if the texture has no packed MIP-map tail.
+    */
+    std::uint32_t   firstMipTail    = 0;
+};
+
 
 /* ----- Functions ----- */
 
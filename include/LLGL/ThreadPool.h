@@ -0,0 +1,109 @@
+/*
+ * ThreadPool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_THREAD_POOL_H
+#define LLGL_THREAD_POOL_H
+
+
+#include <LLGL/NonCopyable.h>
+#include <LLGL/Constants.h>
+#include <functional>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Persistent pool of worker threads with work-stealing task queues.
+\remarks LLGL dispatches its internal multi-threaded work (such as image conversions) into the global thread pool, which is lazily started on first use.
+Applications can either share this pool via ThreadPool::GetGlobal or supply their own instance via ThreadPool::SetGlobal.
+The thread that calls ParallelRange always participates in the work, so nested calls from within a task never oversubscribe the CPU cores or deadlock.
+\see ThreadPool::GetGlobal
+\see ConvertImageBuffer
+*/
+class LLGL_EXPORT ThreadPool final : public NonCopyable
+{
+
+    public:
+
+        struct Pimpl;
+
+        /**
+        \brief Starts the thread pool with the specified number of worker threads.
+        \param[in] numThreads Specifies the number of worker threads. If this is \c LLGL_MAX_THREAD_COUNT,
+        the number of hardware threads minus one is used, since the calling thread always participates in the work. By default \c LLGL_MAX_THREAD_COUNT.
+        */
+        ThreadPool(unsigned numThreads = LLGL_MAX_THREAD_COUNT);
+
+        //! Waits for all worker threads to finish their current tasks and joins them.
+        ~ThreadPool();
+
+    public:
+
+        /**
+        \brief Runs the specified task concurrently over the range [0, count) and returns once all work items have been processed.
+        \param[in] task Specifies the task that is invoked for each sub-range [begin, end).
+        \param[in] count Specifies the total number of elements to process.
+        \param[in] numWorkItems Specifies the number of sub-ranges the range is split into. This is clamped to the range [1, count].
+        \remarks The calling thread processes work items itself and steals pending work items from the worker threads while it waits for completion.
+        This function can be called from within a task that is currently executed by this thread pool.
+        */
+        void ParallelRange(
+            const std::function<void(std::size_t begin, std::size_t end)>&  task,
+            std::size_t                                                     count,
+            std::size_t                                                     numWorkItems
+        );
+
+        /**
+        \brief Queues the specified task for asynchronous execution and returns immediately.
+        \param[in] task Specifies the task that is to be executed by one of the worker threads.
+        \remarks If this thread pool has no worker threads, the task is executed immediately on the calling thread.
+        The task must not throw exceptions. Pending tasks are still executed when the thread pool is destroyed.
+        Callers are responsible for synchronizing with the completion of the task, e.g. to keep objects the task refers to alive.
+        */
+        void Submit(const std::function<void()>& task);
+
+        //! Returns the number of worker threads of this thread pool. The calling thread of ParallelRange is not counted.
+        unsigned GetNumThreads() const;
+
+        //! Returns true if the calling thread is one of the worker threads of this thread pool.
+        bool IsWorkerThread() const;
+
+    public:
+
+        /**
+        \brief Returns the global thread pool LLGL dispatches its internal multi-threaded work into.
+        \remarks If no thread pool was supplied via SetGlobal, the default thread pool is started with \c LLGL_MAX_THREAD_COUNT threads on the first call.
+        \see SetGlobal
+        */
+        static ThreadPool& GetGlobal();
+
+        /**
+        \brief Replaces the global thread pool by the specified instance.
+        \param[in] threadPool Optional pointer to the new global thread pool. If this is null, the default thread pool is restored.
+        \remarks The caller is responsible for keeping the thread pool alive until it is replaced again.
+        This must not be called while LLGL is processing work in the previous global thread pool.
+        */
+        static void SetGlobal(ThreadPool* threadPool);
+
+    private:
+
+        Pimpl* pimpl_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,123 @@
+/*
+ * CommandBufferPool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_COMMAND_BUFFER_POOL_H
+#define LLGL_COMMAND_BUFFER_POOL_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/NonCopyable.h>
+#include <LLGL/ForwardDecls.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Command buffer pool descriptor structure.
+\see CommandBufferPool
+*/
+struct CommandBufferPoolDescriptor
+{
+    //! Optional name for debugging purposes. This is assigned to all command buffers of the pool. By default null.
+    const char*     debugName           = nullptr;
+
+    //! Specifies the creation flags for all command buffers of the pool. By default 0. \see CommandBufferDescriptor::flags
+    long            flags               = 0;
+
+    /**
+    \brief Specifies the number of internal native command buffers of each command buffer. By default 1.
+    \remarks The pool only hands out command buffers whose previous submission has completed,
+    so additional native command buffers are usually not required. \see CommandBufferDescriptor::numNativeBuffers
+    */
+    std::uint32_t   numNativeBuffers    = 1;
+};
+
+/**
+\brief Pool of transient command buffers that are recycled as a group once the GPU has finished executing them.
+\remarks Creating and releasing command buffers for each job is expensive, since most backends allocate native command pools or allocators for each command buffer.
+This pool keeps all command buffers alive instead: The command buffers that were allocated since the previous call to Submit are associated with the fence value that is passed to Submit,
+and they are handed out again by AllocateCommandBuffer once that fence has been signaled. Encoding a recycled command buffer with CommandBuffer::Begin resets the native command buffer
+without re-creating it.
+\remarks This class is not thread-safe. Use one pool per thread that encodes command buffers, e.g. one pool per worker thread and frame in flight.
+\remarks Here is an example usage:
+\code
+// Once per frame on each worker thread
+LLGL::CommandBuffer* myCmdBuffer = myCmdBufferPool.AllocateCommandBuffer();
+myCmdBuffer->Begin();
+{
+    ...
+}
+myCmdBuffer->End();
+
+// Once per frame on the main thread, after all worker threads have finished
+myCmdQueue->Submit(*myCmdBuffer);
+myCmdQueue->Submit(*myFence, ++myFenceValue);
+myCmdBufferPool.Submit(*myFence, myFenceValue);
+\endcode
+\see CommandBufferDescriptor
+*/
+class LLGL_EXPORT CommandBufferPool final : public NonCopyable
+{
+
+    public:
+
+        struct Pimpl;
+
+        /**
+        \brief Initializes the pool for the specified render system.
+        \param[in] renderSystem Specifies the render system that is used to create all command buffers.
+        This render system must outlive the pool.
+        \param[in] desc Specifies the descriptor of the pool.
+        */
+        CommandBufferPool(RenderSystem& renderSystem, const CommandBufferPoolDescriptor& desc = {});
+
+        //! Releases all command buffers of this pool. The GPU must no longer execute any of them.
+        ~CommandBufferPool();
+
+        /**
+        \brief Returns a command buffer that is ready to be encoded.
+        \remarks This is either a command buffer whose fence has been signaled or a new command buffer if there is none.
+        The command buffer remains owned by this pool and must not be released with RenderSystem::Release.
+        \return Pointer to the command buffer or null if a new command buffer could not be created.
+        */
+        CommandBuffer* AllocateCommandBuffer();
+
+        /**
+        \brief Associates all command buffers that were allocated since the previous call to Submit with the specified fence value.
+        \param[in] fence Specifies the fence that is signaled after the command buffers have been submitted.
+        This fence must outlive all command buffers that are associated with it.
+        \param[in] value Specifies the value the fence is signaled with (see CommandQueue::Submit(Fence&, std::uint64_t)).
+        */
+        void Submit(Fence& fence, std::uint64_t value);
+
+        /**
+        \brief Returns all command buffers of this pool for reuse immediately, regardless of their fences.
+        \remarks This can be used if the application has synchronized with the GPU by other means, e.g. with CommandQueue::WaitIdle.
+        */
+        void Reset();
+
+        //! Returns the total number of command buffers that are currently owned by this pool.
+        std::uint32_t GetNumCommandBuffers() const;
+
+    private:
+
+        Pimpl* pimpl_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,159 @@
+/*
+ * FrameCapturePlayer.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_FRAME_CAPTURE_PLAYER_H
+#define LLGL_FRAME_CAPTURE_PLAYER_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/NonCopyable.h>
+#include <LLGL/ForwardDecls.h>
+#include <LLGL/Types.h>
+#include <LLGL/Format.h>
+#include <LLGL/Container/Strings.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Summary of a loaded frame capture.
+\see FrameCapturePlayer::GetInfo
+*/
+struct FrameCaptureInfo
+{
+    //! Name of the renderer the frame was captured with, e.g. "Vulkan".
+    UTF8String      rendererName;
+
+    //! Resolution of the first captured swap-chain or zero if the frame was rendered without a swap-chain.
+    Extent2D        resolution;
+
+    //! Number of objects that are created from the capture.
+    std::uint32_t   numObjects          = 0;
+
+    //! Number of command buffer submissions per frame.
+    std::uint32_t   numSubmissions      = 0;
+
+    //! Number of encoded commands per frame.
+    std::uint32_t   numCommands         = 0;
+
+    /**
+    \brief Number of API calls that were not captured, e.g. queries or secondary command buffers.
+    \remarks If this is not zero, the replayed frame may differ from the captured one.
+    */
+    std::uint32_t   numSkipped          = 0;
+
+    //! Number of objects that could not be recreated on the replaying render system.
+    std::uint32_t   numFailedObjects    = 0;
+};
+
+/**
+\brief Replays a frame that was captured with RenderSystemFlags::FrameCapture.
+\remarks A capture file contains all objects that were alive when the capture started, the contents of their buffers and textures,
+and all command buffer submissions, resource updates, and presentations of the captured frame.
+The player recreates these objects on any render system and replays the frame as often as needed,
+which allows to measure the CPU and GPU cost of a frame under a profiler without running the application that rendered it.
+\remarks Here is an example usage:
+\code
+LLGL::FrameCapturePlayer myPlayer{ *myRenderer, mySwapChain };
+if (myPlayer.LoadFromFile("MyFrame.llfc"))
+{
+    for (int i = 0; i < 100; ++i)
+    {
+        myPlayer.RestoreResources();
+        myPlayer.Replay();
+    }
+}
+\endcode
+\note Shaders are recreated from the source or binary code they were created with, so a capture can only be replayed
+on a render system that supports the same shading language, unless the captured shaders are cross-compiled beforehand.
+\see RenderSystemFlags::FrameCapture
+\see RenderingDebugger::CaptureFrame
+*/
+class LLGL_EXPORT FrameCapturePlayer final : public NonCopyable
+{
+
+    public:
+
+        struct Pimpl;
+
+        /**
+        \brief Initializes the player for the specified render system.
+        \param[in] renderSystem Specifies the render system that is used to recreate all objects. This must outlive the player.
+        \param[in] swapChain Optional swap-chain that replaces all captured swap-chains. If this is null, presentations are ignored
+        and render passes that begin on a captured swap-chain are skipped.
+        */
+        FrameCapturePlayer(RenderSystem& renderSystem, SwapChain* swapChain = nullptr);
+
+        //! Releases all objects that were created from the capture. The GPU must no longer use any of them.
+        ~FrameCapturePlayer();
+
+        /**
+        \brief Loads the specified capture file and creates all of its objects.
+        \param[in] filename Specifies the capture file that was written by the debug layer.
+        \param[out] report Optional output report that receives the reason why the file could not be loaded and all objects that could not be created.
+        \return True on success. If this fails, all objects that were created so far are released.
+        */
+        bool LoadFromFile(const char* filename, Report* report = nullptr);
+
+        /**
+        \brief Restores the contents of all buffers and textures to their captured state at the beginning of the frame.
+        \remarks This is done once on load. Call this before each replay if the frame modifies its own inputs, e.g. with compute shaders.
+        */
+        void RestoreResources();
+
+        /**
+        \brief Replays the captured frame once, i.e. all resource updates, command buffer submissions, and swap-chain presentations.
+        \remarks This does not wait for the GPU to finish the frame.
+        */
+        void Replay();
+
+        //! Returns a summary of the loaded capture.
+        const FrameCaptureInfo& GetInfo() const;
+
+    private:
+
+        Pimpl* pimpl_;
+
+};
+
+/**
+\brief Creates all PSOs of the specified pipeline manifest to warm up the pipeline cache and the shader caches of the driver.
+\param[in] renderSystem Specifies the render system that is used to create all objects of the manifest.
+\param[in] filename Specifies the pipeline manifest file that was written by the debug layer (see RenderingDebugger::SavePipelineManifest).
+\param[in] pipelineCache Optional pointer to the pipeline cache all PSOs are created with.
+The application should create its PSOs with the same pipeline cache to benefit from the warm-up. By default null.
+\param[in] swapChain Optional swap-chain whose render pass replaces the render passes of all recorded swap-chains.
+If this is null, PSOs that refer to the render pass of a swap-chain are skipped. By default null.
+\param[out] report Optional output report that receives the reason why the file could not be loaded and all objects that could not be created.
+\return True if the manifest was loaded. PSOs that could not be created do not cause this function to fail, but they are written to the report.
+\remarks All PSOs are created with GraphicsPipelineDescriptor::asyncCompilation and ComputePipelineDescriptor::asyncCompilation enabled,
+so backends that support asynchronous compilation compile them in parallel on the global thread pool, e.g. during a loading screen.
+This function returns once all PSOs have been compiled. All objects that are created from the manifest are released before this function returns.
+\note Shaders and PSOs are recreated from the descriptors that are recorded in the manifest, so the manifest must be recorded with the same renderer.
+\see RenderingDebugger::SavePipelineManifest
+\see RenderSystemFlags::FrameCapture
+*/
+LLGL_EXPORT bool WarmUpPipelines(
+    RenderSystem&   renderSystem,
+    const char*     filename,
+    PipelineCache*  pipelineCache   = nullptr,
+    SwapChain*      swapChain       = nullptr,
+    Report*         report          = nullptr
+);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
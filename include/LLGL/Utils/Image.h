@@ -21,6 +21,20 @@ namespace LLGL
 {
 
 
+/**
+\brief Image filter enumeration for CPU MIP-map generation.
+\see Image::GenerateMipChain
+*/
+enum class ImageFilter
+{
+    //! Area-weighted box filter. This is the fastest filter and averages all source texels that are covered by a destination texel.
+    Box,
+
+    //! Kaiser windowed sinc filter. This filter produces sharper MIP-maps than the box filter but is more expensive.
+    Kaiser,
+};
+
+
 /**
 \brief Utility class to manage the storage and attributes of an image.
 
@@ -132,11 +146,12 @@ class LLGL_EXPORT Image
         If the source image is the same object as this image and the destination and source regions overlap, an internal temporary copy is allocated for reading the data.
         \param[in] srcRegionOffset Specifies the offset within the source image. This will be clamped if it exceeds the source image area.
         \param[in] srcRegionExtent Specifies the extent of the region to copy. This will be clamped if it exceeds the source or destination image area.
+        \param[in] threadCount Specifies the number of threads to use for large regions (see CopyImageBufferRegion for more details). By default 0.
         \remarks If one of the region offsets is clamped, the region extent will be adjusted respectively.
         If the source image has a different format or data type compared to this image, the function has no effect.
         \see ConvertImageBuffer
         */
-        void Blit(Offset3D dstRegionOffset, const Image& srcImage, Offset3D srcRegionOffset, Extent3D srcRegionExtent);
+        void Blit(Offset3D dstRegionOffset, const Image& srcImage, Offset3D srcRegionOffset, Extent3D srcRegionExtent, unsigned threadCount = 0);
 
         /**
         \brief Reads a region of pixels from this image into the destination image buffer specified by \c imageView.
@@ -144,7 +159,7 @@ class LLGL_EXPORT Image
         \param[in] extent Specifies the region extent within this image to read from.
         \param[in] imageView Specifies the destination image view to write the region to.
         If the 'data' member of this descriptor is null or if the sub-image region is not inside the image, this function has no effect.
-        \param[in] threadCount Specifies the number of threads to use if the data needs to be converted (see ConvertImageBuffer for more details). By default 0.
+        \param[in] threadCount Specifies the number of threads to use for copying large regions and if the data needs to be converted (see ConvertImageBuffer for more details). By default 0.
         \remarks To read a single pixel, use the following code example:
         \code
         LLGL::ColorRGBAub ReadSinglePixelRGBAub(const LLGL::Image& image, const LLGL::Offset3D& position) {
@@ -167,12 +182,38 @@ class LLGL_EXPORT Image
         \param[in] extent Specifies the region extent within this image to write to.
         \param[in] imageView Specifies the source image view to read the region from.
         If the \c data member of this descriptor is null or if the sub-image region is not inside the image, this function has no effect.
-        \param[in] threadCount Specifies the number of threads to use if the data needs to be converted (see ConvertImageBuffer for more details). By default 0.
+        \param[in] threadCount Specifies the number of threads to use for copying large regions and if the data needs to be converted (see ConvertImageBuffer for more details). By default 0.
         \see IsRegionInside
         \see ConvertImageBuffer
         */
         void WritePixels(const Offset3D& offset, const Extent3D& extent, const ImageView& imageView, unsigned threadCount = 0);
 
+        /* ----- MIP-maps ----- */
+
+        /**
+        \brief Generates a chain of MIP-maps for this image and returns all levels in a single contiguous buffer.
+        \param[in] filter Specifies the filter to downsample each MIP-map level from its previous level. By default ImageFilter::Box.
+        \param[in] numMipLevels Specifies the number of MIP-map levels to generate, including the base level.
+        If this is zero or exceeds the maximum number of MIP-map levels for this image extent, the full MIP-map chain is generated. By default 0.
+        \param[in] threadCount Specifies the number of threads to use for filtering and data conversion (see ConvertImageBuffer for more details). By default 0.
+        \return Byte buffer with all tightly packed MIP-map levels in the format and data type of this image, starting with a copy of the base level,
+        or null if this image is empty or has a compressed or depth-stencil format.
+        \remarks Each level is filtered in 32-bit floating-point precision and converted back to the data type of this image.
+        Each dimension of this image is treated as a 3D extent, i.e. the depth is also reduced by half for each MIP-map level.
+        If the data type of this image cannot be converted to and from DataType::Float32, this function traps instead of returning unfiltered data.
+        To upload a MIP-map level at once, use GetMipChainOffset to determine its location within the returned buffer.
+        \see GetMipChainOffset
+        \see NumMipLevels
+        */
+        DynamicByteArray GenerateMipChain(ImageFilter filter = ImageFilter::Box, std::uint32_t numMipLevels = 0, unsigned threadCount = 0) const;
+
+        /**
+        \brief Returns the offset (in bytes) of the specified MIP-map level within the buffer that is returned by GenerateMipChain.
+        \remarks The offset of the MIP-map level after the last one equals the size of the entire MIP-map chain.
+        \see GenerateMipChain
+        */
+        std::size_t GetMipChainOffset(std::uint32_t mipLevel) const;
+
         /* ----- Attributes ----- */
 
         //! Returns a source image descriptor for this image with read-only access to the image data.
@@ -97,6 +97,8 @@ class LLGL_EXPORT ParseContext
             - \c geom for the geometry shader stage (i.e. StageFlags::GeometryStage).
             - \c frag for the fragment shader stage (i.e. StageFlags::FragmentStage).
             - \c comp for the compute shader stage (i.e. StageFlags::ComputeStage).
+            - \c task for the task shader stage (i.e. StageFlags::TaskStage).
+            - \c mesh for the mesh shader stage (i.e. StageFlags::MeshStage).
         - If no stage flag is specified, all shader stages will be used.
         - There is a secondary syntax for uniform descriptors (see LLGL::UniformType for accepted type names):
             \code
@@ -337,6 +339,32 @@ inline LLGL_EXPORT ParseContext Parse(const StringView& s)
     return ParseContext{ UTF8String{ s } };
 }
 
+/**
+\brief Returns the pipeline layout descriptor for the specified layout signature from a global cache and only parses the signature on its first use.
+\param[in] signature Specifies the pipeline layout signature. See ParseContext::AsPipelineLayoutDesc for the syntax.
+\return Constant reference to the interned pipeline layout descriptor. This reference remains valid until ClearParseCache is called.
+\remarks This is equivalent to <code>Parse(signature).AsPipelineLayoutDesc()</code>, but repeated calls with the same signature
+only cost a hash lookup instead of tokenizing and parsing the string again. This function is thread-safe.
+\remarks Here is a usage example:
+\code
+for (MyMaterial& material : myMaterials)
+{
+    const LLGL::PipelineLayoutDescriptor& layoutDesc = LLGL::ParsePipelineLayoutDescCached("heap{ cbuffer(Scene@0), texture(1) }, sampler(2)");
+    material.pipelineLayout = myRenderer->CreatePipelineLayout(layoutDesc);
+}
+\endcode
+\see ParseContext::AsPipelineLayoutDesc
+\see ClearParseCache
+*/
+LLGL_EXPORT const PipelineLayoutDescriptor& ParsePipelineLayoutDescCached(const StringView& signature);
+
+/**
+\brief Releases all descriptors that have been interned by ParsePipelineLayoutDescCached.
+\remarks All references previously returned by ParsePipelineLayoutDescCached become invalid.
+\see ParsePipelineLayoutDescCached
+*/
+LLGL_EXPORT void ClearParseCache();
+
 /** @} */
 
 
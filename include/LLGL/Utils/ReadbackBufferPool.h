@@ -0,0 +1,154 @@
+/*
+ * ReadbackBufferPool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_READBACK_BUFFER_POOL_H
+#define LLGL_READBACK_BUFFER_POOL_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/NonCopyable.h>
+#include <LLGL/ForwardDecls.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+struct TextureRegion;
+
+//! Handle of a readback request in a ReadbackBufferPool. Zero is the invalid handle.
+using ReadbackRequest = std::uint32_t;
+
+/**
+\brief Readback buffer pool descriptor structure.
+\see ReadbackBufferPool
+*/
+struct ReadbackBufferPoolDescriptor
+{
+    //! Optional name for debugging purposes. This is assigned to all buffers of the pool. By default null.
+    const char*     debugName       = nullptr;
+
+    //! Minimum size (in bytes) of each buffer. Request sizes are rounded up to the next power of two of at least this size. By default 256.
+    std::uint64_t   minBufferSize   = 256;
+};
+
+/**
+\brief Pool of readback buffers to copy GPU data into CPU memory without stalling.
+\remarks Each request copies a buffer range or texture region into a pooled buffer that was created with MiscFlags::Readback.
+The requests that were recorded since the previous call to Submit are associated with the fence value that is passed to Submit.
+A request is ready once its fence has reached that value, which is polled with Fence::GetCompletedValue and never blocks.
+Buffers of released requests are reused once their fence has been signaled.
+\remarks Here is an example usage:
+\code
+myCmdBuffer->Begin();
+{
+    ...
+    myRequest = myReadbackPool.CopyTexture(*myCmdBuffer, *myTexture, myRegion);
+}
+myCmdBuffer->End();
+
+myCmdQueue->Submit(*myCmdBuffer);
+myCmdQueue->Submit(*myFence, ++myFenceValue);
+myReadbackPool.Submit(*myFence, myFenceValue);
+
+// Some frames later
+if (const void* data = myReadbackPool.Map(myRequest))
+{
+    ProcessPixels(data, myReadbackPool.GetSize(myRequest));
+    myReadbackPool.Unmap(myRequest);
+    myReadbackPool.Release(myRequest);
+}
+\endcode
+*/
+class LLGL_EXPORT ReadbackBufferPool final : public NonCopyable
+{
+
+    public:
+
+        struct Pimpl;
+
+        /**
+        \brief Initializes the pool for the specified render system.
+        \param[in] renderSystem Specifies the render system that is used to create all buffers.
+        This render system must outlive the pool.
+        \param[in] desc Specifies the descriptor of the pool.
+        */
+        ReadbackBufferPool(RenderSystem& renderSystem, const ReadbackBufferPoolDescriptor& desc = {});
+
+        //! Releases all buffers of this pool. The GPU must no longer write to any of them.
+        ~ReadbackBufferPool();
+
+        /**
+        \brief Records a copy of the specified buffer range into a pooled readback buffer.
+        \param[in] commandBuffer Specifies the command buffer that is currently recording.
+        \param[in] srcBuffer Specifies the source buffer. This must have been created with BindFlags::CopySrc.
+        \param[in] srcOffset Specifies the offset (in bytes) of the source range.
+        \param[in] size Specifies the size (in bytes) of the source range. This must not be zero.
+        \return Handle of the new request or zero if the readback buffer could not be created.
+        */
+        ReadbackRequest CopyBuffer(CommandBuffer& commandBuffer, Buffer& srcBuffer, std::uint64_t srcOffset, std::uint64_t size);
+
+        /**
+        \brief Records a copy of the specified texture region into a pooled readback buffer.
+        \param[in] commandBuffer Specifies the command buffer that is currently recording.
+        \param[in] srcTexture Specifies the source texture. This must have been created with BindFlags::CopySrc.
+        \param[in] srcRegion Specifies the source region. The \c numMipLevels attribute of its subresource must be 1.
+        \return Handle of the new request or zero if the readback buffer could not be created.
+        \remarks The texels are tightly packed in the readback buffer as described by GetMemoryFootprint.
+        \see CommandBuffer::CopyBufferFromTexture
+        */
+        ReadbackRequest CopyTexture(CommandBuffer& commandBuffer, Texture& srcTexture, const TextureRegion& srcRegion);
+
+        /**
+        \brief Associates all requests since the previous call to Submit with the specified fence value.
+        \param[in] fence Specifies the fence that is signaled after the command buffers of the requests have been submitted.
+        This fence must outlive all requests that are associated with it.
+        \param[in] value Specifies the value the fence is signaled with (see CommandQueue::Submit(Fence&, std::uint64_t)).
+        */
+        void Submit(Fence& fence, std::uint64_t value);
+
+        //! Returns true if the GPU has finished writing the specified request. This never blocks.
+        bool IsReady(ReadbackRequest request) const;
+
+        /**
+        \brief Maps the readback buffer of the specified request into CPU memory.
+        \return Pointer to the data of the request or null if the request is invalid or not ready yet.
+        \remarks This neither copies data nor waits for the GPU.
+        */
+        const void* Map(ReadbackRequest request);
+
+        //! Unmaps the readback buffer of the specified request.
+        void Unmap(ReadbackRequest request);
+
+        //! Returns the size (in bytes) of the data of the specified request or zero if the handle is invalid.
+        std::uint64_t GetSize(ReadbackRequest request) const;
+
+        /**
+        \brief Releases the specified request and returns its buffer to the pool.
+        \remarks Requests that are not ready yet can be released too; their buffers are reused once the GPU has finished writing them.
+        */
+        void Release(ReadbackRequest request);
+
+        //! Returns the total size (in bytes) of all buffers that are currently owned by this pool.
+        std::uint64_t GetTotalBufferSize() const;
+
+    private:
+
+        Pimpl* pimpl_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
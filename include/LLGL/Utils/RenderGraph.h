@@ -0,0 +1,237 @@
+/*
+ * RenderGraph.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_RENDER_GRAPH_H
+#define LLGL_RENDER_GRAPH_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/NonCopyable.h>
+#include <LLGL/ForwardDecls.h>
+#include <LLGL/TextureFlags.h>
+#include <LLGL/BufferFlags.h>
+#include <LLGL/CommandBufferFlags.h>
+#include <functional>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+//! Handle of a virtual resource in a RenderGraph. Handles are only valid until the next call to RenderGraph::Reset.
+using RenderGraphResource = std::uint32_t;
+
+//! Handle of a pass in a RenderGraph. Handles are only valid until the next call to RenderGraph::Reset.
+using RenderGraphPass = std::uint32_t;
+
+//! Callback to record the commands of a render graph pass.
+using RenderGraphPassCallback = std::function<void(CommandBuffer& commandBuffer)>;
+
+/**
+\brief Render graph pass flags.
+\see RenderGraph::AddPass
+*/
+struct RenderGraphPassFlags
+{
+    enum
+    {
+        /**
+        \brief Specifies that the pass only records compute and copy commands and may be scheduled on an asynchronous compute queue.
+        \remarks This is only taken into account by RenderGraph::Execute() if the render system provides a compute queue
+        that is different from the primary command queue. Otherwise, the pass is executed on the primary command queue.
+        \see CommandQueueFlags::Compute
+        */
+        AsyncCompute    = (1 << 0),
+
+        /**
+        \brief Specifies that the pass must never be culled, even if none of its outputs are consumed by other passes.
+        \remarks Passes that write to imported resources or to an imported render target are never culled either.
+        */
+        NeverCull       = (1 << 1),
+    };
+};
+
+/**
+\brief Render graph utility to schedule passes with automatically managed transient resources.
+\remarks Passes are declared in submission order together with the resources they read and write.
+When the graph is compiled, it culls all passes whose outputs are never consumed, determines the lifetime of each transient resource,
+and assigns physical resources such that transient resources with non-overlapping lifetimes and equal descriptors share the same object.
+Physical resources are pooled across frames and released once they have not been used for several frames.
+\remarks The load and store operations of all render pass attachments are derived from the graph:
+attachments are only loaded if previous passes wrote to them and only stored if subsequent passes read from them.
+\remarks Resource state transitions are still handled by each backend when the resources are bound,
+since the separation into passes already provides the backends with the points where transitions are required.
+\remarks Here is an example usage:
+\code
+myRenderGraph.Reset();
+
+// Declare transient G-Buffer and a pass that renders into it
+LLGL::RenderGraphResource gbuffer = myRenderGraph.CreateTexture(LLGL::Texture2DDesc(LLGL::Format::RGBA8UNorm, 800, 600), "GBuffer");
+LLGL::RenderGraphResource depthBuffer = myRenderGraph.CreateTexture(LLGL::Texture2DDesc(LLGL::Format::D32Float, 800, 600), "DepthBuffer");
+
+LLGL::RenderGraphPass geometryPass = myRenderGraph.AddPass("Geometry", [&](LLGL::CommandBuffer& cmdBuffer) { ... });
+myRenderGraph.SetColorAttachment(geometryPass, 0, gbuffer, &myClearColor);
+myRenderGraph.SetDepthStencilAttachment(geometryPass, depthBuffer, &myClearDepth);
+
+// Declare pass that reads from the G-Buffer and renders into the swap-chain
+LLGL::RenderGraphPass lightingPass = myRenderGraph.AddPass("Lighting", [&](LLGL::CommandBuffer& cmdBuffer) {
+    cmdBuffer.SetResource(0, *myRenderGraph.GetTexture(gbuffer));
+    ...
+});
+myRenderGraph.Read(lightingPass, gbuffer);
+myRenderGraph.SetRenderTarget(lightingPass, *mySwapChain);
+
+// Compile the graph, then record and submit all passes
+myRenderGraph.Execute();
+mySwapChain->Present();
+\endcode
+*/
+class LLGL_EXPORT RenderGraph final : public NonCopyable
+{
+
+    public:
+
+        struct Pimpl;
+
+        /**
+        \brief Initializes the render graph for the specified render system.
+        \param[in] renderSystem Specifies the render system that is used to create all physical resources.
+        This render system must outlive the render graph.
+        */
+        RenderGraph(RenderSystem& renderSystem);
+
+        //! Releases all physical resources of this render graph.
+        ~RenderGraph();
+
+    public:
+
+        /* ----- Resources ----- */
+
+        /**
+        \brief Declares a new transient texture.
+        \param[in] textureDesc Specifies the descriptor of the texture.
+        The binding flags for all declared accesses are added automatically, e.g. BindFlags::ColorAttachment when the texture is used as color attachment.
+        \param[in] name Optional name for debugging purposes. By default null.
+        \remarks The physical texture is only available during RenderGraph::Execute and its previous content is undefined at the first pass that uses it.
+        */
+        RenderGraphResource CreateTexture(const TextureDescriptor& textureDesc, const char* name = nullptr);
+
+        /**
+        \brief Declares a new transient buffer.
+        \param[in] bufferDesc Specifies the descriptor of the buffer.
+        The binding flags for all declared accesses are added automatically, e.g. BindFlags::Sampled when the buffer is read by a pass.
+        \param[in] name Optional name for debugging purposes. By default null.
+        */
+        RenderGraphResource CreateBuffer(const BufferDescriptor& bufferDesc, const char* name = nullptr);
+
+        /**
+        \brief Imports an existing texture into this render graph.
+        \remarks Imported resources can be accessed outside of the graph, so passes that write to them are never culled.
+        */
+        RenderGraphResource ImportTexture(Texture& texture);
+
+        //! Imports an existing buffer into this render graph. \see ImportTexture
+        RenderGraphResource ImportBuffer(Buffer& buffer);
+
+        /* ----- Passes ----- */
+
+        /**
+        \brief Adds a new pass to this render graph.
+        \param[in] name Optional name of the pass. This is also used as debug group name when the pass is recorded.
+        \param[in] callback Specifies the callback that records the commands of this pass.
+        If the pass has any attachments or a render target, the callback is invoked within a render pass section.
+        \param[in] flags Specifies optional pass flags. This can be a bitwise OR combination of the RenderGraphPassFlags entries. By default 0.
+        \remarks Passes are executed in the order they are added.
+        */
+        RenderGraphPass AddPass(const char* name, const RenderGraphPassCallback& callback, long flags = 0);
+
+        //! Declares that the specified pass reads from the specified resource, e.g. as sampled texture or constant buffer.
+        void Read(RenderGraphPass pass, RenderGraphResource resource);
+
+        //! Declares that the specified pass writes to the specified resource, e.g. as storage resource or copy destination.
+        void Write(RenderGraphPass pass, RenderGraphResource resource);
+
+        /**
+        \brief Declares that the specified pass renders into the specified texture as color attachment.
+        \param[in] pass Specifies the pass that renders into the attachment.
+        \param[in] index Specifies the zero-based index of the color attachment. This must be less than \c LLGL_MAX_NUM_COLOR_ATTACHMENTS.
+        \param[in] resource Specifies the texture resource.
+        \param[in] clearValue Optional pointer to the value the attachment is cleared with when the render pass begins. By default null.
+        If this is null, the previous content is loaded if any previous pass wrote to this texture.
+        */
+        void SetColorAttachment(RenderGraphPass pass, std::uint32_t index, RenderGraphResource resource, const ClearValue* clearValue = nullptr);
+
+        //! Declares that the specified pass renders into the specified texture as depth-stencil attachment. \see SetColorAttachment
+        void SetDepthStencilAttachment(RenderGraphPass pass, RenderGraphResource resource, const ClearValue* clearValue = nullptr);
+
+        /**
+        \brief Declares that the specified pass renders into an external render target, such as a swap-chain.
+        \remarks This cannot be used in combination with attachments of the same pass. Such a pass is never culled.
+        The callback of this pass is responsible for clearing the render target.
+        */
+        void SetRenderTarget(RenderGraphPass pass, RenderTarget& renderTarget);
+
+        /* ----- Execution ----- */
+
+        /**
+        \brief Culls unused passes and assigns physical resources to all transient resources.
+        \remarks This is called automatically by the Execute functions if the graph has changed.
+        Afterwards, the physical resources can be queried with GetTexture and GetBuffer to create resource heaps or pipeline states ahead of execution.
+        */
+        void Compile();
+
+        /**
+        \brief Records all passes into internal command buffers and submits them to the command queues of the render system.
+        \remarks Passes that were added with RenderGraphPassFlags::AsyncCompute are submitted to the compute queue
+        and are synchronized with the primary command queue by fences wherever they depend on each other.
+        \see RenderSystem::GetCommandQueue(long)
+        */
+        void Execute();
+
+        /**
+        \brief Records all passes into the specified command buffer, which must currently be recording.
+        \remarks All passes are recorded into this command buffer, including those that were added with RenderGraphPassFlags::AsyncCompute.
+        */
+        void Execute(CommandBuffer& commandBuffer);
+
+        /**
+        \brief Clears all passes and resource declarations. Physical resources are kept for the next frame.
+        \remarks This invalidates all previous handles.
+        */
+        void Reset();
+
+        //! Returns the texture that is assigned to the specified resource, or null if the graph has not been compiled or the resource is not a texture.
+        Texture* GetTexture(RenderGraphResource resource) const;
+
+        //! Returns the buffer that is assigned to the specified resource, or null if the graph has not been compiled or the resource is not a buffer.
+        Buffer* GetBuffer(RenderGraphResource resource) const;
+
+        /**
+        \brief Returns the render pass the specified pass is recorded with, or null if the graph has not been compiled or the pass has no attachments.
+        \remarks This can be used to create pipeline states that are compatible with the attachments of the pass.
+        */
+        const RenderPass* GetRenderPass(RenderGraphPass pass) const;
+
+        //! Returns true if the specified pass has been culled by the last compilation.
+        bool IsPassCulled(RenderGraphPass pass) const;
+
+    private:
+
+        Pimpl* pimpl_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,129 @@
+/*
+ * TextureContainer.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_TEXTURE_CONTAINER_H
+#define LLGL_TEXTURE_CONTAINER_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/NonCopyable.h>
+#include <LLGL/ForwardDecls.h>
+#include <LLGL/ImageFlags.h>
+#include <LLGL/TextureFlags.h>
+#include <LLGL/Blob.h>
+#include <LLGL/Container/ArrayView.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Texture container file format enumeration.
+\see TextureContainer::GetContainerFormat
+*/
+enum class TextureContainerFormat
+{
+    Undefined,  //!< No container has been loaded.
+    DDS,        //!< DirectDraw Surface (DDS) container, including the DX10 header extension.
+    KTX2,       //!< Khronos Texture 2.0 (KTX2) container.
+};
+
+/**
+\brief Image data of a range of array layers within a single MIP-map level of a texture container.
+\remarks The image view points directly into the blob of the container, i.e. it is only valid as long as the container is alive.
+\see TextureContainer::GetImages
+*/
+struct TextureContainerImage
+{
+    //! Texture region this image covers. The MIP-map level is specified by \c region.subresource.baseMipLevel.
+    TextureRegion   region;
+
+    //! Image view into the container blob for all array layers of \c region. The data is already in the hardware format of the texture.
+    ImageView       image;
+};
+
+/**
+\brief Reads DDS and KTX2 texture containers and provides image views for all of their subresources without copying the image data.
+\remarks The container keeps the blob it was loaded from, so a memory mapped file (see Blob::CreateFromFileMapped)
+is copied only once when the subresources are written into the staging memory of the render system.
+\remarks KTX2 files are laid out by MIP-map level, so there is one image per MIP-map level that covers all array layers and cube faces.
+DDS files are laid out by array layer, so there is one image per array layer and MIP-map level.
+\remarks Supercompressed KTX2 files (i.e. Basis Universal, Zstandard, and ZLIB) are not supported, since they must be decompressed before the upload.
+\remarks Here is an example usage:
+\code
+LLGL::TextureContainer myContainer;
+if (myContainer.Load(LLGL::Blob::CreateFromFileMapped("MyTexture.ktx2")))
+    myTexture = myContainer.CreateTexture(*myRenderer);
+\endcode
+\see TextureStreamer
+*/
+class LLGL_EXPORT TextureContainer final : public NonCopyable
+{
+
+    public:
+
+        struct Pimpl;
+
+        //! Initializes an empty container.
+        TextureContainer();
+
+        //! Releases the blob of this container. All image views that were returned by GetImages become invalid.
+        ~TextureContainer();
+
+        /**
+        \brief Parses the specified blob as a DDS or KTX2 container. The format is determined by the file identifier.
+        \param[in] blob Specifies the blob of the entire container file. This blob is kept alive by the container.
+        \param[out] report Optional output report that receives the reason why the container could not be parsed.
+        \return True on success. Otherwise, the container is empty.
+        */
+        bool Load(Blob&& blob, Report* report = nullptr);
+
+        //! Returns the format of the container that has been loaded or TextureContainerFormat::Undefined if the container is empty.
+        TextureContainerFormat GetContainerFormat() const;
+
+        /**
+        \brief Returns the descriptor that fits the texture of this container.
+        \remarks The bind flags are TextureDescriptor::bindFlags by default and MiscFlags::GenerateMips is only set
+        if the container does not provide any MIP-map levels other than the first one.
+        */
+        const TextureDescriptor& GetDescriptor() const;
+
+        //! Returns the images for all subresources of this container, ordered by MIP-map level from the most detailed level.
+        ArrayView<TextureContainerImage> GetImages() const;
+
+        /**
+        \brief Creates a texture with the descriptor of this container and writes all of its subresources.
+        \param[in] renderSystem Specifies the render system that creates the texture.
+        \param[in] bindFlags Specifies the bind flags for the new texture. By default BindFlags::Sampled.
+        \return Pointer to the new texture or null if the container is empty or the texture could not be created.
+        */
+        Texture* CreateTexture(RenderSystem& renderSystem, long bindFlags = BindFlags::Sampled) const;
+
+        /**
+        \brief Writes all subresources of this container into the specified texture.
+        \param[in] renderSystem Specifies the render system the texture was created with.
+        \param[in] texture Specifies the destination texture. This must have at least the MIP-map levels and array layers of this container.
+        */
+        void WriteTexture(RenderSystem& renderSystem, Texture& texture) const;
+
+    private:
+
+        Pimpl* pimpl_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
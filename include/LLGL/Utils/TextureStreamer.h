@@ -0,0 +1,247 @@
+/*
+ * TextureStreamer.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_TEXTURE_STREAMER_H
+#define LLGL_TEXTURE_STREAMER_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/NonCopyable.h>
+#include <LLGL/ForwardDecls.h>
+#include <LLGL/ImageFlags.h>
+#include <LLGL/Blob.h>
+#include <LLGL/Container/ArrayView.h>
+#include <functional>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class ThreadPool;
+
+//! Handle of a texture stream in a TextureStreamer. Zero is the invalid handle.
+using TextureStream = std::uint32_t;
+
+/**
+\brief Image data of a single MIP-map level that is provided by a TextureStreamLoader.
+\see TextureStreamLoader
+*/
+struct TextureStreamImage
+{
+    //! Specifies the image format of the data. By default ImageFormat::RGBA.
+    ImageFormat format      = ImageFormat::RGBA;
+
+    //! Specifies the data type of the image data. This must be DataType::UInt8 for compressed images. By default DataType::UInt8.
+    DataType    dataType    = DataType::UInt8;
+
+    /**
+    \brief Image data of all array layers of the MIP-map level.
+    \remarks The blob can be a mapped file (see Blob::CreateFromFileMapped) to avoid copying the data before it is uploaded.
+    */
+    Blob        data;
+};
+
+/**
+\brief Range of a file that contains the image data of a single MIP-map level.
+\remarks The image data must already be in the hardware format of the texture (e.g. BC7 blocks for a texture with format Format::BC7UNorm),
+so it can be passed to the render system without any conversion.
+\see TextureStreamDescriptor::fileRanges
+*/
+struct TextureStreamFileRange
+{
+    //! Offset (in bytes) of the image data within the file.
+    std::uint64_t   offset  = 0;
+
+    //! Size (in bytes) of the image data of all array layers.
+    std::size_t     size    = 0;
+};
+
+/**
+\brief Callback to load the image data of a single MIP-map level.
+\param[in] mipLevel Specifies the MIP-map level of the texture that is to be loaded.
+\param[out] outImage Specifies the output image the data is written to.
+\return True if the image was loaded successfully. Otherwise, the stream stops and all remaining MIP-map levels stay non-resident.
+\remarks This callback is invoked by the worker threads of the thread pool, so it must not call into the render system.
+*/
+using TextureStreamLoader = std::function<bool(std::uint32_t mipLevel, TextureStreamImage& outImage)>;
+
+/**
+\brief Callback that is invoked when a MIP-map level of a texture stream has been uploaded.
+\param[in] texture Specifies the texture of the stream.
+\param[in] mipLevel Specifies the new most detailed resident MIP-map level. All levels from this one up to the last level of the stream are now resident.
+\remarks This callback is invoked by TextureStreamer::Update. It can be used to widen the MIP-map range of texture views or the minimum LOD of samplers.
+This callback must not enqueue or release any streams of the same streamer.
+*/
+using TextureStreamCallback = std::function<void(Texture& texture, std::uint32_t mipLevel)>;
+
+/**
+\brief Texture streamer descriptor structure.
+\see TextureStreamer
+*/
+struct TextureStreamerDescriptor
+{
+    /**
+    \brief Maximum number of bytes that are uploaded by each call to TextureStreamer::Update. By default 16 MiB.
+    \remarks A MIP-map level that is larger than this budget is uploaded on its own once nothing else was uploaded in the same call,
+    so large textures are never starved.
+    */
+    std::uint64_t   frameBudget         = 16ull * 1024ull * 1024ull;
+
+    /**
+    \brief Maximum number of MIP-map levels that are loaded concurrently. By default 4.
+    \remarks This limits the CPU memory of image data that has been loaded but not uploaded yet.
+    */
+    std::uint32_t   maxConcurrentLoads  = 4;
+
+    /**
+    \brief Optional thread pool the loaders are executed by. If this is null, the global thread pool is used. By default null.
+    \see ThreadPool::GetGlobal
+    */
+    ThreadPool*     threadPool          = nullptr;
+};
+
+/**
+\brief Texture stream descriptor structure.
+\remarks Either \c images, \c filename with \c fileRanges, or \c loader must be specified. MIP-map levels are streamed from the least detailed level to the most detailed level.
+\see TextureStreamer::Enqueue
+*/
+struct TextureStreamDescriptor
+{
+    /**
+    \brief Texture the MIP-map levels are uploaded to.
+    \remarks This texture must have been created with all MIP-map levels of the stream and must stay alive while the stream is active.
+    */
+    Texture*                            texture         = nullptr;
+
+    //! Most detailed MIP-map level that is streamed. By default 0.
+    std::uint32_t                       baseMipLevel    = 0;
+
+    //! Number of MIP-map levels that are streamed. If this is zero, all remaining MIP-map levels of the texture are streamed. By default 0.
+    std::uint32_t                       numMipLevels    = 0;
+
+    /**
+    \brief Optional image views for each streamed MIP-map level. The first entry is \c baseMipLevel.
+    \remarks The image data must stay valid until the respective MIP-map level has been uploaded.
+    If this is empty, \c filename or \c loader is used instead.
+    */
+    ArrayView<ImageView>                images;
+
+    /**
+    \brief Optional filename of a texture container the MIP-map levels are read from if \c images is empty.
+    \remarks The file ranges are mapped into memory on the worker threads and passed to RenderSystem::WriteTexture directly,
+    i.e. the image data is copied from the file straight into the staging memory of the render system without an intermediate image.
+    \see fileRanges
+    */
+    const char*                         filename        = nullptr;
+
+    //! File ranges for each streamed MIP-map level within the file specified by \c filename. The first entry is \c baseMipLevel.
+    ArrayView<TextureStreamFileRange>   fileRanges;
+
+    //! Optional loader that provides the image data for each MIP-map level if neither \c images nor \c filename is specified.
+    TextureStreamLoader                 loader;
+
+    //! Optional callback that is invoked when a new MIP-map level is resident.
+    TextureStreamCallback               onResident;
+
+    /**
+    \brief Priority of the stream. Streams with a higher priority are loaded and uploaded first. By default 0.
+    \see TextureStreamer::SetPriority
+    */
+    float                               priority        = 0.0f;
+};
+
+/**
+\brief Uploads the MIP-map levels of textures asynchronously by priority within a byte budget per frame.
+\remarks Image data is loaded on the worker threads of a thread pool and uploaded via RenderSystem::WriteTexture during Update.
+The backends route these uploads through their staging ring and transfer queue where available, so Update never waits for the GPU to finish previous frames.
+MIP-map levels are uploaded from the least to the most detailed level, i.e. the resident levels always form a complete MIP-map tail.
+\remarks Here is an example usage:
+\code
+LLGL::TextureStreamDescriptor streamDesc;
+{
+    streamDesc.texture      = myTexture;
+    streamDesc.filename     = "MyTexture.dds";
+    streamDesc.fileRanges   = myMipRangesFromDDSHeader;
+    streamDesc.priority     = myDistanceToCamera;
+}
+LLGL::TextureStream myStream = myStreamer.Enqueue(streamDesc);
+
+// Once per frame
+myStreamer.Update();
+myMaterial.minLOD = static_cast<float>(myStreamer.GetResidentMipLevel(myStream));
+\endcode
+*/
+class LLGL_EXPORT TextureStreamer final : public NonCopyable
+{
+
+    public:
+
+        struct Pimpl;
+
+        /**
+        \brief Initializes the texture streamer for the specified render system.
+        \param[in] renderSystem Specifies the render system that is used to upload all MIP-map levels.
+        This render system must outlive the streamer.
+        \param[in] desc Specifies the descriptor of the streamer.
+        */
+        TextureStreamer(RenderSystem& renderSystem, const TextureStreamerDescriptor& desc = {});
+
+        //! Waits for all loaders that are currently executed and releases all streams.
+        ~TextureStreamer();
+
+        /**
+        \brief Enqueues a new texture stream.
+        \return Handle of the new stream or zero if the descriptor is invalid.
+        */
+        TextureStream Enqueue(const TextureStreamDescriptor& desc);
+
+        /**
+        \brief Stops the specified stream and releases its handle. MIP-map levels that are already resident stay in the texture.
+        \remarks A loader that is currently executed for this stream still runs to completion, but its result is discarded.
+        Streams are not released automatically when they complete, so their resident MIP-map level can still be queried.
+        */
+        void Release(TextureStream stream);
+
+        //! Changes the priority of the specified stream.
+        void SetPriority(TextureStream stream, float priority);
+
+        /**
+        \brief Starts loaders for pending MIP-map levels and uploads loaded MIP-map levels within the frame budget. This should be called once per frame.
+        \return Number of MIP-map levels that have been uploaded by this call.
+        */
+        std::uint32_t Update();
+
+        /**
+        \brief Returns the most detailed MIP-map level of the specified stream that is resident.
+        \return Resident MIP-map level or the end of the MIP-map range of the stream (i.e. \c baseMipLevel + \c numMipLevels) if no level is resident yet.
+        If the handle is invalid, the return value is zero.
+        */
+        std::uint32_t GetResidentMipLevel(TextureStream stream) const;
+
+        //! Returns true if the specified stream still has MIP-map levels to upload, i.e. it neither completed nor failed to load a MIP-map level.
+        bool IsStreaming(TextureStream stream) const;
+
+        //! Returns the number of streams that still have MIP-map levels to upload.
+        std::uint32_t GetNumActiveStreams() const;
+
+    private:
+
+        Pimpl* pimpl_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
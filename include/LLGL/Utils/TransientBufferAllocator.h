@@ -0,0 +1,168 @@
+/*
+ * TransientBufferAllocator.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_TRANSIENT_BUFFER_ALLOCATOR_H
+#define LLGL_TRANSIENT_BUFFER_ALLOCATOR_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/NonCopyable.h>
+#include <LLGL/ForwardDecls.h>
+#include <LLGL/BufferFlags.h>
+#include <LLGL/Container/ArrayView.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Transient buffer allocator descriptor structure.
+\see TransientBufferAllocator
+*/
+struct TransientBufferAllocatorDescriptor
+{
+    //! Optional name for debugging purposes. This is assigned to all buffers of the allocator. By default null.
+    const char*                 debugName           = nullptr;
+
+    /**
+    \brief Binding flags of all buffers of the allocator. This can be a bitwise OR combination of the BindFlags entries.
+    \remarks BindFlags::CopyDst is added automatically. By default BindFlags::ConstantBuffer.
+    */
+    long                        bindFlags           = BindFlags::ConstantBuffer;
+
+    /**
+    \brief Vertex attributes for buffers that are bound as vertex buffers.
+    \remarks This is only used if \c bindFlags contains BindFlags::VertexBuffer. The allocator keeps a copy of this list.
+    \see BufferDescriptor::vertexAttribs
+    */
+    ArrayView<VertexAttribute>  vertexAttribs;
+
+    /**
+    \brief Number of frames a buffer is kept after it has been allocated before it can be reused. By default 3.
+    \remarks This should be at least the number of frames the GPU can lag behind the CPU, e.g. SwapChainDescriptor::swapBuffers.
+    */
+    std::uint32_t               numFramesInFlight   = 3;
+
+    /**
+    \brief Minimum size (in bytes) of each buffer. Allocation sizes are rounded up to the next power of two of at least this size. By default 256.
+    \remarks The default value satisfies the constant buffer alignment of all backends.
+    */
+    std::uint64_t               minBufferSize       = 256;
+};
+
+/**
+\brief Allocation of a TransientBufferAllocator.
+\see TransientBufferAllocator::Allocate
+*/
+struct TransientBufferRange
+{
+    /**
+    \brief CPU pointer the data of this allocation is written to.
+    \remarks This pointer is only valid until the next call to TransientBufferAllocator::Flush.
+    */
+    void*           data    = nullptr;
+
+    /**
+    \brief Buffer object the data is uploaded to. This buffer is exclusively assigned to this allocation
+    and can be bound with any command that takes a buffer, e.g. CommandBuffer::SetResource or CommandBuffer::SetVertexBuffer.
+    \remarks The buffer may be larger than the allocation, since sizes are rounded up to the next power of two.
+    */
+    Buffer*         buffer  = nullptr;
+
+    //! Size (in bytes) of this allocation.
+    std::uint64_t   size    = 0;
+};
+
+/**
+\brief Allocator for dynamic per-frame buffer data, such as skinning matrices and particle vertices.
+\remarks Data is written directly into CPU memory that is owned by the allocator and uploaded with a single call to Flush
+which records the uploads into the command buffer, i.e. the data is copied into the staging pools of the command buffer during encoding.
+Each allocation is assigned a pooled buffer that is not handed out again until \c numFramesInFlight frames have passed,
+so uploads never have to wait for previous frames that are still read by the GPU.
+Buffers that have not been used for several frames are released.
+\remarks Here is an example usage:
+\code
+// Once per frame, before the first render pass
+myTransientAllocator.NextFrame();
+
+LLGL::TransientBufferRange bones = myTransientAllocator.Allocate(sizeof(Matrix4) * numBones);
+::memcpy(bones.data, myBoneMatrices, bones.size);
+
+myCmdBuffer->Begin();
+{
+    myTransientAllocator.Flush(*myCmdBuffer);
+    myCmdBuffer->BeginRenderPass(*mySwapChain);
+    {
+        myCmdBuffer->SetPipelineState(*myPipeline);
+        myCmdBuffer->SetResource(0, *bones.buffer);
+        ...
+    }
+    myCmdBuffer->EndRenderPass();
+}
+myCmdBuffer->End();
+\endcode
+*/
+class LLGL_EXPORT TransientBufferAllocator final : public NonCopyable
+{
+
+    public:
+
+        struct Pimpl;
+
+        /**
+        \brief Initializes the allocator for the specified render system.
+        \param[in] renderSystem Specifies the render system that is used to create all buffers.
+        This render system must outlive the allocator.
+        \param[in] desc Specifies the descriptor of the allocator.
+        */
+        TransientBufferAllocator(RenderSystem& renderSystem, const TransientBufferAllocatorDescriptor& desc = {});
+
+        //! Releases all buffers of this allocator.
+        ~TransientBufferAllocator();
+
+        /**
+        \brief Allocates a new transient buffer range for the current frame.
+        \param[in] size Specifies the size (in bytes) of the allocation. This must not be zero.
+        \return Allocation with a CPU pointer and the buffer that receives the data when Flush is called.
+        If the buffer could not be created, the returned range is empty.
+        */
+        TransientBufferRange Allocate(std::uint64_t size);
+
+        /**
+        \brief Records the uploads of all allocations since the previous call to Flush into the specified command buffer.
+        \param[in] commandBuffer Specifies the command buffer that is currently recording.
+        This should be called outside of a render pass, since it encodes CommandBuffer::UpdateBuffer commands.
+        \remarks All CPU pointers of the previous allocations are invalidated by this call.
+        */
+        void Flush(CommandBuffer& commandBuffer);
+
+        /**
+        \brief Advances to the next frame. This must be called once per frame.
+        \remarks Buffers that were allocated \c numFramesInFlight frames ago become available again.
+        */
+        void NextFrame();
+
+        //! Returns the total size (in bytes) of all buffers that are currently owned by this allocator.
+        std::uint64_t GetTotalBufferSize() const;
+
+    private:
+
+        Pimpl* pimpl_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
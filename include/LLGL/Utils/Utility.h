@@ -143,6 +143,32 @@ LLGL_EXPORT PipelineLayoutDescriptor PipelineLayoutDesc(const ShaderReflection&
 */
 LLGL_EXPORT RenderPassDescriptor RenderPassDesc(const RenderTargetDescriptor& renderTargetDesc);
 
+/* ----- Multi-GPU utility functions ----- */
+
+/**
+\brief Copies a range of a buffer from one render system into a buffer of another render system, e.g. to transfer results between two video adapters.
+\param[in] dstRenderSystem Specifies the render system that owns the destination buffer.
+\param[in] dstBuffer Specifies the destination buffer. This must have been created with \c dstRenderSystem.
+\param[in] dstOffset Specifies the offset (in bytes) within the destination buffer.
+\param[in] srcRenderSystem Specifies the render system that owns the source buffer. This must not be the same as \c dstRenderSystem; use CommandBuffer::CopyBuffer instead.
+\param[in] srcBuffer Specifies the source buffer. This must have been created with \c srcRenderSystem and the CPUAccessFlags::Read flag.
+\param[in] srcOffset Specifies the offset (in bytes) within the source buffer.
+\param[in] size Specifies the number of bytes to copy.
+\return True on success, or false if both render systems are the same or the source buffer could not be mapped into CPU memory space.
+\remarks The source buffer is mapped for reading and its memory is written directly into the destination buffer, so the data is staged in host memory only once.
+All pending commands on the source buffer must have been completed, e.g. with CommandQueue::WaitIdle, before this function is called.
+\see RenderSystemDescriptor::adapterIndex
+*/
+LLGL_EXPORT bool CopyBufferAcrossRenderSystems(
+    RenderSystem&   dstRenderSystem,
+    Buffer&         dstBuffer,
+    std::uint64_t   dstOffset,
+    RenderSystem&   srcRenderSystem,
+    Buffer&         srcBuffer,
+    std::uint64_t   srcOffset,
+    std::uint64_t   size
+);
+
 /** @} */
 
 
@@ -0,0 +1,226 @@
+/*
+ * VertexQuantization.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VERTEX_QUANTIZATION_H
+#define LLGL_VERTEX_QUANTIZATION_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/Format.h>
+#include <LLGL/Utils/VertexFormat.h>
+#include <LLGL/Container/ArrayView.h>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Compact encodings for floating-point vertex attributes.
+\remarks Source attributes must have one of the formats Format::R32Float, Format::RG32Float, Format::RGB32Float, or Format::RGBA32Float.
+Three-component attributes are padded to four components for all encodings that are not packed into a single vector,
+since most renderers do not support three-component vertex formats with 16-bit components. The padded component is 1.
+\see GetQuantizedVertexFormat
+\see QuantizeVertexAttribute
+*/
+enum class VertexQuantization
+{
+    //! The attribute is copied as is.
+    None = 0,
+
+    //! 16-bit floating-point components, e.g. for positions. Encoded as Format::R16Float, Format::RG16Float, or Format::RGBA16Float.
+    Float16,
+
+    /**
+    \brief 16-bit normalized unsigned integer components, e.g. for texture coordinates in the range [0, 1].
+    Encoded as Format::R16UNorm, Format::RG16UNorm, or Format::RGBA16UNorm. Values outside the range [0, 1] are clamped.
+    */
+    UNorm16,
+
+    /**
+    \brief 16-bit normalized signed integer components, e.g. for normals and positions in the range [-1, 1].
+    Encoded as Format::R16SNorm, Format::RG16SNorm, or Format::RGBA16SNorm. Values outside the range [-1, 1] are clamped.
+    */
+    SNorm16,
+
+    /**
+    \brief Normalized 10-10-10-2 vector in the range [-1, 1], e.g. for normals and tangents. Encoded as Format::RGB10A2UNorm.
+    \remarks Only three- and four-component attributes can be encoded.
+    All components are remapped from the range [-1, 1] to [0, 1], so the shader must decode the attribute with <code>value * 2 - 1</code>.
+    The fourth component only retains its sign, e.g. for the handedness of a tangent frame. Three-component attributes store 1 in the fourth component.
+    */
+    PackedRGB10A2,
+
+    /**
+    \brief Octahedral encoding of unit vectors with 16-bit normalized signed integer components, e.g. for normals. Encoded as Format::RG16SNorm.
+    \remarks Only three-component attributes can be encoded. Input vectors do not have to be normalized.
+    The shader must decode the attribute as follows:
+    \code
+    float3 DecodeOctahedral(float2 e)
+    {
+        float3 v = float3(e.x, e.y, 1.0 - abs(e.x) - abs(e.y));
+        float t = saturate(-v.z);
+        v.xy += (v.xy >= 0.0 ? -t : t);
+        return normalize(v);
+    }
+    \endcode
+    */
+    Octahedral16,
+
+    /**
+    \brief Octahedral encoding of unit vectors with 8-bit normalized signed integer components. Encoded as Format::RG8SNorm.
+    \remarks This has the same requirements as VertexQuantization::Octahedral16 but with only 8 bits of precision per component.
+    */
+    Octahedral8,
+};
+
+
+/* ----- Functions ----- */
+
+/**
+\brief Returns the vertex attribute format for the specified quantization.
+\param[in] quantization Specifies the encoding of the vertex attribute.
+\param[in] numComponents Specifies the number of floating-point components of the source attribute. This must be 1, 2, 3, or 4.
+\return Quantized vertex attribute format or Format::Undefined if the attribute cannot be encoded that way,
+e.g. when an octahedral encoding is requested for a two-component attribute.
+If \c quantization is VertexQuantization::None, the return value is the 32-bit floating-point format with the specified number of components.
+*/
+LLGL_EXPORT Format GetQuantizedVertexFormat(VertexQuantization quantization, std::uint32_t numComponents);
+
+/**
+\brief Encodes the specified floating-point vertex attribute into a compact format.
+\param[in] quantization Specifies the encoding of the vertex attribute.
+\param[in] numComponents Specifies the number of floating-point components of the source attribute. This must be 1, 2, 3, or 4.
+\param[in] numVertices Specifies the number of vertices to encode.
+\param[in] srcData Pointer to the first source attribute. Each attribute consists of \c numComponents 32-bit floats.
+\param[in] srcStride Specifies the stride (in bytes) between consecutive source attributes.
+\param[out] dstData Pointer to the first destination attribute. This receives the format determined by GetQuantizedVertexFormat.
+\param[in] dstStride Specifies the stride (in bytes) between consecutive destination attributes.
+\return True if the attribute has been encoded, or false if GetQuantizedVertexFormat returns Format::Undefined for the input parameters.
+\remarks This uses SSE4.1 and F16C on x86 and NEON on AArch64 if available.
+The source and destination ranges must not overlap.
+*/
+LLGL_EXPORT bool QuantizeVertexAttribute(
+    VertexQuantization  quantization,
+    std::uint32_t       numComponents,
+    std::size_t         numVertices,
+    const void*         srcData,
+    std::size_t         srcStride,
+    void*               dstData,
+    std::size_t         dstStride
+);
+
+/**
+\brief Returns the vertex format that QuantizeVertices produces for the specified source vertex format.
+\param[in] srcFormat Specifies the format of the interleaved source vertices. All attributes must refer to the same vertex buffer slot.
+\param[in] quantizations Specifies the encoding for each attribute in \c srcFormat.
+Attributes without an entry in this array and attributes that cannot be encoded with the requested quantization keep their original format.
+\remarks All attribute offsets and the stride are aligned to 4 bytes as required by Metal and many Vulkan implementations.
+The attribute names, locations, and slots are retained.
+\see GetQuantizedVertexFormat(VertexQuantization, std::uint32_t)
+*/
+inline VertexFormat GetQuantizedVertexFormat(const VertexFormat& srcFormat, const ArrayView<VertexQuantization>& quantizations)
+{
+    VertexFormat dstFormat;
+    dstFormat.attributes.reserve(srcFormat.attributes.size());
+
+    std::uint32_t offset = 0;
+
+    for (std::size_t i = 0; i < srcFormat.attributes.size(); ++i)
+    {
+        VertexAttribute attrib = srcFormat.attributes[i];
+
+        const FormatAttributes& formatAttribs = GetFormatAttribs(attrib.format);
+        if (i < quantizations.size() && formatAttribs.dataType == DataType::Float32)
+        {
+            /* Only replace format if the attribute can be encoded with the requested quantization */
+            const Format quantizedFormat = GetQuantizedVertexFormat(quantizations[i], formatAttribs.components);
+            if (quantizedFormat != Format::Undefined)
+                attrib.format = quantizedFormat;
+        }
+
+        attrib.offset = offset;
+        offset = (offset + attrib.GetSize() + 3u) & ~3u;
+
+        dstFormat.attributes.push_back(attrib);
+    }
+
+    dstFormat.SetStride(offset);
+
+    return dstFormat;
+}
+
+/**
+\brief Encodes the interleaved source vertices into the vertex format returned by GetQuantizedVertexFormat for the same input.
+\param[in] srcFormat Specifies the format of the interleaved source vertices. All attributes must refer to the same vertex buffer slot.
+\param[in] quantizations Specifies the encoding for each attribute in \c srcFormat. See GetQuantizedVertexFormat for details.
+\param[in] srcVertices Pointer to the source vertices. The stride between vertices is determined by \c srcFormat.
+\param[in] numVertices Specifies the number of vertices to encode.
+\param[out] dstVertices Pointer to the destination vertices. This must point to a buffer of at least
+<code>numVertices * GetQuantizedVertexFormat(srcFormat, quantizations).GetStride()</code> bytes.
+\return Vertex format of the destination vertices, which can be passed to BufferDescriptor::vertexAttribs and the vertex shader descriptor.
+\remarks Here is an example usage that shrinks a vertex with a 3D position, normal vector, and 2D texture coordinate from 32 to 16 bytes:
+\code
+const LLGL::VertexQuantization quantizations[] =
+{
+    LLGL::VertexQuantization::Float16,      // position
+    LLGL::VertexQuantization::Octahedral16, // normal
+    LLGL::VertexQuantization::UNorm16,      // texCoord
+};
+LLGL::VertexFormat packedFormat = LLGL::GetQuantizedVertexFormat(myVertexFormat, quantizations);
+std::vector<char> packedVertices(myVertices.size() * packedFormat.GetStride());
+LLGL::QuantizeVertices(myVertexFormat, quantizations, myVertices.data(), myVertices.size(), packedVertices.data());
+\endcode
+*/
+inline VertexFormat QuantizeVertices(
+    const VertexFormat&                     srcFormat,
+    const ArrayView<VertexQuantization>&    quantizations,
+    const void*                             srcVertices,
+    std::size_t                             numVertices,
+    void*                                   dstVertices)
+{
+    const VertexFormat dstFormat = GetQuantizedVertexFormat(srcFormat, quantizations);
+
+    const std::size_t srcStride = srcFormat.GetStride();
+    const std::size_t dstStride = dstFormat.GetStride();
+
+    for (std::size_t i = 0; i < srcFormat.attributes.size(); ++i)
+    {
+        const VertexAttribute&  srcAttrib   = srcFormat.attributes[i];
+        const VertexAttribute&  dstAttrib   = dstFormat.attributes[i];
+        const char*             src         = static_cast<const char*>(srcVertices) + srcAttrib.offset;
+        char*                   dst         = static_cast<char*>(dstVertices) + dstAttrib.offset;
+
+        if (srcAttrib.format != dstAttrib.format)
+        {
+            /* Encode attribute with the requested quantization */
+            QuantizeVertexAttribute(quantizations[i], GetFormatAttribs(srcAttrib.format).components, numVertices, src, srcStride, dst, dstStride);
+        }
+        else
+        {
+            /* Copy attribute as is */
+            const std::size_t attribSize = srcAttrib.GetSize();
+            for (std::size_t j = 0; j < numVertices; ++j)
+                std::memcpy(dst + j * dstStride, src + j * srcStride, attribSize);
+        }
+    }
+
+    return dstFormat;
+}
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -13,6 +13,7 @@
 #include <LLGL/Surface.h>
 #include <LLGL/WindowFlags.h>
 #include <LLGL/Key.h>
+#include <LLGL/Container/ArrayView.h>
 #include <memory>
 
 
@@ -186,6 +187,38 @@ class LLGL_EXPORT Window : public Surface
         //! Removes the specified event listener from this window.
         void RemoveEventListener(const EventListener* eventListener);
 
+        /**
+        \brief Enables or disables the event queue of this window. By default disabled.
+        \remarks While enabled, each event that is posted to this window is also recorded as a WindowEvent, so the application can iterate over all events of a frame
+        after Surface::ProcessEvents returned instead of receiving a virtual callback for each of them. Event listeners still receive all events.
+        \remarks High-frequency events are coalesced with the previous record if that record has the same type:
+        WindowEventType::LocalMotion and WindowEventType::Resize keep the latest value, WindowEventType::GlobalMotion and WindowEventType::WheelMotion accumulate their values,
+        and repeated WindowEventType::Update events are recorded only once.
+        \remarks Disabling the event queue also clears it.
+        \see GetEventQueue
+        */
+        void SetEventQueueEnabled(bool enable);
+
+        /**
+        \brief Returns the events that have been recorded since the last call to ClearEventQueue.
+        \remarks The returned array view is invalidated by the next event that is posted to this window and by ClearEventQueue.
+        \code
+        while (LLGL::Surface::ProcessEvents() && !myWindow->HasQuit()) {
+            for (const LLGL::WindowEvent& event : myWindow->GetEventQueue()) {
+                if (event.type == LLGL::WindowEventType::GlobalMotion)
+                    myCamera.Rotate(event.offset.x, event.offset.y);
+            }
+            myWindow->ClearEventQueue();
+            // Render frame ...
+        }
+        \endcode
+        \see SetEventQueueEnabled
+        */
+        ArrayView<WindowEvent> GetEventQueue() const;
+
+        //! Clears all recorded events of this window.
+        void ClearEventQueue();
+
         /**
         \brief Posts a 'Quit' event to all event listeners if the window is not yet in the 'Quit' state.
         \remarks If any of the event listener sets the \c veto flag to false within the \c OnQuit callback, the window will \e not be put into 'Quit' state.
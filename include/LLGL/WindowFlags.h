@@ -12,6 +12,7 @@
 #include <LLGL/Types.h>
 #include <LLGL/Constants.h>
 #include <LLGL/Container/Strings.h>
+#include <LLGL/Key.h>
 #include <cstdint>
 
 
@@ -19,6 +20,32 @@ namespace LLGL
 {
 
 
+/* ----- Enumerations ----- */
+
+/**
+\brief Window event type enumeration.
+\remarks Each entry corresponds to one callback of the Window::EventListener interface.
+\see WindowEvent::type
+*/
+enum class WindowEventType
+{
+    Quit,           //!< The window has been put into the 'Quit' state. \see Window::EventListener::OnQuit
+    KeyDown,        //!< A key has been pushed. Uses WindowEvent::keyCode. \see Window::EventListener::OnKeyDown
+    KeyUp,          //!< A key has been released. Uses WindowEvent::keyCode. \see Window::EventListener::OnKeyUp
+    DoubleClick,    //!< A mouse button has been double clicked. Uses WindowEvent::keyCode. \see Window::EventListener::OnDoubleClick
+    Char,           //!< A character has been typed. Uses WindowEvent::chr. \see Window::EventListener::OnChar
+    WheelMotion,    //!< The mouse wheel has been moved. Uses WindowEvent::wheelMotion. \see Window::EventListener::OnWheelMotion
+    LocalMotion,    //!< The mouse has been moved on the window. Uses WindowEvent::offset as mouse position. \see Window::EventListener::OnLocalMotion
+    GlobalMotion,   //!< The raw mouse input has moved. Uses WindowEvent::offset as relative motion. \see Window::EventListener::OnGlobalMotion
+    Resize,         //!< The window has been resized. Uses WindowEvent::size. \see Window::EventListener::OnResize
+    Update,         //!< The window received a timer update while it is being moved or resized. \see Window::EventListener::OnUpdate
+    GetFocus,       //!< The window got the keyboard focus. \see Window::EventListener::OnGetFocus
+    LostFocus,      //!< The window lost the keyboard focus. \see Window::EventListener::OnLostFocus
+};
+
+
+/* ----- Flags ----- */
+
 /**
 \brief Window creation flags.
 \see WindowDescriptor::flags
@@ -137,6 +164,35 @@ struct WindowDescriptor
     std::size_t     windowContextSize   = 0;
 };
 
+/**
+\brief Window event record structure.
+\remarks This is a plain record of an event that was posted to a window. Only the members that belong to the event type are used; all others are zero.
+\see Window::GetEventQueue
+*/
+struct WindowEvent
+{
+    //! Specifies the type of this event. This determines which of the other members are used.
+    WindowEventType type        = WindowEventType::Quit;
+
+    //! Key code for the event types WindowEventType::KeyDown, WindowEventType::KeyUp, and WindowEventType::DoubleClick.
+    Key             keyCode     = Key::Any;
+
+    //! Character for the event type WindowEventType::Char.
+    wchar_t         chr         = L'\0';
+
+    //! Mouse wheel motion for the event type WindowEventType::WheelMotion. Coalesced events accumulate this value.
+    int             wheelMotion = 0;
+
+    /**
+    \brief Mouse position for the event type WindowEventType::LocalMotion or relative motion for the event type WindowEventType::GlobalMotion.
+    \remarks Coalesced local motion events keep the latest position and coalesced global motion events accumulate the relative motion.
+    */
+    Offset2D        offset;
+
+    //! New client area size for the event type WindowEventType::Resize. Coalesced events keep the latest size.
+    Extent2D        size;
+};
+
 
 } // /namespace LLGL
 
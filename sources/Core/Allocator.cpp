@@ -0,0 +1,122 @@
+/*
+ * Allocator.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Container/Allocator.h>
+#include "Assertion.h"
+#include <atomic>
+#include <cstdlib>
+
+
+namespace LLGL
+{
+
+
+/*
+ * Default allocator
+ */
+
+// Over-aligned allocations store the pointer of the original allocation in front of the aligned memory block.
+static void* DefaultAllocate(std::size_t size, std::size_t alignment, void* /*userData*/)
+{
+    if (alignment <= alignof(std::max_align_t))
+        return std::malloc(size);
+
+    void* ptr = std::malloc(size + alignment + sizeof(void*));
+    if (ptr == nullptr)
+        return nullptr;
+
+    const std::uintptr_t alignedAddr = (reinterpret_cast<std::uintptr_t>(ptr) + sizeof(void*) + alignment - 1) & ~(alignment - 1);
+    void** alignedPtr = reinterpret_cast<void**>(alignedAddr);
+    alignedPtr[-1] = ptr;
+    return alignedPtr;
+}
+
+static void DefaultDeallocate(void* ptr, std::size_t /*size*/, std::size_t alignment, void* /*userData*/)
+{
+    if (alignment <= alignof(std::max_align_t))
+        std::free(ptr);
+    else
+        std::free(static_cast<void**>(ptr)[-1]);
+}
+
+// Callbacks are stored as separate function pointers, so they are constant initialized before any static object can allocate memory.
+static void* (*g_allocateCallback)(std::size_t, std::size_t, void*)             = DefaultAllocate;
+static void  (*g_deallocateCallback)(void*, std::size_t, std::size_t, void*)    = DefaultDeallocate;
+static void*    g_userData                                                      = nullptr;
+
+static std::atomic<std::uint64_t> g_numAllocations      { 0 };
+static std::atomic<std::uint64_t> g_numDeallocations    { 0 };
+static std::atomic<std::uint64_t> g_allocatedBytes      { 0 };
+
+
+/*
+ * Global functions
+ */
+
+LLGL_EXPORT void SetAllocator(const AllocatorCallbacks* callbacks)
+{
+    if (callbacks != nullptr)
+    {
+        LLGL_ASSERT_PTR(callbacks->allocate);
+        LLGL_ASSERT_PTR(callbacks->deallocate);
+        g_allocateCallback      = callbacks->allocate;
+        g_deallocateCallback    = callbacks->deallocate;
+        g_userData              = callbacks->userData;
+    }
+    else
+    {
+        g_allocateCallback      = DefaultAllocate;
+        g_deallocateCallback    = DefaultDeallocate;
+        g_userData              = nullptr;
+    }
+}
+
+LLGL_EXPORT void* AllocateMemory(std::size_t size, std::size_t alignment)
+{
+    /* Allocate at least one byte, so each allocation has a unique address */
+    if (size == 0)
+        size = 1;
+
+    void* ptr = g_allocateCallback(size, alignment, g_userData);
+    if (ptr == nullptr)
+        LLGL_TRAP("failed to allocate %zu bytes with alignment of %zu bytes", size, alignment);
+
+    g_numAllocations.fetch_add(1, std::memory_order_relaxed);
+    g_allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+
+    return ptr;
+}
+
+LLGL_EXPORT void FreeMemory(void* ptr, std::size_t size, std::size_t alignment)
+{
+    if (ptr == nullptr)
+        return;
+
+    if (size == 0)
+        size = 1;
+
+    g_deallocateCallback(ptr, size, alignment, g_userData);
+    g_numDeallocations.fetch_add(1, std::memory_order_relaxed);
+}
+
+LLGL_EXPORT AllocatorStatistics GetAllocatorStatistics()
+{
+    AllocatorStatistics stats;
+    {
+        stats.numAllocations    = g_numAllocations.load(std::memory_order_relaxed);
+        stats.numDeallocations  = g_numDeallocations.load(std::memory_order_relaxed);
+        stats.allocatedBytes    = g_allocatedBytes.load(std::memory_order_relaxed);
+    }
+    return stats;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,630 @@
+/*
+ * BCCompressor.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "BCCompressor.h"
+#include "Threading.h"
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+/*
+ * Internal structures
+ */
+
+// Source 4x4 block of RGBA8 texels in row-major order.
+struct BCSourceBlock
+{
+    std::uint8_t texels[16][4];
+};
+
+// Quantized endpoints and indices of an encoded BC1 color block.
+struct BCColorBlockEncoding
+{
+    std::uint16_t   color0      = 0;
+    std::uint16_t   color1      = 0;
+    std::uint32_t   indices     = 0;
+    int             error       = 0;
+};
+
+// Number of least-squares refinement passes for ImageCompressionQuality::High.
+static constexpr int g_numRefinementPasses = 2;
+
+
+/*
+ * Internal functions
+ */
+
+static void WriteUInt16LE(std::uint8_t* dst, std::uint16_t value)
+{
+    dst[0] = static_cast<std::uint8_t>(value & 0xFF);
+    dst[1] = static_cast<std::uint8_t>(value >> 8);
+}
+
+static void WriteUInt32LE(std::uint8_t* dst, std::uint32_t value)
+{
+    for_range(i, 4)
+        dst[i] = static_cast<std::uint8_t>((value >> (i * 8)) & 0xFF);
+}
+
+// Loads the 4x4 block at the specified texel position and repeats the border texels for incomplete blocks.
+static void LoadSourceBlock(
+    const std::uint8_t* src,
+    std::uint32_t       width,
+    std::uint32_t       height,
+    std::uint32_t       x,
+    std::uint32_t       y,
+    BCSourceBlock&      dst)
+{
+    for_range(row, 4u)
+    {
+        const std::uint32_t srcY = std::min(y + row, height - 1);
+        for_range(col, 4u)
+        {
+            const std::uint32_t srcX = std::min(x + col, width - 1);
+            ::memcpy(dst.texels[row*4 + col], src + (static_cast<std::size_t>(srcY) * width + srcX) * 4, 4);
+        }
+    }
+}
+
+// Quantizes the specified RGB color in range [0, 255] to R5G6B5.
+static std::uint16_t QuantizeRGBColor16Bit(const float (&rgb)[3])
+{
+    const int r = std::max(0, std::min(31, static_cast<int>(rgb[0] * (31.0f / 255.0f) + 0.5f)));
+    const int g = std::max(0, std::min(63, static_cast<int>(rgb[1] * (63.0f / 255.0f) + 0.5f)));
+    const int b = std::max(0, std::min(31, static_cast<int>(rgb[2] * (31.0f / 255.0f) + 0.5f)));
+    return static_cast<std::uint16_t>((r << 11) | (g << 5) | b);
+}
+
+// Expands the specified R5G6B5 color to RGB8 in the same way as the decoder.
+static void ExpandRGBColor16Bit(std::uint16_t src, int (&dst)[3])
+{
+    const int r = (src >> 11) & 0x1F;
+    const int g = (src >>  5) & 0x3F;
+    const int b = (src      ) & 0x1F;
+    dst[0] = (r << 3) | (r >> 2);
+    dst[1] = (g << 2) | (g >> 4);
+    dst[2] = (b << 3) | (b >> 2);
+}
+
+// Returns the interpolation weight of the second endpoint for the specified palette index.
+static float GetColorIndexWeight(std::uint32_t index, bool isFourColorMode)
+{
+    static const float weights4[4] = { 0.0f, 1.0f, 1.0f/3.0f, 2.0f/3.0f };
+    static const float weights3[4] = { 0.0f, 1.0f, 0.5f,      0.0f      };
+    return (isFourColorMode ? weights4[index] : weights3[index]);
+}
+
+// Selects the nearest palette entry for each texel of the block. Transparent texels are assigned to index 3 in the 3-color mode.
+static void EncodeColorIndices(
+    const BCSourceBlock&    block,
+    const bool              (&transparent)[16],
+    bool                    allowPunchThrough,
+    BCColorBlockEncoding&   encoding)
+{
+    int c0[3], c1[3];
+    ExpandRGBColor16Bit(encoding.color0, c0);
+    ExpandRGBColor16Bit(encoding.color1, c1);
+
+    /* Build palette with the same rounding as the decoder */
+    const bool isFourColorMode = (!allowPunchThrough || encoding.color0 > encoding.color1);
+    const std::uint32_t numColors = (isFourColorMode ? 4 : 3);
+
+    int palette[4][3];
+    for_range(i, 3)
+    {
+        palette[0][i] = c0[i];
+        palette[1][i] = c1[i];
+        if (isFourColorMode)
+        {
+            palette[2][i] = (2*c0[i] + c1[i] + 1) / 3;
+            palette[3][i] = (c0[i] + 2*c1[i] + 1) / 3;
+        }
+        else
+        {
+            palette[2][i] = (c0[i] + c1[i]) / 2;
+            palette[3][i] = 0;
+        }
+    }
+
+    encoding.indices    = 0;
+    encoding.error      = 0;
+
+    for_range(texel, 16u)
+    {
+        std::uint32_t bestIndex = 0;
+        if (transparent[texel])
+            bestIndex = 3;
+        else
+        {
+            int bestError = 0x7FFFFFFF;
+            for_range(index, numColors)
+            {
+                int error = 0;
+                for_range(i, 3)
+                {
+                    const int d = static_cast<int>(block.texels[texel][i]) - palette[index][i];
+                    error += d*d;
+                }
+                if (error < bestError)
+                {
+                    bestError = error;
+                    bestIndex = index;
+                }
+            }
+            encoding.error += bestError;
+        }
+        encoding.indices |= (bestIndex << (texel * 2));
+    }
+}
+
+// Quantizes the specified endpoints and selects the mode of the block: 4-color mode requires color0 > color1, 3-color mode requires color0 <= color1.
+static BCColorBlockEncoding EncodeColorEndpoints(
+    const BCSourceBlock&    block,
+    const bool              (&transparent)[16],
+    bool                    allowPunchThrough,
+    bool                    hasTransparency,
+    const float             (&endpoint0)[3],
+    const float             (&endpoint1)[3])
+{
+    BCColorBlockEncoding encoding;
+    {
+        encoding.color0 = QuantizeRGBColor16Bit(endpoint0);
+        encoding.color1 = QuantizeRGBColor16Bit(endpoint1);
+    }
+
+    if (hasTransparency ? (encoding.color0 > encoding.color1) : (encoding.color0 < encoding.color1))
+        std::swap(encoding.color0, encoding.color1);
+
+    EncodeColorIndices(block, transparent, allowPunchThrough, encoding);
+    return encoding;
+}
+
+// Computes the endpoints as the corners of the bounding box of the specified colors along the diagonal that matches their correlation.
+static void ComputeBoundingBoxEndpoints(const float (*colors)[3], std::size_t count, float (&endpoint0)[3], float (&endpoint1)[3])
+{
+    float mean[3] = { 0.0f, 0.0f, 0.0f };
+    for_range(i, 3)
+    {
+        endpoint0[i] = 0.0f;
+        endpoint1[i] = 255.0f;
+    }
+    for_range(texel, count)
+    {
+        for_range(i, 3)
+        {
+            endpoint0[i] = std::max(endpoint0[i], colors[texel][i]);
+            endpoint1[i] = std::min(endpoint1[i], colors[texel][i]);
+            mean[i] += colors[texel][i];
+        }
+    }
+
+    /* Flip green and blue range if they are anti-correlated with the red channel */
+    for_range(i, 3)
+        mean[i] /= static_cast<float>(count);
+
+    float covRG = 0.0f, covRB = 0.0f;
+    for_range(texel, count)
+    {
+        const float dr = colors[texel][0] - mean[0];
+        covRG += dr * (colors[texel][1] - mean[1]);
+        covRB += dr * (colors[texel][2] - mean[2]);
+    }
+
+    if (covRG < 0.0f)
+        std::swap(endpoint0[1], endpoint1[1]);
+    if (covRB < 0.0f)
+        std::swap(endpoint0[2], endpoint1[2]);
+}
+
+// Computes the endpoints as the extreme projections of the specified colors onto their principal axis.
+static void ComputePrincipalAxisEndpoints(const float (*colors)[3], std::size_t count, float (&endpoint0)[3], float (&endpoint1)[3])
+{
+    /* Compute mean and covariance matrix */
+    float mean[3] = { 0.0f, 0.0f, 0.0f };
+    for_range(texel, count)
+    {
+        for_range(i, 3)
+            mean[i] += colors[texel][i];
+    }
+    for_range(i, 3)
+        mean[i] /= static_cast<float>(count);
+
+    float cov[3][3] = {};
+    for_range(texel, count)
+    {
+        const float d[3] = { colors[texel][0] - mean[0], colors[texel][1] - mean[1], colors[texel][2] - mean[2] };
+        for_range(row, 3)
+        {
+            for_range(col, 3)
+                cov[row][col] += d[row] * d[col];
+        }
+    }
+
+    /* Find principal axis by power iteration, starting with the diagonal of the bounding box */
+    float axis[3];
+    ComputeBoundingBoxEndpoints(colors, count, endpoint0, endpoint1);
+    for_range(i, 3)
+        axis[i] = endpoint0[i] - endpoint1[i];
+
+    for_range(iteration, 8)
+    {
+        float next[3];
+        for_range(row, 3)
+            next[row] = cov[row][0]*axis[0] + cov[row][1]*axis[1] + cov[row][2]*axis[2];
+
+        const float maxComponent = std::max(std::abs(next[0]), std::max(std::abs(next[1]), std::abs(next[2])));
+        if (maxComponent < 1.0e-6f)
+            break;
+
+        for_range(i, 3)
+            axis[i] = next[i] / maxComponent;
+    }
+
+    const float lengthSq = axis[0]*axis[0] + axis[1]*axis[1] + axis[2]*axis[2];
+    if (lengthSq < 1.0e-6f)
+    {
+        /* All colors are identical; keep bounding box endpoints */
+        return;
+    }
+
+    /* Project colors onto principal axis */
+    float minT = 0.0f, maxT = 0.0f;
+    for_range(texel, count)
+    {
+        const float t =
+        (
+            (colors[texel][0] - mean[0]) * axis[0] +
+            (colors[texel][1] - mean[1]) * axis[1] +
+            (colors[texel][2] - mean[2]) * axis[2]
+        ) / lengthSq;
+        minT = std::min(minT, t);
+        maxT = std::max(maxT, t);
+    }
+
+    for_range(i, 3)
+    {
+        endpoint0[i] = std::max(0.0f, std::min(255.0f, mean[i] + axis[i] * maxT));
+        endpoint1[i] = std::max(0.0f, std::min(255.0f, mean[i] + axis[i] * minT));
+    }
+}
+
+// Solves the least-squares endpoints for the palette indices of the specified encoding. Returns false if the system is singular.
+static bool RefineColorEndpoints(
+    const BCSourceBlock&        block,
+    const bool                  (&transparent)[16],
+    bool                        allowPunchThrough,
+    const BCColorBlockEncoding& encoding,
+    float                       (&endpoint0)[3],
+    float                       (&endpoint1)[3])
+{
+    const bool isFourColorMode = (!allowPunchThrough || encoding.color0 > encoding.color1);
+
+    float alpha2 = 0.0f, beta2 = 0.0f, alphaBeta = 0.0f;
+    float alphaX[3] = { 0.0f, 0.0f, 0.0f };
+    float betaX[3]  = { 0.0f, 0.0f, 0.0f };
+
+    for_range(texel, 16u)
+    {
+        if (transparent[texel])
+            continue;
+
+        const float beta    = GetColorIndexWeight((encoding.indices >> (texel * 2)) & 0x3u, isFourColorMode);
+        const float alpha   = 1.0f - beta;
+
+        alpha2      += alpha * alpha;
+        beta2       += beta * beta;
+        alphaBeta   += alpha * beta;
+
+        for_range(i, 3)
+        {
+            alphaX[i]   += alpha * block.texels[texel][i];
+            betaX[i]    += beta  * block.texels[texel][i];
+        }
+    }
+
+    const float det = alpha2 * beta2 - alphaBeta * alphaBeta;
+    if (std::abs(det) < 1.0e-6f)
+        return false;
+
+    for_range(i, 3)
+    {
+        endpoint0[i] = std::max(0.0f, std::min(255.0f, (alphaX[i] * beta2 - betaX[i] * alphaBeta) / det));
+        endpoint1[i] = std::max(0.0f, std::min(255.0f, (betaX[i] * alpha2 - alphaX[i] * alphaBeta) / det));
+    }
+
+    return true;
+}
+
+// Encodes the RGB channels of the specified block into a BC1 color block. Punch-through alpha is only allowed for BC1.
+static void EncodeColorBlock(const BCSourceBlock& block, bool allowPunchThrough, ImageCompressionQuality quality, std::uint8_t* dst)
+{
+    /* Gather opaque colors; all texels with alpha below 50% are transparent in BC1 */
+    bool        transparent[16];
+    float       colors[16][3];
+    std::size_t numColors = 0;
+
+    for_range(texel, 16u)
+    {
+        transparent[texel] = (allowPunchThrough && block.texels[texel][3] < 128);
+        if (!transparent[texel])
+        {
+            for_range(i, 3)
+                colors[numColors][i] = static_cast<float>(block.texels[texel][i]);
+            ++numColors;
+        }
+    }
+
+    const bool hasTransparency = (numColors < 16);
+
+    BCColorBlockEncoding encoding;
+
+    if (numColors == 0)
+    {
+        /* Entirely transparent block in 3-color mode */
+        encoding.indices = 0xFFFFFFFFu;
+    }
+    else
+    {
+        float endpoint0[3], endpoint1[3];
+        if (quality == ImageCompressionQuality::Fast)
+            ComputeBoundingBoxEndpoints(colors, numColors, endpoint0, endpoint1);
+        else
+            ComputePrincipalAxisEndpoints(colors, numColors, endpoint0, endpoint1);
+
+        encoding = EncodeColorEndpoints(block, transparent, allowPunchThrough, hasTransparency, endpoint0, endpoint1);
+
+        if (quality == ImageCompressionQuality::High)
+        {
+            /* Refine endpoints for the selected indices while the error decreases */
+            for_range(pass, g_numRefinementPasses)
+            {
+                if (encoding.error == 0 || !RefineColorEndpoints(block, transparent, allowPunchThrough, encoding, endpoint0, endpoint1))
+                    break;
+
+                const BCColorBlockEncoding refined = EncodeColorEndpoints(block, transparent, allowPunchThrough, hasTransparency, endpoint0, endpoint1);
+                if (refined.error >= encoding.error)
+                    break;
+
+                encoding = refined;
+            }
+        }
+    }
+
+    WriteUInt16LE(dst,     encoding.color0);
+    WriteUInt16LE(dst + 2, encoding.color1);
+    WriteUInt32LE(dst + 4, encoding.indices);
+}
+
+// Selects the nearest value for each entry and returns the accumulated squared error.
+static int EncodeChannelIndices(const std::uint8_t (&values)[16], const int (&palette)[8], std::uint64_t& outIndices)
+{
+    int totalError = 0;
+    outIndices = 0;
+
+    for_range(texel, 16u)
+    {
+        int bestError = 0x7FFFFFFF;
+        std::uint64_t bestIndex = 0;
+        for_range(index, 8u)
+        {
+            const int d = static_cast<int>(values[texel]) - palette[index];
+            if (d*d < bestError)
+            {
+                bestError = d*d;
+                bestIndex = index;
+            }
+        }
+        totalError += bestError;
+        outIndices |= (bestIndex << (texel * 3));
+    }
+
+    return totalError;
+}
+
+// Encodes the specified values into a BC4 channel block, which is also used for the alpha channel of BC3 and both channels of BC5.
+static void EncodeChannelBlock(const std::uint8_t (&values)[16], ImageCompressionQuality quality, std::uint8_t* dst)
+{
+    const std::uint8_t minValue = *std::min_element(values, values + 16);
+    const std::uint8_t maxValue = *std::max_element(values, values + 16);
+
+    std::uint8_t    endpoint0   = maxValue;
+    std::uint8_t    endpoint1   = minValue;
+    std::uint64_t   indices     = 0;
+
+    if (minValue < maxValue)
+    {
+        /* Use 8-value mode (endpoint0 > endpoint1) with the same rounding as the decoder */
+        int palette[8] = { maxValue, minValue };
+        for_subrange(i, 2, 8)
+            palette[i] = ((8 - i) * palette[0] + (i - 1) * palette[1]) / 7;
+
+        int error = EncodeChannelIndices(values, palette, indices);
+
+        if (quality == ImageCompressionQuality::High && error > 0)
+        {
+            /* Try 6-value mode (endpoint0 <= endpoint1) with explicit 0 and 255 over the range of the remaining values */
+            std::uint8_t innerMin = 255, innerMax = 0;
+            for (std::uint8_t value : values)
+            {
+                if (value != 0 && value != 255)
+                {
+                    innerMin = std::min(innerMin, value);
+                    innerMax = std::max(innerMax, value);
+                }
+            }
+
+            if (innerMin > innerMax)
+                innerMin = innerMax = 0;
+
+            int palette6[8] = { innerMin, innerMax };
+            for_subrange(i, 2, 6)
+                palette6[i] = ((6 - i) * palette6[0] + (i - 1) * palette6[1]) / 5;
+            palette6[6] = 0;
+            palette6[7] = 255;
+
+            std::uint64_t indices6 = 0;
+            if (EncodeChannelIndices(values, palette6, indices6) < error)
+            {
+                endpoint0   = innerMin;
+                endpoint1   = innerMax;
+                indices     = indices6;
+            }
+        }
+    }
+
+    dst[0] = endpoint0;
+    dst[1] = endpoint1;
+    for_range(i, 6)
+        dst[2 + i] = static_cast<std::uint8_t>((indices >> (i * 8)) & 0xFF);
+}
+
+// Extracts the specified channel of all texels in the block.
+static void GetBlockChannel(const BCSourceBlock& block, int channel, std::uint8_t (&dst)[16])
+{
+    for_range(texel, 16)
+        dst[texel] = block.texels[texel][channel];
+}
+
+static void EncodeBlock(ImageFormat format, ImageCompressionQuality quality, const BCSourceBlock& block, std::uint8_t* dst)
+{
+    std::uint8_t channel[16];
+
+    switch (format)
+    {
+        case ImageFormat::BC1:
+        {
+            EncodeColorBlock(block, true, quality, dst);
+        }
+        break;
+
+        case ImageFormat::BC2:
+        {
+            /* Explicit 4-bit alpha with the even texel in the lower nibble */
+            for_range(i, 8)
+            {
+                const int alpha0 = (block.texels[i*2    ][3] * 15 + 127) / 255;
+                const int alpha1 = (block.texels[i*2 + 1][3] * 15 + 127) / 255;
+                dst[i] = static_cast<std::uint8_t>(alpha0 | (alpha1 << 4));
+            }
+            EncodeColorBlock(block, false, quality, dst + 8);
+        }
+        break;
+
+        case ImageFormat::BC3:
+        {
+            GetBlockChannel(block, 3, channel);
+            EncodeChannelBlock(channel, quality, dst);
+            EncodeColorBlock(block, false, quality, dst + 8);
+        }
+        break;
+
+        case ImageFormat::BC4:
+        {
+            GetBlockChannel(block, 0, channel);
+            EncodeChannelBlock(channel, quality, dst);
+        }
+        break;
+
+        case ImageFormat::BC5:
+        {
+            GetBlockChannel(block, 0, channel);
+            EncodeChannelBlock(channel, quality, dst);
+            GetBlockChannel(block, 1, channel);
+            EncodeChannelBlock(channel, quality, dst + 8);
+        }
+        break;
+
+        default:
+        break;
+    }
+}
+
+static std::size_t GetBCBlockSize(ImageFormat format)
+{
+    switch (format)
+    {
+        case ImageFormat::BC1:  return 8;
+        case ImageFormat::BC2:  return 16;
+        case ImageFormat::BC3:  return 16;
+        case ImageFormat::BC4:  return 8;
+        case ImageFormat::BC5:  return 16;
+        default:                return 0;
+    }
+}
+
+
+/*
+ * Global functions
+ */
+
+DynamicByteArray CompressRGBA8UNormToBC(
+    ImageFormat             format,
+    const Extent3D&         extent,
+    const char*             data,
+    std::size_t             dataSize,
+    ImageCompressionQuality quality,
+    unsigned                threadCount)
+{
+    const std::size_t blockSize = GetBCBlockSize(format);
+    if (blockSize == 0 || data == nullptr || extent.width == 0 || extent.height == 0 || extent.depth == 0)
+        return nullptr;
+
+    /* Return null if input data is too small for the image extent */
+    const std::size_t srcSliceSize = static_cast<std::size_t>(extent.width) * extent.height * 4;
+    if (dataSize < srcSliceSize * extent.depth)
+        return nullptr;
+
+    const std::uint32_t numBlocksX      = (extent.width  + 3) / 4;
+    const std::uint32_t numBlocksY      = (extent.height + 3) / 4;
+    const std::size_t   blockRowSize    = blockSize * numBlocksX;
+
+    DynamicByteArray dstImage{ blockRowSize * numBlocksY * extent.depth, UninitializeTag{} };
+
+    const std::uint8_t* input   = reinterpret_cast<const std::uint8_t*>(data);
+    std::uint8_t*       output  = reinterpret_cast<std::uint8_t*>(dstImage.get());
+
+    /* Encode block rows of all slices concurrently; each block row writes a disjoint range of output blocks */
+    DoConcurrentRange(
+        [&](std::size_t blockRowBegin, std::size_t blockRowEnd)
+        {
+            BCSourceBlock block;
+
+            for_subrange(blockRow, blockRowBegin, blockRowEnd)
+            {
+                const std::size_t   slice   = blockRow / numBlocksY;
+                const std::uint32_t y       = static_cast<std::uint32_t>(blockRow % numBlocksY) * 4;
+                const std::uint8_t* src     = input + srcSliceSize * slice;
+                std::uint8_t*       dst     = output + blockRowSize * blockRow;
+
+                for_range(bx, numBlocksX)
+                {
+                    LoadSourceBlock(src, extent.width, extent.height, bx * 4, y, block);
+                    EncodeBlock(format, quality, block, dst);
+                    dst += blockSize;
+                }
+            }
+        },
+        static_cast<std::size_t>(numBlocksY) * extent.depth,
+        threadCount,
+        4
+    );
+
+    return dstImage;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
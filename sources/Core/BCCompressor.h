@@ -0,0 +1,47 @@
+/*
+ * BCCompressor.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_BC_COMPRESSOR_H
+#define LLGL_BC_COMPRESSOR_H
+
+
+#include <LLGL/Types.h>
+#include <LLGL/ImageFlags.h>
+#include <LLGL/Container/DynamicArray.h>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+/* ----- Functions ----- */
+
+/*
+Returns an image buffer in the specified BC1, BC2, BC3, BC4, or BC5 format for the specified Format::RGBA8UNorm data, or null on failure.
+The depth of the extent denotes the number of consecutive 2D slices; each slice is encoded separately. Block rows are encoded concurrently.
+Incomplete blocks at the right and bottom image border are padded by repeating the border texels.
+BC4 and BC5 are encoded from the red and red-green channels respectively.
+*/
+DynamicByteArray CompressRGBA8UNormToBC(
+    ImageFormat             format,
+    const Extent3D&         extent,
+    const char*             data,
+    std::size_t             dataSize,
+    ImageCompressionQuality quality,
+    unsigned                threadCount = 0
+);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -6,115 +6,442 @@
  */
 
 #include "BCDecompressor.h"
+#include "CPUFeatures.h"
+#include "Threading.h"
 #include <LLGL/Types.h>
 #include <LLGL/Utils/ForRange.h>
+#include <algorithm>
 #include <cstring>
 
+#if defined LLGL_SIMD_X86
+#   include <immintrin.h>
+#elif defined LLGL_SIMD_NEON
+#   include <arm_neon.h>
+#endif
+
 
 namespace LLGL
 {
 
 
+/*
+ * Internal structures
+ */
+
+// Decoded 4x4 block of RGBA8 texels in row-major order.
+struct BCBlockRGBA8
+{
+    std::uint8_t texels[16][4];
+};
+
+// Palette of the four RGBA8 colors of a BC1 color block.
+struct BCColorPalette
+{
+    std::uint8_t colors[4][4];
+};
+
+// Shuffle control to expand the 2-bit palette indices of one block row (8 bits) into 16 bytes of RGBA8 texels.
+struct BCPaletteShuffleTable
+{
+    BCPaletteShuffleTable()
+    {
+        for_range(bits, 256u)
+        {
+            for_range(x, 4u)
+            {
+                const std::uint8_t index = static_cast<std::uint8_t>((bits >> (x * 2)) & 0x3u);
+                for_range(c, 4u)
+                    control[bits][x*4 + c] = static_cast<std::uint8_t>(index*4 + c);
+            }
+        }
+    }
+
+    alignas(16) std::uint8_t control[256][16];
+};
+
+static const BCPaletteShuffleTable& GetPaletteShuffleTable()
+{
+    static const BCPaletteShuffleTable table;
+    return table;
+}
+
+using DecodeBCColorBlockFunc = void (*)(const std::uint8_t* src, bool hasPunchThroughAlpha, BCBlockRGBA8& dst);
+
+
+/*
+ * Internal functions
+ */
+
+static std::uint16_t ReadUInt16LE(const std::uint8_t* src)
+{
+    return static_cast<std::uint16_t>(src[0] | (src[1] << 8));
+}
+
+static std::uint32_t ReadUInt32LE(const std::uint8_t* src)
+{
+    return
+    (
+        (static_cast<std::uint32_t>(src[0])      ) |
+        (static_cast<std::uint32_t>(src[1]) <<  8) |
+        (static_cast<std::uint32_t>(src[2]) << 16) |
+        (static_cast<std::uint32_t>(src[3]) << 24)
+    );
+}
+
+// Expands the specified R5G6B5 color to RGBA8 with full opacity.
 static void DecompressRGBColor16Bit(std::uint8_t* dst, std::uint16_t src)
 {
-    dst[0] = ((src >> 12) & 0x000F) * 0xFF / 0x0F;
-    dst[1] = ((src >>  6) & 0x001F) * 0xFF / 0x1F;
-    dst[2] = ((src >>  1) & 0x000F) * 0xFF / 0x0F;
+    const std::uint32_t r = (src >> 11) & 0x1F;
+    const std::uint32_t g = (src >>  5) & 0x3F;
+    const std::uint32_t b = (src      ) & 0x1F;
+    dst[0] = static_cast<std::uint8_t>((r << 3) | (r >> 2));
+    dst[1] = static_cast<std::uint8_t>((g << 2) | (g >> 4));
+    dst[2] = static_cast<std::uint8_t>((b << 3) | (b >> 2));
+    dst[3] = 0xFF;
 }
 
-#if 0 //UNUSED
-static void DecompressRGBAColor16Bit(std::uint8_t* dst, std::uint16_t src)
+// Interpolates the two endpoints into the remaining palette entries. Always uses the 4-color mode unless punch-through alpha is allowed (BC1 only).
+static void InterpolateColorPaletteScalar(BCColorPalette& palette, bool isFourColorMode)
 {
-    DecompressRGBColor16Bit(dst, src);
-    dst[3] = (src & 0x0001) * 0xFF;
+    const std::uint8_t* c0 = palette.colors[0];
+    const std::uint8_t* c1 = palette.colors[1];
+
+    if (isFourColorMode)
+    {
+        for_range(i, 4u)
+        {
+            palette.colors[2][i] = static_cast<std::uint8_t>((2*c0[i] + c1[i] + 1) / 3);
+            palette.colors[3][i] = static_cast<std::uint8_t>((c0[i] + 2*c1[i] + 1) / 3);
+        }
+    }
+    else
+    {
+        for_range(i, 4u)
+        {
+            palette.colors[2][i] = static_cast<std::uint8_t>((c0[i] + c1[i]) / 2);
+            palette.colors[3][i] = 0;
+        }
+    }
 }
 
-static std::uint8_t DecompressAlphaChannel4Bit(std::uint32_t& src)
+static bool ReadColorEndpoints(const std::uint8_t* src, bool hasPunchThroughAlpha, BCColorPalette& palette)
 {
-    auto alpha = static_cast<std::uint8_t >((src & 0x0000000F) * 0xFF / 0x0F);
-    src >>= 4;
-    return alpha;
+    const std::uint16_t color0 = ReadUInt16LE(src);
+    const std::uint16_t color1 = ReadUInt16LE(src + 2);
+    DecompressRGBColor16Bit(palette.colors[0], color0);
+    DecompressRGBColor16Bit(palette.colors[1], color1);
+    return (!hasPunchThroughAlpha || color0 > color1);
 }
 
-static void Decompress16AlphaChannels4Bit(std::uint8_t* dst, std::uint32_t src0, std::uint32_t src1)
+static void DecodeColorBlockScalar(const std::uint8_t* src, bool hasPunchThroughAlpha, BCBlockRGBA8& dst)
 {
-    for (int i = 0; i < 8; ++i)
+    BCColorPalette palette;
+    const bool isFourColorMode = ReadColorEndpoints(src, hasPunchThroughAlpha, palette);
+    InterpolateColorPaletteScalar(palette, isFourColorMode);
+
+    std::uint32_t indices = ReadUInt32LE(src + 4);
+    for_range(i, 16u)
     {
-        dst[i    ] = DecompressAlphaChannel4Bit(src0);
-        dst[i + 8] = DecompressAlphaChannel4Bit(src1);
+        ::memcpy(dst.texels[i], palette.colors[indices & 0x3u], 4);
+        indices >>= 2;
     }
 }
-#endif
 
-static std::uint8_t InterpolateColorComponent(std::uint16_t a, std::uint16_t b)
+#if defined LLGL_SIMD_X86
+
+LLGL_TARGET_SIMD("ssse3")
+static void DecodeColorBlockSSSE3(const std::uint8_t* src, bool hasPunchThroughAlpha, BCBlockRGBA8& dst)
 {
-    if (a > b)
-        return static_cast<std::uint8_t>((2 * a + b + 1) / 3);
+    BCColorPalette endpoints;
+    const bool isFourColorMode = ReadColorEndpoints(src, hasPunchThroughAlpha, endpoints);
+
+    /* Interpolate endpoints in 16-bit lanes: c0 in the lower four lanes and c1 in the upper four lanes */
+    std::uint32_t endpointBits[2];
+    ::memcpy(endpointBits, endpoints.colors, sizeof(endpointBits));
+    const __m128i e     = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(endpointBits)), _mm_setzero_si128());
+    const __m128i eSwap = _mm_shuffle_epi32(e, _MM_SHUFFLE(1, 0, 3, 2));
+
+    __m128i interp;
+    if (isFourColorMode)
+    {
+        /* (2*c0 + c1 + 1) / 3 and (2*c1 + c0 + 1) / 3, where x/3 == (x * 0xAAAB) >> 17 for all 16-bit x */
+        const __m128i sum = _mm_add_epi16(_mm_add_epi16(_mm_slli_epi16(e, 1), eSwap), _mm_set1_epi16(1));
+        interp = _mm_srli_epi16(_mm_mulhi_epu16(sum, _mm_set1_epi16(static_cast<short>(0xAAAB))), 1);
+    }
     else
-        return static_cast<std::uint8_t>((a + b) / 2);
+    {
+        /* (c0 + c1) / 2 and transparent black */
+        const __m128i avg = _mm_srli_epi16(_mm_add_epi16(e, eSwap), 1);
+        interp = _mm_unpacklo_epi64(avg, _mm_setzero_si128());
+    }
+
+    const __m128i palette = _mm_packus_epi16(e, interp);
+
+    /* Expand each row of 2-bit palette indices with a single byte shuffle */
+    const BCPaletteShuffleTable& table = GetPaletteShuffleTable();
+    const std::uint32_t indices = ReadUInt32LE(src + 4);
+    for_range(y, 4u)
+    {
+        const __m128i control = _mm_load_si128(reinterpret_cast<const __m128i*>(table.control[(indices >> (y * 8)) & 0xFFu]));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst.texels[y*4]), _mm_shuffle_epi8(palette, control));
+    }
 }
 
-static void InterpolateColor(std::uint8_t* dst, const std::uint8_t* src0, const std::uint8_t* src1)
+#elif defined LLGL_SIMD_NEON
+
+static void DecodeColorBlockNEON(const std::uint8_t* src, bool hasPunchThroughAlpha, BCBlockRGBA8& dst)
 {
-    dst[0] = InterpolateColorComponent(src0[0], src1[0]);
-    dst[1] = InterpolateColorComponent(src0[1], src1[1]);
-    dst[2] = InterpolateColorComponent(src0[2], src1[2]);
+    BCColorPalette endpoints;
+    const bool isFourColorMode = ReadColorEndpoints(src, hasPunchThroughAlpha, endpoints);
+
+    /* Interpolate endpoints in 16-bit lanes: c0 in the lower four lanes and c1 in the upper four lanes */
+    const uint16x8_t e      = vmovl_u8(vld1_u8(endpoints.colors[0]));
+    const uint16x8_t eSwap  = vextq_u16(e, e, 4);
+
+    uint16x8_t interp;
+    if (isFourColorMode)
+    {
+        /* (2*c0 + c1 + 1) / 3 and (2*c1 + c0 + 1) / 3, where x/3 == (x * 0xAAAB) >> 17 for all 16-bit x */
+        const uint16x8_t sum    = vaddq_u16(vaddq_u16(vshlq_n_u16(e, 1), eSwap), vdupq_n_u16(1));
+        const uint16x4_t div3   = vdup_n_u16(0xAAAB);
+        const uint32x4_t lo     = vshrq_n_u32(vmull_u16(vget_low_u16(sum), div3), 17);
+        const uint32x4_t hi     = vshrq_n_u32(vmull_u16(vget_high_u16(sum), div3), 17);
+        interp = vcombine_u16(vmovn_u32(lo), vmovn_u32(hi));
+    }
+    else
+    {
+        /* (c0 + c1) / 2 and transparent black */
+        const uint16x8_t avg = vshrq_n_u16(vaddq_u16(e, eSwap), 1);
+        interp = vcombine_u16(vget_low_u16(avg), vdup_n_u16(0));
+    }
+
+    const uint8x16_t palette = vcombine_u8(vmovn_u16(e), vmovn_u16(interp));
+
+    /* Expand each row of 2-bit palette indices with a single table lookup */
+    const BCPaletteShuffleTable& table = GetPaletteShuffleTable();
+    const std::uint32_t indices = ReadUInt32LE(src + 4);
+    for_range(y, 4u)
+    {
+        const uint8x16_t control = vld1q_u8(table.control[(indices >> (y * 8)) & 0xFFu]);
+        vst1q_u8(dst.texels[y*4], vqtbl1q_u8(palette, control));
+    }
 }
 
-DynamicByteArray DecompressBC1ToRGBA8UNorm(
-    const Extent2D& extent,
-    const char*     data,
-    std::size_t     dataSize,
-    unsigned        /*threadCount*/)
+#endif // /LLGL_SIMD_NEON
+
+static DecodeBCColorBlockFunc SelectDecodeColorBlockFunc()
 {
-    /* Return null on invalid arguments */
-    if (extent.width % 4 != 0 || extent.height % 4 != 0 || data == nullptr || dataSize < extent.width * extent.height / 2)
-        return nullptr;
+    #if defined LLGL_SIMD_X86
+    if (GetCPUFeatures().ssse3)
+        return DecodeColorBlockSSSE3;
+    #elif defined LLGL_SIMD_NEON
+    return DecodeColorBlockNEON;
+    #endif
+    return DecodeColorBlockScalar;
+}
+
+// Decodes a BC4 block (also used for the alpha channel of BC3 and each channel of BC5) into 16 unsigned 8-bit values.
+static void DecodeInterpolatedChannelBlock(const std::uint8_t* src, bool isSigned, std::uint8_t (&dst)[16])
+{
+    int values[8];
+
+    if (isSigned)
+    {
+        /* Signed endpoints in range [-127, 127]; -128 is clamped to -127 */
+        values[0] = std::max(-127, static_cast<int>(static_cast<std::int8_t>(src[0])));
+        values[1] = std::max(-127, static_cast<int>(static_cast<std::int8_t>(src[1])));
+    }
+    else
+    {
+        values[0] = src[0];
+        values[1] = src[1];
+    }
+
+    if (values[0] > values[1])
+    {
+        for_subrange(i, 2, 8)
+            values[i] = ((8 - i) * values[0] + (i - 1) * values[1]) / 7;
+    }
+    else
+    {
+        for_subrange(i, 2, 6)
+            values[i] = ((6 - i) * values[0] + (i - 1) * values[1]) / 5;
+        values[6] = (isSigned ? -127 :   0);
+        values[7] = (isSigned ?  127 : 255);
+    }
+
+    /* Map signed values to the unsigned normalized output range */
+    if (isSigned)
+    {
+        for_range(i, 8)
+            values[i] = ((values[i] + 127) * 255 + 127) / 254;
+    }
+
+    /* Read 48 bits of 3-bit indices */
+    std::uint64_t indices = 0;
+    for_range(i, 6)
+        indices |= (static_cast<std::uint64_t>(src[2 + i]) << (i * 8));
 
-    DynamicByteArray dstImage{ extent.width * extent.height * 4, UninitializeTag{} };
+    for_range(i, 16)
+    {
+        dst[i] = static_cast<std::uint8_t>(values[indices & 0x7u]);
+        indices >>= 3;
+    }
+}
 
-    std::uint8_t* output = reinterpret_cast<std::uint8_t*>(dstImage.get());
-    std::uint16_t compressedColor[2];
-    std::uint8_t decompressedColor[4][3];
+// Decodes the explicit 4-bit alpha block of BC2.
+static void DecodeExplicitAlphaBlock(const std::uint8_t* src, std::uint8_t (&dst)[16])
+{
+    for_range(i, 8)
+    {
+        dst[i*2    ] = static_cast<std::uint8_t>((src[i] & 0x0F) * 0x11);
+        dst[i*2 + 1] = static_cast<std::uint8_t>((src[i] >> 4  ) * 0x11);
+    }
+}
 
-    const std::size_t formatByteSize = 4;
+static void DecodeBlock(
+    ImageFormat             format,
+    bool                    isSigned,
+    DecodeBCColorBlockFunc  decodeColorBlock,
+    const std::uint8_t*     src,
+    BCBlockRGBA8&           dst)
+{
+    std::uint8_t channel[16];
 
-    for_range(y, extent.height / 4u)
+    switch (format)
     {
-        for_range(x, extent.width / 4u)
+        case ImageFormat::BC1:
         {
-            /* Decompress two 16 bit colors */
-            for_range(i, 2)
-            {
-                compressedColor[i] = *reinterpret_cast<const std::uint16_t*>(data);
-                DecompressRGBColor16Bit(decompressedColor[i], compressedColor[i]);
-                data += 2;
-            }
+            decodeColorBlock(src, true, dst);
+        }
+        break;
 
-            /* Generate two more colors by interpolating the previous two */
-            InterpolateColor(decompressedColor[2], decompressedColor[0], decompressedColor[1]);
-            InterpolateColor(decompressedColor[3], decompressedColor[1], decompressedColor[0]);
+        case ImageFormat::BC2:
+        {
+            decodeColorBlock(src + 8, false, dst);
+            DecodeExplicitAlphaBlock(src, channel);
+            for_range(i, 16)
+                dst.texels[i][3] = channel[i];
+        }
+        break;
 
-            /* Read palette bitfield */
-            std::uint32_t palette = *reinterpret_cast<const std::uint32_t*>(data);
-            data += 4;
+        case ImageFormat::BC3:
+        {
+            decodeColorBlock(src + 8, false, dst);
+            DecodeInterpolatedChannelBlock(src, false, channel);
+            for_range(i, 16)
+                dst.texels[i][3] = channel[i];
+        }
+        break;
 
-            /* Generate 4x4 pixel block from palette bitmask */
-            for_range(i, 16u)
+        case ImageFormat::BC4:
+        {
+            DecodeInterpolatedChannelBlock(src, isSigned, channel);
+            for_range(i, 16)
             {
-                /* Get palette index from last two bits */
-                const std::uint32_t paletteIndex = palette & 0x00000003;
-                palette >>= 2;
-
-                /* Write out image color */
-                const std::size_t outputOffset = (((y * 4 + i/4) * extent.width) + (x*4 + i%4)) * formatByteSize;
-                output[outputOffset + 0] = decompressedColor[paletteIndex][0];
-                output[outputOffset + 1] = decompressedColor[paletteIndex][1];
-                output[outputOffset + 2] = decompressedColor[paletteIndex][2];
-                output[outputOffset + 3] = 0xFF;
+                dst.texels[i][0] = channel[i];
+                dst.texels[i][1] = 0x00;
+                dst.texels[i][2] = 0x00;
+                dst.texels[i][3] = 0xFF;
             }
         }
+        break;
+
+        case ImageFormat::BC5:
+        {
+            DecodeInterpolatedChannelBlock(src, isSigned, channel);
+            for_range(i, 16)
+                dst.texels[i][0] = channel[i];
+            DecodeInterpolatedChannelBlock(src + 8, isSigned, channel);
+            for_range(i, 16)
+            {
+                dst.texels[i][1] = channel[i];
+                dst.texels[i][2] = 0x00;
+                dst.texels[i][3] = 0xFF;
+            }
+        }
+        break;
+
+        default:
+        break;
+    }
+}
+
+static std::size_t GetBCBlockSize(ImageFormat format)
+{
+    switch (format)
+    {
+        case ImageFormat::BC1:  return 8;
+        case ImageFormat::BC2:  return 16;
+        case ImageFormat::BC3:  return 16;
+        case ImageFormat::BC4:  return 8;
+        case ImageFormat::BC5:  return 16;
+        default:                return 0;
     }
+}
+
+
+/*
+ * Global functions
+ */
+
+DynamicByteArray DecompressBCToRGBA8UNorm(
+    ImageFormat     format,
+    bool            isSigned,
+    const Extent2D& extent,
+    const char*     data,
+    std::size_t     dataSize,
+    unsigned        threadCount)
+{
+    const std::size_t blockSize = GetBCBlockSize(format);
+    if (blockSize == 0 || data == nullptr || extent.width == 0 || extent.height == 0)
+        return nullptr;
+
+    /* Return null if input data is too small for the number of blocks */
+    const std::uint32_t numBlocksX = (extent.width  + 3) / 4;
+    const std::uint32_t numBlocksY = (extent.height + 3) / 4;
+    const std::size_t   blockRowSize = blockSize * numBlocksX;
+
+    if (dataSize < blockRowSize * numBlocksY)
+        return nullptr;
+
+    DynamicByteArray dstImage{ static_cast<std::size_t>(extent.width) * extent.height * 4, UninitializeTag{} };
+
+    static const DecodeBCColorBlockFunc decodeColorBlock = SelectDecodeColorBlockFunc();
+
+    const std::uint8_t* input   = reinterpret_cast<const std::uint8_t*>(data);
+    std::uint8_t*       output  = reinterpret_cast<std::uint8_t*>(dstImage.get());
+    const std::size_t   dstRowStride = static_cast<std::size_t>(extent.width) * 4;
+
+    /* Decode block rows concurrently; each block row writes a disjoint range of output rows */
+    DoConcurrentRange(
+        [&](std::size_t blockRowBegin, std::size_t blockRowEnd)
+        {
+            BCBlockRGBA8 block;
+
+            for_subrange(by, blockRowBegin, blockRowEnd)
+            {
+                const std::uint8_t* src = input + blockRowSize * by;
+                const std::uint32_t y = static_cast<std::uint32_t>(by) * 4;
+                const std::uint32_t numRows = std::min(4u, extent.height - y);
+
+                for_range(bx, numBlocksX)
+                {
+                    DecodeBlock(format, isSigned, decodeColorBlock, src, block);
+                    src += blockSize;
+
+                    /* Copy texels of block into output image and clip the block at the image border */
+                    const std::uint32_t x = bx * 4;
+                    const std::size_t rowSize = std::min(4u, extent.width - x) * 4;
+                    for_range(row, numRows)
+                        ::memcpy(output + (y + row) * dstRowStride + x*4, block.texels[row*4], rowSize);
+                }
+            }
+        },
+        numBlocksY,
+        threadCount,
+        4
+    );
 
     return dstImage;
 }
@@ -10,6 +10,7 @@
 
 
 #include <LLGL/Types.h>
+#include <LLGL/Format.h>
 #include <LLGL/Container/DynamicArray.h>
 #include <cstddef>
 
@@ -23,10 +24,13 @@ struct Extent2D;
 /* ----- Functions ----- */
 
 /*
-Returns an image buffer in the Format::RGBA8UNorm format for the specified BC1 encoded data, or null on failure
-Width and height of the input image must be a multiple of 4.
+Returns an image buffer in the Format::RGBA8UNorm format for the specified BC1, BC2, BC3, BC4, or BC5 encoded data, or null on failure.
+Block rows are decoded concurrently. Incomplete blocks at the right and bottom image border are clipped.
+BC4 and BC5 are decoded into the red and red-green channels respectively. If 'isSigned' is true, they are remapped from SNorm to UNorm.
 */
-DynamicByteArray DecompressBC1ToRGBA8UNorm(
+DynamicByteArray DecompressBCToRGBA8UNorm(
+    ImageFormat     format,
+    bool            isSigned,
     const Extent2D& extent,
     const char*     data,
     std::size_t     dataSize,
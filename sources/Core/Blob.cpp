@@ -8,6 +8,7 @@
 #include <LLGL/Blob.h>
 #include <fstream>
 #include "CoreUtils.h"
+#include "../Platform/MappedFile.h"
 
 
 namespace LLGL
@@ -112,6 +113,26 @@ struct InternalUnmanagedBlob final : Blob::Pimpl
     std::size_t size;
 };
 
+struct InternalMappedFileBlob final : Blob::Pimpl
+{
+    InternalMappedFileBlob(std::unique_ptr<MappedFile>&& file) :
+        file { std::forward<std::unique_ptr<MappedFile>>(file) }
+    {
+    }
+
+    const void* GetData() const override
+    {
+        return file->GetData();
+    }
+
+    std::size_t GetSize() const override
+    {
+        return file->GetSize();
+    }
+
+    std::unique_ptr<MappedFile> file;
+};
+
 static Blob::Pimpl* MakeInternalBlob(const void* data, std::size_t size, bool isWeakRef)
 {
     if (isWeakRef)
@@ -238,6 +259,34 @@ Blob Blob::CreateFromFile(const std::string& filename)
     return CreateFromFile(filename.c_str());
 }
 
+Blob Blob::CreateFromFileMapped(const char* filename)
+{
+    /* Map file into memory; the mapping lives as long as the blob */
+    std::unique_ptr<MappedFile> file = MappedFile::Open(filename);
+    if (!file)
+        return Blob{};
+
+    Blob blob;
+    blob.pimpl_ = new InternalMappedFileBlob{ std::move(file) };
+    return blob;
+}
+
+Blob Blob::CreateFromFileMapped(const std::string& filename)
+{
+    return CreateFromFileMapped(filename.c_str());
+}
+
+Blob Blob::CreateFromFileMapped(const char* filename, std::uint64_t offset, std::size_t size)
+{
+    std::unique_ptr<MappedFile> file = MappedFile::Open(filename, offset, size);
+    if (!file)
+        return Blob{};
+
+    Blob blob;
+    blob.pimpl_ = new InternalMappedFileBlob{ std::move(file) };
+    return blob;
+}
+
 const void* Blob::GetData() const
 {
     return (pimpl_ != nullptr ? pimpl_->GetData() : nullptr);
@@ -248,6 +297,27 @@ std::size_t Blob::GetSize() const
     return (pimpl_ != nullptr ? pimpl_->GetSize() : 0);
 }
 
+bool Blob::WriteToFile(const char* filename) const
+{
+    if (filename == nullptr || *filename == '\0')
+        return false;
+
+    /* Write file as binary; an empty blob produces an empty file */
+    std::ofstream file{ filename, std::ios::out | std::ios::binary | std::ios::trunc };
+    if (!file.good())
+        return false;
+
+    if (const std::size_t size = GetSize())
+        file.write(static_cast<const char*>(GetData()), static_cast<std::streamsize>(size));
+
+    return file.good();
+}
+
+bool Blob::WriteToFile(const std::string& filename) const
+{
+    return WriteToFile(filename.c_str());
+}
+
 Blob::operator bool () const
 {
     return (pimpl_ != nullptr && pimpl_->GetData() != nullptr && pimpl_->GetSize() > 0);
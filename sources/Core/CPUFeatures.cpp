@@ -0,0 +1,106 @@
+/*
+ * CPUFeatures.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "CPUFeatures.h"
+#include <cstdint>
+
+#if defined LLGL_SIMD_X86
+#   if defined _MSC_VER
+#       include <intrin.h>
+#   else
+#       include <cpuid.h>
+#   endif
+#endif
+
+
+namespace LLGL
+{
+
+
+#if defined LLGL_SIMD_X86
+
+static void QueryCPUID(std::uint32_t leaf, std::uint32_t subleaf, std::uint32_t (&regs)[4])
+{
+    #if defined _MSC_VER
+    int info[4] = { 0, 0, 0, 0 };
+    __cpuidex(info, static_cast<int>(leaf), static_cast<int>(subleaf));
+    for (int i = 0; i < 4; ++i)
+        regs[i] = static_cast<std::uint32_t>(info[i]);
+    #else
+    regs[0] = regs[1] = regs[2] = regs[3] = 0;
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+    #endif
+}
+
+// Returns true if the OS saves the YMM registers on context switches, which is required for any AVX instruction.
+static bool IsAVXStateEnabledByOS()
+{
+    #if defined _MSC_VER
+    return ((_xgetbv(0) & 0x6) == 0x6);
+    #else
+    std::uint32_t eax = 0, edx = 0;
+    __asm__ __volatile__ ("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return ((eax & 0x6) == 0x6);
+    #endif
+}
+
+static CPUFeatures QueryCPUFeatures()
+{
+    CPUFeatures features;
+
+    std::uint32_t regs[4];
+    QueryCPUID(0, 0, regs);
+    const std::uint32_t maxLeaf = regs[0];
+
+    if (maxLeaf >= 1)
+    {
+        QueryCPUID(1, 0, regs);
+        const std::uint32_t ecx = regs[2];
+        const std::uint32_t edx = regs[3];
+        const bool hasOSXSAVE = ((ecx & (1u << 27)) != 0);
+        const bool hasAVX = ((ecx & (1u << 28)) != 0 && hasOSXSAVE && IsAVXStateEnabledByOS());
+
+        features.sse2   = ((edx & (1u << 26)) != 0);
+        features.ssse3  = ((ecx & (1u <<  9)) != 0);
+        features.sse41  = ((ecx & (1u << 19)) != 0);
+        features.f16c   = ((ecx & (1u << 29)) != 0 && hasAVX);
+
+        if (maxLeaf >= 7 && hasAVX)
+        {
+            QueryCPUID(7, 0, regs);
+            features.avx2 = ((regs[1] & (1u << 5)) != 0);
+        }
+    }
+
+    return features;
+}
+
+#else
+
+static CPUFeatures QueryCPUFeatures()
+{
+    CPUFeatures features;
+    #if defined LLGL_SIMD_NEON
+    features.neon = true;
+    #endif
+    return features;
+}
+
+#endif
+
+const CPUFeatures& GetCPUFeatures()
+{
+    static const CPUFeatures features = QueryCPUFeatures();
+    return features;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,60 @@
+/*
+ * CPUFeatures.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_CPU_FEATURES_H
+#define LLGL_CPU_FEATURES_H
+
+
+#include <LLGL/Platform/Platform.h>
+
+
+/*
+Macros for SIMD instruction sets that can be compiled in this translation unit.
+x86 kernels are always compiled and selected at runtime; NEON is part of the AArch64 baseline.
+*/
+
+#if defined LLGL_ARCH_AMD64 || defined LLGL_ARCH_IA32
+#   define LLGL_SIMD_X86 1
+#elif defined LLGL_ARCH_ARM64
+#   define LLGL_SIMD_NEON 1
+#endif
+
+// Enables an instruction set for a single function so it can be dispatched at runtime without compiling the entire module for it.
+#if defined LLGL_SIMD_X86 && (defined __GNUC__ || defined __clang__)
+#   define LLGL_TARGET_SIMD(ISA) __attribute__((target(ISA)))
+#else
+#   define LLGL_TARGET_SIMD(ISA)
+#endif
+
+
+namespace LLGL
+{
+
+
+// Instruction set extensions of the host CPU that are relevant for LLGL's SIMD kernels.
+struct CPUFeatures
+{
+    bool sse2   = false;
+    bool ssse3  = false;
+    bool sse41  = false;
+    bool avx2   = false;
+    bool f16c   = false;
+    bool neon   = false;
+};
+
+// Returns the instruction set extensions of the host CPU. The features are only queried once.
+const CPUFeatures& GetCPUFeatures();
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
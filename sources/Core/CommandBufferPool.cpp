@@ -0,0 +1,177 @@
+/*
+ * CommandBufferPool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Utils/CommandBufferPool.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/CommandBuffer.h>
+#include <LLGL/Fence.h>
+#include <vector>
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+/*
+ * Internal structures
+ */
+
+// Group of command buffers that were associated with the same fence value.
+struct CommandBufferGroup
+{
+    std::vector<CommandBuffer*> cmdBuffers;
+    Fence*                      fence       = nullptr;
+    std::uint64_t               fenceValue  = 0;
+
+    // Returns true if the GPU has finished executing all command buffers of this group.
+    bool IsSignaled() const
+    {
+        return (fence->GetCompletedValue() >= fenceValue);
+    }
+};
+
+struct CommandBufferPool::Pimpl
+{
+    Pimpl(RenderSystem& renderSystem, const CommandBufferPoolDescriptor& desc);
+    ~Pimpl();
+
+    // Moves the command buffers of all signaled groups into the list of available command buffers.
+    void RecycleSignaledGroups();
+
+    RenderSystem&                   renderSystem;
+    CommandBufferDescriptor         cmdBufferDesc;
+    std::vector<CommandBuffer*>     available;                  // Command buffers that can be handed out.
+    std::vector<CommandBuffer*>     pending;                    // Command buffers that are not associated with a fence yet.
+    std::vector<CommandBufferGroup> inFlight;                   // Groups of command buffers that might still be executed by the GPU.
+    std::vector<CommandBufferGroup> unusedGroups;               // Recycled groups to keep their container capacities.
+    std::uint32_t                   numCmdBuffers   = 0;
+};
+
+CommandBufferPool::Pimpl::Pimpl(RenderSystem& renderSystem, const CommandBufferPoolDescriptor& desc) :
+    renderSystem { renderSystem }
+{
+    cmdBufferDesc.debugName         = desc.debugName;
+    cmdBufferDesc.flags             = desc.flags;
+    cmdBufferDesc.numNativeBuffers  = std::max<std::uint32_t>(desc.numNativeBuffers, 1);
+}
+
+CommandBufferPool::Pimpl::~Pimpl()
+{
+    for (CommandBuffer* cmdBuffer : available)
+        renderSystem.Release(*cmdBuffer);
+    for (CommandBuffer* cmdBuffer : pending)
+        renderSystem.Release(*cmdBuffer);
+    for (CommandBufferGroup& group : inFlight)
+    {
+        for (CommandBuffer* cmdBuffer : group.cmdBuffers)
+            renderSystem.Release(*cmdBuffer);
+    }
+}
+
+void CommandBufferPool::Pimpl::RecycleSignaledGroups()
+{
+    for (auto it = inFlight.begin(); it != inFlight.end();)
+    {
+        if (it->IsSignaled())
+        {
+            /* Return all command buffers of this group at once and keep the group for the next submission */
+            available.insert(available.end(), it->cmdBuffers.begin(), it->cmdBuffers.end());
+            it->cmdBuffers.clear();
+            unusedGroups.push_back(std::move(*it));
+            it = inFlight.erase(it);
+        }
+        else
+            ++it;
+    }
+}
+
+
+/*
+ * CommandBufferPool class
+ */
+
+CommandBufferPool::CommandBufferPool(RenderSystem& renderSystem, const CommandBufferPoolDescriptor& desc) :
+    pimpl_ { new Pimpl{ renderSystem, desc } }
+{
+}
+
+CommandBufferPool::~CommandBufferPool()
+{
+    delete pimpl_;
+}
+
+CommandBuffer* CommandBufferPool::AllocateCommandBuffer()
+{
+    /* Only poll fences when no command buffer is available, since querying a fence might be a driver call */
+    if (pimpl_->available.empty())
+        pimpl_->RecycleSignaledGroups();
+
+    CommandBuffer* cmdBuffer = nullptr;
+
+    if (!pimpl_->available.empty())
+    {
+        /* Reuse command buffer; its native command buffer is reset when encoding begins */
+        cmdBuffer = pimpl_->available.back();
+        pimpl_->available.pop_back();
+    }
+    else
+    {
+        /* Create new command buffer with the descriptor of this pool */
+        cmdBuffer = pimpl_->renderSystem.CreateCommandBuffer(pimpl_->cmdBufferDesc);
+        if (cmdBuffer == nullptr)
+            return nullptr;
+        ++pimpl_->numCmdBuffers;
+    }
+
+    pimpl_->pending.push_back(cmdBuffer);
+    return cmdBuffer;
+}
+
+void CommandBufferPool::Submit(Fence& fence, std::uint64_t value)
+{
+    if (pimpl_->pending.empty())
+        return;
+
+    /* Associate all pending command buffers with the specified fence value */
+    CommandBufferGroup group;
+    if (!pimpl_->unusedGroups.empty())
+    {
+        group = std::move(pimpl_->unusedGroups.back());
+        pimpl_->unusedGroups.pop_back();
+    }
+    group.cmdBuffers.swap(pimpl_->pending);
+    group.fence         = &fence;
+    group.fenceValue    = value;
+    pimpl_->inFlight.push_back(std::move(group));
+}
+
+void CommandBufferPool::Reset()
+{
+    for (CommandBufferGroup& group : pimpl_->inFlight)
+    {
+        pimpl_->available.insert(pimpl_->available.end(), group.cmdBuffers.begin(), group.cmdBuffers.end());
+        group.cmdBuffers.clear();
+        pimpl_->unusedGroups.push_back(std::move(group));
+    }
+    pimpl_->inFlight.clear();
+
+    pimpl_->available.insert(pimpl_->available.end(), pimpl_->pending.begin(), pimpl_->pending.end());
+    pimpl_->pending.clear();
+}
+
+std::uint32_t CommandBufferPool::GetNumCommandBuffers() const
+{
+    return pimpl_->numCmdBuffers;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
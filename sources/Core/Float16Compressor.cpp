@@ -6,6 +6,13 @@
  */
 
 #include "Float16Compressor.h"
+#include "CPUFeatures.h"
+
+#if defined LLGL_SIMD_X86
+#   include <immintrin.h>
+#elif defined LLGL_SIMD_NEON
+#   include <arm_neon.h>
+#endif
 
 
 namespace LLGL
@@ -13,8 +20,10 @@ namespace LLGL
 
 
 /*
-This class has been adopted from a public-domain code sample.
+This class has been adopted from public-domain code samples.
 see http://stackoverflow.com/questions/1659440/32-bit-to-16-bit-floating-point-conversion
+Compression rounds to nearest even and overflows to infinity like the hardware conversions (F16C and NEON),
+see https://gist.github.com/rygorous/2156668
 */
 class Float16Compressor
 {
@@ -23,20 +32,34 @@ class Float16Compressor
 
         static std::uint16_t Compress(float value)
         {
-            Bits v, s;
+            Bits v;
             v.f = value;
-            std::uint32_t sign = v.si & signN;
-            v.si ^= sign;
-            sign >>= shiftSign; // logical shift
-            s.si = mulN;
-            s.si = static_cast<std::int32_t>(s.f * v.f); // correct subnormals
-            v.si ^= (s.si ^ v.si) & -(minN > v.si);
-            v.si ^= (infN ^ v.si) & -((infN > v.si) & (v.si > maxN));
-            v.si ^= (nanN ^ v.si) & -((nanN > v.si) & (v.si > infN));
-            v.ui >>= shift; // logical shift
-            v.si ^= ((v.si - maxD) ^ v.si) & -(v.si > maxC);
-            v.si ^= ((v.si - minD) ^ v.si) & -(v.si > subC);
-            return static_cast<std::uint16_t>(v.ui | sign);
+            const std::uint32_t sign = v.ui & static_cast<std::uint32_t>(signN);
+            v.ui ^= sign;
+
+            std::uint32_t result;
+            if (v.ui >= roundInfN)
+            {
+                /* Values that round to 65536 or above overflow to infinity; NaNs are quieted */
+                result = (v.ui > static_cast<std::uint32_t>(infN) ? qnanH : infH);
+            }
+            else if (v.ui < static_cast<std::uint32_t>(minN))
+            {
+                /* Let the FPU round subnormals by aligning the mantissa with the flt16 subnormal LSB */
+                Bits d;
+                d.ui = denormMagicN;
+                v.f += d.f;
+                result = v.ui - denormMagicN;
+            }
+            else
+            {
+                /* Rebias exponent and round mantissa to nearest even */
+                const std::uint32_t mantOdd = (v.ui >> shift) & 1u;
+                v.ui += rebiasN + 0x0fffu + mantOdd;
+                result = v.ui >> shift;
+            }
+
+            return static_cast<std::uint16_t>(result | (sign >> shiftSign));
         }
 
         static float Decompress(std::uint16_t value)
@@ -74,13 +97,17 @@ class Float16Compressor
         static constexpr std::int32_t minN      = 0x38800000; // min flt16 normal as a flt32
         static constexpr std::int32_t signN     = 0x80000000; // flt32 sign bit
 
+        static constexpr std::uint32_t roundInfN    = 0x477ff000u; // 65520, i.e. the smallest flt32 that rounds to flt16 infinity
+        static constexpr std::uint32_t denormMagicN = 0x3f000000u; // 0.5, i.e. flt32 whose mantissa LSB has the weight of the smallest flt16 subnormal
+        static constexpr std::uint32_t rebiasN      = 0xc8000000u; // (15 - 127) << 23, i.e. exponent rebias from flt32 to flt16 (modulo 2^32)
+        static constexpr std::uint32_t infH         = 0x7c00u;     // flt16 infinity
+        static constexpr std::uint32_t qnanH        = 0x7e00u;     // flt16 quiet nan
+
         static constexpr std::int32_t infC      = (infN >> shift);
-        static constexpr std::int32_t nanN      = ((infC + 1) << shift); // minimum flt16 nan as a flt32
         static constexpr std::int32_t maxC      = (maxN >> shift);
         static constexpr std::int32_t minC      = (minN >> shift);
         static constexpr std::int32_t signC     = (signN >> shiftSign); // flt16 sign bit
 
-        static constexpr std::int32_t mulN      = 0x52000000; // (1 << 23) / minN
         static constexpr std::int32_t mulC      = 0x33800000; // minN / (1 << (23 - shift))
 
         static constexpr std::int32_t subC      = 0x003ff; // max flt32 subnormal down shifted
@@ -92,6 +119,99 @@ class Float16Compressor
 };
 
 
+/*
+ * Bulk conversion kernels
+ */
+
+static void CompressFloat16ArrayScalar(std::uint16_t* dst, const float* src, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i)
+        dst[i] = Float16Compressor::Compress(src[i]);
+}
+
+static void DecompressFloat16ArrayScalar(float* dst, const std::uint16_t* src, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i)
+        dst[i] = Float16Compressor::Decompress(src[i]);
+}
+
+#if defined LLGL_SIMD_X86
+
+LLGL_TARGET_SIMD("avx,f16c")
+static void CompressFloat16ArrayF16C(std::uint16_t* dst, const float* src, std::size_t count)
+{
+    /* Round to nearest even like the scalar compressor */
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m128i v = _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), v);
+    }
+    CompressFloat16ArrayScalar(dst + i, src + i, count - i);
+}
+
+LLGL_TARGET_SIMD("avx,f16c")
+static void DecompressFloat16ArrayF16C(float* dst, const std::uint16_t* src, std::size_t count)
+{
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(v));
+    }
+    DecompressFloat16ArrayScalar(dst + i, src + i, count - i);
+}
+
+#elif defined LLGL_SIMD_NEON
+
+static void CompressFloat16ArrayNEON(std::uint16_t* dst, const float* src, std::size_t count)
+{
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+        vst1_u16(dst + i, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(src + i))));
+    CompressFloat16ArrayScalar(dst + i, src + i, count - i);
+}
+
+static void DecompressFloat16ArrayNEON(float* dst, const std::uint16_t* src, std::size_t count)
+{
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+        vst1q_f32(dst + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(src + i))));
+    DecompressFloat16ArrayScalar(dst + i, src + i, count - i);
+}
+
+#endif // /LLGL_SIMD_NEON
+
+using CompressFloat16ArrayFunc      = void (*)(std::uint16_t* dst, const float* src, std::size_t count);
+using DecompressFloat16ArrayFunc    = void (*)(float* dst, const std::uint16_t* src, std::size_t count);
+
+static CompressFloat16ArrayFunc SelectCompressFloat16ArrayFunc()
+{
+    #if defined LLGL_SIMD_X86
+    if (GetCPUFeatures().f16c)
+        return CompressFloat16ArrayF16C;
+    #elif defined LLGL_SIMD_NEON
+    return CompressFloat16ArrayNEON;
+    #endif
+    return CompressFloat16ArrayScalar;
+}
+
+static DecompressFloat16ArrayFunc SelectDecompressFloat16ArrayFunc()
+{
+    #if defined LLGL_SIMD_X86
+    if (GetCPUFeatures().f16c)
+        return DecompressFloat16ArrayF16C;
+    #elif defined LLGL_SIMD_NEON
+    return DecompressFloat16ArrayNEON;
+    #endif
+    return DecompressFloat16ArrayScalar;
+}
+
+
+/*
+ * Global functions
+ */
+
 LLGL_EXPORT std::uint16_t CompressFloat16(float value)
 {
     return Float16Compressor::Compress(value);
@@ -102,6 +222,18 @@ LLGL_EXPORT float DecompressFloat16(std::uint16_t value)
     return Float16Compressor::Decompress(value);
 }
 
+LLGL_EXPORT void CompressFloat16Array(std::uint16_t* dst, const float* src, std::size_t count)
+{
+    static const CompressFloat16ArrayFunc func = SelectCompressFloat16ArrayFunc();
+    func(dst, src, count);
+}
+
+LLGL_EXPORT void DecompressFloat16Array(float* dst, const std::uint16_t* src, std::size_t count)
+{
+    static const DecompressFloat16ArrayFunc func = SelectDecompressFloat16ArrayFunc();
+    func(dst, src, count);
+}
+
 
 } // /namespace LLGL
 
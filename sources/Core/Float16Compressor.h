@@ -11,6 +11,7 @@
 
 #include <LLGL/Export.h>
 #include <cstdint>
+#include <cstddef>
 
 
 namespace LLGL
@@ -23,6 +24,12 @@ LLGL_EXPORT std::uint16_t CompressFloat16(float value);
 // Decompresses the specified 16-bit float (represented as 16-bit unsigned integer) into a 32-bit float.
 LLGL_EXPORT float DecompressFloat16(std::uint16_t value);
 
+// Compresses the specified array of 32-bit floats into 16-bit floats. Uses F16C on x86 and native half conversions on AArch64 if available.
+LLGL_EXPORT void CompressFloat16Array(std::uint16_t* dst, const float* src, std::size_t count);
+
+// Decompresses the specified array of 16-bit floats into 32-bit floats. Uses F16C on x86 and native half conversions on AArch64 if available.
+LLGL_EXPORT void DecompressFloat16Array(float* dst, const std::uint16_t* src, std::size_t count);
+
 
 } // /namespace LLGL
 
@@ -0,0 +1,494 @@
+/*
+ * FrameCaptureFormat.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_FRAME_CAPTURE_FORMAT_H
+#define LLGL_FRAME_CAPTURE_FORMAT_H
+
+
+#include <LLGL/PipelineStateFlags.h>
+#include <LLGL/CommandBufferFlags.h>
+#include <LLGL/TextureFlags.h>
+#include <LLGL/BufferFlags.h>
+#include <LLGL/RenderPassFlags.h>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/*
+~~~~~~ INFO ~~~~~~
+Binary format of frame capture files (see RenderSystemFlags::FrameCapture and FrameCapturePlayer).
+A file starts with a FrameCaptureHeader followed by a flat sequence of records, each with a FrameCaptureRecordHeader and its payload.
+All records before FrameCaptureRecordFrameBegin describe the objects and resource contents at the beginning of the captured frame;
+all records after that are the events of the captured frame itself and are executed on each replay.
+Objects are referenced by a non-zero ID, where zero denotes a null reference. Command buffer submissions contain a command stream
+that uses the same opcode encoding as the backend virtual command buffers (see VirtualCommandBuffer), but references objects by ID.
+Integers are stored in the native byte order. Structures without pointers and 'long' fields as well as the command structures
+are copied raw; their sizes are stored in the header to reject files from incompatible builds.
+*/
+
+// Magic number of frame capture files: "LLFC".
+static constexpr std::uint32_t g_frameCaptureMagic      = 0x43464C4Cu;
+static constexpr std::uint32_t g_frameCaptureVersion    = 2;
+
+/*
+Magic number of pipeline manifest files: "LLPM" (see RenderingDebugger::SavePipelineManifest and WarmUpPipelines).
+A pipeline manifest uses the same header and record format as frame captures, but it only contains the object records
+of swap-chains, shaders, pipeline layouts, render passes, and PSOs, and no frame.
+*/
+static constexpr std::uint32_t g_pipelineManifestMagic  = 0x4D504C4Cu;
+
+// Structures that are serialized raw. The order of this list must not change between versions.
+#define LLGL_FRAME_CAPTURE_RAW_STRUCTS(X)   \
+    X( Viewport                 )           \
+    X( Scissor                  )           \
+    X( DepthDescriptor          )           \
+    X( StencilDescriptor        )           \
+    X( RasterizerDescriptor     )           \
+    X( BlendDescriptor          )           \
+    X( TessellationDescriptor   )           \
+    X( ClearValue               )           \
+    X( TextureSubresource       )           \
+    X( TextureRegion            )           \
+    X( TextureLocation          )           \
+    X( TextureViewDescriptor    )           \
+    X( BufferViewDescriptor     )           \
+    X( AttachmentFormatDescriptor )         \
+    X( SpecializationConstant   )           \
+    X( Extent3D                 )           \
+    X( Offset2D                 )           \
+    X( FrameCaptureCmdDrawIndirect )        \
+    X( FrameCaptureCmdCopyBufferTexture ) \
+    X( SubpassDescriptor        )
+
+#define LLGL_FRAME_CAPTURE_COUNT_STRUCT(T) +1
+
+static constexpr std::uint32_t g_frameCaptureNumRawStructs = (0 LLGL_FRAME_CAPTURE_RAW_STRUCTS(LLGL_FRAME_CAPTURE_COUNT_STRUCT));
+
+#undef LLGL_FRAME_CAPTURE_COUNT_STRUCT
+
+struct FrameCaptureHeader
+{
+    std::uint32_t   magic;
+    std::uint32_t   version;
+    std::uint32_t   rawStructSizes[g_frameCaptureNumRawStructs];
+    std::uint32_t   numObjects;     // Number of object IDs, i.e. the highest ID that is used in this file.
+    std::uint32_t   numSkipped;     // Number of API calls that were not captured.
+    char            rendererName[64];
+};
+
+enum FrameCaptureRecordType : std::uint32_t
+{
+    /* Objects; the payload of each object record is its serialized descriptor followed by std::uint64_t contentSize and the content */
+    FrameCaptureRecordSwapChain = 1,            // Descriptor: Extent2D resolution, Format color, Format depthStencil, std::uint32_t samples, ID implicit render pass
+    FrameCaptureRecordCommandBuffer,            // Descriptor: CommandBufferDescriptor without command queue
+    FrameCaptureRecordBuffer,                   // Descriptor: BufferDescriptor; content: buffer data
+    FrameCaptureRecordTexture,                  // Descriptor: TextureDescriptor; content: ImageFormat, DataType, initial image data
+    FrameCaptureRecordSampler,                  // Descriptor: SamplerDescriptor
+    FrameCaptureRecordShader,                   // Descriptor: ShaderDescriptor with embedded source
+    FrameCaptureRecordPipelineLayout,           // Descriptor: PipelineLayoutDescriptor
+    FrameCaptureRecordGraphicsPipeline,         // Descriptor: GraphicsPipelineDescriptor
+    FrameCaptureRecordComputePipeline,          // Descriptor: ComputePipelineDescriptor
+    FrameCaptureRecordResourceHeap,             // Descriptor: ResourceHeapDescriptor, initial resource views
+    FrameCaptureRecordRenderPass,               // Descriptor: RenderPassDescriptor
+    FrameCaptureRecordRenderTarget,             // Descriptor: RenderTargetDescriptor, ID implicit render pass
+
+    /* Resource updates */
+    FrameCaptureRecordResourceHeapWrite,        // Payload: std::uint32_t firstDescriptor, resource views
+    FrameCaptureRecordBufferWrite,              // Payload: std::uint64_t offset, std::uint64_t dataSize, data
+    FrameCaptureRecordTextureWrite,             // Payload: TextureRegion, ImageFormat, DataType, std::uint64_t dataSize, data
+
+    /* Frame events */
+    FrameCaptureRecordFrameBegin,               // No payload
+    FrameCaptureRecordSubmit,                   // Record ID is the command buffer; payload: std::uint64_t size, command stream
+    FrameCaptureRecordPresent,                  // Record ID is the swap-chain; no payload
+};
+
+struct FrameCaptureRecordHeader
+{
+    std::uint32_t   type;   // FrameCaptureRecordType
+    std::uint32_t   id;     // ID of the object this record refers to.
+    std::uint64_t   size;   // Size (in bytes) of the payload.
+};
+
+
+/* ----- Command stream ----- */
+
+enum FrameCaptureOpcode : std::uint8_t
+{
+    FrameCaptureOpcodeBegin = 1,
+    FrameCaptureOpcodeEnd,
+    FrameCaptureOpcodeUpdateBuffer,
+    FrameCaptureOpcodeCopyBuffer,
+    FrameCaptureOpcodeCopyBufferFromTexture,
+    FrameCaptureOpcodeFillBuffer,
+    FrameCaptureOpcodeCopyTexture,
+    FrameCaptureOpcodeCopyTextureFromBuffer,
+    FrameCaptureOpcodeGenerateMips,
+    FrameCaptureOpcodeGenerateMipsRange,
+    FrameCaptureOpcodeSetViewports,
+    FrameCaptureOpcodeSetScissors,
+    FrameCaptureOpcodeSetVertexBuffer,
+    FrameCaptureOpcodeSetIndexBuffer,
+    FrameCaptureOpcodeSetIndexBufferExt,
+    FrameCaptureOpcodeSetResourceHeap,
+    FrameCaptureOpcodeSetResource,
+    FrameCaptureOpcodeBeginRenderPass,
+    FrameCaptureOpcodeEndRenderPass,
+    FrameCaptureOpcodeClear,
+    FrameCaptureOpcodeClearAttachments,
+    FrameCaptureOpcodeSetPipelineState,
+    FrameCaptureOpcodeSetBlendFactor,
+    FrameCaptureOpcodeSetStencilReference,
+    FrameCaptureOpcodeSetUniforms,
+    FrameCaptureOpcodeDraw,
+    FrameCaptureOpcodeDrawIndexed,
+    FrameCaptureOpcodeDrawInstanced,
+    FrameCaptureOpcodeDrawIndexedInstanced,
+    FrameCaptureOpcodeDrawIndirect,
+    FrameCaptureOpcodeDrawIndirectCount,
+    FrameCaptureOpcodeDrawIndexedIndirect,
+    FrameCaptureOpcodeDrawIndexedIndirectCount,
+    FrameCaptureOpcodeDrawMesh,
+    FrameCaptureOpcodeDrawMeshIndirect,
+    FrameCaptureOpcodeDispatch,
+    FrameCaptureOpcodeDispatchIndirect,
+    FrameCaptureOpcodePushDebugGroup,
+    FrameCaptureOpcodePopDebugGroup,
+    FrameCaptureOpcodeNextSubpass,
+};
+
+struct FrameCaptureCmdUpdateBuffer
+{
+    std::uint32_t   dstBuffer;
+    std::uint64_t   dstOffset;
+    std::uint64_t   dataSize;
+//  std::uint8_t    data[dataSize];
+};
+
+struct FrameCaptureCmdCopyBuffer
+{
+    std::uint32_t   dstBuffer;
+    std::uint64_t   dstOffset;
+    std::uint32_t   srcBuffer;
+    std::uint64_t   srcOffset;
+    std::uint64_t   size;
+};
+
+struct FrameCaptureCmdCopyBufferTexture
+{
+    std::uint32_t   buffer;
+    std::uint64_t   offset;
+    std::uint32_t   texture;
+    TextureRegion   region;
+    std::uint32_t   rowStride;
+    std::uint32_t   layerStride;
+};
+
+struct FrameCaptureCmdFillBuffer
+{
+    std::uint32_t   dstBuffer;
+    std::uint64_t   dstOffset;
+    std::uint32_t   value;
+    std::uint64_t   fillSize;
+};
+
+struct FrameCaptureCmdCopyTexture
+{
+    std::uint32_t   dstTexture;
+    TextureLocation dstLocation;
+    std::uint32_t   srcTexture;
+    TextureLocation srcLocation;
+    Extent3D        extent;
+};
+
+struct FrameCaptureCmdGenerateMips
+{
+    std::uint32_t       texture;
+    TextureSubresource  subresource;
+};
+
+struct FrameCaptureCmdSetViewports
+{
+    std::uint32_t   count;
+//  Viewport        viewports[count];
+};
+
+struct FrameCaptureCmdSetScissors
+{
+    std::uint32_t   count;
+//  Scissor         scissors[count];
+};
+
+struct FrameCaptureCmdSetBuffer
+{
+    std::uint32_t   buffer;
+};
+
+struct FrameCaptureCmdSetIndexBufferExt
+{
+    std::uint32_t   buffer;
+    Format          format;
+    std::uint64_t   offset;
+};
+
+struct FrameCaptureCmdSetResourceHeap
+{
+    std::uint32_t   resourceHeap;
+    std::uint32_t   descriptorSet;
+};
+
+struct FrameCaptureCmdSetResource
+{
+    std::uint32_t   descriptor;
+    std::uint32_t   resource;
+};
+
+struct FrameCaptureCmdBeginRenderPass
+{
+    std::uint32_t   renderTarget;
+    std::uint32_t   renderPass;
+    std::uint32_t   swapBufferIndex;
+    std::uint32_t   numClearValues;
+//  ClearValue      clearValues[numClearValues];
+};
+
+struct FrameCaptureCmdClear
+{
+    std::int64_t    flags;
+    ClearValue      clearValue;
+};
+
+struct FrameCaptureCmdClearAttachment
+{
+    std::int64_t    flags;
+    std::uint32_t   colorAttachment;
+    ClearValue      clearValue;
+};
+
+struct FrameCaptureCmdClearAttachments
+{
+    std::uint32_t   count;
+//  FrameCaptureCmdClearAttachment attachments[count];
+};
+
+struct FrameCaptureCmdSetPipelineState
+{
+    std::uint32_t   pipelineState;
+};
+
+struct FrameCaptureCmdSetBlendFactor
+{
+    float           color[4];
+};
+
+struct FrameCaptureCmdSetStencilReference
+{
+    std::uint32_t   reference;
+    StencilFace     stencilFace;
+};
+
+struct FrameCaptureCmdSetUniforms
+{
+    std::uint32_t   first;
+    std::uint16_t   dataSize;
+//  std::uint8_t    data[dataSize];
+};
+
+struct FrameCaptureCmdDraw
+{
+    std::uint32_t   numVertices;
+    std::uint32_t   firstVertex;
+    std::uint32_t   numInstances;
+    std::uint32_t   firstInstance;
+};
+
+struct FrameCaptureCmdDrawIndexed
+{
+    std::uint32_t   numIndices;
+    std::uint32_t   firstIndex;
+    std::int32_t    vertexOffset;
+    std::uint32_t   numInstances;
+    std::uint32_t   firstInstance;
+};
+
+struct FrameCaptureCmdDrawIndirect
+{
+    std::uint32_t   buffer;
+    std::uint64_t   offset;
+    std::uint32_t   numCommands;
+    std::uint32_t   stride;
+    std::uint32_t   countBuffer;
+    std::uint64_t   countBufferOffset;
+};
+
+struct FrameCaptureCmdDispatch
+{
+    std::uint32_t   numWorkGroups[3];
+};
+
+struct FrameCaptureCmdDispatchIndirect
+{
+    std::uint32_t   buffer;
+    std::uint64_t   offset;
+};
+
+struct FrameCaptureCmdPushDebugGroup
+{
+    std::uint32_t   length;
+//  char            name[length + 1];
+};
+
+
+// Fills the raw structure sizes of the specified header for the current build.
+inline void FillFrameCaptureStructSizes(std::uint32_t (&outSizes)[g_frameCaptureNumRawStructs])
+{
+    std::uint32_t* size = outSizes;
+    #define LLGL_FRAME_CAPTURE_STRUCT_SIZE(T) *size++ = static_cast<std::uint32_t>(sizeof(T));
+    LLGL_FRAME_CAPTURE_RAW_STRUCTS(LLGL_FRAME_CAPTURE_STRUCT_SIZE)
+    #undef LLGL_FRAME_CAPTURE_STRUCT_SIZE
+}
+
+
+/* ----- Serialization ----- */
+
+// Appends serialized values to a byte buffer.
+class FrameCaptureWriter
+{
+
+    public:
+
+        inline FrameCaptureWriter(std::vector<char>& buffer) :
+            buffer_ { buffer }
+        {
+        }
+
+        // Writes the specified data block.
+        inline void WriteData(const void* data, std::size_t size)
+        {
+            if (size > 0)
+            {
+                const char* bytes = static_cast<const char*>(data);
+                buffer_.insert(buffer_.end(), bytes, bytes + size);
+            }
+        }
+
+        // Writes the specified value in its native representation. This must only be used for fundamental types and raw structures.
+        template <typename T>
+        void Write(const T& value)
+        {
+            WriteData(&value, sizeof(T));
+        }
+
+        // Writes the specified null-terminated string including its length. Null pointers are written as empty strings.
+        inline void WriteString(const char* str)
+        {
+            const std::uint32_t len = (str != nullptr ? static_cast<std::uint32_t>(std::strlen(str)) : 0u);
+            Write(len);
+            WriteData((str != nullptr ? str : ""), len + 1);
+        }
+
+        inline void WriteString(const std::string& str)
+        {
+            WriteString(str.c_str());
+        }
+
+        // Writes a 'long' value with a fixed size, since its size differs between platforms.
+        inline void WriteFlags(long flags)
+        {
+            Write(static_cast<std::int64_t>(flags));
+        }
+
+    private:
+
+        std::vector<char>& buffer_;
+
+};
+
+// Reads serialized values from a byte buffer. All read operations fail gracefully, i.e. they return zero-initialized values once the end has been reached.
+class FrameCaptureReader
+{
+
+    public:
+
+        inline FrameCaptureReader(const char* data, std::size_t size) :
+            data_ { data        },
+            end_  { data + size }
+        {
+        }
+
+        // Returns a pointer to the next data block of the specified size or null if the buffer is exhausted.
+        inline const char* ReadData(std::size_t size)
+        {
+            if (size > static_cast<std::size_t>(end_ - data_))
+            {
+                data_ = end_;
+                good_ = false;
+                return nullptr;
+            }
+            const char* data = data_;
+            data_ += size;
+            return data;
+        }
+
+        // Reads the next value in its native representation.
+        template <typename T>
+        T Read()
+        {
+            T value{};
+            if (const char* data = ReadData(sizeof(T)))
+                std::memcpy(&value, data, sizeof(T));
+            return value;
+        }
+
+        // Returns a pointer to the next null-terminated string. The pointer refers to the buffer memory of this reader.
+        inline const char* ReadString()
+        {
+            const std::uint32_t len = Read<std::uint32_t>();
+            const char* str = ReadData(static_cast<std::size_t>(len) + 1);
+            return (str != nullptr && str[len] == '\0' ? str : "");
+        }
+
+        inline long ReadFlags()
+        {
+            return static_cast<long>(Read<std::int64_t>());
+        }
+
+        // Returns true if all previous read operations succeeded.
+        inline bool Good() const
+        {
+            return good_;
+        }
+
+        // Returns true if there is no more data to read.
+        inline bool Eof() const
+        {
+            return (data_ == end_);
+        }
+
+    private:
+
+        const char* data_   = nullptr;
+        const char* end_    = nullptr;
+        bool        good_   = true;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,1411 @@
+/*
+ * FrameCapturePlayer.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Utils/FrameCapturePlayer.h>
+#include <LLGL/Utils/ForRange.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/CommandBuffer.h>
+#include <LLGL/CommandQueue.h>
+#include <LLGL/SwapChain.h>
+#include <LLGL/Report.h>
+#include "FrameCaptureFormat.h"
+#include "StringUtils.h"
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/*
+ * Internal structures
+ */
+
+struct FrameCaptureObject
+{
+    FrameCaptureRecordType  type    = FrameCaptureRecordType(0);
+    RenderSystemChild*      object  = nullptr;
+    bool                    owned   = false;    // False for swap-chains and their render passes, which are provided by the client.
+    long                    flags   = 0;        // Command buffer flags.
+};
+
+// Parsed resource update or frame event.
+struct FrameCaptureEvent
+{
+    FrameCaptureRecordType              type            = FrameCaptureRecordType(0);
+    std::uint32_t                       id              = 0;
+    std::uint64_t                       offset          = 0;    // Buffer offset for BufferWrite.
+    TextureRegion                       region;                 // Texture region for TextureWrite.
+    ImageView                           imageView;              // Source data for BufferWrite and TextureWrite.
+    std::uint32_t                       firstDescriptor = 0;    // First descriptor for ResourceHeapWrite.
+    std::vector<ResourceViewDescriptor> resourceViews;          // Resource views for ResourceHeapWrite.
+};
+
+struct FrameCapturePlayer::Pimpl
+{
+    Pimpl(RenderSystem& renderSystem, SwapChain* swapChain);
+    ~Pimpl();
+
+    bool Load(const char* filename, Report* report);
+    void ReleaseObjects();
+
+    bool CreateObject(const FrameCaptureRecordHeader& header, FrameCaptureReader& reader, Report* report);
+    bool ParseEvent(const FrameCaptureRecordHeader& header, FrameCaptureReader& reader, FrameCaptureEvent& outEvent, Report* report);
+    bool ValidateCommandStream(const char* data, std::size_t size, Report* report);
+
+    void ExecuteEvent(const FrameCaptureEvent& event);
+    void ExecuteCommandStream(CommandBuffer& cmdBuffer, const char* data, std::size_t size);
+    std::size_t ExecuteCommand(CommandBuffer& cmdBuffer, const FrameCaptureOpcode opcode, const char* pc);
+
+    void ReadResourceViews(FrameCaptureReader& reader, std::vector<ResourceViewDescriptor>& outResourceViews);
+
+    // Maps the specified ID to an object that was created from the capture.
+    void SetObject(std::uint32_t id, const FrameCaptureRecordType type, RenderSystemChild* object, bool owned = true);
+
+    // Returns the object for the specified ID if it has the specified type, or null otherwise.
+    template <typename T>
+    T* GetObject(std::uint32_t id, const FrameCaptureRecordType type) const;
+
+    Resource* GetResource(std::uint32_t id) const;
+    RenderTarget* GetRenderTarget(std::uint32_t id) const;
+
+    RenderSystem&                   renderSystem;
+    SwapChain*                      swapChain           = nullptr;
+    PipelineCache*                  pipelineCache       = nullptr;  // Pipeline cache for PSOs that are created from a pipeline manifest.
+    bool                            isManifest          = false;    // True if a pipeline manifest is loaded (see WarmUpPipelines).
+    std::vector<char>               fileData;
+    std::vector<FrameCaptureObject> objects;            // Objects indexed by their capture ID.
+    std::vector<FrameCaptureEvent>  restoreEvents;      // Buffer and texture contents at the beginning of the frame.
+    std::vector<FrameCaptureEvent>  heapWriteEvents;    // Resource heap writes before the frame.
+    std::vector<FrameCaptureEvent>  frameEvents;        // Events of the captured frame.
+    FrameCaptureInfo                info;
+    bool                            isSkippingPass      = false;
+};
+
+
+/*
+ * Command stream
+ */
+
+// Determines the size of the specified command after its opcode including its payload. Returns false if the command is invalid or exceeds the remaining size.
+static bool GetFrameCaptureCommandSize(const FrameCaptureOpcode opcode, const char* pc, std::size_t remaining, std::size_t& outSize)
+{
+    #define LLGL_FIXED_SIZE(TCMD)                   \
+        outSize = sizeof(TCMD);                     \
+        return (remaining >= outSize)
+
+    #define LLGL_VARIABLE_SIZE(TCMD, PAYLOAD)                                   \
+        {                                                                       \
+            if (remaining < sizeof(TCMD))                                       \
+                return false;                                                   \
+            TCMD cmd;                                                           \
+            std::memcpy(&cmd, pc, sizeof(cmd));                                 \
+            const std::uint64_t size = sizeof(TCMD) + (PAYLOAD);                \
+            outSize = static_cast<std::size_t>(size);                           \
+            return (remaining >= size);                                         \
+        }
+
+    switch (opcode)
+    {
+        case FrameCaptureOpcodeBegin:
+        case FrameCaptureOpcodeEnd:
+        case FrameCaptureOpcodeEndRenderPass:
+        case FrameCaptureOpcodePopDebugGroup:
+        case FrameCaptureOpcodeNextSubpass:
+            outSize = 0;
+            return true;
+        case FrameCaptureOpcodeUpdateBuffer:
+            LLGL_VARIABLE_SIZE(FrameCaptureCmdUpdateBuffer, cmd.dataSize);
+        case FrameCaptureOpcodeCopyBuffer:
+            LLGL_FIXED_SIZE(FrameCaptureCmdCopyBuffer);
+        case FrameCaptureOpcodeCopyBufferFromTexture:
+        case FrameCaptureOpcodeCopyTextureFromBuffer:
+            LLGL_FIXED_SIZE(FrameCaptureCmdCopyBufferTexture);
+        case FrameCaptureOpcodeFillBuffer:
+            LLGL_FIXED_SIZE(FrameCaptureCmdFillBuffer);
+        case FrameCaptureOpcodeCopyTexture:
+            LLGL_FIXED_SIZE(FrameCaptureCmdCopyTexture);
+        case FrameCaptureOpcodeGenerateMips:
+        case FrameCaptureOpcodeGenerateMipsRange:
+            LLGL_FIXED_SIZE(FrameCaptureCmdGenerateMips);
+        case FrameCaptureOpcodeSetViewports:
+            LLGL_VARIABLE_SIZE(FrameCaptureCmdSetViewports, sizeof(Viewport) * cmd.count);
+        case FrameCaptureOpcodeSetScissors:
+            LLGL_VARIABLE_SIZE(FrameCaptureCmdSetScissors, sizeof(Scissor) * cmd.count);
+        case FrameCaptureOpcodeSetVertexBuffer:
+        case FrameCaptureOpcodeSetIndexBuffer:
+            LLGL_FIXED_SIZE(FrameCaptureCmdSetBuffer);
+        case FrameCaptureOpcodeSetIndexBufferExt:
+            LLGL_FIXED_SIZE(FrameCaptureCmdSetIndexBufferExt);
+        case FrameCaptureOpcodeSetResourceHeap:
+            LLGL_FIXED_SIZE(FrameCaptureCmdSetResourceHeap);
+        case FrameCaptureOpcodeSetResource:
+            LLGL_FIXED_SIZE(FrameCaptureCmdSetResource);
+        case FrameCaptureOpcodeBeginRenderPass:
+            LLGL_VARIABLE_SIZE(FrameCaptureCmdBeginRenderPass, sizeof(ClearValue) * cmd.numClearValues);
+        case FrameCaptureOpcodeClear:
+            LLGL_FIXED_SIZE(FrameCaptureCmdClear);
+        case FrameCaptureOpcodeClearAttachments:
+            LLGL_VARIABLE_SIZE(FrameCaptureCmdClearAttachments, sizeof(FrameCaptureCmdClearAttachment) * cmd.count);
+        case FrameCaptureOpcodeSetPipelineState:
+            LLGL_FIXED_SIZE(FrameCaptureCmdSetPipelineState);
+        case FrameCaptureOpcodeSetBlendFactor:
+            LLGL_FIXED_SIZE(FrameCaptureCmdSetBlendFactor);
+        case FrameCaptureOpcodeSetStencilReference:
+            LLGL_FIXED_SIZE(FrameCaptureCmdSetStencilReference);
+        case FrameCaptureOpcodeSetUniforms:
+            LLGL_VARIABLE_SIZE(FrameCaptureCmdSetUniforms, cmd.dataSize);
+        case FrameCaptureOpcodeDraw:
+        case FrameCaptureOpcodeDrawInstanced:
+            LLGL_FIXED_SIZE(FrameCaptureCmdDraw);
+        case FrameCaptureOpcodeDrawIndexed:
+        case FrameCaptureOpcodeDrawIndexedInstanced:
+            LLGL_FIXED_SIZE(FrameCaptureCmdDrawIndexed);
+        case FrameCaptureOpcodeDrawIndirect:
+        case FrameCaptureOpcodeDrawIndirectCount:
+        case FrameCaptureOpcodeDrawIndexedIndirect:
+        case FrameCaptureOpcodeDrawIndexedIndirectCount:
+        case FrameCaptureOpcodeDrawMeshIndirect:
+            LLGL_FIXED_SIZE(FrameCaptureCmdDrawIndirect);
+        case FrameCaptureOpcodeDrawMesh:
+        case FrameCaptureOpcodeDispatch:
+            LLGL_FIXED_SIZE(FrameCaptureCmdDispatch);
+        case FrameCaptureOpcodeDispatchIndirect:
+            LLGL_FIXED_SIZE(FrameCaptureCmdDispatchIndirect);
+        case FrameCaptureOpcodePushDebugGroup:
+            LLGL_VARIABLE_SIZE(FrameCaptureCmdPushDebugGroup, cmd.length + 1);
+    }
+
+    #undef LLGL_FIXED_SIZE
+    #undef LLGL_VARIABLE_SIZE
+
+    return false;
+}
+
+
+/*
+ * Descriptor deserialization
+ */
+
+static void ReadVertexAttributes(FrameCaptureReader& reader, std::vector<VertexAttribute>& outAttribs)
+{
+    outAttribs.resize(reader.Read<std::uint32_t>());
+    for (VertexAttribute& attrib : outAttribs)
+    {
+        attrib.name             = reader.ReadString();
+        attrib.format           = reader.Read<Format>();
+        attrib.location         = reader.Read<std::uint32_t>();
+        attrib.semanticIndex    = reader.Read<std::uint32_t>();
+        attrib.systemValue      = reader.Read<SystemValue>();
+        attrib.slot             = reader.Read<std::uint32_t>();
+        attrib.offset           = reader.Read<std::uint32_t>();
+        attrib.stride           = reader.Read<std::uint32_t>();
+        attrib.instanceDivisor  = reader.Read<std::uint32_t>();
+        if (!reader.Good())
+            break;
+    }
+}
+
+static void ReadSamplerDesc(FrameCaptureReader& reader, SamplerDescriptor& outSamplerDesc)
+{
+    outSamplerDesc.debugName        = reader.ReadString();
+    outSamplerDesc.addressModeU     = reader.Read<SamplerAddressMode>();
+    outSamplerDesc.addressModeV     = reader.Read<SamplerAddressMode>();
+    outSamplerDesc.addressModeW     = reader.Read<SamplerAddressMode>();
+    outSamplerDesc.minFilter        = reader.Read<SamplerFilter>();
+    outSamplerDesc.magFilter        = reader.Read<SamplerFilter>();
+    outSamplerDesc.mipMapFilter     = reader.Read<SamplerFilter>();
+    outSamplerDesc.mipMapEnabled    = reader.Read<bool>();
+    outSamplerDesc.mipMapLODBias    = reader.Read<float>();
+    outSamplerDesc.minLOD           = reader.Read<float>();
+    outSamplerDesc.maxLOD           = reader.Read<float>();
+    outSamplerDesc.maxAnisotropy    = reader.Read<std::uint32_t>();
+    outSamplerDesc.compareEnabled   = reader.Read<bool>();
+    outSamplerDesc.compareOp        = reader.Read<CompareOp>();
+    if (const char* borderColor = reader.ReadData(sizeof(outSamplerDesc.borderColor)))
+        std::memcpy(outSamplerDesc.borderColor, borderColor, sizeof(outSamplerDesc.borderColor));
+}
+
+static void ReadBindingSlot(FrameCaptureReader& reader, BindingSlot& outSlot)
+{
+    outSlot.index   = reader.Read<std::uint32_t>();
+    outSlot.set     = reader.Read<std::uint32_t>();
+}
+
+static void ReadBindingDescs(FrameCaptureReader& reader, std::vector<BindingDescriptor>& outBindingDescs)
+{
+    outBindingDescs.resize(reader.Read<std::uint32_t>());
+    for (BindingDescriptor& bindingDesc : outBindingDescs)
+    {
+        bindingDesc.name        = reader.ReadString();
+        bindingDesc.type        = reader.Read<ResourceType>();
+        bindingDesc.bindFlags   = reader.ReadFlags();
+        bindingDesc.stageFlags  = reader.ReadFlags();
+        ReadBindingSlot(reader, bindingDesc.slot);
+        bindingDesc.arraySize   = reader.Read<std::uint32_t>();
+        if (!reader.Good())
+            break;
+    }
+}
+
+// Returns true if the specified record type can be part of a pipeline manifest.
+static bool IsPipelineManifestRecord(std::uint32_t type)
+{
+    return
+    (
+        type == FrameCaptureRecordSwapChain         ||
+        type == FrameCaptureRecordShader            ||
+        type == FrameCaptureRecordPipelineLayout    ||
+        type == FrameCaptureRecordGraphicsPipeline  ||
+        type == FrameCaptureRecordComputePipeline   ||
+        type == FrameCaptureRecordRenderPass
+    );
+}
+
+template <typename T>
+void ReadRawArray(FrameCaptureReader& reader, std::vector<T>& outValues)
+{
+    const std::uint32_t count = reader.Read<std::uint32_t>();
+    if (const char* data = reader.ReadData(sizeof(T) * count))
+    {
+        outValues.resize(count);
+        std::memcpy(outValues.data(), data, sizeof(T) * count);
+    }
+}
+
+
+/*
+ * FrameCapturePlayer::Pimpl struct
+ */
+
+FrameCapturePlayer::Pimpl::Pimpl(RenderSystem& renderSystem, SwapChain* swapChain) :
+    renderSystem { renderSystem },
+    swapChain    { swapChain    }
+{
+}
+
+FrameCapturePlayer::Pimpl::~Pimpl()
+{
+    ReleaseObjects();
+}
+
+bool FrameCapturePlayer::Pimpl::Load(const char* filename, Report* report)
+{
+    ReleaseObjects();
+
+    const char* fileType = (isManifest ? "pipeline manifest" : "frame capture");
+
+    fileData = ReadFileBuffer(filename);
+    if (fileData.empty())
+    {
+        if (report != nullptr)
+            report->Errorf("failed to read %s file: \"%s\"\n", fileType, filename);
+        return false;
+    }
+
+    /* Validate header against the current build */
+    FrameCaptureReader reader{ fileData.data(), fileData.size() };
+    const FrameCaptureHeader header = reader.Read<FrameCaptureHeader>();
+    if (!reader.Good() || header.magic != (isManifest ? g_pipelineManifestMagic : g_frameCaptureMagic))
+    {
+        if (report != nullptr)
+            report->Errorf("invalid %s file: \"%s\"\n", fileType, filename);
+        return false;
+    }
+    if (header.version != g_frameCaptureVersion)
+    {
+        if (report != nullptr)
+            report->Errorf("unsupported frame capture version %u (expected %u)\n", header.version, g_frameCaptureVersion);
+        return false;
+    }
+
+    std::uint32_t rawStructSizes[g_frameCaptureNumRawStructs];
+    FillFrameCaptureStructSizes(rawStructSizes);
+    if (std::memcmp(rawStructSizes, header.rawStructSizes, sizeof(rawStructSizes)) != 0)
+    {
+        if (report != nullptr)
+            report->Errorf("frame capture file was written by an incompatible build of LLGL\n");
+        return false;
+    }
+
+    info.rendererName = StringView{ header.rendererName, ::strnlen(header.rendererName, sizeof(header.rendererName)) };
+    info.numSkipped = header.numSkipped;
+    objects.resize(static_cast<std::size_t>(header.numObjects) + 1);
+
+    /* Parse all records */
+    bool isFrame = false;
+    while (!reader.Eof())
+    {
+        const FrameCaptureRecordHeader recordHeader = reader.Read<FrameCaptureRecordHeader>();
+        const char* payload = reader.ReadData(static_cast<std::size_t>(recordHeader.size));
+        if (!reader.Good() || payload == nullptr)
+        {
+            if (report != nullptr)
+                report->Errorf("frame capture file is truncated\n");
+            return false;
+        }
+
+        FrameCaptureReader recordReader{ payload, static_cast<std::size_t>(recordHeader.size) };
+        if (isManifest && !IsPipelineManifestRecord(recordHeader.type))
+            continue;
+        if (recordHeader.type == FrameCaptureRecordFrameBegin)
+            isFrame = true;
+        else if (recordHeader.type <= FrameCaptureRecordRenderTarget)
+        {
+            if (!CreateObject(recordHeader, recordReader, report))
+                ++info.numFailedObjects;
+        }
+        else
+        {
+            FrameCaptureEvent event;
+            if (!ParseEvent(recordHeader, recordReader, event, report))
+                return false;
+            if (isFrame)
+                frameEvents.push_back(std::move(event));
+            else if (event.type == FrameCaptureRecordResourceHeapWrite)
+                heapWriteEvents.push_back(std::move(event));
+            else
+                restoreEvents.push_back(std::move(event));
+        }
+    }
+
+    /* Write resource heaps after all objects have been created, since they can refer to resources that were created after the heap */
+    for (const FrameCaptureEvent& event : heapWriteEvents)
+        ExecuteEvent(event);
+
+    for (const FrameCaptureEvent& event : restoreEvents)
+        ExecuteEvent(event);
+
+    return true;
+}
+
+void FrameCapturePlayer::Pimpl::ReleaseObjects()
+{
+    if (CommandQueue* commandQueue = renderSystem.GetCommandQueue())
+        commandQueue->WaitIdle();
+
+    /* Release objects in reverse order of their creation */
+    for (auto it = objects.rbegin(); it != objects.rend(); ++it)
+    {
+        if (it->object == nullptr || !it->owned)
+            continue;
+
+        switch (it->type)
+        {
+            case FrameCaptureRecordCommandBuffer:       renderSystem.Release(*static_cast<CommandBuffer*>(it->object));    break;
+            case FrameCaptureRecordBuffer:              renderSystem.Release(*static_cast<Buffer*>(it->object));           break;
+            case FrameCaptureRecordTexture:             renderSystem.Release(*static_cast<Texture*>(it->object));          break;
+            case FrameCaptureRecordSampler:             renderSystem.Release(*static_cast<Sampler*>(it->object));          break;
+            case FrameCaptureRecordShader:              renderSystem.Release(*static_cast<Shader*>(it->object));           break;
+            case FrameCaptureRecordPipelineLayout:      renderSystem.Release(*static_cast<PipelineLayout*>(it->object));   break;
+            case FrameCaptureRecordGraphicsPipeline:
+            case FrameCaptureRecordComputePipeline:     renderSystem.Release(*static_cast<PipelineState*>(it->object));    break;
+            case FrameCaptureRecordResourceHeap:        renderSystem.Release(*static_cast<ResourceHeap*>(it->object));     break;
+            case FrameCaptureRecordRenderPass:          renderSystem.Release(*static_cast<RenderPass*>(it->object));       break;
+            case FrameCaptureRecordRenderTarget:        renderSystem.Release(*static_cast<RenderTarget*>(it->object));     break;
+            default:                                                                                                        break;
+        }
+    }
+
+    objects.clear();
+    restoreEvents.clear();
+    heapWriteEvents.clear();
+    frameEvents.clear();
+    fileData.clear();
+    info = FrameCaptureInfo{};
+}
+
+bool FrameCapturePlayer::Pimpl::CreateObject(const FrameCaptureRecordHeader& header, FrameCaptureReader& reader, Report* report)
+{
+    if (header.id == 0 || header.id >= objects.size())
+    {
+        if (report != nullptr)
+            report->Errorf("frame capture object ID %u out of range\n", header.id);
+        return false;
+    }
+
+    const char* content = nullptr;
+    std::uint64_t contentSize = 0;
+
+    auto ReadContent = [&reader, &content, &contentSize]()
+    {
+        contentSize = reader.Read<std::uint64_t>();
+        content     = (contentSize > 0 ? reader.ReadData(static_cast<std::size_t>(contentSize)) : nullptr);
+    };
+
+    const std::uint32_t id = header.id;
+    const FrameCaptureRecordType type = static_cast<FrameCaptureRecordType>(header.type);
+
+    switch (type)
+    {
+        case FrameCaptureRecordSwapChain:
+        {
+            /* Captured swap-chains are all replaced by the swap-chain of this player */
+            const Extent2D resolution = reader.Read<Extent2D>();
+            reader.Read<Format>();
+            reader.Read<Format>();
+            reader.Read<std::uint32_t>();
+            const std::uint32_t renderPassID = reader.Read<std::uint32_t>();
+            ReadContent();
+
+            if (info.resolution.width == 0 && info.resolution.height == 0)
+                info.resolution = resolution;
+
+            if (swapChain != nullptr)
+            {
+                SetObject(id, type, swapChain, false);
+                if (const RenderPass* renderPass = swapChain->GetRenderPass())
+                    SetObject(renderPassID, FrameCaptureRecordRenderPass, const_cast<RenderPass*>(renderPass), false);
+            }
+            return reader.Good();
+        }
+
+        case FrameCaptureRecordCommandBuffer:
+        {
+            CommandBufferDescriptor commandBufferDesc;
+            {
+                commandBufferDesc.debugName             = reader.ReadString();
+                commandBufferDesc.flags                 = reader.ReadFlags();
+                commandBufferDesc.numNativeBuffers      = reader.Read<std::uint32_t>();
+                commandBufferDesc.minStagingPoolSize    = reader.Read<std::uint64_t>();
+                commandBufferDesc.renderPass            = GetObject<RenderPass>(reader.Read<std::uint32_t>(), FrameCaptureRecordRenderPass);
+            }
+            ReadContent();
+            if (!reader.Good())
+                break;
+
+            SetObject(id, type, renderSystem.CreateCommandBuffer(commandBufferDesc));
+            objects[id].flags = commandBufferDesc.flags;
+        }
+        break;
+
+        case FrameCaptureRecordBuffer:
+        {
+            std::vector<VertexAttribute> vertexAttribs;
+            BufferDescriptor bufferDesc;
+            {
+                bufferDesc.debugName        = reader.ReadString();
+                bufferDesc.size             = reader.Read<std::uint64_t>();
+                bufferDesc.stride           = reader.Read<std::uint32_t>();
+                bufferDesc.format           = reader.Read<Format>();
+                bufferDesc.bindFlags        = reader.ReadFlags();
+                bufferDesc.cpuAccessFlags   = reader.ReadFlags();
+                bufferDesc.miscFlags        = reader.ReadFlags();
+                ReadVertexAttributes(reader, vertexAttribs);
+                bufferDesc.vertexAttribs    = vertexAttribs;
+            }
+            ReadContent();
+            if (!reader.Good())
+                break;
+
+            const bool hasContent = (content != nullptr && contentSize == bufferDesc.size);
+            Buffer* buffer = renderSystem.CreateBuffer(bufferDesc, (hasContent ? content : nullptr));
+            SetObject(id, type, buffer);
+
+            /* Keep buffer content to restore it before each replay */
+            if (buffer != nullptr && hasContent)
+            {
+                FrameCaptureEvent event;
+                {
+                    event.type                  = FrameCaptureRecordBufferWrite;
+                    event.id                    = id;
+                    event.imageView.data        = content;
+                    event.imageView.dataSize    = static_cast<std::size_t>(contentSize);
+                }
+                restoreEvents.push_back(std::move(event));
+            }
+        }
+        break;
+
+        case FrameCaptureRecordTexture:
+        {
+            TextureDescriptor textureDesc;
+            {
+                textureDesc.debugName       = reader.ReadString();
+                textureDesc.type            = reader.Read<TextureType>();
+                textureDesc.bindFlags       = reader.ReadFlags();
+                textureDesc.cpuAccessFlags  = reader.ReadFlags();
+                textureDesc.miscFlags       = reader.ReadFlags();
+                textureDesc.format          = reader.Read<Format>();
+                textureDesc.extent          = reader.Read<Extent3D>();
+                textureDesc.arrayLayers     = reader.Read<std::uint32_t>();
+                textureDesc.mipLevels       = reader.Read<std::uint32_t>();
+                textureDesc.samples         = reader.Read<std::uint32_t>();
+                textureDesc.transientSlot   = reader.Read<std::uint32_t>();
+                textureDesc.clearValue      = reader.Read<ClearValue>();
+            }
+            ReadContent();
+            if (!reader.Good())
+                break;
+
+            /* Textures with an initial image store its format and data type in front of the image data */
+            ImageView initialImage;
+            if (content != nullptr)
+            {
+                FrameCaptureReader contentReader{ content, static_cast<std::size_t>(contentSize) };
+                initialImage.format     = contentReader.Read<ImageFormat>();
+                initialImage.dataType   = contentReader.Read<DataType>();
+                initialImage.dataSize   = static_cast<std::size_t>(contentSize) - sizeof(ImageFormat) - sizeof(DataType);
+                initialImage.data       = contentReader.ReadData(initialImage.dataSize);
+            }
+
+            Texture* texture = renderSystem.CreateTexture(textureDesc, (initialImage.data != nullptr ? &initialImage : nullptr));
+            SetObject(id, type, texture);
+
+            /* Keep initial image of the first MIP-map to restore it before each replay */
+            if (texture != nullptr && initialImage.data != nullptr)
+            {
+                FrameCaptureEvent event;
+                {
+                    event.type                  = FrameCaptureRecordTextureWrite;
+                    event.id                    = id;
+                    event.region.subresource    = TextureSubresource{ 0, textureDesc.arrayLayers, 0, 1 };
+                    event.region.extent         = GetMipExtent(textureDesc.type, textureDesc.extent, 0);
+                    event.imageView             = initialImage;
+                }
+                restoreEvents.push_back(std::move(event));
+            }
+        }
+        break;
+
+        case FrameCaptureRecordSampler:
+        {
+            SamplerDescriptor samplerDesc;
+            ReadSamplerDesc(reader, samplerDesc);
+            ReadContent();
+            if (!reader.Good())
+                break;
+            SetObject(id, type, renderSystem.CreateSampler(samplerDesc));
+        }
+        break;
+
+        case FrameCaptureRecordShader:
+        {
+            std::vector<ShaderMacro> defines;
+            ShaderDescriptor shaderDesc;
+            {
+                shaderDesc.debugName    = reader.ReadString();
+                shaderDesc.type         = reader.Read<ShaderType>();
+                shaderDesc.sourceType   = reader.Read<ShaderSourceType>();
+                shaderDesc.sourceSize   = static_cast<std::size_t>(reader.Read<std::uint64_t>());
+                shaderDesc.source       = reader.ReadData(shaderDesc.sourceSize + 1);
+                shaderDesc.entryPoint   = reader.ReadString();
+                shaderDesc.profile      = reader.ReadString();
+
+                defines.resize(reader.Read<std::uint32_t>());
+                for (ShaderMacro& macro : defines)
+                {
+                    macro.name          = reader.ReadString();
+                    macro.definition    = reader.ReadString();
+                }
+                defines.push_back(ShaderMacro{ nullptr, nullptr });
+                shaderDesc.defines      = defines.data();
+
+                shaderDesc.flags        = reader.ReadFlags();
+                ReadVertexAttributes(reader, shaderDesc.vertex.inputAttribs);
+                ReadVertexAttributes(reader, shaderDesc.vertex.outputAttribs);
+
+                shaderDesc.fragment.outputAttribs.resize(reader.Read<std::uint32_t>());
+                for (FragmentAttribute& attrib : shaderDesc.fragment.outputAttribs)
+                {
+                    attrib.name         = reader.ReadString();
+                    attrib.format       = reader.Read<Format>();
+                    attrib.location     = reader.Read<std::uint32_t>();
+                    attrib.systemValue  = reader.Read<SystemValue>();
+                }
+
+                shaderDesc.compute.workGroupSize = reader.Read<Extent3D>();
+            }
+            ReadContent();
+            if (!reader.Good() || shaderDesc.source == nullptr)
+                break;
+
+            /* Empty debug names and profiles are serialized as empty strings, but shaders expect null for default values */
+            if (*shaderDesc.profile == '\0')
+                shaderDesc.profile = nullptr;
+
+            Shader* shader = renderSystem.CreateShader(shaderDesc);
+            if (shader != nullptr && report != nullptr)
+            {
+                if (const Report* shaderReport = shader->GetReport())
+                {
+                    if (shaderReport->HasErrors())
+                    {
+                        report->Errorf("failed to compile shader %u:\n%s", id, shaderReport->GetText());
+                        renderSystem.Release(*shader);
+                        return false;
+                    }
+                }
+            }
+            SetObject(id, type, shader);
+        }
+        break;
+
+        case FrameCaptureRecordPipelineLayout:
+        {
+            PipelineLayoutDescriptor pipelineLayoutDesc;
+            {
+                pipelineLayoutDesc.debugName = reader.ReadString();
+                ReadBindingDescs(reader, pipelineLayoutDesc.heapBindings);
+                ReadBindingDescs(reader, pipelineLayoutDesc.bindings);
+
+                pipelineLayoutDesc.staticSamplers.resize(reader.Read<std::uint32_t>());
+                for (StaticSamplerDescriptor& staticSamplerDesc : pipelineLayoutDesc.staticSamplers)
+                {
+                    staticSamplerDesc.name          = reader.ReadString();
+                    staticSamplerDesc.stageFlags    = reader.ReadFlags();
+                    ReadBindingSlot(reader, staticSamplerDesc.slot);
+                    ReadSamplerDesc(reader, staticSamplerDesc.sampler);
+                    if (!reader.Good())
+                        break;
+                }
+
+                pipelineLayoutDesc.uniforms.resize(reader.Read<std::uint32_t>());
+                for (UniformDescriptor& uniformDesc : pipelineLayoutDesc.uniforms)
+                {
+                    uniformDesc.name        = reader.ReadString();
+                    uniformDesc.type        = reader.Read<UniformType>();
+                    uniformDesc.arraySize   = reader.Read<std::uint32_t>();
+                    if (!reader.Good())
+                        break;
+                }
+            }
+            ReadContent();
+            if (!reader.Good())
+                break;
+            SetObject(id, type, renderSystem.CreatePipelineLayout(pipelineLayoutDesc));
+        }
+        break;
+
+        case FrameCaptureRecordGraphicsPipeline:
+        {
+            std::uint32_t renderPassID = 0;
+            GraphicsPipelineDescriptor pipelineStateDesc;
+            {
+                pipelineStateDesc.debugName             = reader.ReadString();
+                pipelineStateDesc.pipelineLayout        = GetObject<PipelineLayout>(reader.Read<std::uint32_t>(), FrameCaptureRecordPipelineLayout);
+                renderPassID                            = reader.Read<std::uint32_t>();
+                pipelineStateDesc.renderPass            = GetObject<RenderPass>(renderPassID, FrameCaptureRecordRenderPass);
+                pipelineStateDesc.subpass               = reader.Read<std::uint32_t>();
+                pipelineStateDesc.vertexShader          = GetObject<Shader>(reader.Read<std::uint32_t>(), FrameCaptureRecordShader);
+                pipelineStateDesc.tessControlShader     = GetObject<Shader>(reader.Read<std::uint32_t>(), FrameCaptureRecordShader);
+                pipelineStateDesc.tessEvaluationShader  = GetObject<Shader>(reader.Read<std::uint32_t>(), FrameCaptureRecordShader);
+                pipelineStateDesc.geometryShader        = GetObject<Shader>(reader.Read<std::uint32_t>(), FrameCaptureRecordShader);
+                pipelineStateDesc.fragmentShader        = GetObject<Shader>(reader.Read<std::uint32_t>(), FrameCaptureRecordShader);
+                pipelineStateDesc.taskShader            = GetObject<Shader>(reader.Read<std::uint32_t>(), FrameCaptureRecordShader);
+                pipelineStateDesc.meshShader            = GetObject<Shader>(reader.Read<std::uint32_t>(), FrameCaptureRecordShader);
+                pipelineStateDesc.indexFormat           = reader.Read<Format>();
+                pipelineStateDesc.primitiveTopology     = reader.Read<PrimitiveTopology>();
+                ReadRawArray(reader, pipelineStateDesc.viewports);
+                ReadRawArray(reader, pipelineStateDesc.scissors);
+                pipelineStateDesc.depth                 = reader.Read<DepthDescriptor>();
+                pipelineStateDesc.stencil               = reader.Read<StencilDescriptor>();
+                pipelineStateDesc.rasterizer            = reader.Read<RasterizerDescriptor>();
+                pipelineStateDesc.blend                 = reader.Read<BlendDescriptor>();
+                pipelineStateDesc.tessellation          = reader.Read<TessellationDescriptor>();
+                ReadRawArray(reader, pipelineStateDesc.specializationConstants);
+                pipelineStateDesc.asyncCompilation      = isManifest;
+            }
+            ReadContent();
+            if (!reader.Good())
+                break;
+
+            /* Manifest PSOs that refer to a render pass that is not available, e.g. of a render target, would not match the PSOs of the application */
+            if (isManifest && renderPassID != 0 && pipelineStateDesc.renderPass == nullptr)
+                break;
+
+            SetObject(id, type, renderSystem.CreatePipelineState(pipelineStateDesc, pipelineCache));
+        }
+        break;
+
+        case FrameCaptureRecordComputePipeline:
+        {
+            ComputePipelineDescriptor pipelineStateDesc;
+            {
+                pipelineStateDesc.debugName         = reader.ReadString();
+                pipelineStateDesc.pipelineLayout    = GetObject<PipelineLayout>(reader.Read<std::uint32_t>(), FrameCaptureRecordPipelineLayout);
+                pipelineStateDesc.computeShader     = GetObject<Shader>(reader.Read<std::uint32_t>(), FrameCaptureRecordShader);
+                ReadRawArray(reader, pipelineStateDesc.specializationConstants);
+                pipelineStateDesc.asyncCompilation  = isManifest;
+            }
+            ReadContent();
+            if (!reader.Good() || pipelineStateDesc.computeShader == nullptr)
+                break;
+            SetObject(id, type, renderSystem.CreatePipelineState(pipelineStateDesc, pipelineCache));
+        }
+        break;
+
+        case FrameCaptureRecordResourceHeap:
+        {
+            std::vector<ResourceViewDescriptor> initialResourceViews;
+            ResourceHeapDescriptor resourceHeapDesc;
+            {
+                resourceHeapDesc.debugName          = reader.ReadString();
+                resourceHeapDesc.pipelineLayout     = GetObject<PipelineLayout>(reader.Read<std::uint32_t>(), FrameCaptureRecordPipelineLayout);
+                resourceHeapDesc.numResourceViews   = reader.Read<std::uint32_t>();
+                resourceHeapDesc.barrierFlags       = reader.ReadFlags();
+                ReadResourceViews(reader, initialResourceViews);
+            }
+            ReadContent();
+            if (!reader.Good())
+                break;
+
+            /* Resource heaps are created empty if any of their initial resources are missing; defer the initial write until all objects exist */
+            if (resourceHeapDesc.numResourceViews == 0)
+                resourceHeapDesc.numResourceViews = static_cast<std::uint32_t>(initialResourceViews.size());
+
+            SetObject(id, type, renderSystem.CreateResourceHeap(resourceHeapDesc));
+            if (!initialResourceViews.empty())
+            {
+                FrameCaptureEvent event;
+                {
+                    event.type          = FrameCaptureRecordResourceHeapWrite;
+                    event.id            = id;
+                    event.resourceViews = std::move(initialResourceViews);
+                }
+                heapWriteEvents.push_back(std::move(event));
+            }
+        }
+        break;
+
+        case FrameCaptureRecordRenderPass:
+        {
+            RenderPassDescriptor renderPassDesc;
+            std::vector<SubpassDescriptor> subpasses;
+            {
+                renderPassDesc.debugName = reader.ReadString();
+                if (const char* colorAttachments = reader.ReadData(sizeof(renderPassDesc.colorAttachments)))
+                    std::memcpy(renderPassDesc.colorAttachments, colorAttachments, sizeof(renderPassDesc.colorAttachments));
+                renderPassDesc.depthAttachment      = reader.Read<AttachmentFormatDescriptor>();
+                renderPassDesc.stencilAttachment    = reader.Read<AttachmentFormatDescriptor>();
+                renderPassDesc.samples              = reader.Read<std::uint32_t>();
+                ReadRawArray(reader, subpasses);
+                renderPassDesc.subpasses            = subpasses;
+            }
+            ReadContent();
+            if (!reader.Good())
+                break;
+            SetObject(id, type, renderSystem.CreateRenderPass(renderPassDesc));
+        }
+        break;
+
+        case FrameCaptureRecordRenderTarget:
+        {
+            auto ReadAttachment = [this, &reader](AttachmentDescriptor& attachmentDesc)
+            {
+                attachmentDesc.format       = reader.Read<Format>();
+                attachmentDesc.texture      = GetObject<Texture>(reader.Read<std::uint32_t>(), FrameCaptureRecordTexture);
+                attachmentDesc.mipLevel     = reader.Read<std::uint32_t>();
+                attachmentDesc.arrayLayer   = reader.Read<std::uint32_t>();
+            };
+
+            RenderTargetDescriptor renderTargetDesc;
+            {
+                renderTargetDesc.debugName  = reader.ReadString();
+                renderTargetDesc.renderPass = GetObject<RenderPass>(reader.Read<std::uint32_t>(), FrameCaptureRecordRenderPass);
+                renderTargetDesc.resolution = reader.Read<Extent2D>();
+                renderTargetDesc.samples    = reader.Read<std::uint32_t>();
+                for (AttachmentDescriptor& attachmentDesc : renderTargetDesc.colorAttachments)
+                    ReadAttachment(attachmentDesc);
+                for (AttachmentDescriptor& attachmentDesc : renderTargetDesc.resolveAttachments)
+                    ReadAttachment(attachmentDesc);
+                ReadAttachment(renderTargetDesc.depthStencilAttachment);
+            }
+            const std::uint32_t renderPassID = reader.Read<std::uint32_t>();
+            ReadContent();
+            if (!reader.Good())
+                break;
+
+            RenderTarget* renderTarget = renderSystem.CreateRenderTarget(renderTargetDesc);
+            SetObject(id, type, renderTarget);
+
+            /* Map the implicit render pass of the captured render target to the one of the new render target */
+            if (renderTarget != nullptr && renderPassID != 0)
+            {
+                if (const RenderPass* renderPass = renderTarget->GetRenderPass())
+                    SetObject(renderPassID, FrameCaptureRecordRenderPass, const_cast<RenderPass*>(renderPass), false);
+            }
+        }
+        break;
+
+        default:
+        break;
+    }
+
+    if (objects[id].object != nullptr)
+    {
+        ++info.numObjects;
+        return true;
+    }
+
+    if (report != nullptr)
+        report->Errorf("failed to create frame capture object %u (record type %u)\n", id, header.type);
+    return false;
+}
+
+bool FrameCapturePlayer::Pimpl::ParseEvent(const FrameCaptureRecordHeader& header, FrameCaptureReader& reader, FrameCaptureEvent& outEvent, Report* report)
+{
+    outEvent.type   = static_cast<FrameCaptureRecordType>(header.type);
+    outEvent.id     = header.id;
+
+    switch (outEvent.type)
+    {
+        case FrameCaptureRecordResourceHeapWrite:
+        {
+            outEvent.firstDescriptor = reader.Read<std::uint32_t>();
+            ReadResourceViews(reader, outEvent.resourceViews);
+        }
+        break;
+
+        case FrameCaptureRecordBufferWrite:
+        {
+            outEvent.offset             = reader.Read<std::uint64_t>();
+            outEvent.imageView.dataSize = static_cast<std::size_t>(reader.Read<std::uint64_t>());
+            outEvent.imageView.data     = reader.ReadData(outEvent.imageView.dataSize);
+        }
+        break;
+
+        case FrameCaptureRecordTextureWrite:
+        {
+            outEvent.region             = reader.Read<TextureRegion>();
+            outEvent.imageView.format   = reader.Read<ImageFormat>();
+            outEvent.imageView.dataType = reader.Read<DataType>();
+            outEvent.imageView.dataSize = static_cast<std::size_t>(reader.Read<std::uint64_t>());
+            outEvent.imageView.data     = reader.ReadData(outEvent.imageView.dataSize);
+        }
+        break;
+
+        case FrameCaptureRecordSubmit:
+        {
+            /* Validate the command stream once, so it can be executed without bounds checks on each replay */
+            outEvent.imageView.dataSize = static_cast<std::size_t>(reader.Read<std::uint64_t>());
+            outEvent.imageView.data     = reader.ReadData(outEvent.imageView.dataSize);
+            if (!reader.Good() || !ValidateCommandStream(static_cast<const char*>(outEvent.imageView.data), outEvent.imageView.dataSize, report))
+                return false;
+            ++info.numSubmissions;
+        }
+        break;
+
+        case FrameCaptureRecordPresent:
+        break;
+
+        default:
+        {
+            if (report != nullptr)
+                report->Errorf("unknown frame capture record type %u\n", header.type);
+        }
+        return false;
+    }
+
+    if (!reader.Good())
+    {
+        if (report != nullptr)
+            report->Errorf("frame capture record of type %u is truncated\n", header.type);
+        return false;
+    }
+
+    return true;
+}
+
+bool FrameCapturePlayer::Pimpl::ValidateCommandStream(const char* data, std::size_t size, Report* report)
+{
+    for (std::size_t offset = 0; offset < size;)
+    {
+        const FrameCaptureOpcode opcode = static_cast<FrameCaptureOpcode>(data[offset]);
+        offset += sizeof(opcode);
+
+        std::size_t cmdSize = 0;
+        if (!GetFrameCaptureCommandSize(opcode, data + offset, size - offset, cmdSize))
+        {
+            if (report != nullptr)
+                report->Errorf("invalid frame capture command (opcode %u)\n", static_cast<unsigned>(opcode));
+            return false;
+        }
+
+        offset += cmdSize;
+        ++info.numCommands;
+    }
+    return true;
+}
+
+void FrameCapturePlayer::Pimpl::ExecuteEvent(const FrameCaptureEvent& event)
+{
+    switch (event.type)
+    {
+        case FrameCaptureRecordResourceHeapWrite:
+        {
+            if (ResourceHeap* resourceHeap = GetObject<ResourceHeap>(event.id, FrameCaptureRecordResourceHeap))
+                renderSystem.WriteResourceHeap(*resourceHeap, event.firstDescriptor, event.resourceViews);
+        }
+        break;
+
+        case FrameCaptureRecordBufferWrite:
+        {
+            if (Buffer* buffer = GetObject<Buffer>(event.id, FrameCaptureRecordBuffer))
+                renderSystem.WriteBuffer(*buffer, event.offset, event.imageView.data, event.imageView.dataSize);
+        }
+        break;
+
+        case FrameCaptureRecordTextureWrite:
+        {
+            if (Texture* texture = GetObject<Texture>(event.id, FrameCaptureRecordTexture))
+                renderSystem.WriteTexture(*texture, event.region, event.imageView);
+        }
+        break;
+
+        case FrameCaptureRecordSubmit:
+        {
+            if (CommandBuffer* cmdBuffer = GetObject<CommandBuffer>(event.id, FrameCaptureRecordCommandBuffer))
+            {
+                ExecuteCommandStream(*cmdBuffer, static_cast<const char*>(event.imageView.data), event.imageView.dataSize);
+                if ((objects[event.id].flags & CommandBufferFlags::ImmediateSubmit) == 0)
+                    renderSystem.GetCommandQueue()->Submit(*cmdBuffer);
+            }
+        }
+        break;
+
+        case FrameCaptureRecordPresent:
+        {
+            if (swapChain != nullptr)
+                swapChain->Present();
+        }
+        break;
+
+        default:
+        break;
+    }
+}
+
+void FrameCapturePlayer::Pimpl::ExecuteCommandStream(CommandBuffer& cmdBuffer, const char* data, std::size_t size)
+{
+    isSkippingPass = false;
+    for (const char* pc = data, * pcEnd = data + size; pc < pcEnd;)
+    {
+        const FrameCaptureOpcode opcode = static_cast<FrameCaptureOpcode>(*pc);
+        pc += sizeof(opcode);
+        pc += ExecuteCommand(cmdBuffer, opcode, pc);
+    }
+}
+
+std::size_t FrameCapturePlayer::Pimpl::ExecuteCommand(CommandBuffer& cmdBuffer, const FrameCaptureOpcode opcode, const char* pc)
+{
+    /* Skip all commands inside a render pass whose render target could not be recreated */
+    if (isSkippingPass)
+    {
+        if (opcode == FrameCaptureOpcodeEndRenderPass)
+            isSkippingPass = false;
+        std::size_t cmdSize = 0;
+        GetFrameCaptureCommandSize(opcode, pc, ~std::size_t(0), cmdSize);
+        return cmdSize;
+    }
+
+    switch (opcode)
+    {
+        case FrameCaptureOpcodeBegin:
+        {
+            cmdBuffer.Begin();
+            return 0;
+        }
+        case FrameCaptureOpcodeEnd:
+        {
+            cmdBuffer.End();
+            return 0;
+        }
+        case FrameCaptureOpcodeUpdateBuffer:
+        {
+            auto cmd = reinterpret_cast<const FrameCaptureCmdUpdateBuffer*>(pc);
+            if (Buffer* dstBuffer = GetObject<Buffer>(cmd->dstBuffer, FrameCaptureRecordBuffer))
+                cmdBuffer.UpdateBuffer(*dstBuffer, cmd->dstOffset, cmd + 1, cmd->dataSize);
+            return (sizeof(*cmd) + static_cast<std::size_t>(cmd->dataSize));
+        }
+        case FrameCaptureOpcodeCopyBuffer:
+        {
+            auto cmd = reinterpret_cast<const FrameCaptureCmdCopyBuffer*>(pc);
+            Buffer* dstBuffer = GetObject<Buffer>(cmd->dstBuffer, FrameCaptureRecordBuffer);
+            Buffer* srcBuffer = GetObject<Buffer>(cmd->srcBuffer, FrameCaptureRecordBuffer);
+            if (dstBuffer != nullptr && srcBuffer != nullptr)
+                cmdBuffer.CopyBuffer(*dstBuffer, cmd->dstOffset, *srcBuffer, cmd->srcOffset, cmd->size);
+            return sizeof(*cmd);
+        }
+        case FrameCaptureOpcodeCopyBufferFromTexture:
+        {
+            auto cmd = reinterpret_cast<const FrameCaptureCmdCopyBufferTexture*>(pc);
+            Buffer* buffer = GetObject<Buffer>(cmd->buffer, FrameCaptureRecordBuffer);
+            Texture* texture = GetObject<Texture>(cmd->texture, FrameCaptureRecordTexture);
+            if (buffer != nullptr && texture != nullptr)
+                cmdBuffer.CopyBufferFromTexture(*buffer, cmd->offset, *texture, cmd->region, cmd->rowStride, cmd->layerStride);
+            return sizeof(*cmd);
+        }
+        case FrameCaptureOpcodeFillBuffer:
+        {
+            auto cmd = reinterpret_cast<const FrameCaptureCmdFillBuffer*>(pc);
+            if (Buffer* dstBuffer = GetObject<Buffer>(cmd->dstBuffer, FrameCaptureRecordBuffer))
+                cmdBuffer.FillBuffer(*dstBuffer, cmd->dstOffset, cmd->value, cmd->fillSize);
+            return sizeof(*cmd);
+        }
+        case FrameCaptureOpcodeCopyTexture:
+        {
+            auto cmd = reinterpret_cast<const FrameCaptureCmdCopyTexture*>(pc);
+            Texture* dstTexture = GetObject<Texture>(cmd->dstTexture, FrameCaptureRecordTexture);
+            Texture* srcTexture = GetObject<Texture>(cmd->srcTexture, FrameCaptureRecordTexture);
+            if (dstTexture != nullptr && srcTexture != nullptr)
+                cmdBuffer.CopyTexture(*dstTexture, cmd->dstLocation, *srcTexture, cmd->srcLocation, cmd->extent);
+            return sizeof(*cmd);
+        }
+        case FrameCaptureOpcodeCopyTextureFromBuffer:
+        {
+            auto cmd = reinterpret_cast<const FrameCaptureCmdCopyBufferTexture*>(pc);
+            Buffer* buffer = GetObject<Buffer>(cmd->buffer, FrameCaptureRecordBuffer);
+            Texture* texture = GetObject<Texture>(cmd->texture, FrameCaptureRecordTexture);
+            if (buffer != nullptr && texture != nullptr)
+                cmdBuffer.CopyTextureFromBuffer(*texture, cmd->region, *buffer, cmd->offset, cmd->rowStride, cmd->layerStride);
+            return sizeof(*cmd);
+        }
+        case FrameCaptureOpcodeGenerateMips:
+        {
+            auto cmd = reinterpret_cast<const FrameCaptureCmdGenerateMips*>(pc);
+            if (Texture* texture = GetObject<Texture>(cmd->texture, FrameCaptureRecordTexture))
+                cmdBuffer.GenerateMips(*texture);
+            return sizeof(*cmd);
+        }
+        case FrameCaptureOpcodeGenerateMipsRange:
+        {
+            auto cmd = reinterpret_cast<const FrameCaptureCmdGenerateMips*>(pc);
+            if (Texture* texture = GetObject<Texture>(cmd->texture, FrameCaptureRecordTexture))
+                cmdBuffer.GenerateMips(*texture, cmd->subresource);
+            return sizeof(*cmd);
+        }
+        case FrameCaptureOpcodeSetViewports:
+        {
+            auto cmd = reinterpret_cast<const FrameCaptureCmdSetViewports*>(pc);
+            cmdBuffer.SetViewports(cmd->count, reinterpret_cast<const Viewport*>(cmd + 1));
+            return (sizeof(*cmd) + sizeof(Viewport) * cmd->count);
+        }
+        case FrameCaptureOpcodeSetScissors:
+        {
+            auto cmd = reinterpret_cast<const FrameCaptureCmdSetScissors*>(pc);
+            cmdBuffer.SetScissors(cmd->count, reinterpret_cast<const Scissor*>(cmd + 1));
+            return (sizeof(*cmd) + sizeof(Scissor) * cmd->count);
+        }
+        case FrameCaptureOpcodeSetVertexBuffer:
+        {
+            auto cmd = reinterpret_cast<const FrameCaptureCmdSetBuffer*>(pc);
+            if (Buffer* buffer = GetObject<Buffer>(cmd->buffer, FrameCaptureRecordBuffer))
+                cmdBuffer.SetVertexBuffer(*buffer);
+            return sizeof(*cmd);
+        }
+        case FrameCaptureOpcodeSetIndexBuffer:
+        {
+            auto cmd = reinterpret_cast<const FrameCaptureCmdSetBuffer*>(pc);
+            if (Buffer* buffer = GetObject<Buffer>(cmd->buffer, FrameCaptureRecordBuffer))
+                cmdBuffer.SetIndexBuffer(*buffer);
+            return sizeof(*cmd);
+        }
+        case FrameCaptureOpcodeSetIndexBufferExt:
+        {
+            auto cmd = reinterpret_cast<const FrameCaptureCmdSetIndexBufferExt*>(pc);
+            if (Buffer* buffer = GetObject<Buffer>(cmd->buffer, FrameCaptureRecordBuffer))
+                cmdBuffer.SetIndexBuffer(*buffer, cmd->format, cmd->offset);
+            return sizeof(*cmd);
+        }
+        case FrameCaptureOpcodeSetResourceHeap:
+        {
+            auto cmd = reinterpret_cast<const FrameCaptureCmdSetResourceHeap*>(pc);
+            if (ResourceHeap* resourceHeap = GetObject<ResourceHeap>(cmd->resourceHeap, FrameCaptureRecordResourceHeap))
+                cmdBuffer.SetResourceHeap(*resourceHeap, cmd->descriptorSet);
+            return sizeof(*cmd);
+        }
+        case FrameCaptureOpcodeSetResource:
+        {
+            auto cmd = reinterpret_cast<const FrameCaptureCmdSetResource*>(pc);
+            if (Resource* resource = GetResource(cmd->resource))
+                cmdBuffer.SetResource(cmd->descriptor, *resource);
+            return sizeof(*cmd);
+        }
+        case FrameCaptureOpcodeBeginRenderPass:
+        {
+            auto cmd = reinterpret_cast<const FrameCaptureCmdBeginRenderPass*>(pc);
+            if (RenderTarget* renderTarget = GetRenderTarget(cmd->renderTarget))
+            {
+                const RenderPass* renderPass = GetObject<RenderPass>(cmd->renderPass, FrameCaptureRecordRenderPass);
+                cmdBuffer.BeginRenderPass(*renderTarget, renderPass, cmd->numClearValues, reinterpret_cast<const ClearValue*>(cmd + 1), cmd->swapBufferIndex);
+            }
+            else
+                isSkippingPass = true;
+            return (sizeof(*cmd) + sizeof(ClearValue) * cmd->numClearValues);
+        }
+        case FrameCaptureOpcodeEndRenderPass:
+        {
+            cmdBuffer.EndRenderPass();
+            return 0;
+        }
+        case FrameCaptureOpcodeNextSubpass:
+        {
+            cmdBuffer.NextSubpass();
+            return 0;
+        }
+        case FrameCaptureOpcodeClear:
+        {
+            auto cmd = reinterpret_cast<const FrameCaptureCmdClear*>(pc);
+            cmdBuffer.Clear(static_cast<long>(cmd->flags), cmd->clearValue);
+            return sizeof(*cmd);
+        }
+        case FrameCaptureOpcodeClearAttachments:
+        {
+            auto cmd = reinterpret_cast<const FrameCaptureCmdClearAttachments*>(pc);
+            auto src = reinterpret_cast<const FrameCaptureCmdClearAttachment*>(cmd + 1);
+            std::vector<AttachmentClear> attachments(cmd->count);
+            for_range(i, cmd->count)
+            {
+                attachments[i].flags            = static_cast<long>(src[i].flags);
+                attachments[i].colorAttachment  = src[i].colorAttachment;
+                attachments[i].clearValue       = src[i].clearValue;
+            }
+            cmdBuffer.ClearAttachments(cmd->count, attachments.data());
+            return (sizeof(*cmd) + sizeof(FrameCaptureCmdClearAttachment) * cmd->count);
+        }
+        case FrameCaptureOpcodeSetPipelineState:
+        {
+            auto cmd = reinterpret_cast<const FrameCaptureCmdSetPipelineState*>(pc);
+            PipelineState* pipelineState = GetObject<PipelineState>(cmd->pipelineState, FrameCaptureRecordGraphicsPipeline);
+            if (pipelineState == nullptr)
+                pipelineState = GetObject<PipelineState>(cmd->pipelineState, FrameCaptureRecordComputePipeline);
+            if (pipelineState != nullptr)
+                cmdBuffer.SetPipelineState(*pipelineState);
+            return sizeof(*cmd);
+        }
+        case FrameCaptureOpcodeSetBlendFactor:
+        {
+            auto cmd = reinterpret_cast<const FrameCaptureCmdSetBlendFactor*>(pc);
+            cmdBuffer.SetBlendFactor(cmd->color);
+            return sizeof(*cmd);
+        }
+        case FrameCaptureOpcodeSetStencilReference:
+        {
+            auto cmd = reinterpret_cast<const FrameCaptureCmdSetStencilReference*>(pc);
+            cmdBuffer.SetStencilReference(cmd->reference, cmd->stencilFace);
+            return sizeof(*cmd);
+        }
+        case FrameCaptureOpcodeSetUniforms:
+        {
+            auto cmd = reinterpret_cast<const FrameCaptureCmdSetUniforms*>(pc);
+            cmdBuffer.SetUniforms(cmd->first, cmd + 1, cmd->dataSize);
+            return (sizeof(*cmd) + cmd->dataSize);
+        }
+        case FrameCaptureOpcodeDraw:
+        {
+            auto cmd = reinterpret_cast<const FrameCaptureCmdDraw*>(pc);
+            cmdBuffer.Draw(cmd->numVertices, cmd->firstVertex);
+            return sizeof(*cmd);
+        }
+        case FrameCaptureOpcodeDrawIndexed:
+        {
+            auto cmd = reinterpret_cast<const FrameCaptureCmdDrawIndexed*>(pc);
+            cmdBuffer.DrawIndexed(cmd->numIndices, cmd->firstIndex, cmd->vertexOffset);
+            return sizeof(*cmd);
+        }
+        case FrameCaptureOpcodeDrawInstanced:
+        {
+            auto cmd = reinterpret_cast<const FrameCaptureCmdDraw*>(pc);
+            cmdBuffer.DrawInstanced(cmd->numVertices, cmd->firstVertex, cmd->numInstances, cmd->firstInstance);
+            return sizeof(*cmd);
+        }
+        case FrameCaptureOpcodeDrawIndexedInstanced:
+        {
+            auto cmd = reinterpret_cast<const FrameCaptureCmdDrawIndexed*>(pc);
+            cmdBuffer.DrawIndexedInstanced(cmd->numIndices, cmd->numInstances, cmd->firstIndex, cmd->vertexOffset, cmd->firstInstance);
+            return sizeof(*cmd);
+        }
+        case FrameCaptureOpcodeDrawIndirect:
+        case FrameCaptureOpcodeDrawIndirectCount:
+        case FrameCaptureOpcodeDrawIndexedIndirect:
+        case FrameCaptureOpcodeDrawIndexedIndirectCount:
+        case FrameCaptureOpcodeDrawMeshIndirect:
+        {
+            auto cmd = reinterpret_cast<const FrameCaptureCmdDrawIndirect*>(pc);
+            Buffer* buffer = GetObject<Buffer>(cmd->buffer, FrameCaptureRecordBuffer);
+            Buffer* countBuffer = GetObject<Buffer>(cmd->countBuffer, FrameCaptureRecordBuffer);
+            if (buffer == nullptr)
+                return sizeof(*cmd);
+
+            switch (opcode)
+            {
+                case FrameCaptureOpcodeDrawIndirect:
+                    cmdBuffer.DrawIndirect(*buffer, cmd->offset, cmd->numCommands, cmd->stride);
+                    break;
+                case FrameCaptureOpcodeDrawIndirectCount:
+                    if (countBuffer != nullptr)
+                        cmdBuffer.DrawIndirect(*buffer, cmd->offset, *countBuffer, cmd->countBufferOffset, cmd->numCommands, cmd->stride);
+                    break;
+                case FrameCaptureOpcodeDrawIndexedIndirect:
+                    cmdBuffer.DrawIndexedIndirect(*buffer, cmd->offset, cmd->numCommands, cmd->stride);
+                    break;
+                case FrameCaptureOpcodeDrawIndexedIndirectCount:
+                    if (countBuffer != nullptr)
+                        cmdBuffer.DrawIndexedIndirect(*buffer, cmd->offset, *countBuffer, cmd->countBufferOffset, cmd->numCommands, cmd->stride);
+                    break;
+                default:
+                    cmdBuffer.DrawMeshIndirect(*buffer, cmd->offset, cmd->numCommands, cmd->stride);
+                    break;
+            }
+            return sizeof(*cmd);
+        }
+        case FrameCaptureOpcodeDrawMesh:
+        {
+            auto cmd = reinterpret_cast<const FrameCaptureCmdDispatch*>(pc);
+            cmdBuffer.DrawMesh(cmd->numWorkGroups[0], cmd->numWorkGroups[1], cmd->numWorkGroups[2]);
+            return sizeof(*cmd);
+        }
+        case FrameCaptureOpcodeDispatch:
+        {
+            auto cmd = reinterpret_cast<const FrameCaptureCmdDispatch*>(pc);
+            cmdBuffer.Dispatch(cmd->numWorkGroups[0], cmd->numWorkGroups[1], cmd->numWorkGroups[2]);
+            return sizeof(*cmd);
+        }
+        case FrameCaptureOpcodeDispatchIndirect:
+        {
+            auto cmd = reinterpret_cast<const FrameCaptureCmdDispatchIndirect*>(pc);
+            if (Buffer* buffer = GetObject<Buffer>(cmd->buffer, FrameCaptureRecordBuffer))
+                cmdBuffer.DispatchIndirect(*buffer, cmd->offset);
+            return sizeof(*cmd);
+        }
+        case FrameCaptureOpcodePushDebugGroup:
+        {
+            auto cmd = reinterpret_cast<const FrameCaptureCmdPushDebugGroup*>(pc);
+            cmdBuffer.PushDebugGroup(reinterpret_cast<const char*>(cmd + 1));
+            return (sizeof(*cmd) + cmd->length + 1);
+        }
+        case FrameCaptureOpcodePopDebugGroup:
+        {
+            cmdBuffer.PopDebugGroup();
+            return 0;
+        }
+    }
+    return 0;
+}
+
+void FrameCapturePlayer::Pimpl::ReadResourceViews(FrameCaptureReader& reader, std::vector<ResourceViewDescriptor>& outResourceViews)
+{
+    outResourceViews.resize(reader.Read<std::uint32_t>());
+    for (ResourceViewDescriptor& resourceView : outResourceViews)
+    {
+        resourceView.resource       = GetResource(reader.Read<std::uint32_t>());
+        resourceView.textureView    = reader.Read<TextureViewDescriptor>();
+        resourceView.bufferView     = reader.Read<BufferViewDescriptor>();
+        resourceView.initialCount   = reader.Read<std::uint32_t>();
+        if (!reader.Good())
+            break;
+    }
+}
+
+void FrameCapturePlayer::Pimpl::SetObject(std::uint32_t id, const FrameCaptureRecordType type, RenderSystemChild* object, bool owned)
+{
+    if (id > 0 && id < objects.size())
+    {
+        FrameCaptureObject& entry = objects[id];
+        entry.type      = type;
+        entry.object    = object;
+        entry.owned     = owned;
+    }
+}
+
+template <typename T>
+T* FrameCapturePlayer::Pimpl::GetObject(std::uint32_t id, const FrameCaptureRecordType type) const
+{
+    if (id > 0 && id < objects.size() && objects[id].type == type)
+        return static_cast<T*>(objects[id].object);
+    return nullptr;
+}
+
+Resource* FrameCapturePlayer::Pimpl::GetResource(std::uint32_t id) const
+{
+    if (Buffer* buffer = GetObject<Buffer>(id, FrameCaptureRecordBuffer))
+        return buffer;
+    if (Texture* texture = GetObject<Texture>(id, FrameCaptureRecordTexture))
+        return texture;
+    if (Sampler* sampler = GetObject<Sampler>(id, FrameCaptureRecordSampler))
+        return sampler;
+    return nullptr;
+}
+
+RenderTarget* FrameCapturePlayer::Pimpl::GetRenderTarget(std::uint32_t id) const
+{
+    if (SwapChain* swapChain = GetObject<SwapChain>(id, FrameCaptureRecordSwapChain))
+        return swapChain;
+    return GetObject<RenderTarget>(id, FrameCaptureRecordRenderTarget);
+}
+
+
+/*
+ * FrameCapturePlayer class
+ */
+
+FrameCapturePlayer::FrameCapturePlayer(RenderSystem& renderSystem, SwapChain* swapChain) :
+    pimpl_ { new Pimpl{ renderSystem, swapChain } }
+{
+}
+
+FrameCapturePlayer::~FrameCapturePlayer()
+{
+    delete pimpl_;
+}
+
+bool FrameCapturePlayer::LoadFromFile(const char* filename, Report* report)
+{
+    if (!pimpl_->Load(filename, report))
+    {
+        pimpl_->ReleaseObjects();
+        return false;
+    }
+    return true;
+}
+
+void FrameCapturePlayer::RestoreResources()
+{
+    for (const FrameCaptureEvent& event : pimpl_->restoreEvents)
+        pimpl_->ExecuteEvent(event);
+}
+
+void FrameCapturePlayer::Replay()
+{
+    for (const FrameCaptureEvent& event : pimpl_->frameEvents)
+        pimpl_->ExecuteEvent(event);
+}
+
+const FrameCaptureInfo& FrameCapturePlayer::GetInfo() const
+{
+    return pimpl_->info;
+}
+
+
+/*
+ * Global functions
+ */
+
+LLGL_EXPORT bool WarmUpPipelines(
+    RenderSystem&   renderSystem,
+    const char*     filename,
+    PipelineCache*  pipelineCache,
+    SwapChain*      swapChain,
+    Report*         report)
+{
+    FrameCapturePlayer::Pimpl manifest{ renderSystem, swapChain };
+    {
+        manifest.pipelineCache  = pipelineCache;
+        manifest.isManifest     = true;
+    }
+
+    /* All PSOs are compiled asynchronously while the manifest is parsed; releasing them on destruction waits until their compilation has finished */
+    return manifest.Load(filename, report);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
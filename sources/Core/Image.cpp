@@ -7,8 +7,11 @@
 
 #include <LLGL/Utils/Image.h>
 #include "ImageUtils.h"
+#include "ImageDownsampler.h"
 #include "Exception.h"
 #include "PrintfUtils.h"
+#include <LLGL/TextureFlags.h>
+#include <LLGL/Utils/ForRange.h>
 #include <algorithm>
 #include <string.h>
 
@@ -238,7 +241,7 @@ static bool Overlap3DRegion(const Offset3D& dstOffset, const Offset3D& srcOffset
     );
 }
 
-void Image::Blit(Offset3D dstRegionOffset, const Image& srcImage, Offset3D srcRegionOffset, Extent3D srcRegionExtent)
+void Image::Blit(Offset3D dstRegionOffset, const Image& srcImage, Offset3D srcRegionOffset, Extent3D srcRegionExtent, unsigned threadCount)
 {
     if (GetFormat() == srcImage.GetFormat() && GetDataType() == srcImage.GetDataType())
     {
@@ -274,7 +277,8 @@ void Image::Blit(Offset3D dstRegionOffset, const Image& srcImage, Offset3D srcRe
                 srcRegionOffset,
                 srcExtent.width,
                 srcExtent.width * srcExtent.height,
-                srcRegionExtent
+                srcRegionExtent,
+                threadCount
             );
         }
     }
@@ -333,7 +337,8 @@ void Image::ReadPixels(const Offset3D& offset, const Extent3D& extent, const Mut
             BitBlit(
                 extent, bpp,
                 dst, dstRowStride, dstDepthStride,
-                src, srcRowStride, srcDepthStride
+                src, srcRowStride, srcDepthStride,
+                threadCount
             );
         }
         else
@@ -344,7 +349,8 @@ void Image::ReadPixels(const Offset3D& offset, const Extent3D& extent, const Mut
             BitBlit(
                 extent, bpp,
                 reinterpret_cast<char*>(subImage.GetData()), subImage.GetRowStride(), subImage.GetDepthStride(),
-                src, srcRowStride, srcDepthStride
+                src, srcRowStride, srcDepthStride,
+                threadCount
             );
 
             /* Convert sub-image */
@@ -380,7 +386,8 @@ void Image::WritePixels(const Offset3D& offset, const Extent3D& extent, const Im
             BitBlit(
                 extent, bpp,
                 dst, dstRowStride, dstDepthStride,
-                src, srcRowStride, srcDepthStride
+                src, srcRowStride, srcDepthStride,
+                threadCount
             );
         }
         else
@@ -396,12 +403,101 @@ void Image::WritePixels(const Offset3D& offset, const Extent3D& extent, const Im
             BitBlit(
                 extent, bpp,
                 dst, dstRowStride, dstDepthStride,
-                reinterpret_cast<const char*>(subImage.GetData()), subImage.GetRowStride(), subImage.GetDepthStride()
+                reinterpret_cast<const char*>(subImage.GetData()), subImage.GetRowStride(), subImage.GetDepthStride(),
+                threadCount
             );
         }
     }
 }
 
+/* ----- MIP-maps ----- */
+
+static Extent3D GetImageMipExtent(const Extent3D& extent, std::uint32_t mipLevel)
+{
+    return GetMipExtent(TextureType::Texture3D, extent, mipLevel);
+}
+
+DynamicByteArray Image::GenerateMipChain(ImageFilter filter, std::uint32_t numMipLevels, unsigned threadCount) const
+{
+    if (!data_ || IsCompressedFormat(GetFormat()) || IsDepthOrStencilFormat(GetFormat()))
+        return nullptr;
+
+    /* Clamp number of MIP-maps to full MIP-map chain */
+    const std::uint32_t maxNumMipLevels = NumMipLevels(GetExtent().width, GetExtent().height, GetExtent().depth);
+    numMipLevels = (numMipLevels == 0 ? maxNumMipLevels : std::min(numMipLevels, maxNumMipLevels));
+
+    /* Allocate buffer for entire MIP-map chain and copy base level */
+    DynamicByteArray mipChain{ GetMipChainOffset(numMipLevels), UninitializeTag{} };
+    ::memcpy(mipChain.get(), GetData(), GetDataSize());
+
+    if (numMipLevels < 2)
+        return mipChain;
+
+    /* Convert base level into floating-point components for filtering */
+    const std::uint32_t numComponents = ImageFormatSize(GetFormat());
+
+    auto GetFloatImageSize = [numComponents](const Extent3D& extent) -> std::size_t
+    {
+        return static_cast<std::size_t>(extent.width) * extent.height * extent.depth * numComponents;
+    };
+
+    /* Images with Float32 components already have the layout of the filter input and output, so only those are copied directly */
+    const bool isFloatImage = (GetDataType() == DataType::Float32);
+
+    auto ConvertMipLevel = [threadCount](const ImageView& srcView, const MutableImageView& dstView)
+    {
+        if (!ConvertImageBuffer(srcView, dstView, threadCount))
+        {
+            LLGL_TRAP("failed to convert data type of MIP-map level for MIP-map generation");
+        }
+    };
+
+    DynamicArray<float> srcLevel{ GetFloatImageSize(GetExtent()), UninitializeTag{} };
+    {
+        const MutableImageView floatView{ GetFormat(), DataType::Float32, srcLevel.data(), srcLevel.size() * sizeof(float) };
+        if (isFloatImage)
+            ::memcpy(srcLevel.data(), GetData(), GetDataSize());
+        else
+            ConvertMipLevel(GetView(), floatView);
+    }
+
+    /* Downsample each MIP-map level from its previous level and convert it back into the data type of this image */
+    for_subrange(mipLevel, 1u, numMipLevels)
+    {
+        const Extent3D srcExtent = GetImageMipExtent(GetExtent(), mipLevel - 1);
+        const Extent3D dstExtent = GetImageMipExtent(GetExtent(), mipLevel);
+
+        DynamicArray<float> dstLevel{ GetFloatImageSize(dstExtent), UninitializeTag{} };
+        DownsampleImageFloat32(filter, dstLevel.data(), dstExtent, srcLevel.data(), srcExtent, numComponents, threadCount);
+
+        const std::size_t   dstOffset   = GetMipChainOffset(mipLevel);
+        const std::size_t   dstSize     = GetMipChainOffset(mipLevel + 1) - dstOffset;
+        const ImageView     floatView{ GetFormat(), DataType::Float32, dstLevel.data(), dstLevel.size() * sizeof(float) };
+        const MutableImageView mipView{ GetFormat(), GetDataType(), mipChain.get() + dstOffset, dstSize };
+
+        if (isFloatImage)
+            ::memcpy(mipView.data, dstLevel.data(), dstSize);
+        else
+            ConvertMipLevel(floatView, mipView);
+
+        srcLevel = std::move(dstLevel);
+    }
+
+    return mipChain;
+}
+
+std::size_t Image::GetMipChainOffset(std::uint32_t mipLevel) const
+{
+    std::size_t offset = 0;
+    for_range(i, mipLevel)
+    {
+        const Extent3D mipExtent = GetImageMipExtent(GetExtent(), i);
+        offset += GetMemoryFootprint(GetFormat(), GetDataType(), static_cast<std::size_t>(mipExtent.width) * mipExtent.height * mipExtent.depth);
+    }
+    return offset;
+}
+
+
 /* ----- Attributes ----- */
 
 ImageView Image::GetView() const
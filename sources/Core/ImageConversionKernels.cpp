@@ -0,0 +1,447 @@
+/*
+ * ImageConversionKernels.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "ImageConversionKernels.h"
+#include "CPUFeatures.h"
+#include "Float16Compressor.h"
+#include <cstdint>
+#include <cstring>
+
+#if defined LLGL_SIMD_X86
+#   include <immintrin.h>
+#elif defined LLGL_SIMD_NEON
+#   include <arm_neon.h>
+#endif
+
+
+namespace LLGL
+{
+
+
+/*
+ * Scalar kernels
+ *
+ * These are used for the remainder of each range that does not fill an entire SIMD register
+ * and they must produce the same results as the generic variant conversion in ImageFlags.cpp for normalized values.
+ */
+
+static void SwizzleRB8Scalar(const std::uint8_t* src, std::uint8_t* dst, std::size_t begin, std::size_t end)
+{
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        const std::uint8_t r = src[i*4    ];
+        const std::uint8_t g = src[i*4 + 1];
+        const std::uint8_t b = src[i*4 + 2];
+        const std::uint8_t a = src[i*4 + 3];
+        dst[i*4    ] = b;
+        dst[i*4 + 1] = g;
+        dst[i*4 + 2] = r;
+        dst[i*4 + 3] = a;
+    }
+}
+
+static void ExpandRGB8ToRGBA8Scalar(const std::uint8_t* src, std::uint8_t* dst, std::size_t begin, std::size_t end)
+{
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        dst[i*4    ] = src[i*3    ];
+        dst[i*4 + 1] = src[i*3 + 1];
+        dst[i*4 + 2] = src[i*3 + 2];
+        dst[i*4 + 3] = 0xFF;
+    }
+}
+
+static void ConvertUInt8ToFloat32Scalar(const std::uint8_t* src, float* dst, std::size_t begin, std::size_t end)
+{
+    for (std::size_t i = begin; i < end; ++i)
+        dst[i] = static_cast<float>(static_cast<double>(src[i]) / 255.0);
+}
+
+static void ConvertFloat32ToUInt8Scalar(const float* src, std::uint8_t* dst, std::size_t begin, std::size_t end)
+{
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        /* Scale in double precision to match the generic conversion and saturate like the SIMD kernels do (NaN maps to zero) */
+        double value = static_cast<double>(src[i]) * 255.0;
+        value = (value > 0.0 ? value : 0.0);
+        value = (value < 255.0 ? value : 255.0);
+        dst[i] = static_cast<std::uint8_t>(value);
+    }
+}
+
+#define LLGL_DEF_KERNEL_ENTRY(NAME, IMPL, SRC_TYPE, DST_TYPE)                           \
+    static void NAME(const void* src, void* dst, std::size_t begin, std::size_t end)    \
+    {                                                                                   \
+        IMPL(static_cast<const SRC_TYPE*>(src), static_cast<DST_TYPE*>(dst), begin, end); \
+    }
+
+LLGL_DEF_KERNEL_ENTRY( SwizzleRB8Kernel_Scalar,             SwizzleRB8Scalar,               std::uint8_t,   std::uint8_t    )
+LLGL_DEF_KERNEL_ENTRY( ExpandRGB8ToRGBA8Kernel_Scalar,      ExpandRGB8ToRGBA8Scalar,        std::uint8_t,   std::uint8_t    )
+LLGL_DEF_KERNEL_ENTRY( ConvertUInt8ToFloat32Kernel_Scalar,  ConvertUInt8ToFloat32Scalar,    std::uint8_t,   float           )
+LLGL_DEF_KERNEL_ENTRY( ConvertFloat32ToUInt8Kernel_Scalar,  ConvertFloat32ToUInt8Scalar,    float,          std::uint8_t    )
+
+// Float16 conversions are forwarded to the bulk routines of the Float16 compressor, which select their own SIMD path.
+static void ConvertFloat32ToFloat16Kernel(const void* src, void* dst, std::size_t begin, std::size_t end)
+{
+    CompressFloat16Array(static_cast<std::uint16_t*>(dst) + begin, static_cast<const float*>(src) + begin, end - begin);
+}
+
+static void ConvertFloat16ToFloat32Kernel(const void* src, void* dst, std::size_t begin, std::size_t end)
+{
+    DecompressFloat16Array(static_cast<float*>(dst) + begin, static_cast<const std::uint16_t*>(src) + begin, end - begin);
+}
+
+
+#if defined LLGL_SIMD_X86
+
+/*
+ * SSSE3/SSE4.1 kernels
+ */
+
+LLGL_TARGET_SIMD("ssse3")
+static void SwizzleRB8SSSE3(const std::uint8_t* src, std::uint8_t* dst, std::size_t begin, std::size_t end)
+{
+    const __m128i mask = _mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+
+    std::size_t i = begin;
+    for (; i + 4 <= end; i += 4)
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i*4));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i*4), _mm_shuffle_epi8(v, mask));
+    }
+    SwizzleRB8Scalar(src, dst, i, end);
+}
+
+LLGL_TARGET_SIMD("ssse3")
+static void ExpandRGB8ToRGBA8SSSE3(const std::uint8_t* src, std::uint8_t* dst, std::size_t begin, std::size_t end)
+{
+    const __m128i mask  = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const __m128i alpha = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+
+    /* Each iteration loads 16 source bytes but only consumes 12, so stop when less than 6 pixels remain to not read past the end */
+    std::size_t i = begin;
+    for (; i + 6 <= end; i += 4)
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i*3));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i*4), _mm_or_si128(_mm_shuffle_epi8(v, mask), alpha));
+    }
+    ExpandRGB8ToRGBA8Scalar(src, dst, i, end);
+}
+
+LLGL_TARGET_SIMD("sse4.1")
+static void ConvertUInt8ToFloat32SSE41(const std::uint8_t* src, float* dst, std::size_t begin, std::size_t end)
+{
+    const __m128 scale = _mm_set1_ps(255.0f);
+
+    std::size_t i = begin;
+    for (; i + 16 <= end; i += 16)
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_ps(dst + i     , _mm_div_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(v                    )), scale));
+        _mm_storeu_ps(dst + i +  4, _mm_div_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(v,  4))), scale));
+        _mm_storeu_ps(dst + i +  8, _mm_div_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(v,  8))), scale));
+        _mm_storeu_ps(dst + i + 12, _mm_div_ps(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(v, 12))), scale));
+    }
+    ConvertUInt8ToFloat32Scalar(src, dst, i, end);
+}
+
+// Converts 4 floats to 4 saturated integers in the range [0, 255] using double precision for the scaling.
+LLGL_TARGET_SIMD("sse4.1")
+static __m128i ScaleFloat32ToUInt8x4SSE41(__m128 v)
+{
+    const __m128d scale = _mm_set1_pd(255.0);
+    const __m128d zero  = _mm_setzero_pd();
+
+    __m128d lo = _mm_mul_pd(_mm_cvtps_pd(v), scale);
+    __m128d hi = _mm_mul_pd(_mm_cvtps_pd(_mm_movehl_ps(v, v)), scale);
+
+    /* MAXPD returns the second operand if either operand is NaN */
+    lo = _mm_min_pd(_mm_max_pd(lo, zero), scale);
+    hi = _mm_min_pd(_mm_max_pd(hi, zero), scale);
+
+    return _mm_unpacklo_epi64(_mm_cvttpd_epi32(lo), _mm_cvttpd_epi32(hi));
+}
+
+LLGL_TARGET_SIMD("sse4.1")
+static void ConvertFloat32ToUInt8SSE41(const float* src, std::uint8_t* dst, std::size_t begin, std::size_t end)
+{
+    std::size_t i = begin;
+    for (; i + 16 <= end; i += 16)
+    {
+        const __m128i v0 = ScaleFloat32ToUInt8x4SSE41(_mm_loadu_ps(src + i     ));
+        const __m128i v1 = ScaleFloat32ToUInt8x4SSE41(_mm_loadu_ps(src + i +  4));
+        const __m128i v2 = ScaleFloat32ToUInt8x4SSE41(_mm_loadu_ps(src + i +  8));
+        const __m128i v3 = ScaleFloat32ToUInt8x4SSE41(_mm_loadu_ps(src + i + 12));
+        const __m128i v = _mm_packus_epi16(_mm_packus_epi32(v0, v1), _mm_packus_epi32(v2, v3));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), v);
+    }
+    ConvertFloat32ToUInt8Scalar(src, dst, i, end);
+}
+
+/*
+ * AVX2 kernels
+ */
+
+LLGL_TARGET_SIMD("avx2")
+static void SwizzleRB8AVX2(const std::uint8_t* src, std::uint8_t* dst, std::size_t begin, std::size_t end)
+{
+    /* VPSHUFB shuffles within each 128-bit lane, so the same mask applies to both lanes */
+    const __m256i mask = _mm256_setr_epi8(
+        2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15,
+        2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15
+    );
+
+    std::size_t i = begin;
+    for (; i + 8 <= end; i += 8)
+    {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i*4));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i*4), _mm256_shuffle_epi8(v, mask));
+    }
+    SwizzleRB8Scalar(src, dst, i, end);
+}
+
+LLGL_TARGET_SIMD("avx2")
+static void ConvertUInt8ToFloat32AVX2(const std::uint8_t* src, float* dst, std::size_t begin, std::size_t end)
+{
+    const __m256 scale = _mm256_set1_ps(255.0f);
+
+    std::size_t i = begin;
+    for (; i + 16 <= end; i += 16)
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm256_storeu_ps(dst + i    , _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(v                   )), scale));
+        _mm256_storeu_ps(dst + i + 8, _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(v, 8))), scale));
+    }
+    ConvertUInt8ToFloat32Scalar(src, dst, i, end);
+}
+
+LLGL_TARGET_SIMD("avx2")
+static __m128i ScaleFloat32ToUInt8x4AVX2(__m128 v)
+{
+    const __m256d scale = _mm256_set1_pd(255.0);
+    __m256d d = _mm256_mul_pd(_mm256_cvtps_pd(v), scale);
+    d = _mm256_min_pd(_mm256_max_pd(d, _mm256_setzero_pd()), scale);
+    return _mm256_cvttpd_epi32(d);
+}
+
+LLGL_TARGET_SIMD("avx2")
+static void ConvertFloat32ToUInt8AVX2(const float* src, std::uint8_t* dst, std::size_t begin, std::size_t end)
+{
+    std::size_t i = begin;
+    for (; i + 16 <= end; i += 16)
+    {
+        const __m128i v0 = ScaleFloat32ToUInt8x4AVX2(_mm_loadu_ps(src + i     ));
+        const __m128i v1 = ScaleFloat32ToUInt8x4AVX2(_mm_loadu_ps(src + i +  4));
+        const __m128i v2 = ScaleFloat32ToUInt8x4AVX2(_mm_loadu_ps(src + i +  8));
+        const __m128i v3 = ScaleFloat32ToUInt8x4AVX2(_mm_loadu_ps(src + i + 12));
+        const __m128i v = _mm_packus_epi16(_mm_packus_epi32(v0, v1), _mm_packus_epi32(v2, v3));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), v);
+    }
+    ConvertFloat32ToUInt8Scalar(src, dst, i, end);
+}
+
+LLGL_DEF_KERNEL_ENTRY( SwizzleRB8Kernel_SSSE3,              SwizzleRB8SSSE3,            std::uint8_t,   std::uint8_t    )
+LLGL_DEF_KERNEL_ENTRY( ExpandRGB8ToRGBA8Kernel_SSSE3,       ExpandRGB8ToRGBA8SSSE3,     std::uint8_t,   std::uint8_t    )
+LLGL_DEF_KERNEL_ENTRY( ConvertUInt8ToFloat32Kernel_SSE41,   ConvertUInt8ToFloat32SSE41, std::uint8_t,   float           )
+LLGL_DEF_KERNEL_ENTRY( ConvertFloat32ToUInt8Kernel_SSE41,   ConvertFloat32ToUInt8SSE41, float,          std::uint8_t    )
+LLGL_DEF_KERNEL_ENTRY( SwizzleRB8Kernel_AVX2,               SwizzleRB8AVX2,             std::uint8_t,   std::uint8_t    )
+LLGL_DEF_KERNEL_ENTRY( ConvertUInt8ToFloat32Kernel_AVX2,    ConvertUInt8ToFloat32AVX2,  std::uint8_t,   float           )
+LLGL_DEF_KERNEL_ENTRY( ConvertFloat32ToUInt8Kernel_AVX2,    ConvertFloat32ToUInt8AVX2,  float,          std::uint8_t    )
+
+#elif defined LLGL_SIMD_NEON
+
+/*
+ * NEON kernels
+ */
+
+static void SwizzleRB8NEON(const std::uint8_t* src, std::uint8_t* dst, std::size_t begin, std::size_t end)
+{
+    std::size_t i = begin;
+    for (; i + 16 <= end; i += 16)
+    {
+        uint8x16x4_t v = vld4q_u8(src + i*4);
+        const uint8x16_t r = v.val[0];
+        v.val[0] = v.val[2];
+        v.val[2] = r;
+        vst4q_u8(dst + i*4, v);
+    }
+    SwizzleRB8Scalar(src, dst, i, end);
+}
+
+static void ExpandRGB8ToRGBA8NEON(const std::uint8_t* src, std::uint8_t* dst, std::size_t begin, std::size_t end)
+{
+    std::size_t i = begin;
+    for (; i + 16 <= end; i += 16)
+    {
+        const uint8x16x3_t rgb = vld3q_u8(src + i*3);
+        uint8x16x4_t rgba;
+        rgba.val[0] = rgb.val[0];
+        rgba.val[1] = rgb.val[1];
+        rgba.val[2] = rgb.val[2];
+        rgba.val[3] = vdupq_n_u8(0xFF);
+        vst4q_u8(dst + i*4, rgba);
+    }
+    ExpandRGB8ToRGBA8Scalar(src, dst, i, end);
+}
+
+static void ConvertUInt8ToFloat32NEON(const std::uint8_t* src, float* dst, std::size_t begin, std::size_t end)
+{
+    const float32x4_t scale = vdupq_n_f32(255.0f);
+
+    std::size_t i = begin;
+    for (; i + 8 <= end; i += 8)
+    {
+        const uint16x8_t v = vmovl_u8(vld1_u8(src + i));
+        vst1q_f32(dst + i    , vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(v))), scale));
+        vst1q_f32(dst + i + 4, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(v))), scale));
+    }
+    ConvertUInt8ToFloat32Scalar(src, dst, i, end);
+}
+
+// Converts 2 floats to 2 saturated integers in the range [0, 255] using double precision for the scaling.
+static uint32x2_t ScaleFloat32ToUInt8x2NEON(float32x2_t v)
+{
+    const float64x2_t scale = vdupq_n_f64(255.0);
+    float64x2_t d = vmulq_f64(vcvt_f64_f32(v), scale);
+
+    /* FMAXNM returns the numeric operand if the other one is NaN */
+    d = vminq_f64(vmaxnmq_f64(d, vdupq_n_f64(0.0)), scale);
+    return vmovn_u64(vcvtq_u64_f64(d));
+}
+
+static void ConvertFloat32ToUInt8NEON(const float* src, std::uint8_t* dst, std::size_t begin, std::size_t end)
+{
+    std::size_t i = begin;
+    for (; i + 8 <= end; i += 8)
+    {
+        const float32x4_t v0 = vld1q_f32(src + i);
+        const float32x4_t v1 = vld1q_f32(src + i + 4);
+        const uint32x4_t u0 = vcombine_u32(ScaleFloat32ToUInt8x2NEON(vget_low_f32(v0)), ScaleFloat32ToUInt8x2NEON(vget_high_f32(v0)));
+        const uint32x4_t u1 = vcombine_u32(ScaleFloat32ToUInt8x2NEON(vget_low_f32(v1)), ScaleFloat32ToUInt8x2NEON(vget_high_f32(v1)));
+        vst1_u8(dst + i, vmovn_u16(vcombine_u16(vmovn_u32(u0), vmovn_u32(u1))));
+    }
+    ConvertFloat32ToUInt8Scalar(src, dst, i, end);
+}
+
+LLGL_DEF_KERNEL_ENTRY( SwizzleRB8Kernel_NEON,               SwizzleRB8NEON,                 std::uint8_t,   std::uint8_t    )
+LLGL_DEF_KERNEL_ENTRY( ExpandRGB8ToRGBA8Kernel_NEON,        ExpandRGB8ToRGBA8NEON,          std::uint8_t,   std::uint8_t    )
+LLGL_DEF_KERNEL_ENTRY( ConvertUInt8ToFloat32Kernel_NEON,    ConvertUInt8ToFloat32NEON,      std::uint8_t,   float           )
+LLGL_DEF_KERNEL_ENTRY( ConvertFloat32ToUInt8Kernel_NEON,    ConvertFloat32ToUInt8NEON,      float,          std::uint8_t    )
+
+#endif // /LLGL_SIMD_NEON
+
+#undef LLGL_DEF_KERNEL_ENTRY
+
+
+/*
+ * Kernel selection
+ */
+
+static ImageConversionKernel SelectSwizzleRB8Kernel()
+{
+    #if defined LLGL_SIMD_X86
+    const CPUFeatures& features = GetCPUFeatures();
+    if (features.avx2)
+        return SwizzleRB8Kernel_AVX2;
+    if (features.ssse3)
+        return SwizzleRB8Kernel_SSSE3;
+    #elif defined LLGL_SIMD_NEON
+    return SwizzleRB8Kernel_NEON;
+    #endif
+    return SwizzleRB8Kernel_Scalar;
+}
+
+static ImageConversionKernel SelectExpandRGB8ToRGBA8Kernel()
+{
+    #if defined LLGL_SIMD_X86
+    if (GetCPUFeatures().ssse3)
+        return ExpandRGB8ToRGBA8Kernel_SSSE3;
+    #elif defined LLGL_SIMD_NEON
+    return ExpandRGB8ToRGBA8Kernel_NEON;
+    #endif
+    return ExpandRGB8ToRGBA8Kernel_Scalar;
+}
+
+static ImageConversionKernel SelectUInt8ToFloat32Kernel()
+{
+    #if defined LLGL_SIMD_X86
+    const CPUFeatures& features = GetCPUFeatures();
+    if (features.avx2)
+        return ConvertUInt8ToFloat32Kernel_AVX2;
+    if (features.sse41)
+        return ConvertUInt8ToFloat32Kernel_SSE41;
+    #elif defined LLGL_SIMD_NEON
+    return ConvertUInt8ToFloat32Kernel_NEON;
+    #endif
+    return ConvertUInt8ToFloat32Kernel_Scalar;
+}
+
+static ImageConversionKernel SelectFloat32ToUInt8Kernel()
+{
+    #if defined LLGL_SIMD_X86
+    const CPUFeatures& features = GetCPUFeatures();
+    if (features.avx2)
+        return ConvertFloat32ToUInt8Kernel_AVX2;
+    if (features.sse41)
+        return ConvertFloat32ToUInt8Kernel_SSE41;
+    #elif defined LLGL_SIMD_NEON
+    return ConvertFloat32ToUInt8Kernel_NEON;
+    #endif
+    return ConvertFloat32ToUInt8Kernel_Scalar;
+}
+
+ImageConversionKernel FindImageFormatConversionKernel(ImageFormat srcFormat, DataType srcDataType, ImageFormat dstFormat, DataType dstDataType)
+{
+    if (srcDataType != DataType::UInt8 || dstDataType != DataType::UInt8)
+        return nullptr;
+
+    if ((srcFormat == ImageFormat::RGBA && dstFormat == ImageFormat::BGRA) ||
+        (srcFormat == ImageFormat::BGRA && dstFormat == ImageFormat::RGBA))
+    {
+        static const ImageConversionKernel kernel = SelectSwizzleRB8Kernel();
+        return kernel;
+    }
+
+    if ((srcFormat == ImageFormat::RGB && dstFormat == ImageFormat::RGBA) ||
+        (srcFormat == ImageFormat::BGR && dstFormat == ImageFormat::BGRA))
+    {
+        static const ImageConversionKernel kernel = SelectExpandRGB8ToRGBA8Kernel();
+        return kernel;
+    }
+
+    return nullptr;
+}
+
+ImageConversionKernel FindImageDataTypeConversionKernel(DataType srcDataType, DataType dstDataType)
+{
+    if (srcDataType == DataType::UInt8 && dstDataType == DataType::Float32)
+    {
+        static const ImageConversionKernel kernel = SelectUInt8ToFloat32Kernel();
+        return kernel;
+    }
+
+    if (srcDataType == DataType::Float32 && dstDataType == DataType::UInt8)
+    {
+        static const ImageConversionKernel kernel = SelectFloat32ToUInt8Kernel();
+        return kernel;
+    }
+
+    if (srcDataType == DataType::Float32 && dstDataType == DataType::Float16)
+        return ConvertFloat32ToFloat16Kernel;
+
+    if (srcDataType == DataType::Float16 && dstDataType == DataType::Float32)
+        return ConvertFloat16ToFloat32Kernel;
+
+    return nullptr;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,40 @@
+/*
+ * ImageConversionKernels.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_IMAGE_CONVERSION_KERNELS_H
+#define LLGL_IMAGE_CONVERSION_KERNELS_H
+
+
+#include <LLGL/Format.h>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+/*
+Kernel to convert the elements in the range [begin, end) from the source buffer into the destination buffer.
+For format conversions, elements are pixels; for data type conversions, elements are components.
+*/
+using ImageConversionKernel = void (*)(const void* src, void* dst, std::size_t begin, std::size_t end);
+
+// Returns the fastest kernel the host CPU supports to convert between the specified image formats of equal data type, or null if there is no fast path.
+ImageConversionKernel FindImageFormatConversionKernel(ImageFormat srcFormat, DataType srcDataType, ImageFormat dstFormat, DataType dstDataType);
+
+// Returns the fastest kernel the host CPU supports to convert between the specified data types, or null if there is no fast path.
+ImageConversionKernel FindImageDataTypeConversionKernel(DataType srcDataType, DataType dstDataType);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
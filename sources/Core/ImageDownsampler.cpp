@@ -0,0 +1,394 @@
+/*
+ * ImageDownsampler.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "ImageDownsampler.h"
+#include "CPUFeatures.h"
+#include "Threading.h"
+#include "Assertion.h"
+#include <LLGL/Utils/ForRange.h>
+#include <LLGL/Container/DynamicArray.h>
+#include <algorithm>
+#include <vector>
+#include <cmath>
+
+#if defined LLGL_SIMD_X86
+#   include <immintrin.h>
+#elif defined LLGL_SIMD_NEON
+#   include <arm_neon.h>
+#endif
+
+
+namespace LLGL
+{
+
+
+/*
+ * Internal structures
+ */
+
+// Range of source texels and their weights that contribute to a single destination texel along one dimension.
+struct FilterTaps
+{
+    std::uint32_t   first;
+    std::uint32_t   count;
+    std::size_t     weightOffset;
+};
+
+// Filter weights for all destination texels along one dimension.
+struct FilterKernel1D
+{
+    std::vector<FilterTaps> taps;
+    std::vector<float>      weights;
+};
+
+
+/*
+ * Internal functions
+ */
+
+static constexpr double g_kaiserRadius  = 3.0;
+static constexpr double g_kaiserAlpha   = 4.0;
+static constexpr double g_pi            = 3.14159265358979323846;
+
+// Zeroth order modified Bessel function of the first kind.
+static double BesselI0(double x)
+{
+    double sum = 1.0, term = 1.0;
+    const double halfX = x * 0.5;
+    for (int k = 1; k < 32 && term > sum * 1e-12; ++k)
+    {
+        const double t = halfX / static_cast<double>(k);
+        term *= t * t;
+        sum += term;
+    }
+    return sum;
+}
+
+// Returns the weight of the Kaiser windowed sinc filter at 'x' in destination texel units.
+static double KaiserWindowedSinc(double x)
+{
+    const double t = x / g_kaiserRadius;
+    if (t <= -1.0 || t >= 1.0)
+        return 0.0;
+
+    const double sinc   = (std::abs(x) < 1e-8 ? 1.0 : std::sin(g_pi * x) / (g_pi * x));
+    const double window = BesselI0(g_kaiserAlpha * std::sqrt(1.0 - t*t)) / BesselI0(g_kaiserAlpha);
+
+    return sinc * window;
+}
+
+static void AppendFilterTaps(FilterKernel1D& kernel, std::int64_t begin, std::int64_t end, std::uint32_t srcLength, const std::vector<double>& rawWeights)
+{
+    /* Clamp taps outside the source range to the edge texels */
+    const std::int64_t maxIndex = static_cast<std::int64_t>(srcLength) - 1;
+    const std::int64_t first    = std::max<std::int64_t>(0, std::min(begin, maxIndex));
+    const std::int64_t last     = std::max<std::int64_t>(0, std::min(end - 1, maxIndex));
+
+    FilterTaps taps;
+    taps.first          = static_cast<std::uint32_t>(first);
+    taps.count          = static_cast<std::uint32_t>(last - first + 1);
+    taps.weightOffset   = kernel.weights.size();
+
+    std::vector<double> weights(taps.count, 0.0);
+    double weightSum = 0.0;
+
+    for_range(i, rawWeights.size())
+    {
+        const std::int64_t index = std::max<std::int64_t>(first, std::min(begin + static_cast<std::int64_t>(i), last));
+        weights[static_cast<std::size_t>(index - first)] += rawWeights[i];
+        weightSum += rawWeights[i];
+    }
+
+    /* Normalize weights so the filter preserves the average intensity */
+    for (double w : weights)
+        kernel.weights.push_back(static_cast<float>(w / weightSum));
+
+    kernel.taps.push_back(taps);
+}
+
+static FilterKernel1D BuildFilterKernel(ImageFilter filter, std::uint32_t dstLength, std::uint32_t srcLength)
+{
+    FilterKernel1D kernel;
+    kernel.taps.reserve(dstLength);
+
+    const double scale = static_cast<double>(srcLength) / static_cast<double>(dstLength);
+    std::vector<double> rawWeights;
+
+    for_range(i, dstLength)
+    {
+        std::int64_t begin, end;
+        rawWeights.clear();
+
+        if (filter == ImageFilter::Kaiser)
+        {
+            /* Sample windowed sinc at the center of each source texel within the filter radius */
+            const double center = (static_cast<double>(i) + 0.5) * scale;
+            const double radius = g_kaiserRadius * scale;
+            begin   = static_cast<std::int64_t>(std::floor(center - radius));
+            end     = static_cast<std::int64_t>(std::ceil(center + radius));
+            for (std::int64_t j = begin; j < end; ++j)
+                rawWeights.push_back(KaiserWindowedSinc((static_cast<double>(j) + 0.5 - center) / scale));
+        }
+        else
+        {
+            /* Weight each source texel by its coverage of the destination texel footprint */
+            const double a = static_cast<double>(i) * scale;
+            const double b = static_cast<double>(i + 1) * scale;
+            begin   = static_cast<std::int64_t>(std::floor(a));
+            end     = std::min(static_cast<std::int64_t>(std::ceil(b)), static_cast<std::int64_t>(srcLength));
+            for (std::int64_t j = begin; j < end; ++j)
+                rawWeights.push_back(std::min(b, static_cast<double>(j + 1)) - std::max(a, static_cast<double>(j)));
+        }
+
+        AppendFilterTaps(kernel, begin, end, srcLength, rawWeights);
+    }
+
+    return kernel;
+}
+
+using RowKernelFunc = void (*)(float* dst, const float* src, float weight, std::size_t length);
+
+// Kernels for the inner loops of FilterLines, selected once for the host CPU.
+struct RowKernels
+{
+    RowKernelFunc scale;
+    RowKernelFunc accumulate;
+};
+
+// dst[i] = src[i] * weight
+static void ScaleRowDefault(float* dst, const float* src, float weight, std::size_t length)
+{
+    std::size_t i = 0;
+
+    #if defined LLGL_SIMD_NEON
+    const float32x4_t w = vdupq_n_f32(weight);
+    for (; i + 4 <= length; i += 4)
+        vst1q_f32(dst + i, vmulq_f32(vld1q_f32(src + i), w));
+    #endif
+
+    for (; i < length; ++i)
+        dst[i] = src[i] * weight;
+}
+
+// dst[i] += src[i] * weight
+static void AccumulateRowDefault(float* dst, const float* src, float weight, std::size_t length)
+{
+    std::size_t i = 0;
+
+    #if defined LLGL_SIMD_NEON
+    const float32x4_t w = vdupq_n_f32(weight);
+    for (; i + 4 <= length; i += 4)
+        vst1q_f32(dst + i, vmlaq_f32(vld1q_f32(dst + i), vld1q_f32(src + i), w));
+    #endif
+
+    for (; i < length; ++i)
+        dst[i] += src[i] * weight;
+}
+
+#if defined LLGL_SIMD_X86
+
+LLGL_TARGET_SIMD("sse2")
+static void ScaleRowSSE2(float* dst, const float* src, float weight, std::size_t length)
+{
+    std::size_t i = 0;
+
+    const __m128 w = _mm_set1_ps(weight);
+    for (; i + 4 <= length; i += 4)
+        _mm_storeu_ps(dst + i, _mm_mul_ps(_mm_loadu_ps(src + i), w));
+
+    for (; i < length; ++i)
+        dst[i] = src[i] * weight;
+}
+
+LLGL_TARGET_SIMD("sse2")
+static void AccumulateRowSSE2(float* dst, const float* src, float weight, std::size_t length)
+{
+    std::size_t i = 0;
+
+    const __m128 w = _mm_set1_ps(weight);
+    for (; i + 4 <= length; i += 4)
+        _mm_storeu_ps(dst + i, _mm_add_ps(_mm_loadu_ps(dst + i), _mm_mul_ps(_mm_loadu_ps(src + i), w)));
+
+    for (; i < length; ++i)
+        dst[i] += src[i] * weight;
+}
+
+#endif // /LLGL_SIMD_X86
+
+// NEON is part of the AArch64 baseline, so the default kernels already use it.
+static RowKernels SelectRowKernels()
+{
+    #if defined LLGL_SIMD_X86
+    if (GetCPUFeatures().sse2)
+        return RowKernels{ ScaleRowSSE2, AccumulateRowSSE2 };
+    #endif
+    return RowKernels{ ScaleRowDefault, AccumulateRowDefault };
+}
+
+// Filters each row of texels along the first dimension.
+static void FilterRows(
+    const FilterKernel1D&   kernel,
+    float*                  dst,
+    std::uint32_t           dstWidth,
+    const float*            src,
+    std::uint32_t           srcWidth,
+    std::uint32_t           numRows,
+    std::uint32_t           numComponents,
+    unsigned                threadCount)
+{
+    DoConcurrentRange(
+        [&](std::size_t rowBegin, std::size_t rowEnd)
+        {
+            for_subrange(row, rowBegin, rowEnd)
+            {
+                const float*    srcRow = src + row * srcWidth * numComponents;
+                float*          dstRow = dst + row * dstWidth * numComponents;
+
+                for_range(x, dstWidth)
+                {
+                    const FilterTaps&   taps    = kernel.taps[x];
+                    const float*        weights = &(kernel.weights[taps.weightOffset]);
+
+                    float accum[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+                    for_range(k, taps.count)
+                    {
+                        const float* texel = srcRow + (taps.first + k) * numComponents;
+                        for_range(c, numComponents)
+                            accum[c] += texel[c] * weights[k];
+                    }
+
+                    for_range(c, numComponents)
+                        dstRow[x * numComponents + c] = accum[c];
+                }
+            }
+        },
+        numRows,
+        threadCount
+    );
+}
+
+// Filters entire lines of components along an outer dimension, i.e. rows along the height and slices along the depth.
+static void FilterLines(
+    const FilterKernel1D&   kernel,
+    float*                  dst,
+    std::uint32_t           dstNumLines,
+    const float*            src,
+    std::uint32_t           srcNumLines,
+    std::size_t             lineLength,
+    std::uint32_t           numOuterBlocks,
+    unsigned                threadCount)
+{
+    static const RowKernels kernels = SelectRowKernels();
+
+    DoConcurrentRange(
+        [&](std::size_t begin, std::size_t end)
+        {
+            for_subrange(i, begin, end)
+            {
+                const std::size_t   outer   = i / dstNumLines;
+                const std::size_t   line    = i % dstNumLines;
+                const float*        srcBase = src + outer * srcNumLines * lineLength;
+                float*              dstLine = dst + (outer * dstNumLines + line) * lineLength;
+
+                const FilterTaps&   taps    = kernel.taps[line];
+                const float*        weights = &(kernel.weights[taps.weightOffset]);
+
+                kernels.scale(dstLine, srcBase + taps.first * lineLength, weights[0], lineLength);
+                for_subrange(k, 1u, taps.count)
+                    kernels.accumulate(dstLine, srcBase + (taps.first + k) * lineLength, weights[k], lineLength);
+            }
+        },
+        static_cast<std::size_t>(numOuterBlocks) * dstNumLines,
+        threadCount,
+        std::max(1u, static_cast<unsigned>(4096 / std::max<std::size_t>(1, lineLength)))
+    );
+}
+
+
+/*
+ * Global functions
+ */
+
+LLGL_EXPORT void DownsampleImageFloat32(
+    ImageFilter     filter,
+    float*          dst,
+    const Extent3D& dstExtent,
+    const float*    src,
+    const Extent3D& srcExtent,
+    std::uint32_t   numComponents,
+    unsigned        threadCount)
+{
+    LLGL_ASSERT(numComponents >= 1 && numComponents <= 4);
+
+    /* Filter one dimension at a time and only allocate intermediate images for dimensions that are actually reduced */
+    const float*        curSrc      = src;
+    Extent3D            curExtent   = srcExtent;
+    DynamicArray<float> intermediates[2];
+    int                 nextIntermediate = 0;
+
+    const bool filterWidth  = (dstExtent.width  != srcExtent.width );
+    const bool filterHeight = (dstExtent.height != srcExtent.height);
+    const bool filterDepth  = (dstExtent.depth  != srcExtent.depth );
+    const int  numPasses    = (filterWidth ? 1 : 0) + (filterHeight ? 1 : 0) + (filterDepth ? 1 : 0);
+    int        passIndex    = 0;
+
+    auto GetPassOutput = [&](const Extent3D& extent) -> float*
+    {
+        if (++passIndex == numPasses)
+            return dst;
+        DynamicArray<float>& buffer = intermediates[nextIntermediate];
+        nextIntermediate ^= 1;
+        buffer = DynamicArray<float>{ static_cast<std::size_t>(extent.width) * extent.height * extent.depth * numComponents, UninitializeTag{} };
+        return buffer.data();
+    };
+
+    if (numPasses == 0)
+    {
+        std::copy(src, src + static_cast<std::size_t>(srcExtent.width) * srcExtent.height * srcExtent.depth * numComponents, dst);
+        return;
+    }
+
+    if (filterWidth)
+    {
+        const Extent3D nextExtent{ dstExtent.width, curExtent.height, curExtent.depth };
+        float* output = GetPassOutput(nextExtent);
+        FilterRows(
+            BuildFilterKernel(filter, dstExtent.width, curExtent.width),
+            output, dstExtent.width, curSrc, curExtent.width, curExtent.height * curExtent.depth, numComponents, threadCount
+        );
+        curSrc      = output;
+        curExtent   = nextExtent;
+    }
+
+    if (filterHeight)
+    {
+        const Extent3D nextExtent{ curExtent.width, dstExtent.height, curExtent.depth };
+        float* output = GetPassOutput(nextExtent);
+        FilterLines(
+            BuildFilterKernel(filter, dstExtent.height, curExtent.height),
+            output, dstExtent.height, curSrc, curExtent.height, static_cast<std::size_t>(curExtent.width) * numComponents, curExtent.depth, threadCount
+        );
+        curSrc      = output;
+        curExtent   = nextExtent;
+    }
+
+    if (filterDepth)
+    {
+        float* output = GetPassOutput(dstExtent);
+        FilterLines(
+            BuildFilterKernel(filter, dstExtent.depth, curExtent.depth),
+            output, dstExtent.depth, curSrc, curExtent.depth, static_cast<std::size_t>(curExtent.width) * curExtent.height * numComponents, 1, threadCount
+        );
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
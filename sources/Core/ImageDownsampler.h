@@ -0,0 +1,47 @@
+/*
+ * ImageDownsampler.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_IMAGE_DOWNSAMPLER_H
+#define LLGL_IMAGE_DOWNSAMPLER_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/Types.h>
+#include <LLGL/Utils/Image.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/* ----- Functions ----- */
+
+/*
+Downsamples the source image with tightly packed 32-bit floating-point components into the destination image with a separable filter.
+Each dimension of the destination extent must be less than or equal to the respective dimension of the source extent.
+Texels outside the source image are clamped to the edge.
+*/
+LLGL_EXPORT void DownsampleImageFloat32(
+    ImageFilter     filter,
+    float*          dst,
+    const Extent3D& dstExtent,
+    const float*    src,
+    const Extent3D& srcExtent,
+    std::uint32_t   numComponents,
+    unsigned        threadCount = 0
+);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
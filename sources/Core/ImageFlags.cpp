@@ -18,6 +18,8 @@
 #include "../Core/Threading.h"
 #include "Float16Compressor.h"
 #include "BCDecompressor.h"
+#include "BCCompressor.h"
+#include "ImageConversionKernels.h"
 #include <LLGL/Utils/ForRange.h>
 
 
@@ -212,6 +214,20 @@ static void ConvertImageBufferDataType(
     if (dstBufferSize != requiredDstBufferSize)
         LLGL_TRAP("cannot convert image data type with destination buffer size mismatch");
 
+    /* Use SIMD kernel if there is a fast path for this data type conversion */
+    if (ImageConversionKernel kernel = FindImageDataTypeConversionKernel(srcDataType, dstDataType))
+    {
+        DoConcurrentRange(
+            [kernel, srcBuffer, dstBuffer](std::size_t begin, std::size_t end)
+            {
+                kernel(srcBuffer, dstBuffer, begin, end);
+            },
+            imageSize,
+            threadCount
+        );
+        return;
+    }
+
     /* Get variant buffer for source and destination images */
     DoConcurrentRange(
         std::bind(
@@ -534,6 +550,22 @@ static void ConvertImageBufferFormat(
     if (dstImageView.dataSize != requiredDstBufferSize)
         LLGL_TRAP("cannot convert image format with destination buffer size mismatch");
 
+    /* Use SIMD kernel if there is a fast path for this format conversion */
+    if (ImageConversionKernel kernel = FindImageFormatConversionKernel(srcImageView.format, srcImageView.dataType, dstImageView.format, dstImageView.dataType))
+    {
+        const void* srcBuffer = srcImageView.data;
+        void*       dstBuffer = dstImageView.data;
+        DoConcurrentRange(
+            [kernel, srcBuffer, dstBuffer](std::size_t begin, std::size_t end)
+            {
+                kernel(srcBuffer, dstBuffer, begin, end);
+            },
+            imageSize,
+            threadCount
+        );
+        return;
+    }
+
     /* Get variant buffer for source and destination images */
     DoConcurrentRange(
         std::bind(
@@ -732,6 +764,50 @@ LLGL_EXPORT DynamicByteArray ConvertImageBuffer(
     return dstImage;
 }
 
+LLGL_EXPORT std::uint32_t ConvertImageBufferBands(
+    const ImageView&            srcImageView,
+    const MutableImageView&     stagingImageView,
+    std::uint32_t               rowLength,
+    std::uint32_t               numRows,
+    const ImageBandCallback&    bandCallback,
+    unsigned                    threadCount)
+{
+    LLGL_ASSERT_PTR(srcImageView.data);
+    LLGL_ASSERT_PTR(stagingImageView.data);
+
+    if (rowLength == 0 || numRows == 0)
+        return 0;
+
+    /* Determine number of rows that fit into the staging buffer */
+    const std::size_t srcRowSize = GetMemoryFootprint(srcImageView.format, srcImageView.dataType, rowLength);
+    const std::size_t dstRowSize = GetMemoryFootprint(stagingImageView.format, stagingImageView.dataType, rowLength);
+
+    LLGL_ASSERT(srcRowSize > 0 && dstRowSize > 0, "image format and data type of band conversion must not be compressed");
+    LLGL_ASSERT(srcImageView.dataSize >= srcRowSize * numRows, "source image data size is too small for the specified number of rows");
+    LLGL_ASSERT(stagingImageView.dataSize >= dstRowSize, "staging image data size is too small for a single row");
+
+    const std::uint32_t rowsPerBand = static_cast<std::uint32_t>(std::min<std::size_t>(stagingImageView.dataSize / dstRowSize, numRows));
+
+    /* Convert each band into the staging buffer and pass it to the callback before the next band overwrites it */
+    const char*     src         = static_cast<const char*>(srcImageView.data);
+    std::uint32_t   numBands    = 0;
+
+    for (std::uint32_t firstRow = 0; firstRow < numRows; firstRow += rowsPerBand, ++numBands)
+    {
+        const std::uint32_t     bandNumRows = std::min(rowsPerBand, numRows - firstRow);
+        const ImageView         srcBandView{ srcImageView.format, srcImageView.dataType, src + srcRowSize * firstRow, srcRowSize * bandNumRows };
+        const MutableImageView  dstBandView{ stagingImageView.format, stagingImageView.dataType, stagingImageView.data, dstRowSize * bandNumRows };
+
+        if (!ConvertImageBuffer(srcBandView, dstBandView, threadCount))
+            ::memcpy(dstBandView.data, srcBandView.data, dstBandView.dataSize);
+
+        if (bandCallback)
+            bandCallback(dstBandView, firstRow, bandNumRows);
+    }
+
+    return numBands;
+}
+
 LLGL_EXPORT DynamicByteArray DecompressImageBufferToRGBA8UNorm(
     const ImageView&    srcImageView,
     const Extent2D&     extent,
@@ -741,12 +817,40 @@ LLGL_EXPORT DynamicByteArray DecompressImageBufferToRGBA8UNorm(
         threadCount = std::thread::hardware_concurrency();
 
     /* Check for BC compression */
-    if (srcImageView.format == ImageFormat::BC1)
-        return DecompressBC1ToRGBA8UNorm(extent, reinterpret_cast<const char*>(srcImageView.data), srcImageView.dataSize, threadCount);
+    if (srcImageView.format >= ImageFormat::BC1 && srcImageView.format <= ImageFormat::BC5)
+    {
+        const bool isSigned = (srcImageView.dataType == DataType::Int8);
+        return DecompressBCToRGBA8UNorm(srcImageView.format, isSigned, extent, reinterpret_cast<const char*>(srcImageView.data), srcImageView.dataSize, threadCount);
+    }
 
     return nullptr;
 }
 
+LLGL_EXPORT DynamicByteArray CompressImageBuffer(
+    const ImageView&        srcImageView,
+    ImageFormat             dstFormat,
+    const Extent3D&         extent,
+    ImageCompressionQuality quality,
+    unsigned                threadCount)
+{
+    if (threadCount == LLGL_MAX_THREAD_COUNT)
+        threadCount = std::thread::hardware_concurrency();
+
+    if (IsCompressedFormat(srcImageView.format) || IsDepthOrStencilFormat(srcImageView.format) || srcImageView.data == nullptr)
+        return nullptr;
+
+    /* Convert source image to RGBA8UNorm if necessary */
+    const std::size_t numTexels = static_cast<std::size_t>(extent.width) * extent.height * extent.depth;
+    if (srcImageView.dataSize < GetMemoryFootprint(srcImageView.format, srcImageView.dataType, numTexels))
+        return nullptr;
+
+    const ImageView srcImageViewClamped{ srcImageView.format, srcImageView.dataType, srcImageView.data, GetMemoryFootprint(srcImageView.format, srcImageView.dataType, numTexels) };
+    DynamicByteArray intermediateData = ConvertImageBuffer(srcImageViewClamped, ImageFormat::RGBA, DataType::UInt8, threadCount);
+    const char* data = (intermediateData ? intermediateData.get() : reinterpret_cast<const char*>(srcImageView.data));
+
+    return CompressRGBA8UNormToBC(dstFormat, extent, data, numTexels * 4, quality, threadCount);
+}
+
 // Returns the 1D flattened buffer position for a 3D image coordinate ('bpp' denotes the bytes per pixel)
 static std::size_t GetFlattenedImageBufferPos(
     std::uint32_t x,
@@ -786,7 +890,8 @@ LLGL_EXPORT void CopyImageBufferRegion(
     const Offset3D&         srcOffset,
     std::uint32_t           srcRowStride,
     std::uint32_t           srcLayerStride,
-    const Extent3D&         extent)
+    const Extent3D&         extent,
+    unsigned                threadCount)
 {
     /* Validate input parameters */
     ValidateSourceImageView(srcImageView);
@@ -820,7 +925,8 @@ LLGL_EXPORT void CopyImageBufferRegion(
         dstLayerStride * bpp,
         (reinterpret_cast<const char*>(srcImageView.data) + srcPos),
         srcRowStride * bpp,
-        srcLayerStride * bpp
+        srcLayerStride * bpp,
+        threadCount
     );
 }
 
@@ -6,17 +6,111 @@
  */
 
 #include "ImageUtils.h"
+#include "CPUFeatures.h"
+#include "Threading.h"
 #include <LLGL/Types.h>
 #include <LLGL/Utils/ForRange.h>
 #include <cstdint>
 #include <algorithm>
+#include <limits>
 #include <string.h>
 
+#if defined LLGL_SIMD_X86
+#   include <immintrin.h>
+#endif
+
 
 namespace LLGL
 {
 
 
+/*
+Minimum number of bytes each worker thread copies in BitBlit.
+Smaller regions are copied single-threaded, since they are not worth the overhead of the thread pool.
+*/
+static constexpr std::size_t g_blitMinWorkSize = 256 * 1024;
+
+/*
+Copies smaller than this are done with memcpy, since streaming stores only pay off
+when entire write-combining buffers are filled and they evict the destination from the cache.
+*/
+static constexpr std::size_t g_nonTemporalMinSize = 4096;
+
+using MemoryCopyFunc = void (*)(void* dst, const void* src, std::size_t size);
+
+static void CopyMemoryDefault(void* dst, const void* src, std::size_t size)
+{
+    ::memcpy(dst, src, size);
+}
+
+#if defined LLGL_SIMD_X86
+
+LLGL_TARGET_SIMD("sse2")
+static void CopyMemoryNonTemporalSSE2(void* dst, const void* src, std::size_t size)
+{
+    char*       dstBytes = static_cast<char*>(dst);
+    const char* srcBytes = static_cast<const char*>(src);
+
+    /* Copy unaligned head with regular stores, since streaming stores require a 16-byte aligned destination */
+    const std::size_t headSize = std::min(size, (16u - (reinterpret_cast<std::uintptr_t>(dstBytes) & 15u)) & 15u);
+    ::memcpy(dstBytes, srcBytes, headSize);
+    dstBytes += headSize;
+    srcBytes += headSize;
+    size     -= headSize;
+
+    /* Stream an entire cache line per iteration to fill write-combining buffers */
+    for (; size >= 64; dstBytes += 64, srcBytes += 64, size -= 64)
+    {
+        const __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(srcBytes) + 0);
+        const __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(srcBytes) + 1);
+        const __m128i v2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(srcBytes) + 2);
+        const __m128i v3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(srcBytes) + 3);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dstBytes) + 0, v0);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dstBytes) + 1, v1);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dstBytes) + 2, v2);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dstBytes) + 3, v3);
+    }
+
+    for (; size >= 16; dstBytes += 16, srcBytes += 16, size -= 16)
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dstBytes), _mm_loadu_si128(reinterpret_cast<const __m128i*>(srcBytes)));
+
+    /* Make streaming stores globally visible before the memory is unmapped or handed to the GPU */
+    _mm_sfence();
+
+    /* Copy remaining tail with regular stores */
+    ::memcpy(dstBytes, srcBytes, size);
+}
+
+#endif // /LLGL_SIMD_X86
+
+// NEON has no streaming store intrinsics and memcpy on AArch64 already uses non-temporal pairs (STNP) for large copies.
+static MemoryCopyFunc SelectNonTemporalCopyKernel()
+{
+    #if defined LLGL_SIMD_X86
+    if (GetCPUFeatures().sse2)
+        return CopyMemoryNonTemporalSSE2;
+    #endif
+    return CopyMemoryDefault;
+}
+
+LLGL_EXPORT void CopyMemoryNonTemporal(void* dst, const void* src, std::size_t size)
+{
+    if (size < g_nonTemporalMinSize)
+        ::memcpy(dst, src, size);
+    else
+    {
+        static const MemoryCopyFunc kernel = SelectNonTemporalCopyKernel();
+        kernel(dst, src, size);
+    }
+}
+
+// Returns the minimum number of work items per thread for DoConcurrentRange when each item copies 'itemSize' bytes.
+static unsigned GetBlitMinWorkItems(std::size_t itemSize)
+{
+    const std::size_t minWorkItems = g_blitMinWorkSize / std::max<std::size_t>(1u, itemSize);
+    return static_cast<unsigned>(std::max<std::size_t>(1u, std::min<std::size_t>(minWorkItems, std::numeric_limits<unsigned>::max())));
+}
+
 LLGL_EXPORT void BitBlit(
     const Extent3D& extent,
     std::uint32_t   bpp,
@@ -25,64 +119,71 @@ LLGL_EXPORT void BitBlit(
     std::uint32_t   dstLayerStride,
     const char*     src,
     std::uint32_t   srcRowStride,
-    std::uint32_t   srcLayerStride)
+    std::uint32_t   srcLayerStride,
+    unsigned        threadCount,
+    bool            nonTemporal)
 {
-    const std::uint32_t rowLength   = bpp * extent.width;
-    const std::uint32_t layerLength = rowLength * extent.height;
+    const std::size_t rowLength     = static_cast<std::size_t>(bpp) * extent.width;
+    const std::size_t layerLength   = rowLength * extent.height;
 
     /* Clamp strides to tightly packed lengths */
-    dstRowStride = std::max(dstRowStride, rowLength);
-    srcRowStride = std::max(srcRowStride, rowLength);
+    std::size_t dstRowStep      = std::max<std::size_t>(dstRowStride, rowLength);
+    std::size_t srcRowStep      = std::max<std::size_t>(srcRowStride, rowLength);
+    std::size_t dstLayerStep    = std::max<std::size_t>(dstLayerStride, layerLength);
+    std::size_t srcLayerStep    = std::max<std::size_t>(srcLayerStride, layerLength);
+
+    const MemoryCopyFunc copyFunc = (nonTemporal ? CopyMemoryNonTemporal : CopyMemoryDefault);
 
-    dstLayerStride = std::max(dstLayerStride, layerLength);
-    srcLayerStride = std::max(srcLayerStride, layerLength);
+    /* Strides of a single row or slice are irrelevant, so they can be treated as tightly packed */
+    if (extent.height == 1)
+        dstRowStep = srcRowStep = rowLength;
+    if (extent.depth == 1)
+        dstLayerStep = srcLayerStep = layerLength;
 
-    if (srcRowStride == dstRowStride && rowLength == dstRowStride)
+    /* Coalesce rows into a single block per slice if both images have tightly packed rows */
+    std::size_t blockLength     = rowLength;
+    std::size_t blocksPerLayer  = extent.height;
+
+    if (srcRowStep == rowLength && dstRowStep == rowLength)
     {
-        if (srcLayerStride == dstLayerStride && layerLength == dstLayerStride)
-        {
-            /* Copy region directly into output data */
-            ::memcpy(dst, src, layerLength * extent.depth);
-        }
-        else
-        {
-            /* Copy region directly into output data */
-            for_range(z, extent.depth)
-            {
-                /* Copy current slice */
-                ::memcpy(dst, src, layerLength);
+        blockLength     = layerLength;
+        blocksPerLayer  = 1;
 
-                /* Move pointers to next slice */
-                dst += dstLayerStride;
-                src += srcLayerStride;
-            }
+        if (srcLayerStep == layerLength && dstLayerStep == layerLength)
+        {
+            /* Copy entire region as one contiguous block and split it into equal parts across worker threads */
+            DoConcurrentRange(
+                [copyFunc, dst, src](std::size_t begin, std::size_t end)
+                {
+                    copyFunc(dst + begin, src + begin, end - begin);
+                },
+                layerLength * extent.depth,
+                threadCount,
+                static_cast<unsigned>(g_blitMinWorkSize)
+            );
+            return;
         }
     }
-    else
-    {
-        /* Adjust depth strides */
-        dstLayerStride -= dstRowStride * extent.height;
-        srcLayerStride -= srcRowStride * extent.height;
 
-        /* Copy region directly into output data */
-        for_range(z, extent.depth)
+    /* Copy each block, i.e. either a row or a slice, and distribute blocks across worker threads for large regions */
+    DoConcurrentRange(
+        [copyFunc, dst, src, dstRowStep, srcRowStep, dstLayerStep, srcLayerStep, blockLength, blocksPerLayer](std::size_t begin, std::size_t end)
         {
-            /* Copy current slice */
-            for_range(y, extent.height)
+            for_subrange(i, begin, end)
             {
-                /* Copy current row */
-                ::memcpy(dst, src, rowLength);
-
-                /* Move pointers to next row */
-                dst += dstRowStride;
-                src += srcRowStride;
+                const std::size_t z = i / blocksPerLayer;
+                const std::size_t y = i % blocksPerLayer;
+                copyFunc(
+                    dst + z * dstLayerStep + y * dstRowStep,
+                    src + z * srcLayerStep + y * srcRowStep,
+                    blockLength
+                );
             }
-
-            /* Move pointers to next slice */
-            dst += dstLayerStride;
-            src += srcLayerStride;
-        }
-    }
+        },
+        blocksPerLayer * extent.depth,
+        threadCount,
+        GetBlitMinWorkItems(blockLength)
+    );
 }
 
 
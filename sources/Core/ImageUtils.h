@@ -11,6 +11,7 @@
 
 #include <LLGL/Export.h>
 #include <cstdint>
+#include <cstddef>
 
 
 namespace LLGL
@@ -21,7 +22,19 @@ struct Extent3D;
 
 /* ----- Functions ----- */
 
-// Copies the specified extent from the source image to the destination image buffer.
+/*
+Copies the specified number of bytes with non-temporal stores that bypass the CPU cache.
+This is faster than memcpy for large copies into write-combined memory, such as mapped staging buffers, which the CPU does not read back.
+Falls back to memcpy for small copies and when no streaming stores are available.
+*/
+LLGL_EXPORT void CopyMemoryNonTemporal(void* dst, const void* src, std::size_t size);
+
+/*
+Copies the specified extent from the source image to the destination image buffer.
+Rows and slices are coalesced into larger copies if the strides match the tightly packed lengths
+and large regions are copied concurrently with up to 'threadCount' threads (see DoConcurrentRange).
+If 'nonTemporal' is true, the destination is written with CopyMemoryNonTemporal.
+*/
 LLGL_EXPORT void BitBlit(
     const Extent3D& extent,
     std::uint32_t   bpp,
@@ -30,7 +43,9 @@ LLGL_EXPORT void BitBlit(
     std::uint32_t   dstLayerStride,
     const char*     src,
     std::uint32_t   srcRowStride,
-    std::uint32_t   srcLayerStride
+    std::uint32_t   srcLayerStride,
+    unsigned        threadCount = 0,
+    bool            nonTemporal = false
 );
 
 
@@ -7,6 +7,7 @@
 
 #include <LLGL/Interface.h>
 #include <LLGL/RenderSystem.h>
+#include <LLGL/Resource.h>
 #include <LLGL/Window.h>
 #include <LLGL/Canvas.h>
 #include <LLGL/Utils/Input.h>
@@ -27,6 +28,16 @@ void RenderSystemChild::SetDebugName(const char* /*name*/)
     // dummy
 }
 
+void Resource::SetResidencyPriority(ResidencyPriority /*priority*/)
+{
+    // dummy
+}
+
+bool Resource::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
+{
+    return (nativeHandle == nullptr || nativeHandleSize == 0); // dummy
+}
+
 // Implement bases functions of all sub classes of <Interface> here:
 
 LLGL_IMPLEMENT_INTERFACE( RenderSystem,             Interface         )
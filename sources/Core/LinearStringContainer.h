@@ -10,9 +10,11 @@
 
 
 #include "StringUtils.h"
+#include <LLGL/Container/Allocator.h>
 #include <vector>
 #include <string>
 #include <string.h>
+#include <memory>
 
 
 namespace LLGL
@@ -24,8 +26,9 @@ Helper class to manage linear memory of multiple null-terminated strings.
 1. Reserve all required memory for all strings
 2. Copy strings into linear memory
 Example: Buffer = "FirstString\0SecondString\0etc.\0"
+The allocator can be substituted with ArenaAllocator for temporary containers that live within a ScopedMemoryArena.
 */
-template <typename T>
+template <typename T, typename Allocator = HeapAllocator<T>>
 class LinearStringContainerBase
 {
 
@@ -84,7 +87,7 @@ class LinearStringContainerBase
     private:
 
         // Primary implementation of the "CopyString" functions.
-        char* CopyStringPrimary(const T* str, std::size_t len)
+        T* CopyStringPrimary(const T* str, std::size_t len)
         {
             const auto grow = len + 1;
 
@@ -115,9 +118,9 @@ class LinearStringContainerBase
 
     private:
 
-        std::vector<T>  data_;
-        std::size_t     reserved_   = 0;
-        std::size_t     offset_     = 0;
+        std::vector<T, Allocator>   data_;
+        std::size_t                 reserved_   = 0;
+        std::size_t                 offset_     = 0;
 
 };
 
@@ -12,6 +12,9 @@
 #include <mutex>
 #include <atomic>
 #include <string>
+#include <thread>
+#include <condition_variable>
+#include <chrono>
 #include <stdio.h>
 #include <stdarg.h>
 
@@ -80,8 +83,140 @@ class TrivialLock
 
 };
 
+/*
+Bounded lock-free multi-producer/single-consumer ring buffer of preformatted log records.
+Each slot carries a sequence number that tells producers and the consumer whether the slot is free or filled.
+*/
+class LogRingBuffer
+{
+
+    public:
+
+        explicit LogRingBuffer(std::size_t capacity) :
+            records_ { new Record[capacity] },
+            mask_    { capacity - 1         }
+        {
+            for (std::size_t i = 0; i < capacity; ++i)
+                records_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        // Pushes the specified text into the queue and returns false if the queue is full. The text is only moved on success.
+        bool Push(ReportType type, std::string& text)
+        {
+            Record* record = nullptr;
+            std::size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                record = &records_[pos & mask_];
+                const std::size_t seq = record->sequence.load(std::memory_order_acquire);
+                const std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+                if (diff == 0)
+                {
+                    if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        break;
+                }
+                else if (diff < 0)
+                    return false;
+                else
+                    pos = enqueuePos_.load(std::memory_order_relaxed);
+            }
+
+            record->type = type;
+            record->text.swap(text);
+            record->sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Pops the next record from the queue. Must only be called by the consumer thread.
+        bool Pop(ReportType& outType, std::string& outText)
+        {
+            Record& record = records_[dequeuePos_ & mask_];
+            const std::size_t seq = record.sequence.load(std::memory_order_acquire);
+            if (seq != dequeuePos_ + 1)
+                return false;
+
+            outType = record.type;
+            outText.swap(record.text);
+            record.text.clear();
+            record.sequence.store(dequeuePos_ + mask_ + 1, std::memory_order_release);
+            ++dequeuePos_;
+            return true;
+        }
+
+        // Returns the number of records that have been pushed so far.
+        std::size_t GetEnqueuePos() const
+        {
+            return enqueuePos_.load(std::memory_order_acquire);
+        }
+
+        // Returns the number of records that have been popped so far. Must only be called by the consumer thread.
+        std::size_t GetDequeuePos() const
+        {
+            return dequeuePos_;
+        }
+
+    private:
+
+        struct Record
+        {
+            std::atomic<std::size_t>    sequence;
+            ReportType                  type        = ReportType::Default;
+            std::string                 text;
+        };
+
+    private:
+
+        std::unique_ptr<Record[]>   records_;
+        std::size_t                 mask_       = 0;
+        std::atomic<std::size_t>    enqueuePos_ { 0 };
+        std::size_t                 dequeuePos_ = 0;
+
+};
+
+// Background thread that drains the log ring buffer and dispatches the records to the log listeners.
+struct LogAsyncWorker
+{
+    static constexpr std::size_t ringBufferCapacity = 4096;
+
+    LogAsyncWorker() :
+        queue { ringBufferCapacity }
+    {
+    }
+
+    ~LogAsyncWorker()
+    {
+        Stop();
+    }
+
+    void Start();
+    void Stop();
+    void Run();
+    void Drain();
+
+    LogRingBuffer               queue;
+    std::thread                 thread;
+    std::atomic<bool>           isRunning       { false };
+    std::atomic<std::size_t>    dispatchedPos   { 0 };
+    std::atomic<std::uint32_t>  numDropped      { 0 };
+    std::mutex                  wakeMutex;
+    std::condition_variable     wakeSignal;
+};
+
+// Per report type rate limit within one-second intervals.
+struct LogRateLimit
+{
+    std::atomic<std::uint32_t>  maxMessagesPerSecond    { 0 };
+    std::atomic<std::int64_t>   intervalStart           { 0 };
+    std::atomic<std::uint32_t>  numMessages             { 0 };
+    std::atomic<std::uint32_t>  numSuppressed           { 0 };
+};
+
 static LogState                 g_logState;
 static thread_local TrivialLock g_logRecursionLock;
+static std::atomic<LogMode>     g_logMode           { LogMode::Synchronous };
+static std::mutex               g_logModeLock;
+static LogAsyncWorker           g_logAsyncWorker;
+static LogRateLimit             g_logRateLimits[2];
 
 
 /* ----- Functions ----- */
@@ -97,14 +232,119 @@ static void PostReport(ReportType type, const char* text)
         listener->Invoke(type, text);
 }
 
+void LogAsyncWorker::Start()
+{
+    if (!isRunning.exchange(true))
+        thread = std::thread{ &LogAsyncWorker::Run, this };
+}
+
+void LogAsyncWorker::Stop()
+{
+    if (isRunning.exchange(false))
+    {
+        wakeSignal.notify_one();
+        thread.join();
+    }
+}
+
+void LogAsyncWorker::Run()
+{
+    /* Ignore log messages that are generated inside the callbacks, just like in synchronous mode */
+    std::lock_guard<TrivialLock> guard{ g_logRecursionLock };
+
+    while (isRunning.load(std::memory_order_acquire))
+    {
+        Drain();
+
+        /* Wait for new records; producers never take this lock, so wake-ups may be missed and are bounded by the timeout */
+        std::unique_lock<std::mutex> lock{ wakeMutex };
+        wakeSignal.wait_for(lock, std::chrono::milliseconds(2));
+    }
+
+    /* Dispatch remaining records before the thread terminates */
+    Drain();
+}
+
+void LogAsyncWorker::Drain()
+{
+    ReportType  type = ReportType::Default;
+    std::string text;
+
+    while (queue.Pop(type, text))
+    {
+        PostReport(type, text.c_str());
+        dispatchedPos.store(queue.GetDequeuePos(), std::memory_order_release);
+    }
+
+    if (const std::uint32_t numDroppedMessages = numDropped.exchange(0))
+    {
+        const std::string summary = "LLGL: " + std::to_string(numDroppedMessages) + " log message(s) dropped due to full queue\n";
+        PostReport(ReportType::Error, summary.c_str());
+    }
+}
+
+// Returns true if the specified message type is within its rate limit and returns the number of previously suppressed messages once per interval.
+static bool AcceptRateLimit(ReportType type, std::uint32_t& outNumSuppressed)
+{
+    LogRateLimit& limit = g_logRateLimits[static_cast<int>(type)];
+
+    const std::uint32_t maxMessages = limit.maxMessagesPerSecond.load(std::memory_order_relaxed);
+    if (maxMessages == 0)
+        return true;
+
+    /* Begin new interval if the previous one has elapsed */
+    const std::int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    std::int64_t start = limit.intervalStart.load(std::memory_order_relaxed);
+    if (now - start >= 1000)
+    {
+        if (limit.intervalStart.compare_exchange_strong(start, now, std::memory_order_relaxed))
+        {
+            limit.numMessages.store(0, std::memory_order_relaxed);
+            outNumSuppressed = limit.numSuppressed.exchange(0, std::memory_order_relaxed);
+        }
+    }
+
+    if (limit.numMessages.fetch_add(1, std::memory_order_relaxed) < maxMessages)
+        return true;
+
+    limit.numSuppressed.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+static void DispatchReport(ReportType type, std::string& text)
+{
+    if (g_logMode.load(std::memory_order_acquire) == LogMode::Asynchronous)
+    {
+        if (g_logAsyncWorker.queue.Push(type, text))
+            g_logAsyncWorker.wakeSignal.notify_one();
+        else
+            g_logAsyncWorker.numDropped.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
+        PostReport(type, text.c_str());
+}
+
+static void DispatchSuppressedSummary(ReportType type, std::uint32_t numSuppressed)
+{
+    if (numSuppressed > 0)
+    {
+        std::string summary = "LLGL: " + std::to_string(numSuppressed) + " log message(s) suppressed by rate limit\n";
+        DispatchReport(type, summary);
+    }
+}
+
 LLGL_EXPORT void Printf(const char* format, ...)
 {
     if (!g_logRecursionLock)
     {
+        std::uint32_t numSuppressed = 0;
+        if (!AcceptRateLimit(ReportType::Default, numSuppressed))
+            return;
         std::lock_guard<TrivialLock> guard{ g_logRecursionLock };
+        DispatchSuppressedSummary(ReportType::Default, numSuppressed);
         std::string str;
         LLGL_STRING_PRINTF(str, format);
-        PostReport(ReportType::Default, str.c_str());
+        DispatchReport(ReportType::Default, str);
     }
 }
 
@@ -112,10 +352,14 @@ LLGL_EXPORT void Errorf(const char* format, ...)
 {
     if (!g_logRecursionLock)
     {
+        std::uint32_t numSuppressed = 0;
+        if (!AcceptRateLimit(ReportType::Error, numSuppressed))
+            return;
         std::lock_guard<TrivialLock> guard{ g_logRecursionLock };
+        DispatchSuppressedSummary(ReportType::Error, numSuppressed);
         std::string str;
         LLGL_STRING_PRINTF(str, format);
-        PostReport(ReportType::Error, str.c_str());
+        DispatchReport(ReportType::Error, str);
     }
 }
 
@@ -182,6 +426,53 @@ LLGL_EXPORT void UnregisterCallback(LogHandle handle)
 }
 
 
+LLGL_EXPORT void SetMode(LogMode mode)
+{
+    if (!g_logRecursionLock)
+    {
+        std::lock_guard<std::mutex> guard{ g_logModeLock };
+        if (mode == LogMode::Asynchronous)
+        {
+            g_logAsyncWorker.Start();
+            g_logMode.store(LogMode::Asynchronous, std::memory_order_release);
+        }
+        else
+        {
+            /* Route new messages synchronously before the worker dispatches all pending records and terminates */
+            g_logMode.store(LogMode::Synchronous, std::memory_order_release);
+            g_logAsyncWorker.Stop();
+        }
+    }
+}
+
+LLGL_EXPORT LogMode GetMode()
+{
+    return g_logMode.load(std::memory_order_acquire);
+}
+
+LLGL_EXPORT void Flush()
+{
+    /* Flushing from within a log callback would wait for the worker thread that is invoking it */
+    if (!g_logRecursionLock && g_logMode.load(std::memory_order_acquire) == LogMode::Asynchronous)
+    {
+        const std::size_t targetPos = g_logAsyncWorker.queue.GetEnqueuePos();
+        while (g_logAsyncWorker.isRunning.load(std::memory_order_acquire) &&
+               g_logAsyncWorker.dispatchedPos.load(std::memory_order_acquire) < targetPos)
+        {
+            g_logAsyncWorker.wakeSignal.notify_one();
+            std::this_thread::yield();
+        }
+    }
+}
+
+LLGL_EXPORT void SetRateLimit(ReportType type, std::uint32_t maxMessagesPerSecond)
+{
+    LogRateLimit& limit = g_logRateLimits[static_cast<int>(type)];
+    limit.maxMessagesPerSecond.store(maxMessagesPerSecond, std::memory_order_relaxed);
+    limit.numMessages.store(0, std::memory_order_relaxed);
+}
+
+
 } // /namespace Log
 
 } // /namespace LLGL
@@ -0,0 +1,211 @@
+/*
+ * MemoryArena.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Container/MemoryArena.h>
+#include <LLGL/Container/Allocator.h>
+#include "Assertion.h"
+#include <algorithm>
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+
+namespace LLGL
+{
+
+
+/*
+ * Internal structures
+ */
+
+// Header in front of each allocation from AllocateFromCurrent to identify its origin on deallocation.
+struct alignas(std::max_align_t) ArenaAllocationHeader
+{
+    MemoryArena*    arena;  // Null if the allocation was served from the heap.
+    std::size_t     offset; // Offset (in bytes) from the start of the chunk to the header, or the total size (in bytes) of a heap allocation.
+};
+
+struct ArenaChunk
+{
+    char*       data;
+    std::size_t size;
+};
+
+struct MemoryArena::Pimpl
+{
+    std::size_t             chunkSize       = 0;
+    std::vector<ArenaChunk> chunks;
+    std::size_t             chunkIndex      = 0;    // Index of the chunk that is currently allocated from.
+    std::size_t             chunkOffset     = 0;    // Offset (in bytes) into the current chunk.
+    std::size_t             allocatedSize   = 0;
+    void*                   lastAlloc       = nullptr;
+    std::size_t             lastAllocOffset = 0;    // Chunk offset before the last allocation, to rewind it on deallocation.
+};
+
+static thread_local MemoryArena* g_currentArena = nullptr;
+
+static std::size_t AlignUp(std::size_t offset, std::size_t alignment)
+{
+    return ((offset + alignment - 1) & ~(alignment - 1));
+}
+
+static void AppendChunk(MemoryArena::Pimpl& pimpl, std::size_t minSize)
+{
+    const std::size_t size = std::max(pimpl.chunkSize, minSize);
+    char* data = static_cast<char*>(AllocateMemory(size));
+    pimpl.chunks.push_back(ArenaChunk{ data, size });
+}
+
+
+/*
+ * MemoryArena class
+ */
+
+MemoryArena::MemoryArena(std::size_t chunkSize) :
+    pimpl_ { new Pimpl{} }
+{
+    pimpl_->chunkSize = std::max<std::size_t>(chunkSize, 256);
+}
+
+MemoryArena::~MemoryArena()
+{
+    LLGL_ASSERT(g_currentArena != this, "memory arena destroyed while still bound to the current thread");
+    for (const ArenaChunk& chunk : pimpl_->chunks)
+        FreeMemory(chunk.data, chunk.size);
+    delete pimpl_;
+}
+
+void* MemoryArena::Allocate(std::size_t size, std::size_t alignment)
+{
+    LLGL_ASSERT(alignment > 0 && (alignment & (alignment - 1)) == 0, "memory arena alignment must be a power of two");
+
+    /* Find chunk with enough remaining space, skipping chunks that are too small */
+    for (;;)
+    {
+        if (pimpl_->chunkIndex == pimpl_->chunks.size())
+        {
+            /* Allocate new chunk with enough space for the alignment padding */
+            AppendChunk(*pimpl_, size + alignment);
+            pimpl_->chunkOffset = 0;
+        }
+
+        const ArenaChunk&   chunk   = pimpl_->chunks[pimpl_->chunkIndex];
+        const std::size_t   base    = reinterpret_cast<std::uintptr_t>(chunk.data);
+        const std::size_t   offset  = AlignUp(base + pimpl_->chunkOffset, alignment) - base;
+
+        if (offset + size <= chunk.size)
+        {
+            char* ptr = chunk.data + offset;
+            pimpl_->lastAlloc       = ptr;
+            pimpl_->lastAllocOffset = pimpl_->chunkOffset;
+            pimpl_->chunkOffset     = offset + size;
+            pimpl_->allocatedSize  += size;
+            return ptr;
+        }
+
+        /* Move on to next chunk */
+        ++pimpl_->chunkIndex;
+        pimpl_->chunkOffset = 0;
+    }
+}
+
+void MemoryArena::Reset()
+{
+    /* Keep only the first chunk of the default size for reuse and release all others */
+    std::size_t numKeptChunks = 0;
+    if (!pimpl_->chunks.empty() && pimpl_->chunks.front().size == pimpl_->chunkSize)
+        numKeptChunks = 1;
+
+    for (std::size_t i = numKeptChunks; i < pimpl_->chunks.size(); ++i)
+        FreeMemory(pimpl_->chunks[i].data, pimpl_->chunks[i].size);
+
+    pimpl_->chunks.resize(numKeptChunks);
+    pimpl_->chunkIndex      = 0;
+    pimpl_->chunkOffset     = 0;
+    pimpl_->allocatedSize   = 0;
+    pimpl_->lastAlloc       = nullptr;
+    pimpl_->lastAllocOffset = 0;
+}
+
+std::size_t MemoryArena::GetAllocatedSize() const
+{
+    return pimpl_->allocatedSize;
+}
+
+MemoryArena* MemoryArena::GetCurrent()
+{
+    return g_currentArena;
+}
+
+void* MemoryArena::AllocateFromCurrent(std::size_t size, std::size_t alignment)
+{
+    LLGL_ASSERT(alignment <= alignof(std::max_align_t), "over-aligned allocations are not supported by ArenaAllocator");
+
+    const std::size_t totalSize = sizeof(ArenaAllocationHeader) + size;
+
+    ArenaAllocationHeader* header = nullptr;
+    if (MemoryArena* arena = g_currentArena)
+    {
+        header = static_cast<ArenaAllocationHeader*>(arena->Allocate(totalSize, alignof(ArenaAllocationHeader)));
+        header->arena   = arena;
+        header->offset  = arena->pimpl_->lastAllocOffset;
+    }
+    else
+    {
+        header = static_cast<ArenaAllocationHeader*>(AllocateMemory(totalSize, alignof(ArenaAllocationHeader)));
+        header->arena   = nullptr;
+        header->offset  = totalSize;
+    }
+
+    return (header + 1);
+}
+
+void MemoryArena::DeallocateFromCurrent(void* ptr)
+{
+    if (ptr == nullptr)
+        return;
+
+    ArenaAllocationHeader* header = static_cast<ArenaAllocationHeader*>(ptr) - 1;
+    if (MemoryArena* arena = header->arena)
+    {
+        /* Rewind arena if this was the most recent allocation, which is the common case for growing vectors */
+        Pimpl& pimpl = *(arena->pimpl_);
+        if (pimpl.lastAlloc == header)
+        {
+            const std::size_t size = pimpl.chunkOffset - (reinterpret_cast<char*>(header) - pimpl.chunks[pimpl.chunkIndex].data);
+            pimpl.allocatedSize    -= size;
+            pimpl.chunkOffset       = header->offset;
+            pimpl.lastAlloc         = nullptr;
+        }
+    }
+    else
+        FreeMemory(header, header->offset, alignof(ArenaAllocationHeader));
+}
+
+
+/*
+ * ScopedMemoryArena class
+ */
+
+ScopedMemoryArena::ScopedMemoryArena(MemoryArena& arena) :
+    prevArena_ { g_currentArena }
+{
+    g_currentArena = &arena;
+}
+
+ScopedMemoryArena::~ScopedMemoryArena()
+{
+    g_currentArena = prevArena_;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
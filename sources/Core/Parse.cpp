@@ -8,9 +8,14 @@
 #include <LLGL/Utils/Parse.h>
 #include <LLGL/Utils/ForRange.h>
 #include <LLGL/Container/Strings.h>
+#include <LLGL/Container/DynamicVector.h>
+#include <LLGL/Container/MemoryArena.h>
 #include <LLGL/Report.h>
 #include <vector>
 #include <string>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <cstring>
 #include <cmath>
 #include "Exception.h"
@@ -426,6 +431,8 @@ static long ParseLayoutSignatureStageFlag(Parser& parser, long& bitmask)
         { StageFlags::GeometryStage,        "geom" },
         { StageFlags::FragmentStage,        "frag" },
         { StageFlags::ComputeStage,         "comp" },
+        { StageFlags::TaskStage,            "task" },
+        { StageFlags::MeshStage,            "mesh" },
     };
 
     /* Parse identifier (find end of alphabetic characters) */
@@ -567,7 +574,8 @@ static bool ParseLayoutSignatureResourceBinding(Parser& parser, PipelineLayoutDe
     if (!parser.Accept("("))
         return ReturnWithParseError(parser, "expected open bracket '(' after resource type");
 
-    std::vector<BindingDescriptor> intermediateBindings;
+    /* Collect bindings in temporary container; allocated from the current memory arena if the caller bound one via ScopedMemoryArena */
+    DynamicVector<BindingDescriptor, ArenaAllocator<BindingDescriptor>> intermediateBindings;
 
     while (parser.Feed() && !parser.Match(")"))
     {
@@ -1479,6 +1487,41 @@ TextureSwizzleRGBA ParseContext::AsTextureSwizzleRGBA() const
 }
 
 
+/*
+ * Parse cache
+ */
+
+struct ParseCacheEntry
+{
+    std::string                                 signature;
+    std::unique_ptr<PipelineLayoutDescriptor>   desc;
+};
+
+struct ParseCache
+{
+    std::mutex                                              mutex;
+    std::unordered_multimap<std::size_t, ParseCacheEntry>   entries;
+};
+
+static ParseCache& GetParseCache()
+{
+    static ParseCache cache;
+    return cache;
+}
+
+// Returns the 64-bit FNV-1a hash of the specified string.
+static std::size_t HashSignature(const StringView& s)
+{
+    std::uint64_t hash = 0xCBF29CE484222325ull;
+    for (char c : s)
+    {
+        hash ^= static_cast<std::uint8_t>(c);
+        hash *= 0x100000001B3ull;
+    }
+    return static_cast<std::size_t>(hash);
+}
+
+
 /*
  * Global functions
  */
@@ -1498,6 +1541,46 @@ LLGL_EXPORT ParseContext Parse(const char* format, ...)
     }
 }
 
+LLGL_EXPORT const PipelineLayoutDescriptor& ParsePipelineLayoutDescCached(const StringView& signature)
+{
+    ParseCache& cache = GetParseCache();
+    const std::size_t hash = HashSignature(signature);
+
+    /* Return interned descriptor if this signature has already been parsed */
+    {
+        std::lock_guard<std::mutex> guard{ cache.mutex };
+        auto range = cache.entries.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (signature == StringView{ it->second.signature })
+                return *(it->second.desc);
+        }
+    }
+
+    /* Parse signature outside the lock; the string view is only referenced during parsing */
+    std::unique_ptr<PipelineLayoutDescriptor> desc{ new PipelineLayoutDescriptor{ ParseContext{ signature }.AsPipelineLayoutDesc() } };
+
+    std::lock_guard<std::mutex> guard{ cache.mutex };
+
+    /* Another thread might have interned the same signature in the meantime */
+    auto range = cache.entries.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (signature == StringView{ it->second.signature })
+            return *(it->second.desc);
+    }
+
+    auto it = cache.entries.emplace(hash, ParseCacheEntry{ std::string{ signature.begin(), signature.end() }, std::move(desc) });
+    return *(it->second.desc);
+}
+
+LLGL_EXPORT void ClearParseCache()
+{
+    ParseCache& cache = GetParseCache();
+    std::lock_guard<std::mutex> guard{ cache.mutex };
+    cache.entries.clear();
+}
+
 
 } // /namespace LLGL
 
@@ -0,0 +1,57 @@
+/*
+ * ProfileZone.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "ProfileZone.h"
+
+
+namespace LLGL
+{
+
+
+static ProfileZoneCallbacks g_profileZoneCallbacks;
+
+LLGL_EXPORT void SetProfileZoneCallbacks(const ProfileZoneCallbacks* callbacks)
+{
+    if (callbacks != nullptr)
+        g_profileZoneCallbacks = *callbacks;
+    else
+        g_profileZoneCallbacks = ProfileZoneCallbacks{};
+}
+
+
+/*
+ * ScopedProfileZone class
+ */
+
+#ifdef LLGL_ENABLE_PROFILE_ZONES
+
+ScopedProfileZone::ScopedProfileZone(const ProfileZoneLocation& location) :
+    location_ { location }
+{
+    /* Store end callback, so this zone is always left with the same callbacks it was entered with */
+    if (g_profileZoneCallbacks.beginZone != nullptr && g_profileZoneCallbacks.endZone != nullptr)
+    {
+        endZone_    = g_profileZoneCallbacks.endZone;
+        userData_   = g_profileZoneCallbacks.userData;
+        token_      = g_profileZoneCallbacks.beginZone(location, userData_);
+    }
+}
+
+ScopedProfileZone::~ScopedProfileZone()
+{
+    if (endZone_ != nullptr)
+        endZone_(location_, token_, userData_);
+}
+
+#endif // /LLGL_ENABLE_PROFILE_ZONES
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,73 @@
+/*
+ * ProfileZone.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_CORE_PROFILE_ZONE_H
+#define LLGL_CORE_PROFILE_ZONE_H
+
+
+#include <LLGL/ProfileZone.h>
+#include <LLGL/NonCopyable.h>
+
+
+#ifdef LLGL_ENABLE_PROFILE_ZONES
+
+#define LLGL_PROFILE_ZONE_CONCAT_PRIMARY(A, B) \
+    A ## B
+
+#define LLGL_PROFILE_ZONE_CONCAT(A, B) \
+    LLGL_PROFILE_ZONE_CONCAT_PRIMARY(A, B)
+
+// Emits a CPU profile zone with the specified name until the end of the current scope (see LLGL::SetProfileZoneCallbacks).
+#define LLGL_PROFILE_ZONE(NAME)                                                                                                         \
+    static const LLGL::ProfileZoneLocation LLGL_PROFILE_ZONE_CONCAT(profileZoneLocation, __LINE__) =                                    \
+    {                                                                                                                                   \
+        (NAME), __FUNCTION__, __FILE__, static_cast<std::uint32_t>(__LINE__), 0u                                                        \
+    };                                                                                                                                  \
+    LLGL::ScopedProfileZone LLGL_PROFILE_ZONE_CONCAT(profileZone, __LINE__){ LLGL_PROFILE_ZONE_CONCAT(profileZoneLocation, __LINE__) }
+
+#else
+
+#define LLGL_PROFILE_ZONE(NAME)
+
+#endif
+
+
+namespace LLGL
+{
+
+
+#ifdef LLGL_ENABLE_PROFILE_ZONES
+
+// Enters a CPU profile zone on construction and leaves it on destruction. Use LLGL_PROFILE_ZONE instead of this class directly.
+class LLGL_EXPORT ScopedProfileZone final : public NonCopyable
+{
+
+    public:
+
+        explicit ScopedProfileZone(const ProfileZoneLocation& location);
+        ~ScopedProfileZone();
+
+    private:
+
+        const ProfileZoneLocation&  location_;
+        void                        (*endZone_)(const ProfileZoneLocation&, std::uint64_t, void*)   = nullptr;
+        void*                       userData_                                                       = nullptr;
+        std::uint64_t               token_                                                          = 0;
+
+};
+
+#endif // /LLGL_ENABLE_PROFILE_ZONES
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
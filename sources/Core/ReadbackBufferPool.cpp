@@ -0,0 +1,270 @@
+/*
+ * ReadbackBufferPool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Utils/ReadbackBufferPool.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/CommandBuffer.h>
+#include <LLGL/Fence.h>
+#include <LLGL/TextureFlags.h>
+#include "Assertion.h"
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+/*
+ * Internal structures
+ */
+
+// Number of size classes; Each class doubles the buffer size of the previous one.
+static constexpr std::size_t g_numSizeClasses = 64;
+
+struct ReadbackBufferEntry
+{
+    Buffer*         buffer      = nullptr;
+    std::uint64_t   capacity    = 0;
+    Fence*          fence       = nullptr;  // Fence that is signaled once the GPU has finished writing this buffer. Null if not submitted yet.
+    std::uint64_t   fenceValue  = 0;
+    bool            inUse       = false;    // True while this buffer is assigned to a request.
+    bool            pending     = false;    // True while the copy into this buffer has not been associated with a fence yet.
+
+    // Returns true if the GPU has finished writing this buffer.
+    bool IsSignaled() const
+    {
+        return (!pending && (fence == nullptr || fence->GetCompletedValue() >= fenceValue));
+    }
+};
+
+using ReadbackBufferEntryPtr = std::unique_ptr<ReadbackBufferEntry>;
+
+struct ReadbackRequestEntry
+{
+    ReadbackBufferEntry*    entry   = nullptr;
+    std::uint64_t           size    = 0;
+};
+
+struct ReadbackBufferPool::Pimpl
+{
+    Pimpl(RenderSystem& renderSystem, const ReadbackBufferPoolDescriptor& desc);
+    ~Pimpl();
+
+    // Returns an available buffer of the specified size class or creates a new one.
+    ReadbackBufferEntry* AcquireEntry(std::size_t sizeClass);
+
+    // Assigns a new request to an available buffer of at least the specified size.
+    ReadbackRequest MakeRequest(std::uint64_t size, ReadbackBufferEntry*& outEntry);
+
+    // Returns the request entry for the specified handle or null if the handle is invalid.
+    const ReadbackRequestEntry* FindRequest(ReadbackRequest request) const;
+
+    RenderSystem&                                               renderSystem;
+    ReadbackBufferPoolDescriptor                                desc;
+    std::vector<ReadbackBufferEntryPtr>                         sizeClasses[g_numSizeClasses];
+    std::unordered_map<ReadbackRequest, ReadbackRequestEntry>   requests;
+    std::vector<ReadbackBufferEntry*>                           pendingSubmits;
+    ReadbackRequest                                             nextId              = 1;
+    std::uint64_t                                               totalBufferSize     = 0;
+};
+
+// Returns the size class for the specified request size, i.e. the binary logarithm of the rounded buffer size.
+static std::size_t GetSizeClass(std::uint64_t size, std::uint64_t minBufferSize)
+{
+    std::size_t sizeClass = 0;
+    std::uint64_t capacity = 1;
+    for (size = std::max(size, minBufferSize); capacity < size && sizeClass + 1 < g_numSizeClasses; capacity <<= 1)
+        ++sizeClass;
+    return sizeClass;
+}
+
+ReadbackBufferPool::Pimpl::Pimpl(RenderSystem& renderSystem, const ReadbackBufferPoolDescriptor& desc) :
+    renderSystem { renderSystem },
+    desc         { desc         }
+{
+    this->desc.minBufferSize = std::max<std::uint64_t>(desc.minBufferSize, 1);
+}
+
+ReadbackBufferPool::Pimpl::~Pimpl()
+{
+    for (std::vector<ReadbackBufferEntryPtr>& entries : sizeClasses)
+    {
+        for (ReadbackBufferEntryPtr& entry : entries)
+            renderSystem.Release(*entry->buffer);
+    }
+}
+
+ReadbackBufferEntry* ReadbackBufferPool::Pimpl::AcquireEntry(std::size_t sizeClass)
+{
+    /* Reuse buffer that is neither assigned to a request nor written by the GPU anymore */
+    std::vector<ReadbackBufferEntryPtr>& entries = sizeClasses[sizeClass];
+    for (ReadbackBufferEntryPtr& entry : entries)
+    {
+        if (!entry->inUse && entry->IsSignaled())
+            return entry.get();
+    }
+
+    /* Create new readback buffer for this size class */
+    const std::uint64_t capacity = (std::uint64_t(1) << sizeClass);
+
+    BufferDescriptor bufferDesc;
+    {
+        bufferDesc.debugName        = desc.debugName;
+        bufferDesc.size             = capacity;
+        bufferDesc.bindFlags        = BindFlags::CopyDst;
+        bufferDesc.cpuAccessFlags   = CPUAccessFlags::Read;
+        bufferDesc.miscFlags        = MiscFlags::Readback;
+    }
+    Buffer* buffer = renderSystem.CreateBuffer(bufferDesc);
+    if (buffer == nullptr)
+        return nullptr;
+
+    ReadbackBufferEntryPtr entry{ new ReadbackBufferEntry{} };
+    {
+        entry->buffer   = buffer;
+        entry->capacity = capacity;
+    }
+    totalBufferSize += capacity;
+
+    entries.push_back(std::move(entry));
+    return entries.back().get();
+}
+
+ReadbackRequest ReadbackBufferPool::Pimpl::MakeRequest(std::uint64_t size, ReadbackBufferEntry*& outEntry)
+{
+    if (size == 0)
+        return 0;
+
+    ReadbackBufferEntry* entry = AcquireEntry(GetSizeClass(size, desc.minBufferSize));
+    if (entry == nullptr)
+        return 0;
+
+    LLGL_ASSERT(size <= entry->capacity);
+
+    /* Keep buffer until the request is released and the GPU has finished writing it */
+    entry->fence    = nullptr;
+    entry->inUse    = true;
+    entry->pending  = true;
+    pendingSubmits.push_back(entry);
+
+    const ReadbackRequest id = nextId++;
+    ReadbackRequestEntry& requestEntry = requests[id];
+    {
+        requestEntry.entry  = entry;
+        requestEntry.size   = size;
+    }
+
+    outEntry = entry;
+    return id;
+}
+
+const ReadbackRequestEntry* ReadbackBufferPool::Pimpl::FindRequest(ReadbackRequest request) const
+{
+    auto it = requests.find(request);
+    return (it != requests.end() ? &(it->second) : nullptr);
+}
+
+
+/*
+ * ReadbackBufferPool class
+ */
+
+ReadbackBufferPool::ReadbackBufferPool(RenderSystem& renderSystem, const ReadbackBufferPoolDescriptor& desc) :
+    pimpl_ { new Pimpl{ renderSystem, desc } }
+{
+}
+
+ReadbackBufferPool::~ReadbackBufferPool()
+{
+    delete pimpl_;
+}
+
+ReadbackRequest ReadbackBufferPool::CopyBuffer(CommandBuffer& commandBuffer, Buffer& srcBuffer, std::uint64_t srcOffset, std::uint64_t size)
+{
+    ReadbackBufferEntry* entry = nullptr;
+    const ReadbackRequest request = pimpl_->MakeRequest(size, entry);
+    if (request != 0)
+        commandBuffer.CopyBuffer(*entry->buffer, 0, srcBuffer, srcOffset, size);
+    return request;
+}
+
+ReadbackRequest ReadbackBufferPool::CopyTexture(CommandBuffer& commandBuffer, Texture& srcTexture, const TextureRegion& srcRegion)
+{
+    /* Texels are tightly packed, so the backends manage the row alignment of the copy */
+    const std::uint64_t size = GetMemoryFootprint(srcTexture.GetType(), srcTexture.GetFormat(), srcRegion.extent, srcRegion.subresource);
+
+    ReadbackBufferEntry* entry = nullptr;
+    const ReadbackRequest request = pimpl_->MakeRequest(size, entry);
+    if (request != 0)
+        commandBuffer.CopyBufferFromTexture(*entry->buffer, 0, srcTexture, srcRegion);
+    return request;
+}
+
+void ReadbackBufferPool::Submit(Fence& fence, std::uint64_t value)
+{
+    for (ReadbackBufferEntry* entry : pimpl_->pendingSubmits)
+    {
+        entry->fence        = &fence;
+        entry->fenceValue   = value;
+        entry->pending      = false;
+    }
+    pimpl_->pendingSubmits.clear();
+}
+
+bool ReadbackBufferPool::IsReady(ReadbackRequest request) const
+{
+    const ReadbackRequestEntry* requestEntry = pimpl_->FindRequest(request);
+    return (requestEntry != nullptr && requestEntry->entry->fence != nullptr && requestEntry->entry->IsSignaled());
+}
+
+const void* ReadbackBufferPool::Map(ReadbackRequest request)
+{
+    if (!IsReady(request))
+        return nullptr;
+
+    /* Map entire buffer, since the backends differ in whether the returned pointer of a range mapping is offset */
+    const ReadbackRequestEntry* requestEntry = pimpl_->FindRequest(request);
+    return pimpl_->renderSystem.MapBuffer(*requestEntry->entry->buffer, CPUAccess::ReadOnly);
+}
+
+void ReadbackBufferPool::Unmap(ReadbackRequest request)
+{
+    if (const ReadbackRequestEntry* requestEntry = pimpl_->FindRequest(request))
+        pimpl_->renderSystem.UnmapBuffer(*requestEntry->entry->buffer);
+}
+
+std::uint64_t ReadbackBufferPool::GetSize(ReadbackRequest request) const
+{
+    const ReadbackRequestEntry* requestEntry = pimpl_->FindRequest(request);
+    return (requestEntry != nullptr ? requestEntry->size : 0);
+}
+
+void ReadbackBufferPool::Release(ReadbackRequest request)
+{
+    /* Buffers that are still pending or in flight are only reused once their fence has been signaled (see AcquireEntry) */
+    auto it = pimpl_->requests.find(request);
+    if (it != pimpl_->requests.end())
+    {
+        it->second.entry->inUse = false;
+        pimpl_->requests.erase(it);
+    }
+}
+
+std::uint64_t ReadbackBufferPool::GetTotalBufferSize() const
+{
+    return pimpl_->totalBufferSize;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
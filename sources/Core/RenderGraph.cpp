@@ -0,0 +1,1077 @@
+/*
+ * RenderGraph.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Utils/RenderGraph.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/CommandBuffer.h>
+#include <LLGL/CommandQueue.h>
+#include <LLGL/Format.h>
+#include <LLGL/Constants.h>
+#include <LLGL/Utils/ForRange.h>
+#include "Assertion.h"
+#include <vector>
+#include <string>
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+/*
+ * Internal structures
+ */
+
+// Number of compilations a pooled resource can remain unused before it is released.
+static constexpr unsigned g_maxUnusedCompiles = 3;
+
+static constexpr std::uint32_t g_invalidIndex = LLGL_INVALID_SLOT;
+
+struct RenderGraphResourceEntry
+{
+    std::string         name;
+    bool                isTexture       = false;
+    bool                isImported      = false;
+    bool                isAsync         = false;            // Accessed by at least one pass on the asynchronous compute queue.
+    bool                deriveBindFlags = false;            // Buffer was declared without binding flags.
+    TextureDescriptor   textureDesc;
+    BufferDescriptor    bufferDesc;
+    Texture*            texture         = nullptr;          // Physical texture; Only valid after compilation for transient resources.
+    Buffer*             buffer          = nullptr;          // Physical buffer; Only valid after compilation for transient resources.
+    std::uint32_t       firstUse        = g_invalidIndex;   // Index of the first pass that is not culled and accesses this resource.
+    std::uint32_t       lastUse         = g_invalidIndex;   // Index of the last pass that is not culled and accesses this resource.
+};
+
+struct RenderGraphAccess
+{
+    RenderGraphResource resource;
+    bool                read;               // Previous content of the resource is consumed.
+    bool                write;              // Content of the resource is modified.
+    long                bindFlags;          // Binding flags that are required for this access.
+};
+
+struct RenderGraphAttachment
+{
+    RenderGraphResource resource        = g_invalidIndex;
+    bool                clear           = false;
+    ClearValue          clearValue;
+};
+
+struct RenderGraphPassEntry
+{
+    std::string             name;
+    RenderGraphPassCallback callback;
+    long                    flags               = 0;
+    std::vector<RenderGraphAccess>
+                            accesses;
+    RenderGraphAttachment   colorAttachments[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
+    RenderGraphAttachment   depthStencilAttachment;
+    bool                    hasAttachments      = false;
+    RenderTarget*           externalTarget      = nullptr;
+    bool                    culled              = false;
+    bool                    async               = false;            // Pass is scheduled on the asynchronous compute queue.
+    RenderPass*             renderPass          = nullptr;          // Cached render pass for the attachments; Only valid after compilation.
+    RenderTarget*           renderTarget        = nullptr;          // Cached render target for the attachments; Only valid after compilation.
+    std::uint32_t           numClearValues      = 0;
+    ClearValue              clearValues[LLGL_MAX_NUM_COLOR_ATTACHMENTS + 1];
+};
+
+struct RenderGraphPooledTexture
+{
+    TextureDescriptor   desc;
+    Texture*            texture         = nullptr;
+    std::uint32_t       busyUntil       = g_invalidIndex;   // Index of the last pass the texture is assigned to in the current compilation.
+    bool                exclusive       = false;            // Texture must not be shared in the current compilation.
+    bool                used            = false;
+    unsigned            unusedCompiles  = 0;
+};
+
+struct RenderGraphPooledBuffer
+{
+    BufferDescriptor    desc;
+    Buffer*             buffer          = nullptr;
+    std::uint32_t       busyUntil       = g_invalidIndex;
+    bool                exclusive       = false;
+    bool                used            = false;
+    unsigned            unusedCompiles  = 0;
+};
+
+// Cached render pass and render target for a unique combination of attachments and load/store operations.
+struct RenderGraphCachedTarget
+{
+    Texture*            colorTextures[LLGL_MAX_NUM_COLOR_ATTACHMENTS]   = {};
+    Texture*            depthStencilTexture                             = nullptr;
+    RenderPassDescriptor
+                        renderPassDesc;
+    RenderPass*         renderPass                                      = nullptr;
+    RenderTarget*       renderTarget                                    = nullptr;
+    bool                used                                            = false;
+    unsigned            unusedCompiles                                  = 0;
+};
+
+// Group of consecutive passes that are recorded into one command buffer and submitted to the same command queue.
+struct RenderGraphBatch
+{
+    std::uint32_t       firstPass;
+    std::uint32_t       endPass;
+    int                 queueIndex;
+};
+
+static bool IsCompatibleTextureDesc(const TextureDescriptor& lhs, const TextureDescriptor& rhs)
+{
+    return
+    (
+        lhs.type            == rhs.type             &&
+        lhs.bindFlags       == rhs.bindFlags        &&
+        lhs.cpuAccessFlags  == rhs.cpuAccessFlags   &&
+        lhs.miscFlags       == rhs.miscFlags        &&
+        lhs.format          == rhs.format           &&
+        lhs.extent.width    == rhs.extent.width     &&
+        lhs.extent.height   == rhs.extent.height    &&
+        lhs.extent.depth    == rhs.extent.depth     &&
+        lhs.arrayLayers     == rhs.arrayLayers      &&
+        lhs.mipLevels       == rhs.mipLevels        &&
+        lhs.samples         == rhs.samples
+    );
+}
+
+static bool IsCompatibleBufferDesc(const BufferDescriptor& lhs, const BufferDescriptor& rhs)
+{
+    return
+    (
+        lhs.size            == rhs.size             &&
+        lhs.stride          == rhs.stride           &&
+        lhs.format          == rhs.format           &&
+        lhs.bindFlags       == rhs.bindFlags        &&
+        lhs.cpuAccessFlags  == rhs.cpuAccessFlags   &&
+        lhs.miscFlags       == rhs.miscFlags        &&
+        lhs.vertexAttribs.empty()                   &&
+        rhs.vertexAttribs.empty()
+    );
+}
+
+static bool IsEqualAttachmentFormat(const AttachmentFormatDescriptor& lhs, const AttachmentFormatDescriptor& rhs)
+{
+    return (lhs.format == rhs.format && lhs.loadOp == rhs.loadOp && lhs.storeOp == rhs.storeOp);
+}
+
+static bool IsEqualRenderPassDesc(const RenderPassDescriptor& lhs, const RenderPassDescriptor& rhs)
+{
+    for_range(i, LLGL_MAX_NUM_COLOR_ATTACHMENTS)
+    {
+        if (!IsEqualAttachmentFormat(lhs.colorAttachments[i], rhs.colorAttachments[i]))
+            return false;
+    }
+    return
+    (
+        IsEqualAttachmentFormat(lhs.depthAttachment, rhs.depthAttachment)       &&
+        IsEqualAttachmentFormat(lhs.stencilAttachment, rhs.stencilAttachment)   &&
+        lhs.samples == rhs.samples
+    );
+}
+
+
+/*
+ * RenderGraph::Pimpl struct
+ */
+
+struct RenderGraph::Pimpl
+{
+    Pimpl(RenderSystem& renderSystem);
+    ~Pimpl();
+
+    RenderGraphResourceEntry& GetResource(RenderGraphResource resource);
+    RenderGraphPassEntry& GetPass(RenderGraphPass pass);
+
+    void AddAccess(RenderGraphPass pass, RenderGraphResource resource, bool read, bool write, long bindFlags);
+
+    void CullPasses();
+    void DetermineLifetimes();
+    void AllocateTransientResources();
+    void CreateRenderTargets();
+    void ReleaseUnusedResources();
+
+    Texture* AcquireTexture(const RenderGraphResourceEntry& entry);
+    Buffer* AcquireBuffer(const RenderGraphResourceEntry& entry);
+    void AcquireRenderTarget(RenderGraphPassEntry& pass);
+    void ReleaseCachedTargets(const Texture* texture);
+
+    // Returns the physical texture that is bound to the specified attachment of the current compilation.
+    Texture* GetAttachmentTexture(const RenderGraphAttachment& attachment);
+
+    // Returns the attachment format descriptor with load and store operations derived from the lifetime of its resource.
+    AttachmentFormatDescriptor GetAttachmentFormat(const RenderGraphAttachment& attachment, std::uint32_t passIndex);
+
+    void RecordPass(CommandBuffer& commandBuffer, const RenderGraphPassEntry& pass);
+
+    // Returns true if the two batches access any common resource.
+    bool HaveSharedResources(const RenderGraphBatch& lhs, const RenderGraphBatch& rhs) const;
+
+    CommandBuffer* GetBatchCommandBuffer(int queueIndex, std::size_t index);
+
+    RenderSystem&                           renderSystem;
+
+    std::vector<RenderGraphResourceEntry>   resources;
+    std::vector<RenderGraphPassEntry>       passes;
+    bool                                    dirty           = true;
+
+    std::vector<RenderGraphPooledTexture>   texturePool;
+    std::vector<RenderGraphPooledBuffer>    bufferPool;
+    std::vector<RenderGraphCachedTarget>    targetCache;
+
+    // Command queues, fences, and command buffers for RenderGraph::Execute(); Index 0 is the graphics queue and index 1 is the compute queue.
+    CommandQueue*                           queues[2]       = {};
+    Fence*                                  fences[2]       = {};
+    std::uint64_t                           fenceValues[2]  = {};
+    std::vector<CommandBuffer*>             commandBuffers[2];
+};
+
+RenderGraph::Pimpl::Pimpl(RenderSystem& renderSystem) :
+    renderSystem { renderSystem }
+{
+}
+
+RenderGraph::Pimpl::~Pimpl()
+{
+    /* Wait until the GPU has finished with all physical resources */
+    for_range(i, 2)
+    {
+        if (queues[i] != nullptr && fences[i] != nullptr && fenceValues[i] > 0)
+            queues[i]->WaitFence(*fences[i], fenceValues[i], ~0ull);
+    }
+
+    for (RenderGraphCachedTarget& target : targetCache)
+    {
+        renderSystem.Release(*target.renderTarget);
+        renderSystem.Release(*target.renderPass);
+    }
+
+    for (RenderGraphPooledTexture& entry : texturePool)
+        renderSystem.Release(*entry.texture);
+
+    for (RenderGraphPooledBuffer& entry : bufferPool)
+        renderSystem.Release(*entry.buffer);
+
+    for_range(i, 2)
+    {
+        for (CommandBuffer* cmdBuffer : commandBuffers[i])
+            renderSystem.Release(*cmdBuffer);
+        if (fences[i] != nullptr)
+            renderSystem.Release(*fences[i]);
+    }
+}
+
+RenderGraphResourceEntry& RenderGraph::Pimpl::GetResource(RenderGraphResource resource)
+{
+    LLGL_ASSERT_UPPER_BOUND(resource, resources.size());
+    return resources[resource];
+}
+
+RenderGraphPassEntry& RenderGraph::Pimpl::GetPass(RenderGraphPass pass)
+{
+    LLGL_ASSERT_UPPER_BOUND(pass, passes.size());
+    return passes[pass];
+}
+
+void RenderGraph::Pimpl::AddAccess(RenderGraphPass pass, RenderGraphResource resource, bool read, bool write, long bindFlags)
+{
+    RenderGraphPassEntry& passEntry = GetPass(pass);
+    GetResource(resource);
+
+    /* Merge with previous access of the same resource */
+    for (RenderGraphAccess& access : passEntry.accesses)
+    {
+        if (access.resource == resource)
+        {
+            access.read     = (access.read || read);
+            access.write    = (access.write || write);
+            access.bindFlags |= bindFlags;
+            dirty = true;
+            return;
+        }
+    }
+
+    passEntry.accesses.push_back(RenderGraphAccess{ resource, read, write, bindFlags });
+    dirty = true;
+}
+
+void RenderGraph::Pimpl::CullPasses()
+{
+    /* Walk passes in reverse order and keep only those that contribute to a resource that is needed later on */
+    std::vector<bool> neededResources(resources.size(), false);
+
+    for (auto it = passes.rbegin(); it != passes.rend(); ++it)
+    {
+        RenderGraphPassEntry& pass = *it;
+
+        bool needed = ((pass.flags & RenderGraphPassFlags::NeverCull) != 0 || pass.externalTarget != nullptr);
+
+        for (const RenderGraphAccess& access : pass.accesses)
+        {
+            if (access.write && (neededResources[access.resource] || resources[access.resource].isImported))
+            {
+                needed = true;
+                break;
+            }
+        }
+
+        pass.culled = !needed;
+        if (pass.culled)
+            continue;
+
+        /* Resources that are overwritten entirely do not depend on previous passes; all other accesses depend on them */
+        for (const RenderGraphAccess& access : pass.accesses)
+            neededResources[access.resource] = access.read;
+    }
+}
+
+void RenderGraph::Pimpl::DetermineLifetimes()
+{
+    /* Async compute is only used if the compute queue is different from the graphics queue */
+    const bool asyncComputeSupported = (renderSystem.GetCommandQueue(CommandQueueFlags::Compute) != renderSystem.GetCommandQueue());
+
+    for (RenderGraphResourceEntry& entry : resources)
+    {
+        entry.firstUse  = g_invalidIndex;
+        entry.lastUse   = g_invalidIndex;
+        entry.isAsync   = false;
+    }
+
+    for_range(passIndex, static_cast<std::uint32_t>(passes.size()))
+    {
+        RenderGraphPassEntry& pass = passes[passIndex];
+        if (pass.culled)
+            continue;
+
+        /* Passes with a render pass section cannot be recorded for a compute queue */
+        pass.async =
+        (
+            asyncComputeSupported                                       &&
+            (pass.flags & RenderGraphPassFlags::AsyncCompute) != 0      &&
+            !pass.hasAttachments                                        &&
+            pass.externalTarget == nullptr
+        );
+
+        for (const RenderGraphAccess& access : pass.accesses)
+        {
+            RenderGraphResourceEntry& entry = resources[access.resource];
+            if (entry.firstUse == g_invalidIndex)
+                entry.firstUse = passIndex;
+            entry.lastUse = passIndex;
+            entry.isAsync = (entry.isAsync || pass.async);
+        }
+    }
+}
+
+void RenderGraph::Pimpl::AllocateTransientResources()
+{
+    for (RenderGraphPooledTexture& entry : texturePool)
+    {
+        entry.busyUntil = g_invalidIndex;
+        entry.exclusive = false;
+        entry.used      = false;
+    }
+
+    for (RenderGraphPooledBuffer& entry : bufferPool)
+    {
+        entry.busyUntil = g_invalidIndex;
+        entry.exclusive = false;
+        entry.used      = false;
+    }
+
+    /* Add binding flags for all declared accesses */
+    for (const RenderGraphPassEntry& pass : passes)
+    {
+        for (const RenderGraphAccess& access : pass.accesses)
+        {
+            RenderGraphResourceEntry& entry = resources[access.resource];
+            if (entry.isImported)
+                continue;
+
+            /* Only derive binding flags for buffers without explicit flags, since constant buffers cannot be combined with other flags on all backends */
+            if (entry.isTexture)
+                entry.textureDesc.bindFlags |= access.bindFlags;
+            else if (entry.deriveBindFlags)
+                entry.bufferDesc.bindFlags |= access.bindFlags;
+        }
+    }
+
+    /* Assign physical resources in order of first use, so that resources with disjoint lifetimes share the same object */
+    std::vector<RenderGraphResource> sortedResources;
+    sortedResources.reserve(resources.size());
+
+    for_range(i, static_cast<RenderGraphResource>(resources.size()))
+    {
+        if (!resources[i].isImported)
+        {
+            resources[i].texture    = nullptr;
+            resources[i].buffer     = nullptr;
+            if (resources[i].firstUse != g_invalidIndex)
+                sortedResources.push_back(i);
+        }
+    }
+
+    std::stable_sort(
+        sortedResources.begin(),
+        sortedResources.end(),
+        [this](RenderGraphResource lhs, RenderGraphResource rhs)
+        {
+            return (resources[lhs].firstUse < resources[rhs].firstUse);
+        }
+    );
+
+    for (RenderGraphResource resource : sortedResources)
+    {
+        RenderGraphResourceEntry& entry = resources[resource];
+        if (entry.isTexture)
+            entry.texture = AcquireTexture(entry);
+        else
+            entry.buffer = AcquireBuffer(entry);
+    }
+}
+
+void RenderGraph::Pimpl::CreateRenderTargets()
+{
+    for (RenderGraphCachedTarget& target : targetCache)
+        target.used = false;
+
+    for_range(passIndex, static_cast<std::uint32_t>(passes.size()))
+    {
+        RenderGraphPassEntry& pass = passes[passIndex];
+
+        pass.renderPass     = nullptr;
+        pass.renderTarget   = nullptr;
+        pass.numClearValues = 0;
+
+        if (pass.culled || !pass.hasAttachments)
+            continue;
+
+        AcquireRenderTarget(pass);
+
+        /* Gather clear values in the order of attachments; the depth-stencil clear value comes last */
+        for (const RenderGraphAttachment& attachment : pass.colorAttachments)
+        {
+            if (attachment.resource == g_invalidIndex)
+                break;
+            if (attachment.clear)
+                pass.clearValues[pass.numClearValues++] = attachment.clearValue;
+        }
+
+        if (pass.depthStencilAttachment.resource != g_invalidIndex && pass.depthStencilAttachment.clear)
+            pass.clearValues[pass.numClearValues++] = pass.depthStencilAttachment.clearValue;
+    }
+}
+
+void RenderGraph::Pimpl::ReleaseUnusedResources()
+{
+    /* Release cached render targets first, since they might refer to pooled textures */
+    for (auto it = targetCache.begin(); it != targetCache.end();)
+    {
+        it->unusedCompiles = (it->used ? 0 : it->unusedCompiles + 1);
+        if (it->unusedCompiles >= g_maxUnusedCompiles)
+        {
+            renderSystem.Release(*it->renderTarget);
+            renderSystem.Release(*it->renderPass);
+            it = targetCache.erase(it);
+        }
+        else
+            ++it;
+    }
+
+    for (auto it = texturePool.begin(); it != texturePool.end();)
+    {
+        it->unusedCompiles = (it->used ? 0 : it->unusedCompiles + 1);
+        if (it->unusedCompiles >= g_maxUnusedCompiles)
+        {
+            ReleaseCachedTargets(it->texture);
+            renderSystem.Release(*it->texture);
+            it = texturePool.erase(it);
+        }
+        else
+            ++it;
+    }
+
+    for (auto it = bufferPool.begin(); it != bufferPool.end();)
+    {
+        it->unusedCompiles = (it->used ? 0 : it->unusedCompiles + 1);
+        if (it->unusedCompiles >= g_maxUnusedCompiles)
+        {
+            renderSystem.Release(*it->buffer);
+            it = bufferPool.erase(it);
+        }
+        else
+            ++it;
+    }
+}
+
+Texture* RenderGraph::Pimpl::AcquireTexture(const RenderGraphResourceEntry& entry)
+{
+    /* Find pooled texture that is compatible and not in use during the lifetime of this resource */
+    for (RenderGraphPooledTexture& pooled : texturePool)
+    {
+        if (pooled.exclusive || (pooled.busyUntil != g_invalidIndex && pooled.busyUntil >= entry.firstUse))
+            continue;
+        if (pooled.used && entry.isAsync)
+            continue;
+        if (!IsCompatibleTextureDesc(pooled.desc, entry.textureDesc))
+            continue;
+
+        /* Resources on the async compute queue are not aliased, since their lifetime is not ordered with the graphics queue */
+        pooled.busyUntil    = entry.lastUse;
+        pooled.exclusive    = entry.isAsync;
+        pooled.used         = true;
+        return pooled.texture;
+    }
+
+    /* Create new texture */
+    TextureDescriptor textureDesc = entry.textureDesc;
+    textureDesc.debugName = (entry.name.empty() ? nullptr : entry.name.c_str());
+
+    RenderGraphPooledTexture pooled;
+    {
+        pooled.desc         = entry.textureDesc;
+        pooled.desc.debugName = nullptr;
+        pooled.texture      = renderSystem.CreateTexture(textureDesc);
+        pooled.busyUntil    = entry.lastUse;
+        pooled.exclusive    = entry.isAsync;
+        pooled.used         = true;
+    }
+    texturePool.push_back(pooled);
+
+    return pooled.texture;
+}
+
+Buffer* RenderGraph::Pimpl::AcquireBuffer(const RenderGraphResourceEntry& entry)
+{
+    for (RenderGraphPooledBuffer& pooled : bufferPool)
+    {
+        if (pooled.exclusive || (pooled.busyUntil != g_invalidIndex && pooled.busyUntil >= entry.firstUse))
+            continue;
+        if (pooled.used && entry.isAsync)
+            continue;
+        if (!IsCompatibleBufferDesc(pooled.desc, entry.bufferDesc))
+            continue;
+
+        pooled.busyUntil    = entry.lastUse;
+        pooled.exclusive    = entry.isAsync;
+        pooled.used         = true;
+        return pooled.buffer;
+    }
+
+    /* Create new buffer */
+    BufferDescriptor bufferDesc = entry.bufferDesc;
+    bufferDesc.debugName = (entry.name.empty() ? nullptr : entry.name.c_str());
+
+    RenderGraphPooledBuffer pooled;
+    {
+        pooled.desc         = entry.bufferDesc;
+        pooled.desc.debugName = nullptr;
+        pooled.buffer       = renderSystem.CreateBuffer(bufferDesc);
+        pooled.busyUntil    = entry.lastUse;
+        pooled.exclusive    = entry.isAsync;
+        pooled.used         = true;
+    }
+    bufferPool.push_back(pooled);
+
+    return pooled.buffer;
+}
+
+void RenderGraph::Pimpl::AcquireRenderTarget(RenderGraphPassEntry& pass)
+{
+    const std::uint32_t passIndex = static_cast<std::uint32_t>(&pass - passes.data());
+
+    /* Derive render pass from attachments */
+    RenderGraphCachedTarget key;
+    Texture* anyTexture = nullptr;
+
+    for_range(i, LLGL_MAX_NUM_COLOR_ATTACHMENTS)
+    {
+        const RenderGraphAttachment& attachment = pass.colorAttachments[i];
+        if (attachment.resource == g_invalidIndex)
+            break;
+        key.colorTextures[i]                    = GetAttachmentTexture(attachment);
+        key.renderPassDesc.colorAttachments[i]  = GetAttachmentFormat(attachment, passIndex);
+        anyTexture = key.colorTextures[i];
+    }
+
+    if (pass.depthStencilAttachment.resource != g_invalidIndex)
+    {
+        key.depthStencilTexture = GetAttachmentTexture(pass.depthStencilAttachment);
+        const AttachmentFormatDescriptor attachmentFormat = GetAttachmentFormat(pass.depthStencilAttachment, passIndex);
+        if (IsDepthFormat(attachmentFormat.format))
+            key.renderPassDesc.depthAttachment = attachmentFormat;
+        if (IsStencilFormat(attachmentFormat.format))
+            key.renderPassDesc.stencilAttachment = attachmentFormat;
+        anyTexture = key.depthStencilTexture;
+    }
+
+    LLGL_ASSERT_PTR(anyTexture);
+    const TextureDescriptor textureDesc = anyTexture->GetDesc();
+    key.renderPassDesc.samples = textureDesc.samples;
+
+    /* Find cached render target with the same attachments */
+    for (RenderGraphCachedTarget& target : targetCache)
+    {
+        if (std::equal(std::begin(target.colorTextures), std::end(target.colorTextures), std::begin(key.colorTextures)) &&
+            target.depthStencilTexture == key.depthStencilTexture &&
+            IsEqualRenderPassDesc(target.renderPassDesc, key.renderPassDesc))
+        {
+            target.used         = true;
+            pass.renderPass     = target.renderPass;
+            pass.renderTarget   = target.renderTarget;
+            return;
+        }
+    }
+
+    /* Create new render pass and render target */
+    key.renderPassDesc.debugName = (pass.name.empty() ? nullptr : pass.name.c_str());
+    key.renderPass = renderSystem.CreateRenderPass(key.renderPassDesc);
+    key.renderPassDesc.debugName = nullptr;
+
+    RenderTargetDescriptor renderTargetDesc;
+    {
+        renderTargetDesc.debugName      = key.renderPassDesc.debugName;
+        renderTargetDesc.renderPass     = key.renderPass;
+        renderTargetDesc.resolution     = Extent2D{ textureDesc.extent.width, textureDesc.extent.height };
+        renderTargetDesc.samples        = textureDesc.samples;
+        for_range(i, LLGL_MAX_NUM_COLOR_ATTACHMENTS)
+        {
+            if (key.colorTextures[i] == nullptr)
+                break;
+            renderTargetDesc.colorAttachments[i] = key.colorTextures[i];
+        }
+        if (key.depthStencilTexture != nullptr)
+            renderTargetDesc.depthStencilAttachment = key.depthStencilTexture;
+    }
+    key.renderTarget    = renderSystem.CreateRenderTarget(renderTargetDesc);
+    key.used            = true;
+
+    pass.renderPass     = key.renderPass;
+    pass.renderTarget   = key.renderTarget;
+
+    targetCache.push_back(key);
+}
+
+void RenderGraph::Pimpl::ReleaseCachedTargets(const Texture* texture)
+{
+    for (auto it = targetCache.begin(); it != targetCache.end();)
+    {
+        if (it->depthStencilTexture == texture ||
+            std::find(std::begin(it->colorTextures), std::end(it->colorTextures), texture) != std::end(it->colorTextures))
+        {
+            renderSystem.Release(*it->renderTarget);
+            renderSystem.Release(*it->renderPass);
+            it = targetCache.erase(it);
+        }
+        else
+            ++it;
+    }
+}
+
+Texture* RenderGraph::Pimpl::GetAttachmentTexture(const RenderGraphAttachment& attachment)
+{
+    return resources[attachment.resource].texture;
+}
+
+AttachmentFormatDescriptor RenderGraph::Pimpl::GetAttachmentFormat(const RenderGraphAttachment& attachment, std::uint32_t passIndex)
+{
+    const RenderGraphResourceEntry& entry = resources[attachment.resource];
+
+    AttachmentFormatDescriptor attachmentFormat;
+    {
+        attachmentFormat.format = (entry.isImported ? entry.texture->GetFormat() : entry.textureDesc.format);
+
+        /* Previous content is only loaded if an earlier pass wrote to it or if the texture is accessible outside of the graph */
+        if (attachment.clear)
+            attachmentFormat.loadOp = AttachmentLoadOp::Clear;
+        else if (entry.isImported || entry.firstUse < passIndex)
+            attachmentFormat.loadOp = AttachmentLoadOp::Load;
+        else
+            attachmentFormat.loadOp = AttachmentLoadOp::Undefined;
+
+        /* Outcome is only stored if a later pass uses it or if the texture is accessible outside of the graph */
+        if (entry.isImported || entry.lastUse > passIndex)
+            attachmentFormat.storeOp = AttachmentStoreOp::Store;
+        else
+            attachmentFormat.storeOp = AttachmentStoreOp::Undefined;
+    }
+    return attachmentFormat;
+}
+
+void RenderGraph::Pimpl::RecordPass(CommandBuffer& commandBuffer, const RenderGraphPassEntry& pass)
+{
+    if (!pass.name.empty())
+        commandBuffer.PushDebugGroup(pass.name.c_str());
+
+    if (pass.renderTarget != nullptr)
+    {
+        commandBuffer.BeginRenderPass(*pass.renderTarget, pass.renderPass, pass.numClearValues, pass.clearValues);
+        {
+            if (pass.callback)
+                pass.callback(commandBuffer);
+        }
+        commandBuffer.EndRenderPass();
+    }
+    else if (pass.externalTarget != nullptr)
+    {
+        commandBuffer.BeginRenderPass(*pass.externalTarget);
+        {
+            if (pass.callback)
+                pass.callback(commandBuffer);
+        }
+        commandBuffer.EndRenderPass();
+    }
+    else if (pass.callback)
+        pass.callback(commandBuffer);
+
+    if (!pass.name.empty())
+        commandBuffer.PopDebugGroup();
+}
+
+bool RenderGraph::Pimpl::HaveSharedResources(const RenderGraphBatch& lhs, const RenderGraphBatch& rhs) const
+{
+    for (std::uint32_t lhsPassIndex = lhs.firstPass; lhsPassIndex < lhs.endPass; ++lhsPassIndex)
+    {
+        const RenderGraphPassEntry& lhsPass = passes[lhsPassIndex];
+        if (lhsPass.culled)
+            continue;
+
+        for (std::uint32_t rhsPassIndex = rhs.firstPass; rhsPassIndex < rhs.endPass; ++rhsPassIndex)
+        {
+            const RenderGraphPassEntry& rhsPass = passes[rhsPassIndex];
+            if (rhsPass.culled)
+                continue;
+
+            for (const RenderGraphAccess& lhsAccess : lhsPass.accesses)
+            {
+                for (const RenderGraphAccess& rhsAccess : rhsPass.accesses)
+                {
+                    /*
+                    Accesses conflict if they refer to the same resource and at least one of them writes to it.
+                    Physical objects are never shared with resources on the async compute queue, so comparing the handles is sufficient.
+                    */
+                    if (lhsAccess.resource == rhsAccess.resource && (lhsAccess.write || rhsAccess.write))
+                        return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+CommandBuffer* RenderGraph::Pimpl::GetBatchCommandBuffer(int queueIndex, std::size_t index)
+{
+    std::vector<CommandBuffer*>& cmdBuffers = commandBuffers[queueIndex];
+    while (cmdBuffers.size() <= index)
+    {
+        CommandBufferDescriptor cmdBufferDesc;
+        {
+            cmdBufferDesc.debugName     = (queueIndex == 0 ? "RenderGraph.Graphics" : "RenderGraph.Compute");
+            cmdBufferDesc.commandQueue  = queues[queueIndex];
+        }
+        cmdBuffers.push_back(renderSystem.CreateCommandBuffer(cmdBufferDesc));
+    }
+    return cmdBuffers[index];
+}
+
+
+/*
+ * RenderGraph class
+ */
+
+RenderGraph::RenderGraph(RenderSystem& renderSystem) :
+    pimpl_ { new Pimpl{ renderSystem } }
+{
+}
+
+RenderGraph::~RenderGraph()
+{
+    delete pimpl_;
+}
+
+/* ----- Resources ----- */
+
+RenderGraphResource RenderGraph::CreateTexture(const TextureDescriptor& textureDesc, const char* name)
+{
+    RenderGraphResourceEntry entry;
+    {
+        entry.name                  = (name != nullptr ? name : "");
+        entry.isTexture             = true;
+        entry.textureDesc           = textureDesc;
+        entry.textureDesc.debugName = nullptr;
+    }
+    pimpl_->resources.push_back(entry);
+    pimpl_->dirty = true;
+    return static_cast<RenderGraphResource>(pimpl_->resources.size() - 1);
+}
+
+RenderGraphResource RenderGraph::CreateBuffer(const BufferDescriptor& bufferDesc, const char* name)
+{
+    RenderGraphResourceEntry entry;
+    {
+        entry.name                  = (name != nullptr ? name : "");
+        entry.isTexture             = false;
+        entry.bufferDesc            = bufferDesc;
+        entry.bufferDesc.debugName  = nullptr;
+        entry.deriveBindFlags       = (bufferDesc.bindFlags == 0);
+    }
+    pimpl_->resources.push_back(entry);
+    pimpl_->dirty = true;
+    return static_cast<RenderGraphResource>(pimpl_->resources.size() - 1);
+}
+
+RenderGraphResource RenderGraph::ImportTexture(Texture& texture)
+{
+    RenderGraphResourceEntry entry;
+    {
+        entry.isTexture     = true;
+        entry.isImported    = true;
+        entry.texture       = &texture;
+    }
+    pimpl_->resources.push_back(entry);
+    pimpl_->dirty = true;
+    return static_cast<RenderGraphResource>(pimpl_->resources.size() - 1);
+}
+
+RenderGraphResource RenderGraph::ImportBuffer(Buffer& buffer)
+{
+    RenderGraphResourceEntry entry;
+    {
+        entry.isTexture     = false;
+        entry.isImported    = true;
+        entry.buffer        = &buffer;
+    }
+    pimpl_->resources.push_back(entry);
+    pimpl_->dirty = true;
+    return static_cast<RenderGraphResource>(pimpl_->resources.size() - 1);
+}
+
+/* ----- Passes ----- */
+
+RenderGraphPass RenderGraph::AddPass(const char* name, const RenderGraphPassCallback& callback, long flags)
+{
+    RenderGraphPassEntry entry;
+    {
+        entry.name      = (name != nullptr ? name : "");
+        entry.callback  = callback;
+        entry.flags     = flags;
+    }
+    pimpl_->passes.push_back(std::move(entry));
+    pimpl_->dirty = true;
+    return static_cast<RenderGraphPass>(pimpl_->passes.size() - 1);
+}
+
+void RenderGraph::Read(RenderGraphPass pass, RenderGraphResource resource)
+{
+    pimpl_->AddAccess(pass, resource, true, false, BindFlags::Sampled);
+}
+
+void RenderGraph::Write(RenderGraphPass pass, RenderGraphResource resource)
+{
+    /* Storage and copy writes can be partial, so the previous content is considered to be consumed as well */
+    pimpl_->AddAccess(pass, resource, true, true, BindFlags::Storage);
+}
+
+void RenderGraph::SetColorAttachment(RenderGraphPass pass, std::uint32_t index, RenderGraphResource resource, const ClearValue* clearValue)
+{
+    LLGL_ASSERT_UPPER_BOUND(index, LLGL_MAX_NUM_COLOR_ATTACHMENTS);
+    LLGL_ASSERT(pimpl_->GetResource(resource).isTexture, "render graph attachment must be a texture");
+
+    RenderGraphPassEntry& passEntry = pimpl_->GetPass(pass);
+    LLGL_ASSERT(passEntry.externalTarget == nullptr, "render graph pass cannot have both attachments and a render target");
+
+    RenderGraphAttachment& attachment = passEntry.colorAttachments[index];
+    {
+        attachment.resource = resource;
+        attachment.clear    = (clearValue != nullptr);
+        if (clearValue != nullptr)
+            attachment.clearValue = *clearValue;
+    }
+    passEntry.hasAttachments = true;
+
+    /* Cleared attachments do not depend on the previous content */
+    pimpl_->AddAccess(pass, resource, (clearValue == nullptr), true, BindFlags::ColorAttachment);
+}
+
+void RenderGraph::SetDepthStencilAttachment(RenderGraphPass pass, RenderGraphResource resource, const ClearValue* clearValue)
+{
+    LLGL_ASSERT(pimpl_->GetResource(resource).isTexture, "render graph attachment must be a texture");
+
+    RenderGraphPassEntry& passEntry = pimpl_->GetPass(pass);
+    LLGL_ASSERT(passEntry.externalTarget == nullptr, "render graph pass cannot have both attachments and a render target");
+
+    RenderGraphAttachment& attachment = passEntry.depthStencilAttachment;
+    {
+        attachment.resource = resource;
+        attachment.clear    = (clearValue != nullptr);
+        if (clearValue != nullptr)
+            attachment.clearValue = *clearValue;
+    }
+    passEntry.hasAttachments = true;
+
+    pimpl_->AddAccess(pass, resource, (clearValue == nullptr), true, BindFlags::DepthStencilAttachment);
+}
+
+void RenderGraph::SetRenderTarget(RenderGraphPass pass, RenderTarget& renderTarget)
+{
+    RenderGraphPassEntry& passEntry = pimpl_->GetPass(pass);
+    LLGL_ASSERT(!passEntry.hasAttachments, "render graph pass cannot have both attachments and a render target");
+    passEntry.externalTarget = &renderTarget;
+    pimpl_->dirty = true;
+}
+
+/* ----- Execution ----- */
+
+void RenderGraph::Compile()
+{
+    pimpl_->CullPasses();
+    pimpl_->DetermineLifetimes();
+    pimpl_->AllocateTransientResources();
+    pimpl_->CreateRenderTargets();
+    pimpl_->ReleaseUnusedResources();
+    pimpl_->dirty = false;
+}
+
+void RenderGraph::Execute()
+{
+    if (pimpl_->dirty)
+        Compile();
+
+    Pimpl& self = *pimpl_;
+
+    /* Initialize command queues and fences on first use */
+    if (self.queues[0] == nullptr)
+    {
+        self.queues[0] = self.renderSystem.GetCommandQueue();
+        self.queues[1] = self.renderSystem.GetCommandQueue(CommandQueueFlags::Compute);
+        self.fences[0] = self.renderSystem.CreateFence();
+        if (self.queues[1] != self.queues[0])
+            self.fences[1] = self.renderSystem.CreateFence();
+    }
+
+    /* Split passes into batches of consecutive passes on the same queue */
+    std::vector<RenderGraphBatch> batches;
+    for_range(passIndex, static_cast<std::uint32_t>(self.passes.size()))
+    {
+        const RenderGraphPassEntry& pass = self.passes[passIndex];
+        if (pass.culled)
+            continue;
+
+        const int queueIndex = (pass.async ? 1 : 0);
+        if (batches.empty() || batches.back().queueIndex != queueIndex)
+            batches.push_back(RenderGraphBatch{ passIndex, passIndex + 1, queueIndex });
+        else
+            batches.back().endPass = passIndex + 1;
+    }
+
+    /* Record and submit batches and let them wait for those batches on the other queue they depend on */
+    const std::uint64_t prevGraphicsValue = self.fenceValues[0];
+    std::vector<std::uint64_t> batchValues(batches.size(), 0);
+    std::uint64_t waitedValues[2] = { 0, 0 };
+    std::size_t numBatchesPerQueue[2] = { 0, 0 };
+    bool anyComputeBatch = false;
+
+    for_range(batchIndex, batches.size())
+    {
+        const RenderGraphBatch& batch = batches[batchIndex];
+        const int queueIndex = batch.queueIndex;
+        const int otherQueueIndex = 1 - queueIndex;
+        CommandQueue* queue = self.queues[queueIndex];
+
+        if (queueIndex == 1 && !anyComputeBatch)
+        {
+            /* Don't overwrite transient resources while the previous frame is still using them on the graphics queue */
+            anyComputeBatch = true;
+            if (prevGraphicsValue > 0)
+            {
+                queue->SubmitWait(*self.fences[0], prevGraphicsValue);
+                waitedValues[0] = prevGraphicsValue;
+            }
+        }
+
+        for (std::size_t prevIndex = batchIndex; prevIndex-- > 0;)
+        {
+            const RenderGraphBatch& prevBatch = batches[prevIndex];
+            if (prevBatch.queueIndex != otherQueueIndex || batchValues[prevIndex] <= waitedValues[otherQueueIndex])
+                continue;
+            if (self.HaveSharedResources(prevBatch, batch))
+            {
+                queue->SubmitWait(*self.fences[otherQueueIndex], batchValues[prevIndex]);
+                waitedValues[otherQueueIndex] = batchValues[prevIndex];
+                break;
+            }
+        }
+
+        CommandBuffer* cmdBuffer = self.GetBatchCommandBuffer(queueIndex, numBatchesPerQueue[queueIndex]++);
+        cmdBuffer->Begin();
+        {
+            for (std::uint32_t passIndex = batch.firstPass; passIndex < batch.endPass; ++passIndex)
+            {
+                if (!self.passes[passIndex].culled)
+                    self.RecordPass(*cmdBuffer, self.passes[passIndex]);
+            }
+        }
+        cmdBuffer->End();
+        queue->Submit(*cmdBuffer);
+
+        batchValues[batchIndex] = ++self.fenceValues[queueIndex];
+        queue->Submit(*self.fences[queueIndex], batchValues[batchIndex]);
+    }
+
+    /* Join the compute queue back into the graphics queue, so subsequent work on the graphics queue sees all results of this graph */
+    if (anyComputeBatch && self.fenceValues[1] > waitedValues[1])
+    {
+        self.queues[0]->SubmitWait(*self.fences[1], self.fenceValues[1]);
+        self.queues[0]->Submit(*self.fences[0], ++self.fenceValues[0]);
+    }
+}
+
+void RenderGraph::Execute(CommandBuffer& commandBuffer)
+{
+    if (pimpl_->dirty)
+        Compile();
+
+    for (const RenderGraphPassEntry& pass : pimpl_->passes)
+    {
+        if (!pass.culled)
+            pimpl_->RecordPass(commandBuffer, pass);
+    }
+}
+
+void RenderGraph::Reset()
+{
+    pimpl_->resources.clear();
+    pimpl_->passes.clear();
+    pimpl_->dirty = true;
+}
+
+Texture* RenderGraph::GetTexture(RenderGraphResource resource) const
+{
+    return (resource < pimpl_->resources.size() ? pimpl_->resources[resource].texture : nullptr);
+}
+
+Buffer* RenderGraph::GetBuffer(RenderGraphResource resource) const
+{
+    return (resource < pimpl_->resources.size() ? pimpl_->resources[resource].buffer : nullptr);
+}
+
+const RenderPass* RenderGraph::GetRenderPass(RenderGraphPass pass) const
+{
+    return (pass < pimpl_->passes.size() ? pimpl_->passes[pass].renderPass : nullptr);
+}
+
+bool RenderGraph::IsPassCulled(RenderGraphPass pass) const
+{
+    return (pass < pimpl_->passes.size() && pimpl_->passes[pass].culled);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -64,6 +64,13 @@ LLGL_EXPORT std::vector<char> ReadFileBuffer(const char* filename)
     return {};
 }
 
+LLGL_EXPORT Blob ReadFileMapped(const char* filename)
+{
+    /* Map file content into memory */
+    const UTF8String path = GetPlatformAppropriateFilename(filename);
+    return Blob::CreateFromFileMapped(path.c_str());
+}
+
 LLGL_EXPORT std::string ToUTF8String(const std::wstring& utf16)
 {
     return std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>>{}.to_bytes(utf16);
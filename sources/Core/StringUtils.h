@@ -12,6 +12,7 @@
 #include <LLGL/Export.h>
 #include <LLGL/Container/ArrayView.h>
 #include <LLGL/Container/UTF8String.h>
+#include <LLGL/Blob.h>
 #include "Exception.h"
 #include <string>
 #include <vector>
@@ -118,6 +119,9 @@ LLGL_EXPORT std::string ReadFileString(const char* filename);
 // Reads the specified binary file into a buffer.
 LLGL_EXPORT std::vector<char> ReadFileBuffer(const char* filename);
 
+// Maps the specified binary file into read-only memory without copying its content. Returns an empty blob on failure.
+LLGL_EXPORT Blob ReadFileMapped(const char* filename);
+
 // Converts the UTF16 input string to UTF8 string.
 LLGL_EXPORT std::string ToUTF8String(const std::wstring& utf16);
 LLGL_EXPORT std::string ToUTF8String(const wchar_t* utf16);
@@ -0,0 +1,733 @@
+/*
+ * TextureContainer.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Utils/TextureContainer.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/Format.h>
+#include <LLGL/Report.h>
+#include <LLGL/Utils/ForRange.h>
+#include <vector>
+#include <algorithm>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+/*
+ * Internal structures
+ */
+
+// DDS_PIXELFORMAT structure
+struct DDSPixelFormat
+{
+    std::uint32_t size;
+    std::uint32_t flags;
+    std::uint32_t fourCC;
+    std::uint32_t rgbBitCount;
+    std::uint32_t rBitMask;
+    std::uint32_t gBitMask;
+    std::uint32_t bBitMask;
+    std::uint32_t aBitMask;
+};
+
+// DDS_HEADER structure
+struct DDSHeader
+{
+    std::uint32_t   size;
+    std::uint32_t   flags;
+    std::uint32_t   height;
+    std::uint32_t   width;
+    std::uint32_t   pitchOrLinearSize;
+    std::uint32_t   depth;
+    std::uint32_t   mipMapCount;
+    std::uint32_t   reserved1[11];
+    DDSPixelFormat  pixelFormat;
+    std::uint32_t   caps;
+    std::uint32_t   caps2;
+    std::uint32_t   caps3;
+    std::uint32_t   caps4;
+    std::uint32_t   reserved2;
+};
+
+// DDS_HEADER_DXT10 structure
+struct DDSHeaderDX10
+{
+    std::uint32_t dxgiFormat;
+    std::uint32_t resourceDimension;
+    std::uint32_t miscFlag;
+    std::uint32_t arraySize;
+    std::uint32_t miscFlags2;
+};
+
+// KTX2 header including the index of data format descriptor, key/value data, and supercompression global data.
+struct KTX2Header
+{
+    std::uint8_t    identifier[12];
+    std::uint32_t   vkFormat;
+    std::uint32_t   typeSize;
+    std::uint32_t   pixelWidth;
+    std::uint32_t   pixelHeight;
+    std::uint32_t   pixelDepth;
+    std::uint32_t   layerCount;
+    std::uint32_t   faceCount;
+    std::uint32_t   levelCount;
+    std::uint32_t   supercompressionScheme;
+    std::uint32_t   dfdByteOffset;
+    std::uint32_t   dfdByteLength;
+    std::uint32_t   kvdByteOffset;
+    std::uint32_t   kvdByteLength;
+    std::uint64_t   sgdByteOffset;
+    std::uint64_t   sgdByteLength;
+};
+
+// KTX2 level index entry
+struct KTX2LevelIndex
+{
+    std::uint64_t byteOffset;
+    std::uint64_t byteLength;
+    std::uint64_t uncompressedByteLength;
+};
+
+static_assert(sizeof(DDSHeader) == 124, "DDSHeader must be 124 bytes");
+static_assert(sizeof(DDSHeaderDX10) == 20, "DDSHeaderDX10 must be 20 bytes");
+static_assert(sizeof(KTX2Header) == 80, "KTX2Header must be 80 bytes");
+static_assert(sizeof(KTX2LevelIndex) == 24, "KTX2LevelIndex must be 24 bytes");
+
+static constexpr std::uint32_t MakeFourCC(char a, char b, char c, char d)
+{
+    return
+    (
+        (static_cast<std::uint32_t>(static_cast<std::uint8_t>(a))      ) |
+        (static_cast<std::uint32_t>(static_cast<std::uint8_t>(b)) <<  8) |
+        (static_cast<std::uint32_t>(static_cast<std::uint8_t>(c)) << 16) |
+        (static_cast<std::uint32_t>(static_cast<std::uint8_t>(d)) << 24)
+    );
+}
+
+static constexpr std::uint32_t  g_ddsMagic                  = MakeFourCC('D', 'D', 'S', ' ');
+static constexpr std::uint32_t  g_ddsPixelFormatAlpha       = 0x00000002; // DDPF_ALPHA
+static constexpr std::uint32_t  g_ddsPixelFormatFourCC      = 0x00000004; // DDPF_FOURCC
+static constexpr std::uint32_t  g_ddsPixelFormatRGB         = 0x00000040; // DDPF_RGB
+static constexpr std::uint32_t  g_ddsPixelFormatLuminance   = 0x00020000; // DDPF_LUMINANCE
+static constexpr std::uint32_t  g_ddsCaps2Cubemap           = 0x00000200; // DDSCAPS2_CUBEMAP
+static constexpr std::uint32_t  g_ddsCaps2Volume            = 0x00200000; // DDSCAPS2_VOLUME
+static constexpr std::uint32_t  g_ddsDimensionTexture1D     = 2;          // D3D10_RESOURCE_DIMENSION_TEXTURE1D
+static constexpr std::uint32_t  g_ddsDimensionTexture3D     = 4;          // D3D10_RESOURCE_DIMENSION_TEXTURE3D
+static constexpr std::uint32_t  g_ddsMiscTextureCube        = 0x00000004; // D3D10_RESOURCE_MISC_TEXTURECUBE
+
+static const std::uint8_t       g_ktx2Identifier[12]        = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+
+// Reads a structure at the specified offset of the blob. Returns false if the blob is too small.
+template <typename T>
+static bool ReadBlobStruct(const Blob& blob, std::size_t offset, T& outValue)
+{
+    if (offset > blob.GetSize() || blob.GetSize() - offset < sizeof(T))
+        return false;
+    std::memcpy(&outValue, static_cast<const char*>(blob.GetData()) + offset, sizeof(T));
+    return true;
+}
+
+// Returns the size (in bytes) of a single image with the specified extent, including the padding of partial blocks.
+static std::size_t GetImageSize(const Format format, const Extent3D& extent)
+{
+    const FormatAttributes& formatAttribs = GetFormatAttribs(format);
+    if (formatAttribs.blockWidth == 0 || formatAttribs.blockHeight == 0)
+        return 0;
+    const std::size_t numBlocksX = (extent.width  + formatAttribs.blockWidth  - 1) / formatAttribs.blockWidth;
+    const std::size_t numBlocksY = (extent.height + formatAttribs.blockHeight - 1) / formatAttribs.blockHeight;
+    return (numBlocksX * numBlocksY * extent.depth * formatAttribs.bitSize / 8);
+}
+
+// Maps the specified DXGI_FORMAT value to an LLGL format. The values are declared in dxgiformat.h.
+static Format DXGIFormatToFormat(std::uint32_t dxgiFormat)
+{
+    switch (dxgiFormat)
+    {
+        case  2: return Format::RGBA32Float;        // DXGI_FORMAT_R32G32B32A32_FLOAT
+        case  3: return Format::RGBA32UInt;         // DXGI_FORMAT_R32G32B32A32_UINT
+        case  4: return Format::RGBA32SInt;         // DXGI_FORMAT_R32G32B32A32_SINT
+        case  6: return Format::RGB32Float;         // DXGI_FORMAT_R32G32B32_FLOAT
+        case  7: return Format::RGB32UInt;          // DXGI_FORMAT_R32G32B32_UINT
+        case  8: return Format::RGB32SInt;          // DXGI_FORMAT_R32G32B32_SINT
+        case 10: return Format::RGBA16Float;        // DXGI_FORMAT_R16G16B16A16_FLOAT
+        case 11: return Format::RGBA16UNorm;        // DXGI_FORMAT_R16G16B16A16_UNORM
+        case 12: return Format::RGBA16UInt;         // DXGI_FORMAT_R16G16B16A16_UINT
+        case 13: return Format::RGBA16SNorm;        // DXGI_FORMAT_R16G16B16A16_SNORM
+        case 14: return Format::RGBA16SInt;         // DXGI_FORMAT_R16G16B16A16_SINT
+        case 16: return Format::RG32Float;          // DXGI_FORMAT_R32G32_FLOAT
+        case 17: return Format::RG32UInt;           // DXGI_FORMAT_R32G32_UINT
+        case 18: return Format::RG32SInt;           // DXGI_FORMAT_R32G32_SINT
+        case 20: return Format::D32FloatS8X24UInt;  // DXGI_FORMAT_D32_FLOAT_S8X24_UINT
+        case 24: return Format::RGB10A2UNorm;       // DXGI_FORMAT_R10G10B10A2_UNORM
+        case 25: return Format::RGB10A2UInt;        // DXGI_FORMAT_R10G10B10A2_UINT
+        case 26: return Format::RG11B10Float;       // DXGI_FORMAT_R11G11B10_FLOAT
+        case 28: return Format::RGBA8UNorm;         // DXGI_FORMAT_R8G8B8A8_UNORM
+        case 29: return Format::RGBA8UNorm_sRGB;    // DXGI_FORMAT_R8G8B8A8_UNORM_SRGB
+        case 30: return Format::RGBA8UInt;          // DXGI_FORMAT_R8G8B8A8_UINT
+        case 31: return Format::RGBA8SNorm;         // DXGI_FORMAT_R8G8B8A8_SNORM
+        case 32: return Format::RGBA8SInt;          // DXGI_FORMAT_R8G8B8A8_SINT
+        case 34: return Format::RG16Float;          // DXGI_FORMAT_R16G16_FLOAT
+        case 35: return Format::RG16UNorm;          // DXGI_FORMAT_R16G16_UNORM
+        case 36: return Format::RG16UInt;           // DXGI_FORMAT_R16G16_UINT
+        case 37: return Format::RG16SNorm;          // DXGI_FORMAT_R16G16_SNORM
+        case 38: return Format::RG16SInt;           // DXGI_FORMAT_R16G16_SINT
+        case 40: return Format::D32Float;           // DXGI_FORMAT_D32_FLOAT
+        case 41: return Format::R32Float;           // DXGI_FORMAT_R32_FLOAT
+        case 42: return Format::R32UInt;            // DXGI_FORMAT_R32_UINT
+        case 43: return Format::R32SInt;            // DXGI_FORMAT_R32_SINT
+        case 45: return Format::D24UNormS8UInt;     // DXGI_FORMAT_D24_UNORM_S8_UINT
+        case 49: return Format::RG8UNorm;           // DXGI_FORMAT_R8G8_UNORM
+        case 50: return Format::RG8UInt;            // DXGI_FORMAT_R8G8_UINT
+        case 51: return Format::RG8SNorm;           // DXGI_FORMAT_R8G8_SNORM
+        case 52: return Format::RG8SInt;            // DXGI_FORMAT_R8G8_SINT
+        case 54: return Format::R16Float;           // DXGI_FORMAT_R16_FLOAT
+        case 55: return Format::D16UNorm;           // DXGI_FORMAT_D16_UNORM
+        case 56: return Format::R16UNorm;           // DXGI_FORMAT_R16_UNORM
+        case 57: return Format::R16UInt;            // DXGI_FORMAT_R16_UINT
+        case 58: return Format::R16SNorm;           // DXGI_FORMAT_R16_SNORM
+        case 59: return Format::R16SInt;            // DXGI_FORMAT_R16_SINT
+        case 61: return Format::R8UNorm;            // DXGI_FORMAT_R8_UNORM
+        case 62: return Format::R8UInt;             // DXGI_FORMAT_R8_UINT
+        case 63: return Format::R8SNorm;            // DXGI_FORMAT_R8_SNORM
+        case 64: return Format::R8SInt;             // DXGI_FORMAT_R8_SINT
+        case 65: return Format::A8UNorm;            // DXGI_FORMAT_A8_UNORM
+        case 67: return Format::RGB9E5Float;        // DXGI_FORMAT_R9G9B9E5_SHAREDEXP
+        case 71: return Format::BC1UNorm;           // DXGI_FORMAT_BC1_UNORM
+        case 72: return Format::BC1UNorm_sRGB;      // DXGI_FORMAT_BC1_UNORM_SRGB
+        case 74: return Format::BC2UNorm;           // DXGI_FORMAT_BC2_UNORM
+        case 75: return Format::BC2UNorm_sRGB;      // DXGI_FORMAT_BC2_UNORM_SRGB
+        case 77: return Format::BC3UNorm;           // DXGI_FORMAT_BC3_UNORM
+        case 78: return Format::BC3UNorm_sRGB;      // DXGI_FORMAT_BC3_UNORM_SRGB
+        case 80: return Format::BC4UNorm;           // DXGI_FORMAT_BC4_UNORM
+        case 81: return Format::BC4SNorm;           // DXGI_FORMAT_BC4_SNORM
+        case 83: return Format::BC5UNorm;           // DXGI_FORMAT_BC5_UNORM
+        case 84: return Format::BC5SNorm;           // DXGI_FORMAT_BC5_SNORM
+        case 87: return Format::BGRA8UNorm;         // DXGI_FORMAT_B8G8R8A8_UNORM
+        case 91: return Format::BGRA8UNorm_sRGB;    // DXGI_FORMAT_B8G8R8A8_UNORM_SRGB
+        default: return Format::Undefined;
+    }
+}
+
+// Maps the pixel format of a DDS file without DX10 header to an LLGL format.
+static Format DDSPixelFormatToFormat(const DDSPixelFormat& pixelFormat)
+{
+    if ((pixelFormat.flags & g_ddsPixelFormatFourCC) != 0)
+    {
+        switch (pixelFormat.fourCC)
+        {
+            case MakeFourCC('D', 'X', 'T', '1'): return Format::BC1UNorm;
+            case MakeFourCC('D', 'X', 'T', '2'): return Format::BC2UNorm;
+            case MakeFourCC('D', 'X', 'T', '3'): return Format::BC2UNorm;
+            case MakeFourCC('D', 'X', 'T', '4'): return Format::BC3UNorm;
+            case MakeFourCC('D', 'X', 'T', '5'): return Format::BC3UNorm;
+            case MakeFourCC('A', 'T', 'I', '1'): return Format::BC4UNorm;
+            case MakeFourCC('B', 'C', '4', 'U'): return Format::BC4UNorm;
+            case MakeFourCC('B', 'C', '4', 'S'): return Format::BC4SNorm;
+            case MakeFourCC('A', 'T', 'I', '2'): return Format::BC5UNorm;
+            case MakeFourCC('B', 'C', '5', 'U'): return Format::BC5UNorm;
+            case MakeFourCC('B', 'C', '5', 'S'): return Format::BC5SNorm;
+            case  36: return Format::RGBA16UNorm;   // D3DFMT_A16B16G16R16
+            case 110: return Format::RGBA16SNorm;   // D3DFMT_Q16W16V16U16
+            case 111: return Format::R16Float;      // D3DFMT_R16F
+            case 112: return Format::RG16Float;     // D3DFMT_G16R16F
+            case 113: return Format::RGBA16Float;   // D3DFMT_A16B16G16R16F
+            case 114: return Format::R32Float;      // D3DFMT_R32F
+            case 115: return Format::RG32Float;     // D3DFMT_G32R32F
+            case 116: return Format::RGBA32Float;   // D3DFMT_A32B32G32R32F
+            default:  return Format::Undefined;
+        }
+    }
+
+    if ((pixelFormat.flags & g_ddsPixelFormatRGB) != 0 && pixelFormat.rgbBitCount == 32)
+    {
+        if (pixelFormat.rBitMask == 0x000000FF && pixelFormat.gBitMask == 0x0000FF00 && pixelFormat.bBitMask == 0x00FF0000)
+            return Format::RGBA8UNorm;
+        if (pixelFormat.rBitMask == 0x00FF0000 && pixelFormat.gBitMask == 0x0000FF00 && pixelFormat.bBitMask == 0x000000FF)
+            return Format::BGRA8UNorm;
+        if (pixelFormat.rBitMask == 0x0000FFFF && pixelFormat.gBitMask == 0xFFFF0000)
+            return Format::RG16UNorm;
+        if (pixelFormat.rBitMask == 0x000003FF && pixelFormat.gBitMask == 0x000FFC00 && pixelFormat.bBitMask == 0x3FF00000)
+            return Format::RGB10A2UNorm;
+        if (pixelFormat.rBitMask == 0xFFFFFFFF)
+            return Format::R32Float;
+    }
+
+    if ((pixelFormat.flags & g_ddsPixelFormatLuminance) != 0)
+    {
+        if (pixelFormat.rgbBitCount == 8 && pixelFormat.rBitMask == 0x000000FF)
+            return Format::R8UNorm;
+        if (pixelFormat.rgbBitCount == 16 && pixelFormat.rBitMask == 0x0000FFFF)
+            return Format::R16UNorm;
+        if (pixelFormat.rgbBitCount == 16 && pixelFormat.rBitMask == 0x000000FF && pixelFormat.aBitMask == 0x0000FF00)
+            return Format::RG8UNorm;
+    }
+
+    if ((pixelFormat.flags & g_ddsPixelFormatAlpha) != 0 && pixelFormat.rgbBitCount == 8)
+        return Format::A8UNorm;
+
+    return Format::Undefined;
+}
+
+// Maps the specified VkFormat value to an LLGL format. The values are declared in vulkan_core.h.
+static Format VkFormatToFormat(std::uint32_t vkFormat)
+{
+    switch (vkFormat)
+    {
+        case   9: return Format::R8UNorm;           // VK_FORMAT_R8_UNORM
+        case  10: return Format::R8SNorm;           // VK_FORMAT_R8_SNORM
+        case  13: return Format::R8UInt;            // VK_FORMAT_R8_UINT
+        case  14: return Format::R8SInt;            // VK_FORMAT_R8_SINT
+        case  16: return Format::RG8UNorm;          // VK_FORMAT_R8G8_UNORM
+        case  17: return Format::RG8SNorm;          // VK_FORMAT_R8G8_SNORM
+        case  20: return Format::RG8UInt;           // VK_FORMAT_R8G8_UINT
+        case  21: return Format::RG8SInt;           // VK_FORMAT_R8G8_SINT
+        case  23: return Format::RGB8UNorm;         // VK_FORMAT_R8G8B8_UNORM
+        case  24: return Format::RGB8SNorm;         // VK_FORMAT_R8G8B8_SNORM
+        case  27: return Format::RGB8UInt;          // VK_FORMAT_R8G8B8_UINT
+        case  28: return Format::RGB8SInt;          // VK_FORMAT_R8G8B8_SINT
+        case  29: return Format::RGB8UNorm_sRGB;    // VK_FORMAT_R8G8B8_SRGB
+        case  37: return Format::RGBA8UNorm;        // VK_FORMAT_R8G8B8A8_UNORM
+        case  38: return Format::RGBA8SNorm;        // VK_FORMAT_R8G8B8A8_SNORM
+        case  41: return Format::RGBA8UInt;         // VK_FORMAT_R8G8B8A8_UINT
+        case  42: return Format::RGBA8SInt;         // VK_FORMAT_R8G8B8A8_SINT
+        case  43: return Format::RGBA8UNorm_sRGB;   // VK_FORMAT_R8G8B8A8_SRGB
+        case  44: return Format::BGRA8UNorm;        // VK_FORMAT_B8G8R8A8_UNORM
+        case  45: return Format::BGRA8SNorm;        // VK_FORMAT_B8G8R8A8_SNORM
+        case  48: return Format::BGRA8UInt;         // VK_FORMAT_B8G8R8A8_UINT
+        case  49: return Format::BGRA8SInt;         // VK_FORMAT_B8G8R8A8_SINT
+        case  50: return Format::BGRA8UNorm_sRGB;   // VK_FORMAT_B8G8R8A8_SRGB
+        case  64: return Format::RGB10A2UNorm;      // VK_FORMAT_A2B10G10R10_UNORM_PACK32
+        case  68: return Format::RGB10A2UInt;       // VK_FORMAT_A2B10G10R10_UINT_PACK32
+        case  70: return Format::R16UNorm;          // VK_FORMAT_R16_UNORM
+        case  71: return Format::R16SNorm;          // VK_FORMAT_R16_SNORM
+        case  74: return Format::R16UInt;           // VK_FORMAT_R16_UINT
+        case  75: return Format::R16SInt;           // VK_FORMAT_R16_SINT
+        case  76: return Format::R16Float;          // VK_FORMAT_R16_SFLOAT
+        case  77: return Format::RG16UNorm;         // VK_FORMAT_R16G16_UNORM
+        case  78: return Format::RG16SNorm;         // VK_FORMAT_R16G16_SNORM
+        case  81: return Format::RG16UInt;          // VK_FORMAT_R16G16_UINT
+        case  82: return Format::RG16SInt;          // VK_FORMAT_R16G16_SINT
+        case  83: return Format::RG16Float;         // VK_FORMAT_R16G16_SFLOAT
+        case  84: return Format::RGB16UNorm;        // VK_FORMAT_R16G16B16_UNORM
+        case  85: return Format::RGB16SNorm;        // VK_FORMAT_R16G16B16_SNORM
+        case  88: return Format::RGB16UInt;         // VK_FORMAT_R16G16B16_UINT
+        case  89: return Format::RGB16SInt;         // VK_FORMAT_R16G16B16_SINT
+        case  90: return Format::RGB16Float;        // VK_FORMAT_R16G16B16_SFLOAT
+        case  91: return Format::RGBA16UNorm;       // VK_FORMAT_R16G16B16A16_UNORM
+        case  92: return Format::RGBA16SNorm;       // VK_FORMAT_R16G16B16A16_SNORM
+        case  95: return Format::RGBA16UInt;        // VK_FORMAT_R16G16B16A16_UINT
+        case  96: return Format::RGBA16SInt;        // VK_FORMAT_R16G16B16A16_SINT
+        case  97: return Format::RGBA16Float;       // VK_FORMAT_R16G16B16A16_SFLOAT
+        case  98: return Format::R32UInt;           // VK_FORMAT_R32_UINT
+        case  99: return Format::R32SInt;           // VK_FORMAT_R32_SINT
+        case 100: return Format::R32Float;          // VK_FORMAT_R32_SFLOAT
+        case 101: return Format::RG32UInt;          // VK_FORMAT_R32G32_UINT
+        case 102: return Format::RG32SInt;          // VK_FORMAT_R32G32_SINT
+        case 103: return Format::RG32Float;         // VK_FORMAT_R32G32_SFLOAT
+        case 104: return Format::RGB32UInt;         // VK_FORMAT_R32G32B32_UINT
+        case 105: return Format::RGB32SInt;         // VK_FORMAT_R32G32B32_SINT
+        case 106: return Format::RGB32Float;        // VK_FORMAT_R32G32B32_SFLOAT
+        case 107: return Format::RGBA32UInt;        // VK_FORMAT_R32G32B32A32_UINT
+        case 108: return Format::RGBA32SInt;        // VK_FORMAT_R32G32B32A32_SINT
+        case 109: return Format::RGBA32Float;       // VK_FORMAT_R32G32B32A32_SFLOAT
+        case 112: return Format::R64Float;          // VK_FORMAT_R64_SFLOAT
+        case 115: return Format::RG64Float;         // VK_FORMAT_R64G64_SFLOAT
+        case 118: return Format::RGB64Float;        // VK_FORMAT_R64G64B64_SFLOAT
+        case 121: return Format::RGBA64Float;       // VK_FORMAT_R64G64B64A64_SFLOAT
+        case 122: return Format::RG11B10Float;      // VK_FORMAT_B10G11R11_UFLOAT_PACK32
+        case 123: return Format::RGB9E5Float;       // VK_FORMAT_E5B9G9R9_UFLOAT_PACK32
+        case 124: return Format::D16UNorm;          // VK_FORMAT_D16_UNORM
+        case 126: return Format::D32Float;          // VK_FORMAT_D32_SFLOAT
+        case 129: return Format::D24UNormS8UInt;    // VK_FORMAT_D24_UNORM_S8_UINT
+        case 130: return Format::D32FloatS8X24UInt; // VK_FORMAT_D32_SFLOAT_S8_UINT
+        case 131: return Format::BC1UNorm;          // VK_FORMAT_BC1_RGB_UNORM_BLOCK
+        case 132: return Format::BC1UNorm_sRGB;     // VK_FORMAT_BC1_RGB_SRGB_BLOCK
+        case 133: return Format::BC1UNorm;          // VK_FORMAT_BC1_RGBA_UNORM_BLOCK
+        case 134: return Format::BC1UNorm_sRGB;     // VK_FORMAT_BC1_RGBA_SRGB_BLOCK
+        case 135: return Format::BC2UNorm;          // VK_FORMAT_BC2_UNORM_BLOCK
+        case 136: return Format::BC2UNorm_sRGB;     // VK_FORMAT_BC2_SRGB_BLOCK
+        case 137: return Format::BC3UNorm;          // VK_FORMAT_BC3_UNORM_BLOCK
+        case 138: return Format::BC3UNorm_sRGB;     // VK_FORMAT_BC3_SRGB_BLOCK
+        case 139: return Format::BC4UNorm;          // VK_FORMAT_BC4_UNORM_BLOCK
+        case 140: return Format::BC4SNorm;          // VK_FORMAT_BC4_SNORM_BLOCK
+        case 141: return Format::BC5UNorm;          // VK_FORMAT_BC5_UNORM_BLOCK
+        case 142: return Format::BC5SNorm;          // VK_FORMAT_BC5_SNORM_BLOCK
+        default:  return Format::Undefined;
+    }
+}
+
+static const char* GetKTX2SupercompressionName(std::uint32_t scheme)
+{
+    switch (scheme)
+    {
+        case 1:  return "BasisLZ";
+        case 2:  return "Zstandard";
+        case 3:  return "ZLIB";
+        default: return "unknown";
+    }
+}
+
+struct TextureContainer::Pimpl
+{
+    // Resets the container to its empty state.
+    void Clear();
+
+    bool LoadDDS(Report* report);
+    bool LoadKTX2(Report* report);
+
+    // Appends an image for the specified subresource at the specified offset of the blob. Returns false if the image exceeds the blob.
+    bool AppendImage(std::uint32_t mipLevel, std::uint32_t baseArrayLayer, std::uint32_t numArrayLayers, std::uint64_t offset, std::size_t size);
+
+    Blob                                blob;
+    TextureContainerFormat              containerFormat = TextureContainerFormat::Undefined;
+    TextureDescriptor                   textureDesc;
+    std::vector<TextureContainerImage>  images;
+};
+
+void TextureContainer::Pimpl::Clear()
+{
+    blob            = Blob{};
+    containerFormat = TextureContainerFormat::Undefined;
+    textureDesc     = TextureDescriptor{};
+    images.clear();
+}
+
+bool TextureContainer::Pimpl::AppendImage(
+    std::uint32_t   mipLevel,
+    std::uint32_t   baseArrayLayer,
+    std::uint32_t   numArrayLayers,
+    std::uint64_t   offset,
+    std::size_t     size)
+{
+    if (size == 0 || offset > blob.GetSize() || blob.GetSize() - offset < size)
+        return false;
+
+    const FormatAttributes& formatAttribs = GetFormatAttribs(textureDesc.format);
+    const Extent3D mipExtent = GetMipExtent(textureDesc.type, textureDesc.extent, mipLevel);
+
+    TextureContainerImage image;
+    {
+        image.region.subresource.baseArrayLayer = baseArrayLayer;
+        image.region.subresource.numArrayLayers = numArrayLayers;
+        image.region.subresource.baseMipLevel   = mipLevel;
+        image.region.subresource.numMipLevels   = 1;
+        image.region.extent.width               = mipExtent.width;
+        image.region.extent.height              = (textureDesc.type == TextureType::Texture1D || textureDesc.type == TextureType::Texture1DArray ? 1u : mipExtent.height);
+        image.region.extent.depth               = (textureDesc.type == TextureType::Texture3D ? mipExtent.depth : 1u);
+        image.image.format                      = formatAttribs.format;
+        image.image.dataType                    = formatAttribs.dataType;
+        image.image.data                        = static_cast<const char*>(blob.GetData()) + offset;
+        image.image.dataSize                    = size;
+    }
+    images.push_back(image);
+
+    return true;
+}
+
+bool TextureContainer::Pimpl::LoadDDS(Report* report)
+{
+    DDSHeader header;
+    if (!ReadBlobStruct(blob, sizeof(std::uint32_t), header) || header.size != sizeof(DDSHeader))
+    {
+        if (report != nullptr)
+            report->Errorf("invalid DDS header\n");
+        return false;
+    }
+
+    std::size_t     dataOffset      = sizeof(std::uint32_t) + sizeof(DDSHeader);
+    Format          format          = Format::Undefined;
+    std::uint32_t   arrayLayers     = 1;
+    bool            isCube          = ((header.caps2 & g_ddsCaps2Cubemap) != 0);
+    bool            isVolume        = ((header.caps2 & g_ddsCaps2Volume) != 0 && header.depth > 1);
+    bool            is1D            = false;
+
+    if ((header.pixelFormat.flags & g_ddsPixelFormatFourCC) != 0 && header.pixelFormat.fourCC == MakeFourCC('D', 'X', '1', '0'))
+    {
+        /* Read DX10 header extension for array textures and DXGI formats */
+        DDSHeaderDX10 headerDX10;
+        if (!ReadBlobStruct(blob, dataOffset, headerDX10))
+        {
+            if (report != nullptr)
+                report->Errorf("invalid DDS DX10 header\n");
+            return false;
+        }
+        dataOffset += sizeof(DDSHeaderDX10);
+
+        format      = DXGIFormatToFormat(headerDX10.dxgiFormat);
+        arrayLayers = std::max<std::uint32_t>(1u, headerDX10.arraySize);
+        isCube      = ((headerDX10.miscFlag & g_ddsMiscTextureCube) != 0);
+        isVolume    = (headerDX10.resourceDimension == g_ddsDimensionTexture3D);
+        is1D        = (headerDX10.resourceDimension == g_ddsDimensionTexture1D);
+
+        if (format == Format::Undefined)
+        {
+            if (report != nullptr)
+                report->Errorf("unsupported DXGI format in DDS file: %u\n", headerDX10.dxgiFormat);
+            return false;
+        }
+    }
+    else
+    {
+        format = DDSPixelFormatToFormat(header.pixelFormat);
+        if (format == Format::Undefined)
+        {
+            if (report != nullptr)
+                report->Errorf("unsupported pixel format in DDS file\n");
+            return false;
+        }
+    }
+
+    /* Cube maps store six faces per array element; legacy cube maps always store all faces */
+    if (isCube)
+        arrayLayers *= 6;
+
+    if (isVolume)
+        textureDesc.type = TextureType::Texture3D;
+    else if (isCube)
+        textureDesc.type = (arrayLayers > 6 ? TextureType::TextureCubeArray : TextureType::TextureCube);
+    else if (is1D)
+        textureDesc.type = (arrayLayers > 1 ? TextureType::Texture1DArray : TextureType::Texture1D);
+    else
+        textureDesc.type = (arrayLayers > 1 ? TextureType::Texture2DArray : TextureType::Texture2D);
+
+    textureDesc.format          = format;
+    textureDesc.extent.width    = std::max<std::uint32_t>(1u, header.width);
+    textureDesc.extent.height   = (is1D ? 1u : std::max<std::uint32_t>(1u, header.height));
+    textureDesc.extent.depth    = (isVolume ? std::max<std::uint32_t>(1u, header.depth) : 1u);
+    textureDesc.arrayLayers     = arrayLayers;
+    textureDesc.mipLevels       = std::min(std::max<std::uint32_t>(1u, header.mipMapCount), NumMipLevels(textureDesc.type, textureDesc.extent));
+    textureDesc.miscFlags       = 0;
+
+    /* DDS files store all MIP-map levels of each array layer consecutively */
+    images.reserve(textureDesc.arrayLayers * textureDesc.mipLevels);
+
+    std::uint64_t offset = dataOffset;
+    for_range(arrayLayer, textureDesc.arrayLayers)
+    {
+        for_range(mipLevel, textureDesc.mipLevels)
+        {
+            const Extent3D      mipExtent   = GetMipExtent(textureDesc.type, textureDesc.extent, mipLevel);
+            const std::size_t   imageSize   = GetImageSize(format, Extent3D{ mipExtent.width, mipExtent.height, (isVolume ? mipExtent.depth : 1u) });
+            if (!AppendImage(mipLevel, arrayLayer, 1, offset, imageSize))
+            {
+                if (report != nullptr)
+                    report->Errorf("DDS file is too small for array layer %u and MIP-map level %u\n", arrayLayer, mipLevel);
+                return false;
+            }
+            offset += imageSize;
+        }
+    }
+
+    /* Sort images by MIP-map level, so the first image always belongs to the most detailed level */
+    std::stable_sort(
+        images.begin(),
+        images.end(),
+        [](const TextureContainerImage& lhs, const TextureContainerImage& rhs) -> bool
+        {
+            return (lhs.region.subresource.baseMipLevel < rhs.region.subresource.baseMipLevel);
+        }
+    );
+
+    return true;
+}
+
+bool TextureContainer::Pimpl::LoadKTX2(Report* report)
+{
+    KTX2Header header;
+    if (!ReadBlobStruct(blob, 0, header))
+    {
+        if (report != nullptr)
+            report->Errorf("invalid KTX2 header\n");
+        return false;
+    }
+
+    /* Supercompressed levels must be decompressed before they can be uploaded, so they cannot be referenced directly */
+    if (header.supercompressionScheme != 0)
+    {
+        if (report != nullptr)
+            report->Errorf("supercompressed KTX2 files are not supported: %s\n", GetKTX2SupercompressionName(header.supercompressionScheme));
+        return false;
+    }
+
+    const Format format = VkFormatToFormat(header.vkFormat);
+    if (format == Format::Undefined)
+    {
+        if (report != nullptr)
+            report->Errorf("unsupported VkFormat in KTX2 file: %u\n", header.vkFormat);
+        return false;
+    }
+
+    if (header.pixelWidth == 0 || (header.faceCount != 1 && header.faceCount != 6) || (header.pixelDepth > 0 && (header.layerCount > 0 || header.faceCount != 1)))
+    {
+        if (report != nullptr)
+            report->Errorf("invalid texture dimensions in KTX2 file\n");
+        return false;
+    }
+
+    const bool          isArray     = (header.layerCount > 0);
+    const bool          isCube      = (header.faceCount == 6);
+    const std::uint32_t numLayers   = std::max<std::uint32_t>(1u, header.layerCount);
+
+    if (header.pixelDepth > 0)
+        textureDesc.type = TextureType::Texture3D;
+    else if (isCube)
+        textureDesc.type = (isArray ? TextureType::TextureCubeArray : TextureType::TextureCube);
+    else if (header.pixelHeight == 0)
+        textureDesc.type = (isArray ? TextureType::Texture1DArray : TextureType::Texture1D);
+    else
+        textureDesc.type = (isArray ? TextureType::Texture2DArray : TextureType::Texture2D);
+
+    textureDesc.format          = format;
+    textureDesc.extent.width    = header.pixelWidth;
+    textureDesc.extent.height   = std::max<std::uint32_t>(1u, header.pixelHeight);
+    textureDesc.extent.depth    = std::max<std::uint32_t>(1u, header.pixelDepth);
+    textureDesc.arrayLayers     = numLayers * header.faceCount;
+
+    /* A level count of zero requests the MIP-map chain to be generated from the only level in the file */
+    const std::uint32_t numLevels = std::max<std::uint32_t>(1u, header.levelCount);
+    if (header.levelCount == 0)
+    {
+        textureDesc.mipLevels = 0;
+        textureDesc.miscFlags = MiscFlags::GenerateMips;
+    }
+    else
+    {
+        textureDesc.mipLevels = std::min(numLevels, NumMipLevels(textureDesc.type, textureDesc.extent));
+        textureDesc.miscFlags = 0;
+    }
+
+    /* KTX2 files store all array layers and faces of each MIP-map level consecutively, so each level is a single image */
+    const std::uint32_t numImages = std::min(numLevels, NumMipLevels(textureDesc.type, textureDesc.extent));
+    images.reserve(numImages);
+
+    for_range(mipLevel, numImages)
+    {
+        KTX2LevelIndex levelIndex;
+        if (!ReadBlobStruct(blob, sizeof(KTX2Header) + mipLevel * sizeof(KTX2LevelIndex), levelIndex))
+        {
+            if (report != nullptr)
+                report->Errorf("invalid KTX2 level index\n");
+            return false;
+        }
+
+        const Extent3D      mipExtent   = GetMipExtent(textureDesc.type, textureDesc.extent, mipLevel);
+        const std::size_t   imageSize   = GetImageSize(format, Extent3D{ mipExtent.width, mipExtent.height, (header.pixelDepth > 0 ? mipExtent.depth : 1u) }) * textureDesc.arrayLayers;
+
+        if (levelIndex.byteLength != imageSize || !AppendImage(mipLevel, 0, textureDesc.arrayLayers, levelIndex.byteOffset, imageSize))
+        {
+            if (report != nullptr)
+                report->Errorf("invalid size of KTX2 MIP-map level %u\n", mipLevel);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+/*
+ * TextureContainer class
+ */
+
+TextureContainer::TextureContainer() :
+    pimpl_ { new Pimpl{} }
+{
+}
+
+TextureContainer::~TextureContainer()
+{
+    delete pimpl_;
+}
+
+bool TextureContainer::Load(Blob&& blob, Report* report)
+{
+    pimpl_->Clear();
+    pimpl_->blob = std::move(blob);
+
+    std::uint32_t ddsMagic = 0;
+    std::uint8_t ktx2Identifier[12] = {};
+
+    bool result = false;
+
+    if (ReadBlobStruct(pimpl_->blob, 0, ddsMagic) && ddsMagic == g_ddsMagic)
+    {
+        pimpl_->containerFormat = TextureContainerFormat::DDS;
+        result = pimpl_->LoadDDS(report);
+    }
+    else if (ReadBlobStruct(pimpl_->blob, 0, ktx2Identifier) && std::memcmp(ktx2Identifier, g_ktx2Identifier, sizeof(g_ktx2Identifier)) == 0)
+    {
+        pimpl_->containerFormat = TextureContainerFormat::KTX2;
+        result = pimpl_->LoadKTX2(report);
+    }
+    else if (report != nullptr)
+        report->Errorf("unknown texture container format\n");
+
+    if (!result)
+        pimpl_->Clear();
+
+    return result;
+}
+
+TextureContainerFormat TextureContainer::GetContainerFormat() const
+{
+    return pimpl_->containerFormat;
+}
+
+const TextureDescriptor& TextureContainer::GetDescriptor() const
+{
+    return pimpl_->textureDesc;
+}
+
+ArrayView<TextureContainerImage> TextureContainer::GetImages() const
+{
+    return pimpl_->images;
+}
+
+Texture* TextureContainer::CreateTexture(RenderSystem& renderSystem, long bindFlags) const
+{
+    if (pimpl_->images.empty())
+        return nullptr;
+
+    TextureDescriptor textureDesc = pimpl_->textureDesc;
+    textureDesc.bindFlags       = bindFlags;
+    textureDesc.cpuAccessFlags  = 0;
+
+    /* Pass the first image as initial data if it covers the entire first MIP-map level, which is always the case for KTX2 files */
+    const TextureContainerImage& firstImage = pimpl_->images.front();
+    const bool hasInitialImage = (firstImage.region.subresource.numArrayLayers == textureDesc.arrayLayers);
+
+    Texture* texture = renderSystem.CreateTexture(textureDesc, (hasInitialImage ? &(firstImage.image) : nullptr));
+    if (texture == nullptr)
+        return nullptr;
+
+    /* Write remaining subresources; generated MIP-maps must not be overwritten */
+    if ((textureDesc.miscFlags & MiscFlags::GenerateMips) == 0)
+    {
+        for_subrange(i, (hasInitialImage ? 1 : 0), pimpl_->images.size())
+        {
+            const TextureContainerImage& image = pimpl_->images[i];
+            renderSystem.WriteTexture(*texture, image.region, image.image);
+        }
+    }
+
+    return texture;
+}
+
+void TextureContainer::WriteTexture(RenderSystem& renderSystem, Texture& texture) const
+{
+    for (const TextureContainerImage& image : pimpl_->images)
+        renderSystem.WriteTexture(texture, image.region, image.image);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
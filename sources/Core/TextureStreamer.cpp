@@ -0,0 +1,400 @@
+/*
+ * TextureStreamer.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Utils/TextureStreamer.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/Texture.h>
+#include <LLGL/TextureFlags.h>
+#include <LLGL/ThreadPool.h>
+#include <LLGL/Format.h>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <thread>
+#include <algorithm>
+#include <unordered_map>
+#include <string>
+
+
+namespace LLGL
+{
+
+
+/*
+ * Internal structures
+ */
+
+// Result of a single loader invocation. This is shared between the streamer and the worker thread that executes the loader.
+struct TextureStreamLoad
+{
+    std::atomic<bool>   done        { false };
+    bool                succeeded   = false;
+    TextureStreamImage  image;
+};
+
+using TextureStreamLoadPtr = std::shared_ptr<TextureStreamLoad>;
+
+struct TextureStreamEntry
+{
+    // Returns true if this stream still has MIP-map levels to upload.
+    inline bool IsActive() const
+    {
+        return (!failed && residentMipLevel > baseMipLevel);
+    }
+
+    TextureStream                           id                  = 0;
+    Texture*                                texture             = nullptr;
+    TextureType                             type                = TextureType::Texture2D;
+    Extent3D                                extent;
+    std::uint32_t                           numArrayLayers      = 1;
+    std::uint32_t                           baseMipLevel        = 0;
+    std::uint32_t                           residentMipLevel    = 0;    // Most detailed resident MIP-map level; Equal to the end of the MIP-map range if no level is resident.
+    std::vector<ImageView>                  images;
+    std::shared_ptr<TextureStreamLoader>    loader;                     // Shared with the worker threads, since a loader can still run after its stream was released.
+    TextureStreamCallback                   onResident;
+    float                                   priority            = 0.0f;
+    TextureStreamLoadPtr                    load;                       // Load for the next MIP-map level, i.e. residentMipLevel - 1.
+    bool                                    failed              = false;
+};
+
+struct TextureStreamer::Pimpl
+{
+    Pimpl(RenderSystem& renderSystem, const TextureStreamerDescriptor& desc);
+    ~Pimpl();
+
+    // Collects the active streams sorted by descending priority.
+    void SortActiveStreams();
+
+    // Uploads loaded MIP-map levels within the frame budget and returns the number of uploaded levels.
+    std::uint32_t UploadMipLevels();
+
+    // Starts loaders for the next MIP-map levels of the streams with the highest priority.
+    void StartLoads();
+
+    void StartLoad(TextureStreamEntry& entry);
+
+    RenderSystem&                                           renderSystem;
+    TextureStreamerDescriptor                               desc;
+    ThreadPool&                                             threadPool;
+    std::unordered_map<TextureStream, TextureStreamEntry>   streams;
+    std::vector<TextureStreamEntry*>                        activeStreams;              // Temporary list of active streams for each update.
+    std::vector<TextureStreamLoadPtr>                       orphanedLoads;              // Loads of released streams that might still be executed.
+    TextureStream                                           nextId              = 1;
+};
+
+TextureStreamer::Pimpl::Pimpl(RenderSystem& renderSystem, const TextureStreamerDescriptor& desc) :
+    renderSystem { renderSystem                                                                 },
+    desc         { desc                                                                         },
+    threadPool   { (desc.threadPool != nullptr ? *desc.threadPool : ThreadPool::GetGlobal())    }
+{
+    this->desc.maxConcurrentLoads = std::max(desc.maxConcurrentLoads, 1u);
+}
+
+// Reads one byte of each page of the mapped image data, so the upload on the main thread does not stall on file I/O.
+static void PrefetchMappedPages(const Blob& blob)
+{
+    constexpr std::size_t pageSize = 4096;
+
+    const volatile char* data = static_cast<const char*>(blob.GetData());
+    const std::size_t size = blob.GetSize();
+
+    char sum = 0;
+    for (std::size_t offset = 0; offset < size; offset += pageSize)
+        sum ^= data[offset];
+    (void)sum;
+}
+
+// Returns a loader that maps the file range of each MIP-map level. The data is passed through in the hardware format of the texture.
+static TextureStreamLoader MakeTextureStreamFileLoader(
+    const char*                             filename,
+    const ArrayView<TextureStreamFileRange> fileRanges,
+    std::uint32_t                           baseMipLevel,
+    Format                                  format)
+{
+    const FormatAttributes&                     formatAttribs   = GetFormatAttribs(format);
+    const ImageFormat                           imageFormat     = formatAttribs.format;
+    const DataType                              dataType        = formatAttribs.dataType;
+    const std::string                           path            = filename;
+    const std::vector<TextureStreamFileRange>   ranges          { fileRanges.begin(), fileRanges.end() };
+
+    return [path, ranges, baseMipLevel, imageFormat, dataType](std::uint32_t mipLevel, TextureStreamImage& outImage) -> bool
+    {
+        const TextureStreamFileRange& range = ranges[mipLevel - baseMipLevel];
+        outImage.format     = imageFormat;
+        outImage.dataType   = dataType;
+        outImage.data       = Blob::CreateFromFileMapped(path.c_str(), range.offset, range.size);
+        if (!outImage.data)
+            return false;
+        PrefetchMappedPages(outImage.data);
+        return true;
+    };
+}
+
+static void WaitForTextureStreamLoad(const TextureStreamLoadPtr& load)
+{
+    while (!load->done.load(std::memory_order_acquire))
+        std::this_thread::yield();
+}
+
+TextureStreamer::Pimpl::~Pimpl()
+{
+    /* Loaders might refer to client data that is released after the streamer, so wait until all of them are finished */
+    for (const auto& it : streams)
+    {
+        if (it.second.load)
+            WaitForTextureStreamLoad(it.second.load);
+    }
+    for (const TextureStreamLoadPtr& load : orphanedLoads)
+        WaitForTextureStreamLoad(load);
+}
+
+void TextureStreamer::Pimpl::SortActiveStreams()
+{
+    activeStreams.clear();
+    for (auto& it : streams)
+    {
+        if (it.second.IsActive())
+            activeStreams.push_back(&it.second);
+    }
+
+    /* Sort by descending priority; Streams with equal priority are processed in the order they were enqueued */
+    std::sort(
+        activeStreams.begin(),
+        activeStreams.end(),
+        [](const TextureStreamEntry* lhs, const TextureStreamEntry* rhs) -> bool
+        {
+            if (lhs->priority != rhs->priority)
+                return (lhs->priority > rhs->priority);
+            return (lhs->id < rhs->id);
+        }
+    );
+}
+
+std::uint32_t TextureStreamer::Pimpl::UploadMipLevels()
+{
+    std::uint32_t   numUploads      = 0;
+    std::uint64_t   uploadedSize    = 0;
+
+    for (TextureStreamEntry* entry : activeStreams)
+    {
+        while (entry->IsActive())
+        {
+            /* Get image view of next MIP-map level */
+            const std::uint32_t mipLevel = entry->residentMipLevel - 1;
+
+            ImageView imageView;
+            if (!entry->images.empty())
+                imageView = entry->images[mipLevel - entry->baseMipLevel];
+            else if (entry->load && entry->load->done.load(std::memory_order_acquire))
+            {
+                if (!entry->load->succeeded)
+                {
+                    entry->failed = true;
+                    entry->load.reset();
+                    break;
+                }
+                const TextureStreamImage& image = entry->load->image;
+                imageView = ImageView{ image.format, image.dataType, image.data.GetData(), image.data.GetSize() };
+            }
+            else
+                break;
+
+            /* Uploads are processed strictly by priority, so stop once the budget is exceeded; A single oversized level can always be uploaded */
+            if (uploadedSize > 0 && uploadedSize + imageView.dataSize > desc.frameBudget)
+                return numUploads;
+
+            TextureRegion region;
+            {
+                region.subresource.baseArrayLayer   = 0;
+                region.subresource.numArrayLayers   = entry->numArrayLayers;
+                region.subresource.baseMipLevel     = mipLevel;
+                region.subresource.numMipLevels     = 1;
+                region.extent                       = GetMipExtent(entry->type, entry->extent, mipLevel);
+            }
+            renderSystem.WriteTexture(*entry->texture, region, imageView);
+
+            entry->residentMipLevel = mipLevel;
+            entry->load.reset();
+
+            uploadedSize += imageView.dataSize;
+            ++numUploads;
+
+            if (entry->onResident)
+                entry->onResident(*entry->texture, mipLevel);
+
+            if (uploadedSize >= desc.frameBudget)
+                return numUploads;
+        }
+    }
+
+    return numUploads;
+}
+
+void TextureStreamer::Pimpl::StartLoads()
+{
+    /* Drop orphaned loads that have finished */
+    orphanedLoads.erase(
+        std::remove_if(
+            orphanedLoads.begin(),
+            orphanedLoads.end(),
+            [](const TextureStreamLoadPtr& load) -> bool
+            {
+                return load->done.load(std::memory_order_acquire);
+            }
+        ),
+        orphanedLoads.end()
+    );
+
+    /* Count loads that are in flight or whose image data has not been uploaded yet */
+    std::size_t numLoads = orphanedLoads.size();
+    for (const auto& it : streams)
+    {
+        if (it.second.load)
+            ++numLoads;
+    }
+
+    for (TextureStreamEntry* entry : activeStreams)
+    {
+        if (numLoads >= desc.maxConcurrentLoads)
+            break;
+        if (entry->IsActive() && entry->loader && !entry->load)
+        {
+            StartLoad(*entry);
+            ++numLoads;
+        }
+    }
+}
+
+void TextureStreamer::Pimpl::StartLoad(TextureStreamEntry& entry)
+{
+    TextureStreamLoadPtr                    load        = std::make_shared<TextureStreamLoad>();
+    std::shared_ptr<TextureStreamLoader>    loader      = entry.loader;
+    const std::uint32_t                     mipLevel    = entry.residentMipLevel - 1;
+
+    entry.load = load;
+
+    threadPool.Submit(
+        [load, loader, mipLevel]()
+        {
+            load->succeeded = (*loader)(mipLevel, load->image);
+            load->done.store(true, std::memory_order_release);
+        }
+    );
+}
+
+
+/*
+ * TextureStreamer class
+ */
+
+TextureStreamer::TextureStreamer(RenderSystem& renderSystem, const TextureStreamerDescriptor& desc) :
+    pimpl_ { new Pimpl{ renderSystem, desc } }
+{
+}
+
+TextureStreamer::~TextureStreamer()
+{
+    delete pimpl_;
+}
+
+TextureStream TextureStreamer::Enqueue(const TextureStreamDescriptor& desc)
+{
+    const bool hasFileRanges = (desc.filename != nullptr && !desc.fileRanges.empty());
+    if (desc.texture == nullptr || (desc.images.empty() && !hasFileRanges && !desc.loader))
+        return 0;
+
+    /* Determine MIP-map range of the stream */
+    const TextureDescriptor textureDesc = desc.texture->GetDesc();
+    const std::uint32_t numTextureMips = NumMipLevels(textureDesc);
+    if (desc.baseMipLevel >= numTextureMips)
+        return 0;
+
+    const std::uint32_t numMipLevels = (desc.numMipLevels == 0 ? numTextureMips - desc.baseMipLevel : std::min(desc.numMipLevels, numTextureMips - desc.baseMipLevel));
+    if (!desc.images.empty() && desc.images.size() < numMipLevels)
+        return 0;
+    if (desc.images.empty() && hasFileRanges && desc.fileRanges.size() < numMipLevels)
+        return 0;
+
+    const TextureStream id = pimpl_->nextId++;
+
+    TextureStreamEntry& entry = pimpl_->streams[id];
+    {
+        entry.id                = id;
+        entry.texture           = desc.texture;
+        entry.type              = textureDesc.type;
+        entry.extent            = textureDesc.extent;
+        entry.numArrayLayers    = std::max(textureDesc.arrayLayers, 1u);
+        entry.baseMipLevel      = desc.baseMipLevel;
+        entry.residentMipLevel  = desc.baseMipLevel + numMipLevels;
+        entry.onResident        = desc.onResident;
+        entry.priority          = desc.priority;
+        if (!desc.images.empty())
+            entry.images.assign(desc.images.begin(), desc.images.begin() + numMipLevels);
+        else if (hasFileRanges)
+            entry.loader = std::make_shared<TextureStreamLoader>(MakeTextureStreamFileLoader(desc.filename, desc.fileRanges, desc.baseMipLevel, desc.texture->GetFormat()));
+        else
+            entry.loader = std::make_shared<TextureStreamLoader>(desc.loader);
+    }
+
+    return id;
+}
+
+void TextureStreamer::Release(TextureStream stream)
+{
+    auto it = pimpl_->streams.find(stream);
+    if (it != pimpl_->streams.end())
+    {
+        if (it->second.load)
+            pimpl_->orphanedLoads.push_back(std::move(it->second.load));
+        pimpl_->streams.erase(it);
+    }
+}
+
+void TextureStreamer::SetPriority(TextureStream stream, float priority)
+{
+    auto it = pimpl_->streams.find(stream);
+    if (it != pimpl_->streams.end())
+        it->second.priority = priority;
+}
+
+std::uint32_t TextureStreamer::Update()
+{
+    pimpl_->SortActiveStreams();
+    const std::uint32_t numUploads = pimpl_->UploadMipLevels();
+    pimpl_->StartLoads();
+    return numUploads;
+}
+
+std::uint32_t TextureStreamer::GetResidentMipLevel(TextureStream stream) const
+{
+    auto it = pimpl_->streams.find(stream);
+    return (it != pimpl_->streams.end() ? it->second.residentMipLevel : 0);
+}
+
+bool TextureStreamer::IsStreaming(TextureStream stream) const
+{
+    auto it = pimpl_->streams.find(stream);
+    return (it != pimpl_->streams.end() && it->second.IsActive());
+}
+
+std::uint32_t TextureStreamer::GetNumActiveStreams() const
+{
+    std::uint32_t numStreams = 0;
+    for (const auto& it : pimpl_->streams)
+    {
+        if (it.second.IsActive())
+            ++numStreams;
+    }
+    return numStreams;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
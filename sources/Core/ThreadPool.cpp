@@ -0,0 +1,327 @@
+/*
+ * ThreadPool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/ThreadPool.h>
+#include <LLGL/Utils/ForRange.h>
+#include "CoreUtils.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <deque>
+#include <vector>
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+/*
+ * Internal structures
+ */
+
+// Group of work items that were submitted by a single call to ThreadPool::ParallelRange or ThreadPool::Submit.
+struct ThreadPoolTaskGroup
+{
+    const std::function<void(std::size_t begin, std::size_t end)>*  task        = nullptr;
+    std::atomic<std::size_t>                                        numPending;
+    std::function<void()>                                           asyncTask;  // Task that is owned by this group; the group is deleted once it has been run.
+};
+
+struct ThreadPoolWorkItem
+{
+    ThreadPoolTaskGroup*    group;
+    std::size_t             begin;
+    std::size_t             end;
+};
+
+// Work-stealing queue: The owner pops from the back (LIFO), other threads steal from the front (FIFO).
+class ThreadPoolQueue
+{
+
+    public:
+
+        void PushBack(const ThreadPoolWorkItem* items, std::size_t numItems)
+        {
+            std::lock_guard<std::mutex> guard{ mutex_ };
+            items_.insert(items_.end(), items, items + numItems);
+        }
+
+        bool PopBack(ThreadPoolWorkItem& outItem)
+        {
+            std::lock_guard<std::mutex> guard{ mutex_ };
+            if (items_.empty())
+                return false;
+            outItem = items_.back();
+            items_.pop_back();
+            return true;
+        }
+
+        bool PopFront(ThreadPoolWorkItem& outItem)
+        {
+            std::lock_guard<std::mutex> guard{ mutex_ };
+            if (items_.empty())
+                return false;
+            outItem = items_.front();
+            items_.pop_front();
+            return true;
+        }
+
+    private:
+
+        std::mutex                      mutex_;
+        std::deque<ThreadPoolWorkItem>  items_;
+
+};
+
+// Thread pool of the current thread if it is a worker thread and its queue index.
+static thread_local const ThreadPool::Pimpl*    g_currentThreadPool     = nullptr;
+static thread_local std::size_t                 g_currentWorkerIndex    = 0;
+
+
+/*
+ * ThreadPool::Pimpl struct
+ */
+
+struct ThreadPool::Pimpl
+{
+    Pimpl(unsigned numThreads);
+    ~Pimpl();
+
+    // Returns the index of the queue the calling thread submits its work items to.
+    std::size_t GetSubmitQueueIndex() const;
+
+    // Pops a work item from the specified queue or steals one from any other queue and runs it. Returns false if all queues are empty.
+    bool RunNextWorkItem(std::size_t queueIndex);
+
+    void RunWorker(std::size_t workerIndex);
+
+    std::vector<std::thread>            workers;
+    std::unique_ptr<ThreadPoolQueue[]>  queues;             // One queue per worker thread plus one shared queue for all external threads.
+    std::size_t                         numQueues           = 0;
+    std::atomic<int>                    numQueuedItems;
+    std::mutex                          idleMutex;
+    std::condition_variable             idleSignal;
+    bool                                quit                = false;
+};
+
+ThreadPool::Pimpl::Pimpl(unsigned numThreads) :
+    numQueuedItems { 0 }
+{
+    if (numThreads == LLGL_MAX_THREAD_COUNT)
+    {
+        /* Reserve one hardware thread for the calling thread, which always participates in the work */
+        const unsigned numHardwareThreads = std::thread::hardware_concurrency();
+        numThreads = (numHardwareThreads > 1 ? numHardwareThreads - 1 : 0);
+    }
+
+    numQueues   = numThreads + 1;
+    queues      = MakeUniqueArray<ThreadPoolQueue>(numQueues);
+
+    workers.reserve(numThreads);
+    for_range(i, numThreads)
+        workers.emplace_back(&ThreadPool::Pimpl::RunWorker, this, static_cast<std::size_t>(i));
+}
+
+ThreadPool::Pimpl::~Pimpl()
+{
+    {
+        std::lock_guard<std::mutex> guard{ idleMutex };
+        quit = true;
+    }
+    idleSignal.notify_all();
+
+    for (std::thread& worker : workers)
+        worker.join();
+}
+
+std::size_t ThreadPool::Pimpl::GetSubmitQueueIndex() const
+{
+    /* Worker threads submit to their own queue, all other threads share the last queue */
+    return (g_currentThreadPool == this ? g_currentWorkerIndex : numQueues - 1);
+}
+
+bool ThreadPool::Pimpl::RunNextWorkItem(std::size_t queueIndex)
+{
+    ThreadPoolWorkItem item;
+
+    /* Pop most recent work item from own queue first, then try to steal the oldest work item from any other queue */
+    bool hasItem = queues[queueIndex].PopBack(item);
+
+    for (std::size_t i = 1; !hasItem && i < numQueues; ++i)
+        hasItem = queues[(queueIndex + i) % numQueues].PopFront(item);
+
+    if (!hasItem)
+        return false;
+
+    numQueuedItems.fetch_sub(1);
+
+    if (item.group->task == nullptr)
+    {
+        /* Run asynchronous task and delete its group, since nobody is waiting for it */
+        item.group->asyncTask();
+        delete item.group;
+        return true;
+    }
+
+    /* Run work item and notify its group about completion */
+    (*item.group->task)(item.begin, item.end);
+    item.group->numPending.fetch_sub(1);
+
+    return true;
+}
+
+void ThreadPool::Pimpl::RunWorker(std::size_t workerIndex)
+{
+    g_currentThreadPool     = this;
+    g_currentWorkerIndex    = workerIndex;
+
+    for (;;)
+    {
+        if (RunNextWorkItem(workerIndex))
+            continue;
+
+        /* Wait until new work items are queued or the pool is shut down; pending asynchronous tasks are drained first */
+        std::unique_lock<std::mutex> lock{ idleMutex };
+        idleSignal.wait(lock, [this]() { return (quit || numQueuedItems.load() > 0); });
+        if (quit && numQueuedItems.load() == 0)
+            break;
+    }
+}
+
+
+/*
+ * ThreadPool class
+ */
+
+ThreadPool::ThreadPool(unsigned numThreads) :
+    pimpl_ { new Pimpl{ numThreads } }
+{
+}
+
+ThreadPool::~ThreadPool()
+{
+    delete pimpl_;
+}
+
+void ThreadPool::ParallelRange(
+    const std::function<void(std::size_t begin, std::size_t end)>&  task,
+    std::size_t                                                     count,
+    std::size_t                                                     numWorkItems)
+{
+    numWorkItems = std::max<std::size_t>(1, std::min(numWorkItems, count));
+
+    if (numWorkItems == 1 || pimpl_->workers.empty())
+    {
+        /* Run single-threaded */
+        task(0, count);
+        return;
+    }
+
+    ThreadPoolTaskGroup group;
+    {
+        group.task          = &task;
+        group.numPending    = numWorkItems;
+    }
+
+    /* Split range into work items; the first work item is reserved for the calling thread */
+    const std::size_t workSize          = count / numWorkItems;
+    const std::size_t workSizeRemain    = count % numWorkItems;
+
+    std::vector<ThreadPoolWorkItem> items;
+    items.reserve(numWorkItems - 1);
+
+    std::size_t offset = workSize + (workSizeRemain > 0 ? 1 : 0);
+    const std::size_t firstEnd = offset;
+
+    for_subrange(i, 1, numWorkItems)
+    {
+        const std::size_t itemSize = workSize + (i < workSizeRemain ? 1 : 0);
+        items.push_back(ThreadPoolWorkItem{ &group, offset, offset + itemSize });
+        offset += itemSize;
+    }
+
+    /* Submit work items and wake up idle worker threads */
+    const std::size_t queueIndex = pimpl_->GetSubmitQueueIndex();
+    pimpl_->queues[queueIndex].PushBack(items.data(), items.size());
+    {
+        std::lock_guard<std::mutex> guard{ pimpl_->idleMutex };
+        pimpl_->numQueuedItems.fetch_add(static_cast<int>(items.size()));
+    }
+    pimpl_->idleSignal.notify_all();
+
+    /* Run first work item on calling thread */
+    task(0, firstEnd);
+    group.numPending.fetch_sub(1);
+
+    /* Help processing work items (of any group) until all work items of this group are done */
+    while (group.numPending.load() > 0)
+    {
+        if (!pimpl_->RunNextWorkItem(queueIndex))
+            std::this_thread::yield();
+    }
+}
+
+void ThreadPool::Submit(const std::function<void()>& task)
+{
+    if (pimpl_->workers.empty())
+    {
+        /* Run single-threaded */
+        task();
+        return;
+    }
+
+    ThreadPoolTaskGroup* group = new ThreadPoolTaskGroup{};
+    {
+        group->numPending   = 1;
+        group->asyncTask    = task;
+    }
+
+    /* Submit work item and wake up one idle worker thread */
+    const ThreadPoolWorkItem item{ group, 0, 1 };
+    pimpl_->queues[pimpl_->GetSubmitQueueIndex()].PushBack(&item, 1);
+    {
+        std::lock_guard<std::mutex> guard{ pimpl_->idleMutex };
+        pimpl_->numQueuedItems.fetch_add(1);
+    }
+    pimpl_->idleSignal.notify_one();
+}
+
+unsigned ThreadPool::GetNumThreads() const
+{
+    return static_cast<unsigned>(pimpl_->workers.size());
+}
+
+bool ThreadPool::IsWorkerThread() const
+{
+    return (g_currentThreadPool == pimpl_);
+}
+
+static std::atomic<ThreadPool*> g_globalThreadPool{ nullptr };
+
+ThreadPool& ThreadPool::GetGlobal()
+{
+    if (ThreadPool* threadPool = g_globalThreadPool.load())
+        return *threadPool;
+
+    /* Lazily start default thread pool */
+    static ThreadPool defaultThreadPool;
+    return defaultThreadPool;
+}
+
+void ThreadPool::SetGlobal(ThreadPool* threadPool)
+{
+    g_globalThreadPool.store(threadPool);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -6,9 +6,9 @@
  */
 
 #include "Threading.h"
+#include <LLGL/ThreadPool.h>
 #include <LLGL/Utils/ForRange.h>
 #include <thread>
-#include <vector>
 #include <algorithm>
 
 
@@ -16,35 +16,6 @@ namespace LLGL
 {
 
 
-static constexpr unsigned g_maxThreadCountStaticArray = 64;
-
-static void DoConcurrentRangeInWorkerContainer(
-    const std::function<void(std::size_t begin, std::size_t end)>&  task,
-    std::size_t                                                     count,
-    std::size_t                                                     workerCount,
-    std::thread*                                                    workers)
-{
-    /* Distribute work to threads */
-    const std::size_t workSize          = count / workerCount;
-    const std::size_t workSizeRemain    = count % workerCount;
-
-    std::size_t offset = 0;
-
-    for_range(i, workerCount)
-    {
-        workers[i] = std::thread(task, offset, offset + workSize);
-        offset += workSize;
-    }
-
-    /* Execute task of remaining work on main thread */
-    if (workSizeRemain > 0)
-        task(offset, offset + workSizeRemain);
-
-    /* Join worker threads */
-    for_range(i, workerCount)
-        workers[i].join();
-}
-
 LLGL_EXPORT void DoConcurrentRange(
     const std::function<void(std::size_t begin, std::size_t end)>&  task,
     std::size_t                                                     count,
@@ -54,24 +25,17 @@ LLGL_EXPORT void DoConcurrentRange(
     if (threadCount == LLGL_MAX_THREAD_COUNT)
         threadCount = std::thread::hardware_concurrency();
 
-    threadCount = std::min(threadCount, static_cast<unsigned>(count / threadMinWorkSize));
+    threadCount = std::min(threadCount, static_cast<unsigned>(count / std::max(1u, threadMinWorkSize)));
 
     if (threadCount <= 1)
     {
         /* Run single-threaded */
         task(0, count);
     }
-    else if (threadCount <= g_maxThreadCountStaticArray)
-    {
-        /* Launch worker threads in static array */
-        std::thread workers[g_maxThreadCountStaticArray];
-        DoConcurrentRangeInWorkerContainer(task, count, threadCount, workers);
-    }
-    else if (threadCount > 1)
+    else
     {
-        /* Launch worker threads in dynamic array */
-        std::vector<std::thread> workers(threadCount);
-        DoConcurrentRangeInWorkerContainer(task, count, threadCount, workers.data());
+        /* Dispatch work into global thread pool; the calling thread participates in the work */
+        ThreadPool::GetGlobal().ParallelRange(task, count, threadCount);
     }
 }
 
@@ -0,0 +1,208 @@
+/*
+ * TransientBufferAllocator.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Utils/TransientBufferAllocator.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/CommandBuffer.h>
+#include "Assertion.h"
+#include <vector>
+#include <memory>
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+/*
+ * Internal structures
+ */
+
+// Number of frames a pooled buffer can remain unused after it became available again before it is released.
+static constexpr std::uint64_t g_maxUnusedFrames = 16;
+
+// Number of size classes; Each class doubles the buffer size of the previous one.
+static constexpr std::size_t g_numSizeClasses = 64;
+
+struct TransientBufferEntry
+{
+    Buffer*                 buffer          = nullptr;
+    std::unique_ptr<char[]> shadow;                         // CPU copy of the buffer content that is written by the client.
+    std::uint64_t           capacity        = 0;
+    std::uint64_t           size            = 0;            // Size of the current allocation.
+    std::uint64_t           availableFrame  = 0;            // Frame index at which this buffer can be reused.
+};
+
+using TransientBufferEntryPtr = std::unique_ptr<TransientBufferEntry>;
+
+struct TransientBufferAllocator::Pimpl
+{
+    Pimpl(RenderSystem& renderSystem, const TransientBufferAllocatorDescriptor& desc);
+    ~Pimpl();
+
+    // Returns an available buffer of the specified size class or creates a new one.
+    TransientBufferEntry* AcquireEntry(std::size_t sizeClass);
+
+    void ReleaseUnusedEntries();
+
+    RenderSystem&                           renderSystem;
+    TransientBufferAllocatorDescriptor      desc;
+    std::vector<VertexAttribute>            vertexAttribs;
+    std::vector<TransientBufferEntryPtr>    sizeClasses[g_numSizeClasses];
+    std::vector<TransientBufferEntry*>      pendingUploads;
+    std::uint64_t                           currentFrame        = 0;
+    std::uint64_t                           totalBufferSize     = 0;
+};
+
+// Returns the size class for the specified allocation size, i.e. the binary logarithm of the rounded buffer size.
+static std::size_t GetSizeClass(std::uint64_t size, std::uint64_t minBufferSize)
+{
+    std::size_t sizeClass = 0;
+    std::uint64_t capacity = 1;
+    for (size = std::max(size, minBufferSize); capacity < size && sizeClass + 1 < g_numSizeClasses; capacity <<= 1)
+        ++sizeClass;
+    return sizeClass;
+}
+
+TransientBufferAllocator::Pimpl::Pimpl(RenderSystem& renderSystem, const TransientBufferAllocatorDescriptor& desc) :
+    renderSystem  { renderSystem                                            },
+    desc          { desc                                                    },
+    vertexAttribs { desc.vertexAttribs.begin(), desc.vertexAttribs.end()    }
+{
+    /* Keep own copy of vertex attributes, since the descriptor only refers to client memory */
+    this->desc.vertexAttribs        = vertexAttribs;
+    this->desc.numFramesInFlight    = std::max(desc.numFramesInFlight, 1u);
+    this->desc.minBufferSize        = std::max<std::uint64_t>(desc.minBufferSize, 1);
+}
+
+TransientBufferAllocator::Pimpl::~Pimpl()
+{
+    for (std::vector<TransientBufferEntryPtr>& entries : sizeClasses)
+    {
+        for (TransientBufferEntryPtr& entry : entries)
+            renderSystem.Release(*entry->buffer);
+    }
+}
+
+TransientBufferEntry* TransientBufferAllocator::Pimpl::AcquireEntry(std::size_t sizeClass)
+{
+    /* Reuse buffer that is no longer in flight */
+    std::vector<TransientBufferEntryPtr>& entries = sizeClasses[sizeClass];
+    for (TransientBufferEntryPtr& entry : entries)
+    {
+        if (entry->availableFrame <= currentFrame)
+            return entry.get();
+    }
+
+    /* Create new buffer for this size class */
+    const std::uint64_t capacity = (std::uint64_t(1) << sizeClass);
+
+    BufferDescriptor bufferDesc;
+    {
+        bufferDesc.debugName        = desc.debugName;
+        bufferDesc.size             = capacity;
+        bufferDesc.bindFlags        = (desc.bindFlags | BindFlags::CopyDst);
+        bufferDesc.vertexAttribs    = vertexAttribs;
+    }
+    Buffer* buffer = renderSystem.CreateBuffer(bufferDesc);
+    if (buffer == nullptr)
+        return nullptr;
+
+    TransientBufferEntryPtr entry{ new TransientBufferEntry{} };
+    {
+        entry->buffer   = buffer;
+        entry->shadow   = std::unique_ptr<char[]>{ new char[static_cast<std::size_t>(capacity)] };
+        entry->capacity = capacity;
+    }
+    totalBufferSize += capacity;
+
+    entries.push_back(std::move(entry));
+    return entries.back().get();
+}
+
+void TransientBufferAllocator::Pimpl::ReleaseUnusedEntries()
+{
+    for (std::vector<TransientBufferEntryPtr>& entries : sizeClasses)
+    {
+        auto IsUnused = [this](const TransientBufferEntryPtr& entry) -> bool
+        {
+            if (entry->availableFrame + g_maxUnusedFrames < currentFrame)
+            {
+                totalBufferSize -= entry->capacity;
+                renderSystem.Release(*entry->buffer);
+                return true;
+            }
+            return false;
+        };
+        entries.erase(std::remove_if(entries.begin(), entries.end(), IsUnused), entries.end());
+    }
+}
+
+
+/*
+ * TransientBufferAllocator class
+ */
+
+TransientBufferAllocator::TransientBufferAllocator(RenderSystem& renderSystem, const TransientBufferAllocatorDescriptor& desc) :
+    pimpl_ { new Pimpl{ renderSystem, desc } }
+{
+}
+
+TransientBufferAllocator::~TransientBufferAllocator()
+{
+    delete pimpl_;
+}
+
+TransientBufferRange TransientBufferAllocator::Allocate(std::uint64_t size)
+{
+    TransientBufferRange range;
+
+    if (size == 0)
+        return range;
+
+    const std::size_t sizeClass = GetSizeClass(size, pimpl_->desc.minBufferSize);
+    if (TransientBufferEntry* entry = pimpl_->AcquireEntry(sizeClass))
+    {
+        LLGL_ASSERT(size <= entry->capacity);
+
+        /* Keep buffer until all frames that might read from it are finished */
+        entry->size             = size;
+        entry->availableFrame   = pimpl_->currentFrame + pimpl_->desc.numFramesInFlight;
+        pimpl_->pendingUploads.push_back(entry);
+
+        range.data      = entry->shadow.get();
+        range.buffer    = entry->buffer;
+        range.size      = size;
+    }
+
+    return range;
+}
+
+void TransientBufferAllocator::Flush(CommandBuffer& commandBuffer)
+{
+    for (TransientBufferEntry* entry : pimpl_->pendingUploads)
+        commandBuffer.UpdateBuffer(*entry->buffer, 0, entry->shadow.get(), entry->size);
+    pimpl_->pendingUploads.clear();
+}
+
+void TransientBufferAllocator::NextFrame()
+{
+    ++pimpl_->currentFrame;
+    pimpl_->ReleaseUnusedEntries();
+}
+
+std::uint64_t TransientBufferAllocator::GetTotalBufferSize() const
+{
+    return pimpl_->totalBufferSize;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -25,6 +25,8 @@ LLGL_EXPORT const char* ToString(const ShaderType val)
         case T::Geometry:       return "geometry";
         case T::Fragment:       return "fragment";
         case T::Compute:        return "compute";
+        case T::Task:           return "task";
+        case T::Mesh:           return "mesh";
     }
 
     return nullptr;
@@ -12,6 +12,7 @@
 #include <LLGL/Texture.h>
 #include <LLGL/Sampler.h>
 #include <LLGL/Shader.h>
+#include <LLGL/RenderSystem.h>
 #include <string.h>
 #include <ctype.h>
 #include "../Renderer/RenderTargetUtils.h"
@@ -283,6 +284,34 @@ LLGL_EXPORT RenderPassDescriptor RenderPassDesc(const RenderTargetDescriptor& re
     return renderPassDesc;
 }
 
+/* ----- Multi-GPU utility functions ----- */
+
+LLGL_EXPORT bool CopyBufferAcrossRenderSystems(
+    RenderSystem&   dstRenderSystem,
+    Buffer&         dstBuffer,
+    std::uint64_t   dstOffset,
+    RenderSystem&   srcRenderSystem,
+    Buffer&         srcBuffer,
+    std::uint64_t   srcOffset,
+    std::uint64_t   size)
+{
+    if (&dstRenderSystem == &srcRenderSystem)
+        return false;
+
+    if (size == 0)
+        return true;
+
+    /* Write mapped source range directly into destination buffer to avoid an intermediate copy in host memory */
+    const void* srcData = srcRenderSystem.MapBuffer(srcBuffer, CPUAccess::ReadOnly, srcOffset, size);
+    if (srcData == nullptr)
+        return false;
+
+    dstRenderSystem.WriteBuffer(dstBuffer, dstOffset, srcData, size);
+    srcRenderSystem.UnmapBuffer(srcBuffer);
+
+    return true;
+}
+
 
 } // /namespace LLGL
 
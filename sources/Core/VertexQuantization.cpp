@@ -0,0 +1,736 @@
+/*
+ * VertexQuantization.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Utils/VertexQuantization.h>
+#include <LLGL/Utils/ForRange.h>
+#include "CPUFeatures.h"
+#include "Float16Compressor.h"
+#include <cmath>
+#include <cstring>
+
+#if defined LLGL_SIMD_X86
+#   include <immintrin.h>
+#elif defined LLGL_SIMD_NEON
+#   include <arm_neon.h>
+#endif
+
+
+namespace LLGL
+{
+
+
+// Strided source and destination of a single vertex attribute.
+struct VertexAttributeStream
+{
+    const char*     src;
+    std::size_t     srcStride;
+    char*           dst;
+    std::size_t     dstStride;
+    std::uint32_t   numComponents;
+};
+
+// Kernel to quantize the vertex attributes in the range [begin, end) of the specified stream.
+using VertexQuantizationKernel = void (*)(const VertexAttributeStream& stream, std::size_t begin, std::size_t end);
+
+// Three-component attributes are padded to four components unless they are packed into a single vector.
+static std::uint32_t GetPaddedComponents(std::uint32_t numComponents)
+{
+    return (numComponents == 3 ? 4 : numComponents);
+}
+
+// Returns the number of leading vertices in [begin, end) whose 16-byte load does not read past the last source attribute.
+static std::size_t GetVectorLoadEnd(const VertexAttributeStream& stream, std::size_t begin, std::size_t end)
+{
+    if (begin >= end || stream.srcStride == 0)
+        return begin;
+    const std::size_t srcEnd = (end - 1) * stream.srcStride + stream.numComponents * sizeof(float);
+    if (srcEnd < sizeof(float) * 4)
+        return begin;
+    const std::size_t lastLoad = (srcEnd - sizeof(float) * 4) / stream.srcStride + 1;
+    return (lastLoad < end ? (lastLoad > begin ? lastLoad : begin) : end);
+}
+
+
+/*
+ * Scalar kernels
+ *
+ * These are used for the remainder of each range that does not fill an entire SIMD register.
+ * Clamping is written such that NaN maps to the lower bound like MAXPS does with the bound as second operand.
+ */
+
+static float ClampFloat(float x, float lo, float hi)
+{
+    x = (x > lo ? x : lo);
+    return (x < hi ? x : hi);
+}
+
+static void LoadVertexAttribute(const VertexAttributeStream& stream, std::size_t i, float (&v)[4])
+{
+    v[0] = 0.0f;
+    v[1] = 0.0f;
+    v[2] = 0.0f;
+    v[3] = 1.0f;
+    std::memcpy(v, stream.src + i * stream.srcStride, stream.numComponents * sizeof(float));
+}
+
+static std::uint16_t QuantizeUNorm16(float x)
+{
+    return static_cast<std::uint16_t>(std::lrint(ClampFloat(x, 0.0f, 1.0f) * 65535.0f));
+}
+
+static std::int16_t QuantizeSNorm16(float x)
+{
+    return static_cast<std::int16_t>(std::lrint(ClampFloat(x, -1.0f, 1.0f) * 32767.0f));
+}
+
+static std::int8_t QuantizeSNorm8(float x)
+{
+    return static_cast<std::int8_t>(std::lrint(ClampFloat(x, -1.0f, 1.0f) * 127.0f));
+}
+
+template <typename T, T (*Quantize)(float)>
+static void QuantizeComponentsScalar(const VertexAttributeStream& stream, std::size_t begin, std::size_t end)
+{
+    const std::uint32_t numDstComponents = GetPaddedComponents(stream.numComponents);
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        float v[4];
+        LoadVertexAttribute(stream, i, v);
+
+        T q[4];
+        for_range(c, numDstComponents)
+            q[c] = Quantize(v[c]);
+
+        std::memcpy(stream.dst + i * stream.dstStride, q, sizeof(T) * numDstComponents);
+    }
+}
+
+static void QuantizeRGB10A2Scalar(const VertexAttributeStream& stream, std::size_t begin, std::size_t end)
+{
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        float v[4];
+        LoadVertexAttribute(stream, i, v);
+
+        const std::uint32_t r = static_cast<std::uint32_t>(std::lrint(ClampFloat(v[0] * 0.5f + 0.5f, 0.0f, 1.0f) * 1023.0f));
+        const std::uint32_t g = static_cast<std::uint32_t>(std::lrint(ClampFloat(v[1] * 0.5f + 0.5f, 0.0f, 1.0f) * 1023.0f));
+        const std::uint32_t b = static_cast<std::uint32_t>(std::lrint(ClampFloat(v[2] * 0.5f + 0.5f, 0.0f, 1.0f) * 1023.0f));
+        const std::uint32_t a = (v[3] < 0.0f ? 0u : 3u);
+
+        const std::uint32_t bits = (r | (g << 10) | (b << 20) | (a << 30));
+        std::memcpy(stream.dst + i * stream.dstStride, &bits, sizeof(bits));
+    }
+}
+
+// Projects the vector onto the octahedron and unfolds the lower hemisphere into the corners of the unit square.
+static void EncodeOctahedral(const float (&v)[4], float& ex, float& ey)
+{
+    const float sum     = std::fabs(v[0]) + std::fabs(v[1]) + std::fabs(v[2]);
+    const float invSum  = (sum > 0.0f ? 1.0f / sum : 0.0f);
+
+    const float ox = v[0] * invSum;
+    const float oy = v[1] * invSum;
+
+    if (v[2] < 0.0f)
+    {
+        ex = (1.0f - std::fabs(oy)) * (ox >= 0.0f ? 1.0f : -1.0f);
+        ey = (1.0f - std::fabs(ox)) * (oy >= 0.0f ? 1.0f : -1.0f);
+    }
+    else
+    {
+        ex = ox;
+        ey = oy;
+    }
+}
+
+template <typename T, T (*Quantize)(float)>
+static void QuantizeOctahedralScalar(const VertexAttributeStream& stream, std::size_t begin, std::size_t end)
+{
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        float v[4];
+        LoadVertexAttribute(stream, i, v);
+
+        float ex, ey;
+        EncodeOctahedral(v, ex, ey);
+
+        const T q[2] = { Quantize(ex), Quantize(ey) };
+        std::memcpy(stream.dst + i * stream.dstStride, q, sizeof(q));
+    }
+}
+
+static void QuantizeFloat16Kernel_Scalar(const VertexAttributeStream& stream, std::size_t begin, std::size_t end)
+{
+    QuantizeComponentsScalar<std::uint16_t, CompressFloat16>(stream, begin, end);
+}
+
+static void QuantizeUNorm16Kernel_Scalar(const VertexAttributeStream& stream, std::size_t begin, std::size_t end)
+{
+    QuantizeComponentsScalar<std::uint16_t, QuantizeUNorm16>(stream, begin, end);
+}
+
+static void QuantizeSNorm16Kernel_Scalar(const VertexAttributeStream& stream, std::size_t begin, std::size_t end)
+{
+    QuantizeComponentsScalar<std::int16_t, QuantizeSNorm16>(stream, begin, end);
+}
+
+static void QuantizeOctahedral16Kernel_Scalar(const VertexAttributeStream& stream, std::size_t begin, std::size_t end)
+{
+    QuantizeOctahedralScalar<std::int16_t, QuantizeSNorm16>(stream, begin, end);
+}
+
+static void QuantizeOctahedral8Kernel_Scalar(const VertexAttributeStream& stream, std::size_t begin, std::size_t end)
+{
+    QuantizeOctahedralScalar<std::int8_t, QuantizeSNorm8>(stream, begin, end);
+}
+
+
+#if defined LLGL_SIMD_X86
+
+/*
+ * SSE4.1/F16C kernels
+ */
+
+// Loads one source attribute and sets the fourth component to 1 for three-component attributes.
+LLGL_TARGET_SIMD("sse4.1")
+static __m128 LoadVertexAttributeSSE41(const VertexAttributeStream& stream, std::size_t i)
+{
+    const __m128 v = _mm_loadu_ps(reinterpret_cast<const float*>(stream.src + i * stream.srcStride));
+    return (stream.numComponents == 3 ? _mm_blend_ps(v, _mm_set1_ps(1.0f), 0x8) : v);
+}
+
+// Stores the lower 'size' bytes of the specified register into the destination attribute.
+LLGL_TARGET_SIMD("sse4.1")
+static void StoreVertexAttributeSSE41(const VertexAttributeStream& stream, std::size_t i, __m128i v, std::size_t size)
+{
+    std::uint64_t bits;
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(&bits), v);
+    std::memcpy(stream.dst + i * stream.dstStride, &bits, size);
+}
+
+LLGL_TARGET_SIMD("sse4.1")
+static void QuantizeUNorm16SSE41(const VertexAttributeStream& stream, std::size_t begin, std::size_t end)
+{
+    const __m128        zero    = _mm_setzero_ps();
+    const __m128        one     = _mm_set1_ps(1.0f);
+    const __m128        scale   = _mm_set1_ps(65535.0f);
+    const std::size_t   size    = GetPaddedComponents(stream.numComponents) * sizeof(std::uint16_t);
+
+    std::size_t i = begin;
+    for (const std::size_t vectorEnd = GetVectorLoadEnd(stream, begin, end); i < vectorEnd; ++i)
+    {
+        const __m128 v = _mm_min_ps(_mm_max_ps(LoadVertexAttributeSSE41(stream, i), zero), one);
+        const __m128i q = _mm_cvtps_epi32(_mm_mul_ps(v, scale));
+        StoreVertexAttributeSSE41(stream, i, _mm_packus_epi32(q, q), size);
+    }
+    QuantizeUNorm16Kernel_Scalar(stream, i, end);
+}
+
+LLGL_TARGET_SIMD("sse4.1")
+static void QuantizeSNorm16SSE41(const VertexAttributeStream& stream, std::size_t begin, std::size_t end)
+{
+    const __m128        minusOne    = _mm_set1_ps(-1.0f);
+    const __m128        one         = _mm_set1_ps(1.0f);
+    const __m128        scale       = _mm_set1_ps(32767.0f);
+    const std::size_t   size        = GetPaddedComponents(stream.numComponents) * sizeof(std::int16_t);
+
+    std::size_t i = begin;
+    for (const std::size_t vectorEnd = GetVectorLoadEnd(stream, begin, end); i < vectorEnd; ++i)
+    {
+        const __m128 v = _mm_min_ps(_mm_max_ps(LoadVertexAttributeSSE41(stream, i), minusOne), one);
+        const __m128i q = _mm_cvtps_epi32(_mm_mul_ps(v, scale));
+        StoreVertexAttributeSSE41(stream, i, _mm_packs_epi32(q, q), size);
+    }
+    QuantizeSNorm16Kernel_Scalar(stream, i, end);
+}
+
+LLGL_TARGET_SIMD("avx,f16c")
+static void QuantizeFloat16F16C(const VertexAttributeStream& stream, std::size_t begin, std::size_t end)
+{
+    const std::size_t size = GetPaddedComponents(stream.numComponents) * sizeof(std::uint16_t);
+
+    /* Round to nearest even like the scalar compressor */
+    std::size_t i = begin;
+    for (const std::size_t vectorEnd = GetVectorLoadEnd(stream, begin, end); i < vectorEnd; ++i)
+        StoreVertexAttributeSSE41(stream, i, _mm_cvtps_ph(LoadVertexAttributeSSE41(stream, i), _MM_FROUND_TO_NEAREST_INT), size);
+    QuantizeFloat16Kernel_Scalar(stream, i, end);
+}
+
+LLGL_TARGET_SIMD("sse4.1")
+static void QuantizeRGB10A2SSE41(const VertexAttributeStream& stream, std::size_t begin, std::size_t end)
+{
+    const __m128    zero    = _mm_setzero_ps();
+    const __m128    half    = _mm_set1_ps(0.5f);
+    const __m128    one     = _mm_set1_ps(1.0f);
+    const __m128    scale   = _mm_set1_ps(1023.0f);
+    const __m128i   shifts  = _mm_setr_epi32(1, 1 << 10, 1 << 20, 0);
+
+    std::size_t i = begin;
+    for (const std::size_t vectorEnd = GetVectorLoadEnd(stream, begin, end); i < vectorEnd; ++i)
+    {
+        const __m128 v = LoadVertexAttributeSSE41(stream, i);
+        const __m128 t = _mm_min_ps(_mm_max_ps(_mm_add_ps(_mm_mul_ps(v, half), half), zero), one);
+
+        /* Shift the components into place and combine them with two horizontal additions, since their bits do not overlap */
+        __m128i q = _mm_mullo_epi32(_mm_cvtps_epi32(_mm_mul_ps(t, scale)), shifts);
+        q = _mm_add_epi32(q, _mm_shuffle_epi32(q, _MM_SHUFFLE(1, 0, 3, 2)));
+        q = _mm_add_epi32(q, _mm_shuffle_epi32(q, _MM_SHUFFLE(2, 3, 0, 1)));
+
+        const std::uint32_t a = (_mm_cvtss_f32(_mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3))) < 0.0f ? 0u : 3u);
+        const std::uint32_t bits = static_cast<std::uint32_t>(_mm_cvtsi128_si32(q)) | (a << 30);
+        std::memcpy(stream.dst + i * stream.dstStride, &bits, sizeof(bits));
+    }
+    QuantizeRGB10A2Scalar(stream, i, end);
+}
+
+// Encodes four vectors in SoA layout and returns the quantized X and Y coordinates as 32-bit integers.
+LLGL_TARGET_SIMD("sse4.1")
+static void EncodeOctahedralSSE41(__m128 x, __m128 y, __m128 z, __m128 scale, __m128i& qx, __m128i& qy)
+{
+    const __m128 zero       = _mm_setzero_ps();
+    const __m128 one        = _mm_set1_ps(1.0f);
+    const __m128 minusOne   = _mm_set1_ps(-1.0f);
+    const __m128 absMask    = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+
+    /* Divide by the L1 norm; CMPGTPS is false for NaN, so degenerate vectors map to the origin */
+    const __m128 sum    = _mm_add_ps(_mm_add_ps(_mm_and_ps(x, absMask), _mm_and_ps(y, absMask)), _mm_and_ps(z, absMask));
+    const __m128 invSum = _mm_and_ps(_mm_div_ps(one, sum), _mm_cmpgt_ps(sum, zero));
+
+    const __m128 ox = _mm_mul_ps(x, invSum);
+    const __m128 oy = _mm_mul_ps(y, invSum);
+
+    /* Unfold lower hemisphere */
+    const __m128 sx = _mm_blendv_ps(minusOne, one, _mm_cmpge_ps(ox, zero));
+    const __m128 sy = _mm_blendv_ps(minusOne, one, _mm_cmpge_ps(oy, zero));
+    const __m128 fx = _mm_mul_ps(_mm_sub_ps(one, _mm_and_ps(oy, absMask)), sx);
+    const __m128 fy = _mm_mul_ps(_mm_sub_ps(one, _mm_and_ps(ox, absMask)), sy);
+
+    const __m128 lower = _mm_cmplt_ps(z, zero);
+    const __m128 ex = _mm_blendv_ps(ox, fx, lower);
+    const __m128 ey = _mm_blendv_ps(oy, fy, lower);
+
+    qx = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(ex, minusOne), one), scale));
+    qy = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(ey, minusOne), one), scale));
+}
+
+// Gathers the XYZ coordinates of four consecutive source vectors into SoA layout.
+LLGL_TARGET_SIMD("sse4.1")
+static void GatherVectors4SSE41(const VertexAttributeStream& stream, std::size_t i, __m128& x, __m128& y, __m128& z)
+{
+    const float* v0 = reinterpret_cast<const float*>(stream.src + (i    ) * stream.srcStride);
+    const float* v1 = reinterpret_cast<const float*>(stream.src + (i + 1) * stream.srcStride);
+    const float* v2 = reinterpret_cast<const float*>(stream.src + (i + 2) * stream.srcStride);
+    const float* v3 = reinterpret_cast<const float*>(stream.src + (i + 3) * stream.srcStride);
+    x = _mm_setr_ps(v0[0], v1[0], v2[0], v3[0]);
+    y = _mm_setr_ps(v0[1], v1[1], v2[1], v3[1]);
+    z = _mm_setr_ps(v0[2], v1[2], v2[2], v3[2]);
+}
+
+LLGL_TARGET_SIMD("sse4.1")
+static void QuantizeOctahedral16SSE41(const VertexAttributeStream& stream, std::size_t begin, std::size_t end)
+{
+    const __m128 scale = _mm_set1_ps(32767.0f);
+
+    std::size_t i = begin;
+    for (; i + 4 <= end; i += 4)
+    {
+        __m128 x, y, z;
+        GatherVectors4SSE41(stream, i, x, y, z);
+
+        __m128i qx, qy;
+        EncodeOctahedralSSE41(x, y, z, scale, qx, qy);
+
+        /* Interleave to (x0, y0, x1, y1, x2, y2, x3, y3) and store one DWORD per vertex */
+        const __m128i q = _mm_packs_epi32(_mm_unpacklo_epi32(qx, qy), _mm_unpackhi_epi32(qx, qy));
+        const std::int32_t q0 = _mm_extract_epi32(q, 0);
+        const std::int32_t q1 = _mm_extract_epi32(q, 1);
+        const std::int32_t q2 = _mm_extract_epi32(q, 2);
+        const std::int32_t q3 = _mm_extract_epi32(q, 3);
+        std::memcpy(stream.dst + (i    ) * stream.dstStride, &q0, sizeof(q0));
+        std::memcpy(stream.dst + (i + 1) * stream.dstStride, &q1, sizeof(q1));
+        std::memcpy(stream.dst + (i + 2) * stream.dstStride, &q2, sizeof(q2));
+        std::memcpy(stream.dst + (i + 3) * stream.dstStride, &q3, sizeof(q3));
+    }
+    QuantizeOctahedral16Kernel_Scalar(stream, i, end);
+}
+
+LLGL_TARGET_SIMD("sse4.1")
+static void QuantizeOctahedral8SSE41(const VertexAttributeStream& stream, std::size_t begin, std::size_t end)
+{
+    const __m128 scale = _mm_set1_ps(127.0f);
+
+    std::size_t i = begin;
+    for (; i + 4 <= end; i += 4)
+    {
+        __m128 x, y, z;
+        GatherVectors4SSE41(stream, i, x, y, z);
+
+        __m128i qx, qy;
+        EncodeOctahedralSSE41(x, y, z, scale, qx, qy);
+
+        /* Interleave to (x0, y0, x1, y1, x2, y2, x3, y3) and store one WORD per vertex */
+        __m128i q = _mm_packs_epi32(_mm_unpacklo_epi32(qx, qy), _mm_unpackhi_epi32(qx, qy));
+        q = _mm_packs_epi16(q, q);
+        const std::uint16_t q0 = static_cast<std::uint16_t>(_mm_extract_epi16(q, 0));
+        const std::uint16_t q1 = static_cast<std::uint16_t>(_mm_extract_epi16(q, 1));
+        const std::uint16_t q2 = static_cast<std::uint16_t>(_mm_extract_epi16(q, 2));
+        const std::uint16_t q3 = static_cast<std::uint16_t>(_mm_extract_epi16(q, 3));
+        std::memcpy(stream.dst + (i    ) * stream.dstStride, &q0, sizeof(q0));
+        std::memcpy(stream.dst + (i + 1) * stream.dstStride, &q1, sizeof(q1));
+        std::memcpy(stream.dst + (i + 2) * stream.dstStride, &q2, sizeof(q2));
+        std::memcpy(stream.dst + (i + 3) * stream.dstStride, &q3, sizeof(q3));
+    }
+    QuantizeOctahedral8Kernel_Scalar(stream, i, end);
+}
+
+#elif defined LLGL_SIMD_NEON
+
+/*
+ * NEON kernels
+ *
+ * FMAXNM/FMINNM return the numeric operand if the other one is NaN, which matches the clamping of the scalar kernels.
+ */
+
+// Loads one source attribute and sets the fourth component to 1 for three-component attributes.
+static float32x4_t LoadVertexAttributeNEON(const VertexAttributeStream& stream, std::size_t i)
+{
+    const float32x4_t v = vld1q_f32(reinterpret_cast<const float*>(stream.src + i * stream.srcStride));
+    return (stream.numComponents == 3 ? vsetq_lane_f32(1.0f, v, 3) : v);
+}
+
+static float32x4_t ClampNEON(float32x4_t v, float lo, float hi)
+{
+    return vminnmq_f32(vmaxnmq_f32(v, vdupq_n_f32(lo)), vdupq_n_f32(hi));
+}
+
+static void QuantizeUNorm16NEON(const VertexAttributeStream& stream, std::size_t begin, std::size_t end)
+{
+    const std::size_t size = GetPaddedComponents(stream.numComponents) * sizeof(std::uint16_t);
+
+    std::size_t i = begin;
+    for (const std::size_t vectorEnd = GetVectorLoadEnd(stream, begin, end); i < vectorEnd; ++i)
+    {
+        const float32x4_t v = ClampNEON(LoadVertexAttributeNEON(stream, i), 0.0f, 1.0f);
+        std::uint16_t q[4];
+        vst1_u16(q, vqmovn_u32(vcvtnq_u32_f32(vmulq_n_f32(v, 65535.0f))));
+        std::memcpy(stream.dst + i * stream.dstStride, q, size);
+    }
+    QuantizeUNorm16Kernel_Scalar(stream, i, end);
+}
+
+static void QuantizeSNorm16NEON(const VertexAttributeStream& stream, std::size_t begin, std::size_t end)
+{
+    const std::size_t size = GetPaddedComponents(stream.numComponents) * sizeof(std::int16_t);
+
+    std::size_t i = begin;
+    for (const std::size_t vectorEnd = GetVectorLoadEnd(stream, begin, end); i < vectorEnd; ++i)
+    {
+        const float32x4_t v = ClampNEON(LoadVertexAttributeNEON(stream, i), -1.0f, 1.0f);
+        std::int16_t q[4];
+        vst1_s16(q, vqmovn_s32(vcvtnq_s32_f32(vmulq_n_f32(v, 32767.0f))));
+        std::memcpy(stream.dst + i * stream.dstStride, q, size);
+    }
+    QuantizeSNorm16Kernel_Scalar(stream, i, end);
+}
+
+static void QuantizeFloat16NEON(const VertexAttributeStream& stream, std::size_t begin, std::size_t end)
+{
+    const std::size_t size = GetPaddedComponents(stream.numComponents) * sizeof(std::uint16_t);
+
+    std::size_t i = begin;
+    for (const std::size_t vectorEnd = GetVectorLoadEnd(stream, begin, end); i < vectorEnd; ++i)
+    {
+        std::uint16_t q[4];
+        vst1_u16(q, vreinterpret_u16_f16(vcvt_f16_f32(LoadVertexAttributeNEON(stream, i))));
+        std::memcpy(stream.dst + i * stream.dstStride, q, size);
+    }
+    QuantizeFloat16Kernel_Scalar(stream, i, end);
+}
+
+static void QuantizeRGB10A2NEON(const VertexAttributeStream& stream, std::size_t begin, std::size_t end)
+{
+    const std::int32_t shiftsData[4] = { 0, 10, 20, 0 };
+    const int32x4_t shifts = vld1q_s32(shiftsData);
+
+    std::size_t i = begin;
+    for (const std::size_t vectorEnd = GetVectorLoadEnd(stream, begin, end); i < vectorEnd; ++i)
+    {
+        const float32x4_t v = LoadVertexAttributeNEON(stream, i);
+        const float32x4_t t = ClampNEON(vaddq_f32(vmulq_n_f32(v, 0.5f), vdupq_n_f32(0.5f)), 0.0f, 1.0f);
+
+        /* Shift the components into place and combine them with a horizontal addition, since their bits do not overlap */
+        uint32x4_t q = vshlq_u32(vcvtnq_u32_f32(vmulq_n_f32(t, 1023.0f)), shifts);
+        q = vsetq_lane_u32(0u, q, 3);
+
+        const std::uint32_t a = (vgetq_lane_f32(v, 3) < 0.0f ? 0u : 3u);
+        const std::uint32_t bits = vaddvq_u32(q) | (a << 30);
+        std::memcpy(stream.dst + i * stream.dstStride, &bits, sizeof(bits));
+    }
+    QuantizeRGB10A2Scalar(stream, i, end);
+}
+
+// Encodes four vectors of the specified stream and returns the quantized X and Y coordinates as 32-bit integers.
+static void EncodeOctahedral4NEON(const VertexAttributeStream& stream, std::size_t i, float scale, int32x4_t& qx, int32x4_t& qy)
+{
+    /* Gather XYZ coordinates into SoA layout */
+    float xyz[3][4];
+    for_range(j, 4)
+    {
+        const float* v = reinterpret_cast<const float*>(stream.src + (i + j) * stream.srcStride);
+        xyz[0][j] = v[0];
+        xyz[1][j] = v[1];
+        xyz[2][j] = v[2];
+    }
+
+    const float32x4_t x         = vld1q_f32(xyz[0]);
+    const float32x4_t y         = vld1q_f32(xyz[1]);
+    const float32x4_t z         = vld1q_f32(xyz[2]);
+    const float32x4_t zero      = vdupq_n_f32(0.0f);
+    const float32x4_t one       = vdupq_n_f32(1.0f);
+    const float32x4_t minusOne  = vdupq_n_f32(-1.0f);
+
+    /* Divide by the L1 norm; FCMGT is false for NaN, so degenerate vectors map to the origin */
+    const float32x4_t sum       = vaddq_f32(vaddq_f32(vabsq_f32(x), vabsq_f32(y)), vabsq_f32(z));
+    const float32x4_t invSum    = vbslq_f32(vcgtq_f32(sum, zero), vdivq_f32(one, sum), zero);
+
+    const float32x4_t ox = vmulq_f32(x, invSum);
+    const float32x4_t oy = vmulq_f32(y, invSum);
+
+    /* Unfold lower hemisphere */
+    const float32x4_t sx = vbslq_f32(vcgeq_f32(ox, zero), one, minusOne);
+    const float32x4_t sy = vbslq_f32(vcgeq_f32(oy, zero), one, minusOne);
+    const float32x4_t fx = vmulq_f32(vsubq_f32(one, vabsq_f32(oy)), sx);
+    const float32x4_t fy = vmulq_f32(vsubq_f32(one, vabsq_f32(ox)), sy);
+
+    const uint32x4_t lower = vcltq_f32(z, zero);
+    const float32x4_t ex = vbslq_f32(lower, fx, ox);
+    const float32x4_t ey = vbslq_f32(lower, fy, oy);
+
+    qx = vcvtnq_s32_f32(vmulq_n_f32(ClampNEON(ex, -1.0f, 1.0f), scale));
+    qy = vcvtnq_s32_f32(vmulq_n_f32(ClampNEON(ey, -1.0f, 1.0f), scale));
+}
+
+static void QuantizeOctahedral16NEON(const VertexAttributeStream& stream, std::size_t begin, std::size_t end)
+{
+    std::size_t i = begin;
+    for (; i + 4 <= end; i += 4)
+    {
+        int32x4_t qx, qy;
+        EncodeOctahedral4NEON(stream, i, 32767.0f, qx, qy);
+
+        std::int16_t q[2][4];
+        vst1_s16(q[0], vqmovn_s32(qx));
+        vst1_s16(q[1], vqmovn_s32(qy));
+
+        for_range(j, 4)
+        {
+            const std::int16_t e[2] = { q[0][j], q[1][j] };
+            std::memcpy(stream.dst + (i + j) * stream.dstStride, e, sizeof(e));
+        }
+    }
+    QuantizeOctahedral16Kernel_Scalar(stream, i, end);
+}
+
+static void QuantizeOctahedral8NEON(const VertexAttributeStream& stream, std::size_t begin, std::size_t end)
+{
+    std::size_t i = begin;
+    for (; i + 4 <= end; i += 4)
+    {
+        int32x4_t qx, qy;
+        EncodeOctahedral4NEON(stream, i, 127.0f, qx, qy);
+
+        /* Narrow to (x0, x1, x2, x3, y0, y1, y2, y3) */
+        std::int8_t q[8];
+        vst1_s8(q, vqmovn_s16(vcombine_s16(vqmovn_s32(qx), vqmovn_s32(qy))));
+
+        for_range(j, 4)
+        {
+            const std::int8_t e[2] = { q[j], q[4 + j] };
+            std::memcpy(stream.dst + (i + j) * stream.dstStride, e, sizeof(e));
+        }
+    }
+    QuantizeOctahedral8Kernel_Scalar(stream, i, end);
+}
+
+#endif // /LLGL_SIMD_NEON
+
+
+/*
+ * Kernel selection
+ */
+
+static VertexQuantizationKernel SelectFloat16Kernel()
+{
+    #if defined LLGL_SIMD_X86
+    if (GetCPUFeatures().f16c)
+        return QuantizeFloat16F16C;
+    #elif defined LLGL_SIMD_NEON
+    return QuantizeFloat16NEON;
+    #endif
+    return QuantizeFloat16Kernel_Scalar;
+}
+
+static VertexQuantizationKernel SelectUNorm16Kernel()
+{
+    #if defined LLGL_SIMD_X86
+    if (GetCPUFeatures().sse41)
+        return QuantizeUNorm16SSE41;
+    #elif defined LLGL_SIMD_NEON
+    return QuantizeUNorm16NEON;
+    #endif
+    return QuantizeUNorm16Kernel_Scalar;
+}
+
+static VertexQuantizationKernel SelectSNorm16Kernel()
+{
+    #if defined LLGL_SIMD_X86
+    if (GetCPUFeatures().sse41)
+        return QuantizeSNorm16SSE41;
+    #elif defined LLGL_SIMD_NEON
+    return QuantizeSNorm16NEON;
+    #endif
+    return QuantizeSNorm16Kernel_Scalar;
+}
+
+static VertexQuantizationKernel SelectRGB10A2Kernel()
+{
+    #if defined LLGL_SIMD_X86
+    if (GetCPUFeatures().sse41)
+        return QuantizeRGB10A2SSE41;
+    #elif defined LLGL_SIMD_NEON
+    return QuantizeRGB10A2NEON;
+    #endif
+    return QuantizeRGB10A2Scalar;
+}
+
+static VertexQuantizationKernel SelectOctahedral16Kernel()
+{
+    #if defined LLGL_SIMD_X86
+    if (GetCPUFeatures().sse41)
+        return QuantizeOctahedral16SSE41;
+    #elif defined LLGL_SIMD_NEON
+    return QuantizeOctahedral16NEON;
+    #endif
+    return QuantizeOctahedral16Kernel_Scalar;
+}
+
+static VertexQuantizationKernel SelectOctahedral8Kernel()
+{
+    #if defined LLGL_SIMD_X86
+    if (GetCPUFeatures().sse41)
+        return QuantizeOctahedral8SSE41;
+    #elif defined LLGL_SIMD_NEON
+    return QuantizeOctahedral8NEON;
+    #endif
+    return QuantizeOctahedral8Kernel_Scalar;
+}
+
+static VertexQuantizationKernel FindVertexQuantizationKernel(VertexQuantization quantization)
+{
+    switch (quantization)
+    {
+        case VertexQuantization::Float16:
+        {
+            static const VertexQuantizationKernel kernel = SelectFloat16Kernel();
+            return kernel;
+        }
+        case VertexQuantization::UNorm16:
+        {
+            static const VertexQuantizationKernel kernel = SelectUNorm16Kernel();
+            return kernel;
+        }
+        case VertexQuantization::SNorm16:
+        {
+            static const VertexQuantizationKernel kernel = SelectSNorm16Kernel();
+            return kernel;
+        }
+        case VertexQuantization::PackedRGB10A2:
+        {
+            static const VertexQuantizationKernel kernel = SelectRGB10A2Kernel();
+            return kernel;
+        }
+        case VertexQuantization::Octahedral16:
+        {
+            static const VertexQuantizationKernel kernel = SelectOctahedral16Kernel();
+            return kernel;
+        }
+        case VertexQuantization::Octahedral8:
+        {
+            static const VertexQuantizationKernel kernel = SelectOctahedral8Kernel();
+            return kernel;
+        }
+        default:
+            return nullptr;
+    }
+}
+
+
+/*
+ * Global functions
+ */
+
+// Quantized formats for each VertexQuantization entry and number of source components.
+static const Format g_quantizedVertexFormats[][4] =
+{
+    /* None          */ { Format::R32Float,     Format::RG32Float,      Format::RGB32Float,     Format::RGBA32Float     },
+    /* Float16       */ { Format::R16Float,     Format::RG16Float,      Format::RGBA16Float,    Format::RGBA16Float     },
+    /* UNorm16       */ { Format::R16UNorm,     Format::RG16UNorm,      Format::RGBA16UNorm,    Format::RGBA16UNorm     },
+    /* SNorm16       */ { Format::R16SNorm,     Format::RG16SNorm,      Format::RGBA16SNorm,    Format::RGBA16SNorm     },
+    /* PackedRGB10A2 */ { Format::Undefined,    Format::Undefined,      Format::RGB10A2UNorm,   Format::RGB10A2UNorm    },
+    /* Octahedral16  */ { Format::Undefined,    Format::Undefined,      Format::RG16SNorm,      Format::Undefined       },
+    /* Octahedral8   */ { Format::Undefined,    Format::Undefined,      Format::RG8SNorm,       Format::Undefined       },
+};
+
+LLGL_EXPORT Format GetQuantizedVertexFormat(VertexQuantization quantization, std::uint32_t numComponents)
+{
+    const std::size_t index = static_cast<std::size_t>(quantization);
+    if (index < sizeof(g_quantizedVertexFormats)/sizeof(g_quantizedVertexFormats[0]) && numComponents >= 1 && numComponents <= 4)
+        return g_quantizedVertexFormats[index][numComponents - 1];
+    return Format::Undefined;
+}
+
+LLGL_EXPORT bool QuantizeVertexAttribute(
+    VertexQuantization  quantization,
+    std::uint32_t       numComponents,
+    std::size_t         numVertices,
+    const void*         srcData,
+    std::size_t         srcStride,
+    void*               dstData,
+    std::size_t         dstStride)
+{
+    if (GetQuantizedVertexFormat(quantization, numComponents) == Format::Undefined)
+        return false;
+
+    if (quantization == VertexQuantization::None)
+    {
+        /* Copy attributes as is */
+        for_range(i, numVertices)
+            std::memcpy(static_cast<char*>(dstData) + i * dstStride, static_cast<const char*>(srcData) + i * srcStride, numComponents * sizeof(float));
+        return true;
+    }
+
+    const VertexAttributeStream stream
+    {
+        static_cast<const char*>(srcData),
+        srcStride,
+        static_cast<char*>(dstData),
+        dstStride,
+        numComponents
+    };
+
+    VertexQuantizationKernel kernel = FindVertexQuantizationKernel(quantization);
+    kernel(stream, 0, numVertices);
+
+    return true;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
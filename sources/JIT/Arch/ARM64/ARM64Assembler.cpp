@@ -0,0 +1,402 @@
+/*
+ * ARM64Assembler.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "ARM64Assembler.h"
+#include "ARM64Opcode.h"
+#include "../../../Core/CoreUtils.h"
+#include <algorithm>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+namespace JIT
+{
+
+
+/*
+ * Internal members
+ */
+
+/*
+List of registers that are used for the first couple of arguments.
+The same registers are used by AAPCS64 (Linux, Android, Windows) and the Apple ARM64 ABI for non-variadic functions.
+see https://github.com/ARM-software/abi-aa/blob/main/aapcs64/aapcs64.rst#parameter-passing
+*/
+static const Reg g_arm64IntParams[] = { Reg::X0, Reg::X1, Reg::X2, Reg::X3, Reg::X4, Reg::X5, Reg::X6, Reg::X7 };
+static const Reg g_arm64FltParams[] = { Reg::V0, Reg::V1, Reg::V2, Reg::V3, Reg::V4, Reg::V5, Reg::V6, Reg::V7 };
+
+// Scratch registers for values and addresses; IP0 and IP1 are not preserved across calls.
+static const Reg g_arm64TempReg     = Reg::X16;
+static const Reg g_arm64AddrReg     = Reg::X17;
+
+static const std::size_t g_arm64IntParamsCount = sizeof(g_arm64IntParams)/sizeof(g_arm64IntParams[0]);
+static const std::size_t g_arm64FltParamsCount = sizeof(g_arm64FltParams)/sizeof(g_arm64FltParams[0]);
+
+
+/*
+ * Internal functions
+ */
+
+// Size of byte (1), word (2), dword (4), qword (8), ptr (8), stack-ptr (8), float (4), double (8)
+static std::uint32_t GetArgSize(const ArgType t)
+{
+    static const std::uint8_t sizes[] = { 1, 2, 4, 8, 8, 8, 4, 8 };
+    return sizes[static_cast<std::uint8_t>(t)];
+}
+
+/*
+Returns the size of the specified argument in the stack argument area.
+AAPCS64 rounds up each argument to 8 bytes, while the Apple ARM64 ABI only aligns them to their natural size.
+*/
+static std::uint32_t GetStackArgSize(const ArgType t)
+{
+    #ifdef __APPLE__
+    return GetArgSize(t);
+    #else
+    return std::max(8u, GetArgSize(t));
+    #endif
+}
+
+// Returns the 2-bit size field for load/store instructions: 1 byte (0), 2 bytes (1), 4 bytes (2), 8 bytes (3).
+static std::uint32_t GetLoadStoreSizeBits(std::uint32_t size)
+{
+    switch (size)
+    {
+        case 1:  return 0;
+        case 2:  return 1;
+        case 4:  return 2;
+        default: return 3;
+    }
+}
+
+
+/*
+ * ARM64Assembler class
+ */
+
+void ARM64Assembler::Begin()
+{
+    /* Reset data about local stack */
+    localStackSize_ = 0;
+    argStackSize_   = 0;
+    varArgOffsets_.clear();
+    stackChunkOffsets_.clear();
+
+    /* Write entry point prologue */
+    WritePrologue();
+    WriteStackFrame(GetEntryVarArgs(), GetStackAllocs());
+}
+
+void ARM64Assembler::End()
+{
+    /* Write entry point epilogue and finalize stack frame now that all calls are known */
+    WriteEpilogue();
+    PatchStackFrameSize();
+}
+
+void ARM64Assembler::WriteFuncCall(const void* addr, JITCallConv /*conv*/, bool /*farCall*/)
+{
+    std::size_t numIntRegs = 0, numFltRegs = 0;
+    std::uint32_t stackOffset = 0;
+
+    for (const auto& arg : GetArgs())
+    {
+        /* Determine destination register for argument */
+        const bool isFloat = IsFloat(arg.type);
+
+        if (isFloat && numFltRegs < g_arm64FltParamsCount)
+            WriteArgToReg(arg, g_arm64FltParams[numFltRegs++]);
+        else if (!isFloat && numIntRegs < g_arm64IntParamsCount)
+            WriteArgToReg(arg, g_arm64IntParams[numIntRegs++]);
+        else
+        {
+            /* Store remaining arguments in outgoing argument area in the order they are declared */
+            const std::uint32_t size = GetStackArgSize(arg.type);
+            stackOffset = GetAlignedSize(stackOffset, size);
+            WriteArgToStack(arg, stackOffset, size);
+            stackOffset += size;
+        }
+    }
+
+    /* Keep track of largest outgoing argument area */
+    argStackSize_ = std::max(argStackSize_, stackOffset);
+
+    /* Write 'call' instruction */
+    MovRegImm64(g_arm64TempReg, reinterpret_cast<std::uint64_t>(addr));
+    Blr(g_arm64TempReg);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool ARM64Assembler::IsLittleEndian() const
+{
+    return true;
+}
+
+void ARM64Assembler::WritePrologue()
+{
+    /* Store frame pointer (X29) and link register (X30), then set up new frame pointer */
+    WriteInstr(Opcode_StpFpLrPreIndex);
+    AddImm(Reg::X29, Reg::SP, 0);
+
+    /* Write placeholders for stack allocation; the frame size is only known after all calls have been encoded */
+    frameSizeInstrOffset_ = GetAssembly().size();
+    SubImm(Reg::SP, Reg::SP, 0x1000);
+    SubImm(Reg::SP, Reg::SP, 0);
+}
+
+void ARM64Assembler::WriteEpilogue()
+{
+    /* Release local stack and restore frame pointer and link register */
+    AddImm(Reg::SP, Reg::X29, 0);
+    WriteInstr(Opcode_LdpFpLrPostIndex);
+    Ret();
+}
+
+void ARM64Assembler::WriteStackFrame(
+    const std::vector<JIT::ArgType>&    varArgTypes,
+    const std::vector<std::uint32_t>&   stackChunks)
+{
+    /* Store parameters in local stack */
+    std::size_t numIntRegs = 0, numFltRegs = 0;
+    std::uint32_t paramStackOffset = 16; // first parameter at [X29+16], above preserved X29 and X30
+
+    for (auto type : varArgTypes)
+    {
+        const bool isFloat = IsFloat(type);
+        Reg srcReg = g_arm64TempReg;
+
+        if (isFloat && numFltRegs < g_arm64FltParamsCount)
+        {
+            /* Get parameter from floating-point register */
+            srcReg = g_arm64FltParams[numFltRegs++];
+        }
+        else if (!isFloat && numIntRegs < g_arm64IntParamsCount)
+        {
+            /* Get parameter from integer register */
+            srcReg = g_arm64IntParams[numIntRegs++];
+        }
+        else
+        {
+            /* Load parameter from stack */
+            const std::uint32_t size = GetStackArgSize(type);
+            paramStackOffset = GetAlignedSize(paramStackOffset, size);
+            LdrRegMem(srcReg, Reg::X29, paramStackOffset, size);
+            paramStackOffset += size;
+        }
+
+        /* Store parameter in local stack; floating-point registers are stored with 64 bits to cover both float and double */
+        localStackSize_ += 8;
+        SubImm(g_arm64AddrReg, Reg::X29, localStackSize_);
+        StrMemReg(g_arm64AddrReg, srcReg, 0, 8);
+
+        /* Store parameter offset within stack frame */
+        varArgOffsets_.push_back(localStackSize_);
+    }
+
+    /* Determine stack base for allocated stack chunks below the parameters */
+    stackChunkOffsets_.reserve(stackChunks.size());
+    for (auto chunk : stackChunks)
+    {
+        localStackSize_ += GetAlignedSize(chunk, 16u);
+        stackChunkOffsets_.push_back(localStackSize_);
+    }
+}
+
+void ARM64Assembler::PatchStackFrameSize()
+{
+    /* Stack pointer must always be 16-byte aligned */
+    const std::uint32_t frameSize = GetAlignedSize(localStackSize_, 16u) + GetAlignedSize(argStackSize_, 16u);
+    const std::uint32_t spNum = RegNum(Reg::SP);
+
+    const std::uint32_t instrs[2] =
+    {
+        (Opcode_SubImm64 | Operand_ShiftImm12 | (((frameSize >> 12) & 0xFFF) << 10) | (spNum << 5) | spNum),
+        (Opcode_SubImm64 |                      (( frameSize        & 0xFFF) << 10) | (spNum << 5) | spNum),
+    };
+
+    /* Override placeholder instructions */
+    ::memcpy(&(GetAssembly()[frameSizeInstrOffset_]), instrs, sizeof(instrs));
+}
+
+void ARM64Assembler::WriteArgToReg(const Arg& arg, Reg dstReg)
+{
+    if (arg.param < 0xF)
+    {
+        if (arg.param < varArgOffsets_.size())
+        {
+            /* Load parameter from local stack into destination register */
+            SubImm(g_arm64AddrReg, Reg::X29, varArgOffsets_[arg.param]);
+            LdrRegMem(dstReg, g_arm64AddrReg, 0, (IsFltReg(dstReg) ? GetArgSize(arg.type) : 8));
+        }
+        return;
+    }
+
+    /* Move value into destination register */
+    switch (arg.type)
+    {
+        case ArgType::StackPtr:
+            SubImm(dstReg, Reg::X29, stackChunkOffsets_[arg.value.i8]);
+            break;
+        case ArgType::Float:
+            MovRegImm64(g_arm64TempReg, arg.value.i64);
+            FMovRegReg(dstReg, g_arm64TempReg, 4);
+            break;
+        case ArgType::Double:
+            MovRegImm64(g_arm64TempReg, arg.value.i64);
+            FMovRegReg(dstReg, g_arm64TempReg, 8);
+            break;
+        default:
+            /* Byte, word, and dword values are zero-extended when stored in an argument */
+            MovRegImm64(dstReg, arg.value.i64);
+            break;
+    }
+}
+
+void ARM64Assembler::WriteArgToStack(const Arg& arg, std::uint32_t offset, std::uint32_t size)
+{
+    /* Move value into temporary register; floating-point values are stored with their raw bits */
+    if (arg.param < 0xF)
+    {
+        if (arg.param >= varArgOffsets_.size())
+            return;
+        SubImm(g_arm64AddrReg, Reg::X29, varArgOffsets_[arg.param]);
+        LdrRegMem(g_arm64TempReg, g_arm64AddrReg, 0, 8);
+    }
+    else if (arg.type == ArgType::StackPtr)
+        SubImm(g_arm64TempReg, Reg::X29, stackChunkOffsets_[arg.value.i8]);
+    else
+        MovRegImm64(g_arm64TempReg, arg.value.i64);
+
+    /* Store argument in outgoing argument area */
+    StrMemReg(Reg::SP, g_arm64TempReg, offset, size);
+}
+
+void ARM64Assembler::WriteInstr(std::uint32_t instr)
+{
+    WriteDWord(instr);
+}
+
+/* ----- MOV ----- */
+
+// Opcode: MOVZ/MOVK Xd, #imm16, LSL #(hw*16)
+void ARM64Assembler::MovRegImm64(Reg dstReg, std::uint64_t qword)
+{
+    if (qword == 0)
+    {
+        WriteInstr(Opcode_MovZ64 | RegNum(dstReg));
+        return;
+    }
+
+    /* Only write instructions for non-zero 16-bit chunks */
+    bool isFirst = true;
+    for (std::uint32_t hw = 0; hw < 4; ++hw)
+    {
+        const std::uint32_t imm16 = static_cast<std::uint32_t>((qword >> (hw * 16u)) & 0xFFFF);
+        if (imm16 != 0)
+        {
+            WriteInstr((isFirst ? Opcode_MovZ64 : Opcode_MovK64) | (hw << 21) | (imm16 << 5) | RegNum(dstReg));
+            isFirst = false;
+        }
+    }
+}
+
+// Opcode: FMOV Sd, Wn / FMOV Dd, Xn
+void ARM64Assembler::FMovRegReg(Reg dstFltReg, Reg srcReg, std::uint32_t size)
+{
+    WriteInstr((size == 8 ? Opcode_FMovDX : Opcode_FMovSW) | (RegNum(srcReg) << 5) | RegNum(dstFltReg));
+}
+
+/* ----- ADD ----- */
+
+// Opcode: ADD Xd|SP, Xn|SP, #imm12 {, LSL #12}
+void ARM64Assembler::AddImm(Reg dstReg, Reg srcReg, std::uint32_t value)
+{
+    if (value > 0xFFF)
+    {
+        WriteInstr(Opcode_AddImm64 | Operand_ShiftImm12 | (((value >> 12) & 0xFFF) << 10) | (RegNum(srcReg) << 5) | RegNum(dstReg));
+        value &= 0xFFF;
+        if (value == 0)
+            return;
+        srcReg = dstReg;
+    }
+    WriteInstr(Opcode_AddImm64 | (value << 10) | (RegNum(srcReg) << 5) | RegNum(dstReg));
+}
+
+/* ----- SUB ----- */
+
+// Opcode: SUB Xd|SP, Xn|SP, #imm12 {, LSL #12}
+void ARM64Assembler::SubImm(Reg dstReg, Reg srcReg, std::uint32_t value)
+{
+    if (value > 0xFFF)
+    {
+        WriteInstr(Opcode_SubImm64 | Operand_ShiftImm12 | (((value >> 12) & 0xFFF) << 10) | (RegNum(srcReg) << 5) | RegNum(dstReg));
+        value &= 0xFFF;
+        if (value == 0)
+            return;
+        srcReg = dstReg;
+    }
+    WriteInstr(Opcode_SubImm64 | (value << 10) | (RegNum(srcReg) << 5) | RegNum(dstReg));
+}
+
+/* ----- LDR/STR ----- */
+
+// Opcode: LDRB/LDRH/LDR Wt/LDR Xt/LDR St/LDR Dt [Xn|SP, #imm12]
+void ARM64Assembler::LdrRegMem(Reg dstReg, Reg srcMemReg, std::uint32_t offset, std::uint32_t size)
+{
+    if (offset % size != 0 || offset / size > 0xFFF)
+    {
+        /* Offset cannot be encoded as scaled immediate, so compute address first */
+        AddImm(g_arm64AddrReg, srcMemReg, offset);
+        srcMemReg   = g_arm64AddrReg;
+        offset      = 0;
+    }
+    const std::uint32_t opcode = (IsFltReg(dstReg) ? Opcode_StrFltImm : Opcode_StrImm) | Opcode_LdrBit;
+    WriteInstr(opcode | (GetLoadStoreSizeBits(size) << 30) | ((offset / size) << 10) | (RegNum(srcMemReg) << 5) | RegNum(dstReg));
+}
+
+// Opcode: STRB/STRH/STR Wt/STR Xt/STR St/STR Dt [Xn|SP, #imm12]
+void ARM64Assembler::StrMemReg(Reg dstMemReg, Reg srcReg, std::uint32_t offset, std::uint32_t size)
+{
+    if (offset % size != 0 || offset / size > 0xFFF)
+    {
+        /* Offset cannot be encoded as scaled immediate, so compute address first */
+        AddImm(g_arm64AddrReg, dstMemReg, offset);
+        dstMemReg   = g_arm64AddrReg;
+        offset      = 0;
+    }
+    const std::uint32_t opcode = (IsFltReg(srcReg) ? Opcode_StrFltImm : Opcode_StrImm);
+    WriteInstr(opcode | (GetLoadStoreSizeBits(size) << 30) | ((offset / size) << 10) | (RegNum(dstMemReg) << 5) | RegNum(srcReg));
+}
+
+/* ----- BLR ----- */
+
+void ARM64Assembler::Blr(Reg reg)
+{
+    WriteInstr(Opcode_Blr | (RegNum(reg) << 5));
+}
+
+/* ----- RET ----- */
+
+void ARM64Assembler::Ret()
+{
+    WriteInstr(Opcode_Ret);
+}
+
+
+} // /namespace JIT
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
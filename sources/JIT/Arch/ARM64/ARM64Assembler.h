@@ -0,0 +1,103 @@
+/*
+ * ARM64Assembler.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_ARM64_ASSEMBLER_H
+#define LLGL_ARM64_ASSEMBLER_H
+
+
+#include "ARM64Register.h"
+#include "../../JITCompiler.h"
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+namespace JIT
+{
+
+
+// ARM64 (a.k.a. AArch64) assembly code generator for the AAPCS64 and Apple ARM64 calling conventions.
+class ARM64Assembler final : public JITCompiler
+{
+
+    public:
+
+        void Begin() override;
+        void End() override;
+
+    private:
+
+        bool IsLittleEndian() const override;
+        void WriteFuncCall(const void* addr, JITCallConv conv, bool farCall) override;
+
+    private:
+
+        void WritePrologue();
+        void WriteEpilogue();
+
+        void WriteStackFrame(
+            const std::vector<JIT::ArgType>&    varArgTypes,
+            const std::vector<std::uint32_t>&   stackChunks
+        );
+
+        // Overrides the placeholder instructions of the prologue with the final stack frame size.
+        void PatchStackFrameSize();
+
+        // Moves the specified argument into the parameter register 'dstReg'.
+        void WriteArgToReg(const Arg& arg, Reg dstReg);
+
+        // Stores the specified argument in the outgoing argument area at [SP + offset].
+        void WriteArgToStack(const Arg& arg, std::uint32_t offset, std::uint32_t size);
+
+    private:
+
+        void WriteInstr(std::uint32_t instr);
+
+        void MovRegImm64(Reg dstReg, std::uint64_t qword);
+        void FMovRegReg(Reg dstFltReg, Reg srcReg, std::uint32_t size);
+
+        void AddImm(Reg dstReg, Reg srcReg, std::uint32_t value);
+        void SubImm(Reg dstReg, Reg srcReg, std::uint32_t value);
+
+        void LdrRegMem(Reg dstReg, Reg srcMemReg, std::uint32_t offset, std::uint32_t size);
+        void StrMemReg(Reg dstMemReg, Reg srcReg, std::uint32_t offset, std::uint32_t size);
+
+        void Blr(Reg reg);
+        void Ret();
+
+    private:
+
+        // Byte offset of the 'SUB SP' instructions within the prologue that are patched with the final frame size.
+        std::size_t                 frameSizeInstrOffset_   = 0;
+
+        // Size of the local stack (entry point parameters and stack allocations) below the frame pointer.
+        std::uint32_t               localStackSize_         = 0;
+
+        // Maximum size of the outgoing argument area for all function calls.
+        std::uint32_t               argStackSize_           = 0;
+
+        // Frame pointer offsets (subtracted from X29) of the entry point parameters.
+        std::vector<std::uint32_t>  varArgOffsets_;
+
+        // Frame pointer offsets (subtracted from X29) of stack allocations.
+        std::vector<std::uint32_t>  stackChunkOffsets_;
+
+};
+
+
+} // /namespace JIT
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,67 @@
+/*
+ * ARM64Opcode.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_ARM64_OPCODE_H
+#define LLGL_ARM64_OPCODE_H
+
+
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+namespace JIT
+{
+
+/*
+All ARM64 instructions are encoded as 32-bit little-endian words.
+Rd/Rt => bits [4:0], Rn => bits [9:5], Rt2 => bits [14:10]
+----------------------------------------------------------------------------------------
+| Instruction class:        | Layout                                                   |
+|---------------------------|----------------------------------------------------------|
+| Move wide (MOVZ/MOVK)     | sf opc 100101 hw:2 imm16:16 Rd:5                         |
+| Add/sub (immediate)       | sf op S 100010 sh:1 imm12:12 Rn:5 Rd:5                   |
+| Load/store (unsigned imm) | size:2 111 V 01 opc:2 imm12:12 Rn:5 Rt:5 (imm12 scaled)  |
+| Load/store pair           | opc:2 101 V 0xx L imm7:7 Rt2:5 Rn:5 Rt:5 (imm7 scaled)   |
+| Branch (register)         | 1101011 opc:4 11111 000000 Rn:5 00000                    |
+----------------------------------------------------------------------------------------
+*/
+
+enum Opcode : std::uint32_t
+{
+    Opcode_MovZ64           = 0xD2800000, // MOVZ Xd, #imm16, LSL #(hw*16)
+    Opcode_MovK64           = 0xF2800000, // MOVK Xd, #imm16, LSL #(hw*16)
+    Opcode_AddImm64         = 0x91000000, // ADD Xd|SP, Xn|SP, #imm12 {, LSL #12}
+    Opcode_SubImm64         = 0xD1000000, // SUB Xd|SP, Xn|SP, #imm12 {, LSL #12}
+    Opcode_StrImm           = 0x39000000, // STRB/STRH/STR Wt/STR Xt [Xn|SP, #imm12]; size in bits [31:30]
+    Opcode_StrFltImm        = 0x3D000000, // STR St/Dt [Xn|SP, #imm12]; size in bits [31:30]
+    Opcode_LdrBit           = 0x00400000, // Turns a store into a load instruction
+    Opcode_FMovSW           = 0x1E270000, // FMOV Sd, Wn
+    Opcode_FMovDX           = 0x9E670000, // FMOV Dd, Xn
+    Opcode_Blr              = 0xD63F0000, // BLR Xn
+    Opcode_Ret              = 0xD65F03C0, // RET (X30)
+    Opcode_StpFpLrPreIndex  = 0xA9BF7BFD, // STP X29, X30, [SP, #-16]!
+    Opcode_LdpFpLrPostIndex = 0xA8C17BFD, // LDP X29, X30, [SP], #16
+};
+
+enum OperandBits : std::uint32_t
+{
+    Operand_ShiftImm12  = 0x00400000, // Shift 12-bit immediate by 12 bits (bit 22)
+};
+
+
+} // /namespace JIT
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,38 @@
+/*
+ * ARM64Register.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "ARM64Register.h"
+
+
+namespace LLGL
+{
+
+namespace JIT
+{
+
+
+std::uint32_t RegNum(const Reg reg)
+{
+    if (reg >= Reg::V0)
+        return static_cast<std::uint32_t>(reg) - static_cast<std::uint32_t>(Reg::V0);
+    else
+        return static_cast<std::uint32_t>(reg) - static_cast<std::uint32_t>(Reg::X0);
+}
+
+bool IsFltReg(const Reg reg)
+{
+    return (reg >= Reg::V0 && reg <= Reg::V7);
+}
+
+
+} // /namespace JIT
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
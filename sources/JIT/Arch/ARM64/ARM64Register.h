@@ -0,0 +1,87 @@
+/*
+ * ARM64Register.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_ARM64_REGISTER_H
+#define LLGL_ARM64_REGISTER_H
+
+
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+namespace JIT
+{
+
+
+// ARM64 (a.k.a. AArch64) register enumeration.
+enum class Reg
+{
+    X0,
+    X1,
+    X2,
+    X3,
+    X4,
+    X5,
+    X6,
+    X7,
+
+    X8,
+    X9,
+    X10,
+    X11,
+    X12,
+    X13,
+    X14,
+    X15,
+
+    X16, // IP0: Intra-procedure-call scratch register
+    X17, // IP1: Intra-procedure-call scratch register
+    X18, // Platform register (reserved on Apple and Windows)
+    X19,
+    X20,
+    X21,
+    X22,
+    X23,
+
+    X24,
+    X25,
+    X26,
+    X27,
+    X28,
+    X29, // FP: Frame pointer
+    X30, // LR: Link register
+    SP,  // Stack pointer (encoded as 31 in load/store and arithmetic-immediate instructions)
+
+    V0,
+    V1,
+    V2,
+    V3,
+    V4,
+    V5,
+    V6,
+    V7,
+};
+
+// Returns the 5-bit register number of an ARM64 instruction.
+std::uint32_t RegNum(const Reg reg);
+
+// Returns true, if 'reg' denotes a floating-point/SIMD register (i.e. V0-V7).
+bool IsFltReg(const Reg reg);
+
+
+} // /namespace JIT
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -17,7 +17,9 @@
 #   include "Platform/POSIX/POSIXJITProgram.h"
 #endif
 
-#if defined LLGL_ARCH_ARM
+#if defined LLGL_ARCH_ARM64
+#   include "Arch/ARM64/ARM64Assembler.h"
+#elif defined LLGL_ARCH_ARM
 //#   include "Arch/ARM/ARMAssembler.h"
 #elif defined LLGL_ARCH_AMD64
 #   include "Arch/AMD64/AMD64Assembler.h"
@@ -37,7 +39,9 @@ std::unique_ptr<JITCompiler> JITCompiler::Create()
     std::unique_ptr<JITCompiler> compiler;
 
     /* Create JIT compiler for current CPU architecture */
-    #if defined LLGL_ARCH_ARM
+    #if defined LLGL_ARCH_ARM64
+    compiler = MakeUnique<ARM64Assembler>();
+    #elif defined LLGL_ARCH_ARM
     //TODO
     #elif defined LLGL_ARCH_AMD64
     compiler = MakeUnique<AMD64Assembler>();
@@ -106,9 +110,21 @@ std::uint8_t JITCompiler::StackAlloc(std::uint32_t size)
     return idx;
 }
 
+void JITCompiler::OverrideVarArg(std::uint8_t idx, const void* value)
+{
+    if (idx < entryVarArgs_.size())
+    {
+        if (idx >= varArgOverrides_.size())
+            varArgOverrides_.resize(idx + 1u, nullptr);
+        varArgOverrides_[idx] = value;
+    }
+}
+
 void JITCompiler::PushVarArg(std::uint8_t idx)
 {
-    if (idx < entryVarArgs_.size() && idx < 0xF)
+    if (idx < varArgOverrides_.size() && varArgOverrides_[idx] != nullptr)
+        PushPtr(varArgOverrides_[idx]);
+    else if (idx < entryVarArgs_.size() && idx < 0xF)
     {
         Arg arg;
         {
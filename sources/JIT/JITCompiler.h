@@ -73,7 +73,7 @@ class LLGL_EXPORT JITCompiler : public NonCopyable
         // Dumps the current assembly code to the output stream.
         void DumpAssembly(std::ostream& stream, bool textForm = false, std::size_t bytesPerLine = 8) const;
 
-        // Flushes the currently build program, or null if no program was build.
+        // Flushes the currently build program, or null if no program was build or it could not be mapped into executable memory.
         std::unique_ptr<JITProgram> FlushProgram();
 
     public:
@@ -91,6 +91,9 @@ class LLGL_EXPORT JITCompiler : public NonCopyable
         // Pushes the entry point parameter, specified by the zero-based index 'idx', to the argument list.
         void PushVarArg(std::uint8_t idx);
 
+        // Replaces all subsequent pushes of the entry point parameter 'idx' by the constant pointer 'value'. Null resets the override.
+        void OverrideVarArg(std::uint8_t idx, const void* value);
+
         // Pushes the ID of the specified stack allocation, specified by the zero-based index 'idx', to the argument list.
         void PushStackPtr(std::uint8_t idx);
 
@@ -221,6 +224,7 @@ class LLGL_EXPORT JITCompiler : public NonCopyable
         std::vector<JIT::Arg>       args_;
         std::vector<JIT::ArgType>   entryVarArgs_;
         std::vector<std::uint32_t>  stackAllocs_;
+        std::vector<const void*>    varArgOverrides_;
 
 };
 
@@ -29,7 +29,7 @@ class LLGL_EXPORT JITProgram : public NonCopyable
 
     public:
 
-        // Creates a new JIT program with the specified code.
+        // Creates a new JIT program with the specified code. Returns null if no executable memory can be mapped, e.g. in a hardened runtime without JIT entitlement.
         static std::unique_ptr<JITProgram> Create(const void* code, std::size_t size);
 
         // Returns the main entry point of the native JIT program.
@@ -7,11 +7,21 @@
 
 #include "POSIXJITProgram.h"
 #include "../../../Core/CoreUtils.h"
+#include <LLGL/Platform/Platform.h>
+#include <LLGL/Log.h>
 #include <cstdlib>
-#include <stdexcept>
+#include <string.h>
 #include <unistd.h> // sysconf
 #include <sys/mman.h> // mmap
 
+#if defined __APPLE__
+#   include <pthread.h> // pthread_jit_write_protect_np
+#   include <libkern/OSCacheControl.h> // sys_icache_invalidate
+#   ifdef MAP_JIT
+#       define LLGL_JIT_MAP_JIT
+#   endif
+#endif
+
 
 namespace LLGL
 {
@@ -19,35 +29,94 @@ namespace LLGL
 
 std::unique_ptr<JITProgram> JITProgram::Create(const void* code, std::size_t size)
 {
-    return MakeUnique<POSIXJITProgram>(code, size);
+    /* Return null if no executable memory could be mapped, so the caller can fall back to interpreting its commands */
+    std::unique_ptr<JITProgram> program = MakeUnique<POSIXJITProgram>(code, size);
+    if (program->GetEntryPoint() == nullptr)
+        return nullptr;
+    return program;
 }
 
-POSIXJITProgram::POSIXJITProgram(const void* code, std::size_t size) :
-    size_ { GetAlignedSize(size, std::size_t(sysconf(_SC_PAGE_SIZE))) }
+// Maps a private anonymous memory space with the specified protection mode. Returns null on failure.
+static void* MapAnonymousMemory(std::size_t size, int prot, int flags = 0)
 {
-    /* Map executable memory space */
-    addr_ = ::mmap(
+    void* addr = ::mmap(
         nullptr,
-        size_,
-        (PROT_READ | PROT_WRITE | PROT_EXEC),
-        (MAP_PRIVATE | MAP_ANONYMOUS),
+        size,
+        prot,
+        (MAP_PRIVATE | MAP_ANONYMOUS | flags),
         -1, // must be -1 if MAP_ANONYMOUS is used
         0
     );
+    return (addr != MAP_FAILED ? addr : nullptr);
+}
+
+// Instruction cache is not coherent with data cache on ARM, so it must be invalidated after new code has been written.
+static void InvalidateInstructionCache(void* addr, std::size_t size)
+{
+    #if defined __APPLE__
+    ::sys_icache_invalidate(addr, size);
+    #elif defined LLGL_ARCH_ARM64 || defined LLGL_ARCH_ARM
+    char* codeBegin = static_cast<char*>(addr);
+    __builtin___clear_cache(codeBegin, codeBegin + size);
+    #endif
+}
+
+POSIXJITProgram::POSIXJITProgram(const void* code, std::size_t size) :
+    size_ { GetAlignedSize(size, std::size_t(sysconf(_SC_PAGE_SIZE))) }
+{
+    #ifdef LLGL_JIT_MAP_JIT
+
+    /*
+    Apps with hardened runtime can only map executable memory with the MAP_JIT flag (requires the "com.apple.security.cs.allow-jit" entitlement).
+    Pages with MAP_JIT can never change their protection, so Apple Silicon enforces W^X with a per-thread write protection instead.
+    */
+    addr_ = MapAnonymousMemory(size_, (PROT_READ | PROT_WRITE | PROT_EXEC), MAP_JIT);
+    if (addr_ != nullptr)
+    {
+        #ifdef LLGL_ARCH_ARM64
+        ::pthread_jit_write_protect_np(0);
+        ::memcpy(addr_, code, size);
+        ::pthread_jit_write_protect_np(1);
+        #else
+        ::memcpy(addr_, code, size);
+        #endif
 
-    if (addr_ == MAP_FAILED)
-        throw std::runtime_error("failed to map executable virtual memory with read/write protection mode");
+        InvalidateInstructionCache(addr_, size);
+        SetEntryPoint(addr_);
+        return;
+    }
 
-    /* Copy code into executable memory space */
+    #endif // /LLGL_JIT_MAP_JIT
+
+    /* Map virtual memory space with read/write protection first to never have writable and executable pages at the same time */
+    addr_ = MapAnonymousMemory(size_, (PROT_READ | PROT_WRITE));
+    if (addr_ == nullptr)
+    {
+        Log::Errorf("failed to map virtual memory with read/write protection mode for JIT program\n");
+        return;
+    }
+
+    /* Copy code into memory space and make it executable */
     ::memcpy(addr_, code, size);
 
+    if (::mprotect(addr_, size_, (PROT_READ | PROT_EXEC)) != 0)
+    {
+        Log::Errorf("failed to change virtual memory to read/execute protection mode for JIT program\n");
+        ::munmap(addr_, size_);
+        addr_ = nullptr;
+        return;
+    }
+
+    InvalidateInstructionCache(addr_, size);
+
     /* Set function pointer to executable memory address */
     SetEntryPoint(addr_);
 }
 
-POSIXJITProgram::POSIXJITProgram()
+POSIXJITProgram::~POSIXJITProgram()
 {
-    munmap(addr_, size_);
+    if (addr_ != nullptr)
+        ::munmap(addr_, size_);
 }
 
 
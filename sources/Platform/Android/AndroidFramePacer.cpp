@@ -0,0 +1,220 @@
+/*
+ * AndroidFramePacer.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "AndroidFramePacer.h"
+#include "../../Core/CoreUtils.h"
+#include <LLGL/Display.h>
+#include <LLGL/Timer.h>
+#include <algorithm>
+#include <time.h>
+#include <unistd.h> // gettid
+
+
+namespace LLGL
+{
+
+
+// Display refresh rate (in Hz) that is assumed if the primary display does not report one.
+static constexpr std::uint32_t g_defaultRefreshRate = 60;
+
+// Number of consecutive frames that must miss or undercut the frame interval before the swap interval is adjusted.
+static constexpr std::uint32_t g_swapIntervalHysteresis = 10;
+
+std::unique_ptr<FramePacer> FramePacer::Create()
+{
+    return MakeUnique<AndroidFramePacer>();
+}
+
+AndroidFramePacer::AndroidFramePacer()
+{
+    /* Derive refresh period from primary display */
+    std::uint32_t refreshRate = g_defaultRefreshRate;
+    if (Display* display = Display::GetPrimary())
+    {
+        const DisplayMode displayMode = display->GetDisplayMode();
+        if (displayMode.refreshRate > 0)
+            refreshRate = displayMode.refreshRate;
+    }
+    refreshPeriod_ = static_cast<std::int64_t>(1000000000ull / refreshRate);
+
+    LoadPerformanceHintProcs();
+}
+
+AndroidFramePacer::~AndroidFramePacer()
+{
+    if (session_ != nullptr)
+        closeSession_(session_);
+}
+
+bool AndroidFramePacer::SetFramePacing(const FramePacingDescriptor& desc)
+{
+    if (desc.preferredFrameRate == 0)
+    {
+        /* Disable frame pacing */
+        minSwapInterval_    = 0;
+        maxSwapInterval_    = 0;
+        swapInterval_       = 0;
+        return true;
+    }
+
+    const std::uint32_t refreshRate     = static_cast<std::uint32_t>(1000000000ll / refreshPeriod_);
+    const std::uint32_t minFrameRate    = (desc.minFrameRate > 0 ? desc.minFrameRate : desc.preferredFrameRate);
+    const std::uint32_t maxFrameRate    = (desc.maxFrameRate > 0 ? desc.maxFrameRate : desc.preferredFrameRate);
+
+    /* Never exceed the maximum frame rate and never fall below the minimum frame rate, if possible */
+    minSwapInterval_    = std::max(1u, (refreshRate + maxFrameRate - 1) / maxFrameRate);
+    maxSwapInterval_    = std::max(minSwapInterval_, refreshRate / std::max(1u, minFrameRate));
+
+    /* Round preferred frame rate to the nearest integer fraction of the refresh rate */
+    const std::uint32_t preferredSwapInterval = (refreshRate + desc.preferredFrameRate/2) / desc.preferredFrameRate;
+    SetSwapInterval(Clamp(preferredSwapInterval, minSwapInterval_, maxSwapInterval_));
+
+    numMissedFrames_    = 0;
+    numFastFrames_      = 0;
+    frameBeginTime_     = 0;
+    lastPresentTime_    = 0;
+
+    return true;
+}
+
+void AndroidFramePacer::PaceFrame()
+{
+    if (swapInterval_ == 0)
+        return;
+
+    /* Report the CPU work duration of this frame, which excludes the time blocked in the previous swap */
+    std::uint64_t now = Timer::Tick();
+    if (frameBeginTime_ != 0)
+    {
+        const std::int64_t workDuration = static_cast<std::int64_t>(now - frameBeginTime_);
+
+        CreatePerformanceHintSession();
+        if (session_ != nullptr)
+            reportActualWorkDuration_(session_, workDuration);
+
+        AdjustSwapInterval(workDuration);
+    }
+
+    /* Wait until the frame interval has elapsed since the previous present; a frame that is late is presented immediately */
+    if (lastPresentTime_ != 0)
+    {
+        const std::uint64_t dueTime = lastPresentTime_ + static_cast<std::uint64_t>(GetFrameInterval(swapInterval_));
+        if (now < dueTime)
+        {
+            timespec t;
+            t.tv_sec    = static_cast<time_t>(dueTime / 1000000000ull);
+            t.tv_nsec   = static_cast<long>(dueTime % 1000000000ull);
+            ::clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &t, nullptr);
+            now = dueTime;
+        }
+    }
+
+    lastPresentTime_ = now;
+}
+
+void AndroidFramePacer::NotifyFramePresented()
+{
+    if (swapInterval_ != 0)
+        frameBeginTime_ = Timer::Tick();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool AndroidFramePacer::LoadPerformanceHintProcs()
+{
+    /* Performance Hint API is only available with API level 33 and later, so it must be loaded at runtime */
+    libAndroid_ = Module::Load("libandroid.so");
+    if (!libAndroid_)
+        return false;
+
+    getManager_                 = reinterpret_cast<PFN_APerformanceHint_getManager              >(libAndroid_->LoadProcedure("APerformanceHint_getManager"              ));
+    createSession_              = reinterpret_cast<PFN_APerformanceHint_createSession           >(libAndroid_->LoadProcedure("APerformanceHint_createSession"           ));
+    updateTargetWorkDuration_   = reinterpret_cast<PFN_APerformanceHint_updateTargetWorkDuration>(libAndroid_->LoadProcedure("APerformanceHint_updateTargetWorkDuration"));
+    reportActualWorkDuration_   = reinterpret_cast<PFN_APerformanceHint_reportActualWorkDuration>(libAndroid_->LoadProcedure("APerformanceHint_reportActualWorkDuration"));
+    closeSession_               = reinterpret_cast<PFN_APerformanceHint_closeSession            >(libAndroid_->LoadProcedure("APerformanceHint_closeSession"            ));
+
+    if (getManager_ == nullptr || createSession_ == nullptr || updateTargetWorkDuration_ == nullptr || reportActualWorkDuration_ == nullptr || closeSession_ == nullptr)
+    {
+        getManager_ = nullptr;
+        return false;
+    }
+
+    return true;
+}
+
+void AndroidFramePacer::CreatePerformanceHintSession()
+{
+    if (session_ != nullptr || getManager_ == nullptr)
+        return;
+
+    /* The session is bound to the thread that presents, which is not necessarily the thread that configured frame pacing */
+    if (APerformanceHintManager* manager = getManager_())
+    {
+        const std::int32_t threadID = static_cast<std::int32_t>(::gettid());
+        session_ = createSession_(manager, &threadID, 1, GetFrameInterval(swapInterval_));
+    }
+
+    /* Don't try again if the system does not support performance hint sessions */
+    if (session_ == nullptr)
+        getManager_ = nullptr;
+}
+
+std::int64_t AndroidFramePacer::GetFrameInterval(std::uint32_t swapInterval) const
+{
+    return refreshPeriod_ * static_cast<std::int64_t>(swapInterval);
+}
+
+void AndroidFramePacer::SetSwapInterval(std::uint32_t swapInterval)
+{
+    if (swapInterval_ != swapInterval)
+    {
+        swapInterval_ = swapInterval;
+        if (session_ != nullptr)
+            updateTargetWorkDuration_(session_, GetFrameInterval(swapInterval_));
+    }
+}
+
+void AndroidFramePacer::AdjustSwapInterval(std::int64_t workDuration)
+{
+    const std::int64_t frameInterval = GetFrameInterval(swapInterval_);
+
+    if (workDuration > frameInterval)
+    {
+        /* Drop to the next lower frame rate if frames consistently miss their interval, to avoid the judder of alternating intervals */
+        numFastFrames_ = 0;
+        if (++numMissedFrames_ >= g_swapIntervalHysteresis && swapInterval_ < maxSwapInterval_)
+        {
+            SetSwapInterval(swapInterval_ + 1);
+            numMissedFrames_ = 0;
+        }
+    }
+    else if (swapInterval_ > minSwapInterval_ && workDuration < GetFrameInterval(swapInterval_ - 1) - refreshPeriod_/2)
+    {
+        /* Raise to the next higher frame rate if frames consistently fit into its interval with some headroom */
+        numMissedFrames_ = 0;
+        if (++numFastFrames_ >= g_swapIntervalHysteresis)
+        {
+            SetSwapInterval(swapInterval_ - 1);
+            numFastFrames_ = 0;
+        }
+    }
+    else
+    {
+        numMissedFrames_    = 0;
+        numFastFrames_      = 0;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,97 @@
+/*
+ * AndroidFramePacer.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_ANDROID_FRAME_PACER_H
+#define LLGL_ANDROID_FRAME_PACER_H
+
+
+#include "../FramePacer.h"
+#include "../Module.h"
+#include <cstdint>
+#include <cstddef>
+
+
+struct APerformanceHintManager;
+struct APerformanceHintSession;
+
+namespace LLGL
+{
+
+
+/*
+Frame pacer for Android, which paces frames in the fashion of Swappy (Android Frame Pacing library):
+The frame interval is an integer multiple of the display refresh period and is adjusted within the range of acceptable frame rates
+whenever the frame durations consistently miss or undercut the current interval.
+The actual CPU work duration of each frame is reported to the Performance Hint API (ADPF), which is loaded at runtime since it requires API level 33.
+*/
+class AndroidFramePacer final : public FramePacer
+{
+
+    public:
+
+        AndroidFramePacer();
+        ~AndroidFramePacer();
+
+        bool SetFramePacing(const FramePacingDescriptor& desc) override;
+        void PaceFrame() override;
+        void NotifyFramePresented() override;
+
+    private:
+
+        LLGL_PROC_INTERFACE(APerformanceHintManager*, PFN_APerformanceHint_getManager, (void));
+        LLGL_PROC_INTERFACE(APerformanceHintSession*, PFN_APerformanceHint_createSession, (APerformanceHintManager*, const std::int32_t*, std::size_t, std::int64_t));
+        LLGL_PROC_INTERFACE(int, PFN_APerformanceHint_updateTargetWorkDuration, (APerformanceHintSession*, std::int64_t));
+        LLGL_PROC_INTERFACE(int, PFN_APerformanceHint_reportActualWorkDuration, (APerformanceHintSession*, std::int64_t));
+        LLGL_PROC_INTERFACE(void, PFN_APerformanceHint_closeSession, (APerformanceHintSession*));
+
+    private:
+
+        // Loads the Performance Hint API procedures from "libandroid.so". Returns false if they are not available.
+        bool LoadPerformanceHintProcs();
+
+        // Creates the performance hint session for the calling thread if it has not been created yet.
+        void CreatePerformanceHintSession();
+
+        // Returns the frame interval (in nanoseconds) for the specified swap interval.
+        std::int64_t GetFrameInterval(std::uint32_t swapInterval) const;
+
+        // Sets the new swap interval and updates the target work duration of the performance hint session.
+        void SetSwapInterval(std::uint32_t swapInterval);
+
+        // Adjusts the swap interval if the recent frames consistently missed or undercut the current frame interval.
+        void AdjustSwapInterval(std::int64_t workDuration);
+
+    private:
+
+        std::unique_ptr<Module>                             libAndroid_;
+        PFN_APerformanceHint_getManager                     getManager_                 = nullptr;
+        PFN_APerformanceHint_createSession                  createSession_              = nullptr;
+        PFN_APerformanceHint_updateTargetWorkDuration       updateTargetWorkDuration_   = nullptr;
+        PFN_APerformanceHint_reportActualWorkDuration       reportActualWorkDuration_   = nullptr;
+        PFN_APerformanceHint_closeSession                   closeSession_               = nullptr;
+        APerformanceHintSession*                            session_                    = nullptr;
+
+        std::int64_t                                        refreshPeriod_              = 0; // Display refresh period (in nanoseconds)
+        std::uint32_t                                       minSwapInterval_            = 0; // Swap interval for the maximum frame rate; 0 if pacing is disabled
+        std::uint32_t                                       maxSwapInterval_            = 0; // Swap interval for the minimum frame rate
+        std::uint32_t                                       swapInterval_               = 0; // Number of refresh periods per frame
+        std::uint32_t                                       numMissedFrames_            = 0;
+        std::uint32_t                                       numFastFrames_              = 0;
+        std::uint64_t                                       frameBeginTime_             = 0;
+        std::uint64_t                                       lastPresentTime_            = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
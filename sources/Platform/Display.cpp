@@ -6,6 +6,7 @@
  */
 
 #include <LLGL/Display.h>
+#include <LLGL/Timer.h>
 #include <algorithm>
 
 
@@ -13,6 +14,17 @@ namespace LLGL
 {
 
 
+bool Display::WaitForVBlank()
+{
+    return false; // dummy
+}
+
+bool Display::GetVBlankTiming(DisplayVBlankTiming& /*outTiming*/) const
+{
+    return false; // dummy
+}
+
+
 /*
  * ======= Protected: =======
  */
@@ -29,6 +41,18 @@ void Display::FinalizeDisplayModes(std::vector<DisplayMode>& displayMode)
     );
 }
 
+void Display::PredictNextVBlank(DisplayVBlankTiming& timing)
+{
+    const std::uint64_t now = Timer::Tick();
+    if (timing.refreshPeriod > 0 && now > timing.lastVBlank)
+    {
+        /* Skip all vertical blanks that have already passed since the last observed one */
+        const std::uint64_t numPassedVBlanks = (now - timing.lastVBlank) / timing.refreshPeriod;
+        timing.lastVBlank += numPassedVBlanks * timing.refreshPeriod;
+    }
+    timing.nextVBlank = timing.lastVBlank + timing.refreshPeriod;
+}
+
 
 } // /namespace LLGL
 
@@ -0,0 +1,30 @@
+/*
+ * FramePacer.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "FramePacer.h"
+#include <LLGL/Platform/Platform.h>
+
+
+namespace LLGL
+{
+
+
+#ifndef LLGL_OS_ANDROID
+
+std::unique_ptr<FramePacer> FramePacer::Create()
+{
+    return nullptr; // Frame pacing is only implemented for Android
+}
+
+#endif // /LLGL_OS_ANDROID
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
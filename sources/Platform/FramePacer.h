@@ -0,0 +1,52 @@
+/*
+ * FramePacer.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_FRAME_PACER_H
+#define LLGL_FRAME_PACER_H
+
+
+#include <LLGL/SwapChainFlags.h>
+#include <memory>
+
+
+namespace LLGL
+{
+
+
+// Platform specific interface to pace the frames of a swap-chain; see SwapChain::SetFramePacing.
+class FramePacer
+{
+
+    public:
+
+        virtual ~FramePacer() = default;
+
+        // Returns a new frame pacer for the active platform or null if the platform does not support frame pacing.
+        static std::unique_ptr<FramePacer> Create();
+
+    public:
+
+        // Applies the specified frame pacing configuration. Returns false if the configuration cannot be applied.
+        virtual bool SetFramePacing(const FramePacingDescriptor& desc) = 0;
+
+        // Waits until the next frame is due and reports the work duration of the current frame. This is called right before the back buffer is swapped.
+        virtual void PaceFrame() = 0;
+
+        // Starts measuring the work duration of the next frame. This is called right after the back buffer has been swapped.
+        virtual void NotifyFramePresented() = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -7,8 +7,17 @@
 
 #include "LinuxDisplay.h"
 #include "../../Core/CoreUtils.h"
+#include <LLGL/Timer.h>
 #include <X11/extensions/Xrandr.h>
 
+#ifdef LLGL_LINUX_ENABLE_DRM
+#   include <drm/drm.h>
+#   include <sys/ioctl.h>
+#   include <fcntl.h>
+#   include <unistd.h>
+#   include <errno.h>
+#endif
+
 
 namespace LLGL
 {
@@ -49,8 +58,15 @@ static bool UpdateDisplayList()
  * LinuxSharedX11Display class
  */
 
+static ::Display* OpenX11Display()
+{
+    /* Enable thread support before the connection is opened, since swap-chains can be presented from different threads */
+    XInitThreads();
+    return XOpenDisplay(nullptr);
+}
+
 LinuxSharedX11Display::LinuxSharedX11Display() :
-    native_ { XOpenDisplay(nullptr) }
+    native_ { OpenX11Display() }
 {
     if (!native_)
         throw std::runtime_error("failed to open connection to X server");
@@ -162,6 +178,18 @@ LinuxDisplay::LinuxDisplay(const std::shared_ptr<LinuxSharedX11Display>& sharedX
     sharedX11Display_ { sharedX11Display },
     screen_           { screenIndex      }
 {
+    #ifdef LLGL_LINUX_ENABLE_DRM
+    /* Open primary DRM device node; vertical blank queries are not available if this fails, e.g. due to missing permissions */
+    drmFile_ = ::open("/dev/dri/card0", O_RDWR | O_CLOEXEC);
+    #endif
+}
+
+LinuxDisplay::~LinuxDisplay()
+{
+    #ifdef LLGL_LINUX_ENABLE_DRM
+    if (drmFile_ != -1)
+        ::close(drmFile_);
+    #endif
 }
 
 bool LinuxDisplay::IsPrimary() const
@@ -280,6 +308,39 @@ std::vector<DisplayMode> LinuxDisplay::GetSupportedDisplayModes() const
     return displayModes;
 }
 
+bool LinuxDisplay::WaitForVBlank()
+{
+    #ifdef LLGL_LINUX_ENABLE_DRM
+    std::uint64_t timestamp = 0;
+    return WaitDRMVBlank(1, timestamp);
+    #else
+    return false;
+    #endif
+}
+
+bool LinuxDisplay::GetVBlankTiming(DisplayVBlankTiming& outTiming) const
+{
+    #ifdef LLGL_LINUX_ENABLE_DRM
+
+    /* Query timestamp of the last vertical blank without waiting, i.e. relative sequence of zero */
+    std::uint64_t timestamp = 0;
+    if (WaitDRMVBlank(0, timestamp))
+    {
+        const DisplayMode displayMode = GetDisplayMode();
+        if (displayMode.refreshRate > 0)
+        {
+            outTiming.lastVBlank    = timestamp;
+            outTiming.refreshPeriod = Timer::Frequency() / displayMode.refreshRate;
+            PredictNextVBlank(outTiming);
+            return true;
+        }
+    }
+
+    #endif // /LLGL_LINUX_ENABLE_DRM
+
+    return false;
+}
+
 
 /*
  * ======= Private: =======
@@ -290,6 +351,47 @@ std::vector<DisplayMode> LinuxDisplay::GetSupportedDisplayModes() const
     return sharedX11Display_->GetNative();
 }
 
+#ifdef LLGL_LINUX_ENABLE_DRM
+
+bool LinuxDisplay::WaitDRMVBlank(unsigned int sequence, std::uint64_t& outTimestamp) const
+{
+    if (drmFile_ == -1)
+        return false;
+
+    /*
+    Select CRTC by screen index. X11 screens do not map to CRTCs in general,
+    but this matches the common configurations with one CRTC per screen.
+    */
+    const unsigned int crtc = static_cast<unsigned int>(screen_);
+
+    drm_wait_vblank_t vblank = {};
+    {
+        vblank.request.type     = static_cast<drm_vblank_seq_type>(_DRM_VBLANK_RELATIVE | ((crtc << _DRM_VBLANK_HIGH_CRTC_SHIFT) & _DRM_VBLANK_HIGH_CRTC_MASK));
+        vblank.request.sequence = sequence;
+    }
+
+    int result = 0;
+    do
+    {
+        result = ::ioctl(drmFile_, DRM_IOCTL_WAIT_VBLANK, &vblank);
+    }
+    while (result == -1 && (errno == EINTR || errno == EAGAIN));
+
+    if (result != 0)
+        return false;
+
+    /* DRM reports vertical blank timestamps with CLOCK_MONOTONIC, which matches Timer::Tick on Linux */
+    outTimestamp =
+    (
+        static_cast<std::uint64_t>(vblank.reply.tval_sec)  * 1000000000ull +
+        static_cast<std::uint64_t>(vblank.reply.tval_usec) * 1000ull
+    );
+
+    return true;
+}
+
+#endif // /LLGL_LINUX_ENABLE_DRM
+
 
 } // /namespace LLGL
 
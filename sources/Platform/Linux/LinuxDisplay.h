@@ -52,6 +52,7 @@ class LinuxDisplay : public Display
     public:
 
         LinuxDisplay(const std::shared_ptr<LinuxSharedX11Display>& sharedX11Display, int screenIndex);
+        ~LinuxDisplay();
 
         bool IsPrimary() const override;
 
@@ -66,16 +67,30 @@ class LinuxDisplay : public Display
 
         std::vector<DisplayMode> GetSupportedDisplayModes() const override;
 
+        bool WaitForVBlank() override;
+        bool GetVBlankTiming(DisplayVBlankTiming& outTiming) const override;
+
     private:
 
         // Returns the native X11 display.
         ::Display* GetNative() const;
 
+        #ifdef LLGL_LINUX_ENABLE_DRM
+
+        // Waits for the specified number of vertical blanks via DRM and returns the timestamp of the last one in nanoseconds.
+        bool WaitDRMVBlank(unsigned int sequence, std::uint64_t& outTimestamp) const;
+
+        #endif // /LLGL_LINUX_ENABLE_DRM
+
     private:
 
         std::shared_ptr<LinuxSharedX11Display>  sharedX11Display_;
         int                                     screen_             = 0;
 
+        #ifdef LLGL_LINUX_ENABLE_DRM
+        int                                     drmFile_            = -1; // File descriptor of the DRM device node, or -1 if it could not be opened.
+        #endif
+
 };
 
 
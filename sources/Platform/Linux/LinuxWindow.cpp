@@ -73,6 +73,41 @@ LinuxX11Context& LinuxX11Context::Get()
 }
 
 
+/*
+ * XInput2 raw motion
+ */
+
+#ifdef LLGL_LINUX_ENABLE_XINPUT2
+
+static int g_xi2Opcode = -1;
+
+// Posts the XInput2 raw motion event to the window with input focus, since raw events are only delivered to the root window.
+static void ProcessXInput2Event(::Display* display, XGenericEventCookie& cookie, ::Window& focusWnd)
+{
+    if (cookie.extension != g_xi2Opcode || !XGetEventData(display, &cookie))
+        return;
+
+    if (cookie.evtype == XI_RawMotion)
+    {
+        /* Query input focus only once per batch of events to avoid a server round trip for each raw event */
+        if (focusWnd == None)
+        {
+            int revertTo = 0;
+            XGetInputFocus(display, &focusWnd, &revertTo);
+        }
+        if (void* userData = LinuxX11Context::Find(display, focusWnd))
+        {
+            LinuxWindow* wnd = reinterpret_cast<LinuxWindow*>(userData);
+            wnd->ProcessRawMotionEvent(*reinterpret_cast<const XIRawEvent*>(cookie.data));
+        }
+    }
+
+    XFreeEventData(display, &cookie);
+}
+
+#endif // /LLGL_LINUX_ENABLE_XINPUT2
+
+
 /*
  * Surface class
  */
@@ -83,11 +118,22 @@ bool Surface::ProcessEvents()
 
     XEvent event;
 
+    #ifdef LLGL_LINUX_ENABLE_XINPUT2
+    ::Window focusWnd = None;
+    #endif
+
     XPending(display);
 
     while (XQLength(display))
     {
         XNextEvent(display, &event);
+        #ifdef LLGL_LINUX_ENABLE_XINPUT2
+        if (event.type == GenericEvent)
+        {
+            ProcessXInput2Event(display, event.xcookie, focusWnd);
+            continue;
+        }
+        #endif
         if (void* userData = LinuxX11Context::Find(display, event.xany.window))
         {
             LinuxWindow* wnd = reinterpret_cast<LinuxWindow*>(userData);
@@ -369,8 +415,57 @@ void LinuxWindow::OpenX11Window()
     /* Enable WM_DELETE_WINDOW protocol */
     closeWndAtom_ = XInternAtom(display_, "WM_DELETE_WINDOW", False);
     XSetWMProtocols(display_, wnd_, &closeWndAtom_, 1);
+
+    #ifdef LLGL_LINUX_ENABLE_XINPUT2
+    /* Select raw motion events for unaccelerated global motion */
+    rawMotion_ = SelectXInput2RawMotion();
+    #endif
+}
+
+#ifdef LLGL_LINUX_ENABLE_XINPUT2
+
+bool LinuxWindow::SelectXInput2RawMotion()
+{
+    /* Check if XInput extension with version 2.0 is available */
+    int firstEvent = 0, firstError = 0;
+    if (!XQueryExtension(display_, "XInputExtension", &g_xi2Opcode, &firstEvent, &firstError))
+        return false;
+
+    int majorVersion = 2, minorVersion = 0;
+    if (XIQueryVersion(display_, &majorVersion, &minorVersion) != Success)
+        return false;
+
+    /* Select raw motion events of all master devices on the root window */
+    unsigned char mask[XIMaskLen(XI_RawMotion)] = {};
+    XISetMask(mask, XI_RawMotion);
+
+    XIEventMask eventMask;
+    {
+        eventMask.deviceid  = XIAllMasterDevices;
+        eventMask.mask_len  = sizeof(mask);
+        eventMask.mask      = mask;
+    }
+    return (XISelectEvents(display_, DefaultRootWindow(display_), &eventMask, 1) == Success);
+}
+
+void LinuxWindow::ProcessRawMotionEvent(const XIRawEvent& event)
+{
+    /* Raw values are only stored for valuators whose bit is set in the mask; valuator 0 and 1 denote X and Y axes */
+    const double*   values      = event.raw_values;
+    double          motion[2]   = { 0.0, 0.0 };
+
+    for (int i = 0; i < 2 && i < event.valuators.mask_len * 8; ++i)
+    {
+        if (XIMaskIsSet(event.valuators.mask, i))
+            motion[i] = *values++;
+    }
+
+    if (motion[0] != 0.0 || motion[1] != 0.0)
+        PostGlobalMotion({ static_cast<int>(motion[0]), static_cast<int>(motion[1]) });
 }
 
+#endif // /LLGL_LINUX_ENABLE_XINPUT2
+
 void LinuxWindow::ProcessKeyEvent(XKeyEvent& event, bool down)
 {
     auto key = MapKey(event);
@@ -427,7 +522,8 @@ void LinuxWindow::ProcessMotionEvent(XMotionEvent& event)
 {
     const Offset2D mousePos { event.x, event.y };
     PostLocalMotion(mousePos);
-    PostGlobalMotion({ mousePos.x - prevMousePos_.x, mousePos.y - prevMousePos_.y });
+    if (!rawMotion_)
+        PostGlobalMotion({ mousePos.x - prevMousePos_.x, mousePos.y - prevMousePos_.y });
     prevMousePos_ = mousePos;
 }
 
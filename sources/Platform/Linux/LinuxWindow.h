@@ -13,6 +13,10 @@
 #include "LinuxDisplay.h"
 #include <X11/Xlib.h>
 
+#ifdef LLGL_LINUX_ENABLE_XINPUT2
+#   include <X11/extensions/XInput2.h>
+#endif
+
 
 namespace LLGL
 {
@@ -51,10 +55,21 @@ class LinuxWindow : public Window
 
         void ProcessEvent(XEvent& event);
 
+        #ifdef LLGL_LINUX_ENABLE_XINPUT2
+
+        // Posts the relative motion of the specified XInput2 raw motion event as global motion.
+        void ProcessRawMotionEvent(const XIRawEvent& event);
+
+        #endif // /LLGL_LINUX_ENABLE_XINPUT2
+
     private:
 
         void OpenX11Window();
 
+        #ifdef LLGL_LINUX_ENABLE_XINPUT2
+        bool SelectXInput2RawMotion();
+        #endif
+
         void ProcessKeyEvent(XKeyEvent& event, bool down);
         void ProcessMouseKeyEvent(XButtonEvent& event, bool down);
         void ProcessExposeEvent();
@@ -78,6 +93,7 @@ class LinuxWindow : public Window
         ::Atom                      closeWndAtom_;
         
         Offset2D                    prevMousePos_;
+        bool                        rawMotion_          = false;    // True if global motion is provided by XInput2 raw motion events.
 
 };
 
@@ -13,6 +13,11 @@
 
 #include <LLGL/Display.h>
 
+#ifdef LLGL_MACOS_ENABLE_COREVIDEO
+#   include <mutex>
+#   include <condition_variable>
+#endif
+
 
 namespace LLGL
 {
@@ -39,6 +44,9 @@ class MacOSDisplay final : public Display
 
         std::vector<DisplayMode> GetSupportedDisplayModes() const override;
 
+        bool WaitForVBlank() override;
+        bool GetVBlankTiming(DisplayVBlankTiming& outTiming) const override;
+
     public:
 
         // Returns the native display ID.
@@ -49,8 +57,40 @@ class MacOSDisplay final : public Display
 
     private:
 
-        CGDirectDisplayID   displayID_              = 0;
-        CGDisplayModeRef    defaultDisplayModeRef_  = nullptr;
+        #ifdef LLGL_MACOS_ENABLE_COREVIDEO
+
+        // Creates and starts the display link on first use and returns true if it is running.
+        bool StartDisplayLink() const;
+
+        // Display link output callback; invoked on a separate thread for each vertical blank.
+        static CVReturn DisplayLinkOutputCallback(
+            CVDisplayLinkRef    displayLink,
+            const CVTimeStamp*  now,
+            const CVTimeStamp*  outputTime,
+            CVOptionFlags       flagsIn,
+            CVOptionFlags*      flagsOut,
+            void*               userData
+        );
+
+        #endif // /LLGL_MACOS_ENABLE_COREVIDEO
+
+    private:
+
+        CGDirectDisplayID               displayID_              = 0;
+        CGDisplayModeRef                defaultDisplayModeRef_  = nullptr;
+
+        #ifdef LLGL_MACOS_ENABLE_COREVIDEO
+
+        mutable CVDisplayLinkRef        displayLink_            = nullptr;
+        mutable bool                    displayLinkFailed_      = false;
+
+        mutable std::mutex              vblankMutex_;
+        std::condition_variable         vblankSignal_;
+        std::uint64_t                   vblankCounter_          = 0;
+        std::uint64_t                   lastVBlank_             = 0; // Host time of the most recent vertical blank in nanoseconds.
+        std::uint64_t                   refreshPeriod_          = 0; // Refresh period in nanoseconds.
+
+        #endif // /LLGL_MACOS_ENABLE_COREVIDEO
 
 };
 
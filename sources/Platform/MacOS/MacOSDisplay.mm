@@ -8,6 +8,7 @@
 #include "MacOSDisplay.h"
 #include "../../Core/CoreUtils.h"
 #include <LLGL/Utils/ForRange.h>
+#include <mach/mach_time.h>
 
 
 namespace LLGL
@@ -54,6 +55,19 @@ static std::uint32_t GetDisplayModeRefreshRate(CGDisplayModeRef displayMode, CGD
     return refreshRate;
 }
 
+#ifdef LLGL_MACOS_ENABLE_COREVIDEO
+
+// Converts the specified host time into nanoseconds, which is the unit of Timer::Tick on macOS
+static std::uint64_t HostTimeToNanoseconds(std::uint64_t hostTime)
+{
+    static mach_timebase_info_data_t timebase;
+    if (timebase.denom == 0)
+        mach_timebase_info(&timebase);
+    return (timebase.denom > 0 ? (hostTime * timebase.numer) / timebase.denom : 0);
+}
+
+#endif // /LLGL_MACOS_ENABLE_COREVIDEO
+
 // Converts a CGDisplayMode to a descriptor structure
 static void ConvertCGDisplayMode(DisplayMode& dst, CGDisplayModeRef src, CGDirectDisplayID displayID)
 {
@@ -259,6 +273,14 @@ MacOSDisplay::MacOSDisplay(CGDirectDisplayID displayID) :
 
 MacOSDisplay::~MacOSDisplay()
 {
+    #ifdef LLGL_MACOS_ENABLE_COREVIDEO
+    if (displayLink_ != nullptr)
+    {
+        CVDisplayLinkStop(displayLink_);
+        CVDisplayLinkRelease(displayLink_);
+    }
+    #endif // /LLGL_MACOS_ENABLE_COREVIDEO
+
     CGDisplayModeRelease(defaultDisplayModeRef_);
 }
 
@@ -358,6 +380,121 @@ std::vector<DisplayMode> MacOSDisplay::GetSupportedDisplayModes() const
     return displayModes;
 }
 
+bool MacOSDisplay::WaitForVBlank()
+{
+    #ifdef LLGL_MACOS_ENABLE_COREVIDEO
+
+    if (!StartDisplayLink())
+        return false;
+
+    /* Wait until the display link callback has been invoked for the next vertical blank; don't block forever if the display went to sleep */
+    std::unique_lock<std::mutex> lock{ vblankMutex_ };
+    const std::uint64_t counter = vblankCounter_;
+    return vblankSignal_.wait_for(
+        lock,
+        std::chrono::milliseconds(100),
+        [this, counter]() -> bool
+        {
+            return (vblankCounter_ != counter);
+        }
+    );
+
+    #else
+
+    return false;
+
+    #endif // /LLGL_MACOS_ENABLE_COREVIDEO
+}
+
+bool MacOSDisplay::GetVBlankTiming(DisplayVBlankTiming& outTiming) const
+{
+    #ifdef LLGL_MACOS_ENABLE_COREVIDEO
+
+    if (!StartDisplayLink())
+        return false;
+
+    std::lock_guard<std::mutex> guard{ vblankMutex_ };
+    if (vblankCounter_ == 0 || refreshPeriod_ == 0)
+        return false;
+
+    outTiming.lastVBlank    = lastVBlank_;
+    outTiming.refreshPeriod = refreshPeriod_;
+    PredictNextVBlank(outTiming);
+
+    return true;
+
+    #else
+
+    return false;
+
+    #endif // /LLGL_MACOS_ENABLE_COREVIDEO
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+#ifdef LLGL_MACOS_ENABLE_COREVIDEO
+
+bool MacOSDisplay::StartDisplayLink() const
+{
+    if (displayLink_ != nullptr)
+        return true;
+    if (displayLinkFailed_)
+        return false;
+
+    /* Create display link for this display only once, since it spawns a separate thread */
+    if (CVDisplayLinkCreateWithCGDisplay(displayID_, &displayLink_) != kCVReturnSuccess)
+    {
+        displayLink_        = nullptr;
+        displayLinkFailed_  = true;
+        return false;
+    }
+
+    CVDisplayLinkSetOutputCallback(displayLink_, MacOSDisplay::DisplayLinkOutputCallback, const_cast<MacOSDisplay*>(this));
+
+    if (CVDisplayLinkStart(displayLink_) != kCVReturnSuccess)
+    {
+        CVDisplayLinkRelease(displayLink_);
+        displayLink_        = nullptr;
+        displayLinkFailed_  = true;
+        return false;
+    }
+
+    return true;
+}
+
+CVReturn MacOSDisplay::DisplayLinkOutputCallback(
+    CVDisplayLinkRef    /*displayLink*/,
+    const CVTimeStamp*  now,
+    const CVTimeStamp*  outputTime,
+    CVOptionFlags       /*flagsIn*/,
+    CVOptionFlags*      /*flagsOut*/,
+    void*               userData)
+{
+    MacOSDisplay* self = static_cast<MacOSDisplay*>(userData);
+    {
+        std::lock_guard<std::mutex> guard{ self->vblankMutex_ };
+
+        /* 'now' refers to the frame that is currently being displayed, 'outputTime' to the next one */
+        const std::uint64_t nowTime     = HostTimeToNanoseconds(now->hostTime);
+        const std::uint64_t nextTime    = HostTimeToNanoseconds(outputTime->hostTime);
+
+        self->lastVBlank_ = nowTime;
+        if (nextTime > nowTime)
+            self->refreshPeriod_ = nextTime - nowTime;
+        else if (outputTime->videoTimeScale > 0)
+            self->refreshPeriod_ = (static_cast<std::uint64_t>(outputTime->videoRefreshPeriod) * 1000000000ull) / static_cast<std::uint64_t>(outputTime->videoTimeScale);
+
+        ++self->vblankCounter_;
+    }
+    self->vblankSignal_.notify_all();
+    return kCVReturnSuccess;
+}
+
+#endif // /LLGL_MACOS_ENABLE_COREVIDEO
+
 
 } // /namespace LLGL
 
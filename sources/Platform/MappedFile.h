@@ -0,0 +1,54 @@
+/*
+ * MappedFile.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_MAPPED_FILE_H
+#define LLGL_MAPPED_FILE_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/NonCopyable.h>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+// Read-only memory mapping of an entire file or a range of a file. The mapping is released when this object is destroyed.
+class LLGL_EXPORT MappedFile : public NonCopyable
+{
+
+    public:
+
+        /*
+        Maps the specified range of a file into memory for reading. If 'size' is zero, the range ends at the end of the file.
+        Returns null if the file could not be opened or the range is empty or exceeds the file size.
+        The offset does not have to be aligned to the page size; the mapping is expanded internally.
+        */
+        static std::unique_ptr<MappedFile> Open(const char* filename, std::uint64_t offset = 0, std::size_t size = 0);
+
+    public:
+
+        // Returns a pointer to the beginning of the mapped file range.
+        virtual const void* GetData() const = 0;
+
+        // Returns the size (in bytes) of the mapped file range.
+        virtual std::size_t GetSize() const = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,102 @@
+/*
+ * POSIXMappedFile.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "../MappedFile.h"
+#include "../../Core/CoreUtils.h"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+
+namespace LLGL
+{
+
+
+class POSIXMappedFile final : public MappedFile
+{
+
+    public:
+
+        POSIXMappedFile(void* mapping, std::size_t mappingSize, std::size_t dataOffset, std::size_t size) :
+            mapping_     { mapping     },
+            mappingSize_ { mappingSize },
+            dataOffset_  { dataOffset  },
+            size_        { size        }
+        {
+        }
+
+        ~POSIXMappedFile()
+        {
+            ::munmap(mapping_, mappingSize_);
+        }
+
+        const void* GetData() const override
+        {
+            return (static_cast<const char*>(mapping_) + dataOffset_);
+        }
+
+        std::size_t GetSize() const override
+        {
+            return size_;
+        }
+
+    private:
+
+        void*       mapping_        = nullptr;
+        std::size_t mappingSize_    = 0;
+        std::size_t dataOffset_     = 0;    // Offset from the page aligned mapping to the requested range.
+        std::size_t size_           = 0;
+
+};
+
+std::unique_ptr<MappedFile> MappedFile::Open(const char* filename, std::uint64_t offset, std::size_t size)
+{
+    if (filename == nullptr || *filename == '\0')
+        return nullptr;
+
+    const int fd = ::open(filename, O_RDONLY);
+    if (fd == -1)
+        return nullptr;
+
+    /* Map requested range from the enclosing page boundary; empty ranges cannot be mapped */
+    void* data = MAP_FAILED;
+    std::size_t dataOffset = 0, mappingSize = 0;
+    struct stat fileStat;
+    if (::fstat(fd, &fileStat) == 0 && S_ISREG(fileStat.st_mode))
+    {
+        const std::uint64_t fileSize = static_cast<std::uint64_t>(fileStat.st_size);
+        if (offset < fileSize)
+        {
+            if (size == 0)
+                size = static_cast<std::size_t>(fileSize - offset);
+            if (size <= fileSize - offset)
+            {
+                const std::uint64_t pageSize        = static_cast<std::uint64_t>(::sysconf(_SC_PAGESIZE));
+                const std::uint64_t alignedOffset   = offset - offset % pageSize;
+                dataOffset  = static_cast<std::size_t>(offset - alignedOffset);
+                mappingSize = dataOffset + size;
+                data = ::mmap(nullptr, mappingSize, PROT_READ, MAP_PRIVATE, fd, static_cast<off_t>(alignedOffset));
+            }
+        }
+    }
+
+    /* File descriptor is no longer needed once the mapping has been established */
+    ::close(fd);
+
+    if (data == MAP_FAILED)
+        return nullptr;
+
+    return MakeUnique<POSIXMappedFile>(data, mappingSize, dataOffset, size);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -6,8 +6,12 @@
  */
 
 #include "Win32Display.h"
+#include "../Module.h"
 #include "../../Core/CoreUtils.h"
+#include <LLGL/Timer.h>
 #include <algorithm>
+#include <dxgi.h>
+#include <dwmapi.h>
 
 
 namespace LLGL
@@ -137,6 +141,60 @@ static bool UpdateDisplayList()
     return false;
 }
 
+/*
+DXGI and DWM are loaded dynamically, so the platform library does not depend on them.
+Both modules stay loaded until the application terminates.
+*/
+LLGL_PROC_INTERFACE(HRESULT, PFN_CREATEDXGIFACTORY1, (REFIID, void**));
+LLGL_PROC_INTERFACE(HRESULT, PFN_DWMGETCOMPOSITIONTIMINGINFO, (HWND, DWM_TIMING_INFO*));
+
+static PFN_CREATEDXGIFACTORY1 GetCreateDXGIFactory1Proc()
+{
+    static std::unique_ptr<Module> dxgiModule = Module::Load("dxgi.dll");
+    static PFN_CREATEDXGIFACTORY1 proc = (dxgiModule ? reinterpret_cast<PFN_CREATEDXGIFACTORY1>(dxgiModule->LoadProcedure("CreateDXGIFactory1")) : nullptr);
+    return proc;
+}
+
+static PFN_DWMGETCOMPOSITIONTIMINGINFO GetDwmGetCompositionTimingInfoProc()
+{
+    static std::unique_ptr<Module> dwmModule = Module::Load("dwmapi.dll");
+    static PFN_DWMGETCOMPOSITIONTIMINGINFO proc = (dwmModule ? reinterpret_cast<PFN_DWMGETCOMPOSITIONTIMINGINFO>(dwmModule->LoadProcedure("DwmGetCompositionTimingInfo")) : nullptr);
+    return proc;
+}
+
+static IDXGIOutput* FindDXGIOutput(HMONITOR monitor)
+{
+    PFN_CREATEDXGIFACTORY1 CreateDXGIFactory1Proc = GetCreateDXGIFactory1Proc();
+    if (CreateDXGIFactory1Proc == nullptr)
+        return nullptr;
+
+    IDXGIFactory1* factory = nullptr;
+    if (FAILED(CreateDXGIFactory1Proc(__uuidof(IDXGIFactory1), reinterpret_cast<void**>(&factory))))
+        return nullptr;
+
+    /* Find output on any adapter that is attached to the specified monitor */
+    IDXGIOutput* result = nullptr;
+
+    IDXGIAdapter1* adapter = nullptr;
+    for (UINT adapterIndex = 0; result == nullptr && factory->EnumAdapters1(adapterIndex, &adapter) != DXGI_ERROR_NOT_FOUND; ++adapterIndex)
+    {
+        IDXGIOutput* output = nullptr;
+        for (UINT outputIndex = 0; result == nullptr && adapter->EnumOutputs(outputIndex, &output) != DXGI_ERROR_NOT_FOUND; ++outputIndex)
+        {
+            DXGI_OUTPUT_DESC outputDesc;
+            if (SUCCEEDED(output->GetDesc(&outputDesc)) && outputDesc.Monitor == monitor)
+                result = output;
+            else
+                output->Release();
+        }
+        adapter->Release();
+    }
+
+    factory->Release();
+
+    return result;
+}
+
 static bool IsCursorVisible(bool& visible)
 {
     CURSORINFO info;
@@ -233,10 +291,17 @@ Offset2D Display::GetCursorPosition()
  */
 
 Win32Display::Win32Display(HMONITOR monitor) :
-    monitor_ { monitor }
+    monitor_        { monitor },
+    lastVBlankTick_ { 0       }
 {
 }
 
+Win32Display::~Win32Display()
+{
+    if (dxgiOutput_ != nullptr)
+        dxgiOutput_->Release();
+}
+
 bool Win32Display::IsPrimary() const
 {
     MONITORINFO info;
@@ -348,6 +413,58 @@ std::vector<DisplayMode> Win32Display::GetSupportedDisplayModes() const
     return displayModes;
 }
 
+bool Win32Display::WaitForVBlank()
+{
+    if (IDXGIOutput* output = GetDXGIOutput())
+    {
+        if (SUCCEEDED(output->WaitForVBlank()))
+        {
+            lastVBlankTick_ = Timer::Tick();
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Win32Display::GetVBlankTiming(DisplayVBlankTiming& outTiming) const
+{
+    /*
+    DWM reports the timing of its composition clock, which runs at the refresh rate of the primary display.
+    Both timestamps are in QPC units, which is what Timer::Tick returns on Win32.
+    */
+    if (IsPrimary())
+    {
+        if (PFN_DWMGETCOMPOSITIONTIMINGINFO DwmGetCompositionTimingInfoProc = GetDwmGetCompositionTimingInfoProc())
+        {
+            DWM_TIMING_INFO timingInfo = {};
+            timingInfo.cbSize = sizeof(timingInfo);
+            if (SUCCEEDED(DwmGetCompositionTimingInfoProc(nullptr, &timingInfo)) && timingInfo.qpcRefreshPeriod > 0)
+            {
+                outTiming.lastVBlank    = static_cast<std::uint64_t>(timingInfo.qpcVBlank);
+                outTiming.refreshPeriod = static_cast<std::uint64_t>(timingInfo.qpcRefreshPeriod);
+                PredictNextVBlank(outTiming);
+                return true;
+            }
+        }
+    }
+
+    /* Otherwise, extrapolate from the last vertical blank we waited for and the refresh rate of the current display mode */
+    const std::uint64_t lastVBlankTick = lastVBlankTick_;
+    if (lastVBlankTick > 0)
+    {
+        const DisplayMode displayMode = GetDisplayMode();
+        if (displayMode.refreshRate > 0)
+        {
+            outTiming.lastVBlank    = lastVBlankTick;
+            outTiming.refreshPeriod = Timer::Frequency() / displayMode.refreshRate;
+            PredictNextVBlank(outTiming);
+            return true;
+        }
+    }
+
+    return false;
+}
+
 
 /*
  * ======= Private: =======
@@ -365,6 +482,16 @@ void Win32Display::GetInfo(MONITORINFOEX& info) const
     GetMonitorInfo(monitor_, &info);
 }
 
+IDXGIOutput* Win32Display::GetDXGIOutput()
+{
+    if (!dxgiOutputQueried_)
+    {
+        dxgiOutput_         = FindDXGIOutput(monitor_);
+        dxgiOutputQueried_  = true;
+    }
+    return dxgiOutput_;
+}
+
 
 } // /namespace LLGL
 
@@ -12,8 +12,11 @@
 #include <LLGL/Display.h>
 #include "Win32LeanAndMean.h"
 #include <Windows.h>
+#include <atomic>
 
 
+struct IDXGIOutput;
+
 namespace LLGL
 {
 
@@ -24,6 +27,7 @@ class Win32Display final : public Display
     public:
 
         Win32Display(HMONITOR monitor);
+        ~Win32Display();
 
         bool IsPrimary() const override;
 
@@ -38,6 +42,9 @@ class Win32Display final : public Display
 
         std::vector<DisplayMode> GetSupportedDisplayModes() const override;
 
+        bool WaitForVBlank() override;
+        bool GetVBlankTiming(DisplayVBlankTiming& outTiming) const override;
+
     public:
 
         // Returns the native display handle as HMONITOR.
@@ -51,9 +58,16 @@ class Win32Display final : public Display
         void GetInfo(MONITORINFO& info) const;
         void GetInfo(MONITORINFOEX& info) const;
 
+        // Returns the DXGI output that belongs to this monitor. The output is queried only once.
+        IDXGIOutput* GetDXGIOutput();
+
     private:
 
-        HMONITOR monitor_ = nullptr;
+        HMONITOR                    monitor_            = nullptr;
+
+        IDXGIOutput*                dxgiOutput_         = nullptr;
+        bool                        dxgiOutputQueried_  = false;
+        std::atomic<std::uint64_t>  lastVBlankTick_;
 
 };
 
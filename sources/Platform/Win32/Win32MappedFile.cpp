@@ -0,0 +1,108 @@
+/*
+ * Win32MappedFile.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "../MappedFile.h"
+#include "../../Core/CoreUtils.h"
+#include "Win32LeanAndMean.h"
+#include <Windows.h>
+
+
+namespace LLGL
+{
+
+
+class Win32MappedFile final : public MappedFile
+{
+
+    public:
+
+        Win32MappedFile(const void* view, std::size_t dataOffset, std::size_t size) :
+            view_       { view       },
+            dataOffset_ { dataOffset },
+            size_       { size       }
+        {
+        }
+
+        ~Win32MappedFile()
+        {
+            UnmapViewOfFile(view_);
+        }
+
+        const void* GetData() const override
+        {
+            return (static_cast<const char*>(view_) + dataOffset_);
+        }
+
+        std::size_t GetSize() const override
+        {
+            return size_;
+        }
+
+    private:
+
+        const void* view_       = nullptr;
+        std::size_t dataOffset_ = 0;    // Offset from the view, which is aligned to the allocation granularity, to the requested range.
+        std::size_t size_       = 0;
+
+};
+
+std::unique_ptr<MappedFile> MappedFile::Open(const char* filename, std::uint64_t offset, std::size_t size)
+{
+    if (filename == nullptr || *filename == '\0')
+        return nullptr;
+
+    HANDLE file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return nullptr;
+
+    /* Map requested range from the enclosing allocation granularity boundary; empty ranges cannot be mapped */
+    const void* data = nullptr;
+    std::size_t dataOffset = 0;
+    LARGE_INTEGER fileSize;
+    if (GetFileSizeEx(file, &fileSize) && offset < static_cast<std::uint64_t>(fileSize.QuadPart))
+    {
+        const std::uint64_t remainingSize = static_cast<std::uint64_t>(fileSize.QuadPart) - offset;
+        if (size == 0)
+            size = static_cast<std::size_t>(remainingSize);
+        if (size <= remainingSize)
+        {
+            if (HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr))
+            {
+                SYSTEM_INFO systemInfo;
+                GetSystemInfo(&systemInfo);
+
+                const std::uint64_t alignedOffset = offset - offset % systemInfo.dwAllocationGranularity;
+                dataOffset = static_cast<std::size_t>(offset - alignedOffset);
+
+                data = MapViewOfFile(
+                    mapping,
+                    FILE_MAP_READ,
+                    static_cast<DWORD>(alignedOffset >> 32),
+                    static_cast<DWORD>(alignedOffset & 0xFFFFFFFFu),
+                    dataOffset + size
+                );
+
+                /* Mapping object and file handle are no longer needed once the view has been mapped */
+                CloseHandle(mapping);
+            }
+        }
+    }
+
+    CloseHandle(file);
+
+    if (data == nullptr)
+        return nullptr;
+
+    return MakeUnique<Win32MappedFile>(data, dataOffset, size);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -88,8 +88,28 @@ struct Window::Pimpl
     bool                                        quit            = false;
     bool                                        focus           = false;
     void*                                       userData        = nullptr;
+    bool                                        queueEnabled    = false;
+    std::vector<WindowEvent>                    eventQueue;
+
+    // Returns a new event record or the last one if the event can be coalesced with it. Returns null if the event queue is disabled.
+    WindowEvent* RecordEvent(WindowEventType type, bool coalesce = false);
 };
 
+WindowEvent* Window::Pimpl::RecordEvent(WindowEventType type, bool coalesce)
+{
+    if (!queueEnabled)
+        return nullptr;
+
+    /* Merge high-frequency events into the previous record of the same type, so the order of other events is preserved */
+    if (coalesce && !eventQueue.empty() && eventQueue.back().type == type)
+        return &(eventQueue.back());
+
+    eventQueue.push_back(WindowEvent{});
+    WindowEvent* event = &(eventQueue.back());
+    event->type = type;
+    return event;
+}
+
 
 /*
  * Window class
@@ -220,6 +240,23 @@ void Window::RemoveEventListener(const EventListener* eventListener)
     RemoveFromSharedList(pimpl_->eventListeners, eventListener);
 }
 
+void Window::SetEventQueueEnabled(bool enable)
+{
+    pimpl_->queueEnabled = enable;
+    if (!enable)
+        ClearEventQueue();
+}
+
+ArrayView<WindowEvent> Window::GetEventQueue() const
+{
+    return ArrayView<WindowEvent>{ pimpl_->eventQueue.data(), pimpl_->eventQueue.size() };
+}
+
+void Window::ClearEventQueue()
+{
+    pimpl_->eventQueue.clear();
+}
+
 void Window::PostQuit()
 {
     if (!HasQuit())
@@ -232,63 +269,87 @@ void Window::PostQuit()
             canQuit = (canQuit && !veto);
         }
         pimpl_->quit = canQuit;
+        if (canQuit)
+            pimpl_->RecordEvent(WindowEventType::Quit);
     }
 }
 
 void Window::PostKeyDown(Key keyCode)
 {
+    if (WindowEvent* event = pimpl_->RecordEvent(WindowEventType::KeyDown))
+        event->keyCode = keyCode;
     FOREACH_LISTENER_CALL( OnKeyDown(*this, keyCode) );
 }
 
 void Window::PostKeyUp(Key keyCode)
 {
+    if (WindowEvent* event = pimpl_->RecordEvent(WindowEventType::KeyUp))
+        event->keyCode = keyCode;
     FOREACH_LISTENER_CALL( OnKeyUp(*this, keyCode) );
 }
 
 void Window::PostDoubleClick(Key keyCode)
 {
+    if (WindowEvent* event = pimpl_->RecordEvent(WindowEventType::DoubleClick))
+        event->keyCode = keyCode;
     FOREACH_LISTENER_CALL( OnDoubleClick(*this, keyCode) );
 }
 
 void Window::PostChar(wchar_t chr)
 {
+    if (WindowEvent* event = pimpl_->RecordEvent(WindowEventType::Char))
+        event->chr = chr;
     FOREACH_LISTENER_CALL( OnChar(*this, chr) );
 }
 
 void Window::PostWheelMotion(int motion)
 {
+    if (WindowEvent* event = pimpl_->RecordEvent(WindowEventType::WheelMotion, true))
+        event->wheelMotion += motion;
     FOREACH_LISTENER_CALL( OnWheelMotion(*this, motion) );
 }
 
 void Window::PostLocalMotion(const Offset2D& position)
 {
+    if (WindowEvent* event = pimpl_->RecordEvent(WindowEventType::LocalMotion, true))
+        event->offset = position;
     FOREACH_LISTENER_CALL( OnLocalMotion(*this, position) );
 }
 
 void Window::PostGlobalMotion(const Offset2D& motion)
 {
+    if (WindowEvent* event = pimpl_->RecordEvent(WindowEventType::GlobalMotion, true))
+    {
+        event->offset.x += motion.x;
+        event->offset.y += motion.y;
+    }
     FOREACH_LISTENER_CALL( OnGlobalMotion(*this, motion) );
 }
 
 void Window::PostResize(const Extent2D& clientAreaSize)
 {
+    if (WindowEvent* event = pimpl_->RecordEvent(WindowEventType::Resize, true))
+        event->size = clientAreaSize;
     FOREACH_LISTENER_CALL( OnResize(*this, clientAreaSize) );
 }
 
 void Window::PostUpdate()
 {
+    pimpl_->RecordEvent(WindowEventType::Update, true);
     FOREACH_LISTENER_CALL( OnUpdate(*this) );
 }
 
 void Window::PostGetFocus()
 {
     pimpl_->focus = true;
+    pimpl_->RecordEvent(WindowEventType::GetFocus);
     FOREACH_LISTENER_CALL( OnGetFocus(*this) );
 }
 
 void Window::PostLostFocus()
 {
     pimpl_->focus = false;
+    pimpl_->RecordEvent(WindowEventType::LostFocus);
     FOREACH_LISTENER_CALL( OnLostFocus(*this) );
 }
 
@@ -0,0 +1,42 @@
+/*
+ * CommandQueue.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/CommandQueue.h>
+#include <LLGL/SwapChain.h>
+#include <LLGL/Utils/ForRange.h>
+
+
+namespace LLGL
+{
+
+
+void CommandQueue::Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers)
+{
+    /* Submit each command buffer individually for backends without batched submission */
+    for_range(i, numCommandBuffers)
+    {
+        if (commandBuffers[i] != nullptr)
+            Submit(*commandBuffers[i]);
+    }
+}
+
+void CommandQueue::Present(std::uint32_t numSwapChains, SwapChain* const * swapChains)
+{
+    /* Present each swap-chain individually for backends without batched presentation */
+    for_range(i, numSwapChains)
+    {
+        if (swapChains[i] != nullptr)
+            swapChains[i]->Present();
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
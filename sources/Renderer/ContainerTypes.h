@@ -12,11 +12,15 @@
 #include "../Core/CoreUtils.h"
 #include "../Core/Assertion.h"
 #include "CheckedCast.h"
+#include <LLGL/Container/Allocator.h>
 #include <memory>
 #include <vector>
 #include <utility>
+#include <algorithm>
 #include <type_traits>
 #include <unordered_set>
+#include <mutex>
+#include <cstddef>
 #include <cstdint>
 
 
@@ -64,173 +68,233 @@ SubType* TakeOwnership(std::vector<std::unique_ptr<BaseType>>& objectSet, std::u
  * Global container class templates
  */
 
-// Alternative for std::unique_ptr<T> with an index into its owning container for fast removal.
-template <typename T, typename Payload, std::size_t Alignment = alignof(T)>
-class PayloadUniquePtr final
+/*
+Slab allocator for the memory blocks of a single container.
+Blocks are grouped by size and alignment into slabs of multiple blocks, so objects of the same type are close together in memory.
+Released blocks are kept in a free list of their size class and re-used for the next object of the same size class.
+Slab memory is only returned when the allocator is destroyed. This allocator is not thread-safe.
+*/
+class SlabAllocator
 {
 
-        static_assert(std::is_standard_layout<Payload>::value, "PayloadUniquePtr<T, Payload, Alignment>: Payload must be a standard layout");
-        static_assert(Alignment > 0, "PayloadUniquePtr<T, Payload, Alignment>: Alignment must be greater than 0");
-
-    public:
-
-        using pointer       = T*;
-        using reference     = T&;
-        using element_type  = T;
-
     public:
 
-        PayloadUniquePtr() = default;
-
-        PayloadUniquePtr(const PayloadUniquePtr&) = delete;
-        PayloadUniquePtr& operator = (const PayloadUniquePtr&) = delete;
+        SlabAllocator() = default;
 
-        template <typename TOther>
-        PayloadUniquePtr(PayloadUniquePtr<TOther, Payload>&& rhs) :
-            mem_ { rhs.release() }
-        {
-        }
+        SlabAllocator(const SlabAllocator&) = delete;
+        SlabAllocator& operator = (const SlabAllocator&) = delete;
 
-        template <typename TOther>
-        PayloadUniquePtr& operator = (PayloadUniquePtr<TOther, Payload>&& rhs)
+        ~SlabAllocator()
         {
-            if (this != &rhs)
-                reset(rhs.release());
-            return *this;
+            for (const SizeClass& sizeClass : sizeClasses_)
+            {
+                for (const Slab& slab : sizeClass.slabs)
+                    FreeMemory(slab.mem, slab.size, sizeClass.alignment);
+            }
         }
 
-        ~PayloadUniquePtr()
+        // Returns a memory block of at least the specified size and alignment.
+        void* Allocate(std::size_t size, std::size_t alignment)
         {
-            reset();
-        }
+            SizeClass& sizeClass = FindOrAddSizeClass(size, alignment);
 
-        char* release()
-        {
-            char* mem = mem_;
-            mem_ = nullptr;
-            return mem;
-        }
+            /* Re-use block from free list first */
+            if (FreeBlock* block = sizeClass.freeList)
+            {
+                sizeClass.freeList = block->next;
+                return block;
+            }
 
-        void reset(char* mem = nullptr)
-        {
-            if (mem_ != mem)
+            /* Allocate new slab with twice the blocks of the previous one, until the maximum slab size is reached */
+            if (sizeClass.slabs.empty() || sizeClass.slabOffset == sizeClass.slabs.back().size)
             {
-                if (mem_ != nullptr)
+                std::size_t numBlocks = g_minBlocksPerSlab;
+                if (!sizeClass.slabs.empty())
                 {
-                    /* Call destructor and free memory including payload */
-                    get()->~T();
-                    ::delete [] mem_;
+                    numBlocks = sizeClass.slabs.back().size / sizeClass.blockSize;
+                    if (numBlocks * sizeClass.blockSize < g_maxSlabSize)
+                        numBlocks *= 2;
                 }
-                mem_ = mem;
+                const Slab slab{ static_cast<char*>(AllocateMemory(numBlocks * sizeClass.blockSize, sizeClass.alignment)), numBlocks * sizeClass.blockSize };
+                sizeClass.slabs.push_back(slab);
+                sizeClass.slabOffset = 0;
             }
+
+            char* block = sizeClass.slabs.back().mem + sizeClass.slabOffset;
+            sizeClass.slabOffset += sizeClass.blockSize;
+            return block;
         }
 
-        pointer get() const noexcept
+        // Returns the specified memory block to the free list of its size class. Size and alignment must match the allocation.
+        void Deallocate(void* ptr, std::size_t size, std::size_t alignment)
         {
-            return reinterpret_cast<pointer>(addr());
+            SizeClass& sizeClass = FindOrAddSizeClass(size, alignment);
+            FreeBlock* block = static_cast<FreeBlock*>(ptr);
+            block->next = sizeClass.freeList;
+            sizeClass.freeList = block;
         }
 
-        void swap(PayloadUniquePtr& other) noexcept
+    private:
+
+        static constexpr std::size_t g_minBlocksPerSlab = 4;
+        static constexpr std::size_t g_maxSlabSize      = 64 * 1024;
+
+        struct FreeBlock
         {
-            std::swap(other.mem_, mem_);
-        }
+            FreeBlock* next;
+        };
 
-        Payload& payload() noexcept
+        struct Slab
         {
-            return *reinterpret_cast<Payload*>(addr() - sizeof(Payload));
-        }
+            char*       mem;
+            std::size_t size;
+        };
 
-        const Payload& payload() const noexcept
+        struct SizeClass
         {
-            return *reinterpret_cast<const Payload*>(addr() - sizeof(Payload));
-        }
+            std::size_t         blockSize   = 0;
+            std::size_t         alignment   = 0;
+            std::size_t         slabOffset  = 0;        // Offset to the next unused block in the last slab.
+            FreeBlock*          freeList    = nullptr;
+            std::vector<Slab>   slabs;
+        };
 
-    public:
+    private:
 
-        pointer operator -> () const noexcept
+        // Returns the size class for the specified block size. Containers only hold a few different types, so a linear search is sufficient.
+        SizeClass& FindOrAddSizeClass(std::size_t size, std::size_t alignment)
         {
-            return get();
-        }
+            alignment = std::max<std::size_t>(alignment, alignof(FreeBlock));
+            const std::size_t blockSize = GetAlignedSize(std::max<std::size_t>(size, sizeof(FreeBlock)), alignment);
 
-        reference operator * () const noexcept
-        {
-            return *get();
-        }
+            for (SizeClass& sizeClass : sizeClasses_)
+            {
+                if (sizeClass.blockSize == blockSize && sizeClass.alignment == alignment)
+                    return sizeClass;
+            }
 
-        operator bool () const noexcept
-        {
-            return (get() != nullptr);
+            SizeClass newSizeClass;
+            {
+                newSizeClass.blockSize = blockSize;
+                newSizeClass.alignment = alignment;
+            }
+            sizeClasses_.push_back(std::move(newSizeClass));
+            return sizeClasses_.back();
         }
 
+    private:
+
+        std::vector<SizeClass> sizeClasses_;
+
+};
+
+// Non-owning pointer to an object of UnorderedUniquePtrVector. Provides the accessors of std::unique_ptr<T>, so either container can be iterated the same way.
+template <typename T>
+class SlabObjectPtr final
+{
+
     public:
 
-        template <typename... Args>
-        static PayloadUniquePtr<T, Payload> Alloc(const Payload& payload, Args&&... args)
-        {
-            /* Allocate memory for payload and object with enough padding to have pointer alignment of <T> */
-            constexpr auto payloadAndPaddingSize = sizeof(Payload) + Alignment - 1;
-            char* mem = ::new char[sizeof(T) + payloadAndPaddingSize];
+        using pointer       = T*;
+        using reference     = T&;
+        using element_type  = T;
 
-            /* Construct unique pointer with payload */
-            PayloadUniquePtr<T, Payload> ptr{ mem };
-            ptr.payload() = payload;
-            ::new (ptr.get()) T(std::forward<Args>(args)...);
+    public:
+
+        SlabObjectPtr() = default;
 
-            return ptr;
+        explicit SlabObjectPtr(pointer ptr) :
+            ptr_ { ptr }
+        {
         }
 
-    private:
+        pointer get() const noexcept
+        {
+            return ptr_;
+        }
+
+        pointer operator -> () const noexcept
+        {
+            return ptr_;
+        }
 
-        PayloadUniquePtr(char* mem) :
-            mem_ { mem }
+        reference operator * () const noexcept
         {
+            return *ptr_;
         }
 
-        // Returns the aligned memory address that points to the object.
-        std::uintptr_t addr() const
+        operator bool () const noexcept
         {
-            auto addr = reinterpret_cast<std::uintptr_t>(mem_);
-            return GetAlignedSize(addr + sizeof(Payload), Alignment);
+            return (ptr_ != nullptr);
         }
 
     private:
 
-        char* mem_ = nullptr;
+        pointer ptr_ = nullptr;
 
 };
 
-// Payload structure for indexed unique pointers. See IndexedUniquePtr<T>.
+// Payload structure in front of each object of UnorderedUniquePtrVector with its index into the container for fast removal.
 struct IndexPayload
 {
-    std::size_t index;
+    std::size_t     index;
+    std::uint32_t   blockSize;      // Size of the memory block, including this payload.
+    std::uint32_t   blockAlignment; // Alignment of the memory block.
 };
 
-template <typename T>
-using IndexedUniquePtr = PayloadUniquePtr<T, IndexPayload>;
-
-// Container class for an array of unordered unique pointers. Used by RenderSystem implementations for all child objects.
+/*
+Container class for an array of unordered unique pointers. Used by RenderSystem implementations for all child objects.
+Objects are allocated in slabs (see SlabAllocator) and each object is prefixed by an IndexPayload, so release is O(1) and does not search the container.
+*/
 template <typename T>
 class UnorderedUniquePtrVector
 {
 
     public:
 
-        using container_type    = std::vector<IndexedUniquePtr<T>>;
+        using container_type    = std::vector<SlabObjectPtr<T>>;
         using iterator          = typename container_type::iterator;
         using const_iterator    = typename container_type::const_iterator;
 
     public:
 
+        UnorderedUniquePtrVector() = default;
+
+        UnorderedUniquePtrVector(const UnorderedUniquePtrVector&) = delete;
+        UnorderedUniquePtrVector& operator = (const UnorderedUniquePtrVector&) = delete;
+
+        ~UnorderedUniquePtrVector()
+        {
+            clear();
+        }
+
         // Allocates a new object for this container and returns a non-owning raw pointer to that object.
         template <typename TSub, typename... Args>
         TSub* emplace(Args&&... args)
         {
-            /* Allocate object and assign index from container in payload */
-            const IndexPayload payload{ container_.size() };
-            IndexedUniquePtr<TSub> object = IndexedUniquePtr<TSub>::Alloc(payload, std::forward<Args>(args)...);
-            TSub* ref = object.get();
-            container_.push_back(std::move(object));
-            return ref;
+            void* block = allocator_.Allocate(GetBlockSize<TSub>(), GetBlockAlignment<TSub>());
+            TSub* object = ConstructInBlock<TSub>(block, nullptr, std::forward<Args>(args)...);
+            Insert(object);
+            return object;
+        }
+
+        /*
+        Same as emplace() but constructs the object before the specified mutex is locked to insert it into this container.
+        This allows multiple threads to construct objects for the same container concurrently.
+        The mutex is only locked for the allocation and the insertion, since the slab allocator is shared by all threads.
+        */
+        template <typename TSub, typename... Args>
+        TSub* emplace_concurrent(std::mutex& mutex, Args&&... args)
+        {
+            void* block = nullptr;
+            {
+                std::lock_guard<std::mutex> guard{ mutex };
+                block = allocator_.Allocate(GetBlockSize<TSub>(), GetBlockAlignment<TSub>());
+            }
+            TSub* object = ConstructInBlock<TSub>(block, &mutex, std::forward<Args>(args)...);
+            std::lock_guard<std::mutex> guard{ mutex };
+            Insert(object);
+            return object;
         }
 
         // Releases the memory for the specified object in that list.
@@ -241,25 +305,27 @@ class UnorderedUniquePtrVector
             {
                 /* Locate object in container with index from payload */
                 T* subTypedObject = ObjectCast<T*>(object);
-                auto* payload = reinterpret_cast<IndexPayload*>(reinterpret_cast<char*>(subTypedObject) - sizeof(IndexPayload));
+                IndexPayload* payload = GetPayload(subTypedObject);
                 LLGL_ASSERT(payload->index < container_.size());
 
                 if (payload->index + 1 < container_.size())
                 {
                     /* Move last element to location of the input object in order to delete it */
-                    std::swap(container_[payload->index], container_.back());
-
-                    /* Update payload for moved object */
-                    container_[payload->index].payload() = *payload;
+                    T* lastObject = container_.back().get();
+                    container_[payload->index] = container_.back();
+                    GetPayload(lastObject)->index = payload->index;
                 }
 
                 /* Remove last element in container; it's either input object or the one moved that object's location */
                 container_.pop_back();
+                Destroy(subTypedObject);
             }
         }
 
         void clear()
         {
+            for (const SlabObjectPtr<T>& object : container_)
+                Destroy(object.get());
             container_.clear();
         }
 
@@ -302,7 +368,82 @@ class UnorderedUniquePtrVector
 
     private:
 
-        container_type container_;
+        template <typename TSub>
+        static constexpr std::size_t GetBlockAlignment()
+        {
+            return (alignof(TSub) > alignof(IndexPayload) ? alignof(TSub) : alignof(IndexPayload));
+        }
+
+        // Returns the offset from the beginning of a memory block to its object. The payload is located right in front of the object.
+        static std::size_t GetObjectOffset(std::size_t blockAlignment)
+        {
+            return GetAlignedSize(sizeof(IndexPayload), blockAlignment);
+        }
+
+        template <typename TSub>
+        static std::size_t GetBlockSize()
+        {
+            return GetObjectOffset(GetBlockAlignment<TSub>()) + sizeof(TSub);
+        }
+
+        static IndexPayload* GetPayload(T* object)
+        {
+            return reinterpret_cast<IndexPayload*>(reinterpret_cast<char*>(object) - sizeof(IndexPayload));
+        }
+
+        /*
+        Constructs the object in the specified memory block and returns the block to the allocator if the constructor throws.
+        If 'mutex' is non-null, it is locked before the block is returned to the allocator.
+        */
+        template <typename TSub, typename... Args>
+        TSub* ConstructInBlock(void* block, std::mutex* mutex, Args&&... args)
+        {
+            static_assert(std::is_base_of<T, TSub>::value, "UnorderedUniquePtrVector<T>::emplace<TSub>: TSub must be a sub type of T");
+
+            constexpr std::size_t blockAlignment = GetBlockAlignment<TSub>();
+            char* objectMem = static_cast<char*>(block) + GetObjectOffset(blockAlignment);
+
+            IndexPayload* payload = reinterpret_cast<IndexPayload*>(objectMem - sizeof(IndexPayload));
+            payload->index          = 0;
+            payload->blockSize      = static_cast<std::uint32_t>(GetBlockSize<TSub>());
+            payload->blockAlignment = static_cast<std::uint32_t>(blockAlignment);
+
+            try
+            {
+                return ::new (static_cast<void*>(objectMem)) TSub(std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                if (mutex != nullptr)
+                {
+                    std::lock_guard<std::mutex> guard{ *mutex };
+                    allocator_.Deallocate(block, payload->blockSize, payload->blockAlignment);
+                }
+                else
+                    allocator_.Deallocate(block, payload->blockSize, payload->blockAlignment);
+                throw;
+            }
+        }
+
+        void Insert(T* object)
+        {
+            GetPayload(object)->index = container_.size();
+            container_.push_back(SlabObjectPtr<T>{ object });
+        }
+
+        // Destroys the specified object and returns its memory block to the allocator.
+        void Destroy(T* object)
+        {
+            const IndexPayload payload = *GetPayload(object);
+            char* block = reinterpret_cast<char*>(object) - GetObjectOffset(payload.blockAlignment);
+            object->~T();
+            allocator_.Deallocate(block, payload.blockSize, payload.blockAlignment);
+        }
+
+    private:
+
+        container_type  container_;
+        SlabAllocator   allocator_;
 
 };
 
@@ -326,6 +467,15 @@ class UnorderedUniquePtrSet
             return TakeOwnership(container_, MakeUnique<TSub>(std::forward<Args>(args)...));
         }
 
+        // Same as emplace() but constructs the object before the specified mutex is locked to insert it into this container.
+        template <typename TSub, typename... Args>
+        TSub* emplace_concurrent(std::mutex& mutex, Args&&... args)
+        {
+            std::unique_ptr<TSub> object = MakeUnique<TSub>(std::forward<Args>(args)...);
+            std::lock_guard<std::mutex> guard{ mutex };
+            return TakeOwnership(container_, std::move(object));
+        }
+
         // Releases the memory for the specified object in that list.
         template <typename TBase>
         void erase(TBase* object)
@@ -382,6 +532,157 @@ class UnorderedUniquePtrSet
 };
 
 
+/*
+Container class for child objects that are frequently created and released, such as transient buffer arrays.
+Memory blocks of released objects are recycled, so only the first objects up to the peak number of simultaneously alive objects allocate memory.
+Each block can hold any sub type of <T> that is no larger than <BlockSize>.
+*/
+template <typename T, std::size_t BlockSize = sizeof(T)>
+class RecyclingUniquePtrVector
+{
+
+        static_assert(BlockSize >= sizeof(T), "RecyclingUniquePtrVector<T, BlockSize>: BlockSize must not be less than the size of T");
+
+    public:
+
+        using container_type    = std::vector<T*>;
+        using iterator          = typename container_type::iterator;
+        using const_iterator    = typename container_type::const_iterator;
+
+    public:
+
+        RecyclingUniquePtrVector() = default;
+
+        RecyclingUniquePtrVector(const RecyclingUniquePtrVector&) = delete;
+        RecyclingUniquePtrVector& operator = (const RecyclingUniquePtrVector&) = delete;
+
+        ~RecyclingUniquePtrVector()
+        {
+            clear();
+            for (Block* block : freeBlocks_)
+                delete block;
+        }
+
+        // Constructs a new object in a recycled memory block and returns a non-owning raw pointer to that object.
+        template <typename TSub, typename... Args>
+        TSub* emplace(Args&&... args)
+        {
+            static_assert(std::is_base_of<T, TSub>::value, "RecyclingUniquePtrVector<T, BlockSize>::emplace<TSub>: TSub must be a sub type of T");
+            static_assert(sizeof(TSub) <= BlockSize, "RecyclingUniquePtrVector<T, BlockSize>::emplace<TSub>: TSub exceeds the block size");
+            static_assert(alignof(TSub) <= alignof(std::max_align_t), "RecyclingUniquePtrVector<T, BlockSize>::emplace<TSub>: TSub must not be over-aligned");
+
+            Block* block = AllocBlock();
+            TSub* object = ::new (static_cast<void*>(&(block->storage))) TSub(std::forward<Args>(args)...);
+            block->index = container_.size();
+            container_.push_back(object);
+            return object;
+        }
+
+        // Destroys the specified object and keeps its memory block for re-use.
+        template <typename TBase>
+        void erase(TBase* object)
+        {
+            if (object != nullptr)
+            {
+                /* Locate object in container with index from its memory block */
+                T* subTypedObject = ObjectCast<T*>(object);
+                Block* block = GetBlock(subTypedObject);
+                LLGL_ASSERT(block->index < container_.size());
+
+                if (block->index + 1 < container_.size())
+                {
+                    /* Move last element to location of the input object in order to delete it */
+                    T* lastObject = container_.back();
+                    container_[block->index] = lastObject;
+                    GetBlock(lastObject)->index = block->index;
+                }
+                container_.pop_back();
+
+                subTypedObject->~T();
+                freeBlocks_.push_back(block);
+            }
+        }
+
+        void clear()
+        {
+            for (T* object : container_)
+            {
+                object->~T();
+                freeBlocks_.push_back(GetBlock(object));
+            }
+            container_.clear();
+        }
+
+        bool empty() const
+        {
+            return container_.empty();
+        }
+
+    public:
+
+        const_iterator cbegin() const
+        {
+            return container_.cbegin();
+        }
+
+        const_iterator begin() const
+        {
+            return container_.begin();
+        }
+
+        iterator begin()
+        {
+            return container_.begin();
+        }
+
+        const_iterator cend() const
+        {
+            return container_.cend();
+        }
+
+        const_iterator end() const
+        {
+            return container_.end();
+        }
+
+        iterator end()
+        {
+            return container_.end();
+        }
+
+    private:
+
+        using BlockStorage = typename std::aligned_storage<BlockSize, alignof(std::max_align_t)>::type;
+
+        // Memory block of a single object with its index into the container for fast removal.
+        struct Block
+        {
+            std::size_t     index;
+            BlockStorage    storage;
+        };
+
+        Block* AllocBlock()
+        {
+            if (freeBlocks_.empty())
+                return new Block;
+            Block* block = freeBlocks_.back();
+            freeBlocks_.pop_back();
+            return block;
+        }
+
+        static Block* GetBlock(T* object)
+        {
+            return reinterpret_cast<Block*>(reinterpret_cast<char*>(object) - offsetof(Block, storage));
+        }
+
+    private:
+
+        container_type      container_;
+        std::vector<Block*> freeBlocks_;
+
+};
+
+
 /*
  * Global typenames
  */
@@ -401,6 +702,10 @@ using HWObjectContainer = UnorderedUniquePtrVector<T>;
 
 #endif
 
+// Container for child objects that are created and released at high frequency, e.g. buffer arrays.
+template <typename T, std::size_t BlockSize = sizeof(T)>
+using HWObjectPool = RecyclingUniquePtrVector<T, BlockSize>;
+
 
 } // /namespace LLGL
 
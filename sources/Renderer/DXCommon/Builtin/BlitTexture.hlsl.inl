@@ -0,0 +1,137 @@
+/*
+ * BlitTexture.hlsl.inl
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+/*
+Scaled texture blit for D3D11 and D3D12 (see CommandBuffer::BlitTexture).
+This shader is compiled at runtime with FXC when it is used for the first time.
+Bilinear filtering is done manually with four texel loads so no sampler has to be bound,
+and all loads are clamped to the source region to avoid bleeding in texels from outside the region.
+*/
+
+#include "../ComPtr.h"
+#include <LLGL/TextureFlags.h>
+#include <LLGL/SamplerFlags.h>
+#include <d3dcompiler.h>
+#include <cstdint>
+
+static const char g_BlitTexture_HLSL[] = R"(
+
+/* Source and destination regions; must match DXBlitTextureDescriptor */
+cbuffer BlitDescriptor : register(b0)
+{
+    int2    srcOffset;      // First texel of the source region
+    int2    srcMax;         // Last texel of the source region (inclusive)
+    float2  srcScale;       // Ratio between the source and destination extent
+    int2    dstOffset;      // First texel of the destination region
+    uint2   dstExtent;      // Extent of the destination region
+    uint    linearFilter;   // Non-zero for bilinear filtering, zero for nearest filtering
+    uint    padding0;
+};
+
+Texture2DArray<float4>      srcTexture : register(t0);
+RWTexture2DArray<float4>    dstTexture : register(u0);
+
+float4 LoadSourceTexel(int2 pos)
+{
+    return srcTexture.Load(int4(clamp(pos, srcOffset, srcMax), 0, 0));
+}
+
+[numthreads(8, 8, 1)]
+void BlitTextureCS(uint3 threadID : SV_DispatchThreadID)
+{
+    if (any(threadID.xy >= dstExtent))
+        return;
+
+    /* Map center of destination texel into source region */
+    float2 srcPos = ((float2)threadID.xy + 0.5) * srcScale - 0.5 + (float2)srcOffset;
+
+    float4 color;
+    if (linearFilter != 0)
+    {
+        float2  srcBase = floor(srcPos);
+        float2  t       = srcPos - srcBase;
+        int2    p       = (int2)srcBase;
+
+        float4  c00     = LoadSourceTexel(p);
+        float4  c10     = LoadSourceTexel(p + int2(1, 0));
+        float4  c01     = LoadSourceTexel(p + int2(0, 1));
+        float4  c11     = LoadSourceTexel(p + int2(1, 1));
+
+        color = lerp(lerp(c00, c10, t.x), lerp(c01, c11, t.x), t.y);
+    }
+    else
+        color = LoadSourceTexel((int2)floor(srcPos + 0.5));
+
+    dstTexture[uint3((int2)threadID.xy + dstOffset, 0)] = color;
+}
+
+)";
+
+
+namespace LLGL
+{
+
+
+// Constant buffer layout of the BlitTexture HLSL shader.
+struct DXBlitTextureDescriptor
+{
+    std::int32_t    srcOffset[2];
+    std::int32_t    srcMax[2];
+    float           srcScale[2];
+    std::int32_t    dstOffset[2];
+    std::uint32_t   dstExtent[2];
+    std::uint32_t   linearFilter;
+    std::uint32_t   padding0;
+};
+
+// Fills the blit descriptor for the specified source and destination regions.
+inline void DXInitBlitTextureDescriptor(
+    DXBlitTextureDescriptor&    outDesc,
+    const TextureRegion&        dstRegion,
+    const TextureRegion&        srcRegion,
+    const SamplerFilter         filter)
+{
+    outDesc.srcOffset[0]    = srcRegion.offset.x;
+    outDesc.srcOffset[1]    = srcRegion.offset.y;
+    outDesc.srcMax[0]       = srcRegion.offset.x + static_cast<std::int32_t>(srcRegion.extent.width) - 1;
+    outDesc.srcMax[1]       = srcRegion.offset.y + static_cast<std::int32_t>(srcRegion.extent.height) - 1;
+    outDesc.srcScale[0]     = static_cast<float>(srcRegion.extent.width) / static_cast<float>(dstRegion.extent.width);
+    outDesc.srcScale[1]     = static_cast<float>(srcRegion.extent.height) / static_cast<float>(dstRegion.extent.height);
+    outDesc.dstOffset[0]    = dstRegion.offset.x;
+    outDesc.dstOffset[1]    = dstRegion.offset.y;
+    outDesc.dstExtent[0]    = dstRegion.extent.width;
+    outDesc.dstExtent[1]    = dstRegion.extent.height;
+    outDesc.linearFilter    = (filter == SamplerFilter::Linear ? 1u : 0u);
+    outDesc.padding0        = 0;
+}
+
+// Compiles the builtin blit shader with FXC, since it is not available as precompiled bytecode.
+inline ComPtr<ID3DBlob> DXCompileBlitTextureShader()
+{
+    ComPtr<ID3DBlob> byteCode, errors;
+    HRESULT hr = D3DCompile(
+        g_BlitTexture_HLSL,
+        sizeof(g_BlitTexture_HLSL) - 1,
+        "BlitTexture.hlsl",
+        nullptr,
+        nullptr,
+        "BlitTextureCS",
+        "cs_5_0",
+        D3DCOMPILE_OPTIMIZATION_LEVEL3,
+        0,
+        byteCode.ReleaseAndGetAddressOf(),
+        errors.ReleaseAndGetAddressOf()
+    );
+    return (SUCCEEDED(hr) ? byteCode : nullptr);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -15,9 +15,11 @@
 #include <LLGL/Utils/ForRange.h>
 #include <LLGL/ShaderFlags.h>
 #include <LLGL/RenderSystemFlags.h>
+#include <LLGL/ShaderCache.h>
 #include <stdexcept>
 #include <algorithm>
 #include <d3dcompiler.h>
+#include <dxgi1_5.h>
 
 
 #ifndef LLGL_BUILD_STATIC_LIB
@@ -254,6 +256,22 @@ ComPtr<ID3DBlob> DXCreateBlobFromResource(int resourceID)
     return blob;
 }
 
+ComPtr<ID3DBlob> DXLoadCachedShader(ShaderCache* shaderCache, std::uint64_t key)
+{
+    if (shaderCache != nullptr)
+    {
+        const Blob cachedByteCode = shaderCache->Load(key);
+        return DXCreateBlob(cachedByteCode.GetData(), cachedByteCode.GetSize());
+    }
+    return nullptr;
+}
+
+void DXStoreCachedShader(ShaderCache* shaderCache, std::uint64_t key, ID3DBlob* byteCode)
+{
+    if (shaderCache != nullptr && byteCode != nullptr)
+        shaderCache->Store(key, byteCode->GetBufferPointer(), byteCode->GetBufferSize());
+}
+
 static std::uint32_t GetMaxTextureDimension(D3D_FEATURE_LEVEL featureLevel)
 {
     if (featureLevel >= D3D_FEATURE_LEVEL_11_0) return 16384; // D3D11_REQ_TEXTURE2D_U_OR_V_DIMENSION
@@ -577,6 +595,22 @@ VideoAdapterInfo DXGetVideoAdapterInfo(IDXGIFactory* factory, long preferredAdap
     return VideoAdapterInfo{};
 }
 
+VideoAdapterInfo DXGetVideoAdapterInfoByIndex(IDXGIFactory* factory, UINT adapterIndex, IDXGIAdapter** outAdapter)
+{
+    LLGL_ASSERT_PTR(factory);
+    LLGL_ASSERT_PTR(outAdapter);
+
+    HRESULT hr = factory->EnumAdapters(adapterIndex, outAdapter);
+    DXThrowIfFailed(hr, "failed to find video adapter with the specified index");
+
+    DXGI_ADAPTER_DESC desc;
+    (*outAdapter)->GetDesc(&desc);
+
+    VideoAdapterInfo info;
+    DXConvertVideoAdapterInfo(*outAdapter, desc, info);
+    return info;
+}
+
 Format DXGetSignatureParameterType(D3D_REGISTER_COMPONENT_TYPE componentType, BYTE componentMask)
 {
     switch (componentType)
@@ -643,6 +677,58 @@ DXGI_FORMAT DXPickDepthStencilFormat(int depthBits, int stencilBits)
     return DXGI_FORMAT_D24_UNORM_S8_UINT;
 }
 
+bool DXIsTearingSupported(IDXGIFactory* factory)
+{
+    /* Tearing requires IDXGIFactory5, which is only available since Windows 10 */
+    ComPtr<IDXGIFactory5> factory5;
+    if (factory != nullptr && SUCCEEDED(factory->QueryInterface(IID_PPV_ARGS(factory5.GetAddressOf()))))
+    {
+        BOOL allowTearing = FALSE;
+        if (SUCCEEDED(factory5->CheckFeatureSupport(DXGI_FEATURE_PRESENT_ALLOW_TEARING, &allowTearing, sizeof(allowTearing))))
+            return (allowTearing != FALSE);
+    }
+    return false;
+}
+
+DXGI_FORMAT DXGetColorSpaceFormat(ColorSpace colorSpace)
+{
+    switch (colorSpace)
+    {
+        case ColorSpace::ExtendedSRGB:  return DXGI_FORMAT_R16G16B16A16_FLOAT;
+        case ColorSpace::HDR10:         return DXGI_FORMAT_R10G10B10A2_UNORM;
+        default:                        return DXGI_FORMAT_R8G8B8A8_UNORM;
+    }
+}
+
+static DXGI_COLOR_SPACE_TYPE ToDXGIColorSpace(ColorSpace colorSpace)
+{
+    switch (colorSpace)
+    {
+        case ColorSpace::ExtendedSRGB:  return DXGI_COLOR_SPACE_RGB_FULL_G10_NONE_P709;
+        case ColorSpace::HDR10:         return DXGI_COLOR_SPACE_RGB_FULL_G2084_NONE_P2020;
+        default:                        return DXGI_COLOR_SPACE_RGB_FULL_G22_NONE_P709;
+    }
+}
+
+bool DXSetSwapChainColorSpace(IDXGISwapChain* swapChain, ColorSpace colorSpace)
+{
+    /* Color spaces other than sRGB require IDXGISwapChain3, which is only available since Windows 10 */
+    ComPtr<IDXGISwapChain3> swapChain3;
+    if (swapChain == nullptr || FAILED(swapChain->QueryInterface(IID_PPV_ARGS(swapChain3.GetAddressOf()))))
+        return (colorSpace == ColorSpace::SRGB);
+
+    const DXGI_COLOR_SPACE_TYPE colorSpaceDXGI = ToDXGIColorSpace(colorSpace);
+
+    UINT colorSpaceSupport = 0;
+    if (FAILED(swapChain3->CheckColorSpaceSupport(colorSpaceDXGI, &colorSpaceSupport)) ||
+        (colorSpaceSupport & DXGI_SWAP_CHAIN_COLOR_SPACE_SUPPORT_FLAG_PRESENT) == 0)
+    {
+        return false;
+    }
+
+    return SUCCEEDED(swapChain3->SetColorSpace1(colorSpaceDXGI));
+}
+
 
 } // /namespace LLGL
 
@@ -11,6 +11,7 @@
 
 #include <LLGL/Utils/ColorRGBA.h>
 #include <LLGL/RenderSystemFlags.h>
+#include <LLGL/SwapChainFlags.h>
 #include "../VideoAdapter.h"
 #include <LLGL/ImageFlags.h>
 #include "ComPtr.h"
@@ -57,6 +58,12 @@ ComPtr<ID3DBlob> DXCreateBlob(const std::vector<char>& data);
 // Returns a blob that was created from a resource (*.rc files).
 ComPtr<ID3DBlob> DXCreateBlobFromResource(int resourceID);
 
+// Returns a blob with the shader bytecode of the specified cache entry or null if the shader cache is null or has no such entry.
+ComPtr<ID3DBlob> DXLoadCachedShader(ShaderCache* shaderCache, std::uint64_t key);
+
+// Stores the specified shader bytecode in the cache entry with the specified key unless the shader cache or bytecode is null.
+void DXStoreCachedShader(ShaderCache* shaderCache, std::uint64_t key, ID3DBlob* byteCode);
+
 // Returns the rendering capabilites of the specified Direct3D feature level.
 void DXGetRenderingCaps(RenderingCapabilities& caps, D3D_FEATURE_LEVEL featureLevel);
 
@@ -78,12 +85,24 @@ void DXConvertVideoAdapterInfo(IDXGIAdapter* adapter, const DXGI_ADAPTER_DESC& i
 // Returns the video adapter descriptor from the specified DXGI adapter.
 VideoAdapterInfo DXGetVideoAdapterInfo(IDXGIFactory* factory, long preferredAdapterFlags = 0, IDXGIAdapter** outPreferredAdatper = nullptr);
 
+// Returns the video adapter descriptor of the DXGI adapter with the specified index. Throws an exception if there is no such adapter (see RenderSystemDescriptor::adapterIndex).
+VideoAdapterInfo DXGetVideoAdapterInfoByIndex(IDXGIFactory* factory, UINT adapterIndex, IDXGIAdapter** outAdapter);
+
 // Returns the format for the specified signature parameter type (by its component type and mask).
 Format DXGetSignatureParameterType(D3D_REGISTER_COMPONENT_TYPE componentType, BYTE componentMask);
 
 // Returns a suitable DXGI format for the specified depth-stencil mode.
 DXGI_FORMAT DXPickDepthStencilFormat(int depthBits, int stencilBits);
 
+// Returns true if the DXGI factory supports presenting with tearing (DXGI_FEATURE_PRESENT_ALLOW_TEARING). This requires IDXGIFactory5.
+bool DXIsTearingSupported(IDXGIFactory* factory);
+
+// Returns the DXGI format for swap-chain buffers in the specified color space, i.e. RGBA16Float for scRGB, RGB10A2 for HDR10, and RGBA8 otherwise.
+DXGI_FORMAT DXGetColorSpaceFormat(ColorSpace colorSpace);
+
+// Sets the color space of the specified swap-chain if it is supported for presentation. This requires IDXGISwapChain3. Returns false if the color space is not supported.
+bool DXSetSwapChainColorSpace(IDXGISwapChain* swapChain, ColorSpace colorSpace);
+
 
 } // /namespace LLGL
 
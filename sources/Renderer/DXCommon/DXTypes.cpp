@@ -7,6 +7,7 @@
 
 #include "DXTypes.h"
 #include "../../Core/Exception.h"
+#include <dxgi.h>
 #include <stdexcept>
 #include <string>
 
@@ -220,6 +221,19 @@ D3D_PRIMITIVE_TOPOLOGY ToD3DPrimitiveTopology(const PrimitiveTopology topology)
     MapFailed("PrimitiveTopology", "D3D_PRIMITIVE_TOPOLOGY");
 }
 
+UINT ToDXResidencyPriority(const ResidencyPriority priority)
+{
+    switch (priority)
+    {
+        case ResidencyPriority::Minimum:    return DXGI_RESOURCE_PRIORITY_MINIMUM;
+        case ResidencyPriority::Low:        return DXGI_RESOURCE_PRIORITY_LOW;
+        case ResidencyPriority::Normal:     return DXGI_RESOURCE_PRIORITY_NORMAL;
+        case ResidencyPriority::High:       return DXGI_RESOURCE_PRIORITY_HIGH;
+        case ResidencyPriority::Maximum:    return DXGI_RESOURCE_PRIORITY_MAXIMUM;
+    }
+    MapFailed("ResidencyPriority", "DXGI_RESOURCE_PRIORITY");
+}
+
 Format Unmap(const DXGI_FORMAT format)
 {
     switch (format)
@@ -15,6 +15,7 @@
 #include <LLGL/PipelineStateFlags.h>
 #include <LLGL/TextureFlags.h>
 #include <LLGL/BufferFlags.h>
+#include <LLGL/ResourceFlags.h>
 #include <dxgiformat.h>
 #include <d3dcommon.h>
 
@@ -63,6 +64,9 @@ bool IsDepthStencilDXGIFormat(const DXGI_FORMAT format);
 
 D3D_PRIMITIVE_TOPOLOGY  ToD3DPrimitiveTopology(const PrimitiveTopology topology);
 
+// Returns the DXGI_RESOURCE_PRIORITY value for the specified priority. These values are identical to D3D12_RESIDENCY_PRIORITY.
+UINT ToDXResidencyPriority(const ResidencyPriority priority);
+
 Format                  Unmap( const DXGI_FORMAT            format    );
 StorageBufferType       Unmap( const D3D_SHADER_INPUT_TYPE  inputType );
 SystemValue             Unmap( const D3D_NAME               name      );
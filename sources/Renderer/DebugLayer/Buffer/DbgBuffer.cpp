@@ -34,6 +34,16 @@ void DbgBuffer::SetDebugName(const char* name)
     DbgSetObjectName(*this, name);
 }
 
+void DbgBuffer::SetResidencyPriority(ResidencyPriority priority)
+{
+    instance.SetResidencyPriority(priority);
+}
+
+bool DbgBuffer::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
+{
+    return instance.GetNativeHandle(nativeHandle, nativeHandleSize);
+}
+
 BufferDescriptor DbgBuffer::GetDesc() const
 {
     return instance.GetDesc();
@@ -65,6 +75,28 @@ bool DbgBuffer::IsMappedForCPUAccess() const
     return (mappedRange_[0] < mappedRange_[1]);
 }
 
+AccelerationStructureBuildDescriptor DbgGetAccelerationStructureBuildInstance(
+    const AccelerationStructureBuildDescriptor&     buildDesc,
+    std::vector<AccelerationStructureTriangles>&    outTriangles)
+{
+    outTriangles.assign(buildDesc.triangles.begin(), buildDesc.triangles.end());
+    for (AccelerationStructureTriangles& triangles : outTriangles)
+    {
+        triangles.vertexBuffer  = DbgGetInstance<DbgBuffer>(triangles.vertexBuffer);
+        triangles.indexBuffer   = DbgGetInstance<DbgBuffer>(triangles.indexBuffer);
+    }
+
+    AccelerationStructureBuildDescriptor instanceDesc = buildDesc;
+    {
+        instanceDesc.dst            = DbgGetInstance<DbgBuffer>(buildDesc.dst);
+        instanceDesc.src            = DbgGetInstance<DbgBuffer>(buildDesc.src);
+        instanceDesc.scratchBuffer  = DbgGetInstance<DbgBuffer>(buildDesc.scratchBuffer);
+        instanceDesc.triangles      = outTriangles;
+        instanceDesc.instanceBuffer = DbgGetInstance<DbgBuffer>(buildDesc.instanceBuffer);
+    }
+    return instanceDesc;
+}
+
 
 } // /namespace LLGL
 
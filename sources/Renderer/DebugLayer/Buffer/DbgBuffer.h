@@ -10,8 +10,10 @@
 
 
 #include <LLGL/Buffer.h>
+#include <LLGL/AccelerationStructureFlags.h>
 #include <LLGL/Container/SmallVector.h>
 #include <string>
+#include <vector>
 
 
 namespace LLGL
@@ -26,6 +28,8 @@ class DbgBuffer final : public Buffer
     public:
 
         void SetDebugName(const char* name) override;
+        void SetResidencyPriority(ResidencyPriority priority) override;
+        bool GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize) override;
 
         BufferDescriptor GetDesc() const override;
 
@@ -54,6 +58,15 @@ class DbgBuffer final : public Buffer
 
 };
 
+/*
+Returns a copy of the specified acceleration structure build descriptor with all debug buffers replaced by their instances.
+The triangle geometry of the returned descriptor refers to 'outTriangles'.
+*/
+AccelerationStructureBuildDescriptor DbgGetAccelerationStructureBuildInstance(
+    const AccelerationStructureBuildDescriptor&     buildDesc,
+    std::vector<AccelerationStructureTriangles>&    outTriangles
+);
+
 
 } // /namespace LLGL
 
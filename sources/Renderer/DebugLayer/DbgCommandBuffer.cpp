@@ -8,6 +8,7 @@
 #include "DbgCommandBuffer.h"
 #include "DbgCore.h"
 #include "DbgReportUtils.h"
+#include "DbgValidationSampler.h"
 #include "../CheckedCast.h"
 #include "../ResourceUtils.h"
 #include "../PipelineStateUtils.h"
@@ -30,6 +31,7 @@
 #include <LLGL/TypeInfo.h>
 #include <LLGL/Utils/TypeNames.h>
 #include <LLGL/Utils/ForRange.h>
+#include <LLGL/Container/SmallVector.h>
 #include <algorithm>
 #include <cstring>
 
@@ -66,17 +68,21 @@ DbgCommandBuffer::DbgCommandBuffer(
     CommandQueue&                   commandQueueInstance,
     CommandBuffer&                  commandBufferInstance,
     FrameProfile&                   commonProfile,
+    DbgPassQueryResolver&           passQueryResolver,
+    DbgValidationSampler&           validationSampler,
     RenderingDebugger*              debugger,
     const CommandBufferDescriptor&  desc,
     const RenderingCapabilities&    caps)
 :
-    instance        { commandBufferInstance                                             },
-    desc            { desc                                                              },
-    debugger_       { debugger                                                          },
-    commonProfile_  { commonProfile                                                     },
-    features_       { caps.features                                                     },
-    limits_         { caps.limits                                                       },
-    queryTimerPool_ { renderSystemInstance, commandQueueInstance, commandBufferInstance }
+    instance            { commandBufferInstance                                                                },
+    desc                { desc                                                                                 },
+    debugger_           { debugger                                                                             },
+    debuggerInstance_   { debugger                                                                             },
+    validationSampler_  { validationSampler                                                                    },
+    commonProfile_      { commonProfile                                                                        },
+    features_           { caps.features                                                                        },
+    limits_             { caps.limits                                                                          },
+    queryTimerPool_     { renderSystemInstance, commandQueueInstance, commandBufferInstance, passQueryResolver }
 {
 }
 
@@ -88,11 +94,19 @@ void DbgCommandBuffer::Begin()
     ResetStates();
     ResetRecords();
 
+    /* Only validate this encoding if it was sampled; profiling is independent of sampling */
+    debugger_ = (debuggerInstance_ != nullptr && validationSampler_.SampleEncoding(*debuggerInstance_) ? debuggerInstance_ : nullptr);
+
     /* Enable performance timer if it was scheduled */
-    perfProfilerEnabled_ = (debugger_ != nullptr && debugger_->GetTimeRecording());
+    perfProfilerEnabled_ = (debuggerInstance_ != nullptr && debuggerInstance_->GetTimeRecording());
     if (perfProfilerEnabled_)
         queryTimerPool_.Reset();
 
+    /* Enable pass queries if they were scheduled */
+    passProfilerEnabled_ = (debuggerInstance_ != nullptr && debuggerInstance_->GetPassRecording());
+    if (passProfilerEnabled_)
+        queryTimerPool_.BeginPassRecording(perfProfilerEnabled_);
+
     /* Begin with command recording  */
     if (debugger_)
         EnableRecording(true);
@@ -107,17 +121,15 @@ void DbgCommandBuffer::End()
     /* End with command recording */
     if (debugger_)
         EnableRecording(false);
+    if (passProfilerEnabled_)
+        queryTimerPool_.EndPassRecording();
     instance.End();
 
-    /* Resolve timer query results for performance profiler */
-    if (perfProfilerEnabled_)
-        queryTimerPool_.TakeRecords(profile_.timeRecords);
-
     if ((desc.flags & CommandBufferFlags::ImmediateSubmit) != 0)
     {
         /* Merge frame profile values into rendering profiler */
         FrameProfile profile;
-        FlushProfile(profile);
+        FlushProfile(profile, commonProfile_.commandQueueRecord.commandBufferSubmittions);
 
         RenderingDebugger::MergeProfiles(commonProfile_, profile);
         commonProfile_.commandQueueRecord.commandBufferSubmittions++;
@@ -141,9 +153,27 @@ void DbgCommandBuffer::Execute(CommandBuffer& deferredCommandBuffer)
             CommandBufferFlags::Secondary,
             "LLGL::CommandBuffer"
         );
+
+        if (commandBufferDbg.desc.renderPass != nullptr && !states_.insideRenderPass)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidState,
+                "secondary command buffer that continues a render pass must be executed inside a render pass"
+            );
+        }
     }
 
     LLGL_DBG_COMMAND( "Execute", instance.Execute(commandBufferDbg.instance) );
+
+    if (debugger_)
+    {
+        /* All bindings of this command buffer are undefined after executing a secondary command buffer */
+        bindings_.numViewports      = 0;
+        bindings_.vertexBuffers     = nullptr;
+        bindings_.numVertexBuffers  = 0;
+        bindings_.indexBuffer       = nullptr;
+        bindings_.pipelineState     = nullptr;
+    }
 }
 
 /* ----- Blitting ----- */
@@ -152,7 +182,7 @@ void DbgCommandBuffer::UpdateBuffer(
     Buffer&         dstBuffer,
     std::uint64_t   dstOffset,
     const void*     data,
-    std::uint16_t   dataSize)
+    std::uint64_t   dataSize)
 {
     auto& dstBufferDbg = LLGL_CAST(DbgBuffer&, dstBuffer);
 
@@ -166,6 +196,7 @@ void DbgCommandBuffer::UpdateBuffer(
     LLGL_DBG_COMMAND( "UpdateBuffer", instance.UpdateBuffer(dstBufferDbg.instance, dstOffset, data, dataSize) );
 
     profile_.commandBufferRecord.bufferUpdates++;
+    profile_.memoryRecord.uploadedBytes += dataSize;
 }
 
 void DbgCommandBuffer::CopyBuffer(
@@ -193,6 +224,32 @@ void DbgCommandBuffer::CopyBuffer(
     profile_.commandBufferRecord.bufferCopies++;
 }
 
+void DbgCommandBuffer::CopyBuffer(
+    Buffer&                                 dstBuffer,
+    Buffer&                                 srcBuffer,
+    const ArrayView<BufferCopyRegion>&      regions)
+{
+    auto& dstBufferDbg = LLGL_CAST(DbgBuffer&, dstBuffer);
+    auto& srcBufferDbg = LLGL_CAST(DbgBuffer&, srcBuffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+        AssertRecording();
+        ValidateBindBufferFlags(dstBufferDbg, BindFlags::CopyDst);
+        ValidateBindBufferFlags(srcBufferDbg, BindFlags::CopySrc);
+        for (const BufferCopyRegion& region : regions)
+        {
+            ValidateBufferRange(dstBufferDbg, region.dstOffset, region.size, "destination range");
+            ValidateBufferRange(srcBufferDbg, region.srcOffset, region.size, "source range");
+        }
+    }
+
+    LLGL_DBG_COMMAND( "CopyBuffer", instance.CopyBuffer(dstBufferDbg.instance, srcBufferDbg.instance, regions) );
+
+    profile_.commandBufferRecord.bufferCopies += static_cast<std::uint32_t>(regions.size());
+}
+
 // Returns the minimum required memory footprint to copy the specified texture region into a buffer
 static std::size_t GetTextureRegionMinFootprint(const DbgTexture& textureDbg, const TextureRegion& region)
 {
@@ -282,6 +339,27 @@ void DbgCommandBuffer::CopyTexture(
     profile_.commandBufferRecord.textureCopies++;
 }
 
+void DbgCommandBuffer::CopyTexture(
+    Texture&                                dstTexture,
+    Texture&                                srcTexture,
+    const ArrayView<TextureCopyRegion>&     regions)
+{
+    auto& dstTextureDbg = LLGL_CAST(DbgTexture&, dstTexture);
+    auto& srcTextureDbg = LLGL_CAST(DbgTexture&, srcTexture);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+        AssertRecording();
+        ValidateBindTextureFlags(dstTextureDbg, BindFlags::CopyDst);
+        ValidateBindTextureFlags(srcTextureDbg, BindFlags::CopySrc);
+    }
+
+    LLGL_DBG_COMMAND( "CopyTexture", instance.CopyTexture(dstTextureDbg.instance, srcTextureDbg.instance, regions) );
+
+    profile_.commandBufferRecord.textureCopies += static_cast<std::uint32_t>(regions.size());
+}
+
 void DbgCommandBuffer::CopyTextureFromBuffer(
     Texture&                dstTexture,
     const TextureRegion&    dstRegion,
@@ -309,6 +387,33 @@ void DbgCommandBuffer::CopyTextureFromBuffer(
     profile_.commandBufferRecord.textureCopies++;
 }
 
+void DbgCommandBuffer::CopyTextureFromBuffer(
+    Texture&                                    dstTexture,
+    Buffer&                                     srcBuffer,
+    const ArrayView<BufferTextureCopyRegion>&   regions)
+{
+    auto& dstTextureDbg = LLGL_CAST(DbgTexture&, dstTexture);
+    auto& srcBufferDbg = LLGL_CAST(DbgBuffer&, srcBuffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+        AssertRecording();
+        ValidateBindTextureFlags(dstTextureDbg, BindFlags::CopyDst);
+        ValidateBindBufferFlags(srcBufferDbg, BindFlags::CopySrc);
+        for (const BufferTextureCopyRegion& region : regions)
+        {
+            ValidateTextureRegion(dstTextureDbg, region.textureRegion);
+            ValidateBufferRange(srcBufferDbg, region.bufferOffset, GetTextureRegionMinFootprint(dstTextureDbg, region.textureRegion));
+            ValidateTextureBufferCopyStrides(dstTextureDbg, region.rowStride, region.layerStride, region.textureRegion.extent);
+        }
+    }
+
+    LLGL_DBG_COMMAND( "CopyTextureFromBuffer", instance.CopyTextureFromBuffer(dstTextureDbg.instance, srcBufferDbg.instance, regions) );
+
+    profile_.commandBufferRecord.textureCopies += static_cast<std::uint32_t>(regions.size());
+}
+
 void DbgCommandBuffer::CopyTextureFromFramebuffer(
     Texture&                dstTexture,
     const TextureRegion&    dstRegion,
@@ -339,6 +444,35 @@ void DbgCommandBuffer::CopyTextureFromFramebuffer(
     profile_.commandBufferRecord.textureCopies++;
 }
 
+void DbgCommandBuffer::BlitTexture(
+    Texture&                dstTexture,
+    const TextureRegion&    dstRegion,
+    Texture&                srcTexture,
+    const TextureRegion&    srcRegion,
+    const SamplerFilter     filter)
+{
+    auto& dstTextureDbg = LLGL_CAST(DbgTexture&, dstTexture);
+    auto& srcTextureDbg = LLGL_CAST(DbgTexture&, srcTexture);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+        AssertRecording();
+        if (states_.insideRenderPass)
+            LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot blit texture inside a render pass");
+        if (&dstTextureDbg == &srcTextureDbg)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot blit texture into itself");
+        ValidateBindTextureFlags(dstTextureDbg, BindFlags::CopyDst | BindFlags::Storage);
+        ValidateBindTextureFlags(srcTextureDbg, BindFlags::CopySrc | BindFlags::Sampled);
+        ValidateBlitTextureRegion(dstTextureDbg, dstRegion, true);
+        ValidateBlitTextureRegion(srcTextureDbg, srcRegion, false);
+    }
+
+    LLGL_DBG_COMMAND( "BlitTexture", instance.BlitTexture(dstTextureDbg.instance, dstRegion, srcTextureDbg.instance, srcRegion, filter) );
+
+    profile_.commandBufferRecord.textureCopies++;
+}
+
 void DbgCommandBuffer::GenerateMips(Texture& texture)
 {
     auto& textureDbg = LLGL_CAST(DbgTexture&, texture);
@@ -452,7 +586,7 @@ void DbgCommandBuffer::SetScissors(std::uint32_t numScissors, const Scissor* sci
 
 /* ----- Buffers ------ */
 
-void DbgCommandBuffer::SetVertexBuffer(Buffer& buffer)
+void DbgCommandBuffer::SetVertexBuffer(Buffer& buffer, std::uint64_t offset)
 {
     auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
 
@@ -462,12 +596,22 @@ void DbgCommandBuffer::SetVertexBuffer(Buffer& buffer)
         AssertRecording();
         ValidateBindBufferFlags(bufferDbg, BindFlags::VertexBuffer);
 
+        if (offset > bufferDbg.desc.size)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidArgument,
+                "vertex buffer offset out of bounds: %" PRIu64 " specified but limit is %" PRIu64,
+                offset, bufferDbg.desc.size
+            );
+        }
+
+        bindings_.vertexBufferStore.resize(1);
         bindings_.vertexBufferStore[0]  = (&bufferDbg);
-        bindings_.vertexBuffers         = bindings_.vertexBufferStore;
+        bindings_.vertexBuffers         = bindings_.vertexBufferStore.data();
         bindings_.numVertexBuffers      = 1;
     }
 
-    LLGL_DBG_COMMAND( "SetVertexBuffer", instance.SetVertexBuffer(bufferDbg.instance) );
+    LLGL_DBG_COMMAND( "SetVertexBuffer", instance.SetVertexBuffer(bufferDbg.instance, offset) );
 
     profile_.commandBufferRecord.vertexBufferBindings++;
 }
@@ -491,6 +635,69 @@ void DbgCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
     profile_.commandBufferRecord.vertexBufferBindings++;
 }
 
+void DbgCommandBuffer::SetVertexBuffers(std::uint32_t firstSlot, std::uint32_t numBuffers, Buffer* const * buffers, const std::uint64_t* offsets)
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+        AssertRecording();
+        if (numBuffers > 0 && buffers == nullptr)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "array of vertex buffers must not be null for %u buffer(s)", numBuffers);
+    }
+
+    /* Translate buffers into their instances */
+    SmallVector<Buffer*> bufferInstances;
+    bufferInstances.resize(numBuffers);
+
+    if (buffers != nullptr)
+    {
+        /* Merge vertex buffers with the currently bound ones, since only the specified range of slots is overwritten */
+        if (debugger_ && bindings_.vertexBuffers != bindings_.vertexBufferStore.data())
+            bindings_.vertexBufferStore = SmallVector<DbgBuffer*>(bindings_.vertexBuffers, bindings_.vertexBuffers + bindings_.numVertexBuffers);
+
+        for_range(i, numBuffers)
+        {
+            auto* bufferDbg = LLGL_CAST(DbgBuffer*, buffers[i]);
+            if (bufferDbg == nullptr)
+            {
+                if (debugger_)
+                    LLGL_DBG_ERROR(ErrorType::InvalidArgument, "vertex buffer at slot %u must not be null", firstSlot + i);
+                return;
+            }
+
+            if (debugger_)
+            {
+                ValidateBindBufferFlags(*bufferDbg, BindFlags::VertexBuffer);
+                if (offsets != nullptr && offsets[i] > bufferDbg->desc.size)
+                {
+                    LLGL_DBG_ERROR(
+                        ErrorType::InvalidArgument,
+                        "vertex buffer offset (%" PRIu64 ") at slot %u exceeds buffer size (%" PRIu64 ")",
+                        offsets[i], firstSlot + i, bufferDbg->desc.size
+                    );
+                }
+
+                /* Store buffer in binding slot and leave unbound slots in between as null */
+                if (bindings_.vertexBufferStore.size() < firstSlot + i + 1)
+                    bindings_.vertexBufferStore.resize(firstSlot + i + 1, nullptr);
+                bindings_.vertexBufferStore[firstSlot + i] = bufferDbg;
+            }
+
+            bufferInstances[i] = &(bufferDbg->instance);
+        }
+
+        if (debugger_)
+        {
+            bindings_.vertexBuffers     = bindings_.vertexBufferStore.data();
+            bindings_.numVertexBuffers  = static_cast<std::uint32_t>(bindings_.vertexBufferStore.size());
+        }
+    }
+
+    LLGL_DBG_COMMAND( "SetVertexBuffers", instance.SetVertexBuffers(firstSlot, numBuffers, bufferInstances.data(), offsets) );
+
+    profile_.commandBufferRecord.vertexBufferBindings++;
+}
+
 void DbgCommandBuffer::SetIndexBuffer(Buffer& buffer)
 {
     auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
@@ -567,103 +774,43 @@ void DbgCommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap, std::uint32_t
 
 void DbgCommandBuffer::SetResource(std::uint32_t descriptor, Resource& resource)
 {
-    const BindingDescriptor* bindingDesc = nullptr;
-
     if (debugger_)
     {
         LLGL_DBG_SOURCE();
         AssertRecording();
-
-        if (auto* pso = bindings_.pipelineState)
-        {
-            if (auto* psoLayout = pso->pipelineLayout)
-                bindingDesc = GetAndValidateResourceDescFromPipeline(*psoLayout, descriptor, resource);
-        }
-        else
+        if (bindings_.pipelineState == nullptr)
             LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot bind resource without pipeline state");
-
-        if (descriptor < bindings_.bindingTable.resources.size())
-            bindings_.bindingTable.resources[descriptor] = &resource;
     }
 
-    switch (resource.GetResourceType())
+    if (Resource* resourceInstance = GetAndValidateResourceBinding(descriptor, resource))
     {
-        case ResourceType::Undefined:
-        break;
-
-        case ResourceType::Buffer:
-        {
-            /* Forward buffer resource to wrapped instance */
-            auto& bufferDbg = LLGL_CAST(DbgBuffer&, resource);
-
-            if (bindingDesc != nullptr)
-            {
-                ValidateBindFlags(
-                    bufferDbg.desc.bindFlags,
-                    bindingDesc->bindFlags,
-                    (BindFlags::ConstantBuffer | BindFlags::Sampled | BindFlags::Storage),
-                    GetLabelOrDefault(bufferDbg.label, "LLGL::Buffer")
-                );
-            }
-
-            LLGL_DBG_COMMAND( "SetResource", instance.SetResource(descriptor, bufferDbg.instance) );
-
-            /* Record binding for profiling */
-            if (bindingDesc != nullptr)
-            {
-                if ((bindingDesc->bindFlags & BindFlags::ConstantBuffer) != 0)
-                    profile_.commandBufferRecord.constantBufferBindings++;
-                if ((bindingDesc->bindFlags & BindFlags::Sampled) != 0)
-                    profile_.commandBufferRecord.sampledBufferBindings++;
-                if ((bindingDesc->bindFlags & BindFlags::Storage) != 0)
-                    profile_.commandBufferRecord.storageBufferBindings++;
-            }
-        }
-        break;
-
-        case ResourceType::Texture:
-        {
-            /* Forward texture resource to wrapped instance */
-            auto& textureDbg = LLGL_CAST(DbgTexture&, resource);
-
-            if (bindingDesc != nullptr)
-            {
-                ValidateBindFlags(
-                    textureDbg.desc.bindFlags,
-                    bindingDesc->bindFlags,
-                    (BindFlags::Sampled | BindFlags::Storage | BindFlags::CombinedSampler),
-                    GetLabelOrDefault(textureDbg.label, "LLGL::Buffer")
-                );
-            }
-
-            LLGL_DBG_COMMAND( "SetResource", instance.SetResource(descriptor, textureDbg.instance) );
-
-            /* Record binding for profiling */
-            if (bindingDesc != nullptr)
-            {
-                if ((bindingDesc->bindFlags & BindFlags::Sampled) != 0)
-                    profile_.commandBufferRecord.sampledTextureBindings++;
-                if ((bindingDesc->bindFlags & BindFlags::Storage) != 0)
-                    profile_.commandBufferRecord.storageTextureBindings++;
-            }
-        }
-        break;
+        LLGL_DBG_COMMAND( "SetResource", instance.SetResource(descriptor, *resourceInstance) );
+    }
+}
 
-        case ResourceType::Sampler:
-        {
-            /* No bind flags allowed for samplers */
-            //TODO: use DbgSampler
-            if (bindingDesc != nullptr)
-                ValidateBindFlags(0, bindingDesc->bindFlags, 0, "LLGL::Sampler");
+void DbgCommandBuffer::SetResources(std::uint32_t firstDescriptor, const ArrayView<Resource*>& resources)
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+        AssertRecording();
+        if (resources.empty())
+            LLGL_DBG_WARN(WarningType::PointlessOperation, "no resources are specified to bind");
+        if (bindings_.pipelineState == nullptr)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot bind resources without pipeline state");
+    }
 
-            /* Forward sampler resource to wrapped instance */
-            LLGL_DBG_COMMAND( "SetResource", instance.SetResource(descriptor, resource) );
+    /* Validate and unwrap all resources */
+    SmallVector<Resource*, 16> resourceInstances;
+    resourceInstances.resize(resources.size(), nullptr);
 
-            /* Record binding for profiling */
-            profile_.commandBufferRecord.samplerBindings++;
-        }
-        break;
+    for_range(i, resources.size())
+    {
+        if (resources[i] != nullptr)
+            resourceInstances[i] = GetAndValidateResourceBinding(firstDescriptor + static_cast<std::uint32_t>(i), *resources[i]);
     }
+
+    LLGL_DBG_COMMAND( "SetResources", instance.SetResources(firstDescriptor, ArrayView<Resource*>{ resourceInstances.data(), resourceInstances.size() }) );
 }
 
 void DbgCommandBuffer::ResetResourceSlots(
@@ -684,6 +831,88 @@ void DbgCommandBuffer::ResetResourceSlots(
     LLGL_DBG_COMMAND( "ResetResourceSlots", instance.ResetResourceSlots(resourceType, firstSlot, numSlots, bindFlags, stageFlags) );
 }
 
+void DbgCommandBuffer::ResourceBarrier(std::uint32_t numBarriers, const ResourceBarrierDescriptor* barriers)
+{
+    constexpr long validUsageFlags =
+    (
+        BindFlags::VertexBuffer         | BindFlags::IndexBuffer        | BindFlags::ConstantBuffer         |
+        BindFlags::StreamOutputBuffer   | BindFlags::IndirectBuffer     | BindFlags::Sampled                |
+        BindFlags::Storage              | BindFlags::ColorAttachment    | BindFlags::DepthStencilAttachment |
+        BindFlags::CopySrc              | BindFlags::CopyDst
+    );
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+        AssertRecording();
+
+        if (states_.insideRenderPass)
+            LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot insert resource barriers inside a render pass");
+        if (numBarriers == 0)
+            LLGL_DBG_WARN(WarningType::PointlessOperation, "no resource barriers specified");
+        else if (barriers == nullptr)
+        {
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "resource barriers must not be null when number of barriers is %u", numBarriers);
+            return;
+        }
+    }
+
+    /* Replace debug resources by their wrapped instances */
+    SmallVector<ResourceBarrierDescriptor, 8> barriersInstance;
+    barriersInstance.reserve(numBarriers);
+
+    for_range(i, numBarriers)
+    {
+        ResourceBarrierDescriptor barrier = barriers[i];
+
+        if (debugger_)
+        {
+            if (barrier.srcUsage == 0 || barrier.dstUsage == 0)
+                LLGL_DBG_ERROR(ErrorType::InvalidArgument, "source and destination usage of resource barrier [%u] must not be zero", i);
+            if (((barrier.srcUsage | barrier.dstUsage) & ~validUsageFlags) != 0)
+                LLGL_DBG_ERROR(ErrorType::InvalidArgument, "invalid usage flags in resource barrier [%u]", i);
+            ValidateStageFlags(barrier.srcStages, StageFlags::AllStages);
+            ValidateStageFlags(barrier.dstStages, StageFlags::AllStages);
+        }
+
+        if (barrier.resource != nullptr)
+        {
+            switch (barrier.resource->GetResourceType())
+            {
+                case ResourceType::Buffer:
+                {
+                    auto* bufferDbg = LLGL_CAST(DbgBuffer*, barrier.resource);
+                    if (debugger_)
+                        ValidateBarrierUsage(bufferDbg->desc.bindFlags, (barrier.srcUsage | barrier.dstUsage), i, GetLabelOrDefault(bufferDbg->label, "LLGL::Buffer"));
+                    barrier.resource = &(bufferDbg->instance);
+                }
+                break;
+
+                case ResourceType::Texture:
+                {
+                    auto* textureDbg = LLGL_CAST(DbgTexture*, barrier.resource);
+                    if (debugger_)
+                        ValidateBarrierUsage(textureDbg->desc.bindFlags, (barrier.srcUsage | barrier.dstUsage), i, GetLabelOrDefault(textureDbg->label, "LLGL::Texture"));
+                    barrier.resource = &(textureDbg->instance);
+                }
+                break;
+
+                default:
+                {
+                    if (debugger_)
+                        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "resource barrier [%u] must refer to a buffer or texture", i);
+                    barrier.resource = nullptr;
+                }
+                break;
+            }
+        }
+
+        barriersInstance.push_back(barrier);
+    }
+
+    LLGL_DBG_COMMAND( "ResourceBarrier", instance.ResourceBarrier(numBarriers, barriersInstance.data()) );
+}
+
 /* ----- Render Passes ----- */
 
 void DbgCommandBuffer::BeginRenderPass(
@@ -716,10 +945,18 @@ void DbgCommandBuffer::BeginRenderPass(
             }
             states_.insideRenderPass = true;
         }
+
+        /* Track subpasses to validate NextSubpass() and graphics PSOs against them */
+        auto renderPassDbg = DbgGetWrapper<DbgRenderPass>(renderPass);
+        states_.subpass         = 0;
+        states_.numSubpasses    = (renderPassDbg != nullptr ? renderPassDbg->NumSubpasses() : 1);
     }
 
     const RenderPass* renderPassInstance = DbgGetInstance<DbgRenderPass>(renderPass);
 
+    if (passProfilerEnabled_)
+        queryTimerPool_.InterruptPass();
+
     if (LLGL::IsInstanceOf<SwapChain>(renderTarget))
     {
         auto& swapChainDbg = LLGL_CAST(DbgSwapChain&, renderTarget);
@@ -749,6 +986,9 @@ void DbgCommandBuffer::BeginRenderPass(
         instance.BeginRenderPass(renderTargetDbg.instance, renderPassInstance, numClearValues, clearValues, swapBufferIndex);
     }
 
+    if (passProfilerEnabled_)
+        queryTimerPool_.BeginPass("RenderPass");
+
     profile_.commandBufferRecord.renderPassSections++;
 }
 
@@ -760,10 +1000,52 @@ void DbgCommandBuffer::EndRenderPass()
         AssertRecording();
         if (!states_.insideRenderPass)
             LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot end render pass while no render pass is currently active");
+        else if (states_.subpass + 1 < states_.numSubpasses)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidState,
+                "cannot end render pass in subpass %u; all %u subpasses must be processed before the render pass ends",
+                states_.subpass, states_.numSubpasses
+            );
+        }
         states_.insideRenderPass = false;
     }
 
-    instance.EndRenderPass();
+    if (passProfilerEnabled_)
+    {
+        queryTimerPool_.InterruptPass();
+        queryTimerPool_.EndPass();
+        instance.EndRenderPass();
+        queryTimerPool_.ResumePass();
+    }
+    else
+        instance.EndRenderPass();
+}
+
+void DbgCommandBuffer::NextSubpass()
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+        AssertRecording();
+        AssertInsideRenderPass();
+        if (states_.subpass + 1 >= states_.numSubpasses)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidState,
+                "cannot advance to next subpass; current render pass has only %u subpass(es)",
+                states_.numSubpasses
+            );
+        }
+        else
+            ++states_.subpass;
+
+        /* Each graphics PSO is only compatible with a single subpass */
+        if (bindings_.pipelineState != nullptr && bindings_.pipelineState->isGraphicsPSO)
+            bindings_.pipelineState = nullptr;
+    }
+
+    LLGL_DBG_COMMAND( "NextSubpass", instance.NextSubpass() );
 }
 
 void DbgCommandBuffer::Clear(long flags, const ClearValue& clearValue)
@@ -823,10 +1105,21 @@ void DbgCommandBuffer::SetPipelineState(PipelineState& pipelineState)
             /* Store dynamic states */
             bindings_.blendFactorSet = !pipelineStateDbg.HasDynamicBlendFactor();
             bindings_.stencilRefSet = !pipelineStateDbg.HasDynamicStencilRef();
+            bindings_.dynamicStatesUnset = pipelineStateDbg.graphicsDesc.dynamicStates;
 
             /* If the PSO was created with static viewports, this PSO dictates the number of bound viewports */
             if (!pipelineStateDbg.graphicsDesc.viewports.empty())
                 bindings_.numViewports = static_cast<std::uint32_t>(pipelineStateDbg.graphicsDesc.viewports.size());
+
+            /* Graphics PSOs are only compatible with the subpass they were created for */
+            if (states_.insideRenderPass && pipelineStateDbg.graphicsDesc.subpass != states_.subpass)
+            {
+                LLGL_DBG_ERROR(
+                    ErrorType::InvalidState,
+                    "graphics PSO was created for subpass %u, but current subpass is %u",
+                    pipelineStateDbg.graphicsDesc.subpass, states_.subpass
+                );
+            }
         }
         else
         {
@@ -889,6 +1182,108 @@ void DbgCommandBuffer::SetStencilReference(std::uint32_t reference, const Stenci
     LLGL_DBG_COMMAND( "SetStencilReference", instance.SetStencilReference(reference, stencilFace) );
 }
 
+void DbgCommandBuffer::SetShadingRate(const ShadingRate rate)
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+        AssertRecording();
+        AssertVariableRateShadingSupported();
+    }
+
+    LLGL_DBG_COMMAND( "SetShadingRate", instance.SetShadingRate(rate) );
+}
+
+void DbgCommandBuffer::SetCullMode(const CullMode cullMode)
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+        AssertRecording();
+        AssertExtendedDynamicStateSupported();
+        if (auto pipelineStateDbg = AssertAndGetGraphicsPSO())
+            AssertDynamicStateEnabled(*pipelineStateDbg, DynamicStateFlags::CullMode, "CullMode");
+    }
+
+    LLGL_DBG_COMMAND( "SetCullMode", instance.SetCullMode(cullMode) );
+}
+
+void DbgCommandBuffer::SetDepthState(const DepthDescriptor& depthDesc)
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+        AssertRecording();
+        AssertExtendedDynamicStateSupported();
+        if (auto pipelineStateDbg = AssertAndGetGraphicsPSO())
+            AssertDynamicStateEnabled(*pipelineStateDbg, DynamicStateFlags::DepthState, "DepthState");
+    }
+
+    LLGL_DBG_COMMAND( "SetDepthState", instance.SetDepthState(depthDesc) );
+}
+
+void DbgCommandBuffer::SetStencilState(const StencilDescriptor& stencilDesc)
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+        AssertRecording();
+        AssertExtendedDynamicStateSupported();
+        if (auto pipelineStateDbg = AssertAndGetGraphicsPSO())
+            AssertDynamicStateEnabled(*pipelineStateDbg, DynamicStateFlags::StencilState, "StencilState");
+    }
+
+    LLGL_DBG_COMMAND( "SetStencilState", instance.SetStencilState(stencilDesc) );
+}
+
+// Returns the number of vertices per primitive or 0 for patches, since only topologies of the same primitive class can be interchanged dynamically.
+static std::uint32_t GetPrimitiveTopologyClass(const PrimitiveTopology topology)
+{
+    switch (topology)
+    {
+        case PrimitiveTopology::PointList:              return 1;
+        case PrimitiveTopology::LineList:               /*pass*/
+        case PrimitiveTopology::LineStrip:              /*pass*/
+        case PrimitiveTopology::LineListAdjacency:      /*pass*/
+        case PrimitiveTopology::LineStripAdjacency:     return 2;
+        case PrimitiveTopology::TriangleList:           /*pass*/
+        case PrimitiveTopology::TriangleStrip:          /*pass*/
+        case PrimitiveTopology::TriangleListAdjacency:  /*pass*/
+        case PrimitiveTopology::TriangleStripAdjacency: return 3;
+        default:                                        return 0;
+    }
+}
+
+void DbgCommandBuffer::SetPrimitiveTopology(const PrimitiveTopology topology)
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+        AssertRecording();
+        AssertExtendedDynamicStateSupported();
+        if (auto pipelineStateDbg = AssertAndGetGraphicsPSO())
+        {
+            AssertDynamicStateEnabled(*pipelineStateDbg, DynamicStateFlags::PrimitiveTopology, "PrimitiveTopology");
+
+            /* Patch topologies cannot be changed dynamically, since the number of control points is baked into the PSO */
+            const PrimitiveTopology psoTopology = pipelineStateDbg->graphicsDesc.primitiveTopology;
+            const bool isPatches = IsPrimitiveTopologyPatches(topology);
+            if (isPatches != IsPrimitiveTopologyPatches(psoTopology) ||
+                (isPatches && topology != psoTopology) ||
+                GetPrimitiveTopologyClass(topology) != GetPrimitiveTopologyClass(psoTopology))
+            {
+                LLGL_DBG_ERROR(
+                    ErrorType::InvalidArgument,
+                    "primitive topology is not of the same primitive class as 'LLGL::GraphicsPipelineDescriptor::primitiveTopology' of the bound graphics pipeline"
+                );
+            }
+        }
+        topology_ = topology;
+    }
+
+    LLGL_DBG_COMMAND( "SetPrimitiveTopology", instance.SetPrimitiveTopology(topology) );
+}
+
 void DbgCommandBuffer::SetUniforms(std::uint32_t first, const void* data, std::uint16_t dataSize)
 {
     if (debugger_)
@@ -918,7 +1313,9 @@ void DbgCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t query)
     {
         LLGL_DBG_SOURCE();
         AssertRecording();
-        if (auto state = GetAndValidateQueryState(queryHeapDbg, query))
+        if (queryHeapDbg.desc.type == QueryType::Timestamp)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot begin timestamp query; timestamps are only written by EndQuery");
+        else if (auto state = GetAndValidateQueryState(queryHeapDbg, query))
         {
             if (*state == DbgQueryHeap::State::Busy)
                 LLGL_DBG_ERROR(ErrorType::InvalidState, "query is already busy");
@@ -941,7 +1338,7 @@ void DbgCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query)
         AssertRecording();
         if (auto state = GetAndValidateQueryState(queryHeapDbg, query))
         {
-            if (*state != DbgQueryHeap::State::Busy)
+            if (*state != DbgQueryHeap::State::Busy && queryHeapDbg.desc.type != QueryType::Timestamp)
                 LLGL_DBG_ERROR(ErrorType::InvalidState, "query has not started");
             *state = DbgQueryHeap::State::Ready;
         }
@@ -966,6 +1363,22 @@ void DbgCommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t
     profile_.commandBufferRecord.renderConditionSections++;
 }
 
+void DbgCommandBuffer::BeginRenderCondition(Buffer& buffer, std::uint64_t offset, const RenderConditionMode mode)
+{
+    auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+        AssertRecording();
+        ValidateBufferRenderCondition(bufferDbg, offset);
+    }
+
+    instance.BeginRenderCondition(bufferDbg.instance, offset, mode);
+
+    profile_.commandBufferRecord.renderConditionSections++;
+}
+
 void DbgCommandBuffer::EndRenderCondition()
 {
     if (debugger_)
@@ -976,6 +1389,28 @@ void DbgCommandBuffer::EndRenderCondition()
     instance.EndRenderCondition();
 }
 
+void DbgCommandBuffer::ResolveQueries(
+    QueryHeap&      queryHeap,
+    std::uint32_t   firstQuery,
+    std::uint32_t   numQueries,
+    Buffer&         dstBuffer,
+    std::uint64_t   dstOffset)
+{
+    auto& queryHeapDbg = LLGL_CAST(DbgQueryHeap&, queryHeap);
+    auto& dstBufferDbg = LLGL_CAST(DbgBuffer&, dstBuffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+        AssertRecording();
+        ValidateResolveQueries(queryHeapDbg, firstQuery, numQueries, dstBufferDbg, dstOffset);
+    }
+
+    LLGL_DBG_COMMAND( "ResolveQueries", instance.ResolveQueries(queryHeapDbg.instance, firstQuery, numQueries, dstBufferDbg.instance, dstOffset) );
+
+    profile_.commandBufferRecord.bufferCopies++;
+}
+
 /* ----- Stream Output ------ */
 
 void DbgCommandBuffer::BeginStreamOutput(std::uint32_t numBuffers, Buffer* const * buffers)
@@ -1203,6 +1638,35 @@ void DbgCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::u
     profile_.commandBufferRecord.drawCommands += numCommands;
 }
 
+void DbgCommandBuffer::DrawIndirect(
+    Buffer&         buffer,
+    std::uint64_t   offset,
+    Buffer&         countBuffer,
+    std::uint64_t   countBufferOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    auto& bufferDbg         = LLGL_CAST(DbgBuffer&, buffer);
+    auto& countBufferDbg    = LLGL_CAST(DbgBuffer&, countBuffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+        AssertIndirectDrawCountSupported();
+        ValidateBindBufferFlags(bufferDbg, BindFlags::IndirectBuffer);
+        ValidateBindBufferFlags(countBufferDbg, BindFlags::IndirectBuffer);
+        ValidateBufferRange(bufferDbg, offset, stride*maxNumCommands);
+        ValidateBufferRange(countBufferDbg, countBufferOffset, sizeof(std::uint32_t));
+        ValidateAddressAlignment(offset, 4, "<offset> parameter");
+        ValidateAddressAlignment(countBufferOffset, 4, "<countBufferOffset> parameter");
+        ValidateAddressAlignment(stride, 4, "<stride> parameter");
+    }
+
+    LLGL_DBG_COMMAND( "DrawIndirect", instance.DrawIndirect(bufferDbg.instance, offset, countBufferDbg.instance, countBufferOffset, maxNumCommands, stride) );
+
+    profile_.commandBufferRecord.drawCommands += maxNumCommands;
+}
+
 void DbgCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
 {
     auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
@@ -1240,45 +1704,202 @@ void DbgCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset,
     profile_.commandBufferRecord.drawCommands += numCommands;
 }
 
+void DbgCommandBuffer::DrawIndexedIndirect(
+    Buffer&         buffer,
+    std::uint64_t   offset,
+    Buffer&         countBuffer,
+    std::uint64_t   countBufferOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    auto& bufferDbg         = LLGL_CAST(DbgBuffer&, buffer);
+    auto& countBufferDbg    = LLGL_CAST(DbgBuffer&, countBuffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+        AssertIndirectDrawCountSupported();
+        ValidateBindBufferFlags(bufferDbg, BindFlags::IndirectBuffer);
+        ValidateBindBufferFlags(countBufferDbg, BindFlags::IndirectBuffer);
+        ValidateBufferRange(bufferDbg, offset, stride*maxNumCommands);
+        ValidateBufferRange(countBufferDbg, countBufferOffset, sizeof(std::uint32_t));
+        ValidateAddressAlignment(offset, 4, "<offset> parameter");
+        ValidateAddressAlignment(countBufferOffset, 4, "<countBufferOffset> parameter");
+        ValidateAddressAlignment(stride, 4, "<stride> parameter");
+    }
+
+    LLGL_DBG_COMMAND( "DrawIndexedIndirect", instance.DrawIndexedIndirect(bufferDbg.instance, offset, countBufferDbg.instance, countBufferOffset, maxNumCommands, stride) );
+
+    profile_.commandBufferRecord.drawCommands += maxNumCommands;
+}
+
+void DbgCommandBuffer::DrawStreamOutput()
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+        AssertRecording();
+        AssertInsideRenderPass();
+        AssertVertexPipelineBound();
+        AssertVertexBufferBound();
+        AssertViewportBound();
+        ValidateDynamicStates();
+        ValidateVertexLayout();
+        ValidateBindingTable();
+
+        if (bindings_.numVertexBuffers > 0 && bindings_.vertexBuffers[0] != nullptr)
+        {
+            DbgBuffer* vertexBufferDbg = bindings_.vertexBuffers[0];
+            ValidateBindBufferFlags(*vertexBufferDbg, BindFlags::StreamOutputBuffer);
+
+            /* Validate vertex buffer is not written by the current stream-output section */
+            if (states_.streamOutputBusy && bindings_.numStreamOutputs > 0 && bindings_.streamOutputs[0] == vertexBufferDbg)
+                LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot draw stream-output from vertex buffer that is currently bound as stream-output buffer");
+        }
+    }
+
+    LLGL_DBG_COMMAND( "DrawStreamOutput", instance.DrawStreamOutput() );
+
+    profile_.commandBufferRecord.drawCommands++;
+}
+
+void DbgCommandBuffer::DrawMesh(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+
+        if (numWorkGroupsX * numWorkGroupsY * numWorkGroupsZ == 0)
+            LLGL_DBG_WARN(WarningType::PointlessOperation, "thread group size has volume of 0 units");
+
+        ValidateDrawMeshCmd();
+    }
+
+    LLGL_DBG_COMMAND( "DrawMesh", instance.DrawMesh(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ) );
+
+    profile_.commandBufferRecord.drawCommands++;
+}
+
+void DbgCommandBuffer::DrawMeshIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+        ValidateDrawMeshCmd();
+        ValidateBindBufferFlags(bufferDbg, BindFlags::IndirectBuffer);
+        if (numCommands > 0)
+            ValidateBufferRange(bufferDbg, offset, stride*(numCommands - 1) + sizeof(DrawMeshIndirectArguments));
+        ValidateAddressAlignment(offset, 4, "<offset> parameter");
+        ValidateAddressAlignment(stride, 4, "<stride> parameter");
+    }
+
+    LLGL_DBG_COMMAND( "DrawMeshIndirect", instance.DrawMeshIndirect(bufferDbg.instance, offset, numCommands, stride) );
+
+    profile_.commandBufferRecord.drawCommands += numCommands;
+}
+
 /* ----- Compute ----- */
 
-void DbgCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
+void DbgCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+
+        if (numWorkGroupsX * numWorkGroupsY * numWorkGroupsZ == 0)
+            LLGL_DBG_WARN(WarningType::PointlessOperation, "thread group size has volume of 0 units");
+
+        AssertComputePipelineBound();
+        ValidateThreadGroupLimit(numWorkGroupsX, limits_.maxComputeShaderWorkGroups[0]);
+        ValidateThreadGroupLimit(numWorkGroupsY, limits_.maxComputeShaderWorkGroups[1]);
+        ValidateThreadGroupLimit(numWorkGroupsZ, limits_.maxComputeShaderWorkGroups[2]);
+        ValidateBindingTable();
+    }
+
+    LLGL_DBG_COMMAND( "Dispatch", instance.Dispatch(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ) );
+
+    profile_.commandBufferRecord.dispatchCommands++;
+}
+
+void DbgCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+        ValidateBindBufferFlags(bufferDbg, BindFlags::IndirectBuffer);
+        ValidateBufferRange(bufferDbg, offset, sizeof(DispatchIndirectArguments));
+        ValidateAddressAlignment(offset, 4, "<offset> parameter");
+        ValidateBindingTable();
+    }
+
+    LLGL_DBG_COMMAND( "DispatchIndirect", instance.DispatchIndirect(bufferDbg.instance, offset) );
+
+    profile_.commandBufferRecord.dispatchCommands++;
+}
+
+/* ----- Ray Tracing ----- */
+
+void DbgCommandBuffer::BuildAccelerationStructure(const AccelerationStructureBuildDescriptor& buildDesc)
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+        ValidateAccelerationStructureCmd();
+        ValidateAccelerationStructureBuild(buildDesc);
+    }
+
+    std::vector<AccelerationStructureTriangles> trianglesInstances;
+    const AccelerationStructureBuildDescriptor buildDescInstance = DbgGetAccelerationStructureBuildInstance(buildDesc, trianglesInstances);
+
+    LLGL_DBG_COMMAND( "BuildAccelerationStructure", instance.BuildAccelerationStructure(buildDescInstance) );
+}
+
+void DbgCommandBuffer::CopyAccelerationStructure(Buffer& dst, Buffer& src, const AccelerationStructureCopyMode mode)
 {
+    auto& dstDbg = LLGL_CAST(DbgBuffer&, dst);
+    auto& srcDbg = LLGL_CAST(DbgBuffer&, src);
+
     if (debugger_)
     {
         LLGL_DBG_SOURCE();
-
-        if (numWorkGroupsX * numWorkGroupsY * numWorkGroupsZ == 0)
-            LLGL_DBG_WARN(WarningType::PointlessOperation, "thread group size has volume of 0 units");
-
-        AssertComputePipelineBound();
-        ValidateThreadGroupLimit(numWorkGroupsX, limits_.maxComputeShaderWorkGroups[0]);
-        ValidateThreadGroupLimit(numWorkGroupsY, limits_.maxComputeShaderWorkGroups[1]);
-        ValidateThreadGroupLimit(numWorkGroupsZ, limits_.maxComputeShaderWorkGroups[2]);
-        ValidateBindingTable();
+        ValidateAccelerationStructureCmd();
+        ValidateBindBufferFlags(dstDbg, BindFlags::AccelerationStructure);
+        ValidateBindBufferFlags(srcDbg, BindFlags::AccelerationStructure);
+        if (&dstDbg == &srcDbg)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot copy acceleration structure into the same buffer");
+        if (mode == AccelerationStructureCopyMode::Clone && dstDbg.desc.size < srcDbg.desc.size)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidArgument,
+                "destination buffer too small to clone acceleration structure: %" PRIu64 " specified but %" PRIu64 " required",
+                dstDbg.desc.size, srcDbg.desc.size
+            );
+        }
     }
 
-    LLGL_DBG_COMMAND( "Dispatch", instance.Dispatch(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ) );
-
-    profile_.commandBufferRecord.dispatchCommands++;
+    LLGL_DBG_COMMAND( "CopyAccelerationStructure", instance.CopyAccelerationStructure(dstDbg.instance, srcDbg.instance, mode) );
 }
 
-void DbgCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
+void DbgCommandBuffer::WriteAccelerationStructureCompactedSize(Buffer& src, Buffer& dstBuffer, std::uint64_t dstOffset)
 {
-    auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
+    auto& srcDbg        = LLGL_CAST(DbgBuffer&, src);
+    auto& dstBufferDbg  = LLGL_CAST(DbgBuffer&, dstBuffer);
 
     if (debugger_)
     {
         LLGL_DBG_SOURCE();
-        ValidateBindBufferFlags(bufferDbg, BindFlags::IndirectBuffer);
-        ValidateBufferRange(bufferDbg, offset, sizeof(DispatchIndirectArguments));
-        ValidateAddressAlignment(offset, 4, "<offset> parameter");
-        ValidateBindingTable();
+        ValidateAccelerationStructureCmd();
+        ValidateBindBufferFlags(srcDbg, BindFlags::AccelerationStructure);
+        ValidateBindBufferFlags(dstBufferDbg, BindFlags::Storage);
+        ValidateBufferRange(dstBufferDbg, dstOffset, sizeof(std::uint64_t), "destination range");
+        ValidateAddressAlignment(dstOffset, sizeof(std::uint64_t), "<dstOffset> parameter");
     }
 
-    LLGL_DBG_COMMAND( "DispatchIndirect", instance.DispatchIndirect(bufferDbg.instance, offset) );
-
-    profile_.commandBufferRecord.dispatchCommands++;
+    LLGL_DBG_COMMAND( "WriteAccelerationStructureCompactedSize", instance.WriteAccelerationStructureCompactedSize(srcDbg.instance, dstBufferDbg.instance, dstOffset) );
 }
 
 /* ----- Debugging ----- */
@@ -1297,6 +1918,11 @@ void DbgCommandBuffer::PushDebugGroup(const char* name)
 
     debugGroups_.push(name);
     instance.PushDebugGroup(name);
+
+    if (perfProfilerEnabled_)
+        queryTimerPool_.PushGroup(name);
+    if (passProfilerEnabled_)
+        queryTimerPool_.BeginPass(name);
 }
 
 void DbgCommandBuffer::PopDebugGroup()
@@ -1304,6 +1930,11 @@ void DbgCommandBuffer::PopDebugGroup()
     instance.PopDebugGroup();
     debugGroups_.pop();
 
+    if (perfProfilerEnabled_)
+        queryTimerPool_.PopGroup();
+    if (passProfilerEnabled_)
+        queryTimerPool_.EndPass();
+
     if (debugger_)
     {
         if (debugGroups_.empty())
@@ -1327,8 +1958,20 @@ bool DbgCommandBuffer::GetNativeHandle(void* nativeHandle, std::size_t nativeHan
 
 /* ----- Internal ----- */
 
-void DbgCommandBuffer::FlushProfile(FrameProfile& outProfile)
+void DbgCommandBuffer::FlushProfile(FrameProfile& outProfile, std::uint32_t submissionIndex)
 {
+    /* Resolve timer query results for performance profiler once the command buffer has been submitted */
+    if (perfProfilerEnabled_)
+    {
+        queryTimerPool_.TakeRecords(profile_.timeRecords);
+        for (ProfileTimeRecord& record : profile_.timeRecords)
+            record.commandBuffer = submissionIndex;
+    }
+
+    /* Hand over pass queries to be resolved in a later frame */
+    if (passProfilerEnabled_)
+        queryTimerPool_.SubmitPassRecords(submissionIndex);
+
     outProfile = std::move(profile_);
     profile_ = {};
 }
@@ -1508,6 +2151,10 @@ void DbgCommandBuffer::ValidateVertexLayoutAttributes(const ArrayView<VertexAttr
 
     for (std::uint32_t bufferIndex = 0; attribIndex < shaderVertexAttribs.size() && bufferIndex < numVertexBuffers; ++bufferIndex)
     {
+        /* Stop at the first unbound slot; remaining shader attributes are reported below */
+        if (vertexBuffers[bufferIndex] == nullptr)
+            break;
+
         /* Compare remaining shader attributes with next vertex buffer attributes */
         const auto& bufferVertexAttribs = vertexBuffers[bufferIndex]->desc.vertexAttribs;
 
@@ -1637,7 +2284,7 @@ void DbgCommandBuffer::ValidateDrawCmd(
 {
     AssertRecording();
     AssertInsideRenderPass();
-    AssertGraphicsPipelineBound();
+    AssertVertexPipelineBound();
     AssertVertexBufferBound();
     AssertViewportBound();
     ValidateDynamicStates();
@@ -1648,7 +2295,7 @@ void DbgCommandBuffer::ValidateDrawCmd(
     ValidateInstanceID(firstInstance);
     ValidateBindingTable();
 
-    if (bindings_.numVertexBuffers > 0 && bindings_.anyShaderAttributes)
+    if (bindings_.numVertexBuffers > 0 && bindings_.vertexBuffers[0] != nullptr && bindings_.anyShaderAttributes)
         ValidateVertexLimit(numVertices + firstVertex, static_cast<std::uint32_t>(bindings_.vertexBuffers[0]->elements));
 }
 
@@ -1657,7 +2304,7 @@ void DbgCommandBuffer::ValidateDrawIndexedCmd(
 {
     AssertRecording();
     AssertInsideRenderPass();
-    AssertGraphicsPipelineBound();
+    AssertVertexPipelineBound();
     AssertVertexBufferBound();
     AssertIndexBufferBound();
     AssertViewportBound();
@@ -1687,6 +2334,105 @@ void DbgCommandBuffer::ValidateDrawIndexedCmd(
     }
 }
 
+void DbgCommandBuffer::ValidateDrawMeshCmd()
+{
+    AssertRecording();
+    AssertInsideRenderPass();
+    AssertMeshShadersSupported();
+    AssertMeshPipelineBound();
+    AssertViewportBound();
+    ValidateDynamicStates();
+    ValidateBindingTable();
+}
+
+void DbgCommandBuffer::ValidateAccelerationStructureCmd()
+{
+    AssertRecording();
+    AssertRayTracingSupported();
+    if (states_.insideRenderPass)
+        LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot build or copy acceleration structures inside a render pass");
+}
+
+void DbgCommandBuffer::ValidateAccelerationStructureBuild(const AccelerationStructureBuildDescriptor& buildDesc)
+{
+    constexpr long fastTraceAndBuildFlags = (AccelerationStructureFlags::PreferFastTrace | AccelerationStructureFlags::PreferFastBuild);
+    if ((buildDesc.flags & fastTraceAndBuildFlags) == fastTraceAndBuildFlags)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot build acceleration structure with both LLGL::AccelerationStructureFlags::PreferFastTrace and PreferFastBuild");
+    if (buildDesc.src != nullptr && (buildDesc.flags & AccelerationStructureFlags::AllowUpdate) == 0)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot update acceleration structure without LLGL::AccelerationStructureFlags::AllowUpdate");
+
+    /* Validate destination, source, and scratch buffers */
+    if (auto* dstDbg = DbgGetWrapper<DbgBuffer>(buildDesc.dst))
+        ValidateBindBufferFlags(*dstDbg, BindFlags::AccelerationStructure);
+    else
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot build acceleration structure without destination buffer");
+
+    if (auto* srcDbg = DbgGetWrapper<DbgBuffer>(buildDesc.src))
+        ValidateBindBufferFlags(*srcDbg, BindFlags::AccelerationStructure);
+
+    if (auto* scratchBufferDbg = DbgGetWrapper<DbgBuffer>(buildDesc.scratchBuffer))
+    {
+        ValidateBindBufferFlags(*scratchBufferDbg, BindFlags::Storage);
+        ValidateAddressAlignment(buildDesc.scratchOffset, 256, "scratch buffer offset");
+    }
+    else
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot build acceleration structure without scratch buffer");
+
+    if (buildDesc.type == AccelerationStructureType::BottomLevel)
+    {
+        /* Validate triangle geometry of bottom-level acceleration structure */
+        if (buildDesc.triangles.empty())
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot build bottom-level acceleration structure without triangle geometry");
+
+        for (const AccelerationStructureTriangles& triangles : buildDesc.triangles)
+        {
+            if (auto* vertexBufferDbg = DbgGetWrapper<DbgBuffer>(triangles.vertexBuffer))
+            {
+                if ((vertexBufferDbg->desc.bindFlags & (BindFlags::VertexBuffer | BindFlags::Storage)) == 0)
+                    LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot build acceleration structure from vertex buffer without LLGL::BindFlags::VertexBuffer or LLGL::BindFlags::Storage");
+                if (triangles.numVertices > 0)
+                    ValidateBufferRange(*vertexBufferDbg, triangles.vertexOffset, static_cast<std::uint64_t>(triangles.numVertices - 1) * triangles.vertexStride + GetFormatAttribs(triangles.vertexFormat).bitSize / 8, "vertex range");
+            }
+            else
+                LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot build acceleration structure from triangles without vertex buffer");
+
+            switch (triangles.vertexFormat)
+            {
+                case Format::RGB32Float:
+                case Format::RG32Float:
+                case Format::RGBA16Float:
+                case Format::RG16Float:
+                    break;
+                default:
+                    LLGL_DBG_ERROR(ErrorType::InvalidArgument, "invalid vertex format for acceleration structure: LLGL::Format::%s", ToString(triangles.vertexFormat));
+                    break;
+            }
+
+            if (auto* indexBufferDbg = DbgGetWrapper<DbgBuffer>(triangles.indexBuffer))
+            {
+                if ((indexBufferDbg->desc.bindFlags & (BindFlags::IndexBuffer | BindFlags::Storage)) == 0)
+                    LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot build acceleration structure from index buffer without LLGL::BindFlags::IndexBuffer or LLGL::BindFlags::Storage");
+                ValidateIndexType(triangles.indexFormat);
+                if (triangles.numIndices % 3 != 0)
+                    LLGL_DBG_WARN(WarningType::ImproperArgument, "number of indices for acceleration structure is not a multiple of 3: %u", triangles.numIndices);
+                ValidateBufferRange(*indexBufferDbg, triangles.indexOffset, static_cast<std::uint64_t>(triangles.numIndices) * GetFormatAttribs(triangles.indexFormat).bitSize / 8, "index range");
+            }
+        }
+    }
+    else
+    {
+        /* Validate instance buffer of top-level acceleration structure */
+        if (auto* instanceBufferDbg = DbgGetWrapper<DbgBuffer>(buildDesc.instanceBuffer))
+        {
+            ValidateBindBufferFlags(*instanceBufferDbg, BindFlags::Storage);
+            ValidateAddressAlignment(buildDesc.instanceOffset, 16, "instance buffer offset");
+            ValidateBufferRange(*instanceBufferDbg, buildDesc.instanceOffset, static_cast<std::uint64_t>(buildDesc.numInstances) * sizeof(AccelerationStructureInstance), "instance range");
+        }
+        else
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot build top-level acceleration structure without instance buffer");
+    }
+}
+
 void DbgCommandBuffer::ValidateVertexLimit(std::uint32_t vertexCount, std::uint32_t vertexLimit)
 {
     if (vertexCount > vertexLimit)
@@ -1759,6 +2505,8 @@ static const char* BindFlagToString(long bindFlag)
         case BindFlags::CombinedSampler:        return "CombinedSampler";
         case BindFlags::CopySrc:                return "CopySrc";
         case BindFlags::CopyDst:                return "CopyDst";
+        case BindFlags::InputAttachment:        return "InputAttachment";
+        case BindFlags::AccelerationStructure:  return "AccelerationStructure";
         default:                                return nullptr;
     }
 }
@@ -1829,6 +2577,120 @@ void DbgCommandBuffer::ValidateBindFlags(long resourceFlags, long bindFlags, lon
     }
 }
 
+void DbgCommandBuffer::ValidateBarrierUsage(long resourceFlags, long usage, std::uint32_t barrierIndex, const char* resourceName)
+{
+    /* Copy commands are valid for all resources, so only binding usages must match the flags the resource was created with */
+    const long missingFlags = (usage & ~(resourceFlags | BindFlags::CopySrc | BindFlags::CopyDst));
+    if (missingFlags != 0)
+    {
+        const std::string missingFlagsLabel = BindFlagsToStringList(missingFlags);
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "resource barrier [%u] refers to %s that was not created with the following bind flags: %s",
+            barrierIndex, resourceName, missingFlagsLabel.c_str()
+        );
+    }
+}
+
+Resource* DbgCommandBuffer::GetAndValidateResourceBinding(std::uint32_t descriptor, Resource& resource)
+{
+    const BindingDescriptor* bindingDesc = nullptr;
+    Resource* resourceInstance = nullptr;
+
+    if (debugger_)
+    {
+        if (auto* pso = bindings_.pipelineState)
+        {
+            if (auto* psoLayout = pso->pipelineLayout)
+                bindingDesc = GetAndValidateResourceDescFromPipeline(*psoLayout, descriptor, resource);
+        }
+
+        if (descriptor < bindings_.bindingTable.resources.size())
+            bindings_.bindingTable.resources[descriptor] = &resource;
+    }
+
+    switch (resource.GetResourceType())
+    {
+        case ResourceType::Undefined:
+        break;
+
+        case ResourceType::Buffer:
+        {
+            /* Unwrap buffer resource */
+            auto& bufferDbg = LLGL_CAST(DbgBuffer&, resource);
+
+            if (bindingDesc != nullptr)
+            {
+                ValidateBindFlags(
+                    bufferDbg.desc.bindFlags,
+                    bindingDesc->bindFlags,
+                    (BindFlags::ConstantBuffer | BindFlags::Sampled | BindFlags::Storage),
+                    GetLabelOrDefault(bufferDbg.label, "LLGL::Buffer")
+                );
+            }
+
+            resourceInstance = &(bufferDbg.instance);
+
+            /* Record binding for profiling */
+            if (bindingDesc != nullptr)
+            {
+                if ((bindingDesc->bindFlags & BindFlags::ConstantBuffer) != 0)
+                    profile_.commandBufferRecord.constantBufferBindings++;
+                if ((bindingDesc->bindFlags & BindFlags::Sampled) != 0)
+                    profile_.commandBufferRecord.sampledBufferBindings++;
+                if ((bindingDesc->bindFlags & BindFlags::Storage) != 0)
+                    profile_.commandBufferRecord.storageBufferBindings++;
+            }
+        }
+        break;
+
+        case ResourceType::Texture:
+        {
+            /* Unwrap texture resource */
+            auto& textureDbg = LLGL_CAST(DbgTexture&, resource);
+
+            if (bindingDesc != nullptr)
+            {
+                ValidateBindFlags(
+                    textureDbg.desc.bindFlags,
+                    bindingDesc->bindFlags,
+                    (BindFlags::Sampled | BindFlags::Storage | BindFlags::CombinedSampler),
+                    GetLabelOrDefault(textureDbg.label, "LLGL::Buffer")
+                );
+            }
+
+            resourceInstance = &(textureDbg.instance);
+
+            /* Record binding for profiling */
+            if (bindingDesc != nullptr)
+            {
+                if ((bindingDesc->bindFlags & BindFlags::Sampled) != 0)
+                    profile_.commandBufferRecord.sampledTextureBindings++;
+                if ((bindingDesc->bindFlags & BindFlags::Storage) != 0)
+                    profile_.commandBufferRecord.storageTextureBindings++;
+            }
+        }
+        break;
+
+        case ResourceType::Sampler:
+        {
+            /* No bind flags allowed for samplers */
+            //TODO: use DbgSampler
+            if (bindingDesc != nullptr)
+                ValidateBindFlags(0, bindingDesc->bindFlags, 0, "LLGL::Sampler");
+
+            /* Sampler resources are not wrapped */
+            resourceInstance = &resource;
+
+            /* Record binding for profiling */
+            profile_.commandBufferRecord.samplerBindings++;
+        }
+        break;
+    }
+
+    return resourceInstance;
+}
+
 void DbgCommandBuffer::ValidateBindBufferFlags(DbgBuffer& bufferDbg, long bindFlags)
 {
     ValidateBindFlags(bufferDbg.desc.bindFlags, bindFlags, bindFlags, GetLabelOrDefault(bufferDbg.label, "LLGL::Buffer"));
@@ -1839,6 +2701,38 @@ void DbgCommandBuffer::ValidateBindTextureFlags(DbgTexture& textureDbg, long bin
     ValidateBindFlags(textureDbg.desc.bindFlags, bindFlags, bindFlags, GetLabelOrDefault(textureDbg.label, "LLGL::Texture"));
 }
 
+void DbgCommandBuffer::ValidateBlitTextureRegion(DbgTexture& textureDbg, const TextureRegion& region, bool isDestination)
+{
+    const char* label = GetLabelOrDefault(textureDbg.label, "LLGL::Texture");
+
+    switch (textureDbg.desc.type)
+    {
+        case TextureType::Texture2D:
+        case TextureType::Texture2DArray:
+        case TextureType::TextureCube:
+        case TextureType::TextureCubeArray:
+            break;
+        default:
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot blit texture %s of type %s", label, ToString(textureDbg.desc.type));
+            break;
+    }
+
+    const FormatAttributes& formatAttribs = GetFormatAttribs(textureDbg.desc.format);
+    if ((formatAttribs.flags & (FormatFlags::IsCompressed | FormatFlags::HasDepthStencil)) != 0)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot blit texture %s with compressed or depth-stencil format %s", label, ToString(textureDbg.desc.format));
+    else if ((formatAttribs.flags & FormatFlags::IsInteger) != 0 && (formatAttribs.flags & FormatFlags::IsNormalized) == 0)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot blit texture %s with unnormalized integer format %s", label, ToString(textureDbg.desc.format));
+    else if (isDestination && (formatAttribs.flags & FormatFlags::IsColorSpace_sRGB) != 0)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot blit into texture %s with sRGB format %s", label, ToString(textureDbg.desc.format));
+
+    ValidateTextureRegion(textureDbg, region);
+
+    if (region.subresource.numArrayLayers > 1)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot blit texture region with number of array layers greater than 1");
+    if (region.extent.depth != 1)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot blit texture region with a depth extent of %u", region.extent.depth);
+}
+
 void DbgCommandBuffer::ValidateTextureRegion(DbgTexture& textureDbg, const TextureRegion& region)
 {
     /* Validate MIP-map range */
@@ -2040,6 +2934,55 @@ DbgQueryHeap::State* DbgCommandBuffer::GetAndValidateQueryState(DbgQueryHeap& qu
         return nullptr;
 }
 
+void DbgCommandBuffer::ValidateResolveQueries(
+    DbgQueryHeap&   queryHeapDbg,
+    std::uint32_t   firstQuery,
+    std::uint32_t   numQueries,
+    DbgBuffer&      dstBufferDbg,
+    std::uint64_t   dstOffset)
+{
+    /* Validate query heap type */
+    if (queryHeapDbg.desc.renderCondition)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot resolve queries from query heap that was created as render condition");
+    switch (queryHeapDbg.desc.type)
+    {
+        case QueryType::SamplesPassed:
+        case QueryType::AnySamplesPassed:
+        case QueryType::AnySamplesPassedConservative:
+        case QueryType::PipelineStatistics:
+            break;
+        default:
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot resolve queries into a buffer unless they are occlusion queries or pipeline statistics");
+            break;
+    }
+
+    /* Validate query range */
+    const std::size_t numQueriesInHeap = queryHeapDbg.states.size();
+    if (static_cast<std::size_t>(firstQuery) + numQueries > numQueriesInHeap)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "query range out of bounds: [%u, %u) specified but upper bound is %zu",
+            firstQuery, firstQuery + numQueries, numQueriesInHeap
+        );
+    }
+    else
+    {
+        for_range(i, numQueries)
+        {
+            if (queryHeapDbg.states[firstQuery + i] == DbgQueryHeap::State::Busy)
+                LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot resolve query with index %u that has not ended", firstQuery + i);
+        }
+    }
+
+    /* Validate destination buffer */
+    ValidateAddressAlignment(dstOffset, sizeof(std::uint64_t), "destination offset");
+
+    const std::uint64_t stride = (queryHeapDbg.desc.type == QueryType::PipelineStatistics ? sizeof(QueryPipelineStatistics) : sizeof(std::uint64_t));
+    ValidateBufferRange(dstBufferDbg, dstOffset, stride * numQueries, "destination range");
+    ValidateBindBufferFlags(dstBufferDbg, BindFlags::CopyDst);
+}
+
 void DbgCommandBuffer::ValidateRenderCondition(DbgQueryHeap& queryHeapDbg, std::uint32_t query)
 {
     if (!features_.hasRenderCondition)
@@ -2048,6 +2991,15 @@ void DbgCommandBuffer::ValidateRenderCondition(DbgQueryHeap& queryHeapDbg, std::
         LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot use query heap for conditional rendering that was not created with 'renderCondition' enabled");
 }
 
+void DbgCommandBuffer::ValidateBufferRenderCondition(DbgBuffer& bufferDbg, std::uint64_t offset)
+{
+    if (!features_.hasBufferRenderCondition)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("conditional rendering with buffer predicates");
+    ValidateAddressAlignment(offset, sizeof(std::uint64_t), "predicate offset");
+    ValidateBufferRange(bufferDbg, offset, sizeof(std::uint64_t), "predicate range");
+    ValidateBindBufferFlags(bufferDbg, BindFlags::IndirectBuffer);
+}
+
 void DbgCommandBuffer::ValidateRenderTargetRange(DbgRenderTarget& renderTargetDbg, const Offset2D& offset, const Extent2D& extent)
 {
     /* Validate extent and offset */
@@ -2211,6 +3163,15 @@ void DbgCommandBuffer::ValidateDynamicStates()
             " or PSO must be created with 'LLGL::StencilDescriptor::referenceDynamic' being disabled"
         );
     }
+    if (bindings_.dynamicStatesUnset != 0)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidState,
+            "not all dynamic states are set (0x%08X); missing calls to <LLGL::CommandBuffer::SetCullMode>, <SetDepthState>, <SetStencilState>, or <SetPrimitiveTopology>"
+            " for the states specified in 'LLGL::GraphicsPipelineDescriptor::dynamicStates'",
+            static_cast<unsigned>(bindings_.dynamicStatesUnset)
+        );
+    }
     if (DbgPipelineState* piplineStateDbg = bindings_.pipelineState)
     {
         const GraphicsPipelineDescriptor& graphicsPSODesc = piplineStateDbg->graphicsDesc;
@@ -2300,6 +3261,24 @@ void DbgCommandBuffer::AssertGraphicsPipelineBound()
     (void)AssertAndGetGraphicsPSO();
 }
 
+void DbgCommandBuffer::AssertVertexPipelineBound()
+{
+    if (DbgPipelineState* pso = AssertAndGetGraphicsPSO())
+    {
+        if (pso->graphicsDesc.meshShader != nullptr)
+            LLGL_DBG_ERROR(ErrorType::InvalidState, "mesh pipeline is bound but graphics pipeline with vertex shader is required; use <LLGL::CommandBuffer::DrawMesh> instead");
+    }
+}
+
+void DbgCommandBuffer::AssertMeshPipelineBound()
+{
+    if (DbgPipelineState* pso = AssertAndGetGraphicsPSO())
+    {
+        if (pso->graphicsDesc.meshShader == nullptr)
+            LLGL_DBG_ERROR(ErrorType::InvalidState, "graphics pipeline without mesh shader is bound but mesh pipeline is required");
+    }
+}
+
 void DbgCommandBuffer::AssertComputePipelineBound()
 {
     (void)AssertAndGetComputePSO();
@@ -2313,13 +3292,18 @@ void DbgCommandBuffer::AssertVertexBufferBound()
         {
             /* Check if buffer is initialized (ignore empty buffers) */
             auto buffer = bindings_.vertexBuffers[i];
+            if (buffer == nullptr)
+            {
+                LLGL_DBG_ERROR(ErrorType::InvalidState, "no vertex buffer is bound at slot %u", i);
+                continue;
+            }
             if (buffer->elements > 0 && !buffer->initialized)
                 LLGL_DBG_ERROR(ErrorType::InvalidState, "uninitialized vertex buffer is bound at slot %u", i);
             if (buffer->IsMappedForCPUAccess())
                 LLGL_DBG_ERROR(ErrorType::InvalidState, "vertex buffer used for drawing while being mapped to CPU memory space");
         }
     }
-    else if (!IsInheritedCmdBuffer())
+    else if (!IsInheritedCmdBuffer() && bindings_.anyShaderAttributes)
         LLGL_DBG_ERROR(ErrorType::InvalidState, "no vertex buffer is bound");
 }
 
@@ -2360,6 +3344,44 @@ void DbgCommandBuffer::AssertIndirectDrawingSupported()
         LLGL_DBG_ERROR_NOT_SUPPORTED("indirect drawing");
 }
 
+void DbgCommandBuffer::AssertIndirectDrawCountSupported()
+{
+    if (!features_.hasIndirectDrawCount)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("indirect draw count");
+}
+
+void DbgCommandBuffer::AssertMeshShadersSupported()
+{
+    if (!features_.hasMeshShaders)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("mesh shaders");
+}
+
+void DbgCommandBuffer::AssertRayTracingSupported()
+{
+    if (!features_.hasRayTracing)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("ray tracing");
+}
+
+void DbgCommandBuffer::AssertVariableRateShadingSupported()
+{
+    if (!features_.hasVariableRateShading)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("variable rate shading");
+}
+
+void DbgCommandBuffer::AssertExtendedDynamicStateSupported()
+{
+    if (!features_.hasExtendedDynamicState)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("extended dynamic state");
+}
+
+void DbgCommandBuffer::AssertDynamicStateEnabled(DbgPipelineState& pipelineStateDbg, long dynamicState, const char* dynamicStateName)
+{
+    if ((pipelineStateDbg.graphicsDesc.dynamicStates & dynamicState) != 0)
+        bindings_.dynamicStatesUnset &= ~dynamicState;
+    else
+        LLGL_DBG_ERROR(ErrorType::InvalidState, "graphics pipeline was not created with 'LLGL::DynamicStateFlags::%s' enabled", dynamicStateName);
+}
+
 void DbgCommandBuffer::AssertNullPointer(const void* ptr, const char* name)
 {
     if (ptr == nullptr)
@@ -13,6 +13,7 @@
 #include <LLGL/RenderingDebugger.h>
 #include <LLGL/Constants.h>
 #include <LLGL/Container/ArrayView.h>
+#include <LLGL/Container/SmallVector.h>
 #include "RenderState/DbgQueryHeap.h"
 #include "DbgQueryTimerPool.h"
 #include <cstdint>
@@ -31,6 +32,7 @@ class DbgRenderTarget;
 class DbgPipelineState;
 class DbgPipelineLayout;
 class DbgShader;
+class DbgValidationSampler;
 
 class DbgCommandBuffer final : public CommandBuffer
 {
@@ -46,6 +48,8 @@ class DbgCommandBuffer final : public CommandBuffer
             CommandQueue&                   commandQueueInstance,
             CommandBuffer&                  commandBufferInstance,
             FrameProfile&                   commonProfile,
+            DbgPassQueryResolver&           passQueryResolver,
+            DbgValidationSampler&           validationSampler,
             RenderingDebugger*              debugger,
             const CommandBufferDescriptor&  desc,
             const RenderingCapabilities&    caps
@@ -53,7 +57,8 @@ class DbgCommandBuffer final : public CommandBuffer
 
     public:
 
-        void FlushProfile(FrameProfile& outProfile);
+        // Moves the recorded profile into the output and assigns the specified submission index to all time records.
+        void FlushProfile(FrameProfile& outProfile, std::uint32_t submissionIndex);
 
         void ValidateSubmit();
 
@@ -80,6 +85,9 @@ class DbgCommandBuffer final : public CommandBuffer
 
         void ValidateDrawCmd(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances, std::uint32_t firstInstance);
         void ValidateDrawIndexedCmd(std::uint32_t numVertices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance);
+        void ValidateDrawMeshCmd();
+        void ValidateAccelerationStructureCmd();
+        void ValidateAccelerationStructureBuild(const AccelerationStructureBuildDescriptor& buildDesc);
 
         void ValidateVertexLimit(std::uint32_t vertexCount, std::uint32_t vertexLimit);
         void ValidateThreadGroupLimit(std::uint32_t size, std::uint32_t limit);
@@ -89,7 +97,9 @@ class DbgCommandBuffer final : public CommandBuffer
         void ValidateBindFlags(long resourceFlags, long bindFlags, long validFlags, const char* resourceName = nullptr);
         void ValidateBindBufferFlags(DbgBuffer& bufferDbg, long bindFlags);
         void ValidateBindTextureFlags(DbgTexture& textureDbg, long bindFlags);
+        void ValidateBarrierUsage(long resourceFlags, long usage, std::uint32_t barrierIndex, const char* resourceName);
         void ValidateTextureRegion(DbgTexture& textureDbg, const TextureRegion& region);
+        void ValidateBlitTextureRegion(DbgTexture& textureDbg, const TextureRegion& region, bool isDestination);
         void ValidateIndexType(const Format format);
         void ValidateTextureBufferCopyStrides(DbgTexture& textureDbg, std::uint32_t rowStride, std::uint32_t layerStride, const Extent3D& extent);
 
@@ -99,7 +109,15 @@ class DbgCommandBuffer final : public CommandBuffer
 
         bool ValidateQueryIndex(DbgQueryHeap& queryHeapDbg, std::uint32_t query);
         DbgQueryHeap::State* GetAndValidateQueryState(DbgQueryHeap& queryHeapDbg, std::uint32_t query);
+        void ValidateResolveQueries(
+            DbgQueryHeap&   queryHeapDbg,
+            std::uint32_t   firstQuery,
+            std::uint32_t   numQueries,
+            DbgBuffer&      dstBufferDbg,
+            std::uint64_t   dstOffset
+        );
         void ValidateRenderCondition(DbgQueryHeap& queryHeapDbg, std::uint32_t query);
+        void ValidateBufferRenderCondition(DbgBuffer& bufferDbg, std::uint64_t offset);
 
         void ValidateRenderTargetRange(DbgRenderTarget& renderTargetDbg, const Offset2D& offset, const Extent2D& extent);
 
@@ -107,6 +125,8 @@ class DbgCommandBuffer final : public CommandBuffer
 
         void ValidateStreamOutputs(std::uint32_t numBuffers);
 
+        // Validates the binding of the specified resource, records it for profiling, and returns the wrapped instance or null if the resource type is undefined.
+        Resource* GetAndValidateResourceBinding(std::uint32_t descriptor, Resource& resource);
         const BindingDescriptor* GetAndValidateResourceDescFromPipeline(const DbgPipelineLayout& pipelineLayoutDbg, std::uint32_t descriptor, Resource& resource);
 
         void ValidateUniforms(const DbgPipelineLayout& pipelineLayoutDbg, std::uint32_t first, std::uint16_t dataSize);
@@ -120,6 +140,8 @@ class DbgCommandBuffer final : public CommandBuffer
         void AssertRecording();
         void AssertInsideRenderPass();
         void AssertGraphicsPipelineBound();
+        void AssertVertexPipelineBound();
+        void AssertMeshPipelineBound();
         void AssertComputePipelineBound();
         void AssertVertexBufferBound();
         void AssertIndexBufferBound();
@@ -128,6 +150,12 @@ class DbgCommandBuffer final : public CommandBuffer
         void AssertInstancingSupported();
         void AssertOffsetInstancingSupported();
         void AssertIndirectDrawingSupported();
+        void AssertIndirectDrawCountSupported();
+        void AssertMeshShadersSupported();
+        void AssertRayTracingSupported();
+        void AssertVariableRateShadingSupported();
+        void AssertExtendedDynamicStateSupported();
+        void AssertDynamicStateEnabled(DbgPipelineState& pipelineStateDbg, long dynamicState, const char* dynamicStateName);
 
         void AssertNullPointer(const void* ptr, const char* name);
 
@@ -157,7 +185,9 @@ class DbgCommandBuffer final : public CommandBuffer
 
         /* ----- Common objects ----- */
 
-        RenderingDebugger*          debugger_                               = nullptr;
+        RenderingDebugger*          debugger_                               = nullptr; // Active debugger of the current encoding; null if it was not sampled for validation.
+        RenderingDebugger*          debuggerInstance_                       = nullptr;
+        DbgValidationSampler&       validationSampler_;
         FrameProfile&               commonProfile_;
 
         const RenderingFeatures&    features_;
@@ -167,6 +197,7 @@ class DbgCommandBuffer final : public CommandBuffer
 
         DbgQueryTimerPool           queryTimerPool_;
         bool                        perfProfilerEnabled_                    = false;
+        bool                        passProfilerEnabled_                    = false;
 
         /* ----- Render states ----- */
 
@@ -182,7 +213,7 @@ class DbgCommandBuffer final : public CommandBuffer
             std::uint32_t           numViewports                            = 0;
 
             // Stream inputs/outputs
-            DbgBuffer*              vertexBufferStore[1]                    = {};
+            SmallVector<DbgBuffer*> vertexBufferStore;
             DbgBuffer* const *      vertexBuffers                           = nullptr;
             std::uint32_t           numVertexBuffers                        = 0;
             bool                    anyShaderAttributes                     = false;
@@ -197,6 +228,7 @@ class DbgCommandBuffer final : public CommandBuffer
             const DbgShader*        vertexShader                            = nullptr;
             bool                    blendFactorSet                          = false;
             bool                    stencilRefSet                           = false;
+            long                    dynamicStatesUnset                      = 0; // Bitmask of DynamicStateFlags that have not been set yet.
             Scissor                 scissorRects[LLGL_MAX_NUM_VIEWPORTS_AND_SCISSORS];
             std::uint32_t           numScissorRects                         = 0;
 
@@ -215,6 +247,8 @@ class DbgCommandBuffer final : public CommandBuffer
             bool                    recording                               = false;
             bool                    insideRenderPass                        = false;
             bool                    streamOutputBusy                        = false;
+            std::uint32_t           subpass                                 = 0;
+            std::uint32_t           numSubpasses                            = 1;
         }
         states_;
 
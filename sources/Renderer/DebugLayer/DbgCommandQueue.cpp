@@ -7,10 +7,13 @@
 
 #include "DbgCommandQueue.h"
 #include "DbgCommandBuffer.h"
+#include "DbgSwapChain.h"
 #include "DbgCore.h"
 #include "../CheckedCast.h"
 #include <LLGL/RenderingDebugger.h>
+#include <LLGL/Fence.h>
 #include <LLGL/Utils/ForRange.h>
+#include <LLGL/Container/SmallVector.h>
 
 
 namespace LLGL
@@ -38,12 +41,90 @@ void DbgCommandQueue::Submit(CommandBuffer& commandBuffer)
 
     instance.Submit(commandBufferDbg.instance);
 
-    /* Merge frame profile values into rendering profiler */
-    FrameProfile profile;
-    commandBufferDbg.FlushProfile(profile);
+    MergeCommandBufferProfile(commandBufferDbg);
+}
 
-    RenderingDebugger::MergeProfiles(profile_, profile);
-    profile_.commandQueueRecord.commandBufferSubmittions++;
+void DbgCommandQueue::Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers)
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+        if (numCommandBuffers > 0 && commandBuffers == nullptr)
+        {
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "array of command buffers must not be null");
+            return;
+        }
+    }
+
+    /* Validate all command buffers and forward their instances at once */
+    SmallVector<CommandBuffer*, 8> commandBufferInstances;
+    commandBufferInstances.reserve(numCommandBuffers);
+
+    for_range(i, numCommandBuffers)
+    {
+        if (commandBuffers[i] != nullptr)
+        {
+            auto* commandBufferDbg = LLGL_CAST(DbgCommandBuffer*, commandBuffers[i]);
+            if (debugger_)
+            {
+                LLGL_DBG_SOURCE();
+                commandBufferDbg->ValidateSubmit();
+            }
+            commandBufferInstances.push_back(&(commandBufferDbg->instance));
+        }
+    }
+
+    instance.Submit(static_cast<std::uint32_t>(commandBufferInstances.size()), commandBufferInstances.data());
+
+    for_range(i, numCommandBuffers)
+    {
+        if (commandBuffers[i] != nullptr)
+            MergeCommandBufferProfile(LLGL_CAST(DbgCommandBuffer&, *commandBuffers[i]));
+    }
+}
+
+/* ----- Presentation ----- */
+
+void DbgCommandQueue::Present(std::uint32_t numSwapChains, SwapChain* const * swapChains)
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+        if (numSwapChains > 0 && swapChains == nullptr)
+        {
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "array of swap-chains must not be null");
+            return;
+        }
+        for_range(i, numSwapChains)
+        {
+            for_subrange(j, i + 1, numSwapChains)
+            {
+                if (swapChains[i] != nullptr && swapChains[i] == swapChains[j])
+                {
+                    LLGL_DBG_ERROR(ErrorType::InvalidArgument, "swap-chain [%u] must not be presented more than once in the same call", i);
+                    return;
+                }
+            }
+        }
+    }
+
+    /* Forward swap-chain instances at once, so the backend can present them in a single operation */
+    SmallVector<SwapChain*, 4> swapChainInstances;
+    swapChainInstances.reserve(numSwapChains);
+
+    for_range(i, numSwapChains)
+    {
+        if (swapChains[i] != nullptr)
+            swapChainInstances.push_back(&(LLGL_CAST(DbgSwapChain*, swapChains[i])->instance));
+    }
+
+    instance.Present(static_cast<std::uint32_t>(swapChainInstances.size()), swapChainInstances.data());
+
+    for_range(i, numSwapChains)
+    {
+        if (swapChains[i] != nullptr)
+            LLGL_CAST(DbgSwapChain*, swapChains[i])->NotifyPresented();
+    }
 }
 
 /* ----- Queries ----- */
@@ -61,6 +142,11 @@ bool DbgCommandQueue::QueryResult(QueryHeap& queryHeap, std::uint32_t firstQuery
     return instance.QueryResult(queryHeapDbg.instance, firstQuery, numQueries, data, dataSize);
 }
 
+bool DbgCommandQueue::QueryTimestampCalibration(TimestampCalibration& outCalibration)
+{
+    return instance.QueryTimestampCalibration(outCalibration);
+}
+
 /* ----- Fences ----- */
 
 void DbgCommandQueue::Submit(Fence& fence)
@@ -69,11 +155,38 @@ void DbgCommandQueue::Submit(Fence& fence)
     profile_.commandQueueRecord.fenceSubmissions++;
 }
 
+void DbgCommandQueue::SubmitWait(Fence& fence)
+{
+    instance.SubmitWait(fence);
+}
+
 bool DbgCommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
 {
     return instance.WaitFence(fence, timeout);
 }
 
+void DbgCommandQueue::Submit(Fence& fence, std::uint64_t value)
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+        ValidateFenceValue(fence, value);
+    }
+
+    instance.Submit(fence, value);
+    profile_.commandQueueRecord.fenceSubmissions++;
+}
+
+void DbgCommandQueue::SubmitWait(Fence& fence, std::uint64_t value)
+{
+    instance.SubmitWait(fence, value);
+}
+
+bool DbgCommandQueue::WaitFence(Fence& fence, std::uint64_t value, std::uint64_t timeout)
+{
+    return instance.WaitFence(fence, value, timeout);
+}
+
 void DbgCommandQueue::WaitIdle()
 {
     instance.WaitIdle();
@@ -84,6 +197,30 @@ void DbgCommandQueue::WaitIdle()
  * ======= Private: =======
  */
 
+void DbgCommandQueue::MergeCommandBufferProfile(DbgCommandBuffer& commandBufferDbg)
+{
+    /* Merge frame profile values into rendering profiler */
+    FrameProfile profile;
+    commandBufferDbg.FlushProfile(profile, profile_.commandQueueRecord.commandBufferSubmittions);
+
+    RenderingDebugger::MergeProfiles(profile_, profile);
+    profile_.commandQueueRecord.commandBufferSubmittions++;
+}
+
+void DbgCommandQueue::ValidateFenceValue(Fence& fence, std::uint64_t value)
+{
+    /* Only the completed value can be validated, since submitted values are not tracked per fence */
+    const std::uint64_t completedValue = fence.GetCompletedValue();
+    if (value <= completedValue)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "fence value %" PRIu64 " must be greater than the completed value %" PRIu64,
+            value, completedValue
+        );
+    }
+}
+
 void DbgCommandQueue::ValidateQueryResult(
     DbgQueryHeap&   queryHeap,
     std::uint32_t   firstQuery,
@@ -106,6 +243,8 @@ void DbgCommandQueue::ValidateQueryResult(
     {
         LLGL_DBG_ERROR(ErrorType::InvalidArgument, "mismatch between required size for query result and <dataSize> parameter");
     }
+    else if (queryHeap.desc.type == QueryType::Timestamp && dataSize == numQueries * sizeof(std::uint32_t))
+        LLGL_DBG_WARN(WarningType::ImproperArgument, "retrieving timestamp query results as 32-bit values truncates them");
 
     if (firstQuery + numQueries <= queryHeap.states.size())
     {
@@ -18,6 +18,7 @@ namespace LLGL
 
 
 class DbgQueryHeap;
+class DbgCommandBuffer;
 
 class DbgCommandQueue final : public CommandQueue
 {
@@ -30,12 +31,21 @@ class DbgCommandQueue final : public CommandQueue
 
         DbgCommandQueue(CommandQueue& instance, FrameProfile& profile, RenderingDebugger* debugger);
 
+        void Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers) override;
+
+        void Present(std::uint32_t numSwapChains, SwapChain* const * swapChains) override;
+
     public:
 
         CommandQueue& instance;
 
     private:
 
+        // Merges the frame profile values of the specified command buffer into the rendering profiler.
+        void MergeCommandBufferProfile(DbgCommandBuffer& commandBufferDbg);
+
+        void ValidateFenceValue(Fence& fence, std::uint64_t value);
+
         void ValidateQueryResult(
             DbgQueryHeap&   queryHeap,
             std::uint32_t   firstQuery,
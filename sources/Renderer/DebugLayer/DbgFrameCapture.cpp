@@ -0,0 +1,1286 @@
+/*
+ * DbgFrameCapture.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "DbgFrameCapture.h"
+#include <LLGL/RenderSystem.h>
+#include <LLGL/RenderingDebugger.h>
+#include <LLGL/SwapChain.h>
+#include <LLGL/CommandQueue.h>
+#include <LLGL/Log.h>
+#include <LLGL/Utils/ForRange.h>
+#include "../../Core/StringUtils.h"
+#include <algorithm>
+#include <fstream>
+
+
+namespace LLGL
+{
+
+
+/*
+ * Descriptor serialization
+ */
+
+// Returns the 64-bit FNV-1a hash of the specified serialized record.
+static std::uint64_t HashRecord(const FrameCaptureRecordType type, const std::vector<char>& desc)
+{
+    std::uint64_t hash = 0xCBF29CE484222325ull ^ static_cast<std::uint64_t>(type);
+    for (char c : desc)
+    {
+        hash ^= static_cast<std::uint8_t>(c);
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+// Returns true if the specified record type is part of the pipeline manifest.
+static bool IsPipelineManifestRecord(const FrameCaptureRecordType type)
+{
+    switch (type)
+    {
+        case FrameCaptureRecordSwapChain:
+        case FrameCaptureRecordShader:
+        case FrameCaptureRecordPipelineLayout:
+        case FrameCaptureRecordGraphicsPipeline:
+        case FrameCaptureRecordComputePipeline:
+        case FrameCaptureRecordRenderPass:
+            return true;
+        default:
+            return false;
+    }
+}
+
+static bool IsPipelineRecord(const FrameCaptureRecordType type)
+{
+    return (type == FrameCaptureRecordGraphicsPipeline || type == FrameCaptureRecordComputePipeline);
+}
+
+static void WriteVertexAttributes(FrameCaptureWriter& writer, const ArrayView<VertexAttribute>& attribs)
+{
+    writer.Write(static_cast<std::uint32_t>(attribs.size()));
+    for (const VertexAttribute& attrib : attribs)
+    {
+        writer.WriteString(attrib.name.c_str());
+        writer.Write(attrib.format);
+        writer.Write(attrib.location);
+        writer.Write(attrib.semanticIndex);
+        writer.Write(attrib.systemValue);
+        writer.Write(attrib.slot);
+        writer.Write(attrib.offset);
+        writer.Write(attrib.stride);
+        writer.Write(attrib.instanceDivisor);
+    }
+}
+
+static void WriteSamplerDesc(FrameCaptureWriter& writer, const SamplerDescriptor& samplerDesc)
+{
+    writer.WriteString(samplerDesc.debugName);
+    writer.Write(samplerDesc.addressModeU);
+    writer.Write(samplerDesc.addressModeV);
+    writer.Write(samplerDesc.addressModeW);
+    writer.Write(samplerDesc.minFilter);
+    writer.Write(samplerDesc.magFilter);
+    writer.Write(samplerDesc.mipMapFilter);
+    writer.Write(samplerDesc.mipMapEnabled);
+    writer.Write(samplerDesc.mipMapLODBias);
+    writer.Write(samplerDesc.minLOD);
+    writer.Write(samplerDesc.maxLOD);
+    writer.Write(samplerDesc.maxAnisotropy);
+    writer.Write(samplerDesc.compareEnabled);
+    writer.Write(samplerDesc.compareOp);
+    writer.WriteData(samplerDesc.borderColor, sizeof(samplerDesc.borderColor));
+}
+
+static void WriteBindingSlot(FrameCaptureWriter& writer, const BindingSlot& slot)
+{
+    writer.Write(slot.index);
+    writer.Write(slot.set);
+}
+
+static void WriteBindingDescs(FrameCaptureWriter& writer, const std::vector<BindingDescriptor>& bindingDescs)
+{
+    writer.Write(static_cast<std::uint32_t>(bindingDescs.size()));
+    for (const BindingDescriptor& bindingDesc : bindingDescs)
+    {
+        writer.WriteString(bindingDesc.name);
+        writer.Write(bindingDesc.type);
+        writer.WriteFlags(bindingDesc.bindFlags);
+        writer.WriteFlags(bindingDesc.stageFlags);
+        WriteBindingSlot(writer, bindingDesc.slot);
+        writer.Write(bindingDesc.arraySize);
+    }
+}
+
+template <typename T>
+void WriteRawArray(FrameCaptureWriter& writer, const std::vector<T>& values)
+{
+    writer.Write(static_cast<std::uint32_t>(values.size()));
+    writer.WriteData(values.data(), values.size() * sizeof(T));
+}
+
+// Returns the source of the specified shader descriptor as code string or binary buffer, i.e. shader files are loaded into memory.
+static std::vector<char> ReadShaderSource(const ShaderDescriptor& shaderDesc, ShaderSourceType& outSourceType)
+{
+    std::vector<char> source;
+    if (shaderDesc.source == nullptr)
+        return source;
+
+    switch (shaderDesc.sourceType)
+    {
+        case ShaderSourceType::CodeString:
+        {
+            const std::size_t len = (shaderDesc.sourceSize > 0 ? shaderDesc.sourceSize : std::strlen(shaderDesc.source));
+            source.assign(shaderDesc.source, shaderDesc.source + len);
+            outSourceType = ShaderSourceType::CodeString;
+        }
+        break;
+
+        case ShaderSourceType::CodeFile:
+        {
+            const std::string code = ReadFileString(shaderDesc.source);
+            source.assign(code.begin(), code.end());
+            outSourceType = ShaderSourceType::CodeString;
+        }
+        break;
+
+        case ShaderSourceType::BinaryBuffer:
+        {
+            source.assign(shaderDesc.source, shaderDesc.source + shaderDesc.sourceSize);
+            outSourceType = ShaderSourceType::BinaryBuffer;
+        }
+        break;
+
+        case ShaderSourceType::BinaryFile:
+        {
+            source = ReadFileBuffer(shaderDesc.source);
+            outSourceType = ShaderSourceType::BinaryBuffer;
+        }
+        break;
+    }
+
+    return source;
+}
+
+
+/*
+ * DbgFrameCaptureEncoder class
+ */
+
+DbgFrameCaptureEncoder::DbgFrameCaptureEncoder(DbgFrameCapture& capture) :
+    capture_ { capture }
+{
+}
+
+bool DbgFrameCaptureEncoder::Begin()
+{
+    buffer_.Clear();
+    numCommands_ = 0;
+    isEncoding_ = capture_.IsCapturing();
+    if (isEncoding_)
+        AllocOpcode(FrameCaptureOpcodeBegin);
+    return isEncoding_;
+}
+
+void DbgFrameCaptureEncoder::End()
+{
+    AllocOpcode(FrameCaptureOpcodeEnd);
+}
+
+void DbgFrameCaptureEncoder::UpdateBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint64_t dataSize)
+{
+    auto cmd = AllocCommand<FrameCaptureCmdUpdateBuffer>(FrameCaptureOpcodeUpdateBuffer, static_cast<std::size_t>(dataSize));
+    {
+        cmd->dstBuffer  = capture_.GetID(&dstBuffer);
+        cmd->dstOffset  = dstOffset;
+        cmd->dataSize   = dataSize;
+        std::memcpy(cmd + 1, data, static_cast<std::size_t>(dataSize));
+    }
+}
+
+void DbgFrameCaptureEncoder::CopyBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, Buffer& srcBuffer, std::uint64_t srcOffset, std::uint64_t size)
+{
+    auto cmd = AllocCommand<FrameCaptureCmdCopyBuffer>(FrameCaptureOpcodeCopyBuffer);
+    {
+        cmd->dstBuffer  = capture_.GetID(&dstBuffer);
+        cmd->dstOffset  = dstOffset;
+        cmd->srcBuffer  = capture_.GetID(&srcBuffer);
+        cmd->srcOffset  = srcOffset;
+        cmd->size       = size;
+    }
+}
+
+void DbgFrameCaptureEncoder::CopyBufferFromTexture(
+    Buffer&                 dstBuffer,
+    std::uint64_t           dstOffset,
+    Texture&                srcTexture,
+    const TextureRegion&    srcRegion,
+    std::uint32_t           rowStride,
+    std::uint32_t           layerStride)
+{
+    auto cmd = AllocCommand<FrameCaptureCmdCopyBufferTexture>(FrameCaptureOpcodeCopyBufferFromTexture);
+    {
+        cmd->buffer         = capture_.GetID(&dstBuffer);
+        cmd->offset         = dstOffset;
+        cmd->texture        = capture_.GetID(&srcTexture);
+        cmd->region         = srcRegion;
+        cmd->rowStride      = rowStride;
+        cmd->layerStride    = layerStride;
+    }
+}
+
+void DbgFrameCaptureEncoder::FillBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, std::uint32_t value, std::uint64_t fillSize)
+{
+    auto cmd = AllocCommand<FrameCaptureCmdFillBuffer>(FrameCaptureOpcodeFillBuffer);
+    {
+        cmd->dstBuffer  = capture_.GetID(&dstBuffer);
+        cmd->dstOffset  = dstOffset;
+        cmd->value      = value;
+        cmd->fillSize   = fillSize;
+    }
+}
+
+void DbgFrameCaptureEncoder::CopyTexture(
+    Texture&                dstTexture,
+    const TextureLocation&  dstLocation,
+    Texture&                srcTexture,
+    const TextureLocation&  srcLocation,
+    const Extent3D&         extent)
+{
+    auto cmd = AllocCommand<FrameCaptureCmdCopyTexture>(FrameCaptureOpcodeCopyTexture);
+    {
+        cmd->dstTexture     = capture_.GetID(&dstTexture);
+        cmd->dstLocation    = dstLocation;
+        cmd->srcTexture     = capture_.GetID(&srcTexture);
+        cmd->srcLocation    = srcLocation;
+        cmd->extent         = extent;
+    }
+}
+
+void DbgFrameCaptureEncoder::CopyTextureFromBuffer(
+    Texture&                dstTexture,
+    const TextureRegion&    dstRegion,
+    Buffer&                 srcBuffer,
+    std::uint64_t           srcOffset,
+    std::uint32_t           rowStride,
+    std::uint32_t           layerStride)
+{
+    auto cmd = AllocCommand<FrameCaptureCmdCopyBufferTexture>(FrameCaptureOpcodeCopyTextureFromBuffer);
+    {
+        cmd->buffer         = capture_.GetID(&srcBuffer);
+        cmd->offset         = srcOffset;
+        cmd->texture        = capture_.GetID(&dstTexture);
+        cmd->region         = dstRegion;
+        cmd->rowStride      = rowStride;
+        cmd->layerStride    = layerStride;
+    }
+}
+
+void DbgFrameCaptureEncoder::GenerateMips(Texture& texture, const TextureSubresource* subresource)
+{
+    auto cmd = AllocCommand<FrameCaptureCmdGenerateMips>(subresource != nullptr ? FrameCaptureOpcodeGenerateMipsRange : FrameCaptureOpcodeGenerateMips);
+    {
+        cmd->texture        = capture_.GetID(&texture);
+        cmd->subresource    = (subresource != nullptr ? *subresource : TextureSubresource{});
+    }
+}
+
+void DbgFrameCaptureEncoder::SetViewports(std::uint32_t numViewports, const Viewport* viewports)
+{
+    auto cmd = AllocCommand<FrameCaptureCmdSetViewports>(FrameCaptureOpcodeSetViewports, sizeof(Viewport) * numViewports);
+    {
+        cmd->count = numViewports;
+        std::memcpy(cmd + 1, viewports, sizeof(Viewport) * numViewports);
+    }
+}
+
+void DbgFrameCaptureEncoder::SetScissors(std::uint32_t numScissors, const Scissor* scissors)
+{
+    auto cmd = AllocCommand<FrameCaptureCmdSetScissors>(FrameCaptureOpcodeSetScissors, sizeof(Scissor) * numScissors);
+    {
+        cmd->count = numScissors;
+        std::memcpy(cmd + 1, scissors, sizeof(Scissor) * numScissors);
+    }
+}
+
+void DbgFrameCaptureEncoder::SetVertexBuffer(Buffer& buffer)
+{
+    auto cmd = AllocCommand<FrameCaptureCmdSetBuffer>(FrameCaptureOpcodeSetVertexBuffer);
+    cmd->buffer = capture_.GetID(&buffer);
+}
+
+void DbgFrameCaptureEncoder::SetIndexBuffer(Buffer& buffer)
+{
+    auto cmd = AllocCommand<FrameCaptureCmdSetBuffer>(FrameCaptureOpcodeSetIndexBuffer);
+    cmd->buffer = capture_.GetID(&buffer);
+}
+
+void DbgFrameCaptureEncoder::SetIndexBuffer(Buffer& buffer, const Format format, std::uint64_t offset)
+{
+    auto cmd = AllocCommand<FrameCaptureCmdSetIndexBufferExt>(FrameCaptureOpcodeSetIndexBufferExt);
+    {
+        cmd->buffer = capture_.GetID(&buffer);
+        cmd->format = format;
+        cmd->offset = offset;
+    }
+}
+
+void DbgFrameCaptureEncoder::SetResourceHeap(ResourceHeap& resourceHeap, std::uint32_t descriptorSet)
+{
+    auto cmd = AllocCommand<FrameCaptureCmdSetResourceHeap>(FrameCaptureOpcodeSetResourceHeap);
+    {
+        cmd->resourceHeap   = capture_.GetID(&resourceHeap);
+        cmd->descriptorSet  = descriptorSet;
+    }
+}
+
+void DbgFrameCaptureEncoder::SetResource(std::uint32_t descriptor, Resource& resource)
+{
+    auto cmd = AllocCommand<FrameCaptureCmdSetResource>(FrameCaptureOpcodeSetResource);
+    {
+        cmd->descriptor = descriptor;
+        cmd->resource   = capture_.GetID(&resource);
+    }
+}
+
+void DbgFrameCaptureEncoder::BeginRenderPass(
+    RenderTarget&       renderTarget,
+    const RenderPass*   renderPass,
+    std::uint32_t       numClearValues,
+    const ClearValue*   clearValues,
+    std::uint32_t       swapBufferIndex)
+{
+    auto cmd = AllocCommand<FrameCaptureCmdBeginRenderPass>(FrameCaptureOpcodeBeginRenderPass, sizeof(ClearValue) * numClearValues);
+    {
+        cmd->renderTarget       = capture_.GetID(&renderTarget);
+        cmd->renderPass         = capture_.GetID(renderPass);
+        cmd->swapBufferIndex    = swapBufferIndex;
+        cmd->numClearValues     = numClearValues;
+        std::memcpy(cmd + 1, clearValues, sizeof(ClearValue) * numClearValues);
+    }
+}
+
+void DbgFrameCaptureEncoder::EndRenderPass()
+{
+    AllocOpcode(FrameCaptureOpcodeEndRenderPass);
+}
+
+void DbgFrameCaptureEncoder::NextSubpass()
+{
+    AllocOpcode(FrameCaptureOpcodeNextSubpass);
+}
+
+void DbgFrameCaptureEncoder::Clear(long flags, const ClearValue& clearValue)
+{
+    auto cmd = AllocCommand<FrameCaptureCmdClear>(FrameCaptureOpcodeClear);
+    {
+        cmd->flags      = flags;
+        cmd->clearValue = clearValue;
+    }
+}
+
+void DbgFrameCaptureEncoder::ClearAttachments(std::uint32_t numAttachments, const AttachmentClear* attachments)
+{
+    auto cmd = AllocCommand<FrameCaptureCmdClearAttachments>(FrameCaptureOpcodeClearAttachments, sizeof(FrameCaptureCmdClearAttachment) * numAttachments);
+    {
+        cmd->count = numAttachments;
+        auto dst = reinterpret_cast<FrameCaptureCmdClearAttachment*>(cmd + 1);
+        for_range(i, numAttachments)
+        {
+            dst[i].flags            = attachments[i].flags;
+            dst[i].colorAttachment  = attachments[i].colorAttachment;
+            dst[i].clearValue       = attachments[i].clearValue;
+        }
+    }
+}
+
+void DbgFrameCaptureEncoder::SetPipelineState(PipelineState& pipelineState)
+{
+    auto cmd = AllocCommand<FrameCaptureCmdSetPipelineState>(FrameCaptureOpcodeSetPipelineState);
+    cmd->pipelineState = capture_.GetID(&pipelineState);
+}
+
+void DbgFrameCaptureEncoder::SetBlendFactor(const float color[4])
+{
+    auto cmd = AllocCommand<FrameCaptureCmdSetBlendFactor>(FrameCaptureOpcodeSetBlendFactor);
+    std::memcpy(cmd->color, color, sizeof(cmd->color));
+}
+
+void DbgFrameCaptureEncoder::SetStencilReference(std::uint32_t reference, const StencilFace stencilFace)
+{
+    auto cmd = AllocCommand<FrameCaptureCmdSetStencilReference>(FrameCaptureOpcodeSetStencilReference);
+    {
+        cmd->reference      = reference;
+        cmd->stencilFace    = stencilFace;
+    }
+}
+
+void DbgFrameCaptureEncoder::SetUniforms(std::uint32_t first, const void* data, std::uint16_t dataSize)
+{
+    auto cmd = AllocCommand<FrameCaptureCmdSetUniforms>(FrameCaptureOpcodeSetUniforms, dataSize);
+    {
+        cmd->first      = first;
+        cmd->dataSize   = dataSize;
+        std::memcpy(cmd + 1, data, dataSize);
+    }
+}
+
+void DbgFrameCaptureEncoder::Draw(const FrameCaptureOpcode opcode, const FrameCaptureCmdDraw& cmd)
+{
+    *AllocCommand<FrameCaptureCmdDraw>(opcode) = cmd;
+}
+
+void DbgFrameCaptureEncoder::DrawIndexed(const FrameCaptureOpcode opcode, const FrameCaptureCmdDrawIndexed& cmd)
+{
+    *AllocCommand<FrameCaptureCmdDrawIndexed>(opcode) = cmd;
+}
+
+void DbgFrameCaptureEncoder::DrawIndirect(
+    const FrameCaptureOpcode    opcode,
+    Buffer&                     buffer,
+    std::uint64_t               offset,
+    std::uint32_t               numCommands,
+    std::uint32_t               stride,
+    Buffer*                     countBuffer,
+    std::uint64_t               countBufferOffset)
+{
+    auto cmd = AllocCommand<FrameCaptureCmdDrawIndirect>(opcode);
+    {
+        cmd->buffer             = capture_.GetID(&buffer);
+        cmd->offset             = offset;
+        cmd->numCommands        = numCommands;
+        cmd->stride             = stride;
+        cmd->countBuffer        = capture_.GetID(countBuffer);
+        cmd->countBufferOffset  = countBufferOffset;
+    }
+}
+
+void DbgFrameCaptureEncoder::DrawMesh(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
+{
+    auto cmd = AllocCommand<FrameCaptureCmdDispatch>(FrameCaptureOpcodeDrawMesh);
+    {
+        cmd->numWorkGroups[0] = numWorkGroupsX;
+        cmd->numWorkGroups[1] = numWorkGroupsY;
+        cmd->numWorkGroups[2] = numWorkGroupsZ;
+    }
+}
+
+void DbgFrameCaptureEncoder::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
+{
+    auto cmd = AllocCommand<FrameCaptureCmdDispatch>(FrameCaptureOpcodeDispatch);
+    {
+        cmd->numWorkGroups[0] = numWorkGroupsX;
+        cmd->numWorkGroups[1] = numWorkGroupsY;
+        cmd->numWorkGroups[2] = numWorkGroupsZ;
+    }
+}
+
+void DbgFrameCaptureEncoder::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    auto cmd = AllocCommand<FrameCaptureCmdDispatchIndirect>(FrameCaptureOpcodeDispatchIndirect);
+    {
+        cmd->buffer = capture_.GetID(&buffer);
+        cmd->offset = offset;
+    }
+}
+
+void DbgFrameCaptureEncoder::PushDebugGroup(const char* name)
+{
+    const std::uint32_t length = (name != nullptr ? static_cast<std::uint32_t>(std::strlen(name)) : 0u);
+    auto cmd = AllocCommand<FrameCaptureCmdPushDebugGroup>(FrameCaptureOpcodePushDebugGroup, length + 1);
+    {
+        cmd->length = length;
+        std::memcpy(cmd + 1, (name != nullptr ? name : ""), length + 1);
+    }
+}
+
+void DbgFrameCaptureEncoder::PopDebugGroup()
+{
+    AllocOpcode(FrameCaptureOpcodePopDebugGroup);
+}
+
+void DbgFrameCaptureEncoder::Skip()
+{
+    capture_.RecordSkipped();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+template <typename TCommand>
+TCommand* DbgFrameCaptureEncoder::AllocCommand(const FrameCaptureOpcode opcode, std::size_t payloadSize)
+{
+    ++numCommands_;
+    return buffer_.AllocCommand<TCommand>(opcode, payloadSize);
+}
+
+void DbgFrameCaptureEncoder::AllocOpcode(const FrameCaptureOpcode opcode)
+{
+    ++numCommands_;
+    buffer_.AllocOpcode(opcode);
+}
+
+
+/*
+ * DbgFrameCapture class
+ */
+
+DbgFrameCapture::DbgFrameCapture(RenderSystem& renderSystemInstance) :
+    renderSystemInstance_ { renderSystemInstance },
+    isCapturing_          { false                }
+{
+}
+
+std::uint32_t DbgFrameCapture::GetID(const void* object) const
+{
+    if (object == nullptr)
+        return 0;
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    return GetIDUnsynchronized(object);
+}
+
+/* ----- Objects ----- */
+
+void DbgFrameCapture::RecordSwapChain(const SwapChain& swapChain)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    /* Track the swap-chain's render pass first, so it can be referenced by all other objects */
+    const RenderPass* renderPass = swapChain.GetRenderPass();
+    const std::uint32_t renderPassID = (renderPass != nullptr ? nextID_ + 1 : 0u);
+
+    TrackedObject& object = TrackObject(&swapChain, FrameCaptureRecordSwapChain);
+    if (renderPass != nullptr)
+        ids_[renderPass] = nextID_++;
+
+    FrameCaptureWriter writer{ object.desc };
+    writer.Write(swapChain.GetResolution());
+    writer.Write(swapChain.GetColorFormat());
+    writer.Write(swapChain.GetDepthStencilFormat());
+    writer.Write(swapChain.GetSamples());
+    writer.Write(renderPassID);
+}
+
+void DbgFrameCapture::RecordCommandBuffer(const CommandBuffer& commandBuffer, const CommandBufferDescriptor& commandBufferDesc)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    TrackedObject& object = TrackObject(&commandBuffer, FrameCaptureRecordCommandBuffer);
+
+    FrameCaptureWriter writer{ object.desc };
+    writer.WriteString(commandBufferDesc.debugName);
+    writer.WriteFlags(commandBufferDesc.flags);
+    writer.Write(commandBufferDesc.numNativeBuffers);
+    writer.Write(commandBufferDesc.minStagingPoolSize);
+    writer.Write(GetIDUnsynchronized(commandBufferDesc.renderPass));
+}
+
+void DbgFrameCapture::RecordBuffer(Buffer& buffer, const BufferDescriptor& bufferDesc, const void* initialData)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    TrackedObject& object = TrackObject(&buffer, FrameCaptureRecordBuffer);
+    object.resource = &buffer;
+
+    FrameCaptureWriter writer{ object.desc };
+    writer.WriteString(bufferDesc.debugName);
+    writer.Write(bufferDesc.size);
+    writer.Write(bufferDesc.stride);
+    writer.Write(bufferDesc.format);
+    writer.WriteFlags(bufferDesc.bindFlags);
+    writer.WriteFlags(bufferDesc.cpuAccessFlags);
+    writer.WriteFlags(bufferDesc.miscFlags);
+    WriteVertexAttributes(writer, bufferDesc.vertexAttribs);
+
+    /* Buffers that are created during a capture keep their initial data, since they are not part of the snapshot */
+    if (initialData != nullptr && IsCapturing())
+    {
+        const char* bytes = static_cast<const char*>(initialData);
+        object.content.assign(bytes, bytes + bufferDesc.size);
+    }
+}
+
+void DbgFrameCapture::RecordTexture(Texture& texture, const TextureDescriptor& textureDesc, const ImageView* initialImage)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    TrackedObject& object = TrackObject(&texture, FrameCaptureRecordTexture);
+    object.resource = &texture;
+
+    FrameCaptureWriter writer{ object.desc };
+    writer.WriteString(textureDesc.debugName);
+    writer.Write(textureDesc.type);
+    writer.WriteFlags(textureDesc.bindFlags);
+    writer.WriteFlags(textureDesc.cpuAccessFlags);
+    writer.WriteFlags(textureDesc.miscFlags);
+    writer.Write(textureDesc.format);
+    writer.Write(textureDesc.extent);
+    writer.Write(textureDesc.arrayLayers);
+    writer.Write(textureDesc.mipLevels);
+    writer.Write(textureDesc.samples);
+    writer.Write(textureDesc.transientSlot);
+    writer.Write(textureDesc.clearValue);
+
+    /* Textures that are created during a capture keep their initial image, since they are not part of the snapshot */
+    if (initialImage != nullptr && initialImage->data != nullptr && IsCapturing())
+    {
+        FrameCaptureWriter contentWriter{ object.content };
+        contentWriter.Write(initialImage->format);
+        contentWriter.Write(initialImage->dataType);
+        contentWriter.WriteData(initialImage->data, initialImage->dataSize);
+    }
+}
+
+void DbgFrameCapture::RecordSampler(const Sampler& sampler, const SamplerDescriptor& samplerDesc)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    TrackedObject& object = TrackObject(&sampler, FrameCaptureRecordSampler);
+
+    FrameCaptureWriter writer{ object.desc };
+    WriteSamplerDesc(writer, samplerDesc);
+}
+
+void DbgFrameCapture::RecordShader(const Shader& shader, const ShaderDescriptor& shaderDesc)
+{
+    /* Load shader source outside of the lock, since it might be read from a file */
+    ShaderSourceType sourceType = shaderDesc.sourceType;
+    const std::vector<char> source = ReadShaderSource(shaderDesc, sourceType);
+
+    std::vector<char> desc;
+    FrameCaptureWriter writer{ desc };
+    writer.WriteString(shaderDesc.debugName);
+    writer.Write(shaderDesc.type);
+    writer.Write(sourceType);
+    writer.Write(static_cast<std::uint64_t>(source.size()));
+    writer.WriteData(source.data(), source.size());
+    writer.Write('\0');
+    writer.WriteString(shaderDesc.entryPoint);
+    writer.WriteString(shaderDesc.profile);
+
+    std::uint32_t numDefines = 0;
+    if (shaderDesc.defines != nullptr)
+    {
+        while (shaderDesc.defines[numDefines].name != nullptr)
+            ++numDefines;
+    }
+    writer.Write(numDefines);
+    for_range(i, numDefines)
+    {
+        writer.WriteString(shaderDesc.defines[i].name);
+        writer.WriteString(shaderDesc.defines[i].definition);
+    }
+
+    writer.WriteFlags(shaderDesc.flags);
+    WriteVertexAttributes(writer, shaderDesc.vertex.inputAttribs);
+    WriteVertexAttributes(writer, shaderDesc.vertex.outputAttribs);
+
+    writer.Write(static_cast<std::uint32_t>(shaderDesc.fragment.outputAttribs.size()));
+    for (const FragmentAttribute& attrib : shaderDesc.fragment.outputAttribs)
+    {
+        writer.WriteString(attrib.name);
+        writer.Write(attrib.format);
+        writer.Write(attrib.location);
+        writer.Write(attrib.systemValue);
+    }
+
+    writer.Write(shaderDesc.compute.workGroupSize);
+
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    /* Shaders with identical descriptors share their record, so PSOs that are created from recreated shaders are recorded only once */
+    const std::uint64_t hash = HashRecord(FrameCaptureRecordShader, desc);
+    auto it = shaderIDs_.find(hash);
+    if (it != shaderIDs_.end())
+    {
+        auto objectIt = objects_.find(it->second);
+        if (objectIt != objects_.end() && objectIt->second.desc == desc)
+        {
+            ids_[&shader] = it->second;
+            return;
+        }
+    }
+
+    const std::uint32_t id = nextID_;
+    TrackedObject& object = TrackObject(&shader, FrameCaptureRecordShader);
+    object.desc = std::move(desc);
+    shaderIDs_[hash] = id;
+}
+
+void DbgFrameCapture::RecordPipelineLayout(const PipelineLayout& pipelineLayout, const PipelineLayoutDescriptor& pipelineLayoutDesc)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    TrackedObject& object = TrackObject(&pipelineLayout, FrameCaptureRecordPipelineLayout);
+
+    FrameCaptureWriter writer{ object.desc };
+    writer.WriteString(pipelineLayoutDesc.debugName);
+    WriteBindingDescs(writer, pipelineLayoutDesc.heapBindings);
+    WriteBindingDescs(writer, pipelineLayoutDesc.bindings);
+
+    writer.Write(static_cast<std::uint32_t>(pipelineLayoutDesc.staticSamplers.size()));
+    for (const StaticSamplerDescriptor& staticSamplerDesc : pipelineLayoutDesc.staticSamplers)
+    {
+        writer.WriteString(staticSamplerDesc.name);
+        writer.WriteFlags(staticSamplerDesc.stageFlags);
+        WriteBindingSlot(writer, staticSamplerDesc.slot);
+        WriteSamplerDesc(writer, staticSamplerDesc.sampler);
+    }
+
+    writer.Write(static_cast<std::uint32_t>(pipelineLayoutDesc.uniforms.size()));
+    for (const UniformDescriptor& uniformDesc : pipelineLayoutDesc.uniforms)
+    {
+        writer.WriteString(uniformDesc.name);
+        writer.Write(uniformDesc.type);
+        writer.Write(uniformDesc.arraySize);
+    }
+}
+
+void DbgFrameCapture::RecordPipelineState(const PipelineState& pipelineState, const GraphicsPipelineDescriptor& pipelineStateDesc)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    TrackedObject& object = TrackObject(&pipelineState, FrameCaptureRecordGraphicsPipeline);
+
+    FrameCaptureWriter writer{ object.desc };
+    writer.WriteString(pipelineStateDesc.debugName);
+    writer.Write(GetIDUnsynchronized(pipelineStateDesc.pipelineLayout));
+    writer.Write(GetIDUnsynchronized(pipelineStateDesc.renderPass));
+    writer.Write(pipelineStateDesc.subpass);
+    writer.Write(GetIDUnsynchronized(pipelineStateDesc.vertexShader));
+    writer.Write(GetIDUnsynchronized(pipelineStateDesc.tessControlShader));
+    writer.Write(GetIDUnsynchronized(pipelineStateDesc.tessEvaluationShader));
+    writer.Write(GetIDUnsynchronized(pipelineStateDesc.geometryShader));
+    writer.Write(GetIDUnsynchronized(pipelineStateDesc.fragmentShader));
+    writer.Write(GetIDUnsynchronized(pipelineStateDesc.taskShader));
+    writer.Write(GetIDUnsynchronized(pipelineStateDesc.meshShader));
+    writer.Write(pipelineStateDesc.indexFormat);
+    writer.Write(pipelineStateDesc.primitiveTopology);
+    WriteRawArray(writer, pipelineStateDesc.viewports);
+    WriteRawArray(writer, pipelineStateDesc.scissors);
+    writer.Write(pipelineStateDesc.depth);
+    writer.Write(pipelineStateDesc.stencil);
+    writer.Write(pipelineStateDesc.rasterizer);
+    writer.Write(pipelineStateDesc.blend);
+    writer.Write(pipelineStateDesc.tessellation);
+    WriteRawArray(writer, pipelineStateDesc.specializationConstants);
+}
+
+void DbgFrameCapture::RecordPipelineState(const PipelineState& pipelineState, const ComputePipelineDescriptor& pipelineStateDesc)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    TrackedObject& object = TrackObject(&pipelineState, FrameCaptureRecordComputePipeline);
+
+    FrameCaptureWriter writer{ object.desc };
+    writer.WriteString(pipelineStateDesc.debugName);
+    writer.Write(GetIDUnsynchronized(pipelineStateDesc.pipelineLayout));
+    writer.Write(GetIDUnsynchronized(pipelineStateDesc.computeShader));
+    WriteRawArray(writer, pipelineStateDesc.specializationConstants);
+}
+
+void DbgFrameCapture::RecordResourceHeap(const ResourceHeap& resourceHeap, const ResourceHeapDescriptor& resourceHeapDesc, const ArrayView<ResourceViewDescriptor>& initialResourceViews)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    TrackedObject& object = TrackObject(&resourceHeap, FrameCaptureRecordResourceHeap);
+
+    FrameCaptureWriter writer{ object.desc };
+    writer.WriteString(resourceHeapDesc.debugName);
+    writer.Write(GetIDUnsynchronized(resourceHeapDesc.pipelineLayout));
+    writer.Write(resourceHeapDesc.numResourceViews);
+    writer.WriteFlags(resourceHeapDesc.barrierFlags);
+    WriteResourceViews(object.desc, initialResourceViews);
+}
+
+void DbgFrameCapture::RecordResourceHeapWrite(const ResourceHeap& resourceHeap, std::uint32_t firstDescriptor, const ArrayView<ResourceViewDescriptor>& resourceViews)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    const std::uint32_t id = GetIDUnsynchronized(&resourceHeap);
+    auto it = objects_.find(id);
+    if (it == objects_.end())
+        return;
+
+    std::vector<char> payload;
+    FrameCaptureWriter writer{ payload };
+    writer.Write(firstDescriptor);
+    WriteResourceViews(payload, resourceViews);
+
+    /* Keep all writes for later captures; a write during a capture is also a frame event, since it affects the following submissions */
+    AppendRecord(it->second.updates, FrameCaptureRecordResourceHeapWrite, id, payload.data(), payload.size());
+    if (IsCapturing())
+        AppendRecord(frame_, FrameCaptureRecordResourceHeapWrite, id, payload.data(), payload.size());
+}
+
+void DbgFrameCapture::RecordRenderPass(const RenderPass& renderPass, const RenderPassDescriptor& renderPassDesc)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    TrackedObject& object = TrackObject(&renderPass, FrameCaptureRecordRenderPass);
+
+    FrameCaptureWriter writer{ object.desc };
+    writer.WriteString(renderPassDesc.debugName);
+    writer.WriteData(renderPassDesc.colorAttachments, sizeof(renderPassDesc.colorAttachments));
+    writer.Write(renderPassDesc.depthAttachment);
+    writer.Write(renderPassDesc.stencilAttachment);
+    writer.Write(renderPassDesc.samples);
+    writer.Write(static_cast<std::uint32_t>(renderPassDesc.subpasses.size()));
+    writer.WriteData(renderPassDesc.subpasses.data(), renderPassDesc.subpasses.size() * sizeof(SubpassDescriptor));
+}
+
+void DbgFrameCapture::RecordRenderTarget(const RenderTarget& renderTarget, const RenderTargetDescriptor& renderTargetDesc)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    /* Render targets might create their own render pass, which can be referenced by PSOs */
+    const RenderPass* renderPass = renderTarget.GetRenderPass();
+    const bool hasImplicitRenderPass = (renderPass != nullptr && renderPass != renderTargetDesc.renderPass && GetIDUnsynchronized(renderPass) == 0);
+    const std::uint32_t renderPassID = (hasImplicitRenderPass ? nextID_ + 1 : 0u);
+
+    TrackedObject& object = TrackObject(&renderTarget, FrameCaptureRecordRenderTarget);
+    if (hasImplicitRenderPass)
+        ids_[renderPass] = nextID_++;
+
+    auto WriteAttachment = [this](FrameCaptureWriter& writer, const AttachmentDescriptor& attachmentDesc)
+    {
+        writer.Write(attachmentDesc.format);
+        writer.Write(GetIDUnsynchronized(attachmentDesc.texture));
+        writer.Write(attachmentDesc.mipLevel);
+        writer.Write(attachmentDesc.arrayLayer);
+    };
+
+    FrameCaptureWriter writer{ object.desc };
+    writer.WriteString(renderTargetDesc.debugName);
+    writer.Write(GetIDUnsynchronized(renderTargetDesc.renderPass));
+    writer.Write(renderTargetDesc.resolution);
+    writer.Write(renderTargetDesc.samples);
+    for (const AttachmentDescriptor& attachmentDesc : renderTargetDesc.colorAttachments)
+        WriteAttachment(writer, attachmentDesc);
+    for (const AttachmentDescriptor& attachmentDesc : renderTargetDesc.resolveAttachments)
+        WriteAttachment(writer, attachmentDesc);
+    WriteAttachment(writer, renderTargetDesc.depthStencilAttachment);
+    writer.Write(renderPassID);
+}
+
+void DbgFrameCapture::ReleaseObject(const void* object)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    auto it = ids_.find(object);
+    if (it == ids_.end())
+        return;
+
+    /* The address of a released object can be reused for a new object, so it must no longer be associated with its ID */
+    const std::uint32_t id = it->second;
+    ids_.erase(it);
+
+    auto objectIt = objects_.find(id);
+    if (objectIt == objects_.end())
+        return;
+
+    /*
+    Keep records of objects that other objects are commonly created from, since they are often released early.
+    Objects that are released during a capture are kept until the capture has been written.
+    */
+    TrackedObject& trackedObject = objectIt->second;
+    trackedObject.resource = nullptr;
+    trackedObject.released = true;
+
+    const bool isDependency =
+    (
+        trackedObject.type == FrameCaptureRecordShader          ||
+        trackedObject.type == FrameCaptureRecordPipelineLayout  ||
+        trackedObject.type == FrameCaptureRecordRenderPass
+    );
+    if (!isDependency && !IsCapturing())
+    {
+        if (IsPipelineRecord(trackedObject.type))
+            KeepReleasedPipeline(id, std::move(trackedObject));
+        objects_.erase(objectIt);
+    }
+}
+
+/* ----- Frame events ----- */
+
+void DbgFrameCapture::RecordBufferWrite(const Buffer& buffer, std::uint64_t offset, const void* data, std::uint64_t dataSize)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    std::vector<char> payload;
+    FrameCaptureWriter writer{ payload };
+    writer.Write(offset);
+    writer.Write(dataSize);
+    writer.WriteData(data, static_cast<std::size_t>(dataSize));
+
+    AppendRecord(frame_, FrameCaptureRecordBufferWrite, GetIDUnsynchronized(&buffer), payload.data(), payload.size());
+}
+
+void DbgFrameCapture::RecordTextureWrite(const Texture& texture, const TextureRegion& textureRegion, const ImageView& srcImageView)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    std::vector<char> payload;
+    WriteTextureWrite(payload, textureRegion, srcImageView);
+    AppendRecord(frame_, FrameCaptureRecordTextureWrite, GetIDUnsynchronized(&texture), payload.data(), payload.size());
+}
+
+void DbgFrameCapture::RecordBufferMapping(const Buffer& buffer, std::uint64_t offset, std::uint64_t length, void* mappedData)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    MappedRange& range = mappedRanges_[&buffer];
+    {
+        range.offset    = offset;
+        range.length    = length;
+        range.data      = mappedData;
+    }
+}
+
+void DbgFrameCapture::RecordBufferUnmapping(const Buffer& buffer)
+{
+    MappedRange range;
+    {
+        std::lock_guard<std::mutex> guard{ mutex_ };
+        auto it = mappedRanges_.find(&buffer);
+        if (it == mappedRanges_.end())
+            return;
+        range = it->second;
+        mappedRanges_.erase(it);
+    }
+
+    /* Record the mapped range as buffer write, since the client has written into it before unmapping */
+    RecordBufferWrite(buffer, range.offset, range.data, range.length);
+}
+
+void DbgFrameCapture::RecordSubmit(const CommandBuffer& commandBuffer, const DbgFrameCaptureEncoder& encoder)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    const DbgFrameCaptureVirtualCommandBuffer& commandStream = encoder.GetCommandStream();
+    const std::uint64_t streamSize = commandStream.Size();
+
+    const FrameCaptureRecordHeader header{ FrameCaptureRecordSubmit, GetIDUnsynchronized(&commandBuffer), sizeof(std::uint64_t) + streamSize };
+    FrameCaptureWriter writer{ frame_ };
+    writer.Write(header);
+    writer.Write(streamSize);
+    for (const auto& chunk : commandStream)
+        writer.WriteData(chunk.data, chunk.size);
+}
+
+void DbgFrameCapture::RecordSkipped()
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    ++numSkipped_;
+}
+
+void DbgFrameCapture::OnPresent(const SwapChain& swapChain, RenderingDebugger* debugger)
+{
+    if (IsCapturing())
+    {
+        {
+            std::lock_guard<std::mutex> guard{ mutex_ };
+            AppendRecord(frame_, FrameCaptureRecordPresent, GetIDUnsynchronized(&swapChain), nullptr, 0);
+        }
+        EndCapture();
+    }
+
+    if (debugger != nullptr)
+    {
+        if (const char* filename = debugger->GetPipelineManifestRequest())
+        {
+            if (WritePipelineManifest(filename))
+                Log::Printf("saved pipeline manifest into file: \"%s\"\n", filename);
+            else
+                Log::Errorf("failed to write pipeline manifest file: \"%s\"\n", filename);
+            debugger->SavePipelineManifest(nullptr);
+        }
+        if (const char* filename = debugger->GetFrameCaptureRequest())
+        {
+            BeginCapture(filename);
+            debugger->CaptureFrame(nullptr);
+        }
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+DbgFrameCapture::TrackedObject& DbgFrameCapture::TrackObject(const void* object, const FrameCaptureRecordType type)
+{
+    const std::uint32_t id = nextID_++;
+    ids_[object] = id;
+    TrackedObject& trackedObject = objects_[id];
+    trackedObject.type = type;
+    return trackedObject;
+}
+
+std::uint32_t DbgFrameCapture::GetIDUnsynchronized(const void* object) const
+{
+    if (object != nullptr)
+    {
+        auto it = ids_.find(object);
+        if (it != ids_.end())
+            return it->second;
+    }
+    return 0;
+}
+
+void DbgFrameCapture::AppendRecord(std::vector<char>& output, const FrameCaptureRecordType type, std::uint32_t id, const void* payload, std::size_t payloadSize)
+{
+    const FrameCaptureRecordHeader header{ type, id, payloadSize };
+    FrameCaptureWriter writer{ output };
+    writer.Write(header);
+    writer.WriteData(payload, payloadSize);
+}
+
+void DbgFrameCapture::WriteResourceViews(std::vector<char>& output, const ArrayView<ResourceViewDescriptor>& resourceViews)
+{
+    FrameCaptureWriter writer{ output };
+    writer.Write(static_cast<std::uint32_t>(resourceViews.size()));
+    for (const ResourceViewDescriptor& resourceView : resourceViews)
+    {
+        writer.Write(GetIDUnsynchronized(resourceView.resource));
+        writer.Write(resourceView.textureView);
+        writer.Write(resourceView.bufferView);
+        writer.Write(resourceView.initialCount);
+    }
+}
+
+void DbgFrameCapture::WriteTextureWrite(std::vector<char>& output, const TextureRegion& textureRegion, const ImageView& imageView)
+{
+    FrameCaptureWriter writer{ output };
+    writer.Write(textureRegion);
+    writer.Write(imageView.format);
+    writer.Write(imageView.dataType);
+    writer.Write(static_cast<std::uint64_t>(imageView.dataSize));
+    writer.WriteData(imageView.data, imageView.dataSize);
+}
+
+void DbgFrameCapture::BeginCapture(const char* filename)
+{
+    /* Wait until all previous submissions are complete, so the snapshot represents the state at the beginning of the frame */
+    if (CommandQueue* commandQueue = renderSystemInstance_.GetCommandQueue())
+        commandQueue->WaitIdle();
+
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    captureFilename_ = filename;
+    snapshot_.clear();
+    frame_.clear();
+    numSkipped_ = 0;
+
+    /* Read back the contents of all live buffers and textures */
+    for (auto& it : objects_)
+    {
+        TrackedObject& object = it.second;
+        if (object.resource == nullptr)
+            continue;
+        if (object.type == FrameCaptureRecordBuffer)
+            ReadBufferContent(object);
+        else if (object.type == FrameCaptureRecordTexture)
+            ReadTextureContent(it.first, object);
+    }
+
+    isCapturing_ = true;
+}
+
+void DbgFrameCapture::EndCapture()
+{
+    isCapturing_ = false;
+
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    if (WriteCaptureFile())
+        Log::Printf("captured frame into file: \"%s\"\n", captureFilename_.c_str());
+    else
+        Log::Errorf("failed to write frame capture file: \"%s\"\n", captureFilename_.c_str());
+
+    /* Release intermediate data and all objects that have been released during the capture */
+    snapshot_.clear();
+    snapshot_.shrink_to_fit();
+    frame_.clear();
+    frame_.shrink_to_fit();
+
+    for (auto it = objects_.begin(); it != objects_.end();)
+    {
+        TrackedObject& object = it->second;
+        object.content.clear();
+        object.content.shrink_to_fit();
+        if (object.released && object.type != FrameCaptureRecordShader && object.type != FrameCaptureRecordPipelineLayout && object.type != FrameCaptureRecordRenderPass)
+        {
+            if (IsPipelineRecord(object.type))
+                KeepReleasedPipeline(it->first, std::move(object));
+            it = objects_.erase(it);
+        }
+        else
+            ++it;
+    }
+}
+
+void DbgFrameCapture::ReadBufferContent(TrackedObject& object)
+{
+    auto& buffer = static_cast<Buffer&>(*object.resource);
+    const std::uint64_t size = buffer.GetDesc().size;
+    if (size == 0)
+        return;
+
+    object.content.resize(static_cast<std::size_t>(size));
+    renderSystemInstance_.ReadBuffer(buffer, 0, object.content.data(), size);
+}
+
+void DbgFrameCapture::ReadTextureContent(std::uint32_t id, TrackedObject& object)
+{
+    auto& texture = static_cast<Texture&>(*object.resource);
+
+    /* Depth-stencil, compressed, and multi-sampled textures cannot be read back by all backends; they are restored by the captured frame itself */
+    const TextureDescriptor textureDesc = texture.GetDesc();
+    if (IsDepthOrStencilFormat(textureDesc.format) || IsCompressedFormat(textureDesc.format) || IsMultiSampleTexture(textureDesc.type))
+        return;
+
+    const FormatAttributes& formatAttribs = GetFormatAttribs(textureDesc.format);
+    const std::uint32_t numMipLevels = NumMipLevels(textureDesc);
+
+    std::vector<char> imageData;
+    std::vector<char> payload;
+    for_range(mipLevel, numMipLevels)
+    {
+        TextureRegion region;
+        {
+            region.subresource  = TextureSubresource{ 0, textureDesc.arrayLayers, mipLevel, 1 };
+            region.offset       = Offset3D{ 0, 0, 0 };
+            region.extent       = GetMipExtent(textureDesc.type, textureDesc.extent, mipLevel);
+        }
+        const std::size_t dataSize = GetMemoryFootprint(textureDesc.type, textureDesc.format, textureDesc.extent, region.subresource);
+        if (dataSize == 0)
+            continue;
+
+        imageData.resize(dataSize);
+        const MutableImageView dstImageView{ formatAttribs.format, formatAttribs.dataType, imageData.data(), dataSize };
+        renderSystemInstance_.ReadTexture(texture, region, dstImageView);
+
+        payload.clear();
+        const ImageView srcImageView{ formatAttribs.format, formatAttribs.dataType, imageData.data(), dataSize };
+        WriteTextureWrite(payload, region, srcImageView);
+        AppendRecord(snapshot_, FrameCaptureRecordTextureWrite, id, payload.data(), payload.size());
+    }
+}
+
+bool DbgFrameCapture::WriteCaptureFile()
+{
+    std::ofstream file{ captureFilename_, std::ios::out | std::ios::binary };
+    if (!file.good())
+        return false;
+
+    /* Write header */
+    FrameCaptureHeader header = {};
+    {
+        header.magic        = g_frameCaptureMagic;
+        header.version      = g_frameCaptureVersion;
+        FillFrameCaptureStructSizes(header.rawStructSizes);
+        header.numObjects   = nextID_ - 1;
+        header.numSkipped   = numSkipped_;
+        if (const char* rendererName = renderSystemInstance_.GetName())
+            std::strncpy(header.rendererName, rendererName, sizeof(header.rendererName) - 1);
+    }
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    /* Write object records in creation order with their content and subsequent updates */
+    for (const auto& it : objects_)
+    {
+        const TrackedObject& object = it.second;
+        const std::uint64_t contentSize = object.content.size();
+        const FrameCaptureRecordHeader recordHeader{ object.type, it.first, object.desc.size() + sizeof(contentSize) + contentSize };
+        file.write(reinterpret_cast<const char*>(&recordHeader), sizeof(recordHeader));
+        file.write(object.desc.data(), static_cast<std::streamsize>(object.desc.size()));
+        file.write(reinterpret_cast<const char*>(&contentSize), sizeof(contentSize));
+        file.write(object.content.data(), static_cast<std::streamsize>(object.content.size()));
+        file.write(object.updates.data(), static_cast<std::streamsize>(object.updates.size()));
+    }
+
+    /* Write texture contents, then the frame events */
+    file.write(snapshot_.data(), static_cast<std::streamsize>(snapshot_.size()));
+
+    const FrameCaptureRecordHeader frameHeader{ FrameCaptureRecordFrameBegin, 0, 0 };
+    file.write(reinterpret_cast<const char*>(&frameHeader), sizeof(frameHeader));
+    file.write(frame_.data(), static_cast<std::streamsize>(frame_.size()));
+
+    return file.good();
+}
+
+void DbgFrameCapture::KeepReleasedPipeline(std::uint32_t id, TrackedObject&& object)
+{
+    /* Applications commonly recreate the same PSOs, e.g. when the swap-chain is resized, so only keep one record of each */
+    const std::uint64_t hash = HashRecord(object.type, object.desc);
+    auto it = releasedPipelineIDs_.find(hash);
+    if (it != releasedPipelineIDs_.end())
+    {
+        const TrackedObject& releasedObject = releasedPipelines_[it->second];
+        if (releasedObject.type == object.type && releasedObject.desc == object.desc)
+            return;
+    }
+
+    TrackedObject& releasedObject = releasedPipelines_[id];
+    releasedObject.type     = object.type;
+    releasedObject.desc     = std::move(object.desc);
+    releasedObject.released = true;
+    releasedPipelineIDs_[hash] = id;
+}
+
+bool DbgFrameCapture::WritePipelineManifest(const char* filename)
+{
+    std::ofstream file{ filename, std::ios::out | std::ios::binary };
+    if (!file.good())
+        return false;
+
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    /* Write header */
+    FrameCaptureHeader header = {};
+    {
+        header.magic        = g_pipelineManifestMagic;
+        header.version      = g_frameCaptureVersion;
+        FillFrameCaptureStructSizes(header.rawStructSizes);
+        header.numObjects   = nextID_ - 1;
+        header.numSkipped   = 0;
+        if (const char* rendererName = renderSystemInstance_.GetName())
+            std::strncpy(header.rendererName, rendererName, sizeof(header.rendererName) - 1);
+    }
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    /* Write the records of live objects and released PSOs in creation order, so each record only refers to previous ones */
+    std::map<std::uint32_t, const TrackedObject*> records;
+    for (const auto& it : objects_)
+    {
+        if (IsPipelineManifestRecord(it.second.type))
+            records[it.first] = &(it.second);
+    }
+    for (const auto& it : releasedPipelines_)
+        records[it.first] = &(it.second);
+
+    std::unordered_map<std::uint64_t, const TrackedObject*> pipelines;
+    for (const auto& it : records)
+    {
+        const TrackedObject& object = *(it.second);
+
+        /* Skip live PSOs that are identical to a previous one */
+        if (IsPipelineRecord(object.type))
+        {
+            const TrackedObject*& pipeline = pipelines[HashRecord(object.type, object.desc)];
+            if (pipeline != nullptr && pipeline->type == object.type && pipeline->desc == object.desc)
+                continue;
+            pipeline = &object;
+        }
+
+        const std::uint64_t contentSize = 0;
+        const FrameCaptureRecordHeader recordHeader{ object.type, it.first, object.desc.size() + sizeof(contentSize) };
+        file.write(reinterpret_cast<const char*>(&recordHeader), sizeof(recordHeader));
+        file.write(object.desc.data(), static_cast<std::streamsize>(object.desc.size()));
+        file.write(reinterpret_cast<const char*>(&contentSize), sizeof(contentSize));
+    }
+
+    return file.good();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,270 @@
+/*
+ * DbgFrameCapture.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_DBG_FRAME_CAPTURE_H
+#define LLGL_DBG_FRAME_CAPTURE_H
+
+
+#include <LLGL/ForwardDecls.h>
+#include <LLGL/RenderSystemChild.h>
+#include <LLGL/ShaderFlags.h>
+#include <LLGL/SamplerFlags.h>
+#include <LLGL/PipelineLayoutFlags.h>
+#include <LLGL/ResourceHeapFlags.h>
+#include <LLGL/RenderTargetFlags.h>
+#include <LLGL/ImageFlags.h>
+#include <LLGL/Container/ArrayView.h>
+#include "../VirtualCommandBuffer.h"
+#include "../../Core/FrameCaptureFormat.h"
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class RenderingDebugger;
+class DbgFrameCapture;
+
+using DbgFrameCaptureVirtualCommandBuffer = VirtualCommandBuffer<FrameCaptureOpcode>;
+
+/*
+Encodes the commands of a single command buffer into the frame capture command stream while a capture is active.
+Objects are referenced by their capture IDs (see DbgFrameCapture::GetID).
+*/
+class DbgFrameCaptureEncoder
+{
+
+    public:
+
+        DbgFrameCaptureEncoder(DbgFrameCapture& capture);
+
+        // Clears the command stream and starts encoding if a capture is active. Returns true if encoding has started.
+        bool Begin();
+        void End();
+
+        void UpdateBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint64_t dataSize);
+        void CopyBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, Buffer& srcBuffer, std::uint64_t srcOffset, std::uint64_t size);
+        void CopyBufferFromTexture(Buffer& dstBuffer, std::uint64_t dstOffset, Texture& srcTexture, const TextureRegion& srcRegion, std::uint32_t rowStride, std::uint32_t layerStride);
+        void FillBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, std::uint32_t value, std::uint64_t fillSize);
+        void CopyTexture(Texture& dstTexture, const TextureLocation& dstLocation, Texture& srcTexture, const TextureLocation& srcLocation, const Extent3D& extent);
+        void CopyTextureFromBuffer(Texture& dstTexture, const TextureRegion& dstRegion, Buffer& srcBuffer, std::uint64_t srcOffset, std::uint32_t rowStride, std::uint32_t layerStride);
+        void GenerateMips(Texture& texture, const TextureSubresource* subresource);
+
+        void SetViewports(std::uint32_t numViewports, const Viewport* viewports);
+        void SetScissors(std::uint32_t numScissors, const Scissor* scissors);
+
+        void SetVertexBuffer(Buffer& buffer);
+        void SetIndexBuffer(Buffer& buffer);
+        void SetIndexBuffer(Buffer& buffer, const Format format, std::uint64_t offset);
+
+        void SetResourceHeap(ResourceHeap& resourceHeap, std::uint32_t descriptorSet);
+        void SetResource(std::uint32_t descriptor, Resource& resource);
+
+        void BeginRenderPass(RenderTarget& renderTarget, const RenderPass* renderPass, std::uint32_t numClearValues, const ClearValue* clearValues, std::uint32_t swapBufferIndex);
+        void EndRenderPass();
+        void NextSubpass();
+        void Clear(long flags, const ClearValue& clearValue);
+        void ClearAttachments(std::uint32_t numAttachments, const AttachmentClear* attachments);
+
+        void SetPipelineState(PipelineState& pipelineState);
+        void SetBlendFactor(const float color[4]);
+        void SetStencilReference(std::uint32_t reference, const StencilFace stencilFace);
+        void SetUniforms(std::uint32_t first, const void* data, std::uint16_t dataSize);
+
+        void Draw(const FrameCaptureOpcode opcode, const FrameCaptureCmdDraw& cmd);
+        void DrawIndexed(const FrameCaptureOpcode opcode, const FrameCaptureCmdDrawIndexed& cmd);
+        void DrawIndirect(const FrameCaptureOpcode opcode, Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride, Buffer* countBuffer = nullptr, std::uint64_t countBufferOffset = 0);
+        void DrawMesh(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ);
+        void Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ);
+        void DispatchIndirect(Buffer& buffer, std::uint64_t offset);
+
+        void PushDebugGroup(const char* name);
+        void PopDebugGroup();
+
+        // Counts a command that cannot be captured.
+        void Skip();
+
+    public:
+
+        // Returns true if this encoder is recording the current command buffer.
+        inline bool IsEncoding() const
+        {
+            return isEncoding_;
+        }
+
+        // Returns the encoded command stream.
+        inline const DbgFrameCaptureVirtualCommandBuffer& GetCommandStream() const
+        {
+            return buffer_;
+        }
+
+        // Returns the number of encoded commands.
+        inline std::uint32_t GetNumCommands() const
+        {
+            return numCommands_;
+        }
+
+    private:
+
+        template <typename TCommand>
+        TCommand* AllocCommand(const FrameCaptureOpcode opcode, std::size_t payloadSize = 0);
+
+        // Allocates a command without payload.
+        void AllocOpcode(const FrameCaptureOpcode opcode);
+
+    private:
+
+        DbgFrameCapture&                    capture_;
+        DbgFrameCaptureVirtualCommandBuffer buffer_;
+        std::uint32_t                       numCommands_    = 0;
+        bool                                isEncoding_     = false;
+
+};
+
+/*
+Object tracker and frame recorder for the profile-only debug layer (see RenderSystemFlags::FrameCapture).
+The descriptors of all objects are serialized when they are created. When a capture is requested, the contents of all buffers and textures
+are read back at the next swap-chain presentation, and all resource updates and submissions until the following presentation are recorded.
+The records of released PSOs are kept for the pipeline manifest (see RenderingDebugger::SavePipelineManifest).
+*/
+class DbgFrameCapture
+{
+
+    public:
+
+        DbgFrameCapture(RenderSystem& renderSystemInstance);
+
+        // Returns true while a frame is being captured. This can be called from any thread.
+        inline bool IsCapturing() const
+        {
+            return isCapturing_.load();
+        }
+
+        // Returns the capture ID of the specified object or zero if the object is null or not tracked.
+        std::uint32_t GetID(const void* object) const;
+
+        /* ----- Objects ----- */
+
+        void RecordSwapChain(const SwapChain& swapChain);
+        void RecordCommandBuffer(const CommandBuffer& commandBuffer, const CommandBufferDescriptor& commandBufferDesc);
+        void RecordBuffer(Buffer& buffer, const BufferDescriptor& bufferDesc, const void* initialData);
+        void RecordTexture(Texture& texture, const TextureDescriptor& textureDesc, const ImageView* initialImage);
+        void RecordSampler(const Sampler& sampler, const SamplerDescriptor& samplerDesc);
+        void RecordShader(const Shader& shader, const ShaderDescriptor& shaderDesc);
+        void RecordPipelineLayout(const PipelineLayout& pipelineLayout, const PipelineLayoutDescriptor& pipelineLayoutDesc);
+        void RecordPipelineState(const PipelineState& pipelineState, const GraphicsPipelineDescriptor& pipelineStateDesc);
+        void RecordPipelineState(const PipelineState& pipelineState, const ComputePipelineDescriptor& pipelineStateDesc);
+        void RecordResourceHeap(const ResourceHeap& resourceHeap, const ResourceHeapDescriptor& resourceHeapDesc, const ArrayView<ResourceViewDescriptor>& initialResourceViews);
+        void RecordResourceHeapWrite(const ResourceHeap& resourceHeap, std::uint32_t firstDescriptor, const ArrayView<ResourceViewDescriptor>& resourceViews);
+        void RecordRenderPass(const RenderPass& renderPass, const RenderPassDescriptor& renderPassDesc);
+        void RecordRenderTarget(const RenderTarget& renderTarget, const RenderTargetDescriptor& renderTargetDesc);
+
+        // Stops tracking the specified object. This must be called before the object is released.
+        void ReleaseObject(const void* object);
+
+        /* ----- Frame events ----- */
+
+        void RecordBufferWrite(const Buffer& buffer, std::uint64_t offset, const void* data, std::uint64_t dataSize);
+        void RecordTextureWrite(const Texture& texture, const TextureRegion& textureRegion, const ImageView& srcImageView);
+
+        // Records the buffer range that is mapped for writing, so its content can be recorded when the buffer is unmapped.
+        void RecordBufferMapping(const Buffer& buffer, std::uint64_t offset, std::uint64_t length, void* mappedData);
+        void RecordBufferUnmapping(const Buffer& buffer);
+
+        // Appends the command stream of the specified encoder as submission of the specified command buffer.
+        void RecordSubmit(const CommandBuffer& commandBuffer, const DbgFrameCaptureEncoder& encoder);
+
+        // Counts an API call that cannot be captured.
+        void RecordSkipped();
+
+        // Ends the current capture on the specified presentation and starts a new one if the debugger has requested it.
+        // The pipeline manifest is also written here if the debugger has requested it.
+        void OnPresent(const SwapChain& swapChain, RenderingDebugger* debugger);
+
+    private:
+
+        // Tracked object with its serialized creation record payload.
+        struct TrackedObject
+        {
+            FrameCaptureRecordType  type        = FrameCaptureRecordType(0);
+            Resource*               resource    = nullptr;  // Buffer or texture whose content is captured.
+            std::vector<char>       desc;                   // Serialized descriptor.
+            std::vector<char>       content;                // Initial data of buffers and textures.
+            std::vector<char>       updates;                // Subsequent records, e.g. resource heap writes.
+            bool                    released    = false;
+        };
+
+        struct MappedRange
+        {
+            std::uint64_t   offset      = 0;
+            std::uint64_t   length      = 0;
+            const void*     data        = nullptr;
+        };
+
+    private:
+
+        // Assigns a new ID to the specified object and returns its record. This must be called with the mutex locked.
+        TrackedObject& TrackObject(const void* object, const FrameCaptureRecordType type);
+
+        std::uint32_t GetIDUnsynchronized(const void* object) const;
+
+        // Appends a record header and its payload to the specified output.
+        void AppendRecord(std::vector<char>& output, const FrameCaptureRecordType type, std::uint32_t id, const void* payload, std::size_t payloadSize);
+
+        void WriteResourceViews(std::vector<char>& output, const ArrayView<ResourceViewDescriptor>& resourceViews);
+        void WriteTextureWrite(std::vector<char>& output, const TextureRegion& textureRegion, const ImageView& imageView);
+
+        void BeginCapture(const char* filename);
+        void EndCapture();
+
+        void ReadBufferContent(TrackedObject& object);
+        void ReadTextureContent(std::uint32_t id, TrackedObject& object);
+
+        bool WriteCaptureFile();
+
+        // Keeps the record of the specified released PSO for the pipeline manifest unless an identical record is already kept.
+        void KeepReleasedPipeline(std::uint32_t id, TrackedObject&& object);
+
+        bool WritePipelineManifest(const char* filename);
+
+    private:
+
+        RenderSystem&                                       renderSystemInstance_;
+
+        mutable std::mutex                                  mutex_;
+        std::unordered_map<const void*, std::uint32_t>      ids_;
+        std::map<std::uint32_t, TrackedObject>              objects_;           // Tracked objects in creation order.
+        std::unordered_map<const void*, MappedRange>        mappedRanges_;
+        std::uint32_t                                       nextID_             = 1;
+
+        std::unordered_map<std::uint64_t, std::uint32_t>    shaderIDs_;         // Shader IDs by hash of their serialized descriptors.
+        std::map<std::uint32_t, TrackedObject>              releasedPipelines_; // Records of released PSOs for the pipeline manifest.
+        std::unordered_map<std::uint64_t, std::uint32_t>    releasedPipelineIDs_;
+
+        std::atomic<bool>                                   isCapturing_;
+        std::string                                         captureFilename_;
+        std::vector<char>                                   snapshot_;          // Records of texture contents at the beginning of the capture.
+        std::vector<char>                                   frame_;             // Records of the captured frame.
+        std::uint32_t                                       numSkipped_         = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,59 @@
+/*
+ * DbgMemoryProfile.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "DbgMemoryProfile.h"
+#include "../ResourceUtils.h"
+#include <LLGL/RenderSystem.h>
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+// Maximum number of memory heaps that are captured per frame; Vulkan reports at most VK_MAX_MEMORY_HEAPS (16).
+static constexpr std::uint32_t g_maxNumMemoryHeaps = 32;
+
+void DbgRecordBufferMapping(ProfileMemoryRecord& record, const CPUAccess access, std::uint64_t length)
+{
+    if (HasReadAccess(access))
+        record.readbackBytes += length;
+    if (HasWriteAccess(access))
+        record.uploadedBytes += length;
+}
+
+void DbgRecordMemoryUsage(ProfileMemoryRecord& record, RenderSystem& renderSystem)
+{
+    MemoryHeapInfo heapInfos[g_maxNumMemoryHeaps];
+    const std::uint32_t numHeaps = std::min(renderSystem.QueryMemoryHeaps(heapInfos, g_maxNumMemoryHeaps), g_maxNumMemoryHeaps);
+
+    for_range(i, numHeaps)
+    {
+        const MemoryHeapInfo& heapInfo = heapInfos[i];
+        if (heapInfo.deviceLocal)
+            record.deviceMemoryUsage += heapInfo.usage;
+        else
+            record.hostMemoryUsage += heapInfo.usage;
+        record.stagingMemoryUsage += heapInfo.stagingUsage;
+    }
+}
+
+void DbgRecordHeapAllocations(ProfileMemoryRecord& record, AllocatorStatistics& prevStats)
+{
+    const AllocatorStatistics stats = GetAllocatorStatistics();
+    record.heapAllocations      += stats.numAllocations - prevStats.numAllocations;
+    record.heapAllocatedBytes   += stats.allocatedBytes - prevStats.allocatedBytes;
+    prevStats = stats;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,41 @@
+/*
+ * DbgMemoryProfile.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_DBG_MEMORY_PROFILE_H
+#define LLGL_DBG_MEMORY_PROFILE_H
+
+
+#include <LLGL/RenderingDebuggerFlags.h>
+#include <LLGL/RenderSystemFlags.h>
+#include <LLGL/Container/Allocator.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class RenderSystem;
+
+// Accumulates the number of bytes that are transferred by mapping a buffer range with the specified CPU access.
+void DbgRecordBufferMapping(ProfileMemoryRecord& record, const CPUAccess access, std::uint64_t length);
+
+// Stores a snapshot of the memory heap usage of the specified render system in the memory record.
+void DbgRecordMemoryUsage(ProfileMemoryRecord& record, RenderSystem& renderSystem);
+
+// Stores the number of LLGL-internal heap allocations since the previous statistics in the memory record and updates the previous statistics.
+void DbgRecordHeapAllocations(ProfileMemoryRecord& record, AllocatorStatistics& prevStats);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,158 @@
+/*
+ * DbgPassQueryResolver.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "DbgPassQueryResolver.h"
+#include <LLGL/CommandQueue.h>
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+// Maximum number of frames a batch is kept pending before it is discarded.
+static constexpr std::uint64_t g_maxPassQueryLatency = 16;
+
+constexpr std::uint32_t DbgPassQueryResolver::queryHeapSize;
+
+static void AccumulatePipelineStatistics(QueryPipelineStatistics& dst, const QueryPipelineStatistics& src)
+{
+    dst.inputAssemblyVertices           += src.inputAssemblyVertices;
+    dst.inputAssemblyPrimitives         += src.inputAssemblyPrimitives;
+    dst.vertexShaderInvocations         += src.vertexShaderInvocations;
+    dst.geometryShaderInvocations       += src.geometryShaderInvocations;
+    dst.geometryShaderPrimitives        += src.geometryShaderPrimitives;
+    dst.clippingInvocations             += src.clippingInvocations;
+    dst.clippingPrimitives              += src.clippingPrimitives;
+    dst.fragmentShaderInvocations       += src.fragmentShaderInvocations;
+    dst.tessControlShaderInvocations    += src.tessControlShaderInvocations;
+    dst.tessEvaluationShaderInvocations += src.tessEvaluationShaderInvocations;
+    dst.computeShaderInvocations        += src.computeShaderInvocations;
+}
+
+QueryHeap* DbgPassQueryResolver::TakeQueryHeap(const QueryType type)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    std::vector<QueryHeap*>& freeHeaps = (type == QueryType::TimeElapsed ? freeTimerHeaps_ : freeStatisticsHeaps_);
+    if (freeHeaps.empty())
+        return nullptr;
+
+    QueryHeap* queryHeap = freeHeaps.back();
+    freeHeaps.pop_back();
+    return queryHeap;
+}
+
+void DbgPassQueryResolver::RecycleQueryHeaps(DbgPassQueryBatch& batch)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    RecycleQueryHeapsUnsynchronized(batch);
+}
+
+void DbgPassQueryResolver::Enqueue(DbgPassQueryBatch&& batch)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    batch.frame = frame_;
+    pendingBatches_.push_back(std::move(batch));
+}
+
+void DbgPassQueryResolver::Resolve(DynamicVector<ProfilePassRecord>& outRecords)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    for (auto it = pendingBatches_.begin(); it != pendingBatches_.end();)
+    {
+        DbgPassQueryBatch& batch = *it;
+        if (ResolveBatch(batch))
+        {
+            const std::uint32_t frameLatency = static_cast<std::uint32_t>(frame_ - batch.frame);
+            for (ProfilePassRecord& record : batch.records)
+                record.frameLatency = frameLatency;
+            outRecords.insert(outRecords.end(), batch.records.begin(), batch.records.end());
+            RecycleQueryHeapsUnsynchronized(batch);
+            it = pendingBatches_.erase(it);
+        }
+        else if (frame_ - batch.frame >= g_maxPassQueryLatency)
+        {
+            /*
+            Discard batches whose results never become available, e.g. when the command buffer was submitted but never executed.
+            Their query heaps are not recycled, since the GPU might still write into them.
+            */
+            it = pendingBatches_.erase(it);
+        }
+        else
+            ++it;
+    }
+
+    ++frame_;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool DbgPassQueryResolver::ResolveBatch(DbgPassQueryBatch& batch)
+{
+    const std::uint32_t numSegments = static_cast<std::uint32_t>(batch.segments.size());
+
+    /* Read all timer query results; a range of queries is only returned if all of them are available */
+    if (!batch.timerHeaps.empty())
+    {
+        elapsedTimes_.resize(numSegments);
+        for_range(i, batch.timerHeaps.size())
+        {
+            const std::uint32_t firstSegment    = static_cast<std::uint32_t>(i) * queryHeapSize;
+            const std::uint32_t numQueries      = std::min(numSegments - firstSegment, queryHeapSize);
+            if (!batch.commandQueue->QueryResult(*batch.timerHeaps[i], 0, numQueries, &elapsedTimes_[firstSegment], numQueries * sizeof(std::uint64_t)))
+                return false;
+        }
+    }
+
+    /* Read all pipeline statistics query results */
+    if (!batch.statisticsHeaps.empty())
+    {
+        pipelineStatistics_.resize(numSegments);
+        for_range(i, batch.statisticsHeaps.size())
+        {
+            const std::uint32_t firstSegment    = static_cast<std::uint32_t>(i) * queryHeapSize;
+            const std::uint32_t numQueries      = std::min(numSegments - firstSegment, queryHeapSize);
+            if (!batch.commandQueue->QueryResult(*batch.statisticsHeaps[i], 0, numQueries, &pipelineStatistics_[firstSegment], numQueries * sizeof(QueryPipelineStatistics)))
+                return false;
+        }
+    }
+
+    /* Accumulate results of each segment into its pass and all enclosing passes */
+    for_range(i, numSegments)
+    {
+        for (std::uint32_t pass = batch.segments[i]; pass != ~0u; pass = batch.parents[pass])
+        {
+            ProfilePassRecord& record = batch.records[pass];
+            if (!batch.timerHeaps.empty())
+                record.elapsedTime += elapsedTimes_[i];
+            if (!batch.statisticsHeaps.empty())
+                AccumulatePipelineStatistics(record.pipelineStatistics, pipelineStatistics_[i]);
+        }
+    }
+
+    return true;
+}
+
+void DbgPassQueryResolver::RecycleQueryHeapsUnsynchronized(DbgPassQueryBatch& batch)
+{
+    freeTimerHeaps_.insert(freeTimerHeaps_.end(), batch.timerHeaps.begin(), batch.timerHeaps.end());
+    freeStatisticsHeaps_.insert(freeStatisticsHeaps_.end(), batch.statisticsHeaps.begin(), batch.statisticsHeaps.end());
+    batch = DbgPassQueryBatch{};
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,90 @@
+/*
+ * DbgPassQueryResolver.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_DBG_PASS_QUERY_RESOLVER_H
+#define LLGL_DBG_PASS_QUERY_RESOLVER_H
+
+
+#include <LLGL/ForwardDecls.h>
+#include <LLGL/QueryHeapFlags.h>
+#include <LLGL/RenderingDebuggerFlags.h>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+// Pass records and query heaps of a single command buffer submission whose queries have not been resolved yet.
+struct DbgPassQueryBatch
+{
+    CommandQueue*                       commandQueue    = nullptr;
+    std::uint64_t                       frame           = 0;        // Frame index when this batch was submitted; set by DbgPassQueryResolver.
+    DynamicVector<ProfilePassRecord>    records;
+    std::vector<std::uint32_t>          parents;                    // Index of the enclosing pass record for each record or ~0u for outermost passes.
+    std::vector<std::uint32_t>          segments;                   // Index of the innermost pass record for each query segment. The N-th segment corresponds to the N-th query.
+    std::vector<QueryHeap*>             timerHeaps;                 // Query heaps of type QueryType::TimeElapsed; empty if elapsed times come from time records.
+    std::vector<QueryHeap*>             statisticsHeaps;            // Query heaps of type QueryType::PipelineStatistics; empty if pipeline statistics are not supported.
+};
+
+/*
+Shared pool of pass query heaps and queue of submitted pass query batches for all command buffers of a render system.
+Batches are resolved once per frame without waiting for the GPU; their query heaps are recycled once all results have been read.
+*/
+class DbgPassQueryResolver
+{
+
+    public:
+
+        // Number of queries per query heap.
+        static constexpr std::uint32_t queryHeapSize = 64;
+
+    public:
+
+        // Returns a recycled query heap of the specified type or null if there is none.
+        QueryHeap* TakeQueryHeap(const QueryType type);
+
+        // Returns the query heaps of the specified batch to this pool and clears the batch.
+        void RecycleQueryHeaps(DbgPassQueryBatch& batch);
+
+        // Enqueues the specified batch for resolution. This is called when a command buffer is submitted.
+        void Enqueue(DbgPassQueryBatch&& batch);
+
+        // Moves the records of all batches whose queries are available into the output container. This is called once per frame.
+        void Resolve(DynamicVector<ProfilePassRecord>& outRecords);
+
+    private:
+
+        // Reads the results of all queries of the specified batch and returns false if any of them is not available yet.
+        bool ResolveBatch(DbgPassQueryBatch& batch);
+
+        void RecycleQueryHeapsUnsynchronized(DbgPassQueryBatch& batch);
+
+    private:
+
+        std::mutex                              mutex_;
+        std::vector<QueryHeap*>                 freeTimerHeaps_;
+        std::vector<QueryHeap*>                 freeStatisticsHeaps_;
+        std::vector<DbgPassQueryBatch>          pendingBatches_;
+        std::uint64_t                           frame_                  = 0;
+
+        std::vector<std::uint64_t>              elapsedTimes_;          // Intermediate storage for timer query results.
+        std::vector<QueryPipelineStatistics>    pipelineStatistics_;    // Intermediate storage for pipeline statistics query results.
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
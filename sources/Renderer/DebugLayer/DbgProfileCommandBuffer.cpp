@@ -0,0 +1,868 @@
+/*
+ * DbgProfileCommandBuffer.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "DbgProfileCommandBuffer.h"
+#include "DbgProfileSwapChain.h"
+#include "DbgSharedProfile.h"
+#include "DbgFrameCapture.h"
+#include "../CheckedCast.h"
+#include "../../Core/CoreUtils.h"
+#include <LLGL/Buffer.h>
+#include <LLGL/Texture.h>
+#include <LLGL/TypeInfo.h>
+#include <LLGL/Utils/ForRange.h>
+
+
+namespace LLGL
+{
+
+
+#define LLGL_DBG_PROFILE_COMMAND(NAME, CMD) \
+    if (perfProfilerEnabled_)               \
+    {                                       \
+        StartTimer(NAME);                   \
+        CMD;                                \
+        EndTimer();                         \
+    }                                       \
+    else                                    \
+    {                                       \
+        CMD;                                \
+    }
+
+// Encodes the specified command into the frame capture if this command buffer is being captured.
+#define LLGL_DBG_CAPTURE_COMMAND(CMD)                           \
+    if (captureEncoder_ && captureEncoder_->IsEncoding())       \
+        captureEncoder_->CMD
+
+DbgProfileCommandBuffer::DbgProfileCommandBuffer(
+    RenderSystem&                   renderSystemInstance,
+    CommandQueue&                   commandQueueInstance,
+    CommandBuffer&                  commandBufferInstance,
+    RenderingDebugger*              debugger,
+    DbgSharedProfile&               sharedProfile,
+    DbgPassQueryResolver&           passQueryResolver,
+    DbgFrameCapture*                frameCapture,
+    const CommandBufferDescriptor&  desc)
+:
+    instance        { commandBufferInstance                                                                },
+    flags           { desc.flags                                                                           },
+    debugger_       { debugger                                                                             },
+    sharedProfile_  { sharedProfile                                                                        },
+    frameCapture_   { frameCapture                                                                         },
+    queryTimerPool_ { renderSystemInstance, commandQueueInstance, commandBufferInstance, passQueryResolver }
+{
+    if (frameCapture != nullptr)
+        captureEncoder_ = MakeUnique<DbgFrameCaptureEncoder>(*frameCapture);
+}
+
+DbgProfileCommandBuffer::~DbgProfileCommandBuffer()
+{
+    // dummy
+}
+
+/* ----- Encoding ----- */
+
+void DbgProfileCommandBuffer::Begin()
+{
+    /* Enable performance timer if it was scheduled */
+    perfProfilerEnabled_ = (debugger_ != nullptr && debugger_->GetTimeRecording());
+    if (perfProfilerEnabled_)
+        queryTimerPool_.Reset();
+
+    /* Enable pass queries if they were scheduled */
+    passProfilerEnabled_ = (debugger_ != nullptr && debugger_->GetPassRecording());
+    if (passProfilerEnabled_)
+        queryTimerPool_.BeginPassRecording(perfProfilerEnabled_);
+
+    pendingPipelineBinding_ = false;
+
+    /* Start encoding into the frame capture if a capture is active */
+    if (captureEncoder_)
+        captureEncoder_->Begin();
+
+    instance.Begin();
+
+    profile_.commandBufferRecord.encodings++;
+}
+
+void DbgProfileCommandBuffer::End()
+{
+    if (passProfilerEnabled_)
+        queryTimerPool_.EndPassRecording();
+
+    instance.End();
+
+    LLGL_DBG_CAPTURE_COMMAND( End() );
+
+    if ((flags & CommandBufferFlags::ImmediateSubmit) != 0)
+    {
+        RecordCaptureSubmit();
+
+        /* Merge locally accumulated profile into shared profile */
+        FrameProfile profile;
+        FlushProfile(profile);
+        SubmitPassRecords(sharedProfile_.MergeSubmission(profile));
+    }
+}
+
+void DbgProfileCommandBuffer::Execute(CommandBuffer& deferredCommandBuffer)
+{
+    auto& commandBufferProf = LLGL_CAST(DbgProfileCommandBuffer&, deferredCommandBuffer);
+    LLGL_DBG_PROFILE_COMMAND( "Execute", instance.Execute(commandBufferProf.instance) );
+    LLGL_DBG_CAPTURE_COMMAND( Skip() );
+}
+
+/* ----- Blitting ----- */
+
+void DbgProfileCommandBuffer::UpdateBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint64_t dataSize)
+{
+    LLGL_DBG_PROFILE_COMMAND( "UpdateBuffer", instance.UpdateBuffer(dstBuffer, dstOffset, data, dataSize) );
+    LLGL_DBG_CAPTURE_COMMAND( UpdateBuffer(dstBuffer, dstOffset, data, dataSize) );
+    profile_.commandBufferRecord.bufferUpdates++;
+    profile_.memoryRecord.uploadedBytes += dataSize;
+}
+
+void DbgProfileCommandBuffer::CopyBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, Buffer& srcBuffer, std::uint64_t srcOffset, std::uint64_t size)
+{
+    LLGL_DBG_PROFILE_COMMAND( "CopyBuffer", instance.CopyBuffer(dstBuffer, dstOffset, srcBuffer, srcOffset, size) );
+    LLGL_DBG_CAPTURE_COMMAND( CopyBuffer(dstBuffer, dstOffset, srcBuffer, srcOffset, size) );
+    profile_.commandBufferRecord.bufferCopies++;
+}
+
+void DbgProfileCommandBuffer::CopyBuffer(Buffer& dstBuffer, Buffer& srcBuffer, const ArrayView<BufferCopyRegion>& regions)
+{
+    LLGL_DBG_PROFILE_COMMAND( "CopyBuffer", instance.CopyBuffer(dstBuffer, srcBuffer, regions) );
+    if (captureEncoder_ && captureEncoder_->IsEncoding())
+    {
+        /* Record multi-region copies as individual copies, so the capture format remains unchanged */
+        for (const BufferCopyRegion& region : regions)
+            captureEncoder_->CopyBuffer(dstBuffer, region.dstOffset, srcBuffer, region.srcOffset, region.size);
+    }
+    profile_.commandBufferRecord.bufferCopies += static_cast<std::uint32_t>(regions.size());
+}
+
+void DbgProfileCommandBuffer::CopyBufferFromTexture(
+    Buffer&                 dstBuffer,
+    std::uint64_t           dstOffset,
+    Texture&                srcTexture,
+    const TextureRegion&    srcRegion,
+    std::uint32_t           rowStride,
+    std::uint32_t           layerStride)
+{
+    LLGL_DBG_PROFILE_COMMAND( "CopyBufferFromTexture", instance.CopyBufferFromTexture(dstBuffer, dstOffset, srcTexture, srcRegion, rowStride, layerStride) );
+    LLGL_DBG_CAPTURE_COMMAND( CopyBufferFromTexture(dstBuffer, dstOffset, srcTexture, srcRegion, rowStride, layerStride) );
+    profile_.commandBufferRecord.bufferCopies++;
+}
+
+void DbgProfileCommandBuffer::FillBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, std::uint32_t value, std::uint64_t fillSize)
+{
+    LLGL_DBG_PROFILE_COMMAND( "FillBuffer", instance.FillBuffer(dstBuffer, dstOffset, value, fillSize) );
+    LLGL_DBG_CAPTURE_COMMAND( FillBuffer(dstBuffer, dstOffset, value, fillSize) );
+    profile_.commandBufferRecord.bufferFills++;
+}
+
+void DbgProfileCommandBuffer::CopyTexture(
+    Texture&                dstTexture,
+    const TextureLocation&  dstLocation,
+    Texture&                srcTexture,
+    const TextureLocation&  srcLocation,
+    const Extent3D&         extent)
+{
+    LLGL_DBG_PROFILE_COMMAND( "CopyTexture", instance.CopyTexture(dstTexture, dstLocation, srcTexture, srcLocation, extent) );
+    LLGL_DBG_CAPTURE_COMMAND( CopyTexture(dstTexture, dstLocation, srcTexture, srcLocation, extent) );
+    profile_.commandBufferRecord.textureCopies++;
+}
+
+void DbgProfileCommandBuffer::CopyTexture(
+    Texture&                                dstTexture,
+    Texture&                                srcTexture,
+    const ArrayView<TextureCopyRegion>&     regions)
+{
+    LLGL_DBG_PROFILE_COMMAND( "CopyTexture", instance.CopyTexture(dstTexture, srcTexture, regions) );
+    if (captureEncoder_ && captureEncoder_->IsEncoding())
+    {
+        for (const TextureCopyRegion& region : regions)
+            captureEncoder_->CopyTexture(dstTexture, region.dstLocation, srcTexture, region.srcLocation, region.extent);
+    }
+    profile_.commandBufferRecord.textureCopies += static_cast<std::uint32_t>(regions.size());
+}
+
+void DbgProfileCommandBuffer::CopyTextureFromBuffer(
+    Texture&                dstTexture,
+    const TextureRegion&    dstRegion,
+    Buffer&                 srcBuffer,
+    std::uint64_t           srcOffset,
+    std::uint32_t           rowStride,
+    std::uint32_t           layerStride)
+{
+    LLGL_DBG_PROFILE_COMMAND( "CopyTextureFromBuffer", instance.CopyTextureFromBuffer(dstTexture, dstRegion, srcBuffer, srcOffset, rowStride, layerStride) );
+    LLGL_DBG_CAPTURE_COMMAND( CopyTextureFromBuffer(dstTexture, dstRegion, srcBuffer, srcOffset, rowStride, layerStride) );
+    profile_.commandBufferRecord.textureCopies++;
+}
+
+void DbgProfileCommandBuffer::CopyTextureFromBuffer(
+    Texture&                                    dstTexture,
+    Buffer&                                     srcBuffer,
+    const ArrayView<BufferTextureCopyRegion>&   regions)
+{
+    LLGL_DBG_PROFILE_COMMAND( "CopyTextureFromBuffer", instance.CopyTextureFromBuffer(dstTexture, srcBuffer, regions) );
+    if (captureEncoder_ && captureEncoder_->IsEncoding())
+    {
+        for (const BufferTextureCopyRegion& region : regions)
+            captureEncoder_->CopyTextureFromBuffer(dstTexture, region.textureRegion, srcBuffer, region.bufferOffset, region.rowStride, region.layerStride);
+    }
+    profile_.commandBufferRecord.textureCopies += static_cast<std::uint32_t>(regions.size());
+}
+
+void DbgProfileCommandBuffer::CopyTextureFromFramebuffer(Texture& dstTexture, const TextureRegion& dstRegion, const Offset2D& srcOffset)
+{
+    LLGL_DBG_PROFILE_COMMAND( "CopyTextureFromFramebuffer", instance.CopyTextureFromFramebuffer(dstTexture, dstRegion, srcOffset) );
+    LLGL_DBG_CAPTURE_COMMAND( Skip() );
+    profile_.commandBufferRecord.textureCopies++;
+}
+
+void DbgProfileCommandBuffer::BlitTexture(Texture& dstTexture, const TextureRegion& dstRegion, Texture& srcTexture, const TextureRegion& srcRegion, const SamplerFilter filter)
+{
+    LLGL_DBG_PROFILE_COMMAND( "BlitTexture", instance.BlitTexture(dstTexture, dstRegion, srcTexture, srcRegion, filter) );
+    LLGL_DBG_CAPTURE_COMMAND( Skip() );
+    profile_.commandBufferRecord.textureCopies++;
+}
+
+void DbgProfileCommandBuffer::GenerateMips(Texture& texture)
+{
+    LLGL_DBG_PROFILE_COMMAND( "GenerateMips", instance.GenerateMips(texture) );
+    LLGL_DBG_CAPTURE_COMMAND( GenerateMips(texture, nullptr) );
+    profile_.commandBufferRecord.mipMapsGenerations++;
+}
+
+void DbgProfileCommandBuffer::GenerateMips(Texture& texture, const TextureSubresource& subresource)
+{
+    LLGL_DBG_PROFILE_COMMAND( "GenerateMips", instance.GenerateMips(texture, subresource) );
+    LLGL_DBG_CAPTURE_COMMAND( GenerateMips(texture, &subresource) );
+    profile_.commandBufferRecord.mipMapsGenerations++;
+}
+
+/* ----- Viewport and Scissor ----- */
+
+void DbgProfileCommandBuffer::SetViewport(const Viewport& viewport)
+{
+    LLGL_DBG_PROFILE_COMMAND( "SetViewport", instance.SetViewport(viewport) );
+    LLGL_DBG_CAPTURE_COMMAND( SetViewports(1, &viewport) );
+}
+
+void DbgProfileCommandBuffer::SetViewports(std::uint32_t numViewports, const Viewport* viewports)
+{
+    LLGL_DBG_PROFILE_COMMAND( "SetViewports", instance.SetViewports(numViewports, viewports) );
+    LLGL_DBG_CAPTURE_COMMAND( SetViewports(numViewports, viewports) );
+}
+
+void DbgProfileCommandBuffer::SetScissor(const Scissor& scissor)
+{
+    LLGL_DBG_PROFILE_COMMAND( "SetScissor", instance.SetScissor(scissor) );
+    LLGL_DBG_CAPTURE_COMMAND( SetScissors(1, &scissor) );
+}
+
+void DbgProfileCommandBuffer::SetScissors(std::uint32_t numScissors, const Scissor* scissors)
+{
+    LLGL_DBG_PROFILE_COMMAND( "SetScissors", instance.SetScissors(numScissors, scissors) );
+    LLGL_DBG_CAPTURE_COMMAND( SetScissors(numScissors, scissors) );
+}
+
+/* ----- Buffers ------ */
+
+void DbgProfileCommandBuffer::SetVertexBuffer(Buffer& buffer, std::uint64_t offset)
+{
+    LLGL_DBG_PROFILE_COMMAND( "SetVertexBuffer", instance.SetVertexBuffer(buffer, offset) );
+    if (offset == 0)
+    {
+        LLGL_DBG_CAPTURE_COMMAND( SetVertexBuffer(buffer) );
+    }
+    else
+    {
+        LLGL_DBG_CAPTURE_COMMAND( Skip() );
+    }
+    profile_.commandBufferRecord.vertexBufferBindings++;
+}
+
+void DbgProfileCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
+{
+    LLGL_DBG_PROFILE_COMMAND( "SetVertexBufferArray", instance.SetVertexBufferArray(bufferArray) );
+    LLGL_DBG_CAPTURE_COMMAND( Skip() );
+    profile_.commandBufferRecord.vertexBufferBindings++;
+}
+
+void DbgProfileCommandBuffer::SetVertexBuffers(std::uint32_t firstSlot, std::uint32_t numBuffers, Buffer* const * buffers, const std::uint64_t* offsets)
+{
+    LLGL_DBG_PROFILE_COMMAND( "SetVertexBuffers", instance.SetVertexBuffers(firstSlot, numBuffers, buffers, offsets) );
+    LLGL_DBG_CAPTURE_COMMAND( Skip() );
+    profile_.commandBufferRecord.vertexBufferBindings++;
+}
+
+void DbgProfileCommandBuffer::SetIndexBuffer(Buffer& buffer)
+{
+    LLGL_DBG_PROFILE_COMMAND( "SetIndexBuffer", instance.SetIndexBuffer(buffer) );
+    LLGL_DBG_CAPTURE_COMMAND( SetIndexBuffer(buffer) );
+    profile_.commandBufferRecord.indexBufferBindings++;
+}
+
+void DbgProfileCommandBuffer::SetIndexBuffer(Buffer& buffer, const Format format, std::uint64_t offset)
+{
+    LLGL_DBG_PROFILE_COMMAND( "SetIndexBuffer", instance.SetIndexBuffer(buffer, format, offset) );
+    LLGL_DBG_CAPTURE_COMMAND( SetIndexBuffer(buffer, format, offset) );
+    profile_.commandBufferRecord.indexBufferBindings++;
+}
+
+/* ----- Resources ----- */
+
+void DbgProfileCommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap, std::uint32_t descriptorSet)
+{
+    LLGL_DBG_PROFILE_COMMAND( "SetResourceHeap", instance.SetResourceHeap(resourceHeap, descriptorSet) );
+    LLGL_DBG_CAPTURE_COMMAND( SetResourceHeap(resourceHeap, descriptorSet) );
+    profile_.commandBufferRecord.resourceHeapBindings++;
+}
+
+void DbgProfileCommandBuffer::SetResource(std::uint32_t descriptor, Resource& resource)
+{
+    LLGL_DBG_PROFILE_COMMAND( "SetResource", instance.SetResource(descriptor, resource) );
+    LLGL_DBG_CAPTURE_COMMAND( SetResource(descriptor, resource) );
+    CountResourceBinding(resource);
+}
+
+void DbgProfileCommandBuffer::SetResources(std::uint32_t firstDescriptor, const ArrayView<Resource*>& resources)
+{
+    LLGL_DBG_PROFILE_COMMAND( "SetResources", instance.SetResources(firstDescriptor, resources) );
+    for_range(i, resources.size())
+    {
+        if (Resource* resource = resources[i])
+        {
+            LLGL_DBG_CAPTURE_COMMAND( SetResource(firstDescriptor + static_cast<std::uint32_t>(i), *resource) );
+            CountResourceBinding(*resource);
+        }
+    }
+}
+
+void DbgProfileCommandBuffer::ResetResourceSlots(
+    const ResourceType  resourceType,
+    std::uint32_t       firstSlot,
+    std::uint32_t       numSlots,
+    long                bindFlags,
+    long                stageFlags)
+{
+    LLGL_DBG_PROFILE_COMMAND( "ResetResourceSlots", instance.ResetResourceSlots(resourceType, firstSlot, numSlots, bindFlags, stageFlags) );
+    LLGL_DBG_CAPTURE_COMMAND( Skip() );
+}
+
+void DbgProfileCommandBuffer::ResourceBarrier(std::uint32_t numBarriers, const ResourceBarrierDescriptor* barriers)
+{
+    LLGL_DBG_PROFILE_COMMAND( "ResourceBarrier", instance.ResourceBarrier(numBarriers, barriers) );
+    LLGL_DBG_CAPTURE_COMMAND( Skip() );
+}
+
+/* ----- Render Passes ----- */
+
+void DbgProfileCommandBuffer::BeginRenderPass(
+    RenderTarget&       renderTarget,
+    const RenderPass*   renderPass,
+    std::uint32_t       numClearValues,
+    const ClearValue*   clearValues,
+    std::uint32_t       swapBufferIndex)
+{
+    if (passProfilerEnabled_)
+        queryTimerPool_.InterruptPass();
+
+    /* Swap-chains are the only render targets that are wrapped in the profile-only layer */
+    if (LLGL::IsInstanceOf<SwapChain>(renderTarget))
+    {
+        auto& swapChainProf = LLGL_CAST(DbgProfileSwapChain&, renderTarget);
+        instance.BeginRenderPass(swapChainProf.instance, renderPass, numClearValues, clearValues, swapBufferIndex);
+    }
+    else
+        instance.BeginRenderPass(renderTarget, renderPass, numClearValues, clearValues, swapBufferIndex);
+
+    LLGL_DBG_CAPTURE_COMMAND( BeginRenderPass(renderTarget, renderPass, numClearValues, clearValues, swapBufferIndex) );
+
+    if (passProfilerEnabled_)
+        queryTimerPool_.BeginPass("RenderPass");
+
+    profile_.commandBufferRecord.renderPassSections++;
+}
+
+void DbgProfileCommandBuffer::EndRenderPass()
+{
+    if (passProfilerEnabled_)
+    {
+        queryTimerPool_.InterruptPass();
+        queryTimerPool_.EndPass();
+        instance.EndRenderPass();
+        queryTimerPool_.ResumePass();
+    }
+    else
+        instance.EndRenderPass();
+
+    LLGL_DBG_CAPTURE_COMMAND( EndRenderPass() );
+}
+
+void DbgProfileCommandBuffer::NextSubpass()
+{
+    instance.NextSubpass();
+    LLGL_DBG_CAPTURE_COMMAND( NextSubpass() );
+}
+
+void DbgProfileCommandBuffer::Clear(long flags, const ClearValue& clearValue)
+{
+    LLGL_DBG_PROFILE_COMMAND( "Clear", instance.Clear(flags, clearValue) );
+    LLGL_DBG_CAPTURE_COMMAND( Clear(flags, clearValue) );
+    profile_.commandBufferRecord.attachmentClears++;
+}
+
+void DbgProfileCommandBuffer::ClearAttachments(std::uint32_t numAttachments, const AttachmentClear* attachments)
+{
+    LLGL_DBG_PROFILE_COMMAND( "ClearAttachments", instance.ClearAttachments(numAttachments, attachments) );
+    LLGL_DBG_CAPTURE_COMMAND( ClearAttachments(numAttachments, attachments) );
+    profile_.commandBufferRecord.attachmentClears++;
+}
+
+/* ----- Pipeline States ----- */
+
+void DbgProfileCommandBuffer::SetPipelineState(PipelineState& pipelineState)
+{
+    LLGL_DBG_PROFILE_COMMAND( "SetPipelineState", instance.SetPipelineState(pipelineState) );
+    LLGL_DBG_CAPTURE_COMMAND( SetPipelineState(pipelineState) );
+
+    /* PSO type is not known without wrapping PSOs, so the binding is counted with the next draw or dispatch command */
+    pendingPipelineBinding_ = true;
+}
+
+void DbgProfileCommandBuffer::SetBlendFactor(const float color[4])
+{
+    LLGL_DBG_PROFILE_COMMAND( "SetBlendFactor", instance.SetBlendFactor(color) );
+    LLGL_DBG_CAPTURE_COMMAND( SetBlendFactor(color) );
+}
+
+void DbgProfileCommandBuffer::SetStencilReference(std::uint32_t reference, const StencilFace stencilFace)
+{
+    LLGL_DBG_PROFILE_COMMAND( "SetStencilReference", instance.SetStencilReference(reference, stencilFace) );
+    LLGL_DBG_CAPTURE_COMMAND( SetStencilReference(reference, stencilFace) );
+}
+
+void DbgProfileCommandBuffer::SetShadingRate(const ShadingRate rate)
+{
+    LLGL_DBG_PROFILE_COMMAND( "SetShadingRate", instance.SetShadingRate(rate) );
+    LLGL_DBG_CAPTURE_COMMAND( Skip() );
+}
+
+void DbgProfileCommandBuffer::SetCullMode(const CullMode cullMode)
+{
+    LLGL_DBG_PROFILE_COMMAND( "SetCullMode", instance.SetCullMode(cullMode) );
+    LLGL_DBG_CAPTURE_COMMAND( Skip() );
+}
+
+void DbgProfileCommandBuffer::SetDepthState(const DepthDescriptor& depthDesc)
+{
+    LLGL_DBG_PROFILE_COMMAND( "SetDepthState", instance.SetDepthState(depthDesc) );
+    LLGL_DBG_CAPTURE_COMMAND( Skip() );
+}
+
+void DbgProfileCommandBuffer::SetStencilState(const StencilDescriptor& stencilDesc)
+{
+    LLGL_DBG_PROFILE_COMMAND( "SetStencilState", instance.SetStencilState(stencilDesc) );
+    LLGL_DBG_CAPTURE_COMMAND( Skip() );
+}
+
+void DbgProfileCommandBuffer::SetPrimitiveTopology(const PrimitiveTopology topology)
+{
+    LLGL_DBG_PROFILE_COMMAND( "SetPrimitiveTopology", instance.SetPrimitiveTopology(topology) );
+    LLGL_DBG_CAPTURE_COMMAND( Skip() );
+}
+
+void DbgProfileCommandBuffer::SetUniforms(std::uint32_t first, const void* data, std::uint16_t dataSize)
+{
+    LLGL_DBG_PROFILE_COMMAND( "SetUniforms", instance.SetUniforms(first, data, dataSize) );
+    LLGL_DBG_CAPTURE_COMMAND( SetUniforms(first, data, dataSize) );
+}
+
+/* ----- Queries ----- */
+
+void DbgProfileCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t query)
+{
+    instance.BeginQuery(queryHeap, query);
+    LLGL_DBG_CAPTURE_COMMAND( Skip() );
+    profile_.commandBufferRecord.querySections++;
+}
+
+void DbgProfileCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query)
+{
+    instance.EndQuery(queryHeap, query);
+    LLGL_DBG_CAPTURE_COMMAND( Skip() );
+}
+
+void DbgProfileCommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t query, const RenderConditionMode mode)
+{
+    instance.BeginRenderCondition(queryHeap, query, mode);
+    LLGL_DBG_CAPTURE_COMMAND( Skip() );
+    profile_.commandBufferRecord.renderConditionSections++;
+}
+
+void DbgProfileCommandBuffer::BeginRenderCondition(Buffer& buffer, std::uint64_t offset, const RenderConditionMode mode)
+{
+    instance.BeginRenderCondition(buffer, offset, mode);
+    LLGL_DBG_CAPTURE_COMMAND( Skip() );
+    profile_.commandBufferRecord.renderConditionSections++;
+}
+
+void DbgProfileCommandBuffer::EndRenderCondition()
+{
+    instance.EndRenderCondition();
+    LLGL_DBG_CAPTURE_COMMAND( Skip() );
+}
+
+void DbgProfileCommandBuffer::ResolveQueries(QueryHeap& queryHeap, std::uint32_t firstQuery, std::uint32_t numQueries, Buffer& dstBuffer, std::uint64_t dstOffset)
+{
+    LLGL_DBG_PROFILE_COMMAND( "ResolveQueries", instance.ResolveQueries(queryHeap, firstQuery, numQueries, dstBuffer, dstOffset) );
+    LLGL_DBG_CAPTURE_COMMAND( Skip() );
+}
+
+/* ----- Stream Output ------ */
+
+void DbgProfileCommandBuffer::BeginStreamOutput(std::uint32_t numBuffers, Buffer* const * buffers)
+{
+    instance.BeginStreamOutput(numBuffers, buffers);
+    LLGL_DBG_CAPTURE_COMMAND( Skip() );
+    profile_.commandBufferRecord.streamOutputSections++;
+}
+
+void DbgProfileCommandBuffer::EndStreamOutput()
+{
+    instance.EndStreamOutput();
+    LLGL_DBG_CAPTURE_COMMAND( Skip() );
+}
+
+/* ----- Drawing ----- */
+
+void DbgProfileCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t firstVertex)
+{
+    LLGL_DBG_PROFILE_COMMAND( "Draw", instance.Draw(numVertices, firstVertex) );
+    LLGL_DBG_CAPTURE_COMMAND( Draw(FrameCaptureOpcodeDraw, FrameCaptureCmdDraw{ numVertices, firstVertex, 1, 0 }) );
+    CountPipelineBinding(true);
+    profile_.commandBufferRecord.drawCommands++;
+}
+
+void DbgProfileCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex)
+{
+    LLGL_DBG_PROFILE_COMMAND( "DrawIndexed", instance.DrawIndexed(numIndices, firstIndex) );
+    LLGL_DBG_CAPTURE_COMMAND( DrawIndexed(FrameCaptureOpcodeDrawIndexed, FrameCaptureCmdDrawIndexed{ numIndices, firstIndex, 0, 1, 0 }) );
+    CountPipelineBinding(true);
+    profile_.commandBufferRecord.drawCommands++;
+}
+
+void DbgProfileCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex, std::int32_t vertexOffset)
+{
+    LLGL_DBG_PROFILE_COMMAND( "DrawIndexed", instance.DrawIndexed(numIndices, firstIndex, vertexOffset) );
+    LLGL_DBG_CAPTURE_COMMAND( DrawIndexed(FrameCaptureOpcodeDrawIndexed, FrameCaptureCmdDrawIndexed{ numIndices, firstIndex, vertexOffset, 1, 0 }) );
+    CountPipelineBinding(true);
+    profile_.commandBufferRecord.drawCommands++;
+}
+
+void DbgProfileCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances)
+{
+    LLGL_DBG_PROFILE_COMMAND( "DrawInstanced", instance.DrawInstanced(numVertices, firstVertex, numInstances) );
+    LLGL_DBG_CAPTURE_COMMAND( Draw(FrameCaptureOpcodeDrawInstanced, FrameCaptureCmdDraw{ numVertices, firstVertex, numInstances, 0 }) );
+    CountPipelineBinding(true);
+    profile_.commandBufferRecord.drawCommands++;
+}
+
+void DbgProfileCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances, std::uint32_t firstInstance)
+{
+    LLGL_DBG_PROFILE_COMMAND( "DrawInstanced", instance.DrawInstanced(numVertices, firstVertex, numInstances, firstInstance) );
+    LLGL_DBG_CAPTURE_COMMAND( Draw(FrameCaptureOpcodeDrawInstanced, FrameCaptureCmdDraw{ numVertices, firstVertex, numInstances, firstInstance }) );
+    CountPipelineBinding(true);
+    profile_.commandBufferRecord.drawCommands++;
+}
+
+void DbgProfileCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex)
+{
+    LLGL_DBG_PROFILE_COMMAND( "DrawIndexedInstanced", instance.DrawIndexedInstanced(numIndices, numInstances, firstIndex) );
+    LLGL_DBG_CAPTURE_COMMAND( DrawIndexed(FrameCaptureOpcodeDrawIndexedInstanced, FrameCaptureCmdDrawIndexed{ numIndices, firstIndex, 0, numInstances, 0 }) );
+    CountPipelineBinding(true);
+    profile_.commandBufferRecord.drawCommands++;
+}
+
+void DbgProfileCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset)
+{
+    LLGL_DBG_PROFILE_COMMAND( "DrawIndexedInstanced", instance.DrawIndexedInstanced(numIndices, numInstances, firstIndex, vertexOffset) );
+    LLGL_DBG_CAPTURE_COMMAND( DrawIndexed(FrameCaptureOpcodeDrawIndexedInstanced, FrameCaptureCmdDrawIndexed{ numIndices, firstIndex, vertexOffset, numInstances, 0 }) );
+    CountPipelineBinding(true);
+    profile_.commandBufferRecord.drawCommands++;
+}
+
+void DbgProfileCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance)
+{
+    LLGL_DBG_PROFILE_COMMAND( "DrawIndexedInstanced", instance.DrawIndexedInstanced(numIndices, numInstances, firstIndex, vertexOffset, firstInstance) );
+    LLGL_DBG_CAPTURE_COMMAND( DrawIndexed(FrameCaptureOpcodeDrawIndexedInstanced, FrameCaptureCmdDrawIndexed{ numIndices, firstIndex, vertexOffset, numInstances, firstInstance }) );
+    CountPipelineBinding(true);
+    profile_.commandBufferRecord.drawCommands++;
+}
+
+void DbgProfileCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    LLGL_DBG_PROFILE_COMMAND( "DrawIndirect", instance.DrawIndirect(buffer, offset) );
+    LLGL_DBG_CAPTURE_COMMAND( DrawIndirect(FrameCaptureOpcodeDrawIndirect, buffer, offset, 1, 0) );
+    CountPipelineBinding(true);
+    profile_.commandBufferRecord.drawCommands++;
+}
+
+void DbgProfileCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    LLGL_DBG_PROFILE_COMMAND( "DrawIndirect", instance.DrawIndirect(buffer, offset, numCommands, stride) );
+    LLGL_DBG_CAPTURE_COMMAND( DrawIndirect(FrameCaptureOpcodeDrawIndirect, buffer, offset, numCommands, stride) );
+    CountPipelineBinding(true);
+    profile_.commandBufferRecord.drawCommands += numCommands;
+}
+
+void DbgProfileCommandBuffer::DrawIndirect(
+    Buffer&         buffer,
+    std::uint64_t   offset,
+    Buffer&         countBuffer,
+    std::uint64_t   countBufferOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    LLGL_DBG_PROFILE_COMMAND( "DrawIndirect", instance.DrawIndirect(buffer, offset, countBuffer, countBufferOffset, maxNumCommands, stride) );
+    LLGL_DBG_CAPTURE_COMMAND( DrawIndirect(FrameCaptureOpcodeDrawIndirectCount, buffer, offset, maxNumCommands, stride, &countBuffer, countBufferOffset) );
+    CountPipelineBinding(true);
+    profile_.commandBufferRecord.drawCommands += maxNumCommands;
+}
+
+void DbgProfileCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    LLGL_DBG_PROFILE_COMMAND( "DrawIndexedIndirect", instance.DrawIndexedIndirect(buffer, offset) );
+    LLGL_DBG_CAPTURE_COMMAND( DrawIndirect(FrameCaptureOpcodeDrawIndexedIndirect, buffer, offset, 1, 0) );
+    CountPipelineBinding(true);
+    profile_.commandBufferRecord.drawCommands++;
+}
+
+void DbgProfileCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    LLGL_DBG_PROFILE_COMMAND( "DrawIndexedIndirect", instance.DrawIndexedIndirect(buffer, offset, numCommands, stride) );
+    LLGL_DBG_CAPTURE_COMMAND( DrawIndirect(FrameCaptureOpcodeDrawIndexedIndirect, buffer, offset, numCommands, stride) );
+    CountPipelineBinding(true);
+    profile_.commandBufferRecord.drawCommands += numCommands;
+}
+
+void DbgProfileCommandBuffer::DrawIndexedIndirect(
+    Buffer&         buffer,
+    std::uint64_t   offset,
+    Buffer&         countBuffer,
+    std::uint64_t   countBufferOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    LLGL_DBG_PROFILE_COMMAND( "DrawIndexedIndirect", instance.DrawIndexedIndirect(buffer, offset, countBuffer, countBufferOffset, maxNumCommands, stride) );
+    LLGL_DBG_CAPTURE_COMMAND( DrawIndirect(FrameCaptureOpcodeDrawIndexedIndirectCount, buffer, offset, maxNumCommands, stride, &countBuffer, countBufferOffset) );
+    CountPipelineBinding(true);
+    profile_.commandBufferRecord.drawCommands += maxNumCommands;
+}
+
+void DbgProfileCommandBuffer::DrawStreamOutput()
+{
+    LLGL_DBG_PROFILE_COMMAND( "DrawStreamOutput", instance.DrawStreamOutput() );
+    LLGL_DBG_CAPTURE_COMMAND( Skip() );
+    CountPipelineBinding(true);
+    profile_.commandBufferRecord.drawCommands++;
+}
+
+void DbgProfileCommandBuffer::DrawMesh(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
+{
+    LLGL_DBG_PROFILE_COMMAND( "DrawMesh", instance.DrawMesh(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ) );
+    LLGL_DBG_CAPTURE_COMMAND( DrawMesh(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ) );
+    CountPipelineBinding(true);
+    profile_.commandBufferRecord.drawCommands++;
+}
+
+void DbgProfileCommandBuffer::DrawMeshIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    LLGL_DBG_PROFILE_COMMAND( "DrawMeshIndirect", instance.DrawMeshIndirect(buffer, offset, numCommands, stride) );
+    LLGL_DBG_CAPTURE_COMMAND( DrawIndirect(FrameCaptureOpcodeDrawMeshIndirect, buffer, offset, numCommands, stride) );
+    CountPipelineBinding(true);
+    profile_.commandBufferRecord.drawCommands += numCommands;
+}
+
+/* ----- Compute ----- */
+
+void DbgProfileCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
+{
+    LLGL_DBG_PROFILE_COMMAND( "Dispatch", instance.Dispatch(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ) );
+    LLGL_DBG_CAPTURE_COMMAND( Dispatch(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ) );
+    CountPipelineBinding(false);
+    profile_.commandBufferRecord.dispatchCommands++;
+}
+
+void DbgProfileCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    LLGL_DBG_PROFILE_COMMAND( "DispatchIndirect", instance.DispatchIndirect(buffer, offset) );
+    LLGL_DBG_CAPTURE_COMMAND( DispatchIndirect(buffer, offset) );
+    CountPipelineBinding(false);
+    profile_.commandBufferRecord.dispatchCommands++;
+}
+
+/* ----- Ray Tracing ----- */
+
+void DbgProfileCommandBuffer::BuildAccelerationStructure(const AccelerationStructureBuildDescriptor& buildDesc)
+{
+    LLGL_DBG_PROFILE_COMMAND( "BuildAccelerationStructure", instance.BuildAccelerationStructure(buildDesc) );
+    LLGL_DBG_CAPTURE_COMMAND( Skip() );
+}
+
+void DbgProfileCommandBuffer::CopyAccelerationStructure(Buffer& dst, Buffer& src, const AccelerationStructureCopyMode mode)
+{
+    LLGL_DBG_PROFILE_COMMAND( "CopyAccelerationStructure", instance.CopyAccelerationStructure(dst, src, mode) );
+    LLGL_DBG_CAPTURE_COMMAND( Skip() );
+}
+
+void DbgProfileCommandBuffer::WriteAccelerationStructureCompactedSize(Buffer& src, Buffer& dstBuffer, std::uint64_t dstOffset)
+{
+    LLGL_DBG_PROFILE_COMMAND( "WriteAccelerationStructureCompactedSize", instance.WriteAccelerationStructureCompactedSize(src, dstBuffer, dstOffset) );
+    LLGL_DBG_CAPTURE_COMMAND( Skip() );
+}
+
+/* ----- Debugging ----- */
+
+void DbgProfileCommandBuffer::PushDebugGroup(const char* name)
+{
+    instance.PushDebugGroup(name);
+    LLGL_DBG_CAPTURE_COMMAND( PushDebugGroup(name) );
+    if (perfProfilerEnabled_)
+        queryTimerPool_.PushGroup(name != nullptr ? name : "<null pointer>");
+    if (passProfilerEnabled_)
+        queryTimerPool_.BeginPass(name != nullptr ? name : "<null pointer>");
+}
+
+void DbgProfileCommandBuffer::PopDebugGroup()
+{
+    instance.PopDebugGroup();
+    LLGL_DBG_CAPTURE_COMMAND( PopDebugGroup() );
+    if (perfProfilerEnabled_)
+        queryTimerPool_.PopGroup();
+    if (passProfilerEnabled_)
+        queryTimerPool_.EndPass();
+}
+
+/* ----- Extensions ----- */
+
+void DbgProfileCommandBuffer::DoNativeCommand(const void* nativeCommand, std::size_t nativeCommandSize)
+{
+    LLGL_DBG_PROFILE_COMMAND( "DoNativeCommand", instance.DoNativeCommand(nativeCommand, nativeCommandSize) );
+    LLGL_DBG_CAPTURE_COMMAND( Skip() );
+}
+
+bool DbgProfileCommandBuffer::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
+{
+    return instance.GetNativeHandle(nativeHandle, nativeHandleSize);
+}
+
+/* ----- Internal ----- */
+
+void DbgProfileCommandBuffer::FlushProfile(FrameProfile& outProfile)
+{
+    /* Resolve timer query results for performance profiler once the command buffer has been submitted */
+    if (perfProfilerEnabled_)
+        queryTimerPool_.TakeRecords(profile_.timeRecords);
+
+    outProfile = std::move(profile_);
+    profile_ = {};
+}
+
+void DbgProfileCommandBuffer::SubmitPassRecords(std::uint32_t submissionIndex)
+{
+    /* Hand over pass queries to be resolved in a later frame */
+    if (passProfilerEnabled_)
+        queryTimerPool_.SubmitPassRecords(submissionIndex);
+}
+
+void DbgProfileCommandBuffer::RecordCaptureSubmit()
+{
+    if (frameCapture_ != nullptr && frameCapture_->IsCapturing())
+    {
+        /* Command buffers that were encoded before the capture started can't be replayed */
+        if (captureEncoder_->IsEncoding())
+            frameCapture_->RecordSubmit(*this, *captureEncoder_);
+        else
+            frameCapture_->RecordSkipped();
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void DbgProfileCommandBuffer::StartTimer(const char* annotation)
+{
+    queryTimerPool_.Start(annotation);
+}
+
+void DbgProfileCommandBuffer::EndTimer()
+{
+    queryTimerPool_.Stop();
+}
+
+void DbgProfileCommandBuffer::CountPipelineBinding(bool isGraphicsPSO)
+{
+    if (pendingPipelineBinding_)
+    {
+        if (isGraphicsPSO)
+            profile_.commandBufferRecord.graphicsPipelineBindings++;
+        else
+            profile_.commandBufferRecord.computePipelineBindings++;
+        pendingPipelineBinding_ = false;
+    }
+}
+
+void DbgProfileCommandBuffer::CountResourceBinding(const Resource& resource)
+{
+    switch (resource.GetResourceType())
+    {
+        case ResourceType::Buffer:
+        {
+            const long bindFlags = LLGL_CAST(const Buffer&, resource).GetBindFlags();
+            if ((bindFlags & BindFlags::ConstantBuffer) != 0)
+                profile_.commandBufferRecord.constantBufferBindings++;
+            else if ((bindFlags & BindFlags::Storage) != 0)
+                profile_.commandBufferRecord.storageBufferBindings++;
+            else
+                profile_.commandBufferRecord.sampledBufferBindings++;
+        }
+        break;
+
+        case ResourceType::Texture:
+        {
+            const long bindFlags = LLGL_CAST(const Texture&, resource).GetBindFlags();
+            if ((bindFlags & BindFlags::Storage) != 0)
+                profile_.commandBufferRecord.storageTextureBindings++;
+            else
+                profile_.commandBufferRecord.sampledTextureBindings++;
+        }
+        break;
+
+        case ResourceType::Sampler:
+            profile_.commandBufferRecord.samplerBindings++;
+            break;
+
+        default:
+            break;
+    }
+}
+
+#undef LLGL_DBG_PROFILE_COMMAND
+#undef LLGL_DBG_CAPTURE_COMMAND
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
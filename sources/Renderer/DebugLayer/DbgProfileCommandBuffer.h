@@ -0,0 +1,103 @@
+/*
+ * DbgProfileCommandBuffer.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_DBG_PROFILE_COMMAND_BUFFER_H
+#define LLGL_DBG_PROFILE_COMMAND_BUFFER_H
+
+
+#include <LLGL/CommandBuffer.h>
+#include <LLGL/RenderingDebugger.h>
+#include "DbgQueryTimerPool.h"
+#include <memory>
+
+
+namespace LLGL
+{
+
+
+class DbgSharedProfile;
+class DbgFrameCapture;
+class DbgFrameCaptureEncoder;
+
+/*
+Command buffer wrapper of the profile-only debug layer.
+All commands are forwarded to the wrapped instance without validation; only the profile counters and optional timers are recorded.
+Counters are accumulated locally by the encoding thread and merged into the shared profile when the command buffer is submitted.
+*/
+class DbgProfileCommandBuffer final : public CommandBuffer
+{
+
+    public:
+
+        #include <LLGL/Backend/CommandBuffer.inl>
+
+    public:
+
+        DbgProfileCommandBuffer(
+            RenderSystem&                   renderSystemInstance,
+            CommandQueue&                   commandQueueInstance,
+            CommandBuffer&                  commandBufferInstance,
+            RenderingDebugger*              debugger,
+            DbgSharedProfile&               sharedProfile,
+            DbgPassQueryResolver&           passQueryResolver,
+            DbgFrameCapture*                frameCapture,
+            const CommandBufferDescriptor&  desc
+        );
+
+        ~DbgProfileCommandBuffer();
+
+    public:
+
+        // Moves the locally accumulated profile into the output and resolves all timer queries when the profiler is enabled.
+        void FlushProfile(FrameProfile& outProfile);
+
+        // Moves the pass queries of this command buffer into the shared resolver with the specified submission index.
+        void SubmitPassRecords(std::uint32_t submissionIndex);
+
+        // Appends the encoded commands to the frame capture if a capture is active. This is called when the command buffer is submitted.
+        void RecordCaptureSubmit();
+
+    public:
+
+        CommandBuffer&  instance;
+        const long      flags;
+
+    private:
+
+        void StartTimer(const char* annotation);
+        void EndTimer();
+
+        // Counts the pending pipeline state binding either as graphics or compute PSO binding.
+        void CountPipelineBinding(bool isGraphicsPSO);
+
+        // Counts the binding of the specified resource by its bind flags, since the pipeline layout is not tracked in the profile-only layer.
+        void CountResourceBinding(const Resource& resource);
+
+    private:
+
+        RenderingDebugger*                      debugger_               = nullptr;
+        DbgSharedProfile&                       sharedProfile_;
+        DbgFrameCapture*                        frameCapture_           = nullptr;
+
+        FrameProfile                            profile_;
+        DbgQueryTimerPool                       queryTimerPool_;
+        std::unique_ptr<DbgFrameCaptureEncoder> captureEncoder_;
+        bool                                    perfProfilerEnabled_    = false;
+        bool                                    passProfilerEnabled_    = false;
+        bool                                    pendingPipelineBinding_ = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,121 @@
+/*
+ * DbgProfileCommandQueue.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "DbgProfileCommandQueue.h"
+#include "DbgProfileCommandBuffer.h"
+#include "DbgProfileSwapChain.h"
+#include "DbgSharedProfile.h"
+#include "../CheckedCast.h"
+#include <LLGL/Utils/ForRange.h>
+#include <LLGL/Container/SmallVector.h>
+
+
+namespace LLGL
+{
+
+
+DbgProfileCommandQueue::DbgProfileCommandQueue(CommandQueue& instance, DbgSharedProfile& profile) :
+    instance { instance },
+    profile_ { profile  }
+{
+}
+
+/* ----- Command Buffers ----- */
+
+void DbgProfileCommandQueue::Submit(CommandBuffer& commandBuffer)
+{
+    auto& commandBufferProf = LLGL_CAST(DbgProfileCommandBuffer&, commandBuffer);
+
+    instance.Submit(commandBufferProf.instance);
+    commandBufferProf.RecordCaptureSubmit();
+
+    /* Merge locally accumulated profile of command buffer into shared profile */
+    FrameProfile profile;
+    commandBufferProf.FlushProfile(profile);
+    commandBufferProf.SubmitPassRecords(profile_.MergeSubmission(profile));
+}
+
+/* ----- Presentation ----- */
+
+void DbgProfileCommandQueue::Present(std::uint32_t numSwapChains, SwapChain* const * swapChains)
+{
+    /* Forward swap-chain instances at once, so the backend can still present them in a single operation */
+    SmallVector<SwapChain*, 4> swapChainInstances;
+    swapChainInstances.reserve(numSwapChains);
+
+    for_range(i, numSwapChains)
+    {
+        if (swapChains[i] != nullptr)
+            swapChainInstances.push_back(&(LLGL_CAST(DbgProfileSwapChain*, swapChains[i])->instance));
+    }
+
+    instance.Present(static_cast<std::uint32_t>(swapChainInstances.size()), swapChainInstances.data());
+
+    for_range(i, numSwapChains)
+    {
+        if (swapChains[i] != nullptr)
+            LLGL_CAST(DbgProfileSwapChain*, swapChains[i])->NotifyPresented();
+    }
+}
+
+/* ----- Queries ----- */
+
+bool DbgProfileCommandQueue::QueryResult(QueryHeap& queryHeap, std::uint32_t firstQuery, std::uint32_t numQueries, void* data, std::size_t dataSize)
+{
+    return instance.QueryResult(queryHeap, firstQuery, numQueries, data, dataSize);
+}
+
+bool DbgProfileCommandQueue::QueryTimestampCalibration(TimestampCalibration& outCalibration)
+{
+    return instance.QueryTimestampCalibration(outCalibration);
+}
+
+/* ----- Fences ----- */
+
+void DbgProfileCommandQueue::Submit(Fence& fence)
+{
+    instance.Submit(fence);
+    profile_.Increment(&ProfileCommandQueueRecord::fenceSubmissions);
+}
+
+void DbgProfileCommandQueue::SubmitWait(Fence& fence)
+{
+    instance.SubmitWait(fence);
+}
+
+bool DbgProfileCommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
+{
+    return instance.WaitFence(fence, timeout);
+}
+
+void DbgProfileCommandQueue::Submit(Fence& fence, std::uint64_t value)
+{
+    instance.Submit(fence, value);
+    profile_.Increment(&ProfileCommandQueueRecord::fenceSubmissions);
+}
+
+void DbgProfileCommandQueue::SubmitWait(Fence& fence, std::uint64_t value)
+{
+    instance.SubmitWait(fence, value);
+}
+
+bool DbgProfileCommandQueue::WaitFence(Fence& fence, std::uint64_t value, std::uint64_t timeout)
+{
+    return instance.WaitFence(fence, value, timeout);
+}
+
+void DbgProfileCommandQueue::WaitIdle()
+{
+    instance.WaitIdle();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,53 @@
+/*
+ * DbgProfileCommandQueue.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_DBG_PROFILE_COMMAND_QUEUE_H
+#define LLGL_DBG_PROFILE_COMMAND_QUEUE_H
+
+
+#include <LLGL/CommandQueue.h>
+
+
+namespace LLGL
+{
+
+
+class DbgSharedProfile;
+
+// Command queue wrapper of the profile-only debug layer. This only forwards all calls and merges the profiles of submitted command buffers.
+class DbgProfileCommandQueue final : public CommandQueue
+{
+
+    public:
+
+        #include <LLGL/Backend/CommandQueue.inl>
+
+    public:
+
+        DbgProfileCommandQueue(CommandQueue& instance, DbgSharedProfile& profile);
+
+        void Present(std::uint32_t numSwapChains, SwapChain* const * swapChains) override;
+
+    public:
+
+        CommandQueue& instance;
+
+    private:
+
+        DbgSharedProfile& profile_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,516 @@
+/*
+ * DbgProfileRenderSystem.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "DbgProfileRenderSystem.h"
+#include "DbgMemoryProfile.h"
+#include "../CheckedCast.h"
+#include "../../Core/CoreUtils.h"
+#include <LLGL/Utils/ForRange.h>
+
+
+namespace LLGL
+{
+
+
+/*
+~~~~~~ INFO ~~~~~~
+This is the profile-only debug layer render system.
+It only records the frame profile counters and timers, so it can be used in production builds with low overhead.
+Since resources are not wrapped, all functions that only operate on resources are passed on to the actual render system.
+With RenderSystemFlags::FrameCapture, all objects are also tracked by their descriptors, so a frame can be captured when the debugger requests it.
+*/
+
+DbgProfileRenderSystem::DbgProfileRenderSystem(RenderSystemPtr&& instance, RenderingDebugger* debugger, bool frameCaptureEnabled) :
+    instance_ { std::forward<RenderSystemPtr&&>(instance) },
+    debugger_ { debugger                                  }
+{
+    /* Initialize rendering capabilities from wrapped instance */
+    UpdateRenderingCaps();
+
+    if (frameCaptureEnabled)
+        frameCapture_ = MakeUnique<DbgFrameCapture>(*instance_);
+
+    /* Instantiate command queue if the wrapped instance doesn't wait for a swap-chain to provide one, e.g. in headless mode */
+    if (CommandQueue* queueInstance = instance_->GetCommandQueue())
+        commandQueue_ = MakeUnique<DbgProfileCommandQueue>(*queueInstance, profile_);
+}
+
+void DbgProfileRenderSystem::FlushProfile()
+{
+    profile_.Flush(debugger_, *instance_, passQueryResolver_);
+}
+
+void DbgProfileRenderSystem::OnPresent(SwapChain& swapChain)
+{
+    if (frameCapture_)
+        frameCapture_->OnPresent(swapChain, debugger_);
+    FlushProfile();
+}
+
+/* ----- Swap-chain ----- */
+
+SwapChain* DbgProfileRenderSystem::CreateSwapChain(const SwapChainDescriptor& swapChainDesc, const std::shared_ptr<Surface>& surface)
+{
+    /* Create primary swap-chain */
+    auto* swapChainInstance = instance_->CreateSwapChain(swapChainDesc, surface);
+    if (swapChainInstance == nullptr)
+        return nullptr;
+
+    /* Instantiate command queue if not done and update rendering capabilities from wrapped instance */
+    if (!commandQueue_)
+    {
+        UpdateRenderingCaps();
+        commandQueue_ = MakeUnique<DbgProfileCommandQueue>(*(instance_->GetCommandQueue()), profile_);
+    }
+
+    /* Flush frame profile on SwapChain::Present() calls */
+    auto* swapChainProf = swapChains_.emplace<DbgProfileSwapChain>(*swapChainInstance, std::bind(&DbgProfileRenderSystem::OnPresent, this, std::placeholders::_1));
+
+    if (frameCapture_)
+        frameCapture_->RecordSwapChain(*swapChainProf);
+
+    return swapChainProf;
+}
+
+void DbgProfileRenderSystem::Release(SwapChain& swapChain)
+{
+    if (frameCapture_)
+        frameCapture_->ReleaseObject(&swapChain);
+    ReleaseProf(swapChains_, swapChain);
+}
+
+/* ----- Command queues ----- */
+
+CommandQueue* DbgProfileRenderSystem::GetCommandQueue()
+{
+    return commandQueue_.get();
+}
+
+CommandQueue* DbgProfileRenderSystem::GetCommandQueue(long queueFlags)
+{
+    /* Return wrapper of the primary command queue if the backend has no dedicated queue for the specified type */
+    CommandQueue* queueInstance = instance_->GetCommandQueue(queueFlags);
+    if (queueInstance == nullptr)
+        return nullptr;
+
+    if (commandQueue_ && queueInstance == &(commandQueue_->instance))
+        return commandQueue_.get();
+
+    for (const auto& queue : auxCommandQueues_)
+    {
+        if (queueInstance == &(queue->instance))
+            return queue.get();
+    }
+
+    return auxCommandQueues_.emplace<DbgProfileCommandQueue>(*queueInstance, profile_);
+}
+
+/* ----- Command buffers ----- */
+
+CommandBuffer* DbgProfileRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& commandBufferDesc)
+{
+    CommandBufferDescriptor instanceCommandBufferDesc = commandBufferDesc;
+    {
+        instanceCommandBufferDesc.commandQueue = (commandBufferDesc.commandQueue != nullptr
+                                               ? &(LLGL_CAST(DbgProfileCommandQueue*, commandBufferDesc.commandQueue)->instance)
+                                               : nullptr);
+    }
+    auto* commandBufferProf = commandBuffers_.emplace<DbgProfileCommandBuffer>(
+        *instance_,
+        (instanceCommandBufferDesc.commandQueue != nullptr ? *instanceCommandBufferDesc.commandQueue : commandQueue_->instance),
+        *instance_->CreateCommandBuffer(instanceCommandBufferDesc),
+        debugger_,
+        profile_,
+        passQueryResolver_,
+        frameCapture_.get(),
+        commandBufferDesc
+    );
+
+    if (frameCapture_)
+        frameCapture_->RecordCommandBuffer(*commandBufferProf, commandBufferDesc);
+
+    return commandBufferProf;
+}
+
+void DbgProfileRenderSystem::Release(CommandBuffer& commandBuffer)
+{
+    if (frameCapture_)
+        frameCapture_->ReleaseObject(&commandBuffer);
+    ReleaseProf(commandBuffers_, commandBuffer);
+}
+
+/* ----- Buffers ------ */
+
+Buffer* DbgProfileRenderSystem::CreateBuffer(const BufferDescriptor& bufferDesc, const void* initialData)
+{
+    if (initialData != nullptr)
+        profile_.AddUploadedBytes(bufferDesc.size);
+
+    Buffer* buffer = instance_->CreateBuffer(bufferDesc, initialData);
+    if (frameCapture_ && buffer != nullptr)
+        frameCapture_->RecordBuffer(*buffer, bufferDesc, initialData);
+
+    return buffer;
+}
+
+BufferArray* DbgProfileRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer* const * bufferArray)
+{
+    return instance_->CreateBufferArray(numBuffers, bufferArray);
+}
+
+void DbgProfileRenderSystem::Release(Buffer& buffer)
+{
+    if (frameCapture_)
+        frameCapture_->ReleaseObject(&buffer);
+    instance_->Release(buffer);
+}
+
+void DbgProfileRenderSystem::Release(BufferArray& bufferArray)
+{
+    instance_->Release(bufferArray);
+}
+
+void DbgProfileRenderSystem::WriteBuffer(Buffer& buffer, std::uint64_t offset, const void* data, std::uint64_t dataSize)
+{
+    instance_->WriteBuffer(buffer, offset, data, dataSize);
+    if (frameCapture_ && frameCapture_->IsCapturing())
+        frameCapture_->RecordBufferWrite(buffer, offset, data, dataSize);
+    profile_.Increment(&ProfileCommandQueueRecord::bufferWrites, dataSize);
+}
+
+void DbgProfileRenderSystem::ReadBuffer(Buffer& buffer, std::uint64_t offset, void* data, std::uint64_t dataSize)
+{
+    instance_->ReadBuffer(buffer, offset, data, dataSize);
+    profile_.Increment(&ProfileCommandQueueRecord::bufferReads, 0, dataSize);
+}
+
+void* DbgProfileRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access)
+{
+    void* result = instance_->MapBuffer(buffer, access);
+    IncrementBufferMapping(access, (result != nullptr ? buffer.GetDesc().size : 0));
+    if (frameCapture_ && frameCapture_->IsCapturing() && result != nullptr && access != CPUAccess::ReadOnly)
+        frameCapture_->RecordBufferMapping(buffer, 0, buffer.GetDesc().size, result);
+    return result;
+}
+
+void* DbgProfileRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access, std::uint64_t offset, std::uint64_t length)
+{
+    void* result = instance_->MapBuffer(buffer, access, offset, length);
+    IncrementBufferMapping(access, (result != nullptr ? length : 0));
+    if (frameCapture_ && frameCapture_->IsCapturing() && result != nullptr && access != CPUAccess::ReadOnly)
+        frameCapture_->RecordBufferMapping(buffer, offset, length, result);
+    return result;
+}
+
+void DbgProfileRenderSystem::UnmapBuffer(Buffer& buffer)
+{
+    /* Record the written range before unmapping, since the mapped memory is no longer accessible afterwards */
+    if (frameCapture_)
+        frameCapture_->RecordBufferUnmapping(buffer);
+    instance_->UnmapBuffer(buffer);
+}
+
+/* ----- Textures ----- */
+
+Texture* DbgProfileRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const ImageView* initialImage)
+{
+    if (initialImage != nullptr)
+        profile_.AddUploadedBytes(initialImage->dataSize);
+
+    Texture* texture = instance_->CreateTexture(textureDesc, initialImage);
+    if (frameCapture_ && texture != nullptr)
+        frameCapture_->RecordTexture(*texture, textureDesc, initialImage);
+
+    return texture;
+}
+
+void DbgProfileRenderSystem::Release(Texture& texture)
+{
+    if (frameCapture_)
+        frameCapture_->ReleaseObject(&texture);
+    instance_->Release(texture);
+}
+
+void DbgProfileRenderSystem::WriteTexture(Texture& texture, const TextureRegion& textureRegion, const ImageView& srcImageView)
+{
+    instance_->WriteTexture(texture, textureRegion, srcImageView);
+    if (frameCapture_ && frameCapture_->IsCapturing())
+        frameCapture_->RecordTextureWrite(texture, textureRegion, srcImageView);
+    profile_.Increment(&ProfileCommandQueueRecord::textureWrites, srcImageView.dataSize);
+}
+
+void DbgProfileRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureRegion, const MutableImageView& dstImageView)
+{
+    instance_->ReadTexture(texture, textureRegion, dstImageView);
+    profile_.Increment(&ProfileCommandQueueRecord::textureReads, 0, dstImageView.dataSize);
+}
+
+/* ----- Sampler States ---- */
+
+Sampler* DbgProfileRenderSystem::CreateSampler(const SamplerDescriptor& samplerDesc)
+{
+    Sampler* sampler = instance_->CreateSampler(samplerDesc);
+    if (frameCapture_ && sampler != nullptr)
+        frameCapture_->RecordSampler(*sampler, samplerDesc);
+    return sampler;
+}
+
+void DbgProfileRenderSystem::Release(Sampler& sampler)
+{
+    if (frameCapture_)
+        frameCapture_->ReleaseObject(&sampler);
+    instance_->Release(sampler);
+}
+
+/* ----- Resource Heaps ----- */
+
+ResourceHeap* DbgProfileRenderSystem::CreateResourceHeap(const ResourceHeapDescriptor& resourceHeapDesc, const ArrayView<ResourceViewDescriptor>& initialResourceViews)
+{
+    ResourceHeap* resourceHeap = instance_->CreateResourceHeap(resourceHeapDesc, initialResourceViews);
+    if (frameCapture_ && resourceHeap != nullptr)
+        frameCapture_->RecordResourceHeap(*resourceHeap, resourceHeapDesc, initialResourceViews);
+    return resourceHeap;
+}
+
+void DbgProfileRenderSystem::Release(ResourceHeap& resourceHeap)
+{
+    if (frameCapture_)
+        frameCapture_->ReleaseObject(&resourceHeap);
+    instance_->Release(resourceHeap);
+}
+
+std::uint32_t DbgProfileRenderSystem::WriteResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstDescriptor, const ArrayView<ResourceViewDescriptor>& resourceViews)
+{
+    const std::uint32_t numWritten = instance_->WriteResourceHeap(resourceHeap, firstDescriptor, resourceViews);
+    if (frameCapture_ && numWritten > 0)
+        frameCapture_->RecordResourceHeapWrite(resourceHeap, firstDescriptor, resourceViews);
+    return numWritten;
+}
+
+/* ----- Render Passes ----- */
+
+RenderPass* DbgProfileRenderSystem::CreateRenderPass(const RenderPassDescriptor& renderPassDesc)
+{
+    RenderPass* renderPass = instance_->CreateRenderPass(renderPassDesc);
+    if (frameCapture_ && renderPass != nullptr)
+        frameCapture_->RecordRenderPass(*renderPass, renderPassDesc);
+    return renderPass;
+}
+
+void DbgProfileRenderSystem::Release(RenderPass& renderPass)
+{
+    if (frameCapture_)
+        frameCapture_->ReleaseObject(&renderPass);
+    instance_->Release(renderPass);
+}
+
+/* ----- Render Targets ----- */
+
+RenderTarget* DbgProfileRenderSystem::CreateRenderTarget(const RenderTargetDescriptor& renderTargetDesc)
+{
+    RenderTarget* renderTarget = instance_->CreateRenderTarget(renderTargetDesc);
+    if (frameCapture_ && renderTarget != nullptr)
+        frameCapture_->RecordRenderTarget(*renderTarget, renderTargetDesc);
+    return renderTarget;
+}
+
+void DbgProfileRenderSystem::Release(RenderTarget& renderTarget)
+{
+    if (frameCapture_)
+        frameCapture_->ReleaseObject(&renderTarget);
+    instance_->Release(renderTarget);
+}
+
+/* ----- Shader ----- */
+
+Shader* DbgProfileRenderSystem::CreateShader(const ShaderDescriptor& shaderDesc)
+{
+    Shader* shader = instance_->CreateShader(shaderDesc);
+    if (frameCapture_ && shader != nullptr)
+        frameCapture_->RecordShader(*shader, shaderDesc);
+    return shader;
+}
+
+std::uint32_t DbgProfileRenderSystem::CreateShaders(const ArrayView<ShaderDescriptor>& shaderDescs, Shader** outShaders)
+{
+    const std::uint32_t numShaders = instance_->CreateShaders(shaderDescs, outShaders);
+    if (frameCapture_)
+    {
+        for_range(i, shaderDescs.size())
+        {
+            if (outShaders[i] != nullptr)
+                frameCapture_->RecordShader(*outShaders[i], shaderDescs[i]);
+        }
+    }
+    return numShaders;
+}
+
+void DbgProfileRenderSystem::Release(Shader& shader)
+{
+    if (frameCapture_)
+        frameCapture_->ReleaseObject(&shader);
+    instance_->Release(shader);
+}
+
+/* ----- Pipeline Layouts ----- */
+
+PipelineLayout* DbgProfileRenderSystem::CreatePipelineLayout(const PipelineLayoutDescriptor& pipelineLayoutDesc)
+{
+    PipelineLayout* pipelineLayout = instance_->CreatePipelineLayout(pipelineLayoutDesc);
+    if (frameCapture_ && pipelineLayout != nullptr)
+        frameCapture_->RecordPipelineLayout(*pipelineLayout, pipelineLayoutDesc);
+    return pipelineLayout;
+}
+
+void DbgProfileRenderSystem::Release(PipelineLayout& pipelineLayout)
+{
+    if (frameCapture_)
+        frameCapture_->ReleaseObject(&pipelineLayout);
+    instance_->Release(pipelineLayout);
+}
+
+/* ----- Pipeline Caches ----- */
+
+PipelineCache* DbgProfileRenderSystem::CreatePipelineCache(const Blob& initialBlob)
+{
+    return instance_->CreatePipelineCache(initialBlob);
+}
+
+void DbgProfileRenderSystem::Release(PipelineCache& pipelineCache)
+{
+    instance_->Release(pipelineCache);
+}
+
+/* ----- Pipeline States ----- */
+
+PipelineState* DbgProfileRenderSystem::CreatePipelineState(const GraphicsPipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
+{
+    PipelineState* pipelineState = instance_->CreatePipelineState(pipelineStateDesc, pipelineCache);
+    if (frameCapture_ && pipelineState != nullptr)
+        frameCapture_->RecordPipelineState(*pipelineState, pipelineStateDesc);
+    return pipelineState;
+}
+
+PipelineState* DbgProfileRenderSystem::CreatePipelineState(const ComputePipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
+{
+    PipelineState* pipelineState = instance_->CreatePipelineState(pipelineStateDesc, pipelineCache);
+    if (frameCapture_ && pipelineState != nullptr)
+        frameCapture_->RecordPipelineState(*pipelineState, pipelineStateDesc);
+    return pipelineState;
+}
+
+void DbgProfileRenderSystem::Release(PipelineState& pipelineState)
+{
+    if (frameCapture_)
+        frameCapture_->ReleaseObject(&pipelineState);
+    instance_->Release(pipelineState);
+}
+
+/* ----- Queries ----- */
+
+QueryHeap* DbgProfileRenderSystem::CreateQueryHeap(const QueryHeapDescriptor& queryHeapDesc)
+{
+    return instance_->CreateQueryHeap(queryHeapDesc);
+}
+
+void DbgProfileRenderSystem::Release(QueryHeap& queryHeap)
+{
+    instance_->Release(queryHeap);
+}
+
+/* ----- Fences ----- */
+
+Fence* DbgProfileRenderSystem::CreateFence()
+{
+    return instance_->CreateFence();
+}
+
+void DbgProfileRenderSystem::Release(Fence& fence)
+{
+    instance_->Release(fence);
+}
+
+/* ----- Extensions ----- */
+
+bool DbgProfileRenderSystem::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
+{
+    return instance_->GetNativeHandle(nativeHandle, nativeHandleSize);
+}
+
+std::uint32_t DbgProfileRenderSystem::QueryMemoryHeaps(MemoryHeapInfo* outHeapInfos, std::uint32_t maxNumHeaps)
+{
+    return instance_->QueryMemoryHeaps(outHeapInfos, maxNumHeaps);
+}
+
+std::uint32_t DbgProfileRenderSystem::GetBindlessDescriptorIndex(const Resource& resource, long bindFlags)
+{
+    return instance_->GetBindlessDescriptorIndex(resource, bindFlags);
+}
+
+bool DbgProfileRenderSystem::GetSparseTextureProperties(const Texture& texture, SparseTextureProperties& outProperties)
+{
+    return instance_->GetSparseTextureProperties(texture, outProperties);
+}
+
+bool DbgProfileRenderSystem::CommitTextureTiles(Texture& texture, const TextureRegion& textureRegion, bool commit)
+{
+    return instance_->CommitTextureTiles(texture, textureRegion, commit);
+}
+
+bool DbgProfileRenderSystem::MakeResident(const ArrayView<Resource*>& resources)
+{
+    return instance_->MakeResident(resources);
+}
+
+void DbgProfileRenderSystem::Evict(const ArrayView<Resource*>& resources)
+{
+    instance_->Evict(resources);
+}
+
+bool DbgProfileRenderSystem::GetAccelerationStructureSizes(const AccelerationStructureBuildDescriptor& buildDesc, AccelerationStructureSizes& outSizes)
+{
+    return instance_->GetAccelerationStructureSizes(buildDesc, outSizes);
+}
+
+std::uint64_t DbgProfileRenderSystem::GetAccelerationStructureAddress(const Buffer& buffer)
+{
+    return instance_->GetAccelerationStructureAddress(buffer);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+template <typename T, typename TBase>
+void DbgProfileRenderSystem::ReleaseProf(HWObjectContainer<T>& cont, TBase& entry)
+{
+    auto& entryProf = LLGL_CAST(T&, entry);
+    instance_->Release(entryProf.instance);
+    cont.erase(&entry);
+}
+
+void DbgProfileRenderSystem::UpdateRenderingCaps()
+{
+    /* Store meta data about render system */
+    SetRendererInfo(instance_->GetRendererInfo());
+    SetRenderingCaps(instance_->GetRenderingCaps());
+}
+
+void DbgProfileRenderSystem::IncrementBufferMapping(const CPUAccess access, std::uint64_t length)
+{
+    ProfileMemoryRecord transfers;
+    DbgRecordBufferMapping(transfers, access, length);
+    profile_.Increment(&ProfileCommandQueueRecord::bufferMappings, transfers.uploadedBytes, transfers.readbackBytes);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,86 @@
+/*
+ * DbgProfileRenderSystem.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_DBG_PROFILE_RENDER_SYSTEM_H
+#define LLGL_DBG_PROFILE_RENDER_SYSTEM_H
+
+
+#include <LLGL/RenderSystem.h>
+#include <LLGL/RenderingDebugger.h>
+#include "DbgProfileSwapChain.h"
+#include "DbgProfileCommandBuffer.h"
+#include "DbgProfileCommandQueue.h"
+#include "DbgSharedProfile.h"
+#include "DbgFrameCapture.h"
+#include "../ContainerTypes.h"
+#include <memory>
+
+
+namespace LLGL
+{
+
+
+/*
+Profile-only debug layer render system (see RenderSystemFlags::ProfileOnly).
+In contrast to DbgRenderSystem, only swap-chains, command queues, and command buffers are wrapped.
+All other objects are passed through from the wrapped instance and no arguments are validated.
+*/
+class DbgProfileRenderSystem final : public RenderSystem
+{
+
+    public:
+
+        #include <LLGL/Backend/RenderSystem.inl>
+
+    public:
+
+        DbgProfileRenderSystem(RenderSystemPtr&& instance, RenderingDebugger* debugger, bool frameCaptureEnabled);
+
+        // Moves the accumulated frame profile into the debugger.
+        void FlushProfile();
+
+        // Flushes the frame profile and advances the frame capture. This is called on SwapChain::Present().
+        void OnPresent(SwapChain& swapChain);
+
+    private:
+
+        template <typename T, typename TBase>
+        void ReleaseProf(HWObjectContainer<T>& cont, TBase& entry);
+
+        void UpdateRenderingCaps();
+
+        // Increments the buffer mapping counter and the number of bytes that are transferred by the specified CPU access.
+        void IncrementBufferMapping(const CPUAccess access, std::uint64_t length);
+
+    private:
+
+        /* ----- Common objects ----- */
+
+        RenderSystemPtr                                 instance_;
+        RenderingDebugger*                              debugger_   = nullptr;
+        DbgSharedProfile                                profile_;
+        DbgPassQueryResolver                            passQueryResolver_;
+        std::unique_ptr<DbgFrameCapture>                frameCapture_;      // Only allocated with RenderSystemFlags::FrameCapture.
+
+        /* ----- Hardware object containers ----- */
+
+        HWObjectContainer<DbgProfileSwapChain>          swapChains_;
+        HWObjectInstance<DbgProfileCommandQueue>        commandQueue_;
+        HWObjectContainer<DbgProfileCommandQueue>       auxCommandQueues_;
+        HWObjectContainer<DbgProfileCommandBuffer>      commandBuffers_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
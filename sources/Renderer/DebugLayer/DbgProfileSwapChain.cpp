@@ -0,0 +1,95 @@
+/*
+ * DbgProfileSwapChain.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "DbgProfileSwapChain.h"
+
+
+namespace LLGL
+{
+
+
+DbgProfileSwapChain::DbgProfileSwapChain(SwapChain& instance, const PresentCallback& presentCallback) :
+    instance         { instance        },
+    presentCallback_ { presentCallback }
+{
+    ShareSurfaceAndConfig(instance);
+}
+
+void DbgProfileSwapChain::SetDebugName(const char* name)
+{
+    instance.SetDebugName(name);
+}
+
+void DbgProfileSwapChain::Present()
+{
+    instance.Present();
+    NotifyPresented();
+}
+
+std::uint32_t DbgProfileSwapChain::GetCurrentSwapIndex() const
+{
+    return instance.GetCurrentSwapIndex();
+}
+
+std::uint32_t DbgProfileSwapChain::GetNumSwapBuffers() const
+{
+    return instance.GetNumSwapBuffers();
+}
+
+std::uint32_t DbgProfileSwapChain::GetSamples() const
+{
+    return instance.GetSamples();
+}
+
+Format DbgProfileSwapChain::GetColorFormat() const
+{
+    return instance.GetColorFormat();
+}
+
+Format DbgProfileSwapChain::GetDepthStencilFormat() const
+{
+    return instance.GetDepthStencilFormat();
+}
+
+bool DbgProfileSwapChain::SetVsyncInterval(std::uint32_t vsyncInterval)
+{
+    return instance.SetVsyncInterval(vsyncInterval);
+}
+
+bool DbgProfileSwapChain::SetFramePacing(const FramePacingDescriptor& desc)
+{
+    return instance.SetFramePacing(desc);
+}
+
+const RenderPass* DbgProfileSwapChain::GetRenderPass() const
+{
+    /* Render passes are not wrapped in the profile-only layer */
+    return instance.GetRenderPass();
+}
+
+void DbgProfileSwapChain::NotifyPresented()
+{
+    if (presentCallback_)
+        presentCallback_(*this);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool DbgProfileSwapChain::ResizeBuffersPrimary(const Extent2D& resolution)
+{
+    return instance.ResizeBuffers(resolution);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
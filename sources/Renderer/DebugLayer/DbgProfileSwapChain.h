@@ -0,0 +1,75 @@
+/*
+ * DbgProfileSwapChain.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_DBG_PROFILE_SWAP_CHAIN_H
+#define LLGL_DBG_PROFILE_SWAP_CHAIN_H
+
+
+#include <LLGL/SwapChain.h>
+#include <functional>
+
+
+namespace LLGL
+{
+
+
+// Swap-chain wrapper of the profile-only debug layer. This only forwards all calls and notifies the render system on Present().
+class DbgProfileSwapChain final : public SwapChain
+{
+
+    public:
+
+        using PresentCallback = std::function<void(SwapChain&)>;
+
+    public:
+
+        void SetDebugName(const char* name) override;
+
+        void Present() override;
+
+        std::uint32_t GetCurrentSwapIndex() const override;
+        std::uint32_t GetNumSwapBuffers() const override;
+        std::uint32_t GetSamples() const override;
+
+        Format GetColorFormat() const override;
+        Format GetDepthStencilFormat() const override;
+
+        bool SetVsyncInterval(std::uint32_t vsyncInterval) override;
+        bool SetFramePacing(const FramePacingDescriptor& desc) override;
+
+        const RenderPass* GetRenderPass() const override;
+
+    public:
+
+        DbgProfileSwapChain(SwapChain& instance, const PresentCallback& presentCallback);
+
+        // Invokes the present callback after the swap-chain instance has been presented, either by Present() or CommandQueue::Present().
+        void NotifyPresented();
+
+    public:
+
+        SwapChain& instance;
+
+    private:
+
+        bool ResizeBuffersPrimary(const Extent2D& resolution) override;
+
+    private:
+
+        PresentCallback presentCallback_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -10,8 +10,12 @@
 #include <LLGL/RenderSystem.h>
 #include <LLGL/CommandQueue.h>
 #include <LLGL/QueryHeap.h>
+#include <LLGL/Timer.h>
 #include <LLGL/Utils/ForRange.h>
 #include <thread>
+#include <mutex>
+#include <set>
+#include <string>
 
 
 namespace LLGL
@@ -20,34 +24,65 @@ namespace LLGL
 
 static constexpr std::uint32_t g_queryTimerHeapSize = 64;
 
+// Returns the current CPU time in nanoseconds.
+static std::uint64_t GetCPUTimestamp()
+{
+    return static_cast<std::uint64_t>(static_cast<double>(Timer::Tick()) * 1.0e9 / static_cast<double>(Timer::Frequency()));
+}
+
+// Returns a persistent copy of the specified debug group name, since time records only store a pointer to their annotation.
+static const char* InternGroupName(const char* name)
+{
+    static std::mutex               internMutex;
+    static std::set<std::string>    internedNames;
+    std::lock_guard<std::mutex> guard{ internMutex };
+    return internedNames.insert(name).first->c_str();
+}
+
+static constexpr std::uint32_t g_noPass = ~0u;
+
 DbgQueryTimerPool::DbgQueryTimerPool(
-    RenderSystem&   renderSystemInstance,
-    CommandQueue&   commandQueueInstance,
-    CommandBuffer&  commandBufferInstance)
+    RenderSystem&           renderSystemInstance,
+    CommandQueue&           commandQueueInstance,
+    CommandBuffer&          commandBufferInstance,
+    DbgPassQueryResolver&   passQueryResolver)
 :
-    renderSystem_  { renderSystemInstance  },
-    commandQueue_  { commandQueueInstance  },
-    commandBuffer_ { commandBufferInstance }
+    renderSystem_       { renderSystemInstance  },
+    commandQueue_       { commandQueueInstance  },
+    commandBuffer_      { commandBufferInstance },
+    passQueryResolver_  { passQueryResolver     }
 {
 }
 
 void DbgQueryTimerPool::Reset()
 {
     records_.clear();
+    timedRecords_.clear();
+    groupStack_.clear();
+    groupRecords_.clear();
+    commandPasses_.clear();
     currentQuery_       = 0;
     currentQueryHeap_   = 0;
 }
 
 void DbgQueryTimerPool::Start(const char* annotation)
 {
-    /* Store annotation only first */
+    /* Store annotation and CPU timestamp only first */
     ProfileTimeRecord record;
     {
         record.annotation   = annotation;
         record.elapsedTime  = 0;
+        record.cpuTimestamp = GetCPUTimestamp();
+        record.depth        = static_cast<std::uint32_t>(groupStack_.size());
     }
+    timedRecords_.push_back(records_.size());
+    groupRecords_.push_back(false);
     records_.push_back(record);
 
+    /* Track innermost pass to accumulate the elapsed time of passes from the command timers */
+    if (passRecording_)
+        commandPasses_.push_back(passStack_.empty() ? g_noPass : passStack_.back());
+
     /* Check if end of query heap has been reached */
     if (currentQuery_ == g_queryTimerHeapSize)
     {
@@ -75,14 +110,123 @@ void DbgQueryTimerPool::Stop()
     /* Stop timer query */
     commandBuffer_.EndQuery(*queryHeaps_[currentQueryHeap_], currentQuery_);
 
+    /* Store elapsed CPU time of the current record */
+    ProfileTimeRecord& record = records_[timedRecords_.back()];
+    record.cpuElapsedTime = GetCPUTimestamp() - record.cpuTimestamp;
+
     /* Increase query index */
     ++currentQuery_;
 }
 
+void DbgQueryTimerPool::PushGroup(const char* name)
+{
+    ProfileTimeRecord record;
+    {
+        record.annotation   = InternGroupName(name);
+        record.cpuTimestamp = GetCPUTimestamp();
+        record.depth        = static_cast<std::uint32_t>(groupStack_.size());
+    }
+    groupStack_.push_back(records_.size());
+    groupRecords_.push_back(true);
+    records_.push_back(record);
+}
+
+void DbgQueryTimerPool::PopGroup()
+{
+    if (!groupStack_.empty())
+    {
+        ProfileTimeRecord& record = records_[groupStack_.back()];
+        record.cpuElapsedTime = GetCPUTimestamp() - record.cpuTimestamp;
+        groupStack_.pop_back();
+    }
+}
+
 void DbgQueryTimerPool::TakeRecords(DynamicVector<ProfileTimeRecord>& outRecords)
 {
     ResolveQueryResults();
-    outRecords = std::move(records_);
+    AccumulateGroupTimes();
+    if (passRecording_)
+        AccumulatePassTimes();
+    outRecords.insert(outRecords.end(), records_.begin(), records_.end());
+    Reset();
+}
+
+void DbgQueryTimerPool::BeginPassRecording(bool timeRecording)
+{
+    /* Recycle query heaps and discard records of previous encoding if it was not submitted */
+    passQueryResolver_.RecycleQueryHeaps(passBatch_);
+    passBatch_.commandQueue = &commandQueue_;
+    passStack_.clear();
+    commandPasses_.clear();
+
+    passRecording_          = true;
+    passTimerQueries_       = !timeRecording;
+    passStatisticsQueries_  = renderSystem_.GetRenderingCaps().features.hasPipelineStatistics;
+    passSegmentActive_      = false;
+    passSegmentInterrupted_ = false;
+}
+
+void DbgQueryTimerPool::BeginPass(const char* annotation)
+{
+    StopPassSegment();
+
+    ProfilePassRecord record;
+    {
+        record.annotation   = InternGroupName(annotation);
+        record.depth        = static_cast<std::uint32_t>(passStack_.size());
+    }
+    passBatch_.parents.push_back(passStack_.empty() ? g_noPass : passStack_.back());
+    passStack_.push_back(static_cast<std::uint32_t>(passBatch_.records.size()));
+    passBatch_.records.push_back(record);
+
+    passSegmentInterrupted_ = false;
+    StartPassSegment();
+}
+
+void DbgQueryTimerPool::EndPass()
+{
+    if (!passStack_.empty())
+    {
+        StopPassSegment();
+        passStack_.pop_back();
+        StartPassSegment();
+    }
+}
+
+void DbgQueryTimerPool::InterruptPass()
+{
+    StopPassSegment();
+    passSegmentInterrupted_ = true;
+}
+
+void DbgQueryTimerPool::ResumePass()
+{
+    passSegmentInterrupted_ = false;
+    StartPassSegment();
+}
+
+void DbgQueryTimerPool::EndPassRecording()
+{
+    StopPassSegment();
+    passStack_.clear();
+}
+
+void DbgQueryTimerPool::SubmitPassRecords(std::uint32_t submissionIndex)
+{
+    if (!passRecording_)
+        return;
+
+    /* Pass queries are only resolved for the first submission after each encoding */
+    passRecording_ = false;
+
+    if (passBatch_.records.empty())
+        return;
+
+    for (ProfilePassRecord& record : passBatch_.records)
+        record.commandBuffer = submissionIndex;
+
+    passQueryResolver_.Enqueue(std::move(passBatch_));
+    passBatch_ = DbgPassQueryBatch{};
 }
 
 
@@ -94,9 +238,9 @@ void DbgQueryTimerPool::ResolveQueryResults()
 {
     constexpr int maxAttempts = 100;
 
-    for_range(i, records_.size())
+    for_range(i, timedRecords_.size())
     {
-        ProfileTimeRecord&  rec         = records_[i];
+        ProfileTimeRecord&  rec         = records_[timedRecords_[i]];
         const std::uint32_t query       = static_cast<std::uint32_t>(i % g_queryTimerHeapSize);
         const std::uint32_t heapIndex   = static_cast<std::uint32_t>(i / g_queryTimerHeapSize);
 
@@ -110,6 +254,95 @@ void DbgQueryTimerPool::ResolveQueryResults()
     }
 }
 
+void DbgQueryTimerPool::AccumulateGroupTimes()
+{
+    /* Add elapsed time of each command to all debug groups it is enclosed by */
+    std::vector<std::size_t> enclosingGroups;
+    for_range(i, records_.size())
+    {
+        const ProfileTimeRecord& rec = records_[i];
+        while (!enclosingGroups.empty() && records_[enclosingGroups.back()].depth >= rec.depth)
+            enclosingGroups.pop_back();
+
+        if (groupRecords_[i])
+            enclosingGroups.push_back(i);
+        else
+        {
+            for (std::size_t group : enclosingGroups)
+                records_[group].elapsedTime += rec.elapsedTime;
+        }
+    }
+}
+
+void DbgQueryTimerPool::AccumulatePassTimes()
+{
+    /* Add elapsed time of each command to its innermost pass and all enclosing passes */
+    for_range(i, commandPasses_.size())
+    {
+        const std::uint64_t elapsedTime = records_[timedRecords_[i]].elapsedTime;
+        for (std::uint32_t pass = commandPasses_[i]; pass != g_noPass; pass = passBatch_.parents[pass])
+            passBatch_.records[pass].elapsedTime += elapsedTime;
+    }
+}
+
+void DbgQueryTimerPool::StartPassSegment()
+{
+    if (passStack_.empty() || passSegmentActive_ || passSegmentInterrupted_ || !(passTimerQueries_ || passStatisticsQueries_))
+        return;
+
+    const std::uint32_t segment     = static_cast<std::uint32_t>(passBatch_.segments.size());
+    const std::uint32_t query       = segment % DbgPassQueryResolver::queryHeapSize;
+    const std::uint32_t heapIndex   = segment / DbgPassQueryResolver::queryHeapSize;
+
+    /* Acquire new query heaps when the end of the current ones has been reached */
+    if (query == 0)
+    {
+        if (passTimerQueries_)
+            passBatch_.timerHeaps.push_back(AcquirePassQueryHeap(QueryType::TimeElapsed));
+        if (passStatisticsQueries_)
+            passBatch_.statisticsHeaps.push_back(AcquirePassQueryHeap(QueryType::PipelineStatistics));
+    }
+
+    passBatch_.segments.push_back(passStack_.back());
+
+    if (passTimerQueries_)
+        commandBuffer_.BeginQuery(*passBatch_.timerHeaps[heapIndex], query);
+    if (passStatisticsQueries_)
+        commandBuffer_.BeginQuery(*passBatch_.statisticsHeaps[heapIndex], query);
+
+    passSegmentActive_ = true;
+}
+
+void DbgQueryTimerPool::StopPassSegment()
+{
+    if (!passSegmentActive_)
+        return;
+
+    const std::uint32_t segment     = static_cast<std::uint32_t>(passBatch_.segments.size()) - 1;
+    const std::uint32_t query       = segment % DbgPassQueryResolver::queryHeapSize;
+    const std::uint32_t heapIndex   = segment / DbgPassQueryResolver::queryHeapSize;
+
+    if (passStatisticsQueries_)
+        commandBuffer_.EndQuery(*passBatch_.statisticsHeaps[heapIndex], query);
+    if (passTimerQueries_)
+        commandBuffer_.EndQuery(*passBatch_.timerHeaps[heapIndex], query);
+
+    passSegmentActive_ = false;
+}
+
+QueryHeap* DbgQueryTimerPool::AcquirePassQueryHeap(const QueryType type)
+{
+    if (QueryHeap* queryHeap = passQueryResolver_.TakeQueryHeap(type))
+        return queryHeap;
+
+    QueryHeapDescriptor queryDesc;
+    {
+        queryDesc.type          = type;
+        queryDesc.numQueries    = DbgPassQueryResolver::queryHeapSize;
+    }
+    return renderSystem_.CreateQueryHeap(queryDesc);
+}
+
 
 } // /namespace LLGL
 
@@ -9,6 +9,7 @@
 #define LLGL_DBG_QUERY_TIMER_POOL_H
 
 
+#include "DbgPassQueryResolver.h"
 #include <LLGL/ForwardDecls.h>
 #include <LLGL/RenderingDebugger.h>
 #include <vector>
@@ -24,9 +25,10 @@ class DbgQueryTimerPool
     public:
 
         DbgQueryTimerPool(
-            RenderSystem&   renderSystemInstance,
-            CommandQueue&   commandQueueInstance,
-            CommandBuffer&  commandBufferInstance
+            RenderSystem&           renderSystemInstance,
+            CommandQueue&           commandQueueInstance,
+            CommandBuffer&          commandBufferInstance,
+            DbgPassQueryResolver&   passQueryResolver
         );
 
         // Resets all records in this timer manager.
@@ -38,14 +40,59 @@ class DbgQueryTimerPool
         // Stops measing the time and stores the current record.
         void Stop();
 
-        // Moves the internal records to the specified output container.
+        // Starts a new debug group record. All subsequent records until the next call to PopGroup() are nested within this group.
+        void PushGroup(const char* name);
+
+        // Ends the current debug group record.
+        void PopGroup();
+
+        // Moves the internal records to the end of the specified output container and resets this timer pool.
         void TakeRecords(DynamicVector<ProfileTimeRecord>& outRecords);
 
+        /*
+        Begins recording pass queries for a new command buffer encoding and discards the pass records of a previous encoding that has not been submitted.
+        If time recording is enabled as well, the elapsed time of each pass is accumulated from the command timers instead of separate timer queries.
+        */
+        void BeginPassRecording(bool timeRecording);
+
+        // Begins a new pass record for a render pass or debug group. For render passes, this must be called after the pass has begun.
+        void BeginPass(const char* annotation);
+
+        // Ends the current pass record. For render passes, this must be called before the pass ends.
+        void EndPass();
+
+        // Interrupts the current query segment until the next pass begins or ResumePass() is called, since queries must not cross render pass boundaries.
+        void InterruptPass();
+
+        // Resumes the query segment of the current pass after it was interrupted.
+        void ResumePass();
+
+        // Ends all open passes. This is called when the command buffer encoding ends.
+        void EndPassRecording();
+
+        // Moves the pass records into the shared resolver once the command buffer has been submitted.
+        void SubmitPassRecords(std::uint32_t submissionIndex);
+
     private:
 
         // Resolves all timer values into the output records.
         void ResolveQueryResults();
 
+        // Accumulates the elapsed GPU time of all records within each debug group.
+        void AccumulateGroupTimes();
+
+        // Accumulates the elapsed GPU time of all records within each pass.
+        void AccumulatePassTimes();
+
+        // Begins a new query segment for the current pass. Each segment measures the commands between two pass boundaries.
+        void StartPassSegment();
+
+        // Ends the current query segment.
+        void StopPassSegment();
+
+        // Returns a recycled pass query heap of the specified type or creates a new one.
+        QueryHeap* AcquirePassQueryHeap(const QueryType type);
+
     private:
 
         RenderSystem&                       renderSystem_;
@@ -57,6 +104,19 @@ class DbgQueryTimerPool
         std::uint32_t                       currentQueryHeap_   = 0;
 
         DynamicVector<ProfileTimeRecord>    records_;
+        std::vector<std::size_t>            timedRecords_;      // Indices of records with a timer query. The N-th entry corresponds to the N-th query.
+        std::vector<std::size_t>            groupStack_;        // Indices of records of the currently open debug groups.
+        std::vector<bool>                   groupRecords_;      // Specifies for each record whether it is a debug group.
+
+        DbgPassQueryResolver&               passQueryResolver_;
+        DbgPassQueryBatch                   passBatch_;
+        std::vector<std::uint32_t>          passStack_;         // Indices of pass records of the currently open passes.
+        std::vector<std::uint32_t>          commandPasses_;     // Index of the innermost pass record for each timed record.
+        bool                                passRecording_          = false;
+        bool                                passTimerQueries_       = false;
+        bool                                passStatisticsQueries_  = false;
+        bool                                passSegmentActive_      = false;
+        bool                                passSegmentInterrupted_ = false;
 
 };
 
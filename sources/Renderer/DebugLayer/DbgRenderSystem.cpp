@@ -8,16 +8,19 @@
 #include "DbgRenderSystem.h"
 #include "DbgCore.h"
 #include "DbgReportUtils.h"
+#include "DbgMemoryProfile.h"
 #include "../BufferUtils.h"
 #include "../TextureUtils.h"
 #include "../CheckedCast.h"
 #include "../RenderTargetUtils.h"
+#include "../RenderPassUtils.h"
 #include "../../Core/CoreUtils.h"
 #include "../../Core/StringUtils.h"
 #include <LLGL/ImageFlags.h>
 #include <LLGL/Constants.h>
 #include <LLGL/Utils/TypeNames.h>
 #include <LLGL/Utils/ForRange.h>
+#include <vector>
 
 
 namespace LLGL
@@ -42,13 +45,23 @@ DbgRenderSystem::DbgRenderSystem(RenderSystemPtr&& instance, RenderingDebugger*
 {
     /* Initialize rendering capabilities from wrapped instance */
     UpdateRenderingCaps();
+
+    /* Instantiate command queue if the wrapped instance doesn't wait for a swap-chain to provide one, e.g. in headless mode */
+    if (CommandQueue* queueInstance = instance_->GetCommandQueue())
+        commandQueue_ = MakeUnique<DbgCommandQueue>(*queueInstance, profile_, debugger_);
 }
 
 void DbgRenderSystem::FlushProfile()
 {
     if (debugger_ != nullptr)
+    {
+        DbgRecordMemoryUsage(profile_.memoryRecord, *instance_);
+        DbgRecordHeapAllocations(profile_.memoryRecord, allocatorStats_);
+        passQueryResolver_.Resolve(profile_.passRecords);
         debugger_->RecordProfile(profile_);
+    }
     profile_ = {};
+    validationSampler_.NextFrame();
 }
 
 /* ----- Swap-chain ----- */
@@ -57,6 +70,8 @@ SwapChain* DbgRenderSystem::CreateSwapChain(const SwapChainDescriptor& swapChain
 {
     /* Create primary swap-chain */
     auto* swapChainInstance = instance_->CreateSwapChain(swapChainDesc, surface);
+    if (swapChainInstance == nullptr)
+        return nullptr;
 
     /* Instantiate command queue if not done and update rendering capabilities from wrapped instance */
     if (!commandQueue_)
@@ -81,6 +96,29 @@ CommandQueue* DbgRenderSystem::GetCommandQueue()
     return commandQueue_.get();
 }
 
+CommandQueue* DbgRenderSystem::GetCommandQueue(long queueFlags)
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+        if ((queueFlags & (CommandQueueFlags::Graphics | CommandQueueFlags::Compute | CommandQueueFlags::Copy)) == 0)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot get command queue without any type flags (CommandQueueFlags)");
+    }
+
+    /* Return wrapper of the primary command queue if the backend has no dedicated queue for the specified type */
+    CommandQueue* queueInstance = instance_->GetCommandQueue(queueFlags);
+    if (commandQueue_ && queueInstance == &(commandQueue_->instance))
+        return commandQueue_.get();
+
+    for (const auto& queue : auxCommandQueues_)
+    {
+        if (queueInstance == &(queue->instance))
+            return queue.get();
+    }
+
+    return auxCommandQueues_.emplace<DbgCommandQueue>(*queueInstance, profile_, debugger_);
+}
+
 /* ----- Command buffers ----- */
 
 CommandBuffer* DbgRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& commandBufferDesc)
@@ -94,12 +132,17 @@ CommandBuffer* DbgRenderSystem::CreateCommandBuffer(const CommandBufferDescripto
         instanceCommandBufferDesc.renderPass            = (commandBufferDesc.renderPass != nullptr
                                                         ? &(LLGL_CAST(const DbgRenderPass*, commandBufferDesc.renderPass)->instance)
                                                         : nullptr);
+        instanceCommandBufferDesc.commandQueue          = (commandBufferDesc.commandQueue != nullptr
+                                                        ? &(LLGL_CAST(DbgCommandQueue*, commandBufferDesc.commandQueue)->instance)
+                                                        : nullptr);
     }
     return commandBuffers_.emplace<DbgCommandBuffer>(
         *instance_,
-        commandQueue_->instance,
+        (instanceCommandBufferDesc.commandQueue != nullptr ? *instanceCommandBufferDesc.commandQueue : commandQueue_->instance),
         *instance_->CreateCommandBuffer(instanceCommandBufferDesc),
         profile_,
+        passQueryResolver_,
+        validationSampler_,
         debugger_,
         commandBufferDesc,
         GetRenderingCaps()
@@ -130,6 +173,10 @@ Buffer* DbgRenderSystem::CreateBuffer(const BufferDescriptor& bufferDesc, const
         bufferDbg->elements     = (formatSize > 0 ? bufferDesc.size / formatSize : 0);
         bufferDbg->initialized  = (initialData != nullptr);
     }
+
+    if (initialData != nullptr)
+        profile_.memoryRecord.uploadedBytes += bufferDesc.size;
+
     return bufferDbg;
 }
 
@@ -179,6 +226,9 @@ void DbgRenderSystem::WriteBuffer(Buffer& buffer, std::uint64_t offset, const vo
 
         ValidateBufferBoundary(bufferDbg.desc.size, offset, dataSize);
 
+        if ((bufferDbg.desc.miscFlags & MiscFlags::Readback) != 0)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot write to readback buffer; readback buffers can only be written by copy commands");
+
         if (!data)
             LLGL_DBG_ERROR(ErrorType::InvalidArgument, "illegal null pointer argument for 'data' parameter");
     }
@@ -186,6 +236,7 @@ void DbgRenderSystem::WriteBuffer(Buffer& buffer, std::uint64_t offset, const vo
     instance_->WriteBuffer(bufferDbg.instance, offset, data, dataSize);
 
     profile_.commandQueueRecord.bufferWrites++;
+    profile_.memoryRecord.uploadedBytes += dataSize;
 }
 
 void DbgRenderSystem::ReadBuffer(Buffer& buffer, std::uint64_t offset, void* data, std::uint64_t dataSize)
@@ -207,6 +258,7 @@ void DbgRenderSystem::ReadBuffer(Buffer& buffer, std::uint64_t offset, void* dat
     instance_->ReadBuffer(bufferDbg.instance, offset, data, dataSize);
 
     profile_.commandQueueRecord.bufferReads++;
+    profile_.memoryRecord.readbackBytes += dataSize;
 }
 
 void* DbgRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access)
@@ -223,7 +275,10 @@ void* DbgRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access)
     auto result = instance_->MapBuffer(bufferDbg.instance, access);
 
     if (result != nullptr)
+    {
         bufferDbg.OnMap(access, 0, bufferDbg.desc.size);
+        DbgRecordBufferMapping(profile_.memoryRecord, access, bufferDbg.desc.size);
+    }
 
     profile_.commandQueueRecord.bufferMappings++;
 
@@ -245,7 +300,10 @@ void* DbgRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access, std::ui
     auto result = instance_->MapBuffer(bufferDbg.instance, access, offset, length);
 
     if (result != nullptr)
+    {
         bufferDbg.OnMap(access, offset, length);
+        DbgRecordBufferMapping(profile_.memoryRecord, access, length);
+    }
 
     profile_.commandQueueRecord.bufferMappings++;
 
@@ -276,6 +334,10 @@ Texture* DbgRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, co
         LLGL_DBG_SOURCE();
         ValidateTextureDesc(textureDesc, initialImage);
     }
+
+    if (initialImage != nullptr)
+        profile_.memoryRecord.uploadedBytes += initialImage->dataSize;
+
     return textures_.emplace<DbgTexture>(*instance_->CreateTexture(textureDesc, initialImage), textureDesc);
 }
 
@@ -298,6 +360,7 @@ void DbgRenderSystem::WriteTexture(Texture& texture, const TextureRegion& textur
     instance_->WriteTexture(textureDbg.instance, textureRegion, srcImageView);
 
     profile_.commandQueueRecord.textureWrites++;
+    profile_.memoryRecord.uploadedBytes += srcImageView.dataSize;
 }
 
 void DbgRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureRegion, const MutableImageView& dstImageView)
@@ -314,6 +377,7 @@ void DbgRenderSystem::ReadTexture(Texture& texture, const TextureRegion& texture
     instance_->ReadTexture(textureDbg.instance, textureRegion, dstImageView);
 
     profile_.commandQueueRecord.textureReads++;
+    profile_.memoryRecord.readbackBytes += dstImageView.dataSize;
 }
 
 /* ----- Sampler States ---- */
@@ -430,6 +494,11 @@ std::uint32_t DbgRenderSystem::WriteResourceHeap(ResourceHeap& resourceHeap, std
 
 RenderPass* DbgRenderSystem::CreateRenderPass(const RenderPassDescriptor& renderPassDesc)
 {
+    LLGL_DBG_SOURCE();
+
+    if (debugger_)
+        ValidateRenderPassDesc(renderPassDesc);
+
     return renderPasses_.emplace<DbgRenderPass>(*instance_->CreateRenderPass(renderPassDesc), renderPassDesc);
 }
 
@@ -486,6 +555,20 @@ Shader* DbgRenderSystem::CreateShader(const ShaderDescriptor& shaderDesc)
     return shaders_.emplace<DbgShader>(*instance_->CreateShader(shaderDesc), shaderDesc);
 }
 
+std::uint32_t DbgRenderSystem::CreateShaders(const ArrayView<ShaderDescriptor>& shaderDescs, Shader** outShaders)
+{
+    LLGL_ASSERT_PTR(outShaders);
+
+    /* Create all shader instances as batch and wrap them in debug shaders afterwards */
+    std::vector<Shader*> instances(shaderDescs.size(), nullptr);
+    const std::uint32_t numSucceeded = instance_->CreateShaders(shaderDescs, instances.data());
+
+    for_range(i, shaderDescs.size())
+        outShaders[i] = (instances[i] != nullptr ? shaders_.emplace<DbgShader>(*instances[i], shaderDescs[i]) : nullptr);
+
+    return numSucceeded;
+}
+
 void DbgRenderSystem::Release(Shader& shader)
 {
     ReleaseDbg(shaders_, shader);
@@ -535,6 +618,9 @@ PipelineState* DbgRenderSystem::CreatePipelineState(const GraphicsPipelineDescri
         instanceDesc.tessEvaluationShader   = DbgGetInstance<DbgShader>(pipelineStateDesc.tessEvaluationShader);
         instanceDesc.geometryShader         = DbgGetInstance<DbgShader>(pipelineStateDesc.geometryShader);
         instanceDesc.fragmentShader         = DbgGetInstance<DbgShader>(pipelineStateDesc.fragmentShader);
+        instanceDesc.taskShader             = DbgGetInstance<DbgShader>(pipelineStateDesc.taskShader);
+        instanceDesc.meshShader             = DbgGetInstance<DbgShader>(pipelineStateDesc.meshShader);
+        instanceDesc.placeholder            = DbgGetInstance<DbgPipelineState>(pipelineStateDesc.placeholder);
     }
     return pipelineStates_.emplace<DbgPipelineState>(*instance_->CreatePipelineState(instanceDesc, pipelineCache), pipelineStateDesc);
 }
@@ -551,7 +637,8 @@ PipelineState* DbgRenderSystem::CreatePipelineState(const ComputePipelineDescrip
         if (pipelineStateDesc.pipelineLayout != nullptr)
             instanceDesc.pipelineLayout = &(LLGL_CAST(const DbgPipelineLayout*, pipelineStateDesc.pipelineLayout)->instance);
 
-        instanceDesc.computeShader = DbgGetInstance<DbgShader>(pipelineStateDesc.computeShader);
+        instanceDesc.computeShader  = DbgGetInstance<DbgShader>(pipelineStateDesc.computeShader);
+        instanceDesc.placeholder    = DbgGetInstance<DbgPipelineState>(pipelineStateDesc.placeholder);
     }
     return pipelineStates_.emplace<DbgPipelineState>(*instance_->CreatePipelineState(instanceDesc, pipelineCache), pipelineStateDesc);
 }
@@ -565,6 +652,13 @@ void DbgRenderSystem::Release(PipelineState& pipelineState)
 
 QueryHeap* DbgRenderSystem::CreateQueryHeap(const QueryHeapDescriptor& queryHeapDesc)
 {
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+        if (queryHeapDesc.type == QueryType::Timestamp && !features_.hasTimestampCalibration)
+            LLGL_DBG_ERROR_NOT_SUPPORTED("timestamp queries");
+    }
+
     return queryHeaps_.emplace<DbgQueryHeap>(*instance_->CreateQueryHeap(queryHeapDesc), queryHeapDesc);
 }
 
@@ -592,6 +686,118 @@ bool DbgRenderSystem::GetNativeHandle(void* nativeHandle, std::size_t nativeHand
     return instance_->GetNativeHandle(nativeHandle, nativeHandleSize);
 }
 
+std::uint32_t DbgRenderSystem::QueryMemoryHeaps(MemoryHeapInfo* outHeapInfos, std::uint32_t maxNumHeaps)
+{
+    return instance_->QueryMemoryHeaps(outHeapInfos, maxNumHeaps);
+}
+
+std::uint32_t DbgRenderSystem::GetBindlessDescriptorIndex(const Resource& resource, long bindFlags)
+{
+    switch (resource.GetResourceType())
+    {
+        case ResourceType::Buffer:
+            return instance_->GetBindlessDescriptorIndex(LLGL_CAST(const DbgBuffer&, resource).instance, bindFlags);
+        case ResourceType::Texture:
+            return instance_->GetBindlessDescriptorIndex(LLGL_CAST(const DbgTexture&, resource).instance, bindFlags);
+        default:
+            return instance_->GetBindlessDescriptorIndex(resource, bindFlags);
+    }
+}
+
+bool DbgRenderSystem::GetSparseTextureProperties(const Texture& texture, SparseTextureProperties& outProperties)
+{
+    auto& textureDbg = LLGL_CAST(const DbgTexture&, texture);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+        ValidateSparseTexture(textureDbg);
+    }
+
+    return instance_->GetSparseTextureProperties(textureDbg.instance, outProperties);
+}
+
+bool DbgRenderSystem::CommitTextureTiles(Texture& texture, const TextureRegion& textureRegion, bool commit)
+{
+    auto& textureDbg = LLGL_CAST(DbgTexture&, texture);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+        ValidateSparseTexture(textureDbg);
+        ValidateTextureRegion(textureDbg, textureRegion);
+        ValidateSparseTextureRegion(textureDbg, textureRegion);
+    }
+
+    return instance_->CommitTextureTiles(textureDbg.instance, textureRegion, commit);
+}
+
+// Returns the backend instances of the specified buffers and textures; samplers are passed through and null pointers are ignored.
+static std::vector<Resource*> GetResourceInstances(const ArrayView<Resource*>& resources)
+{
+    std::vector<Resource*> instances;
+    instances.reserve(resources.size());
+
+    for (Resource* resource : resources)
+    {
+        if (resource == nullptr)
+            continue;
+        switch (resource->GetResourceType())
+        {
+            case ResourceType::Buffer:
+                instances.push_back(&(LLGL_CAST(DbgBuffer*, resource)->instance));
+                break;
+            case ResourceType::Texture:
+                instances.push_back(&(LLGL_CAST(DbgTexture*, resource)->instance));
+                break;
+            default:
+                instances.push_back(resource);
+                break;
+        }
+    }
+
+    return instances;
+}
+
+bool DbgRenderSystem::MakeResident(const ArrayView<Resource*>& resources)
+{
+    const std::vector<Resource*> instances = GetResourceInstances(resources);
+    return instance_->MakeResident(instances);
+}
+
+void DbgRenderSystem::Evict(const ArrayView<Resource*>& resources)
+{
+    const std::vector<Resource*> instances = GetResourceInstances(resources);
+    instance_->Evict(instances);
+}
+
+bool DbgRenderSystem::GetAccelerationStructureSizes(const AccelerationStructureBuildDescriptor& buildDesc, AccelerationStructureSizes& outSizes)
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+        if (!features_.hasRayTracing)
+            LLGL_DBG_ERROR_NOT_SUPPORTED("ray tracing");
+    }
+
+    std::vector<AccelerationStructureTriangles> trianglesInstances;
+    return instance_->GetAccelerationStructureSizes(DbgGetAccelerationStructureBuildInstance(buildDesc, trianglesInstances), outSizes);
+}
+
+std::uint64_t DbgRenderSystem::GetAccelerationStructureAddress(const Buffer& buffer)
+{
+    auto& bufferDbg = LLGL_CAST(const DbgBuffer&, buffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE();
+        if ((bufferDbg.desc.bindFlags & BindFlags::AccelerationStructure) == 0)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot get acceleration structure address of buffer that was not created with LLGL::BindFlags::AccelerationStructure");
+    }
+
+    return instance_->GetAccelerationStructureAddress(bufferDbg.instance);
+}
+
 
 /*
  * ======= Private: =======
@@ -605,13 +811,15 @@ void DbgRenderSystem::ValidateBindFlags(long flags)
         BindFlags::IndexBuffer          |
         BindFlags::ConstantBuffer       |
         BindFlags::StreamOutputBuffer   |
-        BindFlags::IndirectBuffer
+        BindFlags::IndirectBuffer       |
+        BindFlags::AccelerationStructure
     );
 
     constexpr long textureOnlyFlags =
     (
         BindFlags::ColorAttachment          |
-        BindFlags::DepthStencilAttachment
+        BindFlags::DepthStencilAttachment   |
+        BindFlags::InputAttachment
     );
 
     constexpr long validFlags =
@@ -660,6 +868,13 @@ void DbgRenderSystem::ValidateBindFlags(long flags)
             "cannot combine bind flag LLGL::BindFlags::ConstantBuffer with any other bind flag except LLGL::BindFlags::CopySrc and LLGL::BindFlags::CopyDst"
         );
     }
+    if ((flags & BindFlags::AccelerationStructure) != 0)
+    {
+        if (!features_.hasRayTracing)
+            LLGL_DBG_ERROR_NOT_SUPPORTED("ray tracing");
+        if (flags != BindFlags::AccelerationStructure)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot combine bind flag LLGL::BindFlags::AccelerationStructure with any other bind flag");
+    }
 }
 
 void DbgRenderSystem::ValidateCPUAccessFlags(long flags, long validFlags, const char* contextDesc)
@@ -719,6 +934,11 @@ void DbgRenderSystem::ValidateCommandBufferDesc(const CommandBufferDescriptor& c
         if ((commandBufferDesc.flags & CommandBufferFlags::Secondary) == 0)
             LLGL_DBG_WARN(WarningType::ImproperArgument, "render pass is ignored for primary command buffers at creation time");
     }
+    if (commandBufferDesc.commandQueue != nullptr)
+    {
+        if ((commandBufferDesc.flags & CommandBufferFlags::Secondary) != 0)
+            LLGL_DBG_WARN(WarningType::ImproperArgument, "command queue is ignored for secondary command buffers");
+    }
 
     /* Validate number of native buffers */
     if (commandBufferDesc.numNativeBuffers == 0)
@@ -730,7 +950,22 @@ void DbgRenderSystem::ValidateBufferDesc(const BufferDescriptor& bufferDesc, std
     /* Validate flags */
     ValidateBindFlags(bufferDesc.bindFlags);
     ValidateCPUAccessFlags(bufferDesc.cpuAccessFlags, CPUAccessFlags::ReadWrite, "buffer");
-    ValidateMiscFlags(bufferDesc.miscFlags, (MiscFlags::DynamicUsage | MiscFlags::NoInitialData), "buffer");
+    ValidateMiscFlags(bufferDesc.miscFlags, (MiscFlags::DynamicUsage | MiscFlags::NoInitialData | MiscFlags::Readback | MiscFlags::PersistentMapping), "buffer");
+
+    if ((bufferDesc.miscFlags & MiscFlags::Readback) != 0)
+    {
+        /* Validate readback buffers are only used as copy destination and for CPU read access */
+        if ((bufferDesc.bindFlags & (~BindFlags::CopyDst)) != 0)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "readback buffer cannot have any binding flags other than LLGL::BindFlags::CopyDst");
+        if (bufferDesc.cpuAccessFlags != CPUAccessFlags::Read)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "readback buffer must have CPU access flags LLGL::CPUAccessFlags::Read only");
+        if ((bufferDesc.miscFlags & MiscFlags::DynamicUsage) != 0)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "readback buffer cannot have miscellaneous flag LLGL::MiscFlags::DynamicUsage");
+    }
+
+    /* Validate persistently mapped buffers can be accessed by the CPU */
+    if ((bufferDesc.miscFlags & MiscFlags::PersistentMapping) != 0 && bufferDesc.cpuAccessFlags == 0)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "persistently mapped buffer must have CPU access flags LLGL::CPUAccessFlags::Read and/or LLGL::CPUAccessFlags::Write");
 
     /* Validate (constant-) buffer size */
     if ((bufferDesc.bindFlags & BindFlags::ConstantBuffer) != 0)
@@ -963,7 +1198,28 @@ void DbgRenderSystem::ValidateTextureDesc(const TextureDescriptor& textureDesc,
     ValidateTextureDescMipLevels(textureDesc);
     ValidateArrayTextureLayers(textureDesc.type, textureDesc.arrayLayers);
     ValidateBindFlags(textureDesc.bindFlags);
-    ValidateMiscFlags(textureDesc.miscFlags, (MiscFlags::DynamicUsage | MiscFlags::FixedSamples | MiscFlags::GenerateMips | MiscFlags::NoInitialData), "texture");
+    if ((textureDesc.bindFlags & BindFlags::InputAttachment) != 0 && (textureDesc.bindFlags & BindFlags::ColorAttachment) == 0)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "cannot create texture with binding flag 'LLGL::BindFlags::InputAttachment' but without 'LLGL::BindFlags::ColorAttachment'"
+        );
+    }
+    ValidateMiscFlags(textureDesc.miscFlags, (MiscFlags::DynamicUsage | MiscFlags::FixedSamples | MiscFlags::GenerateMips | MiscFlags::NoInitialData | MiscFlags::Transient | MiscFlags::Sparse | MiscFlags::Memoryless), "texture");
+
+    if ((textureDesc.miscFlags & MiscFlags::Sparse) != 0)
+        ValidateSparseTextureDesc(textureDesc, initialImage);
+    if ((textureDesc.miscFlags & MiscFlags::Memoryless) != 0)
+        ValidateMemorylessTextureDesc(textureDesc, initialImage);
+
+    /* Transient textures are never initialized */
+    if ((textureDesc.miscFlags & MiscFlags::Transient) != 0 && initialImage != nullptr)
+    {
+        LLGL_DBG_WARN(
+            WarningType::ImproperArgument,
+            "initial image data of transient texture is ignored: 'LLGL::MiscFlags::Transient' specified with initial image data"
+        );
+    }
 
     /* Check if MIP-map generation is requested  */
     if ((textureDesc.miscFlags & MiscFlags::GenerateMips) != 0)
@@ -987,6 +1243,82 @@ void DbgRenderSystem::ValidateTextureDesc(const TextureDescriptor& textureDesc,
     }
 }
 
+void DbgRenderSystem::ValidateMemorylessTextureDesc(const TextureDescriptor& textureDesc, const ImageView* initialImage)
+{
+    const long attachmentBindFlags = (BindFlags::ColorAttachment | BindFlags::DepthStencilAttachment);
+    if ((textureDesc.bindFlags & attachmentBindFlags) == 0 || (textureDesc.bindFlags & ~(attachmentBindFlags | BindFlags::InputAttachment)) != 0)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "cannot create memoryless texture with binding flags other than 'LLGL::BindFlags::ColorAttachment', 'LLGL::BindFlags::DepthStencilAttachment', or 'LLGL::BindFlags::InputAttachment'"
+        );
+    }
+
+    if (textureDesc.cpuAccessFlags != 0)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "cannot create memoryless texture with CPU access flags"
+        );
+    }
+
+    if (NumMipLevels(textureDesc) != 1)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "cannot create memoryless texture with %u MIP-map levels: 'LLGL::MiscFlags::Memoryless' requires a single MIP-map", NumMipLevels(textureDesc)
+        );
+    }
+
+    if ((textureDesc.miscFlags & (MiscFlags::Transient | MiscFlags::Sparse | MiscFlags::GenerateMips)) != 0)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "cannot create texture with 'LLGL::MiscFlags::Memoryless' and any of 'LLGL::MiscFlags::Transient', 'LLGL::MiscFlags::Sparse', or 'LLGL::MiscFlags::GenerateMips'"
+        );
+    }
+
+    /* Memoryless textures are never initialized */
+    if (initialImage != nullptr)
+    {
+        LLGL_DBG_WARN(
+            WarningType::ImproperArgument,
+            "initial image data of memoryless texture is ignored: 'LLGL::MiscFlags::Memoryless' specified with initial image data"
+        );
+    }
+}
+
+void DbgRenderSystem::ValidateSparseTextureDesc(const TextureDescriptor& textureDesc, const ImageView* initialImage)
+{
+    if (!features_.hasSparseTextures)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("sparse textures");
+
+    if (!(textureDesc.type == TextureType::Texture2D || textureDesc.type == TextureType::Texture2DArray))
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "cannot create sparse texture of type %s: 'LLGL::MiscFlags::Sparse' requires type Texture2D or Texture2DArray", ToString(textureDesc.type)
+        );
+    }
+
+    if ((textureDesc.miscFlags & MiscFlags::Transient) != 0)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "cannot create texture with both 'LLGL::MiscFlags::Sparse' and 'LLGL::MiscFlags::Transient'"
+        );
+    }
+
+    /* Sparse textures are never initialized */
+    if (initialImage != nullptr)
+    {
+        LLGL_DBG_WARN(
+            WarningType::ImproperArgument,
+            "initial image data of sparse texture is ignored: 'LLGL::MiscFlags::Sparse' specified with initial image data"
+        );
+    }
+}
+
 void DbgRenderSystem::ValidateTextureFormatSupported(const Format format)
 {
     const auto& supportedFormats = GetRenderingCaps().textureFormats;
@@ -1264,6 +1596,50 @@ static DbgTextureFormatCompatibility GetTextureFormatCompatibility(Format shared
     return DbgTextureFormatCompatibility::Incompatible;
 }
 
+void DbgRenderSystem::ValidateSparseTexture(const DbgTexture& textureDbg)
+{
+    if ((textureDbg.desc.miscFlags & MiscFlags::Sparse) == 0)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot access tiles of texture that was not created with 'LLGL::MiscFlags::Sparse'");
+}
+
+void DbgRenderSystem::ValidateSparseTextureRegion(const DbgTexture& textureDbg, const TextureRegion& textureRegion)
+{
+    SparseTextureProperties sparseProps;
+    if (!instance_->GetSparseTextureProperties(textureDbg.instance, sparseProps))
+        return;
+
+    if (textureRegion.subresource.baseMipLevel >= sparseProps.firstMipTail)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "cannot commit tiles of MIP-map level %u: packed MIP-map tail starts at level %u and is always resident",
+            textureRegion.subresource.baseMipLevel, sparseProps.firstMipTail
+        );
+        return;
+    }
+
+    /* Region must be aligned to tiles, except for the end of MIP-map levels */
+    const Extent3D mipExtent = textureDbg.instance.GetMipExtent(textureRegion.subresource.baseMipLevel);
+
+    auto IsTileMisaligned = [](std::int32_t offset, std::uint32_t extent, std::uint32_t tileExtent, std::uint32_t limit)
+    {
+        if (tileExtent == 0 || offset < 0)
+            return false;
+        const std::uint32_t end = static_cast<std::uint32_t>(offset) + extent;
+        return (static_cast<std::uint32_t>(offset) % tileExtent != 0 || (end % tileExtent != 0 && end != limit));
+    };
+
+    if ( IsTileMisaligned(textureRegion.offset.x, textureRegion.extent.width,  sparseProps.tileExtent.width,  mipExtent.width ) ||
+         IsTileMisaligned(textureRegion.offset.y, textureRegion.extent.height, sparseProps.tileExtent.height, mipExtent.height) )
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "texture region for tile commitment is not aligned to tile extent (%u x %u)",
+            sparseProps.tileExtent.width, sparseProps.tileExtent.height
+        );
+    }
+}
+
 void DbgRenderSystem::ValidateTextureView(const DbgTexture& sharedTextureDbg, const TextureViewDescriptor& textureViewDesc)
 {
     /* Validate texture-view features are supported */
@@ -1440,6 +1816,47 @@ void DbgRenderSystem::ValidateAttachmentDesc(const AttachmentDescriptor& attachm
     }
 }
 
+void DbgRenderSystem::ValidateRenderPassDesc(const RenderPassDescriptor& renderPassDesc)
+{
+    if (renderPassDesc.subpasses.size() > 1 && !features_.hasSubpasses)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("render subpasses");
+
+    const std::uint32_t numColorAttachments = NumEnabledColorAttachments(renderPassDesc);
+    for_range(i, renderPassDesc.subpasses.size())
+        ValidateSubpassDesc(renderPassDesc.subpasses[i], static_cast<std::uint32_t>(i), numColorAttachments);
+}
+
+void DbgRenderSystem::ValidateSubpassDesc(const SubpassDescriptor& subpassDesc, std::uint32_t subpass, std::uint32_t numColorAttachments)
+{
+    const std::uint32_t enabledAttachmentsMask = ((1u << numColorAttachments) - 1u);
+
+    if ((subpassDesc.inputAttachmentMask & ~enabledAttachmentsMask) != 0)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "input attachment mask 0x%08X of subpass %u refers to disabled color attachments; render pass has %u color attachment(s)",
+            subpassDesc.inputAttachmentMask, subpass, numColorAttachments
+        );
+    }
+
+    if ((subpassDesc.colorAttachmentMask & subpassDesc.inputAttachmentMask & enabledAttachmentsMask) != 0)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "subpass %u cannot render into color attachments that it also reads as input attachments (mask 0x%08X)",
+            subpass, (subpassDesc.colorAttachmentMask & subpassDesc.inputAttachmentMask & enabledAttachmentsMask)
+        );
+    }
+
+    if (subpass == 0 && subpassDesc.inputAttachmentMask != 0)
+    {
+        LLGL_DBG_WARN(
+            WarningType::ImproperArgument,
+            "first subpass reads input attachments that have not been rendered into by any previous subpass"
+        );
+    }
+}
+
 void DbgRenderSystem::ValidateResourceHeapDesc(const ResourceHeapDescriptor& resourceHeapDesc, const ArrayView<ResourceViewDescriptor>& initialResourceViews)
 {
     if (resourceHeapDesc.pipelineLayout != nullptr)
@@ -1748,15 +2165,60 @@ static bool IsDualSourceBlendingEnabled(const BlendTargetDescriptor& blendTarget
     );
 }
 
+void DbgRenderSystem::ValidateSpecializationConstants(const ArrayView<SpecializationConstant>& specializationConstants)
+{
+    if (specializationConstants.empty())
+        return;
+
+    if (GetRendererID() != RendererID::Vulkan)
+        LLGL_DBG_WARN(WarningType::ImproperArgument, "specialization constants are ignored by %s renderer", GetName());
+
+    for_range(i, specializationConstants.size())
+    {
+        for_subrange(j, i + 1, specializationConstants.size())
+        {
+            if (specializationConstants[i].id == specializationConstants[j].id)
+            {
+                LLGL_DBG_ERROR(
+                    ErrorType::InvalidArgument,
+                    "duplicate specialization constant ID %u in PSO descriptor",
+                    specializationConstants[i].id
+                );
+                return;
+            }
+        }
+    }
+}
+
 void DbgRenderSystem::ValidateGraphicsPipelineDesc(const GraphicsPipelineDescriptor& pipelineStateDesc)
 {
     if (pipelineStateDesc.rasterizer.conservativeRasterization && !features_.hasConservativeRasterization)
         LLGL_DBG_ERROR_NOT_SUPPORTED("conservative rasterization");
+    if (pipelineStateDesc.dynamicStates != 0 && !features_.hasExtendedDynamicState)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("extended dynamic state");
+
+    /* Validate subpass index against render pass */
+    const DbgRenderPass* renderPassDbg = DbgGetWrapper<DbgRenderPass>(pipelineStateDesc.renderPass);
+    const std::uint32_t numSubpasses = (renderPassDbg != nullptr ? renderPassDbg->NumSubpasses() : 1u);
+    if (pipelineStateDesc.subpass >= numSubpasses)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "cannot create graphics PSO for subpass %u; render pass has only %u subpass(es)",
+            pipelineStateDesc.subpass, numSubpasses
+        );
+    }
+
+    ValidateSpecializationConstants(pipelineStateDesc.specializationConstants);
 
     /* Validate shader pipeline stages */
     bool hasSeparableShaders = false;
-    if (DbgShader* vertexShaderDbg = DbgGetWrapper<DbgShader>(pipelineStateDesc.vertexShader))
+    if (pipelineStateDesc.meshShader != nullptr)
+        ValidateMeshPipelineStages(pipelineStateDesc);
+    else if (DbgShader* vertexShaderDbg = DbgGetWrapper<DbgShader>(pipelineStateDesc.vertexShader))
         hasSeparableShaders = ((vertexShaderDbg->desc.flags & ShaderCompileFlags::SeparateShader) != 0);
+    else if (pipelineStateDesc.taskShader != nullptr)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create graphics PSO with task shader but without mesh shader");
     else
         LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create graphics PSO without vertex shader");
 
@@ -1775,7 +2237,9 @@ void DbgRenderSystem::ValidateGraphicsPipelineDesc(const GraphicsPipelineDescrip
                                  ShaderTypePair{ pipelineStateDesc.tessControlShader,    ShaderType::TessControl    },
                                  ShaderTypePair{ pipelineStateDesc.tessEvaluationShader, ShaderType::TessEvaluation },
                                  ShaderTypePair{ pipelineStateDesc.geometryShader,       ShaderType::Geometry       },
-                                 ShaderTypePair{ pipelineStateDesc.fragmentShader,       ShaderType::Fragment       } })
+                                 ShaderTypePair{ pipelineStateDesc.fragmentShader,       ShaderType::Fragment       },
+                                 ShaderTypePair{ pipelineStateDesc.taskShader,           ShaderType::Task           },
+                                 ShaderTypePair{ pipelineStateDesc.meshShader,           ShaderType::Mesh           } })
     {
         if (Shader* shader = pair.shader)
         {
@@ -1815,6 +2279,26 @@ void DbgRenderSystem::ValidateGraphicsPipelineDesc(const GraphicsPipelineDescrip
 
     ValidateInputAssemblyDescriptor(pipelineStateDesc);
     ValidateBlendDescriptor(pipelineStateDesc.blend, hasFragmentShader, hasDualSourceBlend);
+
+    if (DbgPipelineState* placeholderDbg = DbgGetWrapper<DbgPipelineState>(pipelineStateDesc.placeholder))
+    {
+        if (!placeholderDbg->isGraphicsPSO)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create graphics PSO with compute PSO as placeholder");
+    }
+}
+
+void DbgRenderSystem::ValidateMeshPipelineStages(const GraphicsPipelineDescriptor& pipelineStateDesc)
+{
+    if (!features_.hasMeshShaders)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("mesh shaders");
+
+    /* Mesh pipelines replace the entire vertex processing stages */
+    if (pipelineStateDesc.vertexShader != nullptr)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create graphics PSO with both mesh shader and vertex shader");
+    if (pipelineStateDesc.tessControlShader != nullptr || pipelineStateDesc.tessEvaluationShader != nullptr)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create graphics PSO with both mesh shader and tessellation shaders");
+    if (pipelineStateDesc.geometryShader != nullptr)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create graphics PSO with both mesh shader and geometry shader");
 }
 
 void DbgRenderSystem::ValidateComputePipelineDesc(const ComputePipelineDescriptor& pipelineStateDesc)
@@ -1833,6 +2317,14 @@ void DbgRenderSystem::ValidateComputePipelineDesc(const ComputePipelineDescripto
     }
     else
         LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create compute PSO without compute shader");
+
+    ValidateSpecializationConstants(pipelineStateDesc.specializationConstants);
+
+    if (DbgPipelineState* placeholderDbg = DbgGetWrapper<DbgPipelineState>(pipelineStateDesc.placeholder))
+    {
+        if (placeholderDbg->isGraphicsPSO)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create compute PSO with graphics PSO as placeholder");
+    }
 }
 
 void DbgRenderSystem::ValidateFragmentShaderOutput(DbgShader& fragmentShaderDbg, const RenderPass* renderPass, bool hasDualSourceBlend)
@@ -15,6 +15,7 @@
 #include "DbgSwapChain.h"
 #include "DbgCommandBuffer.h"
 #include "DbgCommandQueue.h"
+#include "DbgValidationSampler.h"
 
 #include "Buffer/DbgBuffer.h"
 #include "Buffer/DbgBufferArray.h"
@@ -66,6 +67,8 @@ class DbgRenderSystem final : public RenderSystem
         void ValidateBufferView(DbgBuffer& bufferDbg, const BufferViewDescriptor& viewDesc, const BindingDescriptor& bindingDesc);
 
         void ValidateTextureDesc(const TextureDescriptor& textureDesc, const ImageView* initialImage = nullptr);
+        void ValidateSparseTextureDesc(const TextureDescriptor& textureDesc, const ImageView* initialImage);
+        void ValidateMemorylessTextureDesc(const TextureDescriptor& textureDesc, const ImageView* initialImage);
         void ValidateTextureFormatSupported(const Format format);
         void ValidateTextureDescMipLevels(const TextureDescriptor& textureDesc);
         void ValidateTextureSize(std::uint32_t size, std::uint32_t limit, const char* textureTypeName);
@@ -79,11 +82,15 @@ class DbgRenderSystem final : public RenderSystem
         void ValidateTextureArrayRange(const DbgTexture& textureDbg, std::uint32_t baseArrayLayer, std::uint32_t numArrayLayers);
         void ValidateTextureArrayRangeWithEnd(std::uint32_t baseArrayLayer, std::uint32_t numArrayLayers, std::uint32_t arrayLayerLimit);
         void ValidateTextureRegion(const DbgTexture& textureDbg, const TextureRegion& textureRegion);
+        void ValidateSparseTexture(const DbgTexture& textureDbg);
+        void ValidateSparseTextureRegion(const DbgTexture& textureDbg, const TextureRegion& textureRegion);
         void ValidateTextureView(const DbgTexture& sharedTextureDbg, const TextureViewDescriptor& textureViewDesc);
         void ValidateTextureViewType(const TextureType sharedTextureType, const TextureType textureViewType, const std::initializer_list<TextureType>& validTypes);
         void ValidateImageDataSize(const DbgTexture& textureDbg, const TextureRegion& textureRegion, ImageFormat imageFormat, DataType dataType, std::size_t dataSize);
 
         void ValidateAttachmentDesc(const AttachmentDescriptor& attachmentDesc, std::uint32_t colorTarget, bool isResolveAttachment, bool isDepthStencilAttachment);
+        void ValidateRenderPassDesc(const RenderPassDescriptor& renderPassDesc);
+        void ValidateSubpassDesc(const SubpassDescriptor& subpassDesc, std::uint32_t subpass, std::uint32_t numColorAttachments);
 
         void ValidateResourceHeapDesc(const ResourceHeapDescriptor& resourceHeapDesc, const ArrayView<ResourceViewDescriptor>& initialResourceViews);
         void ValidateResourceHeapRange(const DbgResourceHeap& resourceHeapDbg, std::uint32_t firstDescriptor, const ArrayView<ResourceViewDescriptor>& resourceViews);
@@ -94,7 +101,9 @@ class DbgRenderSystem final : public RenderSystem
         void ValidateInputAssemblyDescriptor(const GraphicsPipelineDescriptor& pipelineStateDesc);
         void ValidateBlendTargetDescriptor(const BlendTargetDescriptor& blendTargetDesc, std::size_t idx);
         void ValidateBlendDescriptor(const BlendDescriptor& blendDesc, bool hasFragmentShader, bool hasDualSourceBlend);
+        void ValidateSpecializationConstants(const ArrayView<SpecializationConstant>& specializationConstants);
         void ValidateGraphicsPipelineDesc(const GraphicsPipelineDescriptor& pipelineStateDesc);
+        void ValidateMeshPipelineStages(const GraphicsPipelineDescriptor& pipelineStateDesc);
         void ValidateComputePipelineDesc(const ComputePipelineDescriptor& pipelineStateDesc);
         void ValidateFragmentShaderOutput(DbgShader& fragmentShaderDbg, const RenderPass* renderPass, bool hasDualSourceBlend);
         void ValidateFragmentShaderOutputWithRenderPass(DbgShader& fragmentShaderDbg, const FragmentShaderAttributes& fragmentAttribs, const DbgRenderPass& renderPass, bool hasDualSourceBlend);
@@ -121,6 +130,9 @@ class DbgRenderSystem final : public RenderSystem
 
         RenderingDebugger*                      debugger_   = nullptr;
         FrameProfile                            profile_;
+        AllocatorStatistics                     allocatorStats_ = GetAllocatorStatistics(); // Allocator statistics of the previous frame.
+        DbgPassQueryResolver                    passQueryResolver_;
+        DbgValidationSampler                    validationSampler_;
 
         const RenderingCapabilities&            caps_;
         const RenderingFeatures&                features_;
@@ -130,6 +142,7 @@ class DbgRenderSystem final : public RenderSystem
 
         HWObjectContainer<DbgSwapChain>         swapChains_;
         HWObjectInstance<DbgCommandQueue>       commandQueue_;
+        HWObjectContainer<DbgCommandQueue>      auxCommandQueues_;  // Command queues other than the primary one, see GetCommandQueue(long).
         HWObjectContainer<DbgCommandBuffer>     commandBuffers_;
         HWObjectContainer<DbgBuffer>            buffers_;
         HWObjectContainer<DbgBufferArray>       bufferArrays_;
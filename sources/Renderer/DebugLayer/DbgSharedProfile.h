@@ -0,0 +1,97 @@
+/*
+ * DbgSharedProfile.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_DBG_SHARED_PROFILE_H
+#define LLGL_DBG_SHARED_PROFILE_H
+
+
+#include "DbgMemoryProfile.h"
+#include "DbgPassQueryResolver.h"
+#include <LLGL/RenderingDebugger.h>
+#include <cstdint>
+#include <mutex>
+
+
+namespace LLGL
+{
+
+
+/*
+Frame profile of the profile-only debug layer that is shared between all threads.
+Command buffers accumulate their counters locally while they are encoded and only merge them into this profile on submission,
+so the mutex is only locked once per submission and once per command queue operation.
+*/
+class DbgSharedProfile
+{
+
+    public:
+
+        // Merges the profile of a submitted command buffer, assigns the next submission index to its time records, and returns that index.
+        inline std::uint32_t MergeSubmission(FrameProfile& profile)
+        {
+            std::lock_guard<std::mutex> guard{ mutex_ };
+            const std::uint32_t submissionIndex = profile_.commandQueueRecord.commandBufferSubmittions++;
+            for (ProfileTimeRecord& record : profile.timeRecords)
+                record.commandBuffer = submissionIndex;
+            RenderingDebugger::MergeProfiles(profile_, profile);
+            return submissionIndex;
+        }
+
+        // Increments the specified command queue counter and accumulates the number of transferred bytes of this operation.
+        inline void Increment(std::uint32_t ProfileCommandQueueRecord::*counter, std::uint64_t uploadedBytes = 0, std::uint64_t readbackBytes = 0)
+        {
+            std::lock_guard<std::mutex> guard{ mutex_ };
+            (profile_.commandQueueRecord.*counter)++;
+            profile_.memoryRecord.uploadedBytes += uploadedBytes;
+            profile_.memoryRecord.readbackBytes += readbackBytes;
+        }
+
+        // Accumulates the number of bytes that are uploaded with the initial data of a new resource.
+        inline void AddUploadedBytes(std::uint64_t uploadedBytes)
+        {
+            std::lock_guard<std::mutex> guard{ mutex_ };
+            profile_.memoryRecord.uploadedBytes += uploadedBytes;
+        }
+
+        /*
+        Moves the accumulated profile into the specified debugger and resets the counters for the next frame.
+        The memory heap usage of the specified render system and the pass queries are captured outside the lock as they might be queried from the driver.
+        */
+        inline void Flush(RenderingDebugger* debugger, RenderSystem& renderSystem, DbgPassQueryResolver& passQueryResolver)
+        {
+            FrameProfile profile;
+            {
+                std::lock_guard<std::mutex> guard{ mutex_ };
+                profile = std::move(profile_);
+                profile_ = {};
+                DbgRecordHeapAllocations(profile.memoryRecord, allocatorStats_);
+            }
+            if (debugger != nullptr)
+            {
+                DbgRecordMemoryUsage(profile.memoryRecord, renderSystem);
+                passQueryResolver.Resolve(profile.passRecords);
+                debugger->RecordProfile(profile);
+            }
+        }
+
+    private:
+
+        std::mutex          mutex_;
+        FrameProfile        profile_;
+        AllocatorStatistics allocatorStats_ = GetAllocatorStatistics();
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -55,9 +55,7 @@ void DbgSwapChain::SetDebugName(const char* name)
 void DbgSwapChain::Present()
 {
     instance.Present();
-    if (presentCallback_)
-        presentCallback_();
-    NotifyFramebufferUsed();
+    NotifyPresented();
 }
 
 std::uint32_t DbgSwapChain::GetCurrentSwapIndex() const
@@ -90,6 +88,11 @@ bool DbgSwapChain::SetVsyncInterval(std::uint32_t vsyncInterval)
     return instance.SetVsyncInterval(vsyncInterval);
 }
 
+bool DbgSwapChain::SetFramePacing(const FramePacingDescriptor& desc)
+{
+    return instance.SetFramePacing(desc);
+}
+
 const RenderPass* DbgSwapChain::GetRenderPass() const
 {
     return renderPass_.get();
@@ -123,6 +126,13 @@ void DbgSwapChain::NotifyFramebufferUsed()
     usedSinceRenderPass_ = true;
 }
 
+void DbgSwapChain::NotifyPresented()
+{
+    if (presentCallback_)
+        presentCallback_();
+    NotifyFramebufferUsed();
+}
+
 
 } // /namespace LLGL
 
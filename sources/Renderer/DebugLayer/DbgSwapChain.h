@@ -44,6 +44,7 @@ class DbgSwapChain final : public SwapChain
         Format GetDepthStencilFormat() const override;
 
         bool SetVsyncInterval(std::uint32_t vsyncInterval) override;
+        bool SetFramePacing(const FramePacingDescriptor& desc) override;
 
         const RenderPass* GetRenderPass() const override;
 
@@ -57,6 +58,9 @@ class DbgSwapChain final : public SwapChain
         // Notifies that the framebuffer has been used since the last render pass section.
         void NotifyFramebufferUsed();
 
+        // Invokes the present callback after the swap-chain instance has been presented, either by Present() or CommandQueue::Present().
+        void NotifyPresented();
+
     public:
 
         SwapChain&                  instance;
@@ -0,0 +1,63 @@
+/*
+ * DbgValidationSampler.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_DBG_VALIDATION_SAMPLER_H
+#define LLGL_DBG_VALIDATION_SAMPLER_H
+
+
+#include <LLGL/RenderingDebugger.h>
+#include <atomic>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+Selects the command buffer encodings that are validated by the debug layer (see RenderingDebugger::SetValidationSampling).
+This is shared between all command buffers of a render system, which might be encoded on different threads.
+*/
+class DbgValidationSampler
+{
+
+    public:
+
+        // Advances the frame counter. This is called once per SwapChain::Present.
+        inline void NextFrame()
+        {
+            frameIndex_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Returns true if the next command buffer encoding is to be validated with the sampling configuration of the specified debugger.
+        inline bool SampleEncoding(const RenderingDebugger& debugger)
+        {
+            const std::uint32_t interval = debugger.GetValidationSamplingInterval();
+            if (interval <= 1)
+                return true;
+            if (debugger.IsValidationSampledPerCommandBuffer())
+                return (encodingIndex_.fetch_add(1, std::memory_order_relaxed) % interval == 0);
+            else
+                return (frameIndex_.load(std::memory_order_relaxed) % interval == 0);
+        }
+
+    private:
+
+        std::atomic<std::uint64_t> frameIndex_      { 0 };
+        std::atomic<std::uint64_t> encodingIndex_   { 0 };
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
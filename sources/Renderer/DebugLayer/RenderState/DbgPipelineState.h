@@ -27,6 +27,7 @@ class DbgPipelineState final : public PipelineState
 
         void SetDebugName(const char* name) override;
         const Report* GetReport() const override;
+        bool IsReady() const override;
 
     public:
 
@@ -9,25 +9,36 @@
 #include "../DbgCore.h"
 #include "../DbgSwapChain.h"
 #include "../../RenderPassUtils.h"
+#include <algorithm>
 
 
 namespace LLGL
 {
 
 
+// Returns a copy of the specified render pass descriptor whose subpasses refer to the specified container.
+static RenderPassDescriptor CopyRenderPassDesc(const RenderPassDescriptor& desc, const std::vector<SubpassDescriptor>& subpasses)
+{
+    RenderPassDescriptor descCopy = desc;
+    descCopy.subpasses = subpasses;
+    return descCopy;
+}
+
 DbgRenderPass::DbgRenderPass(RenderPass& instance, const RenderPassDescriptor& desc) :
-    instance        { instance             },
-    mutableInstance { &instance            },
-    desc            { desc                 },
-    label           { LLGL_DBG_LABEL(desc) }
+    instance        { instance                                              },
+    mutableInstance { &instance                                             },
+    subpasses       { desc.subpasses.begin(), desc.subpasses.end()          },
+    desc            { CopyRenderPassDesc(desc, subpasses)                   },
+    label           { LLGL_DBG_LABEL(desc)                                  }
 {
 }
 
 DbgRenderPass::DbgRenderPass(const RenderPass& instance, const RenderPassDescriptor& desc) :
-    instance        { instance             },
-    mutableInstance { nullptr              },
-    desc            { desc                 },
-    label           { LLGL_DBG_LABEL(desc) }
+    instance        { instance                                              },
+    mutableInstance { nullptr                                               },
+    subpasses       { desc.subpasses.begin(), desc.subpasses.end()          },
+    desc            { CopyRenderPassDesc(desc, subpasses)                   },
+    label           { LLGL_DBG_LABEL(desc)                                  }
 {
 }
 
@@ -52,6 +63,11 @@ std::uint32_t DbgRenderPass::NumEnabledColorAttachments() const
     return LLGL::NumEnabledColorAttachments(desc);
 }
 
+std::uint32_t DbgRenderPass::NumSubpasses() const
+{
+    return std::max(1u, static_cast<std::uint32_t>(subpasses.size()));
+}
+
 bool DbgRenderPass::AnySwapChainAttachmentsLoaded(const DbgSwapChain& swapChain) const
 {
     const Format colorFormat = swapChain.GetColorFormat();
@@ -51,6 +51,16 @@ void DbgTexture::SetDebugName(const char* name)
     DbgSetObjectName(*this, name);
 }
 
+void DbgTexture::SetResidencyPriority(ResidencyPriority priority)
+{
+    instance.SetResidencyPriority(priority);
+}
+
+bool DbgTexture::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
+{
+    return instance.GetNativeHandle(nativeHandle, nativeHandleSize);
+}
+
 TextureDescriptor DbgTexture::GetDesc() const
 {
     return instance.GetDesc();
@@ -28,6 +28,8 @@ class DbgTexture final : public Texture
     public:
 
         void SetDebugName(const char* name) override;
+        void SetResidencyPriority(ResidencyPriority priority) override;
+        bool GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize) override;
 
     public:
 
@@ -9,10 +9,13 @@
 #include "../D3D11Types.h"
 #include "../D3D11ResourceFlags.h"
 #include "../D3D11ObjectUtils.h"
+#include "../D3D11DeferredUploadQueue.h"
 #include "../../ResourceUtils.h"
 #include "../../DXCommon/DXCore.h"
+#include "../../DXCommon/DXTypes.h"
 #include "../../../Core/CoreUtils.h"
 #include "../../../Core/Assertion.h"
+#include <LLGL/Backend/Direct3D11/NativeHandle.h>
 
 
 namespace LLGL
@@ -22,7 +25,7 @@ namespace LLGL
 // Returns true if the specified buffer descriptors requires an intermediate buffer for CPU-access.
 static bool NeedsIntermediateCpuAccessBuffer(const BufferDescriptor& desc)
 {
-    return (desc.cpuAccessFlags != 0);
+    return (desc.cpuAccessFlags != 0 && (desc.miscFlags & MiscFlags::Readback) == 0);
 }
 
 D3D11Buffer::D3D11Buffer(ID3D11Device* device, const BufferDescriptor& desc, const void* initialData) :
@@ -44,6 +47,23 @@ void D3D11Buffer::SetDebugName(const char* name)
         D3D11SetObjectNameSubscript(cpuAccessBuffer_.Get(), name, ".CPUAccessBuffer");
 }
 
+void D3D11Buffer::SetResidencyPriority(ResidencyPriority priority)
+{
+    GetNative()->SetEvictionPriority(DXTypes::ToDXResidencyPriority(priority));
+}
+
+bool D3D11Buffer::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
+{
+    if (nativeHandle != nullptr && nativeHandleSize == sizeof(Direct3D11::ResourceNativeHandle))
+    {
+        auto* nativeHandleD3D = reinterpret_cast<Direct3D11::ResourceNativeHandle*>(nativeHandle);
+        nativeHandleD3D->resource = GetNative();
+        nativeHandleD3D->resource->AddRef();
+        return true;
+    }
+    return false;
+}
+
 BufferDescriptor D3D11Buffer::GetDesc() const
 {
     /* Get native buffer descriptor and convert */
@@ -67,6 +87,11 @@ BufferDescriptor D3D11Buffer::GetDesc() const
 
     if (nativeDesc.Usage == D3D11_USAGE_DYNAMIC)
         bufferDesc.miscFlags |= MiscFlags::DynamicUsage;
+    else if (nativeDesc.Usage == D3D11_USAGE_STAGING)
+    {
+        bufferDesc.cpuAccessFlags   |= CPUAccessFlags::Read;
+        bufferDesc.miscFlags        |= MiscFlags::Readback;
+    }
 
     return bufferDesc;
 }
@@ -114,7 +139,7 @@ void D3D11Buffer::WriteSubresource(ID3D11DeviceContext* context, const void* dat
         {
             /* Update subresource region of buffer */
             const D3D11_BOX dstBox{ offset, 0, 0, offset + dataSize, 1, 1 };
-            context->UpdateSubresource(GetNative(), 0, &dstBox, data, 0, 0);
+            D3D11UpdateSubresource(context, GetNative(), 0, &dstBox, data, 0, 0);
         }
     }
 }
@@ -135,6 +160,17 @@ void D3D11Buffer::ReadSubresource(ID3D11DeviceContext* context, void* data, UINT
     }
     else
     #endif
+    if (GetDXUsage() == D3D11_USAGE_STAGING)
+    {
+        /* Read readback buffers directly without intermediate copy */
+        D3D11_MAPPED_SUBRESOURCE mappedSubresource;
+        if (SUCCEEDED(context->Map(GetNative(), 0, D3D11_MAP_READ, 0, &mappedSubresource)))
+        {
+            ::memcpy(data, reinterpret_cast<const char*>(mappedSubresource.pData) + offset, dataSize);
+            context->Unmap(GetNative(), 0);
+        }
+    }
+    else
         ReadFromSubresourceCopyWithCpuAccess(context, data, dataSize, offset);
 }
 
@@ -236,7 +272,7 @@ void D3D11Buffer::CreateGpuBuffer(ID3D11Device* device, const BufferDescriptor&
     {
         descD3D.ByteWidth           = GetD3DBufferSize(desc);
         descD3D.Usage               = DXGetBufferUsage(desc);
-        descD3D.BindFlags           = DXGetBufferBindFlags(desc.bindFlags);
+        descD3D.BindFlags           = (descD3D.Usage == D3D11_USAGE_STAGING ? 0 : DXGetBufferBindFlags(desc.bindFlags)); // Staging buffers cannot be bound to any pipeline stage
         descD3D.CPUAccessFlags      = DXGetCPUAccessFlagsForMiscFlags(desc.miscFlags);
         descD3D.MiscFlags           = DXGetBufferMiscFlags(desc);
         descD3D.StructureByteStride = desc.stride;
@@ -24,6 +24,8 @@ class D3D11Buffer : public Buffer
     public:
 
         void SetDebugName(const char* name) override;
+        void SetResidencyPriority(ResidencyPriority priority) override;
+        bool GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize) override;
 
         BufferDescriptor GetDesc() const override;
 
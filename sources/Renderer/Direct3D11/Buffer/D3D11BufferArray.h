@@ -10,7 +10,7 @@
 
 
 #include <LLGL/BufferArray.h>
-#include <vector>
+#include <LLGL/Container/SmallVector.h>
 #include <d3d11.h>
 
 
@@ -41,8 +41,8 @@ class D3D11BufferArray final : public BufferArray
 
     private:
 
-        std::vector<ID3D11Buffer*>  buffers_;
-        std::vector<UINT>           stridesAndOffsets_;
+        SmallVector<ID3D11Buffer*>  buffers_;
+        SmallVector<UINT, 32>       stridesAndOffsets_;
         std::size_t                 offsetStart_        = 0;
 
 };
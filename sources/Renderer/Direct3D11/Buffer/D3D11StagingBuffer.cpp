@@ -85,10 +85,16 @@ void D3D11StagingBuffer::Write(
 {
     if (usage_ == D3D11_USAGE_DYNAMIC)
     {
-        /* D3D11_USAGE_DYNAMIC only supports map-write with discard */
+        /*
+        D3D11_USAGE_DYNAMIC only supports map-write with discard or no-overwrite.
+        Discard the previous content only at the beginning of the buffer, i.e. when it's used as ring buffer and wraps around,
+        since the regions behind the current offset might still be in use by the GPU.
+        */
+        const D3D11_MAP mapType = (offset_ == 0 ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_WRITE_NO_OVERWRITE);
+
         /* Update partial subresource by mapping buffer from GPU into CPU memory space */
         D3D11_MAPPED_SUBRESOURCE subresource;
-        if (SUCCEEDED(context->Map(GetNative(), 0, D3D11_MAP_WRITE_DISCARD, 0, &subresource)))
+        if (SUCCEEDED(context->Map(GetNative(), 0, mapType, 0, &subresource)))
         {
             ::memcpy(reinterpret_cast<char*>(subresource.pData) + offset_, data, dataSize);
             context->Unmap(GetNative(), 0);
@@ -6,6 +6,7 @@
  */
 
 #include "D3D11StagingBufferPool.h"
+#include "../Direct3D11.h"
 #include "../../../Core/CoreUtils.h"
 
 
@@ -13,11 +14,22 @@ namespace LLGL
 {
 
 
-// Returns true if the specified D3D context requires separate segments for staging buffers
-static bool IsSegmentedStagingRequired(ID3D11DeviceContext* context)
+// Minimum size (in bytes) of each chunk when the pool is used as ring buffer.
+static constexpr UINT g_minRingBufferChunkSize = 65536u;
+
+/*
+Returns true if the pool can write its chunks as ring buffers, i.e. with D3D11_MAP_WRITE_NO_OVERWRITE at increasing offsets.
+This is only enabled for dynamic constant buffers, since they can only be bound with an offset since Direct3D 11.1 (see VSSetConstantBuffers1).
+*/
+static bool IsRingBufferSupported(ID3D11Device* device, D3D11_USAGE usage, UINT bindFlags)
 {
-    #if 0//TODO: Not sure if this is needed at the moment
-    //return (context->GetType() == D3D11_DEVICE_CONTEXT_DEFERRED);
+    if (usage != D3D11_USAGE_DYNAMIC || bindFlags != D3D11_BIND_CONSTANT_BUFFER)
+        return false;
+
+    #if LLGL_D3D11_ENABLE_FEATURELEVEL >= 1
+    D3D11_FEATURE_DATA_D3D11_OPTIONS options = {};
+    HRESULT hr = device->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS, &options, sizeof(options));
+    return (SUCCEEDED(hr) && options.ConstantBufferOffsetting != FALSE && options.MapNoOverwriteOnDynamicConstantBuffer != FALSE);
     #else
     return false;
     #endif
@@ -37,8 +49,10 @@ D3D11StagingBufferPool::D3D11StagingBufferPool(
     usage_            { usage                               },
     cpuAccessFlags_   { cpuAccessFlags                      },
     bindFlags_        { bindFlags                           },
-    incrementOffsets_ { IsSegmentedStagingRequired(context) }
+    incrementOffsets_ { IsRingBufferSupported(device, usage, bindFlags) }
 {
+    if (incrementOffsets_)
+        chunkSize_ = std::max(chunkSize_, g_minRingBufferChunkSize);
 }
 
 void D3D11StagingBufferPool::Reset()
@@ -52,6 +66,14 @@ D3D11BufferRange D3D11StagingBufferPool::Write(const void* data, UINT dataSize,
 {
     const UINT alignedSize = GetAlignedSize(dataSize, alignment);
 
+    /* Wrap around to the beginning of the current chunk if it's written as ring buffer; the next write discards its previous content */
+    if (incrementOffsets_ && chunkIdx_ < chunks_.size())
+    {
+        D3D11StagingBuffer& chunk = chunks_[chunkIdx_];
+        if (!chunk.Capacity(alignedSize) && alignedSize <= chunk.GetSize())
+            chunk.Reset();
+    }
+
     /* Check if a new chunk must be allocated */
     if (chunkIdx_ == chunks_.size())
         AllocChunk(alignedSize);
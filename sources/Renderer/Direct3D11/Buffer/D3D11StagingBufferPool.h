@@ -62,7 +62,7 @@ class D3D11StagingBufferPool
         D3D11_USAGE                     usage_              = D3D11_USAGE_STAGING;
         UINT                            cpuAccessFlags_     = D3D11_CPU_ACCESS_WRITE | D3D11_CPU_ACCESS_READ;
         UINT                            bindFlags_          = 0;
-        bool                            incrementOffsets_   = false;
+        bool                            incrementOffsets_   = false; // Chunks are written as ring buffers with D3D11_MAP_WRITE_NO_OVERWRITE.
 
 };
 
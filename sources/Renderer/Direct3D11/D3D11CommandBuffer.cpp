@@ -14,6 +14,8 @@
 #include "../ResourceUtils.h"
 #include <LLGL/Platform/NativeHandle.h>
 #include <LLGL/TypeInfo.h>
+#include <LLGL/Container/SmallVector.h>
+#include <LLGL/Utils/ForRange.h>
 #include "../../Core/CoreUtils.h"
 #include "../../Core/MacroUtils.h"
 #include "../../Core/StringUtils.h"
@@ -21,6 +23,8 @@
 #include "../TextureUtils.h"
 #include <algorithm>
 #include <codecvt>
+#include <thread>
+#include <vector>
 
 #include "RenderState/D3D11StateManager.h"
 #include "RenderState/D3D11PipelineState.h"
@@ -39,6 +43,9 @@
 #include "Texture/D3D11Sampler.h"
 #include "Texture/D3D11RenderTarget.h"
 #include "Texture/D3D11MipGenerator.h"
+#include "D3D11DeferredUploadQueue.h"
+#include "../DXCommon/Builtin/BlitTexture.hlsl.inl"
+#include "../../Core/ProfileZone.h"
 
 #include <LLGL/Backend/Direct3D11/NativeHandle.h>
 
@@ -56,11 +63,13 @@ D3D11CommandBuffer::D3D11CommandBuffer(
     ID3D11Device*                               device,
     const ComPtr<ID3D11DeviceContext>&          context,
     const std::shared_ptr<D3D11StateManager>&   stateMngr,
-    const CommandBufferDescriptor&              desc)
+    const CommandBufferDescriptor&              desc,
+    D3D11DeferredUploadQueue*                   uploadQueue)
 :
-    device_    { device    },
-    context_   { context   },
-    stateMngr_ { stateMngr }
+    device_      { device      },
+    context_     { context     },
+    stateMngr_   { stateMngr   },
+    uploadQueue_ { uploadQueue }
 {
     /* Store information whether the command buffer has an immediate or deferred context */
     if ((desc.flags & CommandBufferFlags::ImmediateSubmit) == 0)
@@ -79,11 +88,19 @@ D3D11CommandBuffer::D3D11CommandBuffer(
 
 void D3D11CommandBuffer::Begin()
 {
+    /* Commands of an immediate command buffer are executed right away, so resource updates from worker threads must be flushed first */
+    if (uploadQueue_ != nullptr)
+        uploadQueue_->Flush();
     stateMngr_->ResetStagingBufferPools();
+
+    /* Resource bindings are unknown at this point, e.g. ExecuteCommandList() clears the state of the immediate context */
+    stateMngr_->InvalidateResourceBindings();
 }
 
 void D3D11CommandBuffer::End()
 {
+    RestoreCopyComputeState();
+
     if (hasDeferredContext_)
     {
         /* Encode commands from deferred context into command list */
@@ -94,6 +111,8 @@ void D3D11CommandBuffer::End()
 
 void D3D11CommandBuffer::Execute(CommandBuffer& deferredCommandBuffer)
 {
+    RestoreCopyComputeState();
+
     auto& cmdBufferD3D = LLGL_CAST(D3D11CommandBuffer&, deferredCommandBuffer);
     if (cmdBufferD3D.IsSecondaryCmdBuffer())
     {
@@ -111,7 +130,7 @@ void D3D11CommandBuffer::UpdateBuffer(
     Buffer&         dstBuffer,
     std::uint64_t   dstOffset,
     const void*     data,
-    std::uint16_t   dataSize)
+    std::uint64_t   dataSize)
 {
     auto& dstBufferD3D = LLGL_CAST(D3D11Buffer&, dstBuffer);
     dstBufferD3D.WriteSubresource(context_.Get(), data, static_cast<UINT>(dataSize), static_cast<UINT>(dstOffset));
@@ -145,6 +164,15 @@ void D3D11CommandBuffer::CopyBuffer(
     );
 }
 
+void D3D11CommandBuffer::CopyBuffer(
+    Buffer&                                 dstBuffer,
+    Buffer&                                 srcBuffer,
+    const ArrayView<BufferCopyRegion>&      regions)
+{
+    for (const BufferCopyRegion& region : regions)
+        CopyBuffer(dstBuffer, region.dstOffset, srcBuffer, region.srcOffset, region.size);
+}
+
 // private
 void D3D11CommandBuffer::ClearWithIntermediateUAV(ID3D11Buffer* buffer, UINT offset, UINT size, const UINT (&valuesVec4)[4])
 {
@@ -180,6 +208,18 @@ struct CopyTextureBufferCbuffer
     std::uint32_t pad1[12 * 4];     // Padding to fill up constant buffer range of 256 bytes
 };
 
+// Maximum size (in bytes) of intermediate copy resources that are kept for subsequent copy commands
+static constexpr UINT           g_maxCopyResourceCacheSize  = 16u * 1024u * 1024u;
+static constexpr std::size_t    g_maxNumCopyTextures        = 4;
+
+static UINT RoundUpPow2(UINT value)
+{
+    UINT result = 1;
+    while (result < value)
+        result <<= 1;
+    return result;
+}
+
 // Returns a suitable array texture type if the input type allows an array texture as subresource view
 static TextureType ToArrayTextureType(const TextureType type)
 {
@@ -254,24 +294,17 @@ void D3D11CommandBuffer::CopyBufferFromTexture(
 
     const std::uint32_t copySize = (layerStride * srcExtent.depth);
 
-    /* Create intermediate SRV for source texture (RWTexture1D/2D/3D) */
+    /* Get SRV for source texture (Texture1D/2D/3D) */
     const auto& subresource = srcRegion.subresource;
     const auto textureArrayType = ToArrayTextureType(srcTextureD3D.GetType());
 
-    D3D11NativeTexture intermediateTexture;
     ComPtr<ID3D11ShaderResourceView> intermediateSRV;
 
     if (useIntermediateTexture)
     {
-        /* Create an intermediate copy of the destination texture with unsigned integer format */
-        srcTextureD3D.CreateSubresourceCopyWithUIntFormat(
-            device_,
-            intermediateTexture,
-            intermediateSRV.GetAddressOf(),
-            nullptr,
-            srcRegion,
-            textureArrayType
-        );
+        /* Get an intermediate copy of the source texture with unsigned integer format */
+        const D3D11CopyTexture copyTexture = GetCopyTexture(srcTextureD3D, srcRegion, textureArrayType, false);
+        intermediateSRV = copyTexture.srv;
 
         /* Copy source texture into intermediate texture */
         const UINT      mipLevel    = subresource.baseMipLevel;
@@ -289,7 +322,7 @@ void D3D11CommandBuffer::CopyBufferFromTexture(
         {
             const UINT arrayLayer = subresource.baseArrayLayer + i;
             context_->CopySubresourceRegion(
-                intermediateTexture.resource.Get(),                                             // pDstResource
+                copyTexture.native.Get(),                                                       // pDstResource
                 D3D11CalcSubresource(0, i, 1),                                                  // DstSubresource
                 0,                                                                              // DstX
                 0,                                                                              // DstY
@@ -302,7 +335,7 @@ void D3D11CommandBuffer::CopyBufferFromTexture(
     }
     else
     {
-        /* Create intermediate UAV directly from destination texture if the texture already has an unsigned integer format */
+        /* Create intermediate SRV directly from source texture if the texture already has an unsigned integer format */
         srcTextureD3D.CreateSubresourceSRV(
             device_,
             intermediateSRV.GetAddressOf(),
@@ -315,19 +348,8 @@ void D3D11CommandBuffer::CopyBufferFromTexture(
         );
     }
 
-    //TODO: check if intermediate UAV is necessary
-    /* Create intermediate byte-addressable buffer with UAV (RWByteAddressBuffer) */
-    ComPtr<ID3D11Buffer> intermediateBuffer;
-    ComPtr<ID3D11UnorderedAccessView> intermediateUAV;
-
-    CreateByteAddressBufferR32Typeless(
-        device_,
-        context_.Get(),
-        intermediateBuffer.GetAddressOf(),
-        nullptr,
-        intermediateUAV.GetAddressOf(),
-        copySize
-    );
+    /* Get intermediate byte-addressable buffer with UAV (RWByteAddressBuffer) */
+    const D3D11CopyBuffer copyBuffer = GetCopyBuffer(copySize);
 
     /* Set shader parameters with intermediate constant buffer */
     CopyTextureBufferCbuffer cbufferData;
@@ -355,18 +377,9 @@ void D3D11CommandBuffer::CopyBufferFromTexture(
         cbufferData.rowStride           = rowStride;
         cbufferData.layerStride         = layerStride;
     }
-    stateMngr_->SetConstants(0, &cbufferData, sizeof(cbufferData), StageFlags::ComputeStage);
-
-    /* Store currently bound resource views */
-    ID3D11UnorderedAccessView* prevUAVs[1];
-    ID3D11ShaderResourceView* prevSRVs[1];
-
-    context_->CSGetUnorderedAccessViews(0, 1, prevUAVs);
-    context_->CSGetShaderResources(0, 1, prevSRVs);
 
-    /* Bind destination texture and source buffer resourves */
-    context_->CSSetUnorderedAccessViews(0, 1, intermediateUAV.GetAddressOf(), nullptr);
-    context_->CSSetShaderResources(0, 1, intermediateSRV.GetAddressOf());
+    /* Bind source texture and destination buffer resources */
+    BindCopyShaderResources(intermediateSRV.Get(), copyBuffer.uav.Get(), &cbufferData, sizeof(cbufferData));
 
     /* Dispatch compute kernels with builtin shader */
     switch (textureArrayType)
@@ -384,17 +397,9 @@ void D3D11CommandBuffer::CopyBufferFromTexture(
             break;
     }
 
-    /* Restore previous resource views */
-    context_->CSSetUnorderedAccessViews(0, 1, prevUAVs, nullptr);
-    context_->CSSetShaderResources(0, 1, prevSRVs);
-
-    /* Copy UAV content into destination buffer, if an intermediate texture was used */
-    //if (useIntermediateBuffer)
-    {
-        /* Copy content from intermediate buffer to destination buffer */
-        const D3D11_BOX srcBox{ 0, 0, 0, copySize, 1, 1 };
-        context_->CopySubresourceRegion(dstBufferD3D.GetNative(), 0, dstOffsetU32, 0, 0, intermediateBuffer.Get(), 0, &srcBox);
-    }
+    /* Copy content from intermediate buffer to destination buffer */
+    const D3D11_BOX srcBox{ 0, 0, 0, copySize, 1, 1 };
+    context_->CopySubresourceRegion(dstBufferD3D.GetNative(), 0, dstOffsetU32, 0, 0, copyBuffer.native.Get(), 0, &srcBox);
 }
 
 void D3D11CommandBuffer::FillBuffer(
@@ -488,6 +493,15 @@ void D3D11CommandBuffer::CopyTexture(
     );
 }
 
+void D3D11CommandBuffer::CopyTexture(
+    Texture&                                dstTexture,
+    Texture&                                srcTexture,
+    const ArrayView<TextureCopyRegion>&     regions)
+{
+    for (const TextureCopyRegion& region : regions)
+        CopyTexture(dstTexture, region.dstLocation, srcTexture, region.srcLocation, region.extent);
+}
+
 /*
 D3D11 does not support copying data between buffers and textures natively,
 so this function dispatches a builtin compute shader to achieve the desired effect.
@@ -542,24 +556,18 @@ void D3D11CommandBuffer::CopyTextureFromBuffer(
 
     const std::uint32_t copySize = (layerStride * dstExtent.depth);
 
-    /* Create intermediate UAV for destination texture (RWTexture1D/2D/3D) */
+    /* Get UAV for destination texture (RWTexture1D/2D/3D) */
     const auto& subresource = dstRegion.subresource;
     const auto textureArrayType = ToArrayTextureType(dstTextureD3D.GetType());
 
-    D3D11NativeTexture intermediateTexture;
+    D3D11CopyTexture copyTexture;
     ComPtr<ID3D11UnorderedAccessView> intermediateUAV;
 
     if (useIntermediateTexture)
     {
-        /* Create an intermediate copy of the destination texture with unsigned integer format */
-        dstTextureD3D.CreateSubresourceCopyWithUIntFormat(
-            device_,
-            intermediateTexture,
-            nullptr,
-            intermediateUAV.GetAddressOf(),
-            dstRegion,
-            textureArrayType
-        );
+        /* Get an intermediate copy of the destination texture with unsigned integer format */
+        copyTexture = GetCopyTexture(dstTextureD3D, dstRegion, textureArrayType, true);
+        intermediateUAV = copyTexture.uav;
     }
     else
     {
@@ -575,23 +583,12 @@ void D3D11CommandBuffer::CopyTextureFromBuffer(
         );
     }
 
-    //TODO: check if intermediate SRV is necessary
-    /* Create intermediate byte-addressable buffer with SRV (ByteAddressBuffer) */
-    ComPtr<ID3D11Buffer> intermediateBuffer;
-    ComPtr<ID3D11ShaderResourceView> intermediateSRV;
-
-    CreateByteAddressBufferR32Typeless(
-        device_,
-        context_.Get(),
-        intermediateBuffer.GetAddressOf(),
-        intermediateSRV.GetAddressOf(),
-        nullptr,
-        copySize
-    );
+    /* Get intermediate byte-addressable buffer with SRV (ByteAddressBuffer) */
+    const D3D11CopyBuffer copyBuffer = GetCopyBuffer(copySize);
 
     /* Copy content from source buffer into the intermediate buffer */
     const D3D11_BOX srcBox{ srcOffsetU32, 0, 0, srcOffsetU32 + copySize, 1, 1 };
-    context_->CopySubresourceRegion(intermediateBuffer.Get(), 0, 0, 0, 0, srcBufferD3D.GetNative(), 0, &srcBox);
+    context_->CopySubresourceRegion(copyBuffer.native.Get(), 0, 0, 0, 0, srcBufferD3D.GetNative(), 0, &srcBox);
 
     /* Set shader parameters with intermediate constant buffer */
     CopyTextureBufferCbuffer cbufferData;
@@ -619,18 +616,9 @@ void D3D11CommandBuffer::CopyTextureFromBuffer(
         cbufferData.rowStride           = rowStride;
         cbufferData.layerStride         = layerStride;
     }
-    stateMngr_->SetConstants(0, &cbufferData, sizeof(cbufferData), StageFlags::ComputeStage);
-
-    /* Store currently bound resource views */
-    ID3D11UnorderedAccessView* prevUAVs[1];
-    ID3D11ShaderResourceView* prevSRVs[1];
 
-    context_->CSGetUnorderedAccessViews(0, 1, prevUAVs);
-    context_->CSGetShaderResources(0, 1, prevSRVs);
-
-    /* Bind destination texture and source buffer resourves */
-    context_->CSSetUnorderedAccessViews(0, 1, intermediateUAV.GetAddressOf(), nullptr);
-    context_->CSSetShaderResources(0, 1, intermediateSRV.GetAddressOf());
+    /* Bind source buffer and destination texture resources */
+    BindCopyShaderResources(copyBuffer.srv.Get(), intermediateUAV.Get(), &cbufferData, sizeof(cbufferData));
 
     /* Dispatch compute kernels with builtin shader */
     switch (textureArrayType)
@@ -648,10 +636,6 @@ void D3D11CommandBuffer::CopyTextureFromBuffer(
             break;
     }
 
-    /* Restore previous resource views */
-    context_->CSSetUnorderedAccessViews(0, 1, prevUAVs, nullptr);
-    context_->CSSetShaderResources(0, 1, prevSRVs);
-
     /* Copy UAV content into destination texture, if an intermediate texture was used */
     if (useIntermediateTexture)
     {
@@ -667,7 +651,7 @@ void D3D11CommandBuffer::CopyTextureFromBuffer(
                 static_cast<UINT>(dstOffset.x),                                                 // DstX
                 static_cast<UINT>(dstOffset.y),                                                 // DstY
                 static_cast<UINT>(dstOffset.z),                                                 // DstZ
-                intermediateTexture.resource.Get(),                                             // pSrcResource
+                copyTexture.native.Get(),                                                       // pSrcResource
                 D3D11CalcSubresource(0, i, 1),                                                  // SrcSubresource
                 &srcBox                                                                         // pSrcBox
             );
@@ -675,6 +659,15 @@ void D3D11CommandBuffer::CopyTextureFromBuffer(
     }
 }
 
+void D3D11CommandBuffer::CopyTextureFromBuffer(
+    Texture&                                    dstTexture,
+    Buffer&                                     srcBuffer,
+    const ArrayView<BufferTextureCopyRegion>&   regions)
+{
+    for (const BufferTextureCopyRegion& region : regions)
+        CopyTextureFromBuffer(dstTexture, region.textureRegion, srcBuffer, region.bufferOffset, region.rowStride, region.layerStride);
+}
+
 void D3D11CommandBuffer::CopyTextureFromFramebuffer(
     Texture&                dstTexture,
     const TextureRegion&    dstRegion,
@@ -714,6 +707,61 @@ void D3D11CommandBuffer::CopyTextureFromFramebuffer(
     #endif
 }
 
+void D3D11CommandBuffer::BlitTexture(
+    Texture&                dstTexture,
+    const TextureRegion&    dstRegion,
+    Texture&                srcTexture,
+    const TextureRegion&    srcRegion,
+    const SamplerFilter     filter)
+{
+    if (dstRegion.extent.width == 0 || dstRegion.extent.height == 0 || srcRegion.extent.width == 0 || srcRegion.extent.height == 0)
+        return;
+
+    /* Builtin blit shader is compiled on first use */
+    if (!D3D11BuiltinShaderFactory::Get().CompileRuntimeBuiltinShader(D3D11BuiltinShader::BlitTexture2DCS))
+        return /*E_FAIL*/;
+
+    auto& dstTextureD3D = LLGL_CAST(D3D11Texture&, dstTexture);
+    auto& srcTextureD3D = LLGL_CAST(D3D11Texture&, srcTexture);
+
+    /* Create views for a single MIP-map level and array layer of each texture */
+    ComPtr<ID3D11ShaderResourceView> srcSRV;
+    srcTextureD3D.CreateSubresourceSRV(
+        device_,
+        srcSRV.GetAddressOf(),
+        TextureType::Texture2DArray,
+        srcTextureD3D.GetBaseDXFormat(),
+        srcRegion.subresource.baseMipLevel,
+        1,
+        srcRegion.subresource.baseArrayLayer,
+        1
+    );
+
+    ComPtr<ID3D11UnorderedAccessView> dstUAV;
+    dstTextureD3D.CreateSubresourceUAV(
+        device_,
+        dstUAV.GetAddressOf(),
+        TextureType::Texture2DArray,
+        dstTextureD3D.GetBaseDXFormat(),
+        dstRegion.subresource.baseMipLevel,
+        dstRegion.subresource.baseArrayLayer,
+        1
+    );
+
+    /* Bind source and destination views with blit descriptor and dispatch builtin shader; previous bindings are restored by RestoreCopyComputeState() */
+    DXBlitTextureDescriptor cbufferData;
+    DXInitBlitTextureDescriptor(cbufferData, dstRegion, srcRegion, filter);
+
+    BindCopyShaderResources(srcSRV.Get(), dstUAV.Get(), &cbufferData, sizeof(cbufferData));
+
+    stateMngr_->DispatchBuiltin(
+        D3D11BuiltinShader::BlitTexture2DCS,
+        DivideRoundUp(dstRegion.extent.width,  8u),
+        DivideRoundUp(dstRegion.extent.height, 8u),
+        1u
+    );
+}
+
 void D3D11CommandBuffer::GenerateMips(Texture& texture)
 {
     auto& textureD3D = LLGL_CAST(D3D11Texture&, texture);
@@ -757,13 +805,13 @@ void D3D11CommandBuffer::SetScissors(std::uint32_t numScissors, const Scissor* s
 
 /* ----- Input Assembly ------ */
 
-void D3D11CommandBuffer::SetVertexBuffer(Buffer& buffer)
+void D3D11CommandBuffer::SetVertexBuffer(Buffer& buffer, std::uint64_t offset)
 {
     auto& bufferD3D = LLGL_CAST(D3D11Buffer&, buffer);
 
     ID3D11Buffer* buffers[] = { bufferD3D.GetNative() };
     UINT strides[] = { bufferD3D.GetStride() };
-    UINT offsets[] = { 0 };
+    UINT offsets[] = { static_cast<UINT>(offset) };
 
     context_->IASetVertexBuffers(0, 1, buffers, strides, offsets);
 }
@@ -780,6 +828,30 @@ void D3D11CommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
     );
 }
 
+void D3D11CommandBuffer::SetVertexBuffers(std::uint32_t firstSlot, std::uint32_t numBuffers, Buffer* const * buffers, const std::uint64_t* offsets)
+{
+    SmallVector<ID3D11Buffer*> buffersD3D;
+    SmallVector<UINT, 32> stridesAndOffsets;
+    buffersD3D.resize(numBuffers);
+    stridesAndOffsets.resize(numBuffers * 2);
+
+    for_range(i, numBuffers)
+    {
+        auto* bufferD3D = LLGL_CAST(D3D11Buffer*, buffers[i]);
+        buffersD3D[i]                       = bufferD3D->GetNative();
+        stridesAndOffsets[i]                = bufferD3D->GetStride();
+        stridesAndOffsets[i + numBuffers]   = (offsets != nullptr ? static_cast<UINT>(offsets[i]) : 0u);
+    }
+
+    context_->IASetVertexBuffers(
+        firstSlot,
+        numBuffers,
+        buffersD3D.data(),
+        stridesAndOffsets.data(),
+        stridesAndOffsets.data() + numBuffers
+    );
+}
+
 void D3D11CommandBuffer::SetIndexBuffer(Buffer& buffer)
 {
     auto& bufferD3D = LLGL_CAST(D3D11Buffer&, buffer);
@@ -796,31 +868,22 @@ void D3D11CommandBuffer::SetIndexBuffer(Buffer& buffer, const Format format, std
 
 void D3D11CommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap, std::uint32_t descriptorSet)
 {
+    RestoreCopyComputeState();
+
     if (boundPipelineState_ == nullptr)
         return /*E_POINTER*/;
 
     auto& resourceHeapD3D = LLGL_CAST(D3D11ResourceHeap&, resourceHeap);
-
-    #if LLGL_D3D11_ENABLE_FEATURELEVEL >= 1
-    if (context1_.Get() != nullptr)
-    {
-        if (boundPipelineState_->IsGraphicsPSO())
-            resourceHeapD3D.BindForGraphicsPipeline1(context1_.Get(), descriptorSet);
-        else
-            resourceHeapD3D.BindForComputePipeline1(context1_.Get(), descriptorSet);
-    }
+    if (boundPipelineState_->IsGraphicsPSO())
+        resourceHeapD3D.BindForGraphicsPipeline(*stateMngr_, descriptorSet);
     else
-    #endif // /LLGL_D3D11_ENABLE_FEATURELEVEL
-    {
-        if (boundPipelineState_->IsGraphicsPSO())
-            resourceHeapD3D.BindForGraphicsPipeline(context_.Get(), descriptorSet);
-        else
-            resourceHeapD3D.BindForComputePipeline(context_.Get(), descriptorSet);
-    }
+        resourceHeapD3D.BindForComputePipeline(*stateMngr_, descriptorSet);
 }
 
 void D3D11CommandBuffer::SetResource(std::uint32_t descriptor, Resource& resource)
 {
+    RestoreCopyComputeState();
+
     if (boundPipelineLayout_ == nullptr)
         return /*E_POINTER*/;
 
@@ -828,59 +891,25 @@ void D3D11CommandBuffer::SetResource(std::uint32_t descriptor, Resource& resourc
     if (!(descriptor < bindingList.size()))
         return /*E_INVALIDARG*/;
 
-    const auto& binding = bindingList[descriptor];
-    switch (binding.type)
-    {
-        case D3DResourceType_CBV:
-        {
-            auto& bufferD3D = LLGL_CAST(D3D11Buffer&, resource);
-            ID3D11Buffer* cbv[] = { bufferD3D.GetNative() };
-            stateMngr_->SetConstantBuffers(binding.slot, 1, cbv, binding.stageFlags);
-        }
-        break;
-
-        case D3DResourceType_BufferSRV:
-        {
-            auto& bufferD3D = LLGL_CAST(D3D11BufferWithRV&, resource);
-            ID3D11ShaderResourceView* srv[] = { bufferD3D.GetSRV() };
-            stateMngr_->SetShaderResources(binding.slot, 1, srv, binding.stageFlags);
-        }
-        break;
+    SetResourceWithBinding(bindingList[descriptor], resource);
+}
 
-        case D3DResourceType_BufferUAV:
-        {
-            auto& bufferD3D = LLGL_CAST(D3D11BufferWithRV&, resource);
-            ID3D11UnorderedAccessView* uav[] = { bufferD3D.GetUAV() };
-            UINT auvCounts[] = { bufferD3D.GetInitialCount() };
-            stateMngr_->SetUnorderedAccessViews(binding.slot, 1, uav, auvCounts, binding.stageFlags);
-        }
-        break;
+void D3D11CommandBuffer::SetResources(std::uint32_t firstDescriptor, const ArrayView<Resource*>& resources)
+{
+    RestoreCopyComputeState();
 
-        case D3DResourceType_TextureSRV:
-        {
-            auto& textureD3D = LLGL_CAST(D3D11Texture&, resource);
-            ID3D11ShaderResourceView* srv[] = { textureD3D.GetSRV() };
-            stateMngr_->SetShaderResources(binding.slot, 1, srv, binding.stageFlags);
-        }
-        break;
+    if (boundPipelineLayout_ == nullptr)
+        return /*E_POINTER*/;
 
-        case D3DResourceType_TextureUAV:
-        {
-            auto& textureD3D = LLGL_CAST(D3D11Texture&, resource);
-            ID3D11UnorderedAccessView* uav[] = { textureD3D.GetUAV() };
-            UINT auvCounts[] = { 0 };
-            stateMngr_->SetUnorderedAccessViews(binding.slot, 1, uav, auvCounts, binding.stageFlags);
-        }
-        break;
+    const auto& bindingList = boundPipelineLayout_->GetBindings();
+    if (!(firstDescriptor < bindingList.size()))
+        return /*E_INVALIDARG*/;
 
-        case D3DResourceType_Sampler:
-        {
-            /* Set sampler state object to all shader stages */
-            auto& samplerD3D = LLGL_CAST(D3D11Sampler&, resource);
-            ID3D11SamplerState* samplerStates[] = { samplerD3D.GetNative() };
-            stateMngr_->SetSamplers(binding.slot, 1, samplerStates, binding.stageFlags);
-        }
-        break;
+    const std::size_t numDescriptors = std::min(resources.size(), bindingList.size() - firstDescriptor);
+    for (std::size_t i = 0; i < numDescriptors; ++i)
+    {
+        if (Resource* resource = resources[i])
+            SetResourceWithBinding(bindingList[firstDescriptor + i], *resource);
     }
 }
 
@@ -891,6 +920,8 @@ void D3D11CommandBuffer::ResetResourceSlots(
     long                bindFlags,
     long                stageFlags)
 {
+    RestoreCopyComputeState();
+
     if (numSlots > 0)
     {
         /* Reset resource binding slots */
@@ -911,6 +942,11 @@ void D3D11CommandBuffer::ResetResourceSlots(
     }
 }
 
+void D3D11CommandBuffer::ResourceBarrier(std::uint32_t /*numBarriers*/, const ResourceBarrierDescriptor* /*barriers*/)
+{
+    // dummy; D3D11 synchronizes resource accesses implicitly
+}
+
 /* ----- Render Passes ----- */
 
 void D3D11CommandBuffer::BeginRenderPass(
@@ -920,6 +956,8 @@ void D3D11CommandBuffer::BeginRenderPass(
     const ClearValue*   clearValues,
     std::uint32_t       /*swapBufferIndex*/)
 {
+    LLGL_PROFILE_ZONE("BeginRenderPass");
+
     /* Bind render target/context */
     if (LLGL::IsInstanceOf<SwapChain>(renderTarget))
         BindSwapChain(LLGL_CAST(D3D11SwapChain&, renderTarget));
@@ -939,6 +977,11 @@ void D3D11CommandBuffer::EndRenderPass()
     // dummy
 }
 
+void D3D11CommandBuffer::NextSubpass()
+{
+    // dummy
+}
+
 static UINT GetClearFlagsDSV(long flags)
 {
     UINT clearFlagsDSV = 0;
@@ -1010,6 +1053,8 @@ void D3D11CommandBuffer::ClearAttachments(std::uint32_t numAttachments, const At
 
 void D3D11CommandBuffer::SetPipelineState(PipelineState& pipelineState)
 {
+    RestoreCopyComputeState();
+
     auto pipelineStateD3D = LLGL_CAST(D3D11PipelineState*, &pipelineState);
     if (boundPipelineState_ != pipelineStateD3D)
     {
@@ -1032,6 +1077,31 @@ void D3D11CommandBuffer::SetStencilReference(std::uint32_t reference, const Sten
     stateMngr_->SetStencilRef(reference);
 }
 
+void D3D11CommandBuffer::SetShadingRate(const ShadingRate /*rate*/)
+{
+    // not supported by this backend
+}
+
+void D3D11CommandBuffer::SetCullMode(const CullMode /*cullMode*/)
+{
+    // not supported by this backend
+}
+
+void D3D11CommandBuffer::SetDepthState(const DepthDescriptor& /*depthDesc*/)
+{
+    // not supported by this backend
+}
+
+void D3D11CommandBuffer::SetStencilState(const StencilDescriptor& /*stencilDesc*/)
+{
+    // not supported by this backend
+}
+
+void D3D11CommandBuffer::SetPrimitiveTopology(const PrimitiveTopology /*topology*/)
+{
+    // not supported by this backend
+}
+
 void D3D11CommandBuffer::SetUniforms(std::uint32_t first, const void* data, std::uint16_t dataSize)
 {
     if (boundConstantsCache_ != nullptr)
@@ -1087,11 +1157,77 @@ void D3D11CommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::uint32_
     );
 }
 
+void D3D11CommandBuffer::BeginRenderCondition(Buffer& /*buffer*/, std::uint64_t /*offset*/, const RenderConditionMode /*mode*/)
+{
+    /* D3D11 only supports ID3D11Predicate objects as render condition; this is a no-op that renders unconditionally */
+}
+
 void D3D11CommandBuffer::EndRenderCondition()
 {
     context_->SetPredication(nullptr, FALSE);
 }
 
+// Waits until the specified query result is available and reads it into the output data.
+static void D3D11GetQueryDataBlocking(ID3D11DeviceContext* context, ID3D11Asynchronous* query, void* data, UINT dataSize)
+{
+    while (context->GetData(query, data, dataSize, 0) == S_FALSE)
+        std::this_thread::yield();
+}
+
+void D3D11CommandBuffer::ResolveQueries(QueryHeap& queryHeap, std::uint32_t firstQuery, std::uint32_t numQueries, Buffer& dstBuffer, std::uint64_t dstOffset)
+{
+    /* Query results cannot be read back while a deferred context is being recorded */
+    if (hasDeferredContext_ || numQueries == 0)
+        return;
+
+    auto& queryHeapD3D = LLGL_CAST(D3D11QueryHeap&, queryHeap);
+    auto& dstBufferD3D = LLGL_CAST(D3D11Buffer&, dstBuffer);
+
+    if (queryHeapD3D.GetNativeType() == D3D11_QUERY_PIPELINE_STATISTICS)
+    {
+        /* Read back pipeline statistics and convert them to LLGL layout */
+        std::vector<QueryPipelineStatistics> results(numQueries);
+        for_range(i, numQueries)
+        {
+            D3D11_QUERY_DATA_PIPELINE_STATISTICS tempData;
+            D3D11GetQueryDataBlocking(context_.Get(), queryHeapD3D.GetNative(firstQuery + i), &tempData, sizeof(tempData));
+            results[i].inputAssemblyVertices            = tempData.IAVertices;
+            results[i].inputAssemblyPrimitives          = tempData.IAPrimitives;
+            results[i].vertexShaderInvocations          = tempData.VSInvocations;
+            results[i].geometryShaderInvocations        = tempData.GSInvocations;
+            results[i].geometryShaderPrimitives         = tempData.GSPrimitives;
+            results[i].clippingInvocations              = tempData.CInvocations;
+            results[i].clippingPrimitives               = tempData.CPrimitives;
+            results[i].fragmentShaderInvocations        = tempData.PSInvocations;
+            results[i].tessControlShaderInvocations     = tempData.HSInvocations;
+            results[i].tessEvaluationShaderInvocations  = tempData.DSInvocations;
+            results[i].computeShaderInvocations         = tempData.CSInvocations;
+        }
+        dstBufferD3D.WriteSubresource(context_.Get(), results.data(), static_cast<UINT>(numQueries * sizeof(QueryPipelineStatistics)), static_cast<UINT>(dstOffset));
+    }
+    else
+    {
+        /* Read back occlusion query results as 64-bit integers */
+        std::vector<std::uint64_t> results(numQueries, 0);
+        for_range(i, numQueries)
+        {
+            if (queryHeapD3D.GetNativeType() == D3D11_QUERY_OCCLUSION_PREDICATE)
+            {
+                BOOL tempData = FALSE;
+                D3D11GetQueryDataBlocking(context_.Get(), queryHeapD3D.GetPredicate(firstQuery + i), &tempData, sizeof(tempData));
+                results[i] = static_cast<std::uint64_t>(tempData);
+            }
+            else
+            {
+                UINT64 tempData = 0;
+                D3D11GetQueryDataBlocking(context_.Get(), queryHeapD3D.GetNative(firstQuery + i), &tempData, sizeof(tempData));
+                results[i] = tempData;
+            }
+        }
+        dstBufferD3D.WriteSubresource(context_.Get(), results.data(), static_cast<UINT>(numQueries * sizeof(std::uint64_t)), static_cast<UINT>(dstOffset));
+    }
+}
+
 /* ----- Stream Output ------ */
 
 void D3D11CommandBuffer::BeginStreamOutput(std::uint32_t numBuffers, Buffer* const * buffers)
@@ -1109,6 +1245,9 @@ void D3D11CommandBuffer::BeginStreamOutput(std::uint32_t numBuffers, Buffer* con
     }
 
     context_->SOSetTargets(numBuffers, soTargets, offsets);
+
+    /* Binding stream-output targets implicitly unbinds SRVs of the same resources */
+    stateMngr_->InvalidateShaderResources();
 }
 
 void D3D11CommandBuffer::EndStreamOutput()
@@ -1184,6 +1323,17 @@ void D3D11CommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std:
     }
 }
 
+void D3D11CommandBuffer::DrawIndirect(
+    Buffer&         /*buffer*/,
+    std::uint64_t   /*offset*/,
+    Buffer&         /*countBuffer*/,
+    std::uint64_t   /*countBufferOffset*/,
+    std::uint32_t   /*maxNumCommands*/,
+    std::uint32_t   /*stride*/)
+{
+    // not supported by this backend
+}
+
 void D3D11CommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
 {
     FlushConstantsCache();
@@ -1202,21 +1352,67 @@ void D3D11CommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offse
     }
 }
 
+void D3D11CommandBuffer::DrawIndexedIndirect(
+    Buffer&         /*buffer*/,
+    std::uint64_t   /*offset*/,
+    Buffer&         /*countBuffer*/,
+    std::uint64_t   /*countBufferOffset*/,
+    std::uint32_t   /*maxNumCommands*/,
+    std::uint32_t   /*stride*/)
+{
+    // not supported by this backend
+}
+
+void D3D11CommandBuffer::DrawStreamOutput()
+{
+    FlushConstantsCache();
+    context_->DrawAuto();
+}
+
+void D3D11CommandBuffer::DrawMesh(std::uint32_t /*numWorkGroupsX*/, std::uint32_t /*numWorkGroupsY*/, std::uint32_t /*numWorkGroupsZ*/)
+{
+    // not supported by this backend
+}
+
+void D3D11CommandBuffer::DrawMeshIndirect(Buffer& /*buffer*/, std::uint64_t /*offset*/, std::uint32_t /*numCommands*/, std::uint32_t /*stride*/)
+{
+    // not supported by this backend
+}
+
 /* ----- Compute ----- */
 
 void D3D11CommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
 {
+    RestoreCopyComputeState();
     FlushConstantsCache();
     context_->Dispatch(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
 }
 
 void D3D11CommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
 {
+    RestoreCopyComputeState();
     FlushConstantsCache();
     auto& bufferD3D = LLGL_CAST(D3D11Buffer&, buffer);
     context_->DispatchIndirect(bufferD3D.GetNative(), static_cast<UINT>(offset));
 }
 
+/* ----- Ray Tracing ----- */
+
+void D3D11CommandBuffer::BuildAccelerationStructure(const AccelerationStructureBuildDescriptor& /*buildDesc*/)
+{
+    // not supported by this backend
+}
+
+void D3D11CommandBuffer::CopyAccelerationStructure(Buffer& /*dst*/, Buffer& /*src*/, const AccelerationStructureCopyMode /*mode*/)
+{
+    // not supported by this backend
+}
+
+void D3D11CommandBuffer::WriteAccelerationStructureCompactedSize(Buffer& /*src*/, Buffer& /*dstBuffer*/, std::uint64_t /*dstOffset*/)
+{
+    // not supported by this backend
+}
+
 /* ----- Debugging ----- */
 
 void D3D11CommandBuffer::PushDebugGroup(const char* name)
@@ -1247,6 +1443,9 @@ void D3D11CommandBuffer::DoNativeCommand(const void* nativeCommand, std::size_t
 
 bool D3D11CommandBuffer::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
 {
+    /* Native context must not expose the intermediate bindings of previous copy commands */
+    RestoreCopyComputeState();
+
     if (nativeHandle != nullptr && nativeHandleSize == sizeof(Direct3D11::CommandBufferNativeHandle))
     {
         auto* nativeHandleD3D = reinterpret_cast<Direct3D11::CommandBufferNativeHandle*>(nativeHandle);
@@ -1262,6 +1461,63 @@ bool D3D11CommandBuffer::GetNativeHandle(void* nativeHandle, std::size_t nativeH
  * ======= Private: =======
  */
 
+void D3D11CommandBuffer::SetResourceWithBinding(const D3D11PipelineResourceBinding& binding, Resource& resource)
+{
+    switch (binding.type)
+    {
+        case D3DResourceType_CBV:
+        {
+            auto& bufferD3D = LLGL_CAST(D3D11Buffer&, resource);
+            ID3D11Buffer* cbv[] = { bufferD3D.GetNative() };
+            stateMngr_->SetConstantBuffers(binding.slot, 1, cbv, binding.stageFlags);
+        }
+        break;
+
+        case D3DResourceType_BufferSRV:
+        {
+            auto& bufferD3D = LLGL_CAST(D3D11BufferWithRV&, resource);
+            ID3D11ShaderResourceView* srv[] = { bufferD3D.GetSRV() };
+            stateMngr_->SetShaderResources(binding.slot, 1, srv, binding.stageFlags);
+        }
+        break;
+
+        case D3DResourceType_BufferUAV:
+        {
+            auto& bufferD3D = LLGL_CAST(D3D11BufferWithRV&, resource);
+            ID3D11UnorderedAccessView* uav[] = { bufferD3D.GetUAV() };
+            UINT auvCounts[] = { bufferD3D.GetInitialCount() };
+            stateMngr_->SetUnorderedAccessViews(binding.slot, 1, uav, auvCounts, binding.stageFlags);
+        }
+        break;
+
+        case D3DResourceType_TextureSRV:
+        {
+            auto& textureD3D = LLGL_CAST(D3D11Texture&, resource);
+            ID3D11ShaderResourceView* srv[] = { textureD3D.GetSRV() };
+            stateMngr_->SetShaderResources(binding.slot, 1, srv, binding.stageFlags);
+        }
+        break;
+
+        case D3DResourceType_TextureUAV:
+        {
+            auto& textureD3D = LLGL_CAST(D3D11Texture&, resource);
+            ID3D11UnorderedAccessView* uav[] = { textureD3D.GetUAV() };
+            UINT auvCounts[] = { 0 };
+            stateMngr_->SetUnorderedAccessViews(binding.slot, 1, uav, auvCounts, binding.stageFlags);
+        }
+        break;
+
+        case D3DResourceType_Sampler:
+        {
+            /* Set sampler state object to all shader stages */
+            auto& samplerD3D = LLGL_CAST(D3D11Sampler&, resource);
+            ID3D11SamplerState* samplerStates[] = { samplerD3D.GetNative() };
+            stateMngr_->SetSamplers(binding.slot, 1, samplerStates, binding.stageFlags);
+        }
+        break;
+    }
+}
+
 void D3D11CommandBuffer::ResetBufferResourceSlots(std::uint32_t firstSlot, std::uint32_t numSlots, long bindFlags, long stageFlags)
 {
     /* Reset vertex buffer slots */
@@ -1409,6 +1665,9 @@ void D3D11CommandBuffer::BindFramebufferView(
         depthStencilView
     );
 
+    /* Binding render targets implicitly unbinds SRVs of the same resources */
+    stateMngr_->InvalidateShaderResources();
+
     /* Store new render-target configuration */
     framebufferView_.numRenderTargetViews   = numRenderTargetViews;
     framebufferView_.renderTargetViews      = renderTargetViews;
@@ -1593,6 +1852,205 @@ void D3D11CommandBuffer::CreateByteAddressBufferR32Typeless(
     }
 }
 
+D3D11CommandBuffer::D3D11CopyBuffer D3D11CommandBuffer::GetCopyBuffer(UINT size)
+{
+    if (size > g_maxCopyResourceCacheSize)
+    {
+        /* Create temporary buffer for large copy commands */
+        D3D11CopyBuffer copyBuffer;
+        CreateByteAddressBufferR32Typeless(
+            device_,
+            context_.Get(),
+            copyBuffer.native.GetAddressOf(),
+            copyBuffer.srv.GetAddressOf(),
+            copyBuffer.uav.GetAddressOf(),
+            size
+        );
+        copyBuffer.size = size;
+        return copyBuffer;
+    }
+
+    if (copyBuffer_.size < size)
+    {
+        /* Grow intermediate buffer to the next power of two, so copy commands of varying size don't re-allocate it each time */
+        const UINT newSize = std::max(RoundUpPow2(size), 4096u);
+        CreateByteAddressBufferR32Typeless(
+            device_,
+            context_.Get(),
+            copyBuffer_.native.ReleaseAndGetAddressOf(),
+            copyBuffer_.srv.ReleaseAndGetAddressOf(),
+            copyBuffer_.uav.ReleaseAndGetAddressOf(),
+            newSize
+        );
+        copyBuffer_.size = newSize;
+    }
+
+    return copyBuffer_;
+}
+
+D3D11CommandBuffer::D3D11CopyTexture D3D11CommandBuffer::GetCopyTexture(
+    D3D11Texture&           textureD3D,
+    const TextureRegion&    region,
+    const TextureType       subresourceType,
+    bool                    writeAccess)
+{
+    const DXGI_FORMAT   format          = DXTypes::ToDXGIFormatUInt(textureD3D.GetBaseDXFormat());
+    const Extent3D&     extent          = region.extent;
+    const UINT          numArrayLayers  = region.subresource.numArrayLayers;
+
+    /* Find intermediate texture that is large enough from previous copy commands */
+    for (auto it = copyTextures_.begin(); it != copyTextures_.end(); ++it)
+    {
+        if (it->format         == format          &&
+            it->type           == subresourceType &&
+            it->writeAccess    == writeAccess     &&
+            it->extent.width   >= extent.width    &&
+            it->extent.height  >= extent.height   &&
+            it->extent.depth   >= extent.depth    &&
+            it->numArrayLayers >= numArrayLayers)
+        {
+            /* Move entry to the front to keep the most recently used textures */
+            std::rotate(copyTextures_.begin(), it, it + 1);
+            return copyTextures_.front();
+        }
+    }
+
+    /* Round up extent to the next power of two, so the texture can be reused by subsequent copy commands */
+    TextureRegion copyRegion;
+    {
+        copyRegion.subresource.numArrayLayers   = RoundUpPow2(numArrayLayers);
+        copyRegion.extent.width                 = RoundUpPow2(extent.width);
+        copyRegion.extent.height                = RoundUpPow2(extent.height);
+        copyRegion.extent.depth                 = RoundUpPow2(extent.depth);
+    }
+
+    const std::uint64_t copySize =
+    (
+        static_cast<std::uint64_t>(copyRegion.extent.width) *
+        copyRegion.extent.height *
+        copyRegion.extent.depth *
+        copyRegion.subresource.numArrayLayers *
+        (GetFormatAttribs(textureD3D.GetFormat()).bitSize / 8)
+    );
+
+    const bool isCacheable = (copySize <= g_maxCopyResourceCacheSize);
+    if (!isCacheable)
+    {
+        /* Create temporary texture with the exact region for large copy commands */
+        copyRegion.subresource.numArrayLayers   = numArrayLayers;
+        copyRegion.extent                       = extent;
+    }
+
+    D3D11CopyTexture    copyTexture;
+    D3D11NativeTexture  intermediateTexture;
+
+    textureD3D.CreateSubresourceCopyWithUIntFormat(
+        device_,
+        intermediateTexture,
+        (writeAccess ? nullptr : copyTexture.srv.GetAddressOf()),
+        (writeAccess ? copyTexture.uav.GetAddressOf() : nullptr),
+        copyRegion,
+        subresourceType
+    );
+
+    copyTexture.native          = intermediateTexture.resource;
+    copyTexture.format          = format;
+    copyTexture.type            = subresourceType;
+    copyTexture.extent          = copyRegion.extent;
+    copyTexture.numArrayLayers  = copyRegion.subresource.numArrayLayers;
+    copyTexture.writeAccess     = writeAccess;
+
+    if (isCacheable)
+    {
+        if (copyTextures_.size() >= g_maxNumCopyTextures)
+            copyTextures_.pop_back();
+        copyTextures_.insert(copyTextures_.begin(), copyTexture);
+    }
+
+    return copyTexture;
+}
+
+void D3D11CommandBuffer::BindCopyShaderResources(
+    ID3D11ShaderResourceView*   srv,
+    ID3D11UnorderedAccessView*  uav,
+    const void*                 constants,
+    UINT                        constantsSize)
+{
+    if (!copyComputeState_.isSaved)
+    {
+        /* Store compute stage bindings only once for consecutive copy commands; they are restored lazily by RestoreCopyComputeState() */
+        context_->CSGetShaderResources(0, 1, copyComputeState_.srv.ReleaseAndGetAddressOf());
+        context_->CSGetUnorderedAccessViews(0, 1, copyComputeState_.uav.ReleaseAndGetAddressOf());
+
+        #if LLGL_D3D11_ENABLE_FEATURELEVEL >= 1
+        if (context1_.Get() != nullptr)
+        {
+            context1_->CSGetConstantBuffers1(
+                0,
+                1,
+                copyComputeState_.cbuffer.ReleaseAndGetAddressOf(),
+                &(copyComputeState_.firstConstant),
+                &(copyComputeState_.numConstants)
+            );
+        }
+        else
+        #endif // /LLGL_D3D11_ENABLE_FEATURELEVEL
+        {
+            context_->CSGetConstantBuffers(0, 1, copyComputeState_.cbuffer.ReleaseAndGetAddressOf());
+        }
+
+        copyComputeState_.isSaved = true;
+    }
+
+    stateMngr_->SetConstants(0, constants, constantsSize, StageFlags::ComputeStage);
+
+    /*
+    Unbind SRV before the UAV is bound, because the previous copy command might have bound the same resource with the opposite view,
+    e.g. the intermediate buffer is an SRV for CopyTextureFromBuffer() but a UAV for CopyBufferFromTexture().
+    */
+    context_->CSSetShaderResources(0, 1, reinterpret_cast<ID3D11ShaderResourceView* const*>(g_nullResources));
+    context_->CSSetUnorderedAccessViews(0, 1, &uav, nullptr);
+    context_->CSSetShaderResources(0, 1, &srv);
+}
+
+void D3D11CommandBuffer::RestoreCopyComputeState()
+{
+    if (!copyComputeState_.isSaved)
+        return;
+
+    /* Restore resource views in the same order as they were overridden */
+    context_->CSSetShaderResources(0, 1, reinterpret_cast<ID3D11ShaderResourceView* const*>(g_nullResources));
+    context_->CSSetUnorderedAccessViews(0, 1, copyComputeState_.uav.GetAddressOf(), nullptr);
+    context_->CSSetShaderResources(0, 1, copyComputeState_.srv.GetAddressOf());
+
+    #if LLGL_D3D11_ENABLE_FEATURELEVEL >= 1
+    if (context1_.Get() != nullptr && copyComputeState_.numConstants > 0)
+    {
+        context1_->CSSetConstantBuffers1(
+            0,
+            1,
+            copyComputeState_.cbuffer.GetAddressOf(),
+            &(copyComputeState_.firstConstant),
+            &(copyComputeState_.numConstants)
+        );
+    }
+    else
+    #endif // /LLGL_D3D11_ENABLE_FEATURELEVEL
+    {
+        context_->CSSetConstantBuffers(0, 1, copyComputeState_.cbuffer.GetAddressOf());
+    }
+
+    stateMngr_->RestoreComputeShader();
+
+    /* Compute stage bindings were restored behind the state manager's back */
+    stateMngr_->InvalidateResourceBindings();
+
+    copyComputeState_.srv.Reset();
+    copyComputeState_.uav.Reset();
+    copyComputeState_.cbuffer.Reset();
+    copyComputeState_.isSaved = false;
+}
+
 void D3D11CommandBuffer::FlushConstantsCache()
 {
     if (boundConstantsCache_ != nullptr)
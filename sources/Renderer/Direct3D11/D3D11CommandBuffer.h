@@ -23,6 +23,7 @@ namespace LLGL
 
 
 class D3D11Buffer;
+class D3D11Texture;
 class D3D11StateManager;
 class D3D11RenderTarget;
 class D3D11SwapChain;
@@ -30,6 +31,8 @@ class D3D11RenderPass;
 class D3D11PipelineState;
 class D3D11PipelineLayout;
 class D3D11ConstantsCache;
+class D3D11DeferredUploadQueue;
+struct D3D11PipelineResourceBinding;
 
 class D3D11CommandBuffer final : public CommandBuffer
 {
@@ -44,7 +47,8 @@ class D3D11CommandBuffer final : public CommandBuffer
             ID3D11Device*                               device,
             const ComPtr<ID3D11DeviceContext>&          context,
             const std::shared_ptr<D3D11StateManager>&   stateMngr,
-            const CommandBufferDescriptor&              desc
+            const CommandBufferDescriptor&              desc,
+            D3D11DeferredUploadQueue*                   uploadQueue = nullptr
         );
 
     public:
@@ -82,8 +86,43 @@ class D3D11CommandBuffer final : public CommandBuffer
             ID3D11DepthStencilView*         depthStencilView        = nullptr;
         };
 
+        // Intermediate byte-address buffer for the builtin buffer/texture copy shaders.
+        struct D3D11CopyBuffer
+        {
+            ComPtr<ID3D11Buffer>                native;
+            ComPtr<ID3D11ShaderResourceView>    srv;
+            ComPtr<ID3D11UnorderedAccessView>   uav;
+            UINT                                size            = 0;
+        };
+
+        // Intermediate texture with unsigned integer format for the builtin buffer/texture copy shaders.
+        struct D3D11CopyTexture
+        {
+            ComPtr<ID3D11Resource>              native;
+            ComPtr<ID3D11ShaderResourceView>    srv;
+            ComPtr<ID3D11UnorderedAccessView>   uav;
+            DXGI_FORMAT                         format          = DXGI_FORMAT_UNKNOWN;
+            TextureType                         type            = TextureType::Texture2D;
+            Extent3D                            extent;
+            UINT                                numArrayLayers  = 0;
+            bool                                writeAccess     = false;
+        };
+
+        // Compute stage bindings that are overridden by the builtin buffer/texture copy shaders.
+        struct D3D11CopyComputeState
+        {
+            ComPtr<ID3D11ShaderResourceView>    srv;
+            ComPtr<ID3D11UnorderedAccessView>   uav;
+            ComPtr<ID3D11Buffer>                cbuffer;
+            UINT                                firstConstant   = 0;
+            UINT                                numConstants    = 0;
+            bool                                isSaved         = false;
+        };
+
     private:
 
+        void SetResourceWithBinding(const D3D11PipelineResourceBinding& binding, Resource& resource);
+
         void ResetBufferResourceSlots(std::uint32_t firstSlot, std::uint32_t numSlots, long bindFlags, long stageFlags);
         void ResetTextureResourceSlots(std::uint32_t firstSlot, std::uint32_t numSlots, long bindFlags, long stageFlags);
         void ResetSamplerResourceSlots(std::uint32_t firstSlot, std::uint32_t numSlots, long bindFlags, long stageFlags);
@@ -120,6 +159,23 @@ class D3D11CommandBuffer final : public CommandBuffer
             D3D11_USAGE                 usage           = D3D11_USAGE_DEFAULT
         );
 
+        // Returns an intermediate byte-address buffer with SRV and UAV of at least the specified size. Small buffers are reused across copy commands.
+        D3D11CopyBuffer GetCopyBuffer(UINT size);
+
+        // Returns an intermediate texture with either SRV or UAV (if 'writeAccess' is true) that can hold the specified region. Small textures are reused across copy commands.
+        D3D11CopyTexture GetCopyTexture(D3D11Texture& textureD3D, const TextureRegion& region, const TextureType subresourceType, bool writeAccess);
+
+        // Binds the resources of a builtin copy shader to slot 0 of the compute stage and stores the previous bindings once for consecutive copy commands.
+        void BindCopyShaderResources(
+            ID3D11ShaderResourceView*   srv,
+            ID3D11UnorderedAccessView*  uav,
+            const void*                 constants,
+            UINT                        constantsSize
+        );
+
+        // Restores the compute stage bindings that were overridden by the builtin copy shaders, if any.
+        void RestoreCopyComputeState();
+
         void FlushConstantsCache();
 
         void ResetBindingStates();
@@ -148,6 +204,9 @@ class D3D11CommandBuffer final : public CommandBuffer
 
         std::shared_ptr<D3D11StateManager>  stateMngr_;
 
+        // Queue of resource updates from worker threads that must be flushed before recording into the immediate context
+        D3D11DeferredUploadQueue*           uploadQueue_            = nullptr;
+
         D3D11FramebufferView                framebufferView_;
         D3D11RenderTarget*                  boundRenderTarget_      = nullptr;
         D3D11SwapChain*                     boundSwapChain_         = nullptr;
@@ -155,6 +214,10 @@ class D3D11CommandBuffer final : public CommandBuffer
         D3D11PipelineState*                 boundPipelineState_     = nullptr;
         D3D11ConstantsCache*                boundConstantsCache_    = nullptr;
 
+        D3D11CopyBuffer                     copyBuffer_;
+        std::vector<D3D11CopyTexture>       copyTextures_;          // Most recently used intermediate copy textures come first
+        D3D11CopyComputeState               copyComputeState_;
+
 };
 
 
@@ -7,9 +7,11 @@
 
 #include "D3D11CommandQueue.h"
 #include "D3D11CommandBuffer.h"
+#include "D3D11DeferredUploadQueue.h"
 #include "RenderState/D3D11Fence.h"
 #include "RenderState/D3D11QueryHeap.h"
 #include "../CheckedCast.h"
+#include "../../Core/ProfileZone.h"
 #include <LLGL/Utils/ForRange.h>
 
 
@@ -17,9 +19,10 @@ namespace LLGL
 {
 
 
-D3D11CommandQueue::D3D11CommandQueue(ID3D11Device* device, ComPtr<ID3D11DeviceContext>& context) :
-    context_           { context },
-    intermediateFence_ { device  }
+D3D11CommandQueue::D3D11CommandQueue(ID3D11Device* device, ComPtr<ID3D11DeviceContext>& context, D3D11DeferredUploadQueue& uploadQueue) :
+    context_           { context     },
+    uploadQueue_       { uploadQueue },
+    intermediateFence_ { device      }
 {
 }
 
@@ -27,11 +30,16 @@ D3D11CommandQueue::D3D11CommandQueue(ID3D11Device* device, ComPtr<ID3D11DeviceCo
 
 void D3D11CommandQueue::Submit(CommandBuffer& commandBuffer)
 {
+    LLGL_PROFILE_ZONE("Submit");
+
     auto& cmdBufferD3D = LLGL_CAST(D3D11CommandBuffer&, commandBuffer);
     if (!cmdBufferD3D.IsSecondaryCmdBuffer())
     {
         if (ID3D11CommandList* commandList = cmdBufferD3D.GetDeferredCommandList())
         {
+            /* Flush resource updates from worker threads before they are consumed by the command buffer */
+            uploadQueue_.Flush();
+
             /* Execute encoded command list with immediate context but don't restore previous state */
             context_->ExecuteCommandList(commandList, FALSE);
         }
@@ -52,6 +60,11 @@ bool D3D11CommandQueue::QueryResult(QueryHeap& queryHeap, std::uint32_t firstQue
     return false;
 }
 
+bool D3D11CommandQueue::QueryTimestampCalibration(TimestampCalibration& /*outCalibration*/)
+{
+    return false; // not supported by this backend
+}
+
 /* ----- Fences ----- */
 
 void D3D11CommandQueue::Submit(Fence& fence)
@@ -60,6 +73,11 @@ void D3D11CommandQueue::Submit(Fence& fence)
     fenceD3D.Submit(context_.Get());
 }
 
+void D3D11CommandQueue::SubmitWait(Fence& /*fence*/)
+{
+    // dummy - all commands are executed on a single queue
+}
+
 bool D3D11CommandQueue::WaitFence(Fence& fence, std::uint64_t /*timeout*/)
 {
     auto& fenceD3D = LLGL_CAST(D3D11Fence&, fence);
@@ -67,6 +85,23 @@ bool D3D11CommandQueue::WaitFence(Fence& fence, std::uint64_t /*timeout*/)
     return true;
 }
 
+void D3D11CommandQueue::Submit(Fence& fence, std::uint64_t value)
+{
+    auto& fenceD3D = LLGL_CAST(D3D11Fence&, fence);
+    fenceD3D.SubmitValue(context_.Get(), value);
+}
+
+void D3D11CommandQueue::SubmitWait(Fence& /*fence*/, std::uint64_t /*value*/)
+{
+    // dummy - all commands are executed on a single queue
+}
+
+bool D3D11CommandQueue::WaitFence(Fence& fence, std::uint64_t value, std::uint64_t /*timeout*/)
+{
+    auto& fenceD3D = LLGL_CAST(D3D11Fence&, fence);
+    return fenceD3D.WaitValue(context_.Get(), value);
+}
+
 void D3D11CommandQueue::WaitIdle()
 {
     /* Submit intermediate fence and wait for it to be signaled */
@@ -21,6 +21,7 @@ namespace LLGL
 
 
 class D3D11QueryHeap;
+class D3D11DeferredUploadQueue;
 
 class D3D11CommandQueue final : public CommandQueue
 {
@@ -31,7 +32,7 @@ class D3D11CommandQueue final : public CommandQueue
 
     public:
 
-        D3D11CommandQueue(ID3D11Device* device, ComPtr<ID3D11DeviceContext>& context);
+        D3D11CommandQueue(ID3D11Device* device, ComPtr<ID3D11DeviceContext>& context, D3D11DeferredUploadQueue& uploadQueue);
 
     private:
 
@@ -65,6 +66,7 @@ class D3D11CommandQueue final : public CommandQueue
     private:
 
         ComPtr<ID3D11DeviceContext> context_;
+        D3D11DeferredUploadQueue&   uploadQueue_;
         D3D11Fence                  intermediateFence_;
 
 };
@@ -0,0 +1,125 @@
+/*
+ * D3D11DeferredUploadQueue.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "D3D11DeferredUploadQueue.h"
+#include "../DXCommon/DXCore.h"
+
+
+namespace LLGL
+{
+
+
+// Set once a device has been queried for its threading capabilities.
+static bool g_D3D11EmulatedCommandLists = false;
+
+/*
+Returns true if the D3D runtime supports command lists natively.
+Otherwise, they will be emulated by the D3D runtime.
+*/
+static bool D3DSupportsDriverCommandLists(ID3D11Device* device)
+{
+    D3D11_FEATURE_DATA_THREADING threadingCaps = { FALSE, FALSE };
+    HRESULT hr = device->CheckFeatureSupport(D3D11_FEATURE_THREADING, &threadingCaps, sizeof(threadingCaps));
+    return (SUCCEEDED(hr) && threadingCaps.DriverCommandLists != FALSE);
+}
+
+D3D11DeferredUploadQueue::D3D11DeferredUploadQueue(ID3D11Device* device, const ComPtr<ID3D11DeviceContext>& immediateContext) :
+    device_           { device                    },
+    immediateContext_ { immediateContext          },
+    ownerThreadId_    { std::this_thread::get_id() }
+{
+    g_D3D11EmulatedCommandLists = !D3DSupportsDriverCommandLists(device);
+}
+
+bool D3D11DeferredUploadQueue::IsOwnerThread() const
+{
+    return (std::this_thread::get_id() == ownerThreadId_);
+}
+
+ComPtr<ID3D11DeviceContext> D3D11DeferredUploadQueue::BeginUpload()
+{
+    ComPtr<ID3D11DeviceContext> deferredContext;
+
+    /* Take deferred context from pool */
+    {
+        std::lock_guard<std::mutex> guard{ mutex_ };
+        if (!freeContexts_.empty())
+        {
+            deferredContext = std::move(freeContexts_.back());
+            freeContexts_.pop_back();
+            return deferredContext;
+        }
+    }
+
+    /* Create new deferred context; ID3D11Device is free-threaded */
+    HRESULT hr = device_->CreateDeferredContext(0, deferredContext.GetAddressOf());
+    DXThrowIfCreateFailed(hr, "ID3D11DeviceContext", "for deferred resource upload");
+    return deferredContext;
+}
+
+void D3D11DeferredUploadQueue::EndUpload(ComPtr<ID3D11DeviceContext>&& deferredContext)
+{
+    /* Encode command list; don't restore deferred context state since it's only used for resource updates */
+    ComPtr<ID3D11CommandList> commandList;
+    HRESULT hr = deferredContext->FinishCommandList(FALSE, commandList.GetAddressOf());
+    DXThrowIfFailed(hr, "failed to finish command list of deferred resource upload");
+
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    pendingCommandLists_.push_back(std::move(commandList));
+    freeContexts_.push_back(std::move(deferredContext));
+}
+
+void D3D11DeferredUploadQueue::Flush()
+{
+    std::vector<ComPtr<ID3D11CommandList>> commandLists;
+    {
+        std::lock_guard<std::mutex> guard{ mutex_ };
+        if (pendingCommandLists_.empty())
+            return;
+        commandLists.swap(pendingCommandLists_);
+    }
+
+    /* Execute command lists and restore immediate context state, so the cached states of the immediate state manager remain valid */
+    for (const ComPtr<ID3D11CommandList>& commandList : commandLists)
+        immediateContext_->ExecuteCommandList(commandList.Get(), TRUE);
+}
+
+bool D3D11DeferredUploadQueue::HasEmulatedCommandLists()
+{
+    return g_D3D11EmulatedCommandLists;
+}
+
+void D3D11UpdateSubresource(
+    ID3D11DeviceContext*    context,
+    ID3D11Resource*         dstResource,
+    UINT                    dstSubresource,
+    const D3D11_BOX*        dstBox,
+    const void*             srcData,
+    UINT                    srcRowPitch,
+    UINT                    srcDepthPitch,
+    UINT                    srcBytesPerBlock,
+    UINT                    blockSize)
+{
+    if (dstBox != nullptr && g_D3D11EmulatedCommandLists && context->GetType() == D3D11_DEVICE_CONTEXT_DEFERRED)
+    {
+        /* Move source address backwards by the destination offset (in blocks), since the runtime will apply it again */
+        const UINT left = dstBox->left / blockSize;
+        const UINT top  = dstBox->top  / blockSize;
+        srcData = static_cast<const char*>(srcData)
+            - static_cast<std::size_t>(dstBox->front) * srcDepthPitch
+            - static_cast<std::size_t>(top) * srcRowPitch
+            - static_cast<std::size_t>(left) * srcBytesPerBlock;
+    }
+    context->UpdateSubresource(dstResource, dstSubresource, dstBox, srcData, srcRowPitch, srcDepthPitch);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
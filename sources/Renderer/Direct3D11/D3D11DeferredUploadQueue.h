@@ -0,0 +1,93 @@
+/*
+ * D3D11DeferredUploadQueue.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_D3D11_DEFERRED_UPLOAD_QUEUE_H
+#define LLGL_D3D11_DEFERRED_UPLOAD_QUEUE_H
+
+
+#include "../DXCommon/ComPtr.h"
+#include <d3d11.h>
+#include <vector>
+#include <mutex>
+#include <thread>
+
+
+namespace LLGL
+{
+
+
+/*
+Queue for resource updates from worker threads.
+Each update is recorded into a deferred context that is exclusively owned by the calling thread until the update is finished.
+The encoded command lists are executed on the immediate context in the order they were finished, whenever the thread that owns the immediate context flushes this queue.
+*/
+class D3D11DeferredUploadQueue
+{
+
+    public:
+
+        D3D11DeferredUploadQueue(ID3D11Device* device, const ComPtr<ID3D11DeviceContext>& immediateContext);
+
+        D3D11DeferredUploadQueue(const D3D11DeferredUploadQueue&) = delete;
+        D3D11DeferredUploadQueue& operator = (const D3D11DeferredUploadQueue&) = delete;
+
+        // Returns true if the calling thread is the one that created this queue and owns the immediate context.
+        bool IsOwnerThread() const;
+
+        // Returns a deferred context to record a resource update from the calling thread. Must be followed by a call to EndUpload.
+        ComPtr<ID3D11DeviceContext> BeginUpload();
+
+        // Encodes the recorded resource update into a command list and returns the deferred context to the pool.
+        void EndUpload(ComPtr<ID3D11DeviceContext>&& deferredContext);
+
+        // Executes all pending command lists on the immediate context. Must only be called by the owner thread.
+        void Flush();
+
+    public:
+
+        // Returns true if deferred contexts are emulated by the D3D runtime, i.e. the driver does not support command lists natively.
+        static bool HasEmulatedCommandLists();
+
+    private:
+
+        ID3D11Device*                               device_             = nullptr;
+        ComPtr<ID3D11DeviceContext>                 immediateContext_;
+        const std::thread::id                       ownerThreadId_;
+
+        std::mutex                                  mutex_;
+        std::vector<ComPtr<ID3D11DeviceContext>>    freeContexts_;
+        std::vector<ComPtr<ID3D11CommandList>>      pendingCommandLists_;
+
+};
+
+/*
+Wrapper for ID3D11DeviceContext::UpdateSubresource that works around the source address bug of emulated deferred contexts.
+If the destination box has an offset and the driver does not support command lists, the runtime applies that offset to the source data as well.
+'srcBytesPerBlock' and 'blockSize' specify the size of a single texel (or compressed block) and its extent; use 1 for buffers.
+See https://learn.microsoft.com/en-us/windows/win32/api/d3d11/nf-d3d11-id3d11devicecontext-updatesubresource#calling-updatesubresource-on-a-deferred-context
+*/
+void D3D11UpdateSubresource(
+    ID3D11DeviceContext*    context,
+    ID3D11Resource*         dstResource,
+    UINT                    dstSubresource,
+    const D3D11_BOX*        dstBox,
+    const void*             srcData,
+    UINT                    srcRowPitch,
+    UINT                    srcDepthPitch,
+    UINT                    srcBytesPerBlock    = 1,
+    UINT                    blockSize           = 1
+);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -21,6 +21,8 @@
 #include <sstream>
 #include <iomanip>
 #include <limits.h>
+#include <mutex>
+#include <d3d10.h>
 
 #include "Buffer/D3D11Buffer.h"
 #include "Buffer/D3D11BufferArray.h"
@@ -30,29 +32,18 @@
 #include "RenderState/D3D11GraphicsPSO1.h"
 #include "RenderState/D3D11GraphicsPSO3.h"
 #include "RenderState/D3D11ComputePSO.h"
+#include "../../Core/ProfileZone.h"
 
 #include <LLGL/Backend/Direct3D11/NativeHandle.h>
+#include <LLGL/RendererConfiguration.h>
 
 
 namespace LLGL
 {
 
 
-#if 0 //WIP
-/*
-Returns true if the D3D runtime supports command lists natively.
-Otherwise, they will be emulated by the D3D runtime.
-See https://docs.microsoft.com/en-us/windows/win32/api/d3d11_1/nf-d3d11_1-id3d11devicecontext1-vssetconstantbuffers1#remarks
-*/
-static bool D3DSupportsDriverCommandLists(ID3D11Device* device, ID3D11DeviceContext* context)
-{
-    D3D11_FEATURE_DATA_THREADING threadingCaps = { FALSE, FALSE };
-    HRESULT hr = device->CheckFeatureSupport(D3D11_FEATURE_THREADING, &threadingCaps, sizeof(threadingCaps));
-    return (SUCCEEDED(hr) && threadingCaps.DriverCommandLists != FALSE);
-}
-#endif
-
-D3D11RenderSystem::D3D11RenderSystem(const RenderSystemDescriptor& renderSystemDesc)
+D3D11RenderSystem::D3D11RenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
+    shaderCache_ { renderSystemDesc.shaderCache }
 {
     const bool debugDevice = ((renderSystemDesc.flags & RenderSystemFlags::DebugDevice) != 0);
 
@@ -68,12 +59,26 @@ D3D11RenderSystem::D3D11RenderSystem(const RenderSystemDescriptor& renderSystemD
         CreateFactory();
 
         ComPtr<IDXGIAdapter> preferredAdatper;
-        QueryVideoAdapters(renderSystemDesc.flags, preferredAdatper);
+        QueryVideoAdapters(renderSystemDesc.flags, renderSystemDesc.adapterIndex, preferredAdatper);
 
-        HRESULT hr = CreateDevice(preferredAdatper.Get(), debugDevice);
+        /* Don't fall back to the default adapter if one was selected explicitly */
+        HRESULT hr = CreateDevice(preferredAdatper.Get(), debugDevice, (renderSystemDesc.adapterIndex == ~0u));
         DXThrowIfFailed(hr, "failed to create D3D11 device");
     }
 
+    /* Use flip-model swap-chains by default if the DXGI factory supports tearing */
+    const RendererConfigurationDirect3D11* rendererConfigD3D = GetRendererConfiguration<RendererConfigurationDirect3D11>(renderSystemDesc);
+    if (rendererConfigD3D == nullptr || rendererConfigD3D->enableFlipModel)
+        flipModelEnabled_ = DXIsTearingSupported(factory_.Get());
+
+    /* Protect immediate context against concurrent access, so swap-chains can be presented from different threads */
+    if (rendererConfigD3D != nullptr && rendererConfigD3D->enableMultiThreadProtection)
+    {
+        ComPtr<ID3D10Multithread> multithread;
+        if (SUCCEEDED(context_.As(&multithread)))
+            multithread->SetMultithreadProtected(TRUE);
+    }
+
     /* Initialize states and renderer information */
     CreateStateManagerAndCommandQueue();
     QueryRendererInfo();
@@ -82,8 +87,6 @@ D3D11RenderSystem::D3D11RenderSystem(const RenderSystemDescriptor& renderSystemD
     /* Initialize MIP-map generator singleton */
     D3D11MipGenerator::Get().InitializeDevice(device_);
     D3D11BuiltinShaderFactory::Get().CreateBuiltinShaders(device_.Get());
-
-    //D3DSupportsDriverCommandLists(device_.Get(), context_.Get());
 }
 
 D3D11RenderSystem::~D3D11RenderSystem()
@@ -97,7 +100,7 @@ D3D11RenderSystem::~D3D11RenderSystem()
 
 SwapChain* D3D11RenderSystem::CreateSwapChain(const SwapChainDescriptor& swapChainDesc, const std::shared_ptr<Surface>& surface)
 {
-    return swapChains_.emplace<D3D11SwapChain>(factory_.Get(), device_, swapChainDesc, surface);
+    return swapChains_.emplace<D3D11SwapChain>(factory_.Get(), device_, swapChainDesc, surface, flipModelEnabled_);
 }
 
 void D3D11RenderSystem::Release(SwapChain& swapChain)
@@ -112,6 +115,12 @@ CommandQueue* D3D11RenderSystem::GetCommandQueue()
     return commandQueue_.get();
 }
 
+CommandQueue* D3D11RenderSystem::GetCommandQueue(long /*queueFlags*/)
+{
+    /* Only a single command queue is supported */
+    return commandQueue_.get();
+}
+
 /* ----- Command buffers ----- */
 
 CommandBuffer* D3D11RenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& commandBufferDesc)
@@ -119,7 +128,7 @@ CommandBuffer* D3D11RenderSystem::CreateCommandBuffer(const CommandBufferDescrip
     if ((commandBufferDesc.flags & (CommandBufferFlags::ImmediateSubmit)) != 0)
     {
         /* Create command buffer with immediate context */
-        return commandBuffers_.emplace<D3D11CommandBuffer>(device_.Get(), context_, stateMngr_, commandBufferDesc);
+        return commandBuffers_.emplace<D3D11CommandBuffer>(device_.Get(), context_, stateMngr_, commandBufferDesc, uploadQueue_.get());
     }
     else
     {
@@ -170,25 +179,33 @@ void D3D11RenderSystem::Release(BufferArray& bufferArray)
 
 void D3D11RenderSystem::WriteBuffer(Buffer& buffer, std::uint64_t offset, const void* data, std::uint64_t dataSize)
 {
+    LLGL_PROFILE_ZONE("WriteBuffer");
+
     auto& bufferD3D = LLGL_CAST(D3D11Buffer&, buffer);
-    bufferD3D.WriteSubresource(context_.Get(), data, static_cast<UINT>(dataSize), static_cast<UINT>(offset));
+    ComPtr<ID3D11DeviceContext> deferredContext;
+    ID3D11DeviceContext* context = BeginUpload(deferredContext);
+    bufferD3D.WriteSubresource(context, data, static_cast<UINT>(dataSize), static_cast<UINT>(offset));
+    EndUpload(std::move(deferredContext));
 }
 
 void D3D11RenderSystem::ReadBuffer(Buffer& buffer, std::uint64_t offset, void* data, std::uint64_t dataSize)
 {
     auto& bufferD3D = LLGL_CAST(D3D11Buffer&, buffer);
+    uploadQueue_->Flush();
     bufferD3D.ReadSubresource(context_.Get(), data, static_cast<UINT>(dataSize), static_cast<UINT>(offset));
 }
 
 void* D3D11RenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access)
 {
     auto& bufferD3D = LLGL_CAST(D3D11Buffer&, buffer);
+    uploadQueue_->Flush();
     return bufferD3D.Map(context_.Get(), access, 0, bufferD3D.GetSize());
 }
 
 void* D3D11RenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access, std::uint64_t offset, std::uint64_t length)
 {
     auto& bufferD3D = LLGL_CAST(D3D11Buffer&, buffer);
+    uploadQueue_->Flush();
     return bufferD3D.Map(context_.Get(), access, static_cast<UINT>(offset), static_cast<UINT>(length));
 }
 
@@ -222,13 +239,21 @@ void D3D11RenderSystem::Release(Texture& texture)
 
 void D3D11RenderSystem::WriteTexture(Texture& texture, const TextureRegion& textureRegion, const ImageView& srcImageView)
 {
+    LLGL_PROFILE_ZONE("WriteTexture");
+
     auto& textureD3D = LLGL_CAST(D3D11Texture&, texture);
+
+    /* Report errors only on the thread that owns the immediate context, since the report is not thread-safe */
+    ComPtr<ID3D11DeviceContext> deferredContext;
+    ID3D11DeviceContext* context = BeginUpload(deferredContext);
+    Report* report = (deferredContext.Get() == nullptr ? &(GetMutableReport()) : nullptr);
+
     switch (texture.GetType())
     {
         case TextureType::Texture1D:
         case TextureType::Texture1DArray:
             textureD3D.UpdateSubresource(
-                context_.Get(),
+                context,
                 textureRegion.subresource.baseMipLevel,
                 textureRegion.subresource.baseArrayLayer,
                 textureRegion.subresource.numArrayLayers,
@@ -237,7 +262,7 @@ void D3D11RenderSystem::WriteTexture(Texture& texture, const TextureRegion& text
                     textureRegion.extent.width
                 ),
                 srcImageView,
-                &(GetMutableReport())
+                report
             );
             break;
 
@@ -246,7 +271,7 @@ void D3D11RenderSystem::WriteTexture(Texture& texture, const TextureRegion& text
         case TextureType::Texture2DArray:
         case TextureType::TextureCubeArray:
             textureD3D.UpdateSubresource(
-                context_.Get(),
+                context,
                 textureRegion.subresource.baseMipLevel,
                 textureRegion.subresource.baseArrayLayer,
                 textureRegion.subresource.numArrayLayers,
@@ -257,7 +282,7 @@ void D3D11RenderSystem::WriteTexture(Texture& texture, const TextureRegion& text
                     textureRegion.extent.height
                 ),
                 srcImageView,
-                &(GetMutableReport())
+                report
             );
             break;
 
@@ -268,7 +293,7 @@ void D3D11RenderSystem::WriteTexture(Texture& texture, const TextureRegion& text
 
         case TextureType::Texture3D:
             textureD3D.UpdateSubresource(
-                context_.Get(),
+                context,
                 textureRegion.subresource.baseMipLevel,
                 0,
                 1,
@@ -281,10 +306,12 @@ void D3D11RenderSystem::WriteTexture(Texture& texture, const TextureRegion& text
                     textureRegion.extent.depth
                 ),
                 srcImageView,
-                &(GetMutableReport())
+                report
             );
             break;
     }
+
+    EndUpload(std::move(deferredContext));
 }
 
 void D3D11RenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureRegion, const MutableImageView& dstImageView)
@@ -304,6 +331,9 @@ void D3D11RenderSystem::ReadTexture(Texture& texture, const TextureRegion& textu
     if (dstImageView.dataSize < requiredImageSize)
         return /*E_BOUNDS*/;
 
+    /* Flush resource updates from worker threads before reading back texture */
+    uploadQueue_->Flush();
+
     /* Create a copy of the hardware texture with CPU read access */
     D3D11NativeTexture texCopy;
     textureD3D.CreateSubresourceCopyWithCPUAccess(device_.Get(), context_.Get(), texCopy, D3D11_CPU_ACCESS_READ, textureRegion);
@@ -335,7 +365,7 @@ void D3D11RenderSystem::ReadTexture(Texture& texture, const TextureRegion& textu
 
 Sampler* D3D11RenderSystem::CreateSampler(const SamplerDescriptor& samplerDesc)
 {
-    return samplers_.emplace<D3D11Sampler>(device_.Get(), samplerDesc);
+    return samplers_.emplace(samplerDesc, device_.Get(), samplerDesc);
 }
 
 void D3D11RenderSystem::Release(Sampler& sampler)
@@ -390,7 +420,22 @@ void D3D11RenderSystem::Release(RenderTarget& renderTarget)
 Shader* D3D11RenderSystem::CreateShader(const ShaderDescriptor& shaderDesc)
 {
     RenderSystem::AssertCreateShader(shaderDesc);
-    return shaders_.emplace<D3D11Shader>(device_.Get(), shaderDesc);
+    return shaders_.emplace<D3D11Shader>(device_.Get(), shaderDesc, shaderCache_);
+}
+
+std::uint32_t D3D11RenderSystem::CreateShaders(const ArrayView<ShaderDescriptor>& shaderDescs, Shader** outShaders)
+{
+    std::mutex shadersMutex;
+    return CreateShaderBatch(
+        shaderDescs,
+        outShaders,
+        [this, &shadersMutex](const ShaderDescriptor& shaderDesc) -> Shader*
+        {
+            RenderSystem::AssertCreateShader(shaderDesc);
+            return shaders_.emplace_concurrent<D3D11Shader>(shadersMutex, device_.Get(), shaderDesc, shaderCache_);
+        },
+        /*concurrent:*/ true
+    );
 }
 
 void D3D11RenderSystem::Release(Shader& shader)
@@ -402,7 +447,7 @@ void D3D11RenderSystem::Release(Shader& shader)
 
 PipelineLayout* D3D11RenderSystem::CreatePipelineLayout(const PipelineLayoutDescriptor& pipelineLayoutDesc)
 {
-    return pipelineLayouts_.emplace<D3D11PipelineLayout>(device_.Get(), pipelineLayoutDesc);
+    return pipelineLayouts_.emplace(pipelineLayoutDesc, device_.Get(), pipelineLayoutDesc);
 }
 
 void D3D11RenderSystem::Release(PipelineLayout& pipelineLayout)
@@ -426,6 +471,8 @@ void D3D11RenderSystem::Release(PipelineCache& pipelineCache)
 
 PipelineState* D3D11RenderSystem::CreatePipelineState(const GraphicsPipelineDescriptor& pipelineStateDesc, PipelineCache* /*pipelineCache*/)
 {
+    LLGL_PROFILE_ZONE("CreateGraphicsPipelineState");
+
     #if LLGL_D3D11_ENABLE_FEATURELEVEL >= 3
     if (device3_)
     {
@@ -456,6 +503,8 @@ PipelineState* D3D11RenderSystem::CreatePipelineState(const GraphicsPipelineDesc
 
 PipelineState* D3D11RenderSystem::CreatePipelineState(const ComputePipelineDescriptor& pipelineStateDesc, PipelineCache* /*pipelineCache*/)
 {
+    LLGL_PROFILE_ZONE("CreateComputePipelineState");
+
     return pipelineStates_.emplace<D3D11ComputePSO>(pipelineStateDesc);
 }
 
@@ -504,6 +553,47 @@ bool D3D11RenderSystem::GetNativeHandle(void* nativeHandle, std::size_t nativeHa
     return false;
 }
 
+std::uint32_t D3D11RenderSystem::QueryMemoryHeaps(MemoryHeapInfo* /*outHeapInfos*/, std::uint32_t /*maxNumHeaps*/)
+{
+    return 0; // not supported by this backend
+}
+
+std::uint32_t D3D11RenderSystem::GetBindlessDescriptorIndex(const Resource& /*resource*/, long /*bindFlags*/)
+{
+    return LLGL_INVALID_SLOT; // not supported by this backend
+}
+
+bool D3D11RenderSystem::GetSparseTextureProperties(const Texture& /*texture*/, SparseTextureProperties& /*outProperties*/)
+{
+    return false; // not supported by this backend
+}
+
+bool D3D11RenderSystem::CommitTextureTiles(Texture& /*texture*/, const TextureRegion& /*textureRegion*/, bool /*commit*/)
+{
+    return false; // not supported by this backend
+}
+
+bool D3D11RenderSystem::MakeResident(const ArrayView<Resource*>& /*resources*/)
+{
+    return true; // residency is managed by the driver
+}
+
+void D3D11RenderSystem::Evict(const ArrayView<Resource*>& /*resources*/)
+{
+    // residency is managed by the driver
+}
+
+
+bool D3D11RenderSystem::GetAccelerationStructureSizes(const AccelerationStructureBuildDescriptor& /*buildDesc*/, AccelerationStructureSizes& /*outSizes*/)
+{
+    return false; // not supported by this backend
+}
+
+std::uint64_t D3D11RenderSystem::GetAccelerationStructureAddress(const Buffer& /*buffer*/)
+{
+    return 0; // not supported by this backend
+}
+
 
 /*
  * ======= Internal: =======
@@ -548,12 +638,15 @@ void D3D11RenderSystem::CreateFactory()
     DXThrowIfCreateFailed(hr, "IDXGIFactory");
 }
 
-void D3D11RenderSystem::QueryVideoAdapters(long flags, ComPtr<IDXGIAdapter>& outPreferredAdatper)
+void D3D11RenderSystem::QueryVideoAdapters(long flags, std::uint32_t adapterIndex, ComPtr<IDXGIAdapter>& outPreferredAdatper)
 {
-    videoAdatperInfo_ = DXGetVideoAdapterInfo(factory_.Get(), flags, outPreferredAdatper.ReleaseAndGetAddressOf());
+    if (adapterIndex != ~0u)
+        videoAdatperInfo_ = DXGetVideoAdapterInfoByIndex(factory_.Get(), adapterIndex, outPreferredAdatper.ReleaseAndGetAddressOf());
+    else
+        videoAdatperInfo_ = DXGetVideoAdapterInfo(factory_.Get(), flags, outPreferredAdatper.ReleaseAndGetAddressOf());
 }
 
-HRESULT D3D11RenderSystem::CreateDevice(IDXGIAdapter* adapter, bool debugDevice)
+HRESULT D3D11RenderSystem::CreateDevice(IDXGIAdapter* adapter, bool debugDevice, bool allowDefaultAdapter)
 {
     /* Find list of feature levels to select from, and statically determine maximal feature level */
     const std::vector<D3D_FEATURE_LEVEL> featureLevels = DXGetFeatureLevels(
@@ -580,7 +673,7 @@ HRESULT D3D11RenderSystem::CreateDevice(IDXGIAdapter* adapter, bool debugDevice)
     }
 
     /* Try to create device with default adapter if preferred one failed */
-    if (FAILED(hr) && adapter != nullptr)
+    if (FAILED(hr) && adapter != nullptr && allowDefaultAdapter)
     {
         /* Update video adapter info with default adapter */
         videoAdatperInfo_ = DXGetVideoAdapterInfo(factory_.Get());
@@ -680,7 +773,30 @@ void D3D11RenderSystem::QueryDXDeviceVersion()
 void D3D11RenderSystem::CreateStateManagerAndCommandQueue()
 {
     stateMngr_ = std::make_shared<D3D11StateManager>(device_.Get(), context_);
-    commandQueue_ = MakeUnique<D3D11CommandQueue>(device_.Get(), context_);
+    uploadQueue_ = MakeUnique<D3D11DeferredUploadQueue>(device_.Get(), context_);
+    commandQueue_ = MakeUnique<D3D11CommandQueue>(device_.Get(), context_, *uploadQueue_);
+}
+
+ID3D11DeviceContext* D3D11RenderSystem::BeginUpload(ComPtr<ID3D11DeviceContext>& outDeferredContext)
+{
+    if (uploadQueue_->IsOwnerThread())
+    {
+        /* Flush previous updates from worker threads to preserve the order of resource updates */
+        uploadQueue_->Flush();
+        return context_.Get();
+    }
+    else
+    {
+        /* Record resource update from worker thread into a deferred context */
+        outDeferredContext = uploadQueue_->BeginUpload();
+        return outDeferredContext.Get();
+    }
+}
+
+void D3D11RenderSystem::EndUpload(ComPtr<ID3D11DeviceContext>&& deferredContext)
+{
+    if (deferredContext.Get() != nullptr)
+        uploadQueue_->EndUpload(std::move(deferredContext));
 }
 
 void D3D11RenderSystem::QueryRendererInfo()
@@ -15,6 +15,7 @@
 #include "D3D11CommandQueue.h"
 #include "D3D11CommandBuffer.h"
 #include "D3D11SwapChain.h"
+#include "D3D11DeferredUploadQueue.h"
 
 #include "Buffer/D3D11Buffer.h"
 #include "Buffer/D3D11BufferArray.h"
@@ -35,6 +36,8 @@
 
 #include "../VideoAdapter.h"
 #include "../ContainerTypes.h"
+#include "../PipelineLayoutCache.h"
+#include "../SamplerCache.h"
 #include "../DXCommon/ComPtr.h"
 #include "../ProxyPipelineCache.h"
 
@@ -88,13 +91,19 @@ class D3D11RenderSystem final : public RenderSystem
     private:
 
         void CreateFactory();
-        void QueryVideoAdapters(long flags, ComPtr<IDXGIAdapter>& outPreferredAdatper);
-        HRESULT CreateDevice(IDXGIAdapter* adapter, bool debugDevice = false);
+        void QueryVideoAdapters(long flags, std::uint32_t adapterIndex, ComPtr<IDXGIAdapter>& outPreferredAdatper);
+        HRESULT CreateDevice(IDXGIAdapter* adapter, bool debugDevice = false, bool allowDefaultAdapter = true);
         HRESULT CreateDeviceWithFlags(IDXGIAdapter* adapter, const ArrayView<D3D_FEATURE_LEVEL>& featureLevels, UINT flags);
         HRESULT QueryDXInterfacesFromNativeHandle(const Direct3D11::RenderSystemNativeHandle& nativeHandle);
         void QueryDXDeviceVersion();
         void CreateStateManagerAndCommandQueue();
 
+        // Returns the context to record a resource update into, i.e. a deferred context if this is called from a worker thread or the immediate context otherwise.
+        ID3D11DeviceContext* BeginUpload(ComPtr<ID3D11DeviceContext>& outDeferredContext);
+
+        // Finishes the resource update that was started with BeginUpload.
+        void EndUpload(ComPtr<ID3D11DeviceContext>&& deferredContext);
+
         void QueryRendererInfo();
         void QueryRenderingCaps();
 
@@ -132,6 +141,7 @@ class D3D11RenderSystem final : public RenderSystem
         D3D_FEATURE_LEVEL                       featureLevel_           = D3D_FEATURE_LEVEL_9_1;
 
         std::shared_ptr<D3D11StateManager>      stateMngr_;
+        std::unique_ptr<D3D11DeferredUploadQueue> uploadQueue_;
 
         /* ----- Hardware object containers ----- */
 
@@ -139,13 +149,13 @@ class D3D11RenderSystem final : public RenderSystem
         HWObjectInstance<D3D11CommandQueue>     commandQueue_;
         HWObjectContainer<D3D11CommandBuffer>   commandBuffers_;
         HWObjectContainer<D3D11Buffer>          buffers_;
-        HWObjectContainer<D3D11BufferArray>     bufferArrays_;
+        HWObjectPool<D3D11BufferArray>          bufferArrays_;
         HWObjectContainer<D3D11Texture>         textures_;
-        HWObjectContainer<D3D11Sampler>         samplers_;
+        SamplerCache<D3D11Sampler>              samplers_;
         HWObjectContainer<D3D11RenderPass>      renderPasses_;
         HWObjectContainer<D3D11RenderTarget>    renderTargets_;
         HWObjectContainer<D3D11Shader>          shaders_;
-        HWObjectContainer<D3D11PipelineLayout>  pipelineLayouts_;
+        PipelineLayoutCache<D3D11PipelineLayout> pipelineLayouts_;
         HWObjectInstance<ProxyPipelineCache>    pipelineCacheProxy_;
         HWObjectContainer<D3D11PipelineState>   pipelineStates_;
         HWObjectContainer<D3D11ResourceHeap>    resourceHeaps_;
@@ -155,6 +165,8 @@ class D3D11RenderSystem final : public RenderSystem
         /* ----- Other members ----- */
 
         VideoAdapterInfo                        videoAdatperInfo_;
+        ShaderCache*                            shaderCache_            = nullptr;
+        bool                                    flipModelEnabled_       = false; // Swap-chains use the flip model (see RendererConfigurationDirect3D11::enableFlipModel).
 
 };
 
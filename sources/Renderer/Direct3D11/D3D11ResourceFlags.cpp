@@ -71,6 +71,8 @@ UINT DXGetCPUAccessFlagsForMiscFlags(long miscFlags)
 
     if ((miscFlags & MiscFlags::DynamicUsage) != 0)
         flagsD3D |= D3D11_CPU_ACCESS_WRITE;
+    if ((miscFlags & MiscFlags::Readback) != 0)
+        flagsD3D |= D3D11_CPU_ACCESS_READ;
 
     return flagsD3D;
 }
@@ -133,6 +135,9 @@ UINT DXGetTextureMiscFlags(const TextureDescriptor& desc)
 
 D3D11_USAGE DXGetBufferUsage(const BufferDescriptor& desc)
 {
+    /* Readback buffers are staging buffers that are only written by copy commands */
+    if ((desc.miscFlags & MiscFlags::Readback) != 0)
+        return D3D11_USAGE_STAGING;
     if ((desc.bindFlags & BindFlags::Storage) == 0)
     {
         if ((desc.miscFlags & MiscFlags::DynamicUsage) != 0)
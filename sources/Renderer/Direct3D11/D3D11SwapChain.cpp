@@ -9,9 +9,12 @@
 #include "D3D11RenderSystem.h"
 #include "D3D11ObjectUtils.h"
 #include "../DXCommon/DXTypes.h"
+#include "../SwapChainUtils.h"
 #include "../../Core/CoreUtils.h"
+#include "../../Core/ProfileZone.h"
 #include <LLGL/Platform/NativeHandle.h>
 #include <LLGL/Log.h>
+#include <dxgi1_5.h>
 
 
 namespace LLGL
@@ -22,29 +25,57 @@ D3D11SwapChain::D3D11SwapChain(
     IDXGIFactory*                   factory,
     const ComPtr<ID3D11Device>&     device,
     const SwapChainDescriptor&      desc,
-    const std::shared_ptr<Surface>& surface)
+    const std::shared_ptr<Surface>& surface,
+    bool                            flipModel)
 :
     SwapChain           { desc                                                       },
     device_             { device                                                     },
+    presentMode_        { desc.presentMode                                           },
+    flipModel_          { flipModel                                                  },
     depthStencilFormat_ { DXPickDepthStencilFormat(desc.depthBits, desc.stencilBits) }
 {
     /* Setup surface for the swap-chain */
     SetOrCreateSurface(surface, desc.resolution, desc.fullscreen, nullptr);
 
+    /* Select initial sync interval for presentation mode */
+    swapChainInterval_ = GetPresentSyncInterval(presentMode_, 0);
+
     /* Create D3D objects */
-    CreateSwapChain(factory, desc.resolution, desc.samples, desc.swapBuffers);
+    if (flipModel_)
+    {
+        /* Frame latency waitable object must be requested at creation time */
+        if (desc.maxFramesInFlight > 0)
+            swapChainFlags_ |= DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
+        colorSpace_ = desc.colorSpace;
+        device_->GetImmediateContext(immediateContext_.GetAddressOf());
+        CreateSwapChainFlipModel(factory, desc.resolution, desc.samples, desc.swapBuffers);
+    }
+    else
+        CreateSwapChain(factory, desc.resolution, desc.samples, desc.swapBuffers);
+
     CreateBackBuffer();
 
+    if (desc.maxFramesInFlight > 0)
+        SetMaximumFrameLatency(desc.maxFramesInFlight);
+
     if (desc.debugName != nullptr)
         SetDebugName(desc.debugName);
 }
 
+D3D11SwapChain::~D3D11SwapChain()
+{
+    if (frameLatencyEvent_ != nullptr)
+        CloseHandle(frameLatencyEvent_);
+}
+
 void D3D11SwapChain::SetDebugName(const char* name)
 {
     if (name != nullptr)
     {
         /* Set label for each back-buffer object */
         D3D11SetObjectName(colorBuffer_.Get(), name);
+        if (colorBufferMS_)
+            D3D11SetObjectNameSubscript(colorBufferMS_.Get(), name, ".MS");
         D3D11SetObjectNameSubscript(renderTargetView_.Get(), name, ".RTV");
         if (depthBuffer_)
         {
@@ -56,6 +87,8 @@ void D3D11SwapChain::SetDebugName(const char* name)
     {
         /* Reset all back-buffer labels */
         D3D11SetObjectName(colorBuffer_.Get(), nullptr);
+        if (colorBufferMS_)
+            D3D11SetObjectName(colorBufferMS_.Get(), nullptr);
         D3D11SetObjectName(renderTargetView_.Get(), nullptr);
         if (depthBuffer_)
         {
@@ -67,7 +100,18 @@ void D3D11SwapChain::SetDebugName(const char* name)
 
 void D3D11SwapChain::Present()
 {
-    swapChain_->Present(swapChainInterval_, 0);
+    LLGL_PROFILE_ZONE("Present");
+
+    /* Resolve multi-sampled color buffer into the back buffer */
+    if (colorBufferMS_)
+        immediateContext_->ResolveSubresource(colorBuffer_.Get(), 0, colorBufferMS_.Get(), 0, colorFormat_);
+
+    /* Present with tearing if V-sync is disabled and the swap-chain was created with tearing support */
+    const UINT presentFlags = (swapChainInterval_ == 0 && (swapChainFlags_ & DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING) != 0 ? DXGI_PRESENT_ALLOW_TEARING : 0);
+    swapChain_->Present(swapChainInterval_, presentFlags);
+
+    /* Throttle CPU to the maximum frame latency before the next frame is recorded */
+    WaitForFrameLatency();
 }
 
 std::uint32_t D3D11SwapChain::GetCurrentSwapIndex() const
@@ -102,7 +146,7 @@ const RenderPass* D3D11SwapChain::GetRenderPass() const
 
 bool D3D11SwapChain::SetVsyncInterval(std::uint32_t vsyncInterval)
 {
-    return SetPresentSyncInterval(vsyncInterval);
+    return SetPresentSyncInterval(GetPresentSyncInterval(presentMode_, vsyncInterval));
 }
 
 void D3D11SwapChain::BindFramebufferView(D3D11CommandBuffer* commandBuffer)
@@ -229,7 +273,7 @@ HRESULT D3D11SwapChain::CopySubresourceRegion(
             return E_FAIL;
         if (DXTypes::ToDXGIFormatTypeless(colorFormat_) != DXTypes::ToDXGIFormatTypeless(format))
             return E_INVALIDARG;
-        D3D11CopyFramebufferSubresourceRegion(context, dstResource, dstSubresource, dstX, dstY, dstZ, colorBuffer_.Get(), srcBox);
+        D3D11CopyFramebufferSubresourceRegion(context, dstResource, dstSubresource, dstX, dstY, dstZ, GetRenderTargetColorBuffer(), srcBox);
     }
     return S_OK;
 }
@@ -296,22 +340,91 @@ void D3D11SwapChain::CreateSwapChain(IDXGIFactory* factory, const Extent2D& reso
     DXThrowIfFailed(hr, "failed to create DXGI swap chain");
 }
 
+void D3D11SwapChain::CreateSwapChainFlipModel(IDXGIFactory* factory, const Extent2D& resolution, std::uint32_t samples, std::uint32_t swapBuffers)
+{
+    /* Flip-model swap-chains require IDXGIFactory2 */
+    ComPtr<IDXGIFactory2> factory2;
+    HRESULT hr = factory->QueryInterface(IID_PPV_ARGS(factory2.GetAddressOf()));
+    DXThrowIfFailed(hr, "failed to query IDXGIFactory2 for flip-model swap chain");
+
+    /* Pick and store color format for the requested color space */
+    colorFormat_ = DXGetColorSpaceFormat(colorSpace_);
+
+    /* Find suitable multi-samples for the separate multi-sampled color buffer */
+    swapChainSampleDesc_ = D3D11RenderSystem::FindSuitableSampleDesc(device_.Get(), colorFormat_, samples);
+
+    /* Tearing support is a prerequisite for flip-model swap-chains in this renderer (see RendererConfigurationDirect3D11::enableFlipModel) */
+    swapChainFlags_ |= DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING;
+
+    /* Create swap chain for window handle */
+    NativeHandle wndHandle = {};
+    GetSurface().GetNativeHandle(&wndHandle, sizeof(wndHandle));
+
+    DXGI_SWAP_CHAIN_DESC1 swapChainDesc;
+    {
+        swapChainDesc.Width                 = resolution.width;
+        swapChainDesc.Height                = resolution.height;
+        swapChainDesc.Format                = colorFormat_;
+        swapChainDesc.Stereo                = FALSE;
+        swapChainDesc.SampleDesc.Count      = 1; // always 1 because flip-model swap-chains cannot be multi-sampled
+        swapChainDesc.SampleDesc.Quality    = 0;
+        swapChainDesc.BufferUsage           = DXGI_USAGE_RENDER_TARGET_OUTPUT;
+        swapChainDesc.BufferCount           = Clamp(swapBuffers, 2u, 3u); // flip model requires at least 2 buffers
+        swapChainDesc.Scaling               = DXGI_SCALING_NONE;
+        swapChainDesc.SwapEffect            = DXGI_SWAP_EFFECT_FLIP_DISCARD;
+        swapChainDesc.AlphaMode             = DXGI_ALPHA_MODE_IGNORE;
+        swapChainDesc.Flags                 = swapChainFlags_;
+    }
+    ComPtr<IDXGISwapChain1> swapChain1;
+    hr = factory2->CreateSwapChainForHwnd(device_.Get(), wndHandle.window, &swapChainDesc, nullptr, nullptr, swapChain1.GetAddressOf());
+    DXThrowIfFailed(hr, "failed to create DXGI flip-model swap chain");
+
+    /* Disable ALT+ENTER, since exclusive fullscreen is not supported together with tearing */
+    factory2->MakeWindowAssociation(wndHandle.window, DXGI_MWA_NO_ALT_ENTER);
+
+    swapChain1.As(&swapChain_);
+
+    /* Present in the requested color space; if it is not supported, the swap-chain keeps its color format but is presented in sRGB */
+    if (colorSpace_ != ColorSpace::SRGB && !DXSetSwapChainColorSpace(swapChain_.Get(), colorSpace_))
+        colorSpace_ = ColorSpace::SRGB;
+}
+
 void D3D11SwapChain::CreateBackBuffer()
 {
     HRESULT hr = 0;
 
-    /* Get back buffer from swap chain (must always be zero for DXGI_SWAP_EFFECT_DISCARD) */
+    /* Get back buffer from swap chain (must always be zero for DXGI_SWAP_EFFECT_DISCARD and refers to the current back buffer for D3D11 flip-model swap-chains) */
     hr = swapChain_->GetBuffer(0, IID_PPV_ARGS(colorBuffer_.ReleaseAndGetAddressOf()));
     DXThrowIfFailed(hr, "failed to get D3D11 back buffer from swap chain");
 
-    /* Create back buffer RTV */
-    hr = device_->CreateRenderTargetView(colorBuffer_.Get(), nullptr, renderTargetView_.ReleaseAndGetAddressOf());
-    DXThrowIfFailed(hr, "failed to create D3D11 render-target-view (RTV) for back buffer");
-
     /* Retrieve back-buffer dimension */
     D3D11_TEXTURE2D_DESC colorBufferDesc;
     colorBuffer_->GetDesc(&colorBufferDesc);
 
+    if (flipModel_ && swapChainSampleDesc_.Count > 1)
+    {
+        /* Create multi-sampled color buffer that is resolved into the back buffer on present */
+        D3D11_TEXTURE2D_DESC texDesc;
+        {
+            texDesc.Width           = colorBufferDesc.Width;
+            texDesc.Height          = colorBufferDesc.Height;
+            texDesc.MipLevels       = 1;
+            texDesc.ArraySize       = 1;
+            texDesc.Format          = colorFormat_;
+            texDesc.SampleDesc      = swapChainSampleDesc_;
+            texDesc.Usage           = D3D11_USAGE_DEFAULT;
+            texDesc.BindFlags       = D3D11_BIND_RENDER_TARGET;
+            texDesc.CPUAccessFlags  = 0;
+            texDesc.MiscFlags       = 0;
+        }
+        hr = device_->CreateTexture2D(&texDesc, nullptr, colorBufferMS_.ReleaseAndGetAddressOf());
+        DXThrowIfFailed(hr, "failed to create D3D11 multi-sampled color buffer for swap-chain");
+    }
+
+    /* Create back buffer RTV */
+    hr = device_->CreateRenderTargetView(GetRenderTargetColorBuffer(), nullptr, renderTargetView_.ReleaseAndGetAddressOf());
+    DXThrowIfFailed(hr, "failed to create D3D11 render-target-view (RTV) for back buffer");
+
     if (depthStencilFormat_ != DXGI_FORMAT_UNKNOWN)
     {
         /* Create depth stencil texture */
@@ -345,6 +458,7 @@ void D3D11SwapChain::ResizeBackBuffer(const Extent2D& resolution)
 
     /* Release buffers */
     colorBuffer_.Reset();
+    colorBufferMS_.Reset();
     renderTargetView_.Reset();
     depthBuffer_.Reset();
     depthStencilView_.Reset();
@@ -354,13 +468,49 @@ void D3D11SwapChain::ResizeBackBuffer(const Extent2D& resolution)
         bindingCommandBuffer_->ResetDeferredCommandList();
 
     /* Resize swap-chain buffers, let DXGI find out the client area, and preserve buffer count and format */
-    HRESULT hr = swapChain_->ResizeBuffers(0, resolution.width, resolution.height, DXGI_FORMAT_UNKNOWN, 0);
+    HRESULT hr = swapChain_->ResizeBuffers(0, resolution.width, resolution.height, DXGI_FORMAT_UNKNOWN, swapChainFlags_);
     DXThrowIfFailed(hr, "failed to resize DXGI swap-chain buffers");
 
     /* Recreate back buffer and reset default render target */
     CreateBackBuffer();
 }
 
+void D3D11SwapChain::SetMaximumFrameLatency(std::uint32_t maxFramesInFlight)
+{
+    /* IDXGISwapChain2::SetMaximumFrameLatency and IDXGIDevice1::SetMaximumFrameLatency expect a value in the range [1, 16] */
+    const UINT maxFrameLatency = Clamp(maxFramesInFlight, 1u, 16u);
+
+    if ((swapChainFlags_ & DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT) != 0)
+    {
+        /* Limit queued frames per swap-chain and wait for the first frame to become available */
+        ComPtr<IDXGISwapChain2> swapChain2;
+        if (SUCCEEDED(swapChain_.As(&swapChain2)))
+        {
+            swapChain2->SetMaximumFrameLatency(maxFrameLatency);
+            frameLatencyEvent_ = swapChain2->GetFrameLatencyWaitableObject();
+            WaitForFrameLatency();
+        }
+    }
+    else
+    {
+        /* Legacy blit-model swap-chains have no frame latency waitable object, so apply this to the DXGI device, which affects all its swap-chains */
+        ComPtr<IDXGIDevice1> deviceDXGI;
+        if (SUCCEEDED(device_.As(&deviceDXGI)))
+            deviceDXGI->SetMaximumFrameLatency(maxFrameLatency);
+    }
+}
+
+void D3D11SwapChain::WaitForFrameLatency()
+{
+    if (frameLatencyEvent_ != nullptr)
+        WaitForSingleObjectEx(frameLatencyEvent_, 1000, TRUE);
+}
+
+ID3D11Texture2D* D3D11SwapChain::GetRenderTargetColorBuffer() const
+{
+    return (colorBufferMS_ ? colorBufferMS_.Get() : colorBuffer_.Get());
+}
+
 
 } // /namespace LLGL
 
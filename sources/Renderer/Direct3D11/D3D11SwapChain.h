@@ -30,8 +30,10 @@ class D3D11SwapChain final : public SwapChain
             IDXGIFactory*                   factory,
             const ComPtr<ID3D11Device>&     device,
             const SwapChainDescriptor&      desc,
-            const std::shared_ptr<Surface>& surface
+            const std::shared_ptr<Surface>& surface,
+            bool                            flipModel
         );
+        ~D3D11SwapChain();
 
         void SetDebugName(const char* name) override;
 
@@ -72,23 +74,40 @@ class D3D11SwapChain final : public SwapChain
         bool SetPresentSyncInterval(UINT syncInterval);
 
         void CreateSwapChain(IDXGIFactory* factory, const Extent2D& resolution, std::uint32_t samples, std::uint32_t swapBuffers);
+        void CreateSwapChainFlipModel(IDXGIFactory* factory, const Extent2D& resolution, std::uint32_t samples, std::uint32_t swapBuffers);
         void CreateBackBuffer();
         void ResizeBackBuffer(const Extent2D& resolution);
 
+        // Limits the number of queued frames for this swap-chain; uses the frame latency waitable object with the flip model.
+        void SetMaximumFrameLatency(std::uint32_t maxFramesInFlight);
+
+        // Blocks until the swap-chain is ready to accept a new frame if a frame latency waitable object is used.
+        void WaitForFrameLatency();
+
+        // Returns the color buffer that is rendered into, i.e. the multi-sampled color buffer if the flip model is used with multi-sampling.
+        ID3D11Texture2D* GetRenderTargetColorBuffer() const;
+
     private:
 
         ComPtr<ID3D11Device>            device_;
 
         ComPtr<IDXGISwapChain>          swapChain_;
         UINT                            swapChainInterval_      = 0;
+        PresentMode                     presentMode_            = PresentMode::Default;
         DXGI_SAMPLE_DESC                swapChainSampleDesc_    = { 1, 0 };
+        bool                            flipModel_              = false;
+        UINT                            swapChainFlags_         = 0;
+        HANDLE                          frameLatencyEvent_      = nullptr; // Frame latency waitable object; only used with the flip model.
 
+        ComPtr<ID3D11DeviceContext>     immediateContext_;      // Only used to resolve the multi-sampled color buffer with the flip model.
         ComPtr<ID3D11Texture2D>         colorBuffer_;
+        ComPtr<ID3D11Texture2D>         colorBufferMS_;         // Multi-sampled color buffer, since flip-model swap-chains cannot be multi-sampled.
         ComPtr<ID3D11RenderTargetView>  renderTargetView_;
         ComPtr<ID3D11Texture2D>         depthBuffer_;
         ComPtr<ID3D11DepthStencilView>  depthStencilView_;
 
         DXGI_FORMAT                     colorFormat_            = DXGI_FORMAT_UNKNOWN;
+        ColorSpace                      colorSpace_             = ColorSpace::SRGB; // Only used with the flip model.
         DXGI_FORMAT                     depthStencilFormat_     = DXGI_FORMAT_UNKNOWN;
 
         D3D11CommandBuffer*             bindingCommandBuffer_   = nullptr;
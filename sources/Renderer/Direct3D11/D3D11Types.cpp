@@ -204,6 +204,7 @@ D3D11_QUERY Map(const QueryType queryType)
         case QueryType::StreamOutOverflow:                  return D3D11_QUERY_SO_OVERFLOW_PREDICATE;
         case QueryType::StreamOutPrimitivesWritten:         return D3D11_QUERY_SO_STATISTICS;
         case QueryType::PipelineStatistics:                 return D3D11_QUERY_PIPELINE_STATISTICS;
+        case QueryType::Timestamp:                          break;
     }
     DXTypes::MapFailed("QueryType", "D3D11_QUERY");
 }
@@ -23,6 +23,15 @@ D3D11Fence::D3D11Fence(ID3D11Device* device)
     }
     HRESULT hr = device->CreateQuery(&queryDesc, query_.ReleaseAndGetAddressOf());
     DXThrowIfFailed(hr, "failed to create D3D11 query");
+
+    device->GetImmediateContext(context_.ReleaseAndGetAddressOf());
+}
+
+std::uint64_t D3D11Fence::GetCompletedValue()
+{
+    if (completedValue_ < signaledValue_ && IsQueryCompleted(context_.Get()))
+        completedValue_ = signaledValue_;
+    return completedValue_;
 }
 
 void D3D11Fence::Submit(ID3D11DeviceContext* context)
@@ -32,7 +41,34 @@ void D3D11Fence::Submit(ID3D11DeviceContext* context)
 
 void D3D11Fence::Wait(ID3D11DeviceContext* context)
 {
-    while (context->GetData(query_.Get(), nullptr, 0, 0) == S_FALSE) { /* dummy */ }
+    while (!IsQueryCompleted(context)) { /* dummy */ }
+}
+
+void D3D11Fence::SubmitValue(ID3D11DeviceContext* context, std::uint64_t value)
+{
+    Submit(context);
+    signaledValue_ = value;
+}
+
+bool D3D11Fence::WaitValue(ID3D11DeviceContext* context, std::uint64_t value)
+{
+    if (completedValue_ >= value)
+        return true;
+    if (signaledValue_ < value)
+        return false;
+    Wait(context);
+    completedValue_ = signaledValue_;
+    return true;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool D3D11Fence::IsQueryCompleted(ID3D11DeviceContext* context)
+{
+    return (context->GetData(query_.Get(), nullptr, 0, 0) != S_FALSE);
 }
 
 
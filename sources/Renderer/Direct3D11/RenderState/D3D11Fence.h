@@ -22,6 +22,10 @@ namespace LLGL
 class D3D11Fence final : public Fence
 {
 
+    public:
+
+        std::uint64_t GetCompletedValue() override;
+
     public:
 
         D3D11Fence(ID3D11Device* device);
@@ -29,9 +33,27 @@ class D3D11Fence final : public Fence
         void Submit(ID3D11DeviceContext* context);
         void Wait(ID3D11DeviceContext* context);
 
+        // Submits the event query for the specified timeline value.
+        void SubmitValue(ID3D11DeviceContext* context, std::uint64_t value);
+
+        // Waits until the specified timeline value has been completed. Returns false if that value has not been submitted yet.
+        bool WaitValue(ID3D11DeviceContext* context, std::uint64_t value);
+
+    private:
+
+        // Returns true if the GPU has completed the last event query.
+        bool IsQueryCompleted(ID3D11DeviceContext* context);
+
     private:
 
-        ComPtr<ID3D11Query> query_;
+        /*
+        Timelines are emulated with a single event query for the last submitted value.
+        Waiting for an earlier value waits for the last one, which is conservative but correct, since D3D11 commands complete in order.
+        */
+        ComPtr<ID3D11Query>         query_;
+        ComPtr<ID3D11DeviceContext> context_;           // Immediate context to poll the query in GetCompletedValue().
+        std::uint64_t               signaledValue_  = 0;
+        std::uint64_t               completedValue_ = 0;
 
 };
 
@@ -8,6 +8,7 @@
 #include "D3D11ResourceHeap.h"
 #include "D3D11PipelineLayout.h"
 #include "D3D11ResourceType.h"
+#include "D3D11StateManager.h"
 #include "../Buffer/D3D11Buffer.h"
 #include "../Buffer/D3D11BufferWithRV.h"
 #include "../Texture/D3D11Sampler.h"
@@ -243,57 +244,42 @@ std::uint32_t D3D11ResourceHeap::WriteResourceViews(std::uint32_t firstDescripto
     return numWritten;
 }
 
-void D3D11ResourceHeap::BindForGraphicsPipeline(ID3D11DeviceContext* context, std::uint32_t descriptorSet)
-{
-    /* Bind resource views to the graphics shader stages */
-    const char* heapPtr = heap_.SegmentData(descriptorSet);
-    if (segmentation_.hasResourcesVS)
-        heapPtr = BindVSResources(context, heapPtr);
-    if (segmentation_.hasResourcesHS)
-        heapPtr = BindHSResources(context, heapPtr);
-    if (segmentation_.hasResourcesDS)
-        heapPtr = BindDSResources(context, heapPtr);
-    if (segmentation_.hasResourcesGS)
-        heapPtr = BindGSResources(context, heapPtr);
-    if (segmentation_.hasResourcesPS)
-        heapPtr = BindPSResources(context, heapPtr);
-}
-
-void D3D11ResourceHeap::BindForComputePipeline(ID3D11DeviceContext* context, std::uint32_t descriptorSet)
-{
-    /* Bind resource views to the compute shader stage */
-    const char* heapPtr = heap_.SegmentData(descriptorSet) + heapOffsetCS_;
-    if (segmentation_.hasResourcesCS)
-        BindCSResources(context, heapPtr);
-}
-
-#if LLGL_D3D11_ENABLE_FEATURELEVEL >= 1
+#define D3DRESOURCEHEAP_BIND_STAGE_RESOURCES(STAGE, STAGEFLAGS, NUMUAVSEGMENTS)  \
+    BindStageResources(                                                         \
+        stateMngr,                                                              \
+        heapPtr,                                                                \
+        STAGEFLAGS,                                                             \
+        segmentation_.numCBVSegments##STAGE,                                    \
+        segmentation_.numSamplerSegments##STAGE,                                \
+        segmentation_.numSRVSegments##STAGE,                                    \
+        NUMUAVSEGMENTS                                                          \
+    )
 
-void D3D11ResourceHeap::BindForGraphicsPipeline1(ID3D11DeviceContext1* context1, std::uint32_t descriptorSet)
+void D3D11ResourceHeap::BindForGraphicsPipeline(D3D11StateManager& stateMngr, std::uint32_t descriptorSet)
 {
-    /* Bind resource views and constant-buffer ranges to the graphics shader stages */
+    /* Bind resource views to the graphics shader stages; the state manager only submits the views that differ from the currently bound ones */
     const char* heapPtr = heap_.SegmentData(descriptorSet);
     if (segmentation_.hasResourcesVS)
-        heapPtr = BindVSResources1(context1, heapPtr);
+        heapPtr = D3DRESOURCEHEAP_BIND_STAGE_RESOURCES(VS, StageFlags::VertexStage, 0);
     if (segmentation_.hasResourcesHS)
-        heapPtr = BindHSResources1(context1, heapPtr);
+        heapPtr = D3DRESOURCEHEAP_BIND_STAGE_RESOURCES(HS, StageFlags::TessControlStage, 0);
     if (segmentation_.hasResourcesDS)
-        heapPtr = BindDSResources1(context1, heapPtr);
+        heapPtr = D3DRESOURCEHEAP_BIND_STAGE_RESOURCES(DS, StageFlags::TessEvaluationStage, 0);
     if (segmentation_.hasResourcesGS)
-        heapPtr = BindGSResources1(context1, heapPtr);
+        heapPtr = D3DRESOURCEHEAP_BIND_STAGE_RESOURCES(GS, StageFlags::GeometryStage, 0);
     if (segmentation_.hasResourcesPS)
-        heapPtr = BindPSResources1(context1, heapPtr);
+        heapPtr = D3DRESOURCEHEAP_BIND_STAGE_RESOURCES(PS, StageFlags::FragmentStage, segmentation_.numUAVSegmentsPS);
 }
 
-void D3D11ResourceHeap::BindForComputePipeline1(ID3D11DeviceContext1* context1, std::uint32_t descriptorSet)
+void D3D11ResourceHeap::BindForComputePipeline(D3D11StateManager& stateMngr, std::uint32_t descriptorSet)
 {
-    /* Bind resource views and constant-buffer ranges to the compute shader stage */
+    /* Bind resource views to the compute shader stage */
     const char* heapPtr = heap_.SegmentData(descriptorSet) + heapOffsetCS_;
     if (segmentation_.hasResourcesCS)
-        BindCSResources1(context1, heapPtr);
+        D3DRESOURCEHEAP_BIND_STAGE_RESOURCES(CS, StageFlags::ComputeStage, segmentation_.numUAVSegmentsCS);
 }
 
-#endif // /LLGL_D3D11_ENABLE_FEATURELEVEL
+#undef D3DRESOURCEHEAP_BIND_STAGE_RESOURCES
 
 
 /*
@@ -615,130 +601,65 @@ void D3D11ResourceHeap::CacheResourceUsage()
         segmentation_.hasResourcesCS = 1;
 }
 
-#define D3DRESOURCEHEAP_BIND_CONSTANTBUFFERS1(CONTEXT, PTR, STAGE)      \
-    for_range(i, segmentation_.numCBVSegments##STAGE)                   \
-    {                                                                   \
-        auto* segment = D3DRESOURCEHEAP_CONST_SEGMENT(PTR);             \
-        if ((segment->flags & D3DResourceFlags_HasBufferRange) != 0)    \
-        {                                                               \
-            CONTEXT->STAGE##SetConstantBuffers1(                        \
-                segment->startSlot,                                     \
-                segment->numViews,                                      \
-                D3DRESOURCEHEAP_DATA0_CBV_CONST(PTR),                   \
-                D3DRESOURCEHEAP_DATA1(PTR, const UINT),                 \
-                D3DRESOURCEHEAP_DATA2(PTR, const UINT)                  \
-            );                                                          \
-        }                                                               \
-        else                                                            \
-        {                                                               \
-            CONTEXT->STAGE##SetConstantBuffers(                         \
-                segment->startSlot,                                     \
-                segment->numViews,                                      \
-                D3DRESOURCEHEAP_DATA0_CBV_CONST(PTR)                    \
-            );                                                          \
-        }                                                               \
-        PTR += segment->size;                                           \
+const char* D3D11ResourceHeap::BindStageResources(
+    D3D11StateManager&  stateMngr,
+    const char*         heapPtr,
+    long                stageFlags,
+    UINT                numCBVSegments,
+    UINT                numSamplerSegments,
+    UINT                numSRVSegments,
+    UINT                numUAVSegments)
+{
+    /* Bind constant buffers as buffer ranges if any of the segment's buffer views has a range */
+    for_range(i, numCBVSegments)
+    {
+        const D3DResourceHeapSegment* segment = D3DRESOURCEHEAP_CONST_SEGMENT(heapPtr);
+        if ((segment->flags & D3DResourceFlags_HasBufferRange) != 0)
+        {
+            stateMngr.SetConstantBuffersRange(
+                segment->startSlot,
+                segment->numViews,
+                D3DRESOURCEHEAP_DATA0_CBV_CONST(heapPtr),
+                D3DRESOURCEHEAP_DATA1(heapPtr, const UINT),
+                D3DRESOURCEHEAP_DATA2(heapPtr, const UINT),
+                stageFlags
+            );
+        }
+        else
+            stateMngr.SetConstantBuffers(segment->startSlot, segment->numViews, D3DRESOURCEHEAP_DATA0_CBV_CONST(heapPtr), stageFlags);
+        heapPtr += segment->size;
     }
 
-#define D3DRESOURCEHEAP_BIND_UNORDEREDACCESSVIEWS_PS(CONTEXT, PTR)  \
-    for_range(i, segmentation_.numUAVSegmentsPS)                    \
-    {                                                               \
-        auto* segment = D3DRESOURCEHEAP_CONST_SEGMENT(PTR);         \
-        CONTEXT->OMSetRenderTargetsAndUnorderedAccessViews(         \
-            D3D11_KEEP_RENDER_TARGETS_AND_DEPTH_STENCIL,            \
-            nullptr,                                                \
-            nullptr,                                                \
-            segment->startSlot,                                     \
-            segment->numViews,                                      \
-            D3DRESOURCEHEAP_DATA0_UAV_CONST(PTR),                   \
-            D3DRESOURCEHEAP_DATA1(PTR, const UINT)                  \
-        );                                                          \
-        PTR += segment->size;                                       \
+    /* Bind samplers */
+    for_range(i, numSamplerSegments)
+    {
+        const D3DResourceHeapSegment* segment = D3DRESOURCEHEAP_CONST_SEGMENT(heapPtr);
+        stateMngr.SetSamplers(segment->startSlot, segment->numViews, D3DRESOURCEHEAP_DATA0_SAMPLER_CONST(heapPtr), stageFlags);
+        heapPtr += segment->size;
     }
 
-#define D3DRESOURCEHEAP_BIND_UNORDEREDACCESSVIEWS_CS(CONTEXT, PTR)  \
-    for_range(i, segmentation_.numUAVSegmentsCS)                    \
-    {                                                               \
-        auto* segment = D3DRESOURCEHEAP_CONST_SEGMENT(PTR);         \
-        CONTEXT->CSSetUnorderedAccessViews(                         \
-            segment->startSlot,                                     \
-            segment->numViews,                                      \
-            D3DRESOURCEHEAP_DATA0_UAV_CONST(PTR),                   \
-            D3DRESOURCEHEAP_DATA1(PTR, const UINT)                  \
-        );                                                          \
-        PTR += segment->size;                                       \
+    /* Bind shader resource views (SRVs) */
+    for_range(i, numSRVSegments)
+    {
+        const D3DResourceHeapSegment* segment = D3DRESOURCEHEAP_CONST_SEGMENT(heapPtr);
+        stateMngr.SetShaderResources(segment->startSlot, segment->numViews, D3DRESOURCEHEAP_DATA0_SRV_CONST(heapPtr), stageFlags);
+        heapPtr += segment->size;
     }
 
-#define D3DRESOURCEHEAP_BIND_RESOURCE_GENERIC(CONTEXT, PTR, COUNT, FUNC, DATA)  \
-    for_range(i, segmentation_.COUNT)                                           \
-    {                                                                           \
-        auto* segment = D3DRESOURCEHEAP_CONST_SEGMENT(PTR);                     \
-        CONTEXT->FUNC(segment->startSlot, segment->numViews, DATA(PTR));        \
-        heapPtr += segment->size;                                               \
+    /* Bind unordered access views (UAVs); only for pixel and compute stages */
+    for_range(i, numUAVSegments)
+    {
+        const D3DResourceHeapSegment* segment = D3DRESOURCEHEAP_CONST_SEGMENT(heapPtr);
+        stateMngr.SetUnorderedAccessViews(
+            segment->startSlot,
+            segment->numViews,
+            D3DRESOURCEHEAP_DATA0_UAV_CONST(heapPtr),
+            D3DRESOURCEHEAP_DATA1(heapPtr, const UINT),
+            stageFlags
+        );
+        heapPtr += segment->size;
     }
 
-#define D3DRESOURCEHEAP_BIND_CONSTANTBUFFERS(CONTEXT, PTR, STAGE) \
-    D3DRESOURCEHEAP_BIND_RESOURCE_GENERIC(CONTEXT, PTR, numCBVSegments##STAGE, STAGE##SetConstantBuffers, D3DRESOURCEHEAP_DATA0_CBV_CONST)
-
-#define D3DRESOURCEHEAP_BIND_SAMPLERS(CONTEXT, PTR, STAGE) \
-    D3DRESOURCEHEAP_BIND_RESOURCE_GENERIC(CONTEXT, PTR, numSamplerSegments##STAGE, STAGE##SetSamplers, D3DRESOURCEHEAP_DATA0_SAMPLER_CONST)
-
-#define D3DRESOURCEHEAP_BIND_SHADERRESOURCES(CONTEXT, PTR, STAGE) \
-    D3DRESOURCEHEAP_BIND_RESOURCE_GENERIC(CONTEXT, PTR, numSRVSegments##STAGE, STAGE##SetShaderResources, D3DRESOURCEHEAP_DATA0_SRV_CONST)
-
-const char* D3D11ResourceHeap::BindVSResources(ID3D11DeviceContext* context, const char* heapPtr)
-{
-    /* Bind all vertex-stage resources: constant buffers, samplers, shader resource views (SRVs) */
-    D3DRESOURCEHEAP_BIND_CONSTANTBUFFERS(context, heapPtr, VS);
-    D3DRESOURCEHEAP_BIND_SAMPLERS(context, heapPtr, VS);
-    D3DRESOURCEHEAP_BIND_SHADERRESOURCES(context, heapPtr, VS);
-    return heapPtr;
-}
-
-const char* D3D11ResourceHeap::BindHSResources(ID3D11DeviceContext* context, const char* heapPtr)
-{
-    /* Bind all hull-stage resources: constant buffers, samplers, shader resource views (SRVs) */
-    D3DRESOURCEHEAP_BIND_CONSTANTBUFFERS(context, heapPtr, HS);
-    D3DRESOURCEHEAP_BIND_SAMPLERS(context, heapPtr, HS);
-    D3DRESOURCEHEAP_BIND_SHADERRESOURCES(context, heapPtr, HS);
-    return heapPtr;
-}
-
-const char* D3D11ResourceHeap::BindDSResources(ID3D11DeviceContext* context, const char* heapPtr)
-{
-    /* Bind all domain-stage resources: constant buffers, samplers, shader resource views (SRVs) */
-    D3DRESOURCEHEAP_BIND_CONSTANTBUFFERS(context, heapPtr, DS);
-    D3DRESOURCEHEAP_BIND_SAMPLERS(context, heapPtr, DS);
-    D3DRESOURCEHEAP_BIND_SHADERRESOURCES(context, heapPtr, DS);
-    return heapPtr;
-}
-
-const char* D3D11ResourceHeap::BindGSResources(ID3D11DeviceContext* context, const char* heapPtr)
-{
-    /* Bind all geometry-stage resources: constant buffers, samplers, shader resource views (SRVs) */
-    D3DRESOURCEHEAP_BIND_CONSTANTBUFFERS(context, heapPtr, GS);
-    D3DRESOURCEHEAP_BIND_SAMPLERS(context, heapPtr, GS);
-    D3DRESOURCEHEAP_BIND_SHADERRESOURCES(context, heapPtr, GS);
-    return heapPtr;
-}
-
-const char* D3D11ResourceHeap::BindPSResources(ID3D11DeviceContext* context, const char* heapPtr)
-{
-    /* Bind all pixel-stage resources: constant buffers, samplers, shader resource views (SRVs) */
-    D3DRESOURCEHEAP_BIND_CONSTANTBUFFERS(context, heapPtr, PS);
-    D3DRESOURCEHEAP_BIND_SAMPLERS(context, heapPtr, PS);
-    D3DRESOURCEHEAP_BIND_SHADERRESOURCES(context, heapPtr, PS);
-    D3DRESOURCEHEAP_BIND_UNORDEREDACCESSVIEWS_PS(context, heapPtr);
-    return heapPtr;
-}
-
-const char* D3D11ResourceHeap::BindCSResources(ID3D11DeviceContext* context, const char* heapPtr)
-{
-    /* Bind all pixel-stage resources: constant buffers, samplers, shader resource views (SRVs) */
-    D3DRESOURCEHEAP_BIND_CONSTANTBUFFERS(context, heapPtr, CS);
-    D3DRESOURCEHEAP_BIND_SAMPLERS(context, heapPtr, CS);
-    D3DRESOURCEHEAP_BIND_SHADERRESOURCES(context, heapPtr, CS);
-    D3DRESOURCEHEAP_BIND_UNORDEREDACCESSVIEWS_CS(context, heapPtr);
     return heapPtr;
 }
 
@@ -764,62 +685,6 @@ static void VSSetConstantBuffersNull(ID3D11DeviceContext* context, UINT startSlo
 }
 #endif
 
-const char* D3D11ResourceHeap::BindVSResources1(ID3D11DeviceContext1* context1, const char* heapPtr)
-{
-    /* Bind all vertex-stage resources: constant buffers, samplers, shader resource views (SRVs) */
-    D3DRESOURCEHEAP_BIND_CONSTANTBUFFERS1(context1, heapPtr, VS);
-    D3DRESOURCEHEAP_BIND_SAMPLERS(context1, heapPtr, VS);
-    D3DRESOURCEHEAP_BIND_SHADERRESOURCES(context1, heapPtr, VS);
-    return heapPtr;
-}
-
-const char* D3D11ResourceHeap::BindHSResources1(ID3D11DeviceContext1* context1, const char* heapPtr)
-{
-    /* Bind all hull-stage resources: constant buffers, samplers, shader resource views (SRVs) */
-    D3DRESOURCEHEAP_BIND_CONSTANTBUFFERS1(context1, heapPtr, HS);
-    D3DRESOURCEHEAP_BIND_SAMPLERS(context1, heapPtr, HS);
-    D3DRESOURCEHEAP_BIND_SHADERRESOURCES(context1, heapPtr, HS);
-    return heapPtr;
-}
-
-const char* D3D11ResourceHeap::BindDSResources1(ID3D11DeviceContext1* context1, const char* heapPtr)
-{
-    /* Bind all domain-stage resources: constant buffers, samplers, shader resource views (SRVs) */
-    D3DRESOURCEHEAP_BIND_CONSTANTBUFFERS1(context1, heapPtr, DS);
-    D3DRESOURCEHEAP_BIND_SAMPLERS(context1, heapPtr, DS);
-    D3DRESOURCEHEAP_BIND_SHADERRESOURCES(context1, heapPtr, DS);
-    return heapPtr;
-}
-
-const char* D3D11ResourceHeap::BindGSResources1(ID3D11DeviceContext1* context1, const char* heapPtr)
-{
-    /* Bind all geometry-stage resources: constant buffers, samplers, shader resource views (SRVs) */
-    D3DRESOURCEHEAP_BIND_CONSTANTBUFFERS1(context1, heapPtr, GS);
-    D3DRESOURCEHEAP_BIND_SAMPLERS(context1, heapPtr, GS);
-    D3DRESOURCEHEAP_BIND_SHADERRESOURCES(context1, heapPtr, GS);
-    return heapPtr;
-}
-
-const char* D3D11ResourceHeap::BindPSResources1(ID3D11DeviceContext1* context1, const char* heapPtr)
-{
-    /* Bind all pixel-stage resources: constant buffers, samplers, shader resource views (SRVs) */
-    D3DRESOURCEHEAP_BIND_CONSTANTBUFFERS1(context1, heapPtr, PS);
-    D3DRESOURCEHEAP_BIND_SAMPLERS(context1, heapPtr, PS);
-    D3DRESOURCEHEAP_BIND_SHADERRESOURCES(context1, heapPtr, PS);
-    D3DRESOURCEHEAP_BIND_UNORDEREDACCESSVIEWS_PS(context1, heapPtr);
-    return heapPtr;
-}
-
-const char* D3D11ResourceHeap::BindCSResources1(ID3D11DeviceContext1* context1, const char* heapPtr)
-{
-    /* Bind all pixel-stage resources: constant buffers, samplers, shader resource views (SRVs) */
-    D3DRESOURCEHEAP_BIND_CONSTANTBUFFERS1(context1, heapPtr, CS);
-    D3DRESOURCEHEAP_BIND_SAMPLERS(context1, heapPtr, CS);
-    D3DRESOURCEHEAP_BIND_SHADERRESOURCES(context1, heapPtr, CS);
-    D3DRESOURCEHEAP_BIND_UNORDEREDACCESSVIEWS_CS(context1, heapPtr);
-    return heapPtr;
-}
-
 #endif // /LLGL_D3D11_ENABLE_FEATURELEVEL
 
 void D3D11ResourceHeap::WriteResourceViewCBV(const ResourceViewDescriptor& desc, char* heapPtr, std::uint32_t index)
@@ -1116,14 +981,6 @@ void D3D11ResourceHeap::SubresourceIndexContext::Exchange(std::uint16_t& storage
 #undef D3DRESOURCEHEAP_DATA1
 #undef D3DRESOURCEHEAP_DATA2
 
-#undef D3DRESOURCEHEAP_BIND_RESOURCE_GENERIC
-#undef D3DRESOURCEHEAP_BIND_CONSTANTBUFFERS1
-#undef D3DRESOURCEHEAP_BIND_CONSTANTBUFFERS
-#undef D3DRESOURCEHEAP_BIND_SAMPLERS
-#undef D3DRESOURCEHEAP_BIND_SHADERRESOURCES
-#undef D3DRESOURCEHEAP_BIND_UNORDEREDACCESSVIEWS_PS
-#undef D3DRESOURCEHEAP_BIND_UNORDEREDACCESSVIEWS_CS
-
 
 } // /namespace LLGL
 
@@ -29,6 +29,7 @@ enum D3DResourceType : std::uint32_t;
 class D3D11Texture;
 class D3D11BufferWithRV;
 class BindingDescriptorIterator;
+class D3D11StateManager;
 struct ResourceHeapDescriptor;
 struct TextureViewDescriptor;
 struct BufferViewDescriptor;
@@ -54,15 +55,9 @@ class D3D11ResourceHeap final : public ResourceHeap
         // Writes the specified resource views to this resource heap and generates SRVs and UAVs as required.
         std::uint32_t WriteResourceViews(std::uint32_t firstDescriptor, const ArrayView<ResourceViewDescriptor>& resourceViews);
 
-        void BindForGraphicsPipeline(ID3D11DeviceContext* context, std::uint32_t descriptorSet);
-        void BindForComputePipeline(ID3D11DeviceContext* context, std::uint32_t descriptorSet);
-
-        #if LLGL_D3D11_ENABLE_FEATURELEVEL >= 1
-
-        void BindForGraphicsPipeline1(ID3D11DeviceContext1* context1, std::uint32_t descriptorSet);
-        void BindForComputePipeline1(ID3D11DeviceContext1* context1, std::uint32_t descriptorSet);
-
-        #endif
+        // Binds the resource views of the specified descriptor set to the graphics or compute shader stages. Only views that are not already bound are submitted.
+        void BindForGraphicsPipeline(D3D11StateManager& stateMngr, std::uint32_t descriptorSet);
+        void BindForComputePipeline(D3D11StateManager& stateMngr, std::uint32_t descriptorSet);
 
     private:
 
@@ -201,23 +196,15 @@ class D3D11ResourceHeap final : public ResourceHeap
         void WriteBindingMappings(D3DShaderStage stage, D3DResourceType type, const D3DResourceBinding* first, UINT count);
         void CacheResourceUsage();
 
-        const char* BindVSResources(ID3D11DeviceContext* context, const char* heapPtr);
-        const char* BindHSResources(ID3D11DeviceContext* context, const char* heapPtr);
-        const char* BindDSResources(ID3D11DeviceContext* context, const char* heapPtr);
-        const char* BindGSResources(ID3D11DeviceContext* context, const char* heapPtr);
-        const char* BindPSResources(ID3D11DeviceContext* context, const char* heapPtr);
-        const char* BindCSResources(ID3D11DeviceContext* context, const char* heapPtr);
-
-        #if LLGL_D3D11_ENABLE_FEATURELEVEL >= 1
-
-        const char* BindVSResources1(ID3D11DeviceContext1* context1, const char* heapPtr);
-        const char* BindHSResources1(ID3D11DeviceContext1* context1, const char* heapPtr);
-        const char* BindDSResources1(ID3D11DeviceContext1* context1, const char* heapPtr);
-        const char* BindGSResources1(ID3D11DeviceContext1* context1, const char* heapPtr);
-        const char* BindPSResources1(ID3D11DeviceContext1* context1, const char* heapPtr);
-        const char* BindCSResources1(ID3D11DeviceContext1* context1, const char* heapPtr);
-
-        #endif
+        const char* BindStageResources(
+            D3D11StateManager&  stateMngr,
+            const char*         heapPtr,
+            long                stageFlags,
+            UINT                numCBVSegments,
+            UINT                numSamplerSegments,
+            UINT                numSRVSegments,
+            UINT                numUAVSegments
+        );
 
         void WriteResourceViewCBV(const ResourceViewDescriptor& desc, char* heapPtr, std::uint32_t index);
         void WriteResourceViewSRV(ID3D11ShaderResourceView* srv, char* heapPtr, std::uint32_t index, SubresourceIndexContext& subresourceContext);
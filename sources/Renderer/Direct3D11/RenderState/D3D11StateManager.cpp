@@ -10,7 +10,9 @@
 #include "../../../Core/MacroUtils.h"
 #include <LLGL/Utils/ForRange.h>
 #include <algorithm>
+#include <iterator>
 #include <cstddef>
+#include <cstdint>
 
 
 namespace LLGL
@@ -34,6 +36,7 @@ D3D11StateManager::D3D11StateManager(ID3D11Device* device, const ComPtr<ID3D11De
     #if LLGL_D3D11_ENABLE_FEATURELEVEL >= 1
     context_->QueryInterface(IID_PPV_ARGS(&context1_));
     #endif
+    InvalidateResourceBindings();
 }
 
 // Check if D3D11_VIEWPORT and Viewport structures can be safely reinterpret-casted
@@ -168,9 +171,10 @@ void D3D11StateManager::SetPixelShader(ID3D11PixelShader* shader)
 
 void D3D11StateManager::SetComputeShader(ID3D11ComputeShader* shader)
 {
-    if (shaderState_.cs != shader)
+    if (shaderState_.cs != shader || builtinCS_ != nullptr)
     {
         shaderState_.cs = shader;
+        builtinCS_      = nullptr;
         context_->CSSetShader(shader, nullptr, 0);
     }
 }
@@ -259,18 +263,131 @@ void D3D11StateManager::SetBlendFactor(const FLOAT blendFactor[4])
     }
 }
 
+// Returns a placeholder for unknown resource bindings. This is never dereferenced and only forces the next binding of a slot to be submitted.
+template <typename T>
+static T* GetInvalidBinding()
+{
+    return reinterpret_cast<T*>(~std::uintptr_t(0));
+}
+
+template <typename T, std::size_t N>
+static void InvalidateBoundResources(T* (&boundResources)[N])
+{
+    std::fill(std::begin(boundResources), std::end(boundResources), GetInvalidBinding<T>());
+}
+
+/*
+Trims the leading and trailing resources that are already bound and stores the remaining ones as bound resources.
+On return, the half-open range [outBegin, outEnd) specifies the resources that must be submitted.
+Returns false if all resources are already bound. Slots beyond the cached range are always submitted.
+*/
+template <typename T, std::size_t N>
+static bool UpdateBoundResources(T* (&boundResources)[N], UINT startSlot, UINT count, T* const* resources, UINT& outBegin, UINT& outEnd)
+{
+    if (startSlot + count > N)
+    {
+        outBegin    = 0;
+        outEnd      = count;
+        return (count > 0);
+    }
+
+    UINT begin = 0, end = count;
+    while (begin < end && boundResources[startSlot + begin] == resources[begin])
+        ++begin;
+    while (end > begin && boundResources[startSlot + end - 1] == resources[end - 1])
+        --end;
+
+    for (UINT i = begin; i < end; ++i)
+        boundResources[startSlot + i] = resources[i];
+
+    outBegin    = begin;
+    outEnd      = end;
+    return (begin < end);
+}
+
+// Same as UpdateBoundResources() but for constant buffers including their ranges. Null pointers for 'firstConstants' and 'numConstants' denote entire buffers.
+template <typename TState>
+static bool UpdateBoundConstantBuffers(
+    TState&                 state,
+    UINT                    startSlot,
+    UINT                    count,
+    ID3D11Buffer* const*    buffers,
+    const UINT*             firstConstants,
+    const UINT*             numConstants,
+    UINT&                   outBegin,
+    UINT&                   outEnd)
+{
+    if (startSlot + count > D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT)
+    {
+        outBegin    = 0;
+        outEnd      = count;
+        return (count > 0);
+    }
+
+    auto IsBound = [&](UINT i) -> bool
+    {
+        const UINT slot = startSlot + i;
+        return
+        (
+            state.constantBuffers[slot] == buffers[i] &&
+            state.firstConstants[slot]  == (firstConstants != nullptr ? firstConstants[i] : 0) &&
+            state.numConstants[slot]    == (numConstants   != nullptr ? numConstants[i]   : 0)
+        );
+    };
+
+    UINT begin = 0, end = count;
+    while (begin < end && IsBound(begin))
+        ++begin;
+    while (end > begin && IsBound(end - 1))
+        --end;
+
+    for (UINT i = begin; i < end; ++i)
+    {
+        const UINT slot = startSlot + i;
+        state.constantBuffers[slot] = buffers[i];
+        state.firstConstants[slot]  = (firstConstants != nullptr ? firstConstants[i] : 0);
+        state.numConstants[slot]    = (numConstants   != nullptr ? numConstants[i]   : 0);
+    }
+
+    outBegin    = begin;
+    outEnd      = end;
+    return (begin < end);
+}
+
+#define LLGL_D3D11_SET_CONSTANT_BUFFERS(STAGE)                                                                                                  \
+    if (LLGL_##STAGE##_STAGE(stageFlags) &&                                                                                                     \
+        UpdateBoundConstantBuffers(stageResources_[D3DShaderStage_##STAGE], startSlot, count, buffers, nullptr, nullptr, begin, end))            \
+    {                                                                                                                                           \
+        context_->STAGE##SetConstantBuffers(startSlot + begin, end - begin, buffers + begin);                                                   \
+    }
+
+#define LLGL_D3D11_SET_CONSTANT_BUFFERS1(STAGE)                                                                                                 \
+    if (LLGL_##STAGE##_STAGE(stageFlags) &&                                                                                                     \
+        UpdateBoundConstantBuffers(stageResources_[D3DShaderStage_##STAGE], startSlot, count, buffers, firstConstants, numConstants, begin, end)) \
+    {                                                                                                                                           \
+        context1_->STAGE##SetConstantBuffers1(startSlot + begin, end - begin, buffers + begin, firstConstants + begin, numConstants + begin);    \
+    }
+
+#define LLGL_D3D11_SET_STAGE_RESOURCES(STAGE, CACHE, FUNC, RESOURCES)                                           \
+    if (LLGL_##STAGE##_STAGE(stageFlags) &&                                                                     \
+        UpdateBoundResources(stageResources_[D3DShaderStage_##STAGE].CACHE, startSlot, count, RESOURCES, begin, end)) \
+    {                                                                                                           \
+        context_->STAGE##FUNC(startSlot + begin, end - begin, RESOURCES + begin);                               \
+    }
+
 void D3D11StateManager::SetConstantBuffers(
     UINT                    startSlot,
     UINT                    count,
     ID3D11Buffer* const*    buffers,
     long                    stageFlags)
 {
-    if (LLGL_VS_STAGE(stageFlags)) { context_->VSSetConstantBuffers(startSlot, count, buffers); }
-    if (LLGL_HS_STAGE(stageFlags)) { context_->HSSetConstantBuffers(startSlot, count, buffers); }
-    if (LLGL_DS_STAGE(stageFlags)) { context_->DSSetConstantBuffers(startSlot, count, buffers); }
-    if (LLGL_GS_STAGE(stageFlags)) { context_->GSSetConstantBuffers(startSlot, count, buffers); }
-    if (LLGL_PS_STAGE(stageFlags)) { context_->PSSetConstantBuffers(startSlot, count, buffers); }
-    if (LLGL_CS_STAGE(stageFlags)) { context_->CSSetConstantBuffers(startSlot, count, buffers); }
+    UINT begin = 0, end = 0;
+    LLGL_D3D11_SET_CONSTANT_BUFFERS(VS);
+    LLGL_D3D11_SET_CONSTANT_BUFFERS(HS);
+    LLGL_D3D11_SET_CONSTANT_BUFFERS(DS);
+    LLGL_D3D11_SET_CONSTANT_BUFFERS(GS);
+    LLGL_D3D11_SET_CONSTANT_BUFFERS(PS);
+    LLGL_D3D11_SET_CONSTANT_BUFFERS(CS);
 }
 
 void D3D11StateManager::SetConstantBuffersRange(
@@ -285,12 +402,13 @@ void D3D11StateManager::SetConstantBuffersRange(
     if (context1_ != nullptr)
     {
         /* Bind buffer range to shader stage */
-        if (LLGL_VS_STAGE(stageFlags)) { context1_->VSSetConstantBuffers1(startSlot, count, buffers, firstConstants, numConstants); }
-        if (LLGL_HS_STAGE(stageFlags)) { context1_->HSSetConstantBuffers1(startSlot, count, buffers, firstConstants, numConstants); }
-        if (LLGL_DS_STAGE(stageFlags)) { context1_->DSSetConstantBuffers1(startSlot, count, buffers, firstConstants, numConstants); }
-        if (LLGL_GS_STAGE(stageFlags)) { context1_->GSSetConstantBuffers1(startSlot, count, buffers, firstConstants, numConstants); }
-        if (LLGL_PS_STAGE(stageFlags)) { context1_->PSSetConstantBuffers1(startSlot, count, buffers, firstConstants, numConstants); }
-        if (LLGL_CS_STAGE(stageFlags)) { context1_->CSSetConstantBuffers1(startSlot, count, buffers, firstConstants, numConstants); }
+        UINT begin = 0, end = 0;
+        LLGL_D3D11_SET_CONSTANT_BUFFERS1(VS);
+        LLGL_D3D11_SET_CONSTANT_BUFFERS1(HS);
+        LLGL_D3D11_SET_CONSTANT_BUFFERS1(DS);
+        LLGL_D3D11_SET_CONSTANT_BUFFERS1(GS);
+        LLGL_D3D11_SET_CONSTANT_BUFFERS1(PS);
+        LLGL_D3D11_SET_CONSTANT_BUFFERS1(CS);
     }
     else
     #endif
@@ -305,12 +423,7 @@ void D3D11StateManager::SetConstantBuffersRange(
         #endif
 
         /* Bind buffer to shader stage */
-        if (LLGL_VS_STAGE(stageFlags)) { context_->VSSetConstantBuffers(startSlot, count, buffers); }
-        if (LLGL_HS_STAGE(stageFlags)) { context_->HSSetConstantBuffers(startSlot, count, buffers); }
-        if (LLGL_DS_STAGE(stageFlags)) { context_->DSSetConstantBuffers(startSlot, count, buffers); }
-        if (LLGL_GS_STAGE(stageFlags)) { context_->GSSetConstantBuffers(startSlot, count, buffers); }
-        if (LLGL_PS_STAGE(stageFlags)) { context_->PSSetConstantBuffers(startSlot, count, buffers); }
-        if (LLGL_CS_STAGE(stageFlags)) { context_->CSSetConstantBuffers(startSlot, count, buffers); }
+        SetConstantBuffers(startSlot, count, buffers, stageFlags);
     }
 }
 
@@ -320,12 +433,13 @@ void D3D11StateManager::SetShaderResources(
     ID3D11ShaderResourceView* const*    views,
     long                                stageFlags)
 {
-    if (LLGL_VS_STAGE(stageFlags)) { context_->VSSetShaderResources(startSlot, count, views); }
-    if (LLGL_HS_STAGE(stageFlags)) { context_->HSSetShaderResources(startSlot, count, views); }
-    if (LLGL_DS_STAGE(stageFlags)) { context_->DSSetShaderResources(startSlot, count, views); }
-    if (LLGL_GS_STAGE(stageFlags)) { context_->GSSetShaderResources(startSlot, count, views); }
-    if (LLGL_PS_STAGE(stageFlags)) { context_->PSSetShaderResources(startSlot, count, views); }
-    if (LLGL_CS_STAGE(stageFlags)) { context_->CSSetShaderResources(startSlot, count, views); }
+    UINT begin = 0, end = 0;
+    LLGL_D3D11_SET_STAGE_RESOURCES(VS, shaderResources, SetShaderResources, views);
+    LLGL_D3D11_SET_STAGE_RESOURCES(HS, shaderResources, SetShaderResources, views);
+    LLGL_D3D11_SET_STAGE_RESOURCES(DS, shaderResources, SetShaderResources, views);
+    LLGL_D3D11_SET_STAGE_RESOURCES(GS, shaderResources, SetShaderResources, views);
+    LLGL_D3D11_SET_STAGE_RESOURCES(PS, shaderResources, SetShaderResources, views);
+    LLGL_D3D11_SET_STAGE_RESOURCES(CS, shaderResources, SetShaderResources, views);
 }
 
 void D3D11StateManager::SetUnorderedAccessViews(
@@ -335,6 +449,9 @@ void D3D11StateManager::SetUnorderedAccessViews(
     const UINT*                         initialCounts,
     long                                stageFlags)
 {
+    /* Binding UAVs implicitly unbinds SRVs of the same resources */
+    InvalidateShaderResources();
+
     if (LLGL_PS_STAGE(stageFlags))
     {
         /* Set UAVs for pixel shader stage */
@@ -362,32 +479,43 @@ void D3D11StateManager::SetSamplers(
     ID3D11SamplerState* const*  samplers,
     long                        stageFlags)
 {
-    if (LLGL_VS_STAGE(stageFlags)) { context_->VSSetSamplers(startSlot, count, samplers); }
-    if (LLGL_HS_STAGE(stageFlags)) { context_->HSSetSamplers(startSlot, count, samplers); }
-    if (LLGL_DS_STAGE(stageFlags)) { context_->DSSetSamplers(startSlot, count, samplers); }
-    if (LLGL_GS_STAGE(stageFlags)) { context_->GSSetSamplers(startSlot, count, samplers); }
-    if (LLGL_PS_STAGE(stageFlags)) { context_->PSSetSamplers(startSlot, count, samplers); }
-    if (LLGL_CS_STAGE(stageFlags)) { context_->CSSetSamplers(startSlot, count, samplers); }
+    UINT begin = 0, end = 0;
+    LLGL_D3D11_SET_STAGE_RESOURCES(VS, samplers, SetSamplers, samplers);
+    LLGL_D3D11_SET_STAGE_RESOURCES(HS, samplers, SetSamplers, samplers);
+    LLGL_D3D11_SET_STAGE_RESOURCES(DS, samplers, SetSamplers, samplers);
+    LLGL_D3D11_SET_STAGE_RESOURCES(GS, samplers, SetSamplers, samplers);
+    LLGL_D3D11_SET_STAGE_RESOURCES(PS, samplers, SetSamplers, samplers);
+    LLGL_D3D11_SET_STAGE_RESOURCES(CS, samplers, SetSamplers, samplers);
+}
+
+#undef LLGL_D3D11_SET_CONSTANT_BUFFERS
+#undef LLGL_D3D11_SET_CONSTANT_BUFFERS1
+#undef LLGL_D3D11_SET_STAGE_RESOURCES
+
+void D3D11StateManager::InvalidateResourceBindings()
+{
+    for (D3DStageResourceState& state : stageResources_)
+    {
+        InvalidateBoundResources(state.constantBuffers);
+        InvalidateBoundResources(state.shaderResources);
+        InvalidateBoundResources(state.samplers);
+    }
+}
+
+void D3D11StateManager::InvalidateShaderResources()
+{
+    for (D3DStageResourceState& state : stageResources_)
+        InvalidateBoundResources(state.shaderResources);
 }
 
 void D3D11StateManager::SetGraphicsStaticSampler(const D3D11StaticSampler& staticSamplerD3D)
 {
-    if (LLGL_VS_STAGE(staticSamplerD3D.stageFlags))
-        context_->VSSetSamplers(staticSamplerD3D.slot, 1, staticSamplerD3D.native.GetAddressOf());
-    if (LLGL_HS_STAGE(staticSamplerD3D.stageFlags))
-        context_->HSSetSamplers(staticSamplerD3D.slot, 1, staticSamplerD3D.native.GetAddressOf());
-    if (LLGL_DS_STAGE(staticSamplerD3D.stageFlags))
-        context_->DSSetSamplers(staticSamplerD3D.slot, 1, staticSamplerD3D.native.GetAddressOf());
-    if (LLGL_GS_STAGE(staticSamplerD3D.stageFlags))
-        context_->GSSetSamplers(staticSamplerD3D.slot, 1, staticSamplerD3D.native.GetAddressOf());
-    if (LLGL_PS_STAGE(staticSamplerD3D.stageFlags))
-        context_->PSSetSamplers(staticSamplerD3D.slot, 1, staticSamplerD3D.native.GetAddressOf());
+    SetSamplers(staticSamplerD3D.slot, 1, staticSamplerD3D.native.GetAddressOf(), (staticSamplerD3D.stageFlags & ~StageFlags::ComputeStage));
 }
 
 void D3D11StateManager::SetComputeStaticSampler(const D3D11StaticSampler& staticSamplerD3D)
 {
-    if (LLGL_CS_STAGE(staticSamplerD3D.stageFlags))
-        context_->CSSetSamplers(staticSamplerD3D.slot, 1, staticSamplerD3D.native.GetAddressOf());
+    SetSamplers(staticSamplerD3D.slot, 1, staticSamplerD3D.native.GetAddressOf(), (staticSamplerD3D.stageFlags & StageFlags::ComputeStage));
 }
 
 void D3D11StateManager::SetConstants(UINT slot, const void* data, UINT dataSize, long stageFlags)
@@ -406,10 +534,23 @@ void D3D11StateManager::SetConstants(UINT slot, const void* data, UINT dataSize,
 
 void D3D11StateManager::DispatchBuiltin(const D3D11BuiltinShader builtinShader, UINT numWorkGroupsX, UINT numWorkGroupsY, UINT numWorkGroupsZ)
 {
+    /* Keep builtin shader bound for consecutive dispatches, e.g. from multiple buffer/texture copy commands */
     ID3D11ComputeShader* cs = D3D11BuiltinShaderFactory::Get().GetBulitinShader(builtinShader).cs.Get();
-    context_->CSSetShader(cs, nullptr, 0);
+    if (builtinCS_ != cs)
+    {
+        builtinCS_ = cs;
+        context_->CSSetShader(cs, nullptr, 0);
+    }
     context_->Dispatch(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
-    context_->CSSetShader(shaderState_.cs, nullptr, 0);
+}
+
+void D3D11StateManager::RestoreComputeShader()
+{
+    if (builtinCS_ != nullptr)
+    {
+        builtinCS_ = nullptr;
+        context_->CSSetShader(shaderState_.cs, nullptr, 0);
+    }
 }
 
 void D3D11StateManager::ResetStagingBufferPools()
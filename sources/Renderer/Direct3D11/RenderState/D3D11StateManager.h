@@ -92,15 +92,24 @@ class D3D11StateManager
             long                        stageFlags
         );
 
+        // Invalidates the cached resource bindings of all shader stages, so the next bindings are submitted to the device context unconditionally.
+        void InvalidateResourceBindings();
+
+        // Invalidates the cached SRVs of all shader stages. Must be called when output views are bound, since D3D11 implicitly unbinds conflicting SRVs.
+        void InvalidateShaderResources();
+
         void SetGraphicsStaticSampler(const D3D11StaticSampler& staticSamplerD3D);
         void SetComputeStaticSampler(const D3D11StaticSampler& staticSamplerD3D);
 
         // Binds an intermediate constant buffer and updates its content with the specified data.
         void SetConstants(UINT slot, const void* data, UINT dataSize, long stageFlags);
 
-        // Executes the specified builtin compute shader.
+        // Executes the specified builtin compute shader. The builtin shader stays bound until RestoreComputeShader() or SetComputeShader() is called.
         void DispatchBuiltin(const D3D11BuiltinShader builtinShader, UINT numWorkGroupsX, UINT numWorkGroupsY, UINT numWorkGroupsZ);
 
+        // Re-binds the compute shader of the current pipeline state if a builtin compute shader has been dispatched.
+        void RestoreComputeShader();
+
         // Must be called in D3D11CommandBuffer::Begin().
         void ResetStagingBufferPools();
 
@@ -138,6 +147,28 @@ class D3D11StateManager
             UINT                        sampleMask          = 0xffffffff;
         };
 
+        enum D3DShaderStage : std::uint32_t
+        {
+            D3DShaderStage_VS = 0,
+            D3DShaderStage_HS,
+            D3DShaderStage_DS,
+            D3DShaderStage_GS,
+            D3DShaderStage_PS,
+            D3DShaderStage_CS,
+
+            D3DShaderStage_Count,
+        };
+
+        // Resources that are currently bound to a shader stage; used to only submit the sub-ranges that differ.
+        struct D3DStageResourceState
+        {
+            ID3D11Buffer*               constantBuffers[D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT];
+            UINT                        firstConstants[D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT];
+            UINT                        numConstants[D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT];   // 0 for entire buffer.
+            ID3D11ShaderResourceView*   shaderResources[D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT];
+            ID3D11SamplerState*         samplers[D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT];
+        };
+
     private:
 
         ComPtr<ID3D11DeviceContext>     context_;
@@ -150,7 +181,9 @@ class D3D11StateManager
 
         D3DInputAssemblyState           inputAssemblyState_;
         D3DShaderState                  shaderState_;
+        ID3D11ComputeShader*            builtinCS_          = nullptr; // Builtin compute shader that is currently bound instead of shaderState_.cs
         D3DRenderState                  renderState_;
+        D3DStageResourceState           stageResources_[D3DShaderStage_Count];
 
 };
 
@@ -9,6 +9,7 @@
 #include "Builtin/D3D11Builtin.h"
 #include "../../DXCommon/DXCore.h"
 #include "../../DXCommon/DXTypes.h"
+#include "../../DXCommon/Builtin/BlitTexture.hlsl.inl"
 #include <stdexcept>
 
 
@@ -24,6 +25,7 @@ D3D11BuiltinShaderFactory& D3D11BuiltinShaderFactory::Get()
 
 void D3D11BuiltinShaderFactory::CreateBuiltinShaders(ID3D11Device* device)
 {
+    device_ = device;
     LoadBuiltinShader(device, D3D11BuiltinShader::CopyTexture1DFromBufferCS,
         LLGL_IDR_D3D11_COPYTEXTURE1DFROMBUFFER_CS, sizeof(LLGL_IDR_D3D11_COPYTEXTURE1DFROMBUFFER_CS));
     LoadBuiltinShader(device, D3D11BuiltinShader::CopyTexture2DFromBufferCS,
@@ -42,6 +44,26 @@ void D3D11BuiltinShaderFactory::Clear()
 {
     for (auto& native : builtinShaders_)
         native.vs = nullptr;
+    device_ = nullptr;
+}
+
+bool D3D11BuiltinShaderFactory::CompileRuntimeBuiltinShader(const D3D11BuiltinShader builtin)
+{
+    const auto idx = static_cast<std::size_t>(builtin);
+    if (builtinShaders_[idx].vs.Get() != nullptr)
+        return true;
+
+    switch (builtin)
+    {
+        case D3D11BuiltinShader::BlitTexture2DCS:
+            if (ComPtr<ID3DBlob> blob = DXCompileBlitTextureShader())
+                builtinShaders_[idx] = D3D11Shader::CreateNativeShaderFromBlob(device_, ShaderType::Compute, blob.Get());
+            break;
+        default:
+            break;
+    }
+
+    return (builtinShaders_[idx].vs.Get() != nullptr);
 }
 
 const D3D11NativeShader& D3D11BuiltinShaderFactory::GetBulitinShader(const D3D11BuiltinShader builtin) const
@@ -63,6 +85,7 @@ static ShaderType GetBuiltinShaderType(const D3D11BuiltinShader builtin)
         case D3D11BuiltinShader::CopyBufferFromTexture1DCS:
         case D3D11BuiltinShader::CopyBufferFromTexture2DCS:
         case D3D11BuiltinShader::CopyBufferFromTexture3DCS:
+        case D3D11BuiltinShader::BlitTexture2DCS:
             return ShaderType::Compute;
     }
     return ShaderType::Undefined;
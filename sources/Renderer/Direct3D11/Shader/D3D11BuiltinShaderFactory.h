@@ -25,6 +25,7 @@ enum class D3D11BuiltinShader
     CopyBufferFromTexture1DCS,
     CopyBufferFromTexture2DCS,
     CopyBufferFromTexture3DCS,
+    BlitTexture2DCS,            // Compiled at runtime on first use (see CompileRuntimeBuiltinShader)
     Num
 };
 
@@ -46,6 +47,9 @@ class D3D11BuiltinShaderFactory
         // Releases all builtin shaders.
         void Clear();
 
+        // Compiles the specified builtin shader from HLSL source if it has not been compiled yet and returns true on success.
+        bool CompileRuntimeBuiltinShader(const D3D11BuiltinShader builtin);
+
         // Returns the specified native builtin shader.
         const D3D11NativeShader& GetBulitinShader(const D3D11BuiltinShader builtin) const;
 
@@ -62,7 +66,8 @@ class D3D11BuiltinShaderFactory
 
         static const std::size_t g_numBuiltinShaders = static_cast<std::size_t>(D3D11BuiltinShader::Num);
 
-        D3D11NativeShader builtinShaders_[D3D11BuiltinShaderFactory::g_numBuiltinShaders];
+        ID3D11Device*       device_ = nullptr;
+        D3D11NativeShader   builtinShaders_[D3D11BuiltinShaderFactory::g_numBuiltinShaders];
 
 };
 
@@ -10,6 +10,7 @@
 #include "../D3D11ObjectUtils.h"
 #include "../../DXCommon/DXCore.h"
 #include "../../DXCommon/DXTypes.h"
+#include "../../ShaderCacheUtils.h"
 #include "../../../Core/CoreUtils.h"
 #include "../../../Core/StringUtils.h"
 #include "../../../Core/ReportUtils.h"
@@ -24,10 +25,10 @@ namespace LLGL
 {
 
 
-D3D11Shader::D3D11Shader(ID3D11Device* device, const ShaderDescriptor& desc) :
+D3D11Shader::D3D11Shader(ID3D11Device* device, const ShaderDescriptor& desc, ShaderCache* shaderCache) :
     Shader { desc.type }
 {
-    if (BuildShader(device, desc))
+    if (BuildShader(device, desc, shaderCache))
     {
         if (GetType() == ShaderType::Vertex)
         {
@@ -81,10 +82,10 @@ HRESULT D3D11Shader::ReflectAndCacheConstantBuffers(const std::vector<D3D11Const
  * ======= Private: =======
  */
 
-bool D3D11Shader::BuildShader(ID3D11Device* device, const ShaderDescriptor& shaderDesc)
+bool D3D11Shader::BuildShader(ID3D11Device* device, const ShaderDescriptor& shaderDesc, ShaderCache* shaderCache)
 {
     if (IsShaderSourceCode(shaderDesc.sourceType))
-        return CompileSource(device, shaderDesc);
+        return CompileSource(device, shaderDesc, shaderCache);
     else
         return LoadBinary(device, shaderDesc);
 }
@@ -152,7 +153,7 @@ void D3D11Shader::BuildInputLayout(ID3D11Device* device, UINT numVertexAttribs,
 }
 
 // see https://msdn.microsoft.com/en-us/library/windows/desktop/dd607324(v=vs.85).aspx
-bool D3D11Shader::CompileSource(ID3D11Device* device, const ShaderDescriptor& shaderDesc)
+bool D3D11Shader::CompileSource(ID3D11Device* device, const ShaderDescriptor& shaderDesc, ShaderCache* shaderCache)
 {
     /* Get source code */
     std::string fileContent;
@@ -180,6 +181,15 @@ bool D3D11Shader::CompileSource(ID3D11Device* device, const ShaderDescriptor& sh
     auto        defines = reinterpret_cast<const D3D_SHADER_MACRO*>(shaderDesc.defines);
     auto        flags   = shaderDesc.flags;
 
+    /* Try to load bytecode from shader cache first */
+    const std::uint64_t cacheKey = (shaderCache != nullptr ? GetShaderCacheKey(shaderDesc, sourceCode, sourceLength, "FXC") : 0);
+    byteCode_ = DXLoadCachedShader(shaderCache, cacheKey);
+    if (byteCode_)
+    {
+        CreateNativeShader(device, shaderDesc.vertex.outputAttribs.size(), shaderDesc.vertex.outputAttribs.data());
+        return true;
+    }
+
     /* Compile shader code */
     ComPtr<ID3DBlob> errors;
     HRESULT hr = D3DCompile(
@@ -196,9 +206,13 @@ bool D3D11Shader::CompileSource(ID3D11Device* device, const ShaderDescriptor& sh
         errors.ReleaseAndGetAddressOf()     // ID3DBlob**           ppErrorMsgs
     );
 
-    /* Get byte code from blob */
+    /* Get byte code from blob and store it in the shader cache */
     if (byteCode_)
+    {
         CreateNativeShader(device, shaderDesc.vertex.outputAttribs.size(), shaderDesc.vertex.outputAttribs.data());
+        if (SUCCEEDED(hr))
+            DXStoreCachedShader(shaderCache, cacheKey, byteCode_.Get());
+    }
 
     /* Store if compilation was successful */
     const bool hasErrors = FAILED(hr);
@@ -210,8 +224,9 @@ bool D3D11Shader::LoadBinary(ID3D11Device* device, const ShaderDescriptor& shade
 {
     if (shaderDesc.sourceType == ShaderSourceType::BinaryFile)
     {
-        /* Load binary code from file */
-        byteCode_ = DXCreateBlob(ReadFileBuffer(shaderDesc.source));
+        /* Map binary code from file and copy it into native blob */
+        const Blob fileContent = ReadFileMapped(shaderDesc.source);
+        byteCode_ = DXCreateBlob(fileContent.GetData(), fileContent.GetSize());
     }
     else
     {
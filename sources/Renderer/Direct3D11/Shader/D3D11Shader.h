@@ -24,6 +24,8 @@ namespace LLGL
 {
 
 
+class ShaderCache;
+
 // Union for easy handling of native D3D11 shader objects.
 union D3D11NativeShader
 {
@@ -80,7 +82,8 @@ class D3D11Shader final : public Shader
 
     public:
 
-        D3D11Shader(ID3D11Device* device, const ShaderDescriptor& desc);
+        // Creates the shader and loads its bytecode from the optional shader cache if it is compiled from source.
+        D3D11Shader(ID3D11Device* device, const ShaderDescriptor& desc, ShaderCache* shaderCache = nullptr);
 
         // Returns a list of all reflected constant buffers including their fields.
         HRESULT ReflectAndCacheConstantBuffers(const std::vector<D3D11ConstantBufferReflection>** outConstantBuffers);
@@ -117,10 +120,10 @@ class D3D11Shader final : public Shader
 
     private:
 
-        bool BuildShader(ID3D11Device* device, const ShaderDescriptor& shaderDesc);
+        bool BuildShader(ID3D11Device* device, const ShaderDescriptor& shaderDesc, ShaderCache* shaderCache);
         void BuildInputLayout(ID3D11Device* device, UINT numVertexAttribs, const VertexAttribute* vertexAttribs);
 
-        bool CompileSource(ID3D11Device* device, const ShaderDescriptor& shaderDesc);
+        bool CompileSource(ID3D11Device* device, const ShaderDescriptor& shaderDesc, ShaderCache* shaderCache);
         bool LoadBinary(ID3D11Device* device, const ShaderDescriptor& shaderDesc);
 
         void CreateNativeShader(
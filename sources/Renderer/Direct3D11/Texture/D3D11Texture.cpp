@@ -8,6 +8,7 @@
 #include "D3D11Texture.h"
 #include "../D3D11Types.h"
 #include "../D3D11ObjectUtils.h"
+#include "../D3D11DeferredUploadQueue.h"
 #include "../D3D11ResourceFlags.h"
 #include "../../DXCommon/DXCore.h"
 #include "../../DXCommon/DXTypes.h"
@@ -15,6 +16,7 @@
 #include "../../../Core/Assertion.h"
 #include <LLGL/Utils/ForRange.h>
 #include <LLGL/Report.h>
+#include <LLGL/Backend/Direct3D11/NativeHandle.h>
 
 
 namespace LLGL
@@ -57,6 +59,23 @@ void D3D11Texture::SetDebugName(const char* name)
         D3D11SetObjectNameSubscript(uav_.Get(), name, ".UAV");
 }
 
+void D3D11Texture::SetResidencyPriority(ResidencyPriority priority)
+{
+    GetNativeResource()->SetEvictionPriority(DXTypes::ToDXResidencyPriority(priority));
+}
+
+bool D3D11Texture::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
+{
+    if (nativeHandle != nullptr && nativeHandleSize == sizeof(Direct3D11::ResourceNativeHandle))
+    {
+        auto* nativeHandleD3D = reinterpret_cast<Direct3D11::ResourceNativeHandle*>(nativeHandle);
+        nativeHandleD3D->resource = GetNativeResource();
+        nativeHandleD3D->resource->AddRef();
+        return true;
+    }
+    return false;
+}
+
 Extent3D D3D11Texture::GetMipExtent(std::uint32_t mipLevel) const
 {
     Extent3D size;
@@ -275,18 +294,27 @@ HRESULT D3D11Texture::UpdateSubresource(
         srcData             = intermediateData.get();
         LLGL_ASSERT(intermediateData.size() == dataLayout.subresourceSize);
     }
+    else if (DynamicByteArray compressedData = CompressTextureImageData(format, imageView, extent, numArrayLayers))
+    {
+        /* Compress uncompressed image data (e.g. from RGBA to BC1) on the CPU, and redirect initial data to new buffer */
+        intermediateData    = std::move(compressedData);
+        srcData             = intermediateData.get();
+    }
 
     /* Update subresource with specified image data */
     for_range(arrayLayer, numArrayLayers)
     {
         UINT dstSubresource = CalcSubresource(mipLevel, baseArrayLayer + arrayLayer);
-        context->UpdateSubresource(
+        D3D11UpdateSubresource(
+            context,
             native_.resource.Get(),
             dstSubresource,
             &dstBox,
             srcData,
             dataLayout.rowStride,
-            dataLayout.layerStride
+            dataLayout.layerStride,
+            formatAttribs.bitSize / 8,
+            formatAttribs.blockWidth
         );
         srcData += dataLayout.layerStride;
     }
@@ -59,6 +59,8 @@ class D3D11Texture final : public Texture
     public:
 
         void SetDebugName(const char* name) override;
+        void SetResidencyPriority(ResidencyPriority priority) override;
+        bool GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize) override;
 
     public:
 
@@ -0,0 +1,104 @@
+/*
+ * D3D12AccelerationStructure.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "D3D12AccelerationStructure.h"
+#include "D3D12Buffer.h"
+#include "../../DXCommon/DXTypes.h"
+#include "../../CheckedCast.h"
+#include <LLGL/Utils/ForRange.h>
+
+
+namespace LLGL
+{
+
+
+static D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS GetD3DAccelerationStructureBuildFlags(long flags, bool isUpdate)
+{
+    UINT flagsD3D = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_NONE;
+
+    if ((flags & AccelerationStructureFlags::AllowUpdate) != 0)
+        flagsD3D |= D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_ALLOW_UPDATE;
+    if ((flags & AccelerationStructureFlags::AllowCompaction) != 0)
+        flagsD3D |= D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_ALLOW_COMPACTION;
+    if ((flags & AccelerationStructureFlags::PreferFastTrace) != 0)
+        flagsD3D |= D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_PREFER_FAST_TRACE;
+    if ((flags & AccelerationStructureFlags::PreferFastBuild) != 0)
+        flagsD3D |= D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_PREFER_FAST_BUILD;
+    if (isUpdate)
+        flagsD3D |= D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_PERFORM_UPDATE;
+
+    return static_cast<D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS>(flagsD3D);
+}
+
+static void ConvertD3DGeometryDesc(D3D12_RAYTRACING_GEOMETRY_DESC& dst, const AccelerationStructureTriangles& src)
+{
+    dst.Type    = D3D12_RAYTRACING_GEOMETRY_TYPE_TRIANGLES;
+    dst.Flags   = (src.opaque ? D3D12_RAYTRACING_GEOMETRY_FLAG_OPAQUE : D3D12_RAYTRACING_GEOMETRY_FLAG_NONE);
+
+    D3D12_RAYTRACING_GEOMETRY_TRIANGLES_DESC& triangles = dst.Triangles;
+    {
+        triangles.Transform3x4                  = 0;
+        triangles.VertexFormat                  = DXTypes::ToDXGIFormat(src.vertexFormat);
+        triangles.VertexCount                   = src.numVertices;
+        triangles.VertexBuffer.StartAddress     = D3D12GetBufferGPUAddress(src.vertexBuffer, src.vertexOffset);
+        triangles.VertexBuffer.StrideInBytes    = src.vertexStride;
+        if (src.indexBuffer != nullptr)
+        {
+            triangles.IndexFormat               = DXTypes::ToDXGIFormat(src.indexFormat);
+            triangles.IndexCount                = src.numIndices;
+            triangles.IndexBuffer               = D3D12GetBufferGPUAddress(src.indexBuffer, src.indexOffset);
+        }
+        else
+        {
+            triangles.IndexFormat               = DXGI_FORMAT_UNKNOWN;
+            triangles.IndexCount                = 0;
+            triangles.IndexBuffer               = 0;
+        }
+    }
+}
+
+void D3D12ConvertAccelerationStructureInputs(
+    D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS&   outInputs,
+    std::vector<D3D12_RAYTRACING_GEOMETRY_DESC>&            outGeometryDescs,
+    const AccelerationStructureBuildDescriptor&             buildDesc,
+    bool                                                    isUpdate)
+{
+    outInputs.Flags         = GetD3DAccelerationStructureBuildFlags(buildDesc.flags, isUpdate);
+    outInputs.DescsLayout   = D3D12_ELEMENTS_LAYOUT_ARRAY;
+
+    if (buildDesc.type == AccelerationStructureType::TopLevel)
+    {
+        outInputs.Type          = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL;
+        outInputs.NumDescs      = buildDesc.numInstances;
+        outInputs.InstanceDescs = D3D12GetBufferGPUAddress(buildDesc.instanceBuffer, buildDesc.instanceOffset);
+    }
+    else
+    {
+        outGeometryDescs.resize(buildDesc.triangles.size());
+        for_range(i, buildDesc.triangles.size())
+            ConvertD3DGeometryDesc(outGeometryDescs[i], buildDesc.triangles[i]);
+
+        outInputs.Type              = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL;
+        outInputs.NumDescs          = static_cast<UINT>(outGeometryDescs.size());
+        outInputs.pGeometryDescs    = outGeometryDescs.data();
+    }
+}
+
+D3D12_GPU_VIRTUAL_ADDRESS D3D12GetBufferGPUAddress(const Buffer* buffer, UINT64 offset)
+{
+    if (buffer == nullptr)
+        return 0;
+    auto* bufferD3D = LLGL_CAST(const D3D12Buffer*, buffer);
+    return bufferD3D->GetNative()->GetGPUVirtualAddress() + offset;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,44 @@
+/*
+ * D3D12AccelerationStructure.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_D3D12_ACCELERATION_STRUCTURE_H
+#define LLGL_D3D12_ACCELERATION_STRUCTURE_H
+
+
+#include <LLGL/AccelerationStructureFlags.h>
+#include <d3d12.h>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/*
+Converts the specified acceleration structure build descriptor into native build inputs.
+The geometry descriptors are written to 'outGeometryDescs', which must outlive 'outInputs'.
+If 'isUpdate' is true, the inputs are flagged to update the source acceleration structure in place.
+*/
+void D3D12ConvertAccelerationStructureInputs(
+    D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS&   outInputs,
+    std::vector<D3D12_RAYTRACING_GEOMETRY_DESC>&            outGeometryDescs,
+    const AccelerationStructureBuildDescriptor&             buildDesc,
+    bool                                                    isUpdate = false
+);
+
+// Returns the GPU virtual address of the specified buffer plus offset, or 0 if the buffer is null.
+D3D12_GPU_VIRTUAL_ADDRESS D3D12GetBufferGPUAddress(const Buffer* buffer, UINT64 offset = 0);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
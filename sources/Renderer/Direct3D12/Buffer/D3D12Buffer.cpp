@@ -14,6 +14,7 @@
 #include "../../BufferUtils.h"
 #include "../../../Core/Assertion.h"
 #include "../../../Core/CoreUtils.h"
+#include <LLGL/Backend/Direct3D12/NativeHandle.h>
 #include <stdexcept>
 
 
@@ -26,13 +27,16 @@ namespace LLGL
 static const UINT64 g_soBufferFillSizeLen   = sizeof(UINT64);
 static const UINT64 g_cBufferAlignment      = 256u;
 
+// Use value of D3D12_HEAP_TYPE_GPU_UPLOAD since it is not declared in older Windows SDKs
+static const D3D12_HEAP_TYPE g_heapTypeGPUUpload = static_cast<D3D12_HEAP_TYPE>(5);
+
 // Returns DXGI_FORMAT_UNKNOWN for a structured buffer, or maps the format attribute to DXGI_FORMAT enum.
 static DXGI_FORMAT GetDXFormatForBuffer(const BufferDescriptor& desc)
 {
     return (IsStructuredBuffer(desc) ? DXGI_FORMAT_UNKNOWN : DXTypes::ToDXGIFormat(desc.format));
 }
 
-D3D12Buffer::D3D12Buffer(ID3D12Device* device, const BufferDescriptor& desc) :
+D3D12Buffer::D3D12Buffer(ID3D12Device* device, const BufferDescriptor& desc, bool allowGPUUploadHeap) :
     Buffer  { desc.bindFlags             },
     format_ { GetDXFormatForBuffer(desc) }
 {
@@ -41,12 +45,16 @@ D3D12Buffer::D3D12Buffer(ID3D12Device* device, const BufferDescriptor& desc) :
         alignment_ = g_cBufferAlignment;
 
     /* Create native buffer resource */
-    CreateGpuBuffer(device, desc);
+    CreateGpuBuffer(device, desc, allowGPUUploadHeap);
 
-    /* Create CPU access buffer */
-    if (desc.cpuAccessFlags != 0)
+    /* Create CPU access buffer; readback and upload heap buffers are mapped directly */
+    if (desc.cpuAccessFlags != 0 && !isReadback_ && !isUpload_)
         CreateCpuAccessBuffer(device, desc.cpuAccessFlags);
 
+    /* Map CPU accessible resource only once for persistently mapped buffers */
+    if (desc.cpuAccessFlags != 0 && (desc.miscFlags & MiscFlags::PersistentMapping) != 0)
+        MapPersistentData(desc.cpuAccessFlags);
+
     /* Create sub-resource views */
     if ((desc.bindFlags & BindFlags::VertexBuffer) != 0)
         CreateVertexBufferView(desc);
@@ -64,6 +72,23 @@ void D3D12Buffer::SetDebugName(const char* name)
     D3D12SetObjectName(resource_.Get(), name);
 }
 
+void D3D12Buffer::SetResidencyPriority(ResidencyPriority priority)
+{
+    D3D12SetResidencyPriority(GetNative(), priority);
+}
+
+bool D3D12Buffer::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
+{
+    if (nativeHandle != nullptr && nativeHandleSize == sizeof(Direct3D12::ResourceNativeHandle))
+    {
+        auto* nativeHandleD3D = reinterpret_cast<Direct3D12::ResourceNativeHandle*>(nativeHandle);
+        nativeHandleD3D->resource = GetNative();
+        nativeHandleD3D->resource->AddRef();
+        return true;
+    }
+    return false;
+}
+
 BufferDescriptor D3D12Buffer::GetDesc() const
 {
     /* Get native resource descriptor and convert */
@@ -118,11 +143,17 @@ void D3D12Buffer::CreateConstantBufferViewPrimary(
 
 void D3D12Buffer::CreateShaderResourceView(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle)
 {
+    if ((GetBindFlags() & BindFlags::AccelerationStructure) != 0)
+        return CreateAccelerationStructureView(device, cpuDescHandle);
     CreateShaderResourceViewPrimary(device, cpuDescHandle, 0, static_cast<UINT>(GetBufferSize() / stride_), stride_, format_);
 }
 
 void D3D12Buffer::CreateShaderResourceView(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle, const BufferViewDescriptor& bufferViewDesc)
 {
+    /* Acceleration structures are always viewed as a whole */
+    if ((GetBindFlags() & BindFlags::AccelerationStructure) != 0)
+        return CreateAccelerationStructureView(device, cpuDescHandle);
+
     const UINT      stride          = GetStrideForView(bufferViewDesc.format);
     const UINT64    firstElement    = bufferViewDesc.offset / stride;
     const UINT      numElements     = static_cast<UINT>(std::min(bufferViewDesc.size, GetBufferSize()) / stride);
@@ -152,6 +183,20 @@ void D3D12Buffer::CreateShaderResourceViewPrimary(
     device->CreateShaderResourceView(GetNative(), &srvDesc, cpuDescHandle);
 }
 
+//private
+void D3D12Buffer::CreateAccelerationStructureView(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle)
+{
+    /* Acceleration structure views are specified by their GPU address and must not reference the resource object */
+    D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc;
+    {
+        srvDesc.Format                                      = DXGI_FORMAT_UNKNOWN;
+        srvDesc.ViewDimension                               = D3D12_SRV_DIMENSION_RAYTRACING_ACCELERATION_STRUCTURE;
+        srvDesc.Shader4ComponentMapping                     = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+        srvDesc.RaytracingAccelerationStructure.Location    = GetNative()->GetGPUVirtualAddress();
+    }
+    device->CreateShaderResourceView(nullptr, &srvDesc, cpuDescHandle);
+}
+
 void D3D12Buffer::CreateUnorderedAccessView(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle)
 {
     CreateUnorderedAccessViewPrimary(device, cpuDescHandle, 0, static_cast<UINT>(GetBufferSize() / stride_), stride_, format_);
@@ -283,6 +328,27 @@ HRESULT D3D12Buffer::Map(
     void**                  mappedData,
     const CPUAccess         access)
 {
+    if (persistentData_ != nullptr)
+    {
+        /* Return pointer into persistent mapping; only buffers with a separate CPU access buffer need a copy for read access */
+        mappedRange_        = range;
+        mappedCPUaccess_    = access;
+
+        if (cpuAccessBuffer_.Get() != nullptr && HasReadAccess(access))
+            ReadCpuAccessBufferRange(commandContext, commandQueue, range);
+
+        *mappedData = persistentData_ + range.Begin;
+        return S_OK;
+    }
+
+    if (isReadback_)
+    {
+        /* Map readback heap directly; the application is responsible to wait for pending copy commands */
+        mappedRange_        = range;
+        mappedCPUaccess_    = access;
+        return resource_.Get()->Map(0, &range, mappedData);
+    }
+
     if (cpuAccessBuffer_.Get() != nullptr)
     {
         /* Store mapped state */
@@ -292,18 +358,7 @@ HRESULT D3D12Buffer::Map(
         if (HasReadAccess(access))
         {
             /* Copy content from GPU host memory to CPU memory */
-            commandContext.TransitionResource(resource_, D3D12_RESOURCE_STATE_COPY_SOURCE, true);
-            {
-                commandContext.GetCommandList()->CopyBufferRegion(
-                    cpuAccessBuffer_.Get(),
-                    range.Begin,
-                    GetNative(),
-                    range.Begin,
-                    range.End - range.Begin
-                );
-            }
-            commandContext.TransitionResource(resource_, resource_.usageState, true);
-            commandContext.FinishAndSync(commandQueue);
+            ReadCpuAccessBufferRange(commandContext, commandQueue, range);
 
             /* Map with read range */
             return cpuAccessBuffer_.Get()->Map(0, &range, mappedData);
@@ -322,6 +377,22 @@ void D3D12Buffer::Unmap(
     D3D12CommandContext&    commandContext,
     D3D12CommandQueue&      commandQueue)
 {
+    if (persistentData_ != nullptr)
+    {
+        /* Keep persistent mapping and only copy the written range into the GPU buffer; upload heap memory needs no flush */
+        if (cpuAccessBuffer_.Get() != nullptr && HasWriteAccess(mappedCPUaccess_))
+            WriteCpuAccessBufferRange(commandContext, commandQueue, mappedRange_);
+        return;
+    }
+
+    if (isReadback_)
+    {
+        /* Unmap readback heap without written range */
+        const D3D12_RANGE nullRange{ 0, 0 };
+        resource_.Get()->Unmap(0, &nullRange);
+        return;
+    }
+
     if (cpuAccessBuffer_.Get() != nullptr)
     {
         if (HasWriteAccess(mappedCPUaccess_))
@@ -330,18 +401,7 @@ void D3D12Buffer::Unmap(
             cpuAccessBuffer_.Get()->Unmap(0, &mappedRange_);
 
             /* Copy content from CPU memory to GPU host memory */
-            commandContext.TransitionResource(resource_, D3D12_RESOURCE_STATE_COPY_DEST, true);
-            {
-                commandContext.GetCommandList()->CopyBufferRegion(
-                    GetNative(),
-                    mappedRange_.Begin,
-                    cpuAccessBuffer_.Get(),
-                    mappedRange_.Begin,
-                    mappedRange_.End - mappedRange_.Begin
-                );
-            }
-            commandContext.TransitionResource(resource_, resource_.usageState, true);
-            commandContext.FinishAndSync(commandQueue);
+            WriteCpuAccessBufferRange(commandContext, commandQueue, mappedRange_);
         }
         else
         {
@@ -361,12 +421,28 @@ static D3D12_RESOURCE_FLAGS GetD3DResourceFlags(const BufferDescriptor& desc)
 {
     UINT flags = 0;
 
-    if ((desc.bindFlags & BindFlags::Storage) != 0)
+    if ((desc.bindFlags & (BindFlags::Storage | BindFlags::AccelerationStructure)) != 0)
         flags |= D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS;
 
     return static_cast<D3D12_RESOURCE_FLAGS>(flags);
 }
 
+/*
+Returns true if the specified buffer can reside in the upload heap, so the GPU reads the persistently mapped memory directly.
+Resources in the upload heap must stay in the generic read state, so this is limited to buffers that are never written by the GPU.
+*/
+static bool IsUploadHeapBuffer(const BufferDescriptor& desc)
+{
+    const long uploadBindFlags = (BindFlags::VertexBuffer | BindFlags::IndexBuffer | BindFlags::ConstantBuffer);
+    return
+    (
+        (desc.miscFlags & MiscFlags::PersistentMapping) != 0 &&
+        (desc.miscFlags & MiscFlags::Readback) == 0 &&
+        (desc.cpuAccessFlags & CPUAccessFlags::Write) != 0 &&
+        (desc.bindFlags & ~uploadBindFlags) == 0
+    );
+}
+
 //TODO: transition sources before binding
 static D3D12_RESOURCE_STATES GetD3DUsageState(long bindFlags)
 {
@@ -390,7 +466,7 @@ static D3D12_RESOURCE_STATES GetD3DUsageState(long bindFlags)
 }
 
 // see https://docs.microsoft.com/en-us/windows/desktop/api/d3d12/nf-d3d12-id3d12device-createcommittedresource
-void D3D12Buffer::CreateGpuBuffer(ID3D12Device* device, const BufferDescriptor& desc)
+void D3D12Buffer::CreateGpuBuffer(ID3D12Device* device, const BufferDescriptor& desc, bool allowGPUUploadHeap)
 {
     /* Store buffer attributes */
     bufferSize_ = GetAlignedSize<UINT64>(desc.size, alignment_);
@@ -401,14 +477,29 @@ void D3D12Buffer::CreateGpuBuffer(ID3D12Device* device, const BufferDescriptor&
     if ((desc.bindFlags & BindFlags::StreamOutputBuffer) != 0)
         internalSize_ += g_soBufferFillSizeLen;
 
+    /* Readback buffers reside in the readback heap and must stay in the copy destination state */
+    isReadback_ = ((desc.miscFlags & MiscFlags::Readback) != 0);
+
+    /* Persistently mapped buffers that are only read by the GPU reside in the upload heap and must stay in the generic read state */
+    isUpload_ = IsUploadHeapBuffer(desc);
+
+    /* The GPU upload heap has the same CPU access as the upload heap, but resides in video memory, so GPU reads are not limited by the PCIe bandwidth */
+    const D3D12_HEAP_TYPE       uploadType  = (allowGPUUploadHeap ? g_heapTypeGPUUpload : D3D12_HEAP_TYPE_UPLOAD);
+    const D3D12_HEAP_TYPE       heapType    = (isReadback_ ? D3D12_HEAP_TYPE_READBACK : isUpload_ ? uploadType : D3D12_HEAP_TYPE_DEFAULT);
+    const D3D12_RESOURCE_STATES usageState  = (isReadback_ ? D3D12_RESOURCE_STATE_COPY_DEST : isUpload_ ? D3D12_RESOURCE_STATE_GENERIC_READ : GetD3DUsageState(desc.bindFlags));
+
+    /* Acceleration structures must be created in their final state and can never be transitioned */
+    const bool                  isAccelStruct   = ((desc.bindFlags & BindFlags::AccelerationStructure) != 0);
+    const D3D12_RESOURCE_STATES initialState    = (isAccelStruct ? D3D12_RESOURCE_STATE_RAYTRACING_ACCELERATION_STRUCTURE : isUpload_ ? usageState : D3D12_RESOURCE_STATE_COPY_DEST);
+
     /* Create generic buffer resource */
-    const CD3DX12_HEAP_PROPERTIES heapProperties{ D3D12_HEAP_TYPE_DEFAULT };
+    const CD3DX12_HEAP_PROPERTIES heapProperties{ heapType };
     const CD3DX12_RESOURCE_DESC bufferDesc = CD3DX12_RESOURCE_DESC::Buffer(GetInternalBufferSize(), GetD3DResourceFlags(desc));
     HRESULT hr = device->CreateCommittedResource(
         &heapProperties,
         D3D12_HEAP_FLAG_NONE,
         &bufferDesc,
-        resource_.SetInitialAndUsageStates(D3D12_RESOURCE_STATE_COPY_DEST, GetD3DUsageState(desc.bindFlags)),
+        resource_.SetInitialAndUsageStates(initialState, (isAccelStruct ? initialState : usageState)),
         nullptr,
         IID_PPV_ARGS(resource_.native.ReleaseAndGetAddressOf())
     );
@@ -447,6 +538,53 @@ void D3D12Buffer::CreateCpuAccessBuffer(ID3D12Device* device, long cpuAccessFlag
     DXThrowIfCreateFailed(hr, "ID3D12Resource", "for D3D12 CPU access buffer");
 }
 
+void D3D12Buffer::MapPersistentData(long cpuAccessFlags)
+{
+    /* Map the resource that is accessible by the CPU for the entire lifetime of this buffer; it is unmapped implicitly when the resource is released */
+    ID3D12Resource* resource = (cpuAccessBuffer_.Get() != nullptr ? cpuAccessBuffer_.Get() : resource_.Get());
+
+    const D3D12_RANGE nullRange{ 0, 0 };
+    const D3D12_RANGE* readRange = ((cpuAccessFlags & CPUAccessFlags::Read) != 0 ? nullptr : &nullRange);
+
+    void* mappedData = nullptr;
+    HRESULT hr = resource->Map(0, readRange, &mappedData);
+    DXThrowIfFailed(hr, "failed to map D3D12 buffer persistently");
+
+    persistentData_ = static_cast<char*>(mappedData);
+}
+
+void D3D12Buffer::ReadCpuAccessBufferRange(D3D12CommandContext& commandContext, D3D12CommandQueue& commandQueue, const D3D12_RANGE& range)
+{
+    commandContext.TransitionResource(resource_, D3D12_RESOURCE_STATE_COPY_SOURCE, true);
+    {
+        commandContext.GetCommandList()->CopyBufferRegion(
+            cpuAccessBuffer_.Get(),
+            range.Begin,
+            GetNative(),
+            range.Begin,
+            range.End - range.Begin
+        );
+    }
+    commandContext.TransitionResource(resource_, resource_.usageState, true);
+    commandContext.FinishAndSync(commandQueue);
+}
+
+void D3D12Buffer::WriteCpuAccessBufferRange(D3D12CommandContext& commandContext, D3D12CommandQueue& commandQueue, const D3D12_RANGE& range)
+{
+    commandContext.TransitionResource(resource_, D3D12_RESOURCE_STATE_COPY_DEST, true);
+    {
+        commandContext.GetCommandList()->CopyBufferRegion(
+            GetNative(),
+            range.Begin,
+            cpuAccessBuffer_.Get(),
+            range.Begin,
+            range.End - range.Begin
+        );
+    }
+    commandContext.TransitionResource(resource_, resource_.usageState, true);
+    commandContext.FinishAndSync(commandQueue);
+}
+
 void D3D12Buffer::CreateIntermediateUAVDescriptorHeap(ID3D12Resource* resource, DXGI_FORMAT format, UINT formatStride)
 {
     /* Use device the resource was created with */
@@ -30,12 +30,18 @@ class D3D12Buffer : public Buffer
     public:
 
         void SetDebugName(const char* name) override;
+        void SetResidencyPriority(ResidencyPriority priority) override;
+        bool GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize) override;
 
         BufferDescriptor GetDesc() const override;
 
     public:
 
-        D3D12Buffer(ID3D12Device* device, const BufferDescriptor& desc);
+        /*
+        Creates the buffer resource. If 'allowGPUUploadHeap' is true, buffers that would reside in the upload heap (see IsUpload)
+        are placed in the GPU upload heap instead, i.e. in video memory that is also CPU visible (requires resizable BAR).
+        */
+        D3D12Buffer(ID3D12Device* device, const BufferDescriptor& desc, bool allowGPUUploadHeap = false);
 
         // Creates a resource views within the native buffer object:
         void CreateConstantBufferView(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle);
@@ -135,10 +141,33 @@ class D3D12Buffer : public Buffer
             return format_;
         }
 
+        // Returns true if this buffer resides in the readback heap (see MiscFlags::Readback).
+        inline bool IsReadback() const
+        {
+            return isReadback_;
+        }
+
+        // Returns true if this buffer resides in the upload heap and is read by the GPU directly (see MiscFlags::PersistentMapping).
+        inline bool IsUpload() const
+        {
+            return isUpload_;
+        }
+
+        // Returns the CPU memory space of a persistently mapped buffer or null if this buffer is not mapped persistently.
+        inline char* GetPersistentData() const
+        {
+            return persistentData_;
+        }
+
     private:
 
-        void CreateGpuBuffer(ID3D12Device* device, const BufferDescriptor& desc);
+        void CreateGpuBuffer(ID3D12Device* device, const BufferDescriptor& desc, bool allowGPUUploadHeap);
         void CreateCpuAccessBuffer(ID3D12Device* device, long cpuAccessFlags);
+        void MapPersistentData(long cpuAccessFlags);
+
+        // Copies the specified range between the GPU buffer and the CPU access buffer and waits for the command queue.
+        void ReadCpuAccessBufferRange(D3D12CommandContext& commandContext, D3D12CommandQueue& commandQueue, const D3D12_RANGE& range);
+        void WriteCpuAccessBufferRange(D3D12CommandContext& commandContext, D3D12CommandQueue& commandQueue, const D3D12_RANGE& range);
 
         void CreateIntermediateUAVDescriptorHeap(ID3D12Resource* resource, DXGI_FORMAT format, UINT formatStride);
         void CreateIntermediateUAVBuffer();
@@ -163,6 +192,8 @@ class D3D12Buffer : public Buffer
             DXGI_FORMAT                 format
         );
 
+        void CreateAccelerationStructureView(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle);
+
         void CreateUnorderedAccessViewPrimary(
             ID3D12Device*               device,
             D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle,
@@ -203,6 +234,9 @@ class D3D12Buffer : public Buffer
         UINT                            alignment_                  = 1;
         UINT                            stride_                     = 1;
         DXGI_FORMAT                     format_                     = DXGI_FORMAT_UNKNOWN;
+        bool                            isReadback_                 = false;
+        bool                            isUpload_                   = false;
+        char*                           persistentData_             = nullptr;
 
         D3D12_VERTEX_BUFFER_VIEW        vertexBufferView_           = {};
         D3D12_INDEX_BUFFER_VIEW         indexBufferView_            = {};
@@ -10,8 +10,8 @@
 
 
 #include <LLGL/BufferArray.h>
+#include <LLGL/Container/SmallVector.h>
 #include <d3d12.h>
-#include <vector>
 
 
 namespace LLGL
@@ -28,14 +28,14 @@ class D3D12BufferArray final : public BufferArray
         D3D12BufferArray(std::uint32_t numBuffers, Buffer* const * bufferArray);
 
         // Returns the array of vertex buffer views.
-        inline const std::vector<D3D12_VERTEX_BUFFER_VIEW>& GetVertexBufferViews() const
+        inline const SmallVector<D3D12_VERTEX_BUFFER_VIEW>& GetVertexBufferViews() const
         {
             return vertexBufferViews_;
         }
 
     private:
 
-        std::vector<D3D12_VERTEX_BUFFER_VIEW> vertexBufferViews_;
+        SmallVector<D3D12_VERTEX_BUFFER_VIEW> vertexBufferViews_;
 
 };
 
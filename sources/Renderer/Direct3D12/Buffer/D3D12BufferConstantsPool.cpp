@@ -6,7 +6,6 @@
  */
 
 #include "D3D12BufferConstantsPool.h"
-#include "D3D12StagingBufferPool.h"
 #include "../Command/D3D12CommandContext.h"
 #include "../D3DX12/d3dx12.h"
 #include "../D3D12Resource.h"
@@ -28,15 +27,14 @@ D3D12BufferConstantsPool& D3D12BufferConstantsPool::Get()
 void D3D12BufferConstantsPool::InitializeDevice(
     ID3D12Device*           device,
     D3D12CommandContext&    commandContext,
-    D3D12CommandQueue&      commandQueue,
-    D3D12StagingBufferPool& stagingBufferPool)
+    D3D12CommandQueue&      commandQueue)
 {
     /* Register constants */
     std::vector<std::uint64_t> data;
     {
         RegisterConstants(D3D12BufferConstants::ZeroUInt64, 0, 1, data);
     }
-    CreateImmutableBuffer(device, commandContext, commandQueue, stagingBufferPool, data);
+    CreateImmutableBuffer(device, commandContext, commandQueue, data);
 }
 
 void D3D12BufferConstantsPool::Clear()
@@ -88,7 +86,6 @@ void D3D12BufferConstantsPool::CreateImmutableBuffer(
     ID3D12Device*               device,
     D3D12CommandContext&        commandContext,
     D3D12CommandQueue&          commandQueue,
-    D3D12StagingBufferPool&     stagingBufferPool,
     std::vector<std::uint64_t>& data)
 {
     /* Create generic buffer resource */
@@ -106,7 +103,7 @@ void D3D12BufferConstantsPool::CreateImmutableBuffer(
     DXThrowIfCreateFailed(hr, "ID3D12Resource", "for D3D12 buffer constants pool");
 
     /* Initialize buffer with registered constants */
-    stagingBufferPool.WriteImmediate(commandContext, resource_, 0, data.data(), bufferSize);
+    commandContext.UpdateSubresource(resource_, 0, data.data(), bufferSize);
     commandContext.FinishAndSync(commandQueue);
 }
 
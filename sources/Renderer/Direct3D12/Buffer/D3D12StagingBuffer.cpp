@@ -8,6 +8,7 @@
 #include "D3D12StagingBuffer.h"
 #include "../../DXCommon/DXCore.h"
 #include "../../../Core/CoreUtils.h"
+#include "../../../Core/ImageUtils.h"
 #include "../D3DX12/d3dx12.h"
 #include <string.h>
 
@@ -97,8 +98,8 @@ HRESULT D3D12StagingBuffer::Write(
     if (FAILED(hr))
         return hr;
 
-    /* Copy input data to staging buffer */
-    ::memcpy(mappedData + offset_, data, static_cast<std::size_t>(dataSize));
+    /* Copy input data to staging buffer; upload heaps are write-combined, so bypass the CPU cache */
+    CopyMemoryNonTemporal(mappedData + offset_, data, static_cast<std::size_t>(dataSize));
 
     /* Unmap buffer with range of written data */
     const D3D12_RANGE writtenRange
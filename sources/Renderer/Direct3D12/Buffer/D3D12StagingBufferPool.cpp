@@ -9,7 +9,9 @@
 #include "../Command/D3D12CommandContext.h"
 #include "../D3D12Resource.h"
 #include "../../../Core/CoreUtils.h"
+#include "../../../Core/ImageUtils.h"
 #include <algorithm>
+#include <string.h>
 
 
 namespace LLGL
@@ -30,8 +32,8 @@ void D3D12StagingBufferPool::InitializeDevice(ID3D12Device* device, UINT64 chunk
 
 void D3D12StagingBufferPool::Reset()
 {
-    for (D3D12StagingBuffer& chunk : chunks_)
-        chunk.Reset();
+    /* Release overflow chunks, so that a spike of uploads does not keep oversized upload heaps alive */
+    chunks_.clear();
     chunkIdx_ = 0;
 }
 
@@ -42,7 +44,20 @@ HRESULT D3D12StagingBufferPool::WriteStaged(
     const void*             data,
     UINT64                  dataSize)
 {
-    /* Find a chunk that fits the requested data size or allocate a new chunk */
+    /* Write data into upload ring buffer of the command context if it has enough free space left */
+    D3D12UploadRegion uploadRegion;
+    if (commandContext.AllocUploadRegion(dataSize, D3D12StagingBufferPool::uploadAlignment, uploadRegion))
+    {
+        CopyMemoryNonTemporal(uploadRegion.cpuAddress, data, static_cast<std::size_t>(dataSize));
+        commandContext.TransitionResource(dstBuffer, D3D12_RESOURCE_STATE_COPY_DEST, true);
+        {
+            commandContext.GetCommandList()->CopyBufferRegion(dstBuffer.Get(), dstOffset, uploadRegion.resource, uploadRegion.offset, dataSize);
+        }
+        commandContext.TransitionResource(dstBuffer, dstBuffer.usageState, true);
+        return S_OK;
+    }
+
+    /* Find an overflow chunk that fits the requested data size or allocate a new chunk */
     while (chunkIdx_ < chunks_.size() && !chunks_[chunkIdx_].Capacity(dataSize))
         ++chunkIdx_;
 
@@ -60,24 +75,6 @@ HRESULT D3D12StagingBufferPool::WriteStaged(
     return hr;
 }
 
-HRESULT D3D12StagingBufferPool::WriteImmediate(
-    D3D12CommandContext&    commandContext,
-    D3D12Resource&          dstBuffer,
-    UINT64                  dstOffset,
-    const void*             data,
-    UINT64                  dataSize,
-    UINT64                  alignment)
-{
-    /* Write data to global upload buffer and copy region to destination buffer */
-    HRESULT hr;
-    commandContext.TransitionResource(dstBuffer, D3D12_RESOURCE_STATE_COPY_DEST, true);
-    {
-        hr = GetUploadBufferAndGrow(dataSize, alignment).Write(commandContext.GetCommandList(), dstBuffer.Get(), dstOffset, data, dataSize);
-    }
-    commandContext.TransitionResource(dstBuffer, dstBuffer.usageState, true);
-    return hr;
-}
-
 HRESULT D3D12StagingBufferPool::ReadSubresourceRegion(
     D3D12CommandContext&    commandContext,
     D3D12CommandQueue&      commandQueue,
@@ -132,7 +129,7 @@ void D3D12StagingBufferPool::ResizeBuffer(
     UINT64              size,
     UINT64              alignment)
 {
-    /* Check if global upload buffer must be resized */
+    /* Check if global readback buffer must be resized */
     UINT64 alignedSize = GetAlignedSize(size, alignment);
     if (!stagingBuffer.Capacity(alignedSize))
     {
@@ -142,12 +139,6 @@ void D3D12StagingBufferPool::ResizeBuffer(
     }
 }
 
-D3D12StagingBuffer& D3D12StagingBufferPool::GetUploadBufferAndGrow(UINT64 size, UINT64 alignment)
-{
-    ResizeBuffer(globalUploadBuffer_, D3D12_HEAP_TYPE_UPLOAD, size, alignment);
-    return globalUploadBuffer_;
-}
-
 D3D12StagingBuffer& D3D12StagingBufferPool::GetReadbackBufferAndGrow(UINT64 size, UINT64 alignment)
 {
     ResizeBuffer(globalReadbackBuffer_, D3D12_HEAP_TYPE_READBACK, size, alignment);
@@ -33,10 +33,13 @@ class D3D12StagingBufferPool
         // Initializes the device object and chunk size.
         void InitializeDevice(ID3D12Device* device, UINT64 chunkSize);
 
-        // Resets all chunks in the pool.
+        // Releases all overflow chunks in the pool. Only call this once the GPU has finished all commands that were recorded with this pool.
         void Reset();
 
-        // Writes the specified data to the destination buffer using the staging pool.
+        /*
+        Writes the specified data to the destination buffer using the upload ring buffer of the command context.
+        If the ring buffer has not enough free space left, the data is written into an overflow chunk of this pool that is released on the next Reset.
+        */
         HRESULT WriteStaged(
             D3D12CommandContext&    commandContext,
             D3D12Resource&          dstBuffer,
@@ -45,16 +48,6 @@ class D3D12StagingBufferPool
             UINT64                  dataSize
         );
 
-        // Writes the specified data to the destination buffer using the global upload buffer.
-        HRESULT WriteImmediate(
-            D3D12CommandContext&    commandContext,
-            D3D12Resource&          dstBuffer,
-            UINT64                  dstOffset,
-            const void*             data,
-            UINT64                  dataSize,
-            UINT64                  alignment   = 256u
-        );
-
         // Copies the specified subresource region into the global readback buffer and writes it into the output data.
         HRESULT ReadSubresourceRegion(
             D3D12CommandContext&    commandContext,
@@ -66,6 +59,11 @@ class D3D12StagingBufferPool
             UINT64                  alignment   = 256u
         );
 
+    public:
+
+        // Alignment of staged writes within the upload ring buffer.
+        static constexpr UINT64 uploadAlignment = 16u;
+
     private:
 
         // Allocates a new chunk with the specified minimal size.
@@ -79,18 +77,16 @@ class D3D12StagingBufferPool
             UINT64              alignment
         );
 
-        D3D12StagingBuffer& GetUploadBufferAndGrow(UINT64 size, UINT64 alignment);
         D3D12StagingBuffer& GetReadbackBufferAndGrow(UINT64 size, UINT64 alignment);
 
     private:
 
         ID3D12Device*                   device_             = nullptr;
 
-        std::vector<D3D12StagingBuffer> chunks_;
+        std::vector<D3D12StagingBuffer> chunks_;                // Overflow chunks for uploads that do not fit into the upload ring buffer.
         std::size_t                     chunkIdx_           = 0;
         UINT64                          chunkSize_          = 0;
 
-        D3D12StagingBuffer              globalUploadBuffer_;
         D3D12StagingBuffer              globalReadbackBuffer_;
 
 };
@@ -0,0 +1,108 @@
+/*
+ * D3D12UploadRingBuffer.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "D3D12UploadRingBuffer.h"
+#include "../../DXCommon/DXCore.h"
+#include "../../../Core/CoreUtils.h"
+#include "../D3DX12/d3dx12.h"
+
+
+namespace LLGL
+{
+
+
+void D3D12UploadRingBuffer::Create(ID3D12Device* device, UINT64 size)
+{
+    /* Align ring size to constant buffer placement to never split an aligned allocation at the wrap-around */
+    size = GetAlignedSize<UINT64>(size, D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT);
+
+    /* Create GPU upload heap */
+    const CD3DX12_HEAP_PROPERTIES heapProperties{ D3D12_HEAP_TYPE_UPLOAD };
+    const CD3DX12_RESOURCE_DESC bufferDesc = CD3DX12_RESOURCE_DESC::Buffer(size);
+    HRESULT hr = device->CreateCommittedResource(
+        &heapProperties,
+        D3D12_HEAP_FLAG_NONE,
+        &bufferDesc,
+        D3D12_RESOURCE_STATE_GENERIC_READ,
+        nullptr,
+        IID_PPV_ARGS(native_.ReleaseAndGetAddressOf())
+    );
+    DXThrowIfCreateFailed(hr, "ID3D12Resource", "for upload ring buffer");
+
+    /* Set name for debugging/diagnostics */
+    native_->SetName(L"LLGL::D3D12UploadRingBuffer");
+
+    /* Map upload heap persistently; the CPU never reads from it */
+    const D3D12_RANGE readRange{ 0, 0 };
+    hr = native_->Map(0, &readRange, reinterpret_cast<void**>(&mappedData_));
+    DXThrowIfFailed(hr, "failed to map D3D12 upload ring buffer");
+
+    gpuAddress_ = native_->GetGPUVirtualAddress();
+
+    /* Store new size and reset ring positions */
+    size_           = size;
+    head_           = 0;
+    tail_           = 0;
+    finishedHead_   = 0;
+    pendingRanges_.clear();
+}
+
+bool D3D12UploadRingBuffer::Alloc(UINT64 size, UINT64 alignment, D3D12UploadRegion& outRegion)
+{
+    if (size == 0 || size > size_)
+        return false;
+
+    /* Align physical offset and wrap around if the region does not fit into the remainder of the ring */
+    const UINT64    physicalHead    = head_ % size_;
+    UINT64          offset          = GetAlignedSize<UINT64>(physicalHead, alignment);
+    UINT64          start           = head_ + (offset - physicalHead);
+
+    if (offset + size > size_)
+    {
+        start   = head_ + (size_ - physicalHead);
+        offset  = 0;
+    }
+
+    /* Reject allocation if it would override regions that are still in flight */
+    const UINT64 end = start + size;
+    if (end - tail_ > size_)
+        return false;
+
+    head_ = end;
+
+    outRegion.resource      = native_.Get();
+    outRegion.offset        = offset;
+    outRegion.cpuAddress    = mappedData_ + offset;
+    outRegion.gpuAddress    = gpuAddress_ + offset;
+
+    return true;
+}
+
+void D3D12UploadRingBuffer::FinishAllocations(UINT64 fenceValue)
+{
+    if (finishedHead_ != head_)
+    {
+        pendingRanges_.push_back({ fenceValue, head_ });
+        finishedHead_ = head_;
+    }
+}
+
+void D3D12UploadRingBuffer::Reclaim(UINT64 completedFenceValue)
+{
+    /* Move tail behind all ranges that are no longer in flight */
+    auto it = pendingRanges_.begin();
+    for (; it != pendingRanges_.end() && it->fenceValue <= completedFenceValue; ++it)
+        tail_ = it->end;
+    pendingRanges_.erase(pendingRanges_.begin(), it);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,101 @@
+/*
+ * D3D12UploadRingBuffer.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_D3D12_UPLOAD_RING_BUFFER_H
+#define LLGL_D3D12_UPLOAD_RING_BUFFER_H
+
+
+#include "../../DXCommon/ComPtr.h"
+#include <d3d12.h>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+// Region of the upload ring buffer that was allocated for a single upload.
+struct D3D12UploadRegion
+{
+    ID3D12Resource*             resource        = nullptr;
+    UINT64                      offset          = 0;
+    char*                       cpuAddress      = nullptr;
+    D3D12_GPU_VIRTUAL_ADDRESS   gpuAddress      = 0;
+};
+
+/*
+Ring allocator over a single persistently mapped upload heap.
+Allocations are made in submission order and are reclaimed in the same order once the fence value they were tagged with has been signaled.
+Unlike D3D12StagingBuffer chunks, the heap never grows; requests that do not fit into the free space of the ring are rejected.
+*/
+class D3D12UploadRingBuffer
+{
+
+    public:
+
+        D3D12UploadRingBuffer() = default;
+
+        D3D12UploadRingBuffer(const D3D12UploadRingBuffer&) = delete;
+        D3D12UploadRingBuffer& operator = (const D3D12UploadRingBuffer&) = delete;
+
+        // Creates the native D3D upload heap and maps it persistently.
+        void Create(ID3D12Device* device, UINT64 size);
+
+        // Allocates a region of the specified size. Returns false if the ring has not enough free space left.
+        bool Alloc(UINT64 size, UINT64 alignment, D3D12UploadRegion& outRegion);
+
+        // Tags all allocations since the previous call with the specified fence value. They are reclaimed once this value has been signaled.
+        void FinishAllocations(UINT64 fenceValue);
+
+        // Reclaims all allocations whose fence values are less than or equal to the specified completed fence value.
+        void Reclaim(UINT64 completedFenceValue);
+
+        // Returns the native D3D resource.
+        inline ID3D12Resource* GetNative() const
+        {
+            return native_.Get();
+        }
+
+        // Returns the size of the native D3D buffer.
+        inline UINT64 GetSize() const
+        {
+            return size_;
+        }
+
+    private:
+
+        struct PendingRange
+        {
+            UINT64 fenceValue;
+            UINT64 end;
+        };
+
+    private:
+
+        ComPtr<ID3D12Resource>      native_;
+        char*                       mappedData_     = nullptr;
+        D3D12_GPU_VIRTUAL_ADDRESS   gpuAddress_     = 0;
+        UINT64                      size_           = 0;
+
+        /* Monotonic positions; the physical offset is the position modulo the ring size */
+        UINT64                      head_           = 0;
+        UINT64                      tail_           = 0;
+        UINT64                      finishedHead_   = 0;
+
+        std::vector<PendingRange>   pendingRanges_; // Allocations that are still in flight, in submission order.
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
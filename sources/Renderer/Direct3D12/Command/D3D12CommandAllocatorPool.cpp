@@ -0,0 +1,74 @@
+/*
+ * D3D12CommandAllocatorPool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "D3D12CommandAllocatorPool.h"
+#include "../../DXCommon/DXCore.h"
+
+
+namespace LLGL
+{
+
+
+ComPtr<ID3D12CommandAllocator> D3D12CommandAllocatorPool::AcquireAllocator(ID3D12Device* device, D3D12_COMMAND_LIST_TYPE type)
+{
+    ComPtr<ID3D12CommandAllocator> allocator;
+
+    /* Find the oldest pooled allocator of the same type whose commands have finished on the GPU */
+    {
+        std::lock_guard<std::mutex> guard{ mutex_ };
+        for (auto it = allocators_.begin(); it != allocators_.end(); ++it)
+        {
+            if (it->type == type && (it->fence == nullptr || it->fence->GetCompletedValue() >= it->fenceValue))
+            {
+                allocator = std::move(it->native);
+                allocators_.erase(it);
+                break;
+            }
+        }
+    }
+
+    if (allocator)
+    {
+        /* Reclaim memory of the recycled allocator outside the lock, since other threads might acquire allocators concurrently */
+        HRESULT hr = allocator->Reset();
+        DXThrowIfFailed(hr, "failed to reset D3D12 command allocator");
+    }
+    else
+    {
+        /* Create new allocator, since all pooled allocators of this type are still in flight */
+        HRESULT hr = device->CreateCommandAllocator(type, IID_PPV_ARGS(allocator.ReleaseAndGetAddressOf()));
+        DXThrowIfCreateFailed(hr, "ID3D12CommandAllocator");
+    }
+
+    return allocator;
+}
+
+void D3D12CommandAllocatorPool::ReleaseAllocator(
+    ComPtr<ID3D12CommandAllocator>&&    allocator,
+    D3D12_COMMAND_LIST_TYPE             type,
+    ID3D12Fence*                        fence,
+    UINT64                              fenceValue)
+{
+    if (allocator)
+    {
+        std::lock_guard<std::mutex> guard{ mutex_ };
+        allocators_.push_back(PooledAllocator{ std::move(allocator), type, fence, fenceValue });
+    }
+}
+
+void D3D12CommandAllocatorPool::Clear()
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    allocators_.clear();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
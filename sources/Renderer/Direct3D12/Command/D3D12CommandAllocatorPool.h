@@ -0,0 +1,79 @@
+/*
+ * D3D12CommandAllocatorPool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_D3D12_COMMAND_ALLOCATOR_POOL_H
+#define LLGL_D3D12_COMMAND_ALLOCATOR_POOL_H
+
+
+#include "../../DXCommon/ComPtr.h"
+#include <d3d12.h>
+#include <vector>
+#include <mutex>
+
+
+namespace LLGL
+{
+
+
+/*
+Thread-safe pool of command allocators that is shared between all command buffers of a render system.
+Command contexts return their allocator when they switch to the next one and acquire a recycled allocator,
+so allocators are only created when all pooled allocators of the same type are still in flight.
+*/
+class D3D12CommandAllocatorPool
+{
+
+    public:
+
+        D3D12CommandAllocatorPool() = default;
+
+        D3D12CommandAllocatorPool(const D3D12CommandAllocatorPool&) = delete;
+        D3D12CommandAllocatorPool& operator = (const D3D12CommandAllocatorPool&) = delete;
+
+        // Returns a command allocator of the specified type that has been reset, or creates a new one if all pooled allocators are still in flight.
+        ComPtr<ID3D12CommandAllocator> AcquireAllocator(ID3D12Device* device, D3D12_COMMAND_LIST_TYPE type);
+
+        /*
+        Returns the specified command allocator to this pool. It is recycled once 'fence' has been signaled with 'fenceValue'.
+        If 'fence' is null, the allocator is recycled with the next acquisition, i.e. its commands were never submitted.
+        */
+        void ReleaseAllocator(
+            ComPtr<ID3D12CommandAllocator>&&    allocator,
+            D3D12_COMMAND_LIST_TYPE             type,
+            ID3D12Fence*                        fence,
+            UINT64                              fenceValue
+        );
+
+        // Releases all pooled command allocators.
+        void Clear();
+
+    private:
+
+        struct PooledAllocator
+        {
+            ComPtr<ID3D12CommandAllocator>  native;
+            D3D12_COMMAND_LIST_TYPE         type;
+            ComPtr<ID3D12Fence>             fence;      // Keeps the fence alive after its command context has been destroyed.
+            UINT64                          fenceValue;
+        };
+
+    private:
+
+        std::mutex                      mutex_;
+        std::vector<PooledAllocator>    allocators_;    // Returned allocators, in the order they were released.
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
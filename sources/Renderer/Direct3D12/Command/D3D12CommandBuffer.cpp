@@ -20,10 +20,12 @@
 #include "../Buffer/D3D12Buffer.h"
 #include "../Buffer/D3D12BufferArray.h"
 #include "../Buffer/D3D12BufferConstantsPool.h"
+#include "../Buffer/D3D12AccelerationStructure.h"
 
 #include "../Texture/D3D12Texture.h"
 #include "../Texture/D3D12RenderTarget.h"
 #include "../Texture/D3D12MipGenerator.h"
+#include "../Texture/D3D12TextureBlitter.h"
 
 #include "../RenderState/D3D12ResourceHeap.h"
 #include "../RenderState/D3D12RenderPass.h"
@@ -36,6 +38,7 @@
 #include <LLGL/Backend/Direct3D12/NativeHandle.h>
 
 #include "../D3DX12/d3dx12.h"
+#include "../../../Core/ProfileZone.h"
 #include <pix.h>
 
 #include <algorithm>
@@ -46,10 +49,20 @@ namespace LLGL
 {
 
 
+static D3D12CommandQueue* GetD3DCommandQueue(D3D12RenderSystem& renderSystem, const CommandBufferDescriptor& desc)
+{
+    if (desc.commandQueue != nullptr)
+        return LLGL_CAST(D3D12CommandQueue*, desc.commandQueue);
+    else
+        return LLGL_CAST(D3D12CommandQueue*, renderSystem.GetCommandQueue());
+}
+
 D3D12CommandBuffer::D3D12CommandBuffer(D3D12RenderSystem& renderSystem, const CommandBufferDescriptor& desc) :
     cmdSignatureFactory_ { &(renderSystem.GetSignatureFactory())                         },
     immediateSubmit_     { ((desc.flags & CommandBufferFlags::ImmediateSubmit) != 0)     },
-    commandQueue_        { LLGL_CAST(D3D12CommandQueue*, renderSystem.GetCommandQueue()) }
+    isBundle_            { ((desc.flags & CommandBufferFlags::Secondary) != 0)           },
+    explicitBarriers_    { ((desc.flags & CommandBufferFlags::ExplicitBarriers) != 0)    },
+    commandQueue_        { GetD3DCommandQueue(renderSystem, desc)                         }
 {
     CreateCommandContext(renderSystem, desc);
     if (desc.debugName != nullptr)
@@ -95,6 +108,8 @@ void D3D12CommandBuffer::Execute(CommandBuffer& deferredCommandBuffer)
     */
     commandContext_.SetDescriptorHeapsOfOtherContext(cmdBufferD3D.commandContext_);
 
+    commandContext_.TrackExecutedBundle(cmdBufferD3D.commandContext_);
+    commandContext_.FlushResourceBarrieres();
     commandList_->ExecuteBundle(cmdBufferD3D.GetNative());
 }
 
@@ -104,7 +119,7 @@ void D3D12CommandBuffer::UpdateBuffer(
     Buffer&         dstBuffer,
     std::uint64_t   dstOffset,
     const void*     data,
-    std::uint16_t   dataSize)
+    std::uint64_t   dataSize)
 {
     auto& dstBufferD3D = LLGL_CAST(D3D12Buffer&, dstBuffer);
     commandContext_.UpdateSubresource(dstBufferD3D.GetResource(), dstOffset, data, dataSize);
@@ -126,7 +141,29 @@ void D3D12CommandBuffer::CopyBuffer(
         commandList_->CopyBufferRegion(dstBufferD3D.GetNative(), dstOffset, srcBufferD3D.GetNative(), srcOffset, size);
     }
     commandContext_.TransitionResource(dstBufferD3D.GetResource(), dstBufferD3D.GetResource().usageState);
-    commandContext_.TransitionResource(srcBufferD3D.GetResource(), srcBufferD3D.GetResource().usageState, true);
+    commandContext_.TransitionResource(srcBufferD3D.GetResource(), srcBufferD3D.GetResource().usageState);
+}
+
+void D3D12CommandBuffer::CopyBuffer(
+    Buffer&                                 dstBuffer,
+    Buffer&                                 srcBuffer,
+    const ArrayView<BufferCopyRegion>&      regions)
+{
+    if (regions.empty())
+        return;
+
+    auto& dstBufferD3D = LLGL_CAST(D3D12Buffer&, dstBuffer);
+    auto& srcBufferD3D = LLGL_CAST(D3D12Buffer&, srcBuffer);
+
+    /* Transition both buffers only once for all regions */
+    commandContext_.TransitionResource(dstBufferD3D.GetResource(), D3D12_RESOURCE_STATE_COPY_DEST);
+    commandContext_.TransitionResource(srcBufferD3D.GetResource(), D3D12_RESOURCE_STATE_COPY_SOURCE, true);
+    {
+        for (const BufferCopyRegion& region : regions)
+            commandList_->CopyBufferRegion(dstBufferD3D.GetNative(), region.dstOffset, srcBufferD3D.GetNative(), region.srcOffset, region.size);
+    }
+    commandContext_.TransitionResource(dstBufferD3D.GetResource(), dstBufferD3D.GetResource().usageState);
+    commandContext_.TransitionResource(srcBufferD3D.GetResource(), srcBufferD3D.GetResource().usageState);
 }
 
 void D3D12CommandBuffer::CopyBufferFromTexture(
@@ -190,7 +227,7 @@ void D3D12CommandBuffer::CopyBufferFromTexture(
                 }
             }
 
-            commandContext_.TransitionResource(alignedBuffer, D3D12_RESOURCE_STATE_GENERIC_READ, D3D12_RESOURCE_STATE_COPY_SOURCE, true);
+            commandContext_.TransitionResource(alignedBuffer, D3D12_RESOURCE_STATE_GENERIC_READ, D3D12_RESOURCE_STATE_COPY_SOURCE);
         }
         else
         {
@@ -207,7 +244,7 @@ void D3D12CommandBuffer::CopyBufferFromTexture(
         }
     }
     commandContext_.TransitionResource(dstBufferD3D.GetResource(), dstBufferD3D.GetResource().usageState);
-    commandContext_.TransitionResource(srcTextureD3D.GetResource(), srcTextureD3D.GetResource().usageState, true);
+    commandContext_.TransitionResource(srcTextureD3D.GetResource(), srcTextureD3D.GetResource().usageState);
 }
 
 void D3D12CommandBuffer::FillBuffer(
@@ -247,6 +284,7 @@ void D3D12CommandBuffer::CopyTexture(
 
     const D3D12_BOX srcBox = srcTextureD3D.CalcRegion(srcLocation.offset, extent);
 
+    dstTextureD3D.ActivateTransient(commandContext_);
     commandContext_.TransitionResource(dstTextureD3D.GetResource(), D3D12_RESOURCE_STATE_COPY_DEST);
     commandContext_.TransitionResource(srcTextureD3D.GetResource(), D3D12_RESOURCE_STATE_COPY_SOURCE, true);
     {
@@ -260,7 +298,44 @@ void D3D12CommandBuffer::CopyTexture(
         );
     }
     commandContext_.TransitionResource(dstTextureD3D.GetResource(), dstTextureD3D.GetResource().usageState);
-    commandContext_.TransitionResource(srcTextureD3D.GetResource(), srcTextureD3D.GetResource().usageState, true);
+    commandContext_.TransitionResource(srcTextureD3D.GetResource(), srcTextureD3D.GetResource().usageState);
+}
+
+void D3D12CommandBuffer::CopyTexture(
+    Texture&                                dstTexture,
+    Texture&                                srcTexture,
+    const ArrayView<TextureCopyRegion>&     regions)
+{
+    if (regions.empty())
+        return;
+
+    auto& dstTextureD3D = LLGL_CAST(D3D12Texture&, dstTexture);
+    auto& srcTextureD3D = LLGL_CAST(D3D12Texture&, srcTexture);
+
+    /* Transition both textures only once for all regions */
+    dstTextureD3D.ActivateTransient(commandContext_);
+    commandContext_.TransitionResource(dstTextureD3D.GetResource(), D3D12_RESOURCE_STATE_COPY_DEST);
+    commandContext_.TransitionResource(srcTextureD3D.GetResource(), D3D12_RESOURCE_STATE_COPY_SOURCE, true);
+    {
+        for (const TextureCopyRegion& region : regions)
+        {
+            const D3D12_TEXTURE_COPY_LOCATION dstLocationD3D = dstTextureD3D.CalcCopyLocation(region.dstLocation);
+            const D3D12_TEXTURE_COPY_LOCATION srcLocationD3D = srcTextureD3D.CalcCopyLocation(region.srcLocation);
+
+            const D3D12_BOX srcBox = srcTextureD3D.CalcRegion(region.srcLocation.offset, region.extent);
+
+            commandList_->CopyTextureRegion(
+                &dstLocationD3D,                                    // pDst
+                static_cast<UINT>(region.dstLocation.offset.x),     // DstX
+                static_cast<UINT>(region.dstLocation.offset.y),     // DstY
+                static_cast<UINT>(region.dstLocation.offset.z),     // DstZ
+                &srcLocationD3D,                                    // pSrc
+                &srcBox                                             // pSrcBox
+            );
+        }
+    }
+    commandContext_.TransitionResource(dstTextureD3D.GetResource(), dstTextureD3D.GetResource().usageState);
+    commandContext_.TransitionResource(srcTextureD3D.GetResource(), srcTextureD3D.GetResource().usageState);
 }
 
 void D3D12CommandBuffer::CopyTextureFromBuffer(
@@ -288,6 +363,7 @@ void D3D12CommandBuffer::CopyTextureFromBuffer(
     const D3D12_TEXTURE_COPY_LOCATION   dstLocationD3D  = dstTextureD3D.CalcCopyLocation(dstLocation);
     const D3D12_BOX                     srcBox          = dstTextureD3D.CalcRegion(Offset3D{}, dstExtent);
 
+    dstTextureD3D.ActivateTransient(commandContext_);
     commandContext_.TransitionResource(dstTextureD3D.GetResource(), D3D12_RESOURCE_STATE_COPY_DEST);
     commandContext_.TransitionResource(srcBufferD3D.GetResource(), D3D12_RESOURCE_STATE_COPY_SOURCE, true);
     {
@@ -324,7 +400,7 @@ void D3D12CommandBuffer::CopyTextureFromBuffer(
                 &srcBox                                 // pSrcBox
             );
 
-            commandContext_.TransitionResource(alignedBuffer, D3D12_RESOURCE_STATE_GENERIC_READ, D3D12_RESOURCE_STATE_COPY_SOURCE, true);
+            commandContext_.TransitionResource(alignedBuffer, D3D12_RESOURCE_STATE_GENERIC_READ, D3D12_RESOURCE_STATE_COPY_SOURCE);
         }
         else
         {
@@ -341,7 +417,17 @@ void D3D12CommandBuffer::CopyTextureFromBuffer(
         }
     }
     commandContext_.TransitionResource(dstTextureD3D.GetResource(), dstTextureD3D.GetResource().usageState);
-    commandContext_.TransitionResource(srcBufferD3D.GetResource(), srcBufferD3D.GetResource().usageState, true);
+    commandContext_.TransitionResource(srcBufferD3D.GetResource(), srcBufferD3D.GetResource().usageState);
+}
+
+void D3D12CommandBuffer::CopyTextureFromBuffer(
+    Texture&                                    dstTexture,
+    Buffer&                                     srcBuffer,
+    const ArrayView<BufferTextureCopyRegion>&   regions)
+{
+    /* Each region may require its own intermediate buffer for unaligned row strides */
+    for (const BufferTextureCopyRegion& region : regions)
+        CopyTextureFromBuffer(dstTexture, region.textureRegion, srcBuffer, region.bufferOffset, region.rowStride, region.layerStride);
 }
 
 void D3D12CommandBuffer::CopyTextureFromFramebuffer(
@@ -383,6 +469,22 @@ void D3D12CommandBuffer::CopyTextureFromFramebuffer(
     #endif
 }
 
+void D3D12CommandBuffer::BlitTexture(
+    Texture&                dstTexture,
+    const TextureRegion&    dstRegion,
+    Texture&                srcTexture,
+    const TextureRegion&    srcRegion,
+    const SamplerFilter     filter)
+{
+    auto& dstTextureD3D = LLGL_CAST(D3D12Texture&, dstTexture);
+    auto& srcTextureD3D = LLGL_CAST(D3D12Texture&, srcTexture);
+    D3D12TextureBlitter::Get().BlitTexture(commandContext_, dstTextureD3D, dstRegion, srcTextureD3D, srcRegion, filter);
+
+    /* Builtin compute shader overrides the bound pipeline state and root signature */
+    boundPipelineLayout_    = nullptr;
+    boundPipelineState_     = nullptr;
+}
+
 void D3D12CommandBuffer::GenerateMips(Texture& texture)
 {
     auto& textureD3D = LLGL_CAST(D3D12Texture&, texture);
@@ -414,22 +516,31 @@ static constexpr bool IsCompatibleToD3DViewport()
 
 void D3D12CommandBuffer::SetViewport(const Viewport& viewport)
 {
+    /* Bundles inherit viewports and scissors from the calling command list and must not set them */
+    if (isBundle_)
+        return;
     SetAndConvertViewports(1, &viewport);
 }
 
 void D3D12CommandBuffer::SetViewports(std::uint32_t numViewports, const Viewport* viewports)
 {
+    if (isBundle_)
+        return;
     numViewports = std::min(numViewports, std::uint32_t(D3D12_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE));
     SetAndConvertViewports(numViewports, viewports);
 }
 
 void D3D12CommandBuffer::SetScissor(const Scissor& scissor)
 {
+    if (isBundle_)
+        return;
     SetAndConvertScissorRects(1, &scissor);
 }
 
 void D3D12CommandBuffer::SetScissors(std::uint32_t numScissors, const Scissor* scissors)
 {
+    if (isBundle_)
+        return;
     numScissors = std::min(numScissors, std::uint32_t(D3D12_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE));
     SetAndConvertScissorRects(numScissors, scissors);
 }
@@ -518,10 +629,20 @@ void D3D12CommandBuffer::ClearAttachments(std::uint32_t numAttachments, const At
 
 /* ----- Buffers ------ */
 
-void D3D12CommandBuffer::SetVertexBuffer(Buffer& buffer)
+void D3D12CommandBuffer::SetVertexBuffer(Buffer& buffer, std::uint64_t offset)
 {
     auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
-    commandList_->IASetVertexBuffers(0, 1, &(bufferD3D.GetVertexBufferView()));
+    if (offset != 0)
+    {
+        /* Move start of the view and shrink it by the buffer offset */
+        D3D12_VERTEX_BUFFER_VIEW view = bufferD3D.GetVertexBufferView();
+        const UINT viewOffset = static_cast<UINT>(std::min<std::uint64_t>(offset, view.SizeInBytes));
+        view.BufferLocation += viewOffset;
+        view.SizeInBytes    -= viewOffset;
+        commandList_->IASetVertexBuffers(0, 1, &view);
+    }
+    else
+        commandList_->IASetVertexBuffers(0, 1, &(bufferD3D.GetVertexBufferView()));
 }
 
 void D3D12CommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
@@ -534,6 +655,28 @@ void D3D12CommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
     );
 }
 
+void D3D12CommandBuffer::SetVertexBuffers(std::uint32_t firstSlot, std::uint32_t numBuffers, Buffer* const * buffers, const std::uint64_t* offsets)
+{
+    SmallVector<D3D12_VERTEX_BUFFER_VIEW> vertexBufferViews;
+    vertexBufferViews.resize(numBuffers);
+
+    for_range(i, numBuffers)
+    {
+        auto* bufferD3D = LLGL_CAST(D3D12Buffer*, buffers[i]);
+        D3D12_VERTEX_BUFFER_VIEW& view = vertexBufferViews[i];
+        view = bufferD3D->GetVertexBufferView();
+        if (offsets != nullptr)
+        {
+            /* Move start of the view and shrink it by the buffer offset */
+            const UINT offset = static_cast<UINT>(std::min<std::uint64_t>(offsets[i], view.SizeInBytes));
+            view.BufferLocation += offset;
+            view.SizeInBytes    -= offset;
+        }
+    }
+
+    commandList_->IASetVertexBuffers(firstSlot, numBuffers, vertexBufferViews.data());
+}
+
 void D3D12CommandBuffer::SetIndexBuffer(Buffer& buffer)
 {
     auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
@@ -586,8 +729,9 @@ void D3D12CommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap, std::uint32
         }
     }
 
-    /* Insert resource barriers for the specified descriptor set */
-    resourceHeapD3D.InsertResourceBarriers(commandList_, descriptorSet);
+    /* Insert resource barriers for the specified descriptor set unless the client inserts them explicitly */
+    if (!explicitBarriers_)
+        resourceHeapD3D.InsertResourceBarriers(commandContext_, descriptorSet);
 }
 
 /*
@@ -613,24 +757,26 @@ void D3D12CommandBuffer::SetResource(std::uint32_t descriptor, Resource& resourc
     if (!(descriptor < boundPipelineLayout_->GetNumBindings()))
         return /*E_INVALIDARG*/;
 
-    const D3D12DescriptorLocation& rootParameterLocation = boundPipelineLayout_->GetRootParameterMap()[descriptor];
-    if (rootParameterLocation.type != D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE)
-    {
-        D3D12_GPU_VIRTUAL_ADDRESS gpuVirtualAddr = GetD3DResourceGPUAddr(resource);
-        if (gpuVirtualAddr != 0)
-        {
-            /* Root parameter can only be raw or structured buffers, so only handle CBV, SRV, and UAV */
-            if (boundPipelineState_ != nullptr && boundPipelineState_->IsGraphicsPSO())
-                commandContext_.SetGraphicsRootParameter(rootParameterLocation.index, rootParameterLocation.type, gpuVirtualAddr);
-            else
-                commandContext_.SetComputeRootParameter(rootParameterLocation.index, rootParameterLocation.type, gpuVirtualAddr);
-        }
-    }
-    else
+    const bool isGraphicsPSO = (boundPipelineState_ != nullptr && boundPipelineState_->IsGraphicsPSO());
+    SetResourceWithBoundLayout(descriptor, resource, isGraphicsPSO);
+}
+
+void D3D12CommandBuffer::SetResources(std::uint32_t firstDescriptor, const ArrayView<Resource*>& resources)
+{
+    if (boundPipelineLayout_ == nullptr)
+        return /*E_POINTER*/;
+
+    const std::uint32_t numBindings = boundPipelineLayout_->GetNumBindings();
+    if (!(firstDescriptor < numBindings))
+        return /*E_INVALIDARG*/;
+
+    const std::uint32_t numDescriptors  = std::min<std::uint32_t>(static_cast<std::uint32_t>(resources.size()), numBindings - firstDescriptor);
+    const bool          isGraphicsPSO   = (boundPipelineState_ != nullptr && boundPipelineState_->IsGraphicsPSO());
+
+    for_range(i, numDescriptors)
     {
-        /* Bind resource with staging descriptor heap */
-        const D3D12DescriptorHeapLocation& descriptorLocation = boundPipelineLayout_->GetDescriptorMap()[descriptor];
-        commandContext_.EmplaceDescriptorForStaging(resource, descriptorLocation.index, descriptorLocation.type);
+        if (Resource* resource = resources[i])
+            SetResourceWithBoundLayout(firstDescriptor + i, *resource, isGraphicsPSO);
     }
 }
 
@@ -646,6 +792,83 @@ void D3D12CommandBuffer::ResetResourceSlots(
     commandList_->SOSetTargets(0, 1, nullViews);
 }
 
+// Returns the resource state for the specified barrier usage (see BindFlags). Write usages take precedence over read usages.
+static D3D12_RESOURCE_STATES GetD3DBarrierState(long usage, long stageFlags)
+{
+    if ((usage & BindFlags::Storage) != 0)
+        return D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
+    if ((usage & BindFlags::ColorAttachment) != 0)
+        return D3D12_RESOURCE_STATE_RENDER_TARGET;
+    if ((usage & BindFlags::DepthStencilAttachment) != 0)
+        return D3D12_RESOURCE_STATE_DEPTH_WRITE;
+    if ((usage & BindFlags::StreamOutputBuffer) != 0)
+        return D3D12_RESOURCE_STATE_STREAM_OUT;
+    if ((usage & BindFlags::CopyDst) != 0)
+        return D3D12_RESOURCE_STATE_COPY_DEST;
+
+    D3D12_RESOURCE_STATES state = D3D12_RESOURCE_STATE_COMMON;
+
+    if ((usage & (BindFlags::VertexBuffer | BindFlags::ConstantBuffer)) != 0)
+        state |= D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER;
+    if ((usage & BindFlags::IndexBuffer) != 0)
+        state |= D3D12_RESOURCE_STATE_INDEX_BUFFER;
+    if ((usage & BindFlags::IndirectBuffer) != 0)
+        state |= D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT;
+    if ((usage & BindFlags::CopySrc) != 0)
+        state |= D3D12_RESOURCE_STATE_COPY_SOURCE;
+    if ((usage & BindFlags::Sampled) != 0)
+    {
+        if ((stageFlags & StageFlags::FragmentStage) != 0)
+            state |= D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE;
+        if ((stageFlags & ~StageFlags::FragmentStage) != 0)
+            state |= D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE;
+    }
+
+    return state;
+}
+
+static D3D12Resource* GetD3DBarrierResource(Resource* resource)
+{
+    if (resource != nullptr)
+    {
+        switch (resource->GetResourceType())
+        {
+            case ResourceType::Buffer:
+                return &(LLGL_CAST(D3D12Buffer*, resource)->GetResource());
+            case ResourceType::Texture:
+                return &(LLGL_CAST(D3D12Texture*, resource)->GetResource());
+            default:
+                break;
+        }
+    }
+    return nullptr;
+}
+
+void D3D12CommandBuffer::ResourceBarrier(std::uint32_t numBarriers, const ResourceBarrierDescriptor* barriers)
+{
+    for_range(i, numBarriers)
+    {
+        const ResourceBarrierDescriptor& barrier = barriers[i];
+        if (D3D12Resource* resource = GetD3DBarrierResource(barrier.resource))
+        {
+            /* Transition resource into the new state or synchronize UAV accesses if the state remains the same */
+            const D3D12_RESOURCE_STATES newState = GetD3DBarrierState(barrier.dstUsage, barrier.dstStages);
+            if (resource->currentState != newState || resource->splitPending)
+                commandContext_.TransitionResource(*resource, newState);
+            else if ((barrier.srcUsage & BindFlags::Storage) != 0)
+                commandContext_.InsertUAVBarrier(*resource);
+        }
+        else if ((barrier.srcUsage & BindFlags::Storage) != 0)
+        {
+            /* Synchronize all UAV accesses for global barriers */
+            commandContext_.InsertUAVBarrier(static_cast<ID3D12Resource*>(nullptr));
+        }
+    }
+
+    /* Submit all barriers at once */
+    commandContext_.FlushResourceBarrieres();
+}
+
 /* ----- Render Passes ----- */
 
 void D3D12CommandBuffer::BeginRenderPass(
@@ -655,6 +878,8 @@ void D3D12CommandBuffer::BeginRenderPass(
     const ClearValue*   clearValues,
     std::uint32_t       swapBufferIndex)
 {
+    LLGL_PROFILE_ZONE("BeginRenderPass");
+
     if (LLGL::IsInstanceOf<SwapChain>(renderTarget))
     {
         /* Bind swap chain */
@@ -689,16 +914,21 @@ void D3D12CommandBuffer::EndRenderPass()
         boundRenderTarget_->ResolveSubresources(commandContext_);
 }
 
+void D3D12CommandBuffer::NextSubpass()
+{
+    // dummy
+}
+
 /* ----- Pipeline States ----- */
 
 void D3D12CommandBuffer::SetPipelineState(PipelineState& pipelineState)
 {
-    /* Bind pipeline state to command context */
-    auto& pipelineStateD3D = LLGL_CAST(D3D12PipelineState&, pipelineState);
+    /* Bind pipeline state to command context, or its placeholder if it's still being compiled */
+    auto& pipelineStateD3D = LLGL_CAST(D3D12PipelineState&, pipelineState).GetReadyPSO();
     if (pipelineStateD3D.IsGraphicsPSO())
     {
         /* Bind graphics PSO */
-        auto& graphicsPSO = LLGL_CAST(D3D12GraphicsPSO&, pipelineState);
+        auto& graphicsPSO = LLGL_CAST(D3D12GraphicsPSO&, pipelineStateD3D);
         graphicsPSO.Bind(commandContext_);
         boundPipelineState_ = &graphicsPSO;
 
@@ -718,7 +948,7 @@ void D3D12CommandBuffer::SetPipelineState(PipelineState& pipelineState)
     else
     {
         /* Bind compute PSO */
-        auto& computePSO = LLGL_CAST(D3D12ComputePSO&, pipelineState);
+        auto& computePSO = LLGL_CAST(D3D12ComputePSO&, pipelineStateD3D);
         computePSO.Bind(commandContext_);
         boundPipelineState_ = &computePSO;
     }
@@ -746,6 +976,39 @@ void D3D12CommandBuffer::SetStencilReference(std::uint32_t reference, const Sten
     commandList_->OMSetStencilRef(reference);
 }
 
+void D3D12CommandBuffer::SetShadingRate(const ShadingRate rate)
+{
+    if (commandList5_.Get() == nullptr)
+        return;
+
+    /* Clamp coarse pixels larger than 2x2 if the device does not support the additional shading rates */
+    D3D12_SHADING_RATE rateD3D = D3D12Types::Map(rate);
+    if (!additionalShadingRates_ && (rate == ShadingRate::Rate2x4 || rate == ShadingRate::Rate4x2 || rate == ShadingRate::Rate4x4))
+        rateD3D = D3D12_SHADING_RATE_2X2;
+
+    commandList5_->RSSetShadingRate(rateD3D, nullptr);
+}
+
+void D3D12CommandBuffer::SetCullMode(const CullMode /*cullMode*/)
+{
+    // not supported by this backend
+}
+
+void D3D12CommandBuffer::SetDepthState(const DepthDescriptor& /*depthDesc*/)
+{
+    // not supported by this backend
+}
+
+void D3D12CommandBuffer::SetStencilState(const StencilDescriptor& /*stencilDesc*/)
+{
+    // not supported by this backend
+}
+
+void D3D12CommandBuffer::SetPrimitiveTopology(const PrimitiveTopology /*topology*/)
+{
+    // not supported by this backend
+}
+
 void D3D12CommandBuffer::SetUniforms(std::uint32_t first, const void* data, std::uint16_t dataSize)
 {
     /* Data size must be a multiple of 4 bytes */
@@ -818,11 +1081,31 @@ void D3D12CommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::uint32_
     );
 }
 
+void D3D12CommandBuffer::BeginRenderCondition(Buffer& buffer, std::uint64_t offset, const RenderConditionMode mode)
+{
+    /* Indirect argument buffers are already in D3D12_RESOURCE_STATE_PREDICATION, since it aliases D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT */
+    auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
+    commandList_->SetPredication(bufferD3D.GetNative(), offset, GetDXPredicateOp(mode));
+}
+
 void D3D12CommandBuffer::EndRenderCondition()
 {
     commandList_->SetPredication(nullptr, 0, D3D12_PREDICATION_OP_EQUAL_ZERO);
 }
 
+void D3D12CommandBuffer::ResolveQueries(QueryHeap& queryHeap, std::uint32_t firstQuery, std::uint32_t numQueries, Buffer& dstBuffer, std::uint64_t dstOffset)
+{
+    auto& queryHeapD3D = LLGL_CAST(D3D12QueryHeap&, queryHeap);
+    auto& dstBufferD3D = LLGL_CAST(D3D12Buffer&, dstBuffer);
+
+    D3D12Resource& dstResource = dstBufferD3D.GetResource();
+    commandContext_.TransitionResource(dstResource, D3D12_RESOURCE_STATE_COPY_DEST, true);
+    {
+        queryHeapD3D.ResolveToResource(commandList_, firstQuery, numQueries, dstResource.Get(), dstOffset);
+    }
+    commandContext_.TransitionResource(dstResource, dstResource.usageState);
+}
+
 /* ----- Stream Output ------ */
 
 void D3D12CommandBuffer::BeginStreamOutput(std::uint32_t numBuffers, Buffer* const * buffers)
@@ -873,7 +1156,6 @@ void D3D12CommandBuffer::EndStreamOutput()
     /* Transition resources back to their common usage */
     for_range(i, numSOBuffers_)
         commandContext_.TransitionResource(boundSOBuffers_[i]->GetResource(), boundSOBuffers_[i]->GetResource().usageState);
-    commandContext_.FlushResourceBarrieres();
 }
 
 /* ----- Drawing ----- */
@@ -926,21 +1208,34 @@ void D3D12CommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
 
 void D3D12CommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
+    /* Encode a single multi-draw command; custom strides are served by a cached command signature */
     auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
-    if likely(stride == sizeof(D3D12_DRAW_ARGUMENTS))
-    {
-        /* Encode indirect draw with pre-defined command stride */
-        commandContext_.DrawIndirect(cmdSignatureFactory_->GetSignatureDrawIndirect(), numCommands, bufferD3D.GetNative(), offset);
-    }
-    else
-    {
-        /* Encode indirect draw individually with custom stride */
-        while (numCommands-- > 0)
-        {
-            commandContext_.DrawIndirect(cmdSignatureFactory_->GetSignatureDrawIndirect(), 1, bufferD3D.GetNative(), offset);
-            offset += stride;
-        }
-    }
+    commandContext_.DrawIndirect(
+        cmdSignatureFactory_->GetOrCreateSignature(D3D12_INDIRECT_ARGUMENT_TYPE_DRAW, stride),
+        numCommands,
+        bufferD3D.GetNative(),
+        offset
+    );
+}
+
+void D3D12CommandBuffer::DrawIndirect(
+    Buffer&         buffer,
+    std::uint64_t   offset,
+    Buffer&         countBuffer,
+    std::uint64_t   countBufferOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    auto& bufferD3D         = LLGL_CAST(D3D12Buffer&, buffer);
+    auto& countBufferD3D    = LLGL_CAST(D3D12Buffer&, countBuffer);
+    commandContext_.DrawIndirect(
+        cmdSignatureFactory_->GetOrCreateSignature(D3D12_INDIRECT_ARGUMENT_TYPE_DRAW, stride),
+        maxNumCommands,
+        bufferD3D.GetNative(),
+        offset,
+        countBufferD3D.GetNative(),
+        countBufferOffset
+    );
 }
 
 void D3D12CommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
@@ -952,35 +1247,160 @@ void D3D12CommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offse
 }
 
 void D3D12CommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    /* Encode a single multi-draw command; custom strides are served by a cached command signature */
+    auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
+    commandContext_.DrawIndirect(
+        cmdSignatureFactory_->GetOrCreateSignature(D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED, stride),
+        numCommands,
+        bufferD3D.GetNative(),
+        offset
+    );
+}
+
+void D3D12CommandBuffer::DrawIndexedIndirect(
+    Buffer&         buffer,
+    std::uint64_t   offset,
+    Buffer&         countBuffer,
+    std::uint64_t   countBufferOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    auto& bufferD3D         = LLGL_CAST(D3D12Buffer&, buffer);
+    auto& countBufferD3D    = LLGL_CAST(D3D12Buffer&, countBuffer);
+    commandContext_.DrawIndirect(
+        cmdSignatureFactory_->GetOrCreateSignature(D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED, stride),
+        maxNumCommands,
+        bufferD3D.GetNative(),
+        offset,
+        countBufferD3D.GetNative(),
+        countBufferOffset
+    );
+}
+
+void D3D12CommandBuffer::DrawStreamOutput()
+{
+    // not supported by this backend
+}
+
+void D3D12CommandBuffer::DrawMesh(std::uint32_t /*numWorkGroupsX*/, std::uint32_t /*numWorkGroupsY*/, std::uint32_t /*numWorkGroupsZ*/)
+{
+    // not supported by this backend
+}
+
+void D3D12CommandBuffer::DrawMeshIndirect(Buffer& /*buffer*/, std::uint64_t /*offset*/, std::uint32_t /*numCommands*/, std::uint32_t /*stride*/)
+{
+    // not supported by this backend
+}
+
+/* ----- Compute ----- */
+
+void D3D12CommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
+{
+    commandContext_.Dispatch(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
+}
+
+void D3D12CommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
 {
     auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
-    if likely(stride == sizeof(D3D12_DRAW_INDEXED_ARGUMENTS))
+    commandContext_.DispatchIndirect(cmdSignatureFactory_->GetSignatureDispatchIndirect(), 1, bufferD3D.GetNative(), offset);
+}
+
+/* ----- Ray Tracing ----- */
+
+// Transitions the resource of the specified buffer into the new state, or back into its usage state if 'newState' is null.
+static void TransitionAccelerationStructureInput(D3D12CommandContext& commandContext, Buffer* buffer, const D3D12_RESOURCE_STATES* newState)
+{
+    if (buffer != nullptr)
     {
-        /* Encode indirect draw with pre-defined command stride */
-        commandContext_.DrawIndirect(cmdSignatureFactory_->GetSignatureDrawIndexedIndirect(), numCommands, bufferD3D.GetNative(), offset);
+        D3D12Resource& resource = LLGL_CAST(D3D12Buffer*, buffer)->GetResource();
+        commandContext.TransitionResource(resource, (newState != nullptr ? *newState : resource.usageState));
     }
+}
+
+// Transitions all buffers that are read or written by an acceleration structure build, or back into their usage states if 'restoreUsage' is true.
+static void TransitionAccelerationStructureInputs(D3D12CommandContext& commandContext, const AccelerationStructureBuildDescriptor& buildDesc, bool restoreUsage)
+{
+    /* Geometry and instance data must be readable by non-pixel shaders and scratch memory must be in unordered access state */
+    const D3D12_RESOURCE_STATES inputState      = D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE;
+    const D3D12_RESOURCE_STATES scratchState    = D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
+
+    if (buildDesc.type == AccelerationStructureType::TopLevel)
+        TransitionAccelerationStructureInput(commandContext, buildDesc.instanceBuffer, (restoreUsage ? nullptr : &inputState));
     else
     {
-        /* Encode indirect draw individually with custom stride */
-        while (numCommands-- > 0)
+        for (const AccelerationStructureTriangles& triangles : buildDesc.triangles)
         {
-            commandContext_.DrawIndirect(cmdSignatureFactory_->GetSignatureDrawIndexedIndirect(), 1, bufferD3D.GetNative(), offset);
-            offset += stride;
+            TransitionAccelerationStructureInput(commandContext, triangles.vertexBuffer, (restoreUsage ? nullptr : &inputState));
+            TransitionAccelerationStructureInput(commandContext, triangles.indexBuffer, (restoreUsage ? nullptr : &inputState));
         }
     }
+    TransitionAccelerationStructureInput(commandContext, buildDesc.scratchBuffer, (restoreUsage ? nullptr : &scratchState));
 }
 
-/* ----- Compute ----- */
+void D3D12CommandBuffer::BuildAccelerationStructure(const AccelerationStructureBuildDescriptor& buildDesc)
+{
+    if (commandList4_.Get() == nullptr)
+        return;
 
-void D3D12CommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
+    D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_DESC nativeDesc;
+    std::vector<D3D12_RAYTRACING_GEOMETRY_DESC> geometryDescs;
+    {
+        D3D12ConvertAccelerationStructureInputs(nativeDesc.Inputs, geometryDescs, buildDesc, (buildDesc.src != nullptr));
+        nativeDesc.DestAccelerationStructureData    = D3D12GetBufferGPUAddress(buildDesc.dst);
+        nativeDesc.SourceAccelerationStructureData  = D3D12GetBufferGPUAddress(buildDesc.src);
+        nativeDesc.ScratchAccelerationStructureData = D3D12GetBufferGPUAddress(buildDesc.scratchBuffer, buildDesc.scratchOffset);
+    }
+
+    TransitionAccelerationStructureInputs(commandContext_, buildDesc, false);
+    commandContext_.FlushResourceBarrieres();
+
+    commandList4_->BuildRaytracingAccelerationStructure(&nativeDesc, 0, nullptr);
+
+    /* Subsequent builds and ray queries must not read the acceleration structure before it has been written */
+    commandContext_.InsertUAVBarrier(LLGL_CAST(D3D12Buffer*, buildDesc.dst)->GetNative());
+    TransitionAccelerationStructureInputs(commandContext_, buildDesc, true);
+}
+
+void D3D12CommandBuffer::CopyAccelerationStructure(Buffer& dst, Buffer& src, const AccelerationStructureCopyMode mode)
 {
-    commandContext_.Dispatch(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
+    if (commandList4_.Get() == nullptr)
+        return;
+
+    auto& dstBufferD3D = LLGL_CAST(D3D12Buffer&, dst);
+    auto& srcBufferD3D = LLGL_CAST(D3D12Buffer&, src);
+
+    commandContext_.FlushResourceBarrieres();
+
+    commandList4_->CopyRaytracingAccelerationStructure(
+        dstBufferD3D.GetNative()->GetGPUVirtualAddress(),
+        srcBufferD3D.GetNative()->GetGPUVirtualAddress(),
+        (mode == AccelerationStructureCopyMode::Compact ? D3D12_RAYTRACING_ACCELERATION_STRUCTURE_COPY_MODE_COMPACT : D3D12_RAYTRACING_ACCELERATION_STRUCTURE_COPY_MODE_CLONE)
+    );
+
+    commandContext_.InsertUAVBarrier(dstBufferD3D.GetNative());
 }
 
-void D3D12CommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
+void D3D12CommandBuffer::WriteAccelerationStructureCompactedSize(Buffer& src, Buffer& dstBuffer, std::uint64_t dstOffset)
 {
-    auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
-    commandContext_.DispatchIndirect(cmdSignatureFactory_->GetSignatureDispatchIndirect(), 1, bufferD3D.GetNative(), offset);
+    if (commandList4_.Get() == nullptr)
+        return;
+
+    auto& srcBufferD3D = LLGL_CAST(D3D12Buffer&, src);
+    auto& dstBufferD3D = LLGL_CAST(D3D12Buffer&, dstBuffer);
+
+    /* Post-build information is written with unordered access */
+    commandContext_.TransitionResource(dstBufferD3D.GetResource(), D3D12_RESOURCE_STATE_UNORDERED_ACCESS, true);
+
+    D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_DESC postbuildInfoDesc;
+    {
+        postbuildInfoDesc.DestBuffer    = dstBufferD3D.GetNative()->GetGPUVirtualAddress() + dstOffset;
+        postbuildInfoDesc.InfoType      = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_COMPACTED_SIZE;
+    }
+    const D3D12_GPU_VIRTUAL_ADDRESS srcAddress = srcBufferD3D.GetNative()->GetGPUVirtualAddress();
+    commandList4_->EmitRaytracingAccelerationStructurePostbuildInfo(&postbuildInfoDesc, 1, &srcAddress);
+
+    commandContext_.TransitionResource(dstBufferD3D.GetResource(), dstBufferD3D.GetResource().usageState);
 }
 
 /* ----- Debugging ----- */
@@ -1019,22 +1439,42 @@ bool D3D12CommandBuffer::GetNativeHandle(void* nativeHandle, std::size_t nativeH
  * ======= Private: =======
  */
 
-static D3D12_COMMAND_LIST_TYPE GetD3DCommandListType(const CommandBufferDescriptor& desc)
+static D3D12_COMMAND_LIST_TYPE GetD3DCommandListType(const CommandBufferDescriptor& desc, const D3D12CommandQueue& commandQueue)
 {
     if ((desc.flags & CommandBufferFlags::Secondary) != 0)
         return D3D12_COMMAND_LIST_TYPE_BUNDLE;
     else
-        return D3D12_COMMAND_LIST_TYPE_DIRECT;
+        return commandQueue.GetType();
 }
 
 void D3D12CommandBuffer::CreateCommandContext(D3D12RenderSystem& renderSystem, const CommandBufferDescriptor& desc)
 {
     auto& device = renderSystem.GetDevice();
 
-    /* Create command context and store reference to command list */
-    commandContext_.Create(device, GetD3DCommandListType(desc), desc.numNativeBuffers, desc.minStagingPoolSize, true);
+    /* Create command context and store reference to command list; bundles share the bindless heaps, since they must match the heaps of the calling command list */
+    commandContext_.Create(
+        device,
+        GetD3DCommandListType(desc, *commandQueue_),
+        desc.numNativeBuffers,
+        desc.minStagingPoolSize,
+        true,
+        renderSystem.GetBindlessDescriptorHeaps(),
+        &(renderSystem.GetCommandAllocatorPool())
+    );
     commandList_ = commandContext_.GetCommandList();
 
+    /* Query extended command list interface for ray tracing commands; this fails on older runtimes */
+    commandList_->QueryInterface(IID_PPV_ARGS(commandList4_.ReleaseAndGetAddressOf()));
+
+    /* Query extended command list interface for variable rate shading only if the device supports at least tier 1 */
+    D3D12_FEATURE_DATA_D3D12_OPTIONS6 options6 = {};
+    if (SUCCEEDED(device.GetNative()->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS6, &options6, sizeof(options6))) &&
+        options6.VariableShadingRateTier != D3D12_VARIABLE_SHADING_RATE_TIER_NOT_SUPPORTED)
+    {
+        commandList_->QueryInterface(IID_PPV_ARGS(commandList5_.ReleaseAndGetAddressOf()));
+        additionalShadingRates_ = (options6.AdditionalShadingRatesSupported != FALSE);
+    }
+
     /* Store increment size for descriptor heaps */
     rtvDescSize_ = device.GetNative()->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_RTV);
     dsvDescSize_ = device.GetNative()->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_DSV);
@@ -1115,6 +1555,8 @@ static_assert(
 
 void D3D12CommandBuffer::SetDefaultScissorRects(UINT numScissorRects)
 {
+    if (isBundle_)
+        return;
     numScissorRects = std::min(numScissorRects, UINT(D3D12_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE));
     if (numScissorRects > numDefaultScissorRects_)
     {
@@ -1269,6 +1711,33 @@ void D3D12CommandBuffer::ClearDepthStencilView(
     commandList_->ClearDepthStencilView(dsvDescHandle_, clearFlags, depth, stencil, numRects, rects);
 }
 
+void D3D12CommandBuffer::SetResourceWithBoundLayout(std::uint32_t descriptor, Resource& resource, bool isGraphicsPSO)
+{
+    const D3D12DescriptorLocation& rootParameterLocation = boundPipelineLayout_->GetRootParameterMap()[descriptor];
+    if (rootParameterLocation.type != D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE)
+    {
+        D3D12_GPU_VIRTUAL_ADDRESS gpuVirtualAddr = GetD3DResourceGPUAddr(resource);
+        if (gpuVirtualAddr != 0)
+        {
+            /* Root parameter can only be raw or structured buffers, so only handle CBV, SRV, and UAV */
+            if (isGraphicsPSO)
+                commandContext_.SetGraphicsRootParameter(rootParameterLocation.index, rootParameterLocation.type, gpuVirtualAddr);
+            else
+                commandContext_.SetComputeRootParameter(rootParameterLocation.index, rootParameterLocation.type, gpuVirtualAddr);
+        }
+    }
+    else
+    {
+        /* Make transient textures occupy their heap memory before they are accessed */
+        if (resource.GetResourceType() == ResourceType::Texture)
+            LLGL_CAST(D3D12Texture&, resource).ActivateTransient(commandContext_);
+
+        /* Bind resource with staging descriptor heap */
+        const D3D12DescriptorHeapLocation& descriptorLocation = boundPipelineLayout_->GetDescriptorMap()[descriptor];
+        commandContext_.EmplaceDescriptorForStaging(resource, descriptorLocation.index, descriptorLocation.type);
+    }
+}
+
 void D3D12CommandBuffer::ResetBindingStates()
 {
     numDefaultScissorRects_ = 0;
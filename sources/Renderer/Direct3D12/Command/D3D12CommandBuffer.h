@@ -107,6 +107,9 @@ class D3D12CommandBuffer final : public CommandBuffer
             const D3D12_RECT*   rects
         );
 
+        // Binds the specified resource to the bound pipeline layout. The descriptor must be in range.
+        void SetResourceWithBoundLayout(std::uint32_t descriptor, Resource& resource, bool isGraphicsPSO);
+
         void ResetBindingStates();
 
     private:
@@ -114,9 +117,14 @@ class D3D12CommandBuffer final : public CommandBuffer
         D3D12CommandContext             commandContext_;
         D3D12CommandQueue*              commandQueue_                               = nullptr;
         ID3D12GraphicsCommandList*      commandList_                                = nullptr;
+        ComPtr<ID3D12GraphicsCommandList4> commandList4_;                                           // Only available on runtimes with ray tracing support.
+        ComPtr<ID3D12GraphicsCommandList5> commandList5_;                                           // Only available on devices with variable rate shading support.
         const D3D12SignatureFactory*    cmdSignatureFactory_                        = nullptr;
 
         bool                            immediateSubmit_                            = false;
+        bool                            isBundle_                                   = false;
+        bool                            explicitBarriers_                           = false;
+        bool                            additionalShadingRates_                     = false;
 
         D3D12_CPU_DESCRIPTOR_HANDLE     rtvDescHandle_                              = {};
         UINT                            rtvDescSize_                                = 0;
@@ -37,15 +37,35 @@ D3D12CommandContext::D3D12CommandContext(D3D12Device& device)
     Create(device);
 }
 
+D3D12CommandContext::~D3D12CommandContext()
+{
+    if (allocatorPool_ != nullptr)
+    {
+        for_range(i, numAllocators_)
+        {
+            allocatorPool_->ReleaseAllocator(
+                std::move(commandAllocators_[i]),
+                commandListType_,
+                (allocatorSignaled_[i] ? allocatorFence_.Get() : nullptr),
+                allocatorFenceValues_[i]
+            );
+        }
+    }
+}
+
 void D3D12CommandContext::Create(
-    D3D12Device&            device,
-    D3D12_COMMAND_LIST_TYPE commandListType,
-    UINT                    numAllocators,
-    UINT64                  initialStagingChunkSize,
-    bool                    initialClose)
+    D3D12Device&                    device,
+    D3D12_COMMAND_LIST_TYPE         commandListType,
+    UINT                            numAllocators,
+    UINT64                          initialStagingChunkSize,
+    bool                            initialClose,
+    D3D12BindlessDescriptorHeap*    bindlessHeaps,
+    D3D12CommandAllocatorPool*      allocatorPool)
 {
     /* Store reference to device and command queue */
-    device_ = device.GetNative();
+    device_             = device.GetNative();
+    allocatorPool_      = allocatorPool;
+    commandListType_    = commandListType;
 
     /* Create fence for command allocators */
     allocatorFence_.Create(device.GetNative());
@@ -57,11 +77,17 @@ void D3D12CommandContext::Create(
     constexpr UINT64 minStagingChunkSize = 256;
     initialStagingChunkSize = std::max(minStagingChunkSize, initialStagingChunkSize);
 
+    /* Create upload ring buffer large enough to hold the staging chunks of all command allocators in flight */
+    uploadRingBuffer_.Create(device.GetNative(), initialStagingChunkSize * numAllocators_);
+
     for_range(i, numAllocators_)
     {
-        commandAllocators_[i] = device.CreateDXCommandAllocator(commandListType);
+        if (allocatorPool_ != nullptr)
+            commandAllocators_[i] = allocatorPool_->AcquireAllocator(device.GetNative(), commandListType);
+        else
+            commandAllocators_[i] = device.CreateDXCommandAllocator(commandListType);
         for_range(j, D3D12CommandContext::maxNumDescriptorHeaps)
-            stagingDescriptorPools_[i][j].InitializeDevice(device.GetNative(), g_descriptorHeapTypes[j]);
+            stagingDescriptorPools_[i][j].InitializeDevice(device.GetNative(), g_descriptorHeapTypes[j], (bindlessHeaps != nullptr ? &bindlessHeaps[j] : nullptr));
         descriptorCaches_[i].Create(device.GetNative());
         stagingBufferPools_[i].InitializeDevice(device.GetNative(), initialStagingChunkSize);
         intermediateBufferPools_[i].InitializeDevice(device.GetNative());
@@ -79,7 +105,9 @@ void D3D12CommandContext::Create(
 
 void D3D12CommandContext::Close()
 {
-    /* Flush pending resource barriers */
+    /* End all split barriers that are still pending and flush pending resource barriers */
+    while (!splitResources_.empty())
+        EndSplitTransition(*splitResources_.back());
     FlushResourceBarrieres();
 
     /* Close native command list */
@@ -101,7 +129,18 @@ void D3D12CommandContext::ExecuteAndSignal(D3D12CommandQueue& commandQueue)
 
 void D3D12CommandContext::Signal(D3D12CommandQueue& commandQueue)
 {
+    /*
+    Increment the fence value if the current command list is submitted more than once,
+    so its allocator is only recycled after the last submission has finished
+    */
+    if (allocatorSignaled_[currentAllocatorIndex_])
+        ++allocatorFenceValues_[currentAllocatorIndex_];
     commandQueue.SignalFence(allocatorFence_.Get(), allocatorFenceValues_[currentAllocatorIndex_]);
+    allocatorSignaled_[currentAllocatorIndex_] = true;
+
+    /* Signal all bundles that are executed by this command list */
+    for (D3D12CommandContext* bundleContext : executedBundles_)
+        bundleContext->Signal(commandQueue);
 }
 
 void D3D12CommandContext::Reset()
@@ -113,10 +152,19 @@ void D3D12CommandContext::Reset()
     HRESULT hr = commandList_->Reset(GetCommandAllocator(), nullptr);
     DXThrowIfFailed(hr, "failed to reset D3D12 graphics command list");
 
+    /* Bundles of the previous encoding are no longer referenced */
+    executedBundles_.clear();
+
     /* Invalidate state cache */
     ClearCache();
 }
 
+void D3D12CommandContext::TrackExecutedBundle(D3D12CommandContext& bundleContext)
+{
+    if (std::find(executedBundles_.begin(), executedBundles_.end(), &bundleContext) == executedBundles_.end())
+        executedBundles_.push_back(&bundleContext);
+}
+
 void D3D12CommandContext::FinishAndSync(D3D12CommandQueue& commandQueue)
 {
     /* Close command list and execute, then reset command allocator for next encoding */
@@ -130,15 +178,8 @@ void D3D12CommandContext::FinishAndSync(D3D12CommandQueue& commandQueue)
 
 void D3D12CommandContext::TransitionResource(ID3D12Resource* resource, D3D12_RESOURCE_STATES newState, D3D12_RESOURCE_STATES oldState, bool flushImmediate)
 {
-    D3D12_RESOURCE_BARRIER& barrier = NextResourceBarrier();
-
-    /* Initialize resource barrier for resource transition */
-    barrier.Type                    = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
-    barrier.Flags                   = D3D12_RESOURCE_BARRIER_FLAG_NONE;
-    barrier.Transition.pResource    = resource;
-    barrier.Transition.Subresource  = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
-    barrier.Transition.StateBefore  = oldState;
-    barrier.Transition.StateAfter   = newState;
+    if (!MergeTransitionBarrier(resource, newState))
+        AppendTransitionBarrier(resource, oldState, newState);
 
     /* Flush resource barrieres if required */
     if (flushImmediate)
@@ -147,17 +188,14 @@ void D3D12CommandContext::TransitionResource(ID3D12Resource* resource, D3D12_RES
 
 void D3D12CommandContext::TransitionResource(D3D12Resource& resource, D3D12_RESOURCE_STATES newState, bool flushImmediate)
 {
+    /* Complete a previously started split barrier first; this already leaves the resource in its split target state */
+    if (resource.splitPending)
+        EndSplitTransition(resource);
+
     if (resource.currentState != newState)
     {
-        D3D12_RESOURCE_BARRIER& barrier = NextResourceBarrier();
-
-        /* Initialize resource barrier for resource transition */
-        barrier.Type                    = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
-        barrier.Flags                   = D3D12_RESOURCE_BARRIER_FLAG_NONE;
-        barrier.Transition.pResource    = resource.Get();
-        barrier.Transition.Subresource  = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
-        barrier.Transition.StateBefore  = resource.currentState;
-        barrier.Transition.StateAfter   = newState;
+        if (!MergeTransitionBarrier(resource.Get(), newState))
+            AppendTransitionBarrier(resource.Get(), resource.currentState, newState);
 
         /* Store new transition state */
         resource.currentState = newState;
@@ -168,18 +206,59 @@ void D3D12CommandContext::TransitionResource(D3D12Resource& resource, D3D12_RESO
         FlushResourceBarrieres();
 }
 
+void D3D12CommandContext::BeginTransitionResource(D3D12Resource& resource, D3D12_RESOURCE_STATES newState)
+{
+    if (resource.splitPending)
+        EndSplitTransition(resource);
+
+    if (resource.currentState != newState)
+    {
+        AppendTransitionBarrier(resource.Get(), resource.currentState, newState, D3D12_RESOURCE_BARRIER_FLAG_BEGIN_ONLY);
+
+        /* Store new transition state and keep track of the pending split barrier */
+        resource.splitState     = resource.currentState;
+        resource.currentState   = newState;
+        resource.splitPending   = true;
+        splitResources_.push_back(&resource);
+    }
+}
+
 void D3D12CommandContext::InsertUAVBarrier(D3D12Resource& resource, bool flushImmediate)
+{
+    InsertUAVBarrier(resource.native.Get(), flushImmediate);
+}
+
+void D3D12CommandContext::InsertUAVBarrier(ID3D12Resource* resource, bool flushImmediate)
 {
     D3D12_RESOURCE_BARRIER& barrier = NextResourceBarrier();
 
     barrier.Type            = D3D12_RESOURCE_BARRIER_TYPE_UAV;
     barrier.Flags           = D3D12_RESOURCE_BARRIER_FLAG_NONE;
-    barrier.UAV.pResource   = resource.native.Get();
+    barrier.UAV.pResource   = resource;
+
+    if (flushImmediate)
+        FlushResourceBarrieres();
+}
+
+void D3D12CommandContext::InsertAliasingBarrier(ID3D12Resource* resourceBefore, ID3D12Resource* resourceAfter, bool flushImmediate)
+{
+    D3D12_RESOURCE_BARRIER& barrier = NextResourceBarrier();
+
+    barrier.Type                        = D3D12_RESOURCE_BARRIER_TYPE_ALIASING;
+    barrier.Flags                       = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+    barrier.Aliasing.pResourceBefore    = resourceBefore;
+    barrier.Aliasing.pResourceAfter     = resourceAfter;
 
     if (flushImmediate)
         FlushResourceBarrieres();
 }
 
+void D3D12CommandContext::InsertResourceBarriers(UINT numBarriers, const D3D12_RESOURCE_BARRIER* barriers)
+{
+    for_range(i, numBarriers)
+        NextResourceBarrier() = barriers[i];
+}
+
 void D3D12CommandContext::FlushResourceBarrieres()
 {
     if (numResourceBarriers_ > 0)
@@ -212,9 +291,9 @@ void D3D12CommandContext::ResolveSubresource(
         format
     );
 
-    /* Transition both resources */
+    /* Transition both resources back; the barriers are flushed with the next command */
     TransitionResource(dstResource, dstResourceOldState);
-    TransitionResource(srcResource, srcResourceOldState, true);
+    TransitionResource(srcResource, srcResourceOldState);
 }
 
 void D3D12CommandContext::CopyTextureRegion(
@@ -249,9 +328,9 @@ void D3D12CommandContext::CopyTextureRegion(
     }
     commandList_->CopyTextureRegion(&dstLocation, dstX, dstY, dstZ, &srcLocation, srcBox);
 
-    /* Transition both resources */
+    /* Transition both resources back; the barriers are flushed with the next command */
     TransitionResource(dstResource, dstResourceOldState);
-    TransitionResource(srcResource, srcResourceOldState, true);
+    TransitionResource(srcResource, srcResourceOldState);
 }
 
 void D3D12CommandContext::UpdateSubresource(
@@ -268,6 +347,16 @@ ID3D12Resource* D3D12CommandContext::AllocIntermediateBuffer(UINT64 size, UINT a
     return intermediateBufferPools_[currentAllocatorIndex_].AllocBuffer(size, alignment);
 }
 
+bool D3D12CommandContext::AllocUploadRegion(UINT64 size, UINT64 alignment, D3D12UploadRegion& outRegion)
+{
+    if (uploadRingBuffer_.Alloc(size, alignment, outRegion))
+        return true;
+
+    /* Reclaim regions of command allocators that have completed in the meantime and try again */
+    uploadRingBuffer_.Reclaim(allocatorFence_.GetCompletedValue());
+    return uploadRingBuffer_.Alloc(size, alignment, outRegion);
+}
+
 void D3D12CommandContext::SetGraphicsRootSignature(ID3D12RootSignature* rootSignature)
 {
     if (stateCache_.dirtyBits.graphicsRootSignature != 0 || stateCache_.graphicsRootSignature != rootSignature)
@@ -342,6 +431,16 @@ void D3D12CommandContext::SetDescriptorHeapsOfOtherContext(const D3D12CommandCon
         SetDescriptorHeaps(other.stateCache_.numDescriptorHeaps, other.stateCache_.descriptorHeaps);
 }
 
+void D3D12CommandContext::SetStagingDescriptorHeaps()
+{
+    ID3D12DescriptorHeap* const stagingDescriptorHeaps[2] =
+    {
+        stagingDescriptorPools_[currentAllocatorIndex_][0].GetDescriptorHeap(),
+        stagingDescriptorPools_[currentAllocatorIndex_][1].GetDescriptorHeap()
+    };
+    SetDescriptorHeaps(2, stagingDescriptorHeaps);
+}
+
 void D3D12CommandContext::PrepareStagingDescriptorHeaps(
     const D3D12DescriptorHeapSetLayout& layout,
     const D3D12RootParameterIndices&    indices)
@@ -350,12 +449,7 @@ void D3D12CommandContext::PrepareStagingDescriptorHeaps(
     stagingDescriptorIndices_   = indices;
 
     /* Bind shader-visible descriptor heaps */
-    ID3D12DescriptorHeap* const stagingDescriptorHeaps[2] =
-    {
-        stagingDescriptorPools_[currentAllocatorIndex_][0].GetDescriptorHeap(),
-        stagingDescriptorPools_[currentAllocatorIndex_][1].GetDescriptorHeap()
-    };
-    SetDescriptorHeaps(2, stagingDescriptorHeaps);
+    SetStagingDescriptorHeaps();
 
     /* Reset descriptor cache for dynamic descriptors */
     descriptorCaches_[currentAllocatorIndex_].Reset(
@@ -458,6 +552,7 @@ void D3D12CommandContext::DrawInstanced(
 {
     FlushDeferredPipelineState();
     FlushGraphicsStagingDescriptorTables();
+    FlushResourceBarrieres();
     commandList_->DrawInstanced(vertexCountPerInstance, instanceCount, startVertexLocation, startInstanceLocation);
 }
 
@@ -470,6 +565,7 @@ void D3D12CommandContext::DrawIndexedInstanced(
 {
     FlushDeferredPipelineState();
     FlushGraphicsStagingDescriptorTables();
+    FlushResourceBarrieres();
     commandList_->DrawIndexedInstanced(indexCountPerInstance, instanceCount, startIndexLocation, baseVertexLocation, startInstanceLocation);
 }
 
@@ -483,6 +579,7 @@ void D3D12CommandContext::DrawIndirect(
 {
     FlushDeferredPipelineState();
     FlushGraphicsStagingDescriptorTables();
+    FlushResourceBarrieres();
     commandList_->ExecuteIndirect(commandSignature, maxCommandCount, argumentBuffer, argumentBufferOffset, countBuffer, countBufferOffset);
 }
 
@@ -492,6 +589,7 @@ void D3D12CommandContext::Dispatch(
     UINT threadGroupCountZ)
 {
     FlushComputeStagingDescriptorTables();
+    FlushResourceBarrieres();
     commandList_->Dispatch(threadGroupCountX, threadGroupCountY, threadGroupCountZ);
 }
 
@@ -504,6 +602,7 @@ void D3D12CommandContext::DispatchIndirect(
     UINT64                  countBufferOffset)
 {
     FlushComputeStagingDescriptorTables();
+    FlushResourceBarrieres();
     commandList_->ExecuteIndirect(commandSignature, maxCommandCount, argumentBuffer, argumentBufferOffset, countBuffer, countBufferOffset);
 }
 
@@ -532,19 +631,144 @@ D3D12_RESOURCE_BARRIER& D3D12CommandContext::NextResourceBarrier()
     return resourceBarriers_[numResourceBarriers_++];
 }
 
+void D3D12CommandContext::AppendTransitionBarrier(
+    ID3D12Resource*                 resource,
+    D3D12_RESOURCE_STATES           oldState,
+    D3D12_RESOURCE_STATES           newState,
+    D3D12_RESOURCE_BARRIER_FLAGS    flags)
+{
+    D3D12_RESOURCE_BARRIER& barrier = NextResourceBarrier();
+
+    /* Initialize resource barrier for resource transition */
+    barrier.Type                    = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+    barrier.Flags                   = flags;
+    barrier.Transition.pResource    = resource;
+    barrier.Transition.Subresource  = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+    barrier.Transition.StateBefore  = oldState;
+    barrier.Transition.StateAfter   = newState;
+}
+
+bool D3D12CommandContext::MergeTransitionBarrier(ID3D12Resource* resource, D3D12_RESOURCE_STATES newState)
+{
+    /* Find the most recent pending barrier for the specified resource */
+    for (UINT i = numResourceBarriers_; i-- > 0;)
+    {
+        D3D12_RESOURCE_BARRIER& barrier = resourceBarriers_[i];
+        switch (barrier.Type)
+        {
+            case D3D12_RESOURCE_BARRIER_TYPE_TRANSITION:
+            {
+                if (barrier.Transition.pResource != resource)
+                    continue;
+
+                /* Split barriers and transitions of individual subresources cannot be merged */
+                if (barrier.Flags != D3D12_RESOURCE_BARRIER_FLAG_NONE || barrier.Transition.Subresource != D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES)
+                    return false;
+
+                if (barrier.Transition.StateBefore == newState)
+                    RemoveResourceBarrier(i);
+                else
+                    barrier.Transition.StateAfter = newState;
+                return true;
+            }
+
+            case D3D12_RESOURCE_BARRIER_TYPE_UAV:
+            {
+                /* Never move a transition across a UAV barrier of the same resource */
+                if (barrier.UAV.pResource == nullptr || barrier.UAV.pResource == resource)
+                    return false;
+            }
+            break;
+
+            default:
+            {
+                /* Never move a transition across an aliasing barrier */
+                return false;
+            }
+        }
+    }
+    return false;
+}
+
+void D3D12CommandContext::RemoveResourceBarrier(UINT index)
+{
+    LLGL_ASSERT(index < numResourceBarriers_);
+    std::move(resourceBarriers_ + index + 1, resourceBarriers_ + numResourceBarriers_, resourceBarriers_ + index);
+    --numResourceBarriers_;
+}
+
+void D3D12CommandContext::EndSplitTransition(D3D12Resource& resource)
+{
+    /* If the begin barrier has not been flushed yet, there is no work to overlap with, so turn it into a regular transition */
+    bool hasPendingBegin = false;
+    for_range(i, numResourceBarriers_)
+    {
+        D3D12_RESOURCE_BARRIER& barrier = resourceBarriers_[i];
+        if (barrier.Type == D3D12_RESOURCE_BARRIER_TYPE_TRANSITION &&
+            barrier.Transition.pResource == resource.Get() &&
+            barrier.Flags == D3D12_RESOURCE_BARRIER_FLAG_BEGIN_ONLY)
+        {
+            barrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+            hasPendingBegin = true;
+            break;
+        }
+    }
+
+    if (!hasPendingBegin)
+        AppendTransitionBarrier(resource.Get(), resource.splitState, resource.currentState, D3D12_RESOURCE_BARRIER_FLAG_END_ONLY);
+
+    resource.splitPending = false;
+
+    auto it = std::find(splitResources_.begin(), splitResources_.end(), &resource);
+    if (it != splitResources_.end())
+        splitResources_.erase(it);
+}
+
 void D3D12CommandContext::NextCommandAllocator()
 {
     /* Get next command allocator */
     const UINT64 currentFenceValue = allocatorFenceValues_[currentAllocatorIndex_];
+    uploadRingBuffer_.FinishAllocations(currentFenceValue);
+
+    /*
+    Return current allocator to the shared pool; it is recycled by any context once its fence value has been signaled.
+    An allocator that has never been signaled will not be submitted anymore, since its command list is about to be re-encoded.
+    */
+    if (allocatorPool_ != nullptr)
+    {
+        allocatorPool_->ReleaseAllocator(
+            std::move(commandAllocators_[currentAllocatorIndex_]),
+            commandListType_,
+            (allocatorSignaled_[currentAllocatorIndex_] ? allocatorFence_.Get() : nullptr),
+            currentFenceValue
+        );
+    }
+
     currentAllocatorIndex_ = ((currentAllocatorIndex_ + 1) % numAllocators_);
 
-    /* Wait until fence value of next allocator has been signaled */
-    allocatorFence_.WaitForHigherSignal(allocatorFenceValues_[currentAllocatorIndex_]);
+    /*
+    Wait until fence value of next allocator has been signaled, since its staging resources are re-used.
+    Skip this if it was never signaled, e.g. for a bundle that has been re-encoded without being executed.
+    */
+    if (allocatorSignaled_[currentAllocatorIndex_])
+        allocatorFence_.WaitForHigherSignal(allocatorFenceValues_[currentAllocatorIndex_]);
     allocatorFenceValues_[currentAllocatorIndex_] = currentFenceValue + 1;
+    allocatorSignaled_[currentAllocatorIndex_] = false;
+
+    if (allocatorPool_ != nullptr)
+    {
+        /* Acquire a recycled allocator from the shared pool; it has already been reset */
+        commandAllocators_[currentAllocatorIndex_] = allocatorPool_->AcquireAllocator(device_, commandListType_);
+    }
+    else
+    {
+        /* Reclaim memory allocated by command allocator using <ID3D12CommandAllocator::Reset> */
+        HRESULT hr = GetCommandAllocator()->Reset();
+        DXThrowIfFailed(hr, "failed to reset D3D12 command allocator");
+    }
 
-    /* Reclaim memory allocated by command allocator using <ID3D12CommandAllocator::Reset> */
-    HRESULT hr = GetCommandAllocator()->Reset();
-    DXThrowIfFailed(hr, "failed to reset D3D12 command allocator");
+    /* Reclaim upload ring buffer regions of all command allocators that have completed */
+    uploadRingBuffer_.Reclaim(allocatorFence_.GetCompletedValue());
 
     /* Reset descriptor heap pools before they are re-used */
     for_range(i, D3D12CommandContext::maxNumDescriptorHeaps)
@@ -16,9 +16,12 @@
 #include "../RenderState/D3D12DescriptorCache.h"
 #include "../Buffer/D3D12StagingBufferPool.h"
 #include "../Buffer/D3D12IntermediateBufferPool.h"
+#include "../Buffer/D3D12UploadRingBuffer.h"
+#include "D3D12CommandAllocatorPool.h"
 #include <d3d12.h>
 #include <cstddef>
 #include <cstdint>
+#include <vector>
 
 
 namespace LLGL
@@ -52,13 +55,25 @@ class D3D12CommandContext
 
         D3D12CommandContext(D3D12Device& device);
 
-        // Creats the command list and internal command allocators.
+        // Returns the command allocators to the shared pool, if one was specified on creation.
+        ~D3D12CommandContext();
+
+        D3D12CommandContext(const D3D12CommandContext&) = delete;
+        D3D12CommandContext& operator = (const D3D12CommandContext&) = delete;
+
+        /*
+        Creats the command list and internal command allocators.
+        If 'bindlessHeaps' is non-null, it must point to the CBV/SRV/UAV and sampler heaps (in that order) the staging descriptors are allocated from.
+        If 'allocatorPool' is non-null, command allocators are recycled through this pool instead of being owned by this context exclusively.
+        */
         void Create(
-            D3D12Device&            device,
-            D3D12_COMMAND_LIST_TYPE commandListType         = D3D12_COMMAND_LIST_TYPE_DIRECT,
-            UINT                    numAllocators           = ~0u,
-            UINT64                  initialStagingChunkSize = (0xFFFF + 1),
-            bool                    initialClose            = false
+            D3D12Device&                    device,
+            D3D12_COMMAND_LIST_TYPE         commandListType         = D3D12_COMMAND_LIST_TYPE_DIRECT,
+            UINT                            numAllocators           = ~0u,
+            UINT64                          initialStagingChunkSize = (0xFFFF + 1),
+            bool                            initialClose            = false,
+            D3D12BindlessDescriptorHeap*    bindlessHeaps           = nullptr,
+            D3D12CommandAllocatorPool*      allocatorPool           = nullptr
         );
 
         void Close();
@@ -67,6 +82,12 @@ class D3D12CommandContext
         void Signal(D3D12CommandQueue& commandQueue);
         void Reset();
 
+        /*
+        Tracks the specified bundle as executed by the current command list.
+        Bundles are never submitted on their own, so they are signaled alongside this context to recycle their command allocators.
+        */
+        void TrackExecutedBundle(D3D12CommandContext& bundleContext);
+
         // Calls Close, Execute, and Reset with the internal command queue and allocator.
         void FinishAndSync(D3D12CommandQueue& commandQueue);
 
@@ -80,10 +101,30 @@ class D3D12CommandContext
         void TransitionResource(ID3D12Resource* resource, D3D12_RESOURCE_STATES newState, D3D12_RESOURCE_STATES oldState, bool flushImmediate = false);
         void TransitionResource(D3D12Resource& resource, D3D12_RESOURCE_STATES newState, bool flushImmediate = false);
 
+        /*
+        Begins a split barrier to transition all subresources to the specified new state.
+        The barrier ends with the next transition of this resource or when the command list is closed.
+        Only use this when the next use of the resource is known to go through TransitionResource.
+        */
+        void BeginTransitionResource(D3D12Resource& resource, D3D12_RESOURCE_STATES newState);
+
         // Insert a resource barrier for an unordered access view (UAV).
         void InsertUAVBarrier(D3D12Resource& resource, bool flushImmediate = false);
 
-        // Flush all accumulated resource barriers.
+        // Inserts a UAV barrier for the specified native resource. If the resource is null, the barrier applies to all UAV accesses.
+        void InsertUAVBarrier(ID3D12Resource* resource, bool flushImmediate = false);
+
+        // Insert an aliasing barrier between two resources that share the same heap memory. 'resourceBefore' may be null.
+        void InsertAliasingBarrier(ID3D12Resource* resourceBefore, ID3D12Resource* resourceAfter, bool flushImmediate = false);
+
+        // Appends the specified resource barriers to the accumulated barriers.
+        void InsertResourceBarriers(UINT numBarriers, const D3D12_RESOURCE_BARRIER* barriers);
+
+        /*
+        Flush all accumulated resource barriers.
+        This is called before every draw, dispatch, resolve, and copy command, so it must only be called explicitly
+        before commands that are recorded directly into the native command list.
+        */
         void FlushResourceBarrieres();
 
         void ResolveSubresource(
@@ -114,6 +155,13 @@ class D3D12CommandContext
 
         ID3D12Resource* AllocIntermediateBuffer(UINT64 size, UINT alignment = 256u);
 
+        /*
+        Allocates a region in the upload ring buffer that stays valid until the GPU has finished the commands of the current command allocator.
+        Use D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT to bind the region as constant buffer view, e.g. for per-draw constants.
+        Returns false if the ring buffer has not enough free space left.
+        */
+        bool AllocUploadRegion(UINT64 size, UINT64 alignment, D3D12UploadRegion& outRegion);
+
         void SetGraphicsRootSignature(ID3D12RootSignature* rootSignature);
         void SetComputeRootSignature(ID3D12RootSignature* rootSignature);
 
@@ -124,6 +172,9 @@ class D3D12CommandContext
 
         void SetDescriptorHeapsOfOtherContext(const D3D12CommandContext& other);
 
+        // Binds the shader-visible staging descriptor heaps without changing the staging descriptor layout.
+        void SetStagingDescriptorHeaps();
+
         void PrepareStagingDescriptorHeaps(
             const D3D12DescriptorHeapSetLayout& layout,
             const D3D12RootParameterIndices&    indices
@@ -241,6 +292,26 @@ class D3D12CommandContext
         // Returns the next resource barrier and flushes previous barriers if the cache is full.
         D3D12_RESOURCE_BARRIER& NextResourceBarrier();
 
+        // Appends a transition barrier for all subresources of the specified resource.
+        void AppendTransitionBarrier(
+            ID3D12Resource*                 resource,
+            D3D12_RESOURCE_STATES           oldState,
+            D3D12_RESOURCE_STATES           newState,
+            D3D12_RESOURCE_BARRIER_FLAGS    flags       = D3D12_RESOURCE_BARRIER_FLAG_NONE
+        );
+
+        /*
+        Merges a transition to the specified new state into a pending transition of the same resource.
+        The pending barrier is removed if both transitions cancel each other out. Returns false if there is no barrier to merge with.
+        */
+        bool MergeTransitionBarrier(ID3D12Resource* resource, D3D12_RESOURCE_STATES newState);
+
+        // Removes the pending resource barrier at the specified index.
+        void RemoveResourceBarrier(UINT index);
+
+        // Ends the pending split barrier of the specified resource.
+        void EndSplitTransition(D3D12Resource& resource);
+
         // Switches to the next command allocator and resets it.
         void NextCommandAllocator();
 
@@ -267,17 +338,23 @@ class D3D12CommandContext
 
         UINT64                              allocatorFenceValues_[maxNumAllocators]     = {};
         D3D12NativeFence                    allocatorFence_;
+        bool                                allocatorSignaled_[maxNumAllocators]        = {};       // True if the respective allocator has been signaled since it was reset.
+        D3D12CommandAllocatorPool*          allocatorPool_                              = nullptr;
+        D3D12_COMMAND_LIST_TYPE             commandListType_                            = D3D12_COMMAND_LIST_TYPE_DIRECT;
+        std::vector<D3D12CommandContext*>   executedBundles_;
 
         ComPtr<ID3D12GraphicsCommandList>   commandList_;
 
         D3D12_RESOURCE_BARRIER              resourceBarriers_[maxNumResourceBarrieres];
         UINT                                numResourceBarriers_                        = 0;
+        std::vector<D3D12Resource*>         splitResources_;                            // Resources with a pending split barrier; ended on Close.
 
         D3D12StagingDescriptorHeapPool      stagingDescriptorPools_[maxNumAllocators][maxNumDescriptorHeaps];
         D3D12DescriptorHeapSetLayout        stagingDescriptorSetLayout_;
         D3D12RootParameterIndices           stagingDescriptorIndices_;
         D3D12DescriptorCache                descriptorCaches_[maxNumAllocators];
 
+        D3D12UploadRingBuffer               uploadRingBuffer_;                          // Shared by all command allocators; reclaimed as their fences retire.
         D3D12StagingBufferPool              stagingBufferPools_[maxNumAllocators];
         D3D12IntermediateBufferPool         intermediateBufferPools_[maxNumAllocators];
 
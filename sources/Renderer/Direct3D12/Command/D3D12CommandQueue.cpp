@@ -13,6 +13,9 @@
 #include "../RenderState/D3D12QueryHeap.h"
 #include "../../CheckedCast.h"
 #include "../../DXCommon/DXCore.h"
+#include "../../../Core/ProfileZone.h"
+#include <LLGL/Container/SmallVector.h>
+#include <LLGL/Utils/ForRange.h>
 
 
 namespace LLGL
@@ -24,9 +27,10 @@ D3D12CommandQueue::D3D12CommandQueue(
     D3D12_COMMAND_LIST_TYPE type)
 :
     native_     { device.CreateDXCommandQueue(type) },
+    type_       { type                              },
     queueFence_ { device.GetNative()                }
 {
-    commandContext_.Create(device);
+    commandContext_.Create(device, type);
     DetermineTimestampFrequency();
 }
 
@@ -39,12 +43,49 @@ void D3D12CommandQueue::SetDebugName(const char* name)
 
 void D3D12CommandQueue::Submit(CommandBuffer& commandBuffer)
 {
+    LLGL_PROFILE_ZONE("Submit");
+
     /* Execute command list */
     auto& commandBufferD3D = LLGL_CAST(D3D12CommandBuffer&, commandBuffer);
     if (!commandBufferD3D.IsImmediateCmdBuffer())
         commandBufferD3D.GetCommandContext().ExecuteAndSignal(*this);
 }
 
+void D3D12CommandQueue::Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers)
+{
+    LLGL_PROFILE_ZONE("Submit");
+
+    /* Gather command lists of all deferred command buffers */
+    SmallVector<ID3D12CommandList*, 8> commandLists;
+    commandLists.reserve(numCommandBuffers);
+
+    for_range(i, numCommandBuffers)
+    {
+        if (commandBuffers[i] != nullptr)
+        {
+            auto* commandBufferD3D = LLGL_CAST(D3D12CommandBuffer*, commandBuffers[i]);
+            if (!commandBufferD3D->IsImmediateCmdBuffer())
+                commandLists.push_back(commandBufferD3D->GetCommandContext().GetCommandList());
+        }
+    }
+
+    if (commandLists.empty())
+        return;
+
+    /* Execute all command lists at once, then signal their allocator fences in submission order */
+    ExecuteCommandLists(static_cast<UINT>(commandLists.size()), commandLists.data());
+
+    for_range(i, numCommandBuffers)
+    {
+        if (commandBuffers[i] != nullptr)
+        {
+            auto* commandBufferD3D = LLGL_CAST(D3D12CommandBuffer*, commandBuffers[i]);
+            if (!commandBufferD3D->IsImmediateCmdBuffer())
+                commandBufferD3D->GetCommandContext().Signal(*this);
+        }
+    }
+}
+
 /* ----- Queries ----- */
 
 bool D3D12CommandQueue::QueryResult(
@@ -74,13 +115,13 @@ bool D3D12CommandQueue::QueryResult(
     if (dataSize == numQueries * sizeof(std::uint32_t))
     {
         /* Query 64-bit values and convert them to 32-bit values */
-        QueryResultUInt32(queryType, mappedData, firstQuery, numQueries, reinterpret_cast<std::uint32_t*>(data));
+        QueryResultUInt32(queryHeapD3D.GetType(), mappedData, firstQuery, numQueries, reinterpret_cast<std::uint32_t*>(data));
         result = true;
     }
     else if (dataSize == numQueries * sizeof(std::uint64_t))
     {
         /* Query 64-bit values and copy them directly to output */
-        QueryResultUInt64(queryType, mappedData, firstQuery, numQueries, reinterpret_cast<std::uint64_t*>(data));
+        QueryResultUInt64(queryHeapD3D.GetType(), mappedData, firstQuery, numQueries, reinterpret_cast<std::uint64_t*>(data));
         result = true;
     }
     else if (dataSize == numQueries * sizeof(QueryPipelineStatistics))
@@ -94,6 +135,23 @@ bool D3D12CommandQueue::QueryResult(
     return result;
 }
 
+bool D3D12CommandQueue::QueryTimestampCalibration(TimestampCalibration& outCalibration)
+{
+    if (timestampFrequency_ == 0)
+        return false;
+
+    /* The CPU timestamp is sampled with QueryPerformanceCounter, which is the same time domain as Timer::Tick */
+    UINT64 gpuTimestamp = 0, cpuTimestamp = 0;
+    HRESULT hr = native_->GetClockCalibration(&gpuTimestamp, &cpuTimestamp);
+    if (FAILED(hr))
+        return false;
+
+    outCalibration.cpuTick      = cpuTimestamp;
+    outCalibration.gpuTimestamp = TimestampToNanoseconds(gpuTimestamp);
+    outCalibration.maxDeviation = 0;
+    return true;
+}
+
 /* ----- Fences ----- */
 
 void D3D12CommandQueue::Submit(Fence& fence)
@@ -103,12 +161,40 @@ void D3D12CommandQueue::Submit(Fence& fence)
     SignalFence(fenceD3D.GetNative(), fenceD3D.Signal());
 }
 
+void D3D12CommandQueue::SubmitWait(Fence& fence)
+{
+    /* Schedule GPU-side wait for the last value the fence has been signaled with */
+    auto& fenceD3D = LLGL_CAST(D3D12Fence&, fence);
+    HRESULT hr = native_->Wait(fenceD3D.GetNative(), fenceD3D.GetSignaledValue());
+    DXThrowIfFailed(hr, "failed to wait for D3D12 fence with command queue");
+}
+
 bool D3D12CommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
 {
     auto& fenceD3D = LLGL_CAST(D3D12Fence&, fence);
     return fenceD3D.Wait(timeout);
 }
 
+void D3D12CommandQueue::Submit(Fence& fence, std::uint64_t value)
+{
+    /* Schedule signal command with explicit timeline value into the queue */
+    auto& fenceD3D = LLGL_CAST(D3D12Fence&, fence);
+    SignalFence(fenceD3D.GetNative(), fenceD3D.Signal(value));
+}
+
+void D3D12CommandQueue::SubmitWait(Fence& fence, std::uint64_t value)
+{
+    auto& fenceD3D = LLGL_CAST(D3D12Fence&, fence);
+    HRESULT hr = native_->Wait(fenceD3D.GetNative(), value);
+    DXThrowIfFailed(hr, "failed to wait for D3D12 fence with command queue");
+}
+
+bool D3D12CommandQueue::WaitFence(Fence& fence, std::uint64_t value, std::uint64_t timeout)
+{
+    auto& fenceD3D = LLGL_CAST(D3D12Fence&, fence);
+    return fenceD3D.WaitValue(value, timeout);
+}
+
 void D3D12CommandQueue::WaitIdle()
 {
     /* Submit intermediate fence and wait for it to be signaled */
@@ -152,8 +238,15 @@ void D3D12CommandQueue::DetermineTimestampFrequency()
     /* Get timestamp frequency for command queue */
     UINT64 timestampFrequency = 0;
     HRESULT hr = native_->GetTimestampFrequency(&timestampFrequency);
+
+    /* Copy queues only support timestamps with D3D12_FEATURE_DATA_D3D12_OPTIONS3::CopyQueueTimestampQueriesSupported */
+    if (FAILED(hr) && type_ == D3D12_COMMAND_LIST_TYPE_COPY)
+        return;
+
     DXThrowIfInvocationFailed(hr, "ID3D12CommandQueue::GetTimestampFrequency");
 
+    timestampFrequency_ = timestampFrequency;
+
     /* Determine if a conversion from timestamps to nanoseconds is necessary */
     static const UINT64 nanosecondFrequency = 1000000000;
     if (timestampFrequency != nanosecondFrequency)
@@ -163,14 +256,28 @@ void D3D12CommandQueue::DetermineTimestampFrequency()
     }
 }
 
+std::uint64_t D3D12CommandQueue::TimestampToNanoseconds(std::uint64_t timestamp) const
+{
+    static const std::uint64_t nanosecondFrequency = 1000000000;
+    if (isTimestampNanosecs_ || timestampFrequency_ == 0)
+        return timestamp;
+    else
+        return ((timestamp / timestampFrequency_) * nanosecondFrequency + ((timestamp % timestampFrequency_) * nanosecondFrequency) / timestampFrequency_);
+}
+
 void D3D12CommandQueue::QueryResultSingleUInt64(
-    D3D12_QUERY_TYPE    queryType,
+    QueryType           queryType,
     const void*         mappedData,
     std::uint32_t       query,
     std::uint64_t&      data)
 {
     auto mappedDataUInt64 = reinterpret_cast<const std::uint64_t*>(mappedData);
-    if (queryType == D3D12_QUERY_TYPE_TIMESTAMP)
+    if (queryType == QueryType::Timestamp)
+    {
+        /* Convert absolute timestamp to nanoseconds */
+        data = TimestampToNanoseconds(mappedDataUInt64[query]);
+    }
+    else if (queryType == QueryType::TimeElapsed)
     {
         /* Compute difference between start and end timestamps for each output entry */
         const auto startTimestamp   = mappedDataUInt64[query*2    ];
@@ -193,7 +300,7 @@ void D3D12CommandQueue::QueryResultSingleUInt64(
 }
 
 void D3D12CommandQueue::QueryResultUInt32(
-    D3D12_QUERY_TYPE    queryType,
+    QueryType           queryType,
     const void*         mappedData,
     std::uint32_t       firstQuery,
     std::uint32_t       numQueries,
@@ -208,13 +315,13 @@ void D3D12CommandQueue::QueryResultUInt32(
 }
 
 void D3D12CommandQueue::QueryResultUInt64(
-    D3D12_QUERY_TYPE    queryType,
+    QueryType           queryType,
     const void*         mappedData,
     std::uint32_t       firstQuery,
     std::uint32_t       numQueries,
     std::uint64_t*      data)
 {
-    if (queryType == D3D12_QUERY_TYPE_TIMESTAMP)
+    if (queryType == QueryType::TimeElapsed || queryType == QueryType::Timestamp)
     {
         /* Copy individual values of mapped data to output data */
         for (std::uint32_t i = 0; i < numQueries; ++i)
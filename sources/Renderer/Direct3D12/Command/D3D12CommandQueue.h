@@ -39,6 +39,9 @@ class D3D12CommandQueue final : public CommandQueue
 
         void SetDebugName(const char* name) override;
 
+        // Submits all command lists with a single call to ID3D12CommandQueue::ExecuteCommandLists.
+        void Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers) override;
+
     public:
 
         // Submits the specified fence with a custom value.
@@ -60,19 +63,28 @@ class D3D12CommandQueue final : public CommandQueue
             return commandContext_;
         }
 
+        // Returns the type of command lists this queue can execute.
+        inline D3D12_COMMAND_LIST_TYPE GetType() const
+        {
+            return type_;
+        }
+
     private:
 
         void DetermineTimestampFrequency();
 
+        // Converts the specified GPU timestamp into nanoseconds without losing precision for large values.
+        std::uint64_t TimestampToNanoseconds(std::uint64_t timestamp) const;
+
         void QueryResultSingleUInt64(
-            D3D12_QUERY_TYPE    queryType,
+            QueryType           queryType,
             const void*         mappedData,
             std::uint32_t       query,
             std::uint64_t&      data
         );
 
         void QueryResultUInt32(
-            D3D12_QUERY_TYPE    queryType,
+            QueryType           queryType,
             const void*         mappedData,
             std::uint32_t       firstQuery,
             std::uint32_t       numQueries,
@@ -80,7 +92,7 @@ class D3D12CommandQueue final : public CommandQueue
         );
 
         void QueryResultUInt64(
-            D3D12_QUERY_TYPE    queryType,
+            QueryType           queryType,
             const void*         mappedData,
             std::uint32_t       firstQuery,
             std::uint32_t       numQueries,
@@ -98,10 +110,12 @@ class D3D12CommandQueue final : public CommandQueue
     private:
 
         ComPtr<ID3D12CommandQueue>  native_;
+        D3D12_COMMAND_LIST_TYPE     type_                   = D3D12_COMMAND_LIST_TYPE_DIRECT;
         D3D12CommandContext         commandContext_;
         D3D12NativeFence            queueFence_;
         UINT64                      queueFenceValue_        = 0;
         double                      timestampScale_         = 1.0;  // Frequency to nanoseconds scale
+        UINT64                      timestampFrequency_     = 0;
         bool                        isTimestampNanosecs_    = true; // True, if timestamps are in nanoseconds unit
         bool                        busy_                   = false;
 
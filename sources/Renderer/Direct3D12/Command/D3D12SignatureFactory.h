@@ -11,12 +11,15 @@
 
 #include "../../DXCommon/ComPtr.h"
 #include <d3d12.h>
+#include <vector>
+#include <mutex>
 
 
 namespace LLGL
 {
 
 
+// Factory for indirect command signatures. Signatures with custom strides are created on demand and shared across all command buffers.
 class D3D12SignatureFactory
 {
 
@@ -24,6 +27,13 @@ class D3D12SignatureFactory
 
         void CreateDefaultSignatures(ID3D12Device* device);
 
+        /*
+        Returns the command signature for the specified draw or dispatch argument type with a custom byte stride.
+        Returns the respective default signature if 'stride' equals the size of the argument structure.
+        This function is thread-safe.
+        */
+        ID3D12CommandSignature* GetOrCreateSignature(D3D12_INDIRECT_ARGUMENT_TYPE argumentType, UINT stride) const;
+
         inline ID3D12CommandSignature* GetSignatureDrawIndirect() const
         {
             return signatureDrawIndirect_.Get();
@@ -41,9 +51,23 @@ class D3D12SignatureFactory
 
     private:
 
-        ComPtr<ID3D12CommandSignature> signatureDrawIndirect_;
-        ComPtr<ID3D12CommandSignature> signatureDrawIndexedIndirect_;
-        ComPtr<ID3D12CommandSignature> signatureDispatchIndirect_;
+        struct CustomSignature
+        {
+            D3D12_INDIRECT_ARGUMENT_TYPE    argumentType;
+            UINT                            stride;
+            ComPtr<ID3D12CommandSignature>  native;
+        };
+
+    private:
+
+        ID3D12Device*                           device_                         = nullptr;
+
+        ComPtr<ID3D12CommandSignature>          signatureDrawIndirect_;
+        ComPtr<ID3D12CommandSignature>          signatureDrawIndexedIndirect_;
+        ComPtr<ID3D12CommandSignature>          signatureDispatchIndirect_;
+
+        mutable std::vector<CustomSignature>    customSignatures_;
+        mutable std::mutex                      customSignaturesMutex_;
 
 };
 
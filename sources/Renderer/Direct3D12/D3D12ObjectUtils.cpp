@@ -6,6 +6,8 @@
  */
 
 #include "D3D12ObjectUtils.h"
+#include "../DXCommon/ComPtr.h"
+#include "../DXCommon/DXTypes.h"
 #include <string>
 #include <cstring>
 #include <codecvt>
@@ -64,6 +66,16 @@ void D3D12SetObjectNameIndexed(ID3D12Object* obj, const char* name, std::uint32_
     }
 }
 
+void D3D12SetResidencyPriority(ID3D12Pageable* obj, ResidencyPriority priority)
+{
+    ComPtr<ID3D12Device1> device1;
+    if (SUCCEEDED(obj->GetDevice(IID_PPV_ARGS(&device1))))
+    {
+        const D3D12_RESIDENCY_PRIORITY nativePriority = static_cast<D3D12_RESIDENCY_PRIORITY>(DXTypes::ToDXResidencyPriority(priority));
+        device1->SetResidencyPriority(1, &obj, &nativePriority);
+    }
+}
+
 
 } // /namespace LLGL
 
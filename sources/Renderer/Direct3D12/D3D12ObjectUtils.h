@@ -9,6 +9,7 @@
 #define LLGL_D3D12_OBJECT_UTILS_H
 
 
+#include <LLGL/ResourceFlags.h>
 #include <d3d12.h>
 #include <cstdint>
 
@@ -26,6 +27,9 @@ void D3D12SetObjectNameSubscript(ID3D12Object* obj, const char* name, const char
 // Sets the debug name with an index of the specified D3D device child.
 void D3D12SetObjectNameIndexed(ID3D12Object* obj, const char* name, std::uint32_t index);
 
+// Sets the residency priority of the specified heap or committed resource. Requires ID3D12Device1, otherwise the call is ignored.
+void D3D12SetResidencyPriority(ID3D12Pageable* obj, ResidencyPriority priority);
+
 
 } // /namespace LLGL
 
@@ -18,17 +18,24 @@
 #include "D3DX12/d3dx12.h"
 #include <LLGL/Utils/ForRange.h>
 #include <LLGL/Backend/Direct3D12/NativeHandle.h>
+#include <LLGL/RendererConfiguration.h>
 #include <limits.h>
+#include <string.h>
 #include <codecvt>
+#include <mutex>
 
 #include "Buffer/D3D12Buffer.h"
 #include "Buffer/D3D12BufferArray.h"
 #include "Buffer/D3D12BufferConstantsPool.h"
+#include "Buffer/D3D12AccelerationStructure.h"
 
 #include "Texture/D3D12MipGenerator.h"
+#include "Texture/D3D12ImageConverter.h"
+#include "Texture/D3D12TextureBlitter.h"
 
 #include "RenderState/D3D12GraphicsPSO.h"
 #include "RenderState/D3D12ComputePSO.h"
+#include "../../Core/ProfileZone.h"
 
 #include <LLGL/Backend/Direct3D12/NativeHandle.h>
 
@@ -37,7 +44,8 @@ namespace LLGL
 {
 
 
-D3D12RenderSystem::D3D12RenderSystem(const RenderSystemDescriptor& renderSystemDesc)
+D3D12RenderSystem::D3D12RenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
+    shaderCache_ { renderSystemDesc.shaderCache }
 {
     const bool debugDevice = ((renderSystemDesc.flags & RenderSystemFlags::DebugDevice) != 0);
     if (debugDevice)
@@ -55,27 +63,37 @@ D3D12RenderSystem::D3D12RenderSystem(const RenderSystemDescriptor& renderSystemD
         CreateFactory(debugDevice);
 
         ComPtr<IDXGIAdapter> preferredAdatper;
-        QueryVideoAdapters(renderSystemDesc.flags, preferredAdatper);
+        QueryVideoAdapters(renderSystemDesc.flags, renderSystemDesc.adapterIndex, preferredAdatper);
 
-        HRESULT hr = CreateDevice(preferredAdatper.Get());
+        /* Don't fall back to the default or software adapter if one was selected explicitly */
+        HRESULT hr = CreateDevice(preferredAdatper.Get(), (renderSystemDesc.adapterIndex == ~0u));
         DXThrowIfFailed(hr, "failed to create D3D12 device");
     }
 
+    /* Create shader-visible descriptor heaps for bindless mode before any command buffer allocates its staging descriptors */
+    if (auto* rendererConfigD3D = GetRendererConfiguration<RendererConfigurationDirect3D12>(renderSystemDesc))
+        CreateBindlessDescriptorHeaps(*rendererConfigD3D);
+
     /* Create command queue interface */
     commandQueue_   = MakeUnique<D3D12CommandQueue>(device_);
     commandContext_ = &(commandQueue_->GetContext());
 
     /* Create default pipeline layout and command signature pool */
-    defaultPipelineLayout_.CreateRootSignature(device_.GetNative(), {});
+    defaultPipelineLayout_.CreateRootSignature(device_.GetNative(), {}, (GetBindlessDescriptorHeaps() != nullptr));
     cmdSignatureFactory_.CreateDefaultSignatures(device_.GetNative());
 
     stagingBufferPool_.InitializeDevice(device_.GetNative(), 0);
+    rtvHeapPool_.Create(device_.GetNative(), D3D12_DESCRIPTOR_HEAP_TYPE_RTV);
+    dsvHeapPool_.Create(device_.GetNative(), D3D12_DESCRIPTOR_HEAP_TYPE_DSV);
     D3D12MipGenerator::Get().InitializeDevice(device_.GetNative());
-    D3D12BufferConstantsPool::Get().InitializeDevice(device_.GetNative(), *commandContext_, *commandQueue_, stagingBufferPool_);
+    D3D12TextureBlitter::Get().InitializeDevice(device_.GetNative());
+    D3D12ImageConverter::Get().InitializeDevice(device_.GetNative());
+    D3D12BufferConstantsPool::Get().InitializeDevice(device_.GetNative(), *commandContext_, *commandQueue_);
 
     /* Initialize renderer information */
     QueryRendererInfo();
     QueryRenderingCaps();
+    QueryGPUUploadHeapSupport();
 }
 
 D3D12RenderSystem::~D3D12RenderSystem()
@@ -93,6 +111,8 @@ D3D12RenderSystem::~D3D12RenderSystem()
 
     /* Clear resources of singletons */
     D3D12MipGenerator::Get().Clear();
+    D3D12TextureBlitter::Get().Clear();
+    D3D12ImageConverter::Get().Clear();
     D3D12BufferConstantsPool::Get().Clear();
 }
 
@@ -115,6 +135,29 @@ CommandQueue* D3D12RenderSystem::GetCommandQueue()
     return commandQueue_.get();
 }
 
+CommandQueue* D3D12RenderSystem::GetCommandQueue(long queueFlags)
+{
+    if ((queueFlags & CommandQueueFlags::Graphics) != 0)
+        return commandQueue_.get();
+
+    /* Create asynchronous compute and copy queues on demand */
+    if ((queueFlags & CommandQueueFlags::Compute) != 0)
+    {
+        if (!computeCommandQueue_)
+            computeCommandQueue_ = MakeUnique<D3D12CommandQueue>(device_, D3D12_COMMAND_LIST_TYPE_COMPUTE);
+        return computeCommandQueue_.get();
+    }
+
+    if ((queueFlags & CommandQueueFlags::Copy) != 0)
+    {
+        if (!copyCommandQueue_)
+            copyCommandQueue_ = MakeUnique<D3D12CommandQueue>(device_, D3D12_COMMAND_LIST_TYPE_COPY);
+        return copyCommandQueue_.get();
+    }
+
+    return commandQueue_.get();
+}
+
 /* ----- Command buffers ----- */
 
 CommandBuffer* D3D12RenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& commandBufferDesc)
@@ -133,9 +176,14 @@ void D3D12RenderSystem::Release(CommandBuffer& commandBuffer)
 Buffer* D3D12RenderSystem::CreateBuffer(const BufferDescriptor& bufferDesc, const void* initialData)
 {
     RenderSystem::AssertCreateBuffer(bufferDesc, ULLONG_MAX);
-    D3D12Buffer* bufferD3D = buffers_.emplace<D3D12Buffer>(device_.GetNative(), bufferDesc);
-    if (initialData != nullptr)
-        UpdateBufferAndSync(*bufferD3D, 0, initialData, bufferDesc.size, bufferD3D->GetAlignment());
+
+    /* Persistently mapped buffers can reside in the GPU upload heap if they fit into the video memory budget */
+    const bool allowGPUUploadHeap = ((bufferDesc.miscFlags & MiscFlags::PersistentMapping) != 0 && HasGPUUploadHeapBudget(bufferDesc.size));
+
+    D3D12Buffer* bufferD3D = buffers_.emplace<D3D12Buffer>(device_.GetNative(), bufferDesc, allowGPUUploadHeap);
+    if (initialData != nullptr && (bufferDesc.bindFlags & BindFlags::AccelerationStructure) == 0)
+        UpdateBufferAndSync(*bufferD3D, 0, initialData, bufferDesc.size);
+    CreateBindlessDescriptors(*bufferD3D, bufferDesc.bindFlags);
     return bufferD3D;
 }
 
@@ -148,6 +196,7 @@ BufferArray* D3D12RenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buff
 void D3D12RenderSystem::Release(Buffer& buffer)
 {
     SyncGPU();
+    ReleaseBindlessDescriptors(buffer);
     buffers_.erase(&buffer);
 }
 
@@ -159,6 +208,8 @@ void D3D12RenderSystem::Release(BufferArray& bufferArray)
 
 void D3D12RenderSystem::WriteBuffer(Buffer& buffer, std::uint64_t offset, const void* data, std::uint64_t dataSize)
 {
+    LLGL_PROFILE_ZONE("WriteBuffer");
+
     auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
     UpdateBufferAndSync(bufferD3D, offset, data, dataSize);
 }
@@ -166,6 +217,26 @@ void D3D12RenderSystem::WriteBuffer(Buffer& buffer, std::uint64_t offset, const
 void D3D12RenderSystem::ReadBuffer(Buffer& buffer, std::uint64_t offset, void* data, std::uint64_t dataSize)
 {
     auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
+
+    if (bufferD3D.IsUpload() || (bufferD3D.IsReadback() && bufferD3D.GetPersistentData() != nullptr))
+    {
+        /* Read persistently mapped memory directly */
+        ::memcpy(data, bufferD3D.GetPersistentData() + offset, static_cast<std::size_t>(dataSize));
+        return;
+    }
+
+    if (bufferD3D.IsReadback())
+    {
+        /* Readback buffers cannot be copied from, but they can be read directly */
+        void* mappedData = MapBufferRange(bufferD3D, CPUAccess::ReadOnly, offset, dataSize);
+        if (mappedData != nullptr)
+        {
+            ::memcpy(data, static_cast<const char*>(mappedData) + offset, static_cast<std::size_t>(dataSize));
+            bufferD3D.Unmap(*commandContext_, *commandQueue_);
+        }
+        return;
+    }
+
     stagingBufferPool_.ReadSubresourceRegion(*commandContext_, *commandQueue_, bufferD3D.GetResource(), offset, data, dataSize);
     /* No ExecuteCommandListAndSync() here as it has already been flushed by the staging buffer pool */
 }
@@ -192,9 +263,15 @@ void D3D12RenderSystem::UnmapBuffer(Buffer& buffer)
 
 Texture* D3D12RenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const ImageView* initialImage)
 {
-    auto* textureD3D = textures_.emplace<D3D12Texture>(device_.GetNative(), textureDesc);
+    auto* textureD3D = textures_.emplace<D3D12Texture>(device_.GetNative(), textureDesc, &transientHeapPool_, &tileHeapPool_);
 
-    if (initialImage != nullptr)
+    /* Packed MIP-maps of sparse textures are always resident */
+    D3D12SparseTextureMemory* sparseMemory = textureD3D->GetSparseMemory();
+    if (sparseMemory != nullptr)
+        sparseMemory->MapPackedMips(commandQueue_->GetNative());
+
+    /* Transient textures share their memory with other textures and sparse textures have no memory yet, so initial image data would not persist */
+    if (initialImage != nullptr && !textureD3D->IsTransient() && sparseMemory == nullptr)
     {
         /* Update base MIP-map */
         TextureRegion region;
@@ -210,17 +287,22 @@ Texture* D3D12RenderSystem::CreateTexture(const TextureDescriptor& textureDesc,
             D3D12MipGenerator::Get().GenerateMips(*commandContext_, *textureD3D, textureD3D->GetWholeSubresource());
     }
 
+    CreateBindlessDescriptors(*textureD3D, textureDesc.bindFlags);
+
     return textureD3D;
 }
 
 void D3D12RenderSystem::Release(Texture& texture)
 {
     SyncGPU();
+    ReleaseBindlessDescriptors(texture);
     textures_.erase(&texture);
 }
 
 void D3D12RenderSystem::WriteTexture(Texture& texture, const TextureRegion& textureRegion, const ImageView& srcImageView)
 {
+    LLGL_PROFILE_ZONE("WriteTexture");
+
     auto& textureD3D = LLGL_CAST(D3D12Texture&, texture);
 
     /* Execute upload commands and wait for GPU to finish execution */
@@ -290,12 +372,20 @@ void D3D12RenderSystem::ReadTexture(Texture& texture, const TextureRegion& textu
 
 Sampler* D3D12RenderSystem::CreateSampler(const SamplerDescriptor& samplerDesc)
 {
-    return samplers_.emplace<D3D12Sampler>(samplerDesc);
+    /* Samplers with identical descriptors share the same instance, so they only occupy a single bindless descriptor */
+    D3D12Sampler* samplerD3D = samplers_.emplace(samplerDesc, samplerDesc);
+    if (samplers_.use_count(samplerD3D) == 1)
+        CreateBindlessDescriptors(*samplerD3D, 0);
+    return samplerD3D;
 }
 
 void D3D12RenderSystem::Release(Sampler& sampler)
 {
-    SyncGPU();
+    if (samplers_.use_count(&sampler) == 1)
+    {
+        SyncGPU();
+        ReleaseBindlessDescriptors(sampler);
+    }
     samplers_.erase(&sampler);
 }
 
@@ -335,7 +425,7 @@ void D3D12RenderSystem::Release(RenderPass& renderPass)
 
 RenderTarget* D3D12RenderSystem::CreateRenderTarget(const RenderTargetDescriptor& renderTargetDesc)
 {
-    return renderTargets_.emplace<D3D12RenderTarget>(device_, renderTargetDesc);
+    return renderTargets_.emplace<D3D12RenderTarget>(device_, renderTargetDesc, rtvHeapPool_, dsvHeapPool_);
 }
 
 void D3D12RenderSystem::Release(RenderTarget& renderTarget)
@@ -352,6 +442,21 @@ Shader* D3D12RenderSystem::CreateShader(const ShaderDescriptor& shaderDesc)
     return shaders_.emplace<D3D12Shader>(*this, shaderDesc);
 }
 
+std::uint32_t D3D12RenderSystem::CreateShaders(const ArrayView<ShaderDescriptor>& shaderDescs, Shader** outShaders)
+{
+    std::mutex shadersMutex;
+    return CreateShaderBatch(
+        shaderDescs,
+        outShaders,
+        [this, &shadersMutex](const ShaderDescriptor& shaderDesc) -> Shader*
+        {
+            RenderSystem::AssertCreateShader(shaderDesc);
+            return shaders_.emplace_concurrent<D3D12Shader>(shadersMutex, *this, shaderDesc);
+        },
+        /*concurrent:*/ true
+    );
+}
+
 void D3D12RenderSystem::Release(Shader& shader)
 {
     shaders_.erase(&shader);
@@ -361,12 +466,14 @@ void D3D12RenderSystem::Release(Shader& shader)
 
 PipelineLayout* D3D12RenderSystem::CreatePipelineLayout(const PipelineLayoutDescriptor& pipelineLayoutDesc)
 {
-    return pipelineLayouts_.emplace<D3D12PipelineLayout>(device_.GetNative(), pipelineLayoutDesc);
+    return pipelineLayouts_.emplace(pipelineLayoutDesc, device_.GetNative(), pipelineLayoutDesc, (GetBindlessDescriptorHeaps() != nullptr));
 }
 
 void D3D12RenderSystem::Release(PipelineLayout& pipelineLayout)
 {
-    SyncGPU();
+    /* Only wait for the GPU if the shared root signature is about to be released */
+    if (pipelineLayouts_.use_count(&pipelineLayout) == 1)
+        SyncGPU();
     pipelineLayouts_.erase(&pipelineLayout);
 }
 
@@ -374,12 +481,12 @@ void D3D12RenderSystem::Release(PipelineLayout& pipelineLayout)
 
 PipelineCache* D3D12RenderSystem::CreatePipelineCache(const Blob& initialBlob)
 {
-    return pipelineCaches_.emplace<D3D12PipelineCache>(initialBlob);
+    return pipelineCaches_.emplace<D3D12PipelineCache>(device_.GetNative(), initialBlob);
 }
 
 void D3D12RenderSystem::Release(PipelineCache& pipelineCache)
 {
-    /* No GPU sync necessary for PSO caches; they only store an ID3DBlob that is used synchronously */
+    /* No GPU sync necessary for PSO caches; they are only used during PSO creation */
     pipelineCaches_.erase(&pipelineCache);
 }
 
@@ -387,11 +494,15 @@ void D3D12RenderSystem::Release(PipelineCache& pipelineCache)
 
 PipelineState* D3D12RenderSystem::CreatePipelineState(const GraphicsPipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
 {
+    LLGL_PROFILE_ZONE("CreateGraphicsPipelineState");
+
     return pipelineStates_.emplace<D3D12GraphicsPSO>(device_, defaultPipelineLayout_, pipelineStateDesc, GetDefaultRenderPass(), pipelineCache);
 }
 
 PipelineState* D3D12RenderSystem::CreatePipelineState(const ComputePipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
 {
+    LLGL_PROFILE_ZONE("CreateComputePipelineState");
+
     return pipelineStates_.emplace<D3D12ComputePSO>(device_, defaultPipelineLayout_, pipelineStateDesc, pipelineCache);
 }
 
@@ -443,6 +554,118 @@ bool D3D12RenderSystem::GetNativeHandle(void* nativeHandle, std::size_t nativeHa
     return false;
 }
 
+std::uint32_t D3D12RenderSystem::QueryMemoryHeaps(MemoryHeapInfo* /*outHeapInfos*/, std::uint32_t /*maxNumHeaps*/)
+{
+    return 0; // not supported by this backend
+}
+
+std::uint32_t D3D12RenderSystem::GetBindlessDescriptorIndex(const Resource& resource, long bindFlags)
+{
+    auto it = bindlessDescriptors_.find(&resource);
+    if (it == bindlessDescriptors_.end())
+        return LLGL_INVALID_SLOT;
+
+    /* Samplers only have a single descriptor */
+    if (resource.GetResourceType() == ResourceType::Sampler)
+        return it->second.srv;
+
+    switch (bindFlags)
+    {
+        case BindFlags::ConstantBuffer: return it->second.cbv;
+        case BindFlags::Sampled:        return it->second.srv;
+        case BindFlags::Storage:        return it->second.uav;
+        default:                        return LLGL_INVALID_SLOT;
+    }
+}
+
+bool D3D12RenderSystem::GetSparseTextureProperties(const Texture& texture, SparseTextureProperties& outProperties)
+{
+    auto& textureD3D = LLGL_CAST(const D3D12Texture&, texture);
+    if (D3D12SparseTextureMemory* sparseMemory = textureD3D.GetSparseMemory())
+    {
+        sparseMemory->GetProperties(outProperties);
+        return true;
+    }
+    return false;
+}
+
+bool D3D12RenderSystem::CommitTextureTiles(Texture& texture, const TextureRegion& textureRegion, bool commit)
+{
+    auto& textureD3D = LLGL_CAST(D3D12Texture&, texture);
+    if (D3D12SparseTextureMemory* sparseMemory = textureD3D.GetSparseMemory())
+        return sparseMemory->UpdateTileMappings(commandQueue_->GetNative(), textureRegion, commit);
+    return false;
+}
+
+// Returns the native objects of all buffers and committed textures in the specified resource list.
+static std::vector<ID3D12Pageable*> GetPageableResources(const ArrayView<Resource*>& resources)
+{
+    std::vector<ID3D12Pageable*> pageables;
+    pageables.reserve(resources.size());
+
+    for (Resource* resource : resources)
+    {
+        if (resource == nullptr)
+            continue;
+        if (resource->GetResourceType() == ResourceType::Buffer)
+            pageables.push_back(LLGL_CAST(D3D12Buffer*, resource)->GetNative());
+        else if (resource->GetResourceType() == ResourceType::Texture)
+        {
+            /* Placed and reserved resources have no residency of their own */
+            auto* textureD3D = LLGL_CAST(D3D12Texture*, resource);
+            if (textureD3D->IsCommitted())
+                pageables.push_back(textureD3D->GetNative());
+        }
+    }
+
+    return pageables;
+}
+
+bool D3D12RenderSystem::MakeResident(const ArrayView<Resource*>& resources)
+{
+    const std::vector<ID3D12Pageable*> pageables = GetPageableResources(resources);
+    if (pageables.empty())
+        return true;
+
+    HRESULT hr = device_.GetNative()->MakeResident(static_cast<UINT>(pageables.size()), pageables.data());
+    return SUCCEEDED(hr);
+}
+
+void D3D12RenderSystem::Evict(const ArrayView<Resource*>& resources)
+{
+    const std::vector<ID3D12Pageable*> pageables = GetPageableResources(resources);
+    if (!pageables.empty())
+        device_.GetNative()->Evict(static_cast<UINT>(pageables.size()), pageables.data());
+}
+
+bool D3D12RenderSystem::GetAccelerationStructureSizes(const AccelerationStructureBuildDescriptor& buildDesc, AccelerationStructureSizes& outSizes)
+{
+    ComPtr<ID3D12Device5> device5;
+    if (FAILED(device_.GetNative()->QueryInterface(IID_PPV_ARGS(&device5))))
+        return false;
+
+    D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS inputs;
+    std::vector<D3D12_RAYTRACING_GEOMETRY_DESC> geometryDescs;
+    D3D12ConvertAccelerationStructureInputs(inputs, geometryDescs, buildDesc);
+
+    D3D12_RAYTRACING_ACCELERATION_STRUCTURE_PREBUILD_INFO prebuildInfo = {};
+    device5->GetRaytracingAccelerationStructurePrebuildInfo(&inputs, &prebuildInfo);
+    if (prebuildInfo.ResultDataMaxSizeInBytes == 0)
+        return false;
+
+    outSizes.accelerationStructureSize  = prebuildInfo.ResultDataMaxSizeInBytes;
+    outSizes.buildScratchSize           = prebuildInfo.ScratchDataSizeInBytes;
+    outSizes.updateScratchSize          = prebuildInfo.UpdateScratchDataSizeInBytes;
+    return true;
+}
+
+std::uint64_t D3D12RenderSystem::GetAccelerationStructureAddress(const Buffer& buffer)
+{
+    if ((buffer.GetBindFlags() & BindFlags::AccelerationStructure) == 0)
+        return 0;
+    return D3D12GetBufferGPUAddress(&buffer);
+}
+
 
 /*
  * ======= Internal: =======
@@ -458,8 +681,17 @@ ComPtr<IDXGISwapChain1> D3D12RenderSystem::CreateDXSwapChain(const DXGI_SWAP_CHA
     return swapChain;
 }
 
+bool D3D12RenderSystem::IsTearingSupported() const
+{
+    return DXIsTearingSupported(factory_.Get());
+}
+
 void D3D12RenderSystem::SyncGPU()
 {
+    if (computeCommandQueue_)
+        computeCommandQueue_->WaitIdle();
+    if (copyCommandQueue_)
+        copyCommandQueue_->WaitIdle();
     commandQueue_->WaitIdle();
 }
 
@@ -492,12 +724,15 @@ void D3D12RenderSystem::CreateFactory(bool debugDevice)
     DXThrowIfFailed(hr, "failed to create DXGI factor 1.4");
 }
 
-void D3D12RenderSystem::QueryVideoAdapters(long flags, ComPtr<IDXGIAdapter>& outPreferredAdatper)
+void D3D12RenderSystem::QueryVideoAdapters(long flags, std::uint32_t adapterIndex, ComPtr<IDXGIAdapter>& outPreferredAdatper)
 {
-    videoAdatperInfo_ = DXGetVideoAdapterInfo(factory_.Get(), flags, outPreferredAdatper.ReleaseAndGetAddressOf());
+    if (adapterIndex != ~0u)
+        videoAdatperInfo_ = DXGetVideoAdapterInfoByIndex(factory_.Get(), adapterIndex, outPreferredAdatper.ReleaseAndGetAddressOf());
+    else
+        videoAdatperInfo_ = DXGetVideoAdapterInfo(factory_.Get(), flags, outPreferredAdatper.ReleaseAndGetAddressOf());
 }
 
-HRESULT D3D12RenderSystem::CreateDevice(IDXGIAdapter* preferredAdapter)
+HRESULT D3D12RenderSystem::CreateDevice(IDXGIAdapter* preferredAdapter, bool allowDefaultAdapter)
 {
     std::vector<D3D_FEATURE_LEVEL> featureLevels = DXGetFeatureLevels(D3D_FEATURE_LEVEL_12_1);
     HRESULT hr = S_OK;
@@ -506,7 +741,7 @@ HRESULT D3D12RenderSystem::CreateDevice(IDXGIAdapter* preferredAdapter)
     {
         /* Try to create device with perferred adatper */
         hr = device_.CreateDXDevice(featureLevels, preferredAdapter);
-        if (SUCCEEDED(hr))
+        if (SUCCEEDED(hr) || !allowDefaultAdapter)
             return hr;
     }
 
@@ -564,6 +799,52 @@ static bool FindHighestShaderModel(ID3D12Device* device, D3D_SHADER_MODEL& shade
     return false;
 }
 
+// Returns true if the device supports resource binding tier 3 and shader model 6.6, which are required for ResourceDescriptorHeap/SamplerDescriptorHeap in HLSL.
+static bool IsBindlessDescriptorHeapSupported(ID3D12Device* device)
+{
+    D3D12_FEATURE_DATA_D3D12_OPTIONS options = {};
+    if (FAILED(device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS, &options, sizeof(options))))
+        return false;
+    if (options.ResourceBindingTier < D3D12_RESOURCE_BINDING_TIER_3)
+        return false;
+
+    /* Use value of D3D_SHADER_MODEL_6_6 since it is not declared in older Windows SDKs */
+    const D3D_SHADER_MODEL shaderModel66 = static_cast<D3D_SHADER_MODEL>(0x66);
+    D3D12_FEATURE_DATA_SHADER_MODEL feature;
+    feature.HighestShaderModel = shaderModel66;
+    if (FAILED(device->CheckFeatureSupport(D3D12_FEATURE_SHADER_MODEL, &feature, sizeof(feature))))
+        return false;
+
+    return (feature.HighestShaderModel >= shaderModel66);
+}
+
+// Returns true if the device supports ray tracing tier 1.1, which is required for inline ray queries (RayQuery) in HLSL.
+static bool IsRaytracingTier1_1Supported(ID3D12Device* device)
+{
+    D3D12_FEATURE_DATA_D3D12_OPTIONS5 options = {};
+    if (FAILED(device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS5, &options, sizeof(options))))
+        return false;
+    return (options.RaytracingTier >= D3D12_RAYTRACING_TIER_1_1);
+}
+
+// Returns true if the device supports variable rate shading tier 1, which is required for a per-draw shading rate.
+static bool IsVariableRateShadingTier1Supported(ID3D12Device* device)
+{
+    D3D12_FEATURE_DATA_D3D12_OPTIONS6 options = {};
+    if (FAILED(device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS6, &options, sizeof(options))))
+        return false;
+    return (options.VariableShadingRateTier >= D3D12_VARIABLE_SHADING_RATE_TIER_1);
+}
+
+// Returns true if the device supports tiled resources tier 2, which is required for residency queries and clamped LOD in HLSL.
+static bool IsTiledResourcesTier2Supported(ID3D12Device* device)
+{
+    D3D12_FEATURE_DATA_D3D12_OPTIONS options = {};
+    if (FAILED(device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS, &options, sizeof(options))))
+        return false;
+    return (options.TiledResourcesTier >= D3D12_TILED_RESOURCES_TIER_2);
+}
+
 static const char* DXShaderModelToString(D3D_SHADER_MODEL shaderModel)
 {
     switch (shaderModel)
@@ -597,6 +878,41 @@ void D3D12RenderSystem::QueryRendererInfo()
     SetRendererInfo(info);
 }
 
+/*
+Use the values of D3D12_FEATURE_D3D12_OPTIONS16 and its data structure since they are not declared in older Windows SDKs.
+The GPU upload heap requires resizable BAR and is reported by the member GPUUploadHeapSupported.
+*/
+struct D3D12FeatureDataOptions16
+{
+    BOOL DynamicDepthBiasSupported;
+    BOOL GPUUploadHeapSupported;
+};
+
+static const D3D12_FEATURE g_featureD3D12Options16 = static_cast<D3D12_FEATURE>(46);
+
+void D3D12RenderSystem::QueryGPUUploadHeapSupport()
+{
+    D3D12FeatureDataOptions16 options16 = {};
+    if (FAILED(device_.GetNative()->CheckFeatureSupport(g_featureD3D12Options16, &options16, sizeof(options16))) || !options16.GPUUploadHeapSupported)
+        return;
+
+    /* Query adapter of the device to check the local video memory budget, which the GPU upload heap is allocated from */
+    const LUID adapterLuid = device_.GetNative()->GetAdapterLuid();
+    factory_->EnumAdapterByLuid(adapterLuid, IID_PPV_ARGS(gpuUploadHeapAdapter_.ReleaseAndGetAddressOf()));
+}
+
+bool D3D12RenderSystem::HasGPUUploadHeapBudget(UINT64 size) const
+{
+    if (gpuUploadHeapAdapter_.Get() == nullptr)
+        return false;
+
+    DXGI_QUERY_VIDEO_MEMORY_INFO memoryInfo = {};
+    if (FAILED(gpuUploadHeapAdapter_->QueryVideoMemoryInfo(0, DXGI_MEMORY_SEGMENT_GROUP_LOCAL, &memoryInfo)))
+        return false;
+
+    return (memoryInfo.CurrentUsage + size <= memoryInfo.Budget);
+}
+
 void D3D12RenderSystem::QueryRenderingCaps()
 {
     RenderingCapabilities caps;
@@ -608,6 +924,13 @@ void D3D12RenderSystem::QueryRenderingCaps()
         caps.features.hasConservativeRasterization  = (GetFeatureLevel() >= D3D_FEATURE_LEVEL_12_0);
         caps.features.hasTextureViewSwizzle         = true;
         caps.features.hasPipelineCaching            = true;
+        caps.features.hasIndirectDrawCount          = true;
+        caps.features.hasBufferRenderCondition      = true;
+        caps.features.hasBindlessDescriptors        = (GetBindlessDescriptorHeaps() != nullptr);
+        caps.features.hasSparseTextures             = IsTiledResourcesTier2Supported(device_.GetNative());
+        caps.features.hasRayTracing                 = IsRaytracingTier1_1Supported(device_.GetNative());
+        caps.features.hasVariableRateShading        = IsVariableRateShadingTier1Supported(device_.GetNative());
+        caps.features.hasTimestampCalibration       = true;
 
         caps.limits.maxViewports                    = D3D12_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE;
         caps.limits.maxViewportSize[0]              = D3D12_VIEWPORT_BOUNDS_MAX;
@@ -633,10 +956,15 @@ void D3D12RenderSystem::UpdateBufferAndSync(
     D3D12Buffer&    bufferD3D,
     std::uint64_t   offset,
     const void*     data,
-    std::uint64_t   dataSize,
-    std::uint64_t   alignment)
+    std::uint64_t   dataSize)
 {
-    stagingBufferPool_.WriteImmediate(*commandContext_, bufferD3D.GetResource(), offset, data, dataSize, alignment);
+    if (bufferD3D.IsUpload())
+    {
+        /* Upload heap buffers cannot be copied into, but they are written directly through their persistent mapping */
+        ::memcpy(bufferD3D.GetPersistentData() + offset, data, static_cast<std::size_t>(dataSize));
+        return;
+    }
+    commandContext_->UpdateSubresource(bufferD3D.GetResource(), offset, data, dataSize);
     ExecuteCommandListAndSync();
 }
 
@@ -690,11 +1018,21 @@ HRESULT D3D12RenderSystem::UpdateTextureSubresourceFromImage(
     if ((formatAttribs.flags & FormatFlags::IsCompressed) == 0 &&
         (formatAttribs.format != imageView.format || formatAttribs.dataType != imageView.dataType))
     {
-        /* Convert image data (e.g. from RGB to RGBA), and redirect initial data to new buffer */
+        /* Upload packed image data and convert it on the GPU (e.g. from RGB to RGBA) if the builtin shader supports this conversion */
+        if (D3D12ImageConverter::Get().WriteTextureRegion(subresourceContext, textureD3D, region, imageView))
+            return S_OK;
+
+        /* Convert image data on the CPU, and redirect initial data to new buffer */
         intermediateData    = ConvertImageBuffer(imageView, formatAttribs.format, formatAttribs.dataType, LLGL_MAX_THREAD_COUNT);
         srcData             = intermediateData.get();
         LLGL_ASSERT(intermediateData.size() == dataLayout.subresourceSize);
     }
+    else if (DynamicByteArray compressedData = CompressTextureImageData(format, imageView, region.extent, subresource.numArrayLayers))
+    {
+        /* Compress uncompressed image data (e.g. from RGBA to BC1) on the CPU, and redirect initial data to new buffer */
+        intermediateData    = std::move(compressedData);
+        srcData             = intermediateData.get();
+    }
 
     /* Upload image data to subresource */
     D3D12_SUBRESOURCE_DATA subresourceData;
@@ -723,6 +1061,101 @@ const D3D12RenderPass* D3D12RenderSystem::GetDefaultRenderPass() const
     return nullptr;
 }
 
+void D3D12RenderSystem::CreateBindlessDescriptorHeaps(const RendererConfigurationDirect3D12& config)
+{
+    if (!config.enableBindlessDescriptors || !IsBindlessDescriptorHeapSupported(device_.GetNative()))
+        return;
+
+    /* Use maximum heap sizes; everything beyond the stable descriptors is sub-allocated for descriptor tables */
+    constexpr UINT maxNumResourceDescriptors    = 1000000;
+    constexpr UINT maxNumSamplerDescriptors     = D3D12_MAX_SHADER_VISIBLE_SAMPLER_HEAP_SIZE;
+
+    bindlessHeaps_[0].Create(
+        device_.GetNative(),
+        D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV,
+        std::min<UINT>(config.numBindlessDescriptors, maxNumResourceDescriptors),
+        maxNumResourceDescriptors
+    );
+    bindlessHeaps_[1].Create(
+        device_.GetNative(),
+        D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER,
+        std::min<UINT>(config.numBindlessSamplers, maxNumSamplerDescriptors),
+        maxNumSamplerDescriptors
+    );
+}
+
+void D3D12RenderSystem::CreateBindlessDescriptors(Resource& resource, long bindFlags)
+{
+    if (GetBindlessDescriptorHeaps() == nullptr)
+        return;
+
+    ID3D12Device* device = device_.GetNative();
+    BindlessDescriptors descriptors;
+
+    auto AllocDescriptor = [this](std::size_t heapIndex, UINT& outIndex) -> bool
+    {
+        if (bindlessHeaps_[heapIndex].AllocDescriptor(outIndex))
+            return true;
+        Errorf("D3D12 bindless descriptor heap has no stable descriptors left");
+        return false;
+    };
+
+    switch (resource.GetResourceType())
+    {
+        case ResourceType::Buffer:
+        {
+            auto& bufferD3D = LLGL_CAST(D3D12Buffer&, resource);
+            if ((bindFlags & BindFlags::ConstantBuffer) != 0 && AllocDescriptor(0, descriptors.cbv))
+                bufferD3D.CreateConstantBufferView(device, bindlessHeaps_[0].GetHeap().GetCpuHandleWithOffset(descriptors.cbv));
+            if ((bindFlags & BindFlags::Sampled) != 0 && AllocDescriptor(0, descriptors.srv))
+                bufferD3D.CreateShaderResourceView(device, bindlessHeaps_[0].GetHeap().GetCpuHandleWithOffset(descriptors.srv));
+            if ((bindFlags & BindFlags::Storage) != 0 && AllocDescriptor(0, descriptors.uav))
+                bufferD3D.CreateUnorderedAccessView(device, bindlessHeaps_[0].GetHeap().GetCpuHandleWithOffset(descriptors.uav));
+        }
+        break;
+
+        case ResourceType::Texture:
+        {
+            auto& textureD3D = LLGL_CAST(D3D12Texture&, resource);
+            if ((bindFlags & BindFlags::Sampled) != 0 && AllocDescriptor(0, descriptors.srv))
+                textureD3D.CreateShaderResourceView(device, bindlessHeaps_[0].GetHeap().GetCpuHandleWithOffset(descriptors.srv));
+            if ((bindFlags & BindFlags::Storage) != 0 && AllocDescriptor(0, descriptors.uav))
+                textureD3D.CreateUnorderedAccessView(device, bindlessHeaps_[0].GetHeap().GetCpuHandleWithOffset(descriptors.uav));
+        }
+        break;
+
+        case ResourceType::Sampler:
+        {
+            auto& samplerD3D = LLGL_CAST(D3D12Sampler&, resource);
+            if (AllocDescriptor(1, descriptors.srv))
+                samplerD3D.CreateResourceView(device, bindlessHeaps_[1].GetHeap().GetCpuHandleWithOffset(descriptors.srv));
+        }
+        break;
+
+        default:
+        break;
+    }
+
+    bindlessDescriptors_[&resource] = descriptors;
+}
+
+void D3D12RenderSystem::ReleaseBindlessDescriptors(const Resource& resource)
+{
+    auto it = bindlessDescriptors_.find(&resource);
+    if (it == bindlessDescriptors_.end())
+        return;
+
+    /* Samplers are allocated in the second heap, all other resources in the first one */
+    D3D12BindlessDescriptorHeap& heap = bindlessHeaps_[resource.GetResourceType() == ResourceType::Sampler ? 1 : 0];
+    for (UINT index : { it->second.cbv, it->second.srv, it->second.uav })
+    {
+        if (index != LLGL_INVALID_SLOT)
+            heap.FreeDescriptor(index);
+    }
+
+    bindlessDescriptors_.erase(it);
+}
+
 
 } // /namespace LLGL
 
@@ -25,6 +25,8 @@
 #include "Texture/D3D12Texture.h"
 #include "Texture/D3D12Sampler.h"
 #include "Texture/D3D12RenderTarget.h"
+#include "Texture/D3D12TransientHeapPool.h"
+#include "Texture/D3D12TileHeapPool.h"
 
 #include "RenderState/D3D12Fence.h"
 #include "RenderState/D3D12PipelineCache.h"
@@ -33,14 +35,19 @@
 #include "RenderState/D3D12ResourceHeap.h"
 #include "RenderState/D3D12RenderPass.h"
 #include "RenderState/D3D12QueryHeap.h"
+#include "RenderState/D3D12BindlessDescriptorHeap.h"
+#include "RenderState/D3D12CPUDescriptorHeapPool.h"
 
 #include "Shader/D3D12Shader.h"
 
 #include "../VideoAdapter.h"
 #include "../ContainerTypes.h"
+#include "../PipelineLayoutCache.h"
+#include "../SamplerCache.h"
 #include "../DXCommon/ComPtr.h"
 #include <d3d12.h>
 #include <dxgi1_4.h>
+#include <unordered_map>
 
 
 namespace LLGL
@@ -71,6 +78,9 @@ class D3D12RenderSystem final : public RenderSystem
 
         ComPtr<IDXGISwapChain1> CreateDXSwapChain(const DXGI_SWAP_CHAIN_DESC1& swapChainDescDXGI, HWND wnd);
 
+        // Returns true if the DXGI factory supports presenting with tearing, i.e. DXGI_FEATURE_PRESENT_ALLOW_TEARING.
+        bool IsTearingSupported() const;
+
         // Internal fence
         void SignalFenceValue(UINT64& fenceValue);
         void WaitForFenceValue(UINT64 fenceValue);
@@ -109,19 +119,43 @@ class D3D12RenderSystem final : public RenderSystem
             return cmdSignatureFactory_;
         }
 
+        // Returns the command allocator pool that is shared between all command buffers.
+        inline D3D12CommandAllocatorPool& GetCommandAllocatorPool()
+        {
+            return commandAllocatorPool_;
+        }
+
+        // Returns the optional shader cache from the render system descriptor; may be null.
+        inline ShaderCache* GetShaderCache() const
+        {
+            return shaderCache_;
+        }
+
+        // Returns the CBV/SRV/UAV and sampler heaps (in that order) for bindless mode, or null if bindless mode is disabled.
+        inline D3D12BindlessDescriptorHeap* GetBindlessDescriptorHeaps()
+        {
+            return (bindlessHeaps_[0].IsCreated() ? bindlessHeaps_ : nullptr);
+        }
+
     private:
 
         void EnableDebugLayer();
 
         void CreateFactory(bool debugDevice = false);
-        void QueryVideoAdapters(long flags, ComPtr<IDXGIAdapter>& outPreferredAdatper);
+        void QueryVideoAdapters(long flags, std::uint32_t adapterIndex, ComPtr<IDXGIAdapter>& outPreferredAdatper);
 
-        HRESULT CreateDevice(IDXGIAdapter* preferredAdapter);
+        HRESULT CreateDevice(IDXGIAdapter* preferredAdapter, bool allowDefaultAdapter = true);
         HRESULT QueryDXInterfacesFromNativeHandle(const Direct3D12::RenderSystemNativeHandle& nativeHandle);
 
         void QueryRendererInfo();
         void QueryRenderingCaps();
 
+        // Queries the adapter for video memory budgets if the device supports the GPU upload heap.
+        void QueryGPUUploadHeapSupport();
+
+        // Returns true if a persistently mapped buffer of the specified size can be placed in the GPU upload heap without exceeding the local video memory budget.
+        bool HasGPUUploadHeapBudget(UINT64 size) const;
+
         // Close, execute, and reset command list.
         void ExecuteCommandListAndSync();
 
@@ -129,8 +163,7 @@ class D3D12RenderSystem final : public RenderSystem
             D3D12Buffer&    bufferD3D,
             std::uint64_t   offset,
             const void*     data,
-            std::uint64_t   dataSize,
-            std::uint64_t   alignment   = 256u
+            std::uint64_t   dataSize
         );
 
         // Maps the range of the specified D3D buffer between GPU and CPU memory space.
@@ -146,6 +179,23 @@ class D3D12RenderSystem final : public RenderSystem
 
         const D3D12RenderPass* GetDefaultRenderPass() const;
 
+        // Creates the shader-visible descriptor heaps for bindless mode if the device supports it.
+        void CreateBindlessDescriptorHeaps(const RendererConfigurationDirect3D12& config);
+
+        // Creates the descriptors with stable indices for the specified resource in bindless mode.
+        void CreateBindlessDescriptors(Resource& resource, long bindFlags);
+        void ReleaseBindlessDescriptors(const Resource& resource);
+
+    private:
+
+        // Stable descriptor indices of a resource in the bindless heaps. Samplers only use 'srv' into the sampler heap.
+        struct BindlessDescriptors
+        {
+            UINT cbv = LLGL_INVALID_SLOT;
+            UINT srv = LLGL_INVALID_SLOT;
+            UINT uav = LLGL_INVALID_SLOT;
+        };
+
     private:
 
         /* ----- Common objects ----- */
@@ -156,20 +206,28 @@ class D3D12RenderSystem final : public RenderSystem
         D3D12PipelineLayout                     defaultPipelineLayout_;
         D3D12SignatureFactory                   cmdSignatureFactory_;
         D3D12StagingBufferPool                  stagingBufferPool_;
+        D3D12TransientHeapPool                  transientHeapPool_;
+        D3D12TileHeapPool                       tileHeapPool_;          // Must outlive the sparse textures, which return their tiles to this pool.
+        D3D12BindlessDescriptorHeap             bindlessHeaps_[2];      // Must outlive the command buffers, which allocate their staging descriptors from these heaps.
+        D3D12CPUDescriptorHeapPool              rtvHeapPool_;           // Must outlive the render targets, which return their RTVs to this pool.
+        D3D12CPUDescriptorHeapPool              dsvHeapPool_;           // Must outlive the render targets, which return their DSVs to this pool.
+        D3D12CommandAllocatorPool               commandAllocatorPool_;  // Must outlive the command buffers, which return their allocators to this pool.
 
         /* ----- Hardware object containers ----- */
 
         HWObjectContainer<D3D12SwapChain>       swapChains_;
         HWObjectInstance<D3D12CommandQueue>     commandQueue_;
+        HWObjectInstance<D3D12CommandQueue>     computeCommandQueue_;
+        HWObjectInstance<D3D12CommandQueue>     copyCommandQueue_;
         HWObjectContainer<D3D12CommandBuffer>   commandBuffers_;
         HWObjectContainer<D3D12Buffer>          buffers_;
-        HWObjectContainer<D3D12BufferArray>     bufferArrays_;
+        HWObjectPool<D3D12BufferArray>          bufferArrays_;
         HWObjectContainer<D3D12Texture>         textures_;
-        HWObjectContainer<D3D12Sampler>         samplers_;
+        SamplerCache<D3D12Sampler>              samplers_;
         HWObjectContainer<D3D12RenderPass>      renderPasses_;
         HWObjectContainer<D3D12RenderTarget>    renderTargets_;
         HWObjectContainer<D3D12Shader>          shaders_;
-        HWObjectContainer<D3D12PipelineLayout>  pipelineLayouts_;
+        PipelineLayoutCache<D3D12PipelineLayout> pipelineLayouts_;
         HWObjectContainer<D3D12PipelineCache>   pipelineCaches_;
         HWObjectContainer<D3D12PipelineState>   pipelineStates_;
         HWObjectContainer<D3D12ResourceHeap>    resourceHeaps_;
@@ -179,6 +237,10 @@ class D3D12RenderSystem final : public RenderSystem
         /* ----- Other members ----- */
 
         VideoAdapterInfo                        videoAdatperInfo_;
+        ComPtr<IDXGIAdapter3>                   gpuUploadHeapAdapter_;  // Only used for video memory budgets; null if the GPU upload heap is not supported.
+        ShaderCache*                            shaderCache_            = nullptr;
+
+        std::unordered_map<const Resource*, BindlessDescriptors> bindlessDescriptors_;
 
 };
 
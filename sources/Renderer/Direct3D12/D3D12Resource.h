@@ -54,6 +54,8 @@ struct D3D12Resource
     ComPtr<ID3D12Resource>  native;
     D3D12_RESOURCE_STATES   usageState      = D3D12_RESOURCE_STATE_COMMON;
     D3D12_RESOURCE_STATES   currentState    = D3D12_RESOURCE_STATE_COMMON;
+    D3D12_RESOURCE_STATES   splitState      = D3D12_RESOURCE_STATE_COMMON;  // State before the pending split barrier, if 'splitPending' is true.
+    bool                    splitPending    = false;                        // True if a split barrier has begun but not ended yet.
 };
 
 
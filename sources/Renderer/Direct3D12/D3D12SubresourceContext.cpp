@@ -62,6 +62,24 @@ ID3D12Resource* D3D12SubresourceContext::CreateReadbackBuffer(UINT64 size, D3D12
     return TakeAndGetNative(resource);
 }
 
+ID3D12Resource* D3D12SubresourceContext::CreateDefaultBuffer(UINT64 size, D3D12_RESOURCE_FLAGS flags, D3D12_RESOURCE_STATES initialState)
+{
+    /* Create buffer resource in default heap */
+    ComPtr<ID3D12Resource> resource;
+    const CD3DX12_HEAP_PROPERTIES heapProperties{ D3D12_HEAP_TYPE_DEFAULT };
+    const CD3DX12_RESOURCE_DESC bufferDesc = CD3DX12_RESOURCE_DESC::Buffer(size, flags);
+    HRESULT hr = GetDevice()->CreateCommittedResource(
+        &heapProperties,
+        D3D12_HEAP_FLAG_NONE,
+        &bufferDesc,
+        initialState,
+        nullptr,
+        IID_PPV_ARGS(resource.ReleaseAndGetAddressOf())
+    );
+    DXThrowIfCreateFailed(hr, "ID3D12Resource", "for subresource intermediate buffer");
+    return TakeAndGetNative(resource);
+}
+
 ID3D12Resource* D3D12SubresourceContext::CreateTexture(const D3D12_RESOURCE_DESC& desc, D3D12_RESOURCE_STATES initialState)
 {
     /* Create texture resource in default heap ready to be initialized with an upload buffer */
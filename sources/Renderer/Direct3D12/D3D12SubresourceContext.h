@@ -34,6 +34,9 @@ class D3D12SubresourceContext
         // Creates a buffer resource in the readback heap (D3D12_HEAP_TYPE_READBACK).
         ID3D12Resource* CreateReadbackBuffer(UINT64 size, D3D12_RESOURCE_STATES initialState = D3D12_RESOURCE_STATE_COPY_DEST);
 
+        // Creates a buffer resource in the default heap (D3D12_HEAP_TYPE_DEFAULT), e.g. as intermediate buffer for a compute shader.
+        ID3D12Resource* CreateDefaultBuffer(UINT64 size, D3D12_RESOURCE_FLAGS flags, D3D12_RESOURCE_STATES initialState = D3D12_RESOURCE_STATE_COMMON);
+
         // Creates a texture resource in the default heap (D3D12_HEAP_TYPE_DEFAULT).
         ID3D12Resource* CreateTexture(const D3D12_RESOURCE_DESC& desc, D3D12_RESOURCE_STATES initialState = D3D12_RESOURCE_STATE_COPY_DEST);
 
@@ -14,6 +14,7 @@
 #include "Buffer/D3D12Buffer.h"
 #include "RenderState/D3D12DescriptorHeap.h"
 #include "../CheckedCast.h"
+#include "../SwapChainUtils.h"
 #include "../../Core/CoreUtils.h"
 #include "../DXCommon/DXTypes.h"
 
@@ -21,6 +22,8 @@
 #include <LLGL/Log.h>
 #include <LLGL/Utils/ForRange.h>
 #include "D3DX12/d3dx12.h"
+#include "../../Core/ProfileZone.h"
+#include <dxgi1_5.h>
 #include <algorithm>
 
 
@@ -35,6 +38,7 @@ D3D12SwapChain::D3D12SwapChain(
 :
     SwapChain           { desc                                                            },
     renderSystem_       { renderSystem                                                    },
+    presentMode_        { desc.presentMode                                                },
     frameFence_         { renderSystem.GetDXDevice()                                      },
     depthStencilFormat_ { DXPickDepthStencilFormat(desc.depthBits, desc.stencilBits)      },
     numColorBuffers_    { Clamp(desc.swapBuffers, 1u, D3D12SwapChain::maxNumColorBuffers) }
@@ -45,10 +49,39 @@ D3D12SwapChain::D3D12SwapChain(
     /* Setup surface for the swap-chain */
     SetOrCreateSurface(surface, desc.resolution, desc.fullscreen, nullptr);
 
+    /* Select swap-chain flags for presentation mode and frame latency */
+    syncInterval_ = GetPresentSyncInterval(presentMode_, 0);
+
+    if (presentMode_ == PresentMode::Immediate && renderSystem.IsTearingSupported())
+    {
+        swapChainFlags_ |= DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING;
+        presentFlags_   |= DXGI_PRESENT_ALLOW_TEARING;
+    }
+
+    if (desc.maxFramesInFlight > 0)
+    {
+        /* IDXGISwapChain2::SetMaximumFrameLatency expects a value in the range [1, 16] */
+        maxFrameLatency_ = Clamp(desc.maxFramesInFlight, 1u, 16u);
+        swapChainFlags_ |= DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
+    }
+
+    /* Select color format for the requested color space */
+    colorSpace_     = desc.colorSpace;
+    colorFormat_    = DXGetColorSpaceFormat(colorSpace_);
+
     /* Create device resources and window dependent resource */
     CreateDescriptorHeaps(renderSystem.GetDevice(), desc.samples);
     CreateResolutionDependentResources(desc.resolution);
 
+    /* Limit number of queued frames and wait for the first frame to become available */
+    if (maxFrameLatency_ > 0)
+    {
+        HRESULT hr = swapChainDXGI_->SetMaximumFrameLatency(maxFrameLatency_);
+        DXThrowIfFailed(hr, "failed to set maximum frame latency of DXGI swap chain");
+        frameLatencyWaitableObject_ = swapChainDXGI_->GetFrameLatencyWaitableObject();
+        WaitForFrameLatency();
+    }
+
     /* Create default render pass */
     defaultRenderPass_.BuildAttachments(1, &colorFormat_, depthStencilFormat_, sampleDesc_);
 
@@ -60,6 +93,9 @@ D3D12SwapChain::~D3D12SwapChain()
 {
     /* Ensure the GPU is no longer referencing resources that are about to be released */
     MoveToNextFrame();
+
+    if (frameLatencyWaitableObject_ != nullptr)
+        CloseHandle(frameLatencyWaitableObject_);
 }
 
 void D3D12SwapChain::SetDebugName(const char* name)
@@ -82,12 +118,17 @@ void D3D12SwapChain::SetDebugName(const char* name)
 
 void D3D12SwapChain::Present()
 {
-    /* Present swap-chain with vsync interval */
-    HRESULT hr = swapChainDXGI_->Present(syncInterval_, 0);
+    LLGL_PROFILE_ZONE("Present");
+
+    /* Present swap-chain with vsync interval; tearing is only allowed without vsync */
+    HRESULT hr = swapChainDXGI_->Present(syncInterval_, (syncInterval_ == 0 ? presentFlags_ : 0));
     DXThrowIfFailed(hr, "failed to present DXGI swap chain");
 
     /* Advance frame counter */
     MoveToNextFrame();
+
+    /* Throttle CPU to the maximum frame latency before the next frame is recorded */
+    WaitForFrameLatency();
 }
 
 std::uint32_t D3D12SwapChain::GetCurrentSwapIndex() const
@@ -122,7 +163,7 @@ const RenderPass* D3D12SwapChain::GetRenderPass() const
 
 bool D3D12SwapChain::SetVsyncInterval(std::uint32_t vsyncInterval)
 {
-    return SetPresentSyncInterval(vsyncInterval);
+    return SetPresentSyncInterval(GetPresentSyncInterval(presentMode_, vsyncInterval));
 }
 
 /* --- Extended functions --- */
@@ -158,12 +199,11 @@ void D3D12SwapChain::ResolveSubresources(D3D12CommandContext& commandContext, UI
     }
     else
     {
-        /* Prepare color buffer for present */
-        commandContext.TransitionResource(
-            colorBuffers_[colorBuffer],
-            D3D12_RESOURCE_STATE_PRESENT,
-            true
-        );
+        /*
+        Prepare color buffer for present with a split barrier: The next use is either the present after the command list
+        has been submitted or the next render pass, both of which end the barrier
+        */
+        commandContext.BeginTransitionResource(colorBuffers_[colorBuffer], D3D12_RESOURCE_STATE_PRESENT);
     }
 }
 
@@ -386,7 +426,7 @@ HRESULT D3D12SwapChain::CreateResolutionDependentResources(const Extent2D& resol
             resolution.width,
             resolution.height,
             colorFormat_,
-            0
+            swapChainFlags_
         );
 
         if (hr == DXGI_ERROR_DEVICE_REMOVED || hr == DXGI_ERROR_DEVICE_RESET)
@@ -416,11 +456,15 @@ HRESULT D3D12SwapChain::CreateResolutionDependentResources(const Extent2D& resol
             swapChainDesc.Scaling               = DXGI_SCALING_NONE;
             swapChainDesc.SwapEffect            = DXGI_SWAP_EFFECT_FLIP_DISCARD;
             swapChainDesc.AlphaMode             = DXGI_ALPHA_MODE_IGNORE;
-            swapChainDesc.Flags                 = 0;
+            swapChainDesc.Flags                 = swapChainFlags_;
         }
         auto swapChain = renderSystem_.CreateDXSwapChain(swapChainDesc, wndHandle.window);
 
         swapChain.As(&swapChainDXGI_);
+
+        /* Present in the requested color space; if it is not supported, the swap-chain keeps its color format but is presented in sRGB */
+        if (colorSpace_ != ColorSpace::SRGB && !DXSetSwapChainColorSpace(swapChainDXGI_.Get(), colorSpace_))
+            colorSpace_ = ColorSpace::SRGB;
     }
 
     /* Create color buffer render target views (RTV) */
@@ -535,6 +579,12 @@ void D3D12SwapChain::MoveToNextFrame()
     frameFenceValues_[currentColorBuffer_] = currentFenceValue + 1;
 }
 
+void D3D12SwapChain::WaitForFrameLatency()
+{
+    if (frameLatencyWaitableObject_ != nullptr)
+        WaitForSingleObjectEx(frameLatencyWaitableObject_, 1000, TRUE);
+}
+
 
 } // /namespace LLGL
 
@@ -101,6 +101,9 @@ class D3D12SwapChain final : public SwapChain
 
         void MoveToNextFrame();
 
+        // Blocks until the swap-chain is ready to accept a new frame if a maximum frame latency was specified.
+        void WaitForFrameLatency();
+
     private:
 
         static constexpr UINT maxNumColorBuffers = 3;
@@ -112,6 +115,11 @@ class D3D12SwapChain final : public SwapChain
         ComPtr<IDXGISwapChain3>         swapChainDXGI_;
         DXGI_SAMPLE_DESC                sampleDesc_                             = { 1, 0 };
         UINT                            syncInterval_                           = 0;
+        PresentMode                     presentMode_                            = PresentMode::Default;
+        UINT                            swapChainFlags_                         = 0;
+        UINT                            presentFlags_                           = 0; // Present flags for a sync interval of 0, i.e. DXGI_PRESENT_ALLOW_TEARING.
+        UINT                            maxFrameLatency_                        = 0;
+        HANDLE                          frameLatencyWaitableObject_             = nullptr;
 
         ComPtr<ID3D12DescriptorHeap>    rtvDescHeap_;
         UINT                            rtvDescSize_                            = 0;
@@ -120,6 +128,7 @@ class D3D12SwapChain final : public SwapChain
         D3D12Resource                   colorBuffers_[maxNumColorBuffers];
         D3D12Resource                   colorBuffersMS_[maxNumColorBuffers];
         DXGI_FORMAT                     colorFormat_                            = DXGI_FORMAT_R8G8B8A8_UNORM;//DXGI_FORMAT_B8G8R8A8_UNORM;
+        ColorSpace                      colorSpace_                             = ColorSpace::SRGB;
 
         D3D12Resource                   depthStencil_;
         DXGI_FORMAT                     depthStencilFormat_                     = DXGI_FORMAT_UNKNOWN;
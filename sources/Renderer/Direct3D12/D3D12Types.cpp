@@ -239,6 +239,21 @@ UINT Map(const TextureSwizzleRGBA& textureSwizzle)
     );
 }
 
+D3D12_SHADING_RATE Map(const ShadingRate shadingRate)
+{
+    switch (shadingRate)
+    {
+        case ShadingRate::Rate1x1:  return D3D12_SHADING_RATE_1X1;
+        case ShadingRate::Rate1x2:  return D3D12_SHADING_RATE_1X2;
+        case ShadingRate::Rate2x1:  return D3D12_SHADING_RATE_2X1;
+        case ShadingRate::Rate2x2:  return D3D12_SHADING_RATE_2X2;
+        case ShadingRate::Rate2x4:  return D3D12_SHADING_RATE_2X4;
+        case ShadingRate::Rate4x2:  return D3D12_SHADING_RATE_4X2;
+        case ShadingRate::Rate4x4:  return D3D12_SHADING_RATE_4X4;
+    }
+    DXTypes::MapFailed("ShadingRate", "D3D12_SHADING_RATE");
+}
+
 D3D12_SRV_DIMENSION MapSrvDimension(const TextureType textureType)
 {
     switch (textureType)
@@ -301,6 +316,7 @@ D3D12_QUERY_TYPE MapQueryType(const QueryType queryType)
         case QueryType::StreamOutPrimitivesWritten:     return D3D12_QUERY_TYPE_SO_STATISTICS_STREAM0;
         case QueryType::StreamOutOverflow:              break; // D3D12_QUERY_TYPE_SO_STATISTICS_STREAM1 ???
         case QueryType::PipelineStatistics:             return D3D12_QUERY_TYPE_PIPELINE_STATISTICS;
+        case QueryType::Timestamp:                      return D3D12_QUERY_TYPE_TIMESTAMP;
     }
     DXTypes::MapFailed("QueryType", "D3D12_QUERY_TYPE");
 }
@@ -316,6 +332,7 @@ D3D12_QUERY_HEAP_TYPE MapQueryHeapType(const QueryType queryType)
         case QueryType::StreamOutPrimitivesWritten:     /* pass */
         case QueryType::StreamOutOverflow:              return D3D12_QUERY_HEAP_TYPE_SO_STATISTICS;
         case QueryType::PipelineStatistics:             return D3D12_QUERY_HEAP_TYPE_PIPELINE_STATISTICS;
+        case QueryType::Timestamp:                      return D3D12_QUERY_HEAP_TYPE_TIMESTAMP;
     }
     DXTypes::MapFailed("QueryType", "D3D12_QUERY_HEAP_TYPE");
 }
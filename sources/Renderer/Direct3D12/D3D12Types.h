@@ -15,6 +15,7 @@
 #include <LLGL/TextureFlags.h>
 #include <LLGL/SamplerFlags.h>
 #include <LLGL/QueryHeapFlags.h>
+#include <LLGL/CommandBufferFlags.h>
 #include <d3d12.h>
 #include "../DXCommon/DXTypes.h"
 
@@ -37,6 +38,7 @@ D3D12_TEXTURE_ADDRESS_MODE      Map( const SamplerAddressMode   addressMode
 D3D12_LOGIC_OP                  Map( const LogicOp              logicOp         );
 D3D12_SHADER_COMPONENT_MAPPING  Map( const TextureSwizzle       textureSwizzle  );
 UINT                            Map( const TextureSwizzleRGBA&  textureSwizzle  );
+D3D12_SHADING_RATE              Map( const ShadingRate          shadingRate     );
 
 D3D12_SRV_DIMENSION             MapSrvDimension     ( const TextureType textureType );
 D3D12_UAV_DIMENSION             MapUavDimension     ( const TextureType textureType );
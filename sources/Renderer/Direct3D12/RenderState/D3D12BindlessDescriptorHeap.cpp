@@ -0,0 +1,67 @@
+/*
+ * D3D12BindlessDescriptorHeap.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "D3D12BindlessDescriptorHeap.h"
+#include "../../../Core/Assertion.h"
+
+
+namespace LLGL
+{
+
+
+void D3D12BindlessDescriptorHeap::Create(ID3D12Device* device, D3D12_DESCRIPTOR_HEAP_TYPE type, UINT numStableDescriptors, UINT size)
+{
+    LLGL_ASSERT(numStableDescriptors <= size);
+
+    heap_.Create(device, type, size, D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE);
+
+    numStableDescriptors_   = numStableDescriptors;
+    nextStableDescriptor_   = 0;
+    freeStableDescriptors_.clear();
+
+    /* The entire remainder after the stable descriptors is initially free for staging regions */
+    freeRegions_.Reset(numStableDescriptors, size - numStableDescriptors);
+}
+
+bool D3D12BindlessDescriptorHeap::AllocDescriptor(UINT& outIndex)
+{
+    if (!freeStableDescriptors_.empty())
+    {
+        outIndex = freeStableDescriptors_.back();
+        freeStableDescriptors_.pop_back();
+        return true;
+    }
+    if (nextStableDescriptor_ < numStableDescriptors_)
+    {
+        outIndex = nextStableDescriptor_++;
+        return true;
+    }
+    return false;
+}
+
+void D3D12BindlessDescriptorHeap::FreeDescriptor(UINT index)
+{
+    LLGL_ASSERT(index < nextStableDescriptor_);
+    freeStableDescriptors_.push_back(index);
+}
+
+bool D3D12BindlessDescriptorHeap::AllocRegion(UINT size, UINT& outFirstDescriptor)
+{
+    return freeRegions_.Alloc(size, outFirstDescriptor);
+}
+
+void D3D12BindlessDescriptorHeap::FreeRegion(UINT firstDescriptor, UINT size)
+{
+    freeRegions_.Free(firstDescriptor, size);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
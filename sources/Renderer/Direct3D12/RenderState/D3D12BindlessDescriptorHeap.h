@@ -0,0 +1,90 @@
+/*
+ * D3D12BindlessDescriptorHeap.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_D3D12_BINDLESS_DESCRIPTOR_HEAP_H
+#define LLGL_D3D12_BINDLESS_DESCRIPTOR_HEAP_H
+
+
+#include "D3D12DescriptorHeap.h"
+#include "D3D12DescriptorFreeList.h"
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/*
+Shader-visible descriptor heap for bindless mode (see RendererConfigurationDirect3D12::enableBindlessDescriptors).
+The heap is divided into two parts: The first part holds descriptors with stable indices for the lifetime of their resources.
+The second part is sub-allocated in regions for the staging descriptor tables of command contexts,
+so that only one shader-visible heap per type must be bound to the command list.
+*/
+class D3D12BindlessDescriptorHeap
+{
+
+    public:
+
+        D3D12BindlessDescriptorHeap() = default;
+
+        D3D12BindlessDescriptorHeap(const D3D12BindlessDescriptorHeap&) = delete;
+        D3D12BindlessDescriptorHeap& operator = (const D3D12BindlessDescriptorHeap&) = delete;
+
+        // Creates the shader-visible descriptor heap with the specified total size; the first 'numStableDescriptors' have stable indices.
+        void Create(ID3D12Device* device, D3D12_DESCRIPTOR_HEAP_TYPE type, UINT numStableDescriptors, UINT size);
+
+        // Allocates a descriptor with a stable index. Returns false if all stable descriptors are in use.
+        bool AllocDescriptor(UINT& outIndex);
+
+        // Frees the specified descriptor. It can be reused by the next allocation, so the GPU must no longer reference it.
+        void FreeDescriptor(UINT index);
+
+        // Allocates a region for staging descriptors. Returns false if there is no contiguous region of the specified size left.
+        bool AllocRegion(UINT size, UINT& outFirstDescriptor);
+
+        // Frees the specified region for staging descriptors.
+        void FreeRegion(UINT firstDescriptor, UINT size);
+
+        // Returns the native D3D descriptor heap wrapper.
+        inline const D3D12DescriptorHeap& GetHeap() const
+        {
+            return heap_;
+        }
+
+        // Returns the native D3D descriptor heap.
+        inline ID3D12DescriptorHeap* GetNative() const
+        {
+            return heap_.GetNative();
+        }
+
+        // Returns true if this heap has been created.
+        inline bool IsCreated() const
+        {
+            return (heap_.GetNative() != nullptr);
+        }
+
+    private:
+
+        D3D12DescriptorHeap     heap_;
+
+        UINT                    numStableDescriptors_   = 0;
+        UINT                    nextStableDescriptor_   = 0;
+        std::vector<UINT>       freeStableDescriptors_;
+
+        D3D12DescriptorFreeList freeRegions_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
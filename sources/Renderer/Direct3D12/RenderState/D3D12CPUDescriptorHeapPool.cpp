@@ -0,0 +1,114 @@
+/*
+ * D3D12CPUDescriptorHeapPool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "D3D12CPUDescriptorHeapPool.h"
+#include "../../../Core/Assertion.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+void D3D12CPUDescriptorHeapPool::Create(ID3D12Device* device, D3D12_DESCRIPTOR_HEAP_TYPE type, UINT pageSize)
+{
+    device_     = device;
+    type_       = type;
+    pageSize_   = pageSize;
+    stride_     = device->GetDescriptorHandleIncrementSize(type);
+    pages_.clear();
+}
+
+D3D12CPUDescriptorRange D3D12CPUDescriptorHeapPool::Alloc(UINT count)
+{
+    D3D12CPUDescriptorRange range;
+    if (count == 0)
+        return range;
+
+    LLGL_ASSERT(device_ != nullptr, "D3D12 CPU descriptor heap pool has not been created");
+
+    /* Find first page with a sufficient free range */
+    UINT page = 0, first = 0;
+    for (; page < pages_.size(); ++page)
+    {
+        if (pages_[page].heap.GetNative() != nullptr && pages_[page].freeList.Alloc(count, first))
+            break;
+    }
+
+    /* Create new page if no page had enough descriptors left */
+    if (page == pages_.size())
+    {
+        page = CreatePage(std::max(count, pageSize_));
+        pages_[page].freeList.Alloc(count, first);
+    }
+
+    pages_[page].numAllocated += count;
+
+    range.handle    = pages_[page].heap.GetCpuHandleWithOffset(first);
+    range.page      = page;
+    range.first     = first;
+    range.count     = count;
+    return range;
+}
+
+void D3D12CPUDescriptorHeapPool::Free(D3D12CPUDescriptorRange& range)
+{
+    if (range.count == 0)
+        return;
+
+    LLGL_ASSERT(range.page < pages_.size());
+    Page& page = pages_[range.page];
+    LLGL_ASSERT(page.numAllocated >= range.count);
+
+    page.freeList.Free(range.first, range.count);
+    page.numAllocated -= range.count;
+
+    /* Release native heap of unused pages to keep memory bounded, but keep the first page for the next allocations */
+    if (page.numAllocated == 0 && range.page > 0)
+        page.heap.Reset();
+
+    range = D3D12CPUDescriptorRange{};
+}
+
+D3D12_CPU_DESCRIPTOR_HANDLE D3D12CPUDescriptorHeapPool::GetCpuHandle(const D3D12CPUDescriptorRange& range, UINT offset) const
+{
+    LLGL_ASSERT(offset < range.count);
+    D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle = range.handle;
+    cpuDescHandle.ptr += offset * stride_;
+    return cpuDescHandle;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+UINT D3D12CPUDescriptorHeapPool::CreatePage(UINT size)
+{
+    /* Re-use slot of a released page, so the page indices of all allocated ranges remain unchanged */
+    UINT index = 0;
+    for (; index < pages_.size(); ++index)
+    {
+        if (pages_[index].heap.GetNative() == nullptr)
+            break;
+    }
+    if (index == pages_.size())
+        pages_.emplace_back();
+
+    Page& page = pages_[index];
+    page.heap.Create(device_, type_, size, D3D12_DESCRIPTOR_HEAP_FLAG_NONE);
+    page.freeList.Reset(0, size);
+    page.numAllocated = 0;
+    return index;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
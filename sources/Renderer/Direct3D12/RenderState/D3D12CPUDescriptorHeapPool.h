@@ -0,0 +1,89 @@
+/*
+ * D3D12CPUDescriptorHeapPool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_D3D12_CPU_DESCRIPTOR_HEAP_POOL_H
+#define LLGL_D3D12_CPU_DESCRIPTOR_HEAP_POOL_H
+
+
+#include "D3D12DescriptorHeap.h"
+#include "D3D12DescriptorFreeList.h"
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+// Range of descriptors allocated from a D3D12CPUDescriptorHeapPool.
+struct D3D12CPUDescriptorRange
+{
+    D3D12_CPU_DESCRIPTOR_HANDLE handle  = {};
+    UINT                        page    = 0;
+    UINT                        first   = 0;
+    UINT                        count   = 0;
+};
+
+/*
+Pool of non-shader-visible descriptor heaps for one descriptor heap type, e.g. for the RTVs and DSVs of render targets.
+Descriptor ranges are sub-allocated from pages with a free-list each, so the descriptors of released objects are recycled
+instead of creating a new native descriptor heap for every object. Pages that become entirely free are released, except for the first one.
+*/
+class D3D12CPUDescriptorHeapPool
+{
+
+    public:
+
+        D3D12CPUDescriptorHeapPool() = default;
+
+        D3D12CPUDescriptorHeapPool(const D3D12CPUDescriptorHeapPool&) = delete;
+        D3D12CPUDescriptorHeapPool& operator = (const D3D12CPUDescriptorHeapPool&) = delete;
+
+        // Initializes the pool for the specified descriptor heap type. Native descriptor heaps are only created on demand.
+        void Create(ID3D12Device* device, D3D12_DESCRIPTOR_HEAP_TYPE type, UINT pageSize = 256);
+
+        // Allocates a contiguous range of descriptors. Ranges that are larger than the page size get their own page.
+        D3D12CPUDescriptorRange Alloc(UINT count);
+
+        // Frees the specified range of descriptors and resets it. The descriptors can be reused by the next allocation.
+        void Free(D3D12CPUDescriptorRange& range);
+
+        // Returns the CPU descriptor handle at the specified offset within the specified range.
+        D3D12_CPU_DESCRIPTOR_HANDLE GetCpuHandle(const D3D12CPUDescriptorRange& range, UINT offset) const;
+
+    private:
+
+        struct Page
+        {
+            D3D12DescriptorHeap     heap;
+            D3D12DescriptorFreeList freeList;
+            UINT                    numAllocated    = 0;
+        };
+
+    private:
+
+        // Creates a new page with the specified size or re-uses a released page slot. Returns the index of that page.
+        UINT CreatePage(UINT size);
+
+    private:
+
+        ID3D12Device*               device_     = nullptr;
+        D3D12_DESCRIPTOR_HEAP_TYPE  type_       = D3D12_DESCRIPTOR_HEAP_TYPE_NUM_TYPES;
+        UINT                        pageSize_   = 0;
+        UINT                        stride_     = 0;
+        std::vector<Page>           pages_;     // Released pages keep their slot, so page indices of allocated ranges remain valid.
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -27,23 +27,28 @@ D3D12ComputePSO::D3D12ComputePSO(
     const ComputePipelineDescriptor&    desc,
     PipelineCache*                      pipelineCache)
 :
-    D3D12PipelineState { /*isGraphicsPSO:*/ false, desc.pipelineLayout, GetShadersAsArray(desc), defaultPipelineLayout }
+    D3D12PipelineState { /*isGraphicsPSO:*/ false, desc.pipelineLayout, GetShadersAsArray(desc), defaultPipelineLayout, desc.placeholder }
 {
     auto* computeShaderD3D = LLGL_CAST(const D3D12Shader*, desc.computeShader);
     if (computeShaderD3D == nullptr)
         throw std::runtime_error("cannot create D3D compute pipeline without compute shader");
 
-    /* Create native compute PSO */
-    if (pipelineCache != nullptr)
-    {
-        auto* pipelineCacheD3D = LLGL_CAST(D3D12PipelineCache*, pipelineCache);
-        CreateNativePSO(device, computeShaderD3D->GetByteCode(), pipelineCacheD3D);
-    }
-    else
-        CreateNativePSO(device, computeShaderD3D->GetByteCode());
+    /* Create native compute PSO; the byte code is owned by the shader which must outlive the compilation */
+    auto* pipelineCacheD3D = LLGL_CAST(D3D12PipelineCache*, pipelineCache);
+    const D3D12_SHADER_BYTECODE csBytecode = computeShaderD3D->GetByteCode();
+    CompileNativePSO(
+        [this, &device, csBytecode, pipelineCacheD3D]()
+        {
+            CreateNativePSO(device, csBytecode, pipelineCacheD3D);
+        },
+        desc.debugName,
+        desc.asyncCompilation
+    );
+}
 
-    if (desc.debugName != nullptr)
-        SetDebugName(desc.debugName);
+D3D12ComputePSO::~D3D12ComputePSO()
+{
+    WaitForCompilation();
 }
 
 void D3D12ComputePSO::Bind(D3D12CommandContext& commandContext)
@@ -64,12 +69,11 @@ void D3D12ComputePSO::CreateNativePSO(
     stateDesc.pRootSignature    = GetRootSignature();
     stateDesc.CS                = csBytecode;
 
-    /* Set PSO cache if specified */
+    /* Create native PSO or load it from the PSO cache if specified */
     if (pipelineCache != nullptr)
-        stateDesc.CachedPSO = pipelineCache->GetCachedPSO();
-
-    /* Create native PSO */
-    SetNativeAndUpdateCache(device.CreateDXComputePipelineState(stateDesc), pipelineCache);
+        SetNative(pipelineCache->LoadOrCreateComputePSO(device, D3D12PipelineCache::GetComputePSOKey(stateDesc, GetRootSignatureHash()), stateDesc));
+    else
+        SetNative(device.CreateDXComputePipelineState(stateDesc));
 }
 
 
@@ -34,6 +34,8 @@ class D3D12ComputePSO final : public D3D12PipelineState
             PipelineCache*                      pipelineCache           = nullptr
         );
 
+        ~D3D12ComputePSO();
+
         void Bind(D3D12CommandContext& commandContext) override;
 
     private:
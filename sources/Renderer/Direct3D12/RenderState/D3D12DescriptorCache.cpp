@@ -12,6 +12,7 @@
 #include "../Texture/D3D12Sampler.h"
 #include "../../CheckedCast.h"
 #include "../../../Core/Assertion.h"
+#include "../../../Core/ProfileZone.h"
 #include <thread>
 #include <chrono>
 #include <algorithm>
@@ -93,6 +94,8 @@ void D3D12DescriptorCache::EmplaceDescriptor(Resource& resource, UINT location,
 
 D3D12_GPU_DESCRIPTOR_HANDLE D3D12DescriptorCache::FlushCbvSrvUavDescriptors(D3D12StagingDescriptorHeapPool& descHeapPool)
 {
+    LLGL_PROFILE_ZONE("FlushCbvSrvUavDescriptors");
+
     if (dirtyBits_.descHeapCbvSrvUav)
     {
         dirtyBits_.descHeapCbvSrvUav = 0;
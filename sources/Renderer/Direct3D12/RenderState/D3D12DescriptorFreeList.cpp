@@ -0,0 +1,80 @@
+/*
+ * D3D12DescriptorFreeList.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "D3D12DescriptorFreeList.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+void D3D12DescriptorFreeList::Reset(UINT firstDescriptor, UINT size)
+{
+    freeRanges_.clear();
+    if (size > 0)
+        freeRanges_.push_back(Range{ firstDescriptor, size });
+}
+
+bool D3D12DescriptorFreeList::Alloc(UINT size, UINT& outFirstDescriptor)
+{
+    /* Find first free range that is large enough */
+    for (auto it = freeRanges_.begin(); it != freeRanges_.end(); ++it)
+    {
+        if (it->size >= size)
+        {
+            outFirstDescriptor = it->first;
+            it->first += size;
+            it->size  -= size;
+            if (it->size == 0)
+                freeRanges_.erase(it);
+            return true;
+        }
+    }
+    return false;
+}
+
+void D3D12DescriptorFreeList::Free(UINT firstDescriptor, UINT size)
+{
+    /* Insert range sorted by its first descriptor */
+    auto it = std::lower_bound(
+        freeRanges_.begin(),
+        freeRanges_.end(),
+        firstDescriptor,
+        [](const Range& range, UINT first) -> bool
+        {
+            return (range.first < first);
+        }
+    );
+    it = freeRanges_.insert(it, Range{ firstDescriptor, size });
+
+    /* Merge with next range */
+    auto next = it + 1;
+    if (next != freeRanges_.end() && it->first + it->size == next->first)
+    {
+        it->size += next->size;
+        freeRanges_.erase(next);
+    }
+
+    /* Merge with previous range */
+    if (it != freeRanges_.begin())
+    {
+        auto prev = it - 1;
+        if (prev->first + prev->size == it->first)
+        {
+            prev->size += it->size;
+            freeRanges_.erase(it);
+        }
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
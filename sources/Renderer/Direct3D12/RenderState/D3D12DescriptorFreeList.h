@@ -0,0 +1,63 @@
+/*
+ * D3D12DescriptorFreeList.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_D3D12_DESCRIPTOR_FREE_LIST_H
+#define LLGL_D3D12_DESCRIPTOR_FREE_LIST_H
+
+
+#include <d3d12.h>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+// Free-list of contiguous descriptor ranges within a descriptor heap. Adjacent free ranges are merged when they are freed.
+class D3D12DescriptorFreeList
+{
+
+    public:
+
+        // Resets the free-list to a single free range.
+        void Reset(UINT firstDescriptor, UINT size);
+
+        // Allocates a contiguous range with the first fit. Returns false if there is no free range of the specified size left.
+        bool Alloc(UINT size, UINT& outFirstDescriptor);
+
+        // Frees the specified range and merges it with its adjacent free ranges.
+        void Free(UINT firstDescriptor, UINT size);
+
+        // Returns true if no range is free.
+        inline bool IsEmpty() const
+        {
+            return freeRanges_.empty();
+        }
+
+    private:
+
+        struct Range
+        {
+            UINT first;
+            UINT size;
+        };
+
+    private:
+
+        std::vector<Range> freeRanges_; // Sorted by their first descriptor.
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -65,10 +65,11 @@ static ComPtr<ID3D12DescriptorHeap> CreateDXDescriptorHeapOrThrow(
 }
 
 D3D12DescriptorHeap::D3D12DescriptorHeap(D3D12DescriptorHeap&& rhs) :
-    native_ { std::move(rhs.native_) },
-    type_   { rhs.type_              },
-    size_   { rhs.size_              },
-    stride_ { rhs.stride_            }
+    native_     { std::move(rhs.native_) },
+    type_       { rhs.type_              },
+    size_       { rhs.size_              },
+    stride_     { rhs.stride_            },
+    baseOffset_ { rhs.baseOffset_        }
 {
 }
 
@@ -78,8 +79,9 @@ D3D12DescriptorHeap& D3D12DescriptorHeap::operator = (D3D12DescriptorHeap&& rhs)
     {
         native_ = std::move(rhs.native_);
         type_   = rhs.type_;
-        size_   = rhs.size_;
-        stride_ = rhs.stride_;
+        size_       = rhs.size_;
+        stride_     = rhs.stride_;
+        baseOffset_ = rhs.baseOffset_;
     }
     return *this;
 }
@@ -97,6 +99,16 @@ D3D12DescriptorHeap::D3D12DescriptorHeap(
 {
 }
 
+D3D12DescriptorHeap::D3D12DescriptorHeap(const D3D12DescriptorHeap& parentHeap, UINT firstDescriptor, UINT size) :
+    native_     { parentHeap.native_                        },
+    type_       { parentHeap.type_                          },
+    size_       { size                                      },
+    stride_     { parentHeap.stride_                        },
+    baseOffset_ { parentHeap.baseOffset_ + firstDescriptor  }
+{
+    LLGL_ASSERT(firstDescriptor + size <= parentHeap.size_);
+}
+
 void D3D12DescriptorHeap::Create(
     ID3D12Device*               device,
     D3D12_DESCRIPTOR_HEAP_TYPE  type,
@@ -107,9 +119,10 @@ void D3D12DescriptorHeap::Create(
     native_ = CreateDXDescriptorHeapOrThrow(device, type, size, flags);
 
     /* Store new size and reset write offset */
-    type_   = type;
-    size_   = size;
-    stride_ = device->GetDescriptorHandleIncrementSize(type);
+    type_       = type;
+    size_       = size;
+    stride_     = device->GetDescriptorHandleIncrementSize(type);
+    baseOffset_ = 0;
 }
 
 void D3D12DescriptorHeap::Reset(UINT size)
@@ -118,6 +131,7 @@ void D3D12DescriptorHeap::Reset(UINT size)
     {
         /* Get device from previously created descriptor */
         LLGL_ASSERT(native_ != nullptr);
+        LLGL_ASSERT(baseOffset_ == 0, "cannot resize region of D3D12 descriptor heap");
         ComPtr<ID3D12Device> device;
         native_->GetDevice(IID_PPV_ARGS(device.ReleaseAndGetAddressOf()));
 
@@ -140,29 +154,27 @@ void D3D12DescriptorHeap::Reset()
 
 D3D12_CPU_DESCRIPTOR_HANDLE D3D12DescriptorHeap::GetCpuHandleStart() const
 {
-    /* Return destination descriptor CPU handle address */
-    return GetNative()->GetCPUDescriptorHandleForHeapStart();
+    return GetCpuHandleWithOffset(0);
 }
 
 D3D12_CPU_DESCRIPTOR_HANDLE D3D12DescriptorHeap::GetCpuHandleWithOffset(UINT offset) const
 {
     /* Return destination descriptor CPU handle address */
     D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle = GetNative()->GetCPUDescriptorHandleForHeapStart();
-    cpuDescHandle.ptr += offset * GetStride();
+    cpuDescHandle.ptr += (baseOffset_ + offset) * GetStride();
     return cpuDescHandle;
 }
 
 D3D12_GPU_DESCRIPTOR_HANDLE D3D12DescriptorHeap::GetGpuHandleStart() const
 {
-    /* Return destination descriptor GPU handle address */
-    return GetNative()->GetGPUDescriptorHandleForHeapStart();
+    return GetGpuHandleWithOffset(0);
 }
 
 D3D12_GPU_DESCRIPTOR_HANDLE D3D12DescriptorHeap::GetGpuHandleWithOffset(UINT offset) const
 {
     /* Return destination descriptor GPU handle address */
     D3D12_GPU_DESCRIPTOR_HANDLE gpuDescHandle = GetNative()->GetGPUDescriptorHandleForHeapStart();
-    gpuDescHandle.ptr += offset * GetStride();
+    gpuDescHandle.ptr += (baseOffset_ + offset) * GetStride();
     return gpuDescHandle;
 }
 
@@ -46,6 +46,9 @@ class D3D12DescriptorHeap
 
         virtual ~D3D12DescriptorHeap() = default;
 
+        // Initializes this descriptor heap as a region of the specified parent heap. The native D3D descriptor heap is shared.
+        D3D12DescriptorHeap(const D3D12DescriptorHeap& parentHeap, UINT firstDescriptor, UINT size);
+
         // Creates the native D3D descriptor heap. This is always a shader-visible descriptor heap.
         void Create(
             ID3D12Device*               device,
@@ -96,12 +99,19 @@ class D3D12DescriptorHeap
             return stride_;
         }
 
+        // Returns the offset (in number of descriptors) of this heap within the native D3D descriptor heap. This is only non-zero for heap regions.
+        inline UINT GetBaseOffset() const
+        {
+            return baseOffset_;
+        }
+
     private:
 
         ComPtr<ID3D12DescriptorHeap>    native_;
-        D3D12_DESCRIPTOR_HEAP_TYPE      type_   = D3D12_DESCRIPTOR_HEAP_TYPE_NUM_TYPES;
-        UINT                            size_   = 0;
-        UINT                            stride_ = 0;
+        D3D12_DESCRIPTOR_HEAP_TYPE      type_       = D3D12_DESCRIPTOR_HEAP_TYPE_NUM_TYPES;
+        UINT                            size_       = 0;
+        UINT                            stride_     = 0;
+        UINT                            baseOffset_ = 0;
 
 };
 
@@ -85,11 +85,22 @@ static DWORD NanosecsToMillisecs(UINT64 t)
         return static_cast<DWORD>((t + 999999) / 1000000);
 }
 
+std::uint64_t D3D12Fence::GetCompletedValue()
+{
+    return native_.GetCompletedValue();
+}
+
 UINT64 D3D12Fence::Signal()
 {
     return ++value_;
 }
 
+UINT64 D3D12Fence::Signal(UINT64 value)
+{
+    value_ = std::max(value_, value);
+    return value;
+}
+
 bool D3D12Fence::Wait(UINT64 timeout)
 {
     if (value_ > native_.GetCompletedValue())
@@ -100,6 +111,11 @@ bool D3D12Fence::Wait(UINT64 timeout)
     return true;
 }
 
+bool D3D12Fence::WaitValue(UINT64 value, UINT64 timeout)
+{
+    return native_.WaitForHigherSignal(value, NanosecsToMillisecs(timeout));
+}
+
 
 } // /namespace LLGL
 
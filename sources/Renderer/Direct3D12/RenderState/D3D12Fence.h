@@ -71,6 +71,9 @@ class D3D12Fence final : public Fence
 
         void SetDebugName(const char* name) override;
 
+        // Returns the completed value. Once the signal has completed, this value will be the same as the signaled value; See GetSignaledValue().
+        std::uint64_t GetCompletedValue() override;
+
     public:
 
         D3D12Fence(ID3D12Device* device, UINT64 initialValue = 0);
@@ -78,9 +81,15 @@ class D3D12Fence final : public Fence
         // Sets the next signal value.
         UINT64 Signal();
 
+        // Sets the specified timeline value as signal value. Values are expected to increase monotonically.
+        UINT64 Signal(UINT64 value);
+
         // Waits until the current signaled value is completed.
         bool Wait(UINT64 timeout);
 
+        // Waits until the specified timeline value or a higher value is completed.
+        bool WaitValue(UINT64 value, UINT64 timeout);
+
         // Returns the native ID3D12Fence object.
         inline ID3D12Fence* GetNative() const
         {
@@ -93,12 +102,6 @@ class D3D12Fence final : public Fence
             return value_;
         }
 
-        // Returns the completed value. Once the signal has completed, this value will be the same as the signaled value; See GetSignaledValue().
-        inline UINT64 GetCompletedValue() const
-        {
-            return native_.GetCompletedValue();
-        }
-
     private:
 
         D3D12NativeFence    native_;
@@ -39,7 +39,7 @@ D3D12GraphicsPSO::D3D12GraphicsPSO(
     const D3D12RenderPass*              defaultRenderPass,
     PipelineCache*                      pipelineCache)
 :
-    D3D12PipelineState { /*isGraphicsPSO:*/ true, desc.pipelineLayout, GetShadersAsArray(desc), defaultPipelineLayout }
+    D3D12PipelineState { /*isGraphicsPSO:*/ true, desc.pipelineLayout, GetShadersAsArray(desc), defaultPipelineLayout, desc.placeholder }
 {
     /* Validate pointers and get D3D shader program */
     if (desc.vertexShader == nullptr)
@@ -76,17 +76,21 @@ D3D12GraphicsPSO::D3D12GraphicsPSO(
     else
         pipelineLayoutD3D = &defaultPipelineLayout;
 
-    /* Create native graphics PSO */
-    if (pipelineCache != nullptr)
-    {
-        auto* pipelineCacheD3D = LLGL_CAST(D3D12PipelineCache*, pipelineCache);
-        CreateNativePSO(device, *pipelineLayoutD3D, renderPassD3D, desc, pipelineCacheD3D);
-    }
-    else
-        CreateNativePSO(device, *pipelineLayoutD3D, renderPassD3D, desc);
+    /* Create native graphics PSO; the descriptor is copied since it might be compiled asynchronously */
+    auto* pipelineCacheD3D = LLGL_CAST(D3D12PipelineCache*, pipelineCache);
+    CompileNativePSO(
+        [this, &device, pipelineLayoutD3D, renderPassD3D, desc, pipelineCacheD3D]()
+        {
+            CreateNativePSO(device, *pipelineLayoutD3D, renderPassD3D, desc, pipelineCacheD3D);
+        },
+        desc.debugName,
+        desc.asyncCompilation
+    );
+}
 
-    if (desc.debugName != nullptr)
-        SetDebugName(desc.debugName);
+D3D12GraphicsPSO::~D3D12GraphicsPSO()
+{
+    WaitForCompilation();
 }
 
 void D3D12GraphicsPSO::Bind(D3D12CommandContext& commandContext)
@@ -423,27 +427,22 @@ void D3D12GraphicsPSO::CreateNativePSO(
     stateDesc.SampleDesc.Count      = (renderPass != nullptr ? renderPass->GetSampleDesc().Count : 1);
     stateDesc.SampleDesc.Quality    = 0;
 
-    /* Set PSO cache if specified */
+    /* Create native PSO or load it from the PSO cache if specified */
     if (pipelineCache != nullptr)
-        stateDesc.CachedPSO = pipelineCache->GetCachedPSO();
-
-    /* Create native PSO */
-    ComPtr<ID3D12PipelineState> primaryPSO;
+        SetNative(pipelineCache->LoadOrCreateGraphicsPSO(device, D3D12PipelineCache::GetGraphicsPSOKey(stateDesc, GetRootSignatureHash()), stateDesc));
+    else
+        SetNative(device.CreateDXGraphicsPipelineState(stateDesc));
 
     if (isStripTopology && desc.indexFormat == Format::Undefined)
     {
-        /* Create primary PSO with 32-bit index cut off value */
-        primaryPSO = device.CreateDXGraphicsPipelineState(stateDesc);
-
-        /* Create secondary PSO with 16-bit index cut off value */
+        /* Create secondary PSO with 16-bit index cut off value; only a pipeline library can cache more than one PSO */
         stateDesc.IBStripCutValue   = D3D12_INDEX_BUFFER_STRIP_CUT_VALUE_0xFFFF;
         stateDesc.CachedPSO         = {};
-        secondaryPSO_ = device.CreateDXGraphicsPipelineState(stateDesc);
+        if (pipelineCache != nullptr && pipelineCache->HasPipelineLibrary())
+            secondaryPSO_ = pipelineCache->LoadOrCreateGraphicsPSO(device, D3D12PipelineCache::GetGraphicsPSOKey(stateDesc, GetRootSignatureHash()), stateDesc);
+        else
+            secondaryPSO_ = device.CreateDXGraphicsPipelineState(stateDesc);
     }
-    else
-        primaryPSO = device.CreateDXGraphicsPipelineState(stateDesc);
-
-    SetNativeAndUpdateCache(std::move(primaryPSO), pipelineCache);
 }
 
 // Returns the size (in bytes) for the static-state buffer with the specified number of viewports and scissor rectangles
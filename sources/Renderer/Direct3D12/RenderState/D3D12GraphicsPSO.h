@@ -39,6 +39,8 @@ class D3D12GraphicsPSO final : public D3D12PipelineState
             PipelineCache*                      pipelineCache           = nullptr
         );
 
+        ~D3D12GraphicsPSO();
+
         // Binds this graphics PSO to the specified command context.
         void Bind(D3D12CommandContext& commandContext) override;
 
@@ -6,19 +6,36 @@
  */
 
 #include "D3D12PipelineCache.h"
+#include "../D3D12Device.h"
+#include "../../DXCommon/DXCore.h"
+#include <LLGL/Container/DynamicArray.h>
+#include <cstring>
 
 
 namespace LLGL
 {
 
 
-D3D12PipelineCache::D3D12PipelineCache(const Blob& initialBlob) :
+D3D12PipelineCache::D3D12PipelineCache(ID3D12Device* device, const Blob& initialBlob) :
     initialBlob_ { initialBlob ? Blob::CreateCopy(initialBlob.GetData(), initialBlob.GetSize()) : Blob{} }
 {
+    CreatePipelineLibrary(device);
 }
 
 Blob D3D12PipelineCache::GetBlob() const
 {
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    if (library_)
+    {
+        /* Serialize entire pipeline library */
+        const SIZE_T size = library_->GetSerializedSize();
+        DynamicByteArray data{ static_cast<std::size_t>(size), UninitializeTag{} };
+        if (FAILED(library_->Serialize(data.get(), size)))
+            return Blob{};
+        return Blob::CreateStrongRef(std::move(data));
+    }
+
     /* Prefer native blob in case it has been updated after an initial blob was provided */
     if (nativeBlob_)
         return Blob::CreateCopy(nativeBlob_->GetBufferPointer(), nativeBlob_->GetBufferSize());
@@ -28,12 +45,312 @@ Blob D3D12PipelineCache::GetBlob() const
         return Blob{};
 }
 
-D3D12_CACHED_PIPELINE_STATE D3D12PipelineCache::GetCachedPSO() const
+// Maximum number of characters for PSO names: "LLGL.PSO." + 16 hex digits + null terminator
+static constexpr std::size_t g_maxPSONameLength = 26;
+
+// Writes the name for the specified PSO key into the output string
+static void GetPSOName(std::uint64_t key, wchar_t (&outName)[g_maxPSONameLength])
+{
+    static const wchar_t prefix[] = L"LLGL.PSO.";
+    static const wchar_t hexDigits[] = L"0123456789ABCDEF";
+
+    std::size_t pos = 0;
+    for (const wchar_t* c = prefix; *c != L'\0'; ++c)
+        outName[pos++] = *c;
+
+    for (int shift = 60; shift >= 0; shift -= 4)
+        outName[pos++] = hexDigits[(key >> shift) & 0xF];
+
+    outName[pos] = L'\0';
+}
+
+ComPtr<ID3D12PipelineState> D3D12PipelineCache::LoadOrCreateGraphicsPSO(
+    D3D12Device&                        device,
+    std::uint64_t                       key,
+    D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc)
+{
+    if (!library_)
+    {
+        /* Fall back to single cached PSO blob */
+        ComPtr<ID3DBlob> cachedBlobRef;
+        desc.CachedPSO = GetCachedPSO(cachedBlobRef);
+        ComPtr<ID3D12PipelineState> pipelineState = device.CreateDXGraphicsPipelineState(desc);
+        UpdateCachedBlob(pipelineState.Get());
+        return pipelineState;
+    }
+
+    /* Try to load PSO from pipeline library first */
+    wchar_t name[g_maxPSONameLength];
+    GetPSOName(key, name);
+
+    ComPtr<ID3D12PipelineState> pipelineState;
+    if (SUCCEEDED(library_->LoadGraphicsPipeline(name, &desc, IID_PPV_ARGS(pipelineState.GetAddressOf()))))
+        return pipelineState;
+
+    /* Create new PSO and store it in pipeline library */
+    pipelineState = device.CreateDXGraphicsPipelineState(desc);
+    StorePSO(name, pipelineState.Get());
+    return pipelineState;
+}
+
+ComPtr<ID3D12PipelineState> D3D12PipelineCache::LoadOrCreateComputePSO(
+    D3D12Device&                        device,
+    std::uint64_t                       key,
+    D3D12_COMPUTE_PIPELINE_STATE_DESC&  desc)
+{
+    if (!library_)
+    {
+        /* Fall back to single cached PSO blob */
+        ComPtr<ID3DBlob> cachedBlobRef;
+        desc.CachedPSO = GetCachedPSO(cachedBlobRef);
+        ComPtr<ID3D12PipelineState> pipelineState = device.CreateDXComputePipelineState(desc);
+        UpdateCachedBlob(pipelineState.Get());
+        return pipelineState;
+    }
+
+    /* Try to load PSO from pipeline library first */
+    wchar_t name[g_maxPSONameLength];
+    GetPSOName(key, name);
+
+    ComPtr<ID3D12PipelineState> pipelineState;
+    if (SUCCEEDED(library_->LoadComputePipeline(name, &desc, IID_PPV_ARGS(pipelineState.GetAddressOf()))))
+        return pipelineState;
+
+    /* Create new PSO and store it in pipeline library */
+    pipelineState = device.CreateDXComputePipelineState(desc);
+    StorePSO(name, pipelineState.Get());
+    return pipelineState;
+}
+
+// 64-bit FNV-1a hash to build the keys of PSOs in the pipeline library
+class PSOKeyHasher
+{
+
+    public:
+
+        PSOKeyHasher(std::uint64_t seed = 0xCBF29CE484222325ull) :
+            hash_ { seed }
+        {
+        }
+
+        void AppendBytes(const void* data, std::size_t size)
+        {
+            const std::uint8_t* bytes = static_cast<const std::uint8_t*>(data);
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                hash_ ^= bytes[i];
+                hash_ *= 0x100000001B3ull;
+            }
+        }
+
+        // Appends a scalar value. Must not be used for structs with padding.
+        template <typename T>
+        void Append(const T& value)
+        {
+            AppendBytes(&value, sizeof(value));
+        }
+
+        void AppendString(const char* s)
+        {
+            if (s != nullptr)
+                AppendBytes(s, std::strlen(s) + 1);
+            else
+                Append('\0');
+        }
+
+        void AppendByteCode(const D3D12_SHADER_BYTECODE& byteCode)
+        {
+            Append(byteCode.BytecodeLength);
+            AppendBytes(byteCode.pShaderBytecode, byteCode.BytecodeLength);
+        }
+
+        std::uint64_t Get() const
+        {
+            return hash_;
+        }
+
+    private:
+
+        std::uint64_t hash_;
+
+};
+
+std::uint64_t D3D12PipelineCache::GetRootSignatureHash(ID3DBlob* serializedBlob)
+{
+    PSOKeyHasher hasher;
+    if (serializedBlob != nullptr)
+        hasher.AppendBytes(serializedBlob->GetBufferPointer(), serializedBlob->GetBufferSize());
+    return hasher.Get();
+}
+
+static void HashStreamOutputDesc(PSOKeyHasher& hasher, const D3D12_STREAM_OUTPUT_DESC& desc)
 {
+    hasher.Append(desc.NumEntries);
+    for (UINT i = 0; i < desc.NumEntries; ++i)
+    {
+        const D3D12_SO_DECLARATION_ENTRY& entry = desc.pSODeclaration[i];
+        hasher.Append(entry.Stream);
+        hasher.AppendString(entry.SemanticName);
+        hasher.Append(entry.SemanticIndex);
+        hasher.Append(entry.StartComponent);
+        hasher.Append(entry.ComponentCount);
+        hasher.Append(entry.OutputSlot);
+    }
+    hasher.Append(desc.NumStrides);
+    hasher.AppendBytes(desc.pBufferStrides, sizeof(UINT) * desc.NumStrides);
+    hasher.Append(desc.RasterizedStream);
+}
+
+static void HashBlendDesc(PSOKeyHasher& hasher, const D3D12_BLEND_DESC& desc)
+{
+    hasher.Append(desc.AlphaToCoverageEnable);
+    hasher.Append(desc.IndependentBlendEnable);
+    for (const D3D12_RENDER_TARGET_BLEND_DESC& target : desc.RenderTarget)
+    {
+        hasher.Append(target.BlendEnable);
+        hasher.Append(target.LogicOpEnable);
+        hasher.Append(target.SrcBlend);
+        hasher.Append(target.DestBlend);
+        hasher.Append(target.BlendOp);
+        hasher.Append(target.SrcBlendAlpha);
+        hasher.Append(target.DestBlendAlpha);
+        hasher.Append(target.BlendOpAlpha);
+        hasher.Append(target.LogicOp);
+        hasher.Append(target.RenderTargetWriteMask);
+    }
+}
+
+static void HashRasterizerDesc(PSOKeyHasher& hasher, const D3D12_RASTERIZER_DESC& desc)
+{
+    hasher.Append(desc.FillMode);
+    hasher.Append(desc.CullMode);
+    hasher.Append(desc.FrontCounterClockwise);
+    hasher.Append(desc.DepthBias);
+    hasher.Append(desc.DepthBiasClamp);
+    hasher.Append(desc.SlopeScaledDepthBias);
+    hasher.Append(desc.DepthClipEnable);
+    hasher.Append(desc.MultisampleEnable);
+    hasher.Append(desc.AntialiasedLineEnable);
+    hasher.Append(desc.ForcedSampleCount);
+    hasher.Append(desc.ConservativeRaster);
+}
+
+static void HashStencilOpDesc(PSOKeyHasher& hasher, const D3D12_DEPTH_STENCILOP_DESC& desc)
+{
+    hasher.Append(desc.StencilFailOp);
+    hasher.Append(desc.StencilDepthFailOp);
+    hasher.Append(desc.StencilPassOp);
+    hasher.Append(desc.StencilFunc);
+}
+
+static void HashDepthStencilDesc(PSOKeyHasher& hasher, const D3D12_DEPTH_STENCIL_DESC& desc)
+{
+    hasher.Append(desc.DepthEnable);
+    hasher.Append(desc.DepthWriteMask);
+    hasher.Append(desc.DepthFunc);
+    hasher.Append(desc.StencilEnable);
+    hasher.Append(desc.StencilReadMask);
+    hasher.Append(desc.StencilWriteMask);
+    HashStencilOpDesc(hasher, desc.FrontFace);
+    HashStencilOpDesc(hasher, desc.BackFace);
+}
+
+static void HashInputLayoutDesc(PSOKeyHasher& hasher, const D3D12_INPUT_LAYOUT_DESC& desc)
+{
+    hasher.Append(desc.NumElements);
+    for (UINT i = 0; i < desc.NumElements; ++i)
+    {
+        const D3D12_INPUT_ELEMENT_DESC& element = desc.pInputElementDescs[i];
+        hasher.AppendString(element.SemanticName);
+        hasher.Append(element.SemanticIndex);
+        hasher.Append(element.Format);
+        hasher.Append(element.InputSlot);
+        hasher.Append(element.AlignedByteOffset);
+        hasher.Append(element.InputSlotClass);
+        hasher.Append(element.InstanceDataStepRate);
+    }
+}
+
+std::uint64_t D3D12PipelineCache::GetGraphicsPSOKey(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc, std::uint64_t rootSignatureHash)
+{
+    /* Hash all fields individually to avoid hashing padding bytes, and hash content instead of pointers */
+    PSOKeyHasher hasher{ rootSignatureHash };
+    hasher.AppendByteCode(desc.VS);
+    hasher.AppendByteCode(desc.PS);
+    hasher.AppendByteCode(desc.DS);
+    hasher.AppendByteCode(desc.HS);
+    hasher.AppendByteCode(desc.GS);
+    HashStreamOutputDesc(hasher, desc.StreamOutput);
+    HashBlendDesc(hasher, desc.BlendState);
+    hasher.Append(desc.SampleMask);
+    HashRasterizerDesc(hasher, desc.RasterizerState);
+    HashDepthStencilDesc(hasher, desc.DepthStencilState);
+    HashInputLayoutDesc(hasher, desc.InputLayout);
+    hasher.Append(desc.IBStripCutValue);
+    hasher.Append(desc.PrimitiveTopologyType);
+    hasher.Append(desc.NumRenderTargets);
+    for (DXGI_FORMAT format : desc.RTVFormats)
+        hasher.Append(format);
+    hasher.Append(desc.DSVFormat);
+    hasher.Append(desc.SampleDesc.Count);
+    hasher.Append(desc.SampleDesc.Quality);
+    hasher.Append(desc.NodeMask);
+    hasher.Append(desc.Flags);
+    return hasher.Get();
+}
+
+std::uint64_t D3D12PipelineCache::GetComputePSOKey(const D3D12_COMPUTE_PIPELINE_STATE_DESC& desc, std::uint64_t rootSignatureHash)
+{
+    PSOKeyHasher hasher{ rootSignatureHash };
+    hasher.AppendByteCode(desc.CS);
+    hasher.Append(desc.NodeMask);
+    hasher.Append(desc.Flags);
+    return hasher.Get();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void D3D12PipelineCache::CreatePipelineLibrary(ID3D12Device* device)
+{
+    /* Pipeline libraries require ID3D12Device1 and driver support */
+    ComPtr<ID3D12Device1> device1;
+    if (FAILED(device->QueryInterface(IID_PPV_ARGS(device1.GetAddressOf()))))
+        return;
+
+    D3D12_FEATURE_DATA_SHADER_CACHE shaderCacheSupport = {};
+    if (FAILED(device->CheckFeatureSupport(D3D12_FEATURE_SHADER_CACHE, &shaderCacheSupport, sizeof(shaderCacheSupport))))
+        return;
+    if ((shaderCacheSupport.SupportFlags & D3D12_SHADER_CACHE_SUPPORT_LIBRARY) == 0)
+        return;
+
+    /* Try to deserialize pipeline library from initial blob; it must remain valid for the lifetime of the library */
+    if (initialBlob_)
+    {
+        HRESULT hr = device1->CreatePipelineLibrary(initialBlob_.GetData(), initialBlob_.GetSize(), IID_PPV_ARGS(library_.ReleaseAndGetAddressOf()));
+        if (SUCCEEDED(hr))
+            return;
+
+        /* Discard initial blob if it was created by a different driver or adapter or is corrupted */
+        initialBlob_ = Blob{};
+    }
+
+    /* Create empty pipeline library */
+    if (FAILED(device1->CreatePipelineLibrary(nullptr, 0, IID_PPV_ARGS(library_.ReleaseAndGetAddressOf()))))
+        library_.Reset();
+}
+
+D3D12_CACHED_PIPELINE_STATE D3D12PipelineCache::GetCachedPSO(ComPtr<ID3DBlob>& outBlobRef) const
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
     /* Prefer native blob in case it has been updated after an initial blob was provided */
     D3D12_CACHED_PIPELINE_STATE cachedState = {};
     if (nativeBlob_)
     {
+        outBlobRef                          = nativeBlob_;
         cachedState.pCachedBlob             = nativeBlob_->GetBufferPointer();
         cachedState.CachedBlobSizeInBytes   = nativeBlob_->GetBufferSize();
     }
@@ -45,6 +362,30 @@ D3D12_CACHED_PIPELINE_STATE D3D12PipelineCache::GetCachedPSO() const
     return cachedState;
 }
 
+void D3D12PipelineCache::UpdateCachedBlob(ID3D12PipelineState* pipelineState)
+{
+    /* Get cached PSO if not initialized */
+    if (!initialBlob_)
+    {
+        ComPtr<ID3DBlob> cachedBlob;
+        HRESULT hr = pipelineState->GetCachedBlob(cachedBlob.GetAddressOf());
+        DXThrowIfFailed(hr, "failed to retrieve cached blob from ID3D12PipelineState");
+
+        std::lock_guard<std::mutex> guard{ mutex_ };
+        nativeBlob_ = std::move(cachedBlob);
+    }
+}
+
+void D3D12PipelineCache::StorePSO(const wchar_t* name, ID3D12PipelineState* pipelineState)
+{
+    /*
+    Storing a PSO fails with E_INVALIDARG if the name already exists,
+    e.g. when another thread stored the same PSO in the meantime or on a key collision. The PSO is still valid in that case.
+    */
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    library_->StorePipeline(name, pipelineState);
+}
+
 
 } // /namespace LLGL
 
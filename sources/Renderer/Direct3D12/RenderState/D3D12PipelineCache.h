@@ -12,49 +12,83 @@
 #include <LLGL/PipelineCache.h>
 #include <d3d12.h>
 #include "../../DXCommon/ComPtr.h"
+#include <cstdint>
+#include <mutex>
 
 
 namespace LLGL
 {
 
 
+class D3D12Device;
+
+/*
+Pipeline cache that is backed by an ID3D12PipelineLibrary1 if the driver supports it.
+PSOs are stored in the library by a key that is derived from their native descriptor (see GetGraphicsPSOKey and GetComputePSOKey).
+If pipeline libraries are not supported, this falls back to a single cached PSO blob.
+*/
 class D3D12PipelineCache final : public PipelineCache
 {
 
     public:
 
-        D3D12PipelineCache() = default;
-
-        // Initializes the pipeline cache with the specified initial blob.
-        D3D12PipelineCache(const Blob& initialBlob);
+        // Initializes the pipeline cache with the specified initial blob. Blobs from a different driver or adapter are discarded.
+        D3D12PipelineCache(ID3D12Device* device, const Blob& initialBlob = {});
 
         Blob GetBlob() const override;
 
     public:
 
-        inline void SetNativeBlob(const ComPtr<ID3DBlob>& blob)
+        // Loads the specified graphics PSO from the pipeline library or creates it and stores it in the library.
+        ComPtr<ID3D12PipelineState> LoadOrCreateGraphicsPSO(
+            D3D12Device&                        device,
+            std::uint64_t                       key,
+            D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc
+        );
+
+        // Loads the specified compute PSO from the pipeline library or creates it and stores it in the library.
+        ComPtr<ID3D12PipelineState> LoadOrCreateComputePSO(
+            D3D12Device&                        device,
+            std::uint64_t                       key,
+            D3D12_COMPUTE_PIPELINE_STATE_DESC&  desc
+        );
+
+        // Returns true if this pipeline cache is backed by a native pipeline library.
+        inline bool HasPipelineLibrary() const
         {
-            nativeBlob_ = blob;
+            return (library_.Get() != nullptr);
         }
 
-        inline void SetNativeBlob(ComPtr<ID3DBlob>&& blob)
-        {
-            nativeBlob_ = std::forward<ComPtr<ID3DBlob>>(blob);
-        }
+    public:
 
-        // Returns true if this pipeline cache has an initial blob.
-        inline bool HasInitialBlob() const
-        {
-            return bool(initialBlob_);
-        }
+        // Returns a 64-bit hash of the specified serialized root signature. This is used as seed for the PSO keys.
+        static std::uint64_t GetRootSignatureHash(ID3DBlob* serializedBlob);
+
+        // Returns the key of the specified graphics PSO that is used to identify it in the pipeline library.
+        static std::uint64_t GetGraphicsPSOKey(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc, std::uint64_t rootSignatureHash);
+
+        // Returns the key of the specified compute PSO that is used to identify it in the pipeline library.
+        static std::uint64_t GetComputePSOKey(const D3D12_COMPUTE_PIPELINE_STATE_DESC& desc, std::uint64_t rootSignatureHash);
+
+    private:
+
+        void CreatePipelineLibrary(ID3D12Device* device);
+
+        // Returns the cached PSO descriptor and a reference to the blob it points to.
+        D3D12_CACHED_PIPELINE_STATE GetCachedPSO(ComPtr<ID3DBlob>& outBlobRef) const;
+
+        // Stores the cached blob of the specified PSO unless this cache has been initialized with a blob.
+        void UpdateCachedBlob(ID3D12PipelineState* pipelineState);
 
-        // Returns the cached PSO blob.
-        D3D12_CACHED_PIPELINE_STATE GetCachedPSO() const;
+        // Stores the specified PSO in the pipeline library.
+        void StorePSO(const wchar_t* name, ID3D12PipelineState* pipelineState);
 
     private:
 
-        Blob                initialBlob_;
-        ComPtr<ID3DBlob>    nativeBlob_;
+        Blob                            initialBlob_;
+        ComPtr<ID3DBlob>                nativeBlob_;
+        ComPtr<ID3D12PipelineLibrary1>  library_;
+        mutable std::mutex              mutex_;         // Guards 'nativeBlob_' and store/serialize operations of 'library_'.
 
 };
 
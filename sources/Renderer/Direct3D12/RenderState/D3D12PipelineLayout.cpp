@@ -31,10 +31,10 @@ D3D12PipelineLayout::D3D12PipelineLayout()
     rootParameterIndices_.rootParamDescriptors[1]       = D3D12RootParameterIndices::invalidIndex;
 }
 
-D3D12PipelineLayout::D3D12PipelineLayout(ID3D12Device* device, const PipelineLayoutDescriptor& desc) :
+D3D12PipelineLayout::D3D12PipelineLayout(ID3D12Device* device, const PipelineLayoutDescriptor& desc, bool directlyIndexedHeaps) :
     D3D12PipelineLayout {}
 {
-    CreateRootSignature(device, desc);
+    CreateRootSignature(device, desc, directlyIndexedHeaps);
     if (desc.debugName != nullptr)
         SetDebugName(desc.debugName);
 }
@@ -64,7 +64,13 @@ std::uint32_t D3D12PipelineLayout::GetNumUniforms() const
     return static_cast<std::uint32_t>(uniforms_.size());
 }
 
-static D3D12_ROOT_SIGNATURE_FLAGS GetD3DRootSignatureFlags(long convolutedStageFlags)
+/*
+Root signature flags D3D12_ROOT_SIGNATURE_FLAG_CBV_SRV_UAV_HEAP_DIRECTLY_INDEXED and D3D12_ROOT_SIGNATURE_FLAG_SAMPLER_HEAP_DIRECTLY_INDEXED for HLSL Shader Model 6.6.
+Declared by value to not require Windows SDK 10.0.20348 or later.
+*/
+static constexpr UINT g_rootSignatureFlagsHeapDirectlyIndexed = (0x400 | 0x800);
+
+static D3D12_ROOT_SIGNATURE_FLAGS GetD3DRootSignatureFlags(long convolutedStageFlags, bool directlyIndexedHeaps)
 {
     D3D12_ROOT_SIGNATURE_FLAGS signatureFlags = D3D12_ROOT_SIGNATURE_FLAG_NONE;
 
@@ -72,6 +78,10 @@ static D3D12_ROOT_SIGNATURE_FLAGS GetD3DRootSignatureFlags(long convolutedStageF
     signatureFlags |= D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT;
     signatureFlags |= D3D12_ROOT_SIGNATURE_FLAG_ALLOW_STREAM_OUTPUT;
 
+    /* Allow shaders to index the bindless descriptor heaps */
+    if (directlyIndexedHeaps)
+        signatureFlags |= static_cast<D3D12_ROOT_SIGNATURE_FLAGS>(g_rootSignatureFlagsHeapDirectlyIndexed);
+
     /* Deny access to root signature for shader stages that are not affected by any binding point */
     if ((convolutedStageFlags & StageFlags::VertexStage) == 0)
         signatureFlags |= D3D12_ROOT_SIGNATURE_FLAG_DENY_VERTEX_SHADER_ROOT_ACCESS;
@@ -104,10 +114,11 @@ static long ConvoluteLayoutStageFlags(const PipelineLayoutDescriptor& desc)
     return convolutedStageFlags;
 }
 
-void D3D12PipelineLayout::CreateRootSignature(ID3D12Device* device, const PipelineLayoutDescriptor& desc)
+void D3D12PipelineLayout::CreateRootSignature(ID3D12Device* device, const PipelineLayoutDescriptor& desc, bool directlyIndexedHeaps)
 {
     /* Keep pointer to D3D12 device */
-    device_ = device;
+    device_                 = device;
+    directlyIndexedHeaps_   = directlyIndexedHeaps;
 
     /* Convolute all stage flags */
     convolutedStageFlags_ = ConvoluteLayoutStageFlags(desc);
@@ -121,7 +132,7 @@ void D3D12PipelineLayout::CreateRootSignature(ID3D12Device* device, const Pipeli
     /* Finalize root signature if there is no permutation needed */
     if (!NeedsRootConstantPermutation())
     {
-        finalizedRootSignature_ = rootSignature_->Finalize(device, GetD3DRootSignatureFlags(GetConvolutedStageFlags()), &serializedBlob_);
+        finalizedRootSignature_ = rootSignature_->Finalize(device, GetD3DRootSignatureFlags(GetConvolutedStageFlags(), directlyIndexedHeaps_), &serializedBlob_);
         rootSignature_.reset();
     }
 }
@@ -209,7 +220,7 @@ ComPtr<ID3D12RootSignature> D3D12PipelineLayout::CreateRootSignatureWith32BitCon
     }
 
     /* Finalize permutated root signature */
-    return rootSignaturePermutation.Finalize(device_, GetD3DRootSignatureFlags(GetConvolutedStageFlags()));
+    return rootSignaturePermutation.Finalize(device_, GetD3DRootSignatureFlags(GetConvolutedStageFlags(), directlyIndexedHeaps_));
 }
 
 D3D12DescriptorHeapSetLayout D3D12PipelineLayout::GetDescriptorHeapSetLayout() const
@@ -233,10 +244,13 @@ void D3D12PipelineLayout::BuildRootSignature(
     D3D12RootSignature&             rootSignature,
     const PipelineLayoutDescriptor& desc)
 {
+    /* Acceleration structures are bound as buffer SRVs */
+    const long bufferSRVFlags = (BindFlags::Sampled | BindFlags::AccelerationStructure);
+
     /* Build root parameter table for each descriptor range type */
     descriptorHeapMap_.resize(desc.heapBindings.size());
     BuildHeapRootParameterTables(rootSignature, D3D12_DESCRIPTOR_RANGE_TYPE_CBV,     desc, ResourceType::Buffer,  BindFlags::ConstantBuffer, descriptorHeapLayout_.numBufferCBV );
-    BuildHeapRootParameterTables(rootSignature, D3D12_DESCRIPTOR_RANGE_TYPE_SRV,     desc, ResourceType::Buffer,  BindFlags::Sampled,        descriptorHeapLayout_.numBufferSRV );
+    BuildHeapRootParameterTables(rootSignature, D3D12_DESCRIPTOR_RANGE_TYPE_SRV,     desc, ResourceType::Buffer,  bufferSRVFlags,            descriptorHeapLayout_.numBufferSRV );
     BuildHeapRootParameterTables(rootSignature, D3D12_DESCRIPTOR_RANGE_TYPE_SRV,     desc, ResourceType::Texture, BindFlags::Sampled,        descriptorHeapLayout_.numTextureSRV);
     BuildHeapRootParameterTables(rootSignature, D3D12_DESCRIPTOR_RANGE_TYPE_UAV,     desc, ResourceType::Buffer,  BindFlags::Storage,        descriptorHeapLayout_.numBufferUAV );
     BuildHeapRootParameterTables(rootSignature, D3D12_DESCRIPTOR_RANGE_TYPE_UAV,     desc, ResourceType::Texture, BindFlags::Storage,        descriptorHeapLayout_.numTextureUAV);
@@ -245,7 +259,7 @@ void D3D12PipelineLayout::BuildRootSignature(
     /* Build root parameter for each descriptor range type */
     descriptorMap_.resize(desc.bindings.size());
     BuildRootParameterTables(rootSignature, D3D12_DESCRIPTOR_RANGE_TYPE_CBV,     desc, ResourceType::Buffer,  BindFlags::ConstantBuffer, descriptorLayout_.numBufferCBV);
-    BuildRootParameterTables(rootSignature, D3D12_DESCRIPTOR_RANGE_TYPE_SRV,     desc, ResourceType::Buffer,  BindFlags::Sampled,        descriptorLayout_.numBufferSRV);
+    BuildRootParameterTables(rootSignature, D3D12_DESCRIPTOR_RANGE_TYPE_SRV,     desc, ResourceType::Buffer,  bufferSRVFlags,            descriptorLayout_.numBufferSRV);
     BuildRootParameterTables(rootSignature, D3D12_DESCRIPTOR_RANGE_TYPE_SRV,     desc, ResourceType::Texture, BindFlags::Sampled,        descriptorLayout_.numTextureSRV);
     BuildRootParameterTables(rootSignature, D3D12_DESCRIPTOR_RANGE_TYPE_UAV,     desc, ResourceType::Buffer,  BindFlags::Storage,        descriptorLayout_.numBufferUAV);
     BuildRootParameterTables(rootSignature, D3D12_DESCRIPTOR_RANGE_TYPE_UAV,     desc, ResourceType::Texture, BindFlags::Storage,        descriptorLayout_.numTextureUAV);
@@ -254,7 +268,7 @@ void D3D12PipelineLayout::BuildRootSignature(
     /* Build root parameter for each standalone descriptor */
     rootParameterMap_.resize(desc.bindings.size());
     BuildRootParameters(rootSignature, D3D12_ROOT_PARAMETER_TYPE_CBV, desc, ResourceType::Buffer, BindFlags::ConstantBuffer);
-    BuildRootParameters(rootSignature, D3D12_ROOT_PARAMETER_TYPE_SRV, desc, ResourceType::Buffer, BindFlags::Sampled);
+    BuildRootParameters(rootSignature, D3D12_ROOT_PARAMETER_TYPE_SRV, desc, ResourceType::Buffer, bufferSRVFlags);
     BuildRootParameters(rootSignature, D3D12_ROOT_PARAMETER_TYPE_UAV, desc, ResourceType::Buffer, BindFlags::Storage);
 
     /* Build static samplers */
@@ -309,6 +323,7 @@ void D3D12PipelineLayout::BuildHeapRootParameterTableEntry(
     UINT                            maxNumDescriptorRanges,
     D3D12DescriptorHeapLocation&    outLocation)
 {
+    /* Resource heaps can be written with RenderSystem::WriteResourceHeap after they have been bound, so descriptors and data are volatile (default) */
     if (auto rootParam = rootSignature.FindCompatibleRootParameter(descRangeType))
     {
         /* Append descriptor range to previous root parameter */
@@ -377,6 +392,22 @@ static UINT GetRootParameterIndexAfterHeapResources(const D3D12RootParameterIndi
     );
 }
 
+/*
+Returns the descriptor range flags for root signature version 1.1 of the specified dynamic binding.
+Dynamic descriptors are copied into a new range of the staging descriptor heap whenever a binding changes (see D3D12DescriptorCache),
+so they never change after their table has been set, i.e. they are static.
+Texture SRVs can only be written after a transition out of the shader resource state, so their data is static while set at execution.
+Buffers can be updated in place between draw calls (see CommandBuffer::UpdateBuffer) and UAVs are written by shaders, so their data is volatile.
+*/
+static D3D12_DESCRIPTOR_RANGE_FLAGS GetDynamicDescriptorRangeFlags(D3D12_DESCRIPTOR_RANGE_TYPE descRangeType, const BindingDescriptor& bindingDesc)
+{
+    if (descRangeType == D3D12_DESCRIPTOR_RANGE_TYPE_SAMPLER)
+        return D3D12_DESCRIPTOR_RANGE_FLAG_NONE;
+    if (descRangeType == D3D12_DESCRIPTOR_RANGE_TYPE_SRV && bindingDesc.type == ResourceType::Texture)
+        return D3D12_DESCRIPTOR_RANGE_FLAG_DATA_STATIC_WHILE_SET_AT_EXECUTE;
+    return D3D12_DESCRIPTOR_RANGE_FLAG_DATA_VOLATILE;
+}
+
 void D3D12PipelineLayout::BuildRootParameterTableEntry(
     D3D12RootSignature&             rootSignature,
     D3D12_DESCRIPTOR_RANGE_TYPE     descRangeType,
@@ -386,10 +417,11 @@ void D3D12PipelineLayout::BuildRootParameterTableEntry(
 {
     /* Find compatible root parameter after root parameter for heap resources */
     const auto rootParamOffset = GetRootParameterIndexAfterHeapResources(rootParameterIndices_);
+    const D3D12_DESCRIPTOR_RANGE_FLAGS rangeFlags = GetDynamicDescriptorRangeFlags(descRangeType, bindingDesc);
     if (auto rootParam = rootSignature.FindCompatibleRootParameter(descRangeType, rootParamOffset))
     {
         /* Append descriptor range to previous root parameter */
-        rootParam->AppendDescriptorTableRange(descRangeType, bindingDesc.slot, std::max(1u, bindingDesc.arraySize));
+        rootParam->AppendDescriptorTableRange(descRangeType, bindingDesc.slot, std::max(1u, bindingDesc.arraySize), rangeFlags);
     }
     else
     {
@@ -397,7 +429,7 @@ void D3D12PipelineLayout::BuildRootParameterTableEntry(
         UINT rootParamIndex = 0;
         rootParam = rootSignature.AppendRootParameter(&rootParamIndex);
         rootParam->InitAsDescriptorTable(maxNumDescriptorRanges);
-        rootParam->AppendDescriptorTableRange(descRangeType, bindingDesc.slot, std::max(1u, bindingDesc.arraySize));
+        rootParam->AppendDescriptorTableRange(descRangeType, bindingDesc.slot, std::max(1u, bindingDesc.arraySize), rangeFlags);
 
         /* Store root parameter index */
         UINT8& rootParamIndexStored = rootParameterIndices_.rootParamDescriptors[GetDescriptorTypeShift(descRangeType)];
@@ -119,9 +119,10 @@ class D3D12PipelineLayout final : public PipelineLayout
     public:
 
         D3D12PipelineLayout();
-        D3D12PipelineLayout(ID3D12Device* device, const PipelineLayoutDescriptor& desc);
+        D3D12PipelineLayout(ID3D12Device* device, const PipelineLayoutDescriptor& desc, bool directlyIndexedHeaps = false);
 
-        void CreateRootSignature(ID3D12Device* device, const PipelineLayoutDescriptor& desc);
+        // Creates the root signature. If 'directlyIndexedHeaps' is true, shaders can access the bound descriptor heaps via ResourceDescriptorHeap and SamplerDescriptorHeap.
+        void CreateRootSignature(ID3D12Device* device, const PipelineLayoutDescriptor& desc, bool directlyIndexedHeaps = false);
         void ReleaseRootSignature();
 
         /*
@@ -275,6 +276,7 @@ class D3D12PipelineLayout final : public PipelineLayout
         UINT                                        numStaticSamplers_      = 0;
         D3D12RootParameterIndices                   rootParameterIndices_;
         long                                        convolutedStageFlags_   = 0;
+        bool                                        directlyIndexedHeaps_   = false;
 
         std::vector<UniformDescriptor>              uniforms_;
 
@@ -25,9 +25,11 @@ D3D12PipelineState::D3D12PipelineState(
     bool                        isGraphicsPSO,
     const PipelineLayout*       pipelineLayout,
     const ArrayView<Shader*>&   shaders,
-    D3D12PipelineLayout&        defaultPipelineLayout)
+    D3D12PipelineLayout&        defaultPipelineLayout,
+    PipelineState*              placeholder)
 :
-    isGraphicsPSO_ { isGraphicsPSO }
+    isGraphicsPSO_ { isGraphicsPSO                                },
+    placeholder_   { LLGL_CAST(D3D12PipelineState*, placeholder) }
 {
     if (pipelineLayout != nullptr)
     {
@@ -38,37 +40,90 @@ D3D12PipelineState::D3D12PipelineState(
             rootSignature_ = pipelineLayout_->CreateRootSignatureWith32BitConstants(CastShaderArray<D3D12Shader>(shaders), rootConstantMap_);
         else
             rootSignature_ = pipelineLayout_->GetFinalizedRootSignature();
+
+        /* Root constant permutations are derived from the layout and the shaders, so the hash of the original root signature is sufficient */
+        rootSignatureHash_ = D3D12PipelineCache::GetRootSignatureHash(pipelineLayout_->GetSerializedBlob());
     }
     else
     {
         /* Create pipeline state with default root signature */
-        rootSignature_ = defaultPipelineLayout.GetFinalizedRootSignature();
+        rootSignature_      = defaultPipelineLayout.GetFinalizedRootSignature();
+        rootSignatureHash_  = D3D12PipelineCache::GetRootSignatureHash(defaultPipelineLayout.GetSerializedBlob());
     }
 }
 
 void D3D12PipelineState::SetDebugName(const char* name)
 {
+    compileTask_.Wait();
     D3D12SetObjectName(native_.Get(), name);
 }
 
 const Report* D3D12PipelineState::GetReport() const
 {
+    compileTask_.Wait();
     return (*report_.GetText() != '\0' || report_.HasErrors() ? &report_ : nullptr);
 }
 
-void D3D12PipelineState::SetNativeAndUpdateCache(ComPtr<ID3D12PipelineState>&& native, D3D12PipelineCache* pipelineCache)
+bool D3D12PipelineState::IsReady() const
+{
+    return compileTask_.IsReady();
+}
+
+D3D12PipelineState& D3D12PipelineState::GetReadyPSO()
+{
+    if (!compileTask_.IsReady())
+    {
+        if (placeholder_ != nullptr)
+            return placeholder_->GetReadyPSO();
+        compileTask_.Wait();
+    }
+
+    /* Fall back to placeholder if asynchronous compilation failed */
+    if (!native_ && placeholder_ != nullptr)
+        return placeholder_->GetReadyPSO();
+
+    return *this;
+}
+
+void D3D12PipelineState::SetNative(ComPtr<ID3D12PipelineState>&& native)
 {
-    /* Store native pipeline state */
     native_ = std::move(native);
+}
 
-    /* Get cached PSO if specified but not initialized */
-    if (pipelineCache != nullptr && !pipelineCache->HasInitialBlob())
+void D3D12PipelineState::CompileNativePSO(const std::function<void()>& compileFunc, const char* debugName, bool async)
+{
+    if (async)
     {
-        ComPtr<ID3DBlob> cachedBlob;
-        HRESULT hr = native_->GetCachedBlob(cachedBlob.GetAddressOf());
-        DXThrowIfFailed(hr, "failed to retrieve cached blob from ID3D12PipelineState");
-        pipelineCache->SetNativeBlob(std::move(cachedBlob));
+        /* Copy debug name as the descriptor is out of scope when the task is run */
+        const std::string name = (debugName != nullptr ? debugName : "");
+        compileTask_.Start(
+            [this, compileFunc, name]()
+            {
+                try
+                {
+                    compileFunc();
+                    if (!name.empty())
+                        D3D12SetObjectName(native_.Get(), name.c_str());
+                }
+                catch (const std::exception& e)
+                {
+                    ResetReport(e.what(), true);
+                }
+            },
+            true
+        );
     }
+    else
+    {
+        compileFunc();
+        if (debugName != nullptr)
+            D3D12SetObjectName(native_.Get(), debugName);
+    }
+}
+
+void D3D12PipelineState::WaitForCompilation()
+{
+    compileTask_.Wait();
 }
 
 void D3D12PipelineState::ResetReport(std::string&& text, bool hasErrors)
@@ -15,8 +15,11 @@
 #include <LLGL/Report.h>
 #include "D3D12PipelineLayout.h"
 #include "../../DXCommon/ComPtr.h"
+#include "../../PipelineCompileTask.h"
 #include <d3d12.h>
 #include <memory>
+#include <functional>
+#include <cstdint>
 
 
 namespace LLGL
@@ -33,9 +36,17 @@ class D3D12PipelineState : public PipelineState
 
         void SetDebugName(const char* name) override final;
         const Report* GetReport() const override final;
+        bool IsReady() const override final;
 
     public:
 
+        /*
+        Returns the PSO that is to be bound in place of this PSO:
+        This PSO if it is ready, its placeholder while it is still being compiled,
+        or this PSO after waiting for its compilation if there is no placeholder.
+        */
+        D3D12PipelineState& GetReadyPSO();
+
         // Binds the natvie PSO to the specified command context.
         virtual void Bind(D3D12CommandContext& commandContext) = 0;
 
@@ -63,11 +74,21 @@ class D3D12PipelineState : public PipelineState
             bool                        isGraphicsPSO,
             const PipelineLayout*       pipelineLayout,
             const ArrayView<Shader*>&   shaders,
-            D3D12PipelineLayout&        defaultPipelineLayout
+            D3D12PipelineLayout&        defaultPipelineLayout,
+            PipelineState*              placeholder             = nullptr
         );
 
-        // Stores the native PSO and updates an optional PSO cache.
-        void SetNativeAndUpdateCache(ComPtr<ID3D12PipelineState>&& native, D3D12PipelineCache* pipelineCache);
+        /*
+        Runs the specified function to create the native PSO and assigns the debug name to it.
+        If 'async' is true, the function is run on the global thread pool and exceptions are written to the report.
+        */
+        void CompileNativePSO(const std::function<void()>& compileFunc, const char* debugName, bool async);
+
+        // Waits until the asynchronous compilation has finished. This must be called in the destructor of each sub class.
+        void WaitForCompilation();
+
+        // Stores the native PSO.
+        void SetNative(ComPtr<ID3D12PipelineState>&& native);
 
         // Writes the report with the specified message and error bit.
         void ResetReport(std::string&& text, bool hasErrors = false);
@@ -84,14 +105,23 @@ class D3D12PipelineState : public PipelineState
             return rootSignature_.Get();
         }
 
+        // Returns the hash of the serialized root signature this PSO was linked to. This is the seed for the PSO keys in a pipeline library.
+        inline std::uint64_t GetRootSignatureHash() const
+        {
+            return rootSignatureHash_;
+        }
+
     private:
 
-        const bool                              isGraphicsPSO_  = false;
+        const bool                              isGraphicsPSO_      = false;
         ComPtr<ID3D12PipelineState>             native_;
         ComPtr<ID3D12RootSignature>             rootSignature_;
-        const D3D12PipelineLayout*              pipelineLayout_ = nullptr;
+        std::uint64_t                           rootSignatureHash_  = 0;
+        const D3D12PipelineLayout*              pipelineLayout_     = nullptr;
         std::vector<D3D12RootConstantLocation>  rootConstantMap_;
         Report                                  report_;
+        D3D12PipelineState*                     placeholder_        = nullptr;
+        mutable PipelineCompileTask             compileTask_;
 
 };
 
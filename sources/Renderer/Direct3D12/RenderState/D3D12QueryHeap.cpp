@@ -100,6 +100,10 @@ void D3D12QueryHeap::SetDebugName(const char* name)
 
 void D3D12QueryHeap::Begin(ID3D12GraphicsCommandList* commandList, UINT query)
 {
+    /* Timestamps are only written at the end of a query */
+    if (GetType() == QueryType::Timestamp)
+        return;
+
     /* Begin query section or call "EndQuery" for a single timestamp */
     if (nativeType_ == D3D12_QUERY_TYPE_TIMESTAMP)
         commandList->EndQuery(GetNative(), GetNativeType(), query * queryPerType_);
@@ -113,10 +117,14 @@ void D3D12QueryHeap::Begin(ID3D12GraphicsCommandList* commandList, UINT query)
 void D3D12QueryHeap::End(ID3D12GraphicsCommandList* commandList, UINT query)
 {
     /* End query section or call "EndQuery" on another timestamp to get elapsed time range */
-    if (nativeType_ == D3D12_QUERY_TYPE_TIMESTAMP)
+    if (GetType() == QueryType::TimeElapsed)
         commandList->EndQuery(GetNative(), GetNativeType(), query * queryPerType_ + 1);
     else
         commandList->EndQuery(GetNative(), GetNativeType(), query * queryPerType_);
+
+    /* Mark timestamp query data as 'dirty', since these queries have no begin section */
+    if (GetType() == QueryType::Timestamp)
+        MarkDirtyRange(query, 1);
 }
 
 void D3D12QueryHeap::FlushDirtyRange(ID3D12GraphicsCommandList* commandList)
@@ -140,6 +148,23 @@ bool D3D12QueryHeap::InsideDirtyRange(UINT firstQuery, UINT numQueries) const
     return (firstQuery + numQueries > dirtyRange_[0] && firstQuery < dirtyRange_[1]);
 }
 
+void D3D12QueryHeap::ResolveToResource(
+    ID3D12GraphicsCommandList*  commandList,
+    UINT                        firstQuery,
+    UINT                        numQueries,
+    ID3D12Resource*             dstResource,
+    UINT64                      dstOffset)
+{
+    commandList->ResolveQueryData(
+        GetNative(),
+        GetNativeType(),
+        firstQuery * queryPerType_,
+        numQueries * queryPerType_,
+        dstResource,
+        dstOffset
+    );
+}
+
 void* D3D12QueryHeap::Map(UINT firstQuery, UINT numQueries)
 {
     void* mappedData = nullptr;
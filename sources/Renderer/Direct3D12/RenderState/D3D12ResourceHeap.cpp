@@ -9,6 +9,7 @@
 #include "D3D12PipelineLayout.h"
 #include "D3D12DescriptorHeap.h"
 #include "../D3D12ObjectUtils.h"
+#include "../Command/D3D12CommandContext.h"
 #include "../Buffer/D3D12Buffer.h"
 #include "../Texture/D3D12Sampler.h"
 #include "../Texture/D3D12Texture.h"
@@ -172,7 +173,7 @@ std::uint32_t D3D12ResourceHeap::CreateResourceViewHandles(
     return numWritten;
 }
 
-void D3D12ResourceHeap::InsertResourceBarriers(ID3D12GraphicsCommandList* commandList, std::uint32_t descriptorSet)
+void D3D12ResourceHeap::InsertResourceBarriers(D3D12CommandContext& commandContext, std::uint32_t descriptorSet)
 {
     if (descriptorSet < numDescriptorSets_ && HasBarriers())
     {
@@ -181,7 +182,7 @@ void D3D12ResourceHeap::InsertResourceBarriers(ID3D12GraphicsCommandList* comman
         if (numBarriers > 0)
         {
             const auto barriers = reinterpret_cast<const D3D12_RESOURCE_BARRIER*>(barrierHeapStart + sizeof(UINT));
-            commandList->ResourceBarrier(numBarriers, barriers);
+            commandContext.InsertResourceBarriers(numBarriers, barriers);
         }
     }
 }
@@ -264,7 +265,7 @@ bool D3D12ResourceHeap::CreateShaderResourceView(ID3D12Device* device, D3D12_CPU
     if (resource.GetResourceType() == ResourceType::Buffer)
     {
         auto& bufferD3D = LLGL_CAST(D3D12Buffer&, resource);
-        if ((bufferD3D.GetBindFlags() & BindFlags::Sampled) != 0)
+        if ((bufferD3D.GetBindFlags() & (BindFlags::Sampled | BindFlags::AccelerationStructure)) != 0)
         {
             /* Create shader resource view (SRV) for D3D buffer */
             if (IsBufferViewEnabled(desc.bufferView))
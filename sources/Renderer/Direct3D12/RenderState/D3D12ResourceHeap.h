@@ -24,6 +24,7 @@ namespace LLGL
 
 
 struct ResourceHeapDescriptor;
+class D3D12CommandContext;
 
 class D3D12ResourceHeap final : public ResourceHeap
 {
@@ -49,8 +50,8 @@ class D3D12ResourceHeap final : public ResourceHeap
             const ArrayView<ResourceViewDescriptor>&    resourceViews
         );
 
-        // Inserts the resource barriers for the specified descritpor set into the command list.
-        void InsertResourceBarriers(ID3D12GraphicsCommandList* commandList, std::uint32_t descriptorSet);
+        // Inserts the resource barriers for the specified descritpor set into the accumulated barriers of the command context.
+        void InsertResourceBarriers(D3D12CommandContext& commandContext, std::uint32_t descriptorSet);
 
         // Returns the CPU descriptor handle for heap start of the specified descriptor set.
         D3D12_CPU_DESCRIPTOR_HANDLE GetCPUDescriptorHandleForHeapStart(D3D12_DESCRIPTOR_HEAP_TYPE heapType, std::uint32_t descriptorSet) const;
@@ -40,6 +40,15 @@ D3D12StagingDescriptorHeap::D3D12StagingDescriptorHeap(
 {
 }
 
+D3D12StagingDescriptorHeap::D3D12StagingDescriptorHeap(
+    const D3D12DescriptorHeap&  parentHeap,
+    UINT                        firstDescriptor,
+    UINT                        size)
+:
+    D3D12DescriptorHeap { parentHeap, firstDescriptor, size }
+{
+}
+
 void D3D12StagingDescriptorHeap::Create(
     ID3D12Device*               device,
     D3D12_DESCRIPTOR_HEAP_TYPE  type,
@@ -66,8 +75,7 @@ void D3D12StagingDescriptorHeap::CopyDescriptors(
     UINT                        numDescriptors)
 {
     /* Get source descriptor CPU handle address */
-    D3D12_CPU_DESCRIPTOR_HANDLE dstDescHandle = GetNative()->GetCPUDescriptorHandleForHeapStart();
-    dstDescHandle.ptr += (offset_ + firstDescriptor) * GetStride();
+    D3D12_CPU_DESCRIPTOR_HANDLE dstDescHandle = D3D12DescriptorHeap::GetCpuHandleWithOffset(offset_ + firstDescriptor);
 
     /* Copy descriptors from source to destination descriptor heap */
     device->CopyDescriptorsSimple(numDescriptors, dstDescHandle, srcDescHandle, GetType());
@@ -36,6 +36,13 @@ class D3D12StagingDescriptorHeap final : private D3D12DescriptorHeap
             UINT                        size
         );
 
+        // Initializes the descriptor heap as a region of the specified shader-visible parent heap.
+        D3D12StagingDescriptorHeap(
+            const D3D12DescriptorHeap&  parentHeap,
+            UINT                        firstDescriptor,
+            UINT                        size
+        );
+
         // Creates a new descriptor heap and resets the writing offset. This is always a shader-visible descriptor heap.
         void Create(
             ID3D12Device*               device,
@@ -87,6 +94,12 @@ class D3D12StagingDescriptorHeap final : private D3D12DescriptorHeap
             return D3D12DescriptorHeap::GetStride();
         }
 
+        // Returns the offset of this heap within the native D3D descriptor heap.
+        inline UINT GetBaseOffset() const
+        {
+            return D3D12DescriptorHeap::GetBaseOffset();
+        }
+
         // Returns the current writing offset for the next descriptor.
         inline UINT GetOffset() const
         {
@@ -6,9 +6,11 @@
  */
 
 #include "D3D12StagingDescriptorHeapPool.h"
+#include "D3D12BindlessDescriptorHeap.h"
 #include "../D3D12Device.h"
 #include "../../../Core/Assertion.h"
 #include "../../../Core/CoreUtils.h"
+#include "../../../Core/Exception.h"
 #include <algorithm>
 
 
@@ -41,12 +43,18 @@ D3D12StagingDescriptorHeapPool::D3D12StagingDescriptorHeapPool(ID3D12Device* dev
     InitializeDevice(device, type);
 }
 
-void D3D12StagingDescriptorHeapPool::InitializeDevice(ID3D12Device* device, D3D12_DESCRIPTOR_HEAP_TYPE type)
+D3D12StagingDescriptorHeapPool::~D3D12StagingDescriptorHeapPool()
 {
-    chunks_.clear();
-    device_     = device;
-    type_       = type;
-    chunkSize_  = GetInitialDescriptorHeapSize(type);
+    ReleaseChunks();
+}
+
+void D3D12StagingDescriptorHeapPool::InitializeDevice(ID3D12Device* device, D3D12_DESCRIPTOR_HEAP_TYPE type, D3D12BindlessDescriptorHeap* bindlessHeap)
+{
+    ReleaseChunks();
+    device_         = device;
+    bindlessHeap_   = bindlessHeap;
+    type_           = type;
+    chunkSize_      = GetInitialDescriptorHeapSize(type);
     AllocChunk(chunkSize_);
 }
 
@@ -61,7 +69,21 @@ void D3D12StagingDescriptorHeapPool::Reset()
         for (const auto& chunk : chunks_)
             accumulatedSize += chunk.GetSize();
 
-        if (accumulatedSize <= GetMaxDescriptorHeapSize(type_))
+        if (bindlessHeap_ != nullptr)
+        {
+            /* Replace chunks by a single region with accumulated size if the bindless heap has enough space left */
+            ReleaseChunks();
+            UINT firstDescriptor = 0;
+            if (bindlessHeap_->AllocRegion(accumulatedSize, firstDescriptor))
+            {
+                chunkSize_ = accumulatedSize;
+                chunks_.emplace_back(bindlessHeap_->GetHeap(), firstDescriptor, accumulatedSize);
+                chunkIdx_ = 0;
+            }
+            else
+                AllocChunk(chunkSize_);
+        }
+        else if (accumulatedSize <= GetMaxDescriptorHeapSize(type_))
         {
             /* Create single chunk with accumulated size */
             chunks_.clear();
@@ -129,10 +151,36 @@ D3D12_CPU_DESCRIPTOR_HANDLE D3D12StagingDescriptorHeapPool::GetCpuHandleWithOffs
 void D3D12StagingDescriptorHeapPool::AllocChunk(UINT minNumDescriptors)
 {
     chunkSize_ = std::max(chunkSize_, minNumDescriptors);
-    chunks_.emplace_back(device_, type_, chunkSize_);
+    if (bindlessHeap_ != nullptr)
+    {
+        /* Allocate chunk as region of the bindless heap, since only one shader-visible heap per type can be bound at a time */
+        UINT firstDescriptor = 0;
+        if (!bindlessHeap_->AllocRegion(chunkSize_, firstDescriptor))
+        {
+            /* Fall back to the originally requested size before giving up */
+            chunkSize_ = minNumDescriptors;
+            if (!bindlessHeap_->AllocRegion(chunkSize_, firstDescriptor))
+                LLGL_TRAP("D3D12 bindless descriptor heap has no space left for %u staging descriptors", chunkSize_);
+        }
+        chunks_.emplace_back(bindlessHeap_->GetHeap(), firstDescriptor, chunkSize_);
+    }
+    else
+        chunks_.emplace_back(device_, type_, chunkSize_);
     chunkIdx_ = chunks_.size() - 1;
 }
 
+void D3D12StagingDescriptorHeapPool::ReleaseChunks()
+{
+    if (bindlessHeap_ != nullptr)
+    {
+        const UINT heapBaseOffset = bindlessHeap_->GetHeap().GetBaseOffset();
+        for (const auto& chunk : chunks_)
+            bindlessHeap_->FreeRegion(chunk.GetBaseOffset() - heapBaseOffset, chunk.GetSize());
+    }
+    chunks_.clear();
+    chunkIdx_ = 0;
+}
+
 void D3D12StagingDescriptorHeapPool::ResetChunks()
 {
     /* Reset offsets of existing chunks */
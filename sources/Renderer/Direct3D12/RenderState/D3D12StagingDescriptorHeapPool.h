@@ -18,6 +18,8 @@ namespace LLGL
 {
 
 
+class D3D12BindlessDescriptorHeap;
+
 /*
 Pool of D3D12 staging descriptor heaps.
 The number of chunks in this pools is preferrably always 1, so the initial chunk should be allocated with a decent size.
@@ -29,9 +31,16 @@ class D3D12StagingDescriptorHeapPool
 
         D3D12StagingDescriptorHeapPool() = default;
         D3D12StagingDescriptorHeapPool(ID3D12Device* device, D3D12_DESCRIPTOR_HEAP_TYPE type);
+        ~D3D12StagingDescriptorHeapPool();
+
+        D3D12StagingDescriptorHeapPool(const D3D12StagingDescriptorHeapPool&) = delete;
+        D3D12StagingDescriptorHeapPool& operator = (const D3D12StagingDescriptorHeapPool&) = delete;
 
-        // Initializes the device object and chunk size.
-        void InitializeDevice(ID3D12Device* device, D3D12_DESCRIPTOR_HEAP_TYPE type);
+        /*
+        Initializes the device object and chunk size.
+        If 'bindlessHeap' is non-null, all chunks are allocated as regions of that heap instead of individual shader-visible heaps.
+        */
+        void InitializeDevice(ID3D12Device* device, D3D12_DESCRIPTOR_HEAP_TYPE type, D3D12BindlessDescriptorHeap* bindlessHeap = nullptr);
 
         // Resets all chunks in the pool.
         void Reset();
@@ -60,12 +69,16 @@ class D3D12StagingDescriptorHeapPool
         // Restes all previously allocated chunks.
         void ResetChunks();
 
+        // Releases all chunks and returns their regions to the bindless heap.
+        void ReleaseChunks();
+
         // Increments the offset for the next range of descriptor handles.
         void IncrementOffset(UINT stride);
 
     private:
 
         ID3D12Device*                           device_         = nullptr;
+        D3D12BindlessDescriptorHeap*            bindlessHeap_   = nullptr;
         D3D12_DESCRIPTOR_HEAP_TYPE              type_           = D3D12_DESCRIPTOR_HEAP_TYPE_NUM_TYPES;
 
         std::vector<D3D12StagingDescriptorHeap> chunks_;
@@ -0,0 +1,138 @@
+/*
+ * ConvertImageBuffer.hlsl.inl
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+/*
+Image format and data type conversion for texture uploads (see D3D12ImageConverter).
+This shader is compiled at runtime with FXC when it is used for the first time.
+The packed source image is read from an upload buffer and expanded into an intermediate buffer with the layout of the texture footprint.
+Each thread writes one DWORD of a destination row, so destination components must be 1, 2, or 4 bytes wide.
+Components are converted the same way as ConvertImageBuffer() does on the CPU, i.e. normalized to [0, 1] and missing components are (0, 0, 0, 1).
+*/
+static const char g_ConvertImageBuffer_HLSL[] = R"(
+
+/* Source and destination layout; must match D3D12ConvertImageDescriptor */
+cbuffer ConvertDescriptor : register(b0)
+{
+    uint    srcTexelSize;       // Size (in bytes) of each source texel
+    uint    srcComponentSize;   // Size (in bytes) of each source component: 1, 2, or 4
+    uint    srcDataType;        // Source data type (see DATA_TYPE_*)
+    uint    dstComponentSize;   // Size (in bytes) of each destination component: 1, 2, or 4
+    uint    dstDataType;        // Destination data type (see DATA_TYPE_*)
+    uint    dstComponents;      // Number of components per destination texel
+    uint    dstSwizzle;         // Source component for each destination component (4 bits each); 4 for zero, 5 for one
+    uint    dstDwordsPerRow;    // Number of DWORDs per destination row
+    uint    dstRowPitch;        // Row pitch (in bytes) of the destination buffer
+    uint    dstSlicePitch;      // Slice pitch (in bytes) of the destination buffer
+    uint    width;              // Number of texels per row
+    uint    height;             // Number of rows per slice
+    uint    numSlices;          // Number of depth slices times array layers
+};
+
+#define DATA_TYPE_UINT8     0
+#define DATA_TYPE_INT8      1
+#define DATA_TYPE_UINT16    2
+#define DATA_TYPE_INT16     3
+#define DATA_TYPE_FLOAT16   4
+#define DATA_TYPE_FLOAT32   5
+
+#define SWIZZLE_ZERO        4
+#define SWIZZLE_ONE         5
+
+ByteAddressBuffer   srcBuffer : register(t0);
+RWByteAddressBuffer dstBuffer : register(u0);
+
+/* Loads a 1, 2, or 4 byte wide component; the source buffer only supports DWORD aligned loads */
+uint LoadSourceBits(uint addr, uint size)
+{
+    uint value = srcBuffer.Load(addr & ~3u);
+    if (size == 4)
+        return value;
+    value >>= (addr & 3u) * 8u;
+    return (size == 1 ? value & 0xFFu : value & 0xFFFFu);
+}
+
+/* Converts the source component into the normalized range; signed integers are mapped from [min, max] to [0, 1] */
+float DecodeComponent(uint bits, uint dataType)
+{
+    switch (dataType)
+    {
+        case DATA_TYPE_UINT8:
+            return (float)bits / 255.0;
+        case DATA_TYPE_INT8:
+            return (float)(bits ^ 0x80u) / 255.0;
+        case DATA_TYPE_UINT16:
+            return (float)bits / 65535.0;
+        case DATA_TYPE_INT16:
+            return (float)(bits ^ 0x8000u) / 65535.0;
+        case DATA_TYPE_FLOAT16:
+            return f16tof32(bits);
+        default:
+            return asfloat(bits);
+    }
+}
+
+/* Converts the normalized value into the destination component; integers are truncated like static_cast on the CPU */
+uint EncodeComponent(float value, uint dataType)
+{
+    switch (dataType)
+    {
+        case DATA_TYPE_UINT8:
+            return (uint)(saturate(value) * 255.0);
+        case DATA_TYPE_INT8:
+            return (uint)((int)(saturate(value) * 255.0 - 128.0)) & 0xFFu;
+        case DATA_TYPE_UINT16:
+            return (uint)(saturate(value) * 65535.0);
+        case DATA_TYPE_INT16:
+            return (uint)((int)(saturate(value) * 65535.0 - 32768.0)) & 0xFFFFu;
+        case DATA_TYPE_FLOAT16:
+            return f32tof16(value);
+        default:
+            return asuint(value);
+    }
+}
+
+float ReadSourceComponent(uint texel, uint component)
+{
+    if (component == SWIZZLE_ZERO)
+        return 0.0;
+    if (component == SWIZZLE_ONE)
+        return 1.0;
+    uint addr = texel * srcTexelSize + component * srcComponentSize;
+    return DecodeComponent(LoadSourceBits(addr, srcComponentSize), srcDataType);
+}
+
+[numthreads(64, 1, 1)]
+void ConvertImageBufferCS(uint3 threadID : SV_DispatchThreadID)
+{
+    if (threadID.x >= dstDwordsPerRow || threadID.y >= height || threadID.z >= numSlices)
+        return;
+
+    /* Gather all destination components of this DWORD */
+    uint componentsPerDword = 4u / dstComponentSize;
+    uint rowTexel           = (threadID.z * height + threadID.y) * width;
+    uint result             = 0;
+
+    for (uint i = 0; i < componentsPerDword; ++i)
+    {
+        uint component  = threadID.x * componentsPerDword + i;
+        uint texel      = component / dstComponents;
+        if (texel >= width)
+            break;
+
+        uint srcComponent = (dstSwizzle >> ((component % dstComponents) * 4u)) & 0xFu;
+        float value = ReadSourceComponent(rowTexel + texel, srcComponent);
+        result |= EncodeComponent(value, dstDataType) << (i * dstComponentSize * 8u);
+    }
+
+    dstBuffer.Store(threadID.z * dstSlicePitch + threadID.y * dstRowPitch + threadID.x * 4u, result);
+}
+
+)";
+
+
+
+// ================================================================================
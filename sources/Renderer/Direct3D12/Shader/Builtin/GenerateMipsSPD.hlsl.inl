@@ -0,0 +1,265 @@
+/*
+ * GenerateMipsSPD.hlsl.inl
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+/*
+Single-pass downsampler for 2D textures and 2D texture arrays (including cube maps).
+This shader is compiled at runtime with FXC when it is used for the first time (see D3D12MipGenerator).
+Each work group downsamples a 128x128 tile of the source MIP-map level into the next 7 MIP-map levels.
+The last work group of each array layer, determined by an atomic counter, downsamples the 7th level into up to 5 more levels.
+Only MIP-map chains whose intermediate levels have even or unit size are supported, since this shader uses a 2x2 box filter.
+*/
+static const char g_GenerateMipsSPD_HLSL[] = R"(
+
+/* Current MIP-map chain configuration */
+cbuffer SPDDescriptor : register(b0)
+{
+    uint2   srcSize;        // Extent of srcMipLevel
+    uint    baseMipLevel;   // Base MIP-map level of srcMipLevel
+    uint    numMipLevels;   // Number of MIP-map levels to write: [1..12]
+    uint    baseArrayLayer; // Base array layer of srcMipLevel
+    uint    numWorkGroups;  // Number of work groups per array layer
+};
+
+
+/* Next 12 output MIP-map levels; 7th level is read back by the last work group */
+RWTexture2DArray<float4>                    dstMipLevel1        : register(u0);
+RWTexture2DArray<float4>                    dstMipLevel2        : register(u1);
+RWTexture2DArray<float4>                    dstMipLevel3        : register(u2);
+RWTexture2DArray<float4>                    dstMipLevel4        : register(u3);
+RWTexture2DArray<float4>                    dstMipLevel5        : register(u4);
+RWTexture2DArray<float4>                    dstMipLevel6        : register(u5);
+globallycoherent RWTexture2DArray<float4>   dstMipLevel7        : register(u6);
+RWTexture2DArray<float4>                    dstMipLevel8        : register(u7);
+RWTexture2DArray<float4>                    dstMipLevel9        : register(u8);
+RWTexture2DArray<float4>                    dstMipLevel10       : register(u9);
+RWTexture2DArray<float4>                    dstMipLevel11       : register(u10);
+RWTexture2DArray<float4>                    dstMipLevel12       : register(u11);
+globallycoherent RWByteAddressBuffer        workGroupCounters   : register(u12);
+Texture2DArray<float4>                      srcMipLevel         : register(t0);
+SamplerState                                linearClampSampler  : register(s0);
+
+
+/* Separate color channels into different groupshared arrays for better cache utilization */
+groupshared float   sharedColorR[256];
+groupshared float   sharedColorG[256];
+groupshared float   sharedColorB[256];
+groupshared float   sharedColorA[256];
+groupshared uint    sharedIsLastWorkGroup;
+
+void StoreColor(uint idx, float4 color)
+{
+    sharedColorR[idx] = color.r;
+    sharedColorG[idx] = color.g;
+    sharedColorB[idx] = color.b;
+    sharedColorA[idx] = color.a;
+}
+
+float4 LoadColor(uint idx)
+{
+    return float4(
+        sharedColorR[idx],
+        sharedColorG[idx],
+        sharedColorB[idx],
+        sharedColorA[idx]
+    );
+}
+
+#ifdef LINEAR_TO_SRGB
+
+float3 LinearToSRGB(float3 linearColor)
+{
+    /* Use approximation for sRGB curve */
+    return (linearColor < 0.0031308 ? 12.92 * linearColor : 1.13005 * sqrt(abs(linearColor - 0.00228)) - 0.13448 * linearColor + 0.005719);
+}
+
+float3 SRGBToLinear(float3 srgbColor)
+{
+    return (srgbColor <= 0.04045 ? srgbColor / 12.92 : pow(abs((srgbColor + 0.055) / 1.055), 2.4));
+}
+
+#endif // /LINEAR_TO_SRGB
+
+float4 PackLinearColor(float4 linearColor)
+{
+    #ifdef LINEAR_TO_SRGB
+    return float4(LinearToSRGB(linearColor.rgb), linearColor.a);
+    #else
+    return linearColor;
+    #endif // /LINEAR_TO_SRGB
+}
+
+float4 UnpackLinearColor(float4 packedColor)
+{
+    #ifdef LINEAR_TO_SRGB
+    return float4(SRGBToLinear(packedColor.rgb), packedColor.a);
+    #else
+    return packedColor;
+    #endif // /LINEAR_TO_SRGB
+}
+
+/* Returns the extent of the specified MIP-map level relative to srcMipLevel */
+uint2 GetMipExtent(uint level)
+{
+    return max(uint2(1, 1), srcSize >> level);
+}
+
+/* Writes the color to the specified MIP-map level relative to srcMipLevel; Out-of-bounds writes are discarded */
+void StoreMipColor(uint level, uint2 pos, uint arrayLayer, float4 linearColor)
+{
+    uint3 idx = uint3(pos, arrayLayer);
+    float4 color = PackLinearColor(linearColor);
+    switch (level)
+    {
+        case  1: dstMipLevel1 [idx] = color; break;
+        case  2: dstMipLevel2 [idx] = color; break;
+        case  3: dstMipLevel3 [idx] = color; break;
+        case  4: dstMipLevel4 [idx] = color; break;
+        case  5: dstMipLevel5 [idx] = color; break;
+        case  6: dstMipLevel6 [idx] = color; break;
+        case  7: dstMipLevel7 [idx] = color; break;
+        case  8: dstMipLevel8 [idx] = color; break;
+        case  9: dstMipLevel9 [idx] = color; break;
+        case 10: dstMipLevel10[idx] = color; break;
+        case 11: dstMipLevel11[idx] = color; break;
+        case 12: dstMipLevel12[idx] = color; break;
+    }
+}
+
+/*
+Averages a 2x2 block of the source level for the destination texel at 'dstPos'.
+Texels outside the source level are replaced by their neighbors inside, which happens when one dimension has reached unit size.
+*/
+float4 Reduce(float4 c00, float4 c10, float4 c01, float4 c11, uint2 dstPos, uint srcLevel)
+{
+    uint2 srcExtent = GetMipExtent(srcLevel);
+    if (dstPos.x * 2 + 1 >= srcExtent.x)
+    {
+        c10 = c00;
+        c11 = c01;
+    }
+    if (dstPos.y * 2 + 1 >= srcExtent.y)
+    {
+        c01 = c00;
+        c11 = c10;
+    }
+    return 0.25 * (c00 + c10 + c01 + c11);
+}
+
+/* Downsamples a 16x16 tile of the specified MIP-map level into the next 4 levels with groupshared memory */
+void ReduceSharedTile(uint2 threadPos, uint2 tileOrigin, uint level, uint arrayLayer, float4 color)
+{
+    uint idx = threadPos.y * 16 + threadPos.x;
+    StoreColor(idx, color);
+
+    [unroll]
+    for (uint step = 1; step < 16; step *= 2)
+    {
+        GroupMemoryBarrierWithGroupSync();
+
+        if (level == numMipLevels)
+            return;
+
+        if (((threadPos.x | threadPos.y) & (step * 2 - 1)) == 0)
+        {
+            uint2 dstPos = (tileOrigin + threadPos) / (step * 2);
+            color = Reduce(color, LoadColor(idx + step), LoadColor(idx + step * 16), LoadColor(idx + step * 17), dstPos, level);
+            StoreMipColor(level + 1, dstPos, arrayLayer, color);
+            StoreColor(idx, color);
+        }
+
+        ++level;
+    }
+}
+
+/* Primary compute kernel to generate up to 12 MIP-map levels in a single dispatch */
+[numthreads(16, 16, 1)]
+void GenerateMipsSPDCS(uint3 groupID : SV_GroupID, uint3 groupThreadID : SV_GroupThreadID, uint groupIndex : SV_GroupIndex)
+{
+    uint arrayLayer = baseArrayLayer + groupID.z;
+
+    /* Sample 4x4 texels of the 1st output MIP-map level and reduce them to 2x2 texels of the 2nd level and 1 texel of the 3rd level */
+    uint2   mip1Pos         = groupID.xy * 64 + groupThreadID.xy * 4;
+    float2  mip1TexelSize   = 1.0 / (float2)GetMipExtent(1);
+    float4  mip2Colors[4];
+
+    [unroll]
+    for (uint block = 0; block < 4; ++block)
+    {
+        uint2 blockPos = mip1Pos + uint2(block & 1, block >> 1) * 2;
+        float4 mip1Colors[4];
+
+        [unroll]
+        for (uint i = 0; i < 4; ++i)
+        {
+            uint2 pos = blockPos + uint2(i & 1, i >> 1);
+            float3 uv = float3(mip1TexelSize * (pos + 0.5), (float)arrayLayer);
+            mip1Colors[i] = srcMipLevel.SampleLevel(linearClampSampler, uv, baseMipLevel);
+            StoreMipColor(1, pos, arrayLayer, mip1Colors[i]);
+        }
+
+        uint2 mip2Pos = blockPos / 2;
+        mip2Colors[block] = Reduce(mip1Colors[0], mip1Colors[1], mip1Colors[2], mip1Colors[3], mip2Pos, 1);
+        if (numMipLevels >= 2)
+            StoreMipColor(2, mip2Pos, arrayLayer, mip2Colors[block]);
+    }
+
+    if (numMipLevels <= 2)
+        return;
+
+    uint2 mip3Pos = mip1Pos / 4;
+    float4 mip3Color = Reduce(mip2Colors[0], mip2Colors[1], mip2Colors[2], mip2Colors[3], mip3Pos, 2);
+    StoreMipColor(3, mip3Pos, arrayLayer, mip3Color);
+
+    /* Reduce 16x16 texels of the 3rd level down to 1 texel of the 7th level */
+    ReduceSharedTile(groupThreadID.xy, groupID.xy * 16, 3, arrayLayer, mip3Color);
+
+    if (numMipLevels <= 7)
+        return;
+
+    /* Make 7th level visible to all work groups and determine the last work group of this array layer */
+    DeviceMemoryBarrierWithGroupSync();
+
+    if (groupIndex == 0)
+    {
+        uint prevCount = 0;
+        workGroupCounters.InterlockedAdd(groupID.z * 4, 1, prevCount);
+        sharedIsLastWorkGroup = (prevCount + 1 == numWorkGroups ? 1 : 0);
+    }
+
+    GroupMemoryBarrierWithGroupSync();
+
+    if (sharedIsLastWorkGroup == 0)
+        return;
+
+    /* Reset counter for the next dispatch */
+    if (groupIndex == 0)
+        workGroupCounters.Store(groupID.z * 4, 0);
+
+    /* Read back 2x2 texels of the 7th level and reduce them to 1 texel of the 8th level */
+    uint2 mip8Pos = groupThreadID.xy;
+    uint2 mip7Max = GetMipExtent(7) - 1;
+    uint2 mip7Pos = mip8Pos * 2;
+
+    float4 mip8Color = Reduce(
+        UnpackLinearColor(dstMipLevel7[uint3(min(mip7Pos,              mip7Max), arrayLayer)]),
+        UnpackLinearColor(dstMipLevel7[uint3(min(mip7Pos + uint2(1, 0), mip7Max), arrayLayer)]),
+        UnpackLinearColor(dstMipLevel7[uint3(min(mip7Pos + uint2(0, 1), mip7Max), arrayLayer)]),
+        UnpackLinearColor(dstMipLevel7[uint3(min(mip7Pos + uint2(1, 1), mip7Max), arrayLayer)]),
+        mip8Pos,
+        7
+    );
+    StoreMipColor(8, mip8Pos, arrayLayer, mip8Color);
+
+    /* Reduce 16x16 texels of the 8th level down to 1 texel of the 12th level */
+    ReduceSharedTile(groupThreadID.xy, uint2(0, 0), 8, arrayLayer, mip8Color);
+}
+
+)";
+
+
+
+// ================================================================================
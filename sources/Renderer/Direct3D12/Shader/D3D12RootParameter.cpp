@@ -72,13 +72,19 @@ void D3D12RootParameter::InitAsDescriptorRange(D3D12_DESCRIPTOR_RANGE_TYPE range
 void D3D12RootParameter::InitAsDescriptorTable(UINT maxNumDescriptorRanges, D3D12_SHADER_VISIBILITY visibility)
 {
     descRanges_.reserve(maxNumDescriptorRanges);
+    descRangeFlags_.reserve(maxNumDescriptorRanges);
     managedRootParam_->ParameterType                        = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
     managedRootParam_->DescriptorTable.NumDescriptorRanges  = 0;
     managedRootParam_->DescriptorTable.pDescriptorRanges    = descRanges_.data();
     managedRootParam_->ShaderVisibility                     = visibility;
 }
 
-void D3D12RootParameter::AppendDescriptorTableRange(D3D12_DESCRIPTOR_RANGE_TYPE rangeType, UINT baseShaderRegister, UINT numDescriptors, UINT registerSpace)
+void D3D12RootParameter::AppendDescriptorTableRange(
+    D3D12_DESCRIPTOR_RANGE_TYPE     rangeType,
+    UINT                            baseShaderRegister,
+    UINT                            numDescriptors,
+    UINT                            registerSpace,
+    D3D12_DESCRIPTOR_RANGE_FLAGS    rangeFlags)
 {
     /* Add new descriptor range to array */
     descRanges_.resize(descRanges_.size() + 1);
@@ -91,19 +97,29 @@ void D3D12RootParameter::AppendDescriptorTableRange(D3D12_DESCRIPTOR_RANGE_TYPE
     descRange.RegisterSpace                     = registerSpace;
     descRange.OffsetInDescriptorsFromTableStart = D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND;
 
+    /* Store range flags for root signature version 1.1; Sampler ranges must not have any data flags */
+    if (rangeType == D3D12_DESCRIPTOR_RANGE_TYPE_SAMPLER)
+        rangeFlags &= D3D12_DESCRIPTOR_RANGE_FLAG_DESCRIPTORS_VOLATILE;
+    descRangeFlags_.push_back(rangeFlags);
+
     /* Increment descriptor range count */
     managedRootParam_->DescriptorTable.NumDescriptorRanges++;
 }
 
-void D3D12RootParameter::AppendDescriptorTableRange(D3D12_DESCRIPTOR_RANGE_TYPE rangeType, const BindingSlot& slot, UINT numDescriptors)
+void D3D12RootParameter::AppendDescriptorTableRange(
+    D3D12_DESCRIPTOR_RANGE_TYPE     rangeType,
+    const BindingSlot&              slot,
+    UINT                            numDescriptors,
+    D3D12_DESCRIPTOR_RANGE_FLAGS    rangeFlags)
 {
-    AppendDescriptorTableRange(rangeType, slot.index, numDescriptors, slot.set);
+    AppendDescriptorTableRange(rangeType, slot.index, numDescriptors, slot.set, rangeFlags);
 }
 
 void D3D12RootParameter::Clear()
 {
     *managedRootParam_ = {};
     descRanges_.clear();
+    descRangeFlags_.clear();
 }
 
 static bool AreRangeTypesCompatible(D3D12_DESCRIPTOR_RANGE_TYPE lhs, D3D12_DESCRIPTOR_RANGE_TYPE rhs)
@@ -42,8 +42,23 @@ class D3D12RootParameter
         void InitAsDescriptorRange(D3D12_DESCRIPTOR_RANGE_TYPE rangeType, UINT shaderRegister, UINT numDescriptors, D3D12_SHADER_VISIBILITY visibility = D3D12_SHADER_VISIBILITY_ALL);
         void InitAsDescriptorTable(UINT maxNumDescriptorRanges, D3D12_SHADER_VISIBILITY visibility = D3D12_SHADER_VISIBILITY_ALL);
 
-        void AppendDescriptorTableRange(D3D12_DESCRIPTOR_RANGE_TYPE rangeType, UINT baseShaderRegister, UINT numDescriptors = 1, UINT registerSpace = 0);
-        void AppendDescriptorTableRange(D3D12_DESCRIPTOR_RANGE_TYPE rangeType, const BindingSlot& slot, UINT numDescriptors = 1);
+        /*
+        Appends a descriptor range to this descriptor table. The range flags are only used for root signature version 1.1.
+        By default, descriptors and data are volatile, which is equivalent to the behavior of root signature version 1.0.
+        */
+        void AppendDescriptorTableRange(
+            D3D12_DESCRIPTOR_RANGE_TYPE     rangeType,
+            UINT                            baseShaderRegister,
+            UINT                            numDescriptors  = 1,
+            UINT                            registerSpace   = 0,
+            D3D12_DESCRIPTOR_RANGE_FLAGS    rangeFlags      = (D3D12_DESCRIPTOR_RANGE_FLAG_DESCRIPTORS_VOLATILE | D3D12_DESCRIPTOR_RANGE_FLAG_DATA_VOLATILE)
+        );
+        void AppendDescriptorTableRange(
+            D3D12_DESCRIPTOR_RANGE_TYPE     rangeType,
+            const BindingSlot&              slot,
+            UINT                            numDescriptors  = 1,
+            D3D12_DESCRIPTOR_RANGE_FLAGS    rangeFlags      = (D3D12_DESCRIPTOR_RANGE_FLAG_DESCRIPTORS_VOLATILE | D3D12_DESCRIPTOR_RANGE_FLAG_DATA_VOLATILE)
+        );
 
         void Clear();
 
@@ -53,6 +68,12 @@ class D3D12RootParameter
         // Returns true if the specified root constants are compatible with this root paramter.
         bool IsCompatible(const D3D12_ROOT_CONSTANTS& rootConstants) const;
 
+        // Returns the flags of all descriptor ranges for root signature version 1.1. See AppendDescriptorTableRange.
+        inline const SmallVector<D3D12_DESCRIPTOR_RANGE_FLAGS, 8>& GetDescriptorRangeFlags() const
+        {
+            return descRangeFlags_;
+        }
+
     public:
 
         // Returns the best suitable shader visibility for the specified stage flags.
@@ -60,8 +81,9 @@ class D3D12RootParameter
 
     private:
 
-        D3D12_ROOT_PARAMETER*                   managedRootParam_   = nullptr;
-        SmallVector<D3D12_DESCRIPTOR_RANGE, 8>  descRanges_;
+        D3D12_ROOT_PARAMETER*                           managedRootParam_   = nullptr;
+        SmallVector<D3D12_DESCRIPTOR_RANGE, 8>          descRanges_;
+        SmallVector<D3D12_DESCRIPTOR_RANGE_FLAGS, 8>    descRangeFlags_;    // Descriptor range flags for root signature version 1.1.
 
 };
 
@@ -108,68 +108,139 @@ D3D12_STATIC_SAMPLER_DESC* D3D12RootSignature::AppendStaticSampler()
     return &(staticSamplers_.back());
 }
 
-static ComPtr<ID3DBlob> DXSerializeRootSignature(
-    const D3D12_ROOT_SIGNATURE_DESC& signatureDesc,
-    const D3D_ROOT_SIGNATURE_VERSION signatureversion)
+static void DXThrowIfSerializationFailed(HRESULT hr, ID3DBlob* error)
 {
-    ComPtr<ID3DBlob> signature, error;
-
-    HRESULT hr = D3D12SerializeRootSignature(
-        &signatureDesc,
-        signatureversion,
-        signature.ReleaseAndGetAddressOf(),
-        error.ReleaseAndGetAddressOf()
-    );
-
     if (FAILED(hr))
     {
-        if (error)
+        if (error != nullptr)
         {
-            auto errorStr = DXGetBlobString(error.Get());
+            auto errorStr = DXGetBlobString(error);
             throw std::runtime_error("failed to serialize D3D12 root signature: " + errorStr);
         }
         else
             DXThrowIfFailed(hr, "failed to serialize D3D12 root signature");
     }
+}
 
-    return signature;
+// Returns the highest root signature version the specified device supports. Version 1.1 requires the Windows 10 Anniversary Update.
+static D3D_ROOT_SIGNATURE_VERSION DXGetHighestRootSignatureVersion(ID3D12Device* device)
+{
+    D3D12_FEATURE_DATA_ROOT_SIGNATURE feature = {};
+    feature.HighestVersion = D3D_ROOT_SIGNATURE_VERSION_1_1;
+    if (FAILED(device->CheckFeatureSupport(D3D12_FEATURE_ROOT_SIGNATURE, &feature, sizeof(feature))))
+        return D3D_ROOT_SIGNATURE_VERSION_1_0;
+    return feature.HighestVersion;
 }
 
-static ComPtr<ID3D12RootSignature> DXCreateRootSignature(
-    ID3D12Device*                               device,
-    const ArrayView<D3D12_ROOT_PARAMETER>&      rootParameters,
-    const ArrayView<D3D12_STATIC_SAMPLER_DESC>& staticSamplers,
-    D3D12_ROOT_SIGNATURE_FLAGS                  flags,
-    ComPtr<ID3DBlob>*                           serializedBlob)
+ComPtr<ID3DBlob> D3D12RootSignature::SerializeVersion1_0(D3D12_ROOT_SIGNATURE_FLAGS flags) const
 {
-    /* Create serialized root signature with the specified root parameters and static samplers */
     D3D12_ROOT_SIGNATURE_DESC signatureDesc;
     {
-        if (rootParameters.empty())
-        {
-            signatureDesc.NumParameters = 0;
-            signatureDesc.pParameters   = nullptr;
-        }
-        else
-        {
-            signatureDesc.NumParameters = static_cast<UINT>(rootParameters.size());
-            signatureDesc.pParameters   = rootParameters.data();
-        }
+        signatureDesc.NumParameters     = static_cast<UINT>(nativeRootParams_.size());
+        signatureDesc.pParameters       = (nativeRootParams_.empty() ? nullptr : nativeRootParams_.data());
+        signatureDesc.NumStaticSamplers = static_cast<UINT>(staticSamplers_.size());
+        signatureDesc.pStaticSamplers   = (staticSamplers_.empty() ? nullptr : staticSamplers_.data());
+        signatureDesc.Flags             = flags;
+    }
+    ComPtr<ID3DBlob> signature, error;
+    HRESULT hr = D3D12SerializeRootSignature(&signatureDesc, D3D_ROOT_SIGNATURE_VERSION_1, signature.ReleaseAndGetAddressOf(), error.ReleaseAndGetAddressOf());
+    DXThrowIfSerializationFailed(hr, error.Get());
+    return signature;
+}
 
-        if (staticSamplers.empty())
-        {
-            signatureDesc.NumStaticSamplers = 0;
-            signatureDesc.pStaticSamplers   = nullptr;
-        }
-        else
+ComPtr<ID3DBlob> D3D12RootSignature::SerializeVersion1_1(D3D12_ROOT_SIGNATURE_FLAGS flags) const
+{
+    /* Reserve all descriptor ranges up front, since the root parameters refer to them */
+    std::size_t numDescRanges = 0;
+    for (const D3D12_ROOT_PARAMETER& rootParam : nativeRootParams_)
+    {
+        if (rootParam.ParameterType == D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE)
+            numDescRanges += rootParam.DescriptorTable.NumDescriptorRanges;
+    }
+
+    SmallVector<D3D12_ROOT_PARAMETER1, 4u>      rootParams1;
+    SmallVector<D3D12_DESCRIPTOR_RANGE1, 8u>    descRanges1;
+
+    rootParams1.resize(nativeRootParams_.size());
+    descRanges1.reserve(numDescRanges);
+
+    /* Convert root parameters to version 1.1 with the flags of their descriptor ranges */
+    for_range(i, nativeRootParams_.size())
+    {
+        const D3D12_ROOT_PARAMETER& srcParam = nativeRootParams_[i];
+        D3D12_ROOT_PARAMETER1&      dstParam = rootParams1[i];
+
+        dstParam.ParameterType      = srcParam.ParameterType;
+        dstParam.ShaderVisibility   = srcParam.ShaderVisibility;
+
+        switch (srcParam.ParameterType)
         {
-            signatureDesc.NumStaticSamplers = static_cast<UINT>(staticSamplers.size());
-            signatureDesc.pStaticSamplers   = staticSamplers.data();
+            case D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE:
+            {
+                const auto& descRangeFlags = rootParams_[i].GetDescriptorRangeFlags();
+                dstParam.DescriptorTable.NumDescriptorRanges    = srcParam.DescriptorTable.NumDescriptorRanges;
+                dstParam.DescriptorTable.pDescriptorRanges      = descRanges1.data() + descRanges1.size();
+
+                for_range(j, srcParam.DescriptorTable.NumDescriptorRanges)
+                {
+                    const D3D12_DESCRIPTOR_RANGE& srcRange = srcParam.DescriptorTable.pDescriptorRanges[j];
+                    D3D12_DESCRIPTOR_RANGE1 dstRange;
+                    {
+                        dstRange.RangeType                          = srcRange.RangeType;
+                        dstRange.NumDescriptors                     = srcRange.NumDescriptors;
+                        dstRange.BaseShaderRegister                 = srcRange.BaseShaderRegister;
+                        dstRange.RegisterSpace                      = srcRange.RegisterSpace;
+                        dstRange.Flags                              = descRangeFlags[j];
+                        dstRange.OffsetInDescriptorsFromTableStart  = srcRange.OffsetInDescriptorsFromTableStart;
+                    }
+                    descRanges1.push_back(dstRange);
+                }
+            }
+            break;
+
+            case D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS:
+            {
+                dstParam.Constants = srcParam.Constants;
+            }
+            break;
+
+            default:
+            {
+                /* Root descriptors can be updated in place between draw calls, e.g. with CommandBuffer::UpdateBuffer */
+                dstParam.Descriptor.ShaderRegister  = srcParam.Descriptor.ShaderRegister;
+                dstParam.Descriptor.RegisterSpace   = srcParam.Descriptor.RegisterSpace;
+                dstParam.Descriptor.Flags           = D3D12_ROOT_DESCRIPTOR_FLAG_DATA_VOLATILE;
+            }
+            break;
         }
+    }
 
-        signatureDesc.Flags                 = flags;
+    D3D12_VERSIONED_ROOT_SIGNATURE_DESC signatureDesc;
+    {
+        signatureDesc.Version                       = D3D_ROOT_SIGNATURE_VERSION_1_1;
+        signatureDesc.Desc_1_1.NumParameters        = static_cast<UINT>(rootParams1.size());
+        signatureDesc.Desc_1_1.pParameters          = (rootParams1.empty() ? nullptr : rootParams1.data());
+        signatureDesc.Desc_1_1.NumStaticSamplers    = static_cast<UINT>(staticSamplers_.size());
+        signatureDesc.Desc_1_1.pStaticSamplers      = (staticSamplers_.empty() ? nullptr : staticSamplers_.data());
+        signatureDesc.Desc_1_1.Flags                = flags;
     }
-    auto signature = DXSerializeRootSignature(signatureDesc, D3D_ROOT_SIGNATURE_VERSION_1);
+    ComPtr<ID3DBlob> signature, error;
+    HRESULT hr = D3D12SerializeVersionedRootSignature(&signatureDesc, signature.ReleaseAndGetAddressOf(), error.ReleaseAndGetAddressOf());
+    DXThrowIfSerializationFailed(hr, error.Get());
+    return signature;
+}
+
+ComPtr<ID3D12RootSignature> D3D12RootSignature::Finalize(
+    ID3D12Device*               device,
+    D3D12_ROOT_SIGNATURE_FLAGS  flags,
+    ComPtr<ID3DBlob>*           serializedBlob)
+{
+    /* Serialize root signature with descriptor range flags if version 1.1 is supported */
+    ComPtr<ID3DBlob> signature;
+    if (DXGetHighestRootSignatureVersion(device) >= D3D_ROOT_SIGNATURE_VERSION_1_1)
+        signature = SerializeVersion1_1(flags);
+    else
+        signature = SerializeVersion1_0(flags);
 
     /* Create actual root signature */
     ComPtr<ID3D12RootSignature> rootSignature;
@@ -188,14 +259,6 @@ static ComPtr<ID3D12RootSignature> DXCreateRootSignature(
     return rootSignature;
 }
 
-ComPtr<ID3D12RootSignature> D3D12RootSignature::Finalize(
-    ID3D12Device*               device,
-    D3D12_ROOT_SIGNATURE_FLAGS  flags,
-    ComPtr<ID3DBlob>*           serializedBlob)
-{
-    return DXCreateRootSignature(device, nativeRootParams_, staticSamplers_, flags, serializedBlob);
-}
-
 
 } // /namespace LLGL
 
@@ -49,7 +49,7 @@ class D3D12RootSignature
 
         D3D12_STATIC_SAMPLER_DESC* AppendStaticSampler();
 
-        // Creates the final native D3D root signature.
+        // Creates the final native D3D root signature. Uses root signature version 1.1 if the device supports it.
         ComPtr<ID3D12RootSignature> Finalize(
             ID3D12Device*               device,
             D3D12_ROOT_SIGNATURE_FLAGS  flags           = D3D12_ROOT_SIGNATURE_FLAG_NONE,
@@ -74,6 +74,11 @@ class D3D12RootSignature
             return rootParams_.size();
         }
 
+    private:
+
+        ComPtr<ID3DBlob> SerializeVersion1_0(D3D12_ROOT_SIGNATURE_FLAGS flags) const;
+        ComPtr<ID3DBlob> SerializeVersion1_1(D3D12_ROOT_SIGNATURE_FLAGS flags) const;
+
     private:
 
         SmallVector<D3D12_ROOT_PARAMETER, 4u>       nativeRootParams_;
@@ -10,6 +10,7 @@
 #include "../D3D12Types.h"
 #include "../../DXCommon/DXCore.h"
 #include "../../DXCommon/DXTypes.h"
+#include "../../ShaderCacheUtils.h"
 #include "../../../Core/CoreUtils.h"
 #include "../../../Core/ReportUtils.h"
 #include "../../../Core/Exception.h"
@@ -281,12 +282,26 @@ bool D3D12Shader::CompileSource(const ShaderDescriptor& shaderDesc)
     const D3D_SHADER_MACRO* defines = reinterpret_cast<const D3D_SHADER_MACRO*>(shaderDesc.defines);
     int                     flags   = static_cast<int>(shaderDesc.flags);
 
+    #ifdef LLGL_D3D12_ENABLE_DXCOMPILER
+    const bool              useDxc  = IsProfileDxcAppropriate(target);
+    #else
+    const bool              useDxc  = false;
+    #endif
+
+    /* Try to load bytecode from shader cache first */
+    ShaderCache*        shaderCache = renderSystem_.GetShaderCache();
+    const std::uint64_t cacheKey    = (shaderCache != nullptr ? GetShaderCacheKey(shaderDesc, sourceCode, sourceLength, (useDxc ? "DXC" : "FXC")) : 0);
+
+    byteCode_ = DXLoadCachedShader(shaderCache, cacheKey);
+    if (byteCode_)
+        return true;
+
     /* Compile shader code */
     ComPtr<ID3DBlob> errors;
     HRESULT hr = S_OK;
 
     #ifdef LLGL_D3D12_ENABLE_DXCOMPILER
-    if (IsProfileDxcAppropriate(target))
+    if (useDxc)
     {
         /* Load DXC compiler */
         if (FAILED(DXLoadDxcompilerInterface()))
@@ -355,8 +370,11 @@ bool D3D12Shader::CompileSource(const ShaderDescriptor& shaderDesc)
         );
     }
 
-    /* Return true if compilation was successful */
+    /* Store bytecode in shader cache and return true if compilation was successful */
     const bool hasErrors = FAILED(hr);
+    if (!hasErrors)
+        DXStoreCachedShader(shaderCache, cacheKey, byteCode_.Get());
+
     ResetReportWithNewline(report_, DXGetBlobString(errors.Get()), hasErrors);
     return !hasErrors;
 }
@@ -365,8 +383,9 @@ bool D3D12Shader::LoadBinary(const ShaderDescriptor& shaderDesc)
 {
     if (shaderDesc.sourceType == ShaderSourceType::BinaryFile)
     {
-        /* Load binary code from file */
-        byteCode_ = DXCreateBlob(ReadFileBuffer(shaderDesc.source));
+        /* Map binary code from file and copy it into native blob */
+        const Blob fileContent = ReadFileMapped(shaderDesc.source);
+        byteCode_ = DXCreateBlob(fileContent.GetData(), fileContent.GetSize());
     }
     else
     {
@@ -617,6 +636,10 @@ static HRESULT ReflectShaderInputBindings(
                 ReflectShaderResourceGeneric(inputBindDesc, reflection, DXTypes::Unmap(inputBindDesc.Dimension), BindFlags::Storage, stageFlags);
                 break;
 
+            case D3D_SIT_RTACCELERATIONSTRUCTURE:
+                ReflectShaderResourceGeneric(inputBindDesc, reflection, ResourceType::Buffer, BindFlags::AccelerationStructure, stageFlags);
+                break;
+
             default:
                 break;
         }
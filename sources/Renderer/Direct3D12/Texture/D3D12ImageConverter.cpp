@@ -0,0 +1,308 @@
+/*
+ * D3D12ImageConverter.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "D3D12ImageConverter.h"
+#include "D3D12Texture.h"
+#include "../D3D12SubresourceContext.h"
+#include "../Shader/D3D12RootSignature.h"
+#include "../Shader/Builtin/ConvertImageBuffer.hlsl.inl"
+#include "../Command/D3D12CommandContext.h"
+#include "../../DXCommon/DXCore.h"
+#include "../../TextureUtils.h"
+#include "../../../Core/CoreUtils.h"
+#include <LLGL/Utils/ForRange.h>
+#include <d3dcompiler.h>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+// Constant buffer layout of the ConvertImageBuffer HLSL shader.
+struct D3D12ConvertImageDescriptor
+{
+    UINT srcTexelSize;
+    UINT srcComponentSize;
+    UINT srcDataType;
+    UINT dstComponentSize;
+    UINT dstDataType;
+    UINT dstComponents;
+    UINT dstSwizzle;
+    UINT dstDwordsPerRow;
+    UINT dstRowPitch;
+    UINT dstSlicePitch;
+    UINT width;
+    UINT height;
+    UINT numSlices;
+};
+
+static constexpr UINT g_swizzleZero = 4;
+static constexpr UINT g_swizzleOne  = 5;
+
+// Returns the shader enumeration value (DATA_TYPE_*) for the specified data type; 32-bit integers are not supported, since they can not be normalized with single precision.
+static bool GetShaderDataType(DataType dataType, UINT& outDataType)
+{
+    switch (dataType)
+    {
+        case DataType::UInt8:   outDataType = 0; return true;
+        case DataType::Int8:    outDataType = 1; return true;
+        case DataType::UInt16:  outDataType = 2; return true;
+        case DataType::Int16:   outDataType = 3; return true;
+        case DataType::Float16: outDataType = 4; return true;
+        case DataType::Float32: outDataType = 5; return true;
+        default:                return false;
+    }
+}
+
+// Returns the RGBA channel (0 to 3) of each component of the specified image format.
+static bool GetImageFormatChannels(ImageFormat format, UINT (&outChannels)[4], UINT& outNumComponents)
+{
+    switch (format)
+    {
+        case ImageFormat::R:
+            outChannels[0] = 0;
+            outNumComponents = 1;
+            return true;
+        case ImageFormat::RG:
+            outChannels[0] = 0; outChannels[1] = 1;
+            outNumComponents = 2;
+            return true;
+        case ImageFormat::RGB:
+            outChannels[0] = 0; outChannels[1] = 1; outChannels[2] = 2;
+            outNumComponents = 3;
+            return true;
+        case ImageFormat::BGR:
+            outChannels[0] = 2; outChannels[1] = 1; outChannels[2] = 0;
+            outNumComponents = 3;
+            return true;
+        case ImageFormat::RGBA:
+            outChannels[0] = 0; outChannels[1] = 1; outChannels[2] = 2; outChannels[3] = 3;
+            outNumComponents = 4;
+            return true;
+        case ImageFormat::BGRA:
+            outChannels[0] = 2; outChannels[1] = 1; outChannels[2] = 0; outChannels[3] = 3;
+            outNumComponents = 4;
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Returns the source component for each destination component, packed into 4 bits each. Missing channels are (0, 0, 0, 1) like in ConvertImageBuffer().
+static UINT GetComponentSwizzle(const UINT (&srcChannels)[4], UINT srcNumComponents, const UINT (&dstChannels)[4], UINT dstNumComponents)
+{
+    UINT swizzle = 0;
+    for_range(dstComponent, dstNumComponents)
+    {
+        UINT srcComponent = (dstChannels[dstComponent] == 3 ? g_swizzleOne : g_swizzleZero);
+        for_range(i, srcNumComponents)
+        {
+            if (srcChannels[i] == dstChannels[dstComponent])
+            {
+                srcComponent = i;
+                break;
+            }
+        }
+        swizzle |= (srcComponent << (dstComponent * 4u));
+    }
+    return swizzle;
+}
+
+D3D12ImageConverter& D3D12ImageConverter::Get()
+{
+    static D3D12ImageConverter instance;
+    return instance;
+}
+
+void D3D12ImageConverter::InitializeDevice(ID3D12Device* device)
+{
+    /* Store device object only; resources are created on first use since most images are already in the texture format */
+    device_ = device;
+}
+
+void D3D12ImageConverter::Clear()
+{
+    pipelineState_.Reset();
+    rootSignature_.Reset();
+    initialized_ = false;
+}
+
+bool D3D12ImageConverter::WriteTextureRegion(
+    D3D12SubresourceContext&    context,
+    D3D12Texture&               textureD3D,
+    const TextureRegion&        region,
+    const ImageView&            srcImageView)
+{
+    /* Check if the builtin shader supports this conversion */
+    const FormatAttributes& formatAttribs = GetFormatAttribs(textureD3D.GetFormat());
+    if ((formatAttribs.flags & FormatFlags::IsCompressed) != 0 || IsMultiSampleTexture(textureD3D.GetType()))
+        return false;
+
+    UINT srcDataType = 0, dstDataType = 0;
+    if (!GetShaderDataType(srcImageView.dataType, srcDataType) || !GetShaderDataType(formatAttribs.dataType, dstDataType))
+        return false;
+
+    UINT srcChannels[4] = {}, dstChannels[4] = {};
+    UINT srcNumComponents = 0, dstNumComponents = 0;
+    if (!GetImageFormatChannels(srcImageView.format, srcChannels, srcNumComponents) || !GetImageFormatChannels(formatAttribs.format, dstChannels, dstNumComponents))
+        return false;
+
+    if (!CreateResources())
+        return false;
+
+    /* Determine source size and destination footprint; array layers are copied separately, so each layer must start at the placement alignment */
+    const TextureSubresource&   subresource         = region.subresource;
+    const Extent3D              extent              = CalcTextureExtent(textureD3D.GetType(), region.extent);
+    const UINT                  numSlices           = extent.depth * subresource.numArrayLayers;
+    const UINT                  srcDataSize         = static_cast<UINT>(GetMemoryFootprint(srcImageView.format, srcImageView.dataType, extent.width * extent.height * numSlices));
+    const UINT                  dstComponentSize    = DataTypeSize(formatAttribs.dataType);
+    const UINT                  dstRowSize          = extent.width * dstNumComponents * dstComponentSize;
+    const UINT                  dstRowPitch         = GetAlignedSize<UINT>(dstRowSize, D3D12_TEXTURE_DATA_PITCH_ALIGNMENT);
+    UINT                        dstSlicePitch       = dstRowPitch * extent.height;
+
+    if (subresource.numArrayLayers > 1)
+        dstSlicePitch = GetAlignedSize<UINT>(dstSlicePitch, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT);
+
+    /* Upload packed source image; rounded up to DWORDs since the shader only reads whole DWORDs */
+    ID3D12Resource* srcBuffer = context.CreateUploadBuffer(GetAlignedSize<UINT64>(srcDataSize, 4));
+
+    void* mappedData = nullptr;
+    const D3D12_RANGE readRange{ 0, 0 };
+    if (FAILED(srcBuffer->Map(0, &readRange, &mappedData)))
+        return false;
+    ::memcpy(mappedData, srcImageView.data, srcDataSize);
+    srcBuffer->Unmap(0, nullptr);
+
+    /* Expand source image into intermediate buffer with the texture footprint */
+    ID3D12Resource* dstBuffer = context.CreateDefaultBuffer(
+        static_cast<UINT64>(dstSlicePitch) * numSlices,
+        D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS,
+        D3D12_RESOURCE_STATE_UNORDERED_ACCESS
+    );
+
+    D3D12ConvertImageDescriptor convertDesc;
+    {
+        convertDesc.srcTexelSize        = srcNumComponents * DataTypeSize(srcImageView.dataType);
+        convertDesc.srcComponentSize    = DataTypeSize(srcImageView.dataType);
+        convertDesc.srcDataType         = srcDataType;
+        convertDesc.dstComponentSize    = dstComponentSize;
+        convertDesc.dstDataType         = dstDataType;
+        convertDesc.dstComponents       = dstNumComponents;
+        convertDesc.dstSwizzle          = GetComponentSwizzle(srcChannels, srcNumComponents, dstChannels, dstNumComponents);
+        convertDesc.dstDwordsPerRow     = DivideRoundUp(dstRowSize, 4u);
+        convertDesc.dstRowPitch         = dstRowPitch;
+        convertDesc.dstSlicePitch       = dstSlicePitch;
+        convertDesc.width               = extent.width;
+        convertDesc.height              = extent.height;
+        convertDesc.numSlices           = numSlices;
+    }
+
+    D3D12CommandContext&        commandContext  = context.GetCommandContext();
+    ID3D12GraphicsCommandList*  commandList     = context.GetCommandList();
+
+    commandContext.SetComputeRootSignature(rootSignature_.Get());
+    commandContext.SetPipelineState(pipelineState_.Get());
+    commandList->SetComputeRoot32BitConstants(0, sizeof(convertDesc) / 4, &convertDesc, 0);
+    commandContext.SetComputeRootParameter(1, D3D12_ROOT_PARAMETER_TYPE_SRV, srcBuffer->GetGPUVirtualAddress());
+    commandContext.SetComputeRootParameter(2, D3D12_ROOT_PARAMETER_TYPE_UAV, dstBuffer->GetGPUVirtualAddress());
+
+    commandList->Dispatch(DivideRoundUp(convertDesc.dstDwordsPerRow, 64u), extent.height, numSlices);
+
+    /* Copy intermediate buffer into each array layer of the destination texture */
+    const Offset3D dstOffset = CalcTextureOffset(textureD3D.GetType(), region.offset);
+
+    commandContext.TransitionResource(dstBuffer, D3D12_RESOURCE_STATE_COPY_SOURCE, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
+    commandContext.TransitionResource(textureD3D.GetResource(), D3D12_RESOURCE_STATE_COPY_DEST, true);
+    {
+        for_range(arrayLayer, subresource.numArrayLayers)
+        {
+            const TextureLocation               dstLocation     { region.offset, subresource.baseArrayLayer + arrayLayer, subresource.baseMipLevel };
+            const D3D12_TEXTURE_COPY_LOCATION   dstLocationD3D  = textureD3D.CalcCopyLocation(dstLocation);
+            const D3D12_TEXTURE_COPY_LOCATION   srcLocationD3D  = textureD3D.CalcCopyLocation(dstBuffer, static_cast<UINT64>(dstSlicePitch) * extent.depth * arrayLayer, extent, dstRowPitch);
+
+            commandList->CopyTextureRegion(
+                /*pDst:*/       &dstLocationD3D,
+                /*DstX:*/       static_cast<UINT>(dstOffset.x),
+                /*DstY:*/       static_cast<UINT>(dstOffset.y),
+                /*DstZ:*/       static_cast<UINT>(dstOffset.z),
+                /*pSrc:*/       &srcLocationD3D,
+                /*pSrcBox:*/    nullptr
+            );
+        }
+    }
+    commandContext.TransitionResource(textureD3D.GetResource(), textureD3D.GetResource().usageState, true);
+
+    return true;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+// Compiles the builtin conversion shader with FXC, since it is not available as precompiled bytecode.
+static ComPtr<ID3DBlob> DXCompileConvertImageBufferShader()
+{
+    ComPtr<ID3DBlob> byteCode, errors;
+    HRESULT hr = D3DCompile(
+        g_ConvertImageBuffer_HLSL,
+        sizeof(g_ConvertImageBuffer_HLSL) - 1,
+        "ConvertImageBuffer.hlsl",
+        nullptr,
+        nullptr,
+        "ConvertImageBufferCS",
+        "cs_5_0",
+        D3DCOMPILE_OPTIMIZATION_LEVEL3,
+        0,
+        byteCode.ReleaseAndGetAddressOf(),
+        errors.ReleaseAndGetAddressOf()
+    );
+    return (SUCCEEDED(hr) ? byteCode : nullptr);
+}
+
+bool D3D12ImageConverter::CreateResources()
+{
+    if (initialized_)
+        return (pipelineState_.Get() != nullptr);
+
+    initialized_ = true;
+
+    /* Compile shader first; images will be converted on the CPU if this fails */
+    ComPtr<ID3DBlob> shader = DXCompileConvertImageBufferShader();
+    if (!shader)
+        return false;
+
+    /* Initialize root signature with root descriptors for the raw source and destination buffers */
+    D3D12RootSignature rootSignature;
+    {
+        rootSignature.ResetAndAlloc(3, 0);
+        rootSignature[0].InitAsConstants(0, sizeof(D3D12ConvertImageDescriptor) / 4);
+        rootSignature[1].InitAsDescriptor(D3D12_ROOT_PARAMETER_TYPE_SRV, 0);
+        rootSignature[2].InitAsDescriptor(D3D12_ROOT_PARAMETER_TYPE_UAV, 0);
+    }
+    rootSignature_ = rootSignature.Finalize(device_);
+
+    /* Create compute PSO */
+    D3D12_COMPUTE_PIPELINE_STATE_DESC psoDesc = {};
+    {
+        psoDesc.pRootSignature      = rootSignature_.Get();
+        psoDesc.CS.pShaderBytecode  = shader->GetBufferPointer();
+        psoDesc.CS.BytecodeLength   = shader->GetBufferSize();
+    }
+    HRESULT hr = device_->CreateComputePipelineState(&psoDesc, IID_PPV_ARGS(pipelineState_.ReleaseAndGetAddressOf()));
+    DXThrowIfCreateFailed(hr, "ID3D12PipelineState", "for image converter");
+
+    return true;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
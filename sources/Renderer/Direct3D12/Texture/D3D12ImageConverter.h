@@ -0,0 +1,85 @@
+/*
+ * D3D12ImageConverter.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_D3D12_IMAGE_CONVERTER_H
+#define LLGL_D3D12_IMAGE_CONVERTER_H
+
+
+#include <LLGL/ImageFlags.h>
+#include <LLGL/TextureFlags.h>
+#include <d3d12.h>
+#include "../../DXCommon/ComPtr.h"
+
+
+namespace LLGL
+{
+
+
+class D3D12Texture;
+class D3D12SubresourceContext;
+
+/*
+Direct3D 12 image converter singleton for texture uploads.
+Instead of converting image data on the CPU with ConvertImageBuffer(), the packed source image is uploaded as is
+and expanded into the texture format by a builtin compute shader, so less data has to be copied into the upload heap.
+*/
+class D3D12ImageConverter
+{
+
+    public:
+
+        // Returns the singleton instance.
+        static D3D12ImageConverter& Get();
+
+    public:
+
+        D3D12ImageConverter(const D3D12ImageConverter&) = delete;
+        D3D12ImageConverter& operator = (const D3D12ImageConverter&) = delete;
+
+        D3D12ImageConverter(D3D12ImageConverter&&) = delete;
+        D3D12ImageConverter& operator = (D3D12ImageConverter&&) = delete;
+
+        void InitializeDevice(ID3D12Device* device);
+        void Clear();
+
+        /*
+        Uploads the source image into the specified texture region and converts it into the texture format on the GPU.
+        Returns false if this conversion is not supported by the builtin shader, in which case the caller must convert the image on the CPU.
+        */
+        bool WriteTextureRegion(
+            D3D12SubresourceContext&    context,
+            D3D12Texture&               textureD3D,
+            const TextureRegion&        region,
+            const ImageView&            srcImageView
+        );
+
+    private:
+
+        D3D12ImageConverter() = default;
+
+        // Creates the root signature and PSO on first use and returns true if they are available.
+        bool CreateResources();
+
+    private:
+
+        ID3D12Device*                   device_         = nullptr;
+
+        ComPtr<ID3D12RootSignature>     rootSignature_;
+        ComPtr<ID3D12PipelineState>     pipelineState_;
+        bool                            initialized_    = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
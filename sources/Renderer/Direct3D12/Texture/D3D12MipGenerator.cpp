@@ -8,10 +8,14 @@
 #include "D3D12MipGenerator.h"
 #include "D3D12Texture.h"
 #include "../Shader/Builtin/D3D12Builtin.h"
+#include "../Shader/Builtin/GenerateMipsSPD.hlsl.inl"
 #include "../Command/D3D12CommandContext.h"
+#include "../D3DX12/d3dx12.h"
 #include "../../DXCommon/DXCore.h"
 #include "../../DXCommon/DXTypes.h"
 #include "../../../Core/CoreUtils.h"
+#include <LLGL/Utils/ForRange.h>
+#include <d3dcompiler.h>
 
 
 namespace LLGL
@@ -51,6 +55,9 @@ void D3D12MipGenerator::Clear()
     ReleasePipelinesAndRootSignature(rootSignature1D_, pipelines1D_);
     ReleasePipelinesAndRootSignature(rootSignature2D_, pipelines2D_);
     ReleasePipelinesAndRootSignature(rootSignature3D_, pipelines3D_);
+    ReleasePipelinesAndRootSignature(rootSignatureSinglePass_, pipelinesSinglePass_);
+    workGroupCounters_.Reset();
+    singlePassInitialized_ = false;
 }
 
 HRESULT D3D12MipGenerator::GenerateMips(
@@ -223,6 +230,88 @@ void D3D12MipGenerator::CreateResourcesFor3DMips(ID3D12Device* device)
     pipelines3D_[0xF] = CreateComputePSO( device, rootSignature3D_.Get(), LLGL_IDR_GENERATEMIPS3D_CS_SRGB_ODDXYZ, sizeof(LLGL_IDR_GENERATEMIPS3D_CS_SRGB_ODDXYZ));
 }
 
+// Compiles the builtin single-pass downsampler with FXC, since it is not available as precompiled bytecode.
+static ComPtr<ID3DBlob> DXCompileSinglePassMipShader(bool linearToSRGB)
+{
+    const D3D_SHADER_MACRO definesSRGB[] = { { "LINEAR_TO_SRGB", "1" }, { nullptr, nullptr } };
+
+    ComPtr<ID3DBlob> byteCode, errors;
+    HRESULT hr = D3DCompile(
+        g_GenerateMipsSPD_HLSL,
+        sizeof(g_GenerateMipsSPD_HLSL) - 1,
+        "GenerateMipsSPD.hlsl",
+        (linearToSRGB ? definesSRGB : nullptr),
+        nullptr,
+        "GenerateMipsSPDCS",
+        "cs_5_0",
+        D3DCOMPILE_OPTIMIZATION_LEVEL3,
+        0,
+        byteCode.ReleaseAndGetAddressOf(),
+        errors.ReleaseAndGetAddressOf()
+    );
+    return (SUCCEEDED(hr) ? byteCode : nullptr);
+}
+
+bool D3D12MipGenerator::CreateResourcesForSinglePassMips()
+{
+    if (singlePassInitialized_)
+        return (pipelinesSinglePass_[0] && pipelinesSinglePass_[1]);
+
+    singlePassInitialized_ = true;
+
+    /* Compile shaders first; fall back to the multi-pass generator if this fails */
+    ComPtr<ID3DBlob> shaderLinear = DXCompileSinglePassMipShader(false);
+    ComPtr<ID3DBlob> shaderSRGB   = DXCompileSinglePassMipShader(true);
+    if (!shaderLinear || !shaderSRGB)
+        return false;
+
+    /* Initialize root signature */
+    D3D12RootSignature rootSignature;
+    {
+        rootSignature.ResetAndAlloc(4, 1);
+        rootSignature[0].InitAsConstants(0, 6);
+        rootSignature[1].InitAsDescriptorRange(D3D12_DESCRIPTOR_RANGE_TYPE_SRV, 0, 1);
+        rootSignature[2].InitAsDescriptorRange(D3D12_DESCRIPTOR_RANGE_TYPE_UAV, 0, 12);
+        rootSignature[3].InitAsDescriptor(D3D12_ROOT_PARAMETER_TYPE_UAV, 12);
+        auto samplerDesc = rootSignature.AppendStaticSampler();
+        {
+            samplerDesc->Filter = D3D12_FILTER_MIN_MAG_LINEAR_MIP_POINT;
+        }
+    }
+    rootSignatureSinglePass_ = rootSignature.Finalize(device_);
+
+    /* Create PSOs for linear and sRGB formats */
+    pipelinesSinglePass_[0] = CreateComputePSO(device_, rootSignatureSinglePass_.Get(), static_cast<const BYTE*>(shaderLinear->GetBufferPointer()), shaderLinear->GetBufferSize());
+    pipelinesSinglePass_[1] = CreateComputePSO(device_, rootSignatureSinglePass_.Get(), static_cast<const BYTE*>(shaderSRGB->GetBufferPointer()), shaderSRGB->GetBufferSize());
+
+    /* Create zero-initialized buffer for one atomic work group counter per array layer; the last work group resets its counter */
+    const CD3DX12_HEAP_PROPERTIES heapProperties{ D3D12_HEAP_TYPE_DEFAULT };
+    const CD3DX12_RESOURCE_DESC bufferDesc = CD3DX12_RESOURCE_DESC::Buffer(
+        D3D12_REQ_TEXTURE2D_ARRAY_AXIS_DIMENSION * sizeof(UINT),
+        D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS
+    );
+    HRESULT hr = device_->CreateCommittedResource(
+        &heapProperties,
+        D3D12_HEAP_FLAG_NONE,
+        &bufferDesc,
+        D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
+        nullptr,
+        IID_PPV_ARGS(workGroupCounters_.ReleaseAndGetAddressOf())
+    );
+    DXThrowIfCreateFailed(hr, "ID3D12Resource", "for MIP-map work group counters");
+
+    return true;
+}
+
+bool D3D12MipGenerator::SupportsTypedUAVLoad(DXGI_FORMAT format) const
+{
+    D3D12_FEATURE_DATA_FORMAT_SUPPORT formatSupport = {};
+    formatSupport.Format = DXTypes::ToDXGIFormatUAV(format);
+    if (FAILED(device_->CheckFeatureSupport(D3D12_FEATURE_FORMAT_SUPPORT, &formatSupport, sizeof(formatSupport))))
+        return false;
+    return ((formatSupport.Support2 & D3D12_FORMAT_SUPPORT2_UAV_TYPED_LOAD) != 0);
+}
+
 void D3D12MipGenerator::GenerateMips1D(
     D3D12CommandContext&        commandContext,
     D3D12Resource&              resource,
@@ -293,6 +382,20 @@ void D3D12MipGenerator::GenerateMips1D(
     commandContext.TransitionResource(resource, resource.usageState, true);
 }
 
+// Returns true if all source levels of the MIP-map chain have even or unit size, which is required by the single-pass downsampler.
+static bool IsSinglePassMipChainSupported(UINT width, UINT height, const TextureSubresource& subresource)
+{
+    const std::uint32_t mipLevelEnd = subresource.baseMipLevel + subresource.numMipLevels - 1;
+    for_subrange(mipLevel, subresource.baseMipLevel, mipLevelEnd)
+    {
+        const UINT srcWidth     = std::max(1u, width  >> mipLevel);
+        const UINT srcHeight    = std::max(1u, height >> mipLevel);
+        if ((srcWidth > 1 && (srcWidth & 1) != 0) || (srcHeight > 1 && (srcHeight & 1) != 0))
+            return false;
+    }
+    return true;
+}
+
 void D3D12MipGenerator::GenerateMips2D(
     D3D12CommandContext&        commandContext,
     D3D12Resource&              resource,
@@ -300,6 +403,14 @@ void D3D12MipGenerator::GenerateMips2D(
     DXGI_FORMAT                 format,
     const TextureSubresource&   subresource)
 {
+    /* Prefer single-pass downsampler if the MIP-map chain can be generated with a 2x2 box filter */
+    D3D12_RESOURCE_DESC resourceDesc = resource.native->GetDesc();
+    if (IsSinglePassMipChainSupported(static_cast<UINT>(resourceDesc.Width), resourceDesc.Height, subresource) && CreateResourcesForSinglePassMips())
+    {
+        GenerateMips2DSinglePass(commandContext, resource, mipDescHeap, format, subresource);
+        return;
+    }
+
     const bool isFormatSRGB = DXTypes::IsDXGIFormatSRGB(format);
 
     ID3D12GraphicsCommandList* commandList = commandContext.GetCommandList();
@@ -318,8 +429,6 @@ void D3D12MipGenerator::GenerateMips2D(
     commandList->SetComputeRootDescriptorTable(1, gpuDescHandle);
     gpuDescHandle.ptr += descHandleSize_;
 
-    D3D12_RESOURCE_DESC resourceDesc = resource.native->GetDesc();
-
     const std::uint32_t mipLevelEnd = subresource.baseMipLevel + subresource.numMipLevels - 1;
 
     for (std::uint32_t mipLevel = subresource.baseMipLevel; mipLevel < mipLevelEnd;)
@@ -366,6 +475,82 @@ void D3D12MipGenerator::GenerateMips2D(
     commandContext.TransitionResource(resource, resource.usageState, true);
 }
 
+void D3D12MipGenerator::GenerateMips2DSinglePass(
+    D3D12CommandContext&        commandContext,
+    D3D12Resource&              resource,
+    ID3D12DescriptorHeap*       mipDescHeap,
+    DXGI_FORMAT                 format,
+    const TextureSubresource&   subresource)
+{
+    const bool isFormatSRGB = DXTypes::IsDXGIFormatSRGB(format);
+
+    /* The last work group reads back the 7th generated level, which requires typed UAV loads */
+    const bool hasTypedUAVLoad = SupportsTypedUAVLoad(format);
+
+    ID3D12GraphicsCommandList* commandList = commandContext.GetCommandList();
+
+    commandContext.TransitionResource(resource, D3D12_RESOURCE_STATE_UNORDERED_ACCESS, true);
+
+    /* Set root signature, descriptor heap, and pipeline state */
+    commandContext.SetComputeRootSignature(rootSignatureSinglePass_.Get());
+
+    ID3D12DescriptorHeap* descHeaps[] = { mipDescHeap };
+    commandContext.SetDescriptorHeaps(1, descHeaps);
+
+    commandContext.SetPipelineState(pipelinesSinglePass_[isFormatSRGB ? 1 : 0].Get());
+
+    /* Set SRV to read from entire MIP-map chain and UAV for work group counters */
+    D3D12_GPU_DESCRIPTOR_HANDLE gpuDescHandle = mipDescHeap->GetGPUDescriptorHandleForHeapStart();
+    commandList->SetComputeRootDescriptorTable(1, gpuDescHandle);
+    commandContext.SetComputeRootParameter(3, D3D12_ROOT_PARAMETER_TYPE_UAV, workGroupCounters_->GetGPUVirtualAddress());
+
+    D3D12_RESOURCE_DESC resourceDesc = resource.native->GetDesc();
+
+    const std::uint32_t mipLevelEnd = subresource.baseMipLevel + subresource.numMipLevels - 1;
+
+    for (std::uint32_t mipLevel = subresource.baseMipLevel; mipLevel < mipLevelEnd;)
+    {
+        /* Determine source extent */
+        UINT srcWidth   = std::max(1u, static_cast<UINT>(resourceDesc.Width)  >> mipLevel);
+        UINT srcHeight  = std::max(1u, static_cast<UINT>(resourceDesc.Height) >> mipLevel);
+
+        /*
+        Determine how many MIP-maps can be downsampled at once; must be in [1, 12].
+        More than 7 levels require typed UAV loads and the last work group can only read back 32x32 texels of the 7th level.
+        */
+        UINT numMips = std::min(mipLevelEnd - mipLevel, 12u);
+        if (numMips > 7 && (!hasTypedUAVLoad || srcWidth > 4096 || srcHeight > 4096))
+            numMips = 7;
+
+        /* Each work group downsamples a tile of 128x128 source texels */
+        const UINT numWorkGroupsX = DivideRoundUp(srcWidth,  128u);
+        const UINT numWorkGroupsY = DivideRoundUp(srcHeight, 128u);
+
+        /* Run compute shader to generate all MIP-maps of this batch */
+        commandContext.SetComputeConstant(0, srcWidth, 0);
+        commandContext.SetComputeConstant(0, srcHeight, 1);
+        commandContext.SetComputeConstant(0, mipLevel, 2);
+        commandContext.SetComputeConstant(0, numMips, 3);
+        commandContext.SetComputeConstant(0, subresource.baseArrayLayer, 4);
+        commandContext.SetComputeConstant(0, numWorkGroupsX * numWorkGroupsY, 5);
+
+        /* UAV of each MIP-map level is located at the descriptor that corresponds to its level */
+        D3D12_GPU_DESCRIPTOR_HANDLE uavDescHandle = gpuDescHandle;
+        uavDescHandle.ptr += descHandleSize_ * (mipLevel + 1);
+        commandList->SetComputeRootDescriptorTable(2, uavDescHandle);
+
+        commandList->Dispatch(numWorkGroupsX, numWorkGroupsY, subresource.numArrayLayers);
+
+        /* Insert UAV barriers for texture and counters before the next batch */
+        commandContext.InsertUAVBarrier(workGroupCounters_.Get());
+        commandContext.InsertUAVBarrier(resource, true);
+
+        mipLevel += numMips;
+    }
+
+    commandContext.TransitionResource(resource, resource.usageState, true);
+}
+
 void D3D12MipGenerator::GenerateMips3D(
     D3D12CommandContext&        commandContext,
     D3D12Resource&              resource,
@@ -66,6 +66,12 @@ class D3D12MipGenerator
         void CreateResourcesFor2DMips(ID3D12Device* device);
         void CreateResourcesFor3DMips(ID3D12Device* device);
 
+        // Creates the resources for the single-pass downsampler on first use and returns true if they are available.
+        bool CreateResourcesForSinglePassMips();
+
+        // Returns true if the specified format supports typed UAV loads, which the single-pass downsampler needs to read back intermediate levels.
+        bool SupportsTypedUAVLoad(DXGI_FORMAT format) const;
+
         void GenerateMips1D(
             D3D12CommandContext&        commandContext,
             D3D12Resource&              resource,
@@ -82,6 +88,14 @@ class D3D12MipGenerator
             const TextureSubresource&   subresource
         );
 
+        void GenerateMips2DSinglePass(
+            D3D12CommandContext&        commandContext,
+            D3D12Resource&              resource,
+            ID3D12DescriptorHeap*       mipDescHeap,
+            DXGI_FORMAT                 format,
+            const TextureSubresource&   subresource
+        );
+
         void GenerateMips3D(
             D3D12CommandContext&        commandContext,
             D3D12Resource&              resource,
@@ -103,8 +117,12 @@ class D3D12MipGenerator
         ComPtr<ID3D12RootSignature> rootSignature3D_;
         ComPtr<ID3D12PipelineState> pipelines3D_[16];
 
-        UINT                        descHandleSize_     = 0;
+        ComPtr<ID3D12RootSignature> rootSignatureSinglePass_;
+        ComPtr<ID3D12PipelineState> pipelinesSinglePass_[2];
+        ComPtr<ID3D12Resource>      workGroupCounters_;     // Atomic work group counter per array layer for the single-pass downsampler.
+        bool                        singlePassInitialized_  = false;
 
+        UINT                        descHandleSize_         = 0;
 
 };
 
@@ -11,7 +11,6 @@
 #include "../D3D12Device.h"
 #include "../D3D12Types.h"
 #include "../Command/D3D12CommandContext.h"
-#include "../RenderState/D3D12DescriptorHeap.h"
 #include "../../DXCommon/DXTypes.h"
 #include "../../DXCommon/DXCore.h"
 #include "../../CheckedCast.h"
@@ -26,13 +25,20 @@ namespace LLGL
 {
 
 
-D3D12RenderTarget::D3D12RenderTarget(D3D12Device& device, const RenderTargetDescriptor& desc) :
-    resolution_ { desc.resolution }
+D3D12RenderTarget::D3D12RenderTarget(
+    D3D12Device&                    device,
+    const RenderTargetDescriptor&   desc,
+    D3D12CPUDescriptorHeapPool&     rtvHeapPool,
+    D3D12CPUDescriptorHeapPool&     dsvHeapPool)
+:
+    resolution_  { desc.resolution },
+    rtvHeapPool_ { rtvHeapPool     },
+    dsvHeapPool_ { dsvHeapPool     }
 {
     ColorFormatVector colorFormats;
     const UINT numColorFormats = GatherAttachmentFormats(device, desc, colorFormats);
 
-    CreateDescriptorHeaps(device.GetNative(), numColorFormats);
+    AllocDescriptors(numColorFormats);
     CreateAttachments(device.GetNative(), desc, colorFormats);
     defaultRenderPass_.BuildAttachments(numColorFormats, colorFormats.data(), depthStencilFormat_, sampleDesc_);
 
@@ -40,10 +46,18 @@ D3D12RenderTarget::D3D12RenderTarget(D3D12Device& device, const RenderTargetDesc
         SetDebugName(desc.debugName);
 }
 
+D3D12RenderTarget::~D3D12RenderTarget()
+{
+    /* Return descriptors to their pools; CPU descriptors are consumed when commands are recorded, so they can be recycled immediately */
+    rtvHeapPool_.Free(rtvRange_);
+    dsvHeapPool_.Free(dsvRange_);
+}
+
 void D3D12RenderTarget::SetDebugName(const char* name)
 {
-    D3D12SetObjectNameSubscript(rtvDescHeap_.Get(), name, ".RTV");
-    D3D12SetObjectNameSubscript(dsvDescHeap_.Get(), name, ".DSV");
+    /* Descriptor heaps are shared with other render targets, so only the internal attachments are labeled */
+    for_range(i, internalTextures_.size())
+        D3D12SetObjectNameIndexed(internalTextures_[i].Get(), name, static_cast<std::uint32_t>(i));
 }
 
 Extent2D D3D12RenderTarget::GetResolution() const
@@ -63,12 +77,12 @@ std::uint32_t D3D12RenderTarget::GetNumColorAttachments() const
 
 bool D3D12RenderTarget::HasDepthAttachment() const
 {
-    return (dsvDescHeap_.Get() != nullptr);
+    return (dsvRange_.count > 0);
 }
 
 bool D3D12RenderTarget::HasStencilAttachment() const
 {
-    return (dsvDescHeap_.Get() != nullptr && DXTypes::HasStencilComponent(depthStencilFormat_));
+    return (dsvRange_.count > 0 && DXTypes::HasStencilComponent(depthStencilFormat_));
 }
 
 const RenderPass* D3D12RenderTarget::GetRenderPass() const
@@ -78,6 +92,9 @@ const RenderPass* D3D12RenderTarget::GetRenderPass() const
 
 void D3D12RenderTarget::TransitionToOutputMerger(D3D12CommandContext& commandContext)
 {
+    for (D3D12Texture* texture : transientTextures_)
+        texture->ActivateTransient(commandContext);
+
     for (auto& resource : colorBuffers_)
         commandContext.TransitionResource(*resource, D3D12_RESOURCE_STATE_RENDER_TARGET);
 
@@ -108,26 +125,19 @@ void D3D12RenderTarget::ResolveSubresources(D3D12CommandContext& commandContext)
             commandContext.TransitionResource(*resource, resource->usageState);
     }
 
+    /* Barriers are flushed with the next command, so they can be merged with the transitions of the next render pass */
     if (depthStencil_ != nullptr)
         commandContext.TransitionResource(*depthStencil_, depthStencil_->usageState);
-
-    commandContext.FlushResourceBarrieres();
 }
 
 D3D12_CPU_DESCRIPTOR_HANDLE D3D12RenderTarget::GetCPUDescriptorHandleForRTV() const
 {
-    if (rtvDescHeap_)
-        return rtvDescHeap_->GetCPUDescriptorHandleForHeapStart();
-    else
-        return {};
+    return rtvRange_.handle;
 }
 
 D3D12_CPU_DESCRIPTOR_HANDLE D3D12RenderTarget::GetCPUDescriptorHandleForDSV() const
 {
-    if (dsvDescHeap_)
-        return dsvDescHeap_->GetCPUDescriptorHandleForHeapStart();
-    else
-        return {};
+    return dsvRange_.handle;
 }
 
 
@@ -195,33 +205,15 @@ UINT D3D12RenderTarget::GatherAttachmentFormats(D3D12Device& device, const Rende
     return static_cast<UINT>(outColorFormats.size());
 }
 
-void D3D12RenderTarget::CreateDescriptorHeaps(ID3D12Device* device, const UINT numColorTargets)
+void D3D12RenderTarget::AllocDescriptors(const UINT numColorTargets)
 {
-    /* Create RTV descriptor heap */
+    /* Allocate contiguous RTVs, so all color attachments can be bound as a single descriptor range */
     if (numColorTargets > 0)
-    {
-        D3D12_DESCRIPTOR_HEAP_DESC heapDesc;
-        {
-            heapDesc.Type           = D3D12_DESCRIPTOR_HEAP_TYPE_RTV;
-            heapDesc.NumDescriptors = numColorTargets;
-            heapDesc.Flags          = D3D12_DESCRIPTOR_HEAP_FLAG_NONE;
-            heapDesc.NodeMask       = 0;
-        }
-        rtvDescHeap_ = D3D12DescriptorHeap::CreateNativeOrThrow(device, heapDesc);
-    }
+        rtvRange_ = rtvHeapPool_.Alloc(numColorTargets);
 
-    /* Create DSV descriptor heap */
+    /* Allocate DSV */
     if (depthStencilFormat_ != DXGI_FORMAT_UNKNOWN)
-    {
-        D3D12_DESCRIPTOR_HEAP_DESC heapDesc;
-        {
-            heapDesc.Type           = D3D12_DESCRIPTOR_HEAP_TYPE_DSV;
-            heapDesc.NumDescriptors = 1;
-            heapDesc.Flags          = D3D12_DESCRIPTOR_HEAP_FLAG_NONE;
-            heapDesc.NodeMask       = 0;
-        }
-        dsvDescHeap_ = D3D12DescriptorHeap::CreateNativeOrThrow(device, heapDesc);
-    }
+        dsvRange_ = dsvHeapPool_.Alloc(1);
 }
 
 void D3D12RenderTarget::CreateAttachments(
@@ -229,18 +221,13 @@ void D3D12RenderTarget::CreateAttachments(
     const RenderTargetDescriptor&   desc,
     const ColorFormatVector&        colorFormats)
 {
-    if (rtvDescHeap_)
+    for_range(i, colorFormats.size())
     {
-        D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle = rtvDescHeap_->GetCPUDescriptorHandleForHeapStart();
-        const UINT rtvDescSize = device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_RTV);
-        for_range(i, colorFormats.size())
-        {
-            CreateColorAttachment(device, desc.colorAttachments[i], desc.resolveAttachments[i], colorFormats[i], cpuDescHandle);
-            cpuDescHandle.ptr += rtvDescSize;
-        }
+        D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle = rtvHeapPool_.GetCpuHandle(rtvRange_, static_cast<UINT>(i));
+        CreateColorAttachment(device, desc.colorAttachments[i], desc.resolveAttachments[i], colorFormats[i], cpuDescHandle);
     }
-    if (dsvDescHeap_)
-        CreateDepthStencilAttachment(device, desc.depthStencilAttachment, dsvDescHeap_->GetCPUDescriptorHandleForHeapStart());
+    if (dsvRange_.count > 0)
+        CreateDepthStencilAttachment(device, desc.depthStencilAttachment, dsvRange_.handle);
 }
 
 void D3D12RenderTarget::CreateColorAttachment(
@@ -258,6 +245,8 @@ void D3D12RenderTarget::CreateColorAttachment(
         ValidateMipResolution(*texture, colorAttachment.mipLevel);
         auto& textureD3D = LLGL_CAST(D3D12Texture&, *texture);
         colorBuffer = &(textureD3D.GetResource());
+        if (textureD3D.IsTransient())
+            transientTextures_.push_back(&textureD3D);
         CreateRenderTargetView(
             device,
             *colorBuffer,
@@ -299,6 +288,8 @@ void D3D12RenderTarget::CreateDepthStencilAttachment(
         ValidateMipResolution(*texture, depthStenciAttachment.mipLevel);
         auto& textureD3D = LLGL_CAST(D3D12Texture&, *texture);
         depthStencil_ = &(textureD3D.GetResource());
+        if (textureD3D.IsTransient())
+            transientTextures_.push_back(&textureD3D);
         CreateDepthStencilView(
             device,
             *depthStencil_,
@@ -480,7 +471,7 @@ void D3D12RenderTarget::CreateDepthStencilView(
     }
 
     /* Create DSV and store reference to resource */
-    device->CreateDepthStencilView(resource.Get(), &dsvDesc, dsvDescHeap_->GetCPUDescriptorHandleForHeapStart());
+    device->CreateDepthStencilView(resource.Get(), &dsvDesc, dsvRange_.handle);
 }
 
 void D3D12RenderTarget::CreateResolveTarget(
@@ -492,6 +483,8 @@ void D3D12RenderTarget::CreateResolveTarget(
 
     ValidateMipResolution(*resolveAttachment.texture, resolveAttachment.mipLevel);
     auto& textureD3D = LLGL_CAST(D3D12Texture&, *resolveAttachment.texture);
+    if (textureD3D.IsTransient())
+        transientTextures_.push_back(&textureD3D);
 
     ResolveTarget resolveTarget;
     {
@@ -13,6 +13,7 @@
 #include <LLGL/Container/SmallVector.h>
 #include "../D3D12Resource.h"
 #include "../RenderState/D3D12RenderPass.h"
+#include "../RenderState/D3D12CPUDescriptorHeapPool.h"
 #include <d3d12.h>
 #include "../../DXCommon/ComPtr.h"
 
@@ -38,7 +39,13 @@ class D3D12RenderTarget final : public RenderTarget
 
     public:
 
-        D3D12RenderTarget(D3D12Device& device, const RenderTargetDescriptor& desc);
+        D3D12RenderTarget(
+            D3D12Device&                    device,
+            const RenderTargetDescriptor&   desc,
+            D3D12CPUDescriptorHeapPool&     rtvHeapPool,
+            D3D12CPUDescriptorHeapPool&     dsvHeapPool
+        );
+        ~D3D12RenderTarget();
 
         void TransitionToOutputMerger(D3D12CommandContext& commandContext);
         void ResolveSubresources(D3D12CommandContext& commandContext);
@@ -58,7 +65,7 @@ class D3D12RenderTarget final : public RenderTarget
 
         UINT GatherAttachmentFormats(D3D12Device& device, const RenderTargetDescriptor& desc, ColorFormatVector& outColorFormats);
 
-        void CreateDescriptorHeaps(ID3D12Device* device, const UINT numColorTargets);
+        void AllocDescriptors(const UINT numColorTargets);
 
         void CreateAttachments(
             ID3D12Device*                   device,
@@ -130,8 +137,10 @@ class D3D12RenderTarget final : public RenderTarget
         DXGI_SAMPLE_DESC                sampleDesc_         = { 1, 0 };
 
         // Objects:
-        ComPtr<ID3D12DescriptorHeap>    rtvDescHeap_;
-        ComPtr<ID3D12DescriptorHeap>    dsvDescHeap_;
+        D3D12CPUDescriptorHeapPool&     rtvHeapPool_;
+        D3D12CPUDescriptorHeapPool&     dsvHeapPool_;
+        D3D12CPUDescriptorRange         rtvRange_;
+        D3D12CPUDescriptorRange         dsvRange_;
         DXGI_FORMAT                     depthStencilFormat_ = DXGI_FORMAT_UNKNOWN;
         D3D12RenderPass                 defaultRenderPass_;
 
@@ -140,6 +149,7 @@ class D3D12RenderTarget final : public RenderTarget
         std::vector<D3D12Resource*>     colorBuffers_;
         std::vector<ResolveTarget>      resolveTargets_;
         D3D12Resource*                  depthStencil_       = nullptr;
+        std::vector<D3D12Texture*>      transientTextures_; // Attachments that must be activated in their transient heaps when rendering begins.
 
 };
 
@@ -0,0 +1,276 @@
+/*
+ * D3D12SparseTextureMemory.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "D3D12SparseTextureMemory.h"
+#include "../D3DX12/d3dx12.h"
+#include "../../../Core/Exception.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+static D3D12_TILED_RESOURCE_COORDINATE MakeD3D12TiledResourceCoord(UINT x, UINT y, UINT subresource)
+{
+    D3D12_TILED_RESOURCE_COORDINATE coord;
+    {
+        coord.X             = x;
+        coord.Y             = y;
+        coord.Z             = 0;
+        coord.Subresource   = subresource;
+    }
+    return coord;
+}
+
+D3D12SparseTextureMemory::D3D12SparseTextureMemory(
+    ID3D12Device*       device,
+    ID3D12Resource*     resource,
+    D3D12TileHeapPool&  tileHeapPool,
+    UINT                numMipLevels,
+    UINT                numArrayLayers,
+    bool                isRenderTarget)
+:
+    device_         { device         },
+    resource_       { resource       },
+    tileHeapPool_   { tileHeapPool   },
+    numMipLevels_   { numMipLevels   },
+    numArrayLayers_ { numArrayLayers },
+    isRenderTarget_ { isRenderTarget }
+{
+    /* Query tiling of the MIP-map levels of the first array layer; all other layers have the same tiling */
+    UINT numTilesTotal          = 0;
+    UINT numSubresourceTilings  = numMipLevels;
+    mipTilings_.resize(numMipLevels);
+    device->GetResourceTiling(resource, &numTilesTotal, &packedMipInfo_, &tileShape_, &numSubresourceTilings, 0, mipTilings_.data());
+    mipTilings_.resize(packedMipInfo_.NumStandardMips);
+
+    /* Allocate table of tiles for all standard MIP-map levels */
+    mipTileOffsets_.resize(packedMipInfo_.NumStandardMips);
+    for (UINT mipLevel = 0; mipLevel < packedMipInfo_.NumStandardMips; ++mipLevel)
+    {
+        const D3D12_SUBRESOURCE_TILING& tiling = mipTilings_[mipLevel];
+        mipTileOffsets_[mipLevel] = numTilesPerLayer_;
+        numTilesPerLayer_ += tiling.WidthInTiles * tiling.HeightInTiles;
+    }
+    tiles_.resize(static_cast<std::size_t>(numTilesPerLayer_) * numArrayLayers);
+}
+
+D3D12SparseTextureMemory::~D3D12SparseTextureMemory()
+{
+    for (const D3D12TileLocation& tile : tiles_)
+        tileHeapPool_.FreeTile(tile);
+    for (const D3D12TileLocation& tile : packedTiles_)
+        tileHeapPool_.FreeTile(tile);
+}
+
+void D3D12SparseTextureMemory::MapPackedMips(ID3D12CommandQueue* commandQueue)
+{
+    if (packedMipInfo_.NumPackedMips == 0 || !packedTiles_.empty())
+        return;
+
+    /* Packed MIP-map levels are addressed by tile index relative to the first packed subresource of each array layer */
+    std::vector<TileMapping> mappings;
+    mappings.reserve(static_cast<std::size_t>(packedMipInfo_.NumTilesForPackedMips) * numArrayLayers_);
+
+    for (UINT arrayLayer = 0; arrayLayer < numArrayLayers_; ++arrayLayer)
+    {
+        const UINT subresource = D3D12CalcSubresource(packedMipInfo_.NumStandardMips, arrayLayer, 0, numMipLevels_, numArrayLayers_);
+        for (UINT tile = 0; tile < packedMipInfo_.NumTilesForPackedMips; ++tile)
+        {
+            TileMapping mapping;
+            {
+                mapping.coord       = MakeD3D12TiledResourceCoord(tile, 0, subresource);
+                mapping.location    = tileHeapPool_.AllocTile(device_, isRenderTarget_);
+            }
+            if (mapping.location.heap == nullptr)
+                LLGL_TRAP("failed to allocate tile heap for packed MIP-maps of D3D12 sparse texture");
+            packedTiles_.push_back(mapping.location);
+            mappings.push_back(mapping);
+        }
+    }
+
+    MapTiles(commandQueue, mappings);
+}
+
+bool D3D12SparseTextureMemory::UpdateTileMappings(ID3D12CommandQueue* commandQueue, const TextureRegion& region, bool commit)
+{
+    /* Packed MIP-map levels are always resident */
+    const UINT mipLevel = region.subresource.baseMipLevel;
+    if (mipLevel >= packedMipInfo_.NumStandardMips || tileShape_.WidthInTexels == 0 || tileShape_.HeightInTexels == 0)
+        return false;
+
+    /* Determine range of tiles that are covered by the region */
+    const D3D12_SUBRESOURCE_TILING& tiling = mipTilings_[mipLevel];
+
+    const UINT offsetX      = static_cast<UINT>(std::max(0, region.offset.x));
+    const UINT offsetY      = static_cast<UINT>(std::max(0, region.offset.y));
+    const UINT tileBeginX   = offsetX / tileShape_.WidthInTexels;
+    const UINT tileBeginY   = offsetY / tileShape_.HeightInTexels;
+    const UINT tileEndX     = std::min<UINT>((offsetX + region.extent.width  + tileShape_.WidthInTexels  - 1) / tileShape_.WidthInTexels,  tiling.WidthInTiles );
+    const UINT tileEndY     = std::min<UINT>((offsetY + region.extent.height + tileShape_.HeightInTexels - 1) / tileShape_.HeightInTexels, tiling.HeightInTiles);
+    const UINT layerBegin   = std::min(region.subresource.baseArrayLayer, numArrayLayers_);
+    const UINT layerEnd     = std::min(region.subresource.baseArrayLayer + region.subresource.numArrayLayers, numArrayLayers_);
+
+    std::vector<TileMapping> mappings;
+    std::vector<D3D12_TILED_RESOURCE_COORDINATE> unmappedCoords;
+    std::vector<D3D12TileLocation> releasedTiles;
+    bool result = true;
+
+    for (UINT arrayLayer = layerBegin; arrayLayer < layerEnd; ++arrayLayer)
+    {
+        const UINT subresource = D3D12CalcSubresource(mipLevel, arrayLayer, 0, numMipLevels_, numArrayLayers_);
+        for (UINT tileY = tileBeginY; tileY < tileEndY; ++tileY)
+        {
+            for (UINT tileX = tileBeginX; tileX < tileEndX; ++tileX)
+            {
+                /* Skip tiles that are already in the requested state */
+                D3D12TileLocation& tile = tiles_[GetTileIndex(mipLevel, arrayLayer, tileX, tileY)];
+                if (commit == (tile.heap != nullptr))
+                    continue;
+
+                if (commit)
+                {
+                    tile = tileHeapPool_.AllocTile(device_, isRenderTarget_);
+                    if (tile.heap == nullptr)
+                    {
+                        result = false;
+                        continue;
+                    }
+                    mappings.push_back(TileMapping{ MakeD3D12TiledResourceCoord(tileX, tileY, subresource), tile });
+                }
+                else
+                {
+                    unmappedCoords.push_back(MakeD3D12TiledResourceCoord(tileX, tileY, subresource));
+                    releasedTiles.push_back(tile);
+                    tile = D3D12TileLocation{};
+                }
+            }
+        }
+    }
+
+    if (!mappings.empty())
+        MapTiles(commandQueue, mappings);
+
+    if (!unmappedCoords.empty())
+    {
+        UnmapTiles(commandQueue, unmappedCoords);
+
+        /* Freed tiles are only mapped again by subsequent updates on the queue, which are ordered after this one */
+        for (const D3D12TileLocation& tile : releasedTiles)
+            tileHeapPool_.FreeTile(tile);
+    }
+
+    return result;
+}
+
+void D3D12SparseTextureMemory::GetProperties(SparseTextureProperties& outProperties) const
+{
+    outProperties.tileExtent    = Extent3D{ tileShape_.WidthInTexels, tileShape_.HeightInTexels, tileShape_.DepthInTexels };
+    outProperties.tileSize      = D3D12_TILED_RESOURCE_TILE_SIZE_IN_BYTES;
+    outProperties.firstMipTail  = packedMipInfo_.NumStandardMips;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void D3D12SparseTextureMemory::MapTiles(ID3D12CommandQueue* commandQueue, std::vector<TileMapping>& mappings)
+{
+    /* UpdateTileMappings() maps tiles into a single heap per call, so group mappings by heap */
+    std::sort(
+        mappings.begin(),
+        mappings.end(),
+        [](const TileMapping& lhs, const TileMapping& rhs) -> bool
+        {
+            return (lhs.location.heap < rhs.location.heap);
+        }
+    );
+
+    std::vector<D3D12_TILED_RESOURCE_COORDINATE> coords;
+    std::vector<UINT> heapOffsets;
+    coords.reserve(mappings.size());
+    heapOffsets.reserve(mappings.size());
+
+    const D3D12_TILE_REGION_SIZE regionSize{ 1, FALSE, 0, 0, 0 };
+
+    for (std::size_t first = 0; first < mappings.size();)
+    {
+        D3D12TileHeap* heap = mappings[first].location.heap;
+
+        coords.clear();
+        heapOffsets.clear();
+
+        std::size_t last = first;
+        for (; last < mappings.size() && mappings[last].location.heap == heap; ++last)
+        {
+            coords.push_back(mappings[last].coord);
+            heapOffsets.push_back(mappings[last].location.tile);
+        }
+
+        /* Each region and each heap range is a single tile */
+        const UINT numTiles = static_cast<UINT>(coords.size());
+        const std::vector<D3D12_TILE_REGION_SIZE> regionSizes(numTiles, regionSize);
+        const std::vector<UINT> rangeTileCounts(numTiles, 1u);
+
+        commandQueue->UpdateTileMappings(
+            resource_,
+            numTiles,
+            coords.data(),
+            regionSizes.data(),
+            heap->native.Get(),
+            numTiles,
+            nullptr,
+            heapOffsets.data(),
+            rangeTileCounts.data(),
+            D3D12_TILE_MAPPING_FLAG_NONE
+        );
+
+        first = last;
+    }
+}
+
+void D3D12SparseTextureMemory::UnmapTiles(ID3D12CommandQueue* commandQueue, const std::vector<D3D12_TILED_RESOURCE_COORDINATE>& coords)
+{
+    /* Map all regions to a single NULL range */
+    const UINT                      numTiles    = static_cast<UINT>(coords.size());
+    const D3D12_TILE_RANGE_FLAGS    rangeFlags  = D3D12_TILE_RANGE_FLAG_NULL;
+
+    const std::vector<D3D12_TILE_REGION_SIZE> regionSizes(numTiles, D3D12_TILE_REGION_SIZE{ 1, FALSE, 0, 0, 0 });
+
+    commandQueue->UpdateTileMappings(
+        resource_,
+        numTiles,
+        coords.data(),
+        regionSizes.data(),
+        nullptr,
+        1,
+        &rangeFlags,
+        nullptr,
+        &numTiles,
+        D3D12_TILE_MAPPING_FLAG_NONE
+    );
+}
+
+std::size_t D3D12SparseTextureMemory::GetTileIndex(UINT mipLevel, UINT arrayLayer, UINT tileX, UINT tileY) const
+{
+    return
+    (
+        static_cast<std::size_t>(arrayLayer) * numTilesPerLayer_ +
+        mipTileOffsets_[mipLevel] +
+        tileY * mipTilings_[mipLevel].WidthInTiles +
+        tileX
+    );
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
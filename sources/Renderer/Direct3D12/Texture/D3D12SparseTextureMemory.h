@@ -0,0 +1,97 @@
+/*
+ * D3D12SparseTextureMemory.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_D3D12_SPARSE_TEXTURE_MEMORY_H
+#define LLGL_D3D12_SPARSE_TEXTURE_MEMORY_H
+
+
+#include "D3D12TileHeapPool.h"
+#include <LLGL/TextureFlags.h>
+#include <d3d12.h>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/*
+Tile mappings of a reserved resource (see MiscFlags::Sparse).
+The packed MIP-map levels are mapped once and stay resident; all other MIP-map levels are mapped tile by tile.
+Tile mappings are updated on the command queue, so they are ordered with all subsequently executed command lists.
+*/
+class D3D12SparseTextureMemory
+{
+
+    public:
+
+        D3D12SparseTextureMemory(
+            ID3D12Device*       device,
+            ID3D12Resource*     resource,
+            D3D12TileHeapPool&  tileHeapPool,
+            UINT                numMipLevels,
+            UINT                numArrayLayers,
+            bool                isRenderTarget
+        );
+        ~D3D12SparseTextureMemory();
+
+        D3D12SparseTextureMemory(const D3D12SparseTextureMemory&) = delete;
+        D3D12SparseTextureMemory& operator = (const D3D12SparseTextureMemory&) = delete;
+
+        // Maps the tiles for the packed MIP-map levels of all array layers.
+        void MapPackedMips(ID3D12CommandQueue* commandQueue);
+
+        // Maps or unmaps all tiles that are covered by the specified region. Returns false if any tile could not be allocated.
+        bool UpdateTileMappings(ID3D12CommandQueue* commandQueue, const TextureRegion& region, bool commit);
+
+        // Returns the tile layout of this texture.
+        void GetProperties(SparseTextureProperties& outProperties) const;
+
+    private:
+
+        struct TileMapping
+        {
+            D3D12_TILED_RESOURCE_COORDINATE coord;
+            D3D12TileLocation               location;
+        };
+
+    private:
+
+        void MapTiles(ID3D12CommandQueue* commandQueue, std::vector<TileMapping>& mappings);
+        void UnmapTiles(ID3D12CommandQueue* commandQueue, const std::vector<D3D12_TILED_RESOURCE_COORDINATE>& coords);
+
+        std::size_t GetTileIndex(UINT mipLevel, UINT arrayLayer, UINT tileX, UINT tileY) const;
+
+    private:
+
+        ID3D12Device*                           device_             = nullptr;
+        ID3D12Resource*                         resource_           = nullptr;
+        D3D12TileHeapPool&                      tileHeapPool_;
+        UINT                                    numMipLevels_       = 0;
+        UINT                                    numArrayLayers_     = 0;
+        bool                                    isRenderTarget_     = false;
+
+        D3D12_TILE_SHAPE                        tileShape_          = {};
+        D3D12_PACKED_MIP_INFO                   packedMipInfo_      = {};
+        std::vector<D3D12_SUBRESOURCE_TILING>   mipTilings_;        // Tiling of each standard MIP-map level; identical for all array layers.
+        std::vector<UINT>                       mipTileOffsets_;    // Index of the first tile of each standard MIP-map level within an array layer.
+        UINT                                    numTilesPerLayer_   = 0;
+
+        std::vector<D3D12TileLocation>          tiles_;             // Location of each tile or null heap if the tile is not mapped.
+        std::vector<D3D12TileLocation>          packedTiles_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
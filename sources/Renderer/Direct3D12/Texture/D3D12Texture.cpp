@@ -6,6 +6,7 @@
  */
 
 #include "D3D12Texture.h"
+#include "D3D12TransientHeapPool.h"
 #include "../Command/D3D12CommandContext.h"
 #include "../D3D12SubresourceContext.h"
 #include "../D3D12ObjectUtils.h"
@@ -17,6 +18,7 @@
 #include "../../../Core/CoreUtils.h"
 #include "../../../Core/Assertion.h"
 #include <LLGL/Utils/ForRange.h>
+#include <LLGL/Backend/Direct3D12/NativeHandle.h>
 #include <algorithm>
 
 
@@ -24,7 +26,12 @@ namespace LLGL
 {
 
 
-D3D12Texture::D3D12Texture(ID3D12Device* device, const TextureDescriptor& desc) :
+D3D12Texture::D3D12Texture(
+    ID3D12Device*               device,
+    const TextureDescriptor&    desc,
+    D3D12TransientHeapPool*     transientHeapPool,
+    D3D12TileHeapPool*          tileHeapPool)
+:
     Texture         { desc.type, desc.bindFlags          },
     baseFormat_     { desc.format                        },
     format_         { DXTypes::ToDXGIFormat(desc.format) },
@@ -32,7 +39,7 @@ D3D12Texture::D3D12Texture(ID3D12Device* device, const TextureDescriptor& desc)
     numArrayLayers_ { std::max(1u, desc.arrayLayers)     },
     extent_         { desc.extent                        }
 {
-    CreateNativeTexture(device, desc);
+    CreateNativeTexture(device, desc, transientHeapPool, tileHeapPool);
 
     if (SupportsGenerateMips())
         CreateMipDescHeap(device);
@@ -41,11 +48,57 @@ D3D12Texture::D3D12Texture(ID3D12Device* device, const TextureDescriptor& desc)
         SetDebugName(desc.debugName);
 }
 
+D3D12Texture::~D3D12Texture()
+{
+    /* Don't leave a dangling reference to this resource in the transient heap */
+    if (transientHeap_ && transientHeap_->activeResource == GetNative())
+        transientHeap_->activeResource = nullptr;
+}
+
+void D3D12Texture::ActivateTransient(D3D12CommandContext& commandContext)
+{
+    if (!transientHeap_ || transientHeap_->activeResource == GetNative())
+        return;
+
+    commandContext.InsertAliasingBarrier(transientHeap_->activeResource, GetNative());
+    transientHeap_->activeResource = GetNative();
+
+    /* Placed render-target and depth-stencil resources must be initialized by a discard, clear, or copy operation when they become active */
+    if ((GetBindFlags() & BindFlags::ColorAttachment) != 0)
+        commandContext.TransitionResource(resource_, D3D12_RESOURCE_STATE_RENDER_TARGET);
+    else if ((GetBindFlags() & BindFlags::DepthStencilAttachment) != 0)
+        commandContext.TransitionResource(resource_, D3D12_RESOURCE_STATE_DEPTH_WRITE);
+    else
+        return;
+
+    commandContext.FlushResourceBarrieres();
+    commandContext.GetCommandList()->DiscardResource(GetNative(), nullptr);
+}
+
 void D3D12Texture::SetDebugName(const char* name)
 {
     D3D12SetObjectName(resource_.Get(), name);
 }
 
+void D3D12Texture::SetResidencyPriority(ResidencyPriority priority)
+{
+    /* Placed and reserved resources have no residency of their own */
+    if (IsCommitted())
+        D3D12SetResidencyPriority(GetNative(), priority);
+}
+
+bool D3D12Texture::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
+{
+    if (nativeHandle != nullptr && nativeHandleSize == sizeof(Direct3D12::ResourceNativeHandle))
+    {
+        auto* nativeHandleD3D = reinterpret_cast<Direct3D12::ResourceNativeHandle*>(nativeHandle);
+        nativeHandleD3D->resource = GetNative();
+        nativeHandleD3D->resource->AddRef();
+        return true;
+    }
+    return false;
+}
+
 Extent3D D3D12Texture::GetMipExtent(std::uint32_t mipLevel) const
 {
     Extent3D size;
@@ -756,7 +809,11 @@ static D3D12_RESOURCE_STATES GetInitialD3D12ResourceState(const TextureDescripto
     return flags;
 }
 
-void D3D12Texture::CreateNativeTexture(ID3D12Device* device, const TextureDescriptor& desc)
+void D3D12Texture::CreateNativeTexture(
+    ID3D12Device*               device,
+    const TextureDescriptor&    desc,
+    D3D12TransientHeapPool*     transientHeapPool,
+    D3D12TileHeapPool*          tileHeapPool)
 {
     /* Setup resource descriptor by texture descriptor and create hardware resource */
     D3D12_RESOURCE_DESC descD3D;
@@ -781,17 +838,58 @@ void D3D12Texture::CreateNativeTexture(ID3D12Device* device, const TextureDescri
         optClearValue.DepthStencil.Stencil  = static_cast<UINT8>(desc.clearValue.stencil);
     }
 
-    /* Create hardware resource for the texture */
-    const CD3DX12_HEAP_PROPERTIES heapProperties{ D3D12_HEAP_TYPE_DEFAULT };
-    HRESULT hr = device->CreateCommittedResource(
-        &heapProperties,
-        D3D12_HEAP_FLAG_NONE,
-        &descD3D,
-        resource_.SetInitialAndUsageStates(D3D12_RESOURCE_STATE_COPY_DEST, GetInitialD3D12ResourceState(desc)),
-        (useClearValue ? &optClearValue : nullptr),
-        IID_PPV_ARGS(resource_.native.ReleaseAndGetAddressOf())
-    );
-    DXThrowIfCreateFailed(hr, "ID3D12Resource", "for D3D12 hardware texture");
+    if (transientHeapPool != nullptr && (desc.miscFlags & MiscFlags::Transient) != 0)
+    {
+        /* Place resource at the beginning of the heap that is shared by all transient textures of the same slot */
+        const D3D12_RESOURCE_ALLOCATION_INFO allocInfo = device->GetResourceAllocationInfo(0, 1, &descD3D);
+        transientHeap_ = transientHeapPool->GetOrCreateHeap(device, desc.transientSlot, useClearValue, allocInfo);
+
+        HRESULT hr = device->CreatePlacedResource(
+            transientHeap_->native.Get(),
+            0,
+            &descD3D,
+            resource_.SetInitialAndUsageStates(D3D12_RESOURCE_STATE_COPY_DEST, GetInitialD3D12ResourceState(desc)),
+            (useClearValue ? &optClearValue : nullptr),
+            IID_PPV_ARGS(resource_.native.ReleaseAndGetAddressOf())
+        );
+        DXThrowIfCreateFailed(hr, "ID3D12Resource", "for D3D12 transient texture");
+    }
+    else if (tileHeapPool != nullptr && (desc.miscFlags & MiscFlags::Sparse) != 0)
+    {
+        /* Create reserved resource without memory; tiles are mapped by D3D12SparseTextureMemory */
+        descD3D.Layout = D3D12_TEXTURE_LAYOUT_64KB_UNDEFINED_SWIZZLE;
+
+        HRESULT hr = device->CreateReservedResource(
+            &descD3D,
+            resource_.SetInitialAndUsageStates(D3D12_RESOURCE_STATE_COPY_DEST, GetInitialD3D12ResourceState(desc)),
+            (useClearValue ? &optClearValue : nullptr),
+            IID_PPV_ARGS(resource_.native.ReleaseAndGetAddressOf())
+        );
+        DXThrowIfCreateFailed(hr, "ID3D12Resource", "for D3D12 sparse texture");
+
+        sparseMemory_ = MakeUnique<D3D12SparseTextureMemory>(
+            device,
+            resource_.native.Get(),
+            *tileHeapPool,
+            numMipLevels_,
+            numArrayLayers_,
+            useClearValue
+        );
+    }
+    else
+    {
+        /* Create hardware resource for the texture */
+        const CD3DX12_HEAP_PROPERTIES heapProperties{ D3D12_HEAP_TYPE_DEFAULT };
+        HRESULT hr = device->CreateCommittedResource(
+            &heapProperties,
+            D3D12_HEAP_FLAG_NONE,
+            &descD3D,
+            resource_.SetInitialAndUsageStates(D3D12_RESOURCE_STATE_COPY_DEST, GetInitialD3D12ResourceState(desc)),
+            (useClearValue ? &optClearValue : nullptr),
+            IID_PPV_ARGS(resource_.native.ReleaseAndGetAddressOf())
+        );
+        DXThrowIfCreateFailed(hr, "ID3D12Resource", "for D3D12 hardware texture");
+    }
 }
 
 // Determine SRV dimension for descriptor heaps used in D3D12MipGenerator: either 1D array, 2D array, or 3D
@@ -11,6 +11,8 @@
 
 #include <LLGL/Texture.h>
 #include "../D3D12Resource.h"
+#include "D3D12SparseTextureMemory.h"
+#include <memory>
 #include <vector>
 
 
@@ -21,6 +23,9 @@ namespace LLGL
 class D3D12Buffer;
 class D3D12CommandContext;
 class D3D12SubresourceContext;
+class D3D12TransientHeapPool;
+class D3D12TileHeapPool;
+struct D3D12TransientHeap;
 
 class D3D12Texture final : public Texture
 {
@@ -32,10 +37,25 @@ class D3D12Texture final : public Texture
     public:
 
         void SetDebugName(const char* name) override;
+        void SetResidencyPriority(ResidencyPriority priority) override;
+        bool GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize) override;
 
     public:
 
-        D3D12Texture(ID3D12Device* device, const TextureDescriptor& desc);
+        D3D12Texture(
+            ID3D12Device*               device,
+            const TextureDescriptor&    desc,
+            D3D12TransientHeapPool*     transientHeapPool   = nullptr,
+            D3D12TileHeapPool*          tileHeapPool        = nullptr
+        );
+        ~D3D12Texture();
+
+        /*
+        Makes this transient texture the resource that occupies its heap memory.
+        If a different resource of the same heap was active before, an aliasing barrier is recorded and render-target/depth-stencil content is discarded.
+        Does nothing if this is not a transient texture.
+        */
+        void ActivateTransient(D3D12CommandContext& commandContext);
 
         // Updates the specified subresource, i.e. a single MIP-map level but one or more array layers.
         void UpdateSubresource(
@@ -144,6 +164,24 @@ class D3D12Texture final : public Texture
             return TextureSubresource{ 0, GetNumArrayLayers(), 0, GetNumMipLevels() };
         }
 
+        // Returns true if this texture was placed in a transient heap (see MiscFlags::Transient).
+        inline bool IsTransient() const
+        {
+            return (transientHeap_ != nullptr);
+        }
+
+        // Returns the tile mappings of this sparse texture or null if this is not a sparse texture (see MiscFlags::Sparse).
+        inline D3D12SparseTextureMemory* GetSparseMemory() const
+        {
+            return sparseMemory_.get();
+        }
+
+        // Returns true if this texture is a committed resource, i.e. neither placed in a transient heap nor a sparse texture, and thus has its own residency.
+        inline bool IsCommitted() const
+        {
+            return (!IsTransient() && !GetSparseMemory());
+        }
+
         // Returns the descriptor heap for the MIP-map chain. Descriptor 0 is SRV of entire MIP-map chain, 1 to N descriptors are for UAVs for MIP-maps 1 to N.
         inline ID3D12DescriptorHeap* GetMipDescHeap() const
         {
@@ -152,7 +190,12 @@ class D3D12Texture final : public Texture
 
     private:
 
-        void CreateNativeTexture(ID3D12Device* device, const TextureDescriptor& desc);
+        void CreateNativeTexture(
+            ID3D12Device*               device,
+            const TextureDescriptor&    desc,
+            D3D12TransientHeapPool*     transientHeapPool,
+            D3D12TileHeapPool*          tileHeapPool
+        );
 
         void CreateShaderResourceViewPrimary(
             ID3D12Device*               device,
@@ -175,6 +218,8 @@ class D3D12Texture final : public Texture
 
     private:
 
+        std::shared_ptr<D3D12TransientHeap> transientHeap_; // Must be declared before resource_ to outlive the placed resource.
+
         D3D12Resource                   resource_;
 
         Format                          baseFormat_     = Format::Undefined;
@@ -185,6 +230,8 @@ class D3D12Texture final : public Texture
 
         ComPtr<ID3D12DescriptorHeap>    mipDescHeap_;
 
+        std::unique_ptr<D3D12SparseTextureMemory> sparseMemory_;   // Must be declared after resource_ to release its tiles before the reserved resource.
+
 };
 
 
@@ -0,0 +1,182 @@
+/*
+ * D3D12TextureBlitter.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "D3D12TextureBlitter.h"
+#include "D3D12Texture.h"
+#include "../Shader/D3D12RootSignature.h"
+#include "../Command/D3D12CommandContext.h"
+#include "../../DXCommon/DXCore.h"
+#include "../../DXCommon/Builtin/BlitTexture.hlsl.inl"
+#include "../../../Core/CoreUtils.h"
+
+
+namespace LLGL
+{
+
+
+D3D12TextureBlitter& D3D12TextureBlitter::Get()
+{
+    static D3D12TextureBlitter instance;
+    return instance;
+}
+
+void D3D12TextureBlitter::InitializeDevice(ID3D12Device* device)
+{
+    /* Store device object only; resources are created on first use since most applications never blit textures */
+    device_         = device;
+    descHandleSize_ = device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+}
+
+void D3D12TextureBlitter::Clear()
+{
+    pipelineState_.Reset();
+    rootSignature_.Reset();
+    descHeap_.Reset();
+    initialized_ = false;
+}
+
+HRESULT D3D12TextureBlitter::BlitTexture(
+    D3D12CommandContext&    commandContext,
+    D3D12Texture&           dstTexture,
+    const TextureRegion&    dstRegion,
+    D3D12Texture&           srcTexture,
+    const TextureRegion&    srcRegion,
+    const SamplerFilter     filter)
+{
+    if (dstRegion.extent.width == 0 || dstRegion.extent.height == 0 || srcRegion.extent.width == 0 || srcRegion.extent.height == 0)
+    {
+        /* Ignore this call, no region specified */
+        return S_OK;
+    }
+
+    if (!CreateResources())
+        return E_FAIL;
+
+    /* Create SRV and UAV for a single MIP-map level and array layer of each texture */
+    D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle = descHeap_->GetCPUDescriptorHandleForHeapStart();
+
+    TextureViewDescriptor srvDesc;
+    {
+        srvDesc.type                        = TextureType::Texture2DArray;
+        srvDesc.format                      = srcTexture.GetBaseFormat();
+        srvDesc.subresource.baseMipLevel    = srcRegion.subresource.baseMipLevel;
+        srvDesc.subresource.numMipLevels    = 1;
+        srvDesc.subresource.baseArrayLayer  = srcRegion.subresource.baseArrayLayer;
+        srvDesc.subresource.numArrayLayers  = 1;
+    }
+    srcTexture.CreateShaderResourceView(device_, cpuDescHandle, srvDesc);
+
+    TextureViewDescriptor uavDesc;
+    {
+        uavDesc.type                        = TextureType::Texture2DArray;
+        uavDesc.format                      = dstTexture.GetBaseFormat();
+        uavDesc.subresource.baseMipLevel    = dstRegion.subresource.baseMipLevel;
+        uavDesc.subresource.numMipLevels    = 1;
+        uavDesc.subresource.baseArrayLayer  = dstRegion.subresource.baseArrayLayer;
+        uavDesc.subresource.numArrayLayers  = 1;
+    }
+    cpuDescHandle.ptr += descHandleSize_;
+    dstTexture.CreateUnorderedAccessView(device_, cpuDescHandle, uavDesc);
+
+    /* Copy both descriptors into the shader-visible staging heap, so they remain valid until the command list has been executed */
+    commandContext.SetStagingDescriptorHeaps();
+    D3D12_GPU_DESCRIPTOR_HANDLE gpuDescHandle = commandContext.CopyDescriptorsForStaging(
+        D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV,
+        descHeap_->GetCPUDescriptorHandleForHeapStart(),
+        0,
+        2
+    );
+
+    D3D12Resource& srcResource = srcTexture.GetResource();
+    D3D12Resource& dstResource = dstTexture.GetResource();
+
+    commandContext.TransitionResource(srcResource, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
+    commandContext.TransitionResource(dstResource, D3D12_RESOURCE_STATE_UNORDERED_ACCESS, true);
+
+    /* Set root signature, pipeline state, and blit descriptor */
+    commandContext.SetComputeRootSignature(rootSignature_.Get());
+    commandContext.SetPipelineState(pipelineState_.Get());
+
+    DXBlitTextureDescriptor blitDesc;
+    DXInitBlitTextureDescriptor(blitDesc, dstRegion, srcRegion, filter);
+
+    ID3D12GraphicsCommandList* commandList = commandContext.GetCommandList();
+    commandList->SetComputeRoot32BitConstants(0, sizeof(blitDesc) / 4, &blitDesc, 0);
+    commandList->SetComputeRootDescriptorTable(1, gpuDescHandle);
+    gpuDescHandle.ptr += descHandleSize_;
+    commandList->SetComputeRootDescriptorTable(2, gpuDescHandle);
+
+    commandList->Dispatch(
+        DivideRoundUp(dstRegion.extent.width,  8u),
+        DivideRoundUp(dstRegion.extent.height, 8u),
+        1u
+    );
+
+    /* Restore resource states for subsequent commands */
+    commandContext.TransitionResource(srcResource, srcResource.usageState);
+    commandContext.TransitionResource(dstResource, dstResource.usageState, true);
+
+    return S_OK;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool D3D12TextureBlitter::CreateResources()
+{
+    if (initialized_)
+        return (pipelineState_.Get() != nullptr);
+
+    initialized_ = true;
+
+    /* Compile shader first; blitting will be ignored if this fails */
+    ComPtr<ID3DBlob> shader = DXCompileBlitTextureShader();
+    if (!shader)
+        return false;
+
+    /* Initialize root signature */
+    D3D12RootSignature rootSignature;
+    {
+        rootSignature.ResetAndAlloc(3, 0);
+        rootSignature[0].InitAsConstants(0, sizeof(DXBlitTextureDescriptor) / 4);
+        rootSignature[1].InitAsDescriptorRange(D3D12_DESCRIPTOR_RANGE_TYPE_SRV, 0, 1);
+        rootSignature[2].InitAsDescriptorRange(D3D12_DESCRIPTOR_RANGE_TYPE_UAV, 0, 1);
+    }
+    rootSignature_ = rootSignature.Finalize(device_);
+
+    /* Create compute PSO */
+    D3D12_COMPUTE_PIPELINE_STATE_DESC psoDesc = {};
+    {
+        psoDesc.pRootSignature      = rootSignature_.Get();
+        psoDesc.CS.pShaderBytecode  = shader->GetBufferPointer();
+        psoDesc.CS.BytecodeLength   = shader->GetBufferSize();
+    }
+    HRESULT hr = device_->CreateComputePipelineState(&psoDesc, IID_PPV_ARGS(pipelineState_.ReleaseAndGetAddressOf()));
+    DXThrowIfCreateFailed(hr, "ID3D12PipelineState", "for texture blitter");
+
+    /* Create non-shader-visible descriptor heap for source SRV and destination UAV */
+    D3D12_DESCRIPTOR_HEAP_DESC heapDesc;
+    {
+        heapDesc.Type           = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
+        heapDesc.NumDescriptors = 2;
+        heapDesc.Flags          = D3D12_DESCRIPTOR_HEAP_FLAG_NONE;
+        heapDesc.NodeMask       = 0;
+    }
+    hr = device_->CreateDescriptorHeap(&heapDesc, IID_PPV_ARGS(descHeap_.ReleaseAndGetAddressOf()));
+    DXThrowIfCreateFailed(hr, "ID3D12DescriptorHeap", "for texture blitter");
+
+    return true;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,82 @@
+/*
+ * D3D12TextureBlitter.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_D3D12_TEXTURE_BLITTER_H
+#define LLGL_D3D12_TEXTURE_BLITTER_H
+
+
+#include <LLGL/TextureFlags.h>
+#include <LLGL/SamplerFlags.h>
+#include <d3d12.h>
+#include "../../DXCommon/ComPtr.h"
+
+
+namespace LLGL
+{
+
+
+class D3D12Texture;
+class D3D12CommandContext;
+
+// Direct3D 12 scaled texture blitter singleton; D3D12 has no native blit command, so this dispatches a builtin compute shader.
+class D3D12TextureBlitter
+{
+
+    public:
+
+        // Returns the singleton instance.
+        static D3D12TextureBlitter& Get();
+
+    public:
+
+        D3D12TextureBlitter(const D3D12TextureBlitter&) = delete;
+        D3D12TextureBlitter& operator = (const D3D12TextureBlitter&) = delete;
+
+        D3D12TextureBlitter(D3D12TextureBlitter&&) = delete;
+        D3D12TextureBlitter& operator = (D3D12TextureBlitter&&) = delete;
+
+        void InitializeDevice(ID3D12Device* device);
+        void Clear();
+
+        HRESULT BlitTexture(
+            D3D12CommandContext&    commandContext,
+            D3D12Texture&           dstTexture,
+            const TextureRegion&    dstRegion,
+            D3D12Texture&           srcTexture,
+            const TextureRegion&    srcRegion,
+            const SamplerFilter     filter
+        );
+
+    private:
+
+        D3D12TextureBlitter() = default;
+
+        // Creates the root signature, PSO, and descriptor heap on first use and returns true if they are available.
+        bool CreateResources();
+
+    private:
+
+        ID3D12Device*                   device_             = nullptr;
+
+        ComPtr<ID3D12RootSignature>     rootSignature_;
+        ComPtr<ID3D12PipelineState>     pipelineState_;
+        ComPtr<ID3D12DescriptorHeap>    descHeap_;          // Non-shader-visible heap for the source SRV and destination UAV.
+        bool                            initialized_        = false;
+
+        UINT                            descHandleSize_     = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,91 @@
+/*
+ * D3D12TileHeapPool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "D3D12TileHeapPool.h"
+#include "../../../Core/CoreUtils.h"
+
+
+namespace LLGL
+{
+
+
+// Number of tiles per heap, i.e. 4 MiB per heap.
+static constexpr UINT g_numTilesPerHeap = 64;
+
+static std::unique_ptr<D3D12TileHeap> CreateD3D12TileHeap(ID3D12Device* device, bool isRenderTarget)
+{
+    auto heap = MakeUnique<D3D12TileHeap>();
+
+    D3D12_HEAP_DESC heapDesc;
+    {
+        heapDesc.SizeInBytes                        = static_cast<UINT64>(g_numTilesPerHeap) * D3D12_TILED_RESOURCE_TILE_SIZE_IN_BYTES;
+        heapDesc.Properties.Type                    = D3D12_HEAP_TYPE_DEFAULT;
+        heapDesc.Properties.CPUPageProperty         = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
+        heapDesc.Properties.MemoryPoolPreference    = D3D12_MEMORY_POOL_UNKNOWN;
+        heapDesc.Properties.CreationNodeMask        = 0;
+        heapDesc.Properties.VisibleNodeMask         = 0;
+        heapDesc.Alignment                          = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+        heapDesc.Flags                              = (isRenderTarget ? D3D12_HEAP_FLAG_ALLOW_ONLY_RT_DS_TEXTURES : D3D12_HEAP_FLAG_ALLOW_ONLY_NON_RT_DS_TEXTURES);
+    }
+    HRESULT hr = device->CreateHeap(&heapDesc, IID_PPV_ARGS(heap->native.ReleaseAndGetAddressOf()));
+    if (FAILED(hr))
+        return nullptr;
+
+    heap->native->SetName(L"LLGL::D3D12TileHeap");
+    heap->isRenderTarget = isRenderTarget;
+
+    /* Hand out tiles in ascending order */
+    heap->freeTiles.reserve(g_numTilesPerHeap);
+    for (UINT tile = g_numTilesPerHeap; tile > 0; --tile)
+        heap->freeTiles.push_back(tile - 1);
+
+    return heap;
+}
+
+D3D12TileLocation D3D12TileHeapPool::AllocTile(ID3D12Device* device, bool isRenderTarget)
+{
+    /* Find heap of the same category that has free tiles left */
+    D3D12TileHeap* heap = nullptr;
+    for (const auto& entry : heaps_)
+    {
+        if (entry->isRenderTarget == isRenderTarget && !entry->freeTiles.empty())
+        {
+            heap = entry.get();
+            break;
+        }
+    }
+
+    if (heap == nullptr)
+    {
+        std::unique_ptr<D3D12TileHeap> newHeap = CreateD3D12TileHeap(device, isRenderTarget);
+        if (!newHeap)
+            return D3D12TileLocation{};
+        heap = newHeap.get();
+        heaps_.push_back(std::move(newHeap));
+    }
+
+    D3D12TileLocation location;
+    {
+        location.heap = heap;
+        location.tile = heap->freeTiles.back();
+    }
+    heap->freeTiles.pop_back();
+    return location;
+}
+
+void D3D12TileHeapPool::FreeTile(const D3D12TileLocation& location)
+{
+    if (location.heap != nullptr)
+        location.heap->freeTiles.push_back(location.tile);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
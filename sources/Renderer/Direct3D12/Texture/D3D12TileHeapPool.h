@@ -0,0 +1,73 @@
+/*
+ * D3D12TileHeapPool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_D3D12_TILE_HEAP_POOL_H
+#define LLGL_D3D12_TILE_HEAP_POOL_H
+
+
+#include "../../DXCommon/ComPtr.h"
+#include <d3d12.h>
+#include <memory>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+// Heap of 64 KiB tiles for reserved resources.
+struct D3D12TileHeap
+{
+    ComPtr<ID3D12Heap>  native;
+    bool                isRenderTarget  = false;
+    std::vector<UINT>   freeTiles;
+};
+
+// Location of a single tile within a tile heap.
+struct D3D12TileLocation
+{
+    D3D12TileHeap*  heap    = nullptr;
+    UINT            tile    = 0;
+};
+
+/*
+Pool of heaps for the tiles of sparse textures (see MiscFlags::Sparse).
+Render-target/depth-stencil textures and all other textures get their tiles from different heaps,
+since heaps on resource heap tier 1 cannot mix these categories.
+Heaps are kept alive when all their tiles are freed, since streaming applications commit and release tiles continuously.
+*/
+class D3D12TileHeapPool
+{
+
+    public:
+
+        D3D12TileHeapPool() = default;
+
+        D3D12TileHeapPool(const D3D12TileHeapPool&) = delete;
+        D3D12TileHeapPool& operator = (const D3D12TileHeapPool&) = delete;
+
+        // Allocates a single tile. Returns a location with a null heap if a new heap could not be created.
+        D3D12TileLocation AllocTile(ID3D12Device* device, bool isRenderTarget);
+
+        // Returns the specified tile to its heap.
+        void FreeTile(const D3D12TileLocation& location);
+
+    private:
+
+        std::vector<std::unique_ptr<D3D12TileHeap>> heaps_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
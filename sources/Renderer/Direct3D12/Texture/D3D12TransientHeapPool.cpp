@@ -0,0 +1,87 @@
+/*
+ * D3D12TransientHeapPool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "D3D12TransientHeapPool.h"
+#include "../../DXCommon/DXCore.h"
+#include "../../../Core/CoreUtils.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+static std::shared_ptr<D3D12TransientHeap> CreateD3D12TransientHeap(
+    ID3D12Device*                           device,
+    bool                                    isRenderTarget,
+    const D3D12_RESOURCE_ALLOCATION_INFO&   allocInfo)
+{
+    auto heap = std::make_shared<D3D12TransientHeap>();
+
+    D3D12_HEAP_DESC heapDesc;
+    {
+        heapDesc.SizeInBytes                        = allocInfo.SizeInBytes;
+        heapDesc.Properties.Type                    = D3D12_HEAP_TYPE_DEFAULT;
+        heapDesc.Properties.CPUPageProperty         = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
+        heapDesc.Properties.MemoryPoolPreference    = D3D12_MEMORY_POOL_UNKNOWN;
+        heapDesc.Properties.CreationNodeMask        = 0;
+        heapDesc.Properties.VisibleNodeMask         = 0;
+        heapDesc.Alignment                          = allocInfo.Alignment;
+        heapDesc.Flags                              = (isRenderTarget ? D3D12_HEAP_FLAG_ALLOW_ONLY_RT_DS_TEXTURES : D3D12_HEAP_FLAG_ALLOW_ONLY_NON_RT_DS_TEXTURES);
+    }
+    HRESULT hr = device->CreateHeap(&heapDesc, IID_PPV_ARGS(heap->native.ReleaseAndGetAddressOf()));
+    DXThrowIfCreateFailed(hr, "ID3D12Heap", "for transient textures");
+
+    heap->native->SetName(L"LLGL::D3D12TransientHeap");
+    heap->size      = allocInfo.SizeInBytes;
+    heap->alignment = allocInfo.Alignment;
+
+    return heap;
+}
+
+std::shared_ptr<D3D12TransientHeap> D3D12TransientHeapPool::GetOrCreateHeap(
+    ID3D12Device*                           device,
+    std::uint32_t                           slot,
+    bool                                    isRenderTarget,
+    const D3D12_RESOURCE_ALLOCATION_INFO&   allocInfo)
+{
+    auto it = std::find_if(
+        heaps_.begin(),
+        heaps_.end(),
+        [slot, isRenderTarget](const HeapEntry& entry) -> bool
+        {
+            return (entry.slot == slot && entry.isRenderTarget == isRenderTarget);
+        }
+    );
+
+    if (it == heaps_.end())
+    {
+        /* Create first heap for this slot */
+        heaps_.push_back(HeapEntry{ slot, isRenderTarget, CreateD3D12TransientHeap(device, isRenderTarget, allocInfo) });
+        return heaps_.back().heap;
+    }
+
+    if (it->heap->size < allocInfo.SizeInBytes || it->heap->alignment < allocInfo.Alignment)
+    {
+        /* Replace heap by a larger one; textures in the previous heap keep it alive */
+        D3D12_RESOURCE_ALLOCATION_INFO grownAllocInfo;
+        {
+            grownAllocInfo.Alignment    = std::max(it->heap->alignment, allocInfo.Alignment);
+            grownAllocInfo.SizeInBytes  = GetAlignedSize<UINT64>(std::max(it->heap->size, allocInfo.SizeInBytes), grownAllocInfo.Alignment);
+        }
+        it->heap = CreateD3D12TransientHeap(device, isRenderTarget, grownAllocInfo);
+    }
+
+    return it->heap;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,80 @@
+/*
+ * D3D12TransientHeapPool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_D3D12_TRANSIENT_HEAP_POOL_H
+#define LLGL_D3D12_TRANSIENT_HEAP_POOL_H
+
+
+#include "../../DXCommon/ComPtr.h"
+#include <d3d12.h>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+// Heap that is shared between all transient textures of the same slot. All textures are placed at offset 0.
+struct D3D12TransientHeap
+{
+    ComPtr<ID3D12Heap>  native;
+    UINT64              size            = 0;
+    UINT64              alignment       = 0;
+    ID3D12Resource*     activeResource  = nullptr; // Resource that occupies the heap memory at the current point of command recording.
+};
+
+/*
+Pool of heaps for transient textures (see MiscFlags::Transient).
+Each transient slot has one heap for render-target/depth-stencil textures and one for all other textures,
+since heaps on resource heap tier 1 cannot mix these categories.
+If a new texture does not fit into the current heap of its slot, a larger heap replaces it for subsequently created textures.
+The previous heap stays alive for as long as the textures that were placed in it.
+*/
+class D3D12TransientHeapPool
+{
+
+    public:
+
+        D3D12TransientHeapPool() = default;
+
+        D3D12TransientHeapPool(const D3D12TransientHeapPool&) = delete;
+        D3D12TransientHeapPool& operator = (const D3D12TransientHeapPool&) = delete;
+
+        // Returns the heap for the specified transient slot that can hold a resource with the specified allocation info.
+        std::shared_ptr<D3D12TransientHeap> GetOrCreateHeap(
+            ID3D12Device*                           device,
+            std::uint32_t                           slot,
+            bool                                    isRenderTarget,
+            const D3D12_RESOURCE_ALLOCATION_INFO&   allocInfo
+        );
+
+    private:
+
+        struct HeapEntry
+        {
+            std::uint32_t                       slot;
+            bool                                isRenderTarget;
+            std::shared_ptr<D3D12TransientHeap> heap;
+        };
+
+    private:
+
+        std::vector<HeapEntry> heaps_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -26,6 +26,8 @@ class MTBuffer final : public Buffer
 
         BufferDescriptor GetDesc() const override;
 
+        bool GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize) override;
+
     public:
 
         MTBuffer(id<MTLDevice> device, const BufferDescriptor& desc, const void* initialData);
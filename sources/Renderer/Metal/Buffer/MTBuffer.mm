@@ -7,6 +7,7 @@
 
 #include "MTBuffer.h"
 #include "../../ResourceUtils.h"
+#include <LLGL/Backend/Metal/NativeHandle.h>
 #include <string.h>
 
 
@@ -19,7 +20,7 @@ static MTLResourceOptions GetMTLResourceOptions(const BufferDescriptor& desc)
     #ifdef LLGL_OS_IOS
     return MTLResourceStorageModeShared;
     #else
-    if ((desc.miscFlags & MiscFlags::DynamicUsage) != 0)
+    if ((desc.miscFlags & (MiscFlags::DynamicUsage | MiscFlags::Readback)) != 0)
         return MTLResourceStorageModeShared;
     //else if ((desc.bindFlags & BindFlags::Storage) != 0)
     //    return MTLResourceStorageModePrivate;
@@ -49,6 +50,18 @@ MTBuffer::~MTBuffer()
     [native_ release];
 }
 
+bool MTBuffer::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
+{
+    if (nativeHandle != nullptr && nativeHandleSize == sizeof(Metal::ResourceNativeHandle))
+    {
+        auto* nativeHandleMT = reinterpret_cast<Metal::ResourceNativeHandle*>(nativeHandle);
+        nativeHandleMT->resource = native_;
+        [nativeHandleMT->resource retain];
+        return true;
+    }
+    return false;
+}
+
 BufferDescriptor MTBuffer::GetDesc() const
 {
     BufferDescriptor bufferDesc;
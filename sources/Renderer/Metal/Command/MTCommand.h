@@ -12,6 +12,8 @@
 #import <MetalKit/MetalKit.h>
 
 #include <LLGL/CommandBufferFlags.h>
+#include <LLGL/TextureFlags.h>
+#include <LLGL/SamplerFlags.h>
 #include <cstdint>
 
 
@@ -99,6 +101,15 @@ struct MTCmdGenerateMipmaps
     id<MTLTexture> texture;
 };
 
+struct MTCmdBlitTexture
+{
+    id<MTLTexture>  destinationTexture;
+    TextureRegion   destinationRegion;
+    id<MTLTexture>  sourceTexture;
+    TextureRegion   sourceRegion;
+    SamplerFilter   filter;
+};
+
 struct MTCmdSetGraphicsPSO
 {
     MTGraphicsPSO* graphicsPSO;
@@ -153,6 +164,7 @@ struct MTCmdSetUniforms
 
 struct MTCmdSetVertexBuffers
 {
+    NSUInteger      first;
     NSUInteger      count;
 //  id<MTLBuffer>*  buffers[count];
 //  NSUInteger      offsets[count];
@@ -170,6 +182,13 @@ struct MTCmdSetResource
     Resource*       resource;
 };
 
+struct MTCmdSetResources
+{
+    std::uint32_t   firstDescriptor;
+    std::uint32_t   numResources;
+//  Resource*       resources[numResources];
+};
+
 struct MTCmdBindRenderTarget
 {
     RenderTarget*       renderTarget;
@@ -230,6 +249,14 @@ struct MTCmdDrawIndexedPrimitives
     NSUInteger          baseInstance;
 };
 
+struct MTCmdExecuteIndirectCommands
+{
+    id<MTLIndirectCommandBuffer>    indirectCommandBuffer;
+    NSUInteger                      numCommands;
+    NSUInteger                      numResources;
+//  id<MTLResource>                 resources[numResources];
+};
+
 struct MTCmdDispatchThreads
 {
     MTLSize threads;
@@ -265,6 +292,8 @@ struct MTCmdPresentDrawables
 
 //struct MTCmdFlush;
 
+//struct MTCmdEndRenderEncoder;
+
 
 } // /namespace LLGL
 
@@ -16,6 +16,7 @@
 #include "MTCommandContext.h"
 #include "../Buffer/MTIntermediateBuffer.h"
 #include "../Buffer/MTStagingBufferPool.h"
+#include <vector>
 
 
 namespace LLGL
@@ -79,7 +80,13 @@ class MTCommandBuffer : public CommandBuffer
 
     protected:
 
-        MTCommandBuffer(id<MTLDevice> device, long flags);
+        // Maximum number of vertex buffers that can be converted with ConvertVertexBuffers. This matches the limit of the command context.
+        static constexpr NSUInteger maxNumVertexBuffers = 32;
+
+    protected:
+
+        // Creates the command buffer with the specified number of staging pools, e.g. one for each native command buffer slot that can be in flight.
+        MTCommandBuffer(id<MTLDevice> device, const CommandBufferDescriptor& desc, NSUInteger numStagingPools = 1);
 
         NSUInteger GetMaxLocalThreads(id<MTLComputePipelineState> computePSO) const;
 
@@ -89,7 +96,9 @@ class MTCommandBuffer : public CommandBuffer
         void SetComputePSORenderState(MTComputePSO& computePSO);
 
         void ResetRenderStates();
-        void ResetStagingPool();
+
+        // Selects the specified staging pool for subsequent writes and resets it. The GPU must no longer read from this pool.
+        void ResetStagingPool(NSUInteger poolIndex);
 
         void WriteStagingBuffer(
             const void*     data,
@@ -104,8 +113,22 @@ class MTCommandBuffer : public CommandBuffer
         // Grows the internal tessellation-factor buffer to fit the specified number of patches and instances, then returns the native Metal buffer.
         id<MTLBuffer> GetTessFactorBufferAndGrow(NSUInteger numPatchesAndInstances);
 
+        // Converts the specified vertex buffers and optional offsets into native arrays with at most 'maxNumVertexBuffers' entries. Returns the number of converted buffers.
+        static NSUInteger ConvertVertexBuffers(
+            id<MTLBuffer>*          outBufferIds,
+            NSUInteger*             outBufferOffsets,
+            std::uint32_t           numBuffers,
+            Buffer* const *         buffers,
+            const std::uint64_t*    offsets
+        );
+
     protected:
 
+        inline id<MTLDevice> GetDevice() const
+        {
+            return device_;
+        }
+
         inline MTLPrimitiveType GetPrimitiveType() const
         {
             return primitiveType_;
@@ -136,6 +159,16 @@ class MTCommandBuffer : public CommandBuffer
             return threadsPerThreadgroup_;
         }
 
+        inline const MTLSize& GetThreadsPerObjectThreadgroup() const
+        {
+            return threadsPerObjectThreadgroup_;
+        }
+
+        inline const MTLSize& GetThreadsPerMeshThreadgroup() const
+        {
+            return threadsPerMeshThreadgroup_;
+        }
+
         inline MTPipelineState* GetBoundPipelineState() const
         {
             return boundPipelineState_;
@@ -152,30 +185,30 @@ class MTCommandBuffer : public CommandBuffer
 
     private:
 
-        static constexpr NSUInteger     maxNumStagingPools      = 3;
-
-        id<MTLDevice>                   device_                 = nil;
-        long                            flags_                  = 0;
+        id<MTLDevice>                       device_                 = nil;
+        long                                flags_                  = 0;
 
-        NSUInteger                      currentStagingPool_     = 0;
-        MTStagingBufferPool             stagingBufferPools_[MTCommandBuffer::maxNumStagingPools];
-        SmallVector<id<MTLDrawable>, 2> queuedDrawables_;
+        NSUInteger                          currentStagingPool_     = 0;
+        std::vector<MTStagingBufferPool>    stagingBufferPools_;
+        SmallVector<id<MTLDrawable>, 2>     queuedDrawables_;
 
-        MTLPrimitiveType                primitiveType_          = MTLPrimitiveTypeTriangle;
-        id<MTLBuffer>                   indexBuffer_            = nil;
-        NSUInteger                      indexBufferOffset_      = 0;
-        MTLIndexType                    indexType_              = MTLIndexTypeUInt32;
-        NSUInteger                      indexTypeSize_          = 4;
-        NSUInteger                      numPatchControlPoints_  = 0;
+        MTLPrimitiveType                    primitiveType_          = MTLPrimitiveTypeTriangle;
+        id<MTLBuffer>                       indexBuffer_            = nil;
+        NSUInteger                          indexBufferOffset_      = 0;
+        MTLIndexType                        indexType_              = MTLIndexTypeUInt32;
+        NSUInteger                          indexTypeSize_          = 4;
+        NSUInteger                          numPatchControlPoints_  = 0;
 
-        MTLSize                         threadsPerThreadgroup_  = MTLSizeMake(1, 1, 1);
-        MTSwapChain*                    boundSwapChain_         = nullptr;
-        MTPipelineState*                boundPipelineState_     = nullptr;
+        MTLSize                             threadsPerThreadgroup_  = MTLSizeMake(1, 1, 1);
+        MTLSize                             threadsPerObjectThreadgroup_    = {};
+        MTLSize                             threadsPerMeshThreadgroup_      = {};
+        MTSwapChain*                        boundSwapChain_         = nullptr;
+        MTPipelineState*                    boundPipelineState_     = nullptr;
 
         // Tessellator stage objects
-        MTIntermediateBuffer            tessFactorBuffer_;
-        NSUInteger                      tessFactorSize_         = 0;
-        id<MTLComputePipelineState>     tessPipelineState_      = nil;
+        MTIntermediateBuffer                tessFactorBuffer_;
+        NSUInteger                          tessFactorSize_         = 0;
+        id<MTLComputePipelineState>         tessPipelineState_      = nil;
 
 };
 
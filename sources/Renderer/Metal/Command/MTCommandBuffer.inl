@@ -16,6 +16,7 @@
 #include <LLGL/Backend/CommandBuffer.StreamOutput.inl>
 #include <LLGL/Backend/CommandBuffer.Drawing.inl>
 #include <LLGL/Backend/CommandBuffer.Compute.inl>
+#include <LLGL/Backend/CommandBuffer.RayTracing.inl>
 #include <LLGL/Backend/CommandBuffer.Debugging.inl>
 #include <LLGL/Backend/CommandBuffer.Extensions.inl>
 
@@ -23,13 +24,21 @@
 /* ----- Input Assembly ------ */
 
 virtual void SetVertexBuffer(
-    Buffer&             buffer
+    Buffer&             buffer,
+    std::uint64_t       offset = 0
 ) override final;
 
 virtual void SetVertexBufferArray(
     BufferArray&        bufferArray
 ) override final;
 
+virtual void SetVertexBuffers(
+    std::uint32_t           firstSlot,
+    std::uint32_t           numBuffers,
+    Buffer* const *         buffers,
+    const std::uint64_t*    offsets     = nullptr
+) override final;
+
 
 
 // ================================================================================
@@ -14,6 +14,7 @@
 #include "../Buffer/MTBuffer.h"
 #include "../Shader/MTShader.h"
 #include "../../CheckedCast.h"
+#include <LLGL/Utils/ForRange.h>
 #include <algorithm>
 
 #include <LLGL/Backend/Metal/NativeCommand.h>
@@ -25,16 +26,18 @@ namespace LLGL
 
 static constexpr NSUInteger g_tessFactorBufferAlignment = (sizeof(MTLQuadTessellationFactorsHalf) * 256);
 
-MTCommandBuffer::MTCommandBuffer(id<MTLDevice> device, long flags) :
+MTCommandBuffer::MTCommandBuffer(id<MTLDevice> device, const CommandBufferDescriptor& desc, NSUInteger numStagingPools) :
     device_             { device                         },
-    flags_              { flags                          },
-    stagingBufferPools_ { { device, USHRT_MAX },
-                          { device, USHRT_MAX },
-                          { device, USHRT_MAX }          },
+    flags_              { desc.flags                     },
     tessFactorBuffer_   { device,
                           MTLResourceStorageModePrivate,
                           g_tessFactorBufferAlignment    }
 {
+    /* Staging chunks must at least fit the largest data block of UpdateBuffer */
+    const NSUInteger stagingChunkSize = static_cast<NSUInteger>(std::max<std::uint64_t>(desc.minStagingPoolSize, USHRT_MAX));
+    stagingBufferPools_.reserve(numStagingPools);
+    for_range(i, std::max<NSUInteger>(1, numStagingPools))
+        stagingBufferPools_.emplace_back(device, stagingChunkSize);
     ResetRenderStates();
 }
 
@@ -87,6 +90,10 @@ void MTCommandBuffer::SetGraphicsPSORenderState(MTGraphicsPSO& graphicsPSO)
     numPatchControlPoints_  = graphicsPSO.GetNumPatchControlPoints();
     tessPipelineState_      = graphicsPSO.GetTessPipelineState();
     tessFactorSize_         = GetTessFactorSize(graphicsPSO.GetPatchType());
+
+    /* Store thread-group sizes for mesh pipelines */
+    threadsPerObjectThreadgroup_    = graphicsPSO.GetThreadsPerObjectThreadgroup();
+    threadsPerMeshThreadgroup_      = graphicsPSO.GetThreadsPerMeshThreadgroup();
 }
 
 void MTCommandBuffer::SetComputePSORenderState(MTComputePSO& computePSO)
@@ -103,11 +110,11 @@ void MTCommandBuffer::ResetRenderStates()
     tessPipelineState_      = nil;
     boundSwapChain_         = nullptr;
     boundPipelineState_     = nullptr;
-    currentStagingPool_     = (currentStagingPool_ + 1) % maxNumStagingPools;
 }
 
-void MTCommandBuffer::ResetStagingPool()
+void MTCommandBuffer::ResetStagingPool(NSUInteger poolIndex)
 {
+    currentStagingPool_ = poolIndex % stagingBufferPools_.size();
     stagingBufferPools_[currentStagingPool_].Reset();
 }
 
@@ -131,6 +138,23 @@ id<MTLBuffer> MTCommandBuffer::GetTessFactorBufferAndGrow(NSUInteger numPatchesA
     return tessFactorBuffer_.GetNative();
 }
 
+NSUInteger MTCommandBuffer::ConvertVertexBuffers(
+    id<MTLBuffer>*          outBufferIds,
+    NSUInteger*             outBufferOffsets,
+    std::uint32_t           numBuffers,
+    Buffer* const *         buffers,
+    const std::uint64_t*    offsets)
+{
+    const NSUInteger count = (numBuffers < maxNumVertexBuffers ? static_cast<NSUInteger>(numBuffers) : maxNumVertexBuffers);
+    for_range(i, count)
+    {
+        auto* bufferMT = LLGL_CAST(MTBuffer*, buffers[i]);
+        outBufferIds[i]     = bufferMT->GetNative();
+        outBufferOffsets[i] = (offsets != nullptr ? static_cast<NSUInteger>(offsets[i]) : 0);
+    }
+    return count;
+}
+
 
 /*
  * ======= Private: =======
@@ -15,6 +15,10 @@
 #include "../RenderState/MTConstantsCache.h"
 #include <LLGL/Constants.h>
 #include <LLGL/CommandBufferFlags.h>
+#include <LLGL/TextureFlags.h>
+#include <LLGL/SamplerFlags.h>
+#include <vector>
+#include <memory>
 #include <cstdint>
 
 
@@ -28,6 +32,8 @@ class Resource;
 class MTResourceHeap;
 class MTGraphicsPSO;
 class MTComputePSO;
+class MTMultiSubmitCommandBuffer;
+class MTBindlessResourceTable;
 
 struct MTInternalBindingTable
 {
@@ -40,6 +46,9 @@ class MTCommandContext
 
     public:
 
+        MTCommandContext() = default;
+        ~MTCommandContext();
+
         // Resets all internal states.
         void Reset();
 
@@ -49,6 +58,12 @@ class MTCommandContext
         // Ends the currently bound command encoder.
         void Flush();
 
+        /*
+        Ends the current render pass. The render command encoder is kept open until the next command that requires another encoder,
+        so a subsequent primary render pass that renders into the same attachments without clearing them can continue with the same encoder.
+        */
+        void EndRenderEncoder();
+
         // Binds the respective command encoder with the specified descriptor.
         id<MTLRenderCommandEncoder> BindRenderEncoder(MTLRenderPassDescriptor* renderPassDesc, bool isPrimaryRenderPass = false);
         id<MTLComputeCommandEncoder> BindComputeEncoder();
@@ -61,13 +76,21 @@ class MTCommandContext
         // Retunrs a copy of the current render pass descriptor or null if there is none.
         MTLRenderPassDescriptor* CopyRenderPassDesc();
 
+        /*
+        Encodes the specified secondary command buffer into a new sub-encoder of a parallel render command encoder on a worker thread.
+        The sub-encoders are executed in the order they were created by this function, regardless of which thread finishes encoding first.
+        The parallel render encoder is ended with the next command that requires another encoder or a draw command of this context.
+        Returns false if the command buffer must be executed serially, i.e. it does not only contain render commands or there is no active render pass.
+        */
+        bool EncodeParallelRenderCommands(const MTMultiSubmitCommandBuffer& secondaryCmdBuffer);
+
     public:
 
         // Converts, binds, and stores the respective state in the internal render encoder state.
         void SetViewports(const Viewport* viewports, NSUInteger viewportCount);
         void SetScissorRects(const Scissor* scissors, NSUInteger scissorCount);
         void SetVertexBuffer(id<MTLBuffer> buffer, NSUInteger offset);
-        void SetVertexBuffers(const id<MTLBuffer>* buffers, const NSUInteger* offsets, NSUInteger bufferCount);
+        void SetVertexBuffers(const id<MTLBuffer>* buffers, const NSUInteger* offsets, NSUInteger bufferCount, NSUInteger firstSlot = 0);
         void SetGraphicsPSO(MTGraphicsPSO* pipelineState);
         void SetGraphicsResourceHeap(MTResourceHeap* resourceHeap, std::uint32_t descriptorSet);
         void SetBlendColor(const float blendColor[4]);
@@ -80,6 +103,15 @@ class MTCommandContext
         // Rebinds the currently bounds resource heap to the specified compute encoder (used for tessellation encoding).
         void RebindResourceHeap(id<MTLComputeCommandEncoder> computeEncoder);
 
+        // Encodes a scaled blit from the source into the destination region with the builtin compute kernel (see CommandBuffer::BlitTexture).
+        void BlitTexture(
+            id<MTLTexture>          dstTexture,
+            const TextureRegion&    dstRegion,
+            id<MTLTexture>          srcTexture,
+            const TextureRegion&    srcRegion,
+            const SamplerFilter     filter
+        );
+
     public:
 
         // Returns the native command buffer currently used by this context.
@@ -100,6 +132,12 @@ class MTCommandContext
             return renderEncoder_;
         }
 
+        // Returns true if a render command encoder or parallel render command encoder is active.
+        inline bool HasRenderEncoder() const
+        {
+            return ((renderEncoder_ != nil && pendingRenderPassDesc_ == nullptr) || parallelRenderEncoder_ != nil);
+        }
+
         // Returns the current compute command encoder.
         inline id<MTLComputeCommandEncoder> GetComputeEncoder() const
         {
@@ -118,12 +156,30 @@ class MTCommandContext
             descriptorCache_.SetResource(descriptor, resource);
         }
 
+        // Sets the specified range of resources in the descriptor cache.
+        inline void SetResources(std::uint32_t firstDescriptor, const ArrayView<Resource*>& resources)
+        {
+            descriptorCache_.SetResources(firstDescriptor, resources);
+        }
+
         // Sets the specified uniforms in the constants cache.
         inline void SetUniforms(std::uint32_t first, const void* data, std::uint16_t dataSize)
         {
             constantsCache_.SetUniforms(first, data, dataSize);
         }
 
+        // Sets the global resource table for bindless mode that is bound to every new render and compute command encoder. May also be null.
+        inline void SetBindlessResourceTable(const MTBindlessResourceTable* bindlessTable)
+        {
+            bindlessTable_ = bindlessTable;
+        }
+
+        // Returns the global resource table for bindless mode or null if there is none.
+        inline const MTBindlessResourceTable* GetBindlessResourceTable() const
+        {
+            return bindlessTable_;
+        }
+
     public:
 
         // Table of all internal binding slots.
@@ -137,6 +193,19 @@ class MTCommandContext
         void SubmitComputeEncoderState();
         void ResetComputeEncoderState();
 
+        // Returns a copy of the current render pass descriptor that loads all attachments, to continue the render pass with a new encoder.
+        MTLRenderPassDescriptor* CopyRenderPassDescForContinuation();
+
+        // Waits for all sub-encoders to finish and ends the parallel render encoder. Optionally continues the render pass with a new render encoder.
+        void EndParallelRenderEncoder(bool continueRenderPass);
+
+        // Binds the specified sub-encoder to this context and inherits the render states of the parent context.
+        void BindSubRenderEncoder(id<MTLRenderCommandEncoder> renderEncoder, const MTCommandContext& parentContext);
+
+        MTCommandContext* AllocSubContext();
+
+        void ReleasePendingRenderPassDesc();
+
     private:
 
         static constexpr NSUInteger maxNumVertexBuffers         = 32;
@@ -197,16 +266,23 @@ class MTCommandContext
         id<MTLBlitCommandEncoder>       blitEncoder_            = nil;
 
         MTLRenderPassDescriptor*        renderPassDesc_         = nullptr;
+        MTLRenderPassDescriptor*        pendingRenderPassDesc_  = nullptr; // Copy of the render pass whose encoder is kept open by EndRenderEncoder.
         MTRenderEncoderState            renderEncoderState_;
         MTComputeEncoderState           computeEncoderState_;
 
         bool                            isRenderEncoderPaused_  = false;
         MTDescriptorCache               descriptorCache_;
         MTConstantsCache                constantsCache_;
+        const MTBindlessResourceTable*  bindlessTable_          = nullptr;
 
         std::uint8_t                    renderDirtyBits_        = 0;
         std::uint8_t                    computeDirtyBits_       = 0;
 
+        id<MTLParallelRenderCommandEncoder>             parallelRenderEncoder_  = nil;
+        dispatch_group_t                                parallelEncodingGroup_  = nullptr;
+        std::vector<std::unique_ptr<MTCommandContext>>  subContexts_;                       // Contexts of the sub-encoders; only accessed by worker threads during parallel encoding.
+        std::size_t                                     numSubContexts_         = 0;
+
 };
 
 
@@ -6,12 +6,17 @@
  */
 
 #include "MTCommandContext.h"
+#include "MTCommandExecutor.h"
+#include "MTMultiSubmitCommandBuffer.h"
 #include "../RenderState/MTDescriptorCache.h"
 #include "../RenderState/MTConstantsCache.h"
 #include "../RenderState/MTResourceHeap.h"
 #include "../RenderState/MTGraphicsPSO.h"
 #include "../RenderState/MTComputePSO.h"
+#include "../RenderState/MTBindlessResourceTable.h"
+#include "../RenderState/MTBuiltinPSOFactory.h"
 #include "../../../Core/Assertion.h"
+#include "../../../Core/CoreUtils.h"
 #include <LLGL/PipelineStateFlags.h>
 #include <LLGL/Platform/Platform.h>
 #include <LLGL/Utils/ForRange.h>
@@ -23,8 +28,21 @@ namespace LLGL
 {
 
 
+MTCommandContext::~MTCommandContext()
+{
+    ReleasePendingRenderPassDesc();
+
+    if (parallelEncodingGroup_ != nullptr)
+    {
+        dispatch_group_wait(parallelEncodingGroup_, DISPATCH_TIME_FOREVER);
+        dispatch_release(parallelEncodingGroup_);
+    }
+}
+
 void MTCommandContext::Reset()
 {
+    EndParallelRenderEncoder(false);
+
     /* Reset all dirty bits */
     renderDirtyBits_ = ~0;
     computeDirtyBits_ = ~0;
@@ -41,6 +59,9 @@ void MTCommandContext::Reset(id<MTLCommandBuffer> cmdBuffer)
 
 void MTCommandContext::Flush()
 {
+    EndParallelRenderEncoder(false);
+    ReleasePendingRenderPassDesc();
+
     if (renderEncoder_ != nil)
     {
         [renderEncoder_ endEncoding];
@@ -58,10 +79,62 @@ void MTCommandContext::Flush()
     }
 }
 
+void MTCommandContext::EndRenderEncoder()
+{
+    /* Keep serial render command encoder open; the next primary render pass decides whether it can be continued */
+    if (renderEncoder_ != nil && parallelRenderEncoder_ == nil && renderPassDesc_ != nullptr && !isRenderEncoderPaused_)
+    {
+        ReleasePendingRenderPassDesc();
+        pendingRenderPassDesc_ = CopyRenderPassDesc();
+    }
+    else
+        Flush();
+}
+
+// Returns true if the specified attachment of a subsequent render pass can be encoded with the render command encoder of the previous attachment.
+static bool IsMTLAttachmentMergeable(MTLRenderPassAttachmentDescriptor* prevAttachment, MTLRenderPassAttachmentDescriptor* nextAttachment)
+{
+    return
+    (
+        prevAttachment.texture          == nextAttachment.texture           &&
+        prevAttachment.level            == nextAttachment.level             &&
+        prevAttachment.slice            == nextAttachment.slice             &&
+        prevAttachment.depthPlane       == nextAttachment.depthPlane        &&
+        prevAttachment.resolveTexture   == nextAttachment.resolveTexture    &&
+        prevAttachment.storeAction      == nextAttachment.storeAction       &&
+        (nextAttachment.texture == nil || nextAttachment.loadAction != MTLLoadActionClear)
+    );
+}
+
+// Returns true if the next render pass renders into the same attachments as the previous one and does not clear any of them.
+static bool IsMTLRenderPassMergeable(MTLRenderPassDescriptor* prevDesc, MTLRenderPassDescriptor* nextDesc)
+{
+    for_range(i, LLGL_MAX_NUM_COLOR_ATTACHMENTS)
+    {
+        if (!IsMTLAttachmentMergeable(prevDesc.colorAttachments[i], nextDesc.colorAttachments[i]))
+            return false;
+    }
+    return
+    (
+        IsMTLAttachmentMergeable(prevDesc.depthAttachment, nextDesc.depthAttachment)       &&
+        IsMTLAttachmentMergeable(prevDesc.stencilAttachment, nextDesc.stencilAttachment)   &&
+        prevDesc.visibilityResultBuffer     == nextDesc.visibilityResultBuffer              &&
+        prevDesc.renderTargetArrayLength    == nextDesc.renderTargetArrayLength
+    );
+}
+
 id<MTLRenderCommandEncoder> MTCommandContext::BindRenderEncoder(MTLRenderPassDescriptor* renderPassDesc, bool isPrimaryRenderPass)
 {
     LLGL_ASSERT_PTR(renderPassDesc);
 
+    /* Continue render command encoder of the previous render pass to avoid storing and reloading tile memory between them */
+    if (pendingRenderPassDesc_ != nullptr && isPrimaryRenderPass && IsMTLRenderPassMergeable(pendingRenderPassDesc_, renderPassDesc))
+    {
+        ReleasePendingRenderPassDesc();
+        renderPassDesc_ = renderPassDesc;
+        return renderEncoder_;
+    }
+
     Flush();
     renderEncoder_ = [cmdBuffer_ renderCommandEncoderWithDescriptor:renderPassDesc];
 
@@ -78,6 +151,10 @@ id<MTLRenderCommandEncoder> MTCommandContext::BindRenderEncoder(MTLRenderPassDes
     if (!constantsCache_.IsEmpty())
         constantsCache_.Reset();
 
+    /* Bind global resource table for bindless mode */
+    if (bindlessTable_ != nullptr)
+        bindlessTable_->BindToRenderEncoder(renderEncoder_);
+
     return renderEncoder_;
 }
 
@@ -96,6 +173,10 @@ id<MTLComputeCommandEncoder> MTCommandContext::BindComputeEncoder()
             descriptorCache_.Reset();
         if (!constantsCache_.IsEmpty())
             constantsCache_.Reset();
+
+        /* Bind global resource table for bindless mode */
+        if (bindlessTable_ != nullptr)
+            bindlessTable_->BindToComputeEncoder(computeEncoder_);
     }
     return computeEncoder_;
 }
@@ -112,7 +193,7 @@ id<MTLBlitCommandEncoder> MTCommandContext::BindBlitEncoder()
 
 void MTCommandContext::PauseRenderEncoder()
 {
-    if (renderEncoder_ != nil && !isRenderEncoderPaused_)
+    if (HasRenderEncoder() && !isRenderEncoderPaused_)
         isRenderEncoderPaused_ = true;
 }
 
@@ -121,23 +202,7 @@ void MTCommandContext::ResumeRenderEncoder()
     if (isRenderEncoderPaused_)
     {
         /* Bind new render command encoder with previous render pass */
-        auto renderPassDesc = CopyRenderPassDesc();
-        {
-            for_range(i, 8u)
-            {
-                if (renderPassDesc.colorAttachments[i].texture != nil)
-                {
-                    renderPassDesc.colorAttachments[i].loadAction = MTLLoadActionLoad;
-                    //renderPassDesc.colorAttachments[i].storeAction = MTLStoreActionStore;
-                }
-                else
-                    break;
-            }
-            if (renderPassDesc.depthAttachment.texture != nil)
-                renderPassDesc.depthAttachment.loadAction = MTLLoadActionLoad;
-            if (renderPassDesc.stencilAttachment != nil)
-                renderPassDesc.stencilAttachment.loadAction = MTLLoadActionLoad;
-        }
+        auto renderPassDesc = CopyRenderPassDescForContinuation();
         BindRenderEncoder(renderPassDesc);
         [renderPassDesc release];
         isRenderEncoderPaused_ = false;
@@ -149,6 +214,50 @@ MTLRenderPassDescriptor* MTCommandContext::CopyRenderPassDesc()
     return (MTLRenderPassDescriptor*)[renderPassDesc_ copy];
 }
 
+bool MTCommandContext::EncodeParallelRenderCommands(const MTMultiSubmitCommandBuffer& secondaryCmdBuffer)
+{
+    /* Parallel encoding requires an active render pass that can be continued with a parallel render encoder */
+    if (!secondaryCmdBuffer.IsParallelRenderable() || !HasRenderEncoder() || isRenderEncoderPaused_ || renderPassDesc_ == nullptr)
+        return false;
+
+    if (parallelRenderEncoder_ == nil)
+    {
+        /* End current render encoder and continue render pass with a parallel render encoder */
+        MTLRenderPassDescriptor* renderPassDesc = CopyRenderPassDescForContinuation();
+        {
+            [renderEncoder_ endEncoding];
+            renderEncoder_ = nil;
+            parallelRenderEncoder_ = [cmdBuffer_ parallelRenderCommandEncoderWithDescriptor:renderPassDesc];
+        }
+        [renderPassDesc release];
+
+        if (parallelEncodingGroup_ == nullptr)
+            parallelEncodingGroup_ = dispatch_group_create();
+    }
+
+    /* Sub-encoders are executed in the order of creation, so they must be created on this thread */
+    id<MTLRenderCommandEncoder> subEncoder = [parallelRenderEncoder_ renderCommandEncoder];
+
+    MTCommandContext* subContext = AllocSubContext();
+    subContext->BindSubRenderEncoder(subEncoder, *this);
+
+    /* Encode secondary command buffer on a worker thread; the sub-encoder is retained by the block */
+    const MTMultiSubmitCommandBuffer* cmdBuffer = &secondaryCmdBuffer;
+    dispatch_group_async(
+        parallelEncodingGroup_,
+        dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0),
+        ^{
+            @autoreleasepool
+            {
+                ExecuteMTMultiSubmitCommandBuffer(*cmdBuffer, *subContext);
+                subContext->Flush();
+            }
+        }
+    );
+
+    return true;
+}
+
 static void ConvertMTLViewport(MTLViewport& dst, const Viewport& src)
 {
     const double scaling = 1.0;//2.0 for retina display
@@ -193,12 +302,13 @@ void MTCommandContext::SetVertexBuffer(id<MTLBuffer> buffer, NSUInteger offset)
     renderDirtyBits_ |= DirtyBit_VertexBuffers;
 }
 
-void MTCommandContext::SetVertexBuffers(const id<MTLBuffer>* buffers, const NSUInteger* offsets, NSUInteger bufferCount)
+void MTCommandContext::SetVertexBuffers(const id<MTLBuffer>* buffers, const NSUInteger* offsets, NSUInteger bufferCount, NSUInteger firstSlot)
 {
+    /* Buffers and offsets are stored from the beginning of the arrays and passed to the encoder with the range of slots */
     ::memcpy(renderEncoderState_.vertexBuffers, buffers, sizeof(id) * bufferCount);
     ::memcpy(renderEncoderState_.vertexBufferOffsets, offsets, sizeof(NSUInteger) * bufferCount);
 
-    renderEncoderState_.vertexBufferRange.location  = 0;
+    renderEncoderState_.vertexBufferRange.location  = firstSlot;
     renderEncoderState_.vertexBufferRange.length    = bufferCount;
 
     renderDirtyBits_ |= DirtyBit_VertexBuffers;
@@ -296,8 +406,87 @@ void MTCommandContext::RebindResourceHeap(id<MTLComputeCommandEncoder> computeEn
         constantsCache_.FlushComputeResourcesForced(computeEncoder);
 }
 
+// Constant buffer layout of the BlitTexture2D kernel.
+struct MTBlitTextureDescriptor
+{
+    std::int32_t    srcOffset[2];
+    std::int32_t    srcMax[2];
+    float           srcScale[2];
+    std::int32_t    dstOffset[2];
+    std::uint32_t   dstExtent[2];
+    std::uint32_t   linearFilter;
+    std::uint32_t   padding0;
+};
+
+// Returns a 2D texture view of a single MIP-map level and array layer, so the builtin kernel does not depend on the texture type.
+static id<MTLTexture> NewTexture2DSubresourceView(id<MTLTexture> texture, const TextureSubresource& subresource)
+{
+    return [texture
+        newTextureViewWithPixelFormat:  [texture pixelFormat]
+        textureType:                    MTLTextureType2D
+        levels:                         NSMakeRange(subresource.baseMipLevel, 1)
+        slices:                         NSMakeRange(subresource.baseArrayLayer, 1)
+    ];
+}
+
+void MTCommandContext::BlitTexture(
+    id<MTLTexture>          dstTexture,
+    const TextureRegion&    dstRegion,
+    id<MTLTexture>          srcTexture,
+    const TextureRegion&    srcRegion,
+    const SamplerFilter     filter)
+{
+    if (dstRegion.extent.width == 0 || dstRegion.extent.height == 0 || srcRegion.extent.width == 0 || srcRegion.extent.height == 0)
+        return;
+
+    /* Builtin blit kernel is compiled on first use */
+    if (!MTBuiltinPSOFactory::Get().CompileRuntimeComputePSO(MTBuiltinComputePSO::BlitTexture2D))
+        return;
+
+    MTBlitTextureDescriptor blitDesc;
+    {
+        blitDesc.srcOffset[0]   = srcRegion.offset.x;
+        blitDesc.srcOffset[1]   = srcRegion.offset.y;
+        blitDesc.srcMax[0]      = srcRegion.offset.x + static_cast<std::int32_t>(srcRegion.extent.width) - 1;
+        blitDesc.srcMax[1]      = srcRegion.offset.y + static_cast<std::int32_t>(srcRegion.extent.height) - 1;
+        blitDesc.srcScale[0]    = static_cast<float>(srcRegion.extent.width) / static_cast<float>(dstRegion.extent.width);
+        blitDesc.srcScale[1]    = static_cast<float>(srcRegion.extent.height) / static_cast<float>(dstRegion.extent.height);
+        blitDesc.dstOffset[0]   = dstRegion.offset.x;
+        blitDesc.dstOffset[1]   = dstRegion.offset.y;
+        blitDesc.dstExtent[0]   = dstRegion.extent.width;
+        blitDesc.dstExtent[1]   = dstRegion.extent.height;
+        blitDesc.linearFilter   = (filter == SamplerFilter::Linear ? 1u : 0u);
+        blitDesc.padding0       = 0;
+    }
+
+    id<MTLTexture> srcView = NewTexture2DSubresourceView(srcTexture, srcRegion.subresource);
+    id<MTLTexture> dstView = NewTexture2DSubresourceView(dstTexture, dstRegion.subresource);
+
+    id<MTLComputeCommandEncoder> computeEncoder = BindComputeEncoder();
+    {
+        [computeEncoder setComputePipelineState:MTBuiltinPSOFactory::Get().GetComputePSO(MTBuiltinComputePSO::BlitTexture2D)];
+        [computeEncoder setTexture:srcView atIndex:0];
+        [computeEncoder setTexture:dstView atIndex:1];
+        [computeEncoder setBytes:&blitDesc length:sizeof(blitDesc) atIndex:0];
+        [computeEncoder
+            dispatchThreadgroups:   MTLSizeMake(DivideRoundUp(dstRegion.extent.width, 8u), DivideRoundUp(dstRegion.extent.height, 8u), 1)
+            threadsPerThreadgroup:  MTLSizeMake(8, 8, 1)
+        ];
+    }
+
+    /* Views are retained by the encoder until the command buffer has completed */
+    [srcView release];
+    [dstView release];
+
+    /* Builtin kernel overrides the compute PSO and resource heap bindings, so they must be submitted again with the next dispatch */
+    computeDirtyBits_ |= (DirtyBit_ComputePSO | DirtyBit_ComputeResourceHeap);
+}
+
 id<MTLRenderCommandEncoder> MTCommandContext::FlushAndGetRenderEncoder()
 {
+    /* Render commands of this context must be encoded after all sub-encoders of a parallel render encoder */
+    EndParallelRenderEncoder(true);
+
     if (renderDirtyBits_ != 0)
         SubmitRenderEncoderState();
     if (!descriptorCache_.IsEmpty())
@@ -443,6 +632,84 @@ void MTCommandContext::ResetComputeEncoderState()
     computeEncoderState_.computeResourceHeap = nullptr;
 }
 
+MTLRenderPassDescriptor* MTCommandContext::CopyRenderPassDescForContinuation()
+{
+    auto renderPassDesc = CopyRenderPassDesc();
+    {
+        for_range(i, 8u)
+        {
+            if (renderPassDesc.colorAttachments[i].texture != nil)
+            {
+                renderPassDesc.colorAttachments[i].loadAction = MTLLoadActionLoad;
+                //renderPassDesc.colorAttachments[i].storeAction = MTLStoreActionStore;
+            }
+            else
+                break;
+        }
+        if (renderPassDesc.depthAttachment.texture != nil)
+            renderPassDesc.depthAttachment.loadAction = MTLLoadActionLoad;
+        if (renderPassDesc.stencilAttachment != nil)
+            renderPassDesc.stencilAttachment.loadAction = MTLLoadActionLoad;
+    }
+    return renderPassDesc;
+}
+
+void MTCommandContext::EndParallelRenderEncoder(bool continueRenderPass)
+{
+    if (parallelRenderEncoder_ == nil)
+        return;
+
+    /* Wait until all sub-encoders have been encoded by the worker threads */
+    dispatch_group_wait(parallelEncodingGroup_, DISPATCH_TIME_FOREVER);
+    numSubContexts_ = 0;
+
+    [parallelRenderEncoder_ endEncoding];
+    parallelRenderEncoder_ = nil;
+
+    if (continueRenderPass)
+    {
+        /* Bind new render command encoder; this invalidates all render states, so they are submitted again */
+        auto renderPassDesc = CopyRenderPassDescForContinuation();
+        BindRenderEncoder(renderPassDesc);
+        [renderPassDesc release];
+    }
+}
+
+void MTCommandContext::BindSubRenderEncoder(id<MTLRenderCommandEncoder> renderEncoder, const MTCommandContext& parentContext)
+{
+    Reset(parentContext.cmdBuffer_);
+
+    /* Inherit render states of parent context; they are submitted to the sub-encoder with its first draw command */
+    renderEncoder_      = renderEncoder;
+    renderEncoderState_ = parentContext.renderEncoderState_;
+    bindingTable        = parentContext.bindingTable;
+    bindlessTable_      = parentContext.bindlessTable_;
+
+    /* Sub-encoders don't inherit any bindings from the parallel render encoder */
+    if (bindlessTable_ != nullptr)
+        bindlessTable_->BindToRenderEncoder(renderEncoder_);
+
+    const MTGraphicsPSO* graphicsPSO = renderEncoderState_.graphicsPSO;
+    descriptorCache_.Reset(graphicsPSO != nullptr ? graphicsPSO->GetPipelineLayout() : nullptr);
+    constantsCache_.Reset(graphicsPSO != nullptr ? graphicsPSO->GetConstantsCacheLayout() : nullptr);
+}
+
+void MTCommandContext::ReleasePendingRenderPassDesc()
+{
+    if (pendingRenderPassDesc_ != nullptr)
+    {
+        [pendingRenderPassDesc_ release];
+        pendingRenderPassDesc_ = nullptr;
+    }
+}
+
+MTCommandContext* MTCommandContext::AllocSubContext()
+{
+    if (numSubContexts_ == subContexts_.size())
+        subContexts_.push_back(MakeUnique<MTCommandContext>());
+    return subContexts_[numSubContexts_++].get();
+}
+
 
 } // /namespace LLGL
 
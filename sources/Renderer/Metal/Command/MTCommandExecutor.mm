@@ -35,7 +35,8 @@ static std::size_t ExecuteMTCommand(const MTOpcode opcode, const void* pc, MTCom
         case MTOpcodeExecute:
         {
             auto* cmd = reinterpret_cast<const MTCmdExecute*>(pc);
-            ExecuteMTMultiSubmitCommandBuffer(*(cmd->commandBuffer), context);
+            if (!context.EncodeParallelRenderCommands(*(cmd->commandBuffer)))
+                ExecuteMTMultiSubmitCommandBuffer(*(cmd->commandBuffer), context);
             return sizeof(*cmd);
         }
         case MTOpcodeCopyBuffer:
@@ -158,6 +159,12 @@ static std::size_t ExecuteMTCommand(const MTOpcode opcode, const void* pc, MTCom
             [blitEncoder generateMipmapsForTexture:cmd->texture];
             return sizeof(*cmd);
         }
+        case MTOpcodeBlitTexture:
+        {
+            auto* cmd = reinterpret_cast<const MTCmdBlitTexture*>(pc);
+            context.BlitTexture(cmd->destinationTexture, cmd->destinationRegion, cmd->sourceTexture, cmd->sourceRegion, cmd->filter);
+            return sizeof(*cmd);
+        }
         case MTOpcodeSetGraphicsPSO:
         {
             auto* cmd = reinterpret_cast<const MTCmdSetGraphicsPSO*>(pc);
@@ -225,7 +232,7 @@ static std::size_t ExecuteMTCommand(const MTOpcode opcode, const void* pc, MTCom
             auto* cmd = reinterpret_cast<const MTCmdSetVertexBuffers*>(pc);
             auto* bufferIds = reinterpret_cast<const id<MTLBuffer>*>(cmd + 1);
             auto* bufferOffsets = reinterpret_cast<const NSUInteger*>(bufferIds + cmd->count);
-            context.SetVertexBuffers(bufferIds, bufferOffsets, cmd->count);
+            context.SetVertexBuffers(bufferIds, bufferOffsets, cmd->count, cmd->first);
             return (sizeof(*cmd) + (sizeof(id) + sizeof(NSUInteger))*cmd->count);
         }
         case MTOpcodeSetGraphicsResourceHeap:
@@ -246,6 +253,13 @@ static std::size_t ExecuteMTCommand(const MTOpcode opcode, const void* pc, MTCom
             context.SetResource(cmd->descriptor, *(cmd->resource));
             return sizeof(*cmd);
         }
+        case MTOpcodeSetResources:
+        {
+            auto* cmd = reinterpret_cast<const MTCmdSetResources*>(pc);
+            auto* resources = reinterpret_cast<Resource* const*>(cmd + 1);
+            context.SetResources(cmd->firstDescriptor, ArrayView<Resource*>{ resources, cmd->numResources });
+            return (sizeof(*cmd) + sizeof(Resource*) * cmd->numResources);
+        }
         case MTOpcodeBindSwapChain:
         {
             auto* cmd = reinterpret_cast<const MTCmdBindRenderTarget*>(pc);
@@ -372,6 +386,20 @@ static std::size_t ExecuteMTCommand(const MTOpcode opcode, const void* pc, MTCom
             ];
             return sizeof(*cmd);
         }
+        case MTOpcodeExecuteIndirectCommands:
+        {
+            auto* cmd = reinterpret_cast<const MTCmdExecuteIndirectCommands*>(pc);
+            auto* resources = reinterpret_cast<const id<MTLResource>*>(cmd + 1);
+            id<MTLRenderCommandEncoder> renderEncoder = context.FlushAndGetRenderEncoder();
+            if (@available(macOS 10.14, iOS 12.0, *))
+            {
+                /* Index buffers are referenced by the indirect commands only, so they must be made resident explicitly */
+                if (cmd->numResources > 0)
+                    [renderEncoder useResources:resources count:cmd->numResources usage:MTLResourceUsageRead];
+                [renderEncoder executeCommandsInBuffer:cmd->indirectCommandBuffer withRange:NSMakeRange(0, cmd->numCommands)];
+            }
+            return (sizeof(*cmd) + sizeof(id)*cmd->numResources);
+        }
         case MTOpcodeDispatchThreads:
         {
             auto* cmd = reinterpret_cast<const MTCmdDispatchThreads*>(pc);
@@ -431,6 +459,11 @@ static std::size_t ExecuteMTCommand(const MTOpcode opcode, const void* pc, MTCom
             context.Flush();
             return 0;
         }
+        case MTOpcodeEndRenderEncoder:
+        {
+            context.EndRenderEncoder();
+            return 0;
+        }
         default:
             return 0;
     }
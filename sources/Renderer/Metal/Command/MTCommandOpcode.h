@@ -28,6 +28,7 @@ enum MTOpcode : std::uint8_t
     MTOpcodePauseRenderEncoder,
     MTOpcodeResumeRenderEncoder,
     MTOpcodeGenerateMipmaps,
+    MTOpcodeBlitTexture,
     MTOpcodeSetGraphicsPSO,
     MTOpcodeSetComputePSO,
     MTOpcodeSetTessellationPSO,
@@ -41,6 +42,7 @@ enum MTOpcode : std::uint8_t
     MTOpcodeSetGraphicsResourceHeap,
     MTOpcodeSetComputeResourceHeap,
     MTOpcodeSetResource,
+    MTOpcodeSetResources,
     MTOpcodeBindSwapChain,
     MTOpcodeBindRenderTarget,
     MTOpcodeClearRenderPass,
@@ -48,6 +50,7 @@ enum MTOpcode : std::uint8_t
     MTOpcodeDrawPrimitives,
     MTOpcodeDrawIndexedPatches,
     MTOpcodeDrawIndexedPrimitives,
+    MTOpcodeExecuteIndirectCommands,
     MTOpcodeDispatchThreads,
     MTOpcodeDispatchThreadgroups,
     MTOpcodeDispatchThreadgroupsIndirect,
@@ -55,6 +58,7 @@ enum MTOpcode : std::uint8_t
     MTOpcodePopDebugGroup,
     MTOpcodePresentDrawables,
     MTOpcodeFlush,
+    MTOpcodeEndRenderEncoder,
 };
 
 
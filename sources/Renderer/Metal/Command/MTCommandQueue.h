@@ -18,6 +18,8 @@ namespace LLGL
 {
 
 
+class MTBindlessResourceTable;
+
 class MTCommandQueue final : public CommandQueue
 {
 
@@ -41,10 +43,23 @@ class MTCommandQueue final : public CommandQueue
         // Submits the specified Metal command buffer.
         void SubmitCommandBuffer(id<MTLCommandBuffer> cmdBuffer);
 
+        // Sets the global resource table for bindless mode that is bound by all command contexts of this queue.
+        inline void SetBindlessResourceTable(const MTBindlessResourceTable* bindlessTable)
+        {
+            bindlessTable_ = bindlessTable;
+        }
+
+        // Returns the global resource table for bindless mode or null if there is none.
+        inline const MTBindlessResourceTable* GetBindlessResourceTable() const
+        {
+            return bindlessTable_;
+        }
+
     private:
 
-        id<MTLCommandQueue>     native_                 = nil;
-        id<MTLCommandBuffer>    lastSubmittedCmdBuffer_ = nil;
+        id<MTLCommandQueue>             native_                 = nil;
+        id<MTLCommandBuffer>            lastSubmittedCmdBuffer_ = nil;
+        const MTBindlessResourceTable*  bindlessTable_          = nullptr;
 
 };
 
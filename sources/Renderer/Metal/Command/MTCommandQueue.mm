@@ -9,7 +9,10 @@
 #include "MTDirectCommandBuffer.h"
 #include "MTMultiSubmitCommandBuffer.h"
 #include "MTCommandExecutor.h"
+#include "../RenderState/MTFence.h"
 #include "../../CheckedCast.h"
+#include "../../../Core/ProfileZone.h"
+#include <mach/mach_time.h>
 
 
 namespace LLGL
@@ -32,11 +35,14 @@ MTCommandQueue::~MTCommandQueue()
 
 void MTCommandQueue::Submit(CommandBuffer& commandBuffer)
 {
+    LLGL_PROFILE_ZONE("Submit");
+
     auto& commandBufferMT = LLGL_CAST(MTCommandBuffer&, commandBuffer);
     if (commandBufferMT.IsMultiSubmitCmdBuffer())
     {
         auto& multiSubmitCommandBufferMT = LLGL_CAST(MTMultiSubmitCommandBuffer&, commandBufferMT);
         MTCommandContext context;
+        context.SetBindlessResourceTable(bindlessTable_);
         context.Reset([native_ commandBuffer]);
         ExecuteMTMultiSubmitCommandBuffer(multiSubmitCommandBufferMT, context);
         SubmitCommandBuffer(context.GetCommandBuffer());
@@ -61,16 +67,64 @@ bool MTCommandQueue::QueryResult(
     return false; //todo
 }
 
+bool MTCommandQueue::QueryTimestampCalibration(TimestampCalibration& outCalibration)
+{
+    if (@available(macOS 10.15, iOS 14.0, *))
+    {
+        /* Sample CPU timestamp in units of mach_absolute_time() and convert it into the time domain of Timer::Tick */
+        MTLTimestamp cpuTimestamp = 0, gpuTimestamp = 0;
+        [[native_ device] sampleTimestamps:&cpuTimestamp gpuTimestamp:&gpuTimestamp];
+
+        mach_timebase_info_data_t timebase;
+        mach_timebase_info(&timebase);
+        if (timebase.denom == 0)
+            return false;
+
+        outCalibration.cpuTick      = (cpuTimestamp * timebase.numer) / timebase.denom;
+        outCalibration.gpuTimestamp = gpuTimestamp;
+        outCalibration.maxDeviation = 0;
+        return true;
+    }
+    return false;
+}
+
 /* ----- Fences ----- */
 
 void MTCommandQueue::Submit(Fence& fence)
 {
-    //todo
+    auto& fenceMT = LLGL_CAST(MTFence&, fence);
+    Submit(fenceMT, fenceMT.GetSignaledValue() + 1);
+}
+
+void MTCommandQueue::SubmitWait(Fence& /*fence*/)
+{
+    // dummy - all commands are executed on a single queue
 }
 
 bool MTCommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
 {
-    return false;//todo
+    auto& fenceMT = LLGL_CAST(MTFence&, fence);
+    return fenceMT.WaitValue(fenceMT.GetSignaledValue(), timeout);
+}
+
+void MTCommandQueue::Submit(Fence& fence, std::uint64_t value)
+{
+    /* Signal fence with an empty command buffer, since it completes after all previously committed command buffers */
+    auto& fenceMT = LLGL_CAST(MTFence&, fence);
+    id<MTLCommandBuffer> cmdBuffer = [native_ commandBuffer];
+    fenceMT.Signal(cmdBuffer, value);
+    SubmitCommandBuffer(cmdBuffer);
+}
+
+void MTCommandQueue::SubmitWait(Fence& /*fence*/, std::uint64_t /*value*/)
+{
+    // dummy - all commands are executed on a single queue
+}
+
+bool MTCommandQueue::WaitFence(Fence& fence, std::uint64_t value, std::uint64_t timeout)
+{
+    auto& fenceMT = LLGL_CAST(MTFence&, fence);
+    return fenceMT.WaitValue(value, timeout);
 }
 
 void MTCommandQueue::WaitIdle()
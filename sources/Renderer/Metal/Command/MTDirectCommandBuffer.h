@@ -27,6 +27,7 @@ class MTDirectCommandBuffer final : public MTCommandBuffer
     public:
 
         MTDirectCommandBuffer(id<MTLDevice> device, MTCommandQueue& cmdQueue, const CommandBufferDescriptor& desc);
+        ~MTDirectCommandBuffer();
 
     public:
 
@@ -69,13 +70,21 @@ class MTDirectCommandBuffer final : public MTCommandBuffer
 
     private:
 
-        id<MTLCommandBuffer>            cmdBuffer_              = nil;
-        dispatch_semaphore_t            cmdBufferSemaphore_     = nil;
+        static constexpr NSUInteger             maxNumCommandBuffers    = 8;
 
-        MTCommandQueue&                 cmdQueue_;
-        MTCommandContext                context_;
+        id<MTLCommandBuffer>                    cmdBuffer_              = nil;
 
-        SmallVector<id<MTLDrawable>, 2> drawables_;
+        /*
+        One semaphore per native command buffer that can be in flight. Each semaphore is signaled by the completion handler of its command buffer,
+        so the staging pool of the same index is only overwritten once the GPU has finished reading from it.
+        */
+        SmallVector<dispatch_semaphore_t, 3>    cmdBufferSemaphores_;
+        NSUInteger                              currentCmdBufferIndex_  = 0;
+
+        MTCommandQueue&                         cmdQueue_;
+        MTCommandContext                        context_;
+
+        SmallVector<id<MTLDrawable>, 2>         drawables_;
 
 };
 
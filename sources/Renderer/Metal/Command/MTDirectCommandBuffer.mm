@@ -25,6 +25,7 @@
 #include "../Texture/MTRenderTarget.h"
 #include "../../CheckedCast.h"
 #include "../../../Core/Exception.h"
+#include "../../../Core/ProfileZone.h"
 #include <LLGL/TypeInfo.h>
 #include <LLGL/Utils/ForRange.h>
 #include <algorithm>
@@ -44,36 +45,56 @@ for smaller buffers an emulated CPU copy operation will be used.
 */
 static const NSUInteger g_minFillBufferForKernel = 64;
 
+static NSUInteger GetNumMTLCommandBuffers(const CommandBufferDescriptor& desc, NSUInteger maxNumCommandBuffers)
+{
+    return std::max<NSUInteger>(1, std::min<NSUInteger>(desc.numNativeBuffers, maxNumCommandBuffers));
+}
+
 MTDirectCommandBuffer::MTDirectCommandBuffer(id<MTLDevice> device, MTCommandQueue& cmdQueue, const CommandBufferDescriptor& desc) :
-    MTCommandBuffer    { device, desc.flags },
-    cmdQueue_          { cmdQueue           }
+    MTCommandBuffer    { device, desc, GetNumMTLCommandBuffers(desc, MTDirectCommandBuffer::maxNumCommandBuffers) },
+    cmdQueue_          { cmdQueue                                                                                }
+{
+    const NSUInteger numCmdBuffers = GetNumMTLCommandBuffers(desc, MTDirectCommandBuffer::maxNumCommandBuffers);
+    for_range(i, numCmdBuffers)
+    {
+        /* Create semaphores with an initial value of zero and signal them once, so they can be released while command buffers are still in flight */
+        dispatch_semaphore_t semaphore = dispatch_semaphore_create(0);
+        dispatch_semaphore_signal(semaphore);
+        cmdBufferSemaphores_.push_back(semaphore);
+    }
+    currentCmdBufferIndex_ = numCmdBuffers - 1;
+    context_.SetBindlessResourceTable(cmdQueue.GetBindlessResourceTable());
+}
+
+MTDirectCommandBuffer::~MTDirectCommandBuffer()
 {
-    const NSUInteger maxCmdBuffers = 3;
-    cmdBufferSemaphore_ = dispatch_semaphore_create(maxCmdBuffers);
+    for (dispatch_semaphore_t semaphore : cmdBufferSemaphores_)
+        dispatch_release(semaphore);
 }
 
 /* ----- Encoding ----- */
 
 void MTDirectCommandBuffer::Begin()
 {
-    /* Wait until next command buffer becomes available */
-    dispatch_semaphore_wait(cmdBufferSemaphore_, DISPATCH_TIME_FOREVER);
+    /* Wait until the GPU has completed the command buffer that was previously encoded with the next staging pool */
+    currentCmdBufferIndex_ = (currentCmdBufferIndex_ + 1) % cmdBufferSemaphores_.size();
+    dispatch_semaphore_t semaphore = cmdBufferSemaphores_[currentCmdBufferIndex_];
+    dispatch_semaphore_wait(semaphore, DISPATCH_TIME_FOREVER);
 
     /* Allocate new command buffer from command queue */
     cmdBuffer_ = [cmdQueue_.GetNative() commandBuffer];
 
-    /* Append complete handler to signal semaphore */
-    __block dispatch_semaphore_t blockSemaphore = cmdBufferSemaphore_;
+    /* Append complete handler to signal semaphore; the block retains the semaphore */
     [cmdBuffer_
         addCompletedHandler:^(id<MTLCommandBuffer> cmdBuffer)
         {
-            dispatch_semaphore_signal(blockSemaphore);
+            dispatch_semaphore_signal(semaphore);
         }
     ];
 
     /* Reset schedulers and pools */
     context_.Reset(cmdBuffer_);
-    ResetStagingPool();
+    ResetStagingPool(currentCmdBufferIndex_);
 }
 
 void MTDirectCommandBuffer::End()
@@ -96,7 +117,8 @@ void MTDirectCommandBuffer::Execute(CommandBuffer& deferredCommandBuffer)
         if (commandBufferMT.IsMultiSubmitCmdBuffer() && !commandBufferMT.IsPrimary())
         {
             auto& multiSubmitCommandBufferMT = LLGL_CAST(MTMultiSubmitCommandBuffer&, commandBufferMT);
-            ExecuteMTMultiSubmitCommandBuffer(multiSubmitCommandBufferMT, context_);
+            if (!context_.EncodeParallelRenderCommands(multiSubmitCommandBufferMT))
+                ExecuteMTMultiSubmitCommandBuffer(multiSubmitCommandBufferMT, context_);
         }
     }
 }
@@ -107,7 +129,7 @@ void MTDirectCommandBuffer::UpdateBuffer(
     Buffer&         dstBuffer,
     std::uint64_t   dstOffset,
     const void*     data,
-    std::uint16_t   dataSize)
+    std::uint64_t   dataSize)
 {
     auto& dstBufferMT = LLGL_CAST(MTBuffer&, dstBuffer);
 
@@ -156,6 +178,15 @@ void MTDirectCommandBuffer::CopyBuffer(
     context_.ResumeRenderEncoder();
 }
 
+void MTDirectCommandBuffer::CopyBuffer(
+    Buffer&                                 dstBuffer,
+    Buffer&                                 srcBuffer,
+    const ArrayView<BufferCopyRegion>&      regions)
+{
+    for (const BufferCopyRegion& region : regions)
+        CopyBuffer(dstBuffer, region.dstOffset, srcBuffer, region.srcOffset, region.size);
+}
+
 void MTDirectCommandBuffer::CopyBufferFromTexture(
     Buffer&                 dstBuffer,
     std::uint64_t           dstOffset,
@@ -279,6 +310,15 @@ void MTDirectCommandBuffer::CopyTexture(
     context_.ResumeRenderEncoder();
 }
 
+void MTDirectCommandBuffer::CopyTexture(
+    Texture&                                dstTexture,
+    Texture&                                srcTexture,
+    const ArrayView<TextureCopyRegion>&     regions)
+{
+    for (const TextureCopyRegion& region : regions)
+        CopyTexture(dstTexture, region.dstLocation, srcTexture, region.srcLocation, region.extent);
+}
+
 void MTDirectCommandBuffer::CopyTextureFromBuffer(
     Texture&                dstTexture,
     const TextureRegion&    dstRegion,
@@ -326,6 +366,15 @@ void MTDirectCommandBuffer::CopyTextureFromBuffer(
     context_.ResumeRenderEncoder();
 }
 
+void MTDirectCommandBuffer::CopyTextureFromBuffer(
+    Texture&                                    dstTexture,
+    Buffer&                                     srcBuffer,
+    const ArrayView<BufferTextureCopyRegion>&   regions)
+{
+    for (const BufferTextureCopyRegion& region : regions)
+        CopyTextureFromBuffer(dstTexture, region.textureRegion, srcBuffer, region.bufferOffset, region.rowStride, region.layerStride);
+}
+
 void MTDirectCommandBuffer::CopyTextureFromFramebuffer(
     Texture&                dstTexture,
     const TextureRegion&    dstRegion,
@@ -389,6 +438,23 @@ void MTDirectCommandBuffer::CopyTextureFromFramebuffer(
         [sourceTexture release];
 }
 
+void MTDirectCommandBuffer::BlitTexture(
+    Texture&                dstTexture,
+    const TextureRegion&    dstRegion,
+    Texture&                srcTexture,
+    const TextureRegion&    srcRegion,
+    const SamplerFilter     filter)
+{
+    auto& dstTextureMT = LLGL_CAST(MTTexture&, dstTexture);
+    auto& srcTextureMT = LLGL_CAST(MTTexture&, srcTexture);
+
+    context_.PauseRenderEncoder();
+    {
+        context_.BlitTexture(dstTextureMT.GetNative(), dstRegion, srcTextureMT.GetNative(), srcRegion, filter);
+    }
+    context_.ResumeRenderEncoder();
+}
+
 void MTDirectCommandBuffer::GenerateMips(Texture& texture)
 {
     auto& textureMT = LLGL_CAST(MTTexture&, texture);
@@ -447,10 +513,10 @@ void MTDirectCommandBuffer::SetScissors(std::uint32_t numScissors, const Scissor
 
 /* ----- Input Assembly ------ */
 
-void MTDirectCommandBuffer::SetVertexBuffer(Buffer& buffer)
+void MTDirectCommandBuffer::SetVertexBuffer(Buffer& buffer, std::uint64_t offset)
 {
     auto& bufferMT = LLGL_CAST(MTBuffer&, buffer);
-    context_.SetVertexBuffer(bufferMT.GetNative(), 0);
+    context_.SetVertexBuffer(bufferMT.GetNative(), static_cast<NSUInteger>(offset));
 }
 
 void MTDirectCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
@@ -463,6 +529,14 @@ void MTDirectCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
     );
 }
 
+void MTDirectCommandBuffer::SetVertexBuffers(std::uint32_t firstSlot, std::uint32_t numBuffers, Buffer* const * buffers, const std::uint64_t* offsets)
+{
+    id<MTLBuffer> bufferIds[maxNumVertexBuffers];
+    NSUInteger bufferOffsets[maxNumVertexBuffers];
+    const NSUInteger count = ConvertVertexBuffers(bufferIds, bufferOffsets, numBuffers, buffers, offsets);
+    context_.SetVertexBuffers(bufferIds, bufferOffsets, count, firstSlot);
+}
+
 /* ----- Resources ----- */
 
 void MTDirectCommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap, std::uint32_t descriptorSet)
@@ -489,6 +563,11 @@ void MTDirectCommandBuffer::SetResource(std::uint32_t descriptor, Resource& reso
     context_.SetResource(descriptor, resource);
 }
 
+void MTDirectCommandBuffer::SetResources(std::uint32_t firstDescriptor, const ArrayView<Resource*>& resources)
+{
+    context_.SetResources(firstDescriptor, resources);
+}
+
 void MTDirectCommandBuffer::ResetResourceSlots(
     const ResourceType  resourceType,
     std::uint32_t       firstSlot,
@@ -499,6 +578,11 @@ void MTDirectCommandBuffer::ResetResourceSlots(
     //todo
 }
 
+void MTDirectCommandBuffer::ResourceBarrier(std::uint32_t /*numBarriers*/, const ResourceBarrierDescriptor* /*barriers*/)
+{
+    // dummy; Metal tracks hazards of resources implicitly
+}
+
 /* ----- Render Passes ----- */
 
 void MTDirectCommandBuffer::BeginRenderPass(
@@ -508,6 +592,8 @@ void MTDirectCommandBuffer::BeginRenderPass(
     const ClearValue*   clearValues,
     std::uint32_t       /*swapBufferIndex*/)
 {
+    LLGL_PROFILE_ZONE("BeginRenderPass");
+
     if (LLGL::IsInstanceOf<SwapChain>(renderTarget))
     {
         /* Put current drawable into queue */
@@ -541,12 +627,17 @@ void MTDirectCommandBuffer::BeginRenderPass(
 
 void MTDirectCommandBuffer::EndRenderPass()
 {
-    context_.Flush();
+    context_.EndRenderEncoder();
+}
+
+void MTDirectCommandBuffer::NextSubpass()
+{
+    /* Subpasses are read via framebuffer fetch within the same render command encoder */
 }
 
 void MTDirectCommandBuffer::Clear(long flags, const ClearValue& clearValue)
 {
-    if (context_.GetRenderEncoder() != nil && flags != 0)
+    if (context_.HasRenderEncoder() && flags != 0)
     {
         /* Make new render pass descriptor with current clear values */
         MTLRenderPassDescriptor* renderPassDesc = context_.CopyRenderPassDesc();
@@ -603,7 +694,7 @@ static void FillMTRenderPassDesc(MTLRenderPassDescriptor* renderPassDesc, const
 
 void MTDirectCommandBuffer::ClearAttachments(std::uint32_t numAttachments, const AttachmentClear* attachments)
 {
-    if (context_.GetRenderEncoder() != nil && numAttachments > 0)
+    if (context_.HasRenderEncoder() && numAttachments > 0)
     {
         /* Make new render pass descriptor with current clear values */
         auto renderPassDesc = context_.CopyRenderPassDesc();
@@ -648,6 +739,31 @@ void MTDirectCommandBuffer::SetStencilReference(std::uint32_t reference, const S
     context_.SetStencilRef(reference, stencilFace);
 }
 
+void MTDirectCommandBuffer::SetShadingRate(const ShadingRate /*rate*/)
+{
+    // not supported by this backend
+}
+
+void MTDirectCommandBuffer::SetCullMode(const CullMode /*cullMode*/)
+{
+    // not supported by this backend
+}
+
+void MTDirectCommandBuffer::SetDepthState(const DepthDescriptor& /*depthDesc*/)
+{
+    // not supported by this backend
+}
+
+void MTDirectCommandBuffer::SetStencilState(const StencilDescriptor& /*stencilDesc*/)
+{
+    // not supported by this backend
+}
+
+void MTDirectCommandBuffer::SetPrimitiveTopology(const PrimitiveTopology /*topology*/)
+{
+    // not supported by this backend
+}
+
 void MTDirectCommandBuffer::SetUniforms(std::uint32_t first, const void* data, std::uint16_t dataSize)
 {
     context_.SetUniforms(first, data, dataSize);
@@ -670,11 +786,21 @@ void MTDirectCommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::uint
     //todo
 }
 
+void MTDirectCommandBuffer::BeginRenderCondition(Buffer& buffer, std::uint64_t offset, const RenderConditionMode mode)
+{
+    //todo
+}
+
 void MTDirectCommandBuffer::EndRenderCondition()
 {
     //todo
 }
 
+void MTDirectCommandBuffer::ResolveQueries(QueryHeap& queryHeap, std::uint32_t firstQuery, std::uint32_t numQueries, Buffer& dstBuffer, std::uint64_t dstOffset)
+{
+    //todo
+}
+
 /* ----- Stream Output ------ */
 
 void MTDirectCommandBuffer::BeginStreamOutput(std::uint32_t numBuffers, Buffer* const * buffers)
@@ -916,6 +1042,17 @@ void MTDirectCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, s
     }
 }
 
+void MTDirectCommandBuffer::DrawIndirect(
+    Buffer&         /*buffer*/,
+    std::uint64_t   /*offset*/,
+    Buffer&         /*countBuffer*/,
+    std::uint64_t   /*countBufferOffset*/,
+    std::uint32_t   /*maxNumCommands*/,
+    std::uint32_t   /*stride*/)
+{
+    // not supported by this backend
+}
+
 //TODO: support patches with indirect arguments
 void MTDirectCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
 {
@@ -994,6 +1131,54 @@ void MTDirectCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t of
     }
 }
 
+void MTDirectCommandBuffer::DrawIndexedIndirect(
+    Buffer&         /*buffer*/,
+    std::uint64_t   /*offset*/,
+    Buffer&         /*countBuffer*/,
+    std::uint64_t   /*countBufferOffset*/,
+    std::uint32_t   /*maxNumCommands*/,
+    std::uint32_t   /*stride*/)
+{
+    // not supported by this backend
+}
+
+void MTDirectCommandBuffer::DrawStreamOutput()
+{
+    // not supported by this backend
+}
+
+void MTDirectCommandBuffer::DrawMesh(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
+{
+    if (@available(macOS 13.0, iOS 16.0, *))
+    {
+        auto renderEncoder = context_.FlushAndGetRenderEncoder();
+        [renderEncoder
+            drawMeshThreadgroups:           MTLSizeMake(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ)
+            threadsPerObjectThreadgroup:    GetThreadsPerObjectThreadgroup()
+            threadsPerMeshThreadgroup:      GetThreadsPerMeshThreadgroup()
+        ];
+    }
+}
+
+void MTDirectCommandBuffer::DrawMeshIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    if (@available(macOS 13.0, iOS 16.0, *))
+    {
+        auto& bufferMT = LLGL_CAST(MTBuffer&, buffer);
+        auto renderEncoder = context_.FlushAndGetRenderEncoder();
+        while (numCommands-- > 0)
+        {
+            [renderEncoder
+                drawMeshThreadgroupsWithIndirectBuffer: bufferMT.GetNative()
+                indirectBufferOffset:                   static_cast<NSUInteger>(offset)
+                threadsPerObjectThreadgroup:            GetThreadsPerObjectThreadgroup()
+                threadsPerMeshThreadgroup:              GetThreadsPerMeshThreadgroup()
+            ];
+            offset += stride;
+        }
+    }
+}
+
 /* ----- Compute ----- */
 
 void MTDirectCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
@@ -1016,6 +1201,23 @@ void MTDirectCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offse
     ];
 }
 
+/* ----- Ray Tracing ----- */
+
+void MTDirectCommandBuffer::BuildAccelerationStructure(const AccelerationStructureBuildDescriptor& /*buildDesc*/)
+{
+    // not supported by this backend
+}
+
+void MTDirectCommandBuffer::CopyAccelerationStructure(Buffer& /*dst*/, Buffer& /*src*/, const AccelerationStructureCopyMode /*mode*/)
+{
+    // not supported by this backend
+}
+
+void MTDirectCommandBuffer::WriteAccelerationStructureCompactedSize(Buffer& /*src*/, Buffer& /*dstBuffer*/, std::uint64_t /*dstOffset*/)
+{
+    // not supported by this backend
+}
+
 /* ----- Debugging ----- */
 
 void MTDirectCommandBuffer::PushDebugGroup(const char* name)
@@ -11,7 +11,9 @@
 
 #include "MTCommandBuffer.h"
 #include "MTCommandOpcode.h"
+#include "MTCommand.h"
 #include "../../VirtualCommandBuffer.h"
+#include <vector>
 
 
 namespace LLGL
@@ -29,7 +31,7 @@ class MTMultiSubmitCommandBuffer final : public MTCommandBuffer
 
     public:
 
-        MTMultiSubmitCommandBuffer(id<MTLDevice> device, const CommandBufferDescriptor& desc);
+        MTMultiSubmitCommandBuffer(id<MTLDevice> device, const CommandBufferDescriptor& desc, bool useIndirectCommandBuffers = false);
         ~MTMultiSubmitCommandBuffer();
 
     public:
@@ -43,6 +45,25 @@ class MTMultiSubmitCommandBuffer final : public MTCommandBuffer
             return buffer_;
         }
 
+        // Returns true if this is a secondary command buffer that only records render commands, so it can be encoded into a sub-encoder of a parallel render encoder.
+        inline bool IsParallelRenderable() const
+        {
+            return (isSecondaryCmdBuffer_ && hasRenderCommandsOnly_);
+        }
+
+    private:
+
+        // Draw command that is kept back until the current run of draw commands ends, see FlushIndirectDraws().
+        struct MTIndirectDraw
+        {
+            bool                            indexed;
+            union
+            {
+                MTCmdDrawPrimitives         draw;
+                MTCmdDrawIndexedPrimitives  drawIndexed;
+            };
+        };
+
     private:
 
         void BindRenderEncoderForTessellation(NSUInteger numPatches, NSUInteger numInstances = 1);
@@ -57,12 +78,23 @@ class MTMultiSubmitCommandBuffer final : public MTCommandBuffer
 
         void GenerateMipmapsForTexture(id<MTLTexture> texture);
 
-        void SetNativeVertexBuffers(NSUInteger count, const id<MTLBuffer>* buffers, const NSUInteger* offsets);
+        void SetNativeVertexBuffers(NSUInteger count, const id<MTLBuffer>* buffers, const NSUInteger* offsets, NSUInteger first = 0);
 
         void FlushContext();
 
         void ReleaseIntermediateResources();
 
+        // Allocates the specified draw command, or keeps it back for an indirect command buffer.
+        void AllocDrawCommand(const MTCmdDrawPrimitives& cmd);
+        void AllocDrawIndexedCommand(const MTCmdDrawIndexedPrimitives& cmd);
+
+        /*
+        Ends the current run of draw commands. Long enough runs are encoded into a new indirect command buffer,
+        which is executed with a single command, and shorter runs are allocated as individual draw commands.
+        */
+        void FlushIndirectDraws();
+        void EncodeIndirectDraws();
+
         // Allocates only an opcode for empty commands.
         void AllocOpcode(const MTOpcode opcode);
 
@@ -82,6 +114,11 @@ class MTMultiSubmitCommandBuffer final : public MTCommandBuffer
         SmallVector<id<MTLTexture>, 2>  intermediateTextures_;
 
         bool                            isInsideRenderPass_     = false;
+        bool                            hasRenderCommandsOnly_  = true;
+
+        const bool                      indirectDrawsEnabled_   = false;
+        std::vector<MTIndirectDraw>     indirectDraws_;
+        SmallVector<id<MTLResource>, 2> indirectCommandBuffers_;
 
 };
 
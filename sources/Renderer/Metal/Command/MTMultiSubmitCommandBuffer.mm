@@ -24,6 +24,7 @@
 #include "../Texture/MTRenderTarget.h"
 #include "../../CheckedCast.h"
 #include "../../../Core/Exception.h"
+#include "../../../Core/ProfileZone.h"
 #include <LLGL/TypeInfo.h>
 #include <LLGL/Utils/ForRange.h>
 #include <algorithm>
@@ -34,9 +35,13 @@ namespace LLGL
 {
 
 
-MTMultiSubmitCommandBuffer::MTMultiSubmitCommandBuffer(id<MTLDevice> device, const CommandBufferDescriptor& desc) :
-    MTCommandBuffer       { device, desc.flags                                  },
-    isSecondaryCmdBuffer_ { ((desc.flags & CommandBufferFlags::Secondary) != 0) }
+// Minimum number of consecutive draw commands that are encoded into an indirect command buffer.
+static constexpr std::size_t g_minIndirectDrawRunLength = 8;
+
+MTMultiSubmitCommandBuffer::MTMultiSubmitCommandBuffer(id<MTLDevice> device, const CommandBufferDescriptor& desc, bool useIndirectCommandBuffers) :
+    MTCommandBuffer       { device, desc                                                                     },
+    isSecondaryCmdBuffer_ { ((desc.flags & CommandBufferFlags::Secondary) != 0)                              },
+    indirectDrawsEnabled_ { (useIndirectCommandBuffers && (desc.flags & CommandBufferFlags::MultiSubmit) != 0) }
 {
 }
 
@@ -52,12 +57,16 @@ void MTMultiSubmitCommandBuffer::Begin()
     buffer_.Clear();
     lastOpcode_ = MTOpcodeNop;
     encoderState_ = MTEncoderState::None;
+    hasRenderCommandsOnly_ = true;
+    indirectDraws_.clear();
     ResetRenderStates();
     ReleaseIntermediateResources();
 }
 
 void MTMultiSubmitCommandBuffer::End()
 {
+    FlushIndirectDraws();
+
     /* Don't flush context nor present drawables in a secondary command buffer */
     if (!isSecondaryCmdBuffer_)
     {
@@ -88,7 +97,7 @@ void MTMultiSubmitCommandBuffer::UpdateBuffer(
     Buffer&         dstBuffer,
     std::uint64_t   dstOffset,
     const void*     data,
-    std::uint16_t   dataSize)
+    std::uint64_t   dataSize)
 {
     auto& dstBufferMT = LLGL_CAST(MTBuffer&, dstBuffer);
 
@@ -131,6 +140,15 @@ void MTMultiSubmitCommandBuffer::CopyBuffer(
     }
 }
 
+void MTMultiSubmitCommandBuffer::CopyBuffer(
+    Buffer&                                 dstBuffer,
+    Buffer&                                 srcBuffer,
+    const ArrayView<BufferCopyRegion>&      regions)
+{
+    for (const BufferCopyRegion& region : regions)
+        CopyBuffer(dstBuffer, region.dstOffset, srcBuffer, region.srcOffset, region.size);
+}
+
 void MTMultiSubmitCommandBuffer::CopyBufferFromTexture(
     Buffer&                 dstBuffer,
     std::uint64_t           dstOffset,
@@ -247,6 +265,15 @@ void MTMultiSubmitCommandBuffer::CopyTexture(
     }
 }
 
+void MTMultiSubmitCommandBuffer::CopyTexture(
+    Texture&                                dstTexture,
+    Texture&                                srcTexture,
+    const ArrayView<TextureCopyRegion>&     regions)
+{
+    for (const TextureCopyRegion& region : regions)
+        CopyTexture(dstTexture, region.dstLocation, srcTexture, region.srcLocation, region.extent);
+}
+
 void MTMultiSubmitCommandBuffer::CopyTextureFromBuffer(
     Texture&                dstTexture,
     const TextureRegion&    dstRegion,
@@ -288,6 +315,15 @@ void MTMultiSubmitCommandBuffer::CopyTextureFromBuffer(
     }
 }
 
+void MTMultiSubmitCommandBuffer::CopyTextureFromBuffer(
+    Texture&                                    dstTexture,
+    Buffer&                                     srcBuffer,
+    const ArrayView<BufferTextureCopyRegion>&   regions)
+{
+    for (const BufferTextureCopyRegion& region : regions)
+        CopyTextureFromBuffer(dstTexture, region.textureRegion, srcBuffer, region.bufferOffset, region.rowStride, region.layerStride);
+}
+
 void MTMultiSubmitCommandBuffer::CopyTextureFromFramebuffer(
     Texture&                dstTexture,
     const TextureRegion&    dstRegion,
@@ -334,6 +370,27 @@ void MTMultiSubmitCommandBuffer::CopyTextureFromFramebuffer(
     }
 }
 
+void MTMultiSubmitCommandBuffer::BlitTexture(
+    Texture&                dstTexture,
+    const TextureRegion&    dstRegion,
+    Texture&                srcTexture,
+    const TextureRegion&    srcRegion,
+    const SamplerFilter     filter)
+{
+    auto& dstTextureMT = LLGL_CAST(MTTexture&, dstTexture);
+    auto& srcTextureMT = LLGL_CAST(MTTexture&, srcTexture);
+
+    BindComputeEncoder();
+    auto cmd = AllocCommand<MTCmdBlitTexture>(MTOpcodeBlitTexture);
+    {
+        cmd->destinationTexture = dstTextureMT.GetNative();
+        cmd->destinationRegion  = dstRegion;
+        cmd->sourceTexture      = srcTextureMT.GetNative();
+        cmd->sourceRegion       = srcRegion;
+        cmd->filter             = filter;
+    }
+}
+
 void MTMultiSubmitCommandBuffer::GenerateMips(Texture& texture)
 {
     auto& textureMT = LLGL_CAST(MTTexture&, texture);
@@ -385,21 +442,22 @@ void MTMultiSubmitCommandBuffer::SetScissors(std::uint32_t numScissors, const Sc
 /* ----- Input Assembly ------ */
 
 //private
-void MTMultiSubmitCommandBuffer::SetNativeVertexBuffers(NSUInteger count, const id<MTLBuffer>* buffers, const NSUInteger* offsets)
+void MTMultiSubmitCommandBuffer::SetNativeVertexBuffers(NSUInteger count, const id<MTLBuffer>* buffers, const NSUInteger* offsets, NSUInteger first)
 {
     auto cmd = AllocCommand<MTCmdSetVertexBuffers>(MTOpcodeSetVertexBuffers, (sizeof(id) + sizeof(NSUInteger))*count);
     {
+        cmd->first = first;
         cmd->count = count;
         ::memcpy(cmd + 1, buffers, sizeof(id)*count);
         ::memcpy(reinterpret_cast<char*>(cmd + 1) + sizeof(id)*count, offsets, sizeof(NSUInteger)*count);
     }
 }
 
-void MTMultiSubmitCommandBuffer::SetVertexBuffer(Buffer& buffer)
+void MTMultiSubmitCommandBuffer::SetVertexBuffer(Buffer& buffer, std::uint64_t offset)
 {
     auto& bufferMT = LLGL_CAST(MTBuffer&, buffer);
     id<MTLBuffer> bufferId = bufferMT.GetNative();
-    const NSUInteger bufferOffset = 0;
+    const NSUInteger bufferOffset = static_cast<NSUInteger>(offset);
     SetNativeVertexBuffers(1, &bufferId, &bufferOffset);
 }
 
@@ -413,6 +471,14 @@ void MTMultiSubmitCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
     );
 }
 
+void MTMultiSubmitCommandBuffer::SetVertexBuffers(std::uint32_t firstSlot, std::uint32_t numBuffers, Buffer* const * buffers, const std::uint64_t* offsets)
+{
+    id<MTLBuffer> bufferIds[maxNumVertexBuffers];
+    NSUInteger bufferOffsets[maxNumVertexBuffers];
+    const NSUInteger count = ConvertVertexBuffers(bufferIds, bufferOffsets, numBuffers, buffers, offsets);
+    SetNativeVertexBuffers(count, bufferIds, bufferOffsets, firstSlot);
+}
+
 /* ----- Resources ----- */
 
 void MTMultiSubmitCommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap, std::uint32_t descriptorSet)
@@ -455,6 +521,20 @@ void MTMultiSubmitCommandBuffer::SetResource(std::uint32_t descriptor, Resource&
     }
 }
 
+void MTMultiSubmitCommandBuffer::SetResources(std::uint32_t firstDescriptor, const ArrayView<Resource*>& resources)
+{
+    if (resources.empty())
+        return;
+
+    const std::size_t resourcesSize = sizeof(Resource*) * resources.size();
+    auto cmd = AllocCommand<MTCmdSetResources>(MTOpcodeSetResources, resourcesSize);
+    {
+        cmd->firstDescriptor    = firstDescriptor;
+        cmd->numResources       = static_cast<std::uint32_t>(resources.size());
+        ::memcpy(cmd + 1, resources.data(), resourcesSize);
+    }
+}
+
 void MTMultiSubmitCommandBuffer::ResetResourceSlots(
     const ResourceType  resourceType,
     std::uint32_t       firstSlot,
@@ -465,6 +545,11 @@ void MTMultiSubmitCommandBuffer::ResetResourceSlots(
     //todo
 }
 
+void MTMultiSubmitCommandBuffer::ResourceBarrier(std::uint32_t /*numBarriers*/, const ResourceBarrierDescriptor* /*barriers*/)
+{
+    // dummy; Metal tracks hazards of resources implicitly
+}
+
 /* ----- Render Passes ----- */
 
 void MTMultiSubmitCommandBuffer::BeginRenderPass(
@@ -474,6 +559,8 @@ void MTMultiSubmitCommandBuffer::BeginRenderPass(
     const ClearValue*   clearValues,
     std::uint32_t       /*swapBufferIndex*/)
 {
+    LLGL_PROFILE_ZONE("BeginRenderPass");
+
     auto AllocCommandBindRenderTarget = [this, numClearValues, clearValues, &renderTarget, renderPass](MTOpcode opcode) -> void
     {
         /* Only allocate payload for clear values if a render pass was specified */
@@ -515,10 +602,15 @@ void MTMultiSubmitCommandBuffer::BeginRenderPass(
 
 void MTMultiSubmitCommandBuffer::EndRenderPass()
 {
-    FlushContext();
+    AllocOpcode(MTOpcodeEndRenderEncoder);
     isInsideRenderPass_ = false;
 }
 
+void MTMultiSubmitCommandBuffer::NextSubpass()
+{
+    /* Subpasses are read via framebuffer fetch within the same render command encoder */
+}
+
 //TODO: support clearing all active attachments at once
 void MTMultiSubmitCommandBuffer::Clear(long flags, const ClearValue& clearValue)
 {
@@ -619,6 +711,31 @@ void MTMultiSubmitCommandBuffer::SetStencilReference(std::uint32_t reference, co
     }
 }
 
+void MTMultiSubmitCommandBuffer::SetShadingRate(const ShadingRate /*rate*/)
+{
+    // not supported by this backend
+}
+
+void MTMultiSubmitCommandBuffer::SetCullMode(const CullMode /*cullMode*/)
+{
+    // not supported by this backend
+}
+
+void MTMultiSubmitCommandBuffer::SetDepthState(const DepthDescriptor& /*depthDesc*/)
+{
+    // not supported by this backend
+}
+
+void MTMultiSubmitCommandBuffer::SetStencilState(const StencilDescriptor& /*stencilDesc*/)
+{
+    // not supported by this backend
+}
+
+void MTMultiSubmitCommandBuffer::SetPrimitiveTopology(const PrimitiveTopology /*topology*/)
+{
+    // not supported by this backend
+}
+
 void MTMultiSubmitCommandBuffer::SetUniforms(std::uint32_t first, const void* data, std::uint16_t dataSize)
 {
     auto cmd = AllocCommand<MTCmdSetUniforms>(MTOpcodeSetUniforms, dataSize);
@@ -646,11 +763,21 @@ void MTMultiSubmitCommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std:
     //todo
 }
 
+void MTMultiSubmitCommandBuffer::BeginRenderCondition(Buffer& buffer, std::uint64_t offset, const RenderConditionMode mode)
+{
+    //todo
+}
+
 void MTMultiSubmitCommandBuffer::EndRenderCondition()
 {
     //todo
 }
 
+void MTMultiSubmitCommandBuffer::ResolveQueries(QueryHeap& queryHeap, std::uint32_t firstQuery, std::uint32_t numQueries, Buffer& dstBuffer, std::uint64_t dstOffset)
+{
+    //todo
+}
+
 /* ----- Stream Output ------ */
 
 void MTMultiSubmitCommandBuffer::BeginStreamOutput(std::uint32_t numBuffers, Buffer* const * buffers)
@@ -686,14 +813,15 @@ void MTMultiSubmitCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t f
     else
     {
         BindRenderEncoder();
-        auto cmd = AllocCommand<MTCmdDrawPrimitives>(MTOpcodeDrawPrimitives);
+        MTCmdDrawPrimitives cmd;
         {
-            cmd->primitiveType  = GetPrimitiveType();
-            cmd->vertexStart    = static_cast<NSUInteger>(firstVertex);
-            cmd->vertexCount    = static_cast<NSUInteger>(numVertices);
-            cmd->instanceCount  = 1;
-            cmd->baseInstance   = 0;
+            cmd.primitiveType  = GetPrimitiveType();
+            cmd.vertexStart    = static_cast<NSUInteger>(firstVertex);
+            cmd.vertexCount    = static_cast<NSUInteger>(numVertices);
+            cmd.instanceCount  = 1;
+            cmd.baseInstance   = 0;
         }
+        AllocDrawCommand(cmd);
     }
 }
 
@@ -720,17 +848,18 @@ void MTMultiSubmitCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint
     else
     {
         BindRenderEncoder();
-        auto cmd = AllocCommand<MTCmdDrawIndexedPrimitives>(MTOpcodeDrawIndexedPrimitives);
+        MTCmdDrawIndexedPrimitives cmd;
         {
-            cmd->primitiveType      = GetPrimitiveType();
-            cmd->indexCount         = static_cast<NSUInteger>(numIndices);
-            cmd->indexType          = GetIndexType();
-            cmd->indexBuffer        = GetIndexBuffer();
-            cmd->indexBufferOffset  = GetIndexBufferOffset(static_cast<NSUInteger>(firstIndex));
-            cmd->instanceCount      = 1;
-            cmd->baseVertex         = 0;
-            cmd->baseInstance       = 0;
+            cmd.primitiveType      = GetPrimitiveType();
+            cmd.indexCount         = static_cast<NSUInteger>(numIndices);
+            cmd.indexType          = GetIndexType();
+            cmd.indexBuffer        = GetIndexBuffer();
+            cmd.indexBufferOffset  = GetIndexBufferOffset(static_cast<NSUInteger>(firstIndex));
+            cmd.instanceCount      = 1;
+            cmd.baseVertex         = 0;
+            cmd.baseInstance       = 0;
         }
+        AllocDrawIndexedCommand(cmd);
     }
 }
 
@@ -765,14 +894,15 @@ void MTMultiSubmitCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::u
     else
     {
         BindRenderEncoder();
-        auto cmd = AllocCommand<MTCmdDrawPrimitives>(MTOpcodeDrawPrimitives);
+        MTCmdDrawPrimitives cmd;
         {
-            cmd->primitiveType  = GetPrimitiveType();
-            cmd->vertexStart    = static_cast<NSUInteger>(firstVertex);
-            cmd->vertexCount    = static_cast<NSUInteger>(numVertices);
-            cmd->instanceCount  = static_cast<NSUInteger>(numInstances);
-            cmd->baseInstance   = static_cast<NSUInteger>(firstInstance);
+            cmd.primitiveType  = GetPrimitiveType();
+            cmd.vertexStart    = static_cast<NSUInteger>(firstVertex);
+            cmd.vertexCount    = static_cast<NSUInteger>(numVertices);
+            cmd.instanceCount  = static_cast<NSUInteger>(numInstances);
+            cmd.baseInstance   = static_cast<NSUInteger>(firstInstance);
         }
+        AllocDrawCommand(cmd);
     }
 }
 
@@ -809,17 +939,18 @@ void MTMultiSubmitCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices,
     else
     {
         BindRenderEncoder();
-        auto cmd = AllocCommand<MTCmdDrawIndexedPrimitives>(MTOpcodeDrawIndexedPrimitives);
+        MTCmdDrawIndexedPrimitives cmd;
         {
-            cmd->primitiveType      = GetPrimitiveType();
-            cmd->indexCount         = static_cast<NSUInteger>(numIndices);
-            cmd->indexType          = GetIndexType();
-            cmd->indexBuffer        = GetIndexBuffer();
-            cmd->indexBufferOffset  = GetIndexBufferOffset(static_cast<NSUInteger>(firstIndex));
-            cmd->instanceCount      = static_cast<NSUInteger>(numInstances);
-            cmd->baseVertex         = static_cast<NSUInteger>(vertexOffset);
-            cmd->baseInstance       = static_cast<NSUInteger>(firstInstance);
+            cmd.primitiveType      = GetPrimitiveType();
+            cmd.indexCount         = static_cast<NSUInteger>(numIndices);
+            cmd.indexType          = GetIndexType();
+            cmd.indexBuffer        = GetIndexBuffer();
+            cmd.indexBufferOffset  = GetIndexBufferOffset(static_cast<NSUInteger>(firstIndex));
+            cmd.instanceCount      = static_cast<NSUInteger>(numInstances);
+            cmd.baseVertex         = static_cast<NSUInteger>(vertexOffset);
+            cmd.baseInstance       = static_cast<NSUInteger>(firstInstance);
         }
+        AllocDrawIndexedCommand(cmd);
     }
 }
 
@@ -903,6 +1034,17 @@ void MTMultiSubmitCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offs
 #endif
 }
 
+void MTMultiSubmitCommandBuffer::DrawIndirect(
+    Buffer&         /*buffer*/,
+    std::uint64_t   /*offset*/,
+    Buffer&         /*countBuffer*/,
+    std::uint64_t   /*countBufferOffset*/,
+    std::uint32_t   /*maxNumCommands*/,
+    std::uint32_t   /*stride*/)
+{
+    // not supported by this backend
+}
+
 //TODO: support patches with indirect arguments
 void MTMultiSubmitCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
 {
@@ -985,6 +1127,32 @@ void MTMultiSubmitCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64
 #endif
 }
 
+void MTMultiSubmitCommandBuffer::DrawIndexedIndirect(
+    Buffer&         /*buffer*/,
+    std::uint64_t   /*offset*/,
+    Buffer&         /*countBuffer*/,
+    std::uint64_t   /*countBufferOffset*/,
+    std::uint32_t   /*maxNumCommands*/,
+    std::uint32_t   /*stride*/)
+{
+    // not supported by this backend
+}
+
+void MTMultiSubmitCommandBuffer::DrawStreamOutput()
+{
+    // not supported by this backend
+}
+
+void MTMultiSubmitCommandBuffer::DrawMesh(std::uint32_t /*numWorkGroupsX*/, std::uint32_t /*numWorkGroupsY*/, std::uint32_t /*numWorkGroupsZ*/)
+{
+    // not supported by this backend
+}
+
+void MTMultiSubmitCommandBuffer::DrawMeshIndirect(Buffer& /*buffer*/, std::uint64_t /*offset*/, std::uint32_t /*numCommands*/, std::uint32_t /*stride*/)
+{
+    // not supported by this backend
+}
+
 /* ----- Compute ----- */
 
 void MTMultiSubmitCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
@@ -1009,6 +1177,23 @@ void MTMultiSubmitCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t
     }
 }
 
+/* ----- Ray Tracing ----- */
+
+void MTMultiSubmitCommandBuffer::BuildAccelerationStructure(const AccelerationStructureBuildDescriptor& /*buildDesc*/)
+{
+    // not supported by this backend
+}
+
+void MTMultiSubmitCommandBuffer::CopyAccelerationStructure(Buffer& /*dst*/, Buffer& /*src*/, const AccelerationStructureCopyMode /*mode*/)
+{
+    // not supported by this backend
+}
+
+void MTMultiSubmitCommandBuffer::WriteAccelerationStructureCompactedSize(Buffer& /*src*/, Buffer& /*dstBuffer*/, std::uint64_t /*dstOffset*/)
+{
+    // not supported by this backend
+}
+
 /* ----- Debugging ----- */
 
 void MTMultiSubmitCommandBuffer::PushDebugGroup(const char* name)
@@ -1251,10 +1436,177 @@ void MTMultiSubmitCommandBuffer::ReleaseIntermediateResources()
     for (id<MTLTexture> tex : intermediateTextures_)
         [tex release];
     intermediateTextures_.clear();
+
+    for (id<MTLResource> indirectCommandBuffer : indirectCommandBuffers_)
+        [indirectCommandBuffer release];
+    indirectCommandBuffers_.clear();
+}
+
+void MTMultiSubmitCommandBuffer::AllocDrawCommand(const MTCmdDrawPrimitives& cmd)
+{
+    if (indirectDrawsEnabled_)
+    {
+        MTIndirectDraw indirectDraw;
+        {
+            indirectDraw.indexed    = false;
+            indirectDraw.draw       = cmd;
+        }
+        indirectDraws_.push_back(indirectDraw);
+    }
+    else
+        *AllocCommand<MTCmdDrawPrimitives>(MTOpcodeDrawPrimitives) = cmd;
+}
+
+void MTMultiSubmitCommandBuffer::AllocDrawIndexedCommand(const MTCmdDrawIndexedPrimitives& cmd)
+{
+    if (indirectDrawsEnabled_)
+    {
+        MTIndirectDraw indirectDraw;
+        {
+            indirectDraw.indexed        = true;
+            indirectDraw.drawIndexed    = cmd;
+        }
+        indirectDraws_.push_back(indirectDraw);
+    }
+    else
+        *AllocCommand<MTCmdDrawIndexedPrimitives>(MTOpcodeDrawIndexedPrimitives) = cmd;
+}
+
+void MTMultiSubmitCommandBuffer::FlushIndirectDraws()
+{
+    if (indirectDraws_.empty())
+        return;
+
+    if (indirectDraws_.size() >= g_minIndirectDrawRunLength)
+        EncodeIndirectDraws();
+
+    /* Allocate remaining draw commands individually; this must not go through AllocCommand() as it would flush the indirect draws again */
+    for (const MTIndirectDraw& indirectDraw : indirectDraws_)
+    {
+        if (indirectDraw.indexed)
+        {
+            *buffer_.AllocCommand<MTCmdDrawIndexedPrimitives>(MTOpcodeDrawIndexedPrimitives) = indirectDraw.drawIndexed;
+            lastOpcode_ = MTOpcodeDrawIndexedPrimitives;
+        }
+        else
+        {
+            *buffer_.AllocCommand<MTCmdDrawPrimitives>(MTOpcodeDrawPrimitives) = indirectDraw.draw;
+            lastOpcode_ = MTOpcodeDrawPrimitives;
+        }
+    }
+
+    indirectDraws_.clear();
+}
+
+void MTMultiSubmitCommandBuffer::EncodeIndirectDraws()
+{
+    if (@available(macOS 10.14, iOS 13.0, *))
+    {
+        /* Draw commands inherit PSO and all buffers from the render command encoder, so they are independent of any binding */
+        MTLIndirectCommandBufferDescriptor* indirectCmdBufferDesc = [[MTLIndirectCommandBufferDescriptor alloc] init];
+        {
+            indirectCmdBufferDesc.commandTypes                  = (MTLIndirectCommandTypeDraw | MTLIndirectCommandTypeDrawIndexed);
+            indirectCmdBufferDesc.inheritPipelineState          = YES;
+            indirectCmdBufferDesc.inheritBuffers                = YES;
+            indirectCmdBufferDesc.maxVertexBufferBindCount      = 0;
+            indirectCmdBufferDesc.maxFragmentBufferBindCount    = 0;
+        }
+        const NSUInteger numCommands = static_cast<NSUInteger>(indirectDraws_.size());
+        id<MTLIndirectCommandBuffer> indirectCommandBuffer = [GetDevice()
+            newIndirectCommandBufferWithDescriptor: indirectCmdBufferDesc
+            maxCommandCount:                        numCommands
+            options:                                0
+        ];
+        [indirectCmdBufferDesc release];
+
+        /* Keep draw commands for individual allocation if the indirect command buffer could not be created */
+        if (indirectCommandBuffer == nil)
+            return;
+
+        /* Encode draw commands and gather unique index buffers, which must be made resident when the indirect commands are executed */
+        SmallVector<id<MTLResource>, 4> indexBuffers;
+
+        for_range(i, numCommands)
+        {
+            id<MTLIndirectRenderCommand> indirectCmd = [indirectCommandBuffer indirectRenderCommandAtIndex:i];
+            const MTIndirectDraw& indirectDraw = indirectDraws_[i];
+            if (indirectDraw.indexed)
+            {
+                const MTCmdDrawIndexedPrimitives& cmd = indirectDraw.drawIndexed;
+                [indirectCmd
+                    drawIndexedPrimitives:  cmd.primitiveType
+                    indexCount:             cmd.indexCount
+                    indexType:              cmd.indexType
+                    indexBuffer:            cmd.indexBuffer
+                    indexBufferOffset:      cmd.indexBufferOffset
+                    instanceCount:          cmd.instanceCount
+                    baseVertex:             cmd.baseVertex
+                    baseInstance:           cmd.baseInstance
+                ];
+                if (std::find(indexBuffers.begin(), indexBuffers.end(), cmd.indexBuffer) == indexBuffers.end())
+                    indexBuffers.push_back(cmd.indexBuffer);
+            }
+            else
+            {
+                const MTCmdDrawPrimitives& cmd = indirectDraw.draw;
+                [indirectCmd
+                    drawPrimitives: cmd.primitiveType
+                    vertexStart:    cmd.vertexStart
+                    vertexCount:    cmd.vertexCount
+                    instanceCount:  cmd.instanceCount
+                    baseInstance:   cmd.baseInstance
+                ];
+            }
+        }
+
+        /* Replace the entire run of draw commands with a single command */
+        const std::size_t payloadSize = sizeof(id)*indexBuffers.size();
+        auto cmd = buffer_.AllocCommand<MTCmdExecuteIndirectCommands>(MTOpcodeExecuteIndirectCommands, payloadSize);
+        {
+            cmd->indirectCommandBuffer  = indirectCommandBuffer;
+            cmd->numCommands            = numCommands;
+            cmd->numResources           = static_cast<NSUInteger>(indexBuffers.size());
+            auto* resources = reinterpret_cast<id<MTLResource>*>(cmd + 1);
+            std::copy(indexBuffers.begin(), indexBuffers.end(), resources);
+        }
+        lastOpcode_ = MTOpcodeExecuteIndirectCommands;
+
+        indirectCommandBuffers_.push_back(indirectCommandBuffer);
+        indirectDraws_.clear();
+    }
+}
+
+// Returns true if the specified opcode only operates on the render command encoder, i.e. it can be executed by a sub-encoder of a parallel render encoder.
+static bool IsRenderEncoderOpcode(const MTOpcode opcode)
+{
+    switch (opcode)
+    {
+        case MTOpcodeSetGraphicsPSO:
+        case MTOpcodeSetViewports:
+        case MTOpcodeSetScissorRects:
+        case MTOpcodeSetBlendColor:
+        case MTOpcodeSetStencilRef:
+        case MTOpcodeSetUniforms:
+        case MTOpcodeSetVertexBuffers:
+        case MTOpcodeSetGraphicsResourceHeap:
+        case MTOpcodeSetResource:
+        case MTOpcodeSetResources:
+        case MTOpcodeDrawPrimitives:
+        case MTOpcodeDrawIndexedPrimitives:
+        case MTOpcodeExecuteIndirectCommands:
+            return true;
+        default:
+            return false;
+    }
 }
 
 void MTMultiSubmitCommandBuffer::AllocOpcode(const MTOpcode opcode)
 {
+    FlushIndirectDraws();
+
+    if (!IsRenderEncoderOpcode(opcode))
+        hasRenderCommandsOnly_ = false;
+
     /* Redundant single-opcode instructions can be ignored (such as MTOpcodeFlush) */
     if (lastOpcode_ != opcode)
     {
@@ -1266,6 +1618,10 @@ void MTMultiSubmitCommandBuffer::AllocOpcode(const MTOpcode opcode)
 template <typename TCommand>
 TCommand* MTMultiSubmitCommandBuffer::AllocCommand(const MTOpcode opcode, std::size_t payloadSize)
 {
+    FlushIndirectDraws();
+
+    if (!IsRenderEncoderOpcode(opcode))
+        hasRenderCommandsOnly_ = false;
     lastOpcode_ = opcode;
     return buffer_.AllocCommand<TCommand>(opcode, payloadSize);
 }
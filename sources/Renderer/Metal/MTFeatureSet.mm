@@ -76,6 +76,22 @@ static NSUInteger GetMaxMTBufferSize(id<MTLDevice> device)
         return minBufferSize256MB;
 }
 
+// Returns true if the device supports object and mesh functions, which requires the Metal 3 GPU family.
+static bool IsMeshShaderSupported(id<MTLDevice> device)
+{
+    if (@available(macOS 13.0, iOS 16.0, *))
+        return [device supportsFamily:MTLGPUFamilyMetal3];
+    return false;
+}
+
+// Returns true if the device supports programmable blending (framebuffer fetch), which requires an Apple GPU family.
+static bool IsFramebufferFetchSupported(id<MTLDevice> device)
+{
+    if (@available(macOS 11.0, iOS 13.0, *))
+        return [device supportsFamily:MTLGPUFamilyApple1];
+    return false;
+}
+
 // see https://developer.apple.com/metal/Metal-Feature-Set-Tables.pdf
 void LoadFeatureSetCaps(id<MTLDevice> device, MTLFeatureSet fset, RenderingCapabilities& caps)
 {
@@ -121,6 +137,8 @@ void LoadFeatureSetCaps(id<MTLDevice> device, MTLFeatureSet fset, RenderingCapab
     features.hasTessellationShaders         = false;
     features.hasTessellatorStage            = true;
     features.hasComputeShaders              = true;
+    features.hasMeshShaders                 = IsMeshShaderSupported(device);
+    features.hasRayTracing                  = false;
     features.hasInstancing                  = true;
     features.hasOffsetInstancing            = true;
     features.hasIndirectDrawing             = true;
@@ -128,6 +146,10 @@ void LoadFeatureSetCaps(id<MTLDevice> device, MTLFeatureSet fset, RenderingCapab
     features.hasConservativeRasterization   = false;
     features.hasStreamOutputs               = false;
     features.hasLogicOp                     = false;
+    features.hasPipelineCaching             = LLGL_OSX_AVAILABLE(macOS 11.0, iOS 14.0, *);
+    features.hasSubpasses                   = IsFramebufferFetchSupported(device);
+    features.hasVariableRateShading         = false;
+    features.hasTimestampCalibration        = false;
 
     /* Specify limits */
     auto& limits = caps.limits;
@@ -13,6 +13,8 @@
 
 #include <LLGL/RenderSystem.h>
 #include "../ContainerTypes.h"
+#include "../PipelineLayoutCache.h"
+#include "../SamplerCache.h"
 #include "../ProxyPipelineCache.h"
 
 #include "Command/MTCommandQueue.h"
@@ -25,17 +27,21 @@
 
 #include "RenderState/MTPipelineLayout.h"
 #include "RenderState/MTPipelineState.h"
+#include "RenderState/MTPipelineCache.h"
 #include "RenderState/MTResourceHeap.h"
 #include "RenderState/MTRenderPass.h"
 #include "RenderState/MTFence.h"
+#include "RenderState/MTBindlessResourceTable.h"
 
 #include "Shader/MTShader.h"
 
 #include "Texture/MTTexture.h"
 #include "Texture/MTSampler.h"
 #include "Texture/MTRenderTarget.h"
+#include "Texture/MTTransientHeapPool.h"
 
 #include <memory>
+#include <unordered_map>
 
 
 namespace LLGL
@@ -59,6 +65,20 @@ class MTRenderSystem final : public RenderSystem
         void CreateDeviceResources(id<MTLDevice> sharedDevice = nil);
         void QueryRenderingCaps();
 
+        // Enables argument buffers for resource heaps if requested by the renderer configuration and supported by the device.
+        void EnableArgumentBuffers(const RendererConfigurationMetal& config);
+
+        // Enables indirect command buffers for multi-submit command buffers if requested by the renderer configuration and supported by the device.
+        void EnableIndirectCommandBuffers(const RendererConfigurationMetal& config);
+
+        // Creates the global resource table for bindless mode if requested by the renderer configuration and supported by the device.
+        void EnableBindlessDescriptors(const RendererConfigurationMetal& config);
+
+        // Writes the specified resource into the bindless resource table.
+        void CreateBindlessDescriptor(Resource& resource, id<MTLResource> nativeResource, long bindFlags);
+        void CreateBindlessDescriptor(Sampler& sampler, id<MTLSamplerState> nativeSampler);
+        void ReleaseBindlessDescriptor(const Resource& resource);
+
         const char* QueryMetalVersion() const;
 
         MTLFeatureSet QueryHighestFeatureSet() const;
@@ -69,8 +89,23 @@ class MTRenderSystem final : public RenderSystem
 
         /* ----- Common objects ----- */
 
-        id<MTLDevice>                           device_             = nil;
+        id<MTLDevice>                           device_                 = nil;
         std::unique_ptr<MTIntermediateBuffer>   intermediateBuffer_;
+        MTTransientHeapPool                     transientHeapPool_;
+
+        bool                                    argumentBuffersEnabled_         = false;    // Resource heaps are encoded into argument buffers (see RendererConfigurationMetal).
+        NSUInteger                              argumentBufferSlot_             = 0;
+        bool                                    indirectCommandBuffersEnabled_  = false;    // Draw runs of multi-submit command buffers are encoded into indirect command buffers.
+
+        // Stable index of a resource in the bindless resource table and the binding flags it was created with.
+        struct BindlessDescriptor
+        {
+            std::uint32_t   index;
+            long            bindFlags;
+        };
+
+        std::unique_ptr<MTBindlessResourceTable>                    bindlessTable_;
+        std::unordered_map<const Resource*, BindlessDescriptor>     bindlessDescriptors_;
 
         /* ----- Hardware object containers ----- */
 
@@ -78,13 +113,14 @@ class MTRenderSystem final : public RenderSystem
         HWObjectInstance<MTCommandQueue>        commandQueue_;
         HWObjectContainer<MTCommandBuffer>      commandBuffers_;
         HWObjectContainer<MTBuffer>             buffers_;
-        HWObjectContainer<MTBufferArray>        bufferArrays_;
+        HWObjectPool<MTBufferArray>             bufferArrays_;
         HWObjectContainer<MTTexture>            textures_;
-        HWObjectContainer<MTSampler>            samplers_;
+        SamplerCache<MTSampler>                 samplers_;
         HWObjectContainer<MTRenderPass>         renderPasses_;
         HWObjectContainer<MTRenderTarget>       renderTargets_;
         HWObjectContainer<MTShader>             shaders_;
-        HWObjectContainer<MTPipelineLayout>     pipelineLayouts_;
+        PipelineLayoutCache<MTPipelineLayout>   pipelineLayouts_;
+        HWObjectContainer<MTPipelineCache>      pipelineCaches_;
         HWObjectInstance<ProxyPipelineCache>    pipelineCacheProxy_;
         HWObjectContainer<MTPipelineState>  	pipelineStates_;
         HWObjectContainer<MTResourceHeap>       resourceHeaps_;
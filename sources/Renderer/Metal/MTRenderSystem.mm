@@ -19,8 +19,11 @@
 #include "RenderState/MTGraphicsPSO.h"
 #include "RenderState/MTComputePSO.h"
 #include "RenderState/MTBuiltinPSOFactory.h"
+#include "../../Core/ProfileZone.h"
 #include <LLGL/ImageFlags.h>
+#include <LLGL/RendererConfiguration.h>
 #include <LLGL/Platform/Platform.h>
+#include <mutex>
 #include <LLGL/Backend/Metal/NativeHandle.h>
 #include <AvailabilityMacros.h>
 
@@ -38,6 +41,13 @@ MTRenderSystem::MTRenderSystem(const RenderSystemDescriptor& renderSystemDesc)
     else
         CreateDeviceResources();
     QueryRenderingCaps();
+
+    if (auto* rendererConfigMT = GetRendererConfiguration<RendererConfigurationMetal>(renderSystemDesc))
+    {
+        EnableArgumentBuffers(*rendererConfigMT);
+        EnableIndirectCommandBuffers(*rendererConfigMT);
+        EnableBindlessDescriptors(*rendererConfigMT);
+    }
 }
 
 MTRenderSystem::~MTRenderSystem()
@@ -64,12 +74,18 @@ CommandQueue* MTRenderSystem::GetCommandQueue()
     return commandQueue_.get();
 }
 
+CommandQueue* MTRenderSystem::GetCommandQueue(long /*queueFlags*/)
+{
+    /* Only a single command queue is supported */
+    return commandQueue_.get();
+}
+
 /* ----- Command buffers ----- */
 
 CommandBuffer* MTRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& commandBufferDesc)
 {
     if ((commandBufferDesc.flags & (CommandBufferFlags::MultiSubmit | CommandBufferFlags::Secondary)) != 0)
-        return commandBuffers_.emplace<MTMultiSubmitCommandBuffer>(device_, commandBufferDesc);
+        return commandBuffers_.emplace<MTMultiSubmitCommandBuffer>(device_, commandBufferDesc, indirectCommandBuffersEnabled_);
     else
         return commandBuffers_.emplace<MTDirectCommandBuffer>(device_, *commandQueue_, commandBufferDesc);
 }
@@ -84,7 +100,9 @@ void MTRenderSystem::Release(CommandBuffer& commandBuffer)
 Buffer* MTRenderSystem::CreateBuffer(const BufferDescriptor& bufferDesc, const void* initialData)
 {
     RenderSystem::AssertCreateBuffer(bufferDesc, GetRenderingCaps().limits.maxBufferSize);
-    return buffers_.emplace<MTBuffer>(device_, bufferDesc, initialData);
+    MTBuffer* bufferMT = buffers_.emplace<MTBuffer>(device_, bufferDesc, initialData);
+    CreateBindlessDescriptor(*bufferMT, bufferMT->GetNative(), bufferDesc.bindFlags);
+    return bufferMT;
 }
 
 BufferArray* MTRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer* const * bufferArray)
@@ -95,6 +113,7 @@ BufferArray* MTRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer*
 
 void MTRenderSystem::Release(Buffer& buffer)
 {
+    ReleaseBindlessDescriptor(buffer);
     buffers_.erase(&buffer);
 }
 
@@ -105,6 +124,8 @@ void MTRenderSystem::Release(BufferArray& bufferArray)
 
 void MTRenderSystem::WriteBuffer(Buffer& buffer, std::uint64_t offset, const void* data, std::uint64_t dataSize)
 {
+    LLGL_PROFILE_ZONE("WriteBuffer");
+
     commandQueue_->WaitIdle();
     auto& bufferMT = LLGL_CAST(MTBuffer&, buffer);
     bufferMT.Write(static_cast<NSUInteger>(offset), data, static_cast<NSUInteger>(dataSize));
@@ -141,9 +162,13 @@ void MTRenderSystem::UnmapBuffer(Buffer& buffer)
 
 Texture* MTRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const ImageView* initialImage)
 {
-    auto* textureMT = textures_.emplace<MTTexture>(device_, textureDesc);
+    auto* textureMT = textures_.emplace<MTTexture>(device_, textureDesc, &transientHeapPool_);
 
-    if (initialImage != nullptr)
+    /*
+    Transient textures share their memory with other textures, so initial image data would not persist,
+    and memoryless textures have no memory to write to at all
+    */
+    if (initialImage != nullptr && !textureMT->IsTransient() && !textureMT->IsMemoryless())
     {
         textureMT->WriteRegion(
             //TextureRegion{ Offset3D{ 0, 0, 0 }, textureMT->GetMipExtent(0) },
@@ -169,16 +194,21 @@ Texture* MTRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
         }
     }
 
+    CreateBindlessDescriptor(*textureMT, textureMT->GetNative(), textureDesc.bindFlags);
+
     return textureMT;
 }
 
 void MTRenderSystem::Release(Texture& texture)
 {
+    ReleaseBindlessDescriptor(texture);
     textures_.erase(&texture);
 }
 
 void MTRenderSystem::WriteTexture(Texture& texture, const TextureRegion& textureRegion, const ImageView& srcImageView)
 {
+    LLGL_PROFILE_ZONE("WriteTexture");
+
     commandQueue_->WaitIdle();
     auto& textureMT = LLGL_CAST(MTTexture&, texture);
     textureMT.WriteRegion(textureRegion, srcImageView);
@@ -195,11 +225,20 @@ void MTRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureR
 
 Sampler* MTRenderSystem::CreateSampler(const SamplerDescriptor& samplerDesc)
 {
-    return samplers_.emplace<MTSampler>(device_, samplerDesc);
+    /*
+    Samplers must support argument buffers to be referenced by argument buffers or the bindless resource table.
+    Samplers with identical descriptors share the same instance, since argument buffers are limited in the number of unique sampler states.
+    */
+    MTSampler* samplerMT = samplers_.emplace(samplerDesc, device_, samplerDesc, (argumentBuffersEnabled_ || bindlessTable_ != nullptr));
+    if (samplers_.use_count(samplerMT) == 1)
+        CreateBindlessDescriptor(*samplerMT, samplerMT->GetNative());
+    return samplerMT;
 }
 
 void MTRenderSystem::Release(Sampler& sampler)
 {
+    if (samplers_.use_count(&sampler) == 1)
+        ReleaseBindlessDescriptor(sampler);
     samplers_.erase(&sampler);
 }
 
@@ -207,7 +246,10 @@ void MTRenderSystem::Release(Sampler& sampler)
 
 ResourceHeap* MTRenderSystem::CreateResourceHeap(const ResourceHeapDescriptor& resourceHeapDesc, const ArrayView<ResourceViewDescriptor>& initialResourceViews)
 {
-    return resourceHeaps_.emplace<MTResourceHeap>(resourceHeapDesc, initialResourceViews);
+    if (argumentBuffersEnabled_)
+        return resourceHeaps_.emplace<MTResourceHeap>(resourceHeapDesc, initialResourceViews, device_, argumentBufferSlot_);
+    else
+        return resourceHeaps_.emplace<MTResourceHeap>(resourceHeapDesc, initialResourceViews);
 }
 
 void MTRenderSystem::Release(ResourceHeap& resourceHeap)
@@ -253,6 +295,24 @@ Shader* MTRenderSystem::CreateShader(const ShaderDescriptor& shaderDesc)
     return shaders_.emplace<MTShader>(device_, shaderDesc);
 }
 
+std::uint32_t MTRenderSystem::CreateShaders(const ArrayView<ShaderDescriptor>& shaderDescs, Shader** outShaders)
+{
+    std::mutex shadersMutex;
+    return CreateShaderBatch(
+        shaderDescs,
+        outShaders,
+        [this, &shadersMutex](const ShaderDescriptor& shaderDesc) -> Shader*
+        {
+            @autoreleasepool
+            {
+                RenderSystem::AssertCreateShader(shaderDesc);
+                return shaders_.emplace_concurrent<MTShader>(shadersMutex, device_, shaderDesc);
+            }
+        },
+        /*concurrent:*/ true
+    );
+}
+
 void MTRenderSystem::Release(Shader& shader)
 {
     shaders_.erase(&shader);
@@ -262,7 +322,7 @@ void MTRenderSystem::Release(Shader& shader)
 
 PipelineLayout* MTRenderSystem::CreatePipelineLayout(const PipelineLayoutDescriptor& pipelineLayoutDesc)
 {
-    return pipelineLayouts_.emplace<MTPipelineLayout>(device_, pipelineLayoutDesc);
+    return pipelineLayouts_.emplace(pipelineLayoutDesc, device_, pipelineLayoutDesc);
 }
 
 void MTRenderSystem::Release(PipelineLayout& pipelineLayout)
@@ -272,26 +332,46 @@ void MTRenderSystem::Release(PipelineLayout& pipelineLayout)
 
 /* ----- Pipeline Caches ----- */
 
-PipelineCache* MTRenderSystem::CreatePipelineCache(const Blob& /*initialBlob*/)
+PipelineCache* MTRenderSystem::CreatePipelineCache(const Blob& initialBlob)
 {
-    return ProxyPipelineCache::CreateInstance(pipelineCacheProxy_);
+    if (GetRenderingCaps().features.hasPipelineCaching)
+        return pipelineCaches_.emplace<MTPipelineCache>(device_, initialBlob);
+    else
+        return ProxyPipelineCache::CreateInstance(pipelineCacheProxy_);
 }
 
 void MTRenderSystem::Release(PipelineCache& pipelineCache)
 {
-    ProxyPipelineCache::ReleaseInstance(pipelineCacheProxy_, pipelineCache);
+    if (GetRenderingCaps().features.hasPipelineCaching)
+        pipelineCaches_.erase(&pipelineCache);
+    else
+        ProxyPipelineCache::ReleaseInstance(pipelineCacheProxy_, pipelineCache);
 }
 
 /* ----- Pipeline States ----- */
 
-PipelineState* MTRenderSystem::CreatePipelineState(const GraphicsPipelineDescriptor& pipelineStateDesc, PipelineCache* /*pipelineCache*/)
+PipelineState* MTRenderSystem::CreatePipelineState(const GraphicsPipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
 {
-    return pipelineStates_.emplace<MTGraphicsPSO>(device_, pipelineStateDesc, GetDefaultRenderPass());
+    LLGL_PROFILE_ZONE("CreateGraphicsPipelineState");
+
+    return pipelineStates_.emplace<MTGraphicsPSO>(
+        device_,
+        pipelineStateDesc,
+        GetDefaultRenderPass(),
+        indirectCommandBuffersEnabled_,
+        (GetRenderingCaps().features.hasPipelineCaching ? pipelineCache : nullptr)
+    );
 }
 
-PipelineState* MTRenderSystem::CreatePipelineState(const ComputePipelineDescriptor& pipelineStateDesc, PipelineCache* /*pipelineCache*/)
+PipelineState* MTRenderSystem::CreatePipelineState(const ComputePipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
 {
-    return pipelineStates_.emplace<MTComputePSO>(device_, pipelineStateDesc);
+    LLGL_PROFILE_ZONE("CreateComputePipelineState");
+
+    return pipelineStates_.emplace<MTComputePSO>(
+        device_,
+        pipelineStateDesc,
+        (GetRenderingCaps().features.hasPipelineCaching ? pipelineCache : nullptr)
+    );
 }
 
 void MTRenderSystem::Release(PipelineState& pipelineState)
@@ -338,6 +418,96 @@ bool MTRenderSystem::GetNativeHandle(void* nativeHandle, std::size_t nativeHandl
     return false;
 }
 
+std::uint32_t MTRenderSystem::QueryMemoryHeaps(MemoryHeapInfo* /*outHeapInfos*/, std::uint32_t /*maxNumHeaps*/)
+{
+    return 0; // not supported by this backend
+}
+
+std::uint32_t MTRenderSystem::GetBindlessDescriptorIndex(const Resource& resource, long bindFlags)
+{
+    auto it = bindlessDescriptors_.find(&resource);
+    if (it == bindlessDescriptors_.end())
+        return LLGL_INVALID_SLOT;
+
+    /* Samplers only have a single entry */
+    if (resource.GetResourceType() == ResourceType::Sampler)
+        return it->second.index;
+
+    /* All views of a resource share the same entry, i.e. its GPU address or resource ID */
+    switch (bindFlags)
+    {
+        case BindFlags::ConstantBuffer:
+        case BindFlags::Sampled:
+        case BindFlags::Storage:
+            return ((it->second.bindFlags & bindFlags) != 0 ? it->second.index : LLGL_INVALID_SLOT);
+        default:
+            return LLGL_INVALID_SLOT;
+    }
+}
+
+bool MTRenderSystem::GetSparseTextureProperties(const Texture& /*texture*/, SparseTextureProperties& /*outProperties*/)
+{
+    return false; // not supported by this backend
+}
+
+bool MTRenderSystem::CommitTextureTiles(Texture& /*texture*/, const TextureRegion& /*textureRegion*/, bool /*commit*/)
+{
+    return false; // not supported by this backend
+}
+
+// Returns the native buffer or texture of the specified resource, or nil if the resource has no purgeable state of its own.
+static id<MTLResource> GetPurgeableResource(Resource* resource)
+{
+    if (resource != nullptr)
+    {
+        if (resource->GetResourceType() == ResourceType::Buffer)
+            return LLGL_CAST(MTBuffer*, resource)->GetNative();
+        if (resource->GetResourceType() == ResourceType::Texture)
+        {
+            /* Resources placed in a heap share the purgeable state of that heap */
+            auto* textureMT = LLGL_CAST(MTTexture*, resource);
+            if (!textureMT->IsTransient())
+                return textureMT->GetNative();
+        }
+    }
+    return nil;
+}
+
+bool MTRenderSystem::MakeResident(const ArrayView<Resource*>& resources)
+{
+    bool contentPreserved = true;
+    for (Resource* resource : resources)
+    {
+        if (id<MTLResource> native = GetPurgeableResource(resource))
+        {
+            /* Setting a new state returns the previous one, which is empty if the system has discarded the content */
+            if ([native setPurgeableState:MTLPurgeableStateNonVolatile] == MTLPurgeableStateEmpty)
+                contentPreserved = false;
+        }
+    }
+    return contentPreserved;
+}
+
+void MTRenderSystem::Evict(const ArrayView<Resource*>& resources)
+{
+    for (Resource* resource : resources)
+    {
+        if (id<MTLResource> native = GetPurgeableResource(resource))
+            [native setPurgeableState:MTLPurgeableStateVolatile];
+    }
+}
+
+
+bool MTRenderSystem::GetAccelerationStructureSizes(const AccelerationStructureBuildDescriptor& /*buildDesc*/, AccelerationStructureSizes& /*outSizes*/)
+{
+    return false; // not supported by this backend
+}
+
+std::uint64_t MTRenderSystem::GetAccelerationStructureAddress(const Buffer& /*buffer*/)
+{
+    return 0; // not supported by this backend
+}
+
 
 /*
  * ======= Private: =======
@@ -365,6 +535,10 @@ void MTRenderSystem::CreateDeviceResources(id<MTLDevice> sharedDevice)
         info.deviceName             = [[device_ name] cStringUsingEncoding:NSUTF8StringEncoding];
         info.vendorName             = "Apple";
         info.shadingLanguageName    = "Metal Shading Language";
+
+        /* GPU binaries of binary archives depend on the device and the OS version */
+        const std::string cacheID = info.deviceName + ';' + [[[NSProcessInfo processInfo] operatingSystemVersionString] UTF8String];
+        info.pipelineCacheID.assign(cacheID.begin(), cacheID.end());
     }
     SetRendererInfo(info);
 
@@ -379,6 +553,113 @@ void MTRenderSystem::CreateDeviceResources(id<MTLDevice> sharedDevice)
     intermediateBuffer_ = MakeUnique<MTIntermediateBuffer>(device_, MTLResourceStorageModeShared, intermediateBufferAlignment);
 }
 
+void MTRenderSystem::EnableArgumentBuffers(const RendererConfigurationMetal& config)
+{
+    if (!config.enableArgumentBuffers)
+        return;
+
+    /* Tier 2 is required to encode writable textures and to index arrays of resources */
+    if (@available(macOS 10.13, iOS 11.0, *))
+    {
+        if ([device_ argumentBuffersSupport] == MTLArgumentBuffersTier2)
+        {
+            argumentBuffersEnabled_ = true;
+            argumentBufferSlot_     = static_cast<NSUInteger>(config.argumentBufferSlot);
+        }
+    }
+}
+
+void MTRenderSystem::EnableIndirectCommandBuffers(const RendererConfigurationMetal& config)
+{
+    if (!config.enableIndirectCommandBuffers)
+        return;
+
+    /* Inheriting the pipeline state from the render command encoder requires macOS 10.14 or iOS 13; GPU families can only be queried since macOS 10.15 */
+    if (@available(macOS 10.15, iOS 13.0, *))
+    {
+        /* Indirect command buffers are not supported by Mac1 and Apple1/Apple2 GPU families */
+        if ([device_ supportsFamily:MTLGPUFamilyMac2] || [device_ supportsFamily:MTLGPUFamilyApple3])
+            indirectCommandBuffersEnabled_ = true;
+    }
+    else if (@available(macOS 10.14, iOS 13.0, *))
+        indirectCommandBuffersEnabled_ = true;
+}
+
+void MTRenderSystem::EnableBindlessDescriptors(const RendererConfigurationMetal& config)
+{
+    if (!config.enableBindlessDescriptors || !MTBindlessResourceTable::IsSupported(device_))
+        return;
+
+    bindlessTable_ = MakeUnique<MTBindlessResourceTable>(
+        device_,
+        static_cast<NSUInteger>(config.bindlessBufferSlot),
+        config.numBindlessDescriptors,
+        config.numBindlessSamplers
+    );
+    commandQueue_->SetBindlessResourceTable(bindlessTable_.get());
+
+    /* Update rendering capabilities now that bindless descriptors are available */
+    RenderingCapabilities caps = GetRenderingCaps();
+    caps.features.hasBindlessDescriptors = true;
+    SetRenderingCaps(caps);
+}
+
+void MTRenderSystem::CreateBindlessDescriptor(Resource& resource, id<MTLResource> nativeResource, long bindFlags)
+{
+    if (!bindlessTable_)
+        return;
+
+    const long bindlessFlags = (BindFlags::ConstantBuffer | BindFlags::Sampled | BindFlags::Storage);
+    if ((bindFlags & bindlessFlags) == 0)
+        return;
+
+    /* Only storage resources are declared resident with write access */
+    const bool writable = ((bindFlags & BindFlags::Storage) != 0);
+
+    std::uint32_t index = LLGL_INVALID_SLOT;
+    if (resource.GetResourceType() == ResourceType::Buffer)
+        index = bindlessTable_->WriteBuffer((id<MTLBuffer>)nativeResource, writable);
+    else
+        index = bindlessTable_->WriteTexture((id<MTLTexture>)nativeResource, writable);
+
+    if (index == LLGL_INVALID_SLOT)
+    {
+        GetMutableReport().Errorf("Metal bindless resource table has no entries left");
+        return;
+    }
+
+    bindlessDescriptors_[&resource] = BindlessDescriptor{ index, bindFlags };
+}
+
+void MTRenderSystem::CreateBindlessDescriptor(Sampler& sampler, id<MTLSamplerState> nativeSampler)
+{
+    if (!bindlessTable_)
+        return;
+
+    const std::uint32_t index = bindlessTable_->WriteSampler(nativeSampler);
+    if (index == LLGL_INVALID_SLOT)
+    {
+        GetMutableReport().Errorf("Metal bindless sampler table has no entries left");
+        return;
+    }
+
+    bindlessDescriptors_[&sampler] = BindlessDescriptor{ index, 0 };
+}
+
+void MTRenderSystem::ReleaseBindlessDescriptor(const Resource& resource)
+{
+    auto it = bindlessDescriptors_.find(&resource);
+    if (it == bindlessDescriptors_.end())
+        return;
+
+    if (resource.GetResourceType() == ResourceType::Sampler)
+        bindlessTable_->FreeSampler(it->second.index);
+    else
+        bindlessTable_->FreeResource(it->second.index);
+
+    bindlessDescriptors_.erase(it);
+}
+
 void MTRenderSystem::QueryRenderingCaps()
 {
     RenderingCapabilities caps;
@@ -51,6 +51,7 @@ class MTSwapChain final : public SwapChain
         const RenderPass* GetRenderPass() const override;
 
         bool SetVsyncInterval(std::uint32_t vsyncInterval) override;
+        bool SetFramePacing(const FramePacingDescriptor& desc) override;
 
     public:
 
@@ -87,6 +88,7 @@ class MTSwapChain final : public SwapChain
 
         MTLRenderPassDescriptor*    nativeMutableRenderPass_    = nullptr; // Cannot be id<>
         MTRenderPass                renderPass_;
+        PresentMode                 presentMode_                = PresentMode::Default;
 
 };
 
@@ -9,7 +9,10 @@
 #include "MTTypes.h"
 #include "RenderState/MTRenderPass.h"
 #include "../TextureUtils.h"
+#include "../SwapChainUtils.h"
+#include "../../Core/CoreUtils.h"
 #include "../../Core/Assertion.h"
+#include "../../Core/ProfileZone.h"
 #include <LLGL/Platform/NativeHandle.h>
 #include <LLGL/TypeInfo.h>
 
@@ -47,13 +50,43 @@ namespace LLGL
 {
 
 
+static void SetMetalLayerColorSpace(CAMetalLayer* metalLayer, ColorSpace colorSpace)
+{
+    CFStringRef colorSpaceName = nullptr;
+
+    if (colorSpace == ColorSpace::ExtendedSRGB)
+    {
+        if (@available(macOS 10.14.3, iOS 16.0, *))
+        {
+            metalLayer.wantsExtendedDynamicRangeContent = YES;
+            colorSpaceName = kCGColorSpaceExtendedLinearSRGB;
+        }
+    }
+    else if (colorSpace == ColorSpace::HDR10)
+    {
+        if (@available(macOS 11.0, iOS 16.0, *))
+        {
+            metalLayer.wantsExtendedDynamicRangeContent = YES;
+            colorSpaceName = kCGColorSpaceITUR_2100_PQ;
+        }
+    }
+
+    if (colorSpaceName != nullptr)
+    {
+        CGColorSpaceRef colorSpaceRef = CGColorSpaceCreateWithName(colorSpaceName);
+        metalLayer.colorspace = colorSpaceRef;
+        CGColorSpaceRelease(colorSpaceRef);
+    }
+}
+
 MTSwapChain::MTSwapChain(
     id<MTLDevice>                   device,
     const SwapChainDescriptor&      desc,
     const std::shared_ptr<Surface>& surface)
 :
-    SwapChain   { desc         },
-    renderPass_ { device, desc }
+    SwapChain    { desc             },
+    renderPass_  { device, desc     },
+    presentMode_ { desc.presentMode }
 {
     /* Initialize surface for MetalKit view */
     SetOrCreateSurface(surface, desc.resolution, desc.fullscreen, nullptr);
@@ -66,10 +99,35 @@ MTSwapChain::MTSwapChain(
     view_.colorPixelFormat          = renderPass_.GetColorAttachments()[0].pixelFormat;
     view_.depthStencilPixelFormat   = renderPass_.GetDepthStencilFormat();
     view_.sampleCount               = renderPass_.GetSampleCount();
+
+    /* Configure presentation of the underlying Metal layer */
+    CAMetalLayer* metalLayer = (CAMetalLayer*)view_.layer;
+
+    if (desc.maxFramesInFlight > 0)
+    {
+        /* CAMetalLayer only supports 2 or 3 drawables */
+        if (@available(macOS 10.13.2, iOS 11.2, *))
+            metalLayer.maximumDrawableCount = static_cast<NSUInteger>(Clamp(desc.maxFramesInFlight, 2u, 3u));
+    }
+
+    #ifndef LLGL_OS_IOS
+    if (presentMode_ == PresentMode::Mailbox || presentMode_ == PresentMode::Immediate)
+    {
+        /* Present drawables as soon as possible; this is only supported on macOS */
+        if (@available(macOS 10.13, *))
+            metalLayer.displaySyncEnabled = NO;
+    }
+    #endif // /LLGL_OS_IOS
+
+    /* Tag layer with color space; the layer falls back to sRGB presentation if the color space is unavailable */
+    if (desc.colorSpace != ColorSpace::SRGB)
+        SetMetalLayerColorSpace(metalLayer, desc.colorSpace);
 }
 
 void MTSwapChain::Present()
 {
+    LLGL_PROFILE_ZONE("Present");
+
     /* Present backbuffer */
     [view_ draw];
 
@@ -114,6 +172,7 @@ const RenderPass* MTSwapChain::GetRenderPass() const
 bool MTSwapChain::SetVsyncInterval(std::uint32_t vsyncInterval)
 {
     static const NSInteger defaultRefreshRate = 60;
+    vsyncInterval = GetPresentSyncInterval(presentMode_, vsyncInterval);
     if (vsyncInterval > 0)
     {
         /* Apply v-sync interval to display refresh rate */
@@ -130,6 +189,30 @@ bool MTSwapChain::SetVsyncInterval(std::uint32_t vsyncInterval)
     return true;
 }
 
+bool MTSwapChain::SetFramePacing(const FramePacingDescriptor& desc)
+{
+    #ifdef LLGL_OS_IOS
+
+    /* MTKView is driven by a display link that already paces frames to the preferred frame rate */
+    if (desc.preferredFrameRate > 0)
+    {
+        const std::uint32_t minFrameRate = (desc.minFrameRate > 0 ? desc.minFrameRate : desc.preferredFrameRate);
+        const std::uint32_t maxFrameRate = (desc.maxFrameRate > 0 ? desc.maxFrameRate : desc.preferredFrameRate);
+        view_.preferredFramesPerSecond = static_cast<NSInteger>(Clamp(desc.preferredFrameRate, minFrameRate, maxFrameRate));
+    }
+    else
+        view_.preferredFramesPerSecond = [UIScreen mainScreen].maximumFramesPerSecond;
+
+    return true;
+
+    #else
+
+    /* Frame pacing is only supported on mobile platforms */
+    return SwapChain::SetFramePacing(desc);
+
+    #endif // /LLGL_OS_IOS
+}
+
 MTLRenderPassDescriptor* MTSwapChain::GetAndUpdateNativeRenderPass(
     const MTRenderPass& renderPass,
     std::uint32_t       numClearValues,
@@ -189,7 +189,10 @@ MTLVertexFormat ToMTLVertexFormat(const Format format)
         case Format::R16SNorm:      return MTLVertexFormatShortNormalized;
         case Format::R16UInt:       return MTLVertexFormatUShort;
         case Format::R16SInt:       return MTLVertexFormatShort;
-        case Format::R16Float:      break;
+        case Format::R16Float:
+            if (@available(macOS 10.13, iOS 11.0, *))
+                return MTLVertexFormatHalf;
+            break;
 
         case Format::R32UInt:       return MTLVertexFormatUInt;
         case Format::R32SInt:       return MTLVertexFormatInt;
@@ -205,7 +208,7 @@ MTLVertexFormat ToMTLVertexFormat(const Format format)
         case Format::RG16SNorm:     return MTLVertexFormatShort2Normalized;
         case Format::RG16UInt:      return MTLVertexFormatUShort2;
         case Format::RG16SInt:      return MTLVertexFormatShort2;
-        case Format::RG16Float:     break;
+        case Format::RG16Float:     return MTLVertexFormatHalf2;
 
         case Format::RG32UInt:      return MTLVertexFormatUInt2;
         case Format::RG32SInt:      return MTLVertexFormatInt2;
@@ -221,7 +224,7 @@ MTLVertexFormat ToMTLVertexFormat(const Format format)
         case Format::RGB16SNorm:    return MTLVertexFormatShort3Normalized;
         case Format::RGB16UInt:     return MTLVertexFormatUShort3;
         case Format::RGB16SInt:     return MTLVertexFormatShort3;
-        case Format::RGB16Float:    break;
+        case Format::RGB16Float:    return MTLVertexFormatHalf3;
 
         case Format::RGB32UInt:     return MTLVertexFormatUInt3;
         case Format::RGB32SInt:     return MTLVertexFormatInt3;
@@ -237,12 +240,15 @@ MTLVertexFormat ToMTLVertexFormat(const Format format)
         case Format::RGBA16SNorm:   return MTLVertexFormatShort4Normalized;
         case Format::RGBA16UInt:    return MTLVertexFormatUShort4;
         case Format::RGBA16SInt:    return MTLVertexFormatShort4;
-        case Format::RGBA16Float:   break;
+        case Format::RGBA16Float:   return MTLVertexFormatHalf4;
 
         case Format::RGBA32UInt:    return MTLVertexFormatUInt4;
         case Format::RGBA32SInt:    return MTLVertexFormatInt4;
         case Format::RGBA32Float:   return MTLVertexFormatFloat4;
 
+        /* --- Packed formats --- */
+        case Format::RGB10A2UNorm:  return MTLVertexFormatUInt1010102Normalized;
+
         default:                    break;
     }
     MapFailed("Format", "MTLVertexFormat");
@@ -0,0 +1,111 @@
+/*
+ * MTBindlessResourceTable.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_MT_BINDLESS_RESOURCE_TABLE_H
+#define LLGL_MT_BINDLESS_RESOURCE_TABLE_H
+
+
+#import <Metal/Metal.h>
+
+#include <cstdint>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/*
+Global resource table for bindless mode (see RendererConfigurationMetal::enableBindlessDescriptors).
+The table is a single shared MTLBuffer with 8-byte entries: first the GPU addresses and resource IDs of buffers and textures, then the resource IDs of samplers.
+All buffers and textures in the table are declared resident with 'useResources' whenever the table is bound to a command encoder.
+*/
+class MTBindlessResourceTable
+{
+
+    public:
+
+        MTBindlessResourceTable(id<MTLDevice> device, NSUInteger slot, std::uint32_t numResources, std::uint32_t numSamplers);
+        ~MTBindlessResourceTable();
+
+        MTBindlessResourceTable(const MTBindlessResourceTable&) = delete;
+        MTBindlessResourceTable& operator = (const MTBindlessResourceTable&) = delete;
+
+        // Returns true if bindless resource tables are supported by the specified device, which requires the Metal 3 GPU family.
+        static bool IsSupported(id<MTLDevice> device);
+
+        // Writes the specified buffer or texture into the table and returns its index, or LLGL_INVALID_SLOT if the table is full.
+        std::uint32_t WriteBuffer(id<MTLBuffer> buffer, bool writable);
+        std::uint32_t WriteTexture(id<MTLTexture> texture, bool writable);
+
+        // Writes the specified sampler into the table and returns its index, or LLGL_INVALID_SLOT if the table is full.
+        std::uint32_t WriteSampler(id<MTLSamplerState> samplerState);
+
+        // Frees the specified entry. It can be reused by the next write, so the GPU must no longer reference it.
+        void FreeResource(std::uint32_t index);
+        void FreeSampler(std::uint32_t index);
+
+        // Binds the table to the vertex and fragment stages and declares the residency of all its resources.
+        void BindToRenderEncoder(id<MTLRenderCommandEncoder> renderEncoder) const;
+
+        // Binds the table to the compute stage and declares the residency of all its resources.
+        void BindToComputeEncoder(id<MTLComputeCommandEncoder> computeEncoder) const;
+
+    private:
+
+        // Allocator for stable entry indices.
+        struct IndexAllocator
+        {
+            std::uint32_t               capacity    = 0;
+            std::uint32_t               next        = 0;
+            std::vector<std::uint32_t>  freeIndices;
+        };
+
+        // Residency list of resources with the same usage; resources are removed by swapping them with the last entry.
+        struct ResidencyList
+        {
+            std::vector<id<MTLResource>>    resources;
+            std::vector<std::uint32_t>      indices;    // Table index of each resource.
+        };
+
+        // Location of a table entry in the residency lists.
+        struct ResidencyEntry
+        {
+            std::uint8_t    list        = 0;
+            std::uint32_t   position    = ~0u;
+        };
+
+    private:
+
+        static std::uint32_t AllocIndex(IndexAllocator& allocator);
+
+        std::uint32_t WriteResource(id<MTLResource> resource, std::uint64_t entry, bool writable);
+        void WriteEntry(std::uint32_t index, std::uint64_t entry);
+
+    private:
+
+        id<MTLBuffer>               tableBuffer_        = nil;
+        NSUInteger                  slot_               = 0;
+        NSUInteger                  samplerTableOffset_ = 0;
+
+        IndexAllocator              resourceAllocator_;
+        IndexAllocator              samplerAllocator_;
+
+        ResidencyList               residencyLists_[2]; // Read-only and read-write resources.
+        std::vector<ResidencyEntry> residencyEntries_;  // Location in the residency lists for each resource index.
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,194 @@
+/*
+ * MTBindlessResourceTable.mm
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "MTBindlessResourceTable.h"
+#include "../../../Core/Assertion.h"
+#include <LLGL/Constants.h>
+#include <algorithm>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+// Size (in bytes) of each entry in the bindless resource table.
+static constexpr NSUInteger g_bindlessEntrySize = sizeof(std::uint64_t);
+
+MTBindlessResourceTable::MTBindlessResourceTable(id<MTLDevice> device, NSUInteger slot, std::uint32_t numResources, std::uint32_t numSamplers) :
+    slot_               { slot                                                          },
+    samplerTableOffset_ { static_cast<NSUInteger>(numResources) * g_bindlessEntrySize   }
+{
+    resourceAllocator_.capacity = numResources;
+    samplerAllocator_.capacity  = numSamplers;
+    residencyEntries_.resize(numResources);
+
+    /* Create shared buffer for all table entries and initialize them with zeros */
+    const NSUInteger tableSize = static_cast<NSUInteger>(numResources + numSamplers) * g_bindlessEntrySize;
+    tableBuffer_ = [device newBufferWithLength:std::max<NSUInteger>(tableSize, g_bindlessEntrySize) options:MTLResourceStorageModeShared];
+    ::memset([tableBuffer_ contents], 0, [tableBuffer_ length]);
+}
+
+MTBindlessResourceTable::~MTBindlessResourceTable()
+{
+    [tableBuffer_ release];
+}
+
+bool MTBindlessResourceTable::IsSupported(id<MTLDevice> device)
+{
+    /* GPU addresses of buffers and resource IDs of textures and samplers require the Metal 3 GPU family */
+    if (@available(macOS 13.0, iOS 16.0, *))
+        return [device supportsFamily:MTLGPUFamilyMetal3];
+    return false;
+}
+
+std::uint32_t MTBindlessResourceTable::WriteBuffer(id<MTLBuffer> buffer, bool writable)
+{
+    if (@available(macOS 13.0, iOS 16.0, *))
+        return WriteResource(buffer, buffer.gpuAddress, writable);
+    return LLGL_INVALID_SLOT;
+}
+
+std::uint32_t MTBindlessResourceTable::WriteTexture(id<MTLTexture> texture, bool writable)
+{
+    if (@available(macOS 13.0, iOS 16.0, *))
+    {
+        const MTLResourceID resourceID = texture.gpuResourceID;
+        std::uint64_t entry = 0;
+        ::memcpy(&entry, &resourceID, sizeof(entry));
+        return WriteResource(texture, entry, writable);
+    }
+    return LLGL_INVALID_SLOT;
+}
+
+std::uint32_t MTBindlessResourceTable::WriteSampler(id<MTLSamplerState> samplerState)
+{
+    if (@available(macOS 13.0, iOS 16.0, *))
+    {
+        const std::uint32_t index = AllocIndex(samplerAllocator_);
+        if (index != LLGL_INVALID_SLOT)
+        {
+            const MTLResourceID resourceID = samplerState.gpuResourceID;
+            std::uint64_t entry = 0;
+            ::memcpy(&entry, &resourceID, sizeof(entry));
+            WriteEntry(resourceAllocator_.capacity + index, entry);
+        }
+        return index;
+    }
+    return LLGL_INVALID_SLOT;
+}
+
+void MTBindlessResourceTable::FreeResource(std::uint32_t index)
+{
+    LLGL_ASSERT(index < resourceAllocator_.next);
+
+    /* Remove resource from its residency list by swapping it with the last entry */
+    ResidencyEntry& residency = residencyEntries_[index];
+    ResidencyList& list = residencyLists_[residency.list];
+
+    const std::uint32_t lastPosition = static_cast<std::uint32_t>(list.resources.size() - 1);
+    if (residency.position != lastPosition)
+    {
+        const std::uint32_t movedIndex = list.indices[lastPosition];
+        list.resources[residency.position]  = list.resources[lastPosition];
+        list.indices[residency.position]    = movedIndex;
+        residencyEntries_[movedIndex].position = residency.position;
+    }
+    list.resources.pop_back();
+    list.indices.pop_back();
+    residency = ResidencyEntry{};
+
+    WriteEntry(index, 0);
+    resourceAllocator_.freeIndices.push_back(index);
+}
+
+void MTBindlessResourceTable::FreeSampler(std::uint32_t index)
+{
+    LLGL_ASSERT(index < samplerAllocator_.next);
+    WriteEntry(resourceAllocator_.capacity + index, 0);
+    samplerAllocator_.freeIndices.push_back(index);
+}
+
+void MTBindlessResourceTable::BindToRenderEncoder(id<MTLRenderCommandEncoder> renderEncoder) const
+{
+    [renderEncoder setVertexBuffer:tableBuffer_ offset:0 atIndex:slot_];
+    [renderEncoder setVertexBuffer:tableBuffer_ offset:samplerTableOffset_ atIndex:slot_ + 1];
+    [renderEncoder setFragmentBuffer:tableBuffer_ offset:0 atIndex:slot_];
+    [renderEncoder setFragmentBuffer:tableBuffer_ offset:samplerTableOffset_ atIndex:slot_ + 1];
+
+    /* Resources that are only referenced by the table must be made resident explicitly */
+    if (!residencyLists_[0].resources.empty())
+        [renderEncoder useResources:residencyLists_[0].resources.data() count:residencyLists_[0].resources.size() usage:MTLResourceUsageRead];
+    if (!residencyLists_[1].resources.empty())
+        [renderEncoder useResources:residencyLists_[1].resources.data() count:residencyLists_[1].resources.size() usage:(MTLResourceUsageRead | MTLResourceUsageWrite)];
+}
+
+void MTBindlessResourceTable::BindToComputeEncoder(id<MTLComputeCommandEncoder> computeEncoder) const
+{
+    [computeEncoder setBuffer:tableBuffer_ offset:0 atIndex:slot_];
+    [computeEncoder setBuffer:tableBuffer_ offset:samplerTableOffset_ atIndex:slot_ + 1];
+
+    /* Resources that are only referenced by the table must be made resident explicitly */
+    if (!residencyLists_[0].resources.empty())
+        [computeEncoder useResources:residencyLists_[0].resources.data() count:residencyLists_[0].resources.size() usage:MTLResourceUsageRead];
+    if (!residencyLists_[1].resources.empty())
+        [computeEncoder useResources:residencyLists_[1].resources.data() count:residencyLists_[1].resources.size() usage:(MTLResourceUsageRead | MTLResourceUsageWrite)];
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+std::uint32_t MTBindlessResourceTable::AllocIndex(IndexAllocator& allocator)
+{
+    /* Reuse previously freed index first */
+    if (!allocator.freeIndices.empty())
+    {
+        const std::uint32_t index = allocator.freeIndices.back();
+        allocator.freeIndices.pop_back();
+        return index;
+    }
+
+    if (allocator.next < allocator.capacity)
+        return allocator.next++;
+
+    return LLGL_INVALID_SLOT;
+}
+
+std::uint32_t MTBindlessResourceTable::WriteResource(id<MTLResource> resource, std::uint64_t entry, bool writable)
+{
+    const std::uint32_t index = AllocIndex(resourceAllocator_);
+    if (index != LLGL_INVALID_SLOT)
+    {
+        /* Append resource to the residency list of its usage */
+        ResidencyList& list = residencyLists_[writable ? 1 : 0];
+
+        ResidencyEntry& residency = residencyEntries_[index];
+        residency.list      = (writable ? 1 : 0);
+        residency.position  = static_cast<std::uint32_t>(list.resources.size());
+
+        list.resources.push_back(resource);
+        list.indices.push_back(index);
+
+        WriteEntry(index, entry);
+    }
+    return index;
+}
+
+void MTBindlessResourceTable::WriteEntry(std::uint32_t index, std::uint64_t entry)
+{
+    auto* entries = reinterpret_cast<std::uint64_t*>([tableBuffer_ contents]);
+    entries[index] = entry;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
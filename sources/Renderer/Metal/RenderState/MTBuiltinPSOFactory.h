@@ -10,6 +10,7 @@
 
 
 #import <Metal/Metal.h>
+#include <LLGL/ShaderFlags.h>
 
 
 namespace LLGL
@@ -20,6 +21,7 @@ namespace LLGL
 enum class MTBuiltinComputePSO
 {
     FillBufferByte4 = 0,
+    BlitTexture2D,      // Compiled at runtime on first use (see CompileRuntimeComputePSO)
     Num
 };
 
@@ -38,6 +40,9 @@ class MTBuiltinPSOFactory
         // Loads all builtin shaders and creates the respective pipeline state objects (PSO).
         void CreateBuiltinPSOs(id<MTLDevice> device);
 
+        // Compiles the specified builtin compute PSO from source if it has not been compiled yet and returns true on success.
+        bool CompileRuntimeComputePSO(const MTBuiltinComputePSO builtin);
+
         // Returns the specified builtin compute PSO.
         id<MTLComputePipelineState> GetComputePSO(const MTBuiltinComputePSO builtin) const;
 
@@ -49,14 +54,16 @@ class MTBuiltinPSOFactory
             id<MTLDevice>               device,
             const MTBuiltinComputePSO   builtin,
             const char*                 kernelFunc,
-            std::size_t                 kernelFuncSize
+            std::size_t                 kernelFuncSize,
+            const ShaderSourceType      kernelFuncType = ShaderSourceType::BinaryBuffer
         );
 
     private:
 
         static const std::size_t g_numComputePSOs = static_cast<std::size_t>(MTBuiltinComputePSO::Num);
 
-        id<MTLComputePipelineState> builtinComputePSOs_[g_numComputePSOs];
+        id<MTLDevice>               device_                                 = nil;
+        id<MTLComputePipelineState> builtinComputePSOs_[g_numComputePSOs]   = {};
 
 };
 
@@ -25,9 +25,28 @@ MTBuiltinPSOFactory& MTBuiltinPSOFactory::Get()
 
 void MTBuiltinPSOFactory::CreateBuiltinPSOs(id<MTLDevice> device)
 {
+    device_ = device;
     LoadBuiltinComputePSO(device, MTBuiltinComputePSO::FillBufferByte4, g_metalLibFillBufferByte4, g_metalLibFillBufferByte4Len);
 }
 
+bool MTBuiltinPSOFactory::CompileRuntimeComputePSO(const MTBuiltinComputePSO builtin)
+{
+    const auto idx = static_cast<std::size_t>(builtin);
+    if (builtinComputePSOs_[idx] != nil)
+        return true;
+
+    switch (builtin)
+    {
+        case MTBuiltinComputePSO::BlitTexture2D:
+            LoadBuiltinComputePSO(device_, builtin, g_metalSrcBlitTexture2D, 0, ShaderSourceType::CodeString);
+            break;
+        default:
+            break;
+    }
+
+    return (builtinComputePSOs_[idx] != nil);
+}
+
 id<MTLComputePipelineState> MTBuiltinPSOFactory::GetComputePSO(const MTBuiltinComputePSO builtin) const
 {
     const auto idx = static_cast<std::size_t>(builtin);
@@ -46,7 +65,8 @@ void MTBuiltinPSOFactory::LoadBuiltinComputePSO(
     id<MTLDevice>               device,
     const MTBuiltinComputePSO   builtin,
     const char*                 kernelFunc,
-    std::size_t                 kernelFuncSize)
+    std::size_t                 kernelFuncSize,
+    const ShaderSourceType      kernelFuncType)
 {
     /* Load compute shader function */
     ShaderDescriptor shaderDesc;
@@ -54,7 +74,7 @@ void MTBuiltinPSOFactory::LoadBuiltinComputePSO(
         shaderDesc.type         = ShaderType::Compute;
         shaderDesc.source       = kernelFunc;
         shaderDesc.sourceSize   = kernelFuncSize;
-        shaderDesc.sourceType   = ShaderSourceType::BinaryBuffer;
+        shaderDesc.sourceType   = kernelFuncType;
         shaderDesc.entryPoint   = "CS";
         shaderDesc.profile      = "1.1";
     }
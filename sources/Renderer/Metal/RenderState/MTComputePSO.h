@@ -18,13 +18,15 @@ namespace LLGL
 
 struct ComputePipelineDescriptor;
 class MTShader;
+class MTPipelineCache;
+class PipelineCache;
 
 class MTComputePSO final : public MTPipelineState
 {
 
     public:
 
-        MTComputePSO(id<MTLDevice> device, const ComputePipelineDescriptor& desc);
+        MTComputePSO(id<MTLDevice> device, const ComputePipelineDescriptor& desc, PipelineCache* pipelineCache = nullptr);
 
         // Binds the compute pipeline state with the specified command encoder.
         void Bind(id<MTLComputeCommandEncoder> computeEncoder);
@@ -38,11 +40,19 @@ class MTComputePSO final : public MTPipelineState
     private:
 
         id<MTLComputePipelineState> CreateNativeComputePipelineState(
-            id<MTLDevice>   device,
-            id<MTLFunction> function,
-            NSError*&       error
+            id<MTLDevice>       device,
+            id<MTLFunction>     function,
+            MTPipelineCache*    pipelineCache,
+            NSError*&           error
         );
 
+        id<MTLComputePipelineState> CreateNativeComputePipelineStateWithArchive(
+            id<MTLDevice>       device,
+            id<MTLFunction>     function,
+            MTPipelineCache*    pipelineCache,
+            NSError*&           error
+        ) API_AVAILABLE(macos(11.0), ios(14.0));
+
     private:
 
         id<MTLComputePipelineState> computePipelineState_   = nil;
@@ -7,6 +7,7 @@
 
 #include "MTComputePSO.h"
 #include "MTPipelineLayout.h"
+#include "MTPipelineCache.h"
 #include "../MTCore.h"
 #include "../Shader/MTShader.h"
 #include "../../CheckedCast.h"
@@ -19,7 +20,7 @@ namespace LLGL
 {
 
 
-MTComputePSO::MTComputePSO(id<MTLDevice> device, const ComputePipelineDescriptor& desc) :
+MTComputePSO::MTComputePSO(id<MTLDevice> device, const ComputePipelineDescriptor& desc, PipelineCache* pipelineCache) :
     MTPipelineState { /*isGraphicsPSO:*/ false, desc.pipelineLayout }
 {
     /* Get native shader functions */
@@ -33,7 +34,7 @@ MTComputePSO::MTComputePSO(id<MTLDevice> device, const ComputePipelineDescriptor
 
     /* Create native compute pipeline state */
     NSError* error = nullptr;
-    computePipelineState_ = CreateNativeComputePipelineState(device, kernelFunc, error);
+    computePipelineState_ = CreateNativeComputePipelineState(device, kernelFunc, LLGL_CAST(MTPipelineCache*, pipelineCache), error);
     if (!computePipelineState_)
         MTThrowIfCreateFailed(error, "MTLComputePipelineState");
 }
@@ -52,10 +53,17 @@ void MTComputePSO::Bind(id<MTLComputeCommandEncoder> computeEncoder)
  */
 
 id<MTLComputePipelineState> MTComputePSO::CreateNativeComputePipelineState(
-    id<MTLDevice>   device,
-    id<MTLFunction> function,
-    NSError*&       error)
+    id<MTLDevice>       device,
+    id<MTLFunction>     function,
+    MTPipelineCache*    pipelineCache,
+    NSError*&           error)
 {
+    if (pipelineCache != nullptr)
+    {
+        if (@available(macOS 11.0, iOS 14.0, *))
+            return CreateNativeComputePipelineStateWithArchive(device, function, pipelineCache, error);
+    }
+
     if (NeedsConstantsCache())
     {
         /* Create PSO with reflection to generate constants cache */
@@ -73,6 +81,49 @@ id<MTLComputePipelineState> MTComputePSO::CreateNativeComputePipelineState(
         return [device newComputePipelineStateWithFunction:function error:&error];
 }
 
+id<MTLComputePipelineState> MTComputePSO::CreateNativeComputePipelineStateWithArchive(
+    id<MTLDevice>       device,
+    id<MTLFunction>     function,
+    MTPipelineCache*    pipelineCache,
+    NSError*&           error)
+{
+    /* Binary archives can only be used with a compute pipeline descriptor */
+    MTLComputePipelineDescriptor* psoDesc = [[MTLComputePipelineDescriptor alloc] init];
+    {
+        psoDesc.computeFunction = function;
+        psoDesc.binaryArchives  = @[ pipelineCache->GetNative() ];
+    }
+
+    id<MTLComputePipelineState> pso = nil;
+    if (NeedsConstantsCache())
+    {
+        /* Create PSO with reflection to generate constants cache */
+        MTLAutoreleasedComputePipelineReflection reflection = nil;
+        pso = [device
+            newComputePipelineStateWithDescriptor:  psoDesc
+            options:                                (MTLPipelineOptionArgumentInfo | MTLPipelineOptionBufferTypeInfo)
+            reflection:                             &reflection
+            error:                                  &error
+        ];
+        CreateConstantsCacheForComputePipeline(reflection);
+    }
+    else
+    {
+        pso = [device
+            newComputePipelineStateWithDescriptor:  psoDesc
+            options:                                MTLPipelineOptionNone
+            reflection:                             nil
+            error:                                  &error
+        ];
+    }
+
+    /* Store GPU binaries of this PSO in the pipeline cache, so they can be serialized with PipelineCache::GetBlob() */
+    if (pso != nil)
+        pipelineCache->AddComputePipelineFunctions(psoDesc);
+
+    [psoDesc release];
+    return pso;
+}
 
 } // /namespace LLGL
 
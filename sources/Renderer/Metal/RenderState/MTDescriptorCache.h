@@ -47,6 +47,9 @@ class MTDescriptorCache
         // Sets the specified resource in this cache.
         void SetResource(std::uint32_t descriptor, Resource& resource);
 
+        // Sets the specified range of resources in this cache. Null pointers leave the respective descriptor unchanged.
+        void SetResources(std::uint32_t firstDescriptor, const ArrayView<Resource*>& resources);
+
         // Flushes the pending descriptors to the specified command encoder.
         void FlushGraphicsResources(id<MTLRenderCommandEncoder> renderEncoder);
         void FlushGraphicsResourcesForced(id<MTLRenderCommandEncoder> renderEncoder);
@@ -72,6 +75,9 @@ class MTDescriptorCache
         void BindGraphicsResource(id<MTLRenderCommandEncoder> renderEncoder, const MTDynamicResourceLayout& layout, id resource);
         void BindComputeResource(id<MTLComputeCommandEncoder> computeEncoder, const MTDynamicResourceLayout& layout, id resource);
 
+        // Stores the native handle of the specified resource in the bindings. Returns false if the resource does not match the layout.
+        bool EmplaceBinding(std::uint32_t descriptor, Resource& resource);
+
         // Marks the specified binding as invalidated.
         void InvalidateBinding(std::uint8_t index);
 
@@ -71,40 +71,22 @@ void MTDescriptorCache::SetResource(std::uint32_t descriptor, Resource& resource
     if (descriptor >= layouts_.size())
         return /*Out of range*/;
 
-    const MTDynamicResourceLayout& layout = layouts_[descriptor];
-    if (layout.type != resource.GetResourceType())
-        return /*Type mismatch*/;
+    if (EmplaceBinding(descriptor, resource))
+        InvalidateBinding(static_cast<std::uint8_t>(descriptor));
+}
 
-    LLGL_ASSERT(bindings_.size() >= layouts_.size());
+void MTDescriptorCache::SetResources(std::uint32_t firstDescriptor, const ArrayView<Resource*>& resources)
+{
+    if (firstDescriptor >= layouts_.size())
+        return /*Out of range*/;
 
-    switch (layout.type)
+    const std::uint32_t numDescriptors = std::min<std::uint32_t>(static_cast<std::uint32_t>(resources.size()), layouts_.size() - firstDescriptor);
+    for_range(i, numDescriptors)
     {
-        case ResourceType::Undefined:
-        break;
-
-        case ResourceType::Buffer:
-        {
-            auto& bufferMT = LLGL_CAST(MTBuffer&, resource);
-            bindings_[descriptor] = bufferMT.GetNative();
-        }
-        break;
-
-        case ResourceType::Texture:
-        {
-            auto& textureMT = LLGL_CAST(MTTexture&, resource);
-            bindings_[descriptor] = textureMT.GetNative();
-        }
-        break;
-
-        case ResourceType::Sampler:
-        {
-            auto& samplerMT = LLGL_CAST(MTSampler&, resource);
-            bindings_[descriptor] = samplerMT.GetNative();
-        }
-        break;
+        const std::uint32_t descriptor = firstDescriptor + i;
+        if (resources[i] != nullptr && EmplaceBinding(descriptor, *resources[i]))
+            InvalidateBinding(static_cast<std::uint8_t>(descriptor));
     }
-
-    InvalidateBinding(static_cast<std::uint8_t>(descriptor));
 }
 
 void MTDescriptorCache::FlushGraphicsResources(id<MTLRenderCommandEncoder> renderEncoder)
@@ -272,6 +254,44 @@ void MTDescriptorCache::BindComputeResource(id<MTLComputeCommandEncoder> compute
     }
 }
 
+bool MTDescriptorCache::EmplaceBinding(std::uint32_t descriptor, Resource& resource)
+{
+    const MTDynamicResourceLayout& layout = layouts_[descriptor];
+    if (layout.type != resource.GetResourceType())
+        return false /*Type mismatch*/;
+
+    LLGL_ASSERT(bindings_.size() >= layouts_.size());
+
+    switch (layout.type)
+    {
+        case ResourceType::Undefined:
+        return false;
+
+        case ResourceType::Buffer:
+        {
+            auto& bufferMT = LLGL_CAST(MTBuffer&, resource);
+            bindings_[descriptor] = bufferMT.GetNative();
+        }
+        break;
+
+        case ResourceType::Texture:
+        {
+            auto& textureMT = LLGL_CAST(MTTexture&, resource);
+            bindings_[descriptor] = textureMT.GetNative();
+        }
+        break;
+
+        case ResourceType::Sampler:
+        {
+            auto& samplerMT = LLGL_CAST(MTSampler&, resource);
+            bindings_[descriptor] = samplerMT.GetNative();
+        }
+        break;
+    }
+
+    return true;
+}
+
 void MTDescriptorCache::InvalidateBinding(std::uint8_t index)
 {
     dirtyBindings_[index / 64] |= (1u << (index % 64));
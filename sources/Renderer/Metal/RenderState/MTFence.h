@@ -1,6 +1,6 @@
 /*
  * MTFence.h
- * 
+ *
  * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
  * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
  */
@@ -12,29 +12,47 @@
 #import <Metal/Metal.h>
 
 #include <LLGL/Fence.h>
+#include <atomic>
+#include <cstdint>
 
 
 namespace LLGL
 {
 
 
-//TODO: currently unused
+/*
+Fence implementation with MTLSharedEvent. Requires macOS 10.14 or iOS 12.0.
+On older systems, the completed value is updated by the completion handler of the command buffer that signals the fence.
+*/
 class MTFence final : public Fence
 {
 
+    public:
+
+        std::uint64_t GetCompletedValue() override;
+
     public:
 
         MTFence(id<MTLDevice> device);
         ~MTFence();
 
-        inline id<MTLFence> GetNative() const
+        // Encodes a signal operation for the specified value into the command buffer. Must be called before the command buffer is committed.
+        void Signal(id<MTLCommandBuffer> cmdBuffer, std::uint64_t value);
+
+        // Blocks the CPU until the specified value has been completed. Returns false on timeout (in nanoseconds).
+        bool WaitValue(std::uint64_t value, std::uint64_t timeout);
+
+        // Returns the highest value this fence has been signaled with.
+        inline std::uint64_t GetSignaledValue() const
         {
-            return native_;
+            return signaledValue_;
         }
 
     private:
 
-        id<MTLFence> native_ = nil;
+        id                          native_         = nil; // id<MTLSharedEvent>
+        std::uint64_t               signaledValue_  = 0;
+        std::atomic<std::uint64_t>  completedValue_;       // Only used if MTLSharedEvent is not available.
 
 };
 
@@ -1,11 +1,14 @@
 /*
  * MTFence.mm
- * 
+ *
  * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
  * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
  */
 
 #include "MTFence.h"
+#include <algorithm>
+#include <thread>
+#include <chrono>
 
 
 namespace LLGL
@@ -13,8 +16,10 @@ namespace LLGL
 
 
 MTFence::MTFence(id<MTLDevice> device) :
-    native_ { [device newFence] }
+    completedValue_ { 0 }
 {
+    if (@available(macOS 10.14, iOS 12.0, *))
+        native_ = [device newSharedEvent];
 }
 
 MTFence::~MTFence()
@@ -22,6 +27,52 @@ MTFence::~MTFence()
     [native_ release];
 }
 
+std::uint64_t MTFence::GetCompletedValue()
+{
+    if (@available(macOS 10.14, iOS 12.0, *))
+    {
+        if (native_ != nil)
+            return [(id<MTLSharedEvent>)native_ signaledValue];
+    }
+    return completedValue_;
+}
+
+void MTFence::Signal(id<MTLCommandBuffer> cmdBuffer, std::uint64_t value)
+{
+    signaledValue_ = std::max(signaledValue_, value);
+
+    if (@available(macOS 10.14, iOS 12.0, *))
+    {
+        if (native_ != nil)
+        {
+            [cmdBuffer encodeSignalEvent:(id<MTLSharedEvent>)native_ value:value];
+            return;
+        }
+    }
+
+    /* Command buffers complete in submission order, so the completion handler can store the value directly */
+    std::atomic<std::uint64_t>* completedValue = &completedValue_;
+    [cmdBuffer addCompletedHandler:^(id<MTLCommandBuffer>)
+        {
+            completedValue->store(value);
+        }
+    ];
+}
+
+bool MTFence::WaitValue(std::uint64_t value, std::uint64_t timeout)
+{
+    /* Poll completed value, since MTLSharedEvent only provides a blocking wait with macOS 12.0 and iOS 15.0 */
+    const auto startTime = std::chrono::steady_clock::now();
+    while (GetCompletedValue() < value)
+    {
+        const auto elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime);
+        if (static_cast<std::uint64_t>(elapsedTime.count()) >= timeout)
+            return false;
+        std::this_thread::yield();
+    }
+    return true;
+}
+
 
 } // /namespace LLGL
 
@@ -19,6 +19,8 @@ namespace LLGL
 
 
 class MTRenderPass;
+class MTPipelineCache;
+class PipelineCache;
 class ByteBufferIterator;
 struct GraphicsPipelineDescriptor;
 
@@ -30,7 +32,9 @@ class MTGraphicsPSO final : public MTPipelineState
         MTGraphicsPSO(
             id<MTLDevice>                       device,
             const GraphicsPipelineDescriptor&   desc,
-            const MTRenderPass*                 defaultRenderPass
+            const MTRenderPass*                 defaultRenderPass,
+            bool                                supportIndirectCommandBuffers   = false,
+            PipelineCache*                      pipelineCache                   = nullptr
         );
 
         // Binds the render pipeline state, depth-stencil states, and sets the remaining parameters with the specified command encoder.
@@ -71,6 +75,24 @@ class MTGraphicsPSO final : public MTPipelineState
             return tessPipelineState_;
         }
 
+        // Returns true if this PSO was created with object and mesh functions instead of a vertex function.
+        inline bool IsMeshPipeline() const
+        {
+            return meshPipeline_;
+        }
+
+        // Returns the number of threads per object thread-group for mesh pipelines.
+        inline const MTLSize& GetThreadsPerObjectThreadgroup() const
+        {
+            return threadsPerObjectThreadgroup_;
+        }
+
+        // Returns the number of threads per mesh thread-group for mesh pipelines.
+        inline const MTLSize& GetThreadsPerMeshThreadgroup() const
+        {
+            return threadsPerMeshThreadgroup_;
+        }
+
         // Returns true if the scissor test is enabled for this PSO.
         inline bool HasScissorTest() const
         {
@@ -92,6 +114,14 @@ class MTGraphicsPSO final : public MTPipelineState
     private:
 
         void CreateRenderPipelineState(
+            id<MTLDevice>                       device,
+            const GraphicsPipelineDescriptor&   desc,
+            const MTRenderPass*                 defaultRenderPass,
+            bool                                supportIndirectCommandBuffers,
+            MTPipelineCache*                    pipelineCache
+        );
+
+        void CreateMeshRenderPipelineState(
             id<MTLDevice>                       device,
             const GraphicsPipelineDescriptor&   desc,
             const MTRenderPass*                 defaultRenderPass
@@ -126,6 +156,10 @@ class MTGraphicsPSO final : public MTPipelineState
         NSUInteger                  numPatchControlPoints_  = 0;
         MTLPatchType                patchType_              = MTLPatchTypeNone;
 
+        bool                        meshPipeline_                   = false;
+        MTLSize                     threadsPerObjectThreadgroup_    = {};
+        MTLSize                     threadsPerMeshThreadgroup_      = {};
+
         float                       depthBias_              = 0.0f;
         float                       depthSlope_             = 0.0f;
         float                       depthClamp_             = 0.0f;
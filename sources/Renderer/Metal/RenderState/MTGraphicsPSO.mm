@@ -8,6 +8,7 @@
 #include "MTGraphicsPSO.h"
 #include "MTRenderPass.h"
 #include "MTPipelineLayout.h"
+#include "MTPipelineCache.h"
 #include "../Shader/MTShader.h"
 //#include "../Command/MTCommandContext.h"
 #include "../MTTypes.h"
@@ -49,7 +50,9 @@ static void FillDefaultMTStencilDesc(MTLStencilDescriptor* dst)
 MTGraphicsPSO::MTGraphicsPSO(
     id<MTLDevice>                       device,
     const GraphicsPipelineDescriptor&   desc,
-    const MTRenderPass*                 defaultRenderPass)
+    const MTRenderPass*                 defaultRenderPass,
+    bool                                supportIndirectCommandBuffers,
+    PipelineCache*                      pipelineCache)
 :
     MTPipelineState { /*isGraphicsPSO:*/ true, desc.pipelineLayout }
 {
@@ -74,7 +77,7 @@ MTGraphicsPSO::MTGraphicsPSO(
     blendColor_[3]      = desc.blend.blendFactor[3];
 
     /* Create render pipeline and depth-stencil states */
-    CreateRenderPipelineState(device, desc, defaultRenderPass);
+    CreateRenderPipelineState(device, desc, defaultRenderPass, supportIndirectCommandBuffers, LLGL_CAST(MTPipelineCache*, pipelineCache));
     CreateDepthStencilState(device, desc);
     BuildStaticStateBuffer(desc);
 }
@@ -202,11 +205,29 @@ static const MTShader* GetVertexOrPostTessVertexShader(const GraphicsPipelineDes
     return vertexShaderMT;
 }
 
+static const MTRenderPass* GetRenderPassOrDefault(const GraphicsPipelineDescriptor& desc, const MTRenderPass* defaultRenderPass)
+{
+    if (const RenderPass* renderPass = desc.renderPass)
+        return LLGL_CAST(const MTRenderPass*, renderPass);
+    if (defaultRenderPass != nullptr)
+        return defaultRenderPass;
+    throw std::invalid_argument("cannot create graphics pipeline without render pass");
+}
+
 void MTGraphicsPSO::CreateRenderPipelineState(
     id<MTLDevice>                       device,
     const GraphicsPipelineDescriptor&   desc,
-    const MTRenderPass*                 defaultRenderPass)
+    const MTRenderPass*                 defaultRenderPass,
+    bool                                supportIndirectCommandBuffers,
+    MTPipelineCache*                    pipelineCache)
 {
+    /* Mesh pipelines replace the vertex stage by object and mesh functions */
+    if (desc.meshShader != nullptr)
+    {
+        CreateMeshRenderPipelineState(device, desc, defaultRenderPass);
+        return;
+    }
+
     /* Get native shader functions */
     const MTShader* vertexShaderMT = GetVertexOrPostTessVertexShader(desc);
 
@@ -217,13 +238,7 @@ void MTGraphicsPSO::CreateRenderPipelineState(
         patchType_ = [vertexFunc patchType];
 
     /* Get render pass object */
-    const MTRenderPass* renderPassMT = nullptr;
-    if (const RenderPass* renderPass = desc.renderPass)
-        renderPassMT = LLGL_CAST(const MTRenderPass*, renderPass);
-    else if (defaultRenderPass != nullptr)
-        renderPassMT = defaultRenderPass;
-    else
-        throw std::invalid_argument("cannot create graphics pipeline without render pass");
+    const MTRenderPass* renderPassMT = GetRenderPassOrDefault(desc, defaultRenderPass);
 
     /* Create render pipeline state */
     MTLRenderPipelineDescriptor* psoDesc = [[MTLRenderPipelineDescriptor alloc] init];
@@ -269,11 +284,31 @@ void MTGraphicsPSO::CreateRenderPipelineState(
             psoDesc.tessellationOutputWindingOrder      = (desc.tessellation.outputWindingCCW ? MTLWindingCounterClockwise : MTLWindingClockwise);
             psoDesc.tessellationPartitionMode           = MTTypes::ToMTLPartitionMode(desc.tessellation.partition);
         }
+        else if (supportIndirectCommandBuffers)
+        {
+            /* Allow draw commands of indirect command buffers to inherit this PSO (see MTMultiSubmitCommandBuffer) */
+            if (@available(macOS 10.14, iOS 12.0, *))
+                psoDesc.supportIndirectCommandBuffers = YES;
+        }
+
+        /* Look up precompiled GPU binaries in the binary archive of the pipeline cache */
+        if (pipelineCache != nullptr)
+        {
+            if (@available(macOS 11.0, iOS 14.0, *))
+                psoDesc.binaryArchives = @[ pipelineCache->GetNative() ];
+        }
     }
     NSError* error = nullptr;
     renderPipelineState_ = CreateNativeRenderPipelineState(device, psoDesc, error);
     if (!renderPipelineState_)
         MTThrowIfCreateFailed(error, "MTLRenderPipelineState");
+
+    /* Store GPU binaries of this PSO in the pipeline cache, so they can be serialized with PipelineCache::GetBlob() */
+    if (pipelineCache != nullptr)
+    {
+        if (@available(macOS 11.0, iOS 14.0, *))
+            pipelineCache->AddRenderPipelineFunctions(psoDesc);
+    }
     [psoDesc release];
 
     /* Create compute PSO for tessellation stage */
@@ -290,6 +325,82 @@ void MTGraphicsPSO::CreateRenderPipelineState(
     }
 }
 
+void MTGraphicsPSO::CreateMeshRenderPipelineState(
+    id<MTLDevice>                       device,
+    const GraphicsPipelineDescriptor&   desc,
+    const MTRenderPass*                 defaultRenderPass)
+{
+    if (@available(macOS 13.0, iOS 16.0, *))
+    {
+        const MTShader* meshShaderMT = LLGL_CAST(const MTShader*, desc.meshShader);
+        const MTShader* taskShaderMT = LLGL_CAST(const MTShader*, desc.taskShader);
+
+        /* Store thread-group sizes for the draw commands, since Metal does not take them from the functions */
+        meshPipeline_               = true;
+        threadsPerMeshThreadgroup_  = meshShaderMT->GetNumThreadsPerGroup();
+        if (taskShaderMT != nullptr)
+            threadsPerObjectThreadgroup_ = taskShaderMT->GetNumThreadsPerGroup();
+
+        /* Get render pass object */
+        const MTRenderPass* renderPassMT = GetRenderPassOrDefault(desc, defaultRenderPass);
+
+        /* Create mesh render pipeline state */
+        MTLMeshRenderPipelineDescriptor* psoDesc = [[MTLMeshRenderPipelineDescriptor alloc] init];
+        {
+            psoDesc.objectFunction          = GetNativeMTShader(desc.taskShader);
+            psoDesc.meshFunction            = meshShaderMT->GetNative();
+            psoDesc.fragmentFunction        = GetNativeMTShader(desc.fragmentShader);
+            psoDesc.alphaToCoverageEnabled  = MTBoolean(desc.blend.alphaToCoverageEnabled);
+            psoDesc.alphaToOneEnabled       = NO;
+
+            /* Initialize pixel formats from render pass */
+            const MTColorAttachmentFormatVector& colorAttachments = renderPassMT->GetColorAttachments();
+            for_range(i, std::min(colorAttachments.size(), std::size_t(LLGL_MAX_NUM_COLOR_ATTACHMENTS)))
+            {
+                FillColorAttachmentDesc(
+                    psoDesc.colorAttachments[i],
+                    colorAttachments[i].pixelFormat,
+                    desc.blend,
+                    desc.blend.targets[desc.blend.independentBlendEnabled ? i : 0]
+                );
+            };
+
+            psoDesc.depthAttachmentPixelFormat      = renderPassMT->GetDepthAttachment().pixelFormat;
+            psoDesc.stencilAttachmentPixelFormat    = renderPassMT->GetStencilAttachment().pixelFormat;
+            psoDesc.rasterizationEnabled            = (desc.rasterizer.discardEnabled ? NO : YES);
+            psoDesc.rasterSampleCount               = (desc.rasterizer.multiSampleEnabled ? renderPassMT->GetSampleCount() : 1u);
+        }
+        NSError* error = nullptr;
+        if (NeedsConstantsCache())
+        {
+            /* Create PSO with reflection to generate constants cache */
+            MTLAutoreleasedRenderPipelineReflection reflection = nil;
+            renderPipelineState_ = [device
+                newRenderPipelineStateWithMeshDescriptor:   psoDesc
+                options:                                    (MTLPipelineOptionArgumentInfo | MTLPipelineOptionBufferTypeInfo)
+                reflection:                                 &reflection
+                error:                                      &error
+            ];
+            CreateConstantsCacheForRenderPipeline(reflection);
+        }
+        else
+        {
+            renderPipelineState_ = [device
+                newRenderPipelineStateWithMeshDescriptor:   psoDesc
+                options:                                    MTLPipelineOptionNone
+                reflection:                                 nil
+                error:                                      &error
+            ];
+        }
+        [psoDesc release];
+
+        if (!renderPipelineState_)
+            MTThrowIfCreateFailed(error, "MTLRenderPipelineState");
+    }
+    else
+        throw std::runtime_error("cannot create Metal mesh pipeline without Metal 3 support");
+}
+
 id<MTLRenderPipelineState> MTGraphicsPSO::CreateNativeRenderPipelineState(
     id<MTLDevice>                   device,
     MTLRenderPipelineDescriptor*    desc,
@@ -0,0 +1,65 @@
+/*
+ * MTPipelineCache.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_MT_PIPELINE_CACHE_H
+#define LLGL_MT_PIPELINE_CACHE_H
+
+
+#import <Metal/Metal.h>
+
+#include <LLGL/PipelineCache.h>
+
+
+namespace LLGL
+{
+
+
+/*
+Pipeline cache implementation with MTLBinaryArchive. Requires macOS 11.0 or iOS 14.0.
+Binary archives can only be loaded from and serialized to files,
+so the blob is written to a temporary file that is kept until the cache is released.
+*/
+class MTPipelineCache final : public PipelineCache
+{
+
+    public:
+
+        MTPipelineCache(id<MTLDevice> device, const Blob& initialBlob);
+        ~MTPipelineCache();
+
+        Blob GetBlob() const override;
+
+    public:
+
+        // Adds the GPU binaries of all functions of the specified render pipeline to this archive.
+        void AddRenderPipelineFunctions(MTLRenderPipelineDescriptor* desc) API_AVAILABLE(macos(11.0), ios(14.0));
+
+        // Adds the GPU binaries of the kernel function of the specified compute pipeline to this archive.
+        void AddComputePipelineFunctions(MTLComputePipelineDescriptor* desc) API_AVAILABLE(macos(11.0), ios(14.0));
+
+        // Returns the native MTLBinaryArchive object.
+        inline id<MTLBinaryArchive> GetNative() const API_AVAILABLE(macos(11.0), ios(14.0))
+        {
+            return (id<MTLBinaryArchive>)native_;
+        }
+
+    private:
+
+        id          native_         = nil; // id<MTLBinaryArchive>
+        NSURL*      initialBlobURL_ = nil; // Temporary file the archive was loaded from
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,103 @@
+/*
+ * MTPipelineCache.mm
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "MTPipelineCache.h"
+#include "../MTCore.h"
+
+
+namespace LLGL
+{
+
+
+// Returns a new URL for a temporary binary archive file.
+static NSURL* MakeTemporaryArchiveURL()
+{
+    NSString* filename = [[[NSUUID UUID] UUIDString] stringByAppendingPathExtension:@"metallib"];
+    NSString* path = [NSTemporaryDirectory() stringByAppendingPathComponent:filename];
+    return [NSURL fileURLWithPath:path];
+}
+
+static void RemoveTemporaryArchiveFile(NSURL* url)
+{
+    if (url != nil)
+        [[NSFileManager defaultManager] removeItemAtURL:url error:nil];
+}
+
+MTPipelineCache::MTPipelineCache(id<MTLDevice> device, const Blob& initialBlob)
+{
+    if (@available(macOS 11.0, iOS 14.0, *))
+    {
+        MTLBinaryArchiveDescriptor* archiveDesc = [[MTLBinaryArchiveDescriptor alloc] init];
+
+        /* Write initial blob to a temporary file, since binary archives can only be loaded from a URL */
+        if (initialBlob.GetData() != nullptr && initialBlob.GetSize() > 0)
+        {
+            NSData* data = [NSData dataWithBytesNoCopy:const_cast<void*>(initialBlob.GetData()) length:initialBlob.GetSize() freeWhenDone:NO];
+            initialBlobURL_ = [MakeTemporaryArchiveURL() retain];
+            if ([data writeToURL:initialBlobURL_ atomically:NO])
+                archiveDesc.url = initialBlobURL_;
+        }
+
+        NSError* error = nullptr;
+        native_ = [device newBinaryArchiveWithDescriptor:archiveDesc error:&error];
+
+        /* Start with an empty archive if the initial blob is invalid, e.g. because it was created for a different device or OS version */
+        if (native_ == nil && archiveDesc.url != nil)
+        {
+            archiveDesc.url = nil;
+            native_ = [device newBinaryArchiveWithDescriptor:archiveDesc error:&error];
+        }
+
+        [archiveDesc release];
+
+        if (native_ == nil)
+            MTThrowIfCreateFailed(error, "MTLBinaryArchive");
+    }
+}
+
+MTPipelineCache::~MTPipelineCache()
+{
+    [native_ release];
+    RemoveTemporaryArchiveFile(initialBlobURL_);
+    [initialBlobURL_ release];
+}
+
+Blob MTPipelineCache::GetBlob() const
+{
+    if (@available(macOS 11.0, iOS 14.0, *))
+    {
+        /* Serialize archive into a temporary file and read it back into a blob */
+        NSURL* url = MakeTemporaryArchiveURL();
+        NSError* error = nullptr;
+        if ([GetNative() serializeToURL:url error:&error])
+        {
+            NSData* data = [NSData dataWithContentsOfURL:url];
+            RemoveTemporaryArchiveFile(url);
+            if (data != nil)
+                return Blob::CreateCopy([data bytes], static_cast<std::size_t>([data length]));
+        }
+    }
+    return {};
+}
+
+void MTPipelineCache::AddRenderPipelineFunctions(MTLRenderPipelineDescriptor* desc)
+{
+    /* Failures only mean the pipeline is not cached, so errors are ignored here */
+    [GetNative() addRenderPipelineFunctionsWithDescriptor:desc error:nil];
+}
+
+void MTPipelineCache::AddComputePipelineFunctions(MTLComputePipelineDescriptor* desc)
+{
+    [GetNative() addComputePipelineFunctionsWithDescriptor:desc error:nil];
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -123,6 +123,17 @@ static MTLPixelFormat GetColorMTLPixelFormat(int /*colorBits*/)
     return MTLPixelFormatBGRA8Unorm;
 }
 
+static MTLPixelFormat GetSwapChainColorMTLPixelFormat(const SwapChainDescriptor& desc)
+{
+    /* Wide-gamut color spaces determine the back buffer format regardless of the requested color bits */
+    switch (desc.colorSpace)
+    {
+        case ColorSpace::ExtendedSRGB:  return MTLPixelFormatRGBA16Float;
+        case ColorSpace::HDR10:         return MTLPixelFormatBGR10A2Unorm;
+        default:                        return GetColorMTLPixelFormat(desc.colorBits);
+    }
+}
+
 static MTLPixelFormat GetDepthStencilMTLPixelFormat(int depthBits, int stencilBits, id<MTLDevice> device)
 {
     if (stencilBits == 8)
@@ -148,7 +159,7 @@ static MTLPixelFormat GetDepthStencilMTLPixelFormat(int depthBits, int stencilBi
 MTRenderPass::MTRenderPass(id<MTLDevice> device, const SwapChainDescriptor& desc) :
     sampleCount_ { GetMTRenderPassSampleCount(device, desc.samples) }
 {
-    const MTLPixelFormat colorFormat        = GetColorMTLPixelFormat(desc.colorBits);
+    const MTLPixelFormat colorFormat        = GetSwapChainColorMTLPixelFormat(desc);
     const MTLPixelFormat depthStencilFormat = GetDepthStencilMTLPixelFormat(desc.depthBits, desc.stencilBits, device);
 
     colorAttachments_ = { MakeDefaultMTAttachmentFormat(colorFormat) };
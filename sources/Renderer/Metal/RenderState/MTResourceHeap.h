@@ -30,12 +30,15 @@ enum MTResourceType : std::uint32_t;
 class MTTexture;
 class BindingDescriptorIterator;
 struct MTResourceBinding;
+struct BindingDescriptor;
 struct ResourceHeapDescriptor;
 struct TextureViewDescriptor;
 
 /*
 This class emulates the behavior of a descriptor set like in Vulkan,
 by binding all shader resources within one bind call in the command buffer.
+If argument buffers are enabled (see RendererConfigurationMetal), each descriptor set is encoded into an argument buffer instead,
+so binding a descriptor set only binds that argument buffer and declares the residency of its resources with 'useResources'.
 */
 class MTResourceHeap final : public ResourceHeap
 {
@@ -48,7 +51,9 @@ class MTResourceHeap final : public ResourceHeap
 
         MTResourceHeap(
             const ResourceHeapDescriptor&               desc,
-            const ArrayView<ResourceViewDescriptor>&    initialResourceViews = {}
+            const ArrayView<ResourceViewDescriptor>&    initialResourceViews    = {},
+            id<MTLDevice>                               argumentBufferDevice    = nil,
+            NSUInteger                                  argumentBufferSlot      = 0
         );
         ~MTResourceHeap();
 
@@ -117,6 +122,15 @@ class MTResourceHeap final : public ResourceHeap
             std::size_t index;  // Index to the input bindings list
         };
 
+        // Binding-to-argument map location. The argument index within the argument buffer equals the binding index.
+        struct ArgumentLocation
+        {
+            static constexpr std::uint32_t invalidIndex = 0xFFFFFFFF;
+
+            MTResourceType  type;
+            std::uint32_t   resourceIndex;  // Index into the list of used resources per descriptor set, or invalidIndex for sampler states.
+        };
+
     private:
 
         SegmentationSizeType AllocBufferSegments(BindingDescriptorIterator& bindingIter, long stage);
@@ -147,6 +161,12 @@ class MTResourceHeap final : public ResourceHeap
         const char* BindFragmentResources(id<MTLRenderCommandEncoder> cmdEncoder, const char* heapPtr);
         const char* BindKernelResources(id<MTLComputeCommandEncoder> cmdEncoder, const char* heapPtr);
 
+        void CreateArgumentBuffer(id<MTLDevice> device, const std::vector<BindingDescriptor>& bindings, std::uint32_t numSets);
+        void WriteArgument(const ResourceViewDescriptor& desc, std::uint32_t descriptor);
+
+        void BindGraphicsArgumentBuffer(id<MTLRenderCommandEncoder> renderEncoder, std::uint32_t descriptorSet);
+        void BindComputeArgumentBuffer(id<MTLComputeCommandEncoder> computeEncoder, std::uint32_t descriptorSet);
+
         void WriteResourceViewBuffer(const ResourceViewDescriptor& desc, char* heapPtr, const BindingSegmentLocation::Stage& binding);
         void WriteResourceViewTexture(const ResourceViewDescriptor& desc, char* heapPtr, const BindingSegmentLocation::Stage& binding, std::uint32_t descriptorSet);
         void WriteResourceViewSamplerState(const ResourceViewDescriptor& desc, char* heapPtr, const BindingSegmentLocation::Stage& binding);
@@ -188,6 +208,15 @@ class MTResourceHeap final : public ResourceHeap
         std::vector<id<MTLTexture>>         textureViews_;
         std::uint32_t                       numTextureViewsPerSet_  = 0;
 
+        id<MTLArgumentEncoder>              argumentEncoder_        = nil;  // Only used if argument buffers are enabled.
+        id<MTLBuffer>                       argumentBuffer_         = nil;  // Argument buffer for all descriptor sets.
+        NSUInteger                          argumentBufferStride_   = 0;    // Stride (in bytes) per descriptor set within the argument buffer.
+        NSUInteger                          argumentBufferSlot_     = 0;
+        SmallVector<ArgumentLocation>       argumentMap_;                   // Maps a binding index to its argument type and resource index.
+        std::vector<id<MTLResource>>        usedResources_;                 // Resources per descriptor set; resources with read-only access come first.
+        std::uint32_t                       numUsedResourcesPerSet_ = 0;
+        std::uint32_t                       numReadOnlyResources_   = 0;    // Number of resources with read-only access per descriptor set.
+
 };
 
 
@@ -19,6 +19,7 @@
 #include "../../../Core/Assertion.h"
 #include <LLGL/ResourceHeapFlags.h>
 #include <LLGL/Utils/ForRange.h>
+#include <algorithm>
 
 
 namespace LLGL
@@ -86,7 +87,9 @@ struct MTResourceHeapSegment
 
 MTResourceHeap::MTResourceHeap(
     const ResourceHeapDescriptor&               desc,
-    const ArrayView<ResourceViewDescriptor>&    initialResourceViews)
+    const ArrayView<ResourceViewDescriptor>&    initialResourceViews,
+    id<MTLDevice>                               argumentBufferDevice,
+    NSUInteger                                  argumentBufferSlot)
 {
     /* Get pipeline layout object */
     auto pipelineLayoutMT = LLGL_CAST(MTPipelineLayout*, desc.pipelineLayout);
@@ -136,6 +139,13 @@ MTResourceHeap::MTResourceHeap(
     /* Allocate texture view array */
     textureViews_.resize(numTextureViewsPerSet_ * numSegmentSets);
 
+    /* Create argument buffer for all descriptor sets if enabled */
+    if (argumentBufferDevice != nil)
+    {
+        argumentBufferSlot_ = argumentBufferSlot;
+        CreateArgumentBuffer(argumentBufferDevice, bindings, numSegmentSets);
+    }
+
     /* Write initial resource views */
     if (!initialResourceViews.empty())
         WriteResourceViews(0, initialResourceViews);
@@ -148,6 +158,8 @@ MTResourceHeap::~MTResourceHeap()
         if (tex != nil)
             [tex release];
     }
+    [argumentEncoder_ release];
+    [argumentBuffer_ release];
 }
 
 std::uint32_t MTResourceHeap::GetNumDescriptorSets() const
@@ -180,33 +192,41 @@ std::uint32_t MTResourceHeap::WriteResourceViews(std::uint32_t firstDescriptor,
         if (desc.resource == nullptr)
             continue;
 
-        /* Get binding information and heap start for descriptor set */
-        const auto& binding = bindingMap_[firstDescriptor % numBindings];
-
-        auto descriptorSet  = firstDescriptor / numBindings;
-        auto heapStartPtr   = heap_.SegmentData(descriptorSet);
-
-        /* Write descriptor into respective heap segment for each affected shader stage */
-        for_range(stage, static_cast<int>(MTShaderStage_Count))
+        if (argumentEncoder_ != nil)
+        {
+            /* Encode descriptor into argument buffer of its descriptor set */
+            WriteArgument(desc, firstDescriptor);
+        }
+        else
         {
-            auto offset     = binding.stages[stage].segmentOffset;
-            if (offset == BindingSegmentLocation::invalidOffset)
-                continue;
+            /* Get binding information and heap start for descriptor set */
+            const auto& binding = bindingMap_[firstDescriptor % numBindings];
 
-            auto heapPtr    = heapStartPtr + offset;
-            auto segment    = MTRESOURCEHEAP_CONST_SEGMENT(heapPtr);
+            auto descriptorSet  = firstDescriptor / numBindings;
+            auto heapStartPtr   = heap_.SegmentData(descriptorSet);
 
-            switch (segment->type)
+            /* Write descriptor into respective heap segment for each affected shader stage */
+            for_range(stage, static_cast<int>(MTShaderStage_Count))
             {
-                case MTResourceType_Buffer:
-                    WriteResourceViewBuffer(desc, heapPtr, binding.stages[stage]);
-                    break;
-                case MTResourceType_Texture:
-                    WriteResourceViewTexture(desc, heapPtr, binding.stages[stage], descriptorSet);
-                    break;
-                case MTResourceType_SamplerState:
-                    WriteResourceViewSamplerState(desc, heapPtr, binding.stages[stage]);
-                    break;
+                auto offset     = binding.stages[stage].segmentOffset;
+                if (offset == BindingSegmentLocation::invalidOffset)
+                    continue;
+
+                auto heapPtr    = heapStartPtr + offset;
+                auto segment    = MTRESOURCEHEAP_CONST_SEGMENT(heapPtr);
+
+                switch (segment->type)
+                {
+                    case MTResourceType_Buffer:
+                        WriteResourceViewBuffer(desc, heapPtr, binding.stages[stage]);
+                        break;
+                    case MTResourceType_Texture:
+                        WriteResourceViewTexture(desc, heapPtr, binding.stages[stage], descriptorSet);
+                        break;
+                    case MTResourceType_SamplerState:
+                        WriteResourceViewSamplerState(desc, heapPtr, binding.stages[stage]);
+                        break;
+                }
             }
         }
 
@@ -222,6 +242,12 @@ void MTResourceHeap::BindGraphicsResources(id<MTLRenderCommandEncoder> renderEnc
     if (descriptorSet >= heap_.NumSets())
         return;
 
+    if (argumentEncoder_ != nil)
+    {
+        BindGraphicsArgumentBuffer(renderEncoder, descriptorSet);
+        return;
+    }
+
     const char* heapPtr = heap_.SegmentData(descriptorSet);
     if (segmentation_.hasVertexResources)
         heapPtr = BindVertexResources(renderEncoder, heapPtr);
@@ -234,6 +260,12 @@ void MTResourceHeap::BindComputeResources(id<MTLComputeCommandEncoder> computeEn
     if (descriptorSet >= heap_.NumSets())
         return;
 
+    if (argumentEncoder_ != nil)
+    {
+        BindComputeArgumentBuffer(computeEncoder, descriptorSet);
+        return;
+    }
+
     if (segmentation_.hasKernelResources)
     {
         auto heapPtr = heap_.SegmentData(descriptorSet) + heapOffsetKernel_;
@@ -559,6 +591,202 @@ const char* MTResourceHeap::BindKernelResources(id<MTLComputeCommandEncoder> cmd
     return heapPtr;
 }
 
+void MTResourceHeap::CreateArgumentBuffer(id<MTLDevice> device, const std::vector<BindingDescriptor>& bindings, std::uint32_t numSets)
+{
+    const auto numBindings = static_cast<std::uint32_t>(bindings.size());
+
+    /* Map bindings to argument types; resources with read-only access precede the ones with read-write access in the list of used resources */
+    argumentMap_.resize(numBindings);
+
+    for (const BindingDescriptor& binding : bindings)
+    {
+        if (binding.type != ResourceType::Sampler && (binding.bindFlags & BindFlags::Storage) == 0)
+            ++numReadOnlyResources_;
+    }
+
+    std::uint32_t numReadWriteResources = 0;
+
+    for_range(i, numBindings)
+    {
+        const BindingDescriptor&    binding     = bindings[i];
+        ArgumentLocation&           argument    = argumentMap_[i];
+        const bool                  isWritable  = ((binding.bindFlags & BindFlags::Storage) != 0);
+
+        switch (binding.type)
+        {
+            case ResourceType::Buffer:
+                argument.type = MTResourceType_Buffer;
+                break;
+            case ResourceType::Texture:
+                argument.type = MTResourceType_Texture;
+                break;
+            case ResourceType::Sampler:
+                argument.type = MTResourceType_SamplerState;
+                break;
+            default:
+                throw std::invalid_argument("cannot encode argument buffer for resource heap binding of undefined resource type");
+        }
+
+        if (argument.type == MTResourceType_SamplerState)
+            argument.resourceIndex = ArgumentLocation::invalidIndex;
+        else if (isWritable)
+            argument.resourceIndex = numReadOnlyResources_ + numReadWriteResources++;
+        else
+            argument.resourceIndex = numUsedResourcesPerSet_++;
+    }
+
+    numUsedResourcesPerSet_ += numReadWriteResources;
+    usedResources_.resize(numUsedResourcesPerSet_ * numSets, nil);
+
+    if (@available(macOS 10.13, iOS 11.0, *))
+    {
+        /* Create argument encoder where each argument index equals the binding index */
+        NSMutableArray<MTLArgumentDescriptor*>* arguments = [[NSMutableArray alloc] initWithCapacity:numBindings];
+
+        for_range(i, numBindings)
+        {
+            MTLArgumentDescriptor* argumentDesc = [[MTLArgumentDescriptor alloc] init];
+            {
+                argumentDesc.index  = i;
+                argumentDesc.access = ((bindings[i].bindFlags & BindFlags::Storage) != 0 ? MTLArgumentAccessReadWrite : MTLArgumentAccessReadOnly);
+                switch (argumentMap_[i].type)
+                {
+                    case MTResourceType_Buffer:
+                        argumentDesc.dataType = MTLDataTypePointer;
+                        break;
+                    case MTResourceType_Texture:
+                        argumentDesc.dataType = MTLDataTypeTexture;
+                        break;
+                    case MTResourceType_SamplerState:
+                        argumentDesc.dataType = MTLDataTypeSampler;
+                        break;
+                }
+            }
+            [arguments addObject:argumentDesc];
+            [argumentDesc release];
+        }
+
+        argumentEncoder_ = [device newArgumentEncoderWithArguments:arguments];
+        [arguments release];
+
+        /* Allocate one argument buffer for all descriptor sets with the alignment the encoder requires for each set */
+        argumentBufferStride_   = GetAlignedSize<NSUInteger>([argumentEncoder_ encodedLength], [argumentEncoder_ alignment]);
+        argumentBuffer_         = [device
+            newBufferWithLength:    std::max<NSUInteger>(1u, argumentBufferStride_ * numSets)
+            options:                MTLResourceStorageModeShared
+        ];
+    }
+}
+
+void MTResourceHeap::WriteArgument(const ResourceViewDescriptor& desc, std::uint32_t descriptor)
+{
+    const auto              numBindings     = static_cast<std::uint32_t>(argumentMap_.size());
+    const auto              descriptorSet   = descriptor / numBindings;
+    const NSUInteger        argumentIndex   = descriptor % numBindings;
+    const ArgumentLocation& argument        = argumentMap_[argumentIndex];
+
+    if (@available(macOS 10.13, iOS 11.0, *))
+    {
+        [argumentEncoder_ setArgumentBuffer:argumentBuffer_ offset:argumentBufferStride_ * descriptorSet];
+
+        id<MTLResource> resource = nil;
+
+        switch (argument.type)
+        {
+            case MTResourceType_Buffer:
+            {
+                auto bufferMT = LLGL_CAST(MTBuffer*, GetAsExpectedBuffer(desc.resource));
+                resource = bufferMT->GetNative();
+                [argumentEncoder_
+                    setBuffer:  bufferMT->GetNative()
+                    offset:     static_cast<NSUInteger>(desc.bufferView.offset)
+                    atIndex:    argumentIndex
+                ];
+            }
+            break;
+
+            case MTResourceType_Texture:
+            {
+                /* Texture views are stored in the slot of the first shader stage the binding is visible to */
+                const auto& binding = bindingMap_[argumentIndex];
+                for (const auto& stage : binding.stages)
+                {
+                    if (stage.segmentOffset == BindingSegmentLocation::invalidOffset)
+                        continue;
+                    auto textureMT = LLGL_CAST(MTTexture*, GetAsExpectedTexture(desc.resource));
+                    id<MTLTexture> texture = GetOrCreateTexture(descriptorSet, stage, *textureMT, desc.textureView);
+                    resource = texture;
+                    [argumentEncoder_ setTexture:texture atIndex:argumentIndex];
+                    break;
+                }
+            }
+            break;
+
+            case MTResourceType_SamplerState:
+            {
+                auto samplerMT = LLGL_CAST(MTSampler*, GetAsExpectedSampler(desc.resource));
+                [argumentEncoder_ setSamplerState:samplerMT->GetNative() atIndex:argumentIndex];
+            }
+            break;
+        }
+
+        /* Track resource for residency at bind time */
+        if (argument.resourceIndex != ArgumentLocation::invalidIndex)
+            usedResources_[descriptorSet * numUsedResourcesPerSet_ + argument.resourceIndex] = resource;
+    }
+}
+
+// Declares the residency of all written resources in the specified range. Resources that have not been written yet are skipped.
+template <typename TCommandEncoder>
+static void UseResourceRanges(TCommandEncoder cmdEncoder, const id<MTLResource>* resources, NSUInteger count, MTLResourceUsage usage)
+{
+    if (@available(macOS 10.13, iOS 11.0, *))
+    {
+        for (NSUInteger first = 0; first < count;)
+        {
+            while (first < count && resources[first] == nil)
+                ++first;
+
+            NSUInteger last = first;
+            while (last < count && resources[last] != nil)
+                ++last;
+
+            if (last > first)
+                [cmdEncoder useResources:(resources + first) count:(last - first) usage:usage];
+
+            first = last;
+        }
+    }
+}
+
+void MTResourceHeap::BindGraphicsArgumentBuffer(id<MTLRenderCommandEncoder> renderEncoder, std::uint32_t descriptorSet)
+{
+    const NSUInteger offset = argumentBufferStride_ * descriptorSet;
+
+    if (segmentation_.hasVertexResources)
+        [renderEncoder setVertexBuffer:argumentBuffer_ offset:offset atIndex:argumentBufferSlot_];
+    if (segmentation_.hasFragmentResources)
+        [renderEncoder setFragmentBuffer:argumentBuffer_ offset:offset atIndex:argumentBufferSlot_];
+
+    /* Resources that are only referenced by the argument buffer must be made resident explicitly */
+    const id<MTLResource>* resources = usedResources_.data() + descriptorSet * numUsedResourcesPerSet_;
+    UseResourceRanges(renderEncoder, resources, numReadOnlyResources_, MTLResourceUsageRead);
+    UseResourceRanges(renderEncoder, resources + numReadOnlyResources_, numUsedResourcesPerSet_ - numReadOnlyResources_, MTLResourceUsageRead | MTLResourceUsageWrite);
+}
+
+void MTResourceHeap::BindComputeArgumentBuffer(id<MTLComputeCommandEncoder> computeEncoder, std::uint32_t descriptorSet)
+{
+    if (!segmentation_.hasKernelResources)
+        return;
+
+    [computeEncoder setBuffer:argumentBuffer_ offset:(argumentBufferStride_ * descriptorSet) atIndex:argumentBufferSlot_];
+
+    /* Resources that are only referenced by the argument buffer must be made resident explicitly */
+    const id<MTLResource>* resources = usedResources_.data() + descriptorSet * numUsedResourcesPerSet_;
+    UseResourceRanges(computeEncoder, resources, numReadOnlyResources_, MTLResourceUsageRead);
+    UseResourceRanges(computeEncoder, resources + numReadOnlyResources_, numUsedResourcesPerSet_ - numReadOnlyResources_, MTLResourceUsageRead | MTLResourceUsageWrite);
+}
+
 void MTResourceHeap::WriteResourceViewBuffer(const ResourceViewDescriptor& desc, char* heapPtr, const BindingSegmentLocation::Stage& binding)
 {
     /* Get buffer resource and write MTLBuffer ID plus offset (Metal only needs offset) */
@@ -0,0 +1,73 @@
+/*
+ * BlitTexture2D.metal.inl
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+/*
+Scaled texture blit (see CommandBuffer::BlitTexture).
+This shader is compiled at runtime from source when it is used for the first time (see MTBuiltinPSOFactory).
+Bilinear filtering is done manually with four texel reads so no sampler has to be bound,
+and all reads are clamped to the source region to avoid bleeding in texels from outside the region.
+*/
+R"(
+
+#include <metal_stdlib>
+
+using namespace metal;
+
+// Source and destination regions; must match MTBlitTextureDescriptor
+struct BlitDescriptor
+{
+    int2    srcOffset;      // First texel of the source region
+    int2    srcMax;         // Last texel of the source region (inclusive)
+    float2  srcScale;       // Ratio between the source and destination extent
+    int2    dstOffset;      // First texel of the destination region
+    uint2   dstExtent;      // Extent of the destination region
+    uint    linearFilter;   // Non-zero for bilinear filtering, zero for nearest filtering
+    uint    padding0;
+};
+
+static float4 LoadSourceTexel(texture2d<float, access::read> srcTexture, constant BlitDescriptor& desc, int2 pos)
+{
+    return srcTexture.read(uint2(clamp(pos, desc.srcOffset, desc.srcMax)));
+}
+
+kernel void CS(
+    texture2d<float, access::read>  srcTexture  [[texture(0)]],
+    texture2d<float, access::write> dstTexture  [[texture(1)]],
+    constant BlitDescriptor&        desc        [[buffer(0)]],
+    uint2                           threadID    [[thread_position_in_grid]])
+{
+    if (any(threadID >= desc.dstExtent))
+        return;
+
+    // Map center of destination texel into source region
+    float2 srcPos = (float2(threadID) + 0.5) * desc.srcScale - 0.5 + float2(desc.srcOffset);
+
+    float4 color;
+    if (desc.linearFilter != 0)
+    {
+        float2  srcBase = floor(srcPos);
+        float2  t       = srcPos - srcBase;
+        int2    p       = int2(srcBase);
+
+        float4  c00     = LoadSourceTexel(srcTexture, desc, p);
+        float4  c10     = LoadSourceTexel(srcTexture, desc, p + int2(1, 0));
+        float4  c01     = LoadSourceTexel(srcTexture, desc, p + int2(0, 1));
+        float4  c11     = LoadSourceTexel(srcTexture, desc, p + int2(1, 1));
+
+        color = mix(mix(c00, c10, t.x), mix(c01, c11, t.x), t.y);
+    }
+    else
+        color = LoadSourceTexel(srcTexture, desc, int2(floor(srcPos + 0.5)));
+
+    dstTexture.write(color, uint2(int2(threadID) + desc.dstOffset));
+}
+
+)"
+
+
+
+// ================================================================================
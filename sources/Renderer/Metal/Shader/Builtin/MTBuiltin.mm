@@ -31,6 +31,11 @@ const std::size_t g_metalLibFillBufferByte4Len =
     #endif
 );
 
+const char* g_metalSrcBlitTexture2D =
+(
+    #include "BlitTexture2D.metal.inl"
+);
+
 
 
 // ================================================================================
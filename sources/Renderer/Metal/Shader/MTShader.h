@@ -54,7 +54,7 @@ class MTShader final : public Shader
             return vertexDesc_;
         }
 
-        // Returns the number of threads per thread-group for compute kernels.
+        // Returns the number of threads per thread-group for compute kernels as well as object and mesh functions.
         inline const MTLSize& GetNumThreadsPerGroup() const
         {
             return numThreadsPerGroup_;
@@ -27,8 +27,8 @@ MTShader::MTShader(id<MTLDevice> device, const ShaderDescriptor& desc) :
         /* Build vertex input layout */
         BuildInputLayout(desc.vertex.inputAttribs.size(), desc.vertex.inputAttribs.data());
 
-        /* Store work group size for compute shaders */
-        if (desc.type == ShaderType::Compute)
+        /* Store work group size for compute, object, and mesh shaders */
+        if (desc.type == ShaderType::Compute || desc.type == ShaderType::Task || desc.type == ShaderType::Mesh)
         {
             const auto& workGroupSize = desc.compute.workGroupSize;
             numThreadsPerGroup_ = MTLSizeMake(workGroupSize.width, workGroupSize.height, workGroupSize.depth);
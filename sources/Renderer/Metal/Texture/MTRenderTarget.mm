@@ -224,8 +224,14 @@ void MTRenderTarget::CreateAttachment(
     outAttachment.loadAction   = fmt.loadAction;
     outAttachment.storeAction  = fmt.storeAction;
 
-    if (outAttachment.storeAction == MTLStoreActionStore && outAttachment.resolveTexture != nil)
-        outAttachment.storeAction = MTLStoreActionStoreAndMultisampleResolve;
+    /* Resolve multi-sampled attachments at the end of the pass; only store the samples if they are needed afterwards */
+    if (outAttachment.resolveTexture != nil)
+    {
+        if (outAttachment.storeAction == MTLStoreActionStore)
+            outAttachment.storeAction = MTLStoreActionStoreAndMultisampleResolve;
+        else if (outAttachment.storeAction == MTLStoreActionDontCare)
+            outAttachment.storeAction = MTLStoreActionMultisampleResolve;
+    }
 }
 
 MTLTextureDescriptor* MTRenderTarget::CreateTextureDesc(
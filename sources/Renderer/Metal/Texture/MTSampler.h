@@ -23,7 +23,7 @@ class MTSampler final : public Sampler
 
     public:
 
-        MTSampler(id<MTLDevice> device, const SamplerDescriptor& desc);
+        MTSampler(id<MTLDevice> device, const SamplerDescriptor& desc, bool supportArgumentBuffers = false);
         ~MTSampler();
     
         // Returns the native MTLSamplerState object.
@@ -37,8 +37,8 @@ class MTSampler final : public Sampler
         // Converts the specified sampler descriptor to a native Metal descriptor.
         static void ConvertDesc(MTLSamplerDescriptor* dst, const SamplerDescriptor& src);
 
-        // Creates a native Metal sampler state from the specified descriptor.
-        static id<MTLSamplerState> CreateNative(id<MTLDevice> device, const SamplerDescriptor& desc);
+        // Creates a native Metal sampler state from the specified descriptor. Samplers must support argument buffers to be encoded into resource heaps in argument buffer mode.
+        static id<MTLSamplerState> CreateNative(id<MTLDevice> device, const SamplerDescriptor& desc, bool supportArgumentBuffers = false);
 
     private:
 
@@ -23,6 +23,7 @@ struct MutableImageView;
 struct SubresourceCPUMappingLayout;
 struct FormatAttributes;
 class MTIntermediateBuffer;
+class MTTransientHeapPool;
 
 class MTTexture final : public Texture
 {
@@ -31,9 +32,11 @@ class MTTexture final : public Texture
 
         #include <LLGL/Backend/Texture.inl>
 
+        bool GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize) override;
+
     public:
 
-        MTTexture(id<MTLDevice> device, const TextureDescriptor& desc);
+        MTTexture(id<MTLDevice> device, const TextureDescriptor& desc, MTTransientHeapPool* transientHeapPool = nullptr);
         ~MTTexture();
 
         // Returns the region for the specified subresource.
@@ -56,6 +59,20 @@ class MTTexture final : public Texture
         // Returns the number of bytes per row for this texture with the specified row extent.
         NSUInteger GetBytesPerRow(std::uint32_t rowExtent) const;
 
+        // Returns true if this texture was placed in a transient heap (see MiscFlags::Transient).
+        inline bool IsTransient() const
+        {
+            return (transientHeap_ != nil);
+        }
+
+        // Returns true if this texture has no backing memory outside of tile memory (see MiscFlags::Memoryless).
+        inline bool IsMemoryless() const
+        {
+            if (@available(macOS 11.0, iOS 13.0, *))
+                return ([native_ storageMode] == MTLStorageModeMemoryless);
+            return false;
+        }
+
         // Returns the native MTLTexture object.
         inline id<MTLTexture> GetNative() const
         {
@@ -64,6 +81,14 @@ class MTTexture final : public Texture
 
     private:
 
+        // Creates the native texture in the transient heap of the specified slot. Leaves the native texture as nil on failure.
+        void CreateTransientTexture(
+            id<MTLDevice>           device,
+            MTLTextureDescriptor*   texDesc,
+            std::uint32_t           slot,
+            MTTransientHeapPool&    transientHeapPool
+        );
+
         void ReadRegionFromSharedMemory(
             const MTLRegion&                    region,
             const TextureSubresource&           subresource,
@@ -84,7 +109,8 @@ class MTTexture final : public Texture
 
     private:
 
-        id<MTLTexture> native_ = nil;
+        id<MTLTexture>  native_         = nil;
+        id<MTLHeap>     transientHeap_  = nil; // Retained heap this transient texture was placed in.
 
 };
 
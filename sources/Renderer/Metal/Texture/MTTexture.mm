@@ -6,13 +6,16 @@
  */
 
 #include "MTTexture.h"
+#include "MTTransientHeapPool.h"
 #include "../MTTypes.h"
 #include "../MTDevice.h"
 #include "../Buffer/MTIntermediateBuffer.h"
 #include "../../TextureUtils.h"
 #include <LLGL/TextureFlags.h>
+#include <LLGL/ResourceFlags.h>
 #include <LLGL/ImageFlags.h>
 #include <LLGL/Utils/ForRange.h>
+#include <LLGL/Backend/Metal/NativeHandle.h>
 #include <algorithm>
 
 
@@ -66,6 +69,14 @@ static MTLTextureType ToMTLTextureTypeWithMipMaps(TextureType type)
     }
 }
 
+// Returns true if the device supports memoryless render targets, which requires an Apple GPU with tile memory.
+static bool IsMemorylessSupported(id<MTLDevice> device)
+{
+    if (@available(macOS 11.0, iOS 13.0, *))
+        return [device supportsFamily:MTLGPUFamilyApple1];
+    return false;
+}
+
 static void ConvertTextureDesc(id<MTLDevice> device, MTLTextureDescriptor* dst, const TextureDescriptor& src)
 {
     /*
@@ -86,20 +97,39 @@ static void ConvertTextureDesc(id<MTLDevice> device, MTLTextureDescriptor* dst,
     dst.resourceOptions     = GetResourceOptions(src);
     if (IsMultiSampleTexture(src.type) || IsDepthOrStencilFormat(src.format))
         dst.storageMode = MTLStorageModePrivate;
+
+    /* Memoryless textures only live in tile memory; fall back to private storage on GPUs without tile memory */
+    if ((src.miscFlags & MiscFlags::Memoryless) != 0)
+    {
+        dst.storageMode = MTLStorageModePrivate;
+        if (@available(macOS 11.0, iOS 13.0, *))
+        {
+            if (IsMemorylessSupported(device))
+                dst.storageMode = MTLStorageModeMemoryless;
+        }
+    }
 }
 
-MTTexture::MTTexture(id<MTLDevice> device, const TextureDescriptor& desc) :
+MTTexture::MTTexture(id<MTLDevice> device, const TextureDescriptor& desc, MTTransientHeapPool* transientHeapPool) :
     Texture { desc.type, desc.bindFlags }
 {
     MTLTextureDescriptor* texDesc = [[MTLTextureDescriptor alloc] init];
     ConvertTextureDesc(device, texDesc, desc);
-    native_ = [device newTextureWithDescriptor:texDesc];
+
+    if (transientHeapPool != nullptr && (desc.miscFlags & MiscFlags::Transient) != 0)
+        CreateTransientTexture(device, texDesc, desc.transientSlot, *transientHeapPool);
+
+    /* Fall back to a regular texture if placement heaps are not supported */
+    if (native_ == nil)
+        native_ = [device newTextureWithDescriptor:texDesc];
+
     [texDesc release];
 }
 
 MTTexture::~MTTexture()
 {
     [native_ release];
+    [transientHeap_ release];
 }
 
 Extent3D MTTexture::GetMipExtent(std::uint32_t mipLevel) const
@@ -145,6 +175,18 @@ Extent3D MTTexture::GetMipExtent(std::uint32_t mipLevel) const
     return Extent3D{ w, h, d };
 }
 
+bool MTTexture::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
+{
+    if (nativeHandle != nullptr && nativeHandleSize == sizeof(Metal::ResourceNativeHandle))
+    {
+        auto* nativeHandleMT = reinterpret_cast<Metal::ResourceNativeHandle*>(nativeHandle);
+        nativeHandleMT->resource = native_;
+        [nativeHandleMT->resource retain];
+        return true;
+    }
+    return false;
+}
+
 TextureDescriptor MTTexture::GetDesc() const
 {
     TextureDescriptor texDesc;
@@ -207,6 +249,11 @@ void MTTexture::WriteRegion(const TextureRegion& textureRegion, const ImageView&
             imageData = intermediateData.get();
         }
     }
+    else if ((intermediateData = CompressTextureImageData(format, srcImageView, textureRegion.extent, textureRegion.subresource.numArrayLayers)))
+    {
+        /* Compress uncompressed image data (e.g. from RGBA to BC1) on the CPU */
+        imageData = intermediateData.get();
+    }
 
     /* Replace region of native texture with source image data */
     auto byteAlignedData = reinterpret_cast<const std::int8_t*>(imageData);
@@ -297,6 +344,33 @@ NSUInteger MTTexture::GetBytesPerRow(std::uint32_t rowExtent) const
  * ======= Private: =======
  */
 
+void MTTexture::CreateTransientTexture(
+    id<MTLDevice>           device,
+    MTLTextureDescriptor*   texDesc,
+    std::uint32_t           slot,
+    MTTransientHeapPool&    transientHeapPool)
+{
+    if (@available(macOS 10.15, iOS 13.0, *))
+    {
+        /* Transient textures are GPU-only, since a heap can only hold resources of its own storage mode */
+        const MTLStorageMode storageMode = texDesc.storageMode;
+        texDesc.storageMode = MTLStorageModePrivate;
+
+        /* Place all transient textures of the same slot at the beginning of their heap, so they alias the same memory */
+        if (id<MTLHeap> heap = transientHeapPool.GetOrCreateHeap(device, slot, texDesc))
+        {
+            native_ = [heap newTextureWithDescriptor:texDesc offset:0];
+            if (native_ != nil)
+            {
+                transientHeap_ = [heap retain];
+                return;
+            }
+        }
+
+        texDesc.storageMode = storageMode;
+    }
+}
+
 void MTTexture::ReadRegionFromSharedMemory(
     const MTLRegion&                    region,
     const TextureSubresource&           subresource,
@@ -0,0 +1,68 @@
+/*
+ * MTTransientHeapPool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_MT_TRANSIENT_HEAP_POOL_H
+#define LLGL_MT_TRANSIENT_HEAP_POOL_H
+
+
+#import <Metal/Metal.h>
+
+#include <cstdint>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/*
+Pool of placement heaps for transient textures (see MiscFlags::Transient).
+All transient textures of the same slot are placed at offset 0 of the same heap, so they alias the same memory.
+If a new texture does not fit into the current heap of its slot, a larger heap replaces it for subsequently created textures.
+The previous heap stays alive for as long as the textures that were placed in it, since each texture retains its heap.
+*/
+class MTTransientHeapPool
+{
+
+    public:
+
+        MTTransientHeapPool() = default;
+        ~MTTransientHeapPool();
+
+        MTTransientHeapPool(const MTTransientHeapPool&) = delete;
+        MTTransientHeapPool& operator = (const MTTransientHeapPool&) = delete;
+
+        // Returns true if placement heaps are supported, which requires macOS 10.15 or iOS 13.
+        static bool IsSupported();
+
+        // Returns the heap for the specified transient slot that can hold a texture with the specified descriptor, or nil on failure.
+        id<MTLHeap> GetOrCreateHeap(id<MTLDevice> device, std::uint32_t slot, MTLTextureDescriptor* texDesc);
+
+    private:
+
+        struct HeapEntry
+        {
+            std::uint32_t   slot;
+            id<MTLHeap>     heap;
+            NSUInteger      size;
+        };
+
+    private:
+
+        std::vector<HeapEntry> heaps_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
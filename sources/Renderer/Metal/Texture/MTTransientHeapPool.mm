@@ -0,0 +1,104 @@
+/*
+ * MTTransientHeapPool.mm
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "MTTransientHeapPool.h"
+#include "../../../Core/CoreUtils.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+static id<MTLHeap> CreateMTLTransientHeap(id<MTLDevice> device, NSUInteger size)
+{
+    if (@available(macOS 10.15, iOS 13.0, *))
+    {
+        MTLHeapDescriptor* heapDesc = [[MTLHeapDescriptor alloc] init];
+        {
+            heapDesc.type               = MTLHeapTypePlacement;
+            heapDesc.storageMode        = MTLStorageModePrivate;
+            heapDesc.cpuCacheMode       = MTLCPUCacheModeDefaultCache;
+            heapDesc.hazardTrackingMode = MTLHazardTrackingModeTracked; // Let Metal serialize access to textures that alias the same memory
+            heapDesc.size               = size;
+        }
+        id<MTLHeap> heap = [device newHeapWithDescriptor:heapDesc];
+        [heapDesc release];
+
+        if (heap != nil)
+            [heap setLabel:@"LLGL::MTTransientHeap"];
+
+        return heap;
+    }
+    return nil;
+}
+
+MTTransientHeapPool::~MTTransientHeapPool()
+{
+    for (HeapEntry& entry : heaps_)
+        [entry.heap release];
+}
+
+bool MTTransientHeapPool::IsSupported()
+{
+    if (@available(macOS 10.15, iOS 13.0, *))
+        return true;
+    else
+        return false;
+}
+
+id<MTLHeap> MTTransientHeapPool::GetOrCreateHeap(id<MTLDevice> device, std::uint32_t slot, MTLTextureDescriptor* texDesc)
+{
+    /* Determine size of texture within a heap */
+    NSUInteger requiredSize = 0;
+    if (@available(macOS 10.13, iOS 10.0, *))
+    {
+        const MTLSizeAndAlign sizeAndAlign = [device heapTextureSizeAndAlignWithDescriptor:texDesc];
+        requiredSize = GetAlignedSize<NSUInteger>(sizeAndAlign.size, sizeAndAlign.align);
+    }
+    else
+        return nil;
+
+    auto it = std::find_if(
+        heaps_.begin(),
+        heaps_.end(),
+        [slot](const HeapEntry& entry) -> bool
+        {
+            return (entry.slot == slot);
+        }
+    );
+
+    if (it == heaps_.end())
+    {
+        /* Create first heap for this slot */
+        id<MTLHeap> heap = CreateMTLTransientHeap(device, requiredSize);
+        if (heap == nil)
+            return nil;
+        heaps_.push_back(HeapEntry{ slot, heap, requiredSize });
+        return heap;
+    }
+
+    if (it->size < requiredSize)
+    {
+        /* Replace heap by a larger one; textures in the previous heap keep it alive */
+        id<MTLHeap> heap = CreateMTLTransientHeap(device, requiredSize);
+        if (heap == nil)
+            return nil;
+        [it->heap release];
+        it->heap = heap;
+        it->size = requiredSize;
+    }
+
+    return it->heap;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -20,6 +20,7 @@ namespace LLGL
 
 class NullBuffer;
 class NullTexture;
+class NullQueryHeap;
 
 
 struct NullCmdBufferWrite
@@ -60,6 +61,21 @@ struct NullCmdGenerateMips
 
 //TODO...
 
+struct NullCmdQuery
+{
+    NullQueryHeap*  queryHeap;
+    std::uint32_t   query;
+};
+
+struct NullCmdResolveQueries
+{
+    NullQueryHeap*  queryHeap;
+    std::uint32_t   firstQuery;
+    std::uint32_t   numQueries;
+    NullBuffer*     dstBuffer;
+    std::uint64_t   dstOffset;
+};
+
 struct NullCmdDraw
 {
     DrawIndirectArguments   args;
@@ -8,9 +8,11 @@
 #include "NullCommandBuffer.h"
 #include "NullCommandExecutor.h"
 #include "NullCommand.h"
+#include "../NullBenchmark.h"
 #include "../../CheckedCast.h"
 #include "../../../Core/CoreUtils.h"
 #include <LLGL/TypeInfo.h>
+#include <LLGL/Utils/ForRange.h>
 
 #include "../NullSwapChain.h"
 #include "../Buffer/NullBuffer.h"
@@ -23,14 +25,16 @@
 
 #include <LLGL/RenderingDebugger.h>
 #include <LLGL/IndirectArguments.h>
+#include <algorithm>
 
 
 namespace LLGL
 {
 
 
-NullCommandBuffer::NullCommandBuffer(const CommandBufferDescriptor& desc) :
-    desc { desc }
+NullCommandBuffer::NullCommandBuffer(const CommandBufferDescriptor& desc, NullBenchmark* benchmark) :
+    desc       { desc      },
+    benchmark_ { benchmark }
 {
 }
 
@@ -39,6 +43,9 @@ NullCommandBuffer::NullCommandBuffer(const CommandBufferDescriptor& desc) :
 void NullCommandBuffer::Begin()
 {
     buffer_.Clear();
+    profile_        = {};
+    uploadedBytes_  = 0;
+    profile_.commandBufferRecord.encodings++;
 }
 
 void NullCommandBuffer::End()
@@ -51,7 +58,11 @@ void NullCommandBuffer::Execute(CommandBuffer& deferredCommandBuffer)
 {
     auto& deferredCommandBufferNull = LLGL_CAST(NullCommandBuffer&, deferredCommandBuffer);
     if ((deferredCommandBufferNull.desc.flags & CommandBufferFlags::Secondary) != 0)
+    {
         deferredCommandBufferNull.ExecuteVirtualCommands();
+        RenderingDebugger::MergeProfiles(profile_, deferredCommandBufferNull.profile_);
+        uploadedBytes_ += deferredCommandBufferNull.uploadedBytes_;
+    }
 }
 
 /* ----- Blitting ----- */
@@ -60,16 +71,18 @@ void NullCommandBuffer::UpdateBuffer(
     Buffer&         dstBuffer,
     std::uint64_t   dstOffset,
     const void*     data,
-    std::uint16_t   dataSize)
+    std::uint64_t   dataSize)
 {
     auto dstBufferNull = LLGL_CAST(NullBuffer*, &dstBuffer);
-    auto cmd = AllocCommand<NullCmdBufferWrite>(NullOpcodeBufferWrite, dataSize);
+    auto cmd = AllocCommand<NullCmdBufferWrite>(NullOpcodeBufferWrite, static_cast<std::size_t>(dataSize));
     {
         cmd->buffer = dstBufferNull;
         cmd->offset = static_cast<std::size_t>(dstOffset);
-        cmd->size   = dataSize;
-        ::memcpy(cmd + 1, data, dataSize);
+        cmd->size   = static_cast<std::size_t>(dataSize);
+        ::memcpy(cmd + 1, data, cmd->size);
     }
+    profile_.commandBufferRecord.bufferUpdates++;
+    uploadedBytes_ += dataSize;
 }
 
 void NullCommandBuffer::CopyBuffer(
@@ -97,6 +110,16 @@ void NullCommandBuffer::CopyBuffer(
         cmd->rowStride      = 0;
         cmd->layerStride    = 0;
     }
+    profile_.commandBufferRecord.bufferCopies++;
+}
+
+void NullCommandBuffer::CopyBuffer(
+    Buffer&                                 dstBuffer,
+    Buffer&                                 srcBuffer,
+    const ArrayView<BufferCopyRegion>&      regions)
+{
+    for (const BufferCopyRegion& region : regions)
+        CopyBuffer(dstBuffer, region.dstOffset, srcBuffer, region.srcOffset, region.size);
 }
 
 static Extent3D GetSubresourceExtent(TextureType type, const Extent3D& extent, std::uint32_t numArrayLayers)
@@ -142,6 +165,7 @@ void NullCommandBuffer::CopyBufferFromTexture(
         cmd->rowStride      = rowStride;
         cmd->layerStride    = layerStride;
     }
+    profile_.commandBufferRecord.bufferCopies++;
 }
 
 void NullCommandBuffer::FillBuffer(
@@ -152,6 +176,7 @@ void NullCommandBuffer::FillBuffer(
 {
     //auto& dstBufferNull = LLGL_CAST(NullBuffer&, dstBuffer);
     //todo
+    profile_.commandBufferRecord.bufferFills++;
 }
 
 void NullCommandBuffer::CopyTexture(
@@ -181,6 +206,16 @@ void NullCommandBuffer::CopyTexture(
         cmd->rowStride      = 0;
         cmd->layerStride    = 0;
     }
+    profile_.commandBufferRecord.textureCopies++;
+}
+
+void NullCommandBuffer::CopyTexture(
+    Texture&                                dstTexture,
+    Texture&                                srcTexture,
+    const ArrayView<TextureCopyRegion>&     regions)
+{
+    for (const TextureCopyRegion& region : regions)
+        CopyTexture(dstTexture, region.dstLocation, srcTexture, region.srcLocation, region.extent);
 }
 
 void NullCommandBuffer::CopyTextureFromBuffer(
@@ -211,6 +246,16 @@ void NullCommandBuffer::CopyTextureFromBuffer(
         cmd->rowStride      = rowStride;
         cmd->layerStride    = layerStride;
     }
+    profile_.commandBufferRecord.textureCopies++;
+}
+
+void NullCommandBuffer::CopyTextureFromBuffer(
+    Texture&                                    dstTexture,
+    Buffer&                                     srcBuffer,
+    const ArrayView<BufferTextureCopyRegion>&   regions)
+{
+    for (const BufferTextureCopyRegion& region : regions)
+        CopyTextureFromBuffer(dstTexture, region.textureRegion, srcBuffer, region.bufferOffset, region.rowStride, region.layerStride);
 }
 
 void NullCommandBuffer::CopyTextureFromFramebuffer(
@@ -219,6 +264,18 @@ void NullCommandBuffer::CopyTextureFromFramebuffer(
     const Offset2D&         srcOffset)
 {
     //todo
+    profile_.commandBufferRecord.textureCopies++;
+}
+
+void NullCommandBuffer::BlitTexture(
+    Texture&                dstTexture,
+    const TextureRegion&    dstRegion,
+    Texture&                srcTexture,
+    const TextureRegion&    srcRegion,
+    const SamplerFilter     filter)
+{
+    //todo
+    profile_.commandBufferRecord.textureCopies++;
 }
 
 void NullCommandBuffer::GenerateMips(Texture& texture)
@@ -232,6 +289,7 @@ void NullCommandBuffer::GenerateMips(Texture& texture)
         cmd->baseMipLevel   = 0;
         cmd->numMipLevels   = textureNull.desc.mipLevels;
     }
+    profile_.commandBufferRecord.mipMapsGenerations++;
 }
 
 void NullCommandBuffer::GenerateMips(Texture& texture, const TextureSubresource& subresource)
@@ -245,6 +303,7 @@ void NullCommandBuffer::GenerateMips(Texture& texture, const TextureSubresource&
         cmd->baseMipLevel   = subresource.baseMipLevel;
         cmd->numMipLevels   = subresource.numMipLevels;
     }
+    profile_.commandBufferRecord.mipMapsGenerations++;
 }
 
 /* ----- Viewport and Scissor ----- */
@@ -252,35 +311,54 @@ void NullCommandBuffer::GenerateMips(Texture& texture, const TextureSubresource&
 void NullCommandBuffer::SetViewport(const Viewport& viewport)
 {
     renderState_.viewports = { viewport };
+    profile_.commandBufferRecord.stateChanges++;
 }
 
 void NullCommandBuffer::SetViewports(std::uint32_t numViewports, const Viewport* viewports)
 {
     renderState_.viewports = SmallVector<Viewport>(viewports, viewports + numViewports);
+    profile_.commandBufferRecord.stateChanges++;
 }
 
 void NullCommandBuffer::SetScissor(const Scissor& scissor)
 {
     renderState_.scissors = { scissor };
+    profile_.commandBufferRecord.stateChanges++;
 }
 
 void NullCommandBuffer::SetScissors(std::uint32_t numScissors, const Scissor* scissors)
 {
     renderState_.scissors = SmallVector<Scissor>(scissors, scissors + numScissors);
+    profile_.commandBufferRecord.stateChanges++;
 }
 
 /* ----- Buffers ------ */
 
-void NullCommandBuffer::SetVertexBuffer(Buffer& buffer)
+void NullCommandBuffer::SetVertexBuffer(Buffer& buffer, std::uint64_t /*offset*/)
 {
     auto& bufferNull = LLGL_CAST(NullBuffer&, buffer);
     renderState_.vertexBuffers = { &bufferNull };
+    profile_.commandBufferRecord.vertexBufferBindings++;
+    profile_.commandBufferRecord.stateChanges++;
 }
 
 void NullCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
 {
     auto& bufferArrayNull = LLGL_CAST(NullBufferArray&, bufferArray);
     renderState_.vertexBuffers = SmallVector<const NullBuffer*>(bufferArrayNull.buffers.begin(), bufferArrayNull.buffers.end());
+    profile_.commandBufferRecord.vertexBufferBindings++;
+    profile_.commandBufferRecord.stateChanges++;
+}
+
+void NullCommandBuffer::SetVertexBuffers(std::uint32_t firstSlot, std::uint32_t numBuffers, Buffer* const * buffers, const std::uint64_t* /*offsets*/)
+{
+    /* Only overwrite the specified range of slots like the hardware backends do */
+    if (renderState_.vertexBuffers.size() < firstSlot + numBuffers)
+        renderState_.vertexBuffers.resize(firstSlot + numBuffers, nullptr);
+    for_range(i, numBuffers)
+        renderState_.vertexBuffers[firstSlot + i] = LLGL_CAST(const NullBuffer*, buffers[i]);
+    profile_.commandBufferRecord.vertexBufferBindings++;
+    profile_.commandBufferRecord.stateChanges++;
 }
 
 void NullCommandBuffer::SetIndexBuffer(Buffer& buffer)
@@ -289,6 +367,8 @@ void NullCommandBuffer::SetIndexBuffer(Buffer& buffer)
     renderState_.indexBuffer        = &bufferNull;
     renderState_.indexBufferFormat  = bufferNull.desc.format;
     renderState_.indexBufferOffset  = 0;
+    profile_.commandBufferRecord.indexBufferBindings++;
+    profile_.commandBufferRecord.stateChanges++;
 }
 
 void NullCommandBuffer::SetIndexBuffer(Buffer& buffer, const Format format, std::uint64_t offset)
@@ -297,6 +377,8 @@ void NullCommandBuffer::SetIndexBuffer(Buffer& buffer, const Format format, std:
     renderState_.indexBuffer        = &bufferNull;
     renderState_.indexBufferFormat  = format;
     renderState_.indexBufferOffset  = offset;
+    profile_.commandBufferRecord.indexBufferBindings++;
+    profile_.commandBufferRecord.stateChanges++;
 }
 
 /* ----- Resources ----- */
@@ -305,11 +387,26 @@ void NullCommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap, std::uint32_
 {
     //auto& resourceHeapNull = LLGL_CAST(NullResourceHeap&, resourceHeap);
     //todo
+    profile_.commandBufferRecord.resourceHeapBindings++;
+    profile_.commandBufferRecord.stateChanges++;
 }
 
 void NullCommandBuffer::SetResource(std::uint32_t descriptor, Resource& resource)
 {
     //todo
+    CountResourceBinding(resource);
+    profile_.commandBufferRecord.stateChanges++;
+}
+
+void NullCommandBuffer::SetResources(std::uint32_t firstDescriptor, const ArrayView<Resource*>& resources)
+{
+    //todo
+    for (Resource* resource : resources)
+    {
+        if (resource != nullptr)
+            CountResourceBinding(*resource);
+    }
+    profile_.commandBufferRecord.stateChanges++;
 }
 
 void NullCommandBuffer::ResetResourceSlots(
@@ -320,6 +417,12 @@ void NullCommandBuffer::ResetResourceSlots(
     long                stageFlags)
 {
     //todo
+    profile_.commandBufferRecord.stateChanges++;
+}
+
+void NullCommandBuffer::ResourceBarrier(std::uint32_t numBarriers, const ResourceBarrierDescriptor* barriers)
+{
+    // dummy
 }
 
 /* ----- Render Passes ----- */
@@ -341,6 +444,7 @@ void NullCommandBuffer::BeginRenderPass(
         //auto& renderTargetNull = LLGL_CAST(NullRenderTarget&, renderTarget);
         //todo
     }
+    profile_.commandBufferRecord.renderPassSections++;
 }
 
 void NullCommandBuffer::EndRenderPass()
@@ -348,57 +452,119 @@ void NullCommandBuffer::EndRenderPass()
     //todo
 }
 
+void NullCommandBuffer::NextSubpass()
+{
+    //todo
+}
+
 void NullCommandBuffer::Clear(long flags, const ClearValue& clearValue)
 {
     //todo
+    profile_.commandBufferRecord.attachmentClears++;
 }
 
 void NullCommandBuffer::ClearAttachments(std::uint32_t numAttachments, const AttachmentClear* attachments)
 {
     //todo
+    profile_.commandBufferRecord.attachmentClears += numAttachments;
 }
 
 /* ----- Pipeline States ----- */
 
 void NullCommandBuffer::SetPipelineState(PipelineState& pipelineState)
 {
-    //auto& pipelineStateNull = LLGL_CAST(NullPipelineState&, pipelineState);
+    auto& pipelineStateNull = LLGL_CAST(NullPipelineState&, pipelineState);
     //todo
+    if (pipelineStateNull.isGraphicsPSO)
+        profile_.commandBufferRecord.graphicsPipelineBindings++;
+    else
+        profile_.commandBufferRecord.computePipelineBindings++;
+    profile_.commandBufferRecord.stateChanges++;
 }
 
 void NullCommandBuffer::SetBlendFactor(const float color[4])
 {
     //todo
+    profile_.commandBufferRecord.stateChanges++;
 }
 
 void NullCommandBuffer::SetStencilReference(std::uint32_t reference, const StencilFace stencilFace)
 {
     //todo
+    profile_.commandBufferRecord.stateChanges++;
+}
+
+void NullCommandBuffer::SetShadingRate(const ShadingRate rate)
+{
+    //todo
+    profile_.commandBufferRecord.stateChanges++;
+}
+
+void NullCommandBuffer::SetCullMode(const CullMode cullMode)
+{
+    //todo
+    profile_.commandBufferRecord.stateChanges++;
+}
+
+void NullCommandBuffer::SetDepthState(const DepthDescriptor& depthDesc)
+{
+    //todo
+    profile_.commandBufferRecord.stateChanges++;
+}
+
+void NullCommandBuffer::SetStencilState(const StencilDescriptor& stencilDesc)
+{
+    //todo
+    profile_.commandBufferRecord.stateChanges++;
+}
+
+void NullCommandBuffer::SetPrimitiveTopology(const PrimitiveTopology topology)
+{
+    //todo
+    profile_.commandBufferRecord.stateChanges++;
 }
 
 void NullCommandBuffer::SetUniforms(std::uint32_t first, const void* data, std::uint16_t dataSize)
 {
     //todo
+    profile_.commandBufferRecord.stateChanges++;
+    uploadedBytes_ += dataSize;
 }
 
 /* ----- Queries ----- */
 
 void NullCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t query)
 {
-    //auto& queryHeapNull = LLGL_CAST(NullQueryHeap&, queryHeap);
-    //todo
+    auto& queryHeapNull = LLGL_CAST(NullQueryHeap&, queryHeap);
+    auto cmd = AllocCommand<NullCmdQuery>(NullOpcodeBeginQuery);
+    {
+        cmd->queryHeap  = &queryHeapNull;
+        cmd->query      = query;
+    }
+    profile_.commandBufferRecord.querySections++;
 }
 
 void NullCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query)
 {
-    //auto& queryHeapNull = LLGL_CAST(NullQueryHeap&, queryHeap);
-    //todo
+    auto& queryHeapNull = LLGL_CAST(NullQueryHeap&, queryHeap);
+    auto cmd = AllocCommand<NullCmdQuery>(NullOpcodeEndQuery);
+    {
+        cmd->queryHeap  = &queryHeapNull;
+        cmd->query      = query;
+    }
 }
 
 void NullCommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t query, const RenderConditionMode mode)
 {
     //auto& queryHeapNull = LLGL_CAST(NullQueryHeap&, queryHeap);
     //todo
+    profile_.commandBufferRecord.renderConditionSections++;
+}
+
+void NullCommandBuffer::BeginRenderCondition(Buffer& buffer, std::uint64_t offset, const RenderConditionMode mode)
+{
+    //todo
+    profile_.commandBufferRecord.renderConditionSections++;
 }
 
 void NullCommandBuffer::EndRenderCondition()
@@ -406,11 +572,31 @@ void NullCommandBuffer::EndRenderCondition()
     //todo
 }
 
+void NullCommandBuffer::ResolveQueries(
+    QueryHeap&      queryHeap,
+    std::uint32_t   firstQuery,
+    std::uint32_t   numQueries,
+    Buffer&         dstBuffer,
+    std::uint64_t   dstOffset)
+{
+    auto& queryHeapNull = LLGL_CAST(NullQueryHeap&, queryHeap);
+    auto& dstBufferNull = LLGL_CAST(NullBuffer&, dstBuffer);
+    auto cmd = AllocCommand<NullCmdResolveQueries>(NullOpcodeResolveQueries);
+    {
+        cmd->queryHeap  = &queryHeapNull;
+        cmd->firstQuery = firstQuery;
+        cmd->numQueries = numQueries;
+        cmd->dstBuffer  = &dstBufferNull;
+        cmd->dstOffset  = dstOffset;
+    }
+}
+
 /* ----- Stream Output ------ */
 
 void NullCommandBuffer::BeginStreamOutput(std::uint32_t numBuffers, Buffer* const * buffers)
 {
     // dummy
+    profile_.commandBufferRecord.streamOutputSections++;
 }
 
 void NullCommandBuffer::EndStreamOutput()
@@ -541,6 +727,20 @@ void NullCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::
     }
 }
 
+void NullCommandBuffer::DrawIndirect(
+    Buffer&         buffer,
+    std::uint64_t   offset,
+    Buffer&         countBuffer,
+    std::uint64_t   countBufferOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    auto& countBufferNull = LLGL_CAST(NullBuffer&, countBuffer);
+    std::uint32_t numCommands = 0;
+    countBufferNull.Read(countBufferOffset, &numCommands, sizeof(numCommands));
+    DrawIndirect(buffer, offset, std::min(numCommands, maxNumCommands), stride);
+}
+
 void NullCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
 {
     auto& bufferNull = LLGL_CAST(NullBuffer&, buffer);
@@ -561,14 +761,65 @@ void NullCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset
     }
 }
 
+void NullCommandBuffer::DrawIndexedIndirect(
+    Buffer&         buffer,
+    std::uint64_t   offset,
+    Buffer&         countBuffer,
+    std::uint64_t   countBufferOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    auto& countBufferNull = LLGL_CAST(NullBuffer&, countBuffer);
+    std::uint32_t numCommands = 0;
+    countBufferNull.Read(countBufferOffset, &numCommands, sizeof(numCommands));
+    DrawIndexedIndirect(buffer, offset, std::min(numCommands, maxNumCommands), stride);
+}
+
+void NullCommandBuffer::DrawStreamOutput()
+{
+    // dummy
+    profile_.commandBufferRecord.drawCommands++;
+}
+
+void NullCommandBuffer::DrawMesh(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
+{
+    // dummy
+    profile_.commandBufferRecord.drawCommands++;
+}
+
+void NullCommandBuffer::DrawMeshIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    // dummy
+    profile_.commandBufferRecord.drawCommands += numCommands;
+}
+
 /* ----- Compute ----- */
 
 void NullCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
 {
     // dummy
+    profile_.commandBufferRecord.dispatchCommands++;
 }
 
 void NullCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    // dummy
+    profile_.commandBufferRecord.dispatchCommands++;
+}
+
+/* ----- Ray Tracing ----- */
+
+void NullCommandBuffer::BuildAccelerationStructure(const AccelerationStructureBuildDescriptor& /*buildDesc*/)
+{
+    // dummy
+}
+
+void NullCommandBuffer::CopyAccelerationStructure(Buffer& /*dst*/, Buffer& /*src*/, const AccelerationStructureCopyMode /*mode*/)
+{
+    // dummy
+}
+
+void NullCommandBuffer::WriteAccelerationStructureCompactedSize(Buffer& /*src*/, Buffer& /*dstBuffer*/, std::uint64_t /*dstOffset*/)
 {
     // dummy
 }
@@ -580,6 +831,7 @@ void NullCommandBuffer::PushDebugGroup(const char* name)
     const std::size_t length = ::strlen(name);
     auto cmd = AllocCommand<NullCmdPushDebugGroup>(NullOpcodePushDebugGroup, length + 1);
     {
+        cmd->length = length;
         ::memcpy(cmd + 1, name, length + 1);
     }
 }
@@ -609,6 +861,8 @@ bool NullCommandBuffer::GetNativeHandle(void* nativeHandle, std::size_t nativeHa
 void NullCommandBuffer::ExecuteVirtualCommands()
 {
     ExecuteNullVirtualCommandBuffer(buffer_);
+    if (benchmark_ != nullptr && (desc.flags & CommandBufferFlags::Secondary) == 0)
+        benchmark_->RecordSubmit(profile_, uploadedBytes_, buffer_.Size());
     if ((desc.flags & CommandBufferFlags::MultiSubmit) == 0)
         buffer_.Clear();
 }
@@ -637,6 +891,7 @@ void NullCommandBuffer::AllocDrawCommand(const DrawIndirectArguments& args)
         cmd->numVertexBuffers   = renderState_.vertexBuffers.size();
         ::memcpy(cmd + 1, renderState_.vertexBuffers.data(), sizeof(const NullBuffer*) * renderState_.vertexBuffers.size());
     }
+    profile_.commandBufferRecord.drawCommands++;
 }
 
 void NullCommandBuffer::AllocDrawIndexedCommand(const DrawIndexedIndirectArguments& args)
@@ -650,6 +905,42 @@ void NullCommandBuffer::AllocDrawIndexedCommand(const DrawIndexedIndirectArgumen
         cmd->numVertexBuffers   = renderState_.vertexBuffers.size();
         ::memcpy(cmd + 1, renderState_.vertexBuffers.data(), sizeof(const NullBuffer*) * renderState_.vertexBuffers.size());
     }
+    profile_.commandBufferRecord.drawCommands++;
+}
+
+void NullCommandBuffer::CountResourceBinding(const Resource& resource)
+{
+    switch (resource.GetResourceType())
+    {
+        case ResourceType::Buffer:
+        {
+            auto& bufferNull = LLGL_CAST(const NullBuffer&, resource);
+            if ((bufferNull.desc.bindFlags & BindFlags::ConstantBuffer) != 0)
+                profile_.commandBufferRecord.constantBufferBindings++;
+            else if ((bufferNull.desc.bindFlags & BindFlags::Storage) != 0)
+                profile_.commandBufferRecord.storageBufferBindings++;
+            else
+                profile_.commandBufferRecord.sampledBufferBindings++;
+        }
+        break;
+
+        case ResourceType::Texture:
+        {
+            auto& textureNull = LLGL_CAST(const NullTexture&, resource);
+            if ((textureNull.desc.bindFlags & BindFlags::Storage) != 0)
+                profile_.commandBufferRecord.storageTextureBindings++;
+            else
+                profile_.commandBufferRecord.sampledTextureBindings++;
+        }
+        break;
+
+        case ResourceType::Sampler:
+            profile_.commandBufferRecord.samplerBindings++;
+            break;
+
+        default:
+            break;
+    }
 }
 
 
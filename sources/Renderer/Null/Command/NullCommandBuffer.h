@@ -10,6 +10,7 @@
 
 
 #include <LLGL/CommandBuffer.h>
+#include <LLGL/RenderingDebuggerFlags.h>
 #include <LLGL/Container/SmallVector.h>
 #include "NullCommandOpcode.h"
 #include "../../VirtualCommandBuffer.h"
@@ -20,6 +21,7 @@ namespace LLGL
 
 
 class NullBuffer;
+class NullBenchmark;
 
 using NullVirtualCommandBuffer = VirtualCommandBuffer<NullOpcode>;
 
@@ -32,11 +34,11 @@ class NullCommandBuffer final : public CommandBuffer
 
     public:
 
-        NullCommandBuffer(const CommandBufferDescriptor& desc);
+        NullCommandBuffer(const CommandBufferDescriptor& desc, NullBenchmark* benchmark = nullptr);
 
     public:
 
-        // Executes the internal virtual command buffer.
+        // Executes the internal virtual command buffer and passes the counters of this command buffer to the benchmark, unless this is a secondary command buffer.
         void ExecuteVirtualCommands();
 
     public:
@@ -67,11 +69,18 @@ class NullCommandBuffer final : public CommandBuffer
         void AllocDrawCommand(const DrawIndirectArguments& args);
         void AllocDrawIndexedCommand(const DrawIndexedIndirectArguments& args);
 
+        // Increments the binding counter for the type of the specified resource.
+        void CountResourceBinding(const Resource& resource);
+
     private:
 
         NullVirtualCommandBuffer    buffer_;
         RenderState                 renderState_;
 
+        NullBenchmark*              benchmark_      = nullptr;
+        FrameProfile                profile_;                   // Commands encoded since the last call to Begin(); counted regardless of the benchmark mode.
+        std::uint64_t               uploadedBytes_  = 0;
+
 };
 
 
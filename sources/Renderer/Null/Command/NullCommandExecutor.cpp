@@ -68,6 +68,24 @@ static std::size_t ExecuteNullCommand(const NullOpcode opcode, const void* pc)
             return sizeof(*cmd);
         }
         //TODO...
+        case NullOpcodeBeginQuery:
+        {
+            auto cmd = reinterpret_cast<const NullCmdQuery*>(pc);
+            cmd->queryHeap->Begin(cmd->query);
+            return sizeof(*cmd);
+        }
+        case NullOpcodeEndQuery:
+        {
+            auto cmd = reinterpret_cast<const NullCmdQuery*>(pc);
+            cmd->queryHeap->End(cmd->query);
+            return sizeof(*cmd);
+        }
+        case NullOpcodeResolveQueries:
+        {
+            auto cmd = reinterpret_cast<const NullCmdResolveQueries*>(pc);
+            cmd->queryHeap->ResolveResults(cmd->firstQuery, cmd->numQueries, *(cmd->dstBuffer), cmd->dstOffset);
+            return sizeof(*cmd);
+        }
         case NullOpcodeDraw:
         {
             auto cmd = reinterpret_cast<const NullCmdDraw*>(pc);
@@ -22,6 +22,9 @@ enum NullOpcode : std::uint8_t
     NullOpcodeCopySubresource,
     NullOpcodeGenerateMips,
     //TODO
+    NullOpcodeBeginQuery,
+    NullOpcodeEndQuery,
+    NullOpcodeResolveQueries,
     NullOpcodeDraw,
     NullOpcodeDrawIndexed,
     NullOpcodePushDebugGroup,
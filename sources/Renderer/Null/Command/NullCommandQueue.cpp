@@ -8,14 +8,23 @@
 #include "NullCommandQueue.h"
 #include "NullCommandBuffer.h"
 #include "NullCommandExecutor.h"
+#include "../NullBenchmark.h"
 #include "../RenderState/NullQueryHeap.h"
+#include "../RenderState/NullFence.h"
 #include "../../CheckedCast.h"
+#include <LLGL/QueryHeapFlags.h>
+#include <LLGL/Timer.h>
 
 
 namespace LLGL
 {
 
 
+NullCommandQueue::NullCommandQueue(NullBenchmark* benchmark) :
+    benchmark_ { benchmark }
+{
+}
+
 /* ----- Command Buffers ----- */
 
 void NullCommandQueue::Submit(CommandBuffer& commandBuffer)
@@ -29,21 +38,83 @@ void NullCommandQueue::Submit(CommandBuffer& commandBuffer)
 
 bool NullCommandQueue::QueryResult(QueryHeap& queryHeap, std::uint32_t firstQuery, std::uint32_t numQueries, void* data, std::size_t dataSize)
 {
-    //auto& queryHeapNull = LLGL_CAST(NullQueryHeap&, queryHeap);
-    //todo
-    return false;
+    auto& queryHeapNull = LLGL_CAST(NullQueryHeap&, queryHeap);
+
+    /* All commands are executed on submission, so query results are always available */
+    if (dataSize == numQueries * sizeof(std::uint32_t))
+    {
+        auto* dst = reinterpret_cast<std::uint32_t*>(data);
+        for (std::uint32_t i = 0; i < numQueries; ++i)
+            dst[i] = static_cast<std::uint32_t>(queryHeapNull.GetResult(firstQuery + i));
+    }
+    else if (dataSize == numQueries * sizeof(std::uint64_t))
+    {
+        auto* dst = reinterpret_cast<std::uint64_t*>(data);
+        for (std::uint32_t i = 0; i < numQueries; ++i)
+            dst[i] = queryHeapNull.GetResult(firstQuery + i);
+    }
+    else if (dataSize == numQueries * sizeof(QueryPipelineStatistics))
+    {
+        /* No primitives are processed by the Null renderer */
+        auto* dst = reinterpret_cast<QueryPipelineStatistics*>(data);
+        for (std::uint32_t i = 0; i < numQueries; ++i)
+            dst[i] = QueryPipelineStatistics{};
+    }
+    else
+        return false;
+
+    return true;
+}
+
+bool NullCommandQueue::QueryTimestampCalibration(TimestampCalibration& outCalibration)
+{
+    /* Timestamp queries are taken from the CPU timer, so both timestamps are in the same time domain */
+    const std::uint64_t tick = Timer::Tick();
+    outCalibration.cpuTick      = tick;
+    outCalibration.gpuTimestamp = NullQueryHeap::TicksToNanoseconds(tick);
+    outCalibration.maxDeviation = 0;
+    return true;
 }
 
 /* ----- Fences ----- */
 
 void NullCommandQueue::Submit(Fence& fence)
 {
-    //todo
+    /* All commands are executed on submission, so the fence is signaled immediately */
+    auto& fenceNull = LLGL_CAST(NullFence&, fence);
+    fenceNull.Signal(fenceNull.GetCompletedValue() + 1);
+    if (benchmark_ != nullptr)
+        benchmark_->RecordFence();
+}
+
+void NullCommandQueue::SubmitWait(Fence& /*fence*/)
+{
+    // dummy - all commands are executed on a single queue
+}
+
+bool NullCommandQueue::WaitFence(Fence& /*fence*/, std::uint64_t /*timeout*/)
+{
+    /* All previously submitted commands have already been executed */
+    return true;
+}
+
+void NullCommandQueue::Submit(Fence& fence, std::uint64_t value)
+{
+    auto& fenceNull = LLGL_CAST(NullFence&, fence);
+    fenceNull.Signal(value);
+    if (benchmark_ != nullptr)
+        benchmark_->RecordFence();
+}
+
+void NullCommandQueue::SubmitWait(Fence& /*fence*/, std::uint64_t /*value*/)
+{
+    // dummy - all commands are executed on a single queue
 }
 
-bool NullCommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
+bool NullCommandQueue::WaitFence(Fence& fence, std::uint64_t value, std::uint64_t timeout)
 {
-    return false; //todo
+    auto& fenceNull = LLGL_CAST(NullFence&, fence);
+    return fenceNull.WaitForSignal(value, timeout);
 }
 
 void NullCommandQueue::WaitIdle()
@@ -16,6 +16,8 @@ namespace LLGL
 {
 
 
+class NullBenchmark;
+
 class NullCommandQueue final : public CommandQueue
 {
 
@@ -23,6 +25,14 @@ class NullCommandQueue final : public CommandQueue
 
         #include <LLGL/Backend/CommandQueue.inl>
 
+    public:
+
+        NullCommandQueue(NullBenchmark* benchmark = nullptr);
+
+    private:
+
+        NullBenchmark* benchmark_ = nullptr;
+
 };
 
 
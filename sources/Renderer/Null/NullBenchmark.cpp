@@ -0,0 +1,83 @@
+/*
+ * NullBenchmark.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "NullBenchmark.h"
+#include <LLGL/RenderingDebugger.h>
+#include <LLGL/Timer.h>
+#include <thread>
+#include <chrono>
+
+
+namespace LLGL
+{
+
+
+static void SleepForMicroseconds(std::uint32_t latency)
+{
+    if (latency > 0)
+        std::this_thread::sleep_for(std::chrono::microseconds(latency));
+}
+
+NullBenchmark::NullBenchmark(const RendererConfigurationNull& config) :
+    submitLatency_  { config.submitLatency  },
+    presentLatency_ { config.presentLatency },
+    frameCallback_  { config.frameCallback  },
+    frameUserData_  { config.frameUserData  },
+    frameStartTick_ { Timer::Tick()         }
+{
+}
+
+void NullBenchmark::RecordSubmit(const FrameProfile& profile, std::uint64_t uploadedBytes, std::uint64_t submittedBytes)
+{
+    {
+        std::lock_guard<std::mutex> guard{ mutex_ };
+        RenderingDebugger::MergeProfiles(frame_.profile, profile);
+        frame_.profile.commandQueueRecord.commandBufferSubmittions++;
+        frame_.uploadedBytes    += uploadedBytes;
+        frame_.submittedBytes   += submittedBytes;
+    }
+    SleepForMicroseconds(submitLatency_);
+}
+
+void NullBenchmark::RecordFence()
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    frame_.profile.commandQueueRecord.fenceSubmissions++;
+}
+
+void NullBenchmark::RecordQueueOperation(std::uint32_t ProfileCommandQueueRecord::*counter, std::uint64_t uploadedBytes)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    (frame_.profile.commandQueueRecord.*counter)++;
+    frame_.uploadedBytes += uploadedBytes;
+}
+
+void NullBenchmark::Present()
+{
+    SleepForMicroseconds(presentLatency_);
+
+    NullFrameStatistics statistics;
+    {
+        std::lock_guard<std::mutex> guard{ mutex_ };
+        const std::uint64_t frameEndTick = Timer::Tick();
+        statistics              = std::move(frame_);
+        statistics.frameTime    = (frameEndTick - frameStartTick_) * 1000000000ull / Timer::Frequency();
+        frame_                  = {};
+        frameStartTick_         = frameEndTick;
+    }
+
+    /* Invoke callback outside the lock, so it can query other objects of the render system */
+    if (frameCallback_ != nullptr)
+        frameCallback_(statistics, frameUserData_);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,66 @@
+/*
+ * NullBenchmark.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_NULL_BENCHMARK_H
+#define LLGL_NULL_BENCHMARK_H
+
+
+#include <LLGL/RendererConfiguration.h>
+#include <LLGL/RenderingDebuggerFlags.h>
+#include <mutex>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+Collects the per-frame statistics of the Null renderer in benchmark mode and simulates the configured fake latencies.
+Command buffers count their commands while they are encoded and hand their counters over when they are submitted,
+so this object is only locked once per submission and can be shared between threads.
+*/
+class NullBenchmark
+{
+
+    public:
+
+        NullBenchmark(const RendererConfigurationNull& config);
+
+        // Merges the counters of a submitted command buffer into the current frame and blocks for the submit latency.
+        void RecordSubmit(const FrameProfile& profile, std::uint64_t uploadedBytes, std::uint64_t submittedBytes);
+
+        // Records a fence submission.
+        void RecordFence();
+
+        // Records a buffer or texture operation outside of command encoding. The counter is one of the members of ProfileCommandQueueRecord.
+        void RecordQueueOperation(std::uint32_t ProfileCommandQueueRecord::*counter, std::uint64_t uploadedBytes = 0);
+
+        // Passes the statistics of the current frame to the frame callback, blocks for the present latency, and starts a new frame.
+        void Present();
+
+    private:
+
+        std::mutex                  mutex_;
+        const std::uint32_t         submitLatency_      = 0;
+        const std::uint32_t         presentLatency_     = 0;
+        const NullFrameCallback     frameCallback_      = nullptr;
+        void* const                 frameUserData_      = nullptr;
+        NullFrameStatistics         frame_;
+        std::uint64_t               frameStartTick_     = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -6,6 +6,7 @@
  */
 
 #include "NullRenderSystem.h"
+#include "../RenderSystemUtils.h"
 #include "../../Core/CoreUtils.h"
 #include <LLGL/Utils/ForRange.h>
 #include <limits.h>
@@ -55,15 +56,22 @@ static void InitNullRendererFeatures(RenderingFeatures& features)
     features.hasTessellationShaders         = false;
     features.hasTessellatorStage            = false;
     features.hasComputeShaders              = false;
+    features.hasMeshShaders                 = false;
+    features.hasRayTracing                  = false;
     features.hasInstancing                  = true;
     features.hasOffsetInstancing            = true;
     features.hasIndirectDrawing             = true;
+    features.hasIndirectDrawCount           = true;
     features.hasViewportArrays              = true;
     features.hasConservativeRasterization   = false;
     features.hasStreamOutputs               = false;
     features.hasLogicOp                     = true;
     features.hasPipelineStatistics          = true;
     features.hasRenderCondition             = true;
+    features.hasBufferRenderCondition       = true;
+    features.hasSubpasses                   = true;
+    features.hasVariableRateShading         = false;
+    features.hasTimestampCalibration        = true;
 }
 
 static void InitNullRendererLimits(RenderingLimits& limits)
@@ -118,9 +126,20 @@ static RendererInfo GetNullRenderInfo()
     return info;
 }
 
+static std::unique_ptr<NullBenchmark> CreateNullBenchmark(const RenderSystemDescriptor& renderSystemDesc)
+{
+    if (auto* rendererConfigNull = GetRendererConfiguration<RendererConfigurationNull>(renderSystemDesc))
+    {
+        if (rendererConfigNull->enableBenchmark)
+            return MakeUnique<NullBenchmark>(*rendererConfigNull);
+    }
+    return nullptr;
+}
+
 NullRenderSystem::NullRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
-    desc_         { renderSystemDesc               },
-    commandQueue_ { MakeUnique<NullCommandQueue>() }
+    desc_         { renderSystemDesc                                  },
+    benchmark_    { CreateNullBenchmark(renderSystemDesc)             },
+    commandQueue_ { MakeUnique<NullCommandQueue>(benchmark_.get())    }
 {
     SetRendererInfo(GetNullRenderInfo());
     SetRenderingCaps(GetNullRenderingCaps());
@@ -130,7 +149,7 @@ NullRenderSystem::NullRenderSystem(const RenderSystemDescriptor& renderSystemDes
 
 SwapChain* NullRenderSystem::CreateSwapChain(const SwapChainDescriptor& swapChainDesc, const std::shared_ptr<Surface>& surface)
 {
-    return swapChains_.emplace<NullSwapChain>(swapChainDesc, surface);
+    return swapChains_.emplace<NullSwapChain>(swapChainDesc, surface, benchmark_.get());
 }
 
 void NullRenderSystem::Release(SwapChain& swapChain)
@@ -145,11 +164,17 @@ CommandQueue* NullRenderSystem::GetCommandQueue()
     return commandQueue_.get();
 }
 
+CommandQueue* NullRenderSystem::GetCommandQueue(long /*queueFlags*/)
+{
+    /* Only a single command queue is supported */
+    return commandQueue_.get();
+}
+
 /* ----- Command buffers ----- */
 
 CommandBuffer* NullRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& commandBufferDesc)
 {
-    return commandBuffers_.emplace<NullCommandBuffer>(commandBufferDesc);
+    return commandBuffers_.emplace<NullCommandBuffer>(commandBufferDesc, benchmark_.get());
 }
 
 void NullRenderSystem::Release(CommandBuffer& commandBuffer)
@@ -185,23 +210,31 @@ void NullRenderSystem::WriteBuffer(Buffer& buffer, std::uint64_t offset, const v
 {
     auto& bufferNull = LLGL_CAST(NullBuffer&, buffer);
     bufferNull.Write(offset, data, dataSize);
+    if (benchmark_ != nullptr)
+        benchmark_->RecordQueueOperation(&ProfileCommandQueueRecord::bufferWrites, dataSize);
 }
 
 void NullRenderSystem::ReadBuffer(Buffer& buffer, std::uint64_t offset, void* data, std::uint64_t dataSize)
 {
     auto& bufferNull = LLGL_CAST(NullBuffer&, buffer);
     bufferNull.Read(offset, data, dataSize);
+    if (benchmark_ != nullptr)
+        benchmark_->RecordQueueOperation(&ProfileCommandQueueRecord::bufferReads);
 }
 
 void* NullRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access)
 {
     auto& bufferNull = LLGL_CAST(NullBuffer&, buffer);
+    if (benchmark_ != nullptr)
+        benchmark_->RecordQueueOperation(&ProfileCommandQueueRecord::bufferMappings);
     return bufferNull.Map(access, 0, bufferNull.desc.size);
 }
 
 void* NullRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access, std::uint64_t offset, std::uint64_t length)
 {
     auto& bufferNull = LLGL_CAST(NullBuffer&, buffer);
+    if (benchmark_ != nullptr)
+        benchmark_->RecordQueueOperation(&ProfileCommandQueueRecord::bufferMappings);
     return bufferNull.Map(access, offset, length);
 }
 
@@ -227,19 +260,23 @@ void NullRenderSystem::WriteTexture(Texture& texture, const TextureRegion& textu
 {
     auto& textureNull = LLGL_CAST(NullTexture&, texture);
     textureNull.Write(textureRegion, srcImageDesc);
+    if (benchmark_ != nullptr)
+        benchmark_->RecordQueueOperation(&ProfileCommandQueueRecord::textureWrites, srcImageDesc.dataSize);
 }
 
 void NullRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureRegion, const MutableImageView& dstImageView)
 {
     auto& textureNull = LLGL_CAST(NullTexture&, texture);
     textureNull.Read(textureRegion, dstImageView);
+    if (benchmark_ != nullptr)
+        benchmark_->RecordQueueOperation(&ProfileCommandQueueRecord::textureReads);
 }
 
 /* ----- Sampler States ---- */
 
 Sampler* NullRenderSystem::CreateSampler(const SamplerDescriptor& samplerDesc)
 {
-    return samplers_.emplace<NullSampler>(samplerDesc);
+    return samplers_.emplace(samplerDesc, samplerDesc);
 }
 
 void NullRenderSystem::Release(Sampler& sampler)
@@ -293,11 +330,25 @@ void NullRenderSystem::Release(RenderTarget& renderTarget)
 
 Shader* NullRenderSystem::CreateShader(const ShaderDescriptor& shaderDesc)
 {
-    return shaders_.emplace<NullShader>(shaderDesc);
+    return shaders_.emplace_concurrent<NullShader>(shadersMutex_, shaderDesc);
+}
+
+std::uint32_t NullRenderSystem::CreateShaders(const ArrayView<ShaderDescriptor>& shaderDescs, Shader** outShaders)
+{
+    return CreateShaderBatch(
+        shaderDescs,
+        outShaders,
+        [this](const ShaderDescriptor& shaderDesc) -> Shader*
+        {
+            return CreateShader(shaderDesc);
+        },
+        /*concurrent:*/ false
+    );
 }
 
 void NullRenderSystem::Release(Shader& shader)
 {
+    std::lock_guard<std::mutex> guard{ shadersMutex_ };
     shaders_.erase(&shader);
 }
 
@@ -305,7 +356,7 @@ void NullRenderSystem::Release(Shader& shader)
 
 PipelineLayout* NullRenderSystem::CreatePipelineLayout(const PipelineLayoutDescriptor& pipelineLayoutDesc)
 {
-    return pipelineLayouts_.emplace<NullPipelineLayout>(pipelineLayoutDesc);
+    return pipelineLayouts_.emplace(pipelineLayoutDesc, pipelineLayoutDesc);
 }
 
 void NullRenderSystem::Release(PipelineLayout& pipelineLayout)
@@ -329,16 +380,17 @@ void NullRenderSystem::Release(PipelineCache& pipelineCache)
 
 PipelineState* NullRenderSystem::CreatePipelineState(const GraphicsPipelineDescriptor& pipelineStateDesc, PipelineCache* /*pipelineCache*/)
 {
-    return pipelineStates_.emplace<NullPipelineState>(pipelineStateDesc);
+    return pipelineStates_.emplace_concurrent<NullPipelineState>(pipelineStatesMutex_, pipelineStateDesc);
 }
 
 PipelineState* NullRenderSystem::CreatePipelineState(const ComputePipelineDescriptor& pipelineStateDesc, PipelineCache* /*pipelineCache*/)
 {
-    return pipelineStates_.emplace<NullPipelineState>(pipelineStateDesc);
+    return pipelineStates_.emplace_concurrent<NullPipelineState>(pipelineStatesMutex_, pipelineStateDesc);
 }
 
 void NullRenderSystem::Release(PipelineState& pipelineState)
 {
+    std::lock_guard<std::mutex> guard{ pipelineStatesMutex_ };
     pipelineStates_.erase(&pipelineState);
 }
 
@@ -373,6 +425,47 @@ bool NullRenderSystem::GetNativeHandle(void* nativeHandle, std::size_t nativeHan
     return (nativeHandle == nullptr || nativeHandleSize == 0); // dummy
 }
 
+std::uint32_t NullRenderSystem::QueryMemoryHeaps(MemoryHeapInfo* /*outHeapInfos*/, std::uint32_t /*maxNumHeaps*/)
+{
+    return 0; // dummy
+}
+
+std::uint32_t NullRenderSystem::GetBindlessDescriptorIndex(const Resource& /*resource*/, long /*bindFlags*/)
+{
+    return LLGL_INVALID_SLOT; // dummy
+}
+
+bool NullRenderSystem::GetSparseTextureProperties(const Texture& /*texture*/, SparseTextureProperties& /*outProperties*/)
+{
+    return false; // dummy
+}
+
+bool NullRenderSystem::CommitTextureTiles(Texture& /*texture*/, const TextureRegion& /*textureRegion*/, bool /*commit*/)
+{
+    return false; // dummy
+}
+
+bool NullRenderSystem::MakeResident(const ArrayView<Resource*>& /*resources*/)
+{
+    return true; // dummy
+}
+
+void NullRenderSystem::Evict(const ArrayView<Resource*>& /*resources*/)
+{
+    // dummy
+}
+
+
+bool NullRenderSystem::GetAccelerationStructureSizes(const AccelerationStructureBuildDescriptor& /*buildDesc*/, AccelerationStructureSizes& /*outSizes*/)
+{
+    return false; // dummy
+}
+
+std::uint64_t NullRenderSystem::GetAccelerationStructureAddress(const Buffer& /*buffer*/)
+{
+    return 0; // dummy
+}
+
 
 } // /namespace LLGL
 
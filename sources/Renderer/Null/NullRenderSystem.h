@@ -11,6 +11,7 @@
 
 #include <LLGL/RenderSystem.h>
 #include "NullSwapChain.h"
+#include "NullBenchmark.h"
 #include "Command/NullCommandBuffer.h"
 #include "Command/NullCommandQueue.h"
 #include "Buffer/NullBuffer.h"
@@ -28,6 +29,9 @@
 #include "../ProxyPipelineCache.h"
 
 #include "../ContainerTypes.h"
+#include "../PipelineLayoutCache.h"
+#include "../SamplerCache.h"
+#include <mutex>
 
 
 namespace LLGL
@@ -50,6 +54,7 @@ class NullRenderSystem final : public RenderSystem
         /* ----- Common objects ----- */
 
         const RenderSystemDescriptor            desc_;
+        std::unique_ptr<NullBenchmark>          benchmark_;         // Only allocated if RendererConfigurationNull::enableBenchmark is true.
 
         /* ----- Hardware object containers ----- */
 
@@ -57,16 +62,18 @@ class NullRenderSystem final : public RenderSystem
         HWObjectInstance<NullCommandQueue>      commandQueue_;
         HWObjectContainer<NullCommandBuffer>    commandBuffers_;
         HWObjectContainer<NullBuffer>           buffers_;
-        HWObjectContainer<NullBufferArray>      bufferArrays_;
+        HWObjectPool<NullBufferArray>           bufferArrays_;
         HWObjectContainer<NullTexture>          textures_;
         HWObjectContainer<NullRenderPass>       renderPasses_;
         HWObjectContainer<NullRenderTarget>     renderTargets_;
         HWObjectContainer<NullShader>           shaders_;
-        HWObjectContainer<NullPipelineLayout>   pipelineLayouts_;
+        std::mutex                              shadersMutex_;          // Shaders can be created and released concurrently.
+        PipelineLayoutCache<NullPipelineLayout> pipelineLayouts_;
         HWObjectInstance<ProxyPipelineCache>    pipelineCacheProxy_;
         HWObjectContainer<NullPipelineState>    pipelineStates_;
+        std::mutex                              pipelineStatesMutex_;   // PSOs can be created and released concurrently.
         HWObjectContainer<NullResourceHeap>     resourceHeaps_;
-        HWObjectContainer<NullSampler>          samplers_;
+        SamplerCache<NullSampler>               samplers_;
         HWObjectContainer<NullQueryHeap>        queryHeaps_;
         HWObjectContainer<NullFence>            fences_;
 
@@ -6,6 +6,7 @@
  */
 
 #include "NullSwapChain.h"
+#include "NullBenchmark.h"
 
 
 namespace LLGL
@@ -35,11 +36,12 @@ static Format ChooseDepthStencilFormat(int depthBits, int stencilBits)
     }
 }
 
-NullSwapChain::NullSwapChain(const SwapChainDescriptor& desc, const std::shared_ptr<Surface>& surface) :
+NullSwapChain::NullSwapChain(const SwapChainDescriptor& desc, const std::shared_ptr<Surface>& surface, NullBenchmark* benchmark) :
     SwapChain           { desc                                                       },
     samples_            { desc.samples                                               },
     colorFormat_        { ChooseColorFormat(desc.colorBits)                          },
-    depthStencilFormat_ { ChooseDepthStencilFormat(desc.depthBits, desc.stencilBits) }
+    depthStencilFormat_ { ChooseDepthStencilFormat(desc.depthBits, desc.stencilBits) },
+    benchmark_          { benchmark                                                  }
 {
     SetOrCreateSurface(surface, desc.resolution, desc.fullscreen, nullptr);
     if (desc.debugName != nullptr)
@@ -56,7 +58,8 @@ void NullSwapChain::SetDebugName(const char* name)
 
 void NullSwapChain::Present()
 {
-    // dummy
+    if (benchmark_ != nullptr)
+        benchmark_->Present();
 }
 
 std::uint32_t NullSwapChain::GetCurrentSwapIndex() const
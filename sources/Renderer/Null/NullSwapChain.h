@@ -17,12 +17,14 @@ namespace LLGL
 {
 
 
+class NullBenchmark;
+
 class NullSwapChain final : public SwapChain
 {
 
     public:
 
-        NullSwapChain(const SwapChainDescriptor& desc, const std::shared_ptr<Surface>& surface);
+        NullSwapChain(const SwapChainDescriptor& desc, const std::shared_ptr<Surface>& surface, NullBenchmark* benchmark = nullptr);
 
     public:
 
@@ -53,6 +55,7 @@ class NullSwapChain final : public SwapChain
         Format              depthStencilFormat_ = Format::Undefined;
         std::uint32_t       vsyncInterval_      = 0;
         const RenderPass*   renderPass_         = nullptr;
+        NullBenchmark*      benchmark_          = nullptr;
 
 };
 
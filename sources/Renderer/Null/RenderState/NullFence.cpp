@@ -22,15 +22,28 @@ void NullFence::SetDebugName(const char* name)
         label_.clear();
 }
 
+std::uint64_t NullFence::GetCompletedValue()
+{
+    return signal_;
+}
+
 void NullFence::Signal(std::uint64_t signal)
 {
     signal_ = signal;
 }
 
-void NullFence::WaitForSignal(std::uint64_t signal)
+bool NullFence::WaitForSignal(std::uint64_t signal, std::uint64_t timeout)
 {
-    while (signal_ != signal)
+    /* Commands are executed on submission, so only signals from other threads are waited for */
+    const auto startTime = std::chrono::steady_clock::now();
+    while (signal_ < signal)
+    {
+        const auto elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime);
+        if (static_cast<std::uint64_t>(elapsedTime.count()) >= timeout)
+            return false;
         std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
 }
 
 NullFence::NullFence(std::uint64_t initialSignal) :
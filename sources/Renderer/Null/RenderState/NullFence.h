@@ -26,13 +26,16 @@ class NullFence final : public Fence
 
         void SetDebugName(const char* name) override;
 
+        std::uint64_t GetCompletedValue() override;
+
     public:
 
         NullFence(std::uint64_t initialSignal = 0);
 
         void Signal(std::uint64_t signal);
 
-        void WaitForSignal(std::uint64_t signal);
+        // Waits until this fence has been signaled with the specified value or a higher value. Returns false on timeout (in nanoseconds).
+        bool WaitForSignal(std::uint64_t signal, std::uint64_t timeout = ~0ull);
 
     private:
 
@@ -6,6 +6,8 @@
  */
 
 #include "NullQueryHeap.h"
+#include "../Buffer/NullBuffer.h"
+#include <LLGL/Timer.h>
 
 
 namespace LLGL
@@ -16,6 +18,8 @@ NullQueryHeap::NullQueryHeap(const QueryHeapDescriptor& desc) :
     QueryHeap { desc.type },
     desc      { desc      }
 {
+    beginTicks_.resize(desc.numQueries, 0);
+    results_.resize(desc.numQueries, 0);
     if (desc.debugName != nullptr)
         SetDebugName(desc.debugName);
 }
@@ -28,6 +32,41 @@ void NullQueryHeap::SetDebugName(const char* name)
         label_.clear();
 }
 
+void NullQueryHeap::Begin(std::uint32_t query)
+{
+    if (desc.type == QueryType::TimeElapsed)
+        beginTicks_[query] = Timer::Tick();
+}
+
+void NullQueryHeap::End(std::uint32_t query)
+{
+    if (desc.type == QueryType::TimeElapsed)
+    {
+        const std::uint64_t elapsedTicks = Timer::Tick() - beginTicks_[query];
+        results_[query] = TicksToNanoseconds(elapsedTicks);
+    }
+    else if (desc.type == QueryType::Timestamp)
+        results_[query] = TicksToNanoseconds(Timer::Tick());
+}
+
+void NullQueryHeap::ResolveResults(std::uint32_t firstQuery, std::uint32_t numQueries, NullBuffer& dstBuffer, std::uint64_t dstOffset) const
+{
+    if (desc.type == QueryType::PipelineStatistics)
+    {
+        /* No primitives are processed by the Null renderer */
+        const QueryPipelineStatistics stats;
+        for (std::uint32_t i = 0; i < numQueries; ++i)
+            dstBuffer.Write(dstOffset + i * sizeof(stats), &stats, sizeof(stats));
+    }
+    else
+        dstBuffer.Write(dstOffset, &results_[firstQuery], numQueries * sizeof(std::uint64_t));
+}
+
+std::uint64_t NullQueryHeap::TicksToNanoseconds(std::uint64_t ticks)
+{
+    return static_cast<std::uint64_t>(static_cast<double>(ticks) * 1.0e9 / static_cast<double>(Timer::Frequency()));
+}
+
 
 } // /namespace LLGL
 
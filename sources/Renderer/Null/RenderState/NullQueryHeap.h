@@ -12,12 +12,15 @@
 #include <LLGL/QueryHeap.h>
 #include <vector>
 #include <string>
+#include <cstdint>
 
 
 namespace LLGL
 {
 
 
+class NullBuffer;
+
 class NullQueryHeap final : public QueryHeap
 {
 
@@ -29,13 +32,33 @@ class NullQueryHeap final : public QueryHeap
 
         NullQueryHeap(const QueryHeapDescriptor& desc);
 
+        // Starts the specified query. Time queries take the current CPU tick of the high resolution timer.
+        void Begin(std::uint32_t query);
+
+        // Ends the specified query. Time queries store the elapsed CPU time (in nanoseconds) since the respective call to Begin(). Timestamp queries store the current CPU time (in nanoseconds).
+        void End(std::uint32_t query);
+
+        // Returns the result of the specified query. Only time queries have non-zero results, since the Null renderer does not rasterize any samples.
+        inline std::uint64_t GetResult(std::uint32_t query) const
+        {
+            return results_[query];
+        }
+
+        // Writes the results of the specified queries into the buffer. Pipeline statistics are written as zero-initialized QueryPipelineStatistics structures.
+        void ResolveResults(std::uint32_t firstQuery, std::uint32_t numQueries, NullBuffer& dstBuffer, std::uint64_t dstOffset) const;
+
+        // Converts the specified CPU ticks of the high resolution timer into nanoseconds. This is the time domain of timestamp queries.
+        static std::uint64_t TicksToNanoseconds(std::uint64_t ticks);
+
     public:
 
         const QueryHeapDescriptor desc;
 
     private:
 
-        std::string label_;
+        std::string                 label_;
+        std::vector<std::uint64_t>  beginTicks_;
+        std::vector<std::uint64_t>  results_;
 
 };
 
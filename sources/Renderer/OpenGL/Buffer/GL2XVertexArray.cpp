@@ -34,6 +34,8 @@ void GL2XVertexArray::BuildVertexAttribute(GLuint bufferID, const VertexAttribut
     const auto& formatAttribs = GetFormatAttribs(attribute.format);
     if ((formatAttribs.flags & FormatFlags::SupportsVertex) == 0)
         LLGL_TRAP_FEATURE_NOT_SUPPORTED("specified vertex attribute");
+    if ((formatAttribs.flags & FormatFlags::IsPacked) != 0)
+        LLGL_TRAP_FEATURE_NOT_SUPPORTED("packed vertex attributes");
 
     /* Convert offset to pointer sized type (for 32- and 64 bit builds) */
     auto dataType       = GLTypes::Map(formatAttribs.dataType);
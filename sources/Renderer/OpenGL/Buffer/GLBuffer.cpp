@@ -6,12 +6,15 @@
  */
 
 #include "GLBuffer.h"
+#include "GLStreamingBuffer.h"
+#include "GLVertexArrayCache.h"
 #include "../GLProfile.h"
 #include "../GLObjectUtils.h"
 #include "../Ext/GLExtensions.h"
 #include "../GLTypes.h"
 #include "../Ext/GLExtensionRegistry.h"
 #include "../../../Core/CoreUtils.h"
+#include <LLGL/Backend/OpenGL/NativeHandle.h>
 #include <memory>
 
 
@@ -54,14 +57,28 @@ GLBuffer::GLBuffer(long bindFlags, const char* debugName) :
         glGenBuffers(1, &id_);
     }
 
+    #ifdef LLGL_GLEXT_TRANSFORM_FEEDBACK2
+    if ((bindFlags & BindFlags::StreamOutputBuffer) != 0 && HasExtension(GLExt::ARB_transform_feedback2))
+    {
+        /* Create transform feedback object to draw the output of stream-output sections without knowing the number of vertices */
+        glGenTransformFeedbacks(1, &transformFeedbackID_);
+    }
+    #endif // /LLGL_GLEXT_TRANSFORM_FEEDBACK2
+
     if (debugName != nullptr)
         SetDebugName(debugName);
 }
 
 GLBuffer::~GLBuffer()
 {
+    #ifdef LLGL_GLEXT_TRANSFORM_FEEDBACK2
+    if (transformFeedbackID_ != 0)
+        glDeleteTransformFeedbacks(1, &transformFeedbackID_);
+    #endif // /LLGL_GLEXT_TRANSFORM_FEEDBACK2
     glDeleteBuffers(1, &id_);
     GLStateManager::Get().NotifyBufferRelease(*this);
+    if ((GetBindFlags() & BindFlags::VertexBuffer) != 0)
+        GLVertexArrayCache::Get().NotifyBufferRelease(id_);
 }
 
 void GLBuffer::SetDebugName(const char* name)
@@ -69,6 +86,18 @@ void GLBuffer::SetDebugName(const char* name)
     GLSetObjectLabel(GL_BUFFER, GetID(), name);
 }
 
+bool GLBuffer::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
+{
+    if (nativeHandle != nullptr && nativeHandleSize == sizeof(OpenGL::ResourceNativeHandle))
+    {
+        auto* nativeHandleGL = reinterpret_cast<OpenGL::ResourceNativeHandle*>(nativeHandle);
+        nativeHandleGL->id      = GetID();
+        nativeHandleGL->target  = GetGLTarget();
+        return true;
+    }
+    return false;
+}
+
 BufferDescriptor GLBuffer::GetDesc() const
 {
     /* Get buffer parameters */
@@ -104,6 +133,9 @@ BufferDescriptor GLBuffer::GetDesc() const
 
 void GLBuffer::BufferStorage(GLsizeiptr size, const void* data, GLbitfield flags, GLenum usage)
 {
+    /* Stream updates of dynamic buffers through a persistently mapped ring buffer if supported */
+    streamUpdates_ = (usage == GL_DYNAMIC_DRAW && GLStreamingBuffer::IsSupported());
+
     #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
     if (HasExtension(GLExt::ARB_direct_state_access))
     {
@@ -130,6 +162,9 @@ void GLBuffer::BufferStorage(GLsizeiptr size, const void* data, GLbitfield flags
 
 void GLBuffer::BufferSubData(GLintptr offset, GLsizeiptr size, const void* data)
 {
+    if (streamUpdates_ && GLStreamingBuffer::Get().WriteBufferSubData(*this, offset, size, data))
+        return;
+
     #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
     if (HasExtension(GLExt::ARB_direct_state_access))
     {
@@ -234,7 +269,7 @@ void GLBuffer::CopyBufferSubData(const GLBuffer& readBuffer, GLintptr readOffset
     }
     else
     #endif // /GL_ARB_direct_state_access
-    #ifdef GL_ARB_copy_buffer
+    #ifdef LLGL_GLEXT_COPY_BUFFER
     if (HasExtension(GLExt::ARB_copy_buffer))
     {
         /* Bind source and destination buffer for copy operation (GL 3.1+) */
@@ -243,7 +278,7 @@ void GLBuffer::CopyBufferSubData(const GLBuffer& readBuffer, GLintptr readOffset
         glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, readOffset, writeOffset, size);
     }
     else
-    #endif // /GL_ARB_copy_buffer
+    #endif // /LLGL_GLEXT_COPY_BUFFER
     {
         /* Emulate buffer copy operation */
         auto intermediateBuffer = MakeUniqueArray<char>(size);
@@ -311,6 +346,12 @@ void GLBuffer::UnmapBuffer()
     }
 }
 
+void GLBuffer::MapBufferPersistent(GLsizeiptr size, GLbitfield access)
+{
+    /* Buffer is unmapped implicitly when it's deleted */
+    persistentData_ = static_cast<char*>(MapBufferRange(0, size, access));
+}
+
 void GLBuffer::GetBufferParams(GLint* size, GLint* usage, GLint* storageFlags) const
 {
     #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
@@ -26,6 +26,7 @@ class GLBuffer : public Buffer
     public:
 
         void SetDebugName(const char* name) override final;
+        bool GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize) override final;
 
         BufferDescriptor GetDesc() const override;
 
@@ -48,6 +49,15 @@ class GLBuffer : public Buffer
         void* MapBufferRange(GLintptr offset, GLsizeiptr length, GLbitfield access);
         void UnmapBuffer();
 
+        // Maps the entire buffer for its remaining lifetime. This requires a buffer storage with GL_MAP_PERSISTENT_BIT.
+        void MapBufferPersistent(GLsizeiptr size, GLbitfield access);
+
+        // Returns the CPU memory space of a persistently mapped buffer or null if this buffer is not mapped persistently.
+        inline char* GetPersistentData() const
+        {
+            return persistentData_;
+        }
+
         // Returns the specified buffer parameters; null pointers are ignored.
         void GetBufferParams(GLint* size, GLint* usage, GLint* storageFlags) const;
 
@@ -78,11 +88,23 @@ class GLBuffer : public Buffer
             return indexType16Bits_;
         }
 
+        /*
+        Returns the transform feedback object that records how many vertices were written into this buffer by a stream-output section,
+        or 0 if this buffer was not created with BindFlags::StreamOutputBuffer or GL_ARB_transform_feedback2 is not supported.
+        */
+        inline GLuint GetTransformFeedbackID() const
+        {
+            return transformFeedbackID_;
+        }
+
     private:
 
-        GLuint          id_                 = 0;
-        GLBufferTarget  target_             = GLBufferTarget::ArrayBuffer;
-        bool            indexType16Bits_    = false;
+        GLuint          id_                     = 0;
+        GLuint          transformFeedbackID_    = 0;
+        GLBufferTarget  target_                 = GLBufferTarget::ArrayBuffer;
+        char*           persistentData_         = nullptr;
+        bool            indexType16Bits_        = false;
+        bool            streamUpdates_          = false; // Updates are streamed through <GLStreamingBuffer>.
 
 };
 
@@ -10,8 +10,8 @@
 
 
 #include <LLGL/BufferArray.h>
+#include <LLGL/Container/SmallVector.h>
 #include "../OpenGL.h"
-#include <vector>
 #include <cstdint>
 
 
@@ -29,7 +29,7 @@ class GLBufferArray : public BufferArray
         GLBufferArray(std::uint32_t numBuffers, Buffer* const * bufferArray);
 
         // Returns the array of buffer IDs.
-        inline const std::vector<GLuint>& GetIDArray() const
+        inline const SmallVector<GLuint>& GetIDArray() const
         {
             return idArray_;
         }
@@ -40,7 +40,7 @@ class GLBufferArray : public BufferArray
 
     private:
 
-        std::vector<GLuint> idArray_;
+        SmallVector<GLuint> idArray_;
 
 };
 
@@ -61,27 +61,20 @@ static void ThrowNoVertexBufferErr()
 
 void GLBufferArrayWithVAO::BuildVertexArrayWithVAO(std::uint32_t numBuffers, Buffer* const * bufferArray)
 {
-    /* Bind VAO */
-    GLStateManager::Get().BindVertexArray(GetVaoID());
+    while (auto bufferGL = NextArrayResource<GLBuffer>(numBuffers, bufferArray))
     {
-        while (auto bufferGL = NextArrayResource<GLBuffer>(numBuffers, bufferArray))
+        if ((bufferGL->GetBindFlags() & BindFlags::VertexBuffer) != 0)
         {
-            if ((bufferGL->GetBindFlags() & BindFlags::VertexBuffer) != 0)
-            {
-                /* Bind VBO */
-                auto vertexBufferGL = LLGL_CAST(GLBufferWithVAO*, bufferGL);
-                GLStateManager::Get().BindBuffer(GLBufferTarget::ArrayBuffer, vertexBufferGL->GetID());
-
-                /* Build each vertex attribute */
-                const auto& vertexAttribs = vertexBufferGL->GetVertexAttribs();
-                for (const auto& attrib : vertexAttribs)
-                    vao_.BuildVertexAttribute(attrib);
-            }
-            else
-                ThrowNoVertexBufferErr();
+            /* Build each vertex attribute */
+            auto vertexBufferGL = LLGL_CAST(GLBufferWithVAO*, bufferGL);
+            const auto& vertexAttribs = vertexBufferGL->GetVertexAttribs();
+            for (const auto& attrib : vertexAttribs)
+                vao_.BuildVertexAttribute(vertexBufferGL->GetID(), attrib);
         }
+        else
+            ThrowNoVertexBufferErr();
     }
-    GLStateManager::Get().BindVertexArray(0);
+    vao_.Finalize();
 }
 
 #ifdef LLGL_GL_ENABLE_OPENGL2X
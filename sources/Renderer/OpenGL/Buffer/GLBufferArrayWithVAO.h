@@ -31,10 +31,10 @@ class GLBufferArrayWithVAO final : public GLBufferArray
 
         GLBufferArrayWithVAO(std::uint32_t numBuffers, Buffer* const * bufferArray);
 
-        // Returns the ID of the vertex-array-object (VAO)
-        inline GLuint GetVaoID() const
+        // Returns the vertex-array-object (VAO).
+        inline const GLVertexArrayObject& GetVertexArray() const
         {
-            return vao_.GetID();
+            return vao_;
         }
 
         #ifdef LLGL_GL_ENABLE_OPENGL2X
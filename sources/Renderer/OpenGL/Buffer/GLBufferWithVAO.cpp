@@ -48,17 +48,10 @@ void GLBufferWithVAO::BuildVertexArray(std::size_t numVertexAttribs, const Verte
 
 void GLBufferWithVAO::BuildVertexArrayWithVAO()
 {
-    /* Bind VAO */
-    GLStateManager::Get().BindVertexArray(GetVaoID());
-    {
-        /* Bind VBO */
-        GLStateManager::Get().BindBuffer(GLBufferTarget::ArrayBuffer, GetID());
-
-        /* Build each vertex attribute */
-        for (const auto& attrib : vertexAttribs_)
-            vao_.BuildVertexAttribute(attrib);
-    }
-    GLStateManager::Get().BindVertexArray(0);
+    /* Build each vertex attribute */
+    for (const auto& attrib : vertexAttribs_)
+        vao_.BuildVertexAttribute(GetID(), attrib);
+    vao_.Finalize();
 }
 
 #ifdef LLGL_GL_ENABLE_OPENGL2X
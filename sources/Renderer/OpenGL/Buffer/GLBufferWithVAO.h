@@ -29,10 +29,10 @@ class GLBufferWithVAO final : public GLBuffer
 
         void BuildVertexArray(std::size_t numVertexAttribs, const VertexAttribute* vertexAttribs);
 
-        // Returns the ID of the vertex-array-object (VAO)
-        inline GLuint GetVaoID() const
+        // Returns the vertex-array-object (VAO).
+        inline const GLVertexArrayObject& GetVertexArray() const
         {
-            return vao_.GetID();
+            return vao_;
         }
 
         // Returns the list of vertex attributes.
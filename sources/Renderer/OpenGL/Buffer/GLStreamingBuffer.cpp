@@ -0,0 +1,209 @@
+/*
+ * GLStreamingBuffer.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "GLStreamingBuffer.h"
+#include "GLBuffer.h"
+#include "../Ext/GLExtensions.h"
+#include "../Ext/GLExtensionRegistry.h"
+#include "../../../Core/CoreUtils.h"
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+// Size (in bytes) of each segment of the ring buffer.
+static constexpr GLsizeiptr g_streamingSegmentSize = 1024 * 1024;
+
+// Alignment (in bytes) of each update within a segment.
+static constexpr GLsizeiptr g_streamingAlignment = 16;
+
+// Timeout (in nanoseconds) for each attempt to wait for a segment to become available again.
+static constexpr GLuint64 g_streamingSyncTimeout = 1000000000ull;
+
+GLStreamingBuffer::~GLStreamingBuffer()
+{
+    Clear();
+}
+
+GLStreamingBuffer& GLStreamingBuffer::Get()
+{
+    static GLStreamingBuffer instance;
+    return instance;
+}
+
+void GLStreamingBuffer::Clear()
+{
+    for (GLsync& sync : segmentSyncs_)
+    {
+        /* Always call glDeleteSync, it will silently ignore a <sync> value of zero */
+        glDeleteSync(sync);
+        sync = 0;
+    }
+
+    if (ringBuffer_)
+    {
+        /* Unmap and delete ring buffer */
+        if (mappedData_ != nullptr)
+            ringBuffer_->UnmapBuffer();
+        ringBuffer_.reset();
+    }
+
+    mappedData_     = nullptr;
+    segmentSize_    = 0;
+    segmentOffset_  = 0;
+    segmentIndex_   = 0;
+}
+
+// Returns true if the ring buffer can be mapped persistently.
+static bool IsPersistentMappingSupported()
+{
+    #ifdef GL_ARB_buffer_storage
+    return HasExtension(GLExt::ARB_buffer_storage);
+    #else
+    return false;
+    #endif // /GL_ARB_buffer_storage
+}
+
+bool GLStreamingBuffer::IsSupported()
+{
+    #if defined LLGL_GLEXT_COPY_BUFFER && defined LLGL_GLEXT_MAP_BUFFER_RANGE
+    return
+    (
+        (IsPersistentMappingSupported() || HasExtension(GLExt::ARB_map_buffer_range)) &&
+        HasExtension(GLExt::ARB_copy_buffer) &&
+        HasExtension(GLExt::ARB_sync)
+    );
+    #else
+    return false;
+    #endif // /LLGL_GLEXT_COPY_BUFFER && LLGL_GLEXT_MAP_BUFFER_RANGE
+}
+
+bool GLStreamingBuffer::WriteBufferSubData(GLBuffer& dstBuffer, GLintptr dstOffset, GLsizeiptr size, const void* data)
+{
+    /* Large updates are not worth streaming and would not fit into a single segment */
+    if (size > g_streamingSegmentSize)
+        return false;
+
+    if (!ringBuffer_ && !CreateStorage())
+        return false;
+
+    /* Move to next segment if the current one does not have enough space left */
+    if (segmentOffset_ + size > segmentSize_)
+        BeginNextSegment();
+
+    const GLintptr srcOffset = static_cast<GLintptr>(segmentIndex_) * segmentSize_ + segmentOffset_;
+    if (!WriteRingBuffer(srcOffset, size, data))
+        return false;
+
+    /* Copy updated range from ring buffer into destination buffer on the GPU timeline */
+    dstBuffer.CopyBufferSubData(*ringBuffer_, srcOffset, dstOffset, size);
+
+    segmentOffset_ += GetAlignedSize<GLsizeiptr>(size, g_streamingAlignment);
+
+    return true;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool GLStreamingBuffer::CreateStorage()
+{
+    const GLsizeiptr totalSize = g_streamingSegmentSize * numSegments;
+
+    #ifdef GL_ARB_buffer_storage
+    if (IsPersistentMappingSupported())
+    {
+        const GLbitfield flags = (GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+
+        /* Create immutable storage and map it persistently */
+        ringBuffer_ = MakeUnique<GLBuffer>(0, "LLGL.StreamingBuffer");
+        ringBuffer_->BufferStorage(totalSize, nullptr, flags, GL_STREAM_DRAW);
+        mappedData_ = static_cast<char*>(ringBuffer_->MapBufferRange(0, totalSize, flags));
+
+        if (mappedData_ == nullptr)
+        {
+            /* Release ring buffer if it cannot be mapped persistently */
+            ringBuffer_.reset();
+            return false;
+        }
+    }
+    else
+    #endif // /GL_ARB_buffer_storage
+    {
+        /* Create mutable storage that is mapped with each update */
+        ringBuffer_ = MakeUnique<GLBuffer>(0, "LLGL.StreamingBuffer");
+        ringBuffer_->BufferStorage(totalSize, nullptr, 0, GL_STREAM_DRAW);
+    }
+
+    segmentSize_    = g_streamingSegmentSize;
+    segmentOffset_  = 0;
+    segmentIndex_   = 0;
+
+    return true;
+}
+
+bool GLStreamingBuffer::WriteRingBuffer(GLintptr offset, GLsizeiptr size, const void* data)
+{
+    if (mappedData_ != nullptr)
+    {
+        /* Write data into persistently mapped memory; the storage is coherent, so no explicit flush is required */
+        ::memcpy(mappedData_ + offset, data, static_cast<std::size_t>(size));
+        return true;
+    }
+
+    #ifdef LLGL_GLEXT_MAP_BUFFER_RANGE
+
+    /* Map range without implicit synchronization; segment fences already guarantee the GPU is done reading from it */
+    const GLbitfield access = (GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+    if (void* dst = ringBuffer_->MapBufferRange(offset, size, access))
+    {
+        ::memcpy(dst, data, static_cast<std::size_t>(size));
+        ringBuffer_->UnmapBuffer();
+        return true;
+    }
+
+    #endif // /LLGL_GLEXT_MAP_BUFFER_RANGE
+
+    return false;
+}
+
+void GLStreamingBuffer::BeginNextSegment()
+{
+    /* Fence all commands that read from the current segment */
+    segmentSyncs_[segmentIndex_] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+    /* Wait until the GPU has finished reading from the next segment */
+    segmentIndex_ = (segmentIndex_ + 1) % numSegments;
+    segmentOffset_ = 0;
+
+    GLsync& sync = segmentSyncs_[segmentIndex_];
+    if (sync != 0)
+    {
+        /* Only flush the command stream with the first attempt */
+        GLbitfield waitFlags = GL_SYNC_FLUSH_COMMANDS_BIT;
+        for (;;)
+        {
+            GLenum result = glClientWaitSync(sync, waitFlags, g_streamingSyncTimeout);
+            if (result != GL_TIMEOUT_EXPIRED)
+                break;
+            waitFlags = 0;
+        }
+        glDeleteSync(sync);
+        sync = 0;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,95 @@
+/*
+ * GLStreamingBuffer.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GL_STREAMING_BUFFER_H
+#define LLGL_GL_STREAMING_BUFFER_H
+
+
+#include "../OpenGL.h"
+#include <cstdint>
+#include <memory>
+
+
+namespace LLGL
+{
+
+
+class GLBuffer;
+
+/*
+Persistently mapped ring buffer to stream buffer updates into GPU memory; used by <GLBuffer> for dynamic buffers.
+Each update is copied into the mapped memory and then copied into the destination buffer on the GPU timeline,
+which avoids the implicit synchronization and intermediate driver copy of glBufferSubData.
+The ring is divided into segments that are fenced with glFenceSync, so a segment is only overwritten once the GPU is done with it.
+Without "GL_ARB_buffer_storage", e.g. on GLES 3.0, each update maps its range of the ring with GL_MAP_UNSYNCHRONIZED_BIT instead,
+which is safe for the same reason and still avoids the pipeline stall glBufferSubData causes on tile-based mobile GPUs.
+*/
+class GLStreamingBuffer
+{
+
+    public:
+
+        // Returns the instance of this singleton.
+        static GLStreamingBuffer& Get();
+
+    public:
+
+        GLStreamingBuffer(const GLStreamingBuffer&) = delete;
+        GLStreamingBuffer& operator = (const GLStreamingBuffer&) = delete;
+
+        GLStreamingBuffer(GLStreamingBuffer&&) = delete;
+        GLStreamingBuffer& operator = (GLStreamingBuffer&&) = delete;
+
+        ~GLStreamingBuffer();
+
+        // Releases all resources for this singleton class.
+        void Clear();
+
+        // Returns true if buffer streaming is supported, i.e. "GL_ARB_buffer_storage" or "GL_ARB_map_buffer_range", "GL_ARB_copy_buffer", and "GL_ARB_sync" are available.
+        static bool IsSupported();
+
+        /*
+        Writes the specified data into the destination buffer through the ring buffer.
+        Returns false if the data does not fit into a single segment, in which case the caller must fall back to glBufferSubData.
+        */
+        bool WriteBufferSubData(GLBuffer& dstBuffer, GLintptr dstOffset, GLsizeiptr size, const void* data);
+
+    private:
+
+        GLStreamingBuffer() = default;
+
+        // Creates the storage of the ring buffer and maps it persistently if supported.
+        bool CreateStorage();
+
+        // Writes the specified data into the ring buffer at the specified offset.
+        bool WriteRingBuffer(GLintptr offset, GLsizeiptr size, const void* data);
+
+        // Fences the current segment and waits until the next segment is no longer used by the GPU.
+        void BeginNextSegment();
+
+    private:
+
+        static constexpr std::uint32_t  numSegments         = 3;
+
+        std::unique_ptr<GLBuffer>       ringBuffer_;
+        char*                           mappedData_         = nullptr; // Null if the ring buffer is mapped for each update
+        GLsizeiptr                      segmentSize_        = 0;
+        GLsizeiptr                      segmentOffset_      = 0;
+        std::uint32_t                   segmentIndex_       = 0;
+        GLsync                          segmentSyncs_[numSegments] = {};
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,335 @@
+/*
+ * GLVertexArrayCache.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "GLVertexArrayCache.h"
+#include "../Ext/GLExtensions.h"
+#include "../Ext/GLExtensionRegistry.h"
+#include "../RenderState/GLStateManager.h"
+#include "../GLCore.h"
+#include "../../../Core/CoreUtils.h"
+#include "../../../Core/MacroUtils.h"
+#include <LLGL/Container/SmallVector.h>
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+// Maximum number of VAOs without owners that are kept for re-use.
+static constexpr std::size_t g_maxUnusedVertexArrays = 64;
+
+static int CompareVertexArrayAttribSWO(const GLVertexArrayAttrib& lhs, const GLVertexArrayAttrib& rhs)
+{
+    LLGL_COMPARE_MEMBER_SWO     ( buffer     );
+    LLGL_COMPARE_MEMBER_SWO     ( binding    );
+    LLGL_COMPARE_MEMBER_SWO     ( index      );
+    LLGL_COMPARE_MEMBER_SWO     ( components );
+    LLGL_COMPARE_MEMBER_SWO     ( dataType   );
+    LLGL_COMPARE_BOOL_MEMBER_SWO( normalized );
+    LLGL_COMPARE_BOOL_MEMBER_SWO( integral   );
+    LLGL_COMPARE_MEMBER_SWO     ( offset     );
+    LLGL_COMPARE_MEMBER_SWO     ( stride     );
+    LLGL_COMPARE_MEMBER_SWO     ( divisor    );
+    return 0;
+}
+
+int GLVertexArrayFormat::CompareSWO(const GLVertexArrayFormat& lhs, const GLVertexArrayFormat& rhs)
+{
+    LLGL_COMPARE_BOOL_MEMBER_SWO( hasVertexBindings );
+    LLGL_COMPARE_MEMBER_SWO     ( attribs.size()    );
+    for (std::size_t i = 0, n = lhs.attribs.size(); i < n; ++i)
+    {
+        const int order = CompareVertexArrayAttribSWO(lhs.attribs[i], rhs.attribs[i]);
+        if (order != 0)
+            return order;
+    }
+    return 0;
+}
+
+
+/*
+ * GLSharedVertexArray class
+ */
+
+GLSharedVertexArray::GLSharedVertexArray(GLVertexArrayFormat&& format) :
+    format_ { std::move(format) }
+{
+    glGenVertexArrays(1, &id_);
+
+    GLStateManager::Get().BindVertexArray(id_);
+    {
+        #ifdef LLGL_GLEXT_VERTEX_ATTRIB_BINDING
+        if (format_.hasVertexBindings)
+            BuildVertexAttribFormats();
+        else
+        #endif
+            BuildVertexAttribPointers();
+    }
+    GLStateManager::Get().BindVertexArray(0);
+}
+
+GLSharedVertexArray::~GLSharedVertexArray()
+{
+    glDeleteVertexArrays(1, &id_);
+    GLStateManager::Get().NotifyVertexArrayRelease(id_);
+}
+
+void GLSharedVertexArray::BindVertexBuffers(
+    const std::vector<GLuint>&      buffers,
+    const std::vector<GLintptr>&    offsets,
+    const std::vector<GLsizei>&     strides,
+    GLintptr                        baseOffset)
+{
+    #ifdef LLGL_GLEXT_VERTEX_ATTRIB_BINDING
+
+    /* All bindings must be updated if the base offset changed, since it applies to all of them */
+    const bool offsetChanged = (boundOffset_ != baseOffset);
+    if (!offsetChanged && boundBuffers_ == buffers)
+        return;
+
+    #ifdef GL_ARB_multi_bind
+    if (HasExtension(GLExt::ARB_multi_bind))
+    {
+        if (baseOffset != 0)
+        {
+            SmallVector<GLintptr> shiftedOffsets;
+            shiftedOffsets.resize(offsets.size());
+            for (std::size_t i = 0, n = offsets.size(); i < n; ++i)
+                shiftedOffsets[i] = offsets[i] + baseOffset;
+            glBindVertexBuffers(0, static_cast<GLsizei>(buffers.size()), buffers.data(), shiftedOffsets.data(), strides.data());
+        }
+        else
+            glBindVertexBuffers(0, static_cast<GLsizei>(buffers.size()), buffers.data(), offsets.data(), strides.data());
+    }
+    else
+    #endif // /GL_ARB_multi_bind
+    {
+        for (std::size_t i = 0, n = buffers.size(); i < n; ++i)
+        {
+            if (offsetChanged || i >= boundBuffers_.size() || boundBuffers_[i] != buffers[i])
+                glBindVertexBuffer(static_cast<GLuint>(i), buffers[i], offsets[i] + baseOffset, strides[i]);
+        }
+    }
+
+    boundBuffers_   = buffers;
+    boundOffset_    = baseOffset;
+
+    #endif // /LLGL_GLEXT_VERTEX_ATTRIB_BINDING
+}
+
+void GLSharedVertexArray::InvalidateVertexBuffer(GLuint buffer)
+{
+    for (GLuint& boundBuffer : boundBuffers_)
+    {
+        if (boundBuffer == buffer)
+            boundBuffer = 0;
+    }
+}
+
+bool GLSharedVertexArray::HasAttribBuffer(GLuint buffer) const
+{
+    for (const GLVertexArrayAttrib& attr : format_.attribs)
+    {
+        if (attr.buffer == buffer)
+            return true;
+    }
+    return false;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void GLSharedVertexArray::BuildVertexAttribPointers()
+{
+    for (const GLVertexArrayAttrib& attr : format_.attribs)
+    {
+        /* Use source buffer for VertexAttribPointer functions */
+        GLStateManager::Get().BindBuffer(GLBufferTarget::ArrayBuffer, attr.buffer);
+
+        /* Enable array index in currently bound VAO */
+        glEnableVertexAttribArray(attr.index);
+
+        /* Set instance divisor */
+        if (attr.divisor > 0)
+            glVertexAttribDivisor(attr.index, attr.divisor);
+
+        /* Convert offset to pointer sized type (for 32- and 64 bit builds) */
+        const GLsizeiptr offsetPtrSized = static_cast<GLsizeiptr>(attr.offset);
+
+        if (attr.integral)
+        {
+            glVertexAttribIPointer(
+                attr.index,
+                attr.components,
+                attr.dataType,
+                attr.stride,
+                reinterpret_cast<const void*>(offsetPtrSized)
+            );
+        }
+        else
+        {
+            glVertexAttribPointer(
+                attr.index,
+                attr.components,
+                attr.dataType,
+                GLBoolean(attr.normalized),
+                attr.stride,
+                reinterpret_cast<const void*>(offsetPtrSized)
+            );
+        }
+    }
+}
+
+void GLSharedVertexArray::BuildVertexAttribFormats()
+{
+    #ifdef LLGL_GLEXT_VERTEX_ATTRIB_BINDING
+
+    for (const GLVertexArrayAttrib& attr : format_.attribs)
+    {
+        /* Enable array index and specify its format relative to the vertex buffer binding */
+        glEnableVertexAttribArray(attr.index);
+
+        if (attr.integral)
+            glVertexAttribIFormat(attr.index, attr.components, attr.dataType, attr.offset);
+        else
+            glVertexAttribFormat(attr.index, attr.components, attr.dataType, GLBoolean(attr.normalized), attr.offset);
+
+        glVertexAttribBinding(attr.index, attr.binding);
+
+        /* Instance divisor is a state of the vertex buffer binding; all attributes of the same binding share the same divisor */
+        glVertexBindingDivisor(attr.binding, attr.divisor);
+    }
+
+    #endif // /LLGL_GLEXT_VERTEX_ATTRIB_BINDING
+}
+
+
+/*
+ * GLVertexArrayCache class
+ */
+
+GLVertexArrayCache& GLVertexArrayCache::Get()
+{
+    static GLVertexArrayCache instance;
+    return instance;
+}
+
+void GLVertexArrayCache::Clear()
+{
+    vertexArrays_.clear();
+    unusedVertexArrays_.clear();
+}
+
+// Searches the shared VAO with the specified vertex format with complexity O(log n).
+static GLSharedVertexArraySPtr* FindSharedVertexArray(
+    std::vector<GLSharedVertexArraySPtr>&   container,
+    const GLVertexArrayFormat&              format,
+    std::size_t*                            index = nullptr)
+{
+    return FindInSortedArray<GLSharedVertexArraySPtr>(
+        container.data(),
+        container.size(),
+        [&format](const GLSharedVertexArraySPtr& entry) -> int
+        {
+            return GLVertexArrayFormat::CompareSWO(entry->GetFormat(), format);
+        },
+        index
+    );
+}
+
+GLSharedVertexArraySPtr GLVertexArrayCache::AcquireVertexArray(GLVertexArrayFormat&& format)
+{
+    /* Try to find VAO with same vertex format */
+    std::size_t insertionIndex = 0;
+    if (GLSharedVertexArraySPtr* entry = FindSharedVertexArray(vertexArrays_, format, &insertionIndex))
+    {
+        /* Revive VAO if it was not used anymore */
+        RemoveUnusedVertexArray(entry->get());
+        return *entry;
+    }
+
+    /* Build new VAO with insertion sort */
+    GLSharedVertexArraySPtr newVertexArray = std::make_shared<GLSharedVertexArray>(std::move(format));
+    vertexArrays_.insert(vertexArrays_.begin() + insertionIndex, newVertexArray);
+
+    return newVertexArray;
+}
+
+void GLVertexArrayCache::ReleaseVertexArray(GLSharedVertexArraySPtr&& vertexArray)
+{
+    if (vertexArray && vertexArray.use_count() == 2)
+    {
+        /* Only keep VAO for re-use if it's still part of the cache */
+        GLSharedVertexArraySPtr* entry = FindSharedVertexArray(vertexArrays_, vertexArray->GetFormat());
+        if (entry != nullptr && entry->get() == vertexArray.get())
+        {
+            unusedVertexArrays_.push_back(vertexArray.get());
+
+            /* Evict least recently used VAO if there are too many unused ones */
+            if (unusedVertexArrays_.size() > g_maxUnusedVertexArrays)
+            {
+                const GLSharedVertexArray* evictedVertexArray = unusedVertexArrays_.front();
+                unusedVertexArrays_.erase(unusedVertexArrays_.begin());
+                RemoveVertexArray(evictedVertexArray);
+            }
+        }
+    }
+    vertexArray.reset();
+}
+
+void GLVertexArrayCache::NotifyBufferRelease(GLuint buffer)
+{
+    for (auto it = vertexArrays_.begin(); it != vertexArrays_.end();)
+    {
+        GLSharedVertexArray* vertexArray = it->get();
+        if (vertexArray->HasAttribBuffer(buffer))
+        {
+            /*
+            A native VAO keeps a reference to the deleted buffer, so it must not be shared with a new buffer that is generated with the same ID.
+            Owners of this VAO keep it alive until it is released.
+            */
+            RemoveUnusedVertexArray(vertexArray);
+            it = vertexArrays_.erase(it);
+        }
+        else
+        {
+            vertexArray->InvalidateVertexBuffer(buffer);
+            ++it;
+        }
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void GLVertexArrayCache::RemoveUnusedVertexArray(const GLSharedVertexArray* vertexArray)
+{
+    RemoveFromList(unusedVertexArrays_, vertexArray);
+}
+
+void GLVertexArrayCache::RemoveVertexArray(const GLSharedVertexArray* vertexArray)
+{
+    RemoveFromListIf(
+        vertexArrays_,
+        [vertexArray](const GLSharedVertexArraySPtr& entry) -> bool
+        {
+            return (entry.get() == vertexArray);
+        }
+    );
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
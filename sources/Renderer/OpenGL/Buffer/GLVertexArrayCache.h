@@ -0,0 +1,153 @@
+/*
+ * GLVertexArrayCache.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GL_VERTEX_ARRAY_CACHE_H
+#define LLGL_GL_VERTEX_ARRAY_CACHE_H
+
+
+#include "../OpenGL.h"
+#include <vector>
+#include <memory>
+
+
+namespace LLGL
+{
+
+
+// Vertex attribute of a shared vertex-array-object (VAO).
+struct GLVertexArrayAttrib
+{
+    GLuint      buffer;     // Source buffer for 'glVertexAttrib*Pointer', or zero for VAOs with separate vertex buffer bindings.
+    GLuint      binding;    // Vertex buffer binding index for 'glVertexAttribBinding'.
+    GLuint      index;
+    GLint       components;
+    GLenum      dataType;
+    bool        normalized;
+    bool        integral;
+    GLuint      offset;
+    GLsizei     stride;
+    GLuint      divisor;
+};
+
+// Vertex format of a shared vertex-array-object (VAO). This is the key of the vertex array cache.
+struct GLVertexArrayFormat
+{
+    std::vector<GLVertexArrayAttrib>    attribs;
+    bool                                hasVertexBindings   = false; // Vertex buffers are bound with 'glBindVertexBuffer' (GL_ARB_vertex_attrib_binding).
+
+    static int CompareSWO(const GLVertexArrayFormat& lhs, const GLVertexArrayFormat& rhs);
+};
+
+// Native vertex-array-object (VAO) that is shared between all vertex buffers and buffer arrays with the same vertex format.
+class GLSharedVertexArray
+{
+
+    public:
+
+        GLSharedVertexArray(const GLSharedVertexArray&) = delete;
+        GLSharedVertexArray& operator = (const GLSharedVertexArray&) = delete;
+
+        GLSharedVertexArray(GLVertexArrayFormat&& format);
+        ~GLSharedVertexArray();
+
+        /*
+        Binds the specified buffers to the vertex buffer bindings of this VAO. The base offset is added to all buffer offsets.
+        Since these bindings are VAO state, they are only re-bound if they differ from the previous call.
+        */
+        void BindVertexBuffers(
+            const std::vector<GLuint>&      buffers,
+            const std::vector<GLintptr>&    offsets,
+            const std::vector<GLsizei>&     strides,
+            GLintptr                        baseOffset  = 0
+        );
+
+        // Resets the tracked vertex buffer bindings that refer to the specified buffer, so a new buffer with the same ID will be bound again.
+        void InvalidateVertexBuffer(GLuint buffer);
+
+        // Returns true if any vertex attribute of this VAO is sourced directly from the specified buffer.
+        bool HasAttribBuffer(GLuint buffer) const;
+
+        // Returns the ID of the hardware vertex-array-object (VAO).
+        inline GLuint GetID() const
+        {
+            return id_;
+        }
+
+        // Returns the vertex format of this VAO.
+        inline const GLVertexArrayFormat& GetFormat() const
+        {
+            return format_;
+        }
+
+    private:
+
+        void BuildVertexAttribPointers();
+        void BuildVertexAttribFormats();
+
+    private:
+
+        GLuint                      id_             = 0;
+        const GLVertexArrayFormat   format_;
+        std::vector<GLuint>         boundBuffers_;  // Buffers that are currently bound to the vertex buffer bindings of this VAO.
+        GLintptr                    boundOffset_    = 0;
+
+};
+
+using GLSharedVertexArraySPtr = std::shared_ptr<GLSharedVertexArray>;
+
+/*
+Singleton cache for vertex-array-objects (VAOs), so vertex buffers and buffer arrays with the same vertex format share a single VAO.
+If "GL_ARB_vertex_attrib_binding" is supported, a VAO only stores the vertex format and the vertex buffers are switched with 'glBindVertexBuffer'.
+Otherwise, the source buffers are part of the VAO state and thereby part of the cache key.
+VAOs that are no longer referenced are kept for re-use until they are evicted in least-recently-used order.
+*/
+class GLVertexArrayCache
+{
+
+    public:
+
+        GLVertexArrayCache(const GLVertexArrayCache&) = delete;
+        GLVertexArrayCache& operator = (const GLVertexArrayCache&) = delete;
+
+        // Returns the instance of this cache.
+        static GLVertexArrayCache& Get();
+
+        // Clear all VAOs of this cache (used by GLRenderSystem). VAOs that are still in use are released by their last owner.
+        void Clear();
+
+        // Returns the shared VAO for the specified vertex format. A new VAO is built if no VAO with this format is cached.
+        GLSharedVertexArraySPtr AcquireVertexArray(GLVertexArrayFormat&& format);
+
+        // Releases the specified shared VAO. If this is its last owner, the VAO is kept as unused VAO for later re-use.
+        void ReleaseVertexArray(GLSharedVertexArraySPtr&& vertexArray);
+
+        // Notifies the cache that the specified buffer is about to be deleted. VAOs that source their attributes from this buffer are no longer shared.
+        void NotifyBufferRelease(GLuint buffer);
+
+    private:
+
+        GLVertexArrayCache() = default;
+
+        void RemoveUnusedVertexArray(const GLSharedVertexArray* vertexArray);
+        void RemoveVertexArray(const GLSharedVertexArray* vertexArray);
+
+    private:
+
+        std::vector<GLSharedVertexArraySPtr>    vertexArrays_;          // Sorted by vertex format.
+        std::vector<const GLSharedVertexArray*> unusedVertexArrays_;    // VAOs without owners in least-recently-used order.
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
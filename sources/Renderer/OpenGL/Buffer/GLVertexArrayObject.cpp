@@ -13,28 +13,32 @@
 #include "../GLCore.h"
 #include "../../../Core/Exception.h"
 #include <LLGL/Utils/TypeNames.h>
+#include <algorithm>
 
 
 namespace LLGL
 {
 
 
-GLVertexArrayObject::GLVertexArrayObject()
+// Minimum value for GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET that is guaranteed by the GL specification.
+static constexpr std::uint32_t g_minMaxVertexAttribRelativeOffset = 2047;
+
+// Returns the GL data type for the specified vertex attribute format. Packed formats have no data type per component.
+static GLenum GetVertexAttribDataType(const Format format, const FormatAttributes& formatAttribs)
 {
-    if (HasNativeVAO())
-        glGenVertexArrays(1, &id_);
+    #ifdef GL_UNSIGNED_INT_2_10_10_10_REV
+    if (format == Format::RGB10A2UNorm)
+        return GL_UNSIGNED_INT_2_10_10_10_REV;
+    #endif
+    return GLTypes::Map(formatAttribs.dataType);
 }
 
 GLVertexArrayObject::~GLVertexArrayObject()
 {
-    if (HasNativeVAO())
-    {
-        glDeleteVertexArrays(1, &id_);
-        GLStateManager::Get().NotifyVertexArrayRelease(id_);
-    }
+    GLVertexArrayCache::Get().ReleaseVertexArray(std::move(sharedVertexArray_));
 }
 
-void GLVertexArrayObject::BuildVertexAttribute(const VertexAttribute& attribute)
+void GLVertexArrayObject::BuildVertexAttribute(GLuint bufferID, const VertexAttribute& attribute)
 {
     LLGL_ASSERT_GL_EXT(ARB_vertex_array_object);
 
@@ -48,44 +52,112 @@ void GLVertexArrayObject::BuildVertexAttribute(const VertexAttribute& attribute)
             LLGL_TRAP("unknown format cannot be used for vertex attributes");
     }
 
-    /* Convert offset to pointer sized type (for 32- and 64 bit builds) */
-    const GLenum        dataType        = GLTypes::Map(formatAttribs.dataType);
-    const GLint         components      = static_cast<GLint>(formatAttribs.components);
-    const GLuint        attribIndex     = static_cast<GLuint>(attribute.location);
-    const GLsizei       stride          = static_cast<GLsizei>(attribute.stride);
-    const GLsizeiptr    offsetPtrSized  = static_cast<GLsizeiptr>(attribute.offset);
+    const bool isNormalized = ((formatAttribs.flags & FormatFlags::IsNormalized) != 0);
+    const bool isIntegral   = (!isNormalized && !IsFloatFormat(attribute.format));
 
-    /* Enable array index in currently bound VAO */
-    glEnableVertexAttribArray(attribIndex);
+    if (isIntegral)
+        LLGL_ASSERT_GL_EXT(EXT_gpu_shader4, "integral vertex attributes");
 
-    /* Set instance divisor */
-    if (attribute.instanceDivisor > 0)
-        glVertexAttribDivisor(attribIndex, attribute.instanceDivisor);
+    /* Assign vertex buffer binding in order of first appearance of each buffer */
+    auto it = std::find(buffers_.begin(), buffers_.end(), bufferID);
+    if (it == buffers_.end())
+    {
+        buffers_.push_back(bufferID);
+        offsets_.push_back(0);
+        strides_.push_back(static_cast<GLsizei>(attribute.stride));
+        it = buffers_.end() - 1;
+    }
 
-    /* Use currently bound VBO for VertexAttribPointer functions */
-    if ((formatAttribs.flags & FormatFlags::IsNormalized) == 0 && !IsFloatFormat(attribute.format))
+    GLVertexArrayAttrib attrib;
     {
-        LLGL_ASSERT_GL_EXT(EXT_gpu_shader4, "integral vertex attributes");
-        glVertexAttribIPointer(
-            attribIndex,
-            components,
-            dataType,
-            stride,
-            reinterpret_cast<const void*>(offsetPtrSized)
-        );
+        attrib.buffer       = bufferID;
+        attrib.binding      = static_cast<GLuint>(std::distance(buffers_.begin(), it));
+        attrib.index        = static_cast<GLuint>(attribute.location);
+        attrib.components   = static_cast<GLint>(formatAttribs.components);
+        attrib.dataType     = GetVertexAttribDataType(attribute.format, formatAttribs);
+        attrib.normalized   = isNormalized;
+        attrib.integral     = isIntegral;
+        attrib.offset       = attribute.offset;
+        attrib.stride       = static_cast<GLsizei>(attribute.stride);
+        attrib.divisor      = attribute.instanceDivisor;
     }
-    else
+    format_.attribs.push_back(attrib);
+}
+
+void GLVertexArrayObject::Finalize()
+{
+    /* Share VAO across all buffers with the same vertex format if vertex buffers can be bound separately */
+    hasVertexBindings_ = CanUseVertexBindings();
+    if (hasVertexBindings_)
     {
-        const GLboolean normalized = GLBoolean((formatAttribs.flags & FormatFlags::IsNormalized) != 0);
-        glVertexAttribPointer(
-            attribIndex,
-            components,
-            dataType,
-            normalized,
-            stride,
-            reinterpret_cast<const void*>(offsetPtrSized)
-        );
+        /* Source buffers are not part of the VAO, only their binding stride */
+        for (GLVertexArrayAttrib& attrib : format_.attribs)
+            attrib.buffer = 0;
     }
+    format_.hasVertexBindings = hasVertexBindings_;
+
+    /* Sort attributes by their location, so equivalent vertex formats have the same key */
+    std::sort(
+        format_.attribs.begin(),
+        format_.attribs.end(),
+        [](const GLVertexArrayAttrib& lhs, const GLVertexArrayAttrib& rhs)
+        {
+            return (lhs.index < rhs.index);
+        }
+    );
+
+    GLVertexArrayCache::Get().ReleaseVertexArray(std::move(sharedVertexArray_));
+    sharedVertexArray_ = GLVertexArrayCache::Get().AcquireVertexArray(std::move(format_));
+    format_ = GLVertexArrayFormat{};
+}
+
+void GLVertexArrayObject::Bind(GLStateManager& stateMngr) const
+{
+    stateMngr.BindVertexArray(GetID());
+    if (hasVertexBindings_)
+        sharedVertexArray_->BindVertexBuffers(buffers_, offsets_, strides_);
+}
+
+void GLVertexArrayObject::BindWithOffset(GLStateManager& stateMngr, GLintptr offset) const
+{
+    stateMngr.BindVertexArray(GetID());
+    if (hasVertexBindings_)
+        sharedVertexArray_->BindVertexBuffers(buffers_, offsets_, strides_, offset);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool GLVertexArrayObject::CanUseVertexBindings() const
+{
+    #ifdef LLGL_GLEXT_VERTEX_ATTRIB_BINDING
+
+    if (!HasExtension(GLExt::ARB_vertex_attrib_binding))
+        return false;
+
+    for (const GLVertexArrayAttrib& attrib : format_.attribs)
+    {
+        /* Relative attribute offsets are limited and instance divisors are a state of the entire vertex buffer binding */
+        if (attrib.offset > g_minMaxVertexAttribRelativeOffset)
+            return false;
+        if (attrib.stride != strides_[attrib.binding])
+            return false;
+        for (const GLVertexArrayAttrib& other : format_.attribs)
+        {
+            if (other.binding == attrib.binding && other.divisor != attrib.divisor)
+                return false;
+        }
+    }
+
+    return true;
+
+    #else // LLGL_GLEXT_VERTEX_ATTRIB_BINDING
+
+    return false;
+
+    #endif // /LLGL_GLEXT_VERTEX_ATTRIB_BINDING
 }
 
 
@@ -10,6 +10,8 @@
 
 
 #include "../OpenGL.h"
+#include "GLVertexArrayCache.h"
+#include <vector>
 
 
 namespace LLGL
@@ -17,28 +19,64 @@ namespace LLGL
 
 
 struct VertexAttribute;
+class GLStateManager;
 
-// Wrapper class for an OpenGL Vertex-Array-Object (VAO), for GL 3.0+.
+/*
+Wrapper class for an OpenGL Vertex-Array-Object (VAO), for GL 3.0+.
+The native VAO is shared with all other vertex arrays of the same vertex format via GLVertexArrayCache.
+*/
 class GLVertexArrayObject
 {
 
     public:
 
-        GLVertexArrayObject();
+        GLVertexArrayObject() = default;
         ~GLVertexArrayObject();
 
-        // Builds the specified attribute using a 'glVertexAttrib*Pointer' function.
-        void BuildVertexAttribute(const VertexAttribute& attribute);
+        GLVertexArrayObject(const GLVertexArrayObject&) = delete;
+        GLVertexArrayObject& operator = (const GLVertexArrayObject&) = delete;
+
+        // Appends the specified attribute that is sourced from the specified buffer.
+        void BuildVertexAttribute(GLuint bufferID, const VertexAttribute& attribute);
+
+        // Finalizes building vertex attributes and acquires the shared VAO for this vertex format.
+        void Finalize();
 
-        // Returns the ID of the hardware vertex-array-object (VAO)
+        // Binds this vertex array and its vertex buffers.
+        void Bind(GLStateManager& stateMngr) const;
+
+        /*
+        Binds this vertex array and its vertex buffers with an additional offset (in bytes).
+        The offset is ignored if this vertex array has no separate vertex buffer bindings (see HasVertexBindings).
+        */
+        void BindWithOffset(GLStateManager& stateMngr, GLintptr offset) const;
+
+        // Returns the ID of the hardware vertex-array-object (VAO) or zero if this vertex array has not been finalized yet.
         inline GLuint GetID() const
         {
-            return id_;
+            return (sharedVertexArray_ ? sharedVertexArray_->GetID() : 0);
+        }
+
+        // Returns true if the vertex buffers of this vertex array are bound separately with 'glBindVertexBuffer', i.e. buffer offsets can be changed.
+        inline bool HasVertexBindings() const
+        {
+            return hasVertexBindings_;
         }
 
     private:
 
-        GLuint id_ = 0; //!< Vertex array object ID.
+        // Returns true if the vertex attributes can be specified with separate vertex buffer bindings.
+        bool CanUseVertexBindings() const;
+
+    private:
+
+        GLVertexArrayFormat     format_;            // Vertex format until the shared VAO has been acquired.
+        std::vector<GLuint>     buffers_;           // Buffer for each vertex buffer binding.
+        std::vector<GLintptr>   offsets_;
+        std::vector<GLsizei>    strides_;
+        bool                    hasVertexBindings_  = false;
+
+        GLSharedVertexArraySPtr sharedVertexArray_;
 
 };
 
@@ -32,6 +32,7 @@ class GLSwapChain;
 class GLRenderTarget;
 class GLRenderPass;
 class GLDeferredCommandBuffer;
+class GLVertexArrayObject;
 #ifdef LLGL_GL_ENABLE_OPENGL2X
 class GL2XVertexArray;
 class GL2XSampler;
@@ -101,6 +102,15 @@ struct GLCmdCopyFramebufferSubData
     Extent2D    extent;
 };
 
+struct GLCmdBlitTexture
+{
+    GLTexture*      dstTexture;
+    TextureRegion   dstRegion;
+    GLTexture*      srcTexture;
+    TextureRegion   srcRegion;
+    GLenum          filter;
+};
+
 struct GLCmdGenerateMipmap
 {
     GLTexture* texture;
@@ -179,9 +189,20 @@ struct GLCmdClearBuffers
 //  AttachmentClear attachments[numAttachments];
 };
 
+struct GLCmdInvalidateAttachments
+{
+    std::uint32_t attachmentMask;
+};
+
 struct GLCmdBindVertexArray
 {
-    GLuint vao;
+    const GLVertexArrayObject* vertexArray;
+};
+
+struct GLCmdBindVertexArrayWithOffset
+{
+    const GLVertexArrayObject*  vertexArray;
+    GLintptr                    offset;
 };
 
 #ifdef LLGL_GL_ENABLE_OPENGL2X
@@ -226,12 +247,22 @@ struct GLCmdBeginTransformFeedbackNV
 
 //struct GLCmdEndTransformFeedbackNV {};
 
+struct GLCmdBindTransformFeedback
+{
+    GLuint id;
+};
+
 struct GLCmdBindResourceHeap
 {
     GLResourceHeap* resourceHeap;
     std::uint32_t   descriptorSet;
 };
 
+struct GLCmdMemoryBarrier
+{
+    GLbitfield barriers;
+};
+
 struct GLCmdBindRenderTarget
 {
     RenderTarget* renderTarget;
@@ -271,7 +302,17 @@ struct GLCmdBeginQuery
 
 struct GLCmdEndQuery
 {
-    GLQueryHeap* queryHeap;
+    GLQueryHeap*    queryHeap;
+    std::uint32_t   query;
+};
+
+struct GLCmdResolveQueries
+{
+    GLQueryHeap*    queryHeap;
+    std::uint32_t   firstQuery;
+    std::uint32_t   numQueries;
+    GLBuffer*       dstBuffer;
+    GLintptr        dstOffset;
 };
 
 struct GLCmdBeginConditionalRender
@@ -391,6 +432,35 @@ struct GLCmdMultiDrawElementsIndirect
     GLsizei         stride;
 };
 
+struct GLCmdMultiDrawArraysIndirectCount
+{
+    GLuint          id;
+    GLuint          countId;
+    GLenum          mode;
+    const GLvoid*   indirect;
+    GLintptr        drawcount;
+    GLsizei         maxdrawcount;
+    GLsizei         stride;
+};
+
+struct GLCmdMultiDrawElementsIndirectCount
+{
+    GLuint          id;
+    GLuint          countId;
+    GLenum          mode;
+    GLenum          type;
+    const GLvoid*   indirect;
+    GLintptr        drawcount;
+    GLsizei         maxdrawcount;
+    GLsizei         stride;
+};
+
+struct GLCmdDrawTransformFeedback
+{
+    GLenum mode;
+    GLuint id;
+};
+
 struct GLCmdDispatchCompute
 {
     GLuint numgroups[3];
@@ -27,6 +27,7 @@
 #include "../Texture/GLTexture.h"
 #include "../Texture/GLMipGenerator.h"
 #include "../Texture/GLFramebufferCapture.h"
+#include "../Texture/GLTextureBlitter.h"
 #ifdef LLGL_GL_ENABLE_OPENGL2X
 #   include "../Texture/GL2XSampler.h"
 #endif
@@ -39,19 +40,144 @@
 #include "../RenderState/GLResourceHeap.h"
 #include "../RenderState/GLRenderPass.h"
 #include "../RenderState/GLQueryHeap.h"
+#include "../RenderState/GLPipelineCache.h"
 
+#include <LLGL/TypeInfo.h>
 #include <algorithm>
+#include <mutex>
+#include <string.h>
+#include <unordered_map>
 
 
 namespace LLGL
 {
 
 
+// Maximum number of indirect draw commands that are unrolled into individual calls; larger loops fall back to the emulated command.
+static const std::uint32_t g_maxUnrolledIndirectCommands = 8;
+
+// Pipeline states are bound via virtual function, so they can't be called as plain member function pointers.
+static void BindGLPipelineState(GLPipelineState* pipelineState, GLStateManager* stateMngr)
+{
+    pipelineState->Bind(*stateMngr);
+}
+
+// Member functions without arguments can't be called via JITCompiler::CallMember, since the argument list must not be empty.
+static void FlushGLIndexedBufferBindings(GLStateManager* stateMngr)
+{
+    stateMngr->FlushIndexedBufferBindings();
+}
+
+// Assembles a direct call to the glUniform* function for the specified uniform type, so the type switch of GLSetUniformsByType is folded at assembly time.
+static void AssembleGLSetUniforms(const GLCmdSetUniforms* cmd, JITCompiler& compiler)
+{
+    const GLint     location    = cmd->location;
+    const GLsizei   count       = cmd->count;
+    const void*     data        = (cmd + 1);
+    const GLboolean transpose   = GL_FALSE;
+
+    switch (cmd->type)
+    {
+        /* ----- Integral types (requires GL 2.0) ----- */
+        case UniformType::Int1:
+        case UniformType::Bool1:
+        case UniformType::Sampler:
+        case UniformType::Image:
+        case UniformType::AtomicCounter:
+            compiler.Call(glUniform1iv, location, count, data);
+            break;
+        case UniformType::Int2:
+        case UniformType::Bool2:
+            compiler.Call(glUniform2iv, location, count, data);
+            break;
+        case UniformType::Int3:
+        case UniformType::Bool3:
+            compiler.Call(glUniform3iv, location, count, data);
+            break;
+        case UniformType::Int4:
+        case UniformType::Bool4:
+            compiler.Call(glUniform4iv, location, count, data);
+            break;
+
+        /* ----- Floating-point types (requires GL 2.0) ----- */
+        case UniformType::Float1:
+            compiler.Call(glUniform1fv, location, count, data);
+            break;
+        case UniformType::Float2:
+            compiler.Call(glUniform2fv, location, count, data);
+            break;
+        case UniformType::Float3:
+            compiler.Call(glUniform3fv, location, count, data);
+            break;
+        case UniformType::Float4:
+            compiler.Call(glUniform4fv, location, count, data);
+            break;
+        case UniformType::Float2x2:
+            compiler.Call(glUniformMatrix2fv, location, count, transpose, data);
+            break;
+        case UniformType::Float3x3:
+            compiler.Call(glUniformMatrix3fv, location, count, transpose, data);
+            break;
+        case UniformType::Float4x4:
+            compiler.Call(glUniformMatrix4fv, location, count, transpose, data);
+            break;
+
+        /* ----- Non-square matrix types (requires GL 2.1) ----- */
+        case UniformType::Float2x3:
+        case UniformType::Float2x4:
+        case UniformType::Float3x2:
+        case UniformType::Float3x4:
+        case UniformType::Float4x2:
+        case UniformType::Float4x3:
+            if (HasExtension(GLExt::ARB_shader_objects_21))
+            {
+                switch (cmd->type)
+                {
+                    case UniformType::Float2x3: compiler.Call(glUniformMatrix2x3fv, location, count, transpose, data); break;
+                    case UniformType::Float2x4: compiler.Call(glUniformMatrix2x4fv, location, count, transpose, data); break;
+                    case UniformType::Float3x2: compiler.Call(glUniformMatrix3x2fv, location, count, transpose, data); break;
+                    case UniformType::Float3x4: compiler.Call(glUniformMatrix3x4fv, location, count, transpose, data); break;
+                    case UniformType::Float4x2: compiler.Call(glUniformMatrix4x2fv, location, count, transpose, data); break;
+                    case UniformType::Float4x3: compiler.Call(glUniformMatrix4x3fv, location, count, transpose, data); break;
+                    default:                                                                                           break;
+                }
+            }
+            break;
+
+        /* ----- Unsigned integral types (requires GL 3.0) ----- */
+        case UniformType::UInt1:
+        case UniformType::UInt2:
+        case UniformType::UInt3:
+        case UniformType::UInt4:
+            if (HasExtension(GLExt::ARB_shader_objects_30))
+            {
+                switch (cmd->type)
+                {
+                    case UniformType::UInt1:    compiler.Call(glUniform1uiv, location, count, data); break;
+                    case UniformType::UInt2:    compiler.Call(glUniform2uiv, location, count, data); break;
+                    case UniformType::UInt3:    compiler.Call(glUniform3uiv, location, count, data); break;
+                    case UniformType::UInt4:    compiler.Call(glUniform4uiv, location, count, data); break;
+                    default:                                                                         break;
+                }
+            }
+            break;
+
+        default:
+            /* Double-precision types are rare enough to not warrant their own folding */
+            compiler.Call(GLSetUniformsByType, cmd->type, location, count, data);
+            break;
+    }
+}
+
 static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITCompiler& compiler)
 {
     /* Declare index of variadic argument of entry point */
     static const JITVarArg g_stateMngrArg{ 0 };
 
+    /* Submit shadowed indexed buffer bindings before any draw or compute command */
+    if (IsGLOpcodeDrawOrDispatch(opcode))
+        compiler.Call(FlushGLIndexedBufferBindings, g_stateMngrArg);
+
     /* Generate native CPU opcodes for emulated GLOpcode */
     switch (opcode)
     {
@@ -103,6 +229,12 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
             compiler.CallMember(&GLFramebufferCapture::CaptureFramebuffer, &(GLFramebufferCapture::Get()), g_stateMngrArg, cmd->dstTexture, cmd->dstLevel, &(cmd->dstOffset), &(cmd->srcOffset), &(cmd->extent));
             return sizeof(*cmd);
         }
+        case GLOpcodeBlitTexture:
+        {
+            auto cmd = reinterpret_cast<const GLCmdBlitTexture*>(pc);
+            compiler.CallMember(&GLTextureBlitter::BlitTexture, &(GLTextureBlitter::Get()), g_stateMngrArg, cmd->dstTexture, &(cmd->dstRegion), cmd->srcTexture, &(cmd->srcRegion), cmd->filter);
+            return sizeof(*cmd);
+        }
         case GLOpcodeGenerateMipmap:
         {
             auto cmd = reinterpret_cast<const GLCmdGenerateMipmap*>(pc);
@@ -166,7 +298,11 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
         case GLOpcodeClearDepth:
         {
             auto cmd = reinterpret_cast<const GLCmdClearDepth*>(pc);
-            compiler.Call(GLProfile::ClearDepth, cmd->depth);
+            #ifdef LLGL_OPENGL
+            compiler.Call(glClearDepth, cmd->depth);
+            #else
+            compiler.Call(glClearDepthf, cmd->depth);
+            #endif
             return sizeof(*cmd);
         }
         case GLOpcodeClearStencil:
@@ -184,19 +320,32 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
         case GLOpcodeClearAttachmentsWithRenderPass:
         {
             auto cmd = reinterpret_cast<const GLCmdClearAttachmentsWithRenderPass*>(pc);
-            compiler.CallMember(&GLStateManager::ClearAttachmentsWithRenderPass, g_stateMngrArg, cmd->renderPass, cmd->numClearValues, (cmd + 1));
+            if (cmd->renderPass != nullptr)
+                compiler.CallMember(&GLStateManager::ClearAttachmentsWithRenderPass, g_stateMngrArg, cmd->renderPass, cmd->numClearValues, (cmd + 1));
             return (sizeof(*cmd) + sizeof(ClearValue)*cmd->numClearValues);
         }
         case GLOpcodeClearBuffers:
         {
             auto cmd = reinterpret_cast<const GLCmdClearBuffers*>(pc);
             compiler.CallMember(&GLStateManager::ClearBuffers, g_stateMngrArg, cmd->numAttachments, (cmd + 1));
+            return (sizeof(*cmd) + sizeof(AttachmentClear)*cmd->numAttachments);
+        }
+        case GLOpcodeInvalidateAttachments:
+        {
+            auto cmd = reinterpret_cast<const GLCmdInvalidateAttachments*>(pc);
+            compiler.CallMember(&GLStateManager::InvalidateAttachments, g_stateMngrArg, cmd->attachmentMask);
             return sizeof(*cmd);
         }
         case GLOpcodeBindVertexArray:
         {
             auto cmd = reinterpret_cast<const GLCmdBindVertexArray*>(pc);
-            compiler.CallMember(&GLStateManager::BindVertexArray, g_stateMngrArg, cmd->vao);
+            compiler.CallMember(&GLVertexArrayObject::Bind, cmd->vertexArray, g_stateMngrArg);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeBindVertexArrayWithOffset:
+        {
+            auto cmd = reinterpret_cast<const GLCmdBindVertexArrayWithOffset*>(pc);
+            compiler.CallMember(&GLVertexArrayObject::BindWithOffset, cmd->vertexArray, g_stateMngrArg, cmd->offset);
             return sizeof(*cmd);
         }
         #ifdef LLGL_GL_ENABLE_OPENGL2X
@@ -231,46 +380,63 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
             compiler.Call(glBeginTransformFeedback, cmd->primitiveMove);
             return sizeof(*cmd);
         }
-        #ifdef GL_NV_transform_feedback
         case GLOpcodeBeginTransformFeedbackNV:
         {
             auto cmd = reinterpret_cast<const GLCmdBeginTransformFeedbackNV*>(pc);
+            #ifdef GL_NV_transform_feedback
             compiler.Call(glBeginTransformFeedbackNV, cmd->primitiveMove);
+            #endif
             return sizeof(*cmd);
         }
-        #endif // /GL_NV_transform_feedback
         case GLOpcodeEndTransformFeedback:
         {
             compiler.Call(glEndTransformFeedback);
             return 0;
         }
-        #ifdef GL_NV_transform_feedback
         case GLOpcodeEndTransformFeedbackNV:
         {
+            #ifdef GL_NV_transform_feedback
             compiler.Call(glEndTransformFeedbackNV);
+            #endif
             return 0;
         }
-        #endif // /GL_NV_transform_feedback
+        case GLOpcodeBindTransformFeedback:
+        {
+            auto cmd = reinterpret_cast<const GLCmdBindTransformFeedback*>(pc);
+            compiler.CallMember(&GLStateManager::BindTransformFeedback, g_stateMngrArg, cmd->id);
+            return sizeof(*cmd);
+        }
         case GLOpcodeBindResourceHeap:
         {
             auto cmd = reinterpret_cast<const GLCmdBindResourceHeap*>(pc);
             compiler.CallMember(&GLResourceHeap::Bind, cmd->resourceHeap, g_stateMngrArg, cmd->descriptorSet);
             return sizeof(*cmd);
         }
+        case GLOpcodeMemoryBarrier:
+        {
+            auto cmd = reinterpret_cast<const GLCmdMemoryBarrier*>(pc);
+            #ifdef GL_ARB_shader_image_load_store
+            compiler.Call(glMemoryBarrier, cmd->barriers);
+            #endif
+            return sizeof(*cmd);
+        }
         case GLOpcodeBindRenderTarget:
         {
-            //TODO: update reference to GLStateManager; find better way to update g_stateMngrArg (2nd parameter)
             auto cmd = reinterpret_cast<const GLCmdBindRenderTarget*>(pc);
             compiler.CallMember(&GLStateManager::BindRenderTarget, g_stateMngrArg, cmd->renderTarget, nullptr);
+
+            /* Swap-chains switch the GL context, so all subsequent commands must refer to the state manager of that swap-chain */
+            if (LLGL::IsInstanceOf<SwapChain>(*(cmd->renderTarget)))
+            {
+                auto* swapChainGL = LLGL_CAST(GLSwapChain*, cmd->renderTarget);
+                compiler.OverrideVarArg(g_stateMngrArg.index, &(swapChainGL->GetStateManager()));
+            }
             return sizeof(*cmd);
         }
         case GLOpcodeBindPipelineState:
         {
             auto cmd = reinterpret_cast<const GLCmdBindPipelineState*>(pc);
-            if (cmd->pipelineState->IsGraphicsPSO())
-                compiler.CallMember(&GLGraphicsPSO::Bind, cmd->pipelineState, g_stateMngrArg);
-            else
-                compiler.CallMember(&GLPipelineState::Bind, cmd->pipelineState, g_stateMngrArg);
+            compiler.Call(BindGLPipelineState, cmd->pipelineState, g_stateMngrArg);
             return sizeof(*cmd);
         }
         case GLOpcodeSetBlendColor:
@@ -288,7 +454,7 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
         case GLOpcodeSetUniforms:
         {
             auto cmd = reinterpret_cast<const GLCmdSetUniforms*>(pc);
-            compiler.Call(GLSetUniformsByType, cmd->type, cmd->location, cmd->count, (cmd + 1));
+            AssembleGLSetUniforms(cmd, compiler);
             return (sizeof(*cmd) + cmd->size);
         }
         case GLOpcodeBeginQuery:
@@ -300,18 +466,28 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
         case GLOpcodeEndQuery:
         {
             auto cmd = reinterpret_cast<const GLCmdEndQuery*>(pc);
-            compiler.CallMember(&GLQueryHeap::End, cmd->queryHeap);
+            compiler.CallMember(&GLQueryHeap::End, cmd->queryHeap, cmd->query);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeResolveQueries:
+        {
+            auto cmd = reinterpret_cast<const GLCmdResolveQueries*>(pc);
+            compiler.CallMember(&GLQueryHeap::ResolveResults, cmd->queryHeap, cmd->firstQuery, cmd->numQueries, cmd->dstBuffer, cmd->dstOffset);
             return sizeof(*cmd);
         }
         case GLOpcodeBeginConditionalRender:
         {
             auto cmd = reinterpret_cast<const GLCmdBeginConditionalRender*>(pc);
+            #ifdef LLGL_GLEXT_CONDITIONAL_RENDER
             compiler.Call(glBeginConditionalRender, cmd->id, cmd->mode);
+            #endif
             return sizeof(*cmd);
         }
         case GLOpcodeEndConditionalRender:
         {
+            #ifdef LLGL_GLEXT_CONDITIONAL_RENDER
             compiler.Call(glEndConditionalRender);
+            #endif
             return 0;
         }
         case GLOpcodeDrawArrays:
@@ -326,25 +502,34 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
             compiler.Call(glDrawArraysInstanced, cmd->mode, cmd->first, cmd->count, cmd->instancecount);
             return sizeof(*cmd);
         }
-        #ifdef GL_ARB_base_instance
         case GLOpcodeDrawArraysInstancedBaseInstance:
         {
             auto cmd = reinterpret_cast<const GLCmdDrawArraysInstancedBaseInstance*>(pc);
+            #ifdef LLGL_GLEXT_BASE_INSTANCE
             compiler.Call(glDrawArraysInstancedBaseInstance, cmd->mode, cmd->first, cmd->count, cmd->instancecount, cmd->baseinstance);
+            #endif
             return sizeof(*cmd);
         }
-        #endif // /GL_ARB_base_instance
         case GLOpcodeDrawArraysIndirect:
         {
-            //TODO: generate loop in ASM
             auto cmd = reinterpret_cast<const GLCmdDrawArraysIndirect*>(pc);
-            compiler.CallMember(&GLStateManager::BindBuffer, g_stateMngrArg, GLBufferTarget::DrawIndirectBuffer, cmd->id);
-            GLintptr offset = cmd->indirect;
-            for (std::uint32_t i = 0; i < cmd->numCommands; ++i)
+            #ifdef LLGL_GLEXT_DRAW_INDIRECT
+            if (cmd->numCommands > g_maxUnrolledIndirectCommands)
             {
-                compiler.Call(glDrawArraysIndirect, cmd->mode, reinterpret_cast<const GLvoid*>(offset));
-                offset += cmd->stride;
+                /* Avoid code bloat for large loops and forward this command to the interpreter */
+                compiler.Call(ExecuteGLCommandEmulated, opcode, pc, g_stateMngrArg);
+            }
+            else
+            {
+                compiler.CallMember(&GLStateManager::BindBuffer, g_stateMngrArg, GLBufferTarget::DrawIndirectBuffer, cmd->id);
+                GLintptr offset = cmd->indirect;
+                for (std::uint32_t i = 0; i < cmd->numCommands; ++i)
+                {
+                    compiler.Call(glDrawArraysIndirect, cmd->mode, reinterpret_cast<const GLvoid*>(offset));
+                    offset += cmd->stride;
+                }
             }
+            #endif
             return sizeof(*cmd);
         }
         case GLOpcodeDrawElements:
@@ -356,7 +541,9 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
         case GLOpcodeDrawElementsBaseVertex:
         {
             auto cmd = reinterpret_cast<const GLCmdDrawElementsBaseVertex*>(pc);
+            #ifdef LLGL_GLEXT_DRAW_ELEMENTS_BASE_VERTEX
             compiler.Call(glDrawElementsBaseVertex, cmd->mode, cmd->count, cmd->type, cmd->indices, cmd->basevertex);
+            #endif
             return sizeof(*cmd);
         }
         case GLOpcodeDrawElementsInstanced:
@@ -368,22 +555,30 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
         case GLOpcodeDrawElementsInstancedBaseVertex:
         {
             auto cmd = reinterpret_cast<const GLCmdDrawElementsInstancedBaseVertex*>(pc);
+            #ifdef LLGL_GLEXT_DRAW_ELEMENTS_BASE_VERTEX
             compiler.Call(glDrawElementsInstancedBaseVertex, cmd->mode, cmd->count, cmd->type, cmd->indices, cmd->instancecount, cmd->basevertex);
+            #endif
             return sizeof(*cmd);
         }
-        #ifdef GL_ARB_base_instance
         case GLOpcodeDrawElementsInstancedBaseVertexBaseInstance:
         {
             auto cmd = reinterpret_cast<const GLCmdDrawElementsInstancedBaseVertexBaseInstance*>(pc);
+            #ifdef LLGL_GLEXT_BASE_INSTANCE
             compiler.Call(glDrawElementsInstancedBaseVertexBaseInstance, cmd->mode, cmd->count, cmd->type, cmd->indices, cmd->instancecount, cmd->basevertex, cmd->baseinstance);
+            #endif
             return sizeof(*cmd);
         }
-        #endif // /GL_ARB_base_instance
         case GLOpcodeDrawElementsIndirect:
         {
             auto cmd = reinterpret_cast<const GLCmdDrawElementsIndirect*>(pc);
+            #ifdef LLGL_GLEXT_DRAW_INDIRECT
+            if (cmd->numCommands > g_maxUnrolledIndirectCommands)
+            {
+                /* Avoid code bloat for large loops and forward this command to the interpreter */
+                compiler.Call(ExecuteGLCommandEmulated, opcode, pc, g_stateMngrArg);
+            }
+            else
             {
-                //TODO: generate loop in ASM
                 compiler.CallMember(&GLStateManager::BindBuffer, g_stateMngrArg, GLBufferTarget::DrawIndirectBuffer, cmd->id);
                 GLintptr offset = cmd->indirect;
                 for (std::uint32_t i = 0; i < cmd->numCommands; ++i)
@@ -392,39 +587,72 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
                     offset += cmd->stride;
                 }
             }
+            #endif
             return sizeof(*cmd);
         }
-        #ifdef GL_ARB_multi_draw_indirect
         case GLOpcodeMultiDrawArraysIndirect:
         {
             auto cmd = reinterpret_cast<const GLCmdMultiDrawArraysIndirect*>(pc);
+            #ifdef LLGL_GLEXT_MULTI_DRAW_INDIRECT
             compiler.CallMember(&GLStateManager::BindBuffer, g_stateMngrArg, GLBufferTarget::DrawIndirectBuffer, cmd->id);
             compiler.Call(glMultiDrawArraysIndirect, cmd->mode, cmd->indirect, cmd->drawcount, cmd->stride);
+            #endif
             return sizeof(*cmd);
         }
         case GLOpcodeMultiDrawElementsIndirect:
         {
             auto cmd = reinterpret_cast<const GLCmdMultiDrawElementsIndirect*>(pc);
+            #ifdef LLGL_GLEXT_MULTI_DRAW_INDIRECT
             compiler.CallMember(&GLStateManager::BindBuffer, g_stateMngrArg, GLBufferTarget::DrawIndirectBuffer, cmd->id);
             compiler.Call(glMultiDrawElementsIndirect, cmd->mode, cmd->type, cmd->indirect, cmd->drawcount, cmd->stride);
+            #endif
+            return sizeof(*cmd);
+        }
+        case GLOpcodeMultiDrawArraysIndirectCount:
+        {
+            auto cmd = reinterpret_cast<const GLCmdMultiDrawArraysIndirectCount*>(pc);
+            #ifdef LLGL_GLEXT_INDIRECT_PARAMETERS
+            compiler.CallMember(&GLStateManager::BindBuffer, g_stateMngrArg, GLBufferTarget::DrawIndirectBuffer, cmd->id);
+            compiler.CallMember(&GLStateManager::BindBuffer, g_stateMngrArg, GLBufferTarget::ParameterBuffer, cmd->countId);
+            compiler.Call(glMultiDrawArraysIndirectCountARB, cmd->mode, cmd->indirect, cmd->drawcount, cmd->maxdrawcount, cmd->stride);
+            #endif
+            return sizeof(*cmd);
+        }
+        case GLOpcodeMultiDrawElementsIndirectCount:
+        {
+            auto cmd = reinterpret_cast<const GLCmdMultiDrawElementsIndirectCount*>(pc);
+            #ifdef LLGL_GLEXT_INDIRECT_PARAMETERS
+            compiler.CallMember(&GLStateManager::BindBuffer, g_stateMngrArg, GLBufferTarget::DrawIndirectBuffer, cmd->id);
+            compiler.CallMember(&GLStateManager::BindBuffer, g_stateMngrArg, GLBufferTarget::ParameterBuffer, cmd->countId);
+            compiler.Call(glMultiDrawElementsIndirectCountARB, cmd->mode, cmd->type, cmd->indirect, cmd->drawcount, cmd->maxdrawcount, cmd->stride);
+            #endif
+            return sizeof(*cmd);
+        }
+        case GLOpcodeDrawTransformFeedback:
+        {
+            auto cmd = reinterpret_cast<const GLCmdDrawTransformFeedback*>(pc);
+            #ifdef LLGL_GLEXT_TRANSFORM_FEEDBACK2
+            compiler.Call(glDrawTransformFeedback, cmd->mode, cmd->id);
+            #endif
             return sizeof(*cmd);
         }
-        #endif // /GL_ARB_multi_draw_indirect
-        #ifdef GL_ARB_compute_shader
         case GLOpcodeDispatchCompute:
         {
             auto cmd = reinterpret_cast<const GLCmdDispatchCompute*>(pc);
+            #ifdef LLGL_GLEXT_COMPUTE_SHADER
             compiler.Call(glDispatchCompute, cmd->numgroups[0], cmd->numgroups[1], cmd->numgroups[2]);
+            #endif
             return sizeof(*cmd);
         }
         case GLOpcodeDispatchComputeIndirect:
         {
             auto cmd = reinterpret_cast<const GLCmdDispatchComputeIndirect*>(pc);
+            #ifdef LLGL_GLEXT_COMPUTE_SHADER
             compiler.CallMember(&GLStateManager::BindBuffer, g_stateMngrArg, GLBufferTarget::DispatchIndirectBuffer, cmd->id);
             compiler.Call(glDispatchComputeIndirect, cmd->indirect);
+            #endif
             return sizeof(*cmd);
         }
-        #endif // /GL_ARB_compute_shader
         case GLOpcodeBindTexture:
         {
             auto cmd = reinterpret_cast<const GLCmdBindTexture*>(pc);
@@ -469,19 +697,21 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
                 compiler.CallMember(&GLStateManager::UnbindSamplers, g_stateMngrArg, cmd->first, cmd->count);
             return sizeof(*cmd);
         }
-        #ifdef GL_KHR_debug
         case GLOpcodePushDebugGroup:
         {
             auto cmd = reinterpret_cast<const GLCmdPushDebugGroup*>(pc);
+            #ifdef LLGL_GLEXT_DEBUG
             compiler.Call(glPushDebugGroup, cmd->source, cmd->id, cmd->length, reinterpret_cast<const GLchar*>(cmd + 1));
+            #endif
             return (sizeof(*cmd) + cmd->length + 1);
         }
         case GLOpcodePopDebugGroup:
         {
+            #ifdef LLGL_GLEXT_DEBUG
             compiler.Call(glPopDebugGroup);
+            #endif
             return 0;
         }
-        #endif // /GL_KHR_debug
         default:
             return 0;
     }
@@ -499,7 +729,8 @@ static std::size_t RequiredLocalStackSize(const GLDeferredCommandBuffer& cmdBuff
     return maxSize;
 }
 
-std::unique_ptr<JITProgram> AssembleGLDeferredCommandBuffer(const GLDeferredCommandBuffer& cmdBuffer)
+// Assembles the specified contiguous stream of virtual GL commands into a JIT program.
+static std::unique_ptr<JITProgram> AssembleGLCommandStream(const char* data, std::size_t size, std::uint32_t stackSize)
 {
     /* Try to create a JIT-compiler for the active architecture (if supported) */
     if (auto compiler = JITCompiler::Create())
@@ -508,7 +739,6 @@ std::unique_ptr<JITProgram> AssembleGLDeferredCommandBuffer(const GLDeferredComm
         compiler->EntryPointVarArgs({ JIT::ArgType::Ptr });
 
         /* Declare stack allocation for temporary storage (viewports and scissors) */
-        auto stackSize = static_cast<std::uint32_t>(RequiredLocalStackSize(cmdBuffer));
         if (stackSize > 0)
             compiler->StackAlloc(stackSize);
 
@@ -516,22 +746,17 @@ std::unique_ptr<JITProgram> AssembleGLDeferredCommandBuffer(const GLDeferredComm
         compiler->Begin();
 
         /* Initialize program counter to execute virtual GL commands */
-        const auto& virtualCmdBuffer = cmdBuffer.GetVirtualCommandBuffer();
+        const char* pc      = data;
+        const char* pcEnd   = data + size;
 
-        for (const auto& chunk : virtualCmdBuffer)
+        while (pc < pcEnd)
         {
-            auto pc     = chunk.data;
-            auto pcEnd  = chunk.data + chunk.size;
+            /* Read opcode */
+            const GLOpcode opcode = *reinterpret_cast<const GLOpcode*>(pc);
+            pc += sizeof(GLOpcode);
 
-            while (pc < pcEnd)
-            {
-                /* Read opcode */
-                const GLOpcode opcode = *reinterpret_cast<const GLOpcode*>(pc);
-                pc += sizeof(GLOpcode);
-
-                /* Execute command and increment program counter */
-                pc += AssembleGLCommand(opcode, pc, *compiler);
-            }
+            /* Execute command and increment program counter */
+            pc += AssembleGLCommand(opcode, pc, *compiler);
         }
 
         compiler->End();
@@ -542,6 +767,97 @@ std::unique_ptr<JITProgram> AssembleGLDeferredCommandBuffer(const GLDeferredComm
     return nullptr;
 }
 
+/*
+JIT program together with its own copy of the command stream it was assembled from.
+Commands with payloads (e.g. uniforms and buffer updates) are referenced by address from within the program,
+so the argument table must outlive all command buffers that share the program.
+*/
+struct GLCachedJITProgram
+{
+    std::vector<char>           commands;
+    std::uint32_t               stackSize   = 0;
+    std::unique_ptr<JITProgram> program;
+};
+
+/*
+Process-wide cache of JIT programs keyed by the hash of their command stream.
+Entries are only weakly referenced, so a program is released once the last command buffer that shares it is re-encoded or destroyed.
+*/
+struct GLJITProgramCache
+{
+    std::mutex                                                                  mutex;
+    std::unordered_multimap<std::uint64_t, std::weak_ptr<GLCachedJITProgram>>   entries;
+};
+
+static GLJITProgramCache& GetGLJITProgramCache()
+{
+    static GLJITProgramCache instance;
+    return instance;
+}
+
+static bool IsGLCachedJITProgramEqual(const GLCachedJITProgram& entry, const std::vector<char>& commands, std::uint32_t stackSize)
+{
+    return
+    (
+        entry.stackSize == stackSize &&
+        entry.commands.size() == commands.size() &&
+        ::memcmp(entry.commands.data(), commands.data(), commands.size()) == 0
+    );
+}
+
+static void PurgeExpiredGLCachedJITPrograms(GLJITProgramCache& cache)
+{
+    for (auto it = cache.entries.begin(); it != cache.entries.end();)
+    {
+        if (it->second.expired())
+            it = cache.entries.erase(it);
+        else
+            ++it;
+    }
+}
+
+std::shared_ptr<JITProgram> AssembleGLDeferredCommandBuffer(const GLDeferredCommandBuffer& cmdBuffer)
+{
+    /* Gather all chunks into a contiguous command stream; commands never straddle chunk boundaries */
+    const GLVirtualCommandBuffer& virtualCmdBuffer = cmdBuffer.GetVirtualCommandBuffer();
+
+    std::vector<char> commands;
+    commands.reserve(virtualCmdBuffer.Size());
+    for (const auto& chunk : virtualCmdBuffer)
+        commands.insert(commands.end(), chunk.data, chunk.data + chunk.size);
+
+    const std::uint32_t stackSize   = static_cast<std::uint32_t>(RequiredLocalStackSize(cmdBuffer));
+    const std::uint64_t key         = GLPipelineCache::HashBytes(commands.data(), commands.size(), GLPipelineCache::HashBytes(&stackSize, sizeof(stackSize)));
+
+    GLJITProgramCache& cache = GetGLJITProgramCache();
+    std::lock_guard<std::mutex> guard{ cache.mutex };
+
+    /* Share JIT program with all command buffers that encoded an identical command stream */
+    auto range = cache.entries.equal_range(key);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (std::shared_ptr<GLCachedJITProgram> entry = it->second.lock())
+        {
+            if (IsGLCachedJITProgramEqual(*entry, commands, stackSize))
+                return std::shared_ptr<JITProgram>(entry, entry->program.get());
+        }
+    }
+
+    /* Assemble new program against the cache entry's copy of the commands, so it does not refer to the memory of this command buffer */
+    auto entry = std::make_shared<GLCachedJITProgram>();
+    {
+        entry->commands     = std::move(commands);
+        entry->stackSize    = stackSize;
+        entry->program      = AssembleGLCommandStream(entry->commands.data(), entry->commands.size(), stackSize);
+    }
+    if (!entry->program)
+        return nullptr;
+
+    PurgeExpiredGLCachedJITPrograms(cache);
+    cache.entries.insert({ key, entry });
+
+    return std::shared_ptr<JITProgram>(entry, entry->program.get());
+}
 
 } // /namespace LLGL
 
@@ -21,7 +21,11 @@ namespace LLGL
 class JITProgram;
 class GLDeferredCommandBuffer;
 
-std::unique_ptr<JITProgram> AssembleGLDeferredCommandBuffer(const GLDeferredCommandBuffer& cmdbuffer);
+/*
+Assembles the specified command buffer into a JIT program.
+Command buffers with identical command streams share the same program, which refers to its own copy of the command arguments.
+*/
+std::shared_ptr<JITProgram> AssembleGLDeferredCommandBuffer(const GLDeferredCommandBuffer& cmdbuffer);
 
 
 } // /namespace LLGL
@@ -11,6 +11,7 @@
 #include "../RenderState/GLPipelineState.h"
 #include "../RenderState/GLGraphicsPSO.h"
 #include "../../CheckedCast.h"
+#include <LLGL/Utils/ForRange.h>
 
 
 namespace LLGL
@@ -54,6 +55,42 @@ void GLCommandBuffer::SetPipelineRenderState(const GLPipelineState& pipelineStat
     }
 }
 
+GLbitfield GLCommandBuffer::GetMemoryBarrierBitfield(std::uint32_t numBarriers, const ResourceBarrierDescriptor* barriers)
+{
+    GLbitfield bitfield = 0;
+
+    #ifdef GL_ARB_shader_image_load_store
+
+    for_range(i, numBarriers)
+    {
+        const ResourceBarrierDescriptor& barrier = barriers[i];
+        if ((barrier.srcUsage & BindFlags::Storage) == 0)
+            continue;
+
+        const long dstUsage = barrier.dstUsage;
+        if ((dstUsage & BindFlags::VertexBuffer) != 0)
+            bitfield |= GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT;
+        if ((dstUsage & BindFlags::IndexBuffer) != 0)
+            bitfield |= GL_ELEMENT_ARRAY_BARRIER_BIT;
+        if ((dstUsage & BindFlags::ConstantBuffer) != 0)
+            bitfield |= GL_UNIFORM_BARRIER_BIT;
+        if ((dstUsage & BindFlags::IndirectBuffer) != 0)
+            bitfield |= GL_COMMAND_BARRIER_BIT;
+        if ((dstUsage & BindFlags::Sampled) != 0)
+            bitfield |= (GL_TEXTURE_FETCH_BARRIER_BIT | GL_SHADER_STORAGE_BARRIER_BIT);
+        if ((dstUsage & BindFlags::Storage) != 0)
+            bitfield |= (GL_SHADER_IMAGE_ACCESS_BARRIER_BIT | GL_SHADER_STORAGE_BARRIER_BIT);
+        if ((dstUsage & (BindFlags::CopySrc | BindFlags::CopyDst)) != 0)
+            bitfield |= (GL_BUFFER_UPDATE_BARRIER_BIT | GL_TEXTURE_UPDATE_BARRIER_BIT | GL_PIXEL_BUFFER_BARRIER_BIT);
+        if ((dstUsage & (BindFlags::ColorAttachment | BindFlags::DepthStencilAttachment)) != 0)
+            bitfield |= GL_FRAMEBUFFER_BARRIER_BIT;
+    }
+
+    #endif // /GL_ARB_shader_image_load_store
+
+    return bitfield;
+}
+
 /* ----- Extensions ----- */
 
 bool GLCommandBuffer::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
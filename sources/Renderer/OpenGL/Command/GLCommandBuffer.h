@@ -20,6 +20,7 @@ namespace LLGL
 
 
 struct GLRenderState;
+class GLRenderPass;
 
 class GLCommandBuffer : public CommandBuffer
 {
@@ -44,6 +45,9 @@ class GLCommandBuffer : public CommandBuffer
         // Stores the render states for the specified PSO: Draw mode, primitive mode, binding layout.
         void SetPipelineRenderState(const GLPipelineState& pipelineStateGL);
 
+        // Returns the bitmask for glMemoryBarrier for the specified resource barriers. Only barriers after storage resource writes need to be synchronized in GL.
+        static GLbitfield GetMemoryBarrierBitfield(std::uint32_t numBarriers, const ResourceBarrierDescriptor* barriers);
+
     protected:
 
         // Returns the current render state.
@@ -96,9 +100,61 @@ class GLCommandBuffer : public CommandBuffer
             return (pipelineState != nullptr ? pipelineState->GetShaderPipeline() : nullptr);
         }
 
+        // Stores whether the current render condition has a native conditional render block. GL does not support predicates from buffers.
+        inline void SetNativeRenderCondition(bool enabled)
+        {
+            hasNativeRenderCondition_ = enabled;
+        }
+
+        // Returns true if the current render condition must be ended with glEndConditionalRender.
+        inline bool HasNativeRenderCondition() const
+        {
+            return hasNativeRenderCondition_;
+        }
+
+        // Stores the render pass of the current render pass section to invalidate its attachments when the section ends.
+        inline void SetBoundRenderPass(const GLRenderPass* renderPass)
+        {
+            boundRenderPass_ = renderPass;
+        }
+
+        // Returns the render pass of the current render pass section or null if there is none.
+        inline const GLRenderPass* GetBoundRenderPass() const
+        {
+            return boundRenderPass_;
+        }
+
+        // Stores the transform feedback object of the vertex buffer that was set last, or 0 if there is none.
+        inline void SetVertexBufferTransformFeedback(GLuint transformFeedback)
+        {
+            vertexBufferTransformFeedback_ = transformFeedback;
+        }
+
+        // Returns the transform feedback object of the current vertex buffer for glDrawTransformFeedback, or 0 if there is none.
+        inline GLuint GetVertexBufferTransformFeedback() const
+        {
+            return vertexBufferTransformFeedback_;
+        }
+
+        // Stores the transform feedback object that is bound for the current stream-output section, or 0 if the default object is used.
+        inline void SetStreamOutputTransformFeedback(GLuint transformFeedback)
+        {
+            streamOutputTransformFeedback_ = transformFeedback;
+        }
+
+        // Returns the transform feedback object that is bound for the current stream-output section, or 0 if the default object is used.
+        inline GLuint GetStreamOutputTransformFeedback() const
+        {
+            return streamOutputTransformFeedback_;
+        }
+
     private:
 
-        GLRenderState renderState_;
+        GLRenderState       renderState_;
+        bool                hasNativeRenderCondition_       = false;
+        const GLRenderPass* boundRenderPass_                = nullptr;
+        GLuint              vertexBufferTransformFeedback_  = 0;
+        GLuint              streamOutputTransformFeedback_  = 0;
 
 };
 
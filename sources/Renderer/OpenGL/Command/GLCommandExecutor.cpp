@@ -25,6 +25,7 @@
 #include "../Texture/GLRenderTarget.h"
 #include "../Texture/GLMipGenerator.h"
 #include "../Texture/GLFramebufferCapture.h"
+#include "../Texture/GLTextureBlitter.h"
 
 #include "../Buffer/GLBufferWithVAO.h"
 #include "../Buffer/GLBufferArrayWithVAO.h"
@@ -51,6 +52,10 @@ namespace LLGL
 
 static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLStateManager*& stateMngr)
 {
+    /* Submit shadowed indexed buffer bindings before any draw or compute command */
+    if (IsGLOpcodeDrawOrDispatch(opcode))
+        stateMngr->FlushIndexedBufferBindings();
+
     switch (opcode)
     {
         case GLOpcodeBufferSubData:
@@ -101,6 +106,12 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
             GLFramebufferCapture::Get().CaptureFramebuffer(*stateMngr, *(cmd->dstTexture), cmd->dstLevel, cmd->dstOffset, cmd->srcOffset, cmd->extent);
             return sizeof(*cmd);
         }
+        case GLOpcodeBlitTexture:
+        {
+            auto cmd = reinterpret_cast<const GLCmdBlitTexture*>(pc);
+            GLTextureBlitter::Get().BlitTexture(*stateMngr, *(cmd->dstTexture), cmd->dstRegion, *(cmd->srcTexture), cmd->srcRegion, cmd->filter);
+            return sizeof(*cmd);
+        }
         case GLOpcodeGenerateMipmap:
         {
             auto cmd = reinterpret_cast<const GLCmdGenerateMipmap*>(pc);
@@ -192,10 +203,22 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
             stateMngr->ClearBuffers(cmd->numAttachments, reinterpret_cast<const AttachmentClear*>(cmd + 1));
             return (sizeof(*cmd) + sizeof(AttachmentClear)*cmd->numAttachments);
         }
+        case GLOpcodeInvalidateAttachments:
+        {
+            auto cmd = reinterpret_cast<const GLCmdInvalidateAttachments*>(pc);
+            stateMngr->InvalidateAttachments(cmd->attachmentMask);
+            return sizeof(*cmd);
+        }
         case GLOpcodeBindVertexArray:
         {
             auto cmd = reinterpret_cast<const GLCmdBindVertexArray*>(pc);
-            stateMngr->BindVertexArray(cmd->vao);
+            cmd->vertexArray->Bind(*stateMngr);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeBindVertexArrayWithOffset:
+        {
+            auto cmd = reinterpret_cast<const GLCmdBindVertexArrayWithOffset*>(pc);
+            cmd->vertexArray->BindWithOffset(*stateMngr, cmd->offset);
             return sizeof(*cmd);
         }
         #ifdef LLGL_GL_ENABLE_OPENGL2X
@@ -250,12 +273,26 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
             #endif
             return 0;
         }
+        case GLOpcodeBindTransformFeedback:
+        {
+            auto cmd = reinterpret_cast<const GLCmdBindTransformFeedback*>(pc);
+            stateMngr->BindTransformFeedback(cmd->id);
+            return sizeof(*cmd);
+        }
         case GLOpcodeBindResourceHeap:
         {
             auto cmd = reinterpret_cast<const GLCmdBindResourceHeap*>(pc);
             cmd->resourceHeap->Bind(*stateMngr, cmd->descriptorSet);
             return sizeof(*cmd);
         }
+        case GLOpcodeMemoryBarrier:
+        {
+            auto cmd = reinterpret_cast<const GLCmdMemoryBarrier*>(pc);
+            #ifdef GL_ARB_shader_image_load_store
+            glMemoryBarrier(cmd->barriers);
+            #endif
+            return sizeof(*cmd);
+        }
         case GLOpcodeBindRenderTarget:
         {
             auto cmd = reinterpret_cast<const GLCmdBindRenderTarget*>(pc);
@@ -285,7 +322,7 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
         case GLOpcodeSetUniforms:
         {
             auto cmd = reinterpret_cast<const GLCmdSetUniforms*>(pc);
-            GLSetUniformsByType(cmd->type, cmd->location, cmd->count, (cmd + 1));
+            GLSetUniformsCached(cmd->type, cmd->location, cmd->count, (cmd + 1), static_cast<std::size_t>(cmd->size));
             return (sizeof(*cmd) + cmd->size);
         }
         case GLOpcodeBeginQuery:
@@ -297,7 +334,13 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
         case GLOpcodeEndQuery:
         {
             auto cmd = reinterpret_cast<const GLCmdEndQuery*>(pc);
-            cmd->queryHeap->End();
+            cmd->queryHeap->End(cmd->query);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeResolveQueries:
+        {
+            auto cmd = reinterpret_cast<const GLCmdResolveQueries*>(pc);
+            cmd->queryHeap->ResolveResults(cmd->firstQuery, cmd->numQueries, *(cmd->dstBuffer), cmd->dstOffset);
             return sizeof(*cmd);
         }
         case GLOpcodeBeginConditionalRender:
@@ -417,6 +460,34 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
             #endif
             return sizeof(*cmd);
         }
+        case GLOpcodeMultiDrawArraysIndirectCount:
+        {
+            auto cmd = reinterpret_cast<const GLCmdMultiDrawArraysIndirectCount*>(pc);
+            #ifdef LLGL_GLEXT_INDIRECT_PARAMETERS
+            stateMngr->BindBuffer(GLBufferTarget::DrawIndirectBuffer, cmd->id);
+            stateMngr->BindBuffer(GLBufferTarget::ParameterBuffer, cmd->countId);
+            glMultiDrawArraysIndirectCountARB(cmd->mode, cmd->indirect, cmd->drawcount, cmd->maxdrawcount, cmd->stride);
+            #endif
+            return sizeof(*cmd);
+        }
+        case GLOpcodeMultiDrawElementsIndirectCount:
+        {
+            auto cmd = reinterpret_cast<const GLCmdMultiDrawElementsIndirectCount*>(pc);
+            #ifdef LLGL_GLEXT_INDIRECT_PARAMETERS
+            stateMngr->BindBuffer(GLBufferTarget::DrawIndirectBuffer, cmd->id);
+            stateMngr->BindBuffer(GLBufferTarget::ParameterBuffer, cmd->countId);
+            glMultiDrawElementsIndirectCountARB(cmd->mode, cmd->type, cmd->indirect, cmd->drawcount, cmd->maxdrawcount, cmd->stride);
+            #endif
+            return sizeof(*cmd);
+        }
+        case GLOpcodeDrawTransformFeedback:
+        {
+            auto cmd = reinterpret_cast<const GLCmdDrawTransformFeedback*>(pc);
+            #ifdef LLGL_GLEXT_TRANSFORM_FEEDBACK2
+            glDrawTransformFeedback(cmd->mode, cmd->id);
+            #endif
+            return sizeof(*cmd);
+        }
         case GLOpcodeDispatchCompute:
         {
             auto cmd = reinterpret_cast<const GLCmdDispatchCompute*>(pc);
@@ -522,8 +593,18 @@ static void ExecuteGLCommandsEmulated(const GLVirtualCommandBuffer& virtualCmdBu
 
 static void ExecuteGLCommandsNatively(const JITProgram& exec, GLStateManager& stateMngr)
 {
-    /* Execute native program and pass pointer to state manager */
-    exec.GetEntryPoint()(&stateMngr);
+    /*
+    Execute native program and pass pointer to state manager.
+    Call entry point with its actual non-variadic signature, since variadic arguments are passed on the stack in the Apple ARM64 ABI.
+    */
+    using GLEntryPointPtr = void (*)(GLStateManager*);
+    auto entryPoint = reinterpret_cast<GLEntryPointPtr>(exec.GetEntryPoint());
+    entryPoint(&stateMngr);
+}
+
+void ExecuteGLCommandEmulated(const GLOpcode opcode, const void* pc, GLStateManager* stateMngr)
+{
+    ExecuteGLCommand(opcode, pc, stateMngr);
 }
 
 #endif // /LLGL_ENABLE_JIT_COMPILER
@@ -535,6 +616,9 @@ void ExecuteGLDeferredCommandBuffer(const GLDeferredCommandBuffer& cmdBuffer, GL
     {
         /* Execute GL commands with native executable */
         ExecuteGLCommandsNatively(*exec, stateMngr);
+
+        /* Native executables set their uniforms directly, so shadowed uniform values might be out of date now */
+        GLInvalidateUniformCache();
     }
     else
     #endif // /LLGL_ENABLE_JIT_COMPILER
@@ -9,6 +9,9 @@
 #define LLGL_GL_COMMAND_EXECUTOR_H
 
 
+#include "GLCommandOpcode.h"
+
+
 namespace LLGL
 {
 
@@ -29,6 +32,13 @@ void ExecuteGLCommandBuffer(const GLCommandBuffer& cmdbuffer, GLStateManager& st
 // Executes the specified native GL command.
 void ExecuteNativeGLCommand(const OpenGL::NativeCommand& cmd, GLStateManager& stateMngr);
 
+#ifdef LLGL_ENABLE_JIT_COMPILER
+
+// Executes a single GL command with the interpreter. This is used as fallback for commands that are not worth JIT compiling.
+void ExecuteGLCommandEmulated(const GLOpcode opcode, const void* pc, GLStateManager* stateMngr);
+
+#endif // /LLGL_ENABLE_JIT_COMPILER
+
 
 } // /namespace LLGL
 
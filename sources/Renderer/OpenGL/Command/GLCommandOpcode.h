@@ -26,6 +26,7 @@ enum GLOpcode : std::uint8_t
     GLOpcodeCopyImageToBuffer,
     GLOpcodeCopyImageFromBuffer,
     GLOpcodeCopyFramebufferSubData,
+    GLOpcodeBlitTexture,
     GLOpcodeGenerateMipmap,
     GLOpcodeGenerateMipmapSubresource,
     GLOpcodeExecute,
@@ -39,7 +40,9 @@ enum GLOpcode : std::uint8_t
     GLOpcodeClear,
     GLOpcodeClearAttachmentsWithRenderPass,
     GLOpcodeClearBuffers,
+    GLOpcodeInvalidateAttachments,
     GLOpcodeBindVertexArray,
+    GLOpcodeBindVertexArrayWithOffset,
     GLOpcodeBindGL2XVertexArray,
     GLOpcodeBindElementArrayBufferToVAO,
     GLOpcodeBindBufferBase,
@@ -48,7 +51,9 @@ enum GLOpcode : std::uint8_t
     GLOpcodeBeginTransformFeedbackNV,
     GLOpcodeEndTransformFeedback,
     GLOpcodeEndTransformFeedbackNV,
+    GLOpcodeBindTransformFeedback,
     GLOpcodeBindResourceHeap,
+    GLOpcodeMemoryBarrier,
     GLOpcodeBindRenderTarget,
     GLOpcodeBindPipelineState,
     GLOpcodeSetBlendColor,
@@ -56,6 +61,7 @@ enum GLOpcode : std::uint8_t
     GLOpcodeSetUniforms,
     GLOpcodeBeginQuery,
     GLOpcodeEndQuery,
+    GLOpcodeResolveQueries,
     GLOpcodeBeginConditionalRender,
     GLOpcodeEndConditionalRender,
     GLOpcodeDrawArrays,
@@ -70,6 +76,9 @@ enum GLOpcode : std::uint8_t
     GLOpcodeDrawElementsIndirect,
     GLOpcodeMultiDrawArraysIndirect,
     GLOpcodeMultiDrawElementsIndirect,
+    GLOpcodeMultiDrawArraysIndirectCount,
+    GLOpcodeMultiDrawElementsIndirectCount,
+    GLOpcodeDrawTransformFeedback,
     GLOpcodeDispatchCompute,
     GLOpcodeDispatchComputeIndirect,
     GLOpcodeBindTexture,
@@ -81,6 +90,12 @@ enum GLOpcode : std::uint8_t
     GLOpcodePopDebugGroup,
 };
 
+// Returns true if the specified opcode denotes a draw or compute command, i.e. any opcode in the range [GLOpcodeDrawArrays, GLOpcodeDispatchComputeIndirect].
+inline bool IsGLOpcodeDrawOrDispatch(GLOpcode opcode)
+{
+    return (opcode >= GLOpcodeDrawArrays && opcode <= GLOpcodeDispatchComputeIndirect);
+}
+
 
 } // /namespace LLGL
 
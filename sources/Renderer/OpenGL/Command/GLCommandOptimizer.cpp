@@ -0,0 +1,665 @@
+/*
+ * GLCommandOptimizer.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "GLCommandOptimizer.h"
+#include "../Ext/GLExtensions.h"
+#include "../Ext/GLExtensionRegistry.h"
+#include "../../../Core/Assertion.h"
+#include <algorithm>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+// Sampler ID for texture layers whose binding is unknown to the optimizer.
+static const GLuint g_unknownSamplerID = ~0u;
+
+// Returns the size (in bytes) of the specified command including its payload. This must match the program counter increments of the GL command executor.
+static std::size_t GetGLCommandSize(const GLOpcode opcode, const void* pc)
+{
+    switch (opcode)
+    {
+        case GLOpcodeBufferSubData:
+        {
+            auto cmd = reinterpret_cast<const GLCmdBufferSubData*>(pc);
+            return (sizeof(*cmd) + static_cast<std::size_t>(cmd->size));
+        }
+        case GLOpcodeCopyBufferSubData:                             return sizeof(GLCmdCopyBufferSubData);
+        case GLOpcodeClearBufferData:                               return sizeof(GLCmdClearBufferData);
+        case GLOpcodeClearBufferSubData:                            return sizeof(GLCmdClearBufferSubData);
+        case GLOpcodeCopyImageSubData:                              return sizeof(GLCmdCopyImageSubData);
+        case GLOpcodeCopyImageToBuffer:                             return sizeof(GLCmdCopyImageBuffer);
+        case GLOpcodeCopyImageFromBuffer:                           return sizeof(GLCmdCopyImageBuffer);
+        case GLOpcodeCopyFramebufferSubData:                        return sizeof(GLCmdCopyFramebufferSubData);
+        case GLOpcodeBlitTexture:                                   return sizeof(GLCmdBlitTexture);
+        case GLOpcodeGenerateMipmap:                                return sizeof(GLCmdGenerateMipmap);
+        case GLOpcodeGenerateMipmapSubresource:                     return sizeof(GLCmdGenerateMipmapSubresource);
+        case GLOpcodeExecute:                                       return sizeof(GLCmdExecute);
+        case GLOpcodeViewport:                                      return sizeof(GLCmdViewport);
+        case GLOpcodeViewportArray:
+        {
+            auto cmd = reinterpret_cast<const GLCmdViewportArray*>(pc);
+            return (sizeof(*cmd) + sizeof(GLViewport)*cmd->count + sizeof(GLDepthRange)*cmd->count);
+        }
+        case GLOpcodeScissor:                                       return sizeof(GLCmdScissor);
+        case GLOpcodeScissorArray:
+        {
+            auto cmd = reinterpret_cast<const GLCmdScissorArray*>(pc);
+            return (sizeof(*cmd) + sizeof(GLScissor)*cmd->count);
+        }
+        case GLOpcodeClearColor:                                    return sizeof(GLCmdClearColor);
+        case GLOpcodeClearDepth:                                    return sizeof(GLCmdClearDepth);
+        case GLOpcodeClearStencil:                                  return sizeof(GLCmdClearStencil);
+        case GLOpcodeClear:                                         return sizeof(GLCmdClear);
+        case GLOpcodeClearAttachmentsWithRenderPass:
+        {
+            auto cmd = reinterpret_cast<const GLCmdClearAttachmentsWithRenderPass*>(pc);
+            return (sizeof(*cmd) + sizeof(ClearValue)*cmd->numClearValues);
+        }
+        case GLOpcodeClearBuffers:
+        {
+            auto cmd = reinterpret_cast<const GLCmdClearBuffers*>(pc);
+            return (sizeof(*cmd) + sizeof(AttachmentClear)*cmd->numAttachments);
+        }
+        case GLOpcodeInvalidateAttachments:                         return sizeof(GLCmdInvalidateAttachments);
+        case GLOpcodeBindVertexArray:                               return sizeof(GLCmdBindVertexArray);
+        case GLOpcodeBindVertexArrayWithOffset:                     return sizeof(GLCmdBindVertexArrayWithOffset);
+        #ifdef LLGL_GL_ENABLE_OPENGL2X
+        case GLOpcodeBindGL2XVertexArray:                           return sizeof(GLCmdBindGL2XVertexArray);
+        #endif
+        case GLOpcodeBindElementArrayBufferToVAO:                   return sizeof(GLCmdBindElementArrayBufferToVAO);
+        case GLOpcodeBindBufferBase:                                return sizeof(GLCmdBindBufferBase);
+        case GLOpcodeBindBuffersBase:
+        {
+            auto cmd = reinterpret_cast<const GLCmdBindBuffersBase*>(pc);
+            return (sizeof(*cmd) + sizeof(GLuint)*cmd->count);
+        }
+        case GLOpcodeBeginTransformFeedback:                        return sizeof(GLCmdBeginTransformFeedback);
+        case GLOpcodeBeginTransformFeedbackNV:                      return sizeof(GLCmdBeginTransformFeedbackNV);
+        case GLOpcodeEndTransformFeedback:                          return 0;
+        case GLOpcodeEndTransformFeedbackNV:                        return 0;
+        case GLOpcodeBindTransformFeedback:                         return sizeof(GLCmdBindTransformFeedback);
+        case GLOpcodeBindResourceHeap:                              return sizeof(GLCmdBindResourceHeap);
+        case GLOpcodeMemoryBarrier:                                 return sizeof(GLCmdMemoryBarrier);
+        case GLOpcodeBindRenderTarget:                              return sizeof(GLCmdBindRenderTarget);
+        case GLOpcodeBindPipelineState:                             return sizeof(GLCmdBindPipelineState);
+        case GLOpcodeSetBlendColor:                                 return sizeof(GLCmdSetBlendColor);
+        case GLOpcodeSetStencilRef:                                 return sizeof(GLCmdSetStencilRef);
+        case GLOpcodeSetUniforms:
+        {
+            auto cmd = reinterpret_cast<const GLCmdSetUniforms*>(pc);
+            return (sizeof(*cmd) + static_cast<std::size_t>(cmd->size));
+        }
+        case GLOpcodeBeginQuery:                                    return sizeof(GLCmdBeginQuery);
+        case GLOpcodeEndQuery:                                      return sizeof(GLCmdEndQuery);
+        case GLOpcodeResolveQueries:                                return sizeof(GLCmdResolveQueries);
+        case GLOpcodeBeginConditionalRender:                        return sizeof(GLCmdBeginConditionalRender);
+        case GLOpcodeEndConditionalRender:                          return 0;
+        case GLOpcodeDrawArrays:                                    return sizeof(GLCmdDrawArrays);
+        case GLOpcodeDrawArraysInstanced:                           return sizeof(GLCmdDrawArraysInstanced);
+        case GLOpcodeDrawArraysInstancedBaseInstance:               return sizeof(GLCmdDrawArraysInstancedBaseInstance);
+        case GLOpcodeDrawArraysIndirect:                            return sizeof(GLCmdDrawArraysIndirect);
+        case GLOpcodeDrawElements:                                  return sizeof(GLCmdDrawElements);
+        case GLOpcodeDrawElementsBaseVertex:                        return sizeof(GLCmdDrawElementsBaseVertex);
+        case GLOpcodeDrawElementsInstanced:                         return sizeof(GLCmdDrawElementsInstanced);
+        case GLOpcodeDrawElementsInstancedBaseVertex:               return sizeof(GLCmdDrawElementsInstancedBaseVertex);
+        case GLOpcodeDrawElementsInstancedBaseVertexBaseInstance:   return sizeof(GLCmdDrawElementsInstancedBaseVertexBaseInstance);
+        case GLOpcodeDrawElementsIndirect:                          return sizeof(GLCmdDrawElementsIndirect);
+        case GLOpcodeMultiDrawArraysIndirect:                       return sizeof(GLCmdMultiDrawArraysIndirect);
+        case GLOpcodeMultiDrawElementsIndirect:                     return sizeof(GLCmdMultiDrawElementsIndirect);
+        case GLOpcodeMultiDrawArraysIndirectCount:                  return sizeof(GLCmdMultiDrawArraysIndirectCount);
+        case GLOpcodeMultiDrawElementsIndirectCount:                return sizeof(GLCmdMultiDrawElementsIndirectCount);
+        case GLOpcodeDrawTransformFeedback:                         return sizeof(GLCmdDrawTransformFeedback);
+        case GLOpcodeDispatchCompute:                               return sizeof(GLCmdDispatchCompute);
+        case GLOpcodeDispatchComputeIndirect:                       return sizeof(GLCmdDispatchComputeIndirect);
+        case GLOpcodeBindTexture:                                   return sizeof(GLCmdBindTexture);
+        case GLOpcodeBindImageTexture:                              return sizeof(GLCmdBindImageTexture);
+        case GLOpcodeBindSampler:                                   return sizeof(GLCmdBindSampler);
+        #ifdef LLGL_GL_ENABLE_OPENGL2X
+        case GLOpcodeBindGL2XSampler:                               return sizeof(GLCmdBindGL2XSampler);
+        #endif
+        case GLOpcodeUnbindResources:                               return sizeof(GLCmdUnbindResources);
+        case GLOpcodePushDebugGroup:
+        {
+            auto cmd = reinterpret_cast<const GLCmdPushDebugGroup*>(pc);
+            return (sizeof(*cmd) + cmd->length + 1);
+        }
+        case GLOpcodePopDebugGroup:                                 return 0;
+        default:                                                    return 0;
+    }
+}
+
+// Returns true if the specified command does not modify viewports, scissors, vertex arrays, textures, or samplers.
+static bool IsTrackedStateNeutral(const GLOpcode opcode)
+{
+    switch (opcode)
+    {
+        case GLOpcodeClearColor:
+        case GLOpcodeClearDepth:
+        case GLOpcodeClearStencil:
+        case GLOpcodeInvalidateAttachments:
+        case GLOpcodeBindBufferBase:
+        case GLOpcodeBindBuffersBase:
+        case GLOpcodeBeginTransformFeedback:
+        case GLOpcodeBeginTransformFeedbackNV:
+        case GLOpcodeEndTransformFeedback:
+        case GLOpcodeEndTransformFeedbackNV:
+        case GLOpcodeBindTransformFeedback:
+        case GLOpcodeSetBlendColor:
+        case GLOpcodeSetStencilRef:
+        case GLOpcodeSetUniforms:
+        case GLOpcodeBeginQuery:
+        case GLOpcodeEndQuery:
+        case GLOpcodeBeginConditionalRender:
+        case GLOpcodeEndConditionalRender:
+        case GLOpcodeDrawArrays:
+        case GLOpcodeDrawArraysInstanced:
+        case GLOpcodeDrawArraysInstancedBaseInstance:
+        case GLOpcodeDrawArraysIndirect:
+        case GLOpcodeDrawElements:
+        case GLOpcodeDrawElementsBaseVertex:
+        case GLOpcodeDrawElementsInstanced:
+        case GLOpcodeDrawElementsInstancedBaseVertex:
+        case GLOpcodeDrawElementsInstancedBaseVertexBaseInstance:
+        case GLOpcodeDrawElementsIndirect:
+        case GLOpcodeMultiDrawArraysIndirect:
+        case GLOpcodeMultiDrawElementsIndirect:
+        case GLOpcodeMultiDrawArraysIndirectCount:
+        case GLOpcodeMultiDrawElementsIndirectCount:
+        case GLOpcodeDrawTransformFeedback:
+        case GLOpcodeDispatchCompute:
+        case GLOpcodeDispatchComputeIndirect:
+        case GLOpcodeBindImageTexture:
+        case GLOpcodePushDebugGroup:
+        case GLOpcodePopDebugGroup:
+            return true;
+        default:
+            return false;
+    }
+}
+
+#if defined LLGL_GLEXT_MULTI_DRAW_INDIRECT && !defined __APPLE__
+
+// Returns the size (in bytes) of the specified GL index type.
+static GLintptr GetIndexTypeSize(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:  return 1;
+        case GL_UNSIGNED_SHORT: return 2;
+        default:                return 4;
+    }
+}
+
+#endif // /LLGL_GLEXT_MULTI_DRAW_INDIRECT
+
+// Converts the specified non-indexed draw command into indirect arguments. Returns false if the opcode does not denote a non-indirect non-indexed draw command.
+static bool GetDrawArraysArguments(const GLOpcode opcode, const void* pc, GLenum& mode, DrawIndirectArguments& args)
+{
+    args.numInstances   = 1;
+    args.firstInstance  = 0;
+
+    switch (opcode)
+    {
+        case GLOpcodeDrawArrays:
+        {
+            auto cmd = reinterpret_cast<const GLCmdDrawArrays*>(pc);
+            mode                = cmd->mode;
+            args.numVertices    = static_cast<std::uint32_t>(cmd->count);
+            args.firstVertex    = static_cast<std::uint32_t>(cmd->first);
+        }
+        return true;
+
+        case GLOpcodeDrawArraysInstanced:
+        {
+            auto cmd = reinterpret_cast<const GLCmdDrawArraysInstanced*>(pc);
+            mode                = cmd->mode;
+            args.numVertices    = static_cast<std::uint32_t>(cmd->count);
+            args.numInstances   = static_cast<std::uint32_t>(cmd->instancecount);
+            args.firstVertex    = static_cast<std::uint32_t>(cmd->first);
+        }
+        return true;
+
+        case GLOpcodeDrawArraysInstancedBaseInstance:
+        {
+            auto cmd = reinterpret_cast<const GLCmdDrawArraysInstancedBaseInstance*>(pc);
+            mode                = cmd->mode;
+            args.numVertices    = static_cast<std::uint32_t>(cmd->count);
+            args.numInstances   = static_cast<std::uint32_t>(cmd->instancecount);
+            args.firstVertex    = static_cast<std::uint32_t>(cmd->first);
+            args.firstInstance  = cmd->baseinstance;
+        }
+        return true;
+
+        default:
+        return false;
+    }
+}
+
+// Converts the specified indexed draw command into indirect arguments. Returns false if the opcode does not denote a non-indirect indexed draw command.
+static bool GetDrawElementsArguments(const GLOpcode opcode, const void* pc, GLenum& mode, GLenum& type, const GLvoid*& indices, DrawIndexedIndirectArguments& args)
+{
+    args.numInstances   = 1;
+    args.vertexOffset   = 0;
+    args.firstInstance  = 0;
+
+    switch (opcode)
+    {
+        case GLOpcodeDrawElements:
+        {
+            auto cmd = reinterpret_cast<const GLCmdDrawElements*>(pc);
+            mode                = cmd->mode;
+            type                = cmd->type;
+            indices             = cmd->indices;
+            args.numIndices     = static_cast<std::uint32_t>(cmd->count);
+        }
+        return true;
+
+        case GLOpcodeDrawElementsBaseVertex:
+        {
+            auto cmd = reinterpret_cast<const GLCmdDrawElementsBaseVertex*>(pc);
+            mode                = cmd->mode;
+            type                = cmd->type;
+            indices             = cmd->indices;
+            args.numIndices     = static_cast<std::uint32_t>(cmd->count);
+            args.vertexOffset   = cmd->basevertex;
+        }
+        return true;
+
+        case GLOpcodeDrawElementsInstanced:
+        {
+            auto cmd = reinterpret_cast<const GLCmdDrawElementsInstanced*>(pc);
+            mode                = cmd->mode;
+            type                = cmd->type;
+            indices             = cmd->indices;
+            args.numIndices     = static_cast<std::uint32_t>(cmd->count);
+            args.numInstances   = static_cast<std::uint32_t>(cmd->instancecount);
+        }
+        return true;
+
+        case GLOpcodeDrawElementsInstancedBaseVertex:
+        {
+            auto cmd = reinterpret_cast<const GLCmdDrawElementsInstancedBaseVertex*>(pc);
+            mode                = cmd->mode;
+            type                = cmd->type;
+            indices             = cmd->indices;
+            args.numIndices     = static_cast<std::uint32_t>(cmd->count);
+            args.numInstances   = static_cast<std::uint32_t>(cmd->instancecount);
+            args.vertexOffset   = cmd->basevertex;
+        }
+        return true;
+
+        case GLOpcodeDrawElementsInstancedBaseVertexBaseInstance:
+        {
+            auto cmd = reinterpret_cast<const GLCmdDrawElementsInstancedBaseVertexBaseInstance*>(pc);
+            mode                = cmd->mode;
+            type                = cmd->type;
+            indices             = cmd->indices;
+            args.numIndices     = static_cast<std::uint32_t>(cmd->count);
+            args.numInstances   = static_cast<std::uint32_t>(cmd->instancecount);
+            args.vertexOffset   = cmd->basevertex;
+            args.firstInstance  = cmd->baseinstance;
+        }
+        return true;
+
+        default:
+        return false;
+    }
+}
+
+void GLCommandOptimizer::Optimize(const GLVirtualCommandBuffer& input, GLVirtualCommandBuffer& output, GLuint indirectBufferID)
+{
+    output_             = &output;
+    indirectBufferID_   = indirectBufferID;
+    indirectArgs_.clear();
+
+    /* Reset tracked state since nothing is known about the state the command buffer will be executed with */
+    InvalidateTrackedState();
+
+    for (const auto& chunk : input)
+    {
+        auto pc     = chunk.data;
+        auto pcEnd  = chunk.data + chunk.size;
+
+        while (pc < pcEnd)
+        {
+            /* Read opcode */
+            const GLOpcode opcode = *reinterpret_cast<const GLOpcode*>(pc);
+            pc += sizeof(GLOpcode);
+
+            /* Process command and increment program counter */
+            const std::size_t size = GetGLCommandSize(opcode, pc);
+            ProcessCommand(opcode, pc, size);
+            pc += size;
+        }
+    }
+
+    FlushPendingCommands();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void GLCommandOptimizer::ProcessCommand(const GLOpcode opcode, const void* pc, std::size_t size)
+{
+    /* Try to extend pending runs of commands; those are flushed when a command breaks the run */
+    if (AppendToPendingBufferBases(opcode, pc))
+        return;
+    FlushPendingBufferBases();
+
+    if (AppendToPendingDraws(opcode, pc))
+        return;
+    FlushPendingDraws();
+
+    /* Drop commands that have no effect */
+    if (IsRedundantCommand(opcode, pc))
+        return;
+
+    EmitCommand(opcode, pc, size);
+}
+
+bool GLCommandOptimizer::AppendToPendingBufferBases(const GLOpcode opcode, const void* pc)
+{
+    if (opcode != GLOpcodeBindBufferBase)
+        return false;
+
+    auto cmd = reinterpret_cast<const GLCmdBindBufferBase*>(pc);
+
+    /* Draws recorded before this binding must be emitted first, since they must still read the previously bound buffers */
+    FlushPendingDraws();
+
+    if (!pendingBufferBases_.empty())
+    {
+        /* Only consecutive binding slots of the same target can be merged into a single range */
+        const GLCmdBindBufferBase* last = pendingBufferBases_.back();
+        if (last->target != cmd->target || last->index + 1 != cmd->index)
+            FlushPendingBufferBases();
+    }
+
+    pendingBufferBases_.push_back(cmd);
+    return true;
+}
+
+bool GLCommandOptimizer::AppendToPendingDraws(const GLOpcode opcode, const void* pc)
+{
+    GLenum                          mode        = 0;
+    GLenum                          type        = 0;
+    const GLvoid*                   indices     = nullptr;
+    DrawIndexedIndirectArguments    indexedArgs;
+    DrawIndirectArguments           args;
+
+    const bool isIndexed = GetDrawElementsArguments(opcode, pc, mode, type, indices, indexedArgs);
+    if (!isIndexed && !GetDrawArraysArguments(opcode, pc, mode, args))
+        return false;
+
+    /* Draw commands can only be fused if they share the same primitive topology and index type */
+    if (!pendingDraws_.commands.empty() && (pendingDraws_.isIndexed != isIndexed || pendingDraws_.mode != mode || pendingDraws_.type != type))
+        FlushPendingDraws();
+
+    pendingDraws_.isIndexed = isIndexed;
+    pendingDraws_.mode      = mode;
+    pendingDraws_.type      = type;
+    pendingDraws_.commands.push_back(PendingCommand{ opcode, pc });
+
+    return true;
+}
+
+void GLCommandOptimizer::FlushPendingBufferBases()
+{
+    if (pendingBufferBases_.empty())
+        return;
+
+    if (pendingBufferBases_.size() == 1)
+    {
+        /* Emit single binding as is */
+        EmitCommand(GLOpcodeBindBufferBase, pendingBufferBases_.front(), sizeof(GLCmdBindBufferBase));
+    }
+    else
+    {
+        /* Merge consecutive bindings into one multi-bind range */
+        const auto count = static_cast<GLsizei>(pendingBufferBases_.size());
+        std::vector<char> data(sizeof(GLCmdBindBuffersBase) + sizeof(GLuint)*pendingBufferBases_.size());
+
+        auto cmd = reinterpret_cast<GLCmdBindBuffersBase*>(data.data());
+        {
+            cmd->target = pendingBufferBases_.front()->target;
+            cmd->first  = pendingBufferBases_.front()->index;
+            cmd->count  = count;
+        }
+        auto buffers = reinterpret_cast<GLuint*>(cmd + 1);
+        for (GLsizei i = 0; i < count; ++i)
+            buffers[i] = pendingBufferBases_[i]->id;
+
+        EmitCommand(GLOpcodeBindBuffersBase, data.data(), data.size());
+    }
+
+    pendingBufferBases_.clear();
+}
+
+void GLCommandOptimizer::FlushPendingDraws()
+{
+    if (pendingDraws_.commands.empty())
+        return;
+
+    bool fused = false;
+
+    #if defined LLGL_GLEXT_MULTI_DRAW_INDIRECT && !defined __APPLE__
+
+    if (indirectBufferID_ != 0 && pendingDraws_.commands.size() > 1 && HasExtension(GLExt::ARB_multi_draw_indirect))
+    {
+        if (pendingDraws_.isIndexed)
+            fused = FuseDrawElements();
+        else
+            fused = FuseDrawArrays();
+    }
+
+    #endif // /LLGL_GLEXT_MULTI_DRAW_INDIRECT
+
+    if (!fused)
+    {
+        /* Emit draw commands as they were recorded */
+        for (const auto& pending : pendingDraws_.commands)
+            EmitCommand(pending.opcode, pending.cmd, GetGLCommandSize(pending.opcode, pending.cmd));
+    }
+
+    pendingDraws_.commands.clear();
+}
+
+#if defined LLGL_GLEXT_MULTI_DRAW_INDIRECT && !defined __APPLE__
+
+bool GLCommandOptimizer::FuseDrawArrays()
+{
+    /* Convert all draw commands into indirect arguments */
+    const std::size_t firstArg = indirectArgs_.size();
+
+    for (const auto& pending : pendingDraws_.commands)
+    {
+        GLenum                  mode = 0;
+        DrawIndirectArguments   args;
+        GetDrawArraysArguments(pending.opcode, pending.cmd, mode, args);
+        AppendIndirectArguments(&args, sizeof(args));
+    }
+
+    /* Emit single multi-draw command that sources the arguments from the internal indirect buffer */
+    GLCmdMultiDrawArraysIndirect cmd;
+    {
+        cmd.id          = indirectBufferID_;
+        cmd.mode        = pendingDraws_.mode;
+        cmd.indirect    = reinterpret_cast<const GLvoid*>(firstArg);
+        cmd.drawcount   = static_cast<GLsizei>(pendingDraws_.commands.size());
+        cmd.stride      = 0;
+    }
+    EmitCommand(GLOpcodeMultiDrawArraysIndirect, &cmd, sizeof(cmd));
+
+    return true;
+}
+
+bool GLCommandOptimizer::FuseDrawElements()
+{
+    /* Convert all draw commands into indirect arguments; only index offsets that are a multiple of the index size can be expressed as 'firstIndex' */
+    const GLintptr indexSize = GetIndexTypeSize(pendingDraws_.type);
+    const std::size_t firstArg = indirectArgs_.size();
+
+    for (const auto& pending : pendingDraws_.commands)
+    {
+        GLenum                          mode    = 0;
+        GLenum                          type    = 0;
+        const GLvoid*                   indices = nullptr;
+        DrawIndexedIndirectArguments    args;
+
+        GetDrawElementsArguments(pending.opcode, pending.cmd, mode, type, indices, args);
+
+        const GLintptr indicesOffset = reinterpret_cast<GLintptr>(indices);
+        if (indicesOffset % indexSize != 0)
+        {
+            /* Discard arguments of incompatible draw commands */
+            indirectArgs_.resize(firstArg);
+            return false;
+        }
+
+        args.firstIndex = static_cast<std::uint32_t>(indicesOffset / indexSize);
+        AppendIndirectArguments(&args, sizeof(args));
+    }
+
+    /* Emit single multi-draw command that sources the arguments from the internal indirect buffer */
+    GLCmdMultiDrawElementsIndirect cmd;
+    {
+        cmd.id          = indirectBufferID_;
+        cmd.mode        = pendingDraws_.mode;
+        cmd.type        = pendingDraws_.type;
+        cmd.indirect    = reinterpret_cast<const GLvoid*>(firstArg);
+        cmd.drawcount   = static_cast<GLsizei>(pendingDraws_.commands.size());
+        cmd.stride      = 0;
+    }
+    EmitCommand(GLOpcodeMultiDrawElementsIndirect, &cmd, sizeof(cmd));
+
+    return true;
+}
+
+void GLCommandOptimizer::AppendIndirectArguments(const void* args, std::size_t size)
+{
+    const char* bytes = static_cast<const char*>(args);
+    indirectArgs_.insert(indirectArgs_.end(), bytes, bytes + size);
+}
+
+#endif // /LLGL_GLEXT_MULTI_DRAW_INDIRECT
+
+void GLCommandOptimizer::FlushPendingCommands()
+{
+    FlushPendingBufferBases();
+    FlushPendingDraws();
+}
+
+bool GLCommandOptimizer::IsRedundantCommand(const GLOpcode opcode, const void* pc)
+{
+    switch (opcode)
+    {
+        case GLOpcodeViewport:
+        {
+            auto cmd = reinterpret_cast<const GLCmdViewport*>(pc);
+            if (hasViewport_ && ::memcmp(&viewport_, cmd, sizeof(GLCmdViewport)) == 0)
+                return true;
+            hasViewport_    = true;
+            viewport_       = *cmd;
+            return false;
+        }
+
+        case GLOpcodeViewportArray:
+        {
+            hasViewport_ = false;
+            return false;
+        }
+
+        case GLOpcodeScissor:
+        {
+            auto cmd = reinterpret_cast<const GLCmdScissor*>(pc);
+            if (hasScissor_ && ::memcmp(&scissor_, cmd, sizeof(GLCmdScissor)) == 0)
+                return true;
+            hasScissor_     = true;
+            scissor_        = *cmd;
+            return false;
+        }
+
+        case GLOpcodeScissorArray:
+        {
+            hasScissor_ = false;
+            return false;
+        }
+
+        case GLOpcodeBindVertexArray:
+        {
+            auto cmd = reinterpret_cast<const GLCmdBindVertexArray*>(pc);
+            if (hasVertexArray_ && vertexArray_ == cmd->vertexArray)
+                return true;
+            hasVertexArray_ = true;
+            vertexArray_    = cmd->vertexArray;
+            return false;
+        }
+
+        case GLOpcodeBindVertexArrayWithOffset:
+        {
+            /* Vertex buffer offsets are not tracked, so the next vertex array must be bound again */
+            hasVertexArray_ = false;
+            return false;
+        }
+
+        case GLOpcodeBindTexture:
+        {
+            auto cmd = reinterpret_cast<const GLCmdBindTexture*>(pc);
+            if (cmd->slot < boundTextures_.size() && boundTextures_[cmd->slot] == cmd->texture)
+                return true;
+            if (cmd->slot >= boundTextures_.size())
+                boundTextures_.resize(cmd->slot + 1u, nullptr);
+            boundTextures_[cmd->slot] = cmd->texture;
+            return false;
+        }
+
+        case GLOpcodeBindSampler:
+        {
+            auto cmd = reinterpret_cast<const GLCmdBindSampler*>(pc);
+            if (cmd->layer < boundSamplers_.size() && boundSamplers_[cmd->layer] == cmd->sampler)
+                return true;
+            if (cmd->layer >= boundSamplers_.size())
+                boundSamplers_.resize(cmd->layer + 1u, g_unknownSamplerID);
+            boundSamplers_[cmd->layer] = cmd->sampler;
+            return false;
+        }
+
+        default:
+        {
+            /* Forget all tracked state if this command might have modified it */
+            if (!IsTrackedStateNeutral(opcode))
+                InvalidateTrackedState();
+            return false;
+        }
+    }
+}
+
+void GLCommandOptimizer::InvalidateTrackedState()
+{
+    hasViewport_    = false;
+    hasScissor_     = false;
+    hasVertexArray_ = false;
+    boundTextures_.clear();
+    boundSamplers_.clear();
+}
+
+void GLCommandOptimizer::EmitCommand(const GLOpcode opcode, const void* pc, std::size_t size)
+{
+    output_->AppendCommand(opcode, pc, size);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,123 @@
+/*
+ * GLCommandOptimizer.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GL_COMMAND_OPTIMIZER_H
+#define LLGL_GL_COMMAND_OPTIMIZER_H
+
+
+#include "GLDeferredCommandBuffer.h"
+#include "GLCommand.h"
+#include <LLGL/IndirectArguments.h>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/*
+Peephole optimizer for recorded GL command streams.
+Drops redundant state changes, merges consecutive buffer bindings into multi-bind ranges,
+and fuses back-to-back draw commands into a single 'glMultiDrawArraysIndirect' or 'glMultiDrawElementsIndirect' call.
+The optimizer can be re-used for multiple command streams; its containers keep their capacity, so re-optimizing a similar stream does not allocate memory.
+*/
+class GLCommandOptimizer
+{
+
+    public:
+
+        /*
+        Writes the optimized version of the input command stream into the output command buffer.
+        \param[in] indirectBufferID Specifies the GL buffer that will hold the arguments of fused draw commands. If this is zero, no draw commands will be fused.
+        */
+        void Optimize(const GLVirtualCommandBuffer& input, GLVirtualCommandBuffer& output, GLuint indirectBufferID = 0);
+
+        /*
+        Returns the arguments of all fused draw commands that must be uploaded into the indirect buffer before the output can be executed.
+        This is a tightly packed sequence of DrawIndirectArguments and DrawIndexedIndirectArguments structures.
+        */
+        inline const std::vector<char>& GetIndirectArguments() const
+        {
+            return indirectArgs_;
+        }
+
+    private:
+
+        struct PendingCommand
+        {
+            GLOpcode    opcode;
+            const void* cmd;
+        };
+
+        struct PendingDraws
+        {
+            bool                        isIndexed   = false;
+            GLenum                      mode        = 0;
+            GLenum                      type        = 0;
+            std::vector<PendingCommand> commands;
+        };
+
+    private:
+
+        void ProcessCommand(const GLOpcode opcode, const void* pc, std::size_t size);
+
+        // Returns true if the command with the specified opcode was consumed by one of the pending runs.
+        bool AppendToPendingBufferBases(const GLOpcode opcode, const void* pc);
+        bool AppendToPendingDraws(const GLOpcode opcode, const void* pc);
+
+        void FlushPendingBufferBases();
+        void FlushPendingDraws();
+        void FlushPendingCommands();
+
+        #if defined LLGL_GLEXT_MULTI_DRAW_INDIRECT && !defined __APPLE__
+
+        // Emits the pending draw commands as a single multi-draw command. Returns false if the pending draw commands cannot be fused.
+        bool FuseDrawArrays();
+        bool FuseDrawElements();
+
+        void AppendIndirectArguments(const void* args, std::size_t size);
+
+        #endif // /LLGL_GLEXT_MULTI_DRAW_INDIRECT
+
+        // Returns true if the specified command can be dropped because it has no effect. Otherwise, the tracked state is updated.
+        bool IsRedundantCommand(const GLOpcode opcode, const void* pc);
+
+        void InvalidateTrackedState();
+
+        void EmitCommand(const GLOpcode opcode, const void* pc, std::size_t size);
+
+    private:
+
+        GLVirtualCommandBuffer*                     output_             = nullptr;
+        GLuint                                      indirectBufferID_   = 0;
+
+        std::vector<char>                           indirectArgs_;
+
+        // At most one of these pending runs is non-empty at a time, so the commands are emitted in the order they were recorded.
+        std::vector<const GLCmdBindBufferBase*>     pendingBufferBases_;
+        PendingDraws                                pendingDraws_;
+
+        bool                                        hasViewport_        = false;
+        GLCmdViewport                               viewport_;
+        bool                                        hasScissor_         = false;
+        GLCmdScissor                                scissor_;
+        bool                                        hasVertexArray_     = false;
+        const GLVertexArrayObject*                  vertexArray_        = nullptr;
+        std::vector<const GLTexture*>               boundTextures_;
+        std::vector<GLuint>                         boundSamplers_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
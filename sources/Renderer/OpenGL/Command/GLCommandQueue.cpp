@@ -12,11 +12,14 @@
 #include "../RenderState/GLFence.h"
 #include "../RenderState/GLQueryHeap.h"
 #include "../RenderState/GLStateManager.h"
+#include "../Platform/GLUploadWorker.h"
 #include "../../CheckedCast.h"
 #include "../Ext/GLExtensionRegistry.h"
+#include "../../../Core/ProfileZone.h"
 #include <algorithm>
 #include <cstring>
 #include <LLGL/Utils/ForRange.h>
+#include <LLGL/Timer.h>
 
 
 namespace LLGL
@@ -32,6 +35,8 @@ GLCommandQueue::GLCommandQueue(GLStateManager& stateManager) :
 
 void GLCommandQueue::Submit(CommandBuffer& commandBuffer)
 {
+    LLGL_PROFILE_ZONE("Submit");
+
     /*
     Only deferred command buffers can be submitted multiple times (via GLDeferredCommandBuffer),
     otherwise the commands must be submitted immediately (via GLImmediateCommandBuffer).
@@ -39,6 +44,8 @@ void GLCommandQueue::Submit(CommandBuffer& commandBuffer)
     auto& cmdBufferGL = LLGL_CAST(const GLCommandBuffer&, commandBuffer);
     if (!cmdBufferGL.IsImmediateCmdBuffer())
     {
+        /* Make all resource uploads from the worker thread visible to this command buffer */
+        GLUploadWorker::Get().Flush();
         auto& deferredCmdBufferGL = LLGL_CAST(const GLDeferredCommandBuffer&, cmdBufferGL);
         ExecuteGLDeferredCommandBuffer(deferredCmdBufferGL, stateMngr_);
     }
@@ -173,22 +180,68 @@ bool GLCommandQueue::QueryResult(
     return false;
 }
 
+bool GLCommandQueue::QueryTimestampCalibration(TimestampCalibration& outCalibration)
+{
+    #if defined LLGL_OPENGL && defined GL_ARB_timer_query
+    if (HasExtension(GLExt::ARB_timer_query))
+    {
+        /* GL has no calibration API, so take the CPU ticks before and after the GPU timestamp to bound the deviation */
+        const std::uint64_t cpuTickBefore = Timer::Tick();
+        GLint64 gpuTimestamp = 0;
+        glGetInteger64v(GL_TIMESTAMP, &gpuTimestamp);
+        const std::uint64_t cpuTickAfter = Timer::Tick();
+
+        const std::uint64_t halfTickRange = (cpuTickAfter - cpuTickBefore) / 2;
+        outCalibration.cpuTick      = cpuTickBefore + halfTickRange;
+        outCalibration.gpuTimestamp = static_cast<std::uint64_t>(gpuTimestamp);
+        outCalibration.maxDeviation = static_cast<std::uint64_t>(static_cast<double>(halfTickRange) * 1.0e9 / static_cast<double>(Timer::Frequency()));
+        return true;
+    }
+    #endif // /GL_ARB_timer_query
+    return false;
+}
+
 /* ----- Fences ----- */
 
 void GLCommandQueue::Submit(Fence& fence)
 {
+    GLUploadWorker::Get().Flush();
     auto& fenceGL = LLGL_CAST(GLFence&, fence);
     fenceGL.Submit();
 }
 
+void GLCommandQueue::SubmitWait(Fence& /*fence*/)
+{
+    // dummy - all commands are executed on a single queue
+}
+
 bool GLCommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
 {
     auto& fenceGL = LLGL_CAST(GLFence&, fence);
     return fenceGL.Wait(timeout);
 }
 
+void GLCommandQueue::Submit(Fence& fence, std::uint64_t value)
+{
+    GLUploadWorker::Get().Flush();
+    auto& fenceGL = LLGL_CAST(GLFence&, fence);
+    fenceGL.SubmitValue(value);
+}
+
+void GLCommandQueue::SubmitWait(Fence& /*fence*/, std::uint64_t /*value*/)
+{
+    // dummy - all commands are executed on a single queue
+}
+
+bool GLCommandQueue::WaitFence(Fence& fence, std::uint64_t value, std::uint64_t timeout)
+{
+    auto& fenceGL = LLGL_CAST(GLFence&, fence);
+    return fenceGL.WaitValue(value, timeout);
+}
+
 void GLCommandQueue::WaitIdle()
 {
+    GLUploadWorker::Get().Flush();
     glFinish();
 }
 
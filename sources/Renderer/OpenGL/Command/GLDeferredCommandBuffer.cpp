@@ -7,7 +7,9 @@
 
 #include "GLDeferredCommandBuffer.h"
 #include "GLCommand.h"
+#include "GLCommandOptimizer.h"
 #include <LLGL/Constants.h>
+#include <LLGL/Utils/ForRange.h>
 
 #include "../../TextureUtils.h"
 #include "../GLSwapChain.h"
@@ -17,6 +19,7 @@
 #include "../Ext/GLExtensionRegistry.h"
 #include "../../CheckedCast.h"
 #include "../../../Core/Assertion.h"
+#include "../../../Core/CoreUtils.h"
 
 #include "../Shader/GLShaderPipeline.h"
 
@@ -35,6 +38,7 @@
 #include "../RenderState/GLResourceHeap.h"
 #include "../RenderState/GLRenderPass.h"
 #include "../RenderState/GLQueryHeap.h"
+#include "../../../Core/ProfileZone.h"
 
 #include <algorithm>
 #include <string.h>
@@ -55,6 +59,15 @@ GLDeferredCommandBuffer::GLDeferredCommandBuffer(long flags, std::size_t initial
 {
 }
 
+GLDeferredCommandBuffer::~GLDeferredCommandBuffer()
+{
+    if (indirectBufferID_ != 0)
+    {
+        glDeleteBuffers(1, &indirectBufferID_);
+        GLStateManager::Get().NotifyBufferRelease(indirectBufferID_, GLBufferTarget::DrawIndirectBuffer);
+    }
+}
+
 /* ----- Encoding ----- */
 
 void GLDeferredCommandBuffer::Begin()
@@ -75,6 +88,10 @@ void GLDeferredCommandBuffer::Begin()
 
 void GLDeferredCommandBuffer::End()
 {
+    /* Optimize command stream only if its cost is amortized by multiple submissions */
+    if ((GetFlags() & CommandBufferFlags::MultiSubmit) != 0)
+        OptimizeCommands();
+
     #ifdef LLGL_ENABLE_JIT_COMPILER
 
     /* Generate native assembly only if command buffer will be submitted multiple times */
@@ -115,14 +132,14 @@ void GLDeferredCommandBuffer::UpdateBuffer(
     Buffer&         dstBuffer,
     std::uint64_t   dstOffset,
     const void*     data,
-    std::uint16_t   dataSize)
+    std::uint64_t   dataSize)
 {
-    auto cmd = AllocCommand<GLCmdBufferSubData>(GLOpcodeBufferSubData, dataSize);
+    auto cmd = AllocCommand<GLCmdBufferSubData>(GLOpcodeBufferSubData, static_cast<std::size_t>(dataSize));
     {
         cmd->buffer = LLGL_CAST(GLBuffer*, &dstBuffer);
         cmd->offset = static_cast<GLintptr>(dstOffset);
         cmd->size   = static_cast<GLsizeiptr>(dataSize);
-        ::memcpy(cmd + 1, data, dataSize);
+        ::memcpy(cmd + 1, data, static_cast<std::size_t>(dataSize));
     }
 }
 
@@ -143,6 +160,15 @@ void GLDeferredCommandBuffer::CopyBuffer(
     }
 }
 
+void GLDeferredCommandBuffer::CopyBuffer(
+    Buffer&                                 dstBuffer,
+    Buffer&                                 srcBuffer,
+    const ArrayView<BufferCopyRegion>&      regions)
+{
+    for (const BufferCopyRegion& region : regions)
+        CopyBuffer(dstBuffer, region.dstOffset, srcBuffer, region.srcOffset, region.size);
+}
+
 void GLDeferredCommandBuffer::CopyBufferFromTexture(
     Buffer&                 dstBuffer,
     std::uint64_t           dstOffset,
@@ -209,6 +235,15 @@ void GLDeferredCommandBuffer::CopyTexture(
     }
 }
 
+void GLDeferredCommandBuffer::CopyTexture(
+    Texture&                                dstTexture,
+    Texture&                                srcTexture,
+    const ArrayView<TextureCopyRegion>&     regions)
+{
+    for (const TextureCopyRegion& region : regions)
+        CopyTexture(dstTexture, region.dstLocation, srcTexture, region.srcLocation, region.extent);
+}
+
 void GLDeferredCommandBuffer::CopyTextureFromBuffer(
     Texture&                dstTexture,
     const TextureRegion&    dstRegion,
@@ -230,6 +265,15 @@ void GLDeferredCommandBuffer::CopyTextureFromBuffer(
     }
 }
 
+void GLDeferredCommandBuffer::CopyTextureFromBuffer(
+    Texture&                                    dstTexture,
+    Buffer&                                     srcBuffer,
+    const ArrayView<BufferTextureCopyRegion>&   regions)
+{
+    for (const BufferTextureCopyRegion& region : regions)
+        CopyTextureFromBuffer(dstTexture, region.textureRegion, srcBuffer, region.bufferOffset, region.rowStride, region.layerStride);
+}
+
 void GLDeferredCommandBuffer::CopyTextureFromFramebuffer(
     Texture&                dstTexture,
     const TextureRegion&    dstRegion,
@@ -249,6 +293,23 @@ void GLDeferredCommandBuffer::CopyTextureFromFramebuffer(
     }
 }
 
+void GLDeferredCommandBuffer::BlitTexture(
+    Texture&                dstTexture,
+    const TextureRegion&    dstRegion,
+    Texture&                srcTexture,
+    const TextureRegion&    srcRegion,
+    const SamplerFilter     filter)
+{
+    auto cmd = AllocCommand<GLCmdBlitTexture>(GLOpcodeBlitTexture);
+    {
+        cmd->dstTexture = LLGL_CAST(GLTexture*, &dstTexture);
+        cmd->dstRegion  = dstRegion;
+        cmd->srcTexture = LLGL_CAST(GLTexture*, &srcTexture);
+        cmd->srcRegion  = srcRegion;
+        cmd->filter     = GLTypes::Map(filter);
+    }
+}
+
 void GLDeferredCommandBuffer::GenerateMips(Texture& texture)
 {
     auto cmd = AllocCommand<GLCmdGenerateMipmap>(GLOpcodeGenerateMipmap);
@@ -355,7 +416,7 @@ void GLDeferredCommandBuffer::SetScissors(std::uint32_t numScissors, const Sciss
 
 /* ----- Input Assembly ------ */
 
-void GLDeferredCommandBuffer::SetVertexBuffer(Buffer& buffer)
+void GLDeferredCommandBuffer::SetVertexBuffer(Buffer& buffer, std::uint64_t offset)
 {
     if ((buffer.GetBindFlags() & BindFlags::VertexBuffer) != 0)
     {
@@ -368,10 +429,18 @@ void GLDeferredCommandBuffer::SetVertexBuffer(Buffer& buffer)
         }
         else
         #endif // /LLGL_GL_ENABLE_OPENGL2X
+        if (offset != 0 && bufferWithVAO.GetVertexArray().HasVertexBindings())
+        {
+            auto cmd = AllocCommand<GLCmdBindVertexArrayWithOffset>(GLOpcodeBindVertexArrayWithOffset);
+            cmd->vertexArray    = &(bufferWithVAO.GetVertexArray());
+            cmd->offset         = static_cast<GLintptr>(offset);
+        }
+        else
         {
             auto cmd = AllocCommand<GLCmdBindVertexArray>(GLOpcodeBindVertexArray);
-            cmd->vao = bufferWithVAO.GetVaoID();
+            cmd->vertexArray = &(bufferWithVAO.GetVertexArray());
         }
+        SetVertexBufferTransformFeedback(bufferWithVAO.GetTransformFeedbackID());
     }
 }
 
@@ -390,11 +459,19 @@ void GLDeferredCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
         #endif
         {
             auto cmd = AllocCommand<GLCmdBindVertexArray>(GLOpcodeBindVertexArray);
-            cmd->vao = bufferArrayWithVAO.GetVaoID();
+            cmd->vertexArray = &(bufferArrayWithVAO.GetVertexArray());
         }
+        SetVertexBufferTransformFeedback(0);
     }
 }
 
+void GLDeferredCommandBuffer::SetVertexBuffers(std::uint32_t firstSlot, std::uint32_t numBuffers, Buffer* const * buffers, const std::uint64_t* offsets)
+{
+    /* Vertex buffers are bound through the VAO of each buffer, so only a single vertex buffer at the first slot is supported */
+    if (firstSlot == 0 && numBuffers == 1)
+        SetVertexBuffer(*buffers[0], (offsets != nullptr ? offsets[0] : 0));
+}
+
 void GLDeferredCommandBuffer::SetIndexBuffer(Buffer& buffer)
 {
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
@@ -418,8 +495,17 @@ void GLDeferredCommandBuffer::SetIndexBuffer(Buffer& buffer, const Format format
 
 void GLDeferredCommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap, std::uint32_t descriptorSet)
 {
+    auto* resourceHeapGL = LLGL_CAST(GLResourceHeap*, &resourceHeap);
+
+    /* Submit memory barriers for UAVs */
+    if ((GetFlags() & CommandBufferFlags::ExplicitBarriers) == 0 && resourceHeapGL->GetBarriers() != 0)
+    {
+        auto cmdBarrier = AllocCommand<GLCmdMemoryBarrier>(GLOpcodeMemoryBarrier);
+        cmdBarrier->barriers = resourceHeapGL->GetBarriers();
+    }
+
     auto cmd = AllocCommand<GLCmdBindResourceHeap>(GLOpcodeBindResourceHeap);
-    cmd->resourceHeap   = LLGL_CAST(GLResourceHeap*, &resourceHeap);
+    cmd->resourceHeap   = resourceHeapGL;
     cmd->descriptorSet  = descriptorSet;
 }
 
@@ -433,55 +519,24 @@ void GLDeferredCommandBuffer::SetResource(std::uint32_t descriptor, Resource& re
     if (!(descriptor < bindingList.size()))
         return /*GL_INVALID_INDEX*/;
 
-    const auto& binding = bindingList[descriptor];
-    switch (binding.type)
-    {
-        case GLResourceType_Invalid:
-        break;
-
-        case GLResourceType_UBO:
-        {
-            auto& bufferGL = LLGL_CAST(GLBuffer&, resource);
-            BindBufferBase(GLBufferTarget::UniformBuffer, bufferGL, binding.slot);
-        }
-        break;
-
-        case GLResourceType_SSBO:
-        {
-            auto& bufferGL = LLGL_CAST(GLBuffer&, resource);
-            BindBufferBase(GLBufferTarget::ShaderStorageBuffer, bufferGL, binding.slot);
-        }
-        break;
-
-        case GLResourceType_Texture:
-        {
-            auto& textureGL = LLGL_CAST(GLTexture&, resource);
-            BindTexture(textureGL, binding.slot);
-        }
-        break;
+    SetResourceWithBinding(bindingList[descriptor], resource);
+}
 
-        case GLResourceType_Image:
-        {
-            auto& textureGL = LLGL_CAST(GLTexture&, resource);
-            BindImageTexture(textureGL, binding.slot);
-        }
-        break;
+void GLDeferredCommandBuffer::SetResources(std::uint32_t firstDescriptor, const ArrayView<Resource*>& resources)
+{
+    auto* pipelineLayoutGL = GetBoundPipelineLayout();
+    if (pipelineLayoutGL == nullptr)
+        return /*GL_INVALID_VALUE*/;
 
-        case GLResourceType_Sampler:
-        {
-            auto& samplerGL = LLGL_CAST(GLSampler&, resource);
-            BindSampler(samplerGL, binding.slot);
-        }
-        break;
+    const auto& bindingList = pipelineLayoutGL->GetBindings();
+    if (!(firstDescriptor < bindingList.size()))
+        return /*GL_INVALID_INDEX*/;
 
-        case GLResourceType_GL2XSampler:
-        {
-            #ifdef LLGL_GL_ENABLE_OPENGL2X
-            auto& samplerGL2X = LLGL_CAST(GL2XSampler&, resource);
-            BindGL2XSampler(samplerGL2X, binding.slot);
-            #endif // /LLGL_GL_ENABLE_OPENGL2X
-        }
-        break;
+    const std::size_t numDescriptors = std::min(resources.size(), bindingList.size() - firstDescriptor);
+    for_range(i, numDescriptors)
+    {
+        if (Resource* resource = resources[i])
+            SetResourceWithBinding(bindingList[firstDescriptor + i], *resource);
     }
 }
 
@@ -537,6 +592,16 @@ void GLDeferredCommandBuffer::ResetResourceSlots(
     }
 }
 
+void GLDeferredCommandBuffer::ResourceBarrier(std::uint32_t numBarriers, const ResourceBarrierDescriptor* barriers)
+{
+    const GLbitfield bitfield = GetMemoryBarrierBitfield(numBarriers, barriers);
+    if (bitfield != 0)
+    {
+        auto cmd = AllocCommand<GLCmdMemoryBarrier>(GLOpcodeMemoryBarrier);
+        cmd->barriers = bitfield;
+    }
+}
+
 /* ----- Render Passes ----- */
 
 void GLDeferredCommandBuffer::BeginRenderPass(
@@ -546,24 +611,41 @@ void GLDeferredCommandBuffer::BeginRenderPass(
     const ClearValue*   clearValues,
     std::uint32_t       /*swapBufferIndex*/)
 {
+    LLGL_PROFILE_ZONE("BeginRenderPass");
+
     auto cmd = AllocCommand<GLCmdBindRenderTarget>(GLOpcodeBindRenderTarget);
     {
         cmd->renderTarget = &renderTarget;
     }
     if (renderPass != nullptr)
     {
+        auto renderPassGL = LLGL_CAST(const GLRenderPass*, renderPass);
+        InvalidateAttachments(renderPassGL->GetInvalidateOnBeginMask());
         auto cmd = AllocCommand<GLCmdClearAttachmentsWithRenderPass>(GLOpcodeClearAttachmentsWithRenderPass, sizeof(ClearValue)*numClearValues);
         {
-            cmd->renderPass     = LLGL_CAST(const GLRenderPass*, renderPass);
+            cmd->renderPass     = renderPassGL;
             cmd->numClearValues = numClearValues;
             ::memcpy(cmd + 1, clearValues, sizeof(ClearValue)*numClearValues);
         }
+        SetBoundRenderPass(renderPassGL);
     }
+    else
+        SetBoundRenderPass(nullptr);
 }
 
 void GLDeferredCommandBuffer::EndRenderPass()
 {
-    // dummy
+    /* Discard attachments whose outcome is not stored to avoid writing back tile memory */
+    if (const GLRenderPass* renderPassGL = GetBoundRenderPass())
+    {
+        InvalidateAttachments(renderPassGL->GetInvalidateOnEndMask());
+        SetBoundRenderPass(nullptr);
+    }
+}
+
+void GLDeferredCommandBuffer::NextSubpass()
+{
+    /* Subpasses are read via framebuffer fetch (GL_EXT_shader_framebuffer_fetch), which is coherent between draw calls */
 }
 
 void GLDeferredCommandBuffer::Clear(long flags, const ClearValue& clearValue)
@@ -634,6 +716,31 @@ void GLDeferredCommandBuffer::SetStencilReference(std::uint32_t reference, const
     }
 }
 
+void GLDeferredCommandBuffer::SetShadingRate(const ShadingRate /*rate*/)
+{
+    // not supported by this backend
+}
+
+void GLDeferredCommandBuffer::SetCullMode(const CullMode /*cullMode*/)
+{
+    // not supported by this backend
+}
+
+void GLDeferredCommandBuffer::SetDepthState(const DepthDescriptor& /*depthDesc*/)
+{
+    // not supported by this backend
+}
+
+void GLDeferredCommandBuffer::SetStencilState(const StencilDescriptor& /*stencilDesc*/)
+{
+    // not supported by this backend
+}
+
+void GLDeferredCommandBuffer::SetPrimitiveTopology(const PrimitiveTopology /*topology*/)
+{
+    // not supported by this backend
+}
+
 void GLDeferredCommandBuffer::SetUniforms(std::uint32_t first, const void* data, std::uint16_t dataSize)
 {
     /* Data size must be a multiple of 4 bytes */
@@ -683,11 +790,12 @@ void GLDeferredCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t que
     }
 }
 
-void GLDeferredCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t /*query*/)
+void GLDeferredCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query)
 {
     auto cmd = AllocCommand<GLCmdEndQuery>(GLOpcodeEndQuery);
     {
-        cmd->queryHeap = LLGL_CAST(GLQueryHeap*, &queryHeap);
+        cmd->queryHeap  = LLGL_CAST(GLQueryHeap*, &queryHeap);
+        cmd->query      = query;
     }
 }
 
@@ -698,11 +806,39 @@ void GLDeferredCommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::ui
         cmd->id     = LLGL_CAST(const GLQueryHeap&, queryHeap).GetID(query);
         cmd->mode   = GLTypes::Map(mode);
     }
+    SetNativeRenderCondition(true);
+}
+
+void GLDeferredCommandBuffer::BeginRenderCondition(Buffer& /*buffer*/, std::uint64_t /*offset*/, const RenderConditionMode /*mode*/)
+{
+    /* GL has no conditional rendering from buffer predicates; render unconditionally */
+    SetNativeRenderCondition(false);
 }
 
 void GLDeferredCommandBuffer::EndRenderCondition()
 {
-    AllocOpcode(GLOpcodeEndConditionalRender);
+    if (HasNativeRenderCondition())
+    {
+        AllocOpcode(GLOpcodeEndConditionalRender);
+        SetNativeRenderCondition(false);
+    }
+}
+
+void GLDeferredCommandBuffer::ResolveQueries(
+    QueryHeap&      queryHeap,
+    std::uint32_t   firstQuery,
+    std::uint32_t   numQueries,
+    Buffer&         dstBuffer,
+    std::uint64_t   dstOffset)
+{
+    auto cmd = AllocCommand<GLCmdResolveQueries>(GLOpcodeResolveQueries);
+    {
+        cmd->queryHeap  = LLGL_CAST(GLQueryHeap*, &queryHeap);
+        cmd->firstQuery = firstQuery;
+        cmd->numQueries = numQueries;
+        cmd->dstBuffer  = LLGL_CAST(GLBuffer*, &dstBuffer);
+        cmd->dstOffset  = static_cast<GLintptr>(dstOffset);
+    }
 }
 
 /* ----- Stream Output ------ */
@@ -716,6 +852,15 @@ void GLDeferredCommandBuffer::EndRenderCondition()
 
 void GLDeferredCommandBuffer::BeginStreamOutput(std::uint32_t numBuffers, Buffer* const * buffers)
 {
+    /* Bind transform feedback object of the first buffer, so its number of written vertices can be drawn with DrawStreamOutput */
+    GLuint soTransformFeedback = (numBuffers > 0 ? LLGL_CAST(const GLBuffer*, buffers[0])->GetTransformFeedbackID() : 0);
+    if (soTransformFeedback != 0)
+    {
+        auto cmd = AllocCommand<GLCmdBindTransformFeedback>(GLOpcodeBindTransformFeedback);
+        cmd->id = soTransformFeedback;
+    }
+    SetStreamOutputTransformFeedback(soTransformFeedback);
+
     /* Bind transform feedback buffers */
     numBuffers = std::min(numBuffers, LLGL_MAX_NUM_SO_BUFFERS);
     BindBuffersBase(GLBufferTarget::TransformFeedbackBuffer, 0, numBuffers, buffers);
@@ -752,6 +897,14 @@ void GLDeferredCommandBuffer::EndStreamOutput()
     else
         LLGL_TRAP_TRANSFORM_FEEDBACK_NOT_SUPPORTED();
     #endif
+
+    /* Restore default transform feedback object */
+    if (GetStreamOutputTransformFeedback() != 0)
+    {
+        auto cmd = AllocCommand<GLCmdBindTransformFeedback>(GLOpcodeBindTransformFeedback);
+        cmd->id = 0;
+        SetStreamOutputTransformFeedback(0);
+    }
 }
 
 /* ----- Drawing ----- */
@@ -906,6 +1059,36 @@ void GLDeferredCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset,
     }
 }
 
+void GLDeferredCommandBuffer::DrawIndirect(
+    Buffer&         buffer,
+    std::uint64_t   offset,
+    Buffer&         countBuffer,
+    std::uint64_t   countBufferOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    #ifdef LLGL_GLEXT_INDIRECT_PARAMETERS
+    if (HasExtension(GLExt::ARB_indirect_parameters))
+    {
+        const GLintptr indirect = static_cast<GLintptr>(offset);
+        auto cmd = AllocCommand<GLCmdMultiDrawArraysIndirectCount>(GLOpcodeMultiDrawArraysIndirectCount);
+        {
+            cmd->id             = LLGL_CAST(GLBuffer&, buffer).GetID();
+            cmd->countId        = LLGL_CAST(GLBuffer&, countBuffer).GetID();
+            cmd->mode           = GetDrawMode();
+            cmd->indirect       = reinterpret_cast<const GLvoid*>(indirect);
+            cmd->drawcount      = static_cast<GLintptr>(countBufferOffset);
+            cmd->maxdrawcount   = static_cast<GLsizei>(maxNumCommands);
+            cmd->stride         = static_cast<GLsizei>(stride);
+        }
+    }
+    else
+    #endif // /LLGL_GLEXT_INDIRECT_PARAMETERS
+    {
+        ErrUnsupportedGLProc("glMultiDrawArraysIndirectCountARB");
+    }
+}
+
 void GLDeferredCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
 {
     auto cmd = AllocCommand<GLCmdDrawElementsIndirect>(GLOpcodeDrawElementsIndirect);
@@ -950,6 +1133,59 @@ void GLDeferredCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t
     }
 }
 
+void GLDeferredCommandBuffer::DrawIndexedIndirect(
+    Buffer&         buffer,
+    std::uint64_t   offset,
+    Buffer&         countBuffer,
+    std::uint64_t   countBufferOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    #ifdef LLGL_GLEXT_INDIRECT_PARAMETERS
+    if (HasExtension(GLExt::ARB_indirect_parameters))
+    {
+        const GLintptr indirect = static_cast<GLintptr>(offset);
+        auto cmd = AllocCommand<GLCmdMultiDrawElementsIndirectCount>(GLOpcodeMultiDrawElementsIndirectCount);
+        {
+            cmd->id             = LLGL_CAST(GLBuffer&, buffer).GetID();
+            cmd->countId        = LLGL_CAST(GLBuffer&, countBuffer).GetID();
+            cmd->mode           = GetDrawMode();
+            cmd->type           = GetIndexType();
+            cmd->indirect       = reinterpret_cast<const GLvoid*>(indirect);
+            cmd->drawcount      = static_cast<GLintptr>(countBufferOffset);
+            cmd->maxdrawcount   = static_cast<GLsizei>(maxNumCommands);
+            cmd->stride         = static_cast<GLsizei>(stride);
+        }
+    }
+    else
+    #endif // /LLGL_GLEXT_INDIRECT_PARAMETERS
+    {
+        ErrUnsupportedGLProc("glMultiDrawElementsIndirectCountARB");
+    }
+}
+
+void GLDeferredCommandBuffer::DrawStreamOutput()
+{
+    if (GLuint transformFeedback = GetVertexBufferTransformFeedback())
+    {
+        auto cmd = AllocCommand<GLCmdDrawTransformFeedback>(GLOpcodeDrawTransformFeedback);
+        {
+            cmd->mode   = GetDrawMode();
+            cmd->id     = transformFeedback;
+        }
+    }
+}
+
+void GLDeferredCommandBuffer::DrawMesh(std::uint32_t /*numWorkGroupsX*/, std::uint32_t /*numWorkGroupsY*/, std::uint32_t /*numWorkGroupsZ*/)
+{
+    // not supported by this backend
+}
+
+void GLDeferredCommandBuffer::DrawMeshIndirect(Buffer& /*buffer*/, std::uint64_t /*offset*/, std::uint32_t /*numCommands*/, std::uint32_t /*stride*/)
+{
+    // not supported by this backend
+}
+
 /* ----- Compute ----- */
 
 void GLDeferredCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
@@ -979,6 +1215,23 @@ void GLDeferredCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t off
     #endif
 }
 
+/* ----- Ray Tracing ----- */
+
+void GLDeferredCommandBuffer::BuildAccelerationStructure(const AccelerationStructureBuildDescriptor& /*buildDesc*/)
+{
+    // not supported by this backend
+}
+
+void GLDeferredCommandBuffer::CopyAccelerationStructure(Buffer& /*dst*/, Buffer& /*src*/, const AccelerationStructureCopyMode /*mode*/)
+{
+    // not supported by this backend
+}
+
+void GLDeferredCommandBuffer::WriteAccelerationStructureCompactedSize(Buffer& /*src*/, Buffer& /*dstBuffer*/, std::uint64_t /*dstOffset*/)
+{
+    // not supported by this backend
+}
+
 /* ----- Debugging ----- */
 
 void GLDeferredCommandBuffer::PushDebugGroup(const char* name)
@@ -1038,6 +1291,59 @@ bool GLDeferredCommandBuffer::IsPrimary() const
  * ======= Private: =======
  */
 
+void GLDeferredCommandBuffer::SetResourceWithBinding(const GLPipelineResourceBinding& binding, Resource& resource)
+{
+    switch (binding.type)
+    {
+        case GLResourceType_Invalid:
+        break;
+
+        case GLResourceType_UBO:
+        {
+            auto& bufferGL = LLGL_CAST(GLBuffer&, resource);
+            BindBufferBase(GLBufferTarget::UniformBuffer, bufferGL, binding.slot);
+        }
+        break;
+
+        case GLResourceType_SSBO:
+        {
+            auto& bufferGL = LLGL_CAST(GLBuffer&, resource);
+            BindBufferBase(GLBufferTarget::ShaderStorageBuffer, bufferGL, binding.slot);
+        }
+        break;
+
+        case GLResourceType_Texture:
+        {
+            auto& textureGL = LLGL_CAST(GLTexture&, resource);
+            BindTexture(textureGL, binding.slot);
+        }
+        break;
+
+        case GLResourceType_Image:
+        {
+            auto& textureGL = LLGL_CAST(GLTexture&, resource);
+            BindImageTexture(textureGL, binding.slot);
+        }
+        break;
+
+        case GLResourceType_Sampler:
+        {
+            auto& samplerGL = LLGL_CAST(GLSampler&, resource);
+            BindSampler(samplerGL, binding.slot);
+        }
+        break;
+
+        case GLResourceType_GL2XSampler:
+        {
+            #ifdef LLGL_GL_ENABLE_OPENGL2X
+            auto& samplerGL2X = LLGL_CAST(GL2XSampler&, resource);
+            BindGL2XSampler(samplerGL2X, binding.slot);
+            #endif // /LLGL_GL_ENABLE_OPENGL2X
+        }
+        break;
+    }
+}
+
 void GLDeferredCommandBuffer::BindBufferBase(const GLBufferTarget bufferTarget, const GLBuffer& bufferGL, std::uint32_t slot)
 {
     auto cmd = AllocCommand<GLCmdBindBufferBase>(GLOpcodeBindBufferBase);
@@ -1114,6 +1420,47 @@ void GLDeferredCommandBuffer::BindGL2XSampler(const GL2XSampler& samplerGL2X, st
 }
 #endif
 
+void GLDeferredCommandBuffer::InvalidateAttachments(std::uint32_t attachmentMask)
+{
+    if (attachmentMask != 0)
+    {
+        auto cmd = AllocCommand<GLCmdInvalidateAttachments>(GLOpcodeInvalidateAttachments);
+        {
+            cmd->attachmentMask = attachmentMask;
+        }
+    }
+}
+
+void GLDeferredCommandBuffer::OptimizeCommands()
+{
+    #if defined LLGL_GLEXT_MULTI_DRAW_INDIRECT && !defined __APPLE__
+    /* Reserve GL buffer for the arguments of fused draw commands */
+    if (indirectBufferID_ == 0 && HasExtension(GLExt::ARB_multi_draw_indirect))
+        glGenBuffers(1, &indirectBufferID_);
+    #endif
+
+    /* Write optimized commands into the secondary virtual command buffer and swap it with the original one */
+    if (!optimizer_)
+        optimizer_ = MakeUnique<GLCommandOptimizer>();
+
+    optimizedBuffer_.Clear();
+    optimizer_->Optimize(buffer_, optimizedBuffer_, indirectBufferID_);
+    buffer_.Swap(optimizedBuffer_);
+
+    /* Upload arguments of fused draw commands */
+    const auto& indirectArgs = optimizer_->GetIndirectArguments();
+    if (!indirectArgs.empty())
+    {
+        GLStateManager::Get().BindBuffer(GLBufferTarget::DrawIndirectBuffer, indirectBufferID_);
+        glBufferData(
+            GL_DRAW_INDIRECT_BUFFER,
+            static_cast<GLsizeiptr>(indirectArgs.size()),
+            indirectArgs.data(),
+            GL_STATIC_DRAW
+        );
+    }
+}
+
 void GLDeferredCommandBuffer::AllocOpcode(const GLOpcode opcode)
 {
     buffer_.AllocOpcode(opcode);
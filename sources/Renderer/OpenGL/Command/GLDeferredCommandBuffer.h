@@ -33,6 +33,8 @@ class GLSwapChain;
 class GLStateManager;
 class GLRenderPass;
 class GLShaderPipeline;
+class GLCommandOptimizer;
+struct GLPipelineResourceBinding;
 #ifdef LLGL_GL_ENABLE_OPENGL2X
 class GL2XSampler;
 #endif
@@ -49,6 +51,7 @@ class GLDeferredCommandBuffer final : public GLCommandBuffer
     public:
 
         GLDeferredCommandBuffer(long flags, std::size_t initialBufferSize = 1024);
+        ~GLDeferredCommandBuffer();
 
     public:
 
@@ -73,7 +76,7 @@ class GLDeferredCommandBuffer final : public GLCommandBuffer
         #ifdef LLGL_ENABLE_JIT_COMPILER
 
         // Returns the just-in-time compiled command buffer that can be executed natively, or null if not available.
-        inline const std::unique_ptr<JITProgram>& GetExecutable() const
+        inline const std::shared_ptr<JITProgram>& GetExecutable() const
         {
             return executable_;
         }
@@ -94,6 +97,8 @@ class GLDeferredCommandBuffer final : public GLCommandBuffer
 
     private:
 
+        void SetResourceWithBinding(const GLPipelineResourceBinding& binding, Resource& resource);
+
         void BindBufferBase(const GLBufferTarget bufferTarget, const GLBuffer& bufferGL, std::uint32_t slot);
         void BindBuffersBase(const GLBufferTarget bufferTarget, std::uint32_t first, std::uint32_t count, const Buffer *const *const buffers);
         void BindTexture(GLTexture& textureGL, std::uint32_t slot);
@@ -103,6 +108,11 @@ class GLDeferredCommandBuffer final : public GLCommandBuffer
         void BindGL2XSampler(const GL2XSampler& samplerGL2X, std::uint32_t slot);
         #endif
 
+        void InvalidateAttachments(std::uint32_t attachmentMask);
+
+        /* Rewrites the virtual command buffer with redundant commands removed and compatible draw commands fused */
+        void OptimizeCommands();
+
         /* Allocates only an opcode for empty commands */
         void AllocOpcode(const GLOpcode opcode);
 
@@ -112,13 +122,16 @@ class GLDeferredCommandBuffer final : public GLCommandBuffer
 
     private:
 
-        long                        flags_                  = 0;
-        GLVirtualCommandBuffer      buffer_;
+        long                                flags_                  = 0;
+        GLVirtualCommandBuffer              buffer_;
+        GLVirtualCommandBuffer              optimizedBuffer_;               // Swapped with buffer_ by OptimizeCommands(), so both keep their capacity for the next encoding.
+        std::unique_ptr<GLCommandOptimizer> optimizer_;
+        GLuint                              indirectBufferID_       = 0; // Indirect arguments of fused draw commands
 
         #ifdef LLGL_ENABLE_JIT_COMPILER
-        std::unique_ptr<JITProgram> executable_;
-        std::uint32_t               maxNumViewports_        = 0;
-        std::uint32_t               maxNumScissors_         = 0;
+        std::shared_ptr<JITProgram>         executable_;
+        std::uint32_t                       maxNumViewports_        = 0;
+        std::uint32_t                       maxNumScissors_         = 0;
         #endif // /LLGL_ENABLE_JIT_COMPILER
 
 };
@@ -23,6 +23,7 @@
 #include "../../../Core/Assertion.h"
 
 #include "../Shader/GLShaderProgram.h"
+#include "../Shader/GLShaderUniform.h"
 
 #include "../Texture/GLTexture.h"
 #include "../Texture/GLSampler.h"
@@ -32,6 +33,7 @@
 #include "../Texture/GLRenderTarget.h"
 #include "../Texture/GLMipGenerator.h"
 #include "../Texture/GLFramebufferCapture.h"
+#include "../Texture/GLTextureBlitter.h"
 
 #include "../Buffer/GLBufferWithVAO.h"
 #include "../Buffer/GLBufferArrayWithVAO.h"
@@ -42,6 +44,9 @@
 #include "../RenderState/GLRenderPass.h"
 #include "../RenderState/GLQueryHeap.h"
 
+#include "../Platform/GLUploadWorker.h"
+#include "../../../Core/ProfileZone.h"
+
 #include <cstring> // std::strlen
 
 #include <LLGL/Backend/OpenGL/NativeCommand.h>
@@ -51,8 +56,9 @@ namespace LLGL
 {
 
 
-GLImmediateCommandBuffer::GLImmediateCommandBuffer(GLStateManager& stateManager) :
-    stateMngr_ { &stateManager }
+GLImmediateCommandBuffer::GLImmediateCommandBuffer(GLStateManager& stateManager, long flags) :
+    stateMngr_          { &stateManager                                         },
+    explicitBarriers_   { ((flags & CommandBufferFlags::ExplicitBarriers) != 0) }
 {
 }
 
@@ -60,6 +66,8 @@ GLImmediateCommandBuffer::GLImmediateCommandBuffer(GLStateManager& stateManager)
 
 void GLImmediateCommandBuffer::Begin()
 {
+    /* Make all resource uploads from the worker thread visible to the commands that follow */
+    GLUploadWorker::Get().Flush();
     ResetRenderState();
 }
 
@@ -80,7 +88,7 @@ void GLImmediateCommandBuffer::UpdateBuffer(
     Buffer&         dstBuffer,
     std::uint64_t   dstOffset,
     const void*     data,
-    std::uint16_t   dataSize)
+    std::uint64_t   dataSize)
 {
     auto& dstBufferGL = LLGL_CAST(GLBuffer&, dstBuffer);
     dstBufferGL.BufferSubData(static_cast<GLintptr>(dstOffset), static_cast<GLsizeiptr>(dataSize), data);
@@ -103,6 +111,15 @@ void GLImmediateCommandBuffer::CopyBuffer(
     );
 }
 
+void GLImmediateCommandBuffer::CopyBuffer(
+    Buffer&                                 dstBuffer,
+    Buffer&                                 srcBuffer,
+    const ArrayView<BufferCopyRegion>&      regions)
+{
+    for (const BufferCopyRegion& region : regions)
+        CopyBuffer(dstBuffer, region.dstOffset, srcBuffer, region.srcOffset, region.size);
+}
+
 void GLImmediateCommandBuffer::CopyBufferFromTexture(
     Buffer&                 dstBuffer,
     std::uint64_t           dstOffset,
@@ -156,6 +173,15 @@ void GLImmediateCommandBuffer::CopyTexture(
     );
 }
 
+void GLImmediateCommandBuffer::CopyTexture(
+    Texture&                                dstTexture,
+    Texture&                                srcTexture,
+    const ArrayView<TextureCopyRegion>&     regions)
+{
+    for (const TextureCopyRegion& region : regions)
+        CopyTexture(dstTexture, region.dstLocation, srcTexture, region.srcLocation, region.extent);
+}
+
 void GLImmediateCommandBuffer::CopyTextureFromBuffer(
     Texture&                dstTexture,
     const TextureRegion&    dstRegion,
@@ -177,6 +203,15 @@ void GLImmediateCommandBuffer::CopyTextureFromBuffer(
     );
 }
 
+void GLImmediateCommandBuffer::CopyTextureFromBuffer(
+    Texture&                                    dstTexture,
+    Buffer&                                     srcBuffer,
+    const ArrayView<BufferTextureCopyRegion>&   regions)
+{
+    for (const BufferTextureCopyRegion& region : regions)
+        CopyTextureFromBuffer(dstTexture, region.textureRegion, srcBuffer, region.bufferOffset, region.rowStride, region.layerStride);
+}
+
 void GLImmediateCommandBuffer::CopyTextureFromFramebuffer(
     Texture&                dstTexture,
     const TextureRegion&    dstRegion,
@@ -196,6 +231,18 @@ void GLImmediateCommandBuffer::CopyTextureFromFramebuffer(
     );
 }
 
+void GLImmediateCommandBuffer::BlitTexture(
+    Texture&                dstTexture,
+    const TextureRegion&    dstRegion,
+    Texture&                srcTexture,
+    const TextureRegion&    srcRegion,
+    const SamplerFilter     filter)
+{
+    auto& dstTextureGL = LLGL_CAST(GLTexture&, dstTexture);
+    auto& srcTextureGL = LLGL_CAST(GLTexture&, srcTexture);
+    GLTextureBlitter::Get().BlitTexture(*stateMngr_, dstTextureGL, dstRegion, srcTextureGL, srcRegion, GLTypes::Map(filter));
+}
+
 void GLImmediateCommandBuffer::GenerateMips(Texture& texture)
 {
     auto& textureGL = LLGL_CAST(GLTexture&, texture);
@@ -283,7 +330,7 @@ void GLImmediateCommandBuffer::SetScissors(std::uint32_t numScissors, const Scis
 
 /* ----- Input Assembly ------ */
 
-void GLImmediateCommandBuffer::SetVertexBuffer(Buffer& buffer)
+void GLImmediateCommandBuffer::SetVertexBuffer(Buffer& buffer, std::uint64_t offset)
 {
     if ((buffer.GetBindFlags() & BindFlags::VertexBuffer) != 0)
     {
@@ -299,9 +346,11 @@ void GLImmediateCommandBuffer::SetVertexBuffer(Buffer& buffer)
         else
         #endif // /LLGL_GL_ENABLE_OPENGL2X
         {
-            /* Bind vertex array with native VAO */
-            stateMngr_->BindVertexArray(vertexBufferGL.GetVaoID());
+            /* Bind vertex array with native VAO and optional vertex buffer offset */
+            vertexBufferGL.GetVertexArray().BindWithOffset(*stateMngr_, static_cast<GLintptr>(offset));
         }
+
+        SetVertexBufferTransformFeedback(vertexBufferGL.GetTransformFeedbackID());
     }
 }
 
@@ -322,11 +371,20 @@ void GLImmediateCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
         #endif // /LLGL_GL_ENABLE_OPENGL2X
         {
             /* Bind vertex array with native VAO */
-            stateMngr_->BindVertexArray(vertexBufferArrayGL.GetVaoID());
+            vertexBufferArrayGL.GetVertexArray().Bind(*stateMngr_);
         }
+
+        SetVertexBufferTransformFeedback(0);
     }
 }
 
+void GLImmediateCommandBuffer::SetVertexBuffers(std::uint32_t firstSlot, std::uint32_t numBuffers, Buffer* const * buffers, const std::uint64_t* offsets)
+{
+    /* Vertex buffers are bound through the VAO of each buffer, so only a single vertex buffer at the first slot is supported */
+    if (firstSlot == 0 && numBuffers == 1)
+        SetVertexBuffer(*buffers[0], (offsets != nullptr ? offsets[0] : 0));
+}
+
 void GLImmediateCommandBuffer::SetIndexBuffer(Buffer& buffer)
 {
     /* Bind index buffer deferred (can only be bound to the active VAO) */
@@ -349,6 +407,15 @@ void GLImmediateCommandBuffer::SetIndexBuffer(Buffer& buffer, const Format forma
 void GLImmediateCommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap, std::uint32_t descriptorSet)
 {
     auto& resourceHeapGL = LLGL_CAST(GLResourceHeap&, resourceHeap);
+
+    #ifdef GL_ARB_shader_image_load_store
+
+    /* Submit memory barriers for UAVs */
+    if (!explicitBarriers_ && resourceHeapGL.GetBarriers() != 0)
+        glMemoryBarrier(resourceHeapGL.GetBarriers());
+
+    #endif // /GL_ARB_shader_image_load_store
+
     resourceHeapGL.Bind(*stateMngr_, descriptorSet);
 }
 
@@ -362,56 +429,24 @@ void GLImmediateCommandBuffer::SetResource(std::uint32_t descriptor, Resource& r
     if (!(descriptor < bindingList.size()))
         return /*GL_INVALID_INDEX*/;
 
-    const auto& binding = bindingList[descriptor];
-    switch (binding.type)
-    {
-        case GLResourceType_Invalid:
-        break;
-
-        case GLResourceType_UBO:
-        {
-            auto& bufferGL = LLGL_CAST(GLBuffer&, resource);
-            stateMngr_->BindBufferBase(GLBufferTarget::UniformBuffer, binding.slot, bufferGL.GetID());
-        }
-        break;
-
-        case GLResourceType_SSBO:
-        {
-            auto& bufferGL = LLGL_CAST(GLBuffer&, resource);
-            stateMngr_->BindBufferBase(GLBufferTarget::ShaderStorageBuffer, binding.slot, bufferGL.GetID());
-        }
-        break;
-
-        case GLResourceType_Texture:
-        {
-            auto& textureGL = LLGL_CAST(GLTexture&, resource);
-            stateMngr_->ActiveTexture(binding.slot);
-            stateMngr_->BindGLTexture(textureGL);
-        }
-        break;
+    SetResourceWithBinding(bindingList[descriptor], resource);
+}
 
-        case GLResourceType_Image:
-        {
-            auto& textureGL = LLGL_CAST(GLTexture&, resource);
-            stateMngr_->BindImageTexture(binding.slot, 0, textureGL.GetGLInternalFormat(), textureGL.GetID());
-        }
-        break;
+void GLImmediateCommandBuffer::SetResources(std::uint32_t firstDescriptor, const ArrayView<Resource*>& resources)
+{
+    auto* pipelineLayoutGL = GetBoundPipelineLayout();
+    if (pipelineLayoutGL == nullptr)
+        return /*GL_INVALID_VALUE*/;
 
-        case GLResourceType_Sampler:
-        {
-            auto& samplerGL = LLGL_CAST(GLSampler&, resource);
-            stateMngr_->BindSampler(binding.slot, samplerGL.GetID());
-        }
-        break;
+    const auto& bindingList = pipelineLayoutGL->GetBindings();
+    if (!(firstDescriptor < bindingList.size()))
+        return /*GL_INVALID_INDEX*/;
 
-        case GLResourceType_GL2XSampler:
-        {
-            #ifdef LLGL_GL_ENABLE_OPENGL2X
-            auto& samplerGL2X = LLGL_CAST(GL2XSampler&, resource);
-            stateMngr_->BindGL2XSampler(binding.slot, samplerGL2X);
-            #endif // /LLGL_GL_ENABLE_OPENGL2X
-        }
-        break;
+    const std::size_t numDescriptors = std::min(resources.size(), bindingList.size() - firstDescriptor);
+    for_range(i, numDescriptors)
+    {
+        if (Resource* resource = resources[i])
+            SetResourceWithBinding(bindingList[firstDescriptor + i], *resource);
     }
 }
 
@@ -461,6 +496,15 @@ void GLImmediateCommandBuffer::ResetResourceSlots(
     }
 }
 
+void GLImmediateCommandBuffer::ResourceBarrier(std::uint32_t numBarriers, const ResourceBarrierDescriptor* barriers)
+{
+    #ifdef GL_ARB_shader_image_load_store
+    const GLbitfield bitfield = GetMemoryBarrierBitfield(numBarriers, barriers);
+    if (bitfield != 0)
+        glMemoryBarrier(bitfield);
+    #endif // /GL_ARB_shader_image_load_store
+}
+
 /* ----- Render Passes ----- */
 
 void GLImmediateCommandBuffer::BeginRenderPass(
@@ -470,22 +514,38 @@ void GLImmediateCommandBuffer::BeginRenderPass(
     const ClearValue*   clearValues,
     std::uint32_t       /*swapBufferIndex*/)
 {
+    LLGL_PROFILE_ZONE("BeginRenderPass");
+
     /* Bind render target and update state manager if GL context has switched */
     auto nextStateMngr = stateMngr_;
     stateMngr_->BindRenderTarget(renderTarget, &nextStateMngr);
     stateMngr_ = nextStateMngr;
 
-    /* Clear render target attachments with render pass */
+    /* Invalidate attachments with undefined content and clear render target attachments with render pass */
     if (renderPass != nullptr)
     {
         auto renderPassGL = LLGL_CAST(const GLRenderPass*, renderPass);
+        stateMngr_->InvalidateAttachments(renderPassGL->GetInvalidateOnBeginMask());
         stateMngr_->ClearAttachmentsWithRenderPass(*renderPassGL, numClearValues, clearValues);
+        SetBoundRenderPass(renderPassGL);
     }
+    else
+        SetBoundRenderPass(nullptr);
 }
 
 void GLImmediateCommandBuffer::EndRenderPass()
 {
-    // dummy
+    /* Discard attachments whose outcome is not stored to avoid writing back tile memory */
+    if (const GLRenderPass* renderPassGL = GetBoundRenderPass())
+    {
+        stateMngr_->InvalidateAttachments(renderPassGL->GetInvalidateOnEndMask());
+        SetBoundRenderPass(nullptr);
+    }
+}
+
+void GLImmediateCommandBuffer::NextSubpass()
+{
+    /* Subpasses are read via framebuffer fetch (GL_EXT_shader_framebuffer_fetch), which is coherent between draw calls */
 }
 
 void GLImmediateCommandBuffer::Clear(long flags, const ClearValue& clearValue)
@@ -534,6 +594,31 @@ void GLImmediateCommandBuffer::SetStencilReference(std::uint32_t reference, cons
     stateMngr_->SetStencilRef(static_cast<GLint>(reference), GLTypes::Map(stencilFace));
 }
 
+void GLImmediateCommandBuffer::SetShadingRate(const ShadingRate /*rate*/)
+{
+    // not supported by this backend
+}
+
+void GLImmediateCommandBuffer::SetCullMode(const CullMode /*cullMode*/)
+{
+    // not supported by this backend
+}
+
+void GLImmediateCommandBuffer::SetDepthState(const DepthDescriptor& /*depthDesc*/)
+{
+    // not supported by this backend
+}
+
+void GLImmediateCommandBuffer::SetStencilState(const StencilDescriptor& /*stencilDesc*/)
+{
+    // not supported by this backend
+}
+
+void GLImmediateCommandBuffer::SetPrimitiveTopology(const PrimitiveTopology /*topology*/)
+{
+    // not supported by this backend
+}
+
 void GLImmediateCommandBuffer::SetUniforms(std::uint32_t first, const void* data, std::uint16_t dataSize)
 {
     /* Data size must be a multiple of 4 bytes */
@@ -553,7 +638,7 @@ void GLImmediateCommandBuffer::SetUniforms(std::uint32_t first, const void* data
             return /*GL_INVALID_INDEX*/;
 
         const auto& uniform = uniformMap[first];
-        GLSetUniformsByType(uniform.type, uniform.location, uniform.count, words);
+        GLSetUniformsCached(uniform.type, uniform.location, uniform.count, words, uniform.wordSize * 4);
 
         words += uniform.wordSize;
     }
@@ -568,11 +653,11 @@ void GLImmediateCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t qu
     queryHeapGL.Begin(query);
 }
 
-void GLImmediateCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t /*query*/)
+void GLImmediateCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query)
 {
-    /* Begin query with internal target */
+    /* End query with internal target */
     auto& queryHeapGL = LLGL_CAST(GLQueryHeap&, queryHeap);
-    queryHeapGL.End();
+    queryHeapGL.End(query);
 }
 
 void GLImmediateCommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t query, const RenderConditionMode mode)
@@ -580,20 +665,49 @@ void GLImmediateCommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::u
     #ifdef LLGL_GLEXT_CONDITIONAL_RENDER
     auto& queryHeapGL = LLGL_CAST(GLQueryHeap&, queryHeap);
     glBeginConditionalRender(queryHeapGL.GetID(query), GLTypes::Map(mode));
+    SetNativeRenderCondition(true);
     #endif
 }
 
+void GLImmediateCommandBuffer::BeginRenderCondition(Buffer& /*buffer*/, std::uint64_t /*offset*/, const RenderConditionMode /*mode*/)
+{
+    /* GL has no conditional rendering from buffer predicates; render unconditionally */
+    SetNativeRenderCondition(false);
+}
+
 void GLImmediateCommandBuffer::EndRenderCondition()
 {
     #ifdef LLGL_GLEXT_CONDITIONAL_RENDER
-    glEndConditionalRender();
+    if (HasNativeRenderCondition())
+    {
+        glEndConditionalRender();
+        SetNativeRenderCondition(false);
+    }
     #endif
 }
 
+void GLImmediateCommandBuffer::ResolveQueries(
+    QueryHeap&      queryHeap,
+    std::uint32_t   firstQuery,
+    std::uint32_t   numQueries,
+    Buffer&         dstBuffer,
+    std::uint64_t   dstOffset)
+{
+    auto& queryHeapGL = LLGL_CAST(GLQueryHeap&, queryHeap);
+    auto& dstBufferGL = LLGL_CAST(GLBuffer&, dstBuffer);
+    queryHeapGL.ResolveResults(firstQuery, numQueries, dstBufferGL, static_cast<GLintptr>(dstOffset));
+}
+
 /* ----- Stream Output ------ */
 
 void GLImmediateCommandBuffer::BeginStreamOutput(std::uint32_t numBuffers, Buffer* const * buffers)
 {
+    /* Bind transform feedback object of the first buffer, so its number of written vertices can be drawn with DrawStreamOutput */
+    GLuint soTransformFeedback = (numBuffers > 0 ? LLGL_CAST(GLBuffer*, buffers[0])->GetTransformFeedbackID() : 0);
+    if (soTransformFeedback != 0)
+        stateMngr_->BindTransformFeedback(soTransformFeedback);
+    SetStreamOutputTransformFeedback(soTransformFeedback);
+
     /* Bind transform feedback buffers */
     GLuint soTargets[LLGL_MAX_NUM_SO_BUFFERS];
     numBuffers = std::min(numBuffers, LLGL_MAX_NUM_SO_BUFFERS);
@@ -628,6 +742,13 @@ void GLImmediateCommandBuffer::EndStreamOutput()
     else if (HasExtension(GLExt::NV_transform_feedback))
         glEndTransformFeedbackNV();
     #endif
+
+    /* Restore default transform feedback object */
+    if (GetStreamOutputTransformFeedback() != 0)
+    {
+        stateMngr_->BindTransformFeedback(0);
+        SetStreamOutputTransformFeedback(0);
+    }
 }
 
 /* ----- Drawing ----- */
@@ -636,10 +757,12 @@ void GLImmediateCommandBuffer::EndStreamOutput()
 NOTE:
 In the following Draw* functions, 'indices' is from type <GLintptr> to have the same size as a pointer address on either a 32-bit or 64-bit platform.
 The indices actually store the index start offset, but must be passed to GL as a void-pointer, due to an obsolete API.
+All Draw* and Dispatch* functions flush the indexed buffer bindings first, since GLStateManager only shadows them until the next draw or compute command.
 */
 
 void GLImmediateCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t firstVertex)
 {
+    stateMngr_->FlushIndexedBufferBindings();
     glDrawArrays(
         GetDrawMode(),
         static_cast<GLint>(firstVertex),
@@ -649,6 +772,7 @@ void GLImmediateCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t fir
 
 void GLImmediateCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex)
 {
+    stateMngr_->FlushIndexedBufferBindings();
     glDrawElements(
         GetDrawMode(),
         static_cast<GLsizei>(numIndices),
@@ -659,6 +783,7 @@ void GLImmediateCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32
 
 void GLImmediateCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex, std::int32_t vertexOffset)
 {
+    stateMngr_->FlushIndexedBufferBindings();
     #ifdef LLGL_GLEXT_DRAW_ELEMENTS_BASE_VERTEX
     glDrawElementsBaseVertex(
         GetDrawMode(),
@@ -672,6 +797,7 @@ void GLImmediateCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32
 
 void GLImmediateCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances)
 {
+    stateMngr_->FlushIndexedBufferBindings();
     glDrawArraysInstanced(
         GetDrawMode(),
         static_cast<GLint>(firstVertex),
@@ -682,6 +808,7 @@ void GLImmediateCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uin
 
 void GLImmediateCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances, std::uint32_t firstInstance)
 {
+    stateMngr_->FlushIndexedBufferBindings();
     #ifdef LLGL_GLEXT_BASE_INSTANCE
     glDrawArraysInstancedBaseInstance(
         GetDrawMode(),
@@ -695,6 +822,7 @@ void GLImmediateCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uin
 
 void GLImmediateCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex)
 {
+    stateMngr_->FlushIndexedBufferBindings();
     glDrawElementsInstanced(
         GetDrawMode(),
         static_cast<GLsizei>(numIndices),
@@ -706,6 +834,7 @@ void GLImmediateCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, st
 
 void GLImmediateCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset)
 {
+    stateMngr_->FlushIndexedBufferBindings();
     #ifdef LLGL_GLEXT_DRAW_ELEMENTS_BASE_VERTEX
     glDrawElementsInstancedBaseVertex(
         GetDrawMode(),
@@ -720,6 +849,7 @@ void GLImmediateCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, st
 
 void GLImmediateCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance)
 {
+    stateMngr_->FlushIndexedBufferBindings();
     #ifdef LLGL_GLEXT_BASE_INSTANCE
     glDrawElementsInstancedBaseVertexBaseInstance(
         GetDrawMode(),
@@ -735,6 +865,7 @@ void GLImmediateCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, st
 
 void GLImmediateCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
 {
+    stateMngr_->FlushIndexedBufferBindings();
     #ifdef LLGL_GLEXT_DRAW_INDIRECT
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
     stateMngr_->BindBuffer(GLBufferTarget::DrawIndirectBuffer, bufferGL.GetID());
@@ -749,6 +880,7 @@ void GLImmediateCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset
 
 void GLImmediateCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
+    stateMngr_->FlushIndexedBufferBindings();
     #ifdef LLGL_GLEXT_DRAW_INDIRECT
     /* Bind indirect argument buffer */
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
@@ -782,8 +914,43 @@ void GLImmediateCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset
     #endif
 }
 
+void GLImmediateCommandBuffer::DrawIndirect(
+    Buffer&         buffer,
+    std::uint64_t   offset,
+    Buffer&         countBuffer,
+    std::uint64_t   countBufferOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    stateMngr_->FlushIndexedBufferBindings();
+    #ifdef LLGL_GLEXT_INDIRECT_PARAMETERS
+    if (HasExtension(GLExt::ARB_indirect_parameters))
+    {
+        /* Bind indirect argument buffer and parameter buffer for the number of draw commands */
+        auto& bufferGL      = LLGL_CAST(GLBuffer&, buffer);
+        auto& countBufferGL = LLGL_CAST(GLBuffer&, countBuffer);
+        stateMngr_->BindBuffer(GLBufferTarget::DrawIndirectBuffer, bufferGL.GetID());
+        stateMngr_->BindBuffer(GLBufferTarget::ParameterBuffer, countBufferGL.GetID());
+
+        const GLintptr indirect = static_cast<GLintptr>(offset);
+        glMultiDrawArraysIndirectCountARB(
+            GetDrawMode(),
+            reinterpret_cast<const GLvoid*>(indirect),
+            static_cast<GLintptr>(countBufferOffset),
+            static_cast<GLsizei>(maxNumCommands),
+            static_cast<GLsizei>(stride)
+        );
+    }
+    else
+    #endif // /LLGL_GLEXT_INDIRECT_PARAMETERS
+    {
+        ErrUnsupportedGLProc("glMultiDrawArraysIndirectCountARB");
+    }
+}
+
 void GLImmediateCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
 {
+    stateMngr_->FlushIndexedBufferBindings();
     #ifdef LLGL_GLEXT_DRAW_INDIRECT
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
     stateMngr_->BindBuffer(GLBufferTarget::DrawIndirectBuffer, bufferGL.GetID());
@@ -799,6 +966,7 @@ void GLImmediateCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t
 
 void GLImmediateCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
+    stateMngr_->FlushIndexedBufferBindings();
     #ifdef LLGL_GLEXT_DRAW_INDIRECT
     /* Bind indirect argument buffer */
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
@@ -834,10 +1002,65 @@ void GLImmediateCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t
     #endif
 }
 
+void GLImmediateCommandBuffer::DrawIndexedIndirect(
+    Buffer&         buffer,
+    std::uint64_t   offset,
+    Buffer&         countBuffer,
+    std::uint64_t   countBufferOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    stateMngr_->FlushIndexedBufferBindings();
+    #ifdef LLGL_GLEXT_INDIRECT_PARAMETERS
+    if (HasExtension(GLExt::ARB_indirect_parameters))
+    {
+        /* Bind indirect argument buffer and parameter buffer for the number of draw commands */
+        auto& bufferGL      = LLGL_CAST(GLBuffer&, buffer);
+        auto& countBufferGL = LLGL_CAST(GLBuffer&, countBuffer);
+        stateMngr_->BindBuffer(GLBufferTarget::DrawIndirectBuffer, bufferGL.GetID());
+        stateMngr_->BindBuffer(GLBufferTarget::ParameterBuffer, countBufferGL.GetID());
+
+        const GLintptr indirect = static_cast<GLintptr>(offset);
+        glMultiDrawElementsIndirectCountARB(
+            GetDrawMode(),
+            GetIndexType(),
+            reinterpret_cast<const GLvoid*>(indirect),
+            static_cast<GLintptr>(countBufferOffset),
+            static_cast<GLsizei>(maxNumCommands),
+            static_cast<GLsizei>(stride)
+        );
+    }
+    else
+    #endif // /LLGL_GLEXT_INDIRECT_PARAMETERS
+    {
+        ErrUnsupportedGLProc("glMultiDrawElementsIndirectCountARB");
+    }
+}
+
+void GLImmediateCommandBuffer::DrawStreamOutput()
+{
+    stateMngr_->FlushIndexedBufferBindings();
+    #ifdef LLGL_GLEXT_TRANSFORM_FEEDBACK2
+    if (GLuint transformFeedback = GetVertexBufferTransformFeedback())
+        glDrawTransformFeedback(GetDrawMode(), transformFeedback);
+    #endif // /LLGL_GLEXT_TRANSFORM_FEEDBACK2
+}
+
+void GLImmediateCommandBuffer::DrawMesh(std::uint32_t /*numWorkGroupsX*/, std::uint32_t /*numWorkGroupsY*/, std::uint32_t /*numWorkGroupsZ*/)
+{
+    // not supported by this backend
+}
+
+void GLImmediateCommandBuffer::DrawMeshIndirect(Buffer& /*buffer*/, std::uint64_t /*offset*/, std::uint32_t /*numCommands*/, std::uint32_t /*stride*/)
+{
+    // not supported by this backend
+}
+
 /* ----- Compute ----- */
 
 void GLImmediateCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
 {
+    stateMngr_->FlushIndexedBufferBindings();
     #ifdef LLGL_GLEXT_COMPUTE_SHADER
     glDispatchCompute(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
     #endif
@@ -845,6 +1068,7 @@ void GLImmediateCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint3
 
 void GLImmediateCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
 {
+    stateMngr_->FlushIndexedBufferBindings();
     #ifdef LLGL_GLEXT_COMPUTE_SHADER
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
     stateMngr_->BindBuffer(GLBufferTarget::DispatchIndirectBuffer, bufferGL.GetID());
@@ -852,6 +1076,23 @@ void GLImmediateCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t of
     #endif
 }
 
+/* ----- Ray Tracing ----- */
+
+void GLImmediateCommandBuffer::BuildAccelerationStructure(const AccelerationStructureBuildDescriptor& /*buildDesc*/)
+{
+    // not supported by this backend
+}
+
+void GLImmediateCommandBuffer::CopyAccelerationStructure(Buffer& /*dst*/, Buffer& /*src*/, const AccelerationStructureCopyMode /*mode*/)
+{
+    // not supported by this backend
+}
+
+void GLImmediateCommandBuffer::WriteAccelerationStructureCompactedSize(Buffer& /*src*/, Buffer& /*dstBuffer*/, std::uint64_t /*dstOffset*/)
+{
+    // not supported by this backend
+}
+
 /* ----- Debugging ----- */
 
 void GLImmediateCommandBuffer::PushDebugGroup(const char* name)
@@ -900,6 +1141,65 @@ bool GLImmediateCommandBuffer::IsImmediateCmdBuffer() const
 }
 
 
+/*
+ * ======= Private: =======
+ */
+
+void GLImmediateCommandBuffer::SetResourceWithBinding(const GLPipelineResourceBinding& binding, Resource& resource)
+{
+    switch (binding.type)
+    {
+        case GLResourceType_Invalid:
+        break;
+
+        case GLResourceType_UBO:
+        {
+            auto& bufferGL = LLGL_CAST(GLBuffer&, resource);
+            stateMngr_->BindBufferBase(GLBufferTarget::UniformBuffer, binding.slot, bufferGL.GetID());
+        }
+        break;
+
+        case GLResourceType_SSBO:
+        {
+            auto& bufferGL = LLGL_CAST(GLBuffer&, resource);
+            stateMngr_->BindBufferBase(GLBufferTarget::ShaderStorageBuffer, binding.slot, bufferGL.GetID());
+        }
+        break;
+
+        case GLResourceType_Texture:
+        {
+            auto& textureGL = LLGL_CAST(GLTexture&, resource);
+            stateMngr_->ActiveTexture(binding.slot);
+            stateMngr_->BindGLTexture(textureGL);
+        }
+        break;
+
+        case GLResourceType_Image:
+        {
+            auto& textureGL = LLGL_CAST(GLTexture&, resource);
+            stateMngr_->BindImageTexture(binding.slot, 0, textureGL.GetGLInternalFormat(), textureGL.GetID());
+        }
+        break;
+
+        case GLResourceType_Sampler:
+        {
+            auto& samplerGL = LLGL_CAST(GLSampler&, resource);
+            stateMngr_->BindSampler(binding.slot, samplerGL.GetID());
+        }
+        break;
+
+        case GLResourceType_GL2XSampler:
+        {
+            #ifdef LLGL_GL_ENABLE_OPENGL2X
+            auto& samplerGL2X = LLGL_CAST(GL2XSampler&, resource);
+            stateMngr_->BindGL2XSampler(binding.slot, samplerGL2X);
+            #endif // /LLGL_GL_ENABLE_OPENGL2X
+        }
+        break;
+    }
+}
+
+
 } // /namespace LLGL
 
 
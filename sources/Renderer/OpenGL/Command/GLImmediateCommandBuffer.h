@@ -21,6 +21,7 @@ class GLRenderTarget;
 class GLSwapChain;
 class GLStateManager;
 class GLRenderPass;
+struct GLPipelineResourceBinding;
 
 class GLImmediateCommandBuffer final : public GLCommandBuffer
 {
@@ -31,7 +32,7 @@ class GLImmediateCommandBuffer final : public GLCommandBuffer
 
     public:
 
-        GLImmediateCommandBuffer(GLStateManager& stateManager);
+        GLImmediateCommandBuffer(GLStateManager& stateManager, long flags);
 
     public:
 
@@ -40,7 +41,12 @@ class GLImmediateCommandBuffer final : public GLCommandBuffer
 
     private:
 
-        GLStateManager* stateMngr_ = nullptr;
+        void SetResourceWithBinding(const GLPipelineResourceBinding& binding, Resource& resource);
+
+    private:
+
+        GLStateManager* stateMngr_          = nullptr;
+        bool            explicitBarriers_   = false;
 
 };
 
@@ -49,13 +49,16 @@ enum class GLExt
     ARB_get_texture_sub_image,          // GL 4.5
     ARB_geometry_shader4,               // no procedures
     ARB_gl_spirv,                       // GL 4.6
+    ARB_indirect_parameters,            // GL 4.6
     ARB_instanced_arrays,               // GL 2.1
     ARB_internalformat_query,
     ARB_internalformat_query2,
+    ARB_invalidate_subdata,             // GL 4.3
     ARB_multitexture,                   // GL 1.2
     ARB_multi_bind,                     // GL 4.3
     ARB_multi_draw_indirect,
     ARB_occlusion_query,
+    ARB_parallel_shader_compile,
     ARB_pipeline_statistics_query,
     ARB_polygon_offset_clamp,
     ARB_program_interface_query,        // GL 4.2
@@ -77,9 +80,11 @@ enum class GLExt
     ARB_texture_storage_multisample,
     ARB_texture_view,                   // GL 4.3
     ARB_timer_query,
+    ARB_transform_feedback2,            // GL 4.0
     ARB_transform_feedback3,
     ARB_uniform_buffer_object,
     ARB_vertex_array_object,
+    ARB_vertex_attrib_binding,          // GL 4.3
     ARB_vertex_buffer_object,
     ARB_vertex_shader,
     ARB_viewport_array,
@@ -91,6 +96,7 @@ enum class GLExt
 
     /* Khronos group extensions (KHR) */
     KHR_debug,
+    KHR_parallel_shader_compile,
 
     /* Multi-vendor extensions (EXT) */
     EXT_blend_color,
@@ -100,6 +106,8 @@ enum class GLExt
     EXT_copy_texture,                   // GL 1.2
     EXT_draw_buffers2,
     EXT_gpu_shader4,                    // GL 2.0
+    EXT_multisampled_render_to_texture, // GLES only
+    EXT_shader_framebuffer_fetch,       // no procedures
     EXT_stencil_two_side,               //ATI_separate_stencil,
     EXT_texture3D,                      // GL 1.2
     EXT_texture_array,                  // no procedures
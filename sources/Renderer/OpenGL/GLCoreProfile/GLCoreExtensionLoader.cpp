@@ -15,6 +15,10 @@
 #include <string>
 #include <map>
 
+#ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+#   include <EGL/egl.h>
+#endif
+
 
 namespace LLGL
 {
@@ -35,6 +39,11 @@ bool LoadGLProc(T& procAddr, const char* procName)
     #if defined(_WIN32)
     procAddr = reinterpret_cast<T>(wglGetProcAddress(procName));
     #elif defined(__linux__)
+    #ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+    if (eglGetCurrentContext() != EGL_NO_CONTEXT)
+        procAddr = reinterpret_cast<T>(eglGetProcAddress(procName));
+    else
+    #endif
     procAddr = reinterpret_cast<T>(glXGetProcAddress(reinterpret_cast<const GLubyte*>(procName)));
     #else
     LLGL_TRAP("platform not supported for loading OpenGL extensions");
@@ -492,6 +501,13 @@ static bool DECL_LOADGLEXT_PROC(ARB_texture_view)
     return true;
 }
 
+static bool DECL_LOADGLEXT_PROC(ARB_invalidate_subdata)
+{
+    LOAD_GLPROC( glInvalidateFramebuffer    );
+    LOAD_GLPROC( glInvalidateSubFramebuffer );
+    return true;
+}
+
 static bool DECL_LOADGLEXT_PROC(ARB_sampler_objects)
 {
     LOAD_GLPROC( glGenSamplers        );
@@ -609,6 +625,18 @@ static bool DECL_LOADGLEXT_PROC(KHR_debug)
     return true;
 }
 
+static bool DECL_LOADGLEXT_PROC(KHR_parallel_shader_compile)
+{
+    LOAD_GLPROC( glMaxShaderCompilerThreadsKHR );
+    return true;
+}
+
+static bool DECL_LOADGLEXT_PROC(ARB_parallel_shader_compile)
+{
+    LOAD_GLPROC( glMaxShaderCompilerThreadsARB );
+    return true;
+}
+
 static bool DECL_LOADGLEXT_PROC(ARB_clip_control)
 {
     LOAD_GLPROC( glClipControl );
@@ -653,6 +681,15 @@ static bool DECL_LOADGLEXT_PROC(NV_transform_feedback)
     return true;
 }
 
+static bool DECL_LOADGLEXT_PROC(ARB_transform_feedback2)
+{
+    LOAD_GLPROC( glBindTransformFeedback    );
+    LOAD_GLPROC( glDeleteTransformFeedbacks );
+    LOAD_GLPROC( glGenTransformFeedbacks    );
+    LOAD_GLPROC( glDrawTransformFeedback    );
+    return true;
+}
+
 static bool DECL_LOADGLEXT_PROC(ARB_sync)
 {
     LOAD_GLPROC( glFenceSync      );
@@ -767,6 +804,23 @@ static bool DECL_LOADGLEXT_PROC(ARB_multi_draw_indirect)
     return true;
 }
 
+static bool DECL_LOADGLEXT_PROC(ARB_vertex_attrib_binding)
+{
+    LOAD_GLPROC( glBindVertexBuffer     );
+    LOAD_GLPROC( glVertexAttribFormat   );
+    LOAD_GLPROC( glVertexAttribIFormat  );
+    LOAD_GLPROC( glVertexAttribBinding  );
+    LOAD_GLPROC( glVertexBindingDivisor );
+    return true;
+}
+
+static bool DECL_LOADGLEXT_PROC(ARB_indirect_parameters)
+{
+    LOAD_GLPROC( glMultiDrawArraysIndirectCountARB   );
+    LOAD_GLPROC( glMultiDrawElementsIndirectCountARB );
+    return true;
+}
+
 static bool DECL_LOADGLEXT_PROC(ARB_get_texture_sub_image)
 {
     LOAD_GLPROC( glGetTextureSubImage           );
@@ -1040,6 +1094,7 @@ bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
     ENABLE_GLEXT( ARB_draw_buffers                 );
     ENABLE_GLEXT( EXT_draw_buffers2                );
     ENABLE_GLEXT( EXT_transform_feedback           );
+    ENABLE_GLEXT( ARB_transform_feedback2          );
     ENABLE_GLEXT( ARB_sync                         );
     ENABLE_GLEXT( ARB_polygon_offset_clamp         );
     ENABLE_GLEXT( ARB_copy_buffer                  );
@@ -1140,6 +1195,7 @@ bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
     LOAD_GLEXT( ARB_texture_multisample          );
     LOAD_GLEXT( ARB_texture_view                 );
     LOAD_GLEXT( ARB_sampler_objects              );
+    LOAD_GLEXT( ARB_invalidate_subdata           );
 
     /* Load blending extensions */
     LOAD_GLEXT( EXT_blend_minmax                 );
@@ -1156,11 +1212,14 @@ bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
     LOAD_GLEXT( ARB_multi_bind                   );
     LOAD_GLEXT( EXT_stencil_two_side             );
     LOAD_GLEXT( KHR_debug                        );
+    LOAD_GLEXT( KHR_parallel_shader_compile      );
+    LOAD_GLEXT( ARB_parallel_shader_compile      );
     LOAD_GLEXT( ARB_clip_control                 );
     LOAD_GLEXT( ARB_draw_buffers                 );
     LOAD_GLEXT( EXT_draw_buffers2                );
     LOAD_GLEXT( EXT_transform_feedback           );
     LOAD_GLEXT( NV_transform_feedback            );
+    LOAD_GLEXT( ARB_transform_feedback2          );
     LOAD_GLEXT( ARB_sync                         );
     LOAD_GLEXT( ARB_internalformat_query         );
     LOAD_GLEXT( ARB_internalformat_query2        );
@@ -1177,6 +1236,8 @@ bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
     LOAD_GLEXT( ARB_clear_buffer_object          );
     LOAD_GLEXT( ARB_draw_indirect                );
     LOAD_GLEXT( ARB_multi_draw_indirect          );
+    LOAD_GLEXT( ARB_vertex_attrib_binding        );
+    LOAD_GLEXT( ARB_indirect_parameters          );
     LOAD_GLEXT( ARB_get_texture_sub_image        );
     #ifdef LLGL_GL_ENABLE_DSA_EXT
     LOAD_GLEXT( ARB_direct_state_access          );
@@ -1193,6 +1254,7 @@ bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
     ENABLE_GLEXT( ARB_seamless_cubemap_per_texture );
     ENABLE_GLEXT( ARB_ES3_compatibility            );
     ENABLE_GLEXT( EXT_texture_array                );
+    ENABLE_GLEXT( EXT_shader_framebuffer_fetch     );
     ENABLE_GLEXT( INTEL_conservative_rasterization );
     ENABLE_GLEXT( NV_conservative_raster           );
 
@@ -122,6 +122,11 @@ DECL_GLPROC(PFNGLSAMPLEMASKIPROC,                                   glSampleMask
 
 DECL_GLPROC(PFNGLTEXTUREVIEWPROC,                                   glTextureView,                                  void,           (GLuint, GLenum, GLuint, GLenum, GLuint, GLuint, GLuint, GLuint));
 
+/* GL_ARB_invalidate_subdata */
+
+DECL_GLPROC(PFNGLINVALIDATEFRAMEBUFFERPROC,                         glInvalidateFramebuffer,                        void,           (GLenum, GLsizei, const GLenum*));
+DECL_GLPROC(PFNGLINVALIDATESUBFRAMEBUFFERPROC,                      glInvalidateSubFramebuffer,                     void,           (GLenum, GLsizei, const GLenum*, GLint, GLint, GLsizei, GLsizei));
+
 /* GL_ARB_sampler_objects */
 
 DECL_GLPROC(PFNGLGENSAMPLERSPROC,                                   glGenSamplers,                                  void,           (GLsizei, GLuint*));
@@ -454,6 +459,14 @@ DECL_GLPROC(PFNGLGETOBJECTLABELPROC,                                glGetObjectL
 DECL_GLPROC(PFNGLOBJECTPTRLABELPROC,                                glObjectPtrLabel,                               void,           (const void*, GLsizei, const GLchar*));
 DECL_GLPROC(PFNGLGETOBJECTPTRLABELPROC,                             glGetObjectPtrLabel,                            void,           (const void*, GLsizei, GLsizei*, GLchar*));
 
+/* GL_KHR_parallel_shader_compile */
+
+DECL_GLPROC(PFNGLMAXSHADERCOMPILERTHREADSKHRPROC,                   glMaxShaderCompilerThreadsKHR,                  void,           (GLuint));
+
+/* GL_ARB_parallel_shader_compile */
+
+DECL_GLPROC(PFNGLMAXSHADERCOMPILERTHREADSARBPROC,                   glMaxShaderCompilerThreadsARB,                  void,           (GLuint));
+
 /* GL_ARB_clip_control */
 
 DECL_GLPROC(PFNGLCLIPCONTROLPROC,                                   glClipControl,                                  void,           (GLenum, GLenum));
@@ -475,6 +488,13 @@ DECL_GLPROC(PFNGLTRANSFORMFEEDBACKVARYINGSNVPROC,                   glTransformF
 DECL_GLPROC(PFNGLGETVARYINGLOCATIONNVPROC,                          glGetVaryingLocationNV,                         GLint,          (GLuint, const GLchar*));
 DECL_GLPROC(PFNGLGETACTIVEVARYINGNVPROC,                            glGetActiveVaryingNV,                           void,           (GLuint, GLuint, GLsizei, GLsizei*, GLsizei*, GLenum*, GLchar*));
 
+/* GL_ARB_transform_feedback2 */
+
+DECL_GLPROC(PFNGLBINDTRANSFORMFEEDBACKPROC,                         glBindTransformFeedback,                        void,           (GLenum, GLuint));
+DECL_GLPROC(PFNGLDELETETRANSFORMFEEDBACKSPROC,                      glDeleteTransformFeedbacks,                     void,           (GLsizei, const GLuint*));
+DECL_GLPROC(PFNGLGENTRANSFORMFEEDBACKSPROC,                         glGenTransformFeedbacks,                        void,           (GLsizei, GLuint*));
+DECL_GLPROC(PFNGLDRAWTRANSFORMFEEDBACKPROC,                         glDrawTransformFeedback,                        void,           (GLenum, GLuint));
+
 /* GL_ARB_sync */
 
 DECL_GLPROC(PFNGLFENCESYNCPROC,                                     glFenceSync,                                    GLsync,         (GLenum, GLbitfield));
@@ -557,6 +577,19 @@ DECL_GLPROC(PFNGLDRAWELEMENTSINDIRECTPROC,                          glDrawElemen
 DECL_GLPROC(PFNGLMULTIDRAWARRAYSINDIRECTPROC,                       glMultiDrawArraysIndirect,                      void,           (GLenum, const void*, GLsizei, GLsizei));
 DECL_GLPROC(PFNGLMULTIDRAWELEMENTSINDIRECTPROC,                     glMultiDrawElementsIndirect,                    void,           (GLenum, GLenum, const void*, GLsizei, GLsizei));
 
+/* GL_ARB_vertex_attrib_binding */
+
+DECL_GLPROC(PFNGLBINDVERTEXBUFFERPROC,                              glBindVertexBuffer,                             void,           (GLuint, GLuint, GLintptr, GLsizei));
+DECL_GLPROC(PFNGLVERTEXATTRIBFORMATPROC,                            glVertexAttribFormat,                           void,           (GLuint, GLint, GLenum, GLboolean, GLuint));
+DECL_GLPROC(PFNGLVERTEXATTRIBIFORMATPROC,                           glVertexAttribIFormat,                          void,           (GLuint, GLint, GLenum, GLuint));
+DECL_GLPROC(PFNGLVERTEXATTRIBBINDINGPROC,                           glVertexAttribBinding,                          void,           (GLuint, GLuint));
+DECL_GLPROC(PFNGLVERTEXBINDINGDIVISORPROC,                          glVertexBindingDivisor,                         void,           (GLuint, GLuint));
+
+/* GL_ARB_indirect_parameters */
+
+DECL_GLPROC(PFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC,               glMultiDrawArraysIndirectCountARB,              void,           (GLenum, const void*, GLintptr, GLsizei, GLsizei));
+DECL_GLPROC(PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC,             glMultiDrawElementsIndirectCountARB,            void,           (GLenum, GLenum, const void*, GLintptr, GLsizei, GLsizei));
+
 /* GL_ARB_get_texture_sub_image */
 
 DECL_GLPROC(PFNGLGETTEXTURESUBIMAGEPROC,                            glGetTextureSubImage,                           void,           (GLuint, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei, GLenum, GLenum, GLsizei, void*));
@@ -200,6 +200,7 @@ static void GLGetSupportedFeatures(RenderingFeatures& features)
     features.hasInstancing                  = HasExtension(GLExt::ARB_draw_instanced);
     features.hasOffsetInstancing            = HasExtension(GLExt::ARB_base_instance);
     features.hasIndirectDrawing             = HasExtension(GLExt::ARB_draw_indirect);
+    features.hasIndirectDrawCount           = HasExtension(GLExt::ARB_indirect_parameters);
     features.hasViewportArrays              = HasExtension(GLExt::ARB_viewport_array);
     features.hasConservativeRasterization   = (HasExtension(GLExt::NV_conservative_raster) || HasExtension(GLExt::INTEL_conservative_rasterization));
     features.hasStreamOutputs               = (HasExtension(GLExt::EXT_transform_feedback) || HasExtension(GLExt::NV_transform_feedback));
@@ -207,6 +208,8 @@ static void GLGetSupportedFeatures(RenderingFeatures& features)
     features.hasPipelineCaching             = (HasExtension(GLExt::ARB_get_program_binary) && GLGetInt(GL_NUM_PROGRAM_BINARY_FORMATS) > 0);
     features.hasPipelineStatistics          = HasExtension(GLExt::ARB_pipeline_statistics_query);
     features.hasRenderCondition             = true;
+    features.hasSubpasses                   = HasExtension(GLExt::EXT_shader_framebuffer_fetch);
+    features.hasTimestampCalibration        = HasExtension(GLExt::ARB_timer_query);
 }
 
 static void GLGetFeatureLimits(const RenderingFeatures& features, RenderingLimits& limits)
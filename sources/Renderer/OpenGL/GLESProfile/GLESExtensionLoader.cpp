@@ -37,7 +37,7 @@ template <typename T>
 bool LoadGLProc(T& procAddr, const char* procName)
 {
     /* Load OpenGLES procedure address with EGL */
-    procAddr = eglGetProcAddress(procName);
+    procAddr = reinterpret_cast<T>(eglGetProcAddress(procName));
     return (procAddr != nullptr);
 }
 
@@ -64,6 +64,15 @@ using LoadGLExtensionProc = std::function<bool(const char* extName, bool abortOn
 
 /* --- Common GLES extensions --- */
 
+#ifdef GL_EXT_multisampled_render_to_texture
+static bool DECL_LOADGLEXT_PROC(GL_EXT_multisampled_render_to_texture)
+{
+    LOAD_GLPROC( glRenderbufferStorageMultisampleEXT  );
+    LOAD_GLPROC( glFramebufferTexture2DMultisampleEXT );
+    return true;
+}
+#endif
+
 /*static bool DECL_LOADGLEXT_PROC(GL_OES_tessellation_shader)
 {
     LOAD_GLPROC( glPatchParameteriOES );
@@ -178,6 +187,7 @@ bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
         ENABLE_GLEXT(ARB_ES3_compatibility);
         ENABLE_GLEXT(ARB_get_program_binary);
         ENABLE_GLEXT(ARB_shader_objects_30);
+        ENABLE_GLEXT(ARB_invalidate_subdata);
     }
 
     if (version >= 310)
@@ -186,6 +196,7 @@ bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
         ENABLE_GLEXT(ARB_program_interface_query);
         ENABLE_GLEXT(ARB_compute_shader);
         ENABLE_GLEXT(ARB_framebuffer_no_attachments);
+        ENABLE_GLEXT(ARB_vertex_attrib_binding);
     }
 
     if (version >= 320)
@@ -194,6 +205,27 @@ bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
         ENABLE_GLEXT(ARB_copy_image);
     }
 
+    #ifndef LLGL_OS_IOS
+
+    /* Enable device specific extensions without procedures */
+    if (version >= 300)
+    {
+        const GLESExtensionMap supportedExtensions = QuerySupportedOpenGLExtensions(isCoreProfile);
+        if (supportedExtensions.find("GL_EXT_shader_framebuffer_fetch") != supportedExtensions.end())
+            ENABLE_GLEXT(EXT_shader_framebuffer_fetch);
+
+        #ifdef GL_EXT_multisampled_render_to_texture
+        /* Load procedures for implicit multi-sample resolve on tile-based GPUs; use proxies on failure to detect illegal use */
+        const char* mrttExtName = "GL_EXT_multisampled_render_to_texture";
+        if (supportedExtensions.find(mrttExtName) != supportedExtensions.end() && Load_GL_EXT_multisampled_render_to_texture(mrttExtName, /*abortOnFailure:*/ false, /*usePlaceholder:*/ false))
+            ENABLE_GLEXT(EXT_multisampled_render_to_texture);
+        else
+            Load_GL_EXT_multisampled_render_to_texture(mrttExtName, /*abortOnFailure:*/ false, /*usePlaceholder:*/ true);
+        #endif
+    }
+
+    #endif // /LLGL_OS_IOS
+
     #undef ENABLE_GLEXT
 
     #if 0 //TODO
@@ -42,6 +42,13 @@ Depending on the following macros being defined, the respective implementation i
 
 #endif
 
+/* GL_EXT_multisampled_render_to_texture */
+
+#ifdef GL_EXT_multisampled_render_to_texture
+DECL_GLPROC(PFNGLRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC,             glRenderbufferStorageMultisampleEXT,            void,           (GLenum, GLsizei, GLenum, GLsizei, GLsizei));
+DECL_GLPROC(PFNGLFRAMEBUFFERTEXTURE2DMULTISAMPLEEXTPROC,            glFramebufferTexture2DMultisampleEXT,           void,           (GLenum, GLenum, GLenum, GLuint, GLint, GLsizei));
+#endif
+
 /* GL_OES_tessellation_shader */
 
 //DECL_GLPROC(PFNGLPATCHPARAMETERIPROC,                               glPatchParameteriOES,                           void,           (GLenum, GLint));
@@ -80,6 +80,10 @@ namespace LLGL
 #define GL_DRAW_INDIRECT_BUFFER 0x8F3F // GLES 3.2
 #endif
 
+#ifndef GL_PARAMETER_BUFFER_ARB
+#define GL_PARAMETER_BUFFER_ARB 0x80EE // for wrappers only
+#endif
+
 #ifndef GL_QUERY_BUFFER
 #define GL_QUERY_BUFFER 0x9192 // for wrappers only
 #endif
@@ -17,6 +17,7 @@
 #elif defined(LLGL_OS_ANDROID)
 #   include <GLES3/gl3.h>
 #   include <GLES3/gl3ext.h>
+#   include <GLES2/gl2ext.h> // GL_EXT_multisampled_render_to_texture
 #else
 #   error Unsupported platform for OpenGLES 3
 #endif
@@ -8,6 +8,7 @@
 #include "GLRenderSystem.h"
 #include "GLProfile.h"
 #include "Texture/GLMipGenerator.h"
+#include "Texture/GLTextureBlitter.h"
 #include "Texture/GLTextureViewPool.h"
 #include "Texture/GLFramebufferCapture.h"
 #include "Ext/GLExtensions.h"
@@ -19,6 +20,9 @@
 #include "Shader/GLLegacyShader.h"
 #include "Buffer/GLBufferWithVAO.h"
 #include "Buffer/GLBufferArrayWithVAO.h"
+#include "Buffer/GLStreamingBuffer.h"
+#include "Buffer/GLVertexArrayCache.h"
+#include "Platform/GLUploadWorker.h"
 #include "../CheckedCast.h"
 #include "../BufferUtils.h"
 #include "../TextureUtils.h"
@@ -30,6 +34,7 @@
 #include "Command/GLDeferredCommandBuffer.h"
 #include "RenderState/GLGraphicsPSO.h"
 #include "RenderState/GLComputePSO.h"
+#include "../../Core/ProfileZone.h"
 #include <LLGL/Utils/ForRange.h>
 
 #ifdef LLGL_OPENGL
@@ -52,26 +57,50 @@ static RendererConfigurationOpenGL GetGLProfileFromDesc(const RenderSystemDescri
 }
 
 GLRenderSystem::GLRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
-    contextMngr_  { GetGLProfileFromDesc(renderSystemDesc), renderSystemDesc.nativeHandle, renderSystemDesc.nativeHandleSize },
-    debugContext_ { ((renderSystemDesc.flags & RenderSystemFlags::DebugDevice) != 0)                                         }
-{
+    contextMngr_
+    {
+        GetGLProfileFromDesc(renderSystemDesc),
+        renderSystemDesc.nativeHandle,
+        renderSystemDesc.nativeHandleSize,
+        ((renderSystemDesc.flags & RenderSystemFlags::Headless) != 0)
+    },
+    debugContext_ { ((renderSystemDesc.flags & RenderSystemFlags::DebugDevice) != 0) },
+    debugger_     { renderSystemDesc.debugger                                        }
+{
+    if (contextMngr_.IsHeadless())
+    {
+        /* Create primary GL context immediately, since no swap-chain will ever provide one in headless mode */
+        std::shared_ptr<GLContext> context = contextMngr_.AllocContext();
+        GLContext::SetCurrent(context.get());
+        CreateGLContextDependentDevices(context->GetStateManager());
+    }
 }
 
 GLRenderSystem::~GLRenderSystem()
 {
     /* Clear all render state containers first, the rest will be deleted automatically */
+    GLUploadWorker::Get().Clear();
     GLFramebufferCapture::Get().Clear();
     GLTextureViewPool::Get().Clear();
     GLMipGenerator::Get().Clear();
+    GLTextureBlitter::Get().Clear();
     GLStatePool::Get().Clear();
+    GLVertexArrayCache::Get().Clear();
+    GLStreamingBuffer::Get().Clear();
 }
 
 /* ----- Swap-chain ----- */
 
 SwapChain* GLRenderSystem::CreateSwapChain(const SwapChainDescriptor& swapChainDesc, const std::shared_ptr<Surface>& surface)
 {
+    if (contextMngr_.IsHeadless())
+    {
+        GetMutableReport().Errorf("cannot create swap-chain for headless OpenGL render system");
+        return nullptr;
+    }
+
     const bool isFirstSwapChain = swapChains_.empty();
-    auto* swapChainGL = swapChains_.emplace<GLSwapChain>(swapChainDesc, surface, contextMngr_);
+    auto* swapChainGL = swapChains_.emplace<GLSwapChain>(swapChainDesc, surface, contextMngr_, debugger_);
 
     /* Create devices that require an active GL context */
     if (isFirstSwapChain)
@@ -92,6 +121,12 @@ CommandQueue* GLRenderSystem::GetCommandQueue()
     return commandQueue_.get();
 }
 
+CommandQueue* GLRenderSystem::GetCommandQueue(long /*queueFlags*/)
+{
+    /* Only a single command queue is supported */
+    return commandQueue_.get();
+}
+
 /* ----- Command buffers ----- */
 
 CommandBuffer* GLRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& commandBufferDesc)
@@ -101,7 +136,7 @@ CommandBuffer* GLRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor
     {
         /* Create deferred or immediate command buffer */
         if ((commandBufferDesc.flags & CommandBufferFlags::ImmediateSubmit) != 0)
-            return commandBuffers_.emplace<GLImmediateCommandBuffer>(currentGLContext->GetStateManager());
+            return commandBuffers_.emplace<GLImmediateCommandBuffer>(currentGLContext->GetStateManager(), commandBufferDesc.flags);
         else
             return commandBuffers_.emplace<GLDeferredCommandBuffer>(commandBufferDesc.flags);
     }
@@ -116,6 +151,21 @@ void GLRenderSystem::Release(CommandBuffer& commandBuffer)
 
 /* ----- Buffers ------ */
 
+// Returns true if the specified buffer is persistently mapped. This requires GL_ARB_buffer_storage; otherwise, buffers are mapped on demand.
+static bool IsPersistentBuffer(const BufferDescriptor& bufferDesc)
+{
+    #ifdef GL_ARB_buffer_storage
+    return
+    (
+        bufferDesc.cpuAccessFlags != 0 &&
+        (bufferDesc.miscFlags & MiscFlags::PersistentMapping) != 0 &&
+        HasExtension(GLExt::ARB_buffer_storage)
+    );
+    #else
+    return false;
+    #endif // /GL_ARB_buffer_storage
+}
+
 static GLbitfield GetGLBufferStorageFlags(long cpuAccessFlags)
 {
     #ifdef GL_ARB_buffer_storage
@@ -141,17 +191,33 @@ static GLbitfield GetGLBufferStorageFlags(long cpuAccessFlags)
 
 static GLenum GetGLBufferUsage(long miscFlags)
 {
+    if ((miscFlags & MiscFlags::Readback) != 0)
+        return GL_STREAM_READ;
     return ((miscFlags & MiscFlags::DynamicUsage) != 0 ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
 }
 
 static void GLBufferStorage(GLBuffer& bufferGL, const BufferDescriptor& bufferDesc, const void* initialData)
 {
+    GLbitfield storageFlags = GetGLBufferStorageFlags(bufferDesc.cpuAccessFlags);
+
+    #ifdef GL_ARB_buffer_storage
+    const bool isPersistent = IsPersistentBuffer(bufferDesc);
+    if (isPersistent)
+        storageFlags |= (GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+    #endif // /GL_ARB_buffer_storage
+
     bufferGL.BufferStorage(
         static_cast<GLsizeiptr>(bufferDesc.size),
         initialData,
-        GetGLBufferStorageFlags(bufferDesc.cpuAccessFlags),
+        storageFlags,
         GetGLBufferUsage(bufferDesc.miscFlags)
     );
+
+    #ifdef GL_ARB_buffer_storage
+    /* Map coherent memory once, so mapping this buffer neither synchronizes nor requires an explicit flush */
+    if (isPersistent)
+        bufferGL.MapBufferPersistent(static_cast<GLsizeiptr>(bufferDesc.size), (storageFlags & ~GL_DYNAMIC_STORAGE_BIT));
+    #endif // /GL_ARB_buffer_storage
 }
 
 Buffer* GLRenderSystem::CreateBuffer(const BufferDescriptor& bufferDesc, const void* initialData)
@@ -216,6 +282,7 @@ BufferArray* GLRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer*
 
 void GLRenderSystem::Release(Buffer& buffer)
 {
+    GLUploadWorker::Get().Flush();
     buffers_.erase(&buffer);
 }
 
@@ -226,19 +293,33 @@ void GLRenderSystem::Release(BufferArray& bufferArray)
 
 void GLRenderSystem::WriteBuffer(Buffer& buffer, std::uint64_t offset, const void* data, std::uint64_t dataSize)
 {
+    LLGL_PROFILE_ZONE("WriteBuffer");
+
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
-    bufferGL.BufferSubData(static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(dataSize), data);
+    GLUploadWorker& uploadWorker = GLUploadWorker::Get();
+    if (uploadWorker.IsAsyncBufferUpload(static_cast<GLsizeiptr>(dataSize)))
+        uploadWorker.WriteBuffer(bufferGL, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(dataSize), data);
+    else
+    {
+        /* Flush previous uploads first to keep writes in order */
+        uploadWorker.Flush();
+        bufferGL.BufferSubData(static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(dataSize), data);
+    }
 }
 
 void GLRenderSystem::ReadBuffer(Buffer& buffer, std::uint64_t offset, void* data, std::uint64_t dataSize)
 {
+    GLUploadWorker::Get().Flush();
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
     bufferGL.GetBufferSubData(static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(dataSize), data);
 }
 
 void* GLRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access)
 {
+    GLUploadWorker::Get().Flush();
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
+    if (char* persistentData = bufferGL.GetPersistentData())
+        return persistentData;
     return bufferGL.MapBuffer(GLTypes::Map(access));
 }
 
@@ -256,14 +337,18 @@ static GLbitfield ToGLMapBufferAccess(CPUAccess access)
 
 void* GLRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access, std::uint64_t offset, std::uint64_t length)
 {
+    GLUploadWorker::Get().Flush();
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
+    if (char* persistentData = bufferGL.GetPersistentData())
+        return persistentData + offset;
     return bufferGL.MapBufferRange(static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(length), ToGLMapBufferAccess(access));
 }
 
 void GLRenderSystem::UnmapBuffer(Buffer& buffer)
 {
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
-    bufferGL.UnmapBuffer();
+    if (bufferGL.GetPersistentData() == nullptr)
+        bufferGL.UnmapBuffer();
 }
 
 /* ----- Textures ----- */
@@ -306,6 +391,19 @@ void GLRenderSystem::ValidateGLTextureType(const TextureType type)
     }
 }
 
+// Returns true if the initial image of the specified texture can be handed over to the upload worker, i.e. it needs no conversion or MIP-map generation after the upload.
+static bool IsAsyncInitialImageUpload(const TextureDescriptor& textureDesc, const GLTexture& textureGL)
+{
+    return
+    (
+        (textureDesc.miscFlags & MiscFlags::GenerateMips) == 0              &&
+        textureDesc.type != TextureType::TextureCube                        &&
+        textureDesc.type != TextureType::TextureCubeArray                   &&
+        !IsDepthOrStencilFormat(textureDesc.format)                         &&
+        textureGL.GetSwizzleFormat() == GLSwizzleFormat::RGBA
+    );
+}
+
 Texture* GLRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const ImageView* initialImage)
 {
     ValidateGLTextureType(textureDesc.type);
@@ -313,6 +411,28 @@ Texture* GLRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
     /* Create <GLTexture> object; will result in a GL renderbuffer or texture instance */
     auto* textureGL = textures_.emplace<GLTexture>(textureDesc);
 
+    GLUploadWorker& uploadWorker = GLUploadWorker::Get();
+    if (initialImage != nullptr && uploadWorker.IsRunning() && IsAsyncInitialImageUpload(textureDesc, *textureGL))
+    {
+        TextureRegion region;
+        {
+            region.subresource.baseArrayLayer   = 0;
+            region.subresource.numArrayLayers   = textureDesc.arrayLayers;
+            region.subresource.baseMipLevel     = 0;
+            region.subresource.numMipLevels     = 1;
+            region.extent                       = textureDesc.extent;
+        }
+        if (uploadWorker.IsAsyncTextureUpload(*textureGL, region, *initialImage))
+        {
+            /* Allocate storage without initial data and hand the initial image over to the upload worker */
+            TextureDescriptor storageDesc = textureDesc;
+            storageDesc.miscFlags |= MiscFlags::NoInitialData;
+            textureGL->BindAndAllocStorage(storageDesc, nullptr);
+            uploadWorker.WriteTexture(*textureGL, region, *initialImage);
+            return textureGL;
+        }
+    }
+
     /* Initialize either renderbuffer or texture image storage */
     textureGL->BindAndAllocStorage(textureDesc, initialImage);
 
@@ -321,18 +441,29 @@ Texture* GLRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
 
 void GLRenderSystem::Release(Texture& texture)
 {
+    GLUploadWorker::Get().Flush();
     textures_.erase(&texture);
 }
 
 void GLRenderSystem::WriteTexture(Texture& texture, const TextureRegion& textureRegion, const ImageView& srcImageView)
 {
-    /* Bind texture and write texture sub data */
+    LLGL_PROFILE_ZONE("WriteTexture");
+
     auto& textureGL = LLGL_CAST(GLTexture&, texture);
-    textureGL.TextureSubImage(textureRegion, srcImageView, false);
+    GLUploadWorker& uploadWorker = GLUploadWorker::Get();
+    if (uploadWorker.IsAsyncTextureUpload(textureGL, textureRegion, srcImageView))
+        uploadWorker.WriteTexture(textureGL, textureRegion, srcImageView);
+    else
+    {
+        /* Flush previous uploads first to keep writes in order, then bind texture and write texture sub data */
+        uploadWorker.Flush();
+        textureGL.TextureSubImage(textureRegion, srcImageView, false);
+    }
 }
 
 void GLRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureRegion, const MutableImageView& dstImageView)
 {
+    GLUploadWorker::Get().Flush();
     /* Bind texture and write texture sub data */
     LLGL_ASSERT_PTR(dstImageView.data);
     auto& textureGL = LLGL_CAST(GLTexture&, texture);
@@ -347,8 +478,9 @@ Sampler* GLRenderSystem::CreateSampler(const SamplerDescriptor& samplerDesc)
     if (!HasNativeSamplers())
     {
         /* If GL_ARB_sampler_objects is not supported, use emulated sampler states */
-        auto* samplerGL2X = samplersGL2X_.emplace<GL2XSampler>();
-        samplerGL2X->SamplerParameters(samplerDesc);
+        auto* samplerGL2X = samplersGL2X_.emplace(samplerDesc);
+        if (samplersGL2X_.use_count(samplerGL2X) == 1)
+            samplerGL2X->SamplerParameters(samplerDesc);
         return samplerGL2X;
     }
     else
@@ -356,8 +488,9 @@ Sampler* GLRenderSystem::CreateSampler(const SamplerDescriptor& samplerDesc)
     {
         /* Create native GL sampler state */
         LLGL_ASSERT(HasNativeSamplers(), "LLGL was not compiled with LLGL_GL_ENABLE_OPENGL2X but \"GL_ARB_sampler_objects\" is not supported");
-        auto* samplerGL = samplers_.emplace<GLSampler>(samplerDesc.debugName);
-        samplerGL->SamplerParameters(samplerDesc);
+        auto* samplerGL = samplers_.emplace(samplerDesc, samplerDesc.debugName);
+        if (samplers_.use_count(samplerGL) == 1)
+            samplerGL->SamplerParameters(samplerDesc);
         return samplerGL;
     }
 }
@@ -437,6 +570,10 @@ Shader* GLRenderSystem::CreateShader(const ShaderDescriptor& shaderDesc)
         case ShaderType::Compute:
             LLGL_ASSERT_RENDERING_FEATURE_SUPPORT(hasComputeShaders);
             break;
+        case ShaderType::Task:
+        case ShaderType::Mesh:
+            LLGL_ASSERT_RENDERING_FEATURE_SUPPORT(hasMeshShaders);
+            break;
         default:
             break;
     }
@@ -456,6 +593,20 @@ Shader* GLRenderSystem::CreateShader(const ShaderDescriptor& shaderDesc)
     }
 }
 
+// GL contexts are bound to a single thread, so shaders are created sequentially; GL_KHR_parallel_shader_compile already compiles them in the background
+std::uint32_t GLRenderSystem::CreateShaders(const ArrayView<ShaderDescriptor>& shaderDescs, Shader** outShaders)
+{
+    return CreateShaderBatch(
+        shaderDescs,
+        outShaders,
+        [this](const ShaderDescriptor& shaderDesc) -> Shader*
+        {
+            return CreateShader(shaderDesc);
+        },
+        /*concurrent:*/ false
+    );
+}
+
 void GLRenderSystem::Release(Shader& shader)
 {
     shaders_.erase(&shader);
@@ -465,7 +616,7 @@ void GLRenderSystem::Release(Shader& shader)
 
 PipelineLayout* GLRenderSystem::CreatePipelineLayout(const PipelineLayoutDescriptor& pipelineLayoutDesc)
 {
-    return pipelineLayouts_.emplace<GLPipelineLayout>(pipelineLayoutDesc);
+    return pipelineLayouts_.emplace(pipelineLayoutDesc, pipelineLayoutDesc);
 }
 
 void GLRenderSystem::Release(PipelineLayout& pipelineLayout)
@@ -495,6 +646,8 @@ void GLRenderSystem::Release(PipelineCache& pipelineCache)
 
 PipelineState* GLRenderSystem::CreatePipelineState(const GraphicsPipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
 {
+    LLGL_PROFILE_ZONE("CreateGraphicsPipelineState");
+
     return pipelineStates_.emplace<GLGraphicsPSO>(
         pipelineStateDesc,
         GetRenderingCaps().limits,
@@ -504,6 +657,8 @@ PipelineState* GLRenderSystem::CreatePipelineState(const GraphicsPipelineDescrip
 
 PipelineState* GLRenderSystem::CreatePipelineState(const ComputePipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
 {
+    LLGL_PROFILE_ZONE("CreateComputePipelineState");
+
     return pipelineStates_.emplace<GLComputePSO>(
         pipelineStateDesc,
         (GetRenderingCaps().features.hasPipelineCaching ? pipelineCache : nullptr)
@@ -549,6 +704,57 @@ bool GLRenderSystem::GetNativeHandle(void* nativeHandle, std::size_t nativeHandl
         return false;
 }
 
+std::uint32_t GLRenderSystem::QueryMemoryHeaps(MemoryHeapInfo* /*outHeapInfos*/, std::uint32_t /*maxNumHeaps*/)
+{
+    return 0; // not supported by this backend
+}
+
+std::uint32_t GLRenderSystem::GetBindlessDescriptorIndex(const Resource& /*resource*/, long /*bindFlags*/)
+{
+    return LLGL_INVALID_SLOT; // not supported by this backend
+}
+
+bool GLRenderSystem::GetSparseTextureProperties(const Texture& /*texture*/, SparseTextureProperties& /*outProperties*/)
+{
+    return false; // not supported by this backend
+}
+
+bool GLRenderSystem::CommitTextureTiles(Texture& /*texture*/, const TextureRegion& /*textureRegion*/, bool /*commit*/)
+{
+    return false; // not supported by this backend
+}
+
+bool GLRenderSystem::MakeResident(const ArrayView<Resource*>& /*resources*/)
+{
+    return true; // residency is managed by the driver
+}
+
+void GLRenderSystem::Evict(const ArrayView<Resource*>& /*resources*/)
+{
+    // residency is managed by the driver
+}
+
+
+bool GLRenderSystem::GetAccelerationStructureSizes(const AccelerationStructureBuildDescriptor& /*buildDesc*/, AccelerationStructureSizes& /*outSizes*/)
+{
+    return false; // not supported by this backend
+}
+
+std::uint64_t GLRenderSystem::GetAccelerationStructureAddress(const Buffer& /*buffer*/)
+{
+    return 0; // not supported by this backend
+}
+
+
+/*
+ * ======= Protected: =======
+ */
+
+void GLRenderSystem::QueryDeferredRenderingCaps(RenderingCapabilities& outCaps)
+{
+    GLQueryRenderingCaps(outCaps);
+}
+
 
 /*
  * ======= Private: =======
@@ -560,12 +766,23 @@ void GLRenderSystem::CreateGLContextDependentDevices(GLStateManager& stateManage
     if (debugContext_)
         EnableDebugCallback();
 
+    /* Allow the driver to compile shaders and link programs on background threads */
+    EnableParallelShaderCompile();
+
     /* Create command queue instance */
     commandQueue_ = MakeUnique<GLCommandQueue>(stateManager);
 
-    /* Query renderer information and limits */
+    /*
+    Start worker thread with shared GL context for texture and buffer uploads; This requires a placeholder surface, which is not available in headless mode.
+    The worker only invalidates the bindings of a single render thread, so it is not used when swap-chains are rendered on separate threads.
+    */
+    const RendererConfigurationOpenGL& profile = contextMngr_.GetProfile();
+    if (profile.asyncUploads && !profile.contextPerSwapChain && !contextMngr_.IsHeadless())
+        GLUploadWorker::Get().Start(contextMngr_);
+
+    /* Query renderer information now, but defer rendering capabilities until they are requested, since the texture limits and formats are expensive to query */
     QueryRendererInfo();
-    QueryRenderingCaps();
+    DeferRenderingCaps();
 }
 
 #ifdef GL_KHR_debug
@@ -582,6 +799,17 @@ void APIENTRY GLDebugCallback(
 
 #endif // /GL_KHR_debug
 
+void GLRenderSystem::EnableParallelShaderCompile()
+{
+    #if defined LLGL_OPENGL && !defined __APPLE__
+    /* Let the driver choose the number of compiler threads; See GL_KHR_parallel_shader_compile */
+    if (HasExtension(GLExt::KHR_parallel_shader_compile))
+        glMaxShaderCompilerThreadsKHR(0xFFFFFFFFu);
+    else if (HasExtension(GLExt::ARB_parallel_shader_compile))
+        glMaxShaderCompilerThreadsARB(0xFFFFFFFFu);
+    #endif
+}
+
 struct GLDebugMessageMetaData
 {
     GLenum source, type, severity;
@@ -679,13 +907,6 @@ void GLRenderSystem::QueryRendererInfo()
     SetRendererInfo(info);
 }
 
-void GLRenderSystem::QueryRenderingCaps()
-{
-    RenderingCapabilities caps;
-    GLQueryRenderingCaps(caps);
-    SetRenderingCaps(caps);
-}
-
 
 } // /namespace LLGL
 
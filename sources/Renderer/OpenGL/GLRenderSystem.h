@@ -12,6 +12,8 @@
 #include <LLGL/RenderSystem.h>
 #include "Ext/GLExtensionRegistry.h"
 #include "../ContainerTypes.h"
+#include "../PipelineLayoutCache.h"
+#include "../SamplerCache.h"
 
 #include "Command/GLCommandQueue.h"
 #include "Command/GLCommandBuffer.h"
@@ -19,7 +21,7 @@
 #include "Platform/GLContextManager.h"
 
 #include "Buffer/GLBuffer.h"
-#include "Buffer/GLBufferArray.h"
+#include "Buffer/GLBufferArrayWithVAO.h"
 
 #include "Shader/GLShader.h"
 #include "Shader/GLShaderProgram.h"
@@ -63,14 +65,18 @@ class GLRenderSystem final : public RenderSystem
         GLRenderSystem(const RenderSystemDescriptor& renderSystemDesc);
         ~GLRenderSystem();
 
+    protected:
+
+        void QueryDeferredRenderingCaps(RenderingCapabilities& outCaps) override;
+
     private:
 
         void CreateGLContextDependentDevices(GLStateManager& stateManager);
 
         void EnableDebugCallback(bool enable = true);
+        void EnableParallelShaderCompile();
 
         void QueryRendererInfo();
-        void QueryRenderingCaps();
 
         GLBuffer* CreateGLBuffer(const BufferDescriptor& desc, const void* initialData);
 
@@ -82,21 +88,22 @@ class GLRenderSystem final : public RenderSystem
 
         GLContextManager                        contextMngr_;
         bool                                    debugContext_   = false;
+        RenderingDebugger*                      debugger_       = nullptr;
 
         HWObjectContainer<GLSwapChain>          swapChains_;
         HWObjectInstance<GLCommandQueue>        commandQueue_;
         HWObjectContainer<GLCommandBuffer>      commandBuffers_;
         HWObjectContainer<GLBuffer>             buffers_;
-        HWObjectContainer<GLBufferArray>        bufferArrays_;
+        HWObjectPool<GLBufferArray, sizeof(GLBufferArrayWithVAO)> bufferArrays_;
         HWObjectContainer<GLTexture>            textures_;
-        HWObjectContainer<GLSampler>            samplers_;
+        SamplerCache<GLSampler>                 samplers_;
         #ifdef LLGL_GL_ENABLE_OPENGL2X
-        HWObjectContainer<GL2XSampler>          samplersGL2X_;
+        SamplerCache<GL2XSampler>               samplersGL2X_;
         #endif
         HWObjectContainer<GLRenderPass>         renderPasses_;
         HWObjectContainer<GLRenderTarget>       renderTargets_;
         HWObjectContainer<GLShader>             shaders_;
-        HWObjectContainer<GLPipelineLayout>     pipelineLayouts_;
+        PipelineLayoutCache<GLPipelineLayout>   pipelineLayouts_;
         HWObjectInstance<ProxyPipelineCache>    pipelineCacheProxy_;
         HWObjectContainer<GLPipelineCache>      pipelineCaches_;
         HWObjectContainer<GLPipelineState>      pipelineStates_;
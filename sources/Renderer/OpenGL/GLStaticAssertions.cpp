@@ -48,6 +48,7 @@ LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdClear );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdClearAttachmentsWithRenderPass );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdClearBuffers );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdBindVertexArray );
+LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdBindVertexArrayWithOffset );
 #ifdef LLGL_GL_ENABLE_OPENGL2X
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdBindGL2XVertexArray );
 #endif
@@ -58,7 +59,9 @@ LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdBeginTransformFeedback );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdBeginTransformFeedbackNV );
 //LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdEndTransformFeedback ); // Unused
 //LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdEndTransformFeedbackNV ); // Unused
+LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdBindTransformFeedback );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdBindResourceHeap );
+LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdMemoryBarrier );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdBindRenderTarget );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdBindPipelineState );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdSetBlendColor );
@@ -80,6 +83,9 @@ LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdDrawElementsInstancedBaseVertexBaseInstance )
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdDrawElementsIndirect );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdMultiDrawArraysIndirect );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdMultiDrawElementsIndirect );
+LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdMultiDrawArraysIndirectCount );
+LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdMultiDrawElementsIndirectCount );
+LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdDrawTransformFeedback );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdDispatchCompute );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdDispatchComputeIndirect );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdBindTexture );
@@ -7,8 +7,11 @@
 
 #include "GLSwapChain.h"
 #include "../TextureUtils.h"
+#include "../SwapChainUtils.h"
 #include "Platform/GLContextManager.h"
+#include "../../Core/ProfileZone.h"
 #include <LLGL/Platform/Platform.h>
+#include <LLGL/RenderingDebugger.h>
 
 #ifdef LLGL_OS_LINUX
 #include <LLGL/Platform/NativeHandle.h>
@@ -22,9 +25,12 @@ namespace LLGL
 GLSwapChain::GLSwapChain(
     const SwapChainDescriptor&      desc,
     const std::shared_ptr<Surface>& surface,
-    GLContextManager&               contextMngr)
+    GLContextManager&               contextMngr,
+    RenderingDebugger*              debugger)
 :
-    SwapChain { desc }
+    SwapChain    { desc             },
+    presentMode_ { desc.presentMode },
+    debugger_    { debugger         }
 {
     /* Set up pixel format for GL context */
     GLPixelFormat pixelFormat;
@@ -54,17 +60,47 @@ GLSwapChain::GLSwapChain(
     framebufferHeight_ = static_cast<GLint>(GetResolution().height);
 
     /* Create platform dependent OpenGL context */
-    context_ = contextMngr.AllocContext(&pixelFormat, &GetSurface());
+    GLSwapChainContext* prevSwapChainContext = GLSwapChainContext::GetCurrent();
+    const bool hasExclusiveContext = contextMngr.GetProfile().contextPerSwapChain;
+
+    if (hasExclusiveContext)
+        context_ = contextMngr.AllocExclusiveContext(pixelFormat, GetSurface());
+    else
+        context_ = contextMngr.AllocContext(&pixelFormat, &GetSurface());
+
     swapChainContext_ = GLSwapChainContext::Create(*context_, GetSurface());
     GLSwapChainContext::MakeCurrent(swapChainContext_.get());
 
     /* Get state manager and reset current framebuffer height */
     GetStateManager().ResetFramebufferHeight(framebufferHeight_);
+
+    /* Apply swap interval for explicit presentation mode; otherwise keep the swap interval of the context */
+    if (presentMode_ != PresentMode::Default)
+        SetSwapInterval(static_cast<int>(GetPresentSyncInterval(presentMode_, 0)));
+
+    /*
+    Restore previous GL context on the calling thread, so this exclusive context can be made current on the thread that renders into this swap-chain.
+    The context of the first swap-chain is the primary context and remains current.
+    */
+    if (hasExclusiveContext && prevSwapChainContext != nullptr)
+        GLSwapChainContext::MakeCurrent(prevSwapChainContext);
 }
 
 void GLSwapChain::Present()
 {
+    LLGL_PROFILE_ZONE("Present");
+
+    PaceFrame();
     swapChainContext_->SwapBuffers();
+    NotifyFramePresented();
+
+    /* Report state cache statistics of this context to the debugger once per frame */
+    if (debugger_ != nullptr)
+    {
+        FrameProfile profile;
+        GetStateManager().FlushStatistics(profile.commandBufferRecord);
+        debugger_->RecordProfile(profile);
+    }
 }
 
 std::uint32_t GLSwapChain::GetCurrentSwapIndex() const
@@ -99,7 +135,7 @@ const RenderPass* GLSwapChain::GetRenderPass() const
 
 bool GLSwapChain::SetVsyncInterval(std::uint32_t vsyncInterval)
 {
-    return SetSwapInterval(static_cast<int>(vsyncInterval));
+    return SetSwapInterval(static_cast<int>(GetPresentSyncInterval(presentMode_, vsyncInterval)));
 }
 
 bool GLSwapChain::MakeCurrent(GLSwapChain* swapChain)
@@ -26,6 +26,7 @@ namespace LLGL
 struct NativeHandle;
 class GLRenderTarget;
 class GLContextManager;
+class RenderingDebugger;
 
 class GLSwapChain final : public SwapChain
 {
@@ -37,7 +38,8 @@ class GLSwapChain final : public SwapChain
         GLSwapChain(
             const SwapChainDescriptor&      desc,
             const std::shared_ptr<Surface>& surface,
-            GLContextManager&               contextMngr
+            GLContextManager&               contextMngr,
+            RenderingDebugger*              debugger        = nullptr
         );
 
         void Present() override;
@@ -81,6 +83,8 @@ class GLSwapChain final : public SwapChain
         std::shared_ptr<GLContext>          context_;
         std::unique_ptr<GLSwapChainContext> swapChainContext_;
         GLint                               framebufferHeight_ = 0;
+        PresentMode                         presentMode_       = PresentMode::Default;
+        RenderingDebugger*                  debugger_          = nullptr;
 
 };
 
@@ -32,6 +32,14 @@
 #   define LLGL_GLEXT_MULTI_DRAW_INDIRECT
 #endif
 
+#if defined GL_ARB_vertex_attrib_binding || defined GL_ES_VERSION_3_1
+#   define LLGL_GLEXT_VERTEX_ATTRIB_BINDING
+#endif
+
+#if defined GL_ARB_indirect_parameters
+#   define LLGL_GLEXT_INDIRECT_PARAMETERS
+#endif
+
 #if defined GL_ARB_compute_shader || defined GL_ES_VERSION_3_1
 #   define LLGL_GLEXT_COMPUTE_SHADER
 #endif
@@ -49,6 +57,10 @@
 #   define LLGL_GLEXT_TRANSFORM_FEEDBACK
 #endif
 
+#if defined GL_ARB_transform_feedback2 || defined GL_VERSION_4_0
+#   define LLGL_GLEXT_TRANSFORM_FEEDBACK2
+#endif
+
 #if defined GL_EXT_draw_buffers2 || defined GL_ES_VERSION_3_2
 #   define LLGL_GLEXT_DRAW_BUFFERS2
 #endif
@@ -69,6 +81,22 @@
 #   define LLGL_GLEXT_GET_TEX_LEVEL_PARAMETER
 #endif
 
+#if defined GL_ARB_invalidate_subdata || defined GL_ES_VERSION_3_0
+#   define LLGL_GLEXT_INVALIDATE_SUBDATA
+#endif
+
+#if defined GL_ARB_copy_buffer || defined GL_ES_VERSION_3_0
+#   define LLGL_GLEXT_COPY_BUFFER
+#endif
+
+#if defined GL_ARB_map_buffer_range || defined GL_ES_VERSION_3_0
+#   define LLGL_GLEXT_MAP_BUFFER_RANGE
+#endif
+
+#if defined GL_EXT_multisampled_render_to_texture && defined LLGL_OPENGLES3
+#   define LLGL_GLEXT_MULTISAMPLED_RENDER_TO_TEXTURE
+#endif
+
 //#if defined GL_ARB_clip_control
 //#   define LLGL_GLEXT_CLIP_CONTROL
 //#endif
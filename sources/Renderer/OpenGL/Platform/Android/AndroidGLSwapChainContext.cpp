@@ -70,7 +70,12 @@ void AndroidGLSwapChainContext::Resize(const Extent2D& resolution)
 bool AndroidGLSwapChainContext::MakeCurrentEGLContext(AndroidGLSwapChainContext* context)
 {
     if (context)
+    {
+        /* Skip redundant context switch if the same surface and context are already current */
+        if (eglGetCurrentContext() == context->context_ && eglGetCurrentSurface(EGL_DRAW) == context->surface_)
+            return true;
         return eglMakeCurrent(context->display_, context->surface_, context->surface_, context->context_);
+    }
     else
         return eglMakeCurrent(eglGetDisplay(EGL_DEFAULT_DISPLAY), EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
 }
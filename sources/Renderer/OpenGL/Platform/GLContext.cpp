@@ -33,9 +33,10 @@ bool operator != (const GLPixelFormat& lhs, const GLPixelFormat& rhs)
  * GLContext class
  */
 
-static GLContext*   g_currentContext;
-static unsigned     g_currentGlobalIndex;
-static unsigned     g_globalIndexCounter;
+// The current GL context is tracked per thread, since each thread can have a different GL context current.
+static thread_local GLContext*  g_currentContext;
+static thread_local unsigned    g_currentGlobalIndex;
+static unsigned                 g_globalIndexCounter;
 
 bool GLContext::SetCurrentSwapInterval(int interval)
 {
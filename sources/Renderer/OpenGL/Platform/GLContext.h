@@ -91,6 +91,17 @@ class GLContext
             const ArrayView<char>&              customNativeHandle  = {}
         );
 
+        #ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+
+        // Creates a platform specific GLContext instance without a surface for headless rendering and makes it current.
+        static std::unique_ptr<GLContext> CreateHeadless(
+            const GLPixelFormat&                pixelFormat,
+            const RendererConfigurationOpenGL&  profile,
+            GLContext*                          sharedContext       = nullptr
+        );
+
+        #endif // /LLGL_GL_ENABLE_EGL_HEADLESS
+
         // Sets the current GL context. This only stores a reference to this context (GetCurrent) and its global index (GetGlobalIndex).
         static void SetCurrent(GLContext* context);
 
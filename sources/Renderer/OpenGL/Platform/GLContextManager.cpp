@@ -22,11 +22,16 @@ namespace LLGL
 GLContextManager::GLContextManager(
     const RendererConfigurationOpenGL&  profile,
     const void*                         customNativeHandle,
-    std::size_t                         customNativeHandleSize)
+    std::size_t                         customNativeHandleSize,
+    bool                                headless)
+:
+    headless_ { headless }
 {
-    profile_.contextProfile = profile.contextProfile;
-    profile_.majorVersion   = profile.majorVersion;
-    profile_.minorVersion   = profile.minorVersion;
+    profile_.contextProfile         = profile.contextProfile;
+    profile_.majorVersion           = profile.majorVersion;
+    profile_.minorVersion           = profile.minorVersion;
+    profile_.asyncUploads           = profile.asyncUploads;
+    profile_.contextPerSwapChain    = profile.contextPerSwapChain;
     if (customNativeHandle != nullptr && customNativeHandleSize > 0)
     {
         customNativeHandle_.resize(customNativeHandleSize, UninitializeTag{});
@@ -42,10 +47,22 @@ std::shared_ptr<GLContext> GLContextManager::AllocContext(const GLPixelFormat* p
         return FindOrMakeAnyContext();
 }
 
+std::shared_ptr<GLContext> GLContextManager::AllocExclusiveContext(const GLPixelFormat& pixelFormat, Surface& surface)
+{
+    /* The first context is the primary context, which is shared with all subsequent allocations */
+    if (pixelFormats_.empty())
+        return MakeContextWithPixelFormat(pixelFormat, &surface);
 
-/*
- * ======= Private: =======
- */
+    /* Create new GL context that shares its objects with the primary context, but is not reused for other allocations */
+    std::shared_ptr<GLContext> context = GLContext::Create(pixelFormat, profile_, surface, pixelFormats_.front().context.get());
+
+    /* Initialize state manager for new GL context, which has been made current by its creation */
+    GLStateManager& stateMngr = context->GetStateManager();
+    stateMngr.DetermineExtensionsAndLimits();
+    InitRenderStates(stateMngr);
+
+    return context;
+}
 
 std::unique_ptr<Surface> GLContextManager::CreatePlaceholderSurface()
 {
@@ -66,25 +83,36 @@ std::unique_ptr<Surface> GLContextManager::CreatePlaceholderSurface()
     #endif
 }
 
+
+/*
+ * ======= Private: =======
+ */
+
 std::shared_ptr<GLContext> GLContextManager::MakeContextWithPixelFormat(const GLPixelFormat& pixelFormat, Surface* surface)
 {
-    /* Create placeholder surface is none was specified */
-    std::unique_ptr<Surface> placeholderSurface;
-    if (surface == nullptr)
-    {
-        placeholderSurface = CreatePlaceholderSurface();
-        surface = placeholderSurface.get();
-    }
-
     /* Use shared GL context if there already is one */
     GLContext* sharedContext = (pixelFormats_.empty() ? nullptr : pixelFormats_.front().context.get());
 
     /* Create new GL context and append to pixel format list */
     GLPixelFormatWithContext formatWithContext;
+    formatWithContext.pixelFormat = pixelFormat;
+
+    #ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+    if (headless_ && surface == nullptr)
+    {
+        /* Create GL context without any surface, so no display connection is required */
+        formatWithContext.context = GLContext::CreateHeadless(pixelFormat, profile_, sharedContext);
+    }
+    else
+    #endif // /LLGL_GL_ENABLE_EGL_HEADLESS
     {
-        formatWithContext.pixelFormat   = pixelFormat;
-        formatWithContext.surface       = std::move(placeholderSurface);
-        formatWithContext.context       = GLContext::Create(pixelFormat, profile_, *surface, sharedContext, customNativeHandle_);
+        /* Create placeholder surface is none was specified */
+        if (surface == nullptr)
+        {
+            formatWithContext.surface = CreatePlaceholderSurface();
+            surface = formatWithContext.surface.get();
+        }
+        formatWithContext.context = GLContext::Create(pixelFormat, profile_, *surface, sharedContext, customNativeHandle_);
     }
     pixelFormats_.emplace_back(std::move(formatWithContext));
 
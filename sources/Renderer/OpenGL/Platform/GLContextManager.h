@@ -42,7 +42,8 @@ class GLContextManager
         GLContextManager(
             const RendererConfigurationOpenGL&  profile,
             const void*                         customNativeHandle      = nullptr,
-            std::size_t                         customNativeHandleSize  = 0
+            std::size_t                         customNativeHandleSize  = 0,
+            bool                                headless                = false
         );
 
     public:
@@ -50,6 +51,15 @@ class GLContextManager
         // Returns a GL context with the specified pixel format or any context if 'pixelFormat' is null.
         std::shared_ptr<GLContext> AllocContext(const GLPixelFormat* pixelFormat = nullptr, Surface* surface = nullptr);
 
+        /*
+        Returns a new GL context with the specified pixel format that is not shared with any other allocation, except the primary context.
+        The context shares its objects with the primary context. This is used for RendererConfigurationOpenGL::contextPerSwapChain.
+        */
+        std::shared_ptr<GLContext> AllocExclusiveContext(const GLPixelFormat& pixelFormat, Surface& surface);
+
+        // Creates an invisible surface as placeholder for a GL context.
+        std::unique_ptr<Surface> CreatePlaceholderSurface();
+
     public:
 
         // Returns the OpenGL profile configuration.
@@ -58,6 +68,12 @@ class GLContextManager
             return profile_;
         }
 
+        // Returns true if this context manager was created for a headless render system (see RenderSystemFlags::Headless).
+        inline bool IsHeadless() const
+        {
+            return headless_;
+        }
+
     private:
 
         struct GLPixelFormatWithContext
@@ -69,9 +85,6 @@ class GLContextManager
 
     private:
 
-        // Creates an invisible surface as placeholder for a GL context.
-        std::unique_ptr<Surface> CreatePlaceholderSurface();
-
         // Makes a new GL context with the specified pixel format and creates a placeholder surface is none was specified.
         std::shared_ptr<GLContext> MakeContextWithPixelFormat(const GLPixelFormat& pixelFormat, Surface* surface = nullptr);
 
@@ -89,6 +102,7 @@ class GLContextManager
         RendererConfigurationOpenGL             profile_;
         std::vector<GLPixelFormatWithContext>   pixelFormats_;
         DynamicByteArray                        customNativeHandle_;
+        bool                                    headless_               = false;
 
 };
 
@@ -13,7 +13,8 @@ namespace LLGL
 {
 
 
-static GLSwapChainContext* g_currentSwapChainContext;
+// Swap-chain context links are tracked per thread like their GL contexts.
+static thread_local GLSwapChainContext* g_currentSwapChainContext;
 
 GLSwapChainContext::GLSwapChainContext(GLContext& context) :
     context_ { context }
@@ -32,6 +33,21 @@ bool GLSwapChainContext::MakeCurrent(GLSwapChainContext* context)
     return result;
 }
 
+GLSwapChainContext* GLSwapChainContext::GetCurrent()
+{
+    return g_currentSwapChainContext;
+}
+
+bool GLSwapChainContext::MakeCurrentUntracked(GLSwapChainContext* context)
+{
+    return GLSwapChainContext::MakeCurrentUnchecked(context);
+}
+
+bool GLSwapChainContext::RestoreCurrent()
+{
+    return GLSwapChainContext::MakeCurrentUnchecked(g_currentSwapChainContext);
+}
+
 
 } // /namespace LLGL
 
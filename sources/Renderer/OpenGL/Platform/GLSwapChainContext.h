@@ -49,9 +49,21 @@ class GLSwapChainContext
         // Creates a platform specific GLSwapChainContext instance.
         static std::unique_ptr<GLSwapChainContext> Create(GLContext& context, Surface& surface);
 
-        // Makes the specified swap-chain context link current. If null, no context is current.
+        // Makes the specified swap-chain context link current for the calling thread. If null, no context is current.
         static bool MakeCurrent(GLSwapChainContext* context);
 
+        // Returns the swap-chain context link that is current for the calling thread or null if there is none.
+        static GLSwapChainContext* GetCurrent();
+
+        /*
+        Makes the specified swap-chain context link current for the calling thread only, without tracking it as the current context.
+        This is used for shared GL contexts on worker threads. If null, no context is current on the calling thread.
+        */
+        static bool MakeCurrentUntracked(GLSwapChainContext* context);
+
+        // Re-applies the tracked swap-chain context link, e.g. after the creation of another GL context has changed the native current context.
+        static bool RestoreCurrent();
+
     protected:
 
         // Initializes the swap-chain context with the specified GL context.
@@ -0,0 +1,330 @@
+/*
+ * GLUploadWorker.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "GLUploadWorker.h"
+#include "GLContextManager.h"
+#include "GLSwapChainContext.h"
+#include "../Texture/GLTexture.h"
+#include "../Texture/GLTexSubImage.h"
+#include "../Buffer/GLBuffer.h"
+#include "../RenderState/GLStateManager.h"
+#include "../Ext/GLExtensions.h"
+#include "../Ext/GLExtensionRegistry.h"
+#include "../GLTypes.h"
+#include "../../TextureUtils.h"
+#include <LLGL/Platform/Platform.h>
+#include <LLGL/Format.h>
+#include <LLGL/Log.h>
+
+
+namespace LLGL
+{
+
+
+// Uploads smaller than this are transferred directly on the render thread, since handing them over costs more than the driver copy.
+static constexpr std::size_t g_minAsyncUploadSize = 64 * 1024;
+
+// Returns the number of bytes that glTexSubImage* reads from the source image for the specified texture region.
+static std::size_t GetTextureUploadSize(const TextureType type, const TextureRegion& region, const ImageView& srcImageView)
+{
+    if (IsCompressedFormat(srcImageView.format))
+        return srcImageView.dataSize;
+
+    /* Cube textures are written one face at a time (see GLTexSubImageCube) */
+    const std::uint32_t numArrayLayers  = (type == TextureType::TextureCube ? 1u : region.subresource.numArrayLayers);
+    const Extent3D      extent          = CalcTextureExtent(type, region.extent, numArrayLayers);
+    const std::size_t   numTexels       = static_cast<std::size_t>(extent.width) * extent.height * extent.depth;
+    return GetMemoryFootprint(srcImageView.format, srcImageView.dataType, numTexels);
+}
+
+GLUploadWorker::~GLUploadWorker()
+{
+    Clear();
+}
+
+GLUploadWorker& GLUploadWorker::Get()
+{
+    static GLUploadWorker instance;
+    return instance;
+}
+
+bool GLUploadWorker::IsSupported()
+{
+    #if defined LLGL_OPENGL && (defined LLGL_OS_WIN32 || defined LLGL_OS_LINUX)
+    return (HasExtension(GLExt::ARB_sync) && HasExtension(GLExt::ARB_copy_buffer));
+    #else
+    return false;
+    #endif
+}
+
+bool GLUploadWorker::Start(GLContextManager& contextMngr)
+{
+    if (IsRunning() || !IsSupported())
+        return false;
+
+    /* Create shared GL context on a placeholder surface; this must be done on the render thread, since the surface is owned by it */
+    std::shared_ptr<GLContext> primaryContext = contextMngr.AllocContext();
+    surface_            = contextMngr.CreatePlaceholderSurface();
+    context_            = GLContext::Create(GLPixelFormat{}, contextMngr.GetProfile(), *surface_, primaryContext.get());
+    swapChainContext_   = GLSwapChainContext::Create(*context_, *surface_);
+
+    /* Creating the new GL context has made it current, so re-apply the context of the render thread before the worker can take over the new one */
+    GLSwapChainContext::RestoreCurrent();
+
+    /* Start worker thread and wait until it has made the shared context current */
+    hasStarted_         = false;
+    isContextCurrent_   = false;
+    quit_               = false;
+    thread_             = std::thread{ &GLUploadWorker::Run, this };
+
+    bool isContextCurrent = false;
+    {
+        std::unique_lock<std::mutex> lock{ mutex_ };
+        submitCondVar_.wait(lock, [this]() { return hasStarted_; });
+        isContextCurrent = isContextCurrent_;
+    }
+
+    if (!isContextCurrent)
+    {
+        Log::Errorf("failed to make shared GL context current on upload worker thread\n");
+        Clear();
+        return false;
+    }
+
+    return true;
+}
+
+void GLUploadWorker::Clear()
+{
+    if (IsRunning())
+    {
+        /* Let the worker thread submit all remaining jobs before it quits */
+        {
+            std::lock_guard<std::mutex> guard{ mutex_ };
+            quit_ = true;
+        }
+        jobsCondVar_.notify_one();
+        thread_.join();
+
+        /* Sync objects are shared between contexts, so they can be deleted with the render thread's context */
+        for (GLsync sync : submittedSyncs_)
+            glDeleteSync(sync);
+        submittedSyncs_.clear();
+        uploadTargets_.clear();
+    }
+
+    swapChainContext_.reset();
+    context_.reset();
+    surface_.reset();
+}
+
+bool GLUploadWorker::IsAsyncTextureUpload(const GLTexture& texture, const TextureRegion& region, const ImageView& srcImageView) const
+{
+    if (!IsRunning() || texture.IsRenderbuffer() || srcImageView.data == nullptr)
+        return false;
+
+    /* Multi-sampled textures cannot be written with glTexSubImage* */
+    const TextureType type = texture.GetType();
+    if (IsMultiSampleTexture(type))
+        return false;
+
+    if (IsCompressedFormat(srcImageView.format) && !HasExtension(GLExt::ARB_texture_compression))
+        return false;
+
+    /* Leave malformed image views to the direct upload path */
+    const std::size_t dataSize = GetTextureUploadSize(type, region, srcImageView);
+    if (srcImageView.dataSize < dataSize)
+        return false;
+
+    return (dataSize >= g_minAsyncUploadSize);
+}
+
+bool GLUploadWorker::IsAsyncBufferUpload(GLsizeiptr size) const
+{
+    return (IsRunning() && static_cast<std::size_t>(size) >= g_minAsyncUploadSize);
+}
+
+void GLUploadWorker::WriteTexture(const GLTexture& texture, const TextureRegion& region, const ImageView& srcImageView)
+{
+    const char* srcData = static_cast<const char*>(srcImageView.data);
+
+    /* Copy image data into job; the size has already been validated by IsAsyncTextureUpload() */
+    const std::size_t dataSize = GetTextureUploadSize(texture.GetType(), region, srcImageView);
+
+    UploadJob job;
+    {
+        job.id              = texture.GetID();
+        job.isTexture       = true;
+        job.textureType     = texture.GetType();
+        job.region          = region;
+        job.format          = srcImageView.format;
+        job.dataType        = srcImageView.dataType;
+        job.internalFormat  = texture.GetGLInternalFormat();
+        job.data            = DynamicByteArray{ srcData, srcData + dataSize };
+    }
+    UploadTarget target;
+    {
+        target.id               = texture.GetID();
+        target.isTexture        = true;
+        target.textureTarget    = GLStateManager::GetTextureTarget(texture.GetType());
+        target.bufferTarget     = GLBufferTarget::ArrayBuffer;
+    }
+    EnqueueJob(std::move(job), target);
+}
+
+void GLUploadWorker::WriteBuffer(const GLBuffer& buffer, GLintptr offset, GLsizeiptr size, const void* data)
+{
+    const char* srcData = static_cast<const char*>(data);
+
+    UploadJob job;
+    {
+        job.id      = buffer.GetID();
+        job.offset  = offset;
+        job.data    = DynamicByteArray{ srcData, srcData + size };
+    }
+    UploadTarget target;
+    {
+        target.id               = buffer.GetID();
+        target.isTexture        = false;
+        target.textureTarget    = GLTextureTarget::Texture1D;
+        target.bufferTarget     = buffer.GetTarget();
+    }
+    EnqueueJob(std::move(job), target);
+}
+
+void GLUploadWorker::Flush()
+{
+    /* Nothing to do if no uploads have been handed over since the last flush */
+    if (uploadTargets_.empty())
+        return;
+
+    std::vector<GLsync> syncs;
+    {
+        std::unique_lock<std::mutex> lock{ mutex_ };
+        submitCondVar_.wait(lock, [this]() { return (numUnsubmittedJobs_ == 0); });
+        syncs.swap(submittedSyncs_);
+    }
+
+    /* Wait on the GPU timeline only; the sync objects are flushed by the worker context, so glWaitSync cannot deadlock */
+    for (GLsync sync : syncs)
+    {
+        glWaitSync(sync, 0, GL_TIMEOUT_IGNORED);
+        glDeleteSync(sync);
+    }
+
+    /* Objects modified by another context must be re-bound before their new contents are guaranteed to be visible */
+    GLStateManager& stateMngr = GLStateManager::Get();
+    for (const UploadTarget& target : uploadTargets_)
+    {
+        if (target.isTexture)
+            stateMngr.InvalidateBoundTexture(target.id, target.textureTarget);
+        else
+            stateMngr.NotifyBufferRelease(target.id, target.bufferTarget);
+    }
+    uploadTargets_.clear();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void GLUploadWorker::EnqueueJob(UploadJob&& job, const UploadTarget& target)
+{
+    {
+        std::lock_guard<std::mutex> guard{ mutex_ };
+        pendingJobs_.push_back(std::move(job));
+        ++numUnsubmittedJobs_;
+    }
+    jobsCondVar_.notify_one();
+    uploadTargets_.push_back(target);
+}
+
+void GLUploadWorker::Run()
+{
+    /* Take over the shared GL context for this thread */
+    {
+        std::lock_guard<std::mutex> guard{ mutex_ };
+        isContextCurrent_   = GLSwapChainContext::MakeCurrentUntracked(swapChainContext_.get());
+        hasStarted_         = true;
+    }
+    submitCondVar_.notify_all();
+
+    if (!isContextCurrent_)
+        return;
+
+    /* Pixel storage of the worker context must match the byte-alignment of the render thread's contexts */
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glGenBuffers(1, &pixelBuffer_);
+
+    for (std::vector<UploadJob> jobs;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock{ mutex_ };
+            jobsCondVar_.wait(lock, [this]() { return (quit_ || !pendingJobs_.empty()); });
+            if (pendingJobs_.empty())
+                break;
+            jobs.swap(pendingJobs_);
+        }
+
+        /* Submit batch of jobs and fence them as a whole */
+        for (const UploadJob& job : jobs)
+            ExecuteJob(job);
+
+        GLsync sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        glFlush();
+
+        {
+            std::lock_guard<std::mutex> guard{ mutex_ };
+            submittedSyncs_.push_back(sync);
+            numUnsubmittedJobs_ -= jobs.size();
+        }
+        submitCondVar_.notify_all();
+
+        jobs.clear();
+    }
+
+    glDeleteBuffers(1, &pixelBuffer_);
+    pixelBuffer_ = 0;
+
+    /* Release shared GL context from this thread, so it can be deleted by the render thread */
+    GLSwapChainContext::MakeCurrentUntracked(nullptr);
+}
+
+void GLUploadWorker::ExecuteJob(const UploadJob& job)
+{
+    const GLsizeiptr dataSize = static_cast<GLsizeiptr>(job.data.size());
+    if (job.isTexture)
+    {
+        /* Orphan previous PBO storage and copy image data into it, then transfer from PBO into texture */
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pixelBuffer_);
+        glBufferData(GL_PIXEL_UNPACK_BUFFER, dataSize, job.data.get(), GL_STREAM_DRAW);
+
+        glBindTexture(GLTypes::Map(job.textureType), job.id);
+        {
+            /* Image data pointer is the offset into the bound GL_PIXEL_UNPACK_BUFFER */
+            const ImageView pixelBufferView{ job.format, job.dataType, nullptr, job.data.size() };
+            GLTexSubImage(job.textureType, job.region, pixelBufferView, job.internalFormat);
+        }
+        glBindTexture(GLTypes::Map(job.textureType), 0);
+
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    }
+    else
+    {
+        glBindBuffer(GL_COPY_WRITE_BUFFER, job.id);
+        glBufferSubData(GL_COPY_WRITE_BUFFER, job.offset, dataSize, job.data.get());
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
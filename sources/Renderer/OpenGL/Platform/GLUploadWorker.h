@@ -0,0 +1,162 @@
+/*
+ * GLUploadWorker.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GL_UPLOAD_WORKER_H
+#define LLGL_GL_UPLOAD_WORKER_H
+
+
+#include <LLGL/Surface.h>
+#include <LLGL/ImageFlags.h>
+#include <LLGL/TextureFlags.h>
+#include <LLGL/Container/DynamicArray.h>
+#include "../OpenGL.h"
+#include "../RenderState/GLState.h"
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+
+
+namespace LLGL
+{
+
+
+class GLTexture;
+class GLBuffer;
+class GLContext;
+class GLContextManager;
+class GLSwapChainContext;
+
+/*
+Worker thread with a shared GL context to upload texture and buffer data off the render thread.
+Texture data is copied into a pixel buffer object (GL_PIXEL_UNPACK_BUFFER) and transferred with glTexSubImage* on the worker context,
+so the implicit driver copy and synchronization of large uploads no longer stall the frame on the render thread.
+Each batch of uploads is fenced with glFenceSync, and the render thread waits for these fences on the GPU timeline (glWaitSync) whenever it flushes this worker.
+*/
+class GLUploadWorker
+{
+
+    public:
+
+        // Returns the instance of this singleton.
+        static GLUploadWorker& Get();
+
+    public:
+
+        GLUploadWorker(const GLUploadWorker&) = delete;
+        GLUploadWorker& operator = (const GLUploadWorker&) = delete;
+
+        GLUploadWorker(GLUploadWorker&&) = delete;
+        GLUploadWorker& operator = (GLUploadWorker&&) = delete;
+
+        ~GLUploadWorker();
+
+        // Returns true if uploads on a worker thread are supported, i.e. the platform can share GL contexts across threads and "GL_ARB_sync" and "GL_ARB_copy_buffer" are available.
+        static bool IsSupported();
+
+        /*
+        Starts the worker thread with a new GL context that shares its objects with the primary context of the specified context manager.
+        Must be called on the render thread while a swap-chain context is current. Returns false if the worker could not be started.
+        */
+        bool Start(GLContextManager& contextMngr);
+
+        // Waits until all pending uploads have been submitted, stops the worker thread, and releases the shared GL context.
+        void Clear();
+
+        // Returns true if the worker thread is running.
+        inline bool IsRunning() const
+        {
+            return thread_.joinable();
+        }
+
+        // Returns true if the specified texture upload should be transferred by the worker thread. Small uploads are cheaper to transfer directly.
+        bool IsAsyncTextureUpload(const GLTexture& texture, const TextureRegion& region, const ImageView& srcImageView) const;
+
+        // Returns true if the specified buffer upload should be transferred by the worker thread.
+        bool IsAsyncBufferUpload(GLsizeiptr size) const;
+
+        // Copies the image data and hands it over to the worker thread. The source image can be released as soon as this function returns.
+        void WriteTexture(const GLTexture& texture, const TextureRegion& region, const ImageView& srcImageView);
+
+        // Copies the buffer data and hands it over to the worker thread. The source data can be released as soon as this function returns.
+        void WriteBuffer(const GLBuffer& buffer, GLintptr offset, GLsizeiptr size, const void* data);
+
+        /*
+        Makes the current GL context wait for all previous uploads on the GPU timeline.
+        This only blocks the calling thread until the worker has submitted all pending uploads, not until they have been completed by the GPU.
+        */
+        void Flush();
+
+    private:
+
+        struct UploadJob
+        {
+            GLuint              id              = 0;
+            bool                isTexture       = false;
+            TextureType         textureType     = TextureType::Texture2D;
+            TextureRegion       region;
+            ImageFormat         format          = ImageFormat::RGBA;
+            DataType            dataType        = DataType::UInt8;
+            GLenum              internalFormat  = 0;
+            GLintptr            offset          = 0;
+            DynamicByteArray    data;
+        };
+
+        struct UploadTarget
+        {
+            GLuint              id;
+            bool                isTexture;
+            GLTextureTarget     textureTarget;
+            GLBufferTarget      bufferTarget;
+        };
+
+    private:
+
+        GLUploadWorker() = default;
+
+        // Enqueues the specified upload job and records its destination, so the render thread can re-bind it once the upload is visible.
+        void EnqueueJob(UploadJob&& job, const UploadTarget& target);
+
+        // Entry point of the worker thread.
+        void Run();
+
+        // Executes the specified upload job on the worker context.
+        void ExecuteJob(const UploadJob& job);
+
+    private:
+
+        std::unique_ptr<Surface>            surface_;
+        std::unique_ptr<GLContext>          context_;
+        std::unique_ptr<GLSwapChainContext> swapChainContext_;
+
+        std::thread                         thread_;
+        std::mutex                          mutex_;
+        std::condition_variable             jobsCondVar_;           // Signals the worker thread that new jobs are pending or it shall quit.
+        std::condition_variable             submitCondVar_;         // Signals the render thread that a batch of jobs has been submitted.
+        std::vector<UploadJob>              pendingJobs_;
+        std::size_t                         numUnsubmittedJobs_     = 0;
+        std::vector<GLsync>                 submittedSyncs_;
+        bool                                isContextCurrent_       = false;
+        bool                                hasStarted_             = false;
+        bool                                quit_                   = false;
+
+        GLuint                              pixelBuffer_            = 0;    // PBO of the worker context; only accessed by the worker thread.
+
+        std::vector<UploadTarget>           uploadTargets_;                 // Destinations of uploads since the last flush; only accessed by the render thread.
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,290 @@
+/*
+ * LinuxEGLContext.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "LinuxEGLContext.h"
+#include "../../../CheckedCast.h"
+#include "../../../../Core/CoreUtils.h"
+#include "../../../../Core/Assertion.h"
+#include <EGL/eglext.h>
+#include <cstring>
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+#ifndef EGL_PLATFORM_SURFACELESS_MESA
+#define EGL_PLATFORM_SURFACELESS_MESA 0x31DD
+#endif
+
+#ifndef EGL_PLATFORM_DEVICE_EXT
+#define EGL_PLATFORM_DEVICE_EXT 0x313F
+#endif
+
+
+/*
+ * Internal functions
+ */
+
+// Returns true if the specified name is included in the space separated EGL extension string.
+static bool HasEGLExtension(const char* extensions, const char* name)
+{
+    if (extensions == nullptr)
+        return false;
+
+    const std::size_t nameLen = std::strlen(name);
+    for (const char* s = extensions; (s = std::strstr(s, name)) != nullptr; s += nameLen)
+    {
+        if ((s == extensions || s[-1] == ' ') && (s[nameLen] == ' ' || s[nameLen] == '\0'))
+            return true;
+    }
+
+    return false;
+}
+
+// Returns an EGL display that does not require a display connection, i.e. Mesa's surfaceless platform or the first EGL device.
+static EGLDisplay GetHeadlessEGLDisplay()
+{
+    const char* clientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+
+    auto GetPlatformDisplayEXT = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
+    if (GetPlatformDisplayEXT != nullptr)
+    {
+        if (HasEGLExtension(clientExtensions, "EGL_MESA_platform_surfaceless"))
+        {
+            EGLDisplay display = GetPlatformDisplayEXT(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+            if (display != EGL_NO_DISPLAY)
+                return display;
+        }
+
+        if (HasEGLExtension(clientExtensions, "EGL_EXT_platform_device"))
+        {
+            auto QueryDevicesEXT = reinterpret_cast<PFNEGLQUERYDEVICESEXTPROC>(eglGetProcAddress("eglQueryDevicesEXT"));
+            EGLDeviceEXT device = nullptr;
+            EGLint numDevices = 0;
+            if (QueryDevicesEXT != nullptr && QueryDevicesEXT(1, &device, &numDevices) == EGL_TRUE && numDevices > 0)
+            {
+                EGLDisplay display = GetPlatformDisplayEXT(EGL_PLATFORM_DEVICE_EXT, device, nullptr);
+                if (display != EGL_NO_DISPLAY)
+                    return display;
+            }
+        }
+    }
+
+    /* Fall back to default display of the EGL implementation */
+    return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+}
+
+// EGL displays are shared between all headless contexts, since eglTerminate invalidates all resources of a display.
+static EGLDisplay   g_headlessDisplay           = EGL_NO_DISPLAY;
+static int          g_headlessDisplayRefCount   = 0;
+
+static EGLDisplay AcquireHeadlessEGLDisplay()
+{
+    if (g_headlessDisplayRefCount++ == 0)
+    {
+        g_headlessDisplay = GetHeadlessEGLDisplay();
+        if (g_headlessDisplay == EGL_NO_DISPLAY)
+            LLGL_TRAP("failed to get EGL display for headless GL context");
+        if (eglInitialize(g_headlessDisplay, nullptr, nullptr) == EGL_FALSE)
+            LLGL_TRAP("eglInitialize failed (error code = 0x%04X)", static_cast<unsigned>(eglGetError()));
+    }
+    return g_headlessDisplay;
+}
+
+static void ReleaseHeadlessEGLDisplay()
+{
+    if (g_headlessDisplayRefCount > 0 && --g_headlessDisplayRefCount == 0)
+    {
+        eglTerminate(g_headlessDisplay);
+        g_headlessDisplay = EGL_NO_DISPLAY;
+    }
+}
+
+
+/*
+ * GLContext class
+ */
+
+std::unique_ptr<GLContext> GLContext::CreateHeadless(
+    const GLPixelFormat&                pixelFormat,
+    const RendererConfigurationOpenGL&  profile,
+    GLContext*                          sharedContext)
+{
+    LinuxEGLContext* sharedContextEGL = (sharedContext != nullptr ? LLGL_CAST(LinuxEGLContext*, sharedContext) : nullptr);
+    return MakeUnique<LinuxEGLContext>(pixelFormat, profile, sharedContextEGL);
+}
+
+
+/*
+ * LinuxEGLContext class
+ */
+
+LinuxEGLContext::LinuxEGLContext(
+    const GLPixelFormat&                pixelFormat,
+    const RendererConfigurationOpenGL&  profile,
+    LinuxEGLContext*                    sharedContext)
+:
+    display_ { AcquireHeadlessEGLDisplay() }
+{
+    /* Flush previous error code */
+    (void)eglGetError();
+
+    if (eglBindAPI(EGL_OPENGL_API) == EGL_FALSE)
+        LLGL_TRAP("eglBindAPI(EGL_OPENGL_API) failed (error code = 0x%04X)", static_cast<unsigned>(eglGetError()));
+
+    /* Select EGL context configuration for pixel format */
+    if (!SelectConfig(pixelFormat))
+    {
+        LLGL_TRAP(
+            "eglChooseConfig [colorBits = %d, depthBits = %d, stencilBits = %d] failed (error code = 0x%04X)",
+            pixelFormat.colorBits, pixelFormat.depthBits, pixelFormat.stencilBits, static_cast<unsigned>(eglGetError())
+        );
+    }
+
+    CreateContext(profile, sharedContext);
+    MakeCurrentWithoutSurface();
+}
+
+LinuxEGLContext::~LinuxEGLContext()
+{
+    DeleteContext();
+    ReleaseHeadlessEGLDisplay();
+}
+
+int LinuxEGLContext::GetSamples() const
+{
+    return samples_;
+}
+
+bool LinuxEGLContext::GetNativeHandle(void* /*nativeHandle*/, std::size_t /*nativeHandleSize*/) const
+{
+    /* OpenGL::RenderSystemNativeHandle only holds a GLX context on GNU/Linux */
+    return false;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool LinuxEGLContext::SetSwapInterval(int /*interval*/)
+{
+    /* Headless contexts never present anything */
+    return false;
+}
+
+bool LinuxEGLContext::SelectConfig(const GLPixelFormat& pixelFormat)
+{
+    /* Headless contexts have no default framebuffer, so only render targets are multi-sampled */
+    const EGLint attribs[] =
+    {
+        EGL_SURFACE_TYPE,       EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE,    EGL_OPENGL_BIT,
+        EGL_RED_SIZE,           8,
+        EGL_GREEN_SIZE,         8,
+        EGL_BLUE_SIZE,          8,
+        EGL_ALPHA_SIZE,         8,
+        EGL_DEPTH_SIZE,         pixelFormat.depthBits,
+        EGL_STENCIL_SIZE,       pixelFormat.stencilBits,
+        EGL_NONE
+    };
+
+    EGLint numConfigs = 0;
+    if (eglChooseConfig(display_, attribs, &config_, 1, &numConfigs) == EGL_TRUE && numConfigs > 0)
+    {
+        samples_ = std::max(1, pixelFormat.samples);
+        SetDefaultColorFormat();
+        DeduceDepthStencilFormat(pixelFormat.depthBits, pixelFormat.stencilBits);
+        return true;
+    }
+
+    return false;
+}
+
+void LinuxEGLContext::CreateContext(const RendererConfigurationOpenGL& profile, LinuxEGLContext* sharedContext)
+{
+    EGLContext sharedEGLContext = (sharedContext != nullptr ? sharedContext->context_ : EGL_NO_CONTEXT);
+
+    if (profile.contextProfile == OpenGLContextProfile::CoreProfile)
+    {
+        if (profile.majorVersion == 0 && profile.minorVersion == 0)
+        {
+            /* Try highest GL version first, since EGL has no intermediate context to query the supported version from */
+            static const EGLint glVersions[][2] =
+            {
+                { 4, 6 }, { 4, 5 }, { 4, 4 }, { 4, 3 }, { 4, 2 }, { 4, 1 }, { 4, 0 }, { 3, 3 }, { 3, 2 }
+            };
+            for (const EGLint (&version)[2] : glVersions)
+            {
+                context_ = CreateEGLContextForVersion(version[0], version[1], EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT, sharedEGLContext);
+                if (context_ != EGL_NO_CONTEXT)
+                    break;
+            }
+        }
+        else
+            context_ = CreateEGLContextForVersion(profile.majorVersion, profile.minorVersion, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT, sharedEGLContext);
+    }
+    else
+    {
+        /* Create compatibility profile; version 1.0 lets the driver choose the highest compatible version */
+        context_ = CreateEGLContextForVersion(1, 0, EGL_CONTEXT_OPENGL_COMPATIBILITY_PROFILE_BIT, sharedEGLContext);
+    }
+
+    if (context_ == EGL_NO_CONTEXT)
+        LLGL_TRAP("eglCreateContext failed (error code = 0x%04X)", static_cast<unsigned>(eglGetError()));
+}
+
+void LinuxEGLContext::DeleteContext()
+{
+    /* Only release this context if it's current, so deleting a shared context doesn't unbind the context of the calling thread */
+    if (eglGetCurrentContext() == context_)
+        eglMakeCurrent(display_, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    if (pbuffer_ != EGL_NO_SURFACE)
+        eglDestroySurface(display_, pbuffer_);
+    eglDestroyContext(display_, context_);
+}
+
+EGLContext LinuxEGLContext::CreateEGLContextForVersion(EGLint major, EGLint minor, EGLint profileMask, EGLContext sharedEGLContext)
+{
+    const EGLint contextAttribs[] =
+    {
+        EGL_CONTEXT_MAJOR_VERSION,          major,
+        EGL_CONTEXT_MINOR_VERSION,          minor,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK,    profileMask,
+        EGL_NONE
+    };
+    return eglCreateContext(display_, config_, sharedEGLContext, contextAttribs);
+}
+
+void LinuxEGLContext::MakeCurrentWithoutSurface()
+{
+    /* Make context current without any surface if supported, otherwise on a minimal placeholder pbuffer */
+    if (!HasEGLExtension(eglQueryString(display_, EGL_EXTENSIONS), "EGL_KHR_surfaceless_context"))
+    {
+        const EGLint pbufferAttribs[] =
+        {
+            EGL_WIDTH,  1,
+            EGL_HEIGHT, 1,
+            EGL_NONE
+        };
+        pbuffer_ = eglCreatePbufferSurface(display_, config_, pbufferAttribs);
+        if (pbuffer_ == EGL_NO_SURFACE)
+            LLGL_TRAP("eglCreatePbufferSurface failed (error code = 0x%04X)", static_cast<unsigned>(eglGetError()));
+    }
+
+    if (eglMakeCurrent(display_, pbuffer_, pbuffer_, context_) == EGL_FALSE)
+        LLGL_TRAP("eglMakeCurrent failed on headless GL context (error code = 0x%04X)", static_cast<unsigned>(eglGetError()));
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,86 @@
+/*
+ * LinuxEGLContext.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_LINUX_EGL_CONTEXT_H
+#define LLGL_LINUX_EGL_CONTEXT_H
+
+
+#include "../GLContext.h"
+#include "../../OpenGL.h"
+#include <LLGL/RendererConfiguration.h>
+#include <EGL/egl.h>
+
+
+namespace LLGL
+{
+
+
+// Implementation of the <GLContext> interface for headless rendering on GNU/Linux and wrapper for a native EGL context without a display connection.
+class LinuxEGLContext : public GLContext
+{
+
+    public:
+
+        LinuxEGLContext(
+            const GLPixelFormat&                pixelFormat,
+            const RendererConfigurationOpenGL&  profile,
+            LinuxEGLContext*                    sharedContext
+        );
+        ~LinuxEGLContext();
+
+        int GetSamples() const override;
+
+        bool GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize) const override;
+
+    public:
+
+        // Returns the native EGL display.
+        inline EGLDisplay GetEGLDisplay() const
+        {
+            return display_;
+        }
+
+        // Returns the native EGL context.
+        inline EGLContext GetEGLContext() const
+        {
+            return context_;
+        }
+
+    private:
+
+        bool SetSwapInterval(int interval) override;
+
+    private:
+
+        bool SelectConfig(const GLPixelFormat& pixelFormat);
+
+        void CreateContext(const RendererConfigurationOpenGL& profile, LinuxEGLContext* sharedContext);
+        void DeleteContext();
+
+        EGLContext CreateEGLContextForVersion(EGLint major, EGLint minor, EGLint profileMask, EGLContext sharedEGLContext);
+
+        void MakeCurrentWithoutSurface();
+
+    private:
+
+        EGLDisplay  display_    = EGL_NO_DISPLAY;
+        EGLConfig   config_     = nullptr;
+        EGLContext  context_    = EGL_NO_CONTEXT;
+        EGLSurface  pbuffer_    = EGL_NO_SURFACE;   // Placeholder surface if EGL_KHR_surfaceless_context is not supported.
+        int         samples_    = 1;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -168,7 +168,9 @@ void LinuxGLContext::CreateGLXContext(
 
 void LinuxGLContext::DeleteGLXContext()
 {
-    glXMakeCurrent(display_, None, nullptr);
+    /* Only release this context if it's current, so deleting a shared context doesn't unbind the context of the calling thread */
+    if (glXGetCurrentContext() == glc_)
+        glXMakeCurrent(display_, None, nullptr);
     glXDestroyContext(display_, glc_);
 }
 
@@ -230,7 +232,7 @@ GLXContext LinuxGLContext::CreateGLXContextCoreProfile(GLXContext glcShared, int
                 None
             };
 
-            GLXContext glc = glXCreateContextAttribsARB(display_, fbcList[0], nullptr, True, contextAttribs);
+            GLXContext glc = glXCreateContextAttribsARB(display_, fbcList[0], glcShared, True, contextAttribs);
 
             XFree(fbcList);
 
@@ -60,12 +60,22 @@ void LinuxGLSwapChainContext::Resize(const Extent2D& resolution)
     // dummy
 }
 
+/*
+Swap-chains with the same pixel format share their GL context, so only the drawable changes between them.
+glXMakeCurrent is a round-trip to the X server, so it is skipped if the same display, drawable, and context are already current.
+*/
 bool LinuxGLSwapChainContext::MakeCurrentGLXContext(LinuxGLSwapChainContext* context)
 {
     if (context)
+    {
+        if (glXGetCurrentContext() == context->glc_ && glXGetCurrentDrawable() == context->wnd_ && glXGetCurrentDisplay() == context->dpy_)
+            return true;
         return glXMakeCurrent(context->dpy_, context->wnd_, context->glc_);
+    }
+    else if (::Display* dpy = glXGetCurrentDisplay())
+        return glXMakeCurrent(dpy, None, nullptr);
     else
-        return glXMakeCurrent(nullptr, 0, 0);
+        return true;
 }
 
 
@@ -60,12 +60,22 @@ void Win32GLSwapChainContext::Resize(const Extent2D& resolution)
     // do nothing (WGL context does not need to be resized)
 }
 
+/*
+Swap-chains with the same pixel format share their GL context, so only the device context (HDC) changes between them.
+wglMakeCurrent flushes the previous context even if nothing changes, so it is skipped if the same HDC and HGLRC are already current.
+*/
 bool Win32GLSwapChainContext::MakeCurrentWGLContext(Win32GLSwapChainContext* context)
 {
     if (context)
+    {
+        if (wglGetCurrentContext() == context->hGLRC_ && wglGetCurrentDC() == context->hDC_)
+            return true;
         return (wglMakeCurrent(context->hDC_, context->hGLRC_) != GL_FALSE);
-    else
+    }
+    else if (wglGetCurrentContext() != nullptr)
         return (wglMakeCurrent(nullptr, nullptr) != GL_FALSE);
+    else
+        return true;
 }
 
 
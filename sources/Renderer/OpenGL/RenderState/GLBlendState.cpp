@@ -15,6 +15,7 @@
 #include "../../../Core/MacroUtils.h"
 #include "../Texture/GLRenderTarget.h"
 #include "GLStateManager.h"
+#include "GLPipelineCache.h"
 #include <LLGL/PipelineStateFlags.h>
 #include <LLGL/Utils/ForRange.h>
 
@@ -58,10 +59,16 @@ GLBlendState::GLBlendState(const BlendDescriptor& desc, std::uint32_t numColorAt
     if (multiSampleEnabled_)
         stateMngr.SetSampleMask(sampleMask_);
     #endif
+
+    UpdateHash();
 }
 
-void GLBlendState::Bind(GLStateManager& stateMngr)
+void GLBlendState::Bind(GLStateManager& stateMngr, const GLBlendState* prevState)
 {
+    /* Only bind the difference to the previous blend state if their draw buffer configurations match */
+    if (!IsDeltaCompatible(prevState))
+        prevState = nullptr;
+
     /* Set blend factor */
     if (blendColorEnabled_)
         stateMngr.SetBlendColor(blendColor_);
@@ -77,7 +84,7 @@ void GLBlendState::Bind(GLStateManager& stateMngr)
         stateMngr.SetLogicOp(logicOp_);
 
         /* Bind only color masks for all draw buffers */
-        BindDrawBufferColorMasks(stateMngr);
+        BindDrawBufferColorMasks(stateMngr, prevState);
     }
     else
     {
@@ -85,13 +92,13 @@ void GLBlendState::Bind(GLStateManager& stateMngr)
         stateMngr.Disable(GLState::ColorLogicOp);
 
         /* Bind blend states for all draw buffers */
-        BindDrawBufferStates(stateMngr);
+        BindDrawBufferStates(stateMngr, prevState);
     }
 
     #else // LLGL_OPENGL
 
     /* Bind blend states for all draw buffers */
-    BindDrawBufferStates(stateMngr);
+    BindDrawBufferStates(stateMngr, prevState);
 
     #endif // /LLGL_OPENGL
 }
@@ -103,6 +110,7 @@ void GLBlendState::BindColorMaskOnly(GLStateManager& stateMngr)
 
 int GLBlendState::CompareSWO(const GLBlendState& lhs, const GLBlendState& rhs)
 {
+    LLGL_COMPARE_MEMBER_SWO     ( hash_                  );
     LLGL_COMPARE_MEMBER_SWO     ( blendColor_[0]         );
     LLGL_COMPARE_MEMBER_SWO     ( blendColor_[1]         );
     LLGL_COMPARE_MEMBER_SWO     ( blendColor_[2]         );
@@ -130,12 +138,59 @@ int GLBlendState::CompareSWO(const GLBlendState& lhs, const GLBlendState& rhs)
  * ======= Private: =======
  */
 
-void GLBlendState::BindDrawBufferStates(GLStateManager& stateMngr)
+void GLBlendState::UpdateHash()
+{
+    std::uint64_t hash = GLPipelineCache::HashBytes(blendColor_, sizeof(blendColor_));
+    hash = GLPipelineCache::HashBytes(&sampleAlphaToCoverage_, sizeof(sampleAlphaToCoverage_), hash);
+    #ifdef LLGL_OPENGL
+    hash = GLPipelineCache::HashBytes(&logicOpEnabled_, sizeof(logicOpEnabled_), hash);
+    hash = GLPipelineCache::HashBytes(&logicOp_, sizeof(logicOp_), hash);
+    #endif
+    hash = GLPipelineCache::HashBytes(&numDrawBuffers_, sizeof(numDrawBuffers_), hash);
+
+    /* Hash draw buffer states member by member, since GLDrawBufferState has padding bytes */
+    for_range(i, numDrawBuffers_)
+    {
+        const GLDrawBufferState& state = drawBuffers_[i];
+        hash = GLPipelineCache::HashBytes(&state.blendEnabled, sizeof(state.blendEnabled), hash);
+        hash = GLPipelineCache::HashBytes(&state.srcColor, sizeof(GLenum) * 6, hash);
+        hash = GLPipelineCache::HashBytes(state.colorMask, sizeof(state.colorMask), hash);
+    }
+
+    hash_ = hash;
+}
+
+bool GLBlendState::IsDeltaCompatible(const GLBlendState* prevState) const
+{
+    if (prevState == nullptr || prevState->numDrawBuffers_ != numDrawBuffers_)
+        return false;
+
+    #ifdef LLGL_OPENGL
+    /* Blend states of draw buffers are not bound while logic pixel operations are enabled */
+    if (prevState->logicOpEnabled_ != logicOpEnabled_)
+        return false;
+    #endif
+
+    return true;
+}
+
+bool GLBlendState::HasDrawBufferStateChanged(const GLBlendState* prevState, GLuint index) const
+{
+    return (prevState == nullptr || GLDrawBufferState::CompareSWO(drawBuffers_[index], prevState->drawBuffers_[index]) != 0);
+}
+
+bool GLBlendState::HasDrawBufferColorMaskChanged(const GLBlendState* prevState, GLuint index) const
+{
+    return (prevState == nullptr || !GLDrawBufferState::EqualsColorMask(drawBuffers_[index], prevState->drawBuffers_[index]));
+}
+
+void GLBlendState::BindDrawBufferStates(GLStateManager& stateMngr, const GLBlendState* prevState)
 {
     if (numDrawBuffers_ == 1)
     {
         /* Bind blend states for all draw buffers */
-        BindDrawBufferState(drawBuffers_[0]);
+        if (HasDrawBufferStateChanged(prevState, 0))
+            BindDrawBufferState(drawBuffers_[0]);
     }
     else if (numDrawBuffers_ > 1)
     {
@@ -144,31 +199,43 @@ void GLBlendState::BindDrawBufferStates(GLStateManager& stateMngr)
         {
             /* Bind blend states for respective draw buffers directly via extension */
             for (GLuint i = 0; i < numDrawBuffers_; ++i)
-                BindIndexedDrawBufferState(drawBuffers_[i], i);
+            {
+                if (HasDrawBufferStateChanged(prevState, i))
+                    BindIndexedDrawBufferState(drawBuffers_[i], i);
+            }
         }
         else
         #endif // /GL_ARB_draw_buffers_blend
         {
             /* Bind blend states with emulated draw buffer setting */
+            bool drawBufferChanged = false;
             for (GLuint i = 0; i < numDrawBuffers_; ++i)
             {
-                GLProfile::DrawBuffer(GLTypes::ToColorAttachment(i));
-                BindDrawBufferState(drawBuffers_[i]);
+                if (HasDrawBufferStateChanged(prevState, i))
+                {
+                    GLProfile::DrawBuffer(GLTypes::ToColorAttachment(i));
+                    BindDrawBufferState(drawBuffers_[i]);
+                    drawBufferChanged = true;
+                }
             }
 
             /* Restore draw buffer settings for current render target */
-            if (auto boundRenderTarget = stateMngr.GetBoundRenderTarget())
-                boundRenderTarget->SetDrawBuffers();
+            if (drawBufferChanged)
+            {
+                if (auto boundRenderTarget = stateMngr.GetBoundRenderTarget())
+                    boundRenderTarget->SetDrawBuffers();
+            }
         }
     }
 }
 
-void GLBlendState::BindDrawBufferColorMasks(GLStateManager& stateMngr)
+void GLBlendState::BindDrawBufferColorMasks(GLStateManager& stateMngr, const GLBlendState* prevState)
 {
     if (numDrawBuffers_ == 1)
     {
         /* Bind color mask for all draw buffers */
-        BindDrawBufferColorMask(drawBuffers_[0]);
+        if (HasDrawBufferColorMaskChanged(prevState, 0))
+            BindDrawBufferColorMask(drawBuffers_[0]);
     }
     else if (numDrawBuffers_ > 1)
     {
@@ -177,21 +244,32 @@ void GLBlendState::BindDrawBufferColorMasks(GLStateManager& stateMngr)
         {
             /* Bind color mask for respective draw buffers directly via extension */
             for (GLuint i = 0; i < numDrawBuffers_; ++i)
-                BindIndexedDrawBufferColorMask(drawBuffers_[i], i);
+            {
+                if (HasDrawBufferColorMaskChanged(prevState, i))
+                    BindIndexedDrawBufferColorMask(drawBuffers_[i], i);
+            }
         }
         else
         #endif // /GL_EXT_draw_buffers2
         {
             /* Bind color masks with emulated draw buffer setting */
+            bool drawBufferChanged = false;
             for (GLuint i = 0; i < numDrawBuffers_; ++i)
             {
-                GLProfile::DrawBuffer(GLTypes::ToColorAttachment(i));
-                BindDrawBufferColorMask(drawBuffers_[i]);
+                if (HasDrawBufferColorMaskChanged(prevState, i))
+                {
+                    GLProfile::DrawBuffer(GLTypes::ToColorAttachment(i));
+                    BindDrawBufferColorMask(drawBuffers_[i]);
+                    drawBufferChanged = true;
+                }
             }
 
             /* Restore draw buffer settings for current render target */
-            if (auto boundRenderTarget = stateMngr.GetBoundRenderTarget())
-                boundRenderTarget->SetDrawBuffers();
+            if (drawBufferChanged)
+            {
+                if (auto boundRenderTarget = stateMngr.GetBoundRenderTarget())
+                    boundRenderTarget->SetDrawBuffers();
+            }
         }
     }
 }
@@ -278,6 +356,17 @@ int GLBlendState::GLDrawBufferState::CompareSWO(const GLDrawBufferState& lhs, co
     return 0;
 }
 
+bool GLBlendState::GLDrawBufferState::EqualsColorMask(const GLDrawBufferState& lhs, const GLDrawBufferState& rhs)
+{
+    return
+    (
+        lhs.colorMask[0] == rhs.colorMask[0] &&
+        lhs.colorMask[1] == rhs.colorMask[1] &&
+        lhs.colorMask[2] == rhs.colorMask[2] &&
+        lhs.colorMask[3] == rhs.colorMask[3]
+    );
+}
+
 
 } // /namespace LLGL
 
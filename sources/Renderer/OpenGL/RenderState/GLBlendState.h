@@ -36,15 +36,24 @@ class GLBlendState
 
         GLBlendState(const BlendDescriptor& desc, std::uint32_t numColorAttachments);
 
-        // Binds the entire blend state.
-        void Bind(GLStateManager& stateMngr);
+        /*
+        Binds the entire blend state. If the previously bound blend state 'prevState' is specified,
+        only the draw buffer states that differ from it are re-submitted to GL.
+        */
+        void Bind(GLStateManager& stateMngr, const GLBlendState* prevState = nullptr);
 
         // Binds only the color masks for all draw buffers of this blend state.
         void BindColorMaskOnly(GLStateManager& stateMngr);
 
+        // Returns the hash of all states that are considered by CompareSWO.
+        inline std::uint64_t GetHash() const
+        {
+            return hash_;
+        }
+
     public:
 
-        // Returns a signed integer of the strict-weak-order (SWO) comparison, and 0 on equality.
+        // Returns a signed integer of the strict-weak-order (SWO) comparison, and 0 on equality. The hash is compared first to keep most comparisons short.
         static int CompareSWO(const GLBlendState& lhs, const GLBlendState& rhs);
 
     private:
@@ -53,6 +62,7 @@ class GLBlendState
         {
             static void Convert(GLDrawBufferState& dst, const BlendTargetDescriptor& src);
             static int CompareSWO(const GLDrawBufferState& lhs, const GLDrawBufferState& rhs);
+            static bool EqualsColorMask(const GLDrawBufferState& lhs, const GLDrawBufferState& rhs);
 
             GLboolean   blendEnabled    = GL_FALSE;
             GLenum      srcColor        = GL_ONE;
@@ -66,8 +76,17 @@ class GLBlendState
 
     private:
 
-        void BindDrawBufferStates(GLStateManager& stateMngr);
-        void BindDrawBufferColorMasks(GLStateManager& stateMngr);
+        void UpdateHash();
+
+        // Returns true if the draw buffer states of this blend state can be bound as delta to the specified previous blend state.
+        bool IsDeltaCompatible(const GLBlendState* prevState) const;
+
+        // Returns true if the specified draw buffer state (or only its color mask) differs from the previous blend state or if there is no previous blend state.
+        bool HasDrawBufferStateChanged(const GLBlendState* prevState, GLuint index) const;
+        bool HasDrawBufferColorMaskChanged(const GLBlendState* prevState, GLuint index) const;
+
+        void BindDrawBufferStates(GLStateManager& stateMngr, const GLBlendState* prevState = nullptr);
+        void BindDrawBufferColorMasks(GLStateManager& stateMngr, const GLBlendState* prevState = nullptr);
 
         void BindDrawBufferState(const GLDrawBufferState& state);
         void BindIndexedDrawBufferState(const GLDrawBufferState& state, GLuint index);
@@ -88,6 +107,7 @@ class GLBlendState
         #endif
         GLuint              numDrawBuffers_                                 = 0;
         GLDrawBufferState   drawBuffers_[LLGL_MAX_NUM_COLOR_ATTACHMENTS]    = {};
+        std::uint64_t       hash_                                           = 0;
 
 };
 
@@ -14,7 +14,7 @@ namespace LLGL
 
 
 GLComputePSO::GLComputePSO(const ComputePipelineDescriptor& desc, PipelineCache* pipelineCache) :
-    GLPipelineState { /*isGraphicsPSO:*/ false, desc.pipelineLayout, pipelineCache, { desc.computeShader } }
+    GLPipelineState { /*isGraphicsPSO:*/ false, desc.pipelineLayout, pipelineCache, { desc.computeShader }, desc.asyncCompilation }
 {
 }
 
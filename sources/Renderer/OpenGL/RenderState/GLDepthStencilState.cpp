@@ -12,6 +12,7 @@
 #include "../GLTypes.h"
 #include "../../../Core/MacroUtils.h"
 #include "GLStateManager.h"
+#include "GLPipelineCache.h"
 #include <LLGL/PipelineStateFlags.h>
 
 
@@ -34,9 +35,11 @@ GLDepthStencilState::GLDepthStencilState(const DepthDescriptor& depthDesc, const
     GLStencilFaceState::Convert(stencilBack_, stencilDesc.back, stencilDesc.referenceDynamic);
 
     independentStencilFaces_ = (GLStencilFaceState::CompareSWO(stencilFront_, stencilBack_) != 0);
+
+    UpdateHash();
 }
 
-void GLDepthStencilState::Bind(GLStateManager& stateMngr)
+void GLDepthStencilState::Bind(GLStateManager& stateMngr, const GLDepthStencilState* prevState)
 {
     /* Setup depth state */
     if (depthTestEnabled_)
@@ -53,13 +56,14 @@ void GLDepthStencilState::Bind(GLStateManager& stateMngr)
     if (stencilTestEnabled_)
     {
         stateMngr.Enable(GLState::StencilTest);
+        const bool opsAndWriteMaskBound = HasEqualStencilOpsAndWriteMasks(prevState);
         if (independentStencilFaces_)
         {
-            BindStencilFaceState(stencilFront_, GL_FRONT);
-            BindStencilFaceState(stencilBack_, GL_BACK);
+            BindStencilFaceState(stencilFront_, GL_FRONT, opsAndWriteMaskBound);
+            BindStencilFaceState(stencilBack_, GL_BACK, opsAndWriteMaskBound);
         }
         else
-            BindStencilState(stencilFront_);
+            BindStencilState(stencilFront_, opsAndWriteMaskBound);
     }
     else
         stateMngr.Disable(GLState::StencilTest);
@@ -116,6 +120,8 @@ void GLDepthStencilState::BindStencilWriteMaskOnly()
 
 int GLDepthStencilState::CompareSWO(const GLDepthStencilState& lhs, const GLDepthStencilState& rhs)
 {
+    LLGL_COMPARE_MEMBER_SWO( hash_ );
+
     LLGL_COMPARE_BOOL_MEMBER_SWO( depthTestEnabled_ );
     if (lhs.depthTestEnabled_)
     {
@@ -127,6 +133,7 @@ int GLDepthStencilState::CompareSWO(const GLDepthStencilState& lhs, const GLDept
     if (lhs.stencilTestEnabled_)
     {
         LLGL_COMPARE_BOOL_MEMBER_SWO( independentStencilFaces_ );
+        LLGL_COMPARE_BOOL_MEMBER_SWO( referenceDynamic_ );
 
         {
             int order = GLStencilFaceState::CompareSWO(lhs.stencilFront_, rhs.stencilFront_);
@@ -134,7 +141,7 @@ int GLDepthStencilState::CompareSWO(const GLDepthStencilState& lhs, const GLDept
                 return order;
         }
 
-        if (!lhs.independentStencilFaces_)
+        if (lhs.independentStencilFaces_)
         {
             int order = GLStencilFaceState::CompareSWO(lhs.stencilBack_, rhs.stencilBack_);
             if (order != 0)
@@ -150,20 +157,60 @@ int GLDepthStencilState::CompareSWO(const GLDepthStencilState& lhs, const GLDept
  * ======= Private: =======
  */
 
-void GLDepthStencilState::BindStencilFaceState(const GLStencilFaceState& state, GLenum face)
+void GLDepthStencilState::UpdateHash()
+{
+    /* Only hash the states that are considered by CompareSWO, so equal states always have equal hashes */
+    std::uint64_t hash = GLPipelineCache::HashBytes(&depthTestEnabled_, sizeof(depthTestEnabled_));
+
+    if (depthTestEnabled_)
+    {
+        hash = GLPipelineCache::HashBytes(&depthMask_, sizeof(depthMask_), hash);
+        hash = GLPipelineCache::HashBytes(&depthFunc_, sizeof(depthFunc_), hash);
+    }
+
+    hash = GLPipelineCache::HashBytes(&stencilTestEnabled_, sizeof(stencilTestEnabled_), hash);
+
+    if (stencilTestEnabled_)
+    {
+        hash = GLPipelineCache::HashBytes(&independentStencilFaces_, sizeof(independentStencilFaces_), hash);
+        hash = GLPipelineCache::HashBytes(&referenceDynamic_, sizeof(referenceDynamic_), hash);
+        hash = GLPipelineCache::HashBytes(&stencilFront_, sizeof(stencilFront_), hash);
+        if (independentStencilFaces_)
+            hash = GLPipelineCache::HashBytes(&stencilBack_, sizeof(stencilBack_), hash);
+    }
+
+    hash_ = hash;
+}
+
+bool GLDepthStencilState::HasEqualStencilOpsAndWriteMasks(const GLDepthStencilState* prevState) const
 {
-    glStencilOpSeparate(face, state.sfail, state.dpfail, state.dppass);
+    if (prevState == nullptr || !prevState->stencilTestEnabled_ || prevState->independentStencilFaces_ != independentStencilFaces_)
+        return false;
+    if (!GLStencilFaceState::EqualsOpAndWriteMask(prevState->stencilFront_, stencilFront_))
+        return false;
+    if (independentStencilFaces_ && !GLStencilFaceState::EqualsOpAndWriteMask(prevState->stencilBack_, stencilBack_))
+        return false;
+    return true;
+}
+
+void GLDepthStencilState::BindStencilFaceState(const GLStencilFaceState& state, GLenum face, bool opsAndWriteMaskBound)
+{
+    if (!opsAndWriteMaskBound)
+        glStencilOpSeparate(face, state.sfail, state.dpfail, state.dppass);
     if (!referenceDynamic_)
         glStencilFuncSeparate(face, state.func, state.ref, state.mask);
-    glStencilMaskSeparate(face, state.writeMask);
+    if (!opsAndWriteMaskBound)
+        glStencilMaskSeparate(face, state.writeMask);
 }
 
-void GLDepthStencilState::BindStencilState(const GLStencilFaceState& state)
+void GLDepthStencilState::BindStencilState(const GLStencilFaceState& state, bool opsAndWriteMaskBound)
 {
-    glStencilOp(state.sfail, state.dpfail, state.dppass);
+    if (!opsAndWriteMaskBound)
+        glStencilOp(state.sfail, state.dpfail, state.dppass);
     if (!referenceDynamic_)
         glStencilFunc(state.func, state.ref, state.mask);
-    glStencilMask(state.writeMask);
+    if (!opsAndWriteMaskBound)
+        glStencilMask(state.writeMask);
 }
 
 
@@ -194,6 +241,17 @@ int GLDepthStencilState::GLStencilFaceState::CompareSWO(const GLStencilFaceState
     return 0;
 }
 
+bool GLDepthStencilState::GLStencilFaceState::EqualsOpAndWriteMask(const GLStencilFaceState& lhs, const GLStencilFaceState& rhs)
+{
+    return
+    (
+        lhs.sfail       == rhs.sfail    &&
+        lhs.dpfail      == rhs.dpfail   &&
+        lhs.dppass      == rhs.dppass   &&
+        lhs.writeMask   == rhs.writeMask
+    );
+}
+
 
 } // /namespace LLGL
 
@@ -13,6 +13,7 @@
 #include "../OpenGL.h"
 #include <memory>
 #include <limits.h>
+#include <cstdint>
 
 
 namespace LLGL
@@ -35,8 +36,11 @@ class GLDepthStencilState
 
         GLDepthStencilState(const DepthDescriptor& depthDesc, const StencilDescriptor& stencilDesc);
 
-        // Binds the entire depth-stencil state.
-        void Bind(GLStateManager& stateMngr);
+        /*
+        Binds the entire depth-stencil state. If the previously bound depth-stencil state 'prevState' is specified,
+        the stencil operations and write masks are only re-submitted to GL if they differ from it.
+        */
+        void Bind(GLStateManager& stateMngr, const GLDepthStencilState* prevState = nullptr);
 
         // Binds only the stencil reference together with the remaining parameters for the glStencilFunc* call.
         void BindStencilRefOnly(GLint ref, GLenum face = GL_FRONT_AND_BACK);
@@ -44,9 +48,15 @@ class GLDepthStencilState
         // Binds only the stencil write mask.
         void BindStencilWriteMaskOnly();
 
+        // Returns the hash of all states that are considered by CompareSWO.
+        inline std::uint64_t GetHash() const
+        {
+            return hash_;
+        }
+
     public:
 
-        // Returns a signed integer of the strict-weak-order (SWO) comparison, and 0 on equality.
+        // Returns a signed integer of the strict-weak-order (SWO) comparison, and 0 on equality. The hash is compared first to keep most comparisons short.
         static int CompareSWO(const GLDepthStencilState& lhs, const GLDepthStencilState& rhs);
 
     private:
@@ -55,6 +65,7 @@ class GLDepthStencilState
         {
             static void Convert(GLStencilFaceState& dst, const StencilFaceDescriptor& src, bool referenceDynamic);
             static int CompareSWO(const GLStencilFaceState& lhs, const GLStencilFaceState& rhs);
+            static bool EqualsOpAndWriteMask(const GLStencilFaceState& lhs, const GLStencilFaceState& rhs);
 
             GLenum  sfail       = GL_KEEP;
             GLenum  dpfail      = GL_KEEP;
@@ -67,8 +78,13 @@ class GLDepthStencilState
 
     private:
 
-        void BindStencilFaceState(const GLStencilFaceState& state, GLenum face);
-        void BindStencilState(const GLStencilFaceState& state);
+        void UpdateHash();
+
+        // Returns true if the stencil operations and write masks of the previous depth-stencil state are identical to this one.
+        bool HasEqualStencilOpsAndWriteMasks(const GLDepthStencilState* prevState) const;
+
+        void BindStencilFaceState(const GLStencilFaceState& state, GLenum face, bool opsAndWriteMaskBound = false);
+        void BindStencilState(const GLStencilFaceState& state, bool opsAndWriteMaskBound = false);
 
     private:
 
@@ -84,6 +100,8 @@ class GLDepthStencilState
         GLStencilFaceState  stencilFront_;
         GLStencilFaceState  stencilBack_;
 
+        std::uint64_t       hash_                       = 0;
+
 };
 
 
@@ -51,6 +51,36 @@ void GLFence::Submit()
     }
 }
 
+std::uint64_t GLFence::GetCompletedValue()
+{
+    /* Poll sync object without flushing, since this must not block the CPU */
+    if (completedValue_ < signaledValue_ && HasExtension(GLExt::ARB_sync))
+    {
+        GLenum result = glClientWaitSync(sync_, 0, 0);
+        if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED)
+            completedValue_ = signaledValue_;
+    }
+    return completedValue_;
+}
+
+void GLFence::SubmitValue(std::uint64_t value)
+{
+    Submit();
+    signaledValue_ = value;
+}
+
+bool GLFence::WaitValue(std::uint64_t value, GLuint64 timeout)
+{
+    if (completedValue_ >= value)
+        return true;
+    if (signaledValue_ < value)
+        return false;
+    if (!Wait(timeout))
+        return false;
+    completedValue_ = signaledValue_;
+    return true;
+}
+
 bool GLFence::Wait(GLuint64 timeout)
 {
     if (HasExtension(GLExt::ARB_sync))
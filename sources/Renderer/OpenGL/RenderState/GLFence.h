@@ -12,6 +12,7 @@
 #include <LLGL/Fence.h>
 #include "../OpenGL.h"
 #include <string>
+#include <cstdint>
 
 
 namespace LLGL
@@ -25,6 +26,8 @@ class GLFence final : public Fence
 
         void SetDebugName(const char* name) override;
 
+        std::uint64_t GetCompletedValue() override;
+
     public:
 
         ~GLFence();
@@ -32,9 +35,21 @@ class GLFence final : public Fence
         void Submit();
         bool Wait(GLuint64 timeout);
 
+        // Submits a new sync object that completes the specified timeline value.
+        void SubmitValue(std::uint64_t value);
+
+        // Waits until the specified timeline value has been completed. Values that have not been submitted yet cannot be completed by a single GL context.
+        bool WaitValue(std::uint64_t value, GLuint64 timeout);
+
     private:
 
-        GLsync      sync_ = 0;
+        /*
+        Timelines are emulated with a single sync object for the last submitted value.
+        Waiting for an earlier value waits for the last one, which is conservative but correct, since GL commands complete in order.
+        */
+        GLsync          sync_           = 0;
+        std::uint64_t   signaledValue_  = 0;
+        std::uint64_t   completedValue_ = 0;
 
         #ifdef LLGL_DEBUG
         // Only provide name in debug mode, to keep fence objects as lightweight as possible
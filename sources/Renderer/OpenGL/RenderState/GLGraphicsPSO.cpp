@@ -9,6 +9,7 @@
 #include "GLRenderPass.h"
 #include "GLStatePool.h"
 #include "../Ext/GLExtensions.h"
+#include "../Shader/GLShader.h"
 #include "../Shader/GLShaderProgram.h"
 #include "../GLTypes.h"
 #include "../GLCore.h"
@@ -46,7 +47,7 @@ static std::vector<Shader*> GetShaderArrayFromDesc(const GraphicsPipelineDescrip
 }
 
 GLGraphicsPSO::GLGraphicsPSO(const GraphicsPipelineDescriptor& desc, const RenderingLimits& limits, PipelineCache* pipelineCache) :
-    GLPipelineState { /*isGraphicsPSO:*/ true, desc.pipelineLayout, pipelineCache, GetShaderArrayFromDesc(desc) }
+    GLPipelineState { /*isGraphicsPSO:*/ true, desc.pipelineLayout, pipelineCache, GetShaderArrayFromDesc(desc), desc.asyncCompilation }
 {
     /* Convert input-assembler state */
     drawMode_       = GLTypes::ToDrawMode(desc.primitiveTopology);
@@ -70,6 +71,10 @@ GLGraphicsPSO::GLGraphicsPSO(const GraphicsPipelineDescriptor& desc, const Rende
     else
         patchVertices_ = 0;
 
+    /* Vertex shaders without input attributes fetch their vertices manually, which still requires a bound VAO in GL core profiles */
+    if (auto* vertexShaderGL = LLGL_CAST(const GLShader*, desc.vertexShader))
+        isAttributeless_ = (vertexShaderGL->GetNumVertexAttribs() == 0);
+
     /* Create depth-stencil state */
     depthStencilState_ = GLStatePool::Get().CreateDepthStencilState(desc.depth, desc.stencil);
 
@@ -95,6 +100,8 @@ GLGraphicsPSO::~GLGraphicsPSO()
     GLStatePool::Get().ReleaseDepthStencilState(std::move(depthStencilState_));
     GLStatePool::Get().ReleaseRasterizerState(std::move(rasterizerState_));
     GLStatePool::Get().ReleaseBlendState(std::move(blendState_));
+    if (emptyVertexArray_)
+        GLVertexArrayCache::Get().ReleaseVertexArray(std::move(emptyVertexArray_));
 }
 
 void GLGraphicsPSO::Bind(GLStateManager& stateMngr)
@@ -105,6 +112,8 @@ void GLGraphicsPSO::Bind(GLStateManager& stateMngr)
     /* Set input-assembler state */
     if (patchVertices_ > 0)
         stateMngr.SetPatchVertices(patchVertices_);
+    if (isAttributeless_)
+        BindEmptyVertexArray(stateMngr);
 
     /* Bind depth-stencil, rasterizer, and blend states */
     stateMngr.BindDepthStencilState(depthStencilState_.get());
@@ -223,6 +232,23 @@ void GLGraphicsPSO::SetStaticScissors(GLStateManager& stateMngr, ByteBufferItera
     stateMngr.SetScissorArray(0, numStaticScissors_, byteBufferIter.Next<GLScissor>(numStaticScissors_));
 }
 
+// Binds a shared VAO without any vertex attributes if no other VAO is bound, so attribute-less draw commands are valid.
+void GLGraphicsPSO::BindEmptyVertexArray(GLStateManager& stateMngr)
+{
+    #ifdef LLGL_GL_ENABLE_OPENGL2X
+    if (!HasNativeVAO())
+        return;
+    #endif // /LLGL_GL_ENABLE_OPENGL2X
+
+    if (stateMngr.GetBoundVertexArray() == 0)
+    {
+        /* Acquire empty VAO on first use, since VAOs are not shared between GL contexts */
+        if (!emptyVertexArray_)
+            emptyVertexArray_ = GLVertexArrayCache::Get().AcquireVertexArray(GLVertexArrayFormat{});
+        stateMngr.BindVertexArray(emptyVertexArray_->GetID());
+    }
+}
+
 
 } // /namespace LLGL
 
@@ -14,6 +14,7 @@
 #include "GLDepthStencilState.h"
 #include "GLRasterizerState.h"
 #include "GLBlendState.h"
+#include "../Buffer/GLVertexArrayCache.h"
 #include <LLGL/RenderSystemFlags.h>
 #include <LLGL/Container/DynamicArray.h>
 
@@ -58,12 +59,16 @@ class GLGraphicsPSO final : public GLPipelineState
         void SetStaticViewports(GLStateManager& stateMngr, ByteBufferIterator& byteBufferIter);
         void SetStaticScissors(GLStateManager& stateMngr, ByteBufferIterator& byteBufferIter);
 
+        void BindEmptyVertexArray(GLStateManager& stateMngr);
+
     private:
 
         // Input-assembler state
         GLenum                  drawMode_           = GL_TRIANGLES; // for glDraw*
         GLenum                  primitiveMode_      = GL_TRIANGLES; // for glBeginTransformFeedback*
         GLint                   patchVertices_      = 0;
+        bool                    isAttributeless_    = false; // Vertex shader has no input attributes, e.g. for vertex pulling from storage buffers.
+        GLSharedVertexArraySPtr emptyVertexArray_;
 
         // State objects
         GLDepthStencilStateSPtr depthStencilState_;
@@ -8,6 +8,7 @@
 #include "GLPipelineCache.h"
 #include "../Ext/GLExtensions.h"
 #include "../Ext/GLExtensionRegistry.h"
+#include "../../CheckedCast.h"
 #include <LLGL/Utils/ForRange.h>
 #include <string.h>
 
@@ -20,98 +21,105 @@ namespace LLGL
 
 struct GLPipelineCacheHeader
 {
-    std::uint32_t permutationOffsets[1];
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint32_t numEntries;
 }
 LLGL_PACK_STRUCT;
 
 struct GLPipelineCacheEntry
 {
-    GLenum  binaryFormat;
-    GLsizei binaryLength;
+    std::uint64_t   key;
+    GLenum          binaryFormat;
+    GLsizei         binaryLength;
 }
 LLGL_PACK_STRUCT;
 
 #include "../../../Core/PackStructPop.inl"
 
+static constexpr std::uint32_t g_pipelineCacheMagic     = 0x43504C47; // 'GLPC'
+static constexpr std::uint32_t g_pipelineCacheVersion   = 2;
+
 GLPipelineCache::GLPipelineCache(const Blob& initialBlob)
 {
-    if (const GLPipelineCacheHeader* header = reinterpret_cast<const GLPipelineCacheHeader*>(initialBlob.GetData()))
+    if (initialBlob)
     {
-        InitializeEntry(GLShader::PermutationDefault, header + 1);
-        if (header->permutationOffsets[0] > 0)
-            InitializeEntry(GLShader::PermutationFlippedYPosition, reinterpret_cast<const char*>(header) + header->permutationOffsets[0]);
+        /* Discard all entries if the blob is malformed, so the programs are simply re-linked */
+        if (!ReadEntries(static_cast<const char*>(initialBlob.GetData()), initialBlob.GetSize()))
+            entries_.clear();
     }
 }
 
 Blob GLPipelineCache::GetBlob() const
 {
-    /* Determine size of all cache entries */
-    std::size_t cacheSize = 0;
-    GLPipelineCacheHeader header = {};
-
-    for_range(permutation, GLShader::PermutationCount)
-    {
-        const CacheEntry& entry = entries_[permutation];
-        if (!entry.data.empty())
-        {
-            if (permutation > 0)
-                header.permutationOffsets[permutation - 1] = static_cast<std::uint32_t>(cacheSize);
-            cacheSize += sizeof(GLPipelineCacheEntry);
-            cacheSize += entry.length;
-        }
-    }
+    if (entries_.empty())
+        return Blob{};
 
-    if (cacheSize > 0)
-    {
-        /* Allocate cache blob including header */
-        cacheSize += sizeof(GLPipelineCacheHeader);
-        DynamicByteArray cache{ cacheSize, UninitializeTag{} };
+    /* Determine size of all cache entries */
+    std::size_t cacheSize = sizeof(GLPipelineCacheHeader);
+    for (const auto& entry : entries_)
+        cacheSize += sizeof(GLPipelineCacheEntry) + static_cast<std::size_t>(entry.second.length);
 
-        char* bytes = cache.get();
+    /* Allocate cache blob including header */
+    DynamicByteArray cache{ cacheSize, UninitializeTag{} };
 
-        auto WriteBytes = [&bytes](const void* src, std::size_t len) -> void
-        {
-            ::memcpy(bytes, src, len);
-            bytes += len;
-        };
+    char* bytes = cache.get();
 
-        WriteBytes(&header, sizeof(header));
+    auto WriteBytes = [&bytes](const void* src, std::size_t len) -> void
+    {
+        ::memcpy(bytes, src, len);
+        bytes += len;
+    };
 
-        for (const CacheEntry& entry : entries_)
-        {
-            if (!entry.data.empty())
-            {
-                GLPipelineCacheEntry headerEntry;
-                headerEntry.binaryFormat = entry.format;
-                headerEntry.binaryLength = entry.length;
-                WriteBytes(&headerEntry, sizeof(headerEntry));
-                WriteBytes(entry.data.get(), entry.length);
-            }
-        }
+    GLPipelineCacheHeader header;
+    header.magic        = g_pipelineCacheMagic;
+    header.version      = g_pipelineCacheVersion;
+    header.numEntries   = static_cast<std::uint32_t>(entries_.size());
+    WriteBytes(&header, sizeof(header));
 
-        return Blob::CreateStrongRef(std::move(cache));
+    for (const auto& entry : entries_)
+    {
+        GLPipelineCacheEntry headerEntry;
+        headerEntry.key             = entry.first;
+        headerEntry.binaryFormat    = entry.second.format;
+        headerEntry.binaryLength    = entry.second.length;
+        WriteBytes(&headerEntry, sizeof(headerEntry));
+        WriteBytes(entry.second.data.get(), static_cast<std::size_t>(entry.second.length));
     }
 
-    return Blob{};
+    return Blob::CreateStrongRef(std::move(cache));
 }
 
-bool GLPipelineCache::ProgramBinary(GLShader::Permutation permutation, GLuint program)
+bool GLPipelineCache::HasProgramBinary(std::uint64_t key) const
+{
+    return (entries_.find(key) != entries_.end());
+}
+
+bool GLPipelineCache::ProgramBinary(std::uint64_t key, GLuint program)
 {
     /* No need to check for extension support at runtime here, this is checked before GLPipelineCache is created */
     #ifdef GL_ARB_get_program_binary
 
-    if (!HasProgramBinary(permutation))
+    auto it = entries_.find(key);
+    if (it == entries_.end())
         return false;
 
     /* Load program binary into GL object */
-    const CacheEntry& entry = entries_[permutation];
+    const CacheEntry& entry = it->second;
     glProgramBinary(program, entry.format, entry.data.get(), entry.length);
 
-    /* Check link status */
+    /* Check link status; Drivers reject binaries from a different driver version */
     GLint status = 0;
     glGetProgramiv(program, GL_LINK_STATUS, &status);
 
-    return (status != GL_FALSE);
+    if (status == GL_FALSE)
+    {
+        /* Drop outdated entry, so it will be replaced by the re-linked program */
+        entries_.erase(it);
+        return false;
+    }
+
+    return true;
 
     #else // GL_ARB_get_program_binary
 
@@ -120,35 +128,35 @@ bool GLPipelineCache::ProgramBinary(GLShader::Permutation permutation, GLuint pr
     #endif // /GL_ARB_get_program_binary
 }
 
-bool GLPipelineCache::GetProgramBinary(GLShader::Permutation permutation, GLuint program)
+bool GLPipelineCache::GetProgramBinary(std::uint64_t key, GLuint program)
 {
     /* No need to check for extension support at runtime here, this is checked before GLPipelineCache is created */
     #ifdef GL_ARB_get_program_binary
 
-    CacheEntry& entry = entries_[permutation];
-
     /* Get program binary length */
     GLint binaryLength = 0;
     glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
-    if (binaryLength > 0)
-        entry.length = static_cast<GLsizei>(binaryLength);
-    else
+    if (binaryLength <= 0)
         return false;
 
     /* Get program binary format and data */
+    CacheEntry entry;
+    entry.length = static_cast<GLsizei>(binaryLength);
     entry.data.resize(static_cast<std::size_t>(binaryLength), UninitializeTag{});
 
-    GLsizei writtenLegnth = 0;
+    GLsizei writtenLength = 0;
     glGetProgramBinary(
         program,
         entry.length,
-        &writtenLegnth,
+        &writtenLength,
         &(entry.format),
         entry.data.get()
     );
-    if (writtenLegnth != entry.length)
+    if (writtenLength != entry.length)
         return false;
 
+    entries_[key] = std::move(entry);
+
     return true;
 
     #else // GL_ARB_get_program_binary
@@ -158,20 +166,94 @@ bool GLPipelineCache::GetProgramBinary(GLShader::Permutation permutation, GLuint
     #endif // /GL_ARB_get_program_binary
 }
 
+void GLPipelineCache::HintProgramBinaryRetrievable(GLuint program)
+{
+    #ifdef GL_ARB_get_program_binary
+    glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    #endif
+}
+
+static std::uint64_t HashPermutation(GLShader::Permutation permutation, std::uint64_t hash)
+{
+    const std::uint32_t permutationIndex = static_cast<std::uint32_t>(permutation);
+    return GLPipelineCache::HashBytes(&permutationIndex, sizeof(permutationIndex), hash);
+}
+
+std::uint64_t GLPipelineCache::GetProgramKey(std::size_t numShaders, const Shader* const* shaders, GLShader::Permutation permutation)
+{
+    std::uint64_t key = HashPermutation(permutation, GLPipelineCache::HashBytes("GLShaderProgram", 15));
+    for_range(i, numShaders)
+    {
+        if (const Shader* shader = shaders[i])
+        {
+            const std::uint64_t shaderHash = LLGL_CAST(const GLShader*, shader)->GetHash(permutation);
+            key = GLPipelineCache::HashBytes(&shaderHash, sizeof(shaderHash), key);
+        }
+    }
+    return key;
+}
+
+std::uint64_t GLPipelineCache::GetSeparableProgramKey(const GLShader& shader, GLShader::Permutation permutation)
+{
+    std::uint64_t key = HashPermutation(permutation, GLPipelineCache::HashBytes("GLSeparableShader", 17));
+    const std::uint64_t shaderHash = shader.GetHash(permutation);
+    return GLPipelineCache::HashBytes(&shaderHash, sizeof(shaderHash), key);
+}
+
+std::uint64_t GLPipelineCache::HashBytes(const void* data, std::size_t size, std::uint64_t hash)
+{
+    const std::uint8_t* bytes = static_cast<const std::uint8_t*>(data);
+    for_range(i, size)
+    {
+        hash ^= bytes[i];
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
 
 /*
  * ======= Private: =======
  */
 
-void GLPipelineCache::InitializeEntry(GLShader::Permutation permutation, const void* data)
+bool GLPipelineCache::ReadEntries(const char* bytes, std::size_t size)
 {
-    const GLPipelineCacheEntry* srcEntry    = reinterpret_cast<const GLPipelineCacheEntry*>(data);
-    const char*                 bytes       = reinterpret_cast<const char*>(srcEntry + 1);
+    /* Validate header; Blobs from an older cache format are ignored */
+    if (size < sizeof(GLPipelineCacheHeader))
+        return false;
+
+    GLPipelineCacheHeader header;
+    ::memcpy(&header, bytes, sizeof(header));
+    if (header.magic != g_pipelineCacheMagic || header.version != g_pipelineCacheVersion)
+        return false;
+
+    bytes += sizeof(header);
+    size -= sizeof(header);
+
+    for_range(i, header.numEntries)
+    {
+        if (size < sizeof(GLPipelineCacheEntry))
+            return false;
+
+        GLPipelineCacheEntry srcEntry;
+        ::memcpy(&srcEntry, bytes, sizeof(srcEntry));
+        bytes += sizeof(srcEntry);
+        size -= sizeof(srcEntry);
+
+        const std::size_t binaryLength = static_cast<std::size_t>(srcEntry.binaryLength);
+        if (srcEntry.binaryLength <= 0 || size < binaryLength)
+            return false;
+
+        CacheEntry& dstEntry = entries_[srcEntry.key];
+        dstEntry.format = srcEntry.binaryFormat;
+        dstEntry.length = srcEntry.binaryLength;
+        dstEntry.data   = DynamicByteArray{ bytes, bytes + binaryLength };
 
-    CacheEntry& dstEntry = entries_[permutation];
-    dstEntry.format = srcEntry->binaryFormat;
-    dstEntry.length = srcEntry->binaryLength;
-    dstEntry.data   = DynamicByteArray{ bytes, bytes + srcEntry->binaryLength };
+        bytes += binaryLength;
+        size -= binaryLength;
+    }
+
+    return true;
 }
 
 
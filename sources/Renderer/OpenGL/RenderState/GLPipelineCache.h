@@ -13,12 +13,19 @@
 #include "../Shader/GLShader.h"
 #include <LLGL/PipelineCache.h>
 #include <LLGL/Container/DynamicArray.h>
+#include <map>
+#include <cstdint>
 
 
 namespace LLGL
 {
 
 
+/*
+Pipeline cache for GL program binaries.
+Each entry is keyed by a hash of the patched shader sources, their vertex/fragment layouts, and the shader permutation,
+so a single cache can be shared among multiple PSOs and persisted across application runs.
+*/
 class GLPipelineCache final : public PipelineCache
 {
 
@@ -32,17 +39,28 @@ class GLPipelineCache final : public PipelineCache
 
     public:
 
-        // Returns true if this pipeline cache has a GL program binary blob.
-        inline bool HasProgramBinary(GLShader::Permutation permutation) const
-        {
-            return !(entries_[permutation].data.empty());
-        }
+        // Returns true if this pipeline cache has a GL program binary blob for the specified key.
+        bool HasProgramBinary(std::uint64_t key) const;
+
+        // Loads the cache entry with the specified key into the GL program. Returns false if there is no such entry or the binary was rejected.
+        bool ProgramBinary(std::uint64_t key, GLuint program);
+
+        // Retrieves the program binary from the specified GL program and stores it in the cache entry with the specified key.
+        bool GetProgramBinary(std::uint64_t key, GLuint program);
+
+    public:
+
+        // Hints the GL driver that the binary of the specified program will be retrieved. Must be called before the program is linked.
+        static void HintProgramBinaryRetrievable(GLuint program);
+
+        // Returns the cache key for a GL shader program that is linked from the specified shaders.
+        static std::uint64_t GetProgramKey(std::size_t numShaders, const Shader* const* shaders, GLShader::Permutation permutation);
 
-        // Loads the pipeline cache into the specified GL shader program.
-        bool ProgramBinary(GLShader::Permutation permutation, GLuint program);
+        // Returns the cache key for the separable GL program of the specified shader.
+        static std::uint64_t GetSeparableProgramKey(const GLShader& shader, GLShader::Permutation permutation);
 
-        // Retrieves the pipeline cache from the specified GL shader program.
-        bool GetProgramBinary(GLShader::Permutation permutation, GLuint program);
+        // Returns the 64-bit FNV-1a hash of the specified data, continued from the previous hash value.
+        static std::uint64_t HashBytes(const void* data, std::size_t size, std::uint64_t hash = 0xCBF29CE484222325ull);
 
     private:
 
@@ -55,11 +73,12 @@ class GLPipelineCache final : public PipelineCache
 
     private:
 
-        void InitializeEntry(GLShader::Permutation permutation, const void* data);
+        // Reads all cache entries from the specified blob. Returns false if the blob is malformed.
+        bool ReadEntries(const char* bytes, std::size_t size);
 
     private:
 
-        CacheEntry entries_[GLShader::PermutationCount];
+        std::map<std::uint64_t, CacheEntry> entries_;
 
 };
 
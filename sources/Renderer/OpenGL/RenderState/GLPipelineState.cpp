@@ -25,29 +25,20 @@ GLPipelineState::GLPipelineState(
     bool                        isGraphicsPSO,
     const PipelineLayout*       pipelineLayout,
     PipelineCache*              pipelineCache,
-    const ArrayView<Shader*>&   shaders)
+    const ArrayView<Shader*>&   shaders,
+    bool                        asyncCompilation)
 :
     isGraphicsPSO_ { isGraphicsPSO }
 {
     /* Get GL pipeline cache if specified */
     GLPipelineCache* pipelineCacheGL = (pipelineCache != nullptr ? LLGL_CAST(GLPipelineCache*, pipelineCache) : nullptr);
 
+    /* Create shader pipelines for all permutations; Their link status is queried in FinishLinking() */
     for_range(permutationIndex, GLShader::PermutationCount)
     {
         const GLShader::Permutation permutation = static_cast<GLShader::Permutation>(permutationIndex);
         if (GLShader::HasAnyShaderPermutation(permutation, shaders))
-        {
-            /* Create shader pipeline for current permutation */
             shaderPipelines_[permutation] = GLStatePool::Get().CreateShaderPipeline(shaders.size(), shaders.data(), permutation, pipelineCacheGL);
-
-            /* Query information log and stop linking shader pipelines if the default permutation has errors */
-            if (permutation == GLShader::PermutationDefault)
-            {
-                shaderPipelines_[GLShader::PermutationDefault]->QueryInfoLogs(report_);
-                if (report_.HasErrors())
-                    break;
-            }
-        }
     }
 
     /* Create shader binding layout by binding descriptor */
@@ -61,14 +52,12 @@ GLPipelineState::GLPipelineState(
             if (!shaderBindingLayout_->HasBindings())
                 GLStatePool::Get().ReleaseShaderBindingLayout(std::move(shaderBindingLayout_));
         }
-
-        /* Build uniform table */
-        for_range(permutationIndex, GLShader::PermutationCount)
-        {
-            const GLShader::Permutation permutation = static_cast<GLShader::Permutation>(permutationIndex);
-            BuildUniformMap(permutation, pipelineLayout_->GetUniforms());
-        }
     }
+
+    /* Finish linking immediately unless the driver can link the shader pipelines in the background */
+    isLinkPending_ = true;
+    if (!(asyncCompilation && GLShader::HasParallelShaderCompile()))
+        FinishLinking();
 }
 
 GLPipelineState::~GLPipelineState()
@@ -80,11 +69,28 @@ GLPipelineState::~GLPipelineState()
 
 const Report* GLPipelineState::GetReport() const
 {
+    WaitForLinking();
     return (report_ ? &report_ : nullptr);
 }
 
+bool GLPipelineState::IsReady() const
+{
+    if (isLinkPending_)
+    {
+        for (const GLShaderPipelineSPtr& shaderPipeline : shaderPipelines_)
+        {
+            if (shaderPipeline && !shaderPipeline->IsLinkCompleted())
+                return false;
+        }
+    }
+    return true;
+}
+
 void GLPipelineState::Bind(GLStateManager& stateMngr)
 {
+    /* Wait for shader pipelines that are still linked in the background */
+    WaitForLinking();
+
     /* Select shader pipeline permutation depending on what is needed for the current framebuffer */
     const GLShader::Permutation shaderPipelinePermutation =
     (
@@ -112,6 +118,47 @@ void GLPipelineState::Bind(GLStateManager& stateMngr)
  * ======= Private: =======
  */
 
+void GLPipelineState::FinishLinking()
+{
+    isLinkPending_ = false;
+
+    /* Query information logs; Permutations other than the default one are only reported if they have errors */
+    std::string log;
+    bool hasErrors = false;
+
+    for_range(permutationIndex, GLShader::PermutationCount)
+    {
+        if (GLShaderPipeline* shaderPipeline = shaderPipelines_[permutationIndex].get())
+        {
+            Report shaderPipelineReport;
+            shaderPipeline->QueryInfoLogs(shaderPipelineReport);
+            if (permutationIndex == GLShader::PermutationDefault || shaderPipelineReport.HasErrors())
+            {
+                log += shaderPipelineReport.GetText();
+                hasErrors = (hasErrors || shaderPipelineReport.HasErrors());
+            }
+        }
+    }
+
+    /* Keep messages that were reported before linking has finished */
+    if (report_)
+    {
+        log += report_.GetText();
+        hasErrors = (hasErrors || report_.HasErrors());
+    }
+    report_.Reset(std::move(log), hasErrors);
+
+    /* Build uniform table */
+    if (pipelineLayout_ != nullptr)
+    {
+        for_range(permutationIndex, GLShader::PermutationCount)
+        {
+            const GLShader::Permutation permutation = static_cast<GLShader::Permutation>(permutationIndex);
+            BuildUniformMap(permutation, pipelineLayout_->GetUniforms());
+        }
+    }
+}
+
 //TODO: support separate shaders; each separable shader needs its own set of uniform locations
 void GLPipelineState::BuildUniformMap(GLShader::Permutation permutation, const std::vector<UniformDescriptor>& uniforms)
 {
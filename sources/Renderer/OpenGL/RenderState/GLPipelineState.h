@@ -48,11 +48,13 @@ class GLPipelineState : public PipelineState
             bool                        isGraphicsPSO,
             const PipelineLayout*       pipelineLayout,
             PipelineCache*              pipelineCache,
-            const ArrayView<Shader*>&   shaders
+            const ArrayView<Shader*>&   shaders,
+            bool                        asyncCompilation    = false
         );
         ~GLPipelineState();
 
         const Report* GetReport() const override;
+        bool IsReady() const override;
 
         // Binds this pipeline state with the specified GL state manager.
         virtual void Bind(GLStateManager& stateMngr);
@@ -78,6 +80,7 @@ class GLPipelineState : public PipelineState
         // Returns the list of uniforms that maps from index of 'PipelineLayoutDescriptor::uniforms[]' to GL uniform location.
         inline const std::vector<GLUniformLocation>& GetUniformMap() const
         {
+            WaitForLinking();
             return uniformMap_;
         }
 
@@ -89,8 +92,18 @@ class GLPipelineState : public PipelineState
             return report_;
         }
 
+        // Waits until the shader pipelines have been linked in the background and finishes their initialization.
+        inline void WaitForLinking() const
+        {
+            if (isLinkPending_)
+                const_cast<GLPipelineState*>(this)->FinishLinking();
+        }
+
     private:
 
+        // Queries the info logs of all shader pipelines and builds the uniform map. This blocks until the shader pipelines have been linked.
+        void FinishLinking();
+
         // Builds the index-to-uniform map.
         void BuildUniformMap(GLShader::Permutation permutation, const std::vector<UniformDescriptor>& uniforms);
 
@@ -105,6 +118,7 @@ class GLPipelineState : public PipelineState
         GLShaderBindingLayoutSPtr       shaderBindingLayout_;
         std::vector<GLUniformLocation>  uniformMap_;
         Report                          report_;
+        bool                            isLinkPending_                                  = false;
 
 };
 
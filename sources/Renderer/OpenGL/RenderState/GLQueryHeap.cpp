@@ -6,12 +6,14 @@
  */
 
 #include "GLQueryHeap.h"
+#include "../Buffer/GLBuffer.h"
 #include "../GLObjectUtils.h"
 #include "../Ext/GLExtensions.h"
 #include "../Ext/GLExtensionRegistry.h"
 #include "../GLTypes.h"
 #include "../../../Core/Assertion.h"
 #include <LLGL/Utils/ForRange.h>
+#include <LLGL/Container/SmallVector.h>
 
 
 namespace LLGL
@@ -48,6 +50,7 @@ static GLenum MapQueryType(const QueryType queryType, std::size_t idx)
         case QueryType::AnySamplesPassedConservative:       return GL_ANY_SAMPLES_PASSED_CONSERVATIVE;
         #ifdef LLGL_OPENGL
         case QueryType::TimeElapsed:                        return GL_TIME_ELAPSED;
+        case QueryType::Timestamp:                          return GL_TIMESTAMP;
         #endif
         case QueryType::StreamOutPrimitivesWritten:         return GL_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN;
         #ifdef GL_ARB_transform_feedback_overflow_query
@@ -108,18 +111,75 @@ void GLQueryHeap::SetDebugName(const char* name)
 
 void GLQueryHeap::Begin(std::uint32_t query)
 {
+    /* Timestamps are only written at the end of a query */
+    if (GetType() == QueryType::Timestamp)
+        return;
+
     /* Begin all queries in forward order: [0, n) */
     for_range(i, groupSize_)
         glBeginQuery(MapQueryType(GetType(), i), ids_[i + groupSize_ * query]);
 }
 
-void GLQueryHeap::End()
+void GLQueryHeap::End(std::uint32_t query)
 {
+    #if defined LLGL_OPENGL && defined GL_ARB_timer_query
+    if (GetType() == QueryType::Timestamp)
+    {
+        /* Record timestamp once all previous commands have been completed */
+        glQueryCounter(ids_[query], GL_TIMESTAMP);
+        return;
+    }
+    #endif // /GL_ARB_timer_query
+
     /* End all queries in reverse order: (n, 0] */
     for_range_reverse(i, groupSize_)
         glEndQuery(MapQueryType(GetType(), i));
 }
 
+void GLQueryHeap::ResolveResults(std::uint32_t firstQuery, std::uint32_t numQueries, GLBuffer& dstBuffer, GLintptr dstOffset)
+{
+    /* Pipeline statistics have one native query per member of QueryPipelineStatistics, so flatten the ranges of native queries */
+    const std::uint32_t firstID = firstQuery * groupSize_;
+    const std::uint32_t numIDs  = numQueries * groupSize_;
+
+    #ifdef GL_ARB_direct_state_access
+    if (HasExtension(GLExt::ARB_direct_state_access))
+    {
+        /* Write query results directly into the buffer object without CPU round-trip */
+        for_range(i, numIDs)
+        {
+            const GLintptr offset = dstOffset + static_cast<GLintptr>(i * sizeof(GLuint64));
+            glGetQueryBufferObjectui64v(ids_[firstID + i], dstBuffer.GetID(), GL_QUERY_RESULT, offset);
+        }
+    }
+    else
+    #endif // /GL_ARB_direct_state_access
+    {
+        /* Read query results back to CPU and upload them into the buffer object */
+        SmallVector<std::uint64_t> results;
+        results.resize(numIDs);
+
+        #ifdef GL_ARB_timer_query
+        if (HasExtension(GLExt::ARB_timer_query))
+        {
+            for_range(i, numIDs)
+                glGetQueryObjectui64v(ids_[firstID + i], GL_QUERY_RESULT, &results[i]);
+        }
+        else
+        #endif // /GL_ARB_timer_query
+        {
+            for_range(i, numIDs)
+            {
+                GLuint result32 = 0;
+                glGetQueryObjectuiv(ids_[firstID + i], GL_QUERY_RESULT, &result32);
+                results[i] = result32;
+            }
+        }
+
+        dstBuffer.BufferSubData(dstOffset, static_cast<GLsizeiptr>(results.size() * sizeof(std::uint64_t)), results.data());
+    }
+}
+
 
 } // /namespace LLGL
 
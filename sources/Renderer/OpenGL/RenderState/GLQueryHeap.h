@@ -18,6 +18,8 @@ namespace LLGL
 {
 
 
+class GLBuffer;
+
 class GLQueryHeap final : public QueryHeap
 {
 
@@ -31,7 +33,10 @@ class GLQueryHeap final : public QueryHeap
         ~GLQueryHeap();
 
         void Begin(std::uint32_t query);
-        void End();
+        void End(std::uint32_t query);
+
+        // Writes the results of the specified queries into the buffer. Each native query result is written as 64-bit unsigned integer.
+        void ResolveResults(std::uint32_t firstQuery, std::uint32_t numQueries, GLBuffer& dstBuffer, GLintptr dstOffset);
 
         // Returns the the specified query ID.
         inline GLuint GetID(std::uint32_t query) const
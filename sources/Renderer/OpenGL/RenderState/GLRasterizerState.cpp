@@ -12,6 +12,7 @@
 #include "../GLTypes.h"
 #include "../../../Core/MacroUtils.h"
 #include "GLStateManager.h"
+#include "GLPipelineCache.h"
 #include <LLGL/PipelineStateFlags.h>
 
 
@@ -64,6 +65,8 @@ GLRasterizerState::GLRasterizerState(const RasterizerDescriptor& desc)
     #ifdef LLGL_GL_ENABLE_VENDOR_EXT
     conservativeRaster_     = desc.conservativeRasterization;
     #endif
+
+    UpdateHash();
 }
 
 void GLRasterizerState::Bind(GLStateManager& stateMngr)
@@ -109,6 +112,8 @@ void GLRasterizerState::BindFrontFaceOnly(GLStateManager& stateMngr)
 
 int GLRasterizerState::CompareSWO(const GLRasterizerState& lhs, const GLRasterizerState& rhs)
 {
+    LLGL_COMPARE_MEMBER_SWO     ( hash_                 );
+
     #ifdef LLGL_OPENGL
     LLGL_COMPARE_MEMBER_SWO     ( polygonMode_          );
     LLGL_COMPARE_BOOL_MEMBER_SWO( depthClampEnabled_    );
@@ -116,6 +121,7 @@ int GLRasterizerState::CompareSWO(const GLRasterizerState& lhs, const GLRasteriz
 
     LLGL_COMPARE_MEMBER_SWO     ( cullFace_             );
     LLGL_COMPARE_MEMBER_SWO     ( frontFace_            );
+    LLGL_COMPARE_BOOL_MEMBER_SWO( rasterizerDiscard_    );
     LLGL_COMPARE_BOOL_MEMBER_SWO( scissorTestEnabled_   );
     LLGL_COMPARE_BOOL_MEMBER_SWO( multiSampleEnabled_   );
     LLGL_COMPARE_BOOL_MEMBER_SWO( lineSmoothEnabled_    );
@@ -134,6 +140,43 @@ int GLRasterizerState::CompareSWO(const GLRasterizerState& lhs, const GLRasteriz
 }
 
 
+/*
+ * ======= Private: =======
+ */
+
+void GLRasterizerState::UpdateHash()
+{
+    /* Hash members individually, since this class has padding bytes between its boolean members */
+    std::uint64_t hash = GLPipelineCache::HashBytes(&cullFace_, sizeof(cullFace_));
+
+    auto HashMember = [&hash](const void* data, std::size_t size)
+    {
+        hash = GLPipelineCache::HashBytes(data, size, hash);
+    };
+
+    #ifdef LLGL_OPENGL
+    HashMember(&polygonMode_,           sizeof(polygonMode_)            );
+    HashMember(&depthClampEnabled_,     sizeof(depthClampEnabled_)      );
+    #endif
+    HashMember(&frontFace_,             sizeof(frontFace_)              );
+    HashMember(&rasterizerDiscard_,     sizeof(rasterizerDiscard_)      );
+    HashMember(&scissorTestEnabled_,    sizeof(scissorTestEnabled_)     );
+    HashMember(&multiSampleEnabled_,    sizeof(multiSampleEnabled_)     );
+    HashMember(&lineSmoothEnabled_,     sizeof(lineSmoothEnabled_)      );
+    HashMember(&lineWidth_,             sizeof(lineWidth_)              );
+    HashMember(&polygonOffsetEnabled_,  sizeof(polygonOffsetEnabled_)   );
+    HashMember(&polygonOffsetMode_,     sizeof(polygonOffsetMode_)      );
+    HashMember(&polygonOffsetFactor_,   sizeof(polygonOffsetFactor_)    );
+    HashMember(&polygonOffsetUnits_,    sizeof(polygonOffsetUnits_)     );
+    HashMember(&polygonOffsetClamp_,    sizeof(polygonOffsetClamp_)     );
+    #ifdef LLGL_GL_ENABLE_VENDOR_EXT
+    HashMember(&conservativeRaster_,    sizeof(conservativeRaster_)     );
+    #endif
+
+    hash_ = hash;
+}
+
+
 } // /namespace LLGL
 
 
@@ -14,6 +14,7 @@
 #include "GLState.h"
 #include <memory>
 #include <limits>
+#include <cstdint>
 
 
 namespace LLGL
@@ -42,11 +43,21 @@ class GLRasterizerState
         // Binds the front facing only.
         void BindFrontFaceOnly(GLStateManager& stateMngr);
 
+        // Returns the hash of all states that are considered by CompareSWO.
+        inline std::uint64_t GetHash() const
+        {
+            return hash_;
+        }
+
     public:
 
-        // Returns a signed integer of the strict-weak-order (SWO) comparison, and 0 on equality.
+        // Returns a signed integer of the strict-weak-order (SWO) comparison, and 0 on equality. The hash is compared first to keep most comparisons short.
         static int CompareSWO(const GLRasterizerState& lhs, const GLRasterizerState& rhs);
 
+    private:
+
+        void UpdateHash();
+
     private:
 
         #ifdef LLGL_OPENGL
@@ -71,6 +82,8 @@ class GLRasterizerState
         bool        conservativeRaster_     = false;    // glEnable(GL_CONSERVATIVE_RASTERIZATION_NV/INTEL)
         #endif
 
+        std::uint64_t hash_                 = 0;
+
 };
 
 
@@ -8,6 +8,7 @@
 #include "GLRenderPass.h"
 #include "../../RenderPassUtils.h"
 #include <LLGL/CommandBufferFlags.h>
+#include <LLGL/Utils/ForRange.h>
 
 
 namespace LLGL
@@ -28,6 +29,29 @@ GLRenderPass::GLRenderPass(const RenderPassDescriptor& desc)
     /* Check if stencil attachment must be cleared */
     if (desc.stencilAttachment.loadOp == AttachmentLoadOp::Clear)
         clearMask_ |= GL_STENCIL_BUFFER_BIT;
+
+    /* Check which attachments can be invalidated to avoid restoring and storing tile memory */
+    for_range(i, NumEnabledColorAttachments(desc))
+        AccumInvalidateMasks(desc.colorAttachments[i], (1u << i));
+
+    if (desc.depthAttachment.format != Format::Undefined)
+        AccumInvalidateMasks(desc.depthAttachment, GLRenderPass::invalidateDepthBit);
+
+    if (desc.stencilAttachment.format != Format::Undefined)
+        AccumInvalidateMasks(desc.stencilAttachment, GLRenderPass::invalidateStencilBit);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void GLRenderPass::AccumInvalidateMasks(const AttachmentFormatDescriptor& attachmentDesc, std::uint32_t attachmentBit)
+{
+    if (attachmentDesc.loadOp == AttachmentLoadOp::Undefined)
+        invalidateOnBeginMask_ |= attachmentBit;
+    if (attachmentDesc.storeOp == AttachmentStoreOp::Undefined)
+        invalidateOnEndMask_ |= attachmentBit;
 }
 
 
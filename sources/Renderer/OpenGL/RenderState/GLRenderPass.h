@@ -22,6 +22,12 @@ namespace LLGL
 class GLRenderPass final : public RenderPass
 {
 
+    public:
+
+        // Bits for the depth and stencil attachments in the invalidation masks; the lower bits refer to the color attachments.
+        static constexpr std::uint32_t invalidateDepthBit   = (1u << LLGL_MAX_NUM_COLOR_ATTACHMENTS);
+        static constexpr std::uint32_t invalidateStencilBit = (1u << (LLGL_MAX_NUM_COLOR_ATTACHMENTS + 1));
+
     public:
 
         GLRenderPass(const RenderPassDescriptor& desc);
@@ -44,9 +50,27 @@ class GLRenderPass final : public RenderPass
             return clearColorAttachments_;
         }
 
+        // Returns the bitmask of attachments whose previous content is undefined when a render pass begins (see AttachmentLoadOp::Undefined).
+        inline std::uint32_t GetInvalidateOnBeginMask() const
+        {
+            return invalidateOnBeginMask_;
+        }
+
+        // Returns the bitmask of attachments whose outcome is discarded when a render pass ends (see AttachmentStoreOp::Undefined).
+        inline std::uint32_t GetInvalidateOnEndMask() const
+        {
+            return invalidateOnEndMask_;
+        }
+
+    private:
+
+        void AccumInvalidateMasks(const AttachmentFormatDescriptor& attachmentDesc, std::uint32_t attachmentBit);
+
     private:
 
         GLbitfield      clearMask_                                              = 0;
+        std::uint32_t   invalidateOnBeginMask_                                  = 0;
+        std::uint32_t   invalidateOnEndMask_                                    = 0;
         std::uint8_t    clearColorAttachments_[LLGL_MAX_NUM_COLOR_ATTACHMENTS]  = {};
         std::uint8_t    numColorAttachments_                                    = 0;
 
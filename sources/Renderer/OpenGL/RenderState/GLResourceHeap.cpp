@@ -68,15 +68,16 @@ Offset      Attribute                              Value   Description
 // Resource segment flags. Bits can be shared as they are only used for certain segment types.
 enum GLResourceFlags : std::uint32_t
 {
-    GLResourceFlags_HasBufferRange  = (1 << 0),
-    GLResourceFlags_HasTextureViews = (1 << 0),
+    GLResourceFlags_HasBufferRange          = (1 << 0),
+    GLResourceFlags_HasTextureViews         = (1 << 0),
+    GLResourceFlags_HasPendingTextureViews  = (1 << 1), // Texture views that might not have been initialized yet (see GLTextureViewPool::InitializeTextureView).
 };
 
 // Resource view heap (RVH) segment structure with up to three dynamic sub-buffers.
 struct GLResourceHeapSegment
 {
-    std::uint32_t   size        : 28; // Byte size of this segment
-    std::uint32_t   flags       :  1; // GLResourceFlags
+    std::uint32_t   size        : 27; // Byte size of this segment
+    std::uint32_t   flags       :  2; // GLResourceFlags
     GLResourceType  type        :  3;
     GLuint          first       : 16;
     GLsizei         count       : 16;
@@ -148,11 +149,11 @@ GLResourceHeap::GLResourceHeap(
     /* Allocate templates for all resource view segments */
     BindingDescriptorIterator bindingIter{ bindings };
 
-    AllocSegmentsUBO(bindingIter);
-    AllocSegmentsSSBO(bindingIter);
-    AllocSegmentsTexture(bindingIter);
-    AllocSegmentsImage(bindingIter);
-    AllocSegmentsSampler(bindingIter);
+    AllocSegmentsUBO(bindingIter, *pipelineLayoutGL);
+    AllocSegmentsSSBO(bindingIter, *pipelineLayoutGL);
+    AllocSegmentsTexture(bindingIter, *pipelineLayoutGL);
+    AllocSegmentsImage(bindingIter, *pipelineLayoutGL);
+    AllocSegmentsSampler(bindingIter, *pipelineLayoutGL);
     #ifdef LLGL_GL_ENABLE_OPENGL2X
     AllocSegmentsGL2XSampler(bindingIter);
     #endif
@@ -269,6 +270,22 @@ static std::size_t BindBuffersSegment(GLStateManager& stateMngr, const char* hea
     return segment->size;
 }
 
+// Initializes all texture views of the segment at the specified heap position that have been written since the segment was bound the last time.
+static void InitializeSegmentTextureViews(char* heapPtr)
+{
+    auto segment = GLRESOURCEHEAP_SEGMENT(heapPtr);
+    if ((segment->flags & GLResourceFlags_HasPendingTextureViews) != 0)
+    {
+        for_range(i, segment->count)
+        {
+            GLuint texViewID = GLRESOURCEHEAP_DATA2(heapPtr, const GLuint)[i];
+            if (texViewID != 0)
+                GLTextureViewPool::Get().InitializeTextureView(texViewID);
+        }
+        segment->flags &= (~GLResourceFlags_HasPendingTextureViews);
+    }
+}
+
 static std::size_t BindTexturesSegment(GLStateManager& stateMngr, const char* heapPtr)
 {
     auto segment = GLRESOURCEHEAP_CONST_SEGMENT(heapPtr);
@@ -341,14 +358,6 @@ void GLResourceHeap::Bind(GLStateManager& stateMngr, std::uint32_t descriptorSet
 
     auto heapPtr = heap_.SegmentData(descriptorSet);
 
-    #ifdef GL_ARB_shader_image_load_store
-
-    /* Submit memory barriers for UAVs */
-    if (barriers_ != 0)
-        glMemoryBarrier(barriers_);
-
-    #endif // /GL_ARB_shader_image_load_store
-
     /* Bind all constant buffers */
     for_range(i, segmentation_.numUniformBufferSegments)
         heapPtr += BindBuffersSegment(stateMngr, heapPtr, GLBufferTarget::UniformBuffer);
@@ -369,11 +378,17 @@ void GLResourceHeap::Bind(GLStateManager& stateMngr, std::uint32_t descriptorSet
     {
         /* Bind all textures */
         for_range(i, segmentation_.numTextureSegments)
+        {
+            InitializeSegmentTextureViews(heapPtr);
             heapPtr += BindTexturesSegment(stateMngr, heapPtr);
+        }
 
         /* Bind all image texture units */
         for_range(i, segmentation_.numImageTextureSegments)
+        {
+            InitializeSegmentTextureViews(heapPtr);
             heapPtr += BindImageTexturesSegment(stateMngr, heapPtr);
+        }
 
         /* Bind all samplers */
         for_range(i, segmentation_.numSamplerSegments)
@@ -449,7 +464,7 @@ void GLResourceHeap::FreeAllSegmentsTextureViews()
         FreeAllSegmentSetTextureViews(heapPtr);
 }
 
-void GLResourceHeap::AllocSegmentsUBO(BindingDescriptorIterator& bindingIter)
+void GLResourceHeap::AllocSegmentsUBO(BindingDescriptorIterator& bindingIter, const GLPipelineLayout& pipelineLayout)
 {
     /* Collect all uniform buffers */
     auto bindingSlots = FilterAndSortGLBindingSlots(bindingIter, ResourceType::Buffer, BindFlags::ConstantBuffer);
@@ -457,11 +472,12 @@ void GLResourceHeap::AllocSegmentsUBO(BindingDescriptorIterator& bindingIter)
     /* Build all resource segments for type <GLResourceHeap3PartSegment> */
     segmentation_.numUniformBufferSegments = GLResourceHeap::ConsolidateSegments(
         bindingSlots,
-        BIND_SEGMENT_ALLOCATOR(GLResourceHeap::Alloc3PartSegment, GLResourceType_UBO, sizeof(GLuint), sizeof(GLintptr), sizeof(GLsizeiptr))
+        BIND_SEGMENT_ALLOCATOR(GLResourceHeap::Alloc3PartSegment, GLResourceType_UBO, sizeof(GLuint), sizeof(GLintptr), sizeof(GLsizeiptr)),
+        GetBridgeSlotsFunc(pipelineLayout, GLResourceType_UBO)
     );
 }
 
-void GLResourceHeap::AllocSegmentsSSBO(BindingDescriptorIterator& bindingIter)
+void GLResourceHeap::AllocSegmentsSSBO(BindingDescriptorIterator& bindingIter, const GLPipelineLayout& pipelineLayout)
 {
     /* Collect all shader storage buffers */
     auto bindingSlots = FilterAndSortGLBindingSlots(bindingIter, ResourceType::Buffer, (BindFlags::Sampled | BindFlags::Storage));
@@ -469,11 +485,12 @@ void GLResourceHeap::AllocSegmentsSSBO(BindingDescriptorIterator& bindingIter)
     /* Build all resource segments for type <GLResourceHeap3PartSegment> */
     segmentation_.numStorageBufferSegments = GLResourceHeap::ConsolidateSegments(
         bindingSlots,
-        BIND_SEGMENT_ALLOCATOR(GLResourceHeap::Alloc3PartSegment, GLResourceType_SSBO, sizeof(GLuint), sizeof(GLintptr), sizeof(GLsizeiptr))
+        BIND_SEGMENT_ALLOCATOR(GLResourceHeap::Alloc3PartSegment, GLResourceType_SSBO, sizeof(GLuint), sizeof(GLintptr), sizeof(GLsizeiptr)),
+        GetBridgeSlotsFunc(pipelineLayout, GLResourceType_SSBO)
     );
 }
 
-void GLResourceHeap::AllocSegmentsTexture(BindingDescriptorIterator& bindingIter)
+void GLResourceHeap::AllocSegmentsTexture(BindingDescriptorIterator& bindingIter, const GLPipelineLayout& pipelineLayout)
 {
     #ifdef LLGL_GL_ENABLE_OPENGL2X
     if (HasNativeSamplers())
@@ -485,12 +502,13 @@ void GLResourceHeap::AllocSegmentsTexture(BindingDescriptorIterator& bindingIter
         /* Build all resource segments for type <GLResourceHeapSegment> */
         segmentation_.numTextureSegments = GLResourceHeap::ConsolidateSegments(
             bindingSlots,
-            BIND_SEGMENT_ALLOCATOR(GLResourceHeap::Alloc3PartSegment, GLResourceType_Texture, sizeof(GLuint), sizeof(GLTextureTarget), sizeof(GLuint))
+            BIND_SEGMENT_ALLOCATOR(GLResourceHeap::Alloc3PartSegment, GLResourceType_Texture, sizeof(GLuint), sizeof(GLTextureTarget), sizeof(GLuint)),
+            GetBridgeSlotsFunc(pipelineLayout, GLResourceType_Texture)
         );
     }
 }
 
-void GLResourceHeap::AllocSegmentsImage(BindingDescriptorIterator& bindingIter)
+void GLResourceHeap::AllocSegmentsImage(BindingDescriptorIterator& bindingIter, const GLPipelineLayout& pipelineLayout)
 {
     /* Collect all textures with storage binding */
     auto bindingSlots = FilterAndSortGLBindingSlots(bindingIter, ResourceType::Texture, BindFlags::Storage);
@@ -498,11 +516,12 @@ void GLResourceHeap::AllocSegmentsImage(BindingDescriptorIterator& bindingIter)
     /* Build all resource segments for type <GLResourceHeapSegment> */
     segmentation_.numImageTextureSegments = GLResourceHeap::ConsolidateSegments(
         bindingSlots,
-        BIND_SEGMENT_ALLOCATOR(GLResourceHeap::Alloc2PartSegment, GLResourceType_Image, sizeof(GLuint), sizeof(GLenum))
+        BIND_SEGMENT_ALLOCATOR(GLResourceHeap::Alloc2PartSegment, GLResourceType_Image, sizeof(GLuint), sizeof(GLenum)),
+        GetBridgeSlotsFunc(pipelineLayout, GLResourceType_Image)
     );
 }
 
-void GLResourceHeap::AllocSegmentsSampler(BindingDescriptorIterator& bindingIter)
+void GLResourceHeap::AllocSegmentsSampler(BindingDescriptorIterator& bindingIter, const GLPipelineLayout& pipelineLayout)
 {
     #ifdef LLGL_GL_ENABLE_OPENGL2X
     if (HasNativeSamplers())
@@ -514,7 +533,8 @@ void GLResourceHeap::AllocSegmentsSampler(BindingDescriptorIterator& bindingIter
         /* Allocate all resource segments for type <GLResourceHeap1PartSegment> */
         segmentation_.numSamplerSegments = GLResourceHeap::ConsolidateSegments(
             bindingSlots,
-            BIND_SEGMENT_ALLOCATOR(GLResourceHeap::Alloc1PartSegment, GLResourceType_Sampler, sizeof(GLuint))
+            BIND_SEGMENT_ALLOCATOR(GLResourceHeap::Alloc1PartSegment, GLResourceType_Sampler, sizeof(GLuint)),
+            GetBridgeSlotsFunc(pipelineLayout, GLResourceType_Sampler)
         );
     }
 }
@@ -579,6 +599,11 @@ void GLResourceHeap::AllocSegmentsGL2XSampler(BindingDescriptorIterator& binding
 
 #endif // /LLGL_GL_ENABLE_OPENGL2X
 
+GLuint GLResourceHeap::GetSegmentSlotCount(const GLResourceBinding* first, SegmentationSizeType count)
+{
+    return (first[count - 1].slot - first[0].slot + 1);
+}
+
 void GLResourceHeap::Alloc1PartSegment(
     GLResourceType              type,
     const GLResourceBinding*    first,
@@ -588,8 +613,9 @@ void GLResourceHeap::Alloc1PartSegment(
     /* Write binding map entries */
     WriteBindingMappings(first, count);
 
-    /* Allocate space for segment */
-    const auto  payloadSize     = static_cast<std::uint32_t>(payload0Stride * count);
+    /* Allocate space for segment; bridged slots between the bindings remain zero-initialized */
+    const auto  numSlots        = GetSegmentSlotCount(first, count);
+    const auto  payloadSize     = static_cast<std::uint32_t>(payload0Stride * numSlots);
     auto        segmentAlloc    = heap_.AllocSegment<GLResourceHeapSegment>(payloadSize);
 
     /* Write segment header */
@@ -598,7 +624,7 @@ void GLResourceHeap::Alloc1PartSegment(
         header->size        = segmentAlloc.Size();
         header->type        = type;
         header->first       = first->slot;
-        header->count       = static_cast<GLsizei>(count);
+        header->count       = static_cast<GLsizei>(numSlots);
         header->data1Offset = 0;
         header->data2Offset = 0;
     }
@@ -614,9 +640,10 @@ void GLResourceHeap::Alloc2PartSegment(
     /* Write binding map entries */
     WriteBindingMappings(first, count);
 
-    /* Allocate space for segment */
-    const auto  payloadData1Offset  = static_cast<std::uint32_t>(payload0Stride * count);
-    const auto  payloadSize         = static_cast<std::uint32_t>(payload1Stride * count + payloadData1Offset);
+    /* Allocate space for segment; bridged slots between the bindings remain zero-initialized */
+    const auto  numSlots            = GetSegmentSlotCount(first, count);
+    const auto  payloadData1Offset  = static_cast<std::uint32_t>(payload0Stride * numSlots);
+    const auto  payloadSize         = static_cast<std::uint32_t>(payload1Stride * numSlots + payloadData1Offset);
     auto        segmentAlloc        = heap_.AllocSegment<GLResourceHeapSegment>(payloadSize);
 
     /* Write segment header */
@@ -625,7 +652,7 @@ void GLResourceHeap::Alloc2PartSegment(
         header->size        = segmentAlloc.Size();
         header->type        = type;
         header->first       = first->slot;
-        header->count       = static_cast<GLsizei>(count);
+        header->count       = static_cast<GLsizei>(numSlots);
         header->data1Offset = segmentAlloc.PayloadOffset() + payloadData1Offset;
         header->data2Offset = 0;
     }
@@ -642,10 +669,11 @@ void GLResourceHeap::Alloc3PartSegment(
     /* Write binding map entries */
     WriteBindingMappings(first, count);
 
-    /* Allocate space for segment */
-    const auto  payloadData1Offset  = static_cast<std::uint32_t>(payload0Stride * count);
-    const auto  payloadData2Offset  = static_cast<std::uint32_t>(payload1Stride * count + payloadData1Offset);
-    const auto  payloadSize         = static_cast<std::uint32_t>(payload2Stride * count + payloadData2Offset);
+    /* Allocate space for segment; bridged slots between the bindings remain zero-initialized */
+    const auto  numSlots            = GetSegmentSlotCount(first, count);
+    const auto  payloadData1Offset  = static_cast<std::uint32_t>(payload0Stride * numSlots);
+    const auto  payloadData2Offset  = static_cast<std::uint32_t>(payload1Stride * numSlots + payloadData1Offset);
+    const auto  payloadSize         = static_cast<std::uint32_t>(payload2Stride * numSlots + payloadData2Offset);
     auto        segmentAlloc        = heap_.AllocSegment<GLResourceHeapSegment>(payloadSize);
 
     /* Write segment header */
@@ -654,7 +682,7 @@ void GLResourceHeap::Alloc3PartSegment(
         header->size        = segmentAlloc.Size();
         header->type        = type;
         header->first       = first->slot;
-        header->count       = static_cast<GLsizei>(count);
+        header->count       = static_cast<GLsizei>(numSlots);
         header->data1Offset = segmentAlloc.PayloadOffset() + payloadData1Offset;
         header->data2Offset = segmentAlloc.PayloadOffset() + payloadData2Offset;
     }
@@ -667,7 +695,7 @@ void GLResourceHeap::WriteBindingMappings(const GLResourceBinding* first, Segmen
         LLGL_ASSERT(first[i].index < bindingMap_.size());
         auto& mapping = bindingMap_[first[i].index];
         mapping.segmentOffset   = static_cast<std::uint32_t>(heap_.Size());
-        mapping.descriptorIndex = i;
+        mapping.descriptorIndex = (first[i].slot - first[0].slot);
     }
 }
 
@@ -733,8 +761,8 @@ static void UpdateTextureSegmentFlags(char* heapPtr, bool isAnyTextureViewAdded,
     auto segment = GLRESOURCEHEAP_SEGMENT(heapPtr);
     if (isAnyTextureViewAdded)
     {
-        /* Mark segment to have texture views */
-        segment->flags |= GLResourceFlags_HasTextureViews;
+        /* Mark segment to have texture views that must be initialized before the segment is bound */
+        segment->flags |= (GLResourceFlags_HasTextureViews | GLResourceFlags_HasPendingTextureViews);
     }
     else if (isAnyTextureViewRemoved)
     {
@@ -865,19 +893,95 @@ std::vector<GLResourceHeap::GLResourceBinding> GLResourceHeap::FilterAndSortGLBi
     return resourceBindings;
 }
 
+// Returns true if any dynamic resource or static sampler of the pipeline layout references a binding slot of the specified type within the range [firstSlot, lastSlot].
+static bool IsSlotRangeReferenced(const GLPipelineLayout& pipelineLayout, GLResourceType type, GLuint firstSlot, GLuint lastSlot)
+{
+    for (const GLPipelineResourceBinding& binding : pipelineLayout.GetBindings())
+    {
+        if (binding.type == type && binding.slot >= firstSlot && binding.slot <= lastSlot)
+            return true;
+    }
+    if (type == GLResourceType_Sampler)
+    {
+        for (GLuint slot : pipelineLayout.GetStaticSamplerSlots())
+        {
+            if (slot >= firstSlot && slot <= lastSlot)
+                return true;
+        }
+    }
+    return false;
+}
+
+GLResourceHeap::BridgeSlotsFunc GLResourceHeap::GetBridgeSlotsFunc(const GLPipelineLayout& pipelineLayout, GLResourceType type)
+{
+    #ifdef GL_ARB_multi_bind
+    /* Bridging slots only pays off if the segments can be submitted with a single GL_ARB_multi_bind call */
+    if (HasExtension(GLExt::ARB_multi_bind))
+    {
+        return [&pipelineLayout, type](GLuint firstSlot, GLuint lastSlot) -> bool
+        {
+            return !IsSlotRangeReferenced(pipelineLayout, type, firstSlot, lastSlot);
+        };
+    }
+    #endif // /GL_ARB_multi_bind
+    return nullptr;
+}
+
+/*
+Consolidates the sorted binding slots into segments of consecutive slots.
+If 'bridgeSlotsFunc' is specified, small gaps between the slots are bridged by null resources as long as no other binding of the pipeline layout references them.
+This allows to bind the entire descriptor set with a single multi-bind call per resource type even if the binding slots are not consecutive.
+*/
 GLResourceHeap::SegmentationSizeType GLResourceHeap::ConsolidateSegments(
     const ArrayView<GLResourceBinding>& bindingSlots,
-    const AllocSegmentFunc&             allocSegmentFunc)
+    const AllocSegmentFunc&             allocSegmentFunc,
+    const BridgeSlotsFunc&              bridgeSlotsFunc)
 {
-    return ConsolidateConsecutiveSequences<SegmentationSizeType>(
-        bindingSlots.begin(),
-        bindingSlots.end(),
-        allocSegmentFunc,
-        [](const GLResourceBinding& entry) -> GLuint
+    if (!bridgeSlotsFunc)
+    {
+        return ConsolidateConsecutiveSequences<SegmentationSizeType>(
+            bindingSlots.begin(),
+            bindingSlots.end(),
+            allocSegmentFunc,
+            [](const GLResourceBinding& entry) -> GLuint
+            {
+                return entry.slot;
+            }
+        );
+    }
+
+    /* Limit the number of null resources per gap and the segment size, which must fit into the 8-bit descriptor index (see BindingSegmentLocation) */
+    constexpr GLuint maxBridgedSlots    = 8;
+    constexpr GLuint maxSegmentSlots    = 256;
+
+    SegmentationSizeType numSegments = 0;
+
+    for (std::size_t begin = 0, end = 1; begin < bindingSlots.size(); ++end)
+    {
+        if (end < bindingSlots.size())
         {
-            return entry.slot;
+            const GLuint firstSlot  = bindingSlots[begin].slot;
+            const GLuint prevSlot   = bindingSlots[end - 1].slot;
+            const GLuint currSlot   = bindingSlots[end].slot;
+
+            /* Continue segment for consecutive slots and for gaps that can be bridged */
+            if (currSlot == prevSlot + 1)
+                continue;
+            if (currSlot - prevSlot - 1 <= maxBridgedSlots &&
+                currSlot - firstSlot + 1 <= maxSegmentSlots &&
+                bridgeSlotsFunc(prevSlot + 1, currSlot - 1))
+            {
+                continue;
+            }
         }
-    );
+
+        /* Build next segment */
+        allocSegmentFunc(&bindingSlots[begin], static_cast<SegmentationSizeType>(end - begin));
+        ++numSegments;
+        begin = end;
+    }
+
+    return numSegments;
 }
 
 #undef BIND_SEGMENT_ALLOCATOR
@@ -25,6 +25,7 @@ namespace LLGL
 
 enum GLResourceType : std::uint32_t;
 class GLStateManager;
+class GLPipelineLayout;
 class BindingDescriptorIterator;
 struct ResourceHeapDescriptor;
 
@@ -50,15 +51,22 @@ class GLResourceHeap final : public ResourceHeap
         // Writes the specified resource views to this resource heap and generates texture views as required.
         std::uint32_t WriteResourceViews(std::uint32_t firstDescriptor, const ArrayView<ResourceViewDescriptor>& resourceViews);
 
-        // Binds this resource heap with the specified GL state manager.
+        // Binds this resource heap with the specified GL state manager. Memory barriers must be submitted separately (see GetBarriers).
         void Bind(GLStateManager& stateMngr, std::uint32_t descriptorSet);
 
+        // Returns the bitmask for glMemoryBarrier that must be submitted before this resource heap is bound.
+        inline GLbitfield GetBarriers() const
+        {
+            return barriers_;
+        }
+
     private:
 
         struct GLResourceBinding;
 
         using SegmentationSizeType  = std::uint8_t;
         using AllocSegmentFunc      = std::function<void(const GLResourceBinding* first, SegmentationSizeType count)>;
+        using BridgeSlotsFunc       = std::function<bool(GLuint firstSlot, GLuint lastSlot)>;
 
         // Describes the segments within the raw buffer (per descriptor set).
         struct BufferSegmentation
@@ -91,11 +99,11 @@ class GLResourceHeap final : public ResourceHeap
         void FreeAllSegmentSetTextureViews(const char* heapPtr);
         void FreeAllSegmentsTextureViews();
 
-        void AllocSegmentsUBO(BindingDescriptorIterator& bindingIter);
-        void AllocSegmentsSSBO(BindingDescriptorIterator& bindingIter);
-        void AllocSegmentsTexture(BindingDescriptorIterator& bindingIter);
-        void AllocSegmentsImage(BindingDescriptorIterator& bindingIter);
-        void AllocSegmentsSampler(BindingDescriptorIterator& bindingIter);
+        void AllocSegmentsUBO(BindingDescriptorIterator& bindingIter, const GLPipelineLayout& pipelineLayout);
+        void AllocSegmentsSSBO(BindingDescriptorIterator& bindingIter, const GLPipelineLayout& pipelineLayout);
+        void AllocSegmentsTexture(BindingDescriptorIterator& bindingIter, const GLPipelineLayout& pipelineLayout);
+        void AllocSegmentsImage(BindingDescriptorIterator& bindingIter, const GLPipelineLayout& pipelineLayout);
+        void AllocSegmentsSampler(BindingDescriptorIterator& bindingIter, const GLPipelineLayout& pipelineLayout);
         #ifdef LLGL_GL_ENABLE_OPENGL2X
         void AllocSegmentsGL2XSampler(BindingDescriptorIterator& bindingIter);
         #endif
@@ -145,9 +153,16 @@ class GLResourceHeap final : public ResourceHeap
             long                        resourceBindFlags
         );
 
+        // Returns the number of binding slots the specified segment covers, including bridged slots.
+        static GLuint GetSegmentSlotCount(const GLResourceBinding* first, SegmentationSizeType count);
+
+        // Returns a function that determines whether a gap of binding slots can be bridged with null resources, or null if bridging is not supported.
+        static BridgeSlotsFunc GetBridgeSlotsFunc(const GLPipelineLayout& pipelineLayout, GLResourceType type);
+
         static SegmentationSizeType ConsolidateSegments(
             const ArrayView<GLResourceBinding>& bindingSlots,
-            const AllocSegmentFunc&             allocSegmentFunc
+            const AllocSegmentFunc&             allocSegmentFunc,
+            const BridgeSlotsFunc&              bridgeSlotsFunc     = nullptr
         );
 
     private:
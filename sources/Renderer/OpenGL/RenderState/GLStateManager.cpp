@@ -84,6 +84,7 @@ static const GLenum g_bufferTargetsEnum[] =
     GL_DISPATCH_INDIRECT_BUFFER,
     GL_DRAW_INDIRECT_BUFFER,
     GL_ELEMENT_ARRAY_BUFFER,
+    GL_PARAMETER_BUFFER_ARB,
     GL_PIXEL_PACK_BUFFER,
     GL_PIXEL_UNPACK_BUFFER,
     GL_QUERY_BUFFER,
@@ -152,8 +153,8 @@ static void InvalidateBoundGLObject(GLuint& boundId, const GLuint releasedObject
  * GLStateManager static members
  */
 
-GLStateManager*             GLStateManager::current_;
-GLStateManager::GLLimits    GLStateManager::commonLimits_;
+thread_local GLStateManager*    GLStateManager::current_;
+GLStateManager::GLLimits        GLStateManager::commonLimits_;
 
 struct GLStateManager::GLIntermediateBufferWriteMasks
 {
@@ -228,6 +229,13 @@ void GLStateManager::ClearCache()
     boundRasterizerState_       = nullptr;
     boundBlendState_            = nullptr;
     frontFacingDirtyBit_        = false;
+
+    /* Indexed buffer bindings are not queried, so force the next flush to submit all of them again */
+    for (GLIndexedBufferBindingTable& table : indexedBufferBindings_)
+    {
+        for (GLIndexedBufferBinding& binding : table.submitted)
+            binding.buffer = g_invalidGLId;
+    }
 }
 
 void GLStateManager::Set(GLState state, bool value)
@@ -240,7 +248,10 @@ void GLStateManager::Set(GLState state, bool value)
             glEnable(g_stateCapsEnum[idx]);
         else
             glDisable(g_stateCapsEnum[idx]);
+        CountStateChange();
     }
+    else
+        CountRedundantStateChange();
 }
 
 void GLStateManager::Enable(GLState state)
@@ -250,7 +261,10 @@ void GLStateManager::Enable(GLState state)
     {
         contextState_.capabilities[idx] = true;
         glEnable(g_stateCapsEnum[idx]);
+        CountStateChange();
     }
+    else
+        CountRedundantStateChange();
 }
 
 void GLStateManager::Disable(GLState state)
@@ -260,7 +274,10 @@ void GLStateManager::Disable(GLState state)
     {
         contextState_.capabilities[idx] = false;
         glDisable(g_stateCapsEnum[idx]);
+        CountStateChange();
     }
+    else
+        CountRedundantStateChange();
 }
 
 bool GLStateManager::IsEnabled(GLState state) const
@@ -675,7 +692,7 @@ void GLStateManager::BindDepthStencilState(GLDepthStencilState* depthStencilStat
 {
     if (depthStencilState != nullptr && depthStencilState != boundDepthStencilState_)
     {
-        depthStencilState->Bind(*this);
+        depthStencilState->Bind(*this, boundDepthStencilState_);
         boundDepthStencilState_ = depthStencilState;
     }
 }
@@ -745,7 +762,7 @@ void GLStateManager::BindBlendState(GLBlendState* blendState)
 {
     if (blendState != nullptr && blendState != boundBlendState_)
     {
-        blendState->Bind(*this);
+        blendState->Bind(*this, boundBlendState_);
         boundBlendState_ = blendState;
     }
 }
@@ -792,23 +809,35 @@ void GLStateManager::BindBuffer(GLBufferTarget target, GLuint buffer)
     {
         glBindBuffer(g_bufferTargetsEnum[targetIdx], buffer);
         contextState_.boundBuffers[targetIdx] = buffer;
+        CountStateChange();
     }
+    else
+        CountRedundantStateChange();
 }
 
 void GLStateManager::BindBufferBase(GLBufferTarget target, GLuint index, GLuint buffer)
 {
+    if (DeferIndexedBufferBindings(target, index, 1, &buffer, nullptr, nullptr))
+        return;
+
     /* Always bind buffer with a base index */
     auto targetIdx = static_cast<std::size_t>(target);
     glBindBufferBase(g_bufferTargetsEnum[targetIdx], index, buffer);
     contextState_.boundBuffers[targetIdx] = buffer;
+    CountStateChange();
 }
 
 void GLStateManager::BindBuffersBase(GLBufferTarget target, GLuint first, GLsizei count, const GLuint* buffers)
 {
-    /* Always bind buffers with a base index */
+    if (DeferIndexedBufferBindings(target, first, count, buffers, nullptr, nullptr))
+        return;
+
+    /* Always bind buffers with a base index, since indexed binding points are not cached */
     auto targetIdx = static_cast<std::size_t>(target);
     auto targetGL = g_bufferTargetsEnum[targetIdx];
 
+    CountStateChange(static_cast<std::uint32_t>(count));
+
     #ifdef GL_ARB_multi_bind
     if (HasExtension(GLExt::ARB_multi_bind))
     {
@@ -832,18 +861,27 @@ void GLStateManager::BindBuffersBase(GLBufferTarget target, GLuint first, GLsize
 
 void GLStateManager::BindBufferRange(GLBufferTarget target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
 {
+    if (DeferIndexedBufferBindings(target, index, 1, &buffer, &offset, &size))
+        return;
+
     /* Always bind buffer with a base index */
     auto targetIdx = static_cast<std::size_t>(target);
     glBindBufferRange(g_bufferTargetsEnum[targetIdx], index, buffer, offset, size);
     contextState_.boundBuffers[targetIdx] = buffer;
+    CountStateChange();
 }
 
 void GLStateManager::BindBuffersRange(GLBufferTarget target, GLuint first, GLsizei count, const GLuint* buffers, const GLintptr* offsets, const GLsizeiptr* sizes)
 {
-    /* Always bind buffers with a base index */
+    if (DeferIndexedBufferBindings(target, first, count, buffers, offsets, sizes))
+        return;
+
+    /* Always bind buffers with a base index, since indexed binding points are not cached */
     auto targetIdx = static_cast<std::size_t>(target);
     auto targetGL = g_bufferTargetsEnum[targetIdx];
 
+    CountStateChange(static_cast<std::uint32_t>(count));
+
     #ifdef GL_ARB_multi_bind
     if (HasExtension(GLExt::ARB_multi_bind))
     {
@@ -877,7 +915,22 @@ void GLStateManager::BindBuffersRange(GLBufferTarget target, GLuint first, GLsiz
 
 void GLStateManager::UnbindBuffersBase(GLBufferTarget target, GLuint first, GLsizei count)
 {
-    BindBuffersBase(GLBufferTarget::UniformBuffer, first, count, g_nullResources);
+    BindBuffersBase(target, first, count, g_nullResources);
+}
+
+void GLStateManager::FlushIndexedBufferBindings()
+{
+    FlushIndexedBufferBindingTable(GLBufferTarget::UniformBuffer, indexedBufferBindings_[0]);
+    FlushIndexedBufferBindingTable(GLBufferTarget::ShaderStorageBuffer, indexedBufferBindings_[1]);
+}
+
+void GLStateManager::BindTransformFeedback(GLuint transformFeedback)
+{
+    #ifdef LLGL_GLEXT_TRANSFORM_FEEDBACK2
+    glBindTransformFeedback(GL_TRANSFORM_FEEDBACK, transformFeedback);
+    glBindBuffer(GL_TRANSFORM_FEEDBACK_BUFFER, contextState_.boundBuffers[static_cast<std::size_t>(GLBufferTarget::TransformFeedbackBuffer)]);
+    CountStateChange();
+    #endif // /LLGL_GLEXT_TRANSFORM_FEEDBACK2
 }
 
 // Returns the maximum index value for the specified index data type.
@@ -934,7 +987,11 @@ void GLStateManager::BindVertexArray(GLuint vertexArray)
                 #endif // /LLGL_PRIMITIVE_RESTART
             }
         }
+
+        CountStateChange();
     }
+    else
+        CountRedundantStateChange();
 }
 
 void GLStateManager::BindGLBuffer(const GLBuffer& buffer)
@@ -1014,6 +1071,7 @@ void GLStateManager::NotifyBufferRelease(GLuint buffer, GLBufferTarget target)
 {
     auto targetIdx = static_cast<std::size_t>(target);
     InvalidateBoundGLObject(contextState_.boundBuffers[targetIdx], buffer);
+    NotifyIndexedBufferRelease(buffer, target);
 }
 
 void GLStateManager::NotifyBufferRelease(const GLBuffer& buffer)
@@ -1036,6 +1094,7 @@ void GLStateManager::NotifyBufferRelease(const GLBuffer& buffer)
     {
         NotifyBufferRelease(id, GLBufferTarget::DrawIndirectBuffer);
         NotifyBufferRelease(id, GLBufferTarget::DispatchIndirectBuffer);
+        NotifyBufferRelease(id, GLBufferTarget::ParameterBuffer);
     }
 
     NotifyBufferRelease(id, GLBufferTarget::CopyReadBuffer);
@@ -1078,7 +1137,10 @@ void GLStateManager::BindFramebuffer(GLFramebufferTarget target, GLuint framebuf
     {
         contextState_.boundFramebuffers[targetIdx] = framebuffer;
         glBindFramebuffer(g_framebufferTargetsEnum[targetIdx], framebuffer);
+        CountStateChange();
     }
+    else
+        CountRedundantStateChange();
 }
 
 void GLStateManager::PushBoundFramebuffer(GLFramebufferTarget target)
@@ -1126,7 +1188,10 @@ void GLStateManager::BindRenderbuffer(GLuint renderbuffer)
     {
         contextState_.boundRenderbuffer = renderbuffer;
         glBindRenderbuffer(GL_RENDERBUFFER, renderbuffer);
+        CountStateChange();
     }
+    else
+        CountRedundantStateChange();
 }
 
 void GLStateManager::PushBoundRenderbuffer()
@@ -1194,7 +1259,10 @@ void GLStateManager::ActiveTexture(GLuint layer)
         /* Active specified texture layer and store reference to bound textures array */
         contextState_.activeTexture = layer;
         glActiveTexture(g_textureLayersEnum[layer]);
+        CountStateChange();
     }
+    else
+        CountRedundantStateChange();
 }
 
 void GLStateManager::BindTexture(GLTextureTarget target, GLuint texture)
@@ -1206,7 +1274,10 @@ void GLStateManager::BindTexture(GLTextureTarget target, GLuint texture)
     {
         textureLayer->boundTextures[targetIdx] = texture;
         glBindTexture(g_textureTargetsEnum[targetIdx], texture);
+        CountStateChange();
     }
+    else
+        CountRedundantStateChange();
 }
 
 void GLStateManager::BindTextures(GLuint first, GLsizei count, const GLTextureTarget* targets, const GLuint* textures)
@@ -1214,19 +1285,40 @@ void GLStateManager::BindTextures(GLuint first, GLsizei count, const GLTextureTa
     #ifdef GL_ARB_multi_bind
     if (HasExtension(GLExt::ARB_multi_bind))
     {
+        /*
+        Trim leading and trailing textures that are already bound.
+        Zero entries are never trimmed, because glBindTextures unbinds all targets of a texture unit for them.
+        */
+        auto IsTextureBound = [this, first, targets, textures](GLsizei i) -> bool
+        {
+            auto targetIdx = static_cast<std::size_t>(targets[i]);
+            return (textures[i] != 0 && contextState_.textureLayers[i + first].boundTextures[targetIdx] == textures[i]);
+        };
+
+        GLsizei begin = 0, end = count;
+        while (begin < end && IsTextureBound(begin))
+            ++begin;
+        while (end > begin && IsTextureBound(end - 1))
+            --end;
+
+        CountRedundantStateChange(static_cast<std::uint32_t>(count - (end - begin)));
+        if (begin == end)
+            return;
+
         /* Store bound textures */
-        for_range(i, count)
+        for (GLsizei i = begin; i < end; ++i)
         {
             auto targetIdx = static_cast<std::size_t>(targets[i]);
             contextState_.textureLayers[i + first].boundTextures[targetIdx] = textures[i];
         }
 
         /*
-        Bind all textures at once, but don't reset the currently active texture layer.
+        Bind all remaining textures at once, but don't reset the currently active texture layer.
         The spec. of GL_ARB_multi_bind states that the active texture slot is not modified by this function.
         see https://www.khronos.org/registry/OpenGL/extensions/ARB/ARB_multi_bind.txt
         */
-        glBindTextures(first, count, textures);
+        glBindTextures(first + static_cast<GLuint>(begin), end - begin, textures + begin);
+        CountStateChange(static_cast<std::uint32_t>(end - begin));
     }
     else
     #endif
@@ -1386,6 +1478,11 @@ void GLStateManager::DeleteTexture(GLuint texture, GLTextureTarget target, bool
     }
 }
 
+void GLStateManager::InvalidateBoundTexture(GLuint texture, GLTextureTarget target)
+{
+    NotifyTextureRelease(texture, target, false);
+}
+
 /* ----- Sampler ----- */
 
 void GLStateManager::BindSampler(GLuint layer, GLuint sampler)
@@ -1398,7 +1495,10 @@ void GLStateManager::BindSampler(GLuint layer, GLuint sampler)
     {
         contextState_.boundSamplers[layer] = sampler;
         glBindSampler(layer, sampler);
+        CountStateChange();
     }
+    else
+        CountRedundantStateChange();
 }
 
 void GLStateManager::BindSamplers(GLuint first, GLsizei count, const GLuint* samplers)
@@ -1406,12 +1506,24 @@ void GLStateManager::BindSamplers(GLuint first, GLsizei count, const GLuint* sam
     #ifdef GL_ARB_multi_bind
     if (count >= 2 && HasExtension(GLExt::ARB_multi_bind))
     {
+        /* Trim leading and trailing samplers that are already bound */
+        GLsizei begin = 0, end = count;
+        while (begin < end && contextState_.boundSamplers[first + begin] == samplers[begin])
+            ++begin;
+        while (end > begin && contextState_.boundSamplers[first + end - 1] == samplers[end - 1])
+            --end;
+
+        CountRedundantStateChange(static_cast<std::uint32_t>(count - (end - begin)));
+        if (begin == end)
+            return;
+
         /* Store bound samplers */
-        for_range(i, count)
+        for (GLsizei i = begin; i < end; ++i)
             contextState_.boundSamplers[i + first] = samplers[i];
 
-        /* Bind all samplers at once */
-        glBindSamplers(first, count, samplers);
+        /* Bind all remaining samplers at once */
+        glBindSamplers(first + static_cast<GLuint>(begin), end - begin, samplers + begin);
+        CountStateChange(static_cast<std::uint32_t>(end - begin));
     }
     else
     #endif
@@ -1478,7 +1590,10 @@ void GLStateManager::BindShaderProgram(GLuint program)
     {
         contextState_.boundProgram = program;
         glUseProgram(program);
+        CountStateChange();
     }
+    else
+        CountRedundantStateChange();
 }
 
 void GLStateManager::PushBoundShaderProgram()
@@ -1516,7 +1631,10 @@ void GLStateManager::BindProgramPipeline(GLuint pipeline)
     {
         contextState_.boundProgramPipeline = pipeline;
         glBindProgramPipeline(pipeline);
+        CountStateChange();
     }
+    else
+        CountRedundantStateChange();
     #endif
 }
 
@@ -1537,8 +1655,13 @@ GLuint GLStateManager::GetBoundProgramPipeline() const
 
 void GLStateManager::BindRenderTarget(RenderTarget& renderTarget, GLStateManager** nextStateManager)
 {
-    /* Resolve previously bound render target */
-    ResolveMultisampledRenderTarget();
+    /*
+    Resolve previously bound render target unless the same render target is bound again.
+    This merges consecutive render passes on the same render target, so tile-based GPUs don't have to
+    flush their tile memory for a multi-sample resolve in between. The resolve is deferred until another render target is bound.
+    */
+    if (GetBoundRenderTarget() != &renderTarget)
+        ResolveMultisampledRenderTarget();
 
     /* Bind render target/context */
     if (LLGL::IsInstanceOf<SwapChain>(renderTarget))
@@ -1647,11 +1770,161 @@ void GLStateManager::ClearBuffers(std::uint32_t numAttachments, const Attachment
     RestoreWriteMasks(intermediateMasks);
 }
 
+/* ----- Feedback ----- */
+
+void GLStateManager::FlushStatistics(ProfileCommandBufferRecord& outRecord)
+{
+    outRecord.stateChanges          += numStateChanges_;
+    outRecord.redundantStateChanges += numRedundantStateChanges_;
+    numStateChanges_            = 0;
+    numRedundantStateChanges_   = 0;
+}
+
 
 /*
  * ======= Private: =======
  */
 
+GLStateManager::GLIndexedBufferBindingTable* GLStateManager::GetIndexedBufferBindingTable(GLBufferTarget target)
+{
+    switch (target)
+    {
+        case GLBufferTarget::UniformBuffer:         return &(indexedBufferBindings_[0]);
+        case GLBufferTarget::ShaderStorageBuffer:   return &(indexedBufferBindings_[1]);
+        default:                                    return nullptr;
+    }
+}
+
+bool GLStateManager::DeferIndexedBufferBindings(
+    GLBufferTarget      target,
+    GLuint              first,
+    GLsizei             count,
+    const GLuint*       buffers,
+    const GLintptr*     offsets,
+    const GLsizeiptr*   sizes)
+{
+    /* Only shadow bindings of targets that are consumed by draw and compute commands exclusively */
+    GLIndexedBufferBindingTable* table = GetIndexedBufferBindingTable(target);
+    if (table == nullptr || count <= 0 || first + static_cast<GLuint>(count) > g_maxNumResourceSlots)
+        return false;
+
+    for_range(i, static_cast<GLuint>(count))
+    {
+        GLIndexedBufferBinding& binding = table->pending[first + i];
+        binding.buffer = buffers[i];
+        if (offsets != nullptr && sizes != nullptr && buffers[i] != 0)
+        {
+            binding.offset  = offsets[i];
+            binding.size    = sizes[i];
+        }
+        else
+        {
+            binding.offset  = 0;
+            binding.size    = 0;
+        }
+    }
+
+    table->dirtyBegin   = std::min(table->dirtyBegin, first);
+    table->dirtyEnd     = std::max(table->dirtyEnd, first + static_cast<GLuint>(count));
+
+    return true;
+}
+
+void GLStateManager::FlushIndexedBufferBindingTable(GLBufferTarget target, GLIndexedBufferBindingTable& table)
+{
+    GLuint slot = table.dirtyBegin;
+
+    while (slot < table.dirtyEnd)
+    {
+        /* Skip over all bindings that are already present in GL */
+        const GLIndexedBufferBinding& binding = table.pending[slot];
+        if (binding.buffer == table.submitted[slot].buffer && binding.offset == table.submitted[slot].offset && binding.size == table.submitted[slot].size)
+        {
+            CountRedundantStateChange();
+            ++slot;
+            continue;
+        }
+
+        /* Gather contiguous range of modified bindings of the same kind, i.e. either all with or without a buffer range */
+        const bool      hasRange    = (binding.size != 0);
+        const GLuint    first       = slot;
+
+        for (; slot < table.dirtyEnd; ++slot)
+        {
+            const GLIndexedBufferBinding& next = table.pending[slot];
+            if ((next.size != 0) != hasRange)
+                break;
+            if (next.buffer == table.submitted[slot].buffer && next.offset == table.submitted[slot].offset && next.size == table.submitted[slot].size)
+                break;
+            table.submitted[slot] = next;
+        }
+
+        SubmitIndexedBufferBindings(target, &(table.pending[first]), first, static_cast<GLsizei>(slot - first));
+    }
+
+    table.dirtyBegin    = g_maxNumResourceSlots;
+    table.dirtyEnd      = 0;
+}
+
+void GLStateManager::SubmitIndexedBufferBindings(GLBufferTarget target, const GLIndexedBufferBinding* bindings, GLuint first, GLsizei count)
+{
+    auto targetIdx = static_cast<std::size_t>(target);
+    auto targetGL = g_bufferTargetsEnum[targetIdx];
+
+    const bool hasRange = (bindings[0].size != 0);
+
+    CountStateChange(static_cast<std::uint32_t>(count));
+
+    #ifdef GL_ARB_multi_bind
+    if (count > 1 && HasExtension(GLExt::ARB_multi_bind))
+    {
+        /* Bindings are stored interleaved, so they must be split into separate arrays for the multi-bind functions */
+        GLuint      buffers[g_maxNumResourceSlots];
+        GLintptr    offsets[g_maxNumResourceSlots];
+        GLsizeiptr  sizes[g_maxNumResourceSlots];
+
+        for_range(i, count)
+        {
+            buffers[i] = bindings[i].buffer;
+            offsets[i] = bindings[i].offset;
+            sizes[i]   = bindings[i].size;
+        }
+
+        /* Generic binding point is not modified by multi-bind functions */
+        if (hasRange)
+            glBindBuffersRange(targetGL, first, count, buffers, offsets, sizes);
+        else
+            glBindBuffersBase(targetGL, first, count, buffers);
+    }
+    else
+    #endif // /GL_ARB_multi_bind
+    {
+        /* Bind each individual buffer, and store last bound buffer */
+        contextState_.boundBuffers[targetIdx] = bindings[count - 1].buffer;
+
+        for_range(i, count)
+        {
+            if (hasRange)
+                glBindBufferRange(targetGL, first + i, bindings[i].buffer, bindings[i].offset, bindings[i].size);
+            else
+                glBindBufferBase(targetGL, first + i, bindings[i].buffer);
+        }
+    }
+}
+
+void GLStateManager::NotifyIndexedBufferRelease(GLuint buffer, GLBufferTarget target)
+{
+    if (GLIndexedBufferBindingTable* table = GetIndexedBufferBindingTable(target))
+    {
+        for_range(i, g_maxNumResourceSlots)
+        {
+            InvalidateBoundGLObject(table->submitted[i].buffer, buffer);
+            if (table->pending[i].buffer == buffer)
+                table->pending[i] = GLIndexedBufferBinding{ 0, 0, 0 };
+        }
+    }
+}
+
 GLContextState::TextureLayer* GLStateManager::GetActiveTextureLayer()
 {
     return &(contextState_.textureLayers[contextState_.activeTexture]);
@@ -1912,6 +2185,33 @@ void GLStateManager::ClearAttachmentsWithRenderPass(
     RestoreWriteMasks(intermediateMasks);
 }
 
+void GLStateManager::InvalidateAttachments(std::uint32_t attachmentMask)
+{
+    #ifdef LLGL_GLEXT_INVALIDATE_SUBDATA
+    if (attachmentMask == 0 || !HasExtension(GLExt::ARB_invalidate_subdata))
+        return;
+
+    GLenum  attachments[LLGL_MAX_NUM_ATTACHMENTS];
+    GLsizei numAttachments = 0;
+
+    if (auto* renderTarget = GetBoundRenderTarget())
+        numAttachments = renderTarget->GetInvalidateAttachments(attachmentMask, attachments);
+    else
+    {
+        /* Default framebuffer uses buffer names instead of attachment points */
+        if ((attachmentMask & 0x1u) != 0)
+            attachments[numAttachments++] = GL_COLOR;
+        if ((attachmentMask & GLRenderPass::invalidateDepthBit) != 0)
+            attachments[numAttachments++] = GL_DEPTH;
+        if ((attachmentMask & GLRenderPass::invalidateStencilBit) != 0)
+            attachments[numAttachments++] = GL_STENCIL;
+    }
+
+    if (numAttachments > 0)
+        glInvalidateFramebuffer(GL_DRAW_FRAMEBUFFER, numAttachments, attachments);
+    #endif // /LLGL_GLEXT_INVALIDATE_SUBDATA
+}
+
 std::uint32_t GLStateManager::ClearColorBuffers(
     const std::uint8_t*             colorBuffers,
     std::uint32_t                   numClearValues,
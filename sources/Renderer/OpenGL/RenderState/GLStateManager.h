@@ -13,6 +13,7 @@
 #include "GLContextState.h"
 #include <LLGL/TextureFlags.h>
 #include <LLGL/CommandBufferFlags.h>
+#include <LLGL/RenderingDebuggerFlags.h>
 #include "../OpenGL.h"
 #include <array>
 #include <stack>
@@ -168,14 +169,28 @@ class GLStateManager
         static GLenum ToGLBufferTarget(GLBufferTarget target);
 
         void BindBuffer(GLBufferTarget target, GLuint buffer);
+
+        /*
+        Binds buffers to indexed binding points. Bindings to GL_UNIFORM_BUFFER and GL_SHADER_STORAGE_BUFFER are only shadowed,
+        so intermediate bindings that are overridden before the next draw or compute command never reach GL (see FlushIndexedBufferBindings).
+        */
         void BindBufferBase(GLBufferTarget target, GLuint index, GLuint buffer);
         void BindBuffersBase(GLBufferTarget target, GLuint first, GLsizei count, const GLuint* buffers);
         void BindBufferRange(GLBufferTarget target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
         void BindBuffersRange(GLBufferTarget target, GLuint first, GLsizei count, const GLuint* buffers, const GLintptr* offsets, const GLsizeiptr* sizes);
         void UnbindBuffersBase(GLBufferTarget target, GLuint first, GLsizei count);
 
+        // Submits all shadowed indexed buffer bindings that differ from the bindings in GL. This must be called before every draw and compute command.
+        void FlushIndexedBufferBindings();
+
         void BindVertexArray(GLuint vertexArray);
 
+        /*
+        Binds the specified transform feedback object. This is not cached, since transform feedback objects are only bound within stream-output sections.
+        The cached GL_TRANSFORM_FEEDBACK_BUFFER binding is re-established, since the generic binding point can be part of the transform feedback object state.
+        */
+        void BindTransformFeedback(GLuint transformFeedback);
+
         void BindGLBuffer(const GLBuffer& buffer);
 
         void NotifyVertexArrayRelease(GLuint vertexArray);
@@ -245,6 +260,9 @@ class GLStateManager
 
         void DeleteTexture(GLuint texture, GLTextureTarget target, bool invalidateActiveLayerOnly = false);
 
+        // Invalidates the cached bindings of the specified texture, so it's re-bound the next time; required after the texture was modified by a shared GL context.
+        void InvalidateBoundTexture(GLuint texture, GLTextureTarget target);
+
         /* ----- Sampler ----- */
 
         void BindSampler(GLuint layer, GLuint sampler);
@@ -287,6 +305,9 @@ class GLStateManager
             const ClearValue*   clearValues
         );
 
+        // Invalidates the attachments of the bound framebuffer that are specified by the bitmask (see GLRenderPass::GetInvalidateOnBeginMask).
+        void InvalidateAttachments(std::uint32_t attachmentMask);
+
         void Clear(long flags);
         void ClearBuffers(std::uint32_t numAttachments, const AttachmentClear* attachments);
 
@@ -304,6 +325,15 @@ class GLStateManager
             return framebufferHeight_;
         }
 
+        // Returns the currently bound vertex-array-object (VAO) or zero if there is none.
+        inline GLuint GetBoundVertexArray() const
+        {
+            return contextState_.boundVertexArray;
+        }
+
+        // Adds the number of issued and redundant state changes since the last call to the specified record and resets the counters.
+        void FlushStatistics(ProfileCommandBufferRecord& outRecord);
+
     public:
 
         // Returns the common denominator of limitations for all GL contexts.
@@ -316,8 +346,36 @@ class GLStateManager
 
         struct GLIntermediateBufferWriteMasks;
 
+        struct GLIndexedBufferBinding
+        {
+            GLuint      buffer;
+            GLintptr    offset;
+            GLsizeiptr  size;   // Zero to bind the entire buffer, i.e. glBindBufferBase.
+        };
+
+        // Shadowed indexed binding points of a single buffer target.
+        struct GLIndexedBufferBindingTable
+        {
+            GLIndexedBufferBinding  pending[g_maxNumResourceSlots]      = {};                       // Bindings requested since the last flush.
+            GLIndexedBufferBinding  submitted[g_maxNumResourceSlots]    = {};                       // Bindings as they were last submitted to GL.
+            GLuint                  dirtyBegin                          = g_maxNumResourceSlots;    // First pending binding that has been modified.
+            GLuint                  dirtyEnd                            = 0;                        // Last pending binding that has been modified, plus one.
+        };
+
     private:
 
+        // Increments the counter of state changes that were issued to GL.
+        inline void CountStateChange(std::uint32_t count = 1)
+        {
+            numStateChanges_ += count;
+        }
+
+        // Increments the counter of state changes that were omitted by the state cache.
+        inline void CountRedundantStateChange(std::uint32_t count = 1)
+        {
+            numRedundantStateChanges_ += count;
+        }
+
         bool NeedsAdjustedViewport() const;
 
         void AdjustViewport(GLViewport& outViewport, const GLViewport& inViewport);
@@ -325,6 +383,21 @@ class GLStateManager
 
         void AssertViewportLimit(GLuint first, GLsizei count);
 
+        GLIndexedBufferBindingTable* GetIndexedBufferBindingTable(GLBufferTarget target);
+
+        bool DeferIndexedBufferBindings(
+            GLBufferTarget      target,
+            GLuint              first,
+            GLsizei             count,
+            const GLuint*       buffers,
+            const GLintptr*     offsets,
+            const GLsizeiptr*   sizes
+        );
+
+        void FlushIndexedBufferBindingTable(GLBufferTarget target, GLIndexedBufferBindingTable& table);
+        void SubmitIndexedBufferBindings(GLBufferTarget target, const GLIndexedBufferBinding* bindings, GLuint first, GLsizei count);
+        void NotifyIndexedBufferRelease(GLuint buffer, GLBufferTarget target);
+
         GLContextState::TextureLayer* GetActiveTextureLayer();
         void NotifyTextureRelease(GLuint texture, GLTextureTarget target, bool invalidateActiveLayerOnly);
 
@@ -396,14 +469,15 @@ class GLStateManager
 
     private:
 
-        static GLStateManager*  current_;
-        static GLLimits         commonLimits_;          // Common denominator of limitations for all GL contexts
+        static thread_local GLStateManager* current_;               // State manager of the GL context that is current for the calling thread
+        static GLLimits                     commonLimits_;          // Common denominator of limitations for all GL contexts
 
     private:
 
         GLLimits                            limits_;                // Limitations of this GL context
 
         GLContextState                      contextState_;
+        GLIndexedBufferBindingTable         indexedBufferBindings_[2];  // Shadowed bindings of GL_UNIFORM_BUFFER and GL_SHADER_STORAGE_BUFFER.
 
         #ifdef LLGL_GL_ENABLE_OPENGL2X
         GLTexture*                          boundGLTextures_[GLContextState::numTextureLayers]      = {};
@@ -429,6 +503,9 @@ class GLStateManager
 
         bool                                frontFacingDirtyBit_        = false;
 
+        std::uint32_t                       numStateChanges_            = 0; // Number of state changes issued to GL since the last FlushStatistics()
+        std::uint32_t                       numRedundantStateChanges_   = 0; // Number of state changes omitted by the state cache since the last FlushStatistics()
+
         std::stack<CapabilityStackEntry>    capabilitiesStack_;
         std::stack<BufferStackEntry>        bufferStack_;
         std::stack<TextureStackEntry>       textureState_;
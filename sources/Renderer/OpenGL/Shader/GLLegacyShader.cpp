@@ -12,6 +12,7 @@
 #include "../GLTypes.h"
 #include "../GLObjectUtils.h"
 #include "../../../Core/Exception.h"
+#include <string.h>
 
 
 namespace LLGL
@@ -28,6 +29,8 @@ GLLegacyShader::GLLegacyShader(const ShaderDescriptor& desc) :
 
 GLLegacyShader::~GLLegacyShader()
 {
+    if (GetID(PermutationFlippedYPosition) != GetID(PermutationDefault))
+        glDeleteShader(GetID(PermutationFlippedYPosition));
     glDeleteShader(GetID());
 }
 
@@ -38,6 +41,12 @@ void GLLegacyShader::SetDebugName(const char* name)
 
 bool GLLegacyShader::Reflect(ShaderReflection& reflection) const
 {
+    #ifdef LLGL_ENABLE_SPIRV_REFLECT
+    /* Reflect SPIR-V module directly without querying an intermediate GL program */
+    if (ReflectSpirv(reflection))
+        return true;
+    #endif
+
     const Shader* shaders[] = { this };
     GLShaderProgram intermediateProgram{ 1, shaders };
     GLShaderProgram::QueryReflection(intermediateProgram.GetID(), GetGLType(), reflection);
@@ -93,11 +102,21 @@ GLuint GLLegacyShader::CreateShaderPermutation(Permutation permutation)
     return id;
 }
 
+void GLLegacyShader::QueryPendingReport()
+{
+    if (FinalizeShaderPermutation(PermutationDefault))
+    {
+        if (GetID(PermutationFlippedYPosition) != GetID(PermutationDefault))
+            FinalizeShaderPermutation(PermutationFlippedYPosition);
+    }
+}
+
 bool GLLegacyShader::FinalizeShaderPermutation(Permutation permutation)
 {
     /* Query compile status and log */
-    const bool status = GLLegacyShader::GetCompileStatus(GetID());
-    ReportStatusAndLog(status, GLLegacyShader::GetGLShaderLog(GetID()));
+    const GLuint shader = GetID(permutation);
+    const bool status = GLLegacyShader::GetCompileStatus(shader);
+    ReportStatusAndLog(status, GLLegacyShader::GetGLShaderLog(shader));
     return status;
 }
 
@@ -111,10 +130,14 @@ void GLLegacyShader::BuildShader(const ShaderDescriptor& shaderDesc)
 
 void GLLegacyShader::CompileSource(const ShaderDescriptor& shaderDesc)
 {
-    auto CompileShaderPermutation = [this, &shaderDesc](Permutation permutation, long enabledFlags) -> bool
+    auto CompileShaderPermutation = [this, &shaderDesc](Permutation permutation, long enabledFlags) -> void
     {
         const GLuint shader = CreateShaderPermutation(permutation);
-        auto sourceCallback = std::bind(GLLegacyShader::CompileShaderSource, shader, std::placeholders::_1);
+        auto sourceCallback = [this, shader, permutation](const char* source) -> void
+        {
+            HashShaderSource(permutation, source, ::strlen(source));
+            GLLegacyShader::CompileShaderSource(shader, source);
+        };
 
         if (shaderDesc.sourceType == ShaderSourceType::CodeFile)
         {
@@ -123,16 +146,28 @@ void GLLegacyShader::CompileSource(const ShaderDescriptor& shaderDesc)
         }
         else
             GLShader::PatchShaderSource(sourceCallback, shaderDesc.source, shaderDesc, enabledFlags);
-
-        return FinalizeShaderPermutation(permutation);
     };
 
+    const bool needsPermutationFlippedYPosition = GLShader::NeedsPermutationFlippedYPosition(shaderDesc.type, shaderDesc.flags);
+
     /* Compile and patch default shader permutation */
-    if (CompileShaderPermutation(PermutationDefault, ShaderCompileFlags::NoOptimization))
+    CompileShaderPermutation(PermutationDefault, ShaderCompileFlags::NoOptimization);
+
+    if (GLShader::HasParallelShaderCompile())
+    {
+        /* Compile all permutations in the background and query their status when the report is requested */
+        if (needsPermutationFlippedYPosition)
+            CompileShaderPermutation(PermutationFlippedYPosition, ShaderCompileFlags::NoOptimization | ShaderCompileFlags::PatchClippingOrigin);
+        SetReportPending();
+    }
+    else if (FinalizeShaderPermutation(PermutationDefault))
     {
         /* Compile and patch shader permutation for flipped Y-position */
-        if (GLShader::NeedsPermutationFlippedYPosition(shaderDesc.type, shaderDesc.flags))
+        if (needsPermutationFlippedYPosition)
+        {
             CompileShaderPermutation(PermutationFlippedYPosition, ShaderCompileFlags::NoOptimization | ShaderCompileFlags::PatchClippingOrigin);
+            FinalizeShaderPermutation(PermutationFlippedYPosition);
+        }
     }
 }
 
@@ -144,16 +179,16 @@ void GLLegacyShader::LoadBinary(const ShaderDescriptor& shaderDesc)
     if (HasExtension(GLExt::ARB_gl_spirv) && HasExtension(GLExt::ARB_ES2_compatibility))
     {
         /* Get shader binary */
-        std::vector<char>   fileContent;
+        Blob                fileContent;
         const void*         binaryBuffer    = nullptr;
         GLsizei             binaryLength    = 0;
 
         if (shaderDesc.sourceType == ShaderSourceType::BinaryFile)
         {
-            /* Load binary from file */
-            fileContent = ReadFileBuffer(shaderDesc.source);
-            binaryBuffer = fileContent.data();
-            binaryLength = static_cast<GLsizei>(fileContent.size());
+            /* Map binary from file */
+            fileContent = ReadFileMapped(shaderDesc.source);
+            binaryBuffer = fileContent.GetData();
+            binaryLength = static_cast<GLsizei>(fileContent.GetSize());
         }
         else
         {
@@ -163,8 +198,13 @@ void GLLegacyShader::LoadBinary(const ShaderDescriptor& shaderDesc)
         }
 
         /* Load shader binary */
+        HashShaderSource(PermutationDefault, binaryBuffer, static_cast<std::size_t>(binaryLength), shaderDesc.entryPoint);
         glShaderBinary(1, &shader, GL_SHADER_BINARY_FORMAT_SPIR_V, binaryBuffer, binaryLength);
 
+        #ifdef LLGL_ENABLE_SPIRV_REFLECT
+        BuildSpirvReflection(binaryBuffer, static_cast<std::size_t>(binaryLength));
+        #endif
+
         /* Specialize for the default "main" function in a SPIR-V module  */
         const char* entryPoint = (shaderDesc.entryPoint == nullptr || *shaderDesc.entryPoint == '\0' ? "main" : shaderDesc.entryPoint);
         glSpecializeShader(shader, entryPoint, 0, nullptr, nullptr);
@@ -41,6 +41,10 @@ class GLLegacyShader final : public GLShader
         // Returns the native GL shader log.
         static std::string GetGLShaderLog(GLuint shader);
 
+    private:
+
+        void QueryPendingReport() override;
+
     private:
 
         GLuint CreateShaderPermutation(Permutation permutation);
@@ -41,11 +41,12 @@ static GLuint GLCreateProgramPipeline()
 GLProgramPipeline::GLProgramPipeline(
     std::size_t             numShaders,
     Shader* const*          shaders,
-    GLShader::Permutation   permutation)
+    GLShader::Permutation   permutation,
+    GLPipelineCache*        pipelineCache)
 :
     GLShaderPipeline { GLCreateProgramPipeline() }
 {
-    UseProgramStages(numShaders, reinterpret_cast<GLSeparableShader* const*>(shaders), permutation);
+    UseProgramStages(numShaders, reinterpret_cast<GLSeparableShader* const*>(shaders), permutation, pipelineCache);
 }
 
 GLProgramPipeline::~GLProgramPipeline()
@@ -86,6 +87,16 @@ void GLProgramPipeline::BindResourceSlots(const GLShaderBindingLayout& bindingLa
         separableShaders_[i]->BindResourceSlots(bindingLayout);
 }
 
+bool GLProgramPipeline::IsLinkCompleted() const
+{
+    for_range(i, GetSignature().GetNumShaders())
+    {
+        if (!separableShaders_[i]->IsLinkCompleted())
+            return false;
+    }
+    return true;
+}
+
 void GLProgramPipeline::QueryInfoLogs(Report& report)
 {
     bool hasErrors = false;
@@ -105,7 +116,8 @@ void GLProgramPipeline::QueryInfoLogs(Report& report)
 void GLProgramPipeline::UseProgramStages(
     std::size_t                 numShaders,
     GLSeparableShader* const*   shaders,
-    GLShader::Permutation       permutation)
+    GLShader::Permutation       permutation,
+    GLPipelineCache*            pipelineCache)
 {
     /* Find last shader in pipeline that transforms gl_Position if such permutation is requested */
     const GLShader* shaderWithFlippedYPosition = nullptr;
@@ -124,6 +136,7 @@ void GLProgramPipeline::UseProgramStages(
                     ? GLShader::PermutationFlippedYPosition
                     : GLShader::PermutationDefault
             );
+            separableShader->LinkPrograms(pipelineCache);
             glUseProgramStages(GetID(), stage, separableShader->GetID(permutationForShader));
             separableShaders_[i] = separableShader;
         }
@@ -17,6 +17,7 @@ namespace LLGL
 
 
 class GLSeparableShader;
+class GLPipelineCache;
 
 class GLProgramPipeline final : public GLShaderPipeline
 {
@@ -26,18 +27,25 @@ class GLProgramPipeline final : public GLShaderPipeline
         GLProgramPipeline(
             std::size_t             numShaders,
             Shader* const*          shaders,
-            GLShader::Permutation   permutation = GLShader::PermutationDefault
+            GLShader::Permutation   permutation     = GLShader::PermutationDefault,
+            GLPipelineCache*        pipelineCache   = nullptr
         );
         ~GLProgramPipeline();
 
         void Bind(GLStateManager& stateMngr) override;
         void BindResourceSlots(const GLShaderBindingLayout& bindingLayout) override;
+        bool IsLinkCompleted() const override;
         void QueryInfoLogs(Report& report) override;
 
     private:
 
-        // Binds the specified separable shaders to this program pipeline and their respective pipeline stages.
-        void UseProgramStages(std::size_t numShaders, GLSeparableShader* const* shaders, GLShader::Permutation permutation);
+        // Links the specified separable shaders if necessary and binds them to this program pipeline and their respective pipeline stages.
+        void UseProgramStages(
+            std::size_t                 numShaders,
+            GLSeparableShader* const*   shaders,
+            GLShader::Permutation       permutation,
+            GLPipelineCache*            pipelineCache
+        );
 
     private:
 
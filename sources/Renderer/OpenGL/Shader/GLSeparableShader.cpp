@@ -12,6 +12,8 @@
 #include "../Ext/GLExtensions.h"
 #include "../GLTypes.h"
 #include "../GLObjectUtils.h"
+#include "../RenderState/GLPipelineCache.h"
+#include "../../../Core/CoreUtils.h"
 #include <LLGL/Utils/ForRange.h>
 
 
@@ -20,14 +22,21 @@ namespace LLGL
 
 
 GLSeparableShader::GLSeparableShader(const ShaderDescriptor& desc) :
-    GLShader { /*isSeparable:*/ true, desc }
+    GLShader            { /*isSeparable:*/ true, desc      },
+    intermediateShader_ { MakeUnique<GLLegacyShader>(desc) }
 {
-    GLLegacyShader intermediateShader{ desc };
-    if (CreateAndLinkSeparableGLProgram(intermediateShader, PermutationDefault))
-    {
-        if (intermediateShader.GetID(PermutationFlippedYPosition) != 0)
-            CreateAndLinkSeparableGLProgram(intermediateShader, PermutationFlippedYPosition);
-    }
+    /* Create separable GL programs now, so their IDs are available to GLPipelineSignature, but defer linking */
+    CreateSeparableGLProgram(PermutationDefault);
+    if (intermediateShader_->GetID(PermutationFlippedYPosition) != intermediateShader_->GetID(PermutationDefault))
+        CreateSeparableGLProgram(PermutationFlippedYPosition);
+
+    /* Report compile status of intermediate shader until programs are linked */
+    SetReportPending();
+
+    #ifdef LLGL_ENABLE_SPIRV_REFLECT
+    /* Keep SPIR-V reflection since the intermediate shader is released once the programs are linked */
+    ShareSpirvReflection(*intermediateShader_);
+    #endif
 
     if (desc.debugName != nullptr)
         SetDebugName(desc.debugName);
@@ -35,6 +44,8 @@ GLSeparableShader::GLSeparableShader(const ShaderDescriptor& desc) :
 
 GLSeparableShader::~GLSeparableShader()
 {
+    if (GetID(PermutationFlippedYPosition) != GetID(PermutationDefault))
+        glDeleteProgram(GetID(PermutationFlippedYPosition));
     glDeleteProgram(GetID());
 }
 
@@ -45,23 +56,72 @@ void GLSeparableShader::SetDebugName(const char* name)
 
 bool GLSeparableShader::Reflect(ShaderReflection& reflection) const
 {
+    #ifdef LLGL_ENABLE_SPIRV_REFLECT
+    /* Reflect SPIR-V module directly without linking the programs */
+    if (ReflectSpirv(reflection))
+        return true;
+    #endif
+
+    /* Reflection requires a linked program; Linking only modifies the internal GL objects */
+    const_cast<GLSeparableShader*>(this)->LinkPrograms();
     GLShaderProgram::QueryReflection(GetID(), GetGLType(), reflection);
     return true;
 }
 
+void GLSeparableShader::LinkPrograms(GLPipelineCache* pipelineCache)
+{
+    if (intermediateShader_)
+    {
+        const bool hasPermutationFlippedYPosition = (GetID(PermutationFlippedYPosition) != GetID(PermutationDefault));
+        if (GLShader::HasParallelShaderCompile())
+        {
+            /* Link all permutations in the background and query their status when the report is requested */
+            LinkSeparableGLProgram(PermutationDefault, pipelineCache);
+            if (hasPermutationFlippedYPosition)
+                LinkSeparableGLProgram(PermutationFlippedYPosition, pipelineCache);
+            pendingPipelineCache_ = pipelineCache;
+            SetReportPending();
+        }
+        else
+        {
+            LinkSeparableGLProgram(PermutationDefault, pipelineCache);
+            if (FinalizeSeparableGLProgram(PermutationDefault, pipelineCache) && hasPermutationFlippedYPosition)
+            {
+                LinkSeparableGLProgram(PermutationFlippedYPosition, pipelineCache);
+                FinalizeSeparableGLProgram(PermutationFlippedYPosition, pipelineCache);
+            }
+        }
+
+        /* Intermediate GL shader objects are no longer needed */
+        intermediateShader_.reset();
+    }
+}
+
+bool GLSeparableShader::IsLinkCompleted() const
+{
+    return
+    (
+        GLShaderProgram::GetCompletionStatus(GetID(PermutationDefault)) &&
+        GLShaderProgram::GetCompletionStatus(GetID(PermutationFlippedYPosition))
+    );
+}
+
 void GLSeparableShader::BindResourceSlots(const GLShaderBindingLayout& bindingLayout)
 {
     if (bindingLayout_ != &bindingLayout)
     {
+        LinkPrograms();
         bindingLayout.UniformAndBlockBinding(GetID());
-        if (GLuint id = GetID(PermutationFlippedYPosition))
-            bindingLayout.UniformAndBlockBinding(id);
+        if (GetID(PermutationFlippedYPosition) != GetID(PermutationDefault))
+            bindingLayout.UniformAndBlockBinding(GetID(PermutationFlippedYPosition));
         bindingLayout_ = &bindingLayout;
     }
 }
 
 void GLSeparableShader::QueryInfoLog(std::string& text, bool& hasErrors)
 {
+    LinkPrograms();
+    FlushPendingReport();
     if (!GLShaderProgram::GetLinkStatus(GetID()))
         hasErrors = true;
     text += GLShaderProgram::GetGLProgramLog(GetID());
@@ -72,27 +132,49 @@ void GLSeparableShader::QueryInfoLog(std::string& text, bool& hasErrors)
  * ======= Private: =======
  */
 
-static GLuint CreateSeparableGLProgram()
+void GLSeparableShader::QueryPendingReport()
 {
-    if (const GLuint program = glCreateProgram())
+    if (intermediateShader_)
     {
-        glProgramParameteri(program, GL_PROGRAM_SEPARABLE, GL_TRUE);
-        return program;
+        /* Programs have not been linked yet, so report the compile status of the intermediate shader */
+        if (const Report* report = intermediateShader_->GetReport())
+            ReportStatusAndLog(!report->HasErrors(), report->GetText());
+    }
+    else if (FinalizeSeparableGLProgram(PermutationDefault, pendingPipelineCache_))
+    {
+        /* Query status of programs that were linked in the background */
+        if (GetID(PermutationFlippedYPosition) != GetID(PermutationDefault))
+            FinalizeSeparableGLProgram(PermutationFlippedYPosition, pendingPipelineCache_);
+        pendingPipelineCache_ = nullptr;
     }
-    return 0;
 }
 
-bool GLSeparableShader::CreateAndLinkSeparableGLProgram(GLLegacyShader& intermediateShader, Permutation permutation)
+void GLSeparableShader::CreateSeparableGLProgram(Permutation permutation)
 {
-    /* Create new separable GL program for current permutation */
-    const GLuint program = CreateSeparableGLProgram();
+    /* Create new separable GL program for specified permutation and take over hash of intermediate shader source */
+    const GLuint program = glCreateProgram();
+    glProgramParameteri(program, GL_PROGRAM_SEPARABLE, GL_TRUE);
     SetID(program, permutation);
+    SetHash(intermediateShader_->GetHash(permutation), permutation);
+}
+
+void GLSeparableShader::LinkSeparableGLProgram(Permutation permutation, GLPipelineCache* pipelineCache)
+{
+    const GLuint program = GetID(permutation);
+
+    /* Try to load cached program binary first */
+    if (pipelineCache != nullptr)
+    {
+        if (pipelineCache->ProgramBinary(GLPipelineCache::GetSeparableProgramKey(*this, permutation), program))
+            return;
+        GLPipelineCache::HintProgramBinaryRetrievable(program);
+    }
 
-    /* Compile and attach intermediate GL shader object */
-    const GLuint shader = intermediateShader.GetID(permutation);
+    /* Attach intermediate GL shader object */
+    const GLuint shader = intermediateShader_->GetID(permutation);
     glAttachShader(program, shader);
 
-    switch (intermediateShader.GetType())
+    switch (intermediateShader_->GetType())
     {
         case ShaderType::Vertex:
             /* Build input layout for vertex shader */
@@ -117,11 +199,23 @@ bool GLSeparableShader::CreateAndLinkSeparableGLProgram(GLLegacyShader& intermed
 
     /* Detach intermediate shader before it gets deleted */
     glDetachShader(program, shader);
+}
 
+bool GLSeparableShader::FinalizeSeparableGLProgram(Permutation permutation, GLPipelineCache* pipelineCache)
+{
     /* Query link status and log */
+    const GLuint program = GetID(permutation);
     const bool status = GLShaderProgram::GetLinkStatus(program);
     ReportStatusAndLog(status, GLShaderProgram::GetGLProgramLog(program));
 
+    /* Store program binary in pipeline cache unless it was loaded from there */
+    if (status && pipelineCache != nullptr)
+    {
+        const std::uint64_t cacheKey = GLPipelineCache::GetSeparableProgramKey(*this, permutation);
+        if (!pipelineCache->HasProgramBinary(cacheKey))
+            pipelineCache->GetProgramBinary(cacheKey, program);
+    }
+
     return status;
 }
 
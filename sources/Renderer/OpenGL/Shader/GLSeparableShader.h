@@ -11,6 +11,7 @@
 
 #include "GLShader.h"
 #include <LLGL/Report.h>
+#include <memory>
 
 
 namespace LLGL
@@ -19,8 +20,13 @@ namespace LLGL
 
 class GLLegacyShader;
 class GLShaderBindingLayout;
+class GLPipelineCache;
 
-// Shader implementation for separable GL shader programs; requires GL_ARB_separate_shader_objects extension.
+/*
+Shader implementation for separable GL shader programs; requires GL_ARB_separate_shader_objects extension.
+The shader source is compiled on construction, but the separable programs are linked when they are first used,
+so their binaries can be loaded from the pipeline cache of the first PSO that uses this shader.
+*/
 class GLSeparableShader final : public GLShader
 {
 
@@ -34,6 +40,12 @@ class GLSeparableShader final : public GLShader
         GLSeparableShader(const ShaderDescriptor& desc);
         ~GLSeparableShader();
 
+        // Links the separable GL programs if they have not been linked yet. Program binaries are loaded from and stored in the optional pipeline cache.
+        void LinkPrograms(GLPipelineCache* pipelineCache = nullptr);
+
+        // Returns true if the driver has finished linking the separable GL programs. See GLShaderProgram::GetCompletionStatus.
+        bool IsLinkCompleted() const;
+
         // Binds the resource names to their respective binding slots for this separable shader. Also implemented in GLShaderProgram.
         void BindResourceSlots(const GLShaderBindingLayout& bindingLayout);
 
@@ -42,11 +54,19 @@ class GLSeparableShader final : public GLShader
 
     private:
 
-        bool CreateAndLinkSeparableGLProgram(GLLegacyShader& intermediateShader, Permutation permutation);
+        void QueryPendingReport() override;
+
+    private:
+
+        void CreateSeparableGLProgram(Permutation permutation);
+        void LinkSeparableGLProgram(Permutation permutation, GLPipelineCache* pipelineCache);
+        bool FinalizeSeparableGLProgram(Permutation permutation, GLPipelineCache* pipelineCache);
 
     private:
 
-        const GLShaderBindingLayout* bindingLayout_ = nullptr;
+        std::unique_ptr<GLLegacyShader> intermediateShader_;                // Compiled GL shader objects; Released once the programs are linked.
+        GLPipelineCache*                pendingPipelineCache_   = nullptr;  // Pipeline cache for programs that are still linked in the background.
+        const GLShaderBindingLayout*    bindingLayout_          = nullptr;
 
 };
 
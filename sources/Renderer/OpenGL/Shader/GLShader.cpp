@@ -9,15 +9,23 @@
 #include "GLShaderSourcePatcher.h"
 #include "../GLTypes.h"
 #include "../GLObjectUtils.h"
+#include "../RenderState/GLPipelineCache.h"
 #include "../Ext/GLExtensions.h"
 #include "../Ext/GLExtensionRegistry.h"
 #include "../../../Core/CoreUtils.h"
 #include "../../../Core/Exception.h"
 #include "../../../Core/ReportUtils.h"
 #include <LLGL/Utils/ForRange.h>
+#include <LLGL/ShaderReflection.h>
 #include <vector>
 #include <stdexcept>
 #include <algorithm>
+#include <memory>
+#include <string.h>
+
+#ifdef LLGL_ENABLE_SPIRV_REFLECT
+#   include "../../SPIRV/SpirvShaderReflection.h"
+#endif
 
 
 namespace LLGL
@@ -36,6 +44,9 @@ GLShader::GLShader(const bool isSeparable, const ShaderDescriptor& desc) :
 
 const Report* GLShader::GetReport() const
 {
+    /* Status of background compilation is only queried when it's requested; Only modifies the report */
+    if (isReportPending_)
+        const_cast<GLShader*>(this)->FlushPendingReport();
     return (report_ ? &report_ : nullptr);
 }
 
@@ -112,6 +123,11 @@ bool GLShader::HasAnyShaderPermutation(Permutation permutation, const ArrayView<
     return false;
 }
 
+bool GLShader::HasParallelShaderCompile()
+{
+    return (HasExtension(GLExt::KHR_parallel_shader_compile) || HasExtension(GLExt::ARB_parallel_shader_compile));
+}
+
 void GLShader::PatchShaderSource(
     const ShaderSourceCallback& sourceCallback,
     const char*                 shaderSource,
@@ -139,6 +155,44 @@ void GLShader::PatchShaderSource(
     );
 }
 
+// Maximum number of shader source patchers that are kept for re-use.
+static constexpr std::size_t g_maxCachedSourcePatchers = 8;
+
+/*
+Returns the source patcher for the specified shader source. Patchers are cached by their source hash in least-recently-used order,
+so the shader permutations of the same source are only scanned once. Shaders are only patched on the GL context thread.
+*/
+static GLShaderSourcePatcher& GetCachedShaderSourcePatcher(const char* source)
+{
+    struct CachedSourcePatcher
+    {
+        std::uint64_t                           hash;
+        std::unique_ptr<GLShaderSourcePatcher>  patcher;
+    };
+
+    static std::vector<CachedSourcePatcher> cachedPatchers;
+
+    const std::uint64_t hash = GLPipelineCache::HashBytes(source, ::strlen(source));
+
+    for (auto it = cachedPatchers.begin(); it != cachedPatchers.end(); ++it)
+    {
+        if (it->hash == hash && it->patcher->MatchesSource(source))
+        {
+            /* Move patcher to the end of the list as most recently used entry */
+            if (it + 1 != cachedPatchers.end())
+                std::rotate(it, it + 1, cachedPatchers.end());
+            return *(cachedPatchers.back().patcher);
+        }
+    }
+
+    /* Evict least recently used patcher if there are too many */
+    if (cachedPatchers.size() >= g_maxCachedSourcePatchers)
+        cachedPatchers.erase(cachedPatchers.begin());
+
+    cachedPatchers.push_back(CachedSourcePatcher{ hash, MakeUnique<GLShaderSourcePatcher>(source) });
+    return *(cachedPatchers.back().patcher);
+}
+
 void GLShader::PatchShaderSourceWithOptions(
     const ShaderSourceCallback& sourceCallback,
     const char*                 source,
@@ -154,14 +208,15 @@ void GLShader::PatchShaderSourceWithOptions(
         const bool hasVersionOverride   = (versionOverride != nullptr && *versionOverride != '\0');
         if (hasDefines || pragmaOptimizeOff || hasVertexStmt || hasVersionOverride)
         {
-            GLShaderSourcePatcher patcher{ source };
+            GLShaderSourcePatcher& patcher = GetCachedShaderSourcePatcher(source);
+            patcher.ResetPatches();
             if (hasVersionOverride)
                 patcher.OverrideVersion(versionOverride);
             patcher.AddDefines(defines);
             if (pragmaOptimizeOff)
                 patcher.AddPragmaDirective("optimize(off)");
             patcher.AddFinalVertexTransformStatements(vertexTransformStmt);
-            sourceCallback(patcher.GetSource());
+            sourceCallback(patcher.GetPatchedSource());
         }
         else
             sourceCallback(source);
@@ -171,8 +226,88 @@ void GLShader::PatchShaderSourceWithOptions(
 void GLShader::ReportStatusAndLog(bool status, const std::string& log)
 {
     ResetReportWithNewline(report_, log.c_str(), !status);
+    isReportPending_ = false;
+}
+
+void GLShader::FlushPendingReport()
+{
+    if (isReportPending_)
+    {
+        isReportPending_ = false;
+        QueryPendingReport();
+    }
 }
 
+void GLShader::QueryPendingReport()
+{
+    // dummy
+}
+
+static std::uint64_t HashString(const char* s, std::uint64_t hash)
+{
+    return GLPipelineCache::HashBytes(s, ::strlen(s) + 1, hash);
+}
+
+void GLShader::HashShaderSource(Permutation permutation, const void* source, std::size_t sourceSize, const char* entryPoint)
+{
+    /* Hash shader type and all attributes that are bound before a GL program is linked */
+    const std::uint32_t shaderType = static_cast<std::uint32_t>(GetType());
+    std::uint64_t hash = GLPipelineCache::HashBytes(&shaderType, sizeof(shaderType));
+
+    for (const GLShaderAttribute& attrib : shaderAttribs_)
+    {
+        hash = GLPipelineCache::HashBytes(&(attrib.index), sizeof(attrib.index), hash);
+        hash = HashString(attrib.name, hash);
+    }
+
+    for (const char* varying : transformFeedbackVaryings_)
+        hash = HashString(varying, hash);
+
+    /* Hash shader source and entry point */
+    hash = GLPipelineCache::HashBytes(source, sourceSize, hash);
+    if (entryPoint != nullptr)
+        hash = HashString(entryPoint, hash);
+
+    SetHash(hash, permutation);
+}
+
+#ifdef LLGL_ENABLE_SPIRV_REFLECT
+
+void GLShader::BuildSpirvReflection(const void* binary, std::size_t binarySize)
+{
+    /* Copy SPIR-V words before reflecting them, since the reflection refers to the names within the module */
+    auto spirvReflection = std::make_shared<SpirvModuleReflection>();
+    {
+        spirvReflection->words.resize(binarySize / sizeof(std::uint32_t));
+        ::memcpy(spirvReflection->words.data(), binary, spirvReflection->words.size() * sizeof(std::uint32_t));
+    }
+    if (spirvReflection->reflection.Reflect(SpirvModuleView{ spirvReflection->words }) == SpirvResult::NoError)
+        spirvReflection_ = std::move(spirvReflection);
+    else
+        spirvReflection_.reset();
+}
+
+void GLShader::ShareSpirvReflection(const GLShader& other)
+{
+    spirvReflection_ = other.spirvReflection_;
+}
+
+bool GLShader::ReflectSpirv(ShaderReflection& reflection) const
+{
+    if (!spirvReflection_)
+        return false;
+
+    BuildSpirvShaderReflection(spirvReflection_->reflection, GetType(), reflection);
+
+    /* GL has no descriptor sets; Resources are only identified by their binding index */
+    for (ShaderResourceReflection& resource : reflection.resources)
+        resource.binding.slot.set = 0;
+
+    return true;
+}
+
+#endif // /LLGL_ENABLE_SPIRV_REFLECT
+
 
 /*
  * ======= Private: =======
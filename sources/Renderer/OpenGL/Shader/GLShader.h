@@ -14,6 +14,12 @@
 #include "../OpenGL.h"
 #include "../../../Core/LinearStringContainer.h"
 #include <functional>
+#include <cstdint>
+
+#ifdef LLGL_ENABLE_SPIRV_REFLECT
+#   include "../../SPIRV/SpirvReflect.h"
+#   include <memory>
+#endif
 
 
 namespace LLGL
@@ -77,6 +83,12 @@ class GLShader : public Shader
             return (id_[permutation] != 0 ? id_[permutation] : id_[PermutationDefault]);
         }
 
+        // Returns the hash of the patched shader source and layout for the specified permutation or the default permutation if the specified one is not available.
+        inline std::uint64_t GetHash(Permutation permutation) const
+        {
+            return (hash_[permutation] != 0 ? hash_[permutation] : hash_[PermutationDefault]);
+        }
+
         // Returns true if this is a separable shader, i.e. of type <GLSeparableShader>. Otherwise, it's of type <GLLegacyShader>.
         inline bool IsSeparable() const
         {
@@ -91,6 +103,9 @@ class GLShader : public Shader
         // Returns true if any of the specified shaders has the specified permutation.
         static bool HasAnyShaderPermutation(Permutation permutation, const ArrayView<Shader*>& shaders);
 
+        // Returns true if the compile and link status can be polled without blocking, i.e. GL_KHR_parallel_shader_compile or GL_ARB_parallel_shader_compile is supported.
+        static bool HasParallelShaderCompile();
+
         // Patches the shader source and invokes the callback with the preprocessed shader. See ShaderCompileFlags.
         static void PatchShaderSource(
             const ShaderSourceCallback& sourceCallback,
@@ -116,12 +131,59 @@ class GLShader : public Shader
         // Resets the report with the specified compile/link status and log.
         void ReportStatusAndLog(bool status, const std::string& log);
 
+        // Marks the report as pending, i.e. the compile/link status is queried the first time the report is requested. See QueryPendingReport.
+        inline void SetReportPending()
+        {
+            isReportPending_ = true;
+        }
+
+        // Queries the pending report if there is one. This blocks until the driver has finished compiling or linking.
+        void FlushPendingReport();
+
+        // Queries the compile/link status for a pending report. Must be implemented by sub classes that call SetReportPending.
+        virtual void QueryPendingReport();
+
         // Stores the native shader ID.
         inline void SetID(GLuint id, Permutation permutation = PermutationDefault)
         {
             id_[permutation] = id;
         }
 
+        // Stores the hash of the shader source for the specified permutation. This hash must be stable across application runs.
+        inline void SetHash(std::uint64_t hash, Permutation permutation = PermutationDefault)
+        {
+            hash_[permutation] = hash;
+        }
+
+        // Stores the hash of the specified shader source (or binary) combined with this shader's type and vertex/fragment layout for the specified permutation.
+        void HashShaderSource(Permutation permutation, const void* source, std::size_t sourceSize, const char* entryPoint = nullptr);
+
+        #ifdef LLGL_ENABLE_SPIRV_REFLECT
+
+        // Reflects the specified SPIR-V module once and keeps a copy of it, since the reflection refers to the names within the module.
+        void BuildSpirvReflection(const void* binary, std::size_t binarySize);
+
+        // Shares the SPIR-V reflection of another shader, e.g. the intermediate shader of a separable shader.
+        void ShareSpirvReflection(const GLShader& other);
+
+        // Converts the SPIR-V reflection into the output reflection. Returns false if this shader was not loaded from a valid SPIR-V module.
+        bool ReflectSpirv(ShaderReflection& reflection) const;
+
+        #endif // /LLGL_ENABLE_SPIRV_REFLECT
+
+    private:
+
+        #ifdef LLGL_ENABLE_SPIRV_REFLECT
+
+        // SPIR-V module and its reflection that is shared between a separable shader and its intermediate shader.
+        struct SpirvModuleReflection
+        {
+            std::vector<std::uint32_t>  words;
+            SpirvReflect                reflection;
+        };
+
+        #endif // /LLGL_ENABLE_SPIRV_REFLECT
+
     private:
 
         void ReserveAttribs(const ShaderDescriptor& desc);
@@ -133,11 +195,17 @@ class GLShader : public Shader
 
         const bool                      isSeparable_;
         GLuint                          id_[PermutationCount]       = {}; // ID from either glCreateShader or glCreateShaderProgramv
+        std::uint64_t                   hash_[PermutationCount]     = {}; // Hash of patched source; Used as key for program binaries in GLPipelineCache
         LinearStringContainer           shaderAttribNames_;
         std::vector<GLShaderAttribute>  shaderAttribs_;
         std::size_t                     numVertexAttribs_           = 0;
         std::vector<const char*>        transformFeedbackVaryings_;
         Report                          report_;
+        bool                            isReportPending_            = false;
+
+        #ifdef LLGL_ENABLE_SPIRV_REFLECT
+        std::shared_ptr<const SpirvModuleReflection> spirvReflection_;
+        #endif
 
 };
 
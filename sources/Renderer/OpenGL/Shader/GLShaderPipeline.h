@@ -39,7 +39,10 @@ class GLShaderPipeline
         // Binds the resource names to their respective binding slots for this pipeline.
         virtual void BindResourceSlots(const GLShaderBindingLayout& bindingLayout) = 0;
 
-        // Resets the output report with the shader info logs.
+        // Returns true if the driver has finished linking this pipeline. This is only false while it's linked in the background; See GL_KHR_parallel_shader_compile.
+        virtual bool IsLinkCompleted() const = 0;
+
+        // Resets the output report with the shader info logs. This blocks until the pipeline has been linked.
         virtual void QueryInfoLogs(Report& report) = 0;
 
         // Returns the native pipeline ID. Can be either from glCreateProgramPipelines or glCreateProgram.
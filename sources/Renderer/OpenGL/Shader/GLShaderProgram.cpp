@@ -8,6 +8,7 @@
 #include "GLShaderProgram.h"
 #include "GLLegacyShader.h"
 #include "GLShaderBindingLayout.h"
+#include "GLShaderUniform.h"
 #include "../GLTypes.h"
 #include "../GLObjectUtils.h"
 #include "../RenderState/GLStateManager.h"
@@ -20,6 +21,8 @@
 #include <LLGL/VertexAttribute.h>
 #include <LLGL/Constants.h>
 #include <LLGL/Utils/ForRange.h>
+#include <LLGL/Container/DynamicVector.h>
+#include <LLGL/Container/MemoryArena.h>
 #include <vector>
 #include <stdexcept>
 
@@ -93,10 +96,17 @@ GLShaderProgram::GLShaderProgram(
     /* Try to load cached program binary first */
     if (pipelineCache != nullptr)
     {
-        if (!(pipelineCache->HasProgramBinary(permutation) && pipelineCache->ProgramBinary(permutation, GetID())))
+        const std::uint64_t cacheKey = GLPipelineCache::GetProgramKey(numShaders, shaders, permutation);
+        if (!pipelineCache->ProgramBinary(cacheKey, GetID()))
         {
+            GLPipelineCache::HintProgramBinaryRetrievable(GetID());
             BuildProgramBinary(numShaders, shaders, permutation);
-            pipelineCache->GetProgramBinary(permutation, GetID());
+
+            /* Store program binary when the info logs are queried if the program is linked in the background */
+            pendingPipelineCache_   = pipelineCache;
+            pendingCacheKey_        = cacheKey;
+            if (!GLShader::HasParallelShaderCompile())
+                StorePendingProgramBinary();
         }
     }
     else
@@ -109,6 +119,7 @@ GLShaderProgram::GLShaderProgram(
 GLShaderProgram::~GLShaderProgram()
 {
     glDeleteProgram(GetID());
+    GLReleaseUniformCache(GetID());
     GLStateManager::Get().NotifyShaderProgramRelease(this);
     #ifdef __APPLE__
     if (hasNullFragmentShader_)
@@ -127,11 +138,20 @@ void GLShaderProgram::BindResourceSlots(const GLShaderBindingLayout& bindingLayo
     {
         bindingLayout.UniformAndBlockBinding(GetID());
         bindingLayout_ = &bindingLayout;
+
+        /* Sampler uniforms have been rewritten bypassing the uniform cache */
+        GLReleaseUniformCache(GetID());
     }
 }
 
+bool GLShaderProgram::IsLinkCompleted() const
+{
+    return GLShaderProgram::GetCompletionStatus(GetID());
+}
+
 void GLShaderProgram::QueryInfoLogs(Report& report)
 {
+    StorePendingProgramBinary();
     const bool hasErrors = !GLShaderProgram::GetLinkStatus(GetID());
     std::string log = GLShaderProgram::GetGLProgramLog(GetID());
     report.Reset(std::move(log), hasErrors);
@@ -144,6 +164,19 @@ bool GLShaderProgram::GetLinkStatus(GLuint program)
     return (status != GL_FALSE);
 }
 
+bool GLShaderProgram::GetCompletionStatus(GLuint program)
+{
+    #ifdef GL_KHR_parallel_shader_compile
+    if (GLShader::HasParallelShaderCompile())
+    {
+        GLint status = 0;
+        glGetProgramiv(program, GL_COMPLETION_STATUS_KHR, &status);
+        return (status != GL_FALSE);
+    }
+    #endif
+    return true;
+}
+
 std::string GLShaderProgram::GetGLProgramLog(GLuint program)
 {
     /* Query info log length */
@@ -272,13 +305,16 @@ void GLShaderProgram::LinkProgram(GLuint program)
     glLinkProgram(program);
 }
 
+// Temporary buffer for reflected names; allocated from the current memory arena if the caller bound one via ScopedMemoryArena.
+using GLNameBuffer = DynamicVector<char, ArenaAllocator<char>>;
+
 static bool GLQueryActiveAttribs(
     GLuint              program,
     GLenum              attribCountType,
     GLenum              attribNameLengthType,
     GLint&              numAttribs,
     GLint&              maxNameLength,
-    std::vector<char>&  nameBuffer)
+    GLNameBuffer&       nameBuffer)
 {
     /* Query number of active attributes */
     glGetProgramiv(program, attribCountType, &numAttribs);
@@ -394,7 +430,7 @@ struct GLReflectVertexAttribute
 static void GLQueryVertexAttributes(GLuint program, ShaderReflection& reflection)
 {
     /* Query active vertex attributes */
-    std::vector<char> attribName;
+    GLNameBuffer attribName;
     GLint numAttribs = 0, maxNameLength = 0;
     if (!GLQueryActiveAttribs(program, GL_ACTIVE_ATTRIBUTES, GL_ACTIVE_ATTRIBUTE_MAX_LENGTH, numAttribs, maxNameLength, attribName))
         return;
@@ -471,7 +507,7 @@ static void GLQueryStreamOutputAttributes(GLuint program, ShaderReflection& refl
     #endif
     {
         /* Query active varyings */
-        std::vector<char> attribName;
+        GLNameBuffer attribName;
         GLint numVaryings = 0, maxNameLength = 0;
         if (!GLQueryActiveAttribs(program, GL_TRANSFORM_FEEDBACK_VARYINGS, GL_TRANSFORM_FEEDBACK_VARYING_MAX_LENGTH, numVaryings, maxNameLength, attribName))
             return;
@@ -504,7 +540,7 @@ static void GLQueryStreamOutputAttributes(GLuint program, ShaderReflection& refl
     else if (HasExtension(GLExt::NV_transform_feedback))
     {
         /* Query active varyings */
-        std::vector<char> attribName;
+        GLNameBuffer attribName;
         GLint numVaryings = 0, maxNameLength = 0;
         if (!GLQueryActiveAttribs(program, GL_ACTIVE_VARYINGS_NV, GL_ACTIVE_VARYING_MAX_LENGTH_NV, numVaryings, maxNameLength, attribName))
             return;
@@ -628,7 +664,7 @@ static void GLQueryConstantBuffers(GLuint program, ShaderReflection& reflection)
         return;
 
     /* Query active uniform blocks */
-    std::vector<char> blockName;
+    GLNameBuffer blockName;
     GLint numUniformBlocks = 0, maxNameLength = 0;
     if (!GLQueryActiveAttribs(program, GL_ACTIVE_UNIFORM_BLOCKS, GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH, numUniformBlocks, maxNameLength, blockName))
         return;
@@ -685,7 +721,7 @@ static void GLQueryStorageBuffers(GLuint program, ShaderReflection& reflection)
     if (maxNameLength <= 0)
         return;
 
-    std::vector<char> blockName(maxNameLength, 0);
+    GLNameBuffer blockName(static_cast<std::size_t>(maxNameLength), '\0');
 
     /* Iterate over all shader storage blocks */
     for_range(i, static_cast<GLuint>(numStorageBlocks))
@@ -713,7 +749,7 @@ static void GLQueryStorageBuffers(GLuint program, ShaderReflection& reflection)
 static void GLQueryUniforms(GLuint program, ShaderReflection& reflection)
 {
     /* Query active uniforms */
-    std::vector<char> uniformName;
+    GLNameBuffer uniformName;
     GLint numUniforms = 0, maxNameLength = 0;
     if (!GLQueryActiveAttribs(program, GL_ACTIVE_UNIFORMS, GL_ACTIVE_UNIFORM_MAX_LENGTH, numUniforms, maxNameLength, uniformName))
         return;
@@ -888,6 +924,16 @@ static void AttachGLLegacyShaders(
     }
 }
 
+void GLShaderProgram::StorePendingProgramBinary()
+{
+    if (pendingPipelineCache_ != nullptr)
+    {
+        if (GLShaderProgram::GetLinkStatus(GetID()))
+            pendingPipelineCache_->GetProgramBinary(pendingCacheKey_, GetID());
+        pendingPipelineCache_ = nullptr;
+    }
+}
+
 void GLShaderProgram::BuildProgramBinary(
     std::size_t             numShaders,
     const Shader* const*    shaders,
@@ -29,6 +29,7 @@ class GLShaderProgram final : public GLShaderPipeline
 
         void Bind(GLStateManager& stateMngr) override;
         void BindResourceSlots(const GLShaderBindingLayout& bindingLayout) override;
+        bool IsLinkCompleted() const override;
         void QueryInfoLogs(Report& report) override;
 
     public:
@@ -46,6 +47,9 @@ class GLShaderProgram final : public GLShaderPipeline
         // Returns true if the native GL shader program was linked successfully.
         static bool GetLinkStatus(GLuint program);
 
+        // Returns true if the driver has finished linking the native GL shader program. Always true if GL_KHR_parallel_shader_compile is not supported.
+        static bool GetCompletionStatus(GLuint program);
+
         // Returns the native GL shader program log.
         static std::string GetGLProgramLog(GLuint program);
 
@@ -73,9 +77,14 @@ class GLShaderProgram final : public GLShaderPipeline
             GLShader::Permutation   permutation
         );
 
+        // Stores the program binary in the pipeline cache once linking has completed.
+        void StorePendingProgramBinary();
+
     private:
 
         const GLShaderBindingLayout*    bindingLayout_          = nullptr;
+        GLPipelineCache*                pendingPipelineCache_   = nullptr;
+        std::uint64_t                   pendingCacheKey_        = 0;
 
         #ifdef __APPLE__
         bool                            hasNullFragmentShader_  = false;
@@ -16,156 +16,117 @@ namespace LLGL
 
 static bool IsWhitespace(char c)
 {
-    return c == ' ' || c == '\t';
+    return c == ' ' || c == '\t' || c == '\r';
 }
 
-static bool ScanToken(const char*& s, char tokenChar)
+static bool IsIdentifierStart(char c)
 {
-    if (s[0] == tokenChar)
-    {
-        s += 1;
-        return true;
-    }
-    return false;
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
 }
 
-static bool ScanToken(const char*& s, char tokenChar0, char tokenChar1)
+static bool IsIdentifierChar(char c)
 {
-    if (s[0] == tokenChar0 && s[1] == tokenChar1)
-    {
-        s += 2;
-        return true;
-    }
-    return false;
+    return IsIdentifierStart(c) || (c >= '0' && c <= '9');
 }
 
-static bool ScanToken(const char*& s, const char* token)
+static bool ScanToken(const char*& s, char tokenChar0, char tokenChar1)
 {
-    const auto tokenLen = ::strlen(token);
-    if (::strncmp(s, token, tokenLen) == 0)
+    if (s[0] == tokenChar0 && s[1] == tokenChar1)
     {
-        s += tokenLen;
+        s += 2;
         return true;
     }
     return false;
 }
 
-static void SkipUntilToken(const char*& s, char tokenChar)
-{
-    while (*s != '\0' && !ScanToken(s, tokenChar))
-        ++s;
-}
-
-static void SkipUntilToken(const char*& s, char tokenChar0, char tokenChar1)
-{
-    while (*s != '\0' && !ScanToken(s, tokenChar0, tokenChar1))
-        ++s;
-}
-
 static void SkipWhitespaces(const char*& s)
 {
     while (IsWhitespace(*s))
         ++s;
 }
 
-static bool SkipComment(const char*& s)
+// Skips the comment at the specified position and returns true if the comment contained a newline character.
+static bool SkipComment(const char*& s, const char*& lastNewline)
 {
-    if (ScanToken(s, "//"))
+    bool hasNewline = false;
+    if (ScanToken(s, '/', '/'))
     {
-        /* Ignore single line comment */
-        SkipUntilToken(s, '\n');
-        return true;
+        /* Ignore single line comment, but keep the newline character for the caller */
+        while (*s != '\0' && *s != '\n')
+            ++s;
     }
-    else if (ScanToken(s, "/*"))
+    else if (ScanToken(s, '/', '*'))
     {
         /* Ignore multi line comment */
-        SkipUntilToken(s, '*', '/');
-        return true;
+        while (*s != '\0' && !ScanToken(s, '*', '/'))
+        {
+            if (*s == '\n')
+            {
+                lastNewline = s;
+                hasNewline = true;
+            }
+            ++s;
+        }
     }
-    return false;
+    return hasNewline;
 }
 
-// Returns the source position that starts with the '#' character beginning the search from 'off' backwards.
-static std::size_t FindStartOfDirective(const char* source, std::size_t off)
+static bool IsComment(const char* s)
 {
-    do
-    {
-        if (source[off] == '#')
-            return off;
-    }
-    while (off-- > 0);
-    return std::string::npos;
+    return (s[0] == '/' && (s[1] == '/' || s[1] == '*'));
 }
 
-// Returns the source position after the '#version'-directive. This is always at the beginning of a new line.
-static std::size_t FindEndOfVersionDirective(const char* source)
+// Scans the identifier at the specified position and returns its length.
+static std::size_t ScanIdentifier(const char*& s)
 {
-    const char* s = source;
-    while (*s != '\0')
-    {
-        if (SkipComment(s))
-        {
-            /* Ignore comments */
-            continue;
-        }
-        else if (ScanToken(s, "#"))
-        {
-            /* Ignore whitespaces after '#' token */
-            SkipWhitespaces(s);
+    const char* start = s;
+    while (IsIdentifierChar(*s))
+        ++s;
+    return static_cast<std::size_t>(s - start);
+}
 
-            /* Scan for "version" token */
-            if (ScanToken(s, "version"))
-            {
-                /* There has to be at least one more whitespace */
-                if (IsWhitespace(*s))
-                {
-                    /* Jump to end of line */
-                    for (++s; *s != '\0'; ++s)
-                    {
-                        if (ScanToken(s, '\n'))
-                            return static_cast<std::size_t>(s - source);
-                    }
-                }
-            }
-        }
+static bool IsIdentifier(const char* ident, std::size_t identLen, const char* token)
+{
+    return (::strlen(token) == identLen && ::strncmp(ident, token, identLen) == 0);
+}
+
+// Skips the remainder of a preprocessor directive including line continuations. The pointer is moved to the terminating newline character.
+static void SkipDirective(const char*& s)
+{
+    const char* lastNewline = nullptr;
+    while (*s != '\0' && *s != '\n')
+    {
+        if (IsComment(s))
+            SkipComment(s, lastNewline);
+        else if (s[0] == '\\' && s[1] == '\n')
+            s += 2;
+        else if (s[0] == '\\' && s[1] == '\r' && s[2] == '\n')
+            s += 3;
         else
-        {
-            /* Move to next character */
             ++s;
-        }
     }
-    return std::string::npos;
 }
 
-GLShaderSourcePatcher::GLShaderSourcePatcher(const char* source) :
-    source_ { source }
+// Returns true if the remainder of an '#if'-directive is the constant "0".
+static bool IsDirectiveConstantZero(const char* s)
 {
-    const auto posAfterVersion = FindEndOfVersionDirective(source);
-    if (posAfterVersion != std::string::npos)
-        statementInsertPos_ = posAfterVersion;
+    SkipWhitespaces(s);
+    if (*s != '0')
+        return false;
+    ++s;
+    SkipWhitespaces(s);
+    return (*s == '\0' || *s == '\n' || IsComment(s));
 }
 
-static std::string GenerateGlslVersionDirective(const char* version)
+GLShaderSourcePatcher::GLShaderSourcePatcher(const char* source) :
+    source_ { source }
 {
-    std::string s = "#version ";
-    s += version;
-    s += '\n';
-    return s;
+    ScanSource();
 }
 
 void GLShaderSourcePatcher::OverrideVersion(const char* version)
 {
-    /* First remove current '#version'-directive (in case new one must be at first source line) */
-    const std::size_t startOfVersionDirective = FindStartOfDirective(source_.c_str(), statementInsertPos_);
-    if (startOfVersionDirective != std::string::npos)
-        source_.erase(startOfVersionDirective, statementInsertPos_ - startOfVersionDirective);
-
-    /* Generate new '#version'-directive */
-    const std::string newVersionDirective = GenerateGlslVersionDirective(version);
-    source_.insert(0, newVersionDirective);
-
-    /* Replace old insertion point for statements after new directive */
-    ResetInsertionPoints(newVersionDirective.size());
+    versionOverride_ = (version != nullptr ? version : "");
 }
 
 void GLShaderSourcePatcher::AddDefines(const ShaderMacro* defines)
@@ -173,22 +134,17 @@ void GLShaderSourcePatcher::AddDefines(const ShaderMacro* defines)
     if (defines != nullptr)
     {
         /* Generate macro definition code */
-        std::string defineCode;
-
         for (; defines->name != nullptr; ++defines)
         {
-            defineCode += "#define ";
-            defineCode += defines->name;
+            header_ += "#define ";
+            header_ += defines->name;
             if (defines->definition != nullptr)
             {
-                defineCode += ' ';
-                defineCode += defines->definition;
+                header_ += ' ';
+                header_ += defines->definition;
             }
-            defineCode += '\n';
+            header_ += '\n';
         }
-
-        /* Insert macro definitions into source */
-        InsertAfterVersionDirective(defineCode);
     }
 }
 
@@ -196,214 +152,320 @@ void GLShaderSourcePatcher::AddPragmaDirective(const char* statement)
 {
     if (statement != nullptr && *statement != '\0')
     {
-        /* Generate '#pragma'-directive code and insert into source */
-        std::string pragmaCode = "#pragma ";
-        pragmaCode += statement;
-        pragmaCode += '\n';
-        InsertAfterVersionDirective(pragmaCode);
+        /* Generate '#pragma'-directive code */
+        header_ += "#pragma ";
+        header_ += statement;
+        header_ += '\n';
     }
 }
 
-struct SourceScanState
+void GLShaderSourcePatcher::AddFinalVertexTransformStatements(const char* statement)
 {
-    std::string patched;
-    std::size_t codeBlockDepth          = 0;
-    const char* head                    = nullptr;
-    const char* lastPatched             = nullptr;
-    const char* lastToken               = nullptr;
-    const char* lastIndentRange[2]      = {};
-    const char* currentIndentRange[2]   = {};
-
-    SourceScanState(const char* source, std::size_t entryPointStartPos) :
-        head               { source + entryPointStartPos },
-        lastPatched        { source                      },
-        currentIndentRange { head, nullptr               }
+    vertexStatement_ = (statement != nullptr ? statement : "");
+}
+
+void GLShaderSourcePatcher::ResetPatches()
+{
+    versionOverride_.clear();
+    vertexStatement_.clear();
+    header_.clear();
+}
+
+const char* GLShaderSourcePatcher::GetPatchedSource()
+{
+    /* Reserve enough memory for the patched source in advance, so it's built without re-allocations */
+    std::size_t patchedSize = source_.size() + header_.size();
+    if (!versionOverride_.empty())
+        patchedSize += versionOverride_.size() + sizeof("#version \n");
+    if (!vertexStatement_.empty())
     {
+        for (const Insertion& insertion : insertions_)
+            patchedSize += vertexStatement_.size() + (insertion.indentEnd - insertion.indentBegin) + 3;
     }
 
-    void Append(const char* to)
+    patched_.clear();
+    patched_.reserve(patchedSize);
+
+    /* Append '#version'-directive and header after the original '#version'-directive or replace it */
+    std::size_t pos = 0;
+    if (!versionOverride_.empty())
+    {
+        patched_ += "#version ";
+        patched_ += versionOverride_;
+        patched_ += '\n';
+        patched_ += header_;
+        if (hasVersion_)
+        {
+            AppendSourceRange(0, versionBegin_);
+            pos = versionEnd_;
+        }
+    }
+    else
     {
-        patched.append(lastPatched, to);
-        lastPatched = to;
+        AppendSourceRange(0, versionEnd_);
+        patched_ += header_;
+        pos = versionEnd_;
     }
 
-    void AppendStatement(const char* statement, bool currentIndent = false)
+    /* Append source with vertex transform statements */
+    if (!vertexStatement_.empty())
     {
-        /* Append input source from last patched position to end of previous line (before current indentation start) */
-        Append(currentIndentRange[0]);
+        for (const Insertion& insertion : insertions_)
+        {
+            if (insertion.pos >= pos)
+            {
+                AppendSourceRange(pos, insertion.pos);
+                AppendInsertion(insertion);
+                pos = insertion.pos;
+            }
+        }
+    }
 
-        /* If last token was not the end of the current indentation range, also add everything to that last token */
-        if (lastToken != currentIndentRange[1])
-            Append(lastToken);
+    AppendSourceRange(pos, source_.size());
 
-        /* Append indentation from previous or current line */
-        if (currentIndent)
-            patched.append(currentIndentRange[0], currentIndentRange[1] - currentIndentRange[0]);
-        else
-            patched.append(lastIndentRange[0], lastIndentRange[1] - lastIndentRange[0]);
+    return patched_.c_str();
+}
 
-        /* Append statement with newline */
-        patched += statement;
-        patched += '\n';
-    }
+bool GLShaderSourcePatcher::MatchesSource(const char* source) const
+{
+    return (source_.compare(source) == 0);
+}
 
-    void AppendRemainder()
-    {
-        /* Append remaining source until current head position */
-        patched.append(lastPatched, head);
-        lastPatched = head;
-    }
-};
 
-void GLShaderSourcePatcher::AddFinalVertexTransformStatements(const char* statement)
+/*
+ * ======= Private: =======
+ */
+
+void GLShaderSourcePatcher::ScanSource()
 {
-    if (statement != nullptr && *statement != '\0')
+    enum class EntryPointState
+    {
+        None,
+        Void,       // After "void"
+        Main,       // After "void main"
+        LParen,     // After "void main("
+        RParen,     // After "void main()"
+        Body,       // Within the entry point body
+    };
+
+    const char* source          = source_.c_str();
+    const char* s               = source;
+    const char* lineBegin       = source;
+    const char* indentEnd       = source;
+    const char* lastIndent[2]   = { source, source };   // Indentation of the last line with code.
+    bool        lineHasCode     = false;                // Current line has a code token.
+    bool        lineIsClean     = true;                 // Current line has neither code tokens nor the end of a multi line comment.
+    int         inactiveDepth   = 0;                    // Depth of nested conditional directives within an "#if 0" block.
+    auto        state           = EntryPointState::None;
+    std::size_t codeBlockDepth  = 0;
+    bool        hasOpenBlock    = false;                // A 'BlockBegin' insertion is awaiting the end of its return statement.
+    char        lastCodeChar    = '\0';                 // Last scanned code character or 'a' for identifiers.
+
+    auto ToPos = [source](const char* p) -> std::size_t
     {
-        CacheEntryPointSourceLocation();
+        return static_cast<std::size_t>(p - source);
+    };
 
-        /* Scan source from entry point start location */
-        SourceScanState scan{ GetSource(), entryPointStartPos_ };
+    auto AddInsertion = [this, &ToPos](InsertionType type, const char* pos, const char* indentBegin, const char* indentEnd)
+    {
+        insertions_.push_back(Insertion{ type, ToPos(pos), ToPos(indentBegin), ToPos(indentEnd) });
+    };
 
-        for (auto& s = scan.head; *s != '\0'; scan.lastToken = scan.head)
+    while (*s != '\0')
+    {
+        if (*s == '\n')
         {
-            if (SkipComment(s))
+            /* Record indentation of the previous line if it contained code */
+            if (lineHasCode)
             {
-                /* Ignore comments */
-                continue;
+                lastIndent[0] = lineBegin;
+                lastIndent[1] = indentEnd;
             }
-            else if (scan.currentIndentRange[0] > scan.currentIndentRange[1])
+            ++s;
+            lineBegin   = s;
+            indentEnd   = s;
+            lineHasCode = false;
+            lineIsClean = true;
+            continue;
+        }
+
+        if (IsWhitespace(*s))
+        {
+            ++s;
+            if (indentEnd + 1 == s && lineIsClean && !lineHasCode)
+                indentEnd = s;
+            continue;
+        }
+
+        if (IsComment(s))
+        {
+            const char* lastNewline = nullptr;
+            if (SkipComment(s, lastNewline))
             {
-                /* Record end of current indentation */
-                if (IsWhitespace(*s))
+                /* Code after a multi line comment cannot be patched at the beginning of its line */
+                if (lineHasCode)
                 {
-                    SkipWhitespaces(s);
-                    scan.currentIndentRange[1] = scan.head;
+                    lastIndent[0] = lineBegin;
+                    lastIndent[1] = indentEnd;
                 }
-                else
-                    scan.currentIndentRange[1] = scan.currentIndentRange[0];
+                lineBegin   = lastNewline + 1;
+                indentEnd   = lineBegin;
+                lineHasCode = false;
+                lineIsClean = false;
             }
-            else if (ScanToken(s, '\n'))
-            {
-                /* Record previous indentation range */
-                scan.lastIndentRange[0] = scan.currentIndentRange[0];
-                scan.lastIndentRange[1] = scan.currentIndentRange[1];
+            continue;
+        }
 
-                /* Record new indentation range */
-                scan.currentIndentRange[0] = scan.head;
-            }
-            else if (ScanToken(s, '{'))
-            {
-                /* Record stepping into a code block */
-                scan.codeBlockDepth++;
-            }
-            else if (ScanToken(s, '}'))
+        if (*s == '#' && lineIsClean && !lineHasCode)
+        {
+            /* Scan preprocessor directive */
+            const char* directiveBegin = s;
+            ++s;
+            SkipWhitespaces(s);
+            const char* ident = s;
+            const std::size_t identLen = ScanIdentifier(s);
+
+            if (inactiveDepth == 0)
             {
-                /* Record stepping out of a code block and write last statement as we left the main entry point */
-                scan.codeBlockDepth--;
-                if (scan.codeBlockDepth == 0)
+                if (IsIdentifier(ident, identLen, "version") && !hasVersion_ && IsWhitespace(*s))
                 {
-                    scan.AppendStatement(statement);
-                    break;
+                    /* Record '#version'-directive; It must be terminated with a newline character */
+                    SkipDirective(s);
+                    if (*s == '\n')
+                    {
+                        versionBegin_   = ToPos(directiveBegin);
+                        versionEnd_     = ToPos(s + 1);
+                        hasVersion_     = true;
+                    }
+                }
+                else if (IsIdentifier(ident, identLen, "if") && IsDirectiveConstantZero(s))
+                {
+                    /* Ignore all code until the matching "#else" or "#endif" directive */
+                    inactiveDepth = 1;
                 }
-            }
-            else if (ScanToken(s, "return"))
-            {
-                /* Append vertex transform statement before return statement */
-                scan.AppendStatement(statement, true);
             }
             else
             {
-                /* Move to next character */
-                ++s;
+                if (IsIdentifier(ident, identLen, "if") || IsIdentifier(ident, identLen, "ifdef") || IsIdentifier(ident, identLen, "ifndef"))
+                    ++inactiveDepth;
+                else if (IsIdentifier(ident, identLen, "endif"))
+                    --inactiveDepth;
+                else if (inactiveDepth == 1 && (IsIdentifier(ident, identLen, "else") || IsIdentifier(ident, identLen, "elif")))
+                    inactiveDepth = 0;
             }
-        }
-
-        /* Replace source with finalized patched source */
-        scan.AppendRemainder();
-        source_ = std::move(scan.patched);
-    }
-}
 
-
-/*
- * ======= Private: =======
- */
-
-void GLShaderSourcePatcher::InsertAfterVersionDirective(const std::string& statement)
-{
-    /* Insert statement into source after version */
-    source_.insert(statementInsertPos_, statement);
-
-    /* Move source location for next insertion at the end of newly added code */
-    ResetInsertionPoints(statementInsertPos_ + statement.size());
-}
-
-static std::size_t FindEntryPointSourceLocation(const char* source, std::size_t start)
-{
-    const char* s = source + start;
-    while (*s != '\0')
-    {
-        if (ScanToken(s, "//"))
-        {
-            /* Ignore single line comment */
-            SkipUntilToken(s, '\n');
+            SkipDirective(s);
+            continue;
         }
-        else if (ScanToken(s, "/*"))
+
+        if (inactiveDepth > 0)
         {
-            /* Ignore multi line comment */
-            SkipUntilToken(s, '*', '/');
+            /* Ignore code in inactive conditional blocks */
+            ++s;
+            continue;
         }
-        else if (ScanToken(s, "void"))
-        {
-            /* Store position at start of current token */
-            const auto startPos = static_cast<std::size_t>(s - source - 4);
 
-            /* Ignore whitespaces after 'void' token */
-            SkipWhitespaces(s);
+        const bool isFirstToken = (lineIsClean && !lineHasCode);
+        const bool isAfterStatement = (lastCodeChar == ';' || lastCodeChar == '{' || lastCodeChar == '}');
+        lineHasCode = true;
+
+        if (IsIdentifierStart(*s))
+        {
+            const char* ident = s;
+            const std::size_t identLen = ScanIdentifier(s);
 
-            /* Scan for "main" identifier */
-            if (ScanToken(s, "main"))
+            if (state == EntryPointState::Body)
             {
-                SkipWhitespaces(s);
-                if (ScanToken(s, '('))
+                if (IsIdentifier(ident, identLen, "return"))
                 {
-                    SkipWhitespaces(s);
-                    if (ScanToken(s, ')'))
+                    /*
+                    Insert vertex transform statement before return statement in its own line if the return statement starts a new line.
+                    Otherwise, wrap both statements into a code block, e.g. "if (x) return;" turns into "if (x) { gl_Position.y = -gl_Position.y; return; }".
+                    */
+                    if (isFirstToken && isAfterStatement)
+                        AddInsertion(InsertionType::Statement, lineBegin, lineBegin, indentEnd);
+                    else if (!hasOpenBlock)
                     {
-                        /* Entry point found => return start position of main function */
-                        return startPos;
+                        AddInsertion(InsertionType::BlockBegin, ident, ident, ident);
+                        hasOpenBlock = true;
                     }
                 }
             }
+            else if (IsIdentifier(ident, identLen, "void"))
+                state = (state == EntryPointState::LParen ? EntryPointState::LParen : EntryPointState::Void);
+            else if (IsIdentifier(ident, identLen, "main") && state == EntryPointState::Void)
+                state = EntryPointState::Main;
+            else
+                state = EntryPointState::None;
+            lastCodeChar = 'a';
+            continue;
         }
-        else
+
+        lastCodeChar = *s;
+
+        if (state == EntryPointState::Body)
         {
-            /* Move to next character */
-            ++s;
+            if (*s == '{')
+                ++codeBlockDepth;
+            else if (*s == '}')
+            {
+                if (--codeBlockDepth == 0)
+                {
+                    /* Insert last vertex transform statement at the end of the entry point with the indentation of the previous line */
+                    AddInsertion(InsertionType::Statement, (isFirstToken ? lineBegin : s), lastIndent[0], lastIndent[1]);
+                    break;
+                }
+            }
+            else if (*s == ';' && hasOpenBlock)
+            {
+                AddInsertion(InsertionType::BlockEnd, s + 1, s + 1, s + 1);
+                hasOpenBlock = false;
+            }
         }
+        else if (*s == '(' && state == EntryPointState::Main)
+            state = EntryPointState::LParen;
+        else if (*s == ')' && state == EntryPointState::LParen)
+            state = EntryPointState::RParen;
+        else if (*s == '{' && state == EntryPointState::RParen)
+        {
+            state           = EntryPointState::Body;
+            codeBlockDepth  = 1;
+        }
+        else
+            state = EntryPointState::None;
+
+        ++s;
     }
-    return std::string::npos;
+
+    /* Ignore insertions of an incomplete entry point */
+    if (state != EntryPointState::Body || codeBlockDepth > 0)
+        insertions_.clear();
 }
 
-void GLShaderSourcePatcher::CacheEntryPointSourceLocation()
+void GLShaderSourcePatcher::AppendSourceRange(std::size_t begin, std::size_t end)
 {
-    if (entryPointStartPos_ == std::string::npos)
-        entryPointStartPos_ = FindEntryPointSourceLocation(GetSource(), statementInsertPos_);
+    patched_.append(source_, begin, end - begin);
 }
 
-void GLShaderSourcePatcher::ResetInsertionPoints(std::size_t newStatementInsertPos)
+void GLShaderSourcePatcher::AppendInsertion(const Insertion& insertion)
 {
-    if (newStatementInsertPos > statementInsertPos_)
-    {
-        if (entryPointStartPos_ != std::string::npos)
-            entryPointStartPos_ += (newStatementInsertPos - statementInsertPos_);
-        statementInsertPos_ = newStatementInsertPos;
-    }
-    else if (newStatementInsertPos < statementInsertPos_)
+    switch (insertion.type)
     {
-        if (entryPointStartPos_ != std::string::npos)
-            entryPointStartPos_ -= (statementInsertPos_ - newStatementInsertPos);
-        statementInsertPos_ = newStatementInsertPos;
+        case InsertionType::Statement:
+            AppendSourceRange(insertion.indentBegin, insertion.indentEnd);
+            patched_ += vertexStatement_;
+            patched_ += '\n';
+            break;
+
+        case InsertionType::BlockBegin:
+            patched_ += "{ ";
+            patched_ += vertexStatement_;
+            patched_ += ' ';
+            break;
+
+        case InsertionType::BlockEnd:
+            patched_ += " }";
+            break;
     }
 }
 
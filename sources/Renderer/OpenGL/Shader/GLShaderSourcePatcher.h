@@ -10,6 +10,7 @@
 
 
 #include <string>
+#include <vector>
 
 
 namespace LLGL
@@ -18,13 +19,21 @@ namespace LLGL
 
 struct ShaderMacro;
 
-// Allows to insert source code into a given GLSL shader.
+/*
+Allows to insert source code into a given GLSL shader.
+The shader source is scanned only once when the patcher is constructed and all patches are only recorded.
+The patched source is then built in a single pass with 'GetPatchedSource', so the same patcher can be re-used for multiple shader permutations.
+The scanner is preprocessor-aware to the extent that it ignores directive lines and code blocks that are disabled with "#if 0".
+*/
 class GLShaderSourcePatcher
 {
 
     public:
 
-        // Initialies the patcher with the specified shader source.
+        GLShaderSourcePatcher(const GLShaderSourcePatcher&) = delete;
+        GLShaderSourcePatcher& operator = (const GLShaderSourcePatcher&) = delete;
+
+        // Initialies the patcher with the specified shader source and scans it for all insertion points.
         GLShaderSourcePatcher(const char* source);
 
         // Overrides the version directive (or adds it if it's missing), e.g "300 es" turns into "#version 300 es".
@@ -37,34 +46,63 @@ class GLShaderSourcePatcher
         void AddPragmaDirective(const char* statement);
 
         // Adds the specified statement to all source positions that determine a vertex position, e.g. "gl_Position.y = -gl_Position.y;".
-        // NOTE: This patcher cannot handle shader source whose entry point or its return statements are modified by preprocessor directives,
-        //       i.e. no preprocessing is performed prior to scanning the source.
         void AddFinalVertexTransformStatements(const char* statement);
 
+        // Removes all recorded patches, so this patcher can be re-used for another permutation of the same shader source.
+        void ResetPatches();
+
+        // Builds the patched shader source in a single pass and returns it as null terminated string. The buffer is re-used for each invocation.
+        const char* GetPatchedSource();
+
     public:
 
-        // Returns the current shader source as null terminated string.
-        inline const char* GetSource() const
+        // Returns true if the specified shader source is identical to the source this patcher was initialized with.
+        bool MatchesSource(const char* source) const;
+
+        // Returns the original shader source.
+        inline const std::string& GetSource() const
         {
-            return source_.c_str();
+            return source_;
         }
 
     private:
 
-        // Inserts the specified statement after the '#version'-directive and any previously inserted statement.
-        void InsertAfterVersionDirective(const std::string& statement);
+        enum class InsertionType
+        {
+            Statement,  // Inserts the vertex statement in a new line with the indentation from 'indentBegin' to 'indentEnd'.
+            BlockBegin, // Inserts "{ " followed by the vertex statement, e.g. before a return statement that is not at the start of a line.
+            BlockEnd,   // Inserts " }" to close the code block of a previous 'BlockBegin' insertion.
+        };
 
-        // Finds and stores the source location of the entry point, i.e. points to the first character after of the entry point declaration "void main()".
-        void CacheEntryPointSourceLocation();
+        // Source location where the vertex transform statement is inserted.
+        struct Insertion
+        {
+            InsertionType   type;
+            std::size_t     pos;
+            std::size_t     indentBegin;
+            std::size_t     indentEnd;
+        };
+
+    private:
 
-        // Updates the source insertion points.
-        void ResetInsertionPoints(std::size_t newStatementInsertPos);
+        // Scans the shader source for the '#version'-directive, the return statements and the end of the entry point.
+        void ScanSource();
+
+        void AppendSourceRange(std::size_t begin, std::size_t end);
+        void AppendInsertion(const Insertion& insertion);
 
     private:
 
-        std::string source_;
-        std::size_t statementInsertPos_ = 0;
-        std::size_t entryPointStartPos_ = std::string::npos;
+        std::string             source_;
+        std::size_t             versionBegin_       = 0;    // Source position of the '#' character of the '#version'-directive.
+        std::size_t             versionEnd_         = 0;    // Source position after the '#version'-directive. This is always at the beginning of a new line.
+        bool                    hasVersion_         = false;
+        std::vector<Insertion>  insertions_;                // Insertion points within the entry point, sorted by source position.
+
+        std::string             versionOverride_;
+        std::string             vertexStatement_;
+        std::string             header_;                    // Definitions and directives that are inserted after the '#version'-directive.
+        std::string             patched_;
 
 };
 
@@ -9,6 +9,10 @@
 #include "../GLTypes.h"
 #include "../Ext/GLExtensions.h"
 #include "../Ext/GLExtensionRegistry.h"
+#include "../RenderState/GLStateManager.h"
+#include <unordered_map>
+#include <vector>
+#include <string.h>
 
 
 namespace LLGL
@@ -285,6 +289,84 @@ void GLSetUniformsByLocation(GLuint program, GLint location, GLsizei count, cons
 }
 
 
+
+/*
+ * Uniform cache
+ */
+
+// Shadowed values of a single uniform location.
+struct GLUniformCacheEntry
+{
+    GLint           location;
+    std::size_t     offset;
+    std::size_t     size;
+};
+
+// Shadowed uniform values of a single shader program.
+struct GLProgramUniformCache
+{
+    std::uint32_t                       generation  = 0;
+    std::vector<GLUniformCacheEntry>    entries;
+    std::vector<char>                   values;
+};
+
+static std::unordered_map<GLuint, GLProgramUniformCache>    g_programUniformCaches;
+static std::uint32_t                                        g_uniformCacheGeneration    = 1;
+
+// Returns true if the specified values differ from the shadowed values and updates the cache.
+static bool UpdateProgramUniformCache(GLProgramUniformCache& cache, GLint location, const void* data, std::size_t size)
+{
+    /* Drop all shadowed values if the cache has been invalidated since its last update */
+    if (cache.generation != g_uniformCacheGeneration)
+    {
+        cache.entries.clear();
+        cache.values.clear();
+        cache.generation = g_uniformCacheGeneration;
+    }
+
+    for (const GLUniformCacheEntry& entry : cache.entries)
+    {
+        if (entry.location == location && entry.size == size)
+        {
+            char* values = cache.values.data() + entry.offset;
+            if (::memcmp(values, data, size) == 0)
+                return false;
+            ::memcpy(values, data, size);
+            return true;
+        }
+    }
+
+    /* Append new entry for this uniform location */
+    const char* bytes = static_cast<const char*>(data);
+    cache.entries.push_back({ location, cache.values.size(), size });
+    cache.values.insert(cache.values.end(), bytes, bytes + size);
+
+    return true;
+}
+
+void GLSetUniformsCached(UniformType type, GLint location, GLsizei count, const void* data, std::size_t size)
+{
+    /* Uniforms can only be shadowed for monolithic shader programs; glUniform* refers to the active program of a pipeline otherwise */
+    const GLuint program = GLStateManager::Get().GetBoundShaderProgram();
+    if (program != 0 && location != -1)
+    {
+        if (!UpdateProgramUniformCache(g_programUniformCaches[program], location, data, size))
+            return;
+    }
+    GLSetUniformsByType(type, location, count, data);
+}
+
+void GLInvalidateUniformCache()
+{
+    ++g_uniformCacheGeneration;
+}
+
+void GLReleaseUniformCache(GLuint program)
+{
+    g_programUniformCaches.erase(program);
+}
+
+
 } // /namespace LLGL
 
 
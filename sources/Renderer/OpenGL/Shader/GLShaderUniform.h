@@ -11,6 +11,7 @@
 
 #include <LLGL/ShaderReflection.h>
 #include "../OpenGL.h"
+#include <cstddef>
 
 
 namespace LLGL
@@ -23,6 +24,18 @@ void GLSetUniformsByType(UniformType type, GLint location, GLsizei count, const
 // Sets the data of the specified uniform in the active shader program, where the type is determined by the specified shader program.
 void GLSetUniformsByLocation(GLuint program, GLint location, GLsizei count, const void* data);
 
+/*
+Sets the data of the specified uniform in the active shader program unless that program already holds the same values.
+The values are shadowed per shader program, since glUniform* calls are expensive on mobile drivers even for redundant updates.
+*/
+void GLSetUniformsCached(UniformType type, GLint location, GLsizei count, const void* data, std::size_t size);
+
+// Invalidates all shadowed uniform values. Must be called after uniforms have been set without GLSetUniformsCached.
+void GLInvalidateUniformCache();
+
+// Releases the shadowed uniform values of the specified shader program.
+void GLReleaseUniformCache(GLuint program);
+
 
 } // /namespace LLGL
 
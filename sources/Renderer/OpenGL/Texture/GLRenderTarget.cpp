@@ -10,12 +10,14 @@
 #include "../GLTypes.h"
 #include "../GLObjectUtils.h"
 #include "../RenderState/GLStateManager.h"
+#include "../RenderState/GLRenderPass.h"
 #include "../Ext/GLExtensions.h"
 #include "../Ext/GLExtensionRegistry.h"
 #include "../../CheckedCast.h"
 #include "../../RenderTargetUtils.h"
 #include "../../../Core/CoreUtils.h"
 #include "../../../Core/Assertion.h"
+#include "../../../Core/Exception.h"
 #include <LLGL/Utils/ForRange.h>
 #include <algorithm>
 
@@ -139,6 +141,35 @@ void GLRenderTarget::SetDrawBuffers()
     SetGLDrawBuffers(drawBuffers_);
 }
 
+GLsizei GLRenderTarget::GetInvalidateAttachments(std::uint32_t attachmentMask, GLenum* outAttachments) const
+{
+    GLsizei numAttachments = 0;
+
+    /* Write color attachments, but keep the content of multi-sampled attachments until they are resolved */
+    for_range(colorTarget, drawBuffers_.size())
+    {
+        if ((attachmentMask & (1u << colorTarget)) != 0)
+        {
+            const GLenum drawBuffer = drawBuffers_[colorTarget];
+            if (std::find(drawBuffersResolve_.begin(), drawBuffersResolve_.end(), drawBuffer) == drawBuffersResolve_.end())
+                outAttachments[numAttachments++] = drawBuffer;
+        }
+    }
+
+    /* Write depth-stencil attachment or only one of its aspects */
+    const bool invalidateDepth      = (HasDepthAttachment() && (attachmentMask & GLRenderPass::invalidateDepthBit) != 0);
+    const bool invalidateStencil    = (HasStencilAttachment() && (attachmentMask & GLRenderPass::invalidateStencilBit) != 0);
+
+    if (invalidateDepth && invalidateStencil)
+        outAttachments[numAttachments++] = GL_DEPTH_STENCIL_ATTACHMENT;
+    else if (invalidateDepth)
+        outAttachments[numAttachments++] = GL_DEPTH_ATTACHMENT;
+    else if (invalidateStencil)
+        outAttachments[numAttachments++] = GL_STENCIL_ATTACHMENT;
+
+    return numAttachments;
+}
+
 
 /*
  * ======= Private: =======
@@ -150,16 +181,59 @@ static void GLThrowIfFramebufferStatusFailed(const char* info)
     GLThrowIfFailed(status, GL_FRAMEBUFFER_COMPLETE, info);
 }
 
+// Returns true if all multi-sampled attachments can be resolved implicitly at the end of each render pass, so their samples never leave tile memory.
+static bool IsImplicitResolveSupported(const RenderTargetDescriptor& desc, GLint samples)
+{
+    #ifdef LLGL_GLEXT_MULTISAMPLED_RENDER_TO_TEXTURE
+
+    if (samples <= 1 || !HasExtension(GLExt::EXT_multisampled_render_to_texture))
+        return false;
+
+    const std::uint32_t numColorAttachments = NumActiveColorAttachments(desc);
+    if (numColorAttachments == 0)
+        return false;
+
+    GLint maxSamples = 0;
+    glGetIntegerv(GL_MAX_SAMPLES_EXT, &maxSamples);
+    if (samples > maxSamples)
+        return false;
+
+    /* Each color attachment must be an internal multi-sampled buffer that is resolved into a 2D texture, since only its resolve target can be attached */
+    for_range(colorTarget, numColorAttachments)
+    {
+        const Texture* resolveTexture = desc.resolveAttachments[colorTarget].texture;
+        if (desc.colorAttachments[colorTarget].texture != nullptr || resolveTexture == nullptr || resolveTexture->GetType() != TextureType::Texture2D)
+            return false;
+    }
+
+    /* Depth-stencil attachment must also be an internal buffer to share the implicit multi-sampled storage */
+    return (desc.depthStencilAttachment.texture == nullptr);
+
+    #else
+
+    return false;
+
+    #endif // /LLGL_GLEXT_MULTISAMPLED_RENDER_TO_TEXTURE
+}
+
 void GLRenderTarget::CreateFramebufferWithAttachments(const RenderTargetDescriptor& desc)
 {
     const std::uint32_t numColorAttachments = GetNumColorAttachments();
 
+    /* Resolve multi-sampled attachments at the end of each render pass instead of blitting them into a secondary FBO if possible */
+    implicitResolve_ = IsImplicitResolveSupported(desc, samples_);
+
     /* Bind primary FBO */
     GLStateManager::Get().BindFramebuffer(GLFramebufferTarget::DrawFramebuffer, framebuffer_.GetID());
     {
         /* Attach all color targets */
         for_range(colorTarget, numColorAttachments)
-            BuildColorAttachment(desc.colorAttachments[colorTarget], colorTarget);
+        {
+            if (implicitResolve_)
+                BuildImplicitResolveAttachment(desc.resolveAttachments[colorTarget], colorTarget);
+            else
+                BuildColorAttachment(desc.colorAttachments[colorTarget], colorTarget);
+        }
 
         /* Attach depth-stencil targets */
         if (IsAttachmentEnabled(desc.depthStencilAttachment))
@@ -171,7 +245,7 @@ void GLRenderTarget::CreateFramebufferWithAttachments(const RenderTargetDescript
     }
 
     /* Create secondary FBO if there are any resolve targets */
-    if (NumActiveResolveAttachments(desc) > 0)
+    if (!implicitResolve_ && NumActiveResolveAttachments(desc) > 0)
     {
         /* Create secondary FBO if standard multi-sampling is enabled */
         framebufferResolve_.GenFramebuffer();
@@ -228,6 +302,31 @@ void GLRenderTarget::BuildResolveAttachment(const AttachmentDescriptor& attachme
     BuildAttachmentWithTexture(AllocResolveAttachmentBinding(colorTarget), attachmentDesc);
 }
 
+void GLRenderTarget::BuildImplicitResolveAttachment(const AttachmentDescriptor& attachmentDesc, std::uint32_t colorTarget)
+{
+    #ifdef LLGL_GLEXT_MULTISAMPLED_RENDER_TO_TEXTURE
+
+    LLGL_ASSERT_PTR(attachmentDesc.texture);
+    auto* textureGL = LLGL_CAST(GLTexture*, attachmentDesc.texture);
+
+    /* Validate resolution for MIP-map level */
+    auto mipLevel = attachmentDesc.mipLevel;
+    ValidateMipResolution(*textureGL, mipLevel);
+
+    /* Attach resolve texture to the primary FBO with implicit multi-sampled storage */
+    const GLenum binding = AllocColorAttachmentBinding(colorTarget);
+    glFramebufferTexture2DMultisampleEXT(GL_DRAW_FRAMEBUFFER, binding, GL_TEXTURE_2D, textureGL->GetID(), static_cast<GLint>(mipLevel), samples_);
+
+    /* Keep resolved content when attachments are invalidated at the end of a render pass */
+    drawBuffersResolve_.push_back(binding);
+
+    #else
+
+    LLGL_TRAP_FEATURE_NOT_SUPPORTED("GL_EXT_multisampled_render_to_texture");
+
+    #endif // /LLGL_GLEXT_MULTISAMPLED_RENDER_TO_TEXTURE
+}
+
 void GLRenderTarget::BuildDepthStencilAttachment(const AttachmentDescriptor& attachmentDesc)
 {
     if (auto* texture = attachmentDesc.texture)
@@ -259,6 +358,11 @@ void GLRenderTarget::CreateAndAttachRenderbuffer(GLenum binding, GLenum internal
     GLRenderbuffer renderbuffer;
     {
         renderbuffer.GenRenderbuffer();
+        #ifdef LLGL_GLEXT_MULTISAMPLED_RENDER_TO_TEXTURE
+        if (implicitResolve_)
+            renderbuffer.BindAndAllocImplicitResolveStorage(internalFormat, resolution_[0], resolution_[1], samples_);
+        else
+        #endif
         renderbuffer.BindAndAllocStorage(internalFormat, resolution_[0], resolution_[1], samples_);
         GLFramebuffer::AttachRenderbuffer(binding, renderbuffer.GetID());
     }
@@ -41,7 +41,7 @@ class GLRenderTarget final : public RenderTarget
         GLRenderTarget(const RenderingLimits& limits, const RenderTargetDescriptor& desc);
         ~GLRenderTarget();
 
-        // Blits the multi-sample framebuffer onto the default framebuffer.
+        // Blits the multi-sample framebuffer onto the default framebuffer. This is a no-op if the framebuffer is resolved implicitly.
         void ResolveMultisampled(GLStateManager& stateMngr);
 
         // Blits the specified color attachment from the framebuffer onto the screen.
@@ -50,6 +50,12 @@ class GLRenderTarget final : public RenderTarget
         // Sets the draw buffers for the currently bound FBO.
         void SetDrawBuffers();
 
+        /*
+        Writes the FBO attachment points that are specified by the invalidation bitmask (see GLRenderPass::GetInvalidateOnEndMask) and returns the number of written entries.
+        Color attachments that are resolved when the next render target is bound are excluded. 'outAttachments' must have room for at least LLGL_MAX_NUM_ATTACHMENTS entries.
+        */
+        GLsizei GetInvalidateAttachments(std::uint32_t attachmentMask, GLenum* outAttachments) const;
+
         // Returns the primary FBO.
         inline const GLFramebuffer& GetFramebuffer() const
         {
@@ -63,6 +69,7 @@ class GLRenderTarget final : public RenderTarget
 
         void BuildColorAttachment(const AttachmentDescriptor& attachmentDesc, std::uint32_t colorTarget);
         void BuildResolveAttachment(const AttachmentDescriptor& attachmentDesc, std::uint32_t colorTarget);
+        void BuildImplicitResolveAttachment(const AttachmentDescriptor& attachmentDesc, std::uint32_t colorTarget);
         void BuildDepthStencilAttachment(const AttachmentDescriptor& attachmentDesc);
 
         void BuildAttachmentWithTexture(GLenum binding, const AttachmentDescriptor& attachmentDesc);
@@ -93,6 +100,7 @@ class GLRenderTarget final : public RenderTarget
 
         GLint                       samples_                = 1;
         GLenum                      depthStencilBinding_    = 0;        // Equivalent of drawBuffers but for depth-stencil
+        bool                        implicitResolve_        = false;    // Multi-sampled attachments are resolved at the end of each pass (see GL_EXT_multisampled_render_to_texture)
 
         const RenderPass*           renderPass_             = nullptr;
 
@@ -76,6 +76,17 @@ void GLRenderbuffer::BindAndAllocStorage(GLenum internalFormat, GLsizei width, G
     GLRenderbufferStorage(id_, internalFormat, width, height, samples);
 }
 
+#ifdef LLGL_GLEXT_MULTISAMPLED_RENDER_TO_TEXTURE
+
+void GLRenderbuffer::BindAndAllocImplicitResolveStorage(GLenum internalFormat, GLsizei width, GLsizei height, GLsizei samples)
+{
+    /* Multi-sampled storage of this renderbuffer is discarded after each render pass and never leaves tile memory */
+    GLStateManager::Get().BindRenderbuffer(id_);
+    glRenderbufferStorageMultisampleEXT(GL_RENDERBUFFER, samples, internalFormat, width, height);
+}
+
+#endif // /LLGL_GLEXT_MULTISAMPLED_RENDER_TO_TEXTURE
+
 void GLRenderbuffer::AllocStorage(GLuint id, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei samples)
 {
     #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
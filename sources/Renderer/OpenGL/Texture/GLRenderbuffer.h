@@ -37,6 +37,13 @@ class GLRenderbuffer
         // Binds the renderbuffer and initialized its storage.
         void BindAndAllocStorage(GLenum internalFormat, GLsizei width, GLsizei height, GLsizei samples);
 
+        #ifdef LLGL_GLEXT_MULTISAMPLED_RENDER_TO_TEXTURE
+
+        // Binds the renderbuffer and initializes its storage for a framebuffer that is resolved implicitly (see GL_EXT_multisampled_render_to_texture).
+        void BindAndAllocImplicitResolveStorage(GLenum internalFormat, GLsizei width, GLsizei height, GLsizei samples);
+
+        #endif // /LLGL_GLEXT_MULTISAMPLED_RENDER_TO_TEXTURE
+
         // Returns the hardware buffer ID.
         inline GLuint GetID() const
         {
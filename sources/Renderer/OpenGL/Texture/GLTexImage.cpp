@@ -10,6 +10,7 @@
 #include "../GLProfile.h"
 #include "../Ext/GLExtensions.h"
 #include "../Ext/GLExtensionRegistry.h"
+#include "../../TextureUtils.h"
 #include <LLGL/Utils/ColorRGBA.h>
 #include <LLGL/Utils/ForRange.h>
 #include <array>
@@ -1073,6 +1074,19 @@ bool GLTexImage(const TextureDescriptor& desc, const ImageView* imageView)
     if (IsCompressedFormat(desc.format) && !HasExtension(GLExt::ARB_texture_compression))
         return false;
 
+    /* Compress uncompressed image data (e.g. from RGBA to BC1) on the CPU, since compressed textures are always initialized with glCompressedTex*Image* */
+    DynamicByteArray    compressedData;
+    ImageView           compressedImageView;
+
+    if (imageView != nullptr && (compressedData = CompressTextureImageData(desc.format, *imageView, desc.extent, desc.arrayLayers)))
+    {
+        compressedImageView.format      = GetFormatAttribs(desc.format).format;
+        compressedImageView.dataType    = DataType::UInt8;
+        compressedImageView.data        = compressedData.get();
+        compressedImageView.dataSize    = compressedData.size();
+        imageView = &compressedImageView;
+    }
+
     switch (desc.type)
     {
         #ifdef LLGL_OPENGL
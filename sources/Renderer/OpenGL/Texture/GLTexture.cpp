@@ -26,6 +26,7 @@
 #include "../../../Core/Exception.h"
 #include "../../../Core/CoreUtils.h"
 #include <LLGL/Utils/ForRange.h>
+#include <LLGL/Backend/OpenGL/NativeHandle.h>
 
 
 namespace LLGL
@@ -147,6 +148,18 @@ void GLTexture::SetDebugName(const char* name)
         GLSetObjectLabel(GL_TEXTURE, GetID(), name);
 }
 
+bool GLTexture::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
+{
+    if (nativeHandle != nullptr && nativeHandleSize == sizeof(OpenGL::ResourceNativeHandle))
+    {
+        auto* nativeHandleGL = reinterpret_cast<OpenGL::ResourceNativeHandle*>(nativeHandle);
+        nativeHandleGL->id      = GetID();
+        nativeHandleGL->target  = (IsRenderbuffer() ? GL_RENDERBUFFER : GetGLTexTarget());
+        return true;
+    }
+    return false;
+}
+
 // Map TextureType to GLenum for glGetTexLevelParameter* functions. This is different for cube maps.
 static GLenum GLGetTextureLevelParamTarget(const TextureType type)
 {
@@ -647,13 +660,25 @@ void GLTexture::CopyImageToBuffer(
     /* Get image format and data type from internal texture format */
     const auto& formatAttribs = GetFormatAttribs(GetFormat());
 
-    /* Read data from unpack buffer with byte offset and equal texture format */
+    /* Rows and layers are not tightly packed if explicit strides are specified, so the destination size must include the padding */
+    std::size_t dstSize = static_cast<std::size_t>(size);
+    if (rowLength > 0)
+    {
+        const bool          isRowLayer      = (GetType() == TextureType::Texture1DArray);
+        const Extent3D      extent          = CalcTextureExtent(GetType(), region.extent, region.subresource.numArrayLayers);
+        const std::size_t   rowSize         = GetMemoryFootprint(formatAttribs.format, formatAttribs.dataType, static_cast<std::size_t>(rowLength));
+        const std::size_t   rowsPerLayer    = (isRowLayer ? 1 : (imageHeight > 0 ? static_cast<std::size_t>(imageHeight) : extent.height));
+        const std::size_t   numLayers       = (isRowLayer ? extent.height : extent.depth);
+        dstSize = std::max(dstSize, rowSize * rowsPerLayer * numLayers);
+    }
+
+    /* Read data from pack buffer with byte offset and equal texture format */
     const MutableImageView dstImageView
     {
         formatAttribs.format,
         formatAttribs.dataType,
         reinterpret_cast<void*>(offset),
-        static_cast<std::size_t>(size)
+        dstSize
     };
 
     /* Bind buffer to pixel transfer pack buffer unit */
@@ -738,6 +763,55 @@ void GLTexture::TextureSubImage(const TextureRegion& region, const ImageView& sr
     }
 }
 
+/*
+Reads the texture region through a temporary read FBO with glReadPixels, one array layer (or 3D slice) at a time.
+If a GL_PIXEL_PACK_BUFFER is bound, the pixels are written into that buffer on the GPU timeline without stalling the CPU.
+*/
+static void GLReadTexturePixels(
+    GLTexture&                  textureGL,
+    const TextureRegion&        region,
+    const MutableImageView&     dstImageView)
+{
+    /* Translate source region into actual texture dimensions */
+    const TextureType   type        = textureGL.GetType();
+    const Offset3D      offset      = CalcTextureOffset(type, region.offset, region.subresource.baseArrayLayer);
+    const Extent3D      extent      = CalcTextureExtent(type, region.extent, region.subresource.numArrayLayers);
+    const GLint         mipLevel    = static_cast<GLint>(region.subresource.baseMipLevel);
+
+    /* Layers of 1D array textures are stored in rows, all other layers in slices */
+    const bool          isRowLayer  = (type == TextureType::Texture1DArray);
+    const std::uint32_t numLayers   = (isRowLayer ? extent.height : extent.depth);
+    const std::size_t   layerStride = dstImageView.dataSize / std::max(1u, numLayers);
+
+    GLStateManager::Get().PushBoundFramebuffer(GLFramebufferTarget::ReadFramebuffer);
+    {
+        GLReadTextureFBO readFBO;
+        char* dst = static_cast<char*>(dstImageView.data);
+
+        for_range(layer, numLayers)
+        {
+            Offset3D layerOffset = offset;
+            if (isRowLayer)
+                layerOffset.y += static_cast<std::int32_t>(layer);
+            else
+                layerOffset.z += static_cast<std::int32_t>(layer);
+
+            readFBO.Attach(textureGL, mipLevel, layerOffset);
+            glReadPixels(
+                offset.x,
+                (isRowLayer ? 0 : offset.y),
+                static_cast<GLsizei>(extent.width),
+                (isRowLayer ? 1 : static_cast<GLsizei>(extent.height)),
+                GLTypes::Map(dstImageView.format),
+                GLTypes::Map(dstImageView.dataType),
+                dst
+            );
+            dst += layerStride;
+        }
+    }
+    GLStateManager::Get().PopBoundFramebuffer();
+}
+
 #ifdef GL_ARB_get_texture_sub_image
 
 static void GLGetTextureSubImage(
@@ -927,6 +1001,16 @@ static void GLGetTextureImage(
 
 #endif // /LLGL_OPENGL
 
+#ifdef LLGL_OPENGL
+
+// Returns true if the specified region covers the entire MIP-map level of the texture, in which case glGetTexImage can read it directly.
+static bool IsEntireMipLevel(const GLTexture& textureGL, const TextureRegion& region)
+{
+    return (textureGL.GetMipExtent(region.subresource.baseMipLevel) == CalcTextureExtent(textureGL.GetType(), region.extent, region.subresource.numArrayLayers));
+}
+
+#endif // /LLGL_OPENGL
+
 void GLTexture::GetTextureSubImage(const TextureRegion& region, const MutableImageView& dstImageView, bool restoreBoundTexture)
 {
     if (!IsRenderbuffer())
@@ -941,6 +1025,12 @@ void GLTexture::GetTextureSubImage(const TextureRegion& region, const MutableIma
         }
         else
         #endif // /GL_ARB_get_texture_sub_image
+        if (!IsCompressedFormat(GetFormat()) && !IsMultiSampleTexture(GetType()) && !IsEntireMipLevel(*this, region))
+        {
+            /* Read sub image with glReadPixels instead of copying it into a staging texture first */
+            GLReadTexturePixels(*this, region, dstImageView);
+        }
+        else
         {
             /* Emulate functionality by copying the entire texture image into an intermediate buffer */
             const GLTextureTarget target = GLStateManager::GetTextureTarget(GetType());
@@ -959,8 +1049,8 @@ void GLTexture::GetTextureSubImage(const TextureRegion& region, const MutableIma
 
         #else
 
-        //TODO: copy texture to unpack buffer, then map buffer range to CPU memory
-        LLGL_TRAP_NOT_IMPLEMENTED();
+        /* GLES has no glGetTexImage, so read all sub images with glReadPixels */
+        GLReadTexturePixels(*this, region, dstImageView);
 
         #endif // /LLGL_OPENGL
     }
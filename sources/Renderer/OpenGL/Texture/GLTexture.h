@@ -41,6 +41,7 @@ class GLTexture final : public Texture
     public:
 
         void SetDebugName(const char* name) override;
+        bool GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize) override;
 
     public:
 
@@ -0,0 +1,89 @@
+/*
+ * GLTextureBlitter.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "GLTextureBlitter.h"
+#include "GLTexture.h"
+#include "../RenderState/GLStateManager.h"
+
+
+namespace LLGL
+{
+
+
+GLTextureBlitter& GLTextureBlitter::Get()
+{
+    static GLTextureBlitter instance;
+    return instance;
+}
+
+void GLTextureBlitter::Clear()
+{
+    blitFBOPair_.ReleaseFBOs();
+}
+
+static void GetBlitRegionCorners(const TextureRegion& region, Offset2D& outPos0, Offset2D& outPos1)
+{
+    outPos0.x = region.offset.x;
+    outPos0.y = region.offset.y;
+    outPos1.x = region.offset.x + static_cast<std::int32_t>(region.extent.width);
+    outPos1.y = region.offset.y + static_cast<std::int32_t>(region.extent.height);
+}
+
+void GLTextureBlitter::BlitTexture(
+    GLStateManager&         stateMngr,
+    GLTexture&              dstTexture,
+    const TextureRegion&    dstRegion,
+    GLTexture&              srcTexture,
+    const TextureRegion&    srcRegion,
+    GLenum                  filter)
+{
+    Offset2D srcPos0, srcPos1, dstPos0, dstPos1;
+    GetBlitRegionCorners(srcRegion, srcPos0, srcPos1);
+    GetBlitRegionCorners(dstRegion, dstPos0, dstPos1);
+
+    blitFBOPair_.CreateFBOs();
+
+    /* Scissor test also applies to glBlitFramebuffer, so it must be disabled for the duration of the blit */
+    stateMngr.PushState(GLState::ScissorTest);
+    stateMngr.Disable(GLState::ScissorTest);
+
+    stateMngr.PushBoundFramebuffer(GLFramebufferTarget::ReadFramebuffer);
+    stateMngr.PushBoundFramebuffer(GLFramebufferTarget::DrawFramebuffer);
+    {
+        /* Bind read framebuffer for source region and draw framebuffer for destination region */
+        stateMngr.BindFramebuffer(GLFramebufferTarget::ReadFramebuffer, blitFBOPair_.fbos[0]);
+        stateMngr.BindFramebuffer(GLFramebufferTarget::DrawFramebuffer, blitFBOPair_.fbos[1]);
+
+        GLFramebuffer::AttachTexture(
+            srcTexture,
+            GL_COLOR_ATTACHMENT0,
+            static_cast<GLint>(srcRegion.subresource.baseMipLevel),
+            static_cast<GLint>(srcRegion.subresource.baseArrayLayer),
+            GL_READ_FRAMEBUFFER
+        );
+        GLFramebuffer::AttachTexture(
+            dstTexture,
+            GL_COLOR_ATTACHMENT0,
+            static_cast<GLint>(dstRegion.subresource.baseMipLevel),
+            static_cast<GLint>(dstRegion.subresource.baseArrayLayer),
+            GL_DRAW_FRAMEBUFFER
+        );
+
+        GLFramebuffer::Blit(srcPos0, srcPos1, dstPos0, dstPos1, GL_COLOR_BUFFER_BIT, filter);
+    }
+    stateMngr.PopBoundFramebuffer();
+    stateMngr.PopBoundFramebuffer();
+
+    stateMngr.PopState();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,72 @@
+/*
+ * GLTextureBlitter.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GL_TEXTURE_BLITTER_H
+#define LLGL_GL_TEXTURE_BLITTER_H
+
+
+#include <LLGL/TextureFlags.h>
+#include "GLFramebuffer.h"
+#include "../OpenGL.h"
+
+
+namespace LLGL
+{
+
+
+class GLTexture;
+class GLStateManager;
+
+// Blits texture regions with scaling via a pair of read and draw FBOs that are reused between blit commands.
+class GLTextureBlitter
+{
+
+    public:
+
+        // Returns the instance of this singleton.
+        static GLTextureBlitter& Get();
+
+    public:
+
+        GLTextureBlitter(const GLTextureBlitter&) = delete;
+        GLTextureBlitter& operator = (const GLTextureBlitter&) = delete;
+
+        GLTextureBlitter(GLTextureBlitter&&) = delete;
+        GLTextureBlitter& operator = (GLTextureBlitter&&) = delete;
+
+        // Releases the resource for this singleton class.
+        void Clear();
+
+        // Blits the source region into the destination region with the specified filter (GL_NEAREST or GL_LINEAR).
+        void BlitTexture(
+            GLStateManager&         stateMngr,
+            GLTexture&              dstTexture,
+            const TextureRegion&    dstRegion,
+            GLTexture&              srcTexture,
+            const TextureRegion&    srcRegion,
+            GLenum                  filter
+        );
+
+    private:
+
+        GLTextureBlitter() = default;
+
+    private:
+
+        GLFramebufferPair blitFBOPair_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -13,17 +13,12 @@
 #include "../Ext/GLExtensions.h"
 #include "../Ext/GLExtensionRegistry.h"
 #include "../../CheckedCast.h"
-#include "../../../Core/CoreUtils.h"
-#include "../../../Core/MacroUtils.h"
-#include <algorithm>
 
 
 namespace LLGL
 {
 
 
-static constexpr std::size_t g_maxNumReusableTextureViews = 16;
-
 GLTextureViewPool::~GLTextureViewPool()
 {
     Clear();
@@ -37,120 +32,55 @@ GLTextureViewPool& GLTextureViewPool::Get()
 
 void GLTextureViewPool::Clear()
 {
-    /* Delete all texture view GL objects and clear container */
-    for (const auto& texView : textureViews_)
-    {
-        if (texView.texID != 0)
-            glDeleteTextures(1, &(texView.texID));
-    }
+    /* Delete all texture view GL objects and clear containers */
+    for (const auto& it : textureViews_)
+        glDeleteTextures(1, &(it.first));
     textureViews_.clear();
-    numReusableEntries_ = 0;
+    sharedTextureViews_.clear();
 }
 
-GLuint GLTextureViewPool::CreateTextureView(GLuint sourceTexID, const TextureViewDescriptor& textureViewDesc, bool restoreBoundTexture)
+GLuint GLTextureViewPool::CreateTextureView(GLuint sourceTexID, const TextureViewDescriptor& textureViewDesc)
 {
     #ifdef GL_ARB_texture_view
 
     if (!HasExtension(GLExt::ARB_texture_view))
         return 0;
 
-    /* Compress texture view descriptor for faster comparison and sorting */
-    GLTextureView texView;
+    /* Compress texture view descriptor for faster hashing and comparison */
+    GLTextureViewKey key;
     {
-        texView.sourceTexID = sourceTexID;
+        key.sourceTexID = sourceTexID;
     }
-    CompressTextureViewDesc(texView.view, textureViewDesc);
+    CompressTextureViewDesc(key.view, textureViewDesc);
 
     /* Try to find texture view with same parameters */
-    std::size_t insertionIndex = 0;
-    auto* sharedTexView = FindInSortedArray<GLTextureView>(
-        textureViews_.data(),
-        textureViews_.size(),
-        [&texView](const GLTextureView& rhs)
-        {
-            return GLTextureViewPool::CompareTextureViewSWO(texView, rhs);
-        },
-        &insertionIndex
-    );
-
-    if (sharedTexView != nullptr)
-    {
-        /* Create a shared GL texture view from the descriptor */
-        return CreateGLTextureView(*sharedTexView, textureViewDesc, true, restoreBoundTexture);
-    }
-    else
+    auto it = sharedTextureViews_.find(key);
+    if (it != sharedTextureViews_.end())
     {
-        /* Create new GL texture view and store it with insertion sort */
-        GLuint texID = CreateGLTextureView(texView, textureViewDesc, false, restoreBoundTexture);
-        textureViews_.insert(textureViews_.begin() + insertionIndex, texView);
-        return texID;
+        /* Increment reference counter for the shared texture view */
+        textureViews_[it->second].refCount++;
+        return it->second;
     }
 
-    #else
-
-    return 0;
-
-    #endif
-}
-
-void GLTextureViewPool::ReleaseTextureView(GLuint texID)
-{
-    /* Try to find texture by GL texture ID only */
-    std::size_t insertionIndex = 0;
-    GLTextureView* sharedTexView = FindInSortedArray<GLTextureView>(
-        textureViews_.data(),
-        textureViews_.size(),
-        [texID](const GLTextureView& rhs)
-        {
-            LLGL_COMPARE_SEPARATE_MEMBERS_SWO(texID, rhs.texID);
-            return 0;
-        },
-        &insertionIndex
-    );
+    /* Generate new GL texture name; 'glTextureView' is deferred until the view is bound for the first time */
+    GLuint texID = 0;
+    glGenTextures(1, &texID);
 
-    if (sharedTexView != nullptr)
+    GLTextureView& texView = textureViews_[texID];
     {
-        /* Delete GL texture view if the reference counter reaches 0 */
-        ReleaseSharedGLTextureView(*sharedTexView);
-
-        /* Remove unused entries in the array after a given amount has been freed */
-        if (numReusableEntries_ > g_maxNumReusableTextureViews)
-            FlushReusableTextureViews();
+        texView.key         = key;
+        texView.refCount    = 1;
+        texView.desc        = textureViewDesc;
     }
-}
-
-void GLTextureViewPool::NotifyTextureRelease(GLuint sourceTexID)
-{
-    /* Move all objects that are about to be removed at the end of the list using 'std::remove' */
-    auto it = std::remove_if(
-        textureViews_.begin(),
-        textureViews_.end(),
-        [sourceTexID](const GLTextureView& entry)
-        {
-            return (entry.texID == 0 || entry.sourceTexID == sourceTexID);
-        }
-    );
-
-    /* Iterate over all elements to be deleted */
-    for (; it != textureViews_.end(); ++it)
-        DeleteGLTextureView(*it);
+    sharedTextureViews_[key] = texID;
 
-    /* Finally remove the entries from the list */
-    textureViews_.erase(it, textureViews_.end());
-
-    /* Reset reusable entries, since we just deleted all unused entries */
-    numReusableEntries_ = 0;
-}
+    return texID;
 
+    #else
 
-/*
- * ======= Private: =======
- */
+    return 0;
 
-int GLTextureViewPool::CompareTextureViewSWO(const GLTextureView& lhs, const GLTextureView& rhs)
-{
-    LLGL_COMPARE_MEMBER_SWO( sourceTexID );
-    return CompareCompressedTexViewSWO(lhs.view, rhs.view);
+    #endif
 }
 
 #ifdef GL_ARB_texture_view
@@ -163,121 +93,79 @@ static void InitializeTextureViewSwizzle(GLuint texID, const GLTextureTarget tar
 
 #endif // /GL_ARB_texture_view
 
-static GLuint GenGLTextureView(GLuint sourceTexID, const TextureViewDescriptor& textureViewDesc, bool restoreBoundTexture)
+void GLTextureViewPool::InitializeTextureView(GLuint texID)
 {
-    GLuint texID = 0;
-
     #ifdef GL_ARB_texture_view
 
-    if (HasExtension(GLExt::ARB_texture_view))
+    auto it = textureViews_.find(texID);
+    if (it == textureViews_.end() || it->second.initialized)
+        return;
+
+    /* Initialize texture with texture-view description */
+    const TextureViewDescriptor& textureViewDesc = it->second.desc;
+    glTextureView(
+        texID,
+        GLTypes::Map(textureViewDesc.type),
+        it->second.key.sourceTexID,
+        GLTypes::Map(textureViewDesc.format),
+        textureViewDesc.subresource.baseMipLevel,
+        textureViewDesc.subresource.numMipLevels,
+        textureViewDesc.subresource.baseArrayLayer,
+        textureViewDesc.subresource.numArrayLayers
+    );
+
+    /* Initialize texture view with swizzle parameters and store/restore bound texture slot */
+    const GLTextureTarget target = GLStateManager::GetTextureTarget(textureViewDesc.type);
+    GLStateManager::Get().PushBoundTexture(target);
     {
-        /* Generate and initialize texture with texture-view description */
-        glGenTextures(1, &texID);
-        glTextureView(
-            texID,
-            GLTypes::Map(textureViewDesc.type),
-            sourceTexID,
-            GLTypes::Map(textureViewDesc.format),
-            textureViewDesc.subresource.baseMipLevel,
-            textureViewDesc.subresource.numMipLevels,
-            textureViewDesc.subresource.baseArrayLayer,
-            textureViewDesc.subresource.numArrayLayers
-        );
-
-        /* Initialize texture swizzle */
-        const auto target = GLStateManager::GetTextureTarget(textureViewDesc.type);
-        if (restoreBoundTexture)
-        {
-            /* Initialize texture view with swizzle parameters and store/restore bound texture slot */
-            GLStateManager::Get().PushBoundTexture(target);
-            {
-                InitializeTextureViewSwizzle(texID, target, textureViewDesc);
-            }
-            GLStateManager::Get().PopBoundTexture();
-        }
-        else
-        {
-            /* Initialize texture view with swizzle parameters */
-            InitializeTextureViewSwizzle(texID, target, textureViewDesc);
-        }
+        InitializeTextureViewSwizzle(texID, target, textureViewDesc);
     }
+    GLStateManager::Get().PopBoundTexture();
 
-    #endif // /GL_ARB_texture_view
+    it->second.initialized = true;
 
-    return texID;
+    #endif // /GL_ARB_texture_view
 }
 
-GLuint GLTextureViewPool::CreateGLTextureView(GLTextureView& texView, const TextureViewDescriptor& textureViewDesc, bool isSharedTex, bool restoreBoundTexture)
+void GLTextureViewPool::ReleaseTextureView(GLuint texID)
 {
-    if (isSharedTex)
+    auto it = textureViews_.find(texID);
+    if (it != textureViews_.end() && it->second.refCount > 0)
     {
-        if (texView.texID == 0)
+        /* Delete GL texture view if the reference counter reaches 0 */
+        if (--(it->second.refCount) == 0)
         {
-            /* Create new GL texture view if ID is invalid */
-            GLuint texID = GenGLTextureView(texView.sourceTexID, textureViewDesc, restoreBoundTexture);
-            RetainSharedGLTextureView(texView, texID);
+            sharedTextureViews_.erase(it->second.key);
+            DeleteGLTextureView(texID, it->second);
+            textureViews_.erase(it);
         }
     }
-    else
-    {
-        /* Create a new GL texture view and initialize reference counter */
-        texView.texID = GenGLTextureView(texView.sourceTexID, textureViewDesc, restoreBoundTexture);
-    }
-
-    /* Increment reference counter for the shared texture view */
-    texView.refCount++;
-
-    return texView.texID;
 }
 
-// Uncompresses the specified 4-bit texture type to a 'GLTextureTarget' enum entry.
-static GLTextureTarget UncompressGLTextureTarget(std::uint32_t type)
-{
-    return GLStateManager::GetTextureTarget(static_cast<TextureType>(type));
-}
-
-void GLTextureViewPool::DeleteGLTextureView(GLTextureView& texView)
-{
-    GLStateManager::Get().DeleteTexture(texView.texID, UncompressGLTextureTarget(texView.view.type));
-}
-
-void GLTextureViewPool::RetainSharedGLTextureView(GLTextureView& texView, GLuint texID)
-{
-    if (texView.texID == 0)
-    {
-        /* If this is shared texture view, reclaim one of the reusable entries */
-        texView.texID = texID;
-        if (numReusableEntries_ > 0)
-            --numReusableEntries_;
-    }
-}
-
-void GLTextureViewPool::ReleaseSharedGLTextureView(GLTextureView& texView)
+void GLTextureViewPool::NotifyTextureRelease(GLuint sourceTexID)
 {
-    if (texView.refCount > 0)
+    /* Delete all texture views that were derived from the specified texture */
+    for (auto it = textureViews_.begin(); it != textureViews_.end();)
     {
-        texView.refCount--;
-        if (texView.refCount == 0)
+        if (it->second.key.sourceTexID == sourceTexID)
         {
-            DeleteGLTextureView(texView);
-            ++numReusableEntries_;
+            sharedTextureViews_.erase(it->second.key);
+            DeleteGLTextureView(it->first, it->second);
+            it = textureViews_.erase(it);
         }
+        else
+            ++it;
     }
 }
 
-void GLTextureViewPool::FlushReusableTextureViews()
+
+/*
+ * ======= Private: =======
+ */
+
+void GLTextureViewPool::DeleteGLTextureView(GLuint texID, const GLTextureView& texView)
 {
-    if (numReusableEntries_ > 0)
-    {
-        RemoveAllFromListIf(
-            textureViews_,
-            [](const GLTextureView& entry)
-            {
-                return (entry.texID == 0);
-            }
-        );
-        numReusableEntries_ = 0;
-    }
+    GLStateManager::Get().DeleteTexture(texID, GLStateManager::GetTextureTarget(texView.desc.type));
 }
 
 
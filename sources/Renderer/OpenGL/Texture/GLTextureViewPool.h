@@ -11,7 +11,7 @@
 
 #include <LLGL/TextureFlags.h>
 #include <cstdint>
-#include <vector>
+#include <unordered_map>
 #include "../OpenGL.h"
 #include "../../TextureUtils.h"
 
@@ -20,7 +20,12 @@ namespace LLGL
 {
 
 
-// Class to manage create/reuse/delete of GL texture views; used by <GLResourceHeap>
+/*
+Class to manage create/reuse/delete of GL texture views; used by <GLResourceHeap>.
+Texture views with the same source texture and descriptor are shared by reference count across all resource heaps.
+The GL texture names are generated immediately, but 'glTextureView' is only invoked when a view is bound for the first time.
+This class is not synchronized, since all GL objects are only accessed by the thread the GL context is current on.
+*/
 class GLTextureViewPool
 {
 
@@ -45,8 +50,12 @@ class GLTextureViewPool
         /*
         Returns the ID of a GL texture view for the specified source texture and descriptor,
         or 0 if the extension "GL_ARB_texture_view" is not supported.
+        The texture view must be initialized with InitializeTextureView() before it is bound.
         */
-        GLuint CreateTextureView(GLuint sourceTexID, const TextureViewDescriptor& textureViewDesc, bool restoreBoundTexture = true);
+        GLuint CreateTextureView(GLuint sourceTexID, const TextureViewDescriptor& textureViewDesc);
+
+        // Initializes the specified texture view with 'glTextureView' if this has not been done yet.
+        void InitializeTextureView(GLuint texID);
 
         // Release the texture view that was created with CreateTextureView.
         void ReleaseTextureView(GLuint texID);
@@ -63,40 +72,47 @@ class GLTextureViewPool
 
     private:
 
-        // Structure that stores a GL texture that was generated with 'glTextureView'; managed by <GLTextureViewPool>
-        struct GLTextureView
+        // Key to find shared texture views by source texture and compressed view descriptor.
+        struct GLTextureViewKey
         {
-            GLuint              texID        = 0;
-            GLuint              sourceTexID  = 0;
-            GLuint              refCount     = 0;
+            GLuint              sourceTexID = 0;
             CompressedTexView   view;
-        };
-
-        // Compares the two texture views in a strict-weak-order (SWO).
-        static int CompareTextureViewSWO(const GLTextureView& lhs, const GLTextureView& rhs);
 
-        // Creats a new GL texture view and stores it in the specified view entry.
-        GLuint CreateGLTextureView(GLTextureView& texView, const TextureViewDescriptor& textureViewDesc, bool isSharedTex, bool restoreBoundTexture);
+            inline bool operator == (const GLTextureViewKey& rhs) const
+            {
+                return (sourceTexID == rhs.sourceTexID && CompareCompressedTexViewSWO(view, rhs.view) == 0);
+            }
+        };
 
-        // Deletes the specified GL texture view.
-        void DeleteGLTextureView(GLTextureView& texView);
+        struct GLTextureViewKeyHash
+        {
+            inline std::size_t operator () (const GLTextureViewKey& key) const
+            {
+                return HashCompressedTexView(key.view, key.sourceTexID);
+            }
+        };
 
-        // Assignes the specified texture view a new GL texture ID and reclaims it as a reusable entry.
-        void RetainSharedGLTextureView(GLTextureView& texView, GLuint texID);
+        // Structure that stores a GL texture that was generated with 'glTextureView'; managed by <GLTextureViewPool>
+        struct GLTextureView
+        {
+            GLTextureViewKey        key;
+            GLuint                  refCount    = 0;
+            bool                    initialized = false; // True once 'glTextureView' has been invoked for this texture name.
+            TextureViewDescriptor   desc;
+        };
 
-        // Release the specified GL texture object and marks the entry as reusable.
-        void ReleaseSharedGLTextureView(GLTextureView& texView);
+    private:
 
-        // Removes all empty entries from the texture view list.
-        void FlushReusableTextureViews();
+        // Deletes the GL texture of the specified texture view.
+        void DeleteGLTextureView(GLuint texID, const GLTextureView& texView);
 
     private:
 
-        // Container of all managed texture views.
-        std::vector<GLTextureView>  textureViews_;
+        // Container of all managed texture views, indexed by their GL texture ID.
+        std::unordered_map<GLuint, GLTextureView>                               textureViews_;
 
-        // Number of textures that are already freed, but not removed from the texture view array yet.
-        std::size_t                 numReusableEntries_ = 0;
+        // Container of the GL texture IDs of all managed texture views, indexed by their source texture and descriptor.
+        std::unordered_map<GLTextureViewKey, GLuint, GLTextureViewKeyHash>      sharedTextureViews_;
 
 };
 
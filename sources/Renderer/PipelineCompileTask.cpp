@@ -0,0 +1,67 @@
+/*
+ * PipelineCompileTask.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "PipelineCompileTask.h"
+#include "../Core/Assertion.h"
+#include <LLGL/ThreadPool.h>
+
+
+namespace LLGL
+{
+
+
+PipelineCompileTask::~PipelineCompileTask()
+{
+    Wait();
+}
+
+void PipelineCompileTask::Start(const std::function<void()>& task, bool async)
+{
+    LLGL_ASSERT(IsReady(), "cannot start pipeline compile task while previous task is still pending");
+
+    if (async)
+    {
+        ready_.store(false, std::memory_order_relaxed);
+        ThreadPool::GetGlobal().Submit(
+            [this, task]()
+            {
+                task();
+                this->Finish();
+            }
+        );
+    }
+    else
+        task();
+}
+
+void PipelineCompileTask::Wait()
+{
+    if (!IsReady())
+    {
+        std::unique_lock<std::mutex> lock{ mutex_ };
+        signal_.wait(lock, [this]() { return IsReady(); });
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void PipelineCompileTask::Finish()
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    ready_.store(true, std::memory_order_release);
+    signal_.notify_all();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
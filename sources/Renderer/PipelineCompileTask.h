@@ -0,0 +1,71 @@
+/*
+ * PipelineCompileTask.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_PIPELINE_COMPILE_TASK_H
+#define LLGL_PIPELINE_COMPILE_TASK_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/NonCopyable.h>
+#include <functional>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+
+
+namespace LLGL
+{
+
+
+/*
+Tracks the compilation of a native PSO that is optionally run on the global thread pool.
+The owning PSO must call Wait() in its destructor before any of the state the task refers to is released.
+*/
+class LLGL_EXPORT PipelineCompileTask final : public NonCopyable
+{
+
+    public:
+
+        PipelineCompileTask() = default;
+        ~PipelineCompileTask();
+
+        /*
+        Runs the specified task either on the global thread pool or immediately on the calling thread.
+        The task must not throw exceptions; errors must be written to the PSO report instead.
+        */
+        void Start(const std::function<void()>& task, bool async);
+
+        // Blocks the calling thread until the task has finished.
+        void Wait();
+
+        // Returns true if no task is pending.
+        inline bool IsReady() const
+        {
+            return ready_.load(std::memory_order_acquire);
+        }
+
+    private:
+
+        void Finish();
+
+    private:
+
+        std::atomic<bool>       ready_  { true };
+        std::mutex              mutex_;
+        std::condition_variable signal_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,111 @@
+/*
+ * PipelineLayoutCache.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "PipelineLayoutCache.h"
+#include "../Core/MacroUtils.h"
+#include <LLGL/Utils/ForRange.h>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+PipelineLayoutSignature::PipelineLayoutSignature(const PipelineLayoutDescriptor& desc) :
+    hash_ { 0xCBF29CE484222325ull }
+{
+    /* Serialize all descriptor fields that determine the native layout; Array sizes separate the lists from each other */
+    AppendValue(static_cast<std::uint32_t>(desc.heapBindings.size()));
+    for (const BindingDescriptor& binding : desc.heapBindings)
+        AppendBinding(binding);
+
+    AppendValue(static_cast<std::uint32_t>(desc.bindings.size()));
+    for (const BindingDescriptor& binding : desc.bindings)
+        AppendBinding(binding);
+
+    AppendValue(static_cast<std::uint32_t>(desc.staticSamplers.size()));
+    for (const StaticSamplerDescriptor& staticSampler : desc.staticSamplers)
+    {
+        AppendString(staticSampler.name);
+        AppendValue(staticSampler.stageFlags);
+        AppendValue(staticSampler.slot.index);
+        AppendValue(staticSampler.slot.set);
+
+        const SamplerDescriptor& sampler = staticSampler.sampler;
+        AppendValue(sampler.addressModeU);
+        AppendValue(sampler.addressModeV);
+        AppendValue(sampler.addressModeW);
+        AppendValue(sampler.minFilter);
+        AppendValue(sampler.magFilter);
+        AppendValue(sampler.mipMapFilter);
+        AppendValue(sampler.mipMapEnabled);
+        AppendValue(sampler.mipMapLODBias);
+        AppendValue(sampler.minLOD);
+        AppendValue(sampler.maxLOD);
+        AppendValue(sampler.maxAnisotropy);
+        AppendValue(sampler.compareEnabled);
+        AppendValue(sampler.compareOp);
+        AppendValue(sampler.borderColor);
+    }
+
+    AppendValue(static_cast<std::uint32_t>(desc.uniforms.size()));
+    for (const UniformDescriptor& uniform : desc.uniforms)
+    {
+        AppendString(uniform.name);
+        AppendValue(uniform.type);
+        AppendValue(uniform.arraySize);
+    }
+}
+
+int PipelineLayoutSignature::CompareSWO(const PipelineLayoutSignature& lhs, const PipelineLayoutSignature& rhs)
+{
+    LLGL_COMPARE_MEMBER_SWO( hash_        );
+    LLGL_COMPARE_MEMBER_SWO( data_.size() );
+    return ::memcmp(lhs.data_.data(), rhs.data_.data(), lhs.data_.size());
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void PipelineLayoutSignature::Append(const void* data, std::size_t size)
+{
+    const char* bytes = static_cast<const char*>(data);
+    data_.insert(data_.end(), bytes, bytes + size);
+
+    /* Update 64-bit FNV-1a hash */
+    for_range(i, size)
+    {
+        hash_ ^= static_cast<std::uint8_t>(bytes[i]);
+        hash_ *= 0x100000001B3ull;
+    }
+}
+
+void PipelineLayoutSignature::AppendString(const std::string& str)
+{
+    /* Include null terminator, so consecutive strings cannot be shifted into each other */
+    Append(str.c_str(), str.size() + 1);
+}
+
+void PipelineLayoutSignature::AppendBinding(const BindingDescriptor& binding)
+{
+    AppendString(binding.name);
+    AppendValue(binding.type);
+    AppendValue(binding.bindFlags);
+    AppendValue(binding.stageFlags);
+    AppendValue(binding.slot.index);
+    AppendValue(binding.slot.set);
+    AppendValue(binding.arraySize);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,86 @@
+/*
+ * PipelineLayoutCache.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_PIPELINE_LAYOUT_CACHE_H
+#define LLGL_PIPELINE_LAYOUT_CACHE_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/PipelineLayoutFlags.h>
+#include "SharedObjectCache.h"
+#include <string>
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+Canonical representation of a pipeline layout descriptor to identify layouts with identical bindings, static samplers, and uniforms.
+Debug names are ignored, i.e. two descriptors that only differ in their debug names have the same signature.
+*/
+class LLGL_EXPORT PipelineLayoutSignature
+{
+
+    public:
+
+        PipelineLayoutSignature() = default;
+
+        PipelineLayoutSignature(const PipelineLayoutSignature&) = default;
+        PipelineLayoutSignature& operator = (const PipelineLayoutSignature&) = default;
+
+        PipelineLayoutSignature(PipelineLayoutSignature&&) = default;
+        PipelineLayoutSignature& operator = (PipelineLayoutSignature&&) = default;
+
+        // Builds the signature for the specified pipeline layout descriptor.
+        PipelineLayoutSignature(const PipelineLayoutDescriptor& desc);
+
+        // Returns the 64-bit FNV-1a hash of this signature.
+        inline std::uint64_t GetHash() const
+        {
+            return hash_;
+        }
+
+    public:
+
+        // Compares the two signatures in a strict-weak-order (SWO). The hash is compared first to keep most comparisons short.
+        static int CompareSWO(const PipelineLayoutSignature& lhs, const PipelineLayoutSignature& rhs);
+
+    private:
+
+        void Append(const void* data, std::size_t size);
+        void AppendString(const std::string& str);
+        void AppendBinding(const BindingDescriptor& binding);
+
+        template <typename T>
+        void AppendValue(const T& value)
+        {
+            Append(&value, sizeof(value));
+        }
+
+    private:
+
+        std::vector<char>   data_;
+        std::uint64_t       hash_   = 0;
+
+};
+
+// Container for pipeline layouts that shares a single instance between all layouts with identical signatures.
+template <typename T>
+using PipelineLayoutCache = SharedObjectCache<T, PipelineLayoutSignature>;
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
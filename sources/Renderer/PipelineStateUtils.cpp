@@ -100,6 +100,8 @@ LLGL_EXPORT SmallVector<Shader*, 5> GetShadersAsArray(const GraphicsPipelineDesc
     AddShaderIfSet(shaders, desc.tessEvaluationShader);
     AddShaderIfSet(shaders, desc.geometryShader);
     AddShaderIfSet(shaders, desc.fragmentShader);
+    AddShaderIfSet(shaders, desc.taskShader);
+    AddShaderIfSet(shaders, desc.meshShader);
     return shaders;
 }
 
@@ -23,11 +23,14 @@
 #include <LLGL/RenderSystem.h>
 #include <string>
 #include <unordered_map>
+#include <atomic>
+#include <mutex>
 
 #include "../Core/PrintfUtils.h"
 
 #ifdef LLGL_ENABLE_DEBUG_LAYER
 #   include "DebugLayer/DbgRenderSystem.h"
+#   include "DebugLayer/DbgProfileRenderSystem.h"
 #endif
 
 #include <LLGL/Platform/Platform.h>
@@ -50,6 +53,8 @@ struct RenderSystem::Pimpl
     std::string             name;
     RendererInfo            info;
     RenderingCapabilities   caps;
+    std::atomic<bool>       capsDeferred { false };
+    std::mutex              capsMutex;
     Report                  report;
 };
 
@@ -190,6 +195,23 @@ static RenderSystemDeleter::RenderSystemDeleterFuncPtr LoadRenderSystemDeleter(M
 
 #endif // /LLGL_BUILD_STATIC_LIB
 
+#ifdef LLGL_ENABLE_DEBUG_LAYER
+
+// Wraps the specified render system into the validating or the profile-only debug layer.
+static RenderSystemPtr WrapDebugLayer(RenderSystemPtr&& renderSystem, const RenderSystemDescriptor& renderSystemDesc)
+{
+    /* Frame capture is only supported by the profile-only layer, since it must not interfere with the captured frame */
+    if ((renderSystemDesc.flags & (RenderSystemFlags::ProfileOnly | RenderSystemFlags::FrameCapture)) != 0)
+    {
+        const bool frameCaptureEnabled = ((renderSystemDesc.flags & RenderSystemFlags::FrameCapture) != 0);
+        return RenderSystemPtr{ new DbgProfileRenderSystem{ std::move(renderSystem), renderSystemDesc.debugger, frameCaptureEnabled } };
+    }
+    else
+        return RenderSystemPtr{ new DbgRenderSystem{ std::move(renderSystem), renderSystemDesc.debugger } };
+}
+
+#endif // /LLGL_ENABLE_DEBUG_LAYER
+
 RenderSystemPtr RenderSystem::Load(const RenderSystemDescriptor& renderSystemDesc, Report* report)
 {
     /* Initialize mobile specific states */
@@ -209,7 +231,7 @@ RenderSystemPtr RenderSystem::Load(const RenderSystemDescriptor& renderSystemDes
         #ifdef LLGL_ENABLE_DEBUG_LAYER
 
         /* Create debug layer render system */
-        renderSystem = RenderSystemPtr{ new DbgRenderSystem{ std::move(renderSystem), renderSystemDesc.debugger } };
+        renderSystem = WrapDebugLayer(std::move(renderSystem), renderSystemDesc);
 
         #else
 
@@ -271,7 +293,7 @@ RenderSystemPtr RenderSystem::Load(const RenderSystemDescriptor& renderSystemDes
                 #ifdef LLGL_ENABLE_DEBUG_LAYER
 
                 /* Create debug layer render system */
-                renderSystem = RenderSystemPtr{ new DbgRenderSystem{ std::move(renderSystem), renderSystemDesc.debugger } };
+                renderSystem = WrapDebugLayer(std::move(renderSystem), renderSystemDesc);
 
                 #else
 
@@ -329,6 +351,18 @@ const RendererInfo& RenderSystem::GetRendererInfo() const
 
 const RenderingCapabilities& RenderSystem::GetRenderingCaps() const
 {
+    if (pimpl_->capsDeferred)
+    {
+        /* Query deferred capabilities only once, even if multiple threads request them at the same time */
+        std::lock_guard<std::mutex> guard{ pimpl_->capsMutex };
+        if (pimpl_->capsDeferred)
+        {
+            RenderingCapabilities caps;
+            const_cast<RenderSystem*>(this)->QueryDeferredRenderingCaps(caps);
+            pimpl_->caps = std::move(caps);
+            pimpl_->capsDeferred = false;
+        }
+    }
     return pimpl_->caps;
 }
 
@@ -361,7 +395,20 @@ void RenderSystem::SetRendererInfo(const RendererInfo& info)
 
 void RenderSystem::SetRenderingCaps(const RenderingCapabilities& caps)
 {
+    std::lock_guard<std::mutex> guard{ pimpl_->capsMutex };
     pimpl_->caps = caps;
+    pimpl_->capsDeferred = false;
+}
+
+void RenderSystem::DeferRenderingCaps()
+{
+    std::lock_guard<std::mutex> guard{ pimpl_->capsMutex };
+    pimpl_->capsDeferred = true;
+}
+
+void RenderSystem::QueryDeferredRenderingCaps(RenderingCapabilities& /*outCaps*/)
+{
+    // dummy
 }
 
 void RenderSystem::AssertCreateBuffer(const BufferDescriptor& bufferDesc, std::uint64_t maxSize)
@@ -389,6 +436,19 @@ void RenderSystem::AssertCreateBuffer(const BufferDescriptor& bufferDesc, std::u
         ((bufferDesc.bindFlags & (~validBindFlags)) == 0),
         "buffer descriptor with invalid binding flags 0x%08X", bufferDesc.bindFlags
     );
+
+    /* Readback buffers are only written by copy commands and read by the CPU */
+    if ((bufferDesc.miscFlags & MiscFlags::Readback) != 0)
+    {
+        LLGL_ASSERT(
+            ((bufferDesc.bindFlags & (~BindFlags::CopyDst)) == 0 && bufferDesc.cpuAccessFlags == CPUAccessFlags::Read),
+            "readback buffer descriptor with invalid binding flags 0x%08X or CPU access flags 0x%08X", bufferDesc.bindFlags, bufferDesc.cpuAccessFlags
+        );
+    }
+
+    /* Persistently mapped buffers must be accessible by the CPU */
+    if ((bufferDesc.miscFlags & MiscFlags::PersistentMapping) != 0)
+        LLGL_ASSERT(bufferDesc.cpuAccessFlags != 0, "persistently mapped buffer descriptor without CPU access flags");
 }
 
 static void AssertCreateResourceArrayCommon(std::uint32_t numResources, void* const * resourceArray, const char* resourceName)
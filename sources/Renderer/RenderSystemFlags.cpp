@@ -91,15 +91,25 @@ LLGL_EXPORT bool ValidateRenderingCaps(
     LLGL_VALIDATE_FEATURE( hasTessellationShaders,       "tessellation shaders"        );
     LLGL_VALIDATE_FEATURE( hasTessellatorStage,          "tessellator stage"           );
     LLGL_VALIDATE_FEATURE( hasComputeShaders,            "compute shaders"             );
+    LLGL_VALIDATE_FEATURE( hasMeshShaders,               "mesh shaders"                );
+    LLGL_VALIDATE_FEATURE( hasRayTracing,                "ray tracing"                 );
     LLGL_VALIDATE_FEATURE( hasInstancing,                "hardware instancing"         );
     LLGL_VALIDATE_FEATURE( hasOffsetInstancing,          "offset instancing"           );
     LLGL_VALIDATE_FEATURE( hasIndirectDrawing,           "indirect drawing"            );
+    LLGL_VALIDATE_FEATURE( hasIndirectDrawCount,         "indirect draw count"         );
     LLGL_VALIDATE_FEATURE( hasViewportArrays,            "viewport arrays"             );
     LLGL_VALIDATE_FEATURE( hasConservativeRasterization, "conservative rasterization"  );
     LLGL_VALIDATE_FEATURE( hasStreamOutputs,             "stream outputs"              );
     LLGL_VALIDATE_FEATURE( hasLogicOp,                   "logic fragment operations"   );
     LLGL_VALIDATE_FEATURE( hasPipelineStatistics,        "query pipeline statistics"   );
     LLGL_VALIDATE_FEATURE( hasRenderCondition,           "conditional rendering"       );
+    LLGL_VALIDATE_FEATURE( hasBufferRenderCondition,     "buffer render conditions"    );
+    LLGL_VALIDATE_FEATURE( hasBindlessDescriptors,       "bindless descriptors"        );
+    LLGL_VALIDATE_FEATURE( hasSparseTextures,            "sparse textures"             );
+    LLGL_VALIDATE_FEATURE( hasVariableRateShading,       "variable rate shading"       );
+    LLGL_VALIDATE_FEATURE( hasExtendedDynamicState,      "extended dynamic state"      );
+    LLGL_VALIDATE_FEATURE( hasTimestampCalibration,      "timestamp calibration"       );
+    LLGL_VALIDATE_FEATURE( hasSubpasses,                 "render subpasses"            );
 
     #undef LLGL_VALIDATE_FEATURE
 
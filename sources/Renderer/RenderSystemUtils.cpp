@@ -0,0 +1,86 @@
+/*
+ * RenderSystemUtils.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "RenderSystemUtils.h"
+#include "../Core/Assertion.h"
+#include <LLGL/Shader.h>
+#include <LLGL/Report.h>
+#include <LLGL/ThreadPool.h>
+#include <LLGL/Utils/ForRange.h>
+#include <exception>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+static bool HasShaderErrors(const Shader* shader)
+{
+    if (shader == nullptr)
+        return true;
+    if (const Report* report = shader->GetReport())
+        return report->HasErrors();
+    return false;
+}
+
+LLGL_EXPORT std::uint32_t CreateShaderBatch(
+    const ArrayView<ShaderDescriptor>&                      shaderDescs,
+    Shader**                                                outShaders,
+    const std::function<Shader*(const ShaderDescriptor&)>&  createShader,
+    bool                                                    concurrent)
+{
+    LLGL_ASSERT_PTR(outShaders);
+
+    const std::size_t numShaders = shaderDescs.size();
+    std::vector<std::exception_ptr> exceptions(numShaders);
+
+    auto CreateShaderRange = [&](std::size_t begin, std::size_t end)
+    {
+        for_subrange(i, begin, end)
+        {
+            /* Tasks of the thread pool must not throw, so exceptions are stored until all shaders have been processed */
+            try
+            {
+                outShaders[i] = createShader(shaderDescs[i]);
+            }
+            catch (...)
+            {
+                outShaders[i]   = nullptr;
+                exceptions[i]   = std::current_exception();
+            }
+        }
+    };
+
+    /* Each shader is a separate work item, since compile times can vary a lot between shaders */
+    if (concurrent && numShaders > 1)
+        ThreadPool::GetGlobal().ParallelRange(CreateShaderRange, numShaders, numShaders);
+    else
+        CreateShaderRange(0, numShaders);
+
+    /* Re-throw first exception on the calling thread */
+    for (const std::exception_ptr& e : exceptions)
+    {
+        if (e)
+            std::rethrow_exception(e);
+    }
+
+    std::uint32_t numSucceeded = 0;
+    for_range(i, numShaders)
+    {
+        if (!HasShaderErrors(outShaders[i]))
+            ++numSucceeded;
+    }
+    return numSucceeded;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
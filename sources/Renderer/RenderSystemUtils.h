@@ -11,13 +11,17 @@
 
 #include <LLGL/RenderSystemFlags.h>
 #include <LLGL/Container/ArrayView.h>
+#include <LLGL/ShaderFlags.h>
 #include "../Core/Exception.h"
+#include <functional>
 
 
 namespace LLGL
 {
 
 
+class Shader;
+
 // Validates and returns the renderer configuration structure from the render system descriptor.
 template <typename T>
 const T* GetRendererConfiguration(const RenderSystemDescriptor& renderSystemDesc)
@@ -59,6 +63,20 @@ const T* GetRendererNativeHandle(const RenderSystemDescriptor& renderSystemDesc)
     );
 }
 
+/*
+Creates a batch of shaders with the specified callback and returns the number of shaders that were compiled without errors.
+If 'concurrent' is true, the shaders are distributed over the global thread pool and the callback must be thread-safe.
+Exceptions thrown by the callback are caught per shader and the first one is re-thrown once all shaders have been processed.
+Used by all backends to implement RenderSystem::CreateShaders.
+*/
+LLGL_EXPORT std::uint32_t CreateShaderBatch(
+    const ArrayView<ShaderDescriptor>&                      shaderDescs,
+    Shader**                                                outShaders,
+    const std::function<Shader*(const ShaderDescriptor&)>&  createShader,
+    bool                                                    concurrent
+);
+
+
 
 } // /namespace LLGL
 
@@ -10,7 +10,9 @@
 #include <LLGL/Utils/TypeNames.h>
 #include <LLGL/Container/Strings.h>
 #include "../Core/StringUtils.h"
+#include <algorithm>
 #include <map>
+#include <cstdio>
 
 
 namespace LLGL
@@ -41,9 +43,16 @@ struct RenderingDebugger::Pimpl
     UTF8StringMap<Message>  errors;
     UTF8StringMap<Message>  warnings;
     FrameProfile            frameProfile;
-    const char*             source          = "";
-    const char*             groupName       = "";
-    bool                    isTimeRecording = false;
+    const char*             source              = "";
+    const char*             groupName           = "";
+    bool                    isTimeRecording     = false;
+    bool                    isPassRecording     = false;
+    std::uint32_t           samplingInterval    = 1;
+    bool                    isSampledPerCmdBuf  = false;
+    UTF8String              captureFilename;
+    bool                    isCaptureRequested  = false;
+    UTF8String              manifestFilename;
+    bool                    isManifestRequested = false;
 };
 
 
@@ -77,6 +86,70 @@ bool RenderingDebugger::GetTimeRecording() const
     return pimpl_->isTimeRecording;
 }
 
+void RenderingDebugger::SetPassRecording(bool enabled)
+{
+    pimpl_->isPassRecording = enabled;
+}
+
+bool RenderingDebugger::GetPassRecording() const
+{
+    return pimpl_->isPassRecording;
+}
+
+void RenderingDebugger::SetValidationSampling(std::uint32_t interval, bool perCommandBuffer)
+{
+    pimpl_->samplingInterval    = std::max(1u, interval);
+    pimpl_->isSampledPerCmdBuf  = perCommandBuffer;
+}
+
+std::uint32_t RenderingDebugger::GetValidationSamplingInterval() const
+{
+    return pimpl_->samplingInterval;
+}
+
+bool RenderingDebugger::IsValidationSampledPerCommandBuffer() const
+{
+    return pimpl_->isSampledPerCmdBuf;
+}
+
+void RenderingDebugger::CaptureFrame(const char* filename)
+{
+    if (filename != nullptr)
+    {
+        pimpl_->captureFilename     = filename;
+        pimpl_->isCaptureRequested  = true;
+    }
+    else
+    {
+        pimpl_->captureFilename.clear();
+        pimpl_->isCaptureRequested  = false;
+    }
+}
+
+const char* RenderingDebugger::GetFrameCaptureRequest() const
+{
+    return (pimpl_->isCaptureRequested ? pimpl_->captureFilename.c_str() : nullptr);
+}
+
+void RenderingDebugger::SavePipelineManifest(const char* filename)
+{
+    if (filename != nullptr)
+    {
+        pimpl_->manifestFilename    = filename;
+        pimpl_->isManifestRequested = true;
+    }
+    else
+    {
+        pimpl_->manifestFilename.clear();
+        pimpl_->isManifestRequested = false;
+    }
+}
+
+const char* RenderingDebugger::GetPipelineManifestRequest() const
+{
+    return (pimpl_->isManifestRequested ? pimpl_->manifestFilename.c_str() : nullptr);
+}
+
 void RenderingDebugger::Errorf(const ErrorType type, const char* format, ...)
 {
     /* Print formatted string */
@@ -171,7 +244,7 @@ static void MergeProfileCommandQueueRecords(ProfileCommandQueueRecord& dst, cons
 
 static void MergeProfileCommandBufferRecords(ProfileCommandBufferRecord& dst, const ProfileCommandBufferRecord& src)
 {
-    LLGL_ASSERT_STRUCT_FIELDS(ProfileCommandBufferRecord, 24);
+    LLGL_ASSERT_STRUCT_FIELDS(ProfileCommandBufferRecord, 26);
     dst.encodings                   += src.encodings                ;
     dst.mipMapsGenerations          += src.mipMapsGenerations       ;
     dst.vertexBufferBindings        += src.vertexBufferBindings     ;
@@ -196,6 +269,20 @@ static void MergeProfileCommandBufferRecords(ProfileCommandBufferRecord& dst, co
     dst.renderConditionSections     += src.renderConditionSections  ;
     dst.drawCommands                += src.drawCommands             ;
     dst.dispatchCommands            += src.dispatchCommands         ;
+    dst.stateChanges                += src.stateChanges             ;
+    dst.redundantStateChanges       += src.redundantStateChanges    ;
+}
+
+static void MergeProfileMemoryRecords(ProfileMemoryRecord& dst, const ProfileMemoryRecord& src)
+{
+    LLGL_ASSERT_STRUCT_FIELDS(ProfileMemoryRecord, 7);
+    dst.uploadedBytes       += src.uploadedBytes;
+    dst.readbackBytes       += src.readbackBytes;
+    dst.heapAllocations     += src.heapAllocations;
+    dst.heapAllocatedBytes  += src.heapAllocatedBytes;
+    dst.stagingMemoryUsage  = std::max(dst.stagingMemoryUsage, src.stagingMemoryUsage);
+    dst.deviceMemoryUsage   = std::max(dst.deviceMemoryUsage,  src.deviceMemoryUsage );
+    dst.hostMemoryUsage     = std::max(dst.hostMemoryUsage,    src.hostMemoryUsage   );
 }
 
 void RenderingDebugger::MergeProfiles(FrameProfile& dst, const FrameProfile& src)
@@ -203,9 +290,130 @@ void RenderingDebugger::MergeProfiles(FrameProfile& dst, const FrameProfile& src
     /* Accumulate counters */
     MergeProfileCommandQueueRecords(dst.commandQueueRecord, src.commandQueueRecord);
     MergeProfileCommandBufferRecords(dst.commandBufferRecord, src.commandBufferRecord);
+    MergeProfileMemoryRecords(dst.memoryRecord, src.memoryRecord);
 
-    /* Append time records */
+    /* Append time and pass records */
     dst.timeRecords.insert(dst.timeRecords.end(), src.timeRecords.begin(), src.timeRecords.end());
+    dst.passRecords.insert(dst.passRecords.end(), src.passRecords.begin(), src.passRecords.end());
+}
+
+// Appends the specified string as escaped JSON string literal.
+static void AppendJSONString(std::string& s, const char* str)
+{
+    s += '\"';
+    for (; *str != '\0'; ++str)
+    {
+        const char c = *str;
+        if (c == '\"' || c == '\\')
+        {
+            s += '\\';
+            s += c;
+        }
+        else if (static_cast<unsigned char>(c) < 0x20)
+        {
+            char hex[8];
+            std::snprintf(hex, sizeof(hex), "\\u%04x", static_cast<unsigned>(c));
+            s += hex;
+        }
+        else
+            s += c;
+    }
+    s += '\"';
+}
+
+// Appends a complete event ("ph":"X") in the Chrome Trace Event Format. Timestamps are converted from nanoseconds to microseconds.
+static void AppendChromeTraceEvent(std::string& s, const char* name, const char* category, int pid, std::uint32_t tid, std::uint64_t timestamp, std::uint64_t duration)
+{
+    char buf[160];
+    s += ",\n{\"name\":";
+    AppendJSONString(s, name);
+    std::snprintf(
+        buf, sizeof(buf), ",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":%d,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+        category, pid, tid, static_cast<double>(timestamp) / 1000.0, static_cast<double>(duration) / 1000.0
+    );
+    s += buf;
+}
+
+// Appends a metadata event ("ph":"M") in the Chrome Trace Event Format to name a process or thread.
+static void AppendChromeTraceMetadata(std::string& s, const char* metadata, int pid, std::uint32_t tid, const char* name)
+{
+    char buf[128];
+    std::snprintf(buf, sizeof(buf), "{\"name\":\"%s\",\"ph\":\"M\",\"pid\":%d,\"tid\":%u,\"args\":{\"name\":", metadata, pid, tid);
+    s += buf;
+    AppendJSONString(s, name);
+    s += "}}";
+}
+
+UTF8String RenderingDebugger::WriteChromeTrace(const FrameProfile& profile)
+{
+    constexpr int           cpuProcessID    = 1;
+    constexpr int           gpuProcessID    = 2;
+    constexpr std::uint32_t gpuQueueThread  = 1;
+
+    std::string s = "{\"traceEvents\":[\n";
+    AppendChromeTraceMetadata(s, "process_name", cpuProcessID, 0, "CPU");
+    s += ",\n";
+    AppendChromeTraceMetadata(s, "process_name", gpuProcessID, 0, "GPU");
+    s += ",\n";
+    AppendChromeTraceMetadata(s, "thread_name", gpuProcessID, gpuQueueThread, "Command Queue");
+
+    /* CPU timestamps are written relative to the first record */
+    std::uint64_t cpuBaseTimestamp = ~0ull;
+    for (const ProfileTimeRecord& record : profile.timeRecords)
+        cpuBaseTimestamp = std::min(cpuBaseTimestamp, record.cpuTimestamp);
+
+    /*
+    GPU timeline is reconstructed from elapsed times in submission order, since timer queries only measure durations.
+    Debug groups start at the current GPU time and span the accumulated time of their nested commands.
+    */
+    std::uint64_t   gpuTime                 = 0;
+    std::uint64_t   commandBufferGPUStart   = 0;
+    std::uint32_t   currentCommandBuffer    = ~0u;
+    char            commandBufferName[64];
+
+    auto FlushCommandBufferEvent = [&]()
+    {
+        if (currentCommandBuffer != ~0u && gpuTime > commandBufferGPUStart)
+        {
+            std::snprintf(commandBufferName, sizeof(commandBufferName), "Command Buffer #%u", currentCommandBuffer);
+            AppendChromeTraceEvent(s, commandBufferName, "CommandBuffer", gpuProcessID, gpuQueueThread, commandBufferGPUStart, gpuTime - commandBufferGPUStart);
+        }
+    };
+
+    for (std::size_t i = 0, n = profile.timeRecords.size(); i < n; ++i)
+    {
+        const ProfileTimeRecord& record = profile.timeRecords[i];
+        if (record.commandBuffer != currentCommandBuffer)
+        {
+            FlushCommandBufferEvent();
+            currentCommandBuffer    = record.commandBuffer;
+            commandBufferGPUStart   = gpuTime;
+
+            std::snprintf(commandBufferName, sizeof(commandBufferName), "Command Buffer #%u", currentCommandBuffer);
+            s += ",\n";
+            AppendChromeTraceMetadata(s, "thread_name", cpuProcessID, currentCommandBuffer + 1, commandBufferName);
+        }
+
+        const char* annotation = (record.annotation != nullptr ? record.annotation : "");
+
+        AppendChromeTraceEvent(
+            s, annotation, "CPU", cpuProcessID, record.commandBuffer + 1, record.cpuTimestamp - cpuBaseTimestamp, record.cpuElapsedTime
+        );
+        AppendChromeTraceEvent(
+            s, annotation, "GPU", gpuProcessID, gpuQueueThread, gpuTime, record.elapsedTime
+        );
+
+        /* Only commands advance the GPU timeline; debug groups are followed by the records of their nested commands */
+        const bool isDebugGroup = (i + 1 < n && profile.timeRecords[i + 1].depth > record.depth);
+        if (!isDebugGroup)
+            gpuTime += record.elapsedTime;
+    }
+
+    FlushCommandBufferEvent();
+
+    s += "\n]}\n";
+
+    return s;
 }
 
 
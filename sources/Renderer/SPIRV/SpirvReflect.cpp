@@ -8,7 +8,8 @@
 #include "SpirvReflect.h"
 #include "SpirvModule.h"
 #include "../../Core/CoreUtils.h"
-#include <string>
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
 
 
 namespace LLGL
@@ -21,6 +22,8 @@ namespace LLGL
 
 SpirvResult SpirvReflect::Reflect(const SpirvModuleView& module)
 {
+    Clear();
+
     /* Parse SPIR-V header */
     SpirvHeader header;
     SpirvResult result = module.ReadHeader(header);
@@ -29,281 +32,90 @@ SpirvResult SpirvReflect::Reflect(const SpirvModuleView& module)
 
     idBound_ = header.idBound;
     names_.Reset(header.idBound);
+    indices_.resize(header.idBound, ~0u);
 
     /* Parse each SPIR-V instruction in the module */
-    for (SpirvInstruction instr : module)
+    for (auto it = module.begin(); it != module.end(); ++it)
     {
+        SpirvInstruction instr = it.Get();
+
         if (instr.opcode == spv::Op::OpFunction)
         {
             /* No more declarations and decorations after first OpFunction instruction */
             break;
         }
 
-        result = ParseInstruction(instr);
+        result = ParseInstruction(instr, module.WordOffset(it));
         if (result != SpirvResult::NoError)
-            return result;
-    }
-
-    return SpirvResult::NoError;
-}
-
-static void ParseSpvExecutionMode(const SpirvInstruction& instr, SpirvReflect::SpvExecutionMode& outExecutionMode)
-{
-    auto mode = static_cast<spv::ExecutionMode>(instr.GetUInt32(1));
-    switch (mode)
-    {
-        case spv::ExecutionModeEarlyFragmentTests:
-            outExecutionMode.earlyFragmentTest = true;
-            break;
-
-        case spv::ExecutionModeOriginUpperLeft:
-            outExecutionMode.originUpperLeft = true;
-            break;
-
-        case spv::ExecutionModeDepthGreater:
-            outExecutionMode.depthGreater = true;
-            break;
-
-        case spv::ExecutionModeDepthLess:
-            outExecutionMode.depthLess = true;
-            break;
-
-        case spv::ExecutionModeLocalSize:
-            outExecutionMode.localSizeX = instr.GetUInt32(2);
-            outExecutionMode.localSizeY = instr.GetUInt32(3);
-            outExecutionMode.localSizeZ = instr.GetUInt32(4);
-            break;
-
-        default:
             break;
     }
-}
-
-SpirvResult SpirvReflectExecutionMode(const SpirvModuleView& module, SpirvReflect::SpvExecutionMode& outExecutionMode)
-{
-    /* Parse SPIR-V header */
-    SpirvHeader header;
-    SpirvResult result = module.ReadHeader(header);
-    if (result != SpirvResult::NoError)
-        return result;
 
-    /* Parse each SPIR-V instruction in the module */
-    bool firstModeParsed = false;
-
-    for (SpirvInstruction instr : module)
+    if (result == SpirvResult::NoError)
     {
-        if (instr.opcode == spv::Op::OpExecutionMode)
-        {
-            ParseSpvExecutionMode(instr, outExecutionMode);
-            firstModeParsed = true;
-        }
-        else if (firstModeParsed)
-        {
-            /* Stop parsing after we found all execution modes */
-            break;
-        }
+        ResolveReferences();
+        ResolvePushConstants();
     }
 
-    return SpirvResult::NoError;
-}
+    /* Release intermediate containers that are only required while parsing */
+    names_.Clear();
+    std::vector<spv::Id>().swap(fieldTypeIds_);
+    std::vector<SpvMember>().swap(members_);
 
-static spv::Id FindGlobalPushConstantVariableType(const SpirvModuleView& module)
-{
-    for (SpirvInstruction instr : module)
-    {
-        if (instr.opcode == spv::Op::OpVariable)
-        {
-            /* OpVariable ResultType ResultId StorageClass[0] (Initializer[1]) */
-            auto storage = static_cast<spv::StorageClass>(instr.GetUInt32(0));
-            if (storage == spv::StorageClassPushConstant)
-            {
-                /* Return variable type; Must be OpTypePointer for push constants */
-                return instr.type;
-            }
-        }
-        else if (instr.opcode == spv::Op::OpFunction)
-        {
-            /* No more declarations and decorations after first OpFunction instruction */
-            break;
-        }
-    }
-    return 0;
+    return result;
 }
 
-static spv::Id FindPointerTypeSubtype(const SpirvModuleView& module, spv::Id pointerTypeId)
+void SpirvReflect::Clear()
 {
-    for (SpirvInstruction instr : module)
-    {
-        if (instr.opcode == spv::Op::OpTypePointer)
-        {
-            if (instr.result == pointerTypeId)
-            {
-                /* OpTypePointer ResultId StorageClass[0] SubTypeId[1] */
-                return instr.GetUInt32(1);
-            }
-        }
-        else if (instr.opcode == spv::Op::OpFunction)
-        {
-            /* No more declarations and decorations after first OpFunction instruction */
-            break;
-        }
-    }
-    return 0;
+    idBound_ = 0;
+    names_.Clear();
+    indices_.clear();
+    types_.clear();
+    constants_.clear();
+    uniforms_.clear();
+    varyings_.clear();
+    fieldTypeIds_.clear();
+    fieldTypes_.clear();
+    members_.clear();
+    executionMode_      = SpvExecutionMode{};
+    pushConstantTypeId_ = 0;
+    pushConstants_      = SpvBlock{};
 }
 
-SpirvResult SpirvReflectPushConstants(const SpirvModuleView& module, SpirvReflect::SpvBlock& outBlock)
+const SpirvReflect::SpvType* SpirvReflect::FindType(spv::Id id) const
 {
-    /* Parse SPIR-V header */
-    SpirvHeader header;
-    SpirvResult result = module.ReadHeader(header);
-    if (result != SpirvResult::NoError)
-        return result;
-
-    /* Find global variable declaration with PushConstant storage class */
-    const spv::Id pushConstantVarId = FindGlobalPushConstantVariableType(module);
-    if (pushConstantVarId == 0)
-        return SpirvResult::NoError;
-
-    /* Find pointer subtype for push constant variable */
-    const spv::Id pushConstantTypeId = FindPointerTypeSubtype(module, pushConstantVarId);
-    if (pushConstantTypeId == 0)
-        return SpirvResult::IdTypeMismatch;
-
-    auto GetOrMakeBlockField = [&outBlock](std::uint32_t index) -> SpirvReflect::SpvBlockField&
-    {
-        if (index >= outBlock.fields.size())
-            outBlock.fields.resize(index + 1);
-        return outBlock.fields[index];
-    };
-
-    /* Now parse SPIR-V module for block name, its member names, and member offsets */
-    for (SpirvInstruction instr : module)
+    if (id < indices_.size())
     {
-        if (instr.opcode == spv::Op::OpFunction)
-        {
-            /* No more declarations and decorations after first OpFunction instruction */
-            break;
-        }
-
-        switch (instr.opcode)
-        {
-            case spv::Op::OpName:
-                /* OpName Target[0] Name[1] */
-                if (instr.numOperands < 2)
-                    return SpirvResult::OperandOutOfBounds;
-                if (instr.GetUInt32(0) == pushConstantTypeId)
-                    outBlock.name = instr.GetString(1);
-                break;
-
-            case spv::Op::OpMemberName:
-                /* OpMemberName TypeId Member[0] Name[1] */
-                if (instr.numOperands < 2)
-                    return SpirvResult::OperandOutOfBounds;
-                if (instr.type == pushConstantTypeId)
-                    GetOrMakeBlockField(instr.GetUInt32(0)).name = instr.GetString(1);
-                break;
-
-            case spv::Op::OpMemberDecorate:
-                /* OpMemberDecorate Target[0] Member[1] Decoration[2] (Values[3+]) */
-                if (instr.numOperands < 3)
-                    return SpirvResult::OperandOutOfBounds;
-                if (instr.GetUInt32(0) == pushConstantTypeId)
-                {
-                    const auto decoration = static_cast<spv::Decoration>(instr.GetUInt32(2));
-                    if (decoration == spv::DecorationOffset)
-                    {
-                        if (instr.numOperands < 4)
-                            return SpirvResult::OperandOutOfBounds;
-                        GetOrMakeBlockField(instr.GetUInt32(1)).offset = instr.GetUInt32(3);
-                    }
-                }
-                break;
-
-            default:
-                break;
-        }
+        const std::uint32_t index = indices_[id];
+        if (index < types_.size() && types_[index].result == id)
+            return &(types_[index]);
     }
-
-    return SpirvResult::NoError;
+    return nullptr;
 }
 
-static SpirvReflect::SpvBindingPoint* FindOrInsertBindingPoint(std::vector<SpirvReflect::SpvBindingPoint>& bindingPoints, spv::Id varId)
+const SpirvReflect::SpvConstant* SpirvReflect::FindConstant(spv::Id id) const
 {
-    /* Try to find binding point for specified variable ID */
-    std::size_t insertionPos = 0;
-    auto* bindingPoint = FindInSortedArray<SpirvReflect::SpvBindingPoint>(
-        bindingPoints.data(), bindingPoints.size(),
-        [varId](const SpirvReflect::SpvBindingPoint& entry) -> int
-        {
-            return (static_cast<int>(varId) - static_cast<int>(entry.id));
-        },
-        &insertionPos
-    );
-    if (bindingPoint == nullptr)
+    if (id < indices_.size())
     {
-        /* Insert new binding point */
-        bindingPoints.insert(bindingPoints.begin() + insertionPos, SpirvReflect::SpvBindingPoint{});
-        bindingPoint = &(bindingPoints[insertionPos]);
+        const std::uint32_t index = indices_[id];
+        if (index < constants_.size() && constants_[index].result == id)
+            return &(constants_[index]);
     }
-    return bindingPoint;
+    return nullptr;
 }
 
-SpirvResult SpirvReflectBindingPoints(const SpirvModuleView& module, std::vector<SpirvReflect::SpvBindingPoint>& outBindingPoints)
+bool SpirvReflect::ReflectUniformBlock(const SpvUniform& uniform, SpvBlock& outBlock) const
 {
-    /* Parse SPIR-V header */
-    SpirvHeader header;
-    SpirvResult result = module.ReadHeader(header);
-    if (result != SpirvResult::NoError)
-        return result;
-
-    /* Now parse SPIR-V module for binding and descriptor set decorations */
-    const auto estimatedNumBindingPoints = header.idBound / 16u;
-
-    outBindingPoints.clear();
-    outBindingPoints.reserve(estimatedNumBindingPoints);
-
-    for (auto it = module.begin(); it != module.end(); ++it)
-    {
-        SpirvInstruction instr = it.Get();
+    outBlock = SpvBlock{};
 
-        if (instr.opcode == spv::Op::OpFunction)
-        {
-            /* No more declarations and decorations after first OpFunction instruction */
-            break;
-        }
+    if (uniform.type == nullptr)
+        return false;
 
-        if (instr.opcode == spv::Op::OpDecorate)
-        {
-            /* OpDecorate Target[0] Decoration[1] Value[2] */
-            if (instr.numOperands < 2)
-                return SpirvResult::OperandOutOfBounds;
-            const spv::Id varId = instr.GetUInt32(0);
-
-            /* Add entry for either binding or descriptor set */
-            const auto decoration = static_cast<spv::Decoration>(instr.GetUInt32(1));
-            if (decoration == spv::DecorationDescriptorSet ||
-                decoration == spv::DecorationBinding)
-            {
-                if (instr.numOperands < 3)
-                    return SpirvResult::OperandOutOfBounds;
-
-                auto* binding = FindOrInsertBindingPoint(outBindingPoints, varId);
-                binding->id = varId;
-                if (decoration == spv::DecorationDescriptorSet)
-                {
-                    binding->set                = instr.GetUInt32(2);
-                    binding->setWordOffset      = module.WordOffset(it) + 3;
-                }
-                else
-                {
-                    binding->binding            = instr.GetUInt32(2);
-                    binding->bindingWordOffset  = module.WordOffset(it) + 3;
-                }
-            }
-        }
-    }
+    const SpvType* blockType = uniform.type->Deref(spv::Op::OpTypeStruct);
+    if (blockType == nullptr)
+        return false;
 
-    return SpirvResult::NoError;
+    GatherBlockFields(*blockType, outBlock);
+    return true;
 }
 
 
@@ -311,14 +123,20 @@ SpirvResult SpirvReflectBindingPoints(const SpirvModuleView& module, std::vector
  * ======= Private: =======
  */
 
-SpirvResult SpirvReflect::ParseInstruction(const SpirvInstruction& instr)
+SpirvResult SpirvReflect::ParseInstruction(const SpirvInstruction& instr, std::uint32_t wordOffset)
 {
     switch (instr.opcode)
     {
         case spv::Op::OpName:
             return OpName(instr);
+        case spv::Op::OpMemberName:
+            return OpMemberName(instr);
+        case spv::Op::OpExecutionMode:
+            return OpExecutionMode(instr);
         case spv::Op::OpDecorate:
-            return OpDecorate(instr);
+            return OpDecorate(instr, wordOffset);
+        case spv::Op::OpMemberDecorate:
+            return OpMemberDecorate(instr);
         case spv::Op::OpTypeVoid:
         case spv::Op::OpTypeBool:
         case spv::Op::OpTypeInt:
@@ -338,6 +156,7 @@ SpirvResult SpirvReflect::ParseInstruction(const SpirvInstruction& instr)
         case spv::Op::OpVariable:
             return OpVariable(instr);
         case spv::Op::OpConstant:
+        case spv::Op::OpSpecConstant:
             return OpConstant(instr);
         default:
             return SpirvResult::NoError;
@@ -346,6 +165,10 @@ SpirvResult SpirvReflect::ParseInstruction(const SpirvInstruction& instr)
 
 SpirvResult SpirvReflect::OpName(const Instr& instr)
 {
+    /* OpName Target[0] Name[1] */
+    if (instr.numOperands < 2)
+        return SpirvResult::OperandOutOfBounds;
+
     const spv::Id id = instr.GetUInt32(0);
     if (!(id < idBound_))
         return SpirvResult::IdOutOfBounds;
@@ -354,8 +177,61 @@ SpirvResult SpirvReflect::OpName(const Instr& instr)
     return SpirvResult::NoError;
 }
 
-SpirvResult SpirvReflect::OpDecorate(const Instr& instr)
+SpirvResult SpirvReflect::OpMemberName(const Instr& instr)
+{
+    /* OpMemberName TypeId Member[0] Name[1] */
+    if (instr.numOperands < 2)
+        return SpirvResult::OperandOutOfBounds;
+
+    GetOrMakeMember(instr.type, instr.GetUInt32(0)).name = instr.GetString(1);
+    return SpirvResult::NoError;
+}
+
+SpirvResult SpirvReflect::OpExecutionMode(const Instr& instr)
 {
+    /* OpExecutionMode EntryPoint[0] Mode[1] (Literals[2+]) */
+    if (instr.numOperands < 2)
+        return SpirvResult::OperandOutOfBounds;
+
+    auto mode = static_cast<spv::ExecutionMode>(instr.GetUInt32(1));
+    switch (mode)
+    {
+        case spv::ExecutionModeEarlyFragmentTests:
+            executionMode_.earlyFragmentTest = true;
+            break;
+
+        case spv::ExecutionModeOriginUpperLeft:
+            executionMode_.originUpperLeft = true;
+            break;
+
+        case spv::ExecutionModeDepthGreater:
+            executionMode_.depthGreater = true;
+            break;
+
+        case spv::ExecutionModeDepthLess:
+            executionMode_.depthLess = true;
+            break;
+
+        case spv::ExecutionModeLocalSize:
+            if (instr.numOperands < 5)
+                return SpirvResult::OperandOutOfBounds;
+            executionMode_.localSizeX = instr.GetUInt32(2);
+            executionMode_.localSizeY = instr.GetUInt32(3);
+            executionMode_.localSizeZ = instr.GetUInt32(4);
+            break;
+
+        default:
+            break;
+    }
+    return SpirvResult::NoError;
+}
+
+SpirvResult SpirvReflect::OpDecorate(const Instr& instr, std::uint32_t wordOffset)
+{
+    /* OpDecorate Target[0] Decoration[1] (Values[2+]) */
+    if (instr.numOperands < 2)
+        return SpirvResult::OperandOutOfBounds;
+
     const spv::Id id = instr.GetUInt32(0);
     if (!(id < idBound_))
         return SpirvResult::IdOutOfBounds;
@@ -363,8 +239,24 @@ SpirvResult SpirvReflect::OpDecorate(const Instr& instr)
     auto decoration = static_cast<spv::Decoration>(instr.GetUInt32(1));
     switch (decoration)
     {
+        case spv::DecorationDescriptorSet:
+        case spv::DecorationBinding:
+        case spv::DecorationLocation:
+        case spv::DecorationBuiltIn:
+            if (instr.numOperands < 3)
+                return SpirvResult::OperandOutOfBounds;
+            break;
+        default:
+            return SpirvResult::NoError;
+    }
+
+    switch (decoration)
+    {
+        case spv::DecorationDescriptorSet:
+            OpDecorateDescriptorSet(instr, id, wordOffset);
+            break;
         case spv::DecorationBinding:
-            OpDecorateBinding(instr, id);
+            OpDecorateBinding(instr, id, wordOffset);
             break;
         case spv::DecorationLocation:
             OpDecorateLocation(instr, id);
@@ -378,30 +270,56 @@ SpirvResult SpirvReflect::OpDecorate(const Instr& instr)
     return SpirvResult::NoError;
 }
 
-void SpirvReflect::OpDecorateBinding(const Instr& instr, spv::Id id)
+SpirvResult SpirvReflect::OpMemberDecorate(const Instr& instr)
+{
+    /* OpMemberDecorate Target[0] Member[1] Decoration[2] (Values[3+]) */
+    if (instr.numOperands < 3)
+        return SpirvResult::OperandOutOfBounds;
+
+    const auto decoration = static_cast<spv::Decoration>(instr.GetUInt32(2));
+    if (decoration == spv::DecorationOffset)
+    {
+        if (instr.numOperands < 4)
+            return SpirvResult::OperandOutOfBounds;
+        GetOrMakeMember(instr.GetUInt32(0), instr.GetUInt32(1)).offset = instr.GetUInt32(3);
+    }
+    return SpirvResult::NoError;
+}
+
+// Word offset of the first value of an OpDecorate instruction, i.e. its opcode word, target, and decoration are skipped.
+static constexpr std::uint32_t g_decorationValueWordOffset = 3;
+
+void SpirvReflect::OpDecorateDescriptorSet(const Instr& instr, spv::Id id, std::uint32_t wordOffset)
 {
-    auto& variable = uniforms_[id];
+    auto& variable = GetOrMakeUniform(id);
     {
-        variable.name       = names_[id];
-        variable.binding    = instr.GetUInt32(2);
+        variable.set            = instr.GetUInt32(2);
+        variable.setWordOffset  = wordOffset + g_decorationValueWordOffset;
+    }
+}
+
+void SpirvReflect::OpDecorateBinding(const Instr& instr, spv::Id id, std::uint32_t wordOffset)
+{
+    auto& variable = GetOrMakeUniform(id);
+    {
+        variable.binding            = instr.GetUInt32(2);
+        variable.bindingWordOffset  = wordOffset + g_decorationValueWordOffset;
     }
 }
 
 void SpirvReflect::OpDecorateLocation(const Instr& instr, spv::Id id)
 {
-    auto& variable = varyings_[id];
+    auto& variable = GetOrMakeVarying(id);
     {
-        variable.name       = names_[id];
-        variable.location   = instr.GetUInt32(2);
+        variable.location = instr.GetUInt32(2);
     }
 }
 
 void SpirvReflect::OpDecorateBuiltin(const Instr& instr, spv::Id id)
 {
-    auto& variable = varyings_[id];
+    auto& variable = GetOrMakeVarying(id);
     {
-        variable.name       = names_[id];
-        variable.builtin    = static_cast<spv::BuiltIn>(instr.GetUInt32(2));
+        variable.builtin = static_cast<spv::BuiltIn>(instr.GetUInt32(2));
     }
 }
 
@@ -416,46 +334,40 @@ Example:
 */
 SpirvResult SpirvReflect::OpVariable(const Instr& instr)
 {
+    /* OpVariable ResultType ResultId StorageClass[0] (Initializer[1]) */
+    if (instr.numOperands < 1)
+        return SpirvResult::OperandOutOfBounds;
+    if (!(instr.result < idBound_))
+        return SpirvResult::IdOutOfBounds;
+
     auto storage = static_cast<spv::StorageClass>(instr.GetUInt32(0));
 
     switch (storage)
     {
         case spv::StorageClassUniform:
         case spv::StorageClassUniformConstant:
-        //case spv::StorageClass::PushConstant:
         {
-            auto& var = uniforms_[instr.result];
-            {
-                var.type = FindType(instr.type);
-                if (auto structType = var.type->Deref(spv::Op::OpTypeStruct))
-                {
-                    if (var.name == nullptr || *var.name == '\0')
-                        var.name = structType->name;
-                    var.size = structType->size;
-                }
-                else
-                    var.size = var.type->size;
-            }
+            /* Uniform size is determined once all type references are resolved */
+            GetOrMakeUniform(instr.result).typeId = instr.type;
         }
         break;
 
         case spv::StorageClassInput:
+        case spv::StorageClassOutput:
         {
-            auto& var = varyings_[instr.result];
+            auto& var = GetOrMakeVarying(instr.result);
             {
-                var.type    = FindType(instr.type);
-                var.input   = true;
+                var.typeId  = instr.type;
+                var.input   = (storage == spv::StorageClassInput);
             }
         }
         break;
 
-        case spv::StorageClassOutput:
+        case spv::StorageClassPushConstant:
         {
-            auto& var = varyings_[instr.result];
-            {
-                var.type    = FindType(instr.type);
-                var.input   = false;
-            }
+            /* Keep first push constant variable; its type must be OpTypePointer */
+            if (pushConstantTypeId_ == 0)
+                pushConstantTypeId_ = instr.type;
         }
         break;
 
@@ -468,25 +380,39 @@ SpirvResult SpirvReflect::OpVariable(const Instr& instr)
 
 SpirvResult SpirvReflect::OpConstant(const Instr& instr)
 {
-    auto& val = constants_[instr.result];
+    /* OpConstant ResultType ResultId Value[0] */
+    if (instr.numOperands < 1)
+        return SpirvResult::OperandOutOfBounds;
+    if (!(instr.result < idBound_))
+        return SpirvResult::IdOutOfBounds;
+
+    indices_[instr.result] = static_cast<std::uint32_t>(constants_.size());
+    constants_.push_back(SpvConstant{});
+
+    auto& val = constants_.back();
     {
-        val.type = FindType(instr.type);
+        val.result  = instr.result;
+        val.typeId  = instr.type;
+        val.u64     = 0;
 
-        if (val.type->opcode == spv::Op::OpTypeInt)
-        {
-            if (val.type->size == 2 || val.type->size == 4)
-                val.u32 = instr.GetUInt32(0);
-            else if (val.type->size == 8)
-                val.u64 = instr.GetUInt64(0);
-        }
-        else if (val.type->opcode == spv::Op::OpTypeFloat)
+        if (const SpvType* type = FindType(instr.type))
         {
-            if (val.type->size == 2)
-                val.f32 = instr.GetFloat16(0);
-            else if (val.type->size == 4)
-                val.f32 = instr.GetFloat32(0);
-            else if (val.type->size == 8)
-                val.f64 = instr.GetFloat64(0);
+            if (type->opcode == spv::Op::OpTypeInt)
+            {
+                if (type->size == 2 || type->size == 4)
+                    val.u32 = instr.GetUInt32(0);
+                else if (type->size == 8 && instr.numOperands >= 2)
+                    val.u64 = instr.GetUInt64(0);
+            }
+            else if (type->opcode == spv::Op::OpTypeFloat)
+            {
+                if (type->size == 2)
+                    val.f32 = instr.GetFloat16(0);
+                else if (type->size == 4)
+                    val.f32 = instr.GetFloat32(0);
+                else if (type->size == 8 && instr.numOperands >= 2)
+                    val.f64 = instr.GetFloat64(0);
+            }
         }
     }
     return SpirvResult::NoError;
@@ -498,13 +424,35 @@ SpirvResult SpirvReflect::OpType(const Instr& instr)
         return SpirvResult::IdOutOfBounds;
 
     /* Register type and store it as current type to operate on */
-    auto& type = types_[instr.result];
+    indices_[instr.result] = static_cast<std::uint32_t>(types_.size());
+    types_.push_back(SpvType{});
+
+    auto& type = types_.back();
     {
         type.opcode = instr.opcode;
         type.result = instr.result;
         type.name   = names_[instr.result];
     }
 
+    /* Validate minimum number of operands of respective OpType* instruction */
+    switch (instr.opcode)
+    {
+        case spv::Op::OpTypePointer:
+        case spv::Op::OpTypeArray:
+        case spv::Op::OpTypeVector:
+        case spv::Op::OpTypeMatrix:
+        case spv::Op::OpTypeInt:
+            if (instr.numOperands < 2)
+                return SpirvResult::OperandOutOfBounds;
+            break;
+        case spv::Op::OpTypeFloat:
+            if (instr.numOperands < 1)
+                return SpirvResult::OperandOutOfBounds;
+            break;
+        default:
+            break;
+    }
+
     /* Parse respective OpType* instruction */
     #define LLGL_OPTYPE_CASE_HANDLER(NAME)  \
         case spv::Op::NAME:                 \
@@ -560,16 +508,18 @@ void SpirvReflect::OpTypeFloat(const Instr& instr, SpvType& type)
 
 void SpirvReflect::OpTypeVector(const Instr& instr, SpvType& type)
 {
-    type.baseType   = FindType(instr.GetUInt32(0));
+    type.baseTypeId = instr.GetUInt32(0);
     type.elements   = instr.GetUInt32(1);
-    type.size       = type.baseType->size * type.elements;
+    if (const SpvType* baseType = FindType(type.baseTypeId))
+        type.size = baseType->size * type.elements;
 }
 
 void SpirvReflect::OpTypeMatrix(const Instr& instr, SpvType& type)
 {
-    type.baseType   = FindType(instr.GetUInt32(0));
+    type.baseTypeId = instr.GetUInt32(0);
     type.elements   = instr.GetUInt32(1);
-    type.size       = type.baseType->size * type.elements;
+    if (const SpvType* baseType = FindType(type.baseTypeId))
+        type.size = baseType->size * type.elements;
 }
 
 void SpirvReflect::OpTypeImage(const Instr& instr, SpvType& type)
@@ -589,9 +539,10 @@ void SpirvReflect::OpTypeSampledImage(const Instr& instr, SpvType& type)
 
 void SpirvReflect::OpTypeArray(const Instr& instr, SpvType& type)
 {
-    type.baseType = FindType(instr.GetUInt32(0));
-    auto arrayVal = FindConstant(instr.GetUInt32(1));
-    type.elements = arrayVal->i32;
+    /* Array length can be a specialization constant, in which case its default value is used */
+    type.baseTypeId = instr.GetUInt32(0);
+    if (const SpvConstant* arrayVal = FindConstant(instr.GetUInt32(1)))
+        type.elements = arrayVal->u32;
 }
 
 void SpirvReflect::OpTypeRuntimeArray(const Instr& instr, SpvType& type)
@@ -611,12 +562,16 @@ static void AccumulateSizeInVectorBoundary(std::uint32_t& size, std::uint32_t al
 
 void SpirvReflect::OpTypeStruct(const Instr& instr, SpvType& type)
 {
-    type.fieldTypes.reserve(instr.numOperands);
-    for (std::uint32_t i = 0; i < instr.numOperands; ++i)
+    /* Store field type IDs in the arena; they are resolved to pointers once the module has been parsed */
+    type.firstField = static_cast<std::uint32_t>(fieldTypeIds_.size());
+    type.numFields  = instr.numOperands;
+
+    for_range(i, instr.numOperands)
     {
-        auto fieldType = FindType(instr.GetUInt32(i));
-        type.fieldTypes.push_back(fieldType);
-        AccumulateSizeInVectorBoundary(type.size, 16, fieldType->size);
+        const spv::Id fieldTypeId = instr.GetUInt32(i);
+        fieldTypeIds_.push_back(fieldTypeId);
+        if (const SpvType* fieldType = FindType(fieldTypeId))
+            AccumulateSizeInVectorBoundary(type.size, 16, fieldType->size);
     }
     type.size = GetAlignedSize(type.size, 16u);
 }
@@ -629,7 +584,7 @@ void SpirvReflect::OpTypeOpaque(const Instr& instr, SpvType& type)
 void SpirvReflect::OpTypePointer(const Instr& instr, SpvType& type)
 {
     type.storage    = static_cast<spv::StorageClass>(instr.GetUInt32(0));
-    type.baseType   = FindType(instr.GetUInt32(1));
+    type.baseTypeId = instr.GetUInt32(1);
 }
 
 void SpirvReflect::OpTypeFunction(const Instr& instr, SpvType& type)
@@ -637,20 +592,141 @@ void SpirvReflect::OpTypeFunction(const Instr& instr, SpvType& type)
     //todo
 }
 
-const SpirvReflect::SpvType* SpirvReflect::FindType(spv::Id id) const
+SpirvReflect::SpvMember& SpirvReflect::GetOrMakeMember(spv::Id structId, std::uint32_t index)
 {
-    auto it = types_.find(id);
-    if (it == types_.end())
-        throw std::runtime_error("cannot find SPIR-V OpType* instruction with result ID %" + std::to_string(id));
-    return &(it->second);
+    /*
+    Member names and member decorations are declared in consecutive order per structure, so only the trailing members are searched.
+    Names and decorations are declared in different sections of the module; their duplicate entries are merged in ResolvePushConstants().
+    */
+    for (auto it = members_.rbegin(); it != members_.rend(); ++it)
+    {
+        if (it->structId == structId && it->index == index)
+            return *it;
+        if (it->structId != structId)
+            break;
+    }
+    members_.push_back(SpvMember{});
+    SpvMember& member = members_.back();
+    {
+        member.structId = structId;
+        member.index    = index;
+    }
+    return member;
 }
 
-const SpirvReflect::SpvConstant* SpirvReflect::FindConstant(spv::Id id) const
+SpirvReflect::SpvUniform& SpirvReflect::GetOrMakeUniform(spv::Id id)
+{
+    std::uint32_t& index = indices_[id];
+    if (index < uniforms_.size() && uniforms_[index].id == id)
+        return uniforms_[index];
+
+    index = static_cast<std::uint32_t>(uniforms_.size());
+    uniforms_.push_back(SpvUniform{});
+    SpvUniform& uniform = uniforms_.back();
+    {
+        uniform.id      = id;
+        uniform.name    = names_[id];
+    }
+    return uniform;
+}
+
+SpirvReflect::SpvVarying& SpirvReflect::GetOrMakeVarying(spv::Id id)
 {
-    auto it = constants_.find(id);
-    if (it == constants_.end())
-        throw std::runtime_error("cannot find SPIR-V OpConstant instruction with with result ID %" + std::to_string(id));
-    return &(it->second);
+    std::uint32_t& index = indices_[id];
+    if (index < varyings_.size() && varyings_[index].id == id)
+        return varyings_[index];
+
+    index = static_cast<std::uint32_t>(varyings_.size());
+    varyings_.push_back(SpvVarying{});
+    SpvVarying& varying = varyings_.back();
+    {
+        varying.id      = id;
+        varying.name    = names_[id];
+    }
+    return varying;
+}
+
+void SpirvReflect::ResolveReferences()
+{
+    /* Resolve type references; the containers do not grow anymore, so their pointers remain valid */
+    fieldTypes_.resize(fieldTypeIds_.size());
+    for_range(i, fieldTypeIds_.size())
+        fieldTypes_[i] = FindType(fieldTypeIds_[i]);
+
+    for (SpvType& type : types_)
+    {
+        type.baseType = FindType(type.baseTypeId);
+        if (type.opcode == spv::Op::OpTypeStruct)
+            type.fieldTypes = ArrayView<const SpvType*>(fieldTypes_.data() + type.firstField, type.numFields);
+    }
+
+    for (SpvConstant& constant : constants_)
+        constant.type = FindType(constant.typeId);
+
+    for (SpvVarying& varying : varyings_)
+        varying.type = FindType(varying.typeId);
+
+    for (SpvUniform& uniform : uniforms_)
+    {
+        uniform.type = FindType(uniform.typeId);
+        if (uniform.type != nullptr)
+        {
+            if (const SpvType* structType = uniform.type->Deref(spv::Op::OpTypeStruct))
+            {
+                if (uniform.name == nullptr || *uniform.name == '\0')
+                    uniform.name = structType->name;
+                uniform.size = structType->size;
+            }
+            else
+                uniform.size = uniform.type->size;
+        }
+    }
+
+    /* Sort variables by their IDs for deterministic reflection order; indices are no longer needed for variables */
+    std::sort(
+        uniforms_.begin(), uniforms_.end(),
+        [](const SpvUniform& lhs, const SpvUniform& rhs) -> bool
+        {
+            return (lhs.id < rhs.id);
+        }
+    );
+    std::sort(
+        varyings_.begin(), varyings_.end(),
+        [](const SpvVarying& lhs, const SpvVarying& rhs) -> bool
+        {
+            return (lhs.id < rhs.id);
+        }
+    );
+}
+
+void SpirvReflect::ResolvePushConstants()
+{
+    /* Find structure type of the push constant variable through its pointer type */
+    const SpvType* pointerType = FindType(pushConstantTypeId_);
+    if (pointerType == nullptr || pointerType->baseType == nullptr)
+        return;
+
+    GatherBlockFields(*pointerType->baseType, pushConstants_);
+}
+
+void SpirvReflect::GatherBlockFields(const SpvType& blockType, SpvBlock& outBlock) const
+{
+    outBlock.name = blockType.name;
+
+    /* Gather block field names and offsets from member decorations */
+    for (const SpvMember& member : members_)
+    {
+        if (member.structId == blockType.result)
+        {
+            if (member.index >= outBlock.fields.size())
+                outBlock.fields.resize(member.index + 1);
+            SpvBlockField& field = outBlock.fields[member.index];
+            if (member.name != nullptr)
+                field.name = member.name;
+            if (member.offset != 0)
+                field.offset = member.offset;
+        }
+    }
 }
 
 
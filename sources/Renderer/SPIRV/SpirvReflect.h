@@ -11,8 +11,8 @@
 
 #include "SpirvIterator.h"
 #include "SpirvModule.h"
+#include <LLGL/Container/ArrayView.h>
 #include <vector>
-#include <map>
 
 
 namespace LLGL
@@ -38,6 +38,12 @@ class SpirvNameDecorations
             names_.resize(idBound);
         }
 
+        // Releases the memory of all name decorations.
+        inline void Clear()
+        {
+            std::vector<const char*>().swap(names_);
+        }
+
         inline const char* Get(spv::Id id) const
         {
             return (id < names_.size() ? names_[id] : "");
@@ -62,7 +68,11 @@ class SpirvNameDecorations
 
 };
 
-// SPIR-V shader module parser.
+/*
+SPIR-V shader module reflection.
+All declarations of a module are gathered in a single linear pass over its instructions and stored in flat arrays.
+Names of the reflected objects refer to the string literals of the module, so the module must outlive this reflection.
+*/
 class SpirvReflect
 {
 
@@ -92,16 +102,21 @@ class SpirvReflect
             spv::StorageClass           storage     = spv::StorageClassMax; // Storage class of this type. By default spv::StorageClass::Max.
             const char*                 name        = nullptr;              // Name of this type (only for structures).
             const SpvType*              baseType    = nullptr;              // Reference to the base type, or null if there is no base type.
+            spv::Id                     baseTypeId  = 0;                    // Result ID of the base type, or 0 if there is no base type.
             std::uint32_t               elements    = 0;                    // Number of elements for the base type, or 0 if there is no base type.
             std::uint32_t               size        = 0;                    // Size (in bytes) of this type, or 0 if this is an OpTypeVoid type.
             bool                        sign        = false;                // Specifies whether or not this is a signed type (only for OpTypeInt).
-            std::vector<const SpvType*> fieldTypes;                         // List of types of each record field.
+            ArrayView<const SpvType*>   fieldTypes;                         // List of types of each record field. Refers to the field type arena of the reflection.
+            std::uint32_t               firstField  = 0;                    // Index of the first field type within the field type arena.
+            std::uint32_t               numFields   = 0;                    // Number of record fields (only for OpTypeStruct).
         };
 
         // SPIRV-V scalar constants.
         struct SpvConstant
         {
+            spv::Id             result  = 0;
             const SpvType*      type    = nullptr;
+            spv::Id             typeId  = 0;
             union
             {
                 float           f32;
@@ -116,19 +131,25 @@ class SpirvReflect
         // Global uniform objects.
         struct SpvUniform
         {
-            const char*     name    = nullptr;
-            const SpvType*  type    = nullptr;
-            std::uint32_t   set     = 0;        // Descriptor set
-            std::uint32_t   binding = 0;        // Binding point
-            std::uint32_t   size    = 0;        // Size (in bytes) of the uniform.
+            spv::Id         id                  = 0;
+            const char*     name                = nullptr;
+            const SpvType*  type                = nullptr;
+            spv::Id         typeId              = 0;
+            std::uint32_t   set                 = 0;    // Descriptor set
+            std::uint32_t   binding             = 0;    // Binding point
+            std::uint32_t   size                = 0;    // Size (in bytes) of the uniform.
+            std::uint32_t   setWordOffset       = 0;    // Word offset within the SPIR-V module of the descriptor set, or 0 if the uniform has no descriptor set decoration.
+            std::uint32_t   bindingWordOffset   = 0;    // Word offset within the SPIR-V module of the binding point, or 0 if the uniform has no binding decoration.
         };
 
         // Module varyings, i.e. either input or output attributes.
         struct SpvVarying
         {
+            spv::Id         id          = 0;
             const char*     name        = nullptr;
             spv::BuiltIn    builtin     = spv::BuiltInMax;  // Optional built-in type
             const SpvType*  type        = nullptr;
+            spv::Id         typeId      = 0;
             std::uint32_t   location    = 0;
             bool            input       = false;
         };
@@ -140,64 +161,102 @@ class SpirvReflect
             std::uint32_t   offset  = 0;
         };
 
-        // Block reflection for push constants.
+        // Block reflection for push constants and uniform blocks.
         struct SpvBlock
         {
             const char*                 name    = nullptr;
             std::vector<SpvBlockField>  fields;
         };
 
-        // Binding point including descriptor set.
-        struct SpvBindingPoint
-        {
-            spv::Id         id                  = 0; // Resource ID.
-            std::uint32_t   set                 = 0; // Descriptor set
-            std::uint32_t   setWordOffset       = 0; // Word offset within the SPIR-V module of the descriptor set.
-            std::uint32_t   binding             = 0; // Binding point
-            std::uint32_t   bindingWordOffset   = 0; // Word offset within the SPIR-V module of the binding point.
-        };
-
     public:
 
-        // Parse all instructions in the specified SPIR-V module.
+        SpirvReflect() = default;
+
+        // Field types refer to the arena of this reflection, so it cannot be copied.
+        SpirvReflect(const SpirvReflect&) = delete;
+        SpirvReflect& operator = (const SpirvReflect&) = delete;
+
+        SpirvReflect(SpirvReflect&&) = default;
+        SpirvReflect& operator = (SpirvReflect&&) = default;
+
+        // Parse all declarations in the specified SPIR-V module. Previous results of this reflection are discarded.
         SpirvResult Reflect(const SpirvModuleView& module);
 
+        // Releases all reflected declarations.
+        void Clear();
+
     public:
 
-        // Returns the container that maps a SPIR-V ID to its type definition.
-        inline const std::map<spv::Id, SpvType>& GetTypes() const
+        // Returns the list of all type definitions in the order they are declared in the module.
+        inline const std::vector<SpvType>& GetTypes() const
         {
             return types_;
         }
 
-        // Returns the container that maps a SPIR-V ID to its constant definition.
-        inline const std::map<spv::Id, SpvConstant>& GetConstants() const
+        // Returns the list of all scalar constant definitions in the order they are declared in the module.
+        inline const std::vector<SpvConstant>& GetConstants() const
         {
             return constants_;
         }
 
-        // Returns the container that maps a SPIR-V ID to its uniform definition.
-        inline const std::map<spv::Id, SpvUniform>& GetUniforms() const
+        // Returns the list of all uniform definitions sorted by their SPIR-V ID.
+        inline const std::vector<SpvUniform>& GetUniforms() const
         {
             return uniforms_;
         }
 
-        // Returns the container that maps a SPIR-V ID to its varying definition.
-        inline const std::map<spv::Id, SpvVarying>& GetVaryings() const
+        // Returns the list of all varying definitions sorted by their SPIR-V ID.
+        inline const std::vector<SpvVarying>& GetVaryings() const
         {
             return varyings_;
         }
 
+        // Returns the execution modes of the module.
+        inline const SpvExecutionMode& GetExecutionMode() const
+        {
+            return executionMode_;
+        }
+
+        // Returns the push constant block of the module. The block has no fields if the module has no push constants.
+        inline const SpvBlock& GetPushConstants() const
+        {
+            return pushConstants_;
+        }
+
+        // Returns the type definition with the specified ID or null if there is no such type.
+        const SpvType* FindType(spv::Id id) const;
+
+        // Returns the constant definition with the specified ID or null if there is no such constant.
+        const SpvConstant* FindConstant(spv::Id id) const;
+
+        // Reflects the fields of the specified uniform block. Returns false if the uniform does not refer to a structure type.
+        bool ReflectUniformBlock(const SpvUniform& uniform, SpvBlock& outBlock) const;
+
     private:
 
         using Instr = SpirvInstruction;
 
-        SpirvResult ParseInstruction(const SpirvInstruction& instr);
+        // Decoration of a structure member (OpMemberName and OpMemberDecorate).
+        struct SpvMember
+        {
+            spv::Id         structId    = 0;
+            std::uint32_t   index       = 0;
+            const char*     name        = nullptr;
+            std::uint32_t   offset      = 0;
+        };
+
+    private:
+
+        SpirvResult ParseInstruction(const SpirvInstruction& instr, std::uint32_t wordOffset);
 
         SpirvResult OpName(const Instr& instr);
+        SpirvResult OpMemberName(const Instr& instr);
+        SpirvResult OpExecutionMode(const Instr& instr);
 
-        SpirvResult OpDecorate(const Instr& instr);
-        void OpDecorateBinding(const Instr& instr, spv::Id id);
+        SpirvResult OpDecorate(const Instr& instr, std::uint32_t wordOffset);
+        SpirvResult OpMemberDecorate(const Instr& instr);
+        void OpDecorateDescriptorSet(const Instr& instr, spv::Id id, std::uint32_t wordOffset);
+        void OpDecorateBinding(const Instr& instr, spv::Id id, std::uint32_t wordOffset);
         void OpDecorateLocation(const Instr& instr, spv::Id id);
         void OpDecorateBuiltin(const Instr& instr, spv::Id id);
 
@@ -221,30 +280,36 @@ class SpirvReflect
         void OpTypePointer(const Instr& instr, SpvType& type);
         void OpTypeFunction(const Instr& instr, SpvType& type);
 
-        const SpvType* FindType(spv::Id id) const;
-        const SpvConstant* FindConstant(spv::Id id) const;
+        SpvMember& GetOrMakeMember(spv::Id structId, std::uint32_t index);
+        SpvUniform& GetOrMakeUniform(spv::Id id);
+        SpvVarying& GetOrMakeVarying(spv::Id id);
 
-    private:
+        // Resolves all ID references into pointers once the module has been parsed.
+        void ResolveReferences();
+        void ResolvePushConstants();
 
-        std::uint32_t                   idBound_    = 0;
-        SpirvNameDecorations            names_;
+        // Gathers the field names and offsets of the specified structure type from the member decorations.
+        void GatherBlockFields(const SpvType& blockType, SpvBlock& outBlock) const;
 
-        std::map<spv::Id, SpvType>      types_;
-        std::map<spv::Id, SpvConstant>  constants_;
-        std::map<spv::Id, SpvUniform>   uniforms_;
-        std::map<spv::Id, SpvVarying>   varyings_;
-
-};
+    private:
 
+        std::uint32_t               idBound_            = 0;
+        SpirvNameDecorations        names_;
+        std::vector<std::uint32_t>  indices_;                   // Maps a SPIR-V ID to its index within the container of its declaration kind.
 
-// Reflect the specified SPIR-V module only for the execution mode.
-SpirvResult SpirvReflectExecutionMode(const SpirvModuleView& module, SpirvReflect::SpvExecutionMode& outExecutionMode);
+        std::vector<SpvType>        types_;
+        std::vector<SpvConstant>    constants_;
+        std::vector<SpvUniform>     uniforms_;
+        std::vector<SpvVarying>     varyings_;
+        std::vector<spv::Id>        fieldTypeIds_;
+        std::vector<const SpvType*> fieldTypes_;                // Arena for the field types of all structures.
+        std::vector<SpvMember>      members_;
 
-// Reflect the specified SPIR-V module only for push constants.
-SpirvResult SpirvReflectPushConstants(const SpirvModuleView& module, SpirvReflect::SpvBlock& outBlock);
+        SpvExecutionMode            executionMode_;
+        spv::Id                     pushConstantTypeId_ = 0;    // Pointer type of the global push constant variable.
+        SpvBlock                    pushConstants_;
 
-// Reflect the specified SPIR-V module only for binding points (including their descriptor sets).
-SpirvResult SpirvReflectBindingPoints(const SpirvModuleView& module, std::vector<SpirvReflect::SpvBindingPoint>& outBindingPoints);
+};
 
 
 } // /namespace LLGL
@@ -0,0 +1,311 @@
+/*
+ * SpirvShaderReflection.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "SpirvShaderReflection.h"
+#include <LLGL/Utils/ForRange.h>
+
+
+namespace LLGL
+{
+
+
+static const char* GetOptString(const char* s)
+{
+    return (s != nullptr ? s : "");
+}
+
+static long ShaderTypeToStageFlags(const ShaderType type)
+{
+    switch (type)
+    {
+        case ShaderType::Vertex:            return StageFlags::VertexStage;
+        case ShaderType::TessControl:       return StageFlags::TessControlStage;
+        case ShaderType::TessEvaluation:    return StageFlags::TessEvaluationStage;
+        case ShaderType::Geometry:          return StageFlags::GeometryStage;
+        case ShaderType::Fragment:          return StageFlags::FragmentStage;
+        case ShaderType::Compute:           return StageFlags::ComputeStage;
+        case ShaderType::Task:              return StageFlags::TaskStage;
+        case ShaderType::Mesh:              return StageFlags::MeshStage;
+        default:                            return 0;
+    }
+}
+
+static Format SpvVectorTypeToFormat(const SpirvReflect::SpvType* type, std::uint32_t count)
+{
+    if (type->opcode == spv::Op::OpTypeFloat)
+    {
+        if (type->size == 2)
+        {
+            switch (count)
+            {
+                case 1: return Format::R16Float;
+                case 2: return Format::RG16Float;
+                case 3: return Format::RGB16Float;
+                case 4: return Format::RGBA16Float;
+            }
+        }
+        else if (type->size == 4)
+        {
+            switch (count)
+            {
+                case 1: return Format::R32Float;
+                case 2: return Format::RG32Float;
+                case 3: return Format::RGB32Float;
+                case 4: return Format::RGBA32Float;
+            }
+        }
+        else if (type->size == 8)
+        {
+            switch (count)
+            {
+                case 1: return Format::R64Float;
+                case 2: return Format::RG64Float;
+                case 3: return Format::RGB64Float;
+                case 4: return Format::RGBA64Float;
+            }
+        }
+    }
+    else if (type->opcode == spv::Op::OpTypeInt)
+    {
+        if (type->sign)
+        {
+            switch (count)
+            {
+                case 1: return Format::R32SInt;
+                case 2: return Format::RG32SInt;
+                case 3: return Format::RGB32SInt;
+                case 4: return Format::RGBA32SInt;
+            }
+        }
+        else
+        {
+            switch (count)
+            {
+                case 1: return Format::R32UInt;
+                case 2: return Format::RG32UInt;
+                case 3: return Format::RGB32UInt;
+                case 4: return Format::RGBA32UInt;
+            }
+        }
+    }
+    return Format::Undefined;
+}
+
+static Format SpvTypeToFormat(const SpirvReflect::SpvType* type, std::uint32_t* count = nullptr)
+{
+    /* Return number of semantics to default value of 1 element */
+    if (count != nullptr)
+        *count = 1;
+
+    if (type != nullptr)
+    {
+        if (type->opcode == spv::Op::OpTypePointer)
+        {
+            /* Dereference pointer type */
+            return SpvTypeToFormat(type->baseType, count);
+        }
+        else if (type->opcode == spv::Op::OpTypeFloat || type->opcode == spv::Op::OpTypeInt)
+        {
+            /* Return format as scalar type */
+            return SpvVectorTypeToFormat(type, 1);
+        }
+        else if (type->opcode == spv::Op::OpTypeVector)
+        {
+            /* Return format as vector type */
+            if (type->baseType)
+                return SpvVectorTypeToFormat(type->baseType, type->elements);
+        }
+        else if (type->opcode == spv::Op::OpTypeMatrix)
+        {
+            /* Return format as vector and return number of vectors */
+            if (count != nullptr)
+                *count = type->elements;
+            return SpvTypeToFormat(type->baseType);
+        }
+    }
+
+    return Format::Undefined;
+}
+
+static SystemValue SpvBuiltinToSystemValue(spv::BuiltIn type)
+{
+    switch (type)
+    {
+        case spv::BuiltInClipDistance:      return SystemValue::ClipDistance;
+        case spv::BuiltInCullDistance:      return SystemValue::CullDistance;
+        //                                  return SystemValue::Color;
+        case spv::BuiltInFragDepth:         return SystemValue::Depth;
+        //                                  return SystemValue::DepthGreater;
+        //                                  return SystemValue::DepthLess;
+        case spv::BuiltInFrontFacing:       return SystemValue::FrontFacing;
+        case spv::BuiltInInstanceId:        return SystemValue::InstanceID;
+        case spv::BuiltInInstanceIndex:     return SystemValue::InstanceID;
+        case spv::BuiltInPosition:          return SystemValue::Position;
+        case spv::BuiltInFragCoord:         return SystemValue::Position;
+        case spv::BuiltInPrimitiveId:       return SystemValue::PrimitiveID;
+        case spv::BuiltInLayer:             return SystemValue::RenderTargetIndex;
+        case spv::BuiltInSampleMask:        return SystemValue::SampleMask;
+        case spv::BuiltInSampleId:          return SystemValue::SampleID;
+        case spv::BuiltInFragStencilRefEXT: return SystemValue::Stencil;
+        case spv::BuiltInVertexId:          return SystemValue::VertexID;
+        case spv::BuiltInVertexIndex:       return SystemValue::VertexID;
+        case spv::BuiltInViewportIndex:     return SystemValue::ViewportIndex;
+        default:                            return SystemValue::Undefined;
+    }
+}
+
+static SystemValue SpvBuiltinToFragmentOutputSV(spv::BuiltIn type)
+{
+    SystemValue sv = SpvBuiltinToSystemValue(type);
+    return (sv == SystemValue::Undefined ? SystemValue::Color : sv);
+}
+
+// Reflects the SPIR-V type to the output binding descriptor and returns the dereferenced type
+static const SpirvReflect::SpvType* ReflectSpvBinding(BindingDescriptor& binding, const SpirvReflect::SpvType* varType)
+{
+    if (varType != nullptr)
+    {
+        if (const SpirvReflect::SpvType* derefType = varType->Deref())
+        {
+            switch (derefType->opcode)
+            {
+                case spv::Op::OpTypeArray:
+                    /* Multiply array in case of multiple interleaved arrays, e.g. MultiArray[4][3] is equivalent to LinearArray[4*3] */
+                    binding.arraySize = (derefType->elements == 0 ? derefType->elements : binding.arraySize * derefType->elements);
+                    return ReflectSpvBinding(binding, derefType->baseType);
+
+                case spv::Op::OpTypeImage:
+                    binding.type       = ResourceType::Texture;
+                    binding.bindFlags  |= BindFlags::Sampled;
+                    return derefType;
+
+                case spv::Op::OpTypeSampler:
+                    binding.type       = ResourceType::Sampler;
+                    return derefType;
+
+                case spv::Op::OpTypeSampledImage:
+                    binding.type       = ResourceType::Texture;
+                    binding.bindFlags  |= (BindFlags::Sampled | BindFlags::CombinedSampler);
+                    return derefType;
+
+                case spv::Op::OpTypeStruct:
+                    binding.type       = ResourceType::Buffer;
+                    binding.bindFlags  |= BindFlags::ConstantBuffer;
+                    return derefType;
+
+                default:
+                    break;
+            }
+        }
+    }
+    return nullptr;
+}
+
+static ShaderResourceReflection* FindOrAppendShaderResource(ShaderReflection& reflection, const SpirvReflect::SpvUniform& var)
+{
+    /* Check if there already is a resource at the specified binding slot */
+    for (ShaderResourceReflection& resource : reflection.resources)
+    {
+        if (resource.binding.slot == BindingSlot{ var.binding, var.set })
+            return &resource;
+    }
+
+    /* Append new resource entry */
+    ShaderResourceReflection resource;
+    {
+        resource.binding.name = GetOptString(var.name);
+        resource.binding.slot = BindingSlot{ var.binding, var.set };
+
+        if (const SpirvReflect::SpvType* varType = var.type)
+        {
+            //if (varType->opcode == spv::Op::OpTypeArray)
+            //    resource.binding.arraySize = varType->elements;
+
+            if (varType->storage == spv::StorageClassUniform ||
+                varType->storage == spv::StorageClassUniformConstant)
+            {
+                if (const SpirvReflect::SpvType* derefType = ReflectSpvBinding(resource.binding, varType))
+                {
+                    if (derefType->opcode == spv::Op::OpTypeStruct)
+                        resource.constantBufferSize = var.size;
+                }
+            }
+        }
+    }
+    reflection.resources.push_back(resource);
+
+    return &(reflection.resources.back());
+}
+
+void BuildSpirvShaderReflection(const SpirvReflect& spirvReflection, const ShaderType shaderType, ShaderReflection& outReflection)
+{
+    /* Gather input/output attributes */
+    for (const SpirvReflect::SpvVarying& var : spirvReflection.GetVaryings())
+    {
+        if (shaderType == ShaderType::Vertex)
+        {
+            std::uint32_t numVectors = 1;
+
+            /* Determine vertex attribute data */
+            VertexAttribute attrib;
+            {
+                attrib.name         = GetOptString(var.name);
+                attrib.format       = SpvTypeToFormat(var.type, &numVectors);
+                attrib.location     = var.location;
+                attrib.systemValue  = SpvBuiltinToSystemValue(var.builtin);
+            }
+
+            /* Append vertex attributes for each semantic index */
+            for_range(i, numVectors)
+            {
+                attrib.semanticIndex = i;
+                if (var.input)
+                    outReflection.vertex.inputAttribs.push_back(attrib);
+                else
+                    outReflection.vertex.outputAttribs.push_back(attrib);
+            }
+        }
+        else if (shaderType == ShaderType::Fragment && !var.input)
+        {
+            /* Determine and append fragment attribute data */
+            FragmentAttribute attrib;
+            {
+                attrib.name         = GetOptString(var.name);
+                attrib.format       = SpvTypeToFormat(var.type);
+                attrib.location     = var.location;
+                attrib.systemValue  = SpvBuiltinToFragmentOutputSV(var.builtin);
+            }
+            outReflection.fragment.outputAttribs.push_back(attrib);
+        }
+    }
+
+    /* Gather shader resources */
+    for (const SpirvReflect::SpvUniform& var : spirvReflection.GetUniforms())
+    {
+        if (ShaderResourceReflection* resource = FindOrAppendShaderResource(outReflection, var))
+            resource->binding.stageFlags |= ShaderTypeToStageFlags(shaderType);
+    }
+
+    /* Gather work group size if it's specified by the 'LocalSize' execution mode */
+    if (shaderType == ShaderType::Compute)
+    {
+        const SpirvReflect::SpvExecutionMode& executionMode = spirvReflection.GetExecutionMode();
+        if (executionMode.localSizeX > 0)
+        {
+            outReflection.compute.workGroupSize.width   = executionMode.localSizeX;
+            outReflection.compute.workGroupSize.height  = executionMode.localSizeY;
+            outReflection.compute.workGroupSize.depth   = executionMode.localSizeZ;
+        }
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
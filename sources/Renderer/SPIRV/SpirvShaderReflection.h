@@ -0,0 +1,35 @@
+/*
+ * SpirvShaderReflection.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_SPIRV_SHADER_REFLECTION_H
+#define LLGL_SPIRV_SHADER_REFLECTION_H
+
+
+#include "SpirvReflect.h"
+#include <LLGL/ShaderFlags.h>
+#include <LLGL/ShaderReflection.h>
+
+
+namespace LLGL
+{
+
+
+/*
+Converts the specified SPIR-V module reflection into a shader reflection for the specified shader type.
+This is shared between all backends that consume SPIR-V modules directly, i.e. Vulkan and OpenGL with GL_ARB_gl_spirv.
+*/
+void BuildSpirvShaderReflection(const SpirvReflect& spirvReflection, const ShaderType shaderType, ShaderReflection& outReflection);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
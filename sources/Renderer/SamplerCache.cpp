@@ -0,0 +1,81 @@
+/*
+ * SamplerCache.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "SamplerCache.h"
+#include "../Core/MacroUtils.h"
+#include <LLGL/Utils/ForRange.h>
+
+
+namespace LLGL
+{
+
+
+template <typename T>
+static void HashValue(std::uint64_t& hash, const T& value)
+{
+    /* Update 64-bit FNV-1a hash */
+    const char* bytes = reinterpret_cast<const char*>(&value);
+    for_range(i, sizeof(value))
+    {
+        hash ^= static_cast<std::uint8_t>(bytes[i]);
+        hash *= 0x100000001B3ull;
+    }
+}
+
+SamplerSignature::SamplerSignature(const SamplerDescriptor& desc) :
+    desc_ { desc                  },
+    hash_ { 0xCBF29CE484222325ull }
+{
+    /* Debug names don't contribute to the native sampler state */
+    desc_.debugName = nullptr;
+
+    /* Hash members individually, since the descriptor contains padding bytes with undefined values */
+    HashValue(hash_, desc_.addressModeU);
+    HashValue(hash_, desc_.addressModeV);
+    HashValue(hash_, desc_.addressModeW);
+    HashValue(hash_, desc_.minFilter);
+    HashValue(hash_, desc_.magFilter);
+    HashValue(hash_, desc_.mipMapFilter);
+    HashValue(hash_, desc_.mipMapEnabled);
+    HashValue(hash_, desc_.mipMapLODBias);
+    HashValue(hash_, desc_.minLOD);
+    HashValue(hash_, desc_.maxLOD);
+    HashValue(hash_, desc_.maxAnisotropy);
+    HashValue(hash_, desc_.compareEnabled);
+    HashValue(hash_, desc_.compareOp);
+    HashValue(hash_, desc_.borderColor);
+}
+
+int SamplerSignature::CompareSWO(const SamplerSignature& lhs, const SamplerSignature& rhs)
+{
+    LLGL_COMPARE_MEMBER_SWO     ( hash_                );
+    LLGL_COMPARE_MEMBER_SWO     ( desc_.addressModeU   );
+    LLGL_COMPARE_MEMBER_SWO     ( desc_.addressModeV   );
+    LLGL_COMPARE_MEMBER_SWO     ( desc_.addressModeW   );
+    LLGL_COMPARE_MEMBER_SWO     ( desc_.minFilter      );
+    LLGL_COMPARE_MEMBER_SWO     ( desc_.magFilter      );
+    LLGL_COMPARE_MEMBER_SWO     ( desc_.mipMapFilter   );
+    LLGL_COMPARE_BOOL_MEMBER_SWO( desc_.mipMapEnabled  );
+    LLGL_COMPARE_MEMBER_SWO     ( desc_.mipMapLODBias  );
+    LLGL_COMPARE_MEMBER_SWO     ( desc_.minLOD         );
+    LLGL_COMPARE_MEMBER_SWO     ( desc_.maxLOD         );
+    LLGL_COMPARE_MEMBER_SWO     ( desc_.maxAnisotropy  );
+    LLGL_COMPARE_BOOL_MEMBER_SWO( desc_.compareEnabled );
+    LLGL_COMPARE_MEMBER_SWO     ( desc_.compareOp      );
+    for_range(i, 4)
+    {
+        LLGL_COMPARE_MEMBER_SWO ( desc_.borderColor[i] );
+    }
+    return 0;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
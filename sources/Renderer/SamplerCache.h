@@ -0,0 +1,69 @@
+/*
+ * SamplerCache.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_SAMPLER_CACHE_H
+#define LLGL_SAMPLER_CACHE_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/SamplerFlags.h>
+#include "SharedObjectCache.h"
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+Canonical representation of a sampler descriptor to identify samplers with identical states.
+Debug names are ignored, i.e. two descriptors that only differ in their debug names have the same signature.
+*/
+class LLGL_EXPORT SamplerSignature
+{
+
+    public:
+
+        SamplerSignature() = default;
+
+        SamplerSignature(const SamplerSignature&) = default;
+        SamplerSignature& operator = (const SamplerSignature&) = default;
+
+        // Builds the signature for the specified sampler descriptor.
+        SamplerSignature(const SamplerDescriptor& desc);
+
+        // Returns the 64-bit FNV-1a hash of this signature.
+        inline std::uint64_t GetHash() const
+        {
+            return hash_;
+        }
+
+    public:
+
+        // Compares the two signatures in a strict-weak-order (SWO). The hash is compared first to keep most comparisons short.
+        static int CompareSWO(const SamplerSignature& lhs, const SamplerSignature& rhs);
+
+    private:
+
+        SamplerDescriptor   desc_;
+        std::uint64_t       hash_   = 0;
+
+};
+
+// Container for samplers that shares a single instance between all samplers with identical signatures.
+template <typename T>
+using SamplerCache = SharedObjectCache<T, SamplerSignature>;
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
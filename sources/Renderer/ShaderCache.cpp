@@ -0,0 +1,122 @@
+/*
+ * ShaderCache.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/ShaderCache.h>
+#include <LLGL/Container/DynamicArray.h>
+#include <string>
+#include <string.h>
+#include <stdio.h>
+
+
+namespace LLGL
+{
+
+
+#include "../Core/PackStructPush.inl"
+
+struct FileShaderCacheHeader
+{
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint64_t key;
+    std::uint64_t size;
+}
+LLGL_PACK_STRUCT;
+
+#include "../Core/PackStructPop.inl"
+
+static constexpr std::uint32_t g_shaderCacheMagic   = 0x43534C4C; // 'LLSC'
+static constexpr std::uint32_t g_shaderCacheVersion = 1;
+
+
+/*
+ * FileShaderCache::Pimpl struct
+ */
+
+struct FileShaderCache::Pimpl
+{
+    std::string directory;
+
+    // Returns the filename of the cache entry with the specified key, e.g. "<directory>/0123456789ABCDEF.llglshader".
+    std::string GetEntryFilename(std::uint64_t key) const
+    {
+        char keyStr[17];
+        ::snprintf(keyStr, sizeof(keyStr), "%016llX", static_cast<unsigned long long>(key));
+        return directory + keyStr + ".llglshader";
+    }
+};
+
+
+/*
+ * FileShaderCache class
+ */
+
+FileShaderCache::FileShaderCache(const char* directory) :
+    pimpl_ { new Pimpl{} }
+{
+    if (directory != nullptr && *directory != '\0')
+    {
+        pimpl_->directory = directory;
+        const char lastChar = pimpl_->directory.back();
+        if (lastChar != '/' && lastChar != '\\')
+            pimpl_->directory += '/';
+    }
+}
+
+FileShaderCache::~FileShaderCache()
+{
+    delete pimpl_;
+}
+
+Blob FileShaderCache::Load(std::uint64_t key)
+{
+    const Blob fileContent = Blob::CreateFromFile(pimpl_->GetEntryFilename(key));
+    if (fileContent.GetSize() < sizeof(FileShaderCacheHeader))
+        return Blob{};
+
+    /* Validate header; Entries from an older cache format, truncated files, and hash collisions of the filename are ignored */
+    const char* bytes = static_cast<const char*>(fileContent.GetData());
+
+    FileShaderCacheHeader header;
+    ::memcpy(&header, bytes, sizeof(header));
+    if (header.magic   != g_shaderCacheMagic   ||
+        header.version != g_shaderCacheVersion ||
+        header.key     != key                  ||
+        header.size    != fileContent.GetSize() - sizeof(header))
+    {
+        return Blob{};
+    }
+
+    return Blob::CreateCopy(bytes + sizeof(header), static_cast<std::size_t>(header.size));
+}
+
+void FileShaderCache::Store(std::uint64_t key, const void* data, std::size_t size)
+{
+    if (data == nullptr || size == 0)
+        return;
+
+    /* Write header and binary into a single buffer, so the file is written at once */
+    FileShaderCacheHeader header;
+    {
+        header.magic    = g_shaderCacheMagic;
+        header.version  = g_shaderCacheVersion;
+        header.key      = key;
+        header.size     = size;
+    }
+    DynamicByteArray fileContent{ sizeof(header) + size, UninitializeTag{} };
+    ::memcpy(fileContent.data(), &header, sizeof(header));
+    ::memcpy(fileContent.data() + sizeof(header), data, size);
+
+    Blob::CreateStrongRef(std::move(fileContent)).WriteToFile(pimpl_->GetEntryFilename(key));
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,72 @@
+/*
+ * ShaderCacheUtils.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "ShaderCacheUtils.h"
+#include <LLGL/Utils/ForRange.h>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+static std::uint64_t HashBytes(const void* data, std::size_t size, std::uint64_t hash)
+{
+    const std::uint8_t* bytes = static_cast<const std::uint8_t*>(data);
+    for_range(i, size)
+    {
+        hash ^= bytes[i];
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+// Hashes the specified string including its null terminator, so consecutive strings cannot be shifted into each other.
+static std::uint64_t HashString(const char* str, std::uint64_t hash)
+{
+    if (str != nullptr)
+        hash = HashBytes(str, ::strlen(str), hash);
+    return HashBytes("", 1, hash);
+}
+
+LLGL_EXPORT std::uint64_t GetShaderCacheKey(
+    const ShaderDescriptor& shaderDesc,
+    const char*             sourceCode,
+    std::size_t             sourceLength,
+    const char*             compilerID)
+{
+    std::uint64_t hash = HashString(compilerID, 0xCBF29CE484222325ull);
+
+    const std::uint32_t type = static_cast<std::uint32_t>(shaderDesc.type);
+    hash = HashBytes(&type, sizeof(type), hash);
+
+    const std::int64_t flags = static_cast<std::int64_t>(shaderDesc.flags);
+    hash = HashBytes(&flags, sizeof(flags), hash);
+
+    hash = HashString(shaderDesc.entryPoint, hash);
+    hash = HashString(shaderDesc.profile, hash);
+
+    if (shaderDesc.defines != nullptr)
+    {
+        for (const ShaderMacro* macro = shaderDesc.defines; macro->name != nullptr; ++macro)
+        {
+            hash = HashString(macro->name, hash);
+            hash = HashString(macro->definition, hash);
+        }
+    }
+
+    const std::uint64_t length = sourceLength;
+    hash = HashBytes(&length, sizeof(length), hash);
+    return HashBytes(sourceCode, sourceLength, hash);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,42 @@
+/*
+ * ShaderCacheUtils.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_SHADER_CACHE_UTILS_H
+#define LLGL_SHADER_CACHE_UTILS_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/ShaderFlags.h>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+Returns the content-addressed key of a shader cache entry as 64-bit FNV-1a hash.
+The key covers the specified source code and compiler ID, and the type, entry point, profile, macro definitions, and flags of the shader descriptor.
+The source code is passed separately, since it must be read from file for ShaderSourceType::CodeFile.
+*/
+LLGL_EXPORT std::uint64_t GetShaderCacheKey(
+    const ShaderDescriptor& shaderDesc,
+    const char*             sourceCode,
+    std::size_t             sourceLength,
+    const char*             compilerID
+);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
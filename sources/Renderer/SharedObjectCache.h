@@ -0,0 +1,159 @@
+/*
+ * SharedObjectCache.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_SHARED_OBJECT_CACHE_H
+#define LLGL_SHARED_OBJECT_CACHE_H
+
+
+#include "ContainerTypes.h"
+#include "../Core/CoreUtils.h"
+#include <algorithm>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/*
+Container for render system objects that shares a single instance between all objects with identical signatures. Used by RenderSystem implementations.
+The signature type must be constructible from the object descriptor and provide a static CompareSWO function.
+Each instance is reference counted, so every call to emplace() must be matched by a call to erase().
+*/
+template <typename T, typename TSignature>
+class SharedObjectCache
+{
+
+    public:
+
+        struct Entry
+        {
+            TSignature              signature;
+            HWObjectInstance<T>     object;
+            std::size_t             refCount;
+        };
+
+        using container_type    = std::vector<Entry>;
+        using const_iterator    = typename container_type::const_iterator;
+
+    public:
+
+        // Returns the object with the same signature as the specified descriptor or allocates a new one with the specified arguments.
+        template <typename TDescriptor, typename... Args>
+        T* emplace(const TDescriptor& desc, Args&&... args)
+        {
+            TSignature signature{ desc };
+
+            /* Share object with identical signature */
+            std::size_t insertionIndex = 0;
+            if (Entry* entry = Find(signature, &insertionIndex))
+            {
+                ++entry->refCount;
+                return entry->object.get();
+            }
+
+            /* Allocate new object with insertion sort */
+            HWObjectInstance<T> object = MakeUnique<T>(std::forward<Args>(args)...);
+            T* ref = object.get();
+            container_.insert(container_.begin() + insertionIndex, Entry{ std::move(signature), std::move(object), 1 });
+            return ref;
+        }
+
+        // Releases one reference of the specified object and deletes it once its last reference has been released.
+        template <typename TBase>
+        void erase(TBase* object)
+        {
+            if (object != nullptr)
+            {
+                auto it = FindObject(object);
+                LLGL_ASSERT(it != container_.end());
+                if (--it->refCount == 0)
+                    container_.erase(it);
+            }
+        }
+
+        // Returns the number of references of the specified object or 0 if it's not part of this container.
+        template <typename TBase>
+        std::size_t use_count(const TBase* object) const
+        {
+            auto it = FindObject(object);
+            return (it != container_.end() ? it->refCount : 0);
+        }
+
+        void clear()
+        {
+            container_.clear();
+        }
+
+        bool empty() const
+        {
+            return container_.empty();
+        }
+
+    public:
+
+        const_iterator begin() const
+        {
+            return container_.begin();
+        }
+
+        const_iterator end() const
+        {
+            return container_.end();
+        }
+
+    private:
+
+        // Searches the entry with the specified signature with complexity O(log n).
+        Entry* Find(const TSignature& signature, std::size_t* index)
+        {
+            return FindInSortedArray<Entry>(
+                container_.data(),
+                container_.size(),
+                [&signature](const Entry& entry) -> int
+                {
+                    return TSignature::CompareSWO(entry.signature, signature);
+                },
+                index
+            );
+        }
+
+        template <typename TBase>
+        typename container_type::iterator FindObject(const TBase* object)
+        {
+            const T* subTypedObject = ObjectCast<const T*>(object);
+            return std::find_if(
+                container_.begin(),
+                container_.end(),
+                [subTypedObject](const Entry& entry) -> bool
+                {
+                    return (entry.object.get() == subTypedObject);
+                }
+            );
+        }
+
+        template <typename TBase>
+        const_iterator FindObject(const TBase* object) const
+        {
+            return const_cast<SharedObjectCache*>(this)->FindObject(object);
+        }
+
+    private:
+
+        container_type container_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
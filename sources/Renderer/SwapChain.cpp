@@ -11,6 +11,7 @@
 #include <LLGL/Display.h>
 #include "CheckedCast.h"
 #include "../Core/CoreUtils.h"
+#include "../Platform/FramePacer.h"
 
 
 namespace LLGL
@@ -23,6 +24,7 @@ struct SwapChain::Pimpl
     Extent2D                    resolution;
     Offset2D                    normalModeSurfacePos;
     bool                        normalModeSurfacePosStored = false;
+    std::unique_ptr<FramePacer> framePacer;
 };
 
 SwapChain::SwapChain() :
@@ -116,6 +118,20 @@ bool SwapChain::ResizeBuffers(const Extent2D& resolution, long flags)
 
 /* ----- Configuration ----- */
 
+bool SwapChain::SetFramePacing(const FramePacingDescriptor& desc)
+{
+    /* Create platform specific frame pacer on first use */
+    if (!pimpl_->framePacer)
+    {
+        if (desc.preferredFrameRate == 0)
+            return true;
+        pimpl_->framePacer = FramePacer::Create();
+        if (!pimpl_->framePacer)
+            return false;
+    }
+    return pimpl_->framePacer->SetFramePacing(desc);
+}
+
 bool SwapChain::SwitchFullscreen(bool enable)
 {
     bool result = false;
@@ -196,6 +212,18 @@ void SwapChain::ShareSurfaceAndConfig(SwapChain& other)
     pimpl_->resolution  = other.pimpl_->resolution;
 }
 
+void SwapChain::PaceFrame()
+{
+    if (FramePacer* framePacer = pimpl_->framePacer.get())
+        framePacer->PaceFrame();
+}
+
+void SwapChain::NotifyFramePresented()
+{
+    if (FramePacer* framePacer = pimpl_->framePacer.get())
+        framePacer->NotifyFramePresented();
+}
+
 bool SwapChain::SetDisplayFullscreenMode(const Extent2D& resolution)
 {
     if (auto surface = pimpl_->surface.get())
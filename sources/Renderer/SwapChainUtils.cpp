@@ -0,0 +1,36 @@
+/*
+ * SwapChainUtils.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "SwapChainUtils.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+/* ----- Functions ----- */
+
+LLGL_EXPORT std::uint32_t GetPresentSyncInterval(PresentMode presentMode, std::uint32_t vsyncInterval)
+{
+    switch (presentMode)
+    {
+        case PresentMode::Default:      return vsyncInterval;
+        case PresentMode::Fifo:         /*pass*/
+        case PresentMode::FifoRelaxed:  return std::max(1u, vsyncInterval);
+        case PresentMode::Mailbox:      /*pass*/
+        case PresentMode::Immediate:    return 0;
+    }
+    return vsyncInterval;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
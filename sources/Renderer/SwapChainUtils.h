@@ -0,0 +1,38 @@
+/*
+ * SwapChainUtils.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_SWAP_CHAIN_UTILS_H
+#define LLGL_SWAP_CHAIN_UTILS_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/SwapChainFlags.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/* ----- Functions ----- */
+
+/*
+Returns the number of vertical blanks to wait for each presented frame for the specified present mode and V-sync interval.
+This is the sync interval for backends that have no native present modes, i.e. Direct3D and OpenGL.
+PresentMode::Default returns the V-sync interval, FIFO modes return at least 1, and all other modes return 0.
+*/
+LLGL_EXPORT std::uint32_t GetPresentSyncInterval(PresentMode presentMode, std::uint32_t vsyncInterval);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -129,6 +129,21 @@ LLGL_EXPORT SubresourceFootprint CalcPackedSubresourceFootprint(
     return footprint;
 }
 
+LLGL_EXPORT DynamicByteArray CompressTextureImageData(const Format format, const ImageView& imageView, const Extent3D& extent, std::uint32_t numArrayLayers)
+{
+    /* Only compress into BC formats with unsigned normalized components from uncompressed color images */
+    const FormatAttributes& formatAttribs = GetFormatAttribs(format);
+    if ((formatAttribs.flags & FormatFlags::IsCompressed) == 0 || formatAttribs.dataType != DataType::UInt8)
+        return nullptr;
+    if (formatAttribs.format < ImageFormat::BC1 || formatAttribs.format > ImageFormat::BC5)
+        return nullptr;
+    if (IsCompressedFormat(imageView.format) || IsDepthOrStencilFormat(imageView.format))
+        return nullptr;
+
+    const Extent3D slicesExtent{ extent.width, extent.height, extent.depth * numArrayLayers };
+    return CompressImageBuffer(imageView, formatAttribs.format, slicesExtent, ImageCompressionQuality::Normal, LLGL_MAX_THREAD_COUNT);
+}
+
 LLGL_EXPORT bool MustGenerateMipsOnCreate(const TextureDescriptor& textureDesc)
 {
     return
@@ -177,6 +192,19 @@ LLGL_EXPORT int CompareCompressedTexViewSWO(const CompressedTexView& lhs, const
     return std::memcmp(&lhs, &rhs, sizeof(CompressedTexView));
 }
 
+LLGL_EXPORT std::size_t HashCompressedTexView(const CompressedTexView& view, std::size_t seed)
+{
+    /* FNV-1a hash over all bytes of the compressed view; this structure has no padding as it's also compared with memcmp */
+    std::uint64_t hash = 14695981039346656037ull ^ static_cast<std::uint64_t>(seed);
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&view);
+    for (std::size_t i = 0; i < sizeof(CompressedTexView); ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    return static_cast<std::size_t>(hash);
+}
+
 
 } // /namespace LLGL
 
@@ -10,6 +10,8 @@
 
 
 #include <LLGL/TextureFlags.h>
+#include <LLGL/ImageFlags.h>
+#include <LLGL/Container/DynamicArray.h>
 
 
 namespace LLGL
@@ -90,6 +92,12 @@ LLGL_EXPORT SubresourceFootprint CalcPackedSubresourceFootprint(
 // Returns true if the specified flags for texture creation require MIP-map generation at creation time.
 LLGL_EXPORT bool MustGenerateMipsOnCreate(const TextureDescriptor& textureDesc);
 
+/*
+Returns the specified uncompressed image data compressed into the block compression format of the specified texture format,
+or null if the texture format is not a BC1-BC5 format with unsigned normalized components or the image data is already compressed.
+*/
+LLGL_EXPORT DynamicByteArray CompressTextureImageData(const Format format, const ImageView& imageView, const Extent3D& extent, std::uint32_t numArrayLayers);
+
 // Returns the samples clamped to the range [1, LLGL_MAX_NUM_SAMPLES].
 LLGL_EXPORT std::uint32_t GetClampedSamples(std::uint32_t samples);
 
@@ -99,6 +107,9 @@ LLGL_EXPORT void CompressTextureViewDesc(CompressedTexView& dst, const TextureVi
 // Compares the two texture views in a strict-weak-order (SWO).
 LLGL_EXPORT int CompareCompressedTexViewSWO(const CompressedTexView& lhs, const CompressedTexView& rhs);
 
+// Returns a hash value of the specified compressed texture view, combined with the specified seed.
+LLGL_EXPORT std::size_t HashCompressedTexView(const CompressedTexView& view, std::size_t seed = 0);
+
 // Returns true if the texture-view in the specified resource-view descriptor is enabled.
 inline bool IsTextureViewEnabled(const TextureViewDescriptor& textureViewDesc)
 {
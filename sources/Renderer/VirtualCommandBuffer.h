@@ -10,6 +10,7 @@
 
 
 #include "../Core/Assertion.h"
+#include <LLGL/Container/Allocator.h>
 #include <cstddef>
 #include <algorithm>
 #include <iterator>
@@ -133,17 +134,13 @@ class VirtualCommandBuffer
         // Takes the ownership of the specified virtual command buffer memory.
         VirtualCommandBuffer(VirtualCommandBuffer&& rhs)
         {
-            std::swap(first_, rhs.first_);
-            std::swap(current_, rhs.current_);
-            std::swap(size_, rhs.size_);
+            Swap(rhs);
         }
 
         // Takes the ownership of the specified virtual command buffer memory.
         VirtualCommandBuffer& operator = (VirtualCommandBuffer&& rhs)
         {
-            std::swap(first_, rhs.first_);
-            std::swap(current_, rhs.current_);
-            std::swap(size_, rhs.size_);
+            Swap(rhs);
             return *this;
         }
 
@@ -177,10 +174,27 @@ class VirtualCommandBuffer
             return (Size() == 0);
         }
 
-        // Clears the container but keeps the allocated capacity.
+        // Swaps the memory chunks of this virtual command buffer with the specified one.
+        void Swap(VirtualCommandBuffer& rhs)
+        {
+            std::swap(first_, rhs.first_);
+            std::swap(current_, rhs.current_);
+            std::swap(biggest_, rhs.biggest_);
+            std::swap(capacity_, rhs.capacity_);
+            std::swap(size_, rhs.size_);
+            std::swap(initialCapacity_, rhs.initialCapacity_);
+        }
+
+        /*
+        Clears the container but keeps the allocated capacity.
+        If the buffer has grown over multiple memory chunks, they are coalesced into a single chunk with their total capacity (i.e. the high-water mark),
+        so a command buffer that is re-recorded with the same amount of commands does not allocate any memory after the first cycle.
+        */
         void Clear()
         {
-            if (!Empty())
+            if (first_ != nullptr && first_->next != nullptr)
+                Coalesce();
+            else if (!Empty())
             {
                 for (Chunk* c = first_; c != nullptr; c = c->next)
                     c->size = 0;
@@ -204,7 +218,7 @@ class VirtualCommandBuffer
             size_       = 0;
         }
 
-        // Packs the entire buffer to one consecutive memory block.
+        // Packs the entire buffer to one consecutive memory block. The packed block keeps the total capacity of the previous chunks.
         void Pack()
         {
             /* Only pack if there is more than one memory chunk */
@@ -235,6 +249,15 @@ class VirtualCommandBuffer
             return reinterpret_cast<TCommand*>(data + sizeof(opcode));
         }
 
+        // Appends a copy of the specified command with its opcode. The data must include the command's payload.
+        void AppendCommand(const TOpcode opcode, const void* data, std::size_t size)
+        {
+            char* dst = AllocData(sizeof(opcode) + size);
+            *reinterpret_cast<TOpcode*>(dst) = opcode;
+            if (size > 0)
+                ::memcpy(dst + sizeof(opcode), data, size);
+        }
+
     public:
 
         // STL compatible function to return the constant iterator to the first memory chunk.
@@ -263,10 +286,10 @@ class VirtualCommandBuffer
 
     private:
 
-        // Allocates a new memory chunk of the specified capacity plus sizeof(Chunk).
+        // Allocates a new memory chunk of the specified capacity plus sizeof(Chunk) with the global LLGL allocator.
         static Chunk* AllocChunk(std::size_t capacity, Chunk* next = nullptr)
         {
-            Chunk* chunk = reinterpret_cast<Chunk*>(::new std::uint8_t[sizeof(Chunk) + capacity]);
+            Chunk* chunk = static_cast<Chunk*>(AllocateMemory(sizeof(Chunk) + capacity, alignof(Chunk)));
             {
                 chunk->capacity = capacity;
                 chunk->size     = 0;
@@ -279,10 +302,7 @@ class VirtualCommandBuffer
         static void FreeChunk(Chunk* chunk)
         {
             if (chunk != nullptr)
-            {
-                std::uint8_t* buf = reinterpret_cast<std::uint8_t*>(chunk);
-                delete [] buf;
-            }
+                FreeMemory(chunk, sizeof(Chunk) + chunk->capacity, alignof(Chunk));
         }
 
         // Returns a raw pointer to the beginning of the chunk data.
@@ -376,6 +396,17 @@ class VirtualCommandBuffer
             return data;
         }
 
+        // Replaces all memory chunks by a single empty chunk with their total capacity.
+        void Coalesce()
+        {
+            const std::size_t capacity = capacity_;
+            Release();
+            first_      = VirtualCommandBuffer::AllocChunk(capacity);
+            current_    = first_;
+            biggest_    = first_;
+            capacity_   = capacity;
+        }
+
         // Returns the biggest memory chunk.
         Chunk* FindBiggestChunk() const
         {
@@ -432,14 +463,14 @@ class VirtualCommandBuffer
             first_      = chunk;
             current_    = chunk;
             biggest_    = chunk;
-            capacity_   = chunk->size;
+            capacity_   = chunk->capacity;
         }
 
         // Packs the entire virtual command buffer into a new single memory chunk.
         void PackNew()
         {
-            /* Allocate new chunk */
-            Chunk* chunk = VirtualCommandBuffer::AllocChunk(size_);
+            /* Allocate new chunk with the high-water mark of all chunks, so re-recording the same commands does not grow this buffer again */
+            Chunk* chunk = VirtualCommandBuffer::AllocChunk(capacity_);
 
             /* Copy all chunks into new chunk and free old chunks */
             for (Chunk* c = first_, *next = nullptr; c != nullptr; c = next)
@@ -457,7 +488,7 @@ class VirtualCommandBuffer
             first_      = chunk;
             current_    = chunk;
             biggest_    = chunk;
-            capacity_   = chunk->size;
+            capacity_   = chunk->capacity;
         }
 
     private:
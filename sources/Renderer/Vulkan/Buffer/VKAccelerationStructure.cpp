@@ -0,0 +1,165 @@
+/*
+ * VKAccelerationStructure.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VKAccelerationStructure.h"
+#include "VKBuffer.h"
+#include "../VKTypes.h"
+#include "../Ext/VKExtensions.h"
+#include "../../CheckedCast.h"
+#include <LLGL/Utils/ForRange.h>
+
+
+namespace LLGL
+{
+
+
+static VkBuildAccelerationStructureFlagsKHR GetVkAccelerationStructureBuildFlags(long flags)
+{
+    VkBuildAccelerationStructureFlagsKHR flagsVK = 0;
+
+    if ((flags & AccelerationStructureFlags::AllowUpdate) != 0)
+        flagsVK |= VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_UPDATE_BIT_KHR;
+    if ((flags & AccelerationStructureFlags::AllowCompaction) != 0)
+        flagsVK |= VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_COMPACTION_BIT_KHR;
+    if ((flags & AccelerationStructureFlags::PreferFastTrace) != 0)
+        flagsVK |= VK_BUILD_ACCELERATION_STRUCTURE_PREFER_FAST_TRACE_BIT_KHR;
+    if ((flags & AccelerationStructureFlags::PreferFastBuild) != 0)
+        flagsVK |= VK_BUILD_ACCELERATION_STRUCTURE_PREFER_FAST_BUILD_BIT_KHR;
+
+    return flagsVK;
+}
+
+static VkDeviceAddress GetVkBufferDeviceAddress(VkDevice device, const Buffer* buffer, VkDeviceSize offset, bool resolveBuffers)
+{
+    if (!resolveBuffers || buffer == nullptr)
+        return 0;
+    auto* bufferVK = LLGL_CAST(const VKBuffer*, buffer);
+    return bufferVK->GetDeviceAddress(device) + offset;
+}
+
+static VkAccelerationStructureKHR GetVkAccelerationStructure(const Buffer* buffer, bool resolveBuffers)
+{
+    if (!resolveBuffers || buffer == nullptr)
+        return VK_NULL_HANDLE;
+    auto* bufferVK = LLGL_CAST(const VKBuffer*, buffer);
+    return bufferVK->GetVkAccelerationStructure();
+}
+
+static void ConvertVkGeometryTriangles(
+    VkDevice                                device,
+    VkAccelerationStructureGeometryKHR&     dst,
+    std::uint32_t&                          outPrimitiveCount,
+    const AccelerationStructureTriangles&   src,
+    bool                                    resolveBuffers)
+{
+    dst.sType           = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_KHR;
+    dst.pNext           = nullptr;
+    dst.geometryType    = VK_GEOMETRY_TYPE_TRIANGLES_KHR;
+    dst.flags           = (src.opaque ? VK_GEOMETRY_OPAQUE_BIT_KHR : 0);
+
+    VkAccelerationStructureGeometryTrianglesDataKHR& triangles = dst.geometry.triangles;
+    {
+        triangles.sType                         = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_TRIANGLES_DATA_KHR;
+        triangles.pNext                         = nullptr;
+        triangles.vertexFormat                  = VKTypes::Map(src.vertexFormat);
+        triangles.vertexData.deviceAddress      = GetVkBufferDeviceAddress(device, src.vertexBuffer, src.vertexOffset, resolveBuffers);
+        triangles.vertexStride                  = src.vertexStride;
+        triangles.maxVertex                     = (src.numVertices > 0 ? src.numVertices - 1 : 0);
+        if (src.indexBuffer != nullptr)
+        {
+            triangles.indexType                 = VKTypes::ToVkIndexType(src.indexFormat);
+            triangles.indexData.deviceAddress   = GetVkBufferDeviceAddress(device, src.indexBuffer, src.indexOffset, resolveBuffers);
+            outPrimitiveCount                   = src.numIndices / 3;
+        }
+        else
+        {
+            triangles.indexType                 = VK_INDEX_TYPE_NONE_KHR;
+            triangles.indexData.deviceAddress   = 0;
+            outPrimitiveCount                   = src.numVertices / 3;
+        }
+        triangles.transformData.deviceAddress   = 0;
+    }
+}
+
+static void ConvertVkGeometryInstances(
+    VkDevice                                    device,
+    VkAccelerationStructureGeometryKHR&         dst,
+    const AccelerationStructureBuildDescriptor& src,
+    bool                                        resolveBuffers)
+{
+    dst.sType           = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_KHR;
+    dst.pNext           = nullptr;
+    dst.geometryType    = VK_GEOMETRY_TYPE_INSTANCES_KHR;
+    dst.flags           = 0;
+
+    VkAccelerationStructureGeometryInstancesDataKHR& instances = dst.geometry.instances;
+    {
+        instances.sType                 = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_INSTANCES_DATA_KHR;
+        instances.pNext                 = nullptr;
+        instances.arrayOfPointers       = VK_FALSE;
+        instances.data.deviceAddress    = GetVkBufferDeviceAddress(device, src.instanceBuffer, src.instanceOffset, resolveBuffers);
+    }
+}
+
+void VKConvertAccelerationStructureBuildInfo(
+    VkDevice                                    device,
+    VKAccelerationStructureBuildInfo&           outBuildInfo,
+    const AccelerationStructureBuildDescriptor& buildDesc,
+    bool                                        resolveBuffers)
+{
+    /* Convert geometry and determine number of primitives per geometry */
+    if (buildDesc.type == AccelerationStructureType::TopLevel)
+    {
+        outBuildInfo.geometries.resize(1);
+        outBuildInfo.primitiveCounts.resize(1);
+        ConvertVkGeometryInstances(device, outBuildInfo.geometries[0], buildDesc, resolveBuffers);
+        outBuildInfo.primitiveCounts[0] = buildDesc.numInstances;
+    }
+    else
+    {
+        outBuildInfo.geometries.resize(buildDesc.triangles.size());
+        outBuildInfo.primitiveCounts.resize(buildDesc.triangles.size());
+        for_range(i, buildDesc.triangles.size())
+            ConvertVkGeometryTriangles(device, outBuildInfo.geometries[i], outBuildInfo.primitiveCounts[i], buildDesc.triangles[i], resolveBuffers);
+    }
+
+    /* Offsets are already included in the device addresses, so build ranges only specify the number of primitives */
+    outBuildInfo.buildRanges.resize(outBuildInfo.primitiveCounts.size());
+    for_range(i, outBuildInfo.primitiveCounts.size())
+    {
+        VkAccelerationStructureBuildRangeInfoKHR& buildRange = outBuildInfo.buildRanges[i];
+        buildRange.primitiveCount   = outBuildInfo.primitiveCounts[i];
+        buildRange.primitiveOffset  = 0;
+        buildRange.firstVertex      = 0;
+        buildRange.transformOffset  = 0;
+    }
+
+    /* Convert build information; an update is performed in place if a source acceleration structure is specified */
+    const bool isUpdate = (resolveBuffers && buildDesc.src != nullptr);
+
+    VkAccelerationStructureBuildGeometryInfoKHR& buildInfo = outBuildInfo.buildInfo;
+    {
+        buildInfo.sType                     = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_GEOMETRY_INFO_KHR;
+        buildInfo.pNext                     = nullptr;
+        buildInfo.type                      = (buildDesc.type == AccelerationStructureType::TopLevel ? VK_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL_KHR : VK_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL_KHR);
+        buildInfo.flags                     = GetVkAccelerationStructureBuildFlags(buildDesc.flags);
+        buildInfo.mode                      = (isUpdate ? VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR : VK_BUILD_ACCELERATION_STRUCTURE_MODE_BUILD_KHR);
+        buildInfo.srcAccelerationStructure  = GetVkAccelerationStructure(buildDesc.src, resolveBuffers);
+        buildInfo.dstAccelerationStructure  = GetVkAccelerationStructure(buildDesc.dst, resolveBuffers);
+        buildInfo.geometryCount             = static_cast<std::uint32_t>(outBuildInfo.geometries.size());
+        buildInfo.pGeometries               = outBuildInfo.geometries.data();
+        buildInfo.ppGeometries              = nullptr;
+        buildInfo.scratchData.deviceAddress = GetVkBufferDeviceAddress(device, buildDesc.scratchBuffer, buildDesc.scratchOffset, resolveBuffers);
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,49 @@
+/*
+ * VKAccelerationStructure.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VK_ACCELERATION_STRUCTURE_H
+#define LLGL_VK_ACCELERATION_STRUCTURE_H
+
+
+#include <LLGL/AccelerationStructureFlags.h>
+#include "../Vulkan.h"
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+// Native geometry information to build an acceleration structure. All pointers in 'buildInfo' refer to the containers of this structure.
+struct VKAccelerationStructureBuildInfo
+{
+    VkAccelerationStructureBuildGeometryInfoKHR             buildInfo;
+    std::vector<VkAccelerationStructureGeometryKHR>         geometries;
+    std::vector<VkAccelerationStructureBuildRangeInfoKHR>   buildRanges;
+    std::vector<std::uint32_t>                              primitiveCounts;
+};
+
+/*
+Converts the specified acceleration structure build descriptor into native geometry information.
+If 'resolveBuffers' is false, only the information to query the build sizes is written, i.e. buffers are ignored.
+*/
+void VKConvertAccelerationStructureBuildInfo(
+    VkDevice                                    device,
+    VKAccelerationStructureBuildInfo&           outBuildInfo,
+    const AccelerationStructureBuildDescriptor& buildDesc,
+    bool                                        resolveBuffers
+);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
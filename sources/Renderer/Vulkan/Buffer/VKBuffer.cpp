@@ -7,18 +7,45 @@
 
 #include "VKBuffer.h"
 #include "../VKCore.h"
+#include "../Memory/VKDeviceMemory.h"
 #include "../VKTypes.h"
 #include "../VKDevice.h"
 #include "../Ext/VKExtensions.h"
 #include "../Ext/VKExtensionRegistry.h"
 #include "../../ResourceUtils.h"
 #include "../../../Core/Exception.h"
+#include <LLGL/Backend/Vulkan/NativeHandle.h>
 
 
 namespace LLGL
 {
 
 
+/*
+Returns true if the specified buffer can be relocated during device memory defragmentation.
+This is limited to buffers whose native handles are only referenced by command buffers, i.e. not by descriptor sets, and that are never mapped.
+*/
+static bool IsRelocatableBuffer(const BufferDescriptor& desc)
+{
+    const long relocatableBindFlags = (BindFlags::VertexBuffer | BindFlags::IndexBuffer | BindFlags::IndirectBuffer | BindFlags::CopySrc | BindFlags::CopyDst);
+    return
+    (
+        (desc.bindFlags & ~relocatableBindFlags) == 0 &&
+        desc.cpuAccessFlags == 0 &&
+        (desc.miscFlags & (MiscFlags::DynamicUsage | MiscFlags::PersistentMapping)) == 0
+    );
+}
+
+static bool IsReadbackBuffer(const BufferDescriptor& desc)
+{
+    return ((desc.miscFlags & MiscFlags::Readback) != 0);
+}
+
+static bool IsPersistentBuffer(const BufferDescriptor& desc)
+{
+    return (desc.cpuAccessFlags != 0 && (desc.miscFlags & MiscFlags::PersistentMapping) != 0);
+}
+
 static VkBufferUsageFlags GetVkBufferUsageFlags(const BufferDescriptor& desc)
 {
     VkBufferUsageFlags flags = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
@@ -32,8 +59,14 @@ static VkBufferUsageFlags GetVkBufferUsageFlags(const BufferDescriptor& desc)
     if ((desc.bindFlags & (BindFlags::Sampled | BindFlags::Storage)) != 0)
         flags |= VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
     if ((desc.bindFlags & BindFlags::IndirectBuffer) != 0)
+    {
         flags |= VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
 
+        /* Indirect argument buffers can also provide predicates for conditional rendering with extension VK_EXT_conditional_rendering */
+        if (HasExtension(VKExt::EXT_conditional_rendering))
+            flags |= VK_BUFFER_USAGE_CONDITIONAL_RENDERING_BIT_EXT;
+    }
+
     if ((desc.bindFlags & BindFlags::StreamOutputBuffer) != 0)
     {
         if (HasExtension(VKExt::EXT_transform_feedback))
@@ -48,7 +81,19 @@ static VkBufferUsageFlags GetVkBufferUsageFlags(const BufferDescriptor& desc)
         }
     }
 
-    if ((desc.cpuAccessFlags & CPUAccessFlags::Read) != 0 || (desc.bindFlags & BindFlags::CopySrc) != 0)
+    if ((desc.bindFlags & BindFlags::AccelerationStructure) != 0)
+        flags |= VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_STORAGE_BIT_KHR;
+
+    if (HasExtension(VKExt::KHR_acceleration_structure))
+    {
+        /* Acceleration structure builds read their inputs and scratch memory by device addresses with extension VK_KHR_acceleration_structure */
+        flags |= VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT_KHR;
+        if ((desc.bindFlags & (BindFlags::VertexBuffer | BindFlags::IndexBuffer | BindFlags::Sampled | BindFlags::Storage)) != 0)
+            flags |= VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_BUILD_INPUT_READ_ONLY_BIT_KHR;
+    }
+
+    /* Relocatable buffers are copied into their new memory region during defragmentation */
+    if ((desc.cpuAccessFlags & CPUAccessFlags::Read) != 0 || (desc.bindFlags & BindFlags::CopySrc) != 0 || IsRelocatableBuffer(desc))
         flags |= VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
 
     return flags;
@@ -72,16 +117,22 @@ static VkAccessFlags GetBufferVkAccessFlags(long bindFlags)
         accessFlags |= VK_ACCESS_SHADER_READ_BIT;
     if ((bindFlags & BindFlags::Storage) != 0)
         accessFlags |= VK_ACCESS_SHADER_WRITE_BIT;
+    if ((bindFlags & BindFlags::AccelerationStructure) != 0)
+        accessFlags |= VK_ACCESS_ACCELERATION_STRUCTURE_READ_BIT_KHR;
 
     return accessFlags;
 }
 
 VKBuffer::VKBuffer(VkDevice device, const BufferDescriptor& desc) :
-    Buffer            { desc.bindFlags                         },
-    bufferObj_        { device                                 },
-    bufferObjStaging_ { device                                 },
-    size_             { desc.size                              },
-    accessFlags_      { GetBufferVkAccessFlags(desc.bindFlags) }
+    Buffer            { desc.bindFlags                            },
+    bufferObj_        { device                                    },
+    bufferObjStaging_ { device                                    },
+    accelStruct_      { device, vkDestroyAccelerationStructureKHR },
+    size_             { desc.size                                 },
+    accessFlags_      { GetBufferVkAccessFlags(desc.bindFlags)    },
+    relocatable_      { IsRelocatableBuffer(desc)                 },
+    readback_         { IsReadbackBuffer(desc)                    },
+    persistent_       { IsPersistentBuffer(desc)                  }
 {
     if ((desc.bindFlags & BindFlags::IndexBuffer) != 0)
         indexType_ = VKTypes::ToVkIndexType(desc.format);
@@ -114,9 +165,43 @@ BufferDescriptor VKBuffer::GetDesc() const
     return bufferDesc;
 }
 
+void VKBuffer::SetResidencyPriority(ResidencyPriority priority)
+{
+    if (VKDeviceMemoryRegion* region = bufferObj_.GetMemoryRegion())
+        region->GetParentChunk()->SetRegionResidency(region, VKTypes::ToVkMemoryPriority(priority), region->IsEvicted());
+}
+
+bool VKBuffer::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
+{
+    if (nativeHandle != nullptr && nativeHandleSize == sizeof(Vulkan::ResourceNativeHandle))
+    {
+        auto* nativeHandleVK = reinterpret_cast<Vulkan::ResourceNativeHandle*>(nativeHandle);
+        nativeHandleVK->image  = VK_NULL_HANDLE;
+        nativeHandleVK->buffer = GetVkBuffer();
+        if (VKDeviceMemoryRegion* region = bufferObj_.GetMemoryRegion())
+        {
+            nativeHandleVK->deviceMemory = region->GetParentChunk()->GetVkDeviceMemory();
+            nativeHandleVK->memoryOffset = region->GetOffset();
+            nativeHandleVK->memorySize   = region->GetSize();
+        }
+        else
+        {
+            nativeHandleVK->deviceMemory = VK_NULL_HANDLE;
+            nativeHandleVK->memoryOffset = 0;
+            nativeHandleVK->memorySize   = 0;
+        }
+        return true;
+    }
+    return false;
+}
+
 void VKBuffer::BindMemoryRegion(VkDevice device, VKDeviceMemoryRegion* memoryRegion)
 {
     bufferObj_.BindMemoryRegion(device, memoryRegion);
+
+    /* Acceleration structures can only be created once the buffer is bound to device memory */
+    if ((GetBindFlags() & BindFlags::AccelerationStructure) != 0)
+        CreateAccelerationStructure(device);
 }
 
 void VKBuffer::TakeStagingBuffer(VKDeviceBuffer&& deviceBuffer)
@@ -124,13 +209,58 @@ void VKBuffer::TakeStagingBuffer(VKDeviceBuffer&& deviceBuffer)
     bufferObjStaging_ = std::move(deviceBuffer);
 }
 
+VkDeviceAddress VKBuffer::GetDeviceAddress(VkDevice device) const
+{
+    VkBufferDeviceAddressInfoKHR addressInfo;
+    {
+        addressInfo.sType   = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO_KHR;
+        addressInfo.pNext   = nullptr;
+        addressInfo.buffer  = GetVkBuffer();
+    }
+    return vkGetBufferDeviceAddressKHR(device, &addressInfo);
+}
+
+VkDeviceAddress VKBuffer::GetAccelerationStructureAddress(VkDevice device) const
+{
+    if (accelStruct_.Get() == VK_NULL_HANDLE)
+        return 0;
+
+    VkAccelerationStructureDeviceAddressInfoKHR addressInfo;
+    {
+        addressInfo.sType                   = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_DEVICE_ADDRESS_INFO_KHR;
+        addressInfo.pNext                   = nullptr;
+        addressInfo.accelerationStructure   = accelStruct_.Get();
+    }
+    return vkGetAccelerationStructureDeviceAddressKHR(device, &addressInfo);
+}
+
 void* VKBuffer::Map(VKDevice& device, const CPUAccess access, VkDeviceSize offset, VkDeviceSize length)
 {
+    /* Map persistent buffers only once; their host coherent memory needs no flush and no staging copy */
+    if (persistent_)
+    {
+        if (persistentData_ == nullptr)
+            persistentData_ = bufferObj_.Map(device);
+        return (persistentData_ != nullptr ? static_cast<char*>(persistentData_) + offset : nullptr);
+    }
+
+    /* Map readback buffers directly; the application is responsible to wait for pending copy commands */
+    if (readback_)
+        return bufferObj_.Map(device);
+
     if (VkBuffer stagingBuffer = GetStagingVkBuffer())
     {
         /* Copy GPU local buffer into staging buffer for read accces */
         if (HasReadAccess(access))
+        {
             device.CopyBuffer(GetVkBuffer(), stagingBuffer, GetSize());
+            device.FlushUploads(true);
+        }
+        else if (device.HasPendingUploads())
+        {
+            /* Pending transfers might still read from the staging buffer */
+            device.FlushUploads(true);
+        }
 
         if (HasWriteAccess(access))
         {
@@ -146,6 +276,16 @@ void* VKBuffer::Map(VKDevice& device, const CPUAccess access, VkDeviceSize offse
 
 void VKBuffer::Unmap(VKDevice& device)
 {
+    /* Persistent buffers keep their mapping until they are released */
+    if (persistent_)
+        return;
+
+    if (readback_)
+    {
+        bufferObj_.Unmap(device);
+        return;
+    }
+
     if (VkBuffer stagingBuffer = GetStagingVkBuffer())
     {
         /* Unmap staging buffer */
@@ -156,13 +296,45 @@ void VKBuffer::Unmap(VKDevice& device)
         {
             const VkDeviceSize offset = mappedWriteRange_[0];
             const VkDeviceSize length = (mappedWriteRange_[1] - mappedWriteRange_[0]);
-            device.CopyBuffer(stagingBuffer, GetVkBuffer(), length, offset, offset);
+            device.UploadBuffer(stagingBuffer, GetVkBuffer(), length, offset, offset);
             mappedWriteRange_[0] = 0;
             mappedWriteRange_[1] = 0;
         }
     }
 }
 
+void VKBuffer::ReleasePersistentMapping(VkDevice device)
+{
+    if (persistentData_ != nullptr)
+    {
+        bufferObj_.Unmap(device);
+        persistentData_ = nullptr;
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+// Acceleration structures are created with the generic type to cover the entire buffer, so they can be built as either bottom or top level.
+void VKBuffer::CreateAccelerationStructure(VkDevice device)
+{
+    VkAccelerationStructureCreateInfoKHR createInfo;
+    {
+        createInfo.sType            = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_KHR;
+        createInfo.pNext            = nullptr;
+        createInfo.createFlags      = 0;
+        createInfo.buffer           = GetVkBuffer();
+        createInfo.offset           = 0;
+        createInfo.size             = GetSize();
+        createInfo.type             = VK_ACCELERATION_STRUCTURE_TYPE_GENERIC_KHR;
+        createInfo.deviceAddress    = 0;
+    }
+    VkResult result = vkCreateAccelerationStructureKHR(device, &createInfo, nullptr, accelStruct_.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan acceleration structure");
+}
+
 
 } // /namespace LLGL
 
@@ -12,6 +12,7 @@
 #include <LLGL/Buffer.h>
 #include "VKDeviceBuffer.h"
 #include "../Memory/VKDeviceMemory.h"
+#include "../VKPtr.h"
 
 
 namespace LLGL
@@ -27,6 +28,9 @@ class VKBuffer : public Buffer
 
         BufferDescriptor GetDesc() const override;
 
+        void SetResidencyPriority(ResidencyPriority priority) override;
+        bool GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize) override;
+
     public:
 
         VKBuffer(VkDevice device, const BufferDescriptor& desc);
@@ -37,6 +41,15 @@ class VKBuffer : public Buffer
         void* Map(VKDevice& device, const CPUAccess access, VkDeviceSize offset, VkDeviceSize length);
         void Unmap(VKDevice& device);
 
+        // Unmaps the memory of a persistently mapped buffer. This must be called before the memory region is released.
+        void ReleasePersistentMapping(VkDevice device);
+
+        // Returns the device address of this buffer. Requires extension VK_KHR_buffer_device_address.
+        VkDeviceAddress GetDeviceAddress(VkDevice device) const;
+
+        // Returns the device address of the acceleration structure of this buffer or 0 if this buffer was not created with BindFlags::AccelerationStructure.
+        VkDeviceAddress GetAccelerationStructureAddress(VkDevice device) const;
+
         // Returns the device buffer object.
         inline VKDeviceBuffer& GetDeviceBuffer()
         {
@@ -73,6 +86,12 @@ class VKBuffer : public Buffer
             return bufferObjStaging_.GetVkBuffer();
         }
 
+        // Returns the acceleration structure object or VK_NULL_HANDLE if this buffer was not created with BindFlags::AccelerationStructure.
+        inline VkAccelerationStructureKHR GetVkAccelerationStructure() const
+        {
+            return accelStruct_.Get();
+        }
+
         // Returns the size originally specified in the descriptor.
         inline VkDeviceSize GetSize() const
         {
@@ -91,17 +110,51 @@ class VKBuffer : public Buffer
             return accessFlags_;
         }
 
+        // Returns true if this buffer can be relocated during device memory defragmentation. See VKDeviceBuffer::EnableRelocation.
+        inline bool IsRelocatable() const
+        {
+            return relocatable_;
+        }
+
+        // Returns true if this buffer resides in host visible memory and is mapped directly (see MiscFlags::Readback).
+        inline bool IsReadback() const
+        {
+            return readback_;
+        }
+
+        // Returns true if this buffer resides in host coherent memory and stays mapped for its entire lifetime (see MiscFlags::PersistentMapping).
+        inline bool IsPersistent() const
+        {
+            return persistent_;
+        }
+
+        // Returns true if this buffer resides in host visible memory, i.e. it has no staging buffer.
+        inline bool IsHostVisible() const
+        {
+            return (readback_ || persistent_);
+        }
+
     private:
 
-        VKDeviceBuffer  bufferObj_;
-        VKDeviceBuffer  bufferObjStaging_;
+        void CreateAccelerationStructure(VkDevice device);
+
+    private:
+
+        VKDeviceBuffer                      bufferObj_;
+        VKDeviceBuffer                      bufferObjStaging_;
+        VKPtr<VkAccelerationStructureKHR>   accelStruct_;
+
+        VkDeviceSize                        size_                   = 0;
+        VkDeviceSize                        mappedWriteRange_[2]    = { 0, 0 };
+        void*                               persistentData_         = nullptr;
 
-        VkDeviceSize    size_                   = 0;
-        VkDeviceSize    mappedWriteRange_[2]    = { 0, 0 };
+        VkIndexType                         indexType_              = VK_INDEX_TYPE_MAX_ENUM;
 
-        VkIndexType     indexType_              = VK_INDEX_TYPE_MAX_ENUM;
+        VkAccessFlags                       accessFlags_            = 0;
 
-        VkAccessFlags   accessFlags_            = 0;
+        bool                                relocatable_            = false;
+        bool                                readback_               = false;
+        bool                                persistent_             = false;
 
 };
 
@@ -10,6 +10,7 @@
 #include "../../CheckedCast.h"
 #include "../../BufferUtils.h"
 #include "../../../Core/CoreUtils.h"
+#include <LLGL/Utils/ForRange.h>
 
 
 namespace LLGL
@@ -20,16 +21,25 @@ VKBufferArray::VKBufferArray(std::uint32_t numBuffers, Buffer* const * bufferArr
     BufferArray { GetCombinedBindFlags(numBuffers, bufferArray) }
 {
     /* Store the object of each VKBuffer inside the array and  */
+    bufferRefs_.reserve(numBuffers);
     buffers_.reserve(numBuffers);
     offsets_.reserve(numBuffers);
 
     while (auto next = NextArrayResource<VKBuffer>(numBuffers, bufferArray))
     {
+        bufferRefs_.push_back(next);
         buffers_.push_back(next->GetVkBuffer());
         offsets_.push_back(0);//next->GetOffset()
     }
 }
 
+const SmallVector<VkBuffer>& VKBufferArray::GetBuffers()
+{
+    for_range(i, bufferRefs_.size())
+        buffers_[i] = bufferRefs_[i]->GetVkBuffer();
+    return buffers_;
+}
+
 
 } // /namespace LLGL
 
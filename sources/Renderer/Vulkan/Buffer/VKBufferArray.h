@@ -10,8 +10,8 @@
 
 
 #include <LLGL/BufferArray.h>
+#include <LLGL/Container/SmallVector.h>
 #include "../Vulkan.h"
-#include <vector>
 #include <cstdint>
 
 
@@ -20,6 +20,7 @@ namespace LLGL
 
 
 class Buffer;
+class VKBuffer;
 
 class VKBufferArray final : public BufferArray
 {
@@ -28,22 +29,20 @@ class VKBufferArray final : public BufferArray
 
         VKBufferArray(std::uint32_t numBuffers, Buffer* const * bufferArray);
 
-        // Returns the array of buffer objects.
-        inline const std::vector<VkBuffer>& GetBuffers() const
-        {
-            return buffers_;
-        }
+        // Returns the array of native buffer objects. The handles are updated first, since buffers can be relocated during device memory defragmentation.
+        const SmallVector<VkBuffer>& GetBuffers();
 
         // Returns the array of offsets.
-        inline const std::vector<VkDeviceSize>& GetOffsets() const
+        inline const SmallVector<VkDeviceSize>& GetOffsets() const
         {
             return offsets_;
         }
 
     private:
 
-        std::vector<VkBuffer>       buffers_;
-        std::vector<VkDeviceSize>   offsets_;
+        SmallVector<VKBuffer*>      bufferRefs_;
+        SmallVector<VkBuffer>       buffers_;
+        SmallVector<VkDeviceSize>   offsets_;
 
 };
 
@@ -8,6 +8,7 @@
 #include "VKDeviceBuffer.h"
 #include "../Memory/VKDeviceMemoryManager.h"
 #include "../VKCore.h"
+#include "../VKDevice.h"
 #include <algorithm>
 
 
@@ -32,18 +33,23 @@ VKDeviceBuffer::VKDeviceBuffer(
     VkDevice                    device,
     const VkBufferCreateInfo&   createInfo,
     VKDeviceMemoryManager&      deviceMemoryMngr,
-    VkMemoryPropertyFlags       memoryProperties)
+    VkMemoryPropertyFlags       memoryProperties,
+    bool                        transientMemory)
 :
     VKDeviceBuffer { device }
 {
-    CreateVkBufferAndMemoryRegion(device, createInfo, deviceMemoryMngr, memoryProperties);
+    CreateVkBufferAndMemoryRegion(device, createInfo, deviceMemoryMngr, memoryProperties, transientMemory);
 }
 
 VKDeviceBuffer::VKDeviceBuffer(VKDeviceBuffer&& rhs) :
     buffer_       { std::move(rhs.buffer_) },
     requirements_ { rhs.requirements_      },
-    memoryRegion_ { rhs.memoryRegion_      }
+    memoryRegion_ { rhs.memoryRegion_      },
+    createFlags_  { rhs.createFlags_       },
+    size_         { rhs.size_              },
+    usage_        { rhs.usage_             }
 {
+    TakeRegionOwnership(rhs);
     rhs.memoryRegion_ = nullptr;
 }
 
@@ -52,6 +58,10 @@ VKDeviceBuffer& VKDeviceBuffer::operator = (VKDeviceBuffer&& rhs)
     buffer_             = std::move(rhs.buffer_);
     requirements_       = rhs.requirements_;
     memoryRegion_       = rhs.memoryRegion_;
+    createFlags_        = rhs.createFlags_;
+    size_               = rhs.size_;
+    usage_              = rhs.usage_;
+    TakeRegionOwnership(rhs);
     rhs.memoryRegion_   = nullptr;
     return *this;
 }
@@ -64,18 +74,28 @@ void VKDeviceBuffer::CreateVkBuffer(VkDevice device, const VkBufferCreateInfo& c
     auto result = vkCreateBuffer(device, &createInfo, nullptr, buffer_.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan buffer");
     vkGetBufferMemoryRequirements(device, buffer_, &requirements_);
+
+    createFlags_    = createInfo.flags;
+    size_           = createInfo.size;
+    usage_          = createInfo.usage;
 }
 
 void VKDeviceBuffer::CreateVkBufferAndMemoryRegion(
     VkDevice                    device,
     const VkBufferCreateInfo&   createInfo,
     VKDeviceMemoryManager&      deviceMemoryMngr,
-    VkMemoryPropertyFlags       memoryProperties)
+    VkMemoryPropertyFlags       memoryProperties,
+    bool                        transientMemory)
 {
     /* Create Vulkan bnuffer object */
     CreateVkBuffer(device, createInfo);
 
-    if (auto memoryRegion = deviceMemoryMngr.Allocate(requirements_, memoryProperties))
+    VKDeviceMemoryRegion* memoryRegion = (transientMemory
+        ? deviceMemoryMngr.AllocateTransient(requirements_, memoryProperties)
+        : deviceMemoryMngr.AllocateBuffer(buffer_, requirements_, memoryProperties)
+    );
+
+    if (memoryRegion != nullptr)
     {
         /* Bind allocated memory region to buffer */
         BindMemoryRegion(device, memoryRegion);
@@ -110,6 +130,57 @@ void VKDeviceBuffer::ReleaseMemoryRegion(VKDeviceMemoryManager& deviceMemoryMngr
     memoryRegion_ = nullptr;
 }
 
+void VKDeviceBuffer::EnableRelocation()
+{
+    if (memoryRegion_ != nullptr)
+    {
+        VKDeviceMemory* chunk = memoryRegion_->GetParentChunk();
+        if (!chunk->IsTransient() && !chunk->IsDedicated())
+            chunk->SetRegionOwner(memoryRegion_, this);
+    }
+}
+
+bool VKDeviceBuffer::Relocate(VKDevice& device, VKDeviceMemoryManager& deviceMemoryMngr)
+{
+    if (memoryRegion_ == nullptr)
+        return false;
+
+    /* Create new native buffer with the same attributes */
+    VkBufferCreateInfo createInfo;
+    {
+        createInfo.sType                    = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        createInfo.pNext                    = nullptr;
+        createInfo.flags                    = createFlags_;
+        createInfo.size                     = size_;
+        createInfo.usage                    = usage_;
+        createInfo.sharingMode              = VK_SHARING_MODE_EXCLUSIVE;
+        createInfo.queueFamilyIndexCount    = 0;
+        createInfo.pQueueFamilyIndices      = nullptr;
+    }
+    VKDeviceBuffer newBuffer{ device, createInfo };
+
+    /* Allocate region in another chunk; the new buffer is destroyed immediately if there is no space */
+    VKDeviceMemoryRegion* newRegion = deviceMemoryMngr.AllocateRelocation(newBuffer.GetRequirements(), memoryRegion_->GetParentChunk());
+    if (newRegion == nullptr)
+        return false;
+
+    newBuffer.BindMemoryRegion(device, newRegion);
+
+    /* Keep the residency of the buffer in its new chunk */
+    newRegion->GetParentChunk()->SetRegionResidency(newRegion, memoryRegion_->GetPriority(), memoryRegion_->IsEvicted());
+
+    /* Swap native buffers: the old buffer is pinned and kept alive until the copy has completed */
+    VKDeviceBuffer oldBuffer = std::move(*this);
+    *this = std::move(newBuffer);
+
+    oldBuffer.GetMemoryRegion()->GetParentChunk()->SetRegionOwner(oldBuffer.GetMemoryRegion(), nullptr);
+    EnableRelocation();
+
+    device.RelocateBuffer(std::move(oldBuffer), GetVkBuffer(), size_, deviceMemoryMngr);
+
+    return true;
+}
+
 void* VKDeviceBuffer::Map(VkDevice device, VkDeviceSize offset, VkDeviceSize size)
 {
     if (memoryRegion_)
@@ -128,6 +199,17 @@ void VKDeviceBuffer::Unmap(VkDevice device)
 }
 
 
+/*
+ * ======= Private: =======
+ */
+
+void VKDeviceBuffer::TakeRegionOwnership(const VKDeviceBuffer& rhs)
+{
+    if (memoryRegion_ != nullptr && memoryRegion_->GetOwner() == &rhs)
+        memoryRegion_->GetParentChunk()->SetRegionOwner(memoryRegion_, this);
+}
+
+
 } // /namespace LLGL
 
 
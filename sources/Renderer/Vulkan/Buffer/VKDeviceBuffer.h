@@ -19,6 +19,7 @@ namespace LLGL
 {
 
 
+class VKDevice;
 class VKDeviceMemoryManager;
 
 class VKDeviceBuffer
@@ -36,7 +37,8 @@ class VKDeviceBuffer
             VkDevice                    device,
             const VkBufferCreateInfo&   createInfo,
             VKDeviceMemoryManager&      deviceMemoryMngr,
-            VkMemoryPropertyFlags       memoryProperties
+            VkMemoryPropertyFlags       memoryProperties,
+            bool                        transientMemory     = false
         );
 
         VKDeviceBuffer(const VKDeviceBuffer&) = delete;
@@ -49,11 +51,13 @@ class VKDeviceBuffer
 
         void CreateVkBuffer(VkDevice device, const VkBufferCreateInfo& createInfo);
 
+        // Creates the buffer and binds it to a new memory region. If 'transientMemory' is true, the region is allocated from a transient chunk for short-lived buffers.
         void CreateVkBufferAndMemoryRegion(
             VkDevice                    device,
             const VkBufferCreateInfo&   createInfo,
             VKDeviceMemoryManager&      deviceMemoryMngr,
-            VkMemoryPropertyFlags       memoryProperties
+            VkMemoryPropertyFlags       memoryProperties,
+            bool                        transientMemory     = false
         );
 
         void ReleaseVkBuffer();
@@ -63,6 +67,18 @@ class VKDeviceBuffer
 
         void ReleaseMemoryRegion(VKDeviceMemoryManager& deviceMemoryMngr);
 
+        /*
+        Allows the memory region of this buffer to be moved into another chunk during defragmentation (see VKDeviceMemoryManager::Defragment).
+        Only use this for device-local buffers that are exclusively owned by the graphics queue, are never mapped, and whose native handle is not cached anywhere else.
+        */
+        void EnableRelocation();
+
+        /*
+        Creates a new native buffer with the same attributes in a different chunk, records a copy of the entire content, and replaces the native buffer of this object.
+        The previous native buffer and its memory region are released once the copy has completed. Returns false if no other chunk has enough free space.
+        */
+        bool Relocate(VKDevice& device, VKDeviceMemoryManager& deviceMemoryMngr);
+
         void* Map(VkDevice device, VkDeviceSize offset = 0, VkDeviceSize size = VK_WHOLE_SIZE);
         void Unmap(VkDevice device);
 
@@ -86,12 +102,22 @@ class VKDeviceBuffer
             return memoryRegion_;
         }
 
+    private:
+
+        // Moves the owner of the memory region from the specified buffer to this buffer.
+        void TakeRegionOwnership(const VKDeviceBuffer& rhs);
+
     private:
 
         VKPtr<VkBuffer>         buffer_;
         VkMemoryRequirements    requirements_;
         VKDeviceMemoryRegion*   memoryRegion_   = nullptr;
 
+        /* Attributes of the native buffer to create an equivalent buffer when it's relocated */
+        VkBufferCreateFlags     createFlags_    = 0;
+        VkDeviceSize            size_           = 0;
+        VkBufferUsageFlags      usage_          = 0;
+
 };
 
 
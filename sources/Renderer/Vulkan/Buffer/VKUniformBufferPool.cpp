@@ -0,0 +1,160 @@
+/*
+ * VKUniformBufferPool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VKUniformBufferPool.h"
+#include "../VKPhysicalDevice.h"
+#include "../VKCore.h"
+#include "../../../Core/CoreUtils.h"
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+VKUniformBufferPool::VKUniformBufferPool(
+    const VKPhysicalDevice& physicalDevice,
+    VkDevice                device,
+    VkBufferUsageFlags      usage)
+:
+    physicalDevice_ { physicalDevice },
+    device_         { device         },
+    usage_          { usage          }
+{
+    if ((usage & VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT) != 0)
+    {
+        /* Dynamic offsets must be a multiple of the minimum uniform buffer offset alignment */
+        offsetAlignment_ = std::max<VkDeviceSize>(1, physicalDevice.GetProperties().limits.minUniformBufferOffsetAlignment);
+    }
+    else
+    {
+        /* Copy source offsets have no alignment requirement, but keep allocations aligned for fast memory copies */
+        offsetAlignment_ = 16;
+    }
+}
+
+void VKUniformBufferPool::Reset()
+{
+    if (!chunks_.empty())
+    {
+        for_range(i, chunkIndex_ + 1)
+            chunks_[i].offset = 0;
+        chunkIndex_ = 0;
+    }
+}
+
+VKUniformAllocation VKUniformBufferPool::Allocate(const void* data, VkDeviceSize size)
+{
+    if (chunks_.empty())
+    {
+        /* Allocate initial chunk */
+        chunks_.emplace_back();
+        AllocateChunk(chunks_.back(), size);
+    }
+    else if (chunks_[chunkIndex_].offset + size > chunks_[chunkIndex_].size)
+    {
+        /* Move to next chunk and allocate new one as needed */
+        ++chunkIndex_;
+        if (chunkIndex_ == chunks_.size())
+        {
+            chunks_.emplace_back();
+            AllocateChunk(chunks_.back(), size);
+        }
+        else if (chunks_[chunkIndex_].size < size)
+        {
+            /* Replace chunk that is too small; It is not in use since the last reset */
+            AllocateChunk(chunks_[chunkIndex_], size);
+        }
+    }
+
+    /* Copy data into persistently mapped memory; The memory is host-coherent, so no flush is required */
+    Chunk& chunk = chunks_[chunkIndex_];
+
+    VKUniformAllocation allocation;
+    {
+        allocation.buffer = chunk.buffer.Get();
+        allocation.offset = chunk.offset;
+    }
+    ::memcpy(chunk.mappedData + chunk.offset, data, static_cast<std::size_t>(size));
+    chunk.offset = GetAlignedSize<VkDeviceSize>(chunk.offset + size, offsetAlignment_);
+
+    return allocation;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+static VkDeviceSize GetChunkCapacity(std::uint32_t level)
+{
+    constexpr VkDeviceSize initialCapacity = 64 * 1024;
+    return (initialCapacity << std::min(level, 5u));
+}
+
+void VKUniformBufferPool::AllocateChunk(Chunk& chunk, VkDeviceSize minSize)
+{
+    const VkDeviceSize chunkSize = std::max(GetChunkCapacity(capacityLevel_), GetAlignedSize(minSize, offsetAlignment_));
+
+    /* Release previous chunk before its memory is replaced */
+    chunk = Chunk{};
+    chunk.size = chunkSize;
+
+    /* Create native buffer with the usage of this pool */
+    VkBufferCreateInfo createInfo;
+    {
+        createInfo.sType                    = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        createInfo.pNext                    = nullptr;
+        createInfo.flags                    = 0;
+        createInfo.size                     = chunkSize;
+        createInfo.usage                    = usage_;
+        createInfo.sharingMode              = VK_SHARING_MODE_EXCLUSIVE;
+        createInfo.queueFamilyIndexCount    = 0;
+        createInfo.pQueueFamilyIndices      = nullptr;
+    }
+    chunk.buffer = VKPtr<VkBuffer>{ device_, vkDestroyBuffer };
+    VkResult result = vkCreateBuffer(device_, &createInfo, nullptr, chunk.buffer.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan buffer for buffer pool");
+
+    /* Allocate host-visible and host-coherent memory exclusively for this chunk */
+    VkMemoryRequirements requirements;
+    vkGetBufferMemoryRequirements(device_, chunk.buffer.Get(), &requirements);
+
+    VkMemoryAllocateInfo allocInfo;
+    {
+        allocInfo.sType             = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        allocInfo.pNext             = nullptr;
+        allocInfo.allocationSize    = requirements.size;
+        allocInfo.memoryTypeIndex   = physicalDevice_.FindMemoryType(
+            requirements.memoryTypeBits,
+            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
+        );
+    }
+    chunk.deviceMemory = VKPtr<VkDeviceMemory>{ device_, vkFreeMemory };
+    result = vkAllocateMemory(device_, &allocInfo, nullptr, chunk.deviceMemory.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to allocate Vulkan device memory for buffer pool");
+
+    result = vkBindBufferMemory(device_, chunk.buffer.Get(), chunk.deviceMemory.Get(), 0);
+    VKThrowIfFailed(result, "failed to bind Vulkan device memory to buffer pool");
+
+    /* Map memory for the entire lifetime of this chunk; It is implicitly unmapped when the memory is released */
+    void* mappedData = nullptr;
+    result = vkMapMemory(device_, chunk.deviceMemory.Get(), 0, VK_WHOLE_SIZE, 0, &mappedData);
+    VKThrowIfFailed(result, "failed to map Vulkan buffer pool into CPU memory space");
+    chunk.mappedData = static_cast<char*>(mappedData);
+
+    ++capacityLevel_;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,93 @@
+/*
+ * VKUniformBufferPool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VK_UNIFORM_BUFFER_POOL_H
+#define LLGL_VK_UNIFORM_BUFFER_POOL_H
+
+
+#include "../Vulkan.h"
+#include "../VKPtr.h"
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class VKPhysicalDevice;
+
+// Allocation of uniform data within a uniform buffer of the VKUniformBufferPool.
+struct VKUniformAllocation
+{
+    VkBuffer        buffer  = VK_NULL_HANDLE;
+    VkDeviceSize    offset  = 0;
+};
+
+/*
+Linear allocator for uniform data in persistently mapped host-visible memory. Used for uniform blocks that are bound with dynamic offsets
+and, with VK_BUFFER_USAGE_TRANSFER_SRC_BIT, as staging arena for buffer updates that are too large for vkCmdUpdateBuffer.
+Each chunk has its own VkDeviceMemory object, because memory that is mapped for the lifetime of the chunk must not be shared with other buffers.
+Allocations are only valid until the next call to Reset(), so each native command buffer must have its own pool.
+*/
+class VKUniformBufferPool
+{
+
+    public:
+
+        VKUniformBufferPool(
+            const VKPhysicalDevice& physicalDevice,
+            VkDevice                device,
+            VkBufferUsageFlags      usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT
+        );
+
+        VKUniformBufferPool(const VKUniformBufferPool&) = delete;
+        VKUniformBufferPool& operator = (const VKUniformBufferPool&) = delete;
+
+        // Resets all chunks in the pool. Previous allocations must no longer be in use by the GPU.
+        void Reset();
+
+        // Copies the specified data into the next free range of the pool and returns its buffer and offset.
+        VKUniformAllocation Allocate(const void* data, VkDeviceSize size);
+
+    private:
+
+        struct Chunk
+        {
+            VKPtr<VkDeviceMemory>   deviceMemory;
+            VKPtr<VkBuffer>         buffer;
+            char*                   mappedData      = nullptr;
+            VkDeviceSize            size            = 0;
+            VkDeviceSize            offset          = 0;
+        };
+
+    private:
+
+        // Allocates the native buffer and memory of the specified chunk that can hold at least the specified number of bytes.
+        void AllocateChunk(Chunk& chunk, VkDeviceSize minSize);
+
+    private:
+
+        const VKPhysicalDevice& physicalDevice_;
+        VkDevice                device_             = VK_NULL_HANDLE;
+        VkBufferUsageFlags      usage_              = 0;
+        VkDeviceSize            offsetAlignment_    = 1;
+        std::vector<Chunk>      chunks_;
+        std::size_t             chunkIndex_         = 0;
+        std::uint32_t           capacityLevel_      = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
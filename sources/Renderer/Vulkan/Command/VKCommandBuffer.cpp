@@ -7,6 +7,8 @@
 
 #include "VKCommandBuffer.h"
 #include "VKCommandQueue.h"
+#include "VKDynamicRendering.h"
+#include "../VKDevice.h"
 #include "../VKPhysicalDevice.h"
 #include "../VKSwapChain.h"
 #include "../VKTypes.h"
@@ -23,12 +25,16 @@
 #include "../Texture/VKRenderTarget.h"
 #include "../Buffer/VKBuffer.h"
 #include "../Buffer/VKBufferArray.h"
+#include "../Buffer/VKAccelerationStructure.h"
 #include "../../CheckedCast.h"
 #include "../../../Core/Exception.h"
+#include "../../../Core/ProfileZone.h"
 #include <LLGL/Utils/ForRange.h>
+#include <LLGL/Container/SmallVector.h>
 #include <LLGL/Constants.h>
 #include <LLGL/TypeInfo.h>
 #include <cstddef>
+#include <algorithm>
 
 #include <LLGL/Backend/Vulkan/NativeHandle.h>
 
@@ -39,6 +45,9 @@ namespace LLGL
 
 constexpr std::uint32_t VKCommandBuffer::maxNumCommandBuffers;
 
+// Maximum size (in bytes) of data that can be encoded inline with vkCmdUpdateBuffer.
+static constexpr VkDeviceSize g_maxInlineUpdateBufferSize = 65536;
+
 // Returns the maximum for a indirect multi draw command
 static std::uint32_t GetMaxDrawIndirectCount(const VKPhysicalDevice& physicalDevice)
 {
@@ -50,8 +59,8 @@ static std::uint32_t GetMaxDrawIndirectCount(const VKPhysicalDevice& physicalDev
 
 VKCommandBuffer::VKCommandBuffer(
     const VKPhysicalDevice&         physicalDevice,
-    VkDevice                        device,
-    VkQueue                         commandQueue,
+    VKDevice&                       device,
+    VKCommandQueue&                 commandQueue,
     const QueueFamilyIndices&       queueFamilyIndices,
     const CommandBufferDescriptor&  desc)
 :
@@ -62,13 +71,27 @@ VKCommandBuffer::VKCommandBuffer(
     queuePresentFamily_     { queueFamilyIndices.presentFamily              },
     maxDrawIndirectCount_   { GetMaxDrawIndirectCount(physicalDevice)       },
     recordingFenceArray_    { VKPtr<VkFence>{ device, vkDestroyFence },
+                              VKPtr<VkFence>{ device, vkDestroyFence },
                               VKPtr<VkFence>{ device, vkDestroyFence },
                               VKPtr<VkFence>{ device, vkDestroyFence }      },
+    recordingSemaphore_     { device, vkDestroySemaphore                    },
     descriptorSetPoolArray_ { device,
                               device,
-                              device                                        }
+                              device,
+                              device                                        },
+    uniformBufferPoolArray_ { { physicalDevice, device },
+                              { physicalDevice, device },
+                              { physicalDevice, device },
+                              { physicalDevice, device }                    },
+    stagingBufferPoolArray_ { { physicalDevice, device, VK_BUFFER_USAGE_TRANSFER_SRC_BIT },
+                              { physicalDevice, device, VK_BUFFER_USAGE_TRANSFER_SRC_BIT },
+                              { physicalDevice, device, VK_BUFFER_USAGE_TRANSFER_SRC_BIT },
+                              { physicalDevice, device, VK_BUFFER_USAGE_TRANSFER_SRC_BIT } },
+    compactedSizeQueryPool_ { device, vkDestroyQueryPool                    }
 {
     /* Translate creation flags */
+    explicitBarriers_ = ((desc.flags & CommandBufferFlags::ExplicitBarriers) != 0);
+
     if ((desc.flags & CommandBufferFlags::ImmediateSubmit) != 0)
     {
         immediateSubmit_    = true;
@@ -82,7 +105,8 @@ VKCommandBuffer::VKCommandBuffer(
             if (desc.renderPass != nullptr)
             {
                 auto* renderPassVK = LLGL_CAST(const VKRenderPass*, desc.renderPass);
-                renderPass_ = renderPassVK->GetVkRenderPass();
+                renderPass_             = renderPassVK->GetVkRenderPass();
+                inheritanceRenderPass_  = renderPassVK;
                 usageFlags_ |= VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
             }
         }
@@ -97,6 +121,10 @@ VKCommandBuffer::VKCommandBuffer(
     CreateVkCommandBuffers();
     CreateVkRecordingFences();
 
+    /* Timeline semaphores allow multiple command buffers to be submitted at once, since vkQueueSubmit only signals a single fence */
+    if (!immediateSubmit_ && device.GetOptionalFeatures().timelineSemaphore && HasExtension(VKExt::KHR_timeline_semaphore))
+        CreateVkRecordingSemaphore();
+
     /* Acquire first native command buffer */
     AcquireNextBuffer();
 }
@@ -114,6 +142,18 @@ VkFence VKCommandBuffer::GetQueueSubmitFenceAndFlush()
     return fence;
 }
 
+std::uint64_t VKCommandBuffer::NextRecordingSemaphoreValue()
+{
+    recordingSemaphoreValues_[commandBufferIndex_] = ++recordingSemaphoreCounter_;
+    return recordingSemaphoreCounter_;
+}
+
+void VKCommandBuffer::ResetRetrievedQueries()
+{
+    for (VKQueryHeap* queryHeap : queryHeapsInFlight_)
+        queryHeap->ResetRetrievedQueries();
+}
+
 /* ----- Encoding ----- */
 
 void VKCommandBuffer::Begin()
@@ -121,16 +161,53 @@ void VKCommandBuffer::Begin()
     /* Use next internal VkCommandBuffer object to reduce latency */
     AcquireNextBuffer();
 
-    /* Wait for fence before recording */
-    vkWaitForFences(device_, 1, &recordingFence_, VK_TRUE, UINT64_MAX);
-    vkResetFences(device_, 1, &recordingFence_);
+    if (recordingSemaphore_.Get() != VK_NULL_HANDLE)
+    {
+        /* Wait for the last submission of this native command buffer; a value of zero has already been reached initially */
+        VkSemaphore semaphore = recordingSemaphore_.Get();
+        VkSemaphoreWaitInfoKHR waitInfo;
+        {
+            waitInfo.sType          = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR;
+            waitInfo.pNext          = nullptr;
+            waitInfo.flags          = 0;
+            waitInfo.semaphoreCount = 1;
+            waitInfo.pSemaphores    = &semaphore;
+            waitInfo.pValues        = &(recordingSemaphoreValues_[commandBufferIndex_]);
+        }
+        vkWaitSemaphoresKHR(device_, &waitInfo, UINT64_MAX);
+    }
+    else
+    {
+        /* Wait for fence before recording */
+        vkWaitForFences(device_, 1, &recordingFence_, VK_TRUE, UINT64_MAX);
+        vkResetFences(device_, 1, &recordingFence_);
+    }
 
     /* Initialize inheritance if this is a secondary command buffer */
     VkCommandBufferInheritanceInfo inheritanceInfo;
+    VkCommandBufferInheritanceRenderingInfoKHR inheritanceRenderingInfo;
     if (bufferLevel_ == VK_COMMAND_BUFFER_LEVEL_SECONDARY)
     {
+        /* Inherit attachment formats instead of a native render pass for dynamic rendering */
+        const bool inheritsDynamicRendering = (inheritanceRenderPass_ != nullptr && inheritanceRenderPass_->IsDynamicRendering());
+        if (inheritsDynamicRendering)
+        {
+            VkPipelineRenderingCreateInfoKHR renderingInfo;
+            inheritanceRenderPass_->GetVkPipelineRenderingCreateInfo(renderingInfo);
+
+            inheritanceRenderingInfo.sType                      = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO_KHR;
+            inheritanceRenderingInfo.pNext                      = nullptr;
+            inheritanceRenderingInfo.flags                      = 0;
+            inheritanceRenderingInfo.viewMask                   = renderingInfo.viewMask;
+            inheritanceRenderingInfo.colorAttachmentCount       = renderingInfo.colorAttachmentCount;
+            inheritanceRenderingInfo.pColorAttachmentFormats    = renderingInfo.pColorAttachmentFormats;
+            inheritanceRenderingInfo.depthAttachmentFormat      = renderingInfo.depthAttachmentFormat;
+            inheritanceRenderingInfo.stencilAttachmentFormat    = renderingInfo.stencilAttachmentFormat;
+            inheritanceRenderingInfo.rasterizationSamples       = inheritanceRenderPass_->GetSampleCountBits();
+        }
+
         inheritanceInfo.sType                   = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
-        inheritanceInfo.pNext                   = nullptr;
+        inheritanceInfo.pNext                   = (inheritsDynamicRendering ? &inheritanceRenderingInfo : nullptr);
         inheritanceInfo.renderPass              = renderPass_;
         inheritanceInfo.subpass                 = 0;
         inheritanceInfo.framebuffer             = VK_NULL_HANDLE;
@@ -150,21 +227,25 @@ void VKCommandBuffer::Begin()
     VkResult result = vkBeginCommandBuffer(commandBuffer_, &beginInfo);
     VKThrowIfFailed(result, "failed to begin Vulkan command buffer");
 
-    #if 0//TODO: optimize
-    /* Reset all query pools that were in flight during last encoding */
-    ResetQueryPoolsInFlight();
-    #endif
-
     /* Reset record states to default values */
     recordState_                            = RecordState::OutsideRenderPass;
+    storageWriteStages_                     = 0;
+    syncedStorageBarriers_.clear();
+    queryHeapsInFlight_.clear();
     framebufferRenderArea_.offset.x         = 0;
     framebufferRenderArea_.offset.y         = 0;
     framebufferRenderArea_.extent.width     = static_cast<std::uint32_t>(INT32_MAX); // Must avoid int32 overflow
     framebufferRenderArea_.extent.height    = static_cast<std::uint32_t>(INT32_MAX); // Must avoid int32 overflow
+
+    /* Dynamic states are not retained across command buffers, so the shading rate of all graphics pipelines must be reset */
+    if (HasExtension(VKExt::KHR_fragment_shading_rate))
+        SetVkFragmentShadingRate(VkExtent2D{ 1, 1 });
 }
 
 void VKCommandBuffer::End()
 {
+    FlushPendingRenderPass();
+
     /* End encoding of current command buffer */
     VkResult result = vkEndCommandBuffer(commandBuffer_);
     VKThrowIfFailed(result, "failed to end Vulkan command buffer");
@@ -175,8 +256,8 @@ void VKCommandBuffer::End()
     /* Execute command buffer right after encoding for immediate command buffers */
     if (IsImmediateCmdBuffer())
     {
-        VkResult result = VKSubmitCommandBuffer(commandQueue_, commandBuffer_, GetQueueSubmitFence());
-        VKThrowIfFailed(result, "failed to submit command buffer to Vulkan graphics queue");
+        ResetRetrievedQueries();
+        commandQueue_.SubmitCommandBuffer(commandBuffer_, GetQueueSubmitFence());
     }
 
     ResetBindingStates();
@@ -184,9 +265,38 @@ void VKCommandBuffer::End()
 
 void VKCommandBuffer::Execute(CommandBuffer& deferredCommandBuffer)
 {
+    FlushPendingRenderPass();
+
+    /*
+    Secondary command buffers can only be executed in a render pass instance that was begun with secondary contents.
+    The render pass is only resumed with inline contents by the next command that is not an Execute call,
+    so consecutive secondary command buffers share a single render pass instance.
+    */
+    if (IsInsideRenderPass() && !secondaryContents_)
+    {
+        PauseRenderPass();
+        ResumeRenderPass(true);
+    }
+
     auto& cmdBufferVK = LLGL_CAST(VKCommandBuffer&, deferredCommandBuffer);
     VkCommandBuffer cmdBuffers[] = { cmdBufferVK.GetVkCommandBuffer() };
     vkCmdExecuteCommands(commandBuffer_, 1, cmdBuffers);
+
+    /* Queries written by the secondary command buffer are reset when this command buffer is submitted */
+    for (VKQueryHeap* queryHeap : cmdBufferVK.queryHeapsInFlight_)
+        TrackQueryHeap(*queryHeap);
+
+    /* Secondary command buffers can write to storage resources in any stage */
+    InvalidateStorageBarriers(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+
+    /* All states that were bound to this command buffer are undefined after vkCmdExecuteCommands */
+    boundPipelineLayout_        = nullptr;
+    boundPipelineState_         = nullptr;
+    descriptorCache_            = nullptr;
+    pushDescriptorLayout_       = nullptr;
+    uniformBlockInvalidated_    = false;
+    uniformBlockDescriptorSet_  = VK_NULL_HANDLE;
+    scissorRectInvalidated_     = true;
 }
 
 /* ----- Blitting ----- */
@@ -195,25 +305,42 @@ void VKCommandBuffer::UpdateBuffer(
     Buffer&         dstBuffer,
     std::uint64_t   dstOffset,
     const void*     data,
-    std::uint16_t   dataSize)
+    std::uint64_t   dataSize)
 {
+    FlushPendingRenderPass();
+
     auto& dstBufferVK = LLGL_CAST(VKBuffer&, dstBuffer);
 
     const VkDeviceSize size     = static_cast<VkDeviceSize>(dataSize);
     const VkDeviceSize offset   = static_cast<VkDeviceSize>(dstOffset);
 
-    if (IsInsideRenderPass())
-    {
+    const bool insideRenderPass = IsInsideRenderPass();
+    if (insideRenderPass)
         PauseRenderPass();
+
+    if (size <= g_maxInlineUpdateBufferSize && size % 4 == 0 && offset % 4 == 0)
+    {
+        /* Encode data inline into the command buffer */
         vkCmdUpdateBuffer(commandBuffer_, dstBufferVK.GetVkBuffer(), offset, size, data);
-        BufferPipelineBarrier(dstBufferVK.GetVkBuffer(), offset, size, VK_ACCESS_TRANSFER_WRITE_BIT, dstBufferVK.GetAccessFlags());
-        ResumeRenderPass();
     }
     else
     {
-        vkCmdUpdateBuffer(commandBuffer_, dstBufferVK.GetVkBuffer(), offset, size, data);
-        BufferPipelineBarrier(dstBufferVK.GetVkBuffer(), offset, size, VK_ACCESS_TRANSFER_WRITE_BIT, dstBufferVK.GetAccessFlags());
+        /* Copy data into the staging arena of this command buffer and encode a single copy command */
+        const VKUniformAllocation allocation = stagingBufferPool_->Allocate(data, size);
+
+        VkBufferCopy region;
+        {
+            region.srcOffset    = allocation.offset;
+            region.dstOffset    = offset;
+            region.size         = size;
+        }
+        vkCmdCopyBuffer(commandBuffer_, allocation.buffer, dstBufferVK.GetVkBuffer(), 1, &region);
     }
+
+    BufferPipelineBarrier(dstBufferVK.GetVkBuffer(), offset, size, VK_ACCESS_TRANSFER_WRITE_BIT, dstBufferVK.GetAccessFlags());
+
+    if (insideRenderPass)
+        ResumeRenderPass();
 }
 
 void VKCommandBuffer::CopyBuffer(
@@ -223,6 +350,8 @@ void VKCommandBuffer::CopyBuffer(
     std::uint64_t   srcOffset,
     std::uint64_t   size)
 {
+    FlushPendingRenderPass();
+
     auto& dstBufferVK = LLGL_CAST(VKBuffer&, dstBuffer);
     auto& srcBufferVK = LLGL_CAST(VKBuffer&, srcBuffer);
 
@@ -243,6 +372,40 @@ void VKCommandBuffer::CopyBuffer(
         vkCmdCopyBuffer(commandBuffer_, srcBufferVK.GetVkBuffer(), dstBufferVK.GetVkBuffer(), 1, &region);
 }
 
+void VKCommandBuffer::CopyBuffer(
+    Buffer&                                 dstBuffer,
+    Buffer&                                 srcBuffer,
+    const ArrayView<BufferCopyRegion>&      regions)
+{
+    if (regions.empty())
+        return;
+
+    FlushPendingRenderPass();
+
+    auto& dstBufferVK = LLGL_CAST(VKBuffer&, dstBuffer);
+    auto& srcBufferVK = LLGL_CAST(VKBuffer&, srcBuffer);
+
+    SmallVector<VkBufferCopy> regionsVK;
+    regionsVK.resize(regions.size());
+    for_range(i, regions.size())
+    {
+        regionsVK[i].srcOffset  = static_cast<VkDeviceSize>(regions[i].srcOffset);
+        regionsVK[i].dstOffset  = static_cast<VkDeviceSize>(regions[i].dstOffset);
+        regionsVK[i].size       = static_cast<VkDeviceSize>(regions[i].size);
+    }
+
+    const std::uint32_t numRegions = static_cast<std::uint32_t>(regionsVK.size());
+
+    if (IsInsideRenderPass())
+    {
+        PauseRenderPass();
+        vkCmdCopyBuffer(commandBuffer_, srcBufferVK.GetVkBuffer(), dstBufferVK.GetVkBuffer(), numRegions, regionsVK.data());
+        ResumeRenderPass();
+    }
+    else
+        vkCmdCopyBuffer(commandBuffer_, srcBufferVK.GetVkBuffer(), dstBufferVK.GetVkBuffer(), numRegions, regionsVK.data());
+}
+
 void VKCommandBuffer::CopyBufferFromTexture(
     Buffer&                 dstBuffer,
     std::uint64_t           dstOffset,
@@ -251,6 +414,8 @@ void VKCommandBuffer::CopyBufferFromTexture(
     std::uint32_t           rowStride,
     std::uint32_t           layerStride)
 {
+    FlushPendingRenderPass();
+
     auto& dstBufferVK = LLGL_CAST(VKBuffer&, dstBuffer);
     auto& srcTextureVK = LLGL_CAST(VKTexture&, srcTexture);
 
@@ -289,6 +454,8 @@ void VKCommandBuffer::FillBuffer(
     std::uint32_t   value,
     std::uint64_t   fillSize)
 {
+    FlushPendingRenderPass();
+
     auto& dstBufferVK = LLGL_CAST(VKBuffer&, dstBuffer);
 
     /* Determine destination buffer range and ignore <dstOffset> if the whole buffer is meant to be filled */
@@ -322,6 +489,8 @@ void VKCommandBuffer::CopyTexture(
     const TextureLocation&  srcLocation,
     const Extent3D&         extent)
 {
+    FlushPendingRenderPass();
+
     auto& dstTextureVK = LLGL_CAST(VKTexture&, dstTexture);
     auto& srcTextureVK = LLGL_CAST(VKTexture&, srcTexture);
 
@@ -350,6 +519,55 @@ void VKCommandBuffer::CopyTexture(
         context_.CopyTexture(srcTextureVK, dstTextureVK, region);
 }
 
+void VKCommandBuffer::CopyTexture(
+    Texture&                                dstTexture,
+    Texture&                                srcTexture,
+    const ArrayView<TextureCopyRegion>&     regions)
+{
+    if (regions.empty())
+        return;
+
+    FlushPendingRenderPass();
+
+    auto& dstTextureVK = LLGL_CAST(VKTexture&, dstTexture);
+    auto& srcTextureVK = LLGL_CAST(VKTexture&, srcTexture);
+
+    const VkImageAspectFlags srcAspectMask = VKImageUtils::GetInclusiveVkImageAspect(srcTextureVK.GetVkFormat());
+    const VkImageAspectFlags dstAspectMask = VKImageUtils::GetInclusiveVkImageAspect(dstTextureVK.GetVkFormat());
+
+    SmallVector<VkImageCopy> regionsVK;
+    regionsVK.resize(regions.size());
+    for_range(i, regions.size())
+    {
+        const TextureCopyRegion& region = regions[i];
+        VkImageCopy& regionVK = regionsVK[i];
+        {
+            regionVK.srcSubresource.aspectMask      = srcAspectMask;
+            regionVK.srcSubresource.mipLevel        = region.srcLocation.mipLevel;
+            regionVK.srcSubresource.baseArrayLayer  = region.srcLocation.arrayLayer;
+            regionVK.srcSubresource.layerCount      = 1;
+            regionVK.srcOffset                      = VKTypes::ToVkOffset(region.srcLocation.offset);
+            regionVK.dstSubresource.aspectMask      = dstAspectMask;
+            regionVK.dstSubresource.mipLevel        = region.dstLocation.mipLevel;
+            regionVK.dstSubresource.baseArrayLayer  = region.dstLocation.arrayLayer;
+            regionVK.dstSubresource.layerCount      = 1;
+            regionVK.dstOffset                      = VKTypes::ToVkOffset(region.dstLocation.offset);
+            regionVK.extent                         = VKTypes::ToVkExtent(region.extent);
+        }
+    }
+
+    const std::uint32_t numRegions = static_cast<std::uint32_t>(regionsVK.size());
+
+    if (IsInsideRenderPass())
+    {
+        PauseRenderPass();
+        context_.CopyTexture(srcTextureVK, dstTextureVK, numRegions, regionsVK.data());
+        ResumeRenderPass();
+    }
+    else
+        context_.CopyTexture(srcTextureVK, dstTextureVK, numRegions, regionsVK.data());
+}
+
 void VKCommandBuffer::CopyTextureFromBuffer(
     Texture&                dstTexture,
     const TextureRegion&    dstRegion,
@@ -358,6 +576,8 @@ void VKCommandBuffer::CopyTextureFromBuffer(
     std::uint32_t           rowStride,
     std::uint32_t           layerStride)
 {
+    FlushPendingRenderPass();
+
     auto& dstTextureVK = LLGL_CAST(VKTexture&, dstTexture);
     auto& srcBufferVK = LLGL_CAST(VKBuffer&, srcBuffer);
 
@@ -390,11 +610,65 @@ void VKCommandBuffer::CopyTextureFromBuffer(
     dstTextureVK.TransitionImageLayout(context_, oldLayout, true);
 }
 
+void VKCommandBuffer::CopyTextureFromBuffer(
+    Texture&                                    dstTexture,
+    Buffer&                                     srcBuffer,
+    const ArrayView<BufferTextureCopyRegion>&   regions)
+{
+    if (regions.empty())
+        return;
+
+    FlushPendingRenderPass();
+
+    auto& dstTextureVK = LLGL_CAST(VKTexture&, dstTexture);
+    auto& srcBufferVK = LLGL_CAST(VKBuffer&, srcBuffer);
+
+    const VkImageAspectFlags aspectMask = VKImageUtils::GetInclusiveVkImageAspect(dstTextureVK.GetVkFormat());
+
+    SmallVector<VkBufferImageCopy> regionsVK;
+    regionsVK.resize(regions.size());
+    for_range(i, regions.size())
+    {
+        const TextureRegion& dstRegion = regions[i].textureRegion;
+        VkBufferImageCopy& regionVK = regionsVK[i];
+        {
+            regionVK.bufferOffset                       = regions[i].bufferOffset;
+            regionVK.bufferRowLength                    = regions[i].rowStride;
+            regionVK.bufferImageHeight                  = regions[i].layerStride;
+            regionVK.imageSubresource.aspectMask        = aspectMask;
+            regionVK.imageSubresource.mipLevel          = dstRegion.subresource.baseMipLevel;
+            regionVK.imageSubresource.baseArrayLayer    = dstRegion.subresource.baseArrayLayer;
+            regionVK.imageSubresource.layerCount        = dstRegion.subresource.numArrayLayers;
+            regionVK.imageOffset                        = VKTypes::ToVkOffset(dstRegion.offset);
+            regionVK.imageExtent                        = VKTypes::ToVkExtent(dstRegion.extent);
+        }
+    }
+
+    const std::uint32_t numRegions = static_cast<std::uint32_t>(regionsVK.size());
+
+    /* Issue barriers only once for all regions */
+    context_.BufferMemoryBarrier(srcBufferVK.GetVkBuffer(), 0, VK_WHOLE_SIZE, VK_ACCESS_TRANSFER_READ_BIT, true);
+    VkImageLayout oldLayout = dstTextureVK.TransitionImageLayout(context_, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, true);
+
+    if (IsInsideRenderPass())
+    {
+        PauseRenderPass();
+        context_.CopyBufferToImage(srcBufferVK, dstTextureVK, numRegions, regionsVK.data());
+        ResumeRenderPass();
+    }
+    else
+        context_.CopyBufferToImage(srcBufferVK, dstTextureVK, numRegions, regionsVK.data());
+
+    dstTextureVK.TransitionImageLayout(context_, oldLayout, true);
+}
+
 void VKCommandBuffer::CopyTextureFromFramebuffer(
     Texture&                dstTexture,
     const TextureRegion&    dstRegion,
     const Offset2D&         srcOffset)
 {
+    FlushPendingRenderPass();
+
     if (boundSwapChain_ == nullptr)
         return /*No bound framebuffer*/;
 
@@ -436,8 +710,62 @@ void VKCommandBuffer::CopyTextureFromFramebuffer(
     }
 }
 
+// Returns the exclusive end offset of the specified texture region.
+static VkOffset3D GetVkOffsetEnd(const TextureRegion& region)
+{
+    return VkOffset3D
+    {
+        region.offset.x + static_cast<std::int32_t>(region.extent.width),
+        region.offset.y + static_cast<std::int32_t>(region.extent.height),
+        1
+    };
+}
+
+void VKCommandBuffer::BlitTexture(
+    Texture&                dstTexture,
+    const TextureRegion&    dstRegion,
+    Texture&                srcTexture,
+    const TextureRegion&    srcRegion,
+    const SamplerFilter     filter)
+{
+    FlushPendingRenderPass();
+
+    auto& dstTextureVK = LLGL_CAST(VKTexture&, dstTexture);
+    auto& srcTextureVK = LLGL_CAST(VKTexture&, srcTexture);
+
+    VkImageBlit region;
+    {
+        region.srcSubresource.aspectMask        = VK_IMAGE_ASPECT_COLOR_BIT;
+        region.srcSubresource.mipLevel          = srcRegion.subresource.baseMipLevel;
+        region.srcSubresource.baseArrayLayer    = srcRegion.subresource.baseArrayLayer;
+        region.srcSubresource.layerCount        = 1;
+        region.srcOffsets[0]                    = VkOffset3D{ srcRegion.offset.x, srcRegion.offset.y, 0 };
+        region.srcOffsets[1]                    = GetVkOffsetEnd(srcRegion);
+        region.dstSubresource.aspectMask        = VK_IMAGE_ASPECT_COLOR_BIT;
+        region.dstSubresource.mipLevel          = dstRegion.subresource.baseMipLevel;
+        region.dstSubresource.baseArrayLayer    = dstRegion.subresource.baseArrayLayer;
+        region.dstSubresource.layerCount        = 1;
+        region.dstOffsets[0]                    = VkOffset3D{ dstRegion.offset.x, dstRegion.offset.y, 0 };
+        region.dstOffsets[1]                    = GetVkOffsetEnd(dstRegion);
+    }
+
+    /* Transition blitted subresources into transfer layouts and restore their previous layouts afterwards */
+    const TextureSubresource srcSubresource{ srcRegion.subresource.baseArrayLayer, 1, srcRegion.subresource.baseMipLevel, 1 };
+    const TextureSubresource dstSubresource{ dstRegion.subresource.baseArrayLayer, 1, dstRegion.subresource.baseMipLevel, 1 };
+
+    VkImageLayout oldSrcLayout = srcTextureVK.TransitionImageLayout(context_, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, srcSubresource);
+    VkImageLayout oldDstLayout = dstTextureVK.TransitionImageLayout(context_, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, dstSubresource, true);
+
+    context_.BlitTexture(srcTextureVK, dstTextureVK, region, (filter == SamplerFilter::Linear ? VK_FILTER_LINEAR : VK_FILTER_NEAREST));
+
+    srcTextureVK.TransitionImageLayout(context_, oldSrcLayout, srcSubresource);
+    dstTextureVK.TransitionImageLayout(context_, oldDstLayout, dstSubresource, true);
+}
+
 void VKCommandBuffer::GenerateMips(Texture& texture)
 {
+    FlushPendingRenderPass();
+
     auto& textureVK = LLGL_CAST(VKTexture&, texture);
     context_.GenerateMips(
         textureVK.GetVkImage(),
@@ -449,6 +777,8 @@ void VKCommandBuffer::GenerateMips(Texture& texture)
 
 void VKCommandBuffer::GenerateMips(Texture& texture, const TextureSubresource& subresource)
 {
+    FlushPendingRenderPass();
+
     auto& textureVK = LLGL_CAST(VKTexture&, texture);
 
     const std::uint32_t maxNumMipLevels     = textureVK.GetNumMipLevels();
@@ -470,6 +800,8 @@ void VKCommandBuffer::GenerateMips(Texture& texture, const TextureSubresource& s
 
 void VKCommandBuffer::SetViewport(const Viewport& viewport)
 {
+    EnsureInlineRenderPassContents();
+
     /* Convert viewport to VkViewport type */
     VkViewport viewportVK;
     VKTypes::Convert(viewportVK, viewport);
@@ -478,6 +810,8 @@ void VKCommandBuffer::SetViewport(const Viewport& viewport)
 
 void VKCommandBuffer::SetViewports(std::uint32_t numViewports, const Viewport* viewports)
 {
+    EnsureInlineRenderPassContents();
+
     VkViewport viewportsVK[LLGL_MAX_NUM_VIEWPORTS_AND_SCISSORS];
 
     /* Convert viewport to VkViewport types */
@@ -490,6 +824,8 @@ void VKCommandBuffer::SetViewports(std::uint32_t numViewports, const Viewport* v
 
 void VKCommandBuffer::SetScissor(const Scissor& scissor)
 {
+    EnsureInlineRenderPassContents();
+
     if (scissorEnabled_)
     {
         /* Convert scissor to VkRect2D type */
@@ -501,6 +837,8 @@ void VKCommandBuffer::SetScissor(const Scissor& scissor)
 
 void VKCommandBuffer::SetScissors(std::uint32_t numScissors, const Scissor* scissors)
 {
+    EnsureInlineRenderPassContents();
+
     if (scissorEnabled_)
     {
         /* Convert scissor to VkRect2D types */
@@ -516,36 +854,69 @@ void VKCommandBuffer::SetScissors(std::uint32_t numScissors, const Scissor* scis
 
 /* ----- Input Assembly ------ */
 
-void VKCommandBuffer::SetVertexBuffer(Buffer& buffer)
+void VKCommandBuffer::SetVertexBuffer(Buffer& buffer, std::uint64_t offset)
 {
+    EnsureInlineRenderPassContents();
+
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
 
     VkBuffer buffers[] = { bufferVK.GetVkBuffer() };
-    VkDeviceSize offsets[] = { 0 };
+    VkDeviceSize offsets[] = { offset };
 
     vkCmdBindVertexBuffers(commandBuffer_, 0, 1, buffers, offsets);
 }
 
 void VKCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
 {
+    EnsureInlineRenderPassContents();
+
     auto& bufferArrayVK = LLGL_CAST(VKBufferArray&, bufferArray);
+    const auto& buffers = bufferArrayVK.GetBuffers();
     vkCmdBindVertexBuffers(
         commandBuffer_,
         0,
-        static_cast<std::uint32_t>(bufferArrayVK.GetBuffers().size()),
-        bufferArrayVK.GetBuffers().data(),
+        static_cast<std::uint32_t>(buffers.size()),
+        buffers.data(),
         bufferArrayVK.GetOffsets().data()
     );
 }
 
+void VKCommandBuffer::SetVertexBuffers(std::uint32_t firstSlot, std::uint32_t numBuffers, Buffer* const * buffers, const std::uint64_t* offsets)
+{
+    EnsureInlineRenderPassContents();
+
+    SmallVector<VkBuffer> buffersVK;
+    buffersVK.resize(numBuffers);
+    for_range(i, numBuffers)
+        buffersVK[i] = LLGL_CAST(VKBuffer*, buffers[i])->GetVkBuffer();
+
+    /* VkDeviceSize has the same representation as std::uint64_t, so explicit offsets can be passed on directly */
+    static_assert(sizeof(VkDeviceSize) == sizeof(std::uint64_t), "VkDeviceSize must have the same size as std::uint64_t");
+    SmallVector<VkDeviceSize> zeroOffsets;
+    if (offsets == nullptr)
+        zeroOffsets.resize(numBuffers, 0);
+
+    vkCmdBindVertexBuffers(
+        commandBuffer_,
+        firstSlot,
+        numBuffers,
+        buffersVK.data(),
+        (offsets != nullptr ? reinterpret_cast<const VkDeviceSize*>(offsets) : zeroOffsets.data())
+    );
+}
+
 void VKCommandBuffer::SetIndexBuffer(Buffer& buffer)
 {
+    EnsureInlineRenderPassContents();
+
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
     vkCmdBindIndexBuffer(commandBuffer_, bufferVK.GetVkBuffer(), 0, bufferVK.GetIndexType());
 }
 
 void VKCommandBuffer::SetIndexBuffer(Buffer& buffer, const Format format, std::uint64_t offset)
 {
+    EnsureInlineRenderPassContents();
+
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
     vkCmdBindIndexBuffer(commandBuffer_, bufferVK.GetVkBuffer(), offset, VKTypes::ToVkIndexType(format));
 }
@@ -554,6 +925,8 @@ void VKCommandBuffer::SetIndexBuffer(Buffer& buffer, const Format format, std::u
 
 void VKCommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap, std::uint32_t descriptorSet)
 {
+    EnsureInlineRenderPassContents();
+
     if (boundPipelineState_ == nullptr)
         return /*No PSO bound*/;
 
@@ -563,15 +936,54 @@ void VKCommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap, std::uint32_t
         return /*Descriptor set out of bounds*/;
 
     boundPipelineState_->BindHeapDescriptorSet(commandBuffer_, resourceHeapVK.GetVkDescriptorSets()[descriptorSet]);
-    resourceHeapVK.SubmitPipelineBarrier(commandBuffer_, descriptorSet);
+    if (!explicitBarriers_)
+    {
+        if (VKPipelineBarrier* barrier = resourceHeapVK.GetPipelineBarrier(descriptorSet))
+            SubmitStorageBarrier(*barrier);
+    }
 }
 
 void VKCommandBuffer::SetResource(std::uint32_t descriptor, Resource& resource)
 {
     if (boundPipelineLayout_ != nullptr && descriptor < boundPipelineLayout_->GetLayoutDynamicBindings().size())
     {
-        const VKLayoutBinding& binding = boundPipelineLayout_->GetLayoutDynamicBindings()[descriptor];
-        descriptorCache_->EmplaceDescriptor(resource, binding, descriptorSetWriter_);
+        if (boundPipelineLayout_->UsesPushDescriptors())
+            pushDescriptorWriter_.WriteDescriptor(descriptor, resource);
+        else
+        {
+            const VKLayoutBinding& binding = boundPipelineLayout_->GetLayoutDynamicBindings()[descriptor];
+            descriptorCache_->EmplaceDescriptor(resource, binding, descriptorSetWriter_);
+        }
+    }
+}
+
+void VKCommandBuffer::SetResources(std::uint32_t firstDescriptor, const ArrayView<Resource*>& resources)
+{
+    if (boundPipelineLayout_ == nullptr)
+        return;
+
+    const std::uint32_t numBindings = static_cast<std::uint32_t>(boundPipelineLayout_->GetLayoutDynamicBindings().size());
+    if (!(firstDescriptor < numBindings))
+        return;
+
+    const std::uint32_t numDescriptors = std::min<std::uint32_t>(static_cast<std::uint32_t>(resources.size()), numBindings - firstDescriptor);
+
+    if (boundPipelineLayout_->UsesPushDescriptors())
+    {
+        for_range(i, numDescriptors)
+        {
+            if (Resource* resource = resources[i])
+                pushDescriptorWriter_.WriteDescriptor(firstDescriptor + i, *resource);
+        }
+    }
+    else
+    {
+        descriptorCache_->EmplaceDescriptors(
+            numDescriptors,
+            resources.data(),
+            &(boundPipelineLayout_->GetLayoutDynamicBindings()[firstDescriptor]),
+            descriptorSetWriter_
+        );
     }
 }
 
@@ -585,6 +997,179 @@ void VKCommandBuffer::ResetResourceSlots(
     // dummy
 }
 
+// Returns the access flags for the specified barrier usage (see BindFlags).
+static VkAccessFlags GetBarrierVkAccessFlags(long usage)
+{
+    VkAccessFlags accessFlags = 0;
+
+    if ((usage & BindFlags::VertexBuffer) != 0)
+        accessFlags |= VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT;
+    if ((usage & BindFlags::IndexBuffer) != 0)
+        accessFlags |= VK_ACCESS_INDEX_READ_BIT;
+    if ((usage & BindFlags::ConstantBuffer) != 0)
+        accessFlags |= VK_ACCESS_UNIFORM_READ_BIT;
+    if ((usage & BindFlags::StreamOutputBuffer) != 0)
+        accessFlags |= VK_ACCESS_TRANSFORM_FEEDBACK_WRITE_BIT_EXT;
+    if ((usage & BindFlags::IndirectBuffer) != 0)
+        accessFlags |= VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+    if ((usage & BindFlags::Sampled) != 0)
+        accessFlags |= VK_ACCESS_SHADER_READ_BIT;
+    if ((usage & BindFlags::Storage) != 0)
+        accessFlags |= (VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT);
+    if ((usage & BindFlags::ColorAttachment) != 0)
+        accessFlags |= (VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT);
+    if ((usage & BindFlags::DepthStencilAttachment) != 0)
+        accessFlags |= (VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT);
+    if ((usage & BindFlags::CopySrc) != 0)
+        accessFlags |= VK_ACCESS_TRANSFER_READ_BIT;
+    if ((usage & BindFlags::CopyDst) != 0)
+        accessFlags |= VK_ACCESS_TRANSFER_WRITE_BIT;
+
+    return accessFlags;
+}
+
+// Returns the pipeline stages for the specified barrier usage (see BindFlags) and shader stages (see StageFlags).
+static VkPipelineStageFlags GetBarrierVkStageFlags(long usage, long stageFlags)
+{
+    VkPipelineStageFlags stageMask = 0;
+
+    if ((usage & (BindFlags::VertexBuffer | BindFlags::IndexBuffer)) != 0)
+        stageMask |= VK_PIPELINE_STAGE_VERTEX_INPUT_BIT;
+    if ((usage & BindFlags::StreamOutputBuffer) != 0)
+        stageMask |= VK_PIPELINE_STAGE_TRANSFORM_FEEDBACK_BIT_EXT;
+    if ((usage & BindFlags::IndirectBuffer) != 0)
+        stageMask |= VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT;
+    if ((usage & BindFlags::ColorAttachment) != 0)
+        stageMask |= VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    if ((usage & BindFlags::DepthStencilAttachment) != 0)
+        stageMask |= (VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT);
+    if ((usage & (BindFlags::CopySrc | BindFlags::CopyDst)) != 0)
+        stageMask |= VK_PIPELINE_STAGE_TRANSFER_BIT;
+
+    if ((usage & (BindFlags::ConstantBuffer | BindFlags::Sampled | BindFlags::Storage)) != 0)
+    {
+        if ((stageFlags & StageFlags::VertexStage) != 0)
+            stageMask |= VK_PIPELINE_STAGE_VERTEX_SHADER_BIT;
+        if ((stageFlags & StageFlags::TessControlStage) != 0)
+            stageMask |= VK_PIPELINE_STAGE_TESSELLATION_CONTROL_SHADER_BIT;
+        if ((stageFlags & StageFlags::TessEvaluationStage) != 0)
+            stageMask |= VK_PIPELINE_STAGE_TESSELLATION_EVALUATION_SHADER_BIT;
+        if ((stageFlags & StageFlags::GeometryStage) != 0)
+            stageMask |= VK_PIPELINE_STAGE_GEOMETRY_SHADER_BIT;
+        if ((stageFlags & StageFlags::FragmentStage) != 0)
+            stageMask |= VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+        if ((stageFlags & StageFlags::ComputeStage) != 0)
+            stageMask |= VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+        if ((stageFlags & StageFlags::TaskStage) != 0 && HasExtension(VKExt::EXT_mesh_shader))
+            stageMask |= VK_PIPELINE_STAGE_TASK_SHADER_BIT_EXT;
+        if ((stageFlags & StageFlags::MeshStage) != 0 && HasExtension(VKExt::EXT_mesh_shader))
+            stageMask |= VK_PIPELINE_STAGE_MESH_SHADER_BIT_EXT;
+    }
+
+    return (stageMask != 0 ? stageMask : VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+}
+
+void VKCommandBuffer::ResourceBarrier(std::uint32_t numBarriers, const ResourceBarrierDescriptor* barriers)
+{
+    FlushPendingRenderPass();
+
+    if (numBarriers == 0)
+        return;
+
+    VkPipelineStageFlags                    srcStageMask = 0;
+    VkPipelineStageFlags                    dstStageMask = 0;
+    SmallVector<VkMemoryBarrier, 1u>        memoryBarriers;
+    SmallVector<VkBufferMemoryBarrier, 4u>  bufferBarriers;
+    SmallVector<VkImageMemoryBarrier, 4u>   imageBarriers;
+
+    /* Merge all barriers into a single pipeline barrier command */
+    for_range(i, numBarriers)
+    {
+        const ResourceBarrierDescriptor& barrier = barriers[i];
+
+        const VkAccessFlags srcAccessMask = GetBarrierVkAccessFlags(barrier.srcUsage);
+        const VkAccessFlags dstAccessMask = GetBarrierVkAccessFlags(barrier.dstUsage);
+
+        srcStageMask |= GetBarrierVkStageFlags(barrier.srcUsage, barrier.srcStages);
+        dstStageMask |= GetBarrierVkStageFlags(barrier.dstUsage, barrier.dstStages);
+
+        const ResourceType resourceType = (barrier.resource != nullptr ? barrier.resource->GetResourceType() : ResourceType::Undefined);
+        if (resourceType == ResourceType::Buffer)
+        {
+            auto* bufferVK = LLGL_CAST(VKBuffer*, barrier.resource);
+            VkBufferMemoryBarrier bufferBarrier;
+            {
+                bufferBarrier.sType                 = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+                bufferBarrier.pNext                 = nullptr;
+                bufferBarrier.srcAccessMask         = srcAccessMask;
+                bufferBarrier.dstAccessMask         = dstAccessMask;
+                bufferBarrier.srcQueueFamilyIndex   = VK_QUEUE_FAMILY_IGNORED;
+                bufferBarrier.dstQueueFamilyIndex   = VK_QUEUE_FAMILY_IGNORED;
+                bufferBarrier.buffer                = bufferVK->GetVkBuffer();
+                bufferBarrier.offset                = 0;
+                bufferBarrier.size                  = VK_WHOLE_SIZE;
+            }
+            bufferBarriers.push_back(bufferBarrier);
+        }
+        else if (resourceType == ResourceType::Texture)
+        {
+            /* Image layouts are still managed by the backend, so the barrier keeps the current layout */
+            auto* textureVK = LLGL_CAST(VKTexture*, barrier.resource);
+            VkImageMemoryBarrier imageBarrier;
+            {
+                imageBarrier.sType                              = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+                imageBarrier.pNext                              = nullptr;
+                imageBarrier.srcAccessMask                      = srcAccessMask;
+                imageBarrier.dstAccessMask                      = dstAccessMask;
+                imageBarrier.oldLayout                          = textureVK->GetVkImageLayout();
+                imageBarrier.newLayout                          = textureVK->GetVkImageLayout();
+                imageBarrier.srcQueueFamilyIndex                = VK_QUEUE_FAMILY_IGNORED;
+                imageBarrier.dstQueueFamilyIndex                = VK_QUEUE_FAMILY_IGNORED;
+                imageBarrier.image                              = textureVK->GetVkImage();
+                imageBarrier.subresourceRange.aspectMask        = VKImageUtils::GetInclusiveVkImageAspect(textureVK->GetVkFormat());
+                imageBarrier.subresourceRange.baseMipLevel      = 0;
+                imageBarrier.subresourceRange.levelCount        = VK_REMAINING_MIP_LEVELS;
+                imageBarrier.subresourceRange.baseArrayLayer    = 0;
+                imageBarrier.subresourceRange.layerCount        = VK_REMAINING_ARRAY_LAYERS;
+            }
+            imageBarriers.push_back(imageBarrier);
+        }
+        else
+        {
+            /* Merge global barriers into a single memory barrier */
+            if (memoryBarriers.empty())
+            {
+                VkMemoryBarrier memoryBarrier;
+                {
+                    memoryBarrier.sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+                    memoryBarrier.pNext         = nullptr;
+                    memoryBarrier.srcAccessMask = 0;
+                    memoryBarrier.dstAccessMask = 0;
+                }
+                memoryBarriers.push_back(memoryBarrier);
+            }
+            memoryBarriers.front().srcAccessMask |= srcAccessMask;
+            memoryBarriers.front().dstAccessMask |= dstAccessMask;
+        }
+    }
+
+    /* Submit pending barriers of the command context first to preserve their order */
+    context_.FlushBarriers();
+
+    vkCmdPipelineBarrier(
+        commandBuffer_,
+        srcStageMask,
+        dstStageMask,
+        0, // VkDependencyFlags
+        static_cast<std::uint32_t>(memoryBarriers.size()),
+        memoryBarriers.data(),
+        static_cast<std::uint32_t>(bufferBarriers.size()),
+        bufferBarriers.data(),
+        static_cast<std::uint32_t>(imageBarriers.size()),
+        imageBarriers.data()
+    );
+}
+
 /* ----- Render Passes ----- */
 
 void VKCommandBuffer::BeginRenderPass(
@@ -594,6 +1179,21 @@ void VKCommandBuffer::BeginRenderPass(
     const ClearValue*   clearValues,
     std::uint32_t       swapBufferIndex)
 {
+    LLGL_PROFILE_ZONE("BeginRenderPass");
+
+    /* Continue the render pass instance that was kept open by the previous EndRenderPass if it renders into the same attachments */
+    if (IsRenderPassMergeable(renderTarget, renderPass, swapBufferIndex))
+    {
+        recordState_ = RecordState::InsideRenderPass;
+        return;
+    }
+
+    FlushPendingRenderPass();
+
+    /* Store render target and render pass to determine whether this render pass instance can be merged with the next one */
+    mergeableRenderTarget_  = &renderTarget;
+    mergeableRenderPass_    = renderPass;
+
     if (LLGL::IsInstanceOf<SwapChain>(renderTarget))
     {
         /* Get Vulkan swap-chain object */
@@ -606,6 +1206,11 @@ void VKCommandBuffer::BeginRenderPass(
         secondaryRenderPass_            = swapChainVK.GetSecondaryVkRenderPass();
         framebuffer_                    = swapChainVK.GetVkFramebuffer(currentColorBuffer_);
         framebufferRenderArea_.extent   = swapChainVK.GetVkExtent();
+        if (swapChainVK.UsesDynamicRendering())
+        {
+            dynamicRenderingAttachments_    = &(swapChainVK.GetDynamicRenderingAttachments(currentColorBuffer_));
+            dynamicRenderPass_              = &(swapChainVK.GetSwapChainRenderPass());
+        }
         numColorAttachments_            = swapChainVK.GetNumColorAttachments();
         hasDepthStencilAttachment_      = (swapChainVK.HasDepthAttachment() || swapChainVK.HasStencilAttachment());
     }
@@ -619,6 +1224,11 @@ void VKCommandBuffer::BeginRenderPass(
         secondaryRenderPass_            = renderTargetVK.GetSecondaryVkRenderPass();
         framebuffer_                    = renderTargetVK.GetVkFramebuffer();
         framebufferRenderArea_.extent   = renderTargetVK.GetVkExtent();
+        if (renderTargetVK.UsesDynamicRendering())
+        {
+            dynamicRenderingAttachments_    = &(renderTargetVK.GetDynamicRenderingAttachments());
+            dynamicRenderPass_              = LLGL_CAST(const VKRenderPass*, renderTargetVK.GetRenderPass());
+        }
         numColorAttachments_            = renderTargetVK.GetNumColorAttachments();
         hasDepthStencilAttachment_      = (renderTargetVK.HasDepthAttachment() || renderTargetVK.HasStencilAttachment());
     }
@@ -636,6 +1246,16 @@ void VKCommandBuffer::BeginRenderPass(
         auto* renderPassVK = LLGL_CAST(const VKRenderPass*, renderPass);
         renderPass_ = renderPassVK->GetVkRenderPass();
         ConvertRenderPassClearValues(*renderPassVK, numClearValuesVK, clearValuesVK, numClearValues, clearValues);
+        if (dynamicRenderingAttachments_ != nullptr)
+            dynamicRenderPass_ = renderPassVK;
+    }
+
+    if (dynamicRenderingAttachments_ != nullptr)
+    {
+        /* Record begin of dynamic rendering with the attachments of the render target */
+        VKBeginDynamicRendering(commandBuffer_, *dynamicRenderPass_, *dynamicRenderingAttachments_, (renderPass != nullptr ? clearValuesVK : nullptr));
+        recordState_ = RecordState::InsideRenderPass;
+        return;
     }
 
     /* Record begin of render pass */
@@ -657,15 +1277,20 @@ void VKCommandBuffer::BeginRenderPass(
 
 void VKCommandBuffer::EndRenderPass()
 {
-    /* Record and of render pass */
-    vkCmdEndRenderPass(commandBuffer_);
-
-    /* Reset render pass and framebuffer attributes */
-    renderPass_     = VK_NULL_HANDLE;
-    framebuffer_    = VK_NULL_HANDLE;
+    /*
+    Keep the render pass instance open if a subsequent BeginRenderPass with the same render target and render pass could continue it.
+    This avoids storing and reloading all attachments between consecutive render passes, which forces a tile flush on tile-based GPUs.
+    The render pass instance is ended by the next command that must be recorded outside of a render pass (see FlushPendingRenderPass).
+    */
+    if (!secondaryContents_ && IsRenderPassContinuable())
+        recordState_ = RecordState::PendingEndRenderPass;
+    else
+        EndActiveRenderPass();
+}
 
-    /* Store new record state */
-    recordState_ = RecordState::OutsideRenderPass;
+void VKCommandBuffer::NextSubpass()
+{
+    vkCmdNextSubpass(commandBuffer_, (secondaryContents_ ? VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS : VK_SUBPASS_CONTENTS_INLINE));
 }
 
 static void ToVkClearColor(VkClearColorValue& dst, const float (&src)[4])
@@ -690,6 +1315,8 @@ static VkImageAspectFlags GetDepthStencilAspectMask(long flags)
 
 void VKCommandBuffer::Clear(long flags, const ClearValue& clearValue)
 {
+    EnsureInlineRenderPassContents();
+
     VkClearAttachment attachments[LLGL_MAX_NUM_ATTACHMENTS];
 
     std::uint32_t numAttachments = 0;
@@ -730,6 +1357,8 @@ void VKCommandBuffer::Clear(long flags, const ClearValue& clearValue)
 
 void VKCommandBuffer::ClearAttachments(std::uint32_t numAttachments, const AttachmentClear* attachments)
 {
+    EnsureInlineRenderPassContents();
+
     /* Convert clear attachment descriptors */
     VkClearAttachment attachmentsVK[LLGL_MAX_NUM_ATTACHMENTS];
 
@@ -776,8 +1405,10 @@ void VKCommandBuffer::ClearAttachments(std::uint32_t numAttachments, const Attac
 
 void VKCommandBuffer::SetPipelineState(PipelineState& pipelineState)
 {
-    /* Bind native PSO */
-    auto& pipelineStateVK = LLGL_CAST(VKPipelineState&, pipelineState);
+    EnsureInlineRenderPassContents();
+
+    /* Bind native PSO, or its placeholder if it's still being compiled */
+    auto& pipelineStateVK = LLGL_CAST(VKPipelineState&, pipelineState).GetReadyPSO();
     pipelineStateVK.BindPipelineAndStaticDescriptorSet(commandBuffer_);
 
     /* Handle special case for graphics PSOs */
@@ -802,15 +1433,33 @@ void VKCommandBuffer::SetPipelineState(PipelineState& pipelineState)
     boundPipelineState_     = &pipelineStateVK;
     boundPipelineLayout_    = pipelineStateVK.GetPipelineLayout();
 
+    /* Reset CPU copy of the uniform block; The descriptor set must be re-allocated for the set layout of the new PSO */
+    const VKUniformBlockLayout& uniformBlock = pipelineStateVK.GetUniformBlock();
+    uniformBlockData_.assign(uniformBlock.size, 0);
+    uniformBlockInvalidated_    = (uniformBlock.size > 0);
+    uniformBlockDescriptorSet_  = VK_NULL_HANDLE;
+
     /* Reset descriptor cache for dynamic resources */
     if (boundPipelineLayout_ != nullptr)
     {
         descriptorCache_ = boundPipelineLayout_->GetDescriptorCache();
         if (descriptorCache_ != nullptr)
         {
+            /* Apply descriptor writes that were deferred by cached descriptor sets before the writer is reset */
+            VKDescriptorCache::FlushPendingWrites(device_, descriptorSetWriter_);
             descriptorCache_->Reset();
             descriptorSetWriter_.Reset(descriptorCache_->GetNumDescriptors());
         }
+        else if (boundPipelineLayout_->UsesPushDescriptors())
+        {
+            /* Keep push descriptors across PSOs with the same layout, but push them again since the PSO may use a permutation of that layout */
+            if (pushDescriptorLayout_ != boundPipelineLayout_)
+            {
+                pushDescriptorWriter_.Reset(boundPipelineLayout_->GetLayoutDynamicBindings());
+                pushDescriptorLayout_ = boundPipelineLayout_;
+            }
+            pushDescriptorWriter_.Invalidate();
+        }
     }
     else
         descriptorCache_ = nullptr;
@@ -818,26 +1467,107 @@ void VKCommandBuffer::SetPipelineState(PipelineState& pipelineState)
 
 void VKCommandBuffer::SetBlendFactor(const float color[4])
 {
+    EnsureInlineRenderPassContents();
+
     vkCmdSetBlendConstants(commandBuffer_, color);
 }
 
 void VKCommandBuffer::SetStencilReference(std::uint32_t reference, const StencilFace stencilFace)
 {
+    EnsureInlineRenderPassContents();
+
     vkCmdSetStencilReference(commandBuffer_, VKTypes::Map(stencilFace), reference);
 }
 
+void VKCommandBuffer::SetShadingRate(const ShadingRate rate)
+{
+    if (HasExtension(VKExt::KHR_fragment_shading_rate))
+    {
+        EnsureInlineRenderPassContents();
+        SetVkFragmentShadingRate(VKTypes::ToVkFragmentSize(rate));
+    }
+}
+
+void VKCommandBuffer::SetCullMode(const CullMode cullMode)
+{
+    if (HasExtension(VKExt::EXT_extended_dynamic_state))
+    {
+        EnsureInlineRenderPassContents();
+        vkCmdSetCullModeEXT(commandBuffer_, VKTypes::Map(cullMode));
+    }
+}
+
+void VKCommandBuffer::SetDepthState(const DepthDescriptor& depthDesc)
+{
+    if (HasExtension(VKExt::EXT_extended_dynamic_state))
+    {
+        EnsureInlineRenderPassContents();
+        vkCmdSetDepthTestEnableEXT(commandBuffer_, VKBoolean(depthDesc.testEnabled));
+        vkCmdSetDepthWriteEnableEXT(commandBuffer_, VKBoolean(depthDesc.writeEnabled));
+        vkCmdSetDepthCompareOpEXT(commandBuffer_, VKTypes::Map(depthDesc.compareOp));
+    }
+}
+
+static void SetVkStencilFaceState(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, const StencilFaceDescriptor& desc)
+{
+    vkCmdSetStencilOpEXT(
+        commandBuffer,
+        faceMask,
+        VKTypes::Map(desc.stencilFailOp),
+        VKTypes::Map(desc.depthPassOp),
+        VKTypes::Map(desc.depthFailOp),
+        VKTypes::Map(desc.compareOp)
+    );
+    vkCmdSetStencilCompareMask(commandBuffer, faceMask, desc.readMask);
+    vkCmdSetStencilWriteMask(commandBuffer, faceMask, desc.writeMask);
+}
+
+void VKCommandBuffer::SetStencilState(const StencilDescriptor& stencilDesc)
+{
+    if (HasExtension(VKExt::EXT_extended_dynamic_state))
+    {
+        EnsureInlineRenderPassContents();
+        vkCmdSetStencilTestEnableEXT(commandBuffer_, VKBoolean(stencilDesc.testEnabled));
+        SetVkStencilFaceState(commandBuffer_, VK_STENCIL_FACE_FRONT_BIT, stencilDesc.front);
+        SetVkStencilFaceState(commandBuffer_, VK_STENCIL_FACE_BACK_BIT, stencilDesc.back);
+    }
+}
+
+void VKCommandBuffer::SetPrimitiveTopology(const PrimitiveTopology topology)
+{
+    if (HasExtension(VKExt::EXT_extended_dynamic_state))
+    {
+        EnsureInlineRenderPassContents();
+        vkCmdSetPrimitiveTopologyEXT(commandBuffer_, VKTypes::Map(topology));
+    }
+}
+
 void VKCommandBuffer::SetUniforms(std::uint32_t first, const void* data, std::uint16_t dataSize)
 {
+    EnsureInlineRenderPassContents();
+
     if (boundPipelineState_ != nullptr)
-        boundPipelineState_->PushConstants(commandBuffer_, first, reinterpret_cast<const char*>(data), dataSize);
+    {
+        /* Uniforms in a uniform block are only copied here and uploaded with the next draw or dispatch command */
+        char* uniformBlockData = (uniformBlockData_.empty() ? nullptr : uniformBlockData_.data());
+        if (boundPipelineState_->PushConstants(commandBuffer_, first, reinterpret_cast<const char*>(data), dataSize, uniformBlockData))
+            uniformBlockInvalidated_ = true;
+    }
 }
 
 /* ----- Queries ----- */
 
 void VKCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t query)
 {
+    FlushPendingRenderPass();
+    EnsureInlineRenderPassContents();
+
     auto& queryHeapVK = LLGL_CAST(VKQueryHeap&, queryHeap);
 
+    /* Timestamps are only written by EndQuery() */
+    if (queryHeapVK.GetType() == QueryType::Timestamp)
+        return;
+
     query *= queryHeapVK.GetGroupSize();
 
     if (queryHeapVK.GetType() == QueryType::TimeElapsed)
@@ -861,6 +1591,9 @@ void VKCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t query)
 
 void VKCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query)
 {
+    FlushPendingRenderPass();
+    EnsureInlineRenderPassContents();
+
     auto& queryHeapVK = LLGL_CAST(VKQueryHeap&, queryHeap);
 
     query *= queryHeapVK.GetGroupSize();
@@ -870,19 +1603,24 @@ void VKCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query)
         /* Record second timestamp */
         vkCmdWriteTimestamp(commandBuffer_, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, queryHeapVK.GetVkQueryPool(), query + 1);
     }
+    else if (queryHeapVK.GetType() == QueryType::Timestamp)
+    {
+        /* Record timestamp once all previous commands have been completed */
+        vkCmdWriteTimestamp(commandBuffer_, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, queryHeapVK.GetVkQueryPool(), query);
+    }
     else
     {
         /* End query section */
         vkCmdEndQuery(commandBuffer_, queryHeapVK.GetVkQueryPool(), query);
     }
 
-    #if 0//TEST
-    AppendQueryPoolInFlight(&queryHeapVK);
-    #endif
+    TrackQueryHeap(queryHeapVK);
 }
 
 void VKCommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t query, const RenderConditionMode mode)
 {
+    FlushPendingRenderPass();
+
     LLGL_ASSERT_VK_EXT(EXT_conditional_rendering);
 
     auto& queryHeapVK = LLGL_CAST(VKPredicateQueryHeap&, queryHeap);
@@ -912,8 +1650,30 @@ void VKCommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t q
     vkCmdBeginConditionalRenderingEXT(commandBuffer_, &beginInfo);
 }
 
+void VKCommandBuffer::BeginRenderCondition(Buffer& buffer, std::uint64_t offset, const RenderConditionMode mode)
+{
+    FlushPendingRenderPass();
+
+    LLGL_ASSERT_VK_EXT(EXT_conditional_rendering);
+
+    auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+
+    /* Begin conditional rendering block with the lower 32 bits of the predicate value */
+    VkConditionalRenderingBeginInfoEXT beginInfo;
+    {
+        beginInfo.sType     = VK_STRUCTURE_TYPE_CONDITIONAL_RENDERING_BEGIN_INFO_EXT;
+        beginInfo.pNext     = nullptr;
+        beginInfo.buffer    = bufferVK.GetVkBuffer();
+        beginInfo.offset    = offset;
+        beginInfo.flags     = (mode >= RenderConditionMode::WaitInverted ? VK_CONDITIONAL_RENDERING_INVERTED_BIT_EXT : 0);
+    }
+    vkCmdBeginConditionalRenderingEXT(commandBuffer_, &beginInfo);
+}
+
 void VKCommandBuffer::EndRenderCondition()
 {
+    FlushPendingRenderPass();
+
     /* Ensure "VK_EXT_conditional_rendering" is supported */
     LLGL_ASSERT_VK_EXT(EXT_conditional_rendering);
 
@@ -921,6 +1681,46 @@ void VKCommandBuffer::EndRenderCondition()
     vkCmdEndConditionalRenderingEXT(commandBuffer_);
 }
 
+void VKCommandBuffer::ResolveQueries(
+    QueryHeap&      queryHeap,
+    std::uint32_t   firstQuery,
+    std::uint32_t   numQueries,
+    Buffer&         dstBuffer,
+    std::uint64_t   dstOffset)
+{
+    FlushPendingRenderPass();
+
+    auto& queryHeapVK = LLGL_CAST(VKQueryHeap&, queryHeap);
+    auto& dstBufferVK = LLGL_CAST(VKBuffer&, dstBuffer);
+
+    /* Pipeline statistics are written as a contiguous set of 64-bit values per query, matching the layout of QueryPipelineStatistics */
+    const VkDeviceSize stride = (queryHeapVK.GetType() == QueryType::PipelineStatistics ? sizeof(QueryPipelineStatistics) : sizeof(std::uint64_t));
+
+    auto CopyQueryPoolResults = [&]()
+    {
+        vkCmdCopyQueryPoolResults(
+            commandBuffer_,
+            queryHeapVK.GetVkQueryPool(),
+            firstQuery * queryHeapVK.GetGroupSize(),
+            numQueries * queryHeapVK.GetGroupSize(),
+            dstBufferVK.GetVkBuffer(),
+            static_cast<VkDeviceSize>(dstOffset),
+            stride,
+            (VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT)
+        );
+    };
+
+    /* Query pool results cannot be copied inside a render pass */
+    if (IsInsideRenderPass())
+    {
+        PauseRenderPass();
+        CopyQueryPoolResults();
+        ResumeRenderPass();
+    }
+    else
+        CopyQueryPoolResults();
+}
+
 /* ----- Stream Output ------ */
 
 #if 0
@@ -1027,6 +1827,31 @@ void VKCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::ui
         vkCmdDrawIndirect(commandBuffer_, bufferVK.GetVkBuffer(), offset, numCommands, stride);
 }
 
+void VKCommandBuffer::DrawIndirect(
+    Buffer&         buffer,
+    std::uint64_t   offset,
+    Buffer&         countBuffer,
+    std::uint64_t   countBufferOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    if (HasExtension(VKExt::KHR_draw_indirect_count))
+    {
+        FlushDescriptorCache();
+        auto& bufferVK      = LLGL_CAST(VKBuffer&, buffer);
+        auto& countBufferVK = LLGL_CAST(VKBuffer&, countBuffer);
+        vkCmdDrawIndirectCountKHR(
+            commandBuffer_,
+            bufferVK.GetVkBuffer(),
+            offset,
+            countBufferVK.GetVkBuffer(),
+            countBufferOffset,
+            std::min(maxNumCommands, maxDrawIndirectCount_),
+            stride
+        );
+    }
+}
+
 void VKCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
 {
     FlushDescriptorCache();
@@ -1053,25 +1878,174 @@ void VKCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset,
         vkCmdDrawIndexedIndirect(commandBuffer_, bufferVK.GetVkBuffer(), offset, numCommands, stride);
 }
 
+void VKCommandBuffer::DrawIndexedIndirect(
+    Buffer&         buffer,
+    std::uint64_t   offset,
+    Buffer&         countBuffer,
+    std::uint64_t   countBufferOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    if (HasExtension(VKExt::KHR_draw_indirect_count))
+    {
+        FlushDescriptorCache();
+        auto& bufferVK      = LLGL_CAST(VKBuffer&, buffer);
+        auto& countBufferVK = LLGL_CAST(VKBuffer&, countBuffer);
+        vkCmdDrawIndexedIndirectCountKHR(
+            commandBuffer_,
+            bufferVK.GetVkBuffer(),
+            offset,
+            countBufferVK.GetVkBuffer(),
+            countBufferOffset,
+            std::min(maxNumCommands, maxDrawIndirectCount_),
+            stride
+        );
+    }
+}
+
+void VKCommandBuffer::DrawStreamOutput()
+{
+    // not supported by this backend
+}
+
+void VKCommandBuffer::DrawMesh(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
+{
+    if (HasExtension(VKExt::EXT_mesh_shader))
+    {
+        FlushDescriptorCache();
+        vkCmdDrawMeshTasksEXT(commandBuffer_, numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
+    }
+}
+
+void VKCommandBuffer::DrawMeshIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    if (HasExtension(VKExt::EXT_mesh_shader))
+    {
+        FlushDescriptorCache();
+        auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+        vkCmdDrawMeshTasksIndirectEXT(commandBuffer_, bufferVK.GetVkBuffer(), offset, numCommands, stride);
+    }
+}
+
 /* ----- Compute ----- */
 
 void VKCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
 {
+    FlushPendingRenderPass();
     FlushDescriptorCache();
     vkCmdDispatch(commandBuffer_, numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
 }
 
 void VKCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
 {
+    FlushPendingRenderPass();
     FlushDescriptorCache();
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
     vkCmdDispatchIndirect(commandBuffer_, bufferVK.GetVkBuffer(), offset);
 }
 
+/* ----- Ray Tracing ----- */
+
+void VKCommandBuffer::BuildAccelerationStructure(const AccelerationStructureBuildDescriptor& buildDesc)
+{
+    if (!HasExtension(VKExt::KHR_acceleration_structure))
+        return;
+
+    FlushPendingRenderPass();
+
+    VKAccelerationStructureBuildInfo buildInfo;
+    VKConvertAccelerationStructureBuildInfo(device_, buildInfo, buildDesc, /*resolveBuffers:*/ true);
+
+    /* Geometry and instance data may have been written by transfer or shader commands before */
+    AccelerationStructureMemoryBarrier(
+        (VK_ACCESS_TRANSFER_WRITE_BIT | VK_ACCESS_SHADER_WRITE_BIT),
+        VK_ACCESS_SHADER_READ_BIT,
+        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT
+    );
+
+    const VkAccelerationStructureBuildRangeInfoKHR* buildRanges = buildInfo.buildRanges.data();
+    vkCmdBuildAccelerationStructuresKHR(commandBuffer_, 1, &(buildInfo.buildInfo), &buildRanges);
+
+    /* Subsequent builds, copies, and ray queries must not read the acceleration structure before it has been written */
+    AccelerationStructureMemoryBarrier(
+        VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR,
+        (VK_ACCESS_ACCELERATION_STRUCTURE_READ_BIT_KHR | VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR),
+        VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR
+    );
+}
+
+void VKCommandBuffer::CopyAccelerationStructure(Buffer& dst, Buffer& src, const AccelerationStructureCopyMode mode)
+{
+    if (!HasExtension(VKExt::KHR_acceleration_structure))
+        return;
+
+    FlushPendingRenderPass();
+
+    auto& dstBufferVK = LLGL_CAST(VKBuffer&, dst);
+    auto& srcBufferVK = LLGL_CAST(VKBuffer&, src);
+
+    VkCopyAccelerationStructureInfoKHR copyInfo;
+    {
+        copyInfo.sType  = VK_STRUCTURE_TYPE_COPY_ACCELERATION_STRUCTURE_INFO_KHR;
+        copyInfo.pNext  = nullptr;
+        copyInfo.src    = srcBufferVK.GetVkAccelerationStructure();
+        copyInfo.dst    = dstBufferVK.GetVkAccelerationStructure();
+        copyInfo.mode   = (mode == AccelerationStructureCopyMode::Compact ? VK_COPY_ACCELERATION_STRUCTURE_MODE_COMPACT_KHR : VK_COPY_ACCELERATION_STRUCTURE_MODE_CLONE_KHR);
+    }
+    vkCmdCopyAccelerationStructureKHR(commandBuffer_, &copyInfo);
+
+    AccelerationStructureMemoryBarrier(
+        VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR,
+        (VK_ACCESS_ACCELERATION_STRUCTURE_READ_BIT_KHR | VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR),
+        VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR
+    );
+}
+
+void VKCommandBuffer::WriteAccelerationStructureCompactedSize(Buffer& src, Buffer& dstBuffer, std::uint64_t dstOffset)
+{
+    if (!HasExtension(VKExt::KHR_acceleration_structure))
+        return;
+
+    FlushPendingRenderPass();
+
+    auto& srcBufferVK = LLGL_CAST(VKBuffer&, src);
+    auto& dstBufferVK = LLGL_CAST(VKBuffer&, dstBuffer);
+
+    /* Write compacted size into query and copy its result into the destination buffer */
+    const std::uint32_t query = NextCompactedSizeQuery();
+    vkCmdResetQueryPool(commandBuffer_, compactedSizeQueryPool_, query, 1);
+
+    VkAccelerationStructureKHR accelStruct = srcBufferVK.GetVkAccelerationStructure();
+    vkCmdWriteAccelerationStructuresPropertiesKHR(
+        commandBuffer_,
+        1,
+        &accelStruct,
+        VK_QUERY_TYPE_ACCELERATION_STRUCTURE_COMPACTED_SIZE_KHR,
+        compactedSizeQueryPool_,
+        query
+    );
+
+    vkCmdCopyQueryPoolResults(
+        commandBuffer_,
+        compactedSizeQueryPool_,
+        query,
+        1,
+        dstBufferVK.GetVkBuffer(),
+        dstOffset,
+        sizeof(std::uint64_t),
+        (VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT)
+    );
+
+    BufferPipelineBarrier(dstBufferVK.GetVkBuffer(), dstOffset, sizeof(std::uint64_t), VK_ACCESS_TRANSFER_WRITE_BIT, dstBufferVK.GetAccessFlags());
+}
+
 /* ----- Debugging ----- */
 
 void VKCommandBuffer::PushDebugGroup(const char* name)
 {
+    FlushPendingRenderPass();
+    EnsureInlineRenderPassContents();
+
     if (HasExtension(VKExt::EXT_debug_marker))
     {
         VkDebugMarkerMarkerInfoEXT markerInfo;
@@ -1090,6 +2064,9 @@ void VKCommandBuffer::PushDebugGroup(const char* name)
 
 void VKCommandBuffer::PopDebugGroup()
 {
+    FlushPendingRenderPass();
+    EnsureInlineRenderPassContents();
+
     if (HasExtension(VKExt::EXT_debug_marker))
         vkCmdDebugMarkerEndEXT(commandBuffer_);
 }
@@ -1103,6 +2080,8 @@ void VKCommandBuffer::DoNativeCommand(const void* nativeCommand, std::size_t nat
 
 bool VKCommandBuffer::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
 {
+    FlushPendingRenderPass();
+
     if (nativeHandle != nullptr && nativeHandleSize == sizeof(Vulkan::CommandBufferNativeHandle))
     {
         auto* nativeHandleVK = reinterpret_cast<Vulkan::CommandBufferNativeHandle*>(nativeHandle);
@@ -1164,6 +2143,25 @@ void VKCommandBuffer::CreateVkRecordingFences()
     }
 }
 
+void VKCommandBuffer::CreateVkRecordingSemaphore()
+{
+    VkSemaphoreTypeCreateInfoKHR typeInfo;
+    {
+        typeInfo.sType          = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR;
+        typeInfo.pNext          = nullptr;
+        typeInfo.semaphoreType  = VK_SEMAPHORE_TYPE_TIMELINE_KHR;
+        typeInfo.initialValue   = 0;
+    }
+    VkSemaphoreCreateInfo createInfo;
+    {
+        createInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        createInfo.pNext = &typeInfo;
+        createInfo.flags = 0;
+    }
+    VkResult result = vkCreateSemaphore(device_, &createInfo, nullptr, recordingSemaphore_.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan timeline semaphore for command buffer");
+}
+
 void VKCommandBuffer::ClearFramebufferAttachments(std::uint32_t numAttachments, const VkClearAttachment* attachments)
 {
     if (numAttachments > 0)
@@ -1238,11 +2236,23 @@ void VKCommandBuffer::ConvertRenderPassClearValues(
 
 void VKCommandBuffer::PauseRenderPass()
 {
-    vkCmdEndRenderPass(commandBuffer_);
+    if (dynamicRenderingAttachments_ != nullptr)
+        VKEndDynamicRendering(commandBuffer_, *dynamicRenderingAttachments_);
+    else
+        vkCmdEndRenderPass(commandBuffer_);
 }
 
-void VKCommandBuffer::ResumeRenderPass()
+void VKCommandBuffer::ResumeRenderPass(bool secondaryContents)
 {
+    secondaryContents_ = secondaryContents;
+
+    /* Resume dynamic rendering by loading the content of all attachments */
+    if (dynamicRenderingAttachments_ != nullptr)
+    {
+        VKBeginDynamicRendering(commandBuffer_, *dynamicRenderPass_, *dynamicRenderingAttachments_, nullptr, true, secondaryContents);
+        return;
+    }
+
     /* Record begin of render pass */
     VkRenderPassBeginInfo beginInfo;
     {
@@ -1254,7 +2264,28 @@ void VKCommandBuffer::ResumeRenderPass()
         beginInfo.clearValueCount   = 0;
         beginInfo.pClearValues      = nullptr;
     }
-    vkCmdBeginRenderPass(commandBuffer_, &beginInfo, VK_SUBPASS_CONTENTS_INLINE);
+    vkCmdBeginRenderPass(commandBuffer_, &beginInfo, (secondaryContents ? VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS : VK_SUBPASS_CONTENTS_INLINE));
+}
+
+void VKCommandBuffer::SetVkFragmentShadingRate(const VkExtent2D& fragmentSize)
+{
+    /* Ignore per-primitive and attachment shading rates, since only the pipeline shading rate is set */
+    const VkFragmentShadingRateCombinerOpKHR combinerOps[2] =
+    {
+        VK_FRAGMENT_SHADING_RATE_COMBINER_OP_KEEP_KHR,
+        VK_FRAGMENT_SHADING_RATE_COMBINER_OP_KEEP_KHR,
+    };
+    vkCmdSetFragmentShadingRateKHR(commandBuffer_, &fragmentSize, combinerOps);
+}
+
+void VKCommandBuffer::EnsureInlineRenderPassContents()
+{
+    /* Only vkCmdExecuteCommands can be recorded in a render pass instance with secondary contents */
+    if (secondaryContents_)
+    {
+        PauseRenderPass();
+        ResumeRenderPass();
+    }
 }
 
 bool VKCommandBuffer::IsInsideRenderPass() const
@@ -1262,6 +2293,64 @@ bool VKCommandBuffer::IsInsideRenderPass() const
     return (recordState_ == RecordState::InsideRenderPass);
 }
 
+void VKCommandBuffer::EndActiveRenderPass()
+{
+    /* Record end of render pass */
+    if (dynamicRenderingAttachments_ != nullptr)
+        VKEndDynamicRendering(commandBuffer_, *dynamicRenderingAttachments_);
+    else
+        vkCmdEndRenderPass(commandBuffer_);
+
+    /* Reset render pass and framebuffer attributes */
+    secondaryContents_              = false;
+    renderPass_                     = VK_NULL_HANDLE;
+    framebuffer_                    = VK_NULL_HANDLE;
+    dynamicRenderingAttachments_    = nullptr;
+    dynamicRenderPass_              = nullptr;
+    mergeableRenderTarget_          = nullptr;
+    mergeableRenderPass_            = nullptr;
+
+    /* Store new record state */
+    recordState_ = RecordState::OutsideRenderPass;
+}
+
+void VKCommandBuffer::FlushPendingRenderPass()
+{
+    if (recordState_ == RecordState::PendingEndRenderPass)
+        EndActiveRenderPass();
+}
+
+// Returns the render pass that is used when BeginRenderPass is called with the specified render target and render pass.
+static const VKRenderPass* GetEffectiveVKRenderPass(const RenderTarget& renderTarget, const RenderPass* renderPass)
+{
+    return LLGL_CAST(const VKRenderPass*, renderPass != nullptr ? renderPass : renderTarget.GetRenderPass());
+}
+
+bool VKCommandBuffer::IsRenderPassContinuable() const
+{
+    if (mergeableRenderTarget_ == nullptr)
+        return false;
+
+    /* Render passes that clear attachments or have multiple subpasses must always begin a new render pass instance */
+    const VKRenderPass* renderPassVK = GetEffectiveVKRenderPass(*mergeableRenderTarget_, mergeableRenderPass_);
+    return (renderPassVK != nullptr && renderPassVK->GetClearValuesMask() == 0 && renderPassVK->GetNumSubpasses() <= 1);
+}
+
+bool VKCommandBuffer::IsRenderPassMergeable(RenderTarget& renderTarget, const RenderPass* renderPass, std::uint32_t swapBufferIndex)
+{
+    if (recordState_ != RecordState::PendingEndRenderPass || mergeableRenderTarget_ != &renderTarget || mergeableRenderPass_ != renderPass)
+        return false;
+
+    /* Swap-chains must render into the same color buffer */
+    if (LLGL::IsInstanceOf<SwapChain>(renderTarget))
+    {
+        auto& swapChainVK = LLGL_CAST(VKSwapChain&, renderTarget);
+        return (swapChainVK.TranslateSwapIndex(swapBufferIndex) == currentColorBuffer_);
+    }
+
+    return true;
+}
+
 void VKCommandBuffer::BufferPipelineBarrier(
     VkBuffer                buffer,
     VkDeviceSize            offset,
@@ -1271,6 +2360,8 @@ void VKCommandBuffer::BufferPipelineBarrier(
     VkPipelineStageFlags    srcStageMask,
     VkPipelineStageFlags    dstStageMask)
 {
+    FlushPendingRenderPass();
+
     VkBufferMemoryBarrier barrier;
     {
         barrier.sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
@@ -1286,13 +2377,129 @@ void VKCommandBuffer::BufferPipelineBarrier(
     vkCmdPipelineBarrier(commandBuffer_, srcStageMask, dstStageMask, 0, 0, nullptr, 1, &barrier, 0, nullptr);
 }
 
+void VKCommandBuffer::AccelerationStructureMemoryBarrier(
+    VkAccessFlags           srcAccessMask,
+    VkAccessFlags           dstAccessMask,
+    VkPipelineStageFlags    srcStageMask)
+{
+    FlushPendingRenderPass();
+
+    VkMemoryBarrier barrier;
+    {
+        barrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.pNext           = nullptr;
+        barrier.srcAccessMask   = srcAccessMask;
+        barrier.dstAccessMask   = dstAccessMask;
+    }
+    vkCmdPipelineBarrier(commandBuffer_, srcStageMask, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+}
+
+std::uint32_t VKCommandBuffer::NextCompactedSizeQuery()
+{
+    if (compactedSizeQueryPool_.Get() == VK_NULL_HANDLE)
+    {
+        VkQueryPoolCreateInfo createInfo;
+        {
+            createInfo.sType                = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+            createInfo.pNext                = nullptr;
+            createInfo.flags                = 0;
+            createInfo.queryType            = VK_QUERY_TYPE_ACCELERATION_STRUCTURE_COMPACTED_SIZE_KHR;
+            createInfo.queryCount           = maxNumCommandBuffers * maxNumCompactedSizeQueries;
+            createInfo.pipelineStatistics   = 0;
+        }
+        VkResult result = vkCreateQueryPool(device_, &createInfo, nullptr, compactedSizeQueryPool_.ReleaseAndGetAddressOf());
+        VKThrowIfFailed(result, "failed to create Vulkan query pool for acceleration structure compacted sizes");
+    }
+
+    /* Each native command buffer uses its own range of queries, since the other command buffers might still be in flight */
+    const std::uint32_t query = commandBufferIndex_ * maxNumCompactedSizeQueries + compactedSizeQueryIndex_;
+    compactedSizeQueryIndex_ = (compactedSizeQueryIndex_ + 1) % maxNumCompactedSizeQueries;
+    return query;
+}
+
 void VKCommandBuffer::FlushDescriptorCache()
 {
+    EnsureInlineRenderPassContents();
+
+    /* Every draw and dispatch command calls this function, so record the stages that can write to storage resources here */
+    if (boundPipelineLayout_ != nullptr)
+        InvalidateStorageBarriers(boundPipelineLayout_->GetStorageWriteStages());
+
     if (descriptorCache_ != nullptr && descriptorCache_->IsInvalidated())
     {
         VkDescriptorSet descriptorSet = descriptorCache_->FlushDescriptorSet(*descriptorSetPool_, descriptorSetWriter_);
         boundPipelineState_->BindDynamicDescriptorSet(commandBuffer_, descriptorSet);
     }
+    else if (pushDescriptorLayout_ != nullptr && pushDescriptorLayout_ == boundPipelineLayout_ && pushDescriptorWriter_.IsInvalidated())
+    {
+        const VkWriteDescriptorSet* writes = nullptr;
+        const std::uint32_t numWrites = pushDescriptorWriter_.FlushWrites(writes);
+        boundPipelineState_->PushDynamicDescriptors(commandBuffer_, numWrites, writes);
+    }
+
+    if (uniformBlockInvalidated_)
+        FlushUniformBlock();
+}
+
+void VKCommandBuffer::SubmitStorageBarrier(VKPipelineBarrier& barrier)
+{
+    /* Skip barrier if no storage resource was written since it was submitted last, e.g. when the same resource heap is bound again */
+    if (std::find(syncedStorageBarriers_.begin(), syncedStorageBarriers_.end(), &barrier) != syncedStorageBarriers_.end())
+        return;
+
+    /* Pipeline barriers must not be recorded into the render pass instance that was kept open by EndRenderPass, e.g. when a compute PSO is bound next */
+    FlushPendingRenderPass();
+
+    barrier.Submit(commandBuffer_, storageWriteStages_);
+    syncedStorageBarriers_.push_back(&barrier);
+}
+
+void VKCommandBuffer::InvalidateStorageBarriers(VkPipelineStageFlags writeStages)
+{
+    if (writeStages != 0)
+    {
+        storageWriteStages_ |= writeStages;
+        syncedStorageBarriers_.clear();
+    }
+}
+
+void VKCommandBuffer::FlushUniformBlock()
+{
+    /* Upload CPU copy of the uniform block, so all SetUniforms calls since the last draw or dispatch command only cost a single copy */
+    const VKUniformBlockLayout& uniformBlock = boundPipelineState_->GetUniformBlock();
+    const VKUniformAllocation allocation = uniformBufferPool_->Allocate(uniformBlockData_.data(), uniformBlock.size);
+
+    /* Allocate new descriptor set only when the pool moved to another uniform buffer; Otherwise, only the dynamic offset changes */
+    if (uniformBlockDescriptorSet_ == VK_NULL_HANDLE || uniformBlockBuffer_ != allocation.buffer)
+    {
+        const VkDescriptorPoolSize poolSize{ VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, 1 };
+        uniformBlockDescriptorSet_  = descriptorSetPool_->AllocateDescriptorSet(uniformBlock.setLayout.Get(), 1, &poolSize);
+        uniformBlockBuffer_         = allocation.buffer;
+
+        VkDescriptorBufferInfo bufferInfo;
+        {
+            bufferInfo.buffer   = allocation.buffer;
+            bufferInfo.offset   = 0;
+            bufferInfo.range    = uniformBlock.size;
+        }
+        VkWriteDescriptorSet writeDesc;
+        {
+            writeDesc.sType             = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            writeDesc.pNext             = nullptr;
+            writeDesc.dstSet            = uniformBlockDescriptorSet_;
+            writeDesc.dstBinding        = uniformBlock.binding;
+            writeDesc.dstArrayElement   = 0;
+            writeDesc.descriptorCount   = 1;
+            writeDesc.descriptorType    = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+            writeDesc.pImageInfo        = nullptr;
+            writeDesc.pBufferInfo       = &bufferInfo;
+            writeDesc.pTexelBufferView  = nullptr;
+        }
+        vkUpdateDescriptorSets(device_, 1, &writeDesc, 0, nullptr);
+    }
+
+    boundPipelineState_->BindUniformBlockDescriptorSet(commandBuffer_, uniformBlockDescriptorSet_, static_cast<std::uint32_t>(allocation.offset));
+    uniformBlockInvalidated_ = false;
 }
 
 void VKCommandBuffer::AcquireNextBuffer()
@@ -1302,6 +2509,10 @@ void VKCommandBuffer::AcquireNextBuffer()
     recordingFence_     = recordingFenceArray_[commandBufferIndex_].Get();
     descriptorSetPool_  = &(descriptorSetPoolArray_[commandBufferIndex_]);
     descriptorSetPool_->Reset();
+    uniformBufferPool_  = &(uniformBufferPoolArray_[commandBufferIndex_]);
+    uniformBufferPool_->Reset();
+    stagingBufferPool_  = &(stagingBufferPoolArray_[commandBufferIndex_]);
+    stagingBufferPool_->Reset();
     context_.Reset(commandBuffer_);
 }
 
@@ -1311,30 +2522,16 @@ void VKCommandBuffer::ResetBindingStates()
     boundPipelineLayout_    = nullptr;
     boundPipelineState_     = nullptr;
     descriptorCache_        = nullptr;
+    pushDescriptorLayout_   = nullptr;
+    uniformBlockData_.clear();
+    uniformBlockInvalidated_    = false;
+    uniformBlockDescriptorSet_  = VK_NULL_HANDLE;
 }
 
-void VKCommandBuffer::ResetQueryPoolsInFlight()
+void VKCommandBuffer::TrackQueryHeap(VKQueryHeap& queryHeap)
 {
-    for_range(i, numQueryHeapsInFlight_)
-    {
-        auto& queryHeapVK = *(queryHeapsInFlight_[0]);
-        vkCmdResetQueryPool(
-            commandBuffer_,
-            queryHeapVK.GetVkQueryPool(),
-            0,
-            queryHeapVK.GetNumQueries()
-        );
-    }
-    numQueryHeapsInFlight_ = 0;
-}
-
-void VKCommandBuffer::AppendQueryPoolInFlight(VKQueryHeap* queryHeap)
-{
-    if (numQueryHeapsInFlight_ >= queryHeapsInFlight_.size())
-        queryHeapsInFlight_.push_back(queryHeap);
-    else
-        queryHeapsInFlight_[numQueryHeapsInFlight_] = queryHeap;
-    ++numQueryHeapsInFlight_;
+    if (queryHeap.IsHostResettable() && std::find(queryHeapsInFlight_.begin(), queryHeapsInFlight_.end(), &queryHeap) == queryHeapsInFlight_.end())
+        queryHeapsInFlight_.push_back(&queryHeap);
 }
 
 std::uint32_t VKCommandBuffer::GetNumVkCommandBuffers(const CommandBufferDescriptor& desc)
@@ -16,6 +16,10 @@
 #include "VKCommandContext.h"
 #include "../RenderState/VKStagingDescriptorSetPool.h"
 #include "../RenderState/VKDescriptorCache.h"
+#include "../RenderState/VKPushDescriptorWriter.h"
+#include "../Buffer/VKUniformBufferPool.h"
+#include <LLGL/Container/DynamicVector.h>
+#include <LLGL/Container/SmallVector.h>
 #include <vector>
 
 
@@ -25,10 +29,14 @@ namespace LLGL
 
 class VKPhysicalDevice;
 class VKResourceHeap;
+class VKPipelineBarrier;
 class VKRenderPass;
+struct VKDynamicRenderingAttachments;
 class VKQueryHeap;
 class VKSwapChain;
 class VKPipelineState;
+class VKDevice;
+class VKCommandQueue;
 
 class VKCommandBuffer final : public CommandBuffer
 {
@@ -41,8 +49,8 @@ class VKCommandBuffer final : public CommandBuffer
 
         VKCommandBuffer(
             const VKPhysicalDevice&         physicalDevice,
-            VkDevice                        device,
-            VkQueue                         commandQueue,
+            VKDevice&                       device,
+            VKCommandQueue&                 commandQueue,
             const QueueFamilyIndices&       queueFamilyIndices,
             const CommandBufferDescriptor&  desc
         );
@@ -55,6 +63,12 @@ class VKCommandBuffer final : public CommandBuffer
         // i.e. it won't need another signal for the next submission.
         VkFence GetQueueSubmitFenceAndFlush();
 
+        // Returns the next value to signal the recording semaphore with. Begin() waits for this value before the native command buffer is recorded again.
+        std::uint64_t NextRecordingSemaphoreValue();
+
+        // Resets the retrieved queries of all host-resettable query heaps this command buffer writes to. Must be called before each submission.
+        void ResetRetrievedQueries();
+
         // Returns the native VkCommandBuffer object.
         inline VkCommandBuffer GetVkCommandBuffer() const
         {
@@ -67,6 +81,12 @@ class VKCommandBuffer final : public CommandBuffer
             return recordingFence_;
         }
 
+        // Returns the timeline semaphore that replaces the recording fences, or VK_NULL_HANDLE if timeline semaphores are not supported.
+        inline VkSemaphore GetRecordingSemaphore() const
+        {
+            return recordingSemaphore_.Get();
+        }
+
         // Returns true if this is an immediate command buffer, otherwise it is a deferred command buffer.
         inline bool IsImmediateCmdBuffer() const
         {
@@ -77,10 +97,11 @@ class VKCommandBuffer final : public CommandBuffer
 
         enum class RecordState
         {
-            Undefined,          // before "Begin"
-            OutsideRenderPass,  // after "Begin"
-            InsideRenderPass,   // after "BeginRenderPass"
-            ReadyForSubmit,     // after "End"
+            Undefined,              // before "Begin"
+            OutsideRenderPass,      // after "Begin"
+            InsideRenderPass,       // after "BeginRenderPass"
+            PendingEndRenderPass,   // after "EndRenderPass" while the render pass instance is kept open to be merged with the next one
+            ReadyForSubmit,         // after "End"
         };
 
     private:
@@ -88,6 +109,7 @@ class VKCommandBuffer final : public CommandBuffer
         void CreateVkCommandPool(std::uint32_t queueFamilyIndex);
         void CreateVkCommandBuffers();
         void CreateVkRecordingFences();
+        void CreateVkRecordingSemaphore();
 
         void ClearFramebufferAttachments(std::uint32_t numAttachments, const VkClearAttachment* attachments);
 
@@ -100,10 +122,28 @@ class VKCommandBuffer final : public CommandBuffer
         );
 
         void PauseRenderPass();
-        void ResumeRenderPass();
+        void ResumeRenderPass(bool secondaryContents = false);
+
+        // Resumes the render pass with inline contents if it was resumed to execute secondary command buffers.
+        void EnsureInlineRenderPassContents();
+
+        // Sets the dynamic pipeline shading rate. Requires VK_KHR_fragment_shading_rate.
+        void SetVkFragmentShadingRate(const VkExtent2D& fragmentSize);
 
         bool IsInsideRenderPass() const;
 
+        // Records the end of the active render pass instance and resets all render pass attributes.
+        void EndActiveRenderPass();
+
+        // Ends the render pass instance that was kept open by EndRenderPass. This must be called before any command that is recorded outside of a render pass.
+        void FlushPendingRenderPass();
+
+        // Returns true if the active render pass instance can be continued by a subsequent render pass with the same render target and render pass.
+        bool IsRenderPassContinuable() const;
+
+        // Returns true if the specified render pass can be merged with the render pass instance that was kept open by EndRenderPass.
+        bool IsRenderPassMergeable(RenderTarget& renderTarget, const RenderPass* renderPass, std::uint32_t swapBufferIndex);
+
         void BufferPipelineBarrier(
             VkBuffer                buffer,
             VkDeviceSize            offset,
@@ -114,17 +154,32 @@ class VKCommandBuffer final : public CommandBuffer
             VkPipelineStageFlags    dstStageMask    = VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT | VK_PIPELINE_STAGE_ALL_COMMANDS_BIT
         );
 
+        // Inserts a global memory barrier for acceleration structure builds, copies, and their consumers.
+        void AccelerationStructureMemoryBarrier(
+            VkAccessFlags           srcAccessMask,
+            VkAccessFlags           dstAccessMask,
+            VkPipelineStageFlags    srcStageMask
+        );
+
+        // Returns the next query of the compacted size query pool for the current native command buffer. The pool is created on first use.
+        std::uint32_t NextCompactedSizeQuery();
+
         void FlushDescriptorCache();
+        void FlushUniformBlock();
+
+        // Submits the specified storage barrier unless it was already submitted since the last write to storage resources. Ends a pending render pass first.
+        void SubmitStorageBarrier(VKPipelineBarrier& barrier);
+
+        // Records that storage resources may have been written in the specified stages, so all storage barriers must be submitted again.
+        void InvalidateStorageBarriers(VkPipelineStageFlags writeStages);
 
         // Acquires the next native VkCommandBuffer object.
         void AcquireNextBuffer();
 
         void ResetBindingStates();
 
-        #if 1//TODO: optimize
-        void ResetQueryPoolsInFlight();
-        void AppendQueryPoolInFlight(VKQueryHeap* queryHeap);
-        #endif
+        // Adds the specified query heap to the list of heaps whose retrieved queries are reset before submission.
+        void TrackQueryHeap(VKQueryHeap& queryHeap);
 
     private:
 
@@ -133,16 +188,19 @@ class VKCommandBuffer final : public CommandBuffer
 
     private:
 
-        static constexpr std::uint32_t maxNumCommandBuffers = 3;
+        static constexpr std::uint32_t maxNumCommandBuffers         = 4;
+        static constexpr std::uint32_t maxNumCompactedSizeQueries   = 16; // Per native command buffer
 
         VkDevice                        device_                     = VK_NULL_HANDLE;
-
-        VkQueue                         commandQueue_               = VK_NULL_HANDLE;
+        VKCommandQueue&                 commandQueue_;
 
         VKPtr<VkCommandPool>            commandPool_;
 
         VKPtr<VkFence>                  recordingFenceArray_[maxNumCommandBuffers];
         VkFence                         recordingFence_             = VK_NULL_HANDLE;
+        VKPtr<VkSemaphore>              recordingSemaphore_;        // Timeline semaphore for batched submissions; see VKCommandQueue::Submit().
+        std::uint64_t                   recordingSemaphoreValues_[maxNumCommandBuffers] = {}; // Last signaled value for each native command buffer
+        std::uint64_t                   recordingSemaphoreCounter_  = 0;
         VkCommandBuffer                 commandBufferArray_[maxNumCommandBuffers];
         VkCommandBuffer                 commandBuffer_              = VK_NULL_HANDLE;
         std::uint32_t                   commandBufferIndex_         = 0;
@@ -156,6 +214,7 @@ class VKCommandBuffer final : public CommandBuffer
         VkCommandBufferUsageFlags       usageFlags_                 = 0;
         bool                            immediateSubmit_            = false;
         bool                            multiSubmit_                = false;
+        bool                            explicitBarriers_           = false;
 
         VKSwapChain*                    boundSwapChain_             = nullptr;
         std::uint32_t                   currentColorBuffer_         = 0;
@@ -164,9 +223,16 @@ class VKCommandBuffer final : public CommandBuffer
         VkRenderPass                    secondaryRenderPass_        = VK_NULL_HANDLE; // to pause/resume render pass (load and store content)
         VkFramebuffer                   framebuffer_                = VK_NULL_HANDLE; // active framebuffer handle
         VkRect2D                        framebufferRenderArea_      = { { 0, 0 }, { 0, 0 } };
+        bool                            secondaryContents_          = false; // render pass instance was resumed for secondary command buffers
         std::uint32_t                   numColorAttachments_        = 0;
         bool                            hasDepthStencilAttachment_  = false;
 
+        const VKDynamicRenderingAttachments*    dynamicRenderingAttachments_    = nullptr; // active attachments if dynamic rendering is used instead of a framebuffer
+        const VKRenderPass*                     dynamicRenderPass_              = nullptr; // render pass that describes the load and store operations for dynamic rendering
+        const VKRenderPass*                     inheritanceRenderPass_          = nullptr; // render pass that is inherited by a secondary command buffer
+        const RenderTarget*                     mergeableRenderTarget_          = nullptr; // render target of the active render pass instance
+        const RenderPass*                       mergeableRenderPass_            = nullptr; // render pass the active render pass instance was begun with
+
         std::uint32_t                   queuePresentFamily_         = 0;
 
         bool                            scissorEnabled_             = false;
@@ -175,17 +241,31 @@ class VKCommandBuffer final : public CommandBuffer
         const VKPipelineLayout*         boundPipelineLayout_        = nullptr;
         VKPipelineState*                boundPipelineState_         = nullptr;
 
+        VkPipelineStageFlags                    storageWriteStages_     = 0; // Stages that may have written to storage resources since Begin()
+        SmallVector<const VKPipelineBarrier*>   syncedStorageBarriers_;      // Storage barriers that were submitted since the last write to storage resources
+
         std::uint32_t                   maxDrawIndirectCount_       = 0;
 
         VKStagingDescriptorSetPool      descriptorSetPoolArray_[maxNumCommandBuffers];
         VKStagingDescriptorSetPool*     descriptorSetPool_          = nullptr;
         VKDescriptorCache*              descriptorCache_            = nullptr;
         VKDescriptorSetWriter           descriptorSetWriter_;
-
-        #if 1//TODO: optimize usage of query pools
-        std::vector<VKQueryHeap*>       queryHeapsInFlight_;
-        std::size_t                     numQueryHeapsInFlight_      = 0;
-        #endif
+        VKPushDescriptorWriter          pushDescriptorWriter_;
+        const VKPipelineLayout*         pushDescriptorLayout_       = nullptr; // Pipeline layout the push descriptor writer was reset for
+
+        VKUniformBufferPool             uniformBufferPoolArray_[maxNumCommandBuffers];
+        VKUniformBufferPool*            uniformBufferPool_          = nullptr;
+        VKUniformBufferPool             stagingBufferPoolArray_[maxNumCommandBuffers]; // Staging arenas for UpdateBuffer commands that exceed the limits of vkCmdUpdateBuffer
+        VKUniformBufferPool*            stagingBufferPool_          = nullptr;
+        std::vector<char>               uniformBlockData_;                          // CPU copy of the uniform block of the bound PSO
+        bool                            uniformBlockInvalidated_    = false;
+        VkDescriptorSet                 uniformBlockDescriptorSet_  = VK_NULL_HANDLE;
+        VkBuffer                        uniformBlockBuffer_         = VK_NULL_HANDLE; // Uniform buffer that is referenced by 'uniformBlockDescriptorSet_'
+
+        VKPtr<VkQueryPool>              compactedSizeQueryPool_;                    // Queries for WriteAccelerationStructureCompactedSize
+        std::uint32_t                   compactedSizeQueryIndex_    = 0;
+
+        SmallVector<VKQueryHeap*>       queryHeapsInFlight_;                        // Host-resettable query heaps written by the current encoding
 
 };
 
@@ -188,15 +188,42 @@ void VKCommandContext::CopyTexture(
     VKTexture&          srcTexture,
     VKTexture&          dstTexture,
     const VkImageCopy&  region)
+{
+    CopyTexture(srcTexture, dstTexture, 1, &region);
+}
+
+void VKCommandContext::CopyTexture(
+    VKTexture&          srcTexture,
+    VKTexture&          dstTexture,
+    std::uint32_t       numRegions,
+    const VkImageCopy*  regions)
 {
     vkCmdCopyImage(
+        commandBuffer_,
+        srcTexture.GetVkImage(),
+        VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+        dstTexture.GetVkImage(),
+        VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+        numRegions,
+        regions
+    );
+}
+
+void VKCommandContext::BlitTexture(
+    VKTexture&          srcTexture,
+    VKTexture&          dstTexture,
+    const VkImageBlit&  region,
+    VkFilter            filter)
+{
+    vkCmdBlitImage(
         commandBuffer_,
         srcTexture.GetVkImage(),
         VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
         dstTexture.GetVkImage(),
         VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
         1,
-        &region
+        &region,
+        filter
     );
 }
 
@@ -267,14 +294,23 @@ void VKCommandContext::CopyBufferToImage(
     VKBuffer&                   srcBuffer,
     VKTexture&                  dstTexture,
     const VkBufferImageCopy&    region)
+{
+    CopyBufferToImage(srcBuffer, dstTexture, 1, &region);
+}
+
+void VKCommandContext::CopyBufferToImage(
+    VKBuffer&                   srcBuffer,
+    VKTexture&                  dstTexture,
+    std::uint32_t               numRegions,
+    const VkBufferImageCopy*    regions)
 {
     vkCmdCopyBufferToImage(
         commandBuffer_,
         srcBuffer.GetVkBuffer(),
         dstTexture.GetVkImage(),
         VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-        1,
-        &region
+        numRegions,
+        regions
     );
 }
 
@@ -322,6 +358,7 @@ void VKCommandContext::GenerateMips(
     const VkExtent3D&           extent,
     const TextureSubresource&   subresource)
 {
+    //TODO: add compute shader path with precompiled SPIR-V builtins (like D3D12MipGenerator), incl. aliasing for storage-incompatible formats and batching multiple textures per dispatch
     ImageMemoryBarrier(
         image,
         VK_FORMAT_UNDEFINED,
@@ -331,17 +368,17 @@ void VKCommandContext::GenerateMips(
         true
     );
 
-    /* Initialize image memory barrier */
+    /* Initialize image memory barrier for all array layers */
     VkImageMemoryBarrier barrier;
 
     const VkImageAspectFlags aspectMask = VKImageUtils::GetInclusiveVkImageAspect(format);
 
     barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
     barrier.pNext                           = nullptr;
-    barrier.srcAccessMask                   = 0;
-    barrier.dstAccessMask                   = 0;
-    barrier.oldLayout                       = VK_IMAGE_LAYOUT_UNDEFINED;
-    barrier.newLayout                       = VK_IMAGE_LAYOUT_UNDEFINED;
+    barrier.srcAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask                   = VK_ACCESS_TRANSFER_READ_BIT;
+    barrier.oldLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barrier.newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
     barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
     barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
     barrier.image                           = image;
@@ -349,99 +386,91 @@ void VKCommandContext::GenerateMips(
     barrier.subresourceRange.baseMipLevel   = subresource.baseMipLevel;
     barrier.subresourceRange.levelCount     = 1;
     barrier.subresourceRange.baseArrayLayer = subresource.baseArrayLayer;
-    barrier.subresourceRange.layerCount     = 1;
+    barrier.subresourceRange.layerCount     = subresource.numArrayLayers;
 
-    /* Blit each MIP-map from previous (lower) MIP level */
-    for_range(arrayLayer, subresource.numArrayLayers)
+    /* Blit each MIP-map from previous (lower) MIP level for all array layers at once, starting with the extent of the base MIP level */
+    VkExtent3D currExtent;
     {
-        VkExtent3D currExtent = extent;
-
-        for_subrange(mipLevel, 1, subresource.numMipLevels)
-        {
-            /* Determine extent of next MIP level */
-            VkExtent3D nextExtent = currExtent;
-
-            nextExtent.width    = std::max(1u, currExtent.width  / 2);
-            nextExtent.height   = std::max(1u, currExtent.height / 2);
-            nextExtent.depth    = std::max(1u, currExtent.depth  / 2);
-
-            /* Transition previous MIP level to VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL */
-            barrier.srcAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
-            barrier.dstAccessMask                   = VK_ACCESS_TRANSFER_READ_BIT;
-            barrier.oldLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-            barrier.newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
-            barrier.subresourceRange.baseMipLevel   = subresource.baseMipLevel + mipLevel - 1;
-            barrier.subresourceRange.baseArrayLayer = subresource.baseArrayLayer + arrayLayer;
-
-            vkCmdPipelineBarrier(
-                commandBuffer_,
-                VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
-                0, nullptr,
-                0, nullptr,
-                1, &barrier
-            );
-
-            /* Blit previous MIP level into next higher MIP level (with smaller extent) */
-            VkImageBlit blit;
-
-            blit.srcSubresource.aspectMask      = aspectMask;
-            blit.srcSubresource.mipLevel        = subresource.baseMipLevel + mipLevel - 1;
-            blit.srcSubresource.baseArrayLayer  = subresource.baseArrayLayer + arrayLayer;
-            blit.srcSubresource.layerCount      = 1;
-            blit.srcOffsets[0]                  = { 0, 0, 0 };
-            blit.srcOffsets[1].x                = static_cast<std::int32_t>(currExtent.width);
-            blit.srcOffsets[1].y                = static_cast<std::int32_t>(currExtent.height);
-            blit.srcOffsets[1].z                = static_cast<std::int32_t>(currExtent.depth);
-            blit.dstSubresource.aspectMask      = aspectMask;
-            blit.dstSubresource.mipLevel        = subresource.baseMipLevel + mipLevel;
-            blit.dstSubresource.baseArrayLayer  = subresource.baseArrayLayer + arrayLayer;
-            blit.dstSubresource.layerCount      = 1;
-            blit.dstOffsets[0]                  = { 0, 0, 0 };
-            blit.dstOffsets[1].x                = static_cast<std::int32_t>(nextExtent.width);
-            blit.dstOffsets[1].y                = static_cast<std::int32_t>(nextExtent.height);
-            blit.dstOffsets[1].z                = static_cast<std::int32_t>(nextExtent.depth);
-
-            vkCmdBlitImage(
-                commandBuffer_,
-                image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
-                image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-                1, &blit,
-                VK_FILTER_LINEAR
-            );
-
-            /* Transition previous MIP level back to VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL */
-            barrier.srcAccessMask   = VK_ACCESS_TRANSFER_READ_BIT;
-            barrier.dstAccessMask   = VK_ACCESS_SHADER_READ_BIT;
-            barrier.oldLayout       = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
-            barrier.newLayout       = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-
-            vkCmdPipelineBarrier(
-                commandBuffer_,
-                VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
-                0, nullptr,
-                0, nullptr,
-                1, &barrier
-            );
-
-            /* Reduce image extent to next MIP level */
-            currExtent = nextExtent;
-        }
-
-        /* Transition last MIP level back to VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL */
-        barrier.srcAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
-        barrier.dstAccessMask                   = VK_ACCESS_SHADER_READ_BIT;
-        barrier.oldLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-        barrier.newLayout                       = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-        barrier.subresourceRange.baseMipLevel   = subresource.numMipLevels - 1;
+        currExtent.width    = std::max(1u, extent.width  >> subresource.baseMipLevel);
+        currExtent.height   = std::max(1u, extent.height >> subresource.baseMipLevel);
+        currExtent.depth    = std::max(1u, extent.depth  >> subresource.baseMipLevel);
+    }
+
+    for_subrange(mipLevel, 1, subresource.numMipLevels)
+    {
+        /* Determine extent of next MIP level */
+        VkExtent3D nextExtent = currExtent;
+
+        nextExtent.width    = std::max(1u, currExtent.width  / 2);
+        nextExtent.height   = std::max(1u, currExtent.height / 2);
+        nextExtent.depth    = std::max(1u, currExtent.depth  / 2);
+
+        /* Transition previous MIP level to VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL; It remains in this layout until all blits are done */
+        barrier.subresourceRange.baseMipLevel = subresource.baseMipLevel + mipLevel - 1;
 
         vkCmdPipelineBarrier(
             commandBuffer_,
-            VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
+            VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
             0, nullptr,
             0, nullptr,
             1, &barrier
         );
+
+        /* Blit previous MIP level into next higher MIP level (with smaller extent) */
+        VkImageBlit blit;
+
+        blit.srcSubresource.aspectMask      = aspectMask;
+        blit.srcSubresource.mipLevel        = subresource.baseMipLevel + mipLevel - 1;
+        blit.srcSubresource.baseArrayLayer  = subresource.baseArrayLayer;
+        blit.srcSubresource.layerCount      = subresource.numArrayLayers;
+        blit.srcOffsets[0]                  = { 0, 0, 0 };
+        blit.srcOffsets[1].x                = static_cast<std::int32_t>(currExtent.width);
+        blit.srcOffsets[1].y                = static_cast<std::int32_t>(currExtent.height);
+        blit.srcOffsets[1].z                = static_cast<std::int32_t>(currExtent.depth);
+        blit.dstSubresource.aspectMask      = aspectMask;
+        blit.dstSubresource.mipLevel        = subresource.baseMipLevel + mipLevel;
+        blit.dstSubresource.baseArrayLayer  = subresource.baseArrayLayer;
+        blit.dstSubresource.layerCount      = subresource.numArrayLayers;
+        blit.dstOffsets[0]                  = { 0, 0, 0 };
+        blit.dstOffsets[1].x                = static_cast<std::int32_t>(nextExtent.width);
+        blit.dstOffsets[1].y                = static_cast<std::int32_t>(nextExtent.height);
+        blit.dstOffsets[1].z                = static_cast<std::int32_t>(nextExtent.depth);
+
+        vkCmdBlitImage(
+            commandBuffer_,
+            image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+            image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+            1, &blit,
+            VK_FILTER_LINEAR
+        );
+
+        /* Reduce image extent to next MIP level */
+        currExtent = nextExtent;
     }
+
+    /* Transition all MIP levels back to VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL with a single pipeline barrier */
+    VkImageMemoryBarrier finalBarriers[2] = { barrier, barrier };
+
+    finalBarriers[0].srcAccessMask                  = VK_ACCESS_TRANSFER_WRITE_BIT;
+    finalBarriers[0].dstAccessMask                  = VK_ACCESS_SHADER_READ_BIT;
+    finalBarriers[0].oldLayout                      = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    finalBarriers[0].newLayout                      = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    finalBarriers[0].subresourceRange.baseMipLevel  = subresource.baseMipLevel + subresource.numMipLevels - 1;
+
+    finalBarriers[1].srcAccessMask                  = VK_ACCESS_TRANSFER_READ_BIT;
+    finalBarriers[1].dstAccessMask                  = VK_ACCESS_SHADER_READ_BIT;
+    finalBarriers[1].oldLayout                      = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    finalBarriers[1].newLayout                      = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    finalBarriers[1].subresourceRange.baseMipLevel  = subresource.baseMipLevel;
+    finalBarriers[1].subresourceRange.levelCount    = subresource.numMipLevels - 1;
+
+    vkCmdPipelineBarrier(
+        commandBuffer_,
+        VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
+        0, nullptr,
+        0, nullptr,
+        (subresource.numMipLevels > 1 ? 2u : 1u), finalBarriers
+    );
 }
 
 
@@ -73,6 +73,21 @@ class VKCommandContext
             const VkImageCopy&  region
         );
 
+        void CopyTexture(
+            VKTexture&          srcTexture,
+            VKTexture&          dstTexture,
+            std::uint32_t       numRegions,
+            const VkImageCopy*  regions
+        );
+
+        // Blits the source texture region into the destination texture region. Both textures must be in transfer layouts.
+        void BlitTexture(
+            VKTexture&          srcTexture,
+            VKTexture&          dstTexture,
+            const VkImageBlit&  region,
+            VkFilter            filter
+        );
+
         void CopyImage(
             VkImage             srcImage,
             VkImageLayout       srcImageLayout,
@@ -107,6 +122,13 @@ class VKCommandContext
             const VkBufferImageCopy&    region
         );
 
+        void CopyBufferToImage(
+            VKBuffer&                   srcBuffer,
+            VKTexture&                  dstTexture,
+            std::uint32_t               numRegions,
+            const VkBufferImageCopy*    regions
+        );
+
         // Copies the source image into the destination buffer (numMipLevels must be 1).
         void CopyImageToBuffer(
             VkImage                     srcImage,
@@ -123,6 +145,7 @@ class VKCommandContext
             const VkBufferImageCopy&    region
         );
 
+        // Generates the MIP-maps of the specified subresource; 'extent' denotes the extent of the first MIP level of the image.
         void GenerateMips(
             VkImage                     image,
             VkFormat                    format,
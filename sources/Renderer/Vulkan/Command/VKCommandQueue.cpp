@@ -7,36 +7,67 @@
 
 #include "VKCommandQueue.h"
 #include "VKCommandBuffer.h"
+#include "VKUploadBatcher.h"
+#include "../VKDevice.h"
+#include "../VKSwapChain.h"
 #include "../RenderState/VKFence.h"
 #include "../RenderState/VKQueryHeap.h"
 #include "../VKCore.h"
+#include "../Ext/VKExtensions.h"
+#include "../Ext/VKExtensionRegistry.h"
 #include "../../CheckedCast.h"
+#include "../../../Core/ProfileZone.h"
+#include <LLGL/Utils/ForRange.h>
+#include <LLGL/Container/SmallVector.h>
 
 
 namespace LLGL
 {
 
 
-VkResult VKSubmitCommandBuffer(VkQueue commandQueue, VkCommandBuffer commandBuffer, VkFence fence)
+VkResult VKSubmitCommandBuffer(
+    VkQueue                     commandQueue,
+    VkCommandBuffer             commandBuffer,
+    VkFence                     fence,
+    std::uint32_t               numWaitSemaphores,
+    const VkSemaphore*          waitSemaphores,
+    const VkPipelineStageFlags* waitDstStageMasks,
+    const std::uint64_t*        waitSemaphoreValues)
 {
+    /* Timeline semaphores require their wait values to be chained into the submission */
+    VkTimelineSemaphoreSubmitInfoKHR timelineInfo;
+    {
+        timelineInfo.sType                      = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR;
+        timelineInfo.pNext                      = nullptr;
+        timelineInfo.waitSemaphoreValueCount    = numWaitSemaphores;
+        timelineInfo.pWaitSemaphoreValues       = waitSemaphoreValues;
+        timelineInfo.signalSemaphoreValueCount  = 0;
+        timelineInfo.pSignalSemaphoreValues     = nullptr;
+    }
+
     VkSubmitInfo submitInfo;
     {
         submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-        submitInfo.pNext                = nullptr;
-        submitInfo.waitSemaphoreCount   = 0;
-        submitInfo.pWaitSemaphores      = nullptr;
-        submitInfo.pWaitDstStageMask    = 0;
-        submitInfo.commandBufferCount   = 1;
+        submitInfo.pNext                = (waitSemaphoreValues != nullptr ? &timelineInfo : nullptr);
+        submitInfo.waitSemaphoreCount   = numWaitSemaphores;
+        submitInfo.pWaitSemaphores      = waitSemaphores;
+        submitInfo.pWaitDstStageMask    = waitDstStageMasks;
+        submitInfo.commandBufferCount   = (commandBuffer != VK_NULL_HANDLE ? 1u : 0u);
         submitInfo.pCommandBuffers      = &commandBuffer;
         submitInfo.signalSemaphoreCount = 0;
         submitInfo.pSignalSemaphores    = nullptr;
     }
+    std::lock_guard<std::mutex> guard{ VKGetQueueMutex() };
     return vkQueueSubmit(commandQueue, 1, &submitInfo, fence);
 }
 
-VKCommandQueue::VKCommandQueue(VkDevice device, VkQueue queue) :
-    device_ { device },
-    native_ { queue  }
+VKCommandQueue::VKCommandQueue(VKDevice& device, VkQueue queue, float timestampPeriod, bool isPrimary) :
+    device_             { device                    },
+    native_             { queue                     },
+    uploadBatcher_      { device.GetUploadBatcher() },
+    timestampPeriod_    { timestampPeriod           },
+    isPrimary_          { isPrimary                 },
+    bindSparseFence_    { device, vkDestroyFence    }
 {
 }
 
@@ -44,18 +75,70 @@ VKCommandQueue::VKCommandQueue(VkDevice device, VkQueue queue) :
 
 void VKCommandQueue::Submit(CommandBuffer& commandBuffer)
 {
-    auto& commandBufferVK = LLGL_CAST(VKCommandBuffer&, commandBuffer);
-    if (!commandBufferVK.IsImmediateCmdBuffer())
+    LLGL_PROFILE_ZONE("Submit");
+
+    auto* commandBufferVK = LLGL_CAST(VKCommandBuffer*, &commandBuffer);
+    if (!commandBufferVK->IsImmediateCmdBuffer())
     {
-        VkResult result = VKSubmitCommandBuffer(
-            native_,
-            commandBufferVK.GetVkCommandBuffer(),
-            commandBufferVK.GetQueueSubmitFenceAndFlush()
-        );
-        VKThrowIfFailed(result, "failed to submit command buffer to Vulkan graphics queue");
+        commandBufferVK->ResetRetrievedQueries();
+        if (commandBufferVK->GetRecordingSemaphore() != VK_NULL_HANDLE)
+            SubmitTimelineCommandBuffers(1, &commandBufferVK);
+        else
+            SubmitCommandBuffer(commandBufferVK->GetVkCommandBuffer(), commandBufferVK->GetQueueSubmitFenceAndFlush());
     }
 }
 
+void VKCommandQueue::Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers)
+{
+    LLGL_PROFILE_ZONE("Submit");
+
+    SmallVector<VKCommandBuffer*, 8> batch;
+    batch.reserve(numCommandBuffers);
+
+    for_range(i, numCommandBuffers)
+    {
+        if (commandBuffers[i] == nullptr)
+            continue;
+
+        auto* commandBufferVK = LLGL_CAST(VKCommandBuffer*, commandBuffers[i]);
+        if (commandBufferVK->IsImmediateCmdBuffer())
+            continue;
+
+        commandBufferVK->ResetRetrievedQueries();
+        if (commandBufferVK->GetRecordingSemaphore() != VK_NULL_HANDLE)
+            batch.push_back(commandBufferVK);
+        else
+        {
+            /* Command buffers with recording fences can only be submitted individually; preserve submission order */
+            if (!batch.empty())
+            {
+                SubmitTimelineCommandBuffers(static_cast<std::uint32_t>(batch.size()), batch.data());
+                batch.clear();
+            }
+            SubmitCommandBuffer(commandBufferVK->GetVkCommandBuffer(), commandBufferVK->GetQueueSubmitFenceAndFlush());
+        }
+    }
+
+    if (!batch.empty())
+        SubmitTimelineCommandBuffers(static_cast<std::uint32_t>(batch.size()), batch.data());
+}
+
+/* ----- Presentation ----- */
+
+void VKCommandQueue::Present(std::uint32_t numSwapChains, SwapChain* const * swapChains)
+{
+    SmallVector<VKSwapChain*, 4> swapChainsVK;
+    swapChainsVK.reserve(numSwapChains);
+
+    for_range(i, numSwapChains)
+    {
+        if (swapChains[i] != nullptr)
+            swapChainsVK.push_back(LLGL_CAST(VKSwapChain*, swapChains[i]));
+    }
+
+    VKSwapChain::PresentBatch(static_cast<std::uint32_t>(swapChainsVK.size()), swapChainsVK.data());
+}
+
 /* ----- Queries ----- */
 
 bool VKCommandQueue::QueryResult(
@@ -74,6 +157,43 @@ bool VKCommandQueue::QueryResult(
 
     VKThrowIfFailed(stateResult, "failed to retrieve results from Vulkan query pool");
 
+    /*
+    Recycle queries once their results have been retrieved, so they can be used again without a reset command on the GPU.
+    They are only reset before the next submission that writes them, so their results can be retrieved again until then.
+    */
+    if (queryHeapVK.IsHostResettable())
+        queryHeapVK.MarkQueriesRetrieved(firstQuery * queryHeapVK.GetGroupSize(), numQueries * queryHeapVK.GetGroupSize());
+
+    return true;
+}
+
+bool VKCommandQueue::QueryTimestampCalibration(TimestampCalibration& outCalibration)
+{
+    /* Extension is only registered if the device supports the host clock of Timer::Tick() (see VKPhysicalDevice) */
+    if (!HasExtension(VKExt::EXT_calibrated_timestamps))
+        return false;
+
+    VkCalibratedTimestampInfoEXT timestampInfos[2];
+    {
+        timestampInfos[0].sType         = VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_EXT;
+        timestampInfos[0].pNext         = nullptr;
+        timestampInfos[0].timeDomain    = VK_TIME_DOMAIN_DEVICE_EXT;
+        timestampInfos[1].sType         = VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_EXT;
+        timestampInfos[1].pNext         = nullptr;
+        timestampInfos[1].timeDomain    = VKGetHostTimeDomain();
+    }
+    std::uint64_t timestamps[2] = {};
+    std::uint64_t maxDeviation  = 0;
+
+    VkResult result = vkGetCalibratedTimestampsEXT(device_, 2, timestampInfos, timestamps, &maxDeviation);
+    if (result != VK_SUCCESS)
+        return false;
+
+    /* Device timestamp is converted into nanoseconds like the results of QueryType::Timestamp; the deviation is already in nanoseconds */
+    outCalibration.cpuTick      = timestamps[1];
+    outCalibration.gpuTimestamp = static_cast<std::uint64_t>(static_cast<double>(timestamps[0]) * timestampPeriod_);
+    outCalibration.maxDeviation = maxDeviation;
+
     return true;
 }
 
@@ -104,7 +224,59 @@ void VKCommandQueue::Submit(Fence& fence)
 {
     auto& fenceVK = LLGL_CAST(VKFence&, fence);
     fenceVK.Reset(device_);
-    vkQueueSubmit(native_, 0, nullptr, fenceVK.GetVkFence());
+    FlushUploads();
+
+    /*
+    Consume the previous semaphore signal if no other queue has waited for it, since a binary semaphore must not be signaled twice.
+    Semaphore wait operations of a batch are executed before its signal operations, so both can be submitted at once.
+    */
+    if (VkSemaphore prevSignaledSemaphore = fenceVK.PrepareSemaphoreSignal())
+        AddWaitSemaphore(prevSignaledSemaphore);
+
+    VkSemaphore signalSemaphore = fenceVK.GetVkSemaphore();
+
+    VkTimelineSemaphoreSubmitInfoKHR timelineInfo;
+    {
+        timelineInfo.sType                      = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR;
+        timelineInfo.pNext                      = nullptr;
+        timelineInfo.waitSemaphoreValueCount    = static_cast<std::uint32_t>(waitSemaphoreValues_.size());
+        timelineInfo.pWaitSemaphoreValues       = waitSemaphoreValues_.data();
+        timelineInfo.signalSemaphoreValueCount  = 0;
+        timelineInfo.pSignalSemaphoreValues     = nullptr;
+    }
+
+    VkSubmitInfo submitInfo;
+    {
+        submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.pNext                = (hasTimelineWaits_ ? &timelineInfo : nullptr);
+        submitInfo.waitSemaphoreCount   = static_cast<std::uint32_t>(waitSemaphores_.size());
+        submitInfo.pWaitSemaphores      = waitSemaphores_.data();
+        submitInfo.pWaitDstStageMask    = waitDstStageMasks_.data();
+        submitInfo.commandBufferCount   = 0;
+        submitInfo.pCommandBuffers      = nullptr;
+        submitInfo.signalSemaphoreCount = 1;
+        submitInfo.pSignalSemaphores    = &signalSemaphore;
+    }
+    std::lock_guard<std::mutex> guard{ VKGetQueueMutex() };
+    VkResult result = vkQueueSubmit(native_, 1, &submitInfo, fenceVK.GetVkFence());
+    VKThrowIfFailed(result, "failed to submit fence to Vulkan queue");
+
+    ClearWaitSemaphores();
+}
+
+void VKCommandQueue::SubmitWait(Fence& fence)
+{
+    auto& fenceVK = LLGL_CAST(VKFence&, fence);
+    if (VkSemaphore semaphore = fenceVK.WaitSemaphore())
+    {
+        /* Wait for the semaphore with the next submission to this queue */
+        AddWaitSemaphore(semaphore);
+    }
+    else if (fenceVK.IsSubmitted())
+    {
+        /* Another queue has already consumed the last semaphore signal, so fall back to waiting on the CPU */
+        fenceVK.Wait(device_, UINT64_MAX);
+    }
 }
 
 bool VKCommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
@@ -113,16 +285,244 @@ bool VKCommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
     return fenceVK.Wait(device_, timeout);
 }
 
+void VKCommandQueue::Submit(Fence& fence, std::uint64_t value)
+{
+    auto& fenceVK = LLGL_CAST(VKFence&, fence);
+    if (VkSemaphore timelineSemaphore = fenceVK.GetTimelineSemaphore())
+    {
+        FlushUploads();
+
+        /* Signal timeline semaphore with an empty batch, which completes after all previous batches of this queue */
+        VkTimelineSemaphoreSubmitInfoKHR timelineInfo;
+        {
+            timelineInfo.sType                      = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR;
+            timelineInfo.pNext                      = nullptr;
+            timelineInfo.waitSemaphoreValueCount    = static_cast<std::uint32_t>(waitSemaphoreValues_.size());
+            timelineInfo.pWaitSemaphoreValues       = waitSemaphoreValues_.data();
+            timelineInfo.signalSemaphoreValueCount  = 1;
+            timelineInfo.pSignalSemaphoreValues     = &value;
+        }
+        VkSubmitInfo submitInfo;
+        {
+            submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+            submitInfo.pNext                = &timelineInfo;
+            submitInfo.waitSemaphoreCount   = static_cast<std::uint32_t>(waitSemaphores_.size());
+            submitInfo.pWaitSemaphores      = waitSemaphores_.data();
+            submitInfo.pWaitDstStageMask    = waitDstStageMasks_.data();
+            submitInfo.commandBufferCount   = 0;
+            submitInfo.pCommandBuffers      = nullptr;
+            submitInfo.signalSemaphoreCount = 1;
+            submitInfo.pSignalSemaphores    = &timelineSemaphore;
+        }
+        {
+            std::lock_guard<std::mutex> guard{ VKGetQueueMutex() };
+            VkResult result = vkQueueSubmit(native_, 1, &submitInfo, VK_NULL_HANDLE);
+            VKThrowIfFailed(result, "failed to submit timeline semaphore signal to Vulkan queue");
+        }
+
+        ClearWaitSemaphores();
+    }
+    else
+    {
+        /* Emulate timeline with the binary fence, which must not be reset while its previous submission is still pending */
+        fenceVK.WaitValue(fenceVK.GetSignaledValue(), UINT64_MAX);
+        Submit(fence);
+    }
+    fenceVK.SetSignaledValue(value);
+}
+
+void VKCommandQueue::SubmitWait(Fence& fence, std::uint64_t value)
+{
+    auto& fenceVK = LLGL_CAST(VKFence&, fence);
+    if (VkSemaphore timelineSemaphore = fenceVK.GetTimelineSemaphore())
+    {
+        /* Wait for the timeline value with the next submission to this queue */
+        AddWaitSemaphore(timelineSemaphore, value, true);
+    }
+    else
+    {
+        /* Emulated timelines cannot be waited on by the GPU, so fall back to waiting on the CPU */
+        fenceVK.WaitValue(value, UINT64_MAX);
+    }
+}
+
+bool VKCommandQueue::WaitFence(Fence& fence, std::uint64_t value, std::uint64_t timeout)
+{
+    auto& fenceVK = LLGL_CAST(VKFence&, fence);
+    return fenceVK.WaitValue(value, timeout);
+}
+
 void VKCommandQueue::WaitIdle()
 {
+    if (isPrimary_)
+        uploadBatcher_.SubmitAndWait();
+    if (!waitSemaphores_.empty())
+        SubmitWaitSemaphores();
+    std::lock_guard<std::mutex> guard{ VKGetQueueMutex() };
     vkQueueWaitIdle(native_);
 }
 
+/* ----- Internal ----- */
+
+void VKCommandQueue::SubmitCommandBuffer(VkCommandBuffer commandBuffer, VkFence fence)
+{
+    /* Submit pending transfer commands first, so this command buffer observes all previous resource uploads */
+    FlushUploads();
+
+    VkResult result = VKSubmitCommandBuffer(
+        native_,
+        commandBuffer,
+        fence,
+        static_cast<std::uint32_t>(waitSemaphores_.size()),
+        waitSemaphores_.data(),
+        waitDstStageMasks_.data(),
+        GetWaitSemaphoreValues()
+    );
+    VKThrowIfFailed(result, "failed to submit command buffer to Vulkan queue");
+
+    ClearWaitSemaphores();
+}
+
+void VKCommandQueue::SubmitTimelineCommandBuffers(std::uint32_t numCommandBuffers, VKCommandBuffer* const * commandBuffers)
+{
+    /* Submit pending transfer commands first, so these command buffers observe all previous resource uploads */
+    FlushUploads();
+
+    SmallVector<VkCommandBuffer, 8>                     nativeCommandBuffers;
+    SmallVector<VkSemaphore, 8>                         signalSemaphores;
+    SmallVector<std::uint64_t, 8>                       signalSemaphoreValues;
+    SmallVector<VkTimelineSemaphoreSubmitInfoKHR, 8>    timelineInfos;
+    SmallVector<VkSubmitInfo, 8>                        submitInfos;
+
+    nativeCommandBuffers.resize(numCommandBuffers);
+    signalSemaphores.resize(numCommandBuffers);
+    signalSemaphoreValues.resize(numCommandBuffers);
+    timelineInfos.resize(numCommandBuffers);
+    submitInfos.resize(numCommandBuffers);
+
+    /* Each command buffer gets its own batch, so its recording semaphore is signaled as soon as it has completed */
+    for_range(i, numCommandBuffers)
+    {
+        nativeCommandBuffers[i]     = commandBuffers[i]->GetVkCommandBuffer();
+        signalSemaphores[i]         = commandBuffers[i]->GetRecordingSemaphore();
+        signalSemaphoreValues[i]    = commandBuffers[i]->NextRecordingSemaphoreValue();
+
+        /* Only the first batch waits for the semaphores scheduled by SubmitWait(); subsequent batches are ordered after it */
+        const std::uint32_t numWaitSemaphores = (i == 0 ? static_cast<std::uint32_t>(waitSemaphores_.size()) : 0u);
+
+        VkTimelineSemaphoreSubmitInfoKHR& timelineInfo = timelineInfos[i];
+        {
+            timelineInfo.sType                      = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR;
+            timelineInfo.pNext                      = nullptr;
+            timelineInfo.waitSemaphoreValueCount    = numWaitSemaphores;
+            timelineInfo.pWaitSemaphoreValues       = waitSemaphoreValues_.data();
+            timelineInfo.signalSemaphoreValueCount  = 1;
+            timelineInfo.pSignalSemaphoreValues     = &(signalSemaphoreValues[i]);
+        }
+        VkSubmitInfo& submitInfo = submitInfos[i];
+        {
+            submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+            submitInfo.pNext                = &timelineInfo;
+            submitInfo.waitSemaphoreCount   = numWaitSemaphores;
+            submitInfo.pWaitSemaphores      = waitSemaphores_.data();
+            submitInfo.pWaitDstStageMask    = waitDstStageMasks_.data();
+            submitInfo.commandBufferCount   = 1;
+            submitInfo.pCommandBuffers      = &(nativeCommandBuffers[i]);
+            submitInfo.signalSemaphoreCount = 1;
+            submitInfo.pSignalSemaphores    = &(signalSemaphores[i]);
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> guard{ VKGetQueueMutex() };
+        VkResult result = vkQueueSubmit(native_, numCommandBuffers, submitInfos.data(), VK_NULL_HANDLE);
+        VKThrowIfFailed(result, "failed to submit command buffers to Vulkan queue");
+    }
+
+    ClearWaitSemaphores();
+}
+
+void VKCommandQueue::BindSparseAndWait(const VkBindSparseInfo& bindInfo)
+{
+    /* Pending transfer commands might still write into memory that is about to be unbound */
+    if (uploadBatcher_.HasPendingWork())
+        uploadBatcher_.SubmitAndWait();
+
+    if (bindSparseFence_.Get() == VK_NULL_HANDLE)
+    {
+        VkFenceCreateInfo createInfo;
+        {
+            createInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+            createInfo.pNext = nullptr;
+            createInfo.flags = 0;
+        }
+        VkResult result = vkCreateFence(device_, &createInfo, nullptr, bindSparseFence_.ReleaseAndGetAddressOf());
+        VKThrowIfFailed(result, "failed to create Vulkan fence for sparse binding");
+    }
+    else
+        vkResetFences(device_, 1, bindSparseFence_.GetAddressOf());
+
+    VkResult result = vkQueueBindSparse(native_, 1, &bindInfo, bindSparseFence_);
+    VKThrowIfFailed(result, "failed to bind sparse memory on Vulkan queue");
+
+    /* Sparse binding is not ordered with other queue submissions, so wait until the new mapping is visible */
+    vkWaitForFences(device_, 1, bindSparseFence_.GetAddressOf(), VK_TRUE, UINT64_MAX);
+}
+
 
 /*
  * ======= Private: =======
  */
 
+void VKCommandQueue::FlushUploads()
+{
+    /*
+    Transfer commands are batched for the primary queue. Other queues do not observe the submission order
+    of the primary queue, so they have to wait until all batches have completed execution.
+    */
+    if (isPrimary_)
+        uploadBatcher_.Submit();
+    else if (uploadBatcher_.HasPendingWork())
+        uploadBatcher_.SubmitAndWait();
+}
+
+void VKCommandQueue::SubmitWaitSemaphores()
+{
+    VkResult result = VKSubmitCommandBuffer(
+        native_,
+        VK_NULL_HANDLE,
+        VK_NULL_HANDLE,
+        static_cast<std::uint32_t>(waitSemaphores_.size()),
+        waitSemaphores_.data(),
+        waitDstStageMasks_.data(),
+        GetWaitSemaphoreValues()
+    );
+    VKThrowIfFailed(result, "failed to submit semaphore waits to Vulkan queue");
+
+    ClearWaitSemaphores();
+}
+
+void VKCommandQueue::AddWaitSemaphore(VkSemaphore semaphore, std::uint64_t value, bool isTimeline)
+{
+    waitSemaphores_.push_back(semaphore);
+    waitDstStageMasks_.push_back(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+    waitSemaphoreValues_.push_back(value);
+    hasTimelineWaits_ |= isTimeline;
+}
+
+const std::uint64_t* VKCommandQueue::GetWaitSemaphoreValues() const
+{
+    return (hasTimelineWaits_ ? waitSemaphoreValues_.data() : nullptr);
+}
+
+void VKCommandQueue::ClearWaitSemaphores()
+{
+    waitSemaphores_.clear();
+    waitDstStageMasks_.clear();
+    waitSemaphoreValues_.clear();
+    hasTimelineWaits_ = false;
+}
+
 VkResult VKCommandQueue::GetQueryResults(
     VKQueryHeap&    queryHeapVK,
     std::uint32_t   firstQuery,
@@ -163,6 +563,14 @@ VkResult VKCommandQueue::GetQueryResults(
 
         return VK_SUCCESS;
     }
+    else if (queryHeapVK.GetType() == QueryType::Timestamp)
+    {
+        /* Get timestamps as batch and convert them into nanoseconds */
+        auto stateResult = GetQueryBatchedResults(queryHeapVK, firstQuery, numQueries, data, dataSize, stride, flags);
+        if (stateResult == VK_SUCCESS)
+            ConvertTimestampsToNanoseconds(data, numQueries, stride);
+        return stateResult;
+    }
     else
     {
         /* Get query data directly as batch */
@@ -170,6 +578,23 @@ VkResult VKCommandQueue::GetQueryResults(
     }
 }
 
+void VKCommandQueue::ConvertTimestampsToNanoseconds(void* data, std::uint32_t numQueries, VkDeviceSize stride) const
+{
+    const double period = static_cast<double>(timestampPeriod_);
+    if (stride == sizeof(std::uint64_t))
+    {
+        auto dst = reinterpret_cast<std::uint64_t*>(data);
+        for_range(i, numQueries)
+            dst[i] = static_cast<std::uint64_t>(static_cast<double>(dst[i]) * period);
+    }
+    else
+    {
+        auto dst = reinterpret_cast<std::uint32_t*>(data);
+        for_range(i, numQueries)
+            dst[i] = static_cast<std::uint32_t>(static_cast<double>(dst[i]) * period);
+    }
+}
+
 VkResult VKCommandQueue::GetQueryBatchedResults(
     VKQueryHeap&        queryHeapVK,
     std::uint32_t       firstQuery,
@@ -14,6 +14,7 @@
 #include "../VKPtr.h"
 #include "../VKCore.h"
 #include "../RenderState/VKFence.h"
+#include <vector>
 
 
 namespace LLGL
@@ -21,9 +22,20 @@ namespace LLGL
 
 
 class VKQueryHeap;
-
-// Helper function to submit the specified Vulkan command buffer to a command queue.
-VkResult VKSubmitCommandBuffer(VkQueue commandQueue, VkCommandBuffer commandBuffer, VkFence fence);
+class VKDevice;
+class VKCommandBuffer;
+class VKUploadBatcher;
+
+// Helper function to submit the specified Vulkan command buffer to a command queue. An empty batch is submitted if the command buffer is VK_NULL_HANDLE.
+VkResult VKSubmitCommandBuffer(
+    VkQueue                     commandQueue,
+    VkCommandBuffer             commandBuffer,
+    VkFence                     fence,
+    std::uint32_t               numWaitSemaphores   = 0,
+    const VkSemaphore*          waitSemaphores      = nullptr,
+    const VkPipelineStageFlags* waitDstStageMasks   = nullptr,
+    const std::uint64_t*        waitSemaphoreValues = nullptr
+);
 
 class VKCommandQueue final : public CommandQueue
 {
@@ -34,10 +46,52 @@ class VKCommandQueue final : public CommandQueue
 
     public:
 
-        VKCommandQueue(VkDevice device, VkQueue queue);
+        /*
+        Constructs the command queue for the specified native queue.
+        Only the primary queue submits the batched transfer commands of the device, since they are recorded for the same VkQueue.
+        The timestamp period specifies the number of nanoseconds per timestamp tick (see VkPhysicalDeviceLimits::timestampPeriod).
+        */
+        VKCommandQueue(VKDevice& device, VkQueue queue, float timestampPeriod, bool isPrimary = true);
+
+        // Submits all command buffers that support timeline semaphores with a single call to vkQueueSubmit.
+        void Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers) override;
+
+        // Presents all swap-chains that share the same present queue with a single call to vkQueuePresentKHR.
+        void Present(std::uint32_t numSwapChains, SwapChain* const * swapChains) override;
+
+    public:
+
+        // Submits the specified native command buffer along with all semaphores scheduled by SubmitWait().
+        void SubmitCommandBuffer(VkCommandBuffer commandBuffer, VkFence fence);
+
+        // Submits the specified sparse memory binding and waits until it has completed, since sparse binding is not ordered with command buffer submissions.
+        void BindSparseAndWait(const VkBindSparseInfo& bindInfo);
+
+        // Returns the native VkQueue handle.
+        inline VkQueue GetVkQueue() const
+        {
+            return native_;
+        }
 
     private:
 
+        // Submits the specified command buffers as one batch each, which signal their recording semaphores instead of fences.
+        void SubmitTimelineCommandBuffers(std::uint32_t numCommandBuffers, VKCommandBuffer* const * commandBuffers);
+
+        // Ensures all transfer commands of the upload batcher are executed before the next submission to this queue.
+        void FlushUploads();
+
+        // Submits an empty batch that consumes all semaphores scheduled by SubmitWait().
+        void SubmitWaitSemaphores();
+
+        // Schedules the specified semaphore to be waited on with the next submission. The value is only used for timeline semaphores.
+        void AddWaitSemaphore(VkSemaphore semaphore, std::uint64_t value = 0, bool isTimeline = false);
+
+        // Returns the timeline values of all scheduled wait semaphores, or null if none of them is a timeline semaphore.
+        const std::uint64_t* GetWaitSemaphoreValues() const;
+
+        void ClearWaitSemaphores();
+
         VkResult GetQueryResults(
             VKQueryHeap&    queryHeapVK,
             std::uint32_t   firstQuery,
@@ -56,6 +110,9 @@ class VKCommandQueue final : public CommandQueue
             VkQueryResultFlags  flags
         );
 
+        // Converts the specified timestamps from device ticks into nanoseconds in place.
+        void ConvertTimestampsToNanoseconds(void* data, std::uint32_t numQueries, VkDeviceSize stride) const;
+
         VkResult GetQuerySingleResult(
             VKQueryHeap&        queryHeapVK,
             std::uint32_t       query,
@@ -66,8 +123,17 @@ class VKCommandQueue final : public CommandQueue
 
     private:
 
-        VkDevice    device_ = VK_NULL_HANDLE;
-        VkQueue     native_ = VK_NULL_HANDLE;
+        VkDevice                            device_         = VK_NULL_HANDLE;
+        VkQueue                             native_         = VK_NULL_HANDLE;
+        VKUploadBatcher&                    uploadBatcher_;
+        float                               timestampPeriod_    = 1.0f;
+        bool                                isPrimary_          = true;
+        VKPtr<VkFence>                      bindSparseFence_;       // Fence for BindSparseAndWait(); created on first use.
+
+        std::vector<VkSemaphore>            waitSemaphores_;        // Semaphores the next submission has to wait on; see SubmitWait().
+        std::vector<VkPipelineStageFlags>   waitDstStageMasks_;
+        std::vector<std::uint64_t>          waitSemaphoreValues_;   // Timeline values for each entry in waitSemaphores_; ignored for binary semaphores.
+        bool                                hasTimelineWaits_   = false;
 
 };
 
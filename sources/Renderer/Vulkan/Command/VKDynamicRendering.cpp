@@ -0,0 +1,218 @@
+/*
+ * VKDynamicRendering.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VKDynamicRendering.h"
+#include "../RenderState/VKRenderPass.h"
+#include "../Ext/VKExtensions.h"
+#include "../VKTypes.h"
+#include <LLGL/Utils/ForRange.h>
+
+
+namespace LLGL
+{
+
+
+static constexpr VkPipelineStageFlags   g_attachmentStageMask       = (VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT);
+static constexpr VkAccessFlags          g_colorAccessMask           = (VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT);
+static constexpr VkAccessFlags          g_depthStencilAccessMask    = (VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT);
+
+struct VKDynamicRenderingBarriers
+{
+    std::uint32_t           numBarriers                                     = 0;
+    VkImageMemoryBarrier    barriers[LLGL_MAX_NUM_COLOR_ATTACHMENTS * 2 + 1];
+};
+
+static void AppendImageBarrier(
+    VKDynamicRenderingBarriers&     dst,
+    const VKDynamicRenderingImage&  image,
+    VkImageLayout                   oldLayout,
+    VkImageLayout                   newLayout,
+    VkAccessFlags                   srcAccessMask,
+    VkAccessFlags                   dstAccessMask)
+{
+    VkImageMemoryBarrier& barrier = dst.barriers[dst.numBarriers++];
+    {
+        barrier.sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.pNext               = nullptr;
+        barrier.srcAccessMask       = srcAccessMask;
+        barrier.dstAccessMask       = dstAccessMask;
+        barrier.oldLayout           = oldLayout;
+        barrier.newLayout           = newLayout;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image               = image.image;
+        barrier.subresourceRange    = image.subresource;
+    }
+}
+
+static void FlushImageBarriers(
+    VkCommandBuffer                     commandBuffer,
+    const VKDynamicRenderingBarriers&   barriers,
+    VkPipelineStageFlags                srcStageMask,
+    VkPipelineStageFlags                dstStageMask)
+{
+    if (barriers.numBarriers > 0)
+    {
+        vkCmdPipelineBarrier(
+            commandBuffer,
+            srcStageMask,
+            dstStageMask,
+            0, // VkDependencyFlags
+            0, nullptr,
+            0, nullptr,
+            barriers.numBarriers,
+            barriers.barriers
+        );
+    }
+}
+
+static void InitVkRenderingAttachmentInfo(
+    VkRenderingAttachmentInfoKHR&   dst,
+    const VKDynamicRenderingImage&  image,
+    VkImageLayout                   layout,
+    VkAttachmentLoadOp              loadOp,
+    VkAttachmentStoreOp             storeOp,
+    const VkClearValue&             clearValue)
+{
+    dst.sType               = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR;
+    dst.pNext               = nullptr;
+    dst.imageView           = image.imageView;
+    dst.imageLayout         = layout;
+    dst.resolveMode         = VK_RESOLVE_MODE_NONE_KHR;
+    dst.resolveImageView    = VK_NULL_HANDLE;
+    dst.resolveImageLayout  = VK_IMAGE_LAYOUT_UNDEFINED;
+    dst.loadOp              = loadOp;
+    dst.storeOp             = storeOp;
+    dst.clearValue          = clearValue;
+}
+
+void VKBeginDynamicRendering(
+    VkCommandBuffer                         commandBuffer,
+    const VKRenderPass&                     renderPass,
+    const VKDynamicRenderingAttachments&    attachments,
+    const VkClearValue*                     clearValues,
+    bool                                    resume,
+    bool                                    secondaryContents)
+{
+    /* Uninitialized stack memory for attachment infos */
+    VkRenderingAttachmentInfoKHR    colorAttachmentInfos[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
+    VkRenderingAttachmentInfoKHR    depthAttachmentInfo;
+    VkRenderingAttachmentInfoKHR    stencilAttachmentInfo;
+    VKDynamicRenderingBarriers      barriers;
+
+    const VkClearValue              defaultClearValue   = {};
+    const std::uint32_t             numColorAttachments = attachments.numColorAttachments;
+
+    /* Transition color attachments and initialize their attachment infos */
+    for_range(i, numColorAttachments)
+    {
+        const VkAttachmentDescription&  attachmentDesc  = renderPass.GetAttachmentDesc(i);
+        const VKDynamicRenderingImage&  colorImage      = attachments.colorAttachments[i];
+        const VKDynamicRenderingImage&  resolveImage    = attachments.resolveAttachments[i];
+        const VkAttachmentLoadOp        loadOp          = (resume ? VK_ATTACHMENT_LOAD_OP_LOAD : attachmentDesc.loadOp);
+        const VkClearValue&             clearValue      = (clearValues != nullptr ? clearValues[i] : defaultClearValue);
+
+        const VkImageLayout oldLayout = (loadOp == VK_ATTACHMENT_LOAD_OP_LOAD ? colorImage.restingLayout : VK_IMAGE_LAYOUT_UNDEFINED);
+        AppendImageBarrier(barriers, colorImage, oldLayout, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, VK_ACCESS_MEMORY_WRITE_BIT, g_colorAccessMask);
+
+        InitVkRenderingAttachmentInfo(colorAttachmentInfos[i], colorImage, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, loadOp, attachmentDesc.storeOp, clearValue);
+
+        if (resolveImage.imageView != VK_NULL_HANDLE)
+        {
+            /* Resolve image is overridden entirely, so its previous content can be discarded */
+            AppendImageBarrier(barriers, resolveImage, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, VK_ACCESS_MEMORY_WRITE_BIT, g_colorAccessMask);
+            colorAttachmentInfos[i].resolveMode         = VK_RESOLVE_MODE_AVERAGE_BIT_KHR;
+            colorAttachmentInfos[i].resolveImageView    = resolveImage.imageView;
+            colorAttachmentInfos[i].resolveImageLayout  = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+        }
+    }
+
+    /* Transition depth-stencil attachment and initialize its attachment infos */
+    const VKDynamicRenderingImage& depthStencilImage = attachments.depthStencilAttachment;
+
+    bool hasDepth   = false;
+    bool hasStencil = false;
+
+    if (depthStencilImage.imageView != VK_NULL_HANDLE && renderPass.GetDepthStencilIndex() == 0xFFu)
+    {
+        /* Keep content of depth-stencil attachment that is not used by this render pass, since it is transitioned back at the end of dynamic rendering */
+        AppendImageBarrier(barriers, depthStencilImage, depthStencilImage.restingLayout, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL, VK_ACCESS_MEMORY_WRITE_BIT, g_depthStencilAccessMask);
+    }
+    else if (depthStencilImage.imageView != VK_NULL_HANDLE)
+    {
+        const std::uint8_t              depthStencilIndex   = renderPass.GetDepthStencilIndex();
+        const VkAttachmentDescription&  attachmentDesc      = renderPass.GetAttachmentDesc(depthStencilIndex);
+        const VkAttachmentLoadOp        loadOp              = (resume ? VK_ATTACHMENT_LOAD_OP_LOAD : attachmentDesc.loadOp);
+        const VkAttachmentLoadOp        stencilLoadOp       = (resume ? VK_ATTACHMENT_LOAD_OP_LOAD : attachmentDesc.stencilLoadOp);
+        const VkClearValue&             clearValue          = (clearValues != nullptr ? clearValues[depthStencilIndex] : defaultClearValue);
+
+        hasDepth    = VKTypes::IsVkFormatDepth(attachmentDesc.format);
+        hasStencil  = VKTypes::IsVkFormatStencil(attachmentDesc.format);
+
+        const bool loadContent = ((hasDepth && loadOp == VK_ATTACHMENT_LOAD_OP_LOAD) || (hasStencil && stencilLoadOp == VK_ATTACHMENT_LOAD_OP_LOAD));
+        const VkImageLayout oldLayout = (loadContent ? depthStencilImage.restingLayout : VK_IMAGE_LAYOUT_UNDEFINED);
+        AppendImageBarrier(barriers, depthStencilImage, oldLayout, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL, VK_ACCESS_MEMORY_WRITE_BIT, g_depthStencilAccessMask);
+
+        if (hasDepth)
+            InitVkRenderingAttachmentInfo(depthAttachmentInfo, depthStencilImage, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL, loadOp, attachmentDesc.storeOp, clearValue);
+        if (hasStencil)
+            InitVkRenderingAttachmentInfo(stencilAttachmentInfo, depthStencilImage, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL, stencilLoadOp, attachmentDesc.stencilStoreOp, clearValue);
+    }
+
+    FlushImageBarriers(commandBuffer, barriers, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, g_attachmentStageMask);
+
+    /* Record begin of dynamic rendering */
+    VkRenderingInfoKHR renderingInfo;
+    {
+        renderingInfo.sType                 = VK_STRUCTURE_TYPE_RENDERING_INFO_KHR;
+        renderingInfo.pNext                 = nullptr;
+        renderingInfo.flags                 = (secondaryContents ? VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT_KHR : 0);
+        renderingInfo.renderArea.offset     = { 0, 0 };
+        renderingInfo.renderArea.extent     = attachments.extent;
+        renderingInfo.layerCount            = 1;
+        renderingInfo.viewMask              = 0;
+        renderingInfo.colorAttachmentCount  = numColorAttachments;
+        renderingInfo.pColorAttachments     = colorAttachmentInfos;
+        renderingInfo.pDepthAttachment      = (hasDepth ? &depthAttachmentInfo : nullptr);
+        renderingInfo.pStencilAttachment    = (hasStencil ? &stencilAttachmentInfo : nullptr);
+    }
+    vkCmdBeginRenderingKHR(commandBuffer, &renderingInfo);
+}
+
+void VKEndDynamicRendering(
+    VkCommandBuffer                         commandBuffer,
+    const VKDynamicRenderingAttachments&    attachments)
+{
+    /* Record end of dynamic rendering */
+    vkCmdEndRenderingKHR(commandBuffer);
+
+    /* Transition all attachments back into their resting layouts */
+    VKDynamicRenderingBarriers barriers;
+
+    for_range(i, attachments.numColorAttachments)
+    {
+        const VKDynamicRenderingImage& colorImage = attachments.colorAttachments[i];
+        AppendImageBarrier(barriers, colorImage, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, colorImage.restingLayout, g_colorAccessMask, VK_ACCESS_MEMORY_READ_BIT);
+
+        const VKDynamicRenderingImage& resolveImage = attachments.resolveAttachments[i];
+        if (resolveImage.imageView != VK_NULL_HANDLE)
+            AppendImageBarrier(barriers, resolveImage, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, resolveImage.restingLayout, g_colorAccessMask, VK_ACCESS_MEMORY_READ_BIT);
+    }
+
+    const VKDynamicRenderingImage& depthStencilImage = attachments.depthStencilAttachment;
+    if (depthStencilImage.imageView != VK_NULL_HANDLE)
+        AppendImageBarrier(barriers, depthStencilImage, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL, depthStencilImage.restingLayout, g_depthStencilAccessMask, VK_ACCESS_MEMORY_READ_BIT);
+
+    FlushImageBarriers(commandBuffer, barriers, g_attachmentStageMask, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,71 @@
+/*
+ * VKDynamicRendering.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VK_DYNAMIC_RENDERING_H
+#define LLGL_VK_DYNAMIC_RENDERING_H
+
+
+#include "../Vulkan.h"
+#include <LLGL/Constants.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class VKRenderPass;
+
+// Image that is bound as attachment for dynamic rendering.
+struct VKDynamicRenderingImage
+{
+    VkImage                 image           = VK_NULL_HANDLE;
+    VkImageView             imageView       = VK_NULL_HANDLE;   // VK_NULL_HANDLE if this attachment is unused.
+    VkImageSubresourceRange subresource     = {};
+    VkImageLayout           restingLayout   = VK_IMAGE_LAYOUT_UNDEFINED; // Layout the image is kept in outside of dynamic rendering.
+};
+
+// Attachments of a render target or swap-chain framebuffer for dynamic rendering (see VK_KHR_dynamic_rendering).
+struct VKDynamicRenderingAttachments
+{
+    std::uint32_t           numColorAttachments                                 = 0;
+    VKDynamicRenderingImage colorAttachments[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
+    VKDynamicRenderingImage resolveAttachments[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
+    VKDynamicRenderingImage depthStencilAttachment;
+    VkExtent2D              extent                                              = { 0, 0 };
+};
+
+/*
+Transitions all attachments into their attachment layouts and records the begin of dynamic rendering.
+Load and store operations are taken from the render pass. 'clearValues' is indexed by attachment, like the clear values for vkCmdBeginRenderPass.
+If 'resume' is true, the content of all attachments is loaded, e.g. after the render pass was paused to record transfer commands.
+If 'secondaryContents' is true, the rendering instance can only contain secondary command buffers.
+*/
+void VKBeginDynamicRendering(
+    VkCommandBuffer                         commandBuffer,
+    const VKRenderPass&                     renderPass,
+    const VKDynamicRenderingAttachments&    attachments,
+    const VkClearValue*                     clearValues,
+    bool                                    resume              = false,
+    bool                                    secondaryContents   = false
+);
+
+// Records the end of dynamic rendering and transitions all attachments back into their resting layouts.
+void VKEndDynamicRendering(
+    VkCommandBuffer                         commandBuffer,
+    const VKDynamicRenderingAttachments&    attachments
+);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,577 @@
+/*
+ * VKUploadBatcher.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VKUploadBatcher.h"
+#include "../VKCore.h"
+#include "../Memory/VKDeviceMemoryManager.h"
+#include "../../../Core/CoreUtils.h"
+#include <algorithm>
+#include <limits.h>
+
+
+namespace LLGL
+{
+
+
+constexpr VkDeviceSize VKUploadBatcher::stagingSizeThreshold;
+constexpr VkDeviceSize VKUploadBatcher::transferQueueSizeThreshold;
+
+VKUploadBatcher::Batch::Batch(VkDevice device) :
+    fence                   { device, vkDestroyFence     },
+    transferWaitSemaphore   { device, vkDestroySemaphore },
+    transferSignalSemaphore { device, vkDestroySemaphore }
+{
+}
+
+static void CreateBatchCommandPool(VkDevice device, std::uint32_t queueFamilyIndex, VKPtr<VkCommandPool>& outCommandPool)
+{
+    /* Create command pool for transfer batches; command buffers are reset individually when a batch is recycled */
+    VkCommandPoolCreateInfo createInfo;
+    {
+        createInfo.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        createInfo.pNext            = nullptr;
+        createInfo.flags            = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+        createInfo.queueFamilyIndex = queueFamilyIndex;
+    }
+    VkResult result = vkCreateCommandPool(device, &createInfo, nullptr, outCommandPool.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan command pool for upload batches");
+}
+
+static void CreateBatchSemaphore(VkDevice device, VKPtr<VkSemaphore>& outSemaphore)
+{
+    VkSemaphoreCreateInfo createInfo;
+    {
+        createInfo.sType    = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        createInfo.pNext    = nullptr;
+        createInfo.flags    = 0;
+    }
+    VkResult result = vkCreateSemaphore(device, &createInfo, nullptr, outSemaphore.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan semaphore for upload batch");
+}
+
+static void BeginBatchCommandBuffer(VkCommandBuffer commandBuffer)
+{
+    VkCommandBufferBeginInfo beginInfo;
+    {
+        beginInfo.sType             = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.pNext             = nullptr;
+        beginInfo.flags             = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        beginInfo.pInheritanceInfo  = nullptr;
+    }
+    VkResult result = vkBeginCommandBuffer(commandBuffer, &beginInfo);
+    VKThrowIfFailed(result, "failed to begin recording Vulkan command buffer for upload batch");
+}
+
+static void SubmitBatchCommandBuffer(
+    VkQueue                 queue,
+    VkCommandBuffer         commandBuffer,
+    VkSemaphore             waitSemaphore,
+    VkPipelineStageFlags    waitStageMask,
+    VkSemaphore             signalSemaphore,
+    VkFence                 fence)
+{
+    VkSubmitInfo submitInfo;
+    {
+        submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.pNext                = nullptr;
+        submitInfo.waitSemaphoreCount   = (waitSemaphore != VK_NULL_HANDLE ? 1u : 0u);
+        submitInfo.pWaitSemaphores      = &waitSemaphore;
+        submitInfo.pWaitDstStageMask    = &waitStageMask;
+        submitInfo.commandBufferCount   = 1;
+        submitInfo.pCommandBuffers      = &commandBuffer;
+        submitInfo.signalSemaphoreCount = (signalSemaphore != VK_NULL_HANDLE ? 1u : 0u);
+        submitInfo.pSignalSemaphores    = &signalSemaphore;
+    }
+    std::lock_guard<std::mutex> guard{ VKGetQueueMutex() };
+    VkResult result = vkQueueSubmit(queue, 1, &submitInfo, fence);
+    VKThrowIfFailed(result, "failed to submit upload batch to Vulkan queue");
+}
+
+VKUploadBatcher::VKUploadBatcher(
+    VkDevice        device,
+    VkQueue         graphicsQueue,
+    std::uint32_t   graphicsQueueFamily,
+    VkQueue         transferQueue,
+    std::uint32_t   transferQueueFamily)
+:
+    device_                 { device                                    },
+    queue_                  { graphicsQueue                             },
+    transferQueue_          { transferQueue                             },
+    queueFamilies_          { graphicsQueueFamily, transferQueueFamily  },
+    commandPool_            { device, vkDestroyCommandPool              },
+    transferCommandPool_    { device, vkDestroyCommandPool              }
+{
+    CreateBatchCommandPool(device_, graphicsQueueFamily, commandPool_);
+    if (transferQueue_ != VK_NULL_HANDLE)
+        CreateBatchCommandPool(device_, transferQueueFamily, transferCommandPool_);
+}
+
+VKUploadBatcher::~VKUploadBatcher()
+{
+    /* Wait for in-flight batches before their command buffers and fences are destroyed; the owner must have flushed all batches to release deferred staging buffers */
+    if (!inFlightBatches_.empty())
+    {
+        VkFence lastFence = inFlightBatches_.back()->fence.Get();
+        vkWaitForFences(device_, 1, &lastFence, VK_TRUE, ULLONG_MAX);
+    }
+
+    auto FreeBatchCommandBuffer = [this](BatchPtr& batch)
+    {
+        if (batch)
+        {
+            vkFreeCommandBuffers(device_, commandPool_, 1, &(batch->commandBuffer));
+            if (batch->transferCommandBuffer != VK_NULL_HANDLE)
+            {
+                vkFreeCommandBuffers(device_, transferCommandPool_, 1, &(batch->transferCommandBuffer));
+                vkFreeCommandBuffers(device_, commandPool_, 1, &(batch->acquireCommandBuffer));
+            }
+        }
+    };
+
+    FreeBatchCommandBuffer(currentBatch_);
+    for (BatchPtr& batch : inFlightBatches_)
+        FreeBatchCommandBuffer(batch);
+    for (BatchPtr& batch : freeBatches_)
+        FreeBatchCommandBuffer(batch);
+}
+
+VkCommandBuffer VKUploadBatcher::GetCommandBuffer()
+{
+    if (!currentBatch_)
+        BeginBatch();
+    return currentBatch_->commandBuffer;
+}
+
+void VKUploadBatcher::DeferRelease(VKDeviceBuffer&& stagingBuffer, VKDeviceMemoryManager& deviceMemoryMngr)
+{
+    if (!currentBatch_)
+        BeginBatch();
+    currentBatch_->stagingBuffers.push_back(StagingBufferRelease{ std::move(stagingBuffer), &deviceMemoryMngr });
+}
+
+void VKUploadBatcher::AddStagingSize(VkDeviceSize size)
+{
+    stagingSize_ += size;
+    if (stagingSize_ >= VKUploadBatcher::stagingSizeThreshold)
+        Submit();
+}
+
+void VKUploadBatcher::Submit()
+{
+    if (currentBatch_)
+    {
+        VkCommandBuffer commandBuffer = currentBatch_->commandBuffer;
+
+        /* Make all transfer writes of this batch available to subsequent submissions on this queue */
+        VkMemoryBarrier barrier;
+        {
+            barrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+            barrier.pNext           = nullptr;
+            barrier.srcAccessMask   = VK_ACCESS_TRANSFER_WRITE_BIT;
+            barrier.dstAccessMask   = (VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT);
+        }
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+        VkResult result = vkEndCommandBuffer(commandBuffer);
+        VKThrowIfFailed(result, "failed to end recording Vulkan command buffer for upload batch");
+
+        /* Submit batch and signal its fence once it has completed */
+        if (currentBatch_->hasTransferCommands)
+            SubmitWithTransferQueue(*currentBatch_);
+        else
+            SubmitBatchCommandBuffer(queue_, commandBuffer, VK_NULL_HANDLE, 0, VK_NULL_HANDLE, currentBatch_->fence.Get());
+
+        inFlightBatches_.push_back(std::move(currentBatch_));
+        stagingSize_ = 0;
+    }
+
+    /* Recycle batches that have already completed without blocking */
+    ReleaseCompletedBatches(false);
+}
+
+void VKUploadBatcher::SubmitAndWait()
+{
+    Submit();
+    ReleaseCompletedBatches(true);
+}
+
+bool VKUploadBatcher::HasPendingWork()
+{
+    if (currentBatch_)
+        return true;
+    ReleaseCompletedBatches(false);
+    return !inFlightBatches_.empty();
+}
+
+/* ----- Dedicated transfer queue ----- */
+
+bool VKUploadBatcher::IsTransferQueueUpload(VkDeviceSize size) const
+{
+    return (transferQueue_ != VK_NULL_HANDLE && size >= VKUploadBatcher::transferQueueSizeThreshold);
+}
+
+VkCommandBuffer VKUploadBatcher::GetTransferCommandBuffer()
+{
+    if (!currentBatch_)
+        BeginBatch();
+    if (!currentBatch_->hasTransferCommands)
+        BeginTransferCommands();
+    return currentBatch_->transferCommandBuffer;
+}
+
+void VKUploadBatcher::AcquireBufferForTransfer(VkBuffer buffer, bool discardContent)
+{
+    VkCommandBuffer transferCommandBuffer = GetTransferCommandBuffer();
+    if (IsBufferAcquiredForTransfer(buffer))
+    {
+        /* Buffer is already owned by the transfer queue; only synchronize with previous transfer commands */
+        TransferToTransferBarrier();
+        return;
+    }
+
+    currentBatch_->transferBuffers.push_back(buffer);
+
+    /* Uninitialized buffers have no owner yet, so the transfer queue acquires them implicitly on first use */
+    if (discardContent)
+        return;
+
+    /* Release buffer from graphics queue and acquire it on transfer queue */
+    VkBufferMemoryBarrier barrier;
+    {
+        barrier.sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        barrier.pNext               = nullptr;
+        barrier.srcAccessMask       = VK_ACCESS_MEMORY_WRITE_BIT;
+        barrier.dstAccessMask       = 0;
+        barrier.srcQueueFamilyIndex = queueFamilies_[0];
+        barrier.dstQueueFamilyIndex = queueFamilies_[1];
+        barrier.buffer              = buffer;
+        barrier.offset              = 0;
+        barrier.size                = VK_WHOLE_SIZE;
+    }
+    vkCmdPipelineBarrier(currentBatch_->commandBuffer, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 1, &barrier, 0, nullptr);
+
+    barrier.srcAccessMask = 0;
+    barrier.dstAccessMask = (VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT);
+    vkCmdPipelineBarrier(transferCommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 1, &barrier, 0, nullptr);
+}
+
+void VKUploadBatcher::AcquireImageForTransfer(VkImage image, VkImageAspectFlags aspectMask, VkImageLayout oldLayout, VkImageLayout newLayout)
+{
+    VkCommandBuffer transferCommandBuffer = GetTransferCommandBuffer();
+
+    std::vector<ImageOwnership>& transferImages = currentBatch_->transferImages;
+    auto it = std::find_if(
+        transferImages.begin(),
+        transferImages.end(),
+        [image](const ImageOwnership& entry) -> bool
+        {
+            return (entry.image == image);
+        }
+    );
+
+    if (it != transferImages.end())
+    {
+        /* Image is already owned by the transfer queue; only update its final layout and synchronize with previous transfer commands */
+        it->newLayout = newLayout;
+        TransferToTransferBarrier();
+        return;
+    }
+
+    transferImages.push_back(ImageOwnership{ image, aspectMask, newLayout });
+
+    VkImageMemoryBarrier barrier;
+    {
+        barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.pNext                           = nullptr;
+        barrier.srcAccessMask                   = 0;
+        barrier.dstAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.oldLayout                       = oldLayout;
+        barrier.newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image                           = image;
+        barrier.subresourceRange.aspectMask     = aspectMask;
+        barrier.subresourceRange.baseMipLevel   = 0;
+        barrier.subresourceRange.levelCount     = VK_REMAINING_MIP_LEVELS;
+        barrier.subresourceRange.baseArrayLayer = 0;
+        barrier.subresourceRange.layerCount     = VK_REMAINING_ARRAY_LAYERS;
+    }
+
+    if (oldLayout == VK_IMAGE_LAYOUT_UNDEFINED)
+    {
+        /* Uninitialized images have no owner yet, so only transition the layout on the transfer queue */
+        vkCmdPipelineBarrier(transferCommandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+    }
+    else
+    {
+        /* Release image from graphics queue and acquire it on transfer queue with the same layout transition */
+        barrier.srcAccessMask       = VK_ACCESS_MEMORY_WRITE_BIT;
+        barrier.dstAccessMask       = 0;
+        barrier.srcQueueFamilyIndex = queueFamilies_[0];
+        barrier.dstQueueFamilyIndex = queueFamilies_[1];
+        vkCmdPipelineBarrier(currentBatch_->commandBuffer, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+        barrier.srcAccessMask       = 0;
+        barrier.dstAccessMask       = VK_ACCESS_TRANSFER_WRITE_BIT;
+        vkCmdPipelineBarrier(transferCommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+    }
+}
+
+bool VKUploadBatcher::IsBufferAcquiredForTransfer(VkBuffer buffer) const
+{
+    if (!currentBatch_)
+        return false;
+    const std::vector<VkBuffer>& transferBuffers = currentBatch_->transferBuffers;
+    return (std::find(transferBuffers.begin(), transferBuffers.end(), buffer) != transferBuffers.end());
+}
+
+bool VKUploadBatcher::IsImageAcquiredForTransfer(VkImage image) const
+{
+    if (!currentBatch_)
+        return false;
+    for (const ImageOwnership& entry : currentBatch_->transferImages)
+    {
+        if (entry.image == image)
+            return true;
+    }
+    return false;
+}
+
+std::uint32_t VKUploadBatcher::GetConcurrentQueueFamilyIndices(const std::uint32_t*& outQueueFamilyIndices) const
+{
+    if (transferQueue_ != VK_NULL_HANDLE)
+    {
+        outQueueFamilyIndices = queueFamilies_;
+        return 2;
+    }
+    outQueueFamilyIndices = nullptr;
+    return 0;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void VKUploadBatcher::BeginBatch()
+{
+    /* Reuse a completed batch or allocate a new one */
+    if (!freeBatches_.empty())
+    {
+        currentBatch_ = std::move(freeBatches_.back());
+        freeBatches_.pop_back();
+
+        VkResult result = vkResetCommandBuffer(currentBatch_->commandBuffer, 0);
+        VKThrowIfFailed(result, "failed to reset Vulkan command buffer for upload batch");
+
+        VkFence fence = currentBatch_->fence.Get();
+        result = vkResetFences(device_, 1, &fence);
+        VKThrowIfFailed(result, "failed to reset Vulkan fence for upload batch");
+    }
+    else
+    {
+        currentBatch_ = MakeUnique<Batch>(device_);
+        currentBatch_->commandBuffer = AllocateCommandBuffer(commandPool_);
+
+        VkFenceCreateInfo fenceInfo;
+        {
+            fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+            fenceInfo.pNext = nullptr;
+            fenceInfo.flags = 0;
+        }
+        VkResult result = vkCreateFence(device_, &fenceInfo, nullptr, currentBatch_->fence.ReleaseAndGetAddressOf());
+        VKThrowIfFailed(result, "failed to create Vulkan fence for upload batch");
+    }
+
+    currentBatch_->hasTransferCommands = false;
+
+    /* Begin recording transfer commands */
+    BeginBatchCommandBuffer(currentBatch_->commandBuffer);
+
+    /* Transfers of this batch must not overwrite resources that are still accessed by previous submissions */
+    VkMemoryBarrier barrier;
+    {
+        barrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.pNext           = nullptr;
+        barrier.srcAccessMask   = VK_ACCESS_MEMORY_WRITE_BIT;
+        barrier.dstAccessMask   = (VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT);
+    }
+    vkCmdPipelineBarrier(currentBatch_->commandBuffer, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+}
+
+void VKUploadBatcher::BeginTransferCommands()
+{
+    Batch& batch = *currentBatch_;
+
+    /* Allocate transfer resources the first time a batch is used for the transfer queue, otherwise reset them */
+    if (batch.transferCommandBuffer == VK_NULL_HANDLE)
+    {
+        batch.transferCommandBuffer = AllocateCommandBuffer(transferCommandPool_);
+        batch.acquireCommandBuffer  = AllocateCommandBuffer(commandPool_);
+        CreateBatchSemaphore(device_, batch.transferWaitSemaphore);
+        CreateBatchSemaphore(device_, batch.transferSignalSemaphore);
+    }
+    else
+    {
+        VkResult result = vkResetCommandBuffer(batch.transferCommandBuffer, 0);
+        VKThrowIfFailed(result, "failed to reset Vulkan command buffer for upload batch");
+
+        result = vkResetCommandBuffer(batch.acquireCommandBuffer, 0);
+        VKThrowIfFailed(result, "failed to reset Vulkan command buffer for upload batch");
+    }
+
+    BeginBatchCommandBuffer(batch.transferCommandBuffer);
+    batch.hasTransferCommands = true;
+}
+
+void VKUploadBatcher::SubmitWithTransferQueue(Batch& batch)
+{
+    /* Release all acquired resources from the transfer queue and acquire them on the graphics queue with the same layout transitions */
+    std::vector<VkBufferMemoryBarrier> bufferBarriers;
+    bufferBarriers.reserve(batch.transferBuffers.size());
+
+    for (VkBuffer buffer : batch.transferBuffers)
+    {
+        VkBufferMemoryBarrier barrier;
+        {
+            barrier.sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+            barrier.pNext               = nullptr;
+            barrier.srcAccessMask       = VK_ACCESS_TRANSFER_WRITE_BIT;
+            barrier.dstAccessMask       = (VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT);
+            barrier.srcQueueFamilyIndex = queueFamilies_[1];
+            barrier.dstQueueFamilyIndex = queueFamilies_[0];
+            barrier.buffer              = buffer;
+            barrier.offset              = 0;
+            barrier.size                = VK_WHOLE_SIZE;
+        }
+        bufferBarriers.push_back(barrier);
+    }
+
+    std::vector<VkImageMemoryBarrier> imageBarriers;
+    imageBarriers.reserve(batch.transferImages.size());
+
+    for (const ImageOwnership& entry : batch.transferImages)
+    {
+        VkImageMemoryBarrier barrier;
+        {
+            barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+            barrier.pNext                           = nullptr;
+            barrier.srcAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
+            barrier.dstAccessMask                   = (VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT);
+            barrier.oldLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            barrier.newLayout                       = entry.newLayout;
+            barrier.srcQueueFamilyIndex             = queueFamilies_[1];
+            barrier.dstQueueFamilyIndex             = queueFamilies_[0];
+            barrier.image                           = entry.image;
+            barrier.subresourceRange.aspectMask     = entry.aspectMask;
+            barrier.subresourceRange.baseMipLevel   = 0;
+            barrier.subresourceRange.levelCount     = VK_REMAINING_MIP_LEVELS;
+            barrier.subresourceRange.baseArrayLayer = 0;
+            barrier.subresourceRange.layerCount     = VK_REMAINING_ARRAY_LAYERS;
+        }
+        imageBarriers.push_back(barrier);
+    }
+
+    const std::uint32_t numBufferBarriers   = static_cast<std::uint32_t>(bufferBarriers.size());
+    const std::uint32_t numImageBarriers    = static_cast<std::uint32_t>(imageBarriers.size());
+
+    if (numBufferBarriers > 0 || numImageBarriers > 0)
+    {
+        vkCmdPipelineBarrier(
+            batch.transferCommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0,
+            0, nullptr, numBufferBarriers, bufferBarriers.data(), numImageBarriers, imageBarriers.data()
+        );
+    }
+
+    VkResult result = vkEndCommandBuffer(batch.transferCommandBuffer);
+    VKThrowIfFailed(result, "failed to end recording Vulkan command buffer for upload batch");
+
+    BeginBatchCommandBuffer(batch.acquireCommandBuffer);
+    {
+        if (numBufferBarriers > 0 || numImageBarriers > 0)
+        {
+            vkCmdPipelineBarrier(
+                batch.acquireCommandBuffer, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0,
+                0, nullptr, numBufferBarriers, bufferBarriers.data(), numImageBarriers, imageBarriers.data()
+            );
+        }
+    }
+    result = vkEndCommandBuffer(batch.acquireCommandBuffer);
+    VKThrowIfFailed(result, "failed to end recording Vulkan command buffer for upload batch");
+
+    /* Graphics commands (including ownership releases) -> transfer commands -> ownership acquisition on graphics queue */
+    SubmitBatchCommandBuffer(queue_, batch.commandBuffer, VK_NULL_HANDLE, 0, batch.transferWaitSemaphore.Get(), VK_NULL_HANDLE);
+    SubmitBatchCommandBuffer(transferQueue_, batch.transferCommandBuffer, batch.transferWaitSemaphore.Get(), VK_PIPELINE_STAGE_TRANSFER_BIT, batch.transferSignalSemaphore.Get(), VK_NULL_HANDLE);
+    SubmitBatchCommandBuffer(queue_, batch.acquireCommandBuffer, batch.transferSignalSemaphore.Get(), VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_NULL_HANDLE, batch.fence.Get());
+
+    batch.transferBuffers.clear();
+    batch.transferImages.clear();
+}
+
+void VKUploadBatcher::TransferToTransferBarrier()
+{
+    VkMemoryBarrier barrier;
+    {
+        barrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.pNext           = nullptr;
+        barrier.srcAccessMask   = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask   = (VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT);
+    }
+    vkCmdPipelineBarrier(currentBatch_->transferCommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+}
+
+VkCommandBuffer VKUploadBatcher::AllocateCommandBuffer(VkCommandPool commandPool)
+{
+    VkCommandBufferAllocateInfo allocInfo;
+    {
+        allocInfo.sType                 = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.pNext                 = nullptr;
+        allocInfo.commandPool           = commandPool;
+        allocInfo.level                 = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocInfo.commandBufferCount    = 1;
+    }
+    VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+    VkResult result = vkAllocateCommandBuffers(device_, &allocInfo, &commandBuffer);
+    VKThrowIfFailed(result, "failed to allocate Vulkan command buffer for upload batch");
+    return commandBuffer;
+}
+
+void VKUploadBatcher::ReleaseCompletedBatches(bool wait)
+{
+    if (inFlightBatches_.empty())
+        return;
+
+    if (wait)
+    {
+        /* Batches complete in submission order, so waiting for the last fence is sufficient */
+        VkFence lastFence = inFlightBatches_.back()->fence.Get();
+        VkResult result = vkWaitForFences(device_, 1, &lastFence, VK_TRUE, ULLONG_MAX);
+        VKThrowIfFailed(result, "failed to wait for Vulkan fence of upload batch");
+    }
+
+    /* Release all batches in order until the first one that has not been signaled yet */
+    std::size_t numCompleted = 0;
+    for (BatchPtr& batch : inFlightBatches_)
+    {
+        if (!wait && vkGetFenceStatus(device_, batch->fence.Get()) != VK_SUCCESS)
+            break;
+        for (StagingBufferRelease& staging : batch->stagingBuffers)
+            staging.buffer.ReleaseMemoryRegion(*staging.deviceMemoryMngr);
+        batch->stagingBuffers.clear();
+        freeBatches_.push_back(std::move(batch));
+        ++numCompleted;
+    }
+
+    inFlightBatches_.erase(inFlightBatches_.begin(), inFlightBatches_.begin() + numCompleted);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
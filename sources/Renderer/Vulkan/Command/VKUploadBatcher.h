@@ -0,0 +1,189 @@
+/*
+ * VKUploadBatcher.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VK_UPLOAD_BATCHER_H
+#define LLGL_VK_UPLOAD_BATCHER_H
+
+
+#include "../Vulkan.h"
+#include "../VKPtr.h"
+#include "../Buffer/VKDeviceBuffer.h"
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class VKDeviceMemoryManager;
+
+/*
+Accumulates transfer commands, such as staging buffer copies and image layout transitions, into a single command buffer.
+The batch is submitted before any other command buffer is submitted to the same queue, when the staging threshold is exceeded, or when the CPU reads back data.
+Each submission signals its own fence; since fences on the same queue signal in submission order,
+the list of in-flight batches acts as a timeline to determine when deferred staging buffers can be released.
+
+If the device has a dedicated transfer queue, large uploads are recorded into a second command buffer that is executed on that queue.
+Resources are handed over to the transfer queue family for the duration of a batch and back to the graphics queue family when the batch is submitted:
+the graphics commands of a batch signal a semaphore the transfer commands wait on, and the transfer commands signal a semaphore
+that a small graphics command buffer waits on to acquire the resources again. The batch fence is signaled by the latter submission.
+Staging buffers must be created with concurrent sharing between both queue families (see GetConcurrentQueueFamilyIndices).
+*/
+class VKUploadBatcher
+{
+
+    public:
+
+        VKUploadBatcher(
+            VkDevice        device,
+            VkQueue         graphicsQueue,
+            std::uint32_t   graphicsQueueFamily,
+            VkQueue         transferQueue       = VK_NULL_HANDLE,
+            std::uint32_t   transferQueueFamily = ~0u
+        );
+        ~VKUploadBatcher();
+
+        VKUploadBatcher(const VKUploadBatcher&) = delete;
+        VKUploadBatcher& operator = (const VKUploadBatcher&) = delete;
+
+        // Returns the command buffer to record transfer commands into. Begins a new batch if there is none.
+        VkCommandBuffer GetCommandBuffer();
+
+        // Keeps the staging buffer alive until the current batch has completed execution and releases its memory region afterwards.
+        void DeferRelease(VKDeviceBuffer&& stagingBuffer, VKDeviceMemoryManager& deviceMemoryMngr);
+
+        // Accumulates the number of staged bytes for the current batch and submits the batch once the threshold has been exceeded.
+        void AddStagingSize(VkDeviceSize size);
+
+        // Submits the current batch without waiting for its completion.
+        void Submit();
+
+        // Submits the current batch and blocks until all submitted batches have completed.
+        void SubmitAndWait();
+
+        // Returns true if there are transfer commands that have not been submitted yet or are still in flight.
+        bool HasPendingWork();
+
+    public:
+
+        /* ----- Dedicated transfer queue ----- */
+
+        // Returns true if an upload of the specified size should be recorded into the dedicated transfer queue. Always false if there is no such queue.
+        bool IsTransferQueueUpload(VkDeviceSize size) const;
+
+        // Returns the command buffer to record commands for the dedicated transfer queue into. Only call this after the resources were acquired.
+        VkCommandBuffer GetTransferCommandBuffer();
+
+        /*
+        Acquires the buffer for the dedicated transfer queue until the current batch is submitted.
+        If 'discardContent' is true, the buffer is treated as uninitialized and no ownership is released by the graphics queue.
+        */
+        void AcquireBufferForTransfer(VkBuffer buffer, bool discardContent = false);
+
+        /*
+        Acquires the image for the dedicated transfer queue in VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL until the current batch is submitted.
+        When ownership is transferred back to the graphics queue, the image is transitioned into 'newLayout'.
+        If the image has already been acquired for the current batch, 'oldLayout' is ignored.
+        */
+        void AcquireImageForTransfer(VkImage image, VkImageAspectFlags aspectMask, VkImageLayout oldLayout, VkImageLayout newLayout);
+
+        // Returns true if the buffer is owned by the dedicated transfer queue for the current batch, i.e. the graphics queue must not access it until the batch is submitted.
+        bool IsBufferAcquiredForTransfer(VkBuffer buffer) const;
+
+        // Returns true if the image is owned by the dedicated transfer queue for the current batch, i.e. the graphics queue must not access it until the batch is submitted.
+        bool IsImageAcquiredForTransfer(VkImage image) const;
+
+        // Returns the number of queue family indices for concurrent sharing of staging buffers. This is 0 if there is no dedicated transfer queue.
+        std::uint32_t GetConcurrentQueueFamilyIndices(const std::uint32_t*& outQueueFamilyIndices) const;
+
+    public:
+
+        // Submit the current batch once it has staged more than this number of bytes.
+        static constexpr VkDeviceSize stagingSizeThreshold = 64ull * 1024ull * 1024ull;
+
+        // Record uploads into the dedicated transfer queue if they are at least this number of bytes.
+        static constexpr VkDeviceSize transferQueueSizeThreshold = 256ull * 1024ull;
+
+    private:
+
+        struct StagingBufferRelease
+        {
+            VKDeviceBuffer          buffer;
+            VKDeviceMemoryManager*  deviceMemoryMngr;
+        };
+
+        struct ImageOwnership
+        {
+            VkImage             image;
+            VkImageAspectFlags  aspectMask;
+            VkImageLayout       newLayout;
+        };
+
+        struct Batch
+        {
+            Batch(VkDevice device);
+
+            VkCommandBuffer                     commandBuffer           = VK_NULL_HANDLE;
+            VKPtr<VkFence>                      fence;
+            std::vector<StagingBufferRelease>   stagingBuffers;
+
+            /* Dedicated transfer queue resources; only allocated once a batch was used for the transfer queue */
+            bool                                hasTransferCommands     = false;
+            VkCommandBuffer                     transferCommandBuffer   = VK_NULL_HANDLE;
+            VkCommandBuffer                     acquireCommandBuffer    = VK_NULL_HANDLE;
+            VKPtr<VkSemaphore>                  transferWaitSemaphore;
+            VKPtr<VkSemaphore>                  transferSignalSemaphore;
+            std::vector<VkBuffer>               transferBuffers;
+            std::vector<ImageOwnership>         transferImages;
+        };
+
+        using BatchPtr = std::unique_ptr<Batch>;
+
+    private:
+
+        void BeginBatch();
+        void BeginTransferCommands();
+
+        // Records the ownership transfers back to the graphics queue and submits the graphics, transfer, and acquire command buffers of the current batch.
+        void SubmitWithTransferQueue(Batch& batch);
+
+        // Records a barrier between subsequent accesses on the transfer queue to a resource that has already been acquired for the current batch.
+        void TransferToTransferBarrier();
+
+        VkCommandBuffer AllocateCommandBuffer(VkCommandPool commandPool);
+
+        // Releases all in-flight batches whose fences have been signaled. If 'wait' is true, blocks until all in-flight batches have completed.
+        void ReleaseCompletedBatches(bool wait);
+
+    private:
+
+        VkDevice                device_             = VK_NULL_HANDLE;
+        VkQueue                 queue_              = VK_NULL_HANDLE;
+        VkQueue                 transferQueue_      = VK_NULL_HANDLE;
+        std::uint32_t           queueFamilies_[2]   = {};   // Graphics and transfer queue family indices.
+        VKPtr<VkCommandPool>    commandPool_;
+        VKPtr<VkCommandPool>    transferCommandPool_;
+
+        BatchPtr                currentBatch_;
+        std::vector<BatchPtr>   inFlightBatches_;   // Submitted batches in submission order.
+        std::vector<BatchPtr>   freeBatches_;
+
+        VkDeviceSize            stagingSize_        = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
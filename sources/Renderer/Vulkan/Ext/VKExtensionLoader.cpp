@@ -107,6 +107,113 @@ static bool DECL_LOADVKEXT_PROC(KHR_get_physical_device_properties2)
     return true;
 }
 
+static bool DECL_LOADVKEXT_PROC(KHR_get_memory_requirements2)
+{
+    LOAD_VKPROC( vkGetBufferMemoryRequirements2KHR );
+    LOAD_VKPROC( vkGetImageMemoryRequirements2KHR  );
+    return true;
+}
+
+static bool DECL_LOADVKEXT_PROC(KHR_push_descriptor)
+{
+    LOAD_VKPROC( vkCmdPushDescriptorSetKHR );
+    return true;
+}
+
+static bool DECL_LOADVKEXT_PROC(KHR_present_wait)
+{
+    LOAD_VKPROC( vkWaitForPresentKHR );
+    return true;
+}
+
+static bool DECL_LOADVKEXT_PROC(KHR_dynamic_rendering)
+{
+    LOAD_VKPROC( vkCmdBeginRenderingKHR );
+    LOAD_VKPROC( vkCmdEndRenderingKHR   );
+    return true;
+}
+
+static bool DECL_LOADVKEXT_PROC(KHR_draw_indirect_count)
+{
+    LOAD_VKPROC( vkCmdDrawIndirectCountKHR        );
+    LOAD_VKPROC( vkCmdDrawIndexedIndirectCountKHR );
+    return true;
+}
+
+static bool DECL_LOADVKEXT_PROC(KHR_timeline_semaphore)
+{
+    LOAD_VKPROC( vkGetSemaphoreCounterValueKHR );
+    LOAD_VKPROC( vkWaitSemaphoresKHR           );
+    return true;
+}
+
+static bool DECL_LOADVKEXT_PROC(KHR_synchronization2)
+{
+    LOAD_VKPROC( vkCmdPipelineBarrier2KHR );
+    return true;
+}
+
+static bool DECL_LOADVKEXT_PROC(KHR_buffer_device_address)
+{
+    LOAD_VKPROC( vkGetBufferDeviceAddressKHR );
+    return true;
+}
+
+static bool DECL_LOADVKEXT_PROC(KHR_acceleration_structure)
+{
+    LOAD_VKPROC( vkCreateAccelerationStructureKHR              );
+    LOAD_VKPROC( vkDestroyAccelerationStructureKHR             );
+    LOAD_VKPROC( vkGetAccelerationStructureBuildSizesKHR       );
+    LOAD_VKPROC( vkGetAccelerationStructureDeviceAddressKHR    );
+    LOAD_VKPROC( vkCmdBuildAccelerationStructuresKHR           );
+    LOAD_VKPROC( vkCmdCopyAccelerationStructureKHR             );
+    LOAD_VKPROC( vkCmdWriteAccelerationStructuresPropertiesKHR );
+    return true;
+}
+
+static bool DECL_LOADVKEXT_PROC(KHR_fragment_shading_rate)
+{
+    LOAD_VKPROC( vkCmdSetFragmentShadingRateKHR );
+    return true;
+}
+
+static bool DECL_LOADVKEXT_PROC(EXT_mesh_shader)
+{
+    LOAD_VKPROC( vkCmdDrawMeshTasksEXT         );
+    LOAD_VKPROC( vkCmdDrawMeshTasksIndirectEXT );
+    return true;
+}
+
+static bool DECL_LOADVKEXT_PROC(EXT_pageable_device_local_memory)
+{
+    LOAD_VKPROC( vkSetDeviceMemoryPriorityEXT );
+    return true;
+}
+
+static bool DECL_LOADVKEXT_PROC(EXT_extended_dynamic_state)
+{
+    LOAD_VKPROC( vkCmdSetCullModeEXT          );
+    LOAD_VKPROC( vkCmdSetPrimitiveTopologyEXT );
+    LOAD_VKPROC( vkCmdSetDepthTestEnableEXT   );
+    LOAD_VKPROC( vkCmdSetDepthWriteEnableEXT  );
+    LOAD_VKPROC( vkCmdSetDepthCompareOpEXT    );
+    LOAD_VKPROC( vkCmdSetStencilTestEnableEXT );
+    LOAD_VKPROC( vkCmdSetStencilOpEXT         );
+    return true;
+}
+
+static bool DECL_LOADVKEXT_PROC(EXT_calibrated_timestamps)
+{
+    LOAD_VKPROC( vkGetCalibratedTimestampsEXT );
+    return true;
+}
+
+static bool DECL_LOADVKEXT_PROC(EXT_host_query_reset)
+{
+    LOAD_VKPROC( vkResetQueryPoolEXT );
+    return true;
+}
+
 #undef DECL_LOADVKEXT_PROC_BASE
 #undef DECL_LOADVKEXT_PROC_INSTANCE
 #undef DECL_LOADVKEXT_PROC
@@ -115,7 +222,7 @@ static bool DECL_LOADVKEXT_PROC(KHR_get_physical_device_properties2)
 
 /* --- Common extension loading functions --- */
 
-bool VKLoadInstanceExtensions(VkInstance instance)
+bool VKLoadInstanceExtensions(VkInstance instance, bool presentation)
 {
     constexpr bool abortOnFailure = true;
 
@@ -128,10 +235,13 @@ bool VKLoadInstanceExtensions(VkInstance instance)
     #define LOAD_VKEXT(NAME) \
         LoadExtension("VK_" #NAME, Load_VK_##NAME)
 
-    /* Load platform specific extensions */
-    #ifdef LLGL_OS_WIN32
-    LOAD_VKEXT( KHR_win32_surface );
-    #endif // /LLGL_OS_WIN32
+    /* Load platform specific surface extensions; These are not enabled in headless mode */
+    if (presentation)
+    {
+        #ifdef LLGL_OS_WIN32
+        LOAD_VKEXT( KHR_win32_surface );
+        #endif // /LLGL_OS_WIN32
+    }
 
     #undef LOAD_VKEXT
 
@@ -180,8 +290,35 @@ bool VKLoadDeviceExtensions(VkDevice device, const std::vector<const char*>& sup
     LOAD_VKEXT( EXT_debug_marker                    );
     LOAD_VKEXT( EXT_conditional_rendering           );
     LOAD_VKEXT( EXT_transform_feedback              );
+    LOAD_VKEXT( KHR_get_memory_requirements2        );
+    LOAD_VKEXT( KHR_push_descriptor                 );
+    LOAD_VKEXT( KHR_present_wait                    );
+    LOAD_VKEXT( KHR_dynamic_rendering               );
+    LOAD_VKEXT( KHR_draw_indirect_count             );
+    LOAD_VKEXT( KHR_timeline_semaphore              );
+    LOAD_VKEXT( KHR_synchronization2                );
+    LOAD_VKEXT( KHR_buffer_device_address           );
+    LOAD_VKEXT( KHR_acceleration_structure          );
+    LOAD_VKEXT( KHR_fragment_shading_rate           );
+    LOAD_VKEXT( EXT_mesh_shader                     );
+    LOAD_VKEXT( EXT_pageable_device_local_memory    );
+    LOAD_VKEXT( EXT_extended_dynamic_state          );
+    LOAD_VKEXT( EXT_calibrated_timestamps           );
+    LOAD_VKEXT( EXT_host_query_reset                );
 
     ENABLE_VKEXT( EXT_conservative_rasterization );
+    ENABLE_VKEXT( KHR_dedicated_allocation       );
+    ENABLE_VKEXT( EXT_memory_budget              );
+    ENABLE_VKEXT( KHR_present_id                 );
+    ENABLE_VKEXT( KHR_maintenance3               );
+    ENABLE_VKEXT( EXT_descriptor_indexing        );
+    ENABLE_VKEXT( KHR_spirv_1_4                  );
+    ENABLE_VKEXT( KHR_shader_float_controls      );
+    ENABLE_VKEXT( EXT_memory_priority            );
+    ENABLE_VKEXT( KHR_deferred_host_operations   );
+    ENABLE_VKEXT( KHR_ray_query                  );
+    ENABLE_VKEXT( KHR_pipeline_library           );
+    ENABLE_VKEXT( EXT_graphics_pipeline_library  );
 
     #undef LOAD_VKEXT
 
@@ -17,8 +17,8 @@ namespace LLGL
 {
 
 
-// Loads all Vulkan extensions via the specified VkInstance handle.
-bool VKLoadInstanceExtensions(VkInstance instance);
+// Loads all Vulkan extensions via the specified VkInstance handle. Surface extensions are only loaded if 'presentation' is true.
+bool VKLoadInstanceExtensions(VkInstance instance, bool presentation = true);
 
 // Loads all Vulkan extensions via the specified VkDevice handle.
 bool VKLoadDeviceExtensions(VkDevice device, const std::vector<const char*>& supportedExtensions);
@@ -20,10 +20,38 @@ static bool g_VKRegisteredExtensions[static_cast<std::size_t>(VKExt::Count)] = {
 static const char* g_VKOptionalExtensions[] =
 {
     VK_KHR_SAMPLER_MIRROR_CLAMP_TO_EDGE_EXTENSION_NAME,
+    VK_KHR_MAINTENANCE3_EXTENSION_NAME,
     VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME,
+    VK_KHR_GET_MEMORY_REQUIREMENTS_2_EXTENSION_NAME,
+    VK_KHR_DEDICATED_ALLOCATION_EXTENSION_NAME,
+    VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME,
+    VK_KHR_PRESENT_ID_EXTENSION_NAME,
+    VK_KHR_PRESENT_WAIT_EXTENSION_NAME,
+    VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME,
+    VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME,
+    VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME,
+    VK_KHR_SPIRV_1_4_EXTENSION_NAME,
+    VK_KHR_SHADER_FLOAT_CONTROLS_EXTENSION_NAME,
+    VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME,
+    VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME,
+    VK_KHR_DEFERRED_HOST_OPERATIONS_EXTENSION_NAME,
+    VK_KHR_ACCELERATION_STRUCTURE_EXTENSION_NAME,
+    VK_KHR_RAY_QUERY_EXTENSION_NAME,
+    VK_KHR_CREATE_RENDERPASS_2_EXTENSION_NAME,
+    VK_KHR_FRAGMENT_SHADING_RATE_EXTENSION_NAME,
+    VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME,
     VK_EXT_DEBUG_MARKER_EXTENSION_NAME,
     VK_EXT_CONDITIONAL_RENDERING_EXTENSION_NAME,
     VK_EXT_CONSERVATIVE_RASTERIZATION_EXTENSION_NAME,
+    VK_EXT_MEMORY_BUDGET_EXTENSION_NAME,
+    VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME,
+    VK_EXT_MESH_SHADER_EXTENSION_NAME,
+    VK_EXT_MEMORY_PRIORITY_EXTENSION_NAME,
+    VK_EXT_PAGEABLE_DEVICE_LOCAL_MEMORY_EXTENSION_NAME,
+    VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME,
+    VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME,
+    VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME,
+    VK_EXT_HOST_QUERY_RESET_EXTENSION_NAME,
     //VK_EXT_TRANSFORM_FEEDBACK_EXTENSION_NAME,
     nullptr,
 };
@@ -43,11 +71,14 @@ const char** GetOptionalExtensions()
     return g_VKOptionalExtensions;
 }
 
-static bool IsVulkanInstanceExtRequired(const StringView& name)
+static bool IsVulkanInstanceExtPresentation(const StringView& name)
 {
     return
     (
         name == VK_KHR_SURFACE_EXTENSION_NAME
+        #ifdef VK_EXT_swapchain_colorspace
+        || name == VK_EXT_SWAPCHAIN_COLOR_SPACE_EXTENSION_NAME
+        #endif
         #ifdef LLGL_OS_WIN32
         || name == VK_KHR_WIN32_SURFACE_EXTENSION_NAME
         #endif
@@ -76,8 +107,8 @@ static bool IsVulkanInstanceExtDebugOnly(const StringView& name)
 VKExtSupport GetVulkanInstanceExtensionSupport(const char* extensionName)
 {
     const StringView name = extensionName;
-    if (IsVulkanInstanceExtRequired(name))
-        return VKExtSupport::Required;
+    if (IsVulkanInstanceExtPresentation(name))
+        return VKExtSupport::Presentation;
     if (IsVulkanInstanceExtOptional(name))
         return VKExtSupport::Optional;
     if (IsVulkanInstanceExtDebugOnly(name))
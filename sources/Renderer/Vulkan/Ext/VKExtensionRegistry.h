@@ -22,13 +22,40 @@ enum class VKExt
 {
     /* Khronos extensions */
     KHR_maintenance1,
+    KHR_maintenance3,
     KHR_get_physical_device_properties2,
+    KHR_get_memory_requirements2,
+    KHR_dedicated_allocation,
+    KHR_push_descriptor,
+    KHR_present_id,
+    KHR_present_wait,
+    KHR_dynamic_rendering,
+    KHR_draw_indirect_count,
+    KHR_timeline_semaphore,
+    KHR_spirv_1_4,
+    KHR_shader_float_controls,
+    KHR_synchronization2,
+    KHR_buffer_device_address,
+    KHR_deferred_host_operations,
+    KHR_acceleration_structure,
+    KHR_ray_query,
+    KHR_fragment_shading_rate,
+    KHR_pipeline_library,
 
     /* Multivendor extensions */
     EXT_debug_marker,
     EXT_conditional_rendering,
     EXT_transform_feedback,
     EXT_conservative_rasterization,
+    EXT_memory_budget,
+    EXT_descriptor_indexing,
+    EXT_mesh_shader,
+    EXT_memory_priority,
+    EXT_pageable_device_local_memory,
+    EXT_graphics_pipeline_library,
+    EXT_extended_dynamic_state,
+    EXT_calibrated_timestamps,
+    EXT_host_query_reset,
 
     /* Enumeration entry counter */
     Count,
@@ -40,6 +67,7 @@ enum class VKExtSupport
     Unsupported,    // Vulkan extension is unsupported and will not be loaded.
     Optional,       // Vulkan extension is supported but optional.
     DebugOnly,      // Vulkan extension is supported but only used for debugging.
+    Presentation,   // Vulkan extension is supported and required to present on a surface, i.e. it is not used in headless mode.
     Required,       // Vulkan extension is supported and required.
 };
 
@@ -71,6 +71,84 @@ DECL_VKPROC( vkGetPhysicalDeviceQueueFamilyProperties2KHR       );
 DECL_VKPROC( vkGetPhysicalDeviceMemoryProperties2KHR            );
 DECL_VKPROC( vkGetPhysicalDeviceSparseImageFormatProperties2KHR );
 
+/* VK_KHR_get_memory_requirements2 */
+
+DECL_VKPROC( vkGetBufferMemoryRequirements2KHR );
+DECL_VKPROC( vkGetImageMemoryRequirements2KHR  );
+
+/* VK_KHR_push_descriptor */
+
+DECL_VKPROC( vkCmdPushDescriptorSetKHR );
+
+/* VK_KHR_present_wait */
+
+DECL_VKPROC( vkWaitForPresentKHR );
+
+/* VK_KHR_dynamic_rendering */
+
+DECL_VKPROC( vkCmdBeginRenderingKHR );
+DECL_VKPROC( vkCmdEndRenderingKHR   );
+
+/* VK_KHR_draw_indirect_count */
+
+DECL_VKPROC( vkCmdDrawIndirectCountKHR        );
+DECL_VKPROC( vkCmdDrawIndexedIndirectCountKHR );
+
+/* VK_KHR_timeline_semaphore */
+
+DECL_VKPROC( vkGetSemaphoreCounterValueKHR );
+DECL_VKPROC( vkWaitSemaphoresKHR           );
+
+/* VK_KHR_synchronization2 */
+
+DECL_VKPROC( vkCmdPipelineBarrier2KHR );
+
+/* VK_KHR_buffer_device_address */
+
+DECL_VKPROC( vkGetBufferDeviceAddressKHR );
+
+/* VK_KHR_acceleration_structure */
+
+DECL_VKPROC( vkCreateAccelerationStructureKHR              );
+DECL_VKPROC( vkDestroyAccelerationStructureKHR             );
+DECL_VKPROC( vkGetAccelerationStructureBuildSizesKHR       );
+DECL_VKPROC( vkGetAccelerationStructureDeviceAddressKHR    );
+DECL_VKPROC( vkCmdBuildAccelerationStructuresKHR           );
+DECL_VKPROC( vkCmdCopyAccelerationStructureKHR             );
+DECL_VKPROC( vkCmdWriteAccelerationStructuresPropertiesKHR );
+
+/* VK_KHR_fragment_shading_rate */
+
+DECL_VKPROC( vkCmdSetFragmentShadingRateKHR );
+
+/* VK_EXT_mesh_shader */
+
+DECL_VKPROC( vkCmdDrawMeshTasksEXT         );
+DECL_VKPROC( vkCmdDrawMeshTasksIndirectEXT );
+
+/* VK_EXT_pageable_device_local_memory */
+
+DECL_VKPROC( vkSetDeviceMemoryPriorityEXT );
+
+/* VK_EXT_extended_dynamic_state */
+
+DECL_VKPROC( vkCmdSetCullModeEXT          );
+DECL_VKPROC( vkCmdSetPrimitiveTopologyEXT );
+DECL_VKPROC( vkCmdSetDepthTestEnableEXT   );
+DECL_VKPROC( vkCmdSetDepthWriteEnableEXT  );
+DECL_VKPROC( vkCmdSetDepthCompareOpEXT    );
+DECL_VKPROC( vkCmdSetStencilTestEnableEXT );
+DECL_VKPROC( vkCmdSetStencilOpEXT         );
+
+/* VK_EXT_calibrated_timestamps */
+
+DECL_VKPROC( vkGetPhysicalDeviceCalibrateableTimeDomainsEXT );
+DECL_VKPROC( vkGetCalibratedTimestampsEXT                   );
+
+/* VK_EXT_host_query_reset */
+
+DECL_VKPROC( vkResetQueryPoolEXT );
+
 #undef DECL_VKPROC
 
 
@@ -7,26 +7,125 @@
 
 #include "VKDeviceMemory.h"
 #include "../VKCore.h"
+#include "../Ext/VKExtensionRegistry.h"
+#include "../Ext/VKExtensions.h"
 #include "../../ContainerTypes.h"
-
+#include "../../../Core/CoreUtils.h"
 #include "../../../Core/Assertion.h"
+#include <algorithm>
+
+#ifdef _MSC_VER
+#   include <intrin.h>
+#endif
 
 
 namespace LLGL
 {
 
 
-VKDeviceMemory::VKDeviceMemory(VkDevice device, VkDeviceSize size, std::uint32_t memoryTypeIndex) :
-    deviceMemory_    { device, vkFreeMemory },
-    size_            { size                 },
-    memoryTypeIndex_ { memoryTypeIndex      },
-    maxNewBlockSize_ { size                 }
+constexpr std::uint32_t VKDeviceMemory::slCountLog2;
+constexpr std::uint32_t VKDeviceMemory::slCount;
+
+// Returns the zero-based index of the most significant bit. Input must not be zero.
+static std::uint32_t FindMSB(std::uint64_t bits)
+{
+    #if defined _MSC_VER && defined _WIN64
+    unsigned long index = 0;
+    _BitScanReverse64(&index, bits);
+    return static_cast<std::uint32_t>(index);
+    #elif defined __GNUC__ || defined __clang__
+    return 63u - static_cast<std::uint32_t>(__builtin_clzll(bits));
+    #else
+    std::uint32_t index = 0;
+    while (bits >>= 1)
+        ++index;
+    return index;
+    #endif
+}
+
+// Returns the zero-based index of the least significant bit. Input must not be zero.
+static std::uint32_t FindLSB(std::uint64_t bits)
 {
+    #if defined _MSC_VER && defined _WIN64
+    unsigned long index = 0;
+    _BitScanForward64(&index, bits);
+    return static_cast<std::uint32_t>(index);
+    #elif defined __GNUC__ || defined __clang__
+    return static_cast<std::uint32_t>(__builtin_ctzll(bits));
+    #else
+    std::uint32_t index = 0;
+    while ((bits & 1) == 0)
+    {
+        bits >>= 1;
+        ++index;
+    }
+    return index;
+    #endif
+}
+
+/*
+Maps the specified size to its TLSF size class: The first-level index denotes the power of two and the second-level index
+linearly subdivides that range into 'slCount' classes. Sizes below 'slCount' are mapped to first-level index 0.
+*/
+static void MapSizeToIndices(VkDeviceSize size, std::uint32_t& fl, std::uint32_t& sl)
+{
+    if (size < VKDeviceMemory::slCount)
+    {
+        fl = 0;
+        sl = static_cast<std::uint32_t>(size);
+    }
+    else
+    {
+        const std::uint32_t msb = FindMSB(size);
+        fl = msb - VKDeviceMemory::slCountLog2 + 1;
+        sl = static_cast<std::uint32_t>(size >> (msb - VKDeviceMemory::slCountLog2)) - VKDeviceMemory::slCount;
+    }
+}
+
+// Maps the specified size to the lowest TLSF size class whose regions are all at least as large as the specified size.
+static void MapSizeToSearchIndices(VkDeviceSize size, std::uint32_t& fl, std::uint32_t& sl)
+{
+    if (size >= VKDeviceMemory::slCount)
+        size += (VkDeviceSize(1) << (FindMSB(size) - VKDeviceMemory::slCountLog2)) - 1;
+    MapSizeToIndices(size, fl, sl);
+}
+
+// Returns true if the specified region can hold a sub-region of the specified size and alignment.
+static bool IsRegionFit(const VKDeviceMemoryRegion* region, VkDeviceSize alignedSize, VkDeviceSize alignment)
+{
+    return (GetAlignedSize(region->GetOffset(), alignment) + alignedSize <= region->GetOffsetWithSize());
+}
+
+VKDeviceMemory::VKDeviceMemory(
+    VkDevice                                device,
+    VkDeviceSize                            size,
+    std::uint32_t                           memoryTypeIndex,
+    bool                                    transient,
+    const VkMemoryDedicatedAllocateInfoKHR* dedicatedInfo)
+:
+    deviceMemory_    { device, vkFreeMemory    },
+    size_            { size                    },
+    memoryTypeIndex_ { memoryTypeIndex         },
+    transient_       { transient               },
+    dedicated_       { dedicatedInfo != nullptr },
+    device_          { device                   }
+{
+    /* Buffers can only query their device address if their memory was allocated with this flag (see VK_KHR_buffer_device_address) */
+    VkMemoryAllocateFlagsInfo flagsInfo;
+    const bool deviceAddress = HasExtension(VKExt::KHR_buffer_device_address);
+    if (deviceAddress)
+    {
+        flagsInfo.sType             = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO;
+        flagsInfo.pNext             = dedicatedInfo;
+        flagsInfo.flags             = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT;
+        flagsInfo.deviceMask        = 0;
+    }
+
     /* Allocate device memory */
     VkMemoryAllocateInfo allocInfo;
     {
         allocInfo.sType             = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-        allocInfo.pNext             = nullptr;
+        allocInfo.pNext             = (deviceAddress ? static_cast<const void*>(&flagsInfo) : dedicatedInfo);
         allocInfo.allocationSize    = size;
         allocInfo.memoryTypeIndex   = memoryTypeIndex;
     }
@@ -37,95 +136,197 @@ VKDeviceMemory::VKDeviceMemory(VkDevice device, VkDeviceSize size, std::uint32_t
         std::string info = "failed to allocate Vulkan device memory of " + std::to_string(size) + " bytes";
         VKThrowIfFailed(result, info.c_str());
     }
+
+    if (!transient_)
+    {
+        /* Allocate free lists for all size classes up to the chunk size */
+        std::uint32_t fl = 0, sl = 0;
+        MapSizeToIndices(size, fl, sl);
+        flCount_ = fl + 1;
+        slBitmasks_.resize(flCount_, 0u);
+        freeLists_.resize(flCount_ * slCount, nullptr);
+
+        /* Start with a single free region that spans the entire chunk */
+        firstRegion_ = AcquireRegion(size, 0);
+        InsertFreeRegion(firstRegion_);
+    }
 }
 
-void* VKDeviceMemory::Map(VkDevice device, VkDeviceSize offset, VkDeviceSize size)
+void* VKDeviceMemory::Map(VkDevice device, VkDeviceSize offset, VkDeviceSize /*size*/)
 {
-    void* data = nullptr;
-
-    VkResult result = vkMapMemory(device, deviceMemory_, offset, size, 0, &data);
-    VKThrowIfFailed(result, "failed to map Vulkan buffer into CPU memory space");
-
-    return data;
+    if (numMappings_ == 0)
+    {
+        VkResult result = vkMapMemory(device, deviceMemory_, 0, VK_WHOLE_SIZE, 0, &mappedData_);
+        VKThrowIfFailed(result, "failed to map Vulkan buffer into CPU memory space");
+    }
+    ++numMappings_;
+    return (static_cast<char*>(mappedData_) + offset);
 }
 
 void VKDeviceMemory::Unmap(VkDevice device)
 {
-    vkUnmapMemory(device, deviceMemory_);
+    if (numMappings_ > 0 && --numMappings_ == 0)
+    {
+        vkUnmapMemory(device, deviceMemory_);
+        mappedData_ = nullptr;
+    }
 }
 
 VKDeviceMemoryRegion* VKDeviceMemory::Allocate(VkDeviceSize size, VkDeviceSize alignment, bool reduceFragmentation)
 {
     if (size > 0 && alignment > 0)
     {
-        /* Adjust size and offset by alignment */
-        VkDeviceSize alignedSize    = GetAlignedSize(size, alignment);
-        VkDeviceSize alignedOffset  = GetAlignedSize(GetNextOffset(), alignment);
-
-        if (reduceFragmentation)
-        {
-            /* Reuse fragmented block */
-            if (alignedSize <= maxFragmentedBlockSize_)
-                return FindReusableBlock(alignedSize, alignment);
-
-            /* Allocate block with aligned size and offset */
-            if (alignedSize + alignedOffset <= GetSize())
-                return AllocAndAppendBlock(alignedSize, alignedOffset);
-        }
+        const VkDeviceSize alignedSize = GetAlignedSize(size, alignment);
+        if (transient_)
+            return AllocateLinear(alignedSize, alignment);
         else
-        {
-            /* Allocate block with aligned size and offset */
-            if (alignedSize + alignedOffset <= GetSize())
-                return AllocAndAppendBlock(alignedSize, alignedOffset);
-
-            /* Reuse fragmented block */
-            if (alignedSize <= maxFragmentedBlockSize_)
-                return FindReusableBlock(alignedSize, alignment);
-        }
+            return AllocateTLSF(alignedSize, alignment, reduceFragmentation);
     }
     return nullptr;
 }
 
 void VKDeviceMemory::Release(VKDeviceMemoryRegion* region)
 {
-    if (region)
-    {
-        /* Increase maximal size of fragmented blocks */
-        IncMaxFragmentedBlockSize(region->GetSize());
+    if (region == nullptr || region->GetParentChunk() != this || region->IsFree())
+        return;
 
-        auto it = std::find_if(
-            blocks_.begin(), blocks_.end(),
-            [region](const std::unique_ptr<VKDeviceMemoryRegion>& entry)
+    LLGL_ASSERT(numAllocatedRegions_ > 0);
+    --numAllocatedRegions_;
+    allocatedSize_ -= region->GetSize();
+
+    SetRegionOwner(region, nullptr);
+
+    if (transient_)
+    {
+        /* Reset linear allocator once all regions have been released */
+        ReturnRegion(region);
+        if (numAllocatedRegions_ == 0)
+            linearOffset_ = 0;
+    }
+    else
+    {
+        /* Merge region with its free upper neighbor: [REGION][UPPER] --> [++REGION+++] */
+        if (VKDeviceMemoryRegion* upper = region->nextPhysical_)
+        {
+            if (upper->IsFree())
             {
-                return (entry.get() == region);
+                RemoveFreeRegion(upper);
+                MergeIntoPrevPhysical(upper);
             }
-        );
+        }
 
-        if (it != blocks_.end())
+        /* Merge region into its free lower neighbor: [LOWER][REGION] --> [+++LOWER++++] */
+        if (VKDeviceMemoryRegion* lower = region->prevPhysical_)
         {
-            InsertBlockToFragmentsSorted(std::move(*it));
-            blocks_.erase(it);
+            if (lower->IsFree())
+            {
+                RemoveFreeRegion(lower);
+                MergeIntoPrevPhysical(region);
+                region = lower;
+            }
         }
+
+        InsertFreeRegion(region);
     }
 }
 
 bool VKDeviceMemory::IsEmpty() const
 {
-    return blocks_.empty();
+    return (numAllocatedRegions_ == 0);
+}
+
+void VKDeviceMemory::SetRegionOwner(VKDeviceMemoryRegion* region, VKDeviceBuffer* owner)
+{
+    LLGL_ASSERT(region != nullptr && region->GetParentChunk() == this && !region->IsFree());
+
+    /* Keep track of the number of relocatable regions, so the memory manager can find defragmentation candidates quickly */
+    if (region->owner_ != nullptr)
+        --numRelocatableRegions_;
+    if (owner != nullptr)
+        ++numRelocatableRegions_;
+
+    region->owner_ = owner;
+}
+
+void VKDeviceMemory::SetRegionResidency(VKDeviceMemoryRegion* region, float priority, bool evicted)
+{
+    LLGL_ASSERT(region != nullptr && region->GetParentChunk() == this && !region->IsFree());
+
+    region->priority_   = priority;
+    region->evicted_    = evicted;
+
+    if (transient_ || !HasExtension(VKExt::EXT_pageable_device_local_memory))
+        return;
+
+    /* Keep the entire chunk resident with the highest priority of its allocated regions */
+    float chunkPriority = 0.0f;
+    for (VKDeviceMemoryRegion* neighbor = firstRegion_; neighbor != nullptr; neighbor = neighbor->nextPhysical_)
+    {
+        if (!neighbor->IsFree() && !neighbor->IsEvicted())
+            chunkPriority = std::max(chunkPriority, neighbor->GetPriority());
+    }
+
+    if (priority_ != chunkPriority)
+    {
+        vkSetDeviceMemoryPriorityEXT(device_, deviceMemory_, chunkPriority);
+        priority_ = chunkPriority;
+    }
+}
+
+void VKDeviceMemory::CollectRelocatableRegions(std::vector<VKDeviceMemoryRegion*>& outRegions) const
+{
+    if (numRelocatableRegions_ == 0 || transient_)
+        return;
+
+    for (VKDeviceMemoryRegion* region = firstRegion_; region != nullptr; region = region->nextPhysical_)
+    {
+        if (region->GetOwner() != nullptr)
+            outRegions.push_back(region);
+    }
 }
 
-VkDeviceSize VKDeviceMemory::GetMaxAllocationSize() const
+bool VKDeviceMemory::CanAllocate(VkDeviceSize size, VkDeviceSize alignment) const
 {
-    return std::max(maxNewBlockSize_, maxFragmentedBlockSize_);
+    if (size > 0 && alignment > 0)
+    {
+        const VkDeviceSize alignedSize = GetAlignedSize(size, alignment);
+        if (transient_)
+            return (GetAlignedSize(linearOffset_, alignment) + alignedSize <= GetSize());
+        else
+            return (FindFreeRegion(alignedSize, alignment, false) != nullptr);
+    }
+    return false;
 }
 
 void VKDeviceMemory::AccumDetails(VKDeviceMemoryDetails& details) const
 {
-    details.numChunks               += 1;
-    details.numBlocks               += blocks_.size();
-    details.numFragments            += fragmentedBlocks_.size();
-    details.maxNewBlockSize         = std::max(details.maxNewBlockSize, maxNewBlockSize_);
-    details.maxFragmentedBlockSize  = std::max(details.maxFragmentedBlockSize, maxFragmentedBlockSize_);
+    details.numChunks   += 1;
+    details.numBlocks   += numAllocatedRegions_;
+    details.totalSize   += GetSize();
+    details.usedSize    += allocatedSize_;
+
+    if (transient_)
+    {
+        details.numTransientChunks  += 1;
+        details.maxNewBlockSize     = std::max(details.maxNewBlockSize, GetSize() - linearOffset_);
+    }
+    else
+    {
+        /* Free regions are always merged, so only the last region can be a free region behind all allocated regions */
+        for (const VKDeviceMemoryRegion* region = firstRegion_; region != nullptr; region = region->nextPhysical_)
+        {
+            if (!region->IsFree())
+                continue;
+
+            if (region->nextPhysical_ == nullptr)
+                details.maxNewBlockSize = std::max(details.maxNewBlockSize, region->GetSize());
+            else
+            {
+                details.numFragments            += 1;
+                details.maxFragmentedBlockSize  = std::max(details.maxFragmentedBlockSize, region->GetSize());
+            }
+        }
+    }
 }
 
 #ifdef LLGL_DEBUG
@@ -181,20 +382,26 @@ static void PrintDeviceMemoryRegion(std::ostream& s, VKDeviceMemoryRegion& regio
 void VKDeviceMemory::PrintBlocks(std::ostream& s) const
 {
     VKDeviceMemoryRegion* prevBlock = nullptr;
-    for (const auto& block : blocks_)
+    for (VKDeviceMemoryRegion* block = firstRegion_; block != nullptr; block = block->nextPhysical_)
     {
-        PrintDeviceMemoryRegion(s, *block, prevBlock);
-        prevBlock = block.get();
+        if (!block->IsFree())
+        {
+            PrintDeviceMemoryRegion(s, *block, prevBlock);
+            prevBlock = block;
+        }
     }
 }
 
 void VKDeviceMemory::PrintFragmentedBlocks(std::ostream& s) const
 {
     VKDeviceMemoryRegion* prevBlock = nullptr;
-    for (const auto& block : fragmentedBlocks_)
+    for (VKDeviceMemoryRegion* block = firstRegion_; block != nullptr; block = block->nextPhysical_)
     {
-        PrintDeviceMemoryRegion(s, *block, prevBlock);
-        prevBlock = block.get();
+        if (block->IsFree())
+        {
+            PrintDeviceMemoryRegion(s, *block, prevBlock);
+            prevBlock = block;
+        }
     }
 }
 
@@ -205,259 +412,241 @@ void VKDeviceMemory::PrintFragmentedBlocks(std::ostream& s) const
  * ======= Private: =======
  */
 
-VkDeviceSize VKDeviceMemory::GetNextOffset() const
+VKDeviceMemoryRegion* VKDeviceMemory::AcquireRegion(VkDeviceSize alignedSize, VkDeviceSize alignedOffset)
 {
-    if (blocks_.empty())
-        return 0;
+    VKDeviceMemoryRegion* region = nullptr;
+
+    if (!unusedRegions_.empty())
+    {
+        /* Recycle region object from pool */
+        region = unusedRegions_.back();
+        unusedRegions_.pop_back();
+        region->MoveAt(alignedSize, alignedOffset);
+    }
     else
-        return blocks_.back()->GetOffsetWithSize();
+    {
+        /* Allocate new region object */
+        regionPool_.push_back(MakeUnique<VKDeviceMemoryRegion>(this, alignedSize, alignedOffset, memoryTypeIndex_));
+        region = regionPool_.back().get();
+    }
+
+    region->isFree_         = false;
+    region->owner_          = nullptr;
+    region->priority_       = 0.5f;
+    region->evicted_        = false;
+    region->prevPhysical_   = nullptr;
+    region->nextPhysical_   = nullptr;
+    region->prevFree_       = nullptr;
+    region->nextFree_       = nullptr;
+
+    return region;
 }
 
-std::unique_ptr<VKDeviceMemoryRegion> VKDeviceMemory::MakeUniqueBlock(VkDeviceSize alignedSize, VkDeviceSize alignedOffset)
+void VKDeviceMemory::ReturnRegion(VKDeviceMemoryRegion* region)
 {
-    return MakeUnique<VKDeviceMemoryRegion>(this, alignedSize, alignedOffset, memoryTypeIndex_);
+    unusedRegions_.push_back(region);
 }
 
-VKDeviceMemoryRegion* VKDeviceMemory::AllocAndAppendBlock(VkDeviceSize alignedSize, VkDeviceSize alignedOffset)
+VKDeviceMemoryRegion*& VKDeviceMemory::GetFreeList(std::uint32_t fl, std::uint32_t sl)
 {
-    /* Update maximal free block size */
-    maxNewBlockSize_ = GetSize() - (alignedSize + alignedOffset);
+    return freeLists_[fl * slCount + sl];
+}
 
-    /* Check if the aligned offset results in a new fragment */
-    const VkDeviceSize nextOffset = GetNextOffset();
+void VKDeviceMemory::InsertFreeRegion(VKDeviceMemoryRegion* region)
+{
+    std::uint32_t fl = 0, sl = 0;
+    MapSizeToIndices(region->GetSize(), fl, sl);
+    LLGL_ASSERT(fl < flCount_);
+
+    /* Insert region at the front of its free list and mark the list as non-empty */
+    VKDeviceMemoryRegion*& head = GetFreeList(fl, sl);
+    region->isFree_     = true;
+    region->prevFree_   = nullptr;
+    region->nextFree_   = head;
+    if (head != nullptr)
+        head->prevFree_ = region;
+    head = region;
+
+    flBitmask_      |= (std::uint64_t(1) << fl);
+    slBitmasks_[fl] |= (1u << sl);
+}
 
-    if (nextOffset < alignedOffset)
-    {
-        /*
-        Check if new fragment can be immediately merged with previous fragment:
-        Before: blocks:    [++]........[++++]
-                fragments: ....[++++]
-        After:  blocks:    [++]........[++++]
-                fragments: ....[++++++]
-        */
-        if (!fragmentedBlocks_.empty() && fragmentedBlocks_.back()->GetOffset() == nextOffset)
-        {
-            /* Resize last fragmented block (can also get smaller) */
-            const VkDeviceSize size = fragmentedBlocks_.back()->GetSize();
-            fragmentedBlocks_.back()->MoveAt(alignedOffset - nextOffset, nextOffset);
-            DecMaxFragmentedBlockSize(size);
-        }
-        else
-        {
-            /* Append new fragmented block at the end */
-            fragmentedBlocks_.push_back(MakeUniqueBlock(alignedOffset - nextOffset, nextOffset));
-        }
+void VKDeviceMemory::RemoveFreeRegion(VKDeviceMemoryRegion* region)
+{
+    std::uint32_t fl = 0, sl = 0;
+    MapSizeToIndices(region->GetSize(), fl, sl);
 
-        /* Track largest fragmented block size */
-        IncMaxFragmentedBlockSize(fragmentedBlocks_.back()->GetSize());
-    }
+    /* Unlink region from its free list and mark the list as empty if this was its only region */
+    if (region->prevFree_ != nullptr)
+        region->prevFree_->nextFree_ = region->nextFree_;
     else
     {
-        /* Check if last fragmented block can be replaced by new block */
-        if (!fragmentedBlocks_.empty() && fragmentedBlocks_.back()->GetOffset() == nextOffset)
+        VKDeviceMemoryRegion*& head = GetFreeList(fl, sl);
+        head = region->nextFree_;
+        if (head == nullptr)
         {
-            /* Move fragmented block into main blocks and resize it */
-            VKDeviceMemoryRegion* block = TakeOwnership(blocks_, PopBackFragmentedBlock());
-            block->MoveAt(alignedSize, alignedOffset);
-            return block;
+            slBitmasks_[fl] &= ~(1u << sl);
+            if (slBitmasks_[fl] == 0)
+                flBitmask_ &= ~(std::uint64_t(1) << fl);
         }
     }
 
-    /* Allocate new block */
-    return TakeOwnership(blocks_, MakeUniqueBlock(alignedSize, alignedOffset));
+    if (region->nextFree_ != nullptr)
+        region->nextFree_->prevFree_ = region->prevFree_;
+
+    region->isFree_     = false;
+    region->prevFree_   = nullptr;
+    region->nextFree_   = nullptr;
 }
 
-VKDeviceMemoryRegion* VKDeviceMemory::InsertBlock(std::unique_ptr<VKDeviceMemoryRegion>&& region)
+VKDeviceMemoryRegion* VKDeviceMemory::FindFreeRegion(VkDeviceSize alignedSize, VkDeviceSize alignment, bool reduceFragmentation) const
 {
-    VKDeviceMemoryRegion* regionRef = region.get();
+    std::uint32_t fl = 0, sl = 0;
 
-    /* Add block by insertion sort */
-    if (!blocks_.empty())
+    if (reduceFragmentation)
     {
-        for (auto it = blocks_.rbegin(); it != blocks_.rend(); ++it)
+        /* Search free list of the exact size class for a tighter fit; its regions are not guaranteed to be large enough */
+        MapSizeToIndices(alignedSize, fl, sl);
+        if (fl < flCount_)
         {
-            if ((*it)->GetOffset() < region->GetOffset())
+            for (VKDeviceMemoryRegion* region = freeLists_[fl * slCount + sl]; region != nullptr; region = region->nextFree_)
             {
-                blocks_.insert(it.base(), std::move(region));
-                break;
+                if (IsRegionFit(region, alignedSize, alignment))
+                    return region;
             }
         }
     }
-    else
-        blocks_.emplace_back(std::move(region));
-
-    return regionRef;
-}
-
-VKDeviceMemoryRegion* VKDeviceMemory::FindReusableBlock(VkDeviceSize alignedSize, VkDeviceSize alignment)
-{
-    VKDeviceMemoryRegion* prevBlock = nullptr;
-    VKDeviceMemoryRegion* nextBlock = nullptr;
 
-    /* Search for fragmented block that fits the requirement */
-    for (auto it = fragmentedBlocks_.begin(); it != fragmentedBlocks_.end(); ++it)
+    /* Select first region of the next size class that is guaranteed to be large enough; the offset might still need padding for alignment */
+    MapSizeToSearchIndices(alignedSize, fl, sl);
+    if (VKDeviceMemoryRegion* region = FindFreeListAtOrAbove(fl, sl))
     {
-        VKDeviceMemoryRegion* block = it->get();
-
-        /* Check if required size plus the additional aligned offset fits into the current block */
-        const VkDeviceSize alignedOffset = GetAlignedSize(block->GetOffset(), alignment);
-        if (alignedSize + alignedOffset - block->GetOffset() <= block->GetSize())
-        {
-            /* If this block has the maximum fragmented block size, this value must be updated */
-            const bool isLargestFragmentedBlock = (block->GetSize() == maxFragmentedBlockSize_);
-
-            /* If block can be reused with its entire size, it can be removed from the fragmented blocks */
-            InsertBlock(std::move(*it));
-
-            it = fragmentedBlocks_.erase(it);
-            if (it != fragmentedBlocks_.end())
-                nextBlock = it->get();
-
-            /* Check if block must be split up at the lower part */
-            if (block->GetOffset() < alignedOffset)
-            {
-                /* Allocate fragmented lower block (left to the current block) */
-                std::unique_ptr<VKDeviceMemoryRegion> blockLower = MakeUniqueBlock(alignedOffset - block->GetOffset(), block->GetOffset());
-
-                if (!prevBlock || !MergeFragmentedBlockWith(*prevBlock, *blockLower))
-                {
-                    it = fragmentedBlocks_.insert(it, std::move(blockLower));
-                    ++it;
-                }
-            }
-
-            /* Check if block must be split up at the upper part */
-            const VkDeviceSize alignedSizeWithOffset = alignedSize + alignedOffset - block->GetOffset();
-            if (alignedSizeWithOffset < block->GetSize())
-            {
-                /* Allocate fragmented upper block (right to the current block) */
-                const VkDeviceSize blockUpperSize = block->GetSize() - alignedSizeWithOffset;
-                std::unique_ptr<VKDeviceMemoryRegion> blockUpper = MakeUniqueBlock(blockUpperSize, block->GetOffsetWithSize() - blockUpperSize);
-
-                if (!nextBlock || !MergeFragmentedBlockWith(*blockUpper, *nextBlock))
-                    fragmentedBlocks_.insert(it, std::move(blockUpper));
-            }
-
-            /* Move reused block to new offset and size */
-            block->MoveAt(alignedSize, alignedOffset);
-
-            if (isLargestFragmentedBlock)
-                UpdateMaxFragmentedBlockSize();
-
-            /* Reuse current block */
-            return block;
-        }
+        if (IsRegionFit(region, alignedSize, alignment))
+            return region;
+    }
 
-        prevBlock = block;
+    /* Select first region of the next size class that is guaranteed to be large enough including the worst case padding */
+    if (alignment > 1)
+    {
+        MapSizeToSearchIndices(alignedSize + alignment - 1, fl, sl);
+        return FindFreeListAtOrAbove(fl, sl);
     }
 
-    /* No reusable block found */
     return nullptr;
 }
 
-void VKDeviceMemory::UpdateMaxFragmentedBlockSize()
-{
-    maxFragmentedBlockSize_ = 0;
-    for (const auto& block : fragmentedBlocks_)
-        IncMaxFragmentedBlockSize(block->GetSize());
-}
-
-void VKDeviceMemory::InsertBlockToFragmentsSorted(std::unique_ptr<VKDeviceMemoryRegion>&& region)
+VKDeviceMemoryRegion* VKDeviceMemory::FindFreeListAtOrAbove(std::uint32_t fl, std::uint32_t sl) const
 {
-    VkDeviceSize offset = region->GetOffset();
-    std::size_t count = fragmentedBlocks_.size();
+    if (fl >= flCount_)
+        return nullptr;
 
-    /* Start serach in half-open range [begin, end) */
-    std::size_t begin = 0, end = count;
+    /* Search for non-empty free list in the same first-level class */
+    std::uint32_t slBitmask = slBitmasks_[fl] & (~0u << sl);
 
-    while (begin + 2 < end)
+    if (slBitmask == 0)
     {
-        /* Check if region's offset is before or after the middle's element */
-        std::size_t center = (begin + end) / 2;
+        /* Search for non-empty free list in the next larger first-level classes */
+        const std::uint64_t flBitmask = (fl + 1 < 64 ? flBitmask_ & (~std::uint64_t(0) << (fl + 1)) : 0);
+        if (flBitmask == 0)
+            return nullptr;
 
-        if (offset < fragmentedBlocks_[center]->GetOffset())
-        {
-            /* Restrict search to lower half */
-            end = center + 1;
-        }
-        else
-        {
-            /* Restrict search to upper half */
-            begin = center;
-        }
+        fl          = FindLSB(flBitmask);
+        slBitmask   = slBitmasks_[fl];
     }
 
-    /* Insert region by insertion-sort of the remaining half-open range [begin, begin + 2) */
-    if (begin < count && offset < fragmentedBlocks_[begin]->GetOffset())
-        InsertBlockToFragmentsAt(std::move(region), begin);
-    else if (begin + 1 < count)
-    {
-        if (offset < fragmentedBlocks_[begin + 1]->GetOffset())
-            InsertBlockToFragmentsAt(std::move(region), begin + 1);
-        else
-            InsertBlockToFragmentsAt(std::move(region), begin + 2);
-    }
-    else
-        InsertBlockToFragmentsAt(std::move(region), count);
+    sl = FindLSB(slBitmask);
+
+    return freeLists_[fl * slCount + sl];
 }
 
-void VKDeviceMemory::InsertBlockToFragmentsAt(std::unique_ptr<VKDeviceMemoryRegion>&& region, std::size_t position)
+void VKDeviceMemory::SplitFreeRegion(VKDeviceMemoryRegion* region, VkDeviceSize alignedSize, VkDeviceSize alignedOffset)
 {
-    std::size_t count = fragmentedBlocks_.size();
-
-    /* Try to merge region into lower part: [LOWER][BLOCK] --> [+++LOWER++++] */
-    if (position > 0 && MergeFragmentedBlockWith(*fragmentedBlocks_[position - 1], *region))
+    /* Split off lower part for alignment padding: [LOWER][REGION+++] */
+    if (region->GetOffset() < alignedOffset)
     {
-        /* Try to merge upper part into lower part: [+++LOWER++++][UPPER] --> [+++++++LOWER+++++++] */
-        if (position < count && MergeFragmentedBlockWith(*fragmentedBlocks_[position - 1], *fragmentedBlocks_[position]))
-        {
-            /* Remove previous upper part after two-phase-merge */
-            const VkDeviceSize size = fragmentedBlocks_[position]->GetSize();
-            fragmentedBlocks_.erase(fragmentedBlocks_.begin() + position);
-            DecMaxFragmentedBlockSize(size);
-        }
+        const VkDeviceSize paddingSize = alignedOffset - region->GetOffset();
+        VKDeviceMemoryRegion* lower = AcquireRegion(paddingSize, region->GetOffset());
+        LinkPhysicalBefore(region, lower);
+        InsertFreeRegion(lower);
+        region->MoveAt(region->GetSize() - paddingSize, alignedOffset);
     }
-    /* Try to merge region into upper part: [BLOCK][UPPER] --> [+++UPPER++++] */
-    else if (position >= count || !MergeFragmentedBlockWith(*fragmentedBlocks_[position], *region))
+
+    /* Split off upper part that is not needed: [REGION][UPPER] */
+    if (region->GetSize() > alignedSize)
     {
-        /* Insert new fragmented block: [LOWER]..[BLOCK]..[UPPER] */
-        IncMaxFragmentedBlockSize(region->GetSize());
-        fragmentedBlocks_.insert(fragmentedBlocks_.begin() + position, std::move(region));
+        VKDeviceMemoryRegion* upper = AcquireRegion(region->GetSize() - alignedSize, alignedOffset + alignedSize);
+        LinkPhysicalAfter(region, upper);
+        InsertFreeRegion(upper);
+        region->MoveAt(alignedSize, alignedOffset);
     }
 }
 
-std::unique_ptr<VKDeviceMemoryRegion> VKDeviceMemory::PopBackFragmentedBlock()
+void VKDeviceMemory::LinkPhysicalBefore(VKDeviceMemoryRegion* region, VKDeviceMemoryRegion* newRegion)
 {
-    std::unique_ptr<VKDeviceMemoryRegion> block = std::move(fragmentedBlocks_.back());
-    fragmentedBlocks_.pop_back();
-    DecMaxFragmentedBlockSize(block->GetSize());
-    return block;
+    newRegion->prevPhysical_ = region->prevPhysical_;
+    newRegion->nextPhysical_ = region;
+
+    if (region->prevPhysical_ != nullptr)
+        region->prevPhysical_->nextPhysical_ = newRegion;
+    else
+        firstRegion_ = newRegion;
+
+    region->prevPhysical_ = newRegion;
 }
 
-bool VKDeviceMemory::MergeFragmentedBlockWith(VKDeviceMemoryRegion& region, VKDeviceMemoryRegion& appendixRegion)
+void VKDeviceMemory::LinkPhysicalAfter(VKDeviceMemoryRegion* region, VKDeviceMemoryRegion* newRegion)
 {
-    if (region.MergeWith(appendixRegion))
-    {
-        IncMaxFragmentedBlockSize(region.GetSize());
-        return true;
-    }
-    return false;
+    newRegion->prevPhysical_ = region;
+    newRegion->nextPhysical_ = region->nextPhysical_;
+
+    if (region->nextPhysical_ != nullptr)
+        region->nextPhysical_->prevPhysical_ = newRegion;
+
+    region->nextPhysical_ = newRegion;
 }
 
-VkDeviceSize VKDeviceMemory::GetFragmentBlockOffsetEnd(std::size_t position) const
+void VKDeviceMemory::MergeIntoPrevPhysical(VKDeviceMemoryRegion* region)
 {
-    return fragmentedBlocks_[position]->GetOffsetWithSize();
+    VKDeviceMemoryRegion* lower = region->prevPhysical_;
+    LLGL_ASSERT_PTR(lower);
+
+    lower->MoveAt(lower->GetSize() + region->GetSize(), lower->GetOffset());
+    lower->nextPhysical_ = region->nextPhysical_;
+
+    if (region->nextPhysical_ != nullptr)
+        region->nextPhysical_->prevPhysical_ = lower;
+
+    ReturnRegion(region);
 }
 
-void VKDeviceMemory::IncMaxFragmentedBlockSize(VkDeviceSize size)
+VKDeviceMemoryRegion* VKDeviceMemory::AllocateTLSF(VkDeviceSize alignedSize, VkDeviceSize alignment, bool reduceFragmentation)
 {
-    maxFragmentedBlockSize_ = std::max(maxFragmentedBlockSize_, size);
+    VKDeviceMemoryRegion* region = FindFreeRegion(alignedSize, alignment, reduceFragmentation);
+    if (region == nullptr)
+        return nullptr;
+
+    /* Take region out of its free list and give back the parts that are not needed */
+    RemoveFreeRegion(region);
+    SplitFreeRegion(region, alignedSize, GetAlignedSize(region->GetOffset(), alignment));
+
+    ++numAllocatedRegions_;
+    allocatedSize_ += region->GetSize();
+
+    return region;
 }
 
-void VKDeviceMemory::DecMaxFragmentedBlockSize(VkDeviceSize size)
+VKDeviceMemoryRegion* VKDeviceMemory::AllocateLinear(VkDeviceSize alignedSize, VkDeviceSize alignment)
 {
-    if (size == maxFragmentedBlockSize_)
-        UpdateMaxFragmentedBlockSize();
+    const VkDeviceSize alignedOffset = GetAlignedSize(linearOffset_, alignment);
+    if (alignedOffset + alignedSize > GetSize())
+        return nullptr;
+
+    linearOffset_ = alignedOffset + alignedSize;
+
+    ++numAllocatedRegions_;
+    allocatedSize_ += alignedSize;
+
+    return AcquireRegion(alignedSize, alignedOffset);
 }
 
 
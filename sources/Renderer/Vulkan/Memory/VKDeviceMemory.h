@@ -29,30 +29,57 @@ namespace LLGL
 struct VKDeviceMemoryDetails
 {
     std::size_t     numChunks               = 0;
-    std::size_t     numBlocks               = 0;
-    std::size_t     numFragments            = 0;
-    VkDeviceSize    maxNewBlockSize         = 0;
-    VkDeviceSize    maxFragmentedBlockSize  = 0;
+    std::size_t     numTransientChunks      = 0;    // Number of chunks with linear allocation, see VKDeviceMemoryManager::AllocateTransient.
+    std::size_t     numBlocks               = 0;    // Number of allocated regions.
+    std::size_t     numFragments            = 0;    // Number of free regions in front of the last allocated region of each chunk.
+    VkDeviceSize    totalSize               = 0;    // Accumulated size of all chunks.
+    VkDeviceSize    usedSize                = 0;    // Accumulated size of all allocated regions.
+    VkDeviceSize    maxNewBlockSize         = 0;    // Largest free region behind the last allocated region of each chunk.
+    VkDeviceSize    maxFragmentedBlockSize  = 0;    // Largest free region in front of the last allocated region of each chunk.
 };
 
-// An instance of this class holds a single VkDeviceMemory allocation chunk.
+/*
+An instance of this class holds a single VkDeviceMemory allocation chunk.
+Regions are sub-allocated with a two-level segregated fit (TLSF) allocator:
+free regions are stored in free lists that are segregated by size classes, and two levels of bitmasks denote the non-empty lists.
+This allows to allocate and release regions in constant time, and adjacent free regions are merged immediately on release.
+Transient chunks use linear allocation instead and are reset once all of their regions have been released.
+*/
 class VKDeviceMemory
 {
 
     public:
 
-        VKDeviceMemory(VkDevice device, VkDeviceSize size, std::uint32_t memoryTypeIndex);
+        /*
+        Allocates a new VkDeviceMemory chunk. If 'dedicatedInfo' is non-null, it is chained into the allocation info (see VK_KHR_dedicated_allocation)
+        and the chunk must only hold a single region for the buffer or image specified by that structure.
+        */
+        VKDeviceMemory(
+            VkDevice                                    device,
+            VkDeviceSize                                size,
+            std::uint32_t                               memoryTypeIndex,
+            bool                                        transient       = false,
+            const VkMemoryDedicatedAllocateInfoKHR*     dedicatedInfo   = nullptr
+        );
 
         VKDeviceMemory(const VKDeviceMemory&) = delete;
         VKDeviceMemory& operator = (const VKDeviceMemory&) = delete;
 
-        VKDeviceMemory(VKDeviceMemory&&) = default;
-        VKDeviceMemory& operator = (VKDeviceMemory&&) = default;
-
+        /*
+        Maps the specified range of this device memory chunk into CPU memory space.
+        The entire chunk is mapped only once and reference counted, because a VkDeviceMemory object must not be mapped multiple times,
+        e.g. when a persistently mapped buffer shares its chunk with other buffers that are mapped temporarily (see MiscFlags::PersistentMapping).
+        */
         void* Map(VkDevice device, VkDeviceSize offset, VkDeviceSize size);
+
+        // Decrements the mapping reference counter and unmaps this chunk once it reaches zero.
         void Unmap(VkDevice device);
 
-        // Tries to allocate a new block within this device memory chunk, and returns null of failure.
+        /*
+        Tries to allocate a new block within this device memory chunk, and returns null of failure.
+        If 'reduceFragmentation' is true, the free list of the size class that matches the requested size is searched for a tighter fit,
+        before a region of the next larger size class is selected.
+        */
         VKDeviceMemoryRegion* Allocate(VkDeviceSize size, VkDeviceSize alignment, bool reduceFragmentation = false);
 
         // Releases the specified block within this device memory chunk.
@@ -61,8 +88,24 @@ class VKDeviceMemory
         // Returns true if this device memory has no more blocks.
         bool IsEmpty() const;
 
-        // Returns the maximal size that can be allocated for a device memory region within this device memory chunk.
-        VkDeviceSize GetMaxAllocationSize() const;
+        /*
+        Sets the buffer that owns the specified allocated region and can relocate it into another chunk during defragmentation.
+        Pass null to pin the region to this chunk. The owner is reset automatically when the region is released.
+        */
+        void SetRegionOwner(VKDeviceMemoryRegion* region, VKDeviceBuffer* owner);
+
+        /*
+        Sets the residency priority of the specified allocated region and whether it is evicted, i.e. its effective priority is zero.
+        The priority of the entire chunk is the highest effective priority among its allocated regions,
+        which is applied with VK_EXT_pageable_device_local_memory if that extension is enabled. Only the region is updated for transient chunks.
+        */
+        void SetRegionResidency(VKDeviceMemoryRegion* region, float priority, bool evicted);
+
+        // Appends all regions with an owner to the output container in order of their offsets.
+        void CollectRelocatableRegions(std::vector<VKDeviceMemoryRegion*>& outRegions) const;
+
+        // Returns true if a region of the specified size and alignment can be allocated within this device memory chunk.
+        bool CanAllocate(VkDeviceSize size, VkDeviceSize alignment) const;
 
         // Accumulates the memory details of this device memory into the output structure.
         void AccumDetails(VKDeviceMemoryDetails& details) const;
@@ -92,58 +135,102 @@ class VKDeviceMemory
             return memoryTypeIndex_;
         }
 
-    private:
+        // Returns the accumulated size of all allocated regions.
+        inline VkDeviceSize GetAllocatedSize() const
+        {
+            return allocatedSize_;
+        }
 
-        // Returns the next offset after the last block.
-        VkDeviceSize GetNextOffset() const;
+        // Returns the number of allocated regions that can be relocated during defragmentation.
+        inline std::size_t GetNumRelocatableRegions() const
+        {
+            return numRelocatableRegions_;
+        }
 
-        // Makes a new device memory block.
-        std::unique_ptr<VKDeviceMemoryRegion> MakeUniqueBlock(VkDeviceSize alignedSize, VkDeviceSize alignedOffset);
+        // Returns true if this is a transient device memory chunk with linear allocation.
+        inline bool IsTransient() const
+        {
+            return transient_;
+        }
+
+        // Returns true if this is a dedicated device memory chunk for a single buffer or image.
+        inline bool IsDedicated() const
+        {
+            return dedicated_;
+        }
 
-        // Allocates a new block.
-        VKDeviceMemoryRegion* AllocAndAppendBlock(VkDeviceSize alignedSize, VkDeviceSize alignedOffset);
+    public:
 
-        // Inserts the specified region into the main block list by insertion-sort.
-        VKDeviceMemoryRegion* InsertBlock(std::unique_ptr<VKDeviceMemoryRegion>&& region);
+        // Number of second-level size classes per first-level size class as power of two.
+        static constexpr std::uint32_t slCountLog2  = 4;
+        static constexpr std::uint32_t slCount      = (1u << slCountLog2);
 
-        // Tries to find a fragmented block that can be reused.
-        VKDeviceMemoryRegion* FindReusableBlock(VkDeviceSize alignedSize, VkDeviceSize alignment);
+    private:
 
-        // Updates the maximal size of fragmanted blocks.
-        void UpdateMaxFragmentedBlockSize();
+        // Returns a region object from the pool that is initialized with the specified size and offset.
+        VKDeviceMemoryRegion* AcquireRegion(VkDeviceSize alignedSize, VkDeviceSize alignedOffset);
 
-        // Inserts the specified region into the fragmented block list by insertion-sort.
-        void InsertBlockToFragmentsSorted(std::unique_ptr<VKDeviceMemoryRegion>&& region);
+        // Returns the specified region object back to the pool.
+        void ReturnRegion(VKDeviceMemoryRegion* region);
 
-        // Inserts the specified region into the fragmented block list at the specified position and merges it with surrounding blocks if possible.
-        void InsertBlockToFragmentsAt(std::unique_ptr<VKDeviceMemoryRegion>&& region, std::size_t position);
+        // Returns the free list head for the specified first- and second-level indices.
+        VKDeviceMemoryRegion*& GetFreeList(std::uint32_t fl, std::uint32_t sl);
 
-        // Pops the last block off the fragments blocks and returns it.
-        std::unique_ptr<VKDeviceMemoryRegion> PopBackFragmentedBlock();
+        // Inserts the specified region into the free list of its size class.
+        void InsertFreeRegion(VKDeviceMemoryRegion* region);
 
-        // Merges the two fragmented blocks and records the maximal fragmented block size.
-        bool MergeFragmentedBlockWith(VKDeviceMemoryRegion& region, VKDeviceMemoryRegion& appendixRegion);
+        // Removes the specified region from the free list of its size class.
+        void RemoveFreeRegion(VKDeviceMemoryRegion* region);
 
-        // Returns the offset after the specified fragmented block.
-        VkDeviceSize GetFragmentBlockOffsetEnd(std::size_t position) const;
+        // Returns a free region that can hold the specified size and alignment, or null if there is none.
+        VKDeviceMemoryRegion* FindFreeRegion(VkDeviceSize alignedSize, VkDeviceSize alignment, bool reduceFragmentation) const;
 
-        // Increases the maximal fragmented block size.
-        void IncMaxFragmentedBlockSize(VkDeviceSize size);
+        // Returns the head of the first non-empty free list with a size class at or above the specified indices, or null if there is none.
+        VKDeviceMemoryRegion* FindFreeListAtOrAbove(std::uint32_t fl, std::uint32_t sl) const;
 
-        // Updates the maximal fragmented block size if the input size equals the current maximum size.
-        void DecMaxFragmentedBlockSize(VkDeviceSize size);
+        // Splits off the part in front of the specified aligned offset and the part behind the specified size as free regions.
+        void SplitFreeRegion(VKDeviceMemoryRegion* region, VkDeviceSize alignedSize, VkDeviceSize alignedOffset);
+
+        // Inserts a new region in front of or behind the specified region into the list of physical neighbors.
+        void LinkPhysicalBefore(VKDeviceMemoryRegion* region, VKDeviceMemoryRegion* newRegion);
+        void LinkPhysicalAfter(VKDeviceMemoryRegion* region, VKDeviceMemoryRegion* newRegion);
+
+        // Merges the specified region into its lower physical neighbor and returns it to the pool.
+        void MergeIntoPrevPhysical(VKDeviceMemoryRegion* region);
+
+        VKDeviceMemoryRegion* AllocateTLSF(VkDeviceSize alignedSize, VkDeviceSize alignment, bool reduceFragmentation);
+        VKDeviceMemoryRegion* AllocateLinear(VkDeviceSize alignedSize, VkDeviceSize alignment);
 
     private:
 
         VKPtr<VkDeviceMemory>                               deviceMemory_;
         VkDeviceSize                                        size_                   = 0;
         std::uint32_t                                       memoryTypeIndex_        = 0;
-
-        VkDeviceSize                                        maxNewBlockSize_        = 0;
-        std::vector<std::unique_ptr<VKDeviceMemoryRegion>>  blocks_;
-
-        VkDeviceSize                                        maxFragmentedBlockSize_ = 0;
-        std::vector<std::unique_ptr<VKDeviceMemoryRegion>>  fragmentedBlocks_;
+        bool                                                transient_              = false;
+        bool                                                dedicated_              = false;
+        VkDevice                                            device_                 = VK_NULL_HANDLE;
+        float                                               priority_               = 0.5f;     // Current priority of the entire chunk.
+
+        void*                                               mappedData_             = nullptr;  // Mapped CPU memory space of the entire chunk.
+        std::size_t                                         numMappings_            = 0;        // Reference counter for Map/Unmap calls.
+
+        std::size_t                                         numAllocatedRegions_    = 0;
+        VkDeviceSize                                        allocatedSize_          = 0;
+        std::size_t                                         numRelocatableRegions_  = 0;
+
+        /* TLSF allocator */
+        VKDeviceMemoryRegion*                               firstRegion_            = nullptr;  // Lowest region in the list of physical neighbors.
+        std::uint32_t                                       flCount_                = 0;
+        std::uint64_t                                       flBitmask_              = 0;        // Bit N denotes a non-empty entry in 'slBitmasks_[N]'.
+        std::vector<std::uint32_t>                          slBitmasks_;                        // Bit M of entry N denotes a non-empty free list 'freeLists_[N*slCount + M]'.
+        std::vector<VKDeviceMemoryRegion*>                  freeLists_;
+
+        /* Linear allocator for transient chunks */
+        VkDeviceSize                                        linearOffset_           = 0;
+
+        /* Pool of region objects; regions owned by this chunk are recycled rather than deallocated */
+        std::vector<std::unique_ptr<VKDeviceMemoryRegion>>  regionPool_;
+        std::vector<VKDeviceMemoryRegion*>                  unusedRegions_;
 
 };
 
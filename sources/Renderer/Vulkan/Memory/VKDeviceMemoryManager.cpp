@@ -7,7 +7,15 @@
 
 #include "VKDeviceMemoryManager.h"
 #include "../VKCore.h"
+#include "../VKDevice.h"
+#include "../Buffer/VKDeviceBuffer.h"
+#include "../Ext/VKExtensions.h"
+#include "../Ext/VKExtensionRegistry.h"
 #include "../../ContainerTypes.h"
+#include "../../../Core/CoreUtils.h"
+#include <LLGL/RenderSystemFlags.h>
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
 
 
 namespace LLGL
@@ -15,18 +23,37 @@ namespace LLGL
 
 
 VKDeviceMemoryManager::VKDeviceMemoryManager(
-    VkDevice                                device,
+    VKDevice&                               device,
+    VkPhysicalDevice                        physicalDevice,
     const VkPhysicalDeviceMemoryProperties& memoryProperties,
-    VkDeviceSize                            minAllocationSize,
-    bool                                    reduceFragmentation)
+    const RendererConfigurationVulkan&      config)
 :
-    device_              { device              },
-    memoryProperties_    { memoryProperties    },
-    minAllocationSize_   { minAllocationSize   },
-    reduceFragmentation_ { reduceFragmentation }
+    device_                         { device                                 },
+    physicalDevice_                 { physicalDevice                         },
+    memoryProperties_               { memoryProperties                       },
+    minAllocationSize_              { config.minDeviceMemoryAllocationSize   },
+    reduceFragmentation_            { config.reduceDeviceMemoryFragmentation },
+    dedicatedAllocationThreshold_   { config.dedicatedAllocationThreshold    },
+    memoryBudgetCallback_           { config.memoryBudgetCallback            },
+    memoryBudgetUserData_           { config.memoryBudgetUserData            },
+    memoryBudgetAlertThreshold_     { config.memoryBudgetAlertThreshold      },
+    defragmentationBytesPerFrame_   { config.defragmentationBytesPerFrame    }
 {
+    dedicatedAllocationSupported_ = (HasExtension(VKExt::KHR_get_memory_requirements2) && HasExtension(VKExt::KHR_dedicated_allocation));
+
+    #ifdef VK_VERSION_1_1
+    /* VK_EXT_memory_budget is queried with vkGetPhysicalDeviceMemoryProperties2, which is core since Vulkan 1.1 */
+    if (HasExtension(VKExt::EXT_memory_budget))
+    {
+        VkPhysicalDeviceProperties properties;
+        vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+        memoryBudgetSupported_ = (properties.apiVersion >= VK_API_VERSION_1_1);
+    }
+    #endif
 }
 
+constexpr VkDeviceSize VKDeviceMemoryManager::minTransientAllocationSize;
+
 VKDeviceMemoryRegion* VKDeviceMemoryManager::Allocate(
     VkDeviceSize            size,
     VkDeviceSize            alignment,
@@ -37,8 +64,8 @@ VKDeviceMemoryRegion* VKDeviceMemoryManager::Allocate(
     const VkDeviceSize  allocationSize  = std::max(minAllocationSize_, alignedSize);
     const std::uint32_t memoryTypeIndex = FindMemoryType(memoryTypeBits, properties);
 
-    if (VKDeviceMemory* chunk = FindOrAllocChunk(allocationSize, memoryTypeIndex, alignedSize))
-        return chunk->Allocate(size, alignment);
+    if (VKDeviceMemory* chunk = FindOrAllocChunk(allocationSize, memoryTypeIndex, alignedSize, alignment, /*transient:*/ false))
+        return chunk->Allocate(size, alignment, reduceFragmentation_);
     else
         return nullptr;
 }
@@ -55,6 +82,88 @@ VKDeviceMemoryRegion* VKDeviceMemoryManager::Allocate(
     );
 }
 
+VKDeviceMemoryRegion* VKDeviceMemoryManager::AllocateTransient(
+    const VkMemoryRequirements& requirements,
+    VkMemoryPropertyFlags       properties)
+{
+    const VkDeviceSize  alignedSize     = GetAlignedSize(requirements.size, requirements.alignment);
+    const VkDeviceSize  allocationSize  = std::max(std::max(minAllocationSize_, minTransientAllocationSize), alignedSize);
+    const std::uint32_t memoryTypeIndex = FindMemoryType(requirements.memoryTypeBits, properties);
+
+    if (VKDeviceMemory* chunk = FindOrAllocChunk(allocationSize, memoryTypeIndex, alignedSize, requirements.alignment, /*transient:*/ true))
+        return chunk->Allocate(requirements.size, requirements.alignment);
+    else
+        return nullptr;
+}
+
+VKDeviceMemoryRegion* VKDeviceMemoryManager::AllocateBuffer(
+    VkBuffer                    buffer,
+    const VkMemoryRequirements& requirements,
+    VkMemoryPropertyFlags       properties)
+{
+    if (dedicatedAllocationSupported_)
+    {
+        /* Query whether the driver prefers a dedicated allocation for this buffer */
+        VkMemoryDedicatedRequirementsKHR dedicatedRequirements;
+        {
+            dedicatedRequirements.sType                         = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS_KHR;
+            dedicatedRequirements.pNext                         = nullptr;
+            dedicatedRequirements.prefersDedicatedAllocation    = VK_FALSE;
+            dedicatedRequirements.requiresDedicatedAllocation   = VK_FALSE;
+        }
+        VkMemoryRequirements2KHR requirements2;
+        {
+            requirements2.sType = VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2_KHR;
+            requirements2.pNext = &dedicatedRequirements;
+        }
+        VkBufferMemoryRequirementsInfo2KHR requirementsInfo;
+        {
+            requirementsInfo.sType  = VK_STRUCTURE_TYPE_BUFFER_MEMORY_REQUIREMENTS_INFO_2_KHR;
+            requirementsInfo.pNext  = nullptr;
+            requirementsInfo.buffer = buffer;
+        }
+        vkGetBufferMemoryRequirements2KHR(device_, &requirementsInfo, &requirements2);
+
+        if (IsDedicatedAllocationPreferred(requirements, dedicatedRequirements))
+            return AllocateDedicated(requirements, properties, buffer, VK_NULL_HANDLE);
+    }
+    return Allocate(requirements, properties);
+}
+
+VKDeviceMemoryRegion* VKDeviceMemoryManager::AllocateImage(
+    VkImage                     image,
+    const VkMemoryRequirements& requirements,
+    VkMemoryPropertyFlags       properties)
+{
+    if (dedicatedAllocationSupported_)
+    {
+        /* Query whether the driver prefers a dedicated allocation for this image */
+        VkMemoryDedicatedRequirementsKHR dedicatedRequirements;
+        {
+            dedicatedRequirements.sType                         = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS_KHR;
+            dedicatedRequirements.pNext                         = nullptr;
+            dedicatedRequirements.prefersDedicatedAllocation    = VK_FALSE;
+            dedicatedRequirements.requiresDedicatedAllocation   = VK_FALSE;
+        }
+        VkMemoryRequirements2KHR requirements2;
+        {
+            requirements2.sType = VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2_KHR;
+            requirements2.pNext = &dedicatedRequirements;
+        }
+        VkImageMemoryRequirementsInfo2KHR requirementsInfo;
+        {
+            requirementsInfo.sType  = VK_STRUCTURE_TYPE_IMAGE_MEMORY_REQUIREMENTS_INFO_2_KHR;
+            requirementsInfo.pNext  = nullptr;
+            requirementsInfo.image  = image;
+        }
+        vkGetImageMemoryRequirements2KHR(device_, &requirementsInfo, &requirements2);
+
+        if (IsDedicatedAllocationPreferred(requirements, dedicatedRequirements))
+            return AllocateDedicated(requirements, properties, VK_NULL_HANDLE, image);
+    }
+    return Allocate(requirements, properties);
+}
+
 void VKDeviceMemoryManager::Release(VKDeviceMemoryRegion* region)
 {
     if (region)
@@ -64,23 +173,143 @@ void VKDeviceMemoryManager::Release(VKDeviceMemoryRegion* region)
             /* Release block in chunk */
             chunk->Release(region);
 
-            /* Release chunk if it's empty */
+            /* Release chunk if it's empty, but keep one transient chunk per memory type for the next staging buffers */
             if (chunk->IsEmpty())
-                chunks_.erase(chunk);
+            {
+                if (chunk->IsDedicated())
+                    ReleaseChunk(dedicatedChunks_, chunk);
+                else if (!chunk->IsTransient())
+                    ReleaseChunk(chunks_, chunk);
+                else if (!IsLastTransientChunk(chunk))
+                    ReleaseChunk(transientChunks_, chunk);
+            }
         }
     }
 }
 
+bool VKDeviceMemoryManager::HasMemoryType(std::uint32_t memoryTypeBits, VkMemoryPropertyFlags properties) const
+{
+    for_range(i, memoryProperties_.memoryTypeCount)
+    {
+        if ((memoryTypeBits & (1u << i)) != 0 && (memoryProperties_.memoryTypes[i].propertyFlags & properties) == properties)
+            return true;
+    }
+    return false;
+}
+
+bool VKDeviceMemoryManager::FitsIntoHeapBudget(std::uint32_t memoryTypeBits, VkMemoryPropertyFlags properties, VkDeviceSize size) const
+{
+    if (!HasMemoryType(memoryTypeBits, properties))
+        return false;
+
+    VkDeviceSize budgets[VK_MAX_MEMORY_HEAPS], usages[VK_MAX_MEMORY_HEAPS];
+    QueryHeapBudgetsAndUsages(budgets, usages);
+
+    const std::uint32_t heapIndex = GetHeapIndex(FindMemoryType(memoryTypeBits, properties));
+    return (static_cast<double>(usages[heapIndex] + size) <= static_cast<double>(budgets[heapIndex]) * memoryBudgetAlertThreshold_);
+}
+
+VKDeviceMemoryRegion* VKDeviceMemoryManager::AllocateRelocation(const VkMemoryRequirements& requirements, const VKDeviceMemory* srcChunk)
+{
+    const std::uint32_t memoryTypeIndex = srcChunk->GetMemoryTypeIndex();
+    if ((requirements.memoryTypeBits & (1u << memoryTypeIndex)) == 0)
+        return nullptr;
+
+    /* Prefer the chunk with the highest usage, so regions are not moved into a chunk that becomes the next defragmentation candidate */
+    const VkDeviceSize alignedSize = GetAlignedSize(requirements.size, requirements.alignment);
+
+    VKDeviceMemory* dstChunk = nullptr;
+
+    for (const auto& chunk : chunks_)
+    {
+        if (chunk.get() == srcChunk || chunk->GetMemoryTypeIndex() != memoryTypeIndex)
+            continue;
+        if (dstChunk != nullptr && chunk->GetAllocatedSize() <= dstChunk->GetAllocatedSize())
+            continue;
+        if (chunk->CanAllocate(alignedSize, requirements.alignment))
+            dstChunk = chunk.get();
+    }
+
+    return (dstChunk != nullptr ? dstChunk->Allocate(requirements.size, requirements.alignment, reduceFragmentation_) : nullptr);
+}
+
+void VKDeviceMemoryManager::Defragment()
+{
+    if (defragmentationBytesPerFrame_ == 0)
+        return;
+
+    /* Select the most sparsely used chunk; its usage only decreases while it is evacuated, so the same chunk is selected again until it has been released */
+    defragmentationChunk_ = FindDefragmentationCandidate();
+    if (defragmentationChunk_ == nullptr)
+        return;
+
+    /* Collect regions first, since relocating a region modifies the owners of the chunk */
+    relocatableRegions_.clear();
+    defragmentationChunk_->CollectRelocatableRegions(relocatableRegions_);
+
+    /* Move at least one region per call, even if it is larger than the budget */
+    VkDeviceSize movedSize = 0;
+
+    for (VKDeviceMemoryRegion* region : relocatableRegions_)
+    {
+        if (movedSize >= defragmentationBytesPerFrame_)
+            break;
+
+        const VkDeviceSize regionSize = region->GetSize();
+        if (!region->GetOwner()->Relocate(device_, *this))
+            break;
+
+        movedSize += regionSize;
+    }
+
+    relocatableRegions_.clear();
+}
+
 VKDeviceMemoryDetails VKDeviceMemoryManager::QueryDetails() const
 {
     VKDeviceMemoryDetails details;
     {
         for (const auto& chunk : chunks_)
             chunk->AccumDetails(details);
+        for (const auto& chunk : transientChunks_)
+            chunk->AccumDetails(details);
+        for (const auto& chunk : dedicatedChunks_)
+            chunk->AccumDetails(details);
     }
     return details;
 }
 
+std::uint32_t VKDeviceMemoryManager::QueryHeapBudgets(MemoryHeapInfo* outHeapInfos, std::uint32_t maxNumHeaps) const
+{
+    const std::uint32_t numHeaps = memoryProperties_.memoryHeapCount;
+
+    if (outHeapInfos != nullptr && maxNumHeaps > 0)
+    {
+        VkDeviceSize budgets[VK_MAX_MEMORY_HEAPS], usages[VK_MAX_MEMORY_HEAPS];
+        QueryHeapBudgetsAndUsages(budgets, usages);
+
+        for_range(i, std::min(numHeaps, maxNumHeaps))
+        {
+            const VkMemoryHeap& heap = memoryProperties_.memoryHeaps[i];
+            outHeapInfos[i].size            = heap.size;
+            outHeapInfos[i].budget          = budgets[i];
+            outHeapInfos[i].usage           = usages[i];
+            outHeapInfos[i].stagingUsage    = 0;
+            outHeapInfos[i].deviceLocal     = ((heap.flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0);
+        }
+
+        /* Accumulate transient chunks, which hold the staging memory for buffer and texture uploads */
+        for (const auto& chunk : transientChunks_)
+        {
+            const std::uint32_t heapIndex = GetHeapIndex(chunk->GetMemoryTypeIndex());
+            if (heapIndex < maxNumHeaps)
+                outHeapInfos[heapIndex].stagingUsage += chunk->GetSize();
+        }
+    }
+
+    return numHeaps;
+}
+
 #ifdef LLGL_DEBUG
 
 void VKDeviceMemoryManager::PrintBlocks(std::ostream& s, const std::string& title) const
@@ -96,6 +325,7 @@ void VKDeviceMemoryManager::PrintBlocks(std::ostream& s, const std::string& titl
         s << '\n';
         s << "  size             = " << chunk->GetSize() << '\n';
         s << "  memoryTypeIndex  = " << chunk->GetMemoryTypeIndex() << '\n';
+        s << "  transient        = " << std::boolalpha << chunk->IsTransient() << '\n';
 
         s << "  blocks           = ";
         chunk->PrintBlocks(s);
@@ -119,22 +349,198 @@ std::uint32_t VKDeviceMemoryManager::FindMemoryType(std::uint32_t memoryTypeBits
     return VKFindMemoryType(memoryProperties_, memoryTypeBits, properties);
 }
 
-VKDeviceMemory* VKDeviceMemoryManager::AllocChunk(VkDeviceSize size, std::uint32_t memoryTypeIndex)
+VKDeviceMemory* VKDeviceMemoryManager::AllocChunk(VkDeviceSize size, std::uint32_t memoryTypeIndex, bool transient)
+{
+    VKDeviceMemory* chunk = (transient
+        ? transientChunks_.emplace<VKDeviceMemory>(device_, size, memoryTypeIndex, true)
+        : chunks_.emplace<VKDeviceMemory>(device_, size, memoryTypeIndex)
+    );
+
+    const std::uint32_t heapIndex = GetHeapIndex(memoryTypeIndex);
+    heapUsages_[heapIndex] += size;
+    UpdateHeapBudgetAlert(heapIndex);
+
+    return chunk;
+}
+
+void VKDeviceMemoryManager::ReleaseChunk(UnorderedUniquePtrVector<VKDeviceMemory>& container, VKDeviceMemory* chunk)
 {
-    return chunks_.emplace<VKDeviceMemory>(device_, size, memoryTypeIndex);
+    const std::uint32_t heapIndex = GetHeapIndex(chunk->GetMemoryTypeIndex());
+    heapUsages_[heapIndex] -= chunk->GetSize();
+    if (defragmentationChunk_ == chunk)
+        defragmentationChunk_ = nullptr;
+    container.erase(chunk);
+    UpdateHeapBudgetAlert(heapIndex);
 }
 
-VKDeviceMemory* VKDeviceMemoryManager::FindOrAllocChunk(VkDeviceSize allocationSize, std::uint32_t memoryTypeIndex, VkDeviceSize minFreeBlockSize)
+VKDeviceMemory* VKDeviceMemoryManager::FindOrAllocChunk(
+    VkDeviceSize    allocationSize,
+    std::uint32_t   memoryTypeIndex,
+    VkDeviceSize    alignedSize,
+    VkDeviceSize    alignment,
+    bool            transient)
 {
-    /* Search for a suitable chunk */
-    for (const auto& chunk : chunks_)
+    /* Search for a suitable chunk; each chunk answers this in constant time via its free-list bitmasks */
+    for (const auto& chunk : (transient ? transientChunks_ : chunks_))
     {
-        if (chunk->GetMaxAllocationSize() >= minFreeBlockSize && chunk->GetMemoryTypeIndex() == memoryTypeIndex)
+        /* Don't refill the chunk that is evacuated by defragmentation */
+        if (chunk.get() == defragmentationChunk_)
+            continue;
+        if (chunk->GetMemoryTypeIndex() == memoryTypeIndex && chunk->CanAllocate(alignedSize, alignment))
             return chunk.get();
     }
 
     /* Allocate new chunk */
-    return AllocChunk(allocationSize, memoryTypeIndex);
+    return AllocChunk(allocationSize, memoryTypeIndex, transient);
+}
+
+VKDeviceMemory* VKDeviceMemoryManager::FindDefragmentationCandidate() const
+{
+    VKDeviceMemory* candidate = nullptr;
+
+    /* Only consider chunks that are less than half full */
+    double minUsage = 0.5;
+
+    for (const auto& chunk : chunks_)
+    {
+        if (chunk->GetNumRelocatableRegions() == 0)
+            continue;
+
+        const double usage = static_cast<double>(chunk->GetAllocatedSize()) / static_cast<double>(chunk->GetSize());
+        if (usage >= minUsage)
+            continue;
+
+        /* Only evacuate a chunk if the other chunks with the same memory type have enough free space for its allocations */
+        VkDeviceSize freeSize = 0;
+        for (const auto& other : chunks_)
+        {
+            if (other != chunk && other->GetMemoryTypeIndex() == chunk->GetMemoryTypeIndex())
+                freeSize += other->GetSize() - other->GetAllocatedSize();
+        }
+
+        if (freeSize >= chunk->GetAllocatedSize())
+        {
+            candidate   = chunk.get();
+            minUsage    = usage;
+        }
+    }
+
+    return candidate;
+}
+
+bool VKDeviceMemoryManager::IsLastTransientChunk(const VKDeviceMemory* chunk) const
+{
+    for (const auto& other : transientChunks_)
+    {
+        if (other.get() != chunk && other->GetMemoryTypeIndex() == chunk->GetMemoryTypeIndex())
+            return false;
+    }
+    return true;
+}
+
+bool VKDeviceMemoryManager::IsDedicatedAllocationPreferred(
+    const VkMemoryRequirements&             requirements,
+    const VkMemoryDedicatedRequirementsKHR& dedicatedRequirements) const
+{
+    return
+    (
+        dedicatedRequirements.requiresDedicatedAllocation != VK_FALSE ||
+        dedicatedRequirements.prefersDedicatedAllocation  != VK_FALSE ||
+        requirements.size >= dedicatedAllocationThreshold_
+    );
+}
+
+VKDeviceMemoryRegion* VKDeviceMemoryManager::AllocateDedicated(
+    const VkMemoryRequirements& requirements,
+    VkMemoryPropertyFlags       properties,
+    VkBuffer                    buffer,
+    VkImage                     image)
+{
+    const std::uint32_t memoryTypeIndex = FindMemoryType(requirements.memoryTypeBits, properties);
+
+    VkMemoryDedicatedAllocateInfoKHR dedicatedInfo;
+    {
+        dedicatedInfo.sType     = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO_KHR;
+        dedicatedInfo.pNext     = nullptr;
+        dedicatedInfo.image     = image;
+        dedicatedInfo.buffer    = buffer;
+    }
+    VKDeviceMemory* chunk = dedicatedChunks_.emplace<VKDeviceMemory>(device_, requirements.size, memoryTypeIndex, false, &dedicatedInfo);
+
+    const std::uint32_t heapIndex = GetHeapIndex(memoryTypeIndex);
+    heapUsages_[heapIndex] += requirements.size;
+    UpdateHeapBudgetAlert(heapIndex);
+
+    /* Dedicated chunk holds exactly one region at offset zero */
+    return chunk->Allocate(requirements.size, requirements.alignment);
+}
+
+std::uint32_t VKDeviceMemoryManager::GetHeapIndex(std::uint32_t memoryTypeIndex) const
+{
+    return memoryProperties_.memoryTypes[memoryTypeIndex].heapIndex;
+}
+
+void VKDeviceMemoryManager::QueryHeapBudgetsAndUsages(VkDeviceSize* outBudgets, VkDeviceSize* outUsages) const
+{
+    #ifdef VK_VERSION_1_1
+    if (memoryBudgetSupported_)
+    {
+        /* Query heap budget and usage from the driver */
+        VkPhysicalDeviceMemoryBudgetPropertiesEXT budgetProperties = {};
+        {
+            budgetProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
+        }
+        VkPhysicalDeviceMemoryProperties2 memoryProperties2;
+        {
+            memoryProperties2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2;
+            memoryProperties2.pNext = &budgetProperties;
+        }
+        vkGetPhysicalDeviceMemoryProperties2(physicalDevice_, &memoryProperties2);
+
+        for_range(i, memoryProperties_.memoryHeapCount)
+        {
+            outBudgets[i]   = budgetProperties.heapBudget[i];
+            outUsages[i]    = budgetProperties.heapUsage[i];
+        }
+        return;
+    }
+    #endif
+
+    /* Approximate heap budget by 80% of the heap size and usage by the memory allocated by this manager */
+    for_range(i, memoryProperties_.memoryHeapCount)
+    {
+        outBudgets[i]   = memoryProperties_.memoryHeaps[i].size / 5 * 4;
+        outUsages[i]    = heapUsages_[i];
+    }
+}
+
+void VKDeviceMemoryManager::UpdateHeapBudgetAlert(std::uint32_t heapIndex)
+{
+    if (memoryBudgetCallback_ == nullptr)
+        return;
+
+    VkDeviceSize budgets[VK_MAX_MEMORY_HEAPS], usages[VK_MAX_MEMORY_HEAPS];
+    QueryHeapBudgetsAndUsages(budgets, usages);
+
+    const bool isThresholdExceeded = (static_cast<double>(usages[heapIndex]) > static_cast<double>(budgets[heapIndex]) * memoryBudgetAlertThreshold_);
+
+    if (isThresholdExceeded && !heapBudgetAlerts_[heapIndex])
+    {
+        /* Notify client only once until the heap usage dropped below the threshold again */
+        heapBudgetAlerts_[heapIndex] = true;
+
+        const VkMemoryHeap& heap = memoryProperties_.memoryHeaps[heapIndex];
+        MemoryHeapInfo heapInfo;
+        {
+            heapInfo.size           = heap.size;
+            heapInfo.budget         = budgets[heapIndex];
+            heapInfo.usage          = usages[heapIndex];
+            heapInfo.deviceLocal    = ((heap.flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0);
+        }
+        memoryBudgetCallback_(heapIndex, heapInfo, memoryBudgetUserData_);
+    }
+    else if (!isThresholdExceeded)
+        heapBudgetAlerts_[heapIndex] = false;
 }
 
 
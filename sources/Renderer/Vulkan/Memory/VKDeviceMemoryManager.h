@@ -13,6 +13,7 @@
 #include <vulkan/vulkan.h>
 #include "../VKPtr.h"
 #include "../../ContainerTypes.h"
+#include <LLGL/RendererConfiguration.h>
 #include "VKDeviceMemory.h"
 #include "VKDeviceMemoryRegion.h"
 #include <vector>
@@ -23,11 +24,17 @@ namespace LLGL
 {
 
 
+class VKDevice;
+
 /*
 Vulkan device memory manager. Memory allocations are stored in a small hierarchy:
  - Chunk: denotes a single Vulkan memory allocation of type VkDeviceMemory
  - Block: denotes one of multiple regions inside a chunk of type VkBuffer
  - Region: denotes a sub-range inside a block and holds a reference to the VkBuffer and its offset and size (both of type VkDeviceSize).
+Short-lived allocations, such as staging buffers, can be allocated from transient chunks with a linear allocator (see AllocateTransient).
+Large buffers and images get their own dedicated chunk if VK_KHR_dedicated_allocation is available (see AllocateBuffer and AllocateImage).
+The manager also tracks the usage of each memory heap and notifies the client when a heap exceeds its budget.
+If enabled, regions of relocatable buffers are incrementally moved out of sparsely used chunks at frame boundaries, so those chunks can be released (see Defragment).
 */
 class VKDeviceMemoryManager
 {
@@ -35,10 +42,10 @@ class VKDeviceMemoryManager
     public:
 
         VKDeviceMemoryManager(
-            VkDevice                                device,
+            VKDevice&                               device,
+            VkPhysicalDevice                        physicalDevice,
             const VkPhysicalDeviceMemoryProperties& memoryProperties,
-            VkDeviceSize                            minAllocationSize,
-            bool                                    reduceFragmentation
+            const RendererConfigurationVulkan&      config
         );
 
         VKDeviceMemoryManager(const VKDeviceMemoryManager&) = delete;
@@ -58,12 +65,62 @@ class VKDeviceMemoryManager
             VkMemoryPropertyFlags       properties
         );
 
+        /*
+        Allocates a new device memory block with the specified memory requirements from a transient chunk.
+        Transient chunks are linear allocators that are reset once all their blocks have been released,
+        so this should only be used for blocks that are released shortly after, e.g. staging buffers.
+        */
+        VKDeviceMemoryRegion* AllocateTransient(
+            const VkMemoryRequirements& requirements,
+            VkMemoryPropertyFlags       properties
+        );
+
+        // Allocates a new device memory block for the specified buffer. Uses a dedicated chunk if the buffer is large or the driver prefers it.
+        VKDeviceMemoryRegion* AllocateBuffer(
+            VkBuffer                    buffer,
+            const VkMemoryRequirements& requirements,
+            VkMemoryPropertyFlags       properties
+        );
+
+        // Allocates a new device memory block for the specified image. Uses a dedicated chunk if the image is large or the driver prefers it.
+        VKDeviceMemoryRegion* AllocateImage(
+            VkImage                     image,
+            const VkMemoryRequirements& requirements,
+            VkMemoryPropertyFlags       properties
+        );
+
         // Releases the specified device memory block.
         void Release(VKDeviceMemoryRegion* region);
 
+        // Returns true if any of the specified memory types has all the specified properties.
+        bool HasMemoryType(std::uint32_t memoryTypeBits, VkMemoryPropertyFlags properties) const;
+
+        /*
+        Returns true if an allocation of the specified size with the specified properties keeps its memory heap below the budget alert threshold.
+        Returns false if none of the memory types has all the specified properties. This is used for optional memory placement,
+        e.g. device local memory that is also host visible with resizable BAR, which is usually a small heap or shared with all device local resources.
+        */
+        bool FitsIntoHeapBudget(std::uint32_t memoryTypeBits, VkMemoryPropertyFlags properties, VkDeviceSize size) const;
+
+        /*
+        Allocates a new device memory block for a buffer that is relocated out of the specified chunk during defragmentation.
+        Only chunks other than 'srcChunk' with the same memory type are considered and no new chunk is allocated, i.e. returns null if none of them has enough space.
+        */
+        VKDeviceMemoryRegion* AllocateRelocation(const VkMemoryRequirements& requirements, const VKDeviceMemory* srcChunk);
+
+        /*
+        Moves relocatable regions of up to 'defragmentationBytesPerFrame' bytes out of the most sparsely used chunk into other chunks with the same memory type.
+        The copy commands are recorded into the upload batch and the old regions are released once the batch has completed. Does nothing if defragmentation is disabled.
+        This must only be called at frame boundaries, see RendererConfigurationVulkan::defragmentationBytesPerFrame.
+        */
+        void Defragment();
+
         // Queries the memory details of all chunks.
         VKDeviceMemoryDetails QueryDetails() const;
 
+        // Queries the budget and usage of all memory heaps and returns the number of memory heaps. See RenderSystem::QueryMemoryHeaps.
+        std::uint32_t QueryHeapBudgets(MemoryHeapInfo* outHeapInfos, std::uint32_t maxNumHeaps) const;
+
         #ifdef LLGL_DEBUG
 
         void PrintBlocks(std::ostream& s, const std::string& title = "") const;
@@ -76,26 +133,89 @@ class VKDeviceMemoryManager
             return device_;
         }
 
+        // Returns true if relocatable regions are moved by incremental defragmentation.
+        inline bool IsDefragmentationEnabled() const
+        {
+            return (defragmentationBytesPerFrame_ > 0);
+        }
+
+    public:
+
+        // Minimal size for transient chunks. Larger blocks get their own transient chunk.
+        static constexpr VkDeviceSize minTransientAllocationSize = 4ull * 1024ull * 1024ull;
+
     private:
 
         // Finds a memory type index for the specified attributes.
         std::uint32_t FindMemoryType(std::uint32_t memoryTypeBits, VkMemoryPropertyFlags properties) const;
 
         // Allocates a new VkDeviceMemory chunk of the specified size and memory type.
-        VKDeviceMemory* AllocChunk(VkDeviceSize allocationSize, std::uint32_t memoryTypeIndex);
+        VKDeviceMemory* AllocChunk(VkDeviceSize allocationSize, std::uint32_t memoryTypeIndex, bool transient);
+
+        // Releases the specified chunk from its container.
+        void ReleaseChunk(UnorderedUniquePtrVector<VKDeviceMemory>& container, VKDeviceMemory* chunk);
 
         // Finds a suitable device memory chunk or allocates a new one.
-        VKDeviceMemory* FindOrAllocChunk(VkDeviceSize allocationSize, std::uint32_t memoryTypeIndex, VkDeviceSize minFreeBlockSize);
+        VKDeviceMemory* FindOrAllocChunk(
+            VkDeviceSize    allocationSize,
+            std::uint32_t   memoryTypeIndex,
+            VkDeviceSize    alignedSize,
+            VkDeviceSize    alignment,
+            bool            transient
+        );
+
+        // Returns the chunk with the lowest usage that has relocatable regions and whose allocations fit into the other chunks of its memory type, or null if there is none.
+        VKDeviceMemory* FindDefragmentationCandidate() const;
+
+        // Returns true if the specified transient chunk is the only one with its memory type.
+        bool IsLastTransientChunk(const VKDeviceMemory* chunk) const;
+
+        // Returns true if a dedicated chunk should be allocated for a resource with the specified requirements.
+        bool IsDedicatedAllocationPreferred(const VkMemoryRequirements& requirements, const VkMemoryDedicatedRequirementsKHR& dedicatedRequirements) const;
+
+        // Allocates a dedicated chunk for either the specified buffer or image and returns its only region.
+        VKDeviceMemoryRegion* AllocateDedicated(
+            const VkMemoryRequirements& requirements,
+            VkMemoryPropertyFlags       properties,
+            VkBuffer                    buffer,
+            VkImage                     image
+        );
+
+        // Returns the index of the memory heap the specified memory type is allocated from.
+        std::uint32_t GetHeapIndex(std::uint32_t memoryTypeIndex) const;
+
+        // Queries the budget and usage (in bytes) of all memory heaps. Both output arrays must have at least VK_MAX_MEMORY_HEAPS entries.
+        void QueryHeapBudgetsAndUsages(VkDeviceSize* outBudgets, VkDeviceSize* outUsages) const;
+
+        // Invokes the memory budget callback if the usage of the specified heap has exceeded the alert threshold of its budget for the first time.
+        void UpdateHeapBudgetAlert(std::uint32_t heapIndex);
 
     private:
 
-        VkDevice                                    device_;
+        VKDevice&                                   device_;
+        VkPhysicalDevice                            physicalDevice_;
         VkPhysicalDeviceMemoryProperties            memoryProperties_;
 
-        VkDeviceSize                                minAllocationSize_      = 1024*1024;
-        bool                                        reduceFragmentation_    = false;
+        VkDeviceSize                                minAllocationSize_                      = 1024*1024;
+        bool                                        reduceFragmentation_                    = false;
+        VkDeviceSize                                dedicatedAllocationThreshold_           = 32*1024*1024;
+        bool                                        dedicatedAllocationSupported_           = false;
+        bool                                        memoryBudgetSupported_                  = false;
+        VkDeviceSize                                defragmentationBytesPerFrame_           = 0;
+
+        VulkanMemoryBudgetCallback                  memoryBudgetCallback_                   = nullptr;
+        void*                                       memoryBudgetUserData_                   = nullptr;
+        float                                       memoryBudgetAlertThreshold_             = 0.9f;
 
         UnorderedUniquePtrVector<VKDeviceMemory>    chunks_;
+        UnorderedUniquePtrVector<VKDeviceMemory>    transientChunks_;
+        UnorderedUniquePtrVector<VKDeviceMemory>    dedicatedChunks_;
+
+        VKDeviceMemory*                             defragmentationChunk_                   = nullptr;  // Chunk that is currently evacuated; excluded from new allocations.
+        std::vector<VKDeviceMemoryRegion*>          relocatableRegions_;
+
+        VkDeviceSize                                heapUsages_[VK_MAX_MEMORY_HEAPS]        = {};   // Accumulated size of all chunks per memory heap.
+        bool                                        heapBudgetAlerts_[VK_MAX_MEMORY_HEAPS]  = {};   // Specifies which heaps have exceeded the alert threshold.
 
 };
 
@@ -37,28 +37,6 @@ void VKDeviceMemoryRegion::BindImage(VkDevice device, VkImage image)
  * ======= Protected: =======
  */
 
-bool VKDeviceMemoryRegion::MergeWith(VKDeviceMemoryRegion& other)
-{
-    if (GetParentChunk() == other.GetParentChunk() && GetMemoryTypeIndex() == other.GetMemoryTypeIndex())
-    {
-        /* Check if this region is a direct lower part */
-        if (GetOffsetWithSize() == other.GetOffset())
-        {
-            size_ += other.GetSize();
-            return true;
-        }
-
-        /* Check if this region is a direct upper part */
-        if (other.GetOffsetWithSize() == GetOffset())
-        {
-            offset_ = other.GetOffset();
-            size_ += other.GetSize();
-            return true;
-        }
-    }
-    return false;
-}
-
 void VKDeviceMemoryRegion::MoveAt(VkDeviceSize alignedSize, VkDeviceSize alignedOffset)
 {
     size_   = alignedSize;
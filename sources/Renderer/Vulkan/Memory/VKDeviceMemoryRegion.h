@@ -18,6 +18,7 @@ namespace LLGL
 
 
 class VKDeviceMemory;
+class VKDeviceBuffer;
 
 // An instance of this class represents an atomic region within a VkDeviceMemory allocation.
 class VKDeviceMemoryRegion
@@ -63,22 +64,53 @@ class VKDeviceMemoryRegion
             return memoryTypeIndex_;
         }
 
+        // Returns true if this region is not allocated, i.e. it is part of the free lists of its parent chunk.
+        inline bool IsFree() const
+        {
+            return isFree_;
+        }
+
+        // Returns the buffer that can be relocated into another chunk during defragmentation, or null if this region must not be moved. See VKDeviceMemory::SetRegionOwner.
+        inline VKDeviceBuffer* GetOwner() const
+        {
+            return owner_;
+        }
+
+        // Returns the residency priority in the range [0, 1]. See VKDeviceMemory::SetRegionResidency.
+        inline float GetPriority() const
+        {
+            return priority_;
+        }
+
+        // Returns true if this region has been evicted, i.e. its effective priority is zero. See VKDeviceMemory::SetRegionResidency.
+        inline bool IsEvicted() const
+        {
+            return evicted_;
+        }
+
     protected:
 
         friend class VKDeviceMemory;
 
-        // Tries to merge the specified region into this region, and returns true on success.
-        bool MergeWith(VKDeviceMemoryRegion& other);
-
         // Sets the new size and offset.
         void MoveAt(VkDeviceSize alignedSize, VkDeviceSize alignedOffset);
 
     private:
 
-        VKDeviceMemory* deviceMemory_       = nullptr;
-        VkDeviceSize    size_               = 0;
-        VkDeviceSize    offset_             = 0;
-        std::uint32_t   memoryTypeIndex_    = 0;
+        VKDeviceMemory*         deviceMemory_       = nullptr;
+        VkDeviceSize            size_               = 0;
+        VkDeviceSize            offset_             = 0;
+        std::uint32_t           memoryTypeIndex_    = 0;
+        bool                    isFree_             = false;
+        VKDeviceBuffer*         owner_              = nullptr;
+        float                   priority_           = 0.5f;     // Default priority of VK_EXT_memory_priority.
+        bool                    evicted_            = false;
+
+        /* Links to the neighbors in memory and to the neighbors in the free list; all managed by the parent chunk */
+        VKDeviceMemoryRegion*   prevPhysical_       = nullptr;
+        VKDeviceMemoryRegion*   nextPhysical_       = nullptr;
+        VKDeviceMemoryRegion*   prevFree_           = nullptr;
+        VKDeviceMemoryRegion*   nextFree_           = nullptr;
 
 };
 
@@ -0,0 +1,279 @@
+/*
+ * VKBindlessDescriptorSet.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VKBindlessDescriptorSet.h"
+#include "../VKCore.h"
+#include "../../../Core/Assertion.h"
+#include <LLGL/Utils/ForRange.h>
+#include <LLGL/Constants.h>
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+static const VkDescriptorType g_bindlessDescriptorTypes[VKBindlessDescriptorSet::Binding_Num] =
+{
+    VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE,   // Binding_SampledImages
+    VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,   // Binding_StorageImages
+    VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,  // Binding_StorageBuffers
+    VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,  // Binding_UniformBuffers
+    VK_DESCRIPTOR_TYPE_SAMPLER,         // Binding_Samplers
+};
+
+VKBindlessDescriptorSet::VKBindlessDescriptorSet(
+    VkPhysicalDevice    physicalDevice,
+    VkDevice            device,
+    std::uint32_t       numDescriptors,
+    std::uint32_t       numSamplers,
+    bool                uniformBuffers)
+:
+    device_         { device                                },
+    setLayout_      { device, vkDestroyDescriptorSetLayout  },
+    descriptorPool_ { device, vkDestroyDescriptorPool       }
+{
+    /* Query limits for descriptors that are updated after bind */
+    VkPhysicalDeviceDescriptorIndexingPropertiesEXT indexingProps = {};
+    indexingProps.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES_EXT;
+
+    VkPhysicalDeviceProperties2 properties = {};
+    properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+    properties.pNext = &indexingProps;
+
+    vkGetPhysicalDeviceProperties2(physicalDevice, &properties);
+
+    /* Clamp number of descriptors per binding to the device limits */
+    const std::uint32_t maxResources = indexingProps.maxPerStageUpdateAfterBindResources;
+
+    auto ClampCapacity = [maxResources](std::uint32_t count, std::uint32_t maxPerStage, std::uint32_t maxPerSet) -> std::uint32_t
+    {
+        return std::min({ count, maxPerStage, maxPerSet, maxResources });
+    };
+
+    allocators_[Binding_SampledImages].capacity = ClampCapacity(
+        numDescriptors,
+        indexingProps.maxPerStageDescriptorUpdateAfterBindSampledImages,
+        indexingProps.maxDescriptorSetUpdateAfterBindSampledImages
+    );
+    allocators_[Binding_StorageImages].capacity = ClampCapacity(
+        numDescriptors,
+        indexingProps.maxPerStageDescriptorUpdateAfterBindStorageImages,
+        indexingProps.maxDescriptorSetUpdateAfterBindStorageImages
+    );
+    allocators_[Binding_StorageBuffers].capacity = ClampCapacity(
+        numDescriptors,
+        indexingProps.maxPerStageDescriptorUpdateAfterBindStorageBuffers,
+        indexingProps.maxDescriptorSetUpdateAfterBindStorageBuffers
+    );
+    if (uniformBuffers)
+    {
+        allocators_[Binding_UniformBuffers].capacity = ClampCapacity(
+            numDescriptors,
+            indexingProps.maxPerStageDescriptorUpdateAfterBindUniformBuffers,
+            indexingProps.maxDescriptorSetUpdateAfterBindUniformBuffers
+        );
+    }
+    allocators_[Binding_Samplers].capacity = ClampCapacity(
+        numSamplers,
+        indexingProps.maxPerStageDescriptorUpdateAfterBindSamplers,
+        indexingProps.maxDescriptorSetUpdateAfterBindSamplers
+    );
+
+    CreateDescriptorSetLayout(device);
+    CreateDescriptorPool(device);
+    AllocateDescriptorSet(device);
+}
+
+std::uint32_t VKBindlessDescriptorSet::WriteImage(Binding binding, VkImageView imageView, VkImageLayout imageLayout)
+{
+    const std::uint32_t index = AllocIndex(binding);
+    if (index != LLGL_INVALID_SLOT)
+    {
+        VkDescriptorImageInfo imageInfo;
+        {
+            imageInfo.sampler       = VK_NULL_HANDLE;
+            imageInfo.imageView     = imageView;
+            imageInfo.imageLayout   = imageLayout;
+        }
+        WriteDescriptor(binding, index, &imageInfo, nullptr);
+    }
+    return index;
+}
+
+std::uint32_t VKBindlessDescriptorSet::WriteBuffer(Binding binding, VkBuffer buffer, VkDeviceSize size)
+{
+    const std::uint32_t index = AllocIndex(binding);
+    if (index != LLGL_INVALID_SLOT)
+    {
+        VkDescriptorBufferInfo bufferInfo;
+        {
+            bufferInfo.buffer   = buffer;
+            bufferInfo.offset   = 0;
+            bufferInfo.range    = size;
+        }
+        WriteDescriptor(binding, index, nullptr, &bufferInfo);
+    }
+    return index;
+}
+
+std::uint32_t VKBindlessDescriptorSet::WriteSampler(VkSampler sampler)
+{
+    const std::uint32_t index = AllocIndex(Binding_Samplers);
+    if (index != LLGL_INVALID_SLOT)
+    {
+        VkDescriptorImageInfo imageInfo;
+        {
+            imageInfo.sampler       = sampler;
+            imageInfo.imageView     = VK_NULL_HANDLE;
+            imageInfo.imageLayout   = VK_IMAGE_LAYOUT_UNDEFINED;
+        }
+        WriteDescriptor(Binding_Samplers, index, &imageInfo, nullptr);
+    }
+    return index;
+}
+
+void VKBindlessDescriptorSet::FreeDescriptor(Binding binding, std::uint32_t index)
+{
+    /* Descriptors are partially bound, so the freed descriptor doesn't need to be overwritten until it is reused */
+    LLGL_ASSERT(index < allocators_[binding].next);
+    allocators_[binding].freeIndices.push_back(index);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void VKBindlessDescriptorSet::CreateDescriptorSetLayout(VkDevice device)
+{
+    VkDescriptorSetLayoutBinding setLayoutBindings[Binding_Num];
+    VkDescriptorBindingFlagsEXT bindingFlags[Binding_Num];
+
+    for_range(i, Binding_Num)
+    {
+        VkDescriptorSetLayoutBinding& setLayoutBinding = setLayoutBindings[i];
+        {
+            setLayoutBinding.binding            = i;
+            setLayoutBinding.descriptorType     = g_bindlessDescriptorTypes[i];
+            setLayoutBinding.descriptorCount    = allocators_[i].capacity;
+            setLayoutBinding.stageFlags         = VK_SHADER_STAGE_ALL;
+            setLayoutBinding.pImmutableSamplers = nullptr;
+        }
+        bindingFlags[i] = VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT_EXT;
+        if (allocators_[i].capacity > 0)
+            bindingFlags[i] |= (VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT | VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT_EXT);
+    }
+
+    VkDescriptorSetLayoutBindingFlagsCreateInfoEXT bindingFlagsInfo;
+    {
+        bindingFlagsInfo.sType          = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO_EXT;
+        bindingFlagsInfo.pNext          = nullptr;
+        bindingFlagsInfo.bindingCount   = Binding_Num;
+        bindingFlagsInfo.pBindingFlags  = bindingFlags;
+    }
+    VkDescriptorSetLayoutCreateInfo createInfo;
+    {
+        createInfo.sType        = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        createInfo.pNext        = &bindingFlagsInfo;
+        createInfo.flags        = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT_EXT;
+        createInfo.bindingCount = Binding_Num;
+        createInfo.pBindings    = setLayoutBindings;
+    }
+    VkResult result = vkCreateDescriptorSetLayout(device, &createInfo, nullptr, setLayout_.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan descriptor set layout for bindless descriptors");
+}
+
+void VKBindlessDescriptorSet::CreateDescriptorPool(VkDevice device)
+{
+    VkDescriptorPoolSize poolSizes[Binding_Num];
+    std::uint32_t numPoolSizes = 0;
+
+    for_range(i, Binding_Num)
+    {
+        if (allocators_[i].capacity > 0)
+        {
+            poolSizes[numPoolSizes].type            = g_bindlessDescriptorTypes[i];
+            poolSizes[numPoolSizes].descriptorCount = allocators_[i].capacity;
+            ++numPoolSizes;
+        }
+    }
+
+    VkDescriptorPoolCreateInfo poolCreateInfo;
+    {
+        poolCreateInfo.sType            = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        poolCreateInfo.pNext            = nullptr;
+        poolCreateInfo.flags            = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT_EXT;
+        poolCreateInfo.maxSets          = 1;
+        poolCreateInfo.poolSizeCount    = numPoolSizes;
+        poolCreateInfo.pPoolSizes       = poolSizes;
+    }
+    VkResult result = vkCreateDescriptorPool(device, &poolCreateInfo, nullptr, descriptorPool_.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan descriptor pool for bindless descriptors");
+}
+
+void VKBindlessDescriptorSet::AllocateDescriptorSet(VkDevice device)
+{
+    VkDescriptorSetLayout setLayout = setLayout_.Get();
+    VkDescriptorSetAllocateInfo allocInfo;
+    {
+        allocInfo.sType                 = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        allocInfo.pNext                 = nullptr;
+        allocInfo.descriptorPool        = descriptorPool_.Get();
+        allocInfo.descriptorSetCount    = 1;
+        allocInfo.pSetLayouts           = &setLayout;
+    }
+    VkResult result = vkAllocateDescriptorSets(device, &allocInfo, &descriptorSet_);
+    VKThrowIfFailed(result, "failed to allocate Vulkan descriptor set for bindless descriptors");
+}
+
+std::uint32_t VKBindlessDescriptorSet::AllocIndex(Binding binding)
+{
+    IndexAllocator& allocator = allocators_[binding];
+
+    /* Reuse previously freed index first */
+    if (!allocator.freeIndices.empty())
+    {
+        const std::uint32_t index = allocator.freeIndices.back();
+        allocator.freeIndices.pop_back();
+        return index;
+    }
+
+    if (allocator.next < allocator.capacity)
+        return allocator.next++;
+
+    return LLGL_INVALID_SLOT;
+}
+
+void VKBindlessDescriptorSet::WriteDescriptor(
+    Binding                         binding,
+    std::uint32_t                   index,
+    const VkDescriptorImageInfo*    imageInfo,
+    const VkDescriptorBufferInfo*   bufferInfo)
+{
+    VkWriteDescriptorSet writeDesc;
+    {
+        writeDesc.sType             = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        writeDesc.pNext             = nullptr;
+        writeDesc.dstSet            = descriptorSet_;
+        writeDesc.dstBinding        = static_cast<std::uint32_t>(binding);
+        writeDesc.dstArrayElement   = index;
+        writeDesc.descriptorCount   = 1;
+        writeDesc.descriptorType    = g_bindlessDescriptorTypes[binding];
+        writeDesc.pImageInfo        = imageInfo;
+        writeDesc.pBufferInfo       = bufferInfo;
+        writeDesc.pTexelBufferView  = nullptr;
+    }
+    vkUpdateDescriptorSets(device_, 1, &writeDesc, 0, nullptr);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
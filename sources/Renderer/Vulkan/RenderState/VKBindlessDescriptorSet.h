@@ -0,0 +1,132 @@
+/*
+ * VKBindlessDescriptorSet.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VK_BINDLESS_DESCRIPTOR_SET_H
+#define LLGL_VK_BINDLESS_DESCRIPTOR_SET_H
+
+
+#include "../Vulkan.h"
+#include "../VKPtr.h"
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+Global descriptor set for bindless mode (see RendererConfigurationVulkan::enableBindlessDescriptors).
+Each binding is a partially bound runtime array that is updated after bind, so descriptors can be written and freed
+while the descriptor set is bound in command buffers that are still pending execution.
+This descriptor set is appended to all pipeline layouts after their own descriptor sets.
+*/
+class VKBindlessDescriptorSet
+{
+
+    public:
+
+        // Binding points within the bindless descriptor set, i.e. 'layout(set = N, binding = M)' in GLSL.
+        enum Binding
+        {
+            Binding_SampledImages = 0,
+            Binding_StorageImages,
+            Binding_StorageBuffers,
+            Binding_UniformBuffers,
+            Binding_Samplers,
+
+            Binding_Num,
+        };
+
+    public:
+
+        // Creates the descriptor set with the specified number of descriptors per binding. Both numbers are clamped to the device limits.
+        VKBindlessDescriptorSet(
+            VkPhysicalDevice    physicalDevice,
+            VkDevice            device,
+            std::uint32_t       numDescriptors,
+            std::uint32_t       numSamplers,
+            bool                uniformBuffers
+        );
+
+        VKBindlessDescriptorSet(const VKBindlessDescriptorSet&) = delete;
+        VKBindlessDescriptorSet& operator = (const VKBindlessDescriptorSet&) = delete;
+
+        // Writes an image descriptor into the specified binding and returns its index, or LLGL_INVALID_SLOT if the binding has no descriptors left.
+        std::uint32_t WriteImage(Binding binding, VkImageView imageView, VkImageLayout imageLayout);
+
+        // Writes a buffer descriptor into the specified binding and returns its index, or LLGL_INVALID_SLOT if the binding has no descriptors left.
+        std::uint32_t WriteBuffer(Binding binding, VkBuffer buffer, VkDeviceSize size);
+
+        // Writes a sampler descriptor and returns its index, or LLGL_INVALID_SLOT if there are no sampler descriptors left.
+        std::uint32_t WriteSampler(VkSampler sampler);
+
+        // Frees the specified descriptor index. It can be reused by the next write, so shaders must no longer read from it.
+        void FreeDescriptor(Binding binding, std::uint32_t index);
+
+        // Returns true if this descriptor set has a binding for uniform buffers.
+        inline bool HasUniformBuffers() const
+        {
+            return (allocators_[Binding_UniformBuffers].capacity > 0);
+        }
+
+        // Returns the native VkDescriptorSetLayout object.
+        inline VkDescriptorSetLayout GetVkDescriptorSetLayout() const
+        {
+            return setLayout_.Get();
+        }
+
+        // Returns the native VkDescriptorSet object.
+        inline VkDescriptorSet GetVkDescriptorSet() const
+        {
+            return descriptorSet_;
+        }
+
+    private:
+
+        // Allocator for stable descriptor indices within a single binding.
+        struct IndexAllocator
+        {
+            std::uint32_t               capacity    = 0;
+            std::uint32_t               next        = 0;
+            std::vector<std::uint32_t>  freeIndices;
+        };
+
+    private:
+
+        void CreateDescriptorSetLayout(VkDevice device);
+        void CreateDescriptorPool(VkDevice device);
+        void AllocateDescriptorSet(VkDevice device);
+
+        std::uint32_t AllocIndex(Binding binding);
+
+        void WriteDescriptor(
+            Binding                         binding,
+            std::uint32_t                   index,
+            const VkDescriptorImageInfo*    imageInfo,
+            const VkDescriptorBufferInfo*   bufferInfo
+        );
+
+    private:
+
+        VkDevice                        device_         = VK_NULL_HANDLE;
+        VKPtr<VkDescriptorSetLayout>    setLayout_;
+        VKPtr<VkDescriptorPool>         descriptorPool_;
+        VkDescriptorSet                 descriptorSet_  = VK_NULL_HANDLE;
+        IndexAllocator                  allocators_[Binding_Num];
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -25,13 +25,21 @@ VKComputePSO::VKComputePSO(
     const ComputePipelineDescriptor&    desc,
     PipelineCache*                      pipelineCache)
 :
-    VKPipelineState { device, VK_PIPELINE_BIND_POINT_COMPUTE, GetShadersAsArray(desc), desc.pipelineLayout }
+    VKPipelineState { device, VK_PIPELINE_BIND_POINT_COMPUTE, GetShadersAsArray(desc), desc.specializationConstants, desc.pipelineLayout, desc.placeholder }
 {
-    /* Create Vulkan compute pipeline object */
-    if (VKPipelineCache* pipelineCacheVK = (pipelineCache != nullptr ? LLGL_CAST(VKPipelineCache*, pipelineCache) : nullptr))
-        CreateVkPipeline(device, desc, pipelineCacheVK->GetNative());
-    else
-        CreateVkPipeline(device, desc);
+    /* Create Vulkan compute pipeline object; the descriptor is copied since it might be compiled asynchronously */
+    CompileVkPipeline(
+        [this, device, desc, pipelineCache]()
+        {
+            CreateVkPipeline(device, desc, VKPipelineCache::GetNativeForCurrentThread(pipelineCache));
+        },
+        desc.asyncCompilation
+    );
+}
+
+VKComputePSO::~VKComputePSO()
+{
+    WaitForCompilation();
 }
 
 
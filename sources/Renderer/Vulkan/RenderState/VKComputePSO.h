@@ -30,6 +30,8 @@ class VKComputePSO final : public VKPipelineState
             PipelineCache*                      pipelineCache = nullptr
         );
 
+        ~VKComputePSO();
+
     private:
 
         void CreateVkPipeline(
@@ -12,6 +12,8 @@
 #include "../Texture/VKTexture.h"
 #include "../Texture/VKSampler.h"
 #include "../../CheckedCast.h"
+#include "../../../Core/CoreUtils.h"
+#include "../../../Core/ProfileZone.h"
 #include <LLGL/Utils/ForRange.h>
 #include <vector>
 #include <algorithm>
@@ -29,6 +31,14 @@ static std::uint32_t SumDescriptorPoolSizes(std::uint32_t numSizes, const VkDesc
     return count;
 }
 
+static std::size_t GetMaxBindingSlot(const ArrayView<VKLayoutBinding>& bindings)
+{
+    std::size_t maxBindingSlot = 0;
+    for (const VKLayoutBinding& binding : bindings)
+        maxBindingSlot = std::max(maxBindingSlot, static_cast<std::size_t>(binding.dstBinding) + 1);
+    return maxBindingSlot;
+}
+
 VKDescriptorCache::VKDescriptorCache(
     VkDevice                            device,
     VkDescriptorPool                    descriptorPool,
@@ -40,7 +50,8 @@ VKDescriptorCache::VKDescriptorCache(
     device_         { device                                  },
     setLayout_      { setLayout                               },
     poolSizes_      { sizes, sizes + numSizes                 },
-    numDescriptors_ { SumDescriptorPoolSizes(numSizes, sizes) }
+    numDescriptors_ { SumDescriptorPoolSizes(numSizes, sizes) },
+    cachePool_      { device, vkDestroyDescriptorPool         }
 {
     /* Allocate descriptor set for immutable samplers */
     VkDescriptorSetAllocateInfo allocInfo;
@@ -56,8 +67,13 @@ VKDescriptorCache::VKDescriptorCache(
 
     /* Pre-allocate VkCopyDescriptorSet array */
     BuildCopyDescriptors(bindings);
+
+    /* Initialize binding keys for each binding slot */
+    bindingKeys_.resize(GetMaxBindingSlot(bindings), 0);
 }
 
+constexpr std::uint32_t VKDescriptorCache::maxCachedDescriptorSets;
+
 void VKDescriptorCache::Reset()
 {
     dirty_ = true;
@@ -87,21 +103,89 @@ void VKDescriptorCache::EmplaceDescriptor(Resource& resource, const VKLayoutBind
     }
 }
 
+void VKDescriptorCache::EmplaceDescriptors(std::uint32_t numResources, Resource* const* resources, const VKLayoutBinding* bindings, VKDescriptorSetWriter& setWriter)
+{
+    bool anyEmplaced = false;
+
+    for_range(i, numResources)
+    {
+        if (resources[i] == nullptr)
+            continue;
+
+        switch (resources[i]->GetResourceType())
+        {
+            case ResourceType::Buffer:
+                EmplaceBufferDescriptor(LLGL_CAST(VKBuffer&, *resources[i]), bindings[i], setWriter);
+                anyEmplaced = true;
+                break;
+
+            case ResourceType::Texture:
+                EmplaceTextureDescriptor(LLGL_CAST(VKTexture&, *resources[i]), bindings[i], setWriter);
+                anyEmplaced = true;
+                break;
+
+            case ResourceType::Sampler:
+                EmplaceSamplerDescriptor(LLGL_CAST(VKSampler&, *resources[i]), bindings[i], setWriter);
+                anyEmplaced = true;
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    if (anyEmplaced)
+        dirty_ = true;
+}
+
 VkDescriptorSet VKDescriptorCache::FlushDescriptorSet(VKStagingDescriptorSetPool& pool, VKDescriptorSetWriter& setWriter)
 {
+    LLGL_PROFILE_ZONE("FlushDescriptorSet");
+
     if (!dirty_ || setLayout_ == VK_NULL_HANDLE)
         return VK_NULL_HANDLE;
 
+    /* Lock mutex to guard copy descriptors and cached descriptor sets since they are shared across threads */
+    std::lock_guard<std::mutex> guard{ copyDescMutex_ };
+
+    /* Search descriptor set that was flushed with the same bindings before */
+    const std::uint64_t hash = HashBindingKeys();
+    std::size_t insertionIndex = 0;
+
+    CachedDescriptorSet* cachedSet = FindInSortedArray<CachedDescriptorSet>(
+        cachedSets_.data(),
+        cachedSets_.size(),
+        [hash](const CachedDescriptorSet& entry) -> int
+        {
+            if (hash > entry.hash)
+                return 1;
+            if (hash < entry.hash)
+                return -1;
+            return 0;
+        },
+        &insertionIndex
+    );
+
+    if (cachedSet != nullptr && cachedSet->bindingKeys == bindingKeys_)
+    {
+        /* Reuse cached descriptor set; the descriptor writes to the scratch descriptor set remain pending in the writer */
+        dirty_ = false;
+        return cachedSet->descriptorSet;
+    }
+
+    /* Allocate new descriptor set; only cache it if the hash doesn't collide with a different binding combination */
+    VkDescriptorSet descriptorSetCopy = (cachedSet == nullptr ? AllocateCachedDescriptorSet() : VK_NULL_HANDLE);
+
+    if (descriptorSetCopy != VK_NULL_HANDLE)
+        cachedSets_.insert(cachedSets_.begin() + insertionIndex, CachedDescriptorSet{ hash, bindingKeys_, descriptorSetCopy });
+    else
+        descriptorSetCopy = pool.AllocateDescriptorSet(setLayout_, static_cast<std::uint32_t>(poolSizes_.size()), poolSizes_.data());
+
     /*
     Perform two operations in order:
     1. Update previously written descriptors to cache; Descriptor writes are performed first by 'vkUpdateDescriptorSets'.
     2. Copy cache into new descriptor set; Descriptor copies are performed second by 'vkUpdateDescriptorSets'.
     */
-    VkDescriptorSet descriptorSetCopy = pool.AllocateDescriptorSet(setLayout_, static_cast<std::uint32_t>(poolSizes_.size()), poolSizes_.data());
-
-    /* Lock mutex to guard copy descriptors since they are shared across threads */
-    std::lock_guard<std::mutex> guard{ copyDescMutex_ };
-
     UpdateCopyDescriptorSet(descriptorSetCopy);
 
     vkUpdateDescriptorSets(
@@ -112,12 +196,49 @@ VkDescriptorSet VKDescriptorCache::FlushDescriptorSet(VKStagingDescriptorSetPool
         copyDescs_.data()
     );
 
-    /* Clear cache after updated  */
+    /* Clear cache after updated; all written descriptors are now part of the scratch descriptor set */
+    setWriter.Reset();
     dirty_ = false;
 
     return descriptorSetCopy;
 }
 
+void VKDescriptorCache::InvalidateResource(std::uint64_t resourceHandle)
+{
+    if (resourceHandle == 0)
+        return;
+
+    std::lock_guard<std::mutex> guard{ copyDescMutex_ };
+
+    /* Forget resource in scratch descriptor set, so its native handle can be reused by another resource */
+    for (std::uint64_t& key : bindingKeys_)
+    {
+        if (key == resourceHandle)
+            key = 0;
+    }
+
+    /* Release all cached descriptor sets that refer to the resource */
+    RemoveAllFromListIf(
+        cachedSets_,
+        [this, resourceHandle](const CachedDescriptorSet& entry) -> bool
+        {
+            if (std::find(entry.bindingKeys.begin(), entry.bindingKeys.end(), resourceHandle) == entry.bindingKeys.end())
+                return false;
+            vkFreeDescriptorSets(this->device_, this->cachePool_, 1, &(entry.descriptorSet));
+            return true;
+        }
+    );
+}
+
+void VKDescriptorCache::FlushPendingWrites(VkDevice device, VKDescriptorSetWriter& setWriter)
+{
+    if (setWriter.GetNumWrites() > 0)
+    {
+        setWriter.UpdateDescriptorSets(device);
+        setWriter.Reset();
+    }
+}
+
 
 /*
  * ======= Private: =======
@@ -151,12 +272,19 @@ VkDescriptorImageInfo* VKDescriptorCache::NextImageInfoOrUpdateCache(VKDescripto
 
 void VKDescriptorCache::EmplaceBufferDescriptor(VKBuffer& bufferVK, const VKLayoutBinding& binding, VKDescriptorSetWriter& setWriter)
 {
+    if (binding.descriptorType == VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR)
+    {
+        EmplaceAccelerationStructureDescriptor(bufferVK, binding, setWriter);
+        return;
+    }
+
     auto bufferInfo = NextBufferInfoOrUpdateCache(setWriter);
     {
         bufferInfo->buffer  = bufferVK.GetVkBuffer();
         bufferInfo->offset  = 0;
         bufferInfo->range   = VK_WHOLE_SIZE;
     }
+    SetBindingKey(binding.dstBinding, GetResourceKey(bufferInfo->buffer));
     auto writeDesc = setWriter.NextWriteDescriptor();
     {
         writeDesc->dstSet           = descriptorSet_;
@@ -170,6 +298,31 @@ void VKDescriptorCache::EmplaceBufferDescriptor(VKBuffer& bufferVK, const VKLayo
     }
 }
 
+void VKDescriptorCache::EmplaceAccelerationStructureDescriptor(VKBuffer& bufferVK, const VKLayoutBinding& binding, VKDescriptorSetWriter& setWriter)
+{
+    auto accelStructInfo = setWriter.NextAccelerationStructureInfo(bufferVK.GetVkAccelerationStructure());
+    if (accelStructInfo == nullptr)
+    {
+        /* Flush descriptor set update */
+        setWriter.UpdateDescriptorSets(device_);
+        setWriter.Reset();
+        accelStructInfo = setWriter.NextAccelerationStructureInfo(bufferVK.GetVkAccelerationStructure());
+    }
+    SetBindingKey(binding.dstBinding, GetResourceKey(bufferVK.GetVkBuffer()));
+    auto writeDesc = setWriter.NextWriteDescriptor();
+    {
+        writeDesc->pNext            = accelStructInfo;
+        writeDesc->dstSet           = descriptorSet_;
+        writeDesc->dstBinding       = binding.dstBinding;
+        writeDesc->dstArrayElement  = 0;
+        writeDesc->descriptorCount  = 1;
+        writeDesc->descriptorType   = binding.descriptorType;
+        writeDesc->pImageInfo       = nullptr;
+        writeDesc->pBufferInfo      = nullptr;
+        writeDesc->pTexelBufferView = nullptr;
+    }
+}
+
 static VkImageLayout GetShaderReadOptimalImageLayout(Format format)
 {
     #if 0
@@ -190,6 +343,7 @@ void VKDescriptorCache::EmplaceTextureDescriptor(VKTexture& textureVK, const VKL
         imageInfo->imageView     = textureVK.GetVkImageView();
         imageInfo->imageLayout   = GetShaderReadOptimalImageLayout(textureVK.GetFormat());
     }
+    SetBindingKey(binding.dstBinding, GetResourceKey(imageInfo->imageView));
     auto writeDesc = setWriter.NextWriteDescriptor();
     {
         writeDesc->dstSet           = descriptorSet_;
@@ -211,6 +365,7 @@ void VKDescriptorCache::EmplaceSamplerDescriptor(VKSampler& samplerVK, const VKL
         imageInfo->imageView        = VK_NULL_HANDLE;
         imageInfo->imageLayout      = VK_IMAGE_LAYOUT_UNDEFINED;
     }
+    SetBindingKey(binding.dstBinding, GetResourceKey(imageInfo->sampler));
     auto writeDesc = setWriter.NextWriteDescriptor();
     {
         writeDesc->dstSet           = descriptorSet_;
@@ -304,6 +459,62 @@ void VKDescriptorCache::UpdateCopyDescriptorSet(VkDescriptorSet dstSet)
         copyDesc.dstSet = dstSet;
 }
 
+void VKDescriptorCache::SetBindingKey(std::uint32_t dstBinding, std::uint64_t key)
+{
+    if (dstBinding < bindingKeys_.size())
+        bindingKeys_[dstBinding] = key;
+}
+
+std::uint64_t VKDescriptorCache::HashBindingKeys() const
+{
+    std::uint64_t hash = 0;
+    for (std::uint64_t key : bindingKeys_)
+        hash ^= key + 0x9E3779B97F4A7C15ull + (hash << 6) + (hash >> 2);
+    return hash;
+}
+
+VkDescriptorSet VKDescriptorCache::AllocateCachedDescriptorSet()
+{
+    if (cachedSets_.size() >= VKDescriptorCache::maxCachedDescriptorSets)
+        return VK_NULL_HANDLE;
+
+    if (cachePool_.Get() == VK_NULL_HANDLE)
+    {
+        /* Create descriptor pool with enough descriptors for the maximum number of cached descriptor sets */
+        SmallVector<VkDescriptorPoolSize, 4> poolSizes{ poolSizes_.begin(), poolSizes_.end() };
+        for (VkDescriptorPoolSize& poolSize : poolSizes)
+            poolSize.descriptorCount *= VKDescriptorCache::maxCachedDescriptorSets;
+
+        VkDescriptorPoolCreateInfo poolCreateInfo;
+        {
+            poolCreateInfo.sType            = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+            poolCreateInfo.pNext            = nullptr;
+            poolCreateInfo.flags            = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
+            poolCreateInfo.maxSets          = VKDescriptorCache::maxCachedDescriptorSets;
+            poolCreateInfo.poolSizeCount    = static_cast<std::uint32_t>(poolSizes.size());
+            poolCreateInfo.pPoolSizes       = poolSizes.data();
+        }
+        VkResult result = vkCreateDescriptorPool(device_, &poolCreateInfo, nullptr, cachePool_.ReleaseAndGetAddressOf());
+        VKThrowIfFailed(result, "failed to create Vulkan descriptor pool for descriptor cache");
+    }
+
+    VkDescriptorSetAllocateInfo allocInfo;
+    {
+        allocInfo.sType                 = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        allocInfo.pNext                 = nullptr;
+        allocInfo.descriptorPool        = cachePool_.Get();
+        allocInfo.descriptorSetCount    = 1;
+        allocInfo.pSetLayouts           = &setLayout_;
+    }
+
+    /* Fall back to staging descriptor sets if the pool is fragmented */
+    VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
+    if (vkAllocateDescriptorSets(device_, &allocInfo, &descriptorSet) != VK_SUCCESS)
+        return VK_NULL_HANDLE;
+
+    return descriptorSet;
+}
+
 
 } // /namespace LLGL
 
@@ -10,11 +10,15 @@
 
 
 #include "../Vulkan.h"
+#include "../VKPtr.h"
 #include "VKPipelineLayout.h"
 #include "VKDescriptorSetWriter.h"
 #include <LLGL/Container/SmallVector.h>
+#include <LLGL/Container/Allocator.h>
 #include <LLGL/Container/ArrayView.h>
 #include <mutex>
+#include <vector>
+#include <cstdint>
 
 
 namespace LLGL
@@ -27,7 +31,12 @@ class VKSampler;
 class VKStagingDescriptorSetPool;
 struct VKLayoutBinding;
 
-// Vulkan descriptor wrapper to manage dynamic descriptor bindings.
+/*
+Vulkan descriptor wrapper to manage dynamic descriptor bindings.
+Descriptors are written into a scratch descriptor set and copied into a new descriptor set when the cache is flushed.
+Since the resulting descriptor sets only depend on the native handles that are bound to each binding slot,
+they are cached by these handles and reused across draw calls and frames until one of their resources is released (see InvalidateResource).
+*/
 class VKDescriptorCache
 {
 
@@ -48,12 +57,29 @@ class VKDescriptorCache
         // Emplaces a descriptor into the cache for the specified resource.
         void EmplaceDescriptor(Resource& resource, const VKLayoutBinding& binding, VKDescriptorSetWriter& setWriter);
 
+        // Emplaces a contiguous range of descriptors into the cache. Null pointers in 'resources' are skipped.
+        void EmplaceDescriptors(std::uint32_t numResources, Resource* const* resources, const VKLayoutBinding* bindings, VKDescriptorSetWriter& setWriter);
+
         /*
-        Flushes all changed descriptor by allocating a new descriptor set.
+        Flushes all changed descriptor by allocating a new descriptor set, or returns a previously cached descriptor set with the same bindings.
         Otherwise, no changes took place (i.e. IsInvalidated() is false) and VK_NULL_HANDLE is returned.
+        If a cached descriptor set is returned, the descriptor writes are kept in 'setWriter' until the next flush or FlushPendingWrites.
         */
         VkDescriptorSet FlushDescriptorSet(VKStagingDescriptorSetPool& pool, VKDescriptorSetWriter& setWriter);
 
+        // Releases all cached descriptor sets that refer to the specified native resource handle. This must be called before the resource is destroyed.
+        void InvalidateResource(std::uint64_t resourceHandle);
+
+        // Returns the key of a native Vulkan handle (VkBuffer, VkImageView, or VkSampler) to be passed to InvalidateResource.
+        template <typename T>
+        static std::uint64_t GetResourceKey(T handle)
+        {
+            return (std::uint64_t)(handle);
+        }
+
+        // Applies all descriptor writes that have been deferred by cache hits to the scratch descriptor sets. This must be called before 'setWriter' is reset.
+        static void FlushPendingWrites(VkDevice device, VKDescriptorSetWriter& setWriter);
+
         // Returns true if any cache entries are invalidated and need to be flushed again.
         inline bool IsInvalidated() const
         {
@@ -66,18 +92,47 @@ class VKDescriptorCache
             return numDescriptors_;
         }
 
+    public:
+
+        // Maximum number of descriptor sets that are cached by their bindings. Further binding combinations are copied into staging descriptor sets.
+        static constexpr std::uint32_t maxCachedDescriptorSets = 256;
+
+    private:
+
+        // Binding keys are allocated with the global LLGL allocator, so cache rebuilds are visible in the allocator statistics.
+        using BindingKeyList = std::vector<std::uint64_t, HeapAllocator<std::uint64_t>>;
+
+        struct CachedDescriptorSet
+        {
+            std::uint64_t   hash;
+            BindingKeyList  bindingKeys;
+            VkDescriptorSet descriptorSet;
+        };
+
+        using DescriptorSetList = std::vector<CachedDescriptorSet, HeapAllocator<CachedDescriptorSet>>;
+
     private:
 
         VkDescriptorBufferInfo* NextBufferInfoOrUpdateCache(VKDescriptorSetWriter& setWriter);
         VkDescriptorImageInfo* NextImageInfoOrUpdateCache(VKDescriptorSetWriter& setWriter);
 
         void EmplaceBufferDescriptor(VKBuffer& bufferVK, const VKLayoutBinding& binding, VKDescriptorSetWriter& setWriter);
+        void EmplaceAccelerationStructureDescriptor(VKBuffer& bufferVK, const VKLayoutBinding& binding, VKDescriptorSetWriter& setWriter);
         void EmplaceTextureDescriptor(VKTexture& textureVK, const VKLayoutBinding& binding, VKDescriptorSetWriter& setWriter);
         void EmplaceSamplerDescriptor(VKSampler& samplerVK, const VKLayoutBinding& binding, VKDescriptorSetWriter& setWriter);
 
         void BuildCopyDescriptors(ArrayView<VKLayoutBinding> bindings);
         void UpdateCopyDescriptorSet(VkDescriptorSet dstSet);
 
+        // Stores the key of the resource that is written to the specified binding slot of the scratch descriptor set.
+        void SetBindingKey(std::uint32_t dstBinding, std::uint64_t key);
+
+        // Returns the hash of all binding keys of the scratch descriptor set.
+        std::uint64_t HashBindingKeys() const;
+
+        // Allocates a new descriptor set from the cache pool or returns VK_NULL_HANDLE if the cache is full.
+        VkDescriptorSet AllocateCachedDescriptorSet();
+
     private:
 
         VkDevice                                device_         = VK_NULL_HANDLE;
@@ -89,6 +144,10 @@ class VKDescriptorCache
         SmallVector<VkCopyDescriptorSet, 4>     copyDescs_;
         std::mutex                              copyDescMutex_;
 
+        BindingKeyList                          bindingKeys_;                       // Keys of the native resources written to each binding slot of the scratch descriptor set.
+        DescriptorSetList                       cachedSets_;                        // Cached descriptor sets sorted by hash.
+        VKPtr<VkDescriptorPool>                 cachePool_;                         // Descriptor pool for cached descriptor sets; allocated on demand.
+
         bool                                    dirty_          = false;
 
 };
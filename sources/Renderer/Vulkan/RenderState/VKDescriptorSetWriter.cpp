@@ -18,8 +18,10 @@ VKDescriptorSetWriter::VKDescriptorSetWriter(
     std::uint32_t numReservedWrites,
     std::uint32_t numReservedCopies)
 :
-    bufferInfos_ { numResourceViewsMax },
-    imageInfos_  { numResourceViewsMax }
+    bufferInfos_      { numResourceViewsMax },
+    imageInfos_       { numResourceViewsMax },
+    accelStructInfos_ { numResourceViewsMax },
+    accelStructs_     { numResourceViewsMax }
 {
     writes_.reserve(numReservedWrites);
     copies_.reserve(numReservedCopies);
@@ -31,6 +33,7 @@ void VKDescriptorSetWriter::Reset()
     copies_.clear();
     numBufferInfos_ = 0;
     numImageInfos_ = 0;
+    numAccelStructInfos_ = 0;
 }
 
 void VKDescriptorSetWriter::Reset(
@@ -42,12 +45,18 @@ void VKDescriptorSetWriter::Reset(
         bufferInfos_.resize(numResourceViewsMax);
     if (imageInfos_.size() < numResourceViewsMax)
         imageInfos_.resize(numResourceViewsMax);
+    if (accelStructInfos_.size() < numResourceViewsMax)
+    {
+        accelStructInfos_.resize(numResourceViewsMax);
+        accelStructs_.resize(numResourceViewsMax);
+    }
     writes_.clear();
     copies_.clear();
     writes_.reserve(numReservedWrites);
     copies_.reserve(numReservedCopies);
     numBufferInfos_ = 0;
     numImageInfos_ = 0;
+    numAccelStructInfos_ = 0;
 }
 
 VkDescriptorBufferInfo* VKDescriptorSetWriter::NextBufferInfo()
@@ -66,6 +75,24 @@ VkDescriptorImageInfo* VKDescriptorSetWriter::NextImageInfo()
         return nullptr;
 }
 
+const VkWriteDescriptorSetAccelerationStructureKHR* VKDescriptorSetWriter::NextAccelerationStructureInfo(VkAccelerationStructureKHR accelStruct)
+{
+    if (!(numAccelStructInfos_ < accelStructInfos_.size()))
+        return nullptr;
+
+    const std::uint32_t index = numAccelStructInfos_++;
+    accelStructs_[index] = accelStruct;
+
+    VkWriteDescriptorSetAccelerationStructureKHR& accelStructInfo = accelStructInfos_[index];
+    {
+        accelStructInfo.sType                       = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR;
+        accelStructInfo.pNext                       = nullptr;
+        accelStructInfo.accelerationStructureCount  = 1;
+        accelStructInfo.pAccelerationStructures     = &(accelStructs_[index]);
+    }
+    return &accelStructInfo;
+}
+
 VkWriteDescriptorSet* VKDescriptorSetWriter::NextWriteDescriptor()
 {
     VkWriteDescriptorSet initialWriteDescriptor = {};
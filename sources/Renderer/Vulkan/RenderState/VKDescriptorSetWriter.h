@@ -42,6 +42,9 @@ class VKDescriptorSetWriter
         VkDescriptorBufferInfo* NextBufferInfo();
         VkDescriptorImageInfo* NextImageInfo();
 
+        // Returns the next write information for the specified acceleration structure that must be chained to a VkWriteDescriptorSet.
+        const VkWriteDescriptorSetAccelerationStructureKHR* NextAccelerationStructureInfo(VkAccelerationStructureKHR accelStruct);
+
         VkWriteDescriptorSet* NextWriteDescriptor();
         VkCopyDescriptorSet* NextCopyDescriptor();
 
@@ -80,6 +83,10 @@ class VKDescriptorSetWriter
         std::vector<VkDescriptorImageInfo>  imageInfos_;
         std::uint32_t                       numImageInfos_      = 0;
 
+        std::vector<VkWriteDescriptorSetAccelerationStructureKHR>   accelStructInfos_;
+        std::vector<VkAccelerationStructureKHR>                     accelStructs_;
+        std::uint32_t                                               numAccelStructInfos_    = 0;
+
         std::vector<VkWriteDescriptorSet>   writes_;
         std::vector<VkCopyDescriptorSet>    copies_;
 
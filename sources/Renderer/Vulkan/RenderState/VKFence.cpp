@@ -7,14 +7,19 @@
 
 #include "VKFence.h"
 #include "../VKCore.h"
+#include "../Ext/VKExtensions.h"
+#include <algorithm>
 
 
 namespace LLGL
 {
 
 
-VKFence::VKFence(VkDevice device) :
-    fence_ { device, vkDestroyFence }
+VKFence::VKFence(VkDevice device, bool hasTimelineSemaphore) :
+    device_             { device                     },
+    fence_              { device, vkDestroyFence     },
+    semaphore_          { device, vkDestroySemaphore },
+    timelineSemaphore_  { device, vkDestroySemaphore }
 {
     VkFenceCreateInfo createInfo;
     {
@@ -24,6 +29,45 @@ VKFence::VKFence(VkDevice device) :
     }
     auto result = vkCreateFence(device, &createInfo, nullptr, fence_.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan fence");
+
+    VkSemaphoreCreateInfo semaphoreInfo;
+    {
+        semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        semaphoreInfo.pNext = nullptr;
+        semaphoreInfo.flags = 0;
+    }
+    result = vkCreateSemaphore(device, &semaphoreInfo, nullptr, semaphore_.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan semaphore for fence");
+
+    if (hasTimelineSemaphore)
+    {
+        VkSemaphoreTypeCreateInfoKHR typeInfo;
+        {
+            typeInfo.sType          = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR;
+            typeInfo.pNext          = nullptr;
+            typeInfo.semaphoreType  = VK_SEMAPHORE_TYPE_TIMELINE_KHR;
+            typeInfo.initialValue   = 0;
+        }
+        semaphoreInfo.pNext = &typeInfo;
+        result = vkCreateSemaphore(device, &semaphoreInfo, nullptr, timelineSemaphore_.ReleaseAndGetAddressOf());
+        VKThrowIfFailed(result, "failed to create Vulkan timeline semaphore for fence");
+    }
+}
+
+std::uint64_t VKFence::GetCompletedValue()
+{
+    if (timelineSemaphore_.Get() != VK_NULL_HANDLE)
+    {
+        std::uint64_t value = 0;
+        VkResult result = vkGetSemaphoreCounterValueKHR(device_, timelineSemaphore_, &value);
+        VKThrowIfFailed(result, "failed to query Vulkan timeline semaphore counter value");
+        return value;
+    }
+
+    /* Emulated timeline has completed the last submitted value once the VkFence is signaled */
+    if (completedValue_ < signaledValue_ && vkGetFenceStatus(device_, fence_) == VK_SUCCESS)
+        completedValue_ = signaledValue_;
+    return completedValue_;
 }
 
 void VKFence::Reset(VkDevice device)
@@ -36,6 +80,56 @@ bool VKFence::Wait(VkDevice device, std::uint64_t timeout)
     return (vkWaitForFences(device, 1, fence_.GetAddressOf(), VK_TRUE, timeout) == VK_SUCCESS);
 }
 
+bool VKFence::WaitValue(std::uint64_t value, std::uint64_t timeout)
+{
+    if (timelineSemaphore_.Get() != VK_NULL_HANDLE)
+    {
+        VkSemaphore semaphore = timelineSemaphore_.Get();
+        VkSemaphoreWaitInfoKHR waitInfo;
+        {
+            waitInfo.sType          = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR;
+            waitInfo.pNext          = nullptr;
+            waitInfo.flags          = 0;
+            waitInfo.semaphoreCount = 1;
+            waitInfo.pSemaphores    = &semaphore;
+            waitInfo.pValues        = &value;
+        }
+        return (vkWaitSemaphoresKHR(device_, &waitInfo, timeout) == VK_SUCCESS);
+    }
+
+    /* Waiting for an earlier value waits for the last submitted one, which is conservative but correct */
+    if (completedValue_ >= value)
+        return true;
+    if (signaledValue_ < value || !Wait(device_, timeout))
+        return false;
+    completedValue_ = signaledValue_;
+    return true;
+}
+
+void VKFence::SetSignaledValue(std::uint64_t value)
+{
+    signaledValue_ = std::max(signaledValue_, value);
+}
+
+VkSemaphore VKFence::PrepareSemaphoreSignal()
+{
+    submitted_ = true;
+    if (semaphoreSignaled_)
+        return semaphore_.Get();
+    semaphoreSignaled_ = true;
+    return VK_NULL_HANDLE;
+}
+
+VkSemaphore VKFence::WaitSemaphore()
+{
+    if (semaphoreSignaled_)
+    {
+        semaphoreSignaled_ = false;
+        return semaphore_.Get();
+    }
+    return VK_NULL_HANDLE;
+}
+
 
 } // /namespace LLGL
 
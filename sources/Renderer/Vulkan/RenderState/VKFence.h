@@ -19,25 +19,78 @@ namespace LLGL
 {
 
 
+/*
+Vulkan implementation of the <Fence> interface.
+Each fence also owns a binary semaphore that is signaled together with the VkFence, so other command queues can wait for it on the GPU (see CommandQueue::SubmitWait).
+Since a binary semaphore can only be waited on once per signal operation, its state is tracked to consume pending signals before the fence is submitted again.
+Timeline values are served by a timeline semaphore if VK_KHR_timeline_semaphore is enabled. Otherwise, they are emulated with the VkFence for the last submitted value.
+*/
 class VKFence final : public Fence
 {
 
     public:
 
-        VKFence(VkDevice device);
+        std::uint64_t GetCompletedValue() override;
+
+    public:
+
+        VKFence(VkDevice device, bool hasTimelineSemaphore = false);
 
         void Reset(VkDevice device);
         bool Wait(VkDevice device, std::uint64_t timeout);
 
+        // Waits until the specified timeline value has been completed. Emulated timelines cannot complete values that have not been submitted yet.
+        bool WaitValue(std::uint64_t value, std::uint64_t timeout);
+
+        // Stores the highest timeline value that has been submitted for this fence.
+        void SetSignaledValue(std::uint64_t value);
+
+        // Returns the semaphore that must be waited on before it can be signaled again, or VK_NULL_HANDLE if there is no pending signal. Marks the fence as submitted.
+        VkSemaphore PrepareSemaphoreSignal();
+
+        // Returns the semaphore to wait on for the last signal operation, or VK_NULL_HANDLE if that signal has already been consumed by another wait operation.
+        VkSemaphore WaitSemaphore();
+
         // Returns the native VkFence handle.
         inline VkFence GetVkFence() const
         {
             return fence_;
         }
 
+        // Returns the native VkSemaphore handle.
+        inline VkSemaphore GetVkSemaphore() const
+        {
+            return semaphore_;
+        }
+
+        // Returns the native timeline VkSemaphore handle or VK_NULL_HANDLE if timelines are emulated.
+        inline VkSemaphore GetTimelineSemaphore() const
+        {
+            return timelineSemaphore_;
+        }
+
+        // Returns the highest timeline value that has been submitted for this fence.
+        inline std::uint64_t GetSignaledValue() const
+        {
+            return signaledValue_;
+        }
+
+        // Returns true if this fence has been submitted to a command queue at least once.
+        inline bool IsSubmitted() const
+        {
+            return submitted_;
+        }
+
     private:
 
-        VKPtr<VkFence> fence_;
+        VkDevice            device_             = VK_NULL_HANDLE;
+        VKPtr<VkFence>      fence_;
+        VKPtr<VkSemaphore>  semaphore_;
+        VKPtr<VkSemaphore>  timelineSemaphore_;
+        std::uint64_t       signaledValue_      = 0;
+        std::uint64_t       completedValue_     = 0;     // Only used for emulated timelines.
+        bool                semaphoreSignaled_  = false; // True, if the semaphore has a signal operation no wait operation has been submitted for.
+        bool                submitted_          = false;
 
 };
 
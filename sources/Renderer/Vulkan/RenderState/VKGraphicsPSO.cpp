@@ -16,6 +16,7 @@
 #include "../../CheckedCast.h"
 #include "../../PipelineStateUtils.h"
 #include <cstddef>
+#include <cstring>
 #include <LLGL/PipelineStateFlags.h>
 #include <LLGL/Utils/ForRange.h>
 #include <LLGL/Container/SmallVector.h>
@@ -33,21 +34,32 @@ VKGraphicsPSO::VKGraphicsPSO(
     const VKGraphicsPipelineLimits&     limits,
     PipelineCache*                      pipelineCache)
 :
-    VKPipelineState    { device, VK_PIPELINE_BIND_POINT_GRAPHICS, GetShadersAsArray(desc), desc.pipelineLayout },
-    scissorEnabled_    { desc.rasterizer.scissorTestEnabled                                                    },
-    hasDynamicScissor_ { desc.scissors.empty()                                                                 }
+    VKPipelineState    { device, VK_PIPELINE_BIND_POINT_GRAPHICS, GetShadersAsArray(desc), desc.specializationConstants, desc.pipelineLayout, desc.placeholder },
+    scissorEnabled_    { desc.rasterizer.scissorTestEnabled                                                                       },
+    hasDynamicScissor_ { desc.scissors.empty()                                                                                    }
 {
     /* Get render pass from descriptor or default render pass */
     const RenderPass* renderPass = (desc.renderPass != nullptr ? desc.renderPass : defaultRenderPass);
     if (renderPass == nullptr)
         throw std::invalid_argument("cannot create Vulkan graphics pipeline without render pass");
 
-    /* Create Vulkan graphics pipeline object */
+    /*
+    Create Vulkan graphics pipeline object; the descriptor is copied since it might be compiled asynchronously.
+    The native pipeline cache is selected by the compiling thread, so PSOs can be compiled concurrently without contention on a single cache.
+    */
     const VKRenderPass* renderPassVK = LLGL_CAST(const VKRenderPass*, renderPass);
-    if (VKPipelineCache* pipelineCacheVK = (pipelineCache != nullptr ? LLGL_CAST(VKPipelineCache*, pipelineCache) : nullptr))
-        CreateVkPipeline(device, *renderPassVK, limits, desc, pipelineCacheVK->GetNative());
-    else
-        CreateVkPipeline(device, *renderPassVK, limits, desc);
+    CompileVkPipeline(
+        [this, device, renderPassVK, limits, desc, pipelineCache]()
+        {
+            CreateVkPipeline(device, *renderPassVK, limits, desc, VKPipelineCache::GetNativeForCurrentThread(pipelineCache));
+        },
+        desc.asyncCompilation
+    );
+}
+
+VKGraphicsPSO::~VKGraphicsPSO()
+{
+    WaitForCompilation();
 }
 
 
@@ -285,6 +297,32 @@ static void CreateDynamicState(
     if (desc.stencil.referenceDynamic)
         dynamicStatesVK.push_back(VK_DYNAMIC_STATE_STENCIL_REFERENCE);
 
+    /* Shading rate is a command buffer state, so it must be dynamic for all graphics pipelines (see VKCommandBuffer::SetShadingRate) */
+    if (HasExtension(VKExt::KHR_fragment_shading_rate))
+        dynamicStatesVK.push_back(VK_DYNAMIC_STATE_FRAGMENT_SHADING_RATE_KHR);
+
+    /* Append optional dynamic states to share this PSO between multiple render-state variants */
+    if (desc.dynamicStates != 0 && HasExtension(VKExt::EXT_extended_dynamic_state))
+    {
+        if ((desc.dynamicStates & DynamicStateFlags::CullMode) != 0)
+            dynamicStatesVK.push_back(VK_DYNAMIC_STATE_CULL_MODE_EXT);
+        if ((desc.dynamicStates & DynamicStateFlags::DepthState) != 0)
+        {
+            dynamicStatesVK.push_back(VK_DYNAMIC_STATE_DEPTH_TEST_ENABLE_EXT);
+            dynamicStatesVK.push_back(VK_DYNAMIC_STATE_DEPTH_WRITE_ENABLE_EXT);
+            dynamicStatesVK.push_back(VK_DYNAMIC_STATE_DEPTH_COMPARE_OP_EXT);
+        }
+        if ((desc.dynamicStates & DynamicStateFlags::StencilState) != 0)
+        {
+            dynamicStatesVK.push_back(VK_DYNAMIC_STATE_STENCIL_TEST_ENABLE_EXT);
+            dynamicStatesVK.push_back(VK_DYNAMIC_STATE_STENCIL_OP_EXT);
+            dynamicStatesVK.push_back(VK_DYNAMIC_STATE_STENCIL_COMPARE_MASK);
+            dynamicStatesVK.push_back(VK_DYNAMIC_STATE_STENCIL_WRITE_MASK);
+        }
+        if ((desc.dynamicStates & DynamicStateFlags::PrimitiveTopology) != 0)
+            dynamicStatesVK.push_back(VK_DYNAMIC_STATE_PRIMITIVE_TOPOLOGY_EXT);
+    }
+
     createInfo.sType                = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
     createInfo.pNext                = nullptr;
     createInfo.flags                = 0;
@@ -299,9 +337,10 @@ void VKGraphicsPSO::CreateVkPipeline(
     const GraphicsPipelineDescriptor&   desc,
     VkPipelineCache                     pipelineCache)
 {
-    /* Get shader program object */
+    /* Get shader program object; mesh pipelines have no vertex shader */
+    const bool isMeshPipeline = (desc.meshShader != nullptr);
     const VKShader* vertexShaderVK = LLGL_CAST(const VKShader*, desc.vertexShader);
-    if (vertexShaderVK == nullptr)
+    if (vertexShaderVK == nullptr && !isMeshPipeline)
         throw std::invalid_argument("cannot create Vulkan graphics pipeline without vertex shader");
 
     auto FillAndAppendShaderStageCreateInfo = [this](
@@ -323,11 +362,14 @@ void VKGraphicsPSO::CreateVkPipeline(
     FillAndAppendShaderStageCreateInfo(desc.tessControlShader,      shaderStageCreateInfos);
     FillAndAppendShaderStageCreateInfo(desc.tessEvaluationShader,   shaderStageCreateInfos);
     FillAndAppendShaderStageCreateInfo(desc.geometryShader,         shaderStageCreateInfos);
+    FillAndAppendShaderStageCreateInfo(desc.taskShader,             shaderStageCreateInfos);
+    FillAndAppendShaderStageCreateInfo(desc.meshShader,             shaderStageCreateInfos);
     FillAndAppendShaderStageCreateInfo(desc.fragmentShader,         shaderStageCreateInfos);
 
     /* Initialize vertex input descriptor */
     VkPipelineVertexInputStateCreateInfo vertexInputCreateInfo;
-    vertexShaderVK->FillVertexInputStateCreateInfo(vertexInputCreateInfo);
+    if (vertexShaderVK != nullptr)
+        vertexShaderVK->FillVertexInputStateCreateInfo(vertexInputCreateInfo);
 
     /* Initialize input assembly state */
     VkPipelineInputAssemblyStateCreateInfo inputAssembly;
@@ -367,17 +409,22 @@ void VKGraphicsPSO::CreateVkPipeline(
     VkPipelineDynamicStateCreateInfo dynamicState;
     CreateDynamicState(desc, dynamicState, dynamicStatesVK);
 
+    /* Pass attachment formats instead of a native render pass for dynamic rendering */
+    VkPipelineRenderingCreateInfoKHR renderingCreateInfo;
+    if (renderPass.IsDynamicRendering())
+        renderPass.GetVkPipelineRenderingCreateInfo(renderingCreateInfo);
+
     /* Create graphics pipeline state object */
     VkGraphicsPipelineCreateInfo createInfo;
     {
         createInfo.sType                = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
-        createInfo.pNext                = nullptr;
+        createInfo.pNext                = (renderPass.IsDynamicRendering() ? &renderingCreateInfo : nullptr);
         createInfo.flags                = 0;
         createInfo.stageCount           = static_cast<std::uint32_t>(shaderStageCreateInfos.size());
         createInfo.pStages              = shaderStageCreateInfos.data();
-        createInfo.pVertexInputState    = (&vertexInputCreateInfo);
-        createInfo.pInputAssemblyState  = (&inputAssembly);
-        createInfo.pTessellationState   = (inputAssembly.topology == VK_PRIMITIVE_TOPOLOGY_PATCH_LIST ? &tessellationState : nullptr);
+        createInfo.pVertexInputState    = (isMeshPipeline ? nullptr : &vertexInputCreateInfo);
+        createInfo.pInputAssemblyState  = (isMeshPipeline ? nullptr : &inputAssembly);
+        createInfo.pTessellationState   = (!isMeshPipeline && inputAssembly.topology == VK_PRIMITIVE_TOPOLOGY_PATCH_LIST ? &tessellationState : nullptr);
         createInfo.pViewportState       = (&viewportState);
         createInfo.pRasterizationState  = (&rasterizerState);
         createInfo.pMultisampleState    = (&multisampleState);
@@ -386,12 +433,380 @@ void VKGraphicsPSO::CreateVkPipeline(
         createInfo.pDynamicState        = (!dynamicStatesVK.empty() ? &dynamicState : nullptr);
         createInfo.layout               = GetVkPipelineLayout();
         createInfo.renderPass           = renderPass.GetVkRenderPass();
-        createInfo.subpass              = 0;
+        createInfo.subpass              = desc.subpass;
         createInfo.basePipelineHandle   = VK_NULL_HANDLE;
         createInfo.basePipelineIndex    = 0;
     }
-    VkResult result = vkCreateGraphicsPipelines(device, pipelineCache, 1, &createInfo, nullptr, ReleaseAndGetAddressOfVkPipeline());
-    VKThrowIfFailed(result, "failed to create Vulkan graphics pipeline");
+
+    if (SupportsPipelineLibraries(desc))
+        CreateVkPipelineFromLibraries(device, renderPass, desc, createInfo, pipelineCache);
+    else
+    {
+        VkResult result = vkCreateGraphicsPipelines(device, pipelineCache, 1, &createInfo, nullptr, ReleaseAndGetAddressOfVkPipeline());
+        VKThrowIfFailed(result, "failed to create Vulkan graphics pipeline");
+    }
+}
+
+bool VKGraphicsPSO::SupportsPipelineLibraries(const GraphicsPipelineDescriptor& desc) const
+{
+    /*
+    Mesh pipelines and pipelines with rasterizer discard don't use all four parts,
+    and PSOs with a pipeline layout permutation can't share their parts with other PSOs
+    */
+    return
+    (
+        HasExtension(VKExt::EXT_graphics_pipeline_library) &&
+        desc.meshShader == nullptr                          &&
+        !desc.rasterizer.discardEnabled                     &&
+        !HasPipelineLayoutPermutation()
+    );
+}
+
+static void AppendToLibraryKey(VKPipelineLibraryKey& key, const void* data, std::size_t size)
+{
+    const char* bytes = static_cast<const char*>(data);
+    key.insert(key.end(), bytes, bytes + size);
+}
+
+// Only used for scalars, native handles, and arrays of structures without padding.
+template <typename T>
+static void AppendToLibraryKey(VKPipelineLibraryKey& key, const T& value)
+{
+    AppendToLibraryKey(key, &value, sizeof(T));
+}
+
+static void AppendShaderStagesToLibraryKey(VKPipelineLibraryKey& key, std::uint32_t stageCount, const VkPipelineShaderStageCreateInfo* stages)
+{
+    AppendToLibraryKey(key, stageCount);
+    for_range(i, stageCount)
+    {
+        const VkPipelineShaderStageCreateInfo& stage = stages[i];
+        AppendToLibraryKey(key, stage.stage);
+        AppendToLibraryKey(key, stage.module);
+        AppendToLibraryKey(key, stage.pName, std::strlen(stage.pName) + 1);
+        if (const VkSpecializationInfo* specialization = stage.pSpecializationInfo)
+        {
+            AppendToLibraryKey(key, specialization->mapEntryCount);
+            for_range(j, specialization->mapEntryCount)
+            {
+                AppendToLibraryKey(key, specialization->pMapEntries[j].constantID);
+                AppendToLibraryKey(key, specialization->pMapEntries[j].offset);
+                AppendToLibraryKey(key, specialization->pMapEntries[j].size);
+            }
+            AppendToLibraryKey(key, specialization->pData, specialization->dataSize);
+        }
+        else
+            AppendToLibraryKey(key, 0u);
+    }
+}
+
+static void AppendVertexInputStateToLibraryKey(VKPipelineLibraryKey& key, const VkGraphicsPipelineCreateInfo& createInfo)
+{
+    const VkPipelineVertexInputStateCreateInfo& vertexInput = *createInfo.pVertexInputState;
+    AppendToLibraryKey(key, vertexInput.vertexBindingDescriptionCount);
+    AppendToLibraryKey(key, vertexInput.pVertexBindingDescriptions, sizeof(VkVertexInputBindingDescription) * vertexInput.vertexBindingDescriptionCount);
+    AppendToLibraryKey(key, vertexInput.vertexAttributeDescriptionCount);
+    AppendToLibraryKey(key, vertexInput.pVertexAttributeDescriptions, sizeof(VkVertexInputAttributeDescription) * vertexInput.vertexAttributeDescriptionCount);
+
+    const VkPipelineInputAssemblyStateCreateInfo& inputAssembly = *createInfo.pInputAssemblyState;
+    AppendToLibraryKey(key, inputAssembly.topology);
+    AppendToLibraryKey(key, inputAssembly.primitiveRestartEnable);
+}
+
+static void AppendPreRasterizationStateToLibraryKey(VKPipelineLibraryKey& key, const VkGraphicsPipelineCreateInfo& createInfo)
+{
+    if (const VkPipelineTessellationStateCreateInfo* tessellation = createInfo.pTessellationState)
+        AppendToLibraryKey(key, tessellation->patchControlPoints);
+    else
+        AppendToLibraryKey(key, 0u);
+
+    const VkPipelineViewportStateCreateInfo& viewport = *createInfo.pViewportState;
+    AppendToLibraryKey(key, viewport.viewportCount);
+    if (viewport.pViewports != nullptr)
+        AppendToLibraryKey(key, viewport.pViewports, sizeof(VkViewport) * viewport.viewportCount);
+    AppendToLibraryKey(key, viewport.scissorCount);
+    if (viewport.pScissors != nullptr)
+        AppendToLibraryKey(key, viewport.pScissors, sizeof(VkRect2D) * viewport.scissorCount);
+
+    const VkPipelineRasterizationStateCreateInfo& rasterizer = *createInfo.pRasterizationState;
+    AppendToLibraryKey(key, rasterizer.depthClampEnable);
+    AppendToLibraryKey(key, rasterizer.rasterizerDiscardEnable);
+    AppendToLibraryKey(key, rasterizer.polygonMode);
+    AppendToLibraryKey(key, rasterizer.cullMode);
+    AppendToLibraryKey(key, rasterizer.frontFace);
+    AppendToLibraryKey(key, rasterizer.depthBiasEnable);
+    AppendToLibraryKey(key, rasterizer.depthBiasConstantFactor);
+    AppendToLibraryKey(key, rasterizer.depthBiasClamp);
+    AppendToLibraryKey(key, rasterizer.depthBiasSlopeFactor);
+    AppendToLibraryKey(key, rasterizer.lineWidth);
+    AppendToLibraryKey(key, (rasterizer.pNext != nullptr));
+}
+
+static void AppendMultisampleStateToLibraryKey(VKPipelineLibraryKey& key, const VkGraphicsPipelineCreateInfo& createInfo)
+{
+    const VkPipelineMultisampleStateCreateInfo& multisample = *createInfo.pMultisampleState;
+    AppendToLibraryKey(key, multisample.rasterizationSamples);
+    AppendToLibraryKey(key, multisample.sampleShadingEnable);
+    AppendToLibraryKey(key, multisample.minSampleShading);
+    AppendToLibraryKey(key, (multisample.pSampleMask != nullptr ? multisample.pSampleMask[0] : ~0u));
+    AppendToLibraryKey(key, multisample.alphaToCoverageEnable);
+    AppendToLibraryKey(key, multisample.alphaToOneEnable);
+}
+
+static void AppendDepthStencilStateToLibraryKey(VKPipelineLibraryKey& key, const VkGraphicsPipelineCreateInfo& createInfo)
+{
+    const VkPipelineDepthStencilStateCreateInfo& depthStencil = *createInfo.pDepthStencilState;
+    AppendToLibraryKey(key, depthStencil.depthTestEnable);
+    AppendToLibraryKey(key, depthStencil.depthWriteEnable);
+    AppendToLibraryKey(key, depthStencil.depthCompareOp);
+    AppendToLibraryKey(key, depthStencil.depthBoundsTestEnable);
+    AppendToLibraryKey(key, depthStencil.stencilTestEnable);
+    AppendToLibraryKey(key, depthStencil.front);
+    AppendToLibraryKey(key, depthStencil.back);
+    AppendToLibraryKey(key, depthStencil.minDepthBounds);
+    AppendToLibraryKey(key, depthStencil.maxDepthBounds);
+}
+
+static void AppendColorBlendStateToLibraryKey(VKPipelineLibraryKey& key, const VkGraphicsPipelineCreateInfo& createInfo)
+{
+    const VkPipelineColorBlendStateCreateInfo& colorBlend = *createInfo.pColorBlendState;
+    AppendToLibraryKey(key, colorBlend.logicOpEnable);
+    AppendToLibraryKey(key, colorBlend.logicOp);
+    AppendToLibraryKey(key, colorBlend.attachmentCount);
+    AppendToLibraryKey(key, colorBlend.pAttachments, sizeof(VkPipelineColorBlendAttachmentState) * colorBlend.attachmentCount);
+    AppendToLibraryKey(key, colorBlend.blendConstants);
+}
+
+static void AppendDynamicStateToLibraryKey(VKPipelineLibraryKey& key, const VkGraphicsPipelineCreateInfo& createInfo)
+{
+    if (const VkPipelineDynamicStateCreateInfo* dynamicState = createInfo.pDynamicState)
+    {
+        AppendToLibraryKey(key, dynamicState->dynamicStateCount);
+        AppendToLibraryKey(key, dynamicState->pDynamicStates, sizeof(VkDynamicState) * dynamicState->dynamicStateCount);
+    }
+    else
+        AppendToLibraryKey(key, 0u);
+}
+
+// Appends the render pass or, for dynamic rendering, the attachment formats.
+static void AppendRenderPassToLibraryKey(VKPipelineLibraryKey& key, const VkGraphicsPipelineCreateInfo& createInfo, const VKRenderPass& renderPass)
+{
+    AppendToLibraryKey(key, createInfo.renderPass);
+    AppendToLibraryKey(key, createInfo.subpass);
+    if (renderPass.IsDynamicRendering())
+    {
+        VkPipelineRenderingCreateInfoKHR renderingCreateInfo;
+        renderPass.GetVkPipelineRenderingCreateInfo(renderingCreateInfo);
+        AppendToLibraryKey(key, renderingCreateInfo.viewMask);
+        AppendToLibraryKey(key, renderingCreateInfo.colorAttachmentCount);
+        AppendToLibraryKey(key, renderingCreateInfo.pColorAttachmentFormats, sizeof(VkFormat) * renderingCreateInfo.colorAttachmentCount);
+        AppendToLibraryKey(key, renderingCreateInfo.depthAttachmentFormat);
+        AppendToLibraryKey(key, renderingCreateInfo.stencilAttachmentFormat);
+    }
+}
+
+static void LinkVkPipelineLibraries(
+    VkDevice                device,
+    std::size_t             numLibraries,
+    const VkPipeline*       libraries,
+    VkPipelineLayout        layout,
+    VkPipelineCreateFlags   flags,
+    VkPipelineCache         pipelineCache,
+    VkPipeline*             outPipeline)
+{
+    VkPipelineLibraryCreateInfoKHR libraryCreateInfo;
+    {
+        libraryCreateInfo.sType         = VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR;
+        libraryCreateInfo.pNext         = nullptr;
+        libraryCreateInfo.libraryCount  = static_cast<std::uint32_t>(numLibraries);
+        libraryCreateInfo.pLibraries    = libraries;
+    }
+    VkGraphicsPipelineCreateInfo createInfo = {};
+    {
+        createInfo.sType    = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+        createInfo.pNext    = &libraryCreateInfo;
+        createInfo.flags    = flags;
+        createInfo.layout   = layout;
+    }
+    VkResult result = vkCreateGraphicsPipelines(device, pipelineCache, 1, &createInfo, nullptr, outPipeline);
+    VKThrowIfFailed(result, "failed to link Vulkan graphics pipeline libraries");
+}
+
+void VKGraphicsPSO::CreateVkPipelineFromLibraries(
+    VkDevice                            device,
+    const VKRenderPass&                 renderPass,
+    const GraphicsPipelineDescriptor&   desc,
+    const VkGraphicsPipelineCreateInfo& createInfo,
+    VkPipelineCache                     pipelineCache)
+{
+    /* Split shader stages into pre-rasterization and fragment shader stages */
+    SmallVector<VkPipelineShaderStageCreateInfo, 4> preRasterizationStages;
+    SmallVector<VkPipelineShaderStageCreateInfo, 1> fragmentStages;
+    for_range(i, createInfo.stageCount)
+    {
+        if (createInfo.pStages[i].stage == VK_SHADER_STAGE_FRAGMENT_BIT)
+            fragmentStages.push_back(createInfo.pStages[i]);
+        else
+            preRasterizationStages.push_back(createInfo.pStages[i]);
+    }
+
+    /* Parts that depend on the native render pass object must be evicted when the render pass is released */
+    const void* renderPassDependency = (renderPass.IsDynamicRendering() ? nullptr : &renderPass);
+    const void* pipelineLayoutDependency = GetPipelineLayout();
+
+    auto GetOrCreateLibraryPart = [device, pipelineCache, &createInfo](
+        VkGraphicsPipelineLibraryFlagsEXT       partFlags,
+        const VkGraphicsPipelineCreateInfo&     partCreateInfo,
+        const VKPipelineLibraryKey&             key,
+        const ArrayView<const void*>&           dependencies) -> VKPipelineLibraryRef
+    {
+        return VKPipelineLibraryPool::Get().GetOrCreateLibrary(
+            key,
+            dependencies,
+            [device, pipelineCache, partFlags, &partCreateInfo, &createInfo]() -> VKPtr<VkPipeline>
+            {
+                /* Chain library part info in front of the dynamic rendering info of the monolithic PSO */
+                VkGraphicsPipelineLibraryCreateInfoEXT libraryCreateInfo;
+                {
+                    libraryCreateInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT;
+                    libraryCreateInfo.pNext = createInfo.pNext;
+                    libraryCreateInfo.flags = partFlags;
+                }
+                VkGraphicsPipelineCreateInfo libraryPartCreateInfo = partCreateInfo;
+                {
+                    libraryPartCreateInfo.pNext = &libraryCreateInfo;
+                    libraryPartCreateInfo.flags = VK_PIPELINE_CREATE_LIBRARY_BIT_KHR | VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT;
+                }
+                VKPtr<VkPipeline> library{ device, vkDestroyPipeline };
+                VkResult result = vkCreateGraphicsPipelines(device, pipelineCache, 1, &libraryPartCreateInfo, nullptr, library.ReleaseAndGetAddressOf());
+                VKThrowIfFailed(result, "failed to create Vulkan graphics pipeline library");
+                return library;
+            }
+        );
+    };
+
+    /* Create or share vertex input interface part */
+    VkGraphicsPipelineCreateInfo partCreateInfo;
+    VKPipelineLibraryKey key;
+    {
+        partCreateInfo = VkGraphicsPipelineCreateInfo{};
+        {
+            partCreateInfo.sType                = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+            partCreateInfo.pVertexInputState    = createInfo.pVertexInputState;
+            partCreateInfo.pInputAssemblyState  = createInfo.pInputAssemblyState;
+            partCreateInfo.pDynamicState        = createInfo.pDynamicState;
+        }
+        AppendToLibraryKey(key, VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT);
+        AppendVertexInputStateToLibraryKey(key, createInfo);
+        AppendDynamicStateToLibraryKey(key, createInfo);
+        libraries_[0] = GetOrCreateLibraryPart(VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT, partCreateInfo, key, {});
+    }
+
+    /* Create or share pre-rasterization shaders part */
+    {
+        partCreateInfo = VkGraphicsPipelineCreateInfo{};
+        {
+            partCreateInfo.sType                = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+            partCreateInfo.stageCount           = static_cast<std::uint32_t>(preRasterizationStages.size());
+            partCreateInfo.pStages              = preRasterizationStages.data();
+            partCreateInfo.pTessellationState   = createInfo.pTessellationState;
+            partCreateInfo.pViewportState       = createInfo.pViewportState;
+            partCreateInfo.pRasterizationState  = createInfo.pRasterizationState;
+            partCreateInfo.pDynamicState        = createInfo.pDynamicState;
+            partCreateInfo.layout               = createInfo.layout;
+            partCreateInfo.renderPass           = createInfo.renderPass;
+            partCreateInfo.subpass              = createInfo.subpass;
+        }
+        key.clear();
+        AppendToLibraryKey(key, VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT);
+        AppendShaderStagesToLibraryKey(key, partCreateInfo.stageCount, partCreateInfo.pStages);
+        AppendPreRasterizationStateToLibraryKey(key, createInfo);
+        AppendDynamicStateToLibraryKey(key, createInfo);
+        AppendToLibraryKey(key, createInfo.layout);
+        AppendRenderPassToLibraryKey(key, createInfo, renderPass);
+        const void* dependencies[] =
+        {
+            LLGL_CAST(const VKShader*, desc.vertexShader),
+            LLGL_CAST(const VKShader*, desc.tessControlShader),
+            LLGL_CAST(const VKShader*, desc.tessEvaluationShader),
+            LLGL_CAST(const VKShader*, desc.geometryShader),
+            pipelineLayoutDependency,
+            renderPassDependency,
+        };
+        libraries_[1] = GetOrCreateLibraryPart(VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT, partCreateInfo, key, dependencies);
+    }
+
+    /* Create or share fragment shader part */
+    {
+        partCreateInfo = VkGraphicsPipelineCreateInfo{};
+        {
+            partCreateInfo.sType                = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+            partCreateInfo.stageCount           = static_cast<std::uint32_t>(fragmentStages.size());
+            partCreateInfo.pStages              = fragmentStages.data();
+            partCreateInfo.pMultisampleState    = createInfo.pMultisampleState;
+            partCreateInfo.pDepthStencilState   = createInfo.pDepthStencilState;
+            partCreateInfo.pDynamicState        = createInfo.pDynamicState;
+            partCreateInfo.layout               = createInfo.layout;
+            partCreateInfo.renderPass           = createInfo.renderPass;
+            partCreateInfo.subpass              = createInfo.subpass;
+        }
+        key.clear();
+        AppendToLibraryKey(key, VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT);
+        AppendShaderStagesToLibraryKey(key, partCreateInfo.stageCount, partCreateInfo.pStages);
+        AppendMultisampleStateToLibraryKey(key, createInfo);
+        AppendDepthStencilStateToLibraryKey(key, createInfo);
+        AppendDynamicStateToLibraryKey(key, createInfo);
+        AppendToLibraryKey(key, createInfo.layout);
+        AppendRenderPassToLibraryKey(key, createInfo, renderPass);
+        const void* dependencies[] = { LLGL_CAST(const VKShader*, desc.fragmentShader), pipelineLayoutDependency, renderPassDependency };
+        libraries_[2] = GetOrCreateLibraryPart(VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT, partCreateInfo, key, dependencies);
+    }
+
+    /* Create or share fragment output interface part */
+    {
+        partCreateInfo = VkGraphicsPipelineCreateInfo{};
+        {
+            partCreateInfo.sType                = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+            partCreateInfo.pMultisampleState    = createInfo.pMultisampleState;
+            partCreateInfo.pColorBlendState     = createInfo.pColorBlendState;
+            partCreateInfo.pDynamicState        = createInfo.pDynamicState;
+            partCreateInfo.renderPass           = createInfo.renderPass;
+            partCreateInfo.subpass              = createInfo.subpass;
+        }
+        key.clear();
+        AppendToLibraryKey(key, VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT);
+        AppendMultisampleStateToLibraryKey(key, createInfo);
+        AppendColorBlendStateToLibraryKey(key, createInfo);
+        AppendDynamicStateToLibraryKey(key, createInfo);
+        AppendRenderPassToLibraryKey(key, createInfo, renderPass);
+        const void* dependencies[] = { renderPassDependency };
+        libraries_[3] = GetOrCreateLibraryPart(VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT, partCreateInfo, key, dependencies);
+    }
+
+    /* Fast-link all parts without link-time optimization */
+    VkPipeline libraries[numLibraryParts];
+    for_range(i, numLibraryParts)
+    {
+        if (!libraries_[i])
+            throw std::runtime_error("failed to create Vulkan graphics pipeline library");
+        libraries[i] = libraries_[i]->Get();
+    }
+
+    LinkVkPipelineLibraries(device, numLibraryParts, libraries, createInfo.layout, 0, pipelineCache, ReleaseAndGetAddressOfVkPipeline());
+
+    /*
+    Re-link with link-time optimization in the background; this PSO holds a reference to its parts, so they remain valid.
+    The pipeline cache is not used here, since it might be released before the background task has finished.
+    */
+    const VkPipelineLayout layout = createInfo.layout;
+    OptimizeVkPipelineAsync(
+        [device, layout, libraries](VkPipeline* outPipeline)
+        {
+            LinkVkPipelineLibraries(
+                device, numLibraryParts, libraries, layout, VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT, VK_NULL_HANDLE, outPipeline
+            );
+        }
+    );
 }
 
 
@@ -10,6 +10,7 @@
 
 
 #include "VKPipelineState.h"
+#include "VKPipelineLibraryPool.h"
 
 
 namespace LLGL
@@ -41,6 +42,8 @@ class VKGraphicsPSO final : public VKPipelineState
             PipelineCache*                      pipelineCache       = nullptr
         );
 
+        ~VKGraphicsPSO();
+
         // Returns true if scissors are enabled.
         inline bool IsScissorEnabled() const
         {
@@ -63,10 +66,31 @@ class VKGraphicsPSO final : public VKPipelineState
             VkPipelineCache                     pipelineCache   = VK_NULL_HANDLE
         );
 
+        // Returns true if this PSO can be linked from graphics pipeline library parts (see VK_EXT_graphics_pipeline_library).
+        bool SupportsPipelineLibraries(const GraphicsPipelineDescriptor& desc) const;
+
+        /*
+        Creates the native PSO by linking the four graphics pipeline library parts of the specified monolithic PSO descriptor.
+        Parts are shared with other PSOs via VKPipelineLibraryPool. The PSO is linked without link-time optimization first
+        and then re-linked with link-time optimization in the background.
+        */
+        void CreateVkPipelineFromLibraries(
+            VkDevice                            device,
+            const VKRenderPass&                 renderPass,
+            const GraphicsPipelineDescriptor&   desc,
+            const VkGraphicsPipelineCreateInfo& createInfo,
+            VkPipelineCache                     pipelineCache
+        );
+
+    private:
+
+        static constexpr std::size_t numLibraryParts = 4;
+
     private:
 
-        bool scissorEnabled_    = false;
-        bool hasDynamicScissor_ = false;
+        bool                    scissorEnabled_                 = false;
+        bool                    hasDynamicScissor_              = false;
+        VKPipelineLibraryRef    libraries_[numLibraryParts];    // Vertex input, pre-rasterization shaders, fragment shader, and fragment output parts.
 
 };
 
@@ -0,0 +1,241 @@
+/*
+ * VKHeapDescriptorSetPool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VKHeapDescriptorSetPool.h"
+#include "../VKCore.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+// Minimum and maximum number of descriptor sets per chunk. Each new chunk doubles the capacity of the previous one.
+static constexpr std::uint32_t g_minChunkCapacity = 16;
+static constexpr std::uint32_t g_maxChunkCapacity = 4096;
+
+class VKHeapDescriptorSetPool::LayoutPool
+{
+
+    public:
+
+        LayoutPool(VkDevice device, VkDescriptorSetLayout setLayout, const ArrayView<VkDescriptorPoolSize>& setPoolSizes) :
+            device_       ( device                                   ),
+            setLayout_    ( setLayout                                ),
+            setPoolSizes_ ( setPoolSizes.begin(), setPoolSizes.end() )
+        {
+        }
+
+        // Moves the specified number of descriptor sets into the output array and allocates a new chunk if there are not enough free sets left.
+        void Allocate(std::uint32_t numDescriptorSets, VkDescriptorSet* outDescriptorSets)
+        {
+            const std::size_t numFreeSets = freeSets_.size();
+            if (numFreeSets < numDescriptorSets)
+                AllocateChunk(numDescriptorSets - static_cast<std::uint32_t>(numFreeSets));
+
+            /* Take descriptor sets from the end of the free list */
+            const std::size_t first = freeSets_.size() - numDescriptorSets;
+            std::copy(freeSets_.begin() + first, freeSets_.end(), outDescriptorSets);
+            freeSets_.resize(first);
+            numLiveSets_ += numDescriptorSets;
+        }
+
+        // Returns the specified descriptor sets to the free list. Sets are only recycled as long as their set layout is alive.
+        void Free(std::uint32_t numDescriptorSets, const VkDescriptorSet* descriptorSets)
+        {
+            if (setLayout_ != VK_NULL_HANDLE)
+                freeSets_.insert(freeSets_.end(), descriptorSets, descriptorSets + numDescriptorSets);
+            numLiveSets_ -= std::min(numLiveSets_, numDescriptorSets);
+        }
+
+        // Invalidates the set layout of this pool. Descriptor sets can no longer be allocated afterwards.
+        void Orphan()
+        {
+            setLayout_ = VK_NULL_HANDLE;
+            freeSets_.clear();
+        }
+
+        // Returns true if the set layout of this pool has been destroyed and no more descriptor sets are in use.
+        bool IsExpired() const
+        {
+            return (setLayout_ == VK_NULL_HANDLE && numLiveSets_ == 0);
+        }
+
+        // Returns the native descriptor set layout this pool allocates descriptor sets for.
+        VkDescriptorSetLayout GetSetLayout() const
+        {
+            return setLayout_;
+        }
+
+    private:
+
+        // Creates a new descriptor pool with at least the specified number of descriptor sets and allocates all of them at once.
+        void AllocateChunk(std::uint32_t minNumDescriptorSets)
+        {
+            const std::uint32_t numDescriptorSets = std::max(minNumDescriptorSets, nextChunkCapacity_);
+            nextChunkCapacity_ = std::min(nextChunkCapacity_ * 2, g_maxChunkCapacity);
+
+            /* Scale pool sizes of a single descriptor set to the capacity of the new chunk */
+            std::vector<VkDescriptorPoolSize> poolSizes = setPoolSizes_;
+            for (VkDescriptorPoolSize& poolSize : poolSizes)
+                poolSize.descriptorCount *= numDescriptorSets;
+
+            /* Create Vulkan descriptor pool */
+            VKPtr<VkDescriptorPool> descriptorPool{ device_, vkDestroyDescriptorPool };
+            VkDescriptorPoolCreateInfo poolCreateInfo;
+            {
+                poolCreateInfo.sType            = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+                poolCreateInfo.pNext            = nullptr;
+                poolCreateInfo.flags            = 0;
+                poolCreateInfo.maxSets          = numDescriptorSets;
+                poolCreateInfo.poolSizeCount    = static_cast<std::uint32_t>(poolSizes.size());
+                poolCreateInfo.pPoolSizes       = poolSizes.data();
+            }
+            VkResult result = vkCreateDescriptorPool(device_, &poolCreateInfo, nullptr, descriptorPool.ReleaseAndGetAddressOf());
+            VKThrowIfFailed(result, "failed to create Vulkan descriptor pool");
+
+            /* Allocate all descriptor sets of the new chunk with a single call */
+            std::vector<VkDescriptorSetLayout> setLayouts(numDescriptorSets, setLayout_);
+
+            const std::size_t first = freeSets_.size();
+            freeSets_.resize(first + numDescriptorSets, VK_NULL_HANDLE);
+
+            VkDescriptorSetAllocateInfo allocInfo;
+            {
+                allocInfo.sType                 = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+                allocInfo.pNext                 = nullptr;
+                allocInfo.descriptorPool        = descriptorPool.Get();
+                allocInfo.descriptorSetCount    = numDescriptorSets;
+                allocInfo.pSetLayouts           = setLayouts.data();
+            }
+            result = vkAllocateDescriptorSets(device_, &allocInfo, freeSets_.data() + first);
+            if (result != VK_SUCCESS)
+                freeSets_.resize(first);
+            VKThrowIfFailed(result, "failed to allocate Vulkan descriptor sets");
+
+            descriptorPools_.push_back(std::move(descriptorPool));
+        }
+
+    private:
+
+        VkDevice                                device_             = VK_NULL_HANDLE;
+        VkDescriptorSetLayout                   setLayout_          = VK_NULL_HANDLE;
+        std::vector<VkDescriptorPoolSize>       setPoolSizes_;
+        std::vector<VKPtr<VkDescriptorPool>>    descriptorPools_;
+        std::vector<VkDescriptorSet>            freeSets_;
+        std::uint32_t                           numLiveSets_        = 0;
+        std::uint32_t                           nextChunkCapacity_  = g_minChunkCapacity;
+
+};
+
+VKHeapDescriptorSetPool& VKHeapDescriptorSetPool::Get()
+{
+    static VKHeapDescriptorSetPool instance;
+    return instance;
+}
+
+void VKHeapDescriptorSetPool::Clear()
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    layoutPools_.clear();
+}
+
+VKHeapDescriptorSetPool::LayoutPool* VKHeapDescriptorSetPool::AllocateDescriptorSets(
+    VkDevice                                device,
+    VkDescriptorSetLayout                   setLayout,
+    const ArrayView<VkDescriptorPoolSize>&  setPoolSizes,
+    std::uint32_t                           numDescriptorSets,
+    VkDescriptorSet*                        outDescriptorSets)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    /* Find layout pool for the specified set layout or create a new one */
+    LayoutPool* layoutPool = FindLayoutPool(setLayout);
+    if (layoutPool == nullptr)
+    {
+        layoutPools_.emplace_back(new LayoutPool{ device, setLayout, setPoolSizes });
+        layoutPool = layoutPools_.back().get();
+    }
+
+    if (numDescriptorSets > 0)
+        layoutPool->Allocate(numDescriptorSets, outDescriptorSets);
+
+    return layoutPool;
+}
+
+void VKHeapDescriptorSetPool::FreeDescriptorSets(LayoutPool* layoutPool, std::uint32_t numDescriptorSets, const VkDescriptorSet* descriptorSets)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    /* Ignore layout pools that have already been removed, e.g. when a resource heap outlives the render system */
+    auto it = std::find_if(
+        layoutPools_.begin(),
+        layoutPools_.end(),
+        [layoutPool](const std::unique_ptr<LayoutPool>& entry) -> bool
+        {
+            return (entry.get() == layoutPool);
+        }
+    );
+    if (it == layoutPools_.end())
+        return;
+
+    layoutPool->Free(numDescriptorSets, descriptorSets);
+    if (layoutPool->IsExpired())
+        RemoveLayoutPool(layoutPool);
+}
+
+void VKHeapDescriptorSetPool::NotifyReleaseSetLayout(VkDescriptorSetLayout setLayout)
+{
+    if (setLayout == VK_NULL_HANDLE)
+        return;
+
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    /* Orphan layout pool; its descriptor pools are kept alive until all resource heaps have returned their descriptor sets */
+    if (LayoutPool* layoutPool = FindLayoutPool(setLayout))
+    {
+        layoutPool->Orphan();
+        if (layoutPool->IsExpired())
+            RemoveLayoutPool(layoutPool);
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+VKHeapDescriptorSetPool::LayoutPool* VKHeapDescriptorSetPool::FindLayoutPool(VkDescriptorSetLayout setLayout) const
+{
+    for (const std::unique_ptr<LayoutPool>& entry : layoutPools_)
+    {
+        if (entry->GetSetLayout() == setLayout)
+            return entry.get();
+    }
+    return nullptr;
+}
+
+void VKHeapDescriptorSetPool::RemoveLayoutPool(LayoutPool* layoutPool)
+{
+    auto it = std::find_if(
+        layoutPools_.begin(),
+        layoutPools_.end(),
+        [layoutPool](const std::unique_ptr<LayoutPool>& entry) -> bool
+        {
+            return (entry.get() == layoutPool);
+        }
+    );
+    if (it != layoutPools_.end())
+        layoutPools_.erase(it);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,93 @@
+/*
+ * VKHeapDescriptorSetPool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VK_HEAP_DESCRIPTOR_SET_POOL_H
+#define LLGL_VK_HEAP_DESCRIPTOR_SET_POOL_H
+
+
+#include "../Vulkan.h"
+#include "../VKPtr.h"
+#include <LLGL/Container/ArrayView.h>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+Singleton pool of Vulkan descriptor sets for resource heaps. Access is synchronized since resource heaps can be created on worker threads.
+Descriptor sets are allocated in chunks per descriptor set layout, i.e. each chunk is a growable VkDescriptorPool whose sets are all allocated with a single call to vkAllocateDescriptorSets.
+Descriptor sets of released resource heaps are recycled for subsequent resource heaps with the same layout.
+*/
+class VKHeapDescriptorSetPool
+{
+
+    public:
+
+        // Opaque handle to the descriptor sets of a single descriptor set layout.
+        class LayoutPool;
+
+    public:
+
+        VKHeapDescriptorSetPool(const VKHeapDescriptorSetPool&) = delete;
+        VKHeapDescriptorSetPool& operator = (const VKHeapDescriptorSetPool&) = delete;
+
+        // Returns the instance of this pool.
+        static VKHeapDescriptorSetPool& Get();
+
+        // Clear all resource containers of this pool (used by VKRenderSystem).
+        void Clear();
+
+        /*
+        Allocates the specified number of descriptor sets for the specified layout and writes them into 'outDescriptorSets'.
+        'setPoolSizes' specifies the pool sizes of a single descriptor set.
+        Returns the layout pool the descriptor sets must be returned to via FreeDescriptorSets().
+        */
+        LayoutPool* AllocateDescriptorSets(
+            VkDevice                                device,
+            VkDescriptorSetLayout                   setLayout,
+            const ArrayView<VkDescriptorPoolSize>&  setPoolSizes,
+            std::uint32_t                           numDescriptorSets,
+            VkDescriptorSet*                        outDescriptorSets
+        );
+
+        // Returns the specified descriptor sets to their layout pool, so they can be recycled.
+        void FreeDescriptorSets(LayoutPool* layoutPool, std::uint32_t numDescriptorSets, const VkDescriptorSet* descriptorSets);
+
+        // Notifies this pool that the specified descriptor set layout has been destroyed, i.e. no more descriptor sets can be allocated for it.
+        void NotifyReleaseSetLayout(VkDescriptorSetLayout setLayout);
+
+    private:
+
+        VKHeapDescriptorSetPool() = default;
+
+        // Returns the layout pool for the specified descriptor set layout or null if there is none.
+        LayoutPool* FindLayoutPool(VkDescriptorSetLayout setLayout) const;
+
+        // Removes the specified layout pool and destroys all its descriptor pools.
+        void RemoveLayoutPool(LayoutPool* layoutPool);
+
+    private:
+
+        std::vector<std::unique_ptr<LayoutPool>>    layoutPools_;
+        std::mutex                                  mutex_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
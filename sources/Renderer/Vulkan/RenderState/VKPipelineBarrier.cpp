@@ -10,6 +10,8 @@
 //#include "../Texture/VKTexture.h"
 #include "../../CheckedCast.h"
 #include "../../../Core/CoreUtils.h"
+#include "../Ext/VKExtensionRegistry.h"
+#include "../Ext/VKExtensions.h"
 #include <LLGL/ShaderFlags.h>
 
 
@@ -22,11 +24,17 @@ bool VKPipelineBarrier::IsActive() const
     return (srcStageMask_ != 0 && dstStageMask_ != 0);
 }
 
-void VKPipelineBarrier::Submit(VkCommandBuffer commandBuffer)
+void VKPipelineBarrier::Submit(VkCommandBuffer commandBuffer, VkPipelineStageFlags writeStageMask)
 {
+    if (HasExtension(VKExt::KHR_synchronization2))
+    {
+        SubmitSynchronization2(commandBuffer, writeStageMask);
+        return;
+    }
+
     vkCmdPipelineBarrier(
         commandBuffer,
-        srcStageMask_,
+        (srcStageMask_ | writeStageMask),
         dstStageMask_,
         0, // VkDependencyFlags
         static_cast<std::uint32_t>(memoryBarriers_.size()),
@@ -38,7 +46,7 @@ void VKPipelineBarrier::Submit(VkCommandBuffer commandBuffer)
     );
 }
 
-bool VKPipelineBarrier::Emplace(std::uint32_t slot, Resource* resource, VkPipelineStageFlags stageFlags)
+bool VKPipelineBarrier::Emplace(std::uint32_t slot, Resource* resource, VkPipelineStageFlags stageFlags, VkDescriptorType descriptorType)
 {
     /* Emplace resource binding into sorted array */
     std::size_t index = 0;
@@ -56,8 +64,9 @@ bool VKPipelineBarrier::Emplace(std::uint32_t slot, Resource* resource, VkPipeli
         /* Replace previous entry */
         if (entry->resource != resource)
         {
-            entry->resource     = resource;
-            entry->stageFlags   = stageFlags;
+            entry->resource         = resource;
+            entry->stageFlags       = stageFlags;
+            entry->descriptorType   = descriptorType;
             return true;
         }
     }
@@ -66,9 +75,10 @@ bool VKPipelineBarrier::Emplace(std::uint32_t slot, Resource* resource, VkPipeli
         /* Insert entry with new binding slot */
         ResourceBinding binding;
         {
-            binding.slot        = slot;
-            binding.resource    = resource;
-            binding.stageFlags  = stageFlags;
+            binding.slot            = slot;
+            binding.resource        = resource;
+            binding.stageFlags      = stageFlags;
+            binding.descriptorType  = descriptorType;
         }
         bindings_.insert(bindings_.begin() + index, binding);
         return true;
@@ -101,6 +111,9 @@ bool VKPipelineBarrier::Update()
     srcStageMask_ = 0;
     dstStageMask_ = 0;
     memoryBarriers_.clear();
+    bufferBarriers_.clear();
+    memoryBarriers2_.clear();
+    bufferBarriers2_.clear();
 
     /* Iterate over all bindings and re-generate all barriers */
     for (const ResourceBinding& binding : bindings_)
@@ -110,10 +123,10 @@ bool VKPipelineBarrier::Update()
             if (resource->GetResourceType() == ResourceType::Buffer)
             {
                 auto bufferVK = LLGL_CAST(VKBuffer*, resource);
-                InsertBufferMemoryBarrier(binding.stageFlags, VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT, bufferVK->GetVkBuffer());
+                InsertBufferMemoryBarrier(binding, bufferVK->GetVkBuffer());
             }
             else
-                InsertMemoryBarrier(binding.stageFlags, VK_ACCESS_SHADER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT);
+                InsertMemoryBarrier(binding);
         }
     }
 
@@ -125,47 +138,153 @@ bool VKPipelineBarrier::Update()
  * ======= Private: =======
  */
 
-void VKPipelineBarrier::InsertMemoryBarrier(VkPipelineStageFlags stageFlags, VkAccessFlags srcAccess, VkAccessFlags dstAccess)
+static bool IsStorageDescriptorType(VkDescriptorType type)
 {
-    srcStageMask_ |= stageFlags;
-    dstStageMask_ |= stageFlags;
+    return
+    (
+        type == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER         ||
+        type == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC ||
+        type == VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER   ||
+        type == VK_DESCRIPTOR_TYPE_STORAGE_IMAGE
+    );
+}
+
+static bool IsUniformDescriptorType(VkDescriptorType type)
+{
+    return (type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER || type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC);
+}
+
+// Returns the destination access mask for a resource that is read with the specified descriptor type after a shader wrote to it.
+static VkAccessFlags GetDstVkAccessFlags(VkDescriptorType type)
+{
+    if (IsStorageDescriptorType(type))
+        return (VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT);
+    if (IsUniformDescriptorType(type))
+        return VK_ACCESS_UNIFORM_READ_BIT;
+    return VK_ACCESS_SHADER_READ_BIT;
+}
 
-    /* Check if a memory barrier alread exists */
-    for (const VkMemoryBarrier& barrier : memoryBarriers_)
+// Returns the destination access mask for VK_KHR_synchronization2, which distinguishes storage and sampled reads.
+static VkAccessFlags2KHR GetDstVkAccessFlags2(VkDescriptorType type)
+{
+    if (IsStorageDescriptorType(type))
+        return (VK_ACCESS_2_SHADER_STORAGE_READ_BIT_KHR | VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT_KHR);
+    if (IsUniformDescriptorType(type))
+        return VK_ACCESS_2_UNIFORM_READ_BIT_KHR;
+    return VK_ACCESS_2_SHADER_SAMPLED_READ_BIT_KHR;
+}
+
+void VKPipelineBarrier::InsertMemoryBarrier(const ResourceBinding& binding)
+{
+    srcStageMask_ |= binding.stageFlags;
+    dstStageMask_ |= binding.stageFlags;
+
+    if (HasExtension(VKExt::KHR_synchronization2))
     {
-        if (barrier.srcAccessMask == srcAccess && barrier.dstAccessMask == dstAccess)
-            return;
+        /* Merge into memory barrier with the same stages */
+        for (VkMemoryBarrier2KHR& barrier : memoryBarriers2_)
+        {
+            if (barrier.dstStageMask == binding.stageFlags)
+            {
+                barrier.dstAccessMask |= GetDstVkAccessFlags2(binding.descriptorType);
+                return;
+            }
+        }
+
+        VkMemoryBarrier2KHR barrier;
+        {
+            barrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER_2_KHR;
+            barrier.pNext           = nullptr;
+            barrier.srcStageMask    = binding.stageFlags;
+            barrier.srcAccessMask   = VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT_KHR;
+            barrier.dstStageMask    = binding.stageFlags;
+            barrier.dstAccessMask   = GetDstVkAccessFlags2(binding.descriptorType);
+        }
+        memoryBarriers2_.push_back(barrier);
+    }
+    else
+    {
+        /* Merge all global barriers into a single memory barrier */
+        if (memoryBarriers_.empty())
+        {
+            VkMemoryBarrier barrier;
+            {
+                barrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+                barrier.pNext           = nullptr;
+                barrier.srcAccessMask   = VK_ACCESS_SHADER_WRITE_BIT;
+                barrier.dstAccessMask   = 0;
+            }
+            memoryBarriers_.push_back(barrier);
+        }
+        memoryBarriers_.front().dstAccessMask |= GetDstVkAccessFlags(binding.descriptorType);
     }
+}
 
-    /* Insert a new memory barrier */
-    VkMemoryBarrier barrier;
+void VKPipelineBarrier::InsertBufferMemoryBarrier(const ResourceBinding& binding, VkBuffer buffer)
+{
+    srcStageMask_ |= binding.stageFlags;
+    dstStageMask_ |= binding.stageFlags;
+
+    if (HasExtension(VKExt::KHR_synchronization2))
+    {
+        VkBufferMemoryBarrier2KHR barrier;
+        {
+            barrier.sType                   = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2_KHR;
+            barrier.pNext                   = nullptr;
+            barrier.srcStageMask            = binding.stageFlags;
+            barrier.srcAccessMask           = VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT_KHR;
+            barrier.dstStageMask            = binding.stageFlags;
+            barrier.dstAccessMask           = GetDstVkAccessFlags2(binding.descriptorType);
+            barrier.srcQueueFamilyIndex     = VK_QUEUE_FAMILY_IGNORED;
+            barrier.dstQueueFamilyIndex     = VK_QUEUE_FAMILY_IGNORED;
+            barrier.buffer                  = buffer;
+            barrier.offset                  = 0;
+            barrier.size                    = VK_WHOLE_SIZE;
+        }
+        bufferBarriers2_.push_back(barrier);
+    }
+    else
     {
-        barrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
-        barrier.pNext           = nullptr;
-        barrier.srcAccessMask   = srcAccess;
-        barrier.dstAccessMask   = dstAccess;
+        VkBufferMemoryBarrier barrier;
+        {
+            barrier.sType                   = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+            barrier.pNext                   = nullptr;
+            barrier.srcAccessMask           = VK_ACCESS_SHADER_WRITE_BIT;
+            barrier.dstAccessMask           = GetDstVkAccessFlags(binding.descriptorType);
+            barrier.srcQueueFamilyIndex     = VK_QUEUE_FAMILY_IGNORED;
+            barrier.dstQueueFamilyIndex     = VK_QUEUE_FAMILY_IGNORED;
+            barrier.buffer                  = buffer;
+            barrier.offset                  = 0;
+            barrier.size                    = VK_WHOLE_SIZE;
+        }
+        bufferBarriers_.push_back(barrier);
     }
-    memoryBarriers_.push_back(barrier);
 }
 
-void VKPipelineBarrier::InsertBufferMemoryBarrier(VkPipelineStageFlags stageFlags, VkAccessFlags srcAccess, VkAccessFlags dstAccess, VkBuffer buffer)
+void VKPipelineBarrier::SubmitSynchronization2(VkCommandBuffer commandBuffer, VkPipelineStageFlags writeStageMask)
 {
-    srcStageMask_ |= stageFlags;
-    dstStageMask_ |= stageFlags;
+    /* Extend source stages of each barrier by the stages that wrote to storage resources; the stored barriers are shared between command buffers */
+    SmallVector<VkMemoryBarrier2KHR, 1u> memoryBarriers = memoryBarriers2_;
+    for (VkMemoryBarrier2KHR& barrier : memoryBarriers)
+        barrier.srcStageMask |= writeStageMask;
+
+    SmallVector<VkBufferMemoryBarrier2KHR, 4u> bufferBarriers = bufferBarriers2_;
+    for (VkBufferMemoryBarrier2KHR& barrier : bufferBarriers)
+        barrier.srcStageMask |= writeStageMask;
 
-    VkBufferMemoryBarrier barrier;
+    VkDependencyInfoKHR dependencyInfo;
     {
-        barrier.sType                   = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
-        barrier.pNext                   = nullptr;
-        barrier.srcAccessMask           = srcAccess;
-        barrier.dstAccessMask           = dstAccess;
-        barrier.srcQueueFamilyIndex     = 0;
-        barrier.dstQueueFamilyIndex     = 0;
-        barrier.buffer                  = buffer;
-        barrier.offset                  = 0;
-        barrier.size                    = VK_WHOLE_SIZE;
+        dependencyInfo.sType                    = VK_STRUCTURE_TYPE_DEPENDENCY_INFO_KHR;
+        dependencyInfo.pNext                    = nullptr;
+        dependencyInfo.dependencyFlags          = 0;
+        dependencyInfo.memoryBarrierCount       = static_cast<std::uint32_t>(memoryBarriers.size());
+        dependencyInfo.pMemoryBarriers          = memoryBarriers.data();
+        dependencyInfo.bufferMemoryBarrierCount = static_cast<std::uint32_t>(bufferBarriers.size());
+        dependencyInfo.pBufferMemoryBarriers    = bufferBarriers.data();
+        dependencyInfo.imageMemoryBarrierCount  = 0;
+        dependencyInfo.pImageMemoryBarriers     = nullptr;
     }
-    bufferBarriers_.push_back(barrier);
+    vkCmdPipelineBarrier2KHR(commandBuffer, &dependencyInfo);
 }
 
 
@@ -31,11 +31,11 @@ class VKPipelineBarrier
         // Returns true if this barrier is active in any stage.
         bool IsActive() const;
 
-        // Submits this pipeline barrier into the specified command buffer.
-        void Submit(VkCommandBuffer commandBuffer);
+        // Submits this pipeline barrier into the specified command buffer. The source stages are extended by the stages that wrote to storage resources before.
+        void Submit(VkCommandBuffer commandBuffer, VkPipelineStageFlags writeStageMask = 0);
 
-        // Emplaces the specified resource into the pipeline barrier.
-        bool Emplace(std::uint32_t slot, Resource* resource, VkPipelineStageFlags stageFlags);
+        // Emplaces the specified resource into the pipeline barrier. The access masks are derived from the descriptor type.
+        bool Emplace(std::uint32_t slot, Resource* resource, VkPipelineStageFlags stageFlags, VkDescriptorType descriptorType);
 
         // Removes the binding at the specified slot from the pipeline barrier.
         bool Remove(std::uint32_t slot);
@@ -47,25 +47,32 @@ class VKPipelineBarrier
 
         struct ResourceBinding
         {
-            std::uint32_t   slot        = 0;        // Unique binding slot
-            Resource*       resource    = nullptr;
-            long            stageFlags  = 0;
+            std::uint32_t           slot            = 0;        // Unique binding slot
+            Resource*               resource        = nullptr;
+            VkPipelineStageFlags    stageFlags      = 0;        // Shader stages the resource is bound to.
+            VkDescriptorType        descriptorType  = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
         };
 
     private:
 
-        void InsertMemoryBarrier(VkPipelineStageFlags stageFlags, VkAccessFlags srcAccess, VkAccessFlags dstAccess);
+        void InsertMemoryBarrier(const ResourceBinding& binding);
 
-        void InsertBufferMemoryBarrier(VkPipelineStageFlags stageFlags, VkAccessFlags srcAccess, VkAccessFlags dstAccess, VkBuffer buffer);
+        void InsertBufferMemoryBarrier(const ResourceBinding& binding, VkBuffer buffer);
+
+        void SubmitSynchronization2(VkCommandBuffer commandBuffer, VkPipelineStageFlags writeStageMask);
 
     private:
 
-        VkPipelineStageFlags                    srcStageMask_   = 0;
-        VkPipelineStageFlags                    dstStageMask_   = 0;
-        SmallVector<ResourceBinding, 4u>        bindings_;
-        SmallVector<VkMemoryBarrier, 1u>        memoryBarriers_;
-        SmallVector<VkBufferMemoryBarrier, 1u>  bufferBarriers_;
-        SmallVector<VkImageMemoryBarrier, 1u>   imageBarriers_;
+        VkPipelineStageFlags                            srcStageMask_   = 0;
+        VkPipelineStageFlags                            dstStageMask_   = 0;
+        SmallVector<ResourceBinding, 4u>                bindings_;
+        SmallVector<VkMemoryBarrier, 1u>                memoryBarriers_;
+        SmallVector<VkBufferMemoryBarrier, 1u>          bufferBarriers_;
+        SmallVector<VkImageMemoryBarrier, 1u>           imageBarriers_;
+
+        /* Barriers with per-resource stage masks for VK_KHR_synchronization2 */
+        SmallVector<VkMemoryBarrier2KHR, 1u>            memoryBarriers2_;
+        SmallVector<VkBufferMemoryBarrier2KHR, 1u>      bufferBarriers2_;
 
 };
 
@@ -6,6 +6,9 @@
  */
 
 #include "VKPipelineCache.h"
+#include "../VKCore.h"
+#include "../../CheckedCast.h"
+#include <LLGL/Container/SmallVector.h>
 #include <cstdint>
 
 
@@ -13,24 +16,34 @@ namespace LLGL
 {
 
 
-VKPipelineCache::VKPipelineCache(VkDevice device, const Blob& initialBlob)
-:
-    device_ { device                         },
-    cache_  { device, vkDestroyPipelineCache }
+static void CreateVkPipelineCache(VkDevice device, const void* initialData, std::size_t initialDataSize, VkPipelineCache* outCache)
 {
     VkPipelineCacheCreateInfo createInfo;
     {
         createInfo.sType            = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
         createInfo.pNext            = nullptr;
         createInfo.flags            = 0;
-        createInfo.initialDataSize  = initialBlob.GetSize();
-        createInfo.pInitialData     = initialBlob.GetData();
+        createInfo.initialDataSize  = initialDataSize;
+        createInfo.pInitialData     = initialData;
     }
-    vkCreatePipelineCache(device, &createInfo, nullptr, cache_.ReleaseAndGetAddressOf());
+    vkCreatePipelineCache(device, &createInfo, nullptr, outCache);
+}
+
+VKPipelineCache::VKPipelineCache(VkDevice device, const Blob& initialBlob)
+:
+    device_ { device                         },
+    cache_  { device, vkDestroyPipelineCache }
+{
+    CreateVkPipelineCache(device, initialBlob.GetData(), initialBlob.GetSize(), cache_.ReleaseAndGetAddressOf());
 }
 
 Blob VKPipelineCache::GetBlob() const
 {
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    /* Gather pipelines of all threads before the primary cache is serialized */
+    MergeThreadCaches();
+
     /* Determine cache size and return binary data */
     std::size_t dataSize = 0;
     vkGetPipelineCacheData(device_, cache_, &dataSize, nullptr);
@@ -41,6 +54,60 @@ Blob VKPipelineCache::GetBlob() const
     return Blob::CreateStrongRef(std::move(data));
 }
 
+VkPipelineCache VKPipelineCache::GetNativeForCurrentThread()
+{
+    const std::thread::id threadId = std::this_thread::get_id();
+
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    for (const ThreadCache& threadCache : threadCaches_)
+    {
+        if (threadCache.threadId == threadId)
+            return threadCache.cache.Get();
+    }
+
+    /* Create new cache for this thread and initialize it with the pipelines of the primary cache */
+    VKPtr<VkPipelineCache> cache{ device_, vkDestroyPipelineCache };
+    CreateVkPipelineCache(device_, nullptr, 0, cache.ReleaseAndGetAddressOf());
+    if (cache.Get() == VK_NULL_HANDLE)
+        return VK_NULL_HANDLE;
+
+    VkPipelineCache srcCache = cache_.Get();
+    vkMergePipelineCaches(device_, cache.Get(), 1, &srcCache);
+
+    VkPipelineCache threadCacheVK = cache.Get();
+    threadCaches_.push_back(ThreadCache{ threadId, std::move(cache) });
+    return threadCacheVK;
+}
+
+VkPipelineCache VKPipelineCache::GetNativeForCurrentThread(PipelineCache* pipelineCache)
+{
+    if (pipelineCache != nullptr)
+    {
+        auto* pipelineCacheVK = LLGL_CAST(VKPipelineCache*, pipelineCache);
+        return pipelineCacheVK->GetNativeForCurrentThread();
+    }
+    return VK_NULL_HANDLE;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void VKPipelineCache::MergeThreadCaches() const
+{
+    if (threadCaches_.empty())
+        return;
+
+    SmallVector<VkPipelineCache, 8> srcCaches;
+    srcCaches.reserve(threadCaches_.size());
+    for (const ThreadCache& threadCache : threadCaches_)
+        srcCaches.push_back(threadCache.cache.Get());
+
+    vkMergePipelineCaches(device_, cache_.Get(), static_cast<std::uint32_t>(srcCaches.size()), srcCaches.data());
+}
+
 
 } // /namespace LLGL
 
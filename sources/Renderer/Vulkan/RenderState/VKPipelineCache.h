@@ -12,12 +12,19 @@
 #include <vulkan/vulkan.h>
 #include <LLGL/PipelineCache.h>
 #include "../VKPtr.h"
+#include <vector>
+#include <mutex>
+#include <thread>
 
 
 namespace LLGL
 {
 
 
+/*
+Pipeline cache with one native cache per thread, since many drivers serialize concurrent pipeline creation on the same VkPipelineCache.
+The primary cache holds the initial blob and receives all per-thread caches with vkMergePipelineCaches when the blob is retrieved.
+*/
 class VKPipelineCache final : public PipelineCache
 {
 
@@ -29,16 +36,34 @@ class VKPipelineCache final : public PipelineCache
 
     public:
 
-        // Returns the native pipeline cache object.
-        inline VkPipelineCache GetNative() const
+        /*
+        Returns the native pipeline cache for the calling thread. This cache is created on first use and initialized with the primary cache.
+        The returned cache must only be used by the calling thread.
+        */
+        VkPipelineCache GetNativeForCurrentThread();
+
+        // Returns the native pipeline cache for the calling thread of the specified cache or VK_NULL_HANDLE if the cache is null.
+        static VkPipelineCache GetNativeForCurrentThread(PipelineCache* pipelineCache);
+
+    private:
+
+        struct ThreadCache
         {
-            return cache_.Get();
-        }
+            std::thread::id         threadId;
+            VKPtr<VkPipelineCache>  cache;
+        };
+
+    private:
+
+        // Merges all per-thread caches into the primary cache. Mutex must be locked by the caller.
+        void MergeThreadCaches() const;
 
     private:
 
-        VkDevice                device_ = VK_NULL_HANDLE;
-        VKPtr<VkPipelineCache>  cache_;
+        VkDevice                    device_         = VK_NULL_HANDLE;
+        VKPtr<VkPipelineCache>      cache_;
+        std::vector<ThreadCache>    threadCaches_;
+        mutable std::mutex          mutex_;
 
 };
 
@@ -7,11 +7,15 @@
 
 #include "VKPipelineLayout.h"
 #include "VKPoolSizeAccumulator.h"
+#include "VKBindlessDescriptorSet.h"
 #include "../VKTypes.h"
 #include "../VKCore.h"
 #include "../VKStaticLimits.h"
+#include "../Ext/VKExtensionRegistry.h"
 #include "../Texture/VKSampler.h"
 #include "../Shader/VKShader.h"
+#include "VKHeapDescriptorSetPool.h"
+#include "VKPipelineLibraryPool.h"
 #include "../Shader/VKShaderModulePool.h"
 #include "../../../Core/CoreUtils.h"
 #include "../../../Core/Assertion.h"
@@ -26,7 +30,56 @@ namespace LLGL
 
 VKPtr<VkPipelineLayout> VKPipelineLayout::defaultPipelineLayout_;
 
-VKPipelineLayout::VKPipelineLayout(VkDevice device, const PipelineLayoutDescriptor& desc) :
+constexpr std::uint32_t VKPipelineLayout::maxNumPushDescriptors;
+
+// Returns the number of descriptors that are required for the specified bindings.
+static std::uint32_t GetNumDescriptors(const std::vector<BindingDescriptor>& bindings)
+{
+    std::uint32_t numDescriptors = 0;
+    for (const BindingDescriptor& binding : bindings)
+        numDescriptors += std::max(1u, binding.arraySize);
+    return numDescriptors;
+}
+
+// Returns the bitmask of StageFlags for all bindings that can be written by shaders, i.e. storage resources.
+static long GetStorageStageFlags(const std::vector<BindingDescriptor>& bindings)
+{
+    long stageFlags = 0;
+    for (const BindingDescriptor& binding : bindings)
+    {
+        if ((binding.bindFlags & BindFlags::Storage) != 0)
+            stageFlags |= binding.stageFlags;
+    }
+    return stageFlags;
+}
+
+// Converts the bitmask of LLGL::StageFlags to VkPipelineStageFlags
+static VkPipelineStageFlags GetVkPipelineStageFlags(long flags)
+{
+    VkPipelineStageFlags bitmask = 0;
+
+    if ((flags & StageFlags::VertexStage        ) != 0) { bitmask |= VK_PIPELINE_STAGE_VERTEX_SHADER_BIT;                  }
+    if ((flags & StageFlags::TessControlStage   ) != 0) { bitmask |= VK_PIPELINE_STAGE_TESSELLATION_CONTROL_SHADER_BIT;    }
+    if ((flags & StageFlags::TessEvaluationStage) != 0) { bitmask |= VK_PIPELINE_STAGE_TESSELLATION_EVALUATION_SHADER_BIT; }
+    if ((flags & StageFlags::GeometryStage      ) != 0) { bitmask |= VK_PIPELINE_STAGE_GEOMETRY_SHADER_BIT;                }
+    if ((flags & StageFlags::FragmentStage      ) != 0) { bitmask |= VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;                }
+    if ((flags & StageFlags::ComputeStage       ) != 0) { bitmask |= VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;                 }
+
+    if (HasExtension(VKExt::EXT_mesh_shader))
+    {
+        if ((flags & StageFlags::TaskStage      ) != 0) { bitmask |= VK_PIPELINE_STAGE_TASK_SHADER_BIT_EXT;                }
+        if ((flags & StageFlags::MeshStage      ) != 0) { bitmask |= VK_PIPELINE_STAGE_MESH_SHADER_BIT_EXT;                }
+    }
+
+    return bitmask;
+}
+
+VKPipelineLayout::VKPipelineLayout(
+    VkDevice                        device,
+    const PipelineLayoutDescriptor& desc,
+    bool                            pushDescriptors,
+    const VKBindlessDescriptorSet*  bindlessSet)
+:
     pipelineLayout_ { device, vkDestroyPipelineLayout          },
     setLayouts_     { { device, vkDestroyDescriptorSetLayout },
                       { device, vkDestroyDescriptorSetLayout },
@@ -38,29 +91,48 @@ VKPipelineLayout::VKPipelineLayout(VkDevice device, const PipelineLayoutDescript
     if (!desc.heapBindings.empty())
         CreateBindingSetLayout(device, desc.heapBindings, heapBindings_, SetLayoutType_HeapBindings);
     if (!desc.bindings.empty())
+    {
+        usesPushDescriptors_ = (pushDescriptors && GetNumDescriptors(desc.bindings) <= VKPipelineLayout::maxNumPushDescriptors);
         CreateBindingSetLayout(device, desc.bindings, bindings_, SetLayoutType_DynamicBindings);
+    }
     if (!desc.staticSamplers.empty())
         CreateImmutableSamplers(device, desc.staticSamplers);
 
-    /* Create descriptor pool for dynamic descriptors and immutable samplers */
-    if (!desc.bindings.empty() || !desc.staticSamplers.empty())
+    /* Create descriptor pool for dynamic descriptors and immutable samplers; push descriptors are recorded directly into the command buffers */
+    const bool hasDynamicDescriptorSet = (!desc.bindings.empty() && !usesPushDescriptors_);
+    if (hasDynamicDescriptorSet || !desc.staticSamplers.empty())
         CreateDescriptorPool(device);
-    if (!desc.bindings.empty())
+    if (hasDynamicDescriptorSet)
         CreateDescriptorCache(device, setLayouts_[SetLayoutType_DynamicBindings].Get());
     if (!desc.staticSamplers.empty())
         CreateStaticDescriptorSet(device, setLayouts_[SetLayoutType_ImmutableSamplers].Get());
 
     /* Don't create a VkPipelineLayout object if this instance only has push constants as those are part of the permutations for each PSO */
-    if (!desc.heapBindings.empty() || !desc.bindings.empty() || !desc.staticSamplers.empty())
+    if (!desc.heapBindings.empty() || !desc.bindings.empty() || !desc.staticSamplers.empty() || bindlessSet != nullptr)
     {
         BuildDescriptorSetBindingTables(desc);
+
+        /* Append bindless descriptor set after all other descriptor sets */
+        if (bindlessSet != nullptr)
+        {
+            bindlessSetLayout_      = bindlessSet->GetVkDescriptorSetLayout();
+            bindlessDescriptorSet_  = bindlessSet->GetVkDescriptorSet();
+            bindlessBindPoint_      = layoutTypeOrder_.Count();
+        }
+
         pipelineLayout_ = CreateVkPipelineLayout(device);
     }
+
+    /* Store stages that can write to storage resources, so command buffers only insert storage barriers after such writes; bindless resources can be written by any stage */
+    const long storageStageFlags = (bindlessSet != nullptr ? StageFlags::AllStages : GetStorageStageFlags(desc.heapBindings) | GetStorageStageFlags(desc.bindings));
+    storageWriteStages_ = GetVkPipelineStageFlags(storageStageFlags);
 }
 
 VKPipelineLayout::~VKPipelineLayout()
 {
     VKShaderModulePool::Get().NotifyReleasePipelineLayout(this);
+    VKPipelineLibraryPool::Get().NotifyReleasePipelineLayout(this);
+    VKHeapDescriptorSetPool::Get().NotifyReleaseSetLayout(GetSetLayoutForHeapBindings());
 }
 
 std::uint32_t VKPipelineLayout::GetNumHeapBindings() const
@@ -164,15 +236,120 @@ static void BuildPushConstantRanges(
     );
 }
 
+// Builds the uniform block ranges for all uniforms that are not part of a push-constant block. Returns false if no such uniform is part of a uniform block.
+static bool BuildUniformBlockRanges(
+    const ArrayView<Shader*>&               shaders,
+    const ArrayView<UniformDescriptor>&     uniformDescs,
+    const std::vector<VkPushConstantRange>& pushConstantRanges,
+    VKUniformBlockLayout&                   outUniformBlock)
+{
+    outUniformBlock.uniformRanges.clear();
+    outUniformBlock.uniformRanges.resize(uniformDescs.size(), VKUniformRange{ 0, 0 });
+
+    bool hasUniformBlock = false;
+    std::vector<VKUniformRange> stageUniformRanges;
+
+    for_range(i, shaders.size())
+    {
+        /* Reflect uniform block of current shader stage */
+        auto* shaderVK = LLGL_CAST(VKShader*, shaders[i]);
+        VKUniformBlockBinding stageBlockBinding;
+        if (!shaderVK->ReflectUniformBlock(uniformDescs, stageUniformRanges, stageBlockBinding))
+            continue;
+
+        bool stageUsesUniformBlock = false;
+
+        for_range(j, uniformDescs.size())
+        {
+            /* Uniforms in a push-constant block take precedence over uniform blocks */
+            const VKUniformRange& stageRange = stageUniformRanges[j];
+            if (pushConstantRanges[j].size > 0 || stageRange.size == 0)
+                continue;
+
+            VKUniformRange& range = outUniformBlock.uniformRanges[j];
+            if (range.size != 0 && range.offset != stageRange.offset)
+            {
+                LLGL_TRAP(
+                    "cannot handle different uniform block offsets between shader stages for uniform '%s'; got %u and %u",
+                    uniformDescs[j].name.c_str(), range.offset, stageRange.offset
+                );
+            }
+            range = stageRange;
+            stageUsesUniformBlock = true;
+        }
+
+        if (!stageUsesUniformBlock)
+            continue;
+
+        /* Consolidate uniform block binding across all shader stages */
+        if (hasUniformBlock && (outUniformBlock.dstSet != stageBlockBinding.set || outUniformBlock.binding != stageBlockBinding.binding))
+        {
+            LLGL_TRAP(
+                "cannot handle different uniform block bindings between shader stages; got (set = %u, binding = %u) and (set = %u, binding = %u)",
+                outUniformBlock.dstSet, outUniformBlock.binding, stageBlockBinding.set, stageBlockBinding.binding
+            );
+        }
+
+        outUniformBlock.dstSet      = stageBlockBinding.set;
+        outUniformBlock.binding     = stageBlockBinding.binding;
+        outUniformBlock.size        = std::max(outUniformBlock.size, stageBlockBinding.size);
+        outUniformBlock.stageFlags |= VKTypes::Map(shaders[i]->GetType());
+        hasUniformBlock = true;
+    }
+
+    return hasUniformBlock;
+}
+
+static VKPtr<VkDescriptorSetLayout> CreateUniformBlockVkDescriptorSetLayout(VkDevice device, const VKUniformBlockLayout& uniformBlock)
+{
+    VkDescriptorSetLayoutBinding setLayoutBinding;
+    {
+        setLayoutBinding.binding            = uniformBlock.binding;
+        setLayoutBinding.descriptorType     = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+        setLayoutBinding.descriptorCount    = 1;
+        setLayoutBinding.stageFlags         = uniformBlock.stageFlags;
+        setLayoutBinding.pImmutableSamplers = nullptr;
+    }
+    VkDescriptorSetLayoutCreateInfo createInfo;
+    {
+        createInfo.sType        = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        createInfo.pNext        = nullptr;
+        createInfo.flags        = 0;
+        createInfo.bindingCount = 1;
+        createInfo.pBindings    = &setLayoutBinding;
+    }
+    VKPtr<VkDescriptorSetLayout> setLayout{ device, vkDestroyDescriptorSetLayout };
+    auto result = vkCreateDescriptorSetLayout(device, &createInfo, nullptr, setLayout.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan descriptor set layout for uniform block");
+    return setLayout;
+}
+
 VKPtr<VkPipelineLayout> VKPipelineLayout::CreateVkPipelineLayoutPermutation(
     VkDevice                            device,
     const ArrayView<Shader*>&           shaders,
-    std::vector<VkPushConstantRange>&   outUniformRanges) const
+    std::vector<VkPushConstantRange>&   outUniformRanges,
+    VKUniformBlockLayout&               outUniformBlock) const
 {
     if (!uniformDescs_.empty())
     {
         std::vector<VkPushConstantRange> pushConstantRangesPerStage;
         BuildPushConstantRanges(shaders, uniformDescs_, pushConstantRangesPerStage, outUniformRanges);
+
+        /* Append descriptor set for uniforms that are declared in a uniform block rather than a push-constant block */
+        if (BuildUniformBlockRanges(shaders, uniformDescs_, outUniformRanges, outUniformBlock))
+        {
+            const std::uint32_t expectedSet = layoutTypeOrder_.Count() + (bindlessSetLayout_ != VK_NULL_HANDLE ? 1 : 0);
+            if (outUniformBlock.dstSet != expectedSet)
+            {
+                LLGL_TRAP(
+                    "uniform block must be declared in descriptor set %u to follow the descriptor sets of its pipeline layout; got set %u",
+                    expectedSet, outUniformBlock.dstSet
+                );
+            }
+            outUniformBlock.setLayout = CreateUniformBlockVkDescriptorSetLayout(device, outUniformBlock);
+            return CreateVkPipelineLayout(device, pushConstantRangesPerStage, outUniformBlock.setLayout.Get());
+        }
+
         return CreateVkPipelineLayout(device, pushConstantRangesPerStage);
     }
     return {};
@@ -201,10 +378,11 @@ bool VKPipelineLayout::NeedsShaderModulePermutation(const VKShader& shaderVK) co
     );
 }
 
-VKPtr<VkShaderModule> VKPipelineLayout::CreateVkShaderModulePermutation(VKShader& shaderVK) const
+bool VKPipelineLayout::BuildShaderBindingLayoutPermutation(const VKShader& shaderVK, VKShaderBindingLayout& outBindingLayout) const
 {
-    return shaderVK.CreateVkShaderModulePermutation(
-        std::bind(&VKPipelineLayout::GetBindingSlotsAssignment, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3)
+    return shaderVK.BuildBindingLayoutPermutation(
+        std::bind(&VKPipelineLayout::GetBindingSlotsAssignment, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
+        outBindingLayout
     );
 }
 
@@ -246,6 +424,13 @@ static VkShaderStageFlags GetVkShaderStageFlags(long flags)
     if ((flags & StageFlags::FragmentStage      ) != 0) { bitmask |= VK_SHADER_STAGE_FRAGMENT_BIT;                }
     if ((flags & StageFlags::ComputeStage       ) != 0) { bitmask |= VK_SHADER_STAGE_COMPUTE_BIT;                 }
 
+    /* Mesh pipeline stages are only valid if VK_EXT_mesh_shader is enabled, but they are included in StageFlags::AllStages */
+    if (HasExtension(VKExt::EXT_mesh_shader))
+    {
+        if ((flags & StageFlags::TaskStage      ) != 0) { bitmask |= VK_SHADER_STAGE_TASK_BIT_EXT;                }
+        if ((flags & StageFlags::MeshStage      ) != 0) { bitmask |= VK_SHADER_STAGE_MESH_BIT_EXT;                }
+    }
+
     return bitmask;
 }
 
@@ -257,8 +442,12 @@ static VkDescriptorType GetVkDescriptorType(const BindingDescriptor& desc)
         case ResourceType::Sampler:
             return VK_DESCRIPTOR_TYPE_SAMPLER;
         case ResourceType::Texture:
+            if ((desc.bindFlags & BindFlags::InputAttachment) != 0)
+                return VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT;
             return VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
         case ResourceType::Buffer:
+            if ((desc.bindFlags & BindFlags::AccelerationStructure) != 0)
+                return VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR;
             if ((desc.bindFlags & BindFlags::ConstantBuffer) != 0)
                 return VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
             if ((desc.bindFlags & (BindFlags::Sampled | BindFlags::Storage)) != 0)
@@ -279,7 +468,7 @@ void VKPipelineLayout::CreateVkDescriptorSetLayout(
     {
         createInfo.sType        = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
         createInfo.pNext        = nullptr;
-        createInfo.flags        = 0;
+        createInfo.flags        = (setLayoutType == SetLayoutType_DynamicBindings && usesPushDescriptors_ ? VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR : 0);
         createInfo.bindingCount = static_cast<std::uint32_t>(setLayoutBindings.size());
         createInfo.pBindings    = setLayoutBindings.data();
     }
@@ -352,10 +541,13 @@ void VKPipelineLayout::CreateImmutableSamplers(VkDevice device, const ArrayView<
     CreateVkDescriptorSetLayout(device, SetLayoutType_ImmutableSamplers, setLayoutBindings);
 }
 
-VKPtr<VkPipelineLayout> VKPipelineLayout::CreateVkPipelineLayout(VkDevice device, const ArrayView<VkPushConstantRange>& pushConstantRanges) const
+VKPtr<VkPipelineLayout> VKPipelineLayout::CreateVkPipelineLayout(
+    VkDevice                                device,
+    const ArrayView<VkPushConstantRange>&   pushConstantRanges,
+    VkDescriptorSetLayout                   uniformBlockSetLayout) const
 {
-    /* Create native Vulkan pipeline layout with up to 3 descriptor sets */
-    SmallVector<VkDescriptorSetLayout, SetLayoutType_Num> setLayoutsVK;
+    /* Create native Vulkan pipeline layout with up to 3 descriptor sets plus optional descriptor sets for bindless descriptors and the uniform block */
+    SmallVector<VkDescriptorSetLayout, SetLayoutType_Num + 2> setLayoutsVK;
 
     for_range(i, SetLayoutType_Num)
     {
@@ -363,6 +555,12 @@ VKPtr<VkPipelineLayout> VKPipelineLayout::CreateVkPipelineLayout(VkDevice device
             setLayoutsVK.push_back(setLayouts_[i].Get());
     }
 
+    if (bindlessSetLayout_ != VK_NULL_HANDLE)
+        setLayoutsVK.push_back(bindlessSetLayout_);
+
+    if (uniformBlockSetLayout != VK_NULL_HANDLE)
+        setLayoutsVK.push_back(uniformBlockSetLayout);
+
     VkPipelineLayoutCreateInfo layoutCreateInfo;
     {
         layoutCreateInfo.sType                      = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
@@ -392,8 +590,11 @@ void VKPipelineLayout::CreateDescriptorPool(VkDevice device)
     /* Accumulate descriptor pool sizes for all dynamic resources and immutable samplers */
     VKPoolSizeAccumulator poolSizeAccum;
 
-    for (const auto binding : bindings_)
-        poolSizeAccum.Accumulate(binding.descriptorType);
+    if (!usesPushDescriptors_)
+    {
+        for (const auto binding : bindings_)
+            poolSizeAccum.Accumulate(binding.descriptorType);
+    }
 
     if (!immutableSamplers_.empty())
         poolSizeAccum.Accumulate(VK_DESCRIPTOR_TYPE_SAMPLER, static_cast<std::uint32_t>(immutableSamplers_.size()));
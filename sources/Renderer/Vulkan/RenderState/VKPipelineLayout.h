@@ -25,6 +25,7 @@ namespace LLGL
 
 class VKDescriptorCache;
 class VKPoolSizeAccumulator;
+class VKBindlessDescriptorSet;
 
 struct VKLayoutBinding
 {
@@ -33,6 +34,20 @@ struct VKLayoutBinding
     VkDescriptorType    descriptorType;
 };
 
+/*
+Layout of the uniform block for uniforms that are not part of the push-constant block.
+The block is bound as dynamic uniform buffer (VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC) in its own descriptor set after all other descriptor sets.
+*/
+struct VKUniformBlockLayout
+{
+    VKPtr<VkDescriptorSetLayout>    setLayout;
+    std::uint32_t                   dstSet          = 0;
+    std::uint32_t                   binding         = 0;
+    std::uint32_t                   size            = 0;
+    VkShaderStageFlags              stageFlags      = 0;
+    std::vector<VKUniformRange>     uniformRanges;      // Byte range of each uniform within the block. Uniforms outside of this block have a zero-range.
+};
+
 class VKPipelineLayout final : public PipelineLayout
 {
 
@@ -42,24 +57,37 @@ class VKPipelineLayout final : public PipelineLayout
 
     public:
 
-        VKPipelineLayout(VkDevice device, const PipelineLayoutDescriptor& desc);
+        /*
+        Creates the pipeline layout. If 'pushDescriptors' is true, dynamic bindings use push descriptors if their number does not exceed 'maxNumPushDescriptors'.
+        If 'bindlessSet' is non-null, its descriptor set is appended after all other descriptor sets of this pipeline layout.
+        */
+        VKPipelineLayout(
+            VkDevice                        device,
+            const PipelineLayoutDescriptor& desc,
+            bool                            pushDescriptors = false,
+            const VKBindlessDescriptorSet*  bindlessSet     = nullptr
+        );
         ~VKPipelineLayout();
 
         /*
         Creates a permutation of this pipeline layout for the specified shaders with push constants.
         If this pipeline layout does not have any push constants (i.e. uniform descriptors), no permutation is created and the return value is VK_NULL_HANDLE.
+        Uniforms that are not part of a push-constant block are looked up in the shaders' uniform blocks. If any uniform is found there,
+        'outUniformBlock' receives a descriptor set layout for that block, which is appended to the descriptor sets of this pipeline layout.
+        The shaders must declare that uniform block with the descriptor set index that follows all other descriptor sets, i.e. 'layout(set = N)'.
         */
         VKPtr<VkPipelineLayout> CreateVkPipelineLayoutPermutation(
             VkDevice                            device,
             const ArrayView<Shader*>&           shaders,
-            std::vector<VkPushConstantRange>&   outUniformRanges
+            std::vector<VkPushConstantRange>&   outUniformRanges,
+            VKUniformBlockLayout&               outUniformBlock
         ) const;
 
         // Returns true if a permutation is required for the specified shader.
         bool NeedsShaderModulePermutation(const VKShader& shaderVK) const;
 
-        // Creates a permutation of the specified shader. Should only be used by VKShaderModulePool.
-        VKPtr<VkShaderModule> CreateVkShaderModulePermutation(VKShader& shaderVK) const;
+        // Builds the binding layout permutation of the specified shader for this pipeline layout. Should only be used by VKShaderModulePool.
+        bool BuildShaderBindingLayoutPermutation(const VKShader& shaderVK, VKShaderBindingLayout& outBindingLayout) const;
 
         // Returns the native VkPipelineLayout object.
         inline VkPipelineLayout GetVkPipelineLayout() const
@@ -97,6 +125,18 @@ class VKPipelineLayout final : public PipelineLayout
             return setBindingTables_[SetLayoutType_ImmutableSamplers].dstSet;
         }
 
+        // Returns the descriptor set binding point for the bindless descriptor set.
+        inline std::uint32_t GetBindPointForBindlessDescriptors() const
+        {
+            return bindlessBindPoint_;
+        }
+
+        // Returns a Vulkan handle of the bindless descriptor set. May also be VK_NULL_HANLDE.
+        inline VkDescriptorSet GetBindlessDescriptorSet() const
+        {
+            return bindlessDescriptorSet_;
+        }
+
         // Returns a Vulkan handle of the static descriptor. May also be VK_NULL_HANLDE.
         inline VkDescriptorSet GetStaticDescriptorSet() const
         {
@@ -115,12 +155,24 @@ class VKPipelineLayout final : public PipelineLayout
             return bindings_;
         }
 
+        // Returns true if dynamic bindings are written with push descriptors (see VK_KHR_push_descriptor). In this case, there is no descriptor cache.
+        inline bool UsesPushDescriptors() const
+        {
+            return usesPushDescriptors_;
+        }
+
         // Returns the descriptor cache for dynamic resources or null if there is none.
         inline VKDescriptorCache* GetDescriptorCache() const
         {
             return descriptorCache_.get();
         }
 
+        // Returns the pipeline stages that can write to storage resources with this layout or 0 if there are no storage bindings.
+        inline VkPipelineStageFlags GetStorageWriteStages() const
+        {
+            return storageWriteStages_;
+        }
+
         // Returns true if this instance provides permutations for the native Vulkan pipeline layout.
         inline bool HasVkPipelineLayoutPermutations() const
         {
@@ -138,6 +190,11 @@ class VKPipelineLayout final : public PipelineLayout
         // Returns the default VkPipelineLayout object.
         static VkPipelineLayout GetDefault();
 
+    public:
+
+        // Minimum limit of VkPhysicalDevicePushDescriptorPropertiesKHR::maxPushDescriptors that is guaranteed by the Vulkan specification.
+        static constexpr std::uint32_t maxNumPushDescriptors = 32;
+
     private:
 
         // Enumeration of descriptor set layout types.
@@ -179,7 +236,8 @@ class VKPipelineLayout final : public PipelineLayout
 
         VKPtr<VkPipelineLayout> CreateVkPipelineLayout(
             VkDevice                                device,
-            const ArrayView<VkPushConstantRange>&   pushConstantRanges = {}
+            const ArrayView<VkPushConstantRange>&   pushConstantRanges      = {},
+            VkDescriptorSetLayout                   uniformBlockSetLayout   = VK_NULL_HANDLE
         ) const;
 
         void CreateDescriptorPool(VkDevice device);
@@ -211,6 +269,11 @@ class VKPipelineLayout final : public PipelineLayout
         VKPtr<VkDescriptorPool>             descriptorPool_;
         std::unique_ptr<VKDescriptorCache>  descriptorCache_;
         VkDescriptorSet                     staticDescriptorSet_                = VK_NULL_HANDLE;
+        VkDescriptorSetLayout               bindlessSetLayout_                  = VK_NULL_HANDLE;
+        VkDescriptorSet                     bindlessDescriptorSet_              = VK_NULL_HANDLE;
+        std::uint32_t                       bindlessBindPoint_                  = 0;
+        bool                                usesPushDescriptors_                = false;
+        VkPipelineStageFlags                storageWriteStages_                 = 0;
 
         std::vector<VKLayoutBinding>        heapBindings_;
         std::vector<VKLayoutBinding>        bindings_;
@@ -0,0 +1,123 @@
+/*
+ * VKPipelineLibraryPool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VKPipelineLibraryPool.h"
+#include "../../../Core/CoreUtils.h"
+#include "../../../Core/MacroUtils.h"
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+VKPipelineLibraryPool& VKPipelineLibraryPool::Get()
+{
+    static VKPipelineLibraryPool instance;
+    return instance;
+}
+
+void VKPipelineLibraryPool::Clear()
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    libraries_.clear();
+}
+
+static int CompareLibraryKeySWO(const VKPipelineLibraryKey& lhs, const VKPipelineLibraryKey& rhs)
+{
+    LLGL_COMPARE_SEPARATE_MEMBERS_SWO(lhs.size(), rhs.size());
+    return (lhs.empty() ? 0 : std::memcmp(lhs.data(), rhs.data(), lhs.size()));
+}
+
+VKPipelineLibraryRef VKPipelineLibraryPool::GetOrCreateLibrary(
+    const VKPipelineLibraryKey&                 key,
+    const ArrayView<const void*>&               dependencies,
+    const std::function<VKPtr<VkPipeline>()>&   createFunc)
+{
+    auto FindLibrary = [this, &key](std::size_t* insertionPos) -> PipelineLibrary*
+    {
+        return FindInSortedArray<PipelineLibrary>(
+            libraries_.data(),
+            libraries_.size(),
+            [&key](const PipelineLibrary& entry) -> int
+            {
+                return CompareLibraryKeySWO(key, entry.key);
+            },
+            insertionPos
+        );
+    };
+
+    /* Try to find existing part with the same state */
+    {
+        std::lock_guard<std::mutex> guard{ mutex_ };
+        if (PipelineLibrary* entry = FindLibrary(nullptr))
+            return entry->library;
+    }
+
+    /* Create new part outside the lock, since compiling shaders can take a long time */
+    VKPipelineLibraryRef newLibrary = std::make_shared<VKPtr<VkPipeline>>(createFunc());
+    if (newLibrary->Get() == VK_NULL_HANDLE)
+        return nullptr;
+
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    /* Share the part of another thread if it was inserted in the meantime; the new part is discarded */
+    std::size_t insertionPos = 0;
+    if (PipelineLibrary* entry = FindLibrary(&insertionPos))
+        return entry->library;
+
+    PipelineLibrary newEntry;
+    {
+        newEntry.key        = key;
+        newEntry.library    = newLibrary;
+        newEntry.dependencies.assign(dependencies.begin(), dependencies.end());
+    }
+    libraries_.insert(libraries_.begin() + insertionPos, std::move(newEntry));
+
+    return newLibrary;
+}
+
+void VKPipelineLibraryPool::NotifyReleaseShader(VKShader* shader)
+{
+    ReleaseDependency(shader);
+}
+
+void VKPipelineLibraryPool::NotifyReleasePipelineLayout(VKPipelineLayout* pipelineLayout)
+{
+    ReleaseDependency(pipelineLayout);
+}
+
+void VKPipelineLibraryPool::NotifyReleaseRenderPass(VKRenderPass* renderPass)
+{
+    ReleaseDependency(renderPass);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void VKPipelineLibraryPool::ReleaseDependency(const void* object)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    /* PSOs that were linked with an evicted part keep their own reference to it */
+    RemoveAllFromListIf(
+        libraries_,
+        [object](const PipelineLibrary& entry) -> bool
+        {
+            return Contains(entry.dependencies, object);
+        }
+    );
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,100 @@
+/*
+ * VKPipelineLibraryPool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VK_PIPELINE_LIBRARY_POOL_H
+#define LLGL_VK_PIPELINE_LIBRARY_POOL_H
+
+
+#include "../Vulkan.h"
+#include "../VKPtr.h"
+#include <LLGL/Container/ArrayView.h>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <functional>
+
+
+namespace LLGL
+{
+
+
+class VKShader;
+class VKPipelineLayout;
+class VKRenderPass;
+
+// Serialized state of a graphics pipeline library part (see VK_EXT_graphics_pipeline_library).
+using VKPipelineLibraryKey = std::vector<char>;
+
+// Shared reference to a graphics pipeline library part. PSOs keep their parts alive for as long as they might be re-linked.
+using VKPipelineLibraryRef = std::shared_ptr<VKPtr<VkPipeline>>;
+
+/*
+Singleton pool for graphics pipeline library parts. Access is synchronized since PSOs can be compiled on worker threads.
+Parts are keyed by their serialized state, so PSOs that only differ in one part (e.g. the blend state) share all other parts.
+Each part also stores the objects it depends on (shaders, pipeline layout, render pass), so it is evicted once one of them is released.
+*/
+class VKPipelineLibraryPool
+{
+
+    public:
+
+        VKPipelineLibraryPool(const VKPipelineLibraryPool&) = delete;
+        VKPipelineLibraryPool& operator = (const VKPipelineLibraryPool&) = delete;
+
+        // Returns the instance of this pool.
+        static VKPipelineLibraryPool& Get();
+
+        // Clear all resource containers of this pool (used by VKRenderSystem).
+        void Clear();
+
+        /*
+        Returns the pipeline library part for the specified key or creates it with 'createFunc' if there is none.
+        The part is created outside the lock, so other threads can look up parts while it is compiled.
+        Returns null if 'createFunc' failed to create the part.
+        */
+        VKPipelineLibraryRef GetOrCreateLibrary(
+            const VKPipelineLibraryKey&                 key,
+            const ArrayView<const void*>&               dependencies,
+            const std::function<VKPtr<VkPipeline>()>&   createFunc
+        );
+
+        void NotifyReleaseShader(VKShader* shader);
+        void NotifyReleasePipelineLayout(VKPipelineLayout* pipelineLayout);
+        void NotifyReleaseRenderPass(VKRenderPass* renderPass);
+
+    private:
+
+        struct PipelineLibrary
+        {
+            VKPipelineLibraryKey        key;
+            std::vector<const void*>    dependencies;
+            VKPipelineLibraryRef        library;
+        };
+
+    private:
+
+        VKPipelineLibraryPool() = default;
+
+        // Removes all parts that depend on the specified object.
+        void ReleaseDependency(const void* object);
+
+    private:
+
+        std::vector<PipelineLibrary>    libraries_; // Sorted by key.
+        std::mutex                      mutex_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
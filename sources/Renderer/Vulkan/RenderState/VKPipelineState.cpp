@@ -9,7 +9,10 @@
 #include "VKPipelineLayout.h"
 #include "../Shader/VKShader.h"
 #include "../Shader/VKShaderModulePool.h"
+#include "../Ext/VKExtensions.h"
 #include "../../CheckedCast.h"
+#include <LLGL/Utils/ForRange.h>
+#include <string.h>
 
 
 namespace LLGL
@@ -17,25 +20,54 @@ namespace LLGL
 
 
 VKPipelineState::VKPipelineState(
-    VkDevice                    device,
-    VkPipelineBindPoint         bindPoint,
-    const ArrayView<Shader*>&   shaders,
-    const PipelineLayout*       pipelineLayout)
+    VkDevice                                    device,
+    VkPipelineBindPoint                         bindPoint,
+    const ArrayView<Shader*>&                   shaders,
+    const ArrayView<SpecializationConstant>&    specializationConstants,
+    const PipelineLayout*                       pipelineLayout,
+    PipelineState*                              placeholder)
 :
-    pipeline_  { device, vkDestroyPipeline },
-    bindPoint_ { bindPoint                 }
+    pipeline_           { device, vkDestroyPipeline                },
+    bindPoint_          { bindPoint                                },
+    placeholder_        { LLGL_CAST(VKPipelineState*, placeholder) },
+    optimizedPipeline_  { device, vkDestroyPipeline                }
 {
+    if (!specializationConstants.empty())
+        BuildSpecializationInfo(specializationConstants);
+
     if (pipelineLayout != nullptr)
     {
         pipelineLayout_ = LLGL_CAST(const VKPipelineLayout*, pipelineLayout);
         if (pipelineLayout_->GetNumUniforms() > 0)
-            pipelineLayoutPerm_ = pipelineLayout_->CreateVkPipelineLayoutPermutation(device, shaders, uniformRanges_);
+            pipelineLayoutPerm_ = pipelineLayout_->CreateVkPipelineLayoutPermutation(device, shaders, uniformRanges_, uniformBlock_);
     }
 }
 
 const Report* VKPipelineState::GetReport() const
 {
-    return nullptr; //TODO
+    compileTask_.Wait();
+    return (report_.HasErrors() ? &report_ : nullptr);
+}
+
+bool VKPipelineState::IsReady() const
+{
+    return compileTask_.IsReady();
+}
+
+VKPipelineState& VKPipelineState::GetReadyPSO()
+{
+    if (!compileTask_.IsReady())
+    {
+        if (placeholder_ != nullptr)
+            return placeholder_->GetReadyPSO();
+        compileTask_.Wait();
+    }
+
+    /* Fall back to placeholder if asynchronous compilation failed */
+    if (pipeline_.Get() == VK_NULL_HANDLE && placeholder_ != nullptr)
+        return placeholder_->GetReadyPSO();
+
+    return *this;
 }
 
 void VKPipelineState::BindPipelineAndStaticDescriptorSet(VkCommandBuffer commandBuffer)
@@ -58,7 +90,47 @@ void VKPipelineState::BindPipelineAndStaticDescriptorSet(VkCommandBuffer command
                 /*pDynamicOffsets*/     nullptr
             );
         }
+
+        VkDescriptorSet bindlessDescriptorSet = pipelineLayout_->GetBindlessDescriptorSet();
+        if (bindlessDescriptorSet != VK_NULL_HANDLE)
+        {
+            vkCmdBindDescriptorSets(
+                /*commandBuffer:*/      commandBuffer,
+                /*pipelineBindPoint:*/  GetBindPoint(),
+                /*layout:*/             GetVkPipelineLayout(),
+                /*firstSet:*/           pipelineLayout_->GetBindPointForBindlessDescriptors(),
+                /*descriptorSetCount:*/ 1,
+                /*pDescriptorSets:*/    &bindlessDescriptorSet,
+                /*dynamicOffsetCount:*/ 0,
+                /*pDynamicOffsets*/     nullptr
+            );
+        }
+    }
+}
+
+//private
+void VKPipelineState::BuildSpecializationInfo(const ArrayView<SpecializationConstant>& specializationConstants)
+{
+    /* Store all specialization constants as tightly packed 32-bit values */
+    const std::size_t numConstants = specializationConstants.size();
+    specializationEntries_.resize(numConstants);
+    specializationData_.resize(numConstants);
+
+    for_range(i, numConstants)
+    {
+        VkSpecializationMapEntry& entry = specializationEntries_[i];
+        {
+            entry.constantID    = specializationConstants[i].id;
+            entry.offset        = static_cast<std::uint32_t>(i * sizeof(std::uint32_t));
+            entry.size          = sizeof(std::uint32_t);
+        }
+        specializationData_[i] = specializationConstants[i].value;
     }
+
+    specializationInfo_.mapEntryCount   = static_cast<std::uint32_t>(numConstants);
+    specializationInfo_.pMapEntries     = specializationEntries_.data();
+    specializationInfo_.dataSize        = numConstants * sizeof(std::uint32_t);
+    specializationInfo_.pData           = specializationData_.data();
 }
 
 //private
@@ -92,15 +164,31 @@ void VKPipelineState::BindHeapDescriptorSet(VkCommandBuffer commandBuffer, VkDes
         BindDescriptorSets(commandBuffer, pipelineLayout_->GetBindPointForHeapBindings(), 1, &descriptorSet);
 }
 
-void VKPipelineState::PushConstants(VkCommandBuffer commandBuffer, std::uint32_t first, const char* data, std::uint32_t size)
+void VKPipelineState::PushDynamicDescriptors(VkCommandBuffer commandBuffer, std::uint32_t numWrites, const VkWriteDescriptorSet* writes)
+{
+    if (pipelineLayout_ != nullptr && numWrites > 0)
+    {
+        vkCmdPushDescriptorSetKHR(
+            /*commandBuffer:*/          commandBuffer,
+            /*pipelineBindPoint:*/      GetBindPoint(),
+            /*layout:*/                 GetVkPipelineLayout(),
+            /*set:*/                    pipelineLayout_->GetBindPointForDynamicBindings(),
+            /*descriptorWriteCount:*/   numWrites,
+            /*pDescriptorWrites:*/      writes
+        );
+    }
+}
+
+bool VKPipelineState::PushConstants(VkCommandBuffer commandBuffer, std::uint32_t first, const char* data, std::uint32_t size, char* uniformBlockData)
 {
     if (first >= uniformRanges_.size())
-        return /*OutOfBounds*/;
+        return false /*OutOfBounds*/;
 
     VkPipelineLayout layout = GetVkPipelineLayout();
 
     const char* pendingData = data;
     VkPushConstantRange pendingRange = {};
+    bool uniformBlockModified = false;
 
     auto FlushPushConstants = [&pendingRange, &pendingData, layout, commandBuffer]()
     {
@@ -114,30 +202,61 @@ void VKPipelineState::PushConstants(VkCommandBuffer commandBuffer, std::uint32_t
                 pendingRange.size,
                 pendingData
             );
-            pendingData += pendingRange.size;
             pendingRange.size = 0;
         }
     };
 
+    const bool hasUniformBlock = (uniformBlockData != nullptr && !uniformBlock_.uniformRanges.empty());
+
     for (const std::uint32_t end = static_cast<std::uint32_t>(uniformRanges_.size()); first < end; ++first)
     {
         /* Stop once we reached end of input data */
-        const VkPushConstantRange& currentRange = uniformRanges_[first];
-        if (size < currentRange.size)
+        const VkPushConstantRange&  currentRange    = uniformRanges_[first];
+        const std::uint32_t         blockSize       = (hasUniformBlock ? uniformBlock_.uniformRanges[first].size : 0u);
+        const std::uint32_t         uniformSize     = currentRange.size + blockSize;
+        if (size < uniformSize)
             break;
 
-        if (currentRange.offset > pendingRange.offset + pendingRange.size || currentRange.stageFlags != pendingRange.stageFlags)
+        if (blockSize > 0)
         {
+            /* Copy uniform into the CPU copy of the uniform block; It is uploaded with the next draw or dispatch command */
             FlushPushConstants();
-            pendingRange.stageFlags = currentRange.stageFlags;
-            pendingRange.offset     = currentRange.offset;
+            ::memcpy(uniformBlockData + uniformBlock_.uniformRanges[first].offset, data, blockSize);
+            uniformBlockModified = true;
+        }
+        else if (currentRange.size > 0)
+        {
+            if (pendingRange.size == 0 || currentRange.offset > pendingRange.offset + pendingRange.size || currentRange.stageFlags != pendingRange.stageFlags)
+            {
+                FlushPushConstants();
+                pendingData             = data;
+                pendingRange.stageFlags = currentRange.stageFlags;
+                pendingRange.offset     = currentRange.offset;
+            }
+            pendingRange.size += currentRange.size;
         }
 
-        pendingRange.size   += currentRange.size;
-        size                -= currentRange.size;
+        data += uniformSize;
+        size -= uniformSize;
     }
 
     FlushPushConstants();
+
+    return uniformBlockModified;
+}
+
+void VKPipelineState::BindUniformBlockDescriptorSet(VkCommandBuffer commandBuffer, VkDescriptorSet descriptorSet, std::uint32_t dynamicOffset)
+{
+    vkCmdBindDescriptorSets(
+        /*commandBuffer:*/      commandBuffer,
+        /*pipelineBindPoint:*/  GetBindPoint(),
+        /*layout:*/             GetVkPipelineLayout(),
+        /*firstSet:*/           uniformBlock_.dstSet,
+        /*descriptorSetCount:*/ 1,
+        /*pDescriptorSets:*/    &descriptorSet,
+        /*dynamicOffsetCount:*/ 1,
+        /*pDynamicOffsets*/     &dynamicOffset
+    );
 }
 
 
@@ -145,6 +264,55 @@ void VKPipelineState::PushConstants(VkCommandBuffer commandBuffer, std::uint32_t
  * ======= Protected: =======
  */
 
+void VKPipelineState::CompileVkPipeline(const std::function<void()>& compileFunc, bool async)
+{
+    if (async)
+    {
+        compileTask_.Start(
+            [this, compileFunc]()
+            {
+                try
+                {
+                    compileFunc();
+                }
+                catch (const std::exception& e)
+                {
+                    report_.Reset(e.what(), true);
+                }
+            },
+            true
+        );
+    }
+    else
+        compileFunc();
+}
+
+void VKPipelineState::OptimizeVkPipelineAsync(const std::function<void(VkPipeline* outPipeline)>& optimizeFunc)
+{
+    optimizeTask_.Start(
+        [this, optimizeFunc]()
+        {
+            try
+            {
+                optimizeFunc(optimizedPipeline_.ReleaseAndGetAddressOf());
+                if (optimizedPipeline_.Get() != VK_NULL_HANDLE)
+                    optimizedPipelineReady_.store(true, std::memory_order_release);
+            }
+            catch (const std::exception&)
+            {
+                /* Keep binding the initial PSO */
+            }
+        },
+        true
+    );
+}
+
+void VKPipelineState::WaitForCompilation()
+{
+    compileTask_.Wait();
+    optimizeTask_.Wait();
+}
+
 VkPipeline* VKPipelineState::ReleaseAndGetAddressOfVkPipeline()
 {
     return pipeline_.ReleaseAndGetAddressOf();
@@ -163,7 +331,12 @@ void VKPipelineState::GetShaderCreateInfoAndOptionalPermutation(VKShader& shader
 {
     shaderVK.FillShaderStageCreateInfo(outCreateInfo);
     if (pipelineLayout_ != nullptr && pipelineLayout_->NeedsShaderModulePermutation(shaderVK))
-        outCreateInfo.module = VKShaderModulePool::Get().GetOrCreateVkShaderModulePermutation(shaderVK, *pipelineLayout_);
+    {
+        if (VkShaderModule shaderModulePerm = VKShaderModulePool::Get().GetOrCreateVkShaderModulePermutation(shaderVK, *pipelineLayout_))
+            outCreateInfo.module = shaderModulePerm;
+    }
+    if (!specializationEntries_.empty())
+        outCreateInfo.pSpecializationInfo = &specializationInfo_;
 }
 
 
@@ -10,11 +10,17 @@
 
 
 #include <LLGL/PipelineState.h>
+#include <LLGL/PipelineStateFlags.h>
 #include <LLGL/Container/ArrayView.h>
+#include <LLGL/Report.h>
 #include <vulkan/vulkan.h>
 #include "../VKPtr.h"
+#include "VKPipelineLayout.h"
+#include "../../PipelineCompileTask.h"
 #include <vector>
 #include <cstdint>
+#include <functional>
+#include <atomic>
 
 
 namespace LLGL
@@ -24,7 +30,6 @@ namespace LLGL
 class Shader;
 class PipelineLayout;
 class VKShader;
-class VKPipelineLayout;
 
 class VKPipelineState : public PipelineState
 {
@@ -32,16 +37,26 @@ class VKPipelineState : public PipelineState
     public:
 
         VKPipelineState(
-            VkDevice                    device,
-            VkPipelineBindPoint         bindPoint,
-            const ArrayView<Shader*>&   shaders,
-            const PipelineLayout*       pipelineLayout = nullptr
+            VkDevice                                    device,
+            VkPipelineBindPoint                         bindPoint,
+            const ArrayView<Shader*>&                   shaders,
+            const ArrayView<SpecializationConstant>&    specializationConstants,
+            const PipelineLayout*                       pipelineLayout  = nullptr,
+            PipelineState*                              placeholder     = nullptr
         );
 
         const Report* GetReport() const override;
+        bool IsReady() const override final;
 
     public:
 
+        /*
+        Returns the PSO that is to be bound in place of this PSO:
+        This PSO if it is ready, its placeholder while it is still being compiled,
+        or this PSO after waiting for its compilation if there is no placeholder.
+        */
+        VKPipelineState& GetReadyPSO();
+
         // Binds this pipeline state and optional static descriptor sets (for immutable samplers) to the specified Vulkan command buffer.
         void BindPipelineAndStaticDescriptorSet(VkCommandBuffer commandBuffer);
 
@@ -51,13 +66,23 @@ class VKPipelineState : public PipelineState
         // Binds the specified descriptor set to teh heap descriptor set binding point.
         void BindHeapDescriptorSet(VkCommandBuffer commandBuffer, VkDescriptorSet descriptorSet);
 
-        // Pushes the specified values to the command buffer as push-constants.
-        void PushConstants(VkCommandBuffer commandBuffer, std::uint32_t first, const char* data, std::uint32_t size);
+        // Pushes the specified descriptors to the dynamic descriptor set binding point. Requires a pipeline layout that uses push descriptors.
+        void PushDynamicDescriptors(VkCommandBuffer commandBuffer, std::uint32_t numWrites, const VkWriteDescriptorSet* writes);
+
+        /*
+        Pushes the specified values to the command buffer as push-constants.
+        Values of uniforms that are part of the uniform block are copied into 'uniformBlockData' instead, which must be as large as the uniform block.
+        Returns true if any value was written to 'uniformBlockData'.
+        */
+        bool PushConstants(VkCommandBuffer commandBuffer, std::uint32_t first, const char* data, std::uint32_t size, char* uniformBlockData = nullptr);
 
-        // Returns the native PSO.
+        // Binds the specified descriptor set for the uniform block with the dynamic offset of its uniform buffer.
+        void BindUniformBlockDescriptorSet(VkCommandBuffer commandBuffer, VkDescriptorSet descriptorSet, std::uint32_t dynamicOffset);
+
+        // Returns the native PSO. This is the optimized PSO once it has been re-linked in the background (see OptimizeVkPipelineAsync).
         inline VkPipeline GetVkPipeline() const
         {
-            return pipeline_.Get();
+            return (optimizedPipelineReady_.load(std::memory_order_acquire) ? optimizedPipeline_.Get() : pipeline_.Get());
         }
 
         // Returns the pipeline binding point.
@@ -72,24 +97,55 @@ class VKPipelineState : public PipelineState
             return pipelineLayout_;
         }
 
+        // Returns the layout of the uniform block. Its size is zero if there is no uniform block.
+        inline const VKUniformBlockLayout& GetUniformBlock() const
+        {
+            return uniformBlock_;
+        }
+
     protected:
 
+        /*
+        Runs the specified function to create the native PSO.
+        If 'async' is true, the function is run on the global thread pool and exceptions are written to the report.
+        */
+        void CompileVkPipeline(const std::function<void()>& compileFunc, bool async);
+
+        /*
+        Runs the specified function on the global thread pool to create an optimized version of the native PSO.
+        Once it has finished, the optimized PSO is bound in place of the initial PSO, which is kept alive since command buffers might still refer to it.
+        Exceptions are ignored, since the initial PSO remains valid.
+        */
+        void OptimizeVkPipelineAsync(const std::function<void(VkPipeline* outPipeline)>& optimizeFunc);
+
+        // Waits until the asynchronous compilation and optimization have finished. This must be called in the destructor of each sub class.
+        void WaitForCompilation();
+
         // Releases the native PSO and returns its address.
         VkPipeline* ReleaseAndGetAddressOfVkPipeline();
 
         // Returns the native Vulkan pipeline layout this PSO was created with or the specified layout if there was no layout specified.
         VkPipelineLayout GetVkPipelineLayout() const;
 
+        // Returns true if this PSO has its own permutation of the pipeline layout for uniforms, i.e. its native pipeline layout is not shared with other PSOs.
+        inline bool HasPipelineLayoutPermutation() const
+        {
+            return (pipelineLayoutPerm_.Get() != VK_NULL_HANDLE);
+        }
+
         /*
         Fills the native shader stage descriptor for the specified shader:
         - If the pipeline layout constaints uniforms, the shader module will be parsed for push constants.
         - If the shader module has a binding set mismatch with the pipeline layout,
           a permutation of the shader module will be created to match the internal binding set layout of the Vulkan backend.
+        - If this PSO was created with specialization constants, they are assigned to the shader stage.
         */
         void GetShaderCreateInfoAndOptionalPermutation(VKShader& shaderVK, VkPipelineShaderStageCreateInfo& outCreateInfo);
 
     private:
 
+        void BuildSpecializationInfo(const ArrayView<SpecializationConstant>& specializationConstants);
+
         void BindDescriptorSets(
             VkCommandBuffer         commandBuffer,
             std::uint32_t           firstSet,
@@ -99,11 +155,21 @@ class VKPipelineState : public PipelineState
 
     private:
 
-        VKPtr<VkPipeline>                   pipeline_;
-        VKPtr<VkPipelineLayout>             pipelineLayoutPerm_;
-        const VKPipelineLayout*             pipelineLayout_     = nullptr;
-        VkPipelineBindPoint                 bindPoint_          = VK_PIPELINE_BIND_POINT_MAX_ENUM;
-        std::vector<VkPushConstantRange>    uniformRanges_;     // Push constant ranges; One range for each uniform descriptor. See UniformDescriptor.
+        VKPtr<VkPipeline>                       pipeline_;
+        VKPtr<VkPipelineLayout>                 pipelineLayoutPerm_;
+        const VKPipelineLayout*                 pipelineLayout_         = nullptr;
+        VkPipelineBindPoint                     bindPoint_              = VK_PIPELINE_BIND_POINT_MAX_ENUM;
+        std::vector<VkPushConstantRange>        uniformRanges_;         // Push constant ranges; One range for each uniform descriptor. See UniformDescriptor.
+        VKUniformBlockLayout                    uniformBlock_;          // Uniform block for uniforms that are not in a push-constant block.
+        std::vector<VkSpecializationMapEntry>   specializationEntries_; // One 32-bit entry for each specialization constant.
+        std::vector<std::uint32_t>              specializationData_;
+        VkSpecializationInfo                    specializationInfo_     = {};
+        Report                                  report_;
+        VKPipelineState*                        placeholder_            = nullptr;
+        mutable PipelineCompileTask             compileTask_;
+        VKPtr<VkPipeline>                       optimizedPipeline_;
+        std::atomic<bool>                       optimizedPipelineReady_ { false };
+        PipelineCompileTask                     optimizeTask_;
 
 };
 
@@ -13,15 +13,24 @@ namespace LLGL
 {
 
 
-// Returns the zero-based index of a descriptor pool for the specified descriptor type
-static std::uint32_t GetPoolIndex(VkDescriptorType type)
+std::uint32_t VKPoolSizeAccumulator::GetPoolIndex(VkDescriptorType type)
 {
     if (type >= VK_DESCRIPTOR_TYPE_SAMPLER && type <= VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT)
         return static_cast<std::uint32_t>(type);
+    else if (type == VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR)
+        return numCoreDescriptorTypes;
     else
         return -1;
 }
 
+VkDescriptorType VKPoolSizeAccumulator::GetPoolDescriptorType(std::uint32_t poolIndex)
+{
+    if (poolIndex < numCoreDescriptorTypes)
+        return static_cast<VkDescriptorType>(poolIndex);
+    else
+        return VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR;
+}
+
 void VKPoolSizeAccumulator::Accumulate(VkDescriptorType type, std::uint32_t count)
 {
     const auto poolIndex = GetPoolIndex(type);
@@ -36,7 +45,7 @@ void VKPoolSizeAccumulator::Finalize()
         {
             VkDescriptorPoolSize poolSizeInfo;
             {
-                poolSizeInfo.type               = static_cast<VkDescriptorType>(i);
+                poolSizeInfo.type               = GetPoolDescriptorType(i);
                 poolSizeInfo.descriptorCount    = countsPerType_[i];
             }
             poolSizes_.push_back(poolSizeInfo);
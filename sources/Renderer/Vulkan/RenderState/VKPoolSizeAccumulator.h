@@ -24,10 +24,20 @@ class VKPoolSizeAccumulator
 
     public:
 
-        static constexpr auto numDescriptorTypes = (static_cast<std::uint32_t>(VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT) + 1);
+        // Number of core descriptor types, i.e. VK_DESCRIPTOR_TYPE_SAMPLER to VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT.
+        static constexpr auto numCoreDescriptorTypes = (static_cast<std::uint32_t>(VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT) + 1);
+
+        // Number of descriptor types with an extra slot for VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR.
+        static constexpr auto numDescriptorTypes = (numCoreDescriptorTypes + 1);
 
     public:
 
+        // Returns the zero-based index of a descriptor pool for the specified descriptor type.
+        static std::uint32_t GetPoolIndex(VkDescriptorType type);
+
+        // Returns the descriptor type for the specified zero-based pool index. This is the inverse of GetPoolIndex().
+        static VkDescriptorType GetPoolDescriptorType(std::uint32_t poolIndex);
+
         // Accumulates the specified count for the type of descriptors to this container.
         void Accumulate(VkDescriptorType type, std::uint32_t count = 1);
 
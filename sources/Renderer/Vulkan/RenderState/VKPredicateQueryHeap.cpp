@@ -7,6 +7,7 @@
 
 #include "VKPredicateQueryHeap.h"
 #include "../Memory/VKDeviceMemoryManager.h"
+#include "../VKDevice.h"
 #include "../VKCore.h"
 #include "../VKTypes.h"
 #include <algorithm>
@@ -18,7 +19,7 @@ namespace LLGL
 
 
 VKPredicateQueryHeap::VKPredicateQueryHeap(
-    VkDevice                    device,
+    VKDevice&                   device,
     VKDeviceMemoryManager&      deviceMemoryManager,
     const QueryHeapDescriptor&  desc)
 :
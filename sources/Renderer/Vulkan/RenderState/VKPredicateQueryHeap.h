@@ -27,7 +27,7 @@ class VKPredicateQueryHeap final : public VKQueryHeap
     public:
 
         VKPredicateQueryHeap(
-            VkDevice                    device,
+            VKDevice&                   device,
             VKDeviceMemoryManager&      deviceMemoryManager,
             const QueryHeapDescriptor&  desc
         );
@@ -0,0 +1,148 @@
+/*
+ * VKPushDescriptorWriter.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VKPushDescriptorWriter.h"
+#include "VKPipelineLayout.h"
+#include "../Buffer/VKBuffer.h"
+#include "../Texture/VKTexture.h"
+#include "../Texture/VKSampler.h"
+#include "../../CheckedCast.h"
+
+
+namespace LLGL
+{
+
+
+void VKPushDescriptorWriter::Reset(const ArrayView<VKLayoutBinding>& bindings)
+{
+    VkWriteDescriptorSet initialWriteDescriptor = {};
+    {
+        initialWriteDescriptor.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    }
+
+    bindings_ = bindings;
+    writes_.clear();
+    writes_.resize(bindings.size(), initialWriteDescriptor);
+    bufferInfos_.resize(bindings.size());
+    imageInfos_.resize(bindings.size());
+    accelStructInfos_.resize(bindings.size());
+    accelStructs_.resize(bindings.size());
+    pushWrites_.reserve(bindings.size());
+    dirty_ = false;
+}
+
+void VKPushDescriptorWriter::WriteDescriptor(std::uint32_t descriptor, Resource& resource)
+{
+    if (!(descriptor < bindings_.size()))
+        return /*Out of bounds*/;
+
+    VkWriteDescriptorSet& writeDesc = writes_[descriptor];
+
+    switch (resource.GetResourceType())
+    {
+        case ResourceType::Buffer:
+        {
+            auto& bufferVK = LLGL_CAST(VKBuffer&, resource);
+            if (bindings_[descriptor].descriptorType == VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR)
+            {
+                /* Acceleration structures are written with an extension structure instead of buffer information */
+                accelStructs_[descriptor] = bufferVK.GetVkAccelerationStructure();
+                VkWriteDescriptorSetAccelerationStructureKHR& accelStructInfo = accelStructInfos_[descriptor];
+                {
+                    accelStructInfo.sType                       = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR;
+                    accelStructInfo.pNext                       = nullptr;
+                    accelStructInfo.accelerationStructureCount  = 1;
+                    accelStructInfo.pAccelerationStructures     = &(accelStructs_[descriptor]);
+                }
+                writeDesc.pNext         = &accelStructInfo;
+                writeDesc.pImageInfo    = nullptr;
+                writeDesc.pBufferInfo   = nullptr;
+            }
+            else
+            {
+                VkDescriptorBufferInfo& bufferInfo = bufferInfos_[descriptor];
+                {
+                    bufferInfo.buffer   = bufferVK.GetVkBuffer();
+                    bufferInfo.offset   = 0;
+                    bufferInfo.range    = VK_WHOLE_SIZE;
+                }
+                writeDesc.pNext         = nullptr;
+                writeDesc.pImageInfo    = nullptr;
+                writeDesc.pBufferInfo   = &bufferInfo;
+            }
+        }
+        break;
+
+        case ResourceType::Texture:
+        {
+            auto& textureVK = LLGL_CAST(VKTexture&, resource);
+            VkDescriptorImageInfo& imageInfo = imageInfos_[descriptor];
+            {
+                imageInfo.sampler       = VK_NULL_HANDLE;
+                imageInfo.imageView     = textureVK.GetVkImageView();
+                imageInfo.imageLayout   = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+            }
+            writeDesc.pNext         = nullptr;
+            writeDesc.pImageInfo    = &imageInfo;
+            writeDesc.pBufferInfo   = nullptr;
+        }
+        break;
+
+        case ResourceType::Sampler:
+        {
+            auto& samplerVK = LLGL_CAST(VKSampler&, resource);
+            VkDescriptorImageInfo& imageInfo = imageInfos_[descriptor];
+            {
+                imageInfo.sampler       = samplerVK.GetVkSampler();
+                imageInfo.imageView     = VK_NULL_HANDLE;
+                imageInfo.imageLayout   = VK_IMAGE_LAYOUT_UNDEFINED;
+            }
+            writeDesc.pNext         = nullptr;
+            writeDesc.pImageInfo    = &imageInfo;
+            writeDesc.pBufferInfo   = nullptr;
+        }
+        break;
+
+        default:
+            return /*Unsupported resource type*/;
+    }
+
+    /* The destination set is ignored for push descriptors */
+    const VKLayoutBinding& binding = bindings_[descriptor];
+    {
+        writeDesc.dstSet            = VK_NULL_HANDLE;
+        writeDesc.dstBinding        = binding.dstBinding;
+        writeDesc.dstArrayElement   = 0;
+        writeDesc.descriptorCount   = 1;
+        writeDesc.descriptorType    = binding.descriptorType;
+        writeDesc.pTexelBufferView  = nullptr;
+    }
+
+    dirty_ = true;
+}
+
+std::uint32_t VKPushDescriptorWriter::FlushWrites(const VkWriteDescriptorSet*& outWrites)
+{
+    pushWrites_.clear();
+    for (const VkWriteDescriptorSet& writeDesc : writes_)
+    {
+        if (writeDesc.descriptorCount > 0)
+            pushWrites_.push_back(writeDesc);
+    }
+
+    dirty_ = false;
+
+    outWrites = pushWrites_.data();
+    return static_cast<std::uint32_t>(pushWrites_.size());
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,77 @@
+/*
+ * VKPushDescriptorWriter.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VK_PUSH_DESCRIPTOR_WRITER_H
+#define LLGL_VK_PUSH_DESCRIPTOR_WRITER_H
+
+
+#include <vulkan/vulkan.h>
+#include <LLGL/Container/ArrayView.h>
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class Resource;
+struct VKLayoutBinding;
+
+/*
+Helper class to record dynamic resource bindings with push descriptors (see VK_KHR_push_descriptor).
+Holds at most one descriptor per dynamic binding, so the same binding can be written any number of times between two draw or dispatch commands.
+*/
+class VKPushDescriptorWriter
+{
+
+    public:
+
+        // Clears all descriptors and prepares the writer for the specified dynamic bindings of a pipeline layout.
+        void Reset(const ArrayView<VKLayoutBinding>& bindings);
+
+        // Stores the descriptor of the specified resource for the dynamic binding at index 'descriptor'. Replaces the previous descriptor of that binding.
+        void WriteDescriptor(std::uint32_t descriptor, Resource& resource);
+
+        // Returns all written descriptors that must be pushed and clears the invalidation state.
+        std::uint32_t FlushWrites(const VkWriteDescriptorSet*& outWrites);
+
+        // Marks all written descriptors to be pushed again, e.g. after a new pipeline state has been bound.
+        inline void Invalidate()
+        {
+            dirty_ = true;
+        }
+
+        // Returns true if any descriptors have been written since the last flush.
+        inline bool IsInvalidated() const
+        {
+            return dirty_;
+        }
+
+    private:
+
+        ArrayView<VKLayoutBinding>          bindings_;
+        std::vector<VkWriteDescriptorSet>   writes_;        // One write per dynamic binding; 'descriptorCount' is 0 for bindings that have not been written yet.
+        std::vector<VkDescriptorBufferInfo> bufferInfos_;
+        std::vector<VkDescriptorImageInfo>  imageInfos_;
+        std::vector<VkWriteDescriptorSet>   pushWrites_;    // Compacted list of written descriptors.
+        bool                                dirty_          = false;
+
+        std::vector<VkWriteDescriptorSetAccelerationStructureKHR>   accelStructInfos_;
+        std::vector<VkAccelerationStructureKHR>                     accelStructs_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
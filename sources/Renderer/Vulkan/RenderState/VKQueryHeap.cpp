@@ -8,6 +8,10 @@
 #include "VKQueryHeap.h"
 #include "../VKCore.h"
 #include "../VKTypes.h"
+#include "../VKDevice.h"
+#include "../Ext/VKExtensionRegistry.h"
+#include "../Ext/VKExtensions.h"
+#include <LLGL/Utils/ForRange.h>
 
 
 namespace LLGL
@@ -52,13 +56,15 @@ static VkQueryControlFlags GetQueryControlFlags(const QueryHeapDescriptor& desc)
     return flags;
 }
 
-VKQueryHeap::VKQueryHeap(VkDevice device, const QueryHeapDescriptor& desc) :
-    QueryHeap      { desc.type                    },
-    queryPool_     { device, vkDestroyQueryPool   },
-    controlFlags_  { GetQueryControlFlags(desc)   },
-    groupSize_     { GetQueryGroupSize(desc)      },
-    numQueries_    { desc.numQueries * groupSize_ },
-    hasPredicates_ { desc.renderCondition         }
+VKQueryHeap::VKQueryHeap(VKDevice& device, const QueryHeapDescriptor& desc) :
+    QueryHeap       { desc.type                                                                              },
+    device_         { device                                                                                 },
+    queryPool_      { device, vkDestroyQueryPool                                                             },
+    controlFlags_   { GetQueryControlFlags(desc)                                                             },
+    groupSize_      { GetQueryGroupSize(desc)                                                                },
+    numQueries_     { desc.numQueries * groupSize_                                                           },
+    hasPredicates_  { desc.renderCondition                                                                   },
+    hostResettable_ { device.GetOptionalFeatures().hostQueryReset && HasExtension(VKExt::EXT_host_query_reset) }
 {
     /* Create query pool object */
     VkQueryPoolCreateInfo createInfo;
@@ -72,6 +78,56 @@ VKQueryHeap::VKQueryHeap(VkDevice device, const QueryHeapDescriptor& desc) :
     }
     auto result = vkCreateQueryPool(device, &createInfo, nullptr, queryPool_.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan query pool");
+
+    /* Queries must be reset before their first use; without host query reset, this requires a one-time command buffer */
+    if (hostResettable_)
+    {
+        ResetQueries(0, numQueries_);
+        retrievedQueries_.resize(numQueries_, false);
+    }
+    else
+    {
+        VkCommandBuffer cmdBuffer = device.AllocCommandBuffer();
+        {
+            vkCmdResetQueryPool(cmdBuffer, queryPool_, 0, numQueries_);
+        }
+        device.FlushCommandBuffer(cmdBuffer);
+    }
+}
+
+void VKQueryHeap::ResetQueries(std::uint32_t firstQuery, std::uint32_t numQueries)
+{
+    vkResetQueryPoolEXT(device_, queryPool_, firstQuery, numQueries);
+}
+
+void VKQueryHeap::MarkQueriesRetrieved(std::uint32_t firstQuery, std::uint32_t numQueries)
+{
+    for_subrange(i, firstQuery, firstQuery + numQueries)
+        retrievedQueries_[i] = true;
+    hasRetrievedQueries_ = true;
+}
+
+void VKQueryHeap::ResetRetrievedQueries()
+{
+    if (!hasRetrievedQueries_)
+        return;
+
+    /* Reset each contiguous range of retrieved queries, since the other queries might still be in use by the GPU */
+    for (std::uint32_t first = 0; first < numQueries_;)
+    {
+        if (retrievedQueries_[first])
+        {
+            std::uint32_t last = first;
+            while (last < numQueries_ && retrievedQueries_[last])
+                retrievedQueries_[last++] = false;
+            ResetQueries(first, last - first);
+            first = last;
+        }
+        else
+            ++first;
+    }
+
+    hasRetrievedQueries_ = false;
 }
 
 
@@ -12,19 +12,37 @@
 #include <LLGL/QueryHeap.h>
 #include "../Vulkan.h"
 #include "../VKPtr.h"
+#include <vector>
 
 
 namespace LLGL
 {
 
 
+class VKDevice;
+
 // Base class for Vulkan query heaps (sub class: VKPredicateQueryHeap).
 class VKQueryHeap : public QueryHeap
 {
 
     public:
 
-        VKQueryHeap(VkDevice device, const QueryHeapDescriptor& desc);
+        VKQueryHeap(VKDevice& device, const QueryHeapDescriptor& desc);
+
+        /*
+        Resets the specified range of native queries on the host, so they can be written again without recording vkCmdResetQueryPool.
+        This must only be called if the queries are not in use by the GPU, e.g. after their results have been retrieved, and if IsHostResettable() is true.
+        */
+        void ResetQueries(std::uint32_t firstQuery, std::uint32_t numQueries);
+
+        /*
+        Marks the specified range of native queries as retrieved, i.e. the GPU no longer uses them and their results have been read.
+        They are not reset until ResetRetrievedQueries() is called, so their results can be read again until then. Only used if IsHostResettable() is true.
+        */
+        void MarkQueriesRetrieved(std::uint32_t firstQuery, std::uint32_t numQueries);
+
+        // Resets all queries on the host that have been marked as retrieved. This must be called before a command buffer that writes these queries is submitted.
+        void ResetRetrievedQueries();
 
         // Returns the Vulkan VkQueryPool object.
         inline VkQueryPool GetVkQueryPool() const
@@ -56,13 +74,24 @@ class VKQueryHeap : public QueryHeap
             return hasPredicates_;
         }
 
+        // Returns true if the queries of this heap can be reset on the host with VK_EXT_host_query_reset.
+        inline bool IsHostResettable() const
+        {
+            return hostResettable_;
+        }
+
     private:
 
+        VkDevice            device_         = VK_NULL_HANDLE;
         VKPtr<VkQueryPool>  queryPool_;
         VkQueryControlFlags controlFlags_   = 0;
         std::uint32_t       groupSize_      = 1;
         std::uint32_t       numQueries_     = 0;
         bool                hasPredicates_  = false;
+        bool                hostResettable_ = false;
+
+        std::vector<bool>   retrievedQueries_;              // Native queries that are reset on the host before their next submission
+        bool                hasRetrievedQueries_ = false;
 
 };
 
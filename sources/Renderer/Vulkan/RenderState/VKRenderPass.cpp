@@ -8,27 +8,36 @@
 #include "VKRenderPass.h"
 #include "../VKCore.h"
 #include "../VKTypes.h"
+#include "VKPipelineLibraryPool.h"
 #include "../../RenderPassUtils.h"
 #include "../../../Core/Assertion.h"
 #include <LLGL/Utils/ForRange.h>
 #include <limits>
+#include <vector>
+#include <algorithm>
 
 
 namespace LLGL
 {
 
 
-VKRenderPass::VKRenderPass(VkDevice device) :
-    renderPass_ { device, vkDestroyRenderPass }
+VKRenderPass::VKRenderPass(VkDevice device, bool dynamicRendering) :
+    renderPass_         { device, vkDestroyRenderPass },
+    dynamicRendering_   { dynamicRendering            }
 {
 }
 
-VKRenderPass::VKRenderPass(VkDevice device, const RenderPassDescriptor& desc) :
-    VKRenderPass { device }
+VKRenderPass::VKRenderPass(VkDevice device, const RenderPassDescriptor& desc, bool dynamicRendering) :
+    VKRenderPass { device, dynamicRendering }
 {
     CreateVkRenderPass(device, desc);
 }
 
+VKRenderPass::~VKRenderPass()
+{
+    VKPipelineLibraryPool::Get().NotifyReleaseRenderPass(this);
+}
+
 static void InitColorVkAttachmentDesc(
     VkAttachmentDescription&    dst,
     Format                      format,
@@ -164,27 +173,165 @@ void VKRenderPass::CreateVkRenderPass(VkDevice device, const RenderPassDescripto
     }
 
     /* Create render pass with native attachment descriptors */
-    CreateVkRenderPassWithDescriptors(device, numAttachments, numColorAttachments, attachmentDescs, sampleCountBits);
+    CreateVkRenderPassWithDescriptors(device, numAttachments, numColorAttachments, attachmentDescs, sampleCountBits, desc.subpasses);
+}
+
+// Native attachment references of a single subpass
+struct VKSubpassReferences
+{
+    VkAttachmentReference   colorAttachmentsRefs[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
+    VkAttachmentReference   resolveAttachmentsRefs[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
+    VkAttachmentReference   inputAttachmentsRefs[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
+    std::uint32_t           preserveAttachments[LLGL_MAX_NUM_ATTACHMENTS];
+};
+
+static void InitVkAttachmentReference(VkAttachmentReference& dst, std::uint32_t attachment, VkImageLayout layout)
+{
+    dst.attachment  = attachment;
+    dst.layout      = layout;
+}
+
+static void InitVkAttachmentReferenceUnused(VkAttachmentReference& dst)
+{
+    InitVkAttachmentReference(dst, VK_ATTACHMENT_UNUSED, VK_IMAGE_LAYOUT_UNDEFINED);
+}
+
+/*
+Initializes the subpass descriptions of a render pass with multiple subpasses.
+Each subpass references all color attachments so the attachment locations match the fragment shader outputs;
+attachments that are not written in a subpass are marked as unused. Input attachments are indexed by their color attachment index.
+*/
+static void InitVkSubpassDescs(
+    const ArrayView<SubpassDescriptor>& subpasses,
+    std::uint32_t                       numAttachments,
+    std::uint32_t                       numColorAttachments,
+    const VkAttachmentReference*        depthStencilAttachmentRef,
+    bool                                hasMultiSampling,
+    const VkAttachmentDescription*      attachmentDescs,
+    VKSubpassReferences*                outRefs,
+    VkSubpassDescription*               outSubpassDescs)
+{
+    /* Find last subpass that writes to each color attachment to resolve multi-sampled attachments only once */
+    std::uint32_t lastWritingSubpass[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
+    for_range(i, numColorAttachments)
+    {
+        lastWritingSubpass[i] = ~0u;
+        for_range(j, subpasses.size())
+        {
+            if ((subpasses[j].colorAttachmentMask & (1u << i)) != 0)
+                lastWritingSubpass[i] = static_cast<std::uint32_t>(j);
+        }
+    }
+
+    for_range(i, subpasses.size())
+    {
+        const SubpassDescriptor&    src     = subpasses[i];
+        VKSubpassReferences&        refs    = outRefs[i];
+        std::uint32_t               numInputAttachments     = 0;
+        std::uint32_t               numPreserveAttachments  = 0;
+
+        std::uint32_t resolveAttachmentIndex = numAttachments;
+        for_range(j, numColorAttachments)
+        {
+            const bool isColor = ((src.colorAttachmentMask & (1u << j)) != 0);
+            const bool isInput = ((src.inputAttachmentMask & (1u << j)) != 0);
+
+            if (isColor)
+                InitVkAttachmentReference(refs.colorAttachmentsRefs[j], j, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+            else
+                InitVkAttachmentReferenceUnused(refs.colorAttachmentsRefs[j]);
+
+            if (isInput)
+            {
+                InitVkAttachmentReference(refs.inputAttachmentsRefs[j], j, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+                numInputAttachments = j + 1;
+            }
+            else
+                InitVkAttachmentReferenceUnused(refs.inputAttachmentsRefs[j]);
+
+            if (hasMultiSampling)
+            {
+                if (attachmentDescs[numAttachments + j].format == VK_FORMAT_UNDEFINED)
+                    InitVkAttachmentReferenceUnused(refs.resolveAttachmentsRefs[j]);
+                else if (lastWritingSubpass[j] == i)
+                    InitVkAttachmentReference(refs.resolveAttachmentsRefs[j], resolveAttachmentIndex++, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+                else
+                {
+                    InitVkAttachmentReferenceUnused(refs.resolveAttachmentsRefs[j]);
+                    ++resolveAttachmentIndex;
+                }
+            }
+
+            /* Preserve contents of attachments that are not referenced in this subpass */
+            if (!isColor && !isInput)
+                refs.preserveAttachments[numPreserveAttachments++] = j;
+        }
+
+        if (depthStencilAttachmentRef != nullptr && !src.depthStencilAttachment)
+            refs.preserveAttachments[numPreserveAttachments++] = depthStencilAttachmentRef->attachment;
+
+        VkSubpassDescription& dst = outSubpassDescs[i];
+        {
+            dst.flags                   = 0;
+            dst.pipelineBindPoint       = VK_PIPELINE_BIND_POINT_GRAPHICS;
+            dst.inputAttachmentCount    = numInputAttachments;
+            dst.pInputAttachments       = (numInputAttachments > 0 ? refs.inputAttachmentsRefs : nullptr);
+            dst.colorAttachmentCount    = numColorAttachments;
+            dst.pColorAttachments       = refs.colorAttachmentsRefs;
+            dst.pResolveAttachments     = (hasMultiSampling && numColorAttachments > 0 ? refs.resolveAttachmentsRefs : nullptr);
+            dst.pDepthStencilAttachment = (src.depthStencilAttachment ? depthStencilAttachmentRef : nullptr);
+            dst.preserveAttachmentCount = numPreserveAttachments;
+            dst.pPreserveAttachments    = (numPreserveAttachments > 0 ? refs.preserveAttachments : nullptr);
+        }
+    }
+}
+
+// Initializes the subpass dependency for attachment writes of the previous subpass that are read by the next subpass.
+static void InitVkSubpassDependency(VkSubpassDependency& dst, std::uint32_t dstSubpass)
+{
+    dst.srcSubpass      = dstSubpass - 1;
+    dst.dstSubpass      = dstSubpass;
+    dst.srcStageMask    = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT |
+                          VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT    |
+                          VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+    dst.dstStageMask    = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT         |
+                          VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT |
+                          VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT    |
+                          VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+    dst.srcAccessMask   = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT          |
+                          VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+    dst.dstAccessMask   = VK_ACCESS_INPUT_ATTACHMENT_READ_BIT           |
+                          VK_ACCESS_COLOR_ATTACHMENT_READ_BIT           |
+                          VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT          |
+                          VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT   |
+                          VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+    dst.dependencyFlags = VK_DEPENDENCY_BY_REGION_BIT;
 }
 
 void VKRenderPass::CreateVkRenderPassWithDescriptors(
-    VkDevice                        device,
-    std::uint32_t                   numAttachments,
-    std::uint32_t                   numColorAttachments,
-    const VkAttachmentDescription*  attachmentDescs,
-    VkSampleCountFlagBits           sampleCountBits)
+    VkDevice                                device,
+    std::uint32_t                           numAttachments,
+    std::uint32_t                           numColorAttachments,
+    const VkAttachmentDescription*          attachmentDescs,
+    VkSampleCountFlagBits                   sampleCountBits,
+    const ArrayView<SubpassDescriptor>&     subpasses)
 {
     LLGL_ASSERT(numAttachments <= LLGL_MAX_NUM_ATTACHMENTS);
     LLGL_ASSERT(numColorAttachments <= LLGL_MAX_NUM_COLOR_ATTACHMENTS);
 
+    /* Pipeline library parts refer to the previous native render pass object */
+    if (renderPass_.Get() != VK_NULL_HANDLE)
+        VKPipelineLibraryPool::Get().NotifyReleaseRenderPass(this);
+
     /* Uninitialized stack memory for descriptor containers */
     VkAttachmentReference colorAttachmentsRefs[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
     VkAttachmentReference resolveAttachmentsRefs[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
     VkAttachmentReference depthStencilAttachmentRef;
 
-    /* Store sample count bits and number of color attachments (required for default blend states in VKGraphicsPipeline) */
+    /* Store sample count bits and number of color attachments (required for default blend states in VKGraphicsPipeline) and subpasses */
     sampleCountBits_        = sampleCountBits;
     numColorAttachments_    = static_cast<std::uint8_t>(numColorAttachments);
+    numSubpasses_           = static_cast<std::uint8_t>(std::max<std::size_t>(1, subpasses.size()));
 
     /* Build bitmask for clear values: least significant bit (LSB) is used for the first attachment */
     clearValuesMask_ = 0;
@@ -198,6 +345,12 @@ void VKRenderPass::CreateVkRenderPassWithDescriptors(
         }
     }
 
+    /* Store attachment descriptors to begin dynamic rendering and create graphics pipelines without native render pass */
+    for_range(i, numAttachments)
+        attachmentDescs_[i] = attachmentDescs[i];
+    for_range(i, numColorAttachments)
+        colorFormats_[i] = attachmentDescs[i].format;
+
     /* Initialize attachment reference */
     for_range(i, numColorAttachments)
     {
@@ -213,6 +366,13 @@ void VKRenderPass::CreateVkRenderPassWithDescriptors(
         depthStencilAttachmentRef.layout        = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
     }
 
+    /* Dynamic rendering does not require a native render pass object */
+    if (dynamicRendering_)
+    {
+        renderPass_.Release();
+        return;
+    }
+
     const bool hasMultiSampling = (sampleCountBits > VK_SAMPLE_COUNT_1_BIT);
     if (hasMultiSampling)
     {
@@ -232,6 +392,55 @@ void VKRenderPass::CreateVkRenderPassWithDescriptors(
         }
     }
 
+    /* Create render pass with explicit subpasses if specified */
+    if (!subpasses.empty())
+    {
+        const std::uint32_t numSubpasses = static_cast<std::uint32_t>(subpasses.size());
+
+        std::vector<VKSubpassReferences>    subpassRefs(numSubpasses);
+        std::vector<VkSubpassDescription>   subpassDescs(numSubpasses);
+        std::vector<VkSubpassDependency>    subpassDeps(numSubpasses);
+
+        InitVkSubpassDescs(
+            subpasses,
+            numAttachments,
+            numColorAttachments,
+            (hasDepthStencil ? &depthStencilAttachmentRef : nullptr),
+            hasMultiSampling,
+            attachmentDescs,
+            subpassRefs.data(),
+            subpassDescs.data()
+        );
+
+        /* Initialize external dependency for the first subpass and chain all subsequent subpasses */
+        subpassDeps[0].srcSubpass       = VK_SUBPASS_EXTERNAL;
+        subpassDeps[0].dstSubpass       = 0;
+        subpassDeps[0].srcStageMask     = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+        subpassDeps[0].dstStageMask     = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+        subpassDeps[0].srcAccessMask    = 0;
+        subpassDeps[0].dstAccessMask    = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+        subpassDeps[0].dependencyFlags  = 0;
+
+        for_subrange(i, 1, numSubpasses)
+            InitVkSubpassDependency(subpassDeps[i], i);
+
+        VkRenderPassCreateInfo createInfo;
+        {
+            createInfo.sType            = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+            createInfo.pNext            = nullptr;
+            createInfo.flags            = 0;
+            createInfo.attachmentCount  = (hasMultiSampling ? numAttachments + numColorAttachments : numAttachments);
+            createInfo.pAttachments     = attachmentDescs;
+            createInfo.subpassCount     = numSubpasses;
+            createInfo.pSubpasses       = subpassDescs.data();
+            createInfo.dependencyCount  = numSubpasses;
+            createInfo.pDependencies    = subpassDeps.data();
+        }
+        VkResult result = vkCreateRenderPass(device, &createInfo, nullptr, renderPass_.ReleaseAndGetAddressOf());
+        VKThrowIfFailed(result, "failed to create Vulkan render pass with subpasses");
+        return;
+    }
+
     /* Initialize sub-pass descriptor */
     VkSubpassDescription subpassDesc;
     {
@@ -276,6 +485,19 @@ void VKRenderPass::CreateVkRenderPassWithDescriptors(
     VKThrowIfFailed(result, "failed to create Vulkan render pass");
 }
 
+void VKRenderPass::GetVkPipelineRenderingCreateInfo(VkPipelineRenderingCreateInfoKHR& outCreateInfo) const
+{
+    const VkFormat depthStencilFormat = (depthStencilIndex_ != 0xFFu ? attachmentDescs_[depthStencilIndex_].format : VK_FORMAT_UNDEFINED);
+
+    outCreateInfo.sType                     = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR;
+    outCreateInfo.pNext                     = nullptr;
+    outCreateInfo.viewMask                  = 0;
+    outCreateInfo.colorAttachmentCount      = numColorAttachments_;
+    outCreateInfo.pColorAttachmentFormats   = colorFormats_;
+    outCreateInfo.depthAttachmentFormat     = (VKTypes::IsVkFormatDepth(depthStencilFormat) ? depthStencilFormat : VK_FORMAT_UNDEFINED);
+    outCreateInfo.stencilAttachmentFormat   = (VKTypes::IsVkFormatStencil(depthStencilFormat) ? depthStencilFormat : VK_FORMAT_UNDEFINED);
+}
+
 
 } // /namespace LLGL
 
@@ -10,6 +10,8 @@
 
 
 #include <LLGL/RenderPass.h>
+#include <LLGL/RenderPassFlags.h>
+#include <LLGL/Constants.h>
 #include <vulkan/vulkan.h>
 #include "../VKPtr.h"
 #include <cstdint>
@@ -19,15 +21,15 @@ namespace LLGL
 {
 
 
-struct RenderPassDescriptor;
-
 class VKRenderPass final : public RenderPass
 {
 
     public:
 
-        VKRenderPass(VkDevice device);
-        VKRenderPass(VkDevice device, const RenderPassDescriptor& desc);
+        // If 'dynamicRendering' is true, no native render pass object is created and this render pass only describes the attachments for dynamic rendering.
+        VKRenderPass(VkDevice device, bool dynamicRendering = false);
+        VKRenderPass(VkDevice device, const RenderPassDescriptor& desc, bool dynamicRendering = false);
+        ~VKRenderPass();
 
         // (Re-)creates the render pass object.
         void CreateVkRenderPass(
@@ -35,20 +37,37 @@ class VKRenderPass final : public RenderPass
             const RenderPassDescriptor& desc
         );
 
+        // Creates the render pass object with native attachment descriptors. If 'subpasses' is empty, a single subpass with all attachments is created.
         void CreateVkRenderPassWithDescriptors(
-            VkDevice                        device,
-            std::uint32_t                   numAttachments,
-            std::uint32_t                   numColorAttachments,
-            const VkAttachmentDescription*  attachmentDescs,
-            VkSampleCountFlagBits           sampleCountBits
+            VkDevice                                device,
+            std::uint32_t                           numAttachments,
+            std::uint32_t                           numColorAttachments,
+            const VkAttachmentDescription*          attachmentDescs,
+            VkSampleCountFlagBits                   sampleCountBits,
+            const ArrayView<SubpassDescriptor>&     subpasses           = {}
         );
 
-        // Returns the Vulkan render pass object.
+        // Returns the Vulkan render pass object. This is VK_NULL_HANDLE if this render pass is used for dynamic rendering.
         inline VkRenderPass GetVkRenderPass() const
         {
             return renderPass_;
         }
 
+        // Returns true if this render pass only describes the attachments for dynamic rendering (see VK_KHR_dynamic_rendering).
+        inline bool IsDynamicRendering() const
+        {
+            return dynamicRendering_;
+        }
+
+        // Returns the native descriptor of the specified color attachment or the depth-stencil attachment (see GetDepthStencilIndex).
+        inline const VkAttachmentDescription& GetAttachmentDesc(std::uint32_t index) const
+        {
+            return attachmentDescs_[index];
+        }
+
+        // Returns the attachment formats of this render pass to create graphics pipelines for dynamic rendering. 'outCreateInfo' refers to memory of this render pass.
+        void GetVkPipelineRenderingCreateInfo(VkPipelineRenderingCreateInfoKHR& outCreateInfo) const;
+
         /*
         Returns the bitmask for all attachments that require a clear value.
         the least significant bit specifies whether the first attachment has a clear value or not.
@@ -82,14 +101,25 @@ class VKRenderPass final : public RenderPass
             return sampleCountBits_;
         }
 
+        // Returns the number of subpasses of this render pass.
+        inline std::uint8_t GetNumSubpasses() const
+        {
+            return numSubpasses_;
+        }
+
     private:
 
         VKPtr<VkRenderPass>     renderPass_;
+        bool                    dynamicRendering_       = false;
+
+        VkAttachmentDescription attachmentDescs_[LLGL_MAX_NUM_ATTACHMENTS];     // Color attachments followed by the depth-stencil attachment; excludes resolve attachments.
+        VkFormat                colorFormats_[LLGL_MAX_NUM_COLOR_ATTACHMENTS];  // Color attachment formats for VkPipelineRenderingCreateInfoKHR.
 
         std::uint64_t           clearValuesMask_        = 0;
         std::uint8_t            depthStencilIndex_      = 0xFFu;
         std::uint8_t            numClearValues_         = 0;
         std::uint8_t            numColorAttachments_    = 0;
+        std::uint8_t            numSubpasses_           = 1;
         VkSampleCountFlagBits   sampleCountBits_        = VK_SAMPLE_COUNT_1_BIT;
 
 };
@@ -14,6 +14,7 @@
 #include "../Texture/VKTexture.h"
 #include "../VKTypes.h"
 #include "../VKCore.h"
+#include "../Ext/VKExtensionRegistry.h"
 #include "../../ResourceUtils.h"
 #include "../../TextureUtils.h"
 #include "../../BufferUtils.h"
@@ -34,8 +35,6 @@ VKResourceHeap::VKResourceHeap(
     VkDevice                                    device,
     const ResourceHeapDescriptor&               desc,
     const ArrayView<ResourceViewDescriptor>&    initialResourceViews)
-:
-    descriptorPool_ { device, vkDestroyDescriptorPool }
 {
     /* Get pipeline layout object */
     auto* pipelineLayoutVK = LLGL_CAST(VKPipelineLayout*, desc.pipelineLayout);
@@ -48,10 +47,9 @@ VKResourceHeap::VKResourceHeap(
     const std::uint32_t numBindings         = static_cast<std::uint32_t>(bindings_.size());
     const std::uint32_t numResourceViews    = GetNumResourceViewsOrThrow(numBindings, desc, initialResourceViews);
 
-    /* Create descriptor pool and array of descriptor sets */
+    /* Allocate array of descriptor sets from shared pool */
     const std::uint32_t numDescriptorSets = (numResourceViews / numBindings);
-    CreateDescriptorPool(device, numDescriptorSets);
-    CreateDescriptorSets(device, numDescriptorSets, pipelineLayoutVK->GetSetLayoutForHeapBindings());
+    AllocateDescriptorSets(device, numDescriptorSets, pipelineLayoutVK->GetSetLayoutForHeapBindings());
 
     /* Allocate array for descriptor set barriers */
     if ((desc.barrierFlags & BarrierFlags::Storage) != 0)
@@ -62,6 +60,13 @@ VKResourceHeap::VKResourceHeap(
         WriteResourceViews(device, 0, initialResourceViews);
 }
 
+VKResourceHeap::~VKResourceHeap()
+{
+    /* Return descriptor sets to the shared pool, so they can be recycled by other resource heaps with the same layout */
+    if (layoutPool_ != nullptr)
+        VKHeapDescriptorSetPool::Get().FreeDescriptorSets(layoutPool_, GetNumDescriptorSets(), descriptorSets_.data());
+}
+
 std::uint32_t VKResourceHeap::GetNumDescriptorSets() const
 {
     return static_cast<std::uint32_t>(descriptorSets_.size());
@@ -115,6 +120,7 @@ std::uint32_t VKResourceHeap::WriteResourceViews(
 
             case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
             case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+            case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
                 FillWriteDescriptorWithImageView(device, desc, descriptorSet, binding, setWriter);
                 break;
 
@@ -123,6 +129,10 @@ std::uint32_t VKResourceHeap::WriteResourceViews(
                 FillWriteDescriptorWithBufferRange(device, desc, descriptorSet, binding, setWriter, barrierWriter);
                 break;
 
+            case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
+                FillWriteDescriptorWithAccelerationStructure(desc, descriptorSet, binding, setWriter);
+                break;
+
             default:
                 LLGL_TRAP("invalid descriptor type in Vulkan descriptor set: %s", IntToHex(static_cast<std::uint32_t>(binding.descriptorType)));
                 break;
@@ -134,7 +144,10 @@ std::uint32_t VKResourceHeap::WriteResourceViews(
     if (setWriter.GetNumWrites() > 0)
     {
         /* All command buffers must have finished execution before any affected descriptor set can be updated */
-        vkDeviceWaitIdle(device);
+        {
+            std::lock_guard<std::mutex> guard{ VKGetQueueMutex() };
+            vkDeviceWaitIdle(device);
+        }
         setWriter.UpdateDescriptorSets(device);
     }
 
@@ -151,16 +164,17 @@ std::uint32_t VKResourceHeap::WriteResourceViews(
     return setWriter.GetNumWrites();
 }
 
-void VKResourceHeap::SubmitPipelineBarrier(VkCommandBuffer commandBuffer, std::uint32_t descriptorSet)
+VKPipelineBarrier* VKResourceHeap::GetPipelineBarrier(std::uint32_t descriptorSet) const
 {
     if (descriptorSet < barriers_.size())
     {
         if (VKPipelineBarrier* barrier = barriers_[descriptorSet].get())
         {
             if (barrier->IsActive())
-                barrier->Submit(commandBuffer);
+                return barrier;
         }
     }
+    return nullptr;
 }
 
 
@@ -184,6 +198,10 @@ static VkPipelineStageFlags ToVkStageFlags(long stageFlags)
         bitmask |= VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
     if ((stageFlags & StageFlags::ComputeStage) != 0)
         bitmask |= VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+    if ((stageFlags & StageFlags::TaskStage) != 0 && HasExtension(VKExt::EXT_mesh_shader))
+        bitmask |= VK_PIPELINE_STAGE_TASK_SHADER_BIT_EXT;
+    if ((stageFlags & StageFlags::MeshStage) != 0 && HasExtension(VKExt::EXT_mesh_shader))
+        bitmask |= VK_PIPELINE_STAGE_MESH_SHADER_BIT_EXT;
 
     return bitmask;
 }
@@ -193,7 +211,8 @@ static bool IsDescriptorTypeImageView(VkDescriptorType type)
     return
     (
         type == VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE ||
-        type == VK_DESCRIPTOR_TYPE_STORAGE_IMAGE
+        type == VK_DESCRIPTOR_TYPE_STORAGE_IMAGE ||
+        type == VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT
     );
 }
 
@@ -226,51 +245,26 @@ void VKResourceHeap::CopyLayoutBinding(VKDescriptorBinding& dst, const VKLayoutB
     dst.bufferViewIndex = (IsDescriptorTypeBufferView(src.descriptorType) ? numBufferViewsPerSet_++ : VKResourceHeap::invalidViewIndex);
 }
 
-void VKResourceHeap::CreateDescriptorPool(VkDevice device, std::uint32_t numDescriptorSets)
-{
-    /* Accumulate descriptor pool sizes */
-    VKPoolSizeAccumulator poolSizeAccum;
-    for (const VKDescriptorBinding& binding : bindings_)
-        poolSizeAccum.Accumulate(binding.descriptorType, numDescriptorSets);
-    poolSizeAccum.Finalize();
-
-    /* Create Vulkan descriptor pool */
-    VkDescriptorPoolCreateInfo poolCreateInfo;
-    {
-        poolCreateInfo.sType            = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
-        poolCreateInfo.pNext            = nullptr;
-        poolCreateInfo.flags            = 0;
-        poolCreateInfo.maxSets          = numDescriptorSets;
-        poolCreateInfo.poolSizeCount    = poolSizeAccum.Size();
-        poolCreateInfo.pPoolSizes       = poolSizeAccum.Data();
-    }
-    VkResult result = vkCreateDescriptorPool(device, &poolCreateInfo, nullptr, descriptorPool_.ReleaseAndGetAddressOf());
-    VKThrowIfFailed(result, "failed to create Vulkan descriptor pool");
-}
-
-void VKResourceHeap::CreateDescriptorSets(
+void VKResourceHeap::AllocateDescriptorSets(
     VkDevice                device,
     std::uint32_t           numDescriptorSets,
     VkDescriptorSetLayout   globalSetLayout)
 {
-    /* Use copy of descritpor set layout for each descriptor set */
-    std::vector<VkDescriptorSetLayout> setLayouts;
-    setLayouts.resize(numDescriptorSets, globalSetLayout);
+    /* Accumulate descriptor pool sizes for a single descriptor set */
+    VKPoolSizeAccumulator poolSizeAccum;
+    for (const VKDescriptorBinding& binding : bindings_)
+        poolSizeAccum.Accumulate(binding.descriptorType);
+    poolSizeAccum.Finalize();
 
-    /* Pre-allocate descriptor sets */
+    /* Allocate descriptor sets from the pool that is shared between all resource heaps with the same descriptor set layout */
     descriptorSets_.resize(numDescriptorSets, VK_NULL_HANDLE);
-
-    /* Allocate descriptor set */
-    VkDescriptorSetAllocateInfo allocInfo;
-    {
-        allocInfo.sType                 = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
-        allocInfo.pNext                 = nullptr;
-        allocInfo.descriptorPool        = descriptorPool_;
-        allocInfo.descriptorSetCount    = numDescriptorSets;
-        allocInfo.pSetLayouts           = setLayouts.data();
-    }
-    VkResult result = vkAllocateDescriptorSets(device, &allocInfo, descriptorSets_.data());
-    VKThrowIfFailed(result, "failed to allocate Vulkan descriptor sets");
+    layoutPool_ = VKHeapDescriptorSetPool::Get().AllocateDescriptorSets(
+        device,
+        globalSetLayout,
+        ArrayView<VkDescriptorPoolSize>(poolSizeAccum.Data(), poolSizeAccum.Size()),
+        numDescriptorSets,
+        descriptorSets_.data()
+    );
 }
 
 void VKResourceHeap::FillWriteDescriptorWithSampler(
@@ -382,30 +376,56 @@ void VKResourceHeap::FillWriteDescriptorWithBufferRange(
     }
 }
 
+void VKResourceHeap::FillWriteDescriptorWithAccelerationStructure(
+    const ResourceViewDescriptor&   desc,
+    std::uint32_t                   descriptorSet,
+    const VKDescriptorBinding&      binding,
+    VKDescriptorSetWriter&          setWriter)
+{
+    auto* bufferVK = LLGL_CAST(VKBuffer*, desc.resource);
+
+    /* Acceleration structures are always bound as a whole, so the buffer view is ignored */
+    const VkWriteDescriptorSetAccelerationStructureKHR* accelStructInfo = setWriter.NextAccelerationStructureInfo(bufferVK->GetVkAccelerationStructure());
+
+    /* Initialize write descriptor */
+    VkWriteDescriptorSet* writeDesc = setWriter.NextWriteDescriptor();
+    {
+        writeDesc->pNext            = accelStructInfo;
+        writeDesc->dstSet           = descriptorSets_[descriptorSet];
+        writeDesc->dstBinding       = binding.dstBinding;
+        writeDesc->dstArrayElement  = 0;
+        writeDesc->descriptorCount  = 1;
+        writeDesc->descriptorType   = binding.descriptorType;
+        writeDesc->pImageInfo       = nullptr;
+        writeDesc->pBufferInfo      = nullptr;
+        writeDesc->pTexelBufferView = nullptr;
+    }
+}
+
 bool VKResourceHeap::ExchangeBufferBarrier(std::uint32_t descriptorSet, Buffer* resource, const VKDescriptorBinding& binding)
 {
     if (descriptorSet < barriers_.size())
     {
         if ((resource->GetBindFlags() & BindFlags::Storage) != 0)
-            return EmplaceBarrier(descriptorSet, binding.dstBinding, resource, binding.stageFlags);
+            return EmplaceBarrier(descriptorSet, resource, binding);
         else
             return RemoveBarrier(descriptorSet, binding.dstBinding);
     }
     return false;
 }
 
-bool VKResourceHeap::EmplaceBarrier(std::uint32_t descriptorSet, std::uint32_t slot, Resource* resource, VkPipelineStageFlags stageFlags)
+bool VKResourceHeap::EmplaceBarrier(std::uint32_t descriptorSet, Resource* resource, const VKDescriptorBinding& binding)
 {
     if (VKPipelineBarrier* barrier = barriers_[descriptorSet].get())
     {
         /* Emplace into existing pipeline barrier */
-        return barrier->Emplace(slot, resource, stageFlags);
+        return barrier->Emplace(binding.dstBinding, resource, binding.stageFlags, binding.descriptorType);
     }
     else
     {
         /* Allocate new pipeline barrier for descriptor set */
         VKPipelineBarrierPtr newBarrier = MakeUnique<VKPipelineBarrier>();
-        newBarrier->Emplace(slot, resource, stageFlags);
+        newBarrier->Emplace(binding.dstBinding, resource, binding.stageFlags, binding.descriptorType);
         barriers_[descriptorSet] = std::move(newBarrier);
         return true;
     }
@@ -427,27 +447,19 @@ VkImageView VKResourceHeap::GetOrCreateImageView(
 {
     if (IsTextureViewEnabled(desc.textureView))
     {
-        /* Creates a new image view for the specified subresource descriptor */
-        VKPtr<VkImageView> imageView{ device, vkDestroyImageView };
-        textureVK.CreateImageView(device, desc.textureView, imageView);
-
-        /* Remove previous image view entry */
-        if (imageViewIndex < imageViews_.size() && imageViews_[imageViewIndex])
-            imageViews_[imageViewIndex].Release();
-
         /* Increase image view container for new entry */
         if (imageViewIndex >= imageViews_.size())
             imageViews_.resize(imageViewIndex + 1);
 
-        /* Emplace new image view entry */
-        imageViews_[imageViewIndex] = std::move(imageView);
-        return imageViews_[imageViewIndex].Get();
+        /* Share image view with all other heaps that refer to the same texture view; this replaces the previous entry */
+        imageViews_[imageViewIndex] = textureVK.GetOrCreateSharedImageView(device, desc.textureView);
+        return imageViews_[imageViewIndex]->Get();
     }
     else
     {
         /* Remove previous image view entry */
-        if (imageViewIndex < imageViews_.size() && imageViews_[imageViewIndex])
-            imageViews_[imageViewIndex].Release();
+        if (imageViewIndex < imageViews_.size())
+            imageViews_[imageViewIndex].reset();
 
         /* Returns the standard image view */
         return textureVK.GetVkImageView();
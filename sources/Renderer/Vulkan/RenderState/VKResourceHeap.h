@@ -14,6 +14,8 @@
 #include <LLGL/Container/SmallVector.h>
 #include "VKPipelineBarrier.h"
 #include "VKPipelineLayout.h"
+#include "VKHeapDescriptorSetPool.h"
+#include "../Texture/VKTexture.h"
 #include "../Vulkan.h"
 #include "../VKPtr.h"
 #include <vector>
@@ -25,7 +27,6 @@ namespace LLGL
 
 class Buffer;
 class VKBuffer;
-class VKTexture;
 class VKDescriptorSetWriter;
 struct ResourceHeapDescriptor;
 struct ResourceViewDescriptor;
@@ -46,20 +47,16 @@ class VKResourceHeap final : public ResourceHeap
             const ArrayView<ResourceViewDescriptor>&    initialResourceViews = {}
         );
 
+        ~VKResourceHeap();
+
         std::uint32_t WriteResourceViews(
             VkDevice                                    device,
             std::uint32_t                               firstDescriptor,
             const ArrayView<ResourceViewDescriptor>&    resourceViews
         );
 
-        // Inserts a pipeline barrier command into the command buffer if this resource heap requires it.
-        void SubmitPipelineBarrier(VkCommandBuffer commandBuffer, std::uint32_t descriptorSet);
-
-        // Returns the native Vulkan descritpor pool.
-        inline VkDescriptorPool GetVkDescriptorPool() const
-        {
-            return descriptorPool_.Get();
-        }
+        // Returns the pipeline barrier for storage resources of the specified descriptor set or null if this resource heap does not require one.
+        VKPipelineBarrier* GetPipelineBarrier(std::uint32_t descriptorSet) const;
 
         // Returns the list of native Vulkan descriptor sets.
         inline const std::vector<VkDescriptorSet>& GetVkDescriptorSets() const
@@ -90,9 +87,8 @@ class VKResourceHeap final : public ResourceHeap
         void CopyLayoutBindings(const ArrayView<VKLayoutBinding>& layoutBindings);
         void CopyLayoutBinding(VKDescriptorBinding& dst, const VKLayoutBinding& src);
 
-        void CreateDescriptorPool(VkDevice device, std::uint32_t numDescriptorSets);
-
-        void CreateDescriptorSets(
+        // Allocates the descriptor sets from the shared pool of descriptor sets for resource heaps.
+        void AllocateDescriptorSets(
             VkDevice                device,
             std::uint32_t           numDescriptorSets,
             VkDescriptorSetLayout   globalSetLayout
@@ -122,8 +118,15 @@ class VKResourceHeap final : public ResourceHeap
             VKDescriptorBarrierWriter&      barrierWriter
         );
 
+        void FillWriteDescriptorWithAccelerationStructure(
+            const ResourceViewDescriptor&   desc,
+            std::uint32_t                   descriptorSet,
+            const VKDescriptorBinding&      binding,
+            VKDescriptorSetWriter&          setWriter
+        );
+
         bool ExchangeBufferBarrier(std::uint32_t descriptorSet, Buffer* resource, const VKDescriptorBinding& binding);
-        bool EmplaceBarrier(std::uint32_t descriptorSet, std::uint32_t slot, Resource* resource, VkPipelineStageFlags stageFlags);
+        bool EmplaceBarrier(std::uint32_t descriptorSet, Resource* resource, const VKDescriptorBinding& binding);
         bool RemoveBarrier(std::uint32_t descriptorSet, std::uint32_t slot);
 
         // Returns the image view for the specified texture or creates one if the texture-view is enabled.
@@ -136,16 +139,16 @@ class VKResourceHeap final : public ResourceHeap
 
     private:
 
-        VKPtr<VkDescriptorPool>             descriptorPool_;
-        std::vector<VkDescriptorSet>        descriptorSets_;
-        SmallVector<VKDescriptorBinding>    bindings_;
+        VKHeapDescriptorSetPool::LayoutPool*    layoutPool_             = nullptr;
+        std::vector<VkDescriptorSet>            descriptorSets_;
+        SmallVector<VKDescriptorBinding>        bindings_;
 
-        std::vector<VKPtr<VkImageView>>     imageViews_;
-      //std::vector<VKPtr<VkBufferView>>    bufferViews_;
-        std::uint32_t                       numImageViewsPerSet_    = 0;
-        std::uint32_t                       numBufferViewsPerSet_   = 0;
+        std::vector<VKImageViewSharedPtr>       imageViews_;
+      //std::vector<VKPtr<VkBufferView>>        bufferViews_;
+        std::uint32_t                           numImageViewsPerSet_    = 0;
+        std::uint32_t                           numBufferViewsPerSet_   = 0;
 
-        std::vector<VKPipelineBarrierPtr>   barriers_;
+        std::vector<VKPipelineBarrierPtr>       barriers_;
 
 };
 
@@ -57,7 +57,7 @@ void VKStagingDescriptorPool::Initialize(
     for_range(i, numPoolSizes)
     {
         const auto& poolSize = poolSizes[i];
-        poolCapacities_[static_cast<int>(poolSize.type)] = poolSize.descriptorCount;
+        poolCapacities_[VKPoolSizeAccumulator::GetPoolIndex(poolSize.type)] = poolSize.descriptorCount;
     }
 
     /* Create native Vulkan descriptor pool */
@@ -91,7 +91,7 @@ bool VKStagingDescriptorPool::Capacity(std::uint32_t numSizes, const VkDescripto
         return false;
     for_range(i, numSizes)
     {
-        const int typeIndex = static_cast<int>(sizes[i].type);
+        const std::uint32_t typeIndex = VKPoolSizeAccumulator::GetPoolIndex(sizes[i].type);
         if (poolSizes_[typeIndex] + sizes[i].descriptorCount > poolCapacities_[typeIndex])
             return false;
     }
@@ -108,7 +108,7 @@ VkDescriptorSet VKStagingDescriptorPool::AllocateDescriptorSet(
     /* Increase pool sizes */
     ++setSize_;
     for_range(i, numSizes)
-        poolSizes_[static_cast<int>(sizes[i].type)] += sizes[i].descriptorCount;
+        poolSizes_[VKPoolSizeAccumulator::GetPoolIndex(sizes[i].type)] += sizes[i].descriptorCount;
 
     /* Allocate single descriptor set */
     VkDescriptorSetAllocateInfo allocInfo;
@@ -6,6 +6,7 @@
  */
 
 #include "VKStagingDescriptorSetPool.h"
+#include "../Ext/VKExtensionRegistry.h"
 #include <LLGL/Utils/ForRange.h>
 #include <algorithm>
 
@@ -71,15 +72,24 @@ void VKStagingDescriptorSetPool::AllocateDescriptorPool()
     const std::uint32_t descriptorPoolSize = GetDescriptorPoolCapacity(capacityLevel_);
     const VkDescriptorPoolSize poolSizes[] =
     {
-        VkDescriptorPoolSize{ VK_DESCRIPTOR_TYPE_SAMPLER,        descriptorPoolSize },
-        VkDescriptorPoolSize{ VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE,  descriptorPoolSize },
-        VkDescriptorPoolSize{ VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,  descriptorPoolSize },
-        VkDescriptorPoolSize{ VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, descriptorPoolSize },
-        VkDescriptorPoolSize{ VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, descriptorPoolSize },
+        VkDescriptorPoolSize{ VK_DESCRIPTOR_TYPE_SAMPLER,                descriptorPoolSize },
+        VkDescriptorPoolSize{ VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE,          descriptorPoolSize },
+        VkDescriptorPoolSize{ VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,          descriptorPoolSize },
+        VkDescriptorPoolSize{ VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,         descriptorPoolSize },
+        VkDescriptorPoolSize{ VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, descriptorPoolSize },
+        VkDescriptorPoolSize{ VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,         descriptorPoolSize },
+        VkDescriptorPoolSize{ VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT,       descriptorPoolSize },
+        VkDescriptorPoolSize{ VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR, descriptorPoolSize },
     };
+
+    /* Acceleration structure descriptors (last entry) are only valid with extension VK_KHR_acceleration_structure */
+    std::uint32_t numPoolSizes = sizeof(poolSizes)/sizeof(poolSizes[0]);
+    if (!HasExtension(VKExt::KHR_acceleration_structure))
+        --numPoolSizes;
+
     const std::uint32_t setCapacity = GetDescriptorSetCapacity(capacityLevel_);
     descriptorPools_.emplace_back(device_);
-    descriptorPools_.back().Initialize(setCapacity, sizeof(poolSizes)/sizeof(poolSizes[0]), poolSizes);
+    descriptorPools_.back().Initialize(setCapacity, numPoolSizes, poolSizes);
     ++capacityLevel_;
 }
 
@@ -7,21 +7,21 @@
 
 #include "VKShader.h"
 #include "VKShaderModulePool.h"
+#include "../RenderState/VKPipelineLibraryPool.h"
 #include "../VKCore.h"
 #include "../VKTypes.h"
 #include "../../../Core/CoreUtils.h"
 #include "../../../Core/StringUtils.h"
 #include "../../../Core/ReportUtils.h"
 #include "../../PipelineStateUtils.h"
+#ifdef LLGL_ENABLE_SPIRV_REFLECT
+#   include "../../SPIRV/SpirvShaderReflection.h"
+#endif
 #include <LLGL/Utils/TypeNames.h>
 #include <LLGL/Utils/ForRange.h>
 #include <string.h>
 #include <algorithm>
 
-#ifdef LLGL_ENABLE_SPIRV_REFLECT
-#   include "../../SPIRV/SpirvReflect.h"
-#endif
-
 
 namespace LLGL
 {
@@ -49,13 +49,14 @@ VKShader::VKShader(VkDevice device, const ShaderDescriptor& desc) :
 {
     BuildShader(desc);
     BuildInputLayout(desc.vertex.inputAttribs.size(), desc.vertex.inputAttribs.data());
-    BuildBindingLayout();
+    BuildReflection();
     BuildReport();
 }
 
 VKShader::~VKShader()
 {
     VKShaderModulePool::Get().NotifyReleaseShader(this);
+    VKPipelineLibraryPool::Get().NotifyReleaseShader(this);
 }
 
 const Report* VKShader::GetReport() const
@@ -121,13 +122,15 @@ bool VKShader::NeedsShaderModulePermutation(const PermutationBindingFunc& permut
     return false;
 }
 
-VKPtr<VkShaderModule> VKShader::CreateVkShaderModulePermutation(const PermutationBindingFunc& permutationBindingFunc)
+bool VKShader::BuildBindingLayoutPermutation(
+    const PermutationBindingFunc&   permutationBindingFunc,
+    VKShaderBindingLayout&          outBindingLayout) const
 {
     if (!permutationBindingFunc)
-        return VK_NULL_HANDLE;
+        return false;
 
     /* Re-assign binding slots with a permutation of the binding layout */
-    VKShaderBindingLayout bindingLayoutPerm = bindingLayout_;
+    outBindingLayout = bindingLayout_;
 
     ConstFieldRangeIterator<BindingSlot> bindingSlotIter;
     std::uint32_t dstSet;
@@ -135,304 +138,28 @@ VKPtr<VkShaderModule> VKShader::CreateVkShaderModulePermutation(const Permutatio
 
     for (unsigned index = 0; permutationBindingFunc(index, bindingSlotIter, dstSet); ++index)
     {
-        if (bindingLayoutPerm.AssignBindingSlots(bindingSlotIter, dstSet) > 0)
+        if (outBindingLayout.AssignBindingSlots(bindingSlotIter, dstSet) > 0)
             modified = true;
     }
 
-    /* Create shader module permuation if there is at least one modified binding slot */
-    if (modified)
-    {
-        VKShaderCode shaderCodePerm = shaderCode_;
-        bindingLayoutPerm.UpdateSpirvModule(shaderCodePerm.data(), shaderCodePerm.size() * sizeof(std::uint32_t));
-        return CreateVkShaderModule(device_, shaderCodePerm);
-    }
-
-    return VK_NULL_HANDLE;
+    return modified;
 }
 
-static const char* GetOptString(const char* s)
+VKPtr<VkShaderModule> VKShader::CreateVkShaderModulePermutation(const VKShaderBindingLayout& bindingLayoutPerm) const
 {
-    return (s != nullptr ? s : "");
-}
-
-static long ShaderTypeToStageFlags(const ShaderType type)
-{
-    switch (type)
-    {
-        case ShaderType::Vertex:            return StageFlags::VertexStage;
-        case ShaderType::TessControl:       return StageFlags::TessControlStage;
-        case ShaderType::TessEvaluation:    return StageFlags::TessEvaluationStage;
-        case ShaderType::Geometry:          return StageFlags::GeometryStage;
-        case ShaderType::Fragment:          return StageFlags::FragmentStage;
-        case ShaderType::Compute:           return StageFlags::ComputeStage;
-        default:                            return 0;
-    }
+    VKShaderCode shaderCodePerm = shaderCode_;
+    bindingLayoutPerm.UpdateSpirvModule(shaderCodePerm.data(), shaderCodePerm.size() * sizeof(std::uint32_t));
+    return CreateVkShaderModule(device_, shaderCodePerm);
 }
 
 #ifdef LLGL_ENABLE_SPIRV_REFLECT
 
-static Format SpvVectorTypeToFormat(const SpirvReflect::SpvType* type, std::uint32_t count)
-{
-    if (type->opcode == spv::Op::OpTypeFloat)
-    {
-        if (type->size == 2)
-        {
-            switch (count)
-            {
-                case 1: return Format::R16Float;
-                case 2: return Format::RG16Float;
-                case 3: return Format::RGB16Float;
-                case 4: return Format::RGBA16Float;
-            }
-        }
-        else if (type->size == 4)
-        {
-            switch (count)
-            {
-                case 1: return Format::R32Float;
-                case 2: return Format::RG32Float;
-                case 3: return Format::RGB32Float;
-                case 4: return Format::RGBA32Float;
-            }
-        }
-        else if (type->size == 8)
-        {
-            switch (count)
-            {
-                case 1: return Format::R64Float;
-                case 2: return Format::RG64Float;
-                case 3: return Format::RGB64Float;
-                case 4: return Format::RGBA64Float;
-            }
-        }
-    }
-    else if (type->opcode == spv::Op::OpTypeInt)
-    {
-        if (type->sign)
-        {
-            switch (count)
-            {
-                case 1: return Format::R32SInt;
-                case 2: return Format::RG32SInt;
-                case 3: return Format::RGB32SInt;
-                case 4: return Format::RGBA32SInt;
-            }
-        }
-        else
-        {
-            switch (count)
-            {
-                case 1: return Format::R32UInt;
-                case 2: return Format::RG32UInt;
-                case 3: return Format::RGB32UInt;
-                case 4: return Format::RGBA32UInt;
-            }
-        }
-    }
-    return Format::Undefined;
-}
-
-static Format SpvTypeToFormat(const SpirvReflect::SpvType* type, std::uint32_t* count = nullptr)
-{
-    /* Return number of semantics to default value of 1 element */
-    if (count != nullptr)
-        *count = 1;
-
-    if (type != nullptr)
-    {
-        if (type->opcode == spv::Op::OpTypePointer)
-        {
-            /* Dereference pointer type */
-            return SpvTypeToFormat(type->baseType, count);
-        }
-        else if (type->opcode == spv::Op::OpTypeFloat || type->opcode == spv::Op::OpTypeInt)
-        {
-            /* Return format as scalar type */
-            return SpvVectorTypeToFormat(type, 1);
-        }
-        else if (type->opcode == spv::Op::OpTypeVector)
-        {
-            /* Return format as vector type */
-            if (type->baseType)
-                return SpvVectorTypeToFormat(type->baseType, type->elements);
-        }
-        else if (type->opcode == spv::Op::OpTypeMatrix)
-        {
-            /* Return format as vector and return number of vectors */
-            if (count != nullptr)
-                *count = type->elements;
-            return SpvTypeToFormat(type->baseType);
-        }
-    }
-
-    return Format::Undefined;
-}
-
-static SystemValue SpvBuiltinToSystemValue(spv::BuiltIn type)
-{
-    switch (type)
-    {
-        case spv::BuiltInClipDistance:      return SystemValue::ClipDistance;
-        case spv::BuiltInCullDistance:      return SystemValue::CullDistance;
-        //                                  return SystemValue::Color;
-        case spv::BuiltInFragDepth:         return SystemValue::Depth;
-        //                                  return SystemValue::DepthGreater;
-        //                                  return SystemValue::DepthLess;
-        case spv::BuiltInFrontFacing:       return SystemValue::FrontFacing;
-        case spv::BuiltInInstanceId:        return SystemValue::InstanceID;
-        case spv::BuiltInInstanceIndex:     return SystemValue::InstanceID;
-        case spv::BuiltInPosition:          return SystemValue::Position;
-        case spv::BuiltInFragCoord:         return SystemValue::Position;
-        case spv::BuiltInPrimitiveId:       return SystemValue::PrimitiveID;
-        case spv::BuiltInLayer:             return SystemValue::RenderTargetIndex;
-        case spv::BuiltInSampleMask:        return SystemValue::SampleMask;
-        case spv::BuiltInSampleId:          return SystemValue::SampleID;
-        case spv::BuiltInFragStencilRefEXT: return SystemValue::Stencil;
-        case spv::BuiltInVertexId:          return SystemValue::VertexID;
-        case spv::BuiltInVertexIndex:       return SystemValue::VertexID;
-        case spv::BuiltInViewportIndex:     return SystemValue::ViewportIndex;
-        default:                            return SystemValue::Undefined;
-    }
-}
-
-static SystemValue SpvBuiltinToFragmentOutputSV(spv::BuiltIn type)
-{
-    SystemValue sv = SpvBuiltinToSystemValue(type);
-    return (sv == SystemValue::Undefined ? SystemValue::Color : sv);
-}
-
-// Reflects the SPIR-V type to the output binding descriptor and returns the dereferenced type
-static const SpirvReflect::SpvType* ReflectSpvBinding(BindingDescriptor& binding, const SpirvReflect::SpvType* varType)
-{
-    if (varType != nullptr)
-    {
-        if (const SpirvReflect::SpvType* derefType = varType->Deref())
-        {
-            switch (derefType->opcode)
-            {
-                case spv::Op::OpTypeArray:
-                    /* Multiply array in case of multiple interleaved arrays, e.g. MultiArray[4][3] is equivalent to LinearArray[4*3] */
-                    binding.arraySize = (derefType->elements == 0 ? derefType->elements : binding.arraySize * derefType->elements);
-                    return ReflectSpvBinding(binding, derefType->baseType);
-
-                case spv::Op::OpTypeImage:
-                    binding.type       = ResourceType::Texture;
-                    binding.bindFlags  |= BindFlags::Sampled;
-                    return derefType;
-
-                case spv::Op::OpTypeSampler:
-                    binding.type       = ResourceType::Sampler;
-                    return derefType;
-
-                case spv::Op::OpTypeSampledImage:
-                    binding.type       = ResourceType::Texture;
-                    binding.bindFlags  |= (BindFlags::Sampled | BindFlags::CombinedSampler);
-                    return derefType;
-
-                case spv::Op::OpTypeStruct:
-                    binding.type       = ResourceType::Buffer;
-                    binding.bindFlags  |= BindFlags::ConstantBuffer;
-                    return derefType;
-
-                default:
-                    break;
-            }
-        }
-    }
-    return nullptr;
-}
-
-static ShaderResourceReflection* FindOrAppendShaderResource(ShaderReflection& reflection, const SpirvReflect::SpvUniform& var)
-{
-    /* Check if there already is a resource at the specified binding slot */
-    for (ShaderResourceReflection& resource : reflection.resources)
-    {
-        if (resource.binding.slot == BindingSlot{ var.binding, var.set })
-            return &resource;
-    }
-
-    /* Append new resource entry */
-    ShaderResourceReflection resource;
-    {
-        resource.binding.name = GetOptString(var.name);
-        resource.binding.slot = var.binding;
-
-        if (const SpirvReflect::SpvType* varType = var.type)
-        {
-            //if (varType->opcode == spv::Op::OpTypeArray)
-            //    resource.binding.arraySize = varType->elements;
-
-            if (varType->storage == spv::StorageClassUniform ||
-                varType->storage == spv::StorageClassUniformConstant)
-            {
-                if (const SpirvReflect::SpvType* derefType = ReflectSpvBinding(resource.binding, varType))
-                {
-                    if (derefType->opcode == spv::Op::OpTypeStruct)
-                        resource.constantBufferSize = var.size;
-                }
-            }
-        }
-    }
-    reflection.resources.push_back(resource);
-
-    return &(reflection.resources.back());
-}
-
 bool VKShader::Reflect(ShaderReflection& reflection) const
 {
-    /* Parse shader module */
-    SpirvReflect spvReflect;
-    if (spvReflect.Reflect(SpirvModuleView{ shaderCode_ }) != SpirvResult::NoError)
+    if (reflectionResult_ != SpirvResult::NoError)
         return false;
 
-    /* Gather input/output attributes */
-    for (const auto& it : spvReflect.GetVaryings())
-    {
-        const SpirvReflect::SpvVarying& var = it.second;
-        if (GetType() == ShaderType::Vertex)
-        {
-            std::uint32_t numVectors = 1;
-
-            /* Determine vertex attribute data */
-            VertexAttribute attrib;
-            {
-                attrib.name         = GetOptString(var.name);
-                attrib.format       = SpvTypeToFormat(var.type, &numVectors);
-                attrib.location     = var.location;
-                attrib.systemValue  = SpvBuiltinToSystemValue(var.builtin);
-            }
-
-            /* Append vertex attributes for each semantic index */
-            for_range(i, numVectors)
-            {
-                attrib.semanticIndex = i;
-                if (var.input)
-                    reflection.vertex.inputAttribs.push_back(attrib);
-                else
-                    reflection.vertex.outputAttribs.push_back(attrib);
-            }
-        }
-        else if (GetType() == ShaderType::Fragment && !var.input)
-        {
-            /* Determine and append fragment attribute data */
-            FragmentAttribute attrib;
-            {
-                attrib.name         = GetOptString(var.name);
-                attrib.format       = SpvTypeToFormat(var.type);
-                attrib.location     = var.location;
-                attrib.systemValue  = SpvBuiltinToFragmentOutputSV(var.builtin);
-            }
-            reflection.fragment.outputAttribs.push_back(attrib);
-        }
-    }
-
-    /* Gather shader resources */
-    for (const auto& it : spvReflect.GetUniforms())
-    {
-        const SpirvReflect::SpvUniform& var = it.second;
-        if (ShaderResourceReflection* resource = FindOrAppendShaderResource(reflection, var))
-            resource->binding.stageFlags |= ShaderTypeToStageFlags(GetType());
-    }
+    BuildSpirvShaderReflection(reflection_, GetType(), reflection);
 
     /* Gather push constants */
     //TODO
@@ -442,14 +169,11 @@ bool VKShader::Reflect(ShaderReflection& reflection) const
 
 bool VKShader::ReflectLocalSize(Extent3D& outLocalSize) const
 {
-    if (GetType() != ShaderType::Compute)
+    if (GetType() != ShaderType::Compute || reflectionResult_ != SpirvResult::NoError)
         return false;
 
-    /* Parse shader module for execution mode */
-    SpirvReflect::SpvExecutionMode executionMode;
-    SpirvReflectExecutionMode(SpirvModuleView{ shaderCode_ }, executionMode);
-
     /* Return local work group size */
+    const SpirvReflect::SpvExecutionMode& executionMode = reflection_.GetExecutionMode();
     outLocalSize.width  = executionMode.localSizeX;
     outLocalSize.height = executionMode.localSizeY;
     outLocalSize.depth  = executionMode.localSizeZ;
@@ -464,13 +188,12 @@ bool VKShader::ReflectPushConstants(
     /* Initialize output container with zero-ranges */
     outUniformRanges.resize(inUniformDescs.size());
 
-    /* Parse shader module for push-constants */
-    SpirvReflect::SpvBlock block;
-    SpirvResult result = SpirvReflectPushConstants(SpirvModuleView{ shaderCode_ }, block);
-    if (result != SpirvResult::NoError)
+    if (reflectionResult_ != SpirvResult::NoError)
         return false;
 
-    /* Build push constant ranges */
+    /* Build push constant ranges from reflected push-constant block */
+    const SpirvReflect::SpvBlock& block = reflection_.GetPushConstants();
+
     for_range(i, inUniformDescs.size())
     {
         /* Find name of uniform descriptor in push-constant block fields */
@@ -492,6 +215,70 @@ bool VKShader::ReflectPushConstants(
     return true;
 }
 
+// Returns the index of the field with the specified name or -1 if there is no such field.
+static int FindBlockField(const SpirvReflect::SpvBlock& block, const char* name)
+{
+    for_range(i, block.fields.size())
+    {
+        if (block.fields[i].name != nullptr && ::strcmp(block.fields[i].name, name) == 0)
+            return static_cast<int>(i);
+    }
+    return -1;
+}
+
+bool VKShader::ReflectUniformBlock(
+    const ArrayView<UniformDescriptor>& inUniformDescs,
+    std::vector<VKUniformRange>&        outUniformRanges,
+    VKUniformBlockBinding&              outBlockBinding) const
+{
+    /* Initialize output container with zero-ranges */
+    outUniformRanges.clear();
+    outUniformRanges.resize(inUniformDescs.size(), VKUniformRange{ 0, 0 });
+
+    if (reflectionResult_ != SpirvResult::NoError || inUniformDescs.empty())
+        return false;
+
+    /* Find first uniform buffer whose block contains any of the specified uniforms */
+    SpirvReflect::SpvBlock block;
+
+    for (const SpirvReflect::SpvUniform& uniform : reflection_.GetUniforms())
+    {
+        if (uniform.type == nullptr || uniform.type->storage != spv::StorageClassUniform)
+            continue;
+        if (!reflection_.ReflectUniformBlock(uniform, block))
+            continue;
+
+        bool hasAnyUniform = false;
+        std::uint32_t blockSize = uniform.size;
+
+        for_range(i, inUniformDescs.size())
+        {
+            const UniformDescriptor& uniformDesc = inUniformDescs[i];
+            const int fieldIndex = FindBlockField(block, uniformDesc.name.c_str());
+            if (fieldIndex >= 0)
+            {
+                VKUniformRange& range = outUniformRanges[i];
+                {
+                    range.offset    = block.fields[fieldIndex].offset;
+                    range.size      = GetUniformTypeSize(uniformDesc.type, uniformDesc.arraySize);
+                }
+                blockSize = std::max(blockSize, range.offset + range.size);
+                hasAnyUniform = true;
+            }
+        }
+
+        if (hasAnyUniform)
+        {
+            outBlockBinding.set     = uniform.set;
+            outBlockBinding.binding = uniform.binding;
+            outBlockBinding.size    = blockSize;
+            return true;
+        }
+    }
+
+    return false;
+}
+
 #else // LLGL_ENABLE_SPIRV_REFLECT
 
 bool VKShader::Reflect(ShaderReflection& /*reflection*/) const
@@ -511,6 +298,14 @@ bool VKShader::ReflectPushConstants(
     return false; // dummy
 }
 
+bool VKShader::ReflectUniformBlock(
+    const ArrayView<UniformDescriptor>& inUniformDescs,
+    std::vector<VKUniformRange>&        outUniformRanges,
+    VKUniformBlockBinding&              outBlockBinding) const
+{
+    return false; // dummy
+}
+
 #endif // /LLGL_ENABLE_SPIRV_REFLECT
 
 
@@ -580,9 +375,14 @@ void VKShader::BuildInputLayout(std::size_t numVertexAttribs, const VertexAttrib
     inputLayout_.bindingDescs.insert(inputLayout_.bindingDescs.end(), bindingDescSet.begin(), bindingDescSet.end());
 }
 
-void VKShader::BuildBindingLayout()
+void VKShader::BuildReflection()
 {
-    bindingLayout_.BuildFromSpirvModule(shaderCode_.data(), shaderCode_.size() * sizeof(std::uint32_t));
+    #ifdef LLGL_ENABLE_SPIRV_REFLECT
+    /* Reflect shader module only once; binding layout, permutations, and all reflection queries share the result */
+    reflectionResult_ = reflection_.Reflect(SpirvModuleView{ shaderCode_ });
+    if (reflectionResult_ == SpirvResult::NoError)
+        bindingLayout_.BuildFromSpirvReflect(reflection_);
+    #endif
 }
 
 void VKShader::BuildReport()
@@ -611,16 +411,16 @@ bool VKShader::CompileSource(const ShaderDescriptor& shaderDesc)
 bool VKShader::LoadBinary(const ShaderDescriptor& shaderDesc)
 {
     /* Get shader binary */
-    std::vector<char>   fileContent;
+    Blob                fileContent;
     const char*         binaryBuffer = nullptr;
     std::size_t         binaryLength = 0;
 
     if (shaderDesc.sourceType == ShaderSourceType::BinaryFile)
     {
-        /* Load binary from file */
-        fileContent = ReadFileBuffer(shaderDesc.source);
-        binaryBuffer = fileContent.data();
-        binaryLength = fileContent.size();
+        /* Map binary from file */
+        fileContent = ReadFileMapped(shaderDesc.source);
+        binaryBuffer = static_cast<const char*>(fileContent.GetData());
+        binaryLength = fileContent.GetSize();
     }
     else
     {
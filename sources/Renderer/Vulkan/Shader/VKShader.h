@@ -17,6 +17,10 @@
 #include <vector>
 #include <functional>
 
+#ifdef LLGL_ENABLE_SPIRV_REFLECT
+#   include "../../SPIRV/SpirvReflect.h"
+#endif
+
 
 namespace LLGL
 {
@@ -34,6 +38,14 @@ struct VKUniformRange
     std::uint32_t size;
 };
 
+// Binding point and size of a uniform block that holds uniforms outside of the push-constant block.
+struct VKUniformBlockBinding
+{
+    std::uint32_t set;
+    std::uint32_t binding;
+    std::uint32_t size;
+};
+
 class VKShader final : public Shader
 {
 
@@ -62,21 +74,41 @@ class VKShader final : public Shader
             std::vector<VKUniformRange>&        outUniformRanges
         ) const;
 
+        /*
+        Reflects the uniform block that holds the specified uniforms and returns their byte ranges within that block.
+        This is used for uniforms that are not part of the push-constant block, e.g. when they exceed the device limit for push constants.
+        Only the first uniform block that contains any of the uniforms is reflected. Returns false if there is no such uniform block.
+        */
+        bool ReflectUniformBlock(
+            const ArrayView<UniformDescriptor>& inUniformDescs,
+            std::vector<VKUniformRange>&        outUniformRanges,
+            VKUniformBlockBinding&              outBlockBinding
+        ) const;
+
         void FillShaderStageCreateInfo(VkPipelineShaderStageCreateInfo& createInfo) const;
         void FillVertexInputStateCreateInfo(VkPipelineVertexInputStateCreateInfo& createInfo) const;
 
         /*
         Returns true if a shader permutation is needed for the specified binding functor.
-        Call this before 'CreateVkShaderModulePermutation' to determine whether a permutation is necessary.
+        Call this before 'BuildBindingLayoutPermutation' to determine whether a permutation is necessary.
         */
         bool NeedsShaderModulePermutation(const PermutationBindingFunc& permutationBindingFunc) const;
 
         /*
-        Creates a shader module permutation with re-assigned binding slots using the specified function callback.
+        Builds a permutation of the binding layout with re-assigned binding slots using the specified function callback.
         Re-assigned descriptor sets for [0, N) invocations of the callback until 'permutationBindingFunc' returns false.
-        Returns VK_NULL_HANDLE if no permutation was created. Should only be used by VKPipelineLayout.
+        Returns false if no binding slot was modified, in which case no shader module permutation is needed.
+        */
+        bool BuildBindingLayoutPermutation(
+            const PermutationBindingFunc&   permutationBindingFunc,
+            VKShaderBindingLayout&          outBindingLayout
+        ) const;
+
+        /*
+        Creates a shader module permutation with the binding slots of the specified binding layout.
+        The binding layout must have been built with 'BuildBindingLayoutPermutation'. Should only be used by VKShaderModulePool.
         */
-        VKPtr<VkShaderModule> CreateVkShaderModulePermutation(const PermutationBindingFunc& permutationBindingFunc);
+        VKPtr<VkShaderModule> CreateVkShaderModulePermutation(const VKShaderBindingLayout& bindingLayoutPerm) const;
 
         // Returns the Vulkan shader module.
         inline const VKPtr<VkShaderModule>& GetShaderModule() const
@@ -99,7 +131,7 @@ class VKShader final : public Shader
 
         bool BuildShader(const ShaderDescriptor& shaderDesc);
         void BuildInputLayout(std::size_t numVertexAttribs, const VertexAttribute* vertexAttribs);
-        void BuildBindingLayout();
+        void BuildReflection();
         void BuildReport();
 
         bool CompileSource(const ShaderDescriptor& shaderDesc);
@@ -121,6 +153,11 @@ class VKShader final : public Shader
         VKShaderCode            shaderCode_;
         VKShaderBindingLayout   bindingLayout_;
 
+        #ifdef LLGL_ENABLE_SPIRV_REFLECT
+        SpirvReflect            reflection_;                                    // Reflection of 'shaderCode_' which is built once and shared by all reflection queries.
+        SpirvResult             reflectionResult_   = SpirvResult::InvalidModule;
+        #endif
+
         LoadBinaryResult        loadBinaryResult_   = LoadBinaryResult::Undefined;
         VertexInputLayout       inputLayout_;
 
@@ -14,7 +14,6 @@
 
 #ifdef LLGL_ENABLE_SPIRV_REFLECT
 #   include "../../SPIRV/SpirvReflect.h"
-#   include "../../SPIRV/SpirvModule.h"
 #endif
 
 
@@ -22,31 +21,30 @@ namespace LLGL
 {
 
 
-bool VKShaderBindingLayout::BuildFromSpirvModule(const void* data, std::size_t size)
+bool VKShaderBindingLayout::BuildFromSpirvReflect(const SpirvReflect& reflection)
 {
     #ifdef LLGL_ENABLE_SPIRV_REFLECT
 
-    /* Reflect all SPIR-V binding points */
-    std::vector<SpirvReflect::SpvBindingPoint> bindingPoints;
-    SpirvResult result = SpirvReflectBindingPoints(SpirvModuleView{ data, size }, bindingPoints);
-    if (result != SpirvResult::NoError)
-        return false;
-
-    /* Convert binding points into to module bindings */
-    bindings_.resize(bindingPoints.size());
+    /* Convert all uniforms with binding or descriptor set decorations into module bindings */
+    bindings_.clear();
+    bindings_.reserve(reflection.GetUniforms().size());
 
-    auto ConvertBindingPoint = [](ModuleBinding& dst, const SpirvReflect::SpvBindingPoint& src)
+    for (const SpirvReflect::SpvUniform& uniform : reflection.GetUniforms())
     {
-        dst.srcDescriptorSet    = src.set;
-        dst.srcBinding          = src.binding;
-        dst.dstDescriptorSet    = src.set;
-        dst.dstBinding          = src.binding;
-        dst.spirvDescriptorSet  = src.setWordOffset;
-        dst.spirvBinding        = src.bindingWordOffset;
-    };
+        if (uniform.setWordOffset == 0 && uniform.bindingWordOffset == 0)
+            continue;
 
-    for_range(i, bindingPoints.size())
-        ConvertBindingPoint(bindings_[i], bindingPoints[i]);
+        ModuleBinding dst;
+        {
+            dst.srcDescriptorSet    = uniform.set;
+            dst.srcBinding          = uniform.binding;
+            dst.dstDescriptorSet    = uniform.set;
+            dst.dstBinding          = uniform.binding;
+            dst.spirvDescriptorSet  = uniform.setWordOffset;
+            dst.spirvBinding        = uniform.bindingWordOffset;
+        }
+        bindings_.push_back(dst);
+    }
 
     /* Sort module bindings by descriptor set and binding points */
     std::sort(
@@ -173,20 +171,32 @@ std::uint32_t VKShaderBindingLayout::AssignBindingSlots(
     return numBindings;
 }
 
-void VKShaderBindingLayout::UpdateSpirvModule(void* data, std::size_t size)
+void VKShaderBindingLayout::UpdateSpirvModule(void* data, std::size_t size) const
 {
     auto* words = reinterpret_cast<std::uint32_t*>(data);
     const std::size_t numWords = size/4;
 
+    /* Word offset 0 denotes a missing decoration, since the first words of a module are always its header */
     for (const ModuleBinding& binding : bindings_)
     {
-        if (binding.spirvDescriptorSet < numWords)
+        if (binding.spirvDescriptorSet > 0 && binding.spirvDescriptorSet < numWords)
             words[binding.spirvDescriptorSet] = binding.dstDescriptorSet;
-        if (binding.spirvBinding < numWords)
+        if (binding.spirvBinding > 0 && binding.spirvBinding < numWords)
             words[binding.spirvBinding] = binding.dstBinding;
     }
 }
 
+int VKShaderBindingLayout::CompareSWO(const VKShaderBindingLayout& lhs, const VKShaderBindingLayout& rhs)
+{
+    LLGL_COMPARE_MEMBER_SWO(bindings_.size());
+    for_range(i, lhs.bindings_.size())
+    {
+        LLGL_COMPARE_MEMBER_SWO(bindings_[i].dstDescriptorSet);
+        LLGL_COMPARE_MEMBER_SWO(bindings_[i].dstBinding      );
+    }
+    return 0;
+}
+
 
 } // /namespace LLGL
 
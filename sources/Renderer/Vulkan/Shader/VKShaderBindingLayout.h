@@ -19,13 +19,15 @@ namespace LLGL
 {
 
 
+class SpirvReflect;
+
 class VKShaderBindingLayout
 {
 
     public:
 
-        // Builds the internal binding table from the specified SPIR-V module.
-        bool BuildFromSpirvModule(const void* data, std::size_t size);
+        // Builds the internal binding table from the specified SPIR-V module reflection.
+        bool BuildFromSpirvReflect(const SpirvReflect& reflection);
 
         // Returns true if the binding layout already matches the layout as is assigned by 'AssignBindingSlots'.
         bool MatchesBindingSlots(
@@ -49,7 +51,13 @@ class VKShaderBindingLayout
         Writes the updated resource bindings to the specified SPIR-V module.
         This SPIR-V module must be identical to the one used when the layout was built, except for the binding values.
         */
-        void UpdateSpirvModule(void* data, std::size_t size);
+        void UpdateSpirvModule(void* data, std::size_t size) const;
+
+        /*
+        Compares the re-assigned binding slots of the two binding layouts in a strict-weak-order (SWO).
+        Both layouts must have been built from the same SPIR-V module.
+        */
+        static int CompareSWO(const VKShaderBindingLayout& lhs, const VKShaderBindingLayout& rhs);
 
     private:
 
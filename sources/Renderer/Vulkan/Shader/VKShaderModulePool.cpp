@@ -23,24 +23,35 @@ VKShaderModulePool& VKShaderModulePool::Get()
 
 void VKShaderModulePool::Clear()
 {
-    permutations_.clear();
+    for (Shard& shard : shards_)
+    {
+        std::lock_guard<std::mutex> guard{ shard.mutex };
+        shard.permutations.clear();
+    }
 }
 
-VkShaderModule VKShaderModulePool::GetOrCreateVkShaderModulePermutation(VKShader& shader, const VKPipelineLayout& pipelineLayout)
+VkShaderModule VKShaderModulePool::GetOrCreateVkShaderModulePermutation(const VKShader& shader, const VKPipelineLayout& pipelineLayout)
 {
-    /* Try to find existing pair of shader/pipeline-layout */
+    /* Build binding layout permutation outside the lock; it only depends on the immutable shader and pipeline layout */
+    VKShaderBindingLayout bindingLayoutPerm;
+    if (!pipelineLayout.BuildShaderBindingLayoutPermutation(shader, bindingLayoutPerm))
+        return VK_NULL_HANDLE;
+
     const auto* shaderPtr = &shader;
     const auto* pipelineLayoutPtr = &pipelineLayout;
 
+    Shard& shard = GetShard(shaderPtr);
+    std::lock_guard<std::mutex> guard{ shard.mutex };
+
+    /* Try to find existing permutation with the same shader and binding slots */
     std::size_t insertionPos = 0;
     auto* permutation = FindInSortedArray<ShaderModulePermutation>(
-        permutations_.data(),
-        permutations_.size(),
-        [shaderPtr, pipelineLayoutPtr](const ShaderModulePermutation& entry) -> int
+        shard.permutations.data(),
+        shard.permutations.size(),
+        [shaderPtr, &bindingLayoutPerm](const ShaderModulePermutation& entry) -> int
         {
-            LLGL_COMPARE_SEPARATE_MEMBERS_SWO(pipelineLayoutPtr, entry.pipelineLayout);
             LLGL_COMPARE_SEPARATE_MEMBERS_SWO(shaderPtr, entry.shader);
-            return 0;
+            return VKShaderBindingLayout::CompareSWO(bindingLayoutPerm, entry.bindingLayout);
         },
         &insertionPos
     );
@@ -48,30 +59,38 @@ VkShaderModule VKShaderModulePool::GetOrCreateVkShaderModulePermutation(VKShader
     if (permutation == nullptr)
     {
         /* Create new shader module permutation */
-        VKPtr<VkShaderModule> shaderModule = pipelineLayout.CreateVkShaderModulePermutation(shader);
+        VKPtr<VkShaderModule> shaderModule = shader.CreateVkShaderModulePermutation(bindingLayoutPerm);
         VkShaderModule nativeHandle = shaderModule.Get();
 
         if (nativeHandle != VK_NULL_HANDLE)
         {
             ShaderModulePermutation newPermutation;
             {
-                newPermutation.pipelineLayout   = pipelineLayoutPtr;
                 newPermutation.shader           = shaderPtr;
+                newPermutation.bindingLayout    = std::move(bindingLayoutPerm);
                 newPermutation.shaderModule     = std::move(shaderModule);
+                newPermutation.pipelineLayouts.push_back(pipelineLayoutPtr);
             }
-            permutations_.insert(permutations_.begin() + insertionPos, std::move(newPermutation));
+            shard.permutations.insert(shard.permutations.begin() + insertionPos, std::move(newPermutation));
         }
         return nativeHandle;
     }
 
+    /* Share existing permutation with this pipeline layout */
+    if (!Contains(permutation->pipelineLayouts, pipelineLayoutPtr))
+        permutation->pipelineLayouts.push_back(pipelineLayoutPtr);
+
     return permutation->shaderModule.Get();
 }
 
 void VKShaderModulePool::NotifyReleaseShader(VKShader* shader)
 {
-    /* Since shader is the second key, we have to iterate over the entire list */
-    RemoveAllFromListIf(
-        permutations_,
+    Shard& shard = GetShard(shader);
+    std::lock_guard<std::mutex> guard{ shard.mutex };
+
+    /* Since shader is the first key, we can search for the first occurance and then delete all consecutive entries that match the key */
+    RemoveAllConsecutiveFromListIf(
+        shard.permutations,
         [shader](const ShaderModulePermutation& entry) -> bool
         {
             return (entry.shader == shader);
@@ -81,14 +100,35 @@ void VKShaderModulePool::NotifyReleaseShader(VKShader* shader)
 
 void VKShaderModulePool::NotifyReleasePipelineLayout(VKPipelineLayout* pipelineLayout)
 {
-    /* Since pipeline layout is the first key, we can search for the first occurance and then delete all consecutive entries that match the key */
-    RemoveAllConsecutiveFromListIf(
-        permutations_,
-        [pipelineLayout](const ShaderModulePermutation& entry) -> bool
-        {
-            return (entry.pipelineLayout == pipelineLayout);
-        }
-    );
+    /* Pipeline layouts are shared across shaders, so all shards must be visited */
+    for (Shard& shard : shards_)
+    {
+        std::lock_guard<std::mutex> guard{ shard.mutex };
+
+        /* Release pipeline layout from all permutations and delete those that are no longer shared with any pipeline layout */
+        for (ShaderModulePermutation& entry : shard.permutations)
+            RemoveFromList(entry.pipelineLayouts, pipelineLayout);
+
+        RemoveAllFromListIf(
+            shard.permutations,
+            [](const ShaderModulePermutation& entry) -> bool
+            {
+                return entry.pipelineLayouts.empty();
+            }
+        );
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+VKShaderModulePool::Shard& VKShaderModulePool::GetShard(const VKShader* shader)
+{
+    /* Discard the lower bits of the address, since they are always zero due to the object alignment */
+    const std::uintptr_t addr = reinterpret_cast<std::uintptr_t>(shader);
+    return shards_[(addr >> 4) % numShards];
 }
 
 
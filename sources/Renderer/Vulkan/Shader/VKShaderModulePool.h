@@ -11,7 +11,9 @@
 
 #include "../Vulkan.h"
 #include "../VKPtr.h"
+#include "VKShaderBindingLayout.h"
 #include <vector>
+#include <mutex>
 
 
 namespace LLGL
@@ -21,7 +23,11 @@ namespace LLGL
 class VKShader;
 class VKPipelineLayout;
 
-// Singleton pool for Vulkan shader/pipeline-layout permutations.
+/*
+Singleton pool for Vulkan shader module permutations. Access is synchronized since PSOs can be compiled on worker threads.
+Permutations are keyed by their shader and re-assigned binding slots, so pipeline layouts with the same binding table share the same shader module.
+The permutations are distributed over several shards by their shader, so threads that create PSOs with different shaders don't contend for the same lock.
+*/
 class VKShaderModulePool
 {
 
@@ -36,9 +42,10 @@ class VKShaderModulePool
         // Clear all resource containers of this pool (used by VKRenderSystem).
         void Clear();
 
-        /* ----- Depth-stencil states ----- */
+        /* ----- Shader module permutations ----- */
 
-        VkShaderModule GetOrCreateVkShaderModulePermutation(VKShader& shader, const VKPipelineLayout& pipelineLayout);
+        // Returns the shader module permutation of the specified shader for the binding table of the specified pipeline layout.
+        VkShaderModule GetOrCreateVkShaderModulePermutation(const VKShader& shader, const VKPipelineLayout& pipelineLayout);
 
         void NotifyReleaseShader(VKShader* shader);
         void NotifyReleasePipelineLayout(VKPipelineLayout* pipelineLayout);
@@ -47,18 +54,30 @@ class VKShaderModulePool
 
         struct ShaderModulePermutation
         {
-            const VKPipelineLayout* pipelineLayout  = nullptr;
-            const VKShader*         shader          = nullptr;
-            VKPtr<VkShaderModule>   shaderModule;
+            const VKShader*                         shader          = nullptr;
+            VKShaderBindingLayout                   bindingLayout;              // Binding layout with re-assigned binding slots.
+            std::vector<const VKPipelineLayout*>    pipelineLayouts;            // Pipeline layouts that share this permutation.
+            VKPtr<VkShaderModule>                   shaderModule;
+        };
+
+        struct Shard
+        {
+            std::vector<ShaderModulePermutation>    permutations;   // Sorted by shader and binding layout.
+            std::mutex                              mutex;
         };
 
+        static constexpr std::size_t numShards = 16;
+
     private:
 
         VKShaderModulePool() = default;
 
+        // Returns the shard that holds all permutations of the specified shader.
+        Shard& GetShard(const VKShader* shader);
+
     private:
 
-        std::vector<ShaderModulePermutation> permutations_;
+        Shard shards_[numShards];
 
 };
 
@@ -29,7 +29,7 @@ void VKColorBuffer::Create(
         format,
         VK_IMAGE_ASPECT_COLOR_BIT,
         sampleCountBits,
-        VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT
+        VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT
     );
 }
 
@@ -23,20 +23,20 @@ VKDeviceImage::VKDeviceImage(VkDevice device) :
 {
 }
 
-void VKDeviceImage::AllocateMemoryRegion(VKDeviceMemoryManager& deviceMemoryMngr)
+void VKDeviceImage::AllocateMemoryRegion(VKDeviceMemoryManager& deviceMemoryMngr, bool lazilyAllocated)
 {
     VkDevice device = deviceMemoryMngr.GetVkDevice();
 
     /* Get memory requirements for the image */
     vkGetImageMemoryRequirements(device, image_, &memoryRequirements_);
 
+    /* Use lazily allocated memory for transient attachments, so tile-based GPUs can keep their content in tile memory only */
+    VkMemoryPropertyFlags properties = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    if (lazilyAllocated && deviceMemoryMngr.HasMemoryType(memoryRequirements_.memoryTypeBits, properties | VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT))
+        properties |= VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT;
+
     /* Allocate device memory */
-    memoryRegion_ = deviceMemoryMngr.Allocate(
-        memoryRequirements_.size,
-        memoryRequirements_.alignment,
-        memoryRequirements_.memoryTypeBits,
-        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
-    );
+    memoryRegion_ = deviceMemoryMngr.AllocateImage(image_, memoryRequirements_, properties);
 
     /* Bind image to device memory region */
     if (memoryRegion_ == nullptr)
@@ -37,7 +37,8 @@ class VKDeviceImage
         VKDeviceImage(VKDeviceImage&&) = default;
         VKDeviceImage& operator = (VKDeviceImage&&) = default;
 
-        void AllocateMemoryRegion(VKDeviceMemoryManager& deviceMemoryMngr);
+        // Allocates device memory for this image. Lazily allocated memory is preferred for transient attachments if the device supports it.
+        void AllocateMemoryRegion(VKDeviceMemoryManager& deviceMemoryMngr, bool lazilyAllocated = false);
         void ReleaseMemoryRegion(VKDeviceMemoryManager& deviceMemoryMngr);
 
         void BindMemoryRegion(VkDevice device, VKDeviceMemoryRegion* memoryRegion);
@@ -84,6 +85,12 @@ class VKDeviceImage
             return layout_;
         }
 
+        // Sets the VkImageLayout state of this image after it was transitioned outside of a command context, e.g. by a queue family ownership transfer.
+        inline void SetVkImageLayout(VkImageLayout layout)
+        {
+            layout_ = layout;
+        }
+
         // Returns the region of the hardware device memory.
         inline VKDeviceMemoryRegion* GetMemoryRegion() const
         {
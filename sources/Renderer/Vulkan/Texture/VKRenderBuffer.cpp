@@ -54,8 +54,8 @@ void VKRenderBuffer::Create(
         /*usageFlags:*/         usageFlags
     );
 
-    /* Allocate device memory region */
-    AllocateMemoryRegion(deviceMemoryMngr);
+    /* Allocate device memory region; transient attachments can reside in lazily allocated memory */
+    AllocateMemoryRegion(deviceMemoryMngr, /*lazilyAllocated:*/ ((usageFlags & VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT) != 0));
 
     /* Create depth-stencil image view */
     VkImageSubresourceRange subresourceRange;
@@ -7,6 +7,7 @@
 
 #include "VKRenderTarget.h"
 #include "VKTexture.h"
+#include "VKImageUtils.h"
 #include "../Memory/VKDeviceMemoryManager.h"
 #include "../../CheckedCast.h"
 #include "../../RenderTargetUtils.h"
@@ -25,15 +26,17 @@ namespace LLGL
 VKRenderTarget::VKRenderTarget(
     VkDevice                        device,
     VKDeviceMemoryManager&          deviceMemoryMngr,
-    const RenderTargetDescriptor&   desc)
+    const RenderTargetDescriptor&   desc,
+    bool                            dynamicRendering)
 :
     resolution_          { desc.resolution                            },
     framebuffer_         { device, vkDestroyFramebuffer               },
-    defaultRenderPass_   { device                                     },
+    defaultRenderPass_   { device, dynamicRendering                   },
     secondaryRenderPass_ { device                                     },
     depthStencilBuffer_  { device                                     },
     numColorAttachments_ { NumActiveColorAttachments(desc)            },
-    sampleCountBits_     { VKTypes::ToVkSampleCountBits(desc.samples) }
+    sampleCountBits_     { VKTypes::ToVkSampleCountBits(desc.samples) },
+    dynamicRendering_    { dynamicRendering                           }
 {
     if (desc.renderPass)
     {
@@ -46,7 +49,9 @@ VKRenderTarget::VKRenderTarget(
         CreateDefaultRenderPass(device, desc);
         renderPass_ = (&defaultRenderPass_);
     }
-    CreateSecondaryRenderPass(device, desc);
+    /* Dynamic rendering resumes with the load operation directly, so no secondary render pass is required */
+    if (!dynamicRendering_)
+        CreateSecondaryRenderPass(device, desc);
     CreateFramebuffer(device, deviceMemoryMngr, desc);
 }
 
@@ -307,6 +312,13 @@ void VKRenderTarget::CreateFramebuffer(
         }
     }
 
+    /* Dynamic rendering binds the image views directly instead of a framebuffer object */
+    if (dynamicRendering_)
+    {
+        InitDynamicRenderingAttachments(desc, attachmentImageViews, numTargetAttachments);
+        return;
+    }
+
     /* Create framebuffer object */
     const Extent2D resolution = GetResolution();
     VkFramebufferCreateInfo createInfo;
@@ -325,6 +337,112 @@ void VKRenderTarget::CreateFramebuffer(
     VKThrowIfFailed(result, "failed to create Vulkan framebuffer");
 }
 
+static void InitDynamicRenderingImage(
+    VKDynamicRenderingImage&    dst,
+    VkImage                     image,
+    VkImageView                 imageView,
+    VkFormat                    format,
+    std::uint32_t               mipLevel,
+    std::uint32_t               arrayLayer,
+    VkImageLayout               restingLayout)
+{
+    dst.image                           = image;
+    dst.imageView                       = imageView;
+    dst.subresource.aspectMask          = VKImageUtils::GetInclusiveVkImageAspect(format);
+    dst.subresource.baseMipLevel        = mipLevel;
+    dst.subresource.levelCount          = 1;
+    dst.subresource.baseArrayLayer      = arrayLayer;
+    dst.subresource.layerCount          = 1;
+    dst.restingLayout                   = restingLayout;
+}
+
+static void InitDynamicRenderingAttachmentImage(
+    VKDynamicRenderingImage&    dst,
+    const AttachmentDescriptor& attachmentDesc,
+    VkImageView                 imageView,
+    long                        bindFlags)
+{
+    auto* textureVK = LLGL_CAST(VKTexture*, attachmentDesc.texture);
+    const VkFormat format = VKTypes::Map(GetAttachmentFormat(attachmentDesc));
+    InitDynamicRenderingImage(
+        dst,
+        textureVK->GetVkImage(),
+        imageView,
+        format,
+        attachmentDesc.mipLevel,
+        attachmentDesc.arrayLayer,
+        GetFinalLayoutForAttachment(format, bindFlags)
+    );
+}
+
+void VKRenderTarget::InitDynamicRenderingAttachments(
+    const RenderTargetDescriptor&   desc,
+    const VkImageView*              attachmentImageViews,
+    std::uint32_t                   numTargetAttachments)
+{
+    dynamicRenderingAttachments_.numColorAttachments    = numColorAttachments_;
+    dynamicRenderingAttachments_.extent                 = GetVkExtent();
+
+    /* Initialize color attachments; internal color buffers are only used as attachments, so they can rest in attachment layout */
+    std::size_t colorBufferIndex = 0;
+    for_range(i, numColorAttachments_)
+    {
+        const AttachmentDescriptor& colorAttachment = desc.colorAttachments[i];
+        if (Texture* texture = colorAttachment.texture)
+            InitDynamicRenderingAttachmentImage(dynamicRenderingAttachments_.colorAttachments[i], colorAttachment, attachmentImageViews[i], texture->GetBindFlags());
+        else
+        {
+            const VKColorBuffer& colorBuffer = *colorBuffers_[colorBufferIndex++];
+            InitDynamicRenderingImage(
+                dynamicRenderingAttachments_.colorAttachments[i],
+                colorBuffer.GetVkImage(),
+                colorBuffer.GetVkImageView(),
+                colorBuffer.GetVkFormat(),
+                0,
+                0,
+                VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL
+            );
+        }
+    }
+
+    /* Initialize depth-stencil attachment */
+    const AttachmentDescriptor& depthStencilAttachment = desc.depthStencilAttachment;
+    if (IsAttachmentEnabled(depthStencilAttachment))
+    {
+        VKDynamicRenderingImage& dst = dynamicRenderingAttachments_.depthStencilAttachment;
+        if (Texture* texture = depthStencilAttachment.texture)
+            InitDynamicRenderingAttachmentImage(dst, depthStencilAttachment, attachmentImageViews[numColorAttachments_], texture->GetBindFlags());
+        else
+        {
+            InitDynamicRenderingImage(
+                dst,
+                depthStencilBuffer_.GetVkImage(),
+                depthStencilBuffer_.GetVkImageView(),
+                depthStencilBuffer_.GetVkFormat(),
+                0,
+                0,
+                VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL
+            );
+        }
+    }
+
+    /* Initialize resolve attachments in the same order their image views were created */
+    if (HasMultiSampling())
+    {
+        std::uint32_t attachmentIndex = numTargetAttachments;
+        for_range(i, numColorAttachments_)
+        {
+            const AttachmentDescriptor& resolveAttachment = desc.resolveAttachments[i];
+            if (resolveAttachment.texture != nullptr)
+            {
+                /* Match final layout of resolve attachments in native render passes */
+                constexpr long bindFlags = 0;
+                InitDynamicRenderingAttachmentImage(dynamicRenderingAttachments_.resolveAttachments[i], resolveAttachment, attachmentImageViews[attachmentIndex++], bindFlags);
+            }
+        }
+    }
+}
+
 
 } // /namespace LLGL
 
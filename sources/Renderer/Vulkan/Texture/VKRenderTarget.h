@@ -13,6 +13,7 @@
 #include <vulkan/vulkan.h>
 #include "../VKPtr.h"
 #include "../RenderState/VKRenderPass.h"
+#include "../Command/VKDynamicRendering.h"
 #include "VKDepthStencilBuffer.h"
 #include "VKColorBuffer.h"
 #include <memory>
@@ -36,7 +37,8 @@ class VKRenderTarget final : public RenderTarget
         VKRenderTarget(
             VkDevice                        device,
             VKDeviceMemoryManager&          deviceMemoryMngr,
-            const RenderTargetDescriptor&   desc
+            const RenderTargetDescriptor&   desc,
+            bool                            dynamicRendering    = false
         );
 
     public:
@@ -62,6 +64,18 @@ class VKRenderTarget final : public RenderTarget
             return secondaryRenderPass_.GetVkRenderPass();
         }
 
+        // Returns true if this render target is used with dynamic rendering instead of a framebuffer object.
+        inline bool UsesDynamicRendering() const
+        {
+            return dynamicRendering_;
+        }
+
+        // Returns the attachments for dynamic rendering. Only valid if UsesDynamicRendering() returns true.
+        inline const VKDynamicRenderingAttachments& GetDynamicRenderingAttachments() const
+        {
+            return dynamicRenderingAttachments_;
+        }
+
         // Returns the render target resolution as VkExtent2D.
         inline VkExtent2D GetVkExtent() const
         {
@@ -96,6 +110,12 @@ class VKRenderTarget final : public RenderTarget
             const RenderTargetDescriptor&   desc
         );
 
+        void InitDynamicRenderingAttachments(
+            const RenderTargetDescriptor&   desc,
+            const VkImageView*              attachmentImageViews,
+            std::uint32_t                   numTargetAttachments
+        );
+
     private:
 
         using VKColorBufferPtr = std::unique_ptr<VKColorBuffer>;
@@ -116,6 +136,9 @@ class VKRenderTarget final : public RenderTarget
         std::uint32_t                   numColorAttachments_    = 0;
         VkSampleCountFlagBits           sampleCountBits_        = VK_SAMPLE_COUNT_1_BIT;
 
+        bool                            dynamicRendering_       = false;
+        VKDynamicRenderingAttachments   dynamicRenderingAttachments_;
+
 };
 
 
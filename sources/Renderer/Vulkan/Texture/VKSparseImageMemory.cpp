@@ -0,0 +1,295 @@
+/*
+ * VKSparseImageMemory.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VKSparseImageMemory.h"
+#include "../Memory/VKDeviceMemory.h"
+#include "../Memory/VKDeviceMemoryManager.h"
+#include "../Command/VKCommandQueue.h"
+#include "../../../Core/Exception.h"
+#include "../../../Core/PrintfUtils.h"
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+static void InitVkBindSparseInfo(VkBindSparseInfo& outBindInfo)
+{
+    outBindInfo.sType                   = VK_STRUCTURE_TYPE_BIND_SPARSE_INFO;
+    outBindInfo.pNext                   = nullptr;
+    outBindInfo.waitSemaphoreCount      = 0;
+    outBindInfo.pWaitSemaphores         = nullptr;
+    outBindInfo.bufferBindCount         = 0;
+    outBindInfo.pBufferBinds            = nullptr;
+    outBindInfo.imageOpaqueBindCount    = 0;
+    outBindInfo.pImageOpaqueBinds       = nullptr;
+    outBindInfo.imageBindCount          = 0;
+    outBindInfo.pImageBinds             = nullptr;
+    outBindInfo.signalSemaphoreCount    = 0;
+    outBindInfo.pSignalSemaphores       = nullptr;
+}
+
+VKSparseImageMemory::VKSparseImageMemory(
+    VKDeviceMemoryManager&  deviceMemoryMngr,
+    VkImage                 image,
+    const VkExtent3D&       extent,
+    std::uint32_t           numMipLevels,
+    std::uint32_t           numArrayLayers)
+:
+    deviceMemoryMngr_ { deviceMemoryMngr },
+    image_            { image            },
+    extent_           { extent           },
+    numMipLevels_     { numMipLevels     },
+    numArrayLayers_   { numArrayLayers   }
+{
+    VkDevice device = deviceMemoryMngr.GetVkDevice();
+
+    /* Memory alignment of sparse images is the size of a single tile */
+    vkGetImageMemoryRequirements(device, image, &memoryRequirements_);
+
+    std::uint32_t numRequirements = 0;
+    vkGetImageSparseMemoryRequirements(device, image, &numRequirements, nullptr);
+    std::vector<VkSparseImageMemoryRequirements> requirements(numRequirements);
+    vkGetImageSparseMemoryRequirements(device, image, &numRequirements, requirements.data());
+
+    for (const VkSparseImageMemoryRequirements& req : requirements)
+    {
+        const bool isMetadata = ((req.formatProperties.aspectMask & VK_IMAGE_ASPECT_METADATA_BIT) != 0);
+
+        /* Take tile layout from the first aspect that is not metadata */
+        if (!isMetadata && aspectMask_ == 0)
+        {
+            aspectMask_     = req.formatProperties.aspectMask;
+            tileExtent_     = req.formatProperties.imageGranularity;
+            firstMipTail_   = std::min(req.imageMipTailFirstLod, numMipLevels);
+        }
+
+        /* Metadata always resides in the MIP-map tail; either one tail is shared by all array layers or each layer has its own */
+        if (isMetadata || req.imageMipTailFirstLod < numMipLevels)
+        {
+            const bool          isSingleMipTail = ((req.formatProperties.flags & VK_SPARSE_IMAGE_FORMAT_SINGLE_MIPTAIL_BIT) != 0);
+            const std::uint32_t numMipTails     = (isSingleMipTail ? 1u : numArrayLayers);
+
+            for_range(arrayLayer, numMipTails)
+            {
+                VkSparseMemoryBind bind;
+                {
+                    bind.resourceOffset = req.imageMipTailOffset + req.imageMipTailStride * arrayLayer;
+                    bind.size           = req.imageMipTailSize;
+                    bind.memory         = VK_NULL_HANDLE;
+                    bind.memoryOffset   = 0;
+                    bind.flags          = (isMetadata ? VK_SPARSE_MEMORY_BIND_METADATA_BIT : 0);
+                }
+                mipTailBinds_.push_back(bind);
+            }
+        }
+    }
+
+    if (aspectMask_ == 0 || tileExtent_.width == 0 || tileExtent_.height == 0)
+        LLGL_TRAP("failed to create sparse Vulkan image: format does not support sparse residency");
+
+    /* Allocate table of tiles for all MIP-map levels before the MIP-map tail */
+    mipTileOffsets_.resize(firstMipTail_);
+    for_range(mipLevel, firstMipTail_)
+    {
+        const VkExtent2D numTiles = GetNumTiles(mipLevel);
+        mipTileOffsets_[mipLevel] = numTilesPerLayer_;
+        numTilesPerLayer_ += numTiles.width * numTiles.height;
+    }
+    tiles_.resize(static_cast<std::size_t>(numTilesPerLayer_) * numArrayLayers_, nullptr);
+}
+
+VKSparseImageMemory::~VKSparseImageMemory()
+{
+    for (VKDeviceMemoryRegion* tile : tiles_)
+        deviceMemoryMngr_.Release(tile);
+    for (VKDeviceMemoryRegion* region : mipTailRegions_)
+        deviceMemoryMngr_.Release(region);
+}
+
+void VKSparseImageMemory::BindMipTail(VKCommandQueue& commandQueue)
+{
+    if (mipTailBinds_.empty() || !mipTailRegions_.empty())
+        return;
+
+    /* Allocate device memory for each MIP-map tail */
+    for (VkSparseMemoryBind& bind : mipTailBinds_)
+    {
+        VKDeviceMemoryRegion* region = deviceMemoryMngr_.Allocate(
+            bind.size,
+            memoryRequirements_.alignment,
+            memoryRequirements_.memoryTypeBits,
+            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+        );
+        if (region == nullptr)
+            LLGL_TRAP("failed to allocate 0x%016" PRIX64 " bytes of device memory for MIP-map tail of sparse Vulkan image", bind.size);
+
+        bind.memory         = region->GetParentChunk()->GetVkDeviceMemory();
+        bind.memoryOffset   = region->GetOffset();
+        mipTailRegions_.push_back(region);
+    }
+
+    VkSparseImageOpaqueMemoryBindInfo opaqueBindInfo;
+    {
+        opaqueBindInfo.image        = image_;
+        opaqueBindInfo.bindCount    = static_cast<std::uint32_t>(mipTailBinds_.size());
+        opaqueBindInfo.pBinds       = mipTailBinds_.data();
+    }
+    VkBindSparseInfo bindInfo;
+    {
+        InitVkBindSparseInfo(bindInfo);
+        bindInfo.imageOpaqueBindCount   = 1;
+        bindInfo.pImageOpaqueBinds      = &opaqueBindInfo;
+    }
+    commandQueue.BindSparseAndWait(bindInfo);
+}
+
+bool VKSparseImageMemory::BindTiles(VKCommandQueue& commandQueue, const TextureRegion& region, bool commit)
+{
+    /* MIP-map levels of the tail are always resident */
+    const std::uint32_t mipLevel = region.subresource.baseMipLevel;
+    if (mipLevel >= firstMipTail_)
+        return false;
+
+    /* Determine range of tiles that are covered by the region */
+    const VkExtent2D    numTiles    = GetNumTiles(mipLevel);
+    const std::uint32_t mipWidth    = std::max(1u, extent_.width  >> mipLevel);
+    const std::uint32_t mipHeight   = std::max(1u, extent_.height >> mipLevel);
+    const std::uint32_t offsetX     = static_cast<std::uint32_t>(std::max(0, region.offset.x));
+    const std::uint32_t offsetY     = static_cast<std::uint32_t>(std::max(0, region.offset.y));
+    const std::uint32_t tileBeginX  = offsetX / tileExtent_.width;
+    const std::uint32_t tileBeginY  = offsetY / tileExtent_.height;
+    const std::uint32_t tileEndX    = std::min((offsetX + region.extent.width  + tileExtent_.width  - 1) / tileExtent_.width,  numTiles.width );
+    const std::uint32_t tileEndY    = std::min((offsetY + region.extent.height + tileExtent_.height - 1) / tileExtent_.height, numTiles.height);
+    const std::uint32_t layerBegin  = std::min(region.subresource.baseArrayLayer, numArrayLayers_);
+    const std::uint32_t layerEnd    = std::min(region.subresource.baseArrayLayer + region.subresource.numArrayLayers, numArrayLayers_);
+
+    std::vector<VkSparseImageMemoryBind> binds;
+    std::vector<VKDeviceMemoryRegion*> releasedTiles;
+    bool result = true;
+
+    for (std::uint32_t arrayLayer = layerBegin; arrayLayer < layerEnd; ++arrayLayer)
+    {
+        for (std::uint32_t tileY = tileBeginY; tileY < tileEndY; ++tileY)
+        {
+            for (std::uint32_t tileX = tileBeginX; tileX < tileEndX; ++tileX)
+            {
+                /* Skip tiles that are already in the requested state */
+                VKDeviceMemoryRegion*& tile = tiles_[GetTileIndex(mipLevel, arrayLayer, tileX, tileY)];
+                if (commit == (tile != nullptr))
+                    continue;
+
+                VkSparseImageMemoryBind bind;
+                {
+                    bind.subresource.aspectMask = aspectMask_;
+                    bind.subresource.mipLevel   = mipLevel;
+                    bind.subresource.arrayLayer = arrayLayer;
+                    bind.offset.x               = static_cast<std::int32_t>(tileX * tileExtent_.width);
+                    bind.offset.y               = static_cast<std::int32_t>(tileY * tileExtent_.height);
+                    bind.offset.z               = 0;
+                    bind.extent.width           = std::min(tileExtent_.width,  mipWidth  - tileX * tileExtent_.width );
+                    bind.extent.height          = std::min(tileExtent_.height, mipHeight - tileY * tileExtent_.height);
+                    bind.extent.depth           = 1;
+                    bind.memory                 = VK_NULL_HANDLE;
+                    bind.memoryOffset           = 0;
+                    bind.flags                  = 0;
+                }
+
+                if (commit)
+                {
+                    tile = deviceMemoryMngr_.Allocate(
+                        memoryRequirements_.alignment,
+                        memoryRequirements_.alignment,
+                        memoryRequirements_.memoryTypeBits,
+                        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+                    );
+                    if (tile == nullptr)
+                    {
+                        result = false;
+                        continue;
+                    }
+                    bind.memory         = tile->GetParentChunk()->GetVkDeviceMemory();
+                    bind.memoryOffset   = tile->GetOffset();
+                }
+                else
+                {
+                    releasedTiles.push_back(tile);
+                    tile = nullptr;
+                }
+
+                binds.push_back(bind);
+            }
+        }
+    }
+
+    if (!binds.empty())
+    {
+        VkSparseImageMemoryBindInfo imageBindInfo;
+        {
+            imageBindInfo.image     = image_;
+            imageBindInfo.bindCount = static_cast<std::uint32_t>(binds.size());
+            imageBindInfo.pBinds    = binds.data();
+        }
+        VkBindSparseInfo bindInfo;
+        {
+            InitVkBindSparseInfo(bindInfo);
+            bindInfo.imageBindCount = 1;
+            bindInfo.pImageBinds    = &imageBindInfo;
+        }
+        commandQueue.BindSparseAndWait(bindInfo);
+    }
+
+    /* Memory of released tiles can only be reused once they are unbound */
+    for (VKDeviceMemoryRegion* tile : releasedTiles)
+        deviceMemoryMngr_.Release(tile);
+
+    return result;
+}
+
+void VKSparseImageMemory::GetProperties(SparseTextureProperties& outProperties) const
+{
+    outProperties.tileExtent    = Extent3D{ tileExtent_.width, tileExtent_.height, tileExtent_.depth };
+    outProperties.tileSize      = static_cast<std::uint32_t>(memoryRequirements_.alignment);
+    outProperties.firstMipTail  = firstMipTail_;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+VkExtent2D VKSparseImageMemory::GetNumTiles(std::uint32_t mipLevel) const
+{
+    const std::uint32_t mipWidth    = std::max(1u, extent_.width  >> mipLevel);
+    const std::uint32_t mipHeight   = std::max(1u, extent_.height >> mipLevel);
+    return VkExtent2D
+    {
+        (mipWidth  + tileExtent_.width  - 1) / tileExtent_.width,
+        (mipHeight + tileExtent_.height - 1) / tileExtent_.height
+    };
+}
+
+std::size_t VKSparseImageMemory::GetTileIndex(std::uint32_t mipLevel, std::uint32_t arrayLayer, std::uint32_t tileX, std::uint32_t tileY) const
+{
+    const VkExtent2D numTiles = GetNumTiles(mipLevel);
+    return
+    (
+        static_cast<std::size_t>(arrayLayer) * numTilesPerLayer_ +
+        mipTileOffsets_[mipLevel] +
+        tileY * numTiles.width +
+        tileX
+    );
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,95 @@
+/*
+ * VKSparseImageMemory.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VK_SPARSE_IMAGE_MEMORY_H
+#define LLGL_VK_SPARSE_IMAGE_MEMORY_H
+
+
+#include "../Vulkan.h"
+#include <LLGL/TextureFlags.h>
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class VKDeviceMemoryRegion;
+class VKDeviceMemoryManager;
+class VKCommandQueue;
+
+/*
+Device memory of a sparse VkImage (see MiscFlags::Sparse).
+The packed MIP-map tail is bound once and stays resident; all other MIP-map levels are bound tile by tile,
+each tile with its own region from the device memory manager.
+*/
+class VKSparseImageMemory
+{
+
+    public:
+
+        VKSparseImageMemory(
+            VKDeviceMemoryManager&  deviceMemoryMngr,
+            VkImage                 image,
+            const VkExtent3D&       extent,
+            std::uint32_t           numMipLevels,
+            std::uint32_t           numArrayLayers
+        );
+        ~VKSparseImageMemory();
+
+        VKSparseImageMemory(const VKSparseImageMemory&) = delete;
+        VKSparseImageMemory& operator = (const VKSparseImageMemory&) = delete;
+
+        // Allocates and binds the memory for the packed MIP-map tail of all array layers.
+        void BindMipTail(VKCommandQueue& commandQueue);
+
+        // Commits or releases all tiles that are covered by the specified region. Returns false if the memory for any tile could not be allocated.
+        bool BindTiles(VKCommandQueue& commandQueue, const TextureRegion& region, bool commit);
+
+        // Returns the tile layout of this image.
+        void GetProperties(SparseTextureProperties& outProperties) const;
+
+    private:
+
+        // Returns the number of tiles along each dimension of the specified MIP-map level.
+        VkExtent2D GetNumTiles(std::uint32_t mipLevel) const;
+
+        // Returns the index of the specified tile in the tile table.
+        std::size_t GetTileIndex(std::uint32_t mipLevel, std::uint32_t arrayLayer, std::uint32_t tileX, std::uint32_t tileY) const;
+
+    private:
+
+        VKDeviceMemoryManager&              deviceMemoryMngr_;
+        VkImage                             image_                  = VK_NULL_HANDLE;
+        VkExtent3D                          extent_                 = {};
+        std::uint32_t                       numMipLevels_           = 0;
+        std::uint32_t                       numArrayLayers_         = 0;
+
+        VkMemoryRequirements                memoryRequirements_     = {};
+        VkImageAspectFlags                  aspectMask_             = 0;
+        VkExtent3D                          tileExtent_             = {};
+        std::uint32_t                       firstMipTail_           = 0;
+
+        std::vector<VkSparseMemoryBind>     mipTailBinds_;          // Opaque binds for the MIP-map tail of each aspect and array layer.
+        std::vector<VKDeviceMemoryRegion*>  mipTailRegions_;
+
+        std::vector<std::uint32_t>          mipTileOffsets_;        // Index of the first tile of each MIP-map level within an array layer.
+        std::uint32_t                       numTilesPerLayer_       = 0;
+        std::vector<VKDeviceMemoryRegion*>  tiles_;                 // Memory region of each tile or null if the tile is not committed.
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -13,6 +13,7 @@
 #include "../../../Core/CoreUtils.h"
 #include "../VKTypes.h"
 #include "../VKCore.h"
+#include <LLGL/Backend/Vulkan/NativeHandle.h>
 #include <algorithm>
 
 
@@ -40,9 +41,12 @@ VKTexture::VKTexture(
     format_        { VKTypes::Map(desc.format)         },
     swizzleFormat_ { MapToVKSwizzleFormat(desc.format) }
 {
-    /* Create Vulkan image and allocate memory region */
+    /* Create Vulkan image and allocate memory region; sparse images are bound tile by tile instead */
     CreateImage(device, desc);
-    image_.AllocateMemoryRegion(deviceMemoryMngr);
+    if ((desc.miscFlags & MiscFlags::Sparse) != 0)
+        sparseMemory_ = MakeUnique<VKSparseImageMemory>(deviceMemoryMngr, GetVkImage(), extent_, numMipLevels_, numArrayLayers_);
+    else
+        image_.AllocateMemoryRegion(deviceMemoryMngr, /*lazilyAllocated:*/ ((desc.miscFlags & MiscFlags::Memoryless) != 0));
 }
 
 Extent3D VKTexture::GetMipExtent(std::uint32_t mipLevel) const
@@ -133,6 +137,37 @@ TextureDescriptor VKTexture::GetDesc() const
     return texDesc;
 }
 
+void VKTexture::SetResidencyPriority(ResidencyPriority priority)
+{
+    /* Sparse textures have no memory region; their tiles are committed individually */
+    if (VKDeviceMemoryRegion* region = GetMemoryRegion())
+        region->GetParentChunk()->SetRegionResidency(region, VKTypes::ToVkMemoryPriority(priority), region->IsEvicted());
+}
+
+bool VKTexture::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
+{
+    if (nativeHandle != nullptr && nativeHandleSize == sizeof(Vulkan::ResourceNativeHandle))
+    {
+        auto* nativeHandleVK = reinterpret_cast<Vulkan::ResourceNativeHandle*>(nativeHandle);
+        nativeHandleVK->image  = GetVkImage();
+        nativeHandleVK->buffer = VK_NULL_HANDLE;
+        if (VKDeviceMemoryRegion* region = GetMemoryRegion())
+        {
+            nativeHandleVK->deviceMemory = region->GetParentChunk()->GetVkDeviceMemory();
+            nativeHandleVK->memoryOffset = region->GetOffset();
+            nativeHandleVK->memorySize   = region->GetSize();
+        }
+        else
+        {
+            nativeHandleVK->deviceMemory = VK_NULL_HANDLE;
+            nativeHandleVK->memoryOffset = 0;
+            nativeHandleVK->memorySize   = 0;
+        }
+        return true;
+    }
+    return false;
+}
+
 Format VKTexture::GetFormat() const
 {
     return VKTypes::Unmap(GetVkFormat());
@@ -235,6 +270,35 @@ void VKTexture::CreateImageView(
     );
 }
 
+VKImageViewSharedPtr VKTexture::GetOrCreateSharedImageView(VkDevice device, const TextureViewDescriptor& textureViewDesc)
+{
+    CompressedTexView view;
+    CompressTextureViewDesc(view, textureViewDesc);
+
+    /* Find image view that is still referenced by any resource heap and drop expired entries */
+    VKImageViewSharedPtr imageView;
+    RemoveAllFromListIf(
+        sharedImageViews_,
+        [&view, &imageView](const SharedImageView& entry) -> bool
+        {
+            if (entry.imageView.expired())
+                return true;
+            if (!imageView && CompareCompressedTexViewSWO(entry.view, view) == 0)
+                imageView = entry.imageView.lock();
+            return false;
+        }
+    );
+    if (imageView)
+        return imageView;
+
+    /* Create new image view for this descriptor */
+    imageView = std::make_shared<VKPtr<VkImageView>>(device, vkDestroyImageView);
+    CreateImageView(device, textureViewDesc, *imageView);
+    sharedImageViews_.push_back(SharedImageView{ view, imageView });
+
+    return imageView;
+}
+
 static bool UsageFlagsAllowImageViews(VkImageUsageFlags flags)
 {
     /* Vulkan only alows image views on images that were created with these usage flags */
@@ -329,6 +393,10 @@ static VkImageCreateFlags GetVkImageCreateFlags(const TextureDescriptor& desc)
             break;
     }
 
+    /* Sparse images are bound to device memory tile by tile */
+    if ((desc.miscFlags & MiscFlags::Sparse) != 0)
+        createFlags |= (VK_IMAGE_CREATE_SPARSE_BINDING_BIT | VK_IMAGE_CREATE_SPARSE_RESIDENCY_BIT);
+
     return createFlags;
 }
 
@@ -410,6 +478,17 @@ static VkSampleCountFlagBits GetVkImageSampleCountFlags(const TextureDescriptor&
 
 static VkImageUsageFlags GetVkImageUsageFlags(const TextureDescriptor& desc)
 {
+    /* Memoryless textures are transient attachments that must not be used for any other purpose */
+    if ((desc.miscFlags & MiscFlags::Memoryless) != 0)
+    {
+        if ((desc.bindFlags & BindFlags::InputAttachment) != 0)
+            return (VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT);
+        else if ((desc.bindFlags & BindFlags::ColorAttachment) != 0)
+            return (VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT);
+        else
+            return (VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT);
+    }
+
     VkImageUsageFlags usageFlags = VK_IMAGE_USAGE_TRANSFER_DST_BIT;
 
     /* Enable TRANSFER_SRC_BIT image usage when MIP-maps are enabled, CPU read access or copy source binding is requested */
@@ -430,14 +509,9 @@ static VkImageUsageFlags GetVkImageUsageFlags(const TextureDescriptor& desc)
     if ((desc.bindFlags & BindFlags::Storage) != 0)
         usageFlags |= VK_IMAGE_USAGE_STORAGE_BIT;
 
-    #if 0//???
-    /* Enable input attachment bit when used for reading AND as attachment */
-    if ( (desc.bindFlags & (BindFlags::Sampled         | BindFlags::Storage               )) != 0 &&
-         (desc.bindFlags & (BindFlags::ColorAttachment | BindFlags::DepthStencilAttachment)) != 0 )
-    {
+    /* Enable reading the image as input attachment in subsequent subpasses */
+    if ((desc.bindFlags & BindFlags::InputAttachment) != 0)
         usageFlags |= VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT;
-    }
-    #endif
 
     return usageFlags;
 }
@@ -11,8 +11,12 @@
 
 #include <LLGL/Texture.h>
 #include "VKDeviceImage.h"
+#include "VKSparseImageMemory.h"
 #include <vulkan/vulkan.h>
 #include "../VKPtr.h"
+#include "../../TextureUtils.h"
+#include <memory>
+#include <vector>
 #include <cstdint>
 
 
@@ -24,6 +28,9 @@ class VKDeviceMemoryRegion;
 class VKDeviceMemoryManager;
 class VKCommandContext;
 
+// Image view that is shared by all resource heaps that refer to the same texture view; the view is destroyed with its last reference.
+using VKImageViewSharedPtr = std::shared_ptr<VKPtr<VkImageView>>;
+
 // Predefined texture swizzles to emulate certain texture format
 enum class VKSwizzleFormat
 {
@@ -38,6 +45,9 @@ class VKTexture final : public Texture
 
         #include <LLGL/Backend/Texture.inl>
 
+        void SetResidencyPriority(ResidencyPriority priority) override;
+        bool GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize) override;
+
     public:
 
         VKTexture(
@@ -63,6 +73,12 @@ class VKTexture final : public Texture
             VKPtr<VkImageView>&             outImageView
         );
 
+        // Returns an image view with the specififed view descriptor that is shared with all other requests of the same view.
+        VKImageViewSharedPtr GetOrCreateSharedImageView(
+            VkDevice                        device,
+            const TextureViewDescriptor&    textureViewDesc
+        );
+
         // Creates the primary image view that is stored within this texture object.
         // If this texture was not created with a valid image view usage flag,
         // this function call has no effect and GetVkImageView() returns a null handle.
@@ -95,6 +111,12 @@ class VKTexture final : public Texture
             return image_.GetVkImageLayout();
         }
 
+        // Sets the native VkImageLayout state of this image after it was transitioned outside of a command context.
+        inline void SetVkImageLayout(VkImageLayout layout)
+        {
+            image_.SetVkImageLayout(layout);
+        }
+
         // Returns the internal Vulkan image view object (created with 'CreateInternalImageView').
         inline VkImageView GetVkImageView() const
         {
@@ -143,6 +165,20 @@ class VKTexture final : public Texture
             return image_.GetMemoryRegion();
         }
 
+        // Returns the sparse device memory of this image, or null if this texture was not created with MiscFlags::Sparse.
+        inline VKSparseImageMemory* GetSparseMemory() const
+        {
+            return sparseMemory_.get();
+        }
+
+    private:
+
+        struct SharedImageView
+        {
+            CompressedTexView                       view;
+            std::weak_ptr<VKPtr<VkImageView>>       imageView;
+        };
+
     private:
 
         void CreateImage(VkDevice device, const TextureDescriptor& desc);
@@ -160,6 +196,10 @@ class VKTexture final : public Texture
         VkImageUsageFlags       usageFlags_         = 0;
         const VKSwizzleFormat   swizzleFormat_      = VKSwizzleFormat::RGBA;
 
+        std::unique_ptr<VKSparseImageMemory> sparseMemory_;
+
+        std::vector<SharedImageView> sharedImageViews_; // Cache of image views for texture view descriptors; entries are not owned by the texture.
+
 };
 
 
@@ -10,6 +10,7 @@
 #include "../../Core/MacroUtils.h"
 #include "../../Core/Exception.h"
 #include <LLGL/Utils/ForRange.h>
+#include <LLGL/Platform/Platform.h>
 
 
 namespace LLGL
@@ -152,6 +153,23 @@ VkBool32 VKBoolean(bool value)
     return (value ? VK_TRUE : VK_FALSE);
 }
 
+std::mutex& VKGetQueueMutex()
+{
+    static std::mutex queueMutex;
+    return queueMutex;
+}
+
+VkTimeDomainEXT VKGetHostTimeDomain()
+{
+    #if defined LLGL_OS_WIN32
+    return VK_TIME_DOMAIN_QUERY_PERFORMANCE_COUNTER_EXT;
+    #elif defined LLGL_OS_LINUX || defined LLGL_OS_ANDROID
+    return VK_TIME_DOMAIN_CLOCK_MONOTONIC_EXT;
+    #else
+    return VK_TIME_DOMAIN_DEVICE_EXT;
+    #endif
+}
+
 
 /* ----- Query Functions ----- */
 
@@ -289,6 +307,25 @@ QueueFamilyIndices VKFindQueueFamilies(VkPhysicalDevice device, const VkQueueFla
         ++i;
     }
 
+    /*
+    Get dedicated transfer family index, i.e. a queue family that supports neither graphics nor compute.
+    Only accept families without image transfer granularity restrictions, so arbitrary texture regions can be copied.
+    */
+    i = 0;
+    for (const VkQueueFamilyProperties& family : queueFamilies)
+    {
+        const VkExtent3D& granularity = family.minImageTransferGranularity;
+        if (family.queueCount > 0 &&
+            (family.queueFlags & VK_QUEUE_TRANSFER_BIT) != 0 &&
+            (family.queueFlags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT)) == 0 &&
+            granularity.width == 1 && granularity.height == 1 && granularity.depth == 1)
+        {
+            indices.transferFamily = i;
+            break;
+        }
+        ++i;
+    }
+
     return indices;
 }
 
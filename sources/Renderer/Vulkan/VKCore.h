@@ -13,6 +13,7 @@
 #include <string>
 #include <vector>
 #include <cstdint>
+#include <mutex>
 
 
 namespace LLGL
@@ -27,21 +28,21 @@ struct alignas(alignof(std::uint32_t)) QueueFamilyIndices
 
     std::uint32_t graphicsFamily    = invalidIndex;
     std::uint32_t presentFamily     = invalidIndex;
-//  std::uint32_t transferFamily    = invalidIndex;
+    std::uint32_t transferFamily    = invalidIndex; // Optional dedicated transfer-only (DMA) queue family.
 
-    // Returns a pointer to the number of indices
+    // Returns a pointer to the graphics and present indices.
     inline const std::uint32_t* Ptr() const
     {
         return (&graphicsFamily);
     }
 
-    // Returns the number of indices this structure has.
+    // Returns the number of indices Ptr() points to, i.e. graphics and present. The transfer index is not included.
     inline std::uint32_t Count() const
     {
-        return sizeof(QueueFamilyIndices)/sizeof(std::uint32_t);
+        return 2;
     }
 
-    // Returns true if all indices have been set to a valid index.
+    // Returns true if the graphics and present indices have been set to a valid index. The transfer index is optional.
     inline bool Complete() const
     {
         return (graphicsFamily != invalidIndex && presentFamily != invalidIndex);
@@ -72,6 +73,12 @@ std::string VKApiVersionToString(std::uint32_t version);
 // Converts the boolean value into a VkBool322 value.
 VkBool32 VKBoolean(bool value);
 
+// Returns the mutex that guards all submissions to Vulkan queues, since vkQueueSubmit and vkQueuePresentKHR require the queue to be externally synchronized.
+std::mutex& VKGetQueueMutex();
+
+// Returns the Vulkan time domain of the host clock that is sampled by Timer::Tick(), or VK_TIME_DOMAIN_DEVICE_EXT if there is no such time domain on this platform.
+VkTimeDomainEXT VKGetHostTimeDomain();
+
 
 
 /* ----- Query Functions ----- */
@@ -12,6 +12,7 @@
 #include "Texture/VKTexture.h"
 #include "Memory/VKDeviceMemoryRegion.h"
 #include "Memory/VKDeviceMemory.h"
+#include "../../Core/CoreUtils.h"
 #include <LLGL/Utils/ForRange.h>
 #include <algorithm>
 #include <string.h>
@@ -31,10 +32,15 @@ VKDevice::VKDevice() :
 }
 
 VKDevice::VKDevice(VKDevice&& device) :
-    device_             { std::move(device.device_)      },
-    queueFamilyIndices_ { device.queueFamilyIndices_     },
-    graphicsQueue_      { device.graphicsQueue_          },
-    commandPool_        { std::move(device.commandPool_) }
+    device_             { std::move(device.device_)        },
+    queueFamilyIndices_ { device.queueFamilyIndices_       },
+    graphicsQueue_      { device.graphicsQueue_            },
+    computeQueue_       { device.computeQueue_             },
+    copyQueue_          { device.copyQueue_                },
+    transferQueue_      { device.transferQueue_            },
+    commandPool_        { std::move(device.commandPool_)   },
+    uploadBatcher_      { std::move(device.uploadBatcher_) },
+    optionalFeatures_   { device.optionalFeatures_         }
 {
 }
 
@@ -43,12 +49,19 @@ VKDevice& VKDevice::operator = (VKDevice&& device)
     device_             = std::move(device.device_);
     queueFamilyIndices_ = device.queueFamilyIndices_;
     graphicsQueue_      = device.graphicsQueue_;
+    computeQueue_       = device.computeQueue_;
+    copyQueue_          = device.copyQueue_;
+    transferQueue_      = device.transferQueue_;
     commandPool_        = std::move(device.commandPool_);
+    uploadBatcher_      = std::move(device.uploadBatcher_);
+    optionalFeatures_   = device.optionalFeatures_;
     return *this;
 }
 
 void VKDevice::WaitIdle()
 {
+    /* vkDeviceWaitIdle requires all queues of the device to be externally synchronized */
+    std::lock_guard<std::mutex> guard{ VKGetQueueMutex() };
     vkDeviceWaitIdle(device_);
 }
 
@@ -58,14 +71,15 @@ void VKDevice::CreateLogicalDevice(
     VkPhysicalDevice                physicalDevice,
     const VkPhysicalDeviceFeatures* features,
     const char* const*              extensions,
-    std::uint32_t                   numExtensions)
+    std::uint32_t                   numExtensions,
+    const VKOptionalDeviceFeatures& optionalFeatures)
 {
     /* Initialize queue create description */
     queueFamilyIndices_ = VKFindQueueFamilies(physicalDevice, (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT));
 
-    SmallVector<VkDeviceQueueCreateInfo, 2> queueCreateInfos;
+    SmallVector<VkDeviceQueueCreateInfo, 3> queueCreateInfos;
 
-    auto AddQueueFamily = [&queueCreateInfos](std::uint32_t family, float queuePriority)
+    auto AddQueueFamily = [&queueCreateInfos](std::uint32_t family, const float* queuePriorities, std::uint32_t numQueues = 1)
     {
         VkDeviceQueueCreateInfo info;
         {
@@ -73,24 +87,164 @@ void VKDevice::CreateLogicalDevice(
             info.pNext              = nullptr;
             info.flags              = 0;
             info.queueFamilyIndex   = family;
-            info.queueCount         = 1;
-            info.pQueuePriorities   = &queuePriority;
+            info.queueCount         = numQueues;
+            info.pQueuePriorities   = queuePriorities;
         }
         queueCreateInfos.push_back(info);
     };
 
-    constexpr float queuePriority = 1.0f;
+    /*
+    Request up to two additional queues from the graphics family for asynchronous compute and copy work.
+    Using the same family avoids queue family ownership transfers for resources with exclusive sharing mode.
+    */
+    static const float queuePriorities[3] = { 1.0f, 1.0f, 1.0f };
 
-    AddQueueFamily(queueFamilyIndices_.graphicsFamily, queuePriority);
+    const std::vector<VkQueueFamilyProperties> queueFamilies = VKQueryQueueFamilyProperties(physicalDevice);
+    const std::uint32_t numGraphicsQueues = std::max(1u, std::min(queueFamilies[queueFamilyIndices_.graphicsFamily].queueCount, 3u));
+
+    AddQueueFamily(queueFamilyIndices_.graphicsFamily, queuePriorities, numGraphicsQueues);
 
     if (queueFamilyIndices_.graphicsFamily != queueFamilyIndices_.presentFamily)
-        AddQueueFamily(queueFamilyIndices_.presentFamily, queuePriority);
+        AddQueueFamily(queueFamilyIndices_.presentFamily, queuePriorities);
+
+    if (queueFamilyIndices_.transferFamily != QueueFamilyIndices::invalidIndex)
+        AddQueueFamily(queueFamilyIndices_.transferFamily, queuePriorities);
+
+    /* Chain optional features into device creation */
+    void* featuresChain = nullptr;
+
+    VkPhysicalDevicePresentWaitFeaturesKHR presentWaitFeatures = {};
+    VkPhysicalDevicePresentIdFeaturesKHR presentIdFeatures = {};
+    if (optionalFeatures.presentWait)
+    {
+        presentWaitFeatures.sType                   = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR;
+        presentWaitFeatures.pNext                   = featuresChain;
+        presentWaitFeatures.presentWait             = VK_TRUE;
+        presentIdFeatures.sType                     = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR;
+        presentIdFeatures.pNext                     = &presentWaitFeatures;
+        presentIdFeatures.presentId                 = VK_TRUE;
+        featuresChain = &presentIdFeatures;
+    }
+
+    VkPhysicalDeviceDynamicRenderingFeaturesKHR dynamicRenderingFeatures = {};
+    if (optionalFeatures.dynamicRendering)
+    {
+        dynamicRenderingFeatures.sType              = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES_KHR;
+        dynamicRenderingFeatures.pNext              = featuresChain;
+        dynamicRenderingFeatures.dynamicRendering   = VK_TRUE;
+        featuresChain = &dynamicRenderingFeatures;
+    }
+
+    VkPhysicalDeviceTimelineSemaphoreFeaturesKHR timelineSemaphoreFeatures = {};
+    if (optionalFeatures.timelineSemaphore)
+    {
+        timelineSemaphoreFeatures.sType             = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR;
+        timelineSemaphoreFeatures.pNext             = featuresChain;
+        timelineSemaphoreFeatures.timelineSemaphore = VK_TRUE;
+        featuresChain = &timelineSemaphoreFeatures;
+    }
+
+    VkPhysicalDeviceSynchronization2FeaturesKHR synchronization2Features = {};
+    if (optionalFeatures.synchronization2)
+    {
+        synchronization2Features.sType              = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES_KHR;
+        synchronization2Features.pNext              = featuresChain;
+        synchronization2Features.synchronization2   = VK_TRUE;
+        featuresChain = &synchronization2Features;
+    }
+
+    VkPhysicalDeviceDescriptorIndexingFeaturesEXT descriptorIndexingFeatures = {};
+    if (optionalFeatures.bindlessResources)
+    {
+        descriptorIndexingFeatures.sType                                         = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT;
+        descriptorIndexingFeatures.pNext                                         = featuresChain;
+        descriptorIndexingFeatures.runtimeDescriptorArray                        = VK_TRUE;
+        descriptorIndexingFeatures.descriptorBindingPartiallyBound               = VK_TRUE;
+        descriptorIndexingFeatures.descriptorBindingUpdateUnusedWhilePending     = VK_TRUE;
+        descriptorIndexingFeatures.descriptorBindingSampledImageUpdateAfterBind  = VK_TRUE;
+        descriptorIndexingFeatures.descriptorBindingStorageImageUpdateAfterBind  = VK_TRUE;
+        descriptorIndexingFeatures.descriptorBindingStorageBufferUpdateAfterBind = VK_TRUE;
+        descriptorIndexingFeatures.descriptorBindingUniformBufferUpdateAfterBind = (optionalFeatures.bindlessUniforms ? VK_TRUE : VK_FALSE);
+        featuresChain = &descriptorIndexingFeatures;
+    }
+
+    VkPhysicalDeviceMeshShaderFeaturesEXT meshShaderFeatures = {};
+    if (optionalFeatures.meshShader)
+    {
+        meshShaderFeatures.sType                    = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_EXT;
+        meshShaderFeatures.pNext                    = featuresChain;
+        meshShaderFeatures.meshShader               = VK_TRUE;
+        meshShaderFeatures.taskShader               = (optionalFeatures.taskShader ? VK_TRUE : VK_FALSE);
+        featuresChain = &meshShaderFeatures;
+    }
+
+    VkPhysicalDeviceBufferDeviceAddressFeaturesKHR bufferDeviceAddressFeatures = {};
+    VkPhysicalDeviceAccelerationStructureFeaturesKHR accelerationStructureFeatures = {};
+    VkPhysicalDeviceRayQueryFeaturesKHR rayQueryFeatures = {};
+    if (optionalFeatures.rayTracing)
+    {
+        bufferDeviceAddressFeatures.sType                   = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES_KHR;
+        bufferDeviceAddressFeatures.pNext                   = featuresChain;
+        bufferDeviceAddressFeatures.bufferDeviceAddress     = VK_TRUE;
+        accelerationStructureFeatures.sType                 = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ACCELERATION_STRUCTURE_FEATURES_KHR;
+        accelerationStructureFeatures.pNext                 = &bufferDeviceAddressFeatures;
+        accelerationStructureFeatures.accelerationStructure = VK_TRUE;
+        rayQueryFeatures.sType                              = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_QUERY_FEATURES_KHR;
+        rayQueryFeatures.pNext                              = &accelerationStructureFeatures;
+        rayQueryFeatures.rayQuery                           = VK_TRUE;
+        featuresChain = &rayQueryFeatures;
+    }
+
+    VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT pageableMemoryFeatures = {};
+    if (optionalFeatures.pageableMemory)
+    {
+        pageableMemoryFeatures.sType                        = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PAGEABLE_DEVICE_LOCAL_MEMORY_FEATURES_EXT;
+        pageableMemoryFeatures.pNext                        = featuresChain;
+        pageableMemoryFeatures.pageableDeviceLocalMemory    = VK_TRUE;
+        featuresChain = &pageableMemoryFeatures;
+    }
+
+    VkPhysicalDeviceFragmentShadingRateFeaturesKHR shadingRateFeatures = {};
+    if (optionalFeatures.shadingRate)
+    {
+        shadingRateFeatures.sType                           = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_FEATURES_KHR;
+        shadingRateFeatures.pNext                           = featuresChain;
+        shadingRateFeatures.pipelineFragmentShadingRate     = VK_TRUE;
+        featuresChain = &shadingRateFeatures;
+    }
+
+    VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT pipelineLibraryFeatures = {};
+    if (optionalFeatures.pipelineLibrary)
+    {
+        pipelineLibraryFeatures.sType                       = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT;
+        pipelineLibraryFeatures.pNext                       = featuresChain;
+        pipelineLibraryFeatures.graphicsPipelineLibrary     = VK_TRUE;
+        featuresChain = &pipelineLibraryFeatures;
+    }
+
+    VkPhysicalDeviceExtendedDynamicStateFeaturesEXT extendedDynamicStateFeatures = {};
+    if (optionalFeatures.extDynamicState)
+    {
+        extendedDynamicStateFeatures.sType                  = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT;
+        extendedDynamicStateFeatures.pNext                  = featuresChain;
+        extendedDynamicStateFeatures.extendedDynamicState   = VK_TRUE;
+        featuresChain = &extendedDynamicStateFeatures;
+    }
+
+    VkPhysicalDeviceHostQueryResetFeaturesEXT hostQueryResetFeatures = {};
+    if (optionalFeatures.hostQueryReset)
+    {
+        hostQueryResetFeatures.sType                        = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_QUERY_RESET_FEATURES_EXT;
+        hostQueryResetFeatures.pNext                        = featuresChain;
+        hostQueryResetFeatures.hostQueryReset               = VK_TRUE;
+        featuresChain = &hostQueryResetFeatures;
+    }
 
     /* Create logical device */
     VkDeviceCreateInfo createInfo;
     {
         createInfo.sType                    = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
-        createInfo.pNext                    = nullptr;
+        createInfo.pNext                    = featuresChain;
         createInfo.flags                    = 0;
         createInfo.queueCreateInfoCount     = static_cast<std::uint32_t>(queueCreateInfos.size());
         createInfo.pQueueCreateInfos        = queueCreateInfos.data();
@@ -102,12 +256,22 @@ void VKDevice::CreateLogicalDevice(
     }
     VkResult result = vkCreateDevice(physicalDevice, &createInfo, nullptr, device_.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan logical device");
+    optionalFeatures_ = optionalFeatures;
 
-    /* Query device graphics queue */
+    /* Query device graphics queue, optional asynchronous compute and copy queues, and optional dedicated transfer queue */
     vkGetDeviceQueue(device_, queueFamilyIndices_.graphicsFamily, 0, &graphicsQueue_);
 
-    /* Create default command pool */
-    commandPool_ = CreateCommandPool();
+    if (numGraphicsQueues >= 2)
+        vkGetDeviceQueue(device_, queueFamilyIndices_.graphicsFamily, 1, &computeQueue_);
+    if (numGraphicsQueues >= 3)
+        vkGetDeviceQueue(device_, queueFamilyIndices_.graphicsFamily, 2, &copyQueue_);
+
+    if (queueFamilyIndices_.transferFamily != QueueFamilyIndices::invalidIndex)
+        vkGetDeviceQueue(device_, queueFamilyIndices_.transferFamily, 0, &transferQueue_);
+
+    /* Create default command pool and batcher for transfer commands */
+    commandPool_    = CreateCommandPool();
+    uploadBatcher_  = MakeUnique<VKUploadBatcher>(device_, graphicsQueue_, queueFamilyIndices_.graphicsFamily, transferQueue_, queueFamilyIndices_.transferFamily);
 }
 
 void VKDevice::LoadLogicalDeviceWeakRef(VkPhysicalDevice physicalDevice, VkDevice device)
@@ -118,11 +282,13 @@ void VKDevice::LoadLogicalDeviceWeakRef(VkPhysicalDevice physicalDevice, VkDevic
     /* Store weak reference to logical Vulkan device */
     device_ = VKPtr<VkDevice>{ device };
 
-    /* Query device graphics queue */
+    /* Query device graphics queue; a custom device is not guaranteed to provide a queue for the dedicated transfer family */
     vkGetDeviceQueue(device_, queueFamilyIndices_.graphicsFamily, 0, &graphicsQueue_);
+    queueFamilyIndices_.transferFamily = QueueFamilyIndices::invalidIndex;
 
-    /* Create default command pool */
-    commandPool_ = CreateCommandPool();
+    /* Create default command pool and batcher for transfer commands */
+    commandPool_    = CreateCommandPool();
+    uploadBatcher_  = MakeUnique<VKUploadBatcher>(device_, graphicsQueue_, queueFamilyIndices_.graphicsFamily);
 }
 
 VKPtr<VkCommandPool> VKDevice::CreateCommandPool()
@@ -193,7 +359,10 @@ void VKDevice::FlushCommandBuffer(VkCommandBuffer cmdBuffer, bool release)
             submitInfo.commandBufferCount   = 1;
             submitInfo.pCommandBuffers      = (&cmdBuffer);
         }
-        vkQueueSubmit(graphicsQueue_, 1, &submitInfo, fence.GetVkFence());
+        {
+            std::lock_guard<std::mutex> guard{ VKGetQueueMutex() };
+            vkQueueSubmit(graphicsQueue_, 1, &submitInfo, fence.GetVkFence());
+        }
 
         /* Wait for fence to be signaled */
         fence.Wait(device_, ULLONG_MAX);
@@ -204,6 +373,21 @@ void VKDevice::FlushCommandBuffer(VkCommandBuffer cmdBuffer, bool release)
         vkFreeCommandBuffers(device_, commandPool_, 1, &cmdBuffer);
 }
 
+void VKDevice::FlushUploads(bool wait)
+{
+    if (wait)
+        uploadBatcher_->SubmitAndWait();
+    else
+        uploadBatcher_->Submit();
+}
+
+bool VKDevice::HasPendingUploads()
+{
+    return uploadBatcher_->HasPendingWork();
+}
+
+/* ----- Buffer/Image operatons ----- */
+
 void VKDevice::CopyBuffer(
     VkBuffer        srcBuffer,
     VkBuffer        dstBuffer,
@@ -211,7 +395,11 @@ void VKDevice::CopyBuffer(
     VkDeviceSize    srcOffset,
     VkDeviceSize    dstOffset)
 {
-    VkCommandBuffer cmdBuffer = AllocCommandBuffer();
+    /* Buffers that are owned by the transfer queue can only be accessed by the graphics queue once the current batch has been submitted */
+    if (uploadBatcher_->IsBufferAcquiredForTransfer(srcBuffer) || uploadBatcher_->IsBufferAcquiredForTransfer(dstBuffer))
+        uploadBatcher_->Submit();
+
+    VkCommandBuffer cmdBuffer = uploadBatcher_->GetCommandBuffer();
     {
         VkBufferCopy region;
         {
@@ -221,7 +409,78 @@ void VKDevice::CopyBuffer(
         }
         vkCmdCopyBuffer(cmdBuffer, srcBuffer, dstBuffer, 1, &region);
     }
-    FlushCommandBuffer(cmdBuffer);
+    uploadBatcher_->AddStagingSize(size);
+}
+
+void VKDevice::RelocateBuffer(
+    VKDeviceBuffer&&        srcBuffer,
+    VkBuffer                dstBuffer,
+    VkDeviceSize            size,
+    VKDeviceMemoryManager&  deviceMemoryMngr)
+{
+    if (uploadBatcher_->IsBufferAcquiredForTransfer(srcBuffer.GetVkBuffer()))
+        uploadBatcher_->Submit();
+
+    VkCommandBuffer cmdBuffer = uploadBatcher_->GetCommandBuffer();
+    {
+        /* Source buffer might have been written by previous transfer commands of the current batch */
+        VkMemoryBarrier barrier;
+        {
+            barrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+            barrier.pNext           = nullptr;
+            barrier.srcAccessMask   = VK_ACCESS_TRANSFER_WRITE_BIT;
+            barrier.dstAccessMask   = VK_ACCESS_TRANSFER_READ_BIT;
+        }
+        vkCmdPipelineBarrier(
+            cmdBuffer,
+            VK_PIPELINE_STAGE_TRANSFER_BIT,
+            VK_PIPELINE_STAGE_TRANSFER_BIT,
+            0,
+            1, &barrier,
+            0, nullptr,
+            0, nullptr
+        );
+
+        VkBufferCopy region;
+        {
+            region.srcOffset    = 0;
+            region.dstOffset    = 0;
+            region.size         = size;
+        }
+        vkCmdCopyBuffer(cmdBuffer, srcBuffer.GetVkBuffer(), dstBuffer, 1, &region);
+    }
+
+    /* Keep source buffer alive until the copy has completed; this must happen before the batch might be submitted */
+    uploadBatcher_->DeferRelease(std::move(srcBuffer), deviceMemoryMngr);
+    uploadBatcher_->AddStagingSize(size);
+}
+
+void VKDevice::UploadBuffer(
+    VkBuffer        stagingBuffer,
+    VkBuffer        dstBuffer,
+    VkDeviceSize    size,
+    VkDeviceSize    srcOffset,
+    VkDeviceSize    dstOffset,
+    bool            discardContent)
+{
+    /* Keep buffers on the transfer queue once they have been acquired for the current batch to preserve the order of copies */
+    if (uploadBatcher_->IsTransferQueueUpload(size) || uploadBatcher_->IsBufferAcquiredForTransfer(dstBuffer))
+    {
+        uploadBatcher_->AcquireBufferForTransfer(dstBuffer, discardContent);
+        VkCommandBuffer cmdBuffer = uploadBatcher_->GetTransferCommandBuffer();
+        {
+            VkBufferCopy region;
+            {
+                region.srcOffset    = srcOffset;
+                region.dstOffset    = dstOffset;
+                region.size         = size;
+            }
+            vkCmdCopyBuffer(cmdBuffer, stagingBuffer, dstBuffer, 1, &region);
+        }
+        uploadBatcher_->AddStagingSize(size);
+    }
+    else
+        CopyBuffer(stagingBuffer, dstBuffer, size, srcOffset, dstOffset);
 }
 
 void VKDevice::WriteBuffer(VKDeviceBuffer& buffer, const void* data, VkDeviceSize size, VkDeviceSize offset)
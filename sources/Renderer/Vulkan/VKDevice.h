@@ -14,6 +14,8 @@
 #include "VKPtr.h"
 #include "VKCore.h"
 #include "Buffer/VKDeviceBuffer.h"
+#include "Command/VKUploadBatcher.h"
+#include <memory>
 
 
 namespace LLGL
@@ -23,6 +25,26 @@ namespace LLGL
 class VKBuffer;
 class VKTexture;
 
+// Optional device features that must be enabled explicitly when the logical device is created.
+struct VKOptionalDeviceFeatures
+{
+    bool presentWait        = false; // Features of VK_KHR_present_id and VK_KHR_present_wait.
+    bool dynamicRendering   = false; // Feature of VK_KHR_dynamic_rendering.
+    bool timelineSemaphore  = false; // Feature of VK_KHR_timeline_semaphore.
+    bool synchronization2   = false; // Feature of VK_KHR_synchronization2 for pipeline barriers with per-barrier stage masks.
+    bool bindlessResources  = false; // Features of VK_EXT_descriptor_indexing for partially bound runtime arrays of images, storage buffers, and samplers that are updated after bind.
+    bool bindlessUniforms   = false; // Feature of VK_EXT_descriptor_indexing to update uniform buffer descriptors after bind.
+    bool meshShader         = false; // Feature of VK_EXT_mesh_shader for mesh shaders.
+    bool taskShader         = false; // Feature of VK_EXT_mesh_shader for task shaders.
+    bool pageableMemory     = false; // Feature of VK_EXT_pageable_device_local_memory to set the priority of device memory allocations.
+    bool rayTracing         = false; // Features of VK_KHR_acceleration_structure, VK_KHR_ray_query, and VK_KHR_buffer_device_address.
+    bool shadingRate        = false; // Feature of VK_KHR_fragment_shading_rate for a per-draw shading rate.
+    bool pipelineLibrary    = false; // Feature of VK_EXT_graphics_pipeline_library to link graphics PSOs from cached parts.
+    bool extDynamicState    = false; // Feature of VK_EXT_extended_dynamic_state for dynamic cull mode, depth-stencil, and primitive topology states.
+    bool hostTimeDomain     = false; // Feature of VK_EXT_calibrated_timestamps to sample the device time domain together with the host clock of Timer::Tick().
+    bool hostQueryReset     = false; // Feature of VK_EXT_host_query_reset (core in Vulkan 1.2) to reset queries on the CPU instead of recording vkCmdResetQueryPool.
+};
+
 class VKDevice
 {
 
@@ -35,11 +57,13 @@ class VKDevice
 
         VKDevice& operator = (VKDevice&& device);
 
+        // Creates the logical device and enables the specified optional features in addition to the core features.
         void CreateLogicalDevice(
-            VkPhysicalDevice                physicalDevice,
-            const VkPhysicalDeviceFeatures* features,
-            const char* const*              extensions,
-            std::uint32_t                   numExtensions
+            VkPhysicalDevice                    physicalDevice,
+            const VkPhysicalDeviceFeatures*     features,
+            const char* const*                  extensions,
+            std::uint32_t                       numExtensions,
+            const VKOptionalDeviceFeatures&     optionalFeatures    = {}
         );
 
         void LoadLogicalDeviceWeakRef(VkPhysicalDevice physicalDevice, VkDevice device);
@@ -56,8 +80,15 @@ class VKDevice
         VkCommandBuffer AllocCommandBuffer(bool begin = true);
         void FlushCommandBuffer(VkCommandBuffer cmdBuffer, bool release = true);
 
+        // Submits all batched transfer commands. If 'wait' is true, blocks until they have completed, e.g. before data is read back on the CPU.
+        void FlushUploads(bool wait = false);
+
+        // Returns true if there are batched transfer commands that have not been submitted yet or are still in flight.
+        bool HasPendingUploads();
+
         /* ----- Buffer/Image operatons ----- */
 
+        // Records a buffer copy into the upload batch. Call FlushUploads(true) before the destination buffer is read on the CPU.
         void CopyBuffer(
             VkBuffer        srcBuffer,
             VkBuffer        dstBuffer,
@@ -66,6 +97,30 @@ class VKDevice
             VkDeviceSize    dstOffset = 0
         );
 
+        /*
+        Records a copy from a staging buffer into a device-local buffer into the upload batch.
+        Large copies are recorded into the dedicated transfer queue if there is one. If 'discardContent' is true, the destination buffer has not been used yet.
+        */
+        void UploadBuffer(
+            VkBuffer        stagingBuffer,
+            VkBuffer        dstBuffer,
+            VkDeviceSize    size,
+            VkDeviceSize    srcOffset       = 0,
+            VkDeviceSize    dstOffset       = 0,
+            bool            discardContent  = false
+        );
+
+        /*
+        Records a copy of the entire content of a buffer that is relocated during defragmentation into the upload batch.
+        The source buffer is released once the batch has completed. See VKDeviceBuffer::Relocate.
+        */
+        void RelocateBuffer(
+            VKDeviceBuffer&&        srcBuffer,
+            VkBuffer                dstBuffer,
+            VkDeviceSize            size,
+            VKDeviceMemoryManager&  deviceMemoryMngr
+        );
+
         void WriteBuffer(VKDeviceBuffer& buffer, const void* data, VkDeviceSize size, VkDeviceSize offset = 0);
         void ReadBuffer(VKDeviceBuffer& buffer, void* data, VkDeviceSize size, VkDeviceSize offset = 0);
         void FlushMappedBuffer(VKDeviceBuffer& buffer, VkDeviceSize size = VK_WHOLE_SIZE, VkDeviceSize offset = 0);
@@ -102,18 +157,53 @@ class VKDevice
             return graphicsQueue_;
         }
 
+        // Returns the native VkQueue handle of the additional graphics family queue for asynchronous compute work or VK_NULL_HANDLE if the device has none.
+        inline VkQueue GetComputeVkQueue() const
+        {
+            return computeQueue_;
+        }
+
+        // Returns the native VkQueue handle of the additional graphics family queue for asynchronous copy work or VK_NULL_HANDLE if the device has none.
+        inline VkQueue GetCopyVkQueue() const
+        {
+            return copyQueue_;
+        }
+
+        // Returns the native VkQueue handle of the dedicated transfer queue or VK_NULL_HANDLE if the device has none.
+        inline VkQueue GetTransferVkQueue() const
+        {
+            return transferQueue_;
+        }
+
+        // Returns the optional features that have been enabled for this device.
+        inline const VKOptionalDeviceFeatures& GetOptionalFeatures() const
+        {
+            return optionalFeatures_;
+        }
+
         // Returns the native VkCommandPool handle.
         inline const VKPtr<VkCommandPool>& GetVkCommandPool() const
         {
             return commandPool_;
         }
 
+        // Returns the batcher that accumulates all transfer commands for the graphics and dedicated transfer queues.
+        inline VKUploadBatcher& GetUploadBatcher()
+        {
+            return *uploadBatcher_;
+        }
+
     private:
 
-        VKPtr<VkDevice>         device_;
-        QueueFamilyIndices      queueFamilyIndices_;
-        VkQueue                 graphicsQueue_      = VK_NULL_HANDLE;
-        VKPtr<VkCommandPool>    commandPool_;
+        VKPtr<VkDevice>                     device_;
+        QueueFamilyIndices                  queueFamilyIndices_;
+        VkQueue                             graphicsQueue_      = VK_NULL_HANDLE;
+        VkQueue                             computeQueue_       = VK_NULL_HANDLE;
+        VkQueue                             copyQueue_          = VK_NULL_HANDLE;
+        VkQueue                             transferQueue_      = VK_NULL_HANDLE;
+        VKPtr<VkCommandPool>                commandPool_;
+        std::unique_ptr<VKUploadBatcher>    uploadBatcher_;
+        VKOptionalDeviceFeatures            optionalFeatures_;
 
 };
 
@@ -13,6 +13,7 @@
 #include "../../Core/Vendor.h"
 #include "../../Core/Assertion.h"
 #include <LLGL/Constants.h>
+#include <LLGL/Utils/ForRange.h>
 #include <string>
 #include <cstring>
 #include <set>
@@ -26,11 +27,17 @@ namespace LLGL
 
 static const char* g_requiredVulkanExtensions[] =
 {
-    VK_KHR_SWAPCHAIN_EXTENSION_NAME,
     VK_KHR_MAINTENANCE1_EXTENSION_NAME,
     nullptr,
 };
 
+// Device extensions that are only required to present on a surface; These are optional in headless mode.
+static const char* g_presentationVulkanExtensions[] =
+{
+    VK_KHR_SWAPCHAIN_EXTENSION_NAME,
+    nullptr,
+};
+
 static bool CheckDeviceExtensionSupport(
     VkPhysicalDevice                    physicalDevice,
     const char* const*                  requiredExtensions,
@@ -55,7 +62,8 @@ static bool CheckDeviceExtensionSupport(
 
 static bool IsPhysicalDeviceSuitable(
     VkPhysicalDevice                    physicalDevice,
-    std::vector<VkExtensionProperties>& supportedExtensions)
+    std::vector<VkExtensionProperties>& supportedExtensions,
+    bool                                headless)
 {
     /* Check if physical devices supports at least these extensions */
     std::vector<VkExtensionProperties> extensions;
@@ -66,6 +74,16 @@ static bool IsPhysicalDeviceSuitable(
         extensions
     );
 
+    if (suitable && !headless)
+    {
+        suitable = CheckDeviceExtensionSupport(
+            physicalDevice,
+            g_presentationVulkanExtensions,
+            (sizeof(g_presentationVulkanExtensions) / sizeof(g_presentationVulkanExtensions[0]) - 1),
+            extensions
+        );
+    }
+
     if (suitable)
     {
         /* Store all supported extensions */
@@ -76,20 +94,26 @@ static bool IsPhysicalDeviceSuitable(
     return false;
 }
 
-bool VKPhysicalDevice::PickPhysicalDevice(VkInstance instance)
+bool VKPhysicalDevice::PickPhysicalDevice(VkInstance instance, bool headless, std::uint32_t deviceIndex)
 {
     /* Query all physical devices and pick suitable */
     std::vector<VkPhysicalDevice> physicalDevices = VKQueryPhysicalDevices(instance);
 
-    for (VkPhysicalDevice device : physicalDevices)
+    for_range(i, static_cast<std::uint32_t>(physicalDevices.size()))
     {
-        if (IsPhysicalDeviceSuitable(device, supportedExtensions_))
+        /* Only consider the explicitly selected device if an index was specified */
+        if (deviceIndex != ~0u && deviceIndex != i)
+            continue;
+
+        VkPhysicalDevice device = physicalDevices[i];
+        if (IsPhysicalDeviceSuitable(device, supportedExtensions_, headless))
         {
             /* Store reference to all extension names */
             for (const VkExtensionProperties& extension : supportedExtensions_)
                 supportedExtensionNames_.insert(extension.extensionName);
 
-            if (!EnableExtensions(g_requiredVulkanExtensions, true))
+            if (!EnableExtensions(g_requiredVulkanExtensions, true) ||
+                !EnableExtensions(g_presentationVulkanExtensions, !headless))
             {
                 /* Stop considering this physical device, because some required extensions are not supported */
                 supportedExtensionNames_.clear();
@@ -101,6 +125,7 @@ bool VKPhysicalDevice::PickPhysicalDevice(VkInstance instance)
             /* Store device and store properties */
             physicalDevice_ = device;
             QueryDeviceInfo();
+            QueryCalibrateableTimeDomains(instance);
 
             return true;
         }
@@ -177,9 +202,23 @@ static void GetVKPipelineCacheID(const VkPhysicalDeviceProperties& properties, s
     }
 }
 
+// Returns true if the device supports sparse 2D images that are bound on the graphics queue and whose residency can be queried in shaders.
+static bool IsSparseImage2DSupported(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceFeatures& features)
+{
+    if (features.sparseBinding == VK_FALSE || features.sparseResidencyImage2D == VK_FALSE || features.shaderResourceResidency == VK_FALSE)
+        return false;
+
+    const QueueFamilyIndices queueFamilyIndices = VKFindQueueFamilies(physicalDevice, (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT));
+    const std::vector<VkQueueFamilyProperties> queueFamilies = VKQueryQueueFamilyProperties(physicalDevice);
+    return
+    (
+        queueFamilyIndices.graphicsFamily < queueFamilies.size() &&
+        (queueFamilies[queueFamilyIndices.graphicsFamily].queueFlags & VK_QUEUE_SPARSE_BINDING_BIT) != 0
+    );
+}
+
 void VKPhysicalDevice::QueryDeviceProperties(
     RendererInfo&               info,
-    RenderingCapabilities&      caps,
     VKGraphicsPipelineLimits&   pipelineLimits)
 {
     /* Map properties to output renderer info */
@@ -189,6 +228,16 @@ void VKPhysicalDevice::QueryDeviceProperties(
     info.shadingLanguageName    = "SPIR-V";
     GetVKPipelineCacheID(properties_, info.pipelineCacheID);
 
+    /* Store graphics pipeline spcific limitations */
+    const VkPhysicalDeviceLimits& limits = properties_.limits;
+
+    pipelineLimits.lineWidthRange[0]    = limits.lineWidthRange[0];
+    pipelineLimits.lineWidthRange[1]    = limits.lineWidthRange[1];
+    pipelineLimits.lineWidthGranularity = limits.lineWidthGranularity;
+}
+
+void VKPhysicalDevice::QueryRenderingCaps(RenderingCapabilities& caps)
+{
     /* Map limits to output rendering capabilites */
     const VkPhysicalDeviceLimits& limits = properties_.limits;
 
@@ -222,16 +271,24 @@ void VKPhysicalDevice::QueryDeviceProperties(
     caps.features.hasTessellationShaders            = (features_.tessellationShader != VK_FALSE);
     caps.features.hasTessellatorStage               = caps.features.hasTessellationShaders;
     caps.features.hasComputeShaders                 = true;
+    caps.features.hasMeshShaders                    = optionalFeatures_.meshShader;
+    caps.features.hasRayTracing                     = optionalFeatures_.rayTracing;
     caps.features.hasInstancing                     = true;
     caps.features.hasOffsetInstancing               = true;
     caps.features.hasIndirectDrawing                = (features_.drawIndirectFirstInstance != VK_FALSE);
+    caps.features.hasIndirectDrawCount              = SupportsExtension(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME);
     caps.features.hasViewportArrays                 = (features_.multiViewport != VK_FALSE);
     caps.features.hasConservativeRasterization      = SupportsExtension(VK_EXT_CONSERVATIVE_RASTERIZATION_EXTENSION_NAME);
     caps.features.hasStreamOutputs                  = SupportsExtension(VK_EXT_TRANSFORM_FEEDBACK_EXTENSION_NAME);
     caps.features.hasLogicOp                        = (features_.logicOp != VK_FALSE);
     caps.features.hasPipelineStatistics             = (features_.pipelineStatisticsQuery != VK_FALSE);
     caps.features.hasRenderCondition                = SupportsExtension(VK_EXT_CONDITIONAL_RENDERING_EXTENSION_NAME);
+    caps.features.hasBufferRenderCondition          = caps.features.hasRenderCondition;
     caps.features.hasPipelineCaching                = true;
+    caps.features.hasSparseTextures                 = IsSparseImage2DSupported(physicalDevice_, features_);
+    caps.features.hasVariableRateShading            = optionalFeatures_.shadingRate;
+    caps.features.hasExtendedDynamicState           = optionalFeatures_.extDynamicState;
+    caps.features.hasTimestampCalibration           = (optionalFeatures_.hostTimeDomain && limits.timestampComputeAndGraphics != VK_FALSE);
 
     /* Query limits */
     caps.limits.lineWidthRange[0]                   = limits.lineWidthRange[0];
@@ -265,11 +322,6 @@ void VKPhysicalDevice::QueryDeviceProperties(
     caps.limits.maxStencilBufferSamples             = VKTypes::GetMaxVkSampleCounts(limits.framebufferStencilSampleCounts);
     caps.limits.maxNoAttachmentSamples              = VKTypes::GetMaxVkSampleCounts(limits.framebufferNoAttachmentsSampleCounts);
 
-    /* Store graphics pipeline spcific limitations */
-    pipelineLimits.lineWidthRange[0]    = limits.lineWidthRange[0];
-    pipelineLimits.lineWidthRange[1]    = limits.lineWidthRange[1];
-    pipelineLimits.lineWidthGranularity = limits.lineWidthGranularity;
-
     /*
     TODO: extension limits
     - VkPhysicalDeviceTransformFeedbackFeaturesEXT
@@ -293,7 +345,8 @@ VKDevice VKPhysicalDevice::CreateLogicalDevice(VkDevice customLogicalDevice)
             physicalDevice_,
             &features_,
             enabledExtensionNames_.data(),
-            static_cast<std::uint32_t>(enabledExtensionNames_.size())
+            static_cast<std::uint32_t>(enabledExtensionNames_.size()),
+            optionalFeatures_
         );
     }
     return device;
@@ -358,6 +411,9 @@ void VKPhysicalDevice::QueryDeviceInfo()
         vkGetPhysicalDeviceProperties(physicalDevice_, &properties_);
         vkGetPhysicalDeviceMemoryProperties(physicalDevice_, &memoryProperties_);
     }
+
+    /* Query optional features that must be enabled explicitly when the logical device is created */
+    QueryOptionalFeatures();
 }
 
 void VKPhysicalDevice::QueryDeviceFeaturesWithExtensions()
@@ -417,6 +473,242 @@ void VKPhysicalDevice::QueryDeviceMemoryPropertiesWithExtensions()
     vkGetPhysicalDeviceMemoryProperties(physicalDevice_, &memoryProperties_);
 }
 
+void VKPhysicalDevice::QueryOptionalFeatures()
+{
+    optionalFeatures_ = VKOptionalDeviceFeatures{};
+
+    /* Optional features can only be queried with vkGetPhysicalDeviceFeatures2 (Vulkan 1.1) */
+    if (properties_.apiVersion < VK_API_VERSION_1_1)
+    {
+        DisableExtension(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME);
+        DisableExtension(VK_KHR_FRAGMENT_SHADING_RATE_EXTENSION_NAME);
+        DisableExtension(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME);
+        DisableExtension(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME);
+        DisableRayTracingExtensions();
+        return;
+    }
+
+    VKBaseStructureInfo* currentDesc = nullptr;
+
+    auto ChainDescritpor = [&currentDesc](void* descPtr, VkStructureType type)
+    {
+        /* Chain next descriptor into previous one */
+        currentDesc->pNext = descPtr;
+
+        /* Write structure type and store next descriptor */
+        auto baseDescPtr = reinterpret_cast<VKBaseStructureInfo*>(descPtr);
+        {
+            baseDescPtr->sType = type;
+        }
+        currentDesc = baseDescPtr;
+    };
+
+    VkPhysicalDeviceFeatures2 featuresExt = {};
+    featuresExt.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+
+    currentDesc = reinterpret_cast<VKBaseStructureInfo*>(&featuresExt);
+
+    /* Present wait requires both VK_KHR_present_id and VK_KHR_present_wait */
+    VkPhysicalDevicePresentIdFeaturesKHR presentIdFeatures = {};
+    VkPhysicalDevicePresentWaitFeaturesKHR presentWaitFeatures = {};
+    const bool hasPresentWaitExt = (SupportsExtension(VK_KHR_PRESENT_ID_EXTENSION_NAME) && SupportsExtension(VK_KHR_PRESENT_WAIT_EXTENSION_NAME));
+    if (hasPresentWaitExt)
+    {
+        ChainDescritpor(&presentIdFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR);
+        ChainDescritpor(&presentWaitFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR);
+    }
+
+    /* Dynamic rendering depends on VK_KHR_depth_stencil_resolve, which is part of Vulkan 1.2 */
+    VkPhysicalDeviceDynamicRenderingFeaturesKHR dynamicRenderingFeatures = {};
+    const bool hasDynamicRenderingExt = (properties_.apiVersion >= VK_API_VERSION_1_2 && SupportsExtension(VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME));
+    if (hasDynamicRenderingExt)
+        ChainDescritpor(&dynamicRenderingFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES_KHR);
+
+    VkPhysicalDeviceTimelineSemaphoreFeaturesKHR timelineSemaphoreFeatures = {};
+    const bool hasTimelineSemaphoreExt = SupportsExtension(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
+    if (hasTimelineSemaphoreExt)
+        ChainDescritpor(&timelineSemaphoreFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR);
+
+    VkPhysicalDeviceSynchronization2FeaturesKHR synchronization2Features = {};
+    const bool hasSynchronization2Ext = SupportsExtension(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME);
+    if (hasSynchronization2Ext)
+        ChainDescritpor(&synchronization2Features, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES_KHR);
+
+    /* Descriptor indexing is part of Vulkan 1.2 core but also available as extension */
+    VkPhysicalDeviceDescriptorIndexingFeaturesEXT descriptorIndexingFeatures = {};
+    const bool hasDescriptorIndexingExt = (properties_.apiVersion >= VK_API_VERSION_1_2 || SupportsExtension(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME));
+    if (hasDescriptorIndexingExt)
+        ChainDescritpor(&descriptorIndexingFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT);
+
+    /* Mesh shaders require SPIR-V 1.4, which is part of Vulkan 1.2 */
+    VkPhysicalDeviceMeshShaderFeaturesEXT meshShaderFeatures = {};
+    const bool hasMeshShaderExt = (properties_.apiVersion >= VK_API_VERSION_1_2 && SupportsExtension(VK_EXT_MESH_SHADER_EXTENSION_NAME));
+    if (hasMeshShaderExt)
+        ChainDescritpor(&meshShaderFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_EXT);
+
+    /* Ray tracing requires acceleration structures, ray queries, and buffer device addresses (part of Vulkan 1.2) */
+    VkPhysicalDeviceBufferDeviceAddressFeaturesKHR bufferDeviceAddressFeatures = {};
+    VkPhysicalDeviceAccelerationStructureFeaturesKHR accelerationStructureFeatures = {};
+    VkPhysicalDeviceRayQueryFeaturesKHR rayQueryFeatures = {};
+    const bool hasRayTracingExt =
+    (
+        properties_.apiVersion >= VK_API_VERSION_1_2                            &&
+        SupportsExtension(VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME)          &&
+        SupportsExtension(VK_KHR_DEFERRED_HOST_OPERATIONS_EXTENSION_NAME)       &&
+        SupportsExtension(VK_KHR_ACCELERATION_STRUCTURE_EXTENSION_NAME)         &&
+        SupportsExtension(VK_KHR_RAY_QUERY_EXTENSION_NAME)
+    );
+    if (hasRayTracingExt)
+    {
+        ChainDescritpor(&bufferDeviceAddressFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES_KHR);
+        ChainDescritpor(&accelerationStructureFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ACCELERATION_STRUCTURE_FEATURES_KHR);
+        ChainDescritpor(&rayQueryFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_QUERY_FEATURES_KHR);
+    }
+
+    /* Pageable device local memory depends on VK_EXT_memory_priority */
+    VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT pageableMemoryFeatures = {};
+    const bool hasPageableMemoryExt = (SupportsExtension(VK_EXT_MEMORY_PRIORITY_EXTENSION_NAME) && SupportsExtension(VK_EXT_PAGEABLE_DEVICE_LOCAL_MEMORY_EXTENSION_NAME));
+    if (hasPageableMemoryExt)
+        ChainDescritpor(&pageableMemoryFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PAGEABLE_DEVICE_LOCAL_MEMORY_FEATURES_EXT);
+
+    /* Fragment shading rate depends on VK_KHR_create_renderpass2 */
+    VkPhysicalDeviceFragmentShadingRateFeaturesKHR shadingRateFeatures = {};
+    const bool hasShadingRateExt = (SupportsExtension(VK_KHR_CREATE_RENDERPASS_2_EXTENSION_NAME) && SupportsExtension(VK_KHR_FRAGMENT_SHADING_RATE_EXTENSION_NAME));
+    if (hasShadingRateExt)
+        ChainDescritpor(&shadingRateFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_FEATURES_KHR);
+
+    /* Graphics pipeline libraries depend on VK_KHR_pipeline_library */
+    VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT pipelineLibraryFeatures = {};
+    const bool hasPipelineLibraryExt = (SupportsExtension(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME) && SupportsExtension(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME));
+    if (hasPipelineLibraryExt)
+        ChainDescritpor(&pipelineLibraryFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT);
+
+    VkPhysicalDeviceExtendedDynamicStateFeaturesEXT extendedDynamicStateFeatures = {};
+    const bool hasExtendedDynamicStateExt = SupportsExtension(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME);
+    if (hasExtendedDynamicStateExt)
+        ChainDescritpor(&extendedDynamicStateFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT);
+
+    VkPhysicalDeviceHostQueryResetFeaturesEXT hostQueryResetFeatures = {};
+    const bool hasHostQueryResetExt = SupportsExtension(VK_EXT_HOST_QUERY_RESET_EXTENSION_NAME);
+    if (hasHostQueryResetExt)
+        ChainDescritpor(&hostQueryResetFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_QUERY_RESET_FEATURES_EXT);
+
+    if (!hasPresentWaitExt && !hasDynamicRenderingExt && !hasTimelineSemaphoreExt && !hasSynchronization2Ext && !hasDescriptorIndexingExt && !hasMeshShaderExt && !hasRayTracingExt && !hasPageableMemoryExt && !hasShadingRateExt && !hasPipelineLibraryExt && !hasExtendedDynamicStateExt && !hasHostQueryResetExt)
+    {
+        DisableExtension(VK_KHR_FRAGMENT_SHADING_RATE_EXTENSION_NAME);
+        DisableExtension(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME);
+        DisableExtension(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME);
+        DisableRayTracingExtensions();
+        return;
+    }
+
+    vkGetPhysicalDeviceFeatures2(physicalDevice_, &featuresExt);
+
+    optionalFeatures_.presentWait       = (hasPresentWaitExt && presentIdFeatures.presentId != VK_FALSE && presentWaitFeatures.presentWait != VK_FALSE);
+    optionalFeatures_.dynamicRendering  = (hasDynamicRenderingExt && dynamicRenderingFeatures.dynamicRendering != VK_FALSE);
+    optionalFeatures_.timelineSemaphore = (hasTimelineSemaphoreExt && timelineSemaphoreFeatures.timelineSemaphore != VK_FALSE);
+    optionalFeatures_.synchronization2  = (hasSynchronization2Ext && synchronization2Features.synchronization2 != VK_FALSE);
+    optionalFeatures_.bindlessResources =
+    (
+        hasDescriptorIndexingExt                                                             &&
+        descriptorIndexingFeatures.runtimeDescriptorArray                        != VK_FALSE &&
+        descriptorIndexingFeatures.descriptorBindingPartiallyBound               != VK_FALSE &&
+        descriptorIndexingFeatures.descriptorBindingUpdateUnusedWhilePending     != VK_FALSE &&
+        descriptorIndexingFeatures.descriptorBindingSampledImageUpdateAfterBind  != VK_FALSE &&
+        descriptorIndexingFeatures.descriptorBindingStorageImageUpdateAfterBind  != VK_FALSE &&
+        descriptorIndexingFeatures.descriptorBindingStorageBufferUpdateAfterBind != VK_FALSE
+    );
+    optionalFeatures_.bindlessUniforms  = (optionalFeatures_.bindlessResources && descriptorIndexingFeatures.descriptorBindingUniformBufferUpdateAfterBind != VK_FALSE);
+    optionalFeatures_.meshShader        = (hasMeshShaderExt && meshShaderFeatures.meshShader != VK_FALSE);
+    optionalFeatures_.taskShader        = (optionalFeatures_.meshShader && meshShaderFeatures.taskShader != VK_FALSE);
+    optionalFeatures_.pageableMemory    = (hasPageableMemoryExt && pageableMemoryFeatures.pageableDeviceLocalMemory != VK_FALSE);
+    optionalFeatures_.shadingRate       = (hasShadingRateExt && shadingRateFeatures.pipelineFragmentShadingRate != VK_FALSE);
+    optionalFeatures_.pipelineLibrary   = (hasPipelineLibraryExt && pipelineLibraryFeatures.graphicsPipelineLibrary != VK_FALSE);
+    optionalFeatures_.extDynamicState   = (hasExtendedDynamicStateExt && extendedDynamicStateFeatures.extendedDynamicState != VK_FALSE);
+    optionalFeatures_.hostQueryReset    = (hasHostQueryResetExt && hostQueryResetFeatures.hostQueryReset != VK_FALSE);
+    optionalFeatures_.rayTracing        =
+    (
+        hasRayTracingExt                                                &&
+        bufferDeviceAddressFeatures.bufferDeviceAddress     != VK_FALSE &&
+        accelerationStructureFeatures.accelerationStructure != VK_FALSE &&
+        rayQueryFeatures.rayQuery                           != VK_FALSE
+    );
+
+    /* Don't enable extensions without their features, so they are only registered if they can be used */
+    if (hasPageableMemoryExt && !optionalFeatures_.pageableMemory)
+        DisableExtension(VK_EXT_PAGEABLE_DEVICE_LOCAL_MEMORY_EXTENSION_NAME);
+    if (hasSynchronization2Ext && !optionalFeatures_.synchronization2)
+        DisableExtension(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME);
+    if (!optionalFeatures_.shadingRate)
+        DisableExtension(VK_KHR_FRAGMENT_SHADING_RATE_EXTENSION_NAME);
+    if (!optionalFeatures_.pipelineLibrary)
+        DisableExtension(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME);
+    if (!optionalFeatures_.extDynamicState)
+        DisableExtension(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME);
+    if (!optionalFeatures_.hostQueryReset)
+        DisableExtension(VK_EXT_HOST_QUERY_RESET_EXTENSION_NAME);
+    if (!optionalFeatures_.rayTracing)
+        DisableRayTracingExtensions();
+}
+
+/*
+Calibrated timestamps are only useful if the device time domain can be sampled together with the host clock of Timer::Tick().
+The time domains are queried with a physical device function, so it must be loaded from the instance.
+*/
+void VKPhysicalDevice::QueryCalibrateableTimeDomains(VkInstance instance)
+{
+    optionalFeatures_.hostTimeDomain = false;
+
+    const VkTimeDomainEXT hostTimeDomain = VKGetHostTimeDomain();
+    if (hostTimeDomain != VK_TIME_DOMAIN_DEVICE_EXT && SupportsExtension(VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME))
+    {
+        auto GetTimeDomains = reinterpret_cast<PFN_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT>(
+            vkGetInstanceProcAddr(instance, "vkGetPhysicalDeviceCalibrateableTimeDomainsEXT")
+        );
+        std::uint32_t numTimeDomains = 0;
+        if (GetTimeDomains != nullptr && GetTimeDomains(physicalDevice_, &numTimeDomains, nullptr) == VK_SUCCESS)
+        {
+            std::vector<VkTimeDomainEXT> timeDomains(numTimeDomains);
+            if (GetTimeDomains(physicalDevice_, &numTimeDomains, timeDomains.data()) == VK_SUCCESS)
+            {
+                const bool hasDeviceDomain  = (std::find(timeDomains.begin(), timeDomains.end(), VK_TIME_DOMAIN_DEVICE_EXT) != timeDomains.end());
+                const bool hasHostDomain    = (std::find(timeDomains.begin(), timeDomains.end(), hostTimeDomain) != timeDomains.end());
+                optionalFeatures_.hostTimeDomain = (hasDeviceDomain && hasHostDomain);
+            }
+        }
+    }
+
+    if (!optionalFeatures_.hostTimeDomain)
+        DisableExtension(VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME);
+}
+
+/*
+Buffer device addresses are only enabled together with ray tracing,
+since every device memory allocation must be flagged for device addresses once this extension is registered (see VKDeviceMemory).
+*/
+void VKPhysicalDevice::DisableRayTracingExtensions()
+{
+    DisableExtension(VK_KHR_RAY_QUERY_EXTENSION_NAME);
+    DisableExtension(VK_KHR_ACCELERATION_STRUCTURE_EXTENSION_NAME);
+    DisableExtension(VK_KHR_DEFERRED_HOST_OPERATIONS_EXTENSION_NAME);
+    DisableExtension(VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME);
+}
+
+void VKPhysicalDevice::DisableExtension(const char* extension)
+{
+    enabledExtensionNames_.erase(
+        std::remove_if(
+            enabledExtensionNames_.begin(),
+            enabledExtensionNames_.end(),
+            [extension](const char* name)
+            {
+                return (std::strcmp(name, extension) == 0);
+            }
+        ),
+        enabledExtensionNames_.end()
+    );
+}
+
 
 } // /namespace LLGL
 
@@ -30,18 +30,23 @@ class VKPhysicalDevice
 
         /* ----- Common ----- */
 
-        // Picks the physical Vulkan device by enumerating the available devices from the specified Vulkan instance.
-        bool PickPhysicalDevice(VkInstance instance);
+        /*
+        Picks the physical Vulkan device by enumerating the available devices from the specified Vulkan instance. Swap-chain support is not required in headless mode.
+        If 'deviceIndex' is not 0xFFFFFFFF, only the physical device with this index is considered (see RenderSystemDescriptor::adapterIndex).
+        */
+        bool PickPhysicalDevice(VkInstance instance, bool headless = false, std::uint32_t deviceIndex = ~0u);
 
         // Loads the physical Vulkan device from a custom native handle.
         void LoadPhysicalDeviceWeakRef(VkPhysicalDevice physicalDevice);
 
         void QueryDeviceProperties(
             RendererInfo&               info,
-            RenderingCapabilities&      caps,
             VKGraphicsPipelineLimits&   pipelineLimits
         );
 
+        // Maps the device features and limits to the rendering capabilities. This is separated from QueryDeviceProperties as it is only needed on demand.
+        void QueryRenderingCaps(RenderingCapabilities& caps);
+
         VKDevice CreateLogicalDevice(VkDevice customLogicalDevice = VK_NULL_HANDLE);
 
         std::uint32_t FindMemoryType(std::uint32_t memoryTypeBits, VkMemoryPropertyFlags properties) const;
@@ -49,6 +54,12 @@ class VKPhysicalDevice
         // Returns true if the specified Vulkan extension is supported by this physical device.
         bool SupportsExtension(const char* extension) const;
 
+        // Returns the optional features that are supported by this physical device and enabled when the logical device is created.
+        inline const VKOptionalDeviceFeatures& GetOptionalFeatures() const
+        {
+            return optionalFeatures_;
+        }
+
         /* ----- Handles ----- */
 
         // Returns the native VkPhysicalDevice handle.
@@ -102,10 +113,16 @@ class VKPhysicalDevice
 
         bool EnableExtensions(const char** extensions, bool required = false);
 
+        // Removes the specified extension from the list of enabled extensions, e.g. if its required features are not supported.
+        void DisableExtension(const char* extension);
+        void DisableRayTracingExtensions();
+
         void QueryDeviceInfo();
         void QueryDeviceFeaturesWithExtensions();
         void QueryDevicePropertiesWithExtensions();
         void QueryDeviceMemoryPropertiesWithExtensions();
+        void QueryOptionalFeatures();
+        void QueryCalibrateableTimeDomains(VkInstance instance);
 
     private:
 
@@ -122,6 +139,7 @@ class VKPhysicalDevice
 
         // Extension specific
         VkPhysicalDeviceConservativeRasterizationPropertiesEXT  conservRasterProps_         = {};
+        VKOptionalDeviceFeatures                                optionalFeatures_;
 
 };
 
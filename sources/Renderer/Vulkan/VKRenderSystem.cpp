@@ -11,20 +11,27 @@
 #include "Ext/VKExtensions.h"
 #include "Ext/VKExtensionRegistry.h"
 #include "Memory/VKDeviceMemory.h"
+#include "Buffer/VKAccelerationStructure.h"
 #include "../RenderSystemUtils.h"
 #include "../TextureUtils.h"
 #include "../CheckedCast.h"
 #include "../../Core/CoreUtils.h"
 #include "../../Core/Vendor.h"
+#include "../../Core/ImageUtils.h"
 #include "VKCore.h"
 #include "VKTypes.h"
 #include "VKInitializers.h"
+#include "Texture/VKImageUtils.h"
 #include "RenderState/VKPredicateQueryHeap.h"
 #include "RenderState/VKComputePSO.h"
 #include "Shader/VKShaderModulePool.h"
+#include "RenderState/VKHeapDescriptorSetPool.h"
+#include "RenderState/VKPipelineLibraryPool.h"
 #include "../../Platform/Debug.h"
+#include "../../Core/ProfileZone.h"
 #include <LLGL/ImageFlags.h>
 #include <limits>
+#include <mutex>
 
 #include <LLGL/Backend/Vulkan/NativeHandle.h>
 
@@ -35,7 +42,8 @@ namespace LLGL
 
 VKRenderSystem::VKRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
     instance_          { vkDestroyInstance                                                },
-    debugLayerEnabled_ { ((renderSystemDesc.flags & RenderSystemFlags::DebugDevice) != 0) }
+    debugLayerEnabled_ { ((renderSystemDesc.flags & RenderSystemFlags::DebugDevice) != 0) },
+    headless_          { ((renderSystemDesc.flags & RenderSystemFlags::Headless) != 0)    }
 {
     /* Extract optional renderer configuartion */
     auto* rendererConfigVK = GetRendererConfiguration<RendererConfigurationVulkan>(renderSystemDesc);
@@ -46,7 +54,7 @@ VKRenderSystem::VKRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
         instance_ = VKPtr<VkInstance>{ customNativeHandle->instance };
         if (debugLayerEnabled_)
             CreateDebugReportCallback();
-        VKLoadInstanceExtensions(instance_);
+        VKLoadInstanceExtensions(instance_, !headless_);
         if (!PickPhysicalDevice(customNativeHandle->physicalDevice))
             return;
         CreateLogicalDevice(customNativeHandle->device);
@@ -57,8 +65,8 @@ VKRenderSystem::VKRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
         CreateInstance(rendererConfigVK);
         if (debugLayerEnabled_)
             CreateDebugReportCallback();
-        VKLoadInstanceExtensions(instance_);
-        if (!PickPhysicalDevice())
+        VKLoadInstanceExtensions(instance_, !headless_);
+        if (!PickPhysicalDevice(VK_NULL_HANDLE, renderSystemDesc.adapterIndex))
             return;
         CreateLogicalDevice();
     }
@@ -66,19 +74,40 @@ VKRenderSystem::VKRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
     /* Create default resources */
     VKPipelineLayout::CreateDefault(device_);
 
+    /* Use push descriptors for dynamic resource bindings if requested and supported */
+    pushDescriptorsEnabled_ = (rendererConfigVK != nullptr && rendererConfigVK->enablePushDescriptors && HasExtension(VKExt::KHR_push_descriptor));
+
+    /* Use dynamic rendering instead of native render passes and framebuffers if requested and supported */
+    dynamicRenderingEnabled_ =
+    (
+        rendererConfigVK != nullptr                     &&
+        rendererConfigVK->enableDynamicRendering        &&
+        device_.GetOptionalFeatures().dynamicRendering  &&
+        HasExtension(VKExt::KHR_dynamic_rendering)
+    );
+
     /* Create device memory manager */
     deviceMemoryMngr_ = MakeUnique<VKDeviceMemoryManager>(
         device_,
+        physicalDevice_.GetVkPhysicalDevice(),
         physicalDevice_.GetMemoryProperties(),
-        (rendererConfigVK != nullptr ? rendererConfigVK->minDeviceMemoryAllocationSize : 1024*1024),
-        (rendererConfigVK != nullptr ? rendererConfigVK->reduceDeviceMemoryFragmentation : false)
+        (rendererConfigVK != nullptr ? *rendererConfigVK : RendererConfigurationVulkan{})
     );
+
+    /* Create global descriptor set for bindless descriptors */
+    if (rendererConfigVK != nullptr && rendererConfigVK->enableBindlessDescriptors)
+        CreateBindlessDescriptorSet(*rendererConfigVK);
 }
 
 VKRenderSystem::~VKRenderSystem()
 {
+    /* Release deferred staging buffers while the device memory manager is still alive */
+    device_.FlushUploads(true);
     device_.WaitIdle();
+    bindlessSet_.reset();
     VKShaderModulePool::Get().Clear();
+    VKHeapDescriptorSetPool::Get().Clear();
+    VKPipelineLibraryPool::Get().Clear();
     VKPipelineLayout::ReleaseDefault();
 }
 
@@ -86,7 +115,14 @@ VKRenderSystem::~VKRenderSystem()
 
 SwapChain* VKRenderSystem::CreateSwapChain(const SwapChainDescriptor& swapChainDesc, const std::shared_ptr<Surface>& surface)
 {
-    return swapChains_.emplace<VKSwapChain>(instance_, physicalDevice_, device_, *deviceMemoryMngr_, swapChainDesc, surface);
+    if (headless_)
+    {
+        GetMutableReport().Errorf("cannot create swap-chain for headless Vulkan render system");
+        return nullptr;
+    }
+
+    const bool presentWaitEnabled = (device_.GetOptionalFeatures().presentWait && HasExtension(VKExt::KHR_present_wait));
+    return swapChains_.emplace<VKSwapChain>(instance_, physicalDevice_, device_, *deviceMemoryMngr_, swapChainDesc, surface, presentWaitEnabled, dynamicRenderingEnabled_);
 }
 
 void VKRenderSystem::Release(SwapChain& swapChain)
@@ -101,11 +137,36 @@ CommandQueue* VKRenderSystem::GetCommandQueue()
     return commandQueue_.get();
 }
 
+CommandQueue* VKRenderSystem::GetCommandQueue(long queueFlags)
+{
+    if ((queueFlags & CommandQueueFlags::Graphics) != 0)
+        return commandQueue_.get();
+
+    /* Create asynchronous compute and copy queues on demand */
+    if (queueFlags == CommandQueueFlags::Copy && device_.GetCopyVkQueue() != VK_NULL_HANDLE)
+    {
+        if (!copyCommandQueue_)
+            copyCommandQueue_ = MakeUnique<VKCommandQueue>(device_, device_.GetCopyVkQueue(), physicalDevice_.GetProperties().limits.timestampPeriod, /*isPrimary:*/ false);
+        return copyCommandQueue_.get();
+    }
+
+    /* Copy work falls back to the compute queue if there is no separate queue for it */
+    if ((queueFlags & (CommandQueueFlags::Compute | CommandQueueFlags::Copy)) != 0 && device_.GetComputeVkQueue() != VK_NULL_HANDLE)
+    {
+        if (!computeCommandQueue_)
+            computeCommandQueue_ = MakeUnique<VKCommandQueue>(device_, device_.GetComputeVkQueue(), physicalDevice_.GetProperties().limits.timestampPeriod, /*isPrimary:*/ false);
+        return computeCommandQueue_.get();
+    }
+
+    return commandQueue_.get();
+}
+
 /* ----- Command buffers ----- */
 
 CommandBuffer* VKRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& commandBufferDesc)
 {
-    return commandBuffers_.emplace<VKCommandBuffer>(physicalDevice_, device_, device_.GetVkQueue(), device_.GetQueueFamilyIndices(), commandBufferDesc);
+    VKCommandQueue* commandQueueVK = (commandBufferDesc.commandQueue != nullptr ? LLGL_CAST(VKCommandQueue*, commandBufferDesc.commandQueue) : commandQueue_.get());
+    return commandBuffers_.emplace<VKCommandBuffer>(physicalDevice_, device_, *commandQueueVK, device_.GetQueueFamilyIndices(), commandBufferDesc);
 }
 
 void VKRenderSystem::Release(CommandBuffer& commandBuffer)
@@ -127,6 +188,9 @@ Buffer* VKRenderSystem::CreateBuffer(const BufferDescriptor& bufferDesc, const v
 {
     RenderSystem::AssertCreateBuffer(bufferDesc, static_cast<uint64_t>(std::numeric_limits<VkDeviceSize>::max()));
 
+    if ((bufferDesc.miscFlags & MiscFlags::Readback) != 0 || (bufferDesc.cpuAccessFlags != 0 && (bufferDesc.miscFlags & MiscFlags::PersistentMapping) != 0))
+        return CreateHostVisibleBuffer(bufferDesc, initialData);
+
     /* Create staging buffer */
     VkBufferCreateInfo stagingCreateInfo;
     BuildVkBufferCreateInfo(
@@ -135,32 +199,42 @@ Buffer* VKRenderSystem::CreateBuffer(const BufferDescriptor& bufferDesc, const v
         GetStagingVkBufferUsageFlags(bufferDesc.cpuAccessFlags)
     );
 
-    VKDeviceBuffer stagingBuffer = CreateStagingBufferAndInitialize(stagingCreateInfo, initialData, bufferDesc.size);
+    /* Staging buffers that are kept for CPU access must not pin transient memory chunks */
+    const bool keepStagingBuffer = (bufferDesc.cpuAccessFlags != 0 || (bufferDesc.miscFlags & MiscFlags::DynamicUsage) != 0);
+
+    VKDeviceBuffer stagingBuffer = CreateStagingBufferAndInitialize(stagingCreateInfo, initialData, bufferDesc.size, /*transient:*/ !keepStagingBuffer);
 
     /* Create primary buffer object */
     VKBuffer* bufferVK = buffers_.emplace<VKBuffer>(device_, bufferDesc);
 
     /* Allocate device memory */
-    VKDeviceMemoryRegion* memoryRegion = deviceMemoryMngr_->Allocate(
+    VKDeviceMemoryRegion* memoryRegion = deviceMemoryMngr_->AllocateBuffer(
+        bufferVK->GetVkBuffer(),
         bufferVK->GetDeviceBuffer().GetRequirements(),
         VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
     );
     bufferVK->BindMemoryRegion(device_, memoryRegion);
 
+    /* Allow buffer to be moved by incremental defragmentation */
+    if (bufferVK->IsRelocatable() && deviceMemoryMngr_->IsDefragmentationEnabled())
+        bufferVK->GetDeviceBuffer().EnableRelocation();
+
     /* Copy staging buffer into hardware buffer */
-    device_.CopyBuffer(stagingBuffer.GetVkBuffer(), bufferVK->GetVkBuffer(), static_cast<VkDeviceSize>(bufferDesc.size));
+    device_.UploadBuffer(stagingBuffer.GetVkBuffer(), bufferVK->GetVkBuffer(), static_cast<VkDeviceSize>(bufferDesc.size), 0, 0, true);
 
-    if (bufferDesc.cpuAccessFlags != 0 || (bufferDesc.miscFlags & MiscFlags::DynamicUsage) != 0)
+    if (keepStagingBuffer)
     {
         /* Store ownership of staging buffer */
         bufferVK->TakeStagingBuffer(std::move(stagingBuffer));
     }
     else
     {
-        /* Release staging buffer */
-        stagingBuffer.ReleaseMemoryRegion(*deviceMemoryMngr_);
+        /* Release staging buffer once the batched copy has completed */
+        device_.GetUploadBatcher().DeferRelease(std::move(stagingBuffer), *deviceMemoryMngr_);
     }
 
+    CreateBindlessDescriptors(*bufferVK, bufferDesc.bindFlags);
+
     return bufferVK;
 }
 
@@ -174,6 +248,11 @@ void VKRenderSystem::Release(Buffer& buffer)
 {
     /* Release device memory regions for primary buffer and internal staging buffer, then release buffer object */
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+    if (device_.HasPendingUploads())
+        device_.FlushUploads(true);
+    InvalidateDescriptorCaches(VKDescriptorCache::GetResourceKey(bufferVK.GetVkBuffer()));
+    ReleaseBindlessDescriptors(buffer);
+    bufferVK.ReleasePersistentMapping(device_);
     bufferVK.GetDeviceBuffer().ReleaseMemoryRegion(*deviceMemoryMngr_);
     bufferVK.GetStagingDeviceBuffer().ReleaseMemoryRegion(*deviceMemoryMngr_);
     buffers_.erase(&buffer);
@@ -186,15 +265,18 @@ void VKRenderSystem::Release(BufferArray& bufferArray)
 
 void VKRenderSystem::WriteBuffer(Buffer& buffer, std::uint64_t offset, const void* data, std::uint64_t dataSize)
 {
+    LLGL_PROFILE_ZONE("WriteBuffer");
+
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
 
-    if (bufferVK.GetStagingVkBuffer() != VK_NULL_HANDLE)
+    /* Only write into the buffer's own staging memory if no pending transfer can still read from it */
+    if (bufferVK.GetStagingVkBuffer() != VK_NULL_HANDLE && !device_.HasPendingUploads())
     {
         /* Copy input data to staging buffer memory */
         device_.WriteBuffer(bufferVK.GetStagingDeviceBuffer(), data, dataSize, offset);
 
         /* Copy staging buffer into hardware buffer */
-        device_.CopyBuffer(bufferVK.GetStagingVkBuffer(), bufferVK.GetVkBuffer(), dataSize, offset, offset);
+        device_.UploadBuffer(bufferVK.GetStagingVkBuffer(), bufferVK.GetVkBuffer(), dataSize, offset, offset);
     }
     else
     {
@@ -209,10 +291,10 @@ void VKRenderSystem::WriteBuffer(Buffer& buffer, std::uint64_t offset, const voi
         VKDeviceBuffer stagingBuffer = CreateStagingBufferAndInitialize(stagingCreateInfo, data, dataSize);
 
         /* Copy staging buffer into hardware buffer */
-        device_.CopyBuffer(stagingBuffer.GetVkBuffer(), bufferVK.GetVkBuffer(), dataSize, 0, offset);
+        device_.UploadBuffer(stagingBuffer.GetVkBuffer(), bufferVK.GetVkBuffer(), dataSize, 0, offset);
 
-        /* Release device memory region of staging buffer */
-        stagingBuffer.ReleaseMemoryRegion(*deviceMemoryMngr_);
+        /* Release device memory region of staging buffer once the batched copy has completed */
+        device_.GetUploadBatcher().DeferRelease(std::move(stagingBuffer), *deviceMemoryMngr_);
     }
 }
 
@@ -220,10 +302,20 @@ void VKRenderSystem::ReadBuffer(Buffer& buffer, std::uint64_t offset, void* data
 {
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
 
-    if (bufferVK.GetStagingVkBuffer() != VK_NULL_HANDLE)
+    if (bufferVK.IsHostVisible())
+    {
+        /* Pending transfers might still write into a persistently mapped buffer */
+        if (bufferVK.IsPersistent() && device_.HasPendingUploads())
+            device_.FlushUploads(true);
+
+        /* Copy host visible memory of readback or persistent buffer to output data */
+        device_.ReadBuffer(bufferVK.GetDeviceBuffer(), data, dataSize, offset);
+    }
+    else if (bufferVK.GetStagingVkBuffer() != VK_NULL_HANDLE)
     {
         /* Copy hardware buffer into staging buffer */
         device_.CopyBuffer(bufferVK.GetVkBuffer(), bufferVK.GetStagingVkBuffer(), dataSize, offset, offset);
+        device_.FlushUploads(true);
 
         /* Copy staging buffer memory to output data */
         device_.ReadBuffer(bufferVK.GetStagingDeviceBuffer(), data, dataSize, offset);
@@ -242,6 +334,7 @@ void VKRenderSystem::ReadBuffer(Buffer& buffer, std::uint64_t offset, void* data
 
         /* Copy hardware buffer into staging buffer */
         device_.CopyBuffer(bufferVK.GetVkBuffer(), stagingBuffer.GetVkBuffer(), dataSize, offset, 0);
+        device_.FlushUploads(true);
 
         /* Copy staging buffer memory to output data */
         device_.ReadBuffer(stagingBuffer, data, dataSize, 0);
@@ -302,7 +395,17 @@ Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
     const void* initialData = nullptr;
     DynamicByteArray intermediateData;
 
-    if (initialImage != nullptr)
+    /*
+    Sparse textures have no device memory yet except for the MIP-map tail and memoryless textures cannot be used for transfers,
+    so neither of them are ever initialized
+    */
+    const bool isUninitialized = ((textureDesc.miscFlags & (MiscFlags::Sparse | MiscFlags::Memoryless)) != 0);
+
+    if (isUninitialized)
+    {
+        /* Ignore initial image data */
+    }
+    else if (initialImage != nullptr)
     {
         /* Check if image data must be converted */
         const auto& formatAttribs = GetFormatAttribs(textureDesc.format);
@@ -311,6 +414,11 @@ Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
             /* Convert image format (will be null if no conversion is necessary) */
             intermediateData = ConvertImageBuffer(*initialImage, formatAttribs.format, formatAttribs.dataType, LLGL_MAX_THREAD_COUNT);
         }
+        else
+        {
+            /* Compress uncompressed image data (e.g. from RGBA to BC1) on the CPU (will be null if no compression is necessary) */
+            intermediateData = CompressTextureImageData(textureDesc.format, *initialImage, textureDesc.extent, textureDesc.arrayLayers);
+        }
 
         if (intermediateData)
         {
@@ -347,6 +455,9 @@ Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
     /* Create device texture */
     VKTexture* textureVK = textures_.emplace<VKTexture>(device_, *deviceMemoryMngr_, textureDesc);
 
+    if (VKSparseImageMemory* sparseMemory = textureVK->GetSparseMemory())
+        sparseMemory->BindMipTail(*commandQueue_);
+
     if (initialData != nullptr)
     {
         /* Create staging buffer */
@@ -359,10 +470,25 @@ Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
 
         VKDeviceBuffer stagingBuffer = CreateStagingBufferAndInitialize(stagingCreateInfo, initialData, initialDataSize);
 
-        /* Copy staging buffer into hardware texture, then transfer image into sampling-ready state */
-        VkCommandBuffer cmdBuffer = AllocCommandBuffer();
+        const TextureSubresource subresource{ 0, textureVK->GetNumArrayLayers(), 0, textureVK->GetNumMipLevels() };
+        const bool generateMips = (initialImage != nullptr && MustGenerateMipsOnCreate(textureDesc));
+
+        if (!generateMips && device_.GetUploadBatcher().IsTransferQueueUpload(initialDataSize))
+        {
+            /* Copy staging buffer into hardware texture on the dedicated transfer queue; MIP-map generation requires the graphics queue */
+            CopyBufferToImageOnTransferQueue(
+                *textureVK,
+                stagingBuffer.GetVkBuffer(),
+                VkOffset3D{ 0, 0, 0 },
+                textureVK->GetVkExtent(),
+                subresource,
+                VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
+            );
+        }
+        else
         {
-            const TextureSubresource subresource{ 0, textureVK->GetNumArrayLayers(), 0, textureVK->GetNumMipLevels() };
+            /* Copy staging buffer into hardware texture, then transfer image into sampling-ready state */
+            BeginUploadCommands();
 
             textureVK->TransitionImageLayout(context_, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, true);
 
@@ -378,7 +504,7 @@ Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
             textureVK->TransitionImageLayout(context_, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, true);
 
             /* Generate MIP-maps if enabled */
-            if (initialImage != nullptr && MustGenerateMipsOnCreate(textureDesc))
+            if (generateMips)
             {
                 context_.GenerateMips(
                     textureVK->GetVkImage(),
@@ -388,10 +514,7 @@ Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
                 );
             }
         }
-        FlushCommandBuffer(cmdBuffer);
-
-        /* Release staging buffer */
-        stagingBuffer.ReleaseMemoryRegion(*deviceMemoryMngr_);
+        EndUploadCommands(std::move(stagingBuffer), initialDataSize);
     }
     else
     {
@@ -399,17 +522,18 @@ Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
         const VkImageLayout initialLayout = FindOptimalInitialVkImageLayout(textureDesc.format, textureDesc.bindFlags);
         if (initialLayout != VK_IMAGE_LAYOUT_UNDEFINED)
         {
-            VkCommandBuffer cmdBuffer = AllocCommandBuffer();
+            BeginUploadCommands();
             {
                 textureVK->TransitionImageLayout(context_, initialLayout, true);
             }
-            FlushCommandBuffer(cmdBuffer);
         }
     }
 
     /* Create primary image view for texture */
     textureVK->CreateInternalImageView(device_);
 
+    CreateBindlessDescriptors(*textureVK, textureDesc.bindFlags);
+
     return textureVK;
 }
 
@@ -417,12 +541,18 @@ void VKRenderSystem::Release(Texture& texture)
 {
     /* Release device memory region, then release texture object */
     auto& textureVK = LLGL_CAST(VKTexture&, texture);
+    if (device_.HasPendingUploads())
+        device_.FlushUploads(true);
+    InvalidateDescriptorCaches(VKDescriptorCache::GetResourceKey(textureVK.GetVkImageView()));
+    ReleaseBindlessDescriptors(texture);
     deviceMemoryMngr_->Release(textureVK.GetMemoryRegion());
     textures_.erase(&texture);
 }
 
 void VKRenderSystem::WriteTexture(Texture& texture, const TextureRegion& textureRegion, const ImageView& srcImageView)
 {
+    LLGL_PROFILE_ZONE("WriteTexture");
+
     auto& textureVK = LLGL_CAST(VKTexture&, texture);
 
     /* Determine size of image for staging buffer */
@@ -433,38 +563,25 @@ void VKRenderSystem::WriteTexture(Texture& texture, const TextureRegion& texture
 
     VkImage                     image           = textureVK.GetVkImage();
     const std::uint32_t         imageSize       = extent.width * extent.height * extent.depth * subresource.numArrayLayers;
-    const void*                 imageData       = nullptr;
     const VkDeviceSize          imageDataSize   = static_cast<VkDeviceSize>(GetMemoryFootprint(format, imageSize));
 
     /* Check if image data must be converted */
-    DynamicByteArray intermediateData;
-
     const auto& formatAttribs = GetFormatAttribs(format);
-    if (formatAttribs.bitSize > 0 && (formatAttribs.flags & FormatFlags::IsCompressed) == 0)
-    {
-        /* Convert image format (will be null if no conversion is necessary) */
-        intermediateData = ConvertImageBuffer(srcImageView, formatAttribs.format, formatAttribs.dataType, LLGL_MAX_THREAD_COUNT);
-    }
+    const bool needsConversion =
+    (
+        formatAttribs.bitSize > 0 &&
+        (formatAttribs.flags & FormatFlags::IsCompressed) == 0 &&
+        (formatAttribs.format != srcImageView.format || formatAttribs.dataType != srcImageView.dataType)
+    );
 
-    if (intermediateData)
-    {
-        /*
-        Validate that source image data was large enough so conversion is valid,
-        then use temporary image buffer as source for initial data
-        */
-        const std::size_t srcImageDataSize = GetMemoryFootprint(srcImageView.format, srcImageView.dataType, imageSize);
-        RenderSystem::AssertImageDataSize(srcImageView.dataSize, srcImageDataSize);
-        imageData = intermediateData.get();
-    }
+    /* Check if uncompressed image data must be compressed (e.g. from RGBA to BC1) on the CPU */
+    const DynamicByteArray compressedData = CompressTextureImageData(format, srcImageView, extent, subresource.numArrayLayers);
+
+    /* Validate that source image data is large enough */
+    if (needsConversion || compressedData)
+        RenderSystem::AssertImageDataSize(srcImageView.dataSize, GetMemoryFootprint(srcImageView.format, srcImageView.dataType, imageSize));
     else
-    {
-        /*
-        Validate that image data is large enough,
-        then use input data as source for initial data
-        */
         RenderSystem::AssertImageDataSize(srcImageView.dataSize, static_cast<std::size_t>(imageDataSize));
-        imageData = srcImageView.data;
-    }
 
     /* Create staging buffer */
     VkBufferCreateInfo stagingCreateInfo;
@@ -474,28 +591,57 @@ void VKRenderSystem::WriteTexture(Texture& texture, const TextureRegion& texture
         VK_BUFFER_USAGE_TRANSFER_SRC_BIT // <-- TODO: support read/write mapping //GetStagingVkBufferUsageFlags(bufferDesc.cpuAccessFlags)
     );
 
-    VKDeviceBuffer stagingBuffer = CreateStagingBufferAndInitialize(stagingCreateInfo, imageData, imageDataSize);
+    VKDeviceBuffer stagingBuffer = CreateStagingBuffer(stagingCreateInfo);
 
-    /* Copy staging buffer into hardware texture, then transfer image into sampling-ready state */
-    VkCommandBuffer cmdBuffer = AllocCommandBuffer();
+    /* Convert or copy image data directly into mapped staging buffer to avoid an intermediate image buffer */
+    if (void* stagingData = stagingBuffer.Map(device_, 0, imageDataSize))
     {
-        VkImageLayout oldLayout = textureVK.TransitionImageLayout(context_, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, subresource, true);
+        if (needsConversion)
+        {
+            const MutableImageView stagingImageView{ formatAttribs.format, formatAttribs.dataType, stagingData, static_cast<std::size_t>(imageDataSize) };
+            ConvertImageBufferBands(srcImageView, stagingImageView, extent.width, extent.height * extent.depth * subresource.numArrayLayers, nullptr, LLGL_MAX_THREAD_COUNT);
+        }
+        else if (compressedData)
+            CopyMemoryNonTemporal(stagingData, compressedData.get(), std::min(compressedData.size(), static_cast<std::size_t>(imageDataSize)));
+        else
+            CopyMemoryNonTemporal(stagingData, srcImageView.data, static_cast<std::size_t>(imageDataSize));
+        stagingBuffer.Unmap(device_);
+    }
 
-        context_.CopyBufferToImage(
+    VKUploadBatcher& uploadBatcher = device_.GetUploadBatcher();
+    if (uploadBatcher.IsTransferQueueUpload(imageDataSize) || uploadBatcher.IsImageAcquiredForTransfer(image))
+    {
+        /* Copy staging buffer into hardware texture on the dedicated transfer queue and keep the current image layout */
+        const VkImageLayout currentLayout = textureVK.GetVkImageLayout();
+        CopyBufferToImageOnTransferQueue(
+            textureVK,
             stagingBuffer.GetVkBuffer(),
-            image,
-            textureVK.GetVkFormat(),
             VkOffset3D{ offset.x, offset.y, offset.z },
             VkExtent3D{ extent.width, extent.height, extent.depth },
-            subresource
+            subresource,
+            (currentLayout != VK_IMAGE_LAYOUT_UNDEFINED ? currentLayout : VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL)
         );
-
-        textureVK.TransitionImageLayout(context_, oldLayout, subresource, true);
     }
-    FlushCommandBuffer(cmdBuffer);
+    else
+    {
+        /* Copy staging buffer into hardware texture, then transfer image into sampling-ready state */
+        BeginUploadCommands();
+        {
+            VkImageLayout oldLayout = textureVK.TransitionImageLayout(context_, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, subresource, true);
 
-    /* Release staging buffer */
-    stagingBuffer.ReleaseMemoryRegion(*deviceMemoryMngr_);
+            context_.CopyBufferToImage(
+                stagingBuffer.GetVkBuffer(),
+                image,
+                textureVK.GetVkFormat(),
+                VkOffset3D{ offset.x, offset.y, offset.z },
+                VkExtent3D{ extent.width, extent.height, extent.depth },
+                subresource
+            );
+
+            textureVK.TransitionImageLayout(context_, oldLayout, subresource, true);
+        }
+    }
+    EndUploadCommands(std::move(stagingBuffer), imageDataSize);
 }
 
 void VKRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureRegion, const MutableImageView& dstImageView)
@@ -518,8 +664,12 @@ void VKRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureR
     BuildVkBufferCreateInfo(stagingCreateInfo, imageDataSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
     VKDeviceBuffer stagingBuffer = CreateStagingBuffer(stagingCreateInfo);
 
-    /* Copy staging buffer into hardware texture, then transfer image into sampling-ready state */
-    VkCommandBuffer cmdBuffer = AllocCommandBuffer();
+    /* Image can only be accessed by the graphics queue once pending transfers on the dedicated transfer queue have been submitted */
+    if (device_.GetUploadBatcher().IsImageAcquiredForTransfer(image))
+        device_.FlushUploads();
+
+    /* Copy hardware texture into staging buffer and wait for all batched transfers to complete */
+    BeginUploadCommands();
     {
         VkImageLayout oldLayout = textureVK.TransitionImageLayout(context_, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, subresource, true);
 
@@ -534,7 +684,7 @@ void VKRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureR
 
         textureVK.TransitionImageLayout(context_, oldLayout, subresource, true);
     }
-    FlushCommandBuffer(cmdBuffer);
+    device_.FlushUploads(true);
 
     /* Map staging buffer to CPU memory space */
     if (VKDeviceMemoryRegion* region = stagingBuffer.GetMemoryRegion())
@@ -558,11 +708,21 @@ void VKRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureR
 
 Sampler* VKRenderSystem::CreateSampler(const SamplerDescriptor& samplerDesc)
 {
-    return samplers_.emplace<VKSampler>(device_, samplerDesc);
+    /* Samplers with identical descriptors share the same instance to stay within the device limit of sampler allocations */
+    VKSampler* samplerVK = samplers_.emplace(samplerDesc, device_, samplerDesc);
+    if (samplers_.use_count(samplerVK) == 1)
+        CreateBindlessDescriptors(*samplerVK, 0);
+    return samplerVK;
 }
 
 void VKRenderSystem::Release(Sampler& sampler)
 {
+    if (samplers_.use_count(&sampler) == 1)
+    {
+        auto& samplerVK = LLGL_CAST(VKSampler&, sampler);
+        InvalidateDescriptorCaches(VKDescriptorCache::GetResourceKey(samplerVK.GetVkSampler()));
+        ReleaseBindlessDescriptors(sampler);
+    }
     samplers_.erase(&sampler);
 }
 
@@ -588,7 +748,7 @@ std::uint32_t VKRenderSystem::WriteResourceHeap(ResourceHeap& resourceHeap, std:
 
 RenderPass* VKRenderSystem::CreateRenderPass(const RenderPassDescriptor& renderPassDesc)
 {
-    return renderPasses_.emplace<VKRenderPass>(device_, renderPassDesc);
+    return renderPasses_.emplace<VKRenderPass>(device_, renderPassDesc, dynamicRenderingEnabled_);
 }
 
 void VKRenderSystem::Release(RenderPass& renderPass)
@@ -600,7 +760,7 @@ void VKRenderSystem::Release(RenderPass& renderPass)
 
 RenderTarget* VKRenderSystem::CreateRenderTarget(const RenderTargetDescriptor& renderTargetDesc)
 {
-    return renderTargets_.emplace<VKRenderTarget>(device_, *deviceMemoryMngr_, renderTargetDesc);
+    return renderTargets_.emplace<VKRenderTarget>(device_, *deviceMemoryMngr_, renderTargetDesc, dynamicRenderingEnabled_);
 }
 
 void VKRenderSystem::Release(RenderTarget& renderTarget)
@@ -613,11 +773,25 @@ void VKRenderSystem::Release(RenderTarget& renderTarget)
 Shader* VKRenderSystem::CreateShader(const ShaderDescriptor& shaderDesc)
 {
     RenderSystem::AssertCreateShader(shaderDesc);
-    return shaders_.emplace<VKShader>(device_, shaderDesc);
+    return shaders_.emplace_concurrent<VKShader>(shadersMutex_, device_, shaderDesc);
+}
+
+std::uint32_t VKRenderSystem::CreateShaders(const ArrayView<ShaderDescriptor>& shaderDescs, Shader** outShaders)
+{
+    return CreateShaderBatch(
+        shaderDescs,
+        outShaders,
+        [this](const ShaderDescriptor& shaderDesc) -> Shader*
+        {
+            return CreateShader(shaderDesc);
+        },
+        /*concurrent:*/ true
+    );
 }
 
 void VKRenderSystem::Release(Shader& shader)
 {
+    std::lock_guard<std::mutex> guard{ shadersMutex_ };
     shaders_.erase(&shader);
 }
 
@@ -625,7 +799,7 @@ void VKRenderSystem::Release(Shader& shader)
 
 PipelineLayout* VKRenderSystem::CreatePipelineLayout(const PipelineLayoutDescriptor& pipelineLayoutDesc)
 {
-    return pipelineLayouts_.emplace<VKPipelineLayout>(device_, pipelineLayoutDesc);
+    return pipelineLayouts_.emplace(pipelineLayoutDesc, device_, pipelineLayoutDesc, pushDescriptorsEnabled_, bindlessSet_.get());
 }
 
 void VKRenderSystem::Release(PipelineLayout& pipelineLayout)
@@ -650,7 +824,10 @@ void VKRenderSystem::Release(PipelineCache& pipelineCache)
 
 PipelineState* VKRenderSystem::CreatePipelineState(const GraphicsPipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
 {
-    return pipelineStates_.emplace<VKGraphicsPSO>(
+    LLGL_PROFILE_ZONE("CreateGraphicsPipelineState");
+
+    return pipelineStates_.emplace_concurrent<VKGraphicsPSO>(
+        pipelineStatesMutex_,
         device_,
         (!swapChains_.empty() ? (*swapChains_.begin())->GetRenderPass() : nullptr),
         pipelineStateDesc,
@@ -661,11 +838,14 @@ PipelineState* VKRenderSystem::CreatePipelineState(const GraphicsPipelineDescrip
 
 PipelineState* VKRenderSystem::CreatePipelineState(const ComputePipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
 {
-    return pipelineStates_.emplace<VKComputePSO>(device_, pipelineStateDesc, pipelineCache);
+    LLGL_PROFILE_ZONE("CreateComputePipelineState");
+
+    return pipelineStates_.emplace_concurrent<VKComputePSO>(pipelineStatesMutex_, device_, pipelineStateDesc, pipelineCache);
 }
 
 void VKRenderSystem::Release(PipelineState& pipelineState)
 {
+    std::lock_guard<std::mutex> guard{ pipelineStatesMutex_ };
     pipelineStates_.erase(&pipelineState);
 }
 
@@ -688,7 +868,8 @@ void VKRenderSystem::Release(QueryHeap& queryHeap)
 
 Fence* VKRenderSystem::CreateFence()
 {
-    return fences_.emplace<VKFence>(device_);
+    const bool hasTimelineSemaphore = (device_.GetOptionalFeatures().timelineSemaphore && HasExtension(VKExt::KHR_timeline_semaphore));
+    return fences_.emplace<VKFence>(device_, hasTimelineSemaphore);
 }
 
 void VKRenderSystem::Release(Fence& fence)
@@ -711,6 +892,134 @@ bool VKRenderSystem::GetNativeHandle(void* nativeHandle, std::size_t nativeHandl
     return false;
 }
 
+std::uint32_t VKRenderSystem::QueryMemoryHeaps(MemoryHeapInfo* outHeapInfos, std::uint32_t maxNumHeaps)
+{
+    return deviceMemoryMngr_->QueryHeapBudgets(outHeapInfos, maxNumHeaps);
+}
+
+std::uint32_t VKRenderSystem::GetBindlessDescriptorIndex(const Resource& resource, long bindFlags)
+{
+    auto it = bindlessDescriptors_.find(&resource);
+    if (it == bindlessDescriptors_.end())
+        return LLGL_INVALID_SLOT;
+
+    /* Samplers only have a single descriptor */
+    if (resource.GetResourceType() == ResourceType::Sampler)
+        return it->second.srv;
+
+    switch (bindFlags)
+    {
+        case BindFlags::ConstantBuffer: return it->second.cbv;
+        case BindFlags::Sampled:        return it->second.srv;
+        case BindFlags::Storage:        return it->second.uav;
+        default:                        return LLGL_INVALID_SLOT;
+    }
+}
+
+bool VKRenderSystem::GetSparseTextureProperties(const Texture& texture, SparseTextureProperties& outProperties)
+{
+    auto& textureVK = LLGL_CAST(const VKTexture&, texture);
+    if (VKSparseImageMemory* sparseMemory = textureVK.GetSparseMemory())
+    {
+        sparseMemory->GetProperties(outProperties);
+        return true;
+    }
+    return false;
+}
+
+bool VKRenderSystem::CommitTextureTiles(Texture& texture, const TextureRegion& textureRegion, bool commit)
+{
+    auto& textureVK = LLGL_CAST(VKTexture&, texture);
+    if (VKSparseImageMemory* sparseMemory = textureVK.GetSparseMemory())
+        return sparseMemory->BindTiles(*commandQueue_, textureRegion, commit);
+    return false;
+}
+
+// Returns the device memory region of the specified buffer or texture, or null if the resource has no single memory region.
+static VKDeviceMemoryRegion* GetResourceMemoryRegion(Resource* resource)
+{
+    if (resource != nullptr)
+    {
+        if (resource->GetResourceType() == ResourceType::Buffer)
+            return LLGL_CAST(VKBuffer*, resource)->GetDeviceBuffer().GetMemoryRegion();
+        if (resource->GetResourceType() == ResourceType::Texture)
+            return LLGL_CAST(VKTexture*, resource)->GetMemoryRegion();
+    }
+    return nullptr;
+}
+
+bool VKRenderSystem::MakeResident(const ArrayView<Resource*>& resources)
+{
+    /* Evicted regions only have the lowest priority, i.e. the driver pages them in again on demand, so this cannot fail */
+    for (Resource* resource : resources)
+    {
+        if (VKDeviceMemoryRegion* region = GetResourceMemoryRegion(resource))
+        {
+            if (region->IsEvicted())
+                region->GetParentChunk()->SetRegionResidency(region, region->GetPriority(), false);
+        }
+    }
+    return true;
+}
+
+void VKRenderSystem::Evict(const ArrayView<Resource*>& resources)
+{
+    for (Resource* resource : resources)
+    {
+        if (VKDeviceMemoryRegion* region = GetResourceMemoryRegion(resource))
+        {
+            if (!region->IsEvicted())
+                region->GetParentChunk()->SetRegionResidency(region, region->GetPriority(), true);
+        }
+    }
+}
+
+bool VKRenderSystem::GetAccelerationStructureSizes(const AccelerationStructureBuildDescriptor& buildDesc, AccelerationStructureSizes& outSizes)
+{
+    if (!HasExtension(VKExt::KHR_acceleration_structure))
+        return false;
+
+    VKAccelerationStructureBuildInfo buildInfo;
+    VKConvertAccelerationStructureBuildInfo(device_, buildInfo, buildDesc, /*resolveBuffers:*/ false);
+
+    VkAccelerationStructureBuildSizesInfoKHR sizesInfo = {};
+    sizesInfo.sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_SIZES_INFO_KHR;
+    vkGetAccelerationStructureBuildSizesKHR(
+        device_,
+        VK_ACCELERATION_STRUCTURE_BUILD_TYPE_DEVICE_KHR,
+        &(buildInfo.buildInfo),
+        buildInfo.primitiveCounts.data(),
+        &sizesInfo
+    );
+
+    outSizes.accelerationStructureSize  = sizesInfo.accelerationStructureSize;
+    outSizes.buildScratchSize           = sizesInfo.buildScratchSize;
+    outSizes.updateScratchSize          = sizesInfo.updateScratchSize;
+    return true;
+}
+
+std::uint64_t VKRenderSystem::GetAccelerationStructureAddress(const Buffer& buffer)
+{
+    auto& bufferVK = LLGL_CAST(const VKBuffer&, buffer);
+    return bufferVK.GetAccelerationStructureAddress(device_);
+}
+
+
+/*
+ * ======= Protected: =======
+ */
+
+void VKRenderSystem::QueryDeferredRenderingCaps(RenderingCapabilities& outCaps)
+{
+    physicalDevice_.QueryRenderingCaps(outCaps);
+
+    /* Bindless descriptors are only available if the descriptor set has been created (see CreateBindlessDescriptorSet) */
+    outCaps.features.hasBindlessDescriptors = (bindlessSet_ != nullptr);
+
+    /* Subpasses require native render pass objects and are not available with dynamic rendering */
+    outCaps.features.hasSubpasses = !dynamicRenderingEnabled_;
+}
+
 
 /*
  * ======= Private: =======
@@ -747,6 +1056,7 @@ void VKRenderSystem::CreateInstance(const RendererConfigurationVulkan* config)
         (
             extSupport == VKExtSupport::Required ||
             extSupport == VKExtSupport::Optional ||
+            (!this->headless_ && extSupport == VKExtSupport::Presentation) ||
             (this->debugLayerEnabled_ && extSupport == VKExtSupport::DebugOnly)
         );
     };
@@ -881,7 +1191,7 @@ void VKRenderSystem::CreateDebugReportCallback()
     VKThrowIfFailed(result, "failed to create Vulkan debug report callback");
 }
 
-bool VKRenderSystem::PickPhysicalDevice(VkPhysicalDevice customPhysicalDevice)
+bool VKRenderSystem::PickPhysicalDevice(VkPhysicalDevice customPhysicalDevice, std::uint32_t adapterIndex)
 {
     /* Pick physical device with Vulkan support */
     if (customPhysicalDevice != VK_NULL_HANDLE)
@@ -889,24 +1199,22 @@ bool VKRenderSystem::PickPhysicalDevice(VkPhysicalDevice customPhysicalDevice)
         /* Load weak reference to custom native physical device */
         physicalDevice_.LoadPhysicalDeviceWeakRef(customPhysicalDevice);
     }
-    else if (!physicalDevice_.PickPhysicalDevice(instance_))
+    else if (!physicalDevice_.PickPhysicalDevice(instance_, headless_, adapterIndex))
     {
         GetMutableReport().Errorf("failed to find suitable Vulkan device");
         return false;
     }
 
-    /* Query and store rendering capabilities */
+    /* Query renderer info now, but defer rendering capabilities until they are requested */
     RendererInfo info;
-    RenderingCapabilities caps;
-
-    physicalDevice_.QueryDeviceProperties(info, caps, gfxPipelineLimits_);
+    physicalDevice_.QueryDeviceProperties(info, gfxPipelineLimits_);
 
     /* Store Vulkan extension names */
     const auto& extensions = physicalDevice_.GetExtensionNames();
     info.extensionNames = std::vector<std::string>(extensions.begin(), extensions.end());
 
     SetRendererInfo(info);
-    SetRenderingCaps(caps);
+    DeferRenderingCaps();
 
     return true;
 }
@@ -917,7 +1225,7 @@ void VKRenderSystem::CreateLogicalDevice(VkDevice customLogicalDevice)
     device_ = physicalDevice_.CreateLogicalDevice(customLogicalDevice);
 
     /* Create command queue interface */
-    commandQueue_ = MakeUnique<VKCommandQueue>(device_, device_.GetVkQueue());
+    commandQueue_ = MakeUnique<VKCommandQueue>(device_, device_.GetVkQueue(), physicalDevice_.GetProperties().limits.timestampPeriod);
 
     /* Load Vulkan device extensions */
     VKLoadDeviceExtensions(device_, physicalDevice_.GetExtensionNames());
@@ -943,24 +1251,74 @@ bool VKRenderSystem::IsLayerRequired(const char* name, const RendererConfigurati
     return false;
 }
 
-VKDeviceBuffer VKRenderSystem::CreateStagingBuffer(const VkBufferCreateInfo& createInfo)
+/*
+Returns true if the specified buffer is written by the CPU and read by the GPU, so it benefits from device local memory that is also host visible (e.g. with resizable BAR).
+CPU reads from such memory are uncached, so readback buffers and buffers with CPU read access remain in system memory.
+*/
+static bool IsDeviceLocalHostVisibleBufferCandidate(const BufferDescriptor& bufferDesc)
+{
+    const long copyBindFlags = (BindFlags::CopySrc | BindFlags::CopyDst);
+    return
+    (
+        (bufferDesc.miscFlags & MiscFlags::Readback) == 0 &&
+        (bufferDesc.cpuAccessFlags & CPUAccessFlags::Read) == 0 &&
+        (bufferDesc.bindFlags & ~copyBindFlags) != 0
+    );
+}
+
+VKBuffer* VKRenderSystem::CreateHostVisibleBuffer(const BufferDescriptor& bufferDesc, const void* initialData)
+{
+    /* Create buffer object and allocate host visible memory; copy commands and mapped CPU memory access it directly */
+    VKBuffer* bufferVK = buffers_.emplace<VKBuffer>(device_, bufferDesc);
+    const VkMemoryRequirements& requirements = bufferVK->GetDeviceBuffer().GetRequirements();
+
+    /* Place buffers that the GPU reads in device local memory if it is host visible and the budget of its heap permits */
+    VkMemoryPropertyFlags properties = (VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+    if (IsDeviceLocalHostVisibleBufferCandidate(bufferDesc) &&
+        deviceMemoryMngr_->FitsIntoHeapBudget(requirements.memoryTypeBits, properties | VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, requirements.size))
+    {
+        properties |= VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    }
+
+    VKDeviceMemoryRegion* memoryRegion = deviceMemoryMngr_->AllocateBuffer(
+        bufferVK->GetVkBuffer(),
+        requirements,
+        properties
+    );
+    bufferVK->BindMemoryRegion(device_, memoryRegion);
+
+    if (initialData != nullptr)
+        device_.WriteBuffer(bufferVK->GetDeviceBuffer(), initialData, static_cast<VkDeviceSize>(bufferDesc.size), 0);
+
+    return bufferVK;
+}
+
+VKDeviceBuffer VKRenderSystem::CreateStagingBuffer(const VkBufferCreateInfo& createInfo, bool transient)
 {
+    /* Share staging buffers between graphics and dedicated transfer queue, so they never need a queue family ownership transfer */
+    VkBufferCreateInfo sharedCreateInfo = createInfo;
+    sharedCreateInfo.queueFamilyIndexCount = device_.GetUploadBatcher().GetConcurrentQueueFamilyIndices(sharedCreateInfo.pQueueFamilyIndices);
+    if (sharedCreateInfo.queueFamilyIndexCount > 0)
+        sharedCreateInfo.sharingMode = VK_SHARING_MODE_CONCURRENT;
+
     return VKDeviceBuffer
     {
         device_,
-        createInfo,
+        sharedCreateInfo,
         *deviceMemoryMngr_,
-        (VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)
+        (VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT),
+        transient
     };
 }
 
 VKDeviceBuffer VKRenderSystem::CreateStagingBufferAndInitialize(
     const VkBufferCreateInfo&   createInfo,
     const void*                 data,
-    VkDeviceSize                dataSize)
+    VkDeviceSize                dataSize,
+    bool                        transient)
 {
     /* Allocate staging buffer */
-    VKDeviceBuffer stagingBuffer = CreateStagingBuffer(createInfo);
+    VKDeviceBuffer stagingBuffer = CreateStagingBuffer(createInfo, transient);
 
     /* Copy initial data to buffer memory */
     if (data != nullptr && dataSize > 0)
@@ -969,16 +1327,168 @@ VKDeviceBuffer VKRenderSystem::CreateStagingBufferAndInitialize(
     return stagingBuffer;
 }
 
-VkCommandBuffer VKRenderSystem::AllocCommandBuffer(bool begin)
+void VKRenderSystem::BeginUploadCommands()
+{
+    context_.Reset(device_.GetUploadBatcher().GetCommandBuffer());
+}
+
+void VKRenderSystem::EndUploadCommands(VKDeviceBuffer&& stagingBuffer, VkDeviceSize stagingSize)
 {
-    VkCommandBuffer cmdBuffer = device_.AllocCommandBuffer(begin);
-    context_.Reset(cmdBuffer);
-    return cmdBuffer;
+    VKUploadBatcher& uploadBatcher = device_.GetUploadBatcher();
+    uploadBatcher.DeferRelease(std::move(stagingBuffer), *deviceMemoryMngr_);
+    uploadBatcher.AddStagingSize(stagingSize);
+}
+
+void VKRenderSystem::CopyBufferToImageOnTransferQueue(
+    VKTexture&                  textureVK,
+    VkBuffer                    stagingBuffer,
+    const VkOffset3D&           offset,
+    const VkExtent3D&           extent,
+    const TextureSubresource&   subresource,
+    VkImageLayout               newLayout)
+{
+    VKUploadBatcher& uploadBatcher = device_.GetUploadBatcher();
+
+    /* Hand image over to transfer queue; layout state already reflects the layout after it has been handed back to the graphics queue */
+    uploadBatcher.AcquireImageForTransfer(
+        textureVK.GetVkImage(),
+        VKImageUtils::GetInclusiveVkImageAspect(textureVK.GetVkFormat()),
+        textureVK.GetVkImageLayout(),
+        newLayout
+    );
+    textureVK.SetVkImageLayout(newLayout);
+
+    context_.Reset(uploadBatcher.GetTransferCommandBuffer());
+    context_.CopyBufferToImage(stagingBuffer, textureVK.GetVkImage(), textureVK.GetVkFormat(), offset, extent, subresource);
+}
+
+void VKRenderSystem::InvalidateDescriptorCaches(std::uint64_t resourceHandle)
+{
+    for (const auto& entry : pipelineLayouts_)
+    {
+        if (VKDescriptorCache* descriptorCache = entry.object->GetDescriptorCache())
+            descriptorCache->InvalidateResource(resourceHandle);
+    }
+}
+
+void VKRenderSystem::CreateBindlessDescriptorSet(const RendererConfigurationVulkan& config)
+{
+    const VKOptionalDeviceFeatures& features = device_.GetOptionalFeatures();
+    if (!features.bindlessResources)
+        return;
+
+    bindlessSet_ = MakeUnique<VKBindlessDescriptorSet>(
+        physicalDevice_.GetVkPhysicalDevice(),
+        device_.GetVkDevice(),
+        config.numBindlessDescriptors,
+        config.numBindlessSamplers,
+        features.bindlessUniforms
+    );
+}
+
+void VKRenderSystem::CreateBindlessDescriptors(Resource& resource, long bindFlags)
+{
+    if (!bindlessSet_)
+        return;
+
+    BindlessDescriptors descriptors;
+
+    auto CheckDescriptor = [this](std::uint32_t index) -> std::uint32_t
+    {
+        if (index == LLGL_INVALID_SLOT)
+            GetMutableReport().Errorf("Vulkan bindless descriptor set has no descriptors left");
+        return index;
+    };
+
+    switch (resource.GetResourceType())
+    {
+        case ResourceType::Buffer:
+        {
+            auto& bufferVK = LLGL_CAST(VKBuffer&, resource);
+            if ((bindFlags & BindFlags::ConstantBuffer) != 0 && bindlessSet_->HasUniformBuffers())
+            {
+                descriptors.cbv = CheckDescriptor(
+                    bindlessSet_->WriteBuffer(VKBindlessDescriptorSet::Binding_UniformBuffers, bufferVK.GetVkBuffer(), bufferVK.GetSize())
+                );
+            }
+            if ((bindFlags & (BindFlags::Sampled | BindFlags::Storage)) != 0)
+            {
+                /* Read-only and read-write buffers share the same storage buffer descriptor */
+                const std::uint32_t index = CheckDescriptor(
+                    bindlessSet_->WriteBuffer(VKBindlessDescriptorSet::Binding_StorageBuffers, bufferVK.GetVkBuffer(), bufferVK.GetSize())
+                );
+                if ((bindFlags & BindFlags::Sampled) != 0)
+                    descriptors.srv = index;
+                if ((bindFlags & BindFlags::Storage) != 0)
+                    descriptors.uav = index;
+            }
+        }
+        break;
+
+        case ResourceType::Texture:
+        {
+            auto& textureVK = LLGL_CAST(VKTexture&, resource);
+            if ((bindFlags & BindFlags::Sampled) != 0)
+            {
+                descriptors.srv = CheckDescriptor(
+                    bindlessSet_->WriteImage(VKBindlessDescriptorSet::Binding_SampledImages, textureVK.GetVkImageView(), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL)
+                );
+            }
+            if ((bindFlags & BindFlags::Storage) != 0)
+            {
+                descriptors.uav = CheckDescriptor(
+                    bindlessSet_->WriteImage(VKBindlessDescriptorSet::Binding_StorageImages, textureVK.GetVkImageView(), VK_IMAGE_LAYOUT_GENERAL)
+                );
+            }
+        }
+        break;
+
+        case ResourceType::Sampler:
+        {
+            auto& samplerVK = LLGL_CAST(VKSampler&, resource);
+            descriptors.srv = CheckDescriptor(bindlessSet_->WriteSampler(samplerVK.GetVkSampler()));
+        }
+        break;
+
+        default:
+        break;
+    }
+
+    bindlessDescriptors_[&resource] = descriptors;
 }
 
-void VKRenderSystem::FlushCommandBuffer(VkCommandBuffer commandBuffer)
+void VKRenderSystem::ReleaseBindlessDescriptors(const Resource& resource)
 {
-    device_.FlushCommandBuffer(commandBuffer);
+    auto it = bindlessDescriptors_.find(&resource);
+    if (it == bindlessDescriptors_.end())
+        return;
+
+    const BindlessDescriptors& descriptors = it->second;
+
+    auto FreeDescriptor = [this](VKBindlessDescriptorSet::Binding binding, std::uint32_t index)
+    {
+        if (index != LLGL_INVALID_SLOT)
+            bindlessSet_->FreeDescriptor(binding, index);
+    };
+
+    switch (resource.GetResourceType())
+    {
+        case ResourceType::Buffer:
+            FreeDescriptor(VKBindlessDescriptorSet::Binding_UniformBuffers, descriptors.cbv);
+            FreeDescriptor(VKBindlessDescriptorSet::Binding_StorageBuffers, (descriptors.srv != LLGL_INVALID_SLOT ? descriptors.srv : descriptors.uav));
+            break;
+        case ResourceType::Texture:
+            FreeDescriptor(VKBindlessDescriptorSet::Binding_SampledImages, descriptors.srv);
+            FreeDescriptor(VKBindlessDescriptorSet::Binding_StorageImages, descriptors.uav);
+            break;
+        case ResourceType::Sampler:
+            FreeDescriptor(VKBindlessDescriptorSet::Binding_Samplers, descriptors.srv);
+            break;
+        default:
+            break;
+    }
+
+    bindlessDescriptors_.erase(it);
 }
 
 
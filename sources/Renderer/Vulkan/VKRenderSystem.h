@@ -13,6 +13,8 @@
 #include "VKPhysicalDevice.h"
 #include "VKDevice.h"
 #include "../ContainerTypes.h"
+#include "../PipelineLayoutCache.h"
+#include "../SamplerCache.h"
 #include "Memory/VKDeviceMemoryManager.h"
 
 #include "Command/VKCommandQueue.h"
@@ -36,12 +38,15 @@
 #include "RenderState/VKPipelineCache.h"
 #include "RenderState/VKGraphicsPSO.h"
 #include "RenderState/VKResourceHeap.h"
+#include "RenderState/VKBindlessDescriptorSet.h"
 
 #include <string>
 #include <memory>
 #include <vector>
 #include <set>
 #include <tuple>
+#include <unordered_map>
+#include <mutex>
 
 
 namespace LLGL
@@ -60,25 +65,67 @@ class VKRenderSystem final : public RenderSystem
         VKRenderSystem(const RenderSystemDescriptor& renderSystemDesc);
         ~VKRenderSystem();
 
+    protected:
+
+        void QueryDeferredRenderingCaps(RenderingCapabilities& outCaps) override;
+
     private:
 
         void CreateInstance(const RendererConfigurationVulkan* config);
         void CreateDebugReportCallback();
-        bool PickPhysicalDevice(VkPhysicalDevice customPhysicalDevice = VK_NULL_HANDLE);
+        bool PickPhysicalDevice(VkPhysicalDevice customPhysicalDevice = VK_NULL_HANDLE, std::uint32_t adapterIndex = ~0u);
         void CreateLogicalDevice(VkDevice customLogicalDevice = VK_NULL_HANDLE);
 
         bool IsLayerRequired(const char* name, const RendererConfigurationVulkan* config) const;
 
-        VKDeviceBuffer CreateStagingBuffer(const VkBufferCreateInfo& createInfo);
+        // Creates a buffer in host visible memory that is mapped directly, i.e. without a staging buffer (see MiscFlags::Readback and MiscFlags::PersistentMapping).
+        VKBuffer* CreateHostVisibleBuffer(const BufferDescriptor& bufferDesc, const void* initialData);
+
+        // Creates a host visible staging buffer. If 'transient' is true, its memory is allocated from a transient chunk and must be released shortly after.
+        VKDeviceBuffer CreateStagingBuffer(const VkBufferCreateInfo& createInfo, bool transient = true);
 
         VKDeviceBuffer CreateStagingBufferAndInitialize(
             const VkBufferCreateInfo&   createInfo,
             const void*                 data,
-            VkDeviceSize                dataSize
+            VkDeviceSize                dataSize,
+            bool                        transient   = true
+        );
+
+        // Resets the command context to record into the current upload batch.
+        void BeginUploadCommands();
+
+        // Hands the staging buffer over to the current upload batch, which submits once its staging threshold has been exceeded.
+        void EndUploadCommands(VKDeviceBuffer&& stagingBuffer, VkDeviceSize stagingSize);
+
+        // Records a copy from the staging buffer into the texture on the dedicated transfer queue. The texture is handed back to the graphics queue in the specified layout.
+        void CopyBufferToImageOnTransferQueue(
+            VKTexture&                  textureVK,
+            VkBuffer                    stagingBuffer,
+            const VkOffset3D&           offset,
+            const VkExtent3D&           extent,
+            const TextureSubresource&   subresource,
+            VkImageLayout               newLayout
         );
 
-        VkCommandBuffer AllocCommandBuffer(bool begin = true);
-        void FlushCommandBuffer(VkCommandBuffer commandBuffer);
+        // Releases all cached descriptor sets of all pipeline layouts that refer to the specified resource. See VKDescriptorCache::InvalidateResource.
+        void InvalidateDescriptorCaches(std::uint64_t resourceHandle);
+
+        // Creates the bindless descriptor set if it is requested and supported by the device.
+        void CreateBindlessDescriptorSet(const RendererConfigurationVulkan& config);
+
+        // Writes the descriptors with stable indices for the specified resource in bindless mode.
+        void CreateBindlessDescriptors(Resource& resource, long bindFlags);
+        void ReleaseBindlessDescriptors(const Resource& resource);
+
+    private:
+
+        // Stable descriptor indices of a resource in the bindless descriptor set. Buffers with Sampled and Storage binding share the same storage buffer descriptor.
+        struct BindlessDescriptors
+        {
+            std::uint32_t cbv = LLGL_INVALID_SLOT;
+            std::uint32_t srv = LLGL_INVALID_SLOT;
+            std::uint32_t uav = LLGL_INVALID_SLOT;
+        };
 
     private:
 
@@ -91,27 +138,37 @@ class VKRenderSystem final : public RenderSystem
         VKCommandContext                        context_;
 
         bool                                    debugLayerEnabled_      = false;
+        bool                                    headless_               = false;
         VKPtr<VkDebugReportCallbackEXT>         debugReportCallback_;
+        bool                                    pushDescriptorsEnabled_     = false;
+        bool                                    dynamicRenderingEnabled_    = false;
 
         std::unique_ptr<VKDeviceMemoryManager>  deviceMemoryMngr_;
 
         VKGraphicsPipelineLimits                gfxPipelineLimits_;
 
+        std::unique_ptr<VKBindlessDescriptorSet>                    bindlessSet_;
+        std::unordered_map<const Resource*, BindlessDescriptors>    bindlessDescriptors_;
+
         /* ----- Hardware object containers ----- */
 
         HWObjectContainer<VKSwapChain>          swapChains_;
         HWObjectInstance<VKCommandQueue>        commandQueue_;
+        HWObjectInstance<VKCommandQueue>        computeCommandQueue_;
+        HWObjectInstance<VKCommandQueue>        copyCommandQueue_;
         HWObjectContainer<VKCommandBuffer>      commandBuffers_;
         HWObjectContainer<VKBuffer>             buffers_;
-        HWObjectContainer<VKBufferArray>        bufferArrays_;
+        HWObjectPool<VKBufferArray>             bufferArrays_;
         HWObjectContainer<VKTexture>            textures_;
-        HWObjectContainer<VKSampler>            samplers_;
+        SamplerCache<VKSampler>                 samplers_;
         HWObjectContainer<VKRenderPass>         renderPasses_;
         HWObjectContainer<VKRenderTarget>       renderTargets_;
         HWObjectContainer<VKShader>             shaders_;
-        HWObjectContainer<VKPipelineLayout>     pipelineLayouts_;
+        std::mutex                              shadersMutex_;          // Shaders can be created and released concurrently.
+        PipelineLayoutCache<VKPipelineLayout>   pipelineLayouts_;
         HWObjectContainer<VKPipelineCache>      pipelineCaches_;
         HWObjectContainer<VKPipelineState>      pipelineStates_;
+        std::mutex                              pipelineStatesMutex_;   // PSOs can be created and released concurrently.
         HWObjectContainer<VKResourceHeap>       resourceHeaps_;
         HWObjectContainer<VKQueryHeap>          queryHeaps_;
         HWObjectContainer<VKFence>              fences_;
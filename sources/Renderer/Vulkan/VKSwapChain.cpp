@@ -8,16 +8,20 @@
 #include "VKSwapChain.h"
 #include "VKCore.h"
 #include "VKTypes.h"
+#include "Ext/VKExtensions.h"
 #include "Command/VKCommandContext.h"
 #include "Memory/VKDeviceMemoryManager.h"
 #include "Texture/VKImageUtils.h"
 #include "../TextureUtils.h"
 #include "../../Core/CoreUtils.h"
 #include "../../Core/Exception.h"
+#include "../../Core/ProfileZone.h"
 #include <LLGL/Platform/NativeHandle.h>
 #include <LLGL/Utils/ForRange.h>
+#include <LLGL/Container/SmallVector.h>
 #include <limits.h>
 #include <set>
+#include <algorithm>
 
 
 namespace LLGL
@@ -27,6 +31,9 @@ namespace LLGL
 /* ----- Common ----- */
 
 const std::uint32_t VKSwapChain::maxNumColorBuffers;
+const std::uint32_t VKSwapChain::maxNumFramesInFlight;
+const std::uint32_t VKSwapChain::defaultNumFramesInFlight;
+const std::uint64_t VKSwapChain::presentWaitTimeout;
 
 static VKPtr<VkImageView> NullVkImageView(VkDevice device)
 {
@@ -54,7 +61,9 @@ VKSwapChain::VKSwapChain(
     VkDevice                        device,
     VKDeviceMemoryManager&          deviceMemoryMngr,
     const SwapChainDescriptor&      desc,
-    const std::shared_ptr<Surface>& surface)
+    const std::shared_ptr<Surface>& surface,
+    bool                            presentWaitEnabled,
+    bool                            dynamicRendering)
 :
     SwapChain                { desc                            },
     instance_                { instance                        },
@@ -63,7 +72,7 @@ VKSwapChain::VKSwapChain(
     deviceMemoryMngr_        { deviceMemoryMngr                },
     surface_                 { instance, vkDestroySurfaceKHR   },
     swapChain_               { device, vkDestroySwapchainKHR   },
-    swapChainRenderPass_     { device                          },
+    swapChainRenderPass_     { device, dynamicRendering        },
     swapChainSamples_        { GetClampedSamples(desc.samples) },
     swapChainImageViews_     { NullVkImageView(device_),
                                NullVkImageView(device_),
@@ -71,19 +80,29 @@ VKSwapChain::VKSwapChain(
     swapChainFramebuffers_   { NullVkFramebuffer(device_),
                                NullVkFramebuffer(device_),
                                NullVkFramebuffer(device_)      },
-    secondaryRenderPass_     { device                          },
+    presentMode_             { desc.presentMode                },
+    colorSpace_              { desc.colorSpace                 },
+    secondaryRenderPass_     { device, dynamicRendering        },
     depthStencilBuffer_      { device                          },
     colorBuffers_            { device, device, device          },
     imageAvailableSemaphore_ { NullVkSemaphore(device_),
+                               NullVkSemaphore(device_),
                                NullVkSemaphore(device_),
                                NullVkSemaphore(device_)        },
     renderFinishedSemaphore_ { NullVkSemaphore(device_),
+                               NullVkSemaphore(device_),
                                NullVkSemaphore(device_),
                                NullVkSemaphore(device_)        },
     inFlightFences_          { NullVkFence(device_),
                                NullVkFence(device_),
-                               NullVkFence(device_)            }
+                               NullVkFence(device_),
+                               NullVkFence(device_)            },
+    presentWaitEnabled_      { presentWaitEnabled              }
 {
+    /* Determine number of frames the CPU can record ahead of the GPU */
+    if (desc.maxFramesInFlight > 0)
+        numFramesInFlight_ = std::min(desc.maxFramesInFlight, VKSwapChain::maxNumFramesInFlight);
+
     SetOrCreateSurface(surface, desc.resolution, desc.fullscreen, nullptr);
 
     CreatePresentSemaphoresAndFences();
@@ -100,48 +119,14 @@ VKSwapChain::VKSwapChain(
 
 void VKSwapChain::Present()
 {
-    /* Initialize semaphores */
-    VkSemaphore waitSemaphores[] = { imageAvailableSemaphore_[currentFrameInFlight_] };
-    VkPipelineStageFlags waitStages[] = { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT };
-    VkSemaphore signalSemaphores[] = { renderFinishedSemaphore_[currentFrameInFlight_] };
-
-    /* Submit signal semaphore to graphics queue */
-    VkSubmitInfo submitInfo;
-    {
-        submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-        submitInfo.pNext                = nullptr;
-        submitInfo.waitSemaphoreCount   = 1;
-        submitInfo.pWaitSemaphores      = waitSemaphores;
-        submitInfo.pWaitDstStageMask    = waitStages;
-        submitInfo.commandBufferCount   = 0;
-        submitInfo.pCommandBuffers      = nullptr;
-        submitInfo.signalSemaphoreCount = 1;
-        submitInfo.pSignalSemaphores    = signalSemaphores;
-    }
-    VkResult result = vkQueueSubmit(graphicsQueue_, 1, &submitInfo, inFlightFences_[currentFrameInFlight_]);
-    VKThrowIfFailed(result, "failed to submit semaphore to Vulkan graphics queue");
-
-    /* Present result on screen */
-    VkPresentInfoKHR presentInfo;
-    {
-        presentInfo.sType               = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
-        presentInfo.pNext               = nullptr;
-        presentInfo.waitSemaphoreCount  = 1;
-        presentInfo.pWaitSemaphores     = signalSemaphores;
-        presentInfo.swapchainCount      = 1;
-        presentInfo.pSwapchains         = swapChain_.GetAddressOf();
-        presentInfo.pImageIndices       = &currentColorBuffer_;
-        presentInfo.pResults            = nullptr;
-    }
-    result = vkQueuePresentKHR(presentQueue_, &presentInfo);
-    VKThrowIfFailed(result, "failed to present Vulkan graphics queue");
-
-    /* Move to next frame */
-    AcquireNextColorBuffer();
+    VKSwapChain* swapChain = this;
+    VKSwapChain::PresentBatch(1, &swapChain);
 }
 
 std::uint32_t VKSwapChain::GetCurrentSwapIndex() const
 {
+    /* The swap index is only known once the next color buffer has been acquired */
+    const_cast<VKSwapChain*>(this)->AcquireNextColorBufferIfPending();
     return currentColorBuffer_;
 }
 
@@ -185,8 +170,140 @@ bool VKSwapChain::SetVsyncInterval(std::uint32_t vsyncInterval)
 
 /* --- Extended functions --- */
 
-std::uint32_t VKSwapChain::TranslateSwapIndex(std::uint32_t swapBufferIndex) const
+void VKSwapChain::PresentBatch(std::uint32_t numSwapChains, VKSwapChain* const * swapChains)
 {
+    LLGL_PROFILE_ZONE("Present");
+
+    if (numSwapChains == 0)
+        return;
+
+    /* All swap-chains of a single vkQueuePresentKHR call must be presented to the same queue; the rest is presented in another batch */
+    const VkQueue presentQueue = swapChains[0]->presentQueue_;
+
+    SmallVector<VKSwapChain*, 4> batch;
+    SmallVector<VKSwapChain*, 4> remainingSwapChains;
+
+    for_range(i, numSwapChains)
+    {
+        if (swapChains[i]->presentQueue_ == presentQueue)
+            batch.push_back(swapChains[i]);
+        else
+            remainingSwapChains.push_back(swapChains[i]);
+    }
+
+    for (VKSwapChain* swapChain : batch)
+    {
+        /* Wait until the next frame is due if frame pacing is enabled; this must not block while the queue mutex is locked */
+        swapChain->PaceFrame();
+
+        /* Acquire color buffer if this frame did not render into the swap-chain, since an image must be acquired before it can be presented */
+        swapChain->AcquireNextColorBufferIfPending();
+    }
+
+    const std::size_t numBatchSwapChains = batch.size();
+
+    SmallVector<VkSemaphore, 4>     waitSemaphores;
+    SmallVector<VkSwapchainKHR, 4>  nativeSwapChains;
+    SmallVector<std::uint32_t, 4>   imageIndices;
+    SmallVector<std::uint64_t, 4>   presentIds;
+    bool                            presentWaitEnabled = false;
+
+    waitSemaphores.reserve(numBatchSwapChains);
+    nativeSwapChains.reserve(numBatchSwapChains);
+    imageIndices.reserve(numBatchSwapChains);
+    presentIds.reserve(numBatchSwapChains);
+
+    /* Swap-chains can be presented from different threads, so guard the queues for the submission and the presentation */
+    std::unique_lock<std::mutex> queueLock{ VKGetQueueMutex() };
+
+    for (VKSwapChain* swapChain : batch)
+    {
+        const std::uint32_t frameInFlight = swapChain->currentFrameInFlight_;
+
+        /* Initialize semaphores */
+        VkSemaphore waitSemaphore = swapChain->imageAvailableSemaphore_[frameInFlight];
+        VkPipelineStageFlags waitStage = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+        VkSemaphore signalSemaphore = swapChain->renderFinishedSemaphore_[frameInFlight];
+
+        /* Submit signal semaphore to graphics queue; each swap-chain has its own frame-in-flight fence, so this needs one submission per swap-chain */
+        VkSubmitInfo submitInfo;
+        {
+            submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+            submitInfo.pNext                = nullptr;
+            submitInfo.waitSemaphoreCount   = 1;
+            submitInfo.pWaitSemaphores      = &waitSemaphore;
+            submitInfo.pWaitDstStageMask    = &waitStage;
+            submitInfo.commandBufferCount   = 0;
+            submitInfo.pCommandBuffers      = nullptr;
+            submitInfo.signalSemaphoreCount = 1;
+            submitInfo.pSignalSemaphores    = &signalSemaphore;
+        }
+        VkResult result = vkQueueSubmit(swapChain->graphicsQueue_, 1, &submitInfo, swapChain->inFlightFences_[frameInFlight]);
+        VKThrowIfFailed(result, "failed to submit semaphore to Vulkan graphics queue");
+
+        /* Tag presentation with an ID to wait for it once this frame-in-flight slot is reused; 0 does not tag the presentation */
+        if (swapChain->presentWaitEnabled_)
+        {
+            swapChain->presentIds_[frameInFlight] = ++swapChain->presentIdCounter_;
+            presentWaitEnabled = true;
+        }
+
+        waitSemaphores.push_back(signalSemaphore);
+        nativeSwapChains.push_back(swapChain->swapChain_.Get());
+        imageIndices.push_back(swapChain->currentColorBuffer_);
+        presentIds.push_back(swapChain->presentWaitEnabled_ ? swapChain->presentIds_[frameInFlight] : 0);
+    }
+
+    VkPresentIdKHR presentIdInfo;
+    if (presentWaitEnabled)
+    {
+        presentIdInfo.sType             = VK_STRUCTURE_TYPE_PRESENT_ID_KHR;
+        presentIdInfo.pNext             = nullptr;
+        presentIdInfo.swapchainCount    = static_cast<std::uint32_t>(presentIds.size());
+        presentIdInfo.pPresentIds       = presentIds.data();
+    }
+
+    /* Present results of all swap-chains on screen in a single operation */
+    VkPresentInfoKHR presentInfo;
+    {
+        presentInfo.sType               = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
+        presentInfo.pNext               = (presentWaitEnabled ? &presentIdInfo : nullptr);
+        presentInfo.waitSemaphoreCount  = static_cast<std::uint32_t>(waitSemaphores.size());
+        presentInfo.pWaitSemaphores     = waitSemaphores.data();
+        presentInfo.swapchainCount      = static_cast<std::uint32_t>(nativeSwapChains.size());
+        presentInfo.pSwapchains         = nativeSwapChains.data();
+        presentInfo.pImageIndices       = imageIndices.data();
+        presentInfo.pResults            = nullptr;
+    }
+    VkResult result = vkQueuePresentKHR(presentQueue, &presentInfo);
+    queueLock.unlock();
+    VKThrowIfFailed(result, "failed to present Vulkan graphics queue");
+
+    /*
+    Move a limited number of buffers out of sparsely used device memory chunks at the frame boundary (if enabled).
+    All swap-chains share the device memory manager of the render system, so this is only done once per batch.
+    */
+    batch.front()->deviceMemoryMngr_.Defragment();
+
+    for (VKSwapChain* swapChain : batch)
+    {
+        /*
+        Move to next frame, but defer acquiring its color buffer until it is used for the first time,
+        so the CPU can record the next frame without waiting for the GPU and the presentation engine
+        */
+        swapChain->colorBufferAcquirePending_ = true;
+
+        swapChain->NotifyFramePresented();
+    }
+
+    /* Present swap-chains with other present queues */
+    if (!remainingSwapChains.empty())
+        PresentBatch(static_cast<std::uint32_t>(remainingSwapChains.size()), remainingSwapChains.data());
+}
+
+std::uint32_t VKSwapChain::TranslateSwapIndex(std::uint32_t swapBufferIndex)
+{
+    AcquireNextColorBufferIfPending();
     if (swapBufferIndex == LLGL_CURRENT_SWAP_INDEX)
         return currentColorBuffer_;
     else
@@ -289,7 +406,10 @@ bool VKSwapChain::ResizeBuffersPrimary(const Extent2D& resolution)
         swapChainExtent_.height != resolution.height)
     {
         /* Wait until graphics queue is idle before resources are destroyed and recreated */
-        vkQueueWaitIdle(graphicsQueue_);
+        {
+            std::lock_guard<std::mutex> guard{ VKGetQueueMutex() };
+            vkQueueWaitIdle(graphicsQueue_);
+        }
 
         /* Recreate presenting semaphores and Vulkan surface */
         CreatePresentSemaphoresAndFences();
@@ -330,7 +450,7 @@ void VKSwapChain::CreateGpuFence(VKPtr<VkFence>& fence)
 void VKSwapChain::CreatePresentSemaphoresAndFences()
 {
     /* Create presentation semaphorse */
-    for_range(i, maxNumFramesInFlight)
+    for_range(i, numFramesInFlight_)
     {
         CreateGpuSemaphore(imageAvailableSemaphore_[i]);
         CreateGpuSemaphore(renderFinishedSemaphore_[i]);
@@ -460,6 +580,10 @@ void VKSwapChain::CreateSwapChain(const Extent2D& resolution, std::uint32_t vsyn
     VkResult result = vkCreateSwapchainKHR(device_, &createInfo, nullptr, swapChain_.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan swap-chain");
 
+    /* Present IDs refer to the previous swap-chain */
+    for (std::uint64_t& presentId : presentIds_)
+        presentId = 0;
+
     /* Query swap-chain images */
     result = vkGetSwapchainImagesKHR(device_, swapChain_, &numColorBuffers_, nullptr);
     VKThrowIfFailed(result, "failed to query number of Vulkan swap-chain images");
@@ -471,8 +595,8 @@ void VKSwapChain::CreateSwapChain(const Extent2D& resolution, std::uint32_t vsyn
     /* Create swap-chain image views */
     CreateSwapChainImageViews();
 
-    /* Get initial color buffer index for new Vulkan swap-chain */
-    AcquireNextColorBuffer();
+    /* Get initial color buffer index for new Vulkan swap-chain on its first use */
+    colorBufferAcquirePending_ = true;
 }
 
 void VKSwapChain::CreateSwapChainImageViews()
@@ -511,6 +635,13 @@ void VKSwapChain::CreateSwapChainImageViews()
 
 void VKSwapChain::CreateSwapChainFramebuffers()
 {
+    /* Dynamic rendering binds the image views directly instead of framebuffer objects */
+    if (UsesDynamicRendering())
+    {
+        InitDynamicRenderingAttachments();
+        return;
+    }
+
     /* Initialize image view attachments */
     VkImageView attachments[3] = {};
     std::uint32_t numAttachments = 0;
@@ -557,6 +688,46 @@ void VKSwapChain::CreateSwapChainFramebuffers()
     }
 }
 
+static void InitDynamicRenderingImage(VKDynamicRenderingImage& dst, VkImage image, VkImageView imageView, VkFormat format, VkImageLayout restingLayout)
+{
+    dst.image                           = image;
+    dst.imageView                       = imageView;
+    dst.subresource.aspectMask          = VKImageUtils::GetInclusiveVkImageAspect(format);
+    dst.subresource.baseMipLevel        = 0;
+    dst.subresource.levelCount          = 1;
+    dst.subresource.baseArrayLayer      = 0;
+    dst.subresource.layerCount          = 1;
+    dst.restingLayout                   = restingLayout;
+}
+
+void VKSwapChain::InitDynamicRenderingAttachments()
+{
+    for_range(i, numColorBuffers_)
+    {
+        VKDynamicRenderingAttachments& dst = dynamicRenderingAttachments_[i];
+
+        dst.numColorAttachments = 1;
+        dst.extent              = swapChainExtent_;
+
+        /* Swap-chain images rest in present layout; with multi-sampling, they are the resolve targets of the internal color buffers */
+        if (HasMultiSampling())
+        {
+            InitDynamicRenderingImage(dst.colorAttachments[0], colorBuffers_[i].GetVkImage(), colorBuffers_[i].GetVkImageView(), swapChainFormat_.format, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+            InitDynamicRenderingImage(dst.resolveAttachments[0], swapChainImages_[i], swapChainImageViews_[i], swapChainFormat_.format, VK_IMAGE_LAYOUT_PRESENT_SRC_KHR);
+        }
+        else
+        {
+            InitDynamicRenderingImage(dst.colorAttachments[0], swapChainImages_[i], swapChainImageViews_[i], swapChainFormat_.format, VK_IMAGE_LAYOUT_PRESENT_SRC_KHR);
+            dst.resolveAttachments[0] = VKDynamicRenderingImage{};
+        }
+
+        if (HasDepthStencilBuffer())
+            InitDynamicRenderingImage(dst.depthStencilAttachment, depthStencilBuffer_.GetVkImage(), depthStencilBuffer_.GetVkImageView(), depthStencilFormat_, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL);
+        else
+            dst.depthStencilAttachment = VKDynamicRenderingImage{};
+    }
+}
+
 void VKSwapChain::CreateDepthStencilBuffer(const Extent2D& resolution)
 {
     const VkSampleCountFlagBits sampleCountBits = VKTypes::ToVkSampleCountBits(swapChainSamples_);
@@ -602,6 +773,28 @@ VkSurfaceFormatKHR VKSwapChain::PickSwapSurfaceFormat(const std::vector<VkSurfac
     if (surfaceFormats.size() == 1 && surfaceFormats.front().format == VK_FORMAT_UNDEFINED)
         return { VK_FORMAT_B8G8R8A8_UNORM, VK_COLOR_SPACE_SRGB_NONLINEAR_KHR };
 
+    #ifdef VK_EXT_swapchain_colorspace
+
+    /* Find surface format for the requested color space; these are only reported if VK_EXT_swapchain_colorspace is enabled */
+    if (colorSpace_ != ColorSpace::SRGB)
+    {
+        for (const VkSurfaceFormatKHR& format : surfaceFormats)
+        {
+            if (colorSpace_ == ColorSpace::ExtendedSRGB)
+            {
+                if (format.format == VK_FORMAT_R16G16B16A16_SFLOAT && format.colorSpace == VK_COLOR_SPACE_EXTENDED_SRGB_LINEAR_EXT)
+                    return format;
+            }
+            else if (colorSpace_ == ColorSpace::HDR10)
+            {
+                if (format.format == VK_FORMAT_A2B10G10R10_UNORM_PACK32 && format.colorSpace == VK_COLOR_SPACE_HDR10_ST2084_EXT)
+                    return format;
+            }
+        }
+    }
+
+    #endif // /VK_EXT_swapchain_colorspace
+
     for (const VkSurfaceFormatKHR& format : surfaceFormats)
     {
         if (format.format == VK_FORMAT_B8G8R8A8_UNORM && format.colorSpace == VK_COLOR_SPACE_SRGB_NONLINEAR_KHR)
@@ -613,7 +806,14 @@ VkSurfaceFormatKHR VKSwapChain::PickSwapSurfaceFormat(const std::vector<VkSurfac
 
 VkPresentModeKHR VKSwapChain::PickSwapPresentMode(const std::vector<VkPresentModeKHR>& presentModes, std::uint32_t vsyncInterval) const
 {
-    if (vsyncInterval == 0)
+    if (presentMode_ != PresentMode::Default)
+    {
+        /* Use explicit presentation mode if supported; FIFO is the only mode that is guaranteed to be available */
+        const VkPresentModeKHR explicitMode = VKTypes::ToVkPresentMode(presentMode_);
+        if (std::find(presentModes.begin(), presentModes.end(), explicitMode) != presentModes.end())
+            return explicitMode;
+    }
+    else if (vsyncInterval == 0)
     {
         /* Check if MAILBOX or IMMEDIATE presentation mode is available, to avoid vertical synchronization */
         for (const VkPresentModeKHR& mode : presentModes)
@@ -672,7 +872,10 @@ std::uint32_t VKSwapChain::PickSwapChainSize(std::uint32_t swapBuffers) const
 
 void VKSwapChain::AcquireNextColorBuffer()
 {
-    currentFrameInFlight_ = (currentFrameInFlight_ + 1) % maxNumFramesInFlight;
+    currentFrameInFlight_ = (currentFrameInFlight_ + 1) % numFramesInFlight_;
+
+    /* Pace the CPU by the presentation engine, then wait until the GPU has finished the frame that last used this slot */
+    WaitForPresentedFrame();
     vkWaitForFences(device_, 1, inFlightFences_[currentFrameInFlight_].GetAddressOf(), VK_TRUE, UINT64_MAX);
 
     vkAcquireNextImageKHR(
@@ -687,6 +890,25 @@ void VKSwapChain::AcquireNextColorBuffer()
     vkResetFences(device_, 1, inFlightFences_[currentFrameInFlight_].GetAddressOf());
 }
 
+void VKSwapChain::AcquireNextColorBufferIfPending()
+{
+    if (colorBufferAcquirePending_)
+    {
+        colorBufferAcquirePending_ = false;
+        AcquireNextColorBuffer();
+    }
+}
+
+void VKSwapChain::WaitForPresentedFrame()
+{
+    if (presentWaitEnabled_ && presentIds_[currentFrameInFlight_] > 0)
+    {
+        /* Timeouts and out-of-date swap-chains are ignored here, since this only limits how far the CPU can run ahead */
+        vkWaitForPresentKHR(device_, swapChain_, presentIds_[currentFrameInFlight_], VKSwapChain::presentWaitTimeout);
+        presentIds_[currentFrameInFlight_] = 0;
+    }
+}
+
 
 } // /namespace LLGL
 
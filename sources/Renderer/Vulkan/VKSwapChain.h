@@ -15,6 +15,7 @@
 #include "VKCore.h"
 #include "VKPtr.h"
 #include "RenderState/VKRenderPass.h"
+#include "Command/VKDynamicRendering.h"
 #include "Texture/VKDepthStencilBuffer.h"
 #include "Texture/VKColorBuffer.h"
 #include <memory>
@@ -40,7 +41,9 @@ class VKSwapChain final : public SwapChain
             VkDevice                        device,
             VKDeviceMemoryManager&          deviceMemoryMngr,
             const SwapChainDescriptor&      desc,
-            const std::shared_ptr<Surface>& surface
+            const std::shared_ptr<Surface>& surface,
+            bool                            presentWaitEnabled  = false,
+            bool                            dynamicRendering    = false
         );
 
         void Present() override;
@@ -58,6 +61,12 @@ class VKSwapChain final : public SwapChain
 
     public:
 
+        /*
+        Presents all specified swap-chains. Swap-chains that share the same present queue are presented with a single vkQueuePresentKHR call.
+        Each swap-chain must appear at most once in the array.
+        */
+        static void PresentBatch(std::uint32_t numSwapChains, VKSwapChain* const * swapChains);
+
         // Returns the swap-chain render pass object.
         inline const VKRenderPass& GetSwapChainRenderPass() const
         {
@@ -70,8 +79,8 @@ class VKSwapChain final : public SwapChain
             return secondaryRenderPass_.GetVkRenderPass();
         }
 
-        // Returns the actual swap buffer index.
-        std::uint32_t TranslateSwapIndex(std::uint32_t swapBufferIndex) const;
+        // Returns the actual swap buffer index. This acquires the next swap-chain image if it has not been acquired since the last Present call.
+        std::uint32_t TranslateSwapIndex(std::uint32_t swapBufferIndex);
 
         // Returns the native VkFramebuffer object that is currently used from swap-chain.
         inline VkFramebuffer GetVkFramebuffer(std::uint32_t swapBufferIndex) const
@@ -79,6 +88,18 @@ class VKSwapChain final : public SwapChain
             return swapChainFramebuffers_[swapBufferIndex].Get();
         }
 
+        // Returns true if this swap-chain is used with dynamic rendering instead of framebuffer objects.
+        inline bool UsesDynamicRendering() const
+        {
+            return swapChainRenderPass_.IsDynamicRendering();
+        }
+
+        // Returns the attachments for dynamic rendering of the specified swap buffer. Only valid if UsesDynamicRendering() returns true.
+        inline const VKDynamicRenderingAttachments& GetDynamicRenderingAttachments(std::uint32_t swapBufferIndex) const
+        {
+            return dynamicRenderingAttachments_[swapBufferIndex];
+        }
+
         // Returns the swap-chain resolution as VkExtent2D.
         inline const VkExtent2D& GetVkExtent() const
         {
@@ -117,6 +138,7 @@ class VKSwapChain final : public SwapChain
         void CreateSwapChain(const Extent2D& resolution, std::uint32_t vsyncInterval);
         void CreateSwapChainImageViews();
         void CreateSwapChainFramebuffers();
+        void InitDynamicRenderingAttachments();
 
         void CreateDepthStencilBuffer(const Extent2D& resolution);
         void CreateColorBuffers(const Extent2D& resolution);
@@ -132,10 +154,20 @@ class VKSwapChain final : public SwapChain
 
         void AcquireNextColorBuffer();
 
+        // Acquires the next color buffer if it has been deferred since the last Present call or swap-chain recreation.
+        void AcquireNextColorBufferIfPending();
+
+        // Blocks until the image that was presented with the current frame-in-flight slot is on screen or the present-wait timeout expired.
+        void WaitForPresentedFrame();
+
     private:
 
-        static constexpr std::uint32_t maxNumColorBuffers   = 3;
-        static constexpr std::uint32_t maxNumFramesInFlight = 3;
+        static constexpr std::uint32_t maxNumColorBuffers       = 3;
+        static constexpr std::uint32_t maxNumFramesInFlight     = 4;
+        static constexpr std::uint32_t defaultNumFramesInFlight = 3;
+
+        // Timeout (in nanoseconds) for vkWaitForPresentKHR, so a swap-chain that is not presented to the screen, e.g. a minimized window, cannot stall the CPU.
+        static constexpr std::uint64_t presentWaitTimeout       = 100000000ull;
 
         VkInstance              instance_                                   = VK_NULL_HANDLE;
         VkPhysicalDevice        physicalDevice_                             = VK_NULL_HANDLE;
@@ -157,8 +189,12 @@ class VKSwapChain final : public SwapChain
 
         std::uint32_t           numColorBuffers_                            = 2;
         std::uint32_t           currentColorBuffer_                         = 0; // determined by vkAcquireNextImageKHR
+        bool                    colorBufferAcquirePending_                  = true; // vkAcquireNextImageKHR is deferred until the first use of the current color buffer
         std::uint32_t           currentFrameInFlight_                       = 0; // current index for maximum frames in flight
+        std::uint32_t           numFramesInFlight_                          = VKSwapChain::defaultNumFramesInFlight;
         std::uint32_t           vsyncInterval_                              = 0;
+        PresentMode             presentMode_                                = PresentMode::Default;
+        ColorSpace              colorSpace_                                 = ColorSpace::SRGB;
 
         VKRenderPass            secondaryRenderPass_;
         VkFormat                depthStencilFormat_                         = VK_FORMAT_UNDEFINED;
@@ -172,6 +208,12 @@ class VKSwapChain final : public SwapChain
         VKPtr<VkSemaphore>      renderFinishedSemaphore_[maxNumFramesInFlight];
         VKPtr<VkFence>          inFlightFences_[maxNumFramesInFlight];
 
+        bool                    presentWaitEnabled_                         = false;
+        std::uint64_t           presentIdCounter_                           = 0;
+        std::uint64_t           presentIds_[maxNumFramesInFlight]           = {}; // Present ID of the last image presented with each frame-in-flight slot; 0 if there is none.
+
+        VKDynamicRenderingAttachments dynamicRenderingAttachments_[maxNumColorBuffers]; // Used instead of swap-chain framebuffers for dynamic rendering.
+
 };
 
 
@@ -37,6 +37,8 @@ VkShaderStageFlagBits Map(const ShaderType shaderType)
         case ShaderType::Geometry:          return VK_SHADER_STAGE_GEOMETRY_BIT;
         case ShaderType::Fragment:          return VK_SHADER_STAGE_FRAGMENT_BIT;
         case ShaderType::Compute:           return VK_SHADER_STAGE_COMPUTE_BIT;
+        case ShaderType::Task:              return VK_SHADER_STAGE_TASK_BIT_EXT;
+        case ShaderType::Mesh:              return VK_SHADER_STAGE_MESH_BIT_EXT;
     }
     MapFailed("ShaderType", "VkShaderStageFlagBits");
 }
@@ -337,6 +339,7 @@ VkQueryType Map(const QueryType queryType)
         case QueryType::StreamOutPrimitivesWritten:     break;
         case QueryType::StreamOutOverflow:              break;
         case QueryType::PipelineStatistics:             return VK_QUERY_TYPE_PIPELINE_STATISTICS;
+        case QueryType::Timestamp:                      return VK_QUERY_TYPE_TIMESTAMP;
     }
     MapFailed("QueryType", "VkQueryType");
 }
@@ -435,6 +438,47 @@ VkColorComponentFlags ToVkColorComponentFlags(std::uint8_t colorMask)
     return bitmask;
 }
 
+float ToVkMemoryPriority(const ResidencyPriority priority)
+{
+    switch (priority)
+    {
+        case ResidencyPriority::Minimum:    return 0.0f;
+        case ResidencyPriority::Low:        return 0.25f;
+        case ResidencyPriority::Normal:     return 0.5f;
+        case ResidencyPriority::High:       return 0.75f;
+        case ResidencyPriority::Maximum:    return 1.0f;
+    }
+    MapFailed("ResidencyPriority", "VkMemoryPriorityAllocateInfoEXT::priority");
+}
+
+VkPresentModeKHR ToVkPresentMode(const PresentMode presentMode)
+{
+    switch (presentMode)
+    {
+        case PresentMode::Default:      break;
+        case PresentMode::Fifo:         return VK_PRESENT_MODE_FIFO_KHR;
+        case PresentMode::FifoRelaxed:  return VK_PRESENT_MODE_FIFO_RELAXED_KHR;
+        case PresentMode::Mailbox:      return VK_PRESENT_MODE_MAILBOX_KHR;
+        case PresentMode::Immediate:    return VK_PRESENT_MODE_IMMEDIATE_KHR;
+    }
+    MapFailed("PresentMode", "VkPresentModeKHR");
+}
+
+VkExtent2D ToVkFragmentSize(const ShadingRate shadingRate)
+{
+    switch (shadingRate)
+    {
+        case ShadingRate::Rate1x1:  return VkExtent2D{ 1, 1 };
+        case ShadingRate::Rate1x2:  return VkExtent2D{ 1, 2 };
+        case ShadingRate::Rate2x1:  return VkExtent2D{ 2, 1 };
+        case ShadingRate::Rate2x2:  return VkExtent2D{ 2, 2 };
+        case ShadingRate::Rate2x4:  return VkExtent2D{ 2, 4 };
+        case ShadingRate::Rate4x2:  return VkExtent2D{ 4, 2 };
+        case ShadingRate::Rate4x4:  return VkExtent2D{ 4, 4 };
+    }
+    MapFailed("ShadingRate", "VkExtent2D");
+}
+
 Format Unmap(const VkFormat format)
 {
     switch (format)
@@ -565,6 +609,11 @@ bool IsVkFormatDepthStencil(const VkFormat format)
     }
 }
 
+bool IsVkFormatDepth(const VkFormat format)
+{
+    return (IsVkFormatDepthStencil(format) && format != VK_FORMAT_S8_UINT);
+}
+
 bool IsVkFormatStencil(const VkFormat format)
 {
     switch (format)
@@ -19,6 +19,9 @@
 #include <LLGL/Format.h>
 #include <LLGL/SamplerFlags.h>
 #include <LLGL/QueryHeapFlags.h>
+#include <LLGL/ResourceFlags.h>
+#include <LLGL/SwapChainFlags.h>
+#include <LLGL/CommandBufferFlags.h>
 
 
 namespace LLGL
@@ -56,10 +59,14 @@ VkOffset3D              ToVkOffset(const Offset3D& offset);
 VkExtent3D              ToVkExtent(const Extent3D& extent);
 VkComponentSwizzle      ToVkComponentSwizzle(const TextureSwizzle swizzle);
 VkColorComponentFlags   ToVkColorComponentFlags(std::uint8_t colorMask);
+float                   ToVkMemoryPriority(const ResidencyPriority priority);
+VkPresentModeKHR        ToVkPresentMode(const PresentMode presentMode);
+VkExtent2D              ToVkFragmentSize(const ShadingRate shadingRate);
 
 Format Unmap( const VkFormat format );
 
 bool IsVkFormatDepthStencil(const VkFormat format);
+bool IsVkFormatDepth(const VkFormat format);
 bool IsVkFormatStencil(const VkFormat format);
 bool IsVkFormatColor(const VkFormat format);
 
@@ -0,0 +1,125 @@
+/*
+ * Test_FrameReplay.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/LLGL.h>
+#include <LLGL/Utils/FrameCapturePlayer.h>
+#include <LLGL/Timer.h>
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+#include <iostream>
+
+
+/*
+Replays a frame capture that was written with RenderSystemFlags::FrameCapture (see RenderingDebugger::CaptureFrame)
+and reports the average CPU and GPU time per replayed frame.
+Usage: Test_FrameReplay CAPTURE_FILE [MODULE] [NUM_FRAMES]
+*/
+int main(int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        std::cerr << "usage: Test_FrameReplay CAPTURE_FILE [MODULE] [NUM_FRAMES]" << std::endl;
+        return 1;
+    }
+
+    const char* filename    = argv[1];
+    const char* module      = (argc > 2 ? argv[2] : "OpenGL");
+    const int   numFrames   = (argc > 3 ? std::max(1, std::atoi(argv[3])) : 100);
+
+    try
+    {
+        /* Load render system with profiler, so the GPU time of each replayed command is recorded */
+        LLGL::RenderingDebugger debugger;
+        debugger.SetTimeRecording(true);
+
+        LLGL::Report report;
+        LLGL::RenderSystemDescriptor rendererDesc = module;
+        {
+            rendererDesc.flags      = LLGL::RenderSystemFlags::ProfileOnly;
+            rendererDesc.debugger   = &debugger;
+        }
+        LLGL::RenderSystemPtr renderer = LLGL::RenderSystem::Load(rendererDesc, &report);
+        if (!renderer)
+        {
+            std::cerr << report.GetText();
+            return 1;
+        }
+
+        /* Load capture once to query its resolution, then create the swap-chain that replaces the captured one */
+        LLGL::FrameCaptureInfo captureInfo;
+        {
+            LLGL::FrameCapturePlayer probe{ *renderer };
+            if (!probe.LoadFromFile(filename))
+            {
+                std::cerr << "failed to load frame capture: " << filename << std::endl;
+                return 1;
+            }
+            captureInfo = probe.GetInfo();
+        }
+
+        LLGL::SwapChainDescriptor swapChainDesc;
+        {
+            swapChainDesc.resolution = captureInfo.resolution;
+            if (swapChainDesc.resolution.width == 0 || swapChainDesc.resolution.height == 0)
+                swapChainDesc.resolution = { 800, 600 };
+        }
+        LLGL::SwapChain* swapChain = renderer->CreateSwapChain(swapChainDesc);
+
+        LLGL::FrameCapturePlayer player{ *renderer, swapChain };
+        if (!player.LoadFromFile(filename, &report))
+        {
+            std::cerr << report.GetText();
+            return 1;
+        }
+        if (report.HasErrors())
+            std::cerr << report.GetText();
+
+        const LLGL::FrameCaptureInfo& info = player.GetInfo();
+        std::cout << "Capture: " << filename << " (captured with " << info.rendererName.c_str() << ")" << std::endl;
+        std::cout << "  objects:     " << info.numObjects << " (" << info.numFailedObjects << " failed)" << std::endl;
+        std::cout << "  submissions: " << info.numSubmissions << std::endl;
+        std::cout << "  commands:    " << info.numCommands << " (" << info.numSkipped << " skipped during capture)" << std::endl;
+
+        /* Replay frame and accumulate elapsed time of all top-level time records */
+        std::uint64_t cpuTicks = 0;
+        std::uint64_t gpuTime  = 0;
+
+        for (int i = 0; i < numFrames; ++i)
+        {
+            const std::uint64_t startTick = LLGL::Timer::Tick();
+            {
+                player.RestoreResources();
+                player.Replay();
+            }
+            cpuTicks += LLGL::Timer::Tick() - startTick;
+
+            LLGL::FrameProfile profile;
+            debugger.FlushProfile(&profile);
+            for (const LLGL::ProfileTimeRecord& record : profile.timeRecords)
+            {
+                if (record.depth == 0)
+                    gpuTime += record.elapsedTime;
+            }
+        }
+
+        renderer->GetCommandQueue()->WaitIdle();
+
+        const double cpuTimeMS = static_cast<double>(cpuTicks) * 1000.0 / static_cast<double>(LLGL::Timer::Frequency()) / numFrames;
+        const double gpuTimeMS = static_cast<double>(gpuTime) / 1000000.0 / numFrames;
+        std::cout << "Replayed " << numFrames << " frames on " << renderer->GetName() << ":" << std::endl;
+        std::cout << "  average CPU time: " << cpuTimeMS << " ms" << std::endl;
+        std::cout << "  average GPU time: " << gpuTimeMS << " ms" << std::endl;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,157 @@
+/*
+ * Test_RecordAllocations.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/LLGL.h>
+#include <LLGL/Utils/VertexFormat.h>
+#include <LLGL/Timer.h>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+#include <iostream>
+
+
+/*
+Count all heap allocations of this process by replacing the global allocation functions.
+On platforms with ELF symbol interposition, these replacements are also used by the renderer modules.
+*/
+static std::atomic<std::size_t> g_numAllocations{ 0 };
+
+void* operator new (std::size_t size)
+{
+    ++g_numAllocations;
+    if (void* ptr = std::malloc(size == 0 ? 1 : size))
+        return ptr;
+    throw std::bad_alloc{};
+}
+
+void* operator new [] (std::size_t size)
+{
+    return operator new (size);
+}
+
+void operator delete (void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete [] (void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete (void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete [] (void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+static constexpr std::uint32_t  g_numDraws          = 100000;
+static constexpr int            g_numWarmUpFrames   = 4;
+static constexpr int            g_numTestFrames     = 8;
+
+static void RecordDraws(LLGL::CommandBuffer& cmdBuffer, LLGL::SwapChain& swapChain, LLGL::Buffer& vertexBuffer)
+{
+    cmdBuffer.Begin();
+    {
+        cmdBuffer.SetVertexBuffer(vertexBuffer);
+        cmdBuffer.BeginRenderPass(swapChain);
+        {
+            cmdBuffer.SetViewport(swapChain.GetResolution());
+            for (std::uint32_t i = 0; i < g_numDraws; ++i)
+                cmdBuffer.Draw(3, 0);
+        }
+        cmdBuffer.EndRenderPass();
+    }
+    cmdBuffer.End();
+}
+
+// Returns true if re-recording the command buffer of the specified renderer does not allocate any heap memory after warm-up.
+static bool TestRenderer(const std::string& rendererModule)
+{
+    LLGL::Report report;
+    LLGL::RenderSystemPtr renderer = LLGL::RenderSystem::Load(rendererModule, &report);
+    if (!renderer)
+    {
+        std::cout << rendererModule << ": skipped (" << report.GetText() << ")" << std::endl;
+        return true;
+    }
+
+    LLGL::SwapChainDescriptor swapChainDesc;
+    {
+        swapChainDesc.resolution = { 640, 480 };
+    }
+    LLGL::SwapChain* swapChain = renderer->CreateSwapChain(swapChainDesc);
+
+    LLGL::VertexFormat vertexFormat;
+    vertexFormat.AppendAttribute({ "position", LLGL::Format::RG32Float });
+
+    const float vertices[] = { 0.0f, 1.0f, 1.0f, -1.0f, -1.0f, -1.0f };
+    LLGL::BufferDescriptor vertexBufferDesc;
+    {
+        vertexBufferDesc.size           = sizeof(vertices);
+        vertexBufferDesc.bindFlags      = LLGL::BindFlags::VertexBuffer;
+        vertexBufferDesc.vertexAttribs  = vertexFormat.attributes;
+    }
+    LLGL::Buffer* vertexBuffer = renderer->CreateBuffer(vertexBufferDesc, vertices);
+
+    /*
+    The GL backend assembles multi-submit command buffers into native code when the JIT compiler is enabled,
+    so the deferred GL command buffer is tested with single submissions only.
+    */
+    LLGL::CommandBufferDescriptor cmdBufferDesc;
+    {
+        cmdBufferDesc.flags = (renderer->GetRendererID() == LLGL::RendererID::OpenGL ? 0 : LLGL::CommandBufferFlags::MultiSubmit);
+    }
+    LLGL::CommandBuffer* cmdBuffer = renderer->CreateCommandBuffer(cmdBufferDesc);
+
+    /* Let all internal containers reach their high-water mark */
+    for (int i = 0; i < g_numWarmUpFrames; ++i)
+        RecordDraws(*cmdBuffer, *swapChain, *vertexBuffer);
+
+    /* Measure allocations of steady-state recording */
+    const std::size_t   numAllocationsBefore    = g_numAllocations.load();
+    const std::uint64_t startTick               = LLGL::Timer::Tick();
+
+    for (int i = 0; i < g_numTestFrames; ++i)
+        RecordDraws(*cmdBuffer, *swapChain, *vertexBuffer);
+
+    const std::uint64_t endTick                 = LLGL::Timer::Tick();
+    const std::size_t   numAllocations          = g_numAllocations.load() - numAllocationsBefore;
+    const double        elapsedMilliseconds     = static_cast<double>(endTick - startTick) * 1000.0 / static_cast<double>(LLGL::Timer::Frequency());
+
+    std::cout << rendererModule << ": recorded " << g_numDraws << " draws " << g_numTestFrames << " times in " << elapsedMilliseconds << " ms ";
+    std::cout << "with " << numAllocations << " heap allocation(s)" << std::endl;
+
+    return (numAllocations == 0);
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> rendererModules;
+    for (int i = 1; i < argc; ++i)
+        rendererModules.push_back(argv[i]);
+
+    if (rendererModules.empty())
+        rendererModules = { "Null", "OpenGL", "Metal" };
+
+    bool succeeded = true;
+    for (const std::string& module : rendererModules)
+    {
+        if (!TestRenderer(module))
+            succeeded = false;
+    }
+
+    std::cout << (succeeded ? "test passed" : "test failed") << std::endl;
+
+    return (succeeded ? 0 : 1);
+}
@@ -0,0 +1,153 @@
+/*
+ * BenchmarkBufferUpload.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <string.h>
+#include <vector>
+
+
+// Returns the specified size as short string, e.g. "64B", "4KB", or "256MB".
+static std::string BufferUploadSizeToStr(std::uint64_t size)
+{
+    if (size >= 1024ull*1024ull)
+        return std::to_string(size / (1024ull*1024ull)) + "MB";
+    if (size >= 1024ull)
+        return std::to_string(size / 1024ull) + "KB";
+    return std::to_string(size) + "B";
+}
+
+/*
+Measures the bandwidth of each upload path until the data is available to the GPU:
+RenderSystem::WriteBuffer, RenderSystem::MapBuffer with each CPU write access, CommandBuffer::UpdateBuffer, and CommandBuffer::CopyBuffer from a staging buffer.
+Buffer sizes are swept from 64 B to 256 MB (16 MB for fast test) in steps of factor 4.
+*/
+DEF_BENCHMARK( BufferUpload )
+{
+    const std::uint64_t minBufferSize = 64ull;
+    const std::uint64_t maxBufferSize = (opt.fastTest ? 16ull : 256ull) * 1024ull * 1024ull;
+
+    const std::vector<std::uint8_t> data(static_cast<std::size_t>(maxBufferSize), 0xAB);
+
+    const struct MapAccessInfo
+    {
+        CPUAccess   access;
+        const char* name;
+    }
+    mapAccessInfos[] =
+    {
+        { CPUAccess::WriteOnly,    "MapBuffer(WriteOnly)"    },
+        { CPUAccess::WriteDiscard, "MapBuffer(WriteDiscard)" },
+        { CPUAccess::ReadWrite,    "MapBuffer(ReadWrite)"    },
+    };
+
+    TestResult result = TestResult::Passed;
+
+    auto MeasureUploadPath = [&](const char* pathName, std::uint64_t size, const std::function<void()>& upload) -> bool
+    {
+        const std::string name = std::string("BufferUpload.") + pathName + "." + BufferUploadSizeToStr(size);
+        result = MeasureBenchmark(
+            name.c_str(), BenchmarkUnit::MegabytesPerSecond, static_cast<double>(size),
+            [&]() -> std::uint64_t
+            {
+                const std::uint64_t startTime = Timer::Tick();
+                upload();
+                cmdQueue->WaitIdle();
+                return (Timer::Tick() - startTime);
+            }
+        );
+        return (result == TestResult::Passed);
+    };
+
+    for (std::uint64_t size = minBufferSize; size <= maxBufferSize; size *= 4)
+    {
+        // Create destination buffer with CPU access for all paths and staging buffer for CopyBuffer
+        BufferDescriptor bufDesc;
+        {
+            bufDesc.size            = size;
+            bufDesc.bindFlags       = BindFlags::VertexBuffer | BindFlags::CopyDst;
+            bufDesc.cpuAccessFlags  = CPUAccessFlags::ReadWrite;
+        }
+        CREATE_BUFFER(buf, bufDesc, "buf{upload}", nullptr);
+
+        BufferDescriptor stagingBufDesc;
+        {
+            stagingBufDesc.size             = size;
+            stagingBufDesc.bindFlags        = BindFlags::CopySrc;
+            stagingBufDesc.cpuAccessFlags   = CPUAccessFlags::Write;
+        }
+        CREATE_BUFFER(stagingBuf, stagingBufDesc, "buf{staging}", nullptr);
+
+        // RenderSystem::WriteBuffer
+        bool succeeded = MeasureUploadPath(
+            "WriteBuffer", size,
+            [&]()
+            {
+                renderer->WriteBuffer(*buf, 0, data.data(), size);
+            }
+        );
+
+        // RenderSystem::MapBuffer with each CPU write access
+        for (const MapAccessInfo& info : mapAccessInfos)
+        {
+            if (!succeeded)
+                break;
+            succeeded = MeasureUploadPath(
+                info.name, size,
+                [&]()
+                {
+                    if (void* dst = renderer->MapBuffer(*buf, info.access))
+                    {
+                        ::memcpy(dst, data.data(), static_cast<std::size_t>(size));
+                        renderer->UnmapBuffer(*buf);
+                    }
+                }
+            );
+        }
+
+        // CommandBuffer::UpdateBuffer
+        if (succeeded)
+        {
+            succeeded = MeasureUploadPath(
+                "UpdateBuffer", size,
+                [&]()
+                {
+                    cmdBuffer->Begin();
+                    cmdBuffer->UpdateBuffer(*buf, 0, data.data(), size);
+                    cmdBuffer->End();
+                }
+            );
+        }
+
+        // CommandBuffer::CopyBuffer from staging buffer, including writing the staging buffer
+        if (succeeded)
+        {
+            succeeded = MeasureUploadPath(
+                "StagingCopyBuffer", size,
+                [&]()
+                {
+                    if (void* dst = renderer->MapBuffer(*stagingBuf, CPUAccess::WriteDiscard))
+                    {
+                        ::memcpy(dst, data.data(), static_cast<std::size_t>(size));
+                        renderer->UnmapBuffer(*stagingBuf);
+                    }
+                    cmdBuffer->Begin();
+                    cmdBuffer->CopyBuffer(*buf, 0, *stagingBuf, 0, size);
+                    cmdBuffer->End();
+                }
+            );
+        }
+
+        renderer->Release(*stagingBuf);
+        renderer->Release(*buf);
+
+        if (!succeeded)
+            break;
+    }
+
+    return result;
+}
+
@@ -0,0 +1,110 @@
+/*
+ * BenchmarkCommandBufferRecordAndSubmit.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+
+
+// Measures the time to record a typical command buffer and the time to submit it separately.
+DEF_BENCHMARK( CommandBufferRecordAndSubmit )
+{
+    if (shaders[VSSolid] == nullptr || shaders[PSSolid] == nullptr)
+    {
+        Log::Errorf("Missing shaders for backend\n");
+        return TestResult::FailedErrors;
+    }
+
+    GraphicsPipelineDescriptor psoDesc;
+    {
+        psoDesc.pipelineLayout      = layouts[PipelineSolid];
+        psoDesc.renderPass          = benchmarkTarget->GetRenderPass();
+        psoDesc.vertexShader        = shaders[VSSolid];
+        psoDesc.fragmentShader      = shaders[PSSolid];
+        psoDesc.rasterizer.cullMode = CullMode::Back;
+    }
+    PipelineState* pso = renderer->CreatePipelineState(psoDesc);
+
+    if (const Report* report = pso->GetReport())
+    {
+        if (report->HasErrors())
+        {
+            Log::Errorf("PSO creation failed:\n%s", report->GetText());
+            return TestResult::FailedErrors;
+        }
+    }
+
+    sceneConstants = SceneConstants{};
+    renderer->WriteBuffer(*sceneCbuffer, 0, &sceneConstants, sizeof(sceneConstants));
+
+    // Use a command buffer that must be submitted explicitly, so recording and submission can be measured separately
+    CommandBufferDescriptor cmdBufferDesc;
+    {
+        cmdBufferDesc.debugName = "BenchmarkCommandBuffer";
+    }
+    CommandBuffer* benchmarkCmdBuffer = renderer->CreateCommandBuffer(cmdBufferDesc);
+
+    constexpr unsigned numDraws = 100;
+
+    const IndexedTriangleMesh& mesh = models[ModelCube];
+
+    auto RecordCommandBuffer = [&]() -> void
+    {
+        benchmarkCmdBuffer->Begin();
+        {
+            benchmarkCmdBuffer->SetVertexBuffer(*meshBuffer);
+            benchmarkCmdBuffer->SetIndexBuffer(*meshBuffer, Format::R32UInt, mesh.indexBufferOffset);
+            benchmarkCmdBuffer->SetPipelineState(*pso);
+
+            benchmarkCmdBuffer->BeginRenderPass(*benchmarkTarget);
+            {
+                benchmarkCmdBuffer->Clear(ClearFlags::Color);
+                benchmarkCmdBuffer->SetViewport(benchmarkTarget->GetResolution());
+                for_range(i, numDraws)
+                {
+                    benchmarkCmdBuffer->SetResource(0, *sceneCbuffer);
+                    benchmarkCmdBuffer->DrawIndexed(mesh.numIndices, 0);
+                }
+            }
+            benchmarkCmdBuffer->EndRenderPass();
+        }
+        benchmarkCmdBuffer->End();
+    };
+
+    TestResult result = MeasureBenchmark(
+        "CommandBufferRecord", BenchmarkUnit::Microseconds, 1.0,
+        [&]() -> std::uint64_t
+        {
+            const std::uint64_t startTime = Timer::Tick();
+            RecordCommandBuffer();
+            const std::uint64_t elapsedTime = Timer::Tick() - startTime;
+
+            cmdQueue->Submit(*benchmarkCmdBuffer);
+            return elapsedTime;
+        }
+    );
+
+    if (result == TestResult::Passed)
+    {
+        result = MeasureBenchmark(
+            "CommandBufferSubmit", BenchmarkUnit::Microseconds, 1.0,
+            [&]() -> std::uint64_t
+            {
+                RecordCommandBuffer();
+
+                const std::uint64_t startTime = Timer::Tick();
+                cmdQueue->Submit(*benchmarkCmdBuffer);
+                cmdQueue->WaitIdle();
+                return (Timer::Tick() - startTime);
+            }
+        );
+    }
+
+    renderer->Release(*benchmarkCmdBuffer);
+    renderer->Release(*pso);
+
+    return result;
+}
+
@@ -0,0 +1,341 @@
+/*
+ * BenchmarkDrawCallPatterns.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/Parse.h>
+#include <LLGL/Utils/Utility.h>
+#include <thread>
+#include <vector>
+
+
+enum class DrawCallPattern
+{
+    NoStateChange,      // Only draw calls
+    VertexBufferChange, // Alternate between two vertex buffers before each draw call
+    ResourceHeapChange, // Alternate between two resource heaps before each draw call
+    PSOChange,          // Alternate between two PSOs before each draw call
+    UniformsChange,     // Update uniforms before each draw call
+};
+
+static const char* DrawCallPatternToStr(DrawCallPattern pattern)
+{
+    switch (pattern)
+    {
+        case DrawCallPattern::NoStateChange:        return "NoStateChange";
+        case DrawCallPattern::VertexBufferChange:   return "VertexBufferChange";
+        case DrawCallPattern::ResourceHeapChange:   return "ResourceHeapChange";
+        case DrawCallPattern::PSOChange:            return "PSOChange";
+        case DrawCallPattern::UniformsChange:       return "UniformsChange";
+        default:                                    return "";
+    }
+}
+
+struct alignas(4) DrawCallPatternUniforms
+{
+    Gs::Matrix4f    wMatrix;
+    ColorRGBAf      solidColor;
+    Gs::Vector3f    lightVec = { 0, 0, -1 };
+};
+
+// Objects of one draw call pattern that are shared between all worker threads; each state has two alternatives.
+struct DrawCallPatternBundle
+{
+    DrawCallPattern         pattern             = DrawCallPattern::NoStateChange;
+    PipelineState*          pso[2]              = {};
+    Buffer*                 vertexBuffers[2]    = {};
+    Buffer*                 indexBuffer         = nullptr;
+    std::uint64_t           indexBufferOffset   = 0;
+    std::uint32_t           numIndices          = 0;
+    Buffer*                 sceneBuffer         = nullptr;
+    ResourceHeap*           resourceHeaps[2]    = {};
+    Texture*                colorMap            = nullptr;
+    DrawCallPatternUniforms uniforms[2];
+};
+
+static void RecordDrawCallPattern(CommandBuffer& cmdBuffer, RenderTarget& renderTarget, const DrawCallPatternBundle& bundle, unsigned numDraws, bool clear)
+{
+    auto BindResources = [&cmdBuffer, &bundle]()
+    {
+        if (bundle.pattern == DrawCallPattern::ResourceHeapChange)
+            cmdBuffer.SetResourceHeap(*bundle.resourceHeaps[0]);
+        else
+            cmdBuffer.SetResource(0, *bundle.sceneBuffer);
+        if (bundle.pattern == DrawCallPattern::UniformsChange)
+            cmdBuffer.SetResource(1, *bundle.colorMap);
+    };
+
+    cmdBuffer.Begin();
+    {
+        cmdBuffer.SetVertexBuffer(*bundle.vertexBuffers[0]);
+        cmdBuffer.SetIndexBuffer(*bundle.indexBuffer, Format::R32UInt, bundle.indexBufferOffset);
+
+        cmdBuffer.BeginRenderPass(renderTarget);
+        {
+            if (clear)
+                cmdBuffer.Clear(ClearFlags::Color);
+            cmdBuffer.SetViewport(renderTarget.GetResolution());
+            cmdBuffer.SetPipelineState(*bundle.pso[0]);
+            BindResources();
+
+            for_range(i, numDraws)
+            {
+                const unsigned alt = i % 2;
+                switch (bundle.pattern)
+                {
+                    case DrawCallPattern::NoStateChange:
+                        break;
+                    case DrawCallPattern::VertexBufferChange:
+                        cmdBuffer.SetVertexBuffer(*bundle.vertexBuffers[alt]);
+                        break;
+                    case DrawCallPattern::ResourceHeapChange:
+                        cmdBuffer.SetResourceHeap(*bundle.resourceHeaps[alt]);
+                        break;
+                    case DrawCallPattern::PSOChange:
+                        // Resources must be re-bound after each PSO change
+                        cmdBuffer.SetPipelineState(*bundle.pso[alt]);
+                        BindResources();
+                        break;
+                    case DrawCallPattern::UniformsChange:
+                        cmdBuffer.SetUniforms(0, &bundle.uniforms[alt], sizeof(DrawCallPatternUniforms));
+                        break;
+                }
+                cmdBuffer.DrawIndexed(bundle.numIndices, 0);
+            }
+        }
+        cmdBuffer.EndRenderPass();
+    }
+    cmdBuffer.End();
+}
+
+/*
+Measures the CPU throughput of draw calls per second for different state-change patterns with 1, 2, 4, ... threads (up to '--threads=N').
+Each thread records its share of draw calls into its own command buffer. The measurement includes recording and submission, but not GPU execution.
+*/
+DEF_BENCHMARK( DrawCallPatterns )
+{
+    if (shaders[VSSolid] == nullptr || shaders[PSSolid] == nullptr)
+    {
+        Log::Errorf("Missing shaders for backend\n");
+        return TestResult::FailedErrors;
+    }
+
+    constexpr unsigned numDraws = 4096;
+
+    auto CreateAndValidatePSO = [this](const GraphicsPipelineDescriptor& psoDesc, PipelineState*& outPSO) -> bool
+    {
+        outPSO = renderer->CreatePipelineState(psoDesc);
+        if (const Report* report = outPSO->GetReport())
+        {
+            if (report->HasErrors())
+            {
+                Log::Errorf("PSO creation failed:\n%s", report->GetText());
+                return false;
+            }
+        }
+        return true;
+    };
+
+    // Create two solid PSOs that only differ in their cull mode
+    PipelineState* solidPSOs[2] = {};
+
+    GraphicsPipelineDescriptor psoDesc;
+    {
+        psoDesc.pipelineLayout      = layouts[PipelineSolid];
+        psoDesc.renderPass          = benchmarkTarget->GetRenderPass();
+        psoDesc.vertexShader        = shaders[VSSolid];
+        psoDesc.fragmentShader      = shaders[PSSolid];
+        psoDesc.rasterizer.cullMode = CullMode::Back;
+    }
+    if (!CreateAndValidatePSO(psoDesc, solidPSOs[0]))
+        return TestResult::FailedErrors;
+
+    psoDesc.rasterizer.cullMode = CullMode::Front;
+    if (!CreateAndValidatePSO(psoDesc, solidPSOs[1]))
+        return TestResult::FailedErrors;
+
+    // Create PSO with resource heap for the same shaders
+    PipelineLayout* heapLayout = renderer->CreatePipelineLayout(Parse("heap{cbuffer(Scene@1):vert:frag}"));
+
+    PipelineState* heapPSO = nullptr;
+    psoDesc.pipelineLayout      = heapLayout;
+    psoDesc.rasterizer.cullMode = CullMode::Back;
+    if (!CreateAndValidatePSO(psoDesc, heapPSO))
+        return TestResult::FailedErrors;
+
+    // Create PSO with uniforms if the dynamic shaders are available
+    PipelineLayout* uniformsLayout  = nullptr;
+    PipelineState*  uniformsPSO     = nullptr;
+
+    if (shaders[VSDynamic] != nullptr && shaders[PSDynamic] != nullptr && textures[TextureGrid10x10] != nullptr)
+    {
+        PipelineLayoutDescriptor psoLayoutDesc;
+        {
+            psoLayoutDesc.bindings  =
+            {
+                BindingDescriptor{ "Scene",    ResourceType::Buffer,  BindFlags::ConstantBuffer, StageFlags::VertexStage,   1u },
+                BindingDescriptor{ "colorMap", ResourceType::Texture, BindFlags::Sampled,        StageFlags::FragmentStage, 3u },
+            };
+            psoLayoutDesc.staticSamplers =
+            {
+                StaticSamplerDescriptor{ "linearSampler", StageFlags::FragmentStage, (HasCombinedSamplers() ? 3u : 4u), Parse("filter.min=nearest,filter.mag=nearest,address=clamp") }
+            };
+            psoLayoutDesc.uniforms =
+            {
+                UniformDescriptor{ "wMatrix",    UniformType::Float4x4 },
+                UniformDescriptor{ "solidColor", UniformType::Float4   },
+                UniformDescriptor{ "lightVec",   UniformType::Float3   },
+            };
+        }
+        uniformsLayout = renderer->CreatePipelineLayout(psoLayoutDesc);
+
+        psoDesc.pipelineLayout  = uniformsLayout;
+        psoDesc.vertexShader    = shaders[VSDynamic];
+        psoDesc.fragmentShader  = shaders[PSDynamic];
+        if (!CreateAndValidatePSO(psoDesc, uniformsPSO))
+            return TestResult::FailedErrors;
+    }
+    else
+        Log::Printf("Skip benchmark pattern: %s (missing dynamic shaders)\n", DrawCallPatternToStr(DrawCallPattern::UniformsChange));
+
+    // Create secondary vertex buffer with zero-initialized vertices; the draw calls are degenerate, so this only adds CPU overhead
+    const std::vector<char> zeroVertices(static_cast<std::size_t>(meshBuffer->GetDesc().size), 0);
+    Buffer* secondaryVertexBuffer = renderer->CreateBuffer(meshBuffer->GetDesc(), zeroVertices.data());
+
+    // Create two resource heaps with different constant buffers
+    sceneConstants = SceneConstants{};
+    renderer->WriteBuffer(*sceneCbuffer, 0, &sceneConstants, sizeof(sceneConstants));
+
+    Buffer* secondarySceneBuffer = renderer->CreateBuffer(ConstantBufferDesc(sizeof(SceneConstants)), &sceneConstants);
+
+    ResourceHeap* resourceHeaps[2] =
+    {
+        renderer->CreateResourceHeap(heapLayout, { sceneCbuffer }),
+        renderer->CreateResourceHeap(heapLayout, { secondarySceneBuffer }),
+    };
+
+    // Initialize bundle with all states that are shared between the patterns
+    const IndexedTriangleMesh& mesh = models[ModelCube];
+
+    DrawCallPatternBundle bundle;
+    {
+        bundle.vertexBuffers[0]     = meshBuffer;
+        bundle.vertexBuffers[1]     = secondaryVertexBuffer;
+        bundle.indexBuffer          = meshBuffer;
+        bundle.indexBufferOffset    = mesh.indexBufferOffset;
+        bundle.numIndices           = mesh.numIndices;
+        bundle.sceneBuffer          = sceneCbuffer;
+        bundle.resourceHeaps[0]     = resourceHeaps[0];
+        bundle.resourceHeaps[1]     = resourceHeaps[1];
+        bundle.colorMap             = textures[TextureGrid10x10];
+    }
+
+    bundle.uniforms[0].wMatrix.LoadIdentity();
+    bundle.uniforms[0].solidColor = { 1.0f, 1.0f, 0.0f, 1.0f };
+    bundle.uniforms[1].wMatrix.LoadIdentity();
+    bundle.uniforms[1].solidColor = { 0.0f, 1.0f, 1.0f, 1.0f };
+
+    // Create one command buffer per thread
+    std::vector<CommandBuffer*> cmdBuffers(opt.benchmarkThreads);
+    for (CommandBuffer*& threadCmdBuffer : cmdBuffers)
+        threadCmdBuffer = renderer->CreateCommandBuffer();
+
+    const DrawCallPattern patterns[] =
+    {
+        DrawCallPattern::NoStateChange,
+        DrawCallPattern::VertexBufferChange,
+        DrawCallPattern::ResourceHeapChange,
+        DrawCallPattern::PSOChange,
+        DrawCallPattern::UniformsChange,
+    };
+
+    TestResult result = TestResult::Passed;
+
+    for (DrawCallPattern pattern : patterns)
+    {
+        bundle.pattern = pattern;
+
+        switch (pattern)
+        {
+            case DrawCallPattern::ResourceHeapChange:
+                bundle.pso[0] = heapPSO;
+                bundle.pso[1] = heapPSO;
+                break;
+            case DrawCallPattern::UniformsChange:
+                bundle.pso[0] = uniformsPSO;
+                bundle.pso[1] = uniformsPSO;
+                break;
+            default:
+                bundle.pso[0] = solidPSOs[0];
+                bundle.pso[1] = solidPSOs[1];
+                break;
+        }
+
+        if (bundle.pso[0] == nullptr)
+            continue;
+
+        for (unsigned numThreads = 1; numThreads <= opt.benchmarkThreads; numThreads *= 2)
+        {
+            const unsigned numDrawsPerThread = numDraws / numThreads;
+
+            const std::string name = std::string("DrawCallPatterns.") + DrawCallPatternToStr(pattern) + ".Threads" + std::to_string(numThreads);
+
+            result = MeasureBenchmark(
+                name.c_str(), BenchmarkUnit::OperationsPerSecond, numDrawsPerThread * numThreads,
+                [&]() -> std::uint64_t
+                {
+                    const std::uint64_t startTime = Timer::Tick();
+
+                    // Record command buffers in parallel; only the first one clears the render target
+                    std::vector<std::thread> workers(numThreads);
+                    for_range(i, numThreads)
+                    {
+                        workers[i] = std::thread(
+                            RecordDrawCallPattern, std::ref(*cmdBuffers[i]), std::ref(*benchmarkTarget), std::cref(bundle), numDrawsPerThread, (i == 0)
+                        );
+                    }
+
+                    for (std::thread& worker : workers)
+                        worker.join();
+
+                    for_range(i, numThreads)
+                        cmdQueue->Submit(*cmdBuffers[i]);
+
+                    return (Timer::Tick() - startTime);
+                }
+            );
+
+            if (result != TestResult::Passed)
+                break;
+        }
+
+        if (result != TestResult::Passed)
+            break;
+    }
+
+    // Release resources
+    cmdQueue->WaitIdle();
+
+    for (CommandBuffer* threadCmdBuffer : cmdBuffers)
+        renderer->Release(*threadCmdBuffer);
+
+    renderer->Release(*resourceHeaps[0]);
+    renderer->Release(*resourceHeaps[1]);
+    renderer->Release(*secondarySceneBuffer);
+    renderer->Release(*secondaryVertexBuffer);
+    renderer->Release(*solidPSOs[0]);
+    renderer->Release(*solidPSOs[1]);
+    renderer->Release(*heapPSO);
+    renderer->Release(*heapLayout);
+
+    if (uniformsPSO != nullptr)
+        renderer->Release(*uniformsPSO);
+    if (uniformsLayout != nullptr)
+        renderer->Release(*uniformsLayout);
+
+    return result;
+}
+
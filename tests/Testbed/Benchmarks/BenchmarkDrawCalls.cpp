@@ -0,0 +1,79 @@
+/*
+ * BenchmarkDrawCalls.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+
+
+// Measures the average time per draw call, including command recording, submission, and GPU execution.
+DEF_BENCHMARK( DrawCalls )
+{
+    if (shaders[VSSolid] == nullptr || shaders[PSSolid] == nullptr)
+    {
+        Log::Errorf("Missing shaders for backend\n");
+        return TestResult::FailedErrors;
+    }
+
+    GraphicsPipelineDescriptor psoDesc;
+    {
+        psoDesc.pipelineLayout      = layouts[PipelineSolid];
+        psoDesc.renderPass          = benchmarkTarget->GetRenderPass();
+        psoDesc.vertexShader        = shaders[VSSolid];
+        psoDesc.fragmentShader      = shaders[PSSolid];
+        psoDesc.rasterizer.cullMode = CullMode::Back;
+    }
+    PipelineState* pso = renderer->CreatePipelineState(psoDesc);
+
+    if (const Report* report = pso->GetReport())
+    {
+        if (report->HasErrors())
+        {
+            Log::Errorf("PSO creation failed:\n%s", report->GetText());
+            return TestResult::FailedErrors;
+        }
+    }
+
+    sceneConstants = SceneConstants{};
+    renderer->WriteBuffer(*sceneCbuffer, 0, &sceneConstants, sizeof(sceneConstants));
+
+    constexpr unsigned numDraws = 1000;
+
+    const IndexedTriangleMesh& mesh = models[ModelCube];
+
+    const TestResult result = MeasureBenchmark(
+        "DrawCalls", BenchmarkUnit::Nanoseconds, numDraws,
+        [&]() -> std::uint64_t
+        {
+            const std::uint64_t startTime = Timer::Tick();
+
+            cmdBuffer->Begin();
+            {
+                cmdBuffer->SetVertexBuffer(*meshBuffer);
+                cmdBuffer->SetIndexBuffer(*meshBuffer, Format::R32UInt, mesh.indexBufferOffset);
+                cmdBuffer->SetPipelineState(*pso);
+
+                cmdBuffer->BeginRenderPass(*benchmarkTarget);
+                {
+                    cmdBuffer->Clear(ClearFlags::Color);
+                    cmdBuffer->SetViewport(benchmarkTarget->GetResolution());
+                    cmdBuffer->SetResource(0, *sceneCbuffer);
+                    for_range(i, numDraws)
+                        cmdBuffer->DrawIndexed(mesh.numIndices, 0);
+                }
+                cmdBuffer->EndRenderPass();
+            }
+            cmdBuffer->End();
+            cmdQueue->WaitIdle();
+
+            return (Timer::Tick() - startTime);
+        }
+    );
+
+    renderer->Release(*pso);
+
+    return result;
+}
+
@@ -0,0 +1,155 @@
+/*
+ * BenchmarkPipelineCreation.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <vector>
+
+
+/*
+Measures the latency of creating graphics PSOs for several shader/state permutations (see p50/p99 in the results):
+without pipeline cache, with an empty (cold) pipeline cache, with a pipeline cache that was primed with all permutations (warm),
+and with a pipeline cache that was reloaded from the blob of the primed cache as it would be on the next application start.
+*/
+DEF_BENCHMARK( PipelineCreation )
+{
+    if (shaders[VSSolid] == nullptr || shaders[PSSolid] == nullptr || shaders[VSTextured] == nullptr || shaders[PSTextured] == nullptr)
+    {
+        Log::Errorf("Missing shaders for backend\n");
+        return TestResult::FailedErrors;
+    }
+
+    // Generate PSO descriptors for all permutations of shaders, cull modes, blending, and primitive topologies
+    const CullMode cullModes[] = { CullMode::Disabled, CullMode::Back, CullMode::Front };
+    const PrimitiveTopology topologies[] = { PrimitiveTopology::TriangleList, PrimitiveTopology::TriangleStrip };
+
+    std::vector<GraphicsPipelineDescriptor> permutations;
+
+    for_range(shaderIndex, 2)
+    {
+        for (CullMode cullMode : cullModes)
+        {
+            for_range(blendIndex, 2)
+            {
+                for (PrimitiveTopology topology : topologies)
+                {
+                    GraphicsPipelineDescriptor psoDesc;
+                    {
+                        psoDesc.pipelineLayout                  = layouts[shaderIndex == 0 ? PipelineSolid : PipelineTextured];
+                        psoDesc.renderPass                      = benchmarkTarget->GetRenderPass();
+                        psoDesc.vertexShader                    = shaders[shaderIndex == 0 ? VSSolid : VSTextured];
+                        psoDesc.fragmentShader                  = shaders[shaderIndex == 0 ? PSSolid : PSTextured];
+                        psoDesc.primitiveTopology               = topology;
+                        psoDesc.rasterizer.cullMode             = cullMode;
+                        psoDesc.blend.targets[0].blendEnabled   = (blendIndex != 0);
+                    }
+                    permutations.push_back(psoDesc);
+                }
+            }
+        }
+    }
+
+    const unsigned numPermutations  = static_cast<unsigned>(permutations.size());
+    const unsigned numSamples       = numPermutations * (opt.fastTest ? 1 : 4);
+
+    bool failed = false;
+
+    auto CreateAndReleasePSO = [this, &failed](const GraphicsPipelineDescriptor& psoDesc, PipelineCache* cache) -> std::uint64_t
+    {
+        const std::uint64_t startTime = Timer::Tick();
+        PipelineState* pso = renderer->CreatePipelineState(psoDesc, cache);
+        const std::uint64_t elapsedTime = Timer::Tick() - startTime;
+
+        if (const Report* report = pso->GetReport())
+        {
+            if (report->HasErrors())
+            {
+                if (!failed)
+                    Log::Errorf("PSO creation failed:\n%s", report->GetText());
+                failed = true;
+            }
+        }
+        renderer->Release(*pso);
+
+        return elapsedTime;
+    };
+
+    // Each sample creates the next permutation
+    auto MeasurePipelineCreation = [&](const char* name, const std::function<PipelineCache*()>& acquireCache) -> TestResult
+    {
+        unsigned sampleIndex = 0;
+        return MeasureBenchmark(
+            name, BenchmarkUnit::Microseconds, 1.0,
+            [&]() -> std::uint64_t
+            {
+                const GraphicsPipelineDescriptor& psoDesc = permutations[(sampleIndex++) % numPermutations];
+                return CreateAndReleasePSO(psoDesc, acquireCache());
+            },
+            numSamples
+        );
+    };
+
+    TestResult result = MeasurePipelineCreation(
+        "PipelineCreation.Uncached",
+        []() -> PipelineCache* { return nullptr; }
+    );
+
+    // Create a new empty pipeline cache for each sample
+    PipelineCache* coldCache = nullptr;
+
+    if (result == TestResult::Passed)
+    {
+        result = MeasurePipelineCreation(
+            "PipelineCreation.ColdCache",
+            [this, &coldCache]() -> PipelineCache*
+            {
+                if (coldCache != nullptr)
+                    renderer->Release(*coldCache);
+                coldCache = renderer->CreatePipelineCache();
+                return coldCache;
+            }
+        );
+    }
+
+    if (coldCache != nullptr)
+        renderer->Release(*coldCache);
+
+    // Prime pipeline cache with all permutations
+    PipelineCache* warmCache = renderer->CreatePipelineCache();
+
+    for (const GraphicsPipelineDescriptor& psoDesc : permutations)
+        CreateAndReleasePSO(psoDesc, warmCache);
+
+    if (result == TestResult::Passed)
+    {
+        result = MeasurePipelineCreation(
+            "PipelineCreation.WarmCache",
+            [warmCache]() -> PipelineCache* { return warmCache; }
+        );
+    }
+
+    // Reload pipeline cache from the blob of the primed cache
+    Blob cacheBlob = warmCache->GetBlob();
+    renderer->Release(*warmCache);
+
+    PipelineCache* reloadedCache = renderer->CreatePipelineCache(cacheBlob);
+
+    if (result == TestResult::Passed)
+    {
+        result = MeasurePipelineCreation(
+            "PipelineCreation.ReloadedCache",
+            [reloadedCache]() -> PipelineCache* { return reloadedCache; }
+        );
+    }
+
+    renderer->Release(*reloadedCache);
+
+    if (failed)
+        return TestResult::FailedErrors;
+
+    return result;
+}
+
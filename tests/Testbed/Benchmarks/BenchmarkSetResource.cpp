@@ -0,0 +1,94 @@
+/*
+ * BenchmarkSetResource.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+
+
+// Measures the CPU time of CommandBuffer::SetResource alternating between two constant buffers.
+DEF_BENCHMARK( SetResource )
+{
+    if (shaders[VSSolid] == nullptr || shaders[PSSolid] == nullptr)
+    {
+        Log::Errorf("Missing shaders for backend\n");
+        return TestResult::FailedErrors;
+    }
+
+    GraphicsPipelineDescriptor psoDesc;
+    {
+        psoDesc.pipelineLayout      = layouts[PipelineSolid];
+        psoDesc.renderPass          = benchmarkTarget->GetRenderPass();
+        psoDesc.vertexShader        = shaders[VSSolid];
+        psoDesc.fragmentShader      = shaders[PSSolid];
+        psoDesc.rasterizer.cullMode = CullMode::Back;
+    }
+    PipelineState* pso = renderer->CreatePipelineState(psoDesc);
+
+    if (const Report* report = pso->GetReport())
+    {
+        if (report->HasErrors())
+        {
+            Log::Errorf("PSO creation failed:\n%s", report->GetText());
+            return TestResult::FailedErrors;
+        }
+    }
+
+    // Create second constant buffer to alternate with, so backends cannot skip redundant bindings
+    sceneConstants = SceneConstants{};
+
+    BufferDescriptor cbufferDesc;
+    {
+        cbufferDesc.size        = sizeof(SceneConstants);
+        cbufferDesc.bindFlags   = BindFlags::ConstantBuffer;
+    }
+    CREATE_BUFFER(cbuffer2, cbufferDesc, "cbuffer2", &sceneConstants);
+
+    renderer->WriteBuffer(*sceneCbuffer, 0, &sceneConstants, sizeof(sceneConstants));
+
+    constexpr unsigned numBindings = 1000;
+
+    const IndexedTriangleMesh& mesh = models[ModelCube];
+
+    Buffer* const cbuffers[2] = { sceneCbuffer, cbuffer2 };
+
+    const TestResult result = MeasureBenchmark(
+        "SetResource", BenchmarkUnit::Nanoseconds, numBindings,
+        [&]() -> std::uint64_t
+        {
+            std::uint64_t elapsedTime = 0;
+
+            cmdBuffer->Begin();
+            {
+                cmdBuffer->SetVertexBuffer(*meshBuffer);
+                cmdBuffer->SetIndexBuffer(*meshBuffer, Format::R32UInt, mesh.indexBufferOffset);
+                cmdBuffer->SetPipelineState(*pso);
+
+                cmdBuffer->BeginRenderPass(*benchmarkTarget);
+                {
+                    cmdBuffer->SetViewport(benchmarkTarget->GetResolution());
+
+                    // Only measure the resource bindings; the final draw call ensures they are not discarded
+                    const std::uint64_t startTime = Timer::Tick();
+                    for_range(i, numBindings)
+                        cmdBuffer->SetResource(0, *cbuffers[i % 2]);
+                    elapsedTime = Timer::Tick() - startTime;
+
+                    cmdBuffer->DrawIndexed(mesh.numIndices, 0);
+                }
+                cmdBuffer->EndRenderPass();
+            }
+            cmdBuffer->End();
+
+            return elapsedTime;
+        }
+    );
+
+    renderer->Release(*cbuffer2);
+    renderer->Release(*pso);
+
+    return result;
+}
+
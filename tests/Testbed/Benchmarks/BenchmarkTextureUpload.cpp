@@ -0,0 +1,48 @@
+/*
+ * BenchmarkTextureUpload.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <vector>
+
+
+// Measures the bandwidth of RenderSystem::WriteTexture for an RGBA8 texture until the data is available to the GPU.
+DEF_BENCHMARK( TextureUpload )
+{
+    const std::uint32_t texSize = (opt.fastTest ? 1024u : 2048u);
+
+    TextureDescriptor texDesc;
+    {
+        texDesc.type        = TextureType::Texture2D;
+        texDesc.format      = Format::RGBA8UNorm;
+        texDesc.extent      = Extent3D{ texSize, texSize, 1 };
+        texDesc.bindFlags   = BindFlags::Sampled;
+        texDesc.mipLevels   = 1;
+    }
+    CREATE_TEXTURE(tex, texDesc, "tex{upload}", nullptr);
+
+    const std::size_t dataSize = static_cast<std::size_t>(texSize) * texSize * 4;
+    const std::vector<std::uint8_t> data(dataSize, 0xAB);
+
+    const ImageView imageView{ ImageFormat::RGBA, DataType::UInt8, data.data(), dataSize };
+    const TextureRegion region{ Offset3D{ 0, 0, 0 }, texDesc.extent };
+
+    const TestResult result = MeasureBenchmark(
+        "TextureUpload", BenchmarkUnit::MegabytesPerSecond, static_cast<double>(dataSize),
+        [&]() -> std::uint64_t
+        {
+            const std::uint64_t startTime = Timer::Tick();
+            renderer->WriteTexture(*tex, region, imageView);
+            cmdQueue->WaitIdle();
+            return (Timer::Tick() - startTime);
+        }
+    );
+
+    renderer->Release(*tex);
+
+    return result;
+}
+
@@ -0,0 +1,36 @@
+/*
+ * DeclBenchmarks.inl
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+
+/* --- Benchmarks (see '-b' option) --- */
+
+#ifndef DECL_BENCHMARK
+#   ifdef GATHER_KNOWN_TESTS
+#       define DECL_BENCHMARK(NAME) \
+            knownTests.push_back(#NAME)
+#   else
+#       define DECL_BENCHMARK(NAME) \
+            TestResult Benchmark##NAME()
+#   endif
+#endif
+
+// Command recording benchmarks
+DECL_BENCHMARK( DrawCalls );
+DECL_BENCHMARK( SetResource );
+DECL_BENCHMARK( CommandBufferRecordAndSubmit );
+DECL_BENCHMARK( DrawCallPatterns );
+
+// Resource benchmarks
+DECL_BENCHMARK( BufferUpload );
+DECL_BENCHMARK( TextureUpload );
+DECL_BENCHMARK( PipelineCreation );
+
+#undef DECL_BENCHMARK
+
+
+
+// ================================================================================
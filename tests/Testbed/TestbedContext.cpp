@@ -8,9 +8,19 @@
 #include "Testbed.h"
 #include <LLGL/Utils/TypeNames.h>
 #include <LLGL/Utils/Parse.h>
+#include <LLGL/ThreadPool.h>
 #include <Gauss/ProjectionMatrix4.h>
 #include <string.h>
 #include <fstream>
+#include <iterator>
+#include <cmath>
+#include <mutex>
+
+#if defined LLGL_ARCH_AMD64
+#   include <emmintrin.h>
+#elif defined LLGL_ARCH_ARM64
+#   include <arm_neon.h>
+#endif
 
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb/stb_image.h>
@@ -86,6 +96,19 @@ static std::vector<std::string> FindSelectedTests(int argc, char* argv[])
     return selection;
 }
 
+// Returns the positive integral value of the specified argument, e.g. "--samples=N", or the default value if the argument is missing or invalid.
+static unsigned FindPositiveArgument(int argc, char* argv[], const char* name, unsigned defaultValue)
+{
+    const char* value = nullptr;
+    if (HasArgument(argc, argv, name, &value) && *value != '\0')
+    {
+        const int intValue = std::atoi(value);
+        if (intValue > 0)
+            return static_cast<unsigned>(intValue);
+    }
+    return defaultValue;
+}
+
 static std::string SanitizePath(std::string path)
 {
     for (char& chr : path)
@@ -143,7 +166,10 @@ TestbedContext::TestbedContext(const char* moduleName, int version, int argc, ch
             if (isGpuDebugMode)
                 rendererDesc.flags = RenderSystemFlags::DebugDevice;
             if (isCpuDebugMode)
+            {
                 rendererDesc.debugger = &debugger;
+                debuggerAttached = true;
+            }
         }
 
         if (::strcmp(moduleName, "OpenGL") == 0)
@@ -301,6 +327,7 @@ unsigned TestbedContext::RunAllTests()
 
     // Run all command buffer tests
     RUN_TEST( CommandBufferSubmit         );
+    RUN_TEST( FenceTimeline               );
 
     // Run all resource tests
     RUN_TEST( BufferWriteAndRead          );
@@ -318,6 +345,7 @@ unsigned TestbedContext::RunAllTests()
     RUN_TEST( RenderTargetNAttachments    );
     RUN_TEST( MipMaps                     );
     RUN_TEST( PipelineCaching             );
+    RUN_TEST( ConcurrentPipelineCreation  );
 
     // Run all rendering tests
     RUN_TEST( DepthBuffer                 );
@@ -327,6 +355,8 @@ unsigned TestbedContext::RunAllTests()
     RUN_TEST( DualSourceBlending          );
     RUN_TEST( CommandBufferMultiThreading );
     RUN_TEST( CommandBufferSecondary      );
+    RUN_TEST( CommandBufferParallelRenderPass );
+    RUN_TEST( CommandBufferInterleavedBindings );
     RUN_TEST( TriangleStripCutOff         );
     RUN_TEST( TextureViews                );
     RUN_TEST( Uniforms                    );
@@ -341,6 +371,90 @@ unsigned TestbedContext::RunAllTests()
     return failures;
 }
 
+unsigned TestbedContext::RunAllBenchmarks()
+{
+    // Loading failed if there are already failures
+    if (failures > 0)
+    {
+        Log::Printf(" ==> LOADING FAILED\n", failures);
+        return failures;
+    }
+
+    // Check if there were any unknown benchmarks selected
+    if (!opt.selectedTests.empty())
+    {
+        std::vector<const char*> knownTests;
+        #define GATHER_KNOWN_TESTS
+        #include "Benchmarks/DeclBenchmarks.inl"
+        #undef GATHER_KNOWN_TESTS
+        PrintUnknownTests(opt.selectedTests, knownTests);
+    }
+
+    // Create offscreen render target that is shared between all benchmarks
+    RenderTargetDescriptor targetDesc;
+    {
+        targetDesc.debugName            = "benchmarkTarget";
+        targetDesc.resolution           = opt.resolution;
+        targetDesc.colorAttachments[0]  = Format::RGBA8UNorm;
+    }
+    benchmarkTarget = renderer->CreateRenderTarget(targetDesc);
+
+    #define RUN_BENCHMARK(NAME)                                 \
+        if (opt.ContainsTest(#NAME))                            \
+        {                                                       \
+            const TestResult result = Benchmark##NAME();        \
+            if (result != TestResult::Passed)                   \
+                RecordTestResult(result, #NAME);                \
+            LLGL::Surface::ProcessEvents();                     \
+        }
+
+    RUN_BENCHMARK( DrawCalls                    );
+    RUN_BENCHMARK( SetResource                  );
+    RUN_BENCHMARK( CommandBufferRecordAndSubmit );
+    RUN_BENCHMARK( DrawCallPatterns             );
+    RUN_BENCHMARK( BufferUpload                 );
+    RUN_BENCHMARK( TextureUpload                );
+    RUN_BENCHMARK( PipelineCreation             );
+
+    #undef RUN_BENCHMARK
+
+    renderer->Release(*benchmarkTarget);
+    benchmarkTarget = nullptr;
+
+    // Write results to JSON file, so they can be compared between runs
+    const std::string resultsFilename = opt.outputDir + moduleName + "/Benchmarks.json";
+    if (WriteBenchmarkResults(resultsFilename))
+    {
+        if (opt.verbose)
+            Log::Printf("Benchmark results written to: %s\n", resultsFilename.c_str());
+    }
+    else
+    {
+        Log::Errorf("Failed to write benchmark results: %s\n", resultsFilename.c_str());
+        ++failures;
+    }
+
+    // Update or compare against stored baseline of the current platform
+    const std::string baselineFilename = GetBenchmarkBaselineFilename();
+    if (opt.updateBaseline)
+    {
+        if (WriteBenchmarkResults(baselineFilename))
+            Log::Printf("Benchmark baseline updated: %s\n", baselineFilename.c_str());
+        else
+        {
+            Log::Errorf("Failed to write benchmark baseline: %s\n", baselineFilename.c_str());
+            ++failures;
+        }
+    }
+    else if (opt.compareBaseline)
+        failures += CompareBenchmarkBaseline(baselineFilename);
+
+    // Print summary
+    PrintTestSummary(failures);
+
+    return failures;
+}
+
 unsigned TestbedContext::RunRendererIndependentTests(int argc, char* argv[])
 {
     unsigned failures = 0;
@@ -370,9 +484,17 @@ unsigned TestbedContext::RunRendererIndependentTests(int argc, char* argv[])
 
     RUN_TEST( ContainerDynamicArray );
     RUN_TEST( ContainerSmallVector );
+    RUN_TEST( ContainerMemoryArena );
+    RUN_TEST( ContainerAllocator );
     RUN_TEST( ContainerUTF8String );
     RUN_TEST( ParseUtil );
     RUN_TEST( ImageConversions );
+    RUN_TEST( ImageMipChain );
+    RUN_TEST( Float16Conversions );
+    RUN_TEST( ThreadPool );
+    RUN_TEST( BlockDecompression );
+    RUN_TEST( BlockCompression );
+    RUN_TEST( ShaderCache );
 
     #undef RUN_TEST
 
@@ -740,15 +862,21 @@ static std::string FormatFloatArray(const float* data, std::size_t count, std::s
 TestbedContext::Options TestbedContext::ParseOptions(int argc, char* argv[])
 {
     Options opt;
-    opt.outputDir       = GetSanitizedOutputDir(argc, argv);
-    opt.verbose         = (HasArgument(argc, argv, "-v") || HasArgument(argc, argv, "--verbose"));
-    opt.pedantic        = (HasArgument(argc, argv, "-p") || HasArgument(argc, argv, "--pedantic"));
-    opt.greedy          = (HasArgument(argc, argv, "-g") || HasArgument(argc, argv, "--greedy"));
-    opt.sanityCheck     = (HasArgument(argc, argv, "-s") || HasArgument(argc, argv, "--sanity-check"));
-    opt.showTiming      = (HasArgument(argc, argv, "-t") || HasArgument(argc, argv, "--timing"));
-    opt.fastTest        = (HasArgument(argc, argv, "-f") || HasArgument(argc, argv, "--fast"));
-    opt.resolution      = { g_testbedWinSize[0], g_testbedWinSize[1] };
-    opt.selectedTests   = FindSelectedTests(argc, argv);
+    opt.outputDir        = GetSanitizedOutputDir(argc, argv);
+    opt.verbose          = (HasArgument(argc, argv, "-v") || HasArgument(argc, argv, "--verbose"));
+    opt.pedantic         = (HasArgument(argc, argv, "-p") || HasArgument(argc, argv, "--pedantic"));
+    opt.greedy           = (HasArgument(argc, argv, "-g") || HasArgument(argc, argv, "--greedy"));
+    opt.sanityCheck      = (HasArgument(argc, argv, "-s") || HasArgument(argc, argv, "--sanity-check"));
+    opt.showTiming       = (HasArgument(argc, argv, "-t") || HasArgument(argc, argv, "--timing"));
+    opt.fastTest         = (HasArgument(argc, argv, "-f") || HasArgument(argc, argv, "--fast"));
+    opt.benchmark        = (HasArgument(argc, argv, "-b") || HasArgument(argc, argv, "--benchmark"));
+    opt.benchmarkSamples = FindPositiveArgument(argc, argv, "--samples", 20);
+    opt.benchmarkThreads = FindPositiveArgument(argc, argv, "--threads", 4);
+    opt.compareBaseline  = HasArgument(argc, argv, "--baseline");
+    opt.updateBaseline   = HasArgument(argc, argv, "--update-baseline");
+    opt.regressionThreshold = static_cast<double>(FindPositiveArgument(argc, argv, "--regression-threshold", 10));
+    opt.resolution       = { g_testbedWinSize[0], g_testbedWinSize[1] };
+    opt.selectedTests    = FindSelectedTests(argc, argv);
     return opt;
 }
 
@@ -1441,6 +1569,44 @@ static ColorRGBub GetHeatMapColor(int diff, int scale = 1)
     return ColorRGBub{ heapMapLUT[diff*3], heapMapLUT[diff*3+1], heapMapLUT[diff*3+2] };
 }
 
+// Writes the absolute difference of each pair of bytes into 'dst' and returns true if any of them differ.
+static bool GetByteDiffs(std::uint8_t* dst, const std::uint8_t* a, const std::uint8_t* b, std::size_t count)
+{
+    std::size_t i = 0;
+    bool differs = false;
+
+    #if defined LLGL_ARCH_AMD64
+    __m128i anyDiff = _mm_setzero_si128();
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i va    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        const __m128i vb    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        const __m128i diff  = _mm_or_si128(_mm_subs_epu8(va, vb), _mm_subs_epu8(vb, va));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), diff);
+        anyDiff = _mm_or_si128(anyDiff, diff);
+    }
+    differs = (_mm_movemask_epi8(_mm_cmpeq_epi8(anyDiff, _mm_setzero_si128())) != 0xFFFF);
+    #elif defined LLGL_ARCH_ARM64
+    uint8x16_t anyDiff = vdupq_n_u8(0);
+    for (; i + 16 <= count; i += 16)
+    {
+        const uint8x16_t diff = vabdq_u8(vld1q_u8(a + i), vld1q_u8(b + i));
+        vst1q_u8(dst + i, diff);
+        anyDiff = vorrq_u8(anyDiff, diff);
+    }
+    differs = (vmaxvq_u8(anyDiff) != 0);
+    #endif
+
+    for (; i < count; ++i)
+    {
+        dst[i] = static_cast<std::uint8_t>(GetColorDiff(a[i], b[i]));
+        if (dst[i] != 0)
+            differs = true;
+    }
+
+    return differs;
+}
+
 TestbedContext::DiffResult TestbedContext::DiffImages(const std::string& name, int threshold, unsigned tolerance, int scale)
 {
     // Load input images and validate they have the same dimensions
@@ -1452,9 +1618,26 @@ TestbedContext::DiffResult TestbedContext::DiffImages(const std::string& name, i
     const std::string refPath       = "Reference/";
     const std::string diffPath      = opt.outputDir + moduleName + "/";
 
-    if (!LoadImage(pixelsA, extentA, refPath + name + ".Ref.png", opt.verbose))
+    // Decode both PNG files concurrently, since decoding dominates the evaluation time
+    bool loadedA = false, loadedB = false;
+    ThreadPool::GetGlobal().ParallelRange(
+        [&](std::size_t begin, std::size_t end)
+        {
+            for_subrange(i, begin, end)
+            {
+                if (i == 0)
+                    loadedA = LoadImage(pixelsA, extentA, refPath + name + ".Ref.png", opt.verbose);
+                else
+                    loadedB = LoadImage(pixelsB, extentB, resultPath + name + ".Result.png", opt.verbose);
+            }
+        },
+        2,
+        2
+    );
+
+    if (!loadedA)
         return DiffErrorLoadRefFailed;
-    if (!LoadImage(pixelsB, extentB, resultPath + name + ".Result.png", opt.verbose))
+    if (!loadedB)
         return DiffErrorLoadResultFailed;
 
     if (extentA != extentB)
@@ -1467,26 +1650,60 @@ TestbedContext::DiffResult TestbedContext::DiffImages(const std::string& name, i
     if (opt.verbose)
         result.ResetHistogram(&histogram_);
 
-    for_range(i, pixelsDiff.size())
+    const ColorRGBub heatmapColorZero = GetHeatMapColor(0, scale);
+    std::mutex resultMutex;
+
+    // Compare rows in parallel; each work item accumulates its own result, which is merged once it is done
+    auto DiffRows = [&](std::size_t rowBegin, std::size_t rowEnd)
     {
-        const ColorRGBub& colorA = pixelsA[i];
-        const ColorRGBub& colorB = pixelsB[i];
-        int diff[3] =
+        Histogram rangeHistogram;
+        DiffResult rangeResult{ result.threshold, result.tolerance };
+        rangeResult.ResetHistogram(result.histogram != nullptr ? &rangeHistogram : nullptr);
+
+        const std::size_t width = extentA.width;
+        std::vector<std::uint8_t> rowDiffs(width * 3);
+
+        for_subrange(y, rowBegin, rowEnd)
         {
-            GetColorDiff(colorA.r, colorB.r),
-            GetColorDiff(colorA.g, colorB.g),
-            GetColorDiff(colorA.b, colorB.b),
-        };
-        const int maxDiff = std::max(std::max(diff[0], diff[1]), diff[2]);
-        const ColorRGBub heatmapColor = GetHeatMapColor(maxDiff, scale);
+            const std::size_t rowOffset = y * width;
+            ColorRGBAub* dstRow = &pixelsDiff[rowOffset];
+            const bool rowDiffers = GetByteDiffs(
+                rowDiffs.data(),
+                reinterpret_cast<const std::uint8_t*>(&pixelsA[rowOffset]),
+                reinterpret_cast<const std::uint8_t*>(&pixelsB[rowOffset]),
+                rowDiffs.size()
+            );
 
-        pixelsDiff[i].r = heatmapColor.r;
-        pixelsDiff[i].g = heatmapColor.g;
-        pixelsDiff[i].b = heatmapColor.b;
-        pixelsDiff[i].a = (maxDiff > 0 ? 255 : 0);
+            if (!rowDiffers)
+            {
+                // Skip per-pixel evaluation for identical rows, which is the common case
+                for_range(x, width)
+                    dstRow[x] = ColorRGBAub{ heatmapColorZero.r, heatmapColorZero.g, heatmapColorZero.b, 0 };
+                continue;
+            }
 
-        result.Add(maxDiff);
-    }
+            for_range(x, width)
+            {
+                const std::uint8_t* diff = &rowDiffs[x * 3];
+                const int maxDiff = static_cast<int>(std::max(std::max(diff[0], diff[1]), diff[2]));
+                const ColorRGBub heatmapColor = GetHeatMapColor(maxDiff, scale);
+
+                dstRow[x].r = heatmapColor.r;
+                dstRow[x].g = heatmapColor.g;
+                dstRow[x].b = heatmapColor.b;
+                dstRow[x].a = (maxDiff > 0 ? 255 : 0);
+
+                rangeResult.Add(maxDiff);
+            }
+        }
+
+        std::lock_guard<std::mutex> guard{ resultMutex };
+        result.Merge(rangeResult);
+    };
+
+    constexpr std::size_t rowsPerWorkItem = 32;
+    const std::size_t numRows = extentA.height;
+    ThreadPool::GetGlobal().ParallelRange(DiffRows, numRows, (numRows + rowsPerWorkItem - 1) / rowsPerWorkItem);
 
     if (result.Mismatch())
     {
@@ -1506,6 +1723,290 @@ void TestbedContext::RecordTestResult(TestResult result, const char* name)
         ++failures;
 }
 
+static const char* BenchmarkUnitToStr(BenchmarkUnit unit)
+{
+    switch (unit)
+    {
+        case BenchmarkUnit::Nanoseconds:         return "ns";
+        case BenchmarkUnit::Microseconds:        return "us";
+        case BenchmarkUnit::MegabytesPerSecond:  return "MB/s";
+        case BenchmarkUnit::OperationsPerSecond: return "ops/s";
+        default:                                 return "";
+    }
+}
+
+// Converts the elapsed ticks of a single sample into the value of the specified benchmark unit.
+static double TicksToBenchmarkValue(std::uint64_t ticks, BenchmarkUnit unit, double workPerSample)
+{
+    const double seconds = static_cast<double>(ticks) / static_cast<double>(Timer::Frequency());
+    switch (unit)
+    {
+        case BenchmarkUnit::Nanoseconds:         return (seconds * 1.0e9) / workPerSample;
+        case BenchmarkUnit::Microseconds:        return (seconds * 1.0e6) / workPerSample;
+        case BenchmarkUnit::MegabytesPerSecond:  return (seconds > 0.0 ? (workPerSample / 1.0e6) / seconds : 0.0);
+        case BenchmarkUnit::OperationsPerSecond: return (seconds > 0.0 ? workPerSample / seconds : 0.0);
+        default:                                 return 0.0;
+    }
+}
+
+TestResult TestbedContext::MeasureBenchmark(
+    const char*                             name,
+    BenchmarkUnit                           unit,
+    double                                  workPerSample,
+    const std::function<std::uint64_t()>&   sample,
+    unsigned                                numSamples)
+{
+    constexpr unsigned numWarmupSamples = 3;
+
+    // Warm up caches and lazily initialized driver state before the actual measurement
+    for_range(i, numWarmupSamples)
+    {
+        cmdQueue->WaitIdle();
+        sample();
+    }
+
+    // Measure all samples
+    std::vector<double> values;
+    if (numSamples == 0)
+        numSamples = opt.benchmarkSamples;
+
+    values.reserve(numSamples);
+
+    for_range(i, numSamples)
+    {
+        cmdQueue->WaitIdle();
+        values.push_back(TicksToBenchmarkValue(sample(), unit, workPerSample));
+    }
+
+    if (values.empty())
+        return TestResult::FailedErrors;
+
+    // Evaluate statistics; the median is the primary value, since it is robust against outliers from the OS scheduler
+    BenchmarkResult result;
+    result.name     = name;
+    result.unit     = unit;
+    result.samples  = static_cast<unsigned>(values.size());
+
+    std::sort(values.begin(), values.end());
+    const std::size_t mid = values.size() / 2;
+    result.median   = (values.size() % 2 == 0 ? (values[mid - 1] + values[mid]) * 0.5 : values[mid]);
+    result.p99      = values[(values.size() * 99 + 99) / 100 - 1];
+    result.min      = values.front();
+    result.max      = values.back();
+
+    for (double val : values)
+        result.mean += val;
+    result.mean /= static_cast<double>(values.size());
+
+    for (double val : values)
+        result.stdDev += (val - result.mean) * (val - result.mean);
+    result.stdDev = std::sqrt(result.stdDev / static_cast<double>(values.size()));
+
+    Log::Printf(
+        "Benchmark %s: %.2f %s (p99 = %.2f, min = %.2f, max = %.2f, stddev = %.2f)\n",
+        name, result.median, BenchmarkUnitToStr(unit), result.p99, result.min, result.max, result.stdDev
+    );
+    ::fflush(stdout);
+
+    benchmarkResults_.push_back(result);
+
+    return TestResult::Passed;
+}
+
+static std::string EscapeJSONString(const std::string& str)
+{
+    std::string escaped;
+    escaped.reserve(str.size());
+    for (char chr : str)
+    {
+        switch (chr)
+        {
+            case '"':   escaped += "\\\""; break;
+            case '\\':  escaped += "\\\\"; break;
+            case '\n':  escaped += "\\n";  break;
+            case '\t':  escaped += "\\t";  break;
+            default:
+                if (static_cast<unsigned char>(chr) >= 0x20)
+                    escaped += chr;
+                break;
+        }
+    }
+    return escaped;
+}
+
+bool TestbedContext::WriteBenchmarkResults(const std::string& filename) const
+{
+    std::ofstream file{ filename };
+    if (!file.good())
+        return false;
+
+    const RendererInfo& info = renderer->GetRendererInfo();
+
+    file << "{\n";
+    file << "  \"module\": \"" << EscapeJSONString(moduleName) << "\",\n";
+    file << "  \"renderer\": \"" << EscapeJSONString(info.rendererName) << "\",\n";
+    file << "  \"device\": \"" << EscapeJSONString(info.deviceName) << "\",\n";
+    file << "  \"samples\": " << opt.benchmarkSamples << ",\n";
+    file << "  \"benchmarks\": [";
+
+    char valueStr[256];
+    for_range(i, benchmarkResults_.size())
+    {
+        const BenchmarkResult& result = benchmarkResults_[i];
+        ::snprintf(
+            valueStr, sizeof(valueStr),
+            "\"median\": %.4f, \"p99\": %.4f, \"mean\": %.4f, \"min\": %.4f, \"max\": %.4f, \"stddev\": %.4f, \"samples\": %u",
+            result.median, result.p99, result.mean, result.min, result.max, result.stdDev, result.samples
+        );
+        file << (i > 0 ? ",\n" : "\n");
+        file << "    { \"name\": \"" << EscapeJSONString(result.name) << "\", \"unit\": \"" << BenchmarkUnitToStr(result.unit) << "\", " << valueStr << " }";
+    }
+
+    file << "\n  ]\n";
+    file << "}\n";
+
+    return file.good();
+}
+
+static const char* GetPlatformName()
+{
+    #if defined LLGL_OS_WIN32
+    return "Win32";
+    #elif defined LLGL_OS_MACOS
+    return "macOS";
+    #elif defined LLGL_OS_IOS
+    return "iOS";
+    #elif defined LLGL_OS_ANDROID
+    return "Android";
+    #elif defined LLGL_OS_LINUX
+    return "Linux";
+    #else
+    return "Unknown";
+    #endif
+}
+
+std::string TestbedContext::GetBenchmarkBaselineFilename() const
+{
+    return std::string("Reference/Benchmarks.") + GetPlatformName() + "." + moduleName + ".json";
+}
+
+// Finds the value of the specified key in a flat JSON object. This only supports the format that is written by WriteBenchmarkResults.
+static const char* FindJSONValue(const std::string& object, const char* key)
+{
+    const std::string search = std::string("\"") + key + "\":";
+    const std::size_t pos = object.find(search);
+    if (pos == std::string::npos)
+        return nullptr;
+    const char* value = object.c_str() + pos + search.size();
+    while (*value == ' ')
+        ++value;
+    return value;
+}
+
+static std::string FindJSONString(const std::string& object, const char* key)
+{
+    std::string str;
+    if (const char* value = FindJSONValue(object, key))
+    {
+        if (*value++ == '"')
+        {
+            for (; *value != '\0' && *value != '"'; ++value)
+            {
+                if (*value == '\\' && value[1] != '\0')
+                    ++value;
+                str += *value;
+            }
+        }
+    }
+    return str;
+}
+
+static double FindJSONNumber(const std::string& object, const char* key)
+{
+    const char* value = FindJSONValue(object, key);
+    return (value != nullptr ? std::atof(value) : 0.0);
+}
+
+unsigned TestbedContext::CompareBenchmarkBaseline(const std::string& filename) const
+{
+    std::ifstream file{ filename };
+    if (!file.good())
+    {
+        // Missing baselines are not a failure, so new platforms and modules can be added before their baseline is stored
+        Log::Printf("No benchmark baseline found: %s (use --update-baseline to create it)\n", filename.c_str());
+        return 0;
+    }
+
+    const std::string content{ std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+    const std::size_t benchmarksPos = content.find("\"benchmarks\"");
+    if (benchmarksPos == std::string::npos)
+    {
+        Log::Errorf("Invalid benchmark baseline: %s\n", filename.c_str());
+        return 1;
+    }
+
+    const std::string header = content.substr(0, benchmarksPos);
+    const std::string baselineDevice = FindJSONString(header, "device");
+    const RendererInfo& info = renderer->GetRendererInfo();
+    if (baselineDevice != info.deviceName)
+        Log::Printf("Benchmark baseline was recorded on a different device: %s\n", baselineDevice.c_str());
+
+    constexpr double minTValue = 3.0; // Welch's t-value for a significance of roughly 99.7%
+
+    unsigned regressions = 0;
+    for (std::size_t begin = content.find('{', benchmarksPos); begin != std::string::npos; begin = content.find('{', begin + 1))
+    {
+        const std::size_t end = content.find('}', begin);
+        if (end == std::string::npos)
+            break;
+
+        const std::string entry = content.substr(begin, end - begin);
+        const std::string name = FindJSONString(entry, "name");
+
+        auto it = std::find_if(
+            benchmarkResults_.begin(), benchmarkResults_.end(),
+            [&name](const BenchmarkResult& result) { return (result.name == name); }
+        );
+        if (it == benchmarkResults_.end())
+            continue;
+
+        const BenchmarkResult& result = *it;
+        const double baseMedian     = FindJSONNumber(entry, "median");
+        const double baseMean       = FindJSONNumber(entry, "mean");
+        const double baseStdDev     = FindJSONNumber(entry, "stddev");
+        const double baseSamples    = std::max(1.0, FindJSONNumber(entry, "samples"));
+        if (baseMedian <= 0.0)
+            continue;
+
+        // Throughput units are better when higher, time units are better when lower
+        const bool higherIsBetter = (result.unit == BenchmarkUnit::MegabytesPerSecond || result.unit == BenchmarkUnit::OperationsPerSecond);
+        const double change = (result.median - baseMedian) / baseMedian * 100.0;
+        const double regression = (higherIsBetter ? -change : change);
+
+        // Welch's t-test on the means; identical zero variances are treated as significant
+        const double variance = (result.stdDev * result.stdDev) / std::max(1u, result.samples) + (baseStdDev * baseStdDev) / baseSamples;
+        const double tValue = (variance > 0.0 ? std::abs(result.mean - baseMean) / std::sqrt(variance) : minTValue);
+
+        if (regression > opt.regressionThreshold && tValue >= minTValue)
+        {
+            Log::Errorf(
+                "Benchmark regression %s: %.2f %s -> %.2f %s (%+.1f%%, t = %.1f)\n",
+                name.c_str(), baseMedian, BenchmarkUnitToStr(result.unit), result.median, BenchmarkUnitToStr(result.unit), change, tValue
+            );
+            ++regressions;
+        }
+        else if (opt.verbose)
+        {
+            Log::Printf(
+                "Benchmark %s: %.2f %s -> %.2f %s (%+.1f%%, t = %.1f)\n",
+                name.c_str(), baseMedian, BenchmarkUnitToStr(result.unit), result.median, BenchmarkUnitToStr(result.unit), change, tValue
+            );
+        }
+    }
+
+    return regressions;
+}
+
 
 /*
  * Options structure
@@ -1563,6 +2064,12 @@ void TestbedContext::Histogram::Add(int val)
     diffRangeCounts[val]++;
 }
 
+void TestbedContext::Histogram::Merge(const Histogram& rhs)
+{
+    for_range(i, rangeSize)
+        diffRangeCounts[i] += rhs.diffRangeCounts[i];
+}
+
 void TestbedContext::Histogram::Print(unsigned rows) const
 {
     if (rows < 2)
@@ -1679,6 +2186,18 @@ void TestbedContext::DiffResult::Add(int val)
     }
 }
 
+void TestbedContext::DiffResult::Merge(const DiffResult& rhs)
+{
+    // Don't merge difference if an error code has already been encoded (see DiffErrors)
+    if (value >= 0)
+    {
+        value = std::max(value, rhs.value);
+        count += rhs.count;
+        if (histogram != nullptr && rhs.histogram != nullptr)
+            histogram->Merge(*rhs.histogram);
+    }
+}
+
 bool TestbedContext::DiffResult::Mismatch() const
 {
     return (value > threshold && count > tolerance);
@@ -33,6 +33,14 @@ enum class TestResult
     FailedErrors,       // Test failed due to interface errors.
 };
 
+enum class BenchmarkUnit
+{
+    Nanoseconds,            // Time per operation in nanoseconds.
+    Microseconds,           // Time per operation in microseconds.
+    MegabytesPerSecond,     // Bandwidth in MB/s, i.e. the work per sample is specified in bytes.
+    OperationsPerSecond,    // Throughput in operations per second, e.g. draw calls per second.
+};
+
 class TestbedContext
 {
 
@@ -45,6 +53,12 @@ class TestbedContext
         // Runs all tests and returns the number of failed ones. If all succeeded, the return value is 0.
         unsigned RunAllTests();
 
+        /*
+        Runs all benchmarks, writes the results to "<outputDir>/<module>/Benchmarks.json", and returns the number of failed ones.
+        Significant regressions against the stored baseline "Reference/Benchmarks.<platform>.<module>.json" count as failures if '--baseline' is specified.
+        */
+        unsigned RunAllBenchmarks();
+
     public:
 
         static unsigned RunRendererIndependentTests(int argc, char* argv[]);
@@ -77,6 +91,22 @@ class TestbedContext
 
         bool HasCombinedSamplers() const;
 
+    protected:
+
+        /*
+        Measures the specified benchmark sample callback after a few warm-up samples and records the result under the specified name.
+        The callback must return the elapsed ticks for the amount of work per sample (see LLGL::Timer::Tick),
+        so each benchmark can exclude its setup from the measurement. The command queue is idle at the beginning of each sample.
+        If 'numSamples' is zero, the number of samples is determined by the '--samples' option.
+        */
+        TestResult MeasureBenchmark(
+            const char*                             name,
+            BenchmarkUnit                           unit,
+            double                                  workPerSample,
+            const std::function<std::uint64_t()>&   sample,
+            unsigned                                numSamples      = 0
+        );
+
     protected:
 
         enum Models
@@ -162,6 +192,12 @@ class TestbedContext
             bool                        sanityCheck;    // This is 'very verbose' and dumps out all intermediate data on successful tests
             bool                        showTiming;
             bool                        fastTest;       // Skip slow buffer/texture creations to speed up test run
+            bool                        benchmark;      // Run benchmarks instead of tests
+            unsigned                    benchmarkSamples;
+            unsigned                    benchmarkThreads;   // Maximum number of threads for multi-threaded benchmarks
+            bool                        compareBaseline;    // Compare benchmark results against the stored baseline of the current platform
+            bool                        updateBaseline;     // Replace the stored baseline of the current platform by the benchmark results
+            double                      regressionThreshold; // Minimum relative change (in percent) of a benchmark median to be reported as regression
             LLGL::Extent2D              resolution;
             std::vector<std::string>    selectedTests;
 
@@ -206,6 +242,7 @@ class TestbedContext
 
             void Reset();
             void Add(int val);
+            void Merge(const Histogram& rhs);
             void Print(unsigned rows = 10) const;
 
             unsigned diffRangeCounts[rangeSize] = {};
@@ -225,6 +262,9 @@ class TestbedContext
 
             void Add(int val);
 
+            // Merges the maximum difference, count, and histogram of the specified partial result into this result.
+            void Merge(const DiffResult& rhs);
+
             bool Mismatch() const;
 
             void ResetHistogram(Histogram* histogram);
@@ -239,6 +279,19 @@ class TestbedContext
             unsigned    count       = 0; // Number of different pixels;
         };
 
+        struct BenchmarkResult
+        {
+            std::string     name;
+            BenchmarkUnit   unit    = BenchmarkUnit::Nanoseconds;
+            double          median  = 0.0;
+            double          p99     = 0.0; // 99th percentile
+            double          mean    = 0.0;
+            double          min     = 0.0;
+            double          max     = 0.0;
+            double          stdDev  = 0.0;
+            unsigned        samples = 0;
+        };
+
         struct SceneConstants
         {
             Gs::Matrix4f vpMatrix;
@@ -256,6 +309,7 @@ class TestbedContext
         unsigned                        failures                = 0;
 
         LLGL::RenderingDebugger         debugger;
+        bool                            debuggerAttached        = false;
         LLGL::RenderSystemPtr           renderer;
         LLGL::RenderingCapabilities     caps;
         LLGL::SwapChain*                swapChain               = nullptr;
@@ -273,9 +327,12 @@ class TestbedContext
         LLGL::Sampler*                  samplers[SamplerCount]  = {};
         Gs::Matrix4f                    projection;
 
+        LLGL::RenderTarget*             benchmarkTarget         = nullptr; // Offscreen target for benchmarks, so they are not throttled by the swap-chain.
+
     private:
 
         #include "UnitTests/DeclTests.inl"
+        #include "Benchmarks/DeclBenchmarks.inl"
 
     private:
 
@@ -328,12 +385,21 @@ class TestbedContext
 
         void RecordTestResult(TestResult result, const char* name);
 
+        bool WriteBenchmarkResults(const std::string& filename) const;
+
+        // Returns the filename of the stored benchmark baseline for the current platform and module.
+        std::string GetBenchmarkBaselineFilename() const;
+
+        // Compares the benchmark results against the specified baseline file and returns the number of significant regressions.
+        unsigned CompareBenchmarkBaseline(const std::string& filename) const;
+
     private:
 
-        bool                    loadingShadersFailed_ = false;
-        Histogram               histogram_;
-        LLGL::Report            report_;
-        LLGL::Log::LogHandle    reportHandle_;
+        bool                            loadingShadersFailed_ = false;
+        Histogram                       histogram_;
+        std::vector<BenchmarkResult>    benchmarkResults_;
+        LLGL::Report                    report_;
+        LLGL::Log::LogHandle            reportHandle_;
 
 };
 
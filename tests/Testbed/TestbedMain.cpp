@@ -8,6 +8,13 @@
 #include "TestbedContext.h"
 #include <string>
 #include <regex>
+#include <thread>
+#include <fstream>
+#include <cstdlib>
+
+#ifndef _WIN32
+#   include <sys/wait.h>
+#endif
 
 
 using namespace LLGL;
@@ -21,7 +28,7 @@ static unsigned RunRendererIndependentTests(int argc, char* argv[])
     return failures;
 }
 
-static unsigned RunTestbedForRenderer(const char* moduleName, int version, int argc, char* argv[])
+static unsigned RunTestbedForRenderer(const char* moduleName, int version, bool benchmark, int argc, char* argv[])
 {
     if (version != 0)
         Log::Printf("Run Testbed: %s (%d)\n", moduleName, version);
@@ -29,7 +36,7 @@ static unsigned RunTestbedForRenderer(const char* moduleName, int version, int a
         Log::Printf("Run Testbed: %s\n", moduleName);
     TestbedContext::PrintSeparator();
     TestbedContext context{ moduleName, version, argc, argv };
-    unsigned failures = context.RunAllTests();
+    unsigned failures = (benchmark ? context.RunAllBenchmarks() : context.RunAllTests());
     TestbedContext::PrintSeparator();
     Log::Printf("\n");
     return failures;
@@ -85,6 +92,101 @@ static bool HasProgramArgument(int argc, char* argv[], const char* search)
     return false;
 }
 
+// Returns the positive integral value of the specified argument, e.g. "--jobs=N", or zero if the argument is missing or invalid.
+static unsigned FindPositiveProgramArgument(int argc, char* argv[], const char* name)
+{
+    const std::size_t nameLen = ::strlen(name);
+    for (int i = 1; i < argc; ++i)
+    {
+        if (::strncmp(argv[i], name, nameLen) == 0 && argv[i][nameLen] == '=')
+        {
+            const int value = std::atoi(argv[i] + nameLen + 1);
+            return static_cast<unsigned>(std::max(0, value));
+        }
+    }
+    return 0;
+}
+
+static std::string QuoteShellArgument(const char* arg)
+{
+    return std::string("\"") + arg + "\"";
+}
+
+// Runs the Testbed for the specified module in a separate process and writes its output into the specified log file. Returns the exit code of that process.
+static int RunTestbedProcess(const std::string& command, const std::string& logFilename)
+{
+    const std::string commandLine = command + " > " + QuoteShellArgument(logFilename.c_str()) + " 2>&1";
+    #ifdef _WIN32
+    // Wrap the entire command line in quotes, since cmd.exe strips the outer quotes
+    return std::system(("\"" + commandLine + "\"").c_str());
+    #else
+    const int status = std::system(commandLine.c_str());
+    return (WIFEXITED(status) ? WEXITSTATUS(status) : 1);
+    #endif
+}
+
+static void PrintLogFile(const std::string& logFilename)
+{
+    std::ifstream file{ logFilename };
+    std::string line;
+    while (std::getline(file, line))
+        Log::Printf("%s\n", line.c_str());
+}
+
+/*
+Runs the Testbed for each module in a separate process, so the modules are tested concurrently.
+Each process writes its output into a log file, which is printed in module order once all processes have finished.
+Returns the number of modules with failed tests.
+*/
+static unsigned RunTestbedProcesses(const std::vector<ModuleAndVersion>& modules, unsigned numJobs, int argc, char* argv[])
+{
+    // Forward all options to the sub-processes except the module names and the number of jobs
+    std::string options;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (argv[i][0] == '-' && ::strncmp(argv[i], "--jobs=", 7) != 0 && ::strncmp(argv[i], "-j=", 3) != 0)
+            options += " " + QuoteShellArgument(argv[i]);
+    }
+    options += " --subprocess";
+
+    std::vector<std::string> logFilenames(modules.size());
+    std::vector<int> exitCodes(modules.size(), 0);
+
+    for (std::size_t first = 0; first < modules.size(); first += numJobs)
+    {
+        const std::size_t last = std::min(first + numJobs, modules.size());
+        std::vector<std::thread> workers;
+        workers.reserve(last - first);
+
+        for (std::size_t i = first; i < last; ++i)
+        {
+            const std::string moduleArg = (modules[i].version != 0 ? "gl" + std::to_string(modules[i].version) : modules[i].name);
+            logFilenames[i] = "Testbed." + moduleArg + ".log";
+
+            const std::string command = QuoteShellArgument(argv[0]) + " " + QuoteShellArgument(moduleArg.c_str()) + options;
+            workers.emplace_back(
+                [&exitCodes, &logFilenames, command, i]()
+                {
+                    exitCodes[i] = RunTestbedProcess(command, logFilenames[i]);
+                }
+            );
+        }
+
+        for (std::thread& worker : workers)
+            worker.join();
+    }
+
+    unsigned modulesWithFailedTests = 0;
+    for (std::size_t i = 0; i < modules.size(); ++i)
+    {
+        PrintLogFile(logFilenames[i]);
+        std::remove(logFilenames[i].c_str());
+        if (exitCodes[i] != 0)
+            ++modulesWithFailedTests;
+    }
+    return modulesWithFailedTests;
+}
+
 static void PrintHelpDocs()
 {
     Log::Printf(
@@ -99,14 +201,21 @@ static void PrintHelpDocs()
         "  d3d12, dx12, direct3d12 ............ Direct3D 12 module\n"
         "\n"
         "OPTIONS:\n"
+        "  -b, --benchmark .................... Run benchmarks instead of tests; writes results to Output/MODULE/Benchmarks.json\n"
+        "  --baseline ......................... Fail benchmarks on significant regressions against Reference/Benchmarks.PLATFORM.MODULE.json\n"
+        "  --update-baseline .................. Replace Reference/Benchmarks.PLATFORM.MODULE.json by the benchmark results\n"
+        "  --regression-threshold=N ........... Minimum change (in percent) of a benchmark median for --baseline (default is 10)\n"
         "  -d, --debug ........................ Enable validation debug layers\n"
         "  -f, --fast ......................... Run fast test; skips certain configurations\n"
         "  -g, --greedy ....................... Keep running each test even after failure\n"
         "  -h, --help ......................... Print this help document\n"
+        "  -j=N, --jobs=N ..................... Test up to N modules concurrently, each in a separate process\n"
         "  -p, --pedantic ..................... Disable diff-checking threshold\n"
         "  -s, --santiy-check ................. Print some test results even on success\n"
         "  -t, --timing ....................... Print timing results\n"
         "  -v, --verbose ...................... Print more information\n"
+        "  --samples=N ........................ Number of samples per benchmark (default is 20)\n"
+        "  --threads=N ........................ Maximum number of threads for multi-threaded benchmarks (default is 4)\n"
     );
 }
 
@@ -139,17 +248,33 @@ int main(int argc, char* argv[])
 
     unsigned modulesWithFailedTests = 0;
 
+    // Benchmarks only run renderer specific measurements
+    const bool benchmark = (HasProgramArgument(argc, argv, "-b") || HasProgramArgument(argc, argv, "--benchmark"));
+
+    // Sub-processes of --jobs only run the tests of their module
+    const bool isSubprocess = HasProgramArgument(argc, argv, "--subprocess");
+
     // Run renderer independent tests
-    if (RunRendererIndependentTests(argc - 1, argv + 1) != 0)
+    if (!benchmark && !isSubprocess && RunRendererIndependentTests(argc - 1, argv + 1) != 0)
         ++modulesWithFailedTests;
 
-    // Run renderer specific tests
-    for (const ModuleAndVersion& module : enabledModules)
+    // Run renderer specific tests, optionally in separate processes
+    const unsigned numJobs = std::max(FindPositiveProgramArgument(argc, argv, "-j"), FindPositiveProgramArgument(argc, argv, "--jobs"));
+    if (numJobs > 1 && enabledModules.size() > 1 && !isSubprocess)
+        modulesWithFailedTests += RunTestbedProcesses(enabledModules, numJobs, argc, argv);
+    else
     {
-        if (RunTestbedForRenderer(module.name.c_str(), module.version, argc - 1, argv + 1) != 0)
-            ++modulesWithFailedTests;
+        for (const ModuleAndVersion& module : enabledModules)
+        {
+            if (RunTestbedForRenderer(module.name.c_str(), module.version, benchmark, argc - 1, argv + 1) != 0)
+                ++modulesWithFailedTests;
+        }
     }
 
+    // Sub-processes only report whether their module has failed
+    if (isSubprocess)
+        return (modulesWithFailedTests != 0 ? 1 : 0);
+
     // Print summary
     if (modulesWithFailedTests == 0)
         Log::Printf(" ==> ALL MODULES PASSED\n");
@@ -20,9 +20,17 @@
 
 DECL_RITEST( ContainerDynamicArray );
 DECL_RITEST( ContainerSmallVector );
+DECL_RITEST( ContainerMemoryArena );
+DECL_RITEST( ContainerAllocator );
 DECL_RITEST( ContainerUTF8String );
 DECL_RITEST( ParseUtil );
 DECL_RITEST( ImageConversions );
+DECL_RITEST( ImageMipChain );
+DECL_RITEST( Float16Conversions );
+DECL_RITEST( ThreadPool );
+DECL_RITEST( BlockDecompression );
+DECL_RITEST( BlockCompression );
+DECL_RITEST( ShaderCache );
 
 #undef DECL_RITEST
 
@@ -40,8 +48,11 @@ DECL_RITEST( ImageConversions );
 
 // Command buffer tests
 DECL_TEST( CommandBufferSubmit );
+DECL_TEST( FenceTimeline );
 DECL_TEST( CommandBufferSecondary );
 DECL_TEST( CommandBufferMultiThreading );
+DECL_TEST( CommandBufferParallelRenderPass );
+DECL_TEST( CommandBufferInterleavedBindings );
 
 // Resource tests
 DECL_TEST( BufferWriteAndRead );
@@ -59,6 +70,7 @@ DECL_TEST( RenderTarget1Attachment );
 DECL_TEST( RenderTargetNAttachments );
 DECL_TEST( MipMaps );
 DECL_TEST( PipelineCaching );
+DECL_TEST( ConcurrentPipelineCreation );
 
 // Rendering tests
 DECL_TEST( DepthBuffer );
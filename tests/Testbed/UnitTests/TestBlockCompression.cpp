@@ -0,0 +1,130 @@
+/*
+ * TestBlockCompression.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/ImageFlags.h>
+#include <LLGL/Utils/TypeNames.h>
+#include <math.h>
+
+
+DEF_RITEST( BlockCompression )
+{
+    // Compresses a 6x5x2 image with gradients along a single color axis, i.e. incomplete blocks on two slices, and decompresses it again
+    constexpr std::uint32_t imageWidth  = 6;
+    constexpr std::uint32_t imageHeight = 5;
+    constexpr std::uint32_t imageDepth  = 2;
+
+    std::uint8_t srcData[imageWidth * imageHeight * imageDepth][4];
+    for_range(z, imageDepth)
+    {
+        for_range(y, imageHeight)
+        {
+            for_range(x, imageWidth)
+            {
+                std::uint8_t* texel = srcData[(z * imageHeight + y) * imageWidth + x];
+                const std::uint32_t t = x + y * imageWidth;
+                texel[0] = static_cast<std::uint8_t>(t * 2 + z * 8);
+                texel[1] = static_cast<std::uint8_t>(255 - t * 2);
+                texel[2] = static_cast<std::uint8_t>(t);
+                texel[3] = static_cast<std::uint8_t>(x == 0 ? 0 : 255);
+            }
+        }
+    }
+
+    // Returns the root-mean-square error of the specified channels between the source image and the decompressed image
+    auto CompressAndMeasure = [&srcData](ImageFormat format, ImageCompressionQuality quality, std::uint32_t numChannels, double& outError) -> TestResult
+    {
+        const ImageView srcView{ ImageFormat::RGBA, DataType::UInt8, srcData, sizeof(srcData) };
+        DynamicByteArray compressedData = CompressImageBuffer(srcView, format, Extent3D{ imageWidth, imageHeight, imageDepth }, quality, LLGL_MAX_THREAD_COUNT);
+        if (!compressedData)
+        {
+            Log::Errorf("Failed to compress image with format %s\n", ToString(format));
+            return TestResult::FailedErrors;
+        }
+
+        double squaredError = 0.0;
+        std::size_t numValues = 0;
+
+        const std::size_t sliceSize = compressedData.size() / imageDepth;
+        for_range(z, imageDepth)
+        {
+            const ImageView compressedView{ format, DataType::UInt8, compressedData.get() + sliceSize * z, sliceSize };
+            DynamicByteArray dstData = DecompressImageBufferToRGBA8UNorm(compressedView, Extent2D{ imageWidth, imageHeight });
+            if (!dstData)
+            {
+                Log::Errorf("Failed to decompress image with format %s\n", ToString(format));
+                return TestResult::FailedErrors;
+            }
+
+            for_range(i, imageWidth * imageHeight)
+            {
+                const std::uint8_t* expected    = srcData[z * imageWidth * imageHeight + i];
+                const std::uint8_t* actual      = reinterpret_cast<const std::uint8_t*>(dstData.get()) + i * 4;
+
+                // BC1 encodes texels with alpha below 128 as transparent black
+                if (format == ImageFormat::BC1 && expected[3] < 128)
+                {
+                    if (actual[3] != 0)
+                    {
+                        Log::Errorf("Mismatch between punch-through alpha of decompressed texel [%u] of format %s (%u) and expected alpha (0)\n", i, ToString(format), actual[3]);
+                        return TestResult::FailedMismatch;
+                    }
+                    continue;
+                }
+
+                for_range(c, numChannels)
+                {
+                    const double d = static_cast<double>(actual[c]) - static_cast<double>(expected[c]);
+                    squaredError += d*d;
+                    ++numValues;
+                }
+            }
+        }
+
+        outError = ::sqrt(squaredError / static_cast<double>(numValues));
+        return TestResult::Passed;
+    };
+
+    struct TestFormat
+    {
+        ImageFormat     format;
+        std::uint32_t   numChannels;
+        double          maxError;
+    };
+
+    const TestFormat testFormats[] =
+    {
+        { ImageFormat::BC1, 3, 5.0 },
+        { ImageFormat::BC2, 4, 4.0 },
+        { ImageFormat::BC3, 4, 4.0 },
+        { ImageFormat::BC4, 1, 2.0 },
+        { ImageFormat::BC5, 2, 2.0 },
+    };
+
+    for (const TestFormat& test : testFormats)
+    {
+        for (ImageCompressionQuality quality : { ImageCompressionQuality::Fast, ImageCompressionQuality::Normal, ImageCompressionQuality::High })
+        {
+            double error = 0.0;
+            const TestResult result = CompressAndMeasure(test.format, quality, test.numChannels, error);
+            if (result != TestResult::Passed)
+                return result;
+
+            if (error > test.maxError)
+            {
+                Log::Errorf(
+                    "Root-mean-square error of compressed format %s with quality %d is too high (%.2f > %.2f)\n",
+                    ToString(test.format), static_cast<int>(quality), error, test.maxError
+                );
+                return TestResult::FailedMismatch;
+            }
+        }
+    }
+
+    return TestResult::Passed;
+}
+
@@ -0,0 +1,84 @@
+/*
+ * TestBlockDecompression.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/ImageFlags.h>
+#include <LLGL/Utils/TypeNames.h>
+#include <string.h>
+
+
+DEF_RITEST( BlockDecompression )
+{
+    // Decompresses a 5x5 image, i.e. 2x2 blocks of the same encoded block, and compares the first row of texels against the expected colors
+    auto TestBlock = [](ImageFormat format, DataType dataType, const std::uint8_t* block, std::size_t blockSize, const std::uint8_t (&expected)[4][4]) -> TestResult
+    {
+        constexpr std::uint32_t imageSize = 5;
+
+        char srcData[4 * 16];
+        for_range(i, 4)
+            ::memcpy(srcData + i * blockSize, block, blockSize);
+
+        for (unsigned threadCount : { 0u, LLGL_MAX_THREAD_COUNT })
+        {
+            const ImageView srcView{ format, dataType, srcData, blockSize * 4 };
+            DynamicByteArray dstData = DecompressImageBufferToRGBA8UNorm(srcView, Extent2D{ imageSize, imageSize }, threadCount);
+            if (!dstData)
+            {
+                Log::Errorf("Failed to decompress image with format %s\n", ToString(format));
+                return TestResult::FailedErrors;
+            }
+
+            // Compare all texels; the 5th row and column are clipped from the second block row and column
+            for_range(y, imageSize)
+            {
+                for_range(x, imageSize)
+                {
+                    const std::uint8_t* actual = reinterpret_cast<const std::uint8_t*>(dstData.get()) + (y * imageSize + x) * 4;
+                    const std::uint8_t* color = expected[x % 4];
+                    if (::memcmp(actual, color, 4) != 0)
+                    {
+                        Log::Errorf(
+                            "Mismatch between decompressed texel [%u,%u] of format %s (%u,%u,%u,%u) and expected color (%u,%u,%u,%u)\n",
+                            x, y, ToString(format),
+                            actual[0], actual[1], actual[2], actual[3],
+                            color[0], color[1], color[2], color[3]
+                        );
+                        return TestResult::FailedMismatch;
+                    }
+                }
+            }
+        }
+
+        return TestResult::Passed;
+    };
+
+    #define TEST_BLOCK(FORMAT, TYPE, BLOCK, ...)                                                                \
+        {                                                                                                       \
+            const std::uint8_t expected[4][4] = __VA_ARGS__;                                                    \
+            const TestResult result = TestBlock((FORMAT), (TYPE), (BLOCK), sizeof(BLOCK), expected);            \
+            if (result != TestResult::Passed)                                                                   \
+                return result;                                                                                  \
+        }
+
+    // BC1 in 4-color mode (red > blue) and 3-color mode with punch-through alpha (blue < red); each row uses indices 0, 1, 2, 3
+    const std::uint8_t bc1Block4[8] = { 0x00, 0xF8, 0x1F, 0x00, 0xE4, 0xE4, 0xE4, 0xE4 };
+    const std::uint8_t bc1Block3[8] = { 0x1F, 0x00, 0x00, 0xF8, 0xE4, 0xE4, 0xE4, 0xE4 };
+    TEST_BLOCK(ImageFormat::BC1, DataType::UInt8, bc1Block4, { { 255, 0, 0, 255 }, { 0, 0, 255, 255 }, { 170, 0, 85, 255 }, { 85, 0, 170, 255 } });
+    TEST_BLOCK(ImageFormat::BC1, DataType::UInt8, bc1Block3, { { 0, 0, 255, 255 }, { 255, 0, 0, 255 }, { 127, 0, 127, 255 }, { 0, 0, 0, 0 } });
+
+    // BC2 with explicit alpha 0x0, 0x5, 0xA, 0xF per row and 4-color block even though color0 < color1
+    const std::uint8_t bc2Block[16] = { 0x50, 0xFA, 0x50, 0xFA, 0x50, 0xFA, 0x50, 0xFA, 0x1F, 0x00, 0x00, 0xF8, 0xE4, 0xE4, 0xE4, 0xE4 };
+    TEST_BLOCK(ImageFormat::BC2, DataType::UInt8, bc2Block, { { 0, 0, 255, 0 }, { 255, 0, 0, 85 }, { 85, 0, 170, 170 }, { 170, 0, 85, 255 } });
+
+    // BC4 with 6 interpolated values (255 > 0) and indices 0, 1, 2, 7 per row
+    const std::uint8_t bc4Block[8] = { 0xFF, 0x00, 0x88, 0x8E, 0xE8, 0x88, 0x8E, 0xE8 };
+    TEST_BLOCK(ImageFormat::BC4, DataType::UInt8, bc4Block, { { 255, 0, 0, 255 }, { 0, 0, 0, 255 }, { 218, 0, 0, 255 }, { 36, 0, 0, 255 } });
+
+    return TestResult::Passed;
+}
+
+
@@ -82,6 +82,43 @@ DEF_TEST( BufferUpdate )
         }
     }
 
+    // Update large buffer with a single command that exceeds the inline limits of some backends; Use unaligned offset and size to test the staged path
+    constexpr std::uint64_t largeBufferSize = 256 * 1024;
+    constexpr std::uint64_t largeUpdateOffset = 2;
+    constexpr std::uint64_t largeUpdateSize = largeBufferSize - 7;
+
+    BufferDescriptor buf5Desc;
+    {
+        buf5Desc.size       = largeBufferSize;
+        buf5Desc.bindFlags  = BindFlags::VertexBuffer;
+    }
+    CREATE_BUFFER(buf5, buf5Desc, "buf5{size=256K,vert}", nullptr);
+
+    std::vector<std::uint8_t> largeUpdateData(static_cast<std::size_t>(largeUpdateSize));
+    for (std::size_t i = 0; i < largeUpdateData.size(); ++i)
+        largeUpdateData[i] = static_cast<std::uint8_t>((i * 7 + i / 251) & 0xFF);
+
+    cmdBuffer->Begin();
+    {
+        cmdBuffer->UpdateBuffer(*buf5, largeUpdateOffset, largeUpdateData.data(), largeUpdateSize);
+    }
+    cmdBuffer->End();
+
+    std::vector<std::uint8_t> largeReadbackData(largeUpdateData.size());
+    renderer->ReadBuffer(*buf5, largeUpdateOffset, largeReadbackData.data(), largeUpdateSize);
+
+    for (std::size_t i = 0; i < largeUpdateData.size(); ++i)
+    {
+        if (largeReadbackData[i] != largeUpdateData[i])
+        {
+            Log::Errorf(
+                "Mismatch between data of buffer \"%s\" readback data (offset = %" PRIu64 ") [0x%02X] and large update data [0x%02X]\n",
+                buf5_Name, largeUpdateOffset + i, largeReadbackData[i], largeUpdateData[i]
+            );
+            return TestResult::FailedMismatch;
+        }
+    }
+
     return TestResult::Passed;
 }
 
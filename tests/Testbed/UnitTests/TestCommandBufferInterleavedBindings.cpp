@@ -0,0 +1,195 @@
+/*
+ * TestCommandBufferInterleavedBindings.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <Gauss/Translate.h>
+#include <Gauss/Scale.h>
+
+
+/*
+Records a long run of draw calls with a different constant buffer bound before each draw.
+Backends that optimize their command streams (such as the GL backend fusing draw runs into multi-draw commands)
+must still emit each binding between the draws it was recorded with, so every quad must show its own color.
+*/
+DEF_TEST( CommandBufferInterleavedBindings )
+{
+    if (shaders[VSSolid] == nullptr || shaders[PSSolid] == nullptr)
+    {
+        Log::Errorf("Missing shaders for backend\n");
+        return TestResult::FailedErrors;
+    }
+
+    // Draw one more quad than the minimum run length the GL backend fuses into a single multi-draw command
+    constexpr unsigned numQuads = 20;
+
+    // Create graphics PSO without depth test, so each quad only depends on its own binding
+    GraphicsPipelineDescriptor psoDesc;
+    {
+        psoDesc.pipelineLayout      = layouts[PipelineSolid];
+        psoDesc.renderPass          = swapChain->GetRenderPass();
+        psoDesc.vertexShader        = shaders[VSSolid];
+        psoDesc.fragmentShader      = shaders[PSSolid];
+        psoDesc.rasterizer.cullMode = CullMode::Disabled;
+    }
+    PipelineState* pso = renderer->CreatePipelineState(psoDesc);
+
+    if (const Report* report = pso->GetReport())
+    {
+        if (report->HasErrors())
+        {
+            Log::Errorf("PSO creation failed:\n%s", report->GetText());
+            return TestResult::FailedErrors;
+        }
+    }
+
+    // Create one constant buffer per quad, each placing its quad into a single row across the framebuffer
+    Buffer* cbuffers[numQuads] = {};
+    Gs::Vector4f colors[numQuads];
+
+    for_range(i, numQuads)
+    {
+        colors[i] = Gs::Vector4f
+        {
+            0.1f + 0.8f * static_cast<float>(i % 4) / 3.0f,
+            0.1f + 0.8f * static_cast<float>(i / 4) / 4.0f,
+            0.5f,
+            1.0f
+        };
+
+        SceneConstants quadConstants;
+        {
+            quadConstants.vpMatrix.LoadIdentity();
+            quadConstants.wMatrix.LoadIdentity();
+            Gs::Translate(quadConstants.wMatrix, Gs::Vector3f{ -1.0f + static_cast<float>(i * 2 + 1) / numQuads, 0.0f, 0.0f });
+            Gs::Scale(quadConstants.wMatrix, Gs::Vector3f{ 1.0f / numQuads, 0.5f, 1.0f });
+            quadConstants.solidColor = colors[i];
+        }
+        BufferDescriptor bufDesc;
+        {
+            bufDesc.debugName   = "InterleavedBindings.cbuffer";
+            bufDesc.size        = sizeof(SceneConstants);
+            bufDesc.bindFlags   = BindFlags::ConstantBuffer;
+        }
+        cbuffers[i] = renderer->CreateBuffer(bufDesc, &quadConstants);
+    }
+
+    const IndexedTriangleMesh& mesh = models[ModelRect];
+
+    // Records all quads into a new command buffer with the specified flags and returns the captured framebuffer
+    auto RenderQuads = [&](long cmdBufferFlags) -> Texture*
+    {
+        CommandBufferDescriptor cmdBufferDesc;
+        cmdBufferDesc.flags = cmdBufferFlags;
+        CommandBuffer* cmdBuf = renderer->CreateCommandBuffer(cmdBufferDesc);
+
+        Texture* capture = nullptr;
+
+        cmdBuf->Begin();
+        {
+            cmdBuf->SetVertexBuffer(*meshBuffer);
+            cmdBuf->SetIndexBuffer(*meshBuffer, Format::R32UInt, mesh.indexBufferOffset);
+            cmdBuf->BeginRenderPass(*swapChain);
+            {
+                cmdBuf->Clear(ClearFlags::ColorDepth);
+                cmdBuf->SetViewport(swapChain->GetResolution());
+                cmdBuf->SetPipelineState(*pso);
+
+                for_range(i, numQuads)
+                {
+                    cmdBuf->SetResource(0, *cbuffers[i]);
+                    cmdBuf->DrawIndexed(mesh.numIndices, 0);
+                }
+
+                capture = CaptureFramebuffer(*cmdBuf, swapChain->GetColorFormat(), opt.resolution);
+            }
+            cmdBuf->EndRenderPass();
+        }
+        cmdBuf->End();
+
+        cmdQueue->Submit(*cmdBuf);
+        renderer->Release(*cmdBuf);
+
+        return capture;
+    };
+
+    // Reads the center pixel of each quad and compares it to the color of the constant buffer bound for that quad
+    auto EvaluateQuads = [&](Texture* capture, const char* cmdBufferName) -> TestResult
+    {
+        for_range(i, numQuads)
+        {
+            const std::int32_t x = static_cast<std::int32_t>(opt.resolution.width * (i * 2 + 1) / (numQuads * 2));
+            const std::int32_t y = static_cast<std::int32_t>(opt.resolution.height / 2);
+
+            float actualColor[4] = { -1.0f, -1.0f, -1.0f, -1.0f };
+            MutableImageView dstImageView;
+            {
+                dstImageView.format     = ImageFormat::RGBA;
+                dstImageView.dataType   = DataType::Float32;
+                dstImageView.data       = actualColor;
+                dstImageView.dataSize   = sizeof(actualColor);
+            }
+            renderer->ReadTexture(*capture, TextureRegion{ Offset3D{ x, y, 0 }, Extent3D{ 1, 1, 1 } }, dstImageView);
+
+            const Gs::Vector4f& expectedColor = colors[i];
+
+            constexpr float tolerance = 0.01f;
+            if (std::abs(actualColor[0] - expectedColor[0]) > tolerance ||
+                std::abs(actualColor[1] - expectedColor[1]) > tolerance ||
+                std::abs(actualColor[2] - expectedColor[2]) > tolerance ||
+                std::abs(actualColor[3] - expectedColor[3]) > tolerance)
+            {
+                Log::Errorf(
+                    "Mismatch in %s command buffer for quad [%u] at location (%d, %d):\n"
+                    " => expected color (%f, %f, %f, %f)\n"
+                    " => actual color   (%f, %f, %f, %f)\n",
+                    cmdBufferName, i, x, y,
+                    expectedColor[0], expectedColor[1], expectedColor[2], expectedColor[3],
+                    actualColor[0], actualColor[1], actualColor[2], actualColor[3]
+                );
+                return TestResult::FailedMismatch;
+            }
+        }
+        return TestResult::Passed;
+    };
+
+    // Render quads with a multi-submit command buffer, which the GL backend optimizes, and with a one-time submit command buffer, which must render the same
+    struct CmdBufferConfig
+    {
+        long        flags;
+        const char* name;
+    };
+
+    const CmdBufferConfig configs[] =
+    {
+        CmdBufferConfig{ CommandBufferFlags::MultiSubmit, "multi-submit" },
+        CmdBufferConfig{ 0,                               "one-time submit" },
+    };
+
+    TestResult result = TestResult::Passed;
+
+    for (const CmdBufferConfig& config : configs)
+    {
+        Texture* capture = RenderQuads(config.flags);
+        TestResult intermediateResult = EvaluateQuads(capture, config.name);
+        renderer->Release(*capture);
+
+        if (intermediateResult != TestResult::Passed)
+        {
+            result = intermediateResult;
+            if (!opt.greedy)
+                break;
+        }
+    }
+
+    // Clear resources
+    for (Buffer* cbuffer : cbuffers)
+        renderer->Release(*cbuffer);
+    renderer->Release(*pso);
+
+    return result;
+}
+
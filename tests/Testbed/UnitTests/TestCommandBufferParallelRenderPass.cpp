@@ -0,0 +1,271 @@
+/*
+ * TestCommandBufferParallelRenderPass.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ForRange.h>
+#include <LLGL/Utils/Utility.h>
+#include <Gauss/Translate.h>
+#include <Gauss/Rotate.h>
+#include <Gauss/Scale.h>
+#include <thread>
+#include <cstdlib>
+
+
+/*
+Splits a single render pass across multiple worker threads that record secondary command buffers
+and compares the encoding throughput against recording all draw commands into the primary command buffer.
+Both variants must produce the same image.
+*/
+DEF_TEST( CommandBufferParallelRenderPass )
+{
+    constexpr unsigned  numThreads          = 4;
+    constexpr unsigned  numDrawsPerThread   = 16;
+    constexpr unsigned  numDraws            = numThreads * numDrawsPerThread;
+    constexpr unsigned  numGridCells        = 8; // 8x8 grid of cubes
+    constexpr unsigned  numFrames           = 10;
+    constexpr int       diffThreshold       = 1;
+
+    static_assert(numGridCells * numGridCells == numDraws, "grid size must match number of draw commands");
+
+    if (shaders[VSSolid] == nullptr || shaders[PSSolid] == nullptr)
+    {
+        Log::Errorf("Missing shaders for backend\n");
+        return TestResult::FailedErrors;
+    }
+
+    // Command lists of deferred D3D11 contexts do not inherit the framebuffer of the calling context
+    if (renderer->GetRendererID() == RendererID::Direct3D11)
+        return TestResult::Skipped;
+
+    static CommandBuffer*   secondaryCmdBuffers [numThreads]    = {};
+    static Buffer*          sceneBuffers        [numDraws]      = {};
+    static Texture*         outputTextures      [2]             = {};
+    static RenderTarget*    renderTargets       [2]             = {};
+    static PipelineState*   pso;
+    static double           totalInlineTime;
+    static double           totalParallelTime;
+
+    const Extent2D texSize{ 256, 256 };
+
+    if (frame == 0)
+    {
+        // Reset time stats
+        totalInlineTime     = 0.0;
+        totalParallelTime   = 0.0;
+
+        // Create render targets for inline and parallel encoding
+        for_range(i, 2)
+        {
+            TextureDescriptor texDesc;
+            {
+                texDesc.extent.width    = texSize.width;
+                texDesc.extent.height   = texSize.height;
+                texDesc.mipLevels       = 1;
+            }
+            outputTextures[i] = renderer->CreateTexture(texDesc);
+
+            RenderTargetDescriptor rtDesc;
+            {
+                rtDesc.resolution               = texSize;
+                rtDesc.colorAttachments[0]      = outputTextures[i];
+                rtDesc.depthStencilAttachment   = Format::D16UNorm;
+            }
+            renderTargets[i] = renderer->CreateRenderTarget(rtDesc);
+        }
+
+        // Create graphics PSO
+        GraphicsPipelineDescriptor psoDesc;
+        {
+            psoDesc.pipelineLayout      = layouts[PipelineSolid];
+            psoDesc.renderPass          = renderTargets[0]->GetRenderPass();
+            psoDesc.vertexShader        = shaders[VSSolid];
+            psoDesc.fragmentShader      = shaders[PSSolid];
+            psoDesc.depth.testEnabled   = true;
+            psoDesc.depth.writeEnabled  = true;
+            psoDesc.rasterizer.cullMode = CullMode::Back;
+        }
+        pso = renderer->CreatePipelineState(psoDesc);
+
+        // Create secondary command buffers that continue the render pass of the primary command buffer
+        for_range(i, numThreads)
+        {
+            CommandBufferDescriptor cmdBufferDesc;
+            {
+                cmdBufferDesc.flags             = CommandBufferFlags::Secondary;
+                cmdBufferDesc.numNativeBuffers  = 1;
+                cmdBufferDesc.renderPass        = renderTargets[1]->GetRenderPass();
+            }
+            secondaryCmdBuffers[i] = renderer->CreateCommandBuffer(cmdBufferDesc);
+        }
+
+        // Create scene buffers for a grid of cubes
+        SceneConstants localSceneConstants;
+        LoadProjectionMatrix(localSceneConstants.vpMatrix);
+
+        for_range(i, numDraws)
+        {
+            const float x = static_cast<float>(i % numGridCells) - static_cast<float>(numGridCells - 1) * 0.5f;
+            const float y = static_cast<float>(i / numGridCells) - static_cast<float>(numGridCells - 1) * 0.5f;
+
+            localSceneConstants.solidColor = Gs::Vector4f{ 0.2f + 0.1f * (i % numGridCells), 0.2f + 0.1f * (i / numGridCells), 0.8f, 1.0f };
+
+            localSceneConstants.wMatrix.LoadIdentity();
+            Gs::Translate(localSceneConstants.wMatrix, Gs::Vector3f{ x, y, 10.0f });
+            Gs::RotateFree(localSceneConstants.wMatrix, Gs::Vector3f{ 1 }.Normalized(), Gs::Deg2Rad(static_cast<float>(i) * 15.0f));
+            Gs::Scale(localSceneConstants.wMatrix, Gs::Vector3f{ 0.3f });
+
+            sceneBuffers[i] = renderer->CreateBuffer(ConstantBufferDesc(sizeof(SceneConstants)), &localSceneConstants);
+        }
+    }
+
+    // Secondary command buffers do not inherit any bindings, so each range of draw commands binds all its states
+    const IndexedTriangleMesh& mesh = models[ModelCube];
+
+    auto RecordDrawCommands = [this, &mesh, &texSize](CommandBuffer* targetCmdBuffer, unsigned firstDraw, unsigned numDrawCommands) -> void
+    {
+        targetCmdBuffer->SetViewport(texSize);
+        targetCmdBuffer->SetVertexBuffer(*meshBuffer);
+        targetCmdBuffer->SetIndexBuffer(*meshBuffer, Format::R32UInt, mesh.indexBufferOffset);
+        targetCmdBuffer->SetPipelineState(*pso);
+        for_range(i, numDrawCommands)
+        {
+            targetCmdBuffer->SetResource(0, *sceneBuffers[firstDraw + i]);
+            targetCmdBuffer->DrawIndexed(mesh.numIndices, 0);
+        }
+    };
+
+    const double freq = static_cast<double>(Timer::Frequency());
+
+    // Encode all draw commands into the primary command buffer
+    const std::uint64_t startInlineTime = Timer::Tick();
+
+    cmdBuffer->Begin();
+    {
+        cmdBuffer->BeginRenderPass(*renderTargets[0]);
+        {
+            cmdBuffer->Clear(ClearFlags::ColorDepth);
+            RecordDrawCommands(cmdBuffer, 0, numDraws);
+        }
+        cmdBuffer->EndRenderPass();
+    }
+    cmdBuffer->End();
+
+    const std::uint64_t endInlineTime = Timer::Tick();
+
+    // Encode draw commands into secondary command buffers in parallel and execute them within a single render pass
+    auto SecondaryCommandBufferWorker = [&RecordDrawCommands](CommandBuffer* secondaryCmdBuffer, unsigned firstDraw) -> void
+    {
+        secondaryCmdBuffer->Begin();
+        {
+            RecordDrawCommands(secondaryCmdBuffer, firstDraw, numDrawsPerThread);
+        }
+        secondaryCmdBuffer->End();
+    };
+
+    const std::uint64_t startParallelTime = Timer::Tick();
+
+    std::thread workers[numThreads];
+    for_range(i, numThreads)
+        workers[i] = std::thread(SecondaryCommandBufferWorker, secondaryCmdBuffers[i], i * numDrawsPerThread);
+
+    for_range(i, numThreads)
+        workers[i].join();
+
+    cmdBuffer->Begin();
+    {
+        cmdBuffer->BeginRenderPass(*renderTargets[1]);
+        {
+            cmdBuffer->Clear(ClearFlags::ColorDepth);
+            cmdBuffer->SetViewport(texSize); // Inherited by D3D12 bundles
+            for_range(i, numThreads)
+                cmdBuffer->Execute(*secondaryCmdBuffers[i]);
+        }
+        cmdBuffer->EndRenderPass();
+    }
+    cmdBuffer->End();
+
+    const std::uint64_t endParallelTime = Timer::Tick();
+
+    // Track total encoding time
+    const double inlineTime     = (static_cast<double>(endInlineTime - startInlineTime) / freq) * 1000.0;
+    const double parallelTime   = (static_cast<double>(endParallelTime - startParallelTime) / freq) * 1000.0;
+    totalInlineTime     += inlineTime;
+    totalParallelTime   += parallelTime;
+
+    if (frame < numFrames)
+        return TestResult::Continue;
+
+    if (opt.showTiming)
+    {
+        const double avgInlineTime      = totalInlineTime / (numFrames + 1);
+        const double avgParallelTime    = totalParallelTime / (numFrames + 1);
+        Log::Printf(
+            "Average encoding of %u draws: Inline ( %.4f ms, %.1f draws/ms ), %u Threads ( %.4f ms, %.1f draws/ms )\n",
+            numDraws, avgInlineTime, numDraws / avgInlineTime, numThreads, avgParallelTime, numDraws / avgParallelTime
+        );
+    }
+
+    // Read results from both render targets
+    std::vector<ColorRGBub> outputImages[2];
+
+    const TextureRegion texRegion{ Offset3D{}, Extent3D{ texSize.width, texSize.height, 1 } };
+
+    for_range(i, 2)
+    {
+        outputImages[i].resize(texSize.width * texSize.height);
+
+        MutableImageView dstImageView;
+        {
+            dstImageView.format     = ImageFormat::RGB;
+            dstImageView.dataType   = DataType::UInt8;
+            dstImageView.data       = outputImages[i].data();
+            dstImageView.dataSize   = outputImages[i].size() * sizeof(ColorRGBub);
+        }
+        renderer->ReadTexture(*outputTextures[i], texRegion, dstImageView);
+    }
+
+    SaveColorImage(outputImages[0], texSize, "ParallelRenderPass_Inline");
+    SaveColorImage(outputImages[1], texSize, "ParallelRenderPass_Secondary");
+
+    // Both encoding variants must produce the same image
+    TestResult result = TestResult::Passed;
+
+    for_range(i, outputImages[0].size())
+    {
+        const ColorRGBub& lhs = outputImages[0][i];
+        const ColorRGBub& rhs = outputImages[1][i];
+        if (std::abs(lhs.r - rhs.r) > diffThreshold ||
+            std::abs(lhs.g - rhs.g) > diffThreshold ||
+            std::abs(lhs.b - rhs.b) > diffThreshold)
+        {
+            Log::Errorf(
+                "Mismatch between inline and secondary command buffer encoding at pixel (%u, %u)\n",
+                static_cast<unsigned>(i % texSize.width), static_cast<unsigned>(i / texSize.width)
+            );
+            result = TestResult::FailedMismatch;
+            break;
+        }
+    }
+
+    // Release resources
+    for_range(i, numThreads)
+        renderer->Release(*secondaryCmdBuffers[i]);
+
+    for_range(i, numDraws)
+        renderer->Release(*sceneBuffers[i]);
+
+    for_range(i, 2)
+    {
+        renderer->Release(*renderTargets[i]);
+        renderer->Release(*outputTextures[i]);
+    }
+
+    renderer->Release(*pso);
+
+    return result;
+}
+
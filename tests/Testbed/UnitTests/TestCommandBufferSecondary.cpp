@@ -84,9 +84,11 @@ DEF_TEST( CommandBufferSecondary )
         sceneBuffers[i] = renderer->CreateBuffer(sceneBufferDesc, &sceneConstants);
     }
 
-    // Record secondary command buffers to render objects
+    // Record secondary command buffers to render objects; Secondary command buffers do not inherit any bindings from the primary command buffer
     auto RecordMeshDrawCommand = [this, pso](CommandBuffer* innerCmdBuffer, const IndexedTriangleMesh& mesh, Buffer* sceneBuffer) -> void
     {
+        innerCmdBuffer->SetViewport(swapChain->GetResolution());
+        innerCmdBuffer->SetVertexBuffer(*meshBuffer);
         innerCmdBuffer->SetIndexBuffer(*meshBuffer, Format::R32UInt, mesh.indexBufferOffset);
         innerCmdBuffer->SetPipelineState(*pso);
         innerCmdBuffer->SetResource(0, *sceneBuffer);
@@ -0,0 +1,107 @@
+/*
+ * TestConcurrentPipelineCreation.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ForRange.h>
+#include <atomic>
+#include <thread>
+
+
+/*
+Creates and releases PSOs from multiple threads at the same time.
+Only the backends that document concurrent PSO creation are tested (see RenderSystem).
+*/
+DEF_TEST( ConcurrentPipelineCreation )
+{
+    if (renderer->GetRendererID() != RendererID::Vulkan && renderer->GetRendererID() != RendererID::Null)
+        return TestResult::Skipped;
+
+    // Debug layer does not synchronize its validation
+    if (debuggerAttached)
+        return TestResult::Skipped;
+
+    if (shaders[VSTextured] == nullptr || shaders[PSTextured] == nullptr)
+    {
+        Log::Errorf("Missing shaders for backend\n");
+        return TestResult::FailedErrors;
+    }
+
+    constexpr unsigned numThreads       = 8;
+    constexpr unsigned numPSOsPerThread = 32;
+
+    static PipelineState* psos[numThreads][numPSOsPerThread];
+
+    std::atomic<unsigned> numFailures{ 0 };
+
+    auto CreatePSOs = [this, &numFailures](unsigned threadIndex) -> void
+    {
+        for_range(i, numPSOsPerThread)
+        {
+            // Vary states between PSOs, so not all of them are identical
+            GraphicsPipelineDescriptor psoDesc;
+            {
+                psoDesc.pipelineLayout                = layouts[PipelineTextured];
+                psoDesc.renderPass                    = swapChain->GetRenderPass();
+                psoDesc.vertexShader                  = shaders[VSTextured];
+                psoDesc.fragmentShader                = shaders[PSTextured];
+                psoDesc.depth.testEnabled             = ((i & 1) != 0);
+                psoDesc.depth.writeEnabled            = ((i & 2) != 0);
+                psoDesc.rasterizer.cullMode           = ((i & 4) != 0 ? CullMode::Back : CullMode::Disabled);
+                psoDesc.blend.targets[0].blendEnabled = ((threadIndex & 1) != 0);
+            }
+            PipelineState* pso = renderer->CreatePipelineState(psoDesc);
+
+            if (pso == nullptr)
+                ++numFailures;
+            else if (const Report* report = pso->GetReport())
+            {
+                if (report->HasErrors())
+                    ++numFailures;
+            }
+
+            // Release every other PSO immediately, so creation and release interleave across threads
+            if (pso != nullptr && (i % 2) == 1)
+            {
+                renderer->Release(*pso);
+                pso = nullptr;
+            }
+
+            psos[threadIndex][i] = pso;
+        }
+    };
+
+    std::thread workers[numThreads];
+
+    for_range(i, numThreads)
+        workers[i] = std::thread(CreatePSOs, i);
+
+    for_range(i, numThreads)
+        workers[i].join();
+
+    // Release remaining PSOs
+    for_range(i, numThreads)
+    {
+        for_range(j, numPSOsPerThread)
+        {
+            if (psos[i][j] != nullptr)
+            {
+                renderer->Release(*psos[i][j]);
+                psos[i][j] = nullptr;
+            }
+        }
+    }
+
+    if (numFailures > 0)
+    {
+        Log::Errorf("Failed to create %u of %u PSOs concurrently\n", numFailures.load(), numThreads * numPSOsPerThread);
+        return TestResult::FailedErrors;
+    }
+
+    return TestResult::Passed;
+}
+
+
@@ -10,6 +10,9 @@
 #include <LLGL/Container/SmallVector.h>
 #include <LLGL/Container/UTF8String.h>
 #include <LLGL/Container/Strings.h>
+#include <LLGL/Container/MemoryArena.h>
+#include <LLGL/Container/DynamicVector.h>
+#include <LLGL/Container/Allocator.h>
 #include <locale>
 #include <codecvt>
 
@@ -230,6 +233,172 @@ DEF_RITEST( ContainerSmallVector )
     return TestResult::Passed;
 }
 
+DEF_RITEST( ContainerMemoryArena )
+{
+    MemoryArena arena{ 1024 };
+
+    // Test aligned allocations from arena
+    for (std::size_t alignment : { 1u, 2u, 4u, 8u, 16u })
+    {
+        void* ptr = arena.Allocate(3, alignment);
+        if (reinterpret_cast<std::uintptr_t>(ptr) % alignment != 0)
+        {
+            Log::Errorf("Mismatch between MemoryArena allocation %p and expected alignment (%zu)\n", ptr, alignment);
+            return TestResult::FailedMismatch;
+        }
+    }
+
+    // Test allocation that exceeds chunk size
+    char* largeBlock = static_cast<char*>(arena.Allocate(4096));
+    ::memset(largeBlock, 0xAB, 4096);
+
+    arena.Reset();
+    if (arena.GetAllocatedSize() != 0)
+    {
+        Log::Errorf("Mismatch between MemoryArena size after reset (%zu) and expected size (0)\n", arena.GetAllocatedSize());
+        return TestResult::FailedMismatch;
+    }
+
+    // Test vectors with arena allocator inside and outside of an arena scope
+    auto TestArenaVector = [](const char* name) -> TestResult
+    {
+        constexpr int numValues = 1000;
+        DynamicVector<int, ArenaAllocator<int>> values;
+        std::vector<std::string, ArenaAllocator<std::string>> strings;
+        for_range(i, numValues)
+        {
+            values.push_back(i);
+            strings.push_back(std::to_string(i));
+        }
+        for_range(i, numValues)
+        {
+            if (values[i] != i || strings[i] != std::to_string(i))
+            {
+                Log::Errorf("Mismatch between ArenaAllocator vector '%s' at index [%d]\n", name, i);
+                return TestResult::FailedMismatch;
+            }
+        }
+        return TestResult::Passed;
+    };
+
+    {
+        ScopedMemoryArena scope{ arena };
+        if (MemoryArena::GetCurrent() != &arena)
+        {
+            Log::Errorf("Mismatch between current MemoryArena and scoped MemoryArena\n");
+            return TestResult::FailedMismatch;
+        }
+
+        const TestResult result = TestArenaVector("scoped");
+        if (result != TestResult::Passed)
+            return result;
+
+        if (arena.GetAllocatedSize() == 0)
+        {
+            Log::Errorf("ArenaAllocator did not allocate from scoped MemoryArena\n");
+            return TestResult::FailedMismatch;
+        }
+    }
+
+    if (MemoryArena::GetCurrent() != nullptr)
+    {
+        Log::Errorf("Mismatch between current MemoryArena after scope and expected null\n");
+        return TestResult::FailedMismatch;
+    }
+
+    arena.Reset();
+
+    const TestResult result = TestArenaVector("heap");
+    if (result != TestResult::Passed)
+        return result;
+
+    if (arena.GetAllocatedSize() != 0)
+    {
+        Log::Errorf("ArenaAllocator allocated from MemoryArena outside of its scope\n");
+        return TestResult::FailedMismatch;
+    }
+
+    return TestResult::Passed;
+}
+
+DEF_RITEST( ContainerAllocator )
+{
+    // Custom allocator that forwards to the C runtime, so memory of the default allocator can still be released with it
+    struct AllocatorCounters
+    {
+        int numAllocations;
+        int numDeallocations;
+    }
+    counters = { 0, 0 };
+
+    AllocatorCallbacks callbacks;
+    {
+        callbacks.allocate = [](std::size_t size, std::size_t alignment, void* userData) -> void*
+        {
+            if (alignment > alignof(std::max_align_t))
+                return nullptr;
+            static_cast<AllocatorCounters*>(userData)->numAllocations++;
+            return ::malloc(size);
+        };
+        callbacks.deallocate = [](void* ptr, std::size_t /*size*/, std::size_t /*alignment*/, void* userData)
+        {
+            static_cast<AllocatorCounters*>(userData)->numDeallocations++;
+            ::free(ptr);
+        };
+        callbacks.userData = &counters;
+    }
+
+    const AllocatorStatistics statsBefore = GetAllocatorStatistics();
+
+    SetAllocator(&callbacks);
+    {
+        // Test dynamic allocation of vector and spilled allocation of small vector
+        DynamicVector<int> values;
+        SmallVector<int, 4> smallValues;
+        for_range(i, 100)
+        {
+            values.push_back(static_cast<int>(i));
+            smallValues.push_back(static_cast<int>(i));
+        }
+        DynamicByteArray bytes{ 64 };
+    }
+    SetAllocator(nullptr);
+
+    if (counters.numAllocations == 0 || counters.numAllocations != counters.numDeallocations)
+    {
+        Log::Errorf(
+            "Mismatch between custom allocator allocations (%d) and deallocations (%d)\n",
+            counters.numAllocations, counters.numDeallocations
+        );
+        return TestResult::FailedMismatch;
+    }
+
+    const AllocatorStatistics statsAfter = GetAllocatorStatistics();
+    if (statsAfter.numAllocations - statsBefore.numAllocations < static_cast<std::uint64_t>(counters.numAllocations))
+    {
+        Log::Errorf(
+            "Mismatch between allocator statistics (%" PRIu64 ") and custom allocator allocations (%d)\n",
+            (statsAfter.numAllocations - statsBefore.numAllocations), counters.numAllocations
+        );
+        return TestResult::FailedMismatch;
+    }
+
+    // Test over-aligned allocations with default allocator
+    for (std::size_t alignment : { 16u, 64u, 256u, 4096u })
+    {
+        void* ptr = AllocateMemory(100, alignment);
+        const bool isAligned = (reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0);
+        FreeMemory(ptr, 100, alignment);
+        if (!isAligned)
+        {
+            Log::Errorf("Mismatch between heap allocation %p and expected alignment (%zu)\n", ptr, alignment);
+            return TestResult::FailedMismatch;
+        }
+    }
+
+    return TestResult::Passed;
+}
+
 DEF_RITEST( ContainerUTF8String )
 {
     // Test UTF8String concatentation
@@ -0,0 +1,67 @@
+/*
+ * TestFenceTimeline.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ForRange.h>
+#include <inttypes.h>
+
+
+DEF_TEST( FenceTimeline )
+{
+    constexpr std::uint64_t numFrames = 8;
+    constexpr std::uint64_t numFramesInFlight = 2;
+
+    Fence* fence = renderer->CreateFence();
+
+    // Signal monotonically increasing values and only wait for frames that are out of flight
+    for_range(i, numFrames)
+    {
+        const std::uint64_t frameValue = i + 1;
+        if (frameValue > numFramesInFlight)
+        {
+            if (!cmdQueue->WaitFence(*fence, frameValue - numFramesInFlight, ~0ull))
+            {
+                Log::Errorf("Failed to wait for fence value %" PRIu64 "\n", frameValue - numFramesInFlight);
+                renderer->Release(*fence);
+                return TestResult::FailedErrors;
+            }
+        }
+
+        cmdBuffer->Begin();
+        {
+            cmdBuffer->BeginRenderPass(*swapChain);
+            cmdBuffer->Clear(ClearFlags::Color);
+            cmdBuffer->EndRenderPass();
+        }
+        cmdBuffer->End();
+
+        cmdQueue->Submit(*fence, frameValue);
+    }
+
+    // Wait for the last value and make sure earlier values are reported as completed
+    TestResult result = TestResult::Passed;
+
+    if (!cmdQueue->WaitFence(*fence, numFrames, ~0ull))
+    {
+        Log::Errorf("Failed to wait for last fence value %" PRIu64 "\n", numFrames);
+        result = TestResult::FailedErrors;
+    }
+    else if (fence->GetCompletedValue() < numFrames)
+    {
+        Log::Errorf("Mismatch between completed fence value %" PRIu64 " and last signaled value %" PRIu64 "\n", fence->GetCompletedValue(), numFrames);
+        result = TestResult::FailedMismatch;
+    }
+    else if (!cmdQueue->WaitFence(*fence, numFrames - 1, 0))
+    {
+        Log::Errorf("Failed to wait for already completed fence value %" PRIu64 "\n", numFrames - 1);
+        result = TestResult::FailedErrors;
+    }
+
+    renderer->Release(*fence);
+
+    return result;
+}
@@ -0,0 +1,163 @@
+/*
+ * TestFloat16Conversions.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/ImageFlags.h>
+#include <limits>
+#include <string.h>
+
+
+/*
+Converts boundary values between Float32 and Float16 once in bulk, which uses the SIMD path (F16C or NEON) where available,
+and once for each value alone, which always uses the scalar path. Both must match the IEEE 754 results with rounding to nearest even.
+*/
+DEF_RITEST( Float16Conversions )
+{
+    TestResult result = TestResult::Passed;
+
+    auto MakeFloat = [](std::uint32_t bits) -> float
+    {
+        float f;
+        ::memcpy(&f, &bits, sizeof(f));
+        return f;
+    };
+
+    auto IsFloat16NaN = [](std::uint16_t bits) -> bool
+    {
+        return ((bits & 0x7C00u) == 0x7C00u && (bits & 0x03FFu) != 0);
+    };
+
+    auto CompressFloats = [](std::uint16_t* dst, const float* src, std::size_t count)
+    {
+        const ImageView         srcView{ ImageFormat::R, DataType::Float32, src, count * sizeof(float) };
+        const MutableImageView  dstView{ ImageFormat::R, DataType::Float16, dst, count * sizeof(std::uint16_t) };
+        ConvertImageBuffer(srcView, dstView);
+    };
+
+    auto DecompressFloats = [](float* dst, const std::uint16_t* src, std::size_t count)
+    {
+        const ImageView         srcView{ ImageFormat::R, DataType::Float16, src, count * sizeof(std::uint16_t) };
+        const MutableImageView  dstView{ ImageFormat::R, DataType::Float32, dst, count * sizeof(float) };
+        ConvertImageBuffer(srcView, dstView);
+    };
+
+    struct Float16Sample
+    {
+        std::uint32_t   input;      // Float32 bits
+        std::uint16_t   expected;   // Float16 bits
+    };
+
+    const Float16Sample samples[] =
+    {
+        Float16Sample{ 0x00000000u, 0x0000u }, // +0
+        Float16Sample{ 0x80000000u, 0x8000u }, // -0
+        Float16Sample{ 0x3F800000u, 0x3C00u }, // 1
+        Float16Sample{ 0x3DCCCCCDu, 0x2E66u }, // 0.1
+        Float16Sample{ 0x45001000u, 0x6800u }, // 2049 is halfway between 2048 and 2050 and rounds to even
+        Float16Sample{ 0x45003000u, 0x6802u }, // 2051 is halfway between 2050 and 2052 and rounds to even
+        Float16Sample{ 0x3F801000u, 0x3C00u }, // 1 + 2^-11 is halfway and rounds to even
+        Float16Sample{ 0x3F803000u, 0x3C02u }, // 1 + 3*2^-11 is halfway and rounds to even
+        Float16Sample{ 0x477FE000u, 0x7BFFu }, // 65504 is the max Float16 value
+        Float16Sample{ 0x477FEFFFu, 0x7BFFu }, // largest Float32 below 65520 rounds down to 65504
+        Float16Sample{ 0x477FF000u, 0x7C00u }, // 65520 is halfway and overflows to +inf
+        Float16Sample{ 0xC77FF000u, 0xFC00u }, // -65520 overflows to -inf
+        Float16Sample{ 0x501502F9u, 0x7C00u }, // 1e10 overflows to +inf
+        Float16Sample{ 0x7F800000u, 0x7C00u }, // +inf
+        Float16Sample{ 0xFF800000u, 0xFC00u }, // -inf
+        Float16Sample{ 0x38800000u, 0x0400u }, // 2^-14 is the min Float16 normal
+        Float16Sample{ 0x387FC000u, 0x03FFu }, // max Float16 subnormal
+        Float16Sample{ 0x33800000u, 0x0001u }, // 2^-24 is the min Float16 subnormal
+        Float16Sample{ 0x33000000u, 0x0000u }, // 2^-25 is halfway between 0 and the min subnormal and rounds to even
+        Float16Sample{ 0x33C00000u, 0x0002u }, // 3*2^-25 is halfway and rounds to even
+        Float16Sample{ 0x33000001u, 0x0001u }, // slightly above 2^-25 rounds up
+        Float16Sample{ 0x7FC00000u, 0x7E00u }, // quiet NaN
+        Float16Sample{ 0x7F800001u, 0x7E00u }, // signaling NaN
+    };
+
+    constexpr std::size_t numSamples = sizeof(samples)/sizeof(samples[0]);
+
+    // Replicate each sample across a full SIMD batch, so all of them go through the bulk path
+    constexpr std::size_t batchSize = 8;
+
+    std::vector<float> bulkInput(numSamples * batchSize);
+    for_range(i, bulkInput.size())
+        bulkInput[i] = MakeFloat(samples[i / batchSize].input);
+
+    std::vector<std::uint16_t> bulkOutput(bulkInput.size(), 0xDEADu);
+    CompressFloats(bulkOutput.data(), bulkInput.data(), bulkInput.size());
+
+    for_range(i, bulkInput.size())
+    {
+        const Float16Sample& sample = samples[i / batchSize];
+
+        std::uint16_t scalarOutput = 0xDEADu;
+        CompressFloats(&scalarOutput, &bulkInput[i], 1);
+
+        const std::uint16_t outputs[2] = { bulkOutput[i], scalarOutput };
+        const char*         pathNames[2] = { "bulk", "scalar" };
+
+        for_range(j, 2)
+        {
+            const bool isMatch =
+            (
+                IsFloat16NaN(sample.expected)
+                    ? IsFloat16NaN(outputs[j])
+                    : (outputs[j] == sample.expected)
+            );
+            if (!isMatch)
+            {
+                Log::Errorf(
+                    "Mismatch between %s Float16 compression of 0x%08X (%g) [0x%04X] and expected value [0x%04X]\n",
+                    pathNames[j], sample.input, MakeFloat(sample.input), outputs[j], sample.expected
+                );
+                result = TestResult::FailedMismatch;
+                if (!opt.greedy)
+                    return result;
+            }
+        }
+    }
+
+    // Decompress all Float16 values in bulk and one by one; decompression is exact, so both must produce identical bits except for NaN payloads
+    constexpr std::size_t numFloat16Values = 0x10000;
+
+    std::vector<std::uint16_t> allFloat16(numFloat16Values);
+    for_range(i, numFloat16Values)
+        allFloat16[i] = static_cast<std::uint16_t>(i);
+
+    std::vector<float> bulkDecompressed(numFloat16Values, 0.0f);
+    DecompressFloats(bulkDecompressed.data(), allFloat16.data(), numFloat16Values);
+
+    for_range(i, numFloat16Values)
+    {
+        float scalarDecompressed = 0.0f;
+        DecompressFloats(&scalarDecompressed, &allFloat16[i], 1);
+
+        std::uint32_t bulkBits = 0, scalarBits = 0;
+        ::memcpy(&bulkBits, &bulkDecompressed[i], sizeof(bulkBits));
+        ::memcpy(&scalarBits, &scalarDecompressed, sizeof(scalarBits));
+
+        const bool isMatch =
+        (
+            IsFloat16NaN(allFloat16[i])
+                ? (bulkDecompressed[i] != bulkDecompressed[i] && scalarDecompressed != scalarDecompressed)
+                : (bulkBits == scalarBits)
+        );
+        if (!isMatch)
+        {
+            Log::Errorf(
+                "Mismatch between bulk Float16 decompression of [0x%04X] (0x%08X) and scalar decompression (0x%08X)\n",
+                static_cast<unsigned>(i), bulkBits, scalarBits
+            );
+            result = TestResult::FailedMismatch;
+            if (!opt.greedy)
+                return result;
+        }
+    }
+
+    return result;
+}
+
@@ -153,6 +153,85 @@ DEF_RITEST( ImageConversions )
         TEST_CONVERSION("VanGogh-starry_night.jpg");
     }
 
+    // Test conversions that have SIMD fast paths with pixel counts that are not a multiple of any SIMD register width
+    auto TestFastPath = [](ImageFormat srcFormat, DataType srcDataType, ImageFormat dstFormat, DataType dstDataType, std::size_t numPixels) -> TestResult
+    {
+        // Generate source image with a pseudo-random pattern of normalized values
+        const std::size_t srcSize = GetMemoryFootprint(srcFormat, srcDataType, numPixels);
+        DynamicByteArray srcData{ srcSize, UninitializeTag{} };
+
+        if (srcDataType == DataType::Float32)
+        {
+            float* srcFloats = reinterpret_cast<float*>(srcData.get());
+            for_range(i, srcSize / sizeof(float))
+                srcFloats[i] = static_cast<float>((i * 37) % 256) / 255.0f;
+        }
+        else
+        {
+            for_range(i, srcSize)
+                srcData[i] = static_cast<char>((i * 37) % 256);
+        }
+
+        const ImageView srcView{ srcFormat, srcDataType, srcData.get(), srcSize };
+
+        // Convert through fast path and convert back to the source format to compare against the original pixels
+        DynamicByteArray dstData = ConvertImageBuffer(srcView, dstFormat, dstDataType, LLGL_MAX_THREAD_COUNT);
+        const ImageView dstView{ dstFormat, dstDataType, dstData.get(), GetMemoryFootprint(dstFormat, dstDataType, numPixels) };
+
+        DynamicByteArray cmpData = ConvertImageBuffer(dstView, srcFormat, srcDataType);
+
+        if (!dstData || !cmpData)
+        {
+            Log::Errorf("Failed to convert image from %s to %s\n", ToString(srcFormat), ToString(dstFormat));
+            return TestResult::FailedErrors;
+        }
+
+        // Float16 round trips are lossy, so compare floats with a tolerance
+        if (srcDataType == DataType::Float32)
+        {
+            const float* srcFloats = reinterpret_cast<const float*>(srcData.get());
+            const float* cmpFloats = reinterpret_cast<const float*>(cmpData.get());
+            const float tolerance = (dstDataType == DataType::Float16 ? 0.001f : 0.0f);
+            for_range(i, srcSize / sizeof(float))
+            {
+                if (std::abs(srcFloats[i] - cmpFloats[i]) > tolerance)
+                {
+                    Log::Errorf(
+                        "Mismatch between component [%u] of image conversion round trip from %s to %s (%f) and original value (%f)\n",
+                        static_cast<unsigned>(i), ToString(srcFormat), ToString(dstFormat), cmpFloats[i], srcFloats[i]
+                    );
+                    return TestResult::FailedMismatch;
+                }
+            }
+        }
+        else if (::memcmp(srcData.get(), cmpData.get(), srcSize) != 0)
+        {
+            Log::Errorf(
+                "Mismatch between image conversion round trip from %s (data type 0x%02X) to %s (data type 0x%02X) and original image\n",
+                ToString(srcFormat), static_cast<unsigned>(srcDataType), ToString(dstFormat), static_cast<unsigned>(dstDataType)
+            );
+            return TestResult::FailedMismatch;
+        }
+
+        return TestResult::Passed;
+    };
+
+    #define TEST_FAST_PATH(SRC_FORMAT, SRC_TYPE, DST_FORMAT, DST_TYPE)                                          \
+        {                                                                                                       \
+            for (std::size_t numPixels : { 1u, 7u, 33u, 1001u })                                                \
+            {                                                                                                   \
+                TestResult result = TestFastPath((SRC_FORMAT), (SRC_TYPE), (DST_FORMAT), (DST_TYPE), numPixels);\
+                if (result != TestResult::Passed)                                                               \
+                    return result;                                                                              \
+            }                                                                                                   \
+        }
+
+    TEST_FAST_PATH(ImageFormat::RGBA, DataType::UInt8,   ImageFormat::BGRA, DataType::UInt8  );
+    TEST_FAST_PATH(ImageFormat::BGRA, DataType::UInt8,   ImageFormat::RGBA, DataType::UInt8  );
+    TEST_FAST_PATH(ImageFormat::RGB,  DataType::UInt8,   ImageFormat::RGBA, DataType::UInt8  );
+    TEST_FAST_PATH(ImageFormat::RGBA, DataType::UInt8,   ImageFormat::RGBA, DataType::Float32);
+    TEST_FAST_PATH(ImageFormat::RGBA, DataType::Float32, ImageFormat::RGBA, DataType::Float16);
+
     return TestResult::Passed;
 }
 
@@ -0,0 +1,150 @@
+/*
+ * TestImageMipChain.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/Image.h>
+#include <LLGL/TextureFlags.h>
+#include <cmath>
+
+
+DEF_RITEST( ImageMipChain )
+{
+    TestResult result = TestResult::Passed;
+
+    // Validates the number of MIP-map levels and their offsets within the MIP-map chain of the specified image
+    auto TestMipOffsets = [](const Image& img, const char* name, const std::vector<Extent3D>& expectedExtents) -> TestResult
+    {
+        const std::uint32_t numMipLevels = NumMipLevels(img.GetExtent().width, img.GetExtent().height, img.GetExtent().depth);
+        if (numMipLevels != expectedExtents.size())
+        {
+            Log::Errorf(
+                "Mismatch between number of MIP-map levels of %s image (%u) and expected number (%u)\n",
+                name, numMipLevels, static_cast<unsigned>(expectedExtents.size())
+            );
+            return TestResult::FailedMismatch;
+        }
+
+        std::size_t expectedOffset = 0;
+        for_range(mipLevel, numMipLevels + 1)
+        {
+            const std::size_t offset = img.GetMipChainOffset(mipLevel);
+            if (offset != expectedOffset)
+            {
+                Log::Errorf(
+                    "Mismatch between MIP-map chain offset of %s image at level %u (%u) and expected offset (%u)\n",
+                    name, mipLevel, static_cast<unsigned>(offset), static_cast<unsigned>(expectedOffset)
+                );
+                return TestResult::FailedMismatch;
+            }
+            if (mipLevel < numMipLevels)
+            {
+                const Extent3D& extent = expectedExtents[mipLevel];
+                expectedOffset += GetMemoryFootprint(img.GetFormat(), img.GetDataType(), extent.width * extent.height * extent.depth);
+            }
+        }
+
+        return TestResult::Passed;
+    };
+
+    // Test 5x3 image with a single Float32 component whose value is a linear function of the texel coordinate: f(x, y) = x + 10*y
+    {
+        Image img{ Extent3D{ 5, 3, 1 }, ImageFormat::R, DataType::Float32 };
+
+        float* texels = static_cast<float*>(img.GetData());
+        for_range(y, 3u)
+        {
+            for_range(x, 5u)
+                texels[y * 5 + x] = static_cast<float>(x) + 10.0f * static_cast<float>(y);
+        }
+
+        TestResult intermediateResult = TestMipOffsets(img, "R32F", { Extent3D{ 5, 3, 1 }, Extent3D{ 2, 1, 1 }, Extent3D{ 1, 1, 1 } });
+        if (intermediateResult != TestResult::Passed)
+            return intermediateResult;
+
+        const DynamicByteArray mipChain = img.GenerateMipChain(ImageFilter::Box);
+        if (!mipChain || mipChain.size() != img.GetMipChainOffset(3))
+        {
+            Log::Errorf("Failed to generate MIP-map chain for R32F image\n");
+            return TestResult::FailedErrors;
+        }
+
+        /*
+        Box filter weights each source texel by its coverage of the destination texel, i.e. width 5 -> 2 has weights (0.4, 0.4, 0.2) and (0.2, 0.4, 0.4).
+        Base level is [0..4] + 10*[0..2], so level 1 is { 0.8 + 10, 3.2 + 10 } and level 2 is their average.
+        */
+        struct ExpectedTexel
+        {
+            std::uint32_t   mipLevel;
+            std::uint32_t   index;
+            float           value;
+        };
+
+        const ExpectedTexel expectedTexels[] =
+        {
+            ExpectedTexel{ 0, 0,  0.0f },
+            ExpectedTexel{ 0, 14, 24.0f },
+            ExpectedTexel{ 1, 0, 10.8f },
+            ExpectedTexel{ 1, 1, 13.2f },
+            ExpectedTexel{ 2, 0, 12.0f },
+        };
+
+        for (const ExpectedTexel& expected : expectedTexels)
+        {
+            const float* level = reinterpret_cast<const float*>(mipChain.get() + img.GetMipChainOffset(expected.mipLevel));
+            const float actual = level[expected.index];
+
+            constexpr float tolerance = 0.0001f;
+            if (std::abs(actual - expected.value) > tolerance)
+            {
+                Log::Errorf(
+                    "Mismatch between R32F MIP-map level %u texel [%u] (%f) and expected value (%f)\n",
+                    expected.mipLevel, expected.index, actual, expected.value
+                );
+                result = TestResult::FailedMismatch;
+                if (!opt.greedy)
+                    return result;
+            }
+        }
+    }
+
+    // Test 7x5 RGBA8 image with uniform color: each level must be converted back to UInt8 and keep the same color
+    {
+        const Image img{ Extent3D{ 7, 5, 1 }, ImageFormat::RGBA, DataType::UInt8, ColorRGBAf{ 0.2f, 0.4f, 0.6f, 1.0f } };
+
+        TestResult intermediateResult = TestMipOffsets(img, "RGBA8UNorm", { Extent3D{ 7, 5, 1 }, Extent3D{ 3, 2, 1 }, Extent3D{ 1, 1, 1 } });
+        if (intermediateResult != TestResult::Passed)
+            return intermediateResult;
+
+        const DynamicByteArray mipChain = img.GenerateMipChain(ImageFilter::Kaiser);
+        if (!mipChain || mipChain.size() != img.GetMipChainOffset(3))
+        {
+            Log::Errorf("Failed to generate MIP-map chain for RGBA8UNorm image\n");
+            return TestResult::FailedErrors;
+        }
+
+        const std::uint8_t* baseTexel = static_cast<const std::uint8_t*>(img.GetData());
+
+        for_range(i, mipChain.size())
+        {
+            const int actual    = static_cast<int>(static_cast<std::uint8_t>(mipChain[i]));
+            const int expected  = static_cast<int>(baseTexel[i % 4]);
+            if (std::abs(actual - expected) > 1)
+            {
+                Log::Errorf(
+                    "Mismatch between RGBA8UNorm MIP-map chain byte [%u] (%d) and expected value (%d)\n",
+                    static_cast<unsigned>(i), actual, expected
+                );
+                result = TestResult::FailedMismatch;
+                if (!opt.greedy)
+                    return result;
+            }
+        }
+    }
+
+    return result;
+}
+
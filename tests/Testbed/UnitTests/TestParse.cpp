@@ -7,6 +7,8 @@
 
 #include "Testbed.h"
 #include <LLGL/Utils/Parse.h>
+#include <LLGL/Utils/ForRange.h>
+#include <string>
 
 
 DEF_RITEST( ParseUtil )
@@ -155,6 +157,49 @@ DEF_RITEST( ParseUtil )
     TextureSwizzleRGBA texSwizzle1C = Parse("ABGR");
     TEST_TEXTURE_SWIZZLE(texSwizzle1A, texSwizzle1C);
 
+    // Test cached pipeline layout parser against uncached parser
+    const char* layoutSignature = "heap{ cbuffer(Scene@0):frag:vert, texture(1, TexArray@2[4]):frag }, sampler(3):frag, float4x4(WorldMatrix)";
+
+    const PipelineLayoutDescriptor  layoutDescA = Parse(layoutSignature);
+    const PipelineLayoutDescriptor& layoutDescB = ParsePipelineLayoutDescCached(layoutSignature);
+    const PipelineLayoutDescriptor& layoutDescC = ParsePipelineLayoutDescCached(std::string{ layoutSignature });
+
+    if (&layoutDescB != &layoutDescC)
+    {
+        Log::Errorf("LLGL::ParsePipelineLayoutDescCached(%s) did not return interned descriptor\n", layoutSignature);
+        return TestResult::FailedMismatch;
+    }
+
+    auto CompareBindingDescs = [](const BindingDescriptor& lhs, const BindingDescriptor& rhs) -> TestResult
+    {
+        TEST_ATTRIB(name      );
+        TEST_ATTRIB(type      );
+        TEST_ATTRIB(bindFlags );
+        TEST_ATTRIB(stageFlags);
+        TEST_ATTRIB(slot.index);
+        TEST_ATTRIB(arraySize );
+        return TestResult::Passed;
+    };
+
+    if (layoutDescA.heapBindings.size() != layoutDescB.heapBindings.size() ||
+        layoutDescA.bindings.size()     != layoutDescB.bindings.size()     ||
+        layoutDescA.uniforms.size()     != layoutDescB.uniforms.size())
+    {
+        Log::Errorf("LLGL::ParsePipelineLayoutDescCached(%s) failed\n", layoutSignature);
+        return TestResult::FailedMismatch;
+    }
+
+    for_range(i, layoutDescA.heapBindings.size())
+    {
+        if (CompareBindingDescs(layoutDescA.heapBindings[i], layoutDescB.heapBindings[i]) != TestResult::Passed)
+        {
+            Log::Errorf("LLGL::ParsePipelineLayoutDescCached(%s) failed at heap binding [%zu]\n", layoutSignature, i);
+            return TestResult::FailedMismatch;
+        }
+    }
+
+    ClearParseCache();
+
     return TestResult::Passed;
 }
 
@@ -7,6 +7,7 @@
 
 #include "Testbed.h"
 #include <LLGL/Utils/ForRange.h>
+#include <string.h>
 
 
 // This is a performance regression test only
@@ -54,6 +55,7 @@ DEF_TEST( PipelineCaching )
         "Elapsed times for uncached temporary PSOs: ",
         "Elapsed times for uncached PSOs:           ",
         "Elapsed times for cached PSOs:             ",
+        "Elapsed times for PSOs cached on disk:     ",
     };
 
     auto PrintElapsedTimes = [this, &elapsedTime, numPSOs](const char* caption) -> void
@@ -100,8 +102,41 @@ DEF_TEST( PipelineCaching )
 
     for_range(i, numPSOs)
         renderer->Release(*pipelineStates[i]);
+
+    // Store pipeline cache on disk and reload it
+    const std::string cacheFilename = opt.outputDir + moduleName + "/PipelineCache.bin";
+    Blob cacheBlob = pipelineCache->GetBlob();
     renderer->Release(*pipelineCache);
 
+    if (!cacheBlob.WriteToFile(cacheFilename))
+    {
+        Log::Errorf("Failed to write pipeline cache to file: %s\n", cacheFilename.c_str());
+        return TestResult::FailedErrors;
+    }
+
+    Blob reloadedBlob = Blob::CreateFromFileMapped(cacheFilename);
+    if (reloadedBlob.GetSize() != cacheBlob.GetSize() ||
+        (cacheBlob && ::memcmp(reloadedBlob.GetData(), cacheBlob.GetData(), cacheBlob.GetSize()) != 0))
+    {
+        Log::Errorf(
+            "Mismatch between pipeline cache read from file (%u bytes) and written to file (%u bytes)\n",
+            static_cast<unsigned>(reloadedBlob.GetSize()), static_cast<unsigned>(cacheBlob.GetSize())
+        );
+        return TestResult::FailedMismatch;
+    }
+
+    // Create N PSOs with pipeline cache from disk
+    PipelineCache* reloadedCache = renderer->CreatePipelineCache(reloadedBlob);
+
+    for_range(i, numPSOs)
+        pipelineStates[i] = CreateTestPSO(reloadedCache, elapsedTime[i]);
+
+    PrintElapsedTimes(captions[3]);
+
+    for_range(i, numPSOs)
+        renderer->Release(*pipelineStates[i]);
+    renderer->Release(*reloadedCache);
+
     return TestResult::Passed;
 }
 
@@ -0,0 +1,77 @@
+/*
+ * TestShaderCache.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/ShaderCache.h>
+#include <string.h>
+
+
+DEF_RITEST( ShaderCache )
+{
+    FileShaderCache cache{ opt.outputDir.c_str() };
+
+    const char binaryA[] = "DXBC shader binary A";
+    const char binaryB[] = "DXBC shader binary B with a different length";
+
+    constexpr std::uint64_t keyA = 0x0123456789ABCDEFull;
+    constexpr std::uint64_t keyB = 0xFEDCBA9876543210ull;
+
+    auto VerifyEntry = [&cache](std::uint64_t key, const char* expectedData, std::size_t expectedSize) -> TestResult
+    {
+        const Blob entry = cache.Load(key);
+        if (entry.GetSize() != expectedSize || ::memcmp(entry.GetData(), expectedData, expectedSize) != 0)
+        {
+            Log::Errorf(
+                "Mismatch between shader cache entry 0x%016llX (%u bytes) and expected binary (%u bytes)\n",
+                static_cast<unsigned long long>(key), static_cast<unsigned>(entry.GetSize()), static_cast<unsigned>(expectedSize)
+            );
+            return TestResult::FailedMismatch;
+        }
+        return TestResult::Passed;
+    };
+
+    #define VERIFY_ENTRY(KEY, DATA, SIZE)                                   \
+        {                                                                   \
+            const TestResult result = VerifyEntry((KEY), (DATA), (SIZE));   \
+            if (result != TestResult::Passed)                               \
+                return result;                                              \
+        }
+
+    // Store and load entries with different keys
+    cache.Store(keyA, binaryA, sizeof(binaryA));
+    cache.Store(keyB, binaryB, sizeof(binaryB));
+
+    VERIFY_ENTRY(keyA, binaryA, sizeof(binaryA));
+    VERIFY_ENTRY(keyB, binaryB, sizeof(binaryB));
+
+    // Replace existing entry
+    cache.Store(keyA, binaryB, sizeof(binaryB));
+    VERIFY_ENTRY(keyA, binaryB, sizeof(binaryB));
+
+    // Load entry from a second cache instance in the same directory, as done on the next application launch
+    {
+        FileShaderCache otherCache{ opt.outputDir.c_str() };
+        const Blob entry = otherCache.Load(keyB);
+        if (entry.GetSize() != sizeof(binaryB))
+        {
+            Log::Errorf("Failed to load shader cache entry from second cache instance\n");
+            return TestResult::FailedMismatch;
+        }
+    }
+
+    // Missing entries must return an empty blob
+    if (cache.Load(0).GetSize() != 0)
+    {
+        Log::Errorf("Shader cache returned non-empty blob for missing entry\n");
+        return TestResult::FailedMismatch;
+    }
+
+    #undef VERIFY_ENTRY
+
+    return TestResult::Passed;
+}
+
@@ -0,0 +1,129 @@
+/*
+ * TestThreadPool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/ThreadPool.h>
+#include <atomic>
+#include <vector>
+
+
+DEF_RITEST( ThreadPool )
+{
+    constexpr std::size_t outerCount = 64;
+    constexpr std::size_t innerCount = 4096;
+
+    auto TestPool = [&](ThreadPool& pool, const char* name) -> TestResult
+    {
+        std::vector<std::uint32_t> values(outerCount * innerCount, 0u);
+        std::atomic<std::size_t> numInvocations{ 0 };
+
+        // Run nested parallel loops, each element must be written exactly once
+        pool.ParallelRange(
+            [&](std::size_t outerBegin, std::size_t outerEnd)
+            {
+                for_subrange(i, outerBegin, outerEnd)
+                {
+                    pool.ParallelRange(
+                        [&, i](std::size_t innerBegin, std::size_t innerEnd)
+                        {
+                            for_subrange(j, innerBegin, innerEnd)
+                                values[i * innerCount + j] += static_cast<std::uint32_t>(i + j);
+                            numInvocations.fetch_add(innerEnd - innerBegin);
+                        },
+                        innerCount,
+                        8
+                    );
+                }
+            },
+            outerCount,
+            16
+        );
+
+        if (numInvocations.load() != values.size())
+        {
+            Log::Errorf(
+                "Mismatch between number of processed elements in thread pool '%s' (%u) and expected number (%u)\n",
+                name, static_cast<unsigned>(numInvocations.load()), static_cast<unsigned>(values.size())
+            );
+            return TestResult::FailedMismatch;
+        }
+
+        for_range(i, outerCount)
+        {
+            for_range(j, innerCount)
+            {
+                const std::uint32_t expected = static_cast<std::uint32_t>(i + j);
+                const std::uint32_t actual = values[i * innerCount + j];
+                if (actual != expected)
+                {
+                    Log::Errorf(
+                        "Mismatch between element [%u,%u] in thread pool '%s' (%u) and expected value (%u)\n",
+                        static_cast<unsigned>(i), static_cast<unsigned>(j), name, actual, expected
+                    );
+                    return TestResult::FailedMismatch;
+                }
+            }
+        }
+
+        return TestResult::Passed;
+    };
+
+    #define TEST_POOL(POOL, NAME)                           \
+        {                                                   \
+            const TestResult result = TestPool(POOL, NAME); \
+            if (result != TestResult::Passed)               \
+                return result;                              \
+        }
+
+    // Test global thread pool
+    TEST_POOL(ThreadPool::GetGlobal(), "Global");
+
+    // Test custom thread pools with a single and multiple worker threads
+    {
+        ThreadPool singlePool{ 1 };
+        TEST_POOL(singlePool, "Single");
+    }
+    {
+        ThreadPool multiPool{ 3 };
+        TEST_POOL(multiPool, "Multi");
+    }
+
+    // Test asynchronous tasks, which must all be executed before the thread pool is destroyed
+    {
+        constexpr std::size_t numTasks = 256;
+        std::atomic<std::size_t> numTasksRun{ 0 };
+        {
+            ThreadPool asyncPool{ 3 };
+            for_range(i, numTasks)
+                asyncPool.Submit([&numTasksRun]() { numTasksRun.fetch_add(1); });
+        }
+        if (numTasksRun.load() != numTasks)
+        {
+            Log::Errorf(
+                "Mismatch between number of asynchronous tasks run in thread pool (%u) and expected number (%u)\n",
+                static_cast<unsigned>(numTasksRun.load()), static_cast<unsigned>(numTasks)
+            );
+            return TestResult::FailedMismatch;
+        }
+    }
+
+    // Test a custom thread pool that replaces the global one
+    {
+        ThreadPool customPool{ 2 };
+        ThreadPool::SetGlobal(&customPool);
+        const bool isCustom = (&ThreadPool::GetGlobal() == &customPool);
+        ThreadPool::SetGlobal(nullptr);
+        if (!isCustom)
+        {
+            Log::Errorf("Failed to replace global thread pool by custom thread pool\n");
+            return TestResult::FailedErrors;
+        }
+    }
+
+    return TestResult::Passed;
+}
+
@@ -39,7 +39,7 @@ LLGL_C_EXPORT void llglExecute(LLGLCommandBuffer deferredCommandBuffer)
     g_CurrentCmdBuf->Execute(LLGL_REF(CommandBuffer, deferredCommandBuffer));
 }
 
-LLGL_C_EXPORT void llglUpdateBuffer(LLGLBuffer dstBuffer, uint64_t dstOffset, const void* data, uint16_t dataSize)
+LLGL_C_EXPORT void llglUpdateBuffer(LLGLBuffer dstBuffer, uint64_t dstOffset, const void* data, uint64_t dataSize)
 {
     g_CurrentCmdBuf->UpdateBuffer(LLGL_REF(Buffer, dstBuffer), dstOffset, data, dataSize);
 }
@@ -74,6 +74,11 @@ LLGL_C_EXPORT void llglCopyTextureFromFramebuffer(LLGLTexture dstTexture, const
     g_CurrentCmdBuf->CopyTextureFromFramebuffer(LLGL_REF(Texture, dstTexture), *(const TextureRegion*)dstRegion, *(const Offset2D*)srcOffset);
 }
 
+LLGL_C_EXPORT void llglBlitTexture(LLGLTexture dstTexture, const LLGLTextureRegion* dstRegion, LLGLTexture srcTexture, const LLGLTextureRegion* srcRegion, LLGLSamplerFilter filter)
+{
+    g_CurrentCmdBuf->BlitTexture(LLGL_REF(Texture, dstTexture), *(const TextureRegion*)dstRegion, LLGL_REF(Texture, srcTexture), *(const TextureRegion*)srcRegion, (SamplerFilter)filter);
+}
+
 LLGL_C_EXPORT void llglGenerateMips(LLGLTexture texture)
 {
     g_CurrentCmdBuf->GenerateMips(LLGL_REF(Texture, texture));
@@ -109,6 +114,11 @@ LLGL_C_EXPORT void llglSetVertexBuffer(LLGLBuffer buffer)
     g_CurrentCmdBuf->SetVertexBuffer(LLGL_REF(Buffer, buffer));
 }
 
+LLGL_C_EXPORT void llglSetVertexBufferExt(LLGLBuffer buffer, uint64_t offset)
+{
+    g_CurrentCmdBuf->SetVertexBuffer(LLGL_REF(Buffer, buffer), offset);
+}
+
 LLGL_C_EXPORT void llglSetVertexBufferArray(LLGLBufferArray bufferArray)
 {
     g_CurrentCmdBuf->SetVertexBufferArray(LLGL_REF(BufferArray, bufferArray));
@@ -134,11 +144,21 @@ LLGL_C_EXPORT void llglSetResource(uint32_t descriptor, LLGLResource resource)
     g_CurrentCmdBuf->SetResource(descriptor, LLGL_REF(Resource, resource));
 }
 
+LLGL_C_EXPORT void llglSetResources(uint32_t firstDescriptor, uint32_t numResources, const LLGLResource* resources)
+{
+    g_CurrentCmdBuf->SetResources(firstDescriptor, ArrayView<Resource*>{ (Resource* const*)resources, numResources });
+}
+
 LLGL_C_EXPORT void llglResetResourceSlots(LLGLResourceType resourceType, uint32_t firstSlot, uint32_t numSlots, long bindFlags, long stageFlags)
 {
     g_CurrentCmdBuf->ResetResourceSlots((ResourceType)resourceType, firstSlot, numSlots, bindFlags, stageFlags);
 }
 
+LLGL_C_EXPORT void llglResourceBarrier(uint32_t numBarriers, const LLGLResourceBarrierDescriptor* barriers)
+{
+    g_CurrentCmdBuf->ResourceBarrier(numBarriers, (const ResourceBarrierDescriptor*)barriers);
+}
+
 LLGL_C_EXPORT void llglBeginRenderPass(LLGLRenderTarget renderTarget)
 {
     g_CurrentCmdBuf->BeginRenderPass(LLGL_REF(RenderTarget, renderTarget));
@@ -154,6 +174,11 @@ LLGL_C_EXPORT void llglEndRenderPass()
     g_CurrentCmdBuf->EndRenderPass();
 }
 
+LLGL_C_EXPORT void llglNextSubpass()
+{
+    g_CurrentCmdBuf->NextSubpass();
+}
+
 LLGL_C_EXPORT void llglClear(long flags, const LLGLClearValue* clearValue)
 {
     g_CurrentCmdBuf->Clear(flags, *(const ClearValue*)clearValue);
@@ -179,6 +204,31 @@ LLGL_C_EXPORT void llglSetStencilReference(uint32_t reference, LLGLStencilFace s
     g_CurrentCmdBuf->SetStencilReference(reference, (StencilFace)stencilFace);
 }
 
+LLGL_C_EXPORT void llglSetShadingRate(LLGLShadingRate rate)
+{
+    g_CurrentCmdBuf->SetShadingRate((ShadingRate)rate);
+}
+
+LLGL_C_EXPORT void llglSetCullMode(LLGLCullMode cullMode)
+{
+    g_CurrentCmdBuf->SetCullMode((CullMode)cullMode);
+}
+
+LLGL_C_EXPORT void llglSetDepthState(const LLGLDepthDescriptor* depthDesc)
+{
+    g_CurrentCmdBuf->SetDepthState(*(const DepthDescriptor*)depthDesc);
+}
+
+LLGL_C_EXPORT void llglSetStencilState(const LLGLStencilDescriptor* stencilDesc)
+{
+    g_CurrentCmdBuf->SetStencilState(*(const StencilDescriptor*)stencilDesc);
+}
+
+LLGL_C_EXPORT void llglSetPrimitiveTopology(LLGLPrimitiveTopology topology)
+{
+    g_CurrentCmdBuf->SetPrimitiveTopology((PrimitiveTopology)topology);
+}
+
 LLGL_C_EXPORT void llglSetUniforms(uint32_t first, const void* data, uint16_t dataSize)
 {
     g_CurrentCmdBuf->SetUniforms(first, data, dataSize);
@@ -199,11 +249,21 @@ LLGL_C_EXPORT void llglBeginRenderCondition(LLGLQueryHeap queryHeap, uint32_t qu
     g_CurrentCmdBuf->BeginRenderCondition(LLGL_REF(QueryHeap, queryHeap), query, (RenderConditionMode)mode);
 }
 
+LLGL_C_EXPORT void llglBeginRenderConditionBuffer(LLGLBuffer buffer, uint64_t offset, LLGLRenderConditionMode mode)
+{
+    g_CurrentCmdBuf->BeginRenderCondition(LLGL_REF(Buffer, buffer), offset, (RenderConditionMode)mode);
+}
+
 LLGL_C_EXPORT void llglEndRenderCondition()
 {
     g_CurrentCmdBuf->EndRenderCondition();
 }
 
+LLGL_C_EXPORT void llglResolveQueries(LLGLQueryHeap queryHeap, uint32_t firstQuery, uint32_t numQueries, LLGLBuffer dstBuffer, uint64_t dstOffset)
+{
+    g_CurrentCmdBuf->ResolveQueries(LLGL_REF(QueryHeap, queryHeap), firstQuery, numQueries, LLGL_REF(Buffer, dstBuffer), dstOffset);
+}
+
 LLGL_C_EXPORT void llglBeginStreamOutput(uint32_t numBuffers, LLGLBuffer const * buffers)
 {
     Buffer* internalBuffers[LLGL_MAX_NUM_SO_BUFFERS];
@@ -262,6 +322,11 @@ LLGL_C_EXPORT void llglDrawIndirectExt(LLGLBuffer buffer, uint64_t offset, uint3
     g_CurrentCmdBuf->DrawIndirect(LLGL_REF(Buffer, buffer), offset, numCommands, stride);
 }
 
+LLGL_C_EXPORT void llglDrawIndirectCount(LLGLBuffer buffer, uint64_t offset, LLGLBuffer countBuffer, uint64_t countBufferOffset, uint32_t maxNumCommands, uint32_t stride)
+{
+    g_CurrentCmdBuf->DrawIndirect(LLGL_REF(Buffer, buffer), offset, LLGL_REF(Buffer, countBuffer), countBufferOffset, maxNumCommands, stride);
+}
+
 LLGL_C_EXPORT void llglDrawIndexedIndirect(LLGLBuffer buffer, uint64_t offset)
 {
     g_CurrentCmdBuf->DrawIndexedIndirect(LLGL_REF(Buffer, buffer), offset);
@@ -272,6 +337,26 @@ LLGL_C_EXPORT void llglDrawIndexedIndirectExt(LLGLBuffer buffer, uint64_t offset
     g_CurrentCmdBuf->DrawIndexedIndirect(LLGL_REF(Buffer, buffer), offset, numCommands, stride);
 }
 
+LLGL_C_EXPORT void llglDrawIndexedIndirectCount(LLGLBuffer buffer, uint64_t offset, LLGLBuffer countBuffer, uint64_t countBufferOffset, uint32_t maxNumCommands, uint32_t stride)
+{
+    g_CurrentCmdBuf->DrawIndexedIndirect(LLGL_REF(Buffer, buffer), offset, LLGL_REF(Buffer, countBuffer), countBufferOffset, maxNumCommands, stride);
+}
+
+LLGL_C_EXPORT void llglDrawStreamOutput()
+{
+    g_CurrentCmdBuf->DrawStreamOutput();
+}
+
+LLGL_C_EXPORT void llglDrawMesh(uint32_t numWorkGroupsX, uint32_t numWorkGroupsY, uint32_t numWorkGroupsZ)
+{
+    g_CurrentCmdBuf->DrawMesh(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
+}
+
+LLGL_C_EXPORT void llglDrawMeshIndirect(LLGLBuffer buffer, uint64_t offset, uint32_t numCommands, uint32_t stride)
+{
+    g_CurrentCmdBuf->DrawMeshIndirect(LLGL_REF(Buffer, buffer), offset, numCommands, stride);
+}
+
 LLGL_C_EXPORT void llglDispatch(uint32_t numWorkGroupsX, uint32_t numWorkGroupsY, uint32_t numWorkGroupsZ)
 {
     g_CurrentCmdBuf->Dispatch(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
@@ -302,6 +387,120 @@ LLGL_C_EXPORT bool llglGetNativeHandle(void* nativeHandle, size_t nativeHandleSi
     return g_CurrentCmdBuf->GetNativeHandle(nativeHandle, nativeHandleSize);
 }
 
+static void ExecuteCommandPacket(CommandBuffer& cmdBuf, const LLGLCommandPacket& packet)
+{
+    switch (packet.type)
+    {
+        case LLGLCommandPacketTypeSetViewport:
+            cmdBuf.SetViewport(*(const Viewport*)&packet.data.viewport);
+            break;
+
+        case LLGLCommandPacketTypeSetScissor:
+            cmdBuf.SetScissor(*(const Scissor*)&packet.data.scissor);
+            break;
+
+        case LLGLCommandPacketTypeSetVertexBuffer:
+            cmdBuf.SetVertexBuffer(LLGL_REF(Buffer, packet.data.vertexBuffer));
+            break;
+
+        case LLGLCommandPacketTypeSetIndexBuffer:
+        {
+            const LLGLCommandPacketSetIndexBuffer& cmd = packet.data.indexBuffer;
+            if (cmd.format == LLGLFormatUndefined)
+                cmdBuf.SetIndexBuffer(LLGL_REF(Buffer, cmd.buffer));
+            else
+                cmdBuf.SetIndexBuffer(LLGL_REF(Buffer, cmd.buffer), (Format)cmd.format, cmd.offset);
+        }
+        break;
+
+        case LLGLCommandPacketTypeSetResourceHeap:
+            cmdBuf.SetResourceHeap(LLGL_REF(ResourceHeap, packet.data.resourceHeap.resourceHeap), packet.data.resourceHeap.descriptorSet);
+            break;
+
+        case LLGLCommandPacketTypeSetResource:
+            cmdBuf.SetResource(packet.data.resource.descriptor, LLGL_REF(Resource, packet.data.resource.resource));
+            break;
+
+        case LLGLCommandPacketTypeSetPipelineState:
+            cmdBuf.SetPipelineState(LLGL_REF(PipelineState, packet.data.pipelineState));
+            break;
+
+        case LLGLCommandPacketTypeSetStencilReference:
+            cmdBuf.SetStencilReference(packet.data.stencilReference.reference, (StencilFace)packet.data.stencilReference.stencilFace);
+            break;
+
+        case LLGLCommandPacketTypeSetUniforms:
+            cmdBuf.SetUniforms(packet.data.uniforms.first, packet.data.uniforms.data, packet.data.uniforms.dataSize);
+            break;
+
+        case LLGLCommandPacketTypeClear:
+            cmdBuf.Clear(static_cast<long>(packet.data.clear.flags), *(const ClearValue*)&packet.data.clear.clearValue);
+            break;
+
+        case LLGLCommandPacketTypeDraw:
+            cmdBuf.Draw(packet.data.draw.numVertices, packet.data.draw.firstVertex);
+            break;
+
+        case LLGLCommandPacketTypeDrawIndexed:
+        {
+            const LLGLCommandPacketDrawIndexed& cmd = packet.data.drawIndexed;
+            if (cmd.vertexOffset == 0)
+                cmdBuf.DrawIndexed(cmd.numIndices, cmd.firstIndex);
+            else
+                cmdBuf.DrawIndexed(cmd.numIndices, cmd.firstIndex, cmd.vertexOffset);
+        }
+        break;
+
+        case LLGLCommandPacketTypeDrawInstanced:
+        {
+            const LLGLCommandPacketDraw& cmd = packet.data.draw;
+            if (cmd.firstInstance == 0)
+                cmdBuf.DrawInstanced(cmd.numVertices, cmd.firstVertex, cmd.numInstances);
+            else
+                cmdBuf.DrawInstanced(cmd.numVertices, cmd.firstVertex, cmd.numInstances, cmd.firstInstance);
+        }
+        break;
+
+        case LLGLCommandPacketTypeDrawIndexedInstanced:
+        {
+            const LLGLCommandPacketDrawIndexed& cmd = packet.data.drawIndexed;
+            if (cmd.vertexOffset == 0 && cmd.firstInstance == 0)
+                cmdBuf.DrawIndexedInstanced(cmd.numIndices, cmd.numInstances, cmd.firstIndex);
+            else
+                cmdBuf.DrawIndexedInstanced(cmd.numIndices, cmd.numInstances, cmd.firstIndex, cmd.vertexOffset, cmd.firstInstance);
+        }
+        break;
+
+        case LLGLCommandPacketTypeDrawMesh:
+            cmdBuf.DrawMesh(packet.data.workGroups.numWorkGroupsX, packet.data.workGroups.numWorkGroupsY, packet.data.workGroups.numWorkGroupsZ);
+            break;
+
+        case LLGLCommandPacketTypeDispatch:
+            cmdBuf.Dispatch(packet.data.workGroups.numWorkGroupsX, packet.data.workGroups.numWorkGroupsY, packet.data.workGroups.numWorkGroupsZ);
+            break;
+
+        case LLGLCommandPacketTypePushDebugGroup:
+            cmdBuf.PushDebugGroup(packet.data.debugGroupName);
+            break;
+
+        case LLGLCommandPacketTypePopDebugGroup:
+            cmdBuf.PopDebugGroup();
+            break;
+
+        default:
+            LLGL_TRAP("invalid command packet type: %d", static_cast<int>(packet.type));
+            break;
+    }
+}
+
+LLGL_C_EXPORT void llglExecuteCommandPackets(uint32_t numPackets, const LLGLCommandPacket* packets)
+{
+    LLGL_ASSERT(g_CurrentCmdBuf != NULL);
+    CommandBuffer& cmdBuf = *g_CurrentCmdBuf;
+    for_range(i, numPackets)
+        ExecuteCommandPacket(cmdBuf, packets[i]);
+}
+
 
 // } /namespace LLGL
 
@@ -24,11 +24,29 @@ LLGL_C_EXPORT void llglSubmitCommandBuffer(LLGLCommandBuffer commandBuffer)
     g_CurrentCmdQueue->Submit(LLGL_REF(CommandBuffer, commandBuffer));
 }
 
+LLGL_C_EXPORT void llglSubmitCommandBuffers(uint32_t numCommandBuffers, const LLGLCommandBuffer* commandBuffers)
+{
+    LLGL_ASSERT_PTR(commandBuffers);
+    g_CurrentCmdQueue->Submit(numCommandBuffers, reinterpret_cast<CommandBuffer* const*>(commandBuffers));
+}
+
+LLGL_C_EXPORT void llglPresentSwapChains(uint32_t numSwapChains, const LLGLSwapChain* swapChains)
+{
+    LLGL_ASSERT_PTR(swapChains);
+    g_CurrentCmdQueue->Present(numSwapChains, reinterpret_cast<SwapChain* const*>(swapChains));
+}
+
 LLGL_C_EXPORT bool llglQueryResult(LLGLQueryHeap queryHeap, uint32_t firstQuery, uint32_t numQueries, void* data, size_t dataSize)
 {
     return g_CurrentCmdQueue->QueryResult(LLGL_REF(QueryHeap, queryHeap), firstQuery, numQueries, data, dataSize);
 }
 
+LLGL_C_EXPORT bool llglQueryTimestampCalibration(LLGLTimestampCalibration* outCalibration)
+{
+    LLGL_ASSERT_PTR(outCalibration);
+    return g_CurrentCmdQueue->QueryTimestampCalibration(*(TimestampCalibration*)outCalibration);
+}
+
 LLGL_C_EXPORT void llglSubmitFence(LLGLFence fence)
 {
     g_CurrentCmdQueue->Submit(LLGL_REF(Fence, fence));
@@ -39,6 +57,21 @@ LLGL_C_EXPORT bool llglWaitFence(LLGLFence fence, uint64_t timeout)
     return g_CurrentCmdQueue->WaitFence(LLGL_REF(Fence, fence), timeout);
 }
 
+LLGL_C_EXPORT void llglSubmitFenceValue(LLGLFence fence, uint64_t value)
+{
+    g_CurrentCmdQueue->Submit(LLGL_REF(Fence, fence), value);
+}
+
+LLGL_C_EXPORT void llglSubmitWaitFenceValue(LLGLFence fence, uint64_t value)
+{
+    g_CurrentCmdQueue->SubmitWait(LLGL_REF(Fence, fence), value);
+}
+
+LLGL_C_EXPORT bool llglWaitFenceValue(LLGLFence fence, uint64_t value, uint64_t timeout)
+{
+    return g_CurrentCmdQueue->WaitFence(LLGL_REF(Fence, fence), value, timeout);
+}
+
 LLGL_C_EXPORT void llglWaitIdle()
 {
     g_CurrentCmdQueue->WaitIdle();
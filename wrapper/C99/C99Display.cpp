@@ -113,6 +113,17 @@ LLGL_C_EXPORT size_t llglGetSupportedDisplayModes(LLGLDisplay display, size_t ma
     return internalDisplayModes.size();
 }
 
+LLGL_C_EXPORT bool llglWaitForVBlank(LLGLDisplay display)
+{
+    return LLGL_PTR(Display, display)->WaitForVBlank();
+}
+
+LLGL_C_EXPORT bool llglGetDisplayVBlankTiming(LLGLDisplay display, LLGLDisplayVBlankTiming* outTiming)
+{
+    LLGL_ASSERT_PTR(outTiming);
+    return LLGL_PTR(Display, display)->GetVBlankTiming(*reinterpret_cast<DisplayVBlankTiming*>(outTiming));
+}
+
 
 // } /namespace LLGL
 
@@ -0,0 +1,28 @@
+/*
+ * C99Fence.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Fence.h>
+#include <LLGL-C/Fence.h>
+#include "C99Internal.h"
+
+
+// namespace LLGL {
+
+
+using namespace LLGL;
+
+LLGL_C_EXPORT uint64_t llglGetFenceCompletedValue(LLGLFence fence)
+{
+    return LLGL_PTR(Fence, fence)->GetCompletedValue();
+}
+
+
+// } /namespace LLGL
+
+
+
+// ================================================================================
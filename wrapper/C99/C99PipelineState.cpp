@@ -20,6 +20,11 @@ LLGL_C_EXPORT LLGLReport llglGetPipelineStateReport(LLGLPipelineState pipelineSt
     return LLGLReport{ LLGL_PTR(PipelineState, pipelineState)->GetReport() };
 }
 
+LLGL_C_EXPORT bool llglIsPipelineStateReady(LLGLPipelineState pipelineState)
+{
+    return LLGL_PTR(PipelineState, pipelineState)->IsReady();
+}
+
 
 // } /namespace LLGL
 
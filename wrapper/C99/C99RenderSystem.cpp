@@ -372,11 +372,23 @@ LLGL_C_EXPORT uint32_t llglWriteResourceHeap(LLGLResourceHeap resourceHeap, uint
     return 0;
 }
 
+static void ConvertRenderPassDesc(RenderPassDescriptor& dst, const LLGLRenderPassDescriptor& src)
+{
+    dst.debugName           = src.debugName;
+    ::memcpy(dst.colorAttachments, src.colorAttachments, sizeof(src.colorAttachments));
+    ::memcpy(&(dst.depthAttachment), &(src.depthAttachment), sizeof(LLGLAttachmentFormatDescriptor));
+    ::memcpy(&(dst.stencilAttachment), &(src.stencilAttachment), sizeof(LLGLAttachmentFormatDescriptor));
+    dst.samples             = src.samples;
+    dst.subpasses           = ArrayView<SubpassDescriptor>{ reinterpret_cast<const SubpassDescriptor*>(src.subpasses), src.numSubpasses };
+}
+
 LLGL_C_EXPORT LLGLRenderPass llglCreateRenderPass(const LLGLRenderPassDescriptor* renderPassDesc)
 {
     LLGL_ASSERT_RENDER_SYSTEM();
     LLGL_ASSERT_PTR(renderPassDesc);
-    return LLGLRenderPass{ g_CurrentRenderSystem->CreateRenderPass(*reinterpret_cast<const RenderPassDescriptor*>(renderPassDesc)) };
+    RenderPassDescriptor internalRenderPassDesc;
+    ConvertRenderPassDesc(internalRenderPassDesc, *renderPassDesc);
+    return LLGLRenderPass{ g_CurrentRenderSystem->CreateRenderPass(internalRenderPassDesc) };
 }
 
 LLGL_C_EXPORT void llglReleaseRenderPass(LLGLRenderPass renderPass)
@@ -452,6 +464,25 @@ LLGL_C_EXPORT LLGLShader llglCreateShader(const LLGLShaderDescriptor* shaderDesc
     return LLGLShader{ g_CurrentRenderSystem->CreateShader(internalShaderDesc) };
 }
 
+LLGL_C_EXPORT uint32_t llglCreateShaders(size_t numShaderDescs, const LLGLShaderDescriptor* shaderDescs, LLGLShader* outShaders)
+{
+    LLGL_ASSERT_RENDER_SYSTEM();
+    LLGL_ASSERT_PTR(shaderDescs);
+    LLGL_ASSERT_PTR(outShaders);
+
+    std::vector<ShaderDescriptor> internalShaderDescs(numShaderDescs);
+    for_range(i, numShaderDescs)
+        ConvertShaderDesc(internalShaderDescs[i], shaderDescs[i]);
+
+    std::vector<Shader*> internalShaders(numShaderDescs, nullptr);
+    const std::uint32_t numSucceeded = g_CurrentRenderSystem->CreateShaders(internalShaderDescs, internalShaders.data());
+
+    for_range(i, numShaderDescs)
+        outShaders[i] = LLGLShader{ internalShaders[i] };
+
+    return numSucceeded;
+}
+
 LLGL_C_EXPORT void llglReleaseShader(LLGLShader shader)
 {
     LLGL_RELEASE(Shader, shader);
@@ -530,11 +561,14 @@ static void ConvertGraphicsPipelineDesc(GraphicsPipelineDescriptor& dst, const L
 {
     dst.pipelineLayout          = LLGL_PTR(PipelineLayout, src.pipelineLayout);
     dst.renderPass              = LLGL_PTR(RenderPass, src.renderPass);
+    dst.subpass                 = src.subpass;
     dst.vertexShader            = LLGL_PTR(Shader, src.vertexShader);
     dst.tessControlShader       = LLGL_PTR(Shader, src.tessControlShader);
     dst.tessEvaluationShader    = LLGL_PTR(Shader, src.tessEvaluationShader);
     dst.geometryShader          = LLGL_PTR(Shader, src.geometryShader);
     dst.fragmentShader          = LLGL_PTR(Shader, src.fragmentShader);
+    dst.taskShader              = LLGL_PTR(Shader, src.taskShader);
+    dst.meshShader              = LLGL_PTR(Shader, src.meshShader);
     dst.indexFormat             = static_cast<Format>(src.indexFormat);
     dst.primitiveTopology       = static_cast<PrimitiveTopology>(src.primitiveTopology);
 
@@ -549,6 +583,13 @@ static void ConvertGraphicsPipelineDesc(GraphicsPipelineDescriptor& dst, const L
     ::memcpy(&(dst.rasterizer), &(src.rasterizer), sizeof(LLGLRasterizerDescriptor));
     ::memcpy(&(dst.blend), &(src.blend), sizeof(LLGLBlendDescriptor));
     ::memcpy(&(dst.tessellation), &(src.tessellation), sizeof(LLGLTessellationDescriptor));
+    dst.dynamicStates           = src.dynamicStates;
+
+    dst.specializationConstants.resize(src.numSpecializationConstants);
+    ::memcpy(dst.specializationConstants.data(), src.specializationConstants, src.numSpecializationConstants * sizeof(LLGLSpecializationConstant));
+
+    dst.asyncCompilation        = src.asyncCompilation;
+    dst.placeholder             = LLGL_PTR(PipelineState, src.placeholder);
 }
 
 LLGL_C_EXPORT LLGLPipelineState llglCreateGraphicsPipelineState(const LLGLGraphicsPipelineDescriptor* pipelineStateDesc)
@@ -567,8 +608,12 @@ LLGL_C_EXPORT LLGLPipelineState llglCreateGraphicsPipelineStateExt(const LLGLGra
 
 static void ConvertComputePipelineDesc(ComputePipelineDescriptor& dst, const LLGLComputePipelineDescriptor& src)
 {
-    dst.pipelineLayout  = LLGL_PTR(PipelineLayout, src.pipelineLayout);
-    dst.computeShader   = LLGL_PTR(Shader, src.computeShader);
+    dst.pipelineLayout      = LLGL_PTR(PipelineLayout, src.pipelineLayout);
+    dst.computeShader       = LLGL_PTR(Shader, src.computeShader);
+    dst.specializationConstants.resize(src.numSpecializationConstants);
+    ::memcpy(dst.specializationConstants.data(), src.specializationConstants, src.numSpecializationConstants * sizeof(LLGLSpecializationConstant));
+    dst.asyncCompilation    = src.asyncCompilation;
+    dst.placeholder         = LLGL_PTR(PipelineState, src.placeholder);
 }
 
 LLGL_C_EXPORT LLGLPipelineState llglCreateComputePipelineState(const LLGLComputePipelineDescriptor* pipelineStateDesc)
@@ -619,6 +664,42 @@ LLGL_C_EXPORT bool llglGetRenderSystemNativeHandle(void* nativeHandle, size_t na
     return g_CurrentRenderSystem->GetNativeHandle(nativeHandle, nativeHandleSize);
 }
 
+LLGL_C_EXPORT bool llglGetSparseTextureProperties(LLGLTexture texture, LLGLSparseTextureProperties* outProperties)
+{
+    LLGL_ASSERT_RENDER_SYSTEM();
+    LLGL_ASSERT_PTR(outProperties);
+    return g_CurrentRenderSystem->GetSparseTextureProperties(LLGL_REF(Texture, texture), *reinterpret_cast<SparseTextureProperties*>(outProperties));
+}
+
+LLGL_C_EXPORT bool llglCommitTextureTiles(LLGLTexture texture, const LLGLTextureRegion* textureRegion, bool commit)
+{
+    LLGL_ASSERT_RENDER_SYSTEM();
+    LLGL_ASSERT_PTR(textureRegion);
+    return g_CurrentRenderSystem->CommitTextureTiles(LLGL_REF(Texture, texture), *reinterpret_cast<const TextureRegion*>(textureRegion), commit);
+}
+
+static std::vector<Resource*> GetInternalResources(size_t numResources, const LLGLResource* resources)
+{
+    std::vector<Resource*> internalResources(numResources, nullptr);
+    for_range(i, numResources)
+        internalResources[i] = LLGL_PTR(Resource, resources[i]);
+    return internalResources;
+}
+
+LLGL_C_EXPORT bool llglMakeResident(size_t numResources, const LLGLResource* resources)
+{
+    LLGL_ASSERT_RENDER_SYSTEM();
+    LLGL_ASSERT_PTR(resources);
+    return g_CurrentRenderSystem->MakeResident(GetInternalResources(numResources, resources));
+}
+
+LLGL_C_EXPORT void llglEvict(size_t numResources, const LLGLResource* resources)
+{
+    LLGL_ASSERT_RENDER_SYSTEM();
+    LLGL_ASSERT_PTR(resources);
+    g_CurrentRenderSystem->Evict(GetInternalResources(numResources, resources));
+}
+
 
 // } /namespace LLGL
 
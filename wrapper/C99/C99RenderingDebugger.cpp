@@ -36,6 +36,41 @@ LLGL_C_EXPORT bool llglGetDebuggerTimeRecording(LLGLRenderingDebugger debugger)
     return LLGL_PTR(RenderingDebugger, debugger)->GetTimeRecording();
 }
 
+LLGL_C_EXPORT void llglSetDebuggerPassRecording(LLGLRenderingDebugger debugger, bool enabled)
+{
+    LLGL_PTR(RenderingDebugger, debugger)->SetPassRecording(enabled);
+}
+
+LLGL_C_EXPORT bool llglGetDebuggerPassRecording(LLGLRenderingDebugger debugger)
+{
+    return LLGL_PTR(RenderingDebugger, debugger)->GetPassRecording();
+}
+
+LLGL_C_EXPORT void llglSetDebuggerValidationSampling(LLGLRenderingDebugger debugger, uint32_t interval, bool perCommandBuffer)
+{
+    LLGL_PTR(RenderingDebugger, debugger)->SetValidationSampling(interval, perCommandBuffer);
+}
+
+LLGL_C_EXPORT uint32_t llglGetDebuggerValidationSamplingInterval(LLGLRenderingDebugger debugger)
+{
+    return LLGL_PTR(RenderingDebugger, debugger)->GetValidationSamplingInterval();
+}
+
+LLGL_C_EXPORT bool llglIsDebuggerValidationSampledPerCommandBuffer(LLGLRenderingDebugger debugger)
+{
+    return LLGL_PTR(RenderingDebugger, debugger)->IsValidationSampledPerCommandBuffer();
+}
+
+LLGL_C_EXPORT void llglCaptureDebuggerFrame(LLGLRenderingDebugger debugger, const char* filename)
+{
+    LLGL_PTR(RenderingDebugger, debugger)->CaptureFrame(filename);
+}
+
+LLGL_C_EXPORT void llglSaveDebuggerPipelineManifest(LLGLRenderingDebugger debugger, const char* filename)
+{
+    LLGL_PTR(RenderingDebugger, debugger)->SavePipelineManifest(filename);
+}
+
 LLGL_C_EXPORT void llglFlushDebuggerProfile(LLGLRenderingDebugger debugger, LLGLFrameProfile* outFrameProfile)
 {
     LLGL_ASSERT_PTR(outFrameProfile);
@@ -55,12 +90,25 @@ LLGL_C_EXPORT void llglFlushDebuggerProfile(LLGLRenderingDebugger debugger, LLGL
     );
     std::memcpy(&(outFrameProfile->commandBufferRecord), &(internalFrameProfile.commandBufferRecord), sizeof(LLGLProfileCommandBufferRecord));
 
+    static_assert(
+        sizeof(LLGLProfileMemoryRecord) == sizeof(ProfileMemoryRecord),
+        "LLGLProfileMemoryRecord and LLGL::ProfileMemoryRecord expected to be the same size"
+    );
+    std::memcpy(&(outFrameProfile->memoryRecord), &(internalFrameProfile.memoryRecord), sizeof(LLGLProfileMemoryRecord));
+
     static_assert(
         sizeof(LLGLProfileTimeRecord) == sizeof(ProfileTimeRecord),
         "LLGLProfileTimeRecord and LLGL::ProfileTimeRecord expected to be the same size"
     );
     outFrameProfile->numTimeRecords = internalFrameProfile.timeRecords.size();
     outFrameProfile->timeRecords = reinterpret_cast<const LLGLProfileTimeRecord*>(internalFrameProfile.timeRecords.data());
+
+    static_assert(
+        sizeof(LLGLProfilePassRecord) == sizeof(ProfilePassRecord),
+        "LLGLProfilePassRecord and LLGL::ProfilePassRecord expected to be the same size"
+    );
+    outFrameProfile->numPassRecords = internalFrameProfile.passRecords.size();
+    outFrameProfile->passRecords = reinterpret_cast<const LLGLProfilePassRecord*>(internalFrameProfile.passRecords.data());
 }
 
 
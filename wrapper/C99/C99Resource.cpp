@@ -20,6 +20,11 @@ LLGL_C_EXPORT LLGLResourceType llglGetResourceType(LLGLResource resource)
     return static_cast<LLGLResourceType>(LLGL_PTR(Resource, resource)->GetResourceType());
 }
 
+LLGL_C_EXPORT void llglSetResidencyPriority(LLGLResource resource, LLGLResidencyPriority priority)
+{
+    LLGL_PTR(Resource, resource)->SetResidencyPriority(static_cast<ResidencyPriority>(priority));
+}
+
 
 // } /namespace LLGL
 
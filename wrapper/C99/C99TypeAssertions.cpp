@@ -339,6 +339,16 @@ LLGL_STATIC_ASSERT_ENUM(SystemValue, Stencil);
 LLGL_STATIC_ASSERT_ENUM(SystemValue, VertexID);
 LLGL_STATIC_ASSERT_ENUM(SystemValue, ViewportIndex);
 
+LLGL_STATIC_ASSERT_ENUM(PresentMode, Default);
+LLGL_STATIC_ASSERT_ENUM(PresentMode, Fifo);
+LLGL_STATIC_ASSERT_ENUM(PresentMode, FifoRelaxed);
+LLGL_STATIC_ASSERT_ENUM(PresentMode, Mailbox);
+LLGL_STATIC_ASSERT_ENUM(PresentMode, Immediate);
+
+LLGL_STATIC_ASSERT_ENUM(ColorSpace, SRGB);
+LLGL_STATIC_ASSERT_ENUM(ColorSpace, ExtendedSRGB);
+LLGL_STATIC_ASSERT_ENUM(ColorSpace, HDR10);
+
 LLGL_STATIC_ASSERT_ENUM(TextureType, Texture1D);
 LLGL_STATIC_ASSERT_ENUM(TextureType, Texture2D);
 LLGL_STATIC_ASSERT_ENUM(TextureType, Texture3D);
@@ -372,6 +382,8 @@ LLGL_STATIC_ASSERT_ENUM(ShaderType, TessEvaluation);
 LLGL_STATIC_ASSERT_ENUM(ShaderType, Geometry);
 LLGL_STATIC_ASSERT_ENUM(ShaderType, Fragment);
 LLGL_STATIC_ASSERT_ENUM(ShaderType, Compute);
+LLGL_STATIC_ASSERT_ENUM(ShaderType, Task);
+LLGL_STATIC_ASSERT_ENUM(ShaderType, Mesh);
 
 LLGL_STATIC_ASSERT_ENUM(ShaderSourceType, CodeString);
 LLGL_STATIC_ASSERT_ENUM(ShaderSourceType, CodeFile);
@@ -426,6 +438,12 @@ LLGL_STATIC_ASSERT_ENUM(ResourceType, Buffer);
 LLGL_STATIC_ASSERT_ENUM(ResourceType, Texture);
 LLGL_STATIC_ASSERT_ENUM(ResourceType, Sampler);
 
+LLGL_STATIC_ASSERT_ENUM(ResidencyPriority, Minimum);
+LLGL_STATIC_ASSERT_ENUM(ResidencyPriority, Low);
+LLGL_STATIC_ASSERT_ENUM(ResidencyPriority, Normal);
+LLGL_STATIC_ASSERT_ENUM(ResidencyPriority, High);
+LLGL_STATIC_ASSERT_ENUM(ResidencyPriority, Maximum);
+
 LLGL_STATIC_ASSERT_ENUM(Key, LButton);
 LLGL_STATIC_ASSERT_ENUM(Key, RButton);
 LLGL_STATIC_ASSERT_ENUM(Key, Cancel);
@@ -597,6 +615,7 @@ LLGL_STATIC_ASSERT_ENUM(QueryType, TimeElapsed);
 LLGL_STATIC_ASSERT_ENUM(QueryType, StreamOutPrimitivesWritten);
 LLGL_STATIC_ASSERT_ENUM(QueryType, StreamOutOverflow);
 LLGL_STATIC_ASSERT_ENUM(QueryType, PipelineStatistics);
+LLGL_STATIC_ASSERT_ENUM(QueryType, Timestamp);
 
 LLGL_STATIC_ASSERT_ENUM(AttachmentLoadOp, Undefined);
 LLGL_STATIC_ASSERT_ENUM(AttachmentLoadOp, Load);
@@ -615,6 +634,19 @@ LLGL_STATIC_ASSERT_ENUM(WarningType, ImproperState);
 LLGL_STATIC_ASSERT_ENUM(WarningType, PointlessOperation);
 LLGL_STATIC_ASSERT_ENUM(WarningType, VaryingBehavior);
 
+LLGL_STATIC_ASSERT_ENUM(WindowEventType, Quit);
+LLGL_STATIC_ASSERT_ENUM(WindowEventType, KeyDown);
+LLGL_STATIC_ASSERT_ENUM(WindowEventType, KeyUp);
+LLGL_STATIC_ASSERT_ENUM(WindowEventType, DoubleClick);
+LLGL_STATIC_ASSERT_ENUM(WindowEventType, Char);
+LLGL_STATIC_ASSERT_ENUM(WindowEventType, WheelMotion);
+LLGL_STATIC_ASSERT_ENUM(WindowEventType, LocalMotion);
+LLGL_STATIC_ASSERT_ENUM(WindowEventType, GlobalMotion);
+LLGL_STATIC_ASSERT_ENUM(WindowEventType, Resize);
+LLGL_STATIC_ASSERT_ENUM(WindowEventType, Update);
+LLGL_STATIC_ASSERT_ENUM(WindowEventType, GetFocus);
+LLGL_STATIC_ASSERT_ENUM(WindowEventType, LostFocus);
+
 
 /* ----- Flags ----- */
 
@@ -667,7 +699,10 @@ LLGL_STATIC_ASSERT_FLAG(Stage, TessEvaluationStage);
 LLGL_STATIC_ASSERT_FLAG(Stage, GeometryStage);
 LLGL_STATIC_ASSERT_FLAG(Stage, FragmentStage);
 LLGL_STATIC_ASSERT_FLAG(Stage, ComputeStage);
+LLGL_STATIC_ASSERT_FLAG(Stage, TaskStage);
+LLGL_STATIC_ASSERT_FLAG(Stage, MeshStage);
 LLGL_STATIC_ASSERT_FLAG(Stage, AllTessStages);
+LLGL_STATIC_ASSERT_FLAG(Stage, AllMeshStages);
 LLGL_STATIC_ASSERT_FLAG(Stage, AllGraphicsStages);
 LLGL_STATIC_ASSERT_FLAG(Stage, AllStages);
 
@@ -729,6 +764,10 @@ LLGL_STATIC_ASSERT_OFFSET(Scissor, y);
 LLGL_STATIC_ASSERT_OFFSET(Scissor, width);
 LLGL_STATIC_ASSERT_OFFSET(Scissor, height);
 
+LLGL_STATIC_ASSERT_SIZE(SpecializationConstant);
+LLGL_STATIC_ASSERT_OFFSET(SpecializationConstant, id);
+LLGL_STATIC_ASSERT_OFFSET(SpecializationConstant, value);
+
 LLGL_STATIC_ASSERT_SIZE(DepthDescriptor);
 LLGL_STATIC_ASSERT_OFFSET(DepthDescriptor, testEnabled);
 LLGL_STATIC_ASSERT_OFFSET(DepthDescriptor, writeEnabled);
@@ -807,6 +846,7 @@ LLGL_STATIC_ASSERT_OFFSET(CommandBufferDescriptor, flags);
 LLGL_STATIC_ASSERT_OFFSET(CommandBufferDescriptor, numNativeBuffers);
 LLGL_STATIC_ASSERT_OFFSET(CommandBufferDescriptor, minStagingPoolSize);
 LLGL_STATIC_ASSERT_OFFSET(CommandBufferDescriptor, renderPass);
+LLGL_STATIC_ASSERT_OFFSET(CommandBufferDescriptor, commandQueue);
 
 LLGL_STATIC_ASSERT_SIZE(FormatAttributes);
 LLGL_STATIC_ASSERT_OFFSET(FormatAttributes, bitSize);
@@ -839,6 +879,11 @@ LLGL_STATIC_ASSERT_OFFSET(TextureRegion, subresource);
 LLGL_STATIC_ASSERT_OFFSET(TextureRegion, offset);
 LLGL_STATIC_ASSERT_OFFSET(TextureRegion, extent);
 
+LLGL_STATIC_ASSERT_SIZE(SparseTextureProperties);
+LLGL_STATIC_ASSERT_OFFSET(SparseTextureProperties, tileExtent);
+LLGL_STATIC_ASSERT_OFFSET(SparseTextureProperties, tileSize);
+LLGL_STATIC_ASSERT_OFFSET(SparseTextureProperties, firstMipTail);
+
 LLGL_STATIC_ASSERT_SIZE(TextureDescriptor);
 LLGL_STATIC_ASSERT_OFFSET(TextureDescriptor, debugName);
 LLGL_STATIC_ASSERT_OFFSET(TextureDescriptor, type);
@@ -850,6 +895,7 @@ LLGL_STATIC_ASSERT_OFFSET(TextureDescriptor, extent);
 LLGL_STATIC_ASSERT_OFFSET(TextureDescriptor, arrayLayers);
 LLGL_STATIC_ASSERT_OFFSET(TextureDescriptor, mipLevels);
 LLGL_STATIC_ASSERT_OFFSET(TextureDescriptor, samples);
+LLGL_STATIC_ASSERT_OFFSET(TextureDescriptor, transientSlot);
 LLGL_STATIC_ASSERT_OFFSET(TextureDescriptor, clearValue);
 
 LLGL_STATIC_ASSERT_SIZE(TextureViewDescriptor);
@@ -874,8 +920,18 @@ LLGL_STATIC_ASSERT_OFFSET(SwapChainDescriptor, depthBits);
 LLGL_STATIC_ASSERT_OFFSET(SwapChainDescriptor, stencilBits);
 LLGL_STATIC_ASSERT_OFFSET(SwapChainDescriptor, samples);
 LLGL_STATIC_ASSERT_OFFSET(SwapChainDescriptor, swapBuffers);
+LLGL_STATIC_ASSERT_OFFSET(SwapChainDescriptor, maxFramesInFlight);
+LLGL_STATIC_ASSERT_OFFSET(SwapChainDescriptor, presentMode);
+LLGL_STATIC_ASSERT_OFFSET(SwapChainDescriptor, colorSpace);
 LLGL_STATIC_ASSERT_OFFSET(SwapChainDescriptor, fullscreen);
 
+LLGL_STATIC_ASSERT_SIZE(MemoryHeapInfo);
+LLGL_STATIC_ASSERT_OFFSET(MemoryHeapInfo, size);
+LLGL_STATIC_ASSERT_OFFSET(MemoryHeapInfo, budget);
+LLGL_STATIC_ASSERT_OFFSET(MemoryHeapInfo, usage);
+LLGL_STATIC_ASSERT_OFFSET(MemoryHeapInfo, stagingUsage);
+LLGL_STATIC_ASSERT_OFFSET(MemoryHeapInfo, deviceLocal);
+
 LLGL_STATIC_ASSERT_SIZE(RenderingFeatures);
 LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasRenderTargets);
 LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, has3DTextures);
@@ -894,9 +950,12 @@ LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasGeometryShaders);
 LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasTessellationShaders);
 LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasTessellatorStage);
 LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasComputeShaders);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasMeshShaders);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasRayTracing);
 LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasInstancing);
 LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasOffsetInstancing);
 LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasIndirectDrawing);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasIndirectDrawCount);
 LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasViewportArrays);
 LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasConservativeRasterization);
 LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasStreamOutputs);
@@ -904,6 +963,13 @@ LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasLogicOp);
 LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasPipelineCaching);
 LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasPipelineStatistics);
 LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasRenderCondition);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasBufferRenderCondition);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasBindlessDescriptors);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasSparseTextures);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasVariableRateShading);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasExtendedDynamicState);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasTimestampCalibration);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasSubpasses);
 
 LLGL_STATIC_ASSERT_SIZE(RenderingLimits);
 LLGL_STATIC_ASSERT_OFFSET(RenderingLimits, lineWidthRange);
@@ -1011,6 +1077,11 @@ LLGL_STATIC_ASSERT_OFFSET(QueryPipelineStatistics, tessControlShaderInvocations)
 LLGL_STATIC_ASSERT_OFFSET(QueryPipelineStatistics, tessEvaluationShaderInvocations);
 LLGL_STATIC_ASSERT_OFFSET(QueryPipelineStatistics, computeShaderInvocations);
 
+LLGL_STATIC_ASSERT_SIZE(TimestampCalibration);
+LLGL_STATIC_ASSERT_OFFSET(TimestampCalibration, cpuTick);
+LLGL_STATIC_ASSERT_OFFSET(TimestampCalibration, gpuTimestamp);
+LLGL_STATIC_ASSERT_OFFSET(TimestampCalibration, maxDeviation);
+
 LLGL_STATIC_ASSERT_SIZE(QueryHeapDescriptor);
 LLGL_STATIC_ASSERT_OFFSET(QueryHeapDescriptor, debugName);
 LLGL_STATIC_ASSERT_OFFSET(QueryHeapDescriptor, type);
@@ -1022,12 +1093,10 @@ LLGL_STATIC_ASSERT_OFFSET(AttachmentFormatDescriptor, format);
 LLGL_STATIC_ASSERT_OFFSET(AttachmentFormatDescriptor, loadOp);
 LLGL_STATIC_ASSERT_OFFSET(AttachmentFormatDescriptor, storeOp);
 
-LLGL_STATIC_ASSERT_SIZE(RenderPassDescriptor);
-LLGL_STATIC_ASSERT_OFFSET(RenderPassDescriptor, debugName);
-LLGL_STATIC_ASSERT_OFFSET(RenderPassDescriptor, colorAttachments);
-LLGL_STATIC_ASSERT_OFFSET(RenderPassDescriptor, depthAttachment);
-LLGL_STATIC_ASSERT_OFFSET(RenderPassDescriptor, stencilAttachment);
-LLGL_STATIC_ASSERT_OFFSET(RenderPassDescriptor, samples);
+LLGL_STATIC_ASSERT_SIZE(SubpassDescriptor);
+LLGL_STATIC_ASSERT_OFFSET(SubpassDescriptor, colorAttachmentMask);
+LLGL_STATIC_ASSERT_OFFSET(SubpassDescriptor, inputAttachmentMask);
+LLGL_STATIC_ASSERT_OFFSET(SubpassDescriptor, depthStencilAttachment);
 
 LLGL_STATIC_ASSERT_SIZE(DisplayMode);
 LLGL_STATIC_ASSERT_OFFSET(DisplayMode, resolution);
@@ -1052,6 +1121,9 @@ LLGL_STATIC_ASSERT_OFFSET(DrawPatchIndirectArguments, numInstances);
 LLGL_STATIC_ASSERT_OFFSET(DrawPatchIndirectArguments, firstPatch);
 LLGL_STATIC_ASSERT_OFFSET(DrawPatchIndirectArguments, firstInstance);
 
+LLGL_STATIC_ASSERT_SIZE(DrawMeshIndirectArguments);
+LLGL_STATIC_ASSERT_OFFSET(DrawMeshIndirectArguments, numWorkGroups);
+
 LLGL_STATIC_ASSERT_SIZE(DispatchIndirectArguments);
 LLGL_STATIC_ASSERT_OFFSET(DispatchIndirectArguments, numThreadGroups);
 
@@ -1089,6 +1161,25 @@ LLGL_STATIC_ASSERT_OFFSET(ProfileCommandBufferRecord, querySections);
 LLGL_STATIC_ASSERT_OFFSET(ProfileCommandBufferRecord, renderConditionSections);
 LLGL_STATIC_ASSERT_OFFSET(ProfileCommandBufferRecord, drawCommands);
 LLGL_STATIC_ASSERT_OFFSET(ProfileCommandBufferRecord, dispatchCommands);
+LLGL_STATIC_ASSERT_OFFSET(ProfileCommandBufferRecord, stateChanges);
+LLGL_STATIC_ASSERT_OFFSET(ProfileCommandBufferRecord, redundantStateChanges);
+
+LLGL_STATIC_ASSERT_SIZE(ProfileMemoryRecord);
+LLGL_STATIC_ASSERT_OFFSET(ProfileMemoryRecord, uploadedBytes);
+LLGL_STATIC_ASSERT_OFFSET(ProfileMemoryRecord, readbackBytes);
+LLGL_STATIC_ASSERT_OFFSET(ProfileMemoryRecord, stagingMemoryUsage);
+LLGL_STATIC_ASSERT_OFFSET(ProfileMemoryRecord, deviceMemoryUsage);
+LLGL_STATIC_ASSERT_OFFSET(ProfileMemoryRecord, hostMemoryUsage);
+LLGL_STATIC_ASSERT_OFFSET(ProfileMemoryRecord, heapAllocations);
+LLGL_STATIC_ASSERT_OFFSET(ProfileMemoryRecord, heapAllocatedBytes);
+
+LLGL_STATIC_ASSERT_SIZE(WindowEvent);
+LLGL_STATIC_ASSERT_OFFSET(WindowEvent, type);
+LLGL_STATIC_ASSERT_OFFSET(WindowEvent, keyCode);
+LLGL_STATIC_ASSERT_OFFSET(WindowEvent, chr);
+LLGL_STATIC_ASSERT_OFFSET(WindowEvent, wheelMotion);
+LLGL_STATIC_ASSERT_OFFSET(WindowEvent, offset);
+LLGL_STATIC_ASSERT_OFFSET(WindowEvent, size);
 
 
 // } /namespace LLGL
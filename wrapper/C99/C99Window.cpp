@@ -285,6 +285,28 @@ LLGL_C_EXPORT void llglRemoveWindowEventListener(LLGLWindow window, int eventLis
         LLGL_PTR(Window, window)->RemoveEventListener(eventListener.get());
 }
 
+LLGL_C_EXPORT void llglSetWindowEventQueueEnabled(LLGLWindow window, bool enable)
+{
+    LLGL_PTR(Window, window)->SetEventQueueEnabled(enable);
+}
+
+LLGL_C_EXPORT size_t llglGetWindowEventQueue(LLGLWindow window, size_t maxEvents, LLGLWindowEvent* outEvents)
+{
+    ArrayView<WindowEvent> events = LLGL_PTR(Window, window)->GetEventQueue();
+    if (outEvents != nullptr)
+    {
+        const std::size_t numEvents = std::min<std::size_t>(maxEvents, events.size());
+        ::memcpy(outEvents, events.data(), sizeof(LLGLWindowEvent) * numEvents);
+        return numEvents;
+    }
+    return events.size();
+}
+
+LLGL_C_EXPORT void llglClearWindowEventQueue(LLGLWindow window)
+{
+    LLGL_PTR(Window, window)->ClearEventQueue();
+}
+
 LLGL_C_EXPORT void llglPostWindowQuit(LLGLWindow window)
 {
     LLGL_PTR(Window, window)->PostQuit();
@@ -57,16 +57,29 @@ namespace LLGL
             {
                 fixed (void* dataPtr = data)
                 {
-                    NativeLLGL.UpdateBuffer(dstBuffer.Native, dstOffset, dataPtr, (short)data.Length);
+                    NativeLLGL.UpdateBuffer(dstBuffer.Native, dstOffset, dataPtr, data.Length);
                 }
             }
         }
 
         public unsafe void UpdateBufferUnsafe(Buffer dstBuffer, long dstOffset, void* data, int dataSize)
         {
-            NativeLLGL.UpdateBuffer(dstBuffer.Native, dstOffset, data, (short)dataSize);
+            NativeLLGL.UpdateBuffer(dstBuffer.Native, dstOffset, data, dataSize);
         }
 
+        #if NETCOREAPP2_1_OR_GREATER || NETSTANDARD2_1_OR_GREATER
+        public void UpdateBuffer(Buffer dstBuffer, long dstOffset, ReadOnlySpan<byte> data)
+        {
+            unsafe
+            {
+                fixed (void* dataPtr = data)
+                {
+                    NativeLLGL.UpdateBuffer(dstBuffer.Native, dstOffset, dataPtr, data.Length);
+                }
+            }
+        }
+        #endif
+
         public void CopyBuffer(Buffer dstBuffer, long dstOffset, Buffer srcBuffer, long srcOffset, long size)
         {
             NativeLLGL.CopyBuffer(dstBuffer.Native, dstOffset, srcBuffer.Native, srcOffset, size);
@@ -97,6 +110,11 @@ namespace LLGL
             NativeLLGL.CopyTextureFromFramebuffer(dstTexture.Native, ref dstRegion, ref srcOffset);
         }
 
+        public void BlitTexture(Texture dstTexture, TextureRegion dstRegion, Texture srcTexture, TextureRegion srcRegion, SamplerFilter filter = SamplerFilter.Linear)
+        {
+            NativeLLGL.BlitTexture(dstTexture.Native, ref dstRegion, srcTexture.Native, ref srcRegion, filter);
+        }
+
         public void GenerateMips(Texture texture)
         {
             NativeLLGL.GenerateMips(texture.Native);
@@ -109,7 +127,7 @@ namespace LLGL
 
         public void SetViewport(Viewport viewport)
         {
-            NativeLLGL.SetViewport(ref viewport);
+            NativeLLGLFast.SetViewport(ref viewport);
         }
 
         public void SetViewports(Viewport[] viewports)
@@ -123,9 +141,27 @@ namespace LLGL
             }
         }
 
+        public unsafe void SetViewportsUnsafe(Viewport* viewports, int numViewports)
+        {
+            NativeLLGL.SetViewports(numViewports, viewports);
+        }
+
+        #if NETCOREAPP2_1_OR_GREATER || NETSTANDARD2_1_OR_GREATER
+        public void SetViewports(ReadOnlySpan<Viewport> viewports)
+        {
+            unsafe
+            {
+                fixed (Viewport* viewportsPtr = viewports)
+                {
+                    NativeLLGL.SetViewports(viewports.Length, viewportsPtr);
+                }
+            }
+        }
+        #endif
+
         public void SetScissor(Scissor scissor)
         {
-            NativeLLGL.SetScissor(ref scissor);
+            NativeLLGLFast.SetScissor(ref scissor);
         }
 
         public void SetScissors(Scissor[] scissors)
@@ -139,9 +175,27 @@ namespace LLGL
             }
         }
 
+        public unsafe void SetScissorsUnsafe(Scissor* scissors, int numScissors)
+        {
+            NativeLLGL.SetScissors(numScissors, scissors);
+        }
+
+        #if NETCOREAPP2_1_OR_GREATER || NETSTANDARD2_1_OR_GREATER
+        public void SetScissors(ReadOnlySpan<Scissor> scissors)
+        {
+            unsafe
+            {
+                fixed (Scissor* scissorsPtr = scissors)
+                {
+                    NativeLLGL.SetScissors(scissors.Length, scissorsPtr);
+                }
+            }
+        }
+        #endif
+
         public void SetVertexBuffer(Buffer buffer)
         {
-            NativeLLGL.SetVertexBuffer(buffer.Native);
+            NativeLLGLFast.SetVertexBuffer(buffer.Native);
         }
 
         public void SetVertexBufferArray(BufferArray bufferArray)
@@ -151,22 +205,35 @@ namespace LLGL
 
         public void SetIndexBuffer(Buffer buffer)
         {
-            NativeLLGL.SetIndexBuffer(buffer.Native);
+            NativeLLGLFast.SetIndexBuffer(buffer.Native);
         }
 
         public void SetIndexBuffer(Buffer buffer, Format format, long offset)
         {
-            NativeLLGL.SetIndexBufferExt(buffer.Native, format, offset);
+            NativeLLGLFast.SetIndexBufferExt(buffer.Native, format, offset);
         }
 
         public void SetResourceHeap(ResourceHeap resourceHeap, int descriptorSet)
         {
-            NativeLLGL.SetResourceHeap(resourceHeap.Native, descriptorSet);
+            NativeLLGLFast.SetResourceHeap(resourceHeap.Native, descriptorSet);
         }
 
         public void SetResource(int descriptor, Resource resource)
         {
-            NativeLLGL.SetResource(descriptor, resource.NativeBase);
+            NativeLLGLFast.SetResource(descriptor, resource.NativeBase);
+        }
+
+        public void SetResources(int firstDescriptor, Resource[] resources)
+        {
+            unsafe
+            {
+                var nativeResources = stackalloc NativeLLGL.Resource[resources.Length];
+                for (int i = 0; i < resources.Length; ++i)
+                {
+                    nativeResources[i] = (resources[i] != null ? resources[i].NativeBase : new NativeLLGL.Resource());
+                }
+                NativeLLGL.SetResources(firstDescriptor, resources.Length, nativeResources);
+            }
         }
 
         public void ResetResourceSlots(ResourceType resourceType, int firstSlot, int numSlots, BindFlags bindFlags, StageFlags stageFlags)
@@ -174,6 +241,19 @@ namespace LLGL
             NativeLLGL.ResetResourceSlots(resourceType, firstSlot, numSlots, (int)bindFlags, (int)stageFlags);
         }
 
+        public void ResourceBarrier(ResourceBarrierDescriptor[] barriers)
+        {
+            unsafe
+            {
+                var nativeBarriers = stackalloc NativeLLGL.ResourceBarrierDescriptor[barriers.Length];
+                for (int i = 0; i < barriers.Length; ++i)
+                {
+                    nativeBarriers[i] = barriers[i].Native;
+                }
+                NativeLLGL.ResourceBarrier(barriers.Length, nativeBarriers);
+            }
+        }
+
         public void BeginRenderPass(RenderTarget renderTarget)
         {
             NativeLLGL.BeginRenderPass(renderTarget.Native);
@@ -204,10 +284,31 @@ namespace LLGL
             NativeLLGL.EndRenderPass();
         }
 
+        public void NextSubpass()
+        {
+            NativeLLGL.NextSubpass();
+        }
+
         public void Clear(ClearFlags flags, ClearValue clearValue)
         {
             var nativeClearValue = clearValue.Native;
-            NativeLLGL.Clear((int)flags, ref nativeClearValue);
+            NativeLLGLFast.Clear((int)flags, ref nativeClearValue);
+        }
+
+        // Allocation-free overload that does not require a ClearValue instance.
+        public void Clear(ClearFlags flags, Color color, float depth = 1.0f, int stencil = 0)
+        {
+            unsafe
+            {
+                var nativeClearValue = new NativeLLGL.ClearValue();
+                nativeClearValue.color[0] = color.R;
+                nativeClearValue.color[1] = color.G;
+                nativeClearValue.color[2] = color.B;
+                nativeClearValue.color[3] = color.A;
+                nativeClearValue.depth = depth;
+                nativeClearValue.stencil = stencil;
+                NativeLLGLFast.Clear((int)flags, ref nativeClearValue);
+            }
         }
 
         public void ClearAttachments(AttachmentClear[] attachments)
@@ -225,7 +326,7 @@ namespace LLGL
 
         public void SetPipelineState(PipelineState pipelineState)
         {
-            NativeLLGL.SetPipelineState(pipelineState.Native);
+            NativeLLGLFast.SetPipelineState(pipelineState.Native);
         }
 
         public void SetBlendFactor(Color color)
@@ -243,7 +344,7 @@ namespace LLGL
 
         public void SetStencilReference(int reference, StencilFace stencilFace)
         {
-            NativeLLGL.SetStencilReference(reference, stencilFace);
+            NativeLLGLFast.SetStencilReference(reference, stencilFace);
         }
 
         public void SetUniforms(int first, byte[] data)
@@ -252,15 +353,28 @@ namespace LLGL
             {
                 fixed (void* dataPtr = data)
                 {
-                    NativeLLGL.SetUniforms(first, dataPtr, (short)data.Length);
+                    NativeLLGLFast.SetUniforms(first, dataPtr, (short)data.Length);
                 }
             }
         }
 
         public unsafe void SetUniformsUnsafe(int first, void* data, int dataSize)
         {
-            NativeLLGL.SetUniforms(first, data, (short)dataSize);
+            NativeLLGLFast.SetUniforms(first, data, (short)dataSize);
+        }
+
+        #if NETCOREAPP2_1_OR_GREATER || NETSTANDARD2_1_OR_GREATER
+        public void SetUniforms(int first, ReadOnlySpan<byte> data)
+        {
+            unsafe
+            {
+                fixed (void* dataPtr = data)
+                {
+                    NativeLLGLFast.SetUniforms(first, dataPtr, (short)data.Length);
+                }
+            }
         }
+        #endif
 
         public void BeginQuery(QueryHeap queryHeap, int query)
         {
@@ -277,11 +391,21 @@ namespace LLGL
             NativeLLGL.BeginRenderCondition(queryHeap.Native, query, mode);
         }
 
+        public void BeginRenderCondition(Buffer buffer, long offset, RenderConditionMode mode)
+        {
+            NativeLLGL.BeginRenderConditionBuffer(buffer.Native, offset, mode);
+        }
+
         public void EndRenderCondition()
         {
             NativeLLGL.EndRenderCondition();
         }
 
+        public void ResolveQueries(QueryHeap queryHeap, int firstQuery, int numQueries, Buffer dstBuffer, long dstOffset)
+        {
+            NativeLLGL.ResolveQueries(queryHeap.Native, firstQuery, numQueries, dstBuffer.Native, dstOffset);
+        }
+
         public void BeginStreamOutput(Buffer[] buffers)
         {
             unsafe
@@ -302,37 +426,37 @@ namespace LLGL
 
         public void Draw(int numVertices, int firstVertex)
         {
-            NativeLLGL.Draw(numVertices, firstVertex);
+            NativeLLGLFast.Draw(numVertices, firstVertex);
         }
 
         public void DrawIndexed(int numIndices, int firstIndex)
         {
-            NativeLLGL.DrawIndexed(numIndices, firstIndex);
+            NativeLLGLFast.DrawIndexed(numIndices, firstIndex);
         }
 
         public void DrawIndexed(int numIndices, int firstIndex, int vertexOffset)
         {
-            NativeLLGL.DrawIndexedExt(numIndices, firstIndex, vertexOffset);
+            NativeLLGLFast.DrawIndexedExt(numIndices, firstIndex, vertexOffset);
         }
 
         public void DrawInstanced(int numVertices, int firstVertex, int numInstances)
         {
-            NativeLLGL.DrawInstanced(numVertices, firstVertex, numInstances);
+            NativeLLGLFast.DrawInstanced(numVertices, firstVertex, numInstances);
         }
 
         public void DrawInstanced(int numVertices, int firstVertex, int numInstances, int firstInstance)
         {
-            NativeLLGL.DrawInstancedExt(numVertices, firstVertex, numInstances, firstInstance);
+            NativeLLGLFast.DrawInstancedExt(numVertices, firstVertex, numInstances, firstInstance);
         }
 
         public void DrawIndexedInstanced(int numIndices, int numInstances, int firstIndex)
         {
-            NativeLLGL.DrawIndexedInstanced(numIndices, numInstances, firstIndex);
+            NativeLLGLFast.DrawIndexedInstanced(numIndices, numInstances, firstIndex);
         }
 
         public void DrawIndexedInstanced(int numIndices, int numInstances, int firstIndex, int vertexOffset, int firstInstance)
         {
-            NativeLLGL.DrawIndexedInstancedExt(numIndices, numInstances, firstIndex, vertexOffset, firstInstance);
+            NativeLLGLFast.DrawIndexedInstancedExt(numIndices, numInstances, firstIndex, vertexOffset, firstInstance);
         }
 
         public void DrawIndirect(Buffer buffer, long offset)
@@ -345,6 +469,11 @@ namespace LLGL
             NativeLLGL.DrawIndirectExt(buffer.Native, offset, numCommands, stride);
         }
 
+        public void DrawIndirect(Buffer buffer, long offset, Buffer countBuffer, long countBufferOffset, int maxNumCommands, int stride)
+        {
+            NativeLLGL.DrawIndirectCount(buffer.Native, offset, countBuffer.Native, countBufferOffset, maxNumCommands, stride);
+        }
+
         public void DrawIndexedIndirect(Buffer buffer, long offset)
         {
             NativeLLGL.DrawIndexedIndirect(buffer.Native, offset);
@@ -355,9 +484,24 @@ namespace LLGL
             NativeLLGL.DrawIndexedIndirectExt(buffer.Native, offset, numCommands, stride);
         }
 
+        public void DrawIndexedIndirect(Buffer buffer, long offset, Buffer countBuffer, long countBufferOffset, int maxNumCommands, int stride)
+        {
+            NativeLLGL.DrawIndexedIndirectCount(buffer.Native, offset, countBuffer.Native, countBufferOffset, maxNumCommands, stride);
+        }
+
+        public void DrawMesh(int numWorkGroupsX, int numWorkGroupsY, int numWorkGroupsZ)
+        {
+            NativeLLGLFast.DrawMesh(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
+        }
+
+        public void DrawMeshIndirect(Buffer buffer, long offset, int numCommands, int stride)
+        {
+            NativeLLGL.DrawMeshIndirect(buffer.Native, offset, numCommands, stride);
+        }
+
         public void Dispatch(int numWorkGroupsX, int numWorkGroupsY, int numWorkGroupsZ)
         {
-            NativeLLGL.Dispatch(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
+            NativeLLGLFast.Dispatch(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
         }
 
         public void DispatchIndirect(Buffer buffer, long offset)
@@ -370,9 +514,47 @@ namespace LLGL
             NativeLLGL.PushDebugGroup(name);
         }
 
+        // Allocation-free overload for debug group names that are converted to ANSI only once, e.g. when stored in a static field.
+        public void PushDebugGroup(AnsiString name)
+        {
+            unsafe
+            {
+                fixed (byte* namePtr = name.Ascii)
+                {
+                    NativeLLGLFast.PushDebugGroup(namePtr);
+                }
+            }
+        }
+
         public void PopDebugGroup()
         {
-            NativeLLGL.PopDebugGroup();
+            NativeLLGLFast.PopDebugGroup();
+        }
+
+        // Executes all packets with a single native call, see CommandPacket.
+        public void ExecuteCommandPackets(CommandPacket[] packets, int numPackets)
+        {
+            if (numPackets < 0 || numPackets > packets.Length)
+            {
+                throw new ArgumentOutOfRangeException("numPackets", "Number of command packets must not exceed array length");
+            }
+            unsafe
+            {
+                fixed (CommandPacket* packetsPtr = packets)
+                {
+                    NativeLLGL.ExecuteCommandPackets(numPackets, packetsPtr);
+                }
+            }
+        }
+
+        public void ExecuteCommandPackets(CommandPacket[] packets)
+        {
+            ExecuteCommandPackets(packets, packets.Length);
+        }
+
+        public unsafe void ExecuteCommandPacketsUnsafe(CommandPacket* packets, int numPackets)
+        {
+            NativeLLGL.ExecuteCommandPackets(numPackets, packets);
         }
     }
 }
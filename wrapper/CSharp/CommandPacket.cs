@@ -0,0 +1,292 @@
+/*
+ * CommandPacket.cs
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+using System;
+using System.Runtime.InteropServices;
+
+namespace LLGL
+{
+    internal enum CommandPacketType
+    {
+        SetViewport,
+        SetScissor,
+        SetVertexBuffer,
+        SetIndexBuffer,
+        SetResourceHeap,
+        SetResource,
+        SetPipelineState,
+        SetStencilReference,
+        SetUniforms,
+        Clear,
+        Draw,
+        DrawIndexed,
+        DrawInstanced,
+        DrawIndexedInstanced,
+        DrawMesh,
+        Dispatch,
+        PushDebugGroup,
+        PopDebugGroup,
+    }
+
+    internal struct CommandPacketSetIndexBuffer
+    {
+        public NativeLLGL.Buffer buffer;
+        public Format            format;
+        public long              offset;
+    }
+
+    internal struct CommandPacketSetResourceHeap
+    {
+        public NativeLLGL.ResourceHeap resourceHeap;
+        public int                     descriptorSet;
+    }
+
+    internal struct CommandPacketSetResource
+    {
+        public NativeLLGL.Resource resource;
+        public int                 descriptor;
+    }
+
+    internal struct CommandPacketSetStencilReference
+    {
+        public int         reference;
+        public StencilFace stencilFace;
+    }
+
+    internal unsafe struct CommandPacketSetUniforms
+    {
+        public void*  data;
+        public int    first;
+        public ushort dataSize;
+    }
+
+    internal struct CommandPacketClear
+    {
+        public NativeLLGL.ClearValue clearValue;
+        public ClearFlags            flags;
+    }
+
+    internal struct CommandPacketDraw
+    {
+        public int numVertices;
+        public int firstVertex;
+        public int numInstances;
+        public int firstInstance;
+    }
+
+    internal struct CommandPacketDrawIndexed
+    {
+        public int numIndices;
+        public int firstIndex;
+        public int vertexOffset;
+        public int numInstances;
+        public int firstInstance;
+    }
+
+    internal struct CommandPacketWorkGroups
+    {
+        public int numWorkGroupsX;
+        public int numWorkGroupsY;
+        public int numWorkGroupsZ;
+    }
+
+    [StructLayout(LayoutKind.Explicit)]
+    internal unsafe struct CommandPacketData
+    {
+        [FieldOffset(0)] public Viewport                         viewport;
+        [FieldOffset(0)] public Scissor                          scissor;
+        [FieldOffset(0)] public NativeLLGL.Buffer                vertexBuffer;
+        [FieldOffset(0)] public CommandPacketSetIndexBuffer      indexBuffer;
+        [FieldOffset(0)] public CommandPacketSetResourceHeap     resourceHeap;
+        [FieldOffset(0)] public CommandPacketSetResource         resource;
+        [FieldOffset(0)] public NativeLLGL.PipelineState         pipelineState;
+        [FieldOffset(0)] public CommandPacketSetStencilReference stencilReference;
+        [FieldOffset(0)] public CommandPacketSetUniforms         uniforms;
+        [FieldOffset(0)] public CommandPacketClear               clear;
+        [FieldOffset(0)] public CommandPacketDraw                draw;
+        [FieldOffset(0)] public CommandPacketDrawIndexed         drawIndexed;
+        [FieldOffset(0)] public CommandPacketWorkGroups          workGroups;
+        [FieldOffset(0)] public byte*                            debugGroupName;
+    }
+
+    /*
+    Blittable command for CommandBuffer.ExecuteCommandPackets, see LLGLCommandPacket in the C99 wrapper.
+    An array of packets can be recorded once per frame and submitted with a single native call instead of one call per command.
+    */
+    [StructLayout(LayoutKind.Sequential)]
+    public struct CommandPacket
+    {
+        internal CommandPacketType type;
+        internal CommandPacketData data;
+
+        public static CommandPacket SetViewport(Viewport viewport)
+        {
+            var packet = new CommandPacket() { type = CommandPacketType.SetViewport };
+            packet.data.viewport = viewport;
+            return packet;
+        }
+
+        public static CommandPacket SetScissor(Scissor scissor)
+        {
+            var packet = new CommandPacket() { type = CommandPacketType.SetScissor };
+            packet.data.scissor = scissor;
+            return packet;
+        }
+
+        public static CommandPacket SetVertexBuffer(Buffer buffer)
+        {
+            var packet = new CommandPacket() { type = CommandPacketType.SetVertexBuffer };
+            packet.data.vertexBuffer = buffer.Native;
+            return packet;
+        }
+
+        public static CommandPacket SetIndexBuffer(Buffer buffer)
+        {
+            return SetIndexBuffer(buffer, Format.Undefined, 0);
+        }
+
+        public static CommandPacket SetIndexBuffer(Buffer buffer, Format format, long offset = 0)
+        {
+            var packet = new CommandPacket() { type = CommandPacketType.SetIndexBuffer };
+            packet.data.indexBuffer.buffer = buffer.Native;
+            packet.data.indexBuffer.format = format;
+            packet.data.indexBuffer.offset = offset;
+            return packet;
+        }
+
+        public static CommandPacket SetResourceHeap(ResourceHeap resourceHeap, int descriptorSet = 0)
+        {
+            var packet = new CommandPacket() { type = CommandPacketType.SetResourceHeap };
+            packet.data.resourceHeap.resourceHeap  = resourceHeap.Native;
+            packet.data.resourceHeap.descriptorSet = descriptorSet;
+            return packet;
+        }
+
+        public static CommandPacket SetResource(int descriptor, Resource resource)
+        {
+            var packet = new CommandPacket() { type = CommandPacketType.SetResource };
+            packet.data.resource.resource   = resource.NativeBase;
+            packet.data.resource.descriptor = descriptor;
+            return packet;
+        }
+
+        public static CommandPacket SetPipelineState(PipelineState pipelineState)
+        {
+            var packet = new CommandPacket() { type = CommandPacketType.SetPipelineState };
+            packet.data.pipelineState = pipelineState.Native;
+            return packet;
+        }
+
+        public static CommandPacket SetStencilReference(int reference, StencilFace stencilFace = StencilFace.FrontAndBack)
+        {
+            var packet = new CommandPacket() { type = CommandPacketType.SetStencilReference };
+            packet.data.stencilReference.reference   = reference;
+            packet.data.stencilReference.stencilFace = stencilFace;
+            return packet;
+        }
+
+        // The data must remain pinned until CommandBuffer.ExecuteCommandPackets returns.
+        public static unsafe CommandPacket SetUniformsUnsafe(int first, void* data, int dataSize)
+        {
+            var packet = new CommandPacket() { type = CommandPacketType.SetUniforms };
+            packet.data.uniforms.data     = data;
+            packet.data.uniforms.first    = first;
+            packet.data.uniforms.dataSize = (ushort)dataSize;
+            return packet;
+        }
+
+        public static CommandPacket Clear(ClearFlags flags, Color color, float depth = 1.0f, int stencil = 0)
+        {
+            var packet = new CommandPacket() { type = CommandPacketType.Clear };
+            unsafe
+            {
+                packet.data.clear.clearValue.color[0] = color.R;
+                packet.data.clear.clearValue.color[1] = color.G;
+                packet.data.clear.clearValue.color[2] = color.B;
+                packet.data.clear.clearValue.color[3] = color.A;
+            }
+            packet.data.clear.clearValue.depth   = depth;
+            packet.data.clear.clearValue.stencil = stencil;
+            packet.data.clear.flags              = flags;
+            return packet;
+        }
+
+        public static CommandPacket Draw(int numVertices, int firstVertex)
+        {
+            var packet = new CommandPacket() { type = CommandPacketType.Draw };
+            packet.data.draw.numVertices = numVertices;
+            packet.data.draw.firstVertex = firstVertex;
+            return packet;
+        }
+
+        public static CommandPacket DrawIndexed(int numIndices, int firstIndex, int vertexOffset = 0)
+        {
+            var packet = new CommandPacket() { type = CommandPacketType.DrawIndexed };
+            packet.data.drawIndexed.numIndices   = numIndices;
+            packet.data.drawIndexed.firstIndex   = firstIndex;
+            packet.data.drawIndexed.vertexOffset = vertexOffset;
+            return packet;
+        }
+
+        public static CommandPacket DrawInstanced(int numVertices, int firstVertex, int numInstances, int firstInstance = 0)
+        {
+            var packet = new CommandPacket() { type = CommandPacketType.DrawInstanced };
+            packet.data.draw.numVertices   = numVertices;
+            packet.data.draw.firstVertex   = firstVertex;
+            packet.data.draw.numInstances  = numInstances;
+            packet.data.draw.firstInstance = firstInstance;
+            return packet;
+        }
+
+        public static CommandPacket DrawIndexedInstanced(int numIndices, int numInstances, int firstIndex, int vertexOffset = 0, int firstInstance = 0)
+        {
+            var packet = new CommandPacket() { type = CommandPacketType.DrawIndexedInstanced };
+            packet.data.drawIndexed.numIndices    = numIndices;
+            packet.data.drawIndexed.firstIndex    = firstIndex;
+            packet.data.drawIndexed.vertexOffset  = vertexOffset;
+            packet.data.drawIndexed.numInstances  = numInstances;
+            packet.data.drawIndexed.firstInstance = firstInstance;
+            return packet;
+        }
+
+        public static CommandPacket DrawMesh(int numWorkGroupsX, int numWorkGroupsY, int numWorkGroupsZ)
+        {
+            var packet = new CommandPacket() { type = CommandPacketType.DrawMesh };
+            packet.data.workGroups.numWorkGroupsX = numWorkGroupsX;
+            packet.data.workGroups.numWorkGroupsY = numWorkGroupsY;
+            packet.data.workGroups.numWorkGroupsZ = numWorkGroupsZ;
+            return packet;
+        }
+
+        public static CommandPacket Dispatch(int numWorkGroupsX, int numWorkGroupsY, int numWorkGroupsZ)
+        {
+            var packet = new CommandPacket() { type = CommandPacketType.Dispatch };
+            packet.data.workGroups.numWorkGroupsX = numWorkGroupsX;
+            packet.data.workGroups.numWorkGroupsY = numWorkGroupsY;
+            packet.data.workGroups.numWorkGroupsZ = numWorkGroupsZ;
+            return packet;
+        }
+
+        // The null-terminated name must remain pinned until CommandBuffer.ExecuteCommandPackets returns.
+        public static unsafe CommandPacket PushDebugGroupUnsafe(byte* name)
+        {
+            var packet = new CommandPacket() { type = CommandPacketType.PushDebugGroup };
+            packet.data.debugGroupName = name;
+            return packet;
+        }
+
+        public static CommandPacket PopDebugGroup()
+        {
+            return new CommandPacket() { type = CommandPacketType.PopDebugGroup };
+        }
+    }
+}
+
+
+
+
+// ================================================================================
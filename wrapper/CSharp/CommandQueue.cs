@@ -21,6 +21,32 @@ namespace LLGL
             NativeLLGL.SubmitCommandBuffer(commandBuffer.Native);
         }
 
+        public void Submit(CommandBuffer[] commandBuffers)
+        {
+            unsafe
+            {
+                var nativeCommandBuffers = stackalloc NativeLLGL.CommandBuffer[commandBuffers.Length];
+                for (int i = 0; i < commandBuffers.Length; ++i)
+                {
+                    nativeCommandBuffers[i] = commandBuffers[i].Native;
+                }
+                NativeLLGL.SubmitCommandBuffers(commandBuffers.Length, nativeCommandBuffers);
+            }
+        }
+
+        public void Present(SwapChain[] swapChains)
+        {
+            unsafe
+            {
+                var nativeSwapChains = stackalloc NativeLLGL.SwapChain[swapChains.Length];
+                for (int i = 0; i < swapChains.Length; ++i)
+                {
+                    nativeSwapChains[i] = swapChains[i].NativeSub;
+                }
+                NativeLLGL.PresentSwapChains(swapChains.Length, nativeSwapChains);
+            }
+        }
+
         public bool QueryResult(QueryHeap queryHeap, int firstQuery, int numQueries, ref QueryPipelineStatistics[] data)
         {
             unsafe
@@ -54,6 +80,12 @@ namespace LLGL
             }
         }
 
+        public bool QueryTimestampCalibration(out TimestampCalibration calibration)
+        {
+            calibration = new TimestampCalibration();
+            return NativeLLGL.QueryTimestampCalibration(ref calibration);
+        }
+
         public void Submit(Fence fence)
         {
             NativeLLGL.SubmitFence(fence.Native);
@@ -64,6 +96,21 @@ namespace LLGL
             return NativeLLGL.WaitFence(fence.Native, timeout);
         }
 
+        public void Submit(Fence fence, long value)
+        {
+            NativeLLGL.SubmitFenceValue(fence.Native, value);
+        }
+
+        public void SubmitWait(Fence fence, long value)
+        {
+            NativeLLGL.SubmitWaitFenceValue(fence.Native, value);
+        }
+
+        public bool WaitFence(Fence fence, long value, long timeout)
+        {
+            return NativeLLGL.WaitFenceValue(fence.Native, value, timeout);
+        }
+
         public void WaitIdle()
         {
             NativeLLGL.WaitIdle();
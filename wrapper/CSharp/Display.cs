@@ -161,6 +161,17 @@ namespace LLGL
             }
         }
 
+        public bool WaitForVBlank()
+        {
+            return NativeLLGL.WaitForVBlank(Native);
+        }
+
+        public bool GetVBlankTiming(out DisplayVBlankTiming timing)
+        {
+            timing = new DisplayVBlankTiming();
+            return NativeLLGL.GetDisplayVBlankTiming(Native, ref timing);
+        }
+
     }
 }
 
@@ -33,6 +33,14 @@ namespace LLGL
         {
             NativeLLGL.ReleaseFence(Native);
         }
+
+        public long CompletedValue
+        {
+            get
+            {
+                return NativeLLGL.GetFenceCompletedValue(Native);
+            }
+        }
     }
 }
 
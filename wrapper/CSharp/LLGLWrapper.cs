@@ -53,6 +53,17 @@ namespace LLGL
         Back,
     }
 
+    public enum ShadingRate
+    {
+        Rate1x1,
+        Rate1x2,
+        Rate2x1,
+        Rate2x2,
+        Rate2x4,
+        Rate4x2,
+        Rate4x4,
+    }
+
     public enum Format
     {
         Undefined,
@@ -532,6 +543,7 @@ namespace LLGL
         StreamOutPrimitivesWritten,
         StreamOutOverflow,
         PipelineStatistics,
+        Timestamp,
     }
 
     public enum ErrorType
@@ -637,6 +649,15 @@ namespace LLGL
         Sampler,
     }
 
+    public enum ResidencyPriority
+    {
+        Minimum,
+        Low,
+        Normal,
+        High,
+        Maximum,
+    }
+
     public enum SamplerAddressMode
     {
         Repeat,
@@ -661,6 +682,8 @@ namespace LLGL
         Geometry,
         Fragment,
         Compute,
+        Task,
+        Mesh,
     }
 
     public enum ShaderSourceType
@@ -705,6 +728,22 @@ namespace LLGL
         ViewportIndex,
     }
 
+    public enum PresentMode
+    {
+        Default,
+        Fifo,
+        FifoRelaxed,
+        Mailbox,
+        Immediate,
+    }
+
+    public enum ColorSpace
+    {
+        SRGB,
+        ExtendedSRGB,
+        HDR10,
+    }
+
     public enum TextureType
     {
         Texture1D,
@@ -728,6 +767,22 @@ namespace LLGL
         Alpha,
     }
 
+    public enum WindowEventType
+    {
+        Quit,
+        KeyDown,
+        KeyUp,
+        DoubleClick,
+        Char,
+        WheelMotion,
+        LocalMotion,
+        GlobalMotion,
+        Resize,
+        Update,
+        GetFocus,
+        LostFocus,
+    }
+
     /* ----- Flags ----- */
 
     [Flags]
@@ -739,9 +794,18 @@ namespace LLGL
     [Flags]
     public enum CommandBufferFlags : int
     {
-        Secondary       = (1 << 0),
-        MultiSubmit     = (1 << 1),
-        ImmediateSubmit = (1 << 2),
+        Secondary        = (1 << 0),
+        MultiSubmit      = (1 << 1),
+        ImmediateSubmit  = (1 << 2),
+        ExplicitBarriers = (1 << 3),
+    }
+
+    [Flags]
+    public enum CommandQueueFlags : int
+    {
+        Graphics = (1 << 0),
+        Compute  = (1 << 1),
+        Copy     = (1 << 2),
     }
 
     [Flags]
@@ -789,6 +853,15 @@ namespace LLGL
         All  = (R | G | B | A),
     }
 
+    [Flags]
+    public enum DynamicStateFlags : int
+    {
+        CullMode          = (1 << 0),
+        DepthState        = (1 << 1),
+        StencilState      = (1 << 2),
+        PrimitiveTopology = (1 << 3),
+    }
+
     [Flags]
     public enum RenderSystemFlags : int
     {
@@ -796,6 +869,9 @@ namespace LLGL
         PreferNVIDIA = (1 << 1),
         PreferAMD    = (1 << 2),
         PreferIntel  = (1 << 3),
+        ProfileOnly  = (1 << 4),
+        Headless     = (1 << 5),
+        FrameCapture = (1 << 6),
     }
 
     [Flags]
@@ -813,6 +889,7 @@ namespace LLGL
         CombinedSampler        = (1 << 9),
         CopySrc                = (1 << 10),
         CopyDst                = (1 << 11),
+        InputAttachment        = (1 << 12),
     }
 
     [Flags]
@@ -826,12 +903,17 @@ namespace LLGL
     [Flags]
     public enum MiscFlags : int
     {
-        DynamicUsage  = (1 << 0),
-        FixedSamples  = (1 << 1),
-        GenerateMips  = (1 << 2),
-        NoInitialData = (1 << 3),
-        Append        = (1 << 4),
-        Counter       = (1 << 5),
+        DynamicUsage      = (1 << 0),
+        FixedSamples      = (1 << 1),
+        GenerateMips      = (1 << 2),
+        NoInitialData     = (1 << 3),
+        Append            = (1 << 4),
+        Counter           = (1 << 5),
+        Transient         = (1 << 6),
+        Sparse            = (1 << 7),
+        Readback          = (1 << 8),
+        Memoryless        = (1 << 9),
+        PersistentMapping = (1 << 10),
     }
 
     [Flags]
@@ -865,9 +947,12 @@ namespace LLGL
         GeometryStage       = (1 << 3),
         FragmentStage       = (1 << 4),
         ComputeStage        = (1 << 5),
+        TaskStage           = (1 << 6),
+        MeshStage           = (1 << 7),
         AllTessStages       = (TessControlStage | TessEvaluationStage),
+        AllMeshStages       = (TaskStage | MeshStage),
         AllGraphicsStages   = (VertexStage | AllTessStages | GeometryStage | FragmentStage),
-        AllStages           = (AllGraphicsStages | ComputeStage),
+        AllStages           = (AllGraphicsStages | ComputeStage | AllMeshStages),
     }
 
     [Flags]
@@ -965,6 +1050,18 @@ namespace LLGL
         public int Height { get; set; } /* = 0 */
     }
 
+    public struct SpecializationConstant
+    {
+        public SpecializationConstant(int id = 0, int value = 0)
+        {
+            ID    = id;
+            Value = value;
+        }
+
+        public int ID { get; set; }    /* = 0 */
+        public int Value { get; set; } /* = 0 */
+    }
+
     public struct QueryPipelineStatistics
     {
         public long InputAssemblyVertices { get; set; }           /* = 0 */
@@ -980,6 +1077,13 @@ namespace LLGL
         public long ComputeShaderInvocations { get; set; }        /* = 0 */
     }
 
+    public struct TimestampCalibration
+    {
+        public long CpuTick { get; set; }      /* = 0 */
+        public long GpuTimestamp { get; set; } /* = 0 */
+        public long MaxDeviation { get; set; } /* = 0 */
+    }
+
     public struct TextureSubresource
     {
         public int BaseArrayLayer { get; set; } /* = 0 */
@@ -1083,6 +1187,20 @@ namespace LLGL
         public Extent3D           Extent { get; set; }      /* = new Extent3D() */
     }
 
+    public struct SparseTextureProperties
+    {
+        public Extent3D TileExtent { get; set; }   /* = new Extent3D() */
+        public int      TileSize { get; set; }     /* = 0 */
+        public int      FirstMipTail { get; set; } /* = 0 */
+    }
+
+    public struct DisplayVBlankTiming
+    {
+        public long LastVBlank { get; set; }    /* = 0 */
+        public long NextVBlank { get; set; }    /* = 0 */
+        public long RefreshPeriod { get; set; } /* = 0 */
+    }
+
     /* ----- Classes ----- */
 
     public class CommandBufferDescriptor
@@ -1138,9 +1256,12 @@ namespace LLGL
 
     public class ComputePipelineDescriptor
     {
-        public AnsiString     DebugName { get; set; }      = null;
-        public PipelineLayout PipelineLayout { get; set; } = null;
-        public Shader         ComputeShader { get; set; }  = null;
+        public AnsiString               DebugName { get; set; }               = null;
+        public PipelineLayout           PipelineLayout { get; set; }          = null;
+        public Shader                   ComputeShader { get; set; }           = null;
+        public SpecializationConstant[] SpecializationConstants { get; set; }
+        public bool                     AsyncCompilation { get; set; }        = false;
+        public PipelineState            Placeholder { get; set; }             = null;
 
         internal NativeLLGL.ComputePipelineDescriptor Native
         {
@@ -1161,6 +1282,19 @@ namespace LLGL
                     {
                         native.computeShader = ComputeShader.Native;
                     }
+                    if (SpecializationConstants != null)
+                    {
+                        native.numSpecializationConstants = (IntPtr)SpecializationConstants.Length;
+                        fixed (SpecializationConstant* specializationConstantsPtr = SpecializationConstants)
+                        {
+                            native.specializationConstants = specializationConstantsPtr;
+                        }
+                    }
+                    native.asyncCompilation = AsyncCompilation;
+                    if (Placeholder != null)
+                    {
+                        native.placeholder = Placeholder.Native;
+                    }
                 }
                 return native;
             }
@@ -1169,8 +1303,12 @@ namespace LLGL
 
     public class ProfileTimeRecord
     {
-        public AnsiString Annotation { get; set; }  = "";
-        public long       ElapsedTime { get; set; } = 0;
+        public AnsiString Annotation { get; set; }     = "";
+        public long       ElapsedTime { get; set; }    = 0;
+        public long       CpuTimestamp { get; set; }   = 0;
+        public long       CpuElapsedTime { get; set; } = 0;
+        public int        Depth { get; set; }          = 0;
+        public int        CommandBuffer { get; set; }  = 0;
 
         public ProfileTimeRecord() { }
 
@@ -1190,7 +1328,61 @@ namespace LLGL
                     {
                         native.annotation = annotationPtr;
                     }
-                    native.elapsedTime = ElapsedTime;
+                    native.elapsedTime    = ElapsedTime;
+                    native.cpuTimestamp   = CpuTimestamp;
+                    native.cpuElapsedTime = CpuElapsedTime;
+                    native.depth          = Depth;
+                    native.commandBuffer  = CommandBuffer;
+                }
+                return native;
+            }
+            set
+            {
+                unsafe
+                {
+                    Annotation     = Marshal.PtrToStringAnsi((IntPtr)value.annotation);
+                    ElapsedTime    = value.elapsedTime;
+                    CpuTimestamp   = value.cpuTimestamp;
+                    CpuElapsedTime = value.cpuElapsedTime;
+                    Depth          = value.depth;
+                    CommandBuffer  = value.commandBuffer;
+                }
+            }
+        }
+    }
+
+    public class ProfilePassRecord
+    {
+        public AnsiString              Annotation { get; set; }         = "";
+        public long                    ElapsedTime { get; set; }        = 0;
+        public QueryPipelineStatistics PipelineStatistics { get; set; }
+        public int                     Depth { get; set; }              = 0;
+        public int                     CommandBuffer { get; set; }      = 0;
+        public int                     FrameLatency { get; set; }       = 0;
+
+        public ProfilePassRecord() { }
+
+        internal ProfilePassRecord(NativeLLGL.ProfilePassRecord native)
+        {
+            Native = native;
+        }
+
+        internal NativeLLGL.ProfilePassRecord Native
+        {
+            get
+            {
+                var native = new NativeLLGL.ProfilePassRecord();
+                unsafe
+                {
+                    fixed (byte* annotationPtr = Annotation.Ascii)
+                    {
+                        native.annotation = annotationPtr;
+                    }
+                    native.elapsedTime        = ElapsedTime;
+                    native.pipelineStatistics = PipelineStatistics;
+                    native.depth              = Depth;
+                    native.commandBuffer      = CommandBuffer;
+                    native.frameLatency       = FrameLatency;
                 }
                 return native;
             }
@@ -1198,8 +1390,12 @@ namespace LLGL
             {
                 unsafe
                 {
-                    Annotation  = Marshal.PtrToStringAnsi((IntPtr)value.annotation);
-                    ElapsedTime = value.elapsedTime;
+                    Annotation         = Marshal.PtrToStringAnsi((IntPtr)value.annotation);
+                    ElapsedTime        = value.elapsedTime;
+                    PipelineStatistics = value.pipelineStatistics;
+                    Depth              = value.depth;
+                    CommandBuffer      = value.commandBuffer;
+                    FrameLatency       = value.frameLatency;
                 }
             }
         }
@@ -1263,6 +1459,8 @@ namespace LLGL
         public int RenderConditionSections { get; set; }  = 0;
         public int DrawCommands { get; set; }             = 0;
         public int DispatchCommands { get; set; }         = 0;
+        public int StateChanges { get; set; }             = 0;
+        public int RedundantStateChanges { get; set; }    = 0;
 
         public ProfileCommandBufferRecord() { }
 
@@ -1299,6 +1497,40 @@ namespace LLGL
                 RenderConditionSections  = value.renderConditionSections;
                 DrawCommands             = value.drawCommands;
                 DispatchCommands         = value.dispatchCommands;
+                StateChanges             = value.stateChanges;
+                RedundantStateChanges    = value.redundantStateChanges;
+            }
+        }
+    }
+
+    public class ProfileMemoryRecord
+    {
+        public long UploadedBytes { get; set; }      = 0;
+        public long ReadbackBytes { get; set; }      = 0;
+        public long StagingMemoryUsage { get; set; } = 0;
+        public long DeviceMemoryUsage { get; set; }  = 0;
+        public long HostMemoryUsage { get; set; }    = 0;
+        public long HeapAllocations { get; set; }    = 0;
+        public long HeapAllocatedBytes { get; set; } = 0;
+
+        public ProfileMemoryRecord() { }
+
+        internal ProfileMemoryRecord(NativeLLGL.ProfileMemoryRecord native)
+        {
+            Native = native;
+        }
+
+        internal NativeLLGL.ProfileMemoryRecord Native
+        {
+            set
+            {
+                UploadedBytes      = value.uploadedBytes;
+                ReadbackBytes      = value.readbackBytes;
+                StagingMemoryUsage = value.stagingMemoryUsage;
+                DeviceMemoryUsage  = value.deviceMemoryUsage;
+                HostMemoryUsage    = value.hostMemoryUsage;
+                HeapAllocations    = value.heapAllocations;
+                HeapAllocatedBytes = value.heapAllocatedBytes;
             }
         }
     }
@@ -1326,9 +1558,12 @@ namespace LLGL
         public bool HasTessellationShaders { get; set; }       = false;
         public bool HasTessellatorStage { get; set; }          = false;
         public bool HasComputeShaders { get; set; }            = false;
+        public bool HasMeshShaders { get; set; }               = false;
+        public bool HasRayTracing { get; set; }                = false;
         public bool HasInstancing { get; set; }                = false;
         public bool HasOffsetInstancing { get; set; }          = false;
         public bool HasIndirectDrawing { get; set; }           = false;
+        public bool HasIndirectDrawCount { get; set; }         = false;
         public bool HasViewportArrays { get; set; }            = false;
         public bool HasConservativeRasterization { get; set; } = false;
         public bool HasStreamOutputs { get; set; }             = false;
@@ -1336,6 +1571,13 @@ namespace LLGL
         public bool HasPipelineCaching { get; set; }           = false;
         public bool HasPipelineStatistics { get; set; }        = false;
         public bool HasRenderCondition { get; set; }           = false;
+        public bool HasBufferRenderCondition { get; set; }     = false;
+        public bool HasBindlessDescriptors { get; set; }       = false;
+        public bool HasSparseTextures { get; set; }            = false;
+        public bool HasVariableRateShading { get; set; }       = false;
+        public bool HasExtendedDynamicState { get; set; }      = false;
+        public bool HasTimestampCalibration { get; set; }      = false;
+        public bool HasSubpasses { get; set; }                 = false;
 
         public RenderingFeatures() { }
 
@@ -1365,9 +1607,12 @@ namespace LLGL
                 HasTessellationShaders       = value.hasTessellationShaders;
                 HasTessellatorStage          = value.hasTessellatorStage;
                 HasComputeShaders            = value.hasComputeShaders;
+                HasMeshShaders               = value.hasMeshShaders;
+                HasRayTracing                = value.hasRayTracing;
                 HasInstancing                = value.hasInstancing;
                 HasOffsetInstancing          = value.hasOffsetInstancing;
                 HasIndirectDrawing           = value.hasIndirectDrawing;
+                HasIndirectDrawCount         = value.hasIndirectDrawCount;
                 HasViewportArrays            = value.hasViewportArrays;
                 HasConservativeRasterization = value.hasConservativeRasterization;
                 HasStreamOutputs             = value.hasStreamOutputs;
@@ -1375,6 +1620,13 @@ namespace LLGL
                 HasPipelineCaching           = value.hasPipelineCaching;
                 HasPipelineStatistics        = value.hasPipelineStatistics;
                 HasRenderCondition           = value.hasRenderCondition;
+                HasBufferRenderCondition     = value.hasBufferRenderCondition;
+                HasBindlessDescriptors       = value.hasBindlessDescriptors;
+                HasSparseTextures            = value.hasSparseTextures;
+                HasVariableRateShading       = value.hasVariableRateShading;
+                HasExtendedDynamicState      = value.hasExtendedDynamicState;
+                HasTimestampCalibration      = value.hasTimestampCalibration;
+                HasSubpasses                 = value.hasSubpasses;
             }
         }
     }
@@ -1557,6 +1809,32 @@ namespace LLGL
         }
     }
 
+    public class ResourceBarrierDescriptor
+    {
+        public Resource   Resource { get; set; }  = null;
+        public BindFlags  SrcUsage { get; set; }  = 0;
+        public BindFlags  DstUsage { get; set; }  = 0;
+        public StageFlags SrcStages { get; set; } = StageFlags.AllStages;
+        public StageFlags DstStages { get; set; } = StageFlags.AllStages;
+
+        internal NativeLLGL.ResourceBarrierDescriptor Native
+        {
+            get
+            {
+                var native = new NativeLLGL.ResourceBarrierDescriptor();
+                if (Resource != null)
+                {
+                    native.resource = Resource.NativeBase;
+                }
+                native.srcUsage  = (int)SrcUsage;
+                native.dstUsage  = (int)DstUsage;
+                native.srcStages = (int)SrcStages;
+                native.dstStages = (int)DstStages;
+                return native;
+            }
+        }
+    }
+
     public class DisplayMode
     {
         public Extent2D Resolution { get; set; }  = new Extent2D();
@@ -1902,6 +2180,7 @@ namespace LLGL
     {
         public ProfileCommandQueueRecord  CommandQueueRecord { get; set; }  = new ProfileCommandQueueRecord();
         public ProfileCommandBufferRecord CommandBufferRecord { get; set; } = new ProfileCommandBufferRecord();
+        public ProfileMemoryRecord        MemoryRecord { get; set; }        = new ProfileMemoryRecord();
         private ProfileTimeRecord[] timeRecords;
         private NativeLLGL.ProfileTimeRecord[] timeRecordsNative;
         public ProfileTimeRecord[] TimeRecords
@@ -1931,6 +2210,35 @@ namespace LLGL
                 }
             }
         }
+        private ProfilePassRecord[] passRecords;
+        private NativeLLGL.ProfilePassRecord[] passRecordsNative;
+        public ProfilePassRecord[] PassRecords
+        {
+            get
+            {
+                return passRecords;
+            }
+            set
+            {
+                if (value != null)
+                {
+                    passRecords = value;
+                    passRecordsNative = new NativeLLGL.ProfilePassRecord[passRecords.Length];
+                    for (int passRecordsIndex = 0; passRecordsIndex < passRecords.Length; ++passRecordsIndex)
+                    {
+                        if (passRecords[passRecordsIndex] != null)
+                        {
+                            passRecordsNative[passRecordsIndex] = passRecords[passRecordsIndex].Native;
+                        }
+                    }
+                }
+                else
+                {
+                    passRecords = null;
+                    passRecordsNative = null;
+                }
+            }
+        }
 
         public FrameProfile() { }
 
@@ -1947,11 +2255,17 @@ namespace LLGL
                 {
                     CommandQueueRecord.Native= value.commandQueueRecord;
                     CommandBufferRecord.Native= value.commandBufferRecord;
+                    MemoryRecord.Native= value.memoryRecord;
                     TimeRecords         = new ProfileTimeRecord[(int)value.numTimeRecords];
                     for (int i = 0; i < TimeRecords.Length; ++i)
                     {
                         TimeRecords[i] = new ProfileTimeRecord(value.timeRecords[i]);
                     }
+                    PassRecords         = new ProfilePassRecord[(int)value.numPassRecords];
+                    for (int i = 0; i < PassRecords.Length; ++i)
+                    {
+                        PassRecords[i] = new ProfilePassRecord(value.passRecords[i]);
+                    }
                 }
             }
         }
@@ -1976,6 +2290,25 @@ namespace LLGL
         }
     }
 
+    public class SubpassDescriptor
+    {
+        public int  ColorAttachmentMask { get; set; }    = ~0;
+        public int  InputAttachmentMask { get; set; }    = 0;
+        public bool DepthStencilAttachment { get; set; } = true;
+
+        internal NativeLLGL.SubpassDescriptor Native
+        {
+            get
+            {
+                var native = new NativeLLGL.SubpassDescriptor();
+                native.colorAttachmentMask    = ColorAttachmentMask;
+                native.inputAttachmentMask    = InputAttachmentMask;
+                native.depthStencilAttachment = DepthStencilAttachment;
+                return native;
+            }
+        }
+    }
+
     public class RenderingCapabilities
     {
         public ScreenOrigin      ScreenOrigin { get; set; }     = ScreenOrigin.UpperLeft;
@@ -2159,26 +2492,32 @@ namespace LLGL
     {
         public SwapChainDescriptor() { }
 
-        public SwapChainDescriptor(string debugName = null, Extent2D resolution = new Extent2D(), int colorBits = 32, int depthBits = 24, int stencilBits = 8, int samples = 1, int swapBuffers = 2, bool fullscreen = false)
-        {
-            DebugName   = debugName;
-            Resolution  = resolution;
-            ColorBits   = colorBits;
-            DepthBits   = depthBits;
-            StencilBits = stencilBits;
-            Samples     = samples;
-            SwapBuffers = swapBuffers;
-            Fullscreen  = fullscreen;
-        }
-
-        public AnsiString DebugName { get; set; }   = null;
-        public Extent2D   Resolution { get; set; }  = new Extent2D();
-        public int        ColorBits { get; set; }   = 32;
-        public int        DepthBits { get; set; }   = 24;
-        public int        StencilBits { get; set; } = 8;
-        public int        Samples { get; set; }     = 1;
-        public int        SwapBuffers { get; set; } = 2;
-        public bool       Fullscreen { get; set; }  = false;
+        public SwapChainDescriptor(string debugName = null, Extent2D resolution = new Extent2D(), int colorBits = 32, int depthBits = 24, int stencilBits = 8, int samples = 1, int swapBuffers = 2, int maxFramesInFlight = 0, PresentMode presentMode = PresentMode.Default, ColorSpace colorSpace = ColorSpace.SRGB, bool fullscreen = false)
+        {
+            DebugName         = debugName;
+            Resolution        = resolution;
+            ColorBits         = colorBits;
+            DepthBits         = depthBits;
+            StencilBits       = stencilBits;
+            Samples           = samples;
+            SwapBuffers       = swapBuffers;
+            MaxFramesInFlight = maxFramesInFlight;
+            PresentMode       = presentMode;
+            ColorSpace        = colorSpace;
+            Fullscreen        = fullscreen;
+        }
+
+        public AnsiString  DebugName { get; set; }         = null;
+        public Extent2D    Resolution { get; set; }        = new Extent2D();
+        public int         ColorBits { get; set; }         = 32;
+        public int         DepthBits { get; set; }         = 24;
+        public int         StencilBits { get; set; }       = 8;
+        public int         Samples { get; set; }           = 1;
+        public int         SwapBuffers { get; set; }       = 2;
+        public int         MaxFramesInFlight { get; set; } = 0;
+        public PresentMode PresentMode { get; set; }       = PresentMode.Default;
+        public ColorSpace  ColorSpace { get; set; }        = ColorSpace.SRGB;
+        public bool        Fullscreen { get; set; }        = false;
 
         internal NativeLLGL.SwapChainDescriptor Native
         {
@@ -2191,13 +2530,16 @@ namespace LLGL
                     {
                         native.debugName = debugNamePtr;
                     }
-                    native.resolution  = Resolution;
-                    native.colorBits   = ColorBits;
-                    native.depthBits   = DepthBits;
-                    native.stencilBits = StencilBits;
-                    native.samples     = Samples;
-                    native.swapBuffers = SwapBuffers;
-                    native.fullscreen  = Fullscreen;
+                    native.resolution        = Resolution;
+                    native.colorBits         = ColorBits;
+                    native.depthBits         = DepthBits;
+                    native.stencilBits       = StencilBits;
+                    native.samples           = Samples;
+                    native.swapBuffers       = SwapBuffers;
+                    native.maxFramesInFlight = MaxFramesInFlight;
+                    native.presentMode       = PresentMode;
+                    native.colorSpace        = ColorSpace;
+                    native.fullscreen        = Fullscreen;
                 }
                 return native;
             }
@@ -2216,6 +2558,7 @@ namespace LLGL
         public int            ArrayLayers { get; set; }    = 1;
         public int            MipLevels { get; set; }      = 0;
         public int            Samples { get; set; }        = 1;
+        public int            TransientSlot { get; set; }  = 0;
         public ClearValue     ClearValue { get; set; }     = new ClearValue();
 
         public TextureDescriptor() { }
@@ -2245,6 +2588,7 @@ namespace LLGL
                     native.arrayLayers    = ArrayLayers;
                     native.mipLevels      = MipLevels;
                     native.samples        = Samples;
+                    native.transientSlot  = TransientSlot;
                     if (ClearValue != null)
                     {
                         native.clearValue = ClearValue.Native;
@@ -2266,6 +2610,7 @@ namespace LLGL
                     ArrayLayers    = value.arrayLayers;
                     MipLevels      = value.mipLevels;
                     Samples        = value.samples;
+                    TransientSlot  = value.transientSlot;
                     ClearValue.Native= value.clearValue;
                 }
             }
@@ -2344,6 +2689,36 @@ namespace LLGL
         }
     }
 
+    public class WindowEvent
+    {
+        public WindowEventType Type { get; set; }        = WindowEventType.Quit;
+        public Key             KeyCode { get; set; }     = Key.Any;
+        public char            Chr { get; set; }         = '\0';
+        public int             WheelMotion { get; set; } = 0;
+        public Offset2D        Offset { get; set; }
+        public Extent2D        Size { get; set; }
+
+        public WindowEvent() { }
+
+        internal WindowEvent(NativeLLGL.WindowEvent native)
+        {
+            Native = native;
+        }
+
+        internal NativeLLGL.WindowEvent Native
+        {
+            set
+            {
+                Type        = value.type;
+                KeyCode     = value.keyCode;
+                Chr         = value.chr;
+                WheelMotion = value.wheelMotion;
+                Offset      = value.offset;
+                Size        = value.size;
+            }
+        }
+    }
+
     public class BufferDescriptor
     {
         public AnsiString        DebugName { get; set; }      = null;
@@ -2935,23 +3310,30 @@ namespace LLGL
 
     public class GraphicsPipelineDescriptor
     {
-        public AnsiString             DebugName { get; set; }            = null;
-        public PipelineLayout         PipelineLayout { get; set; }       = null;
-        public RenderPass             RenderPass { get; set; }           = null;
-        public Shader                 VertexShader { get; set; }         = null;
-        public Shader                 TessControlShader { get; set; }    = null;
-        public Shader                 TessEvaluationShader { get; set; } = null;
-        public Shader                 GeometryShader { get; set; }       = null;
-        public Shader                 FragmentShader { get; set; }       = null;
-        public Format                 IndexFormat { get; set; }          = Format.Undefined;
-        public PrimitiveTopology      PrimitiveTopology { get; set; }    = PrimitiveTopology.TriangleList;
-        public Viewport[]             Viewports { get; set; }
-        public Scissor[]              Scissors { get; set; }
-        public DepthDescriptor        Depth { get; set; }                = new DepthDescriptor();
-        public StencilDescriptor      Stencil { get; set; }              = new StencilDescriptor();
-        public RasterizerDescriptor   Rasterizer { get; set; }           = new RasterizerDescriptor();
-        public BlendDescriptor        Blend { get; set; }                = new BlendDescriptor();
-        public TessellationDescriptor Tessellation { get; set; }         = new TessellationDescriptor();
+        public AnsiString               DebugName { get; set; }               = null;
+        public PipelineLayout           PipelineLayout { get; set; }          = null;
+        public RenderPass               RenderPass { get; set; }              = null;
+        public int                      Subpass { get; set; }                 = 0;
+        public Shader                   VertexShader { get; set; }            = null;
+        public Shader                   TessControlShader { get; set; }       = null;
+        public Shader                   TessEvaluationShader { get; set; }    = null;
+        public Shader                   GeometryShader { get; set; }          = null;
+        public Shader                   FragmentShader { get; set; }          = null;
+        public Shader                   TaskShader { get; set; }              = null;
+        public Shader                   MeshShader { get; set; }              = null;
+        public Format                   IndexFormat { get; set; }             = Format.Undefined;
+        public PrimitiveTopology        PrimitiveTopology { get; set; }       = PrimitiveTopology.TriangleList;
+        public Viewport[]               Viewports { get; set; }
+        public Scissor[]                Scissors { get; set; }
+        public DepthDescriptor          Depth { get; set; }                   = new DepthDescriptor();
+        public StencilDescriptor        Stencil { get; set; }                 = new StencilDescriptor();
+        public RasterizerDescriptor     Rasterizer { get; set; }              = new RasterizerDescriptor();
+        public BlendDescriptor          Blend { get; set; }                   = new BlendDescriptor();
+        public TessellationDescriptor   Tessellation { get; set; }            = new TessellationDescriptor();
+        public DynamicStateFlags        DynamicStates { get; set; }           = 0;
+        public SpecializationConstant[] SpecializationConstants { get; set; }
+        public bool                     AsyncCompilation { get; set; }        = false;
+        public PipelineState            Placeholder { get; set; }             = null;
 
         internal NativeLLGL.GraphicsPipelineDescriptor Native
         {
@@ -2972,6 +3354,7 @@ namespace LLGL
                     {
                         native.renderPass = RenderPass.Native;
                     }
+                    native.subpass = Subpass;
                     if (VertexShader != null)
                     {
                         native.vertexShader = VertexShader.Native;
@@ -2992,6 +3375,14 @@ namespace LLGL
                     {
                         native.fragmentShader = FragmentShader.Native;
                     }
+                    if (TaskShader != null)
+                    {
+                        native.taskShader = TaskShader.Native;
+                    }
+                    if (MeshShader != null)
+                    {
+                        native.meshShader = MeshShader.Native;
+                    }
                     native.indexFormat          = IndexFormat;
                     native.primitiveTopology    = PrimitiveTopology;
                     if (Viewports != null)
@@ -3030,6 +3421,20 @@ namespace LLGL
                     {
                         native.tessellation = Tessellation.Native;
                     }
+                    native.dynamicStates = (int)DynamicStates;
+                    if (SpecializationConstants != null)
+                    {
+                        native.numSpecializationConstants = (IntPtr)SpecializationConstants.Length;
+                        fixed (SpecializationConstant* specializationConstantsPtr = SpecializationConstants)
+                        {
+                            native.specializationConstants = specializationConstantsPtr;
+                        }
+                    }
+                    native.asyncCompilation = AsyncCompilation;
+                    if (Placeholder != null)
+                    {
+                        native.placeholder = Placeholder.Native;
+                    }
                 }
                 return native;
             }
@@ -3418,11 +3823,17 @@ namespace LLGL
 
         public unsafe struct CommandBufferDescriptor
         {
-            public byte*      debugName;          /* = null */
-            public int        flags;              /* = 0 */
-            public int        numNativeBuffers;   /* = 2 */
-            public long       minStagingPoolSize; /* = (0xFFFF+1) */
-            public RenderPass renderPass;         /* = null */
+            public byte*        debugName;          /* = null */
+            public int          flags;              /* = 0 */
+            public int          numNativeBuffers;   /* = 2 */
+            public long         minStagingPoolSize; /* = (0xFFFF+1) */
+            public RenderPass   renderPass;         /* = null */
+            public CommandQueue commandQueue;       /* = null */
+        }
+
+        public unsafe struct DrawMeshIndirectArguments
+        {
+            public fixed int numWorkGroups[3];
         }
 
         public unsafe struct DispatchIndirectArguments
@@ -3439,15 +3850,33 @@ namespace LLGL
 
         public unsafe struct ComputePipelineDescriptor
         {
-            public byte*          debugName;      /* = null */
-            public PipelineLayout pipelineLayout; /* = null */
-            public Shader         computeShader;  /* = null */
+            public byte*                   debugName;                  /* = null */
+            public PipelineLayout          pipelineLayout;             /* = null */
+            public Shader                  computeShader;              /* = null */
+            public IntPtr                  numSpecializationConstants;
+            public SpecializationConstant* specializationConstants;
+            public bool                    asyncCompilation;           /* = false */
+            public PipelineState           placeholder;                /* = null */
         }
 
         public unsafe struct ProfileTimeRecord
         {
-            public byte* annotation;  /* = "" */
-            public long  elapsedTime; /* = 0 */
+            public byte* annotation;     /* = "" */
+            public long  elapsedTime;    /* = 0 */
+            public long  cpuTimestamp;   /* = 0 */
+            public long  cpuElapsedTime; /* = 0 */
+            public int   depth;          /* = 0 */
+            public int   commandBuffer;  /* = 0 */
+        }
+
+        public unsafe struct ProfilePassRecord
+        {
+            public byte*                   annotation;         /* = "" */
+            public long                    elapsedTime;        /* = 0 */
+            public QueryPipelineStatistics pipelineStatistics;
+            public int                     depth;              /* = 0 */
+            public int                     commandBuffer;      /* = 0 */
+            public int                     frameLatency;       /* = 0 */
         }
 
         public unsafe struct ProfileCommandQueueRecord
@@ -3487,6 +3916,19 @@ namespace LLGL
             public int renderConditionSections;  /* = 0 */
             public int drawCommands;             /* = 0 */
             public int dispatchCommands;         /* = 0 */
+            public int stateChanges;             /* = 0 */
+            public int redundantStateChanges;    /* = 0 */
+        }
+
+        public unsafe struct ProfileMemoryRecord
+        {
+            public long uploadedBytes;      /* = 0 */
+            public long readbackBytes;      /* = 0 */
+            public long stagingMemoryUsage; /* = 0 */
+            public long deviceMemoryUsage;  /* = 0 */
+            public long hostMemoryUsage;    /* = 0 */
+            public long heapAllocations;    /* = 0 */
+            public long heapAllocatedBytes; /* = 0 */
         }
 
         public unsafe struct RendererInfo
@@ -3501,6 +3943,16 @@ namespace LLGL
             public byte*  pipelineCacheID;
         }
 
+        public unsafe struct MemoryHeapInfo
+        {
+            public long size;         /* = 0 */
+            public long budget;       /* = 0 */
+            public long usage;        /* = 0 */
+            public long stagingUsage; /* = 0 */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool deviceLocal;  /* = false */
+        }
+
         public unsafe struct RenderingFeatures
         {
             [MarshalAs(UnmanagedType.I1)]
@@ -3544,12 +3996,18 @@ namespace LLGL
             [MarshalAs(UnmanagedType.I1)]
             public bool hasComputeShaders;            /* = false */
             [MarshalAs(UnmanagedType.I1)]
+            public bool hasMeshShaders;               /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool hasRayTracing;                /* = false */
+            [MarshalAs(UnmanagedType.I1)]
             public bool hasInstancing;                /* = false */
             [MarshalAs(UnmanagedType.I1)]
             public bool hasOffsetInstancing;          /* = false */
             [MarshalAs(UnmanagedType.I1)]
             public bool hasIndirectDrawing;           /* = false */
             [MarshalAs(UnmanagedType.I1)]
+            public bool hasIndirectDrawCount;         /* = false */
+            [MarshalAs(UnmanagedType.I1)]
             public bool hasViewportArrays;            /* = false */
             [MarshalAs(UnmanagedType.I1)]
             public bool hasConservativeRasterization; /* = false */
@@ -3563,6 +4021,20 @@ namespace LLGL
             public bool hasPipelineStatistics;        /* = false */
             [MarshalAs(UnmanagedType.I1)]
             public bool hasRenderCondition;           /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool hasBufferRenderCondition;     /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool hasBindlessDescriptors;       /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool hasSparseTextures;            /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool hasVariableRateShading;       /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool hasExtendedDynamicState;      /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool hasTimestampCalibration;      /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool hasSubpasses;                 /* = false */
         }
 
         public unsafe struct RenderingLimits
@@ -3643,6 +4115,15 @@ namespace LLGL
             public ClearValue clearValue;
         }
 
+        public unsafe struct ResourceBarrierDescriptor
+        {
+            public Resource resource;  /* = null */
+            public int      srcUsage;  /* = 0 */
+            public int      dstUsage;  /* = 0 */
+            public int      srcStages; /* = StageFlags.AllStages */
+            public int      dstStages; /* = StageFlags.AllStages */
+        }
+
         public unsafe struct DisplayMode
         {
             public Extent2D resolution;
@@ -3766,8 +4247,11 @@ namespace LLGL
         {
             public ProfileCommandQueueRecord  commandQueueRecord;
             public ProfileCommandBufferRecord commandBufferRecord;
+            public ProfileMemoryRecord        memoryRecord;
             public IntPtr                     numTimeRecords;
             public ProfileTimeRecord*         timeRecords;
+            public IntPtr                     numPassRecords;
+            public ProfilePassRecord*         passRecords;
         }
 
         public unsafe struct AttachmentFormatDescriptor
@@ -3777,6 +4261,13 @@ namespace LLGL
             public AttachmentStoreOp storeOp; /* = AttachmentStoreOp.Undefined */
         }
 
+        public unsafe struct SubpassDescriptor
+        {
+            public int  colorAttachmentMask;    /* = ~0 */
+            public int  inputAttachmentMask;    /* = 0 */
+            public bool depthStencilAttachment; /* = true */
+        }
+
         public unsafe struct RenderSystemDescriptor
         {
             public byte*             moduleName;
@@ -3837,15 +4328,18 @@ namespace LLGL
 
         public unsafe struct SwapChainDescriptor
         {
-            public byte*    debugName;   /* = null */
-            public Extent2D resolution;
-            public int      colorBits;   /* = 32 */
-            public int      depthBits;   /* = 24 */
-            public int      stencilBits; /* = 8 */
-            public int      samples;     /* = 1 */
-            public int      swapBuffers; /* = 2 */
+            public byte*       debugName;         /* = null */
+            public Extent2D    resolution;
+            public int         colorBits;         /* = 32 */
+            public int         depthBits;         /* = 24 */
+            public int         stencilBits;       /* = 8 */
+            public int         samples;           /* = 1 */
+            public int         swapBuffers;       /* = 2 */
+            public int         maxFramesInFlight; /* = 0 */
+            public PresentMode presentMode;       /* = PresentMode.Default */
+            public ColorSpace  colorSpace;        /* = ColorSpace.SRGB */
             [MarshalAs(UnmanagedType.I1)]
-            public bool     fullscreen;  /* = false */
+            public bool        fullscreen;        /* = false */
         }
 
         public unsafe struct TextureDescriptor
@@ -3860,6 +4354,7 @@ namespace LLGL
             public int         arrayLayers;    /* = 1 */
             public int         mipLevels;      /* = 0 */
             public int         samples;        /* = 1 */
+            public int         transientSlot;  /* = 0 */
             public ClearValue  clearValue;
         }
 
@@ -3886,6 +4381,16 @@ namespace LLGL
             public IntPtr   windowContextSize; /* = 0 */
         }
 
+        public unsafe struct WindowEvent
+        {
+            public WindowEventType type;        /* = WindowEventType.Quit */
+            public Key             keyCode;     /* = Key.Any */
+            public char            chr;         /* = '\0' */
+            public int             wheelMotion; /* = 0 */
+            public Offset2D        offset;
+            public Extent2D        size;
+        }
+
         public unsafe struct BufferDescriptor
         {
             public byte*            debugName;        /* = null */
@@ -3952,6 +4457,8 @@ namespace LLGL
             public AttachmentFormatDescriptor depthAttachment;
             public AttachmentFormatDescriptor stencilAttachment;
             public int                        samples;           /* = 1 */
+            public IntPtr                     numSubpasses;      /* = 0 */
+            public SubpassDescriptor*         subpasses;         /* = null */
         }
 
         public unsafe struct RenderTargetDescriptor
@@ -4023,25 +4530,33 @@ namespace LLGL
 
         public unsafe struct GraphicsPipelineDescriptor
         {
-            public byte*                  debugName;            /* = null */
-            public PipelineLayout         pipelineLayout;       /* = null */
-            public RenderPass             renderPass;           /* = null */
-            public Shader                 vertexShader;         /* = null */
-            public Shader                 tessControlShader;    /* = null */
-            public Shader                 tessEvaluationShader; /* = null */
-            public Shader                 geometryShader;       /* = null */
-            public Shader                 fragmentShader;       /* = null */
-            public Format                 indexFormat;          /* = Format.Undefined */
-            public PrimitiveTopology      primitiveTopology;    /* = PrimitiveTopology.TriangleList */
-            public IntPtr                 numViewports;
-            public Viewport*              viewports;
-            public IntPtr                 numScissors;
-            public Scissor*               scissors;
-            public DepthDescriptor        depth;
-            public StencilDescriptor      stencil;
-            public RasterizerDescriptor   rasterizer;
-            public BlendDescriptor        blend;
-            public TessellationDescriptor tessellation;
+            public byte*                   debugName;                  /* = null */
+            public PipelineLayout          pipelineLayout;             /* = null */
+            public RenderPass              renderPass;                 /* = null */
+            public int                     subpass;                    /* = 0 */
+            public Shader                  vertexShader;               /* = null */
+            public Shader                  tessControlShader;          /* = null */
+            public Shader                  tessEvaluationShader;       /* = null */
+            public Shader                  geometryShader;             /* = null */
+            public Shader                  fragmentShader;             /* = null */
+            public Shader                  taskShader;                 /* = null */
+            public Shader                  meshShader;                 /* = null */
+            public Format                  indexFormat;                /* = Format.Undefined */
+            public PrimitiveTopology       primitiveTopology;          /* = PrimitiveTopology.TriangleList */
+            public IntPtr                  numViewports;
+            public Viewport*               viewports;
+            public IntPtr                  numScissors;
+            public Scissor*                scissors;
+            public DepthDescriptor         depth;
+            public StencilDescriptor       stencil;
+            public RasterizerDescriptor    rasterizer;
+            public BlendDescriptor         blend;
+            public TessellationDescriptor  tessellation;
+            public int                     dynamicStates;              /* = 0 */
+            public IntPtr                  numSpecializationConstants;
+            public SpecializationConstant* specializationConstants;
+            public bool                    asyncCompilation;           /* = false */
+            public PipelineState           placeholder;                /* = null */
         }
 
         public unsafe struct ResourceViewDescriptor
@@ -4181,7 +4696,7 @@ namespace LLGL
         public static extern unsafe void Execute(CommandBuffer deferredCommandBuffer);
 
         [DllImport(DllName, EntryPoint="llglUpdateBuffer", CallingConvention=CallingConvention.Cdecl)]
-        public static extern unsafe void UpdateBuffer(Buffer dstBuffer, long dstOffset, void* data, short dataSize);
+        public static extern unsafe void UpdateBuffer(Buffer dstBuffer, long dstOffset, void* data, long dataSize);
 
         [DllImport(DllName, EntryPoint="llglCopyBuffer", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void CopyBuffer(Buffer dstBuffer, long dstOffset, Buffer srcBuffer, long srcOffset, long size);
@@ -4201,6 +4716,9 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglCopyTextureFromFramebuffer", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void CopyTextureFromFramebuffer(Texture dstTexture, ref TextureRegion dstRegion, ref Offset2D srcOffset);
 
+        [DllImport(DllName, EntryPoint="llglBlitTexture", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void BlitTexture(Texture dstTexture, ref TextureRegion dstRegion, Texture srcTexture, ref TextureRegion srcRegion, SamplerFilter filter);
+
         [DllImport(DllName, EntryPoint="llglGenerateMips", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void GenerateMips(Texture texture);
 
@@ -4237,9 +4755,15 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglSetResource", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void SetResource(int descriptor, Resource resource);
 
+        [DllImport(DllName, EntryPoint="llglSetResources", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetResources(int firstDescriptor, int numResources, Resource* resources);
+
         [DllImport(DllName, EntryPoint="llglResetResourceSlots", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void ResetResourceSlots(ResourceType resourceType, int firstSlot, int numSlots, int bindFlags, int stageFlags);
 
+        [DllImport(DllName, EntryPoint="llglResourceBarrier", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void ResourceBarrier(int numBarriers, ResourceBarrierDescriptor* barriers);
+
         [DllImport(DllName, EntryPoint="llglBeginRenderPass", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void BeginRenderPass(RenderTarget renderTarget);
 
@@ -4249,6 +4773,9 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglEndRenderPass", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void EndRenderPass();
 
+        [DllImport(DllName, EntryPoint="llglNextSubpass", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void NextSubpass();
+
         [DllImport(DllName, EntryPoint="llglClear", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void Clear(int flags, ref ClearValue clearValue);
 
@@ -4264,6 +4791,21 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglSetStencilReference", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void SetStencilReference(int reference, StencilFace stencilFace);
 
+        [DllImport(DllName, EntryPoint="llglSetShadingRate", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetShadingRate(ShadingRate rate);
+
+        [DllImport(DllName, EntryPoint="llglSetCullMode", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetCullMode(CullMode cullMode);
+
+        [DllImport(DllName, EntryPoint="llglSetDepthState", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetDepthState(ref DepthDescriptor depthDesc);
+
+        [DllImport(DllName, EntryPoint="llglSetStencilState", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetStencilState(ref StencilDescriptor stencilDesc);
+
+        [DllImport(DllName, EntryPoint="llglSetPrimitiveTopology", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetPrimitiveTopology(PrimitiveTopology topology);
+
         [DllImport(DllName, EntryPoint="llglSetUniforms", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void SetUniforms(int first, void* data, short dataSize);
 
@@ -4276,9 +4818,15 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglBeginRenderCondition", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void BeginRenderCondition(QueryHeap queryHeap, int query, RenderConditionMode mode);
 
+        [DllImport(DllName, EntryPoint="llglBeginRenderConditionBuffer", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void BeginRenderConditionBuffer(Buffer buffer, long offset, RenderConditionMode mode);
+
         [DllImport(DllName, EntryPoint="llglEndRenderCondition", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void EndRenderCondition();
 
+        [DllImport(DllName, EntryPoint="llglResolveQueries", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void ResolveQueries(QueryHeap queryHeap, int firstQuery, int numQueries, Buffer dstBuffer, long dstOffset);
+
         [DllImport(DllName, EntryPoint="llglBeginStreamOutput", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void BeginStreamOutput(int numBuffers, Buffer* buffers);
 
@@ -4312,12 +4860,24 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglDrawIndirectExt", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void DrawIndirectExt(Buffer buffer, long offset, int numCommands, int stride);
 
+        [DllImport(DllName, EntryPoint="llglDrawIndirectCount", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void DrawIndirectCount(Buffer buffer, long offset, Buffer countBuffer, long countBufferOffset, int maxNumCommands, int stride);
+
         [DllImport(DllName, EntryPoint="llglDrawIndexedIndirect", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void DrawIndexedIndirect(Buffer buffer, long offset);
 
         [DllImport(DllName, EntryPoint="llglDrawIndexedIndirectExt", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void DrawIndexedIndirectExt(Buffer buffer, long offset, int numCommands, int stride);
 
+        [DllImport(DllName, EntryPoint="llglDrawIndexedIndirectCount", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void DrawIndexedIndirectCount(Buffer buffer, long offset, Buffer countBuffer, long countBufferOffset, int maxNumCommands, int stride);
+
+        [DllImport(DllName, EntryPoint="llglDrawMesh", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void DrawMesh(int numWorkGroupsX, int numWorkGroupsY, int numWorkGroupsZ);
+
+        [DllImport(DllName, EntryPoint="llglDrawMeshIndirect", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void DrawMeshIndirect(Buffer buffer, long offset, int numCommands, int stride);
+
         [DllImport(DllName, EntryPoint="llglDispatch", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void Dispatch(int numWorkGroupsX, int numWorkGroupsY, int numWorkGroupsZ);
 
@@ -4337,13 +4897,26 @@ namespace LLGL
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern unsafe bool GetNativeHandle(void* nativeHandle, IntPtr nativeHandleSize);
 
+        [DllImport(DllName, EntryPoint="llglExecuteCommandPackets", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void ExecuteCommandPackets(int numPackets, CommandPacket* packets);
+
         [DllImport(DllName, EntryPoint="llglSubmitCommandBuffer", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void SubmitCommandBuffer(CommandBuffer commandBuffer);
 
+        [DllImport(DllName, EntryPoint="llglSubmitCommandBuffers", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SubmitCommandBuffers(int numCommandBuffers, CommandBuffer* commandBuffers);
+
+        [DllImport(DllName, EntryPoint="llglPresentSwapChains", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void PresentSwapChains(int numSwapChains, SwapChain* swapChains);
+
         [DllImport(DllName, EntryPoint="llglQueryResult", CallingConvention=CallingConvention.Cdecl)]
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern unsafe bool QueryResult(QueryHeap queryHeap, int firstQuery, int numQueries, void* data, IntPtr dataSize);
 
+        [DllImport(DllName, EntryPoint="llglQueryTimestampCalibration", CallingConvention=CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool QueryTimestampCalibration(ref TimestampCalibration outCalibration);
+
         [DllImport(DllName, EntryPoint="llglSubmitFence", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void SubmitFence(Fence fence);
 
@@ -4351,6 +4924,16 @@ namespace LLGL
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern unsafe bool WaitFence(Fence fence, long timeout);
 
+        [DllImport(DllName, EntryPoint="llglSubmitFenceValue", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SubmitFenceValue(Fence fence, long value);
+
+        [DllImport(DllName, EntryPoint="llglSubmitWaitFenceValue", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SubmitWaitFenceValue(Fence fence, long value);
+
+        [DllImport(DllName, EntryPoint="llglWaitFenceValue", CallingConvention=CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern unsafe bool WaitFenceValue(Fence fence, long value, long timeout);
+
         [DllImport(DllName, EntryPoint="llglWaitIdle", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void WaitIdle();
 
@@ -4405,6 +4988,17 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglGetSupportedDisplayModes", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe IntPtr GetSupportedDisplayModes(Display display, IntPtr maxNumDisplayModes, DisplayMode* outDisplayModes);
 
+        [DllImport(DllName, EntryPoint="llglWaitForVBlank", CallingConvention=CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern unsafe bool WaitForVBlank(Display display);
+
+        [DllImport(DllName, EntryPoint="llglGetDisplayVBlankTiming", CallingConvention=CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern unsafe bool GetDisplayVBlankTiming(Display display, ref DisplayVBlankTiming outTiming);
+
+        [DllImport(DllName, EntryPoint="llglGetFenceCompletedValue", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe long GetFenceCompletedValue(Fence fence);
+
         [DllImport(DllName, EntryPoint="llglRegisterLogCallback", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe IntPtr RegisterLogCallback(IntPtr callback, void* userData);
 
@@ -4435,6 +5029,10 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglGetPipelineStateReport", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe Report GetPipelineStateReport(PipelineState pipelineState);
 
+        [DllImport(DllName, EntryPoint="llglIsPipelineStateReady", CallingConvention=CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern unsafe bool IsPipelineStateReady(PipelineState pipelineState);
+
         [DllImport(DllName, EntryPoint="llglGetQueryHeapType", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe QueryType GetQueryHeapType(QueryHeap queryHeap);
 
@@ -4451,6 +5049,29 @@ namespace LLGL
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern unsafe bool GetDebuggerTimeRecording(RenderingDebugger debugger);
 
+        [DllImport(DllName, EntryPoint="llglSetDebuggerPassRecording", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetDebuggerPassRecording(RenderingDebugger debugger, [MarshalAs(UnmanagedType.I1)] bool enabled);
+
+        [DllImport(DllName, EntryPoint="llglGetDebuggerPassRecording", CallingConvention=CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern unsafe bool GetDebuggerPassRecording(RenderingDebugger debugger);
+
+        [DllImport(DllName, EntryPoint="llglSetDebuggerValidationSampling", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetDebuggerValidationSampling(RenderingDebugger debugger, int interval, [MarshalAs(UnmanagedType.I1)] bool perCommandBuffer);
+
+        [DllImport(DllName, EntryPoint="llglGetDebuggerValidationSamplingInterval", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe int GetDebuggerValidationSamplingInterval(RenderingDebugger debugger);
+
+        [DllImport(DllName, EntryPoint="llglIsDebuggerValidationSampledPerCommandBuffer", CallingConvention=CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern unsafe bool IsDebuggerValidationSampledPerCommandBuffer(RenderingDebugger debugger);
+
+        [DllImport(DllName, EntryPoint="llglCaptureDebuggerFrame", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void CaptureDebuggerFrame(RenderingDebugger debugger, [MarshalAs(UnmanagedType.LPStr)] string filename);
+
+        [DllImport(DllName, EntryPoint="llglSaveDebuggerPipelineManifest", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SaveDebuggerPipelineManifest(RenderingDebugger debugger, [MarshalAs(UnmanagedType.LPStr)] string filename);
+
         [DllImport(DllName, EntryPoint="llglFlushDebuggerProfile", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void FlushDebuggerProfile(RenderingDebugger debugger, ref FrameProfile outFrameProfile);
 
@@ -4569,6 +5190,9 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglCreateShader", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe Shader CreateShader(ref ShaderDescriptor shaderDesc);
 
+        [DllImport(DllName, EntryPoint="llglCreateShaders", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe int CreateShaders(IntPtr numShaderDescs, ShaderDescriptor* shaderDescs, Shader* outShaders);
+
         [DllImport(DllName, EntryPoint="llglReleaseShader", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void ReleaseShader(Shader shader);
 
@@ -4615,6 +5239,21 @@ namespace LLGL
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern unsafe bool GetRenderSystemNativeHandle(void* nativeHandle, IntPtr nativeHandleSize);
 
+        [DllImport(DllName, EntryPoint="llglGetSparseTextureProperties", CallingConvention=CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern unsafe bool GetSparseTextureProperties(Texture texture, ref SparseTextureProperties outProperties);
+
+        [DllImport(DllName, EntryPoint="llglCommitTextureTiles", CallingConvention=CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern unsafe bool CommitTextureTiles(Texture texture, ref TextureRegion textureRegion, [MarshalAs(UnmanagedType.I1)] bool commit);
+
+        [DllImport(DllName, EntryPoint="llglMakeResident", CallingConvention=CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern unsafe bool MakeResident(IntPtr numResources, Resource* resources);
+
+        [DllImport(DllName, EntryPoint="llglEvict", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void Evict(IntPtr numResources, Resource* resources);
+
         [DllImport(DllName, EntryPoint="llglSetDebugName", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void SetDebugName(RenderSystemChild renderSystemChild, [MarshalAs(UnmanagedType.LPStr)] string name);
 
@@ -4665,6 +5304,9 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglGetResourceType", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe ResourceType GetResourceType(Resource resource);
 
+        [DllImport(DllName, EntryPoint="llglSetResidencyPriority", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetResidencyPriority(Resource resource, ResidencyPriority priority);
+
         [DllImport(DllName, EntryPoint="llglGetResourceHeapNumDescriptorSets", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe int GetResourceHeapNumDescriptorSets(ResourceHeap resourceHeap);
 
@@ -4842,6 +5484,15 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglRemoveWindowEventListener", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void RemoveWindowEventListener(Window window, int eventListenerID);
 
+        [DllImport(DllName, EntryPoint="llglSetWindowEventQueueEnabled", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetWindowEventQueueEnabled(Window window, bool enable);
+
+        [DllImport(DllName, EntryPoint="llglGetWindowEventQueue", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe IntPtr GetWindowEventQueue(Window window, IntPtr maxEvents, WindowEvent* outEvents);
+
+        [DllImport(DllName, EntryPoint="llglClearWindowEventQueue", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void ClearWindowEventQueue(Window window);
+
         [DllImport(DllName, EntryPoint="llglPostWindowQuit", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void PostWindowQuit(Window window);
 
@@ -0,0 +1,167 @@
+/*
+ * NativeLLGLFast.cs
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+using System;
+using System.Runtime.InteropServices;
+using System.Security;
+
+namespace LLGL
+{
+    /*
+    Hand-written imports for the per-draw CommandBuffer functions, which are called far more often than any other function of the C99 wrapper.
+    All parameters are blittable, so these calls require neither marshaling stubs nor GC allocations.
+    Unmanaged code security checks are suppressed, which avoids a stack walk per call on .NET Framework.
+    When targeting .NET 5 or later, defining LLGL_SUPPRESS_GC_TRANSITION also removes the GC transition of each call. This must only be defined
+    if no log callbacks are registered from managed code, since these functions must then neither block nor call back into managed code.
+    */
+    [SuppressUnmanagedCodeSecurity]
+    internal static class NativeLLGLFast
+    {
+        #if DEBUG
+        const string DllName = "LLGLD";
+        #else
+        const string DllName = "LLGL";
+        #endif
+
+        #if LLGL_SUPPRESS_GC_TRANSITION
+        [SuppressGCTransition]
+        #endif
+        [DllImport(DllName, EntryPoint="llglSetViewport", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetViewport(ref Viewport viewport);
+
+        #if LLGL_SUPPRESS_GC_TRANSITION
+        [SuppressGCTransition]
+        #endif
+        [DllImport(DllName, EntryPoint="llglSetScissor", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetScissor(ref Scissor scissor);
+
+        #if LLGL_SUPPRESS_GC_TRANSITION
+        [SuppressGCTransition]
+        #endif
+        [DllImport(DllName, EntryPoint="llglSetVertexBuffer", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetVertexBuffer(NativeLLGL.Buffer buffer);
+
+        #if LLGL_SUPPRESS_GC_TRANSITION
+        [SuppressGCTransition]
+        #endif
+        [DllImport(DllName, EntryPoint="llglSetIndexBuffer", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetIndexBuffer(NativeLLGL.Buffer buffer);
+
+        #if LLGL_SUPPRESS_GC_TRANSITION
+        [SuppressGCTransition]
+        #endif
+        [DllImport(DllName, EntryPoint="llglSetIndexBufferExt", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetIndexBufferExt(NativeLLGL.Buffer buffer, Format format, long offset);
+
+        #if LLGL_SUPPRESS_GC_TRANSITION
+        [SuppressGCTransition]
+        #endif
+        [DllImport(DllName, EntryPoint="llglSetResourceHeap", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetResourceHeap(NativeLLGL.ResourceHeap resourceHeap, int descriptorSet);
+
+        #if LLGL_SUPPRESS_GC_TRANSITION
+        [SuppressGCTransition]
+        #endif
+        [DllImport(DllName, EntryPoint="llglSetResource", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetResource(int descriptor, NativeLLGL.Resource resource);
+
+        #if LLGL_SUPPRESS_GC_TRANSITION
+        [SuppressGCTransition]
+        #endif
+        [DllImport(DllName, EntryPoint="llglClear", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void Clear(int flags, ref NativeLLGL.ClearValue clearValue);
+
+        #if LLGL_SUPPRESS_GC_TRANSITION
+        [SuppressGCTransition]
+        #endif
+        [DllImport(DllName, EntryPoint="llglSetPipelineState", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetPipelineState(NativeLLGL.PipelineState pipelineState);
+
+        #if LLGL_SUPPRESS_GC_TRANSITION
+        [SuppressGCTransition]
+        #endif
+        [DllImport(DllName, EntryPoint="llglSetStencilReference", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetStencilReference(int reference, StencilFace stencilFace);
+
+        #if LLGL_SUPPRESS_GC_TRANSITION
+        [SuppressGCTransition]
+        #endif
+        [DllImport(DllName, EntryPoint="llglSetUniforms", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetUniforms(int first, void* data, short dataSize);
+
+        #if LLGL_SUPPRESS_GC_TRANSITION
+        [SuppressGCTransition]
+        #endif
+        [DllImport(DllName, EntryPoint="llglDraw", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void Draw(int numVertices, int firstVertex);
+
+        #if LLGL_SUPPRESS_GC_TRANSITION
+        [SuppressGCTransition]
+        #endif
+        [DllImport(DllName, EntryPoint="llglDrawIndexed", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void DrawIndexed(int numIndices, int firstIndex);
+
+        #if LLGL_SUPPRESS_GC_TRANSITION
+        [SuppressGCTransition]
+        #endif
+        [DllImport(DllName, EntryPoint="llglDrawIndexedExt", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void DrawIndexedExt(int numIndices, int firstIndex, int vertexOffset);
+
+        #if LLGL_SUPPRESS_GC_TRANSITION
+        [SuppressGCTransition]
+        #endif
+        [DllImport(DllName, EntryPoint="llglDrawInstanced", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void DrawInstanced(int numVertices, int firstVertex, int numInstances);
+
+        #if LLGL_SUPPRESS_GC_TRANSITION
+        [SuppressGCTransition]
+        #endif
+        [DllImport(DllName, EntryPoint="llglDrawInstancedExt", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void DrawInstancedExt(int numVertices, int firstVertex, int numInstances, int firstInstance);
+
+        #if LLGL_SUPPRESS_GC_TRANSITION
+        [SuppressGCTransition]
+        #endif
+        [DllImport(DllName, EntryPoint="llglDrawIndexedInstanced", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void DrawIndexedInstanced(int numIndices, int numInstances, int firstIndex);
+
+        #if LLGL_SUPPRESS_GC_TRANSITION
+        [SuppressGCTransition]
+        #endif
+        [DllImport(DllName, EntryPoint="llglDrawIndexedInstancedExt", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void DrawIndexedInstancedExt(int numIndices, int numInstances, int firstIndex, int vertexOffset, int firstInstance);
+
+        #if LLGL_SUPPRESS_GC_TRANSITION
+        [SuppressGCTransition]
+        #endif
+        [DllImport(DllName, EntryPoint="llglDrawMesh", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void DrawMesh(int numWorkGroupsX, int numWorkGroupsY, int numWorkGroupsZ);
+
+        #if LLGL_SUPPRESS_GC_TRANSITION
+        [SuppressGCTransition]
+        #endif
+        [DllImport(DllName, EntryPoint="llglDispatch", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void Dispatch(int numWorkGroupsX, int numWorkGroupsY, int numWorkGroupsZ);
+
+        #if LLGL_SUPPRESS_GC_TRANSITION
+        [SuppressGCTransition]
+        #endif
+        [DllImport(DllName, EntryPoint="llglPushDebugGroup", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void PushDebugGroup(byte* name);
+
+        #if LLGL_SUPPRESS_GC_TRANSITION
+        [SuppressGCTransition]
+        #endif
+        [DllImport(DllName, EntryPoint="llglPopDebugGroup", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void PopDebugGroup();
+    }
+}
+
+
+
+
+// ================================================================================
@@ -49,6 +49,14 @@ namespace LLGL
                 }
             }
         }
+
+        public bool IsReady
+        {
+            get
+            {
+                return NativeLLGL.IsPipelineStateReady(Native);
+            }
+        }
     }
 }
 
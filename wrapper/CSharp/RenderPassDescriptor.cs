@@ -17,6 +17,35 @@ namespace LLGL
         public AttachmentFormatDescriptor DepthAttachment { get; set; } = new AttachmentFormatDescriptor();
         public AttachmentFormatDescriptor StencilAttachment { get; set; } = new AttachmentFormatDescriptor();
         public int Samples { get; set; } = 1;
+        private SubpassDescriptor[] subpasses;
+        private NativeLLGL.SubpassDescriptor[] subpassesNative;
+        public SubpassDescriptor[] Subpasses
+        {
+            get
+            {
+                return subpasses;
+            }
+            set
+            {
+                if (value != null)
+                {
+                    subpasses = value;
+                    subpassesNative = new NativeLLGL.SubpassDescriptor[subpasses.Length];
+                    for (int subpassIndex = 0; subpassIndex < subpasses.Length; ++subpassIndex)
+                    {
+                        if (subpasses[subpassIndex] != null)
+                        {
+                            subpassesNative[subpassIndex] = subpasses[subpassIndex].Native;
+                        }
+                    }
+                }
+                else
+                {
+                    subpasses = null;
+                    subpassesNative = null;
+                }
+            }
+        }
 
         internal NativeLLGL.RenderPassDescriptor Native
         {
@@ -37,6 +66,14 @@ namespace LLGL
                     native.depthAttachment = DepthAttachment.Native;
                     native.stencilAttachment = StencilAttachment.Native;
                     native.samples = Samples;
+                    if (subpasses != null)
+                    {
+                        native.numSubpasses = (IntPtr)subpasses.Length;
+                        fixed (NativeLLGL.SubpassDescriptor* subpassesPtr = subpassesNative)
+                        {
+                            native.subpasses = subpassesPtr;
+                        }
+                    }
                 }
                 return native;
             }
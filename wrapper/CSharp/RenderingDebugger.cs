@@ -36,6 +36,49 @@ namespace LLGL
             }
         }
 
+        public bool PassRecording
+        {
+            get
+            {
+                return NativeLLGL.GetDebuggerPassRecording(Native);
+            }
+            set
+            {
+                NativeLLGL.SetDebuggerPassRecording(Native, value);
+            }
+        }
+
+        public int ValidationSamplingInterval
+        {
+            get
+            {
+                return NativeLLGL.GetDebuggerValidationSamplingInterval(Native);
+            }
+        }
+
+        public bool ValidationSampledPerCommandBuffer
+        {
+            get
+            {
+                return NativeLLGL.IsDebuggerValidationSampledPerCommandBuffer(Native);
+            }
+        }
+
+        public void SetValidationSampling(int interval, bool perCommandBuffer = false)
+        {
+            NativeLLGL.SetDebuggerValidationSampling(Native, interval, perCommandBuffer);
+        }
+
+        public void CaptureFrame(string filename)
+        {
+            NativeLLGL.CaptureDebuggerFrame(Native, filename);
+        }
+
+        public void SavePipelineManifest(string filename)
+        {
+            NativeLLGL.SaveDebuggerPipelineManifest(Native, filename);
+        }
+
         public FrameProfile FlushProfile()
         {
             var nativeFrameProfile = new NativeLLGL.FrameProfile();